@@ -130,6 +130,7 @@ __inline void fpmul1271(felm_t a, felm_t b, felm_t c)
 { // Field multiplication, c = a*b mod (2^127-1)
     uint128_t tt1, tt2, tt3 = {0};
     
+    OPCOUNT(fpmul);
 #if defined(UINT128_SUPPORT)
     tt1 = (uint128_t)a[0]*b[0];
     tt2 = (uint128_t)a[0]*b[1] + (uint128_t)a[1]*b[0] + (uint64_t)(tt1 >> 64);
@@ -163,6 +164,7 @@ void fpsqr1271(felm_t a, felm_t c)
 { // Field squaring, c = a^2 mod (2^127-1)
     uint128_t tt1, tt2, tt3 = {0};
   
+    OPCOUNT(fpsqr);
 #if defined(UINT128_SUPPORT)
     tt1 = (uint128_t)a[0]*a[0];
     tt2 = (uint128_t)a[0]*(a[1]*2) + (uint64_t)(tt1 >> 64);
@@ -233,6 +235,7 @@ void fpinv1271(felm_t a)
   // Hardcoded for p = 2^127-1
     felm_t t;
 
+    OPCOUNT(fpinv);
     fpexp1251(a, t);    
     fpsqr1271(t, t);     
     fpsqr1271(t, t);                             
@@ -118,6 +118,10 @@ extern "C" {
     #define SIMD_SUPPORT NO_SIMD_SUPPORT
 #endif
 
+#if defined(_AVX512IFMA_)                   // AVX-512 IFMA support selection (8-way arithmetic for batch operations)
+    #define AVX512IFMA_SUPPORT
+#endif
+
 #if defined(_ASM_)                          // Assembly support selection
     #define ASM_SUPPORT
 #endif
@@ -126,6 +130,26 @@ extern "C" {
     #define GENERIC_IMPLEMENTATION
 #endif
 
+#if defined(_DISPATCH_)                     // Runtime selection of the backend based on the CPU features (see FourQ_set_backend())
+    #define DISPATCH_SUPPORT
+#endif
+
+#if defined(_THREADS_)                      // Thread pool and multithreaded batch functions (see fourq_pool_create())
+    #define THREADS_SUPPORT
+#endif
+
+#if defined(_OPCOUNT_)                      // Counting of field and curve operations (see FourQ_get_opcounts())
+    #define OPCOUNT_SUPPORT
+#endif
+
+#if defined(_COMPACT_FIXEDBASE_)            // Fixed-base table with points stored as (x+y,y-x) (see table_lookup_fixed_base())
+    #define COMPACT_FIXEDBASE_SUPPORT
+#endif
+
+#if defined(_SMALL_STACK_)                  // Bounded-stack mode: per-thread working sets for the scalar multiplications (see WORKING_SET())
+    #define SMALL_STACK_SUPPORT
+#endif
+
 
 // Unsupported configurations
                          
@@ -141,15 +165,61 @@ extern "C" {
     #error -- "Unsupported configuration"
 #endif
 
+#if defined(AVX512IFMA_SUPPORT) && (SIMD_SUPPORT != AVX2_SUPPORT)
+    #error -- "Unsupported configuration"
+#endif
+
 #if (TARGET != TARGET_AMD64 && TARGET != TARGET_ARM64) && !defined(GENERIC_IMPLEMENTATION)
     #error -- "Unsupported configuration"
 #endif
 
+#if defined(DISPATCH_SUPPORT) && (TARGET != TARGET_AMD64 || !defined(ASM_SUPPORT) || SIMD_SUPPORT != NO_SIMD_SUPPORT || defined(AVX512IFMA_SUPPORT))
+    #error -- "Unsupported configuration"   // Runtime dispatch builds all the x64 backends and selects one of them at load time
+#endif
+
+#if defined(THREADS_SUPPORT) && (OS_TARGET != OS_LINUX)
+    #error -- "Multithreading is only supported on Linux"
+#endif
+
+#if defined(THREADS_SUPPORT) && defined(FOURQ_NO_MALLOC)   // FOURQ_NO_MALLOC: build without heap allocation (see ecc_mul_multi_workspace() and SchnorrQ_VerifyBatchWorkspace())
+    #error -- "The thread pool and the asynchronous jobs allocate their contexts on the heap"
+#endif
+
 
 // Definition of complementary cryptographic functions
 
-#define RandomBytesFunction     random_bytes    
+#if defined(USE_DRBG)
+    #define RandomBytesFunction random_bytes_drbg    // Buffered per-thread DRBG, seeded by the OS (see random/random.c)
+#else
+    #define RandomBytesFunction random_bytes         // Read from the OS generator on every call
+#endif
+
+// SHA-512 functions from sha512/sha512.h, declared here so that the public headers can be installed on their own. 
+// The context type is guarded by the same macro in both headers
+#ifndef CRYPTO_SHA512_CTX_DEFINED
+#define CRYPTO_SHA512_CTX_DEFINED
+typedef struct {
+    unsigned char state[64];        // Chaining value
+    unsigned char buffer[128];      // Pending input, fewer than 128 bytes
+    unsigned long long bytes;       // Total number of input bytes
+} crypto_sha512_ctx;
+#endif
+int crypto_sha512(const unsigned char *in, unsigned long long inlen, unsigned char *out);
+int crypto_sha512_init(crypto_sha512_ctx *ctx);
+int crypto_sha512_update(crypto_sha512_ctx *ctx, const unsigned char *in, unsigned long long inlen);
+int crypto_sha512_final(crypto_sha512_ctx *ctx, unsigned char *out);
+int crypto_sha512_x4(const unsigned char *in[4], const unsigned long long inlen[4], unsigned char *out[4]);
+int crypto_sha512_update_x4(crypto_sha512_ctx ctx[4], const unsigned char *in[4], const unsigned long long inlen[4]);
+int crypto_sha512_final_x4(crypto_sha512_ctx ctx[4], unsigned char *out[4]);
+
 #define CryptoHashFunction      crypto_sha512        // Use SHA-512 by default
+#define CryptoHashContext       crypto_sha512_ctx    // Incremental hashing, used by streaming and copy-free signature functions
+#define CryptoHashInit          crypto_sha512_init
+#define CryptoHashUpdate        crypto_sha512_update
+#define CryptoHashFinal         crypto_sha512_final
+#define CryptoHashFunction_x4   crypto_sha512_x4     // Multi-buffer hashing of 4 independent messages, used by batch functions
+#define CryptoHashUpdate_x4     crypto_sha512_update_x4
+#define CryptoHashFinal_x4      crypto_sha512_final_x4
 
 
 // Basic parameters for variable-base scalar multiplication (without using endomorphisms)
@@ -158,13 +228,31 @@ extern "C" {
 
 
 // Basic parameters for fixed-base scalar multiplication
-#define W_FIXEDBASE       5                            // Memory requirement: 7.5KB (storage for 80 points).
-#define V_FIXEDBASE       5                  
+// Other table sizes can be selected at build time by defining W_FIXEDBASE and V_FIXEDBASE (see FourQ_tables.h)
+#if !defined(W_FIXEDBASE)
+    #define W_FIXEDBASE   5                            // Memory requirement: 7.5KB (storage for 80 points).
+#endif
+#if !defined(V_FIXEDBASE)
+    #define V_FIXEDBASE   5                  
+#endif
+#if defined(COMPACT_FIXEDBASE_SUPPORT)
+    #define NCOORDS_FIXEDBASE  2                       // Points of the fixed-base tables are stored as (x+y,y-x)
+#else
+    #define NCOORDS_FIXEDBASE  3                       // Points of the fixed-base tables are stored as (x+y,y-x,2dt)
+#endif
 
 
 // Basic parameters for double scalar multiplication
-#define WP_DOUBLEBASE     8                            // Memory requirement: 24KB (storage for 256 points).
+// Other table sizes for the generator can be selected at build time by defining WP_DOUBLEBASE (see FourQ_tables.h)
+#if !defined(WP_DOUBLEBASE)
+    #define WP_DOUBLEBASE 8                            // Memory requirement: 24KB (storage for 256 points).
+#endif
 #define WQ_DOUBLEBASE     4  
+#define WQ_DOUBLEBASE_PREPARED  6                      // Window for prepared public keys. Memory requirement: 8KB per key (storage for 64 points).
+
+
+// Basic parameters for multi-scalar multiplication
+#define NPOINTS_MULTI_PIPPENGER  16                    // Minimum number of points for which ecc_mul_multi() switches from Straus' method to Pippenger's method
    
 
 // FourQ's basic element definitions and point representations
@@ -176,6 +264,77 @@ typedef struct { f2elm_t x; f2elm_t y; } point_affine; // Point representation i
 typedef point_affine point_t[1]; 
 
 
+// Prepared SchnorrQ public key, generated by SchnorrQ_PreparePublicKey() and only read during verification
+
+typedef struct {
+    unsigned char PublicKey[32];                                              // Encoded public key
+    point_t A;                                                                // Decoded public key
+    f2elm_t Table[4*(1 << (WQ_DOUBLEBASE_PREPARED-2))][4];                   // Precomputed points (X+Y,Y-X,2Z,2dT) for A, Phi(A), Psi(A) and Phi(Psi(A))
+} SchnorrQ_PreparedPublicKey;
+
+
+// Prepared ECDH public key, generated by PrepareECDHPublicKey() and only read during secret agreement
+
+typedef struct {
+    point_t A;                                                                // Decoded public key with the cofactor cleared
+    f2elm_t Table[V_FIXEDBASE*(1 << (W_FIXEDBASE-1))][NCOORDS_FIXEDBASE];     // Comb table of A with the layout of the fixed-base table of the generator
+} ECDH_PreparedPublicKey;
+
+
+// Expanded SchnorrQ secret key, generated by SchnorrQ_ExpandSecretKey() and erased by SchnorrQ_DestroyExpandedSecretKey()
+
+typedef struct {
+    digit_t s[NWORDS_ORDER];                                                  // Secret scalar in Montgomery representation
+    unsigned char NoncePrefix[32];                                            // Upper 32 bytes of the hash of the secret key
+    unsigned char PublicKey[32];                                              // Encoded public key
+} SchnorrQ_ExpandedSecretKey;
+
+
+// Context for streaming SchnorrQ signature verification (see SchnorrQ_VerifyInit)
+
+typedef struct {
+    CryptoHashContext HashState;                                              // State of the hash H(R||PublicKey||Message)
+    unsigned char PublicKey[32];                                              // Encoded public key
+    unsigned char Signature[64];                                              // Signature (R,s)
+} SchnorrQ_VerifyContext;
+
+
+// Operation counts, read with FourQ_get_opcounts() in builds with operation counting.
+// Every field counts calls to the function of the same name, including calls made by other counted functions (e.g., fp2inv1271() calls fpinv1271())
+
+typedef struct {
+    uint64_t fpmul;                                                           // fpmul1271()
+    uint64_t fpsqr;                                                           // fpsqr1271()
+    uint64_t fpinv;                                                           // fpinv1271()
+    uint64_t fp2mul;                                                          // fp2mul1271()
+    uint64_t fp2sqr;                                                          // fp2sqr1271()
+    uint64_t fp2add;                                                          // fp2add1271()
+    uint64_t fp2inv;                                                          // fp2inv1271()
+    uint64_t eccdouble;                                                       // eccdouble()
+    uint64_t eccadd;                                                          // eccadd()
+    uint64_t eccmadd;                                                         // eccmadd()
+    uint64_t table_lookup_1x8;                                                // table_lookup_1x8()
+    uint64_t table_lookup_fixed_base;                                         // table_lookup_fixed_base()
+} FourQ_OpCounts;
+
+
+// Thread pool used by the multithreaded batch functions, created by fourq_pool_create() and released by fourq_pool_destroy()
+
+typedef struct fourq_pool fourq_pool;
+
+
+// Backends for the low-level field arithmetic, table lookups and batch operations.
+// Builds with runtime dispatch include all of them and select the fastest one supported by the CPU at load time, other builds include a single backend
+
+typedef enum {
+    FOURQ_BACKEND_GENERIC,                     // 0x00, C implementation
+    FOURQ_BACKEND_X64,                         // 0x01, x64 assembly
+    FOURQ_BACKEND_AVX2,                        // 0x02, x64 assembly using MULX (BMI2), AVX2 table lookups and 4-way scalar multiplication
+    FOURQ_BACKEND_AVX512IFMA,                  // 0x03, AVX2 backend plus 8-way scalar multiplication using AVX-512 IFMA
+    FOURQ_BACKEND_END_OF_LIST
+} FourQ_BACKEND;
+
+
 // Definitions of the error-handling type and error codes
 
 typedef enum {
@@ -209,6 +368,33 @@ typedef enum {
 #define ECCRYPTO_MSG_ERROR_HASH_TO_CURVE                    "ECCRYPTO_ERROR_HASH_TO_CURVE"
 
 
+// Asynchronous jobs, submitted with fourq_async_submit(). The caller owns the job and the buffers it points to until the job is completed
+
+typedef enum {
+    FOURQ_JOB_SIGN,                            // 0x00, SchnorrQ_Sign(SecretKey, PublicKey, Message, SizeMessage) -> Signature
+    FOURQ_JOB_VERIFY,                          // 0x01, SchnorrQ_Verify(PublicKey, Message, SizeMessage, Signature) -> valid
+    FOURQ_JOB_COMPRESSED_AGREEMENT,            // 0x02, CompressedSecretAgreement(SecretKey, PublicKey) -> SharedSecret
+    FOURQ_JOB_AGREEMENT                        // 0x03, SecretAgreement(SecretKey, PublicKey) -> SharedSecret
+} fourq_job_type;
+
+typedef struct fourq_job {
+    fourq_job_type Type;
+    const unsigned char* SecretKey;
+    const unsigned char* PublicKey;
+    const unsigned char* Message;
+    unsigned int SizeMessage;
+    unsigned char* Signature;                                                 // Output of signing jobs, input of verification jobs
+    unsigned char* SharedSecret;                                              // Output of secret agreement jobs
+    unsigned int valid;                                                       // Output of verification jobs
+    ECCRYPTO_STATUS Status;                                                   // Status of the job, set on completion
+    void (*Callback)(struct fourq_job* Job);                                  // Called by a worker thread on completion. If NULL, the job is returned by fourq_async_poll()
+    void* UserData;                                                           // Not used by the library
+    struct fourq_job* next;                                                   // Used internally by the job queues
+} fourq_job;
+
+typedef struct fourq_async fourq_async;
+
+
 #ifdef __cplusplus
 }
 #endif
@@ -24,6 +24,29 @@ extern "C" {
 #include "FourQ.h"
 
 
+/**************** Maximum stack usage ****************/
+
+// Upper bounds in bytes of the stack used by the API functions, including the functions they call, for x64 builds with GCC and the options of the makefile.
+// They are the largest worst-case usage reported by "make stack_usage" over the x64 configurations, plus 1KB for assembly and C library functions.
+// With SMALL_STACK=TRUE, the working sets of the scalar multiplications are thread-local (see README.md). For other builds, run "make stack_usage".
+// Without SMALL_STACK, the stack usage of PrepareECDHPublicKey() grows with W_FIXEDBASE (see FourQ.h): FOURQ_STACK_AGREEMENT covers the FIXEDBASE_PRESETS of the makefile.
+#if defined(SMALL_STACK_SUPPORT)
+    #define FOURQ_STACK_KEYGEN          2560    // SchnorrQ_KeyGeneration(), SchnorrQ_FullKeyGeneration(), SchnorrQ_ExpandSecretKey() and the key generation functions for DH
+    #define FOURQ_STACK_SIGN            3072    // SchnorrQ_Sign(), SchnorrQ_SignExpanded(), SchnorrQph_Sign() and SchnorrQph_SignDigest()
+    #define FOURQ_STACK_VERIFY          4096    // SchnorrQ_Verify(), the streaming and prepared-key verification functions, SchnorrQph_Verify() and SchnorrQph_VerifyDigest()
+    #define FOURQ_STACK_AGREEMENT       3072    // CompressedSecretAgreement(), SecretAgreement(), PrepareECDHPublicKey() and SecretAgreementPrepared()
+    #define FOURQ_STACK_BATCH          11264    // Batched key generation, secret agreements and signature verification
+    #define FOURQ_STACK_HASH_TO_CURVE   2560    // HashToCurve()
+#else
+    #define FOURQ_STACK_KEYGEN          3584
+    #define FOURQ_STACK_SIGN            4096
+    #define FOURQ_STACK_VERIFY          8192
+    #define FOURQ_STACK_AGREEMENT      (7680 + 1536*((W_FIXEDBASE > 5)? (W_FIXEDBASE-5) : 0))
+    #define FOURQ_STACK_BATCH          43008
+    #define FOURQ_STACK_HASH_TO_CURVE   2560
+#endif
+
+
 /**************** Public ECC API ****************/
 
 // Set generator G = (x,y)
@@ -32,12 +55,62 @@ void eccset(point_t G);
 // Variable-base scalar multiplication Q = k*P
 bool ecc_mul(point_t P, digit_t* k, point_t Q, bool clear_cofactor);
 
+// 4-way variable-base scalar multiplication Q_i = k_i*P_i, i = 0,...,3, where the scalars k_i are stored consecutively in k
+bool ecc_mul_x4(point_t* P, digit_t* k, point_t* Q, bool clear_cofactor);
+
+// 8-way variable-base scalar multiplication Q_i = k_i*P_i, i = 0,...,7, where the scalars k_i are stored consecutively in k
+bool ecc_mul_x8(point_t* P, digit_t* k, point_t* Q, bool clear_cofactor);
+
+// Variable-base scalar multiplication Q_i = k*P_i, i = 0,...,npoints-1, with a single scalar k that is decomposed and recoded once.
+// The results are normalized in groups using a single inversion per group
+bool ecc_mul_shared(point_t* P, digit_t* k, point_t* Q, unsigned int npoints, bool clear_cofactor);
+
 // Fixed-base scalar multiplication Q = k*G, where G is the generator
 bool ecc_mul_fixed(digit_t* k, point_t Q);
 
+// Fixed-base scalar multiplication Q_i = k_i*G, i = 0,...,npoints-1, where the scalars k_i are stored consecutively in k. 
+// The results are normalized in groups using a single inversion per group
+bool ecc_mul_fixed_batch(digit_t* k, point_t* Q, unsigned int npoints);
+
 // Double scalar multiplication R = k*G + l*Q, where G is the generator
 bool ecc_mul_double(digit_t* k, point_t Q, digit_t* l, point_t R);
 
+#if !defined(FOURQ_NO_MALLOC)
+// Multi-scalar multiplication Q = k_0*P_0 + ... + k_(npoints-1)*P_(npoints-1), where the scalars k_i are stored consecutively in k
+// The working sets are allocated on the heap
+bool ecc_mul_multi(point_t* P, digit_t* k, unsigned int npoints, point_t Q);
+#endif
+
+// Multi-scalar multiplication Q = k_0*P_0 + ... + k_(npoints-1)*P_(npoints-1) using a caller-provided Workspace of SizeWorkspace bytes, at any address.
+// It returns false if SizeWorkspace is smaller than ecc_mul_multi_workspace_size(npoints), which is enough for any number of points up to npoints
+size_t ecc_mul_multi_workspace_size(unsigned int npoints);
+bool ecc_mul_multi_workspace(point_t* P, digit_t* k, unsigned int npoints, point_t Q, void* Workspace, size_t SizeWorkspace);
+
+
+/**************** Public API for backend selection ****************/
+
+// Get the backend in use
+FourQ_BACKEND FourQ_get_backend(void);
+
+// Select the backend. Only available in builds with runtime dispatch, where the backend is set at load time to the fastest one supported by the CPU.
+// It returns ECCRYPTO_ERROR_INVALID_PARAMETER if the backend is not supported by the CPU or the build. 
+// This function is not thread-safe and should not be called while other library functions are running.
+ECCRYPTO_STATUS FourQ_set_backend(FourQ_BACKEND Backend);
+
+// Get the name of a backend
+const char* FourQ_get_backend_name(FourQ_BACKEND Backend);
+
+
+/**************** Public API for operation counting ****************/
+
+// Get the operations counted in the calling thread since the last call to FourQ_reset_opcounts().
+// Only available in builds with OPCOUNT=TRUE, otherwise it returns ECCRYPTO_ERROR_NOT_IMPLEMENTED. 
+// Operations performed by the vectorized batch functions (ecc_mul_x4(), ecc_mul_x8()) and by pool or async worker threads are not counted.
+ECCRYPTO_STATUS FourQ_get_opcounts(FourQ_OpCounts* Counts);
+
+// Reset the operation counts of the calling thread
+void FourQ_reset_opcounts(void);
+
 
 /************* Public API for arithmetic functions modulo the curve order **************/
 
@@ -78,18 +151,91 @@ ECCRYPTO_STATUS SchnorrQ_KeyGeneration(const unsigned char* SecretKey, unsigned
 // Outputs: 32-byte SecretKey and 32-byte PublicKey
 ECCRYPTO_STATUS SchnorrQ_FullKeyGeneration(unsigned char* SecretKey, unsigned char* PublicKey);
 
+// Batched SchnorrQ keypair generation
+// It produces NumKeys keypairs as in SchnorrQ_FullKeyGeneration(). Public keys are computed in groups that share a single inversion.
+// Outputs: NumKeys 32-byte secret keys and 32-byte public keys
+ECCRYPTO_STATUS SchnorrQ_FullKeyGenerationBatch(unsigned char** SecretKeys, unsigned char** PublicKeys, const unsigned int NumKeys);
+
 // SchnorrQ signature generation
 // It produces the signature Signature of a message Message of size SizeMessage in bytes
 // Inputs: 32-byte SecretKey, 32-byte PublicKey, and Message of size SizeMessage in bytes
 // Output: 64-byte Signature 
 ECCRYPTO_STATUS SchnorrQ_Sign(const unsigned char* SecretKey, const unsigned char* PublicKey, const unsigned char* Message, const unsigned int SizeMessage, unsigned char* Signature);
 
+// SchnorrQ secret key expansion
+// It hashes SecretKey once and stores the secret scalar in Montgomery representation, the nonce prefix and the encoded public key in ExpandedKey
+// Input:  32-byte SecretKey
+// Output: ExpandedKey, to be used with SchnorrQ_SignExpanded() and erased with SchnorrQ_DestroyExpandedSecretKey()
+ECCRYPTO_STATUS SchnorrQ_ExpandSecretKey(const unsigned char* SecretKey, SchnorrQ_ExpandedSecretKey* ExpandedKey);
+
+// SchnorrQ signature generation using an expanded secret key
+// It produces the signature Signature of a message Message of size SizeMessage in bytes. The message is hashed in place, without being copied
+// Inputs: ExpandedKey generated by SchnorrQ_ExpandSecretKey(), and Message of size SizeMessage in bytes
+// Output: 64-byte Signature 
+ECCRYPTO_STATUS SchnorrQ_SignExpanded(const SchnorrQ_ExpandedSecretKey* ExpandedKey, const unsigned char* Message, const unsigned long long SizeMessage, unsigned char* Signature);
+
+// Erasure of an expanded secret key
+// Input: ExpandedKey generated by SchnorrQ_ExpandSecretKey(), which is zeroized
+void SchnorrQ_DestroyExpandedSecretKey(SchnorrQ_ExpandedSecretKey* ExpandedKey);
+
 // SchnorrQ signature verification
 // It verifies the signature Signature of a message Message of size SizeMessage in bytes
 // Inputs: 32-byte PublicKey, 64-byte Signature, and Message of size SizeMessage in bytes
 // Output: true (valid signature) or false (invalid signature)
 ECCRYPTO_STATUS SchnorrQ_Verify(const unsigned char* PublicKey, const unsigned char* Message, const unsigned int SizeMessage, const unsigned char* Signature, unsigned int* valid);
 
+// Streaming SchnorrQ signature verification
+// SchnorrQ_VerifyInit() followed by any number of calls to SchnorrQ_VerifyUpdate() with consecutive chunks of the message, followed by 
+// SchnorrQ_VerifyFinal(), verifies the signature Signature of the concatenated message under PublicKey
+// Inputs: 32-byte PublicKey, 64-byte Signature, and message chunks Message of size SizeMessage in bytes
+// Output: true (valid signature) or false (invalid signature)
+ECCRYPTO_STATUS SchnorrQ_VerifyInit(SchnorrQ_VerifyContext* ctx, const unsigned char* PublicKey, const unsigned char* Signature);
+ECCRYPTO_STATUS SchnorrQ_VerifyUpdate(SchnorrQ_VerifyContext* ctx, const unsigned char* Message, const unsigned long long SizeMessage);
+ECCRYPTO_STATUS SchnorrQ_VerifyFinal(SchnorrQ_VerifyContext* ctx, unsigned int* valid);
+
+// SchnorrQph: pre-hashed variant of SchnorrQ
+// Signatures are computed over Digest = CryptoHashFunction(Message) with a domain separator prepended to every internal hash, so that 
+// the message is read once and SchnorrQph signatures are never valid SchnorrQ signatures (and vice versa).
+// SchnorrQph_SignDigest() and SchnorrQph_VerifyDigest() take the 64-byte Digest, which can be computed incrementally with CryptoHashInit(), 
+// CryptoHashUpdate() and CryptoHashFinal(). SchnorrQph_Sign() and SchnorrQph_Verify() take the message itself.
+// Keys are the same as in SchnorrQ. Signatures are 64 bytes long.
+ECCRYPTO_STATUS SchnorrQph_Sign(const unsigned char* SecretKey, const unsigned char* PublicKey, const unsigned char* Message, const unsigned long long SizeMessage, unsigned char* Signature);
+ECCRYPTO_STATUS SchnorrQph_SignDigest(const SchnorrQ_ExpandedSecretKey* ExpandedKey, const unsigned char* Digest, unsigned char* Signature);
+ECCRYPTO_STATUS SchnorrQph_Verify(const unsigned char* PublicKey, const unsigned char* Message, const unsigned long long SizeMessage, const unsigned char* Signature, unsigned int* valid);
+ECCRYPTO_STATUS SchnorrQph_VerifyDigest(const unsigned char* PublicKey, const unsigned char* Digest, const unsigned char* Signature, unsigned int* valid);
+
+// SchnorrQ public key preparation
+// It decodes and validates the public key PublicKey and precomputes the tables used by SchnorrQ_VerifyPrepared()
+// Input:  32-byte PublicKey
+// Output: PreparedKey, which can be shared by concurrent calls to SchnorrQ_VerifyPrepared()
+ECCRYPTO_STATUS SchnorrQ_PreparePublicKey(const unsigned char* PublicKey, SchnorrQ_PreparedPublicKey* PreparedKey);
+
+// SchnorrQ signature verification using a prepared public key
+// It verifies the signature Signature of a message Message of size SizeMessage in bytes
+// Inputs: PreparedKey generated by SchnorrQ_PreparePublicKey(), 64-byte Signature, and Message of size SizeMessage in bytes
+// Output: true (valid signature) or false (invalid signature)
+ECCRYPTO_STATUS SchnorrQ_VerifyPrepared(const SchnorrQ_PreparedPublicKey* PreparedKey, const unsigned char* Message, const unsigned int SizeMessage, const unsigned char* Signature, unsigned int* valid);
+
+// SchnorrQ batch signature verification
+// It verifies the NumSignatures signatures Signatures[i] of messages Messages[i] of size SizeMessages[i] in bytes under public keys PublicKeys[i]
+// using a single randomized multi-scalar check. If the batch check fails, every signature is verified individually to locate the invalid ones.
+// Inputs: NumSignatures 32-byte PublicKeys, 64-byte Signatures, and Messages of size SizeMessages in bytes
+// Output: valid[i] = true (valid signature) or false (invalid signature), for i in [0, NumSignatures-1]
+// valid[i] is true only if SchnorrQ_Verify() accepts the i-th signature. Public keys and values R with a non-canonical encoding or with a component of 
+// small order (outside the prime-order subgroup) do not enter the batch check and are verified with SchnorrQ_Verify(). Signatures that SchnorrQ_Verify() 
+// rejects with an error (e.g., a malformed encoding) are marked invalid. The subgroup check of each public key and value R (a variable-base scalar 
+// multiplication without endomorphisms) costs more than the savings of the batch check, so a batch is slower than verifying each signature.
+// The working sets are allocated on the heap, see SchnorrQ_VerifyBatchWorkspace() for a version without allocation
+#if !defined(FOURQ_NO_MALLOC)
+ECCRYPTO_STATUS SchnorrQ_VerifyBatch(const unsigned char** PublicKeys, const unsigned char** Messages, const unsigned int* SizeMessages, const unsigned char** Signatures, const unsigned int NumSignatures, unsigned int* valid);
+#endif
+
+// SchnorrQ batch signature verification using a caller-provided workspace
+// It computes the same outputs as SchnorrQ_VerifyBatch(), with the working sets stored in Workspace, which has SizeWorkspace bytes and can be at any address.
+// It returns ECCRYPTO_ERROR_INVALID_PARAMETER if SizeWorkspace is smaller than SchnorrQ_VerifyBatchWorkspaceSize(NumSignatures)
+size_t SchnorrQ_VerifyBatchWorkspaceSize(const unsigned int NumSignatures);
+ECCRYPTO_STATUS SchnorrQ_VerifyBatchWorkspace(const unsigned char** PublicKeys, const unsigned char** Messages, const unsigned int* SizeMessages, const unsigned char** Signatures, const unsigned int NumSignatures, unsigned int* valid, void* Workspace, const size_t SizeWorkspace);
+
 
 /**************** Public API for co-factor ECDH key exchange with compressed, 32-byte public keys ****************/
 
@@ -104,12 +250,43 @@ ECCRYPTO_STATUS CompressedPublicKeyGeneration(const unsigned char* SecretKey, un
 // Outputs: 32-byte SecretKey and 32-byte PublicKey 
 ECCRYPTO_STATUS CompressedKeyGeneration(unsigned char* SecretKey, unsigned char* PublicKey);
 
+// Batched keypair generation for key exchange. Public keys are compressed to 32 bytes
+// It produces NumKeys keypairs as in CompressedKeyGeneration(). Public keys are computed in groups that share a single inversion.
+// Outputs: NumKeys 32-byte secret keys and 32-byte public keys
+ECCRYPTO_STATUS CompressedKeyGenerationBatch(unsigned char** SecretKeys, unsigned char** PublicKeys, const unsigned int NumKeys);
+
 // Secret agreement computation for key exchange using a compressed, 32-byte public key
 // The output is the y-coordinate of SecretKey*A, where A is the decoding of the public key PublicKey. 
 // Inputs: 32-byte SecretKey and 32-byte PublicKey
 // Output: 32-byte SharedSecret
 ECCRYPTO_STATUS CompressedSecretAgreement(const unsigned char* SecretKey, const unsigned char* PublicKey, unsigned char* SharedSecret);
 
+// Batched secret agreement computation for key exchange using compressed, 32-byte public keys
+// SharedSecrets[i] is the output of CompressedSecretAgreement(SecretKeys[i], PublicKeys[i]) and Statuses[i] its status. Agreements are computed four (or eight, with AVX-512 IFMA) at a time.
+// Inputs: NumAgreements 32-byte secret keys and 32-byte public keys
+// Outputs: NumAgreements 32-byte shared secrets and statuses. Returns ECCRYPTO_SUCCESS if all agreements succeed, or the first error otherwise
+ECCRYPTO_STATUS CompressedSecretAgreementBatch(const unsigned char** SecretKeys, const unsigned char** PublicKeys, unsigned char** SharedSecrets, const unsigned int NumAgreements, ECCRYPTO_STATUS* Statuses);
+
+// Secret agreement computation for key exchange with a single secret key and many compressed, 32-byte public keys
+// SharedSecrets[i] is the output of CompressedSecretAgreement(SecretKey, PublicKeys[i]) and Statuses[i] its status. The secret key is decomposed and recoded 
+// once, and the scalar multiplications run four (or eight, with AVX-512 IFMA) at a time with one inversion per group of results.
+// Inputs: 32-byte SecretKey and NumAgreements 32-byte public keys
+// Outputs: NumAgreements 32-byte shared secrets and statuses. Returns ECCRYPTO_SUCCESS if all agreements succeed, or the first error otherwise
+ECCRYPTO_STATUS CompressedSecretAgreementMany(const unsigned char* SecretKey, const unsigned char** PublicKeys, unsigned char** SharedSecrets, const unsigned int NumAgreements, ECCRYPTO_STATUS* Statuses);
+
+
+// Compressed public key preparation for key exchange
+// It decodes and validates the public key PublicKey, clears the cofactor and precomputes the comb table used by SecretAgreementPrepared().
+// Input:  32-byte PublicKey
+// Output: PreparedKey, which can be shared by concurrent calls to SecretAgreementPrepared()
+ECCRYPTO_STATUS PrepareECDHPublicKey(const unsigned char* PublicKey, ECDH_PreparedPublicKey* PreparedKey);
+
+// Secret agreement computation for key exchange using a prepared public key
+// The output is the same as the output of CompressedSecretAgreement() for the public key given to PrepareECDHPublicKey(), computed at the speed
+// of fixed-base scalar multiplication. It runs in constant time with respect to SecretKey.
+// Inputs: 32-byte SecretKey and PreparedKey generated by PrepareECDHPublicKey()
+// Output: 32-byte SharedSecret
+ECCRYPTO_STATUS SecretAgreementPrepared(const unsigned char* SecretKey, const ECDH_PreparedPublicKey* PreparedKey, unsigned char* SharedSecret);
 
 /**************** Public API for co-factor ECDH key exchange with uncompressed, 64-byte public keys ****************/
 
@@ -124,12 +301,87 @@ ECCRYPTO_STATUS PublicKeyGeneration(const unsigned char* SecretKey, unsigned cha
 // Outputs: 32-byte SecretKey and 64-byte PublicKey 
 ECCRYPTO_STATUS KeyGeneration(unsigned char* SecretKey, unsigned char* PublicKey);
 
+// Batched keypair generation for key exchange
+// It produces NumKeys keypairs as in KeyGeneration(). Public keys are computed in groups that share a single inversion.
+// Outputs: NumKeys 32-byte secret keys and 64-byte public keys
+ECCRYPTO_STATUS KeyGenerationBatch(unsigned char** SecretKeys, unsigned char** PublicKeys, const unsigned int NumKeys);
+
 // Secret agreement computation for key exchange
 // The output is the y-coordinate of SecretKey*PublicKey. 
 // Inputs: 32-byte SecretKey and 64-byte PublicKey
 // Output: 32-byte SharedSecret
 ECCRYPTO_STATUS SecretAgreement(const unsigned char* SecretKey, const unsigned char* PublicKey, unsigned char* SharedSecret);
 
+// Batched secret agreement computation for key exchange
+// SharedSecrets[i] is the output of SecretAgreement(SecretKeys[i], PublicKeys[i]) and Statuses[i] its status. Agreements are computed four (or eight, with AVX-512 IFMA) at a time.
+// Inputs: NumAgreements 32-byte secret keys and 64-byte public keys
+// Outputs: NumAgreements 32-byte shared secrets and statuses. Returns ECCRYPTO_SUCCESS if all agreements succeed, or the first error otherwise
+ECCRYPTO_STATUS SecretAgreementBatch(const unsigned char** SecretKeys, const unsigned char** PublicKeys, unsigned char** SharedSecrets, const unsigned int NumAgreements, ECCRYPTO_STATUS* Statuses);
+
+// Secret agreement computation for key exchange with a single secret key and many uncompressed, 64-byte public keys
+// SharedSecrets[i] is the output of SecretAgreement(SecretKey, PublicKeys[i]) and Statuses[i] its status. The secret key is decomposed and recoded once, 
+// and the scalar multiplications run four (or eight, with AVX-512 IFMA) at a time with one inversion per group of results.
+// Inputs: 32-byte SecretKey and NumAgreements 64-byte public keys
+// Outputs: NumAgreements 32-byte shared secrets and statuses. Returns ECCRYPTO_SUCCESS if all agreements succeed, or the first error otherwise
+ECCRYPTO_STATUS SecretAgreementMany(const unsigned char* SecretKey, const unsigned char** PublicKeys, unsigned char** SharedSecrets, const unsigned int NumAgreements, ECCRYPTO_STATUS* Statuses);
+
+
+#if defined(THREADS_SUPPORT)
+
+/**************** Public API for multithreaded batch functions ****************/
+
+// Thread pool creation
+// It starts NumThreads worker threads, or one thread per online CPU except one if NumThreads = 0. The calling thread also processes work during batch calls.
+// A pool can be shared by concurrent batch calls from different threads
+// Output: Pool, to be released with fourq_pool_destroy()
+ECCRYPTO_STATUS fourq_pool_create(const unsigned int NumThreads, fourq_pool** Pool);
+
+// Thread pool release
+// It stops the worker threads and releases Pool. There must be no batch call running on the pool
+void fourq_pool_destroy(fourq_pool* Pool);
+
+// Number of worker threads of a pool
+unsigned int fourq_pool_num_threads(const fourq_pool* Pool);
+
+// Multithreaded batch functions
+// They compute the same outputs as the corresponding single and batch functions, with the items distributed over the threads of Pool by work stealing.
+// If Pool is NULL, all the items are processed by the calling thread. Statuses[i] is the status of the i-th item.
+// Returns ECCRYPTO_SUCCESS if all the items succeed, or the first error otherwise
+ECCRYPTO_STATUS SchnorrQ_SignParallel(fourq_pool* Pool, const unsigned char** SecretKeys, const unsigned char** PublicKeys, const unsigned char** Messages, const unsigned int* SizeMessages, unsigned char** Signatures, const unsigned int NumSignatures, ECCRYPTO_STATUS* Statuses);
+ECCRYPTO_STATUS SchnorrQ_VerifyParallel(fourq_pool* Pool, const unsigned char** PublicKeys, const unsigned char** Messages, const unsigned int* SizeMessages, const unsigned char** Signatures, const unsigned int NumSignatures, unsigned int* valid, ECCRYPTO_STATUS* Statuses);
+ECCRYPTO_STATUS CompressedKeyGenerationParallel(fourq_pool* Pool, unsigned char** SecretKeys, unsigned char** PublicKeys, const unsigned int NumKeys, ECCRYPTO_STATUS* Statuses);
+ECCRYPTO_STATUS KeyGenerationParallel(fourq_pool* Pool, unsigned char** SecretKeys, unsigned char** PublicKeys, const unsigned int NumKeys, ECCRYPTO_STATUS* Statuses);
+ECCRYPTO_STATUS CompressedSecretAgreementParallel(fourq_pool* Pool, const unsigned char** SecretKeys, const unsigned char** PublicKeys, unsigned char** SharedSecrets, const unsigned int NumAgreements, ECCRYPTO_STATUS* Statuses);
+ECCRYPTO_STATUS SecretAgreementParallel(fourq_pool* Pool, const unsigned char** SecretKeys, const unsigned char** PublicKeys, unsigned char** SharedSecrets, const unsigned int NumAgreements, ECCRYPTO_STATUS* Statuses);
+
+
+/**************** Public API for asynchronous jobs ****************/
+
+// Asynchronous job context creation
+// It starts NumThreads worker threads, or one thread per online CPU if NumThreads = 0. Each worker takes all the jobs queued to it at once,
+// and computes the secret agreements of a batch with the batched agreement functions
+// Output: Async, to be released with fourq_async_destroy()
+ECCRYPTO_STATUS fourq_async_create(const unsigned int NumThreads, fourq_async** Async);
+
+// Asynchronous job context release
+// It waits for the submitted jobs to be completed, then stops the worker threads and releases Async. No job can be submitted concurrently
+void fourq_async_destroy(fourq_async* Async);
+
+// Job submission
+// It queues NumJobs jobs without blocking, and can be called concurrently by any number of threads. A completed job is passed to its callback,  
+// which runs on a worker thread, or, if the callback is NULL, it is added to the completion queue and the eventfd of the context is signaled
+ECCRYPTO_STATUS fourq_async_submit(fourq_async* Async, fourq_job** Jobs, const unsigned int NumJobs);
+
+// Eventfd of the context, which becomes readable when jobs are added to the completion queue (e.g., to be watched with epoll)
+int fourq_async_fd(const fourq_async* Async);
+
+// Completion queue
+// It returns up to MaxJobs completed jobs in Jobs and resets the eventfd, which is signaled again if more completed jobs remain.
+// It must be called by a single thread at a time
+unsigned int fourq_async_poll(fourq_async* Async, fourq_job** Jobs, const unsigned int MaxJobs);
+
+#endif
+
 
 /**************** Public API for hashing to curve, 64-byte public keys ****************/
 
@@ -42,10 +42,49 @@ extern "C" {
 #endif
 
 
+// Function attributes enabling instruction set extensions for the vectorized functions in builds with runtime dispatch
+
+#if defined(DISPATCH_SUPPORT)
+    #define TARGET_AVX2          __attribute__((target("avx2,bmi2")))
+    #define TARGET_AVX512IFMA    __attribute__((target("avx2,bmi2,avx512f,avx512ifma")))
+#else
+    #define TARGET_AVX2
+    #define TARGET_AVX512IFMA
+#endif
+
+
 // Define if zeroing of temporaries in low-level functions is required
 //#define TEMP_ZEROING
 
 
+#if (COMPILER == COMPILER_VC)
+    #define THREAD_LOCAL    __declspec(thread)
+#else
+    #define THREAD_LOCAL    __thread
+#endif
+
+
+// Bounded-stack mode. WORKING_SET(type, ws) declares a pointer "ws" to the working set of a function (its tables and recoded scalars). 
+// The working set is a local variable, or a static thread-local variable with SMALL_STACK_SUPPORT, so that the stack frame stays small.
+// Working sets are not reentrant within a thread (the library functions never call back into user code while they are in use)
+
+#if defined(SMALL_STACK_SUPPORT)
+    #define WORKING_SET(type, ws)   static THREAD_LOCAL type ws##_storage; type* ws = &ws##_storage
+#else
+    #define WORKING_SET(type, ws)   type ws##_storage; type* ws = &ws##_storage
+#endif
+
+
+// Operation counting. Counters are kept per thread, so that calls made by other threads are not included
+
+#if defined(OPCOUNT_SUPPORT)
+    extern THREAD_LOCAL FourQ_OpCounts opcounts;
+    #define OPCOUNT(op)         (opcounts.op++)
+#else
+    #define OPCOUNT(op)
+#endif
+
+
 // Basic parameters for variable-base scalar multiplication (without using endomorphisms)
 #define NPOINTS_VARBASE       (1 << (W_VARBASE-2)) 
 #define t_VARBASE             ((NBITS_ORDER_PLUS_ONE+W_VARBASE-2)/(W_VARBASE-1))
@@ -57,14 +96,33 @@ extern "C" {
 #define L_FIXEDBASE       D_FIXEDBASE*W_FIXEDBASE  
 #define NPOINTS_FIXEDBASE V_FIXEDBASE*(1 << (W_FIXEDBASE-1))  
 #define VPOINTS_FIXEDBASE (1 << (W_FIXEDBASE-1)) 
+#define NPOINTS_FIXEDBASE_BATCH  16              // Number of results normalized with a single inversion by ecc_mul_fixed_batch()
 #if (NBITS_ORDER_PLUS_ONE-L_FIXEDBASE == 0)  // This parameter selection is not supported  
     #error -- "Unsupported parameter selection for fixed-base scalar multiplication"
 #endif 
 
 
+// Basic parameters for batched variable-base scalar multiplication
+#if defined(AVX512IFMA_SUPPORT) || defined(DISPATCH_SUPPORT)
+    #define NLANES_BATCH    8             // Number of agreements computed in parallel by the batched functions
+    #define ecc_mul_batch   ecc_mul_x8
+    #define ecc_mul_batch_recoded   ecc_mul_x8_recoded
+#else
+    #define NLANES_BATCH    4
+    #define ecc_mul_batch   ecc_mul_x4
+    #define ecc_mul_batch_recoded   ecc_mul_x4_recoded
+#endif
+#define NPOINTS_SHARED_BATCH  16          // Number of results normalized with a single inversion by ecc_mul_shared(), a multiple of NLANES_BATCH
+
+
 // Basic parameters for double scalar multiplication
 #define NPOINTS_DOUBLEMUL_WP   (1 << (WP_DOUBLEBASE-2)) 
-#define NPOINTS_DOUBLEMUL_WQ   (1 << (WQ_DOUBLEBASE-2)) 
+#define NPOINTS_DOUBLEMUL_WQ   (1 << (WQ_DOUBLEBASE-2))
+#define NPOINTS_DOUBLEMUL_WQ_PREPARED  (1 << (WQ_DOUBLEBASE_PREPARED-2))
+#if (WP_DOUBLEBASE < 2) || (WP_DOUBLEBASE > 12)     // Larger windows would require tables of 768KB or more
+    #error -- "Unsupported parameter selection for double scalar multiplication"
+#endif 
+#define SCHNORRQPH_DOM_BYTES   27                      // Length of the domain separator of SchnorrQph 
    
 
 // FourQ's point representations        
@@ -75,6 +133,14 @@ typedef struct { f2elm_t xy; f2elm_t yx; f2elm_t z2; f2elm_t t2; } point_extproj
 typedef point_extproj_precomp point_extproj_precomp_t[1];  
 typedef struct { f2elm_t xy; f2elm_t yx; f2elm_t t2; } point_precomp;                       // Point representation in extended affine coordinates (for precomputed points).
 typedef point_precomp point_precomp_t[1];
+typedef struct { f2elm_t xy; f2elm_t yx; } point_compact;                                    // Point representation (x+y,y-x) in the compact fixed-base table.
+typedef point_compact point_compact_t[1];
+
+#if defined(COMPACT_FIXEDBASE_SUPPORT)
+    typedef point_compact_t point_fixedbase_t;                                              // Points of FIXED_BASE_TABLE
+#else
+    typedef point_precomp_t point_fixedbase_t;
+#endif
 
 
 /********************** Constant-time unsigned comparisons ***********************/
@@ -306,11 +372,49 @@ void fp2sqr1271_a(f2elm_t a, f2elm_t c);
 // Quadratic extension field inversion, af = a^-1 = a^(p-2) in GF((2^127-1)^2)
 void fp2inv1271(f2elm_t a);
 
+/************ Runtime dispatch *************/
+
+#if defined(DISPATCH_SUPPORT)
+
+// Backend variants of the quadratic extension field functions: C, x64 assembly (fp2_1271.S) and x64 assembly with AVX2 (fp2_1271_AVX2.S)
+void fp2addsub1271_c(f2elm_t a, f2elm_t b, f2elm_t c);
+void fp2addsub1271_a_x64(f2elm_t a, f2elm_t b, f2elm_t c);
+void fp2addsub1271_a_avx2(f2elm_t a, f2elm_t b, f2elm_t c);
+void fp2mul1271_c(f2elm_t a, f2elm_t b, f2elm_t c);
+void fp2mul1271_a_x64(f2elm_t a, f2elm_t b, f2elm_t c);
+void fp2mul1271_a_avx2(f2elm_t a, f2elm_t b, f2elm_t c);
+void fp2sqr1271_c(f2elm_t a, f2elm_t c);
+void fp2sqr1271_a_x64(f2elm_t a, f2elm_t c);
+void fp2sqr1271_a_avx2(f2elm_t a, f2elm_t c);
+
+// Backend variants of the table lookup functions: C and AVX2
+void table_lookup_1x8_c(point_extproj_precomp_t* table, point_extproj_precomp_t P, unsigned int digit, unsigned int sign_mask);
+void table_lookup_1x8_avx2(point_extproj_precomp_t* table, point_extproj_precomp_t P, unsigned int digit, unsigned int sign_mask);
+void table_lookup_1x8_a_avx2(point_extproj_precomp_t* table, point_extproj_precomp_t P, unsigned int* digit, unsigned int* sign_mask);
+void table_lookup_fixed_base_c(point_fixedbase_t* table, point_precomp_t P, unsigned int digit, unsigned int sign);
+void table_lookup_fixed_base_avx2(point_fixedbase_t* table, point_precomp_t P, unsigned int digit, unsigned int sign);
+
+// Functions of the selected backend, set by FourQ_set_backend()
+typedef struct {
+    void (*fp2addsub1271)(f2elm_t a, f2elm_t b, f2elm_t c);
+    void (*fp2mul1271)(f2elm_t a, f2elm_t b, f2elm_t c);
+    void (*fp2sqr1271)(f2elm_t a, f2elm_t c);
+    void (*table_lookup_1x8)(point_extproj_precomp_t* table, point_extproj_precomp_t P, unsigned int digit, unsigned int sign_mask);
+    void (*table_lookup_fixed_base)(point_fixedbase_t* table, point_precomp_t P, unsigned int digit, unsigned int sign);
+} backend_functions;
+
+extern const backend_functions* selected_backend;
+
+#endif
+
 /************ Curve and recoding functions *************/
 
 // Normalize projective twisted Edwards point Q = (X,Y,Z) -> P = (x,y)
 void eccnorm(point_extproj_t P, point_t Q);
 
+// Normalize npoints projective twisted Edwards points Q_i = (X_i,Y_i,Z_i) -> P_i = (x_i,y_i) using a single inversion
+void eccnorm_batch(point_extproj_t* P, point_t* Q, unsigned int npoints);
+
 // Conversion from representation (X,Y,Z,Ta,Tb) to (X+Y,Y-X,2Z,2dT), where T = Ta*Tb
 void R1_to_R2(point_extproj_t P, point_extproj_precomp_t Q);
 
@@ -353,6 +457,20 @@ void cofactor_clearing(point_extproj_t P);
 // Precomputation function
 void ecc_precomp(point_extproj_t P, point_extproj_precomp_t *T);
 
+// Fixed-base scalar multiplication R = k*G without the final normalization, output in representation (X,Y,Z,Ta,Tb)
+void ecc_mul_fixed_extproj(digit_t* k, point_extproj_t R);
+
+// Fixed-base scalar multiplication R = k*P without the final normalization, using the comb table of P generated by ecc_prepare_fixed()
+void ecc_mul_fixed_table_extproj(point_fixedbase_t* table, digit_t* k, point_extproj_t R);
+bool ecc_mul_fixed_table(point_fixedbase_t* table, digit_t* k, point_t Q);
+
+// Variable-base scalar multiplications R_i = k*R_i with a single scalar k recoded by the caller, without the final normalization
+void ecc_mul_x4_recoded(point_extproj_t* R, unsigned int* digits, unsigned int* sign_masks);
+void ecc_mul_x8_recoded(point_extproj_t* R, unsigned int* digits, unsigned int* sign_masks);
+
+// Generation of the comb table of a point P of order N, with the layout of FIXED_BASE_TABLE
+void ecc_prepare_fixed(point_extproj_t P, point_fixedbase_t* table);
+
 // Constant-time table lookup to extract an extended twisted Edwards point (X+Y:Y-X:2Z:2T) from the precomputed table
 void table_lookup_1x8(point_extproj_precomp_t* table, point_extproj_precomp_t P, unsigned int digit, unsigned int sign_mask);
 void table_lookup_1x8_a(point_extproj_precomp_t* table, point_extproj_precomp_t P, unsigned int* digit, unsigned int* sign_mask);
@@ -364,6 +482,9 @@ void point_setup_ni(point_t P, point_extproj_t Q);
 // Point validation: check if point lies on the curve     
 bool ecc_point_validate(point_extproj_t P);
 
+// Subgroup check: check if point lies in the prime-order subgroup
+bool ecc_point_in_subgroup(point_t P);
+
 // Output error/success message for a given ECCRYPTO_STATUS
 const char* FourQ_get_error_message(ECCRYPTO_STATUS Status);
 
@@ -371,7 +492,7 @@ const char* FourQ_get_error_message(ECCRYPTO_STATUS Status);
 void eccmadd_ni(point_precomp_t Q, point_extproj_t P);
 
 // Constant-time table lookup to extract a point represented as (x+y,y-x,2t)
-void table_lookup_fixed_base(point_precomp_t* table, point_precomp_t P, unsigned int digit, unsigned int sign);
+void table_lookup_fixed_base(point_fixedbase_t* table, point_precomp_t P, unsigned int digit, unsigned int sign);
 
 //  Computes the modified LSB-set representation of scalar
 void mLSB_set_recode(uint64_t* scalar, unsigned int *digits);
@@ -379,9 +500,41 @@ void mLSB_set_recode(uint64_t* scalar, unsigned int *digits);
 // Generation of the precomputation table used internally by the double scalar multiplication function ecc_mul_double()
 void ecc_precomp_double(point_extproj_t P, point_extproj_precomp_t* Table, unsigned int npoints);
 
+// Generation of the precomputed tables of a fixed point Q used by ecc_mul_double_prepared()
+bool ecc_prepare_double(point_t Q, point_extproj_precomp_t* Table);
+
+// Double scalar multiplication R = k*G + l*Q, where G is the generator and Q is a fixed point with tables generated by ecc_prepare_double()
+void ecc_mul_double_prepared(digit_t* k, point_extproj_precomp_t* Table, digit_t* l, point_t R);
+
 // Computes wNAF recoding of a scalar
 void wNAF_recode(uint64_t scalar, unsigned int w, int* digits);
 
+// Caller-provided workspaces are split into buffers that start at multiples of 64 bytes
+#define WORKSPACE_ALIGN(n)  (((n) + 63) & ~(size_t)63)
+
+static __inline unsigned char* workspace_take(unsigned char** workspace, size_t nbytes)
+{ // Take nbytes from a workspace and advance it to the next 64-byte boundary
+    unsigned char* buffer = *workspace;
+
+    *workspace += WORKSPACE_ALIGN(nbytes);
+    return buffer;
+}
+
+// Multi-scalar multiplication R = k*G + l_0*Q_0 + ... + l_(npoints-1)*Q_(npoints-1), where G is the generator. The term k*G is skipped if k = NULL.
+// The working sets are stored in a caller-provided workspace of at least ecc_mul_double_multi_workspace_size(npoints) bytes
+size_t ecc_mul_double_multi_workspace_size(unsigned int npoints);
+bool ecc_mul_double_multi_workspace(digit_t* k, point_t* Q, digit_t* l, unsigned int npoints, point_t R, void* Workspace, size_t SizeWorkspace);
+
+#if !defined(FOURQ_NO_MALLOC)
+// Same as ecc_mul_double_multi_workspace(), with the workspace allocated on the heap
+bool ecc_mul_double_multi(digit_t* k, point_t* Q, digit_t* l, unsigned int npoints, point_t R);
+#endif
+
+#if defined(THREADS_SUPPORT)
+// Run run(arg, begin, end) over consecutive ranges covering [0, NumItems) using the threads of Pool. Range sizes are multiples of Granularity, except for the last one
+void fourq_pool_for(fourq_pool* Pool, const unsigned int NumItems, const unsigned int Granularity, void (*run)(void* arg, unsigned int begin, unsigned int end), void* arg);
+#endif
+
 // Encode point P
 void encode(point_t P, unsigned char* Pencoded);
 
@@ -409,6 +562,10 @@ ECCRYPTO_STATUS decode(const unsigned char* Pencoded, point_t P);
                                           fp2copy1271((Q)->yx, (P)->yx); \
                                           fp2copy1271((Q)->t2, (P)->t2);
 
+// Copy compact point Q = (x+y,y-x) to P
+#define ecccopy_compact(Q, P); fp2copy1271((Q)->xy, (P)->xy); \
+                               fp2copy1271((Q)->yx, (P)->yx);
+
 
 #ifdef __cplusplus
 }
@@ -12,6 +12,24 @@
 #include <stddef.h>
 
 
+// Tables for non-default parameters are included from the tables/ folder, and can be generated with table_gen (see tests/table_gen.c)
+#define TABLE_FILE_NAME(name)           #name
+#define FIXED_BASE_TABLE_FILE_(w, v)    TABLE_FILE_NAME(tables/fixed_base_w##w##_v##v.h)
+#define FIXED_BASE_TABLE_FILE(w, v)     FIXED_BASE_TABLE_FILE_(w, v)
+#define FIXED_BASE_COMPACT_FILE_(w, v)  TABLE_FILE_NAME(tables/fixed_base_w##w##_v##v##_compact.h)
+#define FIXED_BASE_COMPACT_FILE(w, v)   FIXED_BASE_COMPACT_FILE_(w, v)
+#define DOUBLE_SCALAR_TABLE_FILE_(w)    TABLE_FILE_NAME(tables/double_scalar_w##w.h)
+#define DOUBLE_SCALAR_TABLE_FILE(w)     DOUBLE_SCALAR_TABLE_FILE_(w)
+
+
+#if defined(COMPACT_FIXEDBASE_SUPPORT)
+
+// The compact tables store each point (x,y) as (x+y,y-x), and are included from tables/fixed_base_wW_vV_compact.h, 
+// which can be generated with "table_gen fixed W V compact" (see table_lookup_fixed_base())
+#include FIXED_BASE_COMPACT_FILE(W_FIXEDBASE, V_FIXEDBASE)
+
+#elif (W_FIXEDBASE == 5) && (V_FIXEDBASE == 5)
+
 // The table below was generated using window width W = 5 and table parameter V = 5 (see http://eprint.iacr.org/2013/158). 
 // Number of point entries = 5 * 2^4 = 80 points, where each point (x,y) is represented using coordinates (x+y,y-x,2*d*t).
 // Table size = 80 * 3 * 256 = 7.5KB
@@ -98,6 +116,16 @@ static const uint64_t FIXED_BASE_TABLE[960] = {
 , 0x059c84c66f2175d4, 0x1a3bed438790be78, 0xdf394f577dabb5b0, 0x304777e63b3c33e4, 0x59a29d4fe82c5a6a, 0x72e421d1e88e77a4, 0x69e6230313312959, 0x2da03aad8cf2bbb8, 0x2858d8608fecb0b6, 0x343099e7a40243a6, 0xba29b675d29a8f63, 0x3d2028a4f6f15886
 , 0xf068e2d286047d0a, 0x14999b5d6c770e20, 0xd1874a592385da79, 0x78aeb552c15a1cd9, 0x482dcccc23e9c06e, 0x7b18a19fb54b5745, 0x036c896efe9a7a06, 0x2f2c2ce0d1871c13, 0x3b2d9b9ed65492c7, 0x0649c7e50819d077, 0xcdab66ea7b65e3cb, 0x49b15b40c4aaf03f };
 
+#else
+
+// Tables for other values of W_FIXEDBASE and V_FIXEDBASE are included from tables/fixed_base_wW_vV.h, 
+// which can be generated with "table_gen fixed W V"
+#include FIXED_BASE_TABLE_FILE(W_FIXEDBASE, V_FIXEDBASE)
+
+#endif
+
+
+#if (WP_DOUBLEBASE == 8)
 
 // The table below consists of four mini-tables each generated using window width W = 8. 
 // Number of point entries = 4 * 2^6 = 256 points, where each point (x,y) is represented using coordinates (x+y,y-x,2*d*t).
@@ -361,5 +389,12 @@ static const uint64_t DOUBLE_SCALAR_TABLE[3072] = {
 , 0x44d770a210105739, 0x7f1de74a022958a0, 0xfbe4c91bd1e8f732, 0x204fbacb13586460, 0x97d79097d62e3cf8, 0x541ad5591934b114, 0xfdfb47919c141909, 0x354926e5244fdecf, 0x6291b0a0e2e994b0, 0x2b9a9a69d3a6c3d1, 0x8189be54302371e7, 0x3645c65df1a881cd
 , 0xdf0460f445e3877b, 0x7ea384dc52d0d26e, 0x0c2e5f768d46b6b0, 0x1f6e62daa7c5d4e6, 0xf8b026b33b2343ee, 0x2b7183c8767d372c, 0xbd45d1b6b6731517, 0x4ddb3d287c470d60, 0x1031dba40263ece2, 0x4e737fa0d659045f, 0x8cbc98d07d09b455, 0x34a35128a2bcb7f5 };
 
+#else
+
+// Tables for other values of WP_DOUBLEBASE are included from tables/double_scalar_wW.h, which can be generated with "table_gen double W"
+#include DOUBLE_SCALAR_TABLE_FILE(WP_DOUBLEBASE)
+
+#endif
+
 
 #endif
\ No newline at end of file
@@ -0,0 +1,307 @@
+/***********************************************************************************
+* FourQlib: a high-performance crypto library based on the elliptic curve FourQ
+*
+*    Copyright (c) Microsoft Corporation. All rights reserved.
+*
+* Abstract: asynchronous job submission
+*
+* Jobs are pushed to the queue of one of the worker threads with a single atomic
+* exchange (lock-free, multiple producers and a single consumer). A worker takes all
+* the jobs queued so far at once, computes the secret agreements of the batch with
+* the batched agreement functions, and completes every job either by calling its
+* callback or by moving it to the completion queue and signaling an eventfd.
+************************************************************************************/
+
+#include "FourQ_internal.h"
+
+#if defined(THREADS_SUPPORT)
+
+#include <pthread.h>
+#include <semaphore.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/eventfd.h>
+
+
+typedef struct {
+    fourq_job* head;                                     // Last pushed job. Jobs are linked from the newest to the oldest
+    sem_t wakeup;                                        // Posted when a job is pushed to an empty queue
+} async_queue;
+
+typedef struct {
+    fourq_async* async;
+    async_queue queue;
+    pthread_t thread;
+} async_worker;
+
+struct fourq_async {
+    unsigned int nthreads;
+    async_worker* workers;
+    unsigned int next;                                   // Next worker that receives a job
+    int shutdown;
+    async_queue completed;                               // Completed jobs without a callback
+    fourq_job* ready;                                    // Completed jobs taken from the queue, oldest first. Only used by fourq_async_poll()
+    int fd;                                              // Eventfd signaled when a job is added to the completion queue
+};
+
+
+static bool queue_push(async_queue* q, fourq_job* first, fourq_job* last)
+{ // Push the list of jobs first->...->last, linked from the newest to the oldest. It returns true if the queue was empty
+    fourq_job* head = q->head;
+    fourq_job* old;
+
+    do {
+        last->next = head;
+        old = head;
+        head = __sync_val_compare_and_swap(&q->head, old, first);
+    } while (head != old);
+    return (old == NULL);
+}
+
+
+static fourq_job* queue_take_all(async_queue* q)
+{ // Take all the jobs of a queue, oldest first
+    fourq_job *list = __atomic_exchange_n(&q->head, NULL, __ATOMIC_ACQUIRE), *fifo = NULL, *next;
+
+    while (list != NULL) {                               // Reverse the list
+        next = list->next;
+        list->next = fifo;
+        fifo = list;
+        list = next;
+    }
+    return fifo;
+}
+
+
+static void complete(fourq_async* async, fourq_job* job)
+{ // Deliver a completed job through its callback or through the completion queue
+    uint64_t one = 1;
+    ssize_t r;
+
+    if (job->Callback != NULL) {
+        job->Callback(job);
+        return;
+    }
+    queue_push(&async->completed, job, job);
+    r = write(async->fd, &one, sizeof(one));             // It only fails if the counter is about to overflow, and then the eventfd is readable
+    (void)r;
+}
+
+
+static void agree_batch(fourq_async* async, fourq_job** jobs, const unsigned int njobs, const bool compressed)
+{ // Compute a batch of secret agreements with the batched agreement functions
+    const unsigned char *sk[NLANES_BATCH], *pk[NLANES_BATCH];
+    unsigned char* ss[NLANES_BATCH];
+    ECCRYPTO_STATUS Statuses[NLANES_BATCH];
+    unsigned int i;
+
+    for (i = 0; i < njobs; i++) {
+        sk[i] = jobs[i]->SecretKey; pk[i] = jobs[i]->PublicKey; ss[i] = jobs[i]->SharedSecret;
+    }
+    if (compressed == true) {
+        CompressedSecretAgreementBatch(sk, pk, ss, njobs, Statuses);
+    } else {
+        SecretAgreementBatch(sk, pk, ss, njobs, Statuses);
+    }
+    for (i = 0; i < njobs; i++) {
+        jobs[i]->Status = Statuses[i];
+        complete(async, jobs[i]);
+    }
+}
+
+
+static void process_batch(fourq_async* async, fourq_job* list)
+{ // Process a list of jobs. Secret agreements are grouped by type in batches of NLANES_BATCH, the other jobs are processed one at a time
+    fourq_job *job, *next, *agreements[2][NLANES_BATCH];
+    unsigned int i, nagreements[2] = {0, 0};
+
+    for (job = list; job != NULL; job = next) {
+        next = job->next;                                // The job can be released by the caller once it is completed
+        switch (job->Type) {
+        case FOURQ_JOB_SIGN:
+            job->Status = SchnorrQ_Sign(job->SecretKey, job->PublicKey, job->Message, job->SizeMessage, job->Signature);
+            complete(async, job);
+            break;
+        case FOURQ_JOB_VERIFY:
+            job->Status = SchnorrQ_Verify(job->PublicKey, job->Message, job->SizeMessage, job->Signature, &job->valid);
+            complete(async, job);
+            break;
+        case FOURQ_JOB_COMPRESSED_AGREEMENT:
+        case FOURQ_JOB_AGREEMENT:
+            i = (job->Type == FOURQ_JOB_COMPRESSED_AGREEMENT)? 0 : 1;
+            agreements[i][nagreements[i]++] = job;
+            if (nagreements[i] == NLANES_BATCH) {
+                agree_batch(async, agreements[i], NLANES_BATCH, (i == 0));
+                nagreements[i] = 0;
+            }
+            break;
+        default:
+            job->Status = ECCRYPTO_ERROR_INVALID_PARAMETER;
+            complete(async, job);
+            break;
+        }
+    }
+
+    for (i = 0; i < 2; i++) {
+        if (nagreements[i] != 0) {
+            agree_batch(async, agreements[i], nagreements[i], (i == 0));
+        }
+    }
+}
+
+
+static void* worker_main(void* arg)
+{ // Worker thread: process all the queued jobs at once and sleep when the queue is empty. Queued jobs are processed before exiting
+    async_worker* worker = (async_worker*)arg;
+    fourq_job* list;
+
+    for (;;) {
+        list = queue_take_all(&worker->queue);
+        if (list != NULL) {
+            process_batch(worker->async, list);
+            continue;
+        }
+        if (__atomic_load_n(&worker->async->shutdown, __ATOMIC_ACQUIRE) == true) {
+            break;
+        }
+        while (sem_wait(&worker->queue.wakeup) != 0) {}  // Retry if interrupted by a signal
+    }
+    return NULL;
+}
+
+
+ECCRYPTO_STATUS fourq_async_create(const unsigned int NumThreads, fourq_async** Async)
+{ // Create an asynchronous job context with NumThreads worker threads, or one thread per online CPU if NumThreads = 0
+    fourq_async* async;
+    unsigned int i, nthreads = NumThreads;
+    long ncpus;
+
+    *Async = NULL;
+    if (nthreads == 0) {
+        ncpus = sysconf(_SC_NPROCESSORS_ONLN);
+        nthreads = (ncpus > 1)? (unsigned int)ncpus : 1;
+    }
+
+    async = (fourq_async*)calloc(1, sizeof(fourq_async));
+    if (async == NULL) {
+        return ECCRYPTO_ERROR_NO_MEMORY;
+    }
+    async->workers = (async_worker*)calloc(nthreads, sizeof(async_worker));
+    if (async->workers == NULL) {
+        free(async);
+        return ECCRYPTO_ERROR_NO_MEMORY;
+    }
+    async->fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (async->fd == -1) {
+        free(async->workers);
+        free(async);
+        return ECCRYPTO_ERROR;
+    }
+
+    for (i = 0; i < nthreads; i++) {
+        async->workers[i].async = async;
+        if (sem_init(&async->workers[i].queue.wakeup, 0, 0) != 0) {
+            break;
+        }
+        if (pthread_create(&async->workers[i].thread, NULL, worker_main, &async->workers[i]) != 0) {
+            sem_destroy(&async->workers[i].queue.wakeup);
+            break;
+        }
+    }
+    async->nthreads = i;
+    if (i < nthreads) {                                  // Some semaphore or thread could not be created
+        fourq_async_destroy(async);
+        return ECCRYPTO_ERROR;
+    }
+
+    *Async = async;
+    return ECCRYPTO_SUCCESS;
+}
+
+
+void fourq_async_destroy(fourq_async* Async)
+{ // Complete the submitted jobs, stop the worker threads and release the context. No job can be submitted concurrently
+    unsigned int i;
+
+    if (Async == NULL) {
+        return;
+    }
+
+    __atomic_store_n(&Async->shutdown, true, __ATOMIC_RELEASE);
+    for (i = 0; i < Async->nthreads; i++) {
+        sem_post(&Async->workers[i].queue.wakeup);
+    }
+    for (i = 0; i < Async->nthreads; i++) {
+        pthread_join(Async->workers[i].thread, NULL);
+        sem_destroy(&Async->workers[i].queue.wakeup);
+    }
+
+    close(Async->fd);
+    free(Async->workers);
+    free(Async);
+}
+
+
+int fourq_async_fd(const fourq_async* Async)
+{ // Eventfd that becomes readable when jobs without a callback are completed
+    return Async->fd;
+}
+
+
+ECCRYPTO_STATUS fourq_async_submit(fourq_async* Async, fourq_job** Jobs, const unsigned int NumJobs)
+{ // Submit NumJobs jobs. All of them are queued to the same worker thread with a single atomic operation
+    async_worker* worker;
+    unsigned int i;
+
+    if (NumJobs == 0) {
+        return ECCRYPTO_SUCCESS;
+    }
+    if (Async == NULL || Async->nthreads == 0) {
+        return ECCRYPTO_ERROR_INVALID_PARAMETER;
+    }
+
+    for (i = 1; i < NumJobs; i++) {                      // Link the jobs from the newest to the oldest
+        Jobs[i]->next = Jobs[i-1];
+    }
+    worker = &Async->workers[__sync_fetch_and_add(&Async->next, 1) % Async->nthreads];
+    if (queue_push(&worker->queue, Jobs[NumJobs-1], Jobs[0]) == true) {
+        sem_post(&worker->queue.wakeup);
+    }
+    return ECCRYPTO_SUCCESS;
+}
+
+
+unsigned int fourq_async_poll(fourq_async* Async, fourq_job** Jobs, const unsigned int MaxJobs)
+{ // Get up to MaxJobs completed jobs without a callback, in completion order, and reset the eventfd. It returns the number of jobs
+  // If more than MaxJobs jobs are completed, the eventfd is signaled again so that the remaining ones are reported by the next call
+  // This function must not be called concurrently by several threads
+    uint64_t count, one = 1;
+    ssize_t r;
+    unsigned int n = 0;
+    fourq_job *list, *last;
+
+    r = read(Async->fd, &count, sizeof(count));          // It fails if nothing was signaled, but jobs can remain from a previous call
+    (void)r;
+
+    list = queue_take_all(&Async->completed);            // Taken after reading the eventfd, so that later completions signal it again
+    if (list != NULL) {
+        if (Async->ready == NULL) {
+            Async->ready = list;
+        } else {
+            for (last = Async->ready; last->next != NULL; last = last->next) {}
+            last->next = list;
+        }
+    }
+
+    while (n < MaxJobs && Async->ready != NULL) {
+        Jobs[n++] = Async->ready;
+        Async->ready = Async->ready->next;
+    }
+    if (Async->ready != NULL) {                          // Keep the eventfd readable while completed jobs remain
+        r = write(Async->fd, &one, sizeof(one));
+        (void)r;
+    }
+    return n;
+}
+
+#endif
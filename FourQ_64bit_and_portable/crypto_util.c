@@ -213,6 +213,33 @@ void Montgomery_inversion_mod_order(const digit_t* ma, digit_t* mc)
 }
 
 
+#if defined(OPCOUNT_SUPPORT)
+THREAD_LOCAL FourQ_OpCounts opcounts;
+#endif
+
+
+ECCRYPTO_STATUS FourQ_get_opcounts(FourQ_OpCounts* Counts)
+{ // Get the operations counted in the calling thread since the last reset
+
+#if defined(OPCOUNT_SUPPORT)
+    *Counts = opcounts;
+    return ECCRYPTO_SUCCESS;
+#else
+    memset(Counts, 0, sizeof(FourQ_OpCounts));
+    return ECCRYPTO_ERROR_NOT_IMPLEMENTED;
+#endif
+}
+
+
+void FourQ_reset_opcounts(void)
+{ // Reset the operation counts of the calling thread
+
+#if defined(OPCOUNT_SUPPORT)
+    memset(&opcounts, 0, sizeof(FourQ_OpCounts));
+#endif
+}
+
+
 const char* FourQ_get_error_message(ECCRYPTO_STATUS Status)
 { // Output error/success message for a given ECCRYPTO_STATUS
     struct error_mapping {
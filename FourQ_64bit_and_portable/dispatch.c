@@ -0,0 +1,139 @@
+/***********************************************************************************
+* FourQlib: a high-performance crypto library based on the elliptic curve FourQ
+*
+*    Copyright (c) Microsoft Corporation. All rights reserved.
+*
+* Abstract: backend selection
+*
+* Builds with runtime dispatch (DISPATCH=TRUE) include the generic, x64 assembly, AVX2
+* and AVX-512 IFMA backends. The fastest backend supported by the CPU is selected with
+* cpuid when the library is loaded, and can be overridden with FourQ_set_backend().
+************************************************************************************/
+
+#include "FourQ_internal.h"
+#if defined(DISPATCH_SUPPORT)
+    #include <cpuid.h>
+#endif
+
+
+#if defined(DISPATCH_SUPPORT)
+
+static const backend_functions backends[FOURQ_BACKEND_END_OF_LIST] = {
+    {fp2addsub1271_c, fp2mul1271_c, fp2sqr1271_c, table_lookup_1x8_c, table_lookup_fixed_base_c},                                  // Generic
+    {fp2addsub1271_a_x64, fp2mul1271_a_x64, fp2sqr1271_a_x64, table_lookup_1x8_c, table_lookup_fixed_base_c},                      // x64
+    {fp2addsub1271_a_avx2, fp2mul1271_a_avx2, fp2sqr1271_a_avx2, table_lookup_1x8_avx2, table_lookup_fixed_base_avx2},             // AVX2
+    {fp2addsub1271_a_avx2, fp2mul1271_a_avx2, fp2sqr1271_a_avx2, table_lookup_1x8_avx2, table_lookup_fixed_base_avx2}              // AVX-512 IFMA (ecc_mul_x8 is selected in eccp2_x8.c)
+};
+
+static FourQ_BACKEND current_backend = FOURQ_BACKEND_GENERIC;
+const backend_functions* selected_backend = &backends[FOURQ_BACKEND_GENERIC];
+
+
+static uint64_t read_xcr0(void)
+{ // Read the extended control register XCR0, which indicates the register states enabled by the OS
+    uint32_t eax, edx;
+
+    __asm__ __volatile__ ("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return ((uint64_t)edx << 32) | eax;
+}
+
+
+static bool is_backend_supported(FourQ_BACKEND Backend)
+{ // Check if the CPU and the OS support the instructions used by a given backend
+    unsigned int eax, ebx, ecx, edx;
+    uint64_t xcr0;
+
+    if (Backend == FOURQ_BACKEND_GENERIC || Backend == FOURQ_BACKEND_X64) {
+        return true;
+    }
+    if (Backend != FOURQ_BACKEND_AVX2 && Backend != FOURQ_BACKEND_AVX512IFMA) {
+        return false;
+    }
+
+    // AVX2 backend: AVX2 and BMI2 (MULX), with the YMM state enabled by the OS
+    if (__get_cpuid(1, &eax, &ebx, &ecx, &edx) == 0 || (ecx & bit_OSXSAVE) == 0 || (ecx & bit_AVX) == 0) {
+        return false;
+    }
+    xcr0 = read_xcr0();
+    if ((xcr0 & 0x06) != 0x06) {                                         // XMM and YMM states
+        return false;
+    }
+    if (__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) == 0 || (ebx & bit_AVX2) == 0 || (ebx & bit_BMI2) == 0) {
+        return false;
+    }
+    if (Backend == FOURQ_BACKEND_AVX2) {
+        return true;
+    }
+
+    // AVX-512 IFMA backend: AVX-512F and AVX-512 IFMA, with the opmask and ZMM states enabled by the OS
+    return ((xcr0 & 0xE6) == 0xE6 && (ebx & bit_AVX512F) != 0 && (ebx & bit_AVX512IFMA) != 0);
+}
+
+
+__attribute__((constructor)) static void select_backend(void)
+{ // Select the fastest backend supported by the CPU when the library is loaded
+    FourQ_BACKEND Backend;
+
+    for (Backend = FOURQ_BACKEND_AVX512IFMA; Backend > FOURQ_BACKEND_GENERIC; Backend--) {
+        if (FourQ_set_backend(Backend) == ECCRYPTO_SUCCESS) {
+            return;
+        }
+    }
+}
+
+
+FourQ_BACKEND FourQ_get_backend(void)
+{ // Get the backend in use
+    return current_backend;
+}
+
+
+ECCRYPTO_STATUS FourQ_set_backend(FourQ_BACKEND Backend)
+{ // Select the backend. It returns ECCRYPTO_ERROR_INVALID_PARAMETER if the backend is not supported by the CPU
+  // This function is not thread-safe and should not be called while other library functions are running
+
+    if (Backend >= FOURQ_BACKEND_END_OF_LIST || is_backend_supported(Backend) == false) {
+        return ECCRYPTO_ERROR_INVALID_PARAMETER;
+    }
+    selected_backend = &backends[Backend];
+    current_backend = Backend;
+    return ECCRYPTO_SUCCESS;
+}
+
+#else
+
+FourQ_BACKEND FourQ_get_backend(void)
+{ // Get the backend in use, which is fixed at compile time in builds without runtime dispatch
+#if defined(AVX512IFMA_SUPPORT)
+    return FOURQ_BACKEND_AVX512IFMA;
+#elif (SIMD_SUPPORT == AVX2_SUPPORT)
+    return FOURQ_BACKEND_AVX2;
+#elif defined(ASM_SUPPORT)
+    return FOURQ_BACKEND_X64;
+#else
+    return FOURQ_BACKEND_GENERIC;
+#endif
+}
+
+
+ECCRYPTO_STATUS FourQ_set_backend(FourQ_BACKEND Backend)
+{ // Select the backend. Without runtime dispatch, only the backend fixed at compile time can be selected
+
+    if (Backend != FourQ_get_backend()) {
+        return ECCRYPTO_ERROR_INVALID_PARAMETER;
+    }
+    return ECCRYPTO_SUCCESS;
+}
+
+#endif
+
+
+const char* FourQ_get_backend_name(FourQ_BACKEND Backend)
+{ // Get the name of a backend
+    static const char* names[FOURQ_BACKEND_END_OF_LIST] = {"generic", "x64", "AVX2", "AVX-512 IFMA"};
+
+    if (Backend >= FOURQ_BACKEND_END_OF_LIST) {
+        return "Unrecognized backend";
+    }
+    return names[Backend];
+}
@@ -418,6 +418,12 @@ void recode(uint64_t* scalars, unsigned int* digits, unsigned int* sign_masks)
 }
 
 
+typedef struct {                                              // Working set of ecc_mul()
+    point_extproj_precomp_t Table[8];
+    unsigned int digits[65], sign_masks[65];
+} ecc_mul_set;
+
+
 bool ecc_mul(point_t P, digit_t* k, point_t Q, bool clear_cofactor)
 { // Variable-base scalar multiplication Q = k*P using a 4-dimensional decomposition
   // Inputs: scalar "k" in [0, 2^256-1],
@@ -425,10 +431,11 @@ bool ecc_mul(point_t P, digit_t* k, point_t Q, bool clear_cofactor)
   //         clear_cofactor = 1 (TRUE) or 0 (FALSE) whether cofactor clearing is required or not, respectively.
   // Output: Q = k*P in affine coordinates (x,y).
   // This function performs point validation and (if selected) cofactor clearing.
+    WORKING_SET(ecc_mul_set, ws);
     point_extproj_t R;
-    point_extproj_precomp_t S, Table[8];
+    point_extproj_precomp_t S, *Table = ws->Table;
     uint64_t scalars[NWORDS64_ORDER];
-    unsigned int digits[65], sign_masks[65];
+    unsigned int *digits = ws->digits, *sign_masks = ws->sign_masks;
     int i;
 
     point_setup(P, R);                                        // Convert to representation (X,Y,1,Ta,Tb)
@@ -463,6 +470,66 @@ bool ecc_mul(point_t P, digit_t* k, point_t Q, bool clear_cofactor)
 }
 
 
+typedef struct {                                              // Working set of ecc_mul_shared()
+    point_extproj_t R[NPOINTS_SHARED_BATCH];
+    unsigned int digits[65], sign_masks[65];
+} ecc_mul_shared_set;
+
+
+bool ecc_mul_shared(point_t* P, digit_t* k, point_t* Q, unsigned int npoints, bool clear_cofactor)
+{ // Variable-base scalar multiplication Q_i = k*P_i, for i = 0,...,npoints-1, with a single scalar k, using a 4-dimensional decomposition
+  // Inputs: scalar "k" in [0, 2^256-1],
+  //         points P_i = (x_i,y_i) in affine coordinates,
+  //         clear_cofactor = 1 (TRUE) or 0 (FALSE) whether cofactor clearing is required or not, respectively.
+  // Output: Q_i = k*P_i in affine coordinates (x_i,y_i).
+  // This function performs point validation and (if selected) cofactor clearing. It returns false if any of the points P_i is not on the curve.
+  // All the points are validated before the scalar is decomposed and recoded once. Groups of NLANES_BATCH points are processed together by 
+  // ecc_mul_x4_recoded() or ecc_mul_x8_recoded(), and groups of NPOINTS_SHARED_BATCH results are normalized with a single inversion. 
+  // The decomposition of k is only valid for points in the prime-order subgroup, so clear_cofactor = FALSE gives incorrect results for other points.
+    WORKING_SET(ecc_mul_shared_set, ws);
+    point_extproj_t* R = ws->R;
+    uint64_t scalars[NWORDS64_ORDER];
+    unsigned int *digits = ws->digits, *sign_masks = ws->sign_masks;
+    unsigned int i, j, n;
+
+    for (i = 0; i < npoints; i++) {
+        point_setup(P[i], R[0]);                              // Convert to representation (X,Y,1,Ta,Tb)
+        if (ecc_point_validate(R[0]) == false) {              // Check if point lies on the curve
+            return false;
+        }
+    }
+
+    decompose((uint64_t*)k, scalars);                         // Scalar decomposition
+    recode(scalars, digits, sign_masks);                      // Scalar recoding
+
+    for (i = 0; i < npoints; i += NPOINTS_SHARED_BATCH) {
+        n = (npoints - i < NPOINTS_SHARED_BATCH)? npoints - i : NPOINTS_SHARED_BATCH;
+
+        for (j = 0; j < n; j++) {
+            point_setup(P[i+j], R[j]);
+            if (clear_cofactor == true) {
+                cofactor_clearing(R[j]);
+            }
+        }
+        for (; j % NLANES_BATCH != 0; j++) {                  // Unused lanes of the last group are filled with the first point
+            ecccopy(R[0], R[j]);
+        }
+
+        for (j = 0; j < n; j += NLANES_BATCH) {
+            ecc_mul_batch_recoded(&R[j], digits, sign_masks);
+        }
+        eccnorm_batch(R, &Q[i], n);                           // Conversion to affine coordinates (x,y) and modular correction
+    }
+
+#ifdef TEMP_ZEROING
+    clear_words((void*)digits, 65);
+    clear_words((void*)sign_masks, 65);
+    clear_words((void*)scalars, 2*NWORDS64_ORDER);
+#endif
+    return true;
+}
+
+
 void cofactor_clearing(point_extproj_t P)
 { // Co-factor clearing
   // Input: P = (X1,Y1,Z1,Ta,Tb), where T1 = Ta*Tb, corresponding to (X1:Y1:Z1:T1) in extended twisted Edwards coordinates
@@ -14,6 +14,10 @@
 #include "FourQ_internal.h"
 #include "FourQ_params.h"
 #include "FourQ_tables.h"
+#if !defined(FOURQ_NO_MALLOC)
+    #include <stdlib.h>
+#endif
+#include <string.h>
 #if defined(GENERIC_IMPLEMENTATION)
     #include "generic/fp.h"
 #elif (TARGET == TARGET_AMD64)
@@ -47,12 +51,10 @@ void fp2neg1271(f2elm_t a)
 }
 
 
-void fp2sqr1271(f2elm_t a, f2elm_t c)
-{// GF(p^2) squaring, c = a^2 in GF((2^127-1)^2)
+#if defined(DISPATCH_SUPPORT) || !defined(ASM_SUPPORT)
 
-#ifdef ASM_SUPPORT
-    fp2sqr1271_a(a, c);
-#else
+void fp2sqr1271_c(f2elm_t a, f2elm_t c)
+{// GF(p^2) squaring using the C field functions, c = a^2 in GF((2^127-1)^2)
     felm_t t1, t2, t3;
 
     fpadd1271(a[0], a[1], t1);           // t1 = a0+a1 
@@ -65,16 +67,11 @@ void fp2sqr1271(f2elm_t a, f2elm_t c)
     clear_words((void*)t2, sizeof(felm_t)/sizeof(unsigned int));
     clear_words((void*)t3, sizeof(felm_t)/sizeof(unsigned int));
 #endif
-#endif
 }
 
 
-void fp2mul1271(f2elm_t a, f2elm_t b, f2elm_t c)
-{// GF(p^2) multiplication, c = a*b in GF((2^127-1)^2)
-
-#if defined(ASM_SUPPORT)        
-    fp2mul1271_a(a, b, c);
-#else
+void fp2mul1271_c(f2elm_t a, f2elm_t b, f2elm_t c)
+{// GF(p^2) multiplication using the C field functions, c = a*b in GF((2^127-1)^2)
     felm_t t1, t2, t3, t4;
     
     fpmul1271(a[0], b[0], t1);          // t1 = a0*b0
@@ -91,12 +88,42 @@ void fp2mul1271(f2elm_t a, f2elm_t b, f2elm_t c)
     clear_words((void*)t3, sizeof(felm_t)/sizeof(unsigned int));
     clear_words((void*)t4, sizeof(felm_t)/sizeof(unsigned int));
 #endif
+}
+
+#endif
+
+
+void fp2sqr1271(f2elm_t a, f2elm_t c)
+{// GF(p^2) squaring, c = a^2 in GF((2^127-1)^2)
+
+    OPCOUNT(fp2sqr);
+#if defined(DISPATCH_SUPPORT)
+    selected_backend->fp2sqr1271(a, c);
+#elif defined(ASM_SUPPORT)
+    fp2sqr1271_a(a, c);
+#else
+    fp2sqr1271_c(a, c);
+#endif
+}
+
+
+void fp2mul1271(f2elm_t a, f2elm_t b, f2elm_t c)
+{// GF(p^2) multiplication, c = a*b in GF((2^127-1)^2)
+
+    OPCOUNT(fp2mul);
+#if defined(DISPATCH_SUPPORT)
+    selected_backend->fp2mul1271(a, b, c);
+#elif defined(ASM_SUPPORT)        
+    fp2mul1271_a(a, b, c);
+#else
+    fp2mul1271_c(a, b, c);
 #endif
 }
 
 
 __inline void fp2add1271(f2elm_t a, f2elm_t b, f2elm_t c)
 {// GF(p^2) addition, c = a+b in GF((2^127-1)^2)
+    OPCOUNT(fp2add);
     fpadd1271(a[0], b[0], c[0]);
     fpadd1271(a[1], b[1], c[1]);
 }
@@ -109,10 +136,23 @@ __inline void fp2sub1271(f2elm_t a, f2elm_t b, f2elm_t c)
 }
 
 
+#if defined(DISPATCH_SUPPORT)
+
+void fp2addsub1271_c(f2elm_t a, f2elm_t b, f2elm_t c)
+{// GF(p^2) addition followed by subtraction using the C field functions, c = 2a-b in GF((2^127-1)^2)
+    fp2add1271(a, a, a);
+    fp2sub1271(a, b, c);
+}
+
+#endif
+
+
 static __inline void fp2addsub1271(f2elm_t a, f2elm_t b, f2elm_t c)
 {// GF(p^2) addition followed by subtraction, c = 2a-b in GF((2^127-1)^2)
     
-#ifdef ASM_SUPPORT
+#if defined(DISPATCH_SUPPORT)
+    selected_backend->fp2addsub1271(a, b, c);
+#elif defined(ASM_SUPPORT)
     fp2addsub1271_a(a, b, c);
 #else
     fp2add1271(a, a, a);
@@ -125,6 +165,7 @@ void fp2inv1271(f2elm_t a)
 {// GF(p^2) inversion, a = (a0-i*a1)/(a0^2+a1^2)
     f2elm_t t1;
 
+    OPCOUNT(fp2inv);
     fpsqr1271(a[0], t1[0]);             // t10 = a0^2
     fpsqr1271(a[1], t1[1]);             // t11 = a1^2
     fpadd1271(t1[0], t1[1], t1[0]);     // t10 = a0^2+a1^2
@@ -176,6 +217,44 @@ void eccnorm(point_extproj_t P, point_t Q)
 }
 
 
+void eccnorm_batch(point_extproj_t* P, point_t* Q, unsigned int npoints)
+{ // Normalize "npoints" projective points (X_i:Y_i:Z_i), including full reduction, using Montgomery's simultaneous inversion
+  // Input: P_i = (X_i:Y_i:Z_i) in twisted Edwards coordinates, for i = 0,...,npoints-1. The Z_i coordinates are overwritten
+  // Output: Q_i = (X_i/Z_i,Y_i/Z_i), corresponding to (X_i:Y_i:Z_i:T_i) in extended twisted Edwards coordinates
+  // The cost is one inversion and 3*(npoints-1) multiplications. The x-coordinates of Q are used to store the partial products Z_0*...*Z_i
+    f2elm_t t1;
+    unsigned int i;
+
+    if (npoints == 0) {
+        return;
+    }
+
+    fp2copy1271(P[0]->z, Q[0]->x);
+    for (i = 1; i < npoints; i++) {
+        fp2mul1271(Q[i-1]->x, P[i]->z, Q[i]->x);              // Q_i->x = Z_0*...*Z_i
+    }
+    fp2inv1271(Q[npoints-1]->x);                               // t = (Z_0*...*Z_(npoints-1))^-1
+    fp2copy1271(Q[npoints-1]->x, t1);
+
+    for (i = npoints-1; i > 0; i--) {
+        fp2mul1271(t1, Q[i-1]->x, Q[i]->x);                    // Q_i->x = 1/Z_i
+        fp2mul1271(t1, P[i]->z, t1);                           // t = 1/(Z_0*...*Z_(i-1))
+        fp2copy1271(Q[i]->x, P[i]->z);
+    }
+    fp2copy1271(t1, P[0]->z);
+
+    for (i = 0; i < npoints; i++) {
+        fp2mul1271(P[i]->x, P[i]->z, Q[i]->x);                 // x_i = X_i/Z_i
+        fp2mul1271(P[i]->y, P[i]->z, Q[i]->y);                 // y_i = Y_i/Z_i
+        mod1271(Q[i]->x[0]); mod1271(Q[i]->x[1]); 
+        mod1271(Q[i]->y[0]); mod1271(Q[i]->y[1]); 
+    }
+#ifdef TEMP_ZEROING
+    clear_words((void*)t1, sizeof(f2elm_t)/sizeof(unsigned int));
+#endif
+}
+
+
 __inline void R1_to_R2(point_extproj_t P, point_extproj_precomp_t Q) 
 { // Conversion from representation (X,Y,Z,Ta,Tb) to (X+Y,Y-X,2Z,2dT), where T = Ta*Tb
   // Input:  P = (X1,Y1,Z1,Ta,Tb), where T1 = Ta*Tb, corresponding to (X1:Y1:Z1:T1) in extended twisted Edwards coordinates
@@ -220,6 +299,7 @@ __inline void eccdouble(point_extproj_t P)
   //         corresponding to (Xfinal:Yfinal:Zfinal:Tfinal) in extended twisted Edwards coordinates
     f2elm_t t1, t2;  
 
+    OPCOUNT(eccdouble);
     fp2sqr1271(P->x, t1);                  // t1 = X1^2
     fp2sqr1271(P->y, t2);                  // t2 = Y1^2
     fp2add1271(P->x, P->y, P->x);          // t3 = X1+Y1
@@ -273,6 +353,7 @@ __inline void eccadd(point_extproj_precomp_t Q, point_extproj_t P)
   //         corresponding to (Xfinal:Yfinal:Zfinal:Tfinal) in extended twisted Edwards coordinates
     point_extproj_precomp_t R;
     
+    OPCOUNT(eccadd);
     R1_to_R3(P, R);                        // R = (X1+Y1,Y1-Z1,Z1,T1)
     eccadd_core(Q, R, P);                  // P = (X2+Y2,Y2-X2,2Z2,2dT2) + (X1+Y1,Y1-Z1,Z1,T1)
 
@@ -330,6 +411,56 @@ __inline bool ecc_point_validate(point_extproj_t P)
 }
 
 
+bool ecc_point_in_subgroup(point_t P)
+{ // Subgroup check: check if point P lies in the prime-order subgroup, i.e., if N*P is the neutral point, where N is the order of the subgroup
+  // Input: P = (x,y) in affine coordinates, a point on the curve.
+  // Output: TRUE (1) if N*P = (0,1), FALSE (0) if P has a component of small order (dividing the cofactor 392).
+  // The multiplication by N uses a sliding window of width 4 over the bits of N, without endomorphisms, which do not act on the small-order
+  // components as on the prime-order subgroup. The cost is 246 doublings and 55 additions, including the table of odd multiples.
+  // SECURITY NOTE: this function does not run in constant time (input point P is assumed to be public).
+    point_extproj_precomp_t Table[8], Q2;
+    point_extproj_t Q, R;
+    f2elm_t t;
+    unsigned int u;
+    int i, j;
+
+    point_setup(P, Q);
+    R1_to_R2(Q, Table[0]);                                      // Table[u] = (2*u+1)*P
+    ecccopy(Q, R);
+    eccdouble(R);
+    R1_to_R2(R, Q2);
+    for (u = 1; u < 8; u++) {
+        eccadd(Q2, Q);
+        R1_to_R2(Q, Table[u]);
+    }
+
+    fp2zero1271(R->x); fp2zero1271(R->y); fp2zero1271(R->z); fp2zero1271(R->ta); fp2zero1271(R->tb);
+    R->y[0][0] = 1; R->z[0][0] = 1; R->tb[0][0] = 1;           // R = (0:1:1:0:1), the neutral point
+    for (i = NBITS_ORDER_PLUS_ONE-2; i >= 0; i = j-1) {         // Bits of N from the most significant one (bit 245)
+        if (((curve_order[i >> 6] >> (i & 63)) & 1) == 0) {
+            eccdouble(R);
+            j = i;
+            continue;
+        }
+        for (j = (i > 3)? i-3 : 0; ((curve_order[j >> 6] >> (j & 63)) & 1) == 0; j++) {}   // Window of bits i..j, with bit j = 1
+        for (u = 0; (int)u <= i-j; u++) {
+            eccdouble(R);
+        }
+        u = (unsigned int)(curve_order[j >> 6] >> (j & 63));
+        if ((i >> 6) != (j >> 6)) {
+            u |= (unsigned int)(curve_order[i >> 6] << (64 - (j & 63)));
+        }
+        u &= (1 << (i-j+1)) - 1;
+        eccadd(Table[u >> 1], R);                               // R = R + u*P, with u odd
+    }
+
+    fp2sub1271(R->y, R->z, t);                                  // N*P = (0,1) if X = 0 and Y = Z
+    mod1271(t[0]); mod1271(t[1]);
+    mod1271(R->x[0]); mod1271(R->x[1]);
+    return (is_zero_ct((digit_t*)R->x, 2*NWORDS_FIELD) && is_zero_ct((digit_t*)t, 2*NWORDS_FIELD));
+}
+
+
 static __inline void R5_to_R1(point_precomp_t P, point_extproj_t Q)      
 { // Conversion from representation (x+y,y-x,2dt) to (X,Y,Z,Ta,Tb) 
   // Input:  P = (x1+y1,y1-x1,2dt1) corresponding to (X1:Y1:Z1:T1) in extended twisted Edwards coordinates, where Z1=1
@@ -353,6 +484,7 @@ static __inline void eccmadd(point_precomp_t Q, point_extproj_t P)
   //         corresponding to (Xfinal:Yfinal:Zfinal:Tfinal) in extended twisted Edwards coordinates
     f2elm_t t1, t2;
     
+    OPCOUNT(eccmadd);
     fp2mul1271(P->ta, P->tb, P->ta);        // Ta = T1
     fp2add1271(P->z, P->z, t1);             // t1 = 2Z1        
     fp2mul1271(P->ta, Q->t2, P->ta);        // Ta = 2dT1*t2 
@@ -380,19 +512,27 @@ void eccmadd_ni(point_precomp_t Q, point_extproj_t P)
 }
 
 
-bool ecc_mul_fixed(digit_t* k, point_t Q)
-{ // Fixed-base scalar multiplication Q = k*G, where G is the generator. FIXED_BASE_TABLE stores v*2^(w-1) = 80 multiples of G.
-  // Inputs: scalar "k" in [0, 2^256-1].
-  // Output: Q = k*G in affine coordinates (x,y).
+typedef struct {                                                // Working set of ecc_mul_fixed_table_extproj()
+    unsigned int digits[NBITS_ORDER_PLUS_ONE+(W_FIXEDBASE*V_FIXEDBASE)-1];
+} ecc_mul_fixed_set;
+
+
+void ecc_mul_fixed_table_extproj(point_fixedbase_t* table, digit_t* k, point_extproj_t R)
+{ // Fixed-base scalar multiplication R = k*P without the final normalization, where P is a point of order N (the prime subgroup order) with comb table "table". 
+  // The table stores v*2^(w-1) multiples of P (80 with the default parameters w = 5 and v = 5), see FIXED_BASE_TABLE in FourQ_tables.h and ecc_prepare_fixed().
+  // Inputs: comb table of P (the table is only read), scalar "k" in [0, 2^256-1].
+  // Output: R = k*P in representation (X,Y,Z,Ta,Tb).
   // The function is based on the modified LSB-set comb method, which converts the scalar to an odd signed representation
   // with (bitlength(order)+w*v) digits.
     unsigned int j, w = W_FIXEDBASE, v = V_FIXEDBASE, d = D_FIXEDBASE, e = E_FIXEDBASE;
-    unsigned int digit = 0, digits[NBITS_ORDER_PLUS_ONE+(W_FIXEDBASE*V_FIXEDBASE)-1] = {0}; 
+    WORKING_SET(ecc_mul_fixed_set, ws);
+    unsigned int digit = 0, *digits = ws->digits; 
     digit_t temp[NWORDS_ORDER];
-    point_extproj_t R;
     point_precomp_t S;
+    point_extproj_t T;                                          // The comb runs on a local point, which is copied to R at the end
     int i, ii;
 
+    memset(ws->digits, 0, sizeof(ws->digits));
 	modulo_order(k, temp);                                      // temp = k mod (order) 
 	conversion_to_odd(temp, temp);                              // Converting scalar to odd using the prime subgroup order
 	mLSB_set_recode((uint64_t*)temp, digits);                   // Scalar recoding
@@ -403,9 +543,9 @@ bool ecc_mul_fixed(digit_t* k, point_t Q)
     {
         digit = 2*digit + digits[i];
     }
-    // Initialize R = (x+y,y-x,2dt) with a point from the table
-	table_lookup_fixed_base(((point_precomp_t*)&FIXED_BASE_TABLE)+(v-1)*(1 << (w-1)), S, digit, digits[d-1]);
-    R5_to_R1(S, R);                                             // Converting to representation (X:Y:1:Ta:Tb)
+    // Initialize T = (x+y,y-x,2dt) with a point from the table
+	table_lookup_fixed_base(table+(v-1)*(1 << (w-1)), S, digit, digits[d-1]);
+    R5_to_R1(S, T);                                             // Converting to representation (X:Y:1:Ta:Tb)
 
     for (j = 0; j < (v-1); j++)
     {
@@ -415,13 +555,13 @@ bool ecc_mul_fixed(digit_t* k, point_t Q)
             digit = 2*digit + digits[i];
         }
         // Extract point in (x+y,y-x,2dt) representation
-        table_lookup_fixed_base(((point_precomp_t*)&FIXED_BASE_TABLE)+(v-j-2)*(1 << (w-1)), S, digit, digits[d-(j+1)*e-1]);
-        eccmadd(S, R);                                          // R = R+S using representations (X,Y,Z,Ta,Tb) <- (X,Y,Z,Ta,Tb) + (x+y,y-x,2dt) 
+        table_lookup_fixed_base(table+(v-j-2)*(1 << (w-1)), S, digit, digits[d-(j+1)*e-1]);
+        eccmadd(S, T);                                          // T = T+S using representations (X,Y,Z,Ta,Tb) <- (X,Y,Z,Ta,Tb) + (x+y,y-x,2dt) 
     }
 
     for (ii = (e-2); ii >= 0; ii--)
     {
-        eccdouble(R);                                           // R = 2*R using representations (X,Y,Z,Ta,Tb) <- 2*(X,Y,Z)
+        eccdouble(T);                                           // T = 2*T using representations (X,Y,Z,Ta,Tb) <- 2*(X,Y,Z)
         for (j = 0; j < v; j++)
         {
             digit = digits[w*d-j*e+ii-e];
@@ -430,16 +570,152 @@ bool ecc_mul_fixed(digit_t* k, point_t Q)
                 digit = 2*digit + digits[i];
             }
             // Extract point in (x+y,y-x,2dt) representation
-            table_lookup_fixed_base(((point_precomp_t*)&FIXED_BASE_TABLE)+(v-j-1)*(1 << (w-1)), S, digit, digits[d-j*e+ii-e]);
-            eccmadd(S, R);                                      // R = R+S using representations (X,Y,Z,Ta,Tb) <- (X,Y,Z,Ta,Tb) + (x+y,y-x,2dt)
+            table_lookup_fixed_base(table+(v-j-1)*(1 << (w-1)), S, digit, digits[d-j*e+ii-e]);
+            eccmadd(S, T);                                      // T = T+S using representations (X,Y,Z,Ta,Tb) <- (X,Y,Z,Ta,Tb) + (x+y,y-x,2dt)
         }        
     }     
-    eccnorm(R, Q);                                              // Conversion to affine coordinates (x,y) and modular correction. 
+    ecccopy(T, R);
     
 #ifdef TEMP_ZEROING
     clear_words((void*)digits, NBITS_ORDER_PLUS_ONE+(W_FIXEDBASE*V_FIXEDBASE)-1);
     clear_words((void*)S, sizeof(point_precomp_t)/sizeof(unsigned int));
+    clear_words((void*)T, sizeof(point_extproj_t)/sizeof(unsigned int));
 #endif
+}
+
+
+void ecc_mul_fixed_extproj(digit_t* k, point_extproj_t R)
+{ // Fixed-base scalar multiplication R = k*G, where G is the generator, without the final normalization (see ecc_mul_fixed_table_extproj()) 
+  // Inputs: scalar "k" in [0, 2^256-1].
+  // Output: R = k*G in representation (X,Y,Z,Ta,Tb).
+
+    ecc_mul_fixed_table_extproj((point_fixedbase_t*)&FIXED_BASE_TABLE, k, R);
+}
+
+
+bool ecc_mul_fixed(digit_t* k, point_t Q)
+{ // Fixed-base scalar multiplication Q = k*G, where G is the generator, see ecc_mul_fixed_extproj()
+  // Inputs: scalar "k" in [0, 2^256-1].
+  // Output: Q = k*G in affine coordinates (x,y).
+    point_extproj_t R;
+
+    ecc_mul_fixed_extproj(k, R);
+    eccnorm(R, Q);                                              // Conversion to affine coordinates (x,y) and modular correction. 
+
+    return true;
+}
+
+
+typedef struct {                                                // Working set of ecc_mul_fixed_batch()
+    point_extproj_t R[NPOINTS_FIXEDBASE_BATCH];
+} ecc_mul_fixed_batch_set;
+
+
+bool ecc_mul_fixed_batch(digit_t* k, point_t* Q, unsigned int npoints)
+{ // Fixed-base scalar multiplication Q_i = k_i*G, for i = 0,...,npoints-1, where G is the generator
+  // Inputs: scalars "k_i" in [0, 2^256-1], stored consecutively in "k" using NWORDS_ORDER digits each.
+  // Output: Q_i = k_i*G in affine coordinates (x_i,y_i).
+  // Groups of up to NPOINTS_FIXEDBASE_BATCH results are normalized with a single inversion (see eccnorm_batch()).
+    WORKING_SET(ecc_mul_fixed_batch_set, ws);
+    point_extproj_t* R = ws->R;
+    unsigned int i, j, n;
+
+    for (i = 0; i < npoints; i += NPOINTS_FIXEDBASE_BATCH) {
+        n = (npoints - i < NPOINTS_FIXEDBASE_BATCH)? npoints - i : NPOINTS_FIXEDBASE_BATCH;
+        for (j = 0; j < n; j++) {
+            ecc_mul_fixed_extproj(&k[(i+j)*NWORDS_ORDER], R[j]);
+        }
+        eccnorm_batch(R, &Q[i], n);                             // Conversion to affine coordinates (x,y) and modular correction
+    }
+
+    return true;
+}
+
+
+#define NPOINTS_PREPARE_FIXED  ((VPOINTS_FIXEDBASE < 16)? VPOINTS_FIXEDBASE : 16)   // Number of points normalized with a single inversion by ecc_prepare_fixed()
+
+typedef struct {                                                // Working set of ecc_prepare_fixed(), whose size does not grow with VPOINTS_FIXEDBASE beyond 16 points
+    point_extproj_t B[W_FIXEDBASE], T[NPOINTS_PREPARE_FIXED];
+    point_extproj_precomp_t U[W_FIXEDBASE];
+    point_t A[NPOINTS_PREPARE_FIXED];
+} ecc_prepare_fixed_set;
+
+
+void ecc_prepare_fixed(point_extproj_t P, point_fixedbase_t* table)
+{ // Generation of the comb table of a point P used by ecc_mul_fixed_table_extproj(), with the layout of FIXED_BASE_TABLE
+  // Input:  point P = (X,Y,Z,Ta,Tb) of order N (the prime subgroup order)
+  // Output: table with storage for NPOINTS_FIXEDBASE points. Block j in [0, v-1] contains the 2^(w-1) points 
+  //         2^(j*e)*(1 + u_1*2^d + ... + u_(w-1)*2^((w-1)*d))*P, for (u_(w-1),...,u_1) in [0, 2^(w-1)-1].
+  // The cost is about w*d doublings and one addition per point. Each block is computed and normalized in chunks of 
+  // NPOINTS_PREPARE_FIXED points, with a single inversion per chunk.
+    WORKING_SET(ecc_prepare_fixed_set, ws);
+    point_extproj_t *B = ws->B, *T = ws->T;
+    point_extproj_precomp_t* U = ws->U;
+    point_t* A = ws->A;
+    point_fixedbase_t* S;
+    unsigned int i, j, t, u, c;
+
+    ecccopy(P, B[0]);
+    for (t = 1; t < W_FIXEDBASE; t++) {                         // B[t] = 2^(t*d)*P
+        ecccopy(B[t-1], B[t]);
+        for (i = 0; i < D_FIXEDBASE; i++) {
+            eccdouble(B[t]);
+        }
+    }
+
+    for (j = 0; j < V_FIXEDBASE; j++) {                         // At block j, B[t] = 2^(j*e + t*d)*P
+        for (t = 1; t < W_FIXEDBASE; t++) {
+            R1_to_R2(B[t], U[t]);
+        }
+        for (c = 0; c < VPOINTS_FIXEDBASE; c += NPOINTS_PREPARE_FIXED) {   // Chunk of the points c+u, u in [0, NPOINTS_PREPARE_FIXED-1]
+            ecccopy(B[0], T[0]);
+            for (t = 0; (c >> t) != 0; t++) {                   // T[0] = B[0] + sum of the B[t+1] for the bits 2^t of c
+                if (((c >> t) & 1) != 0) {
+                    eccadd(U[t+1], T[0]);
+                }
+            }
+            for (u = 1; u < NPOINTS_PREPARE_FIXED; u++) {       // T[u] = T[u-2^t] + B[t+1], where 2^t is the most significant bit of u
+                for (t = 0; (u >> (t+1)) != 0; t++) {}
+                ecccopy(T[u ^ (1 << t)], T[u]);
+                eccadd(U[t+1], T[u]);
+            }
+            eccnorm_batch(T, A, NPOINTS_PREPARE_FIXED);         // Conversion to affine coordinates (x,y) and modular correction
+
+            for (u = 0; u < NPOINTS_PREPARE_FIXED; u++) {       // Conversion to representation (x+y,y-x,2dt), or (x+y,y-x) for the compact table
+                S = &table[j*VPOINTS_FIXEDBASE + c + u];
+                fp2add1271(A[u]->x, A[u]->y, (*S)->xy);
+                fp2sub1271(A[u]->y, A[u]->x, (*S)->yx);
+                mod1271((*S)->xy[0]); mod1271((*S)->xy[1]);
+                mod1271((*S)->yx[0]); mod1271((*S)->yx[1]);
+#if !defined(COMPACT_FIXEDBASE_SUPPORT)
+                fp2mul1271(A[u]->x, A[u]->y, (*S)->t2);
+                fp2add1271((*S)->t2, (*S)->t2, (*S)->t2);
+                fp2mul1271((*S)->t2, (felm_t*)&PARAMETER_d, (*S)->t2);
+                mod1271((*S)->t2[0]); mod1271((*S)->t2[1]);
+#endif
+            }
+        }
+
+        if (j < V_FIXEDBASE-1) {
+            for (t = 0; t < W_FIXEDBASE; t++) {                 // B[t] = 2^e*B[t] for the next block
+                for (i = 0; i < E_FIXEDBASE; i++) {
+                    eccdouble(B[t]);
+                }
+            }
+        }
+    }
+}
+
+
+bool ecc_mul_fixed_table(point_fixedbase_t* table, digit_t* k, point_t Q)
+{ // Fixed-base scalar multiplication Q = k*P, where P is a point of order N with comb table "table" generated by ecc_prepare_fixed()
+  // Inputs: comb table of P (the table is only read), scalar "k" in [0, 2^256-1].
+  // Output: Q = k*P in affine coordinates (x,y).
+    point_extproj_t R;
+
+    ecc_mul_fixed_table_extproj(table, k, R);
+    eccnorm(R, Q);                                              // Conversion to affine coordinates (x,y) and modular correction. 
+
     return true;
 }
 
@@ -521,6 +797,14 @@ static __inline void eccneg_precomp(point_precomp_t P, point_precomp_t Q)
 }
 
 
+#if (USE_ENDO == true)
+typedef struct {                                                // Working set of ecc_mul_double()
+    int digits_k[4][65], digits_l[4][65];
+    point_extproj_precomp_t Q_table[4][NPOINTS_DOUBLEMUL_WQ];
+} ecc_mul_double_set;
+#endif
+
+
 bool ecc_mul_double(digit_t* k, point_t Q, digit_t* l, point_t R)
 { // Double scalar multiplication R = k*G + l*Q, where the G is the generator. Uses DOUBLE_SCALAR_TABLE, which contains multiples of G, Phi(G), Psi(G) and Phi(Psi(G)).
   // Inputs: point Q in affine coordinates,
@@ -531,14 +815,17 @@ bool ecc_mul_double(digit_t* k, point_t Q, digit_t* l, point_t R)
     // SECURITY NOTE: this function is intended for a non-constant-time operation such as signature verification. 
 
 #if (USE_ENDO == true)
+    WORKING_SET(ecc_mul_double_set, ws);
     unsigned int position;
-    int i, digits_k1[65] = {0}, digits_k2[65] = {0}, digits_k3[65] = {0}, digits_k4[65] = {0};
-    int digits_l1[65] = {0}, digits_l2[65] = {0}, digits_l3[65] = {0}, digits_l4[65] = {0};
+    int i, *digits_k1 = ws->digits_k[0], *digits_k2 = ws->digits_k[1], *digits_k3 = ws->digits_k[2], *digits_k4 = ws->digits_k[3];
+    int *digits_l1 = ws->digits_l[0], *digits_l2 = ws->digits_l[1], *digits_l3 = ws->digits_l[2], *digits_l4 = ws->digits_l[3];
 	point_precomp_t V;
     point_extproj_t Q1, Q2, Q3, Q4, T; 
-    point_extproj_precomp_t U, Q_table1[NPOINTS_DOUBLEMUL_WQ], Q_table2[NPOINTS_DOUBLEMUL_WQ], Q_table3[NPOINTS_DOUBLEMUL_WQ], Q_table4[NPOINTS_DOUBLEMUL_WQ];
+    point_extproj_precomp_t U, *Q_table1 = ws->Q_table[0], *Q_table2 = ws->Q_table[1], *Q_table3 = ws->Q_table[2], *Q_table4 = ws->Q_table[3];
     uint64_t k_scalars[4], l_scalars[4];
     
+    memset(ws->digits_k, 0, sizeof(ws->digits_k));
+    memset(ws->digits_l, 0, sizeof(ws->digits_l));
     point_setup(Q, Q1);                                        // Convert to representation (X,Y,1,Ta,Tb)
     
     if (ecc_point_validate(Q1) == false) {                     // Check if point lies on the curve
@@ -658,11 +945,541 @@ bool ecc_mul_double(digit_t* k, point_t Q, digit_t* l, point_t R)
     eccadd(S, T);
 #endif
     eccnorm(T, R);                                             // Output R = (x,y)
+
+    return true;
+}
+
+
+#if (USE_ENDO == true)
+
+bool ecc_prepare_double(point_t Q, point_extproj_precomp_t* Table)
+{ // Generation of the precomputed tables of a fixed point Q used by ecc_mul_double_prepared().
+  // Input:  point Q in affine coordinates
+  // Output: Table with storage for 4*NPOINTS_DOUBLEMUL_WQ_PREPARED points containing the wNAF tables of Q, Phi(Q), Psi(Q) and Phi(Psi(Q)), in this order.
+  // It returns false if Q does not lie on the curve.
+    point_extproj_t Q1, Q2, Q3, Q4;
+
+    point_setup(Q, Q1);                                        // Convert to representation (X,Y,1,Ta,Tb)
+    
+    if (ecc_point_validate(Q1) == false) {                     // Check if point lies on the curve
+        return false;
+    }
+    
+    // Computing endomorphisms over point Q
+    ecccopy(Q1, Q2);
+    ecc_phi(Q2);
+    ecccopy(Q1, Q3);    
+    ecc_psi(Q3); 
+    ecccopy(Q2, Q4); 
+    ecc_psi(Q4);  
+
+    ecc_precomp_double(Q1, Table, NPOINTS_DOUBLEMUL_WQ_PREPARED);       // Precomputation
+    ecc_precomp_double(Q2, &Table[NPOINTS_DOUBLEMUL_WQ_PREPARED], NPOINTS_DOUBLEMUL_WQ_PREPARED); 
+    ecc_precomp_double(Q3, &Table[2*NPOINTS_DOUBLEMUL_WQ_PREPARED], NPOINTS_DOUBLEMUL_WQ_PREPARED); 
+    ecc_precomp_double(Q4, &Table[3*NPOINTS_DOUBLEMUL_WQ_PREPARED], NPOINTS_DOUBLEMUL_WQ_PREPARED); 
+
+    return true;
+}
+
+
+typedef struct {                                                // Working set of ecc_mul_double_prepared()
+    int digits_k[4][65], digits_l[4][65];
+} ecc_mul_double_prepared_set;
+
+
+void ecc_mul_double_prepared(digit_t* k, point_extproj_precomp_t* Table, digit_t* l, point_t R)
+{ // Double scalar multiplication R = k*G + l*Q, where the G is the generator and Q is a fixed point with precomputed tables. 
+  // Uses DOUBLE_SCALAR_TABLE, which contains multiples of G, Phi(G), Psi(G) and Phi(Psi(G)).
+  // Inputs: Table generated by ecc_prepare_double() for point Q (the table is only read),
+  //         scalars "k" and "l" in [0, 2^256-1].
+  // Output: R = k*G + l*Q in affine coordinates (x,y).
+  // The function uses wNAF with interleaving, with window WQ_DOUBLEBASE_PREPARED for Q.
+            
+    // SECURITY NOTE: this function is intended for a non-constant-time operation such as signature verification. 
+
+    WORKING_SET(ecc_mul_double_prepared_set, ws);
+    unsigned int position, m;
+    int i, digit, (*digits_k)[65] = ws->digits_k, (*digits_l)[65] = ws->digits_l;
+	point_precomp_t V;
+    point_extproj_t T; 
+    point_extproj_precomp_t U;
+    uint64_t k_scalars[4], l_scalars[4];
+    
+    memset(ws->digits_k, 0, sizeof(ws->digits_k));
+    memset(ws->digits_l, 0, sizeof(ws->digits_l));
+    decompose((uint64_t*)k, k_scalars);                        // Scalar decomposition
+    decompose((uint64_t*)l, l_scalars);  
+    for (m = 0; m < 4; m++) {
+        wNAF_recode(k_scalars[m], WP_DOUBLEBASE, digits_k[m]);             // Scalar recoding
+        wNAF_recode(l_scalars[m], WQ_DOUBLEBASE_PREPARED, digits_l[m]);
+    }
+
+    fp2zero1271(T->x);                                         // Initialize T as the neutral point (0:1:1)
+    fp2zero1271(T->y); T->y[0][0] = 1; 
+    fp2zero1271(T->z); T->z[0][0] = 1;     
+
+    for (i = 64; i >= 0; i--)
+    {   
+        eccdouble(T);                                          // Double (X_T,Y_T,Z_T,Ta_T,Tb_T) = 2(X_T,Y_T,Z_T,Ta_T,Tb_T)
+
+        for (m = 0; m < 4; m++) {
+            digit = digits_l[m][i];
+            if (digit < 0) {
+                position = (-digit)/2;                      
+                eccneg_extproj_precomp(Table[m*NPOINTS_DOUBLEMUL_WQ_PREPARED+position], U);  // Load and negate U <- -(X+Y,Y-X,2Z,2dT) from a point in the precomputed table 
+                eccadd(U, T);                                
+            } else if (digit > 0) {            
+                position = digit/2;                       
+                eccadd(Table[m*NPOINTS_DOUBLEMUL_WQ_PREPARED+position], T);  // Take U <- (X+Y,Y-X,2Z,2dT) from a point in the precomputed table and compute T = T+U
+            }
+        }
+
+        for (m = 0; m < 4; m++) {
+            digit = digits_k[m][i];
+            if (digit < 0) {
+                position = (-digit)/2;                      
+                eccneg_precomp(((point_precomp_t*)&DOUBLE_SCALAR_TABLE)[m*NPOINTS_DOUBLEMUL_WP+position], V);
+                eccmadd(V, T);                              
+            } else if (digit > 0) {            
+                position = digit/2;                       
+                eccmadd(((point_precomp_t*)&DOUBLE_SCALAR_TABLE)[m*NPOINTS_DOUBLEMUL_WP+position], T);
+            }
+        }
+    }
+    eccnorm(T, R);                                             // Output R = (x,y)
+}
+
+#endif
+
+
+#if (USE_ENDO == true)
+
+static __inline void R2_to_R1(point_extproj_precomp_t P, f2elm_t dinv, point_extproj_t Q)
+{ // Conversion from representation (X+Y,Y-X,2Z,2dT) to (X,Y,Z,Ta,Tb), where T = Ta*Tb
+  // Inputs: P = (X1+Y1,Y1-X1,2Z1,2dT1) corresponding to (X1:Y1:Z1:T1) in extended twisted Edwards coordinates, 
+  //         dinv = 1/d, where d is the curve parameter
+  // Output: Q = (2X1,2Y1,2Z1,2T1,1) corresponding to (X1:Y1:Z1:T1) in extended twisted Edwards coordinates
     
+    fp2sub1271(P->xy, P->yx, Q->x);        // XQ = 2*X1
+    fp2add1271(P->xy, P->yx, Q->y);        // YQ = 2*Y1
+    fp2copy1271(P->z2, Q->z);              // ZQ = 2*Z1
+    fp2mul1271(P->t2, dinv, Q->ta);        // TaQ = 2*T1
+    fp2zero1271(Q->tb); Q->tb[0][0] = 1;   // TbQ = 1
+}
+
+
+static unsigned int pippenger_window(unsigned int nentries)
+{ // Window width c minimizing nwindows*(nentries + 2*nbuckets) point additions in ecc_mul_multi_pippenger(), where nwindows = 64/c + 1 and nbuckets = 2^(c-1)
+    unsigned int j, c = 2, cost, best = (unsigned int)-1;
+
+    for (j = 2; j <= 16; j++) {
+        cost = (64/j + 1)*(nentries + (1 << j));
+        if (cost < best) {
+            best = cost;
+            c = j;
+        }
+    }
+    return c;
+}
+
+
+static size_t ecc_mul_multi_straus_workspace_size(unsigned int npoints)
+{ // Workspace size of ecc_mul_multi_straus(): the precomputed tables and the digits of the 4*npoints sub-scalars and of the 4 sub-scalars of k
+    return WORKSPACE_ALIGN(4*(size_t)npoints*NPOINTS_DOUBLEMUL_WQ*sizeof(point_extproj_precomp_t)) + WORKSPACE_ALIGN(4*((size_t)npoints+1)*65*sizeof(int));
+}
+
+
+static size_t ecc_mul_multi_pippenger_workspace_size(unsigned int npoints)
+{ // Workspace size of ecc_mul_multi_pippenger(), including the 4 entries of the generator: the entries, their digits and the buckets
+    unsigned int nentries = 4*npoints + 4, c = pippenger_window(nentries), nwindows = 64/c + 1, nbuckets = 1 << (c-1);
+
+    return WORKSPACE_ALIGN((size_t)nentries*sizeof(point_extproj_precomp_t)) + WORKSPACE_ALIGN((size_t)nentries*nwindows*sizeof(int)) + 
+           WORKSPACE_ALIGN((size_t)nbuckets*sizeof(point_extproj)) + WORKSPACE_ALIGN((size_t)nbuckets*sizeof(bool));
+}
+
+
+static void signed_window_recode(uint64_t scalar, unsigned int c, unsigned int nwindows, int* digits)
+{ // Recoding of a 64-bit sub-scalar into "nwindows" signed digits in [-2^(c-1), 2^(c-1)], such that scalar = sum digits[i]*2^(c*i).
+  // Requires nwindows*c > 64.
+    unsigned int i;
+    int digit, carry = 0, half = 1 << (c-1);
+    uint64_t mask = ((uint64_t)1 << c) - 1;
+
+    for (i = 0; i < nwindows; i++) {
+        digit = (int)(scalar & mask) + carry;
+        scalar >>= c;
+        carry = (digit > half);
+        digits[i] = digit - (carry << c);
+    }
+}
+
+
+static bool ecc_mul_multi_straus(digit_t* k, point_t* Q, digit_t* l, unsigned int npoints, point_extproj_t T, unsigned char* workspace)
+{ // Multi-scalar multiplication T = k*G + l_0*Q_0 + ... + l_(npoints-1)*Q_(npoints-1) using wNAF with interleaving (Straus' method), where G is the generator. 
+  // The term k*G is computed with DOUBLE_SCALAR_TABLE, and it is skipped if k = NULL.
+  // The tables and digits are stored in "workspace", 64-byte aligned with ecc_mul_multi_straus_workspace_size(npoints) bytes.
+  // Output: T = (X,Y,Z,Ta,Tb), where T = Ta*Tb, corresponding to (X:Y:Z:T) in extended twisted Edwards coordinates.
+    unsigned int position, j, m;
+    int i, digit, (*digits_k)[65], (*digits_l)[65];
+    point_precomp_t V;
+    point_extproj_t Q1, Q2, Q3, Q4;
+    point_extproj_precomp_t U, (*Q_tables)[NPOINTS_DOUBLEMUL_WQ];
+    uint64_t scalars[4];
+
+    Q_tables = (point_extproj_precomp_t(*)[NPOINTS_DOUBLEMUL_WQ])workspace_take(&workspace, 4*(size_t)npoints*sizeof(Q_tables[0]));
+    digits_l = (int(*)[65])workspace_take(&workspace, 4*((size_t)npoints+1)*sizeof(digits_l[0]));
+    digits_k = &digits_l[4*npoints];
+
+    for (j = 0; j < npoints; j++) {
+        point_setup(Q[j], Q1);                                 // Convert to representation (X,Y,1,Ta,Tb)
+        if (ecc_point_validate(Q1) == false) {                 // Check if point lies on the curve
+            return false;
+        }
+
+        decompose((uint64_t*)&l[j*NWORDS_ORDER], scalars);     // Scalar decomposition and recoding
+        memset(digits_l[4*j], 0, 4*sizeof(digits_l[0]));       // wNAF_recode() does not write the digits above the most significant one
+        for (m = 0; m < 4; m++) {
+            wNAF_recode(scalars[m], WQ_DOUBLEBASE, digits_l[4*j+m]);
+        }
+
+        ecccopy(Q1, Q2);                                       // Computing endomorphisms over point Q_j
+        ecc_phi(Q2);
+        ecccopy(Q1, Q3);
+        ecc_psi(Q3);
+        ecccopy(Q2, Q4);
+        ecc_psi(Q4);
+        ecc_precomp_double(Q1, Q_tables[4*j], NPOINTS_DOUBLEMUL_WQ);    // Precomputation
+        ecc_precomp_double(Q2, Q_tables[4*j+1], NPOINTS_DOUBLEMUL_WQ);
+        ecc_precomp_double(Q3, Q_tables[4*j+2], NPOINTS_DOUBLEMUL_WQ);
+        ecc_precomp_double(Q4, Q_tables[4*j+3], NPOINTS_DOUBLEMUL_WQ);
+    }
+
+    memset(digits_k, 0, 4*sizeof(digits_k[0]));                 // The digits of k are zero if k = NULL
+    if (k != NULL) {
+        decompose((uint64_t*)k, scalars);
+        for (m = 0; m < 4; m++) {
+            wNAF_recode(scalars[m], WP_DOUBLEBASE, digits_k[m]);
+        }
+    }
+
+    fp2zero1271(T->x);                                         // Initialize T as the neutral point (0:1:1)
+    fp2zero1271(T->y); T->y[0][0] = 1;
+    fp2zero1271(T->z); T->z[0][0] = 1;
+
+    for (i = 64; i >= 0; i--)
+    {
+        eccdouble(T);                                          // Double (X_T,Y_T,Z_T,Ta_T,Tb_T) = 2(X_T,Y_T,Z_T,Ta_T,Tb_T)
+
+        for (j = 0; j < 4*npoints; j++) {
+            digit = digits_l[j][i];
+            if (digit < 0) {
+                position = (-digit)/2;
+                eccneg_extproj_precomp(Q_tables[j][position], U);
+                eccadd(U, T);
+            } else if (digit > 0) {
+                position = digit/2;
+                eccadd(Q_tables[j][position], T);
+            }
+        }
+
+        for (m = 0; m < 4; m++) {
+            digit = digits_k[m][i];
+            if (digit < 0) {
+                position = (-digit)/2;
+                eccneg_precomp(((point_precomp_t*)&DOUBLE_SCALAR_TABLE)[m*NPOINTS_DOUBLEMUL_WP+position], V);
+                eccmadd(V, T);
+            } else if (digit > 0) {
+                position = digit/2;
+                eccmadd(((point_precomp_t*)&DOUBLE_SCALAR_TABLE)[m*NPOINTS_DOUBLEMUL_WP+position], T);
+            }
+        }
+    }
+
     return true;
 }
 
 
+static bool ecc_mul_multi_pippenger(digit_t* k, point_t* Q, digit_t* l, unsigned int npoints, point_extproj_t T, unsigned char* workspace)
+{ // Multi-scalar multiplication T = k*G + l_0*Q_0 + ... + l_(npoints-1)*Q_(npoints-1) using the bucket method (Pippenger's method), where G is the generator. 
+  // Every scalar is decomposed into four 64-bit sub-scalars, which are recoded using signed digits in [-2^(c-1), 2^(c-1)] for a window width c 
+  // chosen from the number of points. The term k*G is skipped if k = NULL.
+  // The entries, digits and buckets are stored in "workspace", 64-byte aligned with ecc_mul_multi_pippenger_workspace_size(npoints) bytes.
+  // Output: T = (X,Y,Z,Ta,Tb), where T = Ta*Tb, corresponding to (X:Y:Z:T) in extended twisted Edwards coordinates.
+    unsigned int i, j, m, c, nwindows, nentries, nbuckets;
+    int w, digit, *digits;
+    bool *bucket_used, S_used, W_used, T_used = false;
+    f2elm_t dinv;
+    point_precomp V;
+    point_extproj_t Q1, Q2, Q3, Q4, S, W;
+    point_extproj_precomp_t U, *entries;
+    point_extproj *buckets;
+    uint64_t scalars[4];
+
+    nentries = 4*npoints + ((k != NULL)? 4 : 0);
+    c = pippenger_window(nentries);
+    nwindows = 64/c + 1;
+    nbuckets = 1 << (c-1);
+
+    entries = (point_extproj_precomp_t*)workspace_take(&workspace, (size_t)nentries*sizeof(point_extproj_precomp_t));
+    digits = (int*)workspace_take(&workspace, (size_t)nentries*nwindows*sizeof(int));
+    buckets = (point_extproj*)workspace_take(&workspace, (size_t)nbuckets*sizeof(point_extproj));
+    bucket_used = (bool*)workspace_take(&workspace, (size_t)nbuckets*sizeof(bool));
+
+    for (j = 0; j < npoints; j++) {
+        point_setup(Q[j], Q1);                                 // Convert to representation (X,Y,1,Ta,Tb)
+        if (ecc_point_validate(Q1) == false) {                 // Check if point lies on the curve
+            return false;
+        }
+
+        decompose((uint64_t*)&l[j*NWORDS_ORDER], scalars);     // Scalar decomposition and recoding
+        for (m = 0; m < 4; m++) {
+            signed_window_recode(scalars[m], c, nwindows, &digits[(4*j+m)*nwindows]);
+        }
+
+        ecccopy(Q1, Q2);                                       // Computing endomorphisms over point Q_j
+        ecc_phi(Q2);
+        ecccopy(Q1, Q3);
+        ecc_psi(Q3);
+        ecccopy(Q2, Q4);
+        ecc_psi(Q4);
+        R1_to_R2(Q1, entries[4*j]);                            // Converting to representation (X+Y,Y-X,2Z,2dT)
+        R1_to_R2(Q2, entries[4*j+1]);
+        R1_to_R2(Q3, entries[4*j+2]);
+        R1_to_R2(Q4, entries[4*j+3]);
+    }
+
+    if (k != NULL) {                                           // G, phi(G), psi(G) and psi(phi(G)) are the first entries of the blocks in DOUBLE_SCALAR_TABLE
+        decompose((uint64_t*)k, scalars);
+        for (m = 0; m < 4; m++) {
+            signed_window_recode(scalars[m], c, nwindows, &digits[(4*npoints+m)*nwindows]);
+            V = ((point_precomp*)&DOUBLE_SCALAR_TABLE)[m*NPOINTS_DOUBLEMUL_WP];
+            fp2copy1271(V.xy, entries[4*npoints+m]->xy);
+            fp2copy1271(V.yx, entries[4*npoints+m]->yx);
+            fp2copy1271(V.t2, entries[4*npoints+m]->t2);
+            fp2zero1271(entries[4*npoints+m]->z2); entries[4*npoints+m]->z2[0][0] = 2;
+        }
+    }
+
+    fp2copy1271((felm_t*)&PARAMETER_d, dinv);
+    fp2inv1271(dinv);
+
+    for (w = (int)nwindows-1; w >= 0; w--)
+    {
+        if (T_used == true) {
+            for (i = 0; i < c; i++) {
+                eccdouble(T);                                  // T = 2^c*T
+            }
+        }
+
+        for (i = 0; i < nbuckets; i++) {
+            bucket_used[i] = false;
+        }
+        for (j = 0; j < nentries; j++) {                       // Accumulate the entries into the buckets indexed by their digits
+            digit = digits[j*nwindows+w];
+            if (digit == 0) {
+                continue;
+            } else if (digit < 0) {
+                eccneg_extproj_precomp(entries[j], U);
+                i = (unsigned int)(-digit-1);
+            } else {
+                ecccopy_precomp(entries[j], U);
+                i = (unsigned int)(digit-1);
+            }
+            if (bucket_used[i] == true) {
+                eccadd(U, &buckets[i]);
+            } else {
+                R2_to_R1(U, dinv, &buckets[i]);
+                bucket_used[i] = true;
+            }
+        }
+
+        S_used = false;                                        // W = sum (i+1)*bucket_i, computed with the running sum S = sum_{j>=i} bucket_j
+        W_used = false;
+        for (i = nbuckets; i-- > 0; ) {
+            if (bucket_used[i] == true) {
+                if (S_used == true) {
+                    R1_to_R2(&buckets[i], U);
+                    eccadd(U, S);
+                } else {
+                    ecccopy(&buckets[i], S);
+                    S_used = true;
+                }
+            }
+            if (S_used == true) {
+                if (W_used == true) {
+                    R1_to_R2(S, U);
+                    eccadd(U, W);
+                } else {
+                    ecccopy(S, W);
+                    W_used = true;
+                }
+            }
+        }
+
+        if (W_used == true) {                                  // T = T+W
+            if (T_used == true) {
+                R1_to_R2(W, U);
+                eccadd(U, T);
+            } else {
+                ecccopy(W, T);
+                T_used = true;
+            }
+        }
+    }
+
+    if (T_used == false) {                                     // Output the neutral point (0:1:1)
+        fp2zero1271(T->x);
+        fp2zero1271(T->y); T->y[0][0] = 1;
+        fp2zero1271(T->z); T->z[0][0] = 1;
+    }
+
+    return true;
+}
+
+#endif
+
+
+size_t ecc_mul_double_multi_workspace_size(unsigned int npoints)
+{ // Size in bytes of the workspace used by ecc_mul_double_multi_workspace() for up to npoints points, with or without the term k*G.
+  // The size for the bucket method does not grow monotonically with the number of points (the window width changes), so the maximum over
+  // all the numbers of points is taken. It includes 64 bytes to align a workspace at any address. The build without endomorphisms does not use a workspace.
+#if (USE_ENDO == true)
+    size_t size, max;
+    unsigned int j;
+
+    max = ecc_mul_multi_straus_workspace_size((npoints < NPOINTS_MULTI_PIPPENGER)? npoints : NPOINTS_MULTI_PIPPENGER-1);
+    for (j = NPOINTS_MULTI_PIPPENGER; j <= npoints; j++) {
+        size = ecc_mul_multi_pippenger_workspace_size(j);
+        if (size > max) {
+            max = size;
+        }
+    }
+    return max + 64;
+#else
+    (void)npoints;
+    return 0;
+#endif
+}
+
+
+bool ecc_mul_double_multi_workspace(digit_t* k, point_t* Q, digit_t* l, unsigned int npoints, point_t R, void* Workspace, size_t SizeWorkspace)
+{ // Multi-scalar multiplication R = k*G + l_0*Q_0 + ... + l_(npoints-1)*Q_(npoints-1), where G is the generator. The term k*G is skipped if k = NULL.
+  // Inputs: array Q with npoints points in affine coordinates,
+  //         scalar "k" and scalars "l_i" in [0, 2^256-1], where the "l_i" are stored consecutively in "l" using NWORDS_ORDER digits each,
+  //         Workspace with SizeWorkspace bytes, at least ecc_mul_double_multi_workspace_size(npoints). Its contents are overwritten.
+  // Output: R in affine coordinates (x,y).
+  // The function uses wNAF with interleaving (Straus' method) if npoints < NPOINTS_MULTI_PIPPENGER, and the bucket method (Pippenger's method)
+  // otherwise, in both cases over the 4-dimensional decomposition of every scalar.
+  // It returns false if a point Q_i does not lie on the curve or if the workspace is too small.
+
+    // SECURITY NOTE: this function is intended for non-constant-time operations such as batch signature verification.
+
+    point_extproj_t T;
+
+#if (USE_ENDO == true)
+    unsigned char* workspace = (unsigned char*)Workspace + ((0 - (uintptr_t)Workspace) & 63);    // Align the workspace to 64 bytes
+    bool OK;
+
+    if (SizeWorkspace < ecc_mul_double_multi_workspace_size(npoints)) {
+        return false;
+    }
+    if (npoints < NPOINTS_MULTI_PIPPENGER) {
+        OK = ecc_mul_multi_straus(k, Q, l, npoints, T, workspace);
+    } else {
+        OK = ecc_mul_multi_pippenger(k, Q, l, npoints, T, workspace);
+    }
+    if (OK == false) {
+        return false;
+    }
+
+#else
+    point_t A;
+    point_extproj_t TT;
+    point_extproj_precomp_t S;
+    unsigned int j;
+
+    (void)Workspace; (void)SizeWorkspace;
+
+    fp2zero1271(T->x);                                         // Initialize T as the neutral point (0:1:1:0)
+    fp2zero1271(T->y); T->y[0][0] = 1;
+    fp2zero1271(T->z); T->z[0][0] = 1;
+    fp2zero1271(T->ta);
+    fp2copy1271(T->y, T->tb);
+
+    if (k != NULL) {
+        ecc_mul_fixed(k, A);
+        point_setup(A, T);
+    }
+
+    for (j = 0; j < npoints; j++) {
+        if (ecc_mul(Q[j], &l[j*NWORDS_ORDER], A, false) == false) {
+            return false;
+        }
+        point_setup(A, TT);
+        R1_to_R2(TT, S);
+        eccadd(S, T);
+    }
+#endif
+    eccnorm(T, R);                                             // Output R = (x,y)
+
+    return true;
+}
+
+
+#if !defined(FOURQ_NO_MALLOC)
+
+bool ecc_mul_double_multi(digit_t* k, point_t* Q, digit_t* l, unsigned int npoints, point_t R)
+{ // Multi-scalar multiplication R = k*G + l_0*Q_0 + ... + l_(npoints-1)*Q_(npoints-1), where G is the generator, using a workspace allocated on the heap
+  // (see ecc_mul_double_multi_workspace()). It returns false if a point Q_i does not lie on the curve or if memory allocation fails.
+    size_t size = ecc_mul_double_multi_workspace_size(npoints);
+    void* workspace = NULL;
+    bool OK;
+
+    if (size != 0) {
+        workspace = malloc(size);
+        if (workspace == NULL) {
+            return false;
+        }
+    }
+    OK = ecc_mul_double_multi_workspace(k, Q, l, npoints, R, workspace, size);
+    free(workspace);
+
+    return OK;
+}
+
+
+bool ecc_mul_multi(point_t* P, digit_t* k, unsigned int npoints, point_t Q)
+{ // Multi-scalar multiplication Q = k_0*P_0 + ... + k_(npoints-1)*P_(npoints-1)
+  // Inputs: array P with npoints points in affine coordinates,
+  //         scalars "k_i" in [0, 2^256-1], stored consecutively in "k" using NWORDS_ORDER digits each.
+  // Output: Q in affine coordinates (x,y).
+  // This function performs point validation. It returns false if a point P_i does not lie on the curve or if memory allocation fails.
+
+    // SECURITY NOTE: this function is intended for non-constant-time operations on public scalars.
+
+    return ecc_mul_double_multi(NULL, P, k, npoints, Q);
+}
+
+#endif
+
+
+size_t ecc_mul_multi_workspace_size(unsigned int npoints)
+{ // Size in bytes of the workspace used by ecc_mul_multi_workspace() for up to npoints points
+    return ecc_mul_double_multi_workspace_size(npoints);
+}
+
+
+bool ecc_mul_multi_workspace(point_t* P, digit_t* k, unsigned int npoints, point_t Q, void* Workspace, size_t SizeWorkspace)
+{ // Multi-scalar multiplication Q = k_0*P_0 + ... + k_(npoints-1)*P_(npoints-1) using a caller-provided workspace, without heap allocation.
+  // Workspace has SizeWorkspace bytes, at least ecc_mul_multi_workspace_size(npoints), and can be at any address. Its contents are overwritten.
+  // This function performs point validation. It returns false if a point P_i does not lie on the curve or if the workspace is too small.
+
+    // SECURITY NOTE: this function is intended for non-constant-time operations on public scalars.
+
+    return ecc_mul_double_multi_workspace(NULL, P, k, npoints, Q, Workspace, SizeWorkspace);
+}
+
+
 void ecc_precomp_double(point_extproj_t P, point_extproj_precomp_t* Table, unsigned int npoints)
 { // Generation of the precomputation table used internally by the double scalar multiplication function ecc_mul_double().  
   // Inputs: point P in representation (X,Y,Z,Ta,Tb),
@@ -688,6 +1505,8 @@ void ecc_precomp_double(point_extproj_t P, point_extproj_precomp_t* Table, unsig
 
 void wNAF_recode(uint64_t scalar, unsigned int w, int* digits)
 { // Computes wNAF recoding of a scalar, where digits are in set {0,+-1,+-3,...,+-(2^(w-1)-1)}
+  // A 64-bit scalar produces at most 65 digits for any window w in [2, 30]. The digit +-j is the multiple j*P, stored at position j/2 in the tables of odd 
+  // multiples of ecc_mul_double(), which have 2^(w-2) points (e.g., the mini-tables of DOUBLE_SCALAR_TABLE for w = WP_DOUBLEBASE).
     unsigned int i;
     int digit, index = 0; 
     int val1 = (int)(1 << (w-1)) - 1;                  // 2^(w-1) - 1
@@ -12,6 +12,7 @@
 ************************************************************************************/
 
 #include "FourQ_internal.h"
+#include <string.h>
 
 
 #if (USE_ENDO == false)
@@ -107,6 +108,12 @@ void cofactor_clearing(point_extproj_t P)
 }
 
 
+typedef struct {                                               // Working set of ecc_mul()
+    point_extproj_precomp_t Table[NPOINTS_VARBASE];
+    unsigned int digits[t_VARBASE+1], sign_masks[t_VARBASE+1];
+} ecc_mul_set;
+
+
 bool ecc_mul(point_t P, digit_t* k, point_t Q, bool clear_cofactor)
 { // Scalar multiplication Q = k*P
   // Inputs: scalar "k" in [0, 2^256-1],
@@ -114,12 +121,16 @@ bool ecc_mul(point_t P, digit_t* k, point_t Q, bool clear_cofactor)
   //         clear_cofactor = 1 (TRUE) or 0 (FALSE) whether cofactor clearing is required or not, respectively.
   // Output: Q = k*P in affine coordinates (x,y).
   // This function performs point validation and (if selected) cofactor clearing.
+    WORKING_SET(ecc_mul_set, ws);
     point_extproj_t R;
-    point_extproj_precomp_t S, Table[NPOINTS_VARBASE];
-    unsigned int digits[t_VARBASE+1] = {0}, sign_masks[t_VARBASE+1] = {0};
+    point_extproj_precomp_t S, *Table = ws->Table;
+    unsigned int *digits = ws->digits, *sign_masks = ws->sign_masks;
     digit_t k_odd[NWORDS_ORDER];
     int i;
 
+    memset(ws->digits, 0, sizeof(ws->digits));
+    memset(ws->sign_masks, 0, sizeof(ws->sign_masks));
+
     point_setup(P, R);                                         // Convert to representation (X,Y,1,Ta,Tb)
 
     if (ecc_point_validate(R) == false) {                      // Check if point lies on the curve
@@ -157,4 +168,22 @@ bool ecc_mul(point_t P, digit_t* k, point_t Q, bool clear_cofactor)
     return true;
 }
 
+
+bool ecc_mul_shared(point_t* P, digit_t* k, point_t* Q, unsigned int npoints, bool clear_cofactor)
+{ // Variable-base scalar multiplication Q_i = k*P_i, for i = 0,...,npoints-1, with a single scalar k
+  // Inputs: scalar "k" in [0, 2^256-1],
+  //         points P_i = (x_i,y_i) in affine coordinates,
+  //         clear_cofactor = 1 (TRUE) or 0 (FALSE) whether cofactor clearing is required or not, respectively.
+  // Output: Q_i = k*P_i in affine coordinates (x_i,y_i).
+  // This function performs point validation and (if selected) cofactor clearing. It returns false if any of the points P_i is not on the curve.
+    unsigned int i;
+
+    for (i = 0; i < npoints; i++) {
+        if (ecc_mul(P[i], k, Q[i], clear_cofactor) == false) {
+            return false;
+        }
+    }
+    return true;
+}
+
 #endif
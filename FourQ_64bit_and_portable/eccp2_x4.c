@@ -0,0 +1,549 @@
+/***********************************************************************************
+* FourQlib: a high-performance crypto library based on the elliptic curve FourQ
+*
+*    Copyright (c) Microsoft Corporation. All rights reserved.
+*
+* Abstract: 4-way variable-base scalar multiplication using AVX2
+*
+* Four independent scalar multiplications are computed in parallel, each one in a
+* 64-bit lane of the AVX2 registers. Field elements are represented with 5 limbs in
+* radix 2^26 so that limb products can be computed with vpmuludq.
+************************************************************************************/
+
+#include "FourQ_internal.h"
+#if ((SIMD_SUPPORT == AVX2_SUPPORT) || defined(DISPATCH_SUPPORT))
+    #include <immintrin.h>
+#endif
+
+
+#if ((SIMD_SUPPORT == AVX2_SUPPORT) || defined(DISPATCH_SUPPORT)) && (USE_ENDO == true)
+
+// 4-way field elements: limb i of the element in lane j is stored in lane j of a[i], with a = sum a[i]*2^(26*i).
+// Elements are "normalized" after v4fpcarry(): limbs 0,2,3 < 2^26, limb 1 < 2^26+2^14 and limb 4 < 2^23.
+// Inputs to v4fp2mul() and v4fp2sqr() must have limbs < 3*2^26, e.g., normalized elements and sums or differences (v4fpsub2p) of two
+// normalized elements, so that all the partial products accumulate without overflowing 64 bits.
+typedef __m256i v4felm_t[5];
+typedef v4felm_t v4f2elm_t[2];
+
+typedef struct { v4f2elm_t x; v4f2elm_t y; v4f2elm_t z; v4f2elm_t ta; v4f2elm_t tb; } v4point_extproj;  // 4-way representation (X,Y,Z,Ta,Tb)
+typedef struct { v4f2elm_t xy; v4f2elm_t yx; v4f2elm_t z2; v4f2elm_t t2; } v4point_extproj_precomp;   // 4-way representation (X+Y,Y-X,2Z,2dT)
+
+#define MASK26  0x3FFFFFF
+#define MASK23  0x7FFFFF
+
+
+static __inline TARGET_AVX2 void v4fpcarry(v4felm_t a)
+{ // Carry propagation and reduction modulo p = 2^127-1, the output is normalized
+    const __m256i mask26 = _mm256_set1_epi64x(MASK26), mask23 = _mm256_set1_epi64x(MASK23);
+
+    a[1] = _mm256_add_epi64(a[1], _mm256_srli_epi64(a[0], 26)); a[0] = _mm256_and_si256(a[0], mask26);
+    a[2] = _mm256_add_epi64(a[2], _mm256_srli_epi64(a[1], 26)); a[1] = _mm256_and_si256(a[1], mask26);
+    a[3] = _mm256_add_epi64(a[3], _mm256_srli_epi64(a[2], 26)); a[2] = _mm256_and_si256(a[2], mask26);
+    a[4] = _mm256_add_epi64(a[4], _mm256_srli_epi64(a[3], 26)); a[3] = _mm256_and_si256(a[3], mask26);
+    a[0] = _mm256_add_epi64(a[0], _mm256_srli_epi64(a[4], 23)); a[4] = _mm256_and_si256(a[4], mask23);   // 2^127 = 1 mod p
+    a[1] = _mm256_add_epi64(a[1], _mm256_srli_epi64(a[0], 26)); a[0] = _mm256_and_si256(a[0], mask26);
+}
+
+
+static __inline TARGET_AVX2 void v4fpadd(v4felm_t a, v4felm_t b, v4felm_t c)
+{ // Field addition without carry propagation, c = a+b
+    unsigned int i;
+
+    for (i = 0; i < 5; i++) {
+        c[i] = _mm256_add_epi64(a[i], b[i]);
+    }
+}
+
+
+static __inline TARGET_AVX2 void v4fpsub2p(v4felm_t a, v4felm_t b, v4felm_t c)
+{ // Field subtraction without carry propagation, c = a-b+2p. Requires b normalized
+    const __m256i p2 = _mm256_set1_epi64x(2*MASK26), p2_4 = _mm256_set1_epi64x(2*MASK23);
+
+    c[0] = _mm256_sub_epi64(_mm256_add_epi64(a[0], p2), b[0]);
+    c[1] = _mm256_sub_epi64(_mm256_add_epi64(a[1], p2), b[1]);
+    c[2] = _mm256_sub_epi64(_mm256_add_epi64(a[2], p2), b[2]);
+    c[3] = _mm256_sub_epi64(_mm256_add_epi64(a[3], p2), b[3]);
+    c[4] = _mm256_sub_epi64(_mm256_add_epi64(a[4], p2_4), b[4]);
+}
+
+
+static __inline TARGET_AVX2 void v4fpsub4p(v4felm_t a, v4felm_t b, v4felm_t c)
+{ // Field subtraction without carry propagation, c = a-b+4p. Requires limbs of b < 3*2^26
+    const __m256i p4 = _mm256_set1_epi64x(4*MASK26), p4_4 = _mm256_set1_epi64x(4*MASK23);
+
+    c[0] = _mm256_sub_epi64(_mm256_add_epi64(a[0], p4), b[0]);
+    c[1] = _mm256_sub_epi64(_mm256_add_epi64(a[1], p4), b[1]);
+    c[2] = _mm256_sub_epi64(_mm256_add_epi64(a[2], p4), b[2]);
+    c[3] = _mm256_sub_epi64(_mm256_add_epi64(a[3], p4), b[3]);
+    c[4] = _mm256_sub_epi64(_mm256_add_epi64(a[4], p4_4), b[4]);
+}
+
+
+static __inline TARGET_AVX2 void v4fpmul_nocarry(v4felm_t a, v4felm_t b, v4felm_t c)
+{ // Field multiplication without carry propagation, c = a*b mod p. Output limbs are < 2^60.2 (limb 4 < 2^57.5)
+  // for input limbs < 3*2^26, and < 2^62.2 for input limbs < 6*2^26
+  // Products of limbs i+j >= 5 are folded using 2^130 = 8 mod p
+    __m256i b8_1, b8_2, b8_3, b8_4, c0, c1, c2, c3, c4;
+
+    b8_1 = _mm256_slli_epi64(b[1], 3);
+    b8_2 = _mm256_slli_epi64(b[2], 3);
+    b8_3 = _mm256_slli_epi64(b[3], 3);
+    b8_4 = _mm256_slli_epi64(b[4], 3);
+
+    c0 = _mm256_mul_epu32(a[0], b[0]);
+    c1 = _mm256_mul_epu32(a[0], b[1]);
+    c2 = _mm256_mul_epu32(a[0], b[2]);
+    c3 = _mm256_mul_epu32(a[0], b[3]);
+    c4 = _mm256_mul_epu32(a[0], b[4]);
+
+    c0 = _mm256_add_epi64(c0, _mm256_mul_epu32(a[1], b8_4));
+    c1 = _mm256_add_epi64(c1, _mm256_mul_epu32(a[1], b[0]));
+    c2 = _mm256_add_epi64(c2, _mm256_mul_epu32(a[1], b[1]));
+    c3 = _mm256_add_epi64(c3, _mm256_mul_epu32(a[1], b[2]));
+    c4 = _mm256_add_epi64(c4, _mm256_mul_epu32(a[1], b[3]));
+
+    c0 = _mm256_add_epi64(c0, _mm256_mul_epu32(a[2], b8_3));
+    c1 = _mm256_add_epi64(c1, _mm256_mul_epu32(a[2], b8_4));
+    c2 = _mm256_add_epi64(c2, _mm256_mul_epu32(a[2], b[0]));
+    c3 = _mm256_add_epi64(c3, _mm256_mul_epu32(a[2], b[1]));
+    c4 = _mm256_add_epi64(c4, _mm256_mul_epu32(a[2], b[2]));
+
+    c0 = _mm256_add_epi64(c0, _mm256_mul_epu32(a[3], b8_2));
+    c1 = _mm256_add_epi64(c1, _mm256_mul_epu32(a[3], b8_3));
+    c2 = _mm256_add_epi64(c2, _mm256_mul_epu32(a[3], b8_4));
+    c3 = _mm256_add_epi64(c3, _mm256_mul_epu32(a[3], b[0]));
+    c4 = _mm256_add_epi64(c4, _mm256_mul_epu32(a[3], b[1]));
+
+    c0 = _mm256_add_epi64(c0, _mm256_mul_epu32(a[4], b8_1));
+    c1 = _mm256_add_epi64(c1, _mm256_mul_epu32(a[4], b8_2));
+    c2 = _mm256_add_epi64(c2, _mm256_mul_epu32(a[4], b8_3));
+    c3 = _mm256_add_epi64(c3, _mm256_mul_epu32(a[4], b8_4));
+    c4 = _mm256_add_epi64(c4, _mm256_mul_epu32(a[4], b[0]));
+
+    c[0] = c0; c[1] = c1; c[2] = c2; c[3] = c3; c[4] = c4;
+}
+
+
+static __inline TARGET_AVX2 void v4fpmul(v4felm_t a, v4felm_t b, v4felm_t c)
+{ // Field multiplication, c = a*b mod p. The output is normalized
+
+    v4fpmul_nocarry(a, b, c);
+    v4fpcarry(c);
+}
+
+
+static __inline TARGET_AVX2 void v4fpsubmp(v4felm_t a, v4felm_t b, v4felm_t c, const int m)
+{ // Subtraction of products without carry propagation, c = a-b+m*2^35*p, for m = 1 or 2.
+  // Requires b to be the output of v4fpmul_nocarry() with input limbs < 3*2^26 (m = 1), or the sum of two such outputs (m = 2)
+    const __m256i mp = _mm256_set1_epi64x((uint64_t)m*((uint64_t)MASK26 << 35)), mp_4 = _mm256_set1_epi64x((uint64_t)m*((uint64_t)MASK23 << 35));
+
+    c[0] = _mm256_sub_epi64(_mm256_add_epi64(a[0], mp), b[0]);
+    c[1] = _mm256_sub_epi64(_mm256_add_epi64(a[1], mp), b[1]);
+    c[2] = _mm256_sub_epi64(_mm256_add_epi64(a[2], mp), b[2]);
+    c[3] = _mm256_sub_epi64(_mm256_add_epi64(a[3], mp), b[3]);
+    c[4] = _mm256_sub_epi64(_mm256_add_epi64(a[4], mp_4), b[4]);
+}
+
+
+static __inline TARGET_AVX2 void v4fp2add(v4f2elm_t a, v4f2elm_t b, v4f2elm_t c)
+{ // GF(p^2) addition without carry propagation, c = a+b
+    v4fpadd(a[0], b[0], c[0]);
+    v4fpadd(a[1], b[1], c[1]);
+}
+
+
+static __inline TARGET_AVX2 void v4fp2sub2p(v4f2elm_t a, v4f2elm_t b, v4f2elm_t c)
+{ // GF(p^2) subtraction without carry propagation, c = a-b+2p. Requires b normalized
+    v4fpsub2p(a[0], b[0], c[0]);
+    v4fpsub2p(a[1], b[1], c[1]);
+}
+
+
+static __inline TARGET_AVX2 void v4fp2mul(v4f2elm_t a, v4f2elm_t b, v4f2elm_t c)
+{ // GF(p^2) multiplication using Karatsuba, c = a*b in GF((2^127-1)^2). The output is normalized
+    v4felm_t t0, t1, t2, t3;
+
+    v4fpmul_nocarry(a[0], b[0], t0);       // t0 = a0*b0
+    v4fpmul_nocarry(a[1], b[1], t1);       // t1 = a1*b1
+    v4fpadd(a[0], a[1], t2);               // t2 = a0+a1
+    v4fpadd(b[0], b[1], t3);               // t3 = b0+b1
+    v4fpmul_nocarry(t2, t3, t2);           // t2 = (a0+a1)*(b0+b1)
+    v4fpsubmp(t0, t1, c[0], 1);            // c0 = a0*b0 - a1*b1
+    v4fpadd(t0, t1, t3);
+    v4fpsubmp(t2, t3, c[1], 2);            // c1 = (a0+a1)*(b0+b1) - a0*b0 - a1*b1
+    v4fpcarry(c[0]);                       // Single carry propagation per output coordinate
+    v4fpcarry(c[1]);
+}
+
+
+static __inline TARGET_AVX2 void v4fp2sqr(v4f2elm_t a, v4f2elm_t c)
+{ // GF(p^2) squaring, c = a^2 in GF((2^127-1)^2). The output is normalized
+    v4felm_t t0, t1, t2;
+
+    v4fpadd(a[0], a[1], t0);               // t0 = a0+a1
+    v4fpsub4p(a[0], a[1], t1);             // t1 = a0-a1
+    v4fpadd(a[0], a[0], t2);               // t2 = 2a0
+    v4fpmul(t2, a[1], c[1]);               // c1 = 2a0*a1
+    v4fpmul(t0, t1, c[0]);                 // c0 = (a0+a1)(a0-a1)
+}
+
+
+static __inline TARGET_AVX2 void v4eccdouble(v4point_extproj* P)
+{ // 4-way point doubling 2P, see eccdouble()
+  // Input: P = (X1:Y1:Z1) in twisted Edwards coordinates, with normalized X1, Y1 and Z1
+  // Output: 2P = (Xfinal,Yfinal,Zfinal,Tafinal,Tbfinal), where Tfinal = Tafinal*Tbfinal,
+  //         corresponding to (Xfinal:Yfinal:Zfinal:Tfinal) in extended twisted Edwards coordinates
+    v4f2elm_t t1, t2;
+
+    v4fp2sqr(P->x, t1);                    // t1 = X1^2
+    v4fp2sqr(P->y, t2);                    // t2 = Y1^2
+    v4fp2add(P->x, P->y, P->x);            // t3 = X1+Y1
+    v4fp2add(t1, t2, P->tb);               // Tbfinal = X1^2+Y1^2
+    v4fp2sub2p(t2, t1, t1);                // t1 = Y1^2-X1^2
+    v4fp2sqr(P->x, P->ta);                 // Ta = (X1+Y1)^2
+    v4fp2sqr(P->z, t2);                    // t2 = Z1^2
+    v4fpsub4p(P->ta[0], P->tb[0], P->ta[0]);   // Tafinal = 2X1*Y1 = (X1+Y1)^2-(X1^2+Y1^2)
+    v4fpsub4p(P->ta[1], P->tb[1], P->ta[1]);
+    v4fpcarry(P->ta[0]); v4fpcarry(P->ta[1]);
+    v4fp2add(t2, t2, t2);
+    v4fpsub4p(t2[0], t1[0], t2[0]);        // t2 = 2Z1^2-(Y1^2-X1^2)
+    v4fpsub4p(t2[1], t1[1], t2[1]);
+    v4fpcarry(t2[0]); v4fpcarry(t2[1]);
+    v4fp2mul(t1, P->tb, P->y);             // Yfinal = (X1^2+Y1^2)(Y1^2-X1^2)
+    v4fp2mul(t2, P->ta, P->x);             // Xfinal = 2X1*Y1*[2Z1^2-(Y1^2-X1^2)]
+    v4fp2mul(t1, t2, P->z);                // Zfinal = (Y1^2-X1^2)[2Z1^2-(Y1^2-X1^2)]
+}
+
+
+static __inline TARGET_AVX2 void v4eccadd(v4point_extproj_precomp* Q, v4point_extproj* P)
+{ // 4-way complete point addition P = P+Q or P = P+P, see eccadd()
+  // Inputs: P = (X1,Y1,Z1,Ta,Tb), where T1 = Ta*Tb, corresponding to (X1:Y1:Z1:T1) in extended twisted Edwards coordinates
+  //         Q = (X2+Y2,Y2-X2,2Z2,2dT2) corresponding to (X2:Y2:Z2:T2) in extended twisted Edwards coordinates
+  // Output: P = (Xfinal,Yfinal,Zfinal,Tafinal,Tbfinal), where Tfinal = Tafinal*Tbfinal,
+  //         corresponding to (Xfinal:Yfinal:Zfinal:Tfinal) in extended twisted Edwards coordinates
+    v4f2elm_t t1, t2, xy, yx, tt;
+
+    v4fp2add(P->x, P->y, xy);              // xy = X1+Y1
+    v4fp2sub2p(P->y, P->x, yx);            // yx = Y1-X1
+    v4fp2mul(P->ta, P->tb, tt);            // tt = T1
+    v4fp2mul(Q->t2, tt, P->ta);            // Z = 2dT2*T1 (kept in Ta)
+    v4fp2mul(Q->z2, P->z, t1);             // t1 = 2Z2*Z1
+    v4fp2mul(Q->xy, xy, P->x);             // X = (X2+Y2)(X1+Y1)
+    v4fp2mul(Q->yx, yx, P->y);             // Y = (Y2-X2)(Y1-X1)
+    v4fp2sub2p(t1, P->ta, t2);             // t2 = theta
+    v4fp2add(t1, P->ta, t1);               // t1 = alpha
+    v4fp2sub2p(P->x, P->y, P->tb);         // Tbfinal = beta
+    v4fp2add(P->x, P->y, P->ta);           // Tafinal = omega
+    v4fp2mul(P->tb, t2, P->x);             // Xfinal = beta*theta
+    v4fp2mul(t1, t2, P->z);                // Zfinal = theta*alpha
+    v4fp2mul(P->ta, t1, P->y);             // Yfinal = alpha*omega
+}
+
+
+static __inline TARGET_AVX2 void v4table_lookup_1x8(v4point_extproj_precomp* table, v4point_extproj_precomp* P, __m256i digits, __m256i sign_masks)
+{ // Constant-time 4-way table lookup to extract points represented as (X+Y,Y-X,2Z,2dT), see table_lookup_1x8()
+  // Inputs: sign_masks, digits, and table containing 8 entries, each one holding 4 points (one per lane)
+  // Output: lane j of P = sign_j*table[digit_j], where sign_j=1 if lane j of sign_masks is 0xFF...FF and sign_j=-1 if it is 0
+    const __m256i p2 = _mm256_set1_epi64x(2*MASK26), p2_4 = _mm256_set1_epi64x(2*MASK23);
+    __m256i mask, t;
+    unsigned int i, j, l;
+
+    mask = _mm256_cmpeq_epi64(digits, _mm256_setzero_si256());
+    for (j = 0; j < 2; j++) {
+        for (l = 0; l < 5; l++) {
+            P->xy[j][l] = _mm256_and_si256(table[0].xy[j][l], mask);
+            P->yx[j][l] = _mm256_and_si256(table[0].yx[j][l], mask);
+            P->z2[j][l] = _mm256_and_si256(table[0].z2[j][l], mask);
+            P->t2[j][l] = _mm256_and_si256(table[0].t2[j][l], mask);
+        }
+    }
+
+    for (i = 1; i < 8; i++) {
+        mask = _mm256_cmpeq_epi64(digits, _mm256_set1_epi64x(i));    // Lanes with digit = i select table[i]
+        for (j = 0; j < 2; j++) {
+            for (l = 0; l < 5; l++) {
+                P->xy[j][l] = _mm256_or_si256(P->xy[j][l], _mm256_and_si256(table[i].xy[j][l], mask));
+                P->yx[j][l] = _mm256_or_si256(P->yx[j][l], _mm256_and_si256(table[i].yx[j][l], mask));
+                P->z2[j][l] = _mm256_or_si256(P->z2[j][l], _mm256_and_si256(table[i].z2[j][l], mask));
+                P->t2[j][l] = _mm256_or_si256(P->t2[j][l], _mm256_and_si256(table[i].t2[j][l], mask));
+            }
+        }
+    }
+
+    for (j = 0; j < 2; j++) {              // Lanes with sign_mask = 0 select the negative (Y-X,X+Y,2Z,-2dT)
+        for (l = 0; l < 5; l++) {
+            t = P->xy[j][l];
+            P->xy[j][l] = _mm256_blendv_epi8(P->yx[j][l], t, sign_masks);
+            P->yx[j][l] = _mm256_blendv_epi8(t, P->yx[j][l], sign_masks);
+            t = _mm256_sub_epi64((l == 4)? p2_4 : p2, P->t2[j][l]);
+            P->t2[j][l] = _mm256_blendv_epi8(t, P->t2[j][l], sign_masks);
+        }
+    }
+}
+
+
+static TARGET_AVX2 void v4fp_load(felm_t* a, v4felm_t b)
+{ // Conversion of four field elements in [0, 2^127-1], one per lane, to the 4-way representation
+    uint64_t t[5][4];
+    unsigned int j;
+
+    for (j = 0; j < 4; j++) {
+        t[0][j] = a[j][0] & MASK26;
+        t[1][j] = (a[j][0] >> 26) & MASK26;
+        t[2][j] = ((a[j][0] >> 52) | (a[j][1] << 12)) & MASK26;
+        t[3][j] = (a[j][1] >> 14) & MASK26;
+        t[4][j] = a[j][1] >> 40;
+    }
+    for (j = 0; j < 5; j++) {
+        b[j] = _mm256_loadu_si256((__m256i*)t[j]);
+    }
+}
+
+
+static TARGET_AVX2 void v4fp_store(v4felm_t a, felm_t* b)
+{ // Conversion of a 4-way field element to four field elements in [0, 2^127-1], one per lane
+    uint64_t t[5][4];
+    unsigned int i, j;
+
+    v4fpcarry(a);
+    for (j = 0; j < 5; j++) {
+        _mm256_storeu_si256((__m256i*)t[j], a[j]);
+    }
+    for (j = 0; j < 4; j++) {
+        for (i = 1; i < 5; i++) {          // Limb 1 can exceed 2^26 after v4fpcarry()
+            t[i][j] += t[i-1][j] >> 26; t[i-1][j] &= MASK26;
+        }
+        t[0][j] += t[4][j] >> 23; t[4][j] &= MASK23;
+        t[1][j] += t[0][j] >> 26; t[0][j] &= MASK26;
+        b[j][0] = t[0][j] | (t[1][j] << 26) | (t[2][j] << 52);
+        b[j][1] = (t[2][j] >> 12) | (t[3][j] << 14) | (t[4][j] << 40);
+        mod1271(b[j]);
+    }
+}
+
+
+static TARGET_AVX2 void v4fp2_load(point_extproj_precomp_t* P, unsigned int offset, v4f2elm_t b)
+{ // Loads the coordinate at "offset" (in f2elm_t units) of four points, one per lane
+    felm_t t[4];
+    unsigned int i, j;
+
+    for (i = 0; i < 2; i++) {
+        for (j = 0; j < 4; j++) {
+            fpcopy1271(((f2elm_t*)P[j])[offset][i], t[j]);
+            mod1271(t[j]);
+        }
+        v4fp_load(t, b[i]);
+    }
+}
+
+
+typedef struct {                                              // Working set of ecc_mul_x4_core()
+    point_extproj_precomp_t Table[4][8];
+    v4point_extproj VR;
+    v4point_extproj_precomp VTable[8], VS;
+} ecc_mul_x4_core_set;
+
+
+static TARGET_AVX2 void ecc_mul_x4_core(point_extproj_t* R, unsigned int digits[4][65], unsigned int sign_masks[4][65])
+{ // Precomputation and main loop of the vectorized 4-way variable-base scalar multiplication, see ecc_mul_x4() and ecc_mul_x4_recoded()
+  // Inputs: points R_i = (X,Y,Z,Ta,Tb) and the recoded scalars of the four lanes
+  // Output: R_i in representation (X,Y,Z), without the final normalization
+    WORKING_SET(ecc_mul_x4_core_set, ws);
+    point_extproj_precomp_t (*Table)[8] = ws->Table, S[4];
+    v4point_extproj* VR = &ws->VR;
+    v4point_extproj_precomp *VTable = ws->VTable, *VS = &ws->VS;
+    felm_t c[4];
+    int i, j, m;
+
+    for (j = 0; j < 4; j++) {
+        ecc_precomp(R[j], Table[j]);                          // Precomputation
+    }
+
+    for (i = 0; i < 8; i++) {                                 // Conversion of the tables to the 4-way representation
+        for (j = 0; j < 4; j++) {
+            ecccopy_precomp(Table[j][i], S[j]);
+        }
+        v4fp2_load(S, 0, VTable[i].xy);
+        v4fp2_load(S, 1, VTable[i].yx);
+        v4fp2_load(S, 2, VTable[i].z2);
+        v4fp2_load(S, 3, VTable[i].t2);
+    }
+
+    // Extract initial points in (X+Y,Y-X,2Z,2dT) representation and convert them to representation (2X,2Y,2Z)
+    v4table_lookup_1x8(VTable, VS, _mm256_set_epi64x(digits[3][64], digits[2][64], digits[1][64], digits[0][64]),
+                       _mm256_set_epi64x((int)sign_masks[3][64], (int)sign_masks[2][64], (int)sign_masks[1][64], (int)sign_masks[0][64]));
+    for (m = 0; m < 2; m++) {
+        v4fpsub2p(VS->xy[m], VS->yx[m], VR->x[m]);
+        v4fpadd(VS->xy[m], VS->yx[m], VR->y[m]);
+        v4fpcarry(VR->x[m]);
+        v4fpcarry(VR->y[m]);
+        for (j = 0; j < 5; j++) {
+            VR->z[m][j] = VS->z2[m][j];
+        }
+    }
+
+    for (i = 63; i >= 0; i--)
+    {
+        v4table_lookup_1x8(VTable, VS, _mm256_set_epi64x(digits[3][i], digits[2][i], digits[1][i], digits[0][i]),    // Extract points S in (X+Y,Y-X,2Z,2dT) representation
+                           _mm256_set_epi64x((int)sign_masks[3][i], (int)sign_masks[2][i], (int)sign_masks[1][i], (int)sign_masks[0][i]));
+        v4eccdouble(VR);                                      // P = 2*P using representations (X,Y,Z,Ta,Tb) <- 2*(X,Y,Z)
+        v4eccadd(VS, VR);                                     // P = P+S using representations (X,Y,Z,Ta,Tb) <- (X,Y,Z,Ta,Tb) + (X+Y,Y-X,2Z,2dT)
+    }
+
+    for (m = 0; m < 2; m++) {                                 // Conversion to the representation (X,Y,Z) for every lane
+        v4fp_store(VR->x[m], c);
+        for (j = 0; j < 4; j++) fpcopy1271(c[j], R[j]->x[m]);
+        v4fp_store(VR->y[m], c);
+        for (j = 0; j < 4; j++) fpcopy1271(c[j], R[j]->y[m]);
+        v4fp_store(VR->z[m], c);
+        for (j = 0; j < 4; j++) fpcopy1271(c[j], R[j]->z[m]);
+    }
+
+#ifdef TEMP_ZEROING
+    clear_words((void*)VS, sizeof(v4point_extproj_precomp)/sizeof(unsigned int));
+#endif
+}
+
+
+typedef struct {                                              // Working set of ecc_mul_x4_vec() and ecc_mul_x4_recoded_vec()
+    unsigned int digits[4][65], sign_masks[4][65];
+} ecc_mul_x4_digits_set;
+
+
+static TARGET_AVX2 bool ecc_mul_x4_vec(point_t* P, digit_t* k, point_t* Q, bool clear_cofactor)
+{ // Vectorized 4-way variable-base scalar multiplication, see ecc_mul_x4()
+    WORKING_SET(ecc_mul_x4_digits_set, ws);
+    point_extproj_t R[4];
+    uint64_t scalars[NWORDS64_ORDER];
+    unsigned int (*digits)[65] = ws->digits, (*sign_masks)[65] = ws->sign_masks;
+    int j;
+
+    for (j = 0; j < 4; j++) {
+        point_setup(P[j], R[j]);                              // Convert to representation (X,Y,1,Ta,Tb)
+        decompose((uint64_t*)&k[j*NWORDS_ORDER], scalars);    // Scalar decomposition
+
+        if (ecc_point_validate(R[j]) == false) {              // Check if point lies on the curve
+            return false;
+        }
+
+        if (clear_cofactor == true) {
+            cofactor_clearing(R[j]);
+        }
+        recode(scalars, digits[j], sign_masks[j]);            // Scalar recoding
+    }
+
+    ecc_mul_x4_core(R, digits, sign_masks);
+    eccnorm_batch(R, Q, 4);                                   // Conversion to affine coordinates (x,y) using simultaneous inversion of the four Z coordinates
+
+#ifdef TEMP_ZEROING
+    clear_words((void*)digits, 4*65);
+    clear_words((void*)sign_masks, 4*65);
+#endif
+    return true;
+}
+
+
+static TARGET_AVX2 void ecc_mul_x4_recoded_vec(point_extproj_t* R, unsigned int* digits, unsigned int* sign_masks)
+{ // Vectorized 4-way variable-base scalar multiplication with a shared scalar, see ecc_mul_x4_recoded()
+    WORKING_SET(ecc_mul_x4_digits_set, ws);
+    unsigned int (*d)[65] = ws->digits, (*s)[65] = ws->sign_masks;
+    int i, j;
+
+    for (j = 0; j < 4; j++) {                                 // The recoded scalar is replicated in the four lanes
+        for (i = 0; i < 65; i++) {
+            d[j][i] = digits[i];
+            s[j][i] = sign_masks[i];
+        }
+    }
+    ecc_mul_x4_core(R, d, s);
+
+#ifdef TEMP_ZEROING
+    clear_words((void*)d, 4*65);
+    clear_words((void*)s, 4*65);
+#endif
+}
+
+#endif
+
+
+bool ecc_mul_x4(point_t* P, digit_t* k, point_t* Q, bool clear_cofactor)
+{ // 4-way variable-base scalar multiplication Q_i = k_i*P_i, for i = 0,...,3, using a 4-dimensional decomposition
+  // Inputs: scalars "k_i" in [0, 2^256-1], stored consecutively in "k" using NWORDS_ORDER digits each,
+  //         points P_i = (x_i,y_i) in affine coordinates,
+  //         clear_cofactor = 1 (TRUE) or 0 (FALSE) whether cofactor clearing is required or not, respectively.
+  // Output: Q_i = k_i*P_i in affine coordinates (x_i,y_i).
+  // This function performs point validation and (if selected) cofactor clearing. It returns false if any of the points P_i is not on the curve.
+  // With AVX2 support, the main loops of the four scalar multiplications run in parallel in the 64-bit lanes of AVX2 registers.
+  // Otherwise, it calls ecc_mul() four times. In builds with runtime dispatch, the choice depends on the selected backend (see FourQ_set_backend()).
+#if (SIMD_SUPPORT == AVX2_SUPPORT) && (USE_ENDO == true)
+    return ecc_mul_x4_vec(P, k, Q, clear_cofactor);
+#else
+    unsigned int j;
+
+#if defined(DISPATCH_SUPPORT) && (USE_ENDO == true)
+    if (FourQ_get_backend() >= FOURQ_BACKEND_AVX2) {          // Runtime dispatch: the vectorized version requires AVX2 support from the CPU
+        return ecc_mul_x4_vec(P, k, Q, clear_cofactor);
+    }
+#endif
+
+    for (j = 0; j < 4; j++) {
+        if (ecc_mul(P[j], &k[j*NWORDS_ORDER], Q[j], clear_cofactor) == false) {
+            return false;
+        }
+    }
+    return true;
+#endif
+}
+
+
+#if (USE_ENDO == true)
+
+typedef struct {                                              // Working set of ecc_mul_x4_recoded()
+    point_extproj_precomp_t Table[4][8];
+} ecc_mul_x4_recoded_set;
+
+
+void ecc_mul_x4_recoded(point_extproj_t* R, unsigned int* digits, unsigned int* sign_masks)
+{ // 4-way variable-base scalar multiplication R_i = k*R_i, for i = 0,...,3, with a single scalar k that is decomposed and recoded by the caller
+  // Inputs: "digits" and "sign_masks" computed by recode() for k,
+  //         points R_i = (X,Y,Z,Ta,Tb) in the prime-order subgroup (e.g., after cofactor clearing).
+  // Output: R_i = k*R_i in representation (X,Y,Z), without the final normalization.
+  // With AVX2 support, the four scalar multiplications run in parallel in the 64-bit lanes of AVX2 registers. Otherwise, their main loops are
+  // interleaved so that the operations of different points can overlap. In builds with runtime dispatch, the choice depends on the selected backend.
+#if (SIMD_SUPPORT == AVX2_SUPPORT)
+    ecc_mul_x4_recoded_vec(R, digits, sign_masks);
+#else
+    WORKING_SET(ecc_mul_x4_recoded_set, ws);
+    point_extproj_precomp_t (*Table)[8] = ws->Table, S;
+    unsigned int j;
+    int i;
+
+#if defined(DISPATCH_SUPPORT)
+    if (FourQ_get_backend() >= FOURQ_BACKEND_AVX2) {          // Runtime dispatch: the vectorized version requires AVX2 support from the CPU
+        ecc_mul_x4_recoded_vec(R, digits, sign_masks);
+        return;
+    }
+#endif
+
+    for (j = 0; j < 4; j++) {
+        ecc_precomp(R[j], Table[j]);                          // Precomputation
+        table_lookup_1x8(Table[j], S, digits[64], sign_masks[64]);  // Extract initial point in (X+Y,Y-X,2Z,2dT) representation
+        R2_to_R4(S, R[j]);                                    // Conversion to representation (2X,2Y,2Z)
+    }
+
+    for (i = 63; i >= 0; i--)
+    {
+        for (j = 0; j < 4; j++) {
+            table_lookup_1x8(Table[j], S, digits[i], sign_masks[i]);   // Extract point S in (X+Y,Y-X,2Z,2dT) representation
+            eccdouble(R[j]);                                  // P = 2*P using representations (X,Y,Z,Ta,Tb) <- 2*(X,Y,Z)
+            eccadd(S, R[j]);                                  // P = P+S using representations (X,Y,Z,Ta,Tb) <- (X,Y,Z,Ta,Tb) + (X+Y,Y-X,2Z,2dT)
+        }
+    }
+
+#ifdef TEMP_ZEROING
+    clear_words((void*)S, sizeof(point_extproj_precomp_t)/sizeof(unsigned int));
+#endif
+#endif
+}
+
+#endif
@@ -0,0 +1,479 @@
+/***********************************************************************************
+* FourQlib: a high-performance crypto library based on the elliptic curve FourQ
+*
+*    Copyright (c) Microsoft Corporation. All rights reserved.
+*
+* Abstract: 8-way variable-base scalar multiplication using AVX-512 IFMA
+*
+* Eight independent scalar multiplications are computed in parallel, each one in a
+* 64-bit lane of the AVX-512 registers. Field elements are represented with 3 limbs in
+* radix 2^43, and limb products are computed with vpmadd52luq/vpmadd52huq.
+************************************************************************************/
+
+#include "FourQ_internal.h"
+#if (defined(AVX512IFMA_SUPPORT) || defined(DISPATCH_SUPPORT))
+    #include <immintrin.h>
+#endif
+
+
+#if (defined(AVX512IFMA_SUPPORT) || defined(DISPATCH_SUPPORT)) && (USE_ENDO == true)
+
+// 8-way field elements: limb i of the element in lane j is stored in lane j of a[i], with a = a[0] + a[1]*2^43 + a[2]*2^86.
+// Elements are "normalized" after v8fpcarry(): limbs 0 and 2 are < 2^43 and < 2^41, resp., and limb 1 < 2^43+2^22.
+// Inputs to v8fp2mul() must have limbs < 2^47, e.g., sums or differences (v8fpsub) of a few normalized elements, and inputs
+// to v8fp2sqr() must be normalized or the sum of two normalized elements. IFMA instructions only read the 52 least significant
+// bits of each limb, and these bounds also guarantee that the 64-bit column sums in v8fpmul_nocarry() do not overflow.
+typedef __m512i v8felm_t[3];
+typedef v8felm_t v8f2elm_t[2];
+
+typedef struct { v8f2elm_t x; v8f2elm_t y; v8f2elm_t z; v8f2elm_t ta; v8f2elm_t tb; } v8point_extproj;  // 8-way representation (X,Y,Z,Ta,Tb)
+typedef struct { v8f2elm_t xy; v8f2elm_t yx; v8f2elm_t z2; v8f2elm_t t2; } v8point_extproj_precomp;   // 8-way representation (X+Y,Y-X,2Z,2dT)
+
+#define MASK43  0x7FFFFFFFFFFULL
+#define MASK41  0x1FFFFFFFFFFULL
+
+
+static __inline TARGET_AVX512IFMA void v8fpcarry(v8felm_t a)
+{ // Carry propagation and reduction modulo p = 2^127-1, the output is normalized
+    const __m512i mask43 = _mm512_set1_epi64(MASK43), mask41 = _mm512_set1_epi64(MASK41);
+
+    a[1] = _mm512_add_epi64(a[1], _mm512_srli_epi64(a[0], 43)); a[0] = _mm512_and_si512(a[0], mask43);
+    a[2] = _mm512_add_epi64(a[2], _mm512_srli_epi64(a[1], 43)); a[1] = _mm512_and_si512(a[1], mask43);
+    a[0] = _mm512_add_epi64(a[0], _mm512_srli_epi64(a[2], 41)); a[2] = _mm512_and_si512(a[2], mask41);   // 2^127 = 1 mod p
+    a[1] = _mm512_add_epi64(a[1], _mm512_srli_epi64(a[0], 43)); a[0] = _mm512_and_si512(a[0], mask43);
+}
+
+
+static __inline TARGET_AVX512IFMA void v8fpadd(v8felm_t a, v8felm_t b, v8felm_t c)
+{ // Field addition without carry propagation, c = a+b
+    c[0] = _mm512_add_epi64(a[0], b[0]);
+    c[1] = _mm512_add_epi64(a[1], b[1]);
+    c[2] = _mm512_add_epi64(a[2], b[2]);
+}
+
+
+static __inline TARGET_AVX512IFMA void v8fpsub(v8felm_t a, v8felm_t b, v8felm_t c, const unsigned int k)
+{ // Field subtraction without carry propagation, c = a-b+2^k*p. Requires limbs of b <= the limbs of 2^k*p
+    const __m512i kp = _mm512_set1_epi64(MASK43 << k), kp_2 = _mm512_set1_epi64(MASK41 << k);
+
+    c[0] = _mm512_sub_epi64(_mm512_add_epi64(a[0], kp), b[0]);
+    c[1] = _mm512_sub_epi64(_mm512_add_epi64(a[1], kp), b[1]);
+    c[2] = _mm512_sub_epi64(_mm512_add_epi64(a[2], kp_2), b[2]);
+}
+
+
+static __inline TARGET_AVX512IFMA void v8fpmul_nocarry(v8felm_t a, v8felm_t b, v8felm_t c)
+{ // Field multiplication without carry propagation, c = a*b mod p. Output limbs are < 2^59.1 for input limbs < 2^48
+  // Column k collects the low halves of the products a[i]*b[j] with i+j = k and the high halves (at weight 2^52) with i+j = k-1.
+  // Columns 3, 4 and 5 are folded into columns 0, 1 and 2 using 2^129 = 4 mod p
+    __m512i lo0, lo1, lo2, lo3, lo4, hi0, hi1, hi2, hi3, hi4;
+    const __m512i zero = _mm512_setzero_si512();
+
+    lo0 = _mm512_madd52lo_epu64(zero, a[0], b[0]);
+    hi0 = _mm512_madd52hi_epu64(zero, a[0], b[0]);
+    lo1 = _mm512_madd52lo_epu64(zero, a[0], b[1]);
+    hi1 = _mm512_madd52hi_epu64(zero, a[0], b[1]);
+    lo2 = _mm512_madd52lo_epu64(zero, a[0], b[2]);
+    hi2 = _mm512_madd52hi_epu64(zero, a[0], b[2]);
+    lo1 = _mm512_madd52lo_epu64(lo1, a[1], b[0]);
+    hi1 = _mm512_madd52hi_epu64(hi1, a[1], b[0]);
+    lo2 = _mm512_madd52lo_epu64(lo2, a[1], b[1]);
+    hi2 = _mm512_madd52hi_epu64(hi2, a[1], b[1]);
+    lo3 = _mm512_madd52lo_epu64(zero, a[1], b[2]);
+    hi3 = _mm512_madd52hi_epu64(zero, a[1], b[2]);
+    lo2 = _mm512_madd52lo_epu64(lo2, a[2], b[0]);
+    hi2 = _mm512_madd52hi_epu64(hi2, a[2], b[0]);
+    lo3 = _mm512_madd52lo_epu64(lo3, a[2], b[1]);
+    hi3 = _mm512_madd52hi_epu64(hi3, a[2], b[1]);
+    lo4 = _mm512_madd52lo_epu64(zero, a[2], b[2]);
+    hi4 = _mm512_madd52hi_epu64(zero, a[2], b[2]);
+
+    // High halves have weight 2^52 = 2^9*2^43 relative to their column
+    lo1 = _mm512_add_epi64(lo1, _mm512_slli_epi64(hi0, 9));
+    lo2 = _mm512_add_epi64(lo2, _mm512_slli_epi64(hi1, 9));
+    lo3 = _mm512_add_epi64(lo3, _mm512_slli_epi64(hi2, 9));
+    lo4 = _mm512_add_epi64(lo4, _mm512_slli_epi64(hi3, 9));
+
+    c[0] = _mm512_add_epi64(lo0, _mm512_slli_epi64(lo3, 2));
+    c[1] = _mm512_add_epi64(lo1, _mm512_slli_epi64(lo4, 2));
+    c[2] = _mm512_add_epi64(lo2, _mm512_slli_epi64(hi4, 11));
+}
+
+
+static __inline TARGET_AVX512IFMA void v8fpmul(v8felm_t a, v8felm_t b, v8felm_t c)
+{ // Field multiplication, c = a*b mod p. The output is normalized
+
+    v8fpmul_nocarry(a, b, c);
+    v8fpcarry(c);
+}
+
+
+static __inline TARGET_AVX512IFMA void v8fp2add(v8f2elm_t a, v8f2elm_t b, v8f2elm_t c)
+{ // GF(p^2) addition without carry propagation, c = a+b
+    v8fpadd(a[0], b[0], c[0]);
+    v8fpadd(a[1], b[1], c[1]);
+}
+
+
+static __inline TARGET_AVX512IFMA void v8fp2sub(v8f2elm_t a, v8f2elm_t b, v8f2elm_t c, const unsigned int k)
+{ // GF(p^2) subtraction without carry propagation, c = a-b+2^k*p
+    v8fpsub(a[0], b[0], c[0], k);
+    v8fpsub(a[1], b[1], c[1], k);
+}
+
+
+static __inline TARGET_AVX512IFMA void v8fp2mul(v8f2elm_t a, v8f2elm_t b, v8f2elm_t c)
+{ // GF(p^2) multiplication using Karatsuba, c = a*b in GF((2^127-1)^2). The output is normalized
+    v8felm_t t0, t1, t2, t3;
+
+    v8fpmul_nocarry(a[0], b[0], t0);       // t0 = a0*b0
+    v8fpmul_nocarry(a[1], b[1], t1);       // t1 = a1*b1
+    v8fpadd(a[0], a[1], t2);               // t2 = a0+a1
+    v8fpadd(b[0], b[1], t3);               // t3 = b0+b1
+    v8fpmul_nocarry(t2, t3, t2);           // t2 = (a0+a1)*(b0+b1)
+    v8fpsub(t0, t1, c[0], 18);             // c0 = a0*b0 - a1*b1
+    v8fpadd(t0, t1, t3);
+    v8fpsub(t2, t3, c[1], 19);             // c1 = (a0+a1)*(b0+b1) - a0*b0 - a1*b1
+    v8fpcarry(c[0]);                       // Single carry propagation per output coordinate
+    v8fpcarry(c[1]);
+}
+
+
+static __inline TARGET_AVX512IFMA void v8fp2sqr(v8f2elm_t a, v8f2elm_t c)
+{ // GF(p^2) squaring, c = a^2 in GF((2^127-1)^2). The output is normalized
+    v8felm_t t0, t1, t2;
+
+    v8fpadd(a[0], a[1], t0);               // t0 = a0+a1
+    v8fpsub(a[0], a[1], t1, 4);            // t1 = a0-a1
+    v8fpadd(a[0], a[0], t2);               // t2 = 2a0
+    v8fpmul(t2, a[1], c[1]);               // c1 = 2a0*a1
+    v8fpmul(t0, t1, c[0]);                 // c0 = (a0+a1)(a0-a1)
+}
+
+
+static __inline TARGET_AVX512IFMA void v8eccdouble(v8point_extproj* P)
+{ // 8-way point doubling 2P, see eccdouble()
+  // Input: P = (X1:Y1:Z1) in twisted Edwards coordinates, with normalized X1, Y1 and Z1
+  // Output: 2P = (Xfinal,Yfinal,Zfinal,Tafinal,Tbfinal), where Tfinal = Tafinal*Tbfinal,
+  //         corresponding to (Xfinal:Yfinal:Zfinal:Tfinal) in extended twisted Edwards coordinates
+    v8f2elm_t t1, t2;
+
+    v8fp2sqr(P->x, t1);                    // t1 = X1^2
+    v8fp2sqr(P->y, t2);                    // t2 = Y1^2
+    v8fp2add(P->x, P->y, P->x);            // t3 = X1+Y1
+    v8fp2add(t1, t2, P->tb);               // Tbfinal = X1^2+Y1^2
+    v8fp2sub(t2, t1, t1, 1);               // t1 = Y1^2-X1^2
+    v8fp2sqr(P->x, P->ta);                 // Ta = (X1+Y1)^2
+    v8fp2sqr(P->z, t2);                    // t2 = Z1^2
+    v8fp2sub(P->ta, P->tb, P->ta, 2);      // Tafinal = 2X1*Y1 = (X1+Y1)^2-(X1^2+Y1^2)
+    v8fp2add(t2, t2, t2);
+    v8fp2sub(t2, t1, t2, 3);               // t2 = 2Z1^2-(Y1^2-X1^2)
+    v8fp2mul(t1, P->tb, P->y);             // Yfinal = (X1^2+Y1^2)(Y1^2-X1^2)
+    v8fp2mul(t2, P->ta, P->x);             // Xfinal = 2X1*Y1*[2Z1^2-(Y1^2-X1^2)]
+    v8fp2mul(t1, t2, P->z);                // Zfinal = (Y1^2-X1^2)[2Z1^2-(Y1^2-X1^2)]
+}
+
+
+static __inline TARGET_AVX512IFMA void v8eccadd(v8point_extproj_precomp* Q, v8point_extproj* P)
+{ // 8-way complete point addition P = P+Q or P = P+P, see eccadd()
+  // Inputs: P = (X1,Y1,Z1,Ta,Tb), where T1 = Ta*Tb, corresponding to (X1:Y1:Z1:T1) in extended twisted Edwards coordinates
+  //         Q = (X2+Y2,Y2-X2,2Z2,2dT2) corresponding to (X2:Y2:Z2:T2) in extended twisted Edwards coordinates
+  // Output: P = (Xfinal,Yfinal,Zfinal,Tafinal,Tbfinal), where Tfinal = Tafinal*Tbfinal,
+  //         corresponding to (Xfinal:Yfinal:Zfinal:Tfinal) in extended twisted Edwards coordinates
+    v8f2elm_t t1, t2, xy, yx, tt;
+
+    v8fp2add(P->x, P->y, xy);              // xy = X1+Y1
+    v8fp2sub(P->y, P->x, yx, 1);           // yx = Y1-X1
+    v8fp2mul(P->ta, P->tb, tt);            // tt = T1
+    v8fp2mul(Q->t2, tt, P->ta);            // Z = 2dT2*T1 (kept in Ta)
+    v8fp2mul(Q->z2, P->z, t1);             // t1 = 2Z2*Z1
+    v8fp2mul(Q->xy, xy, P->x);             // X = (X2+Y2)(X1+Y1)
+    v8fp2mul(Q->yx, yx, P->y);             // Y = (Y2-X2)(Y1-X1)
+    v8fp2sub(t1, P->ta, t2, 1);            // t2 = theta
+    v8fp2add(t1, P->ta, t1);               // t1 = alpha
+    v8fp2sub(P->x, P->y, P->tb, 1);        // Tbfinal = beta
+    v8fp2add(P->x, P->y, P->ta);           // Tafinal = omega
+    v8fp2mul(P->tb, t2, P->x);             // Xfinal = beta*theta
+    v8fp2mul(t1, t2, P->z);                // Zfinal = theta*alpha
+    v8fp2mul(P->ta, t1, P->y);             // Yfinal = alpha*omega
+}
+
+
+static __inline TARGET_AVX512IFMA void v8table_lookup_1x8(v8point_extproj_precomp* table, v8point_extproj_precomp* P, __m512i digits, __mmask8 sign_masks)
+{ // Constant-time 8-way table lookup to extract points represented as (X+Y,Y-X,2Z,2dT), see table_lookup_1x8()
+  // Inputs: sign_masks, digits, and table containing 8 entries, each one holding 8 points (one per lane)
+  // Output: lane j of P = sign_j*table[digit_j], where sign_j=1 if bit j of sign_masks is 1 and sign_j=-1 if it is 0
+    const __m512i p2 = _mm512_set1_epi64(MASK43 << 1), p2_2 = _mm512_set1_epi64(MASK41 << 1);
+    __mmask8 mask;
+    __m512i t;
+    unsigned int i, j, l;
+
+    for (j = 0; j < 2; j++) {
+        for (l = 0; l < 3; l++) {
+            P->xy[j][l] = table[0].xy[j][l];
+            P->yx[j][l] = table[0].yx[j][l];
+            P->z2[j][l] = table[0].z2[j][l];
+            P->t2[j][l] = table[0].t2[j][l];
+        }
+    }
+
+    for (i = 1; i < 8; i++) {
+        mask = _mm512_cmpeq_epi64_mask(digits, _mm512_set1_epi64(i));    // Lanes with digit = i select table[i]
+        for (j = 0; j < 2; j++) {
+            for (l = 0; l < 3; l++) {
+                P->xy[j][l] = _mm512_mask_blend_epi64(mask, P->xy[j][l], table[i].xy[j][l]);
+                P->yx[j][l] = _mm512_mask_blend_epi64(mask, P->yx[j][l], table[i].yx[j][l]);
+                P->z2[j][l] = _mm512_mask_blend_epi64(mask, P->z2[j][l], table[i].z2[j][l]);
+                P->t2[j][l] = _mm512_mask_blend_epi64(mask, P->t2[j][l], table[i].t2[j][l]);
+            }
+        }
+    }
+
+    for (j = 0; j < 2; j++) {              // Lanes with sign bit 0 select the negative (Y-X,X+Y,2Z,-2dT)
+        for (l = 0; l < 3; l++) {
+            t = P->xy[j][l];
+            P->xy[j][l] = _mm512_mask_blend_epi64(sign_masks, P->yx[j][l], t);
+            P->yx[j][l] = _mm512_mask_blend_epi64(sign_masks, t, P->yx[j][l]);
+            t = _mm512_sub_epi64((l == 2)? p2_2 : p2, P->t2[j][l]);
+            P->t2[j][l] = _mm512_mask_blend_epi64(sign_masks, t, P->t2[j][l]);
+        }
+    }
+}
+
+
+static TARGET_AVX512IFMA void v8fp_load(felm_t* a, v8felm_t b)
+{ // Conversion of eight field elements in [0, 2^127-1], one per lane, to the 8-way representation
+    uint64_t t[3][8];
+    unsigned int j;
+
+    for (j = 0; j < 8; j++) {
+        t[0][j] = a[j][0] & MASK43;
+        t[1][j] = ((a[j][0] >> 43) | (a[j][1] << 21)) & MASK43;
+        t[2][j] = a[j][1] >> 22;
+    }
+    for (j = 0; j < 3; j++) {
+        b[j] = _mm512_loadu_si512((__m512i*)t[j]);
+    }
+}
+
+
+static TARGET_AVX512IFMA void v8fp_store(v8felm_t a, felm_t* b)
+{ // Conversion of an 8-way field element to eight field elements in [0, 2^127-1], one per lane
+    uint64_t t[3][8];
+    unsigned int j;
+
+    v8fpcarry(a);
+    for (j = 0; j < 3; j++) {
+        _mm512_storeu_si512((__m512i*)t[j], a[j]);
+    }
+    for (j = 0; j < 8; j++) {              // Limb 1 can exceed 2^43 after v8fpcarry()
+        t[2][j] += t[1][j] >> 43; t[1][j] &= MASK43;
+        t[0][j] += t[2][j] >> 41; t[2][j] &= MASK41;
+        t[1][j] += t[0][j] >> 43; t[0][j] &= MASK43;
+        b[j][0] = t[0][j] | (t[1][j] << 43);
+        b[j][1] = (t[1][j] >> 21) | (t[2][j] << 22);
+        mod1271(b[j]);
+    }
+}
+
+
+static TARGET_AVX512IFMA void v8fp2_load(point_extproj_precomp_t* P, unsigned int offset, v8f2elm_t b)
+{ // Loads the coordinate at "offset" (in f2elm_t units) of eight points, one per lane
+    felm_t t[8];
+    unsigned int i, j;
+
+    for (i = 0; i < 2; i++) {
+        for (j = 0; j < 8; j++) {
+            fpcopy1271(((f2elm_t*)P[j])[offset][i], t[j]);
+            mod1271(t[j]);
+        }
+        v8fp_load(t, b[i]);
+    }
+}
+
+
+typedef struct {                                              // Working set of ecc_mul_x8_core()
+    point_extproj_precomp_t Table[8][8];
+    v8point_extproj VR;
+    v8point_extproj_precomp VTable[8], VS;
+} ecc_mul_x8_core_set;
+
+
+static TARGET_AVX512IFMA void ecc_mul_x8_core(point_extproj_t* R, unsigned int digits[8][65], unsigned int sign_masks[8][65])
+{ // Precomputation and main loop of the vectorized 8-way variable-base scalar multiplication, see ecc_mul_x8() and ecc_mul_x8_recoded()
+  // Inputs: points R_i = (X,Y,Z,Ta,Tb) and the recoded scalars of the eight lanes
+  // Output: R_i in representation (X,Y,Z), without the final normalization
+    WORKING_SET(ecc_mul_x8_core_set, ws);
+    point_extproj_precomp_t (*Table)[8] = ws->Table, S[8];
+    v8point_extproj* VR = &ws->VR;
+    v8point_extproj_precomp *VTable = ws->VTable, *VS = &ws->VS;
+    uint64_t d[8];
+    __mmask8 s;
+    felm_t c[8];
+    int i, j, m;
+
+    for (j = 0; j < 8; j++) {
+        ecc_precomp(R[j], Table[j]);                          // Precomputation
+    }
+
+    for (i = 0; i < 8; i++) {                                 // Conversion of the tables to the 8-way representation
+        for (j = 0; j < 8; j++) {
+            ecccopy_precomp(Table[j][i], S[j]);
+        }
+        v8fp2_load(S, 0, VTable[i].xy);
+        v8fp2_load(S, 1, VTable[i].yx);
+        v8fp2_load(S, 2, VTable[i].z2);
+        v8fp2_load(S, 3, VTable[i].t2);
+    }
+
+    for (i = 64; i >= 0; i--)
+    {
+        s = 0;
+        for (j = 0; j < 8; j++) {
+            d[j] = digits[j][i];
+            s |= (__mmask8)((sign_masks[j][i] & 1) << j);
+        }
+        v8table_lookup_1x8(VTable, VS, _mm512_loadu_si512((__m512i*)d), s);    // Extract points S in (X+Y,Y-X,2Z,2dT) representation
+
+        if (i == 64) {                                        // Convert the initial points to representation (2X,2Y,2Z)
+            for (m = 0; m < 2; m++) {
+                v8fpsub(VS->xy[m], VS->yx[m], VR->x[m], 1);
+                v8fpadd(VS->xy[m], VS->yx[m], VR->y[m]);
+                v8fpcarry(VR->x[m]);
+                v8fpcarry(VR->y[m]);
+                for (j = 0; j < 3; j++) {
+                    VR->z[m][j] = VS->z2[m][j];
+                }
+            }
+        } else {
+            v8eccdouble(VR);                                  // P = 2*P using representations (X,Y,Z,Ta,Tb) <- 2*(X,Y,Z)
+            v8eccadd(VS, VR);                                 // P = P+S using representations (X,Y,Z,Ta,Tb) <- (X,Y,Z,Ta,Tb) + (X+Y,Y-X,2Z,2dT)
+        }
+    }
+
+    for (m = 0; m < 2; m++) {                                 // Conversion to the representation (X,Y,Z) for every lane
+        v8fp_store(VR->x[m], c);
+        for (j = 0; j < 8; j++) fpcopy1271(c[j], R[j]->x[m]);
+        v8fp_store(VR->y[m], c);
+        for (j = 0; j < 8; j++) fpcopy1271(c[j], R[j]->y[m]);
+        v8fp_store(VR->z[m], c);
+        for (j = 0; j < 8; j++) fpcopy1271(c[j], R[j]->z[m]);
+    }
+
+#ifdef TEMP_ZEROING
+    clear_words((void*)d, 8*sizeof(uint64_t)/sizeof(unsigned int));
+    clear_words((void*)VS, sizeof(v8point_extproj_precomp)/sizeof(unsigned int));
+#endif
+}
+
+
+typedef struct {                                              // Working set of ecc_mul_x8_vec() and ecc_mul_x8_recoded_vec()
+    unsigned int digits[8][65], sign_masks[8][65];
+} ecc_mul_x8_digits_set;
+
+
+static TARGET_AVX512IFMA bool ecc_mul_x8_vec(point_t* P, digit_t* k, point_t* Q, bool clear_cofactor)
+{ // Vectorized 8-way variable-base scalar multiplication, see ecc_mul_x8()
+    WORKING_SET(ecc_mul_x8_digits_set, ws);
+    point_extproj_t R[8];
+    uint64_t scalars[NWORDS64_ORDER];
+    unsigned int (*digits)[65] = ws->digits, (*sign_masks)[65] = ws->sign_masks;
+    int j;
+
+    for (j = 0; j < 8; j++) {
+        point_setup(P[j], R[j]);                              // Convert to representation (X,Y,1,Ta,Tb)
+        decompose((uint64_t*)&k[j*NWORDS_ORDER], scalars);    // Scalar decomposition
+
+        if (ecc_point_validate(R[j]) == false) {              // Check if point lies on the curve
+            return false;
+        }
+
+        if (clear_cofactor == true) {
+            cofactor_clearing(R[j]);
+        }
+        recode(scalars, digits[j], sign_masks[j]);            // Scalar recoding
+    }
+
+    ecc_mul_x8_core(R, digits, sign_masks);
+    eccnorm_batch(R, Q, 8);                                   // Conversion to affine coordinates (x,y) using simultaneous inversion of the eight Z coordinates
+
+#ifdef TEMP_ZEROING
+    clear_words((void*)digits, 8*65);
+    clear_words((void*)sign_masks, 8*65);
+#endif
+    return true;
+}
+
+
+static TARGET_AVX512IFMA void ecc_mul_x8_recoded_vec(point_extproj_t* R, unsigned int* digits, unsigned int* sign_masks)
+{ // Vectorized 8-way variable-base scalar multiplication with a shared scalar, see ecc_mul_x8_recoded()
+    WORKING_SET(ecc_mul_x8_digits_set, ws);
+    unsigned int (*d)[65] = ws->digits, (*s)[65] = ws->sign_masks;
+    int i, j;
+
+    for (j = 0; j < 8; j++) {                                 // The recoded scalar is replicated in the eight lanes
+        for (i = 0; i < 65; i++) {
+            d[j][i] = digits[i];
+            s[j][i] = sign_masks[i];
+        }
+    }
+    ecc_mul_x8_core(R, d, s);
+
+#ifdef TEMP_ZEROING
+    clear_words((void*)d, 8*65);
+    clear_words((void*)s, 8*65);
+#endif
+}
+
+#endif
+
+
+bool ecc_mul_x8(point_t* P, digit_t* k, point_t* Q, bool clear_cofactor)
+{ // 8-way variable-base scalar multiplication Q_i = k_i*P_i, for i = 0,...,7, using a 4-dimensional decomposition
+  // Inputs: scalars "k_i" in [0, 2^256-1], stored consecutively in "k" using NWORDS_ORDER digits each,
+  //         points P_i = (x_i,y_i) in affine coordinates,
+  //         clear_cofactor = 1 (TRUE) or 0 (FALSE) whether cofactor clearing is required or not, respectively.
+  // Output: Q_i = k_i*P_i in affine coordinates (x_i,y_i).
+  // This function performs point validation and (if selected) cofactor clearing. It returns false if any of the points P_i is not on the curve.
+  // With AVX-512 IFMA support, the main loops of the eight scalar multiplications run in parallel in the 64-bit lanes of AVX-512 registers.
+  // Otherwise, it calls ecc_mul_x4() twice. In builds with runtime dispatch, the choice depends on the selected backend (see FourQ_set_backend()).
+#if defined(AVX512IFMA_SUPPORT) && (USE_ENDO == true)
+    return ecc_mul_x8_vec(P, k, Q, clear_cofactor);
+#else
+#if defined(DISPATCH_SUPPORT) && (USE_ENDO == true)
+    if (FourQ_get_backend() >= FOURQ_BACKEND_AVX512IFMA) {    // Runtime dispatch: the vectorized version requires AVX-512 IFMA support from the CPU
+        return ecc_mul_x8_vec(P, k, Q, clear_cofactor);
+    }
+#endif
+    if (ecc_mul_x4(P, k, Q, clear_cofactor) == false) {
+        return false;
+    }
+    return ecc_mul_x4(&P[4], &k[4*NWORDS_ORDER], &Q[4], clear_cofactor);
+#endif
+}
+
+
+#if (USE_ENDO == true)
+
+void ecc_mul_x8_recoded(point_extproj_t* R, unsigned int* digits, unsigned int* sign_masks)
+{ // 8-way variable-base scalar multiplication R_i = k*R_i, for i = 0,...,7, with a single scalar k that is decomposed and recoded by the caller
+  // Inputs: "digits" and "sign_masks" computed by recode() for k,
+  //         points R_i = (X,Y,Z,Ta,Tb) in the prime-order subgroup (e.g., after cofactor clearing).
+  // Output: R_i = k*R_i in representation (X,Y,Z), without the final normalization.
+  // With AVX-512 IFMA support, the eight scalar multiplications run in parallel in the 64-bit lanes of AVX-512 registers.
+  // Otherwise, it calls ecc_mul_x4_recoded() twice. In builds with runtime dispatch, the choice depends on the selected backend (see FourQ_set_backend()).
+#if defined(AVX512IFMA_SUPPORT)
+    ecc_mul_x8_recoded_vec(R, digits, sign_masks);
+#else
+#if defined(DISPATCH_SUPPORT)
+    if (FourQ_get_backend() >= FOURQ_BACKEND_AVX512IFMA) {    // Runtime dispatch: the vectorized version requires AVX-512 IFMA support from the CPU
+        ecc_mul_x8_recoded_vec(R, digits, sign_masks);
+        return;
+    }
+#endif
+    ecc_mul_x4_recoded(R, digits, sign_masks);
+    ecc_mul_x4_recoded(&R[4], digits, sign_masks);
+#endif
+}
+
+#endif
@@ -107,6 +107,125 @@ cleanup:
 }
 
 
+ECCRYPTO_STATUS PrepareECDHPublicKey(const unsigned char* PublicKey, ECDH_PreparedPublicKey* PreparedKey)
+{ // Compressed public key preparation for key exchange
+  // It decodes and validates the public key PublicKey, clears the cofactor and precomputes the comb table used by SecretAgreementPrepared()
+  // Input:  32-byte PublicKey
+  // Output: PreparedKey, which can be shared by concurrent calls to SecretAgreementPrepared()
+    point_extproj_t R;
+    ECCRYPTO_STATUS Status = ECCRYPTO_ERROR_UNKNOWN;
+
+    if ((PublicKey[15] & 0x80) != 0) {  // Is bit128(PublicKey) = 0?
+		Status = ECCRYPTO_ERROR_INVALID_PARAMETER;
+		goto cleanup;
+    }
+
+	Status = decode(PublicKey, PreparedKey->A);    // Also verifies that A is on the curve. If it is not, it fails
+	if (Status != ECCRYPTO_SUCCESS) {
+		goto cleanup;
+	}
+
+    point_setup(PreparedKey->A, R);
+    cofactor_clearing(R);
+    eccnorm(R, PreparedKey->A);
+
+    if (is_neutral_point(PreparedKey->A)) {  // A has small order, so every shared secret would be the neutral point
+		Status = ECCRYPTO_ERROR_SHARED_KEY;
+		goto cleanup;
+    }
+
+    point_setup(PreparedKey->A, R);
+    ecc_prepare_fixed(R, (point_fixedbase_t*)PreparedKey->Table);
+
+    return ECCRYPTO_SUCCESS;
+
+cleanup:
+    memset(PreparedKey, 0, sizeof(ECDH_PreparedPublicKey));
+
+    return Status;
+}
+
+
+ECCRYPTO_STATUS SecretAgreementPrepared(const unsigned char* SecretKey, const ECDH_PreparedPublicKey* PreparedKey, unsigned char* SharedSecret)
+{ // Secret agreement computation for key exchange using a prepared public key
+  // The output is the same as the output of CompressedSecretAgreement() for the public key given to PrepareECDHPublicKey(), 
+  // computed with the fixed-base comb method over the table of the prepared key. It runs in constant time with respect to SecretKey.
+  // Inputs: 32-byte SecretKey and PreparedKey generated by PrepareECDHPublicKey()
+  // Output: 32-byte SharedSecret
+    point_t A;
+    ECCRYPTO_STATUS Status = ECCRYPTO_ERROR_UNKNOWN;
+
+    ecc_mul_fixed_table((point_fixedbase_t*)PreparedKey->Table, (digit_t*)SecretKey, A);
+
+    if (is_neutral_point(A)) {  // Is output = neutral point (0,1)?
+		Status = ECCRYPTO_ERROR_SHARED_KEY;
+		goto cleanup;
+    }
+  
+	memmove(SharedSecret, (unsigned char*)A->y, 32);
+
+	return ECCRYPTO_SUCCESS;
+    
+cleanup:
+    clear_words((unsigned int*)SharedSecret, 256/(sizeof(unsigned int)*8));
+    
+    return Status;
+}
+
+
+static ECCRYPTO_STATUS KeyGenerationBatch_core(const bool compressed, unsigned char** SecretKeys, unsigned char** PublicKeys, const unsigned int NumKeys)
+{ // Batched keypair generation, processing groups of NPOINTS_FIXEDBASE_BATCH keys whose public keys are normalized with a single inversion
+  // If compressed = true, public keys are 32-byte encodings. Otherwise, they are 64-byte uncompressed points.
+    point_t P[NPOINTS_FIXEDBASE_BATCH];
+    digit_t k[NPOINTS_FIXEDBASE_BATCH*NWORDS_ORDER];
+    ECCRYPTO_STATUS Status = ECCRYPTO_ERROR_UNKNOWN;
+    unsigned int i, j, n;
+
+    for (i = 0; i < NumKeys; i += NPOINTS_FIXEDBASE_BATCH) {
+        n = (NumKeys - i < NPOINTS_FIXEDBASE_BATCH)? NumKeys - i : NPOINTS_FIXEDBASE_BATCH;
+
+        for (j = 0; j < n; j++) {
+            Status = RandomBytesFunction(SecretKeys[i+j], 32);
+            if (Status != ECCRYPTO_SUCCESS) {
+                goto cleanup;
+            }
+            memmove((unsigned char*)&k[j*NWORDS_ORDER], SecretKeys[i+j], 32);
+        }
+
+        ecc_mul_fixed_batch(k, P, n);                  // Compute public keys
+
+        for (j = 0; j < n; j++) {
+            if (compressed == true) {
+                encode(P[j], PublicKeys[i+j]);          // Encode public key
+            } else {
+                memmove(PublicKeys[i+j], (unsigned char*)P[j], 64);
+            }
+        }
+    }
+    Status = ECCRYPTO_SUCCESS;
+
+cleanup:
+    if (Status != ECCRYPTO_SUCCESS) {
+        for (i = 0; i < NumKeys; i++) {
+            clear_words((unsigned int*)SecretKeys[i], 256/(sizeof(unsigned int)*8));
+            clear_words((unsigned int*)PublicKeys[i], ((compressed == true)? 256 : 512)/(sizeof(unsigned int)*8));
+        }
+    }
+    clear_words((unsigned int*)k, NPOINTS_FIXEDBASE_BATCH*256/(sizeof(unsigned int)*8));
+
+    return Status;
+}
+
+
+ECCRYPTO_STATUS CompressedKeyGenerationBatch(unsigned char** SecretKeys, unsigned char** PublicKeys, const unsigned int NumKeys)
+{ // Batched keypair generation for key exchange. Public keys are compressed to 32 bytes
+  // It produces NumKeys keypairs as in CompressedKeyGeneration(), sharing the inversion of the final normalization among groups of keys.
+  // Outputs: NumKeys 32-byte secret keys SecretKeys[i] and 32-byte public keys PublicKeys[i]
+
+    return KeyGenerationBatch_core(true, SecretKeys, PublicKeys, NumKeys);
+}
+
+
 /*************** ECDH USING UNCOMPRESSED PUBLIC KEYS ***************/
 
 ECCRYPTO_STATUS PublicKeyGeneration(const unsigned char* SecretKey, unsigned char* PublicKey)
@@ -147,6 +266,15 @@ cleanup:
 }
 
 
+ECCRYPTO_STATUS KeyGenerationBatch(unsigned char** SecretKeys, unsigned char** PublicKeys, const unsigned int NumKeys)
+{ // Batched keypair generation for key exchange
+  // It produces NumKeys keypairs as in KeyGeneration(), sharing the inversion of the final normalization among groups of keys.
+  // Outputs: NumKeys 32-byte secret keys SecretKeys[i] and 64-byte public keys PublicKeys[i]
+
+    return KeyGenerationBatch_core(false, SecretKeys, PublicKeys, NumKeys);
+}
+
+
 ECCRYPTO_STATUS SecretAgreement(const unsigned char* SecretKey, const unsigned char* PublicKey, unsigned char* SharedSecret)
 { // Secret agreement computation for key exchange
   // The output is the y-coordinate of SecretKey*PublicKey. 
@@ -178,4 +306,180 @@ cleanup:
 	clear_words((unsigned int*)SharedSecret, 256/(sizeof(unsigned int)*8));
 
 	return Status;
-}
\ No newline at end of file
+}
+
+/*************** BATCHED ECDH ***************/
+
+static ECCRYPTO_STATUS load_public_key(const bool compressed, const unsigned char* PublicKey, point_t A)
+{ // Load a public key of the batched agreement functions into A
+  // If compressed = true, PublicKey is a 32-byte encoding, which is decoded. Otherwise, it is a 64-byte uncompressed point, which is not validated here.
+
+    if (compressed == true) {
+        if ((PublicKey[15] & 0x80) != 0) {  // Is bit128(PublicKey) = 0?
+            return ECCRYPTO_ERROR_INVALID_PARAMETER;
+        }
+        return decode(PublicKey, A);        // Also verifies that A is on the curve
+    }
+
+    if (((PublicKey[15] & 0x80) != 0) || ((PublicKey[31] & 0x80) != 0) || ((PublicKey[47] & 0x80) != 0) || ((PublicKey[63] & 0x80) != 0)) {  // Are PublicKey_x[i] and PublicKey_y[i] < 2^127?
+        return ECCRYPTO_ERROR_INVALID_PARAMETER;
+    }
+    memmove((unsigned char*)A, PublicKey, 64);
+    return ECCRYPTO_SUCCESS;
+}
+
+
+static ECCRYPTO_STATUS SecretAgreementBatch_core(const bool compressed, const unsigned char** SecretKeys, const unsigned char** PublicKeys, unsigned char** SharedSecrets, const unsigned int NumAgreements, ECCRYPTO_STATUS* Statuses)
+{ // Batched secret agreement computation, processing groups of NLANES_BATCH agreements with ecc_mul_x4() or ecc_mul_x8()
+  // If compressed = true, public keys are 32-byte encodings. Otherwise, they are 64-byte uncompressed points.
+  // Lanes with invalid public keys, and the unused lanes of the last group, are filled with the generator.
+    point_t A[NLANES_BATCH];
+    digit_t k[NLANES_BATCH*NWORDS_ORDER];
+    ECCRYPTO_STATUS Status = ECCRYPTO_SUCCESS;
+    unsigned int i, j, n;
+
+    for (i = 0; i < NumAgreements; i += NLANES_BATCH) {
+        n = (NumAgreements - i < NLANES_BATCH)? NumAgreements - i : NLANES_BATCH;
+
+        for (j = 0; j < NLANES_BATCH; j++) {
+            eccset(A[j]);
+            memset((unsigned char*)&k[j*NWORDS_ORDER], 0, 32);
+            if (j >= n) {
+                continue;
+            }
+
+            Statuses[i+j] = load_public_key(compressed, PublicKeys[i+j], A[j]);
+            if (Statuses[i+j] == ECCRYPTO_SUCCESS) {
+                memmove((unsigned char*)&k[j*NWORDS_ORDER], SecretKeys[i+j], 32);
+            } else {
+                eccset(A[j]);
+            }
+        }
+
+        if (ecc_mul_batch(A, k, A, true) == false) {  // Some uncompressed public key is not on the curve: process this group one by one
+            for (j = 0; j < n; j++) {
+                if (Statuses[i+j] == ECCRYPTO_SUCCESS) {
+                    if (compressed == true) {
+                        decode(PublicKeys[i+j], A[j]);
+                    } else {
+                        memmove((unsigned char*)A[j], PublicKeys[i+j], 64);
+                    }
+                    Statuses[i+j] = ecc_mul(A[j], &k[j*NWORDS_ORDER], A[j], true);
+                }
+            }
+        }
+
+        for (j = 0; j < n; j++) {
+            if (Statuses[i+j] == ECCRYPTO_SUCCESS && is_neutral_point(A[j])) {  // Is output = neutral point (0,1)?
+                Statuses[i+j] = ECCRYPTO_ERROR_SHARED_KEY;
+            }
+
+            if (Statuses[i+j] == ECCRYPTO_SUCCESS) {
+                memmove(SharedSecrets[i+j], (unsigned char*)A[j]->y, 32);
+            } else {
+                clear_words((unsigned int*)SharedSecrets[i+j], 256/(sizeof(unsigned int)*8));
+                if (Status == ECCRYPTO_SUCCESS) {
+                    Status = Statuses[i+j];
+                }
+            }
+        }
+    }
+
+    clear_words((unsigned int*)k, NLANES_BATCH*256/(sizeof(unsigned int)*8));
+    clear_words((unsigned int*)A, NLANES_BATCH*sizeof(point_t)/sizeof(unsigned int));
+
+    return Status;
+}
+
+
+ECCRYPTO_STATUS CompressedSecretAgreementBatch(const unsigned char** SecretKeys, const unsigned char** PublicKeys, unsigned char** SharedSecrets, const unsigned int NumAgreements, ECCRYPTO_STATUS* Statuses)
+{ // Batched secret agreement computation for key exchange using compressed, 32-byte public keys
+  // SharedSecrets[i] is the y-coordinate of SecretKeys[i]*A_i, where A_i is the decoding of PublicKeys[i].
+  // Inputs: NumAgreements 32-byte secret keys SecretKeys[i] and 32-byte public keys PublicKeys[i]
+  // Outputs: NumAgreements 32-byte shared secrets SharedSecrets[i] and individual statuses Statuses[i], which are set as in CompressedSecretAgreement().
+  //          Returns ECCRYPTO_SUCCESS if all the agreements succeed, or the first error otherwise.
+
+    return SecretAgreementBatch_core(true, SecretKeys, PublicKeys, SharedSecrets, NumAgreements, Statuses);
+}
+
+
+ECCRYPTO_STATUS SecretAgreementBatch(const unsigned char** SecretKeys, const unsigned char** PublicKeys, unsigned char** SharedSecrets, const unsigned int NumAgreements, ECCRYPTO_STATUS* Statuses)
+{ // Batched secret agreement computation for key exchange using uncompressed, 64-byte public keys
+  // SharedSecrets[i] is the y-coordinate of SecretKeys[i]*PublicKeys[i].
+  // Inputs: NumAgreements 32-byte secret keys SecretKeys[i] and 64-byte public keys PublicKeys[i]
+  // Outputs: NumAgreements 32-byte shared secrets SharedSecrets[i] and individual statuses Statuses[i], which are set as in SecretAgreement().
+  //          Returns ECCRYPTO_SUCCESS if all the agreements succeed, or the first error otherwise.
+
+    return SecretAgreementBatch_core(false, SecretKeys, PublicKeys, SharedSecrets, NumAgreements, Statuses);
+}
+
+
+static ECCRYPTO_STATUS SecretAgreementMany_core(const bool compressed, const unsigned char* SecretKey, const unsigned char** PublicKeys, unsigned char** SharedSecrets, const unsigned int NumAgreements, ECCRYPTO_STATUS* Statuses)
+{ // Secret agreement computation with a single secret key, processing groups of NPOINTS_SHARED_BATCH public keys with ecc_mul_shared()
+  // If compressed = true, public keys are 32-byte encodings. Otherwise, they are 64-byte uncompressed points.
+  // Invalid public keys are replaced with the generator.
+    point_t A[NPOINTS_SHARED_BATCH];
+    ECCRYPTO_STATUS Status = ECCRYPTO_SUCCESS;
+    unsigned int i, j, n;
+
+    for (i = 0; i < NumAgreements; i += NPOINTS_SHARED_BATCH) {
+        n = (NumAgreements - i < NPOINTS_SHARED_BATCH)? NumAgreements - i : NPOINTS_SHARED_BATCH;
+
+        for (j = 0; j < n; j++) {
+            Statuses[i+j] = load_public_key(compressed, PublicKeys[i+j], A[j]);
+            if (Statuses[i+j] != ECCRYPTO_SUCCESS) {
+                eccset(A[j]);
+            }
+        }
+
+        if (ecc_mul_shared(A, (digit_t*)SecretKey, A, n, true) == false) {  // Some uncompressed public key is not on the curve: process this group one by one
+            for (j = 0; j < n; j++) {
+                if (Statuses[i+j] == ECCRYPTO_SUCCESS) {
+                    load_public_key(compressed, PublicKeys[i+j], A[j]);
+                    Statuses[i+j] = ecc_mul(A[j], (digit_t*)SecretKey, A[j], true);
+                }
+            }
+        }
+
+        for (j = 0; j < n; j++) {
+            if (Statuses[i+j] == ECCRYPTO_SUCCESS && is_neutral_point(A[j])) {  // Is output = neutral point (0,1)?
+                Statuses[i+j] = ECCRYPTO_ERROR_SHARED_KEY;
+            }
+
+            if (Statuses[i+j] == ECCRYPTO_SUCCESS) {
+                memmove(SharedSecrets[i+j], (unsigned char*)A[j]->y, 32);
+            } else {
+                clear_words((unsigned int*)SharedSecrets[i+j], 256/(sizeof(unsigned int)*8));
+                if (Status == ECCRYPTO_SUCCESS) {
+                    Status = Statuses[i+j];
+                }
+            }
+        }
+    }
+
+    clear_words((unsigned int*)A, NPOINTS_SHARED_BATCH*sizeof(point_t)/sizeof(unsigned int));
+
+    return Status;
+}
+
+
+ECCRYPTO_STATUS CompressedSecretAgreementMany(const unsigned char* SecretKey, const unsigned char** PublicKeys, unsigned char** SharedSecrets, const unsigned int NumAgreements, ECCRYPTO_STATUS* Statuses)
+{ // Secret agreement computation for key exchange with a single secret key and many compressed, 32-byte public keys
+  // SharedSecrets[i] is the y-coordinate of SecretKey*A_i, where A_i is the decoding of PublicKeys[i]. The secret key is recoded once for all the agreements.
+  // Inputs: 32-byte SecretKey and NumAgreements 32-byte public keys PublicKeys[i]
+  // Outputs: NumAgreements 32-byte shared secrets SharedSecrets[i] and individual statuses Statuses[i], which are set as in CompressedSecretAgreement().
+  //          Returns ECCRYPTO_SUCCESS if all the agreements succeed, or the first error otherwise.
+
+    return SecretAgreementMany_core(true, SecretKey, PublicKeys, SharedSecrets, NumAgreements, Statuses);
+}
+
+
+ECCRYPTO_STATUS SecretAgreementMany(const unsigned char* SecretKey, const unsigned char** PublicKeys, unsigned char** SharedSecrets, const unsigned int NumAgreements, ECCRYPTO_STATUS* Statuses)
+{ // Secret agreement computation for key exchange with a single secret key and many uncompressed, 64-byte public keys
+  // SharedSecrets[i] is the y-coordinate of SecretKey*PublicKeys[i]. The secret key is recoded once for all the agreements.
+  // Inputs: 32-byte SecretKey and NumAgreements 64-byte public keys PublicKeys[i]
+  // Outputs: NumAgreements 32-byte shared secrets SharedSecrets[i] and individual statuses Statuses[i], which are set as in SecretAgreement().
+  //          Returns ECCRYPTO_SUCCESS if all the agreements succeed, or the first error otherwise.
+
+    return SecretAgreementMany_core(false, SecretKey, PublicKeys, SharedSecrets, NumAgreements, Statuses);
+}
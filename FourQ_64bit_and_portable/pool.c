@@ -0,0 +1,477 @@
+/***********************************************************************************
+* FourQlib: a high-performance crypto library based on the elliptic curve FourQ
+*
+*    Copyright (c) Microsoft Corporation. All rights reserved.
+*
+* Abstract: thread pool and multithreaded batch functions
+*
+* A pool has a fixed set of worker threads, each one with a deque of item ranges.
+* A batch call splits its items into one range per thread. Threads process their
+* ranges in chunks of at most POOL_CHUNK_ITEMS items from the bottom of their deque,
+* and idle threads steal ranges from the top of the other deques. The calling thread
+* takes part in the work until its batch completes.
+************************************************************************************/
+
+#include "FourQ_internal.h"
+
+#if defined(THREADS_SUPPORT)
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+
+#define POOL_DEQUE_SIZE     64            // Maximum number of ranges queued per thread
+#define POOL_CHUNK_ITEMS    16            // Maximum number of items processed at a time, before the rest of a range can be stolen
+
+
+typedef struct {
+    void (*run)(void* arg, unsigned int begin, unsigned int end);
+    void* arg;
+    unsigned int chunk;                                  // Number of items processed at a time
+    unsigned int remaining;                              // Number of items not processed yet, protected by lock
+    pthread_mutex_t lock;
+    pthread_cond_t done;
+} pool_job;
+
+typedef struct {
+    pool_job* job;
+    unsigned int begin, end;
+} pool_range;
+
+typedef struct {
+    pthread_mutex_t lock;
+    pool_range ranges[POOL_DEQUE_SIZE];
+    unsigned int top, bottom;                            // Queued ranges are ranges[top..bottom-1], modulo POOL_DEQUE_SIZE
+} pool_deque;
+
+typedef struct {
+    fourq_pool* pool;
+    unsigned int index;
+} pool_worker;
+
+struct fourq_pool {
+    unsigned int nthreads;
+    pthread_t* threads;
+    pool_worker* workers;
+    pool_deque* deques;                                  // One deque per worker thread, plus one shared by the calling threads
+    pthread_mutex_t lock;                                // Protects shutdown and the sleep of idle workers
+    pthread_cond_t wakeup;
+    unsigned int queued;                                 // Number of queued ranges, updated atomically
+    unsigned int next;                                   // Next deque that receives a range
+    int shutdown;
+};
+
+
+static bool deque_push(fourq_pool* pool, pool_deque* d, pool_range r)
+{ // Push a range to the bottom of a deque and wake up an idle worker. It returns false if the deque is full
+    bool pushed = false;
+
+    pthread_mutex_lock(&d->lock);
+    if (d->bottom - d->top < POOL_DEQUE_SIZE) {
+        d->ranges[d->bottom % POOL_DEQUE_SIZE] = r;
+        d->bottom++;
+        pushed = true;
+    }
+    pthread_mutex_unlock(&d->lock);
+
+    if (pushed == true) {
+        __sync_fetch_and_add(&pool->queued, 1);
+        pthread_mutex_lock(&pool->lock);
+        pthread_cond_signal(&pool->wakeup);
+        pthread_mutex_unlock(&pool->lock);
+    }
+    return pushed;
+}
+
+
+static bool deque_take(fourq_pool* pool, pool_deque* d, const pool_job* job, bool bottom, pool_range* r)
+{ // Take a range from the bottom (owner) or the top (thief) of a deque. If job is not NULL, only ranges of that job are taken
+    unsigned int i, j;
+    bool taken = false;
+
+    pthread_mutex_lock(&d->lock);
+    for (i = 0; i < d->bottom - d->top; i++) {
+        j = bottom ? d->bottom - 1 - i : d->top + i;
+        if (job == NULL || d->ranges[j % POOL_DEQUE_SIZE].job == job) {
+            *r = d->ranges[j % POOL_DEQUE_SIZE];
+            for (; j + 1 < d->bottom; j++) {             // Close the gap
+                d->ranges[j % POOL_DEQUE_SIZE] = d->ranges[(j + 1) % POOL_DEQUE_SIZE];
+            }
+            d->bottom--;
+            taken = true;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&d->lock);
+
+    if (taken == true) {
+        __sync_fetch_and_sub(&pool->queued, 1);
+    }
+    return taken;
+}
+
+
+static bool steal(fourq_pool* pool, unsigned int self, const pool_job* job, pool_range* r)
+{ // Steal a range from the top of the deques of the other threads
+    unsigned int i;
+
+    for (i = 1; i <= pool->nthreads; i++) {
+        if (deque_take(pool, &pool->deques[(self + i) % (pool->nthreads + 1)], job, false, r) == true) {
+            return true;
+        }
+    }
+    return false;
+}
+
+
+static void process_range(fourq_pool* pool, pool_deque* d, pool_range r)
+{ // Process the first chunk of a range and leave the rest in deque d, where it can be stolen
+    pool_job* job = r.job;
+    pool_range rest;
+
+    if (r.end - r.begin > job->chunk) {
+        rest.job = job;
+        rest.begin = r.begin + job->chunk;
+        rest.end = r.end;
+        if (deque_push(pool, d, rest) == true) {
+            r.end = rest.begin;
+        }
+    }
+
+    job->run(job->arg, r.begin, r.end);
+
+    pthread_mutex_lock(&job->lock);                      // The caller may release the job as soon as the lock is released
+    job->remaining -= r.end - r.begin;
+    if (job->remaining == 0) {
+        pthread_cond_signal(&job->done);
+    }
+    pthread_mutex_unlock(&job->lock);
+}
+
+
+static void* worker_main(void* arg)
+{ // Worker thread: process ranges from its own deque, steal from the others when it is empty, and sleep when there is no work
+    pool_worker* worker = (pool_worker*)arg;
+    fourq_pool* pool = worker->pool;
+    pool_deque* own = &pool->deques[worker->index];
+    pool_range r;
+
+    for (;;) {
+        if (deque_take(pool, own, NULL, true, &r) == true || steal(pool, worker->index, NULL, &r) == true) {
+            process_range(pool, own, r);
+            continue;
+        }
+
+        pthread_mutex_lock(&pool->lock);
+        while (__sync_fetch_and_add(&pool->queued, 0) == 0 && pool->shutdown == false) {
+            pthread_cond_wait(&pool->wakeup, &pool->lock);
+        }
+        if (pool->shutdown == true && __sync_fetch_and_add(&pool->queued, 0) == 0) {
+            pthread_mutex_unlock(&pool->lock);
+            break;
+        }
+        pthread_mutex_unlock(&pool->lock);
+    }
+    return NULL;
+}
+
+
+ECCRYPTO_STATUS fourq_pool_create(const unsigned int NumThreads, fourq_pool** Pool)
+{ // Create a pool of NumThreads worker threads. If NumThreads = 0, one thread per online CPU is created, except for one CPU
+  // that is left to the calling threads, which also process work during batch calls
+    fourq_pool* pool;
+    unsigned int i, nthreads = NumThreads;
+    long ncpus;
+
+    *Pool = NULL;
+    if (nthreads == 0) {
+        ncpus = sysconf(_SC_NPROCESSORS_ONLN);
+        nthreads = (ncpus > 1)? (unsigned int)ncpus - 1 : 1;
+    }
+
+    pool = (fourq_pool*)calloc(1, sizeof(fourq_pool));
+    if (pool == NULL) {
+        return ECCRYPTO_ERROR_NO_MEMORY;
+    }
+    pool->threads = (pthread_t*)calloc(nthreads, sizeof(pthread_t));
+    pool->workers = (pool_worker*)calloc(nthreads, sizeof(pool_worker));
+    pool->deques = (pool_deque*)calloc(nthreads + 1, sizeof(pool_deque));
+    if (pool->threads == NULL || pool->workers == NULL || pool->deques == NULL) {
+        free(pool->threads); free(pool->workers); free(pool->deques); free(pool);
+        return ECCRYPTO_ERROR_NO_MEMORY;
+    }
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->wakeup, NULL);
+    for (i = 0; i < nthreads + 1; i++) {
+        pthread_mutex_init(&pool->deques[i].lock, NULL);
+    }
+
+    for (i = 0; i < nthreads; i++) {
+        pool->workers[i].pool = pool;
+        pool->workers[i].index = i;
+        if (pthread_create(&pool->threads[i], NULL, worker_main, &pool->workers[i]) != 0) {
+            break;
+        }
+    }
+    pool->nthreads = i;
+    if (i < nthreads) {                                  // Some thread could not be created
+        fourq_pool_destroy(pool);
+        return ECCRYPTO_ERROR;
+    }
+
+    *Pool = pool;
+    return ECCRYPTO_SUCCESS;
+}
+
+
+void fourq_pool_destroy(fourq_pool* Pool)
+{ // Stop the worker threads and release the pool. There must be no batch call running on the pool
+    unsigned int i;
+
+    if (Pool == NULL) {
+        return;
+    }
+
+    pthread_mutex_lock(&Pool->lock);
+    Pool->shutdown = true;
+    pthread_cond_broadcast(&Pool->wakeup);
+    pthread_mutex_unlock(&Pool->lock);
+    for (i = 0; i < Pool->nthreads; i++) {
+        pthread_join(Pool->threads[i], NULL);
+    }
+
+    for (i = 0; i < Pool->nthreads + 1; i++) {
+        pthread_mutex_destroy(&Pool->deques[i].lock);
+    }
+    pthread_cond_destroy(&Pool->wakeup);
+    pthread_mutex_destroy(&Pool->lock);
+    free(Pool->threads);
+    free(Pool->workers);
+    free(Pool->deques);
+    free(Pool);
+}
+
+
+unsigned int fourq_pool_num_threads(const fourq_pool* Pool)
+{ // Number of worker threads of the pool
+    return (Pool == NULL)? 0 : Pool->nthreads;
+}
+
+
+void fourq_pool_for(fourq_pool* Pool, const unsigned int NumItems, const unsigned int Granularity, void (*run)(void* arg, unsigned int begin, unsigned int end), void* arg)
+{ // Run run(arg, begin, end) over consecutive ranges covering [0, NumItems), using the worker threads of Pool and the calling thread.
+  // Ranges contain a multiple of Granularity items (except for the last one) and at most POOL_CHUNK_ITEMS items, rounded up to Granularity.
+  // If Pool is NULL, all the items are processed by the calling thread
+    pool_job job;
+    pool_range r;
+    pool_deque* shared;
+    unsigned int i, nparts, part, chunk;
+
+    if (NumItems == 0) {
+        return;
+    }
+    if (Pool == NULL || Pool->nthreads == 0) {
+        run(arg, 0, NumItems);
+        return;
+    }
+
+    chunk = (NumItems + 2*(Pool->nthreads + 1) - 1) / (2*(Pool->nthreads + 1));   // At least two chunks per thread when possible
+    if (chunk > POOL_CHUNK_ITEMS) {
+        chunk = POOL_CHUNK_ITEMS;
+    }
+    chunk = ((chunk + Granularity - 1) / Granularity) * Granularity;
+    if (NumItems <= chunk) {
+        run(arg, 0, NumItems);
+        return;
+    }
+
+    job.run = run;
+    job.arg = arg;
+    job.chunk = chunk;
+    job.remaining = NumItems;
+    pthread_mutex_init(&job.lock, NULL);
+    pthread_cond_init(&job.done, NULL);
+
+    nparts = (NumItems + chunk - 1) / chunk;             // One range per thread, made of whole chunks
+    if (nparts > Pool->nthreads + 1) {
+        nparts = Pool->nthreads + 1;
+    }
+    part = (((NumItems + nparts - 1) / nparts + chunk - 1) / chunk) * chunk;
+    shared = &Pool->deques[Pool->nthreads];
+
+    r.job = &job;
+    for (i = 1; i < nparts; i++) {                       // Range 0 is kept by the calling thread
+        r.begin = i*part;
+        r.end = (i*part + part < NumItems)? i*part + part : NumItems;
+        if (r.begin >= r.end) {
+            break;
+        }
+        if (deque_push(Pool, &Pool->deques[__sync_fetch_and_add(&Pool->next, 1) % Pool->nthreads], r) == false &&
+            deque_push(Pool, shared, r) == false) {
+            process_range(Pool, shared, r);
+        }
+    }
+    r.begin = 0;
+    r.end = (part < NumItems)? part : NumItems;
+    process_range(Pool, shared, r);
+
+    while (deque_take(Pool, shared, &job, true, &r) == true || steal(Pool, Pool->nthreads, &job, &r) == true) {
+        process_range(Pool, shared, r);
+    }
+
+    pthread_mutex_lock(&job.lock);
+    while (job.remaining > 0) {
+        pthread_cond_wait(&job.done, &job.lock);
+    }
+    pthread_mutex_unlock(&job.lock);
+    pthread_cond_destroy(&job.done);
+    pthread_mutex_destroy(&job.lock);
+}
+
+
+// Multithreaded batch functions
+
+typedef struct {
+    const unsigned char** SecretKeys;
+    const unsigned char** PublicKeys;
+    const unsigned char** Messages;
+    const unsigned int* SizeMessages;
+    const unsigned char** Signatures;
+    unsigned char** Outputs;
+    unsigned int* valid;
+    ECCRYPTO_STATUS* Statuses;
+    bool compressed;
+} parallel_args;
+
+
+static ECCRYPTO_STATUS first_error(const ECCRYPTO_STATUS* Statuses, const unsigned int NumItems)
+{ // Return ECCRYPTO_SUCCESS if all the statuses are ECCRYPTO_SUCCESS, or the first error otherwise
+    unsigned int i;
+
+    for (i = 0; i < NumItems; i++) {
+        if (Statuses[i] != ECCRYPTO_SUCCESS) {
+            return Statuses[i];
+        }
+    }
+    return ECCRYPTO_SUCCESS;
+}
+
+
+static void sign_range(void* arg, unsigned int begin, unsigned int end)
+{
+    parallel_args* args = (parallel_args*)arg;
+    unsigned int i;
+
+    for (i = begin; i < end; i++) {
+        args->Statuses[i] = SchnorrQ_Sign(args->SecretKeys[i], args->PublicKeys[i], args->Messages[i], args->SizeMessages[i], args->Outputs[i]);
+    }
+}
+
+
+ECCRYPTO_STATUS SchnorrQ_SignParallel(fourq_pool* Pool, const unsigned char** SecretKeys, const unsigned char** PublicKeys, const unsigned char** Messages, const unsigned int* SizeMessages, unsigned char** Signatures, const unsigned int NumSignatures, ECCRYPTO_STATUS* Statuses)
+{ // Multithreaded SchnorrQ signature generation
+  // Signatures[i] is the output of SchnorrQ_Sign(SecretKeys[i], PublicKeys[i], Messages[i], SizeMessages[i]) and Statuses[i] its status.
+  // Returns ECCRYPTO_SUCCESS if all the signatures succeed, or the first error otherwise
+    parallel_args args = {SecretKeys, PublicKeys, Messages, SizeMessages, NULL, Signatures, NULL, Statuses, false};
+
+    fourq_pool_for(Pool, NumSignatures, 1, sign_range, &args);
+    return first_error(Statuses, NumSignatures);
+}
+
+
+static void verify_range(void* arg, unsigned int begin, unsigned int end)
+{
+    parallel_args* args = (parallel_args*)arg;
+    unsigned int i;
+
+    for (i = begin; i < end; i++) {
+        args->Statuses[i] = SchnorrQ_Verify(args->PublicKeys[i], args->Messages[i], args->SizeMessages[i], args->Signatures[i], &args->valid[i]);
+    }
+}
+
+
+ECCRYPTO_STATUS SchnorrQ_VerifyParallel(fourq_pool* Pool, const unsigned char** PublicKeys, const unsigned char** Messages, const unsigned int* SizeMessages, const unsigned char** Signatures, const unsigned int NumSignatures, unsigned int* valid, ECCRYPTO_STATUS* Statuses)
+{ // Multithreaded SchnorrQ signature verification
+  // valid[i] and Statuses[i] are the outputs of SchnorrQ_Verify(PublicKeys[i], Messages[i], SizeMessages[i], Signatures[i]).
+  // Returns ECCRYPTO_SUCCESS if all the verifications run without error, or the first error otherwise
+    parallel_args args = {NULL, PublicKeys, Messages, SizeMessages, Signatures, NULL, valid, Statuses, false};
+
+    fourq_pool_for(Pool, NumSignatures, 1, verify_range, &args);
+    return first_error(Statuses, NumSignatures);
+}
+
+
+static void keygen_range(void* arg, unsigned int begin, unsigned int end)
+{
+    parallel_args* args = (parallel_args*)arg;
+    ECCRYPTO_STATUS Status;
+    unsigned int i;
+
+    if (args->compressed == true) {
+        Status = CompressedKeyGenerationBatch((unsigned char**)args->SecretKeys + begin, args->Outputs + begin, end - begin);
+    } else {
+        Status = KeyGenerationBatch((unsigned char**)args->SecretKeys + begin, args->Outputs + begin, end - begin);
+    }
+    for (i = begin; i < end; i++) {
+        args->Statuses[i] = Status;
+    }
+}
+
+
+ECCRYPTO_STATUS CompressedKeyGenerationParallel(fourq_pool* Pool, unsigned char** SecretKeys, unsigned char** PublicKeys, const unsigned int NumKeys, ECCRYPTO_STATUS* Statuses)
+{ // Multithreaded keypair generation for key exchange. Public keys are compressed to 32 bytes
+  // Each thread generates chunks of keypairs with CompressedKeyGenerationBatch(). Statuses[i] is the status of the i-th keypair.
+  // Returns ECCRYPTO_SUCCESS if all the keypairs are generated, or the first error otherwise
+    parallel_args args = {(const unsigned char**)SecretKeys, NULL, NULL, NULL, NULL, PublicKeys, NULL, Statuses, true};
+
+    fourq_pool_for(Pool, NumKeys, NPOINTS_FIXEDBASE_BATCH, keygen_range, &args);
+    return first_error(Statuses, NumKeys);
+}
+
+
+ECCRYPTO_STATUS KeyGenerationParallel(fourq_pool* Pool, unsigned char** SecretKeys, unsigned char** PublicKeys, const unsigned int NumKeys, ECCRYPTO_STATUS* Statuses)
+{ // Multithreaded keypair generation for key exchange, with 64-byte public keys
+  // Each thread generates chunks of keypairs with KeyGenerationBatch(). Statuses[i] is the status of the i-th keypair.
+  // Returns ECCRYPTO_SUCCESS if all the keypairs are generated, or the first error otherwise
+    parallel_args args = {(const unsigned char**)SecretKeys, NULL, NULL, NULL, NULL, PublicKeys, NULL, Statuses, false};
+
+    fourq_pool_for(Pool, NumKeys, NPOINTS_FIXEDBASE_BATCH, keygen_range, &args);
+    return first_error(Statuses, NumKeys);
+}
+
+
+static void agreement_range(void* arg, unsigned int begin, unsigned int end)
+{
+    parallel_args* args = (parallel_args*)arg;
+
+    if (args->compressed == true) {
+        CompressedSecretAgreementBatch(args->SecretKeys + begin, args->PublicKeys + begin, args->Outputs + begin, end - begin, args->Statuses + begin);
+    } else {
+        SecretAgreementBatch(args->SecretKeys + begin, args->PublicKeys + begin, args->Outputs + begin, end - begin, args->Statuses + begin);
+    }
+}
+
+
+ECCRYPTO_STATUS CompressedSecretAgreementParallel(fourq_pool* Pool, const unsigned char** SecretKeys, const unsigned char** PublicKeys, unsigned char** SharedSecrets, const unsigned int NumAgreements, ECCRYPTO_STATUS* Statuses)
+{ // Multithreaded secret agreement computation for key exchange using compressed, 32-byte public keys
+  // Each thread processes chunks of agreements with CompressedSecretAgreementBatch(). SharedSecrets[i] and Statuses[i] are set as in that function.
+  // Returns ECCRYPTO_SUCCESS if all the agreements succeed, or the first error otherwise
+    parallel_args args = {SecretKeys, PublicKeys, NULL, NULL, NULL, SharedSecrets, NULL, Statuses, true};
+
+    fourq_pool_for(Pool, NumAgreements, NLANES_BATCH, agreement_range, &args);
+    return first_error(Statuses, NumAgreements);
+}
+
+
+ECCRYPTO_STATUS SecretAgreementParallel(fourq_pool* Pool, const unsigned char** SecretKeys, const unsigned char** PublicKeys, unsigned char** SharedSecrets, const unsigned int NumAgreements, ECCRYPTO_STATUS* Statuses)
+{ // Multithreaded secret agreement computation for key exchange using uncompressed, 64-byte public keys
+  // Each thread processes chunks of agreements with SecretAgreementBatch(). SharedSecrets[i] and Statuses[i] are set as in that function.
+  // Returns ECCRYPTO_SUCCESS if all the agreements succeed, or the first error otherwise
+    parallel_args args = {SecretKeys, PublicKeys, NULL, NULL, NULL, SharedSecrets, NULL, Statuses, false};
+
+    fourq_pool_for(Pool, NumAgreements, NLANES_BATCH, agreement_range, &args);
+    return first_error(Statuses, NumAgreements);
+}
+
+#endif
@@ -14,7 +14,9 @@
 #include "FourQ_params.h"
 #include "../random/random.h"
 #include "../sha512/sha512.h"
-#include <malloc.h>
+#if !defined(FOURQ_NO_MALLOC)
+    #include <stdlib.h>
+#endif
 #include <string.h>
 
 
@@ -73,82 +75,233 @@ cleanup:
 }
 
 
-ECCRYPTO_STATUS SchnorrQ_Sign(const unsigned char* SecretKey, const unsigned char* PublicKey, const unsigned char* Message, const unsigned int SizeMessage, unsigned char* Signature)
-{ // SchnorrQ signature generation
-  // It produces the signature Signature of a message Message of size SizeMessage in bytes
-  // Inputs: 32-byte SecretKey, 32-byte PublicKey, and Message of size SizeMessage in bytes
+ECCRYPTO_STATUS SchnorrQ_FullKeyGenerationBatch(unsigned char** SecretKeys, unsigned char** PublicKeys, const unsigned int NumKeys)
+{ // Batched SchnorrQ keypair generation
+  // It produces NumKeys keypairs as in SchnorrQ_FullKeyGeneration(), processing groups of NPOINTS_FIXEDBASE_BATCH keys whose
+  // public keys are normalized with a single inversion.
+  // Outputs: NumKeys 32-byte secret keys SecretKeys[i] and 32-byte public keys PublicKeys[i]
+    point_t P[NPOINTS_FIXEDBASE_BATCH];
+    digit_t s[NPOINTS_FIXEDBASE_BATCH*NWORDS_ORDER];
+    unsigned char k[4][64], *out[4] = {k[0], k[1], k[2], k[3]};
+    const unsigned char* in[4];
+    const unsigned long long inlen[4] = {32, 32, 32, 32};
+    ECCRYPTO_STATUS Status = ECCRYPTO_ERROR_UNKNOWN;
+    unsigned int i, j, l, n;
+
+    for (i = 0; i < NumKeys; i += NPOINTS_FIXEDBASE_BATCH) {
+        n = (NumKeys - i < NPOINTS_FIXEDBASE_BATCH)? NumKeys - i : NPOINTS_FIXEDBASE_BATCH;
+
+        for (j = 0; j < n; j++) {
+            Status = RandomBytesFunction(SecretKeys[i+j], 32);
+            if (Status != ECCRYPTO_SUCCESS) {
+                goto cleanup;
+            }
+        }
+        for (j = 0; j < n; j += 4) {                   // Hash the secret keys 4 at a time
+            for (l = 0; l < 4; l++) {
+                in[l] = SecretKeys[i + ((j+l < n)? j+l : j)];
+            }
+            if (CryptoHashFunction_x4(in, inlen, out) != 0) {
+                Status = ECCRYPTO_ERROR;
+                goto cleanup;
+            }
+            for (l = 0; l < 4 && j+l < n; l++) {
+                memmove((unsigned char*)&s[(j+l)*NWORDS_ORDER], k[l], 32);
+            }
+        }
+
+        ecc_mul_fixed_batch(s, P, n);                  // Compute public keys
+
+        for (j = 0; j < n; j++) {
+            encode(P[j], PublicKeys[i+j]);              // Encode public key
+        }
+    }
+    Status = ECCRYPTO_SUCCESS;
+
+cleanup:
+    if (Status != ECCRYPTO_SUCCESS) {
+        for (i = 0; i < NumKeys; i++) {
+            clear_words((unsigned int*)SecretKeys[i], 256/(sizeof(unsigned int)*8));
+            clear_words((unsigned int*)PublicKeys[i], 256/(sizeof(unsigned int)*8));
+        }
+    }
+    clear_words((unsigned int*)k, 4*512/(sizeof(unsigned int)*8));
+    clear_words((unsigned int*)s, NPOINTS_FIXEDBASE_BATCH*256/(sizeof(unsigned int)*8));
+
+    return Status;
+}
+
+
+// Domain separator of the pre-hashed variant SchnorrQph, prepended to every hash computed during signing and verification
+static const unsigned char SchnorrQph_DOM[SCHNORRQPH_DOM_BYTES] = { 'S','c','h','n','o','r','r','Q','p','h',' ','p','r','e','-','h','a','s','h',' ','S','H','A','-','5','1','2' };
+
+
+static int SchnorrQ_hash(const bool prehash, const unsigned char* Prefix1, const unsigned char* Prefix2, const unsigned char* Message, const unsigned long long SizeMessage, unsigned char* h)
+{ // Computes h = H(Prefix1||Prefix2||Message) incrementally, without concatenating the inputs. 
+  // If prehash = true, it computes h = H(SchnorrQph_DOM||Prefix1||Prefix2||Message) instead
+  // Inputs: 32-byte Prefix1, 32-byte Prefix2 (omitted if NULL), and Message of size SizeMessage in bytes
+  // Output: 64-byte hash h. It returns 0 on success
+    CryptoHashContext ctx;
+    int ret = 0;
+
+    ret |= CryptoHashInit(&ctx);
+    if (prehash == true) {
+        ret |= CryptoHashUpdate(&ctx, SchnorrQph_DOM, SCHNORRQPH_DOM_BYTES);
+    }
+    ret |= CryptoHashUpdate(&ctx, Prefix1, 32);
+    if (Prefix2 != NULL) {
+        ret |= CryptoHashUpdate(&ctx, Prefix2, 32);
+    }
+    ret |= CryptoHashUpdate(&ctx, Message, SizeMessage);
+    ret |= CryptoHashFinal(&ctx, h);
+    clear_words((unsigned int*)&ctx, sizeof(CryptoHashContext)/sizeof(unsigned int));
+
+    return ret;
+}
+
+
+static int SchnorrQ_hash_x4(const unsigned char** Prefix1, const unsigned char** Prefix2, const unsigned char** Messages, const unsigned int* SizeMessages, unsigned char** h)
+{ // Computes h[i] = H(Prefix1[i]||Prefix2[i]||Messages[i]) for i in [0, 3], hashing the 4 messages in parallel
+  // Inputs: 32-byte Prefix1[i], 32-byte Prefix2[i], and Messages[i] of size SizeMessages[i] in bytes
+  // Output: 64-byte hashes h[i]. It returns 0 on success
+    CryptoHashContext ctx[4];
+    unsigned long long SizeMessage[4];
+    unsigned int i;
+    int ret = 0;
+
+    for (i = 0; i < 4; i++) {
+        ret |= CryptoHashInit(&ctx[i]);
+        ret |= CryptoHashUpdate(&ctx[i], Prefix1[i], 32);
+        ret |= CryptoHashUpdate(&ctx[i], Prefix2[i], 32);
+        SizeMessage[i] = SizeMessages[i];
+    }
+    ret |= CryptoHashUpdate_x4(ctx, Messages, SizeMessage);
+    ret |= CryptoHashFinal_x4(ctx, h);
+
+    return ret;
+}
+
+
+static ECCRYPTO_STATUS SchnorrQ_Sign_core(const bool prehash, const digit_t* s, const unsigned char* NoncePrefix, const unsigned char* PublicKey, const unsigned char* Message, const unsigned long long SizeMessage, unsigned char* Signature)
+{ // SchnorrQ signature generation from an expanded secret key. If prehash = true, Message is the digest of the pre-hashed variant SchnorrQph
+  // Inputs: secret scalar s in Montgomery representation, 32-byte NoncePrefix (upper half of H(SecretKey)), 32-byte PublicKey, and Message of size SizeMessage in bytes
   // Output: 64-byte Signature 
     point_t R;
-    unsigned char k[64], r[64], h[64], *temp = NULL;
+    unsigned char r[64], h[64];
 	digit_t* H = (digit_t*)h;
     digit_t* S = (digit_t*)(Signature+32);
     ECCRYPTO_STATUS Status = ECCRYPTO_ERROR_UNKNOWN;
-      
-    if (CryptoHashFunction(SecretKey, 32, k) != 0) {   
-        Status = ECCRYPTO_ERROR;
-        goto cleanup;
-    }
-    
-    temp = (unsigned char*)calloc(1, SizeMessage+64);
-    if (temp == NULL) {
-		Status = ECCRYPTO_ERROR_NO_MEMORY;
-        goto cleanup;
-    }
-    
-    memmove(temp+32, k+32, 32);
-    memmove(temp+64, Message, SizeMessage);
   
-    if (CryptoHashFunction(temp+32, SizeMessage+32, r) != 0) {   
+    if (SchnorrQ_hash(prehash, NoncePrefix, NULL, Message, SizeMessage, r) != 0) {   
         Status = ECCRYPTO_ERROR;
         goto cleanup;
     }
     
     ecc_mul_fixed((digit_t*)r, R); 
     encode(R, Signature);                   // Encode lowest 32 bytes of signature
-    memmove(temp, Signature, 32);
-    memmove(temp+32, PublicKey, 32);
   
-    if (CryptoHashFunction(temp, SizeMessage+64, h) != 0) {   
+    if (SchnorrQ_hash(prehash, Signature, PublicKey, Message, SizeMessage, h) != 0) {   
         Status = ECCRYPTO_ERROR;
         goto cleanup;
     }	
     modulo_order((digit_t*)r, (digit_t*)r);
     modulo_order(H, H);
-	to_Montgomery((digit_t*)k, S);          // Converting to Montgomery representation
 	to_Montgomery(H, H);                    // Converting to Montgomery representation
-	Montgomery_multiply_mod_order(S, H, S);
+	Montgomery_multiply_mod_order((digit_t*)s, H, S);
 	from_Montgomery(S, S);                  // Converting back to standard representation
 	subtract_mod_order((digit_t*)r, S, S);
 	Status = ECCRYPTO_SUCCESS;
     
 cleanup:
-	if (temp != NULL)
-		free(temp);
-    clear_words((unsigned int*)k, 512/(sizeof(unsigned int)*8));
 	clear_words((unsigned int*)r, 512/(sizeof(unsigned int)*8));
     
     return Status;
 }
 
 
-ECCRYPTO_STATUS SchnorrQ_Verify(const unsigned char* PublicKey, const unsigned char* Message, const unsigned int SizeMessage, const unsigned char* Signature, unsigned int* valid)
-{ // SchnorrQ signature verification
-  // It verifies the signature Signature of a message Message of size SizeMessage in bytes
-  // Inputs: 32-byte PublicKey, 64-byte Signature, and Message of size SizeMessage in bytes
+ECCRYPTO_STATUS SchnorrQ_Sign(const unsigned char* SecretKey, const unsigned char* PublicKey, const unsigned char* Message, const unsigned int SizeMessage, unsigned char* Signature)
+{ // SchnorrQ signature generation
+  // It produces the signature Signature of a message Message of size SizeMessage in bytes
+  // Inputs: 32-byte SecretKey, 32-byte PublicKey, and Message of size SizeMessage in bytes
+  // Output: 64-byte Signature 
+    unsigned char k[64];
+    digit_t s[NWORDS_ORDER];
+    ECCRYPTO_STATUS Status = ECCRYPTO_ERROR_UNKNOWN;
+      
+    if (CryptoHashFunction(SecretKey, 32, k) != 0) {   
+        Status = ECCRYPTO_ERROR;
+        goto cleanup;
+    }
+	to_Montgomery((digit_t*)k, s);          // Converting to Montgomery representation
+
+    Status = SchnorrQ_Sign_core(false, s, k+32, PublicKey, Message, SizeMessage, Signature);
+    
+cleanup:
+    clear_words((unsigned int*)k, 512/(sizeof(unsigned int)*8));
+    clear_words((unsigned int*)s, 256/(sizeof(unsigned int)*8));
+    
+    return Status;
+}
+
+
+ECCRYPTO_STATUS SchnorrQ_ExpandSecretKey(const unsigned char* SecretKey, SchnorrQ_ExpandedSecretKey* ExpandedKey)
+{ // SchnorrQ secret key expansion
+  // It hashes SecretKey once and stores the secret scalar in Montgomery representation, the nonce prefix and the encoded public key in ExpandedKey
+  // Input:  32-byte SecretKey
+  // Output: ExpandedKey, to be used with SchnorrQ_SignExpanded() and erased with SchnorrQ_DestroyExpandedSecretKey()
+    point_t P;
+    unsigned char k[64];
+    ECCRYPTO_STATUS Status = ECCRYPTO_ERROR_UNKNOWN;
+      
+    if (CryptoHashFunction(SecretKey, 32, k) != 0) {   
+        Status = ECCRYPTO_ERROR;
+        goto cleanup;
+    }
+    
+    ecc_mul_fixed((digit_t*)k, P);          // Compute public key                                       
+	encode(P, ExpandedKey->PublicKey);      // Encode public key
+	to_Montgomery((digit_t*)k, ExpandedKey->s);   // Converting to Montgomery representation
+    memmove(ExpandedKey->NoncePrefix, k+32, 32);
+    Status = ECCRYPTO_SUCCESS;
+
+cleanup:
+	clear_words((unsigned int*)k, 512/(sizeof(unsigned int)*8));
+    if (Status != ECCRYPTO_SUCCESS) {
+        SchnorrQ_DestroyExpandedSecretKey(ExpandedKey);
+    }
+
+    return Status;
+}
+
+
+ECCRYPTO_STATUS SchnorrQ_SignExpanded(const SchnorrQ_ExpandedSecretKey* ExpandedKey, const unsigned char* Message, const unsigned long long SizeMessage, unsigned char* Signature)
+{ // SchnorrQ signature generation using an expanded secret key
+  // It produces the signature Signature of a message Message of size SizeMessage in bytes
+  // Inputs: ExpandedKey generated by SchnorrQ_ExpandSecretKey(), and Message of size SizeMessage in bytes
+  // Output: 64-byte Signature 
+
+    return SchnorrQ_Sign_core(false, ExpandedKey->s, ExpandedKey->NoncePrefix, ExpandedKey->PublicKey, Message, SizeMessage, Signature);
+}
+
+
+void SchnorrQ_DestroyExpandedSecretKey(SchnorrQ_ExpandedSecretKey* ExpandedKey)
+{ // Erasure of an expanded secret key
+  // Input: ExpandedKey generated by SchnorrQ_ExpandSecretKey(), which is zeroized
+
+    clear_words((unsigned int*)ExpandedKey, sizeof(SchnorrQ_ExpandedSecretKey)/sizeof(unsigned int));
+}
+
+
+static ECCRYPTO_STATUS SchnorrQ_Verify_core(const unsigned char* PublicKey, const unsigned char* Signature, unsigned char* h, unsigned int* valid)
+{ // SchnorrQ signature verification given the hash h = H(R||PublicKey||Message), where R is the lowest 32 bytes of Signature
+  // Inputs: 32-byte PublicKey, 64-byte Signature and 64-byte hash h
   // Output: true (valid signature) or false (invalid signature)
     point_t A;
-    unsigned char *temp, h[64];
     unsigned int i;
     ECCRYPTO_STATUS Status = ECCRYPTO_ERROR_UNKNOWN;  
 
     *valid = false;
 
-	temp = (unsigned char*)calloc(1, SizeMessage+64);
-	if (temp == NULL) {
-		Status = ECCRYPTO_ERROR_NO_MEMORY;
-		goto cleanup;
-	}
-
     if (((PublicKey[15] & 0x80) != 0) || ((Signature[15] & 0x80) != 0) || (Signature[63] != 0) || ((Signature[62] & 0xC0) != 0)) {  // Are bit128(PublicKey) = bit128(Signature) = 0 and Signature+32 < 2^246?
 		Status = ECCRYPTO_ERROR_INVALID_PARAMETER;
 		goto cleanup;
@@ -159,19 +312,220 @@ ECCRYPTO_STATUS SchnorrQ_Verify(const unsigned char* PublicKey, const unsigned c
         goto cleanup;                            
     }
 
-    memmove(temp, Signature, 32);
-    memmove(temp+32, PublicKey, 32);
-    memmove(temp+64, Message, SizeMessage);
+    Status = ecc_mul_double((digit_t*)(Signature+32), A, (digit_t*)h, A);      
+    if (Status != ECCRYPTO_SUCCESS) {                                                
+        goto cleanup;
+    }
+	
+	encode(A, (unsigned char*)A);
+
+    for (i = 0; i < NWORDS_ORDER; i++) {
+        if (((digit_t*)A)[i] != ((digit_t*)Signature)[i]) {
+            goto cleanup;   
+        }
+    }
+    *valid = true;
+
+cleanup:
+    return Status;
+}
+
+
+ECCRYPTO_STATUS SchnorrQ_Verify(const unsigned char* PublicKey, const unsigned char* Message, const unsigned int SizeMessage, const unsigned char* Signature, unsigned int* valid)
+{ // SchnorrQ signature verification
+  // It verifies the signature Signature of a message Message of size SizeMessage in bytes
+  // Inputs: 32-byte PublicKey, 64-byte Signature, and Message of size SizeMessage in bytes
+  // Output: true (valid signature) or false (invalid signature)
+    unsigned char h[64];
+
+    *valid = false;
   
-    if (CryptoHashFunction(temp, SizeMessage+64, h) != 0) {   
+    if (SchnorrQ_hash(false, Signature, PublicKey, Message, SizeMessage, h) != 0) {   
+        return ECCRYPTO_ERROR;
+    }
+
+    return SchnorrQ_Verify_core(PublicKey, Signature, h, valid);
+}
+
+
+ECCRYPTO_STATUS SchnorrQ_VerifyInit(SchnorrQ_VerifyContext* ctx, const unsigned char* PublicKey, const unsigned char* Signature)
+{ // Initialization of streaming SchnorrQ signature verification
+  // Inputs: 32-byte PublicKey and 64-byte Signature, which are copied into ctx
+  // Output: ctx, ready to absorb the message with SchnorrQ_VerifyUpdate()
+
+    memmove(ctx->PublicKey, PublicKey, 32);
+    memmove(ctx->Signature, Signature, 64);
+    
+    if (CryptoHashInit(&ctx->HashState) != 0 || CryptoHashUpdate(&ctx->HashState, Signature, 32) != 0 || CryptoHashUpdate(&ctx->HashState, PublicKey, 32) != 0) {
+        return ECCRYPTO_ERROR;
+    }
+
+    return ECCRYPTO_SUCCESS;
+}
+
+
+ECCRYPTO_STATUS SchnorrQ_VerifyUpdate(SchnorrQ_VerifyContext* ctx, const unsigned char* Message, const unsigned long long SizeMessage)
+{ // Streaming SchnorrQ signature verification: absorbs the next SizeMessage bytes of the message
+  // Inputs: ctx initialized with SchnorrQ_VerifyInit(), and message chunk Message of size SizeMessage in bytes
+
+    if (CryptoHashUpdate(&ctx->HashState, Message, SizeMessage) != 0) {
+        return ECCRYPTO_ERROR;
+    }
+
+    return ECCRYPTO_SUCCESS;
+}
+
+
+ECCRYPTO_STATUS SchnorrQ_VerifyFinal(SchnorrQ_VerifyContext* ctx, unsigned int* valid)
+{ // Finalization of streaming SchnorrQ signature verification
+  // Input:  ctx initialized with SchnorrQ_VerifyInit() that has absorbed the whole message
+  // Output: true (valid signature) or false (invalid signature)
+    unsigned char h[64];
+
+    *valid = false;
+  
+    if (CryptoHashFinal(&ctx->HashState, h) != 0) {   
+        return ECCRYPTO_ERROR;
+    }
+
+    return SchnorrQ_Verify_core(ctx->PublicKey, ctx->Signature, h, valid);
+}
+
+
+ECCRYPTO_STATUS SchnorrQph_SignDigest(const SchnorrQ_ExpandedSecretKey* ExpandedKey, const unsigned char* Digest, unsigned char* Signature)
+{ // SchnorrQph signature generation from a message digest
+  // It produces the SchnorrQph signature Signature of a message with digest Digest = CryptoHashFunction(Message)
+  // Inputs: ExpandedKey generated by SchnorrQ_ExpandSecretKey(), and 64-byte Digest
+  // Output: 64-byte Signature 
+
+    return SchnorrQ_Sign_core(true, ExpandedKey->s, ExpandedKey->NoncePrefix, ExpandedKey->PublicKey, Digest, 64, Signature);
+}
+
+
+ECCRYPTO_STATUS SchnorrQph_Sign(const unsigned char* SecretKey, const unsigned char* PublicKey, const unsigned char* Message, const unsigned long long SizeMessage, unsigned char* Signature)
+{ // SchnorrQph signature generation
+  // It produces the SchnorrQph signature Signature of a message Message of size SizeMessage in bytes, which is read once
+  // Inputs: 32-byte SecretKey, 32-byte PublicKey, and Message of size SizeMessage in bytes
+  // Output: 64-byte Signature 
+    unsigned char k[64], Digest[64];
+    digit_t s[NWORDS_ORDER];
+    ECCRYPTO_STATUS Status = ECCRYPTO_ERROR_UNKNOWN;
+      
+    if (CryptoHashFunction(SecretKey, 32, k) != 0 || CryptoHashFunction(Message, SizeMessage, Digest) != 0) {   
         Status = ECCRYPTO_ERROR;
         goto cleanup;
     }
+	to_Montgomery((digit_t*)k, s);          // Converting to Montgomery representation
 
-    Status = ecc_mul_double((digit_t*)(Signature+32), A, (digit_t*)h, A);      
-    if (Status != ECCRYPTO_SUCCESS) {                                                
+    Status = SchnorrQ_Sign_core(true, s, k+32, PublicKey, Digest, 64, Signature);
+    
+cleanup:
+    clear_words((unsigned int*)k, 512/(sizeof(unsigned int)*8));
+    clear_words((unsigned int*)s, 256/(sizeof(unsigned int)*8));
+    
+    return Status;
+}
+
+
+ECCRYPTO_STATUS SchnorrQph_VerifyDigest(const unsigned char* PublicKey, const unsigned char* Digest, const unsigned char* Signature, unsigned int* valid)
+{ // SchnorrQph signature verification from a message digest
+  // It verifies the SchnorrQph signature Signature of a message with digest Digest = CryptoHashFunction(Message)
+  // Inputs: 32-byte PublicKey, 64-byte Digest and 64-byte Signature
+  // Output: true (valid signature) or false (invalid signature)
+    unsigned char h[64];
+
+    *valid = false;
+  
+    if (SchnorrQ_hash(true, Signature, PublicKey, Digest, 64, h) != 0) {   
+        return ECCRYPTO_ERROR;
+    }
+
+    return SchnorrQ_Verify_core(PublicKey, Signature, h, valid);
+}
+
+
+ECCRYPTO_STATUS SchnorrQph_Verify(const unsigned char* PublicKey, const unsigned char* Message, const unsigned long long SizeMessage, const unsigned char* Signature, unsigned int* valid)
+{ // SchnorrQph signature verification
+  // It verifies the SchnorrQph signature Signature of a message Message of size SizeMessage in bytes
+  // Inputs: 32-byte PublicKey, 64-byte Signature, and Message of size SizeMessage in bytes
+  // Output: true (valid signature) or false (invalid signature)
+    unsigned char Digest[64];
+
+    *valid = false;
+  
+    if (CryptoHashFunction(Message, SizeMessage, Digest) != 0) {   
+        return ECCRYPTO_ERROR;
+    }
+
+    return SchnorrQph_VerifyDigest(PublicKey, Digest, Signature, valid);
+}
+
+
+ECCRYPTO_STATUS SchnorrQ_PreparePublicKey(const unsigned char* PublicKey, SchnorrQ_PreparedPublicKey* PreparedKey)
+{ // SchnorrQ public key preparation
+  // It decodes and validates the public key PublicKey and precomputes the tables used by SchnorrQ_VerifyPrepared()
+  // Input:  32-byte PublicKey
+  // Output: PreparedKey, which can be shared by concurrent calls to SchnorrQ_VerifyPrepared()
+    ECCRYPTO_STATUS Status = ECCRYPTO_ERROR_UNKNOWN;
+
+    if ((PublicKey[15] & 0x80) != 0) {      // Is bit128(PublicKey) = 0?
+		Status = ECCRYPTO_ERROR_INVALID_PARAMETER;
+		goto cleanup;
+    }
+    
+	Status = decode(PublicKey, PreparedKey->A);    // Also verifies that A is on the curve. If it is not, it fails  
+    if (Status != ECCRYPTO_SUCCESS) {
+        goto cleanup;                            
+    }
+    memmove(PreparedKey->PublicKey, PublicKey, 32);
+
+#if (USE_ENDO == true)
+    if (ecc_prepare_double(PreparedKey->A, (point_extproj_precomp_t*)PreparedKey->Table) == false) {
+        Status = ECCRYPTO_ERROR_INVALID_PARAMETER;
+        goto cleanup;
+    }
+#endif
+
+    return ECCRYPTO_SUCCESS;
+
+cleanup:
+    memset(PreparedKey, 0, sizeof(SchnorrQ_PreparedPublicKey));
+
+    return Status;
+}
+
+
+ECCRYPTO_STATUS SchnorrQ_VerifyPrepared(const SchnorrQ_PreparedPublicKey* PreparedKey, const unsigned char* Message, const unsigned int SizeMessage, const unsigned char* Signature, unsigned int* valid)
+{ // SchnorrQ signature verification using a prepared public key
+  // It verifies the signature Signature of a message Message of size SizeMessage in bytes
+  // Inputs: PreparedKey generated by SchnorrQ_PreparePublicKey(), 64-byte Signature, and Message of size SizeMessage in bytes
+  // Output: true (valid signature) or false (invalid signature)
+    point_t A;
+    unsigned char h[64];
+    unsigned int i;
+    ECCRYPTO_STATUS Status = ECCRYPTO_ERROR_UNKNOWN;  
+
+    *valid = false;
+
+    if (((Signature[15] & 0x80) != 0) || (Signature[63] != 0) || ((Signature[62] & 0xC0) != 0)) {  // Are bit128(Signature) = 0 and Signature+32 < 2^246?
+		Status = ECCRYPTO_ERROR_INVALID_PARAMETER;
+		goto cleanup;
+    }
+
+    if (SchnorrQ_hash(false, Signature, PreparedKey->PublicKey, Message, SizeMessage, h) != 0) {   
+        Status = ECCRYPTO_ERROR;
         goto cleanup;
     }
+
+#if (USE_ENDO == true)
+    ecc_mul_double_prepared((digit_t*)(Signature+32), (point_extproj_precomp_t*)PreparedKey->Table, (digit_t*)h, A);
+#else
+    if (ecc_mul_double((digit_t*)(Signature+32), (point_affine*)PreparedKey->A, (digit_t*)h, A) == false) {
+        Status = ECCRYPTO_ERROR_INVALID_PARAMETER;
+        goto cleanup;
+    }
+#endif
+    Status = ECCRYPTO_SUCCESS;
 	
 	encode(A, (unsigned char*)A);
 
@@ -183,8 +537,181 @@ ECCRYPTO_STATUS SchnorrQ_Verify(const unsigned char* PublicKey, const unsigned c
     *valid = true;
 
 cleanup:
-	if (temp != NULL)
-		free(temp);
+    return Status;
+}
+
+
+static bool is_canonical_encoding(const unsigned char* Pencoded, point_t P)
+{ // Check that Pencoded is the canonical encoding of the point P decoded from it, i.e., that encode() reproduces it from the fully reduced coordinates of P.
+  // decode() also accepts the value 2^127-1 for a zero component of the y-coordinate, and a sign bit equal to 1 for x = 0
+    point_t Q;
+    unsigned char Qencoded[32];
+
+    fp2copy1271(P->x, Q->x);
+    fp2copy1271(P->y, Q->y);
+    mod1271(Q->x[0]); mod1271(Q->x[1]);
+    mod1271(Q->y[0]); mod1271(Q->y[1]);
+    encode(Q, Qencoded);
+
+    return (memcmp(Qencoded, Pencoded, 32) == 0);
+}
+
+
+size_t SchnorrQ_VerifyBatchWorkspaceSize(const unsigned int NumSignatures)
+{ // Size in bytes of the workspace used by SchnorrQ_VerifyBatchWorkspace(): the decoded points and their scalars, the random values z_i, the indices 
+  // of the candidates and the workspace of the multi-scalar multiplication, plus 64 bytes to align a workspace at any address
+    size_t n = NumSignatures;
+
+    return 64 + WORKSPACE_ALIGN(2*n*sizeof(point_t)) + WORKSPACE_ALIGN(2*n*NWORDS_ORDER*sizeof(digit_t)) + WORKSPACE_ALIGN(16*n) + 
+           WORKSPACE_ALIGN(n*sizeof(unsigned int)) + ecc_mul_double_multi_workspace_size(2*NumSignatures);
+}
+
+
+ECCRYPTO_STATUS SchnorrQ_VerifyBatchWorkspace(const unsigned char** PublicKeys, const unsigned char** Messages, const unsigned int* SizeMessages, const unsigned char** Signatures, const unsigned int NumSignatures, unsigned int* valid, void* Workspace, const size_t SizeWorkspace)
+{ // SchnorrQ batch signature verification using a caller-provided workspace
+  // It verifies the NumSignatures signatures Signatures[i] of messages Messages[i] of size SizeMessages[i] in bytes under public keys PublicKeys[i]
+  // using a single randomized multi-scalar check. If the batch check fails, every signature is verified individually to locate the invalid ones.
+  // Inputs: NumSignatures 32-byte PublicKeys, 64-byte Signatures, and Messages of size SizeMessages in bytes,
+  //         Workspace with SizeWorkspace bytes, at least SchnorrQ_VerifyBatchWorkspaceSize(NumSignatures). Its contents are overwritten.
+  // Output: valid[i] = true (valid signature) or false (invalid signature), for i in [0, NumSignatures-1]
+  // The batch check is (sum z_i*s_i)*G + sum (z_i*h_i)*A_i + sum z_i*(-R_i) = (0,1), for random 128-bit values z_i, where (R_i,s_i) is the i-th
+  // signature, A_i the i-th public key and h_i = H(R_i||A_i||M_i). valid[i] is true only if SchnorrQ_Verify() accepts the i-th signature:
+  //   - signatures and public keys with an invalid format or that cannot be decoded are rejected without entering the batch,
+  //   - public keys and values R_i with a non-canonical encoding, or decoded to a point outside the prime-order subgroup, are verified with 
+  //     SchnorrQ_Verify(), since the batch check compares points instead of encodings and the random z_i do not cancel small-order components.
+    point_t *points;
+    point_t R;
+    digit_t *scalars, *z, sum[NWORDS_ORDER] = {0}, t[NWORDS_ORDER], s[NWORDS_ORDER], zM[NWORDS_ORDER];
+    unsigned char *workspace, *rand_z = NULL, h[4][64], *hashes[4] = {h[0], h[1], h[2], h[3]};
+    const unsigned char *R_x4[4], *A_x4[4], *M_x4[4];
+    unsigned int i, j, l, n, *candidates, Size_x4[4], npoints = 0;
+    ECCRYPTO_STATUS Status = ECCRYPTO_ERROR_UNKNOWN;
+
+    for (i = 0; i < NumSignatures; i++) {
+        valid[i] = false;
+    }
+    if (NumSignatures == 0) {
+        return ECCRYPTO_SUCCESS;
+    }
+
+    if (SizeWorkspace < SchnorrQ_VerifyBatchWorkspaceSize(NumSignatures)) {
+        Status = ECCRYPTO_ERROR_INVALID_PARAMETER;
+        goto cleanup;
+    }
+    workspace = (unsigned char*)Workspace + ((0 - (uintptr_t)Workspace) & 63);    // Align the workspace to 64 bytes
+    points = (point_t*)workspace_take(&workspace, 2*(size_t)NumSignatures*sizeof(point_t));
+    scalars = (digit_t*)workspace_take(&workspace, 2*(size_t)NumSignatures*NWORDS_ORDER*sizeof(digit_t));
+    rand_z = workspace_take(&workspace, 16*(size_t)NumSignatures);
+    candidates = (unsigned int*)workspace_take(&workspace, (size_t)NumSignatures*sizeof(unsigned int));
+
+    Status = RandomBytesFunction(rand_z, 16*NumSignatures);
+    if (Status != ECCRYPTO_SUCCESS) {
+        goto cleanup;
+    }
+
+    for (i = 0; i < NumSignatures; i++) {
+        if (((PublicKeys[i][15] & 0x80) != 0) || ((Signatures[i][15] & 0x80) != 0) || (Signatures[i][63] != 0) || ((Signatures[i][62] & 0xC0) != 0)) {
+            continue;                                             // Malformed signature or public key, it stays invalid
+        }
+        if (decode(PublicKeys[i], points[npoints]) != ECCRYPTO_SUCCESS || decode(Signatures[i], points[npoints+1]) != ECCRYPTO_SUCCESS) {
+            continue;
+        }
+        if (is_canonical_encoding(PublicKeys[i], points[npoints]) == false || is_canonical_encoding(Signatures[i], points[npoints+1]) == false ||
+            ecc_point_in_subgroup(points[npoints]) == false || ecc_point_in_subgroup(points[npoints+1]) == false) {
+            Status = SchnorrQ_Verify(PublicKeys[i], Messages[i], SizeMessages[i], Signatures[i], &valid[i]);   // Verified outside the batch
+            if (Status != ECCRYPTO_SUCCESS) {
+                goto cleanup;
+            }
+            continue;
+        }
+        fp2neg1271(points[npoints+1]->x);                         // -R_i
+        mod1271(points[npoints+1]->x[0]); mod1271(points[npoints+1]->x[1]);
+
+        valid[i] = true;                                          // Candidate for the batch check
+        candidates[npoints/2] = i;
+        npoints += 2;
+    }
+
+    for (j = 0; j < npoints/2; j += 4) {                          // Hash the candidates 4 at a time
+        n = (npoints/2 - j < 4)? npoints/2 - j : 4;
+        for (l = 0; l < 4; l++) {
+            i = candidates[j + ((l < n)? l : 0)];
+            R_x4[l] = Signatures[i]; A_x4[l] = PublicKeys[i]; M_x4[l] = Messages[i]; Size_x4[l] = SizeMessages[i];
+        }
+        if (SchnorrQ_hash_x4(R_x4, A_x4, M_x4, Size_x4, hashes) != 0) {
+            Status = ECCRYPTO_ERROR;
+            goto cleanup;
+        }
+
+        for (l = 0; l < n; l++) {
+            i = candidates[j+l];
+            z = &scalars[(2*(j+l)+1)*NWORDS_ORDER];               // z_i is the scalar of -R_i
+            memset((unsigned char*)z, 0, NWORDS_ORDER*sizeof(digit_t));
+            memmove((unsigned char*)z, rand_z+16*i, 16);
+            to_Montgomery(z, zM);
+            modulo_order((digit_t*)h[l], (digit_t*)h[l]);
+            Montgomery_multiply_mod_order(zM, (digit_t*)h[l], &scalars[2*(j+l)*NWORDS_ORDER]);   // z_i*h_i mod order
+            memmove((unsigned char*)s, Signatures[i]+32, 32);
+            modulo_order(s, s);
+            Montgomery_multiply_mod_order(zM, s, t);             // sum = sum + z_i*s_i mod order
+            add_mod_order(sum, t, sum);
+        }
+    }
     
+    if (npoints == 0) {
+        Status = ECCRYPTO_SUCCESS;
+        goto cleanup;
+    }
+
+    if (ecc_mul_double_multi_workspace(sum, points, scalars, npoints, R, workspace, ecc_mul_double_multi_workspace_size(2*NumSignatures)) == true && 
+        is_zero_ct((digit_t*)R->x, 2*NWORDS_FIELD) && is_zero_ct(&((digit_t*)R->y)[1], 2*NWORDS_FIELD-1) && R->y[0][0] == 1) {
+        Status = ECCRYPTO_SUCCESS;                                // All candidates are valid
+        goto cleanup;
+    }
+
+    for (j = 0; j < npoints/2; j++) {                             // Batch check failed: verify candidates individually
+        i = candidates[j];
+        Status = SchnorrQ_Verify(PublicKeys[i], Messages[i], SizeMessages[i], Signatures[i], &valid[i]);
+        if (Status != ECCRYPTO_SUCCESS) {
+            goto cleanup;
+        }
+    }
+    Status = ECCRYPTO_SUCCESS;
+
+cleanup:
+    if (rand_z != NULL) {
+        clear_words((unsigned int*)rand_z, 16*NumSignatures/sizeof(unsigned int));
+    }
+    if (Status != ECCRYPTO_SUCCESS) {
+        for (i = 0; i < NumSignatures; i++) {
+            valid[i] = false;
+        }
+    }
+    
+    return Status;
+}
+
+
+#if !defined(FOURQ_NO_MALLOC)
+
+ECCRYPTO_STATUS SchnorrQ_VerifyBatch(const unsigned char** PublicKeys, const unsigned char** Messages, const unsigned int* SizeMessages, const unsigned char** Signatures, const unsigned int NumSignatures, unsigned int* valid)
+{ // SchnorrQ batch signature verification
+  // It computes the same outputs as SchnorrQ_VerifyBatchWorkspace(), with the workspace allocated on the heap
+    size_t size = SchnorrQ_VerifyBatchWorkspaceSize(NumSignatures);
+    void* workspace = malloc(size);
+    ECCRYPTO_STATUS Status;
+    unsigned int i;
+
+    if (workspace == NULL) {
+        for (i = 0; i < NumSignatures; i++) {
+            valid[i] = false;
+        }
+        return ECCRYPTO_ERROR_NO_MEMORY;
+    }
+    Status = SchnorrQ_VerifyBatchWorkspace(PublicKeys, Messages, SizeMessages, Signatures, NumSignatures, valid, workspace, size);
+    free(workspace);
+
     return Status;
-}
\ No newline at end of file
+}
+
+#endif
@@ -22,13 +22,13 @@ extern "C" {
 #endif
 
 
-void table_lookup_1x8(point_extproj_precomp_t* table, point_extproj_precomp_t P, unsigned int digit, unsigned int sign_mask)
-{ // Constant-time table lookup to extract a point represented as (X+Y,Y-X,2Z,2dT) corresponding to extended twisted Edwards coordinates (X:Y:Z:T)
-  // Inputs: sign_mask, digit, table containing 8 points
-  // Output: P = sign*table[digit], where sign=1 if sign_mask=0xFF...FF and sign=-1 if sign_mask=0
+#if (SIMD_SUPPORT == AVX2_SUPPORT) || defined(DISPATCH_SUPPORT)
 
-#if (SIMD_SUPPORT == AVX2_SUPPORT)  
-#if defined(ASM_SUPPORT)
+TARGET_AVX2 void table_lookup_1x8_avx2(point_extproj_precomp_t* table, point_extproj_precomp_t P, unsigned int digit, unsigned int sign_mask)
+{ // Constant-time table lookup using AVX2, see table_lookup_1x8()
+#if defined(DISPATCH_SUPPORT)
+    table_lookup_1x8_a_avx2(table, P, &digit, &sign_mask);
+#elif defined(ASM_SUPPORT)
     table_lookup_1x8_a(table, P, &digit, &sign_mask);
 #else
     __m256i point[4], temp_point[4], full_mask; 
@@ -75,7 +75,93 @@ void table_lookup_1x8(point_extproj_precomp_t* table, point_extproj_precomp_t P,
     _mm256_storeu_si256((__m256i*)P->z2, point[2]);  
     _mm256_storeu_si256((__m256i*)P->t2, point[3]); 
 #endif
+}
+
+
+#if defined(COMPACT_FIXEDBASE_SUPPORT)
+
+TARGET_AVX2 void table_lookup_fixed_base_avx2(point_fixedbase_t* table, point_precomp_t P, unsigned int digit, unsigned int sign)
+{ // Constant-time table lookup using AVX2 in the compact table, see table_lookup_fixed_base(). The coordinate 2dt is not computed
+    __m256i point[2], temp_point[2], full_mask; 
+    unsigned int i;
+    int mask;
+    
+    point[0] = _mm256_loadu_si256((__m256i*)table[0]->xy);                  // point = table[0] 
+    point[1] = _mm256_loadu_si256((__m256i*)table[0]->yx);  
+
+    for (i = 1; i < VPOINTS_FIXEDBASE; i++) 
+    { 
+        digit--;
+        // While digit>=0 mask = 0xFF...F else sign = 0x00...0
+        mask = (int)(digit >> (8*sizeof(digit)-1)) - 1;
+        temp_point[0] = _mm256_loadu_si256((__m256i*)table[i]->xy);         // temp_point = table[i]
+        temp_point[1] = _mm256_loadu_si256((__m256i*)table[i]->yx);
+        // If mask = 0x00...0 then point = point, else if mask = 0xFF...F then point = temp_point
+        full_mask = _mm256_set1_epi32(mask);
+        temp_point[0] = _mm256_xor_si256(point[0], temp_point[0]);
+        temp_point[1] = _mm256_xor_si256(point[1], temp_point[1]);
+        point[0] = _mm256_xor_si256(_mm256_and_si256(temp_point[0], full_mask), point[0]);
+        point[1] = _mm256_xor_si256(_mm256_and_si256(temp_point[1], full_mask), point[1]);
+    }
+                                
+    full_mask = _mm256_set1_epi32((int)sign);                               // If sign = 0xFF...F then choose negative of the point (y-x,x+y) 
+    temp_point[0] = _mm256_and_si256(_mm256_xor_si256(point[0], point[1]), full_mask);
+    point[0] = _mm256_xor_si256(point[0], temp_point[0]);
+    point[1] = _mm256_xor_si256(point[1], temp_point[0]);
+    _mm256_storeu_si256((__m256i*)P->xy, point[0]);    
+    _mm256_storeu_si256((__m256i*)P->yx, point[1]);     
+}
+
+#else
+
+TARGET_AVX2 void table_lookup_fixed_base_avx2(point_fixedbase_t* table, point_precomp_t P, unsigned int digit, unsigned int sign)
+{ // Constant-time table lookup using AVX2, see table_lookup_fixed_base()
+    __m256i point[3], temp_point[3], full_mask; 
+    unsigned int i;
+    int mask;
+    
+    point[0] = _mm256_loadu_si256((__m256i*)table[0]->xy);                  // point = table[0] 
+    point[1] = _mm256_loadu_si256((__m256i*)table[0]->yx);  
+    point[2] = _mm256_loadu_si256((__m256i*)table[0]->t2); 
+
+    for (i = 1; i < VPOINTS_FIXEDBASE; i++) 
+    { 
+        digit--;
+        // While digit>=0 mask = 0xFF...F else sign = 0x00...0
+        mask = (int)(digit >> (8*sizeof(digit)-1)) - 1;
+        temp_point[0] = _mm256_loadu_si256((__m256i*)table[i]->xy);         // temp_point = table[i]
+        temp_point[1] = _mm256_loadu_si256((__m256i*)table[i]->yx);
+        temp_point[2] = _mm256_loadu_si256((__m256i*)table[i]->t2);
+        // If mask = 0x00...0 then point = point, else if mask = 0xFF...F then point = temp_point
+        full_mask = _mm256_set1_epi32(mask);
+        temp_point[0] = _mm256_xor_si256(point[0], temp_point[0]);
+        temp_point[1] = _mm256_xor_si256(point[1], temp_point[1]);
+        temp_point[2] = _mm256_xor_si256(point[2], temp_point[2]);
+        point[0] = _mm256_xor_si256(_mm256_and_si256(temp_point[0], full_mask), point[0]);
+        point[1] = _mm256_xor_si256(_mm256_and_si256(temp_point[1], full_mask), point[1]);
+        point[2] = _mm256_xor_si256(_mm256_and_si256(temp_point[2], full_mask), point[2]);
+    }
+                                
+    temp_point[2] = _mm256_loadu_si256((__m256i*)point+2); 
+    temp_point[0] = _mm256_loadu_si256((__m256i*)point+1);                  // point: x+y,y-x,2dt coordinate, temp_point: y-x,x+y,-2dt coordinate 
+    temp_point[1] = _mm256_loadu_si256((__m256i*)point);
+    full_mask = _mm256_set1_epi32((int)sign); 
+    fpneg1271((digit_t*)temp_point+8);                                      // Negate 2dt coordinate
+    fpneg1271((digit_t*)temp_point+10);                                     // If sign = 0xFF...F then choose negative of the point
+    point[0] = _mm256_xor_si256(_mm256_and_si256(_mm256_xor_si256(point[0], temp_point[0]), full_mask), point[0]);
+    point[1] = _mm256_xor_si256(_mm256_and_si256(_mm256_xor_si256(point[1], temp_point[1]), full_mask), point[1]);
+    point[2] = _mm256_xor_si256(_mm256_and_si256(_mm256_xor_si256(point[2], temp_point[2]), full_mask), point[2]);
+    _mm256_storeu_si256((__m256i*)P->xy, point[0]);    
+    _mm256_storeu_si256((__m256i*)P->yx, point[1]);     
+    _mm256_storeu_si256((__m256i*)P->t2, point[2]);
+}
+
+#endif
+
 #elif (SIMD_SUPPORT == AVX_SUPPORT)
+
+void table_lookup_1x8_avx(point_extproj_precomp_t* table, point_extproj_precomp_t P, unsigned int digit, unsigned int sign_mask)
+{ // Constant-time table lookup using AVX, see table_lookup_1x8()
     __m256d point[4], temp_point[4], full_mask; 
     unsigned int i;
     int mask;
@@ -115,7 +201,90 @@ void table_lookup_1x8(point_extproj_precomp_t* table, point_extproj_precomp_t P,
     _mm256_storeu_pd((double*)P->yx, point[1]);     
     _mm256_storeu_pd((double*)P->z2, point[2]);  
     _mm256_storeu_pd((double*)P->t2, point[3]); 
+}
+
+
+#if defined(COMPACT_FIXEDBASE_SUPPORT)
+
+void table_lookup_fixed_base_avx(point_fixedbase_t* table, point_precomp_t P, unsigned int digit, unsigned int sign)
+{ // Constant-time table lookup using AVX in the compact table, see table_lookup_fixed_base(). The coordinate 2dt is not computed
+    __m256d point[2], temp_point[2], full_mask; 
+    unsigned int i;
+    int mask;
+
+    point[0] = _mm256_loadu_pd((double const*)table[0]->xy);                // point = table[0] 
+    point[1] = _mm256_loadu_pd((double const*)table[0]->yx);  
+
+    for (i = 1; i < VPOINTS_FIXEDBASE; i++) 
+    { 
+        digit--;
+        // While digit>=0 mask = 0xFF...F else sign = 0x00...0
+        mask = (int)(digit >> (8*sizeof(digit)-1)) - 1;
+        full_mask = _mm256_set1_pd((double)mask);
+        temp_point[0] = _mm256_loadu_pd((double const*)table[i]->xy);       // temp_point = table[i+1]
+        temp_point[1] = _mm256_loadu_pd((double const*)table[i]->yx);
+        // If mask = 0x00...0 then point = point, else if mask = 0xFF...F then point = temp_point
+        point[0] = _mm256_blendv_pd(point[0], temp_point[0], full_mask);     
+        point[1] = _mm256_blendv_pd(point[1], temp_point[1], full_mask);    
+    }
+                                   
+    full_mask = _mm256_set1_pd((double)((int)sign));                        // If sign = 0xFF...F then choose negative of the point (y-x,x+y) 
+    temp_point[0] = _mm256_blendv_pd(point[0], point[1], full_mask);
+    temp_point[1] = _mm256_blendv_pd(point[1], point[0], full_mask);
+    _mm256_storeu_pd((double*)P->xy, temp_point[0]); 
+    _mm256_storeu_pd((double*)P->yx, temp_point[1]); 
+}
+
 #else
+
+void table_lookup_fixed_base_avx(point_fixedbase_t* table, point_precomp_t P, unsigned int digit, unsigned int sign)
+{ // Constant-time table lookup using AVX, see table_lookup_fixed_base()
+    __m256d point[3], temp_point[3], full_mask; 
+    unsigned int i;
+    int mask;
+
+    point[0] = _mm256_loadu_pd((double const*)table[0]->xy);                // point = table[0] 
+    point[1] = _mm256_loadu_pd((double const*)table[0]->yx);  
+    point[2] = _mm256_loadu_pd((double const*)table[0]->t2);  
+
+    for (i = 1; i < VPOINTS_FIXEDBASE; i++) 
+    { 
+        digit--;
+        // While digit>=0 mask = 0xFF...F else sign = 0x00...0
+        mask = (int)(digit >> (8*sizeof(digit)-1)) - 1;
+        full_mask = _mm256_set1_pd((double)mask);
+        temp_point[0] = _mm256_loadu_pd((double const*)table[i]->xy);       // temp_point = table[i+1]
+        temp_point[1] = _mm256_loadu_pd((double const*)table[i]->yx);
+        temp_point[2] = _mm256_loadu_pd((double const*)table[i]->t2);
+        // If mask = 0x00...0 then point = point, else if mask = 0xFF...F then point = temp_point
+        point[0] = _mm256_blendv_pd(point[0], temp_point[0], full_mask);     
+        point[1] = _mm256_blendv_pd(point[1], temp_point[1], full_mask);    
+        point[2] = _mm256_blendv_pd(point[2], temp_point[2], full_mask); 
+    }
+                                   
+    temp_point[2] = _mm256_loadu_pd((double const*)point+2*4);              // point: x+y,y-x,2dt coordinate, temp_point: y-x,x+y,-2dt coordinate
+    temp_point[0] = _mm256_loadu_pd((double const*)point+1*4);  
+    temp_point[1] = _mm256_loadu_pd((double const*)point);  
+    full_mask = _mm256_set1_pd((double)((int)sign));     
+    fpneg1271((digit_t*)temp_point+8);                                      // Negate 2dt coordinate
+    fpneg1271((digit_t*)temp_point+10);                                    
+    point[0] = _mm256_blendv_pd(point[0], temp_point[0], full_mask);        // If sign = 0xFF...F then choose negative of the point
+    point[1] = _mm256_blendv_pd(point[1], temp_point[1], full_mask);
+    point[2] = _mm256_blendv_pd(point[2], temp_point[2], full_mask);
+    _mm256_storeu_pd((double*)P->xy, point[0]); 
+    _mm256_storeu_pd((double*)P->yx, point[1]); 
+    _mm256_storeu_pd((double*)P->t2, point[2]);
+}
+
+#endif
+
+#endif
+
+
+#if (SIMD_SUPPORT == NO_SIMD_SUPPORT)
+
+void table_lookup_1x8_c(point_extproj_precomp_t* table, point_extproj_precomp_t P, unsigned int digit, unsigned int sign_mask)
+{ // Constant-time table lookup in C, see table_lookup_1x8()
     point_extproj_precomp_t point, temp_point;
     unsigned int i, j;
     digit_t mask;
@@ -155,92 +324,49 @@ void table_lookup_1x8(point_extproj_precomp_t* table, point_extproj_precomp_t P,
         point->t2[1][j] = ((digit_t)((int)sign_mask) & (point->t2[1][j] ^ temp_point->t2[1][j])) ^ temp_point->t2[1][j];
     }                                  
     ecccopy_precomp(point, P); 
-#endif
 }
 
 
-void table_lookup_fixed_base(point_precomp_t* table, point_precomp_t P, unsigned int digit, unsigned int sign)
-{ // Constant-time table lookup to extract a point represented as (x+y,y-x,2t) corresponding to extended twisted Edwards coordinates (X:Y:Z:T) with Z=1
-  // Inputs: sign, digit, table containing VPOINTS_FIXEDBASE = 2^(W_FIXEDBASE-1) points
-  // Output: if sign=0 then P = table[digit], else if (sign=-1) then P = -table[digit]
+#if defined(COMPACT_FIXEDBASE_SUPPORT)
 
-#if (SIMD_SUPPORT == AVX2_SUPPORT)
-    __m256i point[3], temp_point[3], full_mask; 
-    unsigned int i;
-    int mask;
-    
-    point[0] = _mm256_loadu_si256((__m256i*)table[0]->xy);                  // point = table[0] 
-    point[1] = _mm256_loadu_si256((__m256i*)table[0]->yx);  
-    point[2] = _mm256_loadu_si256((__m256i*)table[0]->t2); 
+void table_lookup_fixed_base_c(point_fixedbase_t* table, point_precomp_t P, unsigned int digit, unsigned int sign)
+{ // Constant-time table lookup in C in the compact table, see table_lookup_fixed_base(). The coordinate 2dt is not computed
+    point_compact_t point, temp_point;
+    unsigned int i, j;
+    digit_t mask;
+                                   
+    ecccopy_compact(table[0], point);                                        // point = table[0]
 
-    for (i = 1; i < VPOINTS_FIXEDBASE; i++) 
-    { 
+    for (i = 1; i < VPOINTS_FIXEDBASE; i++)
+    {
         digit--;
         // While digit>=0 mask = 0xFF...F else sign = 0x00...0
-        mask = (int)(digit >> (8*sizeof(digit)-1)) - 1;
-        temp_point[0] = _mm256_loadu_si256((__m256i*)table[i]->xy);         // temp_point = table[i]
-        temp_point[1] = _mm256_loadu_si256((__m256i*)table[i]->yx);
-        temp_point[2] = _mm256_loadu_si256((__m256i*)table[i]->t2);
+        mask = (digit_t)(digit >> (8*sizeof(digit)-1)) - 1;
+        ecccopy_compact(table[i], temp_point);                               // temp_point = table[i] 
         // If mask = 0x00...0 then point = point, else if mask = 0xFF...F then point = temp_point
-        full_mask = _mm256_set1_epi32(mask);
-        temp_point[0] = _mm256_xor_si256(point[0], temp_point[0]);
-        temp_point[1] = _mm256_xor_si256(point[1], temp_point[1]);
-        temp_point[2] = _mm256_xor_si256(point[2], temp_point[2]);
-        point[0] = _mm256_xor_si256(_mm256_and_si256(temp_point[0], full_mask), point[0]);
-        point[1] = _mm256_xor_si256(_mm256_and_si256(temp_point[1], full_mask), point[1]);
-        point[2] = _mm256_xor_si256(_mm256_and_si256(temp_point[2], full_mask), point[2]);
+        for (j = 0; j < NWORDS_FIELD; j++) {
+            point->xy[0][j] = (mask & (point->xy[0][j] ^ temp_point->xy[0][j])) ^ point->xy[0][j];
+            point->xy[1][j] = (mask & (point->xy[1][j] ^ temp_point->xy[1][j])) ^ point->xy[1][j];
+            point->yx[0][j] = (mask & (point->yx[0][j] ^ temp_point->yx[0][j])) ^ point->yx[0][j];
+            point->yx[1][j] = (mask & (point->yx[1][j] ^ temp_point->yx[1][j])) ^ point->yx[1][j];
+        }
     }
-                                
-    temp_point[2] = _mm256_loadu_si256((__m256i*)point+2); 
-    temp_point[0] = _mm256_loadu_si256((__m256i*)point+1);                  // point: x+y,y-x,2dt coordinate, temp_point: y-x,x+y,-2dt coordinate 
-    temp_point[1] = _mm256_loadu_si256((__m256i*)point);
-    full_mask = _mm256_set1_epi32((int)sign); 
-    fpneg1271((digit_t*)temp_point+8);                                      // Negate 2dt coordinate
-    fpneg1271((digit_t*)temp_point+10);                                     // If sign = 0xFF...F then choose negative of the point
-    point[0] = _mm256_xor_si256(_mm256_and_si256(_mm256_xor_si256(point[0], temp_point[0]), full_mask), point[0]);
-    point[1] = _mm256_xor_si256(_mm256_and_si256(_mm256_xor_si256(point[1], temp_point[1]), full_mask), point[1]);
-    point[2] = _mm256_xor_si256(_mm256_and_si256(_mm256_xor_si256(point[2], temp_point[2]), full_mask), point[2]);
-    _mm256_storeu_si256((__m256i*)P->xy, point[0]);    
-    _mm256_storeu_si256((__m256i*)P->yx, point[1]);     
-    _mm256_storeu_si256((__m256i*)P->t2, point[2]);
-        
-#elif (SIMD_SUPPORT >= AVX_SUPPORT)
-    __m256d point[3], temp_point[3], full_mask; 
-    unsigned int i;
-    int mask;
-
-    point[0] = _mm256_loadu_pd((double const*)table[0]->xy);                // point = table[0] 
-    point[1] = _mm256_loadu_pd((double const*)table[0]->yx);  
-    point[2] = _mm256_loadu_pd((double const*)table[0]->t2);  
+    
+    for (j = 0; j < NWORDS_FIELD; j++) {                                     // If sign = 0xFF...F then choose negative of the point (y-x,x+y)
+        mask = (digit_t)((int)sign) & (point->xy[0][j] ^ point->yx[0][j]);
+        point->xy[0][j] ^= mask;
+        point->yx[0][j] ^= mask;
+        mask = (digit_t)((int)sign) & (point->xy[1][j] ^ point->yx[1][j]);
+        point->xy[1][j] ^= mask;
+        point->yx[1][j] ^= mask;
+    }                                  
+    ecccopy_compact(point, P); 
+}
 
-    for (i = 1; i < VPOINTS_FIXEDBASE; i++) 
-    { 
-        digit--;
-        // While digit>=0 mask = 0xFF...F else sign = 0x00...0
-        mask = (int)(digit >> (8*sizeof(digit)-1)) - 1;
-        full_mask = _mm256_set1_pd((double)mask);
-        temp_point[0] = _mm256_loadu_pd((double const*)table[i]->xy);       // temp_point = table[i+1]
-        temp_point[1] = _mm256_loadu_pd((double const*)table[i]->yx);
-        temp_point[2] = _mm256_loadu_pd((double const*)table[i]->t2);
-        // If mask = 0x00...0 then point = point, else if mask = 0xFF...F then point = temp_point
-        point[0] = _mm256_blendv_pd(point[0], temp_point[0], full_mask);     
-        point[1] = _mm256_blendv_pd(point[1], temp_point[1], full_mask);    
-        point[2] = _mm256_blendv_pd(point[2], temp_point[2], full_mask); 
-    }
-                                   
-    temp_point[2] = _mm256_loadu_pd((double const*)point+2*4);              // point: x+y,y-x,2dt coordinate, temp_point: y-x,x+y,-2dt coordinate
-    temp_point[0] = _mm256_loadu_pd((double const*)point+1*4);  
-    temp_point[1] = _mm256_loadu_pd((double const*)point);  
-    full_mask = _mm256_set1_pd((double)((int)sign));     
-    fpneg1271((digit_t*)temp_point+8);                                      // Negate 2dt coordinate
-    fpneg1271((digit_t*)temp_point+10);                                    
-    point[0] = _mm256_blendv_pd(point[0], temp_point[0], full_mask);        // If sign = 0xFF...F then choose negative of the point
-    point[1] = _mm256_blendv_pd(point[1], temp_point[1], full_mask);
-    point[2] = _mm256_blendv_pd(point[2], temp_point[2], full_mask);
-    _mm256_storeu_pd((double*)P->xy, point[0]); 
-    _mm256_storeu_pd((double*)P->yx, point[1]); 
-    _mm256_storeu_pd((double*)P->t2, point[2]);
 #else
+
+void table_lookup_fixed_base_c(point_fixedbase_t* table, point_precomp_t P, unsigned int digit, unsigned int sign)
+{ // Constant-time table lookup in C, see table_lookup_fixed_base()
     point_precomp_t point, temp_point;
     unsigned int i, j;
     digit_t mask;
@@ -278,10 +404,65 @@ void table_lookup_fixed_base(point_precomp_t* table, point_precomp_t P, unsigned
         point->t2[1][j] = ((digit_t)((int)sign) & (point->t2[1][j] ^ temp_point->t2[1][j])) ^ point->t2[1][j];
     }                                  
     ecccopy_precomp_fixed_base(point, P); 
+}
+
+#endif
+
+#endif
+
+
+void table_lookup_1x8(point_extproj_precomp_t* table, point_extproj_precomp_t P, unsigned int digit, unsigned int sign_mask)
+{ // Constant-time table lookup to extract a point represented as (X+Y,Y-X,2Z,2dT) corresponding to extended twisted Edwards coordinates (X:Y:Z:T)
+  // Inputs: sign_mask, digit, table containing 8 points
+  // Output: P = sign*table[digit], where sign=1 if sign_mask=0xFF...FF and sign=-1 if sign_mask=0
+
+    OPCOUNT(table_lookup_1x8);
+#if defined(DISPATCH_SUPPORT)
+    selected_backend->table_lookup_1x8(table, P, digit, sign_mask);
+#elif (SIMD_SUPPORT == AVX2_SUPPORT)
+    table_lookup_1x8_avx2(table, P, digit, sign_mask);
+#elif (SIMD_SUPPORT == AVX_SUPPORT)
+    table_lookup_1x8_avx(table, P, digit, sign_mask);
+#else
+    table_lookup_1x8_c(table, P, digit, sign_mask);
 #endif
 }
 
 
+void table_lookup_fixed_base(point_fixedbase_t* table, point_precomp_t P, unsigned int digit, unsigned int sign)
+{ // Constant-time table lookup to extract a point represented as (x+y,y-x,2t) corresponding to extended twisted Edwards coordinates (X:Y:Z:T) with Z=1
+  // Inputs: sign, digit, table containing VPOINTS_FIXEDBASE = 2^(W_FIXEDBASE-1) points
+  // Output: if sign=0 then P = table[digit], else if (sign=-1) then P = -table[digit]
+  // The compact table (COMPACT_FIXEDBASE_SUPPORT) only stores (x+y,y-x), and 2dt = (d/2)*((x+y)^2-(y-x)^2) is computed after the lookup
+#if defined(COMPACT_FIXEDBASE_SUPPORT)
+    f2elm_t t;
+#endif
+
+    OPCOUNT(table_lookup_fixed_base);
+#if defined(DISPATCH_SUPPORT)
+    selected_backend->table_lookup_fixed_base(table, P, digit, sign);
+#elif (SIMD_SUPPORT == AVX2_SUPPORT)
+    table_lookup_fixed_base_avx2(table, P, digit, sign);
+#elif (SIMD_SUPPORT == AVX_SUPPORT)
+    table_lookup_fixed_base_avx(table, P, digit, sign);
+#else
+    table_lookup_fixed_base_c(table, P, digit, sign);
+#endif
+
+#if defined(COMPACT_FIXEDBASE_SUPPORT)
+    fp2sqr1271(P->xy, t);
+    fp2sqr1271(P->yx, P->t2);
+    fp2sub1271(t, P->t2, P->t2);                                             // 4*x*y = (x+y)^2-(y-x)^2
+    fp2mul1271(P->t2, (felm_t*)&PARAMETER_d_half, P->t2);                    // 2dt = (d/2)*4*x*y
+#ifdef TEMP_ZEROING
+    clear_words((void*)t, sizeof(f2elm_t)/sizeof(unsigned int));
+#endif
+#endif
+}
+
+
+
+
 #ifdef __cplusplus
 }
 #endif
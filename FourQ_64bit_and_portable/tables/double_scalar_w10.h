@@ -0,0 +1,1037 @@
+/***********************************************************************************
+* FourQlib: a high-performance crypto library based on the elliptic curve FourQ
+*
+*    Copyright (c) Microsoft Corporation. All rights reserved.
+*
+* Abstract: precomputed table for double scalar multiplication with WP_DOUBLEBASE = 10
+************************************************************************************/
+
+// The table below was generated by table_gen and consists of four mini-tables each generated using window width W = 10. 
+// Number of point entries = 4 * 2^8 = 1024 points, where each point (x,y) is represented using coordinates (x+y,y-x,2*d*t).
+// Table size = 1024 * 3 * 256 = 96KB
+
+static const uint64_t DOUBLE_SCALAR_TABLE[12288] = {
+  0xe18a34f3a703e631, 0x287460bf1d502b5f, 0xe02e62f7e4f90353, 0x0c3ba0378b86acde, 0x90bf0f98b0937edc, 0x740b7c7824f0c555, 0xb321239123a01366, 0x4ffcf5b93a9557a5, 0x297afccbabda42bb, 0x5948d137556c97c6, 0xa8189a393330684c, 0x0caf2b720a341f27
+, 0x892756b15bcf68c4, 0x5742f77c98a526ba, 0x340a5a1de9f89f9b, 0x14ef680aee75d0f7, 0x84e770e14043a41f, 0x0212c41116c33c95, 0x35b791e6de4dc0e2, 0x5949df08518d5d28, 0x6a0e120744ed10db, 0x5a5183ce844391d3, 0x6f618b158afdba50, 0x2ce2037e470e2088
+, 0x1f49fa149a64ba3c, 0x5f9876d519670451, 0x030105056f55586b, 0x020f1a557d8fd726, 0xdf4cb175b06d86c8, 0x694fbcbe7fe58390, 0x7933294a756a1b67, 0x09dbe9924b58f8ec, 0x590f4403cdf197b6, 0x1c07969fc87a0ba7, 0xc496477712252367, 0x5508976022f1b096
+, 0xefda361e452e1775, 0x7a0a0cccacc838fb, 0xb07e791c0be5dc5f, 0x24d9b6b418cbcb93, 0x497970f3c6117e03, 0x3986a158cb96d595, 0x8f80586ce692612b, 0x305cafda7e4df9d6, 0xc1a1c2e06452914a, 0x7ef989c0eb583079, 0x3a765b1f7364b099, 0x4fee236d58299c6b
+, 0x6f81095f770e8419, 0x53bbd86b7396bc09, 0x2b72ba726b2b4210, 0x625dda1d2901c78b, 0x0ff5bc7b18cd2b3e, 0x0556598c7358d332, 0x0991245f20ff50d7, 0x0e7f58e5e919a97e, 0x5a0561373b758756, 0x6447bc93f87c198a, 0xf9230604c34c7520, 0x6b214425475c1bfa
+, 0xe93de62d6a7f9497, 0x2129459d86f4493c, 0x456394c7c464cfe4, 0x612434fec3f4a1b3, 0x1ed91eddf44261f3, 0x0c6d3854f9e0a3ff, 0xd3fd153188a7e4e3, 0x24691fbdca16910c, 0xbe97465cd7625c9d, 0x2aa61cd373f759f4, 0x824d5763a326d62b, 0x1a0ae39e50da20ba
+, 0x32d0c8481ee4c3b9, 0x6c3687109cdd18c6, 0xe52717142fbf95da, 0x67bfa41fb52ce9c6, 0x4e24d6a088a01474, 0x49a6ca0ae3fb6626, 0xd67f8faa9103191e, 0x674888f5aa6d3062, 0x4ba73824c2e85a99, 0x406b2fd18d35b314, 0xa7087b1bea728ac1, 0x11d2f222317b160e
+, 0xf8946e007e23a469, 0x22a196fabbce31a2, 0x5309ee1bdc1216ba, 0x240fe9953827a324, 0xf9fcb89b63aeb5c7, 0x603b8149ed16b1b0, 0xb1f1876c02cf61fb, 0x4a5e32af612f948b, 0xfc491aede69a8813, 0x1ad9379136e53aa5, 0x5da50db1d5e6c123, 0x2f4014f7fe2c12ca
+, 0xe4f6791d7685c3f5, 0x4c218521c3745a9b, 0x0c0521af98555f97, 0x1462a12953cada7b, 0x0bb2ab63d6452c1b, 0x5783c531ec98bb87, 0x737def53605dbc9c, 0x49f982b930e86719, 0x75b16790cb5211e3, 0x45ad6574cdbae99e, 0x1062b72dfeec9851, 0x45029a09cc468c88
+, 0x532240de77f3a1f2, 0x17bd291eaa9ad0ea, 0xe0a2d7efc2f8a0a0, 0x3a7412052021778e, 0xb0dfb0976acc90df, 0x7fd603b689a7b1f3, 0x1152579ccb00d6c6, 0x6340743b631849a3, 0xebaa47290e0cda01, 0x143265a6d53fef0b, 0x45325d6fd981e75a, 0x0e9780cc39586f2a
+, 0xa4f68d207a8628dd, 0x50d230b51893e841, 0xf3bd769a4bb504b6, 0x55975c063969292e, 0x07727ba25fb8756f, 0x07ff86cf8ed731fd, 0xef57fa40cc35a1f0, 0x70753a70874218fc, 0x615954e2342b973c, 0x5aa9d68f1a59df86, 0x3b8e9e9ff5e44468, 0x2e749114d60a3d23
+, 0x14a1b91ec176db4b, 0x55f91a63d69aae6d, 0xf42382327b1b6d27, 0x2acf1f475facaafd, 0xfd9069b479b58968, 0x3baaf4e5c4a45f77, 0xa2ac9ab98a7aaab6, 0x5466cb5018f50981, 0x3e6ba27771ba3205, 0x31ea90cdea1bbbe4, 0x0000416b5c557393, 0x464cb0415a510d7d
+, 0xd02087d206ff2bbf, 0x2b9c8ecd7fabe736, 0xb2b56d3842caab0d, 0x046ea0b7767700a7, 0x113a7a889e317310, 0x5992a354bef7d0ca, 0x3edda94ed50388bd, 0x052661f767839154, 0x4c28edf6e19e28e0, 0x1d19c2f2d2f644e5, 0x5d732148db35ab3d, 0x680c4714b83580f5
+, 0xa374f282bb80ccec, 0x789e609bc77ae11c, 0x10d2577d599b45f2, 0x1c548b5b857721b1, 0x7baea726b4543fdf, 0x3c1562912d1b4ed2, 0xd6362203b7e82082, 0x1414e523d3c7a900, 0x7ca349951c1d23a9, 0x4da4265e3ce80fb4, 0x7981ebbcaca9ef36, 0x4ebac9e5b5bf980b
+, 0xabd2c1dcf49cb5a4, 0x3f54acfc25c6340f, 0x202eeffabbd11cbd, 0x67216b7cb3695e8c, 0xff7cbcf9b23fc9f1, 0x2eebebdff7fa7afb, 0x71156befa111f85e, 0x1b8fd98df522902c, 0x6b28ebad62519791, 0x6cf0ea960e01d8ed, 0xb4617bc2006967d5, 0x323da065cb3df0ad
+, 0x31687d0741e24d9c, 0x02db8f2b509a7cc2, 0x9243f85924320527, 0x68c360f01d6e6d2b, 0x2351c5e877d5306a, 0x6f56ccfc85c5f3a9, 0x1b09652837c4928f, 0x0b3337554c83f971, 0xe2931be2ccc783ec, 0x46829694ba08c64f, 0x9f35e36358e2c6ac, 0x1474b333b000d170
+, 0x24d792756fc96640, 0x618fda9fef868c5e, 0xb7ff5b125afd9375, 0x778dd97e0440c258, 0xfbff314886219627, 0x3417e1e1e2a7e811, 0x21e959a88f7b7bdc, 0x3508c2eb8c3c8672, 0x827ecdde111c430f, 0x21bcb19fb07aa134, 0xe0c1fa50ab2f5746, 0x401e680b4e6658fa
+, 0x2cc24bab313693cc, 0x20541c12b964447a, 0x374975b6fb81c3cc, 0x52905efb344e17f7, 0x79c5c9b56d8b5f9e, 0x3390bf75d2b9a3ec, 0x7ef3807d895bf4e4, 0x2814165a42046b51, 0x7f8cfd09326fe158, 0x3232fb4f4c9762ec, 0x5678d6dacc194d25, 0x6f7caffb0a7545e8
+, 0xbd981637b23e7963, 0x691d7b7cb88a0ef5, 0x10ba319ae2062914, 0x06fb144f8295a85b, 0x80e620976bf62f8f, 0x2a425971ec73d6b4, 0x800aa9e741d10b1c, 0x230d7d8bd1a0469b, 0x65aace37428dfe8c, 0x0fcab5297f58b667, 0xcf0e9526943af7b8, 0x7d90915b75d4dae7
+, 0x7455a46156259d6b, 0x29bcc06374cce1b5, 0xf2fb0ed3aa87aefd, 0x211a06af0e54dd58, 0x6c0c95c5723de9bc, 0x6299b6ed25008ca7, 0x7fd63e784d4dfb18, 0x2cc93b4d9bc1db30, 0xebc7e2d44c5d13ea, 0x3278e18d4d3d11a0, 0x349e3dd25a215f79, 0x7eb2a7150b30416d
+, 0x05f3d7d5f6a094cb, 0x2a3771d48e331405, 0x08ef39e9dc96f009, 0x012248373a364992, 0xf758f92fc9fd4d33, 0x2339d8c6dfd3ca6c, 0x8b000965962673b4, 0x746ff43eb99d9054, 0x47ecdc054a422eff, 0x33d8f7c8267b7f0c, 0x22fe00ac921a42ae, 0x31e57f3d31fcd8e6
+, 0xbb912315a1c50869, 0x4ac8cdb0fa7ebbaf, 0x0541d74a60973edf, 0x7234900334b2c5d7, 0xf2e545f730adfa33, 0x224e44e63db5ac96, 0xfcba3d005c6fdeb9, 0x2c93a4e6559936b5, 0x7727a0d7ad88d758, 0x2e33100216719cdd, 0x7b2ef89aeb2c0254, 0x1f6de5b74758afb4
+, 0x6ae89047114fb321, 0x3d605e9a6ec6d80d, 0x18e915c727a874d8, 0x699088b5e9d0912f, 0xaf9344618e056f10, 0x1b9169df8245e0b3, 0x5eb8c33d70f4c891, 0x1609ddfb222b13c3, 0x8131c885d1b366ed, 0x7bc3cf9d9cb1a7b0, 0xd297478d2fc93968, 0x13cbb4573a4ea7f5
+, 0xdd37b5cc64d5986b, 0x7ed3d1d7d81ab5dc, 0xac53485f23973c9e, 0x0705675d333b91d7, 0xade5d213c43186c1, 0x6a8bdf57b4bfdf14, 0xa87f88a1de717963, 0x17f29220b519bce2, 0x7af2d7fb0f95c610, 0x28d1d3923b144a7c, 0x8e73c3d8972813e1, 0x00100b40c62e72c1
+, 0x84de7a81fa1f50da, 0x4fa391d6589d8244, 0xbcc3596f0834b285, 0x4d4acbd60a24e9ce, 0x97fa98b8c1835a0d, 0x33abcf8e29901d0b, 0x60a73d1975b3d082, 0x60666aa4325b948d, 0xad54adb769284a39, 0x227a98d113609b28, 0x4a1e1ffcae6a3872, 0x1e4ee44bd67f818c
+, 0x5a74c6bb4387d315, 0x019428c0b1b18795, 0x5cc153e270bbb055, 0x2b3cabdf00dc4a61, 0x834110c026924b57, 0x2d30e985f2d9f217, 0x47116979333389f5, 0x53e3fd6a18202417, 0xb1393cd79c2e5864, 0x58d92935e4112e82, 0x86989a7ec8305b6d, 0x42a8fe4eee28f37a
+, 0x74e212ef01591901, 0x3277917a0397b1b9, 0x7bbcbe6e3d687544, 0x0b8957701d09afb6, 0x6cfbc8ee74503668, 0x48a9925ada9f8348, 0x57045753ba2d0f4e, 0x7d69ca3866223d66, 0xc7054ce22917271f, 0x41bce1e1133b51de, 0x3a3ae42df81ec35e, 0x7eaada0f42d47cc3
+, 0x13b138f1048a57cc, 0x64f98abd7e915a8f, 0x7af195eb16a0c732, 0x11be81a791d634d2, 0x97d8df47430f61b8, 0x0767c7b381271004, 0x3e949136fb940aa6, 0x3bdee340cd956dba, 0xb250ec4ff91d2602, 0x4cde2454d47f59db, 0xaf5e749530d978cb, 0x5a8e2f2119d4d835
+, 0xdf1cb5425a0744df, 0x3d3b08a7bf35d055, 0xc6335e832de4719c, 0x6eb8d97e09154d42, 0x2f6a3f8de3d20dd9, 0x13f23cfd276233da, 0xb4a6b80dfc0fa41c, 0x58d876403acfd7d7, 0x2ad422078b8e139b, 0x73dbee2abbaf494d, 0x09a2758891eca3c8, 0x6ef9a9f1178b0938
+, 0xfc7e9ecb90c637da, 0x3a04345fc10b1a7c, 0xc024e9cb62f9ff1f, 0x6c4f9c3aa4aa33d8, 0x049d6995b95ac1f0, 0x2243845195763a1b, 0xa1466a31700ac276, 0x600fb7123a325905, 0x9d391a64a0d35a24, 0x3b093b550641f108, 0x2275de5bfd2e221f, 0x25f5e7465963db1e
+, 0x3e220107f7e7fb84, 0x6f06a23bc1b85a8e, 0xb4198d19f6eb0e48, 0x5dc11761dad45fda, 0xba303e492ab52a0d, 0x127c69c73da9f528, 0xd3a5b70cf6c790be, 0x0d72b0c50819da5c, 0x193f90d62ec2cdf7, 0x67f7d0cfc4f46daf, 0x7aec083d52f380ea, 0x7c0a1dda4a28bf4d
+, 0x46fd20fe6008cba7, 0x7a588c914115d595, 0x8fb1d3daecf45f78, 0x0851dac094e7b036, 0xcae0a76e2a32a892, 0x104f861322dddb2f, 0xb79d81e46e1f9006, 0x1e4d28d7a2498912, 0xaf3175d3974b89bf, 0x613d00f9a69c55c2, 0x23f6883e8e65226f, 0x072f7ed65c6def05
+, 0x6690e643bb38e243, 0x1a81c4a7c9189b15, 0x1056d1669e4749ae, 0x0137f2a7418f190c, 0xed3192796e699d16, 0x3ed76db45c38a37c, 0x78e86d1475a88243, 0x45985aacc495b16e, 0x47d5c8208e8f1030, 0x6dbe5f68b4d0e782, 0x08d3d0182cf7f26b, 0x64c375ce172fadbd
+, 0xba0f6db3a20c2875, 0x57e1d90a53241250, 0x0315433fddf8e63e, 0x33344750e37dad9b, 0x62cc0d28ae69b016, 0x435fe80f6100d547, 0x5874aea8669d3df5, 0x3b96913f8264d4a9, 0x738067d6bb1314b0, 0x48cccf24cc6f4ccf, 0x6f5e2bbd68b777af, 0x34c2c37ba9635d66
+, 0xd731534900fdbe5b, 0x4e4f9d97afe11d43, 0x81b41214351b73d7, 0x1d48d100ad11a5ae, 0x2a4ee76628e2b151, 0x34902e901877efb8, 0xb5a8561a0fd45394, 0x44317af6d5cd5ac0, 0x354c2469e9068bad, 0x0771fe2761cad022, 0xfda76ee8212d0f2b, 0x76cdeec6d4435495
+, 0x55c98575b3e825fd, 0x2983325ed5d73a1b, 0x563c4c4fb3f466e7, 0x731b0fa413338bb0, 0xdeb519ca57a05240, 0x7a7e909b5c4f7351, 0xefb7c153dd2ab28e, 0x11ca1c865dee30b3, 0x013ca8348d9d7de1, 0x575e0bdaeee8cf9a, 0x464c98a21083af7f, 0x683ddcd85c212ee3
+, 0x1171f0ab4cd02019, 0x22c7e01c7f4d64c8, 0x972ec0ef3f2e2ed3, 0x623f83c2611a476c, 0x99b3f16be9aa25a1, 0x2d3ebc5468990e0b, 0x5d5fba8546a4d5f2, 0x4716e6919d2986e3, 0x3ab2f2bc183f5d6c, 0x5f6257d3910cd4be, 0x341c6f2a78f94f2b, 0x6ee8390b8a5064f5
+, 0x9d8640b9b83ca8e7, 0x033c5ad24466be3d, 0x6f6cd68db30dfd59, 0x52aa6b1c0f90f3f6, 0xfe7bcd4c97403646, 0x11ab3fc960b05fb0, 0x24584b77575896da, 0x427f8deb932da137, 0x928a28cb505306f0, 0x04ae916fe863820e, 0xaabaa98911b9cd3f, 0x59e588ba994d9145
+, 0x9b8f1afabeee9e9f, 0x04ffc7ef3476ff8e, 0xe9cf53ce9937b146, 0x73fe42a801524448, 0x224bda3cf3bbaaad, 0x5fa85056d59884a4, 0x8e6eead48345726b, 0x09230936d41736d2, 0xe679eb58d1ad6be7, 0x08bb759b530b1eaf, 0x9688eb527860e24b, 0x13704d2daf9af278
+, 0xd9273ac71b906f14, 0x57ee05fbbd40deb5, 0xb7788e19ba9e61eb, 0x7967b6dc1c5d9699, 0x36e043fc230127c0, 0x2a716598bb2d519c, 0xc017b2840d4d1b07, 0x1d3bfa489f756a3f, 0x4ad73abf24318d36, 0x1915e6f53e12625d, 0xb219a7c941f89084, 0x2280087a8f4762fc
+, 0x8eb280345fd1b4e7, 0x55b8d4ee5772fd79, 0xc9e63a787e2ce2e1, 0x685741adbda93885, 0xffb830ab11a3b491, 0x7e891121f9356428, 0xc03aea271a629078, 0x71c45932930a2639, 0xe7df192a6bf81795, 0x704aee8f183aadf1, 0x06ddb55a8a7a63d7, 0x52556d8763f3033c
+, 0xb76b458c6f0c33a7, 0x28666b87c362b95a, 0x365ae575a4c27b9b, 0x36ef35110562adfd, 0x89955dd8d927f9c7, 0x526e787d6a586c9e, 0x762e0bc4eff988c1, 0x6c9523b4b5ae4946, 0xe90a909688cfe95f, 0x658a7dc8b3ffada3, 0xbee148ba7a58520f, 0x6819007d8573d1cf
+, 0x75d3b5ec141be9c5, 0x4bc236ae634f3c27, 0x1192fa9b8b30e894, 0x4129d43e1d092cbf, 0xfcac068558bbea45, 0x513e8d87b8116534, 0x5377a179a155ecd4, 0x6c93531e5545572f, 0x727df81ba09aad91, 0x07527139dbc96250, 0x150320b1d8ba172a, 0x2281e85f60a1809b
+, 0x7164b7d524eba6af, 0x50d387163fea4ca8, 0xe90de17d62aebe78, 0x6ab369ba28c0410d, 0x17d07e315a95d138, 0x58b496352453fefd, 0xb87a04dbbc101b92, 0x40a8f0fb757e9b0e, 0x2148b48a696e64d1, 0x4e004a3a350c17d7, 0x17927e9f386b563e, 0x29da9cd441e3e3c5
+, 0x883d2dc357417213, 0x2e94653ff7862644, 0x53a37af548453df1, 0x04475db3c300b93b, 0x2d65fa4d815e7204, 0x231a2db74c2c3ccd, 0x1fd734c0cf4d97cd, 0x32d255c105f6d122, 0xbb74fd9201eb07b0, 0x12e33f1c81ac6f60, 0xfb9a6439bea97072, 0x52e14b7db9cdcbc1
+, 0x637ac1a91ae374cb, 0x1c8622c35adc8224, 0xeb786c50a64b7d33, 0x362823a7232a5893, 0xf22dafca688d472a, 0x18598f0e0237f7c4, 0x97b8497bfff4bcf1, 0x7abf4cb27a9c5b7f, 0xea47c44e3b3d95d3, 0x58728fe3e1827a43, 0x7fd3681a6df902c8, 0x6db1dbbdc413de79
+, 0xbc4effed1ac3007f, 0x7f31a54744887cab, 0xe6559b4f8bd2519a, 0x18a78ec5b0c241db, 0xf6e10285b15d2030, 0x5c1323ea219a8ff4, 0x134b6f20dd116b47, 0x5d0abddbc8998733, 0xa3c993938702e151, 0x0ab6aeb494f6ad5d, 0x8cf3b4beda1815e6, 0x546ce323008c2fdc
+, 0xa10eb5a6a78dbe39, 0x26d2e8a8b8457da4, 0x026ccbe31517d806, 0x2a35174b812f562c, 0x57d70499dd7a374d, 0x3368f951acd3c5e5, 0x490b2515f901062c, 0x316109e7c315c377, 0x32e20eba569535cf, 0x496a8c39d667d709, 0x5578096dc44d5e0f, 0x608a162ce73903b0
+, 0x6b2e65852cb37cab, 0x75b09a2e6ed609a9, 0x7ac84b3082602455, 0x7690cbb594e84b94, 0xfc85dad9511973fb, 0x738a74b08c9006d0, 0x83233fc939d5883e, 0x7fbfc08b5db3c9f4, 0x81a0e493fb5f7749, 0x2c255ef7e69a77c1, 0x234f02e609cc656f, 0x5960cf0b961f3cec
+, 0xac72940237b1f17a, 0x434e038a29d446ac, 0xca6a090e00d8b0c6, 0x1f1aad24001e473e, 0x6d64b6dc133399fe, 0x0899ba41e9dd4607, 0xca590b3f25bbf5df, 0x57217978b0d8ce11, 0xd6b4cb13da6de9ac, 0x3c88520cf564f75d, 0x649fbd5075a7757f, 0x3f2593b90fe72161
+, 0xe1bee53e91dcc9a8, 0x010069dce4c74a92, 0xef83968978aa855c, 0x6cd8848183b53d73, 0x0b3df59610e403eb, 0x713225d446180a7f, 0xcc23112cc59850e2, 0x105796b670a3730c, 0xa147f4ec7a2fa4cf, 0x32da1f072d75b253, 0x4e7007455e85f560, 0x76a5376a771fdd60
+, 0x47eb4fabdcc699f7, 0x4e45db6334c6ed96, 0x36066f2bab72546f, 0x04f48065593ecdec, 0x3fec02793fbb5601, 0x122f74626b64a526, 0x21d0f66ff83b4dbd, 0x1370610ede647f1c, 0x57b82242b88172c9, 0x527dcbadfdc65ade, 0x5e9c9a04385c93f5, 0x64d1cf9e52548a6c
+, 0xba0073337865c994, 0x633ee14e50bcd615, 0xf840228ec4251095, 0x49bb96812a98f08d, 0x82f57d0422f96678, 0x06d7e43bffe7e0e1, 0x33910cca752ae863, 0x04d46e7c66087e38, 0xf14935c4167017c3, 0x3f22e2f44d03c9ac, 0xa6196244f2cd6164, 0x15a2b4ce514fa4db
+, 0x5191a04c4abbd0c4, 0x0e763360ecc8a19d, 0xfef583c184a673c0, 0x75c2f30a7c7433e7, 0xe947a55547c7c099, 0x245c7ae44f6e7a83, 0x67a666f9e6bec2d4, 0x5de0b922fa645ac8, 0xdd9b3e4a5cb72e22, 0x0139c2c857adba8e, 0xa7feb68e863ac231, 0x501381ef88ec2da0
+, 0xb2b8c6a470f40b01, 0x051d65bdb8363062, 0x4ce90414a6d65714, 0x1e510b525d19df0c, 0x569e723f5d374cf6, 0x4bfe02fd38fde1f0, 0xae7459ebc50f9aa2, 0x0f7e2cb170dfde32, 0x3c3da2326a7407cb, 0x0cfc50a85ffd1842, 0x62ab34c85e85c3c8, 0x22b4d9644bb37333
+, 0x57d313b3d87c2d98, 0x4f432c1cba49133f, 0x6163d11fa4befc0c, 0x1ab94e122fddf12e, 0xfb7c9358aefc85a8, 0x5b20068f81d949b1, 0xcf8ed6ff2145c810, 0x5794afc021932d00, 0x5c8987ad9b6e35d5, 0x6bb1f4b836fda03e, 0x794f1fed4a3ea1d7, 0x0cf6d128deb0e7bf
+, 0x54ec3e1c65878cf5, 0x002811763ba2200e, 0x382d917051e77b71, 0x49e00cbd013a9e7f, 0xccf576e9a4cf019c, 0x4b4a66287970333a, 0xf772168915edfc1f, 0x278eb5eca6479685, 0x8a95c8b9cf41cf06, 0x6e58c9c7826d39db, 0x478e119889f2fe75, 0x73ecd21991bd98d4
+, 0x26e751fe9fbb9502, 0x29825b71b0632e95, 0x21668f96ef8bb5c5, 0x2f2a899e53c9a004, 0x2803292ed4345ce8, 0x72731055c7c65dec, 0x3aaaca9c4b6fe9a5, 0x6228d3ceda8bd671, 0x773e2c5effc48eaf, 0x017ab19e0fea9ac9, 0x9609e10496c8d766, 0x121e89f9b302c30f
+, 0x4e87d00a0be96480, 0x09bd8d170ba9dbab, 0xc6756f947ecd4e52, 0x2c9e40bbbccd0f5b, 0x42a5b77669fd812e, 0x66aba9583b080d9e, 0xee55df99d16e77c1, 0x4cc00c5c5eff2509, 0x8c84d5e20ab7c16b, 0x00ae5c96184ffefb, 0xb295e90346dcef54, 0x5d1bda0a39dc3b72
+, 0x75f92d72a89b5ef2, 0x259d998c9ff9ac0e, 0x8a1cfb72a6c433c1, 0x23f5b71d49d67604, 0x478d8f30914f62ef, 0x08fe61135218eca9, 0x4da2ce9bc6488c4a, 0x15f1eafd35283e2e, 0xc2d2be3ebc42ea0f, 0x2a5216539d6ee902, 0xa1e99052e7bdeeb2, 0x3a8f2631ec78290c
+, 0xb71518a82ebfbfe4, 0x24700671c46ebddc, 0x6ef52d591a221f75, 0x4794614db6a67d92, 0x761f5c8ee4bab607, 0x31d9dd8f2361b5d5, 0x1a45593be8db3b29, 0x7f06c365eb116260, 0x9d305a66e52eb65b, 0x5edcfcb5613eac18, 0xef34fd28154adb75, 0x790f805753b9d742
+, 0x6ecd5ac255dfb797, 0x0cbe14db5d9a88db, 0xc1c86c5efa815528, 0x2c636133ba59d887, 0xc75d42c2d9f52297, 0x4bd3540c21e2ebd3, 0x32e7cdf790de6903, 0x1aae3c9837d3e30a, 0xeed028e49d436f09, 0x779ae12351efed1c, 0x6e0145587d9797a5, 0x25156e4cee9a407b
+, 0xac2fd82f2ac57119, 0x7f8c026f1d182ed2, 0xeacc0d8fb3241611, 0x5968db65d2d7545a, 0x7d525846b1121dbe, 0x57949fd7b80339cf, 0x471fe9bec9b66c01, 0x5c270057f1268efa, 0xce092463083f656e, 0x16e8241cdc862cf9, 0xb7cb2bbcaa06b312, 0x3c25936bd8863416
+, 0x19b8ca966c4a3827, 0x1ae43badfd21e63e, 0x1dfd002b95a6ac6a, 0x4708e27f6d98e997, 0xb5fd6322dc31ac7d, 0x53baf4d9a16dd550, 0x025aa2ea5463960c, 0x5b5b33c7a3cfa54f, 0xdba287866ee96b90, 0x4748c1f3f3a6dc4f, 0x2333ec05a80c154b, 0x4a47745d5b99fb96
+, 0x7de331eaf403d7c6, 0x2dbf3a9f975a4b09, 0x175a8ac5d108224c, 0x6697ae0ed57bb18a, 0xcea23805c213e2c3, 0x59f1b8656d5690db, 0x4baf460a10b23798, 0x0077832eabd82e13, 0x52888a23361cb298, 0x30bf5295c5f64491, 0x5960339ec97719ea, 0x5325cd922cbb3403
+, 0xc5188bd69618e85c, 0x296f922d9ad41fc3, 0x2da59f8bff5aed90, 0x2662cc4c60ee7ef2, 0x22aca98c8405b59e, 0x043bba596dcffd8e, 0xb467008e9b87aa31, 0x1d65fdb88da19ed3, 0xe042f460ccae713e, 0x101118018bae77e1, 0xd0f26b4a5d91d8ad, 0x40770de987e00c67
+, 0x53ab21e43a35ed5b, 0x341f9cd6e64e6c84, 0x6ef8e7e707c1414f, 0x33610011d1f942e3, 0x4b019af5f2f8e85e, 0x12ad7ab4b14cf6e5, 0xc718480b770cf12e, 0x7bda44448dcbf840, 0x98bb0351df202365, 0x4b38527c6dce9c01, 0xcbd28185a819ae02, 0x7a19bcca37fa59b0
+, 0xafa3722439957660, 0x06ebdaf0dbeb7593, 0xde81597f08c3ae81, 0x33b9907bbb96d4c4, 0x3f43a76561db371c, 0x0e89a1fb68f278c8, 0xe5aed79a0680ced4, 0x4a032dae33d5d6db, 0x2db5b64487ec9e21, 0x4a8ca714b7795d2d, 0xfe9bd0c1cc1c91e0, 0x0bec01459b9b7e42
+, 0xcfa0d0003cb14725, 0x75aa85468a1e34f3, 0x68f5bbd1abf452f3, 0x249a902b7ea02a8d, 0x71ca331692213631, 0x0e54b1b6ccfadb84, 0xd13bfefa0cb35163, 0x618352c16fb97576, 0x6b6ce9a365e7e495, 0x60a6cd627054aae3, 0x1f7e7b55d56dbbf9, 0x58d1869caa022006
+, 0x20ce35661383a949, 0x4ec74a9307323d21, 0x7fbad803d6c7844d, 0x2b23d3a55363b681, 0x061c0444341b7999, 0x7e4ad0cab9534234, 0x7b09a8cd488f6621, 0x7bde5e652073500e, 0x906f8593e41d1d0b, 0x1ecc6829240726a4, 0x3de8b88854db49ac, 0x3cb4c48361531c6f
+, 0xd8d85e6921107a60, 0x24e554cc92a75021, 0x6b5fe5fcbcc564e4, 0x0b5de8db2c7373d6, 0x166518f4256f8548, 0x57f6145b58ff55fa, 0x6bdcea5977343779, 0x0b95e29ab237a201, 0x193c9909e331942b, 0x4711abbf14e0a184, 0x686611580e5381ac, 0x308709f072c2db2d
+, 0xeb5589ddd7d9a990, 0x5b09e1a65ba35eb0, 0x61f6c9a74817e89c, 0x4e22f6a84c22dfa6, 0x112d33a0173d2f20, 0x193ea2419f156077, 0x10d1fb4462291b6e, 0x3a04fff11f9c8a7f, 0xc8e86ce9453dbbde, 0x75d32f976d9e2215, 0x6898256d3553df64, 0x4a38a72818ce3195
+, 0xba7ab98e8bfb2485, 0x5df853641e170004, 0x5f481c3ad7b3456c, 0x4825b571989fa56f, 0x3e0e2e6b4f655362, 0x2c97bd263589ab17, 0x7582463ee78c2347, 0x70e9bbec916bccb6, 0x0f36d4da0df4cc36, 0x30ee10c22e770e49, 0x0f52b5b93f9d6b09, 0x4e1f3e3530d38a79
+, 0xa19c54a8dbefa553, 0x747e26c087af7d3c, 0x5acd907ea3af54ca, 0x4d31ef8cf53a018e, 0x5b3481e0e6e631e6, 0x27f2d6af0fd5f2d0, 0x1ff3ab052ef11644, 0x01e2dcfbf701b419, 0x6ad2af67df904dfa, 0x204c02189e92877e, 0x396203c9981e6c88, 0x7c958b47c85df4bc
+, 0xfed2ab02e210a9ff, 0x3eb4500e53357ed1, 0x70ec77b1917fa474, 0x64798f496ce73592, 0xdcde3ef7f5acd7ad, 0x6c28722996c55849, 0xa38e3d39198e4fc9, 0x2b67a90323847be0, 0x1b9c80b76dcd3881, 0x7e6827d0c31c22c4, 0xf549196c29955177, 0x70b3a2fa63f58460
+, 0x17ecf97299f1217d, 0x49d7e5395866ad72, 0x712713f371ffff5a, 0x2da796e3c6324021, 0xca7cc235c205f2c1, 0x5a191549c8fa2c18, 0x762ae5e9801d96bd, 0x3bc404f3dfe7ca55, 0xa435aa939fa68581, 0x2272fe5fa650d21c, 0x521728efcd0c954b, 0x6a87874ab6d92c7d
+, 0x08ec530527d95865, 0x213f4a6eec3b5aac, 0x01f239f264c69bab, 0x79d3914709659dfb, 0x0147822bf2e152d6, 0x597da9429eb1d00d, 0x53b186c4e48297bd, 0x780453c29f8a8407, 0x9d032b1ca55e9c6a, 0x095faacded03dce5, 0xf084a1922d90c84d, 0x3c7f3c63bf2b5d1e
+, 0x8ed82c9c8e738a49, 0x6c0a5ae703e53851, 0xe5800b12853d6516, 0x448567f95f0d4a6e, 0x48c5ce4694c05eac, 0x7abbb6d65f03c789, 0x3978f9f03a787ef7, 0x2bed3fb7e01fe962, 0x3a53d97b463f2914, 0x6bcd285fda5dbc99, 0xb4dcb1e7b4d21122, 0x6292a941103e4849
+, 0x2af115ce04087a96, 0x13bc28aed2ce02cf, 0x80084ed3b6b0bcf6, 0x7043d078ac6ec426, 0x57d2ebcfb8248e2d, 0x11037609977ade94, 0x2a47ef7b490f7ec4, 0x5e931f7f19313e0d, 0xef1ef971fe096895, 0x0a8ffbccdaa075e2, 0x56f429e40d8a7ea7, 0x6833e75b85f36cfd
+, 0xd35ce62175461a48, 0x74ec71e04d808393, 0x7f326b71f59deb92, 0x29c5d31fc74cb57c, 0xc9a1ba0ee1594691, 0x50309cf410c64327, 0x2f1c06585982d6a6, 0x7e5481e973d8226a, 0x97c6d087edd595c2, 0x737206f6d0a1c07a, 0xde2e03bd7fa23561, 0x656d72cc6dd817d7
+, 0xe10b039612b94505, 0x2d6fb956ed83c3b8, 0x4fead845e2941bf9, 0x41a9ae74c104a27a, 0x1529d99120b05fcd, 0x11eae3edba5f0c95, 0x50abae45600ecd7e, 0x216ca492fe86592f, 0x8f7fe5f6c767b404, 0x2909c3a245709855, 0xe06c3c67a52efa72, 0x229e540a8a27b7e9
+, 0x2363d7a3d678c9d0, 0x6c4da342c773bff1, 0x79c1c73458efb069, 0x0df082e7147a1f13, 0x097ef650bc872e87, 0x4b7f2a5c47b70332, 0x6ebaec218476d2d7, 0x4faf61b79d35ec9b, 0x10d2b8821a30d816, 0x7110115345446cc3, 0x233e2392b970b008, 0x0581dd500eb0810e
+, 0xb5eeb1bd02dc638f, 0x7ac02f76f7a98d95, 0x68eec55246772fb9, 0x6c96233bad65e418, 0x97f6d9c27ee5dad0, 0x7363cad93efc076e, 0xf56a5ae899248a44, 0x5fed54ab474b9cdb, 0x2541a9ed8c3cff4d, 0x1ff71adcba409ea8, 0x23f6903439f5f49a, 0x5ebc02ab425f29df
+, 0x47330d9c9cc86c9e, 0x0922b6484d6315d3, 0x2c92760fb309dc39, 0x69f2d4c42982053f, 0xf60b0b3692610d1b, 0x4288b2529eed2487, 0x19f6df8e728518e1, 0x7ed72df2ca9d2e0e, 0x000be435e9d94394, 0x4269bae655dfd472, 0x4b9fc14d4d2cb063, 0x4960151c560696ce
+, 0xad5af562181141df, 0x42fc7a987541ac37, 0x48a958d5559d0784, 0x55e915ac361b6945, 0x28d5cae68365a9c8, 0x557a923ad4f00fef, 0xd8de5906f7852678, 0x366730dded2f8fe3, 0x50dd40314dda6401, 0x51f1ce228f4648c6, 0xc60cd1b637800e70, 0x2c0425c06cbc5e11
+, 0x1ecea34de4ec51d8, 0x428b6621bb3a90f4, 0xdd5f32ea1db8352e, 0x125f8e393fb2824c, 0xa924c04732ee23a6, 0x05b648f88943e747, 0x69210c31b0bf5fef, 0x34c8512a7c606a2c, 0xca82c22008e028a2, 0x68dba8d39ba88759, 0x82a7279fafe0a9e0, 0x4172e55bebc009ba
+, 0xaa0903c842c194a7, 0x02a25da5825d30b5, 0x92fabc9304221a84, 0x63ae6bbfbf946e83, 0x3252c55aa1907d39, 0x7c88bbac57601e5d, 0x774b6b062e09ba6b, 0x779d80c17d8a33fe, 0x2fa605a0625cf2d7, 0x398e85db50b93dae, 0x83b949a88e464a67, 0x1aa90b6e44a1ac65
+, 0x00d8bbfc769d36df, 0x639b97dcdac7e245, 0x6e2e4286997776ab, 0x1b2bf57698602100, 0xe0493b978d4308ad, 0x16fc7d83fbb17136, 0xc27f3afd419c4027, 0x5ac8996edbeb49db, 0xeef91deb27083cb2, 0x6b118dba1b751084, 0x065678cc7ea61da9, 0x396d10a86ea9c22d
+, 0x79063e14e21245f8, 0x71f68e22554b9fd4, 0x90ded03c6a76eb57, 0x7f5683844a44a054, 0xf80896746da52b87, 0x2dc9cf1d0a44727f, 0x8f77f3a17026c613, 0x160bc731152d577d, 0xf4c8fa214ae0740f, 0x008fcbc4b5c4333d, 0xb193ad74c55794c5, 0x0e6d79dc26409465
+, 0x3ab520687585ee3b, 0x69ecd0abb4476b11, 0x40116d615ce7caa6, 0x7dab654340cd862f, 0x0c643cbdf1f722b0, 0x4e22e8f0481847ac, 0x578be8fac849a9b6, 0x5a92c91d6c7a463a, 0xe1c42011edf6bd08, 0x20df122eba94d963, 0x1df44d1d95c9cd29, 0x618527ad2c979ca6
+, 0x21a497654e7038f4, 0x17d66e95083f0b9a, 0xefe5a140ae72d56d, 0x53839e315a8cc027, 0x0baccf35628e2857, 0x5c2d100120fe95a8, 0x0a47af78f5b22ca9, 0x7797ddd43b58ff8e, 0xad64d75d1d63e2ba, 0x5fb696108970be6f, 0x02bf12e23e5bd0d5, 0x3d8ac9db92a62e0c
+, 0x3daf5b3ba4627ac0, 0x6c98ff5285b52420, 0xb4885b91176bfc22, 0x38fb84158b8c3f0f, 0xa9b5b6dbb2377aab, 0x68ab86180fd8d43d, 0x1d236cc012c4ab78, 0x2d4b375b30da0712, 0x3ed7120f613bdfb0, 0x4de3f1c513ed06ad, 0x4a04841acec7d91a, 0x7d1b573f27594e36
+, 0x6b71654bac4e167e, 0x15e6407197c7436d, 0x1b4b2123e788b92a, 0x66278be32bcd713e, 0xcf31aaaf54702468, 0x48566b8097851ac4, 0xd48a06a5898da730, 0x00af4e04ba87862c, 0x9da474c9454f228a, 0x02fa8a701a1d55ae, 0xb72e4b299b467227, 0x4c4f80ed606e620a
+, 0xcf594ae7453bbfe0, 0x502c363b8abd92d1, 0x22da668e7767f41c, 0x14f1a98bf7e5e593, 0x5ecd14a4187635c1, 0x60369f5a5d787276, 0x1012a0458a4dec24, 0x75a59f9428e9ae1a, 0x6f9e13e07e9efe69, 0x6fd9f4de56241c82, 0x86a417aedad9e177, 0x381107ef34fe0888
+, 0xda76a2176c979ca5, 0x449e8be61bac95c1, 0x201ebbfbbf27376d, 0x29790cc15a4e7ccd, 0xb51c7b2ebfcdff91, 0x0f3c5b76961565cc, 0xab01c9b01a8fa53c, 0x2a30e527c88a1bc0, 0xdbf2216dd00153f1, 0x370dc4bc432e0815, 0x8980ee99bf0f376c, 0x13cd165b4430e38c
+, 0xc7b66be019616235, 0x7de52145c16aabe6, 0x6fce19a4c2160133, 0x7177b857ddd54f7e, 0xaa70a16e210ea129, 0x0412f7e6ae45cdac, 0x23c54b48ce6976cd, 0x4972202ff0622d47, 0x553682281363ac67, 0x4c5d892f15f94243, 0xdd3f60443ea0baad, 0x5b1ef37966cc5b73
+, 0xe0f0e3a31bef51e8, 0x0b2a541edaac6981, 0x69539fab5be9555c, 0x3e624340a1d34ca0, 0x37db080a75ef381e, 0x57366bc799278e0f, 0x9cfea6d6e5918b89, 0x65314e20020383d0, 0x24a752a3089995bb, 0x31d8e53d80cf6d3d, 0x9eca917c33eed711, 0x4700a89969b2e222
+, 0x78a826d5bb364329, 0x5b341783804dd4f3, 0x16b3921143fe7a9c, 0x2119679d9fed6f03, 0x84284df0b4afd4ba, 0x3b8a5e7af8f74954, 0xe663318edf3ab780, 0x2193954419aff9b6, 0x9d6899d7297175c5, 0x01fe06de9dc2aa6f, 0xe3da5400551d83e3, 0x32b973ed718172fd
+, 0x16a03d2cfd5a3d34, 0x4f36a37747bcc291, 0x70fe0abec210ab43, 0x69cb9936162b2ea7, 0x4f9b5301cadad19e, 0x32a2938355c03cd6, 0x2e4849a3107eb06e, 0x7a30861eaef4fe43, 0x87095b2a71c6b2c2, 0x26904118df8b2972, 0x4161551e03f82809, 0x5323b605512125a0
+, 0x4791ec410c13ac42, 0x3d0abf87d56b11d1, 0x4a666e84fe9ba3d5, 0x4f3e5f59eb34aef9, 0x3c801b09f9d4c694, 0x53985943e8909586, 0x0c99618bb496ed1c, 0x61da8dd14cdeca2f, 0x8810a12466ea0030, 0x2dc8ecd8c641d614, 0xaf343cf2ee41fb99, 0x10563936c2979426
+, 0x624fc1ae14ea0ebc, 0x6df482493f9e1b72, 0x916db66b075e1de0, 0x6372c81016d058b1, 0x7075f92dd6476b2f, 0x05cf92e8b4c37eb6, 0xd9f61e57e037c1fe, 0x258f622f3f28cfed, 0x6b6082dc871927a9, 0x2084603b65e7324c, 0xd2adc29e4deed0c1, 0x45b185654f4b6a7d
+, 0xc67d6abba2cd7077, 0x70e37e300d70a93c, 0xcce5e4eae0abbc54, 0x6ba8f95309073cee, 0x38e483cdf1807dbb, 0x0a25b8046c17d45c, 0x6cf18dc8cfd49ff7, 0x2c46fa9bdc20c983, 0x47491c3842059704, 0x3b907a5142ada29c, 0x891f775524f0bad5, 0x57f62ce63c84ea8b
+, 0x1ffe528f4308fef4, 0x58633e53ed640845, 0x4f3f4cd88b8f7992, 0x1b485ee1731a3679, 0x8859af0f84cfd821, 0x7c194775a2626e5c, 0x3c218f391e18efd1, 0x273456b04eb50e30, 0xcdfb1fd0c3750ac4, 0x379a20510493866b, 0x0d7309a5b41df649, 0x04fe6c30c2b3400c
+, 0x5dd110b2173e006d, 0x5ad1321def2db1fc, 0xef3afacfaeae905c, 0x2a586a1df422eefe, 0xa12f1ec34350cbc6, 0x787f13361a7d8dc1, 0x834a775220575674, 0x398f935de6dbc950, 0x2372945941d6bade, 0x14b63d1596a87374, 0x59e2bb71dae3010b, 0x6df6892578758e92
+, 0x18a91147ff0c3475, 0x29339dc736f5eda7, 0x94372aeb17298090, 0x03cd4b6762c4e56a, 0xce5454a4123630d4, 0x22bb03f7e1b24d06, 0xa78d2acfca390603, 0x635418dfc37f8b73, 0x8dd7c2ee0ab9662a, 0x09c8d1424647357d, 0xaf10b9e2fedfc4a9, 0x52805f675de06d66
+, 0xa205c36834ce683a, 0x4a8782e35b58269e, 0x4a952d8a39091ba7, 0x68048b2d283f0ddb, 0x0ddc690ff013cca1, 0x493acf228058bd0d, 0xfef16c2230d30df2, 0x2785fb5fbdbbe4e8, 0x20ea6062fdb081d1, 0x3f574f8a73cf7908, 0x66fa42434d03fc08, 0x356e091e12df010b
+, 0x20d3cb8185648b99, 0x5a2b83332dec71af, 0xb4204e7f674b1129, 0x10c089c9040d8234, 0x6861eec4fc63f315, 0x67d870537ccc8f73, 0x79b7be27922150be, 0x00c2b5860d903eea, 0xf92d81b78684e4ae, 0x46b1231b49a2d411, 0xa4ab75697858d0ef, 0x5f0db595046921a6
+, 0x83fc50168359a56c, 0x31a62e680a5c717d, 0x31a81b5967cb9b20, 0x71f8e71498a8e62e, 0x4a9e14333cfb805f, 0x79e12b4ca670ea86, 0xcaabc8af8fa0d204, 0x15134e528e6bc672, 0x30db5147dea6af32, 0x70c0b127445c7e38, 0x4b6eec2468ec95c1, 0x5f63f9eb908145b6
+, 0x6a7868a6cacfa060, 0x72754038f1ec1fd1, 0x0891f310df745f7a, 0x0c9658009b7aa5fc, 0x1085b6c54a1c35b7, 0x05a78950af27371b, 0xefa75ed68da664b9, 0x28193357ef9301f2, 0xd210231d72688084, 0x0c4722704a2a30a1, 0xc362402a362d0899, 0x32c18e242663a442
+, 0x9014857889ef7219, 0x68d5e66737eadeed, 0x2a80d6a2ab1f2ba1, 0x32f9acb9e1aa8c73, 0x26949b1346ca4325, 0x4318b819afa37b98, 0x644e741ed72e3c90, 0x70b52851302b6904, 0xe53a7d1e15e1d234, 0x3516d7f96ef3ad01, 0xa3240982684e76e7, 0x74a91ee1f288b565
+, 0x77df389b8242128e, 0x413c379e1268b023, 0x33c254209ea6bf8a, 0x70b91584d25c9e0b, 0x158a9cb257c45f45, 0x3738561050e086a0, 0x0303f6a517843483, 0x19c30266488a2947, 0xc266cf4e80c9fc0a, 0x62ca21b9be983a18, 0xc1fd17de230e7183, 0x5dda4862cf241baa
+, 0x8dcb31571aa1d430, 0x760480607337cc65, 0xd7ff642ec7b290e2, 0x61f97996e29cf758, 0x18e72489026a0a2f, 0x4f0b9dddc0b5718c, 0xae46384365a11860, 0x63d2350d7c1df8bd, 0xf0176f562f8629d6, 0x73bc81248804b345, 0xba58474a0daf1045, 0x77770def17498083
+, 0xf79a0352aa7eeb65, 0x2707e8b5debc592b, 0xb06b1e71d7a99cd0, 0x65e97567c8fe0d73, 0x486f3856e13e7626, 0x50de3156337ab93b, 0x1be4d6effdd124f7, 0x4d58403c76f0473e, 0x7bc6b7097c783993, 0x0112ffdf51a85117, 0x268d3ba82267a5cf, 0x63de8cf19e07776d
+, 0x03b7f01fa786a02c, 0x358505ffb43fc5f7, 0xb335dced80426e71, 0x7d1ed9bdff932f5e, 0xf0fc43032119bf4e, 0x65ace2914bf57449, 0x3e7cb029731c4b3e, 0x4c67d23b8ee2bf2f, 0xf9e016fdb46d6077, 0x079b11429831e813, 0x5204f1f3f09907e7, 0x4246d9cadda327ad
+, 0x6594eb84824dc52e, 0x60a8b8eb91630a55, 0xddf1ccc868b0f311, 0x4607b9cd41d6eeac, 0x603b69aa55e2caf6, 0x51c689f5e5a0011a, 0xdbf7e269da5588f6, 0x47ea73f6e792d570, 0x811d62bdd7435772, 0x5f2d28030f8e6aa8, 0x0214d3053977aa00, 0x6513c0be4c61ae2e
+, 0x026bc9ae4fed6c91, 0x21f3cc9de5d5941f, 0xfd4c1c7af197bd19, 0x1459c22f2a67f567, 0x34e74a259a7167e9, 0x093aac658d9a1aee, 0x23819fb7c701e784, 0x24a380f20acd36bb, 0x62b469ef30686e1f, 0x59b3429775216465, 0x46bce0e7fb2a7b02, 0x1bdab2ac6702aeb1
+, 0x72d3bab333fed7c6, 0x6dfe62ae54757ffa, 0x92c912d0e31cd7f8, 0x5af090da6a033e44, 0xe542380afe3516c0, 0x3cecc63e8059faff, 0x05d93efa14f84cee, 0x0cd0d735b2bc51c0, 0xdc0d65ee5006f717, 0x18eb83338cd44e4c, 0x94364ef9f7a0e763, 0x3a703c45b5b79b5f
+, 0x1ebac624487baa62, 0x003218158c03b754, 0xcfa845f2c415578b, 0x23075abc3f7badc3, 0x26f38842c86eddd3, 0x6a2efec55b6d91c4, 0x33819136844a3dcb, 0x771006752a0dd159, 0x4f75a6e8564df9dd, 0x047c12f418d78b92, 0x107ecd0464130bca, 0x0286c41cf751ee93
+, 0x91b1b88cfa3409d6, 0x7a9da6e4c8c225bd, 0xcc19766cfcb39bb9, 0x5b8c15aa25f24768, 0xc634c02c97c733be, 0x638321e7cdc0e1a9, 0x57bed72b92740e9a, 0x1f9cc67c4e780e09, 0xb2db50ce372748b3, 0x622390c699692705, 0xdc2166cf52b4aa73, 0x2d9997fbfd281d9c
+, 0xb683cb37808c7422, 0x48e077b394f27c6a, 0xaa9e56e70a9a2cbb, 0x565b15f48ef22b09, 0x3492f8e0f0d59730, 0x25ad9ae790f6a474, 0x55f94b70439f7ffd, 0x60fbc4761f60d147, 0x2fcdecbae5cba6c8, 0x60d3907dfd30b1f1, 0x06132ca073ecb802, 0x77c16d5f82650f5d
+, 0x65d5d0b321bf012e, 0x1d8230c02bd7afd7, 0xae5dee32ad1fd1e6, 0x49eb4eaa577e0a0c, 0x80b07fadffa62071, 0x212d0b36432f2580, 0xc105d063f6f5d87d, 0x439d2da88e83ecbf, 0x25061be2b2a6e9bb, 0x602dbde636ecd30f, 0xc31c8a5678c11bfc, 0x0da2ec0c791c4434
+, 0x494a6702ebd3ca8a, 0x7706b177fbc70078, 0xa0d923f7436e17c3, 0x5352d29eef25ea48, 0x625a933247a347c6, 0x67b0b475011216c4, 0x74df29a571bbb5c7, 0x3d80890ae7638511, 0xc69f4ff3a09f98fb, 0x1af46d1de77327de, 0xaf5419127803d1f7, 0x5c6b1c0fe26b6b8f
+, 0xf9d2898eaff8d376, 0x0236a56a55c21cc8, 0xaf4a10854c97b1db, 0x0fcd1300b182d51f, 0x896f551e5dddb547, 0x5da4c2eb48f1366b, 0xffe2d68bb9eb82d2, 0x7c66cf6cb2ef4cb7, 0x21313dfa0b5b1cb2, 0x1963d5ec5fffb471, 0x9b79ba03e7b8dc8c, 0x73a5b065748222de
+, 0x11f618700b377379, 0x238106c5f861866e, 0x32330cd5c0e077ce, 0x62ecf690a361d071, 0xac9cd6eefc23f1bd, 0x47275551c2c19f84, 0xad8e7bd5ee6cb60e, 0x7364b8069cee33e6, 0xaa7044ec211b56bc, 0x6742ab7e6e4e21c5, 0x81b8d4fca63e031e, 0x01f5d5aaeda25bb7
+, 0x9ad3e9e89d85ab49, 0x429a895eaaa04a37, 0x81f10de3c18a69f4, 0x65feb0fecc8c6358, 0xc46d7efafd422aba, 0x59a633001933be68, 0x2fe7f4c38842e8b7, 0x200bbe14c3386a2e, 0x95538e34d23d2260, 0x29be712859f7c4df, 0xe1c0741312c8b473, 0x18ed5c36eb363d91
+, 0xf97d5c75e55bfccc, 0x2e8825862fb23092, 0xf8a9b28891764220, 0x41688a475d6094fe, 0xf9accd4dc8303b1e, 0x7ca15f47726948e9, 0x49b81f50feee7499, 0x7681b4f892ecaed4, 0x261869e739d8d767, 0x10e1b2fa41a75abb, 0x4983005e2e1c2c82, 0x02b7f9d8fcb3a91a
+, 0xd98d65e78e7b9f66, 0x43f503daf84e63fd, 0xfaf7dce82ab1c791, 0x39fe687010b6be85, 0x6d2cbb64fb7fa175, 0x4043579c3740ea86, 0x41b1cb9f76e0102c, 0x726b0114af6aced8, 0x11baa3edbef2b73d, 0x3be648d1315909fa, 0xb6344e40049d2111, 0x28921b0abc311e27
+, 0xd29361fd8e8da56f, 0x4ac502b07b28f917, 0x1eef67d4510b8630, 0x737c326b11572eb1, 0x9234efe8ec438d2c, 0x22c49079eb038670, 0x13244c23055f2c18, 0x344ffe71e17103ed, 0x2c65a3f47bfd1056, 0x0438fdfede70fbd6, 0x6ac1e851f72ff65e, 0x1574e3b649e476c3
+, 0xdc5cc89931480327, 0x1d85445c67cb7048, 0x9d71054013d30ffe, 0x4dec44d8cbe25bab, 0xd6b8aac8670e49b8, 0x5a0f19f1fa459b61, 0x75c233326d83fee1, 0x69ca5ee63c9bdc74, 0x7a33a5a16714efbb, 0x209d8da5e0e4a035, 0x9b4572e1e6e92122, 0x4c0d8c596e57f42b
+, 0x5949b4d9e0bbd51c, 0x4675c1cf64aebba9, 0xa8791ceffe8558c4, 0x47c317d4c3ac10b5, 0xb22de6b77317583f, 0x255155dc8d32edb9, 0x7b09723e02522d67, 0x30ed4b9ef0e6462e, 0x22accb6676a95047, 0x5526d4f393e6d308, 0x0f4c7a83ee25c1de, 0x3f78f81d7c097871
+, 0x1484823ab51346dc, 0x43e8e91ebbb82cf8, 0x855297b029c003f5, 0x0f16f5c6fb51592e, 0xf54f4f8869159cd3, 0x634ca6f6490fa0fd, 0x6617ef45e9cd8fca, 0x2da4c9a6a83d630c, 0x374ee5c45e09d912, 0x796558dfaa0cec4e, 0xc5cef4cd36a4c27e, 0x28401dcb11137b42
+, 0x822ac82602224e3d, 0x2b04edae5e8d6e6c, 0x8b0b78e5696fb06c, 0x06f3229a7243d703, 0xa8834b7b2245ec4a, 0x08ce0e54a9fa8a7e, 0x81ba206b6456c459, 0x2c1d6c1bbb52ced6, 0x2f33909afeff16f6, 0x604431af1ed982f1, 0x6a8476a5da77d214, 0x2b217f5c7e384388
+, 0xbb75d05046de4c4e, 0x34e934d108a0996f, 0xcb4c13def18696bb, 0x4291d7afab5cd8eb, 0x6fa4e158a205689b, 0x1ce71b4a6b5e1782, 0xe1af65e28457a7fb, 0x69a121857482f041, 0xd7bd31a1c8f9c12c, 0x52973719dbd6ad44, 0xa6acebf9cc5f18be, 0x50e5ac2a514fe90e
+, 0xa096f0423c7e2b73, 0x3ff11551cabd98f3, 0xd8c6ed1448eecab3, 0x305831e132db407b, 0x691ff7fcdcb7fb85, 0x5c52e6f3a0ae4ab5, 0x354eff46ae47e795, 0x0f2355d7fcfcc941, 0x530f050dcf548e33, 0x431274c516f61298, 0xb5a85488ee25e66b, 0x19099434b0f65880
+, 0xe5dc623e3babb538, 0x7871cae3b0a2726c, 0x8a28bbbf676523e9, 0x04fbb56b6bd49c7e, 0x9df31abcee96e05c, 0x1de36fd9ad5304de, 0xd2819927ef07de10, 0x5afd6548ec345c8c, 0xeeacf11ff57b6f0f, 0x7d6701241c8865a1, 0x54aa90dfcf52f82a, 0x7698bef07cc07c46
+, 0x04daa787e22eb67e, 0x15d461b64bd952ad, 0xca314bfb6c89a5b2, 0x2654fcc546c27687, 0xf189a2cfd96caff4, 0x7771c4c644c747af, 0x5666e1119610ca54, 0x316b15d7804961b3, 0xee0c84610e1eb836, 0x4dd7128ca90f1378, 0xbc508575f537cede, 0x17ede0be5cccc4ea
+, 0x507ac955c04173e0, 0x39ca8d9a7f132ffc, 0x24f55ad22a159daa, 0x79f3e0923e4adb09, 0xcab7f11e87f3ddac, 0x54137f925fb8bf28, 0x6a30cbd334053a6c, 0x569806b9a8983c72, 0x3593862bd49b3052, 0x711c94e6076dc6e9, 0x10f1679dd17dbb38, 0x5c97e53e863d51d4
+, 0x1bb36f907f8a4183, 0x0bf5ff578ae08a44, 0x04db7e5fd7ac0c2a, 0x05d93d32a5413284, 0x5781a742880dafcb, 0x135864180ec90ce4, 0x0a591bbc2e411072, 0x39c0c882e1a440d4, 0x193a84ac40bde23e, 0x0edb094d1652c11c, 0xadaefee872d45f22, 0x72695fcb44976098
+, 0x05c86cc33fe7bd09, 0x42946b4be248975c, 0xedbd78462105c02c, 0x625f29c07178d88b, 0x84c77873af8b992c, 0x5624c9edababf824, 0x73940f19221c0e9d, 0x6047f5baf0247202, 0x75f8fe828cc77f56, 0x167c134b770d92a7, 0xd073694cfac1a48f, 0x6747cd0df261d898
+, 0x422e9747b8deb773, 0x3892a45e8634d15d, 0x0b592cb6e0bd7da5, 0x74fc9a2b531f2fc9, 0x24782f3430aacd43, 0x5f92bfdf6fdede59, 0x175dafb576a2bb06, 0x01048dacff30cdcc, 0xdc8f3ee0321b9df5, 0x1c21d8a1d1817783, 0x6d9fe1c54cd3a0d5, 0x73298c741cdd6020
+, 0x3d3cdc03f31f81fd, 0x3aad019164d1012f, 0x6d5a5a7572c73ffd, 0x2417bdf7dc869d38, 0x6ffa7d46458e315f, 0x3cdd522ffde929c3, 0x06a17a20c2adc83b, 0x535f10d95f839a56, 0xa797344aa6648cd4, 0x35633828b4cc4655, 0x67be406a2ff668ac, 0x084ae76a8e00b59b
+, 0xd4cdd1104c5b7fc2, 0x2bfe747aee7d325a, 0x93bac5225864d1bd, 0x010e10174351acdc, 0xf8080d30ab4b9df3, 0x1a31a68c35550b2a, 0xce00e973a5a0ac16, 0x7956ffa4b9903290, 0x28fd83a277041969, 0x64e6327e373e2eaa, 0x489f4ef4365b39b4, 0x423314a3949cc9c9
+, 0xa0d01b0a11211ed4, 0x48c855dd2ead698b, 0xeb5ed796c6a60041, 0x3f588881923de14e, 0x661a1482b0faf06a, 0x39b4796da52acc42, 0xcb7ea05d1b4440f0, 0x0c8c65236cca2d82, 0x3f70ba814d2d2a2d, 0x1c7246e4c79958e3, 0x5ac1b7c5e0297435, 0x52e64b0cd3fd65f3
+, 0x0f49e6d4137c24c6, 0x45837e8d3b728b02, 0xd845c52c9fcae330, 0x4ef86690acb3f570, 0xd7c108424fe21943, 0x20b2c176746fd439, 0x98a8d44e7a2ffe70, 0x5e2db736b7fd98d0, 0xd09c1b4a1817ae91, 0x157c10d2d586566e, 0xef341b8c53d098a8, 0x26860da500a08787
+, 0x6462a948f4367852, 0x2ad762ebb60b4dec, 0x95d88977cf9f5545, 0x7927fb22828593d8, 0xd13b480a325a6061, 0x7f05b689bad83f64, 0xa71fcfacfee8d664, 0x7ca2ba3e75e25c78, 0xc6a5d0228b6de588, 0x01b781668315265a, 0x5520b6005fa1206f, 0x455a385f301cd5f1
+, 0xfc9f398269f2677c, 0x350000661a6a6f43, 0x7b12a433f0410711, 0x72f7d008dbcb557f, 0x71b3bbdcb02f183b, 0x3d030cf582db5457, 0xc443cee72be1cf69, 0x1b4d00368692a34d, 0x0e27a72fe7b67c66, 0x7fca35133788ed5a, 0x7836c9ba157b3842, 0x4b7d3a719eb5dcad
+, 0xdad4315721ef9d7d, 0x079db42222ff9401, 0x4828690225c147d5, 0x6f4bdd575f1f6010, 0x52ddc365d4ed9ffe, 0x5c4cb3a1310da36b, 0xc8a50c13988bd994, 0x263f085702f701a5, 0x60ffb04ae185c98b, 0x15d23163bde49d50, 0xfcbb7daece61441e, 0x700aaa76174cf10a
+, 0xa0974ebba5c532c3, 0x2b2d78e0a2a94844, 0x7b3cffafe3a3d4b5, 0x581eb518f0548d3b, 0xd6b0dbb25855e359, 0x2b6330338eb6ef8e, 0x39f41d537409a3fb, 0x7f5388aa196244c4, 0x817acc813715b2d8, 0x6f2176ea78879b91, 0x78ffcc9d764c1cc0, 0x66146787ffe9c78d
+, 0x640d947b58de2e1a, 0x26cc0bf483656043, 0x7d80680e714a4158, 0x43248930ccba6858, 0x0af599461ac0d864, 0x522fed0581558361, 0xe3ce1add657fff1a, 0x3e20b00c7420f02d, 0x53be2e18351391e2, 0x3b2926fd27c917e4, 0x9db166d5a16b2feb, 0x1c84e95940e1c9dc
+, 0x896577691742b156, 0x7fc889386efdeebb, 0xf96583c78cd4463f, 0x5fe7b058fe246210, 0x756590b9b0e4663b, 0x194b35e5569c86af, 0x00dd996e6712a5c7, 0x5087954b47b32745, 0xa112171e9b2aa910, 0x5b915d2dd2496ae4, 0x49faa800248541d0, 0x0194293d897d6a21
+, 0x18852429113c4795, 0x22ccce2eb4beead3, 0x69a980fe3e82d7ff, 0x658f4e284eaa8c21, 0x94bfa850d6e400be, 0x347247332c1d72af, 0x658df533fd047025, 0x18f728337ad978db, 0x35871eb0802e0978, 0x4b5a22cab756ad63, 0x712a794f1883c0df, 0x7f54788fc9bd854e
+, 0x939af7a16e6b4a95, 0x64c0dfa93f9a1969, 0x502170d51fab21ce, 0x7bfb46a6e38c1be9, 0x668144c8e047f646, 0x70eb4024f9af9605, 0xe8f85e2acf50cce4, 0x631c8db431cb9347, 0xd08ba72b9180514e, 0x7d3646e695db333d, 0x4fa9f0fb1f667912, 0x4170f23d3204c211
+, 0xb110fd10b82ea2cb, 0x1fcdbab9acc00cec, 0x638cebfd695e4c4e, 0x2680918531bbae33, 0x7f2ea2097101f813, 0x61637809481e919c, 0x66cf7f1f3d1797fd, 0x54ece071885f409d, 0x6a4fdbe3555e6966, 0x4ce3770a55641029, 0x9f9a58883812997b, 0x5c7945089a3f2529
+, 0xed398b144e96d9ca, 0x24f39679b8c8235b, 0xd7d2fed6350b3491, 0x7745383ad7351b55, 0x6e0d55a38cdd226f, 0x0efff2378a4f6f0a, 0x47d21063eb6a46b2, 0x59579fef5af3336c, 0xdf34c17312e9c1ba, 0x58a5eb0cf67683ad, 0x3ab2d44602e42205, 0x46479723fa7044a9
+, 0xf18d3e1da513ade6, 0x2733b5fbc33cec0c, 0x9977aad90fca9bf5, 0x560600a55c24b9f8, 0x0aa90e64cb69e874, 0x164833be18336f71, 0xf5aecc96ce075c0c, 0x0351154674ad6238, 0x753291dac51b9a1e, 0x48fedf82fc0991db, 0xf8e2a81a275b8ce3, 0x5740b4530f44ac66
+, 0x2cbbcda3292d3103, 0x1b9a5dcf28e5d667, 0xa101b46665b93b20, 0x6e9c7500171ca339, 0xb2819fd13eeb3aed, 0x3ab18277cc499df7, 0xf5f79fac4699c086, 0x7fc5259e44597000, 0xbef661277e33bfc5, 0x2ba2ddeeeeee7fff, 0x03162059addc712d, 0x0e4ef11d2ebb1865
+, 0xfc70a415ebf6eacd, 0x339e3cca338ffb23, 0x5a20cc9cd53783c6, 0x4089a5f0c73bce1c, 0x95e9e03b43df4b23, 0x1315035c55f417ab, 0x4e8c694537404cd1, 0x3b00c09d8844f2d0, 0x045476c6b73f3f30, 0x690bf08f50d730d4, 0x8deec2016d42e542, 0x42d01ada79eb65e6
+, 0xf87b0610aae71cc5, 0x427c00b69d6d1afc, 0x95984a4f061e6e1c, 0x1fe7480a317dee35, 0x97f226baa2bca9a4, 0x1221a00c03bd38a7, 0x1bc3dbfab23a6f55, 0x060d2c1febd791fb, 0xbfa5798389f6cfab, 0x1ac8929acc9f38eb, 0x161d46c8f4fd160a, 0x1e850b8fbe0855e7
+, 0x2937edd021b65677, 0x15db8d4ce3f2477b, 0x49a6a0f2e59b001e, 0x6970d8659285ab6a, 0xdcd378c53d2311d6, 0x75a0784e00ccddcd, 0x6b01cfd0d6e3a499, 0x0bdb2d16e1109475, 0x2dfb8d50bcc7e920, 0x181ed3d8cbc24997, 0x32f31d39bec93b9e, 0x00481a64c9fe503a
+, 0xd864f68b26f9d15c, 0x4a5022bb556d5904, 0x174954d56a0ff41f, 0x381672f4eaf8e38b, 0xa0a35aeafbba4ef6, 0x052271ff33b659be, 0x326ff226f8682b52, 0x002a40fae39e04b7, 0xc51e4e260d647459, 0x4905e6a66a3e299f, 0x045dc831bf70b399, 0x02b7123ce92701b0
+, 0xa03dcbae2e02043a, 0x528b9e8e799408a9, 0xbbe6fae4d442864d, 0x22ccc76bf8577a50, 0xa4da0b980c309cbf, 0x603213a1d0cf34aa, 0x42e36d4a9ebd1c8f, 0x504bd0564e45918b, 0x2ae9479fe94f3b75, 0x7d8d09ea25fb486f, 0x79e852da635d1835, 0x452c78a9a97f091b
+, 0xeed71cd216b8df85, 0x4417b94d3ba0452b, 0x307d515e59ac424c, 0x6d506e47ea8aea7e, 0x801f983fd7413a53, 0x24feec3ac086a607, 0xec8506d96e2b85ac, 0x5003c0389ca98ea1, 0xfd7384adddaf5be4, 0x551b1e2f6afa9c2d, 0xbd4d4b080cb6527b, 0x001a38c3d3f810ec
+, 0x64f7830889b41f45, 0x394c4a3b1050670d, 0xf54eb346467f20f5, 0x695df6f23a906ad1, 0x23ffe20fb8dca72c, 0x0973c6808fceb5c5, 0xdf09fe8825e6afd3, 0x46cb827ae6847b5a, 0x98b7ad4ba26b0d08, 0x0bf4d8047c148b6e, 0xa5d52a742b6b8a01, 0x607b9455280375f8
+, 0x3bd7b363f9ef98a6, 0x2400e6eeb84d2ed0, 0xfd0a2706049d9319, 0x6cd3b32bbca11d44, 0xfec0c39820e3e4d0, 0x6508cc00311a6d1b, 0x4205d8686b0622d5, 0x1286bff4fb446ad8, 0xaef9f7899cfcb9e3, 0x56e56094be5a7965, 0x21fe79623997b0ea, 0x1aaddd143dec2290
+, 0xbe025b9683c66a25, 0x3c8868f777fd7434, 0x2e93cf7c944eecba, 0x3522bc2afb422ffa, 0x90cf169171869439, 0x0e90f30a5e2707d1, 0xd4c3eb8034edd09d, 0x64ad3fc46336343f, 0x27275a18fd1714c2, 0x7fa25273ca906867, 0xbb91cdc2e51f280f, 0x14f32cac12124fb6
+, 0x9183eee595b599fd, 0x294dfa41b88996ac, 0xea35a9e39d25f41f, 0x21f302358db6aaa4, 0xda57dce02333f87b, 0x377b79a8ff20068e, 0x3c7e412241bfcb47, 0x2b3333f9ab4d6a9e, 0xe9b8f8f18152603c, 0x3a8d9ab4a6ca8e9b, 0xc7263af76b23553a, 0x7e981b09f1367183
+, 0x5ea669090446d925, 0x318f921f64c7ae2c, 0x35f278459276e3ac, 0x03f99fb7c774cd64, 0x6fef5b2022bbc1fc, 0x148fdd72e7cf0aca, 0x9052c9d97a31b7c5, 0x2bce854128c4fdb8, 0xb9105e7c87354939, 0x5dc93aa245ee253e, 0xd45ea9536b77df08, 0x53465aa51bccb203
+, 0x255f2806db8d20ef, 0x74bfeb8b5b60a17c, 0x7b66c25c79b0da8a, 0x22c83121c496dad2, 0x31298ba08916fe49, 0x60ee71715d431b29, 0xf1cedddfa9277f1a, 0x7ed7ac31e47400b9, 0xb243ba00277c4837, 0x6c3d62d18a4e88b6, 0xa7f589068a8d7d5f, 0x401c01daa9e16900
+, 0x22f94519393baaf2, 0x5462c7a3e9c3dad4, 0x6a5f6117a98fdf1f, 0x445e554bb9d83bd0, 0x2554bc5d3a0ce398, 0x1354e5c652bbbd6b, 0x1c30cc11b0898454, 0x51bd0897f180941a, 0x3d19a2ee610e40fe, 0x22be507a0b66aac5, 0xda98a70add3b0203, 0x13de1ac5289737a2
+, 0x5c9642fcce0c8cac, 0x304a9ca9db58bb09, 0xdadf2cf81e054983, 0x46856b2c51466031, 0xc329714336f05f67, 0x15357d6eb08dddf3, 0xd6dd5f488b91937c, 0x160098dd8e4db9c5, 0x72be9852fbd27331, 0x256dfe6b1d85a415, 0x187f573586079ba2, 0x499b4abe5785925b
+, 0x1a3a18f81931367f, 0x78f1bfc04c6082a4, 0xbe7990e86a7a9384, 0x6f78868e6c215f70, 0x2bce11766a26ac92, 0x412915d262b13878, 0xe49666f453530f67, 0x0c20b77397654613, 0xe3b5ee5e61aeb260, 0x42f97fa87480a973, 0x0b7c775449750108, 0x4b66134524bdfe77
+, 0xf8e379e2997eaf9a, 0x0057c223bc0b084b, 0x3ce75cf033e20aed, 0x0538b62287ca9490, 0x8acf98e3df58ae33, 0x2c60285157fa1159, 0x72f796646c7286bb, 0x2708d38682bf2f1d, 0x05ee89cc279adfc8, 0x522a9f828bd9cc92, 0x6fb3e7c90aafba88, 0x5a9a83efc2658834
+, 0x0ec3eac67f6637d6, 0x332868c1702ff418, 0x7aaf5e5ce28bb8cb, 0x0805793409bf20a2, 0x4410f1ed1909461f, 0x0e2d4266e2f54c53, 0x1f3b1fc944845ff6, 0x08f870b473e23745, 0x51d789b36088f437, 0x689a50ffc9fda20a, 0x6457b49e9c5e6d03, 0x675da23ac529883a
+, 0x80ea04d2480b5c90, 0x647753e9128c6352, 0x73efe917abe04c49, 0x42c74015b58aa638, 0x8720b0a543141d72, 0x3773910384875818, 0xc94135e1f5c8df4b, 0x67c97733e9e67098, 0x5ae4f97a4009d392, 0x31fed41d198e85b1, 0x0f8a73deb320b832, 0x54008cc619ece9f1
+, 0x9ba6ee13d36f32e2, 0x41dcd793a64dda15, 0x1c50a99f2d97122b, 0x7e48c550a4c79918, 0xe492d6564c12a285, 0x3c4f3ca0d7f2260b, 0x43613eb62517a407, 0x75fcd132825cfb3d, 0xdb071148272fd59a, 0x28215c81c44e8095, 0xd5ddda85909a7912, 0x5d609fa5fe829846
+, 0xc373160e9b54eb13, 0x1a2660b91b9ae050, 0xc0da2b42837f3d72, 0x38a4f9b46cbe6d61, 0xa99d1305254396ed, 0x2955401c90674588, 0x16b2cb42d2fa6e60, 0x55d34cf71dfaa9ce, 0x95d16069e5dc419b, 0x31b649eda7386923, 0xd3af92bf94573e6c, 0x11d2c1ae64541636
+, 0x175012ee96a7738a, 0x4a1475777c0e32fa, 0xc09b64584d085420, 0x0a6a6f80b8587bda, 0xee3dd23a47ce2ea0, 0x2d20d216583afdcb, 0x15d1a8aa851bc1f6, 0x7ef8ac5dd831762b, 0x16fd31a098e04034, 0x3883bd929de60154, 0x8aaaef15a4051a29, 0x346f70a95334ae56
+, 0xc7687bf40a790378, 0x7c929f29718ac20c, 0xfc62bb1ebddeee2c, 0x539414bc38589cf5, 0x8f1f7a2a9593cd90, 0x57a536feecc7d59a, 0x7fe9d54b4b1ea359, 0x2018391503f7e637, 0x847f4664bb0f7919, 0x5c9edd2a7d9228a2, 0x4faad518fb8601bf, 0x497abea68bf84378
+, 0x30161857ad7199b6, 0x357a0e945cb123b7, 0xeba53993cf95415d, 0x2e8411152065ecc2, 0xb5f133df1e85021f, 0x14c7cbd2fbcbf2a4, 0xac5bf233f169d374, 0x5e8552101cd81985, 0x2b972b2d91a9440e, 0x75dc5fd52888ab00, 0x83218f0ba0f3981e, 0x551e27074f3e9895
+, 0x5008ecfe5ced4d68, 0x1d56f072864721df, 0x78b654fcf8511e17, 0x72bc6da022ef9080, 0x7a8985b0511b0dd9, 0x1fe463363fbc5df8, 0xfc676b0972a397a0, 0x09b6334e4934bdf4, 0x5f79215af96a406b, 0x35de66c1df33073f, 0x665e552db9e98390, 0x6fb087e1208fbe02
+, 0x0bc89f8815079a79, 0x7d617a988f9bf5d8, 0x55b5c0fcb551ced7, 0x49459a6a0e4df1b2, 0x3e13ff9fdeb4376d, 0x06bdbda934511f12, 0x0aa5bb28889e305b, 0x561d5a75fbc95d86, 0x4ce53c933f78a4f0, 0x01b92ef9e0bacd86, 0x22c00faecba66cca, 0x16b8d98d5b2b6c54
+, 0x54f67e31cefd20b8, 0x7ce877b9980e6417, 0x57c7b7086d52da2f, 0x266c5e7895a98798, 0x5029eb50d09c8a0a, 0x33006dac868c2716, 0x6dfb586b918e2c63, 0x017e486b1ddeeb0a, 0xd031f8763539f444, 0x5f974beffbb44405, 0xd8e618d3af3563a1, 0x4fd8252e896da05c
+, 0x50fc19c2078ba533, 0x245c26eeff992b44, 0x88dfc647891eff7b, 0x59617a6bfb15863f, 0xd605f25c6a5387a1, 0x393401fc2a24a36a, 0x574e3cd31c2ed375, 0x2b486ec182551e9c, 0x28db490ac486b8ca, 0x59e77c155d7f4656, 0x59c6836db71e55d7, 0x6c92eb4f497f7453
+, 0xf97ec51a758a7438, 0x4fa939b1d95f5523, 0x8585ecfa9a696f37, 0x28966e4ba55d1dba, 0x27617f2bf04faa4f, 0x37d34869c2f8dad6, 0xa8eaf38db2a1a7d4, 0x2bc86889b36048aa, 0xd7e738aa1a42f321, 0x402e162bcd486959, 0xd72a3b4c30a67454, 0x1d2d7285f8d5c497
+, 0xfacc18028b21a07e, 0x3b620c68a8842cdd, 0x6b4368ee22ceefa2, 0x73cf75d484704c40, 0x587817021c7807b5, 0x634582340bd071ed, 0xac6003e111c3ad0d, 0x35a1ed1eaee12a57, 0x3229f9828a916934, 0x0c0979b654a22eb4, 0x4eb3956f94955502, 0x3332118aa9df46b7
+, 0x126c7b8ee5006cef, 0x320843f49b7a544f, 0x272a8de043d6eb58, 0x24fd26d14d92e6a6, 0xebcc72eead98dde7, 0x65ecca04f9b758ed, 0x914b3ada7d6fd166, 0x548c3b942f25a522, 0x6b378d5c157e2e92, 0x46104bf269c98678, 0x6b3e97757ea131c5, 0x5bba96c55ce6b2e8
+, 0xbfc6a8c30248921f, 0x15bc7f9684cb6d04, 0x9048387851425cef, 0x09d339287c7fc0c1, 0xa4a2b0b5632f8c48, 0x3f6eadd52c3f8e4b, 0x14a5061bc2a7cca1, 0x2a22eac37537f88c, 0xff79eb27f4831ffa, 0x3603aeeaefbbe831, 0x933a63a0c8a9fbf7, 0x77ef8881154ecccf
+, 0x4fa2def7bda02096, 0x1df644e8b004711f, 0x10d0169a90a0724c, 0x32a2c8ffd14c7204, 0xeda7911421241859, 0x7b6c9c066207be01, 0xefeef3f42ae8b117, 0x35a73a4a93c9cbe0, 0x7697b790d784e775, 0x60b0253d5a078adb, 0x9ca512fec457ac48, 0x71096c778031d930
+, 0x35e87b23eddb5704, 0x2df6630406a00d34, 0x6ea9fb14c1a7dfe9, 0x7d6b5ee3eac000ea, 0x10a591f91ac1afea, 0x744f736436b471bf, 0xe8cdabed5a4deb09, 0x26db2f5bfcca570c, 0x19d941b8200c1d01, 0x3ae205e3d3da172f, 0x9d26d6e375cb43a9, 0x19ccffa99c45e85b
+, 0xc9cb8b3487d5d30c, 0x74c20a6800f75f6f, 0x354a6dbadd9a1213, 0x6028041383fb53ff, 0xcbd6fcf0daa11888, 0x2c4107d57c28c24f, 0xc60a119d083a2144, 0x5cd465249504388c, 0x38964be7db88cdd3, 0x72d4556e79d8c18f, 0x524018d85904c1ce, 0x53ce1b9d21a8fafa
+, 0xe6c590a8c1b03a4a, 0x10960ad922004ea8, 0x5d4f485bc3be231d, 0x51491b1a485a0bc1, 0x6f2286d6196f2cec, 0x58818a84063953f1, 0x351ed7c4e5cbbb09, 0x6fa661bd7856b460, 0x15a950e71300118b, 0x4b476fbe88153400, 0xac484cdc4bedc5d4, 0x3920938ff0518c8f
+, 0xe1abd24eeb0c9297, 0x583d1c0f8d8b2259, 0x0b30ac0a118816ad, 0x6ad81b09fa3d066f, 0x693c29b6c2aa89a6, 0x28964e051f419508, 0x021b1a535435f094, 0x38d23ab919aa7699, 0x70881ea254047dd4, 0x2b0710c70ecd02d2, 0x09a9b7eec201717d, 0x6b42d3792e5d5d79
+, 0x1a89dd305bdf85a2, 0x471e5966c6b2eeed, 0x198929aad90c7861, 0x1c11203ad2f442c3, 0x431bdd08b7826640, 0x0196cc0d53a5c7b2, 0x95661ed5c41ff1fa, 0x374fd2da3f091317, 0x608170156fc188c1, 0x528be18eb9ffa153, 0x9950009f99889681, 0x2cad580847972dac
+, 0xf0e38c1aa9a6ba33, 0x6d03fa4771b1111a, 0xc4ddba1f41101936, 0x6ed3d4bcce81576e, 0xf555246304b2dc1a, 0x53c0bb26ab81a305, 0x111f75d9d91efecd, 0x1dbecfb94be60b8a, 0x96cb02dfc2d7a779, 0x44a2b2a5f94b7e1c, 0x20852d87c5fded45, 0x2ffb4a578f722b9a
+, 0x6d0596744f994d40, 0x6d0296fed3839036, 0xa45fb214f07e409e, 0x4ee983d7a17268bd, 0x9e43822f921fbb1f, 0x25b052e53b6bfb23, 0xec8007f47a87e02a, 0x63d756390cca3ad6, 0xb6e779294f5f91f4, 0x0e0459f075bee40d, 0xaafce841edc92508, 0x1338ada805b7b035
+, 0x7ed0fee6d6976659, 0x7df0194b189a438a, 0x015760374dbe99b0, 0x6b1a9f7584a5f85f, 0x49fb0339e4cbfede, 0x592b80d54c185734, 0x62077dd742285faf, 0x50c05e47eb39e339, 0xda4faddc2b184a3c, 0x03c97a8444bc3b66, 0x1d8e4691f99ee8ce, 0x352ee31d85c14faa
+, 0xd1cd40b7ec234551, 0x65e018c7837fb0e1, 0xda3464b313120eea, 0x15e61288c37a852c, 0x3559ab9fcfed3ca5, 0x41e137631b0f0069, 0x4be7fc3b9c9cd8ca, 0x12e6a4e83bedbb1c, 0x64257b6030ec8e66, 0x42961c1985468b1e, 0x22c48005aa03cac5, 0x2ff5e4344d486d6e
+, 0x58bd1082679a57f0, 0x4826a7b8451e04ae, 0x4220dec35bf511b8, 0x365520e200d3cd63, 0x0229d8728801e244, 0x133c130523fe1f3f, 0xc46990315dd94113, 0x55435042bf870619, 0x9c0ccf81bea8ccfd, 0x17332458441af352, 0xe8dcc43950141381, 0x500faad87bee0b53
+, 0x5a83b362504cb519, 0x14420ef05733b01b, 0x1a66b26719fb20ea, 0x6215e59c3d3eddeb, 0xf583bd6a2aaeca81, 0x7baf438f36386a3d, 0x44981a6666576e98, 0x713fdbbf26206ae3, 0x922b06f67c410420, 0x10e0df7beddad2a6, 0xd53503cc6e6cfcb2, 0x4543860007d87463
+, 0xdaffd2b1af6c2bee, 0x6ec5d689751ad2a5, 0x434c8daff38223c2, 0x602228364b5e90d8, 0x99c854278805f776, 0x5d1f3140c886662d, 0x04115d1261aa4eb4, 0x7f61f5766715a2f5, 0xc2a7dfc0e6ebcb2d, 0x1f2ab219146d5484, 0x9fb1725070b2a241, 0x266d360ceb4bac05
+, 0xb1d104ece5e2da88, 0x7d18f59a1db28c9e, 0xd09b4ffafce912a7, 0x20ffb52d49d8df20, 0x113a360ac78cd5c3, 0x42bf06900fca147e, 0xc8af0f062fb9a98c, 0x247a14c7d73daaac, 0xe6546e52a9a14c4e, 0x253018a9f9a78443, 0x9cce41f54d5e1a77, 0x726775589987f365
+, 0x6a4dc1552caba083, 0x51c592e796700461, 0xfe653e868f9f193e, 0x14a450f39eb1b0d1, 0xae8d3480811efe7c, 0x3d672388b75e31b4, 0x5cff162d40a92ec9, 0x5ab06a22927eb33c, 0x6f754a2f624bfede, 0x12cd02f473be713f, 0x505d9dbc733fe7c7, 0x2dfc4db9c3772ee9
+, 0x63abf038c5eeca9a, 0x10b489804e844a29, 0x8722aea815e71c54, 0x416ce845a1e1554d, 0x843fe2c33dcbb5f7, 0x7692d685b7f9f262, 0xdcaf12662a7e2e11, 0x4d16d5c290cf948a, 0xdc15e4336c37b0dd, 0x00e13dbd9ac020d8, 0x06962bbac66f4426, 0x1a44e4d20e8e208d
+, 0xfe5c608098a83258, 0x133150ed97b9166f, 0x83cabae5d5ba5eee, 0x659ecb464bc6fcd2, 0x41a9a70c24ca2cdb, 0x51eb6a439cee7417, 0x932e8a0982d22e3b, 0x1192dbef4826b29a, 0x79bc4d4a7cb46dde, 0x05c53dfdea4ecea6, 0x45b5a1117c3c5445, 0x1ab997a6c6159ab1
+, 0xad8e57d3dcdbc2b0, 0x659c54e06a956315, 0x023e6786be35a14c, 0x51333cd054c9e465, 0xf7092b2b07cd71f6, 0x1a1b78e73d996459, 0x4404b36d5613108a, 0x003f86a07bc076fe, 0x0bccb24de14ae5d8, 0x36c62a1f589c4a2c, 0xa162d4bb5cd9ead0, 0x2259cecda54cac58
+, 0xb0d35ecc9baf4e9f, 0x254ddaae6443721e, 0x29224d4968ab1167, 0x0e86e2bbc852d9b4, 0x19cfe4097c71fe34, 0x7421e1e2cf0952d5, 0x626fe9fb7fb5b112, 0x545f18fae1000077, 0xc80bdf59aaa01422, 0x30934da9dd60e8b8, 0x34b52508e29f84d1, 0x024567df6c125ed2
+, 0x0ff5fabead1c8334, 0x34dba7ce9a90fa1b, 0x536b4f1b7bb347a9, 0x1835b550f827f5b9, 0xb20344ee8b11cbb4, 0x5205f1cd543cc145, 0xc335696f25bde15b, 0x43907671ecaf3acf, 0xb4a81e1c9f116933, 0x48f19632e90f8b27, 0x100d29a72b1038d2, 0x68443c11c57e4655
+, 0x6adf73b91c9bbb43, 0x095406c2095e839e, 0xff8ff468ffb6700d, 0x626f164ad4bed828, 0x26e8afdafd1f6d7d, 0x7753e739591bda05, 0xf0080984c798dc67, 0x3443eb78c6648a38, 0x545e0136b5a32ddf, 0x32452dbb4079e71d, 0x42d98c64ee493c8f, 0x76a438867aa7824a
+, 0x9f8c3a91f4e7b793, 0x0cb3666c3145b404, 0x0ac07b739c75168f, 0x04a5271439d12eb5, 0xf9abfb99542ef864, 0x3223990b5599351f, 0xbc963f396dd35dad, 0x27810e1e823a8cbd, 0xff9730deef3c9c23, 0x6e8b8054210d1dac, 0xde3edc983f1e3fe1, 0x1e2e6e471838958c
+, 0xa7e6c63ec14596b7, 0x1cd579f1ba3df0db, 0x131900d5fd56d883, 0x35e0a8b4e27af27b, 0x410b33e2f222ec43, 0x5928d3dd16837149, 0xa7a55a311914fa84, 0x0a730c5d3245317d, 0xe4daa4a03dbdfc1a, 0x7b5c3fa3a87243e0, 0x052c1dbacd474e64, 0x4de4b53854bd91be
+, 0x19df6ac1f5d58d49, 0x7701efe5e3ebed58, 0x0145aae3b0aede85, 0x6f543eb73a13582f, 0xcc08754045d2e5b2, 0x753adc8c8775ada8, 0xab026b4c0c46db52, 0x75075406f14f5cf1, 0xe06d0b3eb04f70b3, 0x4074cd707e0ac93b, 0xa33c51296bba4fbe, 0x34697070cc24a211
+, 0x5995108848dcce4c, 0x1e98a3253f085204, 0xe0aa9648426e4a27, 0x7b855147bb9c2265, 0xb5dcb3a77d3cb1dd, 0x3ddffd8e738cfe54, 0xa49ca522ca2a4236, 0x6c58470d2bbaa013, 0x99e9754fb32337a7, 0x72637ccbe6da46d9, 0xda9dbea1a92fd3b1, 0x416bebfe1b7a6d92
+, 0x7f3e7f57927e17ad, 0x621dae96c326480f, 0x16d5ede5aced9600, 0x318accfce3c8a103, 0x7a4069f0b230b4d5, 0x61d49f57662499ac, 0x6fb23328c363843d, 0x324c449435f3980c, 0x0876ec8d99422ca0, 0x119512d8d5ac7410, 0x0cc1f12166638482, 0x60b5582b5b59dea4
+, 0x598d33a83af2c921, 0x42b776fbf6787ff3, 0x899bc1740ad46db9, 0x060e6ab257ff17f5, 0x2fbe7266f6a18359, 0x3db8334a5d3f9b7f, 0x833cc5c435c7bcbf, 0x2576969d2ea7f298, 0x9650e77c0e40b294, 0x2582c0e219474105, 0x45721fa2d0de30ac, 0x3e3e54a81dc070ed
+, 0x8c9fa70e19820686, 0x77f41883e550f1ca, 0x620cecc432720630, 0x30fb8f64040087c9, 0x49add94e6c6a1509, 0x2788e07bb4a46f06, 0x92f50d3526162026, 0x19257c092a2b682d, 0x4d859069e8892c58, 0x4986722f2a135b6a, 0xbf2d2a7bf6b92802, 0x4918b9840bcd31bf
+, 0x05514263a0fd8051, 0x298a55680426d215, 0xf447e3d2c0d826e5, 0x654964c376c46f76, 0xb748d6cabebb7085, 0x292d92bb5224127c, 0x4b564711e6f30720, 0x3680603d4b687938, 0x1d3652e4bc7e6388, 0x229a3ecba12970c7, 0x0a264fc5cfb98ea2, 0x72513effc8cabe50
+, 0xdf4117326f3ce394, 0x07e310a23c63667a, 0x62af8780b6b2d91a, 0x7ad41d4514cd1339, 0xbe7ecc3af9c5b82c, 0x5dd08c7761e6862c, 0x54b67c407da2b918, 0x11085f9742e2ead7, 0xf84e54fea95cdd7b, 0x278e4b4344b91e0a, 0x307f661f2a933ac7, 0x6b7d0cfe9549cfaf
+, 0xcaba05cb45c737b3, 0x1eedd5ae15305ba6, 0xa0ea856db9b55150, 0x53c5e8bd0480ea7e, 0x98f0a208979cdb26, 0x1697fbed126a5a47, 0x6bda4cbff4270af6, 0x3845c1ce08e4396b, 0x5c72eb4c7410c7fe, 0x6f74fb2418599977, 0x4dd2b8ed72bc4c75, 0x6fd05e5fb2931e4b
+, 0x356a65dcd05277aa, 0x348185a9fa8fb932, 0x7222a7cca09f5acc, 0x7e8b9ec8f977e0dd, 0xa26c58c2e5d0acdc, 0x5ab5ae5db7350acb, 0x9a91c15eba7097b1, 0x70f96462e32685ef, 0x8d51b36504055d26, 0x7da072d04df864f4, 0x6e10c593dd19985c, 0x4fca79468a2a2eda
+, 0xf536a6a47c88ec58, 0x2669bab2e3ae96d1, 0x31123035f716f529, 0x0fda973f8c070c10, 0xd2b58ebe5a334841, 0x66643cf42590a343, 0xa1b92d53e79ca3a8, 0x087670f12d162e65, 0xf87d0b3c8a7e4f8f, 0x73f72c025c573c43, 0x24640b13adf22a60, 0x69cae39b88b16d70
+, 0x67657c58bd2626a5, 0x19266a8789897b31, 0x7e26a17e66cc76e9, 0x5c20df577d716b83, 0x90cac819159218e4, 0x2dfdd27325818b7e, 0x5495b3a426fe3eb0, 0x3d6ed79a301f355d, 0x379d74ce19572f33, 0x36d2208ce4048bce, 0x48c65afc71cc6e6c, 0x788e1ad62df7c817
+, 0x1a0020e8cd1c14a4, 0x2285c253eb63ba61, 0x002dd36baa19276d, 0x7905009ce31792db, 0x1c8eae302322f578, 0x02895d77d4743569, 0x86d7b3f9c130981e, 0x673505d5fe17de4f, 0xd9860bfa518d9662, 0x02c33712971f55e9, 0xa56f8fa28973971c, 0x03e405c3abf7605c
+, 0xe03052236bcf9edf, 0x790cd821dc88d2d3, 0x37778f2f8729cd93, 0x2286f92cc0edd37d, 0x8e93cea7469f589c, 0x6ef3a8971112e936, 0xbfea81fa81eb75ec, 0x32c12a91dce3ab7e, 0xd03f6755ae6ac204, 0x0c003d30caa72771, 0xf9b44ac363dcca15, 0x14da0305211fefc9
+, 0x8459273d3c410c74, 0x737fbb8a392b00a4, 0xa1e3f11fa3e6961a, 0x5715403f7eae29a2, 0xd456ee4132e5bea5, 0x6e39ad057bd70e42, 0x9defbfdbb547c766, 0x3db9b451cf926276, 0xcc90066f500cc6b5, 0x474f9be77ba8f4cf, 0x154c26c2f8c5bc27, 0x2ad37c396177f337
+, 0x3b4082a5367896ac, 0x36b0944bf951dd53, 0x5dfb655200eeed8f, 0x4ba146beed84edf9, 0xef48ba17df4054a6, 0x17a8ff91efb4b66e, 0x3ec70449b64a3ff5, 0x7439fd375d915bf9, 0x91353bcd931b2d58, 0x50610c849396c3f5, 0x3671574b0264b89b, 0x4eae34a34cac194e
+, 0xda39b4975b68cecf, 0x7c59e7ad7a24d7f1, 0xf2e086c2f1623d49, 0x5877235f510f6abe, 0xbcfb52599d9fb2d3, 0x110634f2479eee39, 0x4eee7051692613af, 0x6eda4dc3c4e4f226, 0x41bf5508e1c81631, 0x269e7641d112e312, 0x3151182b9399a429, 0x0447d61684d4279c
+, 0x9d2c3815d5f2f7ab, 0x24659639a747efcf, 0x49185ccf180c0805, 0x7a01d56f23dbd625, 0xdbf7303a9bd3d4e4, 0x0e5b35b17304b061, 0xff7406d0c88a50c9, 0x5d5038f317b080fb, 0xe0b47d5a36fc4537, 0x286357a3fee674a2, 0x66f7548e8e2e7c5d, 0x4ccce6dd02d637dd
+, 0x82c0a9197b46b917, 0x3ecad81c6211a291, 0xd2ddbe4253bc21d9, 0x7d003c14f0791b9f, 0x18f96a6cc2efea75, 0x5da6caa58517eb01, 0xf86fbe4e6fa387d7, 0x2448152e344e4bf4, 0x45d7f728e8c05035, 0x0a8132e378b3cd7b, 0x613d8427af1ddf9c, 0x3be2b64e9d4b1dfb
+, 0x5fcb6d3461345827, 0x54be5ca918a1fc13, 0x76ab687565c6eb8a, 0x47faa20ff6f378d2, 0x6dd272774fa287e4, 0x1a50e8dc2413ec95, 0x7a65b533c229d7e7, 0x66141ae6d6de1103, 0xef15ba2f761d03b8, 0x3e1707ecb1d4bb80, 0x3e688c7d7c6395a1, 0x79efdc351380ecb5
+, 0xbf09ef42d6132815, 0x5fb60dbb79a338ac, 0x4824ef6dc74582a2, 0x1b45fabdf95f802d, 0xe44784980ca51c76, 0x088e574f5104a03f, 0xd3b762e0b9f6f4be, 0x7b1e6c6ed57beccf, 0x261ed9401973e23d, 0x2cd0aab8f888ce61, 0xcd4759614085376d, 0x344bb6afb80e4803
+, 0xcb01a6f00e534b95, 0x1b69492c6a4f0ebf, 0xade4b1da67fe0289, 0x35d031d90392017d, 0xbb7c3c7487b83ab9, 0x32c66cd9eccd7266, 0x6f017cdca3243117, 0x47668b5e95f1a531, 0x9569199ca1d245ab, 0x5fa3cae5f2806003, 0x621ad3280b75482d, 0x2a2cbbbc50dce32a
+, 0x7d983f8568dcd081, 0x28de4578abe6c430, 0x94089be1d02825dd, 0x018c8f86a8bfe5bc, 0xc508c4d2dca9490a, 0x4aa8c20928d019ab, 0x8e32e46fae547679, 0x312a02d04fc15128, 0x84a8d075f0dfa996, 0x22aacd3988712730, 0xc8b7632e4936d49b, 0x786982519e9f65c8
+, 0xb5df45efc0f1563e, 0x152d105deb3f8099, 0xef8ce208cef2c00f, 0x21b3fa4f1a3045e9, 0x29d3b6716d7d434b, 0x5c28d83ed8068c96, 0xf72e78306d2e8a4e, 0x6b018440751cb538, 0xd6085b558732b21b, 0x3b64174d5d76883e, 0x7b1c7bbc231e7791, 0x2ed912c5c494ebf8
+, 0x7db6a257de4ceafb, 0x2db11e914c2570bf, 0x0e11766679c611b3, 0x46ea9708f9e115b4, 0xba751f5ca3b7bd0a, 0x4fd00821069a5d80, 0x077d60d73a602f78, 0x7f02f347960e6359, 0xa49d814e13087d3e, 0x1427ca9e13aa2ba4, 0xa890cfb6e0199a1b, 0x0a1f2c8202650bd6
+, 0xc751362d10f847a9, 0x312765b04a7ff0f8, 0x88428cea9b0df617, 0x55a5e87a531acd63, 0xbd47c80a0c7e58ed, 0x11d9fd3730ba11e2, 0xe30a58309edc0118, 0x5ec8d9cd4abcde22, 0xb46c8b8476f88f65, 0x33b194942095ffec, 0xb7d64e66987245e6, 0x56235385b0c2b9f3
+, 0xf3a132eee27fde7a, 0x2bd9b0dce1333565, 0x7684ddee64fd6983, 0x320e10265a6102f3, 0xed5c6961923bfc60, 0x0b6df783b16b711b, 0x8b2d4d35e9b550b4, 0x40c170dc368abb90, 0x7acd5b7211ad15ec, 0x3a1f98076c9ebb4e, 0x945b4376e06e7474, 0x3d8f704d9b82cef2
+, 0x366603fa78f2f162, 0x72fac2352c9fb684, 0x9a819260c9b0c993, 0x4c327d032f33730c, 0x211e72c04f53fa05, 0x53c0ff4d2aaf1134, 0x6829714ccf5e6acf, 0x329477cd2a08339b, 0xeda4b1029967a98d, 0x67fc35118a36d314, 0xf6115604bc371086, 0x7ab03b8ba1eaf17b
+, 0x3ca4c036f286aac2, 0x3f7bf7040309b1fe, 0x447397c1ebba6cf1, 0x381a196a249f5453, 0xf96c290244f5c000, 0x0fd0723cc9d6a442, 0x287b22dc73c7bf1a, 0x589b3d965203e93f, 0x7ebd3d55bb90ef8d, 0x2cba2418ac4fec7f, 0x1346b3458dc3d73c, 0x7b4df4e877001819
+, 0xd7ab7d6fd8dc81aa, 0x15df57aa0cb8862f, 0x90bbd747890a0099, 0x6189693518fd8813, 0x82f87f7b7d1dd907, 0x401124379b54b5b6, 0x5bb8db6836ed6e04, 0x3e083d8d7f221da9, 0x8da94fb576fb5ab9, 0x3df95016ccee579d, 0xb0669caf01baaaf6, 0x0097a1a05ac4f3cd
+, 0x9a2fab32a64c4208, 0x6c916b99c3867364, 0xc76f370ade57da0a, 0x4cb01f291ce4ef4b, 0x0cba35d7be662034, 0x035e9a7d7bb9055b, 0xdb081b4068e8a5c9, 0x424be049f56ad4af, 0xed7c3dcd12baf9d3, 0x30903006f9175ce7, 0x5f02493c65db1d98, 0x41eb02eef344e474
+, 0xefd189ad0dd9f456, 0x71c9d86e2ab9c555, 0x77eb2070cc9b65f7, 0x0e7911b0ecd2f86d, 0x5455d5040f6e438f, 0x446a33d62b288170, 0xd0f959d4a3d3a1a5, 0x22728881d8e2f48a, 0xba2e6fa60bdb23c1, 0x61b7ef1661795803, 0xe15562048b49c2d0, 0x7c4b90c65f3b5d6c
+, 0x4b121eb43db99184, 0x39813ebcb06cc01f, 0x849a1169fe029528, 0x4f4ea4e4a7933823, 0xd35ad4797276b8fb, 0x3f8cfa9a9df67772, 0xa764bbae3b0b4bde, 0x4919936d2282d13a, 0x044a0ce3bc3b7206, 0x04da77d988092ea0, 0x6a1c6de0f752846f, 0x484a4b58b5a07ad2
+, 0xdccfc18133a70092, 0x7f7287d65cdfed8d, 0xf7c897cb825bd7ad, 0x37e0bd54139662e8, 0x76c8e9f609b9f0d7, 0x4f55cc6b13b0f554, 0x12430e5213c2b19e, 0x7336df4505b054cc, 0x5bb6cb4df9338bd3, 0x7ba68bb4193fc9a4, 0x745e29711889fbf3, 0x2be01ca5f02c3ec5
+, 0x97322eadfa2053ee, 0x09764c11d65afca3, 0x632f63da6e203883, 0x6e7668393479a539, 0x732fd82dea6e077f, 0x24d561ad0876f778, 0x0e43eaa0f28c7957, 0x6e69a14f8237bb52, 0x0bc9afc3c627ece6, 0x6a980c906e0af5f1, 0x6ca9cce8fe8cf3b9, 0x094de681e7e46326
+, 0x734bab547dee107e, 0x34dd0113d2016ec4, 0xad56997afecbf27e, 0x7e8ff659cce3a277, 0x29eb66194953be6f, 0x1db1509c76ad0f22, 0x88d9653ab0998ce6, 0x78ef668b9e305a35, 0x32ff76579a0b9325, 0x74b0dcb1ad7df919, 0xc1b26aa677e2e07b, 0x050052c266bc5379
+, 0x31dc56ef630c319b, 0x4bf6f70b8cf66f99, 0x6e08ebef4ede51f1, 0x4f2996d17a245417, 0xd9a5235f4e304668, 0x30b94da1287e37e7, 0x100a53b2f39a9360, 0x06f4c24f7aba48a5, 0x916f8ffd6bfa1f50, 0x4ec2e715a027b610, 0xd8ba2cb2046aff3c, 0x6ba01e82c3cfbcbc
+, 0xd87320edb56ab3d7, 0x24891a5e3be92322, 0x94062cc9f3de1aa1, 0x354a90ea097a0ce3, 0xb490fa127b44ce98, 0x0957182bf5b0697f, 0x0aabe93146832725, 0x1a441ca6c51e978f, 0xa8a0f3814417d408, 0x71b150af8fcbcdb8, 0x27ff061df1be8bb4, 0x15669069aa012fd1
+, 0x4c1de98f1f1f0dc0, 0x5013a6ee85b2eb69, 0x6c938225b3fca228, 0x21a0ad79a62e6390, 0x378ccdadba36652d, 0x17cbefcbcee37e8f, 0x5021799d3801eeea, 0x169a74ba433f6c15, 0x429fa06ad8224978, 0x13a852a1c0dbe227, 0xe1b6515c1cbeac47, 0x771e2f484264e6db
+, 0x3b8013789d287518, 0x79d0abc074b9a2c5, 0x7d6812c7eeeda52e, 0x2ddc074b5b666a33, 0x8e2b23ed5a2942ce, 0x4cae0646abd8c9d9, 0x99575326c5233a24, 0x35ea856c39f28948, 0x2ef20bfc869e1d2c, 0x73f77849cbb816af, 0x41d4d6a90e3fba7a, 0x6fc9f5cd253498e2
+, 0x9ac6975cd1514ecd, 0x6abdc779fc0bdf5a, 0xc1f5d882026d39fa, 0x1b9d51b1a10c8abb, 0x50185e9c6d2a94b7, 0x1c38bb8126b08bc8, 0x5d5ef6a5de1f6644, 0x25f6096def414463, 0xc21da960f3615f1c, 0x236e4f94ca55469b, 0x69ea2535d04b9024, 0x4f1b023f7b7e15e6
+, 0x38f99d079867137c, 0x6675a25d2c906a17, 0x1fbfe2e89920870e, 0x1643539a74c8d763, 0xe9c10f3c6529d8c8, 0x26f6455f897bb324, 0x9e8d333c66628b16, 0x5e2065473f8127e9, 0xa365dafa05806471, 0x25e84cba996eeb56, 0x481b4f70807a3083, 0x65541cf787d4331f
+, 0x8dabade809aba557, 0x73bf08726d434d39, 0x577934b259a54a2c, 0x34784c67812cea47, 0xf1cca0430ccf442a, 0x6fdf1a612e89248c, 0xfa178aca84ed5439, 0x4815659d9cc82b42, 0x622da10a0711e8b3, 0x0d066e533f8e2bd6, 0x0a6d1ba9939c37dd, 0x573b74788a3d7cc2
+, 0xa0da43c75f1d7a14, 0x27170400d846d2ec, 0x86acca6ea0fca499, 0x7044fdc598bd5992, 0xe4851709721405c4, 0x03e86ba50fd30119, 0xf1a843f79f6b4e6d, 0x0b928e8b65e6b23f, 0xea14cff736604b8b, 0x696015fa8f3f3636, 0x6645dba542e7ae24, 0x3927693f7efd56ef
+, 0xa3b8fd740339eef3, 0x56b544300a4ee0ea, 0x4a01a039d22802a0, 0x17a5122e0b0a68b6, 0x976b5895d3d702ac, 0x4d0754cbfc92011d, 0xfa222e1ea6ffc5a6, 0x17f2adfb6f702e2b, 0x2ac209b67dabce56, 0x3db233a9b8b6b807, 0x046c9b15a673c975, 0x797390ee7914517b
+, 0x72819deb0bcea731, 0x7bccfc95788b0cf8, 0xb2fe17a45bde858e, 0x144a5e30b7fa95a9, 0x535b461156e7fa69, 0x41c64746f67e9505, 0x31d8c21223b23fa7, 0x1c7d0f67956491dc, 0x9caf63c2b93d31ee, 0x01d8a604b2efd98c, 0xd1ddcfa1a6af812f, 0x3c13eb5e3d81b933
+, 0x61aae12a638db4fe, 0x76333cfb018caa9e, 0xf9239768f4bb0f2a, 0x588ad86b5ccb97c6, 0xa64153b23b4df27c, 0x22b707729c29b7e5, 0x2afa803bed4a8c16, 0x74f1cc446b1759d7, 0xbf4ce28f942604a9, 0x23b192ac6874d4eb, 0x5b216d46c83488f1, 0x0fa4dfba4277e8ad
+, 0x44955b062a6ecded, 0x7791feea9015f170, 0x736bf603d12fc35a, 0x2632adbca5388026, 0x956e4c48e1697c4f, 0x4ee9adfe8600e32d, 0xa584042a0da56406, 0x34a3d7f4bf457353, 0x8d4fd4fe00176fab, 0x15321ee855941f4e, 0x670701ef81f340a4, 0x0c7d7c618aed0ba8
+, 0x73283131d9bfd9d6, 0x34935a39e31bac65, 0x466cfbbcaae8b991, 0x250dd54e18478ac6, 0x659e46c51e40de4f, 0x618ea014fec50e04, 0xfe64d883080b877c, 0x572cabbb6688c4f7, 0xa2c817493a834146, 0x06cd734876378120, 0xe3de0b717336a849, 0x36942f5191db53c4
+, 0xa3f9adf66abf4d88, 0x2a9a144b8087fa96, 0xfe49fefcb78a5b4f, 0x1be40a8616928bab, 0x07a901975521f7aa, 0x1fc66ea683693510, 0x4dbf0084ba42380e, 0x1f374495b918c737, 0xb8346956a380a00a, 0x1346f4766fcdaa07, 0xb4db5689d46312c1, 0x775e7f3274dc1316
+, 0x07898828f32341c0, 0x144390a33b3e86df, 0x70bc604ce1e9c5e4, 0x127652de00220873, 0x2874bc669df50d45, 0x236f4585150161f4, 0x3bfa4ffd318214e2, 0x7cc92a6165059745, 0x2fae0e92090ef72a, 0x26676bd59c4fcc3b, 0x220c030974d1d447, 0x66455887e98686e7
+, 0x4164b8e4d8760ddc, 0x5517a86f840feb63, 0xd9b42c6c9371cade, 0x3a7f03ceecc160b9, 0xdd4086d64cae366c, 0x1b6290c327842533, 0x144efcd2a7a0e82b, 0x16621925ca10d31e, 0xa9dcd13118e208f1, 0x5a90f97edcb1c54e, 0x80c47331c8749d99, 0x6f061a3569a80b55
+, 0x0f6abf619e2a15c5, 0x29106c98122245f4, 0x5860b10985c9b47f, 0x4f379a379e15f410, 0x2dd6f45df68e1678, 0x2c475167ad9b283c, 0x23b7aa00952a6a3a, 0x5532bc26a40c5365, 0xa5c0a8be3596ce22, 0x4fa3127a9aefa56f, 0x944e843aa973e67f, 0x3c7727d45ae87854
+, 0x48fa2ce675117ea4, 0x7bca8e04ad3bbb9c, 0xd57439e4726f88e5, 0x3337d3a6a03b2286, 0xb0b6172902005953, 0x514bd76734e6c0a1, 0xf97f8934eed7c6b4, 0x0abe13cee7f1b75e, 0x6c88107a120e54a7, 0x634f966d7a6e11df, 0x5044c53109b94097, 0x68d49fc65522b73a
+, 0x69e295cd8c444666, 0x542c4c5fd999a224, 0x13ff89418b5da76f, 0x7133fa786a87ecb4, 0x2f180926456402b4, 0x52ddada7931c4dcc, 0x6eaf0d2130c71590, 0x014ec2a2ec231826, 0xac05b61443b34dd6, 0x157acbfab118b219, 0xe4e2f4b84ad01099, 0x0abf4a4da29a0eb8
+, 0x5f852b85b59eab1f, 0x1bd259c4726869ed, 0xce565d9287790a15, 0x17a48442bcf58a00, 0x01e519522381363b, 0x2336d07a710da07a, 0xcfebf2fbdc714cb2, 0x2f7a51474c23b8a9, 0x77db2a07d4e3716c, 0x40e8d8d2d0a09806, 0x644363ce6d401ae4, 0x53f9cae0470172fd
+, 0x58d96ecd8ddadc53, 0x15028204f3d6d696, 0x6f40a09214439ce2, 0x738c5371236c3e56, 0x64f87ee7a28bf9fc, 0x4f1899449a810fee, 0xd0aa95f4bf21e376, 0x6170cc24283856bc, 0x9dfc4927d764ff75, 0x227ea1563fa2e012, 0xaddd3665622ce087, 0x473d3bea07a5285e
+, 0xc0b986ee0d2b0eb2, 0x78e584c740dd18ed, 0xd5adbf30a04fd508, 0x1c6aed5ab59bedbb, 0x25d05fccbddb5ba1, 0x4a58fb6b3f896319, 0xdb2f6343fd8144fa, 0x46a445de6d5b07e5, 0xf67a06684fe9e1da, 0x57b2515923b15c9f, 0x50439940820a2a0c, 0x62f4b9b26f04dab5
+, 0xe79ea601d01b033d, 0x009bc6176f10fffb, 0x333bff2f907ed39a, 0x253d0a9e626dd400, 0x7a9bbedcfcbef06a, 0x2d1b6a7a5b39342d, 0xbadfb462a124cc9a, 0x2e8cde9d82c15cb0, 0x7c3f81bcd6f1b2a1, 0x04cb0b8fa4075294, 0xfa36d3db38cbd304, 0x59fef93442883553
+, 0x91982a741cb9342e, 0x7b9d63ac17b01982, 0x530b4ec25a293ece, 0x611069ad9fa0f0a4, 0x7a262a59b656a79d, 0x6fe6f8f4d6d015b0, 0x2c2fd7641a5d4e50, 0x24b0c507058c911c, 0x834882e492fe45ae, 0x68d0b01b13432761, 0x0eacaaaf94178b8c, 0x123e3a93006d7d01
+, 0xecf2fe69377ff33c, 0x4fc960ab4408584b, 0x2adc445b1ee45654, 0x4989681cd1d09a93, 0x79509599afe9e3b6, 0x7f6ffbbeee861c15, 0x2ed2859fd6391b25, 0x5e8bd52289b6ad27, 0xc949280adbce7c79, 0x510999e865f0cd54, 0x7f957314ce7d373b, 0x4b2c0ea4bab08ef2
+, 0x2d7cc08b5c05a8db, 0x4609a0ea23507697, 0xe204ba35182c55b8, 0x5e4d5903fdef61e6, 0xfe63842f2826598b, 0x782a3fd3ab62a179, 0xd2f01a1979e5a0f3, 0x0fb4c6bdd637fba2, 0xfbff4c192020c350, 0x14859008c3d223c0, 0x65ed7a889c1a2e55, 0x1d78daf483fa12cb
+, 0x5b54d11b01bc09ca, 0x54fde75737306515, 0x89725231105b63a7, 0x712d1f394adcda99, 0xb554006ee9abefab, 0x04dd8f7bbd4c5381, 0x98d22b3a31995549, 0x637a53de6b57122f, 0x8367d69b4c92da63, 0x236f2a9514250df6, 0xb265509af63d7b7c, 0x08522e36bc4b65f8
+, 0xabae725012ce8301, 0x493b257197a98ce9, 0x33185838570e5f0a, 0x65f5477ac414eb6c, 0xd002a36854699753, 0x2be693b4d96efdb3, 0x3b32484119bdc53d, 0x55691ac09a8fae1e, 0x0249e394514c047f, 0x765674c90b78171f, 0x1166f64638d6ab37, 0x746adba4cb52d18f
+, 0x93e293653dda6cda, 0x5d004ed52ebf0b68, 0x65c7c42d0ad96cc2, 0x3350dbe11cafca74, 0xc638cfa8942fef67, 0x0ff2dfffc5ac1164, 0x9e1b625e649aa471, 0x13a219d03d2eb86d, 0xdb92859ebaf9f7f9, 0x645c50918f7d5abc, 0x25c10cfe99f7e5c6, 0x13d858b53f90170d
+, 0xddb258b13ab1e7a6, 0x4849ff49f4e13fc4, 0x9ef87fa85511cda8, 0x48c50d4d3b4d2f7a, 0x6c98422c8007c9ac, 0x3fdd72e65a3d3491, 0x56b18cb165b4ec3b, 0x6e2c6df9e3fc3daa, 0xf6db5aa98ddc97a4, 0x423fd4082f3fb795, 0x42f8f5edf424d0a0, 0x1a091c2696139936
+, 0x3161c2bbb3b2d58a, 0x2e8d339eb0fb9099, 0x45ef7d11f6fab685, 0x7f222a068db3da4b, 0x9af96f9742549a7c, 0x55370df31dcec81c, 0xde98e81b131af02e, 0x58bd0622a474acee, 0x8ab40fa7ca882e0d, 0x5b4db195655f2410, 0x4754eb479ada77fd, 0x67a8a437d6fc8a7d
+, 0x9888254a4f0c9d58, 0x3232ba83bed0c618, 0x587b0de0207b57d9, 0x020df6becb096aa7, 0xef9e41052a29a8ab, 0x4ae671ee70a15a69, 0x167ce954923ee086, 0x6878c3996c1de887, 0xb29c711490ac097e, 0x1cf41a9c2577d144, 0x0590796ba46d8d29, 0x1c2e6dc8d4aebb65
+, 0xbfb904f8ac9b4cb9, 0x4ea1742c786469e7, 0x5a422f48401be57d, 0x0be0afdc77d6d32f, 0x5e8765cba2c738d3, 0x7dad0475059a089d, 0x9288ae0c40df7df6, 0x51c65f97715a16d5, 0xa9615d4c786ff9d4, 0x507ffe03ec0189ef, 0x1c1f46684604e41f, 0x282fe9d567db0efc
+, 0xebee7f8381fb8178, 0x5bd4b6045c208d57, 0xf35694743439ed71, 0x7cddd5a373ebc5ec, 0xa58df33cc68e3b5f, 0x40e6714f5c5c8df3, 0xea881d4bfd489131, 0x6b36400b491c28c1, 0xd4475cf594b6303b, 0x5b630cddc72e654a, 0xa0b587ad34394ce3, 0x3ea3ba6014f86275
+, 0xc3deac125d20eeee, 0x2ef3568410a2b3bb, 0xee6ba3fac5d7ec00, 0x5fabcb3337aaa23c, 0x6b1212e7b817889a, 0x0b37d285a9be51d1, 0x617ca543d762bf51, 0x0896b4ca694b01d0, 0xe3add9718277a1fb, 0x553dee7dd4784865, 0x904b8f7e936cf430, 0x5b6a78f20b244b90
+, 0xa2b876c2914b9bfa, 0x704de952e9d969f4, 0xb04ea1b54b7e7654, 0x5d307bb3949cf660, 0xcee4c23ebd049d17, 0x7a88293bb1031063, 0x00b8432b8286f656, 0x260a9c86a16216e5, 0xd140e6e6629d8686, 0x296011ff5601a000, 0x536f0f76cd9b2928, 0x267409c23a823dd4
+, 0x0f041043797f8423, 0x3da6102605962ca9, 0x2e69dfeea02098ea, 0x427e7eeeecd3a0c5, 0x75efa5e8a590793d, 0x1f5841df6dfdfc91, 0x1aa1e1b8b9f3c326, 0x07bd5b0983fcee91, 0xd169420be9c48939, 0x7940334f0bb9023d, 0x9bb330fff113764f, 0x674ff1b0cfe246c7
+, 0xe2083f8d7129cbab, 0x7e6223e3d9c04904, 0x9be411a7d5e883a3, 0x72642664e7c25590, 0xbb1f783b5c412322, 0x46716e8fd737280b, 0xfa363eeaeffde271, 0x6c256c131fc2c3b9, 0x13259abfcb2ce1d8, 0x53b96556e96aa708, 0xfaa7c8d25119da19, 0x05019f438e9f8995
+, 0x05e1d55a9424f1ee, 0x63e8e14e6c2f3f09, 0xe9d844e997a10158, 0x51904ed1e94a0ca5, 0xb09462d4df6bc6cc, 0x2ee5308e62172691, 0x3f8438484547187a, 0x62b92b8d9739ddd4, 0x3ca54ab5d39f083c, 0x25b3336048a288d4, 0x7cab0fd67e296979, 0x58ba2e783962cbb7
+, 0x77808f1a1b8f3515, 0x290c219ee7153bdd, 0x7584441f79128f01, 0x0442db406f5135e3, 0xe741de52ec030a9d, 0x37469756586776b2, 0xbd64c2a7173adde0, 0x2280b66d20888d0c, 0xdd1b53cb4adb0fb2, 0x3974964394c445be, 0x53b6a95e7c7fdd97, 0x6eacdc6f50496d95
+, 0x178d04c0578a5bb3, 0x0d171a5f5215c9c8, 0xfe0d0171c504962e, 0x04eece54b220495e, 0xac4d145001db67aa, 0x6577c466962160af, 0xcddae62d99686ad7, 0x7a053a048d230d89, 0x1ff09aa0e605a880, 0x5d260426f355232f, 0xfbdaf7b0b53aab89, 0x5eef31b9eb0df78c
+, 0xfb787e56b7276288, 0x4dcccba87d630d06, 0x415e4a4bc0a44b01, 0x0f0a981f71d8ae33, 0xe0ebb786f98a1502, 0x0ea4aa3ce70dc628, 0x8d36240617ebe037, 0x2d20c0e1d2002b5b, 0x336f8aa411a30282, 0x1d87c67d8178ec4c, 0xe468dff8ac26b63b, 0x266086bd7f11c9bc
+, 0x05cfeedc80d829f8, 0x146902a029dd3355, 0x413db9327c068394, 0x55fa413791f64c38, 0xe06395c10021bf9d, 0x18d66268cf79ce45, 0x9e7ae6858dcc21bf, 0x3ad51dbe97b558f7, 0x06792c747aeef43c, 0x27ec9b782170abb7, 0x6aafca394a23e935, 0x18f7cbd98db64112
+, 0x34146ce6b36edbfa, 0x1dcfb4eab7ccea23, 0x68498e1f45b35467, 0x1b20d71a3b71d412, 0x7a875fc94e602e3e, 0x78c15fa449576c2b, 0xb52326d01ccafe8a, 0x3f53f57324d70666, 0x3830836e39bcebaa, 0x27a30c73dd02c884, 0x5dfed73dedf2306f, 0x75ee4a8b6cf54f74
+, 0x97ecc9c5851a8e3e, 0x496b581690c3df2d, 0xf7bba1fe2d169e7d, 0x4b06184810a77bd3, 0x40e6d643b903c7bd, 0x3c90f63b5176906d, 0x92f47e1ac51f1ec6, 0x70c2454c53cc0dcf, 0xb5a75d246c653b4e, 0x7e5173a420a8b0df, 0xcafb44c471d0f4a3, 0x69a3a4e92bbe5977
+, 0x26e93183cdfeb424, 0x1e0489b56fa7e130, 0x669befa672fe9979, 0x0f8aea6a7ef65bf9, 0xff0b883ea96b51ff, 0x31a668763c3c8867, 0x6887a0029701c9be, 0x545644cd70c87d63, 0x537b6fb7db9410e0, 0x6ca227f10229b3b9, 0xc7d1b4d71ff22468, 0x522058d3b20569f9
+, 0x5f4bfd813a51fb62, 0x105b94a3a42424a1, 0x96dfdb685825857b, 0x14d98588154500bf, 0xb4db83514c7a9404, 0x67aaf998856faf37, 0x1229d7e95dbc821c, 0x7e617a17a2f72bd3, 0xe964cdba7222695a, 0x677619cc40a07eaf, 0x7f82c099a8df7538, 0x2a219175ec95a1ad
+, 0x755ac147b51ff3dc, 0x4a87f652f86823ec, 0x6d8d4a923f50278d, 0x4bb952ac98c0120a, 0x968c57a6a31e482c, 0x0855a11481fd5653, 0x3f05db6ac608d16d, 0x33f9e5746e1079c6, 0x1f3458e3ec51f53a, 0x4ae3fc836ceccf81, 0x3c0b2e2db5875ddf, 0x42336a1262cbb5e0
+, 0xe3651453cadc3868, 0x25081cfd6e80a2de, 0xd4cb31092872e53a, 0x16ca9349a11a9c37, 0xb1d3ae440d1cb675, 0x41b2d6ecbccbd6a4, 0x475e6a844c3d0ca1, 0x2cd0e0dedbf07023, 0x85ad446ddb002a6e, 0x72a06e5419a64609, 0x9e779387e9a3276c, 0x414a8163a9408b10
+, 0x25c7b53c1791333e, 0x3ea57190b42cd838, 0xbf20b346b094f121, 0x47570cba99b06c9d, 0xe6bd01c8746cb5f2, 0x3c0b0b8c4c0968ef, 0xb22009690e243975, 0x251737e4a5643da2, 0x3cdd49123ab89dea, 0x68748cd1e3cc45a6, 0x563746685effea7b, 0x4e4c5b1c86eb3a29
+, 0xe1ba017516d32070, 0x5cdd35a0c4ba93a3, 0xdbc66a0c7de30288, 0x22107156a0f700f1, 0x0fb69045aac0f647, 0x111dcb9763d08bc0, 0x266db39f6d78cced, 0x02a32587c7033892, 0x76fc94ce6a2a4b19, 0x474db0f12fcfa96f, 0x0c44584c08377ac7, 0x5f435bf43140f4c0
+, 0xb9741c3014eef7a3, 0x54596c23b536ff04, 0xeadf56bb6ea39450, 0x32f24f6e1a656b10, 0x21422e4dd5f54e3f, 0x0d6ad57853660607, 0xf6f62ffdd0bf9928, 0x72569c930015caa7, 0xf4293579931b9216, 0x049d6a4057e6827e, 0x6223e20060be0e05, 0x20d91ae969dfa9a4
+, 0x02611b345456d47a, 0x601dd413d1bdea0f, 0xe6b017b26bbc9bf8, 0x63399ff3d6542359, 0xdbdfe225045a9764, 0x10acd93346649beb, 0xc652d5a50e0535ce, 0x49efbd5639c4caf1, 0x65a5dbd8a304de65, 0x08ddebed0e865be8, 0x5db8337d5e715261, 0x34cf4c75496807e2
+, 0xd840c7416e44b56a, 0x10fd30d282d8b151, 0x36ffe6df2c1c9568, 0x66d8a38b6d31a2b1, 0x01fad3aa61984774, 0x412a9fd87b303d90, 0x2720945ee0f0ec9e, 0x0c91b4c7ea84cf37, 0x98462f25fd5832f0, 0x6f4cd578c490d842, 0xecc7d24c31ed3342, 0x580ab96994515fd8
+, 0x6d8a97ed98465b3e, 0x16995dc010908ae3, 0x50626a4e555b774a, 0x082636e5a8a9b568, 0xa99435cc4823b413, 0x41fc423d10eff4e7, 0x114236dce6f9f9dd, 0x6c3995c4bbe0aadc, 0xf3f22c975935753d, 0x6b1b3f27edec2a78, 0xdbadaac32ccc292e, 0x3856036f8a3795aa
+, 0x947154caaec01d73, 0x0a22e573e3f0f49b, 0xc50c949f39c184a3, 0x2aadd0868535d0c8, 0x22bc5bbe5f992446, 0x15d36adfca3ace90, 0x038010e37a6308f9, 0x161b06d8d7180307, 0xcfbf4e3abef8d056, 0x2a1765fe9c7696ba, 0x6a15d44ce18ef392, 0x5405239c0369de64
+, 0x5fabda1210f58e29, 0x40cbb03974b37035, 0xa29fdf2875322520, 0x3b32ace85edac547, 0x0f0c92b41d679df8, 0x7f07ecd47a7d2f0c, 0xb5fc65c05accc95a, 0x0e8b1da70636f221, 0xb2ebd131f4e8a846, 0x7df51e4aba57f391, 0xaa2f3d40fef689ed, 0x0ee1e115fde5d582
+, 0xf7d025b42e240ae6, 0x29fc1befeb526af2, 0x7c5ffcaff205e565, 0x4cf4d0d8840e2e1e, 0xb8b00d1810ad0ff6, 0x44d3af686ba915ff, 0x86a8fd1eeea8d08c, 0x3eb300adcf6edc4f, 0x8db03c266b588186, 0x289d0fd301e96881, 0xba83ba260cccc170, 0x26ee69546ceb0c77
+, 0x1109d8bf92c4ea05, 0x033aa036671937d1, 0x4bd9902e5a664a0b, 0x42bd48ed44fdbb71, 0x7359e19357a9622d, 0x0d6ee92855dae22f, 0xc24debb323643859, 0x4c60fee1e191766e, 0x3beaec0e99faa328, 0x056c2ae1709c5b0a, 0x7fe89e0c62710909, 0x7e3b5cd3ac4e6ce1
+, 0xe9d06486ac7370a4, 0x4b1a8c62e99f9429, 0xb11a50e20bc3197f, 0x75ec513c25dac300, 0xfb9fd064b1466dca, 0x290379cfce59308c, 0xca3ee3fb7db99943, 0x2af7a3e930faea44, 0x0d294e6d1505e35b, 0x7d534585181e001f, 0x90285700831d4cfe, 0x419f25105d06c90e
+, 0x5f71e79f5f828172, 0x02921e2a43326798, 0xa0981553e84d4a6a, 0x220c82041938573d, 0xfd2b5b78ef20c927, 0x3c99a2dc611caddb, 0xfb1247fd99ed2828, 0x4b3a3739f724890c, 0x7775ea2d7d2d1017, 0x3ab07cb5ba8ac987, 0x82e5123a20a6b5c3, 0x44965098aa82161f
+, 0x20948c77e9ac4c0c, 0x521e934ab214157d, 0xc8f4f4052dffedab, 0x1da963c2ef46f27f, 0x3be7631e212fa2e0, 0x0d188e88d1a4184e, 0xb4483ed385de4bae, 0x4ffadfde83d2b0d9, 0xacebd9a51a938608, 0x40968c0c9302b0e8, 0x85704404d06f3a5d, 0x3e9f477a61a26d37
+, 0x1da1efc7cbd18d12, 0x4fb87a47b9f2cb04, 0x7556a45e8b5c8caf, 0x7f6991b7723b35cc, 0x3fa10a169532635f, 0x15e61b1cd72bd52f, 0xe6b45dc3b4667c21, 0x45cf3bd4bbf39baf, 0x7343b0636a9d63f9, 0x457551c49ac49567, 0x331e611a3fcec018, 0x7d19e2584756b92d
+, 0x78951df174059655, 0x0573cd896a793337, 0xb3e37121fd458870, 0x3cc032b1a1bebc3c, 0x2571dd06d24d5a41, 0x017382ec4aa29ffa, 0x6cda850c15a224ed, 0x6af59bee2d7586d4, 0x287d3c4027f80ee9, 0x6aa570b9e51d4f25, 0xf29f327c5e0490d5, 0x00fb62f93f43edfb
+, 0x7b06e602dc313277, 0x5d8dc98e723b039e, 0x5bb61813041a589a, 0x2a4c9f13eef7f1ec, 0x9439edcb4bbaba6f, 0x027f4d494e7784ad, 0x087ae2a2fd6bbc8d, 0x230f37ba41aec2ff, 0x63876e43daaac09c, 0x28abd7ae6e17dbe3, 0xd354d50cf000982a, 0x1dd774a1273aea75
+, 0x243658930d4b0902, 0x0df50723a2da63d7, 0x22bc07b9ac9628c5, 0x134123d68aa939cc, 0x4e84ee2cf0d450e2, 0x53a8c6dbd4aa9ed1, 0xd06e741c45610565, 0x608da7f96f2f7e19, 0x59b7fc9fe6a0243c, 0x0da36bb46fd1eb3d, 0x09a11de836914182, 0x3becc1cc0b96f1e4
+, 0x820b8a4cad71c17f, 0x2a425dd0204a843c, 0xf6f7fdaae1523c28, 0x5fb74c0c961e6fb1, 0x0c76e0f72b7845a2, 0x273db117946ce778, 0x7a22d35cdea5934f, 0x73aeeb1b24265d5d, 0x938a618552e4392d, 0x6050215beb6c1923, 0xf32f6ab781efbf2f, 0x2e4ece5c476e1354
+, 0xf2a4a59613812356, 0x555185da018933fd, 0x2fffbf95863bce54, 0x72644f9c3181e7a6, 0x98c6b1d509e3d624, 0x5bddd5730939d7d0, 0xdd197613d550fbad, 0x7671fafa1facb923, 0x13dbb61148c5b802, 0x616bc5c73ccdc3bd, 0x0b175b4c46fd8871, 0x498a1eeb000ab870
+, 0xa49f1ca2d7802521, 0x6906346cce00be5a, 0xf1bc33c727dd52b0, 0x5d005ff3122fd749, 0x51318ad5d7c622e7, 0x50f93d6d15e46e82, 0x88dfa2123ffff3b9, 0x3848e6fce3cac6e5, 0x6cefc31a33ea4f5e, 0x0cc5e7dc4e5e144f, 0xee2009402e59a7e2, 0x257679fdb86f4712
+, 0x4cf68953d8b17e83, 0x710f970c16ce2070, 0x4000b8e9e51e6aad, 0x5af48dacd01f24f6, 0x209679d5d3fcc916, 0x0a3538dd7cbe8232, 0x2d6d7aba44d990d2, 0x46c718f2d4b2c1a6, 0x9953d799a378233c, 0x4f4e80f4a682e7a0, 0x9912f04acbb77eee, 0x317432079a195b2d
+, 0xaccccda6a1c11e3b, 0x3fd895817d0f3be2, 0x016db17673f750ea, 0x635fc619a24009b6, 0xb8447ab3370da1e7, 0x6c893aa19abf4221, 0x5f35ac703d8508d0, 0x13533d324d4adcb5, 0x84610370dece8512, 0x2223f126f9a70f4b, 0x18f00d60f3bf6a04, 0x174bd78b20ef8543
+, 0xeb179bc6a1698189, 0x732bf44a62015302, 0x98352342bc0e4bc6, 0x053f6640c1549e85, 0x65eee8b0397c7ce8, 0x790451f39f2fa27b, 0x36ffa0cb286cdb97, 0x46d07cec4c967bf2, 0x7c849ace30868412, 0x6dee239d339ef499, 0x8ab78548f273e57f, 0x01c5bebd8b7f5ef0
+, 0xe440e5f042eae93b, 0x65583f57fe057db6, 0xe6d5d26c24a565c9, 0x6b3b87a0a6ad702f, 0xd3f5d533117b8e64, 0x4addb9d0da92df89, 0xf1bd51990e0f9bfa, 0x30c624ec1dbcd0a4, 0xafaf2f00da7023a0, 0x3086e132b54574e4, 0x93bdbd4bfd3dd8c7, 0x690976ee132c892e
+, 0x86fc11c79524d198, 0x0f6b95662e02c734, 0x5b78bb385564f568, 0x55c9b3f55d7cd16b, 0xdf1316434ad1c07f, 0x093d67d3fdf312de, 0xa1fd2257ea57b3d6, 0x4b5b18abe4b54439, 0x66c28f5b59d796b2, 0x7baffe6e642fdea4, 0xb9d3753265e68ae4, 0x40903bd6dfb02d6f
+, 0x357958d4d72d6bc8, 0x179330dea4659dd3, 0x5a9ca85bc8721aef, 0x0209f09e03c9b225, 0xc0bf2e9738933495, 0x5e0dde4d715e50c5, 0x2743c96b66a6b951, 0x6af96188a0d6d358, 0xb2f3c72820f2a709, 0x5e9b8fd43327d9a0, 0xf0b13f5324012177, 0x7abdeaf4f741bace
+, 0x8e71f809c25204fe, 0x2ebb7b37d53ce671, 0x85117544f57e7142, 0x6b01295558ed3194, 0xb90518b25e20b15b, 0x4f72fa4b2206b35b, 0xa6602df22a663970, 0x78f110bf96701863, 0x1d9acecaf584f47d, 0x37ec8b293bbf2c26, 0xc89c96d1ba00d299, 0x027e7781c561153b
+, 0x66c5cfa9a1a9cd56, 0x7e13896c49e82652, 0x0d1460afb01a079f, 0x61cc409eec223565, 0x8dd12ab6e6fe042c, 0x526d8500bd504572, 0x1f013bce59e6b0c6, 0x6e534b5bef2d7649, 0xafab37aada602d46, 0x2dd66007052f56fc, 0x6ebfbebe82fb8a28, 0x2705bffa6f07b812
+, 0xce43976f5cd071cc, 0x17b2b48b1114283e, 0x5c5d694e10832c01, 0x38d73eaa3d389994, 0xcbfd7c6888529921, 0x3453da778a079eb3, 0x96bd234cb6ff0d05, 0x7d60e249da086be9, 0x9f82a6e305d8b42f, 0x4870861f46d686d4, 0x3e1faa1ac08b6aae, 0x3d05063bf1506a4f
+, 0x2a5e85a5c9502826, 0x2fa6e1efb48a7e40, 0x785524bd06117bec, 0x27045e44a71da6e8, 0x6e46490f768002dc, 0x5053040141dd4b96, 0x58063025d2d7c242, 0x2db4016be15167dc, 0x9eeba12779f58415, 0x1d809b0b57cf83e3, 0x61e520f2a4aacfb6, 0x208baef99ce836e2
+, 0xe2c10f0c33c3dd8e, 0x7d4fba6d1bb13908, 0xbcb44038069d9d3d, 0x3ab330362e680370, 0x53c08d994364d08d, 0x4cc00675b64c9328, 0x7c55f2417c60bd78, 0x7a076b37e98a7c57, 0x32a3943b5ddc41c1, 0x6b6b6d4805ad777f, 0xed4e6eacbcc5b86c, 0x545dfa661d921daa
+, 0xfac3b6fa9e45bcde, 0x7067d31e3606d834, 0x62e2f77c0c388a90, 0x1f8c4a45e268e15a, 0x8c235a561aaf8a71, 0x16d723d1e55efb48, 0x35fcdc096f8d2b93, 0x0e02ee35957feb94, 0xc4e9cb0c94e099d0, 0x6c82d2e9ef85d831, 0xbb449d1009abe03b, 0x65ae8419015276c5
+, 0x17ab5e5e9a506958, 0x01012f23fd36be0a, 0x71176db8e2ab8489, 0x5600051493730cbe, 0x6e2a8eceab8d9760, 0x5d1ca824756a40ea, 0xe65eef8bba6d95aa, 0x070fe6a4b2b99f31, 0xca87dc46a751dc00, 0x5cf8215977c03f9c, 0x2797ed152c82f3fd, 0x282c220d30b615d8
+, 0xc60d848380ef85b4, 0x466ff34cbc86a6f4, 0xdfd432c782c3003d, 0x3ed47a346efb1fa0, 0xb4ee56fee7636246, 0x71d7f76274c37839, 0x29fb6b5cd5d5645c, 0x1e8d49e9caf17e92, 0xa151c4ca4a2def2d, 0x651cf415587b245d, 0x539001acefaed426, 0x5fcf24ac44d1d78e
+, 0x74506f6fea5366ec, 0x0921d3a4b9b45ce3, 0x7bd958e7da9e021a, 0x5f79f6992c9224fb, 0xe790c1d3d439a24c, 0x624b31764efe3109, 0x2e9eb4234277a43e, 0x3815dfac4a74d61b, 0xa1768fa657b8a19d, 0x5451c4f3aadbd37f, 0xd4528af5e89f1483, 0x65c261d5cc9ce1e7
+, 0x8b1c97d39350cec2, 0x1e76f1cea5ec5035, 0x9bab43055e804783, 0x359d4e0ca3199be7, 0x78a2fb95b2321b04, 0x5be854f1f154e9a5, 0x8e5ad7920df0ca78, 0x4b84f514742b0b09, 0x981cc0adb06d0271, 0x4f4899a450a6f3ba, 0xa6c6329f318c1c77, 0x25317e4ab64c3867
+, 0x04541cf9aae38d31, 0x5149a79605f45a3a, 0x17d92d53439258f2, 0x29af42a557785718, 0x6c2c8121783c0137, 0x26b60a3eecb829b3, 0xbc900c3f94e19b78, 0x6a97e016957065ec, 0x8ff24ae2d5b10530, 0x1364872a089b6a8e, 0xeea7d96119b9faa1, 0x30add8d65f8a78fd
+, 0xc32e58e6c806d47a, 0x77103ea8c25e5a0c, 0x215e7d71ff63b7a8, 0x43323e9bf4cfbedc, 0x7cb89121cbceee75, 0x1acb18f16672ca0b, 0x17fe6fa1257d384b, 0x7ba64d3237ffb371, 0x3e6f197915be4458, 0x306e70df9f1f822f, 0x636d6f7d8fb977fd, 0x20be889a01c70b81
+, 0xc965fde4466225b5, 0x12080e91dae60580, 0x02c2ef338c535cf5, 0x0d2c10ba384f9a17, 0xca918accebfa9e22, 0x5923fcb5c79602b5, 0xf3b03f68686c07c7, 0x789523300aeea7a8, 0xd3b4724e163a5154, 0x354a2aea1811d8be, 0x2216c66bbcb3c5d3, 0x6d225be19e60baa3
+, 0xdffbba980494d2c5, 0x3b3a15134a3b6d28, 0x82d094f5fb6b2749, 0x7fcb7d84f7689b32, 0xb5d7cb569bd9effa, 0x6a3c542b3ea43496, 0x6df6fa1fea2392a4, 0x4415993164dec901, 0xa15ce34a5cf3e84b, 0x5adf7eec0ed80c61, 0xe62a93c1855cb291, 0x5e3fdaa143b775d0
+, 0xeefa426ddaef981d, 0x531187de36ea9a00, 0x8564d05334b3eeba, 0x283cd3c2f754b6c3, 0x96bab685f62f71f6, 0x440f1124768f0cd0, 0x37a57968a2e9b7f2, 0x090d288664157c3a, 0x7d06a0ae8166a93d, 0x55f3da40202663f7, 0x83c156f6cd4a8b41, 0x11ae2ad0b4889ea3
+, 0xdb942f60927c52bb, 0x19e863d1e228c1ac, 0x6bb95734382ac921, 0x191c5eb8e5027959, 0x18f78d73b4fe3034, 0x69070995079e4dcb, 0xc6dab1fefd565b53, 0x0280ee9e79333561, 0x6dc5147e9ddeda2b, 0x2883af366c02e9e1, 0xd537ca90f4b61207, 0x72cc8d7c00f9afbc
+, 0xa80c0839d175f0fe, 0x41a04c40c66bf270, 0xe4f2765b7333f02b, 0x4355c56048491dde, 0x23a0b91e1539fb3c, 0x385b8bef5a41e5b1, 0x501ddec6c07805be, 0x4faba2ed05e46c60, 0xf86012a3d9baecf8, 0x7f077e48bcb4c593, 0x7b47f80442ab5fd3, 0x7bac9e60e388a875
+, 0xff20916e79cce840, 0x6e92dae0be9aa6b1, 0x9abc9c2f874bb08b, 0x66b84e9249a9af07, 0xd079727d2c3ba7fa, 0x3cc9b4ab42bbcb58, 0x1c05140684e7f2d8, 0x42f2e22de9231b55, 0x5ed35d21a458f273, 0x04a69f1d834e8b5c, 0x6674d387d8e5fb7a, 0x5e39141f13be1f09
+, 0xc31efd596696a903, 0x65a5970aa107dfc5, 0xce7f339b9c57fc35, 0x05b60bc9c7035f59, 0x7ff6dd5217c3044d, 0x7d31a994a7035795, 0x8a09198268f8dee9, 0x6ae984ab888fed62, 0xe8f01994fbe2fc35, 0x02a9ab63fc82e8c1, 0x5ce65b755bbc6f93, 0x24964794b67fa80a
+, 0xaac9f48c42b00556, 0x24091c4f22b26312, 0x6d30fef9c8d2a0fb, 0x30c8de5b318fee1f, 0x6aa76f4817ddb562, 0x278652b800f9e287, 0x927f2407e8cd1d09, 0x06294595a9a38e97, 0xf74111dae605b9be, 0x124b573359096daa, 0xae705465e4b29e77, 0x4351062531f2c9b7
+, 0x3688d7be2f54bd47, 0x2d5cce8c7027a741, 0x247d908af9b4d913, 0x02b6599f9fd810e1, 0x2b19fcaf75b4700f, 0x6c5e798f7c301a77, 0x6ae183a3a6614a7b, 0x70a94de0fdbf2442, 0xd2be57bf6d1caa84, 0x59cafb9b651aefe0, 0xf94199db25d1f46b, 0x389af5b09e99e5ba
+, 0x090946ec986c5e3e, 0x31ca5014e71b788b, 0x1b98f5f759d206a5, 0x5b4b2ed46ebebd99, 0x737eb2ef00593d27, 0x2a3faa466c5ccb32, 0xa4389f7707854704, 0x159c3039c372f1e6, 0x5daf6f848dd62d4b, 0x443df3c7ae3dfbf4, 0x65b7ef92fc278528, 0x69772cc673419ebe
+, 0x964b3675619aa430, 0x5abf8400dc08d953, 0x208dbc74e84fc1da, 0x6a2f4f82bcb351c9, 0xbe8d9e42ed3c30a6, 0x033760a913eaaa72, 0x324fa89e69bc9f2d, 0x785bf8493d25b38d, 0xba8b6aa883229fea, 0x4cc358eba80a0ed9, 0xcaae57d70fc92f08, 0x40cf65a40431d67d
+, 0x5e3dea459af2ec88, 0x5faddc7f04f158a7, 0xb45816497cd240e3, 0x369488ee7753e717, 0x724e899b5e5ed35f, 0x79698731fc79651b, 0x4b00f97b0a51447b, 0x49cf38dfb92ff373, 0xfc63963f06c990d0, 0x7ac88a353752e3e6, 0xa352c78bd4972645, 0x3989f9343056644b
+, 0xda357b1b2faa2e45, 0x129a85e16e68a645, 0x7a4e8609655f311d, 0x13c3ca0262b6246d, 0xa0335043cce62d63, 0x0f38f2b155ec2e0d, 0x3eb848e7d8d637b2, 0x276e046a25f65cda, 0x0bd83b24aea42fa1, 0x06d509113cd37f55, 0xbc31d994df0259f8, 0x6843fb43a9fe7c38
+, 0x149a41eea59170a9, 0x5a7a674d1fe36faa, 0xe6facf24dcb20948, 0x05dafc6df4cc92e9, 0xef487c3fd45b5a6c, 0x381519a813c57bc7, 0xac3267431b6c5da0, 0x7fd0f99c768cdf6a, 0xb6ce90fbbab8b2b4, 0x26901123b37e3dae, 0x8ba9c65db9aa481e, 0x6fce3bd66d2c1ff4
+, 0x784cd711bcac99bb, 0x0120bcc18bde4f33, 0x279fb57d0a70536d, 0x218a147f3b8b5a34, 0x9b79083ec05faea0, 0x4f268eba938c2b8d, 0x4b4e96492b7e94fc, 0x725bb1014cdd2193, 0x2f629dbe04c9278f, 0x17eb19bc179fef33, 0x64c02c4fe71faa7b, 0x2bed16727da907f7
+, 0x0e94a2ffc6f6be1d, 0x690639746653d0fe, 0xea58300f91bb5828, 0x4a18fd6c3f37901f, 0x8d8c9121792e1cb4, 0x400aa105779f5bf8, 0xd36ed767f44bb2a1, 0x202f19a9d2581abf, 0x88d0c1437c525211, 0x7faedf80a8361935, 0x84ef1a6105f78762, 0x75ece1d7cd9fddd3
+, 0xc2473ce78ceb2f44, 0x361de3f71cf93e19, 0xafedd803d58ed318, 0x57eb005eb6df4d37, 0x890850d283902e76, 0x3ab8f0eb0a8ab5ac, 0x4274651ca2982a94, 0x73c1c2308a966564, 0x88b3f51ccb3ed44f, 0x788452138b871e35, 0xf50816cba5b8fb81, 0x73c834fe3f77ad7c
+, 0x13fc1a6ba6e718d0, 0x34fdcc417880b539, 0x1d2a67b1ce3b5120, 0x7070398d1bf28a30, 0x9ed3973a28644b15, 0x63e2a8fe4d0b74ea, 0xc85b211552d67cf6, 0x59edce67216b54db, 0x51e06f08c484ede9, 0x1195f6f6a803c734, 0x8a6c6000e59b6e7a, 0x5e17c3e93672fefc
+, 0xa1bf1b926a88f92b, 0x32c6e0dd70d99747, 0xca914e8568b06125, 0x42444a7080682234, 0x5133877cdd44badb, 0x4273ee7e23cc3f9a, 0x4ed7524d3b142478, 0x24d5c329a89a2039, 0xd3a501ffd093dcef, 0x2eba9190d4ce8fd6, 0x5ede149ab4f0be41, 0x2983f244322f8488
+, 0x126713647e566e54, 0x16388e40eccad7c3, 0x8b821205a5fa5a26, 0x3acbe8b3140dc8d5, 0x26b8af4fb4f65543, 0x373adc190e0fa48f, 0x5cde6e2938561c36, 0x5fa3a87ae6f764f6, 0x9347e005262af823, 0x2b2ff25c04c0d122, 0xef98973ee5594142, 0x19d9043228b7a62f
+, 0xc86d0b4c639124c9, 0x051952543e8a5559, 0x232ed76431076949, 0x2b4e347b77c7d891, 0x0e0c557f40d30524, 0x36fd8d9c29bc7d34, 0x59dcb743fff54c43, 0x174556b3f859bc65, 0x80869ed5a7e1e5f1, 0x0e928161e669f525, 0x61f8f37c763f8b04, 0x49b9c40144241aa9
+, 0xc93010076dda7c66, 0x604ecdf469f922fc, 0xfb74b5afd0b4a90f, 0x37a189e443c2cd2d, 0x29b1de015998a809, 0x76d09300cdfedd89, 0x96bca9d0065901f8, 0x7e519486c7547e85, 0x7afff76233b00183, 0x1231f594531dc973, 0x32e4265909a59150, 0x21b0eea2b2a29943
+, 0xe220f1174a206093, 0x58cbff3d1eb86cc1, 0x901cf98e01b233ff, 0x708e45c90d79fe1b, 0x51da253e4d41f6da, 0x250f59d34936f6fc, 0x8c243951f201ee99, 0x5f5ef56612a4f499, 0x9aae67e56e46e8f5, 0x0aba0529edc2aef1, 0xb806e7cb7a945d13, 0x5f039f7112c361fe
+, 0x1b7b5469d438277a, 0x04f460df77aaefef, 0x62a66add024f3460, 0x4ad2dd26c92be86d, 0xe2f4aa34b7f664b4, 0x100dad8137eb161e, 0x300e31b14659de06, 0x527287ef595dd996, 0xa55535c4e29d89cc, 0x584afe0e800f27bb, 0xc7b1a5ba9a0495f5, 0x36a876c5e4563883
+, 0x0df0cde7641fbc08, 0x6495f3152e265dfe, 0x80bd58ea4e6e448f, 0x010fadb86892b256, 0xe8bf34ee67602d81, 0x354d68ff6d6bdfbc, 0x1ccda767f1785419, 0x142f76cb1a8ae545, 0x354825645ae7d69d, 0x622b90fd445bfb21, 0x6252720cb0313854, 0x795dfec85a0773a8
+, 0x7129048cd8e4de09, 0x0861133f4d5a079e, 0xc1611d35b9de606f, 0x04917b99dfdf7934, 0x84842abd90ecc3ea, 0x68e846568197fead, 0xa0699828808ffb65, 0x026da2f93daba8e2, 0x92ec9524b3272c8d, 0x2a052b20553038f9, 0x876bcb3c1c62445c, 0x4f944fab9256ce6c
+, 0xa3ac7d43a1f2dfce, 0x47c371cf4bedacfd, 0x7344d6bd75760bd3, 0x0e18bdfb0f54f9a4, 0xc4b9f10e990d0975, 0x6e2d1bb7655cbe1a, 0x07ed391400d703b9, 0x184d0d1c065ad756, 0xb36d3ae1d0d08ee8, 0x6789b29a6688baa1, 0x3ecf4729fe9d6738, 0x565e257d4a9f3bc6
+, 0x3f7ba4729e6b3a98, 0x6f09bdbbcaccfadd, 0xb089fe953160883d, 0x39cbbc17206a22d4, 0xdb86fd9ed56f6aee, 0x0666caac0c48876b, 0xef8bb79152d81067, 0x31b36736d560bbdb, 0xcddd00eb58a97d0f, 0x362b59966ab84656, 0x2058d03cafc6bf9e, 0x062f497f0e198810
+, 0x1093932097ef6cab, 0x18d60c864cbaf808, 0xa6e8fdd3f0f8c3f4, 0x5fb48054709c0ae6, 0x6f783f5925eca3f3, 0x6b525bc9350c1672, 0x7be5a47a7c7d9d30, 0x766326ffed7d2e21, 0x83cd4a636e4e6d76, 0x56eebb8acd2f0870, 0x84517e4e7dbf9886, 0x4574bd5467b6c8ed
+, 0x7a7ff1e3245cab37, 0x1370a00345fa9354, 0x488b45431eace69d, 0x73abd5b17979434b, 0x5583cf146069ac9a, 0x1a25466acbce3b8b, 0x02726e9d7a32e59c, 0x0d2cc727c10aa308, 0xe1fd3f18486b065a, 0x4eb2ad3b046edd0f, 0x058d817876c8f207, 0x58101603c8158a84
+, 0xd48f531495e407de, 0x0815dc475d734ca4, 0x1e2207964340de50, 0x0be7665fbd1e81d5, 0x49608809236d1517, 0x53df7100a12d6712, 0xc193cccc00f8302d, 0x10092c1f8e918ada, 0xdf5ea38b52ae8311, 0x5e384a9c2c595615, 0x1b54ceafbafe51fc, 0x387f2316f19f845d
+, 0xb77176bf74263102, 0x1308720f342c1973, 0x388d6df3d782e2cd, 0x0e5f66ea020f8eb0, 0x5e807c53519e4654, 0x7de448c866485742, 0x09117741b9a21b3e, 0x38802f32184ed670, 0xcac6db447541914f, 0x231e8055f042d2c3, 0x9df6405aa9cec9a2, 0x49edcf18c499cac7
+, 0x9c3e25c06e7bb91d, 0x469e758cda673c7d, 0x8644dbc2d6861cf6, 0x0e1e9f70a8b0bd2d, 0x9fbd1a1fb44f1a2e, 0x51cac801e6b7d4bd, 0xbeb3e3c08c93475b, 0x15a9e19b0e54c6f9, 0x7079d3ef65061146, 0x57206ad88602d2a6, 0x73304a3d1f7e9c3b, 0x3178a8a8996a8c51
+, 0x15a68fbde5ae5eda, 0x4b6922bc7b73f1a2, 0xe72686267b52fcb6, 0x4d935777cf7e114b, 0x4fcc677352b2499f, 0x10cd2b07029ac98f, 0x598f129e72bb5924, 0x6df47b30b9c06a24, 0xca8af8de537e749d, 0x0852006d061ac128, 0x51855bc0a200efa9, 0x768269e2f0fbd556
+, 0x12425594dc966e37, 0x5a04485049cbc9ab, 0xc56ea1ae890c4be7, 0x48773793b851b04f, 0x84fc8838712601eb, 0x3c3e044b61db758b, 0xfc2fb331cb560707, 0x5b9e2d922f7a172d, 0x2d718614662cd8f2, 0x2d98a5e24f6971ab, 0xddbe6608236704a0, 0x40e417ca05dfe848
+, 0xb6e3bebb39845ec5, 0x2bed2597478ba3ae, 0x491070398b4cd694, 0x1709f6180fbac96a, 0x99ab8b396781dd85, 0x281a73c6fc10a8aa, 0xddb4ebaab8152203, 0x4cc0997933d4be4e, 0xb6c343df2f6d0da9, 0x78a457f003869d6c, 0x161a73896ebbcd00, 0x4044aaace3f9318f
+, 0x790077010498849f, 0x282a27f81879a31a, 0x11e11534f24934d3, 0x34491f9a036145c5, 0x90f1104872a44d83, 0x4fad286de6b30939, 0x7e431830aad1171c, 0x300c88b138185eb4, 0x7743b1692dd8f5ca, 0x4682f891a08775d3, 0xa75a721d610cc8c4, 0x3dc67ecf92bc456e
+, 0xff07604e842bea8c, 0x793ca6ddb49f4086, 0x9e3215935c6c38c1, 0x6c21f6eb852de4ca, 0xb7c7c06ec232ae3e, 0x6ce20da5e591ec12, 0x0111deccdee5ac41, 0x340535d608ccbe7f, 0x511278ff0466c5de, 0x46e13155e72dc5fb, 0x38b0d7c3f99e3713, 0x297f68d2f08531cb
+, 0x26b0b55122022f4f, 0x69e8409b93820745, 0x434b1f0f566b56bd, 0x0373bb6ee7147406, 0x63c751f9ea0b6e05, 0x3f36ce6206219445, 0x555cf69a012e7e2f, 0x55b5b46aae15755d, 0x5de095e1d991f315, 0x15c43b346f5e645c, 0x818f56b9509a0dca, 0x21e19179d8bf822a
+, 0x96b3ea04d4a02d94, 0x0715c5df4f4e301c, 0xf0dbdaeed67a365e, 0x479b96def4aa47dd, 0x421f3e23ec47ab71, 0x343f303a8c43a06c, 0xda49a77fe98f8783, 0x5aad9c070bf35fa6, 0x400bbe2180df1d8c, 0x21ba4f4a3833f2eb, 0xc47e682f767b6c7a, 0x79edd1ac87b93148
+, 0xdd27f133299ad173, 0x7c3764e1e8b0cd7a, 0x727b539d92057631, 0x2d68238b34898bd2, 0x50af70f092df14b5, 0x3f921a543f9feed9, 0xacb93ded5ecbd9c8, 0x1ed8c6493cf954a0, 0xc48f397dea1a132b, 0x6b65f8f7e62d03d5, 0x773f00807a1e2c4c, 0x319457f073d928f8
+, 0xe2aa20b1a07618a8, 0x4b9e0df0162f5cf5, 0x3ccdc39e1a097de8, 0x3d1eb9ef9c8819a8, 0x913c80ad1cdf2cd6, 0x0bb01886a7d65d15, 0x1afb6429ae2caf6c, 0x5683edb458b15017, 0xaec2b62ee7ba3c93, 0x347595f76d5bfce1, 0xd5cb66bb516c6792, 0x52d4df4c90db9312
+, 0x87f0d16f778c5957, 0x25349b2e3ae4aba5, 0xc4e820668b0b1943, 0x309eb38a56e8ede6, 0xa58f46767433412f, 0x349df803e450b56f, 0x90f8a3dc32561b64, 0x68299577d7ec049c, 0x02e498c987638aa2, 0x40def94d56c26322, 0x7bf3e0ff5dc05d94, 0x6a7577fb1dba380a
+, 0x88207101c9de1eb3, 0x471ef15fa62591a2, 0x106ef3c6060df999, 0x57e835eb59767ef7, 0x7296a6b4fd8084e1, 0x0ce22202d2134ab9, 0xaee8a6947d4b4ccb, 0x54adf0506f5ba563, 0x67670b437f6fa9a3, 0x1451f92421a875b8, 0xb27071865a08646a, 0x17b5e80ca4e5804c
+, 0x004f53c3e83559c6, 0x4e3cdc1d57afd566, 0xc7f89433af15269e, 0x4c74bcbf65089d37, 0x59eff80fe1e89aae, 0x0745f3a314b88583, 0x2f56770f3340e34c, 0x028e96175283c32c, 0xc2f678af26f5217b, 0x3af473011b8dd8be, 0x01679a007fa51fb4, 0x6d2a917665f524fd
+, 0x191c2afa4db4d78e, 0x4be9d7d2a7fac6d4, 0xb34a933bbf7b5457, 0x189953267b5612e4, 0x655ccde463e80295, 0x1fe93c2b61b1d5fa, 0x4e6e69f72417b79d, 0x1592d5d28ce76fc0, 0xc2aae844b793772e, 0x0f8d3c473825e455, 0x7b0d1b699be576fe, 0x67c89032af27ecbe
+, 0x5fee28add67060be, 0x145209fc4e6c28a5, 0x3d0716237a2b6064, 0x747881bd4b644698, 0x01fc6178169b6c17, 0x115b5fb6183672da, 0xc593e5e3d4004d13, 0x579cb584923b71e0, 0xaae7bbcc462122fb, 0x294118c3e8cff0bb, 0xb154b16e6c8df4bb, 0x053652583138e231
+, 0x0e30e7ca5a38eb8b, 0x5c8f47a48a18da76, 0x75a337768705165c, 0x1ed2b9b71d81678e, 0x69834fc8fda114e9, 0x65ff3d5fe4d38549, 0xd62300c2f923cc2d, 0x4178b7d593b5a2e5, 0x0532e4ad5051750a, 0x0255a8390653983b, 0x1c4521edfb1fe8f6, 0x2f3a6b5010a72a00
+, 0x79152cddaffd1af6, 0x0f0a79cc85a61075, 0x0fcb457a098c0e30, 0x710418047ddfe63b, 0x366871970b08ecdf, 0x5c763652aed2d420, 0xf7d2e9ef4c8ad532, 0x4a43b8c44e6d2ec3, 0x74120dae518db896, 0x53f801ebb099c1db, 0xf20eccce61d1dc89, 0x5f39d6c4611d1468
+, 0x02de175930926fa6, 0x5e726c6213ad4d10, 0xc0dd566b50aa3316, 0x63f1eb7c74fe33bc, 0xc573ea0c270a7a61, 0x6f6370d7375d65fa, 0x104caf5d18692f6b, 0x09fe9242bdcf3ed0, 0xe0d8047ab16d1934, 0x0b398a0e4bafe9ff, 0x2a576abe60dbde1a, 0x58454afc7f54f4ab
+, 0x5aaa8e3ad187b67c, 0x25d3906fa2e258b2, 0xa7aefda45922658b, 0x6ddec43a0d046c94, 0x6b8056b7f76456aa, 0x712add84b4b59e5e, 0x215f8c303db44047, 0x538f845755a9e7a7, 0x0461f38f90b6a341, 0x7fe9eb795922019d, 0x4848b80fd8f3bcbc, 0x2d99757886a153de
+, 0xe3adca3e20eb702e, 0x7d3c0503d0a3f409, 0xb5a8e41208d5cbbd, 0x7cb3e4229a27456b, 0x3c28a52725fa627d, 0x01293a82cb1bddfe, 0x372ee1d727a16903, 0x232e7afb711415bb, 0x51c3021c51eccff2, 0x0f10e2bc650801f2, 0x037cd776971c68fc, 0x33d3f2707632fa69
+, 0xe5baad6d7adb7320, 0x0826e640d232482a, 0xb8ae9d839d393009, 0x09fed4ed4492ffbc, 0x062f9ee3ac2c64c9, 0x4c9421fd234f65f2, 0xb9a0824d55f29361, 0x462fca021a0bae6d, 0xc3dcde2a8db7c11c, 0x1ced2fdd5ff5e230, 0xb4a7c64c5cad8fb9, 0x54170a16cd8f756a
+, 0xe5d997d3f59f24df, 0x5da1c5d4bde51147, 0xc44149919425fc0d, 0x090254c81ad60a3d, 0xcd71397bac019e76, 0x1d549b1938095d5c, 0xe67774c76df3256f, 0x7466980532e4307b, 0xf40b4207ebd5f703, 0x20dd613441fbe712, 0x56e1eaa4096a077d, 0x376b84ed795dbd00
+, 0x8db7fc4c7a802bbd, 0x65fe04ff10b386cb, 0x7f620ac43d2d6809, 0x361b4c1d501a6507, 0x25b9d72e0f0fe018, 0x278331addd2f5fab, 0x7a08d1b7452c4d5e, 0x24fdefab552ee8e3, 0x2c1d8fb3fd0e8253, 0x677ff0650db81e07, 0xe66bbb99f36331b4, 0x4e69b45c7e0edbe1
+, 0x30f3e19a03e978c2, 0x25a8a596d703365f, 0x9fb8d41b67378c29, 0x7b4c4d67a69a84ac, 0x1c0586c3c0fa2752, 0x375e24868b09aa8b, 0xe4eeddc810360a3c, 0x468dd1a2163f2b7e, 0xdf96cd248842214f, 0x7307816f0dda8211, 0x43dc96b0a61fc05f, 0x75adb0e9a4f6ce10
+, 0x0439fcc83098d555, 0x71569c609ca1de14, 0xfbe858f81623e25d, 0x26b01cbe131db073, 0xcb6e7932946c0c04, 0x037dee8d73f86ed9, 0x969978d5e0ccf8d1, 0x198538df3d6441b7, 0xb27020b9f37c09cd, 0x296eda198454b80a, 0x871d22f39dc029ae, 0x13df76f999f0c02c
+, 0x54dd162fdd971dc6, 0x598a5346292d55a6, 0xcb8a5e3677542f99, 0x76a2237af0f7c46f, 0x9d2a3c11c3c6a83a, 0x4de00f5cd4f2bc09, 0xe99711f94d672dd9, 0x0e00c74c7f7ced09, 0x3982ed71885fc998, 0x155caa4532f7425b, 0xb39b60e091a99ccf, 0x62b6354da2e8fa35
+, 0x5c9ff98f93f0269f, 0x2094d8c2610a7cc6, 0x366f062e1ab924d7, 0x24d5d5d12e3be0ad, 0x7f14e8af5780f628, 0x778d24f4f9ae5931, 0xe48cd9367abcc598, 0x196687002fc80796, 0x52c4fcb72209b386, 0x0676d113b310c73c, 0x8241c23d82cb3c4d, 0x53ee306806a89ff2
+, 0x927e2b011a6f05f8, 0x1c74c2c1fe52689b, 0x1c053fc6abfca7f0, 0x5407aab4d9a873d8, 0x2b0fecba523a5d95, 0x189f75aaef2a8cda, 0x480efa8cf923ea23, 0x3dbb693ca644da39, 0xf700e878c83e4ac3, 0x0580b622bf4a2d82, 0xc1c4f2863f100bed, 0x6050d6c3a884e58a
+, 0x734032840c05c8f8, 0x2776de4edf3f0b14, 0xf15f4810ab971efd, 0x453a2369d42daec0, 0x061946c9afbd95cb, 0x4fb878641c5fec53, 0x9322608aee6cdf29, 0x3a95e27c1dd53b77, 0x6fc8d19194ac154b, 0x60c0f25944b6640f, 0x098b4a0c0c337fa1, 0x14d0c6272777853c
+, 0x8ba539e9be5e1300, 0x7074d564e1547f04, 0x7d3aba794dae7dcb, 0x6bc696f01eb600f2, 0x0a9896a64e921691, 0x24a4492b8074d6fb, 0x894591ec863875fe, 0x10130f2e79503558, 0xc0dcec0b3d9ae708, 0x14a6ab3f3a309e60, 0x1f66eb8df4e094fa, 0x71617339f5f49c4e
+, 0x379013c85d65671a, 0x0a98f320c066e165, 0x3462de4276698572, 0x28f6d7816527832d, 0xdd6b1dc5da8cce43, 0x788a46cd018d04e8, 0x592f5d21724dd742, 0x7f1d4fd764d73e13, 0xdde508fc94071244, 0x4f39da7a80d79b25, 0xce14b9b8bfabfa40, 0x05103dce983312c0
+, 0x6247dd82064ce3c8, 0x3a970d1ed2ede9f7, 0xcaf318b8c000206c, 0x4a1f29c17b4f3b0f, 0x984de88f4b3f4a4a, 0x0fa095165756579c, 0x0e33c5984955b95e, 0x3f52a69915b4f089, 0x3f8f56b7eb642588, 0x2354425f2fb51a13, 0xdf675342440e42aa, 0x7d8cb1765ba4aaf0
+, 0x3a7f6bd0eddea383, 0x214c89804e6f5ede, 0xf95550a207a0a121, 0x3cb9dea6d844ddee, 0x22b2f03ff887c015, 0x0d4541cd3a0597fe, 0xe514283e506cc707, 0x02967e8661a3acf8, 0x5c7512733f80f82b, 0x66e4a3b05e89eb75, 0x61b15223eb950921, 0x5b26262fc72dff40
+, 0xa263fe09838bd03d, 0x67c9d205b6707465, 0x5823d3fbc68a388a, 0x0c793feeb593f92a, 0x674511a861ee513f, 0x623cb12277d83fff, 0x5776f5a0d9f916bc, 0x312a7791a2bb9379, 0xc68acb3be3e1beeb, 0x7c2b8ce17d615e1b, 0xce9ec87104c39107, 0x3fc40bb1d48900a3
+, 0xeb25756cd88ad99e, 0x57f2f7c59610c282, 0xf59eeb422771fe29, 0x4e8a2f4419526433, 0x1767cee77c2e56d4, 0x7b5a67e8b772a094, 0xf2764ecb164fd6a1, 0x45873cf2fc60a24a, 0xbaf61dd7e4b38a48, 0x0c2af9d71360a11d, 0x2b4463bcf4d8d1f3, 0x49ffa6d0df4b4bc7
+, 0x389321375a9e8b14, 0x309c360acbcfd1f3, 0xa4292bf6ae84942d, 0x3498bed23d233f3a, 0xf8001a7d15e1c2d4, 0x7fe05b7356e42030, 0x056c4b7d0560e393, 0x17131cb2d84a6d14, 0xddb35efb50a87c66, 0x32a41979ac61d161, 0x3c55aeb89fb03ac0, 0x54e0a7369567f313
+, 0x7776184562e6b50e, 0x1e7b74735204c35e, 0xbc3704e0b4c0b427, 0x0efb4c9ec4c1f057, 0x44019a2d92386591, 0x05d845e096b77230, 0xad219d26ebb227d1, 0x00b195e45e8d8faa, 0x2b0ce26847469e51, 0x1e7b23033edc8f90, 0x467d9c79ac0620ee, 0x7c1f167a41b8c097
+, 0x1e7fe0e7559a7955, 0x2eee8695ded3ece9, 0x5fbeac53f5e65d58, 0x7a4f73a3094c46ed, 0x67a3a592f7b5dc8d, 0x346db83e75670a16, 0x9ae3fbe517848ba3, 0x2c44c0f4d0129ce2, 0x74c9026564d84827, 0x21f6d6a5edb2ab9c, 0x0daf69403f60fd94, 0x585b5bb7aca4c8de
+, 0xe25524c98a9ffd09, 0x3de50abea6b88519, 0xca9f369c14245ac0, 0x734d822f6a26734b, 0x5bf4b3a3d3349c5a, 0x1c455fe359c40864, 0xa43b87ecee82fcf5, 0x4c3c48bc27730918, 0x2f215ecef49fa901, 0x0478f3a2105dad2b, 0x15e90959144f5a60, 0x3970673ed2bad357
+, 0x370509fa6d9ac659, 0x63a8e8954ec0be8a, 0xd4fbc4b0c5e2f051, 0x61f85a16963c1de5, 0xca1a957624f6baef, 0x40965726c32f5bb5, 0xd306358e9b7a7ee8, 0x564c3f1ced165145, 0x15c498e75cc03566, 0x4fc92292f00db3d2, 0x963d80120fb0df7c, 0x79c1e54694d105c9
+, 0x374d8d411e924824, 0x0f5881aadd60723e, 0x041ee65a086da367, 0x2d1eb1a2ee3dab90, 0x1d6f4ef93623e0d9, 0x0b04b92ec7523fbb, 0xb6b42a1cf3fab51e, 0x0a9e2150e2ccf666, 0x3bb5d10249820113, 0x5ef3aac00fe4759d, 0x22bda866f7e6aaf6, 0x39a8824e02b28edf
+, 0x203ce8ffdf30a4b6, 0x5dd16137db42048d, 0xb4b1e3fa1a548e38, 0x0d195ad50b9080a7, 0xb8c3d61b901a3c00, 0x78f0819e4cc2fac1, 0x0614e8f99a6b520b, 0x33b7c971dc7aab63, 0xb1287924162a4f70, 0x52ea4365d0d4c24c, 0xc19830a3dac4b36b, 0x2f0c50f8ce98a9f2
+, 0x423b87a95d1167a4, 0x237160ee8e47539e, 0xff6cbcd57a8e66a5, 0x1054567a24d43039, 0x3554e2eec53cf89e, 0x1ceebe03be350185, 0x79aca9720c3c1ccf, 0x60a377ad9a2a4adc, 0x331e2bbfeb6896fc, 0x529b6e7892d65f60, 0x2de25d6386d2f02f, 0x35582d49bd719701
+, 0x3c83d81fda8e796c, 0x22ee4941ad71c9ee, 0xd97b16282de0232e, 0x629f139b981a9a32, 0x28f5053797bf570a, 0x3303f7e448650d84, 0x21722cedd2e78d5c, 0x7caa99bb7dba18e6, 0xb82a0181aefef6bc, 0x5a277a583e494b1a, 0x68e6b80e182c098f, 0x15883e114abdf029
+, 0xa5d92512a7efdb5a, 0x42e112b2df11ef6b, 0x9fd0fa9464162afc, 0x0de0d15a64ad6e68, 0x83aa927ac7deedd6, 0x7486cb90b8d8a781, 0x99a3680c2c1a32c9, 0x42130745b62e6095, 0xe3f228f51946bcbb, 0x0834bb884cee1ef5, 0x0f8a9dfb3099ed83, 0x7cde4af466ae2f9c
+, 0xdcacd0bf3017e1fd, 0x15caad82b9dc1a75, 0xada87fbcf0789084, 0x1f189b65c3efcffd, 0xf01ccde9acef6422, 0x13f7c96374303dd2, 0x3fbfd79b67edf64b, 0x6e50baa0bec3968c, 0xb1964c544699be74, 0x6f3fc2f1c131ebc8, 0x675cf297bab4ceba, 0x500e22e741428a0c
+, 0xed2676f92494db17, 0x4549a16d472bda3d, 0x624cfbebb7c0990c, 0x75ba0ae254f5a5f2, 0xc6c2aae45d15be12, 0x1ea4807b3d840b15, 0xc4e60e48f7081018, 0x0b5b52d65f86bc44, 0xfced71759baa3fda, 0x41995c301cd3ecc1, 0x9fffcfaa09132166, 0x3beb39a4f8795edc
+, 0x7bddc120c23a77b0, 0x086c28e5c0c10552, 0xfc7bb21194b2ff9c, 0x2f5787ce8049c487, 0x3c478ec48fec0d9a, 0x7514d7e37f7b0e8d, 0xddca2b02dcbf22be, 0x70b78ec3169a38dd, 0xdde9bffad4b5a170, 0x2f2c801573f14b3f, 0xd5022d986b111774, 0x10627d919b0a4536
+, 0x4a316d9e8161a6ce, 0x00cd0f5dc76bfab9, 0x661d1ab56d8586bb, 0x67ed6ad0c164c3f8, 0x02702a01987b4717, 0x4710ad22ba05a13f, 0xe8d90eca51ac4b31, 0x22dc72b3be33d97d, 0x22a9720e2d703e9f, 0x478b2fffd75efbc1, 0x737e0c11a3b31cfc, 0x4113fdff5ce3b059
+, 0x3eb2303770a80b5b, 0x5b08a98c6fb6f704, 0xdf352a5626a81abd, 0x4b182f9b4677bec7, 0xd9e3fdc81da0e897, 0x3808042d75725fc1, 0x96ad719ae6c90c21, 0x1be74899ad1d9283, 0xf11f50780001ee8c, 0x07d06d5de0206f7c, 0x66fd3b9518f0a943, 0x5ca4c574ea9af34b
+, 0x8443b6bc35da6da3, 0x24c279e382cd62af, 0x5b91d35d74beefcb, 0x34ad263fcca8021b, 0x113242b85d6f6020, 0x23bb104cf0c31cf7, 0xe06409a1af2064e6, 0x5b8be7254f41bf07, 0x975ce3a52d3a85dd, 0x010c9946713c220a, 0x5638062bbdc0fcb4, 0x587756ad310c0ba2
+, 0xaaa1e83fe1c076bf, 0x7a22a7b4aaba1b9d, 0x655384f4f5ae2001, 0x111f1a4939741d0c, 0xd3045989690d7074, 0x09a4c2e207e2707d, 0x9d0d7168ff94a41c, 0x1345b8a96a9bdc0a, 0x388f9a37bc53ea06, 0x53dc0c98e563976d, 0x5edd5cee3d838f30, 0x1fc169e9e9629b1a
+, 0x75bc3ba550b9ab51, 0x656c27fec4564b68, 0xb54c46724dabc2aa, 0x3cbf237e229cb3a2, 0x80584769552155a6, 0x3ef5c857ff7bc1d0, 0xe00c54604c4e6768, 0x43c5dcc14e805663, 0xec65a429d223a42b, 0x2b86e610f7a4b06c, 0x0b3d477800f1d1a7, 0x2a44125b6e5f87b0
+, 0xaee04c64f2f0780e, 0x3cfb6dea1412e1ad, 0x8cf545c53f22eb93, 0x0e3dca30fe4a817b, 0x0a0f0646e0d0b88a, 0x1dc4e132b2844385, 0xcd80055df44e685b, 0x67697ddac11cb6e4, 0x978399d50afee64d, 0x59817e867083b7d4, 0x41c0b04d7bc293d3, 0x65bd10de54794138
+, 0xbba4207786adb65d, 0x4fcd7614eb81b12b, 0x6224c558ac866a18, 0x3bffb60b25123b42, 0xac15ca762fb3b5b4, 0x03ed17c63d70e840, 0x13e724cbfd02f4f5, 0x5e2ce91293a818cd, 0x066475cfebefbd6a, 0x5a47e18651de34d7, 0x86065e30e79d2e93, 0x5a83aa94c2950256
+, 0x702b168a5e44cd05, 0x56d42fc33e39a59d, 0x3e0bb32ccd9a2492, 0x0f6beb9f650905a5, 0x294fd9eb03e71134, 0x0ed502e42de89ce7, 0x2f08c42151d5ba0b, 0x0e47e25a422a3388, 0x35cac582afe131aa, 0x75603e13abe78ed5, 0x0ab5b6c9fb4bb78a, 0x0c2330e39bd35f74
+, 0x148e6f416cb9e0eb, 0x10fb0c009773732e, 0xb8ae428290885aea, 0x73ad17feb4f06822, 0x2689594c05528131, 0x574f934673da218e, 0xe1d5e84e2bd69b7a, 0x3fc82b61a46b63b6, 0x04889691b79ba3b3, 0x398d0890526b9278, 0xe80ad8a2bd09bfc7, 0x64c3e1cfc944d248
+, 0x8c7030e8ab4e5a40, 0x4a8aa5bb0885125f, 0xd77e2fea6c1d8e84, 0x61d5db6d4883a67b, 0xd098461eae890f27, 0x7064c9de21cd0f08, 0x74588748d09cc933, 0x1144b451db712ae7, 0x5fb7e9d9425f19ae, 0x2ffd742f9fc95ce3, 0x8bc6cca611a528b2, 0x00b4db6fff33c2f0
+, 0xd47da46b2958fc43, 0x62b8f6c8a2dee671, 0xe374274378d8c293, 0x2210f8a16f8076d7, 0x78f52f71fbbc9abd, 0x0f29c234027c02b6, 0x6810d38ea8291685, 0x46aa6761cfa73171, 0x7e33073bb44adeb7, 0x629db902e3d54f6e, 0xf14047046419bf7b, 0x6dbb9ce12b627e84
+, 0x2225f2425a912ec7, 0x1fb5660c743426dd, 0x44de2dd8b15f8e9e, 0x62a8adedffa4b6e4, 0xc8130ca8cd27b2a2, 0x4c7a1445fdca8bb1, 0x7e9fe7d17682115c, 0x319245b09009a47b, 0xa8c19dbc9ac9df5b, 0x268d70837679e221, 0x8a34da4ee0401b6d, 0x63bde735fee515d4
+, 0x52870bb171c59be9, 0x5eea75eebe1e4c3f, 0xc3f03d508a91dc72, 0x1e9f3f00a5f19bdd, 0x2f8551c669776852, 0x2ebf6cf5d1a11f0d, 0x8ea8a7fd21ebb544, 0x25570ea4410f20d7, 0x169307202d4f1036, 0x0997facbbefd1396, 0x3fcdb7b6fe993494, 0x783c0c33119cf700
+, 0xbbee2ab9ebdfa15d, 0x29181b0e4f62caa2, 0x3aca5aad7166704c, 0x67536f706a56b0db, 0x480b6720d8a05722, 0x5c7d1a3e210d6e1a, 0xfb3015af85701ef1, 0x724247851139af98, 0xc4312a2254650e7b, 0x45ad01a452c59e01, 0x0166affb206aff51, 0x6fe936bc5c7b1870
+, 0xa3215efcf2979fc8, 0x4496523d88fa74a4, 0xec4b441a9b388ccf, 0x0adac47617debefe, 0xbb29f15ede2898cf, 0x38f57abe2e5410a3, 0x05a2c4b3f3a42c9b, 0x120b0b16ace909fd, 0xa0edb25d5792b22a, 0x105000b02bf085eb, 0x95dddc2530e803ba, 0x1357a7da9b329245
+, 0x12f3523db9df345f, 0x2e8ce8820b90afcf, 0x5e54d2c9373f4956, 0x0f5f13c2c46f56fb, 0x22b6c55634c44feb, 0x78e2b68bc94fdab5, 0x557327d3a607eb75, 0x1c3421a1afd9a946, 0x12aebae0209603da, 0x5a2dc537fa1503ea, 0x627a63e293b73a77, 0x67099df042cfb1ff
+, 0xb9af772eaf8a8f7e, 0x311d5424872a4892, 0x843f24824f7b98a0, 0x22ba779ca3de0199, 0x998e6a90625da078, 0x70867ea98c184bdd, 0x750ab728712d7e20, 0x3354677546433294, 0x978c6905e7021bca, 0x7347a9f95fc217be, 0x387a415bcfc98421, 0x5019ed4fe7d32882
+, 0x4431fb315ded4054, 0x68cf2afd089baa06, 0x14280d177bd546fb, 0x21c00ea84fe0543d, 0x1fe5ff11f0382b42, 0x577ac744a93c8649, 0xf6589d80637d658b, 0x2a6bd1ace5ac9816, 0x05ac90c2cf9b3f06, 0x3605c782fb4c70e6, 0xca14d815dc28a09a, 0x15d1271c350fd8e7
+, 0xc9d9865d9daacbaa, 0x4a4bbbcc4b3dd9e0, 0x584406e29b71696f, 0x44fb330dced38784, 0x9d4a1ca0c2140c88, 0x73ba23f780abcdab, 0xb3db10b715e47634, 0x63adefc2d7cb51a3, 0x2b341a7db12ad730, 0x2eeb13ce0a8359bb, 0x20b3e74f0a52209c, 0x5d2751e834edf632
+, 0xe19e3f47adfbc864, 0x508ea101d9f15fea, 0x0a90521099552ea5, 0x5e0c78fe1fc64321, 0xa701322b8623af07, 0x02406d630da6406e, 0x5a6f18a87c7d53af, 0x075dee250481febd, 0xa6635e248fc9ed7c, 0x3ecef5811d276b32, 0x2b0dac8c3949a180, 0x1f17767bbfacd81f
+, 0x292aa9c5ce43ce2e, 0x0e68491efb805a64, 0x1b916c8b70e1b168, 0x63ee074de83a5f75, 0x00c0afeefe1ec9eb, 0x2b0357e5dbfab616, 0xc01303fa5716fdc4, 0x39e54b925a9629bb, 0x0b9d6ea21f17f513, 0x301736eabb7cd0ad, 0x79527309f54886cd, 0x6b7d632c6ac95c29
+, 0xec92b34738d6e9ed, 0x5f12f2c37f939519, 0x9cfe95e8981f2fa9, 0x415e841d19014c56, 0xc63d162e18b70f1c, 0x2298118bc731b6b5, 0x5a08b84ad86fa408, 0x3d877a7ed9d595b0, 0x568275ae4e46905b, 0x43dcda5a010e0f76, 0x6824b35ad82322ed, 0x28f94c673df8a65c
+, 0xec6850e31e490bb6, 0x7aac4c88d3c5ce20, 0xa4c611e755ce22d4, 0x4f3037c0c1a101e1, 0x0c1b6b69c0ff89c3, 0x34a7c2965708c6ed, 0x71f818cb47d265b2, 0x3baca305cf0b6d92, 0xf1541f01f5d56025, 0x2466dd13cb5210eb, 0x336b8a0963f61a0e, 0x300e55a0abb76bfc
+, 0x212437a242fd2bc0, 0x0d3f1d2b212a04e4, 0xe0e168be7da6becf, 0x21a177f1fa2d3b6b, 0xb055ecc557520ef7, 0x523b549c76c6c54f, 0x745cd02ce492da62, 0x66841edf751274da, 0xc6e582626fa08801, 0x7223541e926cf5c2, 0xa6c01b2f02352dda, 0x2a04030cde006993
+, 0x750b7533b96ca647, 0x5fc178a955174c5b, 0xe98228d2a8c75626, 0x1f252e813aacd524, 0xb5e862cbbf079fb2, 0x1d4cf3943ff465f4, 0x5d4f653e9c2f3e7c, 0x0241415bffb0e83e, 0x7f1fbfd050b465a8, 0x25a7a3495d1517e6, 0x0fcce4f105d00c9d, 0x087d85a6570305db
+, 0xab3b2ca6a97dd5f7, 0x3d1e94f91931dad3, 0x3df40692baf7e483, 0x20e46856aa422674, 0xf5956c399491295e, 0x6ce351f87a954215, 0x9452c4784828bf3d, 0x5a6e91b594c050a8, 0x7cb6924de450c248, 0x7b7e92162118dc03, 0x9895c12e5d68abc7, 0x10c5a49a31adf4ee
+, 0xcbd5cecc9aa5ffde, 0x6dbff6c60282b9e8, 0xda9fb9255157cced, 0x3627df7e64c9e853, 0xeeef220d5f216bc1, 0x3ed46571ab9ad728, 0x2f7d6b33a14cefe0, 0x07c932cf42986f72, 0x118634c8b234d34a, 0x359202622328f91f, 0xcec8cae9bbc1480b, 0x125d0a6f0c76e584
+, 0xbf0d701057db44c4, 0x00f9a08b98d7cf23, 0xc342a1c7e03579d4, 0x1f34594861a3e3a8, 0xb4bb5bea7643cbac, 0x7678ee2c7c71052b, 0x3dad52217ee63942, 0x651b11de50e2ef28, 0x57198de305ce0e38, 0x10abbb78cc6226e1, 0xcd11606de4b1d0b8, 0x3db3a79ca11f47bc
+, 0x467acde791ed99f7, 0x28b749dadb993f2a, 0x07839480be035ba1, 0x08b6097587a2b1a4, 0xb2aab79de96b3cf9, 0x0d14cdd8b25dd576, 0xad1bab5d11fe2683, 0x228877694ad342fd, 0x73e842e39a02cf84, 0x229e56434fc94082, 0x4bca58d5d7f1e00a, 0x54c1efc009ef9bee
+, 0x0519025d650616df, 0x008b15c1733654ce, 0xac7b622bc503b775, 0x1553e7ce50d61ff5, 0x304cddac0ef81166, 0x3c84dc032c8a2469, 0x325cb8b4bc1552ed, 0x3059cffc1db7a948, 0xe64f6cd6ab509289, 0x1d561c8146424865, 0x6a614356ecc78fe0, 0x7a910805f6267f43
+, 0xefb12cf42b677bf4, 0x18a69cc91586f6a5, 0x843852e85790c03e, 0x3b49aeaea065ee09, 0x73edc5841ac0ea94, 0x6f2c2ed2365c77b6, 0xb81018272e67b881, 0x7e3fd493c632ad24, 0x1eca72c714e5adfa, 0x57ea72198fd219f7, 0xd9b3049ae86fb1e0, 0x767c2f81c2eca62c
+, 0x438121eabfdd269b, 0x5f2c5244a8a2ad6a, 0xbce045eddf10213c, 0x25e7ae53aada6a2c, 0x99cc28039ba9f48e, 0x753045c8458d2a81, 0x55475cc4adc6bf39, 0x6b11793b3fb47fe4, 0x5b4f3894390eea9e, 0x6cd2f19ba2c50a55, 0x5cbb59d4b10f5d86, 0x559a71e89fa9f7fd
+, 0x2421a701264c487e, 0x3ad306d58d62cfe2, 0x7095354b4349038f, 0x505f8a5866220651, 0x7a8d87f68bb54abf, 0x3405baa84f5aac5f, 0x2b5fc64c3bdb2049, 0x0f592f78c7f96dca, 0xedb4b3455196825e, 0x6dcd6006adfcf115, 0xd03c31a42f90f9ba, 0x07c80b99a8fca111
+, 0xc02f2680ff7c0267, 0x6b6d059c945d7fb3, 0xc85403c1ee78ff9b, 0x4f79bfda570519de, 0x59f26988414f2fed, 0x50ec8deec85e0d69, 0xcf3dd6213c6a9030, 0x1007b02d298bae84, 0x8aecba2c26af6cf4, 0x522d76e2a9a8849c, 0xc270bb16c7aa8ced, 0x30378c907f8b9661
+, 0xabf5b515972e3e39, 0x13351fc00409e366, 0xf8158a83a715bcd1, 0x1075efd591d3f71c, 0x615a497530748d76, 0x68cd900e60cf128c, 0x3188311b9cf90bce, 0x3b62f5a4a657e89d, 0xa70c8e00c9de4687, 0x2b7c08a78eb9db78, 0xdd51b94bb90859f1, 0x599630161c92abd1
+, 0x5c9c85fe5b2c2d2e, 0x648d5b2a694e2993, 0xf57ee47d57034a52, 0x0f7dfad345ff1582, 0xa227aa6ff75c1967, 0x7b43760086b987a4, 0x60a5d68efb497317, 0x03f881b82276c8a5, 0xf3f4da0164ddc65b, 0x43493d9a6bfaca58, 0x2a1d10426ab3a363, 0x1b4cac2dfed5d1b0
+, 0xa5b070391ac1eca4, 0x4a270a8465445368, 0x5410d3b1fd13b57d, 0x4df5aa1746696d13, 0x2d23c4c98453560e, 0x0177d8b3ba8cab3f, 0xac8c2530257e63ef, 0x310d78740fce9a89, 0x8d8c4e562e76d358, 0x4d74490377dbbec0, 0x52e9dae912462f1d, 0x49be8fc4840b7869
+, 0xd9420113c850f9b7, 0x5eb3bc19c8251ecb, 0x46bb57e6ec7c99b4, 0x35451f80444c9711, 0xf3cc30ec44be9966, 0x4db36725283dba09, 0x5c61d920f12857be, 0x7a45c1e09f30b04b, 0x8a53a738f6a98f50, 0x6149931e42307174, 0x3bf2fd42c80b97f0, 0x5a23880bc43376d7
+, 0xa1a27464a926405e, 0x6984d079c4cbfb69, 0xe7837f06f4cd0fbd, 0x217d332f787b5ad5, 0xd572cc1aaf6464d7, 0x717f8fa8a2c1d36e, 0x8d709e58bc8ee44d, 0x11173ea84e0da76f, 0xfa7b291b4460fa4a, 0x0b6078ee858d5556, 0x706e2cf2f0132753, 0x4d2dd09afbe33b10
+, 0xd1c953c4829f7f89, 0x46be94ee2f3f291b, 0x7c78a37e1e816d6f, 0x3f694bde3a2d4dac, 0xe5af1f197accf019, 0x6dd49c1b6036ec20, 0x74912b774f6a042c, 0x620541021b9873e8, 0x9b72ba156a926d84, 0x3885829598a8951d, 0xb2c9134fbe03c08a, 0x3c02c43044a9e4bc
+, 0xc813ce182a1427ef, 0x45d3f6276e147fbd, 0xb646723192405436, 0x0207404101bc728b, 0xf2885cb5b3e2508e, 0x2a061d41ebf7c2c1, 0x683624d1886c3038, 0x1c0ace954325ccc2, 0xe5a3f05c2553d5bb, 0x4f57b9e6cf245121, 0x524c477812485c27, 0x0b6d89954a61ab24
+, 0x01358e79b71afbe7, 0x2710d62c813b58d5, 0xa58ba5317c33bc94, 0x590f933e85f287ea, 0x35667e8380750859, 0x6cc7b01a2fcb8605, 0x6ccfcb3b73a0ff13, 0x4820cf726240611e, 0x93f862efa1a6806e, 0x173e74626ef6318c, 0x34205f9c21c690e7, 0x38099b40e2560b5e
+, 0x068aac4b0dba261f, 0x17e413dbee0c0bbb, 0xd1331a9d83d46d1e, 0x4fcf8d3c43f0f40c, 0xace49e23d2307715, 0x3d0e32a05be00978, 0x0a7a8f5d3a11a22d, 0x62ab52df79c30ec7, 0xe13d5af0af06bf9c, 0x701da52a78e63f73, 0x6f8a118a9b92fc7a, 0x34c297ba44071199
+, 0x3dc1e3f2050346d6, 0x097c8c7abb7a50a3, 0xc9b350c9140c52d1, 0x06dd245539cf7008, 0xa0c55b54d55fb102, 0x05f11ad38877f602, 0x7ddbeb2ff687d74d, 0x7e34591b0834493a, 0xf5db46d45ad66426, 0x6e7261f047124a44, 0xd52f56783a9f7c8b, 0x6be65a19361543de
+, 0xb4d8404e0c48b3a2, 0x543f86cb88776f08, 0x22dd24126be356a0, 0x3d306caf597e9499, 0xabb4dd273c91e3fa, 0x273a5136d01e2dcd, 0x84a8604fe6c166ca, 0x29caafffcd0b0398, 0x53ad165ca51d52ec, 0x50b7d91892a69689, 0xb934c1d2a183090b, 0x2982482e0e2c9240
+, 0xa1198f4da9a30299, 0x4ac6ebc5b9814676, 0x2ac5284d24d60202, 0x07097286f637a7d4, 0x87cd86530245e43c, 0x5ee7c78f63410628, 0x68e085ce5502343f, 0x3864885aa529617c, 0x687ccc063b736597, 0x57dca8230c3f2bc7, 0xbc432c74448036a2, 0x4d4efdcce30e7b83
+, 0xea54c1eaddbdcb7c, 0x51b50688a16482d0, 0x03077ff082940ba5, 0x746e37282c271838, 0xc04bfd6f6be17778, 0x2cf3afd95e59f918, 0x39d2f5e0c459a07d, 0x7a09ec6bd67abffa, 0x0fa42470790cdaa9, 0x13205be6c97d6b13, 0x6628224820efc5f0, 0x7fe43efd82ae114e
+, 0xbc627fd2006f606c, 0x06c40c6474aa46bc, 0x512ffefa484188e4, 0x7f3c301d4a5da15b, 0x2e230d2aacb9f8a1, 0x7dcb53d3915eb889, 0xe0d656b063ff89c4, 0x30e96b2fc0b3f075, 0x85d49be016bb405a, 0x5daeed855b9a0eea, 0x549a1cf6b1c02a5a, 0x13a5a2db2080c558
+, 0xc7a333533ac34441, 0x5324896c52bf24cc, 0x4720884c5f1a7b02, 0x657aed03091d7a4e, 0x61720e06ea69f47f, 0x709714b691aaa3a1, 0xaa9abef895f88b40, 0x05c00e8d27695fb8, 0xf8081a97352cabaf, 0x30613f87dbe795d0, 0xb3fb0569c618318a, 0x59e592eb0b2d2caa
+, 0xe7125263bf03bf9f, 0x3616d1df99b57444, 0xdb69c83975f8bb7a, 0x1134b2abbbb9f70a, 0x49b1c3b500c9e8a8, 0x15fa73cdea72e216, 0xdffd4ccdc47fbe92, 0x4e13cd0477af22f7, 0x97e9ad6acae72cb7, 0x24b337364587117c, 0x2bef470a5c5bf499, 0x79d5e1f8dd99ee8f
+, 0x0175c45915c2dd3b, 0x1d10ee9913a81474, 0x37c24588181bbc16, 0x69ef511614fe2b63, 0xf5d5e0a5650b2249, 0x2a2925244ab41215, 0x51c9314c69d92ae9, 0x61dabc3b1035ef74, 0xdd68ad2b8e4a5bfa, 0x1de5a443239a3aa3, 0xc4046be5ddcf8883, 0x3ce66492d7ddf818
+, 0xe675ad156c1e4618, 0x53ad576f26f4efbe, 0x9c428d7ea1155bf1, 0x296ae5bc4e0d87b1, 0xb65f5b2e44e758e5, 0x433079930ae82430, 0x59ce9302a6244cad, 0x48a3d3432174eb04, 0xb9f62341c8112c66, 0x7535145effd1ce4a, 0xe67ca2e600c3ed86, 0x3a66ae35a2528f3a
+, 0x85eda03acc47919f, 0x198d3acc868b9a52, 0x9f8439a3fd8c48b3, 0x1f4704a867131fbc, 0x3575f439d912c1c0, 0x2ee520859eed5e6f, 0xc76e4153076f76fc, 0x518c9437cee440f7, 0xaec398a7ad4094f3, 0x74393f90793804e2, 0x0f35d4c614710314, 0x459f09998a92e4ab
+, 0xd4394f04672c537c, 0x3ea7a2b1abe6c2e3, 0x06cd7b33c69fff57, 0x194acaa0a915a92e, 0xd0dc8cbd8693da12, 0x73d058fb5da12f6a, 0x76780509db56d631, 0x56ebe862476afa37, 0x169b2e2136732589, 0x5fd5face5c1ec9f0, 0x43376c13a252f64e, 0x42c3ebc8fdf63efb
+, 0x406c4944ab2b85f6, 0x7d50ac5dc7d22ed6, 0x00f3488697e8b6a3, 0x2b6efe572af9b8a4, 0x2df141c3ca589597, 0x037ced85bfb19094, 0xe0c2211871a2f303, 0x5b1bedaa5ea50c2f, 0x031163247dd7f02e, 0x7ae44de93bb90038, 0x6872964a48ac808a, 0x1167c762413305b3
+, 0x77623c5e6855d991, 0x4868cc16a20736b1, 0xccf9bc5721e242af, 0x65e67b35b94d8a92, 0x4378cbb31f880e72, 0x1dbe2cf753c37670, 0x8657550b458fb292, 0x01bded0ac806152f, 0x6f493771eb7b6b14, 0x345ca8935be0a231, 0x9dbf272aad2bbc13, 0x6e210e8e381aeb6e
+, 0x45900400a69bb88d, 0x41e67e120c262125, 0xdfc20ab3dc438bb5, 0x6b3f73f4b1024ee4, 0xd9203af9c13f7e17, 0x68a017778d783658, 0xefe9669b3a3c5c57, 0x5ae80538b093ae7d, 0xf5bf198f6cada5ee, 0x33774ca5f70a9862, 0xee39f982beb78a4a, 0x48edc86673e32477
+, 0x5997dd7fe46e4621, 0x5066d6dd07d58eed, 0xe259aa27239cfd97, 0x4419fd62c5ea9940, 0x0399d5748533767c, 0x23c50bffced29cee, 0x7db583f156aa9f6b, 0x009faf0cd620e7d0, 0x89bdeb45b042a14f, 0x30a4b37407863d18, 0x374a2cc56abe9c43, 0x0231b0490ac4fa3f
+, 0x58aaf19be73b331f, 0x23750c0374ccea6a, 0x85a54383e3c2b774, 0x78ba9c5e7acc11e5, 0x0594327dd69066a7, 0x2964852a3febdfd8, 0x61eb5df5699c49c9, 0x41b9cc9fa18c4324, 0xde723e5832ea64a4, 0x7998f5f1700711b3, 0xf4a72f78569bee16, 0x08149f70b67747bd
+, 0x9388de3e50b54826, 0x4b4acc1e527e325e, 0xab6070ecc328dd77, 0x3b244fe6673cd347, 0x1392eb73da10d76c, 0x77ea8bafa6ea614b, 0x5bba1a149a51d710, 0x58bf2f2ab4ff2149, 0xbeeb7c713187c9bb, 0x7253d8373cb68f96, 0x6b1d1642d8571673, 0x5f78a2e169cfb761
+, 0xb14bc14166183ab7, 0x5d364e79c08044c7, 0xca3f675e96038dbc, 0x40a6107a879a8268, 0xbdb001323c72140f, 0x7c5701975de674b0, 0xbcb4a7f6a0118731, 0x37ba7dd031185453, 0x631c6bace575ae06, 0x638e4a1e9a8a1039, 0x3634a7592343acee, 0x0b5dc4cfcec882e7
+, 0x43995e9432d17565, 0x0cee4306c00433ae, 0xf6bda416299fbb04, 0x1110a63d80314b6e, 0xa05822453cd33892, 0x03942ee39d982562, 0xf69f4f18380681b0, 0x7b8d285a7f4ff979, 0xb45a49738fbde2c8, 0x116a536f028ae7d3, 0x7328b75b9126aee1, 0x45e6e3819891c3ca
+, 0x350367712c6e828f, 0x59b047ae026f04df, 0x761a7dfcbae10a8c, 0x517a19b63bd7e036, 0x458f76797e317cb1, 0x4e00b0c713227d89, 0xe882670404d12211, 0x4c2c5ba4d69d385c, 0xa8464acf7f6d6618, 0x7665b323033a47fc, 0x2e04b9f08febe02d, 0x2ad4dc240cef8e65
+, 0x00d0b1477a8d50b7, 0x4ed41c4514e25567, 0x99c30b92a40ca920, 0x11679e25a6a91fba, 0x608025df367bba56, 0x727dc4cc32e7fe6e, 0x0ac283a691209aa3, 0x419cb853f7370dee, 0x4ffb8b6b379b33d8, 0x0dddce7c88cfd43c, 0xc1f4642121be8ba7, 0x7faf656da96f0a20
+, 0xb1d0cd21b9618156, 0x7e0e04221399a603, 0x3db30e8abf2de6c1, 0x035e54bf25fc6d53, 0x187eaa3689d7348e, 0x7b72719c570cca1e, 0x0ec75ca3e367e8fb, 0x258244e63420d4ef, 0x3002852237efbc0e, 0x55625b33d3007012, 0xcaa5af473058287c, 0x45fabb9561fc8d77
+, 0x87bb9caefa213ad9, 0x4a83ff75f64e4bb8, 0xe60f6ea5b117d7f1, 0x691037b4114b2fda, 0x9eb799d32b171a95, 0x3dd78dc391b5e515, 0x6622839909d84109, 0x2f3029612fe7cf1b, 0x8a36d823750c1501, 0x7a4aad3a00f37804, 0x68d5a419a99510f6, 0x2b4f715a84fb8096
+, 0xcdf21b5e61138c8b, 0x743ecdfe0ee78ae9, 0x26575296a8fb6634, 0x4f1b5d702c7c8444, 0xdc50a83008463b17, 0x421a39968d4ff7d9, 0x3c69fef2ea423f85, 0x1e097c405dc426f2, 0xa4704202e468aaa8, 0x49b6180bd5d10d63, 0x833cfe866a76eb63, 0x034c12a4a3fea75c
+, 0x40d5210802e61b4d, 0x74adf16bcb3ac6b2, 0x7b340241bb6ad809, 0x65fbb20a581ab145, 0x62b617224957655d, 0x7c9f208b08786157, 0x6e5cf57d1242dc92, 0x401fdda4fc9c50a5, 0x858bc4a6ab5d236a, 0x0c7b493f056c4924, 0x4dc96c6a3563e0d6, 0x27b1ccc1df6ea1c0
+, 0x7614cc0a395b54c5, 0x298d3ce56b4e864b, 0x734f9cc92e8e7600, 0x3e2654baf8a51984, 0x2e1194b2f3de4f23, 0x48b5e1d1d52ae0f7, 0xf1c2cd16e61c5245, 0x17e20cd798b73c98, 0x02286df199306a3e, 0x45da7ca0b4ba0de2, 0x0b873c9c70dd78ec, 0x0cee0fd7b6bf6822
+, 0x1900a6ebf7eb34d7, 0x168e6dd5312dc9e6, 0x44a041e6f2cafcf5, 0x62311eccd6cf4b0f, 0xf5e014379b8c4853, 0x73d8496b310406f7, 0x0a09d45fce281e8e, 0x78e940f2346a7877, 0x19ca667a2d48da02, 0x5cb567febd1f5d37, 0x784100ed78e9c79a, 0x382ad480c3c1bdd5
+, 0x56a153a5b25bf4db, 0x74b5ab10ecce8ae0, 0xa8450d916cf44959, 0x15c5c3a47d16e311, 0x150991bfe88f4dc7, 0x64dc7063d77c5392, 0xc2ce4e735555c873, 0x59cc42d01f862f8a, 0x686596e8be765cdc, 0x5e2b24c04afa9a89, 0x798262027368643d, 0x4e6fe8b2d96a62b8
+, 0x4bc47a285401f7fb, 0x701390f0a50f75dd, 0x6a4d58b93080b0eb, 0x345053917c9cca9a, 0xe073b47308b01c58, 0x20779d0fd9d93bb7, 0x3193aaaa13386067, 0x5b75d323945dee53, 0x1a9be2b6847f851b, 0x0c4793c4dfe79e74, 0x08d460a4766c49d6, 0x53bda8b09b9d3eeb
+, 0x4ecd859060fc2d6f, 0x74e511da57b3643e, 0x8e622fe5b5e90632, 0x12f8c2c59e207088, 0xbfc4b85ae668b23c, 0x072f768483aebc58, 0xca6a147f81d04325, 0x252884a823923d4c, 0xb1f295df28d22d7f, 0x7b744bfdad631c51, 0xfb6749e68f49852c, 0x2fbefe9e24feb67d
+, 0x0781dfd0a33aa0df, 0x3aec5f29c7cb5819, 0x054accdbe2819105, 0x7da595c606de0979, 0xfa89eb8f5d4e09f1, 0x38f73959d15b505a, 0xaf814c478e4da742, 0x1207fc8231020a42, 0x2bfbe074279c17c2, 0x464ec2bff5fbcc3f, 0xac185e8b62069c95, 0x5d89bc6b543dc7b7
+, 0x28da1b678056a54e, 0x4f14d2e380c6d349, 0xb843392dd05b3adb, 0x68fa5c72533f6c26, 0xe164844bd27135b0, 0x7140f2fba588aee6, 0x0f1a23007d6a0509, 0x646d4250fa517723, 0x7c2b64f2346f887b, 0x376e80785a2a0cf9, 0x9c7c0da4d2a4424b, 0x27d6c355c3978f78
+, 0xff438df757ad8b64, 0x36c1180a92baa747, 0x0ad7050acfc9a946, 0x6b240ef47aa1e44e, 0x4e63abd39e0217dd, 0x15da1449e3885b89, 0xa13ec3338974dea5, 0x31438efded9332a7, 0xdf08856acb2a3c77, 0x63ef5b3915f5db86, 0x4c8f49f080ba5c65, 0x2db8bab000da84ee
+, 0x3660bc65780832c3, 0x2186aba26ed5bb1d, 0xb993d3d6e90298d0, 0x0eded72e4f0a18b7, 0x71b09fe720879671, 0x58a03f02ddd87c92, 0x02bf9386eda6260f, 0x3662c70ff2939ce9, 0x3db4372a318ea56a, 0x28758e69d7a80733, 0x4f85b647b230ef39, 0x01c8abdd69d68c82
+, 0x2314868b859766d7, 0x492210d3d23723b7, 0xd6a66aed8737cbdd, 0x707f46ac911198eb, 0xfbd17c04ebb8417a, 0x01071a446bd364c7, 0x65454538bf6294e8, 0x437a658d39f520e7, 0xc0146926c709d0b3, 0x43b2afc81227bcb4, 0xb75af7a760097313, 0x6c78b0f5625ecdbb
+, 0x0cb3d48b9517b3b9, 0x23f2e44a7024fc54, 0xf9811401659011fc, 0x6c74ab7f8e7f306c, 0x37158e229e201180, 0x4c8b0431706b05ae, 0xab4444cde4703d3d, 0x35f0b0598bd76b9c, 0xae4ccefb0cfda7b2, 0x20022ea599fd78e9, 0xb0e6922d7d5ff04a, 0x1f8489a6baf14790
+, 0x9917b838d10a9eec, 0x2f2184a166633f80, 0x3eed33e6663f3987, 0x763748cbebf58abe, 0x177e5512aaeaec9c, 0x7b7161332e71a1cb, 0xbf9152a751355de1, 0x264c5c14a79b56cb, 0xd5df7adbd4c4e77f, 0x1c658c3d15155415, 0x8408eacb545d09cc, 0x529145afd9afcde9
+, 0xb0c58723d0cc0b42, 0x0a034794509f14c5, 0x9720ebabf7fb1078, 0x44d6a3df142769bb, 0x86f0ea8e89902ae2, 0x4a28f120e7907642, 0x7767347cfdd89c8a, 0x3807f0abdecc49c1, 0x13bd4a5d28e43270, 0x18e0008682fa790a, 0x6b0507021147b119, 0x498067dd72369b35
+, 0x7b22854d29618b35, 0x2ab9e7e899c9a308, 0x19bf5c565c9b1d6a, 0x73069e660ad166f9, 0x9347c84d4be44ed4, 0x5ab149a9d006e3a2, 0x13b0284acde8eec7, 0x78729a7b0d3d3aca, 0xee8e33a71b31bde2, 0x5d543f842e023552, 0xd857d2f56da12399, 0x2129b696f5097614
+, 0x71218328cfd91f15, 0x43f5fad4b95b2bce, 0x1fbd5930def7bbe4, 0x00b5d541160e43c8, 0xe33a55018490c6d5, 0x7039e9f266420c05, 0x0d9dbf0a97a87bd4, 0x185533fd8d3f9234, 0x91e7d29639090892, 0x29914c2e8cf9b8d4, 0x2742575aed9a9b2d, 0x05ea1717c1382716
+, 0x8a70e819a57552a6, 0x4771a5c7ffca1df3, 0xb6e10db912588dd4, 0x620c8f698964fe46, 0x115cd1d92be53fd4, 0x6fd9dafb80ac21fa, 0xfc2dda007aa11ee4, 0x729cd16390ae04cd, 0x532579ef729555c0, 0x7a8b5f487656c8d9, 0xffef296b860a97a7, 0x1da8faf19c636704
+, 0x32dbfd485739717d, 0x18f3ae5492b44665, 0x9c0844dbd119712f, 0x7842f37c2c0301c5, 0xb70580b7513e7f69, 0x6913176568a32b2a, 0xbd0c7a8e2ee7ad31, 0x1b9e80ca5e0899c1, 0x4b767adfd7ad9d00, 0x7aeb4c9f0cfa420d, 0x1189ebb7ec2ccc9f, 0x1af358a898741b3b
+, 0x599910d58d347d62, 0x0833414699c59633, 0xf27e510ac1295793, 0x48f8efc58b01c2c1, 0x437491de8d0bac63, 0x464c35c80def0069, 0xac8c12c87394e1cc, 0x05a4db38b07d8f4c, 0x5e855d6d91991e4c, 0x1c13adee4a581df7, 0x40b7421e918233c2, 0x38d3828ed1fb65c7
+, 0x376680b2f9b02494, 0x10410ef0773d3af2, 0x64aff3ff5e627052, 0x71c0f0d0e8bd17b5, 0xe76b1ce4a746a192, 0x4b59e278a3ef894f, 0x57b91084e5b6e1bc, 0x4c33c7a8083eb519, 0x1c99216e82369134, 0x508ea71f9aadf009, 0x5a6de3a077c7c14f, 0x01a87460c85b6b18
+, 0x2841770cf261b51e, 0x0152db3e9de81b7e, 0x8a6156342bf75848, 0x575ca150ec7e992b, 0xe26886ff6131478a, 0x6eddc1f84403aae8, 0x93e34f2f8780f2c4, 0x5f5f42a9b7c195b3, 0xb62f8c2698bad50c, 0x451b5b2293bd26ff, 0x9be64cef0a06d31a, 0x6a85c8ce5bd0b877
+, 0x9e7d1e93ac5500f7, 0x479aca061772805f, 0xcf009eb533f5fc94, 0x21664df5dd34a407, 0xd3490cc149d64356, 0x5e5938d4870bdb65, 0x2b976a8fdbd1d73a, 0x18c79c923f3ad521, 0x2a8beb5ee4b28c39, 0x68fad6d8b66cbb76, 0xdd407103e081d91e, 0x3a6383c93be31ca4
+, 0x78035229b27404aa, 0x4601451478bc50f3, 0x0aa2b89deb1d0657, 0x60565f8f68cfb50e, 0x5510a97e669039d4, 0x1ad77fca7aeb5e19, 0x556bdeb53d039a21, 0x7e165feffcf73440, 0xf8bcedf1c186fd99, 0x5339c58eea707404, 0xa8408c76d1c317a9, 0x7d95a73d2f4d2bea
+, 0x5cc8923b1a1724b9, 0x716d5d64069edd89, 0x79fbca15fa22c89d, 0x3db72327f764a621, 0x41a99660267de618, 0x640bb9da129a9323, 0x7d4e7c0ca0f51d4b, 0x102b6fbeed079da0, 0x418344bf54724595, 0x253228543283ea05, 0x6ca0f0cbdc93779f, 0x546984edd807e93a
+, 0x82224b6406ce22f7, 0x3fe26e1194792886, 0x39dc27fa28229e4f, 0x405f3960d3e4351d, 0x2be08685341e42f7, 0x295927da3fa53f8b, 0x04544fcf26c5537c, 0x524d6c2cd7975eb4, 0x74b3eab940a32d52, 0x100aecd541d61828, 0x6efa42384a6d86c9, 0x5736a24a97847580
+, 0x9bb3afa96db9ee18, 0x70d133766f165f73, 0x9ef50ac9cfe3f077, 0x6e75baa0ff414518, 0x9c05ee2c2b2c4ecf, 0x76318800f82a967e, 0x2554a0967343fee9, 0x249c2066fcc6c865, 0xb9148e8f3fe4f739, 0x286dd9bbf7d86a43, 0x0d2d15d41846dcc8, 0x2cd781b5ad4dfa0e
+, 0xb57eb48f4df078d0, 0x0705e4661c21667f, 0x62bb7e67a676145f, 0x379b3af849d0f5d6, 0x8bf550c8724bdb3e, 0x4f15afb9b32be01d, 0xa7c22168de9d5277, 0x2277d13e536bb176, 0xdf4b34b993ae96d9, 0x7de261997d43bffd, 0xb05295753b10d42e, 0x505ce8c2564bf182
+, 0x70ef3dd256996aff, 0x576441a729fac1ef, 0x35b650efa4a33f24, 0x13f9ee0aabfcc75a, 0x281706bf0ec11fe8, 0x7e61b04547c9f131, 0xc304270a1a648629, 0x540ef80e5523a2dc, 0x8c263bcbb7b93feb, 0x0de9c8c8607dd3a5, 0x8ff6455c27d45c9f, 0x0ea96ab7a22a7239
+, 0xd233f9438749606f, 0x2b4ffa8e60b3d7bb, 0x7a7c11996a478e81, 0x1613705b522f09ea, 0xaf5cdb142bcc54cf, 0x1065bd6d50b91443, 0x76fcf403781d9bc8, 0x649b441255afc87b, 0xb0e28955fc277d7a, 0x093509f25093549a, 0xdd60695c6ecd7042, 0x28d839594436dd71
+, 0x53b2fdb5d38889a5, 0x468677bf6fc3b896, 0xdd819c7a270bee43, 0x5678b305ab1cbffa, 0x874ae01d6de9557b, 0x3b5c4f8f6470ba2b, 0xef5cc9da2b3379df, 0x79757871a781bb35, 0xce5a568234fb2cd8, 0x45a52b1e4c5b3eba, 0x0310fbe398ebd164, 0x6731c86a7f82c27f
+, 0xf3f34bd0696ec132, 0x2eae16f697995462, 0xd3d517cade2988ea, 0x5c14d465f0fd22e1, 0x5e19711e042ca5dd, 0x23cc11fc8b077da6, 0xf7308c7b260b62cd, 0x0378aa2564769dc5, 0xe713758a77688199, 0x7b65bb0489656a87, 0x40f093da2d49e8fc, 0x4faede4573d9fb68
+, 0xae789e641f78976a, 0x472af5bcb427302c, 0x777338e4b32244f1, 0x615fd491534f662c, 0x2ea16bd668fa1ae0, 0x2b42d45d4f88595d, 0x20791564cc06da76, 0x40a160867a91d199, 0xc68880e4e54c5196, 0x3bc9830b68d4f64c, 0xa1a28e36a65139e5, 0x18852b1b10aac3e3
+, 0x45427295e12d91aa, 0x22dec82ca80932d5, 0x38adad929fa10f55, 0x53dc58df8c604508, 0x1622b792d9fbcab0, 0x6937f19569e0f4aa, 0x41b2429ebff4f7a5, 0x3e1e03ba6a2707b0, 0x2025b5d8de63de6f, 0x31ed33438e8af236, 0x5d4229b466062712, 0x0985d5799ca63878
+, 0x6f006249351471f7, 0x3204eb91cfe9ed6c, 0xe09af1c83c13afa2, 0x6d70ed88d5de535b, 0x2078873d1a2faa1f, 0x5c73bedb8d96f3da, 0x41bbb407a3a1ce1d, 0x7a40ec2fb54eea85, 0xd6d569cb9dd722e3, 0x10acf67805927b6a, 0x27c61d818cc0ea05, 0x57b175c9f59904e2
+, 0x4f7b40bc92b5a60d, 0x51431f647b46b89a, 0xcd84dd55cc2a720e, 0x6b36059700809a1c, 0x78e3e5dd060e9a0f, 0x630c0c1a146c77d4, 0xc9925b0dea8fee2b, 0x4728f0604b16a06d, 0xb4601050635b2318, 0x2484f7281864709b, 0xbe2ed2a2523211db, 0x6425d4ff23dd3a5b
+, 0xf0868c09017aef5e, 0x2733d1e1adc6d5ee, 0xa631db49f17f87e9, 0x36d753ced54d5727, 0x451d17fb6c4af537, 0x1dcc4d611dd55b04, 0x0bb8de0c8d3e549b, 0x2fb2ca1271592c3d, 0xd877914ffbc31ced, 0x190809a196504d10, 0x44bdd65a970277e3, 0x13195c678b4b01fa
+, 0xe69a41a54f84d41f, 0x61c7c870565e4508, 0xeca2d2fc6f0e1c9b, 0x7f065480e257152a, 0xfaaa9f7c3a8873b0, 0x43fcdb8db58a324a, 0x969a79026e9da7a2, 0x4eab135af328b9d9, 0xb38aaafe87f85f7c, 0x69eba4fe1a6b6f32, 0x5607f6c6b4d27cbc, 0x273072bea774f9e7
+, 0x3c1149e3c8d51db0, 0x161f8cd433c28bfa, 0x765a61f218fe70da, 0x442b5d405f2036bb, 0x96f790271c564cc1, 0x3d5dbb33505cc956, 0x621a38b446af395c, 0x2da978b45bb70ce6, 0x755aca711da49388, 0x46f2e33e55e86df8, 0xfc5b454d5cb7be24, 0x67df47d68d8f6d12
+, 0x7a1e224893898aad, 0x0400219c89c2d13e, 0x6c969e4d63d460d9, 0x4df64d5df8b60ad2, 0x1feed05a45ff89ed, 0x290c4b59e684b4ef, 0x97ffbc3df096adb6, 0x4ac6037e76561c96, 0x1bc40299115e51b1, 0x7169e0a1d96aa1be, 0x43f55f8b6bac596c, 0x1cc6a0603081a178
+, 0x8e1d2db69bc925d0, 0x6ffb86eed51d2931, 0x3ad1eb242e0af1b5, 0x338198152fcd6d7c, 0xc1f381496df13943, 0x05d9242fe1c60b02, 0x39617510de7eec81, 0x24d8ba5ac76b12b8, 0x280eb2db9e548483, 0x6c51317b3a8a93f0, 0xb2a9f90939bd1235, 0x2da9de86c39f9aa6
+, 0x7f54917103127b97, 0x7be2be5ad3276169, 0xc969d703d31e9da7, 0x0500df3bbb1f8a4e, 0xea05c77685795917, 0x049575a992d09345, 0xd567f8de2daabe35, 0x383fad35a8e035cb, 0xb9353eb2bbd43d56, 0x52b3953221860c5a, 0xf9e4bcd46dbec03e, 0x4b0db0b4a7b3279c
+, 0x8cc5f6b6e1ff80c0, 0x1bd2ce464b552215, 0xd008eb25b39c4236, 0x3b4ce5bb2f42a9fc, 0xe1f249681d153d9d, 0x3e022cb14bc4c5b9, 0x8a11d021c8ed5a53, 0x560d3fb258bec495, 0xf4405852705a6012, 0x5c8bccd2b1b3efd3, 0xd93c0f63ba7ce0c3, 0x337798cb3e93dbba
+, 0x7a9f68cf800c8e88, 0x579afe689f3ebcce, 0x7dd41d6cdfbdb4a9, 0x3802410c4e1b274e, 0x64241d770cf0db02, 0x2f7c8133c74bde23, 0xf3c3fd835ed1952e, 0x741b1d88a3cee37b, 0x74e1ae644683c68f, 0x0c80dd9e0f7a91e1, 0x3984d741f3e47c24, 0x4b3eb97b6a39d252
+, 0x32e9b9410da9a195, 0x11d09fdc04ec3b41, 0xf92fd5e53cddea30, 0x296e095589e0ce05, 0x4e3200c3a283b696, 0x7e33fbba44ecb32c, 0xed3c039790ad0033, 0x5c8ebb260b5ec084, 0xa667455bb79d2e9d, 0x12fbec9d4f5bb155, 0x3aa5f6bb4d0d8d49, 0x0ca652ed7065d80b
+, 0xb7938753d51c6f83, 0x41644ac1a602f9f2, 0x84223d4d63c38f7d, 0x71057b4b8b931282, 0xd39fa015165f47b5, 0x7536c8a19c33c201, 0xbe713ca4166c2dad, 0x456c98c2b4198511, 0x4793f25e1cb44658, 0x1d002f1cfe1a1ba7, 0x9f9ed6e1e1a27957, 0x095dece028426bdb
+, 0xe57d3412fc1001d6, 0x481c63a0d9b25e99, 0xc756b6ba0dc02aa5, 0x24af047d79ed4683, 0xe37ac10133b68275, 0x418b45e570802012, 0x87578def0c3900ce, 0x7c5661923b8c9740, 0x5f4ab0a6fdda7366, 0x0ac6100825e4eb3c, 0x308528e42c9e4d32, 0x436e5979933ddde8
+, 0x0cd6ebe123352222, 0x63d1768a46f33dc7, 0x96cc55dff38c9273, 0x474438da7140411d, 0xa184b89b81cf6402, 0x6bf820a3aa675050, 0x3bd4720417391f0e, 0x3f2b8f859a8e0cba, 0xed952561b125da29, 0x07eb1ac74165097d, 0xc3f70d0c7db0a9fd, 0x5ab896a489294a6c
+, 0xd4b608975c20018d, 0x6243b039f25d0456, 0xf766e98fc24c7464, 0x20035c09d2291e42, 0xcc0e5b5eeb462524, 0x24bcba5505f90657, 0x43a98d98e4fa9bf6, 0x3b621ec4188264d4, 0x633472fe235c812c, 0x31a20844a3316d23, 0x47b80db7d7f5d0bd, 0x22d482f5663780f9
+, 0x4df227dc52142020, 0x25076d0624bf137e, 0xcb4a6ee30a657645, 0x0ce469dbb5ada433, 0xfdb06251f65b9c5b, 0x44f82274a8e8f538, 0x98fa4c81cdec4b97, 0x0ccd61d1abb61d0d, 0xb9dc371344c5ab54, 0x35dcd9ccf8e5f919, 0x67fc81f369ba5722, 0x121b5aa1af6024da
+, 0xe0b1b16b0fb1f1fa, 0x4dc688d6d3b1805b, 0x05c187cf10e40104, 0x71af39c743daacd9, 0xe691e97f82acf4b3, 0x0c46305b9243bf5b, 0xb063af137fde616b, 0x4e26e72a1de067f6, 0x61fe66d01a221004, 0x172fe9240cea50b1, 0x4ff50d37b2effefc, 0x06be02ab0b89aa5d
+, 0xdd4aab96717af213, 0x32322555b58a7ffc, 0x7812aa965889326d, 0x1bd608f60d6457a4, 0x2c7b6b44e999e141, 0x113a86a87856a8a8, 0xd95469fc33814855, 0x4a18dc36f6bfd586, 0x0706b60bdb854fd3, 0x4dc356685650fa90, 0x24ef7cfce41f8dcc, 0x19049c3e632deae8
+, 0x5c9a4e28b7138a89, 0x0f0b7dbc1e5087e2, 0xebf49cdc66a362d2, 0x19e4b815e6576c85, 0x1896051ee3b6063d, 0x09ecc741852a68e4, 0x4009034def986795, 0x36b440ff39b4b5e8, 0x9bc2647ee28af1cb, 0x62613c9dd152b3a8, 0xc2018ae5dfae5f2d, 0x29ce5ef30009c855
+, 0x0b653558b21d2b1c, 0x45e2c505d1f74936, 0x48304373240553d3, 0x0528569885a82310, 0xa90d402e33924181, 0x5e610edc23cb9555, 0x28890ae7e007d28a, 0x7e5132b6b1ebae37, 0x0d5252eb7c94cb1b, 0x308ddaea1fdbb672, 0x99fac0b431730534, 0x77d54ed63b9325b9
+, 0x4d647bcb76c6ec3f, 0x0e968b22ec2cad86, 0x4b22b5ec30b08a35, 0x3b31df3b52326b5c, 0xbe84f638dac3105d, 0x7db085f133ecbed3, 0x7a8b694596f2cf2a, 0x67b2e6c15d16e0aa, 0x4808b20bf173011d, 0x25d5fbbfbe66f864, 0xf67f3f3cd9743987, 0x654250e89617ddf3
+, 0xf5a1a7e0ba0a88c0, 0x3616c781799ab50a, 0x2669c27a2d256902, 0x3a8ec380e12fd7dd, 0xa25361f44a418e30, 0x2942f3001d233645, 0x60f1d3b7535a4133, 0x14deaaa12e5c7bdf, 0x0089fbece10c8d6f, 0x4bf7c313757c803d, 0x65aa30bfbb70567d, 0x4fed47af409a3fb3
+, 0x07557dd875d3daf5, 0x36c49c2380e3c9bb, 0xa21f643d329ae02f, 0x6cf6f7474338bcb0, 0xb5df78136a0f3012, 0x031fb2df2e00e9d4, 0x4d86fccbe75e79cd, 0x23f890e082d03b7d, 0x5716a1ffb50a8262, 0x0199b50aa6cf3302, 0x6a1be351f86090d5, 0x36095efc13349364
+, 0xffe752be8ce46920, 0x65047a340b652f65, 0x320ee55fd03156a6, 0x5af6aa45278409f6, 0xa6caf283b1cf3850, 0x4e3a988f61072f96, 0x750f67926b18f680, 0x09fc3f2927d21a4a, 0x914893c2f2ce1169, 0x4d15b367121b3e75, 0x6cb12559723774f2, 0x3ee5b8c2a70e054a
+, 0x7dd9b3518d84d2d7, 0x147d5a5a53f57a58, 0xe1bd0904ad842a05, 0x3a0f3b029c9a5845, 0x7153c03261410074, 0x4e203d6737058c17, 0xebecf5cb79f28af9, 0x574b889870c279f4, 0x326317b005f444a4, 0x7480da44b34f4b1e, 0x7c5f21cdc46275b2, 0x210494b9ee24e4e0
+, 0x3cbf6ca1f4aa4ead, 0x6bf3872ccbfed940, 0x19e8a84673a566ca, 0x61a80e16990401a2, 0xea2e029e7f9b3824, 0x5762298465f0ebd3, 0xf60e36d4969f9af0, 0x00b826180531c799, 0x17120ec95cf3c61d, 0x47196cd6de85c7d0, 0xb0d47cff46a5cba3, 0x29271400d7ede26b
+, 0x835908353516b894, 0x4bc57f8c1eedec8e, 0x2ec5deede5c0db5f, 0x7b9fc48ac4a689fb, 0xf82ce6de88fc10e5, 0x6c5d84a70e03a3d6, 0x88a211fc4ea531f9, 0x7d5583e5918aa03e, 0xbdf2d70766fb8f39, 0x5926497e734ab18a, 0xd6a9872b800cacb4, 0x757c1cd521fd22d6
+, 0x22d50b0c13ec4bc0, 0x288a77d34a15e99a, 0x95c8e78fced3d4eb, 0x45ece109c15be169, 0x878ef262d0132128, 0x48110e9fd98939d6, 0xe3fc5425d2e7741e, 0x050ca6e71f599c65, 0xe02f97605d9fe375, 0x2af48b9bfee410e4, 0xfd34a1c107229a54, 0x43dc6f0cdcbd41fe
+, 0x15b4eb7d65cc562b, 0x369a7b0dd3e91248, 0x2b087611edd32810, 0x116b234ddce09d7f, 0xcdb03cae8e90d2b0, 0x4017d51587566038, 0x081793739242b600, 0x5086e8e633cd52a1, 0xf5ddaee155cb8087, 0x773311b60d59a7e9, 0x36e5aa0acadf2068, 0x7126a4281b192882
+, 0x54a10df54f7ecef8, 0x3cd7d2fbb6e33f67, 0xac31eb6c3e740c25, 0x517db54840feb2de, 0xf17cb269b3ce27a2, 0x04a8fecd1dcc99e7, 0xfc887c1f2f85a2da, 0x280da7425bb55b01, 0xa1af72f5256a5a53, 0x71da839fc459f465, 0xc203fe7ba6587f71, 0x08a4201f77a4f335
+, 0x6cb9ea5683014d96, 0x5da17076b6b51ae2, 0xb55ac168c3e3997f, 0x41b9a32373d78f7a, 0x96f58033b8600a50, 0x6ebfba3ec9d956cc, 0x0ff8883707d66d0c, 0x2f562b035445226f, 0x2388fc015bd368c7, 0x2b7d802ce27f627e, 0x301f0369c24083a6, 0x77e139f6da8d5aaa
+, 0x9f78574697fce43c, 0x02726c94565421b6, 0x1ad6007338e26585, 0x6134cc5eb35c02ff, 0x77ae739c9cdcd1e1, 0x04e96543233c7a13, 0x97d3926dcded2e10, 0x6bcdff7e14cebb73, 0x9c46ae2b32489774, 0x04a97b9a0473af8d, 0xb0350bd910d9784e, 0x448212d3e2164ad7
+, 0xf3464e0351f5e995, 0x68ab4d24b3ade8d6, 0x86854d534002af20, 0x613f7ffe5de92aeb, 0xb385b4f4608a370a, 0x220dccecbc6f2688, 0xc31ec5384abd3680, 0x25a82841a2000fd8, 0xd19e422504694236, 0x0bc1124d541781f5, 0x0808651edcd99176, 0x41b81f223d429c76
+, 0x1a6dcb2662cc80c6, 0x0b101fb0ef0d1f74, 0x6f02aed8f8327119, 0x5b4c5176ccc4a340, 0x8fcefd200d6ee8ed, 0x0548127287f44749, 0xe1efeca1fadd1341, 0x0e74bc189dc9016c, 0xe90470353f46cb12, 0x69513d3455bc890c, 0x9503686f1f2497d1, 0x280a0bb7733f1086
+, 0x14e5f99930a91dea, 0x7840ad84b03c3878, 0x46e32c654fdbceb1, 0x7e88d2822bb2cecf, 0x4d78a8aed7f8661d, 0x70eb17416ef40180, 0x97b6f1733c474a10, 0x3d0d27fc4c7084ef, 0x730f60f6a1ee0d71, 0x7bf6e3885d3d9302, 0xa1e8af33742f1611, 0x73b798ec129822ed
+, 0x0f669bb094642a70, 0x142927de789fc4a4, 0x0db18e01fa98cbd7, 0x6ae4d37674be1451, 0x7175e98f178b4b74, 0x40534e319bc52c6c, 0xb7211d252c4db879, 0x1a7651f8f3ed1aae, 0x9c9a43932d50cc97, 0x630b232b7201c359, 0x327d77575f5b3839, 0x5f0e19e78431864a
+, 0xbfbb00b6530a3bb6, 0x19ba9d60d97f7857, 0x759779de744bd764, 0x5facbe63177791e1, 0xc74ea511c56a3b61, 0x1d8909e84083c31d, 0xcd20094b507af492, 0x2ef1b9c07c92ab37, 0x8430ed9ef8494fc9, 0x3f9170e6df5b1fa1, 0x1fb8dbc837175d73, 0x65b961b58008d022
+, 0x7e1afb6816864b6f, 0x54c4b92c534871e9, 0xc0a1dcd60d61ef84, 0x4390f0e992c41298, 0x1e54e2c8b7c27348, 0x7a987e01a2ec308c, 0xee42fbd90c4a89fc, 0x1ed8c77f8d7c609d, 0x569dedaca99a3346, 0x0eb471e609fef4ed, 0xc915522a3b9fd03c, 0x726453b246746bfb
+, 0x4ed3cae53dc5fa4b, 0x1bf1e4b34b9feef6, 0x0850df9f0401fac3, 0x0a58d33cb2422e2f, 0x3d197f9603ecfc29, 0x45e46edba1cc432e, 0x96c0c93310d9bcaf, 0x18de3a458be2c33f, 0xc9e65e5bcc12a49a, 0x71a5345f0239b187, 0x53b3b2f01c5710b3, 0x438350f57ce2ec4a
+, 0xdbbd368a760391db, 0x4033638dfec29fe2, 0x297ad75ed73117fd, 0x269c08d54b106e8c, 0xa4e3e4fd238b4218, 0x1f48a1cb09208aaa, 0x9575153115cf5fa7, 0x59feeff0876fb74a, 0xfdedb4af6f368710, 0x79be1fe79fa674d4, 0x689d6bbb4c707c39, 0x394a451499057bb1
+, 0x5887d4fb21fc43b3, 0x37628dfc4b5c23bf, 0xc66b76944b34bd13, 0x6e97f0a8a45bcb36, 0x3ac6b10139edbbdd, 0x313f4846b6745833, 0xf8758d9777cd9037, 0x02fdc98f02692537, 0x9e79f381fff833a5, 0x25ac5d68c49b105c, 0x1e9f48a076d8c9ee, 0x788c85c9fe9543b3
+, 0x776ea51db3b3b778, 0x0007c44055b64db2, 0x3c392c2a82fddd25, 0x65000203be8ee976, 0xea119666ab7c50ab, 0x528b2700e8f82d39, 0xc4aaf797118b8282, 0x55e5a7d5382e0d3a, 0x15a80b22e89f1039, 0x199f68594b1247a0, 0x8d5630750d622435, 0x2687f48cc6def5b2
+, 0xa16b0c0259eafaee, 0x7aeb10834e93595a, 0xe31bcf34ce679d9f, 0x4e2c19829eee3c87, 0xa46869cb8ca35c9d, 0x3cd35313c08504eb, 0xa088eca66e98389c, 0x44c562f0f7262740, 0xd3eb8a28f447523a, 0x43a0e059bfe37576, 0x0312c5d6d0f2e0ad, 0x5f30aaf0d1614c61
+, 0x6f09a7a6e182b0aa, 0x575db3d21a82296b, 0x6599bb5eee7925e6, 0x093f89458dcc2fe3, 0x70c4af785151fc84, 0x1230c0c519de5480, 0x0e66f8f93075a4f6, 0x5de4a122633a5c6d, 0xdb99cf83f9ece1b6, 0x1c3acd4a13ded617, 0x4dfe69e68f59c447, 0x482ba1f7715a3c16
+, 0xefeed2a7c81ea8fd, 0x4e089eeb713a572f, 0x78bc74acfbdf322b, 0x4b4951ce8eb86fbf, 0x0eafb6b46ac6714d, 0x72913ed109f7d404, 0xb498bf6fcde9e3a2, 0x3c08a283ef5ded62, 0x9af09f593a48b346, 0x7ed52441d00d4980, 0xa78e843ee5df44ac, 0x25db12d420a86151
+, 0xec840e7e89d049e0, 0x5a34cbe928bf96cc, 0xd875dc5525da882c, 0x2af4442fc256827d, 0x089fb428c2ef5a5d, 0x0b573ace080a3d9c, 0x6f57282554c240da, 0x425ceda6707b6bc9, 0x94b5a8c3dde824fb, 0x264f6f6a445b5da9, 0xadf292191c5c1eb7, 0x5e302e82fa4e5533
+, 0xf51712fc44237f35, 0x2b0af62c42e56e66, 0x10392cb4d9c71b75, 0x4d7e08fe8457a95b, 0x210b9eceb04534bf, 0x73329d1c7d88e1e5, 0x667a43fdb4ba79e9, 0x3435ec04276ede87, 0x38b8540a1a78b098, 0x4f6c266e6793bb78, 0x447ea35172754041, 0x109d7b742d8c3dac
+, 0xe3ccab45d2a4f6f7, 0x59040bb73f3bbd2a, 0x730b39d65645bab5, 0x5c61aed2f83382aa, 0xa992143de3cf83e1, 0x13455cb889b700f9, 0x54648228b310e2f7, 0x5b837752ee0f733a, 0x3923a6c0e5ea0dd9, 0x5ebebd01fc9ca9a2, 0xa34c205b8fd94258, 0x7d1a10029a0b6cd5
+, 0x6c83c02241a46527, 0x4127c85d6be1fc62, 0x26f86ff5ca7240b6, 0x2167391e7dd95cd9, 0x79227506ac78caef, 0x1a2cf919b8832a0f, 0x07745266405cf574, 0x38095a07f5713ae1, 0xe5eeab985ca3e7e7, 0x6a5dd9eeb734d639, 0x991027ebe44a4822, 0x311085fb4de9c1f0
+, 0x33f361e21066c3b5, 0x550091d2dfc8688f, 0x376345c5532bac13, 0x0aa0898f990931b5, 0xea2f3346e5d3226e, 0x208790ab78776afc, 0xac7c2ae63433850c, 0x3c5c373ada10ef52, 0x96c1b4003f4cde6a, 0x4546a9c475c09781, 0x6c961fd3e8536294, 0x43f36e63fc0d5066
+, 0x296601d8c42167f4, 0x241c1fc38565471b, 0xdb00a27e11ce9617, 0x60381181b7e7e4ee, 0xc1076b7635ac4d52, 0x0166010ffb8dda38, 0x5238f69becc43e0b, 0x63303a2015708b17, 0xe8badb2e5bb22591, 0x3a10a4e218b6131d, 0x236ab01aabf1a7b3, 0x1ce8a51a68a4126f
+, 0x59e775e2a2a87928, 0x770b48eb4b738301, 0x0b43c2be176bf79b, 0x1957850fb6424660, 0x44455ee1ecb0ab2a, 0x620ceaa116eef4f0, 0x0198f62cb6183f6b, 0x3274f78eaf2d55db, 0xd2ba4e460cf7ed5f, 0x19cfc17bc0b66f43, 0xcbae6f45b1942722, 0x5d93e44739147b58
+, 0xd07180b9d28fc597, 0x35372b21b2ea5a46, 0xed2673477f083464, 0x7a9ebeeecc57e6c2, 0xb51d991a81a6b314, 0x35e7d90f4ed6de58, 0x45f21e209510dd05, 0x446ffd2715c8d380, 0xe69b5c7a9b6d3e76, 0x1379e79fb96912e6, 0xc161c848bd508738, 0x22264a049d8cfff6
+, 0x32321a68ff7ef7b3, 0x57b0e50cc585b333, 0x1c08c65ba9d764e7, 0x5534c793f92f00f5, 0x7a1ced97eafe6fe4, 0x6b8933739202599c, 0x618c5f8fcadd3ff2, 0x2a8719b3e6548653, 0x346a9ec5c4200f0c, 0x7a36b8d00d0eda58, 0x844b22b75021accd, 0x769737059fc5e465
+, 0xdb1ba69b5019f266, 0x1777242305db9ac1, 0x491d11ad264b6ff3, 0x136198dfc57a3053, 0x4a6cc64741eb7176, 0x14e811c97fc97650, 0x6b64667f71be386d, 0x3286fcadf019eb5e, 0x3f2591f4498e10a0, 0x674fa7c32df7867b, 0xbae8ec7ee100dcf2, 0x03b2c0a20a6372a4
+, 0x4c8d76b471e24474, 0x421fb6a7b8a3216b, 0xc672bdb2fe8f514d, 0x202af653d9aff3f5, 0x05e5f80f9626953e, 0x7b721fa3ccd42ffc, 0x99d8e481c0f70479, 0x054c31746d23362b, 0xfbef2e20430e8025, 0x60e1e3f02e7720c2, 0x161701874eb347e3, 0x363924e90cbb77a6
+, 0x180f5ee1863a1a6a, 0x2f79c0046ff79fe2, 0x44679866e35447f0, 0x1c64c6dd73e0d636, 0x1d8175566341469d, 0x5ba634965b8b9e87, 0x8f48744f976952a5, 0x744f28d23db94c8a, 0xd15e84b1f232da34, 0x556f3d7aa38bee8c, 0x14693c56e866ef89, 0x1564fb9a0f81eb03
+, 0xe97eed56fa2b483f, 0x6d3f7e01aebd1957, 0xae8f128aca3b3e45, 0x3d41e85ba2afd3a9, 0xe4fe485e4b6d8328, 0x65c49b4c3e98098e, 0xe96a00e054d6e91a, 0x394a2122738cd006, 0x715cca3dffd90785, 0x7bc3dcde15890965, 0x6dcdc47a33a148ac, 0x435db9d6dbe1bd55
+, 0xd74d4d6e0fd89c27, 0x25e727f6a5380553, 0xbe54127ba6c5189a, 0x65c87d3c3e61939c, 0xc34a6d122a809e2e, 0x7de6b787f097eafa, 0xb8f8b6e701758661, 0x10705fbf97042046, 0x1591614e6da2d44f, 0x7c74f26ec6eb070f, 0x9ad98c1a50249c60, 0x6e1bbd44d64b2302
+, 0x937cee76047790f9, 0x5b4ccbc70beaf690, 0x332e79ae75ae0dae, 0x2e6394161d093556, 0x4b378bf68f6849f0, 0x6c419fa0cebba72d, 0x8bb431e1e273f2a4, 0x357cec80bbe024fd, 0x83a6e913962f11a9, 0x7808df02e2523718, 0xb6690b5dabc49e13, 0x6cef23259375972a
+, 0xd18ac767b5e551fc, 0x5a0ba1dddb15bd36, 0x6f7923de219e3e1f, 0x3ec23588db9b5cfe, 0xa4fc23d42c83bbe0, 0x21581a00768658cd, 0xa295b6e57110218e, 0x3e7bbab1d15f477f, 0x2266c03d3f0d0635, 0x4174f08a95be03b5, 0xaa1a674abb8cbeb8, 0x6bdf6ba553ae3390
+, 0x8a31f824638545e2, 0x2a9e37a0f0eede53, 0x148a53d8cba69f65, 0x64c587e816d96316, 0x777a028a47e97e93, 0x13728e46befb2e0e, 0x13138b44862fa665, 0x0fca8c38a87775f6, 0xcc44bd580dd067fa, 0x40f2f7642e22d02e, 0xab3ba6db80c2f728, 0x5068aa2e2d25b7f9
+, 0x5a8a842c0a2923ff, 0x67c39e8a1006c196, 0x8f5cb9ff55460a84, 0x2e735c20a419a518, 0x0c6ee3fcbfdc2da4, 0x5bf6ed60a87b92bd, 0x5e4ce130e8e1608f, 0x0932ceb3e50028e8, 0x793cf8a0538cbfb8, 0x4e89e2c018beb7bd, 0xcaaa79642f5060de, 0x542a38a4d13f0016
+, 0xa1b0fd9aac663e55, 0x5158bf1f7b33c0e4, 0x060e82f65a4119fe, 0x32347069a1529fc4, 0x5c96ef69127480d5, 0x409a902134df6ffe, 0xdbe8c392eb6c7013, 0x73f2c48b0e3b4a79, 0xddf5060b937e2dff, 0x1534f901278611d9, 0xf47fe29ae4fd49a7, 0x7a2c0bfe75539f29
+, 0x61d431e05f0d566b, 0x15e09da672af5074, 0x1539c22a644f67f2, 0x73015e1fcb3527b5, 0xffbac602bb1bfaca, 0x2948e0afb1ccb93b, 0x263b4b66c845c42d, 0x3acae7e91a8d567b, 0x4df341959275821d, 0x356cf25587fdddb7, 0xd24b5954cbaea410, 0x53ff5780642074f7
+, 0x1d8ddc6079a4194c, 0x4f69001c7246afbb, 0xd708a1dbe8c3a5b3, 0x2cabca2303211f51, 0x936c0d257add0328, 0x6352529f6e3a1803, 0x255a12166381c11b, 0x4224d44035d2f01e, 0x48845a605aac6c4f, 0x1e5d2e74f0307647, 0x05f156c47718fd18, 0x727d025f3113b268
+, 0x7011424b3ec3a1bd, 0x4707d733b00d234c, 0x4fdfa8a733e3398c, 0x179dd91b21fb523b, 0xbdb1488db70fd65e, 0x7403f64429fa7468, 0x55d40880bff509f6, 0x0546235d023df28a, 0x2d21c328ba090065, 0x1e63ce495fe9e537, 0x99a0264790e11bde, 0x2fbbf8479be81646
+, 0x92644b3b29ef019f, 0x56a2dc98c4724541, 0x072c3ed9220495f6, 0x3a3d787a23483d30, 0x1906f294a9d64e55, 0x1afb83ac0464118e, 0x74a120e39730a0f3, 0x29f8708f474cde98, 0xab0c734a0e3e63fd, 0x5f58deee1d5cd701, 0xdb2338b7e4ab83b7, 0x5a43e5bfcb5c17c5
+, 0x0ede76bbda7ed8bc, 0x0b0de99503467e4a, 0x3b905fc53ed39dc1, 0x3a2ba952a058c608, 0x939d9c6a0d41edcd, 0x49510e3b5ce8a07a, 0x67684a81e6939edc, 0x78201e08e7e3d198, 0xed58b1e24a41fa5e, 0x08a5a8ea35959caf, 0x046b7d7a7a2ee348, 0x77358e54bb1d4623
+, 0xe34284c7f10a1da4, 0x37e36a32f608769d, 0x8780e719b7f8db3a, 0x4fff13c7439175a6, 0xf0fcb8464f7a9692, 0x51ba0cc756acb263, 0xc514331681245796, 0x05ff6469c8c38247, 0xe279b84782ea86e6, 0x60424885a4f6e2d5, 0xb20fefc1a370b551, 0x4182c7edfe04a110
+, 0xddcbe6aa14e8c72e, 0x0cce23e9b994ec6c, 0x866c323cb185ae69, 0x29b7b0fa7ffe208b, 0x7c467d4daed6b792, 0x4680d716306f5bcb, 0xdf6561219c4f3d2b, 0x55daa33ba6910d33, 0x72faeaa5e2c39200, 0x241e78e412980877, 0x440d5d5ffccfea61, 0x7e14a6e93bb5330d
+, 0x16de06233efe91b4, 0x585d53771707a024, 0xba898b098a79e4f2, 0x05f0938b06bbc089, 0x2aaf6299284795d5, 0x175c97271ac48a8d, 0xc08ef97014a68783, 0x5d0669e62eb1969c, 0xd0b6af3a87252335, 0x0ead663edf6c99fe, 0xf42e54fccb9be037, 0x6a4afe5c859078e5
+, 0x5f4d44f2fa080acd, 0x6fecb4d6123c3d94, 0x0be86ebf55dd544f, 0x71814dbe138ecc2a, 0x2344452b32a1fb11, 0x4f396ac781643c58, 0x1a30a076ac350f9f, 0x723a15a8c8f58615, 0x98ab7831a2a0ba9f, 0x7610c85f14282755, 0xabaf5aec2748b1c9, 0x3bd79be762cfa03f
+, 0x61d38bc0dac38b55, 0x33a7354c0eb3ca81, 0x437eb59540611db1, 0x2eda5e7a6110ba3b, 0x829e634ea6697883, 0x0afaff28a758a47d, 0x2bb0dca6029754eb, 0x213ff8cc6ec6f98a, 0x0c2bf33402d672bb, 0x1cf3c36fc45ce547, 0xb84472469c19b024, 0x71f368fc3d8198cc
+, 0x04b859d5fc1fc772, 0x67b72f7d3ca1848b, 0x4c98a5a6749d4335, 0x61f9dd0f30986d31, 0x055216bf228e193f, 0x0b92e8dbed9265bd, 0x94f30aef067d0cd2, 0x7ec165d81a0f64d7, 0xdd9ce941f8f37e7d, 0x21b2a29e01d68e68, 0x9e84e5aa18d45ac7, 0x06b1b01db68cd5e4
+, 0x20cf8616a121e6a1, 0x263d2a834b8ec4c1, 0xc1e64198abc4ee87, 0x068a6ef41ea8d6cf, 0x4976a43483252b01, 0x4d5ff783db212003, 0x8007c2b7b13df29a, 0x1fa132c3b57b512e, 0xc7b2dedac21a7488, 0x71cd322c5044e2fe, 0x2cc12193fed41aff, 0x660904f21ed043d3
+, 0x0eeb13c7c8ba72a6, 0x03559276ec91f89c, 0xb857f8168e17edc4, 0x51d0caaef5ff4469, 0xc1184ad4ffe83a05, 0x49906e2c676bf4e8, 0x79be44af981552d6, 0x2c2841470ce9830b, 0xdab7b08aa996dabe, 0x32e464f9c860aac7, 0x8f6df06984f55f1f, 0x1524e0253c2c22e2
+, 0xcddf6271f69479b9, 0x6ba91d2103a069fa, 0xaaec428919c113d6, 0x3a2fb1a432a60085, 0x3d4be147868a7fc2, 0x7fe3b377049ece67, 0xda01d12ae970e15d, 0x73d777d3dd914b81, 0xd6212d7a41b51282, 0x140768136b18e332, 0x6336451c0effa8db, 0x39d543198553895b
+, 0xe73bb2fc12264176, 0x21cea2f7247567f0, 0xc73b27843025732d, 0x371996d7b32f7e5b, 0xdf0ad827ce3c83b7, 0x0f62c6b8bd9a0fb2, 0x7e31aa2b172f10b9, 0x3a5cb4a264452253, 0x16e4cd15b7914829, 0x18d9047ba43e3472, 0xe59d1b5e0f0c85a1, 0x30d064c1b05aa569
+, 0x58b07513217087f1, 0x344f839d2f690ee2, 0xf45916d007f9e8b5, 0x28a8967f3d4446cd, 0xde5e7731b267b7d2, 0x32aa118a262f77cf, 0xa84046f59e8d37f2, 0x2a54c2e96b24716c, 0xc2e25534187db382, 0x53a1778baf7c8942, 0xc52deb2f82ecd988, 0x5744797e8b934ada
+, 0x2977229872e4f395, 0x63aef38810b43ea2, 0x1c0b30ba2d1a7d4c, 0x6879f7b87858ec79, 0xa79fb334dc8c47b6, 0x26a87201f4ffb854, 0xedc0c8bcee580f02, 0x2a8f996952700058, 0x351eaec6d81c281e, 0x5e52e56d769ba8ba, 0xa3aa77ff2008b9ad, 0x00a8045b05b4ad20
+, 0x331a6d5d55b82b0d, 0x7c249dfd07ef5b7c, 0x9a398b52f16fd1ae, 0x30699dc156fb544f, 0x584f57628572c965, 0x4fc132e0f2c88345, 0x18d101a45843d458, 0x0aac10204f1d4ddf, 0xd7c22c469cfa1e0c, 0x6fb844b0eec559b4, 0x6a9b62bde291a3d2, 0x7252790ea43d6251
+, 0x61a39aa501b09a94, 0x09249e35c45900eb, 0x80fa7a7e95f20710, 0x2e55ddde7f86365e, 0xb985075d1dfb27ca, 0x2cf49824429f53d2, 0x6df55d12965d6ca1, 0x776e6939699e46ee, 0x570d03acc28aef96, 0x383925ace0c9a23e, 0x7e5e5fccb87eed57, 0x5987df426d46067a
+, 0x964c6f3c65fdfbb0, 0x6ed9d47475ea3a8c, 0xfa69b99f273d0915, 0x4fb08a3341eed692, 0xd356c9a54bb77d5b, 0x2fed523fbf707806, 0x2fd35669ecfdd7e9, 0x6b8dd3c402d5d52c, 0x2c90e7e4f52352a2, 0x42fef4b3d5968a5f, 0x29b20694e548a3c4, 0x1ac05cdc874302a0
+, 0xc234e0bb5b3db6f6, 0x4f9c16fe85c1c7dd, 0xa36307f98419e1fb, 0x4748dc68e1e03040, 0xf22dbd5bcce6b7a7, 0x5a65bf1ece7dcb84, 0xa225d50d3585bd30, 0x451f78118a8b88cb, 0x9777824e57f907a4, 0x062192027eccad60, 0x1428f3167a41eb57, 0x52ea739db283e685
+, 0xe6729da927dd155d, 0x584efa7dbfda3e10, 0x29e4628791ebf3cf, 0x09e46f14d795a69e, 0xded87dda61f5b738, 0x3aa09cc41b8a40f2, 0x707824df26cade63, 0x543e2f9357c62f42, 0x68d3084421feefef, 0x6ace0092784cf55f, 0x58224a8ab3a7c0f0, 0x206d85cd4ce2523a
+, 0x93aee56a362b18b6, 0x64794e3a42d4b66b, 0x9a8131c5d39ba736, 0x1a133f7bb892808c, 0x83085a65e8cab40f, 0x173c99a1aec130b4, 0xf3cd221b43e14e98, 0x2a1ce94d0ebfee80, 0xb6a0b5e984b0e8d9, 0x0f0248d818283ef4, 0xf222aab3099e3193, 0x3601de846a9143a6
+, 0x994007f94b32b238, 0x15f3fee72122bdce, 0x4b8dbd72bc2da144, 0x7e2d82fb7bed6a1d, 0xbf74162d69206821, 0x32afcc67f17507be, 0xcaaaa39bd455d461, 0x726180858dec3e86, 0xcdb79de2f28e0a08, 0x3510e6f89a60e299, 0x2511013301f5a3c0, 0x3d2cbe668b85b48d
+, 0xdea5b05adae7f7b6, 0x2614424460c05628, 0xa152cb86074beb51, 0x6ebd3268162f1f81, 0x5efd726e6a3ddc88, 0x7a4531fcfa9b9009, 0xac6df1427096bdbd, 0x4ce4ec86a683371f, 0xc608f6109ffe1b55, 0x72596553610b2414, 0xa8010e59ec27b758, 0x66d65b6a20e360ad
+, 0xc2174e520a6ff57d, 0x431cbd3b344e34ea, 0xe0bcaa4e547461eb, 0x0f1b02e4cc09b49f, 0x1b828bb6704985e7, 0x640bd63224ec9553, 0xb655e84250255658, 0x75f21727f44d160e, 0x55bdee789c9106b4, 0x69ec1ad9c34445c5, 0xdc0b5f0b85d513e6, 0x073c0cffa242d5a3
+, 0xd9e2d1d1cc7d81cc, 0x375914b689c08974, 0xa82f2a327bf85043, 0x79b195810a12ae46, 0xe61ffd2f4fd71873, 0x0e9734ccfa26309e, 0x852b8de87efb2e9f, 0x244a6299dec0cab8, 0x20baa565a32e157d, 0x27aec4c694a36534, 0x7cb0f44da799179c, 0x15b3f8047c619613
+, 0xba19ae549548afb3, 0x436e1592ba6cd89c, 0x735814e5bbc9298c, 0x1118909d40aed45a, 0x7c72d5ab6eaf0155, 0x1d0fb329dfee3b3b, 0xce0cdc9f5f073d0a, 0x465cd7c3d07a524c, 0x0a82455c30497068, 0x02ed12b2ff7ac2e4, 0x2488aa8758e3af99, 0x12b6c15028f2c992
+, 0xcf524bfb93c46d3b, 0x793c9edee2110126, 0x27cdeb957a14f07c, 0x7ae0742011b93da0, 0x180a41b66c4f3427, 0x4eea9fb17f6bf6e6, 0x17c1ff7c6549a596, 0x1ee0ec66d67e48b3, 0xd23e4b0441d52293, 0x0ed48a81b62ae5c7, 0x2979bc3e6fa264fb, 0x10b38cbe862d6705
+, 0x1cfdb92433b0f2f4, 0x34b2ff9ccf80062a, 0xdb6c0f52bc19de55, 0x78e388c6753ed000, 0xea9409388091a7e3, 0x567466c8c8be5b96, 0x9fe9d91c89665830, 0x45282071df546616, 0x7b5975f6967b8f69, 0x3c77bc6f89c9ae25, 0x0100c6e65a4c1eb3, 0x0cc9dc909d546cff
+, 0x4d8aec1e714dee85, 0x5bebc8abab322c1d, 0x753e84086a318de8, 0x7f436e9d4210f43d, 0x142e89d66637c752, 0x435489b5fe689fcf, 0xe874bd92119e8f7c, 0x36b9b71d3e1d7662, 0x30528dd1602006db, 0x55543cedb589d053, 0x103f0d1e2fdf71bd, 0x1fc05eb48bf5c6d7
+, 0xf01eed91a8e1ebe0, 0x38bbeaf8f12b9317, 0x7facbd46444af6d5, 0x2ce3b20a832d2066, 0xa95103d229dcf99a, 0x2a477adbc87dabc8, 0x67814149c1e10f50, 0x28cd364d7e4666eb, 0xc5c77dd2d0ee6845, 0x3a4aeb5443756c8a, 0x6f66c1a0a65de127, 0x41be504e6efb6b7a
+, 0xc93d8a221c4c3da4, 0x34c1a50a2eb16370, 0x483c1b1f7673ce59, 0x7b5631bb21ce6615, 0x6b8bf684cad6e45f, 0x6d69280417de3466, 0x845786e1575eef9e, 0x247c80a347fb193c, 0x2cc82d6e28abe0da, 0x040b581f323ade74, 0x0bc64f77477c73ea, 0x4f6d30f869c14f1f
+, 0x6aa1ef243a41cf67, 0x380fe826f588a5bf, 0xdee9e084f0b0484f, 0x2063b0ab58e78690, 0x77b2d2d719278f6c, 0x0f5c801e3c417cfe, 0x32a26b2bab198097, 0x467d2e63498f5a46, 0xac49ff79da7a2fa3, 0x0677dd8804540ff2, 0xc09b3b90e95c31e8, 0x78d9fb37961c3409
+, 0x7ef43402084eeebe, 0x3ba79dba37cd2fdb, 0x01b5c31f4be41c49, 0x0a12bb2e6e33149b, 0x150f2ea25c02444a, 0x3651b09bbd00b7c0, 0x31def0278e6cf409, 0x67659f93017e20ab, 0x17ba3413b447107f, 0x65ef63d808c2dda5, 0xc9dc4f484d91a723, 0x062cc749fdb08a7e
+, 0x92b4c06aa83dde5b, 0x23c4f00863e62698, 0x8d17ab0dfaf097c4, 0x72a507b73b0f000a, 0xc05559ae2179a47d, 0x36ee0422cc499e69, 0x56044bec818482b7, 0x041cfa1974b0e0b3, 0x82e49584bd88305e, 0x77e9515cfc48b766, 0xe655ba08ea17453d, 0x5d79467143c4665b
+, 0xf353b15869cc6f2d, 0x6997066085b8170e, 0x61b45a2c2263823e, 0x100c0f7122f0c7a1, 0xd2ff250c5de2504a, 0x4063c04e3d11945a, 0x3d0ce2d7f672a9d1, 0x0cab75aacb433d95, 0x77cc0b5674ba1260, 0x7f1755f424d60b0f, 0x99cb65502042ac7c, 0x245b469bcb598cf3
+, 0xf9bbc27d44d46354, 0x7bf755e94ffc1294, 0x02290ebd4f157382, 0x79ff5edea031a2e2, 0x4ae972ea2840e62d, 0x4232189c10b2a65f, 0xab66adeefe437db6, 0x0fbc40531a1239f0, 0x9f51b5134791ec82, 0x37ad600e3ded3e0b, 0xf105938fefa6d7ce, 0x0fb74487b945a175
+, 0x7bef289a987113a7, 0x0aceea18fe043b91, 0xb247ee4494cdfcfe, 0x3d3e3f5cda72f6f7, 0x6bd51116f65335d4, 0x7dc220cfef1c4e87, 0x3cfb0feded39d491, 0x6f00e231b3f45e5a, 0x3a917be46615eeb3, 0x339ade1232f10dc3, 0x76eabafae88936f8, 0x25b255a95418764e
+, 0x3663cf713988a6de, 0x0e0388ead7c704a8, 0x0461ac1853238b23, 0x7f6d63bdbfc1adba, 0xe14008c641ad441c, 0x52073f711712b70c, 0xfc0b07bbce75ed25, 0x456e028de6c08be5, 0x58efc3baa372a89d, 0x560d286b91e38cca, 0x5686e4a5e368a4a9, 0x54d8ead9630a9985
+, 0x2f54808778d72130, 0x0475639aa6cb45f0, 0xc6b7b26950ed4b4f, 0x28d0cea6fa5f05a2, 0x60a0ec747501cfcb, 0x341bc3157614e7e0, 0x53a3839c243e4f44, 0x0ba8430f84175708, 0x79b0161477c99ec1, 0x7de7a56c5896896a, 0x64ac8e12ede093f3, 0x09774a75911369e5
+, 0x8d562ddfaf955802, 0x2d261850da2e7664, 0xe4a25c90715252b1, 0x76a8da29853099b4, 0x016f717abfe54e30, 0x40be61328c536321, 0x2ce9ac7caea56797, 0x72042d91a877cdf9, 0x260b5d126bd0948a, 0x01991e1f273a090a, 0x3f5a0d4493c19087, 0x0641233c4a4238b4
+, 0x16288394653718c6, 0x477410d9571e6563, 0x86c63fe124fb98fc, 0x62fe397035c1bdf4, 0x40b33233a8d507d6, 0x6d16a1a7a6e2c0ad, 0xd5eaa00a67404b1f, 0x38868544adc741b5, 0x6ec2b787ac422215, 0x431a7ff8e958b79b, 0x5b3babcc12421d19, 0x2d65a204d3948acf
+, 0x9dd7d3e1877c0b25, 0x6d0da0d73c757c76, 0x6d32858247a2fa01, 0x4b031333a7ccfa62, 0x18891d176b16befa, 0x08e10baf38814dd6, 0x959c36cd13bcc755, 0x122b0b17b387bc7a, 0xf40cf31c7216dc62, 0x527793c0f7c50660, 0xa99f304d10613f31, 0x64220b0c463601f0
+, 0x854a98380398e4ed, 0x3e136b2ff099bfe3, 0x08567133141188de, 0x59908e446707ed6d, 0x02730be31fe4b152, 0x702fa5c0b7a9c542, 0x7e8862421ad42da1, 0x42503d868848603f, 0x4624f9c597213ad0, 0x7e6b65b759f7f5c6, 0xe61d6230ada56a8b, 0x6069fc3a8a57fcd8
+, 0xc690557f696cbbda, 0x28cdaaecbfb9a048, 0x68f49df4db513d6d, 0x264032ec7c2417ec, 0xa1e290afb492c4b8, 0x63cddc9970c7334e, 0xb706590c3b624b4d, 0x7e8bbeba2bd107fb, 0xeec40e7d1dd829a2, 0x04bf2a6156b598cd, 0xa68acc4de06a3cf5, 0x31239426f3d4fac5
+, 0x680db6896af7bb0a, 0x6af5142dd447e051, 0x07cf3db31ba8b182, 0x42981e0485f548dc, 0xd27c4305797de12a, 0x5ed7e3b8618c93e5, 0xc3ddbb2a50c39992, 0x7cd1098cd94c8349, 0xcd2ee1187ca6e6af, 0x3e9953b5551954a0, 0x322933d716fa2bac, 0x2fe61d3dbd04920d
+, 0xed1724742babe695, 0x2debcf1ed68fe1bb, 0x1a56eb903ea34bd1, 0x70c7eafcaef1d021, 0x6efda3d1c9ac3172, 0x6d9235fb82edc916, 0x0457fbbe3387333e, 0x05cbbfc67c16d9d5, 0xc5aa7cb881a3cd7c, 0x2c349cced8d1450e, 0x5ac238cc28a0161d, 0x69d4975671650998
+, 0x091f3edf2381607a, 0x2e4fb8ccb2f04d49, 0xfb59fe987f5b1eac, 0x616c41a5a3b56412, 0x052c5ed6ddee0810, 0x0e249e2088e9c790, 0xb9938fb896d162cf, 0x7ce0889110becf6d, 0xb1803431ab689c7f, 0x531f39017539e7f9, 0x7c3f5204ca91f1ab, 0x7f6cce5aa5943411
+, 0x3970ff2059caf6cf, 0x2d909ffe15504583, 0x2330d8088d2fc46c, 0x034df72c88ab8daf, 0x52cbe2e3a5273d59, 0x3c61e28489825f61, 0x73ff778071ad7158, 0x5d14afe88425494c, 0x5c71d58c4ca7338c, 0x6b6e07d15eb99f4e, 0x5592d9f2b94d64b7, 0x28e493775c115a60
+, 0xc810f44213f9131b, 0x651af44e5b919e06, 0x083eeed1b4884442, 0x08f5d10465eb36e1, 0x0996e5b280df3c63, 0x66acda94bed5b97f, 0x178b26a2fc34e17b, 0x11579aa74b36ae66, 0xb08e3c49cf3b0797, 0x4ce1cfb60cb70dd0, 0x1f9fb8dbf8de6184, 0x7258658224d39845
+, 0x49a2b89d6f08080f, 0x50b4f85905abc180, 0xeb86376ece250501, 0x2620b372cda33050, 0xad330c195ee19048, 0x7d75dea6a663276a, 0x839cf59f1143aca4, 0x78e296a3f8db15c4, 0xf6b33e34a97b31c2, 0x411e6f77c013fefe, 0xa095abd0535f3ffc, 0x0c733aa98d1e5c47
+, 0x5bc99b610aa4d5ba, 0x6a64fa6ea002773d, 0x18807ae46ac19aea, 0x5126274c4cc5f2aa, 0x7f8d44a1d5f8677c, 0x349bdc7148c3054d, 0x3141b64ad7af68bf, 0x5d0d8fa3fcfa9d66, 0x7d7c6176e1670636, 0x79f67bfebc1f5584, 0x03c03810a0355262, 0x1ff7360720c0bf32
+, 0x8b3e353202c93e71, 0x358bc73618abe9ae, 0x792332ee1b3d7552, 0x249449685007b231, 0xe60776879b2c297b, 0x3af252a1c4893d48, 0x1b44c45a257764fd, 0x6b98f18a8ee80a9b, 0x9e7e93487294aa5d, 0x157dda9635602be2, 0x0b3f53420bfd8bbf, 0x5898880e6b682165
+, 0x0d722bc26012299a, 0x3b3546aed0c8319e, 0xb7c6e19c7b56fd19, 0x5d9247e9349723f1, 0xcb47b0888e6cd5a3, 0x52e42a9e90379cba, 0xf446254a6a682c6b, 0x6f4e42a95b7d6fbe, 0x369751f41ece6f86, 0x049ebb332111d488, 0xe563e0305e7d377d, 0x0c8def3e2eaa3b65
+, 0x5e14eb2044de8fea, 0x5c5f0a874c3dd1fd, 0xbd0058577c64df1f, 0x6b8fc66ac58dd208, 0x23cac642f3fc4de5, 0x2521cc00bdaa04ff, 0x57a5dcf329ecf7aa, 0x4ac9b17106f66dac, 0x9c75810fd96efb70, 0x7c528001a704105d, 0xab8050138033c336, 0x526753b3c05d1222
+, 0x63ee5bec589d029b, 0x1201f308cb4017b9, 0x6205ec496c816984, 0x18291daa3b962453, 0xbdffe7980587d4c5, 0x1e2da12e85220650, 0x706a801a11388a4b, 0x63ba42d0c20a5c1a, 0x13ceb3405166b42d, 0x1c20c4857321e2dd, 0x348b3e6eae7351eb, 0x635003b98e4d3ec1
+, 0xce1969e8cc0e26f7, 0x18d0f77ff565ce7f, 0x94270ff5fbf01134, 0x7e3da661825a3af6, 0xc6510f2f598e630b, 0x09161692424c10df, 0x4d7faa0b769bb7eb, 0x1ed8c31a0de7f3d4, 0xac2d87127285827a, 0x72c1ae6d14320584, 0xa23bd37e5a4146b5, 0x258be33ba4091249
+, 0xc4def2c463095326, 0x57b8ce85f1120c18, 0x9f2676d4506137af, 0x0f8fef8937729324, 0x829a8a63582f7b7e, 0x4e68caf1f4f2f3c5, 0xb0f4fbca616d5d39, 0x2bd52a1960719c11, 0x69b70b9d85bd4490, 0x71a9bea9ddad7c9d, 0x62ebd9258b6156bf, 0x3240e85cca4665e9
+, 0x78429de94e0aa343, 0x3d4ce556849e40c1, 0xd20093121284caf4, 0x148e40e6a8872009, 0x8db880a498450c53, 0x0a67ada1ba05c803, 0x4aeb0504b6e8d65d, 0x04f51b6001ccad05, 0x5730565bfe0ccc66, 0x3601d600e063246f, 0x5af620aa147b364c, 0x6e843e0b34e8ac40
+, 0x4c28d33be38c2fdf, 0x34dc3a0b1732fc81, 0xf4de526ffdfe5a0c, 0x03711d3ba0bffbea, 0xb8659eb4d19251d1, 0x7ba4e1fa7d650944, 0x06ba803db1534ee9, 0x26872d5847e073f7, 0xdbc50a440b6e8021, 0x0d1d86a9393ed878, 0x300bdae71b96e6ce, 0x0f7b56f51d92f3f7
+, 0x7077011622b5da86, 0x79d64769fe7380ee, 0x8f5398ea3300d3b4, 0x35c69839381a4de8, 0x0b35b9ff09d7f1da, 0x1752e54aa48ea0c6, 0xd3955f4787d5ac7f, 0x0a3190ee4668c447, 0x9096f02ab12e410e, 0x607d1c6e143a6548, 0x6328565786e1243f, 0x6a80f6be0abcaf5b
+, 0xe8b111c25b6b6189, 0x452ed49c9a378593, 0x49cb09ac96000a15, 0x7c3ae51cea6e373e, 0x4649616d4f01fbb3, 0x5039907dbc47f129, 0x0455845e6957e954, 0x73efd468d2df2dc7, 0x26591a756d479f61, 0x626d600d2fc3c4dc, 0xc3c2511dbef3c437, 0x4f1e143676e2621f
+, 0x4d9676ded83cc558, 0x2b5550befc3c68c7, 0x5c7b25aeec0a4afc, 0x0fd8001abd34532f, 0x00e67a7f0ece9c8f, 0x27e90db15a5af42b, 0xea3492d1770ae1fd, 0x2832cde9440ec4a9, 0x3c559f17f429c70c, 0x7a33e3884c834c36, 0xadb150f3f09c2590, 0x02c3ed35fe90203d
+, 0xbd5018d9c6bd998b, 0x77c8a1a27e09a4a1, 0x97c31e94cf94d8c3, 0x182165daabccfb88, 0xc8c35366001a7bbc, 0x7048eaefb9c546e5, 0xaac9e2dd607922b5, 0x36a1f40152930a1a, 0xd64e81351849f6c6, 0x4f37488340593a9d, 0x7a1885514df39a13, 0x4d7d1a665b2eb8f4
+, 0x58b32b88de702cf3, 0x0629e29fce606bc1, 0x084eadbcf64e1523, 0x0279089e0f190172, 0x94bde4b18a720370, 0x7f07a9b3b0ebabfd, 0xd86ec6ffe8107ab1, 0x0ff4f82792dca729, 0x4561a77fa3d1ad3b, 0x53fe0a46667b6839, 0xfcbeea2d21ac9f6b, 0x1d5bf51e806a3734
+, 0xa3df6ba0b3e89039, 0x28324410d442daa1, 0xdb1a1643383af9d9, 0x7b5f7bbf5154d160, 0xa929c1901ac6012c, 0x013e44980ba82536, 0xe5ca8d1422ee35b1, 0x4395c3ce0ed02c54, 0x748d4f7c4afb0ab9, 0x079809b0282f2913, 0xbaeb1f6db5e845e4, 0x67c426ddd10e31d8
+, 0x1937276ee9aa8a58, 0x46621cfdcf99ddcb, 0xd724b81d21a6261f, 0x249e8c440a7b8bc8, 0x89c49035905bc344, 0x1d1722b78038e0b2, 0xcb1a0394a16c166a, 0x238f5634f82a8d53, 0x8e43abd3ece061d9, 0x04a6711ac3d98b6e, 0xb013e56878e8d207, 0x1912a0d533bc31ef
+, 0xfb83291260a137db, 0x619f3f5caf45d03c, 0x7a0c9126008f63bb, 0x0df880575d8ae903, 0xfe984db7ba168f28, 0x19b785709c2ec903, 0x2c49765061e2af50, 0x6dbe0a224fc82626, 0xd5ffcaabaa59fbc9, 0x1911d1aae60eda1b, 0x054c344c34879059, 0x434c72216578177a
+, 0x4b3e89af6518eecc, 0x1b0bc539d647d457, 0x398d92697b78e291, 0x7e2493325bd1ea8b, 0x7ad0676312f40d3c, 0x5ad9acfb8198f735, 0x0b93f231cec6ca4b, 0x5b2eed2d3d091415, 0xe7cff1435c5f9f1f, 0x15e450dd19fe791b, 0x6a6344f482bfa4c6, 0x6b129548a3109131
+, 0x0ec6cc0a5717d8ad, 0x235b882a5a6e7555, 0x1356ec27bbdc5d60, 0x01f497083b79701e, 0xf3801de09774cc3f, 0x51f92f68d45c2228, 0x842a57be8b355414, 0x4539cedb79de5ccd, 0x667140cd02389083, 0x562770fd07255d25, 0x4a13a92e21d2335c, 0x171e6a154c70fa00
+, 0xf7e371f7eae38134, 0x248c237f598b08c3, 0xbaab9c5e6a9acf4d, 0x61784384e2519b16, 0xeb0ee63adbaa9a91, 0x402c32c603c0ffbe, 0xd2f203603534c6b5, 0x61a3a2688f1062da, 0x5fe66a39a0c45924, 0x36cfbf0ac5b6a150, 0x1b779b9805c6655e, 0x014d27374cf8be1e
+, 0xbef7a4a67d2b1590, 0x763eeaf8c3f0adc7, 0xb514091a9de96574, 0x2e1e2ad45ea387a6, 0x2f69e6f15a68df94, 0x54aca4ba5226856b, 0x2d465d2ad4497160, 0x363284ab91e2fc8d, 0xee36ef92d3bd6c7a, 0x069cf321fd424c7f, 0xadd3fe96c1ce0d1c, 0x1076d99cfe725aa2
+, 0x77323375c5fc22e8, 0x5317f459159c8118, 0xb783dd40dfa067f1, 0x15d367ff9eae7c16, 0x31093bf150c2f8c0, 0x29827f59b7e40bce, 0xe04c7da20d1b90b6, 0x0dea3590fef51fc9, 0x3569630557a8a08e, 0x68f28a3cfa5e0991, 0x07de3f680ef49362, 0x59f9f71dcc35ae32
+, 0x4933f41b9cd4e48d, 0x700321413b587663, 0x762b4093b8a779ae, 0x329a542235e91079, 0x3e18712e146baae9, 0x14019cb9171bec2c, 0x01f0a40ac38117ac, 0x46a4ab9c6d155412, 0x2a353c0ef74f3a9b, 0x15b47d1b7eee5995, 0x108f96d00d957d29, 0x2f270e9baf48c684
+, 0x6e183af8f62855f1, 0x6d4a061e42d37599, 0x7292a1a648a1dcc0, 0x72e1311853f0402e, 0xada7272e630ca30f, 0x083f59212fdf48e8, 0x9cdd130ce20efdc0, 0x4819db3dbae4f4ce, 0x19dcc43771cae2ae, 0x49f4e59f8dc5b10e, 0xcaf0ea5eda9c164d, 0x09a10dfb1aafecb0
+, 0xcc33bd98f7b3237c, 0x7c1c1c8a0b478a48, 0xdd2ac833059946c8, 0x6b59f2204cd0bb20, 0xcc6da400d1803c1e, 0x0e2718dbfdfa00f7, 0xbd507be8e86488d0, 0x18c5ccc7f008226f, 0xcdf37cbcb1da63c5, 0x58482577c7b58190, 0x82c814c2f58f8af8, 0x44343f844c65ea03
+, 0x110fa64c59b69c9d, 0x6beb28c5e3c11bc7, 0x789cc022b3899510, 0x285be4767ab05fda, 0x6331400352046f28, 0x065c405a66d29fc5, 0xa6f13d776170a713, 0x44aaede9fdc7d6c8, 0x8781ea6ff12e3aec, 0x3af26f3e5e59ce25, 0xd8c525de126e022d, 0x03789618222dcc4d
+, 0x857f04c83f24ff63, 0x49e55ee644d4c2dd, 0x81c2bd4fe64aa553, 0x27acf7170b6c3605, 0xb86017908304d78f, 0x4eaca811874d6443, 0x2cfc7658da50fd6a, 0x224cc4ca01a04251, 0x6ce44d868ca64d27, 0x082c6b406fc7585b, 0xd529613c930ae8b8, 0x09a667cc65ece222
+, 0x948dcc0e3bd0d604, 0x7c34a46e08f7744b, 0x5548f37e4849f78d, 0x327bd066d1e6fae5, 0x0b1cf03e36fe2224, 0x3a5ff4c734eaf880, 0xaac69fe92c3b7fb5, 0x4104113dc17eee7c, 0xdafd92f5596f0e11, 0x34c028c151dbcad6, 0xa4520a9d5143051f, 0x666bce0582754e2b
+, 0x3ebbc2a58575578a, 0x109a6c9adf22fb4f, 0xd05548e34e2c860b, 0x18eda629bd0f6a26, 0xd747cf67899ae871, 0x4ceefddc7eba078a, 0x8302cb0eb0753406, 0x0048b0569175726c, 0x7c4edff8667b0ec5, 0x336fa59ab32458f4, 0x76d071fe4afb073f, 0x7e318ae456def24d
+, 0x2fccdf5e9f8a98f8, 0x1c419b08a7504a7f, 0x93e12a3089cfcd17, 0x39e1fe37c5a6bf57, 0xe7b81064fa33d212, 0x44e0eecc0bc0f9d6, 0x753de78e37a2ca91, 0x670fe3840111210c, 0xd1f307f164eaeb10, 0x7c2766c4c61ca151, 0xcc568ec6bb77889f, 0x4dc84d90b80bb93a
+, 0xfb903088b66888b0, 0x1f141b8725959abc, 0x307aca7a2aaf0818, 0x3ffa8a2de61098d0, 0xf1d93bbb403ea642, 0x0a1993df89485842, 0x05b5369664caf77b, 0x2e2248b5bdf1fa8c, 0x78e68aca850619b2, 0x1d5502f054d57c7a, 0x5ab211b8554ff508, 0x023e0f8604c81816
+, 0x6caa4a4e975ccf18, 0x52b0947cae335761, 0x41f56a1bc7b406ab, 0x3d79af561f6c07c2, 0x1622c3a863e26b83, 0x78673016dad2e497, 0x2f94a72c4b00d390, 0x185119d13117ce64, 0x027b09394ed3bed4, 0x7f51a5d7f86a8f98, 0x3eb43fc8b2b361c2, 0x72af4f242c795e0e
+, 0x308e87da7d3dc530, 0x6f9553618be27f47, 0x197c40d121de9e01, 0x6e34ad4f693b8700, 0x932098056c06b80f, 0x6b3be9761d7f8dab, 0xf365e7ab55da1104, 0x3e8664a68d9d12dd, 0x5545b66254fd3803, 0x5861c13e8e3c40cd, 0x38c65922bb18db66, 0x431eeb94b0ccbf39
+, 0xc41aad3beea62cdc, 0x1ccf42b939fc1c75, 0xfcce9b8046902815, 0x541aace8098e6a7c, 0xc0dc1d4760ab37af, 0x4b09c6bd81461c45, 0x94f6c30b6491c646, 0x623245739cb8478b, 0xbe1d2dc02d9f7bdd, 0x1dcdb5842cb3a3e2, 0x3e4835d04adcf575, 0x69ad08493db51fc3
+, 0x05e5e42fde7e5061, 0x463d2162780995cf, 0xa998734ec54658ba, 0x3e61e78e2c5b7305, 0x9fbaa4f8a8843a4a, 0x2a6801b5eeb7e5b3, 0x4d7b0a791adf1e5e, 0x064da647fbea08f7, 0xcbd1c2bc03b5167f, 0x7f8e7069dde7b5c5, 0x733055bf16da95fb, 0x0d3351728bba9858
+, 0xa2a4be8104b5dafa, 0x480e41ca17a21615, 0xad6958b7908361fb, 0x42994dff39d64d2b, 0xdc83033834b630ca, 0x7adeb479f15a05ab, 0x16213a07bb5ef484, 0x00f1aa2d215a5998, 0xe03d0f59513a6dfb, 0x600217d75c94b328, 0x8acff9efca1623bb, 0x0773d111b84f4f36
+, 0x0792bbd7cefe57e8, 0x2439bed387e8376b, 0x173e821d9f56cef2, 0x19b8de030bbcf368, 0x175eb0668564e3fb, 0x2ef989e14c72699c, 0xa68731c8e773d1e4, 0x6329cc70b3b7bcb4, 0x77c1706daed36020, 0x3e44953cb4909468, 0x906032e1483ba649, 0x31934c475d5326c8
+, 0x7bca73fce3fa31fe, 0x2af7694536f24ab2, 0x7db360e9b90cfb79, 0x544aec94acb689c0, 0x66aa7867fac3b974, 0x3f9c19449d0ba8f7, 0xe3cf3596448c1ce8, 0x04950756d19707c8, 0x74afd55e840d789a, 0x267a484574a5b377, 0x986b19fc2e0d64ec, 0x21c0cb47bfd3062e
+, 0x4e675289ff0fa3e3, 0x164bab7cd34dde0f, 0x31fb9c1ca670f455, 0x35e1e8a42aa2ce74, 0xff4ca3245b4dcd5d, 0x20538e65dcec73ce, 0x3488e5f5329284d5, 0x3003131e4f970295, 0x46fdc0bde8604fe2, 0x4b15caae9fb4e8c8, 0x9b14570aefa07fb6, 0x0aa6a4183d21c1e1
+, 0x6dabc8eee5196f37, 0x63416e116ac71fd3, 0x86ab08168263cc62, 0x0bb274589623d1d6, 0x8b95b8e28aeda6ca, 0x0fb9172e68cba72c, 0x923c05fdab7050ad, 0x106f551aaf0d907c, 0xa784ef6ce606f3d3, 0x1c32ca365f9b8f43, 0x7f5bc500c91ce8b6, 0x16fe914ff5e1c3c7
+, 0xb2c3b2612f27625e, 0x2af8fe2d30d1d975, 0x6b1cccd5eb13522d, 0x4261897bbf999147, 0x3b874d60c5976196, 0x4060ca1a425dd08f, 0xf2b01a53e5bd0e6e, 0x55dc04eb6ef960d2, 0x06330b33e08c050d, 0x4065fff7c3ff0759, 0xc1bddf3ece655a84, 0x7a9f8f6e1d430a3f
+, 0x40da643b23be759b, 0x43bbc6b07002c65f, 0xdf269e7d0ce2e8f0, 0x600b6e48114ed804, 0xf271883b00cb1b5e, 0x4d55c2734134a889, 0xcff19807fb588fb4, 0x6baac279a1d593f9, 0xb68f0147d550fa77, 0x709a1ff7d2694a03, 0x1cfd48f6d561afdf, 0x06ce5b8491cd21f4
+, 0x348f586773e7c6d9, 0x6de98c5021863902, 0xfdf5ae36cae79418, 0x5f54f4ff7cb63c8d, 0x044bc5ff80d20eae, 0x3d5a76cb0b36b68d, 0xfd8459a5fdf5a309, 0x00b228d1b609774b, 0x45c3420cad2b6bca, 0x205c1d8eb49f6832, 0x3b86dabcad8b2712, 0x6f524bc38be96906
+, 0xe2ac2d79134c88d9, 0x3deac6dc7e91a9b0, 0x16b5d5882d9b7efe, 0x3f8bb0932ec4dc94, 0x483e999bc366117a, 0x7c63ad886afcf439, 0xc807806f0219d925, 0x4bb1466f02457b6a, 0x9f9c732e38b76a26, 0x457a9a9581a7b0e3, 0x33eb985759eafce7, 0x3ba79546b6d9bd00
+, 0x3699462bfffca44a, 0x792a825f3ee93807, 0x7dc7d65ed9adfd81, 0x6d12da1eb1727fad, 0xfc75020106d62db3, 0x6c461db1e8a7d636, 0xb7a825afecc45cdc, 0x6df381eda0d8ee54, 0x331bd5e5b6a4c71f, 0x71c27af5183683e2, 0x6867eaebf3f81a33, 0x3deb9c64faecc9d7
+, 0x53cf84418a86ffb9, 0x67efb6b7b802b418, 0x90c0c6198a1fa1f7, 0x404106d16c6b7513, 0x64fe2b4278eda9fe, 0x6c22784eaaa2ca5d, 0x3760f02925f0086d, 0x5f2ed0ab5e2b1a6b, 0x59fa1d099fa9aaab, 0x5b06d247354c416a, 0xbe01432ad3b2b394, 0x134118a8b29ae75f
+, 0x5611598a93357f51, 0x7a5c2cb4574b67d5, 0x4906781027708612, 0x6454099d18e7a306, 0xa067731ed0c32a33, 0x3416d97ba5275d1f, 0x98ae8b5273e477c0, 0x39ce2bdd9cccead0, 0x06e475c0b1b5442c, 0x44a89ab1b991fac9, 0x5aef5cd095ddea73, 0x378bdcbe2cc15eb1
+, 0x07143ad0c6347e97, 0x0511ebe614fab90f, 0x4162896a3d80db90, 0x0d2bcc801cdc1536, 0xe713a06d6e87de4a, 0x27edda2a75710f17, 0x5199dde28abebb43, 0x6b5d255443dfde0e, 0xd5627ba2b5382412, 0x196ec203bd772207, 0x11321f457593b696, 0x19c601d904bd8b3d
+, 0x9afdd4e3986c4eb9, 0x4ae853f0d0e1daa5, 0x297e8cd6846ca613, 0x41290428ea40ecf7, 0x86a56f3efa18c585, 0x0d584dafe0c32760, 0xe737c1d08ba62ac2, 0x54415167189b9f40, 0xa1ecec87e4bf688d, 0x24b69c841f6f2d53, 0x248d302e9324604e, 0x6b381021a7034b5c
+, 0x87dc87d32c54e031, 0x7acb0867b7ff9081, 0x310bfc3f1ca12810, 0x38df3e80f96e35aa, 0x3120e8a61381a443, 0x7666f963a59dd7d5, 0x7db0584458630f50, 0x2605b15a41a648c7, 0x639a057c128b388e, 0x2d2dda44a433574e, 0xffd4d22d5e5b5f7d, 0x2c67a2cad4259e6c
+, 0x4c3458ceb80914c6, 0x7c99b3a6780830bf, 0x1305ec5c0d2a63e1, 0x77786287c0b4def8, 0xeed1b03158857ae7, 0x6aa4bbb7d3000b5b, 0xe57ae179b80deb6a, 0x7a7b532d99dc6b9b, 0x7cbbe54877a502c8, 0x33f7299aecc04e11, 0xe4221a6549984adb, 0x6a0ea8dc61672a05
+, 0x6691c0400a03ceb5, 0x43ad07293fe12e0e, 0x1a05f2066bf94f6d, 0x41ac61a7700db9a6, 0x9b50768a6b24482d, 0x703bb987f8dc3771, 0x6e4301a80054c70f, 0x176c6ba7b0dc28c1, 0x52d966b28b39ba61, 0x6dd6068e4a856621, 0x65baac1ce8f98620, 0x1c88b7078fdc22a7
+, 0xabc766e815210532, 0x79428c2b39472fdf, 0x7b8ada5137d669cc, 0x498c7c7233a6306a, 0xed1aa4f1376ec66e, 0x4ac52395e4e6d6ee, 0x4ab1ceb516313fd9, 0x39b94b52d6bdd62d, 0x4c1e969b74748631, 0x5d5722c95bf2756b, 0xafdb0d74b9d36b01, 0x640b4352dda6105d
+, 0x535a036eac7076b6, 0x18b587d362af2c63, 0x32feab8a60408e48, 0x7fc35a281eff628f, 0x03f4da72b8c96690, 0x5bea5febadbbd75b, 0x169418c83f63f57e, 0x048ab681bacc027d, 0x7bcab7cdf63aa639, 0x6bda9cb65f303112, 0x71c30994298bfdf5, 0x3bad19fe29246e2b
+, 0xa84ab6da13ed11a5, 0x7cb2c1d684251883, 0x50a2497b23b5b97b, 0x589272aa08b1f958, 0xb7c951ef02617c29, 0x7336bcf6a451cbf2, 0x05219d8e15b88d5c, 0x0839a42f8ba4ec47, 0x934f76443a81695b, 0x08eda0d3d122f881, 0x3f642b73bcefaf67, 0x6b6853b87fe3546a
+, 0xd1826a3fa5150748, 0x666174adc9546c34, 0x6f4f2b44b867cdd8, 0x127aee34f54c4fb0, 0x337f13636d190629, 0x150c33ca930aeac3, 0xaf0c44033e301b03, 0x19900d5cecc391f6, 0xd678c319aadcf5ca, 0x4ae448c0176b378f, 0xff50fd3bc0ccc502, 0x3bcb167ed4bfad77
+, 0x6e7fd4fa15a128a8, 0x0344bc3dfd92d609, 0x7b491a722d6dfebd, 0x0164ea16c6310a74, 0x02f8386c5447ca3d, 0x6fca7402013b5ec5, 0xeb486e287affa37e, 0x60d48f313564c76e, 0x1903da90d40d682d, 0x5da6dc4e9642e84f, 0xd5ad848002a3d49f, 0x1f2dd157c510ee0e
+, 0x6eb2497211b9d817, 0x73c533c6682e6ec5, 0xf8979633e3b7dc0d, 0x7f0fe2d59a27eeb0, 0x8cf75d74b3323077, 0x329e585f595728b4, 0xabaa457f9f8ebfbd, 0x0c2776320af009ff, 0x0daaf2b80f805a47, 0x5bf4d516942cf935, 0xdc940a5d8f78f500, 0x68dbc7833d8e0104
+, 0xb0b4cc82e4ddba82, 0x24057a74e73c4559, 0xed312432fc51d8d4, 0x08aaeb2e89c29c5a, 0x9a3a212e270f1db8, 0x74ba787b5057664e, 0x4e643bf36a0e9337, 0x052b6ee84f968688, 0x940e91229693075c, 0x6e17b773b1a23180, 0x5c5c3149bbd47276, 0x6eda0e41b93f2e37
+, 0x9aeeb7682fd2c3c1, 0x7062d112efe71007, 0xcbb4979e0109cf49, 0x1d01798130a2a8b8, 0x7d3cd49787e63bd6, 0x5adb086d9da2bff1, 0xe8d73e42c7602c8f, 0x6c9f531017addcc9, 0x09cfdabc0ae831dd, 0x69f10ec83e3a5ff8, 0x88468a1200c44041, 0x5e8ab9dff0cb6798
+, 0x67337c49a883fa61, 0x36904c0450d3ea6c, 0xf09ffef2efb0d81a, 0x63d94c663e7a9884, 0x89caee2ea6252c83, 0x2ce7db67dde9f4d9, 0x5d425be530d9f2fc, 0x7896c7737c98e07e, 0xbdec22aaa9944ebd, 0x5d7741f7be603aae, 0x21d483f206b87379, 0x70cefedaa7a5ac43
+, 0x5c38bd5fc08b02d9, 0x0320b9296c4a68c2, 0xd5d23823ef20974f, 0x39edd3033ba93b88, 0xbe1583fad0b73f15, 0x0c56872597fc5c90, 0x20c441502a29b8e2, 0x7242469cc596c4d2, 0xd8c3abedb6a266ca, 0x6217b53912996186, 0x28114f295eeda255, 0x08f25da2c92a698f
+, 0x026dc9b5663c2e6f, 0x328832a11d2840c1, 0x0044a7b4cc3f850e, 0x587278f160c4e711, 0x44ef5860c77ef2c0, 0x22a39a075a358ea0, 0xde591e66fc7ecf36, 0x42397ff893c0e662, 0x77250827b84ca63f, 0x60767917ef15ff22, 0x1dde698b1831179b, 0x4dcf7aa6fadd534c
+, 0x5652d040a47baeb4, 0x5f45d31ecded853e, 0x2926a94140e26309, 0x463e14c02e45391b, 0x2b0d8371d8339973, 0x125f3e6a83bc6703, 0xd736e6f503386d26, 0x15926e9cdfb3fe31, 0xde4d86c0ed820e32, 0x3ae197438241ed14, 0xfe68de7afb312c19, 0x324bf1cb2223220c
+, 0x10e5ae3001f0eb38, 0x7b84b2e9c133d8d9, 0x077706e1352d16cc, 0x04d976486a1a6bae, 0x50e35aac48b8014a, 0x2f4022b4b5a23456, 0xd35d0e1d03b85d8d, 0x4b03f0767e2186f8, 0x319d1528bd93e797, 0x19f83be8d2581c38, 0xaadd93917514d801, 0x33dbbaee50957e89
+, 0x7a9975f68470fb28, 0x54952bf0f089a18c, 0xa64cc74578b4aa40, 0x444ce19fcf31f387, 0xb6185bc420ed46c3, 0x20c2527bd629fcee, 0x14d672640e896825, 0x6597de3b36e9ef6a, 0x46c0889664549ca7, 0x7a6d12440feed09e, 0x412377022356253e, 0x12d56369fbf7c10c
+, 0xcb77d47964f15c62, 0x7fcb5ac61d45b5b8, 0x3b8947345f88afe4, 0x1c22d3edb5f6e199, 0x11fe9669c187d234, 0x55340111c89fa0df, 0xe3fed0a554df5b5f, 0x7ee1f699565bbf02, 0xb3ed3a157a2ed2f0, 0x1739d22e13584a72, 0x975a6a04b580647c, 0x72780e9ea55b7d14
+, 0x0c11dc9dc6e95c9d, 0x7cb2cca96ceda71f, 0xe912328db1603496, 0x5fe5291a146ff8e0, 0xa61a09a8a4824f67, 0x791c809cdbd5558c, 0x483077e3f215ca9e, 0x051f279d8d552d4b, 0x86ae7ae6460fc411, 0x74ed1181e3269dfe, 0xb9a7c2a3ef4f11f7, 0x0af619d4f2f95992
+, 0x356a6d5c55d32b2c, 0x3031c56835a8f8ac, 0xdb54b027514735bc, 0x6b0ae9fe3baa7e9e, 0x9b1858801a526de7, 0x362345a9c0c19ea3, 0x0f0b9fe64be27609, 0x3c72c5c15e647a3f, 0xd0d32798754cf4c8, 0x5aa336f426b7e272, 0x829d4b8a1140af1c, 0x62a4f493593e5951
+, 0xbfb3e49b55c62dea, 0x6d39f7104b393457, 0xe67755fdeb389dd6, 0x08e90c3152440224, 0x8ca33d483c0c9a4c, 0x370587913a3d66c7, 0x6d440e0fd94a4f29, 0x18cf3da1c3513f60, 0x75ef1d049cc76b26, 0x15350a9c10891207, 0x1d4d792431518485, 0x358271dd919985e8
+, 0xdb83f509657c1c4f, 0x73c10d124c3fa85c, 0x79a464b39810893d, 0x43f74b921f4226fb, 0x35971a1a9027bb3e, 0x5649bb2138195a56, 0x1f0f558d688cfdd5, 0x1f2710fbbebeb08f, 0x2178f7ff5627b907, 0x2d50716acb0cbd2f, 0x7749df3bc7761d50, 0x345ab0d3e37997f2
+, 0x4d2ba95d5f33ba2c, 0x22aca9fc22b7689f, 0xae08a09a43b6c3d8, 0x33659e4e1acd8f3f, 0x1cb1f6ff1e08d288, 0x58df66d015cc3521, 0x91f82269c99eba35, 0x36cef552c4a38036, 0x704ff625b30b5e49, 0x42fe7eaf5c5a1d40, 0x9dc1bfd4f99551e4, 0x11b84b6a2ee3638b
+, 0xfb8100659558049e, 0x3085c623748a0383, 0xd2bcfe42c7f09ca6, 0x3ed26865011ac025, 0x86c8e05607bd5cce, 0x637103fb85bbbc36, 0xc1c873eb4f5d951b, 0x6f8088b9823b727d, 0x7d029acdaa49b163, 0x2ac3563dbacb2baf, 0x90e443cfe99e8968, 0x0d3f783e59a7b8ea
+, 0x3082621d564d07f1, 0x4c2cbe1a4b4122be, 0x10963e899c2edc05, 0x7435ae474a47a65d, 0x9ab6a245820ef574, 0x3a9abfc9e45f68b4, 0x9e4a10d3b61f8537, 0x6524578c3d95184d, 0x6db466253da8b86f, 0x391ca177ceb50dcf, 0xdd8f1f34ffef2c65, 0x54f1f9e4dcecef6a
+, 0x39f77ff17d83ed7d, 0x410dc9b741c8b2e3, 0x4b0b1afb2e28ea8e, 0x43b6a5614fbe2bda, 0x6cd2b9563b7f7b48, 0x091a84609b2a6e0f, 0x9b67ec1b24ca35ab, 0x379ad6a66187b405, 0x5d80cc5d040c7d77, 0x56135ce5beabf1ac, 0x94fb1f210a32adc8, 0x08bae671ac7d8ac2
+, 0x3948b2fbf7bf2098, 0x19d4c6533f036d05, 0x8e4c8c54d7994385, 0x0ff46d9e36af676e, 0x255b1456cabc710d, 0x5b506093bac6ca41, 0xa7b8cf30e7267604, 0x3df97f29d5dd90bb, 0x188c3002b33a20e4, 0x4cc39936cf85eb7b, 0xa758fafaa9f00fd4, 0x4635d5527c18226f
+, 0x05e0c29567c0904e, 0x2d3c022382080a35, 0xaa77e5708293e223, 0x612c6dc19cd11ff2, 0x90ec9a9820438e22, 0x435f5c21be5399ab, 0x754965854e11af72, 0x106cd3de01e8201a, 0x053f0e55321d8595, 0x33e2cbc63182c2d5, 0x40bc2de82e35ad46, 0x2cdb3fc6cfa59f5c
+, 0x156f3cf18412d643, 0x5d911020d7647e0d, 0x00ba48e238bf0e60, 0x060dbefe0bdbd594, 0xca949c09adeb5942, 0x587618a8764ceb0a, 0x44373d89057fd5de, 0x4196ac996be12e26, 0xbedb748e86d8cb51, 0x5ffbf3b5a5978990, 0x180888027f96ee43, 0x77648c7225d43bb1
+, 0xa4fe84eab6296579, 0x782f82a5deab66be, 0xcb0ef9a011f0d230, 0x56d32df2074119ff, 0xa04622cf8382e408, 0x33ac65be4a346d38, 0xd1f99d4e35b31588, 0x01d5d52b7c9c7676, 0x9eca760b4bc69b3c, 0x2417152e1cfb1aee, 0x72a9aae6ef3b3d28, 0x128163fd1bd4aad8
+, 0x341dce477b56408c, 0x009134c2120fbc2c, 0x19a3633faf6672c8, 0x4ecd925090ada8fa, 0x6852af8b094afc81, 0x06e0f8211c312d1c, 0xac82c99fb48903be, 0x2c014da23c4e2d97, 0x9c6b82b76b7a69ac, 0x36b0362e38dcb986, 0xdca59bf45ea27c64, 0x3a7688e837fed619
+, 0x4dea868a0df2f2c0, 0x0c8d99d13c2b3a8e, 0xb1cd927bcdc7c26c, 0x50d74b9dd4aa76c0, 0x7990faecc435a633, 0x75cfc41c43e6d921, 0x3a12394fd204a5de, 0x6c51151a703ca5c1, 0x90e32a5a946c3baa, 0x7824aa1a17025133, 0x743eb83e7d0e86db, 0x6c17cac6a7048e2e
+, 0x81fe47843fe4c1c0, 0x25c9aa7191290aa0, 0xf4b918e93c2908e0, 0x1f8445bec38b68df, 0xd56f862d1b8a2238, 0x67ae624801091519, 0x7676d6bf0a68c969, 0x58ca0c94bc2dfe9e, 0xa8bd1595fd9c59c6, 0x6d4809a549092178, 0x5cb576da734a9a37, 0x22b88c3b00998e62
+, 0x2972b93f7ba08ef5, 0x07f8fb1593b465e5, 0x004bb6874eb6d874, 0x32b894925a97e7c1, 0xf31535e562d93dbf, 0x71f08ed31a8e6aeb, 0x0c4ab462eda11664, 0x107f4dbeebd5d17b, 0x82b342cb58981b2f, 0x3048364065195407, 0x2e18370c2dac7f88, 0x77e3e22d8749a1fa
+, 0x36d03570bd0962b9, 0x051143b15a722ac3, 0x468ff06032f12f19, 0x3a0be48096a9cdc2, 0xf92a4ec2d1121bdd, 0x3c3b3ef185c612e4, 0xd5ca3e4521dc3b3d, 0x2eee8936e298e035, 0x858481d02c31cf97, 0x1fb359e42784d7cb, 0xe11d6554067fc329, 0x29d342dc5afe692d
+, 0x32e163a198374746, 0x3ca1bc178a7c3923, 0xa7b4527859afa0e5, 0x580acff35e6cf034, 0x632ab1e63b3f74b7, 0x3f70d0616b81dc2e, 0x2862df3d48ce8f25, 0x74599fe82019fe13, 0x79dcf7fe35973bb3, 0x2e78220abc708774, 0x7f2646bacce07a84, 0x273e980dc6a3fb8c
+, 0x9a03e632c18805c0, 0x6e6bedcd3be0d1f6, 0x9cbe759ef3752010, 0x132e13f4aa06f370, 0x8547485649e21394, 0x40de2e6a36043311, 0x834e350cbd8e35b7, 0x14de4a0e936b4fa4, 0xea74137cf00bbe30, 0x4832546e18de7c52, 0xd53fc202dc984929, 0x14c20b1c792b3235
+, 0x7ac9303191dd7690, 0x21b9afb33dfe837b, 0x6683575d6b873684, 0x5a21ddf450c885b7, 0xc3a43519e8db22af, 0x5736cf45e6517758, 0xbf5cc1c69f7ee365, 0x6d9008b187d493dc, 0xe32cabe1b851a520, 0x5f1fe728823c3677, 0x828d6998b98bd16c, 0x13d43c27ac91632b
+, 0x3fb43018d4f64510, 0x3420042d34d10ecc, 0x8afc24f65cfb4d8a, 0x317967173e0e3089, 0xd61e938a4253a0d7, 0x220bd570fbd446d3, 0x98f6d7195324e843, 0x669fe235b3c62290, 0x9bc9bd0632aecce3, 0x4cba8ac35bda468f, 0xe2db805c08e1e583, 0x119d1aeab26bca66
+, 0x1b7256d6af3d5e44, 0x361876c7ec8677b5, 0xcc73d00ceb347733, 0x47dee4df898bab98, 0xe1bd119ecf417dc5, 0x37be6f2af86570b9, 0x70add9a063addf00, 0x74061d1e501700a1, 0x475eaa43643fc837, 0x3cc0f71979314520, 0x0e4293c0db398cd9, 0x0abea60fdd61e8d3
+, 0x02cb06db374ad818, 0x306469fe453ff9cb, 0xf9ec359c28d14ea2, 0x6e6e97c9cf3d26cb, 0xc6338c4d4994d0b4, 0x32494672af1b13df, 0x85bb696f43b3a0f3, 0x774c8e8e9adec9d0, 0x194d1cf09abce26e, 0x1191cde3e59e234d, 0x5ed8fe44a2306798, 0x54a8a2f728763113
+, 0xcdd52123fe32b461, 0x5a61b3d789f50544, 0x7cccc5749a38a76b, 0x70bf625fb638298b, 0x03b9e64add453b04, 0x64bd422b2a93c432, 0xa4329b2a02beedb7, 0x5b27cd1e328fbaba, 0xe80fdcfba4200198, 0x4150dc926dd9ee83, 0x7e4367de9a55d3eb, 0x6d18b9cb07572ac1
+, 0x17c2d6a62d464869, 0x09414e5294b2b2c5, 0x5ba47a76099c7583, 0x64ee24387002b9b7, 0xed8cfd9b5b8a5342, 0x7befd8cdbc38bbcd, 0x654c1fa36e406a53, 0x1f379e70c60a998c, 0x68eb008e5694d206, 0x6d87e593d84b0624, 0x7dd93a753c8f701b, 0x69272ac1dfc3829e
+, 0x3c6e4cdb04e644ce, 0x4fc947692f291875, 0xdcc57ee962935b47, 0x043234d711f453ad, 0xbaca720167413381, 0x6cae85bd4717e88b, 0x52e93d741eaaead4, 0x3adcef8a4913d95c, 0x0e22a18029842245, 0x14157cc50669676a, 0x5b1d2c7ba04b8f0a, 0x07a4ac849ef23b4d
+, 0xf828bbe822f31663, 0x72b0a103e0d8ed44, 0x9584885599f1af73, 0x7b940734897eb834, 0x17a020891c565af5, 0x3453b542c85e7c6f, 0xcbdfcb5070b9f080, 0x33f2c5c93795bda3, 0x114889d46c8d9e83, 0x65f11e4f5c0d0fcb, 0x4024391bf7687e6b, 0x2ddcfaae8d37bf96
+, 0x52cbe3925da74025, 0x386a42803d7b3b42, 0x4ad28d2bc137d313, 0x058e869b70dd7ccf, 0x282cccc033c466bd, 0x4b012c7292106f48, 0x7100a6b4fbd5d427, 0x69b19359d5f29365, 0xebf68027cb996cab, 0x7c7afa54b141caf0, 0x97555489153e2292, 0x31a0ed555ff02224
+, 0xc6043922e3d60048, 0x25e5964c41ddc7cf, 0x964c7b528c9f1fc9, 0x441f8f33377a98b0, 0x59e30f0161d23bcb, 0x1cb4b9c12f72d20e, 0x0ddb6380348d42c6, 0x57974e01437f4080, 0x51a0788e4600c62e, 0x6214cbf7e2e8f604, 0xe866c1454bc749ea, 0x76d5e6925c0f0d84
+, 0xd590fd2c3282866b, 0x79306269e53258af, 0xc258790542153ae7, 0x7b83dd5bb6b07b40, 0x5d46df8502abc563, 0x3fbe9f24a0745ed6, 0x95a8dc0dd80221cb, 0x19832b58e3b52593, 0x7e05b9caafaee398, 0x7841ba04f6709324, 0xb12a8edd3b94c3d9, 0x718ff8e54814f0ff
+, 0x0f438bd63645d02b, 0x2d013a6503d1d9ae, 0x8787a1e27ad0eb1c, 0x2b7116baa5ec4f3f, 0x6735fab7b88ec68d, 0x4a8d0e9c7c592252, 0xa3d78e06f18a116a, 0x01eee855f14e0bff, 0x5df9ded962e47c13, 0x4bc5f904cd349bfd, 0x956d255cd9da8a59, 0x3fc8b2aedd29c4bd
+, 0x5f3f7f4f9d31b08a, 0x07bdc7a0f2e10467, 0xacfc0f06a1cc186b, 0x0802d8c4854deb10, 0x9d42ad075674be97, 0x407535473ecad5be, 0x402b44988b85cfaa, 0x54ca51e4e561be5f, 0x8697ee5bd19799b1, 0x310db04f9f80a122, 0x6da5ae308bb69175, 0x4a0e3893c11f0e4e
+, 0x92bd415467c0051e, 0x5c4e8a52523a0706, 0x28c9b07d88743b43, 0x700513d57f00039e, 0x2cda9b895f3a8aaf, 0x7de9d492ddf0e011, 0x057a60145931b960, 0x0c6d32888a6464d2, 0x270abd7d45f6f8e6, 0x4717c8f825083a18, 0xa8c73e096128d9c8, 0x60d1f95e706886fe
+, 0xc909213599cc92fb, 0x1a3c59ca74285063, 0x59f057fff0072a18, 0x509469b4e7eeba61, 0xb237a3085de695e9, 0x40b8cebec7964202, 0x79e6750f9f087fa8, 0x1ed92a3beeb5b15d, 0x73446c6448d89d77, 0x335bbd284d98d5f9, 0x7762cf748ec0d898, 0x45230da1c0076b81
+, 0x4eec3a05a5fb68bf, 0x5ef771474dc27ff7, 0x53463083a5cfd998, 0x54a70d934033b562, 0x7f317336e8330354, 0x51446514471ade42, 0x618f44da5aa3de18, 0x26407fa6aaaba49d, 0xb877500f972a2d73, 0x526827bfc03870a3, 0xcbfe6a547b73e855, 0x630200db91adff7e
+, 0x92d30bd931217b51, 0x33099d5a3348ffec, 0x2e03696523eafb17, 0x3494ad4dbfe38bee, 0xb670ee4ffbc3883c, 0x14eb3e9a40072179, 0x49c17fbb0ecdc8c2, 0x62668bb2621e7c48, 0xb5b255554a733a07, 0x224a5c58a85e4a54, 0xde918eb3459d5f2c, 0x47341339af907f50
+, 0x301fd98b257c4275, 0x5ea0a7d348ccda17, 0xf4716cca2f2a2d99, 0x12fca4f6b66eadb0, 0xadedd43ee20246b0, 0x6dd2f99bc8656cea, 0xd092ba261754e05a, 0x3e3b1c70f1d85db4, 0x21e5e1e269e0e5ff, 0x677923990f3441e2, 0xfc8dcf7849baf828, 0x46767b40e03671c1
+, 0x7c63e626b026eac1, 0x0c0a29258fbc98e9, 0xd159c813ae20a182, 0x05a23afd9a13081e, 0xd9090f6e8dd4bb2d, 0x47dd7812c1c02216, 0x37a1326c4e24b6a1, 0x33d4a6b37726848d, 0x89c4fd9aa705c62c, 0x53e8a18b93d49e5c, 0x0efa8d4db2fb9a87, 0x01609b268f1b25a5
+, 0xe23ca522630f15ca, 0x2a713e5999f22f4d, 0xef8d1bbbede04e68, 0x054a94ca898e50f2, 0x88f18ac28859ad9e, 0x5bca9a42d88105a7, 0xac22cfa56b1f46f2, 0x50f8807c8d1a0253, 0x464eecb9c9fc655b, 0x5d5fc24ba62193bf, 0x35fc48d29b266bd8, 0x1df01cc5a63a3c8a
+, 0xe1bc11d1986ed821, 0x155461063dd5a10d, 0x4dfae61ef5330017, 0x3f18d8eb9dcabc42, 0x1495bf995e2c6a0e, 0x6b432b76677ba09b, 0x7fb476fead0dda9a, 0x6d40ac28fca8d253, 0xcdba2604ab906923, 0x7959ae6c264c1937, 0x73eef94ae19a7e35, 0x17c97418335d30a8
+, 0x47e518a37dcc861a, 0x7a11b76308f5fe34, 0x619235e8287037d9, 0x393f85b60ee86d6b, 0x4937786eb995077e, 0x7d623ce53c6eb5e9, 0xa3b976cbf208a3f8, 0x78f7323ac55fe4e7, 0x966f3d318cdc4fed, 0x3ed599e0d6560996, 0xf0e93b5fb5a6e220, 0x29d37c20a0388f86
+, 0xc3d24e22b21606d5, 0x4863afffb00a33f8, 0xc569e263dfb6d478, 0x7ee5878b965aa2e1, 0x59c88ce246ed0752, 0x38c47e3b75ee9a3c, 0x4f98830017fdfe27, 0x4a36c5a45a200048, 0xda45fa5a54dca0eb, 0x41d96fac55802002, 0x6d092828ecd49b94, 0x53ed7ea14594713a
+, 0xdfa50469ab278456, 0x434db90f6cb525b6, 0xad776683c49594a6, 0x1497eeff160c24cf, 0xa6f2917cdeb9dafc, 0x0c586af1c3c20c16, 0xf11fb5f7677f5f7c, 0x7f56470bb0ceef71, 0xffb4e80c23597b30, 0x2ea68ec7e9940b13, 0x49ab89a7c577e12d, 0x098c1f3312c8812d
+, 0x88903d7067a8317b, 0x0cad8a2cfab9c03d, 0x784e3343dd3386de, 0x3e6aad21737c709c, 0x59be566604459bcd, 0x75de537226797275, 0x9d1f169e3596b987, 0x0aa2ccbf6cfe40fc, 0xa7e63783b573b715, 0x79af59befdbc4bea, 0xda77f2fb77281889, 0x44b542ac2eba4a89
+, 0x43eb7c9f1c46c5cc, 0x6260673325ca551e, 0x30b5d8c308855523, 0x4e18e3d2d3eacfb1, 0xccd3778856388666, 0x733fe911b781ca59, 0x4ffb197e81b6b68d, 0x5bb2fdb7e1920ffe, 0x1c9f45a2d90e4e2d, 0x5d93953275c10701, 0x2de3e23aabdd21ce, 0x5a97fe6986be9dd9
+, 0x2264aba8ddb209eb, 0x2be56ab9a74f01f5, 0xee47469017de5690, 0x1bae65c0ee186085, 0x84b1b427c99a342f, 0x206115854fc9c2c7, 0xfe7640fc7d3feed3, 0x0669f0b4401d37df, 0xa3acecaa82f5df98, 0x40a9855c19d33bcf, 0x66992ad168b2bd19, 0x227bfa0f142235a2
+, 0x8c49fba42e443c1a, 0x6013bc8ddeb216b9, 0xd74ac338bd766929, 0x457807869c7fd2a4, 0x1915d4c143878abc, 0x6c72b0fa6523b9bb, 0x1f3823ee649d08a5, 0x53b063b94bf4a770, 0x60b6bbd18724bce0, 0x6368a492ec19c5ce, 0xe2c5a2cd2945e64a, 0x11364857b74a9ec1
+, 0x7a0a97d81e1ab754, 0x3bb102cba01564b6, 0x5f815c933cb6972d, 0x0772fb120e6a0ad0, 0x43d017093e4fb8a5, 0x0329a93f92f85f4b, 0xca9913e66d518efa, 0x3794b49b937078f8, 0x137d8a49a7921598, 0x525374e140feb267, 0x8ebff3d6dfb42a89, 0x1b4a1270f13a6187
+, 0x41ed8d92d39d5f74, 0x79abecba1a9ce7e4, 0xccbc07f9034d0b7c, 0x45d35ec927e3bf9f, 0xa9e0329d0ec42b2a, 0x278e1d3cc1419077, 0x5df6b14703646e09, 0x2ce7543f422b1c60, 0x3b8bf00af9a839f5, 0x2838fadfbe648ad4, 0x06b110636ae1809b, 0x6d88f8177c03668f
+, 0xa3d20069a1e42d53, 0x6bedd427704aa3d0, 0x24a8354d419db7f0, 0x51b3f2e2d8cb26e8, 0xcaadd16fb5468ed3, 0x37b6324b7eece59d, 0x2083f7de4202eea1, 0x42c5542a8e2783c2, 0x06e6b41cbecc5638, 0x3fde99ac6e16fc9f, 0x3b3448c0f8202d4d, 0x2e7fc4216908b8ef
+, 0x80b6f9e215a4d718, 0x235494c9e81ab189, 0xa88db32d9241f7b1, 0x25fe5c6cfb31a40a, 0xa0cc58f84c293390, 0x2f30ebe5074b4fb9, 0x0a4049660bc34682, 0x5af3833eec6c7bd4, 0x5c70e9705a33e65f, 0x6e13c5c190df0fe0, 0xfcd40a914b0dc13e, 0x5b3810a63cb5d7a9
+, 0xe2c6b68d03679e73, 0x26ef5292a1d92555, 0xecd8c948d6c7069b, 0x78059fb0b8834b13, 0xfda296ada46236cf, 0x48bb5bf3094dad77, 0x97df648c48fbc24a, 0x27d2b785eddc6428, 0x25bdb0db5866ace5, 0x7ade2c368289acbd, 0xacab495c68b68bc6, 0x4c1cf22374039ecc
+, 0xb9bfa24197e4128a, 0x69e25b9ed36075cc, 0x9f579b71cac3a8bd, 0x7f75680fc8e45728, 0x5f93dd46a6c37eb4, 0x08809632b88b9533, 0xe65fc8288e0e57af, 0x48c6dd97447d2323, 0x03ff899868228cf4, 0x459b965735fad7b0, 0x4583d233e8f8267d, 0x7ed36b96023d8062
+, 0xe1da5670e434f5e2, 0x2cdb4038870f89ee, 0x65bd73f1fec068f0, 0x796aed77831119d4, 0xddb2f8038d070f92, 0x4556a94b2894bfdb, 0x25d4fc2c4688c4e2, 0x210c86c2785dc1e2, 0x9acfdaa65f37d8fb, 0x35b3e1198849126f, 0xf52e8a1ac3e5b8c4, 0x13a5d52783539485
+, 0x7e615ca36d9d2173, 0x6e3dd241a7725070, 0xfd5f5b0b5eb80177, 0x1bfb576706fa053e, 0x982be44923a2a4c6, 0x5fa79e8b2bbdc7e2, 0x97b8b12aef107ab8, 0x79f2002eab243b45, 0x4df8aada81d27401, 0x28489c6a4ba7d401, 0xc59f7ee3e63dd1c2, 0x5983d7b8e19b9658
+, 0xfa9133924b288c12, 0x43ab560f74696449, 0x7e8e46c019210edd, 0x604e2f7955930d48, 0xcc11b16843253b86, 0x498b86536406c465, 0x2c18f4d6d970219d, 0x530a95f031705f90, 0x81c9c0db925da74c, 0x609e473b76e866c3, 0xa25239985ad6b66d, 0x5aa08f8570ebc756
+, 0x7be7265b4dbbe908, 0x14a66d5f423bee12, 0x73d6756b0f6dfd57, 0x43eee5fcf3fe1b3b, 0x26124e5e177f55ba, 0x5034ad146c25ee0c, 0x0d1a2c07543c0c88, 0x539ab8be433fb7dc, 0x502cb9cb799d0300, 0x63784463748dce6a, 0x67dce9b154aadc5f, 0x5ccaedb8b7f80e6e
+, 0xd23dc586449ea10b, 0x4ca2520104615f4f, 0x7a18311789381654, 0x1d36ac0e2105c55f, 0xf27670a2ac590090, 0x1557f039282ab24a, 0xc67c5a7e5bb3a134, 0x76fe3117d4a082c5, 0xfa31f8d746da3c99, 0x44ce8fdb1647b9a2, 0x3e8cc626104e0475, 0x230cb9edcbae8c32
+, 0x8588f88e28be788d, 0x561b1b47e9e62dd6, 0x3c508dc9fff9ada4, 0x66f9cca79f259c5c, 0x29af24c529483411, 0x545cb885cea4594e, 0xf5da538dc3c70adb, 0x7bfd3f2de1e12b03, 0x591f40ef764d58b9, 0x4bdab85aec4d351d, 0xd02090f12421e1cd, 0x41e91e3fcf91eeb1
+, 0x61bf3066a1e8812f, 0x7fd295f7c0f98f13, 0x5039af6f2b287fca, 0x18b5a88d6816e153, 0xfd6402bea314dee0, 0x51550002e08d493a, 0x452880b61a2e1578, 0x5ca3fafcea68daed, 0xe90d7b9eb8c34145, 0x06ac140375f30f0e, 0x97f558d3fd325161, 0x68d3c3fe5486edd8
+, 0x9cbfabe3bef2b2e8, 0x5bb053bb66f96555, 0xa42cc20b75262f7f, 0x2d8de14975c768b4, 0x6b23d7287db184d8, 0x28c0db9a015954ba, 0xd1b16afc62eab777, 0x0d03923b284ff654, 0x478de64faba5e89d, 0x5c7abdbbdc7b811b, 0x9f85fbdbab923848, 0x75309161b938f8ff
+, 0xcf3a482d7d710495, 0x0838a5a134d6f4e9, 0x370c75b447e5c696, 0x4ab5fd3aea28e497, 0x6b9af89ba521f73e, 0x1d59584d5573b04a, 0xb531a673147f9c25, 0x442120d3f488cd4f, 0x2ff7f195fc6463aa, 0x6a89643e9e1ffeeb, 0x46ff3051616b1cc1, 0x350513dfedd5bc6f
+, 0x037d96130aa5bce7, 0x41aafa77a4d6b24a, 0x00a67fea73d0ca51, 0x4a631d22e0ec41cf, 0x5ced1276ddca3469, 0x77a0d1c06d36bf7b, 0x2869eb87df7f57bc, 0x20ffbf1e7aa83a0b, 0x93a1fd1c6fc67872, 0x4c8f76ff45091321, 0x2b426281d601c968, 0x2c76b5604f21c777
+, 0x1388f7d129d004ec, 0x23b429a2d628b33e, 0x903fba1ab5f995d1, 0x56ad717775056000, 0xc222ec45dd819110, 0x1491923effa252ea, 0x0cd060a0e5998d69, 0x27c161c70248df68, 0x4801e382fbc79155, 0x2e42f3125f746c5b, 0x71ed547254c45f78, 0x0b75e232eaeff3e7
+, 0xaf5f8fd136e0b4f6, 0x590148207a4add36, 0xc723c192d1ac2cba, 0x24bc05467e650855, 0x36903af05a24be98, 0x1f9c5f8f66c0a722, 0x8fe754de1573ea98, 0x607c3a64ca33b39b, 0xcb58f979a3260159, 0x2f455bc9f009fd3b, 0x852b55f591fb7607, 0x1bca23f96a97d7dd
+, 0x1fd43dfa9d966891, 0x07f19fddbf9de3b0, 0x66953e1ae8f1a47a, 0x5b10115c74ca6918, 0x221451f4999d3e0e, 0x5ee326279e6b3dfb, 0x71d151b2c5dc4658, 0x398d9ff18719a78d, 0x176a85761ba64497, 0x12617f6c73f748ed, 0x09339ae8e67b7c2b, 0x245ff3a86fb90d46
+, 0x32545564a122394a, 0x7833a4fdc242e75e, 0x71c8f1364f99fd9d, 0x4a49e3f333cd4a34, 0x0139e1e74547e2ea, 0x2756ae7a3e702a00, 0x8bd755b9eae016c9, 0x75c962a8b607e086, 0xb60e67aac0bcf1b0, 0x23f2071c645e5779, 0x8ef2646985d82db7, 0x4118ef7ea1f53c17
+, 0x993d4ef0cbc912de, 0x1fa3fb4ec8a1885b, 0x0e1fa1f8f276a96c, 0x0a7f5076c0bc358a, 0xef0ce9aa53bd8819, 0x719c391668b3a5bf, 0xf0e17e3ec4285959, 0x36d79bba23356b55, 0xe69ab4a0019ba2bf, 0x2528bc238e342f4d, 0x17e86e27737a52bf, 0x63d7624ec6561559
+, 0x7962e9426a5abd16, 0x6191640c198693a0, 0x247d37d553bedac7, 0x22c95410c6052660, 0x9679cf5ac7beada5, 0x20d8c5b5c85bdfc7, 0xaeadd407a0f2aff7, 0x370d16c334d640e3, 0x27677fdae965e7b5, 0x01b8e37abb97e054, 0x8198413dce3f3fab, 0x08f80b591c40e04d
+, 0xf03cfab9a434b2b0, 0x2647081494e76a7c, 0x57e1f93e392fdd3a, 0x07311adf5928e2cf, 0xfd3d3e9d26a2bde3, 0x1aa615480080f1b4, 0x70108b8c9e4ef10d, 0x2a66e4f8569bc02d, 0x8b65f4ed820c7424, 0x27a41900b0b3e35e, 0x04ae828f6af37c11, 0x2de2a9a417d72894
+, 0x5e6bd80a1ca5872b, 0x588f2c97b3fef911, 0x6977ead1a347ffa0, 0x2fe5742fe36a43f7, 0xdb536dfc323a3536, 0x380855feb0ae601a, 0x5ac9da841b7f96fd, 0x70dfed478a261346, 0x0cafaa8526c75507, 0x76ab5938feb46b67, 0x0477294d5e0a984a, 0x200cb8cf260774e3
+, 0x86f449c381491032, 0x34a9a647ab9dc50b, 0xc05332780cf8d4d7, 0x5d4ca3506861c03f, 0xc71f30cf47c3006c, 0x65df9bd955248506, 0xa9eea538a8bf0a7e, 0x49f2cc06f9429dbd, 0x97d906e202230f94, 0x29adfa90b5749434, 0x7c132a27fc936581, 0x16833f8aa69c31be
+, 0xac8cf58c022ee96f, 0x20c3893432300f94, 0x8ed732628206816e, 0x26651f280958daec, 0xfc6d8624529decc1, 0x4a8fb16de75330a7, 0x03e1d674d7880791, 0x3724c0285589cc40, 0xc9daa804834d0252, 0x4475710683a6449d, 0xd615fcbb204529f6, 0x3b8ce328f660f40f
+, 0x19e04d1b2b0fe7fb, 0x56381ebd8181b50e, 0x5c8970c249df4ac3, 0x08acaece8ede7685, 0xc44f1a71aca0d20b, 0x623edc8d92e4ac3a, 0x5496a7e5885a0c95, 0x20a9ba37315b116e, 0x3765873809f5b55d, 0x23c44c42ebef2ff5, 0x56a96d921f724573, 0x3217815b72b8a9eb
+, 0x2cc1b42f5350a489, 0x31f0b36e85b8c70b, 0x504a5c8c4d2ce34d, 0x1af8ea26b3786eac, 0x69bc5e26d7afd62f, 0x21e399d04247bf9a, 0x6e6d6676a88efb27, 0x476212b9fe9a6fd4, 0x0740fb65284168de, 0x5f7570be65e69408, 0x0166c3279dd81c29, 0x6565489007c4ed6d
+, 0xbafb5bd37b5219c9, 0x00251709f2e210f7, 0x0d22639b51c1198b, 0x0f3c0df3be3de811, 0x3552612be3374eef, 0x0834744318ffa0aa, 0xcb9f1c1e3557a00c, 0x20c359f5de8b6614, 0xd319482a34d05268, 0x42165771b46b75d7, 0xca336c22e8d911a6, 0x4d072f70067a47e1
+, 0x9022c6f101555e9e, 0x4c8c7eaf7cc2d697, 0x629810b2d8044817, 0x25110bc01b06c9c1, 0x1bf9c06bf39eaff7, 0x6cc36f151f52b4e8, 0x76b73a6a14b62068, 0x47dcb0dc89db3821, 0xfe9dfeac2f670f41, 0x625b5c93b973c417, 0x5f8c917930133c1a, 0x6bd35f3e0992bb2b
+, 0x03b5391a85409e5e, 0x7981d8fd16362767, 0xdb45c80a32a23cb6, 0x67356a7ef48b2dc3, 0x6189236e9f01adaf, 0x07a1e954e5032bd6, 0x53d627199c69727e, 0x25d67e4163cec014, 0x18e7bb6a63a80738, 0x3112be4cb5dcbc74, 0xad9ad6d381643f04, 0x116112cbeabb734d
+, 0x32623abe2d66ff07, 0x4d780300822436de, 0x9bed066c04497808, 0x40db29b39ce86700, 0x6e5e5eb3805602a5, 0x52f227f2b1b9b40d, 0x51c2c4c197a18394, 0x6d8bca423ee270bc, 0xd6e60cfe8fb07f72, 0x7dd66c3970f940c6, 0x66aea7b59a0b17cc, 0x75fcf8b00160d729
+, 0xbedc5ea39b2402b5, 0x0dc3600425feedd5, 0xadc1ddf2cb1b6631, 0x205ee93e3aae976a, 0x7a2cb4e333c98498, 0x7d12eb776d56872c, 0x8e339bc1b41599fe, 0x4600f0a53fac9427, 0x1049d3a372f14304, 0x7b54e020b22db742, 0xd567962272a35739, 0x27a1178b1115f0c4
+, 0x6cfb39d619c35e1b, 0x5cb96fd1a9d9d486, 0xaf45cef7fb4fffea, 0x4a73d7b2ba9321d1, 0x44b46b4a80be86ac, 0x2769b50579e8f734, 0xab5d109e7472f372, 0x2bccfba1cbe995b6, 0xc00026115332f6a3, 0x7acb287da1561c53, 0x21555c608cd90dd9, 0x7731d1b2878dae13
+, 0x32122bf5ec1a0649, 0x592b5fa180ec8467, 0x876be1b5ad9ce66f, 0x484c1cc5bb34819d, 0x08e4cc425b30b06c, 0x2766065f0e4d22ce, 0xd90825644987aeff, 0x3a835fcc7fc456a6, 0xf4d801d2cc806d69, 0x41d767ecca55f839, 0xf2dea9fd01f1e74f, 0x74d01b97462211cb
+, 0xe43e280ad29f80cc, 0x5cdf66a69029b231, 0xe8d655a03c862cd9, 0x388e38b58d0e8c79, 0x5d9aaa4848ff83a2, 0x14d6fbee4d6cbe74, 0x0426dcda912109ea, 0x1bb7b9cd75d4b541, 0x3a3c0504b39b8505, 0x35a3c5882b31367a, 0x678793d635a6473a, 0x66abca7e20202034
+, 0x4a90ff1dad300021, 0x18f29036544d2684, 0x2036d39b8f69095d, 0x36490f5645d18cc8, 0x9414d7368ad3562e, 0x7f8108a04558487e, 0x93db0e56d653e40b, 0x03f413ea960537bb, 0x984717b77f7267ef, 0x6c5d9da4a5ee7305, 0x725318dc36060a49, 0x274397f8e79a239e
+, 0xbda7965b4095bab0, 0x6292b2505c7866e3, 0x451fb6a0672d6733, 0x37c560f40242a859, 0x151e56eb818f1423, 0x63451986f0c22ee1, 0x9275ff873a5c75e1, 0x178cdc734a32b96a, 0xff7adbb24244aacc, 0x76518aa0dfd96ddc, 0x161c1c8c81071219, 0x0584d44c10a3e6dc
+, 0x2727282a09e9acab, 0x1298e49c34514ebd, 0x0323d059ca1c0e6d, 0x6072c8b87dd26bc6, 0x36eca2ab28d36f26, 0x2a977cb5aae4ea2a, 0xf157d43a0b9546a7, 0x04d60af0ed661d29, 0x34bc1080126e4402, 0x7677ef9a21589171, 0xbd13797278f07a40, 0x32c0daf0b57f20ac
+, 0xbc83fd1b8366dc2e, 0x6cd07286c4e670ec, 0xf35485a3f339dc8a, 0x6e7e9285f2247e8b, 0xa9d19d3a09943bae, 0x43fa5197eed852a6, 0xf911398a043242fe, 0x4a100dcb1312cbe9, 0xbe2fd86be910a692, 0x614fd829368d7937, 0xdb5a98b1a92d578f, 0x46f1d23e1b0dca7e
+, 0x8bf4c6725e813f36, 0x68bc89078129ce91, 0xff56503ae28f5c7f, 0x2b6e0f4e42178ce5, 0xa97cd947ec65895b, 0x7aa90b66280ff6c9, 0xebbaf32df158a0a0, 0x6a748d0ac02bb713, 0xdf79b5d619e83397, 0x16934947f6485b69, 0xe75185521ab32881, 0x20791e276a7460c9
+, 0xd25c403e22c70bc9, 0x0bf079518e66e1d3, 0x45dd5c971d3711de, 0x66bd2c6a30be232c, 0x607829e5b29e53ca, 0x30ed414e71dc08a2, 0x3fd38589ea0f1d39, 0x5a881a121f37fc5c, 0x27b9394368987a4f, 0x321fe45e13afae2d, 0xc6feb75080f33ea0, 0x02166d52f45eebbd
+, 0x15026a1b0ccd2fc9, 0x1141be93d5bc3d6d, 0xfd20df606fc676c9, 0x4059e26b00ad78c4, 0x0709b409cec6b505, 0x68f020e8acf478e5, 0x875d77d1f5df0cfc, 0x66eb377735162ff1, 0x860482ab417a32ae, 0x21175f47da213935, 0xa07ff0cda099ecdb, 0x26ae5f177ae2b8e7
+, 0xa9a070ea5120eaf7, 0x2581feeba7383f81, 0x49e0f137f1fa2a7a, 0x7fe93c51cfd1ec62, 0x2d74dbdca7777f7e, 0x562da2ba74e823ff, 0x543b4f8609d77a2e, 0x3a0f65212f234ec8, 0xf842e3fea270ebc6, 0x4524322c6a289e11, 0x80815887aa6a8576, 0x46f49d53c3fe29a3
+, 0xbcc93cedfdb0d388, 0x4db312076ef0ad2b, 0x1f2cd56373654ad9, 0x4c6446970034d15f, 0x34d2cdbfd5d7130c, 0x6198950d03db2ae5, 0x736094b72faf1b1a, 0x1f6ca46a9f2588f7, 0xcba0b03d6259772a, 0x24e5a23d8d6be3a8, 0x7090e340c94f6d6f, 0x287ba27ee54e8466
+, 0x87320c8822d607f0, 0x44fd5802509df171, 0xf35c09860bf6ba4a, 0x6cf53130ef77cc0a, 0xaa81167a00b48ce4, 0x649f4c775b0d8b48, 0x59a25683ee98d33d, 0x651479007d1061a6, 0x155487411f6e16da, 0x411d036475404bf2, 0xc231f1344162458a, 0x4f36b7633f7dd368
+, 0xa98ddc0a4e7a89a4, 0x55d8a5da6eacd542, 0x5c3fb48b1001ed45, 0x5c7785ccafa702b9, 0xa64369fd216afb79, 0x1f405ef10e940669, 0x755f4831bc327b6f, 0x2bc1b67d71f1882d, 0x8eab15cfed7777d0, 0x517370d580d99326, 0x0811b75701c9db39, 0x234d84cb52f7b621
+, 0x970c4fbddddae49c, 0x3ba8d842475e41e1, 0xb0720f6ad75e7008, 0x275cd5c5184bf345, 0x5eb9833888d3796a, 0x1b3a42dfde11c2f3, 0x946548fe092b5f4d, 0x119917b50f263cc9, 0x622de955a20a3f82, 0x6a552ea3a60c7ff4, 0xc79230138150372a, 0x18083b9518de76a7
+, 0x55fb74dd7d3b5455, 0x523eea9a70ff8334, 0x5994a7335e356271, 0x3bb011f60430f1d2, 0x1ec434cba1d6ea7c, 0x69b632960feb5780, 0x46c50417541ebf07, 0x01470bfbf9d23830, 0xe9551f4c049bc5cc, 0x1c124638f35ee8ed, 0x09ca3a9141e83a38, 0x44daaf3e7411127b
+, 0x0e54717b6c2fcd10, 0x518ab46b26d5914b, 0x528ac6c82341e833, 0x2247fa99d41f4672, 0xabe30c65c0f327a2, 0x3ac74e012b77e1b4, 0x35defd694c0e86b3, 0x7c382e10bfe60e4e, 0xf37e382996b8461c, 0x4d47481c53631e1a, 0xac8f167884f7b7b1, 0x5ae1bb6ab1a4c643
+, 0x63eb02590829df80, 0x623126862a793fa1, 0x6e1e242f1ce09807, 0x7bf96130aaecfd2b, 0xedc5e9ea10bff70a, 0x66b548233b94d26e, 0x70c70ee4594d30ab, 0x79b0006c8811353e, 0x4352792c91710c1f, 0x0c7bf15181a9f539, 0xfc995ee769e3779c, 0x44871c6cb9dcedcd
+, 0x0d180bbf2c9a046b, 0x5445c598c45d0cd9, 0xdefb32386875fb94, 0x5b0d235355660f35, 0xbe1dea825b3a7973, 0x10658ec4e1bbe147, 0x48af5e87fad77504, 0x55f5d3c94a7dd694, 0xa9a3e7062cad6ba2, 0x36c0a7e3f9e0ea31, 0xc4bd65217010aebc, 0x1d031dfc8b9fb598
+, 0xe3621c104113889e, 0x774b77ee1e6a6477, 0x124c5b8a07785fd7, 0x5a6c0df18188cada, 0xf4adcd545e72d7be, 0x38100fffb66ba966, 0x2100cbe35fe4a4d0, 0x4489be2df052c175, 0xa03a22403b26899f, 0x5ae4a0a0fec13928, 0x89dfbfb802795eaa, 0x34917e9c4ecf2532
+, 0x64b93674c60cbbb3, 0x25c098506334c71d, 0x8a723f66f1ee34e1, 0x3a960adf48f141e4, 0x659f386695e440bb, 0x577a0fbf6e8095e6, 0x8ef419b0f4b25496, 0x044176a30b9e465b, 0x7a98705df2013e6f, 0x77d0b2483aa95ce7, 0x309e917b978effd7, 0x08f1e55bfe942c7f
+, 0xfc241629b8d613c8, 0x140f2e35cd68949f, 0x38899f6a3ee4f9fa, 0x7abc8ecdd300f3b5, 0xd3dad23505d23eaf, 0x75e73f09376b2c7c, 0x5644a663b60ec5c4, 0x511ade8afe1eaec9, 0xbb005fe4e1abca89, 0x2838de73b0ca1f6c, 0x800a6658b80d28c8, 0x48aaba61c91641ec
+, 0x222759cab704d4e2, 0x106dd3c0ce85beca, 0xa1ce1ce341f69d03, 0x1651b210e8e4ee10, 0x47329a5e7133e136, 0x58c02f47dc9367b9, 0x09dcba56947b02af, 0x435c251178125b48, 0xd56979a3f0cd9315, 0x2f02b0a6422afddb, 0x23920f500731f32d, 0x0ab833238232cb5d
+, 0xa7b3d1bfb0bb60db, 0x2342c2a03c6eaec2, 0xac5e6e5a14d5282e, 0x5b9a421ddc42a24b, 0x018506414543e056, 0x6d7c377c084954e6, 0x4f8bf71ed3db1ced, 0x5150dbc15ab10979, 0x00b50a1b373a7fbf, 0x140be5c3d3244705, 0x5005bfe96e5b7911, 0x77cea555bb133f3e
+, 0x2ab1e1a9d7a973c6, 0x3897ac98314968d3, 0x9e0f74764b23c9c3, 0x2e5ecbbae41997cd, 0x43e2ea5648f12433, 0x3a515a0e4808e69c, 0x17d36c03c36bb343, 0x44cebd053481ce43, 0x89008656c21b0d76, 0x2f8513fcb9009be6, 0x2e223f90208a0e83, 0x3828c2d4efd36a73
+, 0xbf17d64f89a8527d, 0x59ebb42b9656151d, 0x7d7bc7245c7dc5ef, 0x191b682a0cb695ec, 0x8931172fad9f9add, 0x239b6cbbab2ebdcf, 0x76932f9ca7002dd1, 0x0c140548f858d8b5, 0x6c7adfddcf741ea5, 0x3b39c4b9e2e1a567, 0xc5135a25f87436fe, 0x690d8fecb7dd0ae0
+, 0xd782a618ecda10c2, 0x4f2a84b3134cf832, 0x35a81f71bbc955a4, 0x457f88ed64ae6398, 0xc27eb71c31479985, 0x4ae91808569aab32, 0xa5f2e9785a75eb11, 0x619cb199b837ed36, 0x0e7e5912b9484e40, 0x3b5831e87fdbcaf0, 0x49a2779c2d2b039d, 0x3d4b81e07f49061a
+, 0xaa119b0fa222b55c, 0x265c1b11b42fd4e2, 0x6b4d28e519dd7637, 0x3d2da7900de5a4b2, 0x99b06586b5f21d63, 0x4ce62bd9e6a1ee18, 0xb671e753932f8c92, 0x390b7821d0987834, 0x1adf7c73c3f1fc2f, 0x78c636a8514a7af9, 0xaee3b35fe11e7533, 0x7fbd199278f6ffd7
+, 0x41aabbf4363d77de, 0x1b27fdf18b96bf6a, 0xda264a1dff9a981c, 0x36efc08530c0bf9a, 0x5bd8862a5d830854, 0x23d7c905e656e6cb, 0x4523324c5b64fdcf, 0x36627f376238665f, 0x564f53925c6d5ea4, 0x17c7cc86a1913022, 0xf90db52a543b009b, 0x15192dc91f8b994b
+, 0x80bfa3c1a79ec6e2, 0x48fca8ea99772ecc, 0xfee6a3b98c0f1824, 0x46a8c75601b81e22, 0x2cb3c402a8895fcc, 0x1d1dff9c04305ce2, 0xc1aefe78e85971d7, 0x79c6a083ab5a80b2, 0x379c7bca5dbf2518, 0x2419358989b3ca02, 0xc9c42c9cfa5f470e, 0x4481c2ce91b14459
+, 0x6b04dea1ea26deca, 0x26ee3ceee0d0a101, 0xe36cc6bcd8fa4f26, 0x4d14709719764fbd, 0xe0572a706f1fef52, 0x0f75fb69a23f2ec1, 0x32ae4b04a864cf3b, 0x0b6373a91b944773, 0x1a8f2bc20bd088af, 0x586b0d5ace401747, 0xa0e6b094a3c51433, 0x1752a123c268c1c7
+, 0x643c2a93b5770ea1, 0x536cb9d1b71eeb43, 0x6bfb0525d0cc6b3f, 0x1f4dcfeec3adefc3, 0x28a0169dd0bf57f0, 0x1336c9aa20a35449, 0xbbcda068703ad7a1, 0x5e33478283c1e03d, 0xf1997733d18fdaf2, 0x789af507a17bb867, 0x79970c14d5695613, 0x79452342e845256f
+, 0x6c12f9367a26a018, 0x11beda1c8f9cdfbe, 0x720e6ddf24b30929, 0x7706e91e3e544755, 0x4460381d3a6c9059, 0x7e01916c3678c424, 0x6024355a61d2bb07, 0x68bae01d79c869e2, 0xf21cbcff285df659, 0x02f7ee6aeb57c933, 0xce0f078c17266467, 0x039b4fdb5170a103
+, 0xd5de0fec61a4ae1b, 0x33d37a152a778695, 0xea64e40e6a10ded9, 0x1f1d394373bdb213, 0xf63598b6ef59fd14, 0x57922adc3ae52283, 0xe39a90e18b76f4a1, 0x27f3dbebd98a9dae, 0x18179dd9c03804b3, 0x511d72c1912e2d73, 0x88e1f6d24b2f3225, 0x56009999cdc2997f
+, 0xda6df977b7d82fe4, 0x76f746bba63da226, 0x0b5facfc3bf13bd7, 0x4a31eb04f66f0e18, 0x8ace73d5e7cfe28f, 0x19aa731bc30c20b1, 0xa91979fe73400317, 0x6795ce71a09c7c9f, 0x93d55501933700ba, 0x3850eaf08b1fd14d, 0x450c5abc89edca71, 0x1be5db848bdfa5ef
+, 0x77667d3f4fcf082b, 0x673b6e6c4824bc45, 0x6f22c12a5fe0ed6d, 0x006ee6722b5dfed1, 0xb47a13c1468d0c62, 0x40564879a378e6e4, 0x0bc6b553a9d3ab58, 0x21761c79e44dfcfd, 0x66f36ed3eb1050fb, 0x2e67df1312dd01d3, 0x48744c4a68dbf2ad, 0x7844962b6d6e039c
+, 0xe07b5675d378b65f, 0x336262aa3d2c1df0, 0x320a5667d78c2e2b, 0x4f668dd96dda5e2a, 0xe21556795c7b8470, 0x3061905b2ef82bb1, 0xaee53211472206b6, 0x1f87377fee0d7a39, 0xdac58c52a3b1a0c7, 0x6e3c4ce04f0d7ffd, 0xfdffec45d4a3990f, 0x4b5340f79e2ae2c2
+, 0x0537c8b7b3d1f332, 0x55292744ae35ee1a, 0x42336d0e6d057f1e, 0x5ac40e9e645cb3d7, 0x848f7b7f845e46c7, 0x74bda86736eff150, 0x891acf622baf4f35, 0x14bcef9cf39667bb, 0x9aa1354d9731b9b3, 0x27e855a19295e59f, 0x1a829a8e10662ed0, 0x3bbc43f9ec4437a7
+, 0x8bfa8b1cb1de5341, 0x3432778068d35549, 0xe3d807da41f25a48, 0x1bb6ee1ce2efe552, 0x08d9bded0bd3affc, 0x290f1c5299a917a8, 0xda8dfd79562f8939, 0x1bf7aae68686211f, 0x2ab6daf9bc860765, 0x7bef6e2f0eb58a0b, 0x8746faab7c439b94, 0x017ea87750bb8bda
+, 0xf8dfeb22239c9a7c, 0x35cec0d2887b3a13, 0x68aa94ac601f1606, 0x7470553f8ba61767, 0x37894f91c9eac410, 0x55b22aeb8337f732, 0x53f8d90f29a2fe94, 0x0aec068aec69023a, 0x40506162ad6182ee, 0x6a327ff1ac1e5475, 0x968d7095492df3c8, 0x3f93f46195f67521
+, 0x4983bca28970d546, 0x2716b931296b53c2, 0xf42b013266b6f8b3, 0x76f29b084b6a369f, 0x8e28749222216249, 0x4f2fa1d3a6c1acfd, 0x0ee66697eab8f954, 0x37c33e28fec0cce5, 0x7d0419e2bafd1dd1, 0x01f04d4299b94daa, 0x5ec06abbc1e5c7e6, 0x3a24c66060ed72a9
+, 0x0db764e15f960f26, 0x1d5973d5d59f9c3a, 0xf3dc2608dc6d9149, 0x1d80e0461b72f518, 0x2264dccd49c8b09c, 0x1f03e7a246334d5e, 0x2d6e38871b1fc2ad, 0x418588ae4f284bd3, 0x3efb071bafe1afa2, 0x0799ba0c80bdd8dc, 0xa6b273222dcc4a76, 0x13859f08ac8a4b23
+, 0x0194acc2663c5acb, 0x459fa55bd0bbedf6, 0x1b055550f06f8cc1, 0x09e5fad46599ea75, 0x6b3916ef772958a3, 0x4aaaa5c18093a431, 0x8e1503e36610f594, 0x620ef55048a263b9, 0x5a28963c8cb8ecbc, 0x6aee46b1b740c15a, 0x67e39606f59cfea9, 0x13a579e3777ca8b1
+, 0x45ad92f61cbb8de3, 0x53068a1a42460eab, 0x9b163546de379578, 0x07bf38a7cecd4860, 0xf84c77031d282de1, 0x402aed6399f78ffc, 0xfb83dd20295f6d45, 0x3702e257340d2ecd, 0xb8db2d8b979b97c8, 0x617526d2a50b0c51, 0xd86f6278313017db, 0x2f35eedec55f9d92
+, 0xeecb69493517973b, 0x7a111a74e0baf09a, 0xb82c6da8ec39f63d, 0x4217076312833746, 0x5d36d11f3dda88d9, 0x7baebcb360f2a887, 0x9829b62d093d6cbb, 0x10f17a2f6edf28fd, 0xfe3efa4353f40626, 0x731ca3065c118e34, 0x6185678827960895, 0x07f906a4f4c6355c
+, 0x361d9cd10e657142, 0x2b5f5d452dd861ce, 0xa3e01df05d04b69a, 0x533723bc4cfcc0db, 0x820384afa1bbccb5, 0x4e67e941595d8dfd, 0x0f8da50839e13646, 0x6887a0573a596968, 0xe93dd1df5ace7343, 0x0d4076f28ecf96c8, 0x0ba2f854988074c1, 0x5eb2a314a41a40b6
+, 0x49ff6d27a676b27e, 0x15f7ca40acd5114e, 0xc171f9a750d7da95, 0x3bedbe891f79eb5c, 0x5b643bceb83f74ff, 0x088b1af3aa331a4c, 0xde294c7e0a60c4a9, 0x0a0770fc8120b151, 0xf09b757a0c7c1937, 0x34b797c03efd9c88, 0x051e3edb2c28cc49, 0x66db34ec5ac5122c
+, 0x95fde0d3d3dc8cbf, 0x797897c8121818cf, 0x1fd46d197710f89d, 0x533a505803f809c5, 0xb60f1c090c9fd211, 0x4a7c3479af5c9d82, 0x4bfc3ffa4c8cf5a5, 0x6949f4a61306821f, 0xd814c949c67abcdc, 0x419a5e33166863c4, 0x9de646f6bd0895e0, 0x497cc1449a54545a
+, 0x69eb31247fe126f2, 0x323c83233967f477, 0x52e0db4d3d78127d, 0x42a0e188e7b9380c, 0x3a6b011c46e34e7e, 0x79f4168aa9a0b4aa, 0x94270a25d708fa4d, 0x2bb28618cbc9cdc8, 0x741e46bb04606819, 0x02790c52fb2ce982, 0x6dbb92d0c6d0af10, 0x32aa96ae061e9412
+, 0x1376700c90d98eaa, 0x4d1dfe650c0a7136, 0xb397f8eef89aff20, 0x4836ac4a041bae37, 0xf37c1076a80a02b8, 0x0d063fa2467b3a37, 0x498f2617b56b7e7b, 0x65ef1194db859a5d, 0xd1fe25d5d28ffcb6, 0x228ee6f49459c083, 0x6b7e82b3b009b15b, 0x713b185ef1fccbfc
+, 0x552468f1ff60c298, 0x2b7ba65d02519614, 0x8a86ad90ff0816c2, 0x7bf9249284bd02e5, 0x3008c56e474c2d10, 0x171473b77f804540, 0x15fb79d07bdea766, 0x66ac67c7b9b0951f, 0x34bca15bb6d2f652, 0x13c63dd2687d617b, 0xc515ae237715c19c, 0x0e543c6765fbfef2
+, 0x668c80faf156fb5e, 0x1e2e9e3b3d9962b8, 0x89ebaa264394e113, 0x322add21cf1659cf, 0xf9e6e26733619f8e, 0x723bfc8b792147f0, 0x79aef2837d7e092f, 0x1aa61c59290b5011, 0x9955ae576a499cd3, 0x2c3d6e6a5a1ce0da, 0xb864cfa199a8676b, 0x4961a21f1080285f
+, 0x828e184adf9d997b, 0x0c84bda97e7ce725, 0xe6974677094cfcc5, 0x4ec8cd773946105b, 0xa48681bcc95fb5c6, 0x6ade87f8f7a5f269, 0x9b97628fdd39c03d, 0x3bde0ee1f19f1842, 0x4ef8c8fb117c0ca1, 0x769bf8f8d07de9bf, 0xc8f5f435b78a57e5, 0x79987aa861bbcf9c
+, 0x7f6c557204b02022, 0x119bd819111c69d1, 0xf0c61ef00b3eb70b, 0x4317f0511bfb7b39, 0x36a2b944e84d608e, 0x1c1a3862da3369cb, 0x37dbf471085f1775, 0x3835751e107419ad, 0x04ab0c84bb07a3fe, 0x63758bfbc7df13a0, 0x15ffd20cb554f23e, 0x1ff11c442b1515b7
+, 0x171377f1bf937186, 0x615efe82b83538f8, 0x321e7cfae352a761, 0x7af02427d7241502, 0x86546e47f2cc559f, 0x65a1d8a017659d75, 0xc95d8aa5b8bfdac9, 0x01e887cb68990623, 0xf1f8ee8c466bcc3d, 0x40ce5e4f2ba3908f, 0xd2b81a3480c16b35, 0x51625d3eabf708cd
+, 0x44d770a210105739, 0x7f1de74a022958a0, 0xfbe4c91bd1e8f732, 0x204fbacb13586460, 0x97d79097d62e3cf8, 0x541ad5591934b114, 0xfdfb47919c141909, 0x354926e5244fdecf, 0x6291b0a0e2e994b0, 0x2b9a9a69d3a6c3d1, 0x8189be54302371e7, 0x3645c65df1a881cd
+, 0xdf0460f445e3877b, 0x7ea384dc52d0d26e, 0x0c2e5f768d46b6b0, 0x1f6e62daa7c5d4e6, 0xf8b026b33b2343ee, 0x2b7183c8767d372c, 0xbd45d1b6b6731517, 0x4ddb3d287c470d60, 0x1031dba40263ece2, 0x4e737fa0d659045f, 0x8cbc98d07d09b455, 0x34a35128a2bcb7f5
+, 0xd67a89186b67f7f7, 0x0485b55c63a054ea, 0x022df582b37cae98, 0x09df88e0b022d555, 0xf4d50a279431ad48, 0x136ee46e04a83bf2, 0xabcd31432b41c5ec, 0x044f332904b55bc6, 0x67aba8511ca39aed, 0x09aa9b5b6879a44a, 0xfe504440a2ffe51f, 0x3393b3789df24b74
+, 0x7c1b49032f02d460, 0x4d963d715a2f9b6a, 0xcaf608ca35ab8a74, 0x15ecd2c7ce16b48c, 0xd603443f7ede9274, 0x046085b00ce83ae9, 0x838540f05e037b98, 0x30eb0ce4082340c4, 0x424b0415d3a2e1bc, 0x4b0694d50e59d33e, 0x42e28cada0fdd5e5, 0x35412f0347c740a7
+, 0x8e238126eb2191b4, 0x3a4817c4981c4a44, 0x0ea417bf90729c7a, 0x53f4b39a0a96924c, 0xfdccfea0d55a2b76, 0x7a50d61f77f02d5b, 0x1f9efd11d5e3cd5e, 0x681188f6eb609c63, 0xd42c785c237cb980, 0x6967f35e77a9d010, 0x69936fcc59185cef, 0x3228a5a9e2dc5fb4
+, 0xae3d773e171095b0, 0x4ec2c51ccba19209, 0xba6280f9d7b86775, 0x1a0bfabbff287607, 0xf02a2adfbfb174ac, 0x51c629e551750875, 0x344d1111fee7a42f, 0x261d1b2a993db0bf, 0xef47e45b4f95b354, 0x164cda1e29d6662f, 0xe38c4bba25026cec, 0x31a2bc3a8d879c77
+, 0xaf64573183574465, 0x43ea015306db32ec, 0xca237c27c2c35216, 0x3fa7a8a7d8703c74, 0x01dcb7435801ff5a, 0x2738b3402a0c9ccc, 0xd491abc8e0a6b715, 0x0fb804f567699e80, 0xfaefab5a929f07f7, 0x43ad6cb7e2a703c2, 0x0d1c7cce172ee8ef, 0x17a5531ced786ab0
+, 0xbc590e52c0293bc4, 0x682d0f1109fd485a, 0xe0c0bf60301dc4bd, 0x5f802eb572f2b825, 0xfa23eea474501f01, 0x6b64c705cd840588, 0x6e17128b22ff936f, 0x41b02de52f49734d, 0x841756c656120edd, 0x0431503876e11e1f, 0xfe2c6f7bac8a7dd0, 0x4c895ee389e3dfb5
+, 0x3677d442d9d5e5b2, 0x3ee1f140008cd86d, 0xa0f3a0ab784bf0dd, 0x04c41174968d6980, 0x087ce5a4824d472c, 0x405caa5101af47bd, 0x92846aa3f1ba5a02, 0x4be85c1a0293fa01, 0x75468f60dabf0e39, 0x7776b73bc624b11f, 0xc4b2de550c485e7f, 0x3effeaac0b12cbf4
+, 0xace065e8a9f4d8b8, 0x6c934fef46752ac2, 0x080d9d3d94a4c1a3, 0x17c5e39bc2d1f839, 0xfd98f8efa7b13947, 0x3aca8fab8506b3e7, 0xbe294c27f74f704d, 0x35122ab222555996, 0x79e6a88af867cf4b, 0x30550a6f46a766ca, 0xda8251a837a1c0a0, 0x4aa3cbfedfbc1bf0
+, 0x41538bf9877677ad, 0x12088ce4700c0277, 0x17ca3056d9242fcd, 0x694b91316e093eb8, 0x229d647fe167d6d8, 0x1c44f58451422e23, 0xc30cafb8c9883dc3, 0x58a285569d459f19, 0xdf64c1520ee25f08, 0x0133bc9147c7fcce, 0xca072b66f37edcad, 0x22dff316f98b0bd2
+, 0x8a5737c6d770f791, 0x76ddf459dc6d3475, 0xd60755994a314329, 0x3e4938123cac6ddd, 0xc19bd7a8b9052ae1, 0x54a0773d3cadb0f5, 0xcf99a525f9717866, 0x3425dc15084a5e77, 0x87526c1ee454d435, 0x5d8100a33b69fb8a, 0x256dd35c1a07c098, 0x6fbc19f1aae91cb2
+, 0xf593297a07f8acc4, 0x4a09c89cff3f98af, 0x7dfa970768f31f11, 0x5661eff49cad194c, 0x720a4d87ef663aad, 0x759a92c430057f94, 0xfb69dc211a9ae865, 0x69a987121f413a03, 0x1d03396044f0ea0d, 0x1b0dbfe6fe71e284, 0xd4d44c10b577fb1c, 0x6f10d16400c9cbeb
+, 0x84b17a64da2cff84, 0x3867a8851b393881, 0x77343bddf8676d18, 0x19ee638bf7ae430d, 0xe6e75e5e9c06ba80, 0x6ea4557c2b0e7b33, 0x05f876dd49ace992, 0x2ba836e4cc9cb80a, 0x1081d1987da94e5d, 0x1d50aa05d4cf0950, 0x29d45fe7b4dea54b, 0x670e231fff930dff
+, 0xcdd6c99de11cfead, 0x10edacced4287dd9, 0x0d55c32380233432, 0x4c9d26acdac27b5f, 0x9e6ea7ae80a4e2d6, 0x3f5dd1ca9a56f417, 0x46467dd5b1e461f6, 0x6ac4fa1b0b9bcdb5, 0x8f963f5b101385fe, 0x62823bf962d11a2a, 0xdadb2192429974fe, 0x443c2c5fd1be864f
+, 0x73f37e751f6df995, 0x42c7257c4609bb2d, 0x24618a492a85f181, 0x30b332043d173d0c, 0xaa87789dd48c9738, 0x338e08e98f355af4, 0x3d14d02ce67911ec, 0x13526eef2ae1fa93, 0x23081a055a9364d9, 0x791ef50fd26249ab, 0xc019457f10b210d4, 0x5eebbfd164430b06
+, 0x3b2c203d725a1879, 0x50959e7d692c309c, 0x0e312816d2d6f46d, 0x024894453733f0ee, 0x620d6085187b9046, 0x5a3b229fddce811e, 0xff8b6e35ae8d22de, 0x52afc2c3c8b5212e, 0x6f7a38ba98aa12c4, 0x41dbc83af80ac0bc, 0x06752c65b6592d47, 0x6d95ba30a23a4b64
+, 0x5e97608020150c62, 0x4480afac52d344b2, 0xca2df3545444d6fd, 0x2f05208a588bb440, 0x1cd1f8ca1f3c8496, 0x2b5e47c79b3a9e93, 0xe979e5c369cc5d5a, 0x127c10194803931e, 0x84233f92265a9b9e, 0x5bbbaf2266cc9df8, 0x24897d733c867f78, 0x709aa9ea62070961
+, 0xfb3483a51d716a41, 0x5f2d480e3602b8e1, 0x3c2041eb28668c4d, 0x7ab1bc25d1d845e2, 0x29082acb789ab2f6, 0x6673823262dda8d0, 0x82e5c85191258354, 0x4f9215abd498ccb6, 0x5bf63d4e914352bc, 0x395d932ad53ffec9, 0x6e69686c89f79027, 0x3cad197c14a914ee
+, 0x3a131f66acdaa173, 0x748944a67942f741, 0x100e12cbd9c5d461, 0x2b08cdbdab077de9, 0xb43adb7f4bb30164, 0x3a8bbd50668667cf, 0x5e76da49857c793d, 0x5cefabca294566ca, 0x951c88332a2964a4, 0x3c1fcab18add8d20, 0x3d7886e0885c98d8, 0x5bd1eeec5b0d8275
+, 0x6ffa6d00a30c5cf6, 0x44e4d3961e479536, 0x0a758e83b33c0e14, 0x146cd6d694910a12, 0xceb7cb2e09eace00, 0x6d207cca5b0efdd9, 0x7a328d9a097e532e, 0x59161455cdee3f66, 0x9f35df4953f9da49, 0x150b00bf7733e114, 0x762b6c1413eb0a1b, 0x1331f12c4fe12b7e
+, 0x65e8025a57379e1c, 0x17c81359f58a6a2c, 0xd4cd086d55601f05, 0x42e3facf4cb6c341, 0xe1df209241d4ac46, 0x488b93f7bd1d2c4b, 0x220d66141cd4e2ca, 0x7491ac6415d8362d, 0xbd9a3cbbb1305a64, 0x491c7fbebc448ebf, 0x4900a62207ca9357, 0x15184e9f5640e308
+, 0x16ec832c8dd1e253, 0x1ae60af4a41f5c0b, 0x656c4f5ce68a0c12, 0x1d47f396f68c3191, 0xcd49f904aad0639a, 0x3f35e94836da4294, 0xe64ee736ac164802, 0x21e9adee26b6097d, 0xbda0a99b5127b21a, 0x50fde0459e478550, 0xd2c7d14f68e8b103, 0x33037b72d00c3798
+, 0x4407cd87c7168acd, 0x2dbf34bbdc15910f, 0xd1370a845f9047c8, 0x0f0a6f349717d3ff, 0x8d1de038273e13a9, 0x33b69e5af0c76777, 0x8b58656ad053b569, 0x3a3832efa59ad7fe, 0x193031555c282ba9, 0x7a25531932656c8e, 0xa1ad229fd459ddf5, 0x2bd4348cdd1476d4
+, 0xd9a5b35fc733ccb7, 0x2fdb6bd44e3faef6, 0x9a3832020853a924, 0x4784b4f426d8097e, 0x70aad7b350cba76a, 0x23b8d642b9ea4f38, 0x02af4177bb74e44e, 0x1b9b70f9f54a4fba, 0x495897be2c610b69, 0x41d39bd169c6aef2, 0x9d9f3af7d3a11f73, 0x7b3b7c0df77781e2
+, 0xa88ddc1c1680bae5, 0x239dcf53b45efbaf, 0x686aee245a2fb6f9, 0x34f67fe12e2a0ead, 0x28b731da126fe656, 0x42dd29c93edac13f, 0x282bc50a3a53fd53, 0x365167761affc28f, 0x20ee25c7c5ed96fc, 0x579adb216fcd0f67, 0x3c3e3e3e48c9823d, 0x21454ee564281655
+, 0x2ca792cd5bbee3f0, 0x4cfbdf90bda61ca8, 0x77bda89226d0dfb4, 0x2f6b325fb1218424, 0x7688f8af204f8c2c, 0x2995b61f82d2dacf, 0xe4eba5b54f33df50, 0x6d6ff0af382cfbc5, 0x22525b4f393c6a82, 0x07a30614f1f45870, 0xbb84bbe9647696a6, 0x4a80f44ae153c4be
+, 0x3ecd4b44d702b106, 0x7fe6994e308cfcbc, 0xc464fa54262d0d52, 0x5639074618fba5bd, 0xc0873500dedc163c, 0x5b5b2cf6435cc9d7, 0x875692b16bb23d2b, 0x0339653cfea5892e, 0x76d652edf3391937, 0x2303e50f13c0dd4b, 0xc6e0dea98c00dcf7, 0x36ce7a7d691384d8
+, 0x2a74265adf0fa018, 0x21d0bfdb8607d277, 0x30a8d58ea244a8fe, 0x5fe2f04fe9e29944, 0x3f081791cfc697b6, 0x2e81df72c287915d, 0x81ea68b05e08b819, 0x32b01921cb49e0fe, 0xabc6e53d1c9ff301, 0x24467f42c69b54c0, 0x2cb55ad3eb27e9cf, 0x5fe44b6e0bcf7ee3
+, 0x74c7b252a4bef6b4, 0x2f88b4683a596998, 0x0bf0bc74378ee067, 0x0cc12a3d1b4ccabd, 0x912bd345dfaf692d, 0x4482fece8d4f0eb2, 0x9b7c405da76fd229, 0x0c9fd89964829ae9, 0x893c42bc0b44f460, 0x5f6fe79d1c618dac, 0xd286b589e619ec5c, 0x11ee288dff7a010d
+, 0xd5b5a99a5e900241, 0x7293fd29a04a5b05, 0x6727bf1b513603ca, 0x0d10afac93973967, 0x6b0661370efec579, 0x03e0703febc95a22, 0x0b538d75ece57f1c, 0x19e93fd11700a217, 0xb1a73a67976a1c0b, 0x3efcbeb6b561ab7e, 0xac63293f55e6bea6, 0x1582d956e87d6475
+, 0xc6256b406f005271, 0x30e3182227639503, 0x80357b817de099fc, 0x467b1182fc510c21, 0xcdb2fdc53977feee, 0x2564570938cba54e, 0x9437387c93dd97de, 0x52dd2c08d9dfd294, 0x9f3c237749f2de2d, 0x38b32d7c1b96c9d3, 0xeb001f34db28ab66, 0x07c1872b3c6e0ea1
+, 0x54bb1af485256fe7, 0x634b757039078d41, 0x2a66db3e09c71865, 0x0ba4e5ff6aaf5101, 0xd32e8a3706898f17, 0x56e0f2649aaeb630, 0x60879ce42b317cf8, 0x6f590e37b48c1a46, 0xeb98f1f349e8cf8a, 0x707bd0201358e60f, 0xb07eff1ecb135469, 0x4e1c76778d4d3442
+, 0x848cde605310072f, 0x22790d06ad2fbef9, 0x8ddc87e725c4e284, 0x42d60844bccdc857, 0x8ab3f232f7ddfd51, 0x51d50fb2611f9bb1, 0x717963c51cf35ad5, 0x146312f207a29420, 0xe306136db2361ce8, 0x4c7c3b7ec34a5f68, 0x6eef6a14cae316d2, 0x23bc0e00f13c3e4b
+, 0x18f057d3b1478cd8, 0x1845241a7903aec5, 0xab37106769d0c58b, 0x7409357dd2124a8c, 0x23f0b0bf926253e1, 0x25b914f44808330f, 0x3b906d7b997b2057, 0x36f4f1651c0c99fb, 0x866a5b72f7c92dbb, 0x2977aa5b7bc689ca, 0x87d3853527e71e7d, 0x144a0143601dfb43
+, 0x91ad6dc691c35927, 0x5c415a5f845f10d4, 0x1954d805a9a12649, 0x6a406108bd25631e, 0xa48f2bd62ebc6182, 0x730128774f395641, 0xd0609ef1c4c4726b, 0x6bfe854d34fc634d, 0x83d63e8edb3b172f, 0x5681d2f133f10bb5, 0x1f37d54d26c42a83, 0x524570651fd3a4b6
+, 0x40dabbade9a8f8bc, 0x01352967e13ac97a, 0x21ac469d42fcdf21, 0x6a00c7fa19009fd2, 0xb3eb9a2b8fbbfb4c, 0x270235f1a3a08871, 0xa5d9bf4db80fa8cf, 0x0b7bfaaa96143226, 0x4de1267648f15a8c, 0x1043998cb5a9187e, 0x0fa094ac9ac26f41, 0x49d463def26a3a6e
+, 0xbbaba6632b33a977, 0x3981fd3196989f5a, 0xbd8cbc5b445eec5d, 0x79f894ed4f96de50, 0xb8ae04360b853164, 0x75ec7d4fbab3e459, 0x031f406cdfa7db7c, 0x790db708421e7988, 0x646e0e4bf2789f6f, 0x5dbb505b90fe6d4f, 0xb5d76b7edf5405ff, 0x2085c160dfb35b8a
+, 0x9d3538acbf00d12a, 0x4b2cf29faa540624, 0x5a4d3bf383e8c9ae, 0x2a3be7d14e2963b4, 0x124c4a42af9ea837, 0x5cf20fafabd3d421, 0x98407225613e6ed6, 0x5f3852127fb654f3, 0x38c5447dbf8aecd3, 0x1d8bce347e7b7419, 0x3aee545443900f12, 0x36d0b83fcce2d38d
+, 0x1c8efc6a864f0d52, 0x70058bbcf0e148f8, 0xf35de2c2d04b6ab8, 0x1b023439f9810abf, 0xaf07806f0076d7ab, 0x65ffc52697207783, 0xb8b5a31150de0f3e, 0x5b54ab4c1c9a6e7b, 0x240175b97d8033c0, 0x1c75253c6697ed40, 0x5028a4f3ae676da8, 0x6de40ed708eb0562
+, 0x771594a461273a3a, 0x3c7c6103da43fe83, 0xca230bc761cd797a, 0x4f1433f4e13fbe23, 0xb96d4adc6244d654, 0x3b8d4b7c16c63d5f, 0x4a4f7a499b6704ed, 0x3e602333575f53ad, 0xa832096cc87007b6, 0x43d59756f19abb8a, 0xe163f65dac934243, 0x592191ef69ad3352
+, 0x1a9a3c9b5ed96e7b, 0x23634d4c704ceb14, 0x9afd328258949bce, 0x515710d5aa479f5d, 0x932e3bc33b67164b, 0x49d73ed1521a38b5, 0xe303e5063781471d, 0x3e3b83c9ab627272, 0xd342a6cf3d4dc46a, 0x28f2c0eb33bac3a7, 0x43c69a848eda2bec, 0x719aa7e3e2375d4b
+, 0x2cb816690e5bd082, 0x25e4c2413d3e4399, 0xf4247cc3b1db0eed, 0x214100c7bfb86b63, 0xeb08d0d7f1aa1588, 0x69a98cc5df5f87da, 0xb92f5805f396f2e0, 0x79618012ccb5aae9, 0x2fc5471ebe5733ee, 0x0ef2d971ef3ada47, 0x22ce51ae6ba76604, 0x1d1f9b945cbebfa3
+, 0x9a3b13808fa2c104, 0x1e3baae38ad76aa3, 0xc875d6cba937a82c, 0x5a5d7e5afa1f52a6, 0x82e4162715172616, 0x062c8f6ae66d0877, 0xdaa8d0522fa8b5a7, 0x25309e085a83660b, 0xca483b78359abb0b, 0x69f0e7c88d60161e, 0x967ddf5f76882b8b, 0x51a47e201f2d5873
+, 0x0f3c6283e9ad28bc, 0x200656f5ecda6721, 0x2344aea3c49eeffc, 0x37f712bed1b9de9c, 0xcceeea0c833d3959, 0x56abdc4950e5c0fd, 0x3379bdb93fe56d3a, 0x43d2742b47e4c5d0, 0xc9b9435d40332aa3, 0x279ed7b462d81b09, 0x08a3b8b9a2b4ec2f, 0x68666274ddc52b36
+, 0xd5266d6f10aa172d, 0x7ec75c72df9e362e, 0x784e6e4639db3bd6, 0x4100d4918f7c30c6, 0xce3fc9ffe6420ef6, 0x5c5d9caabfda54f2, 0xbacec9ba34da4d42, 0x3920c75dba62ce7e, 0xc537ee4c47ad6b9a, 0x7f55be2cf9c48a16, 0x8cd2be1e3b87d08c, 0x786e07044b17514e
+, 0x5c520d83ca02307b, 0x627a9f5b709cb7cd, 0x4715b718c5e8b842, 0x3e4318b466aa540f, 0x41391a24a0336fef, 0x5b3c67fa4f04d19d, 0x74682e4e3bdf9d3e, 0x29353bfedbf24d93, 0x6fea3b7322c146bf, 0x145a2618194d9ec3, 0x295beb9e89d7737f, 0x4abecd8eb647dd66
+, 0xef94f46a5aa1037f, 0x5ad33ef5a2175391, 0x7db04ae33cbc745a, 0x0f693dc62d4cba0b, 0xdf3f039742a50766, 0x5228c031041e2982, 0xd6908ace068d6158, 0x3c8f441f154198f1, 0xcb62e135d97dba0d, 0x72b31012f3986b49, 0x579f46c10a12b735, 0x65a9fa6fd9e56c25
+, 0xcfc7f251806235d9, 0x4e7603571baae9e9, 0xcf9484544e3b7f83, 0x4fe4a243423a8677, 0xd2c14822e915c635, 0x70967f6d0e81b9eb, 0xfa1d777893fc9ccd, 0x7e43428f7dc33d07, 0x8c822de44552f04f, 0x19285896cbbfbb85, 0x785be210860d2c14, 0x0f02f261a28e785f
+, 0x3b46fff788a3e058, 0x39f0b4c758ea11c6, 0x9dfe266eb07a2fde, 0x2c601adf9b7908fb, 0xb45e9bea1f7b1437, 0x1096fa34f47c5322, 0xbcb9db48b9f1afa8, 0x498870e976bd6e42, 0x9fa52748d0abf717, 0x648ffd57e5d4b08a, 0xd18287d4809fa32b, 0x7772a0c1a2960eb7
+, 0x063d4b1c8db70e73, 0x60a46604bd1ca8fe, 0xa11c3c1b95745808, 0x515df1eb3caaa14e, 0xb652fa0eb01dcac6, 0x23a9ed15057ccc7e, 0x8f57477499fddef5, 0x50b43044da918d8c, 0x49bda4d7ccc45174, 0x09dadb66362317c6, 0x8fa4d48b0b7f1d88, 0x23626375c88d66af
+, 0x6acdd0733eaecd53, 0x04714381866d164e, 0x0028a72d5bd2376d, 0x36ce4b04bc847def, 0xeda06eb5a21ac758, 0x098ac81e84e2a615, 0xcfea29f33fa8fa78, 0x2268605dd226e3b8, 0xbcb74c9eab87386c, 0x273bbbe02b5ed9cb, 0x2d53e12fca470a93, 0x6ba1c99ae7464b2e
+, 0xd4e00d96bb3a68cb, 0x218cd51a781e6529, 0x4ea8444591988280, 0x10b022430b4f6310, 0x4e110725f1603a4c, 0x3cb5a5ed8bf5f866, 0xfa4e7fdedde33b28, 0x322af3f92c972021, 0x39def0e031c467c2, 0x46f1d8607ef0827d, 0x1304ff8adeb266d5, 0x04cb47f6a893d1b4
+, 0x7475cdcc92449e76, 0x6acbd24538257813, 0x7492c25404837d2b, 0x2582556aeec8215c, 0x4c43a61a7537f738, 0x398d48b9e6619a7c, 0x7f8141fdabc47c85, 0x1fabb53613c08df3, 0xa4ede1f9930da16c, 0x484a8a8a6ee50bb1, 0xd38dc372b6b595e5, 0x3c35fd019fb4bc90
+, 0x5606f63a79edba12, 0x4b96b47ad37f52cd, 0xba6140c019ca5a8f, 0x079ffceaf4881610, 0x960a5e3c03025575, 0x1139ec7fb4942595, 0x4ff4d051d8cdd809, 0x37db0da92128d1af, 0xc914f376f8050aea, 0x25354e7e73a00e7d, 0xa0754ffca9e529ff, 0x5f7333ccaf828746
+, 0x2c42a10907b91f9f, 0x43a678f84686344c, 0x56b1a9bd859cc422, 0x2dce5ba18d1e261b, 0xc1c02e0e4c955e91, 0x4543b9ce8321e389, 0xf6a6b5a8cbe9425f, 0x26a7b71145162c2a, 0x5b02a4dfef429551, 0x24f10eff5e8dec3d, 0x6f14e232c301f1b4, 0x17ce4066286a97dc
+, 0x5f05199155709eaf, 0x442f15d70950b7c4, 0x5ca3c4bc24596dc8, 0x2ccb133c4cfdd6c1, 0x9de20a3d02eba87f, 0x326040c6bf489696, 0x601a6b90044ca6d1, 0x16c1b3eb05faf208, 0xd09c433593f6b56e, 0x70e3147bbadb909d, 0x08df6f784a224b2e, 0x5e43788ad1799560
+, 0x6a232fa2df4a68c8, 0x3c1ec888a5393b69, 0xca5d1e0327781303, 0x67198f1cf22e163a, 0x7a5fed4f31f6846a, 0x63f8b0585e2fa55e, 0x6a21eca03fa4e704, 0x71c86b0c79a788c5, 0xf92c88660715a121, 0x5146ee8ae1e0ca69, 0x079cc67e9158d93a, 0x7beceaf6631679d5
+, 0x7eff2166c5ac6796, 0x6eb157005dc9f783, 0x01b8a4ef520caf57, 0x0a068e8879e68ea1, 0x081c780cbe29edfd, 0x4a98ea3964316f5c, 0x32256f7b4c9a70b6, 0x04050e320f71b673, 0x2dca4fa4e30703d2, 0x40003bc25d390136, 0x71a586d4d9742239, 0x14b58655dd77a50f
+, 0xac08e8fb4da1cd24, 0x0a669734d19462f5, 0x27e2064c539be056, 0x274fc60b4e26139b, 0xa593b78f5ea0a044, 0x4121377d467a332b, 0x46ff296872aee8a3, 0x0d4dbd03b7ac1077, 0xa8fee2e915bb493d, 0x3a9d7ef30c6aa2e7, 0xd728e8c93c38f64a, 0x2dac12fbbcdd7080
+, 0x9c4fec727b5a7bc8, 0x0b65e510740b2782, 0x6cd07ca5851e6970, 0x27f1108e0c34f7ac, 0xb2ba9911f21e23c0, 0x5feac5ca0845beeb, 0x5c15d858137f27ee, 0x1d56afdf2cf28059, 0xdf3891e64ce711a6, 0x0328139f4687cc27, 0x6672fd8076a74c7c, 0x743794ec6d0ccfca
+, 0xe9484d37fe4fdbe3, 0x17d2b895f82955c0, 0x91900f689c23643e, 0x63431957f5edc3ca, 0xc87ff8baaf6d138e, 0x2af895b51144bdbf, 0xf32bcdf84302d2fe, 0x2ab99482e6e02fbe, 0xa04b99b843a1fddd, 0x3414e9ef555e2f32, 0xa8d96deb66267d00, 0x6f152f7ba2a2af4e
+, 0xb7dafb1e400c173a, 0x64c3f10a19280d27, 0x608aac08f92cb059, 0x58b8f5d012b2f542, 0x3cdcb8872a1dcadb, 0x62a63f626fa20af8, 0x54ce496bf1165753, 0x35084dd4ed9d0ffd, 0x26d2f179fb345211, 0x395ce21a6ed03ec5, 0x89ccc454a36ea97b, 0x5bd104744b9ec7c6
+, 0xad9d4218a38aeaf1, 0x53b8061a84035f8e, 0x17de798c4408255d, 0x4699d84ded818be6, 0x5837417e6600ccfe, 0x6cf11c0e784c3b63, 0x8a27cb0c172352a5, 0x0a0ec0fb4d056efa, 0x14e325a223368115, 0x06178ddabb834eb6, 0xac6f2e74bf147d9d, 0x11e9dec6cb9d656d
+, 0x57ad53b15a1f91b0, 0x28f598d5de3e77ab, 0xef0cfc015d29955c, 0x6372cd483199913d, 0x592053a9c484200c, 0x5704477ee5416d30, 0x41145be8efb476d9, 0x3083013cd7f517fa, 0xe345bb34397fef85, 0x604c73a964c203de, 0x8391a8f9a60b1ca0, 0x5b734e89e3b67a35
+, 0x19bfa6c31289b6be, 0x2815929227694f74, 0x92d3d8a68efbd809, 0x09e881acf9c0c261, 0xb9a0781496f4e39f, 0x5581ec5611079d45, 0x81ae6edf4b34e06d, 0x61fc67221fe9e4c9, 0x9fff2c972dd824a8, 0x354f0669fd5ae564, 0x56f8666c273fe91e, 0x2f120409683a7c4c
+, 0x150acbc7fbdc82fc, 0x5a2fe5e10109c9ef, 0xb74db2d5b7304a4b, 0x7f59cfc3c7bcae62, 0xc28a6c077d786439, 0x552c9087a69affca, 0x8a22dcca6cce167d, 0x203a5811953747f9, 0x04f424bd7facf7c2, 0x706f3f0a95747749, 0xcf4a500a39140092, 0x6759d3628cf83516
+, 0xb61aaf0f90607504, 0x7425e61e5138f355, 0xc2914464c50d3cfd, 0x0ab314b43c1b2170, 0xe92eb82c565cce10, 0x58bebffc589057e7, 0x2b54939f2f84ade6, 0x2c06ca35fe7f7744, 0x52233e5fca1f7efb, 0x7481b1511bbcc007, 0x63c12ce125a29573, 0x27f3204077794ac4
+, 0x8bb3cd4809f1e113, 0x3f301948a834c2ff, 0x29719e6b3f6a5374, 0x4314c95cc8e8e31e, 0x042578645b80fda4, 0x10df072e1752949f, 0x38f34d21624a7ffa, 0x780dc8ae72073f6f, 0x39e4ffbee81c4a1a, 0x07bec8bb2f1393a9, 0xcfa171d3863954f2, 0x7dc12c54adb3bb6b
+, 0xf69ab92f4dd7fb2e, 0x4b92090d0be17fdc, 0xc22acffc82aa5f02, 0x64006c71b525c72c, 0xd7f54375182c6826, 0x32fc2493beec7622, 0x5e61e6d21d41bdfb, 0x119e7c07e84179dd, 0x1229d279cfa58904, 0x2571b1158c796f38, 0xa6ca84dc03d8f2ab, 0x4b492f7242fcdc81
+, 0x4f48f9b87981954e, 0x05627dcee5723768, 0x03b8433c51584d31, 0x70c297e86ec6276f, 0x177472f66c3aa842, 0x31f52b8fb6dc9fde, 0x9952313b4d08d75b, 0x4de8e318fce400e0, 0x7e4777391386ce74, 0x123c11f5928b472c, 0xc134df88074dcb25, 0x6a134e1cf1de3426
+, 0x30b028d872cfd935, 0x1f855de0f1a3087f, 0x7dd599e75baf910b, 0x35fd1d74ff7e3e3e, 0xe705ca4f409f1c99, 0x4ff01c43aa040784, 0xa680817741aebcd0, 0x53047c42ce85ea21, 0x224119075c5c0f77, 0x7a85566aa2d7a604, 0xf92fa88b47b4d8ab, 0x2d6d06a43b961043
+, 0x9b61ae26a9180c09, 0x1cd7bf61920d2874, 0xb6a11464bea3ec1a, 0x0a512d307419cde7, 0x9f27a92d2883d969, 0x28b2e73b611edd73, 0x03923b10257326e2, 0x059098af58d56cee, 0x6e290ca71a19bac6, 0x7869d07dad458535, 0x30b889af6ba9e701, 0x14fccc56644b895b
+, 0x583f264eb0fd5d43, 0x140e8eea51ba3a85, 0x39a2d38c7e23ba66, 0x710b180d0dc8a397, 0xfe612af9534b5d10, 0x0309fb1707c12940, 0x37921603e172c410, 0x1d9f14dbc709e675, 0x14a59573c1f3fdd5, 0x071360c44b4f5ae7, 0x518e10114d15f6ec, 0x7b1e4de585a07783
+, 0xfa26b91b0dd0ab3f, 0x2b5139d5d48b87fa, 0x7b9899213ce898b1, 0x1e2d051c0e975e69, 0x0fcde1fc0cad9cc3, 0x3bbf1d7c9feb8af5, 0x26b36529b9bb719e, 0x1eb40acc44cac453, 0xe543b84570adae57, 0x4f012e94b7e8017a, 0x3618c6c7f63d8412, 0x7b97e210506e2089
+, 0x333ddceb36d3ab00, 0x0539e29df384edb7, 0x724a11c6c83c3712, 0x0cb2927aac2060ef, 0x0df27015eb3bc329, 0x343cefc361dad1ea, 0x5f2135cbc9134d86, 0x350dcf743b82d6e3, 0xbfb52c8f86c78aa5, 0x3f81273a8af0f13f, 0xee6c9d80581571e5, 0x0da4ad00bc82cd3b
+, 0x70c878cd04ef399d, 0x10bdc31458ca76f2, 0xec4db12ac7f8c70a, 0x2072c598cd88d3fd, 0x920c4dee92caeedb, 0x661c16467e84ee09, 0x3fd4e602df3d05a8, 0x24335a3be1564dd9, 0x8b037b324c1e98b2, 0x371ac8b28c94b01a, 0x24ef4520069dad68, 0x247cfc7a710158da
+, 0xb0bb04e386fd846f, 0x2b82119ab6b146ff, 0x6268613cf547be61, 0x41737c8376fbb15a, 0xcd7aad84382dbcef, 0x284c49eed7b6faf4, 0x71ff2b402b7ef93c, 0x64c938868a7a7bba, 0x39e16c5d7d59f525, 0x1ae05f85891727c7, 0xb7c4dc5c78528fc0, 0x4d7bff60b293891b
+, 0x856c781212bc31c0, 0x3248ea6e87136b25, 0xa2e80ef2f722f684, 0x63f66e144b5fb9be, 0xdfcabe46f75df570, 0x79ef7e3c8364c877, 0x974832bc31c5c416, 0x400366a6ef44b00c, 0xdd08b2c3f6f78afa, 0x7b9c2f2c16957368, 0xef3211569fc3dbae, 0x3cf929521f08f035
+, 0x3cd56f04c591fd0a, 0x1d29c9142bc8c4bf, 0xf15e6118f8ea7f7a, 0x0a59153e17d714f5, 0xdd742a649b5a6f3a, 0x11c7d5732272bd73, 0xda91bc456cffa836, 0x158e656f6a7c7988, 0xa97924792040218a, 0x56bc16fbdbe83f41, 0xc8c42e3182afa814, 0x14689fc3eb87503e
+, 0xa18ff99a49aeb265, 0x4e1aea0a17a20154, 0xd93ae43dabba1251, 0x6c1391967153c76d, 0x5890d1ee450504d1, 0x7e1d59805dc986df, 0xb0063fc5dcfec273, 0x4bc0b28973473276, 0xadc36cebd6386e58, 0x3a4bfe72ca5f7901, 0x864c6ff2b3195c22, 0x51a7d7b8c3df4f9b
+, 0xb647830f02a29d98, 0x3ad07066f48fc054, 0x3e27f883447e7cf5, 0x5c4c4431b2d8077c, 0x4d4c2c248e4d5f59, 0x1e3e192167b2cba1, 0x5246834def92c068, 0x79d6e3b17fc17509, 0xa709487a39e9daa2, 0x5d006fbe23ea1beb, 0x98173deb40c6b793, 0x7a2f447c724c4918
+, 0xb06c590d4ec886ec, 0x5de372243038cf0a, 0x17bf817607435724, 0x2f07417d538b1434, 0x31e1fbc6d3470f0b, 0x7d815311ac5e946e, 0xf9be9a60ecac393a, 0x05d92490799a6ae1, 0x16205bc8d6443bc8, 0x1ef72341746910d5, 0x923c13c35767ad85, 0x4bcea1dc3b941fc8
+, 0x8c95b42f0829b5b9, 0x3724b8d23d4086ad, 0xc4d0e2f5c3722b58, 0x4dc350eaac17ca2b, 0xe911be1f0b815e30, 0x60688819f69f2470, 0x7639fcdc670d5ebb, 0x102b7cae5e1ab12c, 0x8d2b9ed59a116422, 0x4174c5381d3dd303, 0xa81eea9e5cf19945, 0x0993389721bd7bba
+, 0x4e9d228ced658c86, 0x416fc5878129efc5, 0xdc96ab3e4872c36d, 0x5a3dc1b1146df901, 0xce0118e89bb59b34, 0x71256524ee4ea949, 0x682967a477e77249, 0x187d56efe807d35e, 0xb39718e730a7ee21, 0x6cba8923fca2342f, 0x2f9b360436f7e815, 0x32d2ffe22b0a8a4e
+, 0x26c3e965c4fe1d2d, 0x31741e33c1d50b7c, 0x9f031b30fd64f0c3, 0x5ffbaa90782d76aa, 0x1d9a49a8b62380f9, 0x31a0869c06e8a7e2, 0x19cc60dd1eb8171d, 0x6d28b5fc77f82313, 0xe409095379da4319, 0x229f0efd2cda03b8, 0x6263ec6bb1ed6f3f, 0x571c553fc3fcf79a
+, 0x838acfcd030beea5, 0x03499c1f257d00c6, 0x0f39a5ae279cd90f, 0x405a1b305f848cff, 0xeab21da74b659da3, 0x4702493f81cf3e8a, 0xcd3e811c9397960b, 0x33a306f63b59068c, 0xce46ad87a9a7e9c9, 0x327fe8b4578051fc, 0xf06493e88c0c7a24, 0x6c5940c78eb99eae
+, 0xfdbd5c76590565e3, 0x7cb29ca3722c8de0, 0x6ce1376daf216707, 0x5a5089b309d1ce8d, 0x5dc5cf7d886e7af0, 0x273f2e94bccc0ac4, 0x5bdf478f71731b41, 0x3d4247baf258902f, 0x940a4b03a4a46d1e, 0x593b478e114a1d38, 0xd34e49bb0484762b, 0x5f7ec57f91104af3
+, 0x265dd4d83461a776, 0x518e7965dc64c296, 0x34589cf56ebb9296, 0x5ebc36539142f970, 0x99d969859064bed2, 0x1c15d165ee186333, 0x4fd6e6808801bc75, 0x4d7951c613e7cc29, 0xbd2f709ba07deb04, 0x26c7bb8967dbdb13, 0xc96ffe79a07a93a7, 0x5568d0800000ec8a
+, 0x5a2bfb3d0d7c5618, 0x381f7afedc6390b4, 0x82d598c1945030c7, 0x4355f44e0903cda1, 0x2dc46e4374bd8905, 0x10739888e4f91947, 0x2d35ed148d509a00, 0x108fe50ac977fc5a, 0x21b40ffdb5a1410b, 0x510cb24774f171aa, 0xc87bfab1e0c5720c, 0x6aaf76e70c4e8f8c
+, 0x1a0d2876cca1b24e, 0x549d85bafd5f4008, 0x2163110ce7ee057e, 0x42f57f474877dffb, 0x26ae54fb47d2afce, 0x6b3abc566a8f1bfb, 0x0cb096d82247376f, 0x30c1265c45106bbc, 0xdf01bb3c792f74f8, 0x23c8912ef93a014b, 0x59bdbe2d1a225191, 0x59c0bda1fd259646
+, 0xd8d338f2c988787d, 0x2ceebd6acbcc82f0, 0x5c0da37976ef3fae, 0x012414481c5ff0dc, 0xaddaf128139b228c, 0x1936a4199e189b42, 0x8355d214b7d86d07, 0x45dcd346279b21be, 0xbc75f29626e1fd33, 0x4e6b87384f97d79c, 0xdddb58e4f37c9233, 0x1bcb9f0e1e363b46
+, 0xd714211b6a6d6bda, 0x2f6d96d8b63bf4fa, 0x580f4a1ece1814fa, 0x6d9b72a7702dce6a, 0x7c99db0817df5b44, 0x70e5ab82c9d57bc0, 0x12b266ba406e2285, 0x41deeb33aa449fba, 0x322c332e423c593e, 0x345809bfc8a5c43a, 0xe59a975d2087db1b, 0x064858afadc632dc
+, 0x340c233ee7a113c3, 0x0d1d39a1cb489220, 0xc578a836eb686419, 0x4e29f750ce20b7e4, 0x69a05eca7ef159d7, 0x3d8cd689ca2e7f84, 0x6b67f6c92ba18ba2, 0x4328193331d77513, 0x0de01ad400b950a9, 0x537bea46f3c7cfce, 0xbbded244bb343161, 0x7dadb89f764e4ace
+, 0xc962d84ca46859a6, 0x4357d578721c5993, 0x7f38d015a21051a0, 0x44f6b144ed037d24, 0x6d788aac296a190d, 0x0be74a4f93e36a2f, 0xfc3c02374ce39496, 0x3da4961f9bd30149, 0x2a2aae3b5f3f312f, 0x7daadc1ec7db645e, 0x0d58ac686e26607b, 0x430003e5845736fc
+, 0x0a43bb45d6b64301, 0x55ed09b6a6d67251, 0x929f04c863d8ffed, 0x6e2524ec10d4f29e, 0x995b5c808ad37e8d, 0x4b330fb7e57b30fa, 0xc18aa16604dca829, 0x2a1f4c4ac5937869, 0x2463cb97877a3525, 0x295887a6fed763e3, 0x93056c3f52efcd9e, 0x059386921cdee89f
+, 0x83085891e70eca6f, 0x1b6f6929ba213443, 0xae877c5f00474b6a, 0x594de5b450c2bee2, 0xfaf77f7dff8f852c, 0x3fb589e10f87d86a, 0x3d4add08bd276392, 0x081eb79568e0d0eb, 0xdb488e76c524f4c1, 0x08b965b53db2dfe6, 0x71a8cd3f76bad4ee, 0x4fc66bb79327ed74
+, 0x0ffe30d7fee55de5, 0x70bfe4c6590c454f, 0x8cef675d6bd6860e, 0x087cbc36081bc39d, 0x613dcdd0d2a3a2e0, 0x55a1f09b8590c928, 0x261637637c3d8078, 0x26a5d290f544240d, 0x0472eca0fa6a11a5, 0x11003d1dcda25b4b, 0x20209535657ad0ad, 0x5cbddfb4cc77897b
+, 0x66c6c03683ef7b71, 0x5c74b71e856e0728, 0x913d9583d9946069, 0x7a6f2326ec786d1e, 0x065a08282f4f9dd7, 0x32a8c2a579e69c35, 0xff20ef8442effa25, 0x119e7be71dcb7ceb, 0xc438ec1198857927, 0x7399003f5b1c38b2, 0x6acf8041960ef3ad, 0x38091a898f4c743f
+, 0x233ac75a2215896b, 0x0e80fe374621f75e, 0x8269849263c2e11b, 0x64cec9300cda17e6, 0x92bfd7ff9a9c572c, 0x61097d2bb2487b1e, 0xcbf035685cae7034, 0x3f25b58d12729899, 0x4aa1435c450e97c0, 0x116e778e784ab955, 0x359632239ac12b4d, 0x29689fd900171ba6
+, 0x0c424195837904e1, 0x305f2e4069143902, 0x31bf838a25d52239, 0x7874a7e3050c5c9c, 0x646429256aee0135, 0x7fef38fe8db3ebb9, 0xcc78dc8fd5eb3d4f, 0x4252648143f71c62, 0x4403e81d13c8d6bd, 0x18414dbb96c73bcb, 0xbfc339fb2021a7ff, 0x7b5de53fd6e00229
+, 0x054e4a3c2a8ba76b, 0x31d30e83a333a0ca, 0xa5154036efcd906b, 0x7ea850a4f43e172c, 0x3209a79b0bddaf61, 0x22f11b5b474cd695, 0xdec4f6321dbc1afe, 0x14752848e7d2dd7b, 0x7f0664d31c303891, 0x39c575b8e50d0cd0, 0x81461f2df47adc1e, 0x7e4c647e68069256
+, 0x1679654fd5af05fa, 0x31ecd714ad2e7bdc, 0x63f6cb2743c13cdc, 0x01f173f778537b7f, 0xe5e18389589bf850, 0x569b5ac0be02d930, 0xbab2caf9e723ceac, 0x39463c68dcc11d28, 0x5750c85870e35f1a, 0x1098e7aa812216c5, 0x1508c80fb22d25cf, 0x587ff40d5939f293
+, 0x1ad5d04baee37703, 0x1725dce507948291, 0x0f292521643a3eb0, 0x086bed64b587c220, 0x48526065581a13de, 0x0fa0d127d2b37752, 0xed292160d90a74bb, 0x2c106edd0b736adc, 0x5e340e2e558f3c5d, 0x7c577d93c315b1f9, 0x33743e736a6cf2a8, 0x4c24b91e4358ae26
+, 0xafc63a16e5603c0f, 0x28279e8a0b10f429, 0xf97da6ad3bd2a2cb, 0x7083f0688f0a343c, 0xee646f4e78cc428f, 0x415b93c16928d3f8, 0xbed868ff20610485, 0x2c7eaa3b07088d8a, 0x2751c9eaf52b7933, 0x4587c0262fe6fd15, 0xf1f394586067f288, 0x5115806874ff1b03
+, 0xbd2e5553c9ec57ad, 0x1cdb3a866e49ae40, 0x3ed055312507f28f, 0x2474a2a3eee79de3, 0x216da5fdc9a28440, 0x3935f9d78d741e1e, 0xa870d0556d6ebd2e, 0x7c8b0a4ca2475faa, 0x8271836ff6374c6a, 0x792ba4e86a54a492, 0xeb41cb6371cb406c, 0x3d424b27e35b3a4c
+, 0x9da6556742f3cd6a, 0x279c27759e832c98, 0xfc8c3e9dd011438d, 0x68193080900e0758, 0xacabe0bcd34ed000, 0x2acf1b381b53bb4f, 0xdd032387e0de706e, 0x548337a03b077588, 0xc26d24f1ed31fbb9, 0x7027e9e6fa9316cf, 0xf0bffa8ee45848ba, 0x2fbe917f8f46492e
+, 0xd1395f80c85f6e46, 0x10387c2784c5a919, 0xa480c5175c4c5598, 0x4de6a044e0152653, 0x19edd2038630b0b9, 0x2c93c68a261c96a5, 0x8c4e98efb7e70dba, 0x27ab3deac91608d3, 0xa476cd34b8c4a380, 0x4a9b1b8cf42b3de0, 0x45a4a6e1d9bb0fa7, 0x4e8dcbd3fd56f307
+, 0xf245ffec2ebef3aa, 0x07ec15a540d74cf4, 0xed7ccb38d49d2a56, 0x709a18bc584bc8a1, 0x19235b9e7e45f30a, 0x7e40b6b084099e1f, 0xcdefa9e601458a27, 0x34763381e6c27d8d, 0xe1d8ff7a6d3f1659, 0x372f229b93d7404d, 0x196fee581b580da7, 0x09996950e1a273e8
+, 0x530da0adc4126378, 0x78a936733c423848, 0xfdb1daf6377e85f8, 0x177022386673fe1d, 0x22328acb64e23719, 0x0ecb42b8498c7cac, 0x1ee6dec866a23b83, 0x4f316404c8ac32f3, 0xc42013634621894d, 0x3cfc63564db3814f, 0xeb3ffa11ba146cbc, 0x5728b12cd84b21c5
+, 0x861e857aaac52037, 0x14a8894b3cfc830e, 0xecc6ed81fe737651, 0x1a7124610653e3a3, 0x425433d9645fc145, 0x4db9249cd568aefc, 0x8629100b71bb0133, 0x6d9e6a8fbf5057e9, 0x3f839e599f095fe7, 0x25c738d313bcab30, 0x9ad5648cabea7654, 0x151865c42a2c514a
+, 0xa34a8542a1d5eea5, 0x08bab0caf471e0ee, 0x26db9e4596ec19db, 0x5ab0002f0358405a, 0x22fb92c4e166503a, 0x5def417c167b76c3, 0x8788ea02c3fa19f3, 0x4d043b6a380efb10, 0x2bd7b82e6858939e, 0x5c44c14aafb92023, 0x082558f58ba7016e, 0x1d3b615ebf57be02
+, 0xccd3558a39a24bd1, 0x7cf135a7b9e6cc21, 0x54556a5821dbae32, 0x64a1c56b8f58c5d3, 0xbb1b29eabf48a3c7, 0x062de4af0ce07316, 0x48335ff89ebe6529, 0x7f4aeccee0e3f5d1, 0x50d684efb7a8b5ad, 0x4740a4ff3ca7088d, 0x643bc86f0f32de6b, 0x65de3a0aad59374b
+, 0x843eca66b31276ce, 0x14bb77c44467d05f, 0x8c852422a826f9ec, 0x2b079e33c7c36418, 0xbfeb546b3e8920af, 0x4b611ed1c05623a3, 0xef08b6ad45c856e9, 0x2c605c4074fd52bb, 0x998a3f3aa0307faa, 0x053d9414f36c8a6a, 0xda430f0b3c411aa6, 0x02ab36c84366e6f0
+, 0xdda5ef86c6b2c8d8, 0x5d3d64f56abb1f93, 0x4e6a3606d6e3cbee, 0x63c6eebb7e98f4da, 0x3933fc4419343d14, 0x22617bdddde80b64, 0x8b95e003e69621f3, 0x20b9dfb521f3a689, 0x3ccc4333e1237a01, 0x036a4a5cc252ccd9, 0x284d40b794d41d9d, 0x03be9743919ce8db
+, 0x4c16532ae59bb222, 0x0ec7510a9feebe29, 0x469b1b8176810829, 0x4e93798cc1355f3b, 0xc29d8b1739f9a2d5, 0x5b30d1f21aebc0ef, 0xbbcc7bf12efa7bc0, 0x79a1639010822241, 0x335cfc50bcecbfdf, 0x5dfcb5f1e984462c, 0x22c3029ce7db0c4b, 0x249cca758d7e1650
+, 0x362e83d786dacec0, 0x64bbd2b389bd57a5, 0x84c8752524a644fe, 0x535f4f067dec913d, 0xe8c302324ba9793e, 0x18957c201b871741, 0x48fe233a6b8e7788, 0x07504ebe3486b480, 0x8403d8aa373a8242, 0x0c845625d6174fd8, 0xc6059513dbde3131, 0x70ce15f26707934b
+, 0x0a51439673656c6a, 0x1842b8635d81bc2a, 0x7f90950920950932, 0x196b83ae5ae13146, 0x7c090c1a07d86fbf, 0x19d479bd8d5e6da0, 0xb7fbcf0ad1dffd29, 0x5a6bda4d5469e1fd, 0xc8345638c56b6cc1, 0x37ff936eaaa31305, 0x9a86bf7308ab7314, 0x05fd39ee290ca592
+, 0x9b8faed0e206626f, 0x36874ce534a544c2, 0x53d30f7ffc0e5354, 0x7edff7bb0389461c, 0x321c781b4075fbbd, 0x258158f35a6d06d0, 0x03eaeba905795afe, 0x4ac174c89d3cff97, 0x793f20bc289a1820, 0x592356d2001ba34b, 0x9a538786307c99f5, 0x597f30848f6cf49f
+, 0x7d6e1e01691f5612, 0x02103b5cd320e027, 0x62bdc85a6809032c, 0x16044d077634a47d, 0xe038e75e0bba8d09, 0x61905ffd45d053ca, 0x7b2523cc74e3a143, 0x3f8746053bbfe7ec, 0xba616b862c0d6619, 0x5000b3789d533065, 0x079d5c055f06922b, 0x6935e066f730d606
+, 0xb0b7ef3b7de2dfde, 0x1163c3ed79303a40, 0x5dc8108a73c22799, 0x3b24eb0e26342518, 0xe2fde4b8267dfe45, 0x3f714e961fcc2002, 0x674b1bd9a7341a60, 0x52ed1fd62f766e01, 0xcbf0d442af91850c, 0x7af69d740a3981b9, 0x5abb2800b575e31f, 0x46179ad385da0f69
+, 0xd0f980ac9f7208bd, 0x3815476d2986bc02, 0xe5c1384cbdcf5d32, 0x1af4f73dba459507, 0x881eb9f9b4731897, 0x440d636040564b4a, 0xcbce8d66c3f7b4a6, 0x0e78c6b7c8f59c08, 0x0fedb24300f9894f, 0x0919ef224effc09e, 0x852a2172c7a1dfe9, 0x36a29c364be071f2
+, 0xc6faba1307cfc92e, 0x227fdef28781cafe, 0x548fddfe567785b5, 0x6fcfec76087fc021, 0x44456d2dc8cd6cfd, 0x194d951a27536193, 0xd8e37fbc6e8c3977, 0x5bef29f884529eb7, 0x6194965e0429f2de, 0x297e626546df2707, 0xb9bb3ad6b2a5b973, 0x676c96a677b70518
+, 0x72eaba6edfbc4c10, 0x4a04aa56c1a50b24, 0xcdc89b393c1ffb06, 0x404689d27ffb247f, 0x4cb20e95de1df992, 0x6218d9634b26c4f4, 0x8cd6f743643de3ed, 0x4fb96737f99c0b1e, 0xea716139a907be12, 0x32f8cf4d596e9c46, 0xe11ba226499dc44d, 0x6319ee79adca8925
+, 0x9329af41e73e7937, 0x55ec16bdcc341e03, 0xd6873ee4f44c7799, 0x77282822096957f7, 0x0955b96906a7e8ba, 0x57be37c3bc20e467, 0xaee772957f295eab, 0x0d43631ce35c61f1, 0x9b9dd0907ed5c8c6, 0x41943eb15f62cf9e, 0x99c863e8c6d4b686, 0x7a67577898694895
+, 0xc5db5e22afde12f8, 0x2de7c7bd2bc4510c, 0x909a3b98873eaaf0, 0x1233976a9a283eb1, 0xeb9d81da05c7e596, 0x2bc3f68e100e5292, 0x78a4a3484cc203f0, 0x27e549568f026237, 0xa993e2dba9bc6b26, 0x5e23dac38eee8b31, 0xb4ff5570625d82e4, 0x7b08697e0181725c
+, 0x93948336dfec86f6, 0x2d7e30d1366e3064, 0x544198bb87ee4f4e, 0x485f901f3aced4b4, 0x4eb619d885a4364c, 0x33931225c3e10214, 0x7caceafa684ae851, 0x4569b36c6d988faa, 0x2ee8333cf7071814, 0x1435ca31e3e880e8, 0x2414557c81121c1f, 0x45ab58e699203eac
+, 0x0dac03b26a9adcfb, 0x617fc210194ec4dd, 0x35b2d2de4ddaaf53, 0x40a0f8458e246f2d, 0x8e4e0ded281539ed, 0x2193f779a03ef7ac, 0x4f2a366207db9274, 0x7f57199ef3a60601, 0x64c64c83306464b7, 0x637a924333a69120, 0x8f9272f0abb014fb, 0x0da220721e9f4476
+, 0x9beb46c2c2b20b58, 0x1713305c61a83a44, 0x2f37824a930d1010, 0x75f8f03fa8b22dc7, 0xa759f5a7189759a2, 0x2ba9f5c20f8628d6, 0x4d18576aa1d9979d, 0x47318d8299bfa344, 0x1dbdcebe8241ac66, 0x36a450d309311212, 0xb25ded41e5e6bf4b, 0x56c051acefd474ac
+, 0x15116d75320c62c7, 0x6e75c9b676050396, 0x800569a4d618ffa2, 0x71fc0b33b6a1de6e, 0xaf930a0bd11f593f, 0x0069afc4f2621a9b, 0xe61fefac9b11071d, 0x36fe11c8cb806dff, 0xccf762aac04d1489, 0x3251f1c7e5e6ae2f, 0x8b542eba5cc7a5d9, 0x7b36b88a5d7bee26
+, 0xf40fc9b2b394e89c, 0x1d273397c0207c40, 0x60d5ef43149e306f, 0x2d6bfcc96afde3af, 0x1bc850c48112dc1b, 0x7cc89493a3771438, 0x9efce70e9199f168, 0x7b4665dbadc2c420, 0x031d35fd801dfd1f, 0x321fbc0e0f15f564, 0x481f5cc77ba4f6de, 0x442a91b90a1d94be
+, 0x2a8dd0e6fb5c7864, 0x6256ec3860f718b7, 0x42110b7c78834964, 0x17f94380c4c229ab, 0x291f89e6805d217f, 0x0f16034cb403caf0, 0x316a87bd2a5bd814, 0x4d566f80664e846b, 0xc3a181dbad9dc13e, 0x4bd83fd58e0116f4, 0xc1c7cf62036cc395, 0x4a3bb553d2514c2f
+, 0xdacc3e9538a62cfb, 0x6525cce0d7ae6a64, 0x01ccc675f98512ca, 0x741eb473a1e3a79a, 0xec9bea25d7b8312f, 0x2d6599de9a3439c0, 0x774c8ff8af394653, 0x4c5b7cd77a625149, 0x62b105845df21193, 0x4f76cf5c8c4f24cc, 0x6907cef230030182, 0x17fef4a1b8d16615
+, 0x5fba85654dc15ed7, 0x15124ba6d29f6667, 0xc1246a184a266b18, 0x03e7cb2b4368a5db, 0x88168fdd81e9c063, 0x7bb09b2bcd8eabff, 0xc64bb409e1f89d24, 0x58f6c368590070a5, 0x5439839afff56d20, 0x4019c0d51f44583c, 0x8fd936f62bf4d5c2, 0x6feaaa0bfa0e9ccc
+, 0xa10b18f29d15c683, 0x76c6eb81056362f1, 0x1b3bdaf1ce44ca46, 0x3f1d89240b1a1ea2, 0x1d74a1f9158a27e1, 0x1a54ee153cfc91bf, 0xe2c04c1cd0052989, 0x1a4c463408f5455a, 0x8b05db3b491b03c1, 0x06d78f5c8a2e1a8a, 0x6885d2cc00b48059, 0x412e1e02ee40b530
+, 0xf432d009413e429f, 0x231c37a55ee5edf0, 0x68595fd6c88998dd, 0x2025f7cabffb603e, 0xef6343b5f3e6d983, 0x40a98b2b412ab2a8, 0x6f9ba57ae3b4062f, 0x28d4a4ac3245fc19, 0x31f9877a0bc72a3e, 0x50c2d29c80678cc0, 0x379db883acf78c90, 0x6697c51aca8db6eb
+, 0xd2c7197def4b27c9, 0x13c986ad8e0d911a, 0x49360707c9933d8b, 0x6a5db007891cc793, 0x4d95453b26b7420a, 0x35f4bb0029b640ef, 0x3eba6644dd5048ca, 0x13b9c7caad1fe84b, 0xb2f78ec5d2f253ee, 0x74128da8adb27f88, 0xd1686948ec32ecdc, 0x27f15d0bd67357bd
+, 0x5aa69ebd00fbdfbd, 0x7e666ba19ac8a709, 0x99eb49b8ac0f27a6, 0x6757f0e8af2c3c80, 0xf65074ce23f789b2, 0x37c15fe3a767bf37, 0xc179ef84a43b6ac4, 0x2216b65a786636e4, 0x722616fdd840bc3d, 0x1085facd4535b212, 0x397d6f63798e1ab9, 0x799df1f2857362fd
+, 0x45e344b0ba82a814, 0x71ad78ea7cd22450, 0xf875cf55d45129fe, 0x34f00e215df53dd0, 0xa015278adcd96f31, 0x23c0595af0e45299, 0xfc2706989e2d1e8e, 0x2e3ec5437d5ee420, 0xede6e58792e7a519, 0x2de644e6f1002730, 0xb0948c193f0b6a2a, 0x73c6e476ceb4feb7
+, 0x40d3e825aa32ef26, 0x18bbb7ae5f27988c, 0xe5afb2338ef6fd54, 0x053653beb15242a6, 0xaac6e364faea2aac, 0x51fe23b56d00a141, 0x2615cd069db61859, 0x7d70dea0bff6cb1c, 0xa8f2eb70ae84ad6b, 0x5b1778d0cfbc3597, 0xf8ce82aa300e2932, 0x0066ccdb9f55f00f
+, 0x43b931861629d2b1, 0x53e88d5fcf3b6682, 0xc8b462bc6a6cdaf3, 0x01cf764eedd393cd, 0x66ae2370259e7021, 0x1f453db67bb932b4, 0xff6bc2912ebb3e07, 0x06c56be4d85e9bad, 0x94a1ba7d1b74ff52, 0x4e56fabb309a7391, 0x86f46b3ad6460f56, 0x2305d9e555f17f44
+, 0x8b309ae97be4cf85, 0x4098d6b0fea73edf, 0xaf927bff9bf32d62, 0x049963648308a918, 0x5a7ef9ae9e3c9689, 0x4de556fa74cef725, 0x32bc765b63d52753, 0x52e93202ad1c30f3, 0x8aad3b3bc066dd87, 0x3431d9bf9fbb6e11, 0x26556705ff12d625, 0x205f67626ce0a369
+, 0x4131ade56e831905, 0x0cacc746a859b129, 0xebfd9bc9554728b7, 0x10714a7ce31fce82, 0xbf53c72054a81313, 0x1593e5e7fa3f64a9, 0x8d6a3a7e6ab472ff, 0x055335b97c7a1f16, 0x29f77f0b5018b915, 0x7b30d66ef7017def, 0xec8e9cfc390d9a25, 0x35a2957fdca9c145
+, 0xa2c9bd92b1586fc6, 0x6c4b7eabba91d165, 0x475b815311d24e24, 0x2f76bd8cb1fb76e6, 0xdfdeb9e68f95b8b3, 0x1f81884131eaff46, 0xf4568587807326a8, 0x52b9f8bd45359c78, 0x9df89716ec9a2271, 0x2814f6c12a2d1021, 0x23fe158f9745db35, 0x75da0f9d8783b12c
+, 0xca10828a37247ff1, 0x298a0fbff668a029, 0xc89ef9ba62f50eb6, 0x17812dc4d9511782, 0xd0a01938c3597c42, 0x4151752893cd888b, 0xb20dae6fde53ab57, 0x5618ad1abe8deee7, 0x0127b46de8b4e12a, 0x3fa26b942b5183ed, 0xda879deea7a60b1c, 0x3c900c49a1459ddc
+, 0x582bcc6cc0666950, 0x1084ddd9a51d934f, 0xb0d9ec6cb2fda7d6, 0x185d57062c37a6b9, 0x2eaa3193aac6b000, 0x6c4f023b6f86413c, 0x1c6d95469524fef4, 0x235d8dbe9e943171, 0x074be0bf7bba3853, 0x2fe668140799ad27, 0x42f08a2a3549966d, 0x735709b21d187ab3
+, 0x886ca91dfd5241e1, 0x418a9db4359a8c26, 0xab049b55a32b4e1d, 0x6b542d8a0dd433ba, 0xb9798e643d211346, 0x782f1834db85ac48, 0x4fb5285a5c9415bd, 0x1352ffd83b971e82, 0x01dae6b531a986f2, 0x44f0db3f33787afc, 0x7df99d94baade360, 0x76a010ee1b245307
+, 0xac461c07e3c882e2, 0x633965b064ec7feb, 0x05070a8f6e8aec04, 0x7ae172353a4c0025, 0x4b8fcc9f63f3979a, 0x5507ae6a8245e5d5, 0xb3893d297774497b, 0x735624f0eea1c16f, 0x6cf1562f91d6e002, 0x7f79c65ed5deca16, 0x4cac605b2d79c2bc, 0x5d04676a3aea2d8c
+, 0xdf20b467129c9c8f, 0x5220237e2897e212, 0x3cade2ab0f24ed8f, 0x62ffc24ebe07acc5, 0xf5665180e8069069, 0x774e4f59500d88de, 0x96601836d1b02a4a, 0x4cd55fe4146d6c05, 0xf0059239444f328c, 0x7a8e27afb65caf01, 0xba8f59d38770c192, 0x62b47a27b29e66be
+, 0x7375eff66d58995f, 0x33a1538b649f201d, 0x4119589a6d5c6604, 0x425670ffbdc3f388, 0x26a17404a7a620b2, 0x29a97893a541d56b, 0x47f2ec9719eeab1d, 0x0017294fd3bed256, 0x1e632d9ac7eed442, 0x3db52c2a3c42333c, 0x9e27ca934a8580b6, 0x153a8740ea739970
+, 0xebdf33d54e631a62, 0x0ebb60b44ac35f9a, 0x36782b09489b2a97, 0x59d812c06f40e959, 0xb1a93d006224a286, 0x708558bb676ccc3c, 0xabd469be7dd11a5a, 0x5f0d5e6742dca562, 0xa98f886f4f2fee9d, 0x09949327f9eebedd, 0x94e8e94055e9d169, 0x2214d22bca5f13b7
+, 0x3c26835b7d745584, 0x5bca5cfe4efe97c9, 0x22373aaf911707ea, 0x30d6783fa66681a0, 0x1855ff3501e36e3d, 0x3bd6dd9991a6c052, 0xf810a2029280695d, 0x39c5dc0ccf7fca4d, 0x872eef2c931dc5bf, 0x2d1dc7043f9ef58b, 0x8f20afcbb0471d82, 0x2cc74b8aefad1284
+, 0x391d2a670452b6de, 0x32bc81914fd347e9, 0xee683937be2f1b13, 0x255cc61509e4528b, 0xd14ed7df57964fd2, 0x0e0e7352197ef1e5, 0xb7b545273925d021, 0x6d096167371956c1, 0x91f32cbabc50624a, 0x593746ed5130cd4c, 0x99e88b3720ea6d9d, 0x479f704e892a94ba
+, 0x4ceaa09ca8a9bdb4, 0x055728dee383ae52, 0x4a20c48a0180a8fd, 0x0feb7a88277f7751, 0xbb617b7be146d3f6, 0x0889a608a59e9d1f, 0xfdc0cc296c1e1b63, 0x022ebe884bbdab0a, 0xb2b578ecd8c1e1c4, 0x5bd9a721ce2e25b3, 0x16df3637dd8cfbdc, 0x63e5ba57c5dc0fbc
+, 0x12c27927c606c80f, 0x6b4a016dea4cdd33, 0x6fb0af1632414026, 0x12e19620b761e90f, 0xc4b685ee5be024b9, 0x12c533501bb3b3d1, 0xffc8e9b76905c440, 0x4a8607325ce9f060, 0x5ee8159de38901a0, 0x38080681a585536c, 0xf302d5017ae62fe4, 0x70fc28876a18eb7f
+, 0x6fc8faed36d50193, 0x057a20c0a5269f3d, 0x39a946d45fbd3728, 0x70cdb773594d9a1b, 0x980030a9001bbc34, 0x08dad0043dde8237, 0x1582c9c5524472a7, 0x4dbb791741bbb269, 0xddb71fca20fb63c8, 0x6a2891c96a131bbd, 0x684f1cb3b70bfada, 0x6c3eba207e1d7afb
+, 0x50ef78c22cdb7db5, 0x3e772df3596385a1, 0xb09faa0a803047ab, 0x187c7bad22cd6801, 0x13027053da0e292d, 0x7566e6eb62827e11, 0x5a5ed409737d4620, 0x572d8b1e5e7d3464, 0x9d7f18396077b88f, 0x3c309ec566ed938a, 0x0ebcd7d90ef45757, 0x7e930538d5819865
+, 0x29a6d7a4f90ba1f0, 0x7ff50189de101837, 0x32f49d04b1f0ed8f, 0x2e19dc47202a37db, 0xcbb30e8ac681f74e, 0x219939a9b5566a1f, 0x378a07e070b06971, 0x05b865667e1549a6, 0xeb2cf09540418a33, 0x4205104f8de7e52f, 0x772cb57dc4549ae7, 0x1a6c9ad2613ae866
+, 0x66414128974b8ccd, 0x02bf6be7527d897f, 0x81de4be1e2ea65f6, 0x6d85ed9ddeef06f8, 0x669abef077a7f937, 0x41274682d410b0d4, 0x6d04bf5e7d988a37, 0x27cc8f6823be20cd, 0xaf06b0b6df6ca2b3, 0x58efcfb0654dbddb, 0x285aa1acccf75fe4, 0x6a34779f501eaa3e
+, 0x17521f358500d596, 0x5137d7d2071e546f, 0xb798e86c34afd879, 0x6654c3844ffafe4e, 0x97b1c847c9b83d14, 0x30093b18ed253829, 0x86ce50108a120134, 0x58c84a81a2667f35, 0xb7112639a92a5594, 0x2a12d49f186f0901, 0x849096cd77bb5494, 0x605f7e82dd1e41f0
+, 0x99b2007b1b1f2fa5, 0x04bcd9d93001f9ce, 0xee15920167c0ed3a, 0x5b8c789b56c96e0e, 0x9aea82bf755da5b4, 0x2e20ddfc322d9ab7, 0x0ba3d8da08afc76c, 0x1e37349650df2b57, 0xd85a9e57ddc0012e, 0x6c199f4736def858, 0x67d2b906b6011c5f, 0x7d67701867a3ca91
+, 0x3133a81eaf1b80df, 0x79d3101f73eb9717, 0x3017fe8882ff53c1, 0x4cd835b5722c548c, 0x91e6fdaa899709d6, 0x2853fdd018986aad, 0x2700dade650a73ce, 0x1288f028695620a5, 0x3d5653a5ccddb7f4, 0x57be4b6c884fc149, 0x11a9162014da07fa, 0x5854f6f38da42fae
+, 0x65b2e4ad37c40746, 0x4160024b2d913aa3, 0xb833b826a6ab41c0, 0x36aa8cd78129a370, 0xc74882473418ddd7, 0x39a4b2288cf805da, 0x184d06e8f07298c7, 0x2dc2550803e83c66, 0x9727f5dba2b383ff, 0x503b224a1777eab7, 0x834937b40af85243, 0x13bdecee31d6b438
+, 0xe152759e35cbd328, 0x515e710e07596f4d, 0x9378d419313600b3, 0x62d190a0325c2bbf, 0x81368419b448a9dd, 0x1ce0d411d606636a, 0x23c710199e08312e, 0x6dedbde72c281013, 0x6807ea21d88a05b9, 0x4f01ba6675e22e55, 0xb81fe0efccd8abd6, 0x1cf2e4dd0891d0e4
+, 0xdbb6d47c8fe6547f, 0x3dd4d830a0264b58, 0x05c95aefee657727, 0x59e8c5a787ae2278, 0x1a7dbcefc597b406, 0x0107593d2e3886a9, 0x74da669b2c3304e4, 0x4afcb47858f44871, 0xf816742dac065ea3, 0x014f378f109f72c3, 0x151e22d30f6f67be, 0x47eb9066bcb3533f
+, 0xc1f1834c5f88a912, 0x714c21f525837af0, 0x4ea7d9f459f14b02, 0x0d219a85cb929715, 0x92b95ad6ecf9064b, 0x7716bb55e8099357, 0x11c77071e3ff212f, 0x3d8bc22b04ba2bac, 0x9dc90dae8d05d845, 0x1a93aea567592dcc, 0x0423fbd80b5a3307, 0x066a937c8fb1c045
+, 0x107c31e132e6c058, 0x0f34d51f66bfcc26, 0x7fa5b01424f548bd, 0x4dcb661646e7a08c, 0xb16a2674c893ec2a, 0x73a0892a30519a67, 0xa4d526d185084ba0, 0x7d9674b021efbf42, 0xc5ba2f66e70b31bc, 0x0f7778b5ea9387e1, 0x3df39263a0eef835, 0x344fb8f87e236a8c
+, 0x4351e50a46a3e0f0, 0x24d1fe112b7be035, 0x76c21210b9ad3574, 0x4c8d177d98ff03f8, 0x53f535fcfd40535a, 0x2d4a370f51dca753, 0x5ae46f9251fbcf0b, 0x50ce87769ea6a13d, 0xbb639b2a03498966, 0x402bf2b211018f93, 0x8ebbc440a22b2e16, 0x5cf860461a56b426
+, 0x39651480ac5faec8, 0x33ecfed23fb40cbc, 0x25e4954a2e8ca28a, 0x7aa255c4765e7d78, 0xf326ef527c8b2a86, 0x088c58ddb2418866, 0xc150852d227a9b65, 0x7266a5f0cfa1d050, 0xd861cf72ca8b6eed, 0x5e4830a9f3f8fbdc, 0xfa0a5de32060bde1, 0x3d02f6ec2c86d5ad
+, 0xc44b1720bce76429, 0x1091a3ed9cca816b, 0xb01a8bcaef3d4bf5, 0x76eea5ac45146a96, 0xc4bf6a401e6d0b4a, 0x62bb3b467c9106d3, 0x993942dabb0ebc6c, 0x1974a13e4b89b23c, 0x9ac85a7f74cb2187, 0x42ac1919f1dbdbce, 0xdfa66c017a2b2dae, 0x024cefd0b27fffe4
+, 0x79426c3ce632ce3e, 0x7ef4d2a447554a7a, 0xaf22ba3d7f30ac37, 0x3edbd83635f19d20, 0x4fcf8d7dda9be502, 0x42ff9742ec55bf7e, 0x33d62a6094240081, 0x7aff5a6e61a1312c, 0x964d1f5efcb7db5b, 0x22c0cfe6ea678866, 0x7fc6550bad787ac6, 0x308c5c10dd9258e1
+, 0x1c32853977ff7a3e, 0x1a553782579c15d5, 0xc4dd01d261795760, 0x5b4e9605d045cb5d, 0x462705c0afe81aa8, 0x2be68ee2cde0fd45, 0xa4ae86ef302e177c, 0x461f274abff05894, 0x8028bf93d08c6647, 0x466df32941d48217, 0xdf60081ea0860199, 0x3cc9886e504f1bb2
+, 0x5cc6e53ca2d31c28, 0x4c958fca8156c627, 0xbdfe01217a6def0b, 0x683bdb2b1f94fab5, 0xc171ba71c55d749b, 0x0cf1446a6f6e6409, 0x78a62c7841b9448d, 0x037d99e6f59f71e5, 0x346309340fd22334, 0x0336dca7a4d2db9d, 0xa352c486251d43ab, 0x06e9cc7aa67a8bb1
+, 0x7bb0406623fe76af, 0x5d29258345067810, 0x02642c7d1055ddb8, 0x1bdf297356dbc962, 0x15561ee65136adee, 0x049e5f30db996a34, 0xbe17ca9fd653b09c, 0x3341e42e034847c4, 0x115bb24f8b448f04, 0x697b764637e2cf55, 0x264a70c50c3de1b7, 0x1dd1aa9626c5ad4c
+, 0x0c9a5ce885328156, 0x7d511f6018b344b8, 0x3fd1c1879b58229c, 0x733c929c960f2d75, 0x95131c117cfb83f4, 0x24afe142b14c6452, 0x4466153a70a12ac4, 0x6dc474d882821600, 0x565b351a83354b7d, 0x1b07d0636c05e48f, 0xd498b66af6a741ce, 0x452f08b43982038c
+, 0x452add083a36d3e4, 0x1324284bf7b97338, 0x08915bbd32add6fe, 0x7ab3adb466890d59, 0x20343f45d2c1e423, 0x2f182b66c18e885b, 0x54063ef53381e75e, 0x255c8c7404f77a83, 0x84f29bc8db473807, 0x7d9c730e7a084da3, 0x10fce07e78d1c288, 0x7c00bb2a2f7f8640
+, 0x7550295cc2e8ef47, 0x5f37d0fe8d709b4a, 0x37724386436a42c4, 0x2d77e0cb9a30b536, 0x6a78c4dde7b350a0, 0x1643c918374b1c19, 0x199411d9f44096ba, 0x2b666d46e69111b1, 0x5a17be72d05a8994, 0x796d3f4216fa4baf, 0xcb300af8465f8558, 0x65a3fc2fcd1915f8
+, 0xaf1b7bdb71b9235f, 0x5689323058402267, 0xe347d97fee06499c, 0x3fe04cfb84a525d5, 0x481de15dcc17d851, 0x2df716b9ec47de32, 0xdc7a158336223fe2, 0x3ccc406a11d81aed, 0xda708e600d039869, 0x456e4ca2b10144e6, 0x8e2655ee8894ffa7, 0x2a3b74bd94ba71e7
+, 0x2d8e6092dffdcf56, 0x39857ce8d2ee2574, 0x23fafa3d8e35a9b0, 0x7cf5bba433236066, 0xdc8d661f2a572e8c, 0x4f4e51755f41c5b3, 0xcf0661139b2dcbe8, 0x7c7437299ca96fb3, 0xcf1ff6f9ef154f23, 0x2cb4fc1f61dcb74a, 0xb5ffd64875325c59, 0x4f2833f459859f1e
+, 0x88e45daaf690f21d, 0x581f8df26cc39043, 0x0d2110f1a94e8a1b, 0x569e4503553426f6, 0xda027d4824a097b6, 0x37e871b566ad1cc6, 0x233fa34b4828f2d0, 0x05acde1c4a913b90, 0x11dec9321f8292ea, 0x3501941b7d4f83b0, 0x46213e053f96538b, 0x78504aadec0118b1
+, 0x698e7758a72f41ae, 0x755520f29f65ab59, 0x874780d1bea6bd1c, 0x4e760ccc2642887c, 0x885f8fa4d11af4c4, 0x138185009f373921, 0x12b8685213050b6c, 0x6f64aeec639acf8a, 0xf7d12a4b6da77631, 0x3be1bbe1b236dd8f, 0xf0aed818f8487841, 0x54ea62df85e9e8c0
+, 0x62e4c5fe17becc20, 0x62cef1af99d947a6, 0x885241f75536ce49, 0x6b6ba88c9bf55f00, 0x7c5c53b1194e3f2a, 0x418b134f9baca4b7, 0xdd73574a4d50aa6a, 0x1cec73e279a5ef5b, 0xa5260932581ac561, 0x04eafd67d45bf3e3, 0x5666736bb7d7b868, 0x142dc5cc3e719a93
+, 0x4d2553ff1aba613d, 0x4c8a60025d33ee61, 0x3a117e1844508670, 0x7554df7898100b38, 0x79975a19454aad25, 0x115294c8e5b0c146, 0xc4ef9918c0a7a15c, 0x1a7987f894e22c53, 0x0a9a570762c413a3, 0x0a0a90417bc884c5, 0x32afbeec82668972, 0x4676ba5544ac5122
+, 0x6f9a45c3fa6d8d93, 0x24cd478489720dc0, 0x623c1390e9fe5b85, 0x05b39c3f095b2f34, 0x59d763241255a291, 0x662d2e0e0ffaf71b, 0x7e6fb4495d4be3ca, 0x5796cc95b7993e3a, 0x2ed34a14d3b9b852, 0x486bfa621ad3d529, 0x18a04e6a82bbe346, 0x04a4e504bbc79e3e
+, 0x97acbeb7737140c0, 0x37e866de3654f841, 0xac2e296db5b86e22, 0x686d898bdeebfd49, 0xd67177e622362bce, 0x2dfe301c21874aff, 0x39dc2e3e3963cf1f, 0x478c5419017b9add, 0x2f9c96720073aa94, 0x2a1a28d8d811d267, 0x2b589714ed6acc76, 0x54909369806d5fc8
+, 0x582e933f2a17aa92, 0x78fd6a4a4a7a1d8e, 0xdfff1acf6539fe2e, 0x36c57e6fffa2776f, 0xa88f33578286f082, 0x7abac06a5cfc50ca, 0xabc505c9fce7cd32, 0x665305eba608f1d5, 0xd210e50d4d7806a5, 0x453666a09d8d2652, 0x5746aacd51fd5579, 0x6eb39a556759b5f1
+, 0x9ae216669a31fec7, 0x30221f89b7010d55, 0x9e02dfab0aa5b17c, 0x1ca417543d351694, 0xe5814573ca41e202, 0x34afb4bbfc62bab6, 0x0aa97ab81351d66a, 0x7927aef7fee9588f, 0xd5d1128e8f352d9c, 0x0cfb6e4bad92dc93, 0xdc473c0c49b9404a, 0x1e081a4da1f1813c
+, 0xef91b534f867ff2a, 0x7e79fee32e9eebf2, 0x1eaa0f42c1732e9b, 0x209a54f297b05624, 0xbc9e7cc192c2d20c, 0x31b05bb045783612, 0xc74b9cda97a9044e, 0x430b7123036b414d, 0x79e37e26b730eebb, 0x0244adaa074a8149, 0xe811cea994995ce2, 0x34b5d3498afb735b
+, 0x7995d0900e31ef3c, 0x756573ff84a374e5, 0x2cf017e9afe1aa5a, 0x7f560a3c07e754f1, 0x458d5f2b763a710e, 0x3e3b4a1606fc3829, 0x8926e1753017e8e5, 0x068e330fb2a2c09e, 0xf04ecf9fee18ab65, 0x20e0ac857bc16b2f, 0xd6eb34e19a03b14d, 0x5b330a5142ce4cfb
+, 0x8db2484ac8b3f75f, 0x130b7857ba1cad9c, 0x49cd09afad05c6fa, 0x3009812eb4f4aa40, 0x3d46fd661b3c585a, 0x6d92f07067be4abe, 0xb170bf0c26a99a81, 0x375835fa15140a7d, 0x95ba8a71c516b59f, 0x12184a85ecb0e6e4, 0x1c90785b8f945ada, 0x7482d1e83c30666e
+, 0xeccbcd69eafbe7f4, 0x6340be2241b28acd, 0xce595e0d423f8477, 0x2af78a49083a0efa, 0xba5e1a3f255e87f8, 0x6f3e81ea24339310, 0xab8fa0a82d71db75, 0x21bbbf8d265fce70, 0xd4e54de3dd7e4301, 0x01fdee5fda18562e, 0x330f4a792442a8a9, 0x223e8b1ecf487382
+, 0x64d6dc915dc07c7f, 0x626388000fe988d8, 0xbdbd08867b7e248c, 0x772ba1d08c9157a5, 0xce6e651dbddedca5, 0x43d5876688fae885, 0xb31ed7490b9e4981, 0x6c0b9ccd76b9abc5, 0x43dfa09f106eedeb, 0x7f443a826e151ebc, 0x819bec2f40a7389a, 0x74e4b3ee0c57fb74
+, 0x968654fa4a810618, 0x7b6db630d55138b4, 0x9daed9e83a326e48, 0x43b67c0a4bca612f, 0xc0d697954d2fd2f8, 0x2568b34c15ba48ab, 0xc9b2cc92dc41ed42, 0x2350e5babfd57cdf, 0x05a862aa4ed07a18, 0x6a49d61299659388, 0x86369707519b0813, 0x6070fb824242da3c
+, 0xed01e37ca2902faf, 0x1173f938710624dd, 0x05e485c96ff0db6b, 0x0d0cb57f09bc9ccd, 0xa49dc5491aa5aa5c, 0x25195e531aefc52a, 0x00bb7bf97ed81f3d, 0x37dfccbe577030df, 0x19ec1cb42fc8d48f, 0x5fea5fdef46c56ea, 0xb1e3c75a9abdc416, 0x2b112394de6518c7 };
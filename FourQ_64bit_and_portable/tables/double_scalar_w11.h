@@ -0,0 +1,2061 @@
+/***********************************************************************************
+* FourQlib: a high-performance crypto library based on the elliptic curve FourQ
+*
+*    Copyright (c) Microsoft Corporation. All rights reserved.
+*
+* Abstract: precomputed table for double scalar multiplication with WP_DOUBLEBASE = 11
+************************************************************************************/
+
+// The table below was generated by table_gen and consists of four mini-tables each generated using window width W = 11. 
+// Number of point entries = 4 * 2^9 = 2048 points, where each point (x,y) is represented using coordinates (x+y,y-x,2*d*t).
+// Table size = 2048 * 3 * 256 = 192KB
+
+static const uint64_t DOUBLE_SCALAR_TABLE[24576] = {
+  0xe18a34f3a703e631, 0x287460bf1d502b5f, 0xe02e62f7e4f90353, 0x0c3ba0378b86acde, 0x90bf0f98b0937edc, 0x740b7c7824f0c555, 0xb321239123a01366, 0x4ffcf5b93a9557a5, 0x297afccbabda42bb, 0x5948d137556c97c6, 0xa8189a393330684c, 0x0caf2b720a341f27
+, 0x892756b15bcf68c4, 0x5742f77c98a526ba, 0x340a5a1de9f89f9b, 0x14ef680aee75d0f7, 0x84e770e14043a41f, 0x0212c41116c33c95, 0x35b791e6de4dc0e2, 0x5949df08518d5d28, 0x6a0e120744ed10db, 0x5a5183ce844391d3, 0x6f618b158afdba50, 0x2ce2037e470e2088
+, 0x1f49fa149a64ba3c, 0x5f9876d519670451, 0x030105056f55586b, 0x020f1a557d8fd726, 0xdf4cb175b06d86c8, 0x694fbcbe7fe58390, 0x7933294a756a1b67, 0x09dbe9924b58f8ec, 0x590f4403cdf197b6, 0x1c07969fc87a0ba7, 0xc496477712252367, 0x5508976022f1b096
+, 0xefda361e452e1775, 0x7a0a0cccacc838fb, 0xb07e791c0be5dc5f, 0x24d9b6b418cbcb93, 0x497970f3c6117e03, 0x3986a158cb96d595, 0x8f80586ce692612b, 0x305cafda7e4df9d6, 0xc1a1c2e06452914a, 0x7ef989c0eb583079, 0x3a765b1f7364b099, 0x4fee236d58299c6b
+, 0x6f81095f770e8419, 0x53bbd86b7396bc09, 0x2b72ba726b2b4210, 0x625dda1d2901c78b, 0x0ff5bc7b18cd2b3e, 0x0556598c7358d332, 0x0991245f20ff50d7, 0x0e7f58e5e919a97e, 0x5a0561373b758756, 0x6447bc93f87c198a, 0xf9230604c34c7520, 0x6b214425475c1bfa
+, 0xe93de62d6a7f9497, 0x2129459d86f4493c, 0x456394c7c464cfe4, 0x612434fec3f4a1b3, 0x1ed91eddf44261f3, 0x0c6d3854f9e0a3ff, 0xd3fd153188a7e4e3, 0x24691fbdca16910c, 0xbe97465cd7625c9d, 0x2aa61cd373f759f4, 0x824d5763a326d62b, 0x1a0ae39e50da20ba
+, 0x32d0c8481ee4c3b9, 0x6c3687109cdd18c6, 0xe52717142fbf95da, 0x67bfa41fb52ce9c6, 0x4e24d6a088a01474, 0x49a6ca0ae3fb6626, 0xd67f8faa9103191e, 0x674888f5aa6d3062, 0x4ba73824c2e85a99, 0x406b2fd18d35b314, 0xa7087b1bea728ac1, 0x11d2f222317b160e
+, 0xf8946e007e23a469, 0x22a196fabbce31a2, 0x5309ee1bdc1216ba, 0x240fe9953827a324, 0xf9fcb89b63aeb5c7, 0x603b8149ed16b1b0, 0xb1f1876c02cf61fb, 0x4a5e32af612f948b, 0xfc491aede69a8813, 0x1ad9379136e53aa5, 0x5da50db1d5e6c123, 0x2f4014f7fe2c12ca
+, 0xe4f6791d7685c3f5, 0x4c218521c3745a9b, 0x0c0521af98555f97, 0x1462a12953cada7b, 0x0bb2ab63d6452c1b, 0x5783c531ec98bb87, 0x737def53605dbc9c, 0x49f982b930e86719, 0x75b16790cb5211e3, 0x45ad6574cdbae99e, 0x1062b72dfeec9851, 0x45029a09cc468c88
+, 0x532240de77f3a1f2, 0x17bd291eaa9ad0ea, 0xe0a2d7efc2f8a0a0, 0x3a7412052021778e, 0xb0dfb0976acc90df, 0x7fd603b689a7b1f3, 0x1152579ccb00d6c6, 0x6340743b631849a3, 0xebaa47290e0cda01, 0x143265a6d53fef0b, 0x45325d6fd981e75a, 0x0e9780cc39586f2a
+, 0xa4f68d207a8628dd, 0x50d230b51893e841, 0xf3bd769a4bb504b6, 0x55975c063969292e, 0x07727ba25fb8756f, 0x07ff86cf8ed731fd, 0xef57fa40cc35a1f0, 0x70753a70874218fc, 0x615954e2342b973c, 0x5aa9d68f1a59df86, 0x3b8e9e9ff5e44468, 0x2e749114d60a3d23
+, 0x14a1b91ec176db4b, 0x55f91a63d69aae6d, 0xf42382327b1b6d27, 0x2acf1f475facaafd, 0xfd9069b479b58968, 0x3baaf4e5c4a45f77, 0xa2ac9ab98a7aaab6, 0x5466cb5018f50981, 0x3e6ba27771ba3205, 0x31ea90cdea1bbbe4, 0x0000416b5c557393, 0x464cb0415a510d7d
+, 0xd02087d206ff2bbf, 0x2b9c8ecd7fabe736, 0xb2b56d3842caab0d, 0x046ea0b7767700a7, 0x113a7a889e317310, 0x5992a354bef7d0ca, 0x3edda94ed50388bd, 0x052661f767839154, 0x4c28edf6e19e28e0, 0x1d19c2f2d2f644e5, 0x5d732148db35ab3d, 0x680c4714b83580f5
+, 0xa374f282bb80ccec, 0x789e609bc77ae11c, 0x10d2577d599b45f2, 0x1c548b5b857721b1, 0x7baea726b4543fdf, 0x3c1562912d1b4ed2, 0xd6362203b7e82082, 0x1414e523d3c7a900, 0x7ca349951c1d23a9, 0x4da4265e3ce80fb4, 0x7981ebbcaca9ef36, 0x4ebac9e5b5bf980b
+, 0xabd2c1dcf49cb5a4, 0x3f54acfc25c6340f, 0x202eeffabbd11cbd, 0x67216b7cb3695e8c, 0xff7cbcf9b23fc9f1, 0x2eebebdff7fa7afb, 0x71156befa111f85e, 0x1b8fd98df522902c, 0x6b28ebad62519791, 0x6cf0ea960e01d8ed, 0xb4617bc2006967d5, 0x323da065cb3df0ad
+, 0x31687d0741e24d9c, 0x02db8f2b509a7cc2, 0x9243f85924320527, 0x68c360f01d6e6d2b, 0x2351c5e877d5306a, 0x6f56ccfc85c5f3a9, 0x1b09652837c4928f, 0x0b3337554c83f971, 0xe2931be2ccc783ec, 0x46829694ba08c64f, 0x9f35e36358e2c6ac, 0x1474b333b000d170
+, 0x24d792756fc96640, 0x618fda9fef868c5e, 0xb7ff5b125afd9375, 0x778dd97e0440c258, 0xfbff314886219627, 0x3417e1e1e2a7e811, 0x21e959a88f7b7bdc, 0x3508c2eb8c3c8672, 0x827ecdde111c430f, 0x21bcb19fb07aa134, 0xe0c1fa50ab2f5746, 0x401e680b4e6658fa
+, 0x2cc24bab313693cc, 0x20541c12b964447a, 0x374975b6fb81c3cc, 0x52905efb344e17f7, 0x79c5c9b56d8b5f9e, 0x3390bf75d2b9a3ec, 0x7ef3807d895bf4e4, 0x2814165a42046b51, 0x7f8cfd09326fe158, 0x3232fb4f4c9762ec, 0x5678d6dacc194d25, 0x6f7caffb0a7545e8
+, 0xbd981637b23e7963, 0x691d7b7cb88a0ef5, 0x10ba319ae2062914, 0x06fb144f8295a85b, 0x80e620976bf62f8f, 0x2a425971ec73d6b4, 0x800aa9e741d10b1c, 0x230d7d8bd1a0469b, 0x65aace37428dfe8c, 0x0fcab5297f58b667, 0xcf0e9526943af7b8, 0x7d90915b75d4dae7
+, 0x7455a46156259d6b, 0x29bcc06374cce1b5, 0xf2fb0ed3aa87aefd, 0x211a06af0e54dd58, 0x6c0c95c5723de9bc, 0x6299b6ed25008ca7, 0x7fd63e784d4dfb18, 0x2cc93b4d9bc1db30, 0xebc7e2d44c5d13ea, 0x3278e18d4d3d11a0, 0x349e3dd25a215f79, 0x7eb2a7150b30416d
+, 0x05f3d7d5f6a094cb, 0x2a3771d48e331405, 0x08ef39e9dc96f009, 0x012248373a364992, 0xf758f92fc9fd4d33, 0x2339d8c6dfd3ca6c, 0x8b000965962673b4, 0x746ff43eb99d9054, 0x47ecdc054a422eff, 0x33d8f7c8267b7f0c, 0x22fe00ac921a42ae, 0x31e57f3d31fcd8e6
+, 0xbb912315a1c50869, 0x4ac8cdb0fa7ebbaf, 0x0541d74a60973edf, 0x7234900334b2c5d7, 0xf2e545f730adfa33, 0x224e44e63db5ac96, 0xfcba3d005c6fdeb9, 0x2c93a4e6559936b5, 0x7727a0d7ad88d758, 0x2e33100216719cdd, 0x7b2ef89aeb2c0254, 0x1f6de5b74758afb4
+, 0x6ae89047114fb321, 0x3d605e9a6ec6d80d, 0x18e915c727a874d8, 0x699088b5e9d0912f, 0xaf9344618e056f10, 0x1b9169df8245e0b3, 0x5eb8c33d70f4c891, 0x1609ddfb222b13c3, 0x8131c885d1b366ed, 0x7bc3cf9d9cb1a7b0, 0xd297478d2fc93968, 0x13cbb4573a4ea7f5
+, 0xdd37b5cc64d5986b, 0x7ed3d1d7d81ab5dc, 0xac53485f23973c9e, 0x0705675d333b91d7, 0xade5d213c43186c1, 0x6a8bdf57b4bfdf14, 0xa87f88a1de717963, 0x17f29220b519bce2, 0x7af2d7fb0f95c610, 0x28d1d3923b144a7c, 0x8e73c3d8972813e1, 0x00100b40c62e72c1
+, 0x84de7a81fa1f50da, 0x4fa391d6589d8244, 0xbcc3596f0834b285, 0x4d4acbd60a24e9ce, 0x97fa98b8c1835a0d, 0x33abcf8e29901d0b, 0x60a73d1975b3d082, 0x60666aa4325b948d, 0xad54adb769284a39, 0x227a98d113609b28, 0x4a1e1ffcae6a3872, 0x1e4ee44bd67f818c
+, 0x5a74c6bb4387d315, 0x019428c0b1b18795, 0x5cc153e270bbb055, 0x2b3cabdf00dc4a61, 0x834110c026924b57, 0x2d30e985f2d9f217, 0x47116979333389f5, 0x53e3fd6a18202417, 0xb1393cd79c2e5864, 0x58d92935e4112e82, 0x86989a7ec8305b6d, 0x42a8fe4eee28f37a
+, 0x74e212ef01591901, 0x3277917a0397b1b9, 0x7bbcbe6e3d687544, 0x0b8957701d09afb6, 0x6cfbc8ee74503668, 0x48a9925ada9f8348, 0x57045753ba2d0f4e, 0x7d69ca3866223d66, 0xc7054ce22917271f, 0x41bce1e1133b51de, 0x3a3ae42df81ec35e, 0x7eaada0f42d47cc3
+, 0x13b138f1048a57cc, 0x64f98abd7e915a8f, 0x7af195eb16a0c732, 0x11be81a791d634d2, 0x97d8df47430f61b8, 0x0767c7b381271004, 0x3e949136fb940aa6, 0x3bdee340cd956dba, 0xb250ec4ff91d2602, 0x4cde2454d47f59db, 0xaf5e749530d978cb, 0x5a8e2f2119d4d835
+, 0xdf1cb5425a0744df, 0x3d3b08a7bf35d055, 0xc6335e832de4719c, 0x6eb8d97e09154d42, 0x2f6a3f8de3d20dd9, 0x13f23cfd276233da, 0xb4a6b80dfc0fa41c, 0x58d876403acfd7d7, 0x2ad422078b8e139b, 0x73dbee2abbaf494d, 0x09a2758891eca3c8, 0x6ef9a9f1178b0938
+, 0xfc7e9ecb90c637da, 0x3a04345fc10b1a7c, 0xc024e9cb62f9ff1f, 0x6c4f9c3aa4aa33d8, 0x049d6995b95ac1f0, 0x2243845195763a1b, 0xa1466a31700ac276, 0x600fb7123a325905, 0x9d391a64a0d35a24, 0x3b093b550641f108, 0x2275de5bfd2e221f, 0x25f5e7465963db1e
+, 0x3e220107f7e7fb84, 0x6f06a23bc1b85a8e, 0xb4198d19f6eb0e48, 0x5dc11761dad45fda, 0xba303e492ab52a0d, 0x127c69c73da9f528, 0xd3a5b70cf6c790be, 0x0d72b0c50819da5c, 0x193f90d62ec2cdf7, 0x67f7d0cfc4f46daf, 0x7aec083d52f380ea, 0x7c0a1dda4a28bf4d
+, 0x46fd20fe6008cba7, 0x7a588c914115d595, 0x8fb1d3daecf45f78, 0x0851dac094e7b036, 0xcae0a76e2a32a892, 0x104f861322dddb2f, 0xb79d81e46e1f9006, 0x1e4d28d7a2498912, 0xaf3175d3974b89bf, 0x613d00f9a69c55c2, 0x23f6883e8e65226f, 0x072f7ed65c6def05
+, 0x6690e643bb38e243, 0x1a81c4a7c9189b15, 0x1056d1669e4749ae, 0x0137f2a7418f190c, 0xed3192796e699d16, 0x3ed76db45c38a37c, 0x78e86d1475a88243, 0x45985aacc495b16e, 0x47d5c8208e8f1030, 0x6dbe5f68b4d0e782, 0x08d3d0182cf7f26b, 0x64c375ce172fadbd
+, 0xba0f6db3a20c2875, 0x57e1d90a53241250, 0x0315433fddf8e63e, 0x33344750e37dad9b, 0x62cc0d28ae69b016, 0x435fe80f6100d547, 0x5874aea8669d3df5, 0x3b96913f8264d4a9, 0x738067d6bb1314b0, 0x48cccf24cc6f4ccf, 0x6f5e2bbd68b777af, 0x34c2c37ba9635d66
+, 0xd731534900fdbe5b, 0x4e4f9d97afe11d43, 0x81b41214351b73d7, 0x1d48d100ad11a5ae, 0x2a4ee76628e2b151, 0x34902e901877efb8, 0xb5a8561a0fd45394, 0x44317af6d5cd5ac0, 0x354c2469e9068bad, 0x0771fe2761cad022, 0xfda76ee8212d0f2b, 0x76cdeec6d4435495
+, 0x55c98575b3e825fd, 0x2983325ed5d73a1b, 0x563c4c4fb3f466e7, 0x731b0fa413338bb0, 0xdeb519ca57a05240, 0x7a7e909b5c4f7351, 0xefb7c153dd2ab28e, 0x11ca1c865dee30b3, 0x013ca8348d9d7de1, 0x575e0bdaeee8cf9a, 0x464c98a21083af7f, 0x683ddcd85c212ee3
+, 0x1171f0ab4cd02019, 0x22c7e01c7f4d64c8, 0x972ec0ef3f2e2ed3, 0x623f83c2611a476c, 0x99b3f16be9aa25a1, 0x2d3ebc5468990e0b, 0x5d5fba8546a4d5f2, 0x4716e6919d2986e3, 0x3ab2f2bc183f5d6c, 0x5f6257d3910cd4be, 0x341c6f2a78f94f2b, 0x6ee8390b8a5064f5
+, 0x9d8640b9b83ca8e7, 0x033c5ad24466be3d, 0x6f6cd68db30dfd59, 0x52aa6b1c0f90f3f6, 0xfe7bcd4c97403646, 0x11ab3fc960b05fb0, 0x24584b77575896da, 0x427f8deb932da137, 0x928a28cb505306f0, 0x04ae916fe863820e, 0xaabaa98911b9cd3f, 0x59e588ba994d9145
+, 0x9b8f1afabeee9e9f, 0x04ffc7ef3476ff8e, 0xe9cf53ce9937b146, 0x73fe42a801524448, 0x224bda3cf3bbaaad, 0x5fa85056d59884a4, 0x8e6eead48345726b, 0x09230936d41736d2, 0xe679eb58d1ad6be7, 0x08bb759b530b1eaf, 0x9688eb527860e24b, 0x13704d2daf9af278
+, 0xd9273ac71b906f14, 0x57ee05fbbd40deb5, 0xb7788e19ba9e61eb, 0x7967b6dc1c5d9699, 0x36e043fc230127c0, 0x2a716598bb2d519c, 0xc017b2840d4d1b07, 0x1d3bfa489f756a3f, 0x4ad73abf24318d36, 0x1915e6f53e12625d, 0xb219a7c941f89084, 0x2280087a8f4762fc
+, 0x8eb280345fd1b4e7, 0x55b8d4ee5772fd79, 0xc9e63a787e2ce2e1, 0x685741adbda93885, 0xffb830ab11a3b491, 0x7e891121f9356428, 0xc03aea271a629078, 0x71c45932930a2639, 0xe7df192a6bf81795, 0x704aee8f183aadf1, 0x06ddb55a8a7a63d7, 0x52556d8763f3033c
+, 0xb76b458c6f0c33a7, 0x28666b87c362b95a, 0x365ae575a4c27b9b, 0x36ef35110562adfd, 0x89955dd8d927f9c7, 0x526e787d6a586c9e, 0x762e0bc4eff988c1, 0x6c9523b4b5ae4946, 0xe90a909688cfe95f, 0x658a7dc8b3ffada3, 0xbee148ba7a58520f, 0x6819007d8573d1cf
+, 0x75d3b5ec141be9c5, 0x4bc236ae634f3c27, 0x1192fa9b8b30e894, 0x4129d43e1d092cbf, 0xfcac068558bbea45, 0x513e8d87b8116534, 0x5377a179a155ecd4, 0x6c93531e5545572f, 0x727df81ba09aad91, 0x07527139dbc96250, 0x150320b1d8ba172a, 0x2281e85f60a1809b
+, 0x7164b7d524eba6af, 0x50d387163fea4ca8, 0xe90de17d62aebe78, 0x6ab369ba28c0410d, 0x17d07e315a95d138, 0x58b496352453fefd, 0xb87a04dbbc101b92, 0x40a8f0fb757e9b0e, 0x2148b48a696e64d1, 0x4e004a3a350c17d7, 0x17927e9f386b563e, 0x29da9cd441e3e3c5
+, 0x883d2dc357417213, 0x2e94653ff7862644, 0x53a37af548453df1, 0x04475db3c300b93b, 0x2d65fa4d815e7204, 0x231a2db74c2c3ccd, 0x1fd734c0cf4d97cd, 0x32d255c105f6d122, 0xbb74fd9201eb07b0, 0x12e33f1c81ac6f60, 0xfb9a6439bea97072, 0x52e14b7db9cdcbc1
+, 0x637ac1a91ae374cb, 0x1c8622c35adc8224, 0xeb786c50a64b7d33, 0x362823a7232a5893, 0xf22dafca688d472a, 0x18598f0e0237f7c4, 0x97b8497bfff4bcf1, 0x7abf4cb27a9c5b7f, 0xea47c44e3b3d95d3, 0x58728fe3e1827a43, 0x7fd3681a6df902c8, 0x6db1dbbdc413de79
+, 0xbc4effed1ac3007f, 0x7f31a54744887cab, 0xe6559b4f8bd2519a, 0x18a78ec5b0c241db, 0xf6e10285b15d2030, 0x5c1323ea219a8ff4, 0x134b6f20dd116b47, 0x5d0abddbc8998733, 0xa3c993938702e151, 0x0ab6aeb494f6ad5d, 0x8cf3b4beda1815e6, 0x546ce323008c2fdc
+, 0xa10eb5a6a78dbe39, 0x26d2e8a8b8457da4, 0x026ccbe31517d806, 0x2a35174b812f562c, 0x57d70499dd7a374d, 0x3368f951acd3c5e5, 0x490b2515f901062c, 0x316109e7c315c377, 0x32e20eba569535cf, 0x496a8c39d667d709, 0x5578096dc44d5e0f, 0x608a162ce73903b0
+, 0x6b2e65852cb37cab, 0x75b09a2e6ed609a9, 0x7ac84b3082602455, 0x7690cbb594e84b94, 0xfc85dad9511973fb, 0x738a74b08c9006d0, 0x83233fc939d5883e, 0x7fbfc08b5db3c9f4, 0x81a0e493fb5f7749, 0x2c255ef7e69a77c1, 0x234f02e609cc656f, 0x5960cf0b961f3cec
+, 0xac72940237b1f17a, 0x434e038a29d446ac, 0xca6a090e00d8b0c6, 0x1f1aad24001e473e, 0x6d64b6dc133399fe, 0x0899ba41e9dd4607, 0xca590b3f25bbf5df, 0x57217978b0d8ce11, 0xd6b4cb13da6de9ac, 0x3c88520cf564f75d, 0x649fbd5075a7757f, 0x3f2593b90fe72161
+, 0xe1bee53e91dcc9a8, 0x010069dce4c74a92, 0xef83968978aa855c, 0x6cd8848183b53d73, 0x0b3df59610e403eb, 0x713225d446180a7f, 0xcc23112cc59850e2, 0x105796b670a3730c, 0xa147f4ec7a2fa4cf, 0x32da1f072d75b253, 0x4e7007455e85f560, 0x76a5376a771fdd60
+, 0x47eb4fabdcc699f7, 0x4e45db6334c6ed96, 0x36066f2bab72546f, 0x04f48065593ecdec, 0x3fec02793fbb5601, 0x122f74626b64a526, 0x21d0f66ff83b4dbd, 0x1370610ede647f1c, 0x57b82242b88172c9, 0x527dcbadfdc65ade, 0x5e9c9a04385c93f5, 0x64d1cf9e52548a6c
+, 0xba0073337865c994, 0x633ee14e50bcd615, 0xf840228ec4251095, 0x49bb96812a98f08d, 0x82f57d0422f96678, 0x06d7e43bffe7e0e1, 0x33910cca752ae863, 0x04d46e7c66087e38, 0xf14935c4167017c3, 0x3f22e2f44d03c9ac, 0xa6196244f2cd6164, 0x15a2b4ce514fa4db
+, 0x5191a04c4abbd0c4, 0x0e763360ecc8a19d, 0xfef583c184a673c0, 0x75c2f30a7c7433e7, 0xe947a55547c7c099, 0x245c7ae44f6e7a83, 0x67a666f9e6bec2d4, 0x5de0b922fa645ac8, 0xdd9b3e4a5cb72e22, 0x0139c2c857adba8e, 0xa7feb68e863ac231, 0x501381ef88ec2da0
+, 0xb2b8c6a470f40b01, 0x051d65bdb8363062, 0x4ce90414a6d65714, 0x1e510b525d19df0c, 0x569e723f5d374cf6, 0x4bfe02fd38fde1f0, 0xae7459ebc50f9aa2, 0x0f7e2cb170dfde32, 0x3c3da2326a7407cb, 0x0cfc50a85ffd1842, 0x62ab34c85e85c3c8, 0x22b4d9644bb37333
+, 0x57d313b3d87c2d98, 0x4f432c1cba49133f, 0x6163d11fa4befc0c, 0x1ab94e122fddf12e, 0xfb7c9358aefc85a8, 0x5b20068f81d949b1, 0xcf8ed6ff2145c810, 0x5794afc021932d00, 0x5c8987ad9b6e35d5, 0x6bb1f4b836fda03e, 0x794f1fed4a3ea1d7, 0x0cf6d128deb0e7bf
+, 0x54ec3e1c65878cf5, 0x002811763ba2200e, 0x382d917051e77b71, 0x49e00cbd013a9e7f, 0xccf576e9a4cf019c, 0x4b4a66287970333a, 0xf772168915edfc1f, 0x278eb5eca6479685, 0x8a95c8b9cf41cf06, 0x6e58c9c7826d39db, 0x478e119889f2fe75, 0x73ecd21991bd98d4
+, 0x26e751fe9fbb9502, 0x29825b71b0632e95, 0x21668f96ef8bb5c5, 0x2f2a899e53c9a004, 0x2803292ed4345ce8, 0x72731055c7c65dec, 0x3aaaca9c4b6fe9a5, 0x6228d3ceda8bd671, 0x773e2c5effc48eaf, 0x017ab19e0fea9ac9, 0x9609e10496c8d766, 0x121e89f9b302c30f
+, 0x4e87d00a0be96480, 0x09bd8d170ba9dbab, 0xc6756f947ecd4e52, 0x2c9e40bbbccd0f5b, 0x42a5b77669fd812e, 0x66aba9583b080d9e, 0xee55df99d16e77c1, 0x4cc00c5c5eff2509, 0x8c84d5e20ab7c16b, 0x00ae5c96184ffefb, 0xb295e90346dcef54, 0x5d1bda0a39dc3b72
+, 0x75f92d72a89b5ef2, 0x259d998c9ff9ac0e, 0x8a1cfb72a6c433c1, 0x23f5b71d49d67604, 0x478d8f30914f62ef, 0x08fe61135218eca9, 0x4da2ce9bc6488c4a, 0x15f1eafd35283e2e, 0xc2d2be3ebc42ea0f, 0x2a5216539d6ee902, 0xa1e99052e7bdeeb2, 0x3a8f2631ec78290c
+, 0xb71518a82ebfbfe4, 0x24700671c46ebddc, 0x6ef52d591a221f75, 0x4794614db6a67d92, 0x761f5c8ee4bab607, 0x31d9dd8f2361b5d5, 0x1a45593be8db3b29, 0x7f06c365eb116260, 0x9d305a66e52eb65b, 0x5edcfcb5613eac18, 0xef34fd28154adb75, 0x790f805753b9d742
+, 0x6ecd5ac255dfb797, 0x0cbe14db5d9a88db, 0xc1c86c5efa815528, 0x2c636133ba59d887, 0xc75d42c2d9f52297, 0x4bd3540c21e2ebd3, 0x32e7cdf790de6903, 0x1aae3c9837d3e30a, 0xeed028e49d436f09, 0x779ae12351efed1c, 0x6e0145587d9797a5, 0x25156e4cee9a407b
+, 0xac2fd82f2ac57119, 0x7f8c026f1d182ed2, 0xeacc0d8fb3241611, 0x5968db65d2d7545a, 0x7d525846b1121dbe, 0x57949fd7b80339cf, 0x471fe9bec9b66c01, 0x5c270057f1268efa, 0xce092463083f656e, 0x16e8241cdc862cf9, 0xb7cb2bbcaa06b312, 0x3c25936bd8863416
+, 0x19b8ca966c4a3827, 0x1ae43badfd21e63e, 0x1dfd002b95a6ac6a, 0x4708e27f6d98e997, 0xb5fd6322dc31ac7d, 0x53baf4d9a16dd550, 0x025aa2ea5463960c, 0x5b5b33c7a3cfa54f, 0xdba287866ee96b90, 0x4748c1f3f3a6dc4f, 0x2333ec05a80c154b, 0x4a47745d5b99fb96
+, 0x7de331eaf403d7c6, 0x2dbf3a9f975a4b09, 0x175a8ac5d108224c, 0x6697ae0ed57bb18a, 0xcea23805c213e2c3, 0x59f1b8656d5690db, 0x4baf460a10b23798, 0x0077832eabd82e13, 0x52888a23361cb298, 0x30bf5295c5f64491, 0x5960339ec97719ea, 0x5325cd922cbb3403
+, 0xc5188bd69618e85c, 0x296f922d9ad41fc3, 0x2da59f8bff5aed90, 0x2662cc4c60ee7ef2, 0x22aca98c8405b59e, 0x043bba596dcffd8e, 0xb467008e9b87aa31, 0x1d65fdb88da19ed3, 0xe042f460ccae713e, 0x101118018bae77e1, 0xd0f26b4a5d91d8ad, 0x40770de987e00c67
+, 0x53ab21e43a35ed5b, 0x341f9cd6e64e6c84, 0x6ef8e7e707c1414f, 0x33610011d1f942e3, 0x4b019af5f2f8e85e, 0x12ad7ab4b14cf6e5, 0xc718480b770cf12e, 0x7bda44448dcbf840, 0x98bb0351df202365, 0x4b38527c6dce9c01, 0xcbd28185a819ae02, 0x7a19bcca37fa59b0
+, 0xafa3722439957660, 0x06ebdaf0dbeb7593, 0xde81597f08c3ae81, 0x33b9907bbb96d4c4, 0x3f43a76561db371c, 0x0e89a1fb68f278c8, 0xe5aed79a0680ced4, 0x4a032dae33d5d6db, 0x2db5b64487ec9e21, 0x4a8ca714b7795d2d, 0xfe9bd0c1cc1c91e0, 0x0bec01459b9b7e42
+, 0xcfa0d0003cb14725, 0x75aa85468a1e34f3, 0x68f5bbd1abf452f3, 0x249a902b7ea02a8d, 0x71ca331692213631, 0x0e54b1b6ccfadb84, 0xd13bfefa0cb35163, 0x618352c16fb97576, 0x6b6ce9a365e7e495, 0x60a6cd627054aae3, 0x1f7e7b55d56dbbf9, 0x58d1869caa022006
+, 0x20ce35661383a949, 0x4ec74a9307323d21, 0x7fbad803d6c7844d, 0x2b23d3a55363b681, 0x061c0444341b7999, 0x7e4ad0cab9534234, 0x7b09a8cd488f6621, 0x7bde5e652073500e, 0x906f8593e41d1d0b, 0x1ecc6829240726a4, 0x3de8b88854db49ac, 0x3cb4c48361531c6f
+, 0xd8d85e6921107a60, 0x24e554cc92a75021, 0x6b5fe5fcbcc564e4, 0x0b5de8db2c7373d6, 0x166518f4256f8548, 0x57f6145b58ff55fa, 0x6bdcea5977343779, 0x0b95e29ab237a201, 0x193c9909e331942b, 0x4711abbf14e0a184, 0x686611580e5381ac, 0x308709f072c2db2d
+, 0xeb5589ddd7d9a990, 0x5b09e1a65ba35eb0, 0x61f6c9a74817e89c, 0x4e22f6a84c22dfa6, 0x112d33a0173d2f20, 0x193ea2419f156077, 0x10d1fb4462291b6e, 0x3a04fff11f9c8a7f, 0xc8e86ce9453dbbde, 0x75d32f976d9e2215, 0x6898256d3553df64, 0x4a38a72818ce3195
+, 0xba7ab98e8bfb2485, 0x5df853641e170004, 0x5f481c3ad7b3456c, 0x4825b571989fa56f, 0x3e0e2e6b4f655362, 0x2c97bd263589ab17, 0x7582463ee78c2347, 0x70e9bbec916bccb6, 0x0f36d4da0df4cc36, 0x30ee10c22e770e49, 0x0f52b5b93f9d6b09, 0x4e1f3e3530d38a79
+, 0xa19c54a8dbefa553, 0x747e26c087af7d3c, 0x5acd907ea3af54ca, 0x4d31ef8cf53a018e, 0x5b3481e0e6e631e6, 0x27f2d6af0fd5f2d0, 0x1ff3ab052ef11644, 0x01e2dcfbf701b419, 0x6ad2af67df904dfa, 0x204c02189e92877e, 0x396203c9981e6c88, 0x7c958b47c85df4bc
+, 0xfed2ab02e210a9ff, 0x3eb4500e53357ed1, 0x70ec77b1917fa474, 0x64798f496ce73592, 0xdcde3ef7f5acd7ad, 0x6c28722996c55849, 0xa38e3d39198e4fc9, 0x2b67a90323847be0, 0x1b9c80b76dcd3881, 0x7e6827d0c31c22c4, 0xf549196c29955177, 0x70b3a2fa63f58460
+, 0x17ecf97299f1217d, 0x49d7e5395866ad72, 0x712713f371ffff5a, 0x2da796e3c6324021, 0xca7cc235c205f2c1, 0x5a191549c8fa2c18, 0x762ae5e9801d96bd, 0x3bc404f3dfe7ca55, 0xa435aa939fa68581, 0x2272fe5fa650d21c, 0x521728efcd0c954b, 0x6a87874ab6d92c7d
+, 0x08ec530527d95865, 0x213f4a6eec3b5aac, 0x01f239f264c69bab, 0x79d3914709659dfb, 0x0147822bf2e152d6, 0x597da9429eb1d00d, 0x53b186c4e48297bd, 0x780453c29f8a8407, 0x9d032b1ca55e9c6a, 0x095faacded03dce5, 0xf084a1922d90c84d, 0x3c7f3c63bf2b5d1e
+, 0x8ed82c9c8e738a49, 0x6c0a5ae703e53851, 0xe5800b12853d6516, 0x448567f95f0d4a6e, 0x48c5ce4694c05eac, 0x7abbb6d65f03c789, 0x3978f9f03a787ef7, 0x2bed3fb7e01fe962, 0x3a53d97b463f2914, 0x6bcd285fda5dbc99, 0xb4dcb1e7b4d21122, 0x6292a941103e4849
+, 0x2af115ce04087a96, 0x13bc28aed2ce02cf, 0x80084ed3b6b0bcf6, 0x7043d078ac6ec426, 0x57d2ebcfb8248e2d, 0x11037609977ade94, 0x2a47ef7b490f7ec4, 0x5e931f7f19313e0d, 0xef1ef971fe096895, 0x0a8ffbccdaa075e2, 0x56f429e40d8a7ea7, 0x6833e75b85f36cfd
+, 0xd35ce62175461a48, 0x74ec71e04d808393, 0x7f326b71f59deb92, 0x29c5d31fc74cb57c, 0xc9a1ba0ee1594691, 0x50309cf410c64327, 0x2f1c06585982d6a6, 0x7e5481e973d8226a, 0x97c6d087edd595c2, 0x737206f6d0a1c07a, 0xde2e03bd7fa23561, 0x656d72cc6dd817d7
+, 0xe10b039612b94505, 0x2d6fb956ed83c3b8, 0x4fead845e2941bf9, 0x41a9ae74c104a27a, 0x1529d99120b05fcd, 0x11eae3edba5f0c95, 0x50abae45600ecd7e, 0x216ca492fe86592f, 0x8f7fe5f6c767b404, 0x2909c3a245709855, 0xe06c3c67a52efa72, 0x229e540a8a27b7e9
+, 0x2363d7a3d678c9d0, 0x6c4da342c773bff1, 0x79c1c73458efb069, 0x0df082e7147a1f13, 0x097ef650bc872e87, 0x4b7f2a5c47b70332, 0x6ebaec218476d2d7, 0x4faf61b79d35ec9b, 0x10d2b8821a30d816, 0x7110115345446cc3, 0x233e2392b970b008, 0x0581dd500eb0810e
+, 0xb5eeb1bd02dc638f, 0x7ac02f76f7a98d95, 0x68eec55246772fb9, 0x6c96233bad65e418, 0x97f6d9c27ee5dad0, 0x7363cad93efc076e, 0xf56a5ae899248a44, 0x5fed54ab474b9cdb, 0x2541a9ed8c3cff4d, 0x1ff71adcba409ea8, 0x23f6903439f5f49a, 0x5ebc02ab425f29df
+, 0x47330d9c9cc86c9e, 0x0922b6484d6315d3, 0x2c92760fb309dc39, 0x69f2d4c42982053f, 0xf60b0b3692610d1b, 0x4288b2529eed2487, 0x19f6df8e728518e1, 0x7ed72df2ca9d2e0e, 0x000be435e9d94394, 0x4269bae655dfd472, 0x4b9fc14d4d2cb063, 0x4960151c560696ce
+, 0xad5af562181141df, 0x42fc7a987541ac37, 0x48a958d5559d0784, 0x55e915ac361b6945, 0x28d5cae68365a9c8, 0x557a923ad4f00fef, 0xd8de5906f7852678, 0x366730dded2f8fe3, 0x50dd40314dda6401, 0x51f1ce228f4648c6, 0xc60cd1b637800e70, 0x2c0425c06cbc5e11
+, 0x1ecea34de4ec51d8, 0x428b6621bb3a90f4, 0xdd5f32ea1db8352e, 0x125f8e393fb2824c, 0xa924c04732ee23a6, 0x05b648f88943e747, 0x69210c31b0bf5fef, 0x34c8512a7c606a2c, 0xca82c22008e028a2, 0x68dba8d39ba88759, 0x82a7279fafe0a9e0, 0x4172e55bebc009ba
+, 0xaa0903c842c194a7, 0x02a25da5825d30b5, 0x92fabc9304221a84, 0x63ae6bbfbf946e83, 0x3252c55aa1907d39, 0x7c88bbac57601e5d, 0x774b6b062e09ba6b, 0x779d80c17d8a33fe, 0x2fa605a0625cf2d7, 0x398e85db50b93dae, 0x83b949a88e464a67, 0x1aa90b6e44a1ac65
+, 0x00d8bbfc769d36df, 0x639b97dcdac7e245, 0x6e2e4286997776ab, 0x1b2bf57698602100, 0xe0493b978d4308ad, 0x16fc7d83fbb17136, 0xc27f3afd419c4027, 0x5ac8996edbeb49db, 0xeef91deb27083cb2, 0x6b118dba1b751084, 0x065678cc7ea61da9, 0x396d10a86ea9c22d
+, 0x79063e14e21245f8, 0x71f68e22554b9fd4, 0x90ded03c6a76eb57, 0x7f5683844a44a054, 0xf80896746da52b87, 0x2dc9cf1d0a44727f, 0x8f77f3a17026c613, 0x160bc731152d577d, 0xf4c8fa214ae0740f, 0x008fcbc4b5c4333d, 0xb193ad74c55794c5, 0x0e6d79dc26409465
+, 0x3ab520687585ee3b, 0x69ecd0abb4476b11, 0x40116d615ce7caa6, 0x7dab654340cd862f, 0x0c643cbdf1f722b0, 0x4e22e8f0481847ac, 0x578be8fac849a9b6, 0x5a92c91d6c7a463a, 0xe1c42011edf6bd08, 0x20df122eba94d963, 0x1df44d1d95c9cd29, 0x618527ad2c979ca6
+, 0x21a497654e7038f4, 0x17d66e95083f0b9a, 0xefe5a140ae72d56d, 0x53839e315a8cc027, 0x0baccf35628e2857, 0x5c2d100120fe95a8, 0x0a47af78f5b22ca9, 0x7797ddd43b58ff8e, 0xad64d75d1d63e2ba, 0x5fb696108970be6f, 0x02bf12e23e5bd0d5, 0x3d8ac9db92a62e0c
+, 0x3daf5b3ba4627ac0, 0x6c98ff5285b52420, 0xb4885b91176bfc22, 0x38fb84158b8c3f0f, 0xa9b5b6dbb2377aab, 0x68ab86180fd8d43d, 0x1d236cc012c4ab78, 0x2d4b375b30da0712, 0x3ed7120f613bdfb0, 0x4de3f1c513ed06ad, 0x4a04841acec7d91a, 0x7d1b573f27594e36
+, 0x6b71654bac4e167e, 0x15e6407197c7436d, 0x1b4b2123e788b92a, 0x66278be32bcd713e, 0xcf31aaaf54702468, 0x48566b8097851ac4, 0xd48a06a5898da730, 0x00af4e04ba87862c, 0x9da474c9454f228a, 0x02fa8a701a1d55ae, 0xb72e4b299b467227, 0x4c4f80ed606e620a
+, 0xcf594ae7453bbfe0, 0x502c363b8abd92d1, 0x22da668e7767f41c, 0x14f1a98bf7e5e593, 0x5ecd14a4187635c1, 0x60369f5a5d787276, 0x1012a0458a4dec24, 0x75a59f9428e9ae1a, 0x6f9e13e07e9efe69, 0x6fd9f4de56241c82, 0x86a417aedad9e177, 0x381107ef34fe0888
+, 0xda76a2176c979ca5, 0x449e8be61bac95c1, 0x201ebbfbbf27376d, 0x29790cc15a4e7ccd, 0xb51c7b2ebfcdff91, 0x0f3c5b76961565cc, 0xab01c9b01a8fa53c, 0x2a30e527c88a1bc0, 0xdbf2216dd00153f1, 0x370dc4bc432e0815, 0x8980ee99bf0f376c, 0x13cd165b4430e38c
+, 0xc7b66be019616235, 0x7de52145c16aabe6, 0x6fce19a4c2160133, 0x7177b857ddd54f7e, 0xaa70a16e210ea129, 0x0412f7e6ae45cdac, 0x23c54b48ce6976cd, 0x4972202ff0622d47, 0x553682281363ac67, 0x4c5d892f15f94243, 0xdd3f60443ea0baad, 0x5b1ef37966cc5b73
+, 0xe0f0e3a31bef51e8, 0x0b2a541edaac6981, 0x69539fab5be9555c, 0x3e624340a1d34ca0, 0x37db080a75ef381e, 0x57366bc799278e0f, 0x9cfea6d6e5918b89, 0x65314e20020383d0, 0x24a752a3089995bb, 0x31d8e53d80cf6d3d, 0x9eca917c33eed711, 0x4700a89969b2e222
+, 0x78a826d5bb364329, 0x5b341783804dd4f3, 0x16b3921143fe7a9c, 0x2119679d9fed6f03, 0x84284df0b4afd4ba, 0x3b8a5e7af8f74954, 0xe663318edf3ab780, 0x2193954419aff9b6, 0x9d6899d7297175c5, 0x01fe06de9dc2aa6f, 0xe3da5400551d83e3, 0x32b973ed718172fd
+, 0x16a03d2cfd5a3d34, 0x4f36a37747bcc291, 0x70fe0abec210ab43, 0x69cb9936162b2ea7, 0x4f9b5301cadad19e, 0x32a2938355c03cd6, 0x2e4849a3107eb06e, 0x7a30861eaef4fe43, 0x87095b2a71c6b2c2, 0x26904118df8b2972, 0x4161551e03f82809, 0x5323b605512125a0
+, 0x4791ec410c13ac42, 0x3d0abf87d56b11d1, 0x4a666e84fe9ba3d5, 0x4f3e5f59eb34aef9, 0x3c801b09f9d4c694, 0x53985943e8909586, 0x0c99618bb496ed1c, 0x61da8dd14cdeca2f, 0x8810a12466ea0030, 0x2dc8ecd8c641d614, 0xaf343cf2ee41fb99, 0x10563936c2979426
+, 0x624fc1ae14ea0ebc, 0x6df482493f9e1b72, 0x916db66b075e1de0, 0x6372c81016d058b1, 0x7075f92dd6476b2f, 0x05cf92e8b4c37eb6, 0xd9f61e57e037c1fe, 0x258f622f3f28cfed, 0x6b6082dc871927a9, 0x2084603b65e7324c, 0xd2adc29e4deed0c1, 0x45b185654f4b6a7d
+, 0xc67d6abba2cd7077, 0x70e37e300d70a93c, 0xcce5e4eae0abbc54, 0x6ba8f95309073cee, 0x38e483cdf1807dbb, 0x0a25b8046c17d45c, 0x6cf18dc8cfd49ff7, 0x2c46fa9bdc20c983, 0x47491c3842059704, 0x3b907a5142ada29c, 0x891f775524f0bad5, 0x57f62ce63c84ea8b
+, 0x1ffe528f4308fef4, 0x58633e53ed640845, 0x4f3f4cd88b8f7992, 0x1b485ee1731a3679, 0x8859af0f84cfd821, 0x7c194775a2626e5c, 0x3c218f391e18efd1, 0x273456b04eb50e30, 0xcdfb1fd0c3750ac4, 0x379a20510493866b, 0x0d7309a5b41df649, 0x04fe6c30c2b3400c
+, 0x5dd110b2173e006d, 0x5ad1321def2db1fc, 0xef3afacfaeae905c, 0x2a586a1df422eefe, 0xa12f1ec34350cbc6, 0x787f13361a7d8dc1, 0x834a775220575674, 0x398f935de6dbc950, 0x2372945941d6bade, 0x14b63d1596a87374, 0x59e2bb71dae3010b, 0x6df6892578758e92
+, 0x18a91147ff0c3475, 0x29339dc736f5eda7, 0x94372aeb17298090, 0x03cd4b6762c4e56a, 0xce5454a4123630d4, 0x22bb03f7e1b24d06, 0xa78d2acfca390603, 0x635418dfc37f8b73, 0x8dd7c2ee0ab9662a, 0x09c8d1424647357d, 0xaf10b9e2fedfc4a9, 0x52805f675de06d66
+, 0xa205c36834ce683a, 0x4a8782e35b58269e, 0x4a952d8a39091ba7, 0x68048b2d283f0ddb, 0x0ddc690ff013cca1, 0x493acf228058bd0d, 0xfef16c2230d30df2, 0x2785fb5fbdbbe4e8, 0x20ea6062fdb081d1, 0x3f574f8a73cf7908, 0x66fa42434d03fc08, 0x356e091e12df010b
+, 0x20d3cb8185648b99, 0x5a2b83332dec71af, 0xb4204e7f674b1129, 0x10c089c9040d8234, 0x6861eec4fc63f315, 0x67d870537ccc8f73, 0x79b7be27922150be, 0x00c2b5860d903eea, 0xf92d81b78684e4ae, 0x46b1231b49a2d411, 0xa4ab75697858d0ef, 0x5f0db595046921a6
+, 0x83fc50168359a56c, 0x31a62e680a5c717d, 0x31a81b5967cb9b20, 0x71f8e71498a8e62e, 0x4a9e14333cfb805f, 0x79e12b4ca670ea86, 0xcaabc8af8fa0d204, 0x15134e528e6bc672, 0x30db5147dea6af32, 0x70c0b127445c7e38, 0x4b6eec2468ec95c1, 0x5f63f9eb908145b6
+, 0x6a7868a6cacfa060, 0x72754038f1ec1fd1, 0x0891f310df745f7a, 0x0c9658009b7aa5fc, 0x1085b6c54a1c35b7, 0x05a78950af27371b, 0xefa75ed68da664b9, 0x28193357ef9301f2, 0xd210231d72688084, 0x0c4722704a2a30a1, 0xc362402a362d0899, 0x32c18e242663a442
+, 0x9014857889ef7219, 0x68d5e66737eadeed, 0x2a80d6a2ab1f2ba1, 0x32f9acb9e1aa8c73, 0x26949b1346ca4325, 0x4318b819afa37b98, 0x644e741ed72e3c90, 0x70b52851302b6904, 0xe53a7d1e15e1d234, 0x3516d7f96ef3ad01, 0xa3240982684e76e7, 0x74a91ee1f288b565
+, 0x77df389b8242128e, 0x413c379e1268b023, 0x33c254209ea6bf8a, 0x70b91584d25c9e0b, 0x158a9cb257c45f45, 0x3738561050e086a0, 0x0303f6a517843483, 0x19c30266488a2947, 0xc266cf4e80c9fc0a, 0x62ca21b9be983a18, 0xc1fd17de230e7183, 0x5dda4862cf241baa
+, 0x8dcb31571aa1d430, 0x760480607337cc65, 0xd7ff642ec7b290e2, 0x61f97996e29cf758, 0x18e72489026a0a2f, 0x4f0b9dddc0b5718c, 0xae46384365a11860, 0x63d2350d7c1df8bd, 0xf0176f562f8629d6, 0x73bc81248804b345, 0xba58474a0daf1045, 0x77770def17498083
+, 0xf79a0352aa7eeb65, 0x2707e8b5debc592b, 0xb06b1e71d7a99cd0, 0x65e97567c8fe0d73, 0x486f3856e13e7626, 0x50de3156337ab93b, 0x1be4d6effdd124f7, 0x4d58403c76f0473e, 0x7bc6b7097c783993, 0x0112ffdf51a85117, 0x268d3ba82267a5cf, 0x63de8cf19e07776d
+, 0x03b7f01fa786a02c, 0x358505ffb43fc5f7, 0xb335dced80426e71, 0x7d1ed9bdff932f5e, 0xf0fc43032119bf4e, 0x65ace2914bf57449, 0x3e7cb029731c4b3e, 0x4c67d23b8ee2bf2f, 0xf9e016fdb46d6077, 0x079b11429831e813, 0x5204f1f3f09907e7, 0x4246d9cadda327ad
+, 0x6594eb84824dc52e, 0x60a8b8eb91630a55, 0xddf1ccc868b0f311, 0x4607b9cd41d6eeac, 0x603b69aa55e2caf6, 0x51c689f5e5a0011a, 0xdbf7e269da5588f6, 0x47ea73f6e792d570, 0x811d62bdd7435772, 0x5f2d28030f8e6aa8, 0x0214d3053977aa00, 0x6513c0be4c61ae2e
+, 0x026bc9ae4fed6c91, 0x21f3cc9de5d5941f, 0xfd4c1c7af197bd19, 0x1459c22f2a67f567, 0x34e74a259a7167e9, 0x093aac658d9a1aee, 0x23819fb7c701e784, 0x24a380f20acd36bb, 0x62b469ef30686e1f, 0x59b3429775216465, 0x46bce0e7fb2a7b02, 0x1bdab2ac6702aeb1
+, 0x72d3bab333fed7c6, 0x6dfe62ae54757ffa, 0x92c912d0e31cd7f8, 0x5af090da6a033e44, 0xe542380afe3516c0, 0x3cecc63e8059faff, 0x05d93efa14f84cee, 0x0cd0d735b2bc51c0, 0xdc0d65ee5006f717, 0x18eb83338cd44e4c, 0x94364ef9f7a0e763, 0x3a703c45b5b79b5f
+, 0x1ebac624487baa62, 0x003218158c03b754, 0xcfa845f2c415578b, 0x23075abc3f7badc3, 0x26f38842c86eddd3, 0x6a2efec55b6d91c4, 0x33819136844a3dcb, 0x771006752a0dd159, 0x4f75a6e8564df9dd, 0x047c12f418d78b92, 0x107ecd0464130bca, 0x0286c41cf751ee93
+, 0x91b1b88cfa3409d6, 0x7a9da6e4c8c225bd, 0xcc19766cfcb39bb9, 0x5b8c15aa25f24768, 0xc634c02c97c733be, 0x638321e7cdc0e1a9, 0x57bed72b92740e9a, 0x1f9cc67c4e780e09, 0xb2db50ce372748b3, 0x622390c699692705, 0xdc2166cf52b4aa73, 0x2d9997fbfd281d9c
+, 0xb683cb37808c7422, 0x48e077b394f27c6a, 0xaa9e56e70a9a2cbb, 0x565b15f48ef22b09, 0x3492f8e0f0d59730, 0x25ad9ae790f6a474, 0x55f94b70439f7ffd, 0x60fbc4761f60d147, 0x2fcdecbae5cba6c8, 0x60d3907dfd30b1f1, 0x06132ca073ecb802, 0x77c16d5f82650f5d
+, 0x65d5d0b321bf012e, 0x1d8230c02bd7afd7, 0xae5dee32ad1fd1e6, 0x49eb4eaa577e0a0c, 0x80b07fadffa62071, 0x212d0b36432f2580, 0xc105d063f6f5d87d, 0x439d2da88e83ecbf, 0x25061be2b2a6e9bb, 0x602dbde636ecd30f, 0xc31c8a5678c11bfc, 0x0da2ec0c791c4434
+, 0x494a6702ebd3ca8a, 0x7706b177fbc70078, 0xa0d923f7436e17c3, 0x5352d29eef25ea48, 0x625a933247a347c6, 0x67b0b475011216c4, 0x74df29a571bbb5c7, 0x3d80890ae7638511, 0xc69f4ff3a09f98fb, 0x1af46d1de77327de, 0xaf5419127803d1f7, 0x5c6b1c0fe26b6b8f
+, 0xf9d2898eaff8d376, 0x0236a56a55c21cc8, 0xaf4a10854c97b1db, 0x0fcd1300b182d51f, 0x896f551e5dddb547, 0x5da4c2eb48f1366b, 0xffe2d68bb9eb82d2, 0x7c66cf6cb2ef4cb7, 0x21313dfa0b5b1cb2, 0x1963d5ec5fffb471, 0x9b79ba03e7b8dc8c, 0x73a5b065748222de
+, 0x11f618700b377379, 0x238106c5f861866e, 0x32330cd5c0e077ce, 0x62ecf690a361d071, 0xac9cd6eefc23f1bd, 0x47275551c2c19f84, 0xad8e7bd5ee6cb60e, 0x7364b8069cee33e6, 0xaa7044ec211b56bc, 0x6742ab7e6e4e21c5, 0x81b8d4fca63e031e, 0x01f5d5aaeda25bb7
+, 0x9ad3e9e89d85ab49, 0x429a895eaaa04a37, 0x81f10de3c18a69f4, 0x65feb0fecc8c6358, 0xc46d7efafd422aba, 0x59a633001933be68, 0x2fe7f4c38842e8b7, 0x200bbe14c3386a2e, 0x95538e34d23d2260, 0x29be712859f7c4df, 0xe1c0741312c8b473, 0x18ed5c36eb363d91
+, 0xf97d5c75e55bfccc, 0x2e8825862fb23092, 0xf8a9b28891764220, 0x41688a475d6094fe, 0xf9accd4dc8303b1e, 0x7ca15f47726948e9, 0x49b81f50feee7499, 0x7681b4f892ecaed4, 0x261869e739d8d767, 0x10e1b2fa41a75abb, 0x4983005e2e1c2c82, 0x02b7f9d8fcb3a91a
+, 0xd98d65e78e7b9f66, 0x43f503daf84e63fd, 0xfaf7dce82ab1c791, 0x39fe687010b6be85, 0x6d2cbb64fb7fa175, 0x4043579c3740ea86, 0x41b1cb9f76e0102c, 0x726b0114af6aced8, 0x11baa3edbef2b73d, 0x3be648d1315909fa, 0xb6344e40049d2111, 0x28921b0abc311e27
+, 0xd29361fd8e8da56f, 0x4ac502b07b28f917, 0x1eef67d4510b8630, 0x737c326b11572eb1, 0x9234efe8ec438d2c, 0x22c49079eb038670, 0x13244c23055f2c18, 0x344ffe71e17103ed, 0x2c65a3f47bfd1056, 0x0438fdfede70fbd6, 0x6ac1e851f72ff65e, 0x1574e3b649e476c3
+, 0xdc5cc89931480327, 0x1d85445c67cb7048, 0x9d71054013d30ffe, 0x4dec44d8cbe25bab, 0xd6b8aac8670e49b8, 0x5a0f19f1fa459b61, 0x75c233326d83fee1, 0x69ca5ee63c9bdc74, 0x7a33a5a16714efbb, 0x209d8da5e0e4a035, 0x9b4572e1e6e92122, 0x4c0d8c596e57f42b
+, 0x5949b4d9e0bbd51c, 0x4675c1cf64aebba9, 0xa8791ceffe8558c4, 0x47c317d4c3ac10b5, 0xb22de6b77317583f, 0x255155dc8d32edb9, 0x7b09723e02522d67, 0x30ed4b9ef0e6462e, 0x22accb6676a95047, 0x5526d4f393e6d308, 0x0f4c7a83ee25c1de, 0x3f78f81d7c097871
+, 0x1484823ab51346dc, 0x43e8e91ebbb82cf8, 0x855297b029c003f5, 0x0f16f5c6fb51592e, 0xf54f4f8869159cd3, 0x634ca6f6490fa0fd, 0x6617ef45e9cd8fca, 0x2da4c9a6a83d630c, 0x374ee5c45e09d912, 0x796558dfaa0cec4e, 0xc5cef4cd36a4c27e, 0x28401dcb11137b42
+, 0x822ac82602224e3d, 0x2b04edae5e8d6e6c, 0x8b0b78e5696fb06c, 0x06f3229a7243d703, 0xa8834b7b2245ec4a, 0x08ce0e54a9fa8a7e, 0x81ba206b6456c459, 0x2c1d6c1bbb52ced6, 0x2f33909afeff16f6, 0x604431af1ed982f1, 0x6a8476a5da77d214, 0x2b217f5c7e384388
+, 0xbb75d05046de4c4e, 0x34e934d108a0996f, 0xcb4c13def18696bb, 0x4291d7afab5cd8eb, 0x6fa4e158a205689b, 0x1ce71b4a6b5e1782, 0xe1af65e28457a7fb, 0x69a121857482f041, 0xd7bd31a1c8f9c12c, 0x52973719dbd6ad44, 0xa6acebf9cc5f18be, 0x50e5ac2a514fe90e
+, 0xa096f0423c7e2b73, 0x3ff11551cabd98f3, 0xd8c6ed1448eecab3, 0x305831e132db407b, 0x691ff7fcdcb7fb85, 0x5c52e6f3a0ae4ab5, 0x354eff46ae47e795, 0x0f2355d7fcfcc941, 0x530f050dcf548e33, 0x431274c516f61298, 0xb5a85488ee25e66b, 0x19099434b0f65880
+, 0xe5dc623e3babb538, 0x7871cae3b0a2726c, 0x8a28bbbf676523e9, 0x04fbb56b6bd49c7e, 0x9df31abcee96e05c, 0x1de36fd9ad5304de, 0xd2819927ef07de10, 0x5afd6548ec345c8c, 0xeeacf11ff57b6f0f, 0x7d6701241c8865a1, 0x54aa90dfcf52f82a, 0x7698bef07cc07c46
+, 0x04daa787e22eb67e, 0x15d461b64bd952ad, 0xca314bfb6c89a5b2, 0x2654fcc546c27687, 0xf189a2cfd96caff4, 0x7771c4c644c747af, 0x5666e1119610ca54, 0x316b15d7804961b3, 0xee0c84610e1eb836, 0x4dd7128ca90f1378, 0xbc508575f537cede, 0x17ede0be5cccc4ea
+, 0x507ac955c04173e0, 0x39ca8d9a7f132ffc, 0x24f55ad22a159daa, 0x79f3e0923e4adb09, 0xcab7f11e87f3ddac, 0x54137f925fb8bf28, 0x6a30cbd334053a6c, 0x569806b9a8983c72, 0x3593862bd49b3052, 0x711c94e6076dc6e9, 0x10f1679dd17dbb38, 0x5c97e53e863d51d4
+, 0x1bb36f907f8a4183, 0x0bf5ff578ae08a44, 0x04db7e5fd7ac0c2a, 0x05d93d32a5413284, 0x5781a742880dafcb, 0x135864180ec90ce4, 0x0a591bbc2e411072, 0x39c0c882e1a440d4, 0x193a84ac40bde23e, 0x0edb094d1652c11c, 0xadaefee872d45f22, 0x72695fcb44976098
+, 0x05c86cc33fe7bd09, 0x42946b4be248975c, 0xedbd78462105c02c, 0x625f29c07178d88b, 0x84c77873af8b992c, 0x5624c9edababf824, 0x73940f19221c0e9d, 0x6047f5baf0247202, 0x75f8fe828cc77f56, 0x167c134b770d92a7, 0xd073694cfac1a48f, 0x6747cd0df261d898
+, 0x422e9747b8deb773, 0x3892a45e8634d15d, 0x0b592cb6e0bd7da5, 0x74fc9a2b531f2fc9, 0x24782f3430aacd43, 0x5f92bfdf6fdede59, 0x175dafb576a2bb06, 0x01048dacff30cdcc, 0xdc8f3ee0321b9df5, 0x1c21d8a1d1817783, 0x6d9fe1c54cd3a0d5, 0x73298c741cdd6020
+, 0x3d3cdc03f31f81fd, 0x3aad019164d1012f, 0x6d5a5a7572c73ffd, 0x2417bdf7dc869d38, 0x6ffa7d46458e315f, 0x3cdd522ffde929c3, 0x06a17a20c2adc83b, 0x535f10d95f839a56, 0xa797344aa6648cd4, 0x35633828b4cc4655, 0x67be406a2ff668ac, 0x084ae76a8e00b59b
+, 0xd4cdd1104c5b7fc2, 0x2bfe747aee7d325a, 0x93bac5225864d1bd, 0x010e10174351acdc, 0xf8080d30ab4b9df3, 0x1a31a68c35550b2a, 0xce00e973a5a0ac16, 0x7956ffa4b9903290, 0x28fd83a277041969, 0x64e6327e373e2eaa, 0x489f4ef4365b39b4, 0x423314a3949cc9c9
+, 0xa0d01b0a11211ed4, 0x48c855dd2ead698b, 0xeb5ed796c6a60041, 0x3f588881923de14e, 0x661a1482b0faf06a, 0x39b4796da52acc42, 0xcb7ea05d1b4440f0, 0x0c8c65236cca2d82, 0x3f70ba814d2d2a2d, 0x1c7246e4c79958e3, 0x5ac1b7c5e0297435, 0x52e64b0cd3fd65f3
+, 0x0f49e6d4137c24c6, 0x45837e8d3b728b02, 0xd845c52c9fcae330, 0x4ef86690acb3f570, 0xd7c108424fe21943, 0x20b2c176746fd439, 0x98a8d44e7a2ffe70, 0x5e2db736b7fd98d0, 0xd09c1b4a1817ae91, 0x157c10d2d586566e, 0xef341b8c53d098a8, 0x26860da500a08787
+, 0x6462a948f4367852, 0x2ad762ebb60b4dec, 0x95d88977cf9f5545, 0x7927fb22828593d8, 0xd13b480a325a6061, 0x7f05b689bad83f64, 0xa71fcfacfee8d664, 0x7ca2ba3e75e25c78, 0xc6a5d0228b6de588, 0x01b781668315265a, 0x5520b6005fa1206f, 0x455a385f301cd5f1
+, 0xfc9f398269f2677c, 0x350000661a6a6f43, 0x7b12a433f0410711, 0x72f7d008dbcb557f, 0x71b3bbdcb02f183b, 0x3d030cf582db5457, 0xc443cee72be1cf69, 0x1b4d00368692a34d, 0x0e27a72fe7b67c66, 0x7fca35133788ed5a, 0x7836c9ba157b3842, 0x4b7d3a719eb5dcad
+, 0xdad4315721ef9d7d, 0x079db42222ff9401, 0x4828690225c147d5, 0x6f4bdd575f1f6010, 0x52ddc365d4ed9ffe, 0x5c4cb3a1310da36b, 0xc8a50c13988bd994, 0x263f085702f701a5, 0x60ffb04ae185c98b, 0x15d23163bde49d50, 0xfcbb7daece61441e, 0x700aaa76174cf10a
+, 0xa0974ebba5c532c3, 0x2b2d78e0a2a94844, 0x7b3cffafe3a3d4b5, 0x581eb518f0548d3b, 0xd6b0dbb25855e359, 0x2b6330338eb6ef8e, 0x39f41d537409a3fb, 0x7f5388aa196244c4, 0x817acc813715b2d8, 0x6f2176ea78879b91, 0x78ffcc9d764c1cc0, 0x66146787ffe9c78d
+, 0x640d947b58de2e1a, 0x26cc0bf483656043, 0x7d80680e714a4158, 0x43248930ccba6858, 0x0af599461ac0d864, 0x522fed0581558361, 0xe3ce1add657fff1a, 0x3e20b00c7420f02d, 0x53be2e18351391e2, 0x3b2926fd27c917e4, 0x9db166d5a16b2feb, 0x1c84e95940e1c9dc
+, 0x896577691742b156, 0x7fc889386efdeebb, 0xf96583c78cd4463f, 0x5fe7b058fe246210, 0x756590b9b0e4663b, 0x194b35e5569c86af, 0x00dd996e6712a5c7, 0x5087954b47b32745, 0xa112171e9b2aa910, 0x5b915d2dd2496ae4, 0x49faa800248541d0, 0x0194293d897d6a21
+, 0x18852429113c4795, 0x22ccce2eb4beead3, 0x69a980fe3e82d7ff, 0x658f4e284eaa8c21, 0x94bfa850d6e400be, 0x347247332c1d72af, 0x658df533fd047025, 0x18f728337ad978db, 0x35871eb0802e0978, 0x4b5a22cab756ad63, 0x712a794f1883c0df, 0x7f54788fc9bd854e
+, 0x939af7a16e6b4a95, 0x64c0dfa93f9a1969, 0x502170d51fab21ce, 0x7bfb46a6e38c1be9, 0x668144c8e047f646, 0x70eb4024f9af9605, 0xe8f85e2acf50cce4, 0x631c8db431cb9347, 0xd08ba72b9180514e, 0x7d3646e695db333d, 0x4fa9f0fb1f667912, 0x4170f23d3204c211
+, 0xb110fd10b82ea2cb, 0x1fcdbab9acc00cec, 0x638cebfd695e4c4e, 0x2680918531bbae33, 0x7f2ea2097101f813, 0x61637809481e919c, 0x66cf7f1f3d1797fd, 0x54ece071885f409d, 0x6a4fdbe3555e6966, 0x4ce3770a55641029, 0x9f9a58883812997b, 0x5c7945089a3f2529
+, 0xed398b144e96d9ca, 0x24f39679b8c8235b, 0xd7d2fed6350b3491, 0x7745383ad7351b55, 0x6e0d55a38cdd226f, 0x0efff2378a4f6f0a, 0x47d21063eb6a46b2, 0x59579fef5af3336c, 0xdf34c17312e9c1ba, 0x58a5eb0cf67683ad, 0x3ab2d44602e42205, 0x46479723fa7044a9
+, 0xf18d3e1da513ade6, 0x2733b5fbc33cec0c, 0x9977aad90fca9bf5, 0x560600a55c24b9f8, 0x0aa90e64cb69e874, 0x164833be18336f71, 0xf5aecc96ce075c0c, 0x0351154674ad6238, 0x753291dac51b9a1e, 0x48fedf82fc0991db, 0xf8e2a81a275b8ce3, 0x5740b4530f44ac66
+, 0x2cbbcda3292d3103, 0x1b9a5dcf28e5d667, 0xa101b46665b93b20, 0x6e9c7500171ca339, 0xb2819fd13eeb3aed, 0x3ab18277cc499df7, 0xf5f79fac4699c086, 0x7fc5259e44597000, 0xbef661277e33bfc5, 0x2ba2ddeeeeee7fff, 0x03162059addc712d, 0x0e4ef11d2ebb1865
+, 0xfc70a415ebf6eacd, 0x339e3cca338ffb23, 0x5a20cc9cd53783c6, 0x4089a5f0c73bce1c, 0x95e9e03b43df4b23, 0x1315035c55f417ab, 0x4e8c694537404cd1, 0x3b00c09d8844f2d0, 0x045476c6b73f3f30, 0x690bf08f50d730d4, 0x8deec2016d42e542, 0x42d01ada79eb65e6
+, 0xf87b0610aae71cc5, 0x427c00b69d6d1afc, 0x95984a4f061e6e1c, 0x1fe7480a317dee35, 0x97f226baa2bca9a4, 0x1221a00c03bd38a7, 0x1bc3dbfab23a6f55, 0x060d2c1febd791fb, 0xbfa5798389f6cfab, 0x1ac8929acc9f38eb, 0x161d46c8f4fd160a, 0x1e850b8fbe0855e7
+, 0x2937edd021b65677, 0x15db8d4ce3f2477b, 0x49a6a0f2e59b001e, 0x6970d8659285ab6a, 0xdcd378c53d2311d6, 0x75a0784e00ccddcd, 0x6b01cfd0d6e3a499, 0x0bdb2d16e1109475, 0x2dfb8d50bcc7e920, 0x181ed3d8cbc24997, 0x32f31d39bec93b9e, 0x00481a64c9fe503a
+, 0xd864f68b26f9d15c, 0x4a5022bb556d5904, 0x174954d56a0ff41f, 0x381672f4eaf8e38b, 0xa0a35aeafbba4ef6, 0x052271ff33b659be, 0x326ff226f8682b52, 0x002a40fae39e04b7, 0xc51e4e260d647459, 0x4905e6a66a3e299f, 0x045dc831bf70b399, 0x02b7123ce92701b0
+, 0xa03dcbae2e02043a, 0x528b9e8e799408a9, 0xbbe6fae4d442864d, 0x22ccc76bf8577a50, 0xa4da0b980c309cbf, 0x603213a1d0cf34aa, 0x42e36d4a9ebd1c8f, 0x504bd0564e45918b, 0x2ae9479fe94f3b75, 0x7d8d09ea25fb486f, 0x79e852da635d1835, 0x452c78a9a97f091b
+, 0xeed71cd216b8df85, 0x4417b94d3ba0452b, 0x307d515e59ac424c, 0x6d506e47ea8aea7e, 0x801f983fd7413a53, 0x24feec3ac086a607, 0xec8506d96e2b85ac, 0x5003c0389ca98ea1, 0xfd7384adddaf5be4, 0x551b1e2f6afa9c2d, 0xbd4d4b080cb6527b, 0x001a38c3d3f810ec
+, 0x64f7830889b41f45, 0x394c4a3b1050670d, 0xf54eb346467f20f5, 0x695df6f23a906ad1, 0x23ffe20fb8dca72c, 0x0973c6808fceb5c5, 0xdf09fe8825e6afd3, 0x46cb827ae6847b5a, 0x98b7ad4ba26b0d08, 0x0bf4d8047c148b6e, 0xa5d52a742b6b8a01, 0x607b9455280375f8
+, 0x3bd7b363f9ef98a6, 0x2400e6eeb84d2ed0, 0xfd0a2706049d9319, 0x6cd3b32bbca11d44, 0xfec0c39820e3e4d0, 0x6508cc00311a6d1b, 0x4205d8686b0622d5, 0x1286bff4fb446ad8, 0xaef9f7899cfcb9e3, 0x56e56094be5a7965, 0x21fe79623997b0ea, 0x1aaddd143dec2290
+, 0xbe025b9683c66a25, 0x3c8868f777fd7434, 0x2e93cf7c944eecba, 0x3522bc2afb422ffa, 0x90cf169171869439, 0x0e90f30a5e2707d1, 0xd4c3eb8034edd09d, 0x64ad3fc46336343f, 0x27275a18fd1714c2, 0x7fa25273ca906867, 0xbb91cdc2e51f280f, 0x14f32cac12124fb6
+, 0x9183eee595b599fd, 0x294dfa41b88996ac, 0xea35a9e39d25f41f, 0x21f302358db6aaa4, 0xda57dce02333f87b, 0x377b79a8ff20068e, 0x3c7e412241bfcb47, 0x2b3333f9ab4d6a9e, 0xe9b8f8f18152603c, 0x3a8d9ab4a6ca8e9b, 0xc7263af76b23553a, 0x7e981b09f1367183
+, 0x5ea669090446d925, 0x318f921f64c7ae2c, 0x35f278459276e3ac, 0x03f99fb7c774cd64, 0x6fef5b2022bbc1fc, 0x148fdd72e7cf0aca, 0x9052c9d97a31b7c5, 0x2bce854128c4fdb8, 0xb9105e7c87354939, 0x5dc93aa245ee253e, 0xd45ea9536b77df08, 0x53465aa51bccb203
+, 0x255f2806db8d20ef, 0x74bfeb8b5b60a17c, 0x7b66c25c79b0da8a, 0x22c83121c496dad2, 0x31298ba08916fe49, 0x60ee71715d431b29, 0xf1cedddfa9277f1a, 0x7ed7ac31e47400b9, 0xb243ba00277c4837, 0x6c3d62d18a4e88b6, 0xa7f589068a8d7d5f, 0x401c01daa9e16900
+, 0x22f94519393baaf2, 0x5462c7a3e9c3dad4, 0x6a5f6117a98fdf1f, 0x445e554bb9d83bd0, 0x2554bc5d3a0ce398, 0x1354e5c652bbbd6b, 0x1c30cc11b0898454, 0x51bd0897f180941a, 0x3d19a2ee610e40fe, 0x22be507a0b66aac5, 0xda98a70add3b0203, 0x13de1ac5289737a2
+, 0x5c9642fcce0c8cac, 0x304a9ca9db58bb09, 0xdadf2cf81e054983, 0x46856b2c51466031, 0xc329714336f05f67, 0x15357d6eb08dddf3, 0xd6dd5f488b91937c, 0x160098dd8e4db9c5, 0x72be9852fbd27331, 0x256dfe6b1d85a415, 0x187f573586079ba2, 0x499b4abe5785925b
+, 0x1a3a18f81931367f, 0x78f1bfc04c6082a4, 0xbe7990e86a7a9384, 0x6f78868e6c215f70, 0x2bce11766a26ac92, 0x412915d262b13878, 0xe49666f453530f67, 0x0c20b77397654613, 0xe3b5ee5e61aeb260, 0x42f97fa87480a973, 0x0b7c775449750108, 0x4b66134524bdfe77
+, 0xf8e379e2997eaf9a, 0x0057c223bc0b084b, 0x3ce75cf033e20aed, 0x0538b62287ca9490, 0x8acf98e3df58ae33, 0x2c60285157fa1159, 0x72f796646c7286bb, 0x2708d38682bf2f1d, 0x05ee89cc279adfc8, 0x522a9f828bd9cc92, 0x6fb3e7c90aafba88, 0x5a9a83efc2658834
+, 0x0ec3eac67f6637d6, 0x332868c1702ff418, 0x7aaf5e5ce28bb8cb, 0x0805793409bf20a2, 0x4410f1ed1909461f, 0x0e2d4266e2f54c53, 0x1f3b1fc944845ff6, 0x08f870b473e23745, 0x51d789b36088f437, 0x689a50ffc9fda20a, 0x6457b49e9c5e6d03, 0x675da23ac529883a
+, 0x80ea04d2480b5c90, 0x647753e9128c6352, 0x73efe917abe04c49, 0x42c74015b58aa638, 0x8720b0a543141d72, 0x3773910384875818, 0xc94135e1f5c8df4b, 0x67c97733e9e67098, 0x5ae4f97a4009d392, 0x31fed41d198e85b1, 0x0f8a73deb320b832, 0x54008cc619ece9f1
+, 0x9ba6ee13d36f32e2, 0x41dcd793a64dda15, 0x1c50a99f2d97122b, 0x7e48c550a4c79918, 0xe492d6564c12a285, 0x3c4f3ca0d7f2260b, 0x43613eb62517a407, 0x75fcd132825cfb3d, 0xdb071148272fd59a, 0x28215c81c44e8095, 0xd5ddda85909a7912, 0x5d609fa5fe829846
+, 0xc373160e9b54eb13, 0x1a2660b91b9ae050, 0xc0da2b42837f3d72, 0x38a4f9b46cbe6d61, 0xa99d1305254396ed, 0x2955401c90674588, 0x16b2cb42d2fa6e60, 0x55d34cf71dfaa9ce, 0x95d16069e5dc419b, 0x31b649eda7386923, 0xd3af92bf94573e6c, 0x11d2c1ae64541636
+, 0x175012ee96a7738a, 0x4a1475777c0e32fa, 0xc09b64584d085420, 0x0a6a6f80b8587bda, 0xee3dd23a47ce2ea0, 0x2d20d216583afdcb, 0x15d1a8aa851bc1f6, 0x7ef8ac5dd831762b, 0x16fd31a098e04034, 0x3883bd929de60154, 0x8aaaef15a4051a29, 0x346f70a95334ae56
+, 0xc7687bf40a790378, 0x7c929f29718ac20c, 0xfc62bb1ebddeee2c, 0x539414bc38589cf5, 0x8f1f7a2a9593cd90, 0x57a536feecc7d59a, 0x7fe9d54b4b1ea359, 0x2018391503f7e637, 0x847f4664bb0f7919, 0x5c9edd2a7d9228a2, 0x4faad518fb8601bf, 0x497abea68bf84378
+, 0x30161857ad7199b6, 0x357a0e945cb123b7, 0xeba53993cf95415d, 0x2e8411152065ecc2, 0xb5f133df1e85021f, 0x14c7cbd2fbcbf2a4, 0xac5bf233f169d374, 0x5e8552101cd81985, 0x2b972b2d91a9440e, 0x75dc5fd52888ab00, 0x83218f0ba0f3981e, 0x551e27074f3e9895
+, 0x5008ecfe5ced4d68, 0x1d56f072864721df, 0x78b654fcf8511e17, 0x72bc6da022ef9080, 0x7a8985b0511b0dd9, 0x1fe463363fbc5df8, 0xfc676b0972a397a0, 0x09b6334e4934bdf4, 0x5f79215af96a406b, 0x35de66c1df33073f, 0x665e552db9e98390, 0x6fb087e1208fbe02
+, 0x0bc89f8815079a79, 0x7d617a988f9bf5d8, 0x55b5c0fcb551ced7, 0x49459a6a0e4df1b2, 0x3e13ff9fdeb4376d, 0x06bdbda934511f12, 0x0aa5bb28889e305b, 0x561d5a75fbc95d86, 0x4ce53c933f78a4f0, 0x01b92ef9e0bacd86, 0x22c00faecba66cca, 0x16b8d98d5b2b6c54
+, 0x54f67e31cefd20b8, 0x7ce877b9980e6417, 0x57c7b7086d52da2f, 0x266c5e7895a98798, 0x5029eb50d09c8a0a, 0x33006dac868c2716, 0x6dfb586b918e2c63, 0x017e486b1ddeeb0a, 0xd031f8763539f444, 0x5f974beffbb44405, 0xd8e618d3af3563a1, 0x4fd8252e896da05c
+, 0x50fc19c2078ba533, 0x245c26eeff992b44, 0x88dfc647891eff7b, 0x59617a6bfb15863f, 0xd605f25c6a5387a1, 0x393401fc2a24a36a, 0x574e3cd31c2ed375, 0x2b486ec182551e9c, 0x28db490ac486b8ca, 0x59e77c155d7f4656, 0x59c6836db71e55d7, 0x6c92eb4f497f7453
+, 0xf97ec51a758a7438, 0x4fa939b1d95f5523, 0x8585ecfa9a696f37, 0x28966e4ba55d1dba, 0x27617f2bf04faa4f, 0x37d34869c2f8dad6, 0xa8eaf38db2a1a7d4, 0x2bc86889b36048aa, 0xd7e738aa1a42f321, 0x402e162bcd486959, 0xd72a3b4c30a67454, 0x1d2d7285f8d5c497
+, 0xfacc18028b21a07e, 0x3b620c68a8842cdd, 0x6b4368ee22ceefa2, 0x73cf75d484704c40, 0x587817021c7807b5, 0x634582340bd071ed, 0xac6003e111c3ad0d, 0x35a1ed1eaee12a57, 0x3229f9828a916934, 0x0c0979b654a22eb4, 0x4eb3956f94955502, 0x3332118aa9df46b7
+, 0x126c7b8ee5006cef, 0x320843f49b7a544f, 0x272a8de043d6eb58, 0x24fd26d14d92e6a6, 0xebcc72eead98dde7, 0x65ecca04f9b758ed, 0x914b3ada7d6fd166, 0x548c3b942f25a522, 0x6b378d5c157e2e92, 0x46104bf269c98678, 0x6b3e97757ea131c5, 0x5bba96c55ce6b2e8
+, 0xbfc6a8c30248921f, 0x15bc7f9684cb6d04, 0x9048387851425cef, 0x09d339287c7fc0c1, 0xa4a2b0b5632f8c48, 0x3f6eadd52c3f8e4b, 0x14a5061bc2a7cca1, 0x2a22eac37537f88c, 0xff79eb27f4831ffa, 0x3603aeeaefbbe831, 0x933a63a0c8a9fbf7, 0x77ef8881154ecccf
+, 0x4fa2def7bda02096, 0x1df644e8b004711f, 0x10d0169a90a0724c, 0x32a2c8ffd14c7204, 0xeda7911421241859, 0x7b6c9c066207be01, 0xefeef3f42ae8b117, 0x35a73a4a93c9cbe0, 0x7697b790d784e775, 0x60b0253d5a078adb, 0x9ca512fec457ac48, 0x71096c778031d930
+, 0x35e87b23eddb5704, 0x2df6630406a00d34, 0x6ea9fb14c1a7dfe9, 0x7d6b5ee3eac000ea, 0x10a591f91ac1afea, 0x744f736436b471bf, 0xe8cdabed5a4deb09, 0x26db2f5bfcca570c, 0x19d941b8200c1d01, 0x3ae205e3d3da172f, 0x9d26d6e375cb43a9, 0x19ccffa99c45e85b
+, 0xc9cb8b3487d5d30c, 0x74c20a6800f75f6f, 0x354a6dbadd9a1213, 0x6028041383fb53ff, 0xcbd6fcf0daa11888, 0x2c4107d57c28c24f, 0xc60a119d083a2144, 0x5cd465249504388c, 0x38964be7db88cdd3, 0x72d4556e79d8c18f, 0x524018d85904c1ce, 0x53ce1b9d21a8fafa
+, 0xe6c590a8c1b03a4a, 0x10960ad922004ea8, 0x5d4f485bc3be231d, 0x51491b1a485a0bc1, 0x6f2286d6196f2cec, 0x58818a84063953f1, 0x351ed7c4e5cbbb09, 0x6fa661bd7856b460, 0x15a950e71300118b, 0x4b476fbe88153400, 0xac484cdc4bedc5d4, 0x3920938ff0518c8f
+, 0xe1abd24eeb0c9297, 0x583d1c0f8d8b2259, 0x0b30ac0a118816ad, 0x6ad81b09fa3d066f, 0x693c29b6c2aa89a6, 0x28964e051f419508, 0x021b1a535435f094, 0x38d23ab919aa7699, 0x70881ea254047dd4, 0x2b0710c70ecd02d2, 0x09a9b7eec201717d, 0x6b42d3792e5d5d79
+, 0x1a89dd305bdf85a2, 0x471e5966c6b2eeed, 0x198929aad90c7861, 0x1c11203ad2f442c3, 0x431bdd08b7826640, 0x0196cc0d53a5c7b2, 0x95661ed5c41ff1fa, 0x374fd2da3f091317, 0x608170156fc188c1, 0x528be18eb9ffa153, 0x9950009f99889681, 0x2cad580847972dac
+, 0xf0e38c1aa9a6ba33, 0x6d03fa4771b1111a, 0xc4ddba1f41101936, 0x6ed3d4bcce81576e, 0xf555246304b2dc1a, 0x53c0bb26ab81a305, 0x111f75d9d91efecd, 0x1dbecfb94be60b8a, 0x96cb02dfc2d7a779, 0x44a2b2a5f94b7e1c, 0x20852d87c5fded45, 0x2ffb4a578f722b9a
+, 0x6d0596744f994d40, 0x6d0296fed3839036, 0xa45fb214f07e409e, 0x4ee983d7a17268bd, 0x9e43822f921fbb1f, 0x25b052e53b6bfb23, 0xec8007f47a87e02a, 0x63d756390cca3ad6, 0xb6e779294f5f91f4, 0x0e0459f075bee40d, 0xaafce841edc92508, 0x1338ada805b7b035
+, 0x7ed0fee6d6976659, 0x7df0194b189a438a, 0x015760374dbe99b0, 0x6b1a9f7584a5f85f, 0x49fb0339e4cbfede, 0x592b80d54c185734, 0x62077dd742285faf, 0x50c05e47eb39e339, 0xda4faddc2b184a3c, 0x03c97a8444bc3b66, 0x1d8e4691f99ee8ce, 0x352ee31d85c14faa
+, 0xd1cd40b7ec234551, 0x65e018c7837fb0e1, 0xda3464b313120eea, 0x15e61288c37a852c, 0x3559ab9fcfed3ca5, 0x41e137631b0f0069, 0x4be7fc3b9c9cd8ca, 0x12e6a4e83bedbb1c, 0x64257b6030ec8e66, 0x42961c1985468b1e, 0x22c48005aa03cac5, 0x2ff5e4344d486d6e
+, 0x58bd1082679a57f0, 0x4826a7b8451e04ae, 0x4220dec35bf511b8, 0x365520e200d3cd63, 0x0229d8728801e244, 0x133c130523fe1f3f, 0xc46990315dd94113, 0x55435042bf870619, 0x9c0ccf81bea8ccfd, 0x17332458441af352, 0xe8dcc43950141381, 0x500faad87bee0b53
+, 0x5a83b362504cb519, 0x14420ef05733b01b, 0x1a66b26719fb20ea, 0x6215e59c3d3eddeb, 0xf583bd6a2aaeca81, 0x7baf438f36386a3d, 0x44981a6666576e98, 0x713fdbbf26206ae3, 0x922b06f67c410420, 0x10e0df7beddad2a6, 0xd53503cc6e6cfcb2, 0x4543860007d87463
+, 0xdaffd2b1af6c2bee, 0x6ec5d689751ad2a5, 0x434c8daff38223c2, 0x602228364b5e90d8, 0x99c854278805f776, 0x5d1f3140c886662d, 0x04115d1261aa4eb4, 0x7f61f5766715a2f5, 0xc2a7dfc0e6ebcb2d, 0x1f2ab219146d5484, 0x9fb1725070b2a241, 0x266d360ceb4bac05
+, 0xb1d104ece5e2da88, 0x7d18f59a1db28c9e, 0xd09b4ffafce912a7, 0x20ffb52d49d8df20, 0x113a360ac78cd5c3, 0x42bf06900fca147e, 0xc8af0f062fb9a98c, 0x247a14c7d73daaac, 0xe6546e52a9a14c4e, 0x253018a9f9a78443, 0x9cce41f54d5e1a77, 0x726775589987f365
+, 0x6a4dc1552caba083, 0x51c592e796700461, 0xfe653e868f9f193e, 0x14a450f39eb1b0d1, 0xae8d3480811efe7c, 0x3d672388b75e31b4, 0x5cff162d40a92ec9, 0x5ab06a22927eb33c, 0x6f754a2f624bfede, 0x12cd02f473be713f, 0x505d9dbc733fe7c7, 0x2dfc4db9c3772ee9
+, 0x63abf038c5eeca9a, 0x10b489804e844a29, 0x8722aea815e71c54, 0x416ce845a1e1554d, 0x843fe2c33dcbb5f7, 0x7692d685b7f9f262, 0xdcaf12662a7e2e11, 0x4d16d5c290cf948a, 0xdc15e4336c37b0dd, 0x00e13dbd9ac020d8, 0x06962bbac66f4426, 0x1a44e4d20e8e208d
+, 0xfe5c608098a83258, 0x133150ed97b9166f, 0x83cabae5d5ba5eee, 0x659ecb464bc6fcd2, 0x41a9a70c24ca2cdb, 0x51eb6a439cee7417, 0x932e8a0982d22e3b, 0x1192dbef4826b29a, 0x79bc4d4a7cb46dde, 0x05c53dfdea4ecea6, 0x45b5a1117c3c5445, 0x1ab997a6c6159ab1
+, 0xad8e57d3dcdbc2b0, 0x659c54e06a956315, 0x023e6786be35a14c, 0x51333cd054c9e465, 0xf7092b2b07cd71f6, 0x1a1b78e73d996459, 0x4404b36d5613108a, 0x003f86a07bc076fe, 0x0bccb24de14ae5d8, 0x36c62a1f589c4a2c, 0xa162d4bb5cd9ead0, 0x2259cecda54cac58
+, 0xb0d35ecc9baf4e9f, 0x254ddaae6443721e, 0x29224d4968ab1167, 0x0e86e2bbc852d9b4, 0x19cfe4097c71fe34, 0x7421e1e2cf0952d5, 0x626fe9fb7fb5b112, 0x545f18fae1000077, 0xc80bdf59aaa01422, 0x30934da9dd60e8b8, 0x34b52508e29f84d1, 0x024567df6c125ed2
+, 0x0ff5fabead1c8334, 0x34dba7ce9a90fa1b, 0x536b4f1b7bb347a9, 0x1835b550f827f5b9, 0xb20344ee8b11cbb4, 0x5205f1cd543cc145, 0xc335696f25bde15b, 0x43907671ecaf3acf, 0xb4a81e1c9f116933, 0x48f19632e90f8b27, 0x100d29a72b1038d2, 0x68443c11c57e4655
+, 0x6adf73b91c9bbb43, 0x095406c2095e839e, 0xff8ff468ffb6700d, 0x626f164ad4bed828, 0x26e8afdafd1f6d7d, 0x7753e739591bda05, 0xf0080984c798dc67, 0x3443eb78c6648a38, 0x545e0136b5a32ddf, 0x32452dbb4079e71d, 0x42d98c64ee493c8f, 0x76a438867aa7824a
+, 0x9f8c3a91f4e7b793, 0x0cb3666c3145b404, 0x0ac07b739c75168f, 0x04a5271439d12eb5, 0xf9abfb99542ef864, 0x3223990b5599351f, 0xbc963f396dd35dad, 0x27810e1e823a8cbd, 0xff9730deef3c9c23, 0x6e8b8054210d1dac, 0xde3edc983f1e3fe1, 0x1e2e6e471838958c
+, 0xa7e6c63ec14596b7, 0x1cd579f1ba3df0db, 0x131900d5fd56d883, 0x35e0a8b4e27af27b, 0x410b33e2f222ec43, 0x5928d3dd16837149, 0xa7a55a311914fa84, 0x0a730c5d3245317d, 0xe4daa4a03dbdfc1a, 0x7b5c3fa3a87243e0, 0x052c1dbacd474e64, 0x4de4b53854bd91be
+, 0x19df6ac1f5d58d49, 0x7701efe5e3ebed58, 0x0145aae3b0aede85, 0x6f543eb73a13582f, 0xcc08754045d2e5b2, 0x753adc8c8775ada8, 0xab026b4c0c46db52, 0x75075406f14f5cf1, 0xe06d0b3eb04f70b3, 0x4074cd707e0ac93b, 0xa33c51296bba4fbe, 0x34697070cc24a211
+, 0x5995108848dcce4c, 0x1e98a3253f085204, 0xe0aa9648426e4a27, 0x7b855147bb9c2265, 0xb5dcb3a77d3cb1dd, 0x3ddffd8e738cfe54, 0xa49ca522ca2a4236, 0x6c58470d2bbaa013, 0x99e9754fb32337a7, 0x72637ccbe6da46d9, 0xda9dbea1a92fd3b1, 0x416bebfe1b7a6d92
+, 0x7f3e7f57927e17ad, 0x621dae96c326480f, 0x16d5ede5aced9600, 0x318accfce3c8a103, 0x7a4069f0b230b4d5, 0x61d49f57662499ac, 0x6fb23328c363843d, 0x324c449435f3980c, 0x0876ec8d99422ca0, 0x119512d8d5ac7410, 0x0cc1f12166638482, 0x60b5582b5b59dea4
+, 0x598d33a83af2c921, 0x42b776fbf6787ff3, 0x899bc1740ad46db9, 0x060e6ab257ff17f5, 0x2fbe7266f6a18359, 0x3db8334a5d3f9b7f, 0x833cc5c435c7bcbf, 0x2576969d2ea7f298, 0x9650e77c0e40b294, 0x2582c0e219474105, 0x45721fa2d0de30ac, 0x3e3e54a81dc070ed
+, 0x8c9fa70e19820686, 0x77f41883e550f1ca, 0x620cecc432720630, 0x30fb8f64040087c9, 0x49add94e6c6a1509, 0x2788e07bb4a46f06, 0x92f50d3526162026, 0x19257c092a2b682d, 0x4d859069e8892c58, 0x4986722f2a135b6a, 0xbf2d2a7bf6b92802, 0x4918b9840bcd31bf
+, 0x05514263a0fd8051, 0x298a55680426d215, 0xf447e3d2c0d826e5, 0x654964c376c46f76, 0xb748d6cabebb7085, 0x292d92bb5224127c, 0x4b564711e6f30720, 0x3680603d4b687938, 0x1d3652e4bc7e6388, 0x229a3ecba12970c7, 0x0a264fc5cfb98ea2, 0x72513effc8cabe50
+, 0xdf4117326f3ce394, 0x07e310a23c63667a, 0x62af8780b6b2d91a, 0x7ad41d4514cd1339, 0xbe7ecc3af9c5b82c, 0x5dd08c7761e6862c, 0x54b67c407da2b918, 0x11085f9742e2ead7, 0xf84e54fea95cdd7b, 0x278e4b4344b91e0a, 0x307f661f2a933ac7, 0x6b7d0cfe9549cfaf
+, 0xcaba05cb45c737b3, 0x1eedd5ae15305ba6, 0xa0ea856db9b55150, 0x53c5e8bd0480ea7e, 0x98f0a208979cdb26, 0x1697fbed126a5a47, 0x6bda4cbff4270af6, 0x3845c1ce08e4396b, 0x5c72eb4c7410c7fe, 0x6f74fb2418599977, 0x4dd2b8ed72bc4c75, 0x6fd05e5fb2931e4b
+, 0x356a65dcd05277aa, 0x348185a9fa8fb932, 0x7222a7cca09f5acc, 0x7e8b9ec8f977e0dd, 0xa26c58c2e5d0acdc, 0x5ab5ae5db7350acb, 0x9a91c15eba7097b1, 0x70f96462e32685ef, 0x8d51b36504055d26, 0x7da072d04df864f4, 0x6e10c593dd19985c, 0x4fca79468a2a2eda
+, 0xf536a6a47c88ec58, 0x2669bab2e3ae96d1, 0x31123035f716f529, 0x0fda973f8c070c10, 0xd2b58ebe5a334841, 0x66643cf42590a343, 0xa1b92d53e79ca3a8, 0x087670f12d162e65, 0xf87d0b3c8a7e4f8f, 0x73f72c025c573c43, 0x24640b13adf22a60, 0x69cae39b88b16d70
+, 0x67657c58bd2626a5, 0x19266a8789897b31, 0x7e26a17e66cc76e9, 0x5c20df577d716b83, 0x90cac819159218e4, 0x2dfdd27325818b7e, 0x5495b3a426fe3eb0, 0x3d6ed79a301f355d, 0x379d74ce19572f33, 0x36d2208ce4048bce, 0x48c65afc71cc6e6c, 0x788e1ad62df7c817
+, 0x1a0020e8cd1c14a4, 0x2285c253eb63ba61, 0x002dd36baa19276d, 0x7905009ce31792db, 0x1c8eae302322f578, 0x02895d77d4743569, 0x86d7b3f9c130981e, 0x673505d5fe17de4f, 0xd9860bfa518d9662, 0x02c33712971f55e9, 0xa56f8fa28973971c, 0x03e405c3abf7605c
+, 0xe03052236bcf9edf, 0x790cd821dc88d2d3, 0x37778f2f8729cd93, 0x2286f92cc0edd37d, 0x8e93cea7469f589c, 0x6ef3a8971112e936, 0xbfea81fa81eb75ec, 0x32c12a91dce3ab7e, 0xd03f6755ae6ac204, 0x0c003d30caa72771, 0xf9b44ac363dcca15, 0x14da0305211fefc9
+, 0x8459273d3c410c74, 0x737fbb8a392b00a4, 0xa1e3f11fa3e6961a, 0x5715403f7eae29a2, 0xd456ee4132e5bea5, 0x6e39ad057bd70e42, 0x9defbfdbb547c766, 0x3db9b451cf926276, 0xcc90066f500cc6b5, 0x474f9be77ba8f4cf, 0x154c26c2f8c5bc27, 0x2ad37c396177f337
+, 0x3b4082a5367896ac, 0x36b0944bf951dd53, 0x5dfb655200eeed8f, 0x4ba146beed84edf9, 0xef48ba17df4054a6, 0x17a8ff91efb4b66e, 0x3ec70449b64a3ff5, 0x7439fd375d915bf9, 0x91353bcd931b2d58, 0x50610c849396c3f5, 0x3671574b0264b89b, 0x4eae34a34cac194e
+, 0xda39b4975b68cecf, 0x7c59e7ad7a24d7f1, 0xf2e086c2f1623d49, 0x5877235f510f6abe, 0xbcfb52599d9fb2d3, 0x110634f2479eee39, 0x4eee7051692613af, 0x6eda4dc3c4e4f226, 0x41bf5508e1c81631, 0x269e7641d112e312, 0x3151182b9399a429, 0x0447d61684d4279c
+, 0x9d2c3815d5f2f7ab, 0x24659639a747efcf, 0x49185ccf180c0805, 0x7a01d56f23dbd625, 0xdbf7303a9bd3d4e4, 0x0e5b35b17304b061, 0xff7406d0c88a50c9, 0x5d5038f317b080fb, 0xe0b47d5a36fc4537, 0x286357a3fee674a2, 0x66f7548e8e2e7c5d, 0x4ccce6dd02d637dd
+, 0x82c0a9197b46b917, 0x3ecad81c6211a291, 0xd2ddbe4253bc21d9, 0x7d003c14f0791b9f, 0x18f96a6cc2efea75, 0x5da6caa58517eb01, 0xf86fbe4e6fa387d7, 0x2448152e344e4bf4, 0x45d7f728e8c05035, 0x0a8132e378b3cd7b, 0x613d8427af1ddf9c, 0x3be2b64e9d4b1dfb
+, 0x5fcb6d3461345827, 0x54be5ca918a1fc13, 0x76ab687565c6eb8a, 0x47faa20ff6f378d2, 0x6dd272774fa287e4, 0x1a50e8dc2413ec95, 0x7a65b533c229d7e7, 0x66141ae6d6de1103, 0xef15ba2f761d03b8, 0x3e1707ecb1d4bb80, 0x3e688c7d7c6395a1, 0x79efdc351380ecb5
+, 0xbf09ef42d6132815, 0x5fb60dbb79a338ac, 0x4824ef6dc74582a2, 0x1b45fabdf95f802d, 0xe44784980ca51c76, 0x088e574f5104a03f, 0xd3b762e0b9f6f4be, 0x7b1e6c6ed57beccf, 0x261ed9401973e23d, 0x2cd0aab8f888ce61, 0xcd4759614085376d, 0x344bb6afb80e4803
+, 0xcb01a6f00e534b95, 0x1b69492c6a4f0ebf, 0xade4b1da67fe0289, 0x35d031d90392017d, 0xbb7c3c7487b83ab9, 0x32c66cd9eccd7266, 0x6f017cdca3243117, 0x47668b5e95f1a531, 0x9569199ca1d245ab, 0x5fa3cae5f2806003, 0x621ad3280b75482d, 0x2a2cbbbc50dce32a
+, 0x7d983f8568dcd081, 0x28de4578abe6c430, 0x94089be1d02825dd, 0x018c8f86a8bfe5bc, 0xc508c4d2dca9490a, 0x4aa8c20928d019ab, 0x8e32e46fae547679, 0x312a02d04fc15128, 0x84a8d075f0dfa996, 0x22aacd3988712730, 0xc8b7632e4936d49b, 0x786982519e9f65c8
+, 0xb5df45efc0f1563e, 0x152d105deb3f8099, 0xef8ce208cef2c00f, 0x21b3fa4f1a3045e9, 0x29d3b6716d7d434b, 0x5c28d83ed8068c96, 0xf72e78306d2e8a4e, 0x6b018440751cb538, 0xd6085b558732b21b, 0x3b64174d5d76883e, 0x7b1c7bbc231e7791, 0x2ed912c5c494ebf8
+, 0x7db6a257de4ceafb, 0x2db11e914c2570bf, 0x0e11766679c611b3, 0x46ea9708f9e115b4, 0xba751f5ca3b7bd0a, 0x4fd00821069a5d80, 0x077d60d73a602f78, 0x7f02f347960e6359, 0xa49d814e13087d3e, 0x1427ca9e13aa2ba4, 0xa890cfb6e0199a1b, 0x0a1f2c8202650bd6
+, 0xc751362d10f847a9, 0x312765b04a7ff0f8, 0x88428cea9b0df617, 0x55a5e87a531acd63, 0xbd47c80a0c7e58ed, 0x11d9fd3730ba11e2, 0xe30a58309edc0118, 0x5ec8d9cd4abcde22, 0xb46c8b8476f88f65, 0x33b194942095ffec, 0xb7d64e66987245e6, 0x56235385b0c2b9f3
+, 0xf3a132eee27fde7a, 0x2bd9b0dce1333565, 0x7684ddee64fd6983, 0x320e10265a6102f3, 0xed5c6961923bfc60, 0x0b6df783b16b711b, 0x8b2d4d35e9b550b4, 0x40c170dc368abb90, 0x7acd5b7211ad15ec, 0x3a1f98076c9ebb4e, 0x945b4376e06e7474, 0x3d8f704d9b82cef2
+, 0x366603fa78f2f162, 0x72fac2352c9fb684, 0x9a819260c9b0c993, 0x4c327d032f33730c, 0x211e72c04f53fa05, 0x53c0ff4d2aaf1134, 0x6829714ccf5e6acf, 0x329477cd2a08339b, 0xeda4b1029967a98d, 0x67fc35118a36d314, 0xf6115604bc371086, 0x7ab03b8ba1eaf17b
+, 0x3ca4c036f286aac2, 0x3f7bf7040309b1fe, 0x447397c1ebba6cf1, 0x381a196a249f5453, 0xf96c290244f5c000, 0x0fd0723cc9d6a442, 0x287b22dc73c7bf1a, 0x589b3d965203e93f, 0x7ebd3d55bb90ef8d, 0x2cba2418ac4fec7f, 0x1346b3458dc3d73c, 0x7b4df4e877001819
+, 0xd7ab7d6fd8dc81aa, 0x15df57aa0cb8862f, 0x90bbd747890a0099, 0x6189693518fd8813, 0x82f87f7b7d1dd907, 0x401124379b54b5b6, 0x5bb8db6836ed6e04, 0x3e083d8d7f221da9, 0x8da94fb576fb5ab9, 0x3df95016ccee579d, 0xb0669caf01baaaf6, 0x0097a1a05ac4f3cd
+, 0x9a2fab32a64c4208, 0x6c916b99c3867364, 0xc76f370ade57da0a, 0x4cb01f291ce4ef4b, 0x0cba35d7be662034, 0x035e9a7d7bb9055b, 0xdb081b4068e8a5c9, 0x424be049f56ad4af, 0xed7c3dcd12baf9d3, 0x30903006f9175ce7, 0x5f02493c65db1d98, 0x41eb02eef344e474
+, 0xefd189ad0dd9f456, 0x71c9d86e2ab9c555, 0x77eb2070cc9b65f7, 0x0e7911b0ecd2f86d, 0x5455d5040f6e438f, 0x446a33d62b288170, 0xd0f959d4a3d3a1a5, 0x22728881d8e2f48a, 0xba2e6fa60bdb23c1, 0x61b7ef1661795803, 0xe15562048b49c2d0, 0x7c4b90c65f3b5d6c
+, 0x4b121eb43db99184, 0x39813ebcb06cc01f, 0x849a1169fe029528, 0x4f4ea4e4a7933823, 0xd35ad4797276b8fb, 0x3f8cfa9a9df67772, 0xa764bbae3b0b4bde, 0x4919936d2282d13a, 0x044a0ce3bc3b7206, 0x04da77d988092ea0, 0x6a1c6de0f752846f, 0x484a4b58b5a07ad2
+, 0xdccfc18133a70092, 0x7f7287d65cdfed8d, 0xf7c897cb825bd7ad, 0x37e0bd54139662e8, 0x76c8e9f609b9f0d7, 0x4f55cc6b13b0f554, 0x12430e5213c2b19e, 0x7336df4505b054cc, 0x5bb6cb4df9338bd3, 0x7ba68bb4193fc9a4, 0x745e29711889fbf3, 0x2be01ca5f02c3ec5
+, 0x97322eadfa2053ee, 0x09764c11d65afca3, 0x632f63da6e203883, 0x6e7668393479a539, 0x732fd82dea6e077f, 0x24d561ad0876f778, 0x0e43eaa0f28c7957, 0x6e69a14f8237bb52, 0x0bc9afc3c627ece6, 0x6a980c906e0af5f1, 0x6ca9cce8fe8cf3b9, 0x094de681e7e46326
+, 0x734bab547dee107e, 0x34dd0113d2016ec4, 0xad56997afecbf27e, 0x7e8ff659cce3a277, 0x29eb66194953be6f, 0x1db1509c76ad0f22, 0x88d9653ab0998ce6, 0x78ef668b9e305a35, 0x32ff76579a0b9325, 0x74b0dcb1ad7df919, 0xc1b26aa677e2e07b, 0x050052c266bc5379
+, 0x31dc56ef630c319b, 0x4bf6f70b8cf66f99, 0x6e08ebef4ede51f1, 0x4f2996d17a245417, 0xd9a5235f4e304668, 0x30b94da1287e37e7, 0x100a53b2f39a9360, 0x06f4c24f7aba48a5, 0x916f8ffd6bfa1f50, 0x4ec2e715a027b610, 0xd8ba2cb2046aff3c, 0x6ba01e82c3cfbcbc
+, 0xd87320edb56ab3d7, 0x24891a5e3be92322, 0x94062cc9f3de1aa1, 0x354a90ea097a0ce3, 0xb490fa127b44ce98, 0x0957182bf5b0697f, 0x0aabe93146832725, 0x1a441ca6c51e978f, 0xa8a0f3814417d408, 0x71b150af8fcbcdb8, 0x27ff061df1be8bb4, 0x15669069aa012fd1
+, 0x4c1de98f1f1f0dc0, 0x5013a6ee85b2eb69, 0x6c938225b3fca228, 0x21a0ad79a62e6390, 0x378ccdadba36652d, 0x17cbefcbcee37e8f, 0x5021799d3801eeea, 0x169a74ba433f6c15, 0x429fa06ad8224978, 0x13a852a1c0dbe227, 0xe1b6515c1cbeac47, 0x771e2f484264e6db
+, 0x3b8013789d287518, 0x79d0abc074b9a2c5, 0x7d6812c7eeeda52e, 0x2ddc074b5b666a33, 0x8e2b23ed5a2942ce, 0x4cae0646abd8c9d9, 0x99575326c5233a24, 0x35ea856c39f28948, 0x2ef20bfc869e1d2c, 0x73f77849cbb816af, 0x41d4d6a90e3fba7a, 0x6fc9f5cd253498e2
+, 0x9ac6975cd1514ecd, 0x6abdc779fc0bdf5a, 0xc1f5d882026d39fa, 0x1b9d51b1a10c8abb, 0x50185e9c6d2a94b7, 0x1c38bb8126b08bc8, 0x5d5ef6a5de1f6644, 0x25f6096def414463, 0xc21da960f3615f1c, 0x236e4f94ca55469b, 0x69ea2535d04b9024, 0x4f1b023f7b7e15e6
+, 0x38f99d079867137c, 0x6675a25d2c906a17, 0x1fbfe2e89920870e, 0x1643539a74c8d763, 0xe9c10f3c6529d8c8, 0x26f6455f897bb324, 0x9e8d333c66628b16, 0x5e2065473f8127e9, 0xa365dafa05806471, 0x25e84cba996eeb56, 0x481b4f70807a3083, 0x65541cf787d4331f
+, 0x8dabade809aba557, 0x73bf08726d434d39, 0x577934b259a54a2c, 0x34784c67812cea47, 0xf1cca0430ccf442a, 0x6fdf1a612e89248c, 0xfa178aca84ed5439, 0x4815659d9cc82b42, 0x622da10a0711e8b3, 0x0d066e533f8e2bd6, 0x0a6d1ba9939c37dd, 0x573b74788a3d7cc2
+, 0xa0da43c75f1d7a14, 0x27170400d846d2ec, 0x86acca6ea0fca499, 0x7044fdc598bd5992, 0xe4851709721405c4, 0x03e86ba50fd30119, 0xf1a843f79f6b4e6d, 0x0b928e8b65e6b23f, 0xea14cff736604b8b, 0x696015fa8f3f3636, 0x6645dba542e7ae24, 0x3927693f7efd56ef
+, 0xa3b8fd740339eef3, 0x56b544300a4ee0ea, 0x4a01a039d22802a0, 0x17a5122e0b0a68b6, 0x976b5895d3d702ac, 0x4d0754cbfc92011d, 0xfa222e1ea6ffc5a6, 0x17f2adfb6f702e2b, 0x2ac209b67dabce56, 0x3db233a9b8b6b807, 0x046c9b15a673c975, 0x797390ee7914517b
+, 0x72819deb0bcea731, 0x7bccfc95788b0cf8, 0xb2fe17a45bde858e, 0x144a5e30b7fa95a9, 0x535b461156e7fa69, 0x41c64746f67e9505, 0x31d8c21223b23fa7, 0x1c7d0f67956491dc, 0x9caf63c2b93d31ee, 0x01d8a604b2efd98c, 0xd1ddcfa1a6af812f, 0x3c13eb5e3d81b933
+, 0x61aae12a638db4fe, 0x76333cfb018caa9e, 0xf9239768f4bb0f2a, 0x588ad86b5ccb97c6, 0xa64153b23b4df27c, 0x22b707729c29b7e5, 0x2afa803bed4a8c16, 0x74f1cc446b1759d7, 0xbf4ce28f942604a9, 0x23b192ac6874d4eb, 0x5b216d46c83488f1, 0x0fa4dfba4277e8ad
+, 0x5d426fe84e72d41b, 0x4bcad74379ad1d2a, 0xb242ea3b08e8248a, 0x16131d0f5098c8d9, 0x3184ccd5514bd3cf, 0x61bfc30fb2c786a2, 0x6c78ca4383715329, 0x36ad8a09d3e30273, 0xb2393a8d5eafd6ac, 0x6a360a9a7346f713, 0x8b957d9f402a2b62, 0x77e9ac4d961a14db
+, 0x144bafca6af886a3, 0x40678e3048b0e3f2, 0x0916a640ee4d5114, 0x5be68c0d77a2a00c, 0xa5e226277dd6c88d, 0x03917294f46ceeb1, 0xbf6d19527e18952f, 0x4f47606956e4241d, 0x110d0dcd2125f21f, 0x636c5a124bda45b9, 0x9062526c7efe5946, 0x31be93471fd66970
+, 0x33f59e6bae604ad0, 0x3bca8d3852dfdb2a, 0x71735627645b5698, 0x6c475c3696472fb0, 0x9ab279bd044e00db, 0x365dcc134be92b52, 0x62f1728dd87ec440, 0x2b5434cc3b9128c7, 0x90d98b0c00137fa1, 0x1302e160ea72dddb, 0x0f642c645cba638f, 0x7de429b28eb9fbf4
+, 0xab719851a5db3d24, 0x2a514acc614dcf18, 0xd34c701e3f327e84, 0x6804bf1b4d73cebf, 0x06fa0de73db05c08, 0x107efa0171c21a11, 0xdcd3237336be33d1, 0x3616afb3c46fca2b, 0x742aa6b822b09606, 0x24ba08310e9b0720, 0xb8ffc45e523580c1, 0x44f4d3ca732689fa
+, 0x5bc17af3d0b001a5, 0x7bf2a28d9421f72e, 0x3dcbe5e634f4299a, 0x7fe98e1cb9c585fd, 0xdbfda717b750306d, 0x06215eb23bbd053a, 0xc88361947377ce49, 0x1a895f19ea270500, 0x80c1615befab7138, 0x5dcbc08af6fd6dd6, 0x2f3cf24005be3203, 0x406f1dee8ac43f7b
+, 0x33733ad20c4f20f1, 0x06d0aa5d50493461, 0x7df6285529912125, 0x1ec5de79a820a0d1, 0xeb2cbd7ecfc5eadd, 0x18d35f662c9a1908, 0xb9eea9cc029361ba, 0x5a70415e0db6f5fb, 0x18f7e16c788f38d4, 0x2c7a0082bbd3f112, 0xab2be05ebe0d89e3, 0x2024df05f85a0930
+, 0xa867f07c7ebc271a, 0x3785547c5488ba90, 0xa7494c1d7a07216b, 0x6999831e042d5fd3, 0x730f870307c81a45, 0x4ab45b6a4e0c83b5, 0x2134e3bbe4623590, 0x366feab77263be20, 0x5d9dad05800d9b3d, 0x4d99777e233ff477, 0x24a772af64e39a63, 0x0eaf56a78c22b863
+, 0xb5594129d6ee2e87, 0x5ea8fe46df1a1d33, 0x37f21eac3e31f558, 0x070500e2ed36c929, 0xf8bca66ae4be7b33, 0x5be02c1abdc8acf2, 0x25873c4c8ed52049, 0x599c1ac6f1cf86e5, 0x4f34adb05e97213c, 0x7bfd0d4487b3825e, 0xee33efda2e8370af, 0x5d18feca2d9686e7
+, 0xb7b0319703765485, 0x744b535ff89b6aee, 0x370e6db90411a676, 0x7efc31f8fb7fe077, 0xef168c5b18d0eade, 0x21b1647ec0627fc1, 0xd138e040555711d1, 0x34657b374bd66e77, 0xf29050b3bfd59f24, 0x60751ddcb7fc23c0, 0xa0684cecaf59f959, 0x62b19647023eb909
+, 0x07b0fba5c3a23302, 0x769ea974d2ac3f23, 0xc5f4b174688483c3, 0x076e5e144d28d5c5, 0xcf8a6973a2c5f666, 0x569e432d6c015766, 0xbf86d18f1d05f9f2, 0x73026520e2e90a29, 0xc23bbd79e241f11d, 0x239f8d67b114b1d4, 0x244b3c575d31ece4, 0x53f006b898f2e127
+, 0x937453f6659f8c4b, 0x407f78d18dfaf2cd, 0x16002270255bff87, 0x2fa65735e93aaa20, 0x0aff84474210fd29, 0x45d8fa33c718d7ce, 0xffc5314fc418447a, 0x09b45350edb190cb, 0x35d4bfdc4be67ec5, 0x5d5ea5a7177ea581, 0xb048d10093ba547b, 0x7ba85c9ecce2a071
+, 0xc904c757f9f76b59, 0x5d382d27d56c303b, 0x7745ddc2b8048430, 0x16f4d15359700a39, 0x3ab1767f96e15419, 0x514a420445963eff, 0x30387a808c288c5c, 0x1f293c73f68aff67, 0x88c823fd97d6c093, 0x4304fa51e202ede4, 0xd1ca0493656a3598, 0x54b8291c478558c9
+, 0x16e2fed63ef7d436, 0x4e288fbac65dc0ae, 0x22b15627907ecd1d, 0x254b55f042ca53e9, 0x92a470311eadc0fc, 0x6474eee57ed1185f, 0x4c5cc909a7d771fd, 0x4e2e3bb71248b104, 0x2f848fa8a9f471d8, 0x4e074f0f2706ec0e, 0xcad318c7f993e3f9, 0x5d82d47cdc15a13c
+, 0xbb713403f2c40a9b, 0x291e6a59d55a7a15, 0xf2c4b20a41c02e43, 0x5e2ce21b202ec0f6, 0x2368faf5ae71d608, 0x4015c1ca69add444, 0xc7d1ed9181f24489, 0x6bc2b17c8cdcd31b, 0x196f63ea2964e703, 0x79c9f4b343b635e7, 0x26eef6deed1fdc37, 0x2f7c1743b63a1605
+, 0xac89b4f2f204aeb4, 0x07858e073f71e4c3, 0xbb06194118d3498a, 0x227669664368eb9b, 0x6a693d12f3a4730b, 0x54dc70974d15707e, 0x1097ab10480452a5, 0x1994949fcbaa5750, 0x86f82d20ca1313fc, 0x6844c10e1f23b0a5, 0x044d328799a20d56, 0x54b2ec71f082dd5d
+, 0x3bac82e03812461c, 0x64ddc479ede2b565, 0x8e7d99e84fa67eca, 0x73864d84367768bf, 0xa99b370501046d8e, 0x14f57454b26dc4dd, 0xb23729bd585c9570, 0x63a201516f1d8630, 0x4485ee04443f7595, 0x40fb05d999b69fcb, 0xc94a0456bbc44c4c, 0x288915980903657f
+, 0x4a9fd210d0e3b9d8, 0x5cdf5b424af8b951, 0x2cf206bc14bede9e, 0x3c4f9beab04aaa28, 0x43cbe22c245062d8, 0x0b8d9ae417525659, 0x0a67cb7124519bf1, 0x4de6980fd4dc840a, 0x162696d84a9f1929, 0x7b5d9f2ba9df7167, 0xe35a4b2a1acfdb68, 0x0eab6d29de8e7506
+, 0x72f71463b2f2eb1e, 0x08ab46d0a46e06ad, 0x1122250858ed6773, 0x137a469f120b8bc6, 0xac44b0f2bbe68d4b, 0x6c62aad95b5bd105, 0xf72d757be0f3fe93, 0x0e9729a012b4e49c, 0x29256c835cbaa1b1, 0x39be36d62a4c3def, 0x9388904e2a76911d, 0x4e8ce3d97b4f0430
+, 0x4a44ff95cc033ce3, 0x352c932cf7d7b1f3, 0xfe264f4f903719e6, 0x75977f7aeb4650d9, 0x3335563e9eef06eb, 0x32c1202d1b2679a7, 0x036bcb6cde12a575, 0x486f4c6f2a8d56e5, 0x296279aa12cef6e5, 0x78d3bdcdc6e1978f, 0x5e57763a5a5c85c1, 0x74830c8e687c115e
+, 0xe5aef32c8f5ce267, 0x5a6b90b9717ad15e, 0xfbeb80f7f93e75ad, 0x1540c27018743153, 0x1d5c5a8c3d49c65c, 0x51c23c2cdaf968d2, 0x2c1abe34373de1d6, 0x013f3540ff4fe32d, 0x699a0c178a97771e, 0x433665ef4ebc91fc, 0xab8910186e7f20cf, 0x60d95e529b9cfa83
+, 0xe04f923440509943, 0x692e67860c3fefd7, 0x6091a6cd75f39bf8, 0x7fd52c439c0471ba, 0xb3626a66396f6bdb, 0x6d972183d7fc9d15, 0xff3408bf89e799e1, 0x4860200dbf3133aa, 0x0ad595631687e874, 0x4cf12e090b53abba, 0x90277737b5859605, 0x12129f9d94e7a36e
+, 0x31b270297408d048, 0x557040d5532d6127, 0xfd9cd25ca10d0df9, 0x29a15bf890fa8fcb, 0xcdda8ab8d29efcfd, 0x3a29dd294a6ef634, 0x07f27da3a91580a4, 0x14fe9f0778765ec1, 0x3c8e326adc3b7ab6, 0x353a812f20bfeedb, 0x8a66d5aa4ed484d5, 0x7a03721daf12b207
+, 0xae13b39fabd69fbe, 0x24d37547ce0a9319, 0x284bbd70e195c428, 0x5ea2811a74b44e4d, 0xa42ddcb07e521c75, 0x2a6e9dd88988e560, 0x787cc029afd0cbbc, 0x2ad47ced602d93b1, 0xef4eb276e4506991, 0x3998bcf1b32f3147, 0x5fb9b86d5adf6531, 0x24bdfbc548f2d054
+, 0x5b6a637000d68f88, 0x30a3064df172c622, 0x8cde95f338ef08c4, 0x003b0f453d7b944d, 0x7fa68ffe43f9a766, 0x20de094126845c3c, 0x1f37d570db3d3fc0, 0x5559c45e8bfc9a21, 0x59cb004c038ea22b, 0x1421b1baf2ec02ee, 0xd6956a87328eff11, 0x17a56997b4cb88f5
+, 0x1d1a47ddd0b4ad14, 0x156040da8305156e, 0x3e97ef8911b83ff7, 0x15c3fb67bbe73765, 0xb0f286b58b0a8290, 0x4e27bc4de2db6a4d, 0x911e36a13d140c64, 0x027b5e666cefad42, 0x9428ab487792be17, 0x7d0f947a43089cf1, 0xbce6646f56662b07, 0x32c7756232d41387
+, 0xccdff84d41716fd3, 0x66658c8d0cd05288, 0x9621757bc91bbb17, 0x23e4627c9484c2b0, 0x4ec7c2d5b4e7621c, 0x7087194de7f1a5e6, 0x1b426eda535c726e, 0x1070e738ab035c49, 0xd1644e474ee0da33, 0x7225cf4844fb2b52, 0xbdb51443838195b3, 0x10eb15f52d2df520
+, 0x155735c12b1c8d19, 0x635206d516ed575b, 0x77381dff95e2529a, 0x159ae80e76a23646, 0x11a7a2a671d9969c, 0x614298dea2fa8a27, 0xbc953dd630d76c90, 0x589e22cd98f88412, 0x7615802c06cbed65, 0x43d810268c8e8a5b, 0xa3801d778ae543d2, 0x2b4dec615750f06a
+, 0x1bc3b4d5ad491aa0, 0x27c8a11b20eac54a, 0x48e8022703e710b6, 0x4adf2a82899d9b73, 0x3d92ca87a9dc7d05, 0x2a546c5a866ce12e, 0x57911d971f0f0fbd, 0x06a227b4b1402f77, 0x69250087753db1b1, 0x0f82fe47c700f9dc, 0xbe8a5b9cc3479ac5, 0x6ce1bd4c6250c20c
+, 0xff0ed13cd3bf5555, 0x231591b5391a845f, 0x3732ba3bdc11deb4, 0x1977a4d9cb1c1def, 0x3079bf5c160737bd, 0x2177beeeee0f0d95, 0x84a3196c5ffd1b91, 0x705b4326830b6ebf, 0x16b94185ebb75830, 0x5bc07db73435794b, 0xf49b11cf0dea26a3, 0x27f0f1244f2013fd
+, 0x958a3ea4c621d80b, 0x038a310eaee3eb2d, 0xc4a5830479f74715, 0x0aa56287f8da6e38, 0x3a52abfea3b30163, 0x3612526f29aba94b, 0x15685ca3113e7d0e, 0x05d5998875622206, 0x6ff397c67b03822a, 0x733dfb4f59026ca8, 0x1cfb5df3f84f3070, 0x6cd04ce806adaeeb
+, 0x983a340786c114af, 0x562a3e87538c1595, 0x5899d1b418d848f6, 0x56fbd109077b833a, 0xe898e0e2191122b0, 0x35ecec69679ce908, 0xc8e04ae2fcf03a42, 0x34ad835b1b708b52, 0x896aa5028446bd44, 0x3fe37020b32ddab4, 0x7dcddcdbf758faf1, 0x118e6b848640e3a0
+, 0xcf0257bb52adad52, 0x5d264bc91c3bac75, 0xbb74c6719db14c0f, 0x40885799bbf4ddd8, 0x42b699f9e27c04cc, 0x3f9864d0c3fda09b, 0x22b02f24485b76c7, 0x6dd50c7a0526ce8f, 0x73e90f96de0df18d, 0x6e5930211bc8c64d, 0x2957dcf04441b79c, 0x0d97a820b74d556b
+, 0x90f534e17d7d03f8, 0x75eabc764507454a, 0x02677c1568910cbe, 0x3eebdd0e9d90b838, 0x11f47e206c4f185b, 0x76a6dfc2a7c0b415, 0x427e7deea2b0c9ad, 0x3f0d5c309b104de1, 0xf8fc070a06c689e4, 0x22277f22d43c0089, 0x00fbfce9214143c5, 0x471ce7b17cb1b38f
+, 0x52f97fd0ec794453, 0x27e7ba29f7ea95d7, 0xe6712e3ec70cc9a4, 0x734bf7706aecdba7, 0x030df7a3678b644a, 0x62fe0811c6400f63, 0x5e375b4562f98f8f, 0x485bdae6e77f8c22, 0x477817dc4899097e, 0x405d8ea063a541d9, 0x00f798327e5c8a62, 0x4f85c250a1197f19
+, 0x640642df414a1f43, 0x5734daadd02a48af, 0x0705a54728ef2fc1, 0x0b33ed6e36f504d5, 0x44582405cb9c9b28, 0x0fa888596f1f6f09, 0x4f4efa20d52001cb, 0x735b055b401197b3, 0x09d8fff216056750, 0x7b59a18ba1d23b96, 0x1de66551931e3922, 0x6642e3c6aa1813f2
+, 0x8c6f79548efe49a9, 0x1daa7a7c9fe0b0fd, 0xea6556c0dce04211, 0x3a8550a03f9d2684, 0x7daf5bf8b6ceae48, 0x77bf601aa3225e37, 0x9574cfe7608eadf6, 0x0a5465c7c0372940, 0x02c284caf53c6e6b, 0x38fe1288cb4e50c3, 0x01209f19bde6ca06, 0x074d3f63d68a5227
+, 0xbd36c3ddf107b278, 0x6c685ad56c9b6eda, 0x8eb32635114f7b30, 0x1e5cb62dd0b646f3, 0x04327941b3a43b3f, 0x3183f774f1da6f9e, 0xb3f6bcd8f83c642e, 0x663c978664eab914, 0x03309abee214b761, 0x0b3daf88b9b46f50, 0xa7f330d8f13fd2ae, 0x61fd9a9eea5fa14e
+, 0x186b09680bb8b9c9, 0x116030737cc1cd87, 0x9bf489fb1c1cce7f, 0x0090b5f4704bc883, 0x8093c4ab4d8fe51a, 0x7ebfda6ef9000a99, 0xaaddb77bcf4f07d9, 0x662a2765ef24309e, 0xaaba7d31ae3529f5, 0x7dd0963e9da5da48, 0x969b760e7de48fcb, 0x792c73e387c325dc
+, 0x229c92e7460efadc, 0x1a1f9ef560c95177, 0x6015f8bf752278fe, 0x7738d1fa61f1f851, 0xe8dad60e0525d594, 0x6922a35d6663d2ff, 0xf51ead8965f237f8, 0x06fe642bd80e39e6, 0xfe989eed89baea1e, 0x5aa2f5d405be5137, 0x4c60888b009df30e, 0x3dd21051d2307596
+, 0x18978a0d64a74fbe, 0x27c4dcfc13a36786, 0xa5d03b19cfa68ace, 0x79dcfff0ccc8ac64, 0xe85e6860b9437760, 0x25d5344b20520212, 0xd88aa108cceaf76d, 0x7c4b6d60e9c381d0, 0x44732ca03e109997, 0x6ed8945e80b02dd6, 0xd065ebff7c0ec69b, 0x4576e3225da79bbd
+, 0xcacb9353f4ca7ac8, 0x7bfe080a48440bc6, 0xd8779182b5dd53fc, 0x14b348fb67d2100a, 0xcf6307147849f7f8, 0x2c798c84960036f4, 0x19dc3b46bf6f6314, 0x120fa04e6fac984b, 0x84e7a158853ab2de, 0x48d090ef2e895a9c, 0xf8818eb74e8625d8, 0x3d0a8b6c20e84a21
+, 0x804f5035e732ea32, 0x6fbfe3dd2dc2f4f4, 0xcb16e946fd0558f5, 0x77ee871c0114eb3b, 0xc4c3877b7032c3bb, 0x239842200ed73dd8, 0x1b1d1e505fdd7555, 0x4b6125704c2403d1, 0x23f92516c80b1ae7, 0x7a61b8479e7d131e, 0x768c47719dcf4a8b, 0x14b2545023aec468
+, 0x7000d57595c9433e, 0x6885a277e3700a18, 0xfb407e0b8d472ad9, 0x3456822385537c99, 0x17e1c9faae8494f7, 0x564f32826b5ff7cb, 0x6faccab89df3e6c2, 0x152705847579e26e, 0x11a50b2f00b390bc, 0x4fb9b303671a0732, 0x2692263ba9f42d35, 0x64f2ec214dfb64f8
+, 0x6d6b8a7a060cbf75, 0x4c4375094a03f96d, 0xf7b384d470faff81, 0x4b6d685c65984afc, 0x582c89d717a6237f, 0x45745e96581166b9, 0x27c2b14a80d6cabd, 0x229cdd493262f88b, 0xb95254cb04ba21a0, 0x6593c7b621b63ba2, 0x20e3752a7343c716, 0x1642e9b97aa68ca6
+, 0x86c7d1cfb67257b6, 0x0b10893321cd824a, 0x4ede8c9ebdf585f7, 0x4a6927c00ada027f, 0x25406e6949dc21ac, 0x0aee9d75c1786116, 0xed5370875ae1bc8e, 0x57b378ae26ebbe01, 0xe58dab1f0caf5403, 0x6fba638e14981257, 0x8c14f52083dcf24a, 0x301ca8fe1c4077ef
+, 0x56b21aaffa5c0e68, 0x500602e8dee2246f, 0x762feaddce9b330f, 0x1c78a3207598e6a7, 0x40a517d329841c17, 0x37365853a471a1a0, 0x055aa0c10a671019, 0x7136b77c29211380, 0x80914dc6d94bd68f, 0x1b64d2e4fbeda966, 0x1983cd4a6fd77d67, 0x4eb3723d7c73e83e
+, 0x09d7c4f2c5fea7a6, 0x5d8ede6d947f384d, 0x4e550a65ccd7ccb6, 0x4577fe81563e5495, 0x70a0a889ba023318, 0x24a81f55344881d5, 0x16731d26194f096f, 0x048c6120577d445c, 0x595c6a4c6b488b0d, 0x2585076a51c67bae, 0x9d56f4bf680ac0af, 0x79bc32a7ae704443
+, 0xa889ff5608cc54d4, 0x3fda42565eef7367, 0x0b44d1373deb9094, 0x2aa75d7a17d1b1e0, 0xe4dc5bc9e22a603c, 0x1649746ff9a36062, 0xa3e36a07f416b171, 0x373ba5927d8da348, 0x93877c5d7ca33458, 0x4743a2af90bd78ca, 0x8e0a32dd4d499757, 0x0f128825bd5760b9
+, 0x1aa49b008f5deb69, 0x443bf61afa3ba4da, 0xef6eb6a9ad096da4, 0x0ed02677c6566f27, 0xedea1fe791b35d07, 0x65a7a3ecac65c12d, 0xbc76a9430ed002af, 0x2799c065c16f03dc, 0xe6eb5a35ba621fe2, 0x5dc11d6f02d7cc73, 0x59df049a29660e22, 0x6f8ae3a760909576
+, 0x5d533ab807313cb6, 0x6fceac4ba3fb1671, 0xe411774328330e14, 0x41c1f6875e30d6d9, 0x05b611a797418082, 0x69bd518103bc87f6, 0x32bb1de4b0bcb948, 0x3bc9fb1503c79589, 0xc08e020bf87162df, 0x46a8a787c13df9c2, 0x4fdee8e3549e3622, 0x02c30c81716322b4
+, 0x1cb204def7286f29, 0x6df09971431986e2, 0xc60213192820b7a0, 0x115c89901190f5b8, 0xf246a3fa0aeda067, 0x7c191bb03bb0c20b, 0xfd4122040bba1499, 0x0c674c6ee681165a, 0x59429ef4f29290ec, 0x500a575379dbafe1, 0x3c097aa490b5123a, 0x2021c8976a2a7a15
+, 0xa853a7fe2af65d09, 0x16c13b9f6dafc679, 0xf60a951c4e48f983, 0x029f6cc24ed80f41, 0xb6f4cee33806964e, 0x4d241b5ef82425c3, 0x764abc7d49b4518e, 0x5d2c02dcbb3facc1, 0xf5c320f8fda79cd8, 0x24b159434869e381, 0xdb1240496f52180a, 0x5b8c010a0c13eb2d
+, 0x08db346d9f839ee8, 0x5db8cb8198021c85, 0x7701fa9dc716056a, 0x5ae4c5bc6621b519, 0x7ba922539c22d45a, 0x0c56912c22dbc71c, 0xef2b85c748f3e6ed, 0x2d5251935d50f487, 0x998b2ad5516d82af, 0x02718259536f1cf1, 0x58ac54feae4ef6b8, 0x53a20cbc21a545bc
+, 0xa301857a60c8b981, 0x6202473688ca866c, 0xafb8d1604e899b64, 0x7ca39305d0976c9f, 0x806d2262953d1999, 0x7245100b2411e9bc, 0x31e0164c5efbf81a, 0x59cf8003ed5c9d91, 0xfb2bce63b5ad5654, 0x6d33d1f282d9bcec, 0xe5658632d46e183a, 0x586c099c76d91936
+, 0x041fe68fb75ec88e, 0x7ee04a9642736b4e, 0x3ac5c66843c6280f, 0x74499bfe9c4c262c, 0xa84310948738fba2, 0x638965bbaa5d3de7, 0x7e2d023c9902785b, 0x35a7507f1ab14f26, 0xdf361e96b31b46dd, 0x54a52971131b2cb2, 0xa8d942473e3c99a2, 0x17d3365a78234ac7
+, 0xa2cccf874c17e54d, 0x176094a73678e633, 0xbf826b3a9bbcdf8d, 0x20db997f25345542, 0xb847356fb8132f71, 0x4e6299168d589d9c, 0x9f6fa3c0fb73332d, 0x6c12da849161a2dd, 0xe21afa060524da07, 0x4c580455ca7ee46d, 0xb7b8840d0dd2228a, 0x695c60b7687f9307
+, 0x0b75fa69c14fdaf9, 0x73b444a14fd97e06, 0xb816dbaaf4a16ef8, 0x2e7fed412e8b700d, 0x03dae07e9f8a7d98, 0x67069f008eccbe79, 0x56070d3dbb5e96e6, 0x133d1986d25c2ce3, 0x8f347a223c244965, 0x0a4cbab4d55223b9, 0xcbc95ac877305551, 0x6b8512581c4c372e
+, 0xbc87c451fe83cf31, 0x13787c0bdc77c17c, 0xd49c64acf4322f8d, 0x095b5e2413f04b6d, 0x2265b4e6fe8d8165, 0x4c618aca565e2a16, 0xcd665812d3800e62, 0x242c4163763ef273, 0x08af48ac48450cbd, 0x67aa305db445a771, 0xc8b315bb30cbcda8, 0x6ee298820462437e
+, 0x1d7c6035d6ebea1d, 0x1818e7711b89d6e3, 0xb4d7a4570ce2b4ba, 0x3956df3202f7e839, 0x5b4ed39de57e410b, 0x1dc1ae531848355d, 0x5f7a192aed24b52b, 0x2af5dab33c7754ea, 0xbe542f210bb914a8, 0x6c1a96231c6e909b, 0xaee26c08df381fb7, 0x5f839a56eaea8cc3
+, 0xcdf943d40c387592, 0x1d6faaca08577b86, 0x8cd0d74647883474, 0x04fa9ff762df94ad, 0xb1daadb060d2f56a, 0x3c6ec99aa3a29d3c, 0x66cc33a88fae3929, 0x3ad9d083dc777f27, 0x6b36a63f5ebbafd4, 0x7ecdd2675abf1e66, 0x79173a3f2f80462d, 0x7820567659804e8d
+, 0x2b402081c0839bbe, 0x7453ca7951e6fcce, 0x4fec601d54b3b37a, 0x632dc914004f236d, 0x660ef10676046d53, 0x2dbda9f3b81a6bbd, 0x1e815f6f92d2566a, 0x44fb74757e47407f, 0x0aa84083c9f4a90c, 0x650f8e65097e4d8b, 0xc3ebaa916d235286, 0x7f8a4f44af1590ec
+, 0x1decce9df8ff1238, 0x46b44ad9f394b6d4, 0xe0823c67cff1d256, 0x35a96cba018c6f2a, 0x22c6e1c2ad5763fc, 0x05ba46720f6f1052, 0xb0c18b6a06f0e25f, 0x113444159c585dde, 0x0bde5404d4547c6c, 0x3384096c88dfc008, 0x18b01f6b4b281475, 0x3cbc4591f9a9a874
+, 0x83c507e315e03904, 0x1240265107b64bff, 0xcfa0753f8835f467, 0x0cb1ec4aec79b8eb, 0x4eb3b6f395a00322, 0x0dfdae93f5becc01, 0x06559966ec2c9c04, 0x15fb9c893c01a1b8, 0xdf933f60fbad1f2d, 0x6662dfecb5ae02d1, 0x9d3bdf7a4e306699, 0x52647bf5651081d1
+, 0xe20bc1802a5a8745, 0x5952d2f8ec8c101a, 0x3fa065a250ad7d0c, 0x52a9805d8df282e5, 0x68f601637855689b, 0x634574adaee2ccc8, 0xb512425c4e23f90d, 0x2658fae989a6a2ec, 0xb03c8750061315ec, 0x086854943f24d7d0, 0x44feb4254d14e87b, 0x428c4665495ac419
+, 0x18a23b830a58f27a, 0x5923073c4a5f74dd, 0x905293d015bda063, 0x5bebe01a2c1d409d, 0x9d05b00cbff1b589, 0x3e36b958ec37c269, 0xfec82fceb5cbf052, 0x0d8ee3c9217eb695, 0xb7e9ce693e92044e, 0x2db762300ada9daa, 0x6f9767f7ff1602a3, 0x6fee507cb455c499
+, 0x6bf20eb1ecac85ab, 0x484cbbe7f2800a7c, 0x28474d376eb66121, 0x239157180d516785, 0x31fa208f7c794cf5, 0x67e1d953093c4f7d, 0x0c08e7c317ec0e3e, 0x2031f2e2f7e15404, 0x0c90057627667aaa, 0x0e467cb618c6c788, 0x5ab775593ed51b3b, 0x2f865f2b18b5bb48
+, 0xf41b1ad3405cdac5, 0x3d990ad3e31cbd08, 0xfec125e3a3fdf400, 0x14d1b79b69c85940, 0xea608735cd89ef76, 0x1cbe58fbeb149200, 0xb556a377ec23274e, 0x2f35892cc4399011, 0xc3806ea7866f8b34, 0x0df15b6785006c39, 0x5a170b1fd0b4508c, 0x05e24fd59831316a
+, 0x79aa2405f2d90efc, 0x1cadc9a055c00e15, 0x6946a335d078d333, 0x176c1193cf40ae72, 0x3079fba8480bc7c1, 0x02b9ac81acc4beca, 0x1f665ca2f3fddfb0, 0x0d6ef8af66754ded, 0xc206f5cb12db7ee8, 0x0f0ea2d2ae63827e, 0xf165d134be9737cb, 0x05298583f0ef39b2
+, 0x27b8e26f8e58a154, 0x623e1099af3ddc53, 0x3df2898172c94dfb, 0x30208e100c250c37, 0xdd1cd622466108c0, 0x16ce1b6eadcb7d7b, 0x265918e2f89f6969, 0x322f6b1d46ffdabd, 0x78ca3c9a0541d66b, 0x5cb640efb8d22079, 0xf5ab4e7e413ae3ec, 0x1c745faa840756e4
+, 0x7c1672da9f606833, 0x6e61c64d8fed5144, 0x53a70c3ec4a754f9, 0x78dd246dc9a81b53, 0x40992ff8861e994b, 0x7e837372b6ff23b3, 0x86ff0a9610ed2f1c, 0x61f2cdd1b2996807, 0x42c8cd8086e96dcd, 0x65c82bb535f4a687, 0xb888aaac19d64f35, 0x35fe559ef3d8bbbe
+, 0x20b98646abe5ac5d, 0x64b3347bd7b7e05f, 0x1bbb988267e91058, 0x481389e085b9d63b, 0x85f4bf7c8cc5bb83, 0x38d9f9025197ac2d, 0x820110b4e551140a, 0x403df135da1b1cf0, 0x5a535c7be9a2fd67, 0x7f4087f1ba2aadac, 0x43a947219f19df37, 0x6e8791b8c1e0bc08
+, 0x2201e27782c7c860, 0x07dc563cc419b8d2, 0x8a110624bdeb3d2e, 0x5767afcacf080ce2, 0x29172b2fd76f4f7d, 0x52905fbd6bd2d8d9, 0xa75e9989b5ba74a2, 0x5ee38f1ade7d705b, 0x77a39b182d38f44a, 0x446871a56ce5331e, 0xd05af83959a8564a, 0x52822c9051c146dd
+, 0xb2c30692ba9d79e2, 0x46f97533b004fe9f, 0xb09204f864037ddd, 0x6bf72cbcdbfc6203, 0x2506f14bdce516f4, 0x1459914c3bb8f60c, 0x66b917fb818b5356, 0x03c183f4536c6fef, 0x98efd0d3b3e70eeb, 0x2c83271e793c6e41, 0xb23daae89fc0abd0, 0x09aeb6c2d9ee79c0
+, 0xc8f1f32c20512adf, 0x6ad86ac52dfa34d3, 0x469002056e4509d0, 0x1d193f05f2ee143f, 0x16b2ba34c8bba71a, 0x2940d523851ae6d0, 0xc2a51c98b48324b3, 0x50e03116f7404857, 0x8297d870ec12248b, 0x086bccd1d30ca0d1, 0xc141bea068bfe275, 0x74d2d0960fc43d39
+, 0x366208746a70e3eb, 0x3401c3ca6cd3cf73, 0xdad6ab23d41560aa, 0x588ae7e806527e7e, 0xd694bfa0fa61fb8f, 0x0841e4b28d4ab05f, 0xde8da0b51d81764d, 0x480fb49396224644, 0x0f1a25e9158b2065, 0x63c08e83f17d301c, 0xf77c8582774b30ce, 0x456c852bb0d0cea8
+, 0x684a0359271a45f9, 0x2cc07bd51653fb75, 0x95986e8e688566d3, 0x5807fe5c03c3dce4, 0xfa6e846fbc11e16a, 0x266d4ab0d7aa21ce, 0xa4789acc73f092b8, 0x45ce23e697cdee22, 0x971ec5804ee660da, 0x58f41335692a31a2, 0x5e19258e916ccd18, 0x64b2985456c7b439
+, 0xb88b4f5524a072b2, 0x045245a268ff7ebe, 0x397b9cf4715422fa, 0x2df66250cc640e36, 0xcf8be29b01134e38, 0x1738bcd04fa93d77, 0x64dba76de382606a, 0x2144913a7d5e6e65, 0xe74c629042e2e617, 0x2ee368884ed856c3, 0x672df54d9c8779b4, 0x756233730142f359
+, 0x2f6e7d6c9dddd051, 0x1a7c4defc33e575c, 0x64710185b12c8b93, 0x3e16beb1a0bae4b9, 0x5d3c6a36914f0d59, 0x10bd6a39cb75e426, 0x2095cc44942d68fb, 0x43b6d315aac9615b, 0xe8a754947b86646a, 0x02fdf7520eb908bf, 0xfd3ab5f5832aa3bf, 0x5fa9be37f2d67c46
+, 0x6c9f1b8d87361192, 0x7dc32e6eb5a93c28, 0x0a67613fb0d201b3, 0x419e06c3c406db63, 0x48c0fa87e291d49f, 0x0d33e392d90597e5, 0x30f0008f6a950583, 0x4b5c22aa0b68d947, 0xe4a1c20bad271268, 0x1b03ae7c483eb499, 0x4d9cb00420e83aa3, 0x70edada1a11cd659
+, 0xee0e4bde8fb17d03, 0x2535e578d6629216, 0xfc730854cfefed48, 0x2a970b50a5dcf5f2, 0x1d1a9e4602b4db22, 0x1657b8a9ec4a96a2, 0xd3ccad9f7560e0ce, 0x649dd9a6d8591201, 0x30cda5f289211328, 0x753d5d773ac532cd, 0x776857ce9e602d5b, 0x4cc005afabf9c91d
+, 0x053057cf9b44570b, 0x3afe54c8fb18d686, 0xedb285732bcd0ba1, 0x2d3ff63bb43ff270, 0x924a583e3d83ca58, 0x54c0c2ae8857877f, 0x6689d23967c883bc, 0x1191c43b05451b47, 0x75feb3a0085e9d3e, 0x39d4da564b7586d5, 0x2f5d72bbf319db3f, 0x35900503d2c5d064
+, 0xa1541da8431c1068, 0x3fdbb7988671edd9, 0x79c048d14a82a0c3, 0x1f052db0af419fc3, 0x387618aeff1e1c11, 0x2e43e0d6afc2f99f, 0xb4face3562c9a5ca, 0x2257c41d3432697c, 0x5ce060425e053e1c, 0x61d7e1ec8a6f8b06, 0x0ff37940afbc00d9, 0x75b3e53c155bff84
+, 0x950e3756a4a6b179, 0x05561ccc1151b666, 0x4d32877a48e95cfc, 0x7a8a50dde09825d3, 0x2986a4d301e830c8, 0x3749a81b3123da18, 0xad9910160539a374, 0x5c7b3ffe523cd588, 0xb3e8263afe3d463a, 0x7fce24a3f39ec3d7, 0x8568f88196f51307, 0x3ae55741abc880f4
+, 0x9967f912d43a5861, 0x516d6790f9b0ca24, 0x813f780c1862dadb, 0x03225f78d1d71bb0, 0x924944249fe6d36a, 0x204c743dfcaaf652, 0x3f9bd88c488b35aa, 0x30f90f608d7d1a99, 0xb176509feeca9022, 0x37a55bf73adf03a5, 0x60fef45e698ebe70, 0x2afd56279e4359fe
+, 0x0956a94a33799498, 0x7548104490435cf6, 0xc2988049f96e284e, 0x4f33dd766942cce8, 0x5a4e7326aeed9f5a, 0x07881d61c719d1c6, 0xc20706662295530c, 0x1d136d3a8b494589, 0xec035055bfa08991, 0x45b1b1af34791ebf, 0x69ca7f228d18966e, 0x3ac37828a98c9d1a
+, 0x829cda491c546f92, 0x305f1449817733e1, 0xdf65db14f6b0fc6f, 0x725b0d4834904f70, 0x9dde4c40d142363b, 0x0d40e05b7e2f5c6b, 0x776d5fb54d2e2907, 0x189e4614b227a178, 0xe6b6faf7e9f931a4, 0x1c615ca49f0ce730, 0x985fc1f52d8d55f1, 0x0dae7dfa4a3b99fc
+, 0xcc67ea79d9c20688, 0x1e4854bb44cd5049, 0xc8adb8c78c2220ab, 0x75e6a312c905b219, 0xd6d186c24e4540e4, 0x27c60e2aa09f2ab3, 0xcfd0362191b298de, 0x2cb2f5d001481141, 0x6d37246c4293a9af, 0x35ffda716ee4f818, 0x76c8e96c09611699, 0x23484123c6dbbc3a
+, 0xa2c408f2f1278492, 0x7107686e8241a295, 0x7fb45e8db2f07ff0, 0x5b27d3197a19f9ee, 0x8fb9cc0211536421, 0x036f9de94d7c4392, 0x8c24cb5b7e70b11e, 0x3de91f56f8701f10, 0x6692801bd6cdce86, 0x2e35bbfbe2414c55, 0x3999fb63ba9e1240, 0x0291eb7433bef96d
+, 0x6a1297f1b8f077e8, 0x2274c830705cb60f, 0x4a3865c06cacb61e, 0x7b59ad9ef11646d9, 0xc2578a396750c1bc, 0x0dfe803feda4d9ba, 0x2be87d9ac4202093, 0x1c5abfca4bb0dea9, 0xe1b966122e478ab0, 0x046cfd2bd233513c, 0xa46c3b2bc530f80d, 0x43a38bebe4f812ff
+, 0x9d42ba309d9f7769, 0x74c5f3392ff3017a, 0xb3f0bdbd787acdf9, 0x29362ce308859ed5, 0x958ee075dff58d95, 0x45675cb0f0770bfe, 0x21181c05726df879, 0x58b2f999bc69a00e, 0x6e5673b19f0bf0f5, 0x1346205999876c1a, 0xfb012c2ab870bab9, 0x1e0c365d709930a9
+, 0xa3ad5ecd9ff05471, 0x26e9a0860bfc7557, 0xbf5844ca8b018521, 0x0c80fdc3e778bc61, 0xb1e171c71925829a, 0x2de99fb86e8eceb9, 0x1891d47359777773, 0x4858b7f37389815f, 0xdc68002f75498908, 0x4f3d6fbba967334f, 0xa53e066097cac123, 0x582769cdd4fb6dd7
+, 0xb58b7dcd9a3301c3, 0x3cbf2e931d3e70c6, 0x76194bc030d001ed, 0x4e042bf6f61c17d7, 0xf79d988915afe8f7, 0x2de1d5da8b87acad, 0x9529da0eeef9a4c7, 0x19687a43630015e9, 0x3dcb2e41316aa917, 0x65ec4994f93d6fd1, 0xb4554aced8336115, 0x73c2aff295550012
+, 0x6903705ad67cb029, 0x030caa43e7e5ff8a, 0x246c6b0d2fd77054, 0x47c4c0386ec50f82, 0xaa0ea03c1dd8e8fe, 0x19adf3044190de8f, 0xec654144f5e5bd35, 0x0f94cf9b0644aaa0, 0xbe7934a9d736bc62, 0x64da79f691a43cd4, 0x0c01b4c50c4394bd, 0x5d16ca65650223ef
+, 0xb3354409003907ed, 0x03e9aa3a6af8c020, 0x097b31a842b6a8b6, 0x5166567f36b66151, 0x359f5a6cfb24db3d, 0x64fb477b070f9a15, 0xb7c7fcb2ede96eae, 0x142d037e081dba76, 0x98635d956d899a91, 0x1939b8d9d74c16ab, 0x58113cdd71daef71, 0x1cf41258b48216ed
+, 0x4a26051837230707, 0x324b418886426daf, 0xcbc352925cb06abc, 0x541de0acfa007fef, 0x6cfd188e729cfbb5, 0x0c9d69a35d71568e, 0xf97b12d19adbabd1, 0x792e842db7a8aabc, 0x0cc5bce8410fb22f, 0x15c8abcb6fa433c1, 0x2055aea191053d1d, 0x407895a119d64f40
+, 0x5d0a37aa0a6248da, 0x6c992ede8d71d52e, 0x15c405bdc3c41f58, 0x7dd8159d8ef32878, 0xc22ae40684780330, 0x327214ffe4e0178c, 0xd3f3f461c4f75c8b, 0x33be50619a98c0b9, 0x92b598d60fdee6ad, 0x157eb91e937c4cac, 0x424fe9a9cb14110b, 0x77dcce6cdd25a1bb
+, 0xbc0e3a69df85d720, 0x3cc2002c09e3de24, 0xda098a844e234ae7, 0x55139224a05e3f7d, 0xa856a282e0348ed6, 0x7585a446666da983, 0xc353ec89c837ae42, 0x281f49f86c5f40bf, 0x27296849c00f9e84, 0x7402d47a433aecdc, 0x8a3ec66e23b0cae2, 0x3ce9ea8c795f0f0a
+, 0x8d545e35edd7d273, 0x33c1720ee5a43c9d, 0xc8d20d75c552dee4, 0x2b14d4604d71d2d8, 0xa2aa4a5fbf978155, 0x32c1ef398c4f8575, 0xae3d07af9bed755c, 0x30dc7b4621a7f440, 0x6b8788afced66d29, 0x21664b896713e68c, 0x1e531a0a66854aeb, 0x3ab8cfb2c8cf9529
+, 0xfd6a56957b0287d6, 0x189137ce2d5a93bf, 0x394d36bf2b5081fc, 0x61fa5b74c5115e78, 0xf20d0af62d954153, 0x665404e13b0eb3c1, 0xc7d0c2faaa261051, 0x1e517bfbaa998e24, 0x7431aa84e1aef1da, 0x492ddf93d0348d21, 0x3cdaea0134bd614b, 0x4dcce0de0cf906d2
+, 0xbf08549d70b345c4, 0x41afe775a4a678ce, 0x2b222fae60cf09d4, 0x7fc35b4d728a46f3, 0x0dfca024e5a51454, 0x359a448fa656f6b7, 0xc99ba0c07932f152, 0x7289aecd88141c05, 0x6fe38079b2955747, 0x02cee283352a4fb6, 0xa12b86ec147674ca, 0x1982bb91e079c473
+, 0x961d6dd73b60751e, 0x78ae86eecd824457, 0xae9bd837f471e7fd, 0x01592cce5f74e007, 0xf7b9fc7161b93c3b, 0x17a2a612c75d2c36, 0xdbf80544eb3bc2c2, 0x52f4633b91c12217, 0xee1c6c8b531c40c2, 0x057ba41d30dbc2a2, 0xa1574dbb9f0918b9, 0x389fab67e3719ab8
+, 0x15be18a2766c505c, 0x6f22d71b3a174e14, 0xd19439e272c11b7e, 0x74188998464a6dc3, 0xff23d8c578a502c3, 0x6d833fd91514c9fc, 0xcb269e8e19ed640f, 0x5f0a7bb6fa32245f, 0xd798cd6c88fbe39c, 0x58ded7fc56ed8d1e, 0xb8877d6d15603563, 0x7e466d23aeb3dc55
+, 0xc29cdf2572d68e39, 0x5a40cd5d143c8328, 0xc4dafc286002197e, 0x332077d42ed024d8, 0xdaf7de833535939f, 0x5fb9a23a88708cf4, 0x84707a28e46f4ee8, 0x208c50c441d4c8e1, 0x1bb8f66e0e2e9733, 0x414e6326c0d7d8d9, 0xae3159190bd395ea, 0x4a01b8e96b29917b
+, 0x4dce09dd5012c8f5, 0x421d4290a65ec3f0, 0x4b196f806af7d76b, 0x52365b62c38a9809, 0xc79837885af63b44, 0x0a58d95cbcb4158b, 0x2c52cae191bcf6f5, 0x32fe4a021a33f52a, 0x7da768d94ab87df1, 0x6e3acb2f83dc5986, 0xb05b9b1c2585899d, 0x08313dba415c9cbd
+, 0xf80c01bfb898408c, 0x7de7e96206c2f9bf, 0x7906e8a3237035d6, 0x2b3067d599b89817, 0x6dfa205ea8a649f8, 0x19f5e21ee534695f, 0xe9b9b6f84fefd719, 0x260350ce0bf71f9c, 0xbfbb32f7c34ba867, 0x49eb557e720ab191, 0x437815904ef305c5, 0x65083a4ebfd006c1
+, 0xe037c650afdac904, 0x1cae9ba2425aec62, 0x0bba4627be345b73, 0x5870cb1bea5d6f44, 0x3e9ecda0a01f2af1, 0x2bbabf3286833230, 0xa4c12cb0d08f3aaf, 0x70daaf397b485c7f, 0x8e82aa49051db89e, 0x38c38c6eff6df6da, 0x9c19b18b3f210462, 0x11a58ceb0040559d
+, 0x35e23e8bf5d5796c, 0x7bc18d8bc5e72162, 0x5393a7f992543751, 0x6a14e912bc81d53c, 0x6ed5a5f81e3981e5, 0x2510f03eecd0b900, 0x4cbc310ef93119bc, 0x7f44b11e5e7ccee5, 0x107fab3bcb0b5ce9, 0x49bfd204e710a90e, 0x622df29a0b326198, 0x1923ed009a451b9a
+, 0xbcf1278d3eb5d85d, 0x61fd1abdc1677740, 0xd77732b122ab0b7a, 0x2e47c311569d22f8, 0x0cb74ba4856a3f51, 0x3a1835a759a66b55, 0x9226a0cfbf9bd3f9, 0x73cf9920a09d743a, 0x531f19026d884c9d, 0x5b8466095fef9d49, 0xf44250c1a2b618ba, 0x0e803783a6a1a726
+, 0xbfc4a43f8f2d4109, 0x7c3e96065a36737a, 0xc4f61d732920851a, 0x2ab4f35c4fca93b0, 0xa7fb883c67acb77b, 0x4e03483cded7af7d, 0xd31afbe9bb0ee5f6, 0x1a8063346ef5c7a3, 0xa6f2fc0a7e5fb0fe, 0x2c0e3955200c05f0, 0x05906e9f9ee1e71a, 0x2da8a7e80bcec1f3
+, 0x9de4bf9490efcbf4, 0x72af90f397575474, 0x5b3b79b1aecfed04, 0x2cfafeec6646a9ed, 0xb18b6a08264e8569, 0x715cd9bf1dc7ed14, 0x520726e0e60faf1b, 0x499b4a43dacb8dd8, 0x95860e5c782216c6, 0x21212bc9aca7389a, 0x8418aaf459125fd9, 0x01e4fbaac319c289
+, 0xb5d701efa295893a, 0x4fb6bd249eb9d2fb, 0xdc779f3bc63c6589, 0x356edba4b5cf4b30, 0x8fae05c1a9ff1014, 0x2d8831ca8e63cd3e, 0xd93cdc6964085493, 0x6e4ea68aaef40cfc, 0xa05a99588038015a, 0x67f8ac29ec659019, 0x33c53e5b69bb03d2, 0x12fb9e9b26919fd5
+, 0x21845030b2dcfd21, 0x65f1d2056f561248, 0x910a341043bdd0d4, 0x6d717a14eef73cc8, 0xd67880407d1e7727, 0x0f4c4b7b0c720218, 0xed4a38a42f942074, 0x18c65fb912c8cf37, 0xffe881f04a5bcc3e, 0x23d92d2276cab2c4, 0x8f973914bd77cc2c, 0x22ca2bf49c088d8c
+, 0x9e1e1a9eb2ba86c8, 0x04e9de5e5829b417, 0x6617e96ea31cafc7, 0x79fe68c9451d8662, 0x685e8c0c1bdec760, 0x6e84d2cc4308fdb7, 0x5fd0e5ff929a51b4, 0x77921ed754887ea0, 0x4ba2f03b633a9c64, 0x25a5e7f439a4ae8d, 0x9094e9c5e0de703e, 0x3a2302619511b3ab
+, 0x869a7c2d3e01caa3, 0x4d510232e2a7639b, 0xe0c3748d778af4a8, 0x549b520d4d9162bb, 0xa0f619f0a3b99501, 0x10dd71634b51ce25, 0x6e1f47d041377bd2, 0x33da6eaabafa87b7, 0x3fc07495d3b017e0, 0x11502b7f1f224e19, 0xac7f6dcf42235818, 0x21298ec72e8741f1
+, 0x102d8e9c84b96867, 0x3a64a19b73e755e6, 0xb25972ee8c24b630, 0x6b859242263592b8, 0xac0970db770d1363, 0x5d34e3de83215dec, 0x714656f3068517c6, 0x3fc0fd2bf1c38152, 0x212c87be0074d1ea, 0x226a55004c6aa686, 0x150b9be8ef59585a, 0x79ee4b0e568a2908
+, 0x425f1d2106f7e672, 0x2cd46d7765b081e2, 0x5c811166516e786a, 0x625e928a8473cd68, 0xdeffaf732f19ba31, 0x056de086c084f2b1, 0xf9809976e3df80b7, 0x6495ab8e839740a2, 0xc1fa019a6a5889ee, 0x1965d3c6ca33f184, 0x22f49ddd3f68e9be, 0x290cc9c4fcffc6de
+, 0xa74cb634e1294ce5, 0x3997265f259cefdd, 0x836ebbd86d51f37e, 0x43d029f7ddb547b1, 0x505d00add358f33a, 0x38eb30b569721669, 0x74b2ae54a96ba8e4, 0x58e52b0d10507ffc, 0xc133a9de78e09475, 0x0c7b3109bb88e5d8, 0x2d2ab0f6738b08e1, 0x56ac4b483fdacb3a
+, 0xc6b8cbdfb1b4eed6, 0x018344213f0d9a8f, 0xdd655df598e1e283, 0x465b6db5c2b4091b, 0xdd8014387d7db4bf, 0x7bd6d3546fbdcce4, 0x80c5ab6fc4269ea1, 0x1dd8f134a75b9401, 0x58dfb83d06802486, 0x420345bf66567627, 0xb62babf4bbd51385, 0x1b479e9d86ac06ae
+, 0xf922446e7a2191b4, 0x50101cd192fe02db, 0x56acfca055a16217, 0x52aeeca456c2e95d, 0x36f549e1acf68441, 0x35060318131fb9a4, 0x662c01bd076ae51f, 0x7431b40f4c3d5edd, 0x38fdfdc09b192ea1, 0x19927b1768df0157, 0x32b17a7e3cc997d1, 0x35a67f9d991709a4
+, 0x4ada69288011ce6b, 0x2db6e94b95465bd4, 0x04d0caf9f77b862b, 0x3092f116f431bf12, 0xa126ed73baf3d599, 0x54b86fc7b16ef31a, 0x859b91b1a7fe4e55, 0x3d616b77721ad51d, 0x7e68bf71e9885aa0, 0x4963a82a94c64a5b, 0x60bf8c087b1380fa, 0x3938e73fa3331dcd
+, 0x15260b850122ddc3, 0x26c4369742b8e79e, 0x0548d2e9e7f1ab71, 0x706af6eb2cc7fd8b, 0xd99c34f15cc40674, 0x5b2a26525ae1764e, 0x038a63aff1af3d70, 0x7770ce80cde050c2, 0xdc21afb912a5a69c, 0x707d0bc0286a5834, 0x776a28b9e1f7f0cd, 0x56d63ce06d0335b5
+, 0x4ec60115a109ac18, 0x187c0aba28453f99, 0x1ceaf819000a0b9b, 0x526b87d25a957cab, 0x0a0ba6b9f85f547f, 0x3c885e131951d45b, 0x5a271ddfb37c5f93, 0x28882981ba3faf83, 0x86ff40103c2e9f70, 0x20b538198a43f599, 0x7a679700ced7c4d4, 0x1cfa960dad99f7a8
+, 0x62575a9b9dc36599, 0x383aeab6d010b659, 0xc75ccccb924a8427, 0x7983594c2eb286ed, 0xe6308686f3844b54, 0x0b07a6f91f5338f1, 0x5ffe25201466c727, 0x3b968d1397c03d25, 0xfa6dcbb1e4a97d8a, 0x7c7ed42a6870eca5, 0xf301976f7a471825, 0x0b2a8c3705bd6aa1
+, 0xb5e8269f934bc4f7, 0x780317ea58751cc6, 0x22bd26a2d281ece1, 0x5e7809bb2eb9433e, 0x3d6a8495324d8f28, 0x4b87520dcd79b4c4, 0x28110375a5bf57ce, 0x08d251fbb07a7cd7, 0x5fa9f4d79c322253, 0x29813ca056ef5a45, 0x10865b51a1b6455f, 0x44e69192297da376
+, 0x8c75306d2fb7b1f0, 0x5d7c2fb87d76439f, 0xc60ad09151c64162, 0x730ee5f5a705ecfd, 0x2836987b2f8a3b30, 0x5ce61a0fafabcb05, 0xb7bb636ba2ff20a6, 0x4f803c2b821d5cc9, 0x4d0ac0ff9a295c5e, 0x1297ec17427a5386, 0xe62f742beafc07ae, 0x428cfbc9a64f4570
+, 0x02a9e069f88e64e7, 0x240c0c66021a1f3f, 0xc279e6f334ba854e, 0x460ab72bcc55732b, 0x5701c5cddbf67ba0, 0x4699592d43c43d6d, 0xe7cc0204a34b343e, 0x09a6f06112046919, 0xea265b49f02ca31f, 0x3902234c63a36b13, 0x495ec2599f4d9c32, 0x7a7e8e48c690276e
+, 0x95e2d94dbabfa143, 0x23b7849cba3688e5, 0x5f96cbc0693dcf48, 0x4f0ab67c03c852a5, 0xe497bd956def85a4, 0x4efbede060eee32e, 0x06c5315c7c074060, 0x639464cf334638f4, 0x8a170c5d4284f2f5, 0x42de1c86519cfef3, 0x169eb6f71fba06d0, 0x16e6d6e8df2f72e6
+, 0x00e1d7e0b0878b38, 0x1c16fc717aa25ab7, 0xbdd6e3fe832131b8, 0x5300318f801b49c9, 0xf1a9a73308172dd6, 0x1bec21f4cf3d95ac, 0xdee45353fc1d8e86, 0x61c41d678920a7e4, 0x74f0ac04c34a7f36, 0x43272eb7ba592944, 0x39c691bf65957824, 0x7e02eba5ea915dbf
+, 0x2e8fba117a15817a, 0x4467750b995404d3, 0xdcf7753d1d686ee5, 0x0ab173b438516a79, 0x87c8bb3ac1254a6f, 0x5c3c5a34106a7b4a, 0x44804b202e573331, 0x57086b6114a5d52e, 0x272e4ba1fe5c5f9a, 0x7d164df5a4248b5f, 0xa5263a1d6372b449, 0x3ffedde56940a4c6
+, 0x2d0a61bf515a5a4f, 0x4becf6153ac1511e, 0x484c8ec7cce784be, 0x35a0d40f4dae6ec4, 0x734b38fe3c8d94e3, 0x38ee2af93655d07c, 0xe7299a9e6ca72ac8, 0x780bf6080cad3ab2, 0x7dc49b73a7d012fe, 0x7c94c5b868ecb8c8, 0x8cf70cdea81faa2e, 0x44321027d3237f14
+, 0xf723f9daa03f2123, 0x3fed2b576b1374ed, 0x77aabad52554d6f1, 0x31bf88d0cb9fb053, 0x74eb75cd1c6d5030, 0x4f2d075b99ae619f, 0x838a37c85b97ac9d, 0x749428938f478bab, 0x5c556ec8b2c9da1e, 0x1cb8555c0a9d4b45, 0x8d17d3e522519453, 0x628bdb5aea9a7f3a
+, 0x53cd9bd62532ad24, 0x398287bcc8b3e443, 0x6795234180b897f6, 0x075255b5d44d2525, 0x00d9cefaa50d788b, 0x3ef7ca8ca3a91b34, 0xc3c910c868b14bd9, 0x2fbf5be9858a2b5a, 0xd54a1a20e2607896, 0x41903b05404c05ed, 0xadb400016a71bb21, 0x4b15b62694968697
+, 0x0893a5dab5f1e383, 0x56930c948b4cb313, 0xcc3b15a18e753aff, 0x488ae2aea34aec20, 0x09d5fa1b580174f6, 0x27e6d872973559fa, 0xe322c4eadddc309f, 0x38a74c47b38debbb, 0xd3f2556a99aedb37, 0x74917c87b123f41a, 0x5f581797709a5961, 0x5adc0e33ecf4cdf0
+, 0x2b556ab2cc44e2ff, 0x6bdd478defd89aaf, 0x5ebb041ae5d71f0a, 0x357493bc8601f496, 0xa318c9b524a0b3b9, 0x7786b7a7063512ea, 0x06929cd20082c2f7, 0x5273a6991a667bd4, 0x376aa2a4c76c5b5b, 0x3850f4f892956ba2, 0x8807894c1b521f0c, 0x2e572aa92efbc77c
+, 0xd339b31519c337ea, 0x5fbb2b0be49cbcbd, 0xcd2d9fee4287bfa1, 0x11d7ef91f5535828, 0x8b03b409336bc2de, 0x17b1411eb90c654e, 0x4565ec2a56fa1adf, 0x06b445d3d8beb15b, 0x8f975e4bcda62828, 0x482029c2dcebfe14, 0x2b1af68ed817e435, 0x62c642de00fb9abe
+, 0xb4637f164957911b, 0x70cae1ddbb9a3939, 0x2eeaca77a2f3c1d2, 0x3924154c1c577374, 0xd5859686c8079b9c, 0x4216d3d08e409c44, 0x34f6a0c38c7e0884, 0x19875fb8abe40712, 0xa7af61ec8d716e99, 0x387aa793d75f33dc, 0x8b0325f97bf5277c, 0x596117742c7a15b9
+, 0x4ddf426c4d45f5ac, 0x5e25dda279761b18, 0x607968c2ff86fe5d, 0x5f0391b19fb1c18c, 0xea62b033c07a5e91, 0x37826d24bf989baf, 0x78c77b1ad8c53c0e, 0x71c17e32f459845e, 0x6e1ae8d66924fd51, 0x3108981f79d65f05, 0xffee474c20f2b723, 0x35801ef7fb886d7d
+, 0x42f1a39557d48d49, 0x233be8e13c7c7efa, 0xc55aa3dcb04af876, 0x50a1a541fe5c01c3, 0x0a8f77c551d5bce2, 0x628fa17ad98ea035, 0x1b7fda1c1ddd86eb, 0x1c7646327c781dac, 0x7d5916d034f1f0d5, 0x04efcb86bc576942, 0x7b2a435661e0483a, 0x0ba82794604836c3
+, 0x4e0eeab209a2e94f, 0x601af2914584776c, 0x0628b642cd3c32a3, 0x2c553374478ad191, 0x8469198cb41ade27, 0x16ee338a6f14b59d, 0xe4144654d4ba977c, 0x56ea6e0fbc6032d6, 0x2b7670ae09767ff4, 0x129caf11f1ca3ac9, 0xf815c24f7dd6f2e6, 0x709093a366b66fd2
+, 0x92763c314a8ce81c, 0x06933dbfdfd406ac, 0x2c73271edd69e90b, 0x79ed47655d9af0ce, 0xa0ac584461482025, 0x097794a1208ad26c, 0xea5ee463b709478b, 0x7a8982ccda10866b, 0xa5fafd2412985135, 0x31561d458b8b1689, 0xc2011d6ae6003822, 0x1c7d1690deab89c5
+, 0xa333a7a48cca1cdd, 0x477bcc88c55f772e, 0xcc9297d90d28efd6, 0x160f5aba00a0c33c, 0x484d32b2573c4c6f, 0x178cc094449727a2, 0x45f7baf529dd97fa, 0x12cea2d95684dedf, 0x736d440ee8c0518e, 0x3ee63072c3e1b1f2, 0x4baa5bbea5e90c61, 0x7945a1c8d27531b0
+, 0x971876ccc0219462, 0x12e7ed252829ae6e, 0xd84a41c83c2bd76e, 0x67b728c9f02e436b, 0xb1cc6b6751c6e677, 0x0fae7303af921871, 0xd728eb4266e43c0a, 0x2484d8501a94231d, 0x9b47fb0cb510ff6a, 0x221c49274726ba92, 0x170c4c7f20e88c0f, 0x37c07014c9c50e74
+, 0xf3bff43e1697186e, 0x453c0406d9872f42, 0xd7d79c03191de8c5, 0x23cc6835bee61ba9, 0x38e2d72a1bc71db5, 0x7a7a46ed615147a9, 0xffe63c014d8476e1, 0x65cd11e77ef41adf, 0xdc777bd0e83b2985, 0x109fb7cb5ad34b56, 0x15aafa71e31ea44b, 0x647c661f53a772ae
+, 0xa6e76bcb2d807dc6, 0x3865d13bd11a70b7, 0x174f28c87331a5e1, 0x2fd6d5aa08d8a29e, 0x2d1a05fd4d1ce966, 0x646452eb9a0b60ba, 0x2ec6dad3fcddfde3, 0x04109d30bca77b88, 0x19802c75ffffee8b, 0x266f7740d73e4508, 0x25506c92db1df2b1, 0x44bbb49f5b3574c7
+, 0x4853cc56c43ed91d, 0x751e1bce0571cad5, 0xe2a8cff58a8f2907, 0x0dc47ad33b451b25, 0xc9339a0d1ee9a83d, 0x2d51a7588f5ca1b0, 0x110c4720b730353c, 0x032ccd428c55e8f4, 0x2e6d1c933a22982c, 0x1a4a6ce099ba3aed, 0x8012cfaaa78aa749, 0x13b3170d7cced026
+, 0x7d20dea285283fbb, 0x6e75ecfcf16228d6, 0xfe0d31f4335a3c14, 0x58878dca3e57f8ac, 0x08a39102266173ab, 0x75986372145b25f2, 0x84f77dae7b5c2aed, 0x119aa9f384d6e5e2, 0xd4c28955023f2859, 0x2df7c5b404179039, 0x0cdccbebd0b49979, 0x7c0bb967d4557308
+, 0x3830422b695c7054, 0x2ff3357c31bb911c, 0x878ea587b118229b, 0x58618092b3c13c1a, 0x4cd7a537fd66eb6e, 0x562b868f0ccf05ad, 0x06fc244abaefc69d, 0x0b7fc066113eadba, 0xf66ffb26934b883d, 0x0e77623c8593a6fa, 0x6bd2a36d4cd11f15, 0x41b4fb2ab00a007d
+, 0xb5f29689f405b9e7, 0x460ed746b9ddcd74, 0xf533b4b1062ecbe4, 0x71df05beba5611eb, 0x3af67b8778f76a78, 0x3cff6d6bae380909, 0x9c7752dfaf612080, 0x0f292bc4bcdd853e, 0x378f87ef0347b262, 0x1334359b89f7129d, 0x37398119fb5f5b5e, 0x107e37e0a3d10712
+, 0x760c3af6d47c0a07, 0x31563c768baa74e7, 0xc3d540d96367d9bf, 0x27716fc34be6b4e1, 0xcc75168d5c041f3e, 0x27208bc9d6339716, 0x880890b646c29368, 0x524a0ac137cabf34, 0x801c0a37bec39fc5, 0x4ee724588245a9b0, 0x3acbf696cfe599f3, 0x19983efa87d9df94
+, 0x300146f275606f83, 0x77f273a97cb2aaef, 0x062e0c093ca1fba9, 0x75d69cbfac882c8f, 0x01de66331816a8ac, 0x26ac8860622205ee, 0xaf0e832dc55d864c, 0x591ca42fdf9be3f2, 0x641e821759165af5, 0x6a251a33ea23b2c5, 0x97c40a63b2b6d063, 0x02325cc76cafa790
+, 0x824291df47b12698, 0x4524b2d3188da12d, 0x4721e7e709983db4, 0x082ba2f9f50a46d3, 0x8c29f3daefd72f63, 0x1b1a90d38b68247c, 0x6f7e3c578ab4aa20, 0x447d0a49206ee652, 0xbdf3d1ecca5b2add, 0x0ef4be5c972841f1, 0x8854fd7fea302e7d, 0x4dd603bbfc7f1cad
+, 0x419388d4509c5738, 0x7bf0fdbc6192c3fa, 0x60a7dd6844189ff2, 0x2fdbc49293d5c01b, 0x346ceb8ea6794ea5, 0x7ec5cb7da1590016, 0xd44f4668e32dfa48, 0x515664290c2517e7, 0xc68b211dc74e8e80, 0x44adb2130fe99ab0, 0xca88b0be9994f98c, 0x5ba73d7c2872edd1
+, 0xcfef177edd8f2286, 0x76d95b59ecfb60e2, 0xbd5e8e8bf0e7ed29, 0x57c0c9763cd1f952, 0xfbb1e40b4565b05f, 0x59a7cfef735ffcbb, 0x84acb1e817a43eeb, 0x7543fb91b206ca96, 0x4ee218f72e2ab906, 0x050a5a41f294e253, 0x9689fc0ef81b5caa, 0x52ac922f85be1ad7
+, 0xc7837a90bcf176da, 0x51d391c774a9c24f, 0xb5136989337d031c, 0x670fa64f8a1379c7, 0x0223a26757e58b02, 0x6261fc3a82eb7fd7, 0xd81095338f89fcb7, 0x1c4cd2f39867458e, 0xe45983f0031cd2b8, 0x77b31ee881f224ce, 0xf7c355d3c1691445, 0x476ad65929bf232e
+, 0x056c4f7a9db5c144, 0x1f4697f171a3b4de, 0x014c94e85303101a, 0x6bc9abb1b958640f, 0x17e02da9d37e9019, 0x1a846abdecd479a4, 0xdcea0947bd97ef71, 0x7a4ac6e296ebf346, 0x5a303d8f06047e3e, 0x2f6ba54019e7dd71, 0xe2217fa3c2ddfa95, 0x73a653144ca976dc
+, 0x8de6162c83b2a30b, 0x5cc694c56a1c5323, 0x3d620c19defeb3f2, 0x08e5f6d55c5504e5, 0x9cb6566c1c70d203, 0x043023c06dd14ae0, 0x395e22ed8fb4113f, 0x3dd4763515be314b, 0xc4e9ef9b17c9ba91, 0x66891ce3cbaa128f, 0x4d11e6037c25598b, 0x751e90bf952e7b67
+, 0xa5953c95ca829463, 0x082887f25a24a5bb, 0xdfe8dca724b4a48f, 0x6149ba745df6d1f6, 0x551cc6d561aa40a1, 0x7cee6f4b1048a9e8, 0x3d863f02fb0772df, 0x05a980905423930a, 0x5c74104cf4ea3aca, 0x17a670e74c527cdc, 0xb1ba48e11f2d3473, 0x206f76394bcae332
+, 0xd14513b705052b19, 0x6b3c018eeaa2ad85, 0x1d18dd2779f56b83, 0x4d6569b531edd660, 0xf3b1b3aa96cf13a4, 0x0aa36adc3097de3e, 0xe64edb42d5032f4d, 0x343a5fec149cd276, 0x28dae24729ccb252, 0x18993f96790c0d26, 0x16b7231676727d9f, 0x0a588e1f468428b5
+, 0x4acccdf846f0220a, 0x22bb747e353e7dfa, 0xa85a48c07969c5cf, 0x5b8b6ccbe60d6c86, 0x876bff38e12db9a7, 0x42234827ec7c4ca6, 0xc16e569fbd56ed74, 0x275650079f579430, 0x32489ff3eb418648, 0x06fd95ed1cd3c8ed, 0x232d0dabcf1038e5, 0x59f204c87f05f866
+, 0xfc943ce9fe0d037c, 0x2dd101a652b51926, 0x4e169f4251392945, 0x053622bb79d47613, 0x9416fe50f4d25a91, 0x6b931a02e80b1a9e, 0x3c3e827d11eb97a0, 0x79f3239fdf14a7ad, 0x7b14a4e268d406a3, 0x216e2e3dbd41a052, 0xed6a75910e1c2121, 0x7644a1fbb3003ad4
+, 0xd3c20766eafe2c80, 0x7f48b7b191254286, 0x7edc5ab7b3fe7bc8, 0x67ebad3486ade9ee, 0x8ca2617e63f0940e, 0x012077a353262d0e, 0xbfb5be73b61d738a, 0x0a3b1c1e2b05b7d4, 0x4c3f6866c3c56488, 0x70255af53a669824, 0xbb5e2e1ba417b68b, 0x48f62b22c359d372
+, 0xced256ca32b29268, 0x12872541c4fef1af, 0xc744c117db341870, 0x6a73507e2fb47777, 0x74bb7ccc90826b6a, 0x46d921b90fc43f82, 0x126482165de532f1, 0x336797c811337d96, 0x9434c1ed798656fb, 0x1fe46a9b3f7f13f0, 0xac0926422d22958b, 0x36c89461775c69fe
+, 0x8a6e46355391aff2, 0x080fd166ab31ab0d, 0x015b8e2b9eee99bf, 0x6e058b89e66bb932, 0xb51ca90187346a66, 0x39150ef63dfac9f8, 0x0b3f6d83b33fbb73, 0x337fa0fc30b81ca7, 0x528006298522fb66, 0x0f048a9d378ded11, 0x208596327b45ea59, 0x3db84dbdf9688427
+, 0xbcd1c518166b61a4, 0x676b3b891df9e9d7, 0x480ded5d5699e0ee, 0x085e5fa9b4687531, 0xd9c0b6cee2cf267a, 0x7dfb16261309f93a, 0x3e78352c81bf5a26, 0x2199262d5bb1a031, 0x288a0e1bbc41080a, 0x0f6326e8e080b8b4, 0x583632bdb3d4d27c, 0x1a7222a9d505127f
+, 0x439753060c3eab0c, 0x4e7ef606667a4c77, 0xa39f02822f1c139b, 0x527ac35fc0d13c37, 0xf2ab43d6d089b12c, 0x6d39a31d739ae68b, 0xdeb3457d350e40e8, 0x77bd1a06c4bfb176, 0xf2fbd9ce1c080faa, 0x704978a741ecada1, 0x5b5c0b975d01b783, 0x113ef881a429e912
+, 0x3b50fd8b8177d376, 0x775b224fc9fb917c, 0x1248fabdc3cbda86, 0x11f3d7b79ddb87a2, 0xec1d80d64cb5e730, 0x698005e1ee53f1aa, 0x99cf1a1e67543cc0, 0x0a768219b87275bd, 0x14fd43085bd8aa2f, 0x468eb71ffbd578fd, 0xb36f4ebf42932fe6, 0x1c694a1213d3578b
+, 0x55b32bcdd00f8e4d, 0x4aeb5107fca2a006, 0x079de243868de7cd, 0x3322268908f85746, 0x7e38e39a137d6d2b, 0x141dc1267ba04039, 0x64038686972e048c, 0x0fa640cace1f53b2, 0x432729faf4a19e15, 0x1a4aed69886e112e, 0xb51ed0b3e8c706f7, 0x391c8ded179597cf
+, 0x30ef4a801444be2c, 0x29b96b548ccbd7bd, 0xba744bdc2ad8ee4e, 0x2344affc79c151c5, 0x3f519d536cc799a2, 0x63e8f81af9c3a939, 0x1cf244bb7045f3f0, 0x78e8483150658638, 0xc003b9840205e282, 0x2112904238d8e68f, 0x9e96fb0771dc51ac, 0x10b455eccdd3ed97
+, 0x388f67db677f9161, 0x5e01a6d385faf640, 0xa7a338e0890d45bd, 0x1e263d3f0c8af0bf, 0x75f0ea8311dd4c79, 0x000eead736ae54da, 0x9d8bdfc5e930e048, 0x4959b1facce76546, 0xe9b96c67cd44040d, 0x5301cda9878c64c6, 0x48088713b172e49b, 0x0edd5d4d32576449
+, 0xb3a667d52e060936, 0x168e0490d6e958e2, 0x4f10df51c26f5618, 0x781a6d59177ce40d, 0xc0c4ba16a021c4ba, 0x3e7e477aa72ba4b8, 0xa80db2f350349232, 0x151d372e54fef638, 0xa133a20a6a98f9f5, 0x4cc4d938ef41e2fe, 0x5aeb56f79a455436, 0x0ae53a0877fb80e8
+, 0xda394dfa16e57e32, 0x0c4617a97c6bf633, 0x487c627569955fcf, 0x5d7f135d1e34f1bd, 0xc67ab88a1ae9e28f, 0x000cc3027b0b8d7e, 0x4e3e2fc036690ee2, 0x1fe5710d04c72560, 0x1b9cf47298dbd0b4, 0x1daa6d18b52a0f63, 0xb6502017ab3b85b5, 0x0449c7f80e5a1433
+, 0x3569b83fc8f07923, 0x0028bf1bd7f62559, 0x5976df2a36fd636b, 0x2fb040c3e8e5d643, 0xa7d1ad47486b8300, 0x182a9f5cc41b8368, 0x853bb978f55bf4cc, 0x021a4aa854b70db1, 0xb78938899073d3c7, 0x7ed1c4fc9c0c2a81, 0x6636b833089185f4, 0x2fc6094cb41772f8
+, 0x0f8b86513dc98344, 0x27f402484b537aa7, 0x5bcf677662726dcd, 0x57295044906669f7, 0xa4c8dd7a70302120, 0x41a2722de41f5179, 0x1587f40ab35e641c, 0x0bb68233242c0ff9, 0x0f89dc188e73d5dc, 0x67be56c3bebfe8c8, 0xb9b650d913815b46, 0x777cfe2bcf8d6f80
+, 0x38ce63eb41fe5e56, 0x1102bd1e09afa851, 0x6dceef032063c07e, 0x79879ccf2b8b4f08, 0x11ec521181f1a3d3, 0x1423f0355f25bf4f, 0x62317a58b615d214, 0x670bbca0443e67af, 0xcce18cc809e396d9, 0x5aa16bb3e1466ab1, 0x1ff8656f2e8f543f, 0x3b7e68412ea933db
+, 0xc0828cf6680ff78a, 0x2222023cd95c8d41, 0xd01e284f7becc074, 0x1a7f43ed44b66abf, 0x21c38b4ebfcdb55e, 0x5414a87ffaea75d1, 0x57c23b703f656bb4, 0x33e2a86811648e40, 0x975a4d0a5b739914, 0x2c64469be4ca4398, 0xa6506ca0aa0e6b23, 0x6b1ea6d7919b8fec
+, 0xba245e9919b8f950, 0x7a4b436930493e40, 0xab9b917a6469a2df, 0x370e51bd1bae22d3, 0x4a68a7195f4a56d0, 0x70b74ad68963d15e, 0xfeac8625dea73c64, 0x110d78238b562ac9, 0x9cdb109279210ab4, 0x0b596b5dd0bf7835, 0x9584f4eaff8037f1, 0x06beb141c7d7e7c3
+, 0x729b32ec07cbaf52, 0x0ba701fb193197a6, 0xeaacab7235eba8db, 0x377022507f8c1a50, 0x9f2b3c877ac617bf, 0x161cbe52c2af932e, 0x966e37401b5a0287, 0x62e72190163cbd93, 0x9a1d90c50db4d4e6, 0x09b9551ff82815ac, 0x945d69f59fd8d046, 0x5be820462e32169b
+, 0xaed2beb9de3540ff, 0x053aaffd6ddf78b0, 0xe9b7fb21994efb90, 0x0710c448640a7e9d, 0x8e5bac613865f10a, 0x2f3ba61324208223, 0xd5b5f139a3bf0598, 0x68a8c627b68aeb35, 0x39a9502680832105, 0x1986145c23359aa2, 0x1cf9fa5346f7872b, 0x3b0ae7e2e2ec4141
+, 0x4240ef0296650aa5, 0x3c5e3d262d686478, 0xb5aff20f2fe71328, 0x4a5a46d141e291da, 0xdd80fe259e94304f, 0x0abcb66e49480cb7, 0x2f798d1f27012b07, 0x23556067e9d6747e, 0x401904bf9a79a0b0, 0x4b3a1e2ce8797581, 0x1a822fe752a2dd53, 0x5aed0f684e813ea7
+, 0xccb169501b8bd4da, 0x2358a1e9b1293c7f, 0x17c37bad855246d2, 0x143ade9ea251688f, 0x89042d38623e88ed, 0x455f5b82129d715d, 0x3b7f0a4be193a70c, 0x235877e0a5b258b0, 0x4fd299c782b3b760, 0x654c406da5db6973, 0x9cda8f3641a854ad, 0x753225ab513cf677
+, 0x8b0072f8571d885b, 0x2a7104a777af13eb, 0xca63fd8dfe05a653, 0x56ad2ac84d3eb846, 0xd2302012ab034c07, 0x176be8bca47df325, 0x9434cd33a439a8bd, 0x6d17a3b053705090, 0x21286c42c4b92107, 0x51e315c80762ee17, 0xb5b57f11472bbb8d, 0x1d0c052c1181f6c4
+, 0x32c45ce650056bb5, 0x3acc942122c44fb1, 0xb4187b605f5898f4, 0x486027c86a317209, 0x1ff62f2e2939006d, 0x5b94df5faa880f26, 0x1d3330c255c4d80d, 0x7316abaaf15326be, 0x57c811ccb5e7cbfe, 0x70cc3d74d13fd994, 0x38dbf193a389ba54, 0x3038220d350bf63f
+, 0x53cdc9045939dc82, 0x640396d24c2fb201, 0x0e3ad58a5c2e1232, 0x5f8a1da3c29f4baa, 0x3de3aeaef864afb2, 0x7317745885cecff9, 0xe7839a5786d54549, 0x1ca0c0d15a570d7c, 0x16aea56ab1b78d01, 0x3c24424c7fd0f07b, 0xc4bebee09c1a9774, 0x49e83144b7eec820
+, 0x7ec0cf4fa2ad9f54, 0x00dc3f1f8a82bc6b, 0x88cff1f8625e3f61, 0x021e510e1c54b230, 0x4207cad4c51b52d1, 0x7f30f3d419847ad0, 0xfc894d666f4b54fe, 0x4e49f188d4bbbbe2, 0x0abc262678303d17, 0x5a33c787d80e0590, 0xc6a960a013bb225b, 0x44b186e2c548e286
+, 0xf98922e3682d1516, 0x749aa87652c26890, 0x996f3304bd488e28, 0x6b6216aa3401d8a4, 0xd729976409641d02, 0x71860fa5009b4a23, 0xfc5cf0e8e6979b02, 0x139801b3d3dff7e8, 0x2790821e6a610205, 0x65324a31a3a54dca, 0x6d208f3d42091dd0, 0x631f578251009724
+, 0xa75c0d74fe0068a9, 0x1f253ad78b6729ad, 0xb6f92ae8f5a0b02e, 0x3c7789c8db4e35d1, 0x35a48996a13eaab9, 0x11b1c4c8dbdb7550, 0x5f531735beca4e85, 0x7494b69bd91413e7, 0xa8a89efd019a8e52, 0x21373c9809433425, 0xdd58d84e1a000fa4, 0x28e90802af87c70e
+, 0xcc33d8da6226d268, 0x79fae36baddcf6bf, 0xfd9d6936b4b22e2c, 0x726321b784773e0e, 0x81c42e96b4a800c0, 0x3273f9f015d187d9, 0xff4e0a4b5f88fcfc, 0x6dc03abdbb82f6df, 0xa48a473b5aa84cb2, 0x10f929dccd8247db, 0x8d4b47183108d1e7, 0x52de4aa345f2e803
+, 0xa938bd799041d162, 0x0028a384727b5823, 0xdfd2604a40d2e9ce, 0x26ca21d4014c191b, 0xe00b54bd3d745924, 0x3ff1d4bbfa3c43c0, 0x502ecb3ee4a0a1fd, 0x23761f527b31505c, 0xeabfac095a4e5033, 0x66eca4ff27d763b6, 0xe41aaeea326a6529, 0x23ff23dc6b877be1
+, 0xd0e87cf0e2456ff9, 0x54de31f498555f1c, 0x1dc9a6ec13572b87, 0x7210b237b34c3089, 0x095a4c94cd7f3e6e, 0x328439c55ea6c0d1, 0xaf72576a7f1bc784, 0x6cf16261c34e8167, 0x3b3abb44f80e54e9, 0x2cc95592709de894, 0x569d82c36eac574e, 0x6b7ae8324c7d63f1
+, 0x358787d937a12b88, 0x795ed584934ba76f, 0x99bd8392dac1ef3e, 0x495855963b4d6ccd, 0xe7f299f354bdd8cb, 0x531bd147528f2f69, 0xf54568cc343267d3, 0x2b1a79043604e476, 0xcfcf73cdf63baf61, 0x6d6f79e82c5d072c, 0xe73d979e272be2a2, 0x56f304242de75023
+, 0xf1cfcc74708e2c30, 0x5df33c8a657204e6, 0x156635993dc39750, 0x63b725dce0c41899, 0xae791fc29e56516a, 0x2b9e406fa7b5f195, 0xcfca1936cc2531d3, 0x66112f3b1dcb23ff, 0x728a1c2b2a60c78d, 0x08152ba93aa33392, 0xe67c162d5fe2256d, 0x7b6610789a13d526
+, 0xb5e86a4952b4708e, 0x70037e177e93a354, 0x197cf4e26511d727, 0x58fefe50f991e767, 0x629fb820cb15680a, 0x7d89a6d38e880b5d, 0x4ff003d44954f226, 0x2222e62ee6335d91, 0x59f3e06df822923f, 0x49c4b90a9696249a, 0x9d5e26314b2f6471, 0x4d720f9a26abf986
+, 0x7af7fd2131cf5a1c, 0x13a45da26de98186, 0x89228cbb914aad03, 0x5a79945042da7861, 0xc96e78ef87243a5c, 0x4f7738a12b61e49c, 0x33fa0db6d453b5a4, 0x7583013857f06ace, 0x31800cb665655eb0, 0x6053126c006d0556, 0x06d979fb74927fec, 0x107e2488c4f51f1e
+, 0xbde0f470a24484d2, 0x55f11eceff60fcef, 0x631ff2cc33818bb9, 0x4c09d69febead7cf, 0xa1e90e13f06eb15a, 0x5cb23a2bc20cb588, 0xc1b0a6fbb14c908e, 0x06a76fd288403c01, 0x510d0b592350fe50, 0x0ce34e9be66bbb08, 0x691f196ca76cc10b, 0x7cbd5c7eda955ce3
+, 0x83cd847d377f551f, 0x1b095c13a534b82c, 0xb6d615a26b1a13db, 0x419a25a45672f76e, 0x5d9bc5dec861b413, 0x1c4f599483de8194, 0x728d936016a58a08, 0x292f26b156160b9c, 0x1c51f3a72263bfbe, 0x7c6baa942221f92b, 0xa8cf31e8c4e8ea95, 0x24b55710ef4ff2ef
+, 0x81d98f829168c3dc, 0x1c2bf230b67ed987, 0x74a1a40ffe0eb89f, 0x7a6c158e96a63fb0, 0x44d3204b1c2fb86d, 0x7a7baf3e2ed5c518, 0x28ed1a753fb12e10, 0x5ea42ac8ef83f2e6, 0x3e062305a39172fa, 0x2737149e1e08c7b1, 0xb4d5cca3524e9e08, 0x5f7d3789d0dfd456
+, 0x93f2d1bdc067f687, 0x26258ba9dc79bcf0, 0x8a9ad86493d9b49d, 0x279dbddb6f0b9d6a, 0xb736126030bb2121, 0x21e9d4c4885557cc, 0xbb393714e8255946, 0x34aa62e346baadba, 0xa15581cb0f8039ed, 0x0688c7e81b3c2bc8, 0xaab7fa87489b15a9, 0x63b6d5ec303c1e39
+, 0x5f537a780df9ba28, 0x7cb7f0744023b590, 0xe00d12f893a73e9e, 0x11f40b539e4d5b8f, 0xd7d01f1fcf03138a, 0x6c6101b51af243d3, 0xe2c6b24325367035, 0x01a80c3b201951f1, 0x32633986b95329c2, 0x0e7904da498c5428, 0xe61618f2aabee69f, 0x45f03177697292b0
+, 0xd192a036ded122a6, 0x3cc3aadb19138720, 0xddbcccc388ccb763, 0x2e9389745d1f968a, 0xf6488dd2928a05ca, 0x7becca5adb3f5a49, 0x59b72b506795604b, 0x518f7161f97adf08, 0xfe91139c24f7172a, 0x2bb805b736d4850b, 0xf5f36d0794b46cdd, 0x708d226c1096c13d
+, 0x6d7e1de86ec2d338, 0x79ecb5c914dc8187, 0x164433f03a85e679, 0x10cbe8254db46b8e, 0xbba2ad91aeba0790, 0x7b84f4b4b876403e, 0x6a67b0b7849e3980, 0x10ebe30cc0a059bd, 0x4e7af5e2e5013cbc, 0x1deb31a0453cdf21, 0xe43f8183a4f53c00, 0x468dcfd773fae81c
+, 0xb7d3fa6d1814cbdc, 0x57c6297149e0cadd, 0x7d0e5e6d3000bcfd, 0x29d8d820206390f4, 0x3a7285931fd3c3e7, 0x5d26629351b1c18b, 0xa30ed94bfeb5c9f3, 0x7544c4f14aba8e98, 0x8d2a908122d14f9c, 0x6518772bdd277e5f, 0xcaa898f2b8bc335b, 0x218c6c0ea12d1541
+, 0xcf26ecdc24d263cf, 0x3f93d48431c82a9f, 0xf313b580915f0094, 0x06157929f26b77d0, 0x3412762559e9d991, 0x4d18e15f3f1dc3b3, 0xf3eab6319058efb0, 0x469e125feead691b, 0xc74975bfe1fef590, 0x79b5cdb1de8cc0d9, 0x5a2836b6d32c521e, 0x3dcdad36fec4fd5e
+, 0xb8aa61e872cb9eab, 0x495bce220ff744cb, 0xf4d1c5097a4bf37d, 0x37bf147830833dd5, 0x45269790d30700f2, 0x1714df74b37a2d9a, 0xcb99df946120e57a, 0x6090d83c5ceac41d, 0x35650ac334274aa2, 0x69ce3c082003346b, 0x4e21d9f341c37550, 0x37ec39fd2b1c3d3c
+, 0x8061e3782b179ba9, 0x4765b8ac41511bcb, 0x45a107dc9b5dcbdd, 0x3b6bcbbe64da5c4f, 0x01cec138a8ab9a4e, 0x64a00cc90fcf96ee, 0xa9ace4137846fd19, 0x0f96a34570d11164, 0x5af5ff33b6b951d0, 0x4a2d60c5b831e47b, 0xa6900929b2f44254, 0x3ebc59af6ca0298e
+, 0xcf5df0a4e115095f, 0x3e7f10340fa2fc71, 0x0822f16c374333c8, 0x0f1121bc086d65f9, 0xedbad8bddc39627c, 0x46bf1257de447e14, 0xc63102592f84ca21, 0x6de51b3bb6738bce, 0xc61f539a92119d09, 0x1fa0cd5f265d5725, 0x0850e621a0e1b2de, 0x7fe0b770c40da781
+, 0x7305e62aff800882, 0x6063c7a8e2024efc, 0x83a17a0ab7c33b5f, 0x4b2dee50a5dfe66f, 0x9770dc16c86dc8a6, 0x2d6ed19b71fd6dff, 0x3820a76e5907faf4, 0x2f131250e89ebe08, 0xbfbc95f9bdbc983d, 0x660439df97803834, 0x44664713cae4c386, 0x39d236b34672af95
+, 0xe29872ee0061a2d3, 0x1160facdf45f886b, 0x8c3dd9307a8bdc72, 0x67dfa850f9827347, 0xf421240ff229ed21, 0x011046be1c168706, 0x0fe257711195726c, 0x3adf96065e8ac1ac, 0x807513c4e0c77ecb, 0x09fd88f52e36e075, 0x459053de024231b0, 0x7204f3a47cc0dd4a
+, 0xca8e8eabf2525f86, 0x74bc9a58fc6c628d, 0x5a17334108281e08, 0x7a8246e98267ee42, 0x1940a3ca043e13c6, 0x5f2d3aeb7f7a09f3, 0x697483c1a94a6f76, 0x3005019b5a81c128, 0x9c1d0f3ab804d1f5, 0x064d6d016ca756e5, 0x22553bdf3bdc5769, 0x7b54501949df0039
+, 0x3a2415507badb550, 0x2e16ae824c43e57f, 0x3b93606ba1dd440d, 0x69770f14c64f2bd6, 0x5bb44c5657d342b8, 0x60e0680d3ae34f5f, 0x2d2728e95285180b, 0x38ec62d1b9f58a6c, 0x29ac6bbfc643f05e, 0x1fc47f5e6315d385, 0x863e2a4e17c75c4f, 0x79e3996899957d5e
+, 0xfedf50e3854ec7c8, 0x223ef17e30966c46, 0xca2b300f80576aa9, 0x547da9965bd1e085, 0x72eed8901394259a, 0x7405bdeb864df14a, 0xb71a1ce8d00adf0e, 0x335d7e91511eeb56, 0x2ad3328bfc4aa069, 0x6ba74abb440d5f6b, 0xa6f06cd92fb29174, 0x615e10c94f191b1a
+, 0xd4c95ae7cc58b91e, 0x0fc21884cf125e21, 0x45c3f505d8804661, 0x69e80ecc3079c5cf, 0xe8997df492c3f186, 0x4bef41bfeafbf3bb, 0x3c4beea487617d71, 0x6beb5f8eba40bade, 0xa25300ec08b7cf56, 0x6d53f4b9acce8751, 0x13790d1dbc8aae28, 0x36a70c3cde8fe28d
+, 0x5a44c7bfa3b8a071, 0x62adeb02abcad457, 0xf3ed6abde355c341, 0x588e9df031b7395f, 0x2270593aa128081f, 0x770df7c785037aa5, 0x5f6cd77833d91dab, 0x0ab38614edbead92, 0x19a92d4703be801a, 0x3ce6bf98eb375162, 0x01b0e2ab3fcdac00, 0x2667b071c48a8af3
+, 0xbf295b158fefd082, 0x7d1325f8f582d99a, 0xdb0459ba21b3ca8c, 0x37499cd97acfe3eb, 0xe64b153fb2df8fef, 0x62c90362a9b6c97a, 0x7688e1f35be82664, 0x67065a5ac7b5c170, 0x5901e50c56fcab45, 0x4a4dace5a2b206bd, 0xdd3d6d636c4e7c80, 0x39300c767f4cc71c
+, 0x36113af79108bb9e, 0x50a0f4c95f20ec2b, 0x3698c07a9cd60a7e, 0x78c12945220e6e6d, 0x2cb4daa940939dc1, 0x4497e6a4ff84f022, 0x26da9f78290e9d1c, 0x01a7e92fcf9d22cc, 0xbe3484bef77f8863, 0x54cd7c9224cbdffa, 0x0060fcb24583dfd3, 0x286b7c9bbe429e4c
+, 0x00ef4f6a257c26b0, 0x7b139d8a5779d012, 0x7d7725a262824d9f, 0x7c61bd01ac5a1459, 0x8f47ea0edf787589, 0x1ece4a8d2f88c98a, 0x20346d6b9a1720a1, 0x5d57da43d14077e8, 0x72470e3db1e4b41a, 0x1382ecef60ec4d42, 0x8f9fba865aae5e3b, 0x7adf19a2c323dbdb
+, 0x5b1b56494ab9f573, 0x207982049afb14b4, 0x453d177536c4d005, 0x05b3723ac7b903b7, 0x6ddff2e1b60c6db6, 0x072c0c211c6d6a1a, 0x840e0c9d2c64b8c9, 0x73b106015963bd58, 0x061fa1bda921cfb3, 0x76e9df0b47355965, 0x146ba038551ea9b2, 0x0b744599c58d32bc
+, 0x464e0b0351076add, 0x78db6b1f8b259009, 0xd4a165a276042e09, 0x21135afc9a67f2b3, 0xe0c732a0390f8784, 0x515656522e4fe58f, 0x38693e7cfac6e020, 0x5acf157a75710c5a, 0x380d270ce4b72360, 0x3ca8938f2c97109c, 0xd66e0620a879376b, 0x264b513fd9bf5f33
+, 0xa5bf6053fa545bc2, 0x0a49fdebc1520100, 0x9b7804d23193656a, 0x0033d5d95a58f869, 0x86b2c019665c7a10, 0x52d6147cdd5c511f, 0xa32ea29087f43271, 0x7b975791bb7246c0, 0xe88a2e9ff12905ed, 0x793c2c1fccb89079, 0x2a7499dfc7382730, 0x57e9e797107aba47
+, 0x9edf2597f8e47119, 0x32dca4c35feb053f, 0x446f6ad7dca2447c, 0x47609917aa62c71a, 0x69e34c7b3e020fbb, 0x714a39d018428de9, 0x6486dff271478a4a, 0x56136ca7bf832f39, 0x5a96e7ad78d01bf5, 0x4b844d4c4167fc8b, 0x1424667d3902db42, 0x10be01c77a8e5c7d
+, 0xa55708f4d588fcfe, 0x1059031f45323aa9, 0x3a90aa85805bcc2d, 0x3475a122df8fc120, 0xab18e0d4c6954d4a, 0x5bcfa246e9390105, 0xe062c30f9c74cc03, 0x7a7301999845689f, 0xa1cb2c278fc8ce83, 0x1edad6034faaeb77, 0xd296166c972d6243, 0x381dfe6be88c2050
+, 0xc9af3120e04bb8b8, 0x7e4c07c873d8be06, 0xa814d2ef28b67acd, 0x184b1804aa9818c4, 0x907e85555d4993ac, 0x1a259b4279b003d1, 0x343d918482897ec1, 0x0fa333653e291006, 0x5748f436c9d7772c, 0x18c861cd8463f810, 0xc901cc9156a03b36, 0x5b49904cb0715447
+, 0xd671425ea28b36aa, 0x2fc65036dc72ccbe, 0xfa66069c233d37d4, 0x4bb866a4cfe352d0, 0x53aa66448d11b589, 0x398c531577a08631, 0x8057ad1009b5184c, 0x00646458518ae6eb, 0x4aaf269e9bcf804e, 0x417d839c49ba8980, 0x47f25d366f538ec2, 0x59a871ea49d2fed3
+, 0x61cc254595764de8, 0x278e138fb3af3ec9, 0x105ed4806147485b, 0x0dfad7f3277a6048, 0xa2cff9c2fbe2530e, 0x2647dce2669d94c9, 0x9fabeb4b293d7986, 0x28f2440f63f4831d, 0x9164a2e739ac5588, 0x3b2ac7009737e8e6, 0x805722b5d63fba2d, 0x229379bafb87791b
+, 0x935c4bdeab029338, 0x53458dcc6d8556f2, 0x1c069191a2375325, 0x40605a29ef0806bc, 0x03f0fe573ecb1725, 0x16fad38a33e62c4b, 0xa6fb263774680170, 0x004b4ff05bc18847, 0x1f02e0ef4e0c2099, 0x4fcebe3b42eaf367, 0xbc887634e8154fe8, 0x7b2f9223c96d77fc
+, 0x7dfb0a28bec9da1e, 0x1df293d4d822ace3, 0xb12a23f166e12005, 0x1d1a125a58dba540, 0xf83952cda065247c, 0x7b77c9ea19a768e4, 0x88558379c5bed6e7, 0x1670f210428fd74a, 0xe458b451a02bff78, 0x6f10caae5e0040be, 0x5546bc7e5e9784f6, 0x2588509826568240
+, 0x9c97d825a717e08a, 0x5f8001e69cce6339, 0xe79daa59b938cd3d, 0x5cc592e6fcd657d4, 0xf0a3ee106b0d6cea, 0x4c696dbd16140975, 0x441538dd5aa1a3ce, 0x64294aaa7ecfd8e0, 0x0984262b51af240a, 0x30acc3237d13648f, 0x6552b3546449ca56, 0x79333573a2556133
+, 0x8384e9ac202ac68c, 0x290bfe69f5c12c44, 0x4a28088681006e3f, 0x2a772f99a91a2384, 0x0fff7b19608ca07d, 0x3105bf2ce30c9784, 0xbcd290c077213bc9, 0x43ced496926d35a4, 0xc0e293fa07775f22, 0x6a305a515a66cd08, 0x4097b13f7e3d8902, 0x7eb88a3669a84ee9
+, 0x0b2e50f1024be02a, 0x70a83ba12ef02cd2, 0x537ce7494660903c, 0x72c7d2bd80894a80, 0xb7a3b77bf89f8048, 0x15a0ffc0b8ca02e8, 0xbebd1bbed870d90a, 0x71142ce7d3321327, 0x979c232891aa1a2f, 0x5670e1aaefde8111, 0x9d956ee3a1a59d17, 0x6d765eb76a13357a
+, 0xe067045be99e3619, 0x5ce22fedaedb5950, 0x5f46280bdbe5a95d, 0x1621cc973c6d7f10, 0x76d20b14500b4eeb, 0x28596b46fbd62e7f, 0xc7b10d81d3b58bf0, 0x73d75344e933fded, 0xb06a15627dd26f04, 0x4ff052b2c3cbdb92, 0x791f058b72683889, 0x2753ad0691bd58d4
+, 0xf052a7faed3b3919, 0x52df7af254d0befc, 0x8bebd92a34cfeb87, 0x11a2de5863101e3e, 0x3faab944d2549dac, 0x402cd59d45630dd5, 0x80672a4794345392, 0x6f3c238b15cb5beb, 0x10c0843e8f519c5e, 0x5fbff1d95951ac5e, 0xf6dd02afb20d160d, 0x5637cec169e0e0b4
+, 0x0e852f87f8fb4f53, 0x285b63233ed0ef3e, 0xc8423e1b87424703, 0x67db6be9304fac60, 0x53f2aae9516c1883, 0x2e8e8f3189c9375c, 0x102a89db9ac0e702, 0x1f98fd4d31502458, 0x2d6278033345cf1d, 0x712e6410b6ade0b7, 0x6fc22ddc03062dfa, 0x2111fe4b6081f907
+, 0x6cbcc0b5f97c1f04, 0x2cb06bd9d44f0228, 0x219b9adba2be2edb, 0x47542713ce2fa102, 0x4c1130701837386f, 0x40c75d2dac842c9f, 0xfc50d7d5ed1a10e7, 0x777d818d77f8c7fc, 0x11b395213fc93ea9, 0x0223c848a4797de2, 0x8d44a6e3e008d034, 0x1c8d24dfe4f9494f
+, 0xe01d65b9a2f99959, 0x55dc530494a9c88a, 0xe6851303eec9b06e, 0x01d8805f2287937e, 0x0c64fff898ea723f, 0x2521a8f0adb52e13, 0x877df43ff6503cde, 0x32c2e375a01567d9, 0x039565b62f6887d2, 0x31435b9cc7b51b2c, 0x55a9b1ba4bfb6afc, 0x7ee8299c03757603
+, 0xfc4fc882a42485b9, 0x4a11f3d7d47d212e, 0x5c6b443c0b387634, 0x15da676f4b49b768, 0x2240dc9d0bc1afd2, 0x444bc600f5bc5d3b, 0xa59858205e0eb4f7, 0x7dc3b31f31c7e7f3, 0x45b60f3e6ceee23e, 0x07b7803baaf09776, 0xefdfc379d95490a1, 0x50deeec57bdb1131
+, 0x39a9d390473294a6, 0x28ea5b18e2fa5637, 0xb6680217c84330b2, 0x5f16909e95ec8347, 0x7eaf2793de92d61c, 0x03f716a8865c1957, 0x2bd4a20ccfb733cc, 0x21f9f64feb879c73, 0x82592e99ff2a5cf1, 0x0a83a1bae12acc19, 0xd6e27e44b0511834, 0x697ed64c10a2e8fb
+, 0x1db8239cf1cfdf6c, 0x7e975772e462e615, 0x1b30113f78d6c074, 0x057d28eeac46b4b3, 0xcfc42dc63ec3f584, 0x40a7372c2c05b3a8, 0x2e744c5e585db0b9, 0x7d173243f116815a, 0x9b5c6d9af10b7213, 0x30cdb9964c281abe, 0x8cad13a00ad2b640, 0x2d04c1acd9a269fa
+, 0x722e4f9ecc445483, 0x5cc8c2f3f0c1708c, 0xca75c37d696abc10, 0x0484f7f05d433d2e, 0x6e7ea8df18b3ba69, 0x10a0fd7fba493c81, 0x360c19787a4da198, 0x2fad3bd060e629d7, 0x271bb0f87bc9bc2f, 0x7762b6a82050951c, 0x53e97a5b342c8a5a, 0x72a1a4f50017f7c6
+, 0x6c8a7f1cccc3c153, 0x6b5629a503973bc3, 0x90fbad7eb089e0ff, 0x56101a0e4136351b, 0xe9abf75a33ca084a, 0x159f971cc58d4b85, 0xf6681bff74d7a60f, 0x4afe430d0b68d9c9, 0x68c3bf9f1832a600, 0x5bb0e9cce3062db5, 0x70044d1a14d63061, 0x0287c0d84f88e55c
+, 0x8c589f3e9c92fbdc, 0x4a0aba5a67aa58c2, 0x42e53eabc92ccad2, 0x5ce94efe29a50768, 0x1c6e346c1865b005, 0x060521f98a1adeb5, 0x881e1de89847278d, 0x6da1efc52c7b1fe4, 0xe1f4db6f05efc1e8, 0x123a3671f93d7254, 0x48ebff1276b37108, 0x1f0a0f6f06aad57f
+, 0xcbaf760a3368aa10, 0x699215d8be4e6904, 0xd66780f30cf0d938, 0x0f1c36bc10d1e7c0, 0xfd55d9555b1b8df4, 0x05b8c7b390eb716c, 0x652a3b1e45f42775, 0x23e365157a506a64, 0xbda58442d89e8645, 0x3c349680df0b08b5, 0xcbe64d5079020e1d, 0x5e1718218c7a97bd
+, 0xc5a932ef96af8dcc, 0x3293acc8068b0f76, 0x47120d48f73ffe22, 0x50e55e570b6e0b00, 0x2a7a1eb1e841f70d, 0x482caf628e332543, 0x8cf2dad9bf01e062, 0x74d8721971c66c99, 0x555ac707f9f651de, 0x232bf2027de02642, 0x07744eb8dffb6ba9, 0x2afa223ef6ae37c1
+, 0x63e657a9eef74d69, 0x7138ff69b58097a3, 0xdbd806a9e7206a8a, 0x6d5fa21c5e9db95a, 0x41d9c91d9802e277, 0x7c58d56965e1aef1, 0xdd361b8fb7464950, 0x0de0cea36a316c90, 0x4c41f738ecff016c, 0x49daf1f28dd65d5d, 0xe4739ad12f027111, 0x08e15e6d7423981f
+, 0x036951da6358736a, 0x303498699f13d2f7, 0x0bbab9121ae1ea17, 0x35be4f991887b2cd, 0xd46b21dd5ca5f53f, 0x63b71afc6ca1a711, 0x40355d2e379a8be1, 0x603f753334961123, 0x6bd100ef373eed4a, 0x3881c30211417d14, 0x89106e6a6ab8c23f, 0x1b49e8a80a93eb38
+, 0x14bb404afda1e0a5, 0x1e94788a20cdfbbc, 0x91294d265b69d92f, 0x1024e846e140af16, 0x9c56d54df50abb36, 0x4ab63a557244fd19, 0x648788f26c8f5d05, 0x0a215eca8f3b69ae, 0xfb159fa4cc04e870, 0x5e83871fe7ed1bb6, 0x318391955fa243dd, 0x1c52e495960162c0
+, 0xe2080210789155ca, 0x172f5b3a74014130, 0x72c9ffcf44b4d838, 0x131a431e1f72331e, 0xc80f9e4249ce8444, 0x2ee9611e6f8d89ad, 0xda1eee7143025579, 0x3181de9bcfda64cc, 0x1216c73acc02d51e, 0x35280eec8a9e0115, 0xf67938248dc8c105, 0x7128bb887634afe6
+, 0x25fdf94ef572f6fa, 0x0e68c1a0f3aab78d, 0xdca485508092c125, 0x10313191aaf0c2cf, 0x6daeb0a7b696b0f3, 0x5b7f7eb25cc1c5bc, 0x6419ae84f994f75b, 0x1bfa17e31bdcd3ac, 0xa5788d2be53ee8c9, 0x392e811cc2460bc8, 0x73df42b51194492a, 0x0c0d66ec693ffe32
+, 0x054ac843c31773df, 0x6b2c5f6cbd0c46f0, 0xec00c0e380cde50b, 0x0b7ab9ead4d5be43, 0x696b0099c6d2110f, 0x569f3a11e686cde4, 0x5fc42608ac84e8b6, 0x61873758b0f3efcf, 0xcfd588449b8e2e8c, 0x46d4e3bc81967311, 0x4d35166181e978c2, 0x176807d9da037cd1
+, 0x6c09686f60d7e09a, 0x22216765c8ac9253, 0xb5e2cd3ccab0ba1a, 0x662b3ef7368e8c58, 0xe155dc0656e34528, 0x661cb0412a67ef9a, 0x4c0f6dc3e5dc95c5, 0x7c829995425e62be, 0xbafb5f58bf73565b, 0x00e988e50264dbdb, 0xac12338c56159ec1, 0x4129b6ea406e1ee7
+, 0x0294a7d5840405b5, 0x20783faa1fc0ac42, 0x9540613233a03543, 0x3df7242902915297, 0x8148fd8bf5560d55, 0x299f12c576d1b9c7, 0x4db61ae42acae5cc, 0x5054071a1f0ad6e8, 0x5cdbbf7eb33beea9, 0x467fee3752f0578d, 0xa9acce73effebd70, 0x0505322ca433dcd0
+, 0xe440e5f8df26b7e4, 0x3e5cb8ec5f87b2bf, 0x1cea69b54b554d91, 0x41e733be98fb8d7e, 0x5615729f23e33e68, 0x24ff5c1911f1361b, 0x06ffa8152514b952, 0x0135b41ca08323af, 0x65d4742a284830cd, 0x103e7655bf9240bf, 0x4512f35a23230432, 0x183ad3be4ee1ea03
+, 0xab5b4cbbd60f9bf9, 0x46036cfe5a5204c1, 0x241550baee986aff, 0x0f66a041257e4806, 0x0521ec8b16907ae9, 0x26dd3df066293772, 0x63e69f0852d35fc3, 0x575595f523f8fb50, 0x0ee137142a4593f4, 0x7b55b8c8082fa768, 0xef3d885e0748e9bc, 0x52a82100fc717b3c
+, 0x33b09ef75537f758, 0x70fdff96ece7e648, 0x6dc777ad351eb07b, 0x334ca90c3a8db846, 0x0bc67a663716787c, 0x0ebeb0af844b0715, 0x2b1e5f2ef977efd5, 0x1ecc5aa0bfc3c4fb, 0xebec4bc96e575417, 0x5bdb811be631614e, 0xed3342b4299bc65c, 0x6fc2420b13971c7c
+, 0x9af1f6611b2409a0, 0x72799c6d7e42ed6b, 0x517a10de943cbc19, 0x13f7d11ec39cc763, 0x4f92e09c9d8f6905, 0x29d05bce661a4a89, 0xe43e4e2a80970bcd, 0x7ab6d5398aca58a3, 0x9681389a1272e8a5, 0x7cc034576a400951, 0xd095f84018d75e6d, 0x7c89a529a6d21d97
+, 0xf44bdbf3960437d5, 0x3bec75765fe72416, 0xf7104a926838a6e2, 0x2a1e5ddf759afea3, 0x17641793cca8a0b1, 0x6c635e278b1dc518, 0xc04df42293739de3, 0x43e74581438f1a8c, 0x7714e495d0e8fa58, 0x6168cda12ddb124e, 0xfefa499bf45a2ab8, 0x1df218098add2a9f
+, 0x9167552f252796e9, 0x5beabba5aa303845, 0x08ad21b30b0879cc, 0x5c07148a9497a03b, 0xd1b275a63d256188, 0x2ae573a1f1b945be, 0xd3267be554a9e604, 0x0610b8069102b1d1, 0x25bfc1785cb7ec76, 0x2ee0b70b8a519d00, 0xc9a59586933f1f18, 0x13167f67ba2dfbd1
+, 0x04d602d31ef1d5a7, 0x11dc2e2bacc09014, 0x150583a4b9eb2f7d, 0x4ebbca0d45330246, 0x9478a0919eada472, 0x08e4fd8850ffe53c, 0x9d1726580ab0e49b, 0x59ad89e89158ecd9, 0xcdef38d87ab6fa52, 0x0529cccb17d6af34, 0xada6f6df89049f66, 0x51e7369a478a86bd
+, 0x44955b062a6ecded, 0x7791feea9015f170, 0x736bf603d12fc35a, 0x2632adbca5388026, 0x956e4c48e1697c4f, 0x4ee9adfe8600e32d, 0xa584042a0da56406, 0x34a3d7f4bf457353, 0x8d4fd4fe00176fab, 0x15321ee855941f4e, 0x670701ef81f340a4, 0x0c7d7c618aed0ba8
+, 0x73283131d9bfd9d6, 0x34935a39e31bac65, 0x466cfbbcaae8b991, 0x250dd54e18478ac6, 0x659e46c51e40de4f, 0x618ea014fec50e04, 0xfe64d883080b877c, 0x572cabbb6688c4f7, 0xa2c817493a834146, 0x06cd734876378120, 0xe3de0b717336a849, 0x36942f5191db53c4
+, 0xa3f9adf66abf4d88, 0x2a9a144b8087fa96, 0xfe49fefcb78a5b4f, 0x1be40a8616928bab, 0x07a901975521f7aa, 0x1fc66ea683693510, 0x4dbf0084ba42380e, 0x1f374495b918c737, 0xb8346956a380a00a, 0x1346f4766fcdaa07, 0xb4db5689d46312c1, 0x775e7f3274dc1316
+, 0x07898828f32341c0, 0x144390a33b3e86df, 0x70bc604ce1e9c5e4, 0x127652de00220873, 0x2874bc669df50d45, 0x236f4585150161f4, 0x3bfa4ffd318214e2, 0x7cc92a6165059745, 0x2fae0e92090ef72a, 0x26676bd59c4fcc3b, 0x220c030974d1d447, 0x66455887e98686e7
+, 0x4164b8e4d8760ddc, 0x5517a86f840feb63, 0xd9b42c6c9371cade, 0x3a7f03ceecc160b9, 0xdd4086d64cae366c, 0x1b6290c327842533, 0x144efcd2a7a0e82b, 0x16621925ca10d31e, 0xa9dcd13118e208f1, 0x5a90f97edcb1c54e, 0x80c47331c8749d99, 0x6f061a3569a80b55
+, 0x0f6abf619e2a15c5, 0x29106c98122245f4, 0x5860b10985c9b47f, 0x4f379a379e15f410, 0x2dd6f45df68e1678, 0x2c475167ad9b283c, 0x23b7aa00952a6a3a, 0x5532bc26a40c5365, 0xa5c0a8be3596ce22, 0x4fa3127a9aefa56f, 0x944e843aa973e67f, 0x3c7727d45ae87854
+, 0x48fa2ce675117ea4, 0x7bca8e04ad3bbb9c, 0xd57439e4726f88e5, 0x3337d3a6a03b2286, 0xb0b6172902005953, 0x514bd76734e6c0a1, 0xf97f8934eed7c6b4, 0x0abe13cee7f1b75e, 0x6c88107a120e54a7, 0x634f966d7a6e11df, 0x5044c53109b94097, 0x68d49fc65522b73a
+, 0x69e295cd8c444666, 0x542c4c5fd999a224, 0x13ff89418b5da76f, 0x7133fa786a87ecb4, 0x2f180926456402b4, 0x52ddada7931c4dcc, 0x6eaf0d2130c71590, 0x014ec2a2ec231826, 0xac05b61443b34dd6, 0x157acbfab118b219, 0xe4e2f4b84ad01099, 0x0abf4a4da29a0eb8
+, 0x5f852b85b59eab1f, 0x1bd259c4726869ed, 0xce565d9287790a15, 0x17a48442bcf58a00, 0x01e519522381363b, 0x2336d07a710da07a, 0xcfebf2fbdc714cb2, 0x2f7a51474c23b8a9, 0x77db2a07d4e3716c, 0x40e8d8d2d0a09806, 0x644363ce6d401ae4, 0x53f9cae0470172fd
+, 0x58d96ecd8ddadc53, 0x15028204f3d6d696, 0x6f40a09214439ce2, 0x738c5371236c3e56, 0x64f87ee7a28bf9fc, 0x4f1899449a810fee, 0xd0aa95f4bf21e376, 0x6170cc24283856bc, 0x9dfc4927d764ff75, 0x227ea1563fa2e012, 0xaddd3665622ce087, 0x473d3bea07a5285e
+, 0xc0b986ee0d2b0eb2, 0x78e584c740dd18ed, 0xd5adbf30a04fd508, 0x1c6aed5ab59bedbb, 0x25d05fccbddb5ba1, 0x4a58fb6b3f896319, 0xdb2f6343fd8144fa, 0x46a445de6d5b07e5, 0xf67a06684fe9e1da, 0x57b2515923b15c9f, 0x50439940820a2a0c, 0x62f4b9b26f04dab5
+, 0xe79ea601d01b033d, 0x009bc6176f10fffb, 0x333bff2f907ed39a, 0x253d0a9e626dd400, 0x7a9bbedcfcbef06a, 0x2d1b6a7a5b39342d, 0xbadfb462a124cc9a, 0x2e8cde9d82c15cb0, 0x7c3f81bcd6f1b2a1, 0x04cb0b8fa4075294, 0xfa36d3db38cbd304, 0x59fef93442883553
+, 0x91982a741cb9342e, 0x7b9d63ac17b01982, 0x530b4ec25a293ece, 0x611069ad9fa0f0a4, 0x7a262a59b656a79d, 0x6fe6f8f4d6d015b0, 0x2c2fd7641a5d4e50, 0x24b0c507058c911c, 0x834882e492fe45ae, 0x68d0b01b13432761, 0x0eacaaaf94178b8c, 0x123e3a93006d7d01
+, 0xecf2fe69377ff33c, 0x4fc960ab4408584b, 0x2adc445b1ee45654, 0x4989681cd1d09a93, 0x79509599afe9e3b6, 0x7f6ffbbeee861c15, 0x2ed2859fd6391b25, 0x5e8bd52289b6ad27, 0xc949280adbce7c79, 0x510999e865f0cd54, 0x7f957314ce7d373b, 0x4b2c0ea4bab08ef2
+, 0x2d7cc08b5c05a8db, 0x4609a0ea23507697, 0xe204ba35182c55b8, 0x5e4d5903fdef61e6, 0xfe63842f2826598b, 0x782a3fd3ab62a179, 0xd2f01a1979e5a0f3, 0x0fb4c6bdd637fba2, 0xfbff4c192020c350, 0x14859008c3d223c0, 0x65ed7a889c1a2e55, 0x1d78daf483fa12cb
+, 0x5b54d11b01bc09ca, 0x54fde75737306515, 0x89725231105b63a7, 0x712d1f394adcda99, 0xb554006ee9abefab, 0x04dd8f7bbd4c5381, 0x98d22b3a31995549, 0x637a53de6b57122f, 0x8367d69b4c92da63, 0x236f2a9514250df6, 0xb265509af63d7b7c, 0x08522e36bc4b65f8
+, 0xabae725012ce8301, 0x493b257197a98ce9, 0x33185838570e5f0a, 0x65f5477ac414eb6c, 0xd002a36854699753, 0x2be693b4d96efdb3, 0x3b32484119bdc53d, 0x55691ac09a8fae1e, 0x0249e394514c047f, 0x765674c90b78171f, 0x1166f64638d6ab37, 0x746adba4cb52d18f
+, 0x93e293653dda6cda, 0x5d004ed52ebf0b68, 0x65c7c42d0ad96cc2, 0x3350dbe11cafca74, 0xc638cfa8942fef67, 0x0ff2dfffc5ac1164, 0x9e1b625e649aa471, 0x13a219d03d2eb86d, 0xdb92859ebaf9f7f9, 0x645c50918f7d5abc, 0x25c10cfe99f7e5c6, 0x13d858b53f90170d
+, 0xddb258b13ab1e7a6, 0x4849ff49f4e13fc4, 0x9ef87fa85511cda8, 0x48c50d4d3b4d2f7a, 0x6c98422c8007c9ac, 0x3fdd72e65a3d3491, 0x56b18cb165b4ec3b, 0x6e2c6df9e3fc3daa, 0xf6db5aa98ddc97a4, 0x423fd4082f3fb795, 0x42f8f5edf424d0a0, 0x1a091c2696139936
+, 0x3161c2bbb3b2d58a, 0x2e8d339eb0fb9099, 0x45ef7d11f6fab685, 0x7f222a068db3da4b, 0x9af96f9742549a7c, 0x55370df31dcec81c, 0xde98e81b131af02e, 0x58bd0622a474acee, 0x8ab40fa7ca882e0d, 0x5b4db195655f2410, 0x4754eb479ada77fd, 0x67a8a437d6fc8a7d
+, 0x9888254a4f0c9d58, 0x3232ba83bed0c618, 0x587b0de0207b57d9, 0x020df6becb096aa7, 0xef9e41052a29a8ab, 0x4ae671ee70a15a69, 0x167ce954923ee086, 0x6878c3996c1de887, 0xb29c711490ac097e, 0x1cf41a9c2577d144, 0x0590796ba46d8d29, 0x1c2e6dc8d4aebb65
+, 0xbfb904f8ac9b4cb9, 0x4ea1742c786469e7, 0x5a422f48401be57d, 0x0be0afdc77d6d32f, 0x5e8765cba2c738d3, 0x7dad0475059a089d, 0x9288ae0c40df7df6, 0x51c65f97715a16d5, 0xa9615d4c786ff9d4, 0x507ffe03ec0189ef, 0x1c1f46684604e41f, 0x282fe9d567db0efc
+, 0xebee7f8381fb8178, 0x5bd4b6045c208d57, 0xf35694743439ed71, 0x7cddd5a373ebc5ec, 0xa58df33cc68e3b5f, 0x40e6714f5c5c8df3, 0xea881d4bfd489131, 0x6b36400b491c28c1, 0xd4475cf594b6303b, 0x5b630cddc72e654a, 0xa0b587ad34394ce3, 0x3ea3ba6014f86275
+, 0xc3deac125d20eeee, 0x2ef3568410a2b3bb, 0xee6ba3fac5d7ec00, 0x5fabcb3337aaa23c, 0x6b1212e7b817889a, 0x0b37d285a9be51d1, 0x617ca543d762bf51, 0x0896b4ca694b01d0, 0xe3add9718277a1fb, 0x553dee7dd4784865, 0x904b8f7e936cf430, 0x5b6a78f20b244b90
+, 0xa2b876c2914b9bfa, 0x704de952e9d969f4, 0xb04ea1b54b7e7654, 0x5d307bb3949cf660, 0xcee4c23ebd049d17, 0x7a88293bb1031063, 0x00b8432b8286f656, 0x260a9c86a16216e5, 0xd140e6e6629d8686, 0x296011ff5601a000, 0x536f0f76cd9b2928, 0x267409c23a823dd4
+, 0x0f041043797f8423, 0x3da6102605962ca9, 0x2e69dfeea02098ea, 0x427e7eeeecd3a0c5, 0x75efa5e8a590793d, 0x1f5841df6dfdfc91, 0x1aa1e1b8b9f3c326, 0x07bd5b0983fcee91, 0xd169420be9c48939, 0x7940334f0bb9023d, 0x9bb330fff113764f, 0x674ff1b0cfe246c7
+, 0xe2083f8d7129cbab, 0x7e6223e3d9c04904, 0x9be411a7d5e883a3, 0x72642664e7c25590, 0xbb1f783b5c412322, 0x46716e8fd737280b, 0xfa363eeaeffde271, 0x6c256c131fc2c3b9, 0x13259abfcb2ce1d8, 0x53b96556e96aa708, 0xfaa7c8d25119da19, 0x05019f438e9f8995
+, 0x05e1d55a9424f1ee, 0x63e8e14e6c2f3f09, 0xe9d844e997a10158, 0x51904ed1e94a0ca5, 0xb09462d4df6bc6cc, 0x2ee5308e62172691, 0x3f8438484547187a, 0x62b92b8d9739ddd4, 0x3ca54ab5d39f083c, 0x25b3336048a288d4, 0x7cab0fd67e296979, 0x58ba2e783962cbb7
+, 0x77808f1a1b8f3515, 0x290c219ee7153bdd, 0x7584441f79128f01, 0x0442db406f5135e3, 0xe741de52ec030a9d, 0x37469756586776b2, 0xbd64c2a7173adde0, 0x2280b66d20888d0c, 0xdd1b53cb4adb0fb2, 0x3974964394c445be, 0x53b6a95e7c7fdd97, 0x6eacdc6f50496d95
+, 0x178d04c0578a5bb3, 0x0d171a5f5215c9c8, 0xfe0d0171c504962e, 0x04eece54b220495e, 0xac4d145001db67aa, 0x6577c466962160af, 0xcddae62d99686ad7, 0x7a053a048d230d89, 0x1ff09aa0e605a880, 0x5d260426f355232f, 0xfbdaf7b0b53aab89, 0x5eef31b9eb0df78c
+, 0xfb787e56b7276288, 0x4dcccba87d630d06, 0x415e4a4bc0a44b01, 0x0f0a981f71d8ae33, 0xe0ebb786f98a1502, 0x0ea4aa3ce70dc628, 0x8d36240617ebe037, 0x2d20c0e1d2002b5b, 0x336f8aa411a30282, 0x1d87c67d8178ec4c, 0xe468dff8ac26b63b, 0x266086bd7f11c9bc
+, 0x05cfeedc80d829f8, 0x146902a029dd3355, 0x413db9327c068394, 0x55fa413791f64c38, 0xe06395c10021bf9d, 0x18d66268cf79ce45, 0x9e7ae6858dcc21bf, 0x3ad51dbe97b558f7, 0x06792c747aeef43c, 0x27ec9b782170abb7, 0x6aafca394a23e935, 0x18f7cbd98db64112
+, 0x34146ce6b36edbfa, 0x1dcfb4eab7ccea23, 0x68498e1f45b35467, 0x1b20d71a3b71d412, 0x7a875fc94e602e3e, 0x78c15fa449576c2b, 0xb52326d01ccafe8a, 0x3f53f57324d70666, 0x3830836e39bcebaa, 0x27a30c73dd02c884, 0x5dfed73dedf2306f, 0x75ee4a8b6cf54f74
+, 0x97ecc9c5851a8e3e, 0x496b581690c3df2d, 0xf7bba1fe2d169e7d, 0x4b06184810a77bd3, 0x40e6d643b903c7bd, 0x3c90f63b5176906d, 0x92f47e1ac51f1ec6, 0x70c2454c53cc0dcf, 0xb5a75d246c653b4e, 0x7e5173a420a8b0df, 0xcafb44c471d0f4a3, 0x69a3a4e92bbe5977
+, 0x26e93183cdfeb424, 0x1e0489b56fa7e130, 0x669befa672fe9979, 0x0f8aea6a7ef65bf9, 0xff0b883ea96b51ff, 0x31a668763c3c8867, 0x6887a0029701c9be, 0x545644cd70c87d63, 0x537b6fb7db9410e0, 0x6ca227f10229b3b9, 0xc7d1b4d71ff22468, 0x522058d3b20569f9
+, 0x5f4bfd813a51fb62, 0x105b94a3a42424a1, 0x96dfdb685825857b, 0x14d98588154500bf, 0xb4db83514c7a9404, 0x67aaf998856faf37, 0x1229d7e95dbc821c, 0x7e617a17a2f72bd3, 0xe964cdba7222695a, 0x677619cc40a07eaf, 0x7f82c099a8df7538, 0x2a219175ec95a1ad
+, 0x755ac147b51ff3dc, 0x4a87f652f86823ec, 0x6d8d4a923f50278d, 0x4bb952ac98c0120a, 0x968c57a6a31e482c, 0x0855a11481fd5653, 0x3f05db6ac608d16d, 0x33f9e5746e1079c6, 0x1f3458e3ec51f53a, 0x4ae3fc836ceccf81, 0x3c0b2e2db5875ddf, 0x42336a1262cbb5e0
+, 0xe3651453cadc3868, 0x25081cfd6e80a2de, 0xd4cb31092872e53a, 0x16ca9349a11a9c37, 0xb1d3ae440d1cb675, 0x41b2d6ecbccbd6a4, 0x475e6a844c3d0ca1, 0x2cd0e0dedbf07023, 0x85ad446ddb002a6e, 0x72a06e5419a64609, 0x9e779387e9a3276c, 0x414a8163a9408b10
+, 0x25c7b53c1791333e, 0x3ea57190b42cd838, 0xbf20b346b094f121, 0x47570cba99b06c9d, 0xe6bd01c8746cb5f2, 0x3c0b0b8c4c0968ef, 0xb22009690e243975, 0x251737e4a5643da2, 0x3cdd49123ab89dea, 0x68748cd1e3cc45a6, 0x563746685effea7b, 0x4e4c5b1c86eb3a29
+, 0xe1ba017516d32070, 0x5cdd35a0c4ba93a3, 0xdbc66a0c7de30288, 0x22107156a0f700f1, 0x0fb69045aac0f647, 0x111dcb9763d08bc0, 0x266db39f6d78cced, 0x02a32587c7033892, 0x76fc94ce6a2a4b19, 0x474db0f12fcfa96f, 0x0c44584c08377ac7, 0x5f435bf43140f4c0
+, 0xb9741c3014eef7a3, 0x54596c23b536ff04, 0xeadf56bb6ea39450, 0x32f24f6e1a656b10, 0x21422e4dd5f54e3f, 0x0d6ad57853660607, 0xf6f62ffdd0bf9928, 0x72569c930015caa7, 0xf4293579931b9216, 0x049d6a4057e6827e, 0x6223e20060be0e05, 0x20d91ae969dfa9a4
+, 0x02611b345456d47a, 0x601dd413d1bdea0f, 0xe6b017b26bbc9bf8, 0x63399ff3d6542359, 0xdbdfe225045a9764, 0x10acd93346649beb, 0xc652d5a50e0535ce, 0x49efbd5639c4caf1, 0x65a5dbd8a304de65, 0x08ddebed0e865be8, 0x5db8337d5e715261, 0x34cf4c75496807e2
+, 0xd840c7416e44b56a, 0x10fd30d282d8b151, 0x36ffe6df2c1c9568, 0x66d8a38b6d31a2b1, 0x01fad3aa61984774, 0x412a9fd87b303d90, 0x2720945ee0f0ec9e, 0x0c91b4c7ea84cf37, 0x98462f25fd5832f0, 0x6f4cd578c490d842, 0xecc7d24c31ed3342, 0x580ab96994515fd8
+, 0x6d8a97ed98465b3e, 0x16995dc010908ae3, 0x50626a4e555b774a, 0x082636e5a8a9b568, 0xa99435cc4823b413, 0x41fc423d10eff4e7, 0x114236dce6f9f9dd, 0x6c3995c4bbe0aadc, 0xf3f22c975935753d, 0x6b1b3f27edec2a78, 0xdbadaac32ccc292e, 0x3856036f8a3795aa
+, 0x947154caaec01d73, 0x0a22e573e3f0f49b, 0xc50c949f39c184a3, 0x2aadd0868535d0c8, 0x22bc5bbe5f992446, 0x15d36adfca3ace90, 0x038010e37a6308f9, 0x161b06d8d7180307, 0xcfbf4e3abef8d056, 0x2a1765fe9c7696ba, 0x6a15d44ce18ef392, 0x5405239c0369de64
+, 0x5fabda1210f58e29, 0x40cbb03974b37035, 0xa29fdf2875322520, 0x3b32ace85edac547, 0x0f0c92b41d679df8, 0x7f07ecd47a7d2f0c, 0xb5fc65c05accc95a, 0x0e8b1da70636f221, 0xb2ebd131f4e8a846, 0x7df51e4aba57f391, 0xaa2f3d40fef689ed, 0x0ee1e115fde5d582
+, 0xf7d025b42e240ae6, 0x29fc1befeb526af2, 0x7c5ffcaff205e565, 0x4cf4d0d8840e2e1e, 0xb8b00d1810ad0ff6, 0x44d3af686ba915ff, 0x86a8fd1eeea8d08c, 0x3eb300adcf6edc4f, 0x8db03c266b588186, 0x289d0fd301e96881, 0xba83ba260cccc170, 0x26ee69546ceb0c77
+, 0x1109d8bf92c4ea05, 0x033aa036671937d1, 0x4bd9902e5a664a0b, 0x42bd48ed44fdbb71, 0x7359e19357a9622d, 0x0d6ee92855dae22f, 0xc24debb323643859, 0x4c60fee1e191766e, 0x3beaec0e99faa328, 0x056c2ae1709c5b0a, 0x7fe89e0c62710909, 0x7e3b5cd3ac4e6ce1
+, 0xe9d06486ac7370a4, 0x4b1a8c62e99f9429, 0xb11a50e20bc3197f, 0x75ec513c25dac300, 0xfb9fd064b1466dca, 0x290379cfce59308c, 0xca3ee3fb7db99943, 0x2af7a3e930faea44, 0x0d294e6d1505e35b, 0x7d534585181e001f, 0x90285700831d4cfe, 0x419f25105d06c90e
+, 0x5f71e79f5f828172, 0x02921e2a43326798, 0xa0981553e84d4a6a, 0x220c82041938573d, 0xfd2b5b78ef20c927, 0x3c99a2dc611caddb, 0xfb1247fd99ed2828, 0x4b3a3739f724890c, 0x7775ea2d7d2d1017, 0x3ab07cb5ba8ac987, 0x82e5123a20a6b5c3, 0x44965098aa82161f
+, 0x20948c77e9ac4c0c, 0x521e934ab214157d, 0xc8f4f4052dffedab, 0x1da963c2ef46f27f, 0x3be7631e212fa2e0, 0x0d188e88d1a4184e, 0xb4483ed385de4bae, 0x4ffadfde83d2b0d9, 0xacebd9a51a938608, 0x40968c0c9302b0e8, 0x85704404d06f3a5d, 0x3e9f477a61a26d37
+, 0x1da1efc7cbd18d12, 0x4fb87a47b9f2cb04, 0x7556a45e8b5c8caf, 0x7f6991b7723b35cc, 0x3fa10a169532635f, 0x15e61b1cd72bd52f, 0xe6b45dc3b4667c21, 0x45cf3bd4bbf39baf, 0x7343b0636a9d63f9, 0x457551c49ac49567, 0x331e611a3fcec018, 0x7d19e2584756b92d
+, 0x78951df174059655, 0x0573cd896a793337, 0xb3e37121fd458870, 0x3cc032b1a1bebc3c, 0x2571dd06d24d5a41, 0x017382ec4aa29ffa, 0x6cda850c15a224ed, 0x6af59bee2d7586d4, 0x287d3c4027f80ee9, 0x6aa570b9e51d4f25, 0xf29f327c5e0490d5, 0x00fb62f93f43edfb
+, 0x7b06e602dc313277, 0x5d8dc98e723b039e, 0x5bb61813041a589a, 0x2a4c9f13eef7f1ec, 0x9439edcb4bbaba6f, 0x027f4d494e7784ad, 0x087ae2a2fd6bbc8d, 0x230f37ba41aec2ff, 0x63876e43daaac09c, 0x28abd7ae6e17dbe3, 0xd354d50cf000982a, 0x1dd774a1273aea75
+, 0x243658930d4b0902, 0x0df50723a2da63d7, 0x22bc07b9ac9628c5, 0x134123d68aa939cc, 0x4e84ee2cf0d450e2, 0x53a8c6dbd4aa9ed1, 0xd06e741c45610565, 0x608da7f96f2f7e19, 0x59b7fc9fe6a0243c, 0x0da36bb46fd1eb3d, 0x09a11de836914182, 0x3becc1cc0b96f1e4
+, 0x820b8a4cad71c17f, 0x2a425dd0204a843c, 0xf6f7fdaae1523c28, 0x5fb74c0c961e6fb1, 0x0c76e0f72b7845a2, 0x273db117946ce778, 0x7a22d35cdea5934f, 0x73aeeb1b24265d5d, 0x938a618552e4392d, 0x6050215beb6c1923, 0xf32f6ab781efbf2f, 0x2e4ece5c476e1354
+, 0xf2a4a59613812356, 0x555185da018933fd, 0x2fffbf95863bce54, 0x72644f9c3181e7a6, 0x98c6b1d509e3d624, 0x5bddd5730939d7d0, 0xdd197613d550fbad, 0x7671fafa1facb923, 0x13dbb61148c5b802, 0x616bc5c73ccdc3bd, 0x0b175b4c46fd8871, 0x498a1eeb000ab870
+, 0xa49f1ca2d7802521, 0x6906346cce00be5a, 0xf1bc33c727dd52b0, 0x5d005ff3122fd749, 0x51318ad5d7c622e7, 0x50f93d6d15e46e82, 0x88dfa2123ffff3b9, 0x3848e6fce3cac6e5, 0x6cefc31a33ea4f5e, 0x0cc5e7dc4e5e144f, 0xee2009402e59a7e2, 0x257679fdb86f4712
+, 0x4cf68953d8b17e83, 0x710f970c16ce2070, 0x4000b8e9e51e6aad, 0x5af48dacd01f24f6, 0x209679d5d3fcc916, 0x0a3538dd7cbe8232, 0x2d6d7aba44d990d2, 0x46c718f2d4b2c1a6, 0x9953d799a378233c, 0x4f4e80f4a682e7a0, 0x9912f04acbb77eee, 0x317432079a195b2d
+, 0xaccccda6a1c11e3b, 0x3fd895817d0f3be2, 0x016db17673f750ea, 0x635fc619a24009b6, 0xb8447ab3370da1e7, 0x6c893aa19abf4221, 0x5f35ac703d8508d0, 0x13533d324d4adcb5, 0x84610370dece8512, 0x2223f126f9a70f4b, 0x18f00d60f3bf6a04, 0x174bd78b20ef8543
+, 0xeb179bc6a1698189, 0x732bf44a62015302, 0x98352342bc0e4bc6, 0x053f6640c1549e85, 0x65eee8b0397c7ce8, 0x790451f39f2fa27b, 0x36ffa0cb286cdb97, 0x46d07cec4c967bf2, 0x7c849ace30868412, 0x6dee239d339ef499, 0x8ab78548f273e57f, 0x01c5bebd8b7f5ef0
+, 0xe440e5f042eae93b, 0x65583f57fe057db6, 0xe6d5d26c24a565c9, 0x6b3b87a0a6ad702f, 0xd3f5d533117b8e64, 0x4addb9d0da92df89, 0xf1bd51990e0f9bfa, 0x30c624ec1dbcd0a4, 0xafaf2f00da7023a0, 0x3086e132b54574e4, 0x93bdbd4bfd3dd8c7, 0x690976ee132c892e
+, 0x86fc11c79524d198, 0x0f6b95662e02c734, 0x5b78bb385564f568, 0x55c9b3f55d7cd16b, 0xdf1316434ad1c07f, 0x093d67d3fdf312de, 0xa1fd2257ea57b3d6, 0x4b5b18abe4b54439, 0x66c28f5b59d796b2, 0x7baffe6e642fdea4, 0xb9d3753265e68ae4, 0x40903bd6dfb02d6f
+, 0x357958d4d72d6bc8, 0x179330dea4659dd3, 0x5a9ca85bc8721aef, 0x0209f09e03c9b225, 0xc0bf2e9738933495, 0x5e0dde4d715e50c5, 0x2743c96b66a6b951, 0x6af96188a0d6d358, 0xb2f3c72820f2a709, 0x5e9b8fd43327d9a0, 0xf0b13f5324012177, 0x7abdeaf4f741bace
+, 0x8e71f809c25204fe, 0x2ebb7b37d53ce671, 0x85117544f57e7142, 0x6b01295558ed3194, 0xb90518b25e20b15b, 0x4f72fa4b2206b35b, 0xa6602df22a663970, 0x78f110bf96701863, 0x1d9acecaf584f47d, 0x37ec8b293bbf2c26, 0xc89c96d1ba00d299, 0x027e7781c561153b
+, 0x66c5cfa9a1a9cd56, 0x7e13896c49e82652, 0x0d1460afb01a079f, 0x61cc409eec223565, 0x8dd12ab6e6fe042c, 0x526d8500bd504572, 0x1f013bce59e6b0c6, 0x6e534b5bef2d7649, 0xafab37aada602d46, 0x2dd66007052f56fc, 0x6ebfbebe82fb8a28, 0x2705bffa6f07b812
+, 0xce43976f5cd071cc, 0x17b2b48b1114283e, 0x5c5d694e10832c01, 0x38d73eaa3d389994, 0xcbfd7c6888529921, 0x3453da778a079eb3, 0x96bd234cb6ff0d05, 0x7d60e249da086be9, 0x9f82a6e305d8b42f, 0x4870861f46d686d4, 0x3e1faa1ac08b6aae, 0x3d05063bf1506a4f
+, 0x2a5e85a5c9502826, 0x2fa6e1efb48a7e40, 0x785524bd06117bec, 0x27045e44a71da6e8, 0x6e46490f768002dc, 0x5053040141dd4b96, 0x58063025d2d7c242, 0x2db4016be15167dc, 0x9eeba12779f58415, 0x1d809b0b57cf83e3, 0x61e520f2a4aacfb6, 0x208baef99ce836e2
+, 0xe2c10f0c33c3dd8e, 0x7d4fba6d1bb13908, 0xbcb44038069d9d3d, 0x3ab330362e680370, 0x53c08d994364d08d, 0x4cc00675b64c9328, 0x7c55f2417c60bd78, 0x7a076b37e98a7c57, 0x32a3943b5ddc41c1, 0x6b6b6d4805ad777f, 0xed4e6eacbcc5b86c, 0x545dfa661d921daa
+, 0xfac3b6fa9e45bcde, 0x7067d31e3606d834, 0x62e2f77c0c388a90, 0x1f8c4a45e268e15a, 0x8c235a561aaf8a71, 0x16d723d1e55efb48, 0x35fcdc096f8d2b93, 0x0e02ee35957feb94, 0xc4e9cb0c94e099d0, 0x6c82d2e9ef85d831, 0xbb449d1009abe03b, 0x65ae8419015276c5
+, 0x17ab5e5e9a506958, 0x01012f23fd36be0a, 0x71176db8e2ab8489, 0x5600051493730cbe, 0x6e2a8eceab8d9760, 0x5d1ca824756a40ea, 0xe65eef8bba6d95aa, 0x070fe6a4b2b99f31, 0xca87dc46a751dc00, 0x5cf8215977c03f9c, 0x2797ed152c82f3fd, 0x282c220d30b615d8
+, 0xc60d848380ef85b4, 0x466ff34cbc86a6f4, 0xdfd432c782c3003d, 0x3ed47a346efb1fa0, 0xb4ee56fee7636246, 0x71d7f76274c37839, 0x29fb6b5cd5d5645c, 0x1e8d49e9caf17e92, 0xa151c4ca4a2def2d, 0x651cf415587b245d, 0x539001acefaed426, 0x5fcf24ac44d1d78e
+, 0x74506f6fea5366ec, 0x0921d3a4b9b45ce3, 0x7bd958e7da9e021a, 0x5f79f6992c9224fb, 0xe790c1d3d439a24c, 0x624b31764efe3109, 0x2e9eb4234277a43e, 0x3815dfac4a74d61b, 0xa1768fa657b8a19d, 0x5451c4f3aadbd37f, 0xd4528af5e89f1483, 0x65c261d5cc9ce1e7
+, 0x8b1c97d39350cec2, 0x1e76f1cea5ec5035, 0x9bab43055e804783, 0x359d4e0ca3199be7, 0x78a2fb95b2321b04, 0x5be854f1f154e9a5, 0x8e5ad7920df0ca78, 0x4b84f514742b0b09, 0x981cc0adb06d0271, 0x4f4899a450a6f3ba, 0xa6c6329f318c1c77, 0x25317e4ab64c3867
+, 0x04541cf9aae38d31, 0x5149a79605f45a3a, 0x17d92d53439258f2, 0x29af42a557785718, 0x6c2c8121783c0137, 0x26b60a3eecb829b3, 0xbc900c3f94e19b78, 0x6a97e016957065ec, 0x8ff24ae2d5b10530, 0x1364872a089b6a8e, 0xeea7d96119b9faa1, 0x30add8d65f8a78fd
+, 0xc32e58e6c806d47a, 0x77103ea8c25e5a0c, 0x215e7d71ff63b7a8, 0x43323e9bf4cfbedc, 0x7cb89121cbceee75, 0x1acb18f16672ca0b, 0x17fe6fa1257d384b, 0x7ba64d3237ffb371, 0x3e6f197915be4458, 0x306e70df9f1f822f, 0x636d6f7d8fb977fd, 0x20be889a01c70b81
+, 0xc965fde4466225b5, 0x12080e91dae60580, 0x02c2ef338c535cf5, 0x0d2c10ba384f9a17, 0xca918accebfa9e22, 0x5923fcb5c79602b5, 0xf3b03f68686c07c7, 0x789523300aeea7a8, 0xd3b4724e163a5154, 0x354a2aea1811d8be, 0x2216c66bbcb3c5d3, 0x6d225be19e60baa3
+, 0xdffbba980494d2c5, 0x3b3a15134a3b6d28, 0x82d094f5fb6b2749, 0x7fcb7d84f7689b32, 0xb5d7cb569bd9effa, 0x6a3c542b3ea43496, 0x6df6fa1fea2392a4, 0x4415993164dec901, 0xa15ce34a5cf3e84b, 0x5adf7eec0ed80c61, 0xe62a93c1855cb291, 0x5e3fdaa143b775d0
+, 0xeefa426ddaef981d, 0x531187de36ea9a00, 0x8564d05334b3eeba, 0x283cd3c2f754b6c3, 0x96bab685f62f71f6, 0x440f1124768f0cd0, 0x37a57968a2e9b7f2, 0x090d288664157c3a, 0x7d06a0ae8166a93d, 0x55f3da40202663f7, 0x83c156f6cd4a8b41, 0x11ae2ad0b4889ea3
+, 0xdb942f60927c52bb, 0x19e863d1e228c1ac, 0x6bb95734382ac921, 0x191c5eb8e5027959, 0x18f78d73b4fe3034, 0x69070995079e4dcb, 0xc6dab1fefd565b53, 0x0280ee9e79333561, 0x6dc5147e9ddeda2b, 0x2883af366c02e9e1, 0xd537ca90f4b61207, 0x72cc8d7c00f9afbc
+, 0xa80c0839d175f0fe, 0x41a04c40c66bf270, 0xe4f2765b7333f02b, 0x4355c56048491dde, 0x23a0b91e1539fb3c, 0x385b8bef5a41e5b1, 0x501ddec6c07805be, 0x4faba2ed05e46c60, 0xf86012a3d9baecf8, 0x7f077e48bcb4c593, 0x7b47f80442ab5fd3, 0x7bac9e60e388a875
+, 0xff20916e79cce840, 0x6e92dae0be9aa6b1, 0x9abc9c2f874bb08b, 0x66b84e9249a9af07, 0xd079727d2c3ba7fa, 0x3cc9b4ab42bbcb58, 0x1c05140684e7f2d8, 0x42f2e22de9231b55, 0x5ed35d21a458f273, 0x04a69f1d834e8b5c, 0x6674d387d8e5fb7a, 0x5e39141f13be1f09
+, 0xc31efd596696a903, 0x65a5970aa107dfc5, 0xce7f339b9c57fc35, 0x05b60bc9c7035f59, 0x7ff6dd5217c3044d, 0x7d31a994a7035795, 0x8a09198268f8dee9, 0x6ae984ab888fed62, 0xe8f01994fbe2fc35, 0x02a9ab63fc82e8c1, 0x5ce65b755bbc6f93, 0x24964794b67fa80a
+, 0xaac9f48c42b00556, 0x24091c4f22b26312, 0x6d30fef9c8d2a0fb, 0x30c8de5b318fee1f, 0x6aa76f4817ddb562, 0x278652b800f9e287, 0x927f2407e8cd1d09, 0x06294595a9a38e97, 0xf74111dae605b9be, 0x124b573359096daa, 0xae705465e4b29e77, 0x4351062531f2c9b7
+, 0x3688d7be2f54bd47, 0x2d5cce8c7027a741, 0x247d908af9b4d913, 0x02b6599f9fd810e1, 0x2b19fcaf75b4700f, 0x6c5e798f7c301a77, 0x6ae183a3a6614a7b, 0x70a94de0fdbf2442, 0xd2be57bf6d1caa84, 0x59cafb9b651aefe0, 0xf94199db25d1f46b, 0x389af5b09e99e5ba
+, 0x090946ec986c5e3e, 0x31ca5014e71b788b, 0x1b98f5f759d206a5, 0x5b4b2ed46ebebd99, 0x737eb2ef00593d27, 0x2a3faa466c5ccb32, 0xa4389f7707854704, 0x159c3039c372f1e6, 0x5daf6f848dd62d4b, 0x443df3c7ae3dfbf4, 0x65b7ef92fc278528, 0x69772cc673419ebe
+, 0x964b3675619aa430, 0x5abf8400dc08d953, 0x208dbc74e84fc1da, 0x6a2f4f82bcb351c9, 0xbe8d9e42ed3c30a6, 0x033760a913eaaa72, 0x324fa89e69bc9f2d, 0x785bf8493d25b38d, 0xba8b6aa883229fea, 0x4cc358eba80a0ed9, 0xcaae57d70fc92f08, 0x40cf65a40431d67d
+, 0x5e3dea459af2ec88, 0x5faddc7f04f158a7, 0xb45816497cd240e3, 0x369488ee7753e717, 0x724e899b5e5ed35f, 0x79698731fc79651b, 0x4b00f97b0a51447b, 0x49cf38dfb92ff373, 0xfc63963f06c990d0, 0x7ac88a353752e3e6, 0xa352c78bd4972645, 0x3989f9343056644b
+, 0xda357b1b2faa2e45, 0x129a85e16e68a645, 0x7a4e8609655f311d, 0x13c3ca0262b6246d, 0xa0335043cce62d63, 0x0f38f2b155ec2e0d, 0x3eb848e7d8d637b2, 0x276e046a25f65cda, 0x0bd83b24aea42fa1, 0x06d509113cd37f55, 0xbc31d994df0259f8, 0x6843fb43a9fe7c38
+, 0x149a41eea59170a9, 0x5a7a674d1fe36faa, 0xe6facf24dcb20948, 0x05dafc6df4cc92e9, 0xef487c3fd45b5a6c, 0x381519a813c57bc7, 0xac3267431b6c5da0, 0x7fd0f99c768cdf6a, 0xb6ce90fbbab8b2b4, 0x26901123b37e3dae, 0x8ba9c65db9aa481e, 0x6fce3bd66d2c1ff4
+, 0x784cd711bcac99bb, 0x0120bcc18bde4f33, 0x279fb57d0a70536d, 0x218a147f3b8b5a34, 0x9b79083ec05faea0, 0x4f268eba938c2b8d, 0x4b4e96492b7e94fc, 0x725bb1014cdd2193, 0x2f629dbe04c9278f, 0x17eb19bc179fef33, 0x64c02c4fe71faa7b, 0x2bed16727da907f7
+, 0x0e94a2ffc6f6be1d, 0x690639746653d0fe, 0xea58300f91bb5828, 0x4a18fd6c3f37901f, 0x8d8c9121792e1cb4, 0x400aa105779f5bf8, 0xd36ed767f44bb2a1, 0x202f19a9d2581abf, 0x88d0c1437c525211, 0x7faedf80a8361935, 0x84ef1a6105f78762, 0x75ece1d7cd9fddd3
+, 0xc2473ce78ceb2f44, 0x361de3f71cf93e19, 0xafedd803d58ed318, 0x57eb005eb6df4d37, 0x890850d283902e76, 0x3ab8f0eb0a8ab5ac, 0x4274651ca2982a94, 0x73c1c2308a966564, 0x88b3f51ccb3ed44f, 0x788452138b871e35, 0xf50816cba5b8fb81, 0x73c834fe3f77ad7c
+, 0x13fc1a6ba6e718d0, 0x34fdcc417880b539, 0x1d2a67b1ce3b5120, 0x7070398d1bf28a30, 0x9ed3973a28644b15, 0x63e2a8fe4d0b74ea, 0xc85b211552d67cf6, 0x59edce67216b54db, 0x51e06f08c484ede9, 0x1195f6f6a803c734, 0x8a6c6000e59b6e7a, 0x5e17c3e93672fefc
+, 0xa1bf1b926a88f92b, 0x32c6e0dd70d99747, 0xca914e8568b06125, 0x42444a7080682234, 0x5133877cdd44badb, 0x4273ee7e23cc3f9a, 0x4ed7524d3b142478, 0x24d5c329a89a2039, 0xd3a501ffd093dcef, 0x2eba9190d4ce8fd6, 0x5ede149ab4f0be41, 0x2983f244322f8488
+, 0x126713647e566e54, 0x16388e40eccad7c3, 0x8b821205a5fa5a26, 0x3acbe8b3140dc8d5, 0x26b8af4fb4f65543, 0x373adc190e0fa48f, 0x5cde6e2938561c36, 0x5fa3a87ae6f764f6, 0x9347e005262af823, 0x2b2ff25c04c0d122, 0xef98973ee5594142, 0x19d9043228b7a62f
+, 0xc86d0b4c639124c9, 0x051952543e8a5559, 0x232ed76431076949, 0x2b4e347b77c7d891, 0x0e0c557f40d30524, 0x36fd8d9c29bc7d34, 0x59dcb743fff54c43, 0x174556b3f859bc65, 0x80869ed5a7e1e5f1, 0x0e928161e669f525, 0x61f8f37c763f8b04, 0x49b9c40144241aa9
+, 0xc93010076dda7c66, 0x604ecdf469f922fc, 0xfb74b5afd0b4a90f, 0x37a189e443c2cd2d, 0x29b1de015998a809, 0x76d09300cdfedd89, 0x96bca9d0065901f8, 0x7e519486c7547e85, 0x7afff76233b00183, 0x1231f594531dc973, 0x32e4265909a59150, 0x21b0eea2b2a29943
+, 0xe220f1174a206093, 0x58cbff3d1eb86cc1, 0x901cf98e01b233ff, 0x708e45c90d79fe1b, 0x51da253e4d41f6da, 0x250f59d34936f6fc, 0x8c243951f201ee99, 0x5f5ef56612a4f499, 0x9aae67e56e46e8f5, 0x0aba0529edc2aef1, 0xb806e7cb7a945d13, 0x5f039f7112c361fe
+, 0x1b7b5469d438277a, 0x04f460df77aaefef, 0x62a66add024f3460, 0x4ad2dd26c92be86d, 0xe2f4aa34b7f664b4, 0x100dad8137eb161e, 0x300e31b14659de06, 0x527287ef595dd996, 0xa55535c4e29d89cc, 0x584afe0e800f27bb, 0xc7b1a5ba9a0495f5, 0x36a876c5e4563883
+, 0x0df0cde7641fbc08, 0x6495f3152e265dfe, 0x80bd58ea4e6e448f, 0x010fadb86892b256, 0xe8bf34ee67602d81, 0x354d68ff6d6bdfbc, 0x1ccda767f1785419, 0x142f76cb1a8ae545, 0x354825645ae7d69d, 0x622b90fd445bfb21, 0x6252720cb0313854, 0x795dfec85a0773a8
+, 0x7129048cd8e4de09, 0x0861133f4d5a079e, 0xc1611d35b9de606f, 0x04917b99dfdf7934, 0x84842abd90ecc3ea, 0x68e846568197fead, 0xa0699828808ffb65, 0x026da2f93daba8e2, 0x92ec9524b3272c8d, 0x2a052b20553038f9, 0x876bcb3c1c62445c, 0x4f944fab9256ce6c
+, 0xa3ac7d43a1f2dfce, 0x47c371cf4bedacfd, 0x7344d6bd75760bd3, 0x0e18bdfb0f54f9a4, 0xc4b9f10e990d0975, 0x6e2d1bb7655cbe1a, 0x07ed391400d703b9, 0x184d0d1c065ad756, 0xb36d3ae1d0d08ee8, 0x6789b29a6688baa1, 0x3ecf4729fe9d6738, 0x565e257d4a9f3bc6
+, 0x3f7ba4729e6b3a98, 0x6f09bdbbcaccfadd, 0xb089fe953160883d, 0x39cbbc17206a22d4, 0xdb86fd9ed56f6aee, 0x0666caac0c48876b, 0xef8bb79152d81067, 0x31b36736d560bbdb, 0xcddd00eb58a97d0f, 0x362b59966ab84656, 0x2058d03cafc6bf9e, 0x062f497f0e198810
+, 0x1093932097ef6cab, 0x18d60c864cbaf808, 0xa6e8fdd3f0f8c3f4, 0x5fb48054709c0ae6, 0x6f783f5925eca3f3, 0x6b525bc9350c1672, 0x7be5a47a7c7d9d30, 0x766326ffed7d2e21, 0x83cd4a636e4e6d76, 0x56eebb8acd2f0870, 0x84517e4e7dbf9886, 0x4574bd5467b6c8ed
+, 0x7a7ff1e3245cab37, 0x1370a00345fa9354, 0x488b45431eace69d, 0x73abd5b17979434b, 0x5583cf146069ac9a, 0x1a25466acbce3b8b, 0x02726e9d7a32e59c, 0x0d2cc727c10aa308, 0xe1fd3f18486b065a, 0x4eb2ad3b046edd0f, 0x058d817876c8f207, 0x58101603c8158a84
+, 0xd48f531495e407de, 0x0815dc475d734ca4, 0x1e2207964340de50, 0x0be7665fbd1e81d5, 0x49608809236d1517, 0x53df7100a12d6712, 0xc193cccc00f8302d, 0x10092c1f8e918ada, 0xdf5ea38b52ae8311, 0x5e384a9c2c595615, 0x1b54ceafbafe51fc, 0x387f2316f19f845d
+, 0xb77176bf74263102, 0x1308720f342c1973, 0x388d6df3d782e2cd, 0x0e5f66ea020f8eb0, 0x5e807c53519e4654, 0x7de448c866485742, 0x09117741b9a21b3e, 0x38802f32184ed670, 0xcac6db447541914f, 0x231e8055f042d2c3, 0x9df6405aa9cec9a2, 0x49edcf18c499cac7
+, 0x9c3e25c06e7bb91d, 0x469e758cda673c7d, 0x8644dbc2d6861cf6, 0x0e1e9f70a8b0bd2d, 0x9fbd1a1fb44f1a2e, 0x51cac801e6b7d4bd, 0xbeb3e3c08c93475b, 0x15a9e19b0e54c6f9, 0x7079d3ef65061146, 0x57206ad88602d2a6, 0x73304a3d1f7e9c3b, 0x3178a8a8996a8c51
+, 0x15a68fbde5ae5eda, 0x4b6922bc7b73f1a2, 0xe72686267b52fcb6, 0x4d935777cf7e114b, 0x4fcc677352b2499f, 0x10cd2b07029ac98f, 0x598f129e72bb5924, 0x6df47b30b9c06a24, 0xca8af8de537e749d, 0x0852006d061ac128, 0x51855bc0a200efa9, 0x768269e2f0fbd556
+, 0x12425594dc966e37, 0x5a04485049cbc9ab, 0xc56ea1ae890c4be7, 0x48773793b851b04f, 0x84fc8838712601eb, 0x3c3e044b61db758b, 0xfc2fb331cb560707, 0x5b9e2d922f7a172d, 0x2d718614662cd8f2, 0x2d98a5e24f6971ab, 0xddbe6608236704a0, 0x40e417ca05dfe848
+, 0xb6e3bebb39845ec5, 0x2bed2597478ba3ae, 0x491070398b4cd694, 0x1709f6180fbac96a, 0x99ab8b396781dd85, 0x281a73c6fc10a8aa, 0xddb4ebaab8152203, 0x4cc0997933d4be4e, 0xb6c343df2f6d0da9, 0x78a457f003869d6c, 0x161a73896ebbcd00, 0x4044aaace3f9318f
+, 0x790077010498849f, 0x282a27f81879a31a, 0x11e11534f24934d3, 0x34491f9a036145c5, 0x90f1104872a44d83, 0x4fad286de6b30939, 0x7e431830aad1171c, 0x300c88b138185eb4, 0x7743b1692dd8f5ca, 0x4682f891a08775d3, 0xa75a721d610cc8c4, 0x3dc67ecf92bc456e
+, 0xff07604e842bea8c, 0x793ca6ddb49f4086, 0x9e3215935c6c38c1, 0x6c21f6eb852de4ca, 0xb7c7c06ec232ae3e, 0x6ce20da5e591ec12, 0x0111deccdee5ac41, 0x340535d608ccbe7f, 0x511278ff0466c5de, 0x46e13155e72dc5fb, 0x38b0d7c3f99e3713, 0x297f68d2f08531cb
+, 0x26b0b55122022f4f, 0x69e8409b93820745, 0x434b1f0f566b56bd, 0x0373bb6ee7147406, 0x63c751f9ea0b6e05, 0x3f36ce6206219445, 0x555cf69a012e7e2f, 0x55b5b46aae15755d, 0x5de095e1d991f315, 0x15c43b346f5e645c, 0x818f56b9509a0dca, 0x21e19179d8bf822a
+, 0x96b3ea04d4a02d94, 0x0715c5df4f4e301c, 0xf0dbdaeed67a365e, 0x479b96def4aa47dd, 0x421f3e23ec47ab71, 0x343f303a8c43a06c, 0xda49a77fe98f8783, 0x5aad9c070bf35fa6, 0x400bbe2180df1d8c, 0x21ba4f4a3833f2eb, 0xc47e682f767b6c7a, 0x79edd1ac87b93148
+, 0xdd27f133299ad173, 0x7c3764e1e8b0cd7a, 0x727b539d92057631, 0x2d68238b34898bd2, 0x50af70f092df14b5, 0x3f921a543f9feed9, 0xacb93ded5ecbd9c8, 0x1ed8c6493cf954a0, 0xc48f397dea1a132b, 0x6b65f8f7e62d03d5, 0x773f00807a1e2c4c, 0x319457f073d928f8
+, 0xe2aa20b1a07618a8, 0x4b9e0df0162f5cf5, 0x3ccdc39e1a097de8, 0x3d1eb9ef9c8819a8, 0x913c80ad1cdf2cd6, 0x0bb01886a7d65d15, 0x1afb6429ae2caf6c, 0x5683edb458b15017, 0xaec2b62ee7ba3c93, 0x347595f76d5bfce1, 0xd5cb66bb516c6792, 0x52d4df4c90db9312
+, 0x87f0d16f778c5957, 0x25349b2e3ae4aba5, 0xc4e820668b0b1943, 0x309eb38a56e8ede6, 0xa58f46767433412f, 0x349df803e450b56f, 0x90f8a3dc32561b64, 0x68299577d7ec049c, 0x02e498c987638aa2, 0x40def94d56c26322, 0x7bf3e0ff5dc05d94, 0x6a7577fb1dba380a
+, 0x88207101c9de1eb3, 0x471ef15fa62591a2, 0x106ef3c6060df999, 0x57e835eb59767ef7, 0x7296a6b4fd8084e1, 0x0ce22202d2134ab9, 0xaee8a6947d4b4ccb, 0x54adf0506f5ba563, 0x67670b437f6fa9a3, 0x1451f92421a875b8, 0xb27071865a08646a, 0x17b5e80ca4e5804c
+, 0x004f53c3e83559c6, 0x4e3cdc1d57afd566, 0xc7f89433af15269e, 0x4c74bcbf65089d37, 0x59eff80fe1e89aae, 0x0745f3a314b88583, 0x2f56770f3340e34c, 0x028e96175283c32c, 0xc2f678af26f5217b, 0x3af473011b8dd8be, 0x01679a007fa51fb4, 0x6d2a917665f524fd
+, 0x191c2afa4db4d78e, 0x4be9d7d2a7fac6d4, 0xb34a933bbf7b5457, 0x189953267b5612e4, 0x655ccde463e80295, 0x1fe93c2b61b1d5fa, 0x4e6e69f72417b79d, 0x1592d5d28ce76fc0, 0xc2aae844b793772e, 0x0f8d3c473825e455, 0x7b0d1b699be576fe, 0x67c89032af27ecbe
+, 0x5fee28add67060be, 0x145209fc4e6c28a5, 0x3d0716237a2b6064, 0x747881bd4b644698, 0x01fc6178169b6c17, 0x115b5fb6183672da, 0xc593e5e3d4004d13, 0x579cb584923b71e0, 0xaae7bbcc462122fb, 0x294118c3e8cff0bb, 0xb154b16e6c8df4bb, 0x053652583138e231
+, 0x0e30e7ca5a38eb8b, 0x5c8f47a48a18da76, 0x75a337768705165c, 0x1ed2b9b71d81678e, 0x69834fc8fda114e9, 0x65ff3d5fe4d38549, 0xd62300c2f923cc2d, 0x4178b7d593b5a2e5, 0x0532e4ad5051750a, 0x0255a8390653983b, 0x1c4521edfb1fe8f6, 0x2f3a6b5010a72a00
+, 0x79152cddaffd1af6, 0x0f0a79cc85a61075, 0x0fcb457a098c0e30, 0x710418047ddfe63b, 0x366871970b08ecdf, 0x5c763652aed2d420, 0xf7d2e9ef4c8ad532, 0x4a43b8c44e6d2ec3, 0x74120dae518db896, 0x53f801ebb099c1db, 0xf20eccce61d1dc89, 0x5f39d6c4611d1468
+, 0x02de175930926fa6, 0x5e726c6213ad4d10, 0xc0dd566b50aa3316, 0x63f1eb7c74fe33bc, 0xc573ea0c270a7a61, 0x6f6370d7375d65fa, 0x104caf5d18692f6b, 0x09fe9242bdcf3ed0, 0xe0d8047ab16d1934, 0x0b398a0e4bafe9ff, 0x2a576abe60dbde1a, 0x58454afc7f54f4ab
+, 0x5aaa8e3ad187b67c, 0x25d3906fa2e258b2, 0xa7aefda45922658b, 0x6ddec43a0d046c94, 0x6b8056b7f76456aa, 0x712add84b4b59e5e, 0x215f8c303db44047, 0x538f845755a9e7a7, 0x0461f38f90b6a341, 0x7fe9eb795922019d, 0x4848b80fd8f3bcbc, 0x2d99757886a153de
+, 0xe3adca3e20eb702e, 0x7d3c0503d0a3f409, 0xb5a8e41208d5cbbd, 0x7cb3e4229a27456b, 0x3c28a52725fa627d, 0x01293a82cb1bddfe, 0x372ee1d727a16903, 0x232e7afb711415bb, 0x51c3021c51eccff2, 0x0f10e2bc650801f2, 0x037cd776971c68fc, 0x33d3f2707632fa69
+, 0xe5baad6d7adb7320, 0x0826e640d232482a, 0xb8ae9d839d393009, 0x09fed4ed4492ffbc, 0x062f9ee3ac2c64c9, 0x4c9421fd234f65f2, 0xb9a0824d55f29361, 0x462fca021a0bae6d, 0xc3dcde2a8db7c11c, 0x1ced2fdd5ff5e230, 0xb4a7c64c5cad8fb9, 0x54170a16cd8f756a
+, 0xe5d997d3f59f24df, 0x5da1c5d4bde51147, 0xc44149919425fc0d, 0x090254c81ad60a3d, 0xcd71397bac019e76, 0x1d549b1938095d5c, 0xe67774c76df3256f, 0x7466980532e4307b, 0xf40b4207ebd5f703, 0x20dd613441fbe712, 0x56e1eaa4096a077d, 0x376b84ed795dbd00
+, 0x8db7fc4c7a802bbd, 0x65fe04ff10b386cb, 0x7f620ac43d2d6809, 0x361b4c1d501a6507, 0x25b9d72e0f0fe018, 0x278331addd2f5fab, 0x7a08d1b7452c4d5e, 0x24fdefab552ee8e3, 0x2c1d8fb3fd0e8253, 0x677ff0650db81e07, 0xe66bbb99f36331b4, 0x4e69b45c7e0edbe1
+, 0x30f3e19a03e978c2, 0x25a8a596d703365f, 0x9fb8d41b67378c29, 0x7b4c4d67a69a84ac, 0x1c0586c3c0fa2752, 0x375e24868b09aa8b, 0xe4eeddc810360a3c, 0x468dd1a2163f2b7e, 0xdf96cd248842214f, 0x7307816f0dda8211, 0x43dc96b0a61fc05f, 0x75adb0e9a4f6ce10
+, 0x0439fcc83098d555, 0x71569c609ca1de14, 0xfbe858f81623e25d, 0x26b01cbe131db073, 0xcb6e7932946c0c04, 0x037dee8d73f86ed9, 0x969978d5e0ccf8d1, 0x198538df3d6441b7, 0xb27020b9f37c09cd, 0x296eda198454b80a, 0x871d22f39dc029ae, 0x13df76f999f0c02c
+, 0x54dd162fdd971dc6, 0x598a5346292d55a6, 0xcb8a5e3677542f99, 0x76a2237af0f7c46f, 0x9d2a3c11c3c6a83a, 0x4de00f5cd4f2bc09, 0xe99711f94d672dd9, 0x0e00c74c7f7ced09, 0x3982ed71885fc998, 0x155caa4532f7425b, 0xb39b60e091a99ccf, 0x62b6354da2e8fa35
+, 0x5c9ff98f93f0269f, 0x2094d8c2610a7cc6, 0x366f062e1ab924d7, 0x24d5d5d12e3be0ad, 0x7f14e8af5780f628, 0x778d24f4f9ae5931, 0xe48cd9367abcc598, 0x196687002fc80796, 0x52c4fcb72209b386, 0x0676d113b310c73c, 0x8241c23d82cb3c4d, 0x53ee306806a89ff2
+, 0x927e2b011a6f05f8, 0x1c74c2c1fe52689b, 0x1c053fc6abfca7f0, 0x5407aab4d9a873d8, 0x2b0fecba523a5d95, 0x189f75aaef2a8cda, 0x480efa8cf923ea23, 0x3dbb693ca644da39, 0xf700e878c83e4ac3, 0x0580b622bf4a2d82, 0xc1c4f2863f100bed, 0x6050d6c3a884e58a
+, 0x734032840c05c8f8, 0x2776de4edf3f0b14, 0xf15f4810ab971efd, 0x453a2369d42daec0, 0x061946c9afbd95cb, 0x4fb878641c5fec53, 0x9322608aee6cdf29, 0x3a95e27c1dd53b77, 0x6fc8d19194ac154b, 0x60c0f25944b6640f, 0x098b4a0c0c337fa1, 0x14d0c6272777853c
+, 0x8ba539e9be5e1300, 0x7074d564e1547f04, 0x7d3aba794dae7dcb, 0x6bc696f01eb600f2, 0x0a9896a64e921691, 0x24a4492b8074d6fb, 0x894591ec863875fe, 0x10130f2e79503558, 0xc0dcec0b3d9ae708, 0x14a6ab3f3a309e60, 0x1f66eb8df4e094fa, 0x71617339f5f49c4e
+, 0x379013c85d65671a, 0x0a98f320c066e165, 0x3462de4276698572, 0x28f6d7816527832d, 0xdd6b1dc5da8cce43, 0x788a46cd018d04e8, 0x592f5d21724dd742, 0x7f1d4fd764d73e13, 0xdde508fc94071244, 0x4f39da7a80d79b25, 0xce14b9b8bfabfa40, 0x05103dce983312c0
+, 0x6247dd82064ce3c8, 0x3a970d1ed2ede9f7, 0xcaf318b8c000206c, 0x4a1f29c17b4f3b0f, 0x984de88f4b3f4a4a, 0x0fa095165756579c, 0x0e33c5984955b95e, 0x3f52a69915b4f089, 0x3f8f56b7eb642588, 0x2354425f2fb51a13, 0xdf675342440e42aa, 0x7d8cb1765ba4aaf0
+, 0x3a7f6bd0eddea383, 0x214c89804e6f5ede, 0xf95550a207a0a121, 0x3cb9dea6d844ddee, 0x22b2f03ff887c015, 0x0d4541cd3a0597fe, 0xe514283e506cc707, 0x02967e8661a3acf8, 0x5c7512733f80f82b, 0x66e4a3b05e89eb75, 0x61b15223eb950921, 0x5b26262fc72dff40
+, 0xa263fe09838bd03d, 0x67c9d205b6707465, 0x5823d3fbc68a388a, 0x0c793feeb593f92a, 0x674511a861ee513f, 0x623cb12277d83fff, 0x5776f5a0d9f916bc, 0x312a7791a2bb9379, 0xc68acb3be3e1beeb, 0x7c2b8ce17d615e1b, 0xce9ec87104c39107, 0x3fc40bb1d48900a3
+, 0xeb25756cd88ad99e, 0x57f2f7c59610c282, 0xf59eeb422771fe29, 0x4e8a2f4419526433, 0x1767cee77c2e56d4, 0x7b5a67e8b772a094, 0xf2764ecb164fd6a1, 0x45873cf2fc60a24a, 0xbaf61dd7e4b38a48, 0x0c2af9d71360a11d, 0x2b4463bcf4d8d1f3, 0x49ffa6d0df4b4bc7
+, 0x389321375a9e8b14, 0x309c360acbcfd1f3, 0xa4292bf6ae84942d, 0x3498bed23d233f3a, 0xf8001a7d15e1c2d4, 0x7fe05b7356e42030, 0x056c4b7d0560e393, 0x17131cb2d84a6d14, 0xddb35efb50a87c66, 0x32a41979ac61d161, 0x3c55aeb89fb03ac0, 0x54e0a7369567f313
+, 0x7776184562e6b50e, 0x1e7b74735204c35e, 0xbc3704e0b4c0b427, 0x0efb4c9ec4c1f057, 0x44019a2d92386591, 0x05d845e096b77230, 0xad219d26ebb227d1, 0x00b195e45e8d8faa, 0x2b0ce26847469e51, 0x1e7b23033edc8f90, 0x467d9c79ac0620ee, 0x7c1f167a41b8c097
+, 0x1e7fe0e7559a7955, 0x2eee8695ded3ece9, 0x5fbeac53f5e65d58, 0x7a4f73a3094c46ed, 0x67a3a592f7b5dc8d, 0x346db83e75670a16, 0x9ae3fbe517848ba3, 0x2c44c0f4d0129ce2, 0x74c9026564d84827, 0x21f6d6a5edb2ab9c, 0x0daf69403f60fd94, 0x585b5bb7aca4c8de
+, 0xe25524c98a9ffd09, 0x3de50abea6b88519, 0xca9f369c14245ac0, 0x734d822f6a26734b, 0x5bf4b3a3d3349c5a, 0x1c455fe359c40864, 0xa43b87ecee82fcf5, 0x4c3c48bc27730918, 0x2f215ecef49fa901, 0x0478f3a2105dad2b, 0x15e90959144f5a60, 0x3970673ed2bad357
+, 0x370509fa6d9ac659, 0x63a8e8954ec0be8a, 0xd4fbc4b0c5e2f051, 0x61f85a16963c1de5, 0xca1a957624f6baef, 0x40965726c32f5bb5, 0xd306358e9b7a7ee8, 0x564c3f1ced165145, 0x15c498e75cc03566, 0x4fc92292f00db3d2, 0x963d80120fb0df7c, 0x79c1e54694d105c9
+, 0x374d8d411e924824, 0x0f5881aadd60723e, 0x041ee65a086da367, 0x2d1eb1a2ee3dab90, 0x1d6f4ef93623e0d9, 0x0b04b92ec7523fbb, 0xb6b42a1cf3fab51e, 0x0a9e2150e2ccf666, 0x3bb5d10249820113, 0x5ef3aac00fe4759d, 0x22bda866f7e6aaf6, 0x39a8824e02b28edf
+, 0x203ce8ffdf30a4b6, 0x5dd16137db42048d, 0xb4b1e3fa1a548e38, 0x0d195ad50b9080a7, 0xb8c3d61b901a3c00, 0x78f0819e4cc2fac1, 0x0614e8f99a6b520b, 0x33b7c971dc7aab63, 0xb1287924162a4f70, 0x52ea4365d0d4c24c, 0xc19830a3dac4b36b, 0x2f0c50f8ce98a9f2
+, 0x423b87a95d1167a4, 0x237160ee8e47539e, 0xff6cbcd57a8e66a5, 0x1054567a24d43039, 0x3554e2eec53cf89e, 0x1ceebe03be350185, 0x79aca9720c3c1ccf, 0x60a377ad9a2a4adc, 0x331e2bbfeb6896fc, 0x529b6e7892d65f60, 0x2de25d6386d2f02f, 0x35582d49bd719701
+, 0x3c83d81fda8e796c, 0x22ee4941ad71c9ee, 0xd97b16282de0232e, 0x629f139b981a9a32, 0x28f5053797bf570a, 0x3303f7e448650d84, 0x21722cedd2e78d5c, 0x7caa99bb7dba18e6, 0xb82a0181aefef6bc, 0x5a277a583e494b1a, 0x68e6b80e182c098f, 0x15883e114abdf029
+, 0xa5d92512a7efdb5a, 0x42e112b2df11ef6b, 0x9fd0fa9464162afc, 0x0de0d15a64ad6e68, 0x83aa927ac7deedd6, 0x7486cb90b8d8a781, 0x99a3680c2c1a32c9, 0x42130745b62e6095, 0xe3f228f51946bcbb, 0x0834bb884cee1ef5, 0x0f8a9dfb3099ed83, 0x7cde4af466ae2f9c
+, 0xdcacd0bf3017e1fd, 0x15caad82b9dc1a75, 0xada87fbcf0789084, 0x1f189b65c3efcffd, 0xf01ccde9acef6422, 0x13f7c96374303dd2, 0x3fbfd79b67edf64b, 0x6e50baa0bec3968c, 0xb1964c544699be74, 0x6f3fc2f1c131ebc8, 0x675cf297bab4ceba, 0x500e22e741428a0c
+, 0xed2676f92494db17, 0x4549a16d472bda3d, 0x624cfbebb7c0990c, 0x75ba0ae254f5a5f2, 0xc6c2aae45d15be12, 0x1ea4807b3d840b15, 0xc4e60e48f7081018, 0x0b5b52d65f86bc44, 0xfced71759baa3fda, 0x41995c301cd3ecc1, 0x9fffcfaa09132166, 0x3beb39a4f8795edc
+, 0x7bddc120c23a77b0, 0x086c28e5c0c10552, 0xfc7bb21194b2ff9c, 0x2f5787ce8049c487, 0x3c478ec48fec0d9a, 0x7514d7e37f7b0e8d, 0xddca2b02dcbf22be, 0x70b78ec3169a38dd, 0xdde9bffad4b5a170, 0x2f2c801573f14b3f, 0xd5022d986b111774, 0x10627d919b0a4536
+, 0x4a316d9e8161a6ce, 0x00cd0f5dc76bfab9, 0x661d1ab56d8586bb, 0x67ed6ad0c164c3f8, 0x02702a01987b4717, 0x4710ad22ba05a13f, 0xe8d90eca51ac4b31, 0x22dc72b3be33d97d, 0x22a9720e2d703e9f, 0x478b2fffd75efbc1, 0x737e0c11a3b31cfc, 0x4113fdff5ce3b059
+, 0x3eb2303770a80b5b, 0x5b08a98c6fb6f704, 0xdf352a5626a81abd, 0x4b182f9b4677bec7, 0xd9e3fdc81da0e897, 0x3808042d75725fc1, 0x96ad719ae6c90c21, 0x1be74899ad1d9283, 0xf11f50780001ee8c, 0x07d06d5de0206f7c, 0x66fd3b9518f0a943, 0x5ca4c574ea9af34b
+, 0x8443b6bc35da6da3, 0x24c279e382cd62af, 0x5b91d35d74beefcb, 0x34ad263fcca8021b, 0x113242b85d6f6020, 0x23bb104cf0c31cf7, 0xe06409a1af2064e6, 0x5b8be7254f41bf07, 0x975ce3a52d3a85dd, 0x010c9946713c220a, 0x5638062bbdc0fcb4, 0x587756ad310c0ba2
+, 0xaaa1e83fe1c076bf, 0x7a22a7b4aaba1b9d, 0x655384f4f5ae2001, 0x111f1a4939741d0c, 0xd3045989690d7074, 0x09a4c2e207e2707d, 0x9d0d7168ff94a41c, 0x1345b8a96a9bdc0a, 0x388f9a37bc53ea06, 0x53dc0c98e563976d, 0x5edd5cee3d838f30, 0x1fc169e9e9629b1a
+, 0x75bc3ba550b9ab51, 0x656c27fec4564b68, 0xb54c46724dabc2aa, 0x3cbf237e229cb3a2, 0x80584769552155a6, 0x3ef5c857ff7bc1d0, 0xe00c54604c4e6768, 0x43c5dcc14e805663, 0xec65a429d223a42b, 0x2b86e610f7a4b06c, 0x0b3d477800f1d1a7, 0x2a44125b6e5f87b0
+, 0xaee04c64f2f0780e, 0x3cfb6dea1412e1ad, 0x8cf545c53f22eb93, 0x0e3dca30fe4a817b, 0x0a0f0646e0d0b88a, 0x1dc4e132b2844385, 0xcd80055df44e685b, 0x67697ddac11cb6e4, 0x978399d50afee64d, 0x59817e867083b7d4, 0x41c0b04d7bc293d3, 0x65bd10de54794138
+, 0xbba4207786adb65d, 0x4fcd7614eb81b12b, 0x6224c558ac866a18, 0x3bffb60b25123b42, 0xac15ca762fb3b5b4, 0x03ed17c63d70e840, 0x13e724cbfd02f4f5, 0x5e2ce91293a818cd, 0x066475cfebefbd6a, 0x5a47e18651de34d7, 0x86065e30e79d2e93, 0x5a83aa94c2950256
+, 0x702b168a5e44cd05, 0x56d42fc33e39a59d, 0x3e0bb32ccd9a2492, 0x0f6beb9f650905a5, 0x294fd9eb03e71134, 0x0ed502e42de89ce7, 0x2f08c42151d5ba0b, 0x0e47e25a422a3388, 0x35cac582afe131aa, 0x75603e13abe78ed5, 0x0ab5b6c9fb4bb78a, 0x0c2330e39bd35f74
+, 0x148e6f416cb9e0eb, 0x10fb0c009773732e, 0xb8ae428290885aea, 0x73ad17feb4f06822, 0x2689594c05528131, 0x574f934673da218e, 0xe1d5e84e2bd69b7a, 0x3fc82b61a46b63b6, 0x04889691b79ba3b3, 0x398d0890526b9278, 0xe80ad8a2bd09bfc7, 0x64c3e1cfc944d248
+, 0x8c7030e8ab4e5a40, 0x4a8aa5bb0885125f, 0xd77e2fea6c1d8e84, 0x61d5db6d4883a67b, 0xd098461eae890f27, 0x7064c9de21cd0f08, 0x74588748d09cc933, 0x1144b451db712ae7, 0x5fb7e9d9425f19ae, 0x2ffd742f9fc95ce3, 0x8bc6cca611a528b2, 0x00b4db6fff33c2f0
+, 0xd47da46b2958fc43, 0x62b8f6c8a2dee671, 0xe374274378d8c293, 0x2210f8a16f8076d7, 0x78f52f71fbbc9abd, 0x0f29c234027c02b6, 0x6810d38ea8291685, 0x46aa6761cfa73171, 0x7e33073bb44adeb7, 0x629db902e3d54f6e, 0xf14047046419bf7b, 0x6dbb9ce12b627e84
+, 0x2225f2425a912ec7, 0x1fb5660c743426dd, 0x44de2dd8b15f8e9e, 0x62a8adedffa4b6e4, 0xc8130ca8cd27b2a2, 0x4c7a1445fdca8bb1, 0x7e9fe7d17682115c, 0x319245b09009a47b, 0xa8c19dbc9ac9df5b, 0x268d70837679e221, 0x8a34da4ee0401b6d, 0x63bde735fee515d4
+, 0x52870bb171c59be9, 0x5eea75eebe1e4c3f, 0xc3f03d508a91dc72, 0x1e9f3f00a5f19bdd, 0x2f8551c669776852, 0x2ebf6cf5d1a11f0d, 0x8ea8a7fd21ebb544, 0x25570ea4410f20d7, 0x169307202d4f1036, 0x0997facbbefd1396, 0x3fcdb7b6fe993494, 0x783c0c33119cf700
+, 0xbbee2ab9ebdfa15d, 0x29181b0e4f62caa2, 0x3aca5aad7166704c, 0x67536f706a56b0db, 0x480b6720d8a05722, 0x5c7d1a3e210d6e1a, 0xfb3015af85701ef1, 0x724247851139af98, 0xc4312a2254650e7b, 0x45ad01a452c59e01, 0x0166affb206aff51, 0x6fe936bc5c7b1870
+, 0xa3215efcf2979fc8, 0x4496523d88fa74a4, 0xec4b441a9b388ccf, 0x0adac47617debefe, 0xbb29f15ede2898cf, 0x38f57abe2e5410a3, 0x05a2c4b3f3a42c9b, 0x120b0b16ace909fd, 0xa0edb25d5792b22a, 0x105000b02bf085eb, 0x95dddc2530e803ba, 0x1357a7da9b329245
+, 0x12f3523db9df345f, 0x2e8ce8820b90afcf, 0x5e54d2c9373f4956, 0x0f5f13c2c46f56fb, 0x22b6c55634c44feb, 0x78e2b68bc94fdab5, 0x557327d3a607eb75, 0x1c3421a1afd9a946, 0x12aebae0209603da, 0x5a2dc537fa1503ea, 0x627a63e293b73a77, 0x67099df042cfb1ff
+, 0xb9af772eaf8a8f7e, 0x311d5424872a4892, 0x843f24824f7b98a0, 0x22ba779ca3de0199, 0x998e6a90625da078, 0x70867ea98c184bdd, 0x750ab728712d7e20, 0x3354677546433294, 0x978c6905e7021bca, 0x7347a9f95fc217be, 0x387a415bcfc98421, 0x5019ed4fe7d32882
+, 0x4431fb315ded4054, 0x68cf2afd089baa06, 0x14280d177bd546fb, 0x21c00ea84fe0543d, 0x1fe5ff11f0382b42, 0x577ac744a93c8649, 0xf6589d80637d658b, 0x2a6bd1ace5ac9816, 0x05ac90c2cf9b3f06, 0x3605c782fb4c70e6, 0xca14d815dc28a09a, 0x15d1271c350fd8e7
+, 0xc9d9865d9daacbaa, 0x4a4bbbcc4b3dd9e0, 0x584406e29b71696f, 0x44fb330dced38784, 0x9d4a1ca0c2140c88, 0x73ba23f780abcdab, 0xb3db10b715e47634, 0x63adefc2d7cb51a3, 0x2b341a7db12ad730, 0x2eeb13ce0a8359bb, 0x20b3e74f0a52209c, 0x5d2751e834edf632
+, 0xe19e3f47adfbc864, 0x508ea101d9f15fea, 0x0a90521099552ea5, 0x5e0c78fe1fc64321, 0xa701322b8623af07, 0x02406d630da6406e, 0x5a6f18a87c7d53af, 0x075dee250481febd, 0xa6635e248fc9ed7c, 0x3ecef5811d276b32, 0x2b0dac8c3949a180, 0x1f17767bbfacd81f
+, 0x292aa9c5ce43ce2e, 0x0e68491efb805a64, 0x1b916c8b70e1b168, 0x63ee074de83a5f75, 0x00c0afeefe1ec9eb, 0x2b0357e5dbfab616, 0xc01303fa5716fdc4, 0x39e54b925a9629bb, 0x0b9d6ea21f17f513, 0x301736eabb7cd0ad, 0x79527309f54886cd, 0x6b7d632c6ac95c29
+, 0xec92b34738d6e9ed, 0x5f12f2c37f939519, 0x9cfe95e8981f2fa9, 0x415e841d19014c56, 0xc63d162e18b70f1c, 0x2298118bc731b6b5, 0x5a08b84ad86fa408, 0x3d877a7ed9d595b0, 0x568275ae4e46905b, 0x43dcda5a010e0f76, 0x6824b35ad82322ed, 0x28f94c673df8a65c
+, 0xec6850e31e490bb6, 0x7aac4c88d3c5ce20, 0xa4c611e755ce22d4, 0x4f3037c0c1a101e1, 0x0c1b6b69c0ff89c3, 0x34a7c2965708c6ed, 0x71f818cb47d265b2, 0x3baca305cf0b6d92, 0xf1541f01f5d56025, 0x2466dd13cb5210eb, 0x336b8a0963f61a0e, 0x300e55a0abb76bfc
+, 0x212437a242fd2bc0, 0x0d3f1d2b212a04e4, 0xe0e168be7da6becf, 0x21a177f1fa2d3b6b, 0xb055ecc557520ef7, 0x523b549c76c6c54f, 0x745cd02ce492da62, 0x66841edf751274da, 0xc6e582626fa08801, 0x7223541e926cf5c2, 0xa6c01b2f02352dda, 0x2a04030cde006993
+, 0x750b7533b96ca647, 0x5fc178a955174c5b, 0xe98228d2a8c75626, 0x1f252e813aacd524, 0xb5e862cbbf079fb2, 0x1d4cf3943ff465f4, 0x5d4f653e9c2f3e7c, 0x0241415bffb0e83e, 0x7f1fbfd050b465a8, 0x25a7a3495d1517e6, 0x0fcce4f105d00c9d, 0x087d85a6570305db
+, 0xab3b2ca6a97dd5f7, 0x3d1e94f91931dad3, 0x3df40692baf7e483, 0x20e46856aa422674, 0xf5956c399491295e, 0x6ce351f87a954215, 0x9452c4784828bf3d, 0x5a6e91b594c050a8, 0x7cb6924de450c248, 0x7b7e92162118dc03, 0x9895c12e5d68abc7, 0x10c5a49a31adf4ee
+, 0xcbd5cecc9aa5ffde, 0x6dbff6c60282b9e8, 0xda9fb9255157cced, 0x3627df7e64c9e853, 0xeeef220d5f216bc1, 0x3ed46571ab9ad728, 0x2f7d6b33a14cefe0, 0x07c932cf42986f72, 0x118634c8b234d34a, 0x359202622328f91f, 0xcec8cae9bbc1480b, 0x125d0a6f0c76e584
+, 0xbf0d701057db44c4, 0x00f9a08b98d7cf23, 0xc342a1c7e03579d4, 0x1f34594861a3e3a8, 0xb4bb5bea7643cbac, 0x7678ee2c7c71052b, 0x3dad52217ee63942, 0x651b11de50e2ef28, 0x57198de305ce0e38, 0x10abbb78cc6226e1, 0xcd11606de4b1d0b8, 0x3db3a79ca11f47bc
+, 0x467acde791ed99f7, 0x28b749dadb993f2a, 0x07839480be035ba1, 0x08b6097587a2b1a4, 0xb2aab79de96b3cf9, 0x0d14cdd8b25dd576, 0xad1bab5d11fe2683, 0x228877694ad342fd, 0x73e842e39a02cf84, 0x229e56434fc94082, 0x4bca58d5d7f1e00a, 0x54c1efc009ef9bee
+, 0x0519025d650616df, 0x008b15c1733654ce, 0xac7b622bc503b775, 0x1553e7ce50d61ff5, 0x304cddac0ef81166, 0x3c84dc032c8a2469, 0x325cb8b4bc1552ed, 0x3059cffc1db7a948, 0xe64f6cd6ab509289, 0x1d561c8146424865, 0x6a614356ecc78fe0, 0x7a910805f6267f43
+, 0xefb12cf42b677bf4, 0x18a69cc91586f6a5, 0x843852e85790c03e, 0x3b49aeaea065ee09, 0x73edc5841ac0ea94, 0x6f2c2ed2365c77b6, 0xb81018272e67b881, 0x7e3fd493c632ad24, 0x1eca72c714e5adfa, 0x57ea72198fd219f7, 0xd9b3049ae86fb1e0, 0x767c2f81c2eca62c
+, 0x438121eabfdd269b, 0x5f2c5244a8a2ad6a, 0xbce045eddf10213c, 0x25e7ae53aada6a2c, 0x99cc28039ba9f48e, 0x753045c8458d2a81, 0x55475cc4adc6bf39, 0x6b11793b3fb47fe4, 0x5b4f3894390eea9e, 0x6cd2f19ba2c50a55, 0x5cbb59d4b10f5d86, 0x559a71e89fa9f7fd
+, 0x2421a701264c487e, 0x3ad306d58d62cfe2, 0x7095354b4349038f, 0x505f8a5866220651, 0x7a8d87f68bb54abf, 0x3405baa84f5aac5f, 0x2b5fc64c3bdb2049, 0x0f592f78c7f96dca, 0xedb4b3455196825e, 0x6dcd6006adfcf115, 0xd03c31a42f90f9ba, 0x07c80b99a8fca111
+, 0xc02f2680ff7c0267, 0x6b6d059c945d7fb3, 0xc85403c1ee78ff9b, 0x4f79bfda570519de, 0x59f26988414f2fed, 0x50ec8deec85e0d69, 0xcf3dd6213c6a9030, 0x1007b02d298bae84, 0x8aecba2c26af6cf4, 0x522d76e2a9a8849c, 0xc270bb16c7aa8ced, 0x30378c907f8b9661
+, 0xabf5b515972e3e39, 0x13351fc00409e366, 0xf8158a83a715bcd1, 0x1075efd591d3f71c, 0x615a497530748d76, 0x68cd900e60cf128c, 0x3188311b9cf90bce, 0x3b62f5a4a657e89d, 0xa70c8e00c9de4687, 0x2b7c08a78eb9db78, 0xdd51b94bb90859f1, 0x599630161c92abd1
+, 0x5c9c85fe5b2c2d2e, 0x648d5b2a694e2993, 0xf57ee47d57034a52, 0x0f7dfad345ff1582, 0xa227aa6ff75c1967, 0x7b43760086b987a4, 0x60a5d68efb497317, 0x03f881b82276c8a5, 0xf3f4da0164ddc65b, 0x43493d9a6bfaca58, 0x2a1d10426ab3a363, 0x1b4cac2dfed5d1b0
+, 0xa5b070391ac1eca4, 0x4a270a8465445368, 0x5410d3b1fd13b57d, 0x4df5aa1746696d13, 0x2d23c4c98453560e, 0x0177d8b3ba8cab3f, 0xac8c2530257e63ef, 0x310d78740fce9a89, 0x8d8c4e562e76d358, 0x4d74490377dbbec0, 0x52e9dae912462f1d, 0x49be8fc4840b7869
+, 0xd9420113c850f9b7, 0x5eb3bc19c8251ecb, 0x46bb57e6ec7c99b4, 0x35451f80444c9711, 0xf3cc30ec44be9966, 0x4db36725283dba09, 0x5c61d920f12857be, 0x7a45c1e09f30b04b, 0x8a53a738f6a98f50, 0x6149931e42307174, 0x3bf2fd42c80b97f0, 0x5a23880bc43376d7
+, 0xa1a27464a926405e, 0x6984d079c4cbfb69, 0xe7837f06f4cd0fbd, 0x217d332f787b5ad5, 0xd572cc1aaf6464d7, 0x717f8fa8a2c1d36e, 0x8d709e58bc8ee44d, 0x11173ea84e0da76f, 0xfa7b291b4460fa4a, 0x0b6078ee858d5556, 0x706e2cf2f0132753, 0x4d2dd09afbe33b10
+, 0xd1c953c4829f7f89, 0x46be94ee2f3f291b, 0x7c78a37e1e816d6f, 0x3f694bde3a2d4dac, 0xe5af1f197accf019, 0x6dd49c1b6036ec20, 0x74912b774f6a042c, 0x620541021b9873e8, 0x9b72ba156a926d84, 0x3885829598a8951d, 0xb2c9134fbe03c08a, 0x3c02c43044a9e4bc
+, 0xc813ce182a1427ef, 0x45d3f6276e147fbd, 0xb646723192405436, 0x0207404101bc728b, 0xf2885cb5b3e2508e, 0x2a061d41ebf7c2c1, 0x683624d1886c3038, 0x1c0ace954325ccc2, 0xe5a3f05c2553d5bb, 0x4f57b9e6cf245121, 0x524c477812485c27, 0x0b6d89954a61ab24
+, 0x01358e79b71afbe7, 0x2710d62c813b58d5, 0xa58ba5317c33bc94, 0x590f933e85f287ea, 0x35667e8380750859, 0x6cc7b01a2fcb8605, 0x6ccfcb3b73a0ff13, 0x4820cf726240611e, 0x93f862efa1a6806e, 0x173e74626ef6318c, 0x34205f9c21c690e7, 0x38099b40e2560b5e
+, 0x068aac4b0dba261f, 0x17e413dbee0c0bbb, 0xd1331a9d83d46d1e, 0x4fcf8d3c43f0f40c, 0xace49e23d2307715, 0x3d0e32a05be00978, 0x0a7a8f5d3a11a22d, 0x62ab52df79c30ec7, 0xe13d5af0af06bf9c, 0x701da52a78e63f73, 0x6f8a118a9b92fc7a, 0x34c297ba44071199
+, 0x3dc1e3f2050346d6, 0x097c8c7abb7a50a3, 0xc9b350c9140c52d1, 0x06dd245539cf7008, 0xa0c55b54d55fb102, 0x05f11ad38877f602, 0x7ddbeb2ff687d74d, 0x7e34591b0834493a, 0xf5db46d45ad66426, 0x6e7261f047124a44, 0xd52f56783a9f7c8b, 0x6be65a19361543de
+, 0xb4d8404e0c48b3a2, 0x543f86cb88776f08, 0x22dd24126be356a0, 0x3d306caf597e9499, 0xabb4dd273c91e3fa, 0x273a5136d01e2dcd, 0x84a8604fe6c166ca, 0x29caafffcd0b0398, 0x53ad165ca51d52ec, 0x50b7d91892a69689, 0xb934c1d2a183090b, 0x2982482e0e2c9240
+, 0xa1198f4da9a30299, 0x4ac6ebc5b9814676, 0x2ac5284d24d60202, 0x07097286f637a7d4, 0x87cd86530245e43c, 0x5ee7c78f63410628, 0x68e085ce5502343f, 0x3864885aa529617c, 0x687ccc063b736597, 0x57dca8230c3f2bc7, 0xbc432c74448036a2, 0x4d4efdcce30e7b83
+, 0xea54c1eaddbdcb7c, 0x51b50688a16482d0, 0x03077ff082940ba5, 0x746e37282c271838, 0xc04bfd6f6be17778, 0x2cf3afd95e59f918, 0x39d2f5e0c459a07d, 0x7a09ec6bd67abffa, 0x0fa42470790cdaa9, 0x13205be6c97d6b13, 0x6628224820efc5f0, 0x7fe43efd82ae114e
+, 0xbc627fd2006f606c, 0x06c40c6474aa46bc, 0x512ffefa484188e4, 0x7f3c301d4a5da15b, 0x2e230d2aacb9f8a1, 0x7dcb53d3915eb889, 0xe0d656b063ff89c4, 0x30e96b2fc0b3f075, 0x85d49be016bb405a, 0x5daeed855b9a0eea, 0x549a1cf6b1c02a5a, 0x13a5a2db2080c558
+, 0xc7a333533ac34441, 0x5324896c52bf24cc, 0x4720884c5f1a7b02, 0x657aed03091d7a4e, 0x61720e06ea69f47f, 0x709714b691aaa3a1, 0xaa9abef895f88b40, 0x05c00e8d27695fb8, 0xf8081a97352cabaf, 0x30613f87dbe795d0, 0xb3fb0569c618318a, 0x59e592eb0b2d2caa
+, 0xe7125263bf03bf9f, 0x3616d1df99b57444, 0xdb69c83975f8bb7a, 0x1134b2abbbb9f70a, 0x49b1c3b500c9e8a8, 0x15fa73cdea72e216, 0xdffd4ccdc47fbe92, 0x4e13cd0477af22f7, 0x97e9ad6acae72cb7, 0x24b337364587117c, 0x2bef470a5c5bf499, 0x79d5e1f8dd99ee8f
+, 0x0175c45915c2dd3b, 0x1d10ee9913a81474, 0x37c24588181bbc16, 0x69ef511614fe2b63, 0xf5d5e0a5650b2249, 0x2a2925244ab41215, 0x51c9314c69d92ae9, 0x61dabc3b1035ef74, 0xdd68ad2b8e4a5bfa, 0x1de5a443239a3aa3, 0xc4046be5ddcf8883, 0x3ce66492d7ddf818
+, 0xe675ad156c1e4618, 0x53ad576f26f4efbe, 0x9c428d7ea1155bf1, 0x296ae5bc4e0d87b1, 0xb65f5b2e44e758e5, 0x433079930ae82430, 0x59ce9302a6244cad, 0x48a3d3432174eb04, 0xb9f62341c8112c66, 0x7535145effd1ce4a, 0xe67ca2e600c3ed86, 0x3a66ae35a2528f3a
+, 0x85eda03acc47919f, 0x198d3acc868b9a52, 0x9f8439a3fd8c48b3, 0x1f4704a867131fbc, 0x3575f439d912c1c0, 0x2ee520859eed5e6f, 0xc76e4153076f76fc, 0x518c9437cee440f7, 0xaec398a7ad4094f3, 0x74393f90793804e2, 0x0f35d4c614710314, 0x459f09998a92e4ab
+, 0xd4394f04672c537c, 0x3ea7a2b1abe6c2e3, 0x06cd7b33c69fff57, 0x194acaa0a915a92e, 0xd0dc8cbd8693da12, 0x73d058fb5da12f6a, 0x76780509db56d631, 0x56ebe862476afa37, 0x169b2e2136732589, 0x5fd5face5c1ec9f0, 0x43376c13a252f64e, 0x42c3ebc8fdf63efb
+, 0x406c4944ab2b85f6, 0x7d50ac5dc7d22ed6, 0x00f3488697e8b6a3, 0x2b6efe572af9b8a4, 0x2df141c3ca589597, 0x037ced85bfb19094, 0xe0c2211871a2f303, 0x5b1bedaa5ea50c2f, 0x031163247dd7f02e, 0x7ae44de93bb90038, 0x6872964a48ac808a, 0x1167c762413305b3
+, 0x77623c5e6855d991, 0x4868cc16a20736b1, 0xccf9bc5721e242af, 0x65e67b35b94d8a92, 0x4378cbb31f880e72, 0x1dbe2cf753c37670, 0x8657550b458fb292, 0x01bded0ac806152f, 0x6f493771eb7b6b14, 0x345ca8935be0a231, 0x9dbf272aad2bbc13, 0x6e210e8e381aeb6e
+, 0x45900400a69bb88d, 0x41e67e120c262125, 0xdfc20ab3dc438bb5, 0x6b3f73f4b1024ee4, 0xd9203af9c13f7e17, 0x68a017778d783658, 0xefe9669b3a3c5c57, 0x5ae80538b093ae7d, 0xf5bf198f6cada5ee, 0x33774ca5f70a9862, 0xee39f982beb78a4a, 0x48edc86673e32477
+, 0x5997dd7fe46e4621, 0x5066d6dd07d58eed, 0xe259aa27239cfd97, 0x4419fd62c5ea9940, 0x0399d5748533767c, 0x23c50bffced29cee, 0x7db583f156aa9f6b, 0x009faf0cd620e7d0, 0x89bdeb45b042a14f, 0x30a4b37407863d18, 0x374a2cc56abe9c43, 0x0231b0490ac4fa3f
+, 0x58aaf19be73b331f, 0x23750c0374ccea6a, 0x85a54383e3c2b774, 0x78ba9c5e7acc11e5, 0x0594327dd69066a7, 0x2964852a3febdfd8, 0x61eb5df5699c49c9, 0x41b9cc9fa18c4324, 0xde723e5832ea64a4, 0x7998f5f1700711b3, 0xf4a72f78569bee16, 0x08149f70b67747bd
+, 0x9388de3e50b54826, 0x4b4acc1e527e325e, 0xab6070ecc328dd77, 0x3b244fe6673cd347, 0x1392eb73da10d76c, 0x77ea8bafa6ea614b, 0x5bba1a149a51d710, 0x58bf2f2ab4ff2149, 0xbeeb7c713187c9bb, 0x7253d8373cb68f96, 0x6b1d1642d8571673, 0x5f78a2e169cfb761
+, 0xb14bc14166183ab7, 0x5d364e79c08044c7, 0xca3f675e96038dbc, 0x40a6107a879a8268, 0xbdb001323c72140f, 0x7c5701975de674b0, 0xbcb4a7f6a0118731, 0x37ba7dd031185453, 0x631c6bace575ae06, 0x638e4a1e9a8a1039, 0x3634a7592343acee, 0x0b5dc4cfcec882e7
+, 0x43995e9432d17565, 0x0cee4306c00433ae, 0xf6bda416299fbb04, 0x1110a63d80314b6e, 0xa05822453cd33892, 0x03942ee39d982562, 0xf69f4f18380681b0, 0x7b8d285a7f4ff979, 0xb45a49738fbde2c8, 0x116a536f028ae7d3, 0x7328b75b9126aee1, 0x45e6e3819891c3ca
+, 0x350367712c6e828f, 0x59b047ae026f04df, 0x761a7dfcbae10a8c, 0x517a19b63bd7e036, 0x458f76797e317cb1, 0x4e00b0c713227d89, 0xe882670404d12211, 0x4c2c5ba4d69d385c, 0xa8464acf7f6d6618, 0x7665b323033a47fc, 0x2e04b9f08febe02d, 0x2ad4dc240cef8e65
+, 0x00d0b1477a8d50b7, 0x4ed41c4514e25567, 0x99c30b92a40ca920, 0x11679e25a6a91fba, 0x608025df367bba56, 0x727dc4cc32e7fe6e, 0x0ac283a691209aa3, 0x419cb853f7370dee, 0x4ffb8b6b379b33d8, 0x0dddce7c88cfd43c, 0xc1f4642121be8ba7, 0x7faf656da96f0a20
+, 0xb1d0cd21b9618156, 0x7e0e04221399a603, 0x3db30e8abf2de6c1, 0x035e54bf25fc6d53, 0x187eaa3689d7348e, 0x7b72719c570cca1e, 0x0ec75ca3e367e8fb, 0x258244e63420d4ef, 0x3002852237efbc0e, 0x55625b33d3007012, 0xcaa5af473058287c, 0x45fabb9561fc8d77
+, 0x87bb9caefa213ad9, 0x4a83ff75f64e4bb8, 0xe60f6ea5b117d7f1, 0x691037b4114b2fda, 0x9eb799d32b171a95, 0x3dd78dc391b5e515, 0x6622839909d84109, 0x2f3029612fe7cf1b, 0x8a36d823750c1501, 0x7a4aad3a00f37804, 0x68d5a419a99510f6, 0x2b4f715a84fb8096
+, 0xcdf21b5e61138c8b, 0x743ecdfe0ee78ae9, 0x26575296a8fb6634, 0x4f1b5d702c7c8444, 0xdc50a83008463b17, 0x421a39968d4ff7d9, 0x3c69fef2ea423f85, 0x1e097c405dc426f2, 0xa4704202e468aaa8, 0x49b6180bd5d10d63, 0x833cfe866a76eb63, 0x034c12a4a3fea75c
+, 0x40d5210802e61b4d, 0x74adf16bcb3ac6b2, 0x7b340241bb6ad809, 0x65fbb20a581ab145, 0x62b617224957655d, 0x7c9f208b08786157, 0x6e5cf57d1242dc92, 0x401fdda4fc9c50a5, 0x858bc4a6ab5d236a, 0x0c7b493f056c4924, 0x4dc96c6a3563e0d6, 0x27b1ccc1df6ea1c0
+, 0x7614cc0a395b54c5, 0x298d3ce56b4e864b, 0x734f9cc92e8e7600, 0x3e2654baf8a51984, 0x2e1194b2f3de4f23, 0x48b5e1d1d52ae0f7, 0xf1c2cd16e61c5245, 0x17e20cd798b73c98, 0x02286df199306a3e, 0x45da7ca0b4ba0de2, 0x0b873c9c70dd78ec, 0x0cee0fd7b6bf6822
+, 0x1900a6ebf7eb34d7, 0x168e6dd5312dc9e6, 0x44a041e6f2cafcf5, 0x62311eccd6cf4b0f, 0xf5e014379b8c4853, 0x73d8496b310406f7, 0x0a09d45fce281e8e, 0x78e940f2346a7877, 0x19ca667a2d48da02, 0x5cb567febd1f5d37, 0x784100ed78e9c79a, 0x382ad480c3c1bdd5
+, 0x56a153a5b25bf4db, 0x74b5ab10ecce8ae0, 0xa8450d916cf44959, 0x15c5c3a47d16e311, 0x150991bfe88f4dc7, 0x64dc7063d77c5392, 0xc2ce4e735555c873, 0x59cc42d01f862f8a, 0x686596e8be765cdc, 0x5e2b24c04afa9a89, 0x798262027368643d, 0x4e6fe8b2d96a62b8
+, 0x4bc47a285401f7fb, 0x701390f0a50f75dd, 0x6a4d58b93080b0eb, 0x345053917c9cca9a, 0xe073b47308b01c58, 0x20779d0fd9d93bb7, 0x3193aaaa13386067, 0x5b75d323945dee53, 0x1a9be2b6847f851b, 0x0c4793c4dfe79e74, 0x08d460a4766c49d6, 0x53bda8b09b9d3eeb
+, 0x4ecd859060fc2d6f, 0x74e511da57b3643e, 0x8e622fe5b5e90632, 0x12f8c2c59e207088, 0xbfc4b85ae668b23c, 0x072f768483aebc58, 0xca6a147f81d04325, 0x252884a823923d4c, 0xb1f295df28d22d7f, 0x7b744bfdad631c51, 0xfb6749e68f49852c, 0x2fbefe9e24feb67d
+, 0x0781dfd0a33aa0df, 0x3aec5f29c7cb5819, 0x054accdbe2819105, 0x7da595c606de0979, 0xfa89eb8f5d4e09f1, 0x38f73959d15b505a, 0xaf814c478e4da742, 0x1207fc8231020a42, 0x2bfbe074279c17c2, 0x464ec2bff5fbcc3f, 0xac185e8b62069c95, 0x5d89bc6b543dc7b7
+, 0x28da1b678056a54e, 0x4f14d2e380c6d349, 0xb843392dd05b3adb, 0x68fa5c72533f6c26, 0xe164844bd27135b0, 0x7140f2fba588aee6, 0x0f1a23007d6a0509, 0x646d4250fa517723, 0x7c2b64f2346f887b, 0x376e80785a2a0cf9, 0x9c7c0da4d2a4424b, 0x27d6c355c3978f78
+, 0xff438df757ad8b64, 0x36c1180a92baa747, 0x0ad7050acfc9a946, 0x6b240ef47aa1e44e, 0x4e63abd39e0217dd, 0x15da1449e3885b89, 0xa13ec3338974dea5, 0x31438efded9332a7, 0xdf08856acb2a3c77, 0x63ef5b3915f5db86, 0x4c8f49f080ba5c65, 0x2db8bab000da84ee
+, 0x3660bc65780832c3, 0x2186aba26ed5bb1d, 0xb993d3d6e90298d0, 0x0eded72e4f0a18b7, 0x71b09fe720879671, 0x58a03f02ddd87c92, 0x02bf9386eda6260f, 0x3662c70ff2939ce9, 0x3db4372a318ea56a, 0x28758e69d7a80733, 0x4f85b647b230ef39, 0x01c8abdd69d68c82
+, 0x2314868b859766d7, 0x492210d3d23723b7, 0xd6a66aed8737cbdd, 0x707f46ac911198eb, 0xfbd17c04ebb8417a, 0x01071a446bd364c7, 0x65454538bf6294e8, 0x437a658d39f520e7, 0xc0146926c709d0b3, 0x43b2afc81227bcb4, 0xb75af7a760097313, 0x6c78b0f5625ecdbb
+, 0x0cb3d48b9517b3b9, 0x23f2e44a7024fc54, 0xf9811401659011fc, 0x6c74ab7f8e7f306c, 0x37158e229e201180, 0x4c8b0431706b05ae, 0xab4444cde4703d3d, 0x35f0b0598bd76b9c, 0xae4ccefb0cfda7b2, 0x20022ea599fd78e9, 0xb0e6922d7d5ff04a, 0x1f8489a6baf14790
+, 0x9917b838d10a9eec, 0x2f2184a166633f80, 0x3eed33e6663f3987, 0x763748cbebf58abe, 0x177e5512aaeaec9c, 0x7b7161332e71a1cb, 0xbf9152a751355de1, 0x264c5c14a79b56cb, 0xd5df7adbd4c4e77f, 0x1c658c3d15155415, 0x8408eacb545d09cc, 0x529145afd9afcde9
+, 0xb0c58723d0cc0b42, 0x0a034794509f14c5, 0x9720ebabf7fb1078, 0x44d6a3df142769bb, 0x86f0ea8e89902ae2, 0x4a28f120e7907642, 0x7767347cfdd89c8a, 0x3807f0abdecc49c1, 0x13bd4a5d28e43270, 0x18e0008682fa790a, 0x6b0507021147b119, 0x498067dd72369b35
+, 0x7b22854d29618b35, 0x2ab9e7e899c9a308, 0x19bf5c565c9b1d6a, 0x73069e660ad166f9, 0x9347c84d4be44ed4, 0x5ab149a9d006e3a2, 0x13b0284acde8eec7, 0x78729a7b0d3d3aca, 0xee8e33a71b31bde2, 0x5d543f842e023552, 0xd857d2f56da12399, 0x2129b696f5097614
+, 0x71218328cfd91f15, 0x43f5fad4b95b2bce, 0x1fbd5930def7bbe4, 0x00b5d541160e43c8, 0xe33a55018490c6d5, 0x7039e9f266420c05, 0x0d9dbf0a97a87bd4, 0x185533fd8d3f9234, 0x91e7d29639090892, 0x29914c2e8cf9b8d4, 0x2742575aed9a9b2d, 0x05ea1717c1382716
+, 0x8a70e819a57552a6, 0x4771a5c7ffca1df3, 0xb6e10db912588dd4, 0x620c8f698964fe46, 0x115cd1d92be53fd4, 0x6fd9dafb80ac21fa, 0xfc2dda007aa11ee4, 0x729cd16390ae04cd, 0x532579ef729555c0, 0x7a8b5f487656c8d9, 0xffef296b860a97a7, 0x1da8faf19c636704
+, 0x32dbfd485739717d, 0x18f3ae5492b44665, 0x9c0844dbd119712f, 0x7842f37c2c0301c5, 0xb70580b7513e7f69, 0x6913176568a32b2a, 0xbd0c7a8e2ee7ad31, 0x1b9e80ca5e0899c1, 0x4b767adfd7ad9d00, 0x7aeb4c9f0cfa420d, 0x1189ebb7ec2ccc9f, 0x1af358a898741b3b
+, 0x599910d58d347d62, 0x0833414699c59633, 0xf27e510ac1295793, 0x48f8efc58b01c2c1, 0x437491de8d0bac63, 0x464c35c80def0069, 0xac8c12c87394e1cc, 0x05a4db38b07d8f4c, 0x5e855d6d91991e4c, 0x1c13adee4a581df7, 0x40b7421e918233c2, 0x38d3828ed1fb65c7
+, 0x376680b2f9b02494, 0x10410ef0773d3af2, 0x64aff3ff5e627052, 0x71c0f0d0e8bd17b5, 0xe76b1ce4a746a192, 0x4b59e278a3ef894f, 0x57b91084e5b6e1bc, 0x4c33c7a8083eb519, 0x1c99216e82369134, 0x508ea71f9aadf009, 0x5a6de3a077c7c14f, 0x01a87460c85b6b18
+, 0x2841770cf261b51e, 0x0152db3e9de81b7e, 0x8a6156342bf75848, 0x575ca150ec7e992b, 0xe26886ff6131478a, 0x6eddc1f84403aae8, 0x93e34f2f8780f2c4, 0x5f5f42a9b7c195b3, 0xb62f8c2698bad50c, 0x451b5b2293bd26ff, 0x9be64cef0a06d31a, 0x6a85c8ce5bd0b877
+, 0x9e7d1e93ac5500f7, 0x479aca061772805f, 0xcf009eb533f5fc94, 0x21664df5dd34a407, 0xd3490cc149d64356, 0x5e5938d4870bdb65, 0x2b976a8fdbd1d73a, 0x18c79c923f3ad521, 0x2a8beb5ee4b28c39, 0x68fad6d8b66cbb76, 0xdd407103e081d91e, 0x3a6383c93be31ca4
+, 0x78035229b27404aa, 0x4601451478bc50f3, 0x0aa2b89deb1d0657, 0x60565f8f68cfb50e, 0x5510a97e669039d4, 0x1ad77fca7aeb5e19, 0x556bdeb53d039a21, 0x7e165feffcf73440, 0xf8bcedf1c186fd99, 0x5339c58eea707404, 0xa8408c76d1c317a9, 0x7d95a73d2f4d2bea
+, 0x5cc8923b1a1724b9, 0x716d5d64069edd89, 0x79fbca15fa22c89d, 0x3db72327f764a621, 0x41a99660267de618, 0x640bb9da129a9323, 0x7d4e7c0ca0f51d4b, 0x102b6fbeed079da0, 0x418344bf54724595, 0x253228543283ea05, 0x6ca0f0cbdc93779f, 0x546984edd807e93a
+, 0x82224b6406ce22f7, 0x3fe26e1194792886, 0x39dc27fa28229e4f, 0x405f3960d3e4351d, 0x2be08685341e42f7, 0x295927da3fa53f8b, 0x04544fcf26c5537c, 0x524d6c2cd7975eb4, 0x74b3eab940a32d52, 0x100aecd541d61828, 0x6efa42384a6d86c9, 0x5736a24a97847580
+, 0x9bb3afa96db9ee18, 0x70d133766f165f73, 0x9ef50ac9cfe3f077, 0x6e75baa0ff414518, 0x9c05ee2c2b2c4ecf, 0x76318800f82a967e, 0x2554a0967343fee9, 0x249c2066fcc6c865, 0xb9148e8f3fe4f739, 0x286dd9bbf7d86a43, 0x0d2d15d41846dcc8, 0x2cd781b5ad4dfa0e
+, 0xb57eb48f4df078d0, 0x0705e4661c21667f, 0x62bb7e67a676145f, 0x379b3af849d0f5d6, 0x8bf550c8724bdb3e, 0x4f15afb9b32be01d, 0xa7c22168de9d5277, 0x2277d13e536bb176, 0xdf4b34b993ae96d9, 0x7de261997d43bffd, 0xb05295753b10d42e, 0x505ce8c2564bf182
+, 0x70ef3dd256996aff, 0x576441a729fac1ef, 0x35b650efa4a33f24, 0x13f9ee0aabfcc75a, 0x281706bf0ec11fe8, 0x7e61b04547c9f131, 0xc304270a1a648629, 0x540ef80e5523a2dc, 0x8c263bcbb7b93feb, 0x0de9c8c8607dd3a5, 0x8ff6455c27d45c9f, 0x0ea96ab7a22a7239
+, 0xd233f9438749606f, 0x2b4ffa8e60b3d7bb, 0x7a7c11996a478e81, 0x1613705b522f09ea, 0xaf5cdb142bcc54cf, 0x1065bd6d50b91443, 0x76fcf403781d9bc8, 0x649b441255afc87b, 0xb0e28955fc277d7a, 0x093509f25093549a, 0xdd60695c6ecd7042, 0x28d839594436dd71
+, 0x53b2fdb5d38889a5, 0x468677bf6fc3b896, 0xdd819c7a270bee43, 0x5678b305ab1cbffa, 0x874ae01d6de9557b, 0x3b5c4f8f6470ba2b, 0xef5cc9da2b3379df, 0x79757871a781bb35, 0xce5a568234fb2cd8, 0x45a52b1e4c5b3eba, 0x0310fbe398ebd164, 0x6731c86a7f82c27f
+, 0xf3f34bd0696ec132, 0x2eae16f697995462, 0xd3d517cade2988ea, 0x5c14d465f0fd22e1, 0x5e19711e042ca5dd, 0x23cc11fc8b077da6, 0xf7308c7b260b62cd, 0x0378aa2564769dc5, 0xe713758a77688199, 0x7b65bb0489656a87, 0x40f093da2d49e8fc, 0x4faede4573d9fb68
+, 0xae789e641f78976a, 0x472af5bcb427302c, 0x777338e4b32244f1, 0x615fd491534f662c, 0x2ea16bd668fa1ae0, 0x2b42d45d4f88595d, 0x20791564cc06da76, 0x40a160867a91d199, 0xc68880e4e54c5196, 0x3bc9830b68d4f64c, 0xa1a28e36a65139e5, 0x18852b1b10aac3e3
+, 0x45427295e12d91aa, 0x22dec82ca80932d5, 0x38adad929fa10f55, 0x53dc58df8c604508, 0x1622b792d9fbcab0, 0x6937f19569e0f4aa, 0x41b2429ebff4f7a5, 0x3e1e03ba6a2707b0, 0x2025b5d8de63de6f, 0x31ed33438e8af236, 0x5d4229b466062712, 0x0985d5799ca63878
+, 0x4209b067ba0994cd, 0x078f92ede7160f3d, 0x88dc90bf72f6fca0, 0x4b90d2a2265decd2, 0x6fb22de94e93b978, 0x244b17a008aac4e5, 0x2dab07638d53b69e, 0x63b59f6d2190135a, 0xd855f79114de36c2, 0x76c12b45b0c95fdd, 0xc5b77b9d01904ca4, 0x62dadb0a8b1d3c74
+, 0xa2eded3c20b266b6, 0x216999a8e41841a9, 0x16d2a749eaac27e3, 0x222c6f09aa739cc1, 0xe0805c80d99d6687, 0x160043cbcc6a414b, 0x08a55c2cab87f93f, 0x78d3837c71e7d11b, 0x0b43f47268fe7568, 0x14336cbbb0578745, 0x1ce15d8356f4931d, 0x244ba962ddf06677
+, 0xc39a8f9330f92939, 0x1504a5e2d9a5d09c, 0x9b3cd58c5ee33a91, 0x207129545867eed7, 0x37517a265e1ecb33, 0x183080458d04da8b, 0xfdb1049fe0affcce, 0x525eebc49c8ed3c1, 0x22121bd4d0ef4967, 0x03704db89667140c, 0xe15c6a5190dc6974, 0x77b0ef96c670a365
+, 0x3c67068839c33133, 0x6cd667d5eb121982, 0x91fa1fa391c53fb0, 0x4b51aa1634736b8e, 0x51733f89d20a4d8a, 0x36989f3531669d05, 0x3aac50bea25a0500, 0x5d852b4474f7cc4c, 0x05af4c6cf037f05e, 0x7cf131a9cfed1f2e, 0x8beee60977cf939b, 0x5c56dde10dca034c
+, 0x26b4c472a0629777, 0x4c418fc1876abde5, 0x0329a78405d530b0, 0x65f322e1cb1bec61, 0xf49be8c2913ba232, 0x0559bf3b8d6d2b9e, 0x03a1f864e30ff5dd, 0x35981313fb1b15c7, 0xbbe9f658e4d52db7, 0x5ecae99a5bb23253, 0xebfe8a8ffe5d0894, 0x39a57589170ec236
+, 0x2be475295fc04bcb, 0x6ca6d46a8391cf2b, 0x25786f756339097e, 0x56185101ba11e47e, 0x55fc55886fe06a5f, 0x16edf156aa5c8280, 0x865c80fb7d36c73c, 0x1e1a9684e52589c7, 0xb9541067632aca34, 0x151a2a6ff5c34791, 0x1b58393eb03fcb87, 0x728cd8308c06d5d2
+, 0x2ef271a01787a56c, 0x502a0ed0441cf82d, 0x5e8f818e256c0caa, 0x35685e5b032a354c, 0x2ca5d525025df68d, 0x54638e2a16773afa, 0xcc6499e6798a9013, 0x6e61b33a73d150bd, 0xdb706a4ccfc17f37, 0x2763f83e1fe53f51, 0x9e86945a33007d48, 0x0a1be208b6fc7c13
+, 0x76dba417ef4f9d5f, 0x563e716c45e94db4, 0xd22bef90c23750e5, 0x15421bb0e48f5cbc, 0x522121dcd06c68bd, 0x01b2dfc85b6eee9b, 0x89d90c298be295f7, 0x5a5f456567d1bb4a, 0x0db7f16253e33814, 0x364f904185a5c6b7, 0x9891ca4cef3a89bb, 0x700185482580502c
+, 0x1aa9f59619134244, 0x2d99517d389833fa, 0xe02e4a189094fae5, 0x3cda95dd98e29f96, 0xb3bcfa7d4c1a0bbe, 0x1e5540988a494f54, 0x8c606a8bf41558d8, 0x5508d60675c1f65b, 0x7bffd1fb9680825d, 0x55e85012bc804031, 0x7e584af0860bcd40, 0x5cb3df55fc8c4285
+, 0xb8be14650fc13610, 0x50fa797d4ad46096, 0x3c44960f6151c40d, 0x32b16c5321334526, 0xe94502414f39dca6, 0x38f2e284e91ee3a6, 0x969fd531da78b76d, 0x238025f813abcfcc, 0xd863c7417144bb5c, 0x01cf1d48039058f8, 0x6af5fd2c810823fa, 0x2c1ccd65726c8a1e
+, 0x8be45d3fb757b767, 0x16bdef0c2927b810, 0x4f337ca659b9b86e, 0x4c71a1e21737e740, 0x8f9284c2cf26125e, 0x2e124ab6a6a5b9bb, 0x6bd1b8b048a49124, 0x018deb3ccf0df534, 0x7a801fac3a4c66fc, 0x24e4fd8d63fc387a, 0x4292c5888892a300, 0x6def60090f4479fc
+, 0x57233e6738dc9a9f, 0x7be254fdae4811ed, 0x4319440d67ec592e, 0x6f72f371a60e4e05, 0xb42b2abb8297cb8c, 0x4bbfe23265e57398, 0x715f92d4bb4acad5, 0x7dd19a885450a1e8, 0x5152712cd3db21d6, 0x437d50f021b16d81, 0xa3bc971cdfbc62c2, 0x2a9baeacf48c8ee0
+, 0xc02c1976c694198a, 0x657344ef9292d427, 0xd0d62a95e69062a9, 0x157553ec18278068, 0x50c95fcae37e1f66, 0x3dec576fe5b17ebb, 0x610dacb6960fa495, 0x07d9ed23d4e06534, 0x3b132a19257300dd, 0x66323b30a08d9cac, 0xe3d4703f59b82800, 0x7af025db2729cbc8
+, 0x96fc63246d789d14, 0x79d1c0db7fd84c36, 0x972a337c6cdcd0b9, 0x0308fb2f854aa267, 0xbe9b970d81d7607a, 0x00b612ff4bb8538a, 0xa8fd5327c5363792, 0x496e6d4e6a838f60, 0x02d1f90cc6b3b2dc, 0x4095a2bcdb44b169, 0xf5ef89cd17f21c63, 0x0a528af6abd341f0
+, 0x362fedf04ea6c27d, 0x78e7f97f8a92273a, 0x753cd8f39ba55ab6, 0x3ebd2c296649ea14, 0xb4873705e72b1cf6, 0x6b6ac50a069a5f92, 0x4a31bb4acf53062e, 0x0a6616eafbb66de2, 0x2ff2208e4ddb2359, 0x06a5dd65363df761, 0xaba9a4c369ce8322, 0x62626041ddd54d5d
+, 0x38ccca66c0ddacb0, 0x69d699cbc576e7b8, 0x9b1b84ba01a70b11, 0x324dd9280ed8d1be, 0xefe22b81b25e3361, 0x0bd202321efd6bc9, 0xae6f1aebeab13ace, 0x08b2baa55141bc05, 0x5472dcec8650bbdc, 0x758914235bab2031, 0x891eb749a9974b94, 0x6eb71f442355d4e3
+, 0x663017e95ee5887e, 0x2fb1d8a23298dc80, 0xa5d684ce4bbdf031, 0x47c1687d3d761093, 0x02d34c356695256f, 0x2e5e5ebeffbb55ee, 0x69f1abad395e7eb5, 0x3189d0fff203e383, 0xba9a7f3ed7b16845, 0x023376ed9e81e8a1, 0x14842aa28505975c, 0x16c322c61fc6e302
+, 0xa647e6e604241510, 0x442ffba3ffd5bdab, 0xe9ff24afcb487939, 0x5e0726dcde67b31e, 0xc5885964c6caeb50, 0x1f3dd7306e543dc7, 0x94fbbdc82bb24573, 0x5ba98083f029b1cb, 0x46561bb237267190, 0x4ca0a63f6ea074a5, 0xfda43a83f7c3eff6, 0x64dfa26199d4ce73
+, 0xc360f9dd9ac82b67, 0x2231a1c971626a52, 0xf870cec87af081e9, 0x0488092c25ada377, 0xea4e2e2247d5f866, 0x668f03421bd7e64a, 0x6466e342d0ad2aa1, 0x1517ea74c22b0bed, 0x192c097001dea16c, 0x39ba0a52f9e951c0, 0x0b16fa95e1cc7314, 0x7c394db380a6589c
+, 0xfcb35706a1488563, 0x4ef0091b204e0324, 0xaef736b269f5913b, 0x58f0e8eb90895cf7, 0xeadf36697addf720, 0x208bbd837aa3ea4c, 0xf86ceef9828928f7, 0x67d7bddde900becc, 0x655cb127a738bf75, 0x77fe1953a5f205b7, 0xca93d3ae3466fc93, 0x230c36578428ca6a
+, 0x4e0f4534d3b84f5b, 0x4626d429722cd8d9, 0x61aee4e641bbc726, 0x75944532008be545, 0x3e10e84f7367743d, 0x13298fbb32414ea1, 0x1841a647910f31d2, 0x37bc1c49b09529de, 0xfd9c5b36d2352f2b, 0x1a8a138facc9da58, 0xb3074bc109f4468b, 0x182289e5e5a4129c
+, 0x7a017797122152c1, 0x5e4f9a26a071dcaf, 0xe0ec3e7a481901e4, 0x40674741e6248edd, 0xa41b11a44bf765c2, 0x0758bb6a896254c3, 0xbc44cccb9968f8b8, 0x7d7e84e645dd3284, 0x5938f711c992c4d6, 0x1ccc135c15333904, 0x60e39af39ab50cde, 0x5f7ee48af4b62729
+, 0x47bd58b238ccd0f8, 0x1482f03fd7f3ba0c, 0x29671bfce435f291, 0x41038e6f69ee2039, 0xfe1cf21996c116d6, 0x52db8acdbb2da01f, 0xd1d531260dffb5df, 0x04b4873d841bc972, 0xcd2fa6d2eb854936, 0x3e8e2a6ae6384af2, 0x88114ba5d9e19ad8, 0x75d5e1b73dc889b5
+, 0x98a4e411d1694d38, 0x07b49690b7eda607, 0x463d1f9c46276613, 0x279a09312146adc0, 0x788cb0a9bbb5c680, 0x0bf219a48c32285a, 0x9b5926e8bb4d33c2, 0x38ddf6cddbc34c84, 0x691ec183fa69954b, 0x0fd0f685024a731d, 0x333e13fded24b530, 0x58851ce91644b575
+, 0x6b75a283900031c9, 0x3071bb008bd4e725, 0xe08204806e1b05b8, 0x7ad0d7787975b651, 0x14424d412b348272, 0x7e873d2b69c89f47, 0x74658795ce9795d2, 0x1eeaaa54f5ab50a2, 0xff1c07594fcd932d, 0x2d0ee14cabd77383, 0x6bce2b3732faed34, 0x6a8cc577b7d3c1cd
+, 0x2df40ce0fdaac83f, 0x10ec16cd845d6b94, 0x316d250298d393ee, 0x64e2a8d2398b3582, 0xc1007758a2c6f800, 0x5499b9019f2dbdf6, 0x12dd934de41a4ada, 0x2728eff575b45a4b, 0xf7c61c46e28afe52, 0x776dd87c5565e3ac, 0x1ec0db52e6c9b7d9, 0x042ad15c9cbf2f51
+, 0x6449399c7d209f2c, 0x3565a6e61534bcc1, 0x3610c5e8c079d76a, 0x6bd9e33c5dd2fa34, 0x4fda14ac5271f80e, 0x19985c0472786fe2, 0xacc3c67163d2b64c, 0x73224dcee938d587, 0x38274dfe8f6104fb, 0x2212f8a23b9bec47, 0xe43f0e3ac79eaaf5, 0x3c633c5c0efabf45
+, 0x24c47d3f8553d867, 0x504c0dd0a4b3f940, 0x861b7e3f23139042, 0x08fedb3ecab3e3a5, 0x28daaaa7d91c4424, 0x0950360ef881d895, 0x4e253d1a6396c8fb, 0x15839744934b82b6, 0x70f544f797ad0626, 0x073ba6524ca89c35, 0xfdc06884e8eff137, 0x30d821526b03b06f
+, 0xa221cb5a3dc0940a, 0x3b426df166779d6d, 0x2ae9502fde2c0e51, 0x15829780fdef5efc, 0x0994fc78f20152ec, 0x08fed98a2c005b7b, 0x4eab63003a6cdbe4, 0x47481bd1ae52c79d, 0xe69ba366dbe017ad, 0x4f42a8b1977fea05, 0x5b5570571b866a1e, 0x698411e4296cfa34
+, 0x349047f837e75fe9, 0x2eabe8dd653ad56a, 0x84e5475077fe9311, 0x5065a7ecfa7fcdb9, 0x99a656254c0cc24f, 0x65e42c30aa733a8f, 0x9cf8a3ce6d9c6579, 0x0e393228c1f68070, 0x7336fd1f7f901461, 0x0d28e06a71612962, 0xef110dfd8b588f11, 0x49590aa711a75147
+, 0xebcaa368cb1ec685, 0x617a3a347ec37c16, 0x5522541124b0b846, 0x280ab8d427af8971, 0x5e844a80701030bb, 0x0b6bc6d57007d5df, 0x1cc269c79d42dce5, 0x2fc7cf8b2ceb3c3a, 0x3ce955cd9d1bbeea, 0x4562c343e01bb1ca, 0x800941e47c1ec609, 0x6675d402adb48776
+, 0xe4a944c8c9873d4b, 0x491906a4c68a427c, 0xc85e76d0a1e64722, 0x4df8d0c0fe0d4288, 0xaefc65c2a4b554bd, 0x37936aeaa1d4f172, 0x98732b89e91c783d, 0x3513fc8029ea27b5, 0x7ba63808735f34cf, 0x5275a8332e9fac71, 0xbfe35b9a2a8c68fd, 0x50527043eea2b727
+, 0xed8b55e256116b52, 0x4f6430c78e90dff2, 0xfba2ce3dd7c9b328, 0x6a05ea2044278728, 0xe6a1fef42783177a, 0x7d86694f42e2f38d, 0x01e3b436cb4079cb, 0x2a2e6fef7bac2980, 0x10cd88becefe7952, 0x02f237da18c8a8cb, 0x3df718340d200e21, 0x579681081938ae8a
+, 0x82c25181289647d8, 0x7a4dc3606f37e6ce, 0xe917d100197ea393, 0x7fe4694ad5986bd6, 0x3543590b66566872, 0x77222f0e9d50b7d6, 0x15ae13314f30b814, 0x0825187fd54e55bb, 0x59ccf6a5aa8baf84, 0x409a6503128e4dd4, 0x189cbebe36a9bb85, 0x7b5aae0cbca830c1
+, 0xdcec9e8f278c7516, 0x503e5ede3e1d1064, 0x4eb01cc1aac604e5, 0x1dc18e3197392ac2, 0x12eb8afb1767cd26, 0x68b2ea0c9b6b32fb, 0xfb0439ac0287015c, 0x5c2124daeeac46ae, 0x1a1dca4c6b6ecb06, 0x7accc5f4f93ab71f, 0xcc35e69292e662f2, 0x7fc04cebcd57461f
+, 0xd7713cc51ffdffb1, 0x70b7576114a0e702, 0x62abf88dc5362881, 0x2cd007ae8bf4f285, 0x53c82d4fb23cfe2a, 0x2cea4c96a7f3fdfd, 0xc961e9f2aede27a0, 0x50531254c25fc480, 0xfb05d2d6b7fa3f3a, 0x34c0d331c8da8413, 0x6ada5b8661f9f6db, 0x0c2df508e3b6b979
+, 0xf2edb475954c3fa5, 0x6be5bba2560972dd, 0xf0933cda6949f236, 0x532afe73f0ecdace, 0x460cd45d9bc0564e, 0x3b4cbd80aa0a5578, 0x57093c8458b8dbab, 0x4acc5045f48d0e09, 0x4b4b4242c75275dd, 0x4026729b9e909ace, 0x12661476727521a6, 0x3be4e520ce98bc4d
+, 0x23cf662688e8e5de, 0x737186af4a2de956, 0x364c3a664ac74712, 0x35fbafe4d146db53, 0x70137f8525dc216b, 0x52bcb6d04a727c36, 0x32c02a6a60ae8717, 0x064b07e090e0192e, 0x43c1a5f7edcde7f6, 0x656bf8a42012428c, 0x1f30477464f6a3bb, 0x467b087c150d49b8
+, 0xdef3d4938de868ba, 0x0d2fcfbc721057bb, 0x3df4484f2a01f3f1, 0x2837be111234194d, 0x20690e820a385669, 0x31957bcdca4c00db, 0x35be47e11429fa98, 0x22e19499b6e370e4, 0x24c4f389b37f3d60, 0x086c1a5db78acec2, 0xdd98063aacc977a9, 0x504747731eb4d2ad
+, 0xf261902a13777b34, 0x10f4b2dcb73a919e, 0x6a9b2873e2f6ef52, 0x0f6631fca61cb8f5, 0xd3f9a8b062fede25, 0x4e9b277cddba660c, 0xc0c24ef19fd183d3, 0x60e5145931324065, 0x12f97930efb99fdf, 0x0a85c1b024021721, 0xe7d1cb74b70e1ece, 0x4288dcaf240b2d23
+, 0xa4114226268c9a3d, 0x60e77292efa386d0, 0xf8ed35724ab48b0b, 0x2b8b1ed5821a5640, 0x1f6ddb34970567da, 0x09735c177d9bcd19, 0x78b3f77fabdc6f9d, 0x12eca339541f2e9f, 0x67948f609eda848d, 0x242a0b67a9353dc2, 0x5954aa3feb74f9a0, 0x6f8280c953a0cd87
+, 0xcf5c8d9f3b9c3323, 0x19e870329caa5ae7, 0x5c73b214e4fd7e0b, 0x241d005b63110a45, 0x832b3c4a02aed3aa, 0x49feda1046881b81, 0x8f245d4b9191e156, 0x47bd9db0ae8fba16, 0x6caa8e42a2068826, 0x3f5f410d39c40ded, 0x3a3469f61857c5a6, 0x3d1d8c60b458cdc6
+, 0x7eb8887cbe55d443, 0x54636c176e6efb70, 0x572eb41419d9884e, 0x356f195791f65cd9, 0x40b90128a1dd3b44, 0x2d69380991d8d618, 0x2454cab965e20528, 0x66c8297e78dee038, 0x16a332d1d7811fa4, 0x1735c9d45d10bc35, 0xe72f6222b01ee203, 0x3d81405331358346
+, 0x5e1a8092dab16542, 0x3bd49cf8130f9baf, 0x4b5722414b7aaeaf, 0x66e6f85fa48f64c6, 0xe3e3144f86eb6b14, 0x202c96029390e84d, 0x19e47869ab236eef, 0x4ffac16110816ab1, 0xe1d9e80d23ee512a, 0x50b375efb8670907, 0xf57c25588fc4239f, 0x3835e70037d1c842
+, 0xc538628b1b62530a, 0x322721d1db02c455, 0xf5d47e127710c696, 0x258132a27e9d1f0e, 0xb3c7f50faee82a04, 0x336157bca2257b01, 0x40ab0252ee3f7d8c, 0x48dd907282bb819b, 0xf8b0a87b3f4b0fc2, 0x4031212f976e417d, 0xfa09000687112cc6, 0x4013c14c342db054
+, 0x511f887f480a9b0c, 0x721d692c2eb80de9, 0x3f1d839a6c4bdf23, 0x32d8ada7882b717b, 0x006fa68532032c77, 0x35394a6d6bc96eff, 0x767189a727199714, 0x4eb19eca17953b57, 0x40018c2e6e77f283, 0x4abb26042621028b, 0x5ea08d4f332c0fbc, 0x004fd71f0c9a916a
+, 0x7707cc7f6f4df084, 0x6ca5a966db896cb2, 0xd66b16dc96bbf212, 0x060461aa3398734b, 0x47d68620f87d7292, 0x0bf6762a4946784f, 0x3631188ea3435486, 0x5bf249590192da32, 0xadbadca4dcd535fe, 0x75e38062e2bf02c4, 0xdcb9060493175547, 0x29b06cbfd122c1ad
+, 0x69dc48eaf06c199f, 0x6d6ef6bbd7a23163, 0x7b19b63f0f201129, 0x1a318eb60bdec0fc, 0x315d8e7a8e669ca6, 0x000bb9e5e45aa3d3, 0x75add00daa7f561b, 0x5b86476d28a5e669, 0x1e1711af00f113d6, 0x4368e75c48b05ca3, 0x3c486c3fe65a1fc7, 0x6b2fc509a35cad05
+, 0x88dd4cb64c64f778, 0x267effd0b6a4c0e1, 0x5f2626a46e6159ad, 0x0b6032b7ada705b2, 0xd8217bf361e45eec, 0x7d96023149445db9, 0xc15968acd1125df5, 0x1ca5d949775150dd, 0xc9711c9643f8f467, 0x6dd0e6cea071549d, 0xeda49f59c07abbc2, 0x43d252cc516c23d4
+, 0x0c63130ca776e583, 0x5960542d91efe251, 0x67a43a430535c4fa, 0x0c9eaaa160269aae, 0x4bec86ac041b1f34, 0x6e8dc7e77b80e8be, 0x2377f71baf3822f9, 0x6badf7defff4a7b4, 0xe88adb311d40d48b, 0x2482940931b2778f, 0x820353c16b5f75a7, 0x15b52424339898ec
+, 0xe432173ad41abad0, 0x45e37a451501776a, 0xfa365184c40440b0, 0x5a3b466df12d0213, 0x495745ed52e78fd4, 0x22dc0d25f93d1374, 0x4aaf037753b37846, 0x5efe0fa364e86db7, 0x46a43c7e1ed2af08, 0x4ddc62e26a667025, 0xe9057da7fd589282, 0x05341fa624ab625b
+, 0xf73f4de3c94c854f, 0x770fe21a96d2cef9, 0xf703ba69fc4e6047, 0x1506ad65c0b38e34, 0xd8129f84a6f09cb8, 0x07ed2038efb9568f, 0x58c36722cd3dcda3, 0x17480199a749c5f3, 0xd09b08e8299728c0, 0x5b7f8507cbefad7c, 0x38d4f47ea1aeed8c, 0x3b2d7d89afaed22e
+, 0x05691d83321b840a, 0x2785acbdb24652f5, 0x81c100426a402117, 0x45e61f418610bede, 0xecc406011e4b8486, 0x14670a2050897b8d, 0x5ddfca4c2c526efe, 0x7ceae067a5a36b48, 0x467db49036dff82d, 0x475bdd22f359e9a1, 0xc26a126c4901c632, 0x4a461e269b0f1171
+, 0x487dea209656883f, 0x3adc0be428ce84a4, 0xaf319e3dead2dd82, 0x20f12784baf464c3, 0x8d4c91d2a7469182, 0x3cead1bdf3805e76, 0x3c834ef0158f45db, 0x5b83d3b4f3dfb123, 0x368e62c0c3b8f470, 0x10af2c51952072bd, 0xf808dc494275662d, 0x4b4df9e1d3b5217b
+, 0xfc00439ee4ce60d4, 0x01c0ae9affa6fd0e, 0x67ff95fcb55a1eaf, 0x14ef6a57e46c1d12, 0xc3b4ba9daa7b314b, 0x455592d3adf84366, 0x514dbbc641d64250, 0x0924f909934a31e1, 0x765e392d81dfd09a, 0x67dea33dd2c82cf6, 0xf358750263be15eb, 0x2c122c12c32ff7a0
+, 0x71d2d118f08c75c1, 0x6989b5782bf5b29d, 0xc982e0669dd22633, 0x5037e85e166e0b07, 0xbf658f68ccf5b300, 0x35a6a47992cb39e5, 0x818f6f7762a59ef3, 0x7f4bdbe90772ef84, 0x7aa58dd4d4f72591, 0x2770e83ea25c160a, 0xb492e677db55102c, 0x4c3b869f96805d15
+, 0xdb914161620be3e9, 0x481f4d2fe1a9ebf1, 0x2860cdafbb415e63, 0x5c701a2ec71eaf0e, 0x327821eb34992cb3, 0x08920c4da9d58c18, 0x78e2786c447059f6, 0x300a09b269610018, 0x9c6d682a7d0ef5a4, 0x4d046b30f8c69faf, 0x0d11884eb2b3c4f2, 0x61d01d8b7ac7403b
+, 0x00298042e5d88596, 0x6e117d506342a56e, 0x6495dc1add1d76e7, 0x5c3eb992299902cb, 0xce40e75b6866ae54, 0x5d3963448495f603, 0xa58bc91361221c9b, 0x2bca0ed7ef1c26ab, 0x45bcf08b5333534b, 0x5d9375f82277acc9, 0xbb48bfe94faf080d, 0x050346ddb79dc2d5
+, 0x0cd07283f89f7977, 0x4d4bfe9077675e1e, 0x4062a850e77b3fa0, 0x3e742280bd7e3dea, 0x811b91cd68a2d2ac, 0x1d2c43c795c7d3a5, 0xfd6f9e88cc33e8de, 0x40200ce26638d4f0, 0x9d82682d9cae06a3, 0x58746e0120087226, 0x592815fe1c76118c, 0x17d97097b69d192f
+, 0x262e9f71e814ae90, 0x4067986ab356cc6e, 0x220f1f7140350444, 0x7818713efb442323, 0x6ad94a822c5f5fe4, 0x7278f918d9b16723, 0xafa354691a0640b8, 0x19960315978a9ff6, 0x659f097983f3fb25, 0x48532173b01a2636, 0x83c295716c3de625, 0x6008a239dcf2b72b
+, 0x07883b5f0299bf4a, 0x6cf3dd3339aebeb3, 0x45fe3f60974b2977, 0x488e933017af35d9, 0xfc57e86871018578, 0x3114eb134aa4bde9, 0x3130f34dddccfbb6, 0x3ad9595abfa7f110, 0x0aa67449f7c94c6c, 0x728917fae1f56f6a, 0x7796467f94f66b2f, 0x7ff0f541a016248e
+, 0xb7cb90e75b654160, 0x006a636f45c18fa8, 0x0444f635798e6ab9, 0x00241171037e970e, 0x7cb10aedcef3b980, 0x16a9c598a19f8703, 0x5aa8bb6000cf48f0, 0x0719763740f233d9, 0x1d66e870a9264572, 0x2d3b39de58d3f654, 0x14c5d0695c2b639e, 0x2770e1737e3f14ff
+, 0x4ecad99c45cb6d0a, 0x36202d151a16e71d, 0x28dd1546d0e28a12, 0x001422fe3470fa92, 0xfb16764cd696b7cd, 0x5cb3ae846576d528, 0x7f97c6e8b8d8e134, 0x354997a3f11866c0, 0x0c718516204511b1, 0x5eee4330f9037d05, 0x0104280984666bd6, 0x46779804eb662df2
+, 0xf794530f405b0ff4, 0x6ca71294dde77974, 0x31c426a7010820b7, 0x161e73998028e1cc, 0x91f37f533efcaed2, 0x3fe8dc00ff83dfec, 0x760d0b3637630877, 0x5c46b6c0f6a58f32, 0x7df4be07a049d818, 0x22ad144106a7639a, 0x3b437a0904788ea3, 0x5910d0fdd33079b6
+, 0x74f194e5b929501e, 0x37113109128d7d9d, 0x4b84cd37cfa03a1b, 0x0ae4f1e4f5f049c7, 0x2a17c43d1f77b4d4, 0x6af5a01e32164b11, 0x527b0f34f446dfb7, 0x1d5d06694ecd93d6, 0x6c449ece883069a2, 0x00a121afd9d88180, 0x5bcd7f257005466d, 0x7df85ccec26181ac
+, 0x6cb7f0bc7e87c10a, 0x72c59f906f53166c, 0x49ffa684c82a3399, 0x69470d5a12022069, 0xba9f6625191e7000, 0x28ca9806e6d9b6c5, 0x56ab6fd46d34f278, 0x76c1d678a37fb1e6, 0x0a677a125f968f36, 0x6b194294167e1638, 0x5a6001fb58540428, 0x7f776b8800470fd5
+, 0xc3685f2ed4caa42a, 0x0cf35a14377bb2c0, 0x3d182259b29bf408, 0x5c50f1e150896070, 0xb2d4da038770a338, 0x1cd3cab8d27c5ddc, 0xdbe19d62adf8b3eb, 0x6bbc15c4effaf1a8, 0x703a453333e09f85, 0x75dcc987a641f956, 0x4a98b7dfdb1ffd3c, 0x1a587cccae764381
+, 0xa554bb139072d148, 0x582489fbf8e6b38e, 0xa497e65fe1cef380, 0x09f1bce5e0b190e6, 0x78109d251ecb9dc3, 0x358487e9998a3fcd, 0xafb8c9b97263c535, 0x4d60dfa03cd3eb12, 0x5bf10c6c94970015, 0x7154312b45100431, 0x83c91b1f517ce00c, 0x79533af33a620cef
+, 0x36ce9c4b3e038540, 0x1d6789cb5dd6f08d, 0xcae0fe84905104ef, 0x092a8344e7584321, 0x0345c980d190e3ea, 0x61955c3a447bf031, 0xab992a339e8110db, 0x772d545d9298c9a7, 0xc590fa6ec9ee4383, 0x6e27fd7468d98b06, 0xdafad618d4b65b24, 0x5df7bf75ad3fbd48
+, 0x2e208650a3d556b8, 0x5a175cadd8f971dc, 0x6df3649a60430eb5, 0x762f90f58cfde4d1, 0xcbffa73440e0da6e, 0x58e88b48969f7bcb, 0x1b3c267cee9d1d1f, 0x3ed160f5fa5846a4, 0x4be361c1457acfd1, 0x0be587ad2452205e, 0x2f1fd5d910c3bd57, 0x200fe4434a5bdff2
+, 0x51439922412b19c4, 0x1b9809fa9ba5c450, 0x89e08c580ec55fe3, 0x45e3459264e57970, 0x53b4ede9e4b5c2e7, 0x584dd392cfe70035, 0xa6794dc2184eac3d, 0x0ab182d8dfe4aa3a, 0x9ccb76fcb4da9b84, 0x1a9c747c7d44eba3, 0xf9b2a034ffd8c130, 0x3f76516cca7d8e7b
+, 0x0ca97aa772fbaf94, 0x336a1366b9a468ab, 0x7aac48519ca91afa, 0x398285ef8c9e2490, 0x3e9c8bc408a2faed, 0x7b41e02066b2bb86, 0x4534f444e715de4d, 0x323818c7b32348f6, 0x099fe7483240fe5c, 0x06b6d3da4f09e8fe, 0x9799902980f9ad3f, 0x60b5404d8f72e459
+, 0x2fc77fb4dd2d97ad, 0x405f27219fe7e288, 0xafa0d2f06f388665, 0x0eff9b02ecca2f26, 0x060bbff2051d9b7c, 0x59aac4827450f9af, 0x58fc63056099c0c3, 0x32eff77e374231ad, 0x5296d898a331cd8d, 0x438c43e74f7fcf8a, 0x970f9ba301949fb7, 0x45121367f42a871b
+, 0x0408e2be0a65e823, 0x5c8fca669b45c2b6, 0xab442a9bd00543c8, 0x0428283d27ae316a, 0x9dff369e1ff89245, 0x74d382fe8edbcdd1, 0x6b8c3b1c755608a7, 0x2231172076fb39a7, 0x2161de96a0a10d6b, 0x4c54f832ba71c7a8, 0xf5965f5dc31c40a4, 0x76f433432cc1a77d
+, 0x188c3b821dd6b3ff, 0x48928c0d7339b30b, 0xbb6ef13eaa2d14c7, 0x15a15117785098c6, 0x90f7ce34b84ba987, 0x6360cf3749c177bb, 0x1ed16253cc908da3, 0x2130d70e5247815b, 0x108834ffb46c0275, 0x2ddc378c3892d664, 0x26b5bb01639c5e6a, 0x4652e65d31594fdf
+, 0x80eaad6ed2f49123, 0x58a620cfef7f360a, 0x98681f6751a42ec9, 0x610c135945f1c92e, 0xc27dd92affc766ce, 0x56afacf29a3eee95, 0x0f63dc0bf372d94b, 0x72b0a0b4dc8b58b1, 0x86621fc53bf2df9f, 0x3e8b98acf75e6dda, 0x4f9260ee7aa9ef44, 0x2bb174f29cfd8ea2
+, 0xef333fe03ed56342, 0x7558dd99e02de1d0, 0xa16b7b3ba1e03991, 0x7b59fc068218a1a8, 0x595828a18bb76006, 0x00bc907e5a48ca0e, 0x0e870329db56ac77, 0x59dfb4614c7d86e5, 0x512cc79c29df9abd, 0x0214d256a867d172, 0x83c0fc444d2a67bf, 0x28d0e3ddd0723993
+, 0x1d3718746654bc73, 0x09f5275f591efca0, 0x6c5f7bb51c74fe14, 0x0c540460ca6456d0, 0xcdb44d1dc3016512, 0x79c2aa5385a5e1a9, 0xb397db4c7146b80e, 0x458a3b6783d65e1d, 0x6ff56431a6476dc8, 0x2d42984233af18ba, 0x2e5356604f11a217, 0x50d370f85cabf6bc
+, 0x85b5fbf09ec87121, 0x3771cfec0bd6454d, 0x5443fabac51f3555, 0x3b6daef03ea3c4e8, 0xcc7c43bbe808b003, 0x1b8c0c46ae914587, 0x3794f0c4e474692f, 0x1f6a379578a1f56e, 0x390e6f14df8b5d62, 0x72afaaa1eab01edf, 0x751f77530644fbf0, 0x7385455414d36174
+, 0x8a75bb9d9f7df54a, 0x71fc08cc71a5e5c4, 0xace7c783b84a50b5, 0x316ea67a9da434b6, 0x6e5a30f4c3c0d20b, 0x666b936650687b6d, 0x330db1e712efa089, 0x3762e3c24151cf9d, 0x0c1f8a455a08371c, 0x1a417b103cf2bdad, 0x29753602ae5b5d6f, 0x392bfe5a73e1fccf
+, 0xd76d8751d73fc406, 0x13497c3a38c74d25, 0x33ae42f31dc4f117, 0x57c8746433523dd1, 0xd8bb13361e2e686a, 0x2dd4b22b76fafe55, 0x545f33302fa8f97e, 0x4fe9aede51ba32d0, 0x05bee159f6c42ad0, 0x155640b961e20515, 0x09ab0aa99090a24c, 0x7c47999a4cd1ec1f
+, 0x7c7e78776008923e, 0x0c23413a6bedc2e2, 0x73b8c0586230fad5, 0x16062549f179dfb5, 0x79e7cecc1b7f7275, 0x62272a3952e50db6, 0x4f6d084b9b0d81b7, 0x551221728883181c, 0x64bb9191be1d0813, 0x4c611396e6ba0d02, 0x1dea3132a22ea9d8, 0x63d13b079e1fb3d9
+, 0x3d510ee44f1487e2, 0x27cd2b7be1ba0677, 0x7ff8411b31c8cae9, 0x757223bccf3164bd, 0x52cc60015831262c, 0x605b0fe7d3453f14, 0x7074cd6a4164a8d1, 0x41249dc6e0ade9e4, 0xd3e3da91ffa23da6, 0x509ea7ab35b45ea8, 0x8a35e66962b37543, 0x4b194cc72f40ad1a
+, 0x4212a43fbdb344f3, 0x0a83bac4ff391270, 0xe45bae9314012793, 0x14aab67cc3df77f9, 0x0d75ac038350a416, 0x4ef5dba67a0fa039, 0x8407a73214ca71f4, 0x72f32ff7c9fca525, 0x0b504b0d1cbe68d0, 0x087b73db5ca03128, 0x094742872f793fa2, 0x52f67600412cc4c2
+, 0xbba10e50a467a296, 0x79342950eece081c, 0x8c0130333fbb7b94, 0x02645028cc78df7f, 0xacb824a891f7a8f3, 0x205f4f4395ab9e14, 0xf7c5ebbd46b3fdd7, 0x7fc7f93a52b446db, 0x66f05848014f3f70, 0x5ba7cb5247c313df, 0xf89f9c5433cd82e5, 0x09363c03bd8c87d6
+, 0xe95e247cbca10b87, 0x494e5e0adf8a5326, 0x8c9a5ef01718b166, 0x53ffb7694a8ef31e, 0xe48eb9fe04a83a3f, 0x26e926fd9a7a61d9, 0x94b5e4d9fdbaa0c0, 0x0a5b5957de0d4e00, 0x1c31fd09461da21c, 0x33432189e496ce8d, 0x0aadcefa38c1e1aa, 0x6543d2b4bbd51d42
+, 0xc9b191efbbf33693, 0x5f888451be028aab, 0x2c41f4f2982c9c28, 0x2e6ac303d188c423, 0x9c3e4f321f364135, 0x4073256241cf1cda, 0x8f6b549e00311a4b, 0x7aced3a7d5ab9a88, 0x612f99afb3d616dd, 0x1acff5dd9cfa1369, 0x98120a10db025531, 0x5218d828ba447334
+, 0xc4874eb9cc69c3d7, 0x64b8c61eaa4cc408, 0xf6dfc7ba223293e2, 0x3d922a42d12b0ffc, 0xba2e3f72dd44329c, 0x779634bf1207e21f, 0x1b661d1846802d9f, 0x2919dbd71b8bd55e, 0xa5cacac9db71ebda, 0x300ff11675f9f136, 0xefbabd83b9212c5d, 0x4f8c3e6f8b5745b4
+, 0x3413d91e8c1bd22a, 0x42b7a45ae2392dd3, 0xd886be1a3801d883, 0x74423e778410aaf0, 0x996a951de6e6c60d, 0x14814e57b4343c3c, 0xee2cb348b9c1adaa, 0x52002d8f68fdf31c, 0x5277a742d3cd9058, 0x04999b6d48b791af, 0xd70e4def93e9e861, 0x4bb04064ecf3cbcb
+, 0xe6ce2a25e7dce2f6, 0x72c7867d26b70b91, 0xe3e58822d752fa27, 0x7fed68d92e47a7db, 0x9552a59082009764, 0x1429ef42f33b3e77, 0x48b79994ef4b60ed, 0x28b58fd23f8f259b, 0x6128c666d9185d4f, 0x2852bec22c2cd816, 0xe9be5297a3aa1c1b, 0x461d418cc731f0ba
+, 0x2f1d7f508ed6074a, 0x5e5fa55758f97c3d, 0x732b8dd15c3d5f24, 0x0cae92c11214d4b1, 0x755d007d94ca9814, 0x1d2d3492e9d82d2d, 0x7f372b3979ed97eb, 0x05c1f333687b2660, 0xe9e770a3c9bc8bc7, 0x06b70f9203e97c4b, 0xa39418c23226c373, 0x526c2b9d35ea0065
+, 0xe350b70b9eb23472, 0x13071687fe96b686, 0xf246797c7ef9b724, 0x1d12b216482a292b, 0xddff65d5791592c8, 0x41d88572d3f86910, 0x2ea25b63f185bc02, 0x3141ec3b2fcede7e, 0xeab7e5a1e28ddc84, 0x0ae7f43df289f045, 0x18df7489785a4c0b, 0x182122b3f27022d0
+, 0x81e1e8c77f86002e, 0x270b4266c5c73cbe, 0x5da0a60a3c4deb30, 0x3eeefd81f35389d5, 0xd23a98ab98271472, 0x5cd01d7f4f4d4033, 0x43afe2e711a95336, 0x016b3a6bc5c7afbd, 0x2aab14695996d026, 0x50fba7abff26900e, 0x7454eeef460a9f30, 0x0afbef7e779a0485
+, 0x4c890bd1f9bf9126, 0x1672ad8b051a7d11, 0x05f7134b99d8c304, 0x7a446323bf336ab2, 0x1be1802dd0f6ac59, 0x48d35758f7e0db17, 0xabf2cf25f5d20d1d, 0x5ae4d09f673daa17, 0xa52bfa190345e839, 0x4797b0d6821442ab, 0x8780805e3b365d5f, 0x14aa7c3c29df7f6a
+, 0xdeac87236a8e1933, 0x69275ee59b1b4466, 0x6b782f9baf7ecb8f, 0x08a981c0024fb7b3, 0xcd64a503c99b2691, 0x754d784a89f71869, 0x66a91769841f8475, 0x48da81720bdec2be, 0x90fc8cf1a857a1de, 0x0060587b741c2acc, 0x16b2251155c09894, 0x44fd5237e9a82a75
+, 0x238405e51e74987f, 0x0ad0657799a3f0c9, 0xe5603c7e4a99ee19, 0x355256b9ee0d0ebd, 0xfe7b24fcd5a4a7a7, 0x71020ed99218d0f3, 0xed58f35498019e1e, 0x4a751bb2f036e95e, 0xd38f23cad03cfd5a, 0x3ca995cfb1f9329d, 0xddd8927c1741a175, 0x7f52bb364e0163b9
+, 0x6e31e87261969316, 0x53f9871e69a0eafe, 0x48c517e37c41acbc, 0x41a45c2daade0cfc, 0x03b3124775ab726c, 0x480aaf26037b3b34, 0x58c634bb002e4217, 0x50d8bba38f74d61a, 0xe2aefdd8d536a312, 0x599932d5f5a2bca9, 0xd6deedbb5cba31c6, 0x49ca2bbd5eea44d6
+, 0x7d385a2364b44890, 0x717a19b0f8b93f56, 0x8d785e642f4b71ea, 0x402917100c913143, 0xe5401645fdac743f, 0x5bad2fb796a843c0, 0x8de2dea029c89323, 0x30d69a0bd3e5e40c, 0x921abd2158b95721, 0x4aec066d3af1e7b6, 0xe931ad69f75afa5e, 0x0f4f933d5a546e29
+, 0xb6fb77b0204b3626, 0x3887b6841f5b74a7, 0xaa4083756ede5bb1, 0x3681aa6f49c721c4, 0x10f6f6c1306e1734, 0x72d88fe5574f3ce9, 0x4d4b8fc7e5d119ca, 0x2478a73d30468486, 0xb7a19fa688889de2, 0x23a90b3f3166709d, 0xc1106cf98391352c, 0x68610d0d6a164305
+, 0x9e4a082888a69a81, 0x49e8edc488e7010e, 0x13380770e229392a, 0x2282a797623f07f3, 0x4c76b19cca8c2bc9, 0x17c3f7c04d6e9418, 0x171aa6e3c9b36a7f, 0x4ae7b0840d97cc87, 0xf8376793d91bc196, 0x6c1d976ba44c0a96, 0xee5c306edb1b4002, 0x669fc707b99d9b88
+, 0x876759cd1efbdc50, 0x41386497ee075164, 0xe6a783806eb5707c, 0x1464fc03aa265194, 0xcea4262cb5916df5, 0x31541ed145b0e23c, 0x1e89634cf0074e90, 0x678a7d5d0520c152, 0x6052fe381ff54e87, 0x75dd17a6e22fe4bf, 0xc68154b4fedb90dd, 0x6faf4b5012cfb0ea
+, 0x3823cd1d02035d4e, 0x4bec696bd18566c7, 0xad4f8e86e9581caf, 0x6f5b935e75620c39, 0x62cbe730b0c28a00, 0x2caad958ffb01c44, 0x9b8c1a4ef2afcdcf, 0x6f4802fa1251d60b, 0x044fb1290e48e79d, 0x10471d0b333f6dff, 0xa425cb611b2fc5d1, 0x2d8e6045474f9e6a
+, 0xfd7c065517bbf1fd, 0x0f24bcc7b95db671, 0xcbb3a02caf8f2fab, 0x1b226ac7802d8878, 0xd79ed1057cd5dbda, 0x3d31688a6faa7e5e, 0xf8117f4397908096, 0x54b1f74242485968, 0xacc5c139d21a6715, 0x0b728c25abe8150b, 0x8f618417120da684, 0x34ff4ccc7601b266
+, 0xf9c9a6b665d63bce, 0x1ce20c493f3ed92a, 0x370057460691c5fe, 0x703108b8525457ae, 0xe800e10fa8fb6a2c, 0x6c18dc69f63e654f, 0x98aad3e4a5c36a63, 0x4ba3c08a0c833a38, 0x76aa7fd827b49f6b, 0x77e7f64b80da8ea5, 0x9e8fd33fcba4a1ee, 0x0f3ea0b3e76b78a7
+, 0xfaa28f3f7b625116, 0x138c6f2515a9bdc8, 0x46a6f051ada74c96, 0x37c7c6b6d59db964, 0x5741cd583da3248d, 0x2a0c3d6e80e0ad08, 0xe957d0256448a764, 0x71bd76450209141c, 0xbfd51ac4f0cd4f6d, 0x5aaef637d1764a69, 0x06318de235815a29, 0x56ccda5dd93a0a52
+, 0x7eb06bd8f87f56ee, 0x721c32b5cd699349, 0xfc0476368ff65433, 0x56b2a071ab29ffaa, 0x28038632ead92e70, 0x4a6ee3b841a75506, 0xd215d2d3da34a866, 0x2414d8749fd12f3e, 0xdf1e9cd03e7690d0, 0x5719a6485c3ac4c3, 0x83c499d21d064e3b, 0x42a7dce063f48d74
+, 0x924e9f394ad341d3, 0x6e3cb03c0d3c0b08, 0xf8ab7be4483d61bb, 0x16007575a5c9eda7, 0x96842b675fbcef46, 0x479f217df908dbfa, 0xd998bd9770fa4935, 0x62ea04d597124618, 0xca70486ac6e1436f, 0x2493e0a1c075a15b, 0xc112902ea1dc13da, 0x3f696c0639093035
+, 0xfb91e6638e26e32c, 0x4df019963b5bdd1c, 0xb0007eb046991d1e, 0x7752980356c7d1fe, 0xf31e7e058e29b0e2, 0x73d7f17c67ff76b7, 0x81fada54f1c808a9, 0x6d9de8ad1584bd02, 0x89f81ceab32fb035, 0x75ebaea31ce722e9, 0xf2356c1366a5a45e, 0x5d5d270e4b0676be
+, 0x72ab40daa46c02c1, 0x27581db75edab65d, 0xfc718d25e2e30db1, 0x5a98422ab9687d63, 0xff49e96aeddc72a6, 0x4bfd34c1907f9f54, 0xcc7114b522a125ff, 0x5c5934cc0e11be9a, 0x086b8569de1e367c, 0x691527c1852d5e2c, 0x4a143f6a265ef75d, 0x7ae52d20288621ac
+, 0x1f09e369c84bcaa0, 0x6167746e4389805e, 0x98900696af29bb47, 0x38f3467e0062df0d, 0xbe90ee869c184d13, 0x10b3be8a93fbfa88, 0xa96147bc7cbf21f1, 0x0c17f5fb3154b1cd, 0x7ea3a96b27e1273f, 0x0dce8b64615ceb74, 0x2b70fa57b2dfedc3, 0x0e84d636ec88dfb0
+, 0x70325ace4e48a331, 0x4ccd731127016d70, 0x7180091a8d56305c, 0x17a97e13f4167373, 0x6ffe3e04a1d834fe, 0x0e35ba83ecbd503a, 0xde11bacd852449cb, 0x3fc1dfd26c914d4f, 0x04195649c971d9e3, 0x35a07215732b7ba4, 0x26f57c1142a5a5b2, 0x0d5be378517adaa3
+, 0x7e50a6c2061b7115, 0x5c6576ed858d6945, 0xd415638c9187a1e8, 0x4229cfa6625b151c, 0x3559ab3aef2f5fa2, 0x156eafba92af2f13, 0xaf8bda55b81b5176, 0x37f30fadd0975b9a, 0x3cd42858a22d6f0a, 0x43998a98b45020ec, 0x738a7af90d5a343d, 0x57b4256ea50d61bb
+, 0x7f0eaef1467dd0a1, 0x2bb907d6edfdf169, 0xe668b69dbd4c912b, 0x29230557975b792a, 0x3ec91d0a2f76f911, 0x28e7200110f753aa, 0xf5e376cc0d6e644a, 0x722485423e73ee61, 0x53966a6a9602134a, 0x5b9019f17dca7a20, 0xcb1c92bed0f26799, 0x28115562a9882e03
+, 0x07994537fc0c4d13, 0x031803886d8598d0, 0x6ab27bca5a9bc2a3, 0x08eaef162442c14e, 0xf02765da767af96a, 0x1f866e3a8fb9620c, 0x6a5680c46f22c449, 0x6bdcfe00cda41d91, 0xb72b6c4870e0ca57, 0x4f58f504f35a4870, 0x5af68772b06e21f1, 0x7e020266f9c26ac6
+, 0x0cfb2a5188423ffa, 0x3f473d64e778a054, 0xcefbbd4107082de4, 0x38f2a694375aff2e, 0xea87844abe912df2, 0x7ef0f138e4252ed3, 0xb2e4191fe974d0cd, 0x04b595317caad117, 0xb826e090d714ae98, 0x3e63ae294cab6c0a, 0xf6db0af4ae45522e, 0x46d50d6d40b5cd67
+, 0xe3e6d7003bb47000, 0x5473eedd6201c8f7, 0xa63abfd8865a44d4, 0x443352c51717f551, 0x1a9fdef9b5688351, 0x445049e722c9332a, 0x0f8f2cd02efed888, 0x26bddb1eccae5f80, 0x0d211240ac90e639, 0x4c8a7e6bd366496a, 0x3256a6373781892b, 0x054c33c317fa0a74
+, 0x29b250227d226779, 0x46f40185c9ff8d5c, 0x75748c04c67da4ae, 0x06f8eefd5a61f8b5, 0x9dd1a1fe19911edd, 0x3f115f1dfb1c3f34, 0x4ec3c9c9660c3b5f, 0x09aabad6ee3cc759, 0x5a541594347a3789, 0x29efc72270861b32, 0x5665d2d422b6f848, 0x29c806bde48aed12
+, 0xdeee0db960fbb044, 0x396709603cbc9da9, 0x7f8ad2f81d6ab966, 0x51520fcc6ad0e37b, 0x5ba76c6705935316, 0x6196e4badd57105b, 0x871b3a7530d7c654, 0x5e0bd7398fc37870, 0x387f6f2299edac77, 0x1adec261c8c4f572, 0xa600d3fc5c983a26, 0x016f5cb2c6e4b632
+, 0x0f65c36c5acb927c, 0x7df4d1d205c58ad9, 0x1e101efa25716734, 0x66d2357957472182, 0xe64f64ac930471b9, 0x50a0d0abd3a78f65, 0xea249ee75429b908, 0x2315e66afec0376f, 0xf1549ecfc0c7ca12, 0x7cb50c4dc8b949f7, 0xe1e8aef1f3b66fe1, 0x6c9ccc6e137fbc6f
+, 0xfff35182032f42fb, 0x1f54ab1f33a619c5, 0xe9ee19903cc1c456, 0x0486ca268eeaf41d, 0x8d9eba0c03625bd3, 0x4f1cf9eba2563d99, 0xe3fd246417670f42, 0x7f2c2c7c1f0f8545, 0xc30026acbcf41843, 0x60b76589a2c93e7e, 0xea164bcf4c214a08, 0x56ad73d02e8a2752
+, 0xc6d76265bb2c4c76, 0x39e522d1d76fbc4e, 0x1e511d1208540b3c, 0x6f4601f5f5b18b7d, 0x2dfda33e9d8c1771, 0x3b86e6d8a6902251, 0xe586fa3831cc3436, 0x49b68421f5f1c4df, 0x97d7c6249318a9ed, 0x2ac48099a3eb9f98, 0x39e2ba30d06fcfc0, 0x67821b61f2fce5d7
+, 0x5fd0f7b105572c3d, 0x289ee41bd1365afb, 0xb04fa97d02173ed2, 0x7eb8f7e1a494a396, 0xe86acdfa1a9238fc, 0x7ca28d67911cd8ae, 0x5b10674e4751e198, 0x36d78b26bba2d8e7, 0x7ea40ce1d383b89b, 0x2f035a77410c6a30, 0x020b2b0b0bee6efb, 0x5040347571470082
+, 0x54b5bc39054fbb7d, 0x3b082109ddd77768, 0x644e5d0a7177b6e3, 0x6f202798d6ddbbb4, 0x8647fab70019f386, 0x3485da8835206ceb, 0x30b42a5d1615008c, 0x23b9e6832a99957f, 0xfe1545c2cf7f4144, 0x5b11e4d183836496, 0x85fdfa33ff6eb3e7, 0x79d25b8bf9b95caf
+, 0x9724e26f8c32a4f7, 0x55fda8dc6e9718e9, 0x180c8fc30f2c6d0f, 0x663bad517838afb8, 0x8ae7ba6892529eb7, 0x3edd71687f5ecbba, 0xb9ab448c8042ff9d, 0x0942cb9c6a880083, 0xe873b00795eed508, 0x7a586ddc7fc9cc9b, 0x33fa0fcc56a1afdb, 0x3606f7310328ab2d
+, 0xd9892761816fd09f, 0x7211cf2184ddeacd, 0xfadb4d4ef69f6877, 0x2bfd93d0f844175b, 0x0b4c9bb57008472b, 0x592b09b0c7016ead, 0x854c24f786607197, 0x7332ccbe8baf2966, 0x684a8dce0efb2708, 0x3d64887bbc63fcf5, 0xd8b16095cf561b68, 0x056f56cf623a4d52
+, 0x58f98e06ca00138b, 0x63b660e8a55e2ad2, 0x680b02482f302436, 0x2f11d1e7799946c2, 0x36304522764f2186, 0x12b96d2c681165f3, 0x6bfcafa77601d01d, 0x2d919a1ee2043f21, 0x2cb9d7daecf8e372, 0x52c41c345bcac5b4, 0x6f6f7698027e0570, 0x62107b339228fc91
+, 0x3c09c938a703d6eb, 0x680604420ea6065d, 0x2805b01494461ae5, 0x23f736972e4e5c5c, 0x275c6f52b6354701, 0x3f8f9b589142dc80, 0x622390c42c77568a, 0x0e4a911d72d1569b, 0x30d31e6b8f192002, 0x4ce8ba01844b3f97, 0xb4dbb0387bf54146, 0x62c3d699f5580976
+, 0x21dbd0cce8bbbe87, 0x491daa346d15f0b2, 0x870df28e622025f4, 0x5cfd3d0ec5899284, 0x55e4f229383af3f5, 0x05655e87cd1e5908, 0xe8dd0e93f11db516, 0x7eb14f7d2337380b, 0xfc7815335d955e73, 0x2535e4593976e68b, 0x6574c4da5a782cbb, 0x0c462ab42140f809
+, 0x649817435c2d4f8d, 0x088e85d13eb603e8, 0xa29fa9ad828d3b20, 0x4a42b4adfc1ec674, 0x3a8743cfcebf7879, 0x6dfdbf5658894a8f, 0x84dec80c09e392b9, 0x350c6d214dc96d7e, 0xe3d6ad001b7f2d94, 0x554d9de4eb6c9e12, 0xaee2763eff620cb9, 0x6cb93e2847ccd3d3
+, 0x10f6e37cabf93319, 0x4bfd69851e404fb6, 0x7647b311e2165a7a, 0x32dedaa70b0a0b04, 0xe97fc394c36b564d, 0x1b58828accf2b2fe, 0x356eb13de7db5f6c, 0x6d513a181d3d36d4, 0xd476cf7f449a88df, 0x3f7e7fe1b941affa, 0xf1aaf0da962e1b27, 0x3c8271f15c213129
+, 0x0153a783329f5f72, 0x6bc34ca9fd89d7ac, 0x172418e29248699a, 0x5300267a18ffcbcd, 0x25e5e839613fa98d, 0x6274df7e3148e1de, 0x6d6d418327940866, 0x416669138f27df07, 0xfd2492e4e1765588, 0x41bae600bdc53e51, 0x35801551949041aa, 0x6266990f454a197e
+, 0xe52a475edabacf04, 0x4b214b19346817f2, 0x248f95df5c2a759f, 0x32e513c40e9b69ce, 0x71d114be7a8c3379, 0x0d601bf38a25ae06, 0x7e0930e88b60e4b5, 0x48edcc7d19d8697e, 0xcaaaa7cab41381a9, 0x718291ecff3af733, 0xdb208866efeb58d7, 0x4232f4d364b4b63a
+, 0x0f17c1a0f0443c64, 0x4869a62000f554ab, 0x8b5f337d9281273e, 0x5c6ef2906c403c4d, 0x5990220e14484f87, 0x21e8ba51d194670e, 0x457be566ee854b39, 0x7803ad43cea46e89, 0x7cbde4bc7044e5b8, 0x6a73b3633156047b, 0x5714baf022dc0ef1, 0x11feb23d8ac2397a
+, 0xcd3258638ecb96b9, 0x367c67fdfab3a0c0, 0x5fbcc7fe9888832d, 0x6f6155287f2a7f23, 0x4ef98e77c22196a7, 0x4a76eee670c52082, 0xc982f4fda98c85b7, 0x2b43a5a07298adaf, 0xca9575f438d68a42, 0x19740f23ed64fcc3, 0xba99bb50e3dc4da3, 0x59b880fe1f24c452
+, 0x575d25d43a5b44ec, 0x1818f8e7244c8c20, 0xb991c0db9a267323, 0x33f1d227fbaf497a, 0xca213b96d6dfb16f, 0x1a4320cf25fa14fb, 0x6c007b75f5a17c26, 0x0cd2d53882a3ff57, 0x47c440521dc9242c, 0x4193760e17bfd1b2, 0x6bd2ae8ec5a37fbf, 0x26d7665cef378e4b
+, 0x0502bdedf4cf11ae, 0x3938fc2106041704, 0x96847343bf29b966, 0x2b0a6ce41ac748e9, 0x7d359aff1b3d1f41, 0x11f53597fae577b9, 0xf7200509772a08de, 0x3d013705f1155966, 0xc7e2bfdc4ed0b034, 0x6edb3e70fa050198, 0x590d47afd167b6dd, 0x2a695b382c07fd2f
+, 0x872ae9bd1a1ecf74, 0x6e63be96d5001efb, 0x298a01bd20a222e3, 0x6b0d101ebac87f16, 0x5afa5dd8ceca3d20, 0x35f7786096c1bef9, 0x629b5d46370e7371, 0x1712dbb0c9b71447, 0x7ce31a1f63bcc734, 0x0f3146b75425c5ac, 0x450e885c61fb0b39, 0x1ffdc88b8eeecb3e
+, 0x4d2de28f0a959182, 0x1bf5d56279e5adb3, 0xb182e323dd77c709, 0x171ab790cc0182a9, 0x299f8c63b1e2a48f, 0x6936ffaee3accb59, 0xd16e51e9e772605f, 0x5374f45cd8381084, 0x358b38fe2d1b4148, 0x589dc8a20269198f, 0x72c325974014d2cd, 0x249e99fd3484a5d3
+, 0x56d5bae69cebd3a5, 0x4335d778c1bdefb7, 0x40bbcad8fce29e09, 0x3bd042af58580653, 0xd5015d6e5c753b50, 0x555ce7d24937effd, 0x123ae01cd0f45628, 0x58829b5c474febf5, 0x688e0278f2c18a21, 0x2d154d2a302a19ef, 0x6df64fcae454a082, 0x3e53115b3f7be592
+, 0x8b1799e41f2a991c, 0x067faf281ed05b31, 0x35f3f0fd223cc0de, 0x1e904e0e455f97e4, 0xa9e6e55045103edf, 0x7b12aa5a026fe6a6, 0xe5784bbf8002783b, 0x2d549fd5124e5d5d, 0x896d64a6150a74ae, 0x174bf7ff884d00aa, 0x448af5688b9a6f2e, 0x452435154c09da26
+, 0x7c640e26f8bc58c1, 0x7356c778a57a7f9e, 0x819c7de18ed07783, 0x19000b5fe38c02de, 0x46cfcb80f0d9bb77, 0x301c0f62a45b5423, 0x17edf09b349dafb8, 0x6d2bd63173de78a0, 0x107c703f49391d43, 0x0c682248dd421f9a, 0x19a10237a8c224a3, 0x6663504e79087ec5
+, 0x6b7ba68c26a68211, 0x10d800fc3e478199, 0x074b4cb9a403e949, 0x1fe9ee150fe5b7ef, 0x340655bce5d9dcc0, 0x4a99d643aac45a82, 0x66417d1f462e78c8, 0x64bed97e6985ae9b, 0xac16c124b58e274b, 0x416b0c0d7e092785, 0x669768d18035ce18, 0x1275a6a24f2a89a4
+, 0xa846246d479939cd, 0x55139a71d10070de, 0xa2cfa6ba3a32fac0, 0x4205d6b3cb293527, 0x811ee06b5ac664f0, 0x38da61db3c0183b9, 0xb641d9b16db4ec6c, 0x2a6208e901d2e936, 0xadde325a6df94a29, 0x7dbf4b3ee45c4edb, 0x041c19dc904e01de, 0x2f85a463a306129f
+, 0x523c380710b18995, 0x721a150ccc936425, 0xd3d325a42aceced8, 0x7efca3d360e9f625, 0x339b1251b4745d23, 0x59df0fbbea20045c, 0x2ddc6d6ab3b6702f, 0x225fb2819c2ca832, 0x2b965700afd043fd, 0x5c5e910e2a4aed26, 0x63fae8887b73efea, 0x50f162f6330b8a8d
+, 0xf43c244f25dad30c, 0x50c57593edddce20, 0x06cc311a431f0eb4, 0x6503e983e324f7f3, 0x5bac3295f4ecb057, 0x423a9f0860dc770f, 0x9c79d28fe6f09fb3, 0x32f0d09d1cf10671, 0xd465ec6b24789216, 0x1e14513fdd2b338c, 0x796091a2d426195c, 0x69811ed6c4ffc539
+, 0xe8754f207799cbd3, 0x12d781188df155b4, 0x2e3b37bcb6d7c82f, 0x6aa939b9504396ee, 0x29a09cb30bd895e5, 0x4b7bd92abcdc918c, 0xa3ac956216020548, 0x77517f7edf9e1720, 0x285f087f704c97c1, 0x1d72fd4b691a81ba, 0xc0936e6118dc8fde, 0x23388c36285476a3
+, 0x66f5167e97164ae5, 0x6b96b2f47ce6ea0a, 0xe54d0fc9669aab05, 0x25ecb7e4ca9ce550, 0x1d8d58b9f030e6d6, 0x081095dab1eb108b, 0x46e4a65e0d4d118c, 0x0872538b36b66e48, 0x3c84d5035003cee4, 0x06a572ac5f7e4839, 0x3cc56448514853b4, 0x7447ae2dbda653e5
+, 0x0b08f2cb458a4bfe, 0x7d980d7d9f66fea1, 0x8a254b105d58713f, 0x3529c331bcf560d0, 0x85a8a551d0c0a649, 0x239cff6999176697, 0xfc681f9aa5458d77, 0x144f8813a421b26e, 0xe6ec2c469a6d33b7, 0x4370577f105d1621, 0x18ade9569dcbc0bf, 0x6ad0852b3c158e4a
+, 0x2ddc372037ec03ff, 0x3078f4b3194a0f14, 0xb3258a20512615ad, 0x0b8e000cd1620461, 0xa2c7eab193e80369, 0x3a482d96cc796f21, 0xb71a93971b517184, 0x12934860f37f52f3, 0x5d48b2f87b65793e, 0x7bf73fe2e5abd41f, 0x4b06479bdaddfc7a, 0x45d197704d6d191b
+, 0xa987d24a5332b2cc, 0x054a17f2c1da0878, 0x1e019b33c2faa0bc, 0x2cff7bb867ed3050, 0x362d31b3463f9ea2, 0x1b01d4c3dbce573a, 0xc7de5aec783b23cf, 0x301db347c5885695, 0xa90a2125f6a2f079, 0x4a9cc1d176a7b57b, 0xf0aede9788fca88c, 0x097690656c8770e4
+, 0x30122dfdf8cd77c8, 0x765ef0d0800bdb1e, 0xc988d79bb3a5d06e, 0x2e08a9b2629a60e3, 0x9f303b1548dfa7dc, 0x02746134c95efa43, 0x4f1b2fdd7f0f1ea1, 0x32186540a5315b8a, 0xba6a3de08cc0e81a, 0x7adc7470419666a6, 0x2db93ed45ce35d8d, 0x6dbb40ee9797c2b8
+, 0xd417a308f6346f37, 0x26798b583c54a874, 0x44b93312dbeb9c9d, 0x1883427400aa1d95, 0x217f374229d836ad, 0x36898e0932512865, 0xed7bfdd560de29b5, 0x107e461aafd5aef5, 0x25d1788feeff3ac9, 0x1a3b264aad5623e0, 0x8dabc557458e8b04, 0x645bf55f423783f1
+, 0xcd1627419864e48e, 0x2b489e532fb70cc5, 0x12f45d668bdd5fae, 0x52fd8fe0f5c7dc82, 0x9b45bd26af370486, 0x1478342598c1873d, 0x402ba095cd38c6f3, 0x4b52cb2a3f1bacb2, 0x6b3274abbbe126dd, 0x6a5a747043f143d6, 0xf8b7905955932b57, 0x4ad2d3238429435f
+, 0x15532b59dd6f660d, 0x6a8002de4a0bdbe1, 0x599437a088d4a976, 0x11c82e086a8fb246, 0xf954ae0c614976d0, 0x471e8ecb563f177c, 0xbd7fbce6eeacb7d8, 0x4cfb30985144b455, 0x8a4829d38715640b, 0x21f6d6f151f069c8, 0x6d56cd4e9bd28e7b, 0x26ec1e7988da372c
+, 0x1743d0ed7cda8abd, 0x22ec8d49e756a0a5, 0xe9e41f6af1074ae5, 0x024e07a367106efb, 0x89f9aa114a2f46f5, 0x7935415a05d762e4, 0x811a3388f428a0d8, 0x5016783e0c173ace, 0x71005b516661f653, 0x6ef38d3db8b91647, 0x2127b150aac15acb, 0x54e3c0826fcf96a9
+, 0x09b3a597062109d7, 0x745aa26fca7c630b, 0x23c47e1ac0139583, 0x04e281d16efbc363, 0x16cf211672ff9862, 0x05e5c96ab4e2175b, 0x644bcd2edf91753c, 0x70fff2338dd51543, 0x62c32718640299d6, 0x24653dcd5135a504, 0xd2584d3482353740, 0x6b9c0687b0e29393
+, 0x6260493cdd2e29cf, 0x38653f5d49476d38, 0x9ee9b94f6aa86be4, 0x3333860f837017d7, 0xf126b6efa6a21d1d, 0x728d0fbbaa90ac29, 0xc1fa303c176c1bdc, 0x6a84ca78b1871c69, 0x8659f8dce30e5510, 0x2988bd19d232d868, 0x9f777912b8846d95, 0x2d1d3f5fc65ad01a
+, 0xb4197b9f7f7c03f2, 0x091c1e236d82067b, 0x13f3b359b8411b69, 0x4aba2ca8432539d0, 0x16e90a1216442abe, 0x01ad4d20c720a1c9, 0xb662dab7012a7040, 0x45900a80d8e6be05, 0xba15444696a228a5, 0x31825503525c2449, 0x17a04e1d295d6557, 0x0f42c21ca0902b23
+, 0xeb713e167987cb75, 0x5fac0f589771bccc, 0x7fab84e703c51796, 0x58edeb8d3d51f9db, 0x692722582a4e5ea6, 0x089126221be5eccf, 0x600e1e21334d0c9b, 0x453725349f3be1e7, 0xd1e47efe46b66bd0, 0x7b665acc3627f565, 0xce195a5a1c8d29cc, 0x611ad6c6ef901e4b
+, 0x11de1a2c8694284a, 0x22508dcfa1b3ee01, 0x421503e47d883306, 0x0a054e9888f108e1, 0x5cf2384968b2b1ab, 0x48bf7704e7a48833, 0xca466adf35573f74, 0x60b70dab823afb25, 0x93a3bc85fd018f05, 0x387dbf86a79404e9, 0xe7e9185af3196ca4, 0x6ad98987bcc81e5b
+, 0xeed347c5caf2fa5c, 0x7b45790a91652386, 0xa4e97e1a10dd7576, 0x2c4309b148fad269, 0xf04a22cd7857f861, 0x33d8ae5c29cd5b5b, 0xa5ed97ba13d429ec, 0x6e96b54ace6aa0ed, 0x493ff2e9a47a3224, 0x4b666bb76686485e, 0xa0f6effd51523c62, 0x50a327314b0ca0c6
+, 0x4e4d97e460533324, 0x4d52e35aa3f5cc03, 0x1b20a01d8df7ac14, 0x407e69bf40206579, 0x64915b77a0d7a830, 0x398b89dda74e772e, 0x8f34cc7012b5ec58, 0x29d1fdc1cc4aa7a9, 0xa854236974758276, 0x4b20e92e0652661f, 0x12158ccd30447ba7, 0x65f2207818a08eb5
+, 0xd23e30e0fd35eef2, 0x59d84c8ba21a50ea, 0x1209b32f51672844, 0x1425ab7bd410d746, 0x612f76a867785932, 0x023a95237c4ae953, 0x6db62b94488ac57a, 0x0e1ec48b3e04e367, 0x302ecee61dc44c2f, 0x2e42798a86db61ac, 0xc01a19bcd7b71822, 0x03a6ec8b58d8f0fb
+, 0x70a7410d355f0d4b, 0x58e9aff8ca024059, 0xbc8761ed2aaf30b4, 0x2bd2935cda723709, 0x1b7ad84c01038409, 0x663000b1f0fa44fd, 0x798eb40d4e5db22d, 0x70ad0205b22fbd55, 0xe6ccc13639a98e06, 0x13a6b46d6769bf6c, 0x02733d5df2d3416e, 0x64c50fc0d2ddd1b5
+, 0xe43715820ba0636c, 0x54ac0a94101587c5, 0x4734dd0f06aab4b7, 0x38a3be2de3ab34b4, 0x4cbf702d67113d64, 0x290098aaa29d2b2f, 0x18b9d22477c0bf77, 0x70df74f07a3b5a51, 0xcc816fc49591dc2d, 0x0919cc8367859a2d, 0xf412ca607d9b69bd, 0x57b5d7af84c1fc31
+, 0xfc736e666474bfc9, 0x4893fe54f279efd9, 0x8924f477abb80c1c, 0x7263162608031150, 0xf06e10f60f31ba0b, 0x12288b30d1824c39, 0x2416327d7b69dd7e, 0x5fe12f173125c330, 0x1045024358163705, 0x6db38312c1c6e75d, 0xf5c6f6117ce5cb9d, 0x380a10aec1492dda
+, 0x93de145ac766fd5b, 0x5e90fd5e5131ba8d, 0x2403f6ef11445704, 0x7ac234c9e1691ac8, 0x50cc02656886909d, 0x7a41cbb1f3a372d9, 0x3267241f52b9ae6e, 0x32f0fe77b2568981, 0x2c84aa6afd62595f, 0x226003821a0e9e32, 0x6f5ddb8c4c0b5002, 0x44888bae6eb5e900
+, 0xe880ef2120088661, 0x241e8690367859a5, 0x2cb6d4d942914dfe, 0x3960e5add3ddcbd7, 0xab49fd40a77dad55, 0x1ca182abaa0c3fae, 0xe7f90fc1b1ff25d3, 0x6e582f54fc03ecf5, 0x06c728406b6bae97, 0x2f3c4d0d77792985, 0x0dcdc71ada384505, 0x4fc0fba0a901fe3c
+, 0x62c7027a288a5ea1, 0x5a01c0a86c5d98b4, 0xcf78ff2b6f467ce1, 0x61d4304f64659a2b, 0x4c731404b20299a6, 0x5b23f487ed583e0c, 0xafce5b574a0498a9, 0x1cffef3475281e64, 0xa2b2808d6d6ee3e8, 0x6f15656b2cad7a31, 0xb59b358344337851, 0x198ad82f1d3762c3
+, 0xaef38c61c4e3ea6f, 0x51462b80e3607e0d, 0x00f90101707de243, 0x1fb8cc3662be3c0e, 0x96095f0313f2c579, 0x47dad4e5c107a769, 0xf8fec48148bb82ad, 0x2c9addbf81d4fba9, 0xb5d61f02b6544d28, 0x5eec6753de4b7e8c, 0x2e3bceb2058d707c, 0x0bbcfe75c43ea213
+, 0xf78bf4fc1400b099, 0x218fa38e61e6c442, 0x158aa9e09e7897dd, 0x2f5f8da554fdfa33, 0x4222bec19f5a5f26, 0x72dae6328465cb3f, 0x6f6fb4d9eeb7f1a7, 0x771c67c61e5a2bd0, 0x417706c30b755f06, 0x5ae84a5d3a1f7f6d, 0xa54ef9be6c5db5a4, 0x13f6e59b283fb835
+, 0xcde8e934325cc8fb, 0x1e3f4cbb030c32c1, 0xabeb0a4e4c901b53, 0x301c344e9d453af3, 0x0a5fcb41e251055e, 0x37a4a8821f6df3ff, 0xea69da3229055868, 0x3e33e1f5724bc2ef, 0x7ea5254ff2aa5f26, 0x2efd52d51b3ed229, 0x3f5efaad0c2b97f5, 0x1d0068410473d420
+, 0xb021838ff1b8618d, 0x5bbb13effc6d72f6, 0xd67733ff81ad1115, 0x64c086585d1df682, 0x9e691a5191c5f8fa, 0x58f278f69af0e8f7, 0x943b8d09689e9a3b, 0x3bc6d89567edc1b1, 0x49866e9fc5983e99, 0x4a59859c7e61ab93, 0x9a0ce1cf274dc31f, 0x360ba6e2f08c97ac
+, 0x9618344768b93520, 0x13760d13e1be7c8d, 0x9b57b28c7c196d2d, 0x7505794588c7dd0c, 0xcf1749b01a406dd0, 0x33a3de334d922c36, 0xad3ea4edc7ceec01, 0x11072e1652ddd853, 0xaf75220ab55d150d, 0x4b6a214eec57b791, 0x15b242fa7d1c00f5, 0x2d12e36c40634828
+, 0xc9dc9f942ec34899, 0x51df2c77904b58da, 0x60d0213d104d7c56, 0x08fef96b190213f2, 0xbd7f3a60b8fce55b, 0x1188865ab4c11b20, 0x69703613ce8cd22c, 0x46f49ce382629b1a, 0xa599c66467e39be0, 0x75211da0d2f91052, 0xeed4a93239c13de2, 0x135cea3d0401c89f
+, 0xd80ee5f512e1e130, 0x12ca9f6626fdfeb2, 0x3af1eecaed8541a5, 0x36d94edeed77bce2, 0xad0b3301609a531d, 0x43da9ccda536b988, 0x16709f9c1ea0095b, 0x6614276fda5e9cb8, 0x127586e6d8ca4a0f, 0x16147e8ade03e1ab, 0x43baa34f23f9758a, 0x48cae7ad607dd5fc
+, 0xada591061dfed38b, 0x496048fbae8db82b, 0x67d7327fa04a5ec8, 0x6c3be5c5d4f62962, 0x7a16acd105d54b4d, 0x38155270afe88477, 0xcd134e9a5b5a4169, 0x5505713812ee5765, 0xf01af42843d20c93, 0x1ce2881347d98fd4, 0x019c592535c6ce18, 0x601df0f6b492013d
+, 0x907c757710f2813f, 0x6d1d08be12acefb6, 0xebee018997f18afd, 0x4fbc4243d7b23a9b, 0xaccbcbd81993220b, 0x50b053fbf367a18e, 0xb9c80a4db4118b98, 0x7f3701e49fcaf100, 0x27b30adde05e8bdc, 0x52ea0733e329bb07, 0x069946f379d3a170, 0x5b34de8263277a0b
+, 0x7c398e8c9173e77a, 0x3e23b9e47de3ab3f, 0x09107364c3372abb, 0x47500ca445b3f5d4, 0x8c2aa0f6195642e6, 0x7e185cff039f4769, 0xa6f20706fff99ca8, 0x6063937cba39f8a8, 0xa97ad49e0fad270e, 0x23b935c06cb1b586, 0x0ee991be24b24e21, 0x20257e66c8882b47
+, 0xb58d4e96ae943017, 0x0c4bf22562fd028d, 0x1f6308a2755048cb, 0x340214e97990800b, 0x8b4753fee20da199, 0x1dabfdfaf30593d3, 0xb7b3116bea97f9d6, 0x7c64ed1910a5134b, 0xbe26427c7cf6e87f, 0x5ae2fafd1062077c, 0x9b3c291583ab3f41, 0x5d50fd3be5df205c
+, 0x87edfe5b26207112, 0x002132aff8f2a3f3, 0x09bf1546a5abb316, 0x2f9feb12be888311, 0x37c230153e4a149d, 0x2571fc113e3710bd, 0x3013edd6a5d0aeee, 0x47486bae649b4407, 0x9ece008f600d9554, 0x051e341ad1cd155b, 0xf1d40f4898d4a7d4, 0x258ebb00df8bab4f
+, 0xde4a1cf3c9e1e19e, 0x38494f3228132a2e, 0x124ff4e6aa9aa179, 0x69213badcfcbb6ed, 0xa4f978c8ac0ab390, 0x2ef510c7bea0b76f, 0x39bfff4f6d48c650, 0x06832806f68eaab2, 0xd3b42c1cc9f71cd3, 0x56eece391a617144, 0x93c00547e773331e, 0x58279c52875920b3
+, 0x21b8b6b8233538b7, 0x21345dcd896146c3, 0x91855b6d5bb95807, 0x013456cb3a00de2a, 0xfafcc01649ce03f1, 0x270f75a1dbee138a, 0xf67ef40a60cdaa28, 0x58feabd574feb739, 0x2d5a1433f56fa96d, 0x17395dc8d57cc96a, 0x62517e0280cb082c, 0x1a3076013a13458e
+, 0x5f245b216dd62271, 0x54b1e07fd670fcfa, 0xd122b74a96e35def, 0x129b37c9eebca8d3, 0x710e484df85d5578, 0x30327d9327cfe212, 0x6b32f8bad1546091, 0x5ae614125d53ac68, 0x7883896495472142, 0x79f21519beb0a074, 0xb06312bdd2efd101, 0x0c38596caa1dbf64
+, 0x3b2604a12badee79, 0x3069aa0c8b7744d3, 0x493a132c17e7546b, 0x2f8d858de52d6f70, 0x594f7bf7bf01e704, 0x64d51ce338a97549, 0xa11c56d4c71a5ffa, 0x48554d768c060cc4, 0x54b8b90bf5b72755, 0x14f26591e6ba0179, 0x6909ce0ce2594f07, 0x6433f9ee4aceef4b
+, 0x4a0f5ead2cdf9d58, 0x6fafbd083326668e, 0x5a559584886374ef, 0x7aea9a73f0095c6b, 0x0a77c3b7277feb8c, 0x6554870ab9f211a8, 0x72f52202c7935ffd, 0x043db42ba036bb82, 0x6b4dbbdfcba83682, 0x37f85e5823e1727a, 0x8a604fcf52735e83, 0x6d0920523c7787bc
+, 0x8ef6da262c1c4eb1, 0x3295da3d2c650209, 0x7f7fbe6f507acaa1, 0x1a8c4e56fe3d1761, 0xc958832435178b7b, 0x1f3eef5e415970af, 0xe421d2ea689cffef, 0x76c87253ee527621, 0xa99a3af1927bef59, 0x16bbfa08652a23bd, 0xd746d29d21db9455, 0x3b39d37a04cfc222
+, 0x9aa65dd314133d20, 0x06597e63a699fb1b, 0x059fa16f567341e6, 0x7ab5116126d4ad9b, 0x7cbc1f56b328f908, 0x5255ba7d13f2e4e6, 0x3aa579e7497c36a0, 0x1e77663124aa4d95, 0xf3e2e8f04d486f1f, 0x7c697f99e45d4ce4, 0x98660ed0e6fb33fc, 0x43d3de42114fe3b6
+, 0x8e4706a6c8262ff6, 0x3257ecd81072af37, 0xc6a86822cb18e0cb, 0x217b4883287d6ccb, 0x7667d1e1fcb6ada8, 0x67becc0e70734be3, 0x34ba8cda9f09c116, 0x5b4058b13fbf1252, 0xab04aeb5e1caa5a0, 0x258c594389f4ac08, 0x0f0ed63f16df70e5, 0x257987a63b866736
+, 0x459abfdb73053827, 0x19fbe13f859ee8d0, 0xc8bc52440da55013, 0x126d5df47f1d73ec, 0x6ba415372cee099f, 0x66ce2ca387120e6d, 0x944e7f2df5c6a902, 0x4fd4bac35ff9263a, 0x7b3a8bfc7e4a3793, 0x1d9080bce1b2d1e9, 0xd7cf10713f710fa9, 0x4c9044d16e4ab6ff
+, 0x82ada6a4a6a5af2b, 0x6eced37d61d26be7, 0xcec1cd720e9d2341, 0x5ebc79f7d2c5d117, 0x0e6380fe94746543, 0x3528ae6ab912c65e, 0x3a5702b882b06afe, 0x28c9d29be8b14c9e, 0xe085e75a81bafd48, 0x48e2c46f8adb23dd, 0x6c38043d8ffd5e1a, 0x06bd27d949dff0b8
+, 0x55b70af2bfcbf4cf, 0x1f156ee7fde4f9a6, 0xc58978d52926d3bf, 0x0671c666c490e0a1, 0xf4ab8074d12991e5, 0x1ad3da8265bc9f19, 0x4322f930f91dcb6c, 0x0e3d3789718521e3, 0x52fcda483ddef88a, 0x310fc9fa61628083, 0xd5299b811e6d1df0, 0x5813038f803b4082
+, 0x478b459f40ef99d8, 0x763e4e2d3c76ab5f, 0x4fd383bb8da638b5, 0x7e67f1dd54738ec7, 0xb9ef25981f4b2ee6, 0x66202446828ed1d0, 0x4d38b9f9bc000d31, 0x7c8bd2b3f9011993, 0x5c96ab1882de2e3d, 0x384d24d44c29f32c, 0x970b292efc9c9643, 0x409adf963e067867
+, 0xcd8c1cebbadaef37, 0x324575cc826f3ddf, 0x8b377a7c1344b4e7, 0x7b01714b5409d8bf, 0x5f202aecfcd079d5, 0x02a8f47afd8c32ff, 0x26ecd7a538ea3d25, 0x1bcaa1914cdcd438, 0xddeeacb44d0f6638, 0x00e5c277a7766baa, 0x113f8ed19dd5f4b0, 0x3c0978987854bebb
+, 0xcdbe6a7a5b453dfa, 0x5897000e3ba8350e, 0x22735f6c024ba922, 0x649a77dca39c5ec4, 0x4461a3d923e08d6b, 0x18dd3232387cb989, 0xff05d9d37943516a, 0x1da61593c315669c, 0x8b598d32392b46fe, 0x646a5e52d5063267, 0xd317653b6fccfdb1, 0x5073ec1d86d9c6af
+, 0x5afd569f2a2c131a, 0x14bc562e3508590d, 0x88f13d865ec19b7f, 0x1ee52b1cd0256098, 0xed1bf7327ddea790, 0x00da3cc0882b6986, 0x5e833149f994a99d, 0x499d78236de892cf, 0x90639c2b906f85d6, 0x2f5a9257e6c0e14f, 0x15dc057c3be096d0, 0x75d3dce18d99d004
+, 0xfdd5bf56cf6304ef, 0x2275238f46d552f0, 0x58821e4114ed7465, 0x32f4c661ab2ca76e, 0xeca6dfdfa576880d, 0x3fe0988352574fd2, 0xb458a9ee797cf685, 0x1d47279e6c993002, 0xe0678e291ba9ef2e, 0x0d308601092017a7, 0x76f55ff08410ecbb, 0x019c1ee3d7b91532
+, 0xea228dd9dd2356fe, 0x415287792c4df98a, 0xef312706a7375a2f, 0x5434dfa2c32f0ff7, 0xaef89e63e016bda8, 0x1013341cd151b31c, 0x53f0c4fb4e182453, 0x08a29578d90b2429, 0xd227525c806b1595, 0x061faacf3f822f38, 0x9cad66ca4d8d5113, 0x01433b36a9f51d4f
+, 0x0fc630d53d73c5d0, 0x696f45675a9dfdaf, 0x0a2654319b882808, 0x1514bd81d3d725e7, 0xc2e029b3a5f904bb, 0x7da916967dca8679, 0x6d32e5bf6eb856ed, 0x0c3eeb7f496d857f, 0xe67e4879f03d0bc3, 0x2a6d8f450b66a268, 0x37531a9f41060f9a, 0x1e1ab4635de33577
+, 0xc3303d94c2a744f8, 0x4a6d9ca17d23b8fd, 0xcecd3ad3585c9a22, 0x07d3f5a13be95668, 0xddc8cae57f9c39a6, 0x4c0efd5dfee37d76, 0xe128088502dfea66, 0x4c9ec20453e00c49, 0xf1c3707f149348d9, 0x73aeba002ef067b5, 0xaf01661a97875f10, 0x50a0767a59ad7af7
+, 0x8973dff7e1b2e166, 0x621f2cc5c46761b7, 0x01c0161b5086c7cd, 0x3f2e6982d83a9c6f, 0x1742f83b464de045, 0x75670c629d6752c5, 0xf2ee079117f7c54d, 0x5b1a6e06ee78ca4c, 0x263356adf3b6181d, 0x61b8eec9808cc827, 0x0f91a6b0b86d7adf, 0x7906eb093dd843aa
+, 0xfbd62bfebc95b503, 0x67238d2e5e284371, 0xa42b68b4b099cb37, 0x324f5d68a660f836, 0x4cc06bb4e20d3313, 0x3eb914b370c1858d, 0x355418276c4a3fea, 0x7b114b5e36ee5662, 0xd826b64ce4556998, 0x5a2b9737d1597cce, 0x9525075dec4b0073, 0x37b1253252afd52e
+, 0x827167855755f38b, 0x5879e46561e1b63a, 0x288b9ae34ef84748, 0x14e999d54f038df3, 0x3ae231a0c9d6533e, 0x02af8066d70bdcdb, 0x571e5c768d621f66, 0x1d64f96ae63f2847, 0x236291b80a55d8eb, 0x28fa85b012be9f40, 0x787cc3e7fc67ce97, 0x32eae26760c97a4e
+, 0xc28d3ae102eff90a, 0x3ad8583ab21ca84a, 0x7f358986db871ff2, 0x634fa797bb3a3a80, 0x955529ba61b19a20, 0x6db59e9f491a74af, 0x52ac3ea4cbb290e6, 0x528da21a1daf9ef6, 0xeea7b7aca98c1400, 0x185794938d6a09e1, 0xba60a098fbd4e383, 0x5a24d45ce487170e
+, 0x04c2aaeaf94e0daf, 0x371ab3cbe9be348c, 0x34dbcb5fbc22daca, 0x207e2ba7501287ff, 0x4353e0d8d142d31d, 0x1a7b564b48ca6eda, 0x9185ab658bd576b4, 0x041003d77f019d44, 0xf948eb65ce577e4f, 0x1cda40147d31486c, 0xcbc4906da1dd1e3e, 0x6a7fa8e0d26b173d
+, 0xa2aa85c710b8ce89, 0x7024155e5d5527b0, 0xec226a342a0b55a4, 0x5fe13ec69375be6d, 0xa11c397d041deb5e, 0x5c014f0a50282f77, 0x51886929fec00ee7, 0x20a2006d1d5165dc, 0xd3b6e79b02501975, 0x623f1dec2e796865, 0x2cf0d93a44ad94a9, 0x21d03217b68ff7ce
+, 0x71065d4af9d46f1a, 0x793b3067ebcdb66e, 0xa989059371d3495e, 0x588acb91fce58ceb, 0xc8ca5302ba7b3aaa, 0x4d2eae260a050796, 0xcf2293d988b83fda, 0x573b25a901cbdebf, 0x6ceffc9545d38f98, 0x6730c9600a96fdad, 0xa3cc1014bb3d7b79, 0x7f9cf303f558e2ed
+, 0xce5c13ac3c800fd7, 0x38bb221e87ccb34e, 0xa4be6f36ecfdc4b9, 0x299841fd6a79a0ea, 0x35be5c2110ae7a93, 0x658e1c618827e7dd, 0x185cc98f12f7560d, 0x0f3b8f110a116967, 0x30db97f5938e167e, 0x3c0df71ebbc80d1f, 0x46be9e711f04b02f, 0x1f53e21993d9c3bb
+, 0xc7952bec2242985a, 0x4289d35a2c0697a7, 0x34bb4a389c03d693, 0x4bb4c34ba50c9878, 0xf9361ab2d8abd8bc, 0x3073ed34a8736579, 0x66f153635201d22c, 0x027fedd8849118e5, 0x1500fe38c14e6cc0, 0x2898f156e019544b, 0x99edfeffa302de4e, 0x360235f8ed30e19a
+, 0x26a6af3c30a50a88, 0x68231447819e3f9a, 0x17c1fec466d56791, 0x2c8a6fd775c5e8be, 0xca134c51a6998738, 0x2b2e2268c24cc128, 0xec63dc51cf1a8065, 0x6c6ffa720c512151, 0x0143d9d8c339b27f, 0x51ab6bf23c9114dd, 0xb2458a0d9c53c232, 0x7f66b5369ced2e3c
+, 0xa7c5f795742c38f4, 0x3f4aa4d640693349, 0x816b2e706f2642bf, 0x1ca8e7a8733530be, 0xfffd03b98bdc16a2, 0x0b3a243a64bf30bb, 0x8f5f4c30d76a972f, 0x06066c98767474f8, 0xad9923c05305cc12, 0x4a40b187e1442fa2, 0x7372d5b7422e8675, 0x2664154853e06701
+, 0x27737a923890b56f, 0x34d3ddf8899f3a12, 0xc01a80db5496a7e1, 0x41867fb1980a441b, 0x546150654b7c462b, 0x4ab4fe519107bbed, 0xacae0cb4662c8694, 0x24f26c70f4cbf266, 0xcd322dc062bbfbd0, 0x5e8858b2cddf9257, 0x2f2e8e632af48888, 0x479fad0d0ba9af57
+, 0x7628a4b7dc578e43, 0x24f9175e674f8a79, 0x1a1f73e917c9aac0, 0x02f0da1bc0fdabb5, 0xc02f83ec4277f750, 0x798e3549b5bf048a, 0xf208acb648a047ab, 0x22afdda114b69c85, 0xf5ad8d899c926d66, 0x323d56e16afaec20, 0x5348dbe71c85729a, 0x7e1a7f52c49b4850
+, 0x263fa1a17e71362e, 0x048ff80bebfd0d36, 0x91882470909832a9, 0x1462017924f37afb, 0xe3272a97bb209b57, 0x16e23ba9eeef34b9, 0x5654cfeacf6fd445, 0x355ca5dc8379ce62, 0x21d7fd34b7be7603, 0x1bd0ddeaf18c16ef, 0x17201870fc381a5d, 0x16cea08858dc9021
+, 0x556d07f5764debd6, 0x5173c993c8b9bfb5, 0x2474bf36aac0cec1, 0x661bc2aca4d57b76, 0x5b3b9b636558ee7b, 0x7d2692b4eadc817b, 0xe545753f6e453e7f, 0x54aaa09eac60b812, 0x84fe3f971d8ea8c4, 0x59bd68f72367054b, 0xba38f9a7f9c7c104, 0x232de6e2a414ea57
+, 0x710dfd1ad57be501, 0x141c58329720f38e, 0x095b11e5d84da49f, 0x2788547ff7654aef, 0xfd82debd91e08501, 0x1561057f935ed886, 0xa632a2fb5382fff3, 0x65a0bbc01a02fccf, 0x7026f36d6393a8d6, 0x6c2f8101e2a4c1ee, 0x86ed7b49a78f825c, 0x03bcbf8ccf4b6389
+, 0xa56343a602d0aef0, 0x73fe006539b2b276, 0x0ecfa01a52fd3a23, 0x2de27fbfe8945963, 0x095b0367b7528cde, 0x31c09a8aaa438aec, 0x48eead94693f2c2c, 0x044944d4656c4a7f, 0xf202d609e4910be3, 0x4f55d305fd77d033, 0x7375043adfa673d4, 0x0262ec51961213e8
+, 0x5f4995b2d4243717, 0x353b322dbc0b63a3, 0x923fd28c383a2db0, 0x42204eebd4d94421, 0x14b8ac50b397bd8d, 0x1c844a2384369e09, 0x97811e43818cadc4, 0x422e3487db6f42b8, 0x0eeef2de3ea38a04, 0x146d3c313e094b50, 0x3cb9600a96c6b869, 0x611680ba1163cb4d
+, 0x8383c8f2377499d8, 0x22b57f111bc4bdcd, 0x7e2025fe754135f3, 0x15116bde442548d6, 0x0ef3d8359c323604, 0x2cfb377be544799b, 0x8191bee05dc8a025, 0x2042a90e9eedb839, 0x5b76bfcd79303afa, 0x5a893b528f62777c, 0x72e2bad71c03de03, 0x7c99f3a99902932c
+, 0xc8edb3ba92ee37d6, 0x4ff453a69fe60402, 0x1480388c67816759, 0x1044b1db955148cf, 0xa749040677cf436d, 0x64214782836a9ab9, 0xbe54439ccdd3e30e, 0x01ec1a0801202a34, 0x495e1ae172a05c44, 0x475c62f73e99b9a7, 0xd14bc4dccf5f5dcd, 0x1746e3aa1e7db7d5
+, 0x43fb79f495270b50, 0x1067a5bbd36b5bbc, 0x50d42726d6418557, 0x647ff82b01f992a5, 0x0bbbb34d98a89433, 0x761c017305868794, 0x4aa65196aa6dc483, 0x03d3a44141bffcbf, 0xc4024801fdc1b716, 0x2eb18b77ab6f5415, 0x69813c41cca52236, 0x2dc3d9e4b06e7a80
+, 0x92dd55d5b678ba18, 0x0fc0132bef817903, 0xec7c405929f2ba77, 0x026f67fe77b6d8cb, 0xa89869927998d41f, 0x6df8d0da1f039160, 0xfce544714c4180a2, 0x0c596fe7f5852927, 0x8898254389dad7b4, 0x645e0d207fbdca91, 0xa935a616340f4a37, 0x796dcedf994cc6d8
+, 0xa8a7ff3c50b4da3d, 0x62038cf1c2cef9c2, 0x67cd7cf8d8b36362, 0x54c264f1be3db794, 0x717dd2e213031827, 0x0e22de91e02eaf69, 0x3a4acba76cbe5bb6, 0x5c4f1d91f5ac43aa, 0x156849e55a72b32b, 0x2de323bcdb2d2aae, 0x6abaf26ba0ac15cc, 0x4390e3485b1ca57b
+, 0xee488de359d0cddc, 0x2cdc509fa17c12d4, 0xefcf36b3ad8b4037, 0x24e90f30f60e8094, 0x51ac564ea55a17d6, 0x052760bbc6fb6fa0, 0xc61c8b7a360b1743, 0x1c17f6863644c5b8, 0xab5471666454cd4a, 0x53cc1e9365c5b0b7, 0x1b73d979a9bd0319, 0x14ce413849bade29
+, 0xff46a850d8e73ea2, 0x38e395ced2c9701a, 0xb58ed9cc20910af4, 0x393073a3064592a5, 0xb78dc279b560748d, 0x00d29d1cba2b823d, 0x1ec55adf0538d725, 0x03e9fe503a567c7f, 0x0f94a1ccd7650ff7, 0x159614fe19a7451e, 0x7502a583c1bbae8f, 0x7dd9f822ccecdfd2
+, 0x3904dcf667521718, 0x6e15c54dfa83e3a0, 0x2ad9a2187fc2b91b, 0x4a820e8ea3c76fd5, 0x4844248b0a4619af, 0x53b817fa61b9e293, 0x92f1f2107f8cfb33, 0x5435296b120d5d12, 0x1632ef27c53aa46c, 0x75b129fc9e8f4be6, 0x6083d5435cc5b7b5, 0x1c26905cc1fcee3d
+, 0x092e08e4c0702c55, 0x2c3ab873759c52da, 0x5a88877edaccc5fb, 0x29fb8d239f1aa05e, 0x14353f250dab21cb, 0x4bf54f85c02bf8ba, 0x2cd1350b372fb310, 0x1c83d7104bad81f6, 0x10532ebd93ad0edb, 0x734ea0679c88fb04, 0x2b2b00ebcd275718, 0x4b9f1aa0b1a4e6f3
+, 0xa80201cd80be1013, 0x5ad1fe0c7efc2c8e, 0x16ea80e2d8e5ae92, 0x082d02390d58d562, 0x6e445878748a38a5, 0x2700ed89a16260f9, 0x1e897299633b7564, 0x75b9780cdffa72c6, 0x14fc73cb473f6a05, 0x4f511f93211a96cd, 0x0f602929ada25115, 0x61363403f5ee62f5
+, 0x4343f33215847479, 0x71bdf81fbcb68e21, 0x27bc09ceb16f2163, 0x59b9779c0542711a, 0xab99bc2b780a167e, 0x48c7aa517d19a422, 0xa8d5ad4103c90106, 0x327291a840376700, 0xfe9e8c31a0683bc7, 0x47ad451dd596e870, 0x6b10798f61f80eb0, 0x30ee2753cc47a77a
+, 0x735905dce59611cf, 0x210497787a0e4182, 0x14943013a23c60d8, 0x7171d74c7bf1d049, 0x758afa420b57b4f3, 0x53ec6944b0a46738, 0xf576f548b9cfec47, 0x1fcde918f321bc77, 0xe4d5094a30b3d4d2, 0x74ba5372bb00991b, 0x40e96763ad2ae56b, 0x744b15505212821c
+, 0x8d97a11e91f73267, 0x1ad2db9b5aff083e, 0x5177ab499c5a1424, 0x20df631ae65ea48e, 0x3ec8844222e794d3, 0x50724a0df804fa82, 0x370767bcaecc5d42, 0x370db6e86c7fcd7c, 0xdaf3a38521f33e46, 0x1e9dc79d5a003461, 0x471b03b8e64e7798, 0x2505528a24a75556
+, 0xda47c8e999f092b8, 0x7dce42d1f752eb73, 0xcad173424da35014, 0x77c5a309fbe33f69, 0x34715c99c914c36d, 0x6e0af6b300fa9cfa, 0x430085c1ee15cf25, 0x258ecf2c3e7c0e7a, 0xab82558d1c01350f, 0x6864a264168d3b73, 0x21340ac15646e8c1, 0x3cb24af063a59434
+, 0x4d8c166eb37814d0, 0x05e97c26ae39f588, 0xd62aa4639225f080, 0x7eca0d9d550ce397, 0xb86b03e558603380, 0x3d7a7364c36f195a, 0x97568454d50324ee, 0x73487fe7ffb3f6fa, 0x22c2ab9cb641a823, 0x1a4a535d3e8eedd8, 0xcfb18adba0f06dbc, 0x2c8d529dbfcf6ce6
+, 0xb61b9a229cae0d7d, 0x234ea038ab363a04, 0x554f57ae1dccaa86, 0x46e98fb8d1986b85, 0xa82533472cbb4a3e, 0x30cee54e8a9c8752, 0xe5d288030b516f42, 0x5f24b54b31427896, 0xbcb08b5479302710, 0x5e8f60cc615a29d5, 0x86f493703702d6eb, 0x29d389ea3322839c
+, 0x5af38642ad5059c0, 0x259310e3c21af768, 0x50b74ac9903c83a1, 0x23d596d5ab6d65a1, 0xb063c50afbb233de, 0x77e6db6215f5ca04, 0x87f876d1ad242bcd, 0x3cca8b4546ecc984, 0x9c3ed721755f0263, 0x0d7b5a029947260d, 0xc9edbbb22f23a1ea, 0x2b01d7789d9a1f5e
+, 0x9194f9a072434a18, 0x4a03f01925a9b93a, 0xada787e1fdaa851c, 0x1e8afde735f51dfc, 0x3d89ef4a18d0608b, 0x13c3c0812d523fca, 0x5abdcb9fa981518a, 0x2b720ff3b4d05981, 0x05ba8d30bb1b599e, 0x042b5ff1721506c9, 0xb3d8eb75dc7f7f30, 0x168923f709a7e785
+, 0xe601c230864324a9, 0x106573e9622e60ed, 0x7178f0a8a2d6cf0a, 0x0d30652985050a1d, 0x9181b845c181e36e, 0x5f4252cae48c66e3, 0xec06ddac3931623b, 0x0ad6b384f6230df8, 0x8f4ac0546b2ac853, 0x482c53a6d0c27f4b, 0x7e96009784ab6b10, 0x5d6f192ca95cd163
+, 0x749554d0264e0a9f, 0x754ed2f8e8e4c6c7, 0xc199a32f1b6791ef, 0x23d36a76f3ffc04e, 0xdc414352be3c57e2, 0x7609e4fe5a2f8533, 0x844ce90a86c4c24b, 0x16b73f4ba99e9b7c, 0xc08678cd6467264b, 0x742bfa6fa995b951, 0x0a2f40b51bb08ee7, 0x325b99eb81f15af1
+, 0xd707efb9a0dd937d, 0x52261a078f591beb, 0x1987956a09424947, 0x4d07b5f0398ab9c1, 0x2909e53a309a16c8, 0x1f6863a9d9927790, 0x838ce050704b28bd, 0x17aefba1780e8803, 0xa722bebca448290b, 0x34111410575339f4, 0x745e53a17eedc506, 0x2b53169f533aab88
+, 0x6ba8a6a7ea6d3433, 0x085cf07f48e2776b, 0xa21cb10301d92795, 0x4565b2c26ff4b376, 0x10597e24001f7f74, 0x4f50546b0e16f770, 0x92a471f9f6da14ca, 0x00bd63a2db78a479, 0xc9d2077ac3f5ea0e, 0x5328acaf928744b8, 0x1865dc7d86eb94ad, 0x111ca24af985852f
+, 0x2eea4320d99e2f74, 0x35be55123989ddff, 0x26cb4d7f51bca858, 0x2ceca6d01bf0f62f, 0xd2c1ff93bef6553e, 0x5c6261e563d33ff2, 0xe2aafc3e376074a0, 0x1a6b0c22c6f261eb, 0x77606d5137984b48, 0x43161bb5d001214f, 0x2cd058ff7901e7ef, 0x687430bb8e70227f
+, 0xbca78c735744b714, 0x79ede541417c5aea, 0x5527c128605f2d3a, 0x6038269c76cd5290, 0x0d296c93cc77fb4d, 0x301fd73e84bb479d, 0x63ac368596c9b85b, 0x050de632fd3f4c6b, 0x771aa0b01cedbc21, 0x765cc5884a9cdd86, 0xa9bc0e3db058b117, 0x26e15efccb14dbf3
+, 0x8f6b2d10804fc1f2, 0x0343e98db60ec658, 0x40cd27d1c8298431, 0x4cd5664f32be9176, 0x3ff9890a2f738a98, 0x3b7f3123d9a654f0, 0xc4236cea3fc27f11, 0x35923d3897cef4f6, 0xec64e2c43e67a525, 0x61ba626a2c2a4bc0, 0xc8dc36bdeaabeb19, 0x3aa683d072d8e49f
+, 0x1c4cdeb6fec3dcc0, 0x46fde82eded30411, 0x7fafbd46536387ce, 0x1090eb83563dd5f0, 0xd23faab4f4952839, 0x1b503e879eefa094, 0x1f4e9fc9e8dfd87b, 0x3db61b4f59f3b3b1, 0x8faf93db71e38a15, 0x5cdb335d54823b5b, 0x8432f9385926d1d1, 0x035099bc78e09a06
+, 0xf5a2881013378561, 0x5ec31757f18b97bb, 0x1188db22e66c9733, 0x727b791254b58fbf, 0x8bac794bc40e8a85, 0x5a9224650374e74f, 0x6f98609a59a2bbfa, 0x05ac053f5581649a, 0x9bc26b7eb1445f70, 0x013c6e8877b96419, 0x956f469decb13958, 0x2e8e9a73cca61972
+, 0x47bf99a89463d333, 0x257c9a76ee1f3339, 0x436d78c6d327278b, 0x115f833836b74e15, 0x670df77b0c46fe96, 0x714f84e608180138, 0xbc3d82eb9b905993, 0x2f52c3ec9a03f8ff, 0xdb95470c741ed653, 0x68a34806544a2d45, 0xc139007e70587865, 0x32a1a7b2e671f997
+, 0x07f19a22728fdbd8, 0x69ff8d6d04f2e90f, 0x23caee0dd50d0728, 0x02e8c375053d8459, 0xd4c2775f6b7f0045, 0x53a91dbbba6178e6, 0x70fe964da1c48400, 0x53d2b57918337620, 0xc14d4ccff362a3f2, 0x009e8a173acc9dd3, 0xb47ad9a11a37edd0, 0x571b39aab024b10c
+, 0x3e75f37a94147ee1, 0x7de61a04c45ccd3b, 0x33cb4fb8e6f5de19, 0x571d020682660752, 0x0f49079f140a75b5, 0x2c82f5bb94779bc5, 0xd5c952e6277ac374, 0x56b503a6c41cd37f, 0x5fc0d3b895a03504, 0x72ae2c924b80ffa2, 0xe91868c937153c35, 0x1a74604db0c9c8b6
+, 0x68389f9f8dfbeb76, 0x667ffa5313eef465, 0xd6a4d0a249b9ec98, 0x43803d993da1c6c1, 0xea1e1caa6655662a, 0x61bb76d81e6143fd, 0x5c059652a35ac4da, 0x02a4f2a7b00142dc, 0x7e97a65fee8899db, 0x46a92533ca83ab8d, 0xd3e32c4c797f2998, 0x3a98df01fd063088
+, 0x39164696310b166d, 0x5b6b87663758264e, 0x74866c1d05dbc6e5, 0x30d2627a0bda6142, 0xde658c50358d68df, 0x408b16b7a0370fa2, 0x62eb2068c559ef0f, 0x78f92c55a9db5724, 0xb678cf74609066ae, 0x69c68829ab528e54, 0xce2dd06726b3d290, 0x4de5755dd08beaaf
+, 0x58d69d562846a2fd, 0x019d22c0b55a01c4, 0xf722d25231a8b3ae, 0x5a02a5fb626aa770, 0x4eb576c04e9d025d, 0x002e7911408da1e2, 0x8730cdb1a42763c8, 0x10a1c1c06f8ea8f8, 0xf3f86cb7a994ff3a, 0x1010695b0f3e38f1, 0xfcea1e9eacf9fe13, 0x5f627e15df15980a
+, 0x69313603c53bbebb, 0x60f81c5f6aebe82b, 0x4b0e8a07aa4a45de, 0x484bc3f333d41e69, 0xe2e519baf62714a9, 0x5c86f4f1109c9119, 0x80221a15443cc410, 0x0892d349305228aa, 0x75d3181688d51775, 0x216ea46cfdaf3d05, 0x00a751a5f68c6d46, 0x3cc09a7819f41dcd
+, 0xbe8b59e3ebaef8ad, 0x6ee70f3da87fc9d0, 0xdca98e7c720421b7, 0x03a8b38b2d049a30, 0x771014e495c9db15, 0x67656515439c466c, 0xcd5e01a6ddb8a3fd, 0x03fadd3b45599e4b, 0xe4e2463c0a0a5eae, 0x605c9520eaaa6c20, 0x763c477599ce9096, 0x2c740e80385ae5a0
+, 0x3999b3f081092a3f, 0x2dda5af27bd4cd99, 0xd82841d4db251bde, 0x504a2b92bb83d624, 0x9ca5c52322ba3a9c, 0x0287c8e7d3eb19de, 0x855beb2c5bb05f3e, 0x1fd3a622bb2eb53c, 0x7ec4d6ac679bfab0, 0x660786e3e582edb3, 0xe8cfa9cf43956ec6, 0x5700eed999a01df7
+, 0x7953254792b1e6b7, 0x4fd5cedfb969be57, 0x290c58a87339ddd4, 0x008fa2f66ef5d149, 0xb08397e27e690c9e, 0x30950cde6e6eeb3c, 0x8d4be18939eca5f5, 0x42415c12442b92e6, 0xe8cd1021ed62b97d, 0x5b1e010b277f249b, 0xaf483f5b908d6294, 0x365917a89090b6ec
+, 0x5f54d5fcab77faa4, 0x32267fdbd33e01cf, 0x1607b88b363793f0, 0x43ab32cb53e17d22, 0xbcf520af6cf53a91, 0x3d9f16772af95616, 0xde8bc312e163ff62, 0x7d7ff602786d5a66, 0x719a8843c287063f, 0x7e10b65a728a6302, 0x19b63d61716cccc9, 0x00d983bc1159855c
+, 0x6f006249351471f7, 0x3204eb91cfe9ed6c, 0xe09af1c83c13afa2, 0x6d70ed88d5de535b, 0x2078873d1a2faa1f, 0x5c73bedb8d96f3da, 0x41bbb407a3a1ce1d, 0x7a40ec2fb54eea85, 0xd6d569cb9dd722e3, 0x10acf67805927b6a, 0x27c61d818cc0ea05, 0x57b175c9f59904e2
+, 0x4f7b40bc92b5a60d, 0x51431f647b46b89a, 0xcd84dd55cc2a720e, 0x6b36059700809a1c, 0x78e3e5dd060e9a0f, 0x630c0c1a146c77d4, 0xc9925b0dea8fee2b, 0x4728f0604b16a06d, 0xb4601050635b2318, 0x2484f7281864709b, 0xbe2ed2a2523211db, 0x6425d4ff23dd3a5b
+, 0xf0868c09017aef5e, 0x2733d1e1adc6d5ee, 0xa631db49f17f87e9, 0x36d753ced54d5727, 0x451d17fb6c4af537, 0x1dcc4d611dd55b04, 0x0bb8de0c8d3e549b, 0x2fb2ca1271592c3d, 0xd877914ffbc31ced, 0x190809a196504d10, 0x44bdd65a970277e3, 0x13195c678b4b01fa
+, 0xe69a41a54f84d41f, 0x61c7c870565e4508, 0xeca2d2fc6f0e1c9b, 0x7f065480e257152a, 0xfaaa9f7c3a8873b0, 0x43fcdb8db58a324a, 0x969a79026e9da7a2, 0x4eab135af328b9d9, 0xb38aaafe87f85f7c, 0x69eba4fe1a6b6f32, 0x5607f6c6b4d27cbc, 0x273072bea774f9e7
+, 0x3c1149e3c8d51db0, 0x161f8cd433c28bfa, 0x765a61f218fe70da, 0x442b5d405f2036bb, 0x96f790271c564cc1, 0x3d5dbb33505cc956, 0x621a38b446af395c, 0x2da978b45bb70ce6, 0x755aca711da49388, 0x46f2e33e55e86df8, 0xfc5b454d5cb7be24, 0x67df47d68d8f6d12
+, 0x7a1e224893898aad, 0x0400219c89c2d13e, 0x6c969e4d63d460d9, 0x4df64d5df8b60ad2, 0x1feed05a45ff89ed, 0x290c4b59e684b4ef, 0x97ffbc3df096adb6, 0x4ac6037e76561c96, 0x1bc40299115e51b1, 0x7169e0a1d96aa1be, 0x43f55f8b6bac596c, 0x1cc6a0603081a178
+, 0x8e1d2db69bc925d0, 0x6ffb86eed51d2931, 0x3ad1eb242e0af1b5, 0x338198152fcd6d7c, 0xc1f381496df13943, 0x05d9242fe1c60b02, 0x39617510de7eec81, 0x24d8ba5ac76b12b8, 0x280eb2db9e548483, 0x6c51317b3a8a93f0, 0xb2a9f90939bd1235, 0x2da9de86c39f9aa6
+, 0x7f54917103127b97, 0x7be2be5ad3276169, 0xc969d703d31e9da7, 0x0500df3bbb1f8a4e, 0xea05c77685795917, 0x049575a992d09345, 0xd567f8de2daabe35, 0x383fad35a8e035cb, 0xb9353eb2bbd43d56, 0x52b3953221860c5a, 0xf9e4bcd46dbec03e, 0x4b0db0b4a7b3279c
+, 0x8cc5f6b6e1ff80c0, 0x1bd2ce464b552215, 0xd008eb25b39c4236, 0x3b4ce5bb2f42a9fc, 0xe1f249681d153d9d, 0x3e022cb14bc4c5b9, 0x8a11d021c8ed5a53, 0x560d3fb258bec495, 0xf4405852705a6012, 0x5c8bccd2b1b3efd3, 0xd93c0f63ba7ce0c3, 0x337798cb3e93dbba
+, 0x7a9f68cf800c8e88, 0x579afe689f3ebcce, 0x7dd41d6cdfbdb4a9, 0x3802410c4e1b274e, 0x64241d770cf0db02, 0x2f7c8133c74bde23, 0xf3c3fd835ed1952e, 0x741b1d88a3cee37b, 0x74e1ae644683c68f, 0x0c80dd9e0f7a91e1, 0x3984d741f3e47c24, 0x4b3eb97b6a39d252
+, 0x32e9b9410da9a195, 0x11d09fdc04ec3b41, 0xf92fd5e53cddea30, 0x296e095589e0ce05, 0x4e3200c3a283b696, 0x7e33fbba44ecb32c, 0xed3c039790ad0033, 0x5c8ebb260b5ec084, 0xa667455bb79d2e9d, 0x12fbec9d4f5bb155, 0x3aa5f6bb4d0d8d49, 0x0ca652ed7065d80b
+, 0xb7938753d51c6f83, 0x41644ac1a602f9f2, 0x84223d4d63c38f7d, 0x71057b4b8b931282, 0xd39fa015165f47b5, 0x7536c8a19c33c201, 0xbe713ca4166c2dad, 0x456c98c2b4198511, 0x4793f25e1cb44658, 0x1d002f1cfe1a1ba7, 0x9f9ed6e1e1a27957, 0x095dece028426bdb
+, 0xe57d3412fc1001d6, 0x481c63a0d9b25e99, 0xc756b6ba0dc02aa5, 0x24af047d79ed4683, 0xe37ac10133b68275, 0x418b45e570802012, 0x87578def0c3900ce, 0x7c5661923b8c9740, 0x5f4ab0a6fdda7366, 0x0ac6100825e4eb3c, 0x308528e42c9e4d32, 0x436e5979933ddde8
+, 0x0cd6ebe123352222, 0x63d1768a46f33dc7, 0x96cc55dff38c9273, 0x474438da7140411d, 0xa184b89b81cf6402, 0x6bf820a3aa675050, 0x3bd4720417391f0e, 0x3f2b8f859a8e0cba, 0xed952561b125da29, 0x07eb1ac74165097d, 0xc3f70d0c7db0a9fd, 0x5ab896a489294a6c
+, 0xd4b608975c20018d, 0x6243b039f25d0456, 0xf766e98fc24c7464, 0x20035c09d2291e42, 0xcc0e5b5eeb462524, 0x24bcba5505f90657, 0x43a98d98e4fa9bf6, 0x3b621ec4188264d4, 0x633472fe235c812c, 0x31a20844a3316d23, 0x47b80db7d7f5d0bd, 0x22d482f5663780f9
+, 0x4df227dc52142020, 0x25076d0624bf137e, 0xcb4a6ee30a657645, 0x0ce469dbb5ada433, 0xfdb06251f65b9c5b, 0x44f82274a8e8f538, 0x98fa4c81cdec4b97, 0x0ccd61d1abb61d0d, 0xb9dc371344c5ab54, 0x35dcd9ccf8e5f919, 0x67fc81f369ba5722, 0x121b5aa1af6024da
+, 0xe0b1b16b0fb1f1fa, 0x4dc688d6d3b1805b, 0x05c187cf10e40104, 0x71af39c743daacd9, 0xe691e97f82acf4b3, 0x0c46305b9243bf5b, 0xb063af137fde616b, 0x4e26e72a1de067f6, 0x61fe66d01a221004, 0x172fe9240cea50b1, 0x4ff50d37b2effefc, 0x06be02ab0b89aa5d
+, 0xdd4aab96717af213, 0x32322555b58a7ffc, 0x7812aa965889326d, 0x1bd608f60d6457a4, 0x2c7b6b44e999e141, 0x113a86a87856a8a8, 0xd95469fc33814855, 0x4a18dc36f6bfd586, 0x0706b60bdb854fd3, 0x4dc356685650fa90, 0x24ef7cfce41f8dcc, 0x19049c3e632deae8
+, 0x5c9a4e28b7138a89, 0x0f0b7dbc1e5087e2, 0xebf49cdc66a362d2, 0x19e4b815e6576c85, 0x1896051ee3b6063d, 0x09ecc741852a68e4, 0x4009034def986795, 0x36b440ff39b4b5e8, 0x9bc2647ee28af1cb, 0x62613c9dd152b3a8, 0xc2018ae5dfae5f2d, 0x29ce5ef30009c855
+, 0x0b653558b21d2b1c, 0x45e2c505d1f74936, 0x48304373240553d3, 0x0528569885a82310, 0xa90d402e33924181, 0x5e610edc23cb9555, 0x28890ae7e007d28a, 0x7e5132b6b1ebae37, 0x0d5252eb7c94cb1b, 0x308ddaea1fdbb672, 0x99fac0b431730534, 0x77d54ed63b9325b9
+, 0x4d647bcb76c6ec3f, 0x0e968b22ec2cad86, 0x4b22b5ec30b08a35, 0x3b31df3b52326b5c, 0xbe84f638dac3105d, 0x7db085f133ecbed3, 0x7a8b694596f2cf2a, 0x67b2e6c15d16e0aa, 0x4808b20bf173011d, 0x25d5fbbfbe66f864, 0xf67f3f3cd9743987, 0x654250e89617ddf3
+, 0xf5a1a7e0ba0a88c0, 0x3616c781799ab50a, 0x2669c27a2d256902, 0x3a8ec380e12fd7dd, 0xa25361f44a418e30, 0x2942f3001d233645, 0x60f1d3b7535a4133, 0x14deaaa12e5c7bdf, 0x0089fbece10c8d6f, 0x4bf7c313757c803d, 0x65aa30bfbb70567d, 0x4fed47af409a3fb3
+, 0x07557dd875d3daf5, 0x36c49c2380e3c9bb, 0xa21f643d329ae02f, 0x6cf6f7474338bcb0, 0xb5df78136a0f3012, 0x031fb2df2e00e9d4, 0x4d86fccbe75e79cd, 0x23f890e082d03b7d, 0x5716a1ffb50a8262, 0x0199b50aa6cf3302, 0x6a1be351f86090d5, 0x36095efc13349364
+, 0xffe752be8ce46920, 0x65047a340b652f65, 0x320ee55fd03156a6, 0x5af6aa45278409f6, 0xa6caf283b1cf3850, 0x4e3a988f61072f96, 0x750f67926b18f680, 0x09fc3f2927d21a4a, 0x914893c2f2ce1169, 0x4d15b367121b3e75, 0x6cb12559723774f2, 0x3ee5b8c2a70e054a
+, 0x7dd9b3518d84d2d7, 0x147d5a5a53f57a58, 0xe1bd0904ad842a05, 0x3a0f3b029c9a5845, 0x7153c03261410074, 0x4e203d6737058c17, 0xebecf5cb79f28af9, 0x574b889870c279f4, 0x326317b005f444a4, 0x7480da44b34f4b1e, 0x7c5f21cdc46275b2, 0x210494b9ee24e4e0
+, 0x3cbf6ca1f4aa4ead, 0x6bf3872ccbfed940, 0x19e8a84673a566ca, 0x61a80e16990401a2, 0xea2e029e7f9b3824, 0x5762298465f0ebd3, 0xf60e36d4969f9af0, 0x00b826180531c799, 0x17120ec95cf3c61d, 0x47196cd6de85c7d0, 0xb0d47cff46a5cba3, 0x29271400d7ede26b
+, 0x835908353516b894, 0x4bc57f8c1eedec8e, 0x2ec5deede5c0db5f, 0x7b9fc48ac4a689fb, 0xf82ce6de88fc10e5, 0x6c5d84a70e03a3d6, 0x88a211fc4ea531f9, 0x7d5583e5918aa03e, 0xbdf2d70766fb8f39, 0x5926497e734ab18a, 0xd6a9872b800cacb4, 0x757c1cd521fd22d6
+, 0x22d50b0c13ec4bc0, 0x288a77d34a15e99a, 0x95c8e78fced3d4eb, 0x45ece109c15be169, 0x878ef262d0132128, 0x48110e9fd98939d6, 0xe3fc5425d2e7741e, 0x050ca6e71f599c65, 0xe02f97605d9fe375, 0x2af48b9bfee410e4, 0xfd34a1c107229a54, 0x43dc6f0cdcbd41fe
+, 0x15b4eb7d65cc562b, 0x369a7b0dd3e91248, 0x2b087611edd32810, 0x116b234ddce09d7f, 0xcdb03cae8e90d2b0, 0x4017d51587566038, 0x081793739242b600, 0x5086e8e633cd52a1, 0xf5ddaee155cb8087, 0x773311b60d59a7e9, 0x36e5aa0acadf2068, 0x7126a4281b192882
+, 0x54a10df54f7ecef8, 0x3cd7d2fbb6e33f67, 0xac31eb6c3e740c25, 0x517db54840feb2de, 0xf17cb269b3ce27a2, 0x04a8fecd1dcc99e7, 0xfc887c1f2f85a2da, 0x280da7425bb55b01, 0xa1af72f5256a5a53, 0x71da839fc459f465, 0xc203fe7ba6587f71, 0x08a4201f77a4f335
+, 0x6cb9ea5683014d96, 0x5da17076b6b51ae2, 0xb55ac168c3e3997f, 0x41b9a32373d78f7a, 0x96f58033b8600a50, 0x6ebfba3ec9d956cc, 0x0ff8883707d66d0c, 0x2f562b035445226f, 0x2388fc015bd368c7, 0x2b7d802ce27f627e, 0x301f0369c24083a6, 0x77e139f6da8d5aaa
+, 0x9f78574697fce43c, 0x02726c94565421b6, 0x1ad6007338e26585, 0x6134cc5eb35c02ff, 0x77ae739c9cdcd1e1, 0x04e96543233c7a13, 0x97d3926dcded2e10, 0x6bcdff7e14cebb73, 0x9c46ae2b32489774, 0x04a97b9a0473af8d, 0xb0350bd910d9784e, 0x448212d3e2164ad7
+, 0xf3464e0351f5e995, 0x68ab4d24b3ade8d6, 0x86854d534002af20, 0x613f7ffe5de92aeb, 0xb385b4f4608a370a, 0x220dccecbc6f2688, 0xc31ec5384abd3680, 0x25a82841a2000fd8, 0xd19e422504694236, 0x0bc1124d541781f5, 0x0808651edcd99176, 0x41b81f223d429c76
+, 0x1a6dcb2662cc80c6, 0x0b101fb0ef0d1f74, 0x6f02aed8f8327119, 0x5b4c5176ccc4a340, 0x8fcefd200d6ee8ed, 0x0548127287f44749, 0xe1efeca1fadd1341, 0x0e74bc189dc9016c, 0xe90470353f46cb12, 0x69513d3455bc890c, 0x9503686f1f2497d1, 0x280a0bb7733f1086
+, 0x14e5f99930a91dea, 0x7840ad84b03c3878, 0x46e32c654fdbceb1, 0x7e88d2822bb2cecf, 0x4d78a8aed7f8661d, 0x70eb17416ef40180, 0x97b6f1733c474a10, 0x3d0d27fc4c7084ef, 0x730f60f6a1ee0d71, 0x7bf6e3885d3d9302, 0xa1e8af33742f1611, 0x73b798ec129822ed
+, 0x0f669bb094642a70, 0x142927de789fc4a4, 0x0db18e01fa98cbd7, 0x6ae4d37674be1451, 0x7175e98f178b4b74, 0x40534e319bc52c6c, 0xb7211d252c4db879, 0x1a7651f8f3ed1aae, 0x9c9a43932d50cc97, 0x630b232b7201c359, 0x327d77575f5b3839, 0x5f0e19e78431864a
+, 0xbfbb00b6530a3bb6, 0x19ba9d60d97f7857, 0x759779de744bd764, 0x5facbe63177791e1, 0xc74ea511c56a3b61, 0x1d8909e84083c31d, 0xcd20094b507af492, 0x2ef1b9c07c92ab37, 0x8430ed9ef8494fc9, 0x3f9170e6df5b1fa1, 0x1fb8dbc837175d73, 0x65b961b58008d022
+, 0x7e1afb6816864b6f, 0x54c4b92c534871e9, 0xc0a1dcd60d61ef84, 0x4390f0e992c41298, 0x1e54e2c8b7c27348, 0x7a987e01a2ec308c, 0xee42fbd90c4a89fc, 0x1ed8c77f8d7c609d, 0x569dedaca99a3346, 0x0eb471e609fef4ed, 0xc915522a3b9fd03c, 0x726453b246746bfb
+, 0x4ed3cae53dc5fa4b, 0x1bf1e4b34b9feef6, 0x0850df9f0401fac3, 0x0a58d33cb2422e2f, 0x3d197f9603ecfc29, 0x45e46edba1cc432e, 0x96c0c93310d9bcaf, 0x18de3a458be2c33f, 0xc9e65e5bcc12a49a, 0x71a5345f0239b187, 0x53b3b2f01c5710b3, 0x438350f57ce2ec4a
+, 0xdbbd368a760391db, 0x4033638dfec29fe2, 0x297ad75ed73117fd, 0x269c08d54b106e8c, 0xa4e3e4fd238b4218, 0x1f48a1cb09208aaa, 0x9575153115cf5fa7, 0x59feeff0876fb74a, 0xfdedb4af6f368710, 0x79be1fe79fa674d4, 0x689d6bbb4c707c39, 0x394a451499057bb1
+, 0x5887d4fb21fc43b3, 0x37628dfc4b5c23bf, 0xc66b76944b34bd13, 0x6e97f0a8a45bcb36, 0x3ac6b10139edbbdd, 0x313f4846b6745833, 0xf8758d9777cd9037, 0x02fdc98f02692537, 0x9e79f381fff833a5, 0x25ac5d68c49b105c, 0x1e9f48a076d8c9ee, 0x788c85c9fe9543b3
+, 0x776ea51db3b3b778, 0x0007c44055b64db2, 0x3c392c2a82fddd25, 0x65000203be8ee976, 0xea119666ab7c50ab, 0x528b2700e8f82d39, 0xc4aaf797118b8282, 0x55e5a7d5382e0d3a, 0x15a80b22e89f1039, 0x199f68594b1247a0, 0x8d5630750d622435, 0x2687f48cc6def5b2
+, 0xa16b0c0259eafaee, 0x7aeb10834e93595a, 0xe31bcf34ce679d9f, 0x4e2c19829eee3c87, 0xa46869cb8ca35c9d, 0x3cd35313c08504eb, 0xa088eca66e98389c, 0x44c562f0f7262740, 0xd3eb8a28f447523a, 0x43a0e059bfe37576, 0x0312c5d6d0f2e0ad, 0x5f30aaf0d1614c61
+, 0x6f09a7a6e182b0aa, 0x575db3d21a82296b, 0x6599bb5eee7925e6, 0x093f89458dcc2fe3, 0x70c4af785151fc84, 0x1230c0c519de5480, 0x0e66f8f93075a4f6, 0x5de4a122633a5c6d, 0xdb99cf83f9ece1b6, 0x1c3acd4a13ded617, 0x4dfe69e68f59c447, 0x482ba1f7715a3c16
+, 0xefeed2a7c81ea8fd, 0x4e089eeb713a572f, 0x78bc74acfbdf322b, 0x4b4951ce8eb86fbf, 0x0eafb6b46ac6714d, 0x72913ed109f7d404, 0xb498bf6fcde9e3a2, 0x3c08a283ef5ded62, 0x9af09f593a48b346, 0x7ed52441d00d4980, 0xa78e843ee5df44ac, 0x25db12d420a86151
+, 0xec840e7e89d049e0, 0x5a34cbe928bf96cc, 0xd875dc5525da882c, 0x2af4442fc256827d, 0x089fb428c2ef5a5d, 0x0b573ace080a3d9c, 0x6f57282554c240da, 0x425ceda6707b6bc9, 0x94b5a8c3dde824fb, 0x264f6f6a445b5da9, 0xadf292191c5c1eb7, 0x5e302e82fa4e5533
+, 0xf51712fc44237f35, 0x2b0af62c42e56e66, 0x10392cb4d9c71b75, 0x4d7e08fe8457a95b, 0x210b9eceb04534bf, 0x73329d1c7d88e1e5, 0x667a43fdb4ba79e9, 0x3435ec04276ede87, 0x38b8540a1a78b098, 0x4f6c266e6793bb78, 0x447ea35172754041, 0x109d7b742d8c3dac
+, 0xe3ccab45d2a4f6f7, 0x59040bb73f3bbd2a, 0x730b39d65645bab5, 0x5c61aed2f83382aa, 0xa992143de3cf83e1, 0x13455cb889b700f9, 0x54648228b310e2f7, 0x5b837752ee0f733a, 0x3923a6c0e5ea0dd9, 0x5ebebd01fc9ca9a2, 0xa34c205b8fd94258, 0x7d1a10029a0b6cd5
+, 0x6c83c02241a46527, 0x4127c85d6be1fc62, 0x26f86ff5ca7240b6, 0x2167391e7dd95cd9, 0x79227506ac78caef, 0x1a2cf919b8832a0f, 0x07745266405cf574, 0x38095a07f5713ae1, 0xe5eeab985ca3e7e7, 0x6a5dd9eeb734d639, 0x991027ebe44a4822, 0x311085fb4de9c1f0
+, 0x33f361e21066c3b5, 0x550091d2dfc8688f, 0x376345c5532bac13, 0x0aa0898f990931b5, 0xea2f3346e5d3226e, 0x208790ab78776afc, 0xac7c2ae63433850c, 0x3c5c373ada10ef52, 0x96c1b4003f4cde6a, 0x4546a9c475c09781, 0x6c961fd3e8536294, 0x43f36e63fc0d5066
+, 0x296601d8c42167f4, 0x241c1fc38565471b, 0xdb00a27e11ce9617, 0x60381181b7e7e4ee, 0xc1076b7635ac4d52, 0x0166010ffb8dda38, 0x5238f69becc43e0b, 0x63303a2015708b17, 0xe8badb2e5bb22591, 0x3a10a4e218b6131d, 0x236ab01aabf1a7b3, 0x1ce8a51a68a4126f
+, 0x59e775e2a2a87928, 0x770b48eb4b738301, 0x0b43c2be176bf79b, 0x1957850fb6424660, 0x44455ee1ecb0ab2a, 0x620ceaa116eef4f0, 0x0198f62cb6183f6b, 0x3274f78eaf2d55db, 0xd2ba4e460cf7ed5f, 0x19cfc17bc0b66f43, 0xcbae6f45b1942722, 0x5d93e44739147b58
+, 0xd07180b9d28fc597, 0x35372b21b2ea5a46, 0xed2673477f083464, 0x7a9ebeeecc57e6c2, 0xb51d991a81a6b314, 0x35e7d90f4ed6de58, 0x45f21e209510dd05, 0x446ffd2715c8d380, 0xe69b5c7a9b6d3e76, 0x1379e79fb96912e6, 0xc161c848bd508738, 0x22264a049d8cfff6
+, 0x32321a68ff7ef7b3, 0x57b0e50cc585b333, 0x1c08c65ba9d764e7, 0x5534c793f92f00f5, 0x7a1ced97eafe6fe4, 0x6b8933739202599c, 0x618c5f8fcadd3ff2, 0x2a8719b3e6548653, 0x346a9ec5c4200f0c, 0x7a36b8d00d0eda58, 0x844b22b75021accd, 0x769737059fc5e465
+, 0xdb1ba69b5019f266, 0x1777242305db9ac1, 0x491d11ad264b6ff3, 0x136198dfc57a3053, 0x4a6cc64741eb7176, 0x14e811c97fc97650, 0x6b64667f71be386d, 0x3286fcadf019eb5e, 0x3f2591f4498e10a0, 0x674fa7c32df7867b, 0xbae8ec7ee100dcf2, 0x03b2c0a20a6372a4
+, 0x4c8d76b471e24474, 0x421fb6a7b8a3216b, 0xc672bdb2fe8f514d, 0x202af653d9aff3f5, 0x05e5f80f9626953e, 0x7b721fa3ccd42ffc, 0x99d8e481c0f70479, 0x054c31746d23362b, 0xfbef2e20430e8025, 0x60e1e3f02e7720c2, 0x161701874eb347e3, 0x363924e90cbb77a6
+, 0x180f5ee1863a1a6a, 0x2f79c0046ff79fe2, 0x44679866e35447f0, 0x1c64c6dd73e0d636, 0x1d8175566341469d, 0x5ba634965b8b9e87, 0x8f48744f976952a5, 0x744f28d23db94c8a, 0xd15e84b1f232da34, 0x556f3d7aa38bee8c, 0x14693c56e866ef89, 0x1564fb9a0f81eb03
+, 0xe97eed56fa2b483f, 0x6d3f7e01aebd1957, 0xae8f128aca3b3e45, 0x3d41e85ba2afd3a9, 0xe4fe485e4b6d8328, 0x65c49b4c3e98098e, 0xe96a00e054d6e91a, 0x394a2122738cd006, 0x715cca3dffd90785, 0x7bc3dcde15890965, 0x6dcdc47a33a148ac, 0x435db9d6dbe1bd55
+, 0xd74d4d6e0fd89c27, 0x25e727f6a5380553, 0xbe54127ba6c5189a, 0x65c87d3c3e61939c, 0xc34a6d122a809e2e, 0x7de6b787f097eafa, 0xb8f8b6e701758661, 0x10705fbf97042046, 0x1591614e6da2d44f, 0x7c74f26ec6eb070f, 0x9ad98c1a50249c60, 0x6e1bbd44d64b2302
+, 0x937cee76047790f9, 0x5b4ccbc70beaf690, 0x332e79ae75ae0dae, 0x2e6394161d093556, 0x4b378bf68f6849f0, 0x6c419fa0cebba72d, 0x8bb431e1e273f2a4, 0x357cec80bbe024fd, 0x83a6e913962f11a9, 0x7808df02e2523718, 0xb6690b5dabc49e13, 0x6cef23259375972a
+, 0xd18ac767b5e551fc, 0x5a0ba1dddb15bd36, 0x6f7923de219e3e1f, 0x3ec23588db9b5cfe, 0xa4fc23d42c83bbe0, 0x21581a00768658cd, 0xa295b6e57110218e, 0x3e7bbab1d15f477f, 0x2266c03d3f0d0635, 0x4174f08a95be03b5, 0xaa1a674abb8cbeb8, 0x6bdf6ba553ae3390
+, 0x8a31f824638545e2, 0x2a9e37a0f0eede53, 0x148a53d8cba69f65, 0x64c587e816d96316, 0x777a028a47e97e93, 0x13728e46befb2e0e, 0x13138b44862fa665, 0x0fca8c38a87775f6, 0xcc44bd580dd067fa, 0x40f2f7642e22d02e, 0xab3ba6db80c2f728, 0x5068aa2e2d25b7f9
+, 0x5a8a842c0a2923ff, 0x67c39e8a1006c196, 0x8f5cb9ff55460a84, 0x2e735c20a419a518, 0x0c6ee3fcbfdc2da4, 0x5bf6ed60a87b92bd, 0x5e4ce130e8e1608f, 0x0932ceb3e50028e8, 0x793cf8a0538cbfb8, 0x4e89e2c018beb7bd, 0xcaaa79642f5060de, 0x542a38a4d13f0016
+, 0xa1b0fd9aac663e55, 0x5158bf1f7b33c0e4, 0x060e82f65a4119fe, 0x32347069a1529fc4, 0x5c96ef69127480d5, 0x409a902134df6ffe, 0xdbe8c392eb6c7013, 0x73f2c48b0e3b4a79, 0xddf5060b937e2dff, 0x1534f901278611d9, 0xf47fe29ae4fd49a7, 0x7a2c0bfe75539f29
+, 0x61d431e05f0d566b, 0x15e09da672af5074, 0x1539c22a644f67f2, 0x73015e1fcb3527b5, 0xffbac602bb1bfaca, 0x2948e0afb1ccb93b, 0x263b4b66c845c42d, 0x3acae7e91a8d567b, 0x4df341959275821d, 0x356cf25587fdddb7, 0xd24b5954cbaea410, 0x53ff5780642074f7
+, 0x1d8ddc6079a4194c, 0x4f69001c7246afbb, 0xd708a1dbe8c3a5b3, 0x2cabca2303211f51, 0x936c0d257add0328, 0x6352529f6e3a1803, 0x255a12166381c11b, 0x4224d44035d2f01e, 0x48845a605aac6c4f, 0x1e5d2e74f0307647, 0x05f156c47718fd18, 0x727d025f3113b268
+, 0x7011424b3ec3a1bd, 0x4707d733b00d234c, 0x4fdfa8a733e3398c, 0x179dd91b21fb523b, 0xbdb1488db70fd65e, 0x7403f64429fa7468, 0x55d40880bff509f6, 0x0546235d023df28a, 0x2d21c328ba090065, 0x1e63ce495fe9e537, 0x99a0264790e11bde, 0x2fbbf8479be81646
+, 0x92644b3b29ef019f, 0x56a2dc98c4724541, 0x072c3ed9220495f6, 0x3a3d787a23483d30, 0x1906f294a9d64e55, 0x1afb83ac0464118e, 0x74a120e39730a0f3, 0x29f8708f474cde98, 0xab0c734a0e3e63fd, 0x5f58deee1d5cd701, 0xdb2338b7e4ab83b7, 0x5a43e5bfcb5c17c5
+, 0x0ede76bbda7ed8bc, 0x0b0de99503467e4a, 0x3b905fc53ed39dc1, 0x3a2ba952a058c608, 0x939d9c6a0d41edcd, 0x49510e3b5ce8a07a, 0x67684a81e6939edc, 0x78201e08e7e3d198, 0xed58b1e24a41fa5e, 0x08a5a8ea35959caf, 0x046b7d7a7a2ee348, 0x77358e54bb1d4623
+, 0xe34284c7f10a1da4, 0x37e36a32f608769d, 0x8780e719b7f8db3a, 0x4fff13c7439175a6, 0xf0fcb8464f7a9692, 0x51ba0cc756acb263, 0xc514331681245796, 0x05ff6469c8c38247, 0xe279b84782ea86e6, 0x60424885a4f6e2d5, 0xb20fefc1a370b551, 0x4182c7edfe04a110
+, 0xddcbe6aa14e8c72e, 0x0cce23e9b994ec6c, 0x866c323cb185ae69, 0x29b7b0fa7ffe208b, 0x7c467d4daed6b792, 0x4680d716306f5bcb, 0xdf6561219c4f3d2b, 0x55daa33ba6910d33, 0x72faeaa5e2c39200, 0x241e78e412980877, 0x440d5d5ffccfea61, 0x7e14a6e93bb5330d
+, 0x16de06233efe91b4, 0x585d53771707a024, 0xba898b098a79e4f2, 0x05f0938b06bbc089, 0x2aaf6299284795d5, 0x175c97271ac48a8d, 0xc08ef97014a68783, 0x5d0669e62eb1969c, 0xd0b6af3a87252335, 0x0ead663edf6c99fe, 0xf42e54fccb9be037, 0x6a4afe5c859078e5
+, 0x5f4d44f2fa080acd, 0x6fecb4d6123c3d94, 0x0be86ebf55dd544f, 0x71814dbe138ecc2a, 0x2344452b32a1fb11, 0x4f396ac781643c58, 0x1a30a076ac350f9f, 0x723a15a8c8f58615, 0x98ab7831a2a0ba9f, 0x7610c85f14282755, 0xabaf5aec2748b1c9, 0x3bd79be762cfa03f
+, 0x61d38bc0dac38b55, 0x33a7354c0eb3ca81, 0x437eb59540611db1, 0x2eda5e7a6110ba3b, 0x829e634ea6697883, 0x0afaff28a758a47d, 0x2bb0dca6029754eb, 0x213ff8cc6ec6f98a, 0x0c2bf33402d672bb, 0x1cf3c36fc45ce547, 0xb84472469c19b024, 0x71f368fc3d8198cc
+, 0x04b859d5fc1fc772, 0x67b72f7d3ca1848b, 0x4c98a5a6749d4335, 0x61f9dd0f30986d31, 0x055216bf228e193f, 0x0b92e8dbed9265bd, 0x94f30aef067d0cd2, 0x7ec165d81a0f64d7, 0xdd9ce941f8f37e7d, 0x21b2a29e01d68e68, 0x9e84e5aa18d45ac7, 0x06b1b01db68cd5e4
+, 0x20cf8616a121e6a1, 0x263d2a834b8ec4c1, 0xc1e64198abc4ee87, 0x068a6ef41ea8d6cf, 0x4976a43483252b01, 0x4d5ff783db212003, 0x8007c2b7b13df29a, 0x1fa132c3b57b512e, 0xc7b2dedac21a7488, 0x71cd322c5044e2fe, 0x2cc12193fed41aff, 0x660904f21ed043d3
+, 0x0eeb13c7c8ba72a6, 0x03559276ec91f89c, 0xb857f8168e17edc4, 0x51d0caaef5ff4469, 0xc1184ad4ffe83a05, 0x49906e2c676bf4e8, 0x79be44af981552d6, 0x2c2841470ce9830b, 0xdab7b08aa996dabe, 0x32e464f9c860aac7, 0x8f6df06984f55f1f, 0x1524e0253c2c22e2
+, 0xcddf6271f69479b9, 0x6ba91d2103a069fa, 0xaaec428919c113d6, 0x3a2fb1a432a60085, 0x3d4be147868a7fc2, 0x7fe3b377049ece67, 0xda01d12ae970e15d, 0x73d777d3dd914b81, 0xd6212d7a41b51282, 0x140768136b18e332, 0x6336451c0effa8db, 0x39d543198553895b
+, 0xe73bb2fc12264176, 0x21cea2f7247567f0, 0xc73b27843025732d, 0x371996d7b32f7e5b, 0xdf0ad827ce3c83b7, 0x0f62c6b8bd9a0fb2, 0x7e31aa2b172f10b9, 0x3a5cb4a264452253, 0x16e4cd15b7914829, 0x18d9047ba43e3472, 0xe59d1b5e0f0c85a1, 0x30d064c1b05aa569
+, 0x58b07513217087f1, 0x344f839d2f690ee2, 0xf45916d007f9e8b5, 0x28a8967f3d4446cd, 0xde5e7731b267b7d2, 0x32aa118a262f77cf, 0xa84046f59e8d37f2, 0x2a54c2e96b24716c, 0xc2e25534187db382, 0x53a1778baf7c8942, 0xc52deb2f82ecd988, 0x5744797e8b934ada
+, 0x2977229872e4f395, 0x63aef38810b43ea2, 0x1c0b30ba2d1a7d4c, 0x6879f7b87858ec79, 0xa79fb334dc8c47b6, 0x26a87201f4ffb854, 0xedc0c8bcee580f02, 0x2a8f996952700058, 0x351eaec6d81c281e, 0x5e52e56d769ba8ba, 0xa3aa77ff2008b9ad, 0x00a8045b05b4ad20
+, 0x331a6d5d55b82b0d, 0x7c249dfd07ef5b7c, 0x9a398b52f16fd1ae, 0x30699dc156fb544f, 0x584f57628572c965, 0x4fc132e0f2c88345, 0x18d101a45843d458, 0x0aac10204f1d4ddf, 0xd7c22c469cfa1e0c, 0x6fb844b0eec559b4, 0x6a9b62bde291a3d2, 0x7252790ea43d6251
+, 0x61a39aa501b09a94, 0x09249e35c45900eb, 0x80fa7a7e95f20710, 0x2e55ddde7f86365e, 0xb985075d1dfb27ca, 0x2cf49824429f53d2, 0x6df55d12965d6ca1, 0x776e6939699e46ee, 0x570d03acc28aef96, 0x383925ace0c9a23e, 0x7e5e5fccb87eed57, 0x5987df426d46067a
+, 0x964c6f3c65fdfbb0, 0x6ed9d47475ea3a8c, 0xfa69b99f273d0915, 0x4fb08a3341eed692, 0xd356c9a54bb77d5b, 0x2fed523fbf707806, 0x2fd35669ecfdd7e9, 0x6b8dd3c402d5d52c, 0x2c90e7e4f52352a2, 0x42fef4b3d5968a5f, 0x29b20694e548a3c4, 0x1ac05cdc874302a0
+, 0xc234e0bb5b3db6f6, 0x4f9c16fe85c1c7dd, 0xa36307f98419e1fb, 0x4748dc68e1e03040, 0xf22dbd5bcce6b7a7, 0x5a65bf1ece7dcb84, 0xa225d50d3585bd30, 0x451f78118a8b88cb, 0x9777824e57f907a4, 0x062192027eccad60, 0x1428f3167a41eb57, 0x52ea739db283e685
+, 0xe6729da927dd155d, 0x584efa7dbfda3e10, 0x29e4628791ebf3cf, 0x09e46f14d795a69e, 0xded87dda61f5b738, 0x3aa09cc41b8a40f2, 0x707824df26cade63, 0x543e2f9357c62f42, 0x68d3084421feefef, 0x6ace0092784cf55f, 0x58224a8ab3a7c0f0, 0x206d85cd4ce2523a
+, 0x93aee56a362b18b6, 0x64794e3a42d4b66b, 0x9a8131c5d39ba736, 0x1a133f7bb892808c, 0x83085a65e8cab40f, 0x173c99a1aec130b4, 0xf3cd221b43e14e98, 0x2a1ce94d0ebfee80, 0xb6a0b5e984b0e8d9, 0x0f0248d818283ef4, 0xf222aab3099e3193, 0x3601de846a9143a6
+, 0x994007f94b32b238, 0x15f3fee72122bdce, 0x4b8dbd72bc2da144, 0x7e2d82fb7bed6a1d, 0xbf74162d69206821, 0x32afcc67f17507be, 0xcaaaa39bd455d461, 0x726180858dec3e86, 0xcdb79de2f28e0a08, 0x3510e6f89a60e299, 0x2511013301f5a3c0, 0x3d2cbe668b85b48d
+, 0xdea5b05adae7f7b6, 0x2614424460c05628, 0xa152cb86074beb51, 0x6ebd3268162f1f81, 0x5efd726e6a3ddc88, 0x7a4531fcfa9b9009, 0xac6df1427096bdbd, 0x4ce4ec86a683371f, 0xc608f6109ffe1b55, 0x72596553610b2414, 0xa8010e59ec27b758, 0x66d65b6a20e360ad
+, 0xc2174e520a6ff57d, 0x431cbd3b344e34ea, 0xe0bcaa4e547461eb, 0x0f1b02e4cc09b49f, 0x1b828bb6704985e7, 0x640bd63224ec9553, 0xb655e84250255658, 0x75f21727f44d160e, 0x55bdee789c9106b4, 0x69ec1ad9c34445c5, 0xdc0b5f0b85d513e6, 0x073c0cffa242d5a3
+, 0xd9e2d1d1cc7d81cc, 0x375914b689c08974, 0xa82f2a327bf85043, 0x79b195810a12ae46, 0xe61ffd2f4fd71873, 0x0e9734ccfa26309e, 0x852b8de87efb2e9f, 0x244a6299dec0cab8, 0x20baa565a32e157d, 0x27aec4c694a36534, 0x7cb0f44da799179c, 0x15b3f8047c619613
+, 0xba19ae549548afb3, 0x436e1592ba6cd89c, 0x735814e5bbc9298c, 0x1118909d40aed45a, 0x7c72d5ab6eaf0155, 0x1d0fb329dfee3b3b, 0xce0cdc9f5f073d0a, 0x465cd7c3d07a524c, 0x0a82455c30497068, 0x02ed12b2ff7ac2e4, 0x2488aa8758e3af99, 0x12b6c15028f2c992
+, 0xcf524bfb93c46d3b, 0x793c9edee2110126, 0x27cdeb957a14f07c, 0x7ae0742011b93da0, 0x180a41b66c4f3427, 0x4eea9fb17f6bf6e6, 0x17c1ff7c6549a596, 0x1ee0ec66d67e48b3, 0xd23e4b0441d52293, 0x0ed48a81b62ae5c7, 0x2979bc3e6fa264fb, 0x10b38cbe862d6705
+, 0x1cfdb92433b0f2f4, 0x34b2ff9ccf80062a, 0xdb6c0f52bc19de55, 0x78e388c6753ed000, 0xea9409388091a7e3, 0x567466c8c8be5b96, 0x9fe9d91c89665830, 0x45282071df546616, 0x7b5975f6967b8f69, 0x3c77bc6f89c9ae25, 0x0100c6e65a4c1eb3, 0x0cc9dc909d546cff
+, 0x4d8aec1e714dee85, 0x5bebc8abab322c1d, 0x753e84086a318de8, 0x7f436e9d4210f43d, 0x142e89d66637c752, 0x435489b5fe689fcf, 0xe874bd92119e8f7c, 0x36b9b71d3e1d7662, 0x30528dd1602006db, 0x55543cedb589d053, 0x103f0d1e2fdf71bd, 0x1fc05eb48bf5c6d7
+, 0xf01eed91a8e1ebe0, 0x38bbeaf8f12b9317, 0x7facbd46444af6d5, 0x2ce3b20a832d2066, 0xa95103d229dcf99a, 0x2a477adbc87dabc8, 0x67814149c1e10f50, 0x28cd364d7e4666eb, 0xc5c77dd2d0ee6845, 0x3a4aeb5443756c8a, 0x6f66c1a0a65de127, 0x41be504e6efb6b7a
+, 0xc93d8a221c4c3da4, 0x34c1a50a2eb16370, 0x483c1b1f7673ce59, 0x7b5631bb21ce6615, 0x6b8bf684cad6e45f, 0x6d69280417de3466, 0x845786e1575eef9e, 0x247c80a347fb193c, 0x2cc82d6e28abe0da, 0x040b581f323ade74, 0x0bc64f77477c73ea, 0x4f6d30f869c14f1f
+, 0x6aa1ef243a41cf67, 0x380fe826f588a5bf, 0xdee9e084f0b0484f, 0x2063b0ab58e78690, 0x77b2d2d719278f6c, 0x0f5c801e3c417cfe, 0x32a26b2bab198097, 0x467d2e63498f5a46, 0xac49ff79da7a2fa3, 0x0677dd8804540ff2, 0xc09b3b90e95c31e8, 0x78d9fb37961c3409
+, 0x7ef43402084eeebe, 0x3ba79dba37cd2fdb, 0x01b5c31f4be41c49, 0x0a12bb2e6e33149b, 0x150f2ea25c02444a, 0x3651b09bbd00b7c0, 0x31def0278e6cf409, 0x67659f93017e20ab, 0x17ba3413b447107f, 0x65ef63d808c2dda5, 0xc9dc4f484d91a723, 0x062cc749fdb08a7e
+, 0x92b4c06aa83dde5b, 0x23c4f00863e62698, 0x8d17ab0dfaf097c4, 0x72a507b73b0f000a, 0xc05559ae2179a47d, 0x36ee0422cc499e69, 0x56044bec818482b7, 0x041cfa1974b0e0b3, 0x82e49584bd88305e, 0x77e9515cfc48b766, 0xe655ba08ea17453d, 0x5d79467143c4665b
+, 0xf353b15869cc6f2d, 0x6997066085b8170e, 0x61b45a2c2263823e, 0x100c0f7122f0c7a1, 0xd2ff250c5de2504a, 0x4063c04e3d11945a, 0x3d0ce2d7f672a9d1, 0x0cab75aacb433d95, 0x77cc0b5674ba1260, 0x7f1755f424d60b0f, 0x99cb65502042ac7c, 0x245b469bcb598cf3
+, 0xf9bbc27d44d46354, 0x7bf755e94ffc1294, 0x02290ebd4f157382, 0x79ff5edea031a2e2, 0x4ae972ea2840e62d, 0x4232189c10b2a65f, 0xab66adeefe437db6, 0x0fbc40531a1239f0, 0x9f51b5134791ec82, 0x37ad600e3ded3e0b, 0xf105938fefa6d7ce, 0x0fb74487b945a175
+, 0x7bef289a987113a7, 0x0aceea18fe043b91, 0xb247ee4494cdfcfe, 0x3d3e3f5cda72f6f7, 0x6bd51116f65335d4, 0x7dc220cfef1c4e87, 0x3cfb0feded39d491, 0x6f00e231b3f45e5a, 0x3a917be46615eeb3, 0x339ade1232f10dc3, 0x76eabafae88936f8, 0x25b255a95418764e
+, 0x3663cf713988a6de, 0x0e0388ead7c704a8, 0x0461ac1853238b23, 0x7f6d63bdbfc1adba, 0xe14008c641ad441c, 0x52073f711712b70c, 0xfc0b07bbce75ed25, 0x456e028de6c08be5, 0x58efc3baa372a89d, 0x560d286b91e38cca, 0x5686e4a5e368a4a9, 0x54d8ead9630a9985
+, 0x2f54808778d72130, 0x0475639aa6cb45f0, 0xc6b7b26950ed4b4f, 0x28d0cea6fa5f05a2, 0x60a0ec747501cfcb, 0x341bc3157614e7e0, 0x53a3839c243e4f44, 0x0ba8430f84175708, 0x79b0161477c99ec1, 0x7de7a56c5896896a, 0x64ac8e12ede093f3, 0x09774a75911369e5
+, 0x8d562ddfaf955802, 0x2d261850da2e7664, 0xe4a25c90715252b1, 0x76a8da29853099b4, 0x016f717abfe54e30, 0x40be61328c536321, 0x2ce9ac7caea56797, 0x72042d91a877cdf9, 0x260b5d126bd0948a, 0x01991e1f273a090a, 0x3f5a0d4493c19087, 0x0641233c4a4238b4
+, 0x16288394653718c6, 0x477410d9571e6563, 0x86c63fe124fb98fc, 0x62fe397035c1bdf4, 0x40b33233a8d507d6, 0x6d16a1a7a6e2c0ad, 0xd5eaa00a67404b1f, 0x38868544adc741b5, 0x6ec2b787ac422215, 0x431a7ff8e958b79b, 0x5b3babcc12421d19, 0x2d65a204d3948acf
+, 0x9dd7d3e1877c0b25, 0x6d0da0d73c757c76, 0x6d32858247a2fa01, 0x4b031333a7ccfa62, 0x18891d176b16befa, 0x08e10baf38814dd6, 0x959c36cd13bcc755, 0x122b0b17b387bc7a, 0xf40cf31c7216dc62, 0x527793c0f7c50660, 0xa99f304d10613f31, 0x64220b0c463601f0
+, 0x854a98380398e4ed, 0x3e136b2ff099bfe3, 0x08567133141188de, 0x59908e446707ed6d, 0x02730be31fe4b152, 0x702fa5c0b7a9c542, 0x7e8862421ad42da1, 0x42503d868848603f, 0x4624f9c597213ad0, 0x7e6b65b759f7f5c6, 0xe61d6230ada56a8b, 0x6069fc3a8a57fcd8
+, 0xc690557f696cbbda, 0x28cdaaecbfb9a048, 0x68f49df4db513d6d, 0x264032ec7c2417ec, 0xa1e290afb492c4b8, 0x63cddc9970c7334e, 0xb706590c3b624b4d, 0x7e8bbeba2bd107fb, 0xeec40e7d1dd829a2, 0x04bf2a6156b598cd, 0xa68acc4de06a3cf5, 0x31239426f3d4fac5
+, 0x680db6896af7bb0a, 0x6af5142dd447e051, 0x07cf3db31ba8b182, 0x42981e0485f548dc, 0xd27c4305797de12a, 0x5ed7e3b8618c93e5, 0xc3ddbb2a50c39992, 0x7cd1098cd94c8349, 0xcd2ee1187ca6e6af, 0x3e9953b5551954a0, 0x322933d716fa2bac, 0x2fe61d3dbd04920d
+, 0xed1724742babe695, 0x2debcf1ed68fe1bb, 0x1a56eb903ea34bd1, 0x70c7eafcaef1d021, 0x6efda3d1c9ac3172, 0x6d9235fb82edc916, 0x0457fbbe3387333e, 0x05cbbfc67c16d9d5, 0xc5aa7cb881a3cd7c, 0x2c349cced8d1450e, 0x5ac238cc28a0161d, 0x69d4975671650998
+, 0x091f3edf2381607a, 0x2e4fb8ccb2f04d49, 0xfb59fe987f5b1eac, 0x616c41a5a3b56412, 0x052c5ed6ddee0810, 0x0e249e2088e9c790, 0xb9938fb896d162cf, 0x7ce0889110becf6d, 0xb1803431ab689c7f, 0x531f39017539e7f9, 0x7c3f5204ca91f1ab, 0x7f6cce5aa5943411
+, 0x3970ff2059caf6cf, 0x2d909ffe15504583, 0x2330d8088d2fc46c, 0x034df72c88ab8daf, 0x52cbe2e3a5273d59, 0x3c61e28489825f61, 0x73ff778071ad7158, 0x5d14afe88425494c, 0x5c71d58c4ca7338c, 0x6b6e07d15eb99f4e, 0x5592d9f2b94d64b7, 0x28e493775c115a60
+, 0xc810f44213f9131b, 0x651af44e5b919e06, 0x083eeed1b4884442, 0x08f5d10465eb36e1, 0x0996e5b280df3c63, 0x66acda94bed5b97f, 0x178b26a2fc34e17b, 0x11579aa74b36ae66, 0xb08e3c49cf3b0797, 0x4ce1cfb60cb70dd0, 0x1f9fb8dbf8de6184, 0x7258658224d39845
+, 0x49a2b89d6f08080f, 0x50b4f85905abc180, 0xeb86376ece250501, 0x2620b372cda33050, 0xad330c195ee19048, 0x7d75dea6a663276a, 0x839cf59f1143aca4, 0x78e296a3f8db15c4, 0xf6b33e34a97b31c2, 0x411e6f77c013fefe, 0xa095abd0535f3ffc, 0x0c733aa98d1e5c47
+, 0x5bc99b610aa4d5ba, 0x6a64fa6ea002773d, 0x18807ae46ac19aea, 0x5126274c4cc5f2aa, 0x7f8d44a1d5f8677c, 0x349bdc7148c3054d, 0x3141b64ad7af68bf, 0x5d0d8fa3fcfa9d66, 0x7d7c6176e1670636, 0x79f67bfebc1f5584, 0x03c03810a0355262, 0x1ff7360720c0bf32
+, 0x8b3e353202c93e71, 0x358bc73618abe9ae, 0x792332ee1b3d7552, 0x249449685007b231, 0xe60776879b2c297b, 0x3af252a1c4893d48, 0x1b44c45a257764fd, 0x6b98f18a8ee80a9b, 0x9e7e93487294aa5d, 0x157dda9635602be2, 0x0b3f53420bfd8bbf, 0x5898880e6b682165
+, 0x0d722bc26012299a, 0x3b3546aed0c8319e, 0xb7c6e19c7b56fd19, 0x5d9247e9349723f1, 0xcb47b0888e6cd5a3, 0x52e42a9e90379cba, 0xf446254a6a682c6b, 0x6f4e42a95b7d6fbe, 0x369751f41ece6f86, 0x049ebb332111d488, 0xe563e0305e7d377d, 0x0c8def3e2eaa3b65
+, 0x5e14eb2044de8fea, 0x5c5f0a874c3dd1fd, 0xbd0058577c64df1f, 0x6b8fc66ac58dd208, 0x23cac642f3fc4de5, 0x2521cc00bdaa04ff, 0x57a5dcf329ecf7aa, 0x4ac9b17106f66dac, 0x9c75810fd96efb70, 0x7c528001a704105d, 0xab8050138033c336, 0x526753b3c05d1222
+, 0x63ee5bec589d029b, 0x1201f308cb4017b9, 0x6205ec496c816984, 0x18291daa3b962453, 0xbdffe7980587d4c5, 0x1e2da12e85220650, 0x706a801a11388a4b, 0x63ba42d0c20a5c1a, 0x13ceb3405166b42d, 0x1c20c4857321e2dd, 0x348b3e6eae7351eb, 0x635003b98e4d3ec1
+, 0xce1969e8cc0e26f7, 0x18d0f77ff565ce7f, 0x94270ff5fbf01134, 0x7e3da661825a3af6, 0xc6510f2f598e630b, 0x09161692424c10df, 0x4d7faa0b769bb7eb, 0x1ed8c31a0de7f3d4, 0xac2d87127285827a, 0x72c1ae6d14320584, 0xa23bd37e5a4146b5, 0x258be33ba4091249
+, 0xc4def2c463095326, 0x57b8ce85f1120c18, 0x9f2676d4506137af, 0x0f8fef8937729324, 0x829a8a63582f7b7e, 0x4e68caf1f4f2f3c5, 0xb0f4fbca616d5d39, 0x2bd52a1960719c11, 0x69b70b9d85bd4490, 0x71a9bea9ddad7c9d, 0x62ebd9258b6156bf, 0x3240e85cca4665e9
+, 0x78429de94e0aa343, 0x3d4ce556849e40c1, 0xd20093121284caf4, 0x148e40e6a8872009, 0x8db880a498450c53, 0x0a67ada1ba05c803, 0x4aeb0504b6e8d65d, 0x04f51b6001ccad05, 0x5730565bfe0ccc66, 0x3601d600e063246f, 0x5af620aa147b364c, 0x6e843e0b34e8ac40
+, 0x4c28d33be38c2fdf, 0x34dc3a0b1732fc81, 0xf4de526ffdfe5a0c, 0x03711d3ba0bffbea, 0xb8659eb4d19251d1, 0x7ba4e1fa7d650944, 0x06ba803db1534ee9, 0x26872d5847e073f7, 0xdbc50a440b6e8021, 0x0d1d86a9393ed878, 0x300bdae71b96e6ce, 0x0f7b56f51d92f3f7
+, 0x7077011622b5da86, 0x79d64769fe7380ee, 0x8f5398ea3300d3b4, 0x35c69839381a4de8, 0x0b35b9ff09d7f1da, 0x1752e54aa48ea0c6, 0xd3955f4787d5ac7f, 0x0a3190ee4668c447, 0x9096f02ab12e410e, 0x607d1c6e143a6548, 0x6328565786e1243f, 0x6a80f6be0abcaf5b
+, 0xe8b111c25b6b6189, 0x452ed49c9a378593, 0x49cb09ac96000a15, 0x7c3ae51cea6e373e, 0x4649616d4f01fbb3, 0x5039907dbc47f129, 0x0455845e6957e954, 0x73efd468d2df2dc7, 0x26591a756d479f61, 0x626d600d2fc3c4dc, 0xc3c2511dbef3c437, 0x4f1e143676e2621f
+, 0x4d9676ded83cc558, 0x2b5550befc3c68c7, 0x5c7b25aeec0a4afc, 0x0fd8001abd34532f, 0x00e67a7f0ece9c8f, 0x27e90db15a5af42b, 0xea3492d1770ae1fd, 0x2832cde9440ec4a9, 0x3c559f17f429c70c, 0x7a33e3884c834c36, 0xadb150f3f09c2590, 0x02c3ed35fe90203d
+, 0xbd5018d9c6bd998b, 0x77c8a1a27e09a4a1, 0x97c31e94cf94d8c3, 0x182165daabccfb88, 0xc8c35366001a7bbc, 0x7048eaefb9c546e5, 0xaac9e2dd607922b5, 0x36a1f40152930a1a, 0xd64e81351849f6c6, 0x4f37488340593a9d, 0x7a1885514df39a13, 0x4d7d1a665b2eb8f4
+, 0x58b32b88de702cf3, 0x0629e29fce606bc1, 0x084eadbcf64e1523, 0x0279089e0f190172, 0x94bde4b18a720370, 0x7f07a9b3b0ebabfd, 0xd86ec6ffe8107ab1, 0x0ff4f82792dca729, 0x4561a77fa3d1ad3b, 0x53fe0a46667b6839, 0xfcbeea2d21ac9f6b, 0x1d5bf51e806a3734
+, 0xa3df6ba0b3e89039, 0x28324410d442daa1, 0xdb1a1643383af9d9, 0x7b5f7bbf5154d160, 0xa929c1901ac6012c, 0x013e44980ba82536, 0xe5ca8d1422ee35b1, 0x4395c3ce0ed02c54, 0x748d4f7c4afb0ab9, 0x079809b0282f2913, 0xbaeb1f6db5e845e4, 0x67c426ddd10e31d8
+, 0x1937276ee9aa8a58, 0x46621cfdcf99ddcb, 0xd724b81d21a6261f, 0x249e8c440a7b8bc8, 0x89c49035905bc344, 0x1d1722b78038e0b2, 0xcb1a0394a16c166a, 0x238f5634f82a8d53, 0x8e43abd3ece061d9, 0x04a6711ac3d98b6e, 0xb013e56878e8d207, 0x1912a0d533bc31ef
+, 0xfb83291260a137db, 0x619f3f5caf45d03c, 0x7a0c9126008f63bb, 0x0df880575d8ae903, 0xfe984db7ba168f28, 0x19b785709c2ec903, 0x2c49765061e2af50, 0x6dbe0a224fc82626, 0xd5ffcaabaa59fbc9, 0x1911d1aae60eda1b, 0x054c344c34879059, 0x434c72216578177a
+, 0x4b3e89af6518eecc, 0x1b0bc539d647d457, 0x398d92697b78e291, 0x7e2493325bd1ea8b, 0x7ad0676312f40d3c, 0x5ad9acfb8198f735, 0x0b93f231cec6ca4b, 0x5b2eed2d3d091415, 0xe7cff1435c5f9f1f, 0x15e450dd19fe791b, 0x6a6344f482bfa4c6, 0x6b129548a3109131
+, 0x0ec6cc0a5717d8ad, 0x235b882a5a6e7555, 0x1356ec27bbdc5d60, 0x01f497083b79701e, 0xf3801de09774cc3f, 0x51f92f68d45c2228, 0x842a57be8b355414, 0x4539cedb79de5ccd, 0x667140cd02389083, 0x562770fd07255d25, 0x4a13a92e21d2335c, 0x171e6a154c70fa00
+, 0xf7e371f7eae38134, 0x248c237f598b08c3, 0xbaab9c5e6a9acf4d, 0x61784384e2519b16, 0xeb0ee63adbaa9a91, 0x402c32c603c0ffbe, 0xd2f203603534c6b5, 0x61a3a2688f1062da, 0x5fe66a39a0c45924, 0x36cfbf0ac5b6a150, 0x1b779b9805c6655e, 0x014d27374cf8be1e
+, 0xbef7a4a67d2b1590, 0x763eeaf8c3f0adc7, 0xb514091a9de96574, 0x2e1e2ad45ea387a6, 0x2f69e6f15a68df94, 0x54aca4ba5226856b, 0x2d465d2ad4497160, 0x363284ab91e2fc8d, 0xee36ef92d3bd6c7a, 0x069cf321fd424c7f, 0xadd3fe96c1ce0d1c, 0x1076d99cfe725aa2
+, 0x77323375c5fc22e8, 0x5317f459159c8118, 0xb783dd40dfa067f1, 0x15d367ff9eae7c16, 0x31093bf150c2f8c0, 0x29827f59b7e40bce, 0xe04c7da20d1b90b6, 0x0dea3590fef51fc9, 0x3569630557a8a08e, 0x68f28a3cfa5e0991, 0x07de3f680ef49362, 0x59f9f71dcc35ae32
+, 0x4933f41b9cd4e48d, 0x700321413b587663, 0x762b4093b8a779ae, 0x329a542235e91079, 0x3e18712e146baae9, 0x14019cb9171bec2c, 0x01f0a40ac38117ac, 0x46a4ab9c6d155412, 0x2a353c0ef74f3a9b, 0x15b47d1b7eee5995, 0x108f96d00d957d29, 0x2f270e9baf48c684
+, 0x6e183af8f62855f1, 0x6d4a061e42d37599, 0x7292a1a648a1dcc0, 0x72e1311853f0402e, 0xada7272e630ca30f, 0x083f59212fdf48e8, 0x9cdd130ce20efdc0, 0x4819db3dbae4f4ce, 0x19dcc43771cae2ae, 0x49f4e59f8dc5b10e, 0xcaf0ea5eda9c164d, 0x09a10dfb1aafecb0
+, 0xcc33bd98f7b3237c, 0x7c1c1c8a0b478a48, 0xdd2ac833059946c8, 0x6b59f2204cd0bb20, 0xcc6da400d1803c1e, 0x0e2718dbfdfa00f7, 0xbd507be8e86488d0, 0x18c5ccc7f008226f, 0xcdf37cbcb1da63c5, 0x58482577c7b58190, 0x82c814c2f58f8af8, 0x44343f844c65ea03
+, 0x110fa64c59b69c9d, 0x6beb28c5e3c11bc7, 0x789cc022b3899510, 0x285be4767ab05fda, 0x6331400352046f28, 0x065c405a66d29fc5, 0xa6f13d776170a713, 0x44aaede9fdc7d6c8, 0x8781ea6ff12e3aec, 0x3af26f3e5e59ce25, 0xd8c525de126e022d, 0x03789618222dcc4d
+, 0x857f04c83f24ff63, 0x49e55ee644d4c2dd, 0x81c2bd4fe64aa553, 0x27acf7170b6c3605, 0xb86017908304d78f, 0x4eaca811874d6443, 0x2cfc7658da50fd6a, 0x224cc4ca01a04251, 0x6ce44d868ca64d27, 0x082c6b406fc7585b, 0xd529613c930ae8b8, 0x09a667cc65ece222
+, 0x948dcc0e3bd0d604, 0x7c34a46e08f7744b, 0x5548f37e4849f78d, 0x327bd066d1e6fae5, 0x0b1cf03e36fe2224, 0x3a5ff4c734eaf880, 0xaac69fe92c3b7fb5, 0x4104113dc17eee7c, 0xdafd92f5596f0e11, 0x34c028c151dbcad6, 0xa4520a9d5143051f, 0x666bce0582754e2b
+, 0x3ebbc2a58575578a, 0x109a6c9adf22fb4f, 0xd05548e34e2c860b, 0x18eda629bd0f6a26, 0xd747cf67899ae871, 0x4ceefddc7eba078a, 0x8302cb0eb0753406, 0x0048b0569175726c, 0x7c4edff8667b0ec5, 0x336fa59ab32458f4, 0x76d071fe4afb073f, 0x7e318ae456def24d
+, 0x2fccdf5e9f8a98f8, 0x1c419b08a7504a7f, 0x93e12a3089cfcd17, 0x39e1fe37c5a6bf57, 0xe7b81064fa33d212, 0x44e0eecc0bc0f9d6, 0x753de78e37a2ca91, 0x670fe3840111210c, 0xd1f307f164eaeb10, 0x7c2766c4c61ca151, 0xcc568ec6bb77889f, 0x4dc84d90b80bb93a
+, 0xfb903088b66888b0, 0x1f141b8725959abc, 0x307aca7a2aaf0818, 0x3ffa8a2de61098d0, 0xf1d93bbb403ea642, 0x0a1993df89485842, 0x05b5369664caf77b, 0x2e2248b5bdf1fa8c, 0x78e68aca850619b2, 0x1d5502f054d57c7a, 0x5ab211b8554ff508, 0x023e0f8604c81816
+, 0x6caa4a4e975ccf18, 0x52b0947cae335761, 0x41f56a1bc7b406ab, 0x3d79af561f6c07c2, 0x1622c3a863e26b83, 0x78673016dad2e497, 0x2f94a72c4b00d390, 0x185119d13117ce64, 0x027b09394ed3bed4, 0x7f51a5d7f86a8f98, 0x3eb43fc8b2b361c2, 0x72af4f242c795e0e
+, 0x308e87da7d3dc530, 0x6f9553618be27f47, 0x197c40d121de9e01, 0x6e34ad4f693b8700, 0x932098056c06b80f, 0x6b3be9761d7f8dab, 0xf365e7ab55da1104, 0x3e8664a68d9d12dd, 0x5545b66254fd3803, 0x5861c13e8e3c40cd, 0x38c65922bb18db66, 0x431eeb94b0ccbf39
+, 0xc41aad3beea62cdc, 0x1ccf42b939fc1c75, 0xfcce9b8046902815, 0x541aace8098e6a7c, 0xc0dc1d4760ab37af, 0x4b09c6bd81461c45, 0x94f6c30b6491c646, 0x623245739cb8478b, 0xbe1d2dc02d9f7bdd, 0x1dcdb5842cb3a3e2, 0x3e4835d04adcf575, 0x69ad08493db51fc3
+, 0x05e5e42fde7e5061, 0x463d2162780995cf, 0xa998734ec54658ba, 0x3e61e78e2c5b7305, 0x9fbaa4f8a8843a4a, 0x2a6801b5eeb7e5b3, 0x4d7b0a791adf1e5e, 0x064da647fbea08f7, 0xcbd1c2bc03b5167f, 0x7f8e7069dde7b5c5, 0x733055bf16da95fb, 0x0d3351728bba9858
+, 0xa2a4be8104b5dafa, 0x480e41ca17a21615, 0xad6958b7908361fb, 0x42994dff39d64d2b, 0xdc83033834b630ca, 0x7adeb479f15a05ab, 0x16213a07bb5ef484, 0x00f1aa2d215a5998, 0xe03d0f59513a6dfb, 0x600217d75c94b328, 0x8acff9efca1623bb, 0x0773d111b84f4f36
+, 0x0792bbd7cefe57e8, 0x2439bed387e8376b, 0x173e821d9f56cef2, 0x19b8de030bbcf368, 0x175eb0668564e3fb, 0x2ef989e14c72699c, 0xa68731c8e773d1e4, 0x6329cc70b3b7bcb4, 0x77c1706daed36020, 0x3e44953cb4909468, 0x906032e1483ba649, 0x31934c475d5326c8
+, 0x7bca73fce3fa31fe, 0x2af7694536f24ab2, 0x7db360e9b90cfb79, 0x544aec94acb689c0, 0x66aa7867fac3b974, 0x3f9c19449d0ba8f7, 0xe3cf3596448c1ce8, 0x04950756d19707c8, 0x74afd55e840d789a, 0x267a484574a5b377, 0x986b19fc2e0d64ec, 0x21c0cb47bfd3062e
+, 0x4e675289ff0fa3e3, 0x164bab7cd34dde0f, 0x31fb9c1ca670f455, 0x35e1e8a42aa2ce74, 0xff4ca3245b4dcd5d, 0x20538e65dcec73ce, 0x3488e5f5329284d5, 0x3003131e4f970295, 0x46fdc0bde8604fe2, 0x4b15caae9fb4e8c8, 0x9b14570aefa07fb6, 0x0aa6a4183d21c1e1
+, 0x6dabc8eee5196f37, 0x63416e116ac71fd3, 0x86ab08168263cc62, 0x0bb274589623d1d6, 0x8b95b8e28aeda6ca, 0x0fb9172e68cba72c, 0x923c05fdab7050ad, 0x106f551aaf0d907c, 0xa784ef6ce606f3d3, 0x1c32ca365f9b8f43, 0x7f5bc500c91ce8b6, 0x16fe914ff5e1c3c7
+, 0xb2c3b2612f27625e, 0x2af8fe2d30d1d975, 0x6b1cccd5eb13522d, 0x4261897bbf999147, 0x3b874d60c5976196, 0x4060ca1a425dd08f, 0xf2b01a53e5bd0e6e, 0x55dc04eb6ef960d2, 0x06330b33e08c050d, 0x4065fff7c3ff0759, 0xc1bddf3ece655a84, 0x7a9f8f6e1d430a3f
+, 0x40da643b23be759b, 0x43bbc6b07002c65f, 0xdf269e7d0ce2e8f0, 0x600b6e48114ed804, 0xf271883b00cb1b5e, 0x4d55c2734134a889, 0xcff19807fb588fb4, 0x6baac279a1d593f9, 0xb68f0147d550fa77, 0x709a1ff7d2694a03, 0x1cfd48f6d561afdf, 0x06ce5b8491cd21f4
+, 0x348f586773e7c6d9, 0x6de98c5021863902, 0xfdf5ae36cae79418, 0x5f54f4ff7cb63c8d, 0x044bc5ff80d20eae, 0x3d5a76cb0b36b68d, 0xfd8459a5fdf5a309, 0x00b228d1b609774b, 0x45c3420cad2b6bca, 0x205c1d8eb49f6832, 0x3b86dabcad8b2712, 0x6f524bc38be96906
+, 0xe2ac2d79134c88d9, 0x3deac6dc7e91a9b0, 0x16b5d5882d9b7efe, 0x3f8bb0932ec4dc94, 0x483e999bc366117a, 0x7c63ad886afcf439, 0xc807806f0219d925, 0x4bb1466f02457b6a, 0x9f9c732e38b76a26, 0x457a9a9581a7b0e3, 0x33eb985759eafce7, 0x3ba79546b6d9bd00
+, 0x3699462bfffca44a, 0x792a825f3ee93807, 0x7dc7d65ed9adfd81, 0x6d12da1eb1727fad, 0xfc75020106d62db3, 0x6c461db1e8a7d636, 0xb7a825afecc45cdc, 0x6df381eda0d8ee54, 0x331bd5e5b6a4c71f, 0x71c27af5183683e2, 0x6867eaebf3f81a33, 0x3deb9c64faecc9d7
+, 0x53cf84418a86ffb9, 0x67efb6b7b802b418, 0x90c0c6198a1fa1f7, 0x404106d16c6b7513, 0x64fe2b4278eda9fe, 0x6c22784eaaa2ca5d, 0x3760f02925f0086d, 0x5f2ed0ab5e2b1a6b, 0x59fa1d099fa9aaab, 0x5b06d247354c416a, 0xbe01432ad3b2b394, 0x134118a8b29ae75f
+, 0x5611598a93357f51, 0x7a5c2cb4574b67d5, 0x4906781027708612, 0x6454099d18e7a306, 0xa067731ed0c32a33, 0x3416d97ba5275d1f, 0x98ae8b5273e477c0, 0x39ce2bdd9cccead0, 0x06e475c0b1b5442c, 0x44a89ab1b991fac9, 0x5aef5cd095ddea73, 0x378bdcbe2cc15eb1
+, 0x07143ad0c6347e97, 0x0511ebe614fab90f, 0x4162896a3d80db90, 0x0d2bcc801cdc1536, 0xe713a06d6e87de4a, 0x27edda2a75710f17, 0x5199dde28abebb43, 0x6b5d255443dfde0e, 0xd5627ba2b5382412, 0x196ec203bd772207, 0x11321f457593b696, 0x19c601d904bd8b3d
+, 0x9afdd4e3986c4eb9, 0x4ae853f0d0e1daa5, 0x297e8cd6846ca613, 0x41290428ea40ecf7, 0x86a56f3efa18c585, 0x0d584dafe0c32760, 0xe737c1d08ba62ac2, 0x54415167189b9f40, 0xa1ecec87e4bf688d, 0x24b69c841f6f2d53, 0x248d302e9324604e, 0x6b381021a7034b5c
+, 0x87dc87d32c54e031, 0x7acb0867b7ff9081, 0x310bfc3f1ca12810, 0x38df3e80f96e35aa, 0x3120e8a61381a443, 0x7666f963a59dd7d5, 0x7db0584458630f50, 0x2605b15a41a648c7, 0x639a057c128b388e, 0x2d2dda44a433574e, 0xffd4d22d5e5b5f7d, 0x2c67a2cad4259e6c
+, 0x4c3458ceb80914c6, 0x7c99b3a6780830bf, 0x1305ec5c0d2a63e1, 0x77786287c0b4def8, 0xeed1b03158857ae7, 0x6aa4bbb7d3000b5b, 0xe57ae179b80deb6a, 0x7a7b532d99dc6b9b, 0x7cbbe54877a502c8, 0x33f7299aecc04e11, 0xe4221a6549984adb, 0x6a0ea8dc61672a05
+, 0x6691c0400a03ceb5, 0x43ad07293fe12e0e, 0x1a05f2066bf94f6d, 0x41ac61a7700db9a6, 0x9b50768a6b24482d, 0x703bb987f8dc3771, 0x6e4301a80054c70f, 0x176c6ba7b0dc28c1, 0x52d966b28b39ba61, 0x6dd6068e4a856621, 0x65baac1ce8f98620, 0x1c88b7078fdc22a7
+, 0xabc766e815210532, 0x79428c2b39472fdf, 0x7b8ada5137d669cc, 0x498c7c7233a6306a, 0xed1aa4f1376ec66e, 0x4ac52395e4e6d6ee, 0x4ab1ceb516313fd9, 0x39b94b52d6bdd62d, 0x4c1e969b74748631, 0x5d5722c95bf2756b, 0xafdb0d74b9d36b01, 0x640b4352dda6105d
+, 0x535a036eac7076b6, 0x18b587d362af2c63, 0x32feab8a60408e48, 0x7fc35a281eff628f, 0x03f4da72b8c96690, 0x5bea5febadbbd75b, 0x169418c83f63f57e, 0x048ab681bacc027d, 0x7bcab7cdf63aa639, 0x6bda9cb65f303112, 0x71c30994298bfdf5, 0x3bad19fe29246e2b
+, 0xa84ab6da13ed11a5, 0x7cb2c1d684251883, 0x50a2497b23b5b97b, 0x589272aa08b1f958, 0xb7c951ef02617c29, 0x7336bcf6a451cbf2, 0x05219d8e15b88d5c, 0x0839a42f8ba4ec47, 0x934f76443a81695b, 0x08eda0d3d122f881, 0x3f642b73bcefaf67, 0x6b6853b87fe3546a
+, 0xd1826a3fa5150748, 0x666174adc9546c34, 0x6f4f2b44b867cdd8, 0x127aee34f54c4fb0, 0x337f13636d190629, 0x150c33ca930aeac3, 0xaf0c44033e301b03, 0x19900d5cecc391f6, 0xd678c319aadcf5ca, 0x4ae448c0176b378f, 0xff50fd3bc0ccc502, 0x3bcb167ed4bfad77
+, 0x6e7fd4fa15a128a8, 0x0344bc3dfd92d609, 0x7b491a722d6dfebd, 0x0164ea16c6310a74, 0x02f8386c5447ca3d, 0x6fca7402013b5ec5, 0xeb486e287affa37e, 0x60d48f313564c76e, 0x1903da90d40d682d, 0x5da6dc4e9642e84f, 0xd5ad848002a3d49f, 0x1f2dd157c510ee0e
+, 0x6eb2497211b9d817, 0x73c533c6682e6ec5, 0xf8979633e3b7dc0d, 0x7f0fe2d59a27eeb0, 0x8cf75d74b3323077, 0x329e585f595728b4, 0xabaa457f9f8ebfbd, 0x0c2776320af009ff, 0x0daaf2b80f805a47, 0x5bf4d516942cf935, 0xdc940a5d8f78f500, 0x68dbc7833d8e0104
+, 0xb0b4cc82e4ddba82, 0x24057a74e73c4559, 0xed312432fc51d8d4, 0x08aaeb2e89c29c5a, 0x9a3a212e270f1db8, 0x74ba787b5057664e, 0x4e643bf36a0e9337, 0x052b6ee84f968688, 0x940e91229693075c, 0x6e17b773b1a23180, 0x5c5c3149bbd47276, 0x6eda0e41b93f2e37
+, 0x9aeeb7682fd2c3c1, 0x7062d112efe71007, 0xcbb4979e0109cf49, 0x1d01798130a2a8b8, 0x7d3cd49787e63bd6, 0x5adb086d9da2bff1, 0xe8d73e42c7602c8f, 0x6c9f531017addcc9, 0x09cfdabc0ae831dd, 0x69f10ec83e3a5ff8, 0x88468a1200c44041, 0x5e8ab9dff0cb6798
+, 0x67337c49a883fa61, 0x36904c0450d3ea6c, 0xf09ffef2efb0d81a, 0x63d94c663e7a9884, 0x89caee2ea6252c83, 0x2ce7db67dde9f4d9, 0x5d425be530d9f2fc, 0x7896c7737c98e07e, 0xbdec22aaa9944ebd, 0x5d7741f7be603aae, 0x21d483f206b87379, 0x70cefedaa7a5ac43
+, 0x5c38bd5fc08b02d9, 0x0320b9296c4a68c2, 0xd5d23823ef20974f, 0x39edd3033ba93b88, 0xbe1583fad0b73f15, 0x0c56872597fc5c90, 0x20c441502a29b8e2, 0x7242469cc596c4d2, 0xd8c3abedb6a266ca, 0x6217b53912996186, 0x28114f295eeda255, 0x08f25da2c92a698f
+, 0x026dc9b5663c2e6f, 0x328832a11d2840c1, 0x0044a7b4cc3f850e, 0x587278f160c4e711, 0x44ef5860c77ef2c0, 0x22a39a075a358ea0, 0xde591e66fc7ecf36, 0x42397ff893c0e662, 0x77250827b84ca63f, 0x60767917ef15ff22, 0x1dde698b1831179b, 0x4dcf7aa6fadd534c
+, 0x5652d040a47baeb4, 0x5f45d31ecded853e, 0x2926a94140e26309, 0x463e14c02e45391b, 0x2b0d8371d8339973, 0x125f3e6a83bc6703, 0xd736e6f503386d26, 0x15926e9cdfb3fe31, 0xde4d86c0ed820e32, 0x3ae197438241ed14, 0xfe68de7afb312c19, 0x324bf1cb2223220c
+, 0x10e5ae3001f0eb38, 0x7b84b2e9c133d8d9, 0x077706e1352d16cc, 0x04d976486a1a6bae, 0x50e35aac48b8014a, 0x2f4022b4b5a23456, 0xd35d0e1d03b85d8d, 0x4b03f0767e2186f8, 0x319d1528bd93e797, 0x19f83be8d2581c38, 0xaadd93917514d801, 0x33dbbaee50957e89
+, 0x7a9975f68470fb28, 0x54952bf0f089a18c, 0xa64cc74578b4aa40, 0x444ce19fcf31f387, 0xb6185bc420ed46c3, 0x20c2527bd629fcee, 0x14d672640e896825, 0x6597de3b36e9ef6a, 0x46c0889664549ca7, 0x7a6d12440feed09e, 0x412377022356253e, 0x12d56369fbf7c10c
+, 0xcb77d47964f15c62, 0x7fcb5ac61d45b5b8, 0x3b8947345f88afe4, 0x1c22d3edb5f6e199, 0x11fe9669c187d234, 0x55340111c89fa0df, 0xe3fed0a554df5b5f, 0x7ee1f699565bbf02, 0xb3ed3a157a2ed2f0, 0x1739d22e13584a72, 0x975a6a04b580647c, 0x72780e9ea55b7d14
+, 0x0c11dc9dc6e95c9d, 0x7cb2cca96ceda71f, 0xe912328db1603496, 0x5fe5291a146ff8e0, 0xa61a09a8a4824f67, 0x791c809cdbd5558c, 0x483077e3f215ca9e, 0x051f279d8d552d4b, 0x86ae7ae6460fc411, 0x74ed1181e3269dfe, 0xb9a7c2a3ef4f11f7, 0x0af619d4f2f95992
+, 0x356a6d5c55d32b2c, 0x3031c56835a8f8ac, 0xdb54b027514735bc, 0x6b0ae9fe3baa7e9e, 0x9b1858801a526de7, 0x362345a9c0c19ea3, 0x0f0b9fe64be27609, 0x3c72c5c15e647a3f, 0xd0d32798754cf4c8, 0x5aa336f426b7e272, 0x829d4b8a1140af1c, 0x62a4f493593e5951
+, 0xbfb3e49b55c62dea, 0x6d39f7104b393457, 0xe67755fdeb389dd6, 0x08e90c3152440224, 0x8ca33d483c0c9a4c, 0x370587913a3d66c7, 0x6d440e0fd94a4f29, 0x18cf3da1c3513f60, 0x75ef1d049cc76b26, 0x15350a9c10891207, 0x1d4d792431518485, 0x358271dd919985e8
+, 0xdb83f509657c1c4f, 0x73c10d124c3fa85c, 0x79a464b39810893d, 0x43f74b921f4226fb, 0x35971a1a9027bb3e, 0x5649bb2138195a56, 0x1f0f558d688cfdd5, 0x1f2710fbbebeb08f, 0x2178f7ff5627b907, 0x2d50716acb0cbd2f, 0x7749df3bc7761d50, 0x345ab0d3e37997f2
+, 0x4d2ba95d5f33ba2c, 0x22aca9fc22b7689f, 0xae08a09a43b6c3d8, 0x33659e4e1acd8f3f, 0x1cb1f6ff1e08d288, 0x58df66d015cc3521, 0x91f82269c99eba35, 0x36cef552c4a38036, 0x704ff625b30b5e49, 0x42fe7eaf5c5a1d40, 0x9dc1bfd4f99551e4, 0x11b84b6a2ee3638b
+, 0xfb8100659558049e, 0x3085c623748a0383, 0xd2bcfe42c7f09ca6, 0x3ed26865011ac025, 0x86c8e05607bd5cce, 0x637103fb85bbbc36, 0xc1c873eb4f5d951b, 0x6f8088b9823b727d, 0x7d029acdaa49b163, 0x2ac3563dbacb2baf, 0x90e443cfe99e8968, 0x0d3f783e59a7b8ea
+, 0x3082621d564d07f1, 0x4c2cbe1a4b4122be, 0x10963e899c2edc05, 0x7435ae474a47a65d, 0x9ab6a245820ef574, 0x3a9abfc9e45f68b4, 0x9e4a10d3b61f8537, 0x6524578c3d95184d, 0x6db466253da8b86f, 0x391ca177ceb50dcf, 0xdd8f1f34ffef2c65, 0x54f1f9e4dcecef6a
+, 0x39f77ff17d83ed7d, 0x410dc9b741c8b2e3, 0x4b0b1afb2e28ea8e, 0x43b6a5614fbe2bda, 0x6cd2b9563b7f7b48, 0x091a84609b2a6e0f, 0x9b67ec1b24ca35ab, 0x379ad6a66187b405, 0x5d80cc5d040c7d77, 0x56135ce5beabf1ac, 0x94fb1f210a32adc8, 0x08bae671ac7d8ac2
+, 0x3948b2fbf7bf2098, 0x19d4c6533f036d05, 0x8e4c8c54d7994385, 0x0ff46d9e36af676e, 0x255b1456cabc710d, 0x5b506093bac6ca41, 0xa7b8cf30e7267604, 0x3df97f29d5dd90bb, 0x188c3002b33a20e4, 0x4cc39936cf85eb7b, 0xa758fafaa9f00fd4, 0x4635d5527c18226f
+, 0x05e0c29567c0904e, 0x2d3c022382080a35, 0xaa77e5708293e223, 0x612c6dc19cd11ff2, 0x90ec9a9820438e22, 0x435f5c21be5399ab, 0x754965854e11af72, 0x106cd3de01e8201a, 0x053f0e55321d8595, 0x33e2cbc63182c2d5, 0x40bc2de82e35ad46, 0x2cdb3fc6cfa59f5c
+, 0x156f3cf18412d643, 0x5d911020d7647e0d, 0x00ba48e238bf0e60, 0x060dbefe0bdbd594, 0xca949c09adeb5942, 0x587618a8764ceb0a, 0x44373d89057fd5de, 0x4196ac996be12e26, 0xbedb748e86d8cb51, 0x5ffbf3b5a5978990, 0x180888027f96ee43, 0x77648c7225d43bb1
+, 0xa4fe84eab6296579, 0x782f82a5deab66be, 0xcb0ef9a011f0d230, 0x56d32df2074119ff, 0xa04622cf8382e408, 0x33ac65be4a346d38, 0xd1f99d4e35b31588, 0x01d5d52b7c9c7676, 0x9eca760b4bc69b3c, 0x2417152e1cfb1aee, 0x72a9aae6ef3b3d28, 0x128163fd1bd4aad8
+, 0x341dce477b56408c, 0x009134c2120fbc2c, 0x19a3633faf6672c8, 0x4ecd925090ada8fa, 0x6852af8b094afc81, 0x06e0f8211c312d1c, 0xac82c99fb48903be, 0x2c014da23c4e2d97, 0x9c6b82b76b7a69ac, 0x36b0362e38dcb986, 0xdca59bf45ea27c64, 0x3a7688e837fed619
+, 0x4dea868a0df2f2c0, 0x0c8d99d13c2b3a8e, 0xb1cd927bcdc7c26c, 0x50d74b9dd4aa76c0, 0x7990faecc435a633, 0x75cfc41c43e6d921, 0x3a12394fd204a5de, 0x6c51151a703ca5c1, 0x90e32a5a946c3baa, 0x7824aa1a17025133, 0x743eb83e7d0e86db, 0x6c17cac6a7048e2e
+, 0x81fe47843fe4c1c0, 0x25c9aa7191290aa0, 0xf4b918e93c2908e0, 0x1f8445bec38b68df, 0xd56f862d1b8a2238, 0x67ae624801091519, 0x7676d6bf0a68c969, 0x58ca0c94bc2dfe9e, 0xa8bd1595fd9c59c6, 0x6d4809a549092178, 0x5cb576da734a9a37, 0x22b88c3b00998e62
+, 0x2972b93f7ba08ef5, 0x07f8fb1593b465e5, 0x004bb6874eb6d874, 0x32b894925a97e7c1, 0xf31535e562d93dbf, 0x71f08ed31a8e6aeb, 0x0c4ab462eda11664, 0x107f4dbeebd5d17b, 0x82b342cb58981b2f, 0x3048364065195407, 0x2e18370c2dac7f88, 0x77e3e22d8749a1fa
+, 0x36d03570bd0962b9, 0x051143b15a722ac3, 0x468ff06032f12f19, 0x3a0be48096a9cdc2, 0xf92a4ec2d1121bdd, 0x3c3b3ef185c612e4, 0xd5ca3e4521dc3b3d, 0x2eee8936e298e035, 0x858481d02c31cf97, 0x1fb359e42784d7cb, 0xe11d6554067fc329, 0x29d342dc5afe692d
+, 0x32e163a198374746, 0x3ca1bc178a7c3923, 0xa7b4527859afa0e5, 0x580acff35e6cf034, 0x632ab1e63b3f74b7, 0x3f70d0616b81dc2e, 0x2862df3d48ce8f25, 0x74599fe82019fe13, 0x79dcf7fe35973bb3, 0x2e78220abc708774, 0x7f2646bacce07a84, 0x273e980dc6a3fb8c
+, 0x9a03e632c18805c0, 0x6e6bedcd3be0d1f6, 0x9cbe759ef3752010, 0x132e13f4aa06f370, 0x8547485649e21394, 0x40de2e6a36043311, 0x834e350cbd8e35b7, 0x14de4a0e936b4fa4, 0xea74137cf00bbe30, 0x4832546e18de7c52, 0xd53fc202dc984929, 0x14c20b1c792b3235
+, 0x7ac9303191dd7690, 0x21b9afb33dfe837b, 0x6683575d6b873684, 0x5a21ddf450c885b7, 0xc3a43519e8db22af, 0x5736cf45e6517758, 0xbf5cc1c69f7ee365, 0x6d9008b187d493dc, 0xe32cabe1b851a520, 0x5f1fe728823c3677, 0x828d6998b98bd16c, 0x13d43c27ac91632b
+, 0x3fb43018d4f64510, 0x3420042d34d10ecc, 0x8afc24f65cfb4d8a, 0x317967173e0e3089, 0xd61e938a4253a0d7, 0x220bd570fbd446d3, 0x98f6d7195324e843, 0x669fe235b3c62290, 0x9bc9bd0632aecce3, 0x4cba8ac35bda468f, 0xe2db805c08e1e583, 0x119d1aeab26bca66
+, 0x1b7256d6af3d5e44, 0x361876c7ec8677b5, 0xcc73d00ceb347733, 0x47dee4df898bab98, 0xe1bd119ecf417dc5, 0x37be6f2af86570b9, 0x70add9a063addf00, 0x74061d1e501700a1, 0x475eaa43643fc837, 0x3cc0f71979314520, 0x0e4293c0db398cd9, 0x0abea60fdd61e8d3
+, 0x02cb06db374ad818, 0x306469fe453ff9cb, 0xf9ec359c28d14ea2, 0x6e6e97c9cf3d26cb, 0xc6338c4d4994d0b4, 0x32494672af1b13df, 0x85bb696f43b3a0f3, 0x774c8e8e9adec9d0, 0x194d1cf09abce26e, 0x1191cde3e59e234d, 0x5ed8fe44a2306798, 0x54a8a2f728763113
+, 0xcdd52123fe32b461, 0x5a61b3d789f50544, 0x7cccc5749a38a76b, 0x70bf625fb638298b, 0x03b9e64add453b04, 0x64bd422b2a93c432, 0xa4329b2a02beedb7, 0x5b27cd1e328fbaba, 0xe80fdcfba4200198, 0x4150dc926dd9ee83, 0x7e4367de9a55d3eb, 0x6d18b9cb07572ac1
+, 0x17c2d6a62d464869, 0x09414e5294b2b2c5, 0x5ba47a76099c7583, 0x64ee24387002b9b7, 0xed8cfd9b5b8a5342, 0x7befd8cdbc38bbcd, 0x654c1fa36e406a53, 0x1f379e70c60a998c, 0x68eb008e5694d206, 0x6d87e593d84b0624, 0x7dd93a753c8f701b, 0x69272ac1dfc3829e
+, 0x3c6e4cdb04e644ce, 0x4fc947692f291875, 0xdcc57ee962935b47, 0x043234d711f453ad, 0xbaca720167413381, 0x6cae85bd4717e88b, 0x52e93d741eaaead4, 0x3adcef8a4913d95c, 0x0e22a18029842245, 0x14157cc50669676a, 0x5b1d2c7ba04b8f0a, 0x07a4ac849ef23b4d
+, 0xf828bbe822f31663, 0x72b0a103e0d8ed44, 0x9584885599f1af73, 0x7b940734897eb834, 0x17a020891c565af5, 0x3453b542c85e7c6f, 0xcbdfcb5070b9f080, 0x33f2c5c93795bda3, 0x114889d46c8d9e83, 0x65f11e4f5c0d0fcb, 0x4024391bf7687e6b, 0x2ddcfaae8d37bf96
+, 0x52cbe3925da74025, 0x386a42803d7b3b42, 0x4ad28d2bc137d313, 0x058e869b70dd7ccf, 0x282cccc033c466bd, 0x4b012c7292106f48, 0x7100a6b4fbd5d427, 0x69b19359d5f29365, 0xebf68027cb996cab, 0x7c7afa54b141caf0, 0x97555489153e2292, 0x31a0ed555ff02224
+, 0xc6043922e3d60048, 0x25e5964c41ddc7cf, 0x964c7b528c9f1fc9, 0x441f8f33377a98b0, 0x59e30f0161d23bcb, 0x1cb4b9c12f72d20e, 0x0ddb6380348d42c6, 0x57974e01437f4080, 0x51a0788e4600c62e, 0x6214cbf7e2e8f604, 0xe866c1454bc749ea, 0x76d5e6925c0f0d84
+, 0xd590fd2c3282866b, 0x79306269e53258af, 0xc258790542153ae7, 0x7b83dd5bb6b07b40, 0x5d46df8502abc563, 0x3fbe9f24a0745ed6, 0x95a8dc0dd80221cb, 0x19832b58e3b52593, 0x7e05b9caafaee398, 0x7841ba04f6709324, 0xb12a8edd3b94c3d9, 0x718ff8e54814f0ff
+, 0x0f438bd63645d02b, 0x2d013a6503d1d9ae, 0x8787a1e27ad0eb1c, 0x2b7116baa5ec4f3f, 0x6735fab7b88ec68d, 0x4a8d0e9c7c592252, 0xa3d78e06f18a116a, 0x01eee855f14e0bff, 0x5df9ded962e47c13, 0x4bc5f904cd349bfd, 0x956d255cd9da8a59, 0x3fc8b2aedd29c4bd
+, 0x5f3f7f4f9d31b08a, 0x07bdc7a0f2e10467, 0xacfc0f06a1cc186b, 0x0802d8c4854deb10, 0x9d42ad075674be97, 0x407535473ecad5be, 0x402b44988b85cfaa, 0x54ca51e4e561be5f, 0x8697ee5bd19799b1, 0x310db04f9f80a122, 0x6da5ae308bb69175, 0x4a0e3893c11f0e4e
+, 0x92bd415467c0051e, 0x5c4e8a52523a0706, 0x28c9b07d88743b43, 0x700513d57f00039e, 0x2cda9b895f3a8aaf, 0x7de9d492ddf0e011, 0x057a60145931b960, 0x0c6d32888a6464d2, 0x270abd7d45f6f8e6, 0x4717c8f825083a18, 0xa8c73e096128d9c8, 0x60d1f95e706886fe
+, 0xc909213599cc92fb, 0x1a3c59ca74285063, 0x59f057fff0072a18, 0x509469b4e7eeba61, 0xb237a3085de695e9, 0x40b8cebec7964202, 0x79e6750f9f087fa8, 0x1ed92a3beeb5b15d, 0x73446c6448d89d77, 0x335bbd284d98d5f9, 0x7762cf748ec0d898, 0x45230da1c0076b81
+, 0x4eec3a05a5fb68bf, 0x5ef771474dc27ff7, 0x53463083a5cfd998, 0x54a70d934033b562, 0x7f317336e8330354, 0x51446514471ade42, 0x618f44da5aa3de18, 0x26407fa6aaaba49d, 0xb877500f972a2d73, 0x526827bfc03870a3, 0xcbfe6a547b73e855, 0x630200db91adff7e
+, 0x92d30bd931217b51, 0x33099d5a3348ffec, 0x2e03696523eafb17, 0x3494ad4dbfe38bee, 0xb670ee4ffbc3883c, 0x14eb3e9a40072179, 0x49c17fbb0ecdc8c2, 0x62668bb2621e7c48, 0xb5b255554a733a07, 0x224a5c58a85e4a54, 0xde918eb3459d5f2c, 0x47341339af907f50
+, 0x301fd98b257c4275, 0x5ea0a7d348ccda17, 0xf4716cca2f2a2d99, 0x12fca4f6b66eadb0, 0xadedd43ee20246b0, 0x6dd2f99bc8656cea, 0xd092ba261754e05a, 0x3e3b1c70f1d85db4, 0x21e5e1e269e0e5ff, 0x677923990f3441e2, 0xfc8dcf7849baf828, 0x46767b40e03671c1
+, 0x7c63e626b026eac1, 0x0c0a29258fbc98e9, 0xd159c813ae20a182, 0x05a23afd9a13081e, 0xd9090f6e8dd4bb2d, 0x47dd7812c1c02216, 0x37a1326c4e24b6a1, 0x33d4a6b37726848d, 0x89c4fd9aa705c62c, 0x53e8a18b93d49e5c, 0x0efa8d4db2fb9a87, 0x01609b268f1b25a5
+, 0xe23ca522630f15ca, 0x2a713e5999f22f4d, 0xef8d1bbbede04e68, 0x054a94ca898e50f2, 0x88f18ac28859ad9e, 0x5bca9a42d88105a7, 0xac22cfa56b1f46f2, 0x50f8807c8d1a0253, 0x464eecb9c9fc655b, 0x5d5fc24ba62193bf, 0x35fc48d29b266bd8, 0x1df01cc5a63a3c8a
+, 0xe1bc11d1986ed821, 0x155461063dd5a10d, 0x4dfae61ef5330017, 0x3f18d8eb9dcabc42, 0x1495bf995e2c6a0e, 0x6b432b76677ba09b, 0x7fb476fead0dda9a, 0x6d40ac28fca8d253, 0xcdba2604ab906923, 0x7959ae6c264c1937, 0x73eef94ae19a7e35, 0x17c97418335d30a8
+, 0x47e518a37dcc861a, 0x7a11b76308f5fe34, 0x619235e8287037d9, 0x393f85b60ee86d6b, 0x4937786eb995077e, 0x7d623ce53c6eb5e9, 0xa3b976cbf208a3f8, 0x78f7323ac55fe4e7, 0x966f3d318cdc4fed, 0x3ed599e0d6560996, 0xf0e93b5fb5a6e220, 0x29d37c20a0388f86
+, 0xc3d24e22b21606d5, 0x4863afffb00a33f8, 0xc569e263dfb6d478, 0x7ee5878b965aa2e1, 0x59c88ce246ed0752, 0x38c47e3b75ee9a3c, 0x4f98830017fdfe27, 0x4a36c5a45a200048, 0xda45fa5a54dca0eb, 0x41d96fac55802002, 0x6d092828ecd49b94, 0x53ed7ea14594713a
+, 0xdfa50469ab278456, 0x434db90f6cb525b6, 0xad776683c49594a6, 0x1497eeff160c24cf, 0xa6f2917cdeb9dafc, 0x0c586af1c3c20c16, 0xf11fb5f7677f5f7c, 0x7f56470bb0ceef71, 0xffb4e80c23597b30, 0x2ea68ec7e9940b13, 0x49ab89a7c577e12d, 0x098c1f3312c8812d
+, 0x88903d7067a8317b, 0x0cad8a2cfab9c03d, 0x784e3343dd3386de, 0x3e6aad21737c709c, 0x59be566604459bcd, 0x75de537226797275, 0x9d1f169e3596b987, 0x0aa2ccbf6cfe40fc, 0xa7e63783b573b715, 0x79af59befdbc4bea, 0xda77f2fb77281889, 0x44b542ac2eba4a89
+, 0x43eb7c9f1c46c5cc, 0x6260673325ca551e, 0x30b5d8c308855523, 0x4e18e3d2d3eacfb1, 0xccd3778856388666, 0x733fe911b781ca59, 0x4ffb197e81b6b68d, 0x5bb2fdb7e1920ffe, 0x1c9f45a2d90e4e2d, 0x5d93953275c10701, 0x2de3e23aabdd21ce, 0x5a97fe6986be9dd9
+, 0x2264aba8ddb209eb, 0x2be56ab9a74f01f5, 0xee47469017de5690, 0x1bae65c0ee186085, 0x84b1b427c99a342f, 0x206115854fc9c2c7, 0xfe7640fc7d3feed3, 0x0669f0b4401d37df, 0xa3acecaa82f5df98, 0x40a9855c19d33bcf, 0x66992ad168b2bd19, 0x227bfa0f142235a2
+, 0x8c49fba42e443c1a, 0x6013bc8ddeb216b9, 0xd74ac338bd766929, 0x457807869c7fd2a4, 0x1915d4c143878abc, 0x6c72b0fa6523b9bb, 0x1f3823ee649d08a5, 0x53b063b94bf4a770, 0x60b6bbd18724bce0, 0x6368a492ec19c5ce, 0xe2c5a2cd2945e64a, 0x11364857b74a9ec1
+, 0x7a0a97d81e1ab754, 0x3bb102cba01564b6, 0x5f815c933cb6972d, 0x0772fb120e6a0ad0, 0x43d017093e4fb8a5, 0x0329a93f92f85f4b, 0xca9913e66d518efa, 0x3794b49b937078f8, 0x137d8a49a7921598, 0x525374e140feb267, 0x8ebff3d6dfb42a89, 0x1b4a1270f13a6187
+, 0x41ed8d92d39d5f74, 0x79abecba1a9ce7e4, 0xccbc07f9034d0b7c, 0x45d35ec927e3bf9f, 0xa9e0329d0ec42b2a, 0x278e1d3cc1419077, 0x5df6b14703646e09, 0x2ce7543f422b1c60, 0x3b8bf00af9a839f5, 0x2838fadfbe648ad4, 0x06b110636ae1809b, 0x6d88f8177c03668f
+, 0xa3d20069a1e42d53, 0x6bedd427704aa3d0, 0x24a8354d419db7f0, 0x51b3f2e2d8cb26e8, 0xcaadd16fb5468ed3, 0x37b6324b7eece59d, 0x2083f7de4202eea1, 0x42c5542a8e2783c2, 0x06e6b41cbecc5638, 0x3fde99ac6e16fc9f, 0x3b3448c0f8202d4d, 0x2e7fc4216908b8ef
+, 0x80b6f9e215a4d718, 0x235494c9e81ab189, 0xa88db32d9241f7b1, 0x25fe5c6cfb31a40a, 0xa0cc58f84c293390, 0x2f30ebe5074b4fb9, 0x0a4049660bc34682, 0x5af3833eec6c7bd4, 0x5c70e9705a33e65f, 0x6e13c5c190df0fe0, 0xfcd40a914b0dc13e, 0x5b3810a63cb5d7a9
+, 0xe2c6b68d03679e73, 0x26ef5292a1d92555, 0xecd8c948d6c7069b, 0x78059fb0b8834b13, 0xfda296ada46236cf, 0x48bb5bf3094dad77, 0x97df648c48fbc24a, 0x27d2b785eddc6428, 0x25bdb0db5866ace5, 0x7ade2c368289acbd, 0xacab495c68b68bc6, 0x4c1cf22374039ecc
+, 0xb9bfa24197e4128a, 0x69e25b9ed36075cc, 0x9f579b71cac3a8bd, 0x7f75680fc8e45728, 0x5f93dd46a6c37eb4, 0x08809632b88b9533, 0xe65fc8288e0e57af, 0x48c6dd97447d2323, 0x03ff899868228cf4, 0x459b965735fad7b0, 0x4583d233e8f8267d, 0x7ed36b96023d8062
+, 0xe1da5670e434f5e2, 0x2cdb4038870f89ee, 0x65bd73f1fec068f0, 0x796aed77831119d4, 0xddb2f8038d070f92, 0x4556a94b2894bfdb, 0x25d4fc2c4688c4e2, 0x210c86c2785dc1e2, 0x9acfdaa65f37d8fb, 0x35b3e1198849126f, 0xf52e8a1ac3e5b8c4, 0x13a5d52783539485
+, 0x7e615ca36d9d2173, 0x6e3dd241a7725070, 0xfd5f5b0b5eb80177, 0x1bfb576706fa053e, 0x982be44923a2a4c6, 0x5fa79e8b2bbdc7e2, 0x97b8b12aef107ab8, 0x79f2002eab243b45, 0x4df8aada81d27401, 0x28489c6a4ba7d401, 0xc59f7ee3e63dd1c2, 0x5983d7b8e19b9658
+, 0xfa9133924b288c12, 0x43ab560f74696449, 0x7e8e46c019210edd, 0x604e2f7955930d48, 0xcc11b16843253b86, 0x498b86536406c465, 0x2c18f4d6d970219d, 0x530a95f031705f90, 0x81c9c0db925da74c, 0x609e473b76e866c3, 0xa25239985ad6b66d, 0x5aa08f8570ebc756
+, 0x7be7265b4dbbe908, 0x14a66d5f423bee12, 0x73d6756b0f6dfd57, 0x43eee5fcf3fe1b3b, 0x26124e5e177f55ba, 0x5034ad146c25ee0c, 0x0d1a2c07543c0c88, 0x539ab8be433fb7dc, 0x502cb9cb799d0300, 0x63784463748dce6a, 0x67dce9b154aadc5f, 0x5ccaedb8b7f80e6e
+, 0xd23dc586449ea10b, 0x4ca2520104615f4f, 0x7a18311789381654, 0x1d36ac0e2105c55f, 0xf27670a2ac590090, 0x1557f039282ab24a, 0xc67c5a7e5bb3a134, 0x76fe3117d4a082c5, 0xfa31f8d746da3c99, 0x44ce8fdb1647b9a2, 0x3e8cc626104e0475, 0x230cb9edcbae8c32
+, 0x8588f88e28be788d, 0x561b1b47e9e62dd6, 0x3c508dc9fff9ada4, 0x66f9cca79f259c5c, 0x29af24c529483411, 0x545cb885cea4594e, 0xf5da538dc3c70adb, 0x7bfd3f2de1e12b03, 0x591f40ef764d58b9, 0x4bdab85aec4d351d, 0xd02090f12421e1cd, 0x41e91e3fcf91eeb1
+, 0x61bf3066a1e8812f, 0x7fd295f7c0f98f13, 0x5039af6f2b287fca, 0x18b5a88d6816e153, 0xfd6402bea314dee0, 0x51550002e08d493a, 0x452880b61a2e1578, 0x5ca3fafcea68daed, 0xe90d7b9eb8c34145, 0x06ac140375f30f0e, 0x97f558d3fd325161, 0x68d3c3fe5486edd8
+, 0x9cbfabe3bef2b2e8, 0x5bb053bb66f96555, 0xa42cc20b75262f7f, 0x2d8de14975c768b4, 0x6b23d7287db184d8, 0x28c0db9a015954ba, 0xd1b16afc62eab777, 0x0d03923b284ff654, 0x478de64faba5e89d, 0x5c7abdbbdc7b811b, 0x9f85fbdbab923848, 0x75309161b938f8ff
+, 0xcf3a482d7d710495, 0x0838a5a134d6f4e9, 0x370c75b447e5c696, 0x4ab5fd3aea28e497, 0x6b9af89ba521f73e, 0x1d59584d5573b04a, 0xb531a673147f9c25, 0x442120d3f488cd4f, 0x2ff7f195fc6463aa, 0x6a89643e9e1ffeeb, 0x46ff3051616b1cc1, 0x350513dfedd5bc6f
+, 0x037d96130aa5bce7, 0x41aafa77a4d6b24a, 0x00a67fea73d0ca51, 0x4a631d22e0ec41cf, 0x5ced1276ddca3469, 0x77a0d1c06d36bf7b, 0x2869eb87df7f57bc, 0x20ffbf1e7aa83a0b, 0x93a1fd1c6fc67872, 0x4c8f76ff45091321, 0x2b426281d601c968, 0x2c76b5604f21c777
+, 0x1388f7d129d004ec, 0x23b429a2d628b33e, 0x903fba1ab5f995d1, 0x56ad717775056000, 0xc222ec45dd819110, 0x1491923effa252ea, 0x0cd060a0e5998d69, 0x27c161c70248df68, 0x4801e382fbc79155, 0x2e42f3125f746c5b, 0x71ed547254c45f78, 0x0b75e232eaeff3e7
+, 0xaf5f8fd136e0b4f6, 0x590148207a4add36, 0xc723c192d1ac2cba, 0x24bc05467e650855, 0x36903af05a24be98, 0x1f9c5f8f66c0a722, 0x8fe754de1573ea98, 0x607c3a64ca33b39b, 0xcb58f979a3260159, 0x2f455bc9f009fd3b, 0x852b55f591fb7607, 0x1bca23f96a97d7dd
+, 0x1fd43dfa9d966891, 0x07f19fddbf9de3b0, 0x66953e1ae8f1a47a, 0x5b10115c74ca6918, 0x221451f4999d3e0e, 0x5ee326279e6b3dfb, 0x71d151b2c5dc4658, 0x398d9ff18719a78d, 0x176a85761ba64497, 0x12617f6c73f748ed, 0x09339ae8e67b7c2b, 0x245ff3a86fb90d46
+, 0x32545564a122394a, 0x7833a4fdc242e75e, 0x71c8f1364f99fd9d, 0x4a49e3f333cd4a34, 0x0139e1e74547e2ea, 0x2756ae7a3e702a00, 0x8bd755b9eae016c9, 0x75c962a8b607e086, 0xb60e67aac0bcf1b0, 0x23f2071c645e5779, 0x8ef2646985d82db7, 0x4118ef7ea1f53c17
+, 0x993d4ef0cbc912de, 0x1fa3fb4ec8a1885b, 0x0e1fa1f8f276a96c, 0x0a7f5076c0bc358a, 0xef0ce9aa53bd8819, 0x719c391668b3a5bf, 0xf0e17e3ec4285959, 0x36d79bba23356b55, 0xe69ab4a0019ba2bf, 0x2528bc238e342f4d, 0x17e86e27737a52bf, 0x63d7624ec6561559
+, 0x7962e9426a5abd16, 0x6191640c198693a0, 0x247d37d553bedac7, 0x22c95410c6052660, 0x9679cf5ac7beada5, 0x20d8c5b5c85bdfc7, 0xaeadd407a0f2aff7, 0x370d16c334d640e3, 0x27677fdae965e7b5, 0x01b8e37abb97e054, 0x8198413dce3f3fab, 0x08f80b591c40e04d
+, 0xf03cfab9a434b2b0, 0x2647081494e76a7c, 0x57e1f93e392fdd3a, 0x07311adf5928e2cf, 0xfd3d3e9d26a2bde3, 0x1aa615480080f1b4, 0x70108b8c9e4ef10d, 0x2a66e4f8569bc02d, 0x8b65f4ed820c7424, 0x27a41900b0b3e35e, 0x04ae828f6af37c11, 0x2de2a9a417d72894
+, 0x5e6bd80a1ca5872b, 0x588f2c97b3fef911, 0x6977ead1a347ffa0, 0x2fe5742fe36a43f7, 0xdb536dfc323a3536, 0x380855feb0ae601a, 0x5ac9da841b7f96fd, 0x70dfed478a261346, 0x0cafaa8526c75507, 0x76ab5938feb46b67, 0x0477294d5e0a984a, 0x200cb8cf260774e3
+, 0x86f449c381491032, 0x34a9a647ab9dc50b, 0xc05332780cf8d4d7, 0x5d4ca3506861c03f, 0xc71f30cf47c3006c, 0x65df9bd955248506, 0xa9eea538a8bf0a7e, 0x49f2cc06f9429dbd, 0x97d906e202230f94, 0x29adfa90b5749434, 0x7c132a27fc936581, 0x16833f8aa69c31be
+, 0xac8cf58c022ee96f, 0x20c3893432300f94, 0x8ed732628206816e, 0x26651f280958daec, 0xfc6d8624529decc1, 0x4a8fb16de75330a7, 0x03e1d674d7880791, 0x3724c0285589cc40, 0xc9daa804834d0252, 0x4475710683a6449d, 0xd615fcbb204529f6, 0x3b8ce328f660f40f
+, 0x99cd1018be2e5d6a, 0x2f23d82ed4c209ff, 0xe5f2496b74c82f4a, 0x3d16ce6cdcb38ad2, 0xa6e49dfbf051a6a9, 0x63109fcf3e9edd7d, 0x42c81e3df6501c44, 0x28981eea8f6ee266, 0x4ca07e6b7d8dba32, 0x1cda8cab461c0453, 0x33156274504be914, 0x39d6643c1621e4df
+, 0x49041dc234d5bc88, 0x46efb4f857435a05, 0x250e163933fbeecd, 0x44a2e7c0f0a6e9e8, 0x9aca15893f142428, 0x4253422c7ce6d733, 0x85ee92ff76027111, 0x0a90cb612ba09cbe, 0x8b08f80f08ed6f81, 0x5597a38ca18460ee, 0xde425d4f248d47ef, 0x02329582156c67ad
+, 0x1c6a9a21de91cdcc, 0x7a61a0677c9d7b17, 0xd1d4786c93d1ecc4, 0x3ae47904821e32a5, 0x63b3adf8912ba93c, 0x76d9885cd58017bc, 0x9432d3c8aecac428, 0x1e092688be0e93e4, 0x33e954fc93c72a4d, 0x2fd3028d2d4aad7f, 0x735dc9225e62d47f, 0x5b6293130ec4c6ff
+, 0xd0e776bdf459a5c6, 0x1de7e6e0c76eca12, 0xb0cb2fa1d523ec58, 0x067e24386dc1d1e6, 0xf8a3e712357fffa9, 0x1738bcc3bfecf922, 0x7a3ef8e581d352b4, 0x1baea4e4835a59bd, 0xdb4d3adf72898d52, 0x6c85030c9989057c, 0xff2978c5e919d4cd, 0x4a76e49ed18ee618
+, 0x14fe2d6d3c5243b7, 0x58df36cbe19bc413, 0x4c5008905489553e, 0x67b41888ed02cb54, 0x4a80ea42b3bd88d8, 0x1a01ec4d97b150fc, 0x19e4551fb9a5d0e5, 0x59e418d38c5faf0e, 0x63a010f5ef0227b2, 0x3fa886689ab0efbb, 0x9ed51ade0bef0d62, 0x396af093177e30cb
+, 0xe9d847f1237759f0, 0x500f48094722aac2, 0x5be623eca33125ad, 0x793252cea16e8bd7, 0xbe915e9f77226b20, 0x2fed487ad494d21d, 0x44ff71f70f3faf6c, 0x5c02fcf1da3fec7a, 0xeb9ab912f645490c, 0x4d5ba5c1a06a19c2, 0x06bc9a8e4a0cc73d, 0x0f8eb2588e805d54
+, 0xb3a0eac7f962292f, 0x6358e9e53cfc0de6, 0x3e20cca0b61edadc, 0x67ce50d2d24b5dc0, 0xd4d760c62320c11c, 0x7227bbc663f3cbde, 0xc8e495fb94c2a264, 0x37cc4f909ee110d8, 0xac0413017c60bce5, 0x0cb16042f40b22ed, 0x04f26167fc6ebbc6, 0x337d919c2f5de6fb
+, 0x5dd7f10d88b526cf, 0x123c4d0faf768f7b, 0x99e48ccfa173942a, 0x0dd5beef25d09cc4, 0x21c0aced176be429, 0x2bc9efb841ed5867, 0x51825263cafb4fe6, 0x55f645cf89b4c66e, 0x84905b928c2e188f, 0x7fd99a149c5b7b07, 0xc9b2ad98a86ca994, 0x6181cfaf6acefec9
+, 0xaed331fd222f523c, 0x3504d517f62d9f52, 0xea720dff7295a318, 0x37b286d6d4a8ca09, 0x7a8a506b7214265e, 0x18a6d31e1090a962, 0x70c2e5a834396dab, 0x118f4f3be419a9e7, 0x6310bc8694f57b22, 0x32f053580d9cc9f6, 0x787b75f67d44492d, 0x2c21a2059a2cacab
+, 0x8599ad008c0e2ac4, 0x73874fcd0586ccb4, 0x17e98745e47c0605, 0x715a2ca8c7d83a82, 0xfacb660b84133bf1, 0x64f58b4a45e6cf0b, 0xb6536ed44077c021, 0x22a31da0a9c13f34, 0xe58ade8979f440eb, 0x5193736665f27e61, 0xcb6fb2aa1398359a, 0x6874a5fa8ade2916
+, 0xc352407b66a05746, 0x54adaf77cf324aa8, 0x023d1bf96c7536f2, 0x7d55cd9bbfc5b86c, 0x6724a0fa3a38787c, 0x6233ac1b59072661, 0x8ffcda6db37c1183, 0x08659b98c2b93731, 0xa5e2f40703e90b97, 0x531910f41dafe770, 0x089f32d77fb9ae63, 0x339531d4c4f48cac
+, 0xb97d2253936b7fa9, 0x517fa5accb5ecba8, 0x7656e39aa73f5f69, 0x1cec776a1f995e5e, 0x5a40313d10511816, 0x3a17cb27fa2effe0, 0x11d098cc36f9b666, 0x722acbafafb78a86, 0x9bcb3a53e820ef8f, 0x4975637e4e7f1b99, 0xbfba51038e403c91, 0x0fcdf5d65351f7ea
+, 0x395070f6deec352b, 0x6061431b0529b1f4, 0xb27bc3aca06e7776, 0x37b9f134dd511a5d, 0x01e257deb9ce961c, 0x67c6c030e03e572c, 0x9e1d47666f795901, 0x5466c181c366c1ee, 0x6ebf75d0ad1fb242, 0x296a62ea08bb55ec, 0x23da5f72a5426008, 0x27c3118ccd11871e
+, 0xc0fc81dbf5ab9942, 0x60105135de17f389, 0xc6ca1fafacbc3b9a, 0x796425b3660cc35f, 0x830bddc21d83e612, 0x0767547f2e896b84, 0x9f7940ec3ba091fe, 0x4d25aa118a9c20bb, 0x8b238e1bb3c9a98f, 0x2d2067425dd1b12a, 0xdbf25c7f78cbde2a, 0x3d18317d4b17ce87
+, 0xf8ee758289e12e32, 0x3adba8a72f87dd5e, 0xbe5c0af4fc24bcf7, 0x2acf2456b259bb68, 0x4ffac1559a70bd32, 0x49e5efe0a13a3c4e, 0x5a1163e9d4d25ad4, 0x50c77812c6818be9, 0x312f22bdce132b2c, 0x299f8ec48abdd8c7, 0x5d3ecc47b507bc2e, 0x49c4abcf818ae82d
+, 0x2a10653eca4d74e8, 0x12ba60b2ed63fc88, 0x51c8365985a0df06, 0x21aeab7382573b69, 0x21b37696192d5082, 0x17ed17cf46d9fe0b, 0x9a7695d2ab574891, 0x7e20fecdc8e04094, 0x3eb89051893498c7, 0x0180f11543c9b2b0, 0x6b21b0bb4961268e, 0x6195bbd3dbcd089f
+, 0xb86a6fc7736c354d, 0x6930fb40dfca25e2, 0xe95662291ff1ed0c, 0x7eafe83818126679, 0xe655eed373c3c6b9, 0x2c7a2a56fc0f8fd8, 0xb0c18efc38fec9fb, 0x6f5f04da32117133, 0xa48d99a3b4bba201, 0x241b62a6f6ad08f3, 0xf86558917dc971d0, 0x0cb0c9a944717ff8
+, 0x946a5ef48e245fa5, 0x7ffa22fd35fd2fa6, 0x12a92d81c84479a9, 0x4e149849d4f42635, 0xa22e0ee8d45804c6, 0x68996914d3eef78c, 0x2f566b65ec8c28df, 0x0d2212ea42fdd233, 0x5ebf38088fecce85, 0x708c962d20ad825b, 0x8a58b72d0590b707, 0x2bd77a4a3bc94f1c
+, 0x2ec9cc5227ddff80, 0x79f7aa8823bbf0f6, 0x3f77b3c3164fe349, 0x289135bade275872, 0x1dd57689bfd016cb, 0x7e07b92f59c6d794, 0xd5835ee705afabc1, 0x4a6e4287712b9cf8, 0x3a5d8cb5f2ceb770, 0x2c4dc9ffd7e170b5, 0xa1dc918a7233da83, 0x70c022061d84fa4c
+, 0xb0b9905d5f90691a, 0x136093c00f5d0861, 0xcd6653f0fbe37aac, 0x7cc982c1733c6894, 0xfe58bad6363696bb, 0x3543cd60509264fc, 0x1129ccceca2c83fc, 0x512cf66a9b06f976, 0xd5034d69d217c821, 0x30d3bb2d25cc9b08, 0x7f41a54c3741bd0b, 0x73c193a63e87a456
+, 0x37be22c52c355bb5, 0x7aceda702cac48cf, 0x426ba8ca12380775, 0x78a908a9d1ec91f0, 0xd47f39ef447278f3, 0x32d670062de46d99, 0xc30e6a58a75798f9, 0x2c2ef8cc728e53fb, 0xba1cde1b74e07238, 0x386c90b8b388175b, 0x1517577bae4a6833, 0x27f5a775312df9f4
+, 0xc39ee6faf81f9d97, 0x0586df353f5c814e, 0x3102ef8046ea0d55, 0x45c4544362e8753c, 0xd5b0d8ef6032738a, 0x791f154209ed2093, 0xfc147736098a84a0, 0x7f7aecbd4e56d646, 0x0bdb43ba608e68e9, 0x20f9040e2f85bb8c, 0x5f668ef0a5dfe2b4, 0x30beebba53aebb30
+, 0x1bea3f54d1590223, 0x08afc07e1c4814ec, 0x803f3d95fe56adb4, 0x04e78a837e1c42e0, 0xc6ed9d8a48907b22, 0x64dede2c44632c08, 0x7e367576588ab70a, 0x78dcb307da39bf9f, 0xd44160799a153d65, 0x411acd79f0695ca7, 0x74bba4e71d429be9, 0x0f4eb91e91b536e9
+, 0x74665dc2fb9ac527, 0x38542f8fe897cfaf, 0x0b7e3c390508700c, 0x19639deb1baf78be, 0x2bb626108a1ee4a9, 0x18f23d128b5a2725, 0x2dfb3082354f44e5, 0x4ef3d955dd61bdae, 0x8bf8ad38d5416036, 0x52f033f6f8bdcd9c, 0x13bbb333653ab237, 0x252e4aabba875ace
+, 0xa823f1903df67f2f, 0x10aacf8bdb6950ec, 0x1033f8bfce08d28f, 0x009495a5f6f2880e, 0xfd99fb9ceaa4db5a, 0x2efa2d01b727dd18, 0xa71c656603829f46, 0x601e3051f0fa74e7, 0x21a6597a042807dc, 0x028787f7ed696bcd, 0xf0412f6f9ad3fea7, 0x38c42176751823bf
+, 0x5e00f72a51af326f, 0x56bedcbc8206159c, 0xa458e0a8574a3b69, 0x11b9681d30ba39e8, 0x624a657c8b26c950, 0x5452fe459c9450b2, 0x6955ad02858322f4, 0x45cad9a064cd0051, 0x035ca3b632429b74, 0x35f8df5d3a1a5f2d, 0xb9da64375faa592c, 0x4a8e5c82b452478e
+, 0x30a043b7ea958a47, 0x79383b90aa455e66, 0xda548b60579cb745, 0x794371d67e5f54d8, 0x8156b22edbc33c52, 0x00fdcbf7364e3dce, 0xcab48e19bb07c488, 0x2d09a9591c635e01, 0xd1be2b6b6151d987, 0x5e44f4c67e8d3204, 0xba65347f33bc8bb0, 0x361f16276c487436
+, 0x380c068a986ea104, 0x614e98ac51ba222d, 0xedf764bff3cd9684, 0x541eb725b96cab9c, 0xee47af1707a484d3, 0x64a71c2b5c6237c1, 0xc99c757e2a08b802, 0x40d205742e877ee0, 0xf229e436590f3c96, 0x154140f3e872f3c7, 0x726e70d65c4c574a, 0x53776d9fedc63ed1
+, 0xf95f20ceda54eaa6, 0x6abbb21a54687b9e, 0x484153053a1abd54, 0x3fb03da48e208869, 0x7fef45d60fc72c7c, 0x34dd15de4c7b2400, 0x395619521b99fc9f, 0x48c91a6040f3fdb2, 0x716f87d6fd807641, 0x13a35d0c2fcef57d, 0x17c75a06bd193ee3, 0x6e10dea54608a218
+, 0x6ce8a8fd111158b5, 0x50ececaf42cdac48, 0x4c9be63b10b3b4a3, 0x448c19be30234280, 0xa05dfab280f46ac8, 0x5aa2837190175de0, 0x95ade1bed8e62a76, 0x08e79688240ccdbc, 0xfe42baa76f8fc516, 0x3fc1467fb032ec83, 0x3e2ce1a1f8fda267, 0x07190874c7cc0606
+, 0x6e1e940bebb37508, 0x559e695c842c1c6f, 0x4b46a954300dd106, 0x631b502afc94f65b, 0x7c1e886c4e15acf2, 0x50e12515528d1715, 0x9e91131dcb6c9f61, 0x01f20c01a45d29d5, 0xdbb5ff413e950642, 0x67f6c030329ef541, 0x034a5bce29b9d665, 0x512fbf25a31f576c
+, 0xcbdfec0f7188f9ed, 0x05c1e2879ebeadf3, 0xeeba87b0053824c0, 0x0a7379287de1066e, 0x7b0f5e2c60f9dd06, 0x761ca4aabc1a2586, 0x7d1e5784961c016e, 0x1810bfa4a779c81f, 0x355eae694883b834, 0x213df017a5b0d8ce, 0x3940ea640a895b35, 0x422ee85b6c33bad7
+, 0x82d934e00801c3ae, 0x3b064accbc34f59f, 0x94139096c68a7e3f, 0x39f5226e3fa94abe, 0x8774ecf3195a4447, 0x27fba96221e1e28a, 0x0d62ce9978df9d79, 0x09661c72dbb26949, 0x81f11eabbb6f15b2, 0x10be7d9a0da7bd64, 0xc868ea801e5b6ded, 0x7c617c7c9b131826
+, 0xf2382ce31daee65d, 0x2f1c0e0bfe36b232, 0x1e6540a4dffe03a2, 0x0d1fea66eb58d2d0, 0xdbc551c43691addd, 0x1b3777a2b5e751c0, 0x61bebe84d3c36d9a, 0x29df8319ee41815a, 0x53e63209aac472a3, 0x52bae5bc4da0c281, 0x15417b417d9449a9, 0x38eb03e2899c0513
+, 0x9826083d5bf99eb1, 0x6000aadc8d38a936, 0xf24063c9de4904ab, 0x2edbdab815b5efb6, 0x7487245fc4702a67, 0x30396a804d1cc443, 0xf58e03846e8fcbff, 0x3f7c4701416f60b8, 0x4565a8c6eeb69378, 0x7c92bb77fc8f17ea, 0xfa7335a7b70fee38, 0x3304da972b512d07
+, 0x457f8d26c63d1a0e, 0x29144d097a1c0972, 0x534f9a8ef2d83e62, 0x05c1df85f1604ade, 0xc5fec059bf669117, 0x543cfb7da7178c2a, 0xc6298f7cf01b4539, 0x262e3fd9a50c9a19, 0xc573799acb743d3d, 0x33f1989e875bf2b4, 0x91d59859af572f92, 0x60a84d40959783f9
+, 0x424a84ca25420d6d, 0x245d08004e201e82, 0x0df6a8f35fc2a080, 0x1294bf2076c5f13d, 0x95877dd582d5a834, 0x6adf77fda1a184ab, 0x0ac4225d70db2b99, 0x66c87b874630bd0a, 0xbb5be2cce6796a5f, 0x27bf3fc069223aeb, 0x52e12c449148f4d1, 0x6b27ef4c485466ca
+, 0xd0d0c8181669656e, 0x4384f2ef0e660ea3, 0x44c2127772796d54, 0x22f6504e35bd64e2, 0xe76d8e466271e7cb, 0x3e5bc577e9b6c88c, 0xf9afe0f1e36b3a71, 0x144d7981f3087e51, 0xa92e4bf3949308fa, 0x566d259e339ca08b, 0x7d1ed56beabd580e, 0x5418cf99409a3267
+, 0x997321c7b02cd1a1, 0x7e8c760e14f41d56, 0x6ebacae73b41c523, 0x42961bebb1d4d94b, 0x611173bebcd14f37, 0x629bbed48e2fac22, 0x3943eeb9ba9cbbd2, 0x675ea35a074d1a02, 0x9001d83ba2010b91, 0x005b1986a7faa432, 0x058390aa2486f875, 0x02728853855e7d9d
+, 0x09d7cbf5bc64a258, 0x762f1eb7cf80653c, 0x72c1ef5586ca1753, 0x4106ace8c0da5317, 0x972517bb324c58bb, 0x1d80c2eb35ca576d, 0xd6c2fedbcc584e1f, 0x006958ae326b6d5f, 0x3f9913591686fdc6, 0x2ab8ac0fbcdd5bf5, 0xbe69777720adf280, 0x2fa83bea952bc9de
+, 0xf7fdba16efd57f73, 0x2248f0385a819ea0, 0xf849bb318342ec6d, 0x2dad496b3f2a1a8f, 0xd805295efb8aff2f, 0x26006f9f80d3415e, 0x0398791c8cc534b6, 0x4666c9a3b6da2e85, 0xf2376cc3b6e6095d, 0x1b75b5084a839507, 0xc6edd9b8c4d6c962, 0x4b489f85e4022dd0
+, 0xdcd2d85ebdef86d9, 0x01453f8a3c31915c, 0xa13c59131d90cbd0, 0x3a03ee97869c220e, 0xe673e8683daa9006, 0x07c6ed28c86e6d46, 0x99130167a789ca88, 0x78e730d573f98515, 0x0eb62275b3a66200, 0x5bfe762246cb9cc2, 0xb0b05387781869eb, 0x3a21d9c9c1d16c7e
+, 0x70eb6ee4050a7931, 0x3c65e68bc7ca38db, 0x71d546f7c1349d74, 0x3680ff9887d2cebe, 0x9e15f19a37b9a170, 0x65f600837af330e8, 0xf049aeb47426db4d, 0x16d20656d82e0293, 0x835412d47d53cf25, 0x7f20928159c3530d, 0x6f06592c6243ff7a, 0x755572f9a83ac97b
+, 0xbf84bd14e7c47b06, 0x48d56b2216d68dfb, 0x269f3a95f61888b3, 0x50e86cbbe3e78586, 0x8d24ec506838fe94, 0x0dce7cc75b124dc5, 0x0a68b2bf701e5b7d, 0x07c5c46e62397a28, 0xa3633981eed7b1a9, 0x4cc369fcd82aa41a, 0x721e726056a17abc, 0x4faff66af8ec5d14
+, 0x4daa7b6c1a354ea2, 0x2a87525b7445b45b, 0x5a5ec385074cfcf9, 0x25191b99c548c639, 0x2ff0f818c185fa74, 0x3f683d58383c7677, 0xb4ca6ca2e6c12ec0, 0x7860fc0284fab612, 0x0f552b6420259925, 0x0cc873e05fc158bc, 0xda6f80c8dbdd32d2, 0x1741f018fc1bf0d2
+, 0xea17526a4dddd263, 0x4cea9751916432cb, 0xf450842a78b5632b, 0x4400e7e63eacd388, 0x84dfbbf143a1a58f, 0x4982f92a5891613a, 0x3a778401c0883193, 0x0e7565684a2e42a0, 0x3fcdc019ef4b3bae, 0x0e7b2acf8f7e4529, 0x2823dc0ea004d65c, 0x6195d11174be3696
+, 0x37333d9c160327c5, 0x7ac1e092835c89da, 0x4abc65b87b8940b3, 0x7aeed8c0f3aa04aa, 0x7992e98952eaa893, 0x03c6db3fd786a5b0, 0x783d1d716bd70426, 0x7afcd5818fe81cfa, 0xda608512101e37e4, 0x01f3936a1e7a8444, 0x454ae7853302329c, 0x6c5f9789449deaad
+, 0xdc8837b6b520c92d, 0x55972531509b579b, 0xd0eedda4d010b7b7, 0x79ec504524721519, 0xaffea85c6ff6873f, 0x7169db38801f858b, 0x6612007ca7a6a0b7, 0x27323f0f7c631e2a, 0x4d01bbe9ee4b8a3b, 0x1fd8dbb12e3ae823, 0x183880701331884e, 0x358365d8a24942ee
+, 0x55067c1d0596261e, 0x6da41239cfad7fd4, 0x2c4885a9e58cb491, 0x75157a1355586707, 0x1007ff05cb21073a, 0x7c807fd2a52062a8, 0x2fb9463d720e1de1, 0x5b31e59fc48658d3, 0x3c4ba10d13312df5, 0x43d1b711520547af, 0x0c94e79afd95f7f6, 0x06eac7a66c5a7a05
+, 0x0158679a243f7187, 0x673603dddfb4d13e, 0xcaebafb6d409f609, 0x5856bc7e9ab79742, 0xa71c23963e3fa8bb, 0x4c5993eb12dbbfc5, 0x6118276597c94a6f, 0x0cac040829cfc717, 0xdccb8d26f83dfb51, 0x0cb4b14ca6bbc674, 0xd44198612a7fcaa0, 0x39f9764a507f1b9c
+, 0xd7558cb083c1fdf9, 0x42e98e0e5180a17d, 0x755f780546c22e67, 0x4ab182fc89297999, 0xb2705039c9c71aa7, 0x1485a582038f3e3c, 0x685a834586226e0a, 0x6124f25342ebe4c7, 0x3bac2b39710cab2c, 0x6149849c40617841, 0x5f6a45b72bb74c60, 0x79342cf1dfcaefcc
+, 0x6309725e483ecc54, 0x003b1f933f911694, 0x2a0c2aa13e398c41, 0x00503b61770e62cd, 0x0292eb9849971acf, 0x724d571ce57ca6df, 0x158a0ce50f858dbc, 0x753a38a3d23f4276, 0x217b2c9e558d5a3b, 0x25823d97ba4c0ef7, 0x14acc733cbb247d9, 0x41271612fed1f361
+, 0x97c27514c99e982e, 0x64a89209f9faa140, 0xbcf0cdf9c2248d8e, 0x741c996db014a2d9, 0x5b63d86b17c4ad94, 0x7e3ca5659c1f7b04, 0x43e5a1e802ec37dc, 0x5ba3a0c5b48dfcf1, 0x37d863402b265522, 0x524a3378c0a7bf09, 0x2c654ae3c0af16db, 0x7a107291d24274cd
+, 0x26b01a68d2e05c0b, 0x4783b080f4754450, 0xeae27e07baa315be, 0x1ee61e87735a4efe, 0xfc7804fa7f4a5455, 0x1a8b76d366207c0b, 0x95323b5f6bd425fe, 0x4025ec2512b82d6e, 0x6b8222ccd06eb612, 0x18131b79d70fe3fe, 0xe50dd91ea4fe0089, 0x199565f158859fc6
+, 0x1c6771cc129cf691, 0x71935bb8a285fc1b, 0x8365202a3df12ffc, 0x049f04104beca3ae, 0x338f33b5b451a817, 0x6fd7b70dfb1efe0c, 0x9b470d331964e76c, 0x1f9c2ec6339ae4d0, 0x79935f169a70e490, 0x067112fc03d1c934, 0x7c45fd1fda3354e5, 0x58f5188ee3e9e6de
+, 0x857ab56899db50b6, 0x2de7bbb75977158e, 0xd64e4faf6806acc7, 0x411ee31c6cab0b3d, 0xeaf824c7c8d24d36, 0x7195a3bf3d33ca77, 0xd50dc123a1f1a883, 0x1eb5327089d10714, 0xb596c1251eee717f, 0x51d3fb73f48c0c4f, 0x0764d668e3f189cf, 0x23706a711e9cfb03
+, 0x06a884bbd4abcc67, 0x2daca5ea36f88deb, 0x7d0f7f70af146bc6, 0x075e7ba1b81657ca, 0x486046aaaa174305, 0x3cb9f74a173a2cd0, 0x1ef47e52f125e24c, 0x09005a6490145500, 0x77ea04581926292f, 0x6d29a5db2a39221c, 0x90a02ec4493200c1, 0x64dd7f09c9080908
+, 0x3760cfbe2fbcde9f, 0x4d524a8105942cb6, 0xa756d7da5097683e, 0x3c5442cce5401741, 0xb1cfa75103ab3c1c, 0x26f254ed7fa9aadc, 0xd39d49fea5980373, 0x3861efa6f17fa6ef, 0xc542e5ce6b222b57, 0x780c5703701d1d06, 0xd8e5f171d7a5b1c6, 0x0b04c1a799bc1901
+, 0x62df6e50ace420f1, 0x220c81dec64b6287, 0x1ee984c0ac267cdc, 0x13be72a6003c4bcd, 0xac74eceb32d3968d, 0x0ae3d8b8ca1494dd, 0xbc4bfa8902d3d5c1, 0x79874e37b3d9254e, 0xa46ffe062d1a23b0, 0x7e4770ad8f62b1b6, 0x1afd2437d0496632, 0x5e05c455ef688ea3
+, 0x9bd73c0074e338b7, 0x0b4a48f9c86dab36, 0xf77a94719ea87721, 0x74e9d7125d6846b3, 0x0ecef492b6a1fb06, 0x59c5cade2bbb6abb, 0xe737cb42f138a79b, 0x6a3292101043d30b, 0x39d5d39aa851ce6c, 0x2d571cd434488e3a, 0xfaf2485c7ed82aae, 0x04fc5ddb55600d0c
+, 0x51299b296299bcd6, 0x1062901449719120, 0xdc98eba05345b6b1, 0x110f23d8d7ab6944, 0xb63e5ab62f19bbfb, 0x0c811f50e28a1d42, 0x006b91b3fd7a49fa, 0x2a4b1a99fb72cc7f, 0x12eef254922f14f7, 0x5b79915a456a36ac, 0x0eed7c9707b24a3e, 0x11d4c64122dc5217
+, 0x30b44378f9070112, 0x69d5d3a76b468e18, 0x9af7e65983d95d2f, 0x766cdeeea611210c, 0xf220744ed5909de1, 0x441c2ce107540bb2, 0xeb72ebe982764eab, 0x368b213a556b56b6, 0x534287119e620556, 0x2d56619ef5655990, 0x4474b5a1cdba5616, 0x6d412100e0e7318d
+, 0x9fd6161b450edaf0, 0x68e25f0a4c49c17d, 0xa060b2ba5e39f7db, 0x166c7dabd7649b87, 0xeafc24e95cf3e874, 0x6e49471eacb7b785, 0x4cc05203a6ae5a21, 0x51ea44ad4576ad77, 0xe09a649ec0e1324e, 0x41fb502331b450d8, 0xd278a10d01da52d5, 0x63d442331a1c1453
+, 0xc7f5326caa9d7bd3, 0x2f5299b9881a739f, 0xc74a7613a3cfce62, 0x6d12c8e98828f65a, 0x1fb587cef473368c, 0x61cbec09ca6a63e2, 0x108b8c8a3f4d139a, 0x5a6bc627738ebc4d, 0x44df065afa764c03, 0x054adb610ee533d5, 0x2b93323606653be0, 0x7eb74ba4f2e6d019
+, 0x992aed708392663b, 0x38794df285c1a0e0, 0xc7095d437d9d858c, 0x253cf6f245028b49, 0x60ebfb37c8803b41, 0x29c536d5ab382524, 0x2ec304cd34f6cae8, 0x34a629c8f4b5bc6f, 0x7f7d3e45b039b16b, 0x597b1f4e67c3fbba, 0xcc29128db07da685, 0x4a828ae34a2a3f87
+, 0xaa537b1077460387, 0x71bb91adddcc62d4, 0xfc55551ecb4ddb1c, 0x7df23759eaf15787, 0x44786952d8c58381, 0x4d38ee9879402c66, 0x126a4a7043204d6e, 0x375f282c45793e1d, 0xf524c4ec9d850a82, 0x6d96d8f08ef9cbf5, 0x1dbdde297f303702, 0x24fde3b039604273
+, 0x863e4ace18eca8be, 0x03ccc0b900cd1583, 0x1c0cc2265dd361a3, 0x69e727bd94490db6, 0x247357bbb7f57f61, 0x696411eace2d994c, 0xff0ff64deb40ca1c, 0x5b8d4e28fdcfb5d1, 0xdbea06301c4b50c7, 0x3acf06370bca9c3c, 0x8d7ad711e9e6ec1b, 0x3379bb7444ecd3bd
+, 0x64822168c034d62e, 0x49179bd621a07d22, 0x4ff062a850222975, 0x7f5803206058f3f6, 0xbc100c510264fbfc, 0x1679d26255c462ed, 0x6ae74dd7c2a58697, 0x21de77ae8ef58463, 0x87b794c2b9574b6c, 0x22cff81eadaa52cf, 0xc2c19153ff9aa535, 0x5f3ce94e0ac99859
+, 0x0a734476a654649e, 0x2fe240dffc632d2e, 0x9a30db0822f0710f, 0x33023db0e6520e5d, 0x66043204f24f9f05, 0x374c12da05316975, 0x1053e068368e8697, 0x67bedc6bcfd53f33, 0x5b339e4965c4ccb1, 0x367e73f14aecc540, 0xa88cf1c7c39754cc, 0x57219b61fc2c7f04
+, 0xd3cc059fe5088194, 0x2136edeb105446de, 0x9b2471444c1086a2, 0x72e63b3f9c686a94, 0xb4ed00607ecdb3cc, 0x2de1ee3ce6ab99ba, 0x6b6ecb648f048929, 0x25fbccaf964527f1, 0x156957359c1ea9dd, 0x64bd270fd61afa57, 0x93fcfe4ca50bd3c1, 0x1a4f2d89a2021392
+, 0x57be723341cbe055, 0x7fb4e3c45ab9016f, 0x904d55d293f4291a, 0x315d58d1bd078eeb, 0xb6583038f7808263, 0x6489aee01daaab45, 0x302cd7998bae8b4a, 0x62376506aecd61cd, 0xc9fc23fbc38a23f6, 0x21987d5f61b98eae, 0x4be48dd243e0aa7e, 0x36048df268dee247
+, 0x3f17c276acbd0e3d, 0x50385796831c448b, 0xcef7d66e7614d350, 0x3c7579aab381fe14, 0xfddd6d546c463cf5, 0x3e3fc6e071ecaa2e, 0x19d87d8ab51e8322, 0x128a22cced7734d7, 0xdf877853562b2f63, 0x334b20525bc02564, 0x171a9c6bb8aef4c2, 0x2a198167634f03d9
+, 0xcb7bfc384538df45, 0x02fa9293c2fd9ade, 0x6a62bd039359e043, 0x59c49ea1b41daaf4, 0x45e8df02ffe3189c, 0x02bad99fdd3d610c, 0x1e4451cebc404521, 0x7cbaa95c8dc12232, 0x9a977276876c3b2a, 0x4f6ce7de48e999e9, 0x54ebaf39cb426cdb, 0x1698a24cda20fe0b
+, 0x6e3406811a4401d4, 0x5224cb006857c53d, 0x58c5d9220f89779b, 0x5f5d632a3a471e81, 0x784db9604cc1e8d9, 0x3a33b2fceff8410e, 0x3e7bcac43394ed11, 0x4267e9b131e898fe, 0xdf8aeb9c24d92050, 0x4f2728fa86321e7e, 0x0986aff63b90aa25, 0x6135b09a0d71cd04
+, 0x24e946fb6e80e606, 0x3b61b3dd6d8ad71a, 0xfd2d74316224cbf5, 0x3eb9d31e07697f5c, 0x49c7eba6843bb7ed, 0x4ad1d8e8c2e52dc6, 0x2bde07f441b0f01a, 0x5073797b09e115d0, 0x08dc8b321c36021f, 0x557c4ab038a729ca, 0xc706b13152f43219, 0x04b983f0b5c24cd8
+, 0x799e341fe81673c1, 0x3bb4a3aff5bd9180, 0x3b0fe10bf05a9400, 0x34b1f837e49d3518, 0x5da363b0924005a9, 0x1a4115d514870bdc, 0xde825f30f06ac551, 0x58b150d88a493be3, 0x5181346626f56254, 0x501aa1e6626db964, 0xf72857fca1045de3, 0x5e653a57f130bd97
+, 0x98e92c3e4721d877, 0x3a1721ea9b6be079, 0x06bd88cc427c7b11, 0x2bf94b95577c62bf, 0x0f996429777c8a8b, 0x2aa5fa8d85e40f02, 0xf093af8fdc477945, 0x50a941dd4cac8f22, 0xc735bbdffe36263c, 0x58cc3bdec5dff30f, 0x9cbf11ae27b4f265, 0x156c9461e02e1aba
+, 0x657ed3b4ef9bbaa7, 0x39a6f8e9c45df0e9, 0xddc4be2480713a98, 0x0cef0e56069d6488, 0x22acc1c58ed77179, 0x41522e04aa4d6060, 0x7df162f1025acfa7, 0x5c9d971931b8d202, 0x3f7fea4e5a8b2825, 0x343cb5029e63d7e7, 0x518093596204d0cd, 0x2df046cdc194b03c
+, 0xe4e1ed83cb8b8beb, 0x475e8906173ea6ed, 0x19088e279892c2ef, 0x67610f79a93d529e, 0xde3cbc3ef435548a, 0x57d38918428c8369, 0x12bf6a28db975c80, 0x062cc1e9e7d3702a, 0x325555cffbb89538, 0x637de4afb44ac7e5, 0x1b4d5cf084caf8f7, 0x526f36f01100663f
+, 0x25ef9dd2c15b4a1a, 0x35e10b33e0e970e9, 0x54a9b0b81a9399bd, 0x197117ba911f6f5d, 0xfdfd556940598279, 0x01f7500a7925ef06, 0x0f4bf56af30ddd7f, 0x6094dd9d116d9059, 0xb28c9ea56d3a2240, 0x7ddb746dd1fa69be, 0x23eae3be240a72cf, 0x1bd4c078955d7b74
+, 0xaef2a7e5ba2be7b4, 0x7799b24b3cc18661, 0xb60d5217ed3b2359, 0x5a8d5e74c3c878ce, 0x07f04cfd0e79a49d, 0x2f1c3686ce10d131, 0x8991cb1438b311e3, 0x532bef7d54f81deb, 0xbeed8c7778e3298c, 0x2d2e9046582eaf79, 0xec3921c36555fd20, 0x6930795f233a3a94
+, 0x38dcbaccc2df9ac8, 0x0ba3c736c77c21c6, 0x59515743a41f6ea0, 0x4b0be0babbf5acb7, 0x9fd7491d1e5e5b2e, 0x5760f11774d068ef, 0xf6a93ccdee2e346e, 0x30f98850f75172bf, 0x30f5697c82bead9b, 0x5d3bf50d81058ee2, 0x21b9c66458b7201a, 0x57e193c85bee48f8
+, 0x84ecdfba7c751fb8, 0x2cf3dd5b1381f88a, 0xaf8791f251c46090, 0x268185cd352ac349, 0xc2db00bb74e6d261, 0x30c994ac4869a3c2, 0x8c84ad4ccc1903c3, 0x0906fddc4c349c3c, 0x5543ab3113522640, 0x5deea037d4173060, 0x6b74fa9e9b72b97a, 0x4f7a5a8865c4e185
+, 0xb5311d2f463e27d4, 0x7c9ee86e775af93b, 0xa6d2db685b275f18, 0x6e7a80afb5635c89, 0xcab7997abe5a72c9, 0x4f993a4adf90e160, 0xaf6d1c676628fc28, 0x2b5e169e737efc73, 0x43d3f2a67d512893, 0x74b4a8dbd0829683, 0x20e4a117de0a50e5, 0x2ac080649626dd9a
+, 0x3641276730d19925, 0x7526ef51044d2f4c, 0xe1c5c233e956f9c7, 0x7b3b04e6b8ab8838, 0xe728ce2c5ecf4030, 0x745eed60ed9d5ae7, 0x91a3dcdbfddd68f0, 0x2e5ab2db3251d379, 0xb3be60c3fca23c7e, 0x062885622bdb03bf, 0xf5aab8ba1703e4a9, 0x6ca9ccf4953e04dd
+, 0x8c4dde421683edec, 0x56a55a7d8260c1a3, 0x6f5764d91d0de7fd, 0x40e5e31c9e89fe61, 0xf92f4d9fba1e8cd7, 0x4da191ebc0961870, 0x11490df6e386e912, 0x68c1cd55d1af1e48, 0xb44739bcddfa768a, 0x479189b6adcd45c7, 0xb4df1751c8fa70bc, 0x451e8ca5f5c836d1
+, 0xc65ffadf2abb1efd, 0x15dcbca022333a67, 0xfcfff659b657c9fc, 0x4cb7f70d6f04af1f, 0x10d6f9de0423bf79, 0x4046ac2a3576e016, 0x2d03ee25d459a4dc, 0x1c80a3618fd08ccb, 0xeceecf287e386ba5, 0x0971e8bee8855061, 0xf73db20daf17d865, 0x661b1f5699c0a40b
+, 0x0608ec4a6556278c, 0x254d35d4f227a649, 0x59d2803dbcf0a8b7, 0x5fde41537d4e8709, 0xcb007b55671d8d70, 0x72fbe3b848f781c3, 0xe4d90cb181ccc611, 0x1e481e99e0c47884, 0xb9b0bbd01eb32c38, 0x011cbb2ebddba0ef, 0x033217092e4d826c, 0x547417de766813f1
+, 0x7095b5edc2bd07e7, 0x4addc0f41dde5aa8, 0x64fc4d260b95aa44, 0x0b3f0cd286baa73a, 0xa60875e1989f7749, 0x5d187dbd3a6e6645, 0x2104b0bdad149f41, 0x1931d0db7d0ef14e, 0x2607727df8922110, 0x605811e35bb9508d, 0x4a170a35cd192db1, 0x22955d5c1f701970
+, 0xca6f44a0ad1561a4, 0x482636619dbd9967, 0x24afa7357046d3a3, 0x664cf6cbe49d64f0, 0x605961f4313ac20f, 0x4cca62bcf9d5bce9, 0x008b57205883c290, 0x41706515f6a2b10c, 0xb47e22aafe8a0742, 0x103b42b03dd4a971, 0x8a4725aaa55a3a00, 0x6ba017d6cfe0d238
+, 0x4d37813441581522, 0x320a719d66bffb7c, 0x87818f22dff85f1a, 0x56f14012541d87be, 0x81dc29adea9811b4, 0x2e9d21af621614a5, 0x28de97ddd13a411b, 0x044fe365484c90c8, 0x02388fa1e4ac0ea4, 0x7875f0b4c5c89660, 0xff86fe3873147eaf, 0x2a99b02b4c8b80bf
+, 0x9ab831c72b1691de, 0x43665d50d25b74f0, 0xc4bb6f8a8713298a, 0x24effeb7ee115ea6, 0x1a175258d59c7220, 0x60802d398628957c, 0x43c23df1b162bad8, 0x559fe9d6e7999e91, 0x87bf988b6971910b, 0x10adfe9b2c46964d, 0xbd2bfb33e1ce09e8, 0x04a2a75f400f83cf
+, 0xcfe0a0dd4520a9c7, 0x0397cd684e166322, 0x072062d8b6cf2c9d, 0x66787b051d502cfa, 0x6774486b60301f4e, 0x4967fba9f9c78c65, 0xd3b4ea4ad5a1749d, 0x4d331e245595f479, 0x53b442124f223081, 0x0b3ad8e64c58c3d5, 0x0831f77998f3be1f, 0x25effcd33f446408
+, 0x38ff6c87be65f411, 0x2aaf08cf85c6f8a3, 0xb91ea62b09063f2c, 0x321cc1e269c96251, 0xb3d276ec59674556, 0x4cf5e33b23b38336, 0x222f541de5dd2186, 0x11ebe9aec785ddbd, 0xb51789f8920cf563, 0x57216b4e7bf081ae, 0x14fb5897bb1a9fdd, 0x599414b9c1546c86
+, 0xc4469b93de0c39cf, 0x72aef52a77988705, 0xe3e7860270ebd189, 0x6781877798e8fa84, 0x4e0c9a158eca3e1d, 0x422300ca807ba2da, 0x98ab346b7282a40f, 0x5c3978585d3a2eeb, 0x0bf21c3157887100, 0x17b512c37cd05ca5, 0x3a9efecac0506620, 0x0cd55e3a25f0a96e
+, 0x98d80d238a33bddc, 0x3784dac61576313b, 0x239cb1959c810c6e, 0x2940c306cfe4b0cd, 0x3fd8f85dc0ac781d, 0x55238f4f72780dd6, 0x586dafb30ce65e5b, 0x079140729be0fe5a, 0xbfcb3963e261f3ef, 0x3c282575a1880d92, 0xf88d6b07ca2eb85a, 0x710f536cf48a7624
+, 0x5daa9da5a7b83c64, 0x2c5f76baff2e4fcf, 0xb3479b0e10610c15, 0x775f9bdd30ed36f3, 0x8f8a8161dd6eecf3, 0x2512d572fb0ba97f, 0xbc61c2f818199f9e, 0x31ab2431b5ff27e1, 0x18d820f685aaa8dc, 0x0949a562d473d661, 0xa65a29e48f3bdd54, 0x1345a524887c88f5
+, 0x683fa036f69decbb, 0x7f314df234697378, 0x207144879b76bb1c, 0x523f118570dc2470, 0x48c54948f7e52060, 0x6f5621381c4bc37f, 0x3bd772499d18f6e6, 0x2d792e01d2172974, 0xab095a8b276b4981, 0x1c523d3084bdc687, 0x6e88da2c4ea5d8f0, 0x33d3002394f0e677
+, 0xf31ad91f49ece341, 0x3c0291f57c647531, 0x272cd2bc1e39e252, 0x6846822a48651302, 0x98652f498430f351, 0x61bdeca1ce760148, 0xc46acaa8d8b59670, 0x649fda1e14588e7d, 0xe59392d7aec50da6, 0x58cf3f0de2ad0594, 0xc8156fbbf073d714, 0x6b90adc06b54b1e8
+, 0x99ab4e82d3099811, 0x52342592cbcbb6bb, 0x1d487b6ed3867b49, 0x4d1db6c99f41beb9, 0x1702478a6280d38f, 0x0c1ba8346f4cac9c, 0x31b05608b0578c8d, 0x7a9193c803b5297f, 0xf0a3e56a8ce50853, 0x212eced55d5de116, 0xa2a95f224270eb8b, 0x26ee7f3f820f190f
+, 0xdfda899c85512867, 0x37b47264685821bc, 0x743b57f2b1a6c718, 0x1cb1e6f60e2336e1, 0xacab8cec4a656b65, 0x24783bba3e933255, 0x71004ae7e25ff15b, 0x08aedc2e6a9b69d4, 0xcf7291292589b36e, 0x42e5db5a7834b88f, 0x2f5ae180f3e8e793, 0x359e7806b1ea6639
+, 0x721cdec99115d8dc, 0x4a935ddcf3db2253, 0xb7173b890dc2ca22, 0x4bbf7007c4b54180, 0x41b4c81649af3121, 0x036f5c9d870376ed, 0x15cec9a0d47b1b0d, 0x01b030d980f30a45, 0xbe2ea30f22b5d6ae, 0x183d648c3b5eb25d, 0x3caba751e59337bc, 0x76990342890ccc13
+, 0x4a543e41a8524adc, 0x7d9681efa9a08b58, 0xfc20645eabcf204f, 0x2636d5c4cca32a2e, 0x9b64e4d67278beb8, 0x15122f473f7b4505, 0x5d5a41dc928b45b6, 0x02a4c9e1112abefb, 0x3344f9b98cc98405, 0x177e726ccebc1c7a, 0xd947468b8169c430, 0x0d9a51fc6e1a6086
+, 0xced4b6ca1fa5f347, 0x7fc1b7faa410069e, 0x85f9e90705eead1b, 0x160c3ae4d7b577ff, 0xaf90b0704f3a27f3, 0x60e525f3d3c03e1c, 0x77634edb349bb296, 0x0b9fa4985d42d232, 0x00eddb8e8143fa2d, 0x222e3f219bfc1696, 0xb4111bab7653efcb, 0x4a5118ea27d4639d
+, 0x849f12bf57b20dcf, 0x04b77d108a814d03, 0xad3cbf5b99cb10e1, 0x186fc08609f4c04c, 0x54cc47d22e9dbd94, 0x2707da8833c9ca9f, 0x3979b4dcbb524091, 0x339ac474824d3001, 0x1c56a8b3ed85b7f2, 0x3bee5b32c8678d0f, 0x9ac3179cb8a3e904, 0x584d55d81a68e51e
+, 0x19c8dbcde1a33753, 0x01afbbbe03adbc59, 0xec3eac458491cea1, 0x57584f58f1bb3649, 0x8ce2bfe99b2ff9f9, 0x4a6101975dac3c9e, 0x264624b198a02c6b, 0x376a052ef879a3b6, 0x31491fef100fd158, 0x2b6b7b6c3e8f1ac4, 0x71b2a321e81c0a0e, 0x0e4d45d2876dbd58
+, 0x095716e2197ada73, 0x18efdb3093750d58, 0xcda9037c21a4c4e7, 0x778694ff8352db1f, 0xcbe16ec690569f2d, 0x59e458cd393eef91, 0x05505a9bb62c9103, 0x190e88198f0aef3f, 0x56a0a90c01b6d539, 0x4d7c4bb7ab4fa221, 0x097475a78cae6b20, 0x28e35721bbd7bbd6
+, 0x392ccb3db490c141, 0x44df2464c90c6f36, 0x82c24c3ed283eeac, 0x2a88330afe8505f7, 0xf304762be127d372, 0x728bfa655be5c04a, 0x664b20b7096aab19, 0x41f137e86c314e5f, 0xe3ed4c2466422a5a, 0x13d3ffb3ef79b0ff, 0xadad23551c109a78, 0x0e3059c97c805beb
+, 0xb1941656b97f6c4b, 0x6b858ce457664463, 0x3543064979ac0297, 0x720d8e9a1f5f51dd, 0x6782f4ee7ee13197, 0x32054f367231060b, 0x1ad0e7aceb770bc0, 0x0a50b4092aff4059, 0x9806778c1d6b84ce, 0x7f6d47fce322faf4, 0x5fb710db0e4292d2, 0x240218ce4c9424bf
+, 0x71ae53310f698227, 0x2903753f56db0741, 0x3655e530eff2a46d, 0x2bcd967f095d6740, 0x9bc2d792a0a2f7f3, 0x5afc32f8ca69a332, 0x4c578a308a440b36, 0x18f9d9f3e54f7657, 0x3669bc369250c341, 0x0f40024c3cec3cfe, 0x2c63b62138121b12, 0x24506ea4d0b4de81
+, 0xca468ccee389105b, 0x3874df0c7a69cf50, 0x675ef7ef68d54177, 0x27423ff878504e9c, 0x88a41d06e81b2239, 0x2d1bd6a10eb63f2c, 0x0e44c0f183b7bd43, 0x034272f4a6b6eb56, 0xeb5b083c4e056245, 0x315050c09cb4afd9, 0xe4f3e477e8a71175, 0x7501f0a9d30162bc
+, 0x4667c9517270773a, 0x2a1f78172e6fc031, 0x84de2b10094d7771, 0x273c6a7051df9be0, 0xcce63c796b51c01d, 0x6aec8c5121833bfd, 0x322cfd4e7ebbfbc1, 0x7f142e86b7ac0dd1, 0xf48024fceca2b435, 0x51d6de778a3a2133, 0xb1cad261369b55be, 0x51ade58b8808e1d9
+, 0x3e2c51a668db3dfb, 0x15acfa85296f0cdd, 0x7ff06f860f32cdec, 0x120c3c09366ab6a2, 0xd862eca783641233, 0x704d5f561c09ea05, 0x6a25bc68adca2026, 0x2cf72632849d1992, 0xa5ea8e50a0505be5, 0x521ef475a72769ec, 0x05c72e2080793b10, 0x008b8fd49dc752b6
+, 0x68344c2e1389b7f8, 0x4f6338097609bf0b, 0x2f02d08c4a5a9e8e, 0x7ac98d215da07a7a, 0x6b76edbb270de8f4, 0x0c9dda466d01c708, 0xadb8892fe2a339ba, 0x64ff5ec25cc4b0be, 0x667a83e83aac8bff, 0x67407038618a1644, 0x4f09497cb8a04dd1, 0x41e6e14577bd3684
+, 0xfea04e8d7f109573, 0x1b62368308cbeaf1, 0xaaa1905998dca009, 0x74755e8bac425723, 0xb92336885093d864, 0x0c6bcfb50ca8fce1, 0x6061816b4186c806, 0x2b2918143c1d4817, 0xc2dbac570f721852, 0x264dcb2a0f838c55, 0x3b13a9cb98db98a3, 0x7ebcbc604006a432
+, 0x0d656cb8e7280e12, 0x6911b0e3b4d1621b, 0x809c2423b3e19fed, 0x2cedee6f2171c93b, 0x8405a9c6473ecaa1, 0x160cbcb6eb381e18, 0xb4488ef417c2e671, 0x2954a77829a7a007, 0x5d0cbd327aabda82, 0x0d3858f88eca7dc9, 0x9321a0fa924636df, 0x2ec538f87fe29782
+, 0x89b3f17dd690cc6c, 0x355215a2c91f0b07, 0x5e55da6f6023ac9e, 0x5092ecbba852fc2b, 0x6b53e0cba4e31676, 0x56011e4f634470a6, 0x4d7d750c26ccccd7, 0x28aac70e3a0a9eb5, 0x082639797d48c09f, 0x17947ff721b87546, 0x6909a0a077f1424f, 0x53d8e8664ccf61d3
+, 0xff8c0461ac0775cd, 0x34cd5a63c9958225, 0x947263ab39b88c28, 0x6cdc0f2d7ef6843f, 0x151f929647996d00, 0x2b004d4f6855bf5b, 0x26a091bad51fc675, 0x3f761c727c515517, 0x8e71013d17a74f11, 0x115961f7d0e6e76b, 0xef2e351c0e8e4b89, 0x3ac2e49cbeb453b0
+, 0xb256d8e78702f03a, 0x57748613739c76c8, 0x133562ea3eb8f3aa, 0x00aa3637702e6dfd, 0x2fa8c6d9379ac18e, 0x7016b45f8bf7f3b6, 0xf66c111c85f7bdc1, 0x272ab154fed4e21d, 0xe31fb62cd4c2e877, 0x4fe63763a792ac93, 0x1b40d4c624e46c6e, 0x3fdad76374ce06c9
+, 0x8f94b199c687f441, 0x117ec9ad95290bbc, 0x2b3db0cc28750a00, 0x63e7d4a191ddd9ae, 0x031b547ed7da0710, 0x69d0752d1d15f320, 0x1bbd76ab1c5495c4, 0x5ecded69d9d158f0, 0x6b10a82a7a13407e, 0x05adc131ba7f927e, 0x65f9d0c1c26d159c, 0x7dbab0fd9be3475f
+, 0x01291861d20c0856, 0x15972d1a8f51c899, 0x58a0e48a28194c6b, 0x008e528a4d79252b, 0x5ac32c04b784affa, 0x289942623f11d738, 0xedb37ce1d36f41e3, 0x173ca1ee5d97379e, 0xabf9c59002690ecf, 0x250f3df2c95e147c, 0xbf0f140602283da3, 0x059d3642e4eb7a74
+, 0x6850d77a0d86e019, 0x11db693a2ada2ec5, 0x1db65479488c056f, 0x770e916d3973b525, 0x54319b31260a95bb, 0x1c825dc9914be611, 0xff37cee1abdce827, 0x7f91d23020de8824, 0xcdf423b35e3673c8, 0x5cdc0cec83bf4b56, 0x537140273c21bcef, 0x35e4dd67a1a2d510
+, 0x902317b13e8ef5aa, 0x13dd4df4b237ecb1, 0x1d511bde284ca5b5, 0x06d2bd272da8d569, 0x5500b2f30b0bb3f5, 0x2acc2b4cde3832dd, 0x546b9f5f1b773e2b, 0x4e1136887094a4ee, 0x1dcb4d6c81723559, 0x4ef9b026955d3021, 0x3d1af84e71efe714, 0x2f0284a34e248650
+, 0x0adf26c707ab2b0f, 0x41443c1bcce338fc, 0x6c0cf56da0a9c498, 0x10a365de0afbfcaa, 0xaddfd82947ce5130, 0x2fca4c7d68c7d6bf, 0xb5960df7ccbf9093, 0x0f26d2468dc3301f, 0x3133690973265e40, 0x0b6317e1b3e039b0, 0xd49dd88ee2cb1f11, 0x1606cc3e783be9a5
+, 0x3f9600251761a7d1, 0x43e3f4912a221a84, 0x8ce5d4cc977cbe61, 0x400e29b3e5f42099, 0xe6b555c6c9928b91, 0x08dd0cf8caf7777d, 0xb12e05aa6b4e03d8, 0x0b1be5490ebb3fff, 0x57921e9e127ad9b8, 0x64dd5e7238f0dd8d, 0xe2030a617831b8b2, 0x0cbd603158fc6ef9
+, 0x4dc825010c050562, 0x1cdb8ae6a9164013, 0x9689573c1c195268, 0x04f5fc248d852d9a, 0xe36a0f245ac8dd31, 0x71f65cc3b82c3a11, 0x2e3b14763537cd32, 0x569635f6cd2390ed, 0xc3a1909e135fa590, 0x3526c21033bcefbf, 0x8b4fc3123f76948d, 0x2c09737d7e9f7fe8
+, 0xdb779257c8bed3ce, 0x5c7c5611dc5f4062, 0x8c96a1f2538ee356, 0x07296d7132dbd5fc, 0xde813e496f86d91f, 0x551023d3ef3b3e13, 0x65c07250010873c1, 0x12a3103f42fa3b7e, 0x2a4522c10234b6ae, 0x01ed434c6affbd0c, 0x9d52c813624da1fb, 0x06bf4b402d4663a1
+, 0x23e6070508b5df25, 0x4217504adbce062b, 0xa2e882405519f972, 0x42600c4062444ea1, 0xbd5788bf6fb4ef5e, 0x06835b0cefa86a8f, 0x9982fc4637496a06, 0x2c0cec23278eae19, 0x797ecdf6cceb18fe, 0x7b7fa86f46e99bbf, 0x4b84d893771cf3c8, 0x69ee4314f1729ce7
+, 0x6b2ac8750b5218c0, 0x25f294478a315ef0, 0xe6f812a27851ed17, 0x7107cb4b21b33751, 0x71125c177d56b489, 0x4b8e26081ac7739e, 0xb720df054c08de70, 0x33e08a301cc7d063, 0x530facb2c7d92a5d, 0x250d7c13d9f0e62d, 0xdc219479399314f6, 0x5c2a6c76f73ad940
+, 0x6f83e84667c74c4d, 0x14aa54e8d88df34f, 0xa06fb44cfa98c076, 0x092605cc462b475f, 0x375f827b3a5a7b61, 0x119a25bd6627be64, 0x4ee3a2a7376f4f4c, 0x45135163d95e7ee8, 0xad5bef0003024f35, 0x459f6faf8b99443b, 0x45a0a068c2b58ad4, 0x7c899030db7f7e43
+, 0x0e3e1ab0eefcb9eb, 0x6965f1bcdb44ce6e, 0x5b8d76a4a8a0a4a9, 0x49aba7b5439824fc, 0xd0a2cca9d5771d84, 0x6f74d284a947ff29, 0x5cc8c41155d13308, 0x5e36ffc95089776f, 0xa6ed9a5507e105c3, 0x5bc15dc275678433, 0xde574c99ca795adf, 0x3e2d0ee75635342c
+, 0x0078c891ec4104d3, 0x562bf3d9ba1ddd3a, 0x1de4d97827810820, 0x6d5ecacd851d20f0, 0x314145cf9658490a, 0x5497824b92ff3c1e, 0xde3d3b71487ed274, 0x51ffd2dc507caecd, 0xe87a4ba49f2e38ba, 0x5785d9093efad606, 0xd1a92afc491ccd2b, 0x3f1ce03874369c35
+, 0x660806a594b3fd0a, 0x19e49c02cfbbacfd, 0x0a066a423f546089, 0x1ec2770593d3f3d4, 0x754d570f9b6cc003, 0x428fc2bf82021ee3, 0x704759aa1927ebd3, 0x56c685542ef5d37a, 0x1bed654dca3a2c61, 0x2d34395b3cde7daf, 0x4815980aa029c8c7, 0x3ef785ce8d0690d9
+, 0x516450d65bc60b6e, 0x10ca0e4e250bc607, 0x5e473ddfa011fbbc, 0x462d23185330af10, 0x86f08cf80c082eea, 0x1886636bef5ec4d9, 0x2e33e6cd20b66861, 0x7c2567c14f6fa760, 0x45b9f61e9137bdc4, 0x2c81fb201974270e, 0x6455a16cfc2d0379, 0x7318c23d8a6d5999
+, 0x4d72c5dc06a704d6, 0x1a8f83419f9658b2, 0xd96730e9422e0fee, 0x65c3c1ce7f1b4780, 0x3990eb6afed0fa57, 0x15e384328d14a9ec, 0x8e1ec11360e88239, 0x4331295728132089, 0x8134d616e824f441, 0x5f95352a1296e9b3, 0x70e2e7ba5a5ec1be, 0x59629de7be3e856d
+, 0x9ee62d56893c4a78, 0x171bc669a8f9677e, 0x749d97cd88ab43ff, 0x76b5661a89574e61, 0xc024616ce63d7dcf, 0x79e9eef7bb357e69, 0xa8304208bf50ebf0, 0x1ba0fe8bb6384d62, 0xc6f1d13e59d6e6f9, 0x4e2570da7f767944, 0x1ea595016a647cc1, 0x754381c1ca95f3c4
+, 0x14c44e4fe2988b41, 0x3cac1a657c899a03, 0x4586c19ae5f51cb2, 0x0822f76a9537945f, 0xe1cd5d29555730fa, 0x4b31c78f3d36bb2d, 0x10ac44ebfc8c9005, 0x5d18ad5e37cf8dfd, 0x1147a9c3198dcf31, 0x3a7322a3f04d5b3d, 0xf6e2c11ba5c42c9b, 0x4eeb3273e42de50d
+, 0x7b624d203718b7d2, 0x68b653ca059e0eef, 0xd891a8b962c74022, 0x117635841f973f2a, 0x74fbb7a3068ee12c, 0x07830bd5b9aeaadd, 0x7849b489efdd2e43, 0x612ffc51d5c8be80, 0xe560450dea68af7d, 0x1b0a8566acc03ba6, 0x02e976065c01e64b, 0x229d39e95f292f5c
+, 0xcef2121b4bd0ca00, 0x6e4dac7fe08cebea, 0xa5327a5b3da20cc2, 0x1560ef7e3b778fd4, 0x0c1f723254fc2bac, 0x5f040bd47ba87bf8, 0xa1e72b00e45b7684, 0x5ffec8d172cea504, 0xf972697c7d195f94, 0x04475f0efdf07077, 0x1dd05e386eb6a12c, 0x2f47991453446b75
+, 0x2c26a9eb85ee7de7, 0x0ee02f6d258a8d37, 0x34038c0dc4eca700, 0x5159bbdf41d8faa8, 0x91851b9e46f4b2f2, 0x207d04e6d93bd277, 0xc634a337e31267a5, 0x2239710066f9db43, 0x8f2cd94e788f0382, 0x0ac3a7a73162ec69, 0x61f6c417a9302a8e, 0x2d3cbecabf976d80
+, 0xd122f087c9a49650, 0x4e51c57b0dde15e2, 0xa94b6bc672a2bed0, 0x096d82f8cfafbdc2, 0xd7d144f240bc6b16, 0x537087a02196caeb, 0xffde0d6f6506ff5a, 0x57073ad4846fc319, 0x2c86bc846c37f4e6, 0x1a385a6802098107, 0x7c509571ecfbb9f0, 0x4970711630080324
+, 0xa18a9a6cf70412d9, 0x5b971d7cb08f6404, 0xece1d697e296c4b4, 0x5d5269fb3bba7ba5, 0x46ee8d55a802b030, 0x0fdd07f34afa1aad, 0x41f9b2f225577507, 0x2c2e07ed6fd11686, 0xa6d86e0e34663b3d, 0x221bb6bcd5af0204, 0x49954194426abd73, 0x5cdcfc8cc1214017
+, 0x67ccbd8c7a33c5b5, 0x709d435833e3d2e1, 0x3b9ff20157a20dac, 0x2c698fee5876191d, 0x6562da93924648a3, 0x4de0c2b08e466ee0, 0x9f388fd9a337f8f8, 0x16f6f8b10a4316bc, 0xb61cbc50785f6ea0, 0x22b7db17f644c0b2, 0x2891e5ff2ea3619f, 0x21b2d841bd3a725d
+, 0x8bc26b9560537ec4, 0x182cf68639dd1417, 0x425cd848f73ff2fe, 0x5b56ff734331c9fe, 0xa3fd0d094d4b381d, 0x3bc269a3ab886976, 0x2e3be94db7c6a05a, 0x256744ce0a9f47e3, 0xb6225cb4aefa7ebd, 0x0cdaaa555dace0cf, 0x2a0d659f8ecf6499, 0x7533048eba655aa1
+, 0x59ce5e4af0d02d98, 0x6cb6015f2a345169, 0x3620f03748ebee88, 0x69c7b470bda8b706, 0xbef2cd32168bb346, 0x13beb7c524c7d1aa, 0xdd9209fe4142444b, 0x1ebf14826011b908, 0x803e7b3e4329eb71, 0x246833019f36e177, 0xfbc71f279d2e85ba, 0x6636b2c24e9ce72a
+, 0xb960c233e75e1617, 0x273bba7f45201e0a, 0x3c1e97699bb1af12, 0x1d5e13bdc1f5b4d4, 0xcbae3e4bc4a6a309, 0x6815e6ac4cdbd907, 0xbe1236d2abea1559, 0x2cbdeb07c1297143, 0x97d360ac2825231a, 0x65d15602eb9ffbf8, 0x1556d6a5e3d56342, 0x102221509b870004
+, 0xdf659337680397f8, 0x3459d0828e439640, 0xae31b46cc3a521c8, 0x51740984476e126c, 0x295e9b3685de5e87, 0x2d852bc9b63129e1, 0x8358ac7353516c7a, 0x78475da5d46b0b8f, 0xa3f96fbd1d3773d7, 0x3ccb1d2975af552a, 0x633ad360a8802dfd, 0x77a1da382306ba1b
+, 0x797c99b2536dd157, 0x258d1f813fa0065d, 0x312a1c90691a9c3c, 0x364d4cbf11ce013f, 0xc24e4a2a24813c8e, 0x4c0e7bc8dcf91666, 0x7ec1794d00b39d56, 0x1228e2d8cbcf3bef, 0xc23038a926f539f4, 0x4f0eb6c1e5551d1b, 0x90fc0db200bd12f5, 0x410e407fd04f5810
+, 0x616a58a92e5d8dc4, 0x40a75a0ec4f4b9d2, 0xdd118153d1fa3eac, 0x44c2d53b6af23d2c, 0xe1c83166d4ec7b2f, 0x4b1aaa2920517b93, 0x1b442a6c77af438e, 0x3ec11e978603cf4b, 0x1c55ee1305b19015, 0x29f13a0cf362ca6f, 0x45ddd3cfb8f1ebac, 0x0e9ee7748e58f8d1
+, 0xab070805b5813780, 0x47653079fdc8c9f4, 0xc9036c01f85ced00, 0x5a07451e8497d955, 0xee2bffeae933d940, 0x32a6a43c20e5dca6, 0xf84d0c062043d854, 0x609d8d312d3a63ae, 0xaa0a7a2374d99b5a, 0x118cf236159e66c3, 0xaf76be0bbf47e01f, 0x1b181439018ba514
+, 0xd663aed4cf26598d, 0x38fdb1f3783ccbdc, 0xd6cddd74b9934866, 0x2829eeb93d2e9a1b, 0x29e4a8328466d99e, 0x1ea7eddc2af4f438, 0xb4f4f1ecfde4f2c9, 0x5cda9e5207dddaf9, 0xd02c470798edbb8b, 0x4def95c1a3ff8d96, 0xc9405aca1a097085, 0x43b107144fa7e484
+, 0xfea2c63d2c545602, 0x1d330d1906ec8701, 0xf64e114009d146d1, 0x763b94925b8ba4ce, 0xc57c3779bc50ae9e, 0x6b4c199d87d114dd, 0xffa564107bde03e4, 0x37fec16d87e66825, 0x57eea54abab0863e, 0x090cee474685123f, 0x3f8b9145ff36a0cd, 0x65763761d0f67de4
+, 0xc26d30e08c68eaa9, 0x0a72d421467995b8, 0x757ad87f16459660, 0x6d0d41490f58d7e5, 0x50fc7d92d42c42ed, 0x71890295f3b27b53, 0x8fb23586d8e2a038, 0x5365ef319d7f4664, 0x84bca323307b280e, 0x5358b1254e7242e1, 0x5c3533f8795477a0, 0x7c5b243436f30876
+, 0x9b465a38ca046d01, 0x3b6eda7011d78c5e, 0x476062d8b988db7a, 0x186de955dcf1fd83, 0x1f35a5e0464317ad, 0x1238b75e97acedf0, 0x55a1ad8bd5f60f6c, 0x71f5a0f40934b4c7, 0xe9e7570786b12203, 0x0f715687567d1240, 0xb2ab5cfa62441699, 0x7cecac6922e6057c
+, 0xa3cefdb86a148a5d, 0x7a2d1bee5a66300a, 0x9489149ff145fd1c, 0x12ac7a754e5fa447, 0x41cb16c983fdee94, 0x0a190bca2bb12281, 0xc912d4c43a2af340, 0x2048f2c9c09c15fa, 0x6a4ddd656b78188b, 0x3b60f2ad1970aab3, 0x29888f437513d5f2, 0x2f85ece205ef15a7
+, 0x0f0df5d45e23c9c7, 0x5000c71eb4bc5757, 0x7b231da3d2a63574, 0x450056c4952c4381, 0xafa6f8a7ab94b594, 0x626a74565db5fe7c, 0xd1c59a06a54864a9, 0x77c39304f5c23e18, 0xb0d2b6abba4a600d, 0x722a7bc43702fd3c, 0x2fbae094056792fe, 0x3b92e78ae19b108e
+, 0x367be940c3d5bf4d, 0x67379c2d47e0e8ba, 0xa28b18c9a8e617ea, 0x20e5bc6074754b7b, 0x59ef7c6c5c4f22f3, 0x3bf723fd8d9c085a, 0x43cce84b7ebb5c21, 0x044a778d664cb2b9, 0x7d49c8357e316596, 0x6d004fc0f4dba750, 0xb84cad5e98309b5e, 0x24ff294ed0c9679c
+, 0x7ccbf03fbbb64a40, 0x1a0568582e188873, 0xce2b6064933fc018, 0x0565c665e45010d0, 0x6eb19ed6d9eca3a8, 0x5b079436b5c6711f, 0xa9d1f207b9b6e0ff, 0x6e4fcc96c48c1c98, 0xcc45bc93108c046c, 0x75a4caede0a4aa84, 0x49e5650484ae80c3, 0x60cbb72611252ab3
+, 0x38d5b7e3afb7c8ea, 0x2f86e89933a3b004, 0x1df5a7d50dd8d9a3, 0x12af45a0c0785ebe, 0xf29416cce5bc83b6, 0x2fa6b9bb2b414802, 0x6a2aa2112c7ac215, 0x1499ed111f89239a, 0x74d06ed47277a767, 0x3b2c7125029b750d, 0x7d4f5a4b0388b8bd, 0x004b1963ce4e26e3
+, 0x5deb0fa7ff2b93f1, 0x03e2d26d7f32cf57, 0xcb15bae1387111ab, 0x77c8ff427dee1505, 0x2549eb3019be533c, 0x3a84e4193873baca, 0xff68b728f6b41e66, 0x48f0c13c1f26b297, 0x4115d838590cd3ba, 0x25d7cdb2e6284ea3, 0x8eb69a4c41e081c0, 0x507b1cf239e440d2
+, 0xa59a9992e181351e, 0x6116c59ba1ebe8ee, 0xa408448e2a3419e8, 0x54578f2103301a21, 0x0b4ede4caf504720, 0x38cc585099cde5d1, 0xba2e60b3d0f82ae2, 0x1aa650fa6a89849f, 0x984e05d907ce62f5, 0x3b285460ff97b607, 0x70804375265296f6, 0x25ae7b99d42bba88
+, 0xe34bff4c536a8dce, 0x22bb716986085e6e, 0xb79f5b902887a6f5, 0x374f91396093358d, 0xd8a294fb7264bd22, 0x3341b9726d980b13, 0xc48194905c4f7837, 0x3f7700f1d1680da0, 0x951c649fb8789403, 0x66489611eccecabf, 0xe901513a95bd558f, 0x7a32fc89c63a29f1
+, 0xd5ed9d1e055cfca1, 0x48d9ca98b05340fb, 0x742f2e344604cb57, 0x428667df27e10f4b, 0xba4351b7f190a404, 0x046c320b8939a721, 0x9b32f8106bb7a1cb, 0x575f3f3ab77e9f73, 0x670d03f92e6e5110, 0x0164bee1e63dfb70, 0x52f430539fbb6801, 0x2e3c89e2419101cf
+, 0x3438d92740ac5059, 0x6c56bdeb622db908, 0xb41189fc80815c30, 0x33980799d4e0c1a2, 0x26a8b759122eea76, 0x02fb4588f9d7c378, 0xd8de154d9cdb67e0, 0x548befd6f51278ad, 0xa7a60fc6e68d9fc5, 0x1b6593805db82718, 0x8f777c3ee1c99caf, 0x721dfdbd18adcad5
+, 0xe9062f8b44aec050, 0x64bf69f90b6aef23, 0xb4e5e9d9948d57ed, 0x4884f5ce671eb1b0, 0xbfb0bf1ce3a053ff, 0x3409f269326aa6ae, 0x2ba17a296d435419, 0x5e5e2898cf5f9190, 0x5d90d4c5952ec204, 0x03fc315b24e7ffa2, 0xb187e5abd02ecdc0, 0x4e5affb85fccb2e0
+, 0x0f52bfef38c4b6ee, 0x10867ff3ff01d318, 0x554ba62470ca06c3, 0x1d52b7f56c82eda9, 0xa66a293d4786f602, 0x28d7c452407eb5ef, 0x4186d756557f1867, 0x542fe2faa6f45920, 0x8e96c4a4ed072a1e, 0x0069863d9f39a6b8, 0xf361a94ee0658bba, 0x6593d4561d7591e5
+, 0x831bae6609e5c246, 0x2239bcee80f57f52, 0x47b5e8532309ab20, 0x0ad5717820e7826b, 0xbac478293382cceb, 0x4c40a959960ef08a, 0xf2e4a5ae18a28626, 0x246c1a57ea0cda9d, 0xbb09699a6e503580, 0x36a8fb37faf49a79, 0x3b399f9820d7ab20, 0x52c721ad1b344a27
+, 0xf190972aa0e1fe24, 0x6b49efe4f50243f9, 0x111f940a38d57ae3, 0x6e026c2d893d89a8, 0xaf0bc6d3f003a3b0, 0x06f6812dba6d5155, 0x6f4c9b466cebbc20, 0x70479ac4a2586f3a, 0x90d3efc3b53423e5, 0x61f1cfc4d0df09f2, 0x0ab719e8c2a04f9b, 0x14f739960faf2029
+, 0xedfa7f8090fe3ad4, 0x5f5f7188a7ff47c2, 0x03e20e936176e4d1, 0x468536f0c5ad15c0, 0x06ac754e97d8c19f, 0x70a08f6c0c6357ef, 0x641817d4470c498f, 0x76c039e97f8f1b3f, 0x4826e7f5004341b1, 0x5efddd51191d7a71, 0x4fe4df619a3bf1f9, 0x4edd8ffafb2d6987
+, 0x768e4a9d9b3b2c4e, 0x1e16becef5f4eb56, 0x737198cafe2a27a1, 0x732531bdfdfa5952, 0x6803e356939963c6, 0x0ca0392c327a1d64, 0xe72611e5d71c4fc0, 0x2bc6d93b87824546, 0xe63d1fe149cc4797, 0x481c3fd33c099d4f, 0xa3517c58e2e45d0a, 0x707e304ec691f206
+, 0x72f093faf09d1bfd, 0x59701fe815e574d4, 0xf598f69a9e00fa0f, 0x0bfb738ee7e132e3, 0x722a7bc2025c66f0, 0x3e0fae6333b6c43a, 0xb8f0743e8b48f2a6, 0x3fe809e69378a4d7, 0xf74a5925b11658b4, 0x0e6eeaa25c384aa3, 0xbe8235610e33fa26, 0x2036e6619b2ceda1
+, 0xb339866309e9e3d1, 0x69025b3e0953b540, 0x5043ff57807c39b1, 0x733b0c111853ed5c, 0x8540c558efeb0948, 0x60a9e23203cbe0bc, 0x43efe7d41c6d47fd, 0x0615d3d708acff2e, 0xe8f5764b8ce79a9d, 0x5e2cf5f4398e3a9e, 0xd575bd94e8300892, 0x7025abfb8b6c847e
+, 0x332a1394175a9858, 0x1b9a82175d951b41, 0x6452acb18f97318d, 0x51bb8d0fffe93903, 0xc0f982a4bdc08960, 0x15ab9ac2e9de34f0, 0x079643d3897b8c98, 0x3fd7530a59ce2cd4, 0x67c33b29d4a61487, 0x2558f3a3d5043032, 0x5052216564a6628a, 0x62d79470f7fddc42
+, 0x95de3f5454fce0bd, 0x521d3d6b25e6362c, 0xfed3ecedf0f70772, 0x60913fdd15521495, 0x39f68bf67158463d, 0x30ac0f5655aa5478, 0xe16ecb8d179f2dd1, 0x4e42ea43645aa9f2, 0x3df54dfeb9135ca6, 0x176b47cf47e75971, 0x01e206013ee204e5, 0x516016c6461d4a76
+, 0xf38bcafb46205987, 0x4b34fd32a691e34f, 0x66902a2fbaff80c0, 0x7894ffd128ae55be, 0x7649bbe98e7e0721, 0x2e2261a409bc30a3, 0xfa4262dd888cee87, 0x1e82e9117c7e58e8, 0x91bebdcc386066f6, 0x05cf9634e6dbc32a, 0xa6aed31de2cfd019, 0x7629fae6a3b79b3b
+, 0x7f7ae491a3183493, 0x0d238bbf35ca9e78, 0x20f14dd80f6381c2, 0x5826116fb52d8d13, 0xba9f7b873bd9d7f7, 0x70613ac750ad489e, 0x0492cfc8e4af9864, 0x35e18315e68523cd, 0x4299a69e4ae45867, 0x3c7f70b80887048c, 0xbb7fa97d47de86cc, 0x3762f3a71e9eb160
+, 0x4b03d342497ba7aa, 0x2f09f038ba24055f, 0x253d1ed9afcb4b32, 0x19f7eca19405d862, 0xd0599304645e6113, 0x4506058d3fe60caf, 0x7b6fabaca38fdcb3, 0x4e4b11b18abd7486, 0x1ef5d4b14d21e2d9, 0x1b0e8de00f4b24b4, 0xc6da562f8a818551, 0x3e5d948c00f845ce
+, 0x975afa4a3722609f, 0x29db730e32a7f7d6, 0x07f8fcf610ea8f21, 0x7c44f329549edb32, 0x736dd031d09aec2d, 0x05dbe7a9264c6af6, 0xba53f5946e89451a, 0x434e96334a4a5db5, 0x2a52e10d58ca5574, 0x39debc2455d5057b, 0xdbe246359846570b, 0x03204b5e10e23837
+, 0x24ed09ee599b7bdd, 0x318139c1aeec8606, 0x1e666820409be26f, 0x22d997cac29f21d3, 0xf2e1b3e962ec2a6d, 0x365734f2611f4d9d, 0x260ce71a18ffc04d, 0x6795d1e894b46ba8, 0x252a455b94817245, 0x0b07ddaa3dfbb2f7, 0xc6e7c429620b0141, 0x15444df6ba1d8685
+, 0xecbb74280c009b06, 0x3c87441db64aa2a5, 0x65ed6d9fcd091558, 0x65e0ac7cefca0a11, 0xa8a8e60b8204d8db, 0x7e884ebae2eecf49, 0xdb479ba5003a97d4, 0x5e7c6c53dba091dd, 0x2acfdccbf12188de, 0x166f6bc08f14cebc, 0x98dce69965e54eed, 0x63894a9825e6004a
+, 0x578990646dd3e13c, 0x6caa6f776457d2fa, 0xd6ab617bf32076d8, 0x182ab1dfa3cc06d6, 0x72354e5a50fce15f, 0x3198a632d4aad9ac, 0x4740c0955a04b919, 0x62ab7ba5f7469fde, 0x4260fe12beafcc3b, 0x69872d2e211a626f, 0xc7c735459a57783a, 0x489ef0a5affa34ef
+, 0xfa27576d7b160583, 0x16d057d09aee9210, 0x01ef0366907a5e08, 0x24d3bf5853b966d8, 0xaceb24987fe468a8, 0x35384afbcb40eabd, 0xe2006a9a18d25fef, 0x00d73a72440ffb79, 0x4d593d7942ccc717, 0x1d6131ee4fc662ed, 0x914605ba7b333d47, 0x4b2782fb871df49b
+, 0x1a8ed0694d0663df, 0x3a0d7ccd2f584133, 0xc94be7c267503de4, 0x7a655c5f8b87f379, 0xde67d1d089187cda, 0x3042d4e48a9aeb37, 0x02cc120e4847c866, 0x5c7958558f02de90, 0x0f1690b66e89a405, 0x61a9e90d527c9244, 0x37a3e838c0cd64fc, 0x1f4923956071e68d
+, 0xd1f60d04b408903b, 0x73589cb97fd496a2, 0xc11aff08a654ceae, 0x27b96a737e5e40a8, 0x86111294094029ca, 0x542d86ea5ec0b2d5, 0x997be45ff65e86c3, 0x68345035894e73e7, 0x07709d3bc8969152, 0x0d367069a4c7a226, 0x76d31e447cbc33c0, 0x7a94bb2bf35a978c
+, 0x8815086fc8c1fb30, 0x2bec59fa2c5b295f, 0x1601744708fd515e, 0x1769eb1790ac3137, 0xe42ff34340033946, 0x4128a455c9eb8ede, 0xf6364bb64c38f19b, 0x5d6f1fb3ba6013e1, 0xb037fea36b2cbcca, 0x4b99a52e2fbb25fc, 0xba7b2b5312ebd668, 0x16c1f8e0f55ba847
+, 0x9c68bc0d868a2408, 0x1a983a33570a16a4, 0x363fe723bb4e07b2, 0x51b0eaf54d87160e, 0xf310e29969b4f8f7, 0x63dc65f9e3a91009, 0xab80a069a95f4cc4, 0x19dd435bf032179d, 0x8932c2bdb73a29ed, 0x1d150f7f4ce550a5, 0xefa8b66b0bfa5222, 0x049b107849be392e
+, 0xb5c1d7fc0b450081, 0x0a4103736b914201, 0xa29738b6928e2d03, 0x4b6ccf32c31b6300, 0x7180e24037059302, 0x7ddae88f55313c08, 0xd76b84696b6fec6e, 0x6cb9315d4a311158, 0x9beb6e8b68df2bad, 0x26c68e070392bb7e, 0x3600b176845717d5, 0x4a9fd115b9773322
+, 0x7b9b482100a3636e, 0x4df2dd319d2ed9e2, 0x1039b58fd924e474, 0x054c8cb4c33895ca, 0x4ae49ee82e370876, 0x72ecf4a20fcc5ca4, 0xc542425a7be62885, 0x1686bf4c34aa4a54, 0x1a500c80e393828a, 0x3b2d1f65ad9fac96, 0x2968119d9e1fb34b, 0x58ca51ca77eabf55
+, 0xcea0c8ef1538f813, 0x45810f63da7c35d3, 0x593743fc703065bd, 0x6e8e81f17934f957, 0xbdf02b0200315aa4, 0x2df7eb195cf7fabf, 0x3e44627a41cb16b6, 0x2c93d09608c47d1f, 0x669102fefbb52e9c, 0x26bceb8174f3f42e, 0x201e85643263bd2f, 0x1b00faed7709ebd4
+, 0x3c6d8bdec091b8bb, 0x2faf6ba0a703f9ac, 0x75b58536e3fe208d, 0x35078cf287f57d22, 0x66f4451cd4fb09ad, 0x71125be6b2bd3d0c, 0x8cc527c2acdb1fd1, 0x7195855ce45e0866, 0x3826cd832d47e2bb, 0x0d9663a4386931ba, 0x2e362ee89137600c, 0x3443fda9a521a3fc
+, 0xbc45630b49c834d6, 0x28cad310d0bfbe4f, 0x08dfa5cebb70dd0d, 0x75778c3edfd5e22f, 0x1449acaf0a42c841, 0x3b4954df3f8e11bf, 0x21360fb117bf3860, 0x51796da571bc4e28, 0xc3a399e032d56d4f, 0x5231de11cc6daa14, 0x2798c7dc7bcfb83b, 0x0dba616d816d996c
+, 0x9292838b26ee1f90, 0x18da95bd917c691b, 0xc7052babba2e252e, 0x559bfef58221b26b, 0x0a2e0b936add60dc, 0x54dc9e374b827364, 0xa3abc5bfd0952bcf, 0x234f949d79115b22, 0xa08fb489de2e2998, 0x30273356e9a4785d, 0x940f74d39d7f2aac, 0x77429b0bcedc17c4
+, 0x13d6c774c7edd7e2, 0x6211c6ee2bb57b0f, 0x2017e4b01a32af96, 0x1d58a35e1a30d6cc, 0x74395f7d2f09a50e, 0x370d3557d2cca6ef, 0x09b85c9a407173c6, 0x69f2ecf6cb496a7a, 0xdbb39fbf739af49e, 0x1f23f4207f4de221, 0xaca8a04a99af15b1, 0x3bf03cd3ff657fff
+, 0x065a76624c5d6226, 0x612d136b928050d9, 0x293131eb9ee4da86, 0x27f7a98ca1aa6010, 0xe6ac3547b4602b4f, 0x2b3693cdda0ae3c1, 0xc019dc4a17ba91bf, 0x099cf8771a9cac6a, 0x8fdd5d763f18de85, 0x2b5a49641577d91c, 0x432669cd95fe0b96, 0x2d15327b6bc33db4
+, 0x80ec6eadca735ea8, 0x2f4e0b432b9e6914, 0x57f098f0df63f807, 0x117558a91871e276, 0xb3c7ddc15e771e79, 0x2a0baca5706656ab, 0xcdff917658fd167f, 0x037d7f1066779098, 0x3e82c4424829d026, 0x6fe8a6fd038fa1cd, 0x57ec9dc30a8944b6, 0x25420ba39aa0a271
+, 0xbe9caacc007c385b, 0x4cc2b0d1db42e0b9, 0x4d121faf4c80770e, 0x2e2f2ac32c5a3748, 0xe7ea779e336ee795, 0x254bd3fc96c9ce0b, 0xdc66b21dceada3df, 0x4ef799b339844432, 0xea8da0954c0c0349, 0x4aba1a8803d73b05, 0x570650625ccd4b31, 0x419b397a5e1eba91
+, 0x74bc34dd5c4c6979, 0x4803c67fe1c12d70, 0x208f10a147545969, 0x3ebf676e1c0c6e97, 0x7a6c5a8e5150a7fb, 0x610c00ee2ba37942, 0x33302c5bbc9e2c27, 0x633791c598945492, 0x417bb3b6b5891d6a, 0x15374df26253d948, 0xe0d1f21e8a8b1661, 0x1b66d25018bd9bcf
+, 0xfc2da3638c27c41f, 0x7b1688656e7cf799, 0x20ca1e6a9bfd8b20, 0x179786d230f73948, 0x3753387ccfc395b9, 0x2b3f368dad366011, 0x5c63011b205c8876, 0x3a9252aaad690859, 0xc7a5f9adbd894955, 0x6147e6446755d2e1, 0x92790ec846027037, 0x0d81b5c409f232d2
+, 0xe4fb10e6f074a6b0, 0x4bbaf0778a9e4535, 0x071b7b0c641f50d9, 0x4746720a9f8c59ee, 0xa8500133fda6f7ee, 0x484a6c0acd45397f, 0xab76ca7c1f7c721f, 0x553a76af41180e18, 0x952d9ac38568c6c7, 0x548d83cbbc590369, 0xceb272439fef7c53, 0x08b135367ad0df6c
+, 0xf5f304edab6b6643, 0x5ce4401ae2e6fd8e, 0x50e4f0d627240159, 0x0bcd079236734c55, 0x6df2635c4aad4d7f, 0x019ceedbc3ac71f0, 0xa6ed8d96639a7699, 0x570b3812e0320683, 0x0976eb9a548580d8, 0x12bdf18309b1d884, 0x8eca8f53edecfba6, 0x06b1ca5d963cdaf1
+, 0xa36e1b4d01a2e1e7, 0x229f8f9adbb849bc, 0x554f9a6c52b1c6d6, 0x3fdd642d63005be0, 0x80ea290d738f2619, 0x1a6af88d505e5693, 0x18006752009bc182, 0x18aecd6e9101f4d2, 0x0f7a1246823ba8a8, 0x778998166a8e7702, 0xb71a2feae1936a5e, 0x625272a8532a42e9
+, 0x92d5fb59152f8f7a, 0x62cbf63ab8f099f2, 0x8ed2bd7997580848, 0x4edcd6873b776158, 0xb4eb955e2f768744, 0x2599dd22bca040ff, 0xdb66c5cb9adc2556, 0x657a393882880050, 0x5e01b2099296e19c, 0x5205bea7de566b3d, 0xddc9ea6344e48141, 0x5dd4d24574810a54
+, 0x5cdc165b1ed1f38b, 0x37a8ea85c7cae5cf, 0xcede0a47dd667692, 0x73962e0b62d21da9, 0x757a9c59f6c92ae4, 0x1065596f38f0c029, 0xaff610fe630e7e0c, 0x12372de08ea541ee, 0xed487e0874c95357, 0x1b2dea30ddff1fef, 0xe6ef3b353bcb1c9b, 0x10561f34a9157f33
+, 0x275b3865044cc16b, 0x50d8fb0375080232, 0x7dab92fd8c7dfb2e, 0x1f18e0abd5d99d4b, 0xa0314cae5bf63f84, 0x55e451c18ed93ef8, 0x4b5ff8a53678e5c0, 0x7de614dd816a6393, 0x0715f4528ed429ac, 0x5bd2144827dbe02f, 0x8c3a64e70e5af99e, 0x185a9b5fe6039d05
+, 0xc8d51a7faa1b5e71, 0x22e6b336470bbe67, 0x511af9f3ffe816c4, 0x75d442cd31785f98, 0xbc763c2b6ddfc363, 0x5e187f2f055e5740, 0x9ba62b827b02e40f, 0x2da8527b0e5efa24, 0x37da3da359042939, 0x073588036b98eab5, 0xfe96a465fe6f0d7c, 0x74a6a7665f677171
+, 0x501cc334377cd195, 0x64c1ea26bf948526, 0xd7c31c8edbad7d1a, 0x7bda40160096bae8, 0x4d11a9969010984b, 0x45b78689fcfd81dd, 0x8d3f9a1f79083259, 0x0de3a239eb97e1ef, 0x8b66b692c42f8f69, 0x12be4e287a20b477, 0x962bfbe129ded8eb, 0x484d4bd4cf432da3
+, 0x62caa3b615bd5500, 0x5838f817affd2b8f, 0xee48d50c27ed79d8, 0x2d885a55446cc29d, 0x43f48afcb1223400, 0x2fc598e94b4e143f, 0xc017d848c34ad84d, 0x298869754682434b, 0x694969d90f3d09f0, 0x62fd4ffd936f3d38, 0xb7336048191cf3d9, 0x589b33cf0654d4f3
+, 0x4e628d59932cdabb, 0x190df0f9aba54e93, 0xbf5ded3ea9cc5a30, 0x375a5d545a89e7e2, 0x8582b7b7b4cad64d, 0x3392c6f648715d4e, 0x07eeed7a3547f5df, 0x66163b74c4949982, 0xb42af74c9fecf525, 0x00b4919d9029bb7a, 0x9869f9fc48db24d0, 0x40e399012e6179be
+, 0x58fd5e1c12b95088, 0x2c810319643e117f, 0x3d7b92b255035abf, 0x3ad6b64ff1e5c6e1, 0x5ff31b1e9581738a, 0x09e1ef079dde28a7, 0xea27614c57f7da0c, 0x3a84554032b64ea6, 0x1c4aa0a913a3d406, 0x32781f4ac7e6b814, 0xf3ac6dfce8807dea, 0x406f4eb2bef90e3a
+, 0x6593d118cbe14e28, 0x68396f99baafb968, 0xc288c4046f66bb24, 0x453ebef77e9437ae, 0xe7d36de535b303c5, 0x70081568a3606a43, 0x4bcb068e3728780d, 0x2ec8f35bffcde58b, 0xabebd3ee74f16b4a, 0x15da04131ee0d580, 0xb5ba122eac7a791d, 0x708fb5073157f72e
+, 0xde5d1a25dca1c636, 0x728054bf3eccb919, 0xa0af64e5410d70b9, 0x7ce61c781301fcfd, 0x91a39eb8304052ea, 0x70f37473cf3caa62, 0xd88a44e78ed23c41, 0x5663a84edb8b1e55, 0x883f2aef9438b58d, 0x78e394ea2c7e9ffb, 0x8ab78a8b8b2936ec, 0x637d5fc5b444f51f
+, 0xeea2933b7be6ca07, 0x143a2d190c90b11c, 0x0a0a33306b808561, 0x755f280b3894bd7e, 0x44e7b0f52678cc7f, 0x4408fe9b46e2da9a, 0xcaf7b25e2ac1d6e1, 0x01b03bf371ee6036, 0x53ebc244ad6d0e53, 0x074c62c8e96fe5ac, 0xf9b763e90bc6d2ef, 0x5600a6a67d770a46
+, 0x888c25d0f4d58c6f, 0x596a1268d4a67460, 0xb397082166fbc546, 0x02b8704185916a5a, 0xba0e5ba4ebabd6c2, 0x1cca64a767ebb32b, 0x09f26d93720b7930, 0x550d42cf30a9fc9e, 0xdddbfc4034f51c9b, 0x271ddec89edc6ac1, 0x59d8bec17673fe23, 0x1b2241d3288a8084
+, 0xd2d011eb87a4ff80, 0x40d0c230e6b501af, 0x3d325b5d4687954d, 0x186a4b8f554aacc7, 0x1390f6d3472dc79b, 0x6baa4242b0062c4b, 0x243457560ed0b91f, 0x10e59e21b1a67da3, 0x6a5e374767092b14, 0x5b2881ab2d1c87ae, 0x8948b49f5c6bdf50, 0x17e8197ff9b1f515
+, 0xeccc18d4076b4869, 0x32652ff7a85a83fb, 0xbef099d942f8befc, 0x65b05f960c08eeeb, 0x3cda4f4a96363289, 0x66bf6783145c5315, 0x1980742d6b36e44b, 0x3f1772e92b6c4fbb, 0x1e87098c43fab3aa, 0x758ff3e9cc4502a2, 0xa3762b5b922f3eda, 0x224166615f0d279f
+, 0xf1d8880ce418f37a, 0x28b204c9e1e36fbc, 0xe65e7372882ca654, 0x5e91aa231298d269, 0x1193a3df10856499, 0x209bf40b614b2eb2, 0xc537b11770e8e715, 0x1ae3d47c960f9cab, 0xaf23a92eaac486b3, 0x3f25018c6857504c, 0x187a4e23921fc6d8, 0x4c5b204b032cf764
+, 0x080c080acd004f2d, 0x7d787f055ae8a541, 0xee4d12f4e5878b0b, 0x35f2be4818176694, 0x03891891310b39b3, 0x174d1c7d259aef73, 0x643f2d20ed1cee56, 0x1b0428c1a0cd7e53, 0x2916be392b45d688, 0x4f0f730732fed5ba, 0xae72868ca12bca53, 0x1a66063b35cc2082
+, 0x91db9c722bf8ccc5, 0x0824ec94ddb49a8c, 0x57acc1dcca686efd, 0x16444b8b8d1458a1, 0x5c5a4268b0f863fc, 0x77f960b5808d9e33, 0x782dae814bb6ffdd, 0x16a81a5af4da7186, 0xa14e0514d971f0a7, 0x583f669d71ca516f, 0x2b02a0a2f938ce65, 0x39bfedd6c5da2d25
+, 0x0c7e804178c6f2e8, 0x3a27ae2e9eb9f845, 0x66ca28d1a4d4ec44, 0x3438fe5e6383839b, 0x9aec3f785a82911e, 0x3abf3627b9557abc, 0x9b9189f293916666, 0x2203a8da6e196ad1, 0x88703078571bb04f, 0x00ebedef00d9b90f, 0x9e072c6adc21a079, 0x23662077283dbc59
+, 0xc386e1388bfd436d, 0x4e79fdba412235b8, 0x47246dfca5710eed, 0x0f6d48d01cdef4b8, 0xe1dc932eab4d5909, 0x5e4b843acb9bca92, 0x01174f083bbec9f5, 0x208ce0b9a0781c0a, 0x5e46577ffd2d9ae0, 0x4413dd16932dce79, 0xe60e7df0cecf1f72, 0x60c9775d377d0c70
+, 0x53b5978a5aa7f41f, 0x13043ae708bd7b90, 0x2bfb90453fe2ba90, 0x6d9b140518417bb5, 0xa08f5dc567a094e9, 0x4404d5db600e9d90, 0x1014038939a7e211, 0x612886cbbbb184a3, 0x8d9952a8404c073d, 0x5ccc45a63a6610a8, 0x426c2601c8c4dad3, 0x735dd19896010fb8
+, 0x0034fa920d63a717, 0x139bc3c50d923938, 0xfcd3b6315d0b70d9, 0x1996356da20f5681, 0xf95f19f4c9f275a4, 0x72ce7df9ebbc8718, 0xfb2337439451d16d, 0x4e5a294d29ba1305, 0x6f5a7d18bef59a4a, 0x586c0f2d4c0c6573, 0x52c01333899f2d9a, 0x17dca9187a3017f9
+, 0xbf82713b43cb5acd, 0x0a2f1d6da4c76d37, 0x836b81dbf80b373a, 0x00ac6ee351781461, 0x715c46a438b00eb4, 0x1ef0b0626757bbc2, 0x2e627a413f5f00f8, 0x131c88fe9d3a50ce, 0x69ad70feced20e40, 0x4cdad04a306b5239, 0xb64084930b3b03db, 0x18b05264d3359076
+, 0xc05cec33d08e7b12, 0x065bc8d22b5a19b4, 0xd911e0815e60a3bb, 0x067f60060aa090d2, 0xe248c10048061687, 0x602d47cc80c292a3, 0x07e108702f10e883, 0x304e15317c39c663, 0x1587c6e3dd70f6f5, 0x56100ac184a32025, 0xb0fd17fdc20479a6, 0x6a3e80f51412f71e
+, 0x8b6a5078e525fcba, 0x7fa100df19cbb7a1, 0x7d6d1a70cd21613c, 0x6125af2af8d6130b, 0xd98ac271d92f52dc, 0x061be63ea2fcbe03, 0xd3a0c7e914e7f64d, 0x24d9a6f88403b7aa, 0x52572d7ab774aba5, 0x205e8a4060465296, 0x0747bd08d0de52b3, 0x4b8d7ba0cd402873
+, 0xaaa30d08bf90a13c, 0x2d797a37f3b72ae4, 0x0b89c14b5ee8a1e3, 0x6eb4141202eaeb48, 0xff4cb7d9b326f86b, 0x501a0a85d1c5bc5b, 0xa01afcdeeeb74533, 0x413875ea0ce35953, 0xca86455da35201d8, 0x10dc64f327fdd961, 0xe9643e7e51024f9c, 0x050be148d0d049d4
+, 0x0bbe4938cb770572, 0x7c683121f7b1a926, 0xb12cdf0576839dd8, 0x4053805dbb1b22d5, 0x54fbece70db71272, 0x3e04ab1f34aa11ed, 0x20de271e1819b9f0, 0x135983cfdc4a9fde, 0xf50d18579a6eb163, 0x1939c4c301e2d2ea, 0x8320d8c270659da4, 0x6028e0ead2e74bb8
+, 0x278cdde7c3080419, 0x361534cd6215d36c, 0xca9283c73054d61e, 0x1392c8614d5a7e3c, 0xaa773f7c6eddf11c, 0x5aff24f2e9be942e, 0xf17d30f4b79e0b54, 0x027448e42a999b1d, 0xd075bf30e4dfa5a4, 0x07a6c69917c5dc7e, 0x1e2fd9d84288a6e7, 0x032c8b835ca5b0f1
+, 0x32debff47fc1751a, 0x59f0e7f8cd6da20f, 0x7240c608265e7859, 0x458031d99d0e782c, 0xad3ed7c81478d26e, 0x48513ddaef2f9bc1, 0xa69a96095ffa912d, 0x3f1261153e1339a3, 0x2f6b45d5a0e32221, 0x3e63ec000d27dc9c, 0x2e07f512f1e17a6c, 0x226c67435e489f69
+, 0xa1a53f072bbc7b84, 0x2be024b4693209b3, 0x205321490a24b8ab, 0x5b44409e02461f52, 0x09dd3c0951fbc359, 0x3581f2fb50663376, 0x7124fe803cedb0f3, 0x220e0df58779f678, 0x71b84288e18e8a3f, 0x766f53c917ea1c09, 0xdcfb8262e9589739, 0x28a6633df94a9eb4
+, 0xaad45f707f573661, 0x3e99f885fbd83d0c, 0x40151a44ad0ec8d2, 0x75bf61f0058ae907, 0x7656f18c4d7ad4ad, 0x131b2bb21189d3ba, 0xaa54b4db35ff73ca, 0x440a626898b6f631, 0x0c9e480ac5f5c7b5, 0x5e4644d1961a3602, 0x7688d6287edb41d3, 0x0b3152c72aba57bb
+, 0x7d0c29f8b189a9bb, 0x008a0f147e7b55b7, 0x4ae967f392e7ea15, 0x11a6575beed1bd64, 0xa286bd9e902e83e5, 0x188400469eb687a7, 0x8947ab609bd42022, 0x569191715d7e4d75, 0x92d0b0467f6ad821, 0x3d6142e1fb2aadd0, 0xe834b802dbc1b3fa, 0x608108b3e0662dfd
+, 0x7e55276fcd9c7bf8, 0x3b2042e6c68d3f07, 0x6181a29f959d35d3, 0x64c51e351fa72976, 0x28c3d98dabf4d1ef, 0x2080b53b871fcec6, 0x633fdf2bf9d17880, 0x28dc91469f55cb7c, 0x1e882b950de856f8, 0x612052a8f688caa9, 0x64f89fdc93d352e3, 0x6b2cb657ba3f93a8
+, 0x2e9e37478ff86682, 0x48aa40c16af1e821, 0x512bf2da9aeee5d1, 0x7788c5c88b2777ce, 0x5549792d13fefead, 0x5c1d2a84385ddd85, 0x23821edb0f520129, 0x48a05469ca09e433, 0xa1ffcce40ce45b3a, 0x25ee6faa9bf528e9, 0x064af0d808221d97, 0x28fd5e1aeb71f7a2
+, 0x5b54b370df61335b, 0x6e93ef870fe84523, 0xed2de0f9333cb045, 0x31ba28d79ae3ffac, 0x6d8fa1c9cb499b23, 0x748eda076527dedb, 0x7465038b47eb35a3, 0x613016bf7cf0e576, 0x1b08a6f84c276b0e, 0x520e8b69ee684cca, 0x342ff48361157658, 0x22e396fb4db537af
+, 0x75a31c3020b764cc, 0x06a1ac762b2a4d91, 0x12793a8eaa9ecec9, 0x207fc066b0b29828, 0x280a443ce3bdfe6d, 0x6d63d140efdfab93, 0x1742b28cc024f1bb, 0x7632d6336ab4d0e3, 0xcacf2860fdd7a07f, 0x20b6dc6d1d732d15, 0xad4db0eff256a148, 0x4110e10b2d598163
+, 0x322a177813dcee89, 0x38c87f39f9563a84, 0xdd86b7dfe3a777a3, 0x2c0c67049c45d9e4, 0xd7e5fe478b3d5fcc, 0x7b7cc4d347231236, 0x5f723a1e22712c80, 0x1d34236c45f8d3c5, 0xd8d9139a3440cf1d, 0x74fb21538540a7c9, 0xbbd1bfcde9d21e42, 0x4f840877af5a59dc
+, 0x8406280988427e74, 0x4d0fc6e891534f89, 0x936bd38ad1f74f77, 0x77cb8c58fd9887d0, 0xf4840aac459febaf, 0x022429e4dcc707e2, 0xcca57a86bba60e2e, 0x321dbc100fc9f4aa, 0x33f458bd6245ba4b, 0x575f674530fdd917, 0x43e40bd3e680ee2e, 0x5bf0df949536b658
+, 0x13fa668641d3d702, 0x6ff912332a1b3439, 0x166e0c2c073afd38, 0x25d38b1d56455805, 0x8049326622da307d, 0x08cf60f65da9e551, 0x9a3f23d359118158, 0x6dd0e395ae6724f0, 0x61fa5b954708a437, 0x3c18feb80d03f7c7, 0x0b5b6d453e563ec4, 0x111c004c0ce88a59
+, 0x9285d536191a8591, 0x34c148d23ce800da, 0x60900fccf460e7f1, 0x7e217dc37877e1ea, 0xdeb13fb918a4b930, 0x12156ff828b580d4, 0xbf1caae116aae7ca, 0x39b62a66a4ba62ed, 0xde8f429cfc482d08, 0x20aa0384eff996e4, 0x731becdeaaac0235, 0x66609d8ab7269966
+, 0xf34ccbfd076c1bf2, 0x1b5d5159f1d61407, 0x239795efe1cccde1, 0x23b5d085b3cc5a56, 0x68b998e62eb72a69, 0x2d1dd75be9a7ba95, 0xa67ebe78ff6291f1, 0x0bab38044bed9576, 0xcd29702170481868, 0x2b6f0bf7d413555f, 0xfe71ba2ea0bd0637, 0x3c3aa084acebda39
+, 0xcb388d1963139e36, 0x67288119cd91fe60, 0xbafcf9283a9684ee, 0x06121376ba13d0c6, 0x2f9a8d02dc017ee2, 0x6d0e8f685c626534, 0xe52ae4fd0e10197b, 0x44c0deab70258356, 0x23ed8ab3a69834cd, 0x587e317e37337074, 0xbbcee454d646e191, 0x338deef2e6c90407
+, 0x9380385aca26b0ea, 0x3b342399af2be3ad, 0x4116955026ad259e, 0x14abdcdfc7f2fe3d, 0x2cb54acb976540d9, 0x743d000664a0c38b, 0xd8b18c503b8b8bc5, 0x706b03de4739c75d, 0x368ab112a5f00627, 0x6b00cae37563c6ca, 0xace8044fbf1bbd0b, 0x10b0577c0b15566a
+, 0x05b5623600d19d01, 0x79eab10d8cef3eb9, 0x390291ec68f8a0cf, 0x36282fcc7f95474b, 0xa92c6c7ba69b92bd, 0x46c73370088d4a9a, 0xbb6e7c165b271664, 0x6e29f9f3a19f38e2, 0x90c6dd391bb7ef23, 0x3167ffc030286fb1, 0x497c5a3fca7344c1, 0x395e8128a163ce21
+, 0x1ec7a82ac51297fa, 0x7b1c6df1f211dcf9, 0xa3da4eb0511126da, 0x235f25d292ba286f, 0x8e2a65416e716261, 0x6e4d079fe4f0ce0a, 0x9dc7bb4782efef74, 0x06a69ddd03489584, 0x6e16ad8308ebd558, 0x78d80ea834e57dca, 0x4b9c044ce975cb3f, 0x7c252998ff0a841c
+, 0xf238c25376de5d4c, 0x4577261cf9668bd5, 0xf143c0eac073ca71, 0x0dca6f6315d9071e, 0xe8c85e372965382e, 0x4f1316b40f8e1876, 0x6545b3fb1fa1c177, 0x06db2e06f657f12e, 0x2afc8df92222bc86, 0x338339b23050bf96, 0xe1120d83ab3387ab, 0x6309fce277e8c6d6
+, 0x608e4c28f0e9169e, 0x1aed859d6a5b7de1, 0x51a7179e108811d5, 0x257bbf2f714cb920, 0x21173cb36d769703, 0x44ce506754c27ba3, 0x22f4f823507ed188, 0x397978c7e7b5b50b, 0x44e57afccc7c01a8, 0x0bad9913b62892e7, 0x938f97ede319fe7b, 0x5d497db3e724ed30
+, 0xf643962d19365785, 0x3781b79b506a6d11, 0xdfe6a52f66f4fb7e, 0x70f3456ea426ce70, 0x28c18e8dd718bcb8, 0x5f487104b0e7e97f, 0xc8b08332607de917, 0x3e0a26fd1172944d, 0x121f6bab824843ed, 0x3faf7889fb191fa0, 0x2cdebaf053c3ba39, 0x61533848df6bc78d
+, 0x023779f0cb46ba1e, 0x05fe283779ff1de8, 0x4e4648a992417cbc, 0x260aa7955ad3388a, 0x44099272ed96c560, 0x76feec378be4fd21, 0xe99b850661e1cd5c, 0x442db79f3c6cf6b5, 0xd85ef7fdebfa0069, 0x1599668b514f368a, 0x0e2db246ec26cb53, 0x5b47d1fff80e0e81
+, 0x3c2082bb1a430e86, 0x5c4859cf9309bcd9, 0xc2cbc379dd8b64b3, 0x21700403e1bf9350, 0x4b796ca106b8588e, 0x3325a7ba3dde4f7c, 0x08ea59da9edbec48, 0x085f57cd89c0b694, 0x3c6b3ecaa06016f8, 0x16fc154b0fd6b7f5, 0x7c53b19b9c112b5f, 0x43ea4fd9e4183de3
+, 0x6ac1fc9098583f8a, 0x4812905fe02813be, 0x707557dca4ddc887, 0x500bd3d92943f686, 0x96fd7cc9ca8ea98e, 0x4cfe52a3920376e3, 0x7a8f2e954d103f64, 0x79980e66945b1937, 0x8a3200d0a77a748c, 0x1dfc648546d2c811, 0xe8ffbf7c109e4e1c, 0x443de532b79f90f7
+, 0xd483cb3ef566dc03, 0x7fc6fadc34a2bb0c, 0x700409adb2c1d5fd, 0x7c4815505f5e1c7b, 0xcf02aca6f495b2f4, 0x1b6ae87e0287ac98, 0x7e584f47b8f86260, 0x238af5bda6140477, 0xe07bdac316782c25, 0x1bcd95a1a48573c2, 0xac0f8409b9d2d217, 0x1ea5945df9cfccc9
+, 0x0f55bb0a32651fbd, 0x395b50465cfd11f1, 0x83d338b252717424, 0x64110601915439b1, 0x2dce38a2244eaf3b, 0x47731ba936c4f825, 0x3e914b1632ef1b93, 0x791d7bda39a74b41, 0xd88b062c52d3ebf1, 0x409bc1494372a5fc, 0x53b580a5401d5df7, 0x2e87421ff06afcef
+, 0x59e27e32520d42ba, 0x1daefac73897f64e, 0x3cfff2abe1412f37, 0x320c25fc3563c762, 0x616d66f091e666aa, 0x1910602d43668edf, 0xdbb6ac6d9141575d, 0x14123d9208624366, 0x078d119b3ce90130, 0x4db762fb3fd46e09, 0xa824ad9ceda71e14, 0x23ce23f5aa7b1ff5
+, 0xfbd303410c19b8ea, 0x417f7b9afa29da49, 0x12e34ac75bc709f5, 0x58b53ebb65f7e6ae, 0x6f9a0aa4a85f53b1, 0x7f1e648e5cfea938, 0x88487c383e8d4bd9, 0x1d3985222c272e93, 0x8955ac99257a6bd7, 0x6fc525afc450fba0, 0x419b0d06ed9adedc, 0x71a0c35bf0642113
+, 0xc1cc19bea665dc3b, 0x021a851e621eb2a9, 0x694f1679d082fb91, 0x24548efad57bd424, 0xa8cb9cad02d721a7, 0x14956726a85ba772, 0x1d9faecd24a2aaf9, 0x3c3c77a8eb7f15f4, 0x126275b710b34a5e, 0x4b255c9d8055c05a, 0xcf5a0f2d0439e2f5, 0x2dfc4344ae06546d
+, 0x19e04d1b2b0fe7fb, 0x56381ebd8181b50e, 0x5c8970c249df4ac3, 0x08acaece8ede7685, 0xc44f1a71aca0d20b, 0x623edc8d92e4ac3a, 0x5496a7e5885a0c95, 0x20a9ba37315b116e, 0x3765873809f5b55d, 0x23c44c42ebef2ff5, 0x56a96d921f724573, 0x3217815b72b8a9eb
+, 0x2cc1b42f5350a489, 0x31f0b36e85b8c70b, 0x504a5c8c4d2ce34d, 0x1af8ea26b3786eac, 0x69bc5e26d7afd62f, 0x21e399d04247bf9a, 0x6e6d6676a88efb27, 0x476212b9fe9a6fd4, 0x0740fb65284168de, 0x5f7570be65e69408, 0x0166c3279dd81c29, 0x6565489007c4ed6d
+, 0xbafb5bd37b5219c9, 0x00251709f2e210f7, 0x0d22639b51c1198b, 0x0f3c0df3be3de811, 0x3552612be3374eef, 0x0834744318ffa0aa, 0xcb9f1c1e3557a00c, 0x20c359f5de8b6614, 0xd319482a34d05268, 0x42165771b46b75d7, 0xca336c22e8d911a6, 0x4d072f70067a47e1
+, 0x9022c6f101555e9e, 0x4c8c7eaf7cc2d697, 0x629810b2d8044817, 0x25110bc01b06c9c1, 0x1bf9c06bf39eaff7, 0x6cc36f151f52b4e8, 0x76b73a6a14b62068, 0x47dcb0dc89db3821, 0xfe9dfeac2f670f41, 0x625b5c93b973c417, 0x5f8c917930133c1a, 0x6bd35f3e0992bb2b
+, 0x03b5391a85409e5e, 0x7981d8fd16362767, 0xdb45c80a32a23cb6, 0x67356a7ef48b2dc3, 0x6189236e9f01adaf, 0x07a1e954e5032bd6, 0x53d627199c69727e, 0x25d67e4163cec014, 0x18e7bb6a63a80738, 0x3112be4cb5dcbc74, 0xad9ad6d381643f04, 0x116112cbeabb734d
+, 0x32623abe2d66ff07, 0x4d780300822436de, 0x9bed066c04497808, 0x40db29b39ce86700, 0x6e5e5eb3805602a5, 0x52f227f2b1b9b40d, 0x51c2c4c197a18394, 0x6d8bca423ee270bc, 0xd6e60cfe8fb07f72, 0x7dd66c3970f940c6, 0x66aea7b59a0b17cc, 0x75fcf8b00160d729
+, 0xbedc5ea39b2402b5, 0x0dc3600425feedd5, 0xadc1ddf2cb1b6631, 0x205ee93e3aae976a, 0x7a2cb4e333c98498, 0x7d12eb776d56872c, 0x8e339bc1b41599fe, 0x4600f0a53fac9427, 0x1049d3a372f14304, 0x7b54e020b22db742, 0xd567962272a35739, 0x27a1178b1115f0c4
+, 0x6cfb39d619c35e1b, 0x5cb96fd1a9d9d486, 0xaf45cef7fb4fffea, 0x4a73d7b2ba9321d1, 0x44b46b4a80be86ac, 0x2769b50579e8f734, 0xab5d109e7472f372, 0x2bccfba1cbe995b6, 0xc00026115332f6a3, 0x7acb287da1561c53, 0x21555c608cd90dd9, 0x7731d1b2878dae13
+, 0x32122bf5ec1a0649, 0x592b5fa180ec8467, 0x876be1b5ad9ce66f, 0x484c1cc5bb34819d, 0x08e4cc425b30b06c, 0x2766065f0e4d22ce, 0xd90825644987aeff, 0x3a835fcc7fc456a6, 0xf4d801d2cc806d69, 0x41d767ecca55f839, 0xf2dea9fd01f1e74f, 0x74d01b97462211cb
+, 0xe43e280ad29f80cc, 0x5cdf66a69029b231, 0xe8d655a03c862cd9, 0x388e38b58d0e8c79, 0x5d9aaa4848ff83a2, 0x14d6fbee4d6cbe74, 0x0426dcda912109ea, 0x1bb7b9cd75d4b541, 0x3a3c0504b39b8505, 0x35a3c5882b31367a, 0x678793d635a6473a, 0x66abca7e20202034
+, 0x4a90ff1dad300021, 0x18f29036544d2684, 0x2036d39b8f69095d, 0x36490f5645d18cc8, 0x9414d7368ad3562e, 0x7f8108a04558487e, 0x93db0e56d653e40b, 0x03f413ea960537bb, 0x984717b77f7267ef, 0x6c5d9da4a5ee7305, 0x725318dc36060a49, 0x274397f8e79a239e
+, 0xbda7965b4095bab0, 0x6292b2505c7866e3, 0x451fb6a0672d6733, 0x37c560f40242a859, 0x151e56eb818f1423, 0x63451986f0c22ee1, 0x9275ff873a5c75e1, 0x178cdc734a32b96a, 0xff7adbb24244aacc, 0x76518aa0dfd96ddc, 0x161c1c8c81071219, 0x0584d44c10a3e6dc
+, 0x2727282a09e9acab, 0x1298e49c34514ebd, 0x0323d059ca1c0e6d, 0x6072c8b87dd26bc6, 0x36eca2ab28d36f26, 0x2a977cb5aae4ea2a, 0xf157d43a0b9546a7, 0x04d60af0ed661d29, 0x34bc1080126e4402, 0x7677ef9a21589171, 0xbd13797278f07a40, 0x32c0daf0b57f20ac
+, 0xbc83fd1b8366dc2e, 0x6cd07286c4e670ec, 0xf35485a3f339dc8a, 0x6e7e9285f2247e8b, 0xa9d19d3a09943bae, 0x43fa5197eed852a6, 0xf911398a043242fe, 0x4a100dcb1312cbe9, 0xbe2fd86be910a692, 0x614fd829368d7937, 0xdb5a98b1a92d578f, 0x46f1d23e1b0dca7e
+, 0x8bf4c6725e813f36, 0x68bc89078129ce91, 0xff56503ae28f5c7f, 0x2b6e0f4e42178ce5, 0xa97cd947ec65895b, 0x7aa90b66280ff6c9, 0xebbaf32df158a0a0, 0x6a748d0ac02bb713, 0xdf79b5d619e83397, 0x16934947f6485b69, 0xe75185521ab32881, 0x20791e276a7460c9
+, 0xd25c403e22c70bc9, 0x0bf079518e66e1d3, 0x45dd5c971d3711de, 0x66bd2c6a30be232c, 0x607829e5b29e53ca, 0x30ed414e71dc08a2, 0x3fd38589ea0f1d39, 0x5a881a121f37fc5c, 0x27b9394368987a4f, 0x321fe45e13afae2d, 0xc6feb75080f33ea0, 0x02166d52f45eebbd
+, 0x15026a1b0ccd2fc9, 0x1141be93d5bc3d6d, 0xfd20df606fc676c9, 0x4059e26b00ad78c4, 0x0709b409cec6b505, 0x68f020e8acf478e5, 0x875d77d1f5df0cfc, 0x66eb377735162ff1, 0x860482ab417a32ae, 0x21175f47da213935, 0xa07ff0cda099ecdb, 0x26ae5f177ae2b8e7
+, 0xa9a070ea5120eaf7, 0x2581feeba7383f81, 0x49e0f137f1fa2a7a, 0x7fe93c51cfd1ec62, 0x2d74dbdca7777f7e, 0x562da2ba74e823ff, 0x543b4f8609d77a2e, 0x3a0f65212f234ec8, 0xf842e3fea270ebc6, 0x4524322c6a289e11, 0x80815887aa6a8576, 0x46f49d53c3fe29a3
+, 0xbcc93cedfdb0d388, 0x4db312076ef0ad2b, 0x1f2cd56373654ad9, 0x4c6446970034d15f, 0x34d2cdbfd5d7130c, 0x6198950d03db2ae5, 0x736094b72faf1b1a, 0x1f6ca46a9f2588f7, 0xcba0b03d6259772a, 0x24e5a23d8d6be3a8, 0x7090e340c94f6d6f, 0x287ba27ee54e8466
+, 0x87320c8822d607f0, 0x44fd5802509df171, 0xf35c09860bf6ba4a, 0x6cf53130ef77cc0a, 0xaa81167a00b48ce4, 0x649f4c775b0d8b48, 0x59a25683ee98d33d, 0x651479007d1061a6, 0x155487411f6e16da, 0x411d036475404bf2, 0xc231f1344162458a, 0x4f36b7633f7dd368
+, 0xa98ddc0a4e7a89a4, 0x55d8a5da6eacd542, 0x5c3fb48b1001ed45, 0x5c7785ccafa702b9, 0xa64369fd216afb79, 0x1f405ef10e940669, 0x755f4831bc327b6f, 0x2bc1b67d71f1882d, 0x8eab15cfed7777d0, 0x517370d580d99326, 0x0811b75701c9db39, 0x234d84cb52f7b621
+, 0x970c4fbddddae49c, 0x3ba8d842475e41e1, 0xb0720f6ad75e7008, 0x275cd5c5184bf345, 0x5eb9833888d3796a, 0x1b3a42dfde11c2f3, 0x946548fe092b5f4d, 0x119917b50f263cc9, 0x622de955a20a3f82, 0x6a552ea3a60c7ff4, 0xc79230138150372a, 0x18083b9518de76a7
+, 0x55fb74dd7d3b5455, 0x523eea9a70ff8334, 0x5994a7335e356271, 0x3bb011f60430f1d2, 0x1ec434cba1d6ea7c, 0x69b632960feb5780, 0x46c50417541ebf07, 0x01470bfbf9d23830, 0xe9551f4c049bc5cc, 0x1c124638f35ee8ed, 0x09ca3a9141e83a38, 0x44daaf3e7411127b
+, 0x0e54717b6c2fcd10, 0x518ab46b26d5914b, 0x528ac6c82341e833, 0x2247fa99d41f4672, 0xabe30c65c0f327a2, 0x3ac74e012b77e1b4, 0x35defd694c0e86b3, 0x7c382e10bfe60e4e, 0xf37e382996b8461c, 0x4d47481c53631e1a, 0xac8f167884f7b7b1, 0x5ae1bb6ab1a4c643
+, 0x63eb02590829df80, 0x623126862a793fa1, 0x6e1e242f1ce09807, 0x7bf96130aaecfd2b, 0xedc5e9ea10bff70a, 0x66b548233b94d26e, 0x70c70ee4594d30ab, 0x79b0006c8811353e, 0x4352792c91710c1f, 0x0c7bf15181a9f539, 0xfc995ee769e3779c, 0x44871c6cb9dcedcd
+, 0x0d180bbf2c9a046b, 0x5445c598c45d0cd9, 0xdefb32386875fb94, 0x5b0d235355660f35, 0xbe1dea825b3a7973, 0x10658ec4e1bbe147, 0x48af5e87fad77504, 0x55f5d3c94a7dd694, 0xa9a3e7062cad6ba2, 0x36c0a7e3f9e0ea31, 0xc4bd65217010aebc, 0x1d031dfc8b9fb598
+, 0xe3621c104113889e, 0x774b77ee1e6a6477, 0x124c5b8a07785fd7, 0x5a6c0df18188cada, 0xf4adcd545e72d7be, 0x38100fffb66ba966, 0x2100cbe35fe4a4d0, 0x4489be2df052c175, 0xa03a22403b26899f, 0x5ae4a0a0fec13928, 0x89dfbfb802795eaa, 0x34917e9c4ecf2532
+, 0x64b93674c60cbbb3, 0x25c098506334c71d, 0x8a723f66f1ee34e1, 0x3a960adf48f141e4, 0x659f386695e440bb, 0x577a0fbf6e8095e6, 0x8ef419b0f4b25496, 0x044176a30b9e465b, 0x7a98705df2013e6f, 0x77d0b2483aa95ce7, 0x309e917b978effd7, 0x08f1e55bfe942c7f
+, 0xfc241629b8d613c8, 0x140f2e35cd68949f, 0x38899f6a3ee4f9fa, 0x7abc8ecdd300f3b5, 0xd3dad23505d23eaf, 0x75e73f09376b2c7c, 0x5644a663b60ec5c4, 0x511ade8afe1eaec9, 0xbb005fe4e1abca89, 0x2838de73b0ca1f6c, 0x800a6658b80d28c8, 0x48aaba61c91641ec
+, 0x222759cab704d4e2, 0x106dd3c0ce85beca, 0xa1ce1ce341f69d03, 0x1651b210e8e4ee10, 0x47329a5e7133e136, 0x58c02f47dc9367b9, 0x09dcba56947b02af, 0x435c251178125b48, 0xd56979a3f0cd9315, 0x2f02b0a6422afddb, 0x23920f500731f32d, 0x0ab833238232cb5d
+, 0xa7b3d1bfb0bb60db, 0x2342c2a03c6eaec2, 0xac5e6e5a14d5282e, 0x5b9a421ddc42a24b, 0x018506414543e056, 0x6d7c377c084954e6, 0x4f8bf71ed3db1ced, 0x5150dbc15ab10979, 0x00b50a1b373a7fbf, 0x140be5c3d3244705, 0x5005bfe96e5b7911, 0x77cea555bb133f3e
+, 0x2ab1e1a9d7a973c6, 0x3897ac98314968d3, 0x9e0f74764b23c9c3, 0x2e5ecbbae41997cd, 0x43e2ea5648f12433, 0x3a515a0e4808e69c, 0x17d36c03c36bb343, 0x44cebd053481ce43, 0x89008656c21b0d76, 0x2f8513fcb9009be6, 0x2e223f90208a0e83, 0x3828c2d4efd36a73
+, 0xbf17d64f89a8527d, 0x59ebb42b9656151d, 0x7d7bc7245c7dc5ef, 0x191b682a0cb695ec, 0x8931172fad9f9add, 0x239b6cbbab2ebdcf, 0x76932f9ca7002dd1, 0x0c140548f858d8b5, 0x6c7adfddcf741ea5, 0x3b39c4b9e2e1a567, 0xc5135a25f87436fe, 0x690d8fecb7dd0ae0
+, 0xd782a618ecda10c2, 0x4f2a84b3134cf832, 0x35a81f71bbc955a4, 0x457f88ed64ae6398, 0xc27eb71c31479985, 0x4ae91808569aab32, 0xa5f2e9785a75eb11, 0x619cb199b837ed36, 0x0e7e5912b9484e40, 0x3b5831e87fdbcaf0, 0x49a2779c2d2b039d, 0x3d4b81e07f49061a
+, 0xaa119b0fa222b55c, 0x265c1b11b42fd4e2, 0x6b4d28e519dd7637, 0x3d2da7900de5a4b2, 0x99b06586b5f21d63, 0x4ce62bd9e6a1ee18, 0xb671e753932f8c92, 0x390b7821d0987834, 0x1adf7c73c3f1fc2f, 0x78c636a8514a7af9, 0xaee3b35fe11e7533, 0x7fbd199278f6ffd7
+, 0x41aabbf4363d77de, 0x1b27fdf18b96bf6a, 0xda264a1dff9a981c, 0x36efc08530c0bf9a, 0x5bd8862a5d830854, 0x23d7c905e656e6cb, 0x4523324c5b64fdcf, 0x36627f376238665f, 0x564f53925c6d5ea4, 0x17c7cc86a1913022, 0xf90db52a543b009b, 0x15192dc91f8b994b
+, 0x80bfa3c1a79ec6e2, 0x48fca8ea99772ecc, 0xfee6a3b98c0f1824, 0x46a8c75601b81e22, 0x2cb3c402a8895fcc, 0x1d1dff9c04305ce2, 0xc1aefe78e85971d7, 0x79c6a083ab5a80b2, 0x379c7bca5dbf2518, 0x2419358989b3ca02, 0xc9c42c9cfa5f470e, 0x4481c2ce91b14459
+, 0x6b04dea1ea26deca, 0x26ee3ceee0d0a101, 0xe36cc6bcd8fa4f26, 0x4d14709719764fbd, 0xe0572a706f1fef52, 0x0f75fb69a23f2ec1, 0x32ae4b04a864cf3b, 0x0b6373a91b944773, 0x1a8f2bc20bd088af, 0x586b0d5ace401747, 0xa0e6b094a3c51433, 0x1752a123c268c1c7
+, 0x643c2a93b5770ea1, 0x536cb9d1b71eeb43, 0x6bfb0525d0cc6b3f, 0x1f4dcfeec3adefc3, 0x28a0169dd0bf57f0, 0x1336c9aa20a35449, 0xbbcda068703ad7a1, 0x5e33478283c1e03d, 0xf1997733d18fdaf2, 0x789af507a17bb867, 0x79970c14d5695613, 0x79452342e845256f
+, 0x6c12f9367a26a018, 0x11beda1c8f9cdfbe, 0x720e6ddf24b30929, 0x7706e91e3e544755, 0x4460381d3a6c9059, 0x7e01916c3678c424, 0x6024355a61d2bb07, 0x68bae01d79c869e2, 0xf21cbcff285df659, 0x02f7ee6aeb57c933, 0xce0f078c17266467, 0x039b4fdb5170a103
+, 0xd5de0fec61a4ae1b, 0x33d37a152a778695, 0xea64e40e6a10ded9, 0x1f1d394373bdb213, 0xf63598b6ef59fd14, 0x57922adc3ae52283, 0xe39a90e18b76f4a1, 0x27f3dbebd98a9dae, 0x18179dd9c03804b3, 0x511d72c1912e2d73, 0x88e1f6d24b2f3225, 0x56009999cdc2997f
+, 0xda6df977b7d82fe4, 0x76f746bba63da226, 0x0b5facfc3bf13bd7, 0x4a31eb04f66f0e18, 0x8ace73d5e7cfe28f, 0x19aa731bc30c20b1, 0xa91979fe73400317, 0x6795ce71a09c7c9f, 0x93d55501933700ba, 0x3850eaf08b1fd14d, 0x450c5abc89edca71, 0x1be5db848bdfa5ef
+, 0x77667d3f4fcf082b, 0x673b6e6c4824bc45, 0x6f22c12a5fe0ed6d, 0x006ee6722b5dfed1, 0xb47a13c1468d0c62, 0x40564879a378e6e4, 0x0bc6b553a9d3ab58, 0x21761c79e44dfcfd, 0x66f36ed3eb1050fb, 0x2e67df1312dd01d3, 0x48744c4a68dbf2ad, 0x7844962b6d6e039c
+, 0xe07b5675d378b65f, 0x336262aa3d2c1df0, 0x320a5667d78c2e2b, 0x4f668dd96dda5e2a, 0xe21556795c7b8470, 0x3061905b2ef82bb1, 0xaee53211472206b6, 0x1f87377fee0d7a39, 0xdac58c52a3b1a0c7, 0x6e3c4ce04f0d7ffd, 0xfdffec45d4a3990f, 0x4b5340f79e2ae2c2
+, 0x0537c8b7b3d1f332, 0x55292744ae35ee1a, 0x42336d0e6d057f1e, 0x5ac40e9e645cb3d7, 0x848f7b7f845e46c7, 0x74bda86736eff150, 0x891acf622baf4f35, 0x14bcef9cf39667bb, 0x9aa1354d9731b9b3, 0x27e855a19295e59f, 0x1a829a8e10662ed0, 0x3bbc43f9ec4437a7
+, 0x8bfa8b1cb1de5341, 0x3432778068d35549, 0xe3d807da41f25a48, 0x1bb6ee1ce2efe552, 0x08d9bded0bd3affc, 0x290f1c5299a917a8, 0xda8dfd79562f8939, 0x1bf7aae68686211f, 0x2ab6daf9bc860765, 0x7bef6e2f0eb58a0b, 0x8746faab7c439b94, 0x017ea87750bb8bda
+, 0xf8dfeb22239c9a7c, 0x35cec0d2887b3a13, 0x68aa94ac601f1606, 0x7470553f8ba61767, 0x37894f91c9eac410, 0x55b22aeb8337f732, 0x53f8d90f29a2fe94, 0x0aec068aec69023a, 0x40506162ad6182ee, 0x6a327ff1ac1e5475, 0x968d7095492df3c8, 0x3f93f46195f67521
+, 0x4983bca28970d546, 0x2716b931296b53c2, 0xf42b013266b6f8b3, 0x76f29b084b6a369f, 0x8e28749222216249, 0x4f2fa1d3a6c1acfd, 0x0ee66697eab8f954, 0x37c33e28fec0cce5, 0x7d0419e2bafd1dd1, 0x01f04d4299b94daa, 0x5ec06abbc1e5c7e6, 0x3a24c66060ed72a9
+, 0x0db764e15f960f26, 0x1d5973d5d59f9c3a, 0xf3dc2608dc6d9149, 0x1d80e0461b72f518, 0x2264dccd49c8b09c, 0x1f03e7a246334d5e, 0x2d6e38871b1fc2ad, 0x418588ae4f284bd3, 0x3efb071bafe1afa2, 0x0799ba0c80bdd8dc, 0xa6b273222dcc4a76, 0x13859f08ac8a4b23
+, 0x0194acc2663c5acb, 0x459fa55bd0bbedf6, 0x1b055550f06f8cc1, 0x09e5fad46599ea75, 0x6b3916ef772958a3, 0x4aaaa5c18093a431, 0x8e1503e36610f594, 0x620ef55048a263b9, 0x5a28963c8cb8ecbc, 0x6aee46b1b740c15a, 0x67e39606f59cfea9, 0x13a579e3777ca8b1
+, 0x45ad92f61cbb8de3, 0x53068a1a42460eab, 0x9b163546de379578, 0x07bf38a7cecd4860, 0xf84c77031d282de1, 0x402aed6399f78ffc, 0xfb83dd20295f6d45, 0x3702e257340d2ecd, 0xb8db2d8b979b97c8, 0x617526d2a50b0c51, 0xd86f6278313017db, 0x2f35eedec55f9d92
+, 0xeecb69493517973b, 0x7a111a74e0baf09a, 0xb82c6da8ec39f63d, 0x4217076312833746, 0x5d36d11f3dda88d9, 0x7baebcb360f2a887, 0x9829b62d093d6cbb, 0x10f17a2f6edf28fd, 0xfe3efa4353f40626, 0x731ca3065c118e34, 0x6185678827960895, 0x07f906a4f4c6355c
+, 0x361d9cd10e657142, 0x2b5f5d452dd861ce, 0xa3e01df05d04b69a, 0x533723bc4cfcc0db, 0x820384afa1bbccb5, 0x4e67e941595d8dfd, 0x0f8da50839e13646, 0x6887a0573a596968, 0xe93dd1df5ace7343, 0x0d4076f28ecf96c8, 0x0ba2f854988074c1, 0x5eb2a314a41a40b6
+, 0x49ff6d27a676b27e, 0x15f7ca40acd5114e, 0xc171f9a750d7da95, 0x3bedbe891f79eb5c, 0x5b643bceb83f74ff, 0x088b1af3aa331a4c, 0xde294c7e0a60c4a9, 0x0a0770fc8120b151, 0xf09b757a0c7c1937, 0x34b797c03efd9c88, 0x051e3edb2c28cc49, 0x66db34ec5ac5122c
+, 0x95fde0d3d3dc8cbf, 0x797897c8121818cf, 0x1fd46d197710f89d, 0x533a505803f809c5, 0xb60f1c090c9fd211, 0x4a7c3479af5c9d82, 0x4bfc3ffa4c8cf5a5, 0x6949f4a61306821f, 0xd814c949c67abcdc, 0x419a5e33166863c4, 0x9de646f6bd0895e0, 0x497cc1449a54545a
+, 0x69eb31247fe126f2, 0x323c83233967f477, 0x52e0db4d3d78127d, 0x42a0e188e7b9380c, 0x3a6b011c46e34e7e, 0x79f4168aa9a0b4aa, 0x94270a25d708fa4d, 0x2bb28618cbc9cdc8, 0x741e46bb04606819, 0x02790c52fb2ce982, 0x6dbb92d0c6d0af10, 0x32aa96ae061e9412
+, 0x1376700c90d98eaa, 0x4d1dfe650c0a7136, 0xb397f8eef89aff20, 0x4836ac4a041bae37, 0xf37c1076a80a02b8, 0x0d063fa2467b3a37, 0x498f2617b56b7e7b, 0x65ef1194db859a5d, 0xd1fe25d5d28ffcb6, 0x228ee6f49459c083, 0x6b7e82b3b009b15b, 0x713b185ef1fccbfc
+, 0x552468f1ff60c298, 0x2b7ba65d02519614, 0x8a86ad90ff0816c2, 0x7bf9249284bd02e5, 0x3008c56e474c2d10, 0x171473b77f804540, 0x15fb79d07bdea766, 0x66ac67c7b9b0951f, 0x34bca15bb6d2f652, 0x13c63dd2687d617b, 0xc515ae237715c19c, 0x0e543c6765fbfef2
+, 0x668c80faf156fb5e, 0x1e2e9e3b3d9962b8, 0x89ebaa264394e113, 0x322add21cf1659cf, 0xf9e6e26733619f8e, 0x723bfc8b792147f0, 0x79aef2837d7e092f, 0x1aa61c59290b5011, 0x9955ae576a499cd3, 0x2c3d6e6a5a1ce0da, 0xb864cfa199a8676b, 0x4961a21f1080285f
+, 0x828e184adf9d997b, 0x0c84bda97e7ce725, 0xe6974677094cfcc5, 0x4ec8cd773946105b, 0xa48681bcc95fb5c6, 0x6ade87f8f7a5f269, 0x9b97628fdd39c03d, 0x3bde0ee1f19f1842, 0x4ef8c8fb117c0ca1, 0x769bf8f8d07de9bf, 0xc8f5f435b78a57e5, 0x79987aa861bbcf9c
+, 0x7f6c557204b02022, 0x119bd819111c69d1, 0xf0c61ef00b3eb70b, 0x4317f0511bfb7b39, 0x36a2b944e84d608e, 0x1c1a3862da3369cb, 0x37dbf471085f1775, 0x3835751e107419ad, 0x04ab0c84bb07a3fe, 0x63758bfbc7df13a0, 0x15ffd20cb554f23e, 0x1ff11c442b1515b7
+, 0x171377f1bf937186, 0x615efe82b83538f8, 0x321e7cfae352a761, 0x7af02427d7241502, 0x86546e47f2cc559f, 0x65a1d8a017659d75, 0xc95d8aa5b8bfdac9, 0x01e887cb68990623, 0xf1f8ee8c466bcc3d, 0x40ce5e4f2ba3908f, 0xd2b81a3480c16b35, 0x51625d3eabf708cd
+, 0x44d770a210105739, 0x7f1de74a022958a0, 0xfbe4c91bd1e8f732, 0x204fbacb13586460, 0x97d79097d62e3cf8, 0x541ad5591934b114, 0xfdfb47919c141909, 0x354926e5244fdecf, 0x6291b0a0e2e994b0, 0x2b9a9a69d3a6c3d1, 0x8189be54302371e7, 0x3645c65df1a881cd
+, 0xdf0460f445e3877b, 0x7ea384dc52d0d26e, 0x0c2e5f768d46b6b0, 0x1f6e62daa7c5d4e6, 0xf8b026b33b2343ee, 0x2b7183c8767d372c, 0xbd45d1b6b6731517, 0x4ddb3d287c470d60, 0x1031dba40263ece2, 0x4e737fa0d659045f, 0x8cbc98d07d09b455, 0x34a35128a2bcb7f5
+, 0xd67a89186b67f7f7, 0x0485b55c63a054ea, 0x022df582b37cae98, 0x09df88e0b022d555, 0xf4d50a279431ad48, 0x136ee46e04a83bf2, 0xabcd31432b41c5ec, 0x044f332904b55bc6, 0x67aba8511ca39aed, 0x09aa9b5b6879a44a, 0xfe504440a2ffe51f, 0x3393b3789df24b74
+, 0x7c1b49032f02d460, 0x4d963d715a2f9b6a, 0xcaf608ca35ab8a74, 0x15ecd2c7ce16b48c, 0xd603443f7ede9274, 0x046085b00ce83ae9, 0x838540f05e037b98, 0x30eb0ce4082340c4, 0x424b0415d3a2e1bc, 0x4b0694d50e59d33e, 0x42e28cada0fdd5e5, 0x35412f0347c740a7
+, 0x8e238126eb2191b4, 0x3a4817c4981c4a44, 0x0ea417bf90729c7a, 0x53f4b39a0a96924c, 0xfdccfea0d55a2b76, 0x7a50d61f77f02d5b, 0x1f9efd11d5e3cd5e, 0x681188f6eb609c63, 0xd42c785c237cb980, 0x6967f35e77a9d010, 0x69936fcc59185cef, 0x3228a5a9e2dc5fb4
+, 0xae3d773e171095b0, 0x4ec2c51ccba19209, 0xba6280f9d7b86775, 0x1a0bfabbff287607, 0xf02a2adfbfb174ac, 0x51c629e551750875, 0x344d1111fee7a42f, 0x261d1b2a993db0bf, 0xef47e45b4f95b354, 0x164cda1e29d6662f, 0xe38c4bba25026cec, 0x31a2bc3a8d879c77
+, 0xaf64573183574465, 0x43ea015306db32ec, 0xca237c27c2c35216, 0x3fa7a8a7d8703c74, 0x01dcb7435801ff5a, 0x2738b3402a0c9ccc, 0xd491abc8e0a6b715, 0x0fb804f567699e80, 0xfaefab5a929f07f7, 0x43ad6cb7e2a703c2, 0x0d1c7cce172ee8ef, 0x17a5531ced786ab0
+, 0xbc590e52c0293bc4, 0x682d0f1109fd485a, 0xe0c0bf60301dc4bd, 0x5f802eb572f2b825, 0xfa23eea474501f01, 0x6b64c705cd840588, 0x6e17128b22ff936f, 0x41b02de52f49734d, 0x841756c656120edd, 0x0431503876e11e1f, 0xfe2c6f7bac8a7dd0, 0x4c895ee389e3dfb5
+, 0x3677d442d9d5e5b2, 0x3ee1f140008cd86d, 0xa0f3a0ab784bf0dd, 0x04c41174968d6980, 0x087ce5a4824d472c, 0x405caa5101af47bd, 0x92846aa3f1ba5a02, 0x4be85c1a0293fa01, 0x75468f60dabf0e39, 0x7776b73bc624b11f, 0xc4b2de550c485e7f, 0x3effeaac0b12cbf4
+, 0xace065e8a9f4d8b8, 0x6c934fef46752ac2, 0x080d9d3d94a4c1a3, 0x17c5e39bc2d1f839, 0xfd98f8efa7b13947, 0x3aca8fab8506b3e7, 0xbe294c27f74f704d, 0x35122ab222555996, 0x79e6a88af867cf4b, 0x30550a6f46a766ca, 0xda8251a837a1c0a0, 0x4aa3cbfedfbc1bf0
+, 0x41538bf9877677ad, 0x12088ce4700c0277, 0x17ca3056d9242fcd, 0x694b91316e093eb8, 0x229d647fe167d6d8, 0x1c44f58451422e23, 0xc30cafb8c9883dc3, 0x58a285569d459f19, 0xdf64c1520ee25f08, 0x0133bc9147c7fcce, 0xca072b66f37edcad, 0x22dff316f98b0bd2
+, 0x8a5737c6d770f791, 0x76ddf459dc6d3475, 0xd60755994a314329, 0x3e4938123cac6ddd, 0xc19bd7a8b9052ae1, 0x54a0773d3cadb0f5, 0xcf99a525f9717866, 0x3425dc15084a5e77, 0x87526c1ee454d435, 0x5d8100a33b69fb8a, 0x256dd35c1a07c098, 0x6fbc19f1aae91cb2
+, 0xf593297a07f8acc4, 0x4a09c89cff3f98af, 0x7dfa970768f31f11, 0x5661eff49cad194c, 0x720a4d87ef663aad, 0x759a92c430057f94, 0xfb69dc211a9ae865, 0x69a987121f413a03, 0x1d03396044f0ea0d, 0x1b0dbfe6fe71e284, 0xd4d44c10b577fb1c, 0x6f10d16400c9cbeb
+, 0x84b17a64da2cff84, 0x3867a8851b393881, 0x77343bddf8676d18, 0x19ee638bf7ae430d, 0xe6e75e5e9c06ba80, 0x6ea4557c2b0e7b33, 0x05f876dd49ace992, 0x2ba836e4cc9cb80a, 0x1081d1987da94e5d, 0x1d50aa05d4cf0950, 0x29d45fe7b4dea54b, 0x670e231fff930dff
+, 0xcdd6c99de11cfead, 0x10edacced4287dd9, 0x0d55c32380233432, 0x4c9d26acdac27b5f, 0x9e6ea7ae80a4e2d6, 0x3f5dd1ca9a56f417, 0x46467dd5b1e461f6, 0x6ac4fa1b0b9bcdb5, 0x8f963f5b101385fe, 0x62823bf962d11a2a, 0xdadb2192429974fe, 0x443c2c5fd1be864f
+, 0x73f37e751f6df995, 0x42c7257c4609bb2d, 0x24618a492a85f181, 0x30b332043d173d0c, 0xaa87789dd48c9738, 0x338e08e98f355af4, 0x3d14d02ce67911ec, 0x13526eef2ae1fa93, 0x23081a055a9364d9, 0x791ef50fd26249ab, 0xc019457f10b210d4, 0x5eebbfd164430b06
+, 0x3b2c203d725a1879, 0x50959e7d692c309c, 0x0e312816d2d6f46d, 0x024894453733f0ee, 0x620d6085187b9046, 0x5a3b229fddce811e, 0xff8b6e35ae8d22de, 0x52afc2c3c8b5212e, 0x6f7a38ba98aa12c4, 0x41dbc83af80ac0bc, 0x06752c65b6592d47, 0x6d95ba30a23a4b64
+, 0x5e97608020150c62, 0x4480afac52d344b2, 0xca2df3545444d6fd, 0x2f05208a588bb440, 0x1cd1f8ca1f3c8496, 0x2b5e47c79b3a9e93, 0xe979e5c369cc5d5a, 0x127c10194803931e, 0x84233f92265a9b9e, 0x5bbbaf2266cc9df8, 0x24897d733c867f78, 0x709aa9ea62070961
+, 0xfb3483a51d716a41, 0x5f2d480e3602b8e1, 0x3c2041eb28668c4d, 0x7ab1bc25d1d845e2, 0x29082acb789ab2f6, 0x6673823262dda8d0, 0x82e5c85191258354, 0x4f9215abd498ccb6, 0x5bf63d4e914352bc, 0x395d932ad53ffec9, 0x6e69686c89f79027, 0x3cad197c14a914ee
+, 0x3a131f66acdaa173, 0x748944a67942f741, 0x100e12cbd9c5d461, 0x2b08cdbdab077de9, 0xb43adb7f4bb30164, 0x3a8bbd50668667cf, 0x5e76da49857c793d, 0x5cefabca294566ca, 0x951c88332a2964a4, 0x3c1fcab18add8d20, 0x3d7886e0885c98d8, 0x5bd1eeec5b0d8275
+, 0x6ffa6d00a30c5cf6, 0x44e4d3961e479536, 0x0a758e83b33c0e14, 0x146cd6d694910a12, 0xceb7cb2e09eace00, 0x6d207cca5b0efdd9, 0x7a328d9a097e532e, 0x59161455cdee3f66, 0x9f35df4953f9da49, 0x150b00bf7733e114, 0x762b6c1413eb0a1b, 0x1331f12c4fe12b7e
+, 0x65e8025a57379e1c, 0x17c81359f58a6a2c, 0xd4cd086d55601f05, 0x42e3facf4cb6c341, 0xe1df209241d4ac46, 0x488b93f7bd1d2c4b, 0x220d66141cd4e2ca, 0x7491ac6415d8362d, 0xbd9a3cbbb1305a64, 0x491c7fbebc448ebf, 0x4900a62207ca9357, 0x15184e9f5640e308
+, 0x16ec832c8dd1e253, 0x1ae60af4a41f5c0b, 0x656c4f5ce68a0c12, 0x1d47f396f68c3191, 0xcd49f904aad0639a, 0x3f35e94836da4294, 0xe64ee736ac164802, 0x21e9adee26b6097d, 0xbda0a99b5127b21a, 0x50fde0459e478550, 0xd2c7d14f68e8b103, 0x33037b72d00c3798
+, 0x4407cd87c7168acd, 0x2dbf34bbdc15910f, 0xd1370a845f9047c8, 0x0f0a6f349717d3ff, 0x8d1de038273e13a9, 0x33b69e5af0c76777, 0x8b58656ad053b569, 0x3a3832efa59ad7fe, 0x193031555c282ba9, 0x7a25531932656c8e, 0xa1ad229fd459ddf5, 0x2bd4348cdd1476d4
+, 0xd9a5b35fc733ccb7, 0x2fdb6bd44e3faef6, 0x9a3832020853a924, 0x4784b4f426d8097e, 0x70aad7b350cba76a, 0x23b8d642b9ea4f38, 0x02af4177bb74e44e, 0x1b9b70f9f54a4fba, 0x495897be2c610b69, 0x41d39bd169c6aef2, 0x9d9f3af7d3a11f73, 0x7b3b7c0df77781e2
+, 0xa88ddc1c1680bae5, 0x239dcf53b45efbaf, 0x686aee245a2fb6f9, 0x34f67fe12e2a0ead, 0x28b731da126fe656, 0x42dd29c93edac13f, 0x282bc50a3a53fd53, 0x365167761affc28f, 0x20ee25c7c5ed96fc, 0x579adb216fcd0f67, 0x3c3e3e3e48c9823d, 0x21454ee564281655
+, 0x2ca792cd5bbee3f0, 0x4cfbdf90bda61ca8, 0x77bda89226d0dfb4, 0x2f6b325fb1218424, 0x7688f8af204f8c2c, 0x2995b61f82d2dacf, 0xe4eba5b54f33df50, 0x6d6ff0af382cfbc5, 0x22525b4f393c6a82, 0x07a30614f1f45870, 0xbb84bbe9647696a6, 0x4a80f44ae153c4be
+, 0x3ecd4b44d702b106, 0x7fe6994e308cfcbc, 0xc464fa54262d0d52, 0x5639074618fba5bd, 0xc0873500dedc163c, 0x5b5b2cf6435cc9d7, 0x875692b16bb23d2b, 0x0339653cfea5892e, 0x76d652edf3391937, 0x2303e50f13c0dd4b, 0xc6e0dea98c00dcf7, 0x36ce7a7d691384d8
+, 0x2a74265adf0fa018, 0x21d0bfdb8607d277, 0x30a8d58ea244a8fe, 0x5fe2f04fe9e29944, 0x3f081791cfc697b6, 0x2e81df72c287915d, 0x81ea68b05e08b819, 0x32b01921cb49e0fe, 0xabc6e53d1c9ff301, 0x24467f42c69b54c0, 0x2cb55ad3eb27e9cf, 0x5fe44b6e0bcf7ee3
+, 0x74c7b252a4bef6b4, 0x2f88b4683a596998, 0x0bf0bc74378ee067, 0x0cc12a3d1b4ccabd, 0x912bd345dfaf692d, 0x4482fece8d4f0eb2, 0x9b7c405da76fd229, 0x0c9fd89964829ae9, 0x893c42bc0b44f460, 0x5f6fe79d1c618dac, 0xd286b589e619ec5c, 0x11ee288dff7a010d
+, 0xd5b5a99a5e900241, 0x7293fd29a04a5b05, 0x6727bf1b513603ca, 0x0d10afac93973967, 0x6b0661370efec579, 0x03e0703febc95a22, 0x0b538d75ece57f1c, 0x19e93fd11700a217, 0xb1a73a67976a1c0b, 0x3efcbeb6b561ab7e, 0xac63293f55e6bea6, 0x1582d956e87d6475
+, 0xc6256b406f005271, 0x30e3182227639503, 0x80357b817de099fc, 0x467b1182fc510c21, 0xcdb2fdc53977feee, 0x2564570938cba54e, 0x9437387c93dd97de, 0x52dd2c08d9dfd294, 0x9f3c237749f2de2d, 0x38b32d7c1b96c9d3, 0xeb001f34db28ab66, 0x07c1872b3c6e0ea1
+, 0x54bb1af485256fe7, 0x634b757039078d41, 0x2a66db3e09c71865, 0x0ba4e5ff6aaf5101, 0xd32e8a3706898f17, 0x56e0f2649aaeb630, 0x60879ce42b317cf8, 0x6f590e37b48c1a46, 0xeb98f1f349e8cf8a, 0x707bd0201358e60f, 0xb07eff1ecb135469, 0x4e1c76778d4d3442
+, 0x848cde605310072f, 0x22790d06ad2fbef9, 0x8ddc87e725c4e284, 0x42d60844bccdc857, 0x8ab3f232f7ddfd51, 0x51d50fb2611f9bb1, 0x717963c51cf35ad5, 0x146312f207a29420, 0xe306136db2361ce8, 0x4c7c3b7ec34a5f68, 0x6eef6a14cae316d2, 0x23bc0e00f13c3e4b
+, 0x18f057d3b1478cd8, 0x1845241a7903aec5, 0xab37106769d0c58b, 0x7409357dd2124a8c, 0x23f0b0bf926253e1, 0x25b914f44808330f, 0x3b906d7b997b2057, 0x36f4f1651c0c99fb, 0x866a5b72f7c92dbb, 0x2977aa5b7bc689ca, 0x87d3853527e71e7d, 0x144a0143601dfb43
+, 0x91ad6dc691c35927, 0x5c415a5f845f10d4, 0x1954d805a9a12649, 0x6a406108bd25631e, 0xa48f2bd62ebc6182, 0x730128774f395641, 0xd0609ef1c4c4726b, 0x6bfe854d34fc634d, 0x83d63e8edb3b172f, 0x5681d2f133f10bb5, 0x1f37d54d26c42a83, 0x524570651fd3a4b6
+, 0x40dabbade9a8f8bc, 0x01352967e13ac97a, 0x21ac469d42fcdf21, 0x6a00c7fa19009fd2, 0xb3eb9a2b8fbbfb4c, 0x270235f1a3a08871, 0xa5d9bf4db80fa8cf, 0x0b7bfaaa96143226, 0x4de1267648f15a8c, 0x1043998cb5a9187e, 0x0fa094ac9ac26f41, 0x49d463def26a3a6e
+, 0xbbaba6632b33a977, 0x3981fd3196989f5a, 0xbd8cbc5b445eec5d, 0x79f894ed4f96de50, 0xb8ae04360b853164, 0x75ec7d4fbab3e459, 0x031f406cdfa7db7c, 0x790db708421e7988, 0x646e0e4bf2789f6f, 0x5dbb505b90fe6d4f, 0xb5d76b7edf5405ff, 0x2085c160dfb35b8a
+, 0x9d3538acbf00d12a, 0x4b2cf29faa540624, 0x5a4d3bf383e8c9ae, 0x2a3be7d14e2963b4, 0x124c4a42af9ea837, 0x5cf20fafabd3d421, 0x98407225613e6ed6, 0x5f3852127fb654f3, 0x38c5447dbf8aecd3, 0x1d8bce347e7b7419, 0x3aee545443900f12, 0x36d0b83fcce2d38d
+, 0x1c8efc6a864f0d52, 0x70058bbcf0e148f8, 0xf35de2c2d04b6ab8, 0x1b023439f9810abf, 0xaf07806f0076d7ab, 0x65ffc52697207783, 0xb8b5a31150de0f3e, 0x5b54ab4c1c9a6e7b, 0x240175b97d8033c0, 0x1c75253c6697ed40, 0x5028a4f3ae676da8, 0x6de40ed708eb0562
+, 0x771594a461273a3a, 0x3c7c6103da43fe83, 0xca230bc761cd797a, 0x4f1433f4e13fbe23, 0xb96d4adc6244d654, 0x3b8d4b7c16c63d5f, 0x4a4f7a499b6704ed, 0x3e602333575f53ad, 0xa832096cc87007b6, 0x43d59756f19abb8a, 0xe163f65dac934243, 0x592191ef69ad3352
+, 0x1a9a3c9b5ed96e7b, 0x23634d4c704ceb14, 0x9afd328258949bce, 0x515710d5aa479f5d, 0x932e3bc33b67164b, 0x49d73ed1521a38b5, 0xe303e5063781471d, 0x3e3b83c9ab627272, 0xd342a6cf3d4dc46a, 0x28f2c0eb33bac3a7, 0x43c69a848eda2bec, 0x719aa7e3e2375d4b
+, 0x2cb816690e5bd082, 0x25e4c2413d3e4399, 0xf4247cc3b1db0eed, 0x214100c7bfb86b63, 0xeb08d0d7f1aa1588, 0x69a98cc5df5f87da, 0xb92f5805f396f2e0, 0x79618012ccb5aae9, 0x2fc5471ebe5733ee, 0x0ef2d971ef3ada47, 0x22ce51ae6ba76604, 0x1d1f9b945cbebfa3
+, 0x9a3b13808fa2c104, 0x1e3baae38ad76aa3, 0xc875d6cba937a82c, 0x5a5d7e5afa1f52a6, 0x82e4162715172616, 0x062c8f6ae66d0877, 0xdaa8d0522fa8b5a7, 0x25309e085a83660b, 0xca483b78359abb0b, 0x69f0e7c88d60161e, 0x967ddf5f76882b8b, 0x51a47e201f2d5873
+, 0x0f3c6283e9ad28bc, 0x200656f5ecda6721, 0x2344aea3c49eeffc, 0x37f712bed1b9de9c, 0xcceeea0c833d3959, 0x56abdc4950e5c0fd, 0x3379bdb93fe56d3a, 0x43d2742b47e4c5d0, 0xc9b9435d40332aa3, 0x279ed7b462d81b09, 0x08a3b8b9a2b4ec2f, 0x68666274ddc52b36
+, 0xd5266d6f10aa172d, 0x7ec75c72df9e362e, 0x784e6e4639db3bd6, 0x4100d4918f7c30c6, 0xce3fc9ffe6420ef6, 0x5c5d9caabfda54f2, 0xbacec9ba34da4d42, 0x3920c75dba62ce7e, 0xc537ee4c47ad6b9a, 0x7f55be2cf9c48a16, 0x8cd2be1e3b87d08c, 0x786e07044b17514e
+, 0x5c520d83ca02307b, 0x627a9f5b709cb7cd, 0x4715b718c5e8b842, 0x3e4318b466aa540f, 0x41391a24a0336fef, 0x5b3c67fa4f04d19d, 0x74682e4e3bdf9d3e, 0x29353bfedbf24d93, 0x6fea3b7322c146bf, 0x145a2618194d9ec3, 0x295beb9e89d7737f, 0x4abecd8eb647dd66
+, 0xef94f46a5aa1037f, 0x5ad33ef5a2175391, 0x7db04ae33cbc745a, 0x0f693dc62d4cba0b, 0xdf3f039742a50766, 0x5228c031041e2982, 0xd6908ace068d6158, 0x3c8f441f154198f1, 0xcb62e135d97dba0d, 0x72b31012f3986b49, 0x579f46c10a12b735, 0x65a9fa6fd9e56c25
+, 0xcfc7f251806235d9, 0x4e7603571baae9e9, 0xcf9484544e3b7f83, 0x4fe4a243423a8677, 0xd2c14822e915c635, 0x70967f6d0e81b9eb, 0xfa1d777893fc9ccd, 0x7e43428f7dc33d07, 0x8c822de44552f04f, 0x19285896cbbfbb85, 0x785be210860d2c14, 0x0f02f261a28e785f
+, 0x3b46fff788a3e058, 0x39f0b4c758ea11c6, 0x9dfe266eb07a2fde, 0x2c601adf9b7908fb, 0xb45e9bea1f7b1437, 0x1096fa34f47c5322, 0xbcb9db48b9f1afa8, 0x498870e976bd6e42, 0x9fa52748d0abf717, 0x648ffd57e5d4b08a, 0xd18287d4809fa32b, 0x7772a0c1a2960eb7
+, 0x063d4b1c8db70e73, 0x60a46604bd1ca8fe, 0xa11c3c1b95745808, 0x515df1eb3caaa14e, 0xb652fa0eb01dcac6, 0x23a9ed15057ccc7e, 0x8f57477499fddef5, 0x50b43044da918d8c, 0x49bda4d7ccc45174, 0x09dadb66362317c6, 0x8fa4d48b0b7f1d88, 0x23626375c88d66af
+, 0x6acdd0733eaecd53, 0x04714381866d164e, 0x0028a72d5bd2376d, 0x36ce4b04bc847def, 0xeda06eb5a21ac758, 0x098ac81e84e2a615, 0xcfea29f33fa8fa78, 0x2268605dd226e3b8, 0xbcb74c9eab87386c, 0x273bbbe02b5ed9cb, 0x2d53e12fca470a93, 0x6ba1c99ae7464b2e
+, 0xd4e00d96bb3a68cb, 0x218cd51a781e6529, 0x4ea8444591988280, 0x10b022430b4f6310, 0x4e110725f1603a4c, 0x3cb5a5ed8bf5f866, 0xfa4e7fdedde33b28, 0x322af3f92c972021, 0x39def0e031c467c2, 0x46f1d8607ef0827d, 0x1304ff8adeb266d5, 0x04cb47f6a893d1b4
+, 0x7475cdcc92449e76, 0x6acbd24538257813, 0x7492c25404837d2b, 0x2582556aeec8215c, 0x4c43a61a7537f738, 0x398d48b9e6619a7c, 0x7f8141fdabc47c85, 0x1fabb53613c08df3, 0xa4ede1f9930da16c, 0x484a8a8a6ee50bb1, 0xd38dc372b6b595e5, 0x3c35fd019fb4bc90
+, 0x5606f63a79edba12, 0x4b96b47ad37f52cd, 0xba6140c019ca5a8f, 0x079ffceaf4881610, 0x960a5e3c03025575, 0x1139ec7fb4942595, 0x4ff4d051d8cdd809, 0x37db0da92128d1af, 0xc914f376f8050aea, 0x25354e7e73a00e7d, 0xa0754ffca9e529ff, 0x5f7333ccaf828746
+, 0x2c42a10907b91f9f, 0x43a678f84686344c, 0x56b1a9bd859cc422, 0x2dce5ba18d1e261b, 0xc1c02e0e4c955e91, 0x4543b9ce8321e389, 0xf6a6b5a8cbe9425f, 0x26a7b71145162c2a, 0x5b02a4dfef429551, 0x24f10eff5e8dec3d, 0x6f14e232c301f1b4, 0x17ce4066286a97dc
+, 0x5f05199155709eaf, 0x442f15d70950b7c4, 0x5ca3c4bc24596dc8, 0x2ccb133c4cfdd6c1, 0x9de20a3d02eba87f, 0x326040c6bf489696, 0x601a6b90044ca6d1, 0x16c1b3eb05faf208, 0xd09c433593f6b56e, 0x70e3147bbadb909d, 0x08df6f784a224b2e, 0x5e43788ad1799560
+, 0x6a232fa2df4a68c8, 0x3c1ec888a5393b69, 0xca5d1e0327781303, 0x67198f1cf22e163a, 0x7a5fed4f31f6846a, 0x63f8b0585e2fa55e, 0x6a21eca03fa4e704, 0x71c86b0c79a788c5, 0xf92c88660715a121, 0x5146ee8ae1e0ca69, 0x079cc67e9158d93a, 0x7beceaf6631679d5
+, 0x7eff2166c5ac6796, 0x6eb157005dc9f783, 0x01b8a4ef520caf57, 0x0a068e8879e68ea1, 0x081c780cbe29edfd, 0x4a98ea3964316f5c, 0x32256f7b4c9a70b6, 0x04050e320f71b673, 0x2dca4fa4e30703d2, 0x40003bc25d390136, 0x71a586d4d9742239, 0x14b58655dd77a50f
+, 0xac08e8fb4da1cd24, 0x0a669734d19462f5, 0x27e2064c539be056, 0x274fc60b4e26139b, 0xa593b78f5ea0a044, 0x4121377d467a332b, 0x46ff296872aee8a3, 0x0d4dbd03b7ac1077, 0xa8fee2e915bb493d, 0x3a9d7ef30c6aa2e7, 0xd728e8c93c38f64a, 0x2dac12fbbcdd7080
+, 0x9c4fec727b5a7bc8, 0x0b65e510740b2782, 0x6cd07ca5851e6970, 0x27f1108e0c34f7ac, 0xb2ba9911f21e23c0, 0x5feac5ca0845beeb, 0x5c15d858137f27ee, 0x1d56afdf2cf28059, 0xdf3891e64ce711a6, 0x0328139f4687cc27, 0x6672fd8076a74c7c, 0x743794ec6d0ccfca
+, 0xe9484d37fe4fdbe3, 0x17d2b895f82955c0, 0x91900f689c23643e, 0x63431957f5edc3ca, 0xc87ff8baaf6d138e, 0x2af895b51144bdbf, 0xf32bcdf84302d2fe, 0x2ab99482e6e02fbe, 0xa04b99b843a1fddd, 0x3414e9ef555e2f32, 0xa8d96deb66267d00, 0x6f152f7ba2a2af4e
+, 0xb7dafb1e400c173a, 0x64c3f10a19280d27, 0x608aac08f92cb059, 0x58b8f5d012b2f542, 0x3cdcb8872a1dcadb, 0x62a63f626fa20af8, 0x54ce496bf1165753, 0x35084dd4ed9d0ffd, 0x26d2f179fb345211, 0x395ce21a6ed03ec5, 0x89ccc454a36ea97b, 0x5bd104744b9ec7c6
+, 0xad9d4218a38aeaf1, 0x53b8061a84035f8e, 0x17de798c4408255d, 0x4699d84ded818be6, 0x5837417e6600ccfe, 0x6cf11c0e784c3b63, 0x8a27cb0c172352a5, 0x0a0ec0fb4d056efa, 0x14e325a223368115, 0x06178ddabb834eb6, 0xac6f2e74bf147d9d, 0x11e9dec6cb9d656d
+, 0x57ad53b15a1f91b0, 0x28f598d5de3e77ab, 0xef0cfc015d29955c, 0x6372cd483199913d, 0x592053a9c484200c, 0x5704477ee5416d30, 0x41145be8efb476d9, 0x3083013cd7f517fa, 0xe345bb34397fef85, 0x604c73a964c203de, 0x8391a8f9a60b1ca0, 0x5b734e89e3b67a35
+, 0x19bfa6c31289b6be, 0x2815929227694f74, 0x92d3d8a68efbd809, 0x09e881acf9c0c261, 0xb9a0781496f4e39f, 0x5581ec5611079d45, 0x81ae6edf4b34e06d, 0x61fc67221fe9e4c9, 0x9fff2c972dd824a8, 0x354f0669fd5ae564, 0x56f8666c273fe91e, 0x2f120409683a7c4c
+, 0x150acbc7fbdc82fc, 0x5a2fe5e10109c9ef, 0xb74db2d5b7304a4b, 0x7f59cfc3c7bcae62, 0xc28a6c077d786439, 0x552c9087a69affca, 0x8a22dcca6cce167d, 0x203a5811953747f9, 0x04f424bd7facf7c2, 0x706f3f0a95747749, 0xcf4a500a39140092, 0x6759d3628cf83516
+, 0xb61aaf0f90607504, 0x7425e61e5138f355, 0xc2914464c50d3cfd, 0x0ab314b43c1b2170, 0xe92eb82c565cce10, 0x58bebffc589057e7, 0x2b54939f2f84ade6, 0x2c06ca35fe7f7744, 0x52233e5fca1f7efb, 0x7481b1511bbcc007, 0x63c12ce125a29573, 0x27f3204077794ac4
+, 0x8bb3cd4809f1e113, 0x3f301948a834c2ff, 0x29719e6b3f6a5374, 0x4314c95cc8e8e31e, 0x042578645b80fda4, 0x10df072e1752949f, 0x38f34d21624a7ffa, 0x780dc8ae72073f6f, 0x39e4ffbee81c4a1a, 0x07bec8bb2f1393a9, 0xcfa171d3863954f2, 0x7dc12c54adb3bb6b
+, 0xf69ab92f4dd7fb2e, 0x4b92090d0be17fdc, 0xc22acffc82aa5f02, 0x64006c71b525c72c, 0xd7f54375182c6826, 0x32fc2493beec7622, 0x5e61e6d21d41bdfb, 0x119e7c07e84179dd, 0x1229d279cfa58904, 0x2571b1158c796f38, 0xa6ca84dc03d8f2ab, 0x4b492f7242fcdc81
+, 0x4f48f9b87981954e, 0x05627dcee5723768, 0x03b8433c51584d31, 0x70c297e86ec6276f, 0x177472f66c3aa842, 0x31f52b8fb6dc9fde, 0x9952313b4d08d75b, 0x4de8e318fce400e0, 0x7e4777391386ce74, 0x123c11f5928b472c, 0xc134df88074dcb25, 0x6a134e1cf1de3426
+, 0x30b028d872cfd935, 0x1f855de0f1a3087f, 0x7dd599e75baf910b, 0x35fd1d74ff7e3e3e, 0xe705ca4f409f1c99, 0x4ff01c43aa040784, 0xa680817741aebcd0, 0x53047c42ce85ea21, 0x224119075c5c0f77, 0x7a85566aa2d7a604, 0xf92fa88b47b4d8ab, 0x2d6d06a43b961043
+, 0x9b61ae26a9180c09, 0x1cd7bf61920d2874, 0xb6a11464bea3ec1a, 0x0a512d307419cde7, 0x9f27a92d2883d969, 0x28b2e73b611edd73, 0x03923b10257326e2, 0x059098af58d56cee, 0x6e290ca71a19bac6, 0x7869d07dad458535, 0x30b889af6ba9e701, 0x14fccc56644b895b
+, 0x583f264eb0fd5d43, 0x140e8eea51ba3a85, 0x39a2d38c7e23ba66, 0x710b180d0dc8a397, 0xfe612af9534b5d10, 0x0309fb1707c12940, 0x37921603e172c410, 0x1d9f14dbc709e675, 0x14a59573c1f3fdd5, 0x071360c44b4f5ae7, 0x518e10114d15f6ec, 0x7b1e4de585a07783
+, 0xfa26b91b0dd0ab3f, 0x2b5139d5d48b87fa, 0x7b9899213ce898b1, 0x1e2d051c0e975e69, 0x0fcde1fc0cad9cc3, 0x3bbf1d7c9feb8af5, 0x26b36529b9bb719e, 0x1eb40acc44cac453, 0xe543b84570adae57, 0x4f012e94b7e8017a, 0x3618c6c7f63d8412, 0x7b97e210506e2089
+, 0x333ddceb36d3ab00, 0x0539e29df384edb7, 0x724a11c6c83c3712, 0x0cb2927aac2060ef, 0x0df27015eb3bc329, 0x343cefc361dad1ea, 0x5f2135cbc9134d86, 0x350dcf743b82d6e3, 0xbfb52c8f86c78aa5, 0x3f81273a8af0f13f, 0xee6c9d80581571e5, 0x0da4ad00bc82cd3b
+, 0x70c878cd04ef399d, 0x10bdc31458ca76f2, 0xec4db12ac7f8c70a, 0x2072c598cd88d3fd, 0x920c4dee92caeedb, 0x661c16467e84ee09, 0x3fd4e602df3d05a8, 0x24335a3be1564dd9, 0x8b037b324c1e98b2, 0x371ac8b28c94b01a, 0x24ef4520069dad68, 0x247cfc7a710158da
+, 0xb0bb04e386fd846f, 0x2b82119ab6b146ff, 0x6268613cf547be61, 0x41737c8376fbb15a, 0xcd7aad84382dbcef, 0x284c49eed7b6faf4, 0x71ff2b402b7ef93c, 0x64c938868a7a7bba, 0x39e16c5d7d59f525, 0x1ae05f85891727c7, 0xb7c4dc5c78528fc0, 0x4d7bff60b293891b
+, 0x856c781212bc31c0, 0x3248ea6e87136b25, 0xa2e80ef2f722f684, 0x63f66e144b5fb9be, 0xdfcabe46f75df570, 0x79ef7e3c8364c877, 0x974832bc31c5c416, 0x400366a6ef44b00c, 0xdd08b2c3f6f78afa, 0x7b9c2f2c16957368, 0xef3211569fc3dbae, 0x3cf929521f08f035
+, 0x3cd56f04c591fd0a, 0x1d29c9142bc8c4bf, 0xf15e6118f8ea7f7a, 0x0a59153e17d714f5, 0xdd742a649b5a6f3a, 0x11c7d5732272bd73, 0xda91bc456cffa836, 0x158e656f6a7c7988, 0xa97924792040218a, 0x56bc16fbdbe83f41, 0xc8c42e3182afa814, 0x14689fc3eb87503e
+, 0xa18ff99a49aeb265, 0x4e1aea0a17a20154, 0xd93ae43dabba1251, 0x6c1391967153c76d, 0x5890d1ee450504d1, 0x7e1d59805dc986df, 0xb0063fc5dcfec273, 0x4bc0b28973473276, 0xadc36cebd6386e58, 0x3a4bfe72ca5f7901, 0x864c6ff2b3195c22, 0x51a7d7b8c3df4f9b
+, 0xb647830f02a29d98, 0x3ad07066f48fc054, 0x3e27f883447e7cf5, 0x5c4c4431b2d8077c, 0x4d4c2c248e4d5f59, 0x1e3e192167b2cba1, 0x5246834def92c068, 0x79d6e3b17fc17509, 0xa709487a39e9daa2, 0x5d006fbe23ea1beb, 0x98173deb40c6b793, 0x7a2f447c724c4918
+, 0xb06c590d4ec886ec, 0x5de372243038cf0a, 0x17bf817607435724, 0x2f07417d538b1434, 0x31e1fbc6d3470f0b, 0x7d815311ac5e946e, 0xf9be9a60ecac393a, 0x05d92490799a6ae1, 0x16205bc8d6443bc8, 0x1ef72341746910d5, 0x923c13c35767ad85, 0x4bcea1dc3b941fc8
+, 0x8c95b42f0829b5b9, 0x3724b8d23d4086ad, 0xc4d0e2f5c3722b58, 0x4dc350eaac17ca2b, 0xe911be1f0b815e30, 0x60688819f69f2470, 0x7639fcdc670d5ebb, 0x102b7cae5e1ab12c, 0x8d2b9ed59a116422, 0x4174c5381d3dd303, 0xa81eea9e5cf19945, 0x0993389721bd7bba
+, 0x4e9d228ced658c86, 0x416fc5878129efc5, 0xdc96ab3e4872c36d, 0x5a3dc1b1146df901, 0xce0118e89bb59b34, 0x71256524ee4ea949, 0x682967a477e77249, 0x187d56efe807d35e, 0xb39718e730a7ee21, 0x6cba8923fca2342f, 0x2f9b360436f7e815, 0x32d2ffe22b0a8a4e
+, 0x26c3e965c4fe1d2d, 0x31741e33c1d50b7c, 0x9f031b30fd64f0c3, 0x5ffbaa90782d76aa, 0x1d9a49a8b62380f9, 0x31a0869c06e8a7e2, 0x19cc60dd1eb8171d, 0x6d28b5fc77f82313, 0xe409095379da4319, 0x229f0efd2cda03b8, 0x6263ec6bb1ed6f3f, 0x571c553fc3fcf79a
+, 0x838acfcd030beea5, 0x03499c1f257d00c6, 0x0f39a5ae279cd90f, 0x405a1b305f848cff, 0xeab21da74b659da3, 0x4702493f81cf3e8a, 0xcd3e811c9397960b, 0x33a306f63b59068c, 0xce46ad87a9a7e9c9, 0x327fe8b4578051fc, 0xf06493e88c0c7a24, 0x6c5940c78eb99eae
+, 0xfdbd5c76590565e3, 0x7cb29ca3722c8de0, 0x6ce1376daf216707, 0x5a5089b309d1ce8d, 0x5dc5cf7d886e7af0, 0x273f2e94bccc0ac4, 0x5bdf478f71731b41, 0x3d4247baf258902f, 0x940a4b03a4a46d1e, 0x593b478e114a1d38, 0xd34e49bb0484762b, 0x5f7ec57f91104af3
+, 0x265dd4d83461a776, 0x518e7965dc64c296, 0x34589cf56ebb9296, 0x5ebc36539142f970, 0x99d969859064bed2, 0x1c15d165ee186333, 0x4fd6e6808801bc75, 0x4d7951c613e7cc29, 0xbd2f709ba07deb04, 0x26c7bb8967dbdb13, 0xc96ffe79a07a93a7, 0x5568d0800000ec8a
+, 0x5a2bfb3d0d7c5618, 0x381f7afedc6390b4, 0x82d598c1945030c7, 0x4355f44e0903cda1, 0x2dc46e4374bd8905, 0x10739888e4f91947, 0x2d35ed148d509a00, 0x108fe50ac977fc5a, 0x21b40ffdb5a1410b, 0x510cb24774f171aa, 0xc87bfab1e0c5720c, 0x6aaf76e70c4e8f8c
+, 0x1a0d2876cca1b24e, 0x549d85bafd5f4008, 0x2163110ce7ee057e, 0x42f57f474877dffb, 0x26ae54fb47d2afce, 0x6b3abc566a8f1bfb, 0x0cb096d82247376f, 0x30c1265c45106bbc, 0xdf01bb3c792f74f8, 0x23c8912ef93a014b, 0x59bdbe2d1a225191, 0x59c0bda1fd259646
+, 0xd8d338f2c988787d, 0x2ceebd6acbcc82f0, 0x5c0da37976ef3fae, 0x012414481c5ff0dc, 0xaddaf128139b228c, 0x1936a4199e189b42, 0x8355d214b7d86d07, 0x45dcd346279b21be, 0xbc75f29626e1fd33, 0x4e6b87384f97d79c, 0xdddb58e4f37c9233, 0x1bcb9f0e1e363b46
+, 0xd714211b6a6d6bda, 0x2f6d96d8b63bf4fa, 0x580f4a1ece1814fa, 0x6d9b72a7702dce6a, 0x7c99db0817df5b44, 0x70e5ab82c9d57bc0, 0x12b266ba406e2285, 0x41deeb33aa449fba, 0x322c332e423c593e, 0x345809bfc8a5c43a, 0xe59a975d2087db1b, 0x064858afadc632dc
+, 0x340c233ee7a113c3, 0x0d1d39a1cb489220, 0xc578a836eb686419, 0x4e29f750ce20b7e4, 0x69a05eca7ef159d7, 0x3d8cd689ca2e7f84, 0x6b67f6c92ba18ba2, 0x4328193331d77513, 0x0de01ad400b950a9, 0x537bea46f3c7cfce, 0xbbded244bb343161, 0x7dadb89f764e4ace
+, 0xc962d84ca46859a6, 0x4357d578721c5993, 0x7f38d015a21051a0, 0x44f6b144ed037d24, 0x6d788aac296a190d, 0x0be74a4f93e36a2f, 0xfc3c02374ce39496, 0x3da4961f9bd30149, 0x2a2aae3b5f3f312f, 0x7daadc1ec7db645e, 0x0d58ac686e26607b, 0x430003e5845736fc
+, 0x0a43bb45d6b64301, 0x55ed09b6a6d67251, 0x929f04c863d8ffed, 0x6e2524ec10d4f29e, 0x995b5c808ad37e8d, 0x4b330fb7e57b30fa, 0xc18aa16604dca829, 0x2a1f4c4ac5937869, 0x2463cb97877a3525, 0x295887a6fed763e3, 0x93056c3f52efcd9e, 0x059386921cdee89f
+, 0x83085891e70eca6f, 0x1b6f6929ba213443, 0xae877c5f00474b6a, 0x594de5b450c2bee2, 0xfaf77f7dff8f852c, 0x3fb589e10f87d86a, 0x3d4add08bd276392, 0x081eb79568e0d0eb, 0xdb488e76c524f4c1, 0x08b965b53db2dfe6, 0x71a8cd3f76bad4ee, 0x4fc66bb79327ed74
+, 0x0ffe30d7fee55de5, 0x70bfe4c6590c454f, 0x8cef675d6bd6860e, 0x087cbc36081bc39d, 0x613dcdd0d2a3a2e0, 0x55a1f09b8590c928, 0x261637637c3d8078, 0x26a5d290f544240d, 0x0472eca0fa6a11a5, 0x11003d1dcda25b4b, 0x20209535657ad0ad, 0x5cbddfb4cc77897b
+, 0x66c6c03683ef7b71, 0x5c74b71e856e0728, 0x913d9583d9946069, 0x7a6f2326ec786d1e, 0x065a08282f4f9dd7, 0x32a8c2a579e69c35, 0xff20ef8442effa25, 0x119e7be71dcb7ceb, 0xc438ec1198857927, 0x7399003f5b1c38b2, 0x6acf8041960ef3ad, 0x38091a898f4c743f
+, 0x233ac75a2215896b, 0x0e80fe374621f75e, 0x8269849263c2e11b, 0x64cec9300cda17e6, 0x92bfd7ff9a9c572c, 0x61097d2bb2487b1e, 0xcbf035685cae7034, 0x3f25b58d12729899, 0x4aa1435c450e97c0, 0x116e778e784ab955, 0x359632239ac12b4d, 0x29689fd900171ba6
+, 0x0c424195837904e1, 0x305f2e4069143902, 0x31bf838a25d52239, 0x7874a7e3050c5c9c, 0x646429256aee0135, 0x7fef38fe8db3ebb9, 0xcc78dc8fd5eb3d4f, 0x4252648143f71c62, 0x4403e81d13c8d6bd, 0x18414dbb96c73bcb, 0xbfc339fb2021a7ff, 0x7b5de53fd6e00229
+, 0x054e4a3c2a8ba76b, 0x31d30e83a333a0ca, 0xa5154036efcd906b, 0x7ea850a4f43e172c, 0x3209a79b0bddaf61, 0x22f11b5b474cd695, 0xdec4f6321dbc1afe, 0x14752848e7d2dd7b, 0x7f0664d31c303891, 0x39c575b8e50d0cd0, 0x81461f2df47adc1e, 0x7e4c647e68069256
+, 0x1679654fd5af05fa, 0x31ecd714ad2e7bdc, 0x63f6cb2743c13cdc, 0x01f173f778537b7f, 0xe5e18389589bf850, 0x569b5ac0be02d930, 0xbab2caf9e723ceac, 0x39463c68dcc11d28, 0x5750c85870e35f1a, 0x1098e7aa812216c5, 0x1508c80fb22d25cf, 0x587ff40d5939f293
+, 0x1ad5d04baee37703, 0x1725dce507948291, 0x0f292521643a3eb0, 0x086bed64b587c220, 0x48526065581a13de, 0x0fa0d127d2b37752, 0xed292160d90a74bb, 0x2c106edd0b736adc, 0x5e340e2e558f3c5d, 0x7c577d93c315b1f9, 0x33743e736a6cf2a8, 0x4c24b91e4358ae26
+, 0xafc63a16e5603c0f, 0x28279e8a0b10f429, 0xf97da6ad3bd2a2cb, 0x7083f0688f0a343c, 0xee646f4e78cc428f, 0x415b93c16928d3f8, 0xbed868ff20610485, 0x2c7eaa3b07088d8a, 0x2751c9eaf52b7933, 0x4587c0262fe6fd15, 0xf1f394586067f288, 0x5115806874ff1b03
+, 0xbd2e5553c9ec57ad, 0x1cdb3a866e49ae40, 0x3ed055312507f28f, 0x2474a2a3eee79de3, 0x216da5fdc9a28440, 0x3935f9d78d741e1e, 0xa870d0556d6ebd2e, 0x7c8b0a4ca2475faa, 0x8271836ff6374c6a, 0x792ba4e86a54a492, 0xeb41cb6371cb406c, 0x3d424b27e35b3a4c
+, 0x9da6556742f3cd6a, 0x279c27759e832c98, 0xfc8c3e9dd011438d, 0x68193080900e0758, 0xacabe0bcd34ed000, 0x2acf1b381b53bb4f, 0xdd032387e0de706e, 0x548337a03b077588, 0xc26d24f1ed31fbb9, 0x7027e9e6fa9316cf, 0xf0bffa8ee45848ba, 0x2fbe917f8f46492e
+, 0xd1395f80c85f6e46, 0x10387c2784c5a919, 0xa480c5175c4c5598, 0x4de6a044e0152653, 0x19edd2038630b0b9, 0x2c93c68a261c96a5, 0x8c4e98efb7e70dba, 0x27ab3deac91608d3, 0xa476cd34b8c4a380, 0x4a9b1b8cf42b3de0, 0x45a4a6e1d9bb0fa7, 0x4e8dcbd3fd56f307
+, 0xf245ffec2ebef3aa, 0x07ec15a540d74cf4, 0xed7ccb38d49d2a56, 0x709a18bc584bc8a1, 0x19235b9e7e45f30a, 0x7e40b6b084099e1f, 0xcdefa9e601458a27, 0x34763381e6c27d8d, 0xe1d8ff7a6d3f1659, 0x372f229b93d7404d, 0x196fee581b580da7, 0x09996950e1a273e8
+, 0x530da0adc4126378, 0x78a936733c423848, 0xfdb1daf6377e85f8, 0x177022386673fe1d, 0x22328acb64e23719, 0x0ecb42b8498c7cac, 0x1ee6dec866a23b83, 0x4f316404c8ac32f3, 0xc42013634621894d, 0x3cfc63564db3814f, 0xeb3ffa11ba146cbc, 0x5728b12cd84b21c5
+, 0x861e857aaac52037, 0x14a8894b3cfc830e, 0xecc6ed81fe737651, 0x1a7124610653e3a3, 0x425433d9645fc145, 0x4db9249cd568aefc, 0x8629100b71bb0133, 0x6d9e6a8fbf5057e9, 0x3f839e599f095fe7, 0x25c738d313bcab30, 0x9ad5648cabea7654, 0x151865c42a2c514a
+, 0xa34a8542a1d5eea5, 0x08bab0caf471e0ee, 0x26db9e4596ec19db, 0x5ab0002f0358405a, 0x22fb92c4e166503a, 0x5def417c167b76c3, 0x8788ea02c3fa19f3, 0x4d043b6a380efb10, 0x2bd7b82e6858939e, 0x5c44c14aafb92023, 0x082558f58ba7016e, 0x1d3b615ebf57be02
+, 0xccd3558a39a24bd1, 0x7cf135a7b9e6cc21, 0x54556a5821dbae32, 0x64a1c56b8f58c5d3, 0xbb1b29eabf48a3c7, 0x062de4af0ce07316, 0x48335ff89ebe6529, 0x7f4aeccee0e3f5d1, 0x50d684efb7a8b5ad, 0x4740a4ff3ca7088d, 0x643bc86f0f32de6b, 0x65de3a0aad59374b
+, 0x843eca66b31276ce, 0x14bb77c44467d05f, 0x8c852422a826f9ec, 0x2b079e33c7c36418, 0xbfeb546b3e8920af, 0x4b611ed1c05623a3, 0xef08b6ad45c856e9, 0x2c605c4074fd52bb, 0x998a3f3aa0307faa, 0x053d9414f36c8a6a, 0xda430f0b3c411aa6, 0x02ab36c84366e6f0
+, 0xdda5ef86c6b2c8d8, 0x5d3d64f56abb1f93, 0x4e6a3606d6e3cbee, 0x63c6eebb7e98f4da, 0x3933fc4419343d14, 0x22617bdddde80b64, 0x8b95e003e69621f3, 0x20b9dfb521f3a689, 0x3ccc4333e1237a01, 0x036a4a5cc252ccd9, 0x284d40b794d41d9d, 0x03be9743919ce8db
+, 0x4c16532ae59bb222, 0x0ec7510a9feebe29, 0x469b1b8176810829, 0x4e93798cc1355f3b, 0xc29d8b1739f9a2d5, 0x5b30d1f21aebc0ef, 0xbbcc7bf12efa7bc0, 0x79a1639010822241, 0x335cfc50bcecbfdf, 0x5dfcb5f1e984462c, 0x22c3029ce7db0c4b, 0x249cca758d7e1650
+, 0x362e83d786dacec0, 0x64bbd2b389bd57a5, 0x84c8752524a644fe, 0x535f4f067dec913d, 0xe8c302324ba9793e, 0x18957c201b871741, 0x48fe233a6b8e7788, 0x07504ebe3486b480, 0x8403d8aa373a8242, 0x0c845625d6174fd8, 0xc6059513dbde3131, 0x70ce15f26707934b
+, 0x0a51439673656c6a, 0x1842b8635d81bc2a, 0x7f90950920950932, 0x196b83ae5ae13146, 0x7c090c1a07d86fbf, 0x19d479bd8d5e6da0, 0xb7fbcf0ad1dffd29, 0x5a6bda4d5469e1fd, 0xc8345638c56b6cc1, 0x37ff936eaaa31305, 0x9a86bf7308ab7314, 0x05fd39ee290ca592
+, 0x9b8faed0e206626f, 0x36874ce534a544c2, 0x53d30f7ffc0e5354, 0x7edff7bb0389461c, 0x321c781b4075fbbd, 0x258158f35a6d06d0, 0x03eaeba905795afe, 0x4ac174c89d3cff97, 0x793f20bc289a1820, 0x592356d2001ba34b, 0x9a538786307c99f5, 0x597f30848f6cf49f
+, 0x7d6e1e01691f5612, 0x02103b5cd320e027, 0x62bdc85a6809032c, 0x16044d077634a47d, 0xe038e75e0bba8d09, 0x61905ffd45d053ca, 0x7b2523cc74e3a143, 0x3f8746053bbfe7ec, 0xba616b862c0d6619, 0x5000b3789d533065, 0x079d5c055f06922b, 0x6935e066f730d606
+, 0xb0b7ef3b7de2dfde, 0x1163c3ed79303a40, 0x5dc8108a73c22799, 0x3b24eb0e26342518, 0xe2fde4b8267dfe45, 0x3f714e961fcc2002, 0x674b1bd9a7341a60, 0x52ed1fd62f766e01, 0xcbf0d442af91850c, 0x7af69d740a3981b9, 0x5abb2800b575e31f, 0x46179ad385da0f69
+, 0xd0f980ac9f7208bd, 0x3815476d2986bc02, 0xe5c1384cbdcf5d32, 0x1af4f73dba459507, 0x881eb9f9b4731897, 0x440d636040564b4a, 0xcbce8d66c3f7b4a6, 0x0e78c6b7c8f59c08, 0x0fedb24300f9894f, 0x0919ef224effc09e, 0x852a2172c7a1dfe9, 0x36a29c364be071f2
+, 0xc6faba1307cfc92e, 0x227fdef28781cafe, 0x548fddfe567785b5, 0x6fcfec76087fc021, 0x44456d2dc8cd6cfd, 0x194d951a27536193, 0xd8e37fbc6e8c3977, 0x5bef29f884529eb7, 0x6194965e0429f2de, 0x297e626546df2707, 0xb9bb3ad6b2a5b973, 0x676c96a677b70518
+, 0x72eaba6edfbc4c10, 0x4a04aa56c1a50b24, 0xcdc89b393c1ffb06, 0x404689d27ffb247f, 0x4cb20e95de1df992, 0x6218d9634b26c4f4, 0x8cd6f743643de3ed, 0x4fb96737f99c0b1e, 0xea716139a907be12, 0x32f8cf4d596e9c46, 0xe11ba226499dc44d, 0x6319ee79adca8925
+, 0x9329af41e73e7937, 0x55ec16bdcc341e03, 0xd6873ee4f44c7799, 0x77282822096957f7, 0x0955b96906a7e8ba, 0x57be37c3bc20e467, 0xaee772957f295eab, 0x0d43631ce35c61f1, 0x9b9dd0907ed5c8c6, 0x41943eb15f62cf9e, 0x99c863e8c6d4b686, 0x7a67577898694895
+, 0xc5db5e22afde12f8, 0x2de7c7bd2bc4510c, 0x909a3b98873eaaf0, 0x1233976a9a283eb1, 0xeb9d81da05c7e596, 0x2bc3f68e100e5292, 0x78a4a3484cc203f0, 0x27e549568f026237, 0xa993e2dba9bc6b26, 0x5e23dac38eee8b31, 0xb4ff5570625d82e4, 0x7b08697e0181725c
+, 0x93948336dfec86f6, 0x2d7e30d1366e3064, 0x544198bb87ee4f4e, 0x485f901f3aced4b4, 0x4eb619d885a4364c, 0x33931225c3e10214, 0x7caceafa684ae851, 0x4569b36c6d988faa, 0x2ee8333cf7071814, 0x1435ca31e3e880e8, 0x2414557c81121c1f, 0x45ab58e699203eac
+, 0x0dac03b26a9adcfb, 0x617fc210194ec4dd, 0x35b2d2de4ddaaf53, 0x40a0f8458e246f2d, 0x8e4e0ded281539ed, 0x2193f779a03ef7ac, 0x4f2a366207db9274, 0x7f57199ef3a60601, 0x64c64c83306464b7, 0x637a924333a69120, 0x8f9272f0abb014fb, 0x0da220721e9f4476
+, 0x9beb46c2c2b20b58, 0x1713305c61a83a44, 0x2f37824a930d1010, 0x75f8f03fa8b22dc7, 0xa759f5a7189759a2, 0x2ba9f5c20f8628d6, 0x4d18576aa1d9979d, 0x47318d8299bfa344, 0x1dbdcebe8241ac66, 0x36a450d309311212, 0xb25ded41e5e6bf4b, 0x56c051acefd474ac
+, 0x15116d75320c62c7, 0x6e75c9b676050396, 0x800569a4d618ffa2, 0x71fc0b33b6a1de6e, 0xaf930a0bd11f593f, 0x0069afc4f2621a9b, 0xe61fefac9b11071d, 0x36fe11c8cb806dff, 0xccf762aac04d1489, 0x3251f1c7e5e6ae2f, 0x8b542eba5cc7a5d9, 0x7b36b88a5d7bee26
+, 0xf40fc9b2b394e89c, 0x1d273397c0207c40, 0x60d5ef43149e306f, 0x2d6bfcc96afde3af, 0x1bc850c48112dc1b, 0x7cc89493a3771438, 0x9efce70e9199f168, 0x7b4665dbadc2c420, 0x031d35fd801dfd1f, 0x321fbc0e0f15f564, 0x481f5cc77ba4f6de, 0x442a91b90a1d94be
+, 0x2a8dd0e6fb5c7864, 0x6256ec3860f718b7, 0x42110b7c78834964, 0x17f94380c4c229ab, 0x291f89e6805d217f, 0x0f16034cb403caf0, 0x316a87bd2a5bd814, 0x4d566f80664e846b, 0xc3a181dbad9dc13e, 0x4bd83fd58e0116f4, 0xc1c7cf62036cc395, 0x4a3bb553d2514c2f
+, 0xdacc3e9538a62cfb, 0x6525cce0d7ae6a64, 0x01ccc675f98512ca, 0x741eb473a1e3a79a, 0xec9bea25d7b8312f, 0x2d6599de9a3439c0, 0x774c8ff8af394653, 0x4c5b7cd77a625149, 0x62b105845df21193, 0x4f76cf5c8c4f24cc, 0x6907cef230030182, 0x17fef4a1b8d16615
+, 0x5fba85654dc15ed7, 0x15124ba6d29f6667, 0xc1246a184a266b18, 0x03e7cb2b4368a5db, 0x88168fdd81e9c063, 0x7bb09b2bcd8eabff, 0xc64bb409e1f89d24, 0x58f6c368590070a5, 0x5439839afff56d20, 0x4019c0d51f44583c, 0x8fd936f62bf4d5c2, 0x6feaaa0bfa0e9ccc
+, 0xa10b18f29d15c683, 0x76c6eb81056362f1, 0x1b3bdaf1ce44ca46, 0x3f1d89240b1a1ea2, 0x1d74a1f9158a27e1, 0x1a54ee153cfc91bf, 0xe2c04c1cd0052989, 0x1a4c463408f5455a, 0x8b05db3b491b03c1, 0x06d78f5c8a2e1a8a, 0x6885d2cc00b48059, 0x412e1e02ee40b530
+, 0xf432d009413e429f, 0x231c37a55ee5edf0, 0x68595fd6c88998dd, 0x2025f7cabffb603e, 0xef6343b5f3e6d983, 0x40a98b2b412ab2a8, 0x6f9ba57ae3b4062f, 0x28d4a4ac3245fc19, 0x31f9877a0bc72a3e, 0x50c2d29c80678cc0, 0x379db883acf78c90, 0x6697c51aca8db6eb
+, 0xd2c7197def4b27c9, 0x13c986ad8e0d911a, 0x49360707c9933d8b, 0x6a5db007891cc793, 0x4d95453b26b7420a, 0x35f4bb0029b640ef, 0x3eba6644dd5048ca, 0x13b9c7caad1fe84b, 0xb2f78ec5d2f253ee, 0x74128da8adb27f88, 0xd1686948ec32ecdc, 0x27f15d0bd67357bd
+, 0x5aa69ebd00fbdfbd, 0x7e666ba19ac8a709, 0x99eb49b8ac0f27a6, 0x6757f0e8af2c3c80, 0xf65074ce23f789b2, 0x37c15fe3a767bf37, 0xc179ef84a43b6ac4, 0x2216b65a786636e4, 0x722616fdd840bc3d, 0x1085facd4535b212, 0x397d6f63798e1ab9, 0x799df1f2857362fd
+, 0x45e344b0ba82a814, 0x71ad78ea7cd22450, 0xf875cf55d45129fe, 0x34f00e215df53dd0, 0xa015278adcd96f31, 0x23c0595af0e45299, 0xfc2706989e2d1e8e, 0x2e3ec5437d5ee420, 0xede6e58792e7a519, 0x2de644e6f1002730, 0xb0948c193f0b6a2a, 0x73c6e476ceb4feb7
+, 0x40d3e825aa32ef26, 0x18bbb7ae5f27988c, 0xe5afb2338ef6fd54, 0x053653beb15242a6, 0xaac6e364faea2aac, 0x51fe23b56d00a141, 0x2615cd069db61859, 0x7d70dea0bff6cb1c, 0xa8f2eb70ae84ad6b, 0x5b1778d0cfbc3597, 0xf8ce82aa300e2932, 0x0066ccdb9f55f00f
+, 0x43b931861629d2b1, 0x53e88d5fcf3b6682, 0xc8b462bc6a6cdaf3, 0x01cf764eedd393cd, 0x66ae2370259e7021, 0x1f453db67bb932b4, 0xff6bc2912ebb3e07, 0x06c56be4d85e9bad, 0x94a1ba7d1b74ff52, 0x4e56fabb309a7391, 0x86f46b3ad6460f56, 0x2305d9e555f17f44
+, 0x8b309ae97be4cf85, 0x4098d6b0fea73edf, 0xaf927bff9bf32d62, 0x049963648308a918, 0x5a7ef9ae9e3c9689, 0x4de556fa74cef725, 0x32bc765b63d52753, 0x52e93202ad1c30f3, 0x8aad3b3bc066dd87, 0x3431d9bf9fbb6e11, 0x26556705ff12d625, 0x205f67626ce0a369
+, 0x4131ade56e831905, 0x0cacc746a859b129, 0xebfd9bc9554728b7, 0x10714a7ce31fce82, 0xbf53c72054a81313, 0x1593e5e7fa3f64a9, 0x8d6a3a7e6ab472ff, 0x055335b97c7a1f16, 0x29f77f0b5018b915, 0x7b30d66ef7017def, 0xec8e9cfc390d9a25, 0x35a2957fdca9c145
+, 0xa2c9bd92b1586fc6, 0x6c4b7eabba91d165, 0x475b815311d24e24, 0x2f76bd8cb1fb76e6, 0xdfdeb9e68f95b8b3, 0x1f81884131eaff46, 0xf4568587807326a8, 0x52b9f8bd45359c78, 0x9df89716ec9a2271, 0x2814f6c12a2d1021, 0x23fe158f9745db35, 0x75da0f9d8783b12c
+, 0xca10828a37247ff1, 0x298a0fbff668a029, 0xc89ef9ba62f50eb6, 0x17812dc4d9511782, 0xd0a01938c3597c42, 0x4151752893cd888b, 0xb20dae6fde53ab57, 0x5618ad1abe8deee7, 0x0127b46de8b4e12a, 0x3fa26b942b5183ed, 0xda879deea7a60b1c, 0x3c900c49a1459ddc
+, 0x582bcc6cc0666950, 0x1084ddd9a51d934f, 0xb0d9ec6cb2fda7d6, 0x185d57062c37a6b9, 0x2eaa3193aac6b000, 0x6c4f023b6f86413c, 0x1c6d95469524fef4, 0x235d8dbe9e943171, 0x074be0bf7bba3853, 0x2fe668140799ad27, 0x42f08a2a3549966d, 0x735709b21d187ab3
+, 0x886ca91dfd5241e1, 0x418a9db4359a8c26, 0xab049b55a32b4e1d, 0x6b542d8a0dd433ba, 0xb9798e643d211346, 0x782f1834db85ac48, 0x4fb5285a5c9415bd, 0x1352ffd83b971e82, 0x01dae6b531a986f2, 0x44f0db3f33787afc, 0x7df99d94baade360, 0x76a010ee1b245307
+, 0xac461c07e3c882e2, 0x633965b064ec7feb, 0x05070a8f6e8aec04, 0x7ae172353a4c0025, 0x4b8fcc9f63f3979a, 0x5507ae6a8245e5d5, 0xb3893d297774497b, 0x735624f0eea1c16f, 0x6cf1562f91d6e002, 0x7f79c65ed5deca16, 0x4cac605b2d79c2bc, 0x5d04676a3aea2d8c
+, 0xdf20b467129c9c8f, 0x5220237e2897e212, 0x3cade2ab0f24ed8f, 0x62ffc24ebe07acc5, 0xf5665180e8069069, 0x774e4f59500d88de, 0x96601836d1b02a4a, 0x4cd55fe4146d6c05, 0xf0059239444f328c, 0x7a8e27afb65caf01, 0xba8f59d38770c192, 0x62b47a27b29e66be
+, 0x7375eff66d58995f, 0x33a1538b649f201d, 0x4119589a6d5c6604, 0x425670ffbdc3f388, 0x26a17404a7a620b2, 0x29a97893a541d56b, 0x47f2ec9719eeab1d, 0x0017294fd3bed256, 0x1e632d9ac7eed442, 0x3db52c2a3c42333c, 0x9e27ca934a8580b6, 0x153a8740ea739970
+, 0xebdf33d54e631a62, 0x0ebb60b44ac35f9a, 0x36782b09489b2a97, 0x59d812c06f40e959, 0xb1a93d006224a286, 0x708558bb676ccc3c, 0xabd469be7dd11a5a, 0x5f0d5e6742dca562, 0xa98f886f4f2fee9d, 0x09949327f9eebedd, 0x94e8e94055e9d169, 0x2214d22bca5f13b7
+, 0x3c26835b7d745584, 0x5bca5cfe4efe97c9, 0x22373aaf911707ea, 0x30d6783fa66681a0, 0x1855ff3501e36e3d, 0x3bd6dd9991a6c052, 0xf810a2029280695d, 0x39c5dc0ccf7fca4d, 0x872eef2c931dc5bf, 0x2d1dc7043f9ef58b, 0x8f20afcbb0471d82, 0x2cc74b8aefad1284
+, 0x391d2a670452b6de, 0x32bc81914fd347e9, 0xee683937be2f1b13, 0x255cc61509e4528b, 0xd14ed7df57964fd2, 0x0e0e7352197ef1e5, 0xb7b545273925d021, 0x6d096167371956c1, 0x91f32cbabc50624a, 0x593746ed5130cd4c, 0x99e88b3720ea6d9d, 0x479f704e892a94ba
+, 0x4ceaa09ca8a9bdb4, 0x055728dee383ae52, 0x4a20c48a0180a8fd, 0x0feb7a88277f7751, 0xbb617b7be146d3f6, 0x0889a608a59e9d1f, 0xfdc0cc296c1e1b63, 0x022ebe884bbdab0a, 0xb2b578ecd8c1e1c4, 0x5bd9a721ce2e25b3, 0x16df3637dd8cfbdc, 0x63e5ba57c5dc0fbc
+, 0x12c27927c606c80f, 0x6b4a016dea4cdd33, 0x6fb0af1632414026, 0x12e19620b761e90f, 0xc4b685ee5be024b9, 0x12c533501bb3b3d1, 0xffc8e9b76905c440, 0x4a8607325ce9f060, 0x5ee8159de38901a0, 0x38080681a585536c, 0xf302d5017ae62fe4, 0x70fc28876a18eb7f
+, 0x6fc8faed36d50193, 0x057a20c0a5269f3d, 0x39a946d45fbd3728, 0x70cdb773594d9a1b, 0x980030a9001bbc34, 0x08dad0043dde8237, 0x1582c9c5524472a7, 0x4dbb791741bbb269, 0xddb71fca20fb63c8, 0x6a2891c96a131bbd, 0x684f1cb3b70bfada, 0x6c3eba207e1d7afb
+, 0x50ef78c22cdb7db5, 0x3e772df3596385a1, 0xb09faa0a803047ab, 0x187c7bad22cd6801, 0x13027053da0e292d, 0x7566e6eb62827e11, 0x5a5ed409737d4620, 0x572d8b1e5e7d3464, 0x9d7f18396077b88f, 0x3c309ec566ed938a, 0x0ebcd7d90ef45757, 0x7e930538d5819865
+, 0x29a6d7a4f90ba1f0, 0x7ff50189de101837, 0x32f49d04b1f0ed8f, 0x2e19dc47202a37db, 0xcbb30e8ac681f74e, 0x219939a9b5566a1f, 0x378a07e070b06971, 0x05b865667e1549a6, 0xeb2cf09540418a33, 0x4205104f8de7e52f, 0x772cb57dc4549ae7, 0x1a6c9ad2613ae866
+, 0x66414128974b8ccd, 0x02bf6be7527d897f, 0x81de4be1e2ea65f6, 0x6d85ed9ddeef06f8, 0x669abef077a7f937, 0x41274682d410b0d4, 0x6d04bf5e7d988a37, 0x27cc8f6823be20cd, 0xaf06b0b6df6ca2b3, 0x58efcfb0654dbddb, 0x285aa1acccf75fe4, 0x6a34779f501eaa3e
+, 0x17521f358500d596, 0x5137d7d2071e546f, 0xb798e86c34afd879, 0x6654c3844ffafe4e, 0x97b1c847c9b83d14, 0x30093b18ed253829, 0x86ce50108a120134, 0x58c84a81a2667f35, 0xb7112639a92a5594, 0x2a12d49f186f0901, 0x849096cd77bb5494, 0x605f7e82dd1e41f0
+, 0x99b2007b1b1f2fa5, 0x04bcd9d93001f9ce, 0xee15920167c0ed3a, 0x5b8c789b56c96e0e, 0x9aea82bf755da5b4, 0x2e20ddfc322d9ab7, 0x0ba3d8da08afc76c, 0x1e37349650df2b57, 0xd85a9e57ddc0012e, 0x6c199f4736def858, 0x67d2b906b6011c5f, 0x7d67701867a3ca91
+, 0x3133a81eaf1b80df, 0x79d3101f73eb9717, 0x3017fe8882ff53c1, 0x4cd835b5722c548c, 0x91e6fdaa899709d6, 0x2853fdd018986aad, 0x2700dade650a73ce, 0x1288f028695620a5, 0x3d5653a5ccddb7f4, 0x57be4b6c884fc149, 0x11a9162014da07fa, 0x5854f6f38da42fae
+, 0x65b2e4ad37c40746, 0x4160024b2d913aa3, 0xb833b826a6ab41c0, 0x36aa8cd78129a370, 0xc74882473418ddd7, 0x39a4b2288cf805da, 0x184d06e8f07298c7, 0x2dc2550803e83c66, 0x9727f5dba2b383ff, 0x503b224a1777eab7, 0x834937b40af85243, 0x13bdecee31d6b438
+, 0xe152759e35cbd328, 0x515e710e07596f4d, 0x9378d419313600b3, 0x62d190a0325c2bbf, 0x81368419b448a9dd, 0x1ce0d411d606636a, 0x23c710199e08312e, 0x6dedbde72c281013, 0x6807ea21d88a05b9, 0x4f01ba6675e22e55, 0xb81fe0efccd8abd6, 0x1cf2e4dd0891d0e4
+, 0xdbb6d47c8fe6547f, 0x3dd4d830a0264b58, 0x05c95aefee657727, 0x59e8c5a787ae2278, 0x1a7dbcefc597b406, 0x0107593d2e3886a9, 0x74da669b2c3304e4, 0x4afcb47858f44871, 0xf816742dac065ea3, 0x014f378f109f72c3, 0x151e22d30f6f67be, 0x47eb9066bcb3533f
+, 0xc1f1834c5f88a912, 0x714c21f525837af0, 0x4ea7d9f459f14b02, 0x0d219a85cb929715, 0x92b95ad6ecf9064b, 0x7716bb55e8099357, 0x11c77071e3ff212f, 0x3d8bc22b04ba2bac, 0x9dc90dae8d05d845, 0x1a93aea567592dcc, 0x0423fbd80b5a3307, 0x066a937c8fb1c045
+, 0x107c31e132e6c058, 0x0f34d51f66bfcc26, 0x7fa5b01424f548bd, 0x4dcb661646e7a08c, 0xb16a2674c893ec2a, 0x73a0892a30519a67, 0xa4d526d185084ba0, 0x7d9674b021efbf42, 0xc5ba2f66e70b31bc, 0x0f7778b5ea9387e1, 0x3df39263a0eef835, 0x344fb8f87e236a8c
+, 0x4351e50a46a3e0f0, 0x24d1fe112b7be035, 0x76c21210b9ad3574, 0x4c8d177d98ff03f8, 0x53f535fcfd40535a, 0x2d4a370f51dca753, 0x5ae46f9251fbcf0b, 0x50ce87769ea6a13d, 0xbb639b2a03498966, 0x402bf2b211018f93, 0x8ebbc440a22b2e16, 0x5cf860461a56b426
+, 0x39651480ac5faec8, 0x33ecfed23fb40cbc, 0x25e4954a2e8ca28a, 0x7aa255c4765e7d78, 0xf326ef527c8b2a86, 0x088c58ddb2418866, 0xc150852d227a9b65, 0x7266a5f0cfa1d050, 0xd861cf72ca8b6eed, 0x5e4830a9f3f8fbdc, 0xfa0a5de32060bde1, 0x3d02f6ec2c86d5ad
+, 0xc44b1720bce76429, 0x1091a3ed9cca816b, 0xb01a8bcaef3d4bf5, 0x76eea5ac45146a96, 0xc4bf6a401e6d0b4a, 0x62bb3b467c9106d3, 0x993942dabb0ebc6c, 0x1974a13e4b89b23c, 0x9ac85a7f74cb2187, 0x42ac1919f1dbdbce, 0xdfa66c017a2b2dae, 0x024cefd0b27fffe4
+, 0x79426c3ce632ce3e, 0x7ef4d2a447554a7a, 0xaf22ba3d7f30ac37, 0x3edbd83635f19d20, 0x4fcf8d7dda9be502, 0x42ff9742ec55bf7e, 0x33d62a6094240081, 0x7aff5a6e61a1312c, 0x964d1f5efcb7db5b, 0x22c0cfe6ea678866, 0x7fc6550bad787ac6, 0x308c5c10dd9258e1
+, 0x1c32853977ff7a3e, 0x1a553782579c15d5, 0xc4dd01d261795760, 0x5b4e9605d045cb5d, 0x462705c0afe81aa8, 0x2be68ee2cde0fd45, 0xa4ae86ef302e177c, 0x461f274abff05894, 0x8028bf93d08c6647, 0x466df32941d48217, 0xdf60081ea0860199, 0x3cc9886e504f1bb2
+, 0x5cc6e53ca2d31c28, 0x4c958fca8156c627, 0xbdfe01217a6def0b, 0x683bdb2b1f94fab5, 0xc171ba71c55d749b, 0x0cf1446a6f6e6409, 0x78a62c7841b9448d, 0x037d99e6f59f71e5, 0x346309340fd22334, 0x0336dca7a4d2db9d, 0xa352c486251d43ab, 0x06e9cc7aa67a8bb1
+, 0x7bb0406623fe76af, 0x5d29258345067810, 0x02642c7d1055ddb8, 0x1bdf297356dbc962, 0x15561ee65136adee, 0x049e5f30db996a34, 0xbe17ca9fd653b09c, 0x3341e42e034847c4, 0x115bb24f8b448f04, 0x697b764637e2cf55, 0x264a70c50c3de1b7, 0x1dd1aa9626c5ad4c
+, 0x0c9a5ce885328156, 0x7d511f6018b344b8, 0x3fd1c1879b58229c, 0x733c929c960f2d75, 0x95131c117cfb83f4, 0x24afe142b14c6452, 0x4466153a70a12ac4, 0x6dc474d882821600, 0x565b351a83354b7d, 0x1b07d0636c05e48f, 0xd498b66af6a741ce, 0x452f08b43982038c
+, 0x452add083a36d3e4, 0x1324284bf7b97338, 0x08915bbd32add6fe, 0x7ab3adb466890d59, 0x20343f45d2c1e423, 0x2f182b66c18e885b, 0x54063ef53381e75e, 0x255c8c7404f77a83, 0x84f29bc8db473807, 0x7d9c730e7a084da3, 0x10fce07e78d1c288, 0x7c00bb2a2f7f8640
+, 0x7550295cc2e8ef47, 0x5f37d0fe8d709b4a, 0x37724386436a42c4, 0x2d77e0cb9a30b536, 0x6a78c4dde7b350a0, 0x1643c918374b1c19, 0x199411d9f44096ba, 0x2b666d46e69111b1, 0x5a17be72d05a8994, 0x796d3f4216fa4baf, 0xcb300af8465f8558, 0x65a3fc2fcd1915f8
+, 0xaf1b7bdb71b9235f, 0x5689323058402267, 0xe347d97fee06499c, 0x3fe04cfb84a525d5, 0x481de15dcc17d851, 0x2df716b9ec47de32, 0xdc7a158336223fe2, 0x3ccc406a11d81aed, 0xda708e600d039869, 0x456e4ca2b10144e6, 0x8e2655ee8894ffa7, 0x2a3b74bd94ba71e7
+, 0x2d8e6092dffdcf56, 0x39857ce8d2ee2574, 0x23fafa3d8e35a9b0, 0x7cf5bba433236066, 0xdc8d661f2a572e8c, 0x4f4e51755f41c5b3, 0xcf0661139b2dcbe8, 0x7c7437299ca96fb3, 0xcf1ff6f9ef154f23, 0x2cb4fc1f61dcb74a, 0xb5ffd64875325c59, 0x4f2833f459859f1e
+, 0x88e45daaf690f21d, 0x581f8df26cc39043, 0x0d2110f1a94e8a1b, 0x569e4503553426f6, 0xda027d4824a097b6, 0x37e871b566ad1cc6, 0x233fa34b4828f2d0, 0x05acde1c4a913b90, 0x11dec9321f8292ea, 0x3501941b7d4f83b0, 0x46213e053f96538b, 0x78504aadec0118b1
+, 0x698e7758a72f41ae, 0x755520f29f65ab59, 0x874780d1bea6bd1c, 0x4e760ccc2642887c, 0x885f8fa4d11af4c4, 0x138185009f373921, 0x12b8685213050b6c, 0x6f64aeec639acf8a, 0xf7d12a4b6da77631, 0x3be1bbe1b236dd8f, 0xf0aed818f8487841, 0x54ea62df85e9e8c0
+, 0x62e4c5fe17becc20, 0x62cef1af99d947a6, 0x885241f75536ce49, 0x6b6ba88c9bf55f00, 0x7c5c53b1194e3f2a, 0x418b134f9baca4b7, 0xdd73574a4d50aa6a, 0x1cec73e279a5ef5b, 0xa5260932581ac561, 0x04eafd67d45bf3e3, 0x5666736bb7d7b868, 0x142dc5cc3e719a93
+, 0x4d2553ff1aba613d, 0x4c8a60025d33ee61, 0x3a117e1844508670, 0x7554df7898100b38, 0x79975a19454aad25, 0x115294c8e5b0c146, 0xc4ef9918c0a7a15c, 0x1a7987f894e22c53, 0x0a9a570762c413a3, 0x0a0a90417bc884c5, 0x32afbeec82668972, 0x4676ba5544ac5122
+, 0x6f9a45c3fa6d8d93, 0x24cd478489720dc0, 0x623c1390e9fe5b85, 0x05b39c3f095b2f34, 0x59d763241255a291, 0x662d2e0e0ffaf71b, 0x7e6fb4495d4be3ca, 0x5796cc95b7993e3a, 0x2ed34a14d3b9b852, 0x486bfa621ad3d529, 0x18a04e6a82bbe346, 0x04a4e504bbc79e3e
+, 0x97acbeb7737140c0, 0x37e866de3654f841, 0xac2e296db5b86e22, 0x686d898bdeebfd49, 0xd67177e622362bce, 0x2dfe301c21874aff, 0x39dc2e3e3963cf1f, 0x478c5419017b9add, 0x2f9c96720073aa94, 0x2a1a28d8d811d267, 0x2b589714ed6acc76, 0x54909369806d5fc8
+, 0x582e933f2a17aa92, 0x78fd6a4a4a7a1d8e, 0xdfff1acf6539fe2e, 0x36c57e6fffa2776f, 0xa88f33578286f082, 0x7abac06a5cfc50ca, 0xabc505c9fce7cd32, 0x665305eba608f1d5, 0xd210e50d4d7806a5, 0x453666a09d8d2652, 0x5746aacd51fd5579, 0x6eb39a556759b5f1
+, 0x9ae216669a31fec7, 0x30221f89b7010d55, 0x9e02dfab0aa5b17c, 0x1ca417543d351694, 0xe5814573ca41e202, 0x34afb4bbfc62bab6, 0x0aa97ab81351d66a, 0x7927aef7fee9588f, 0xd5d1128e8f352d9c, 0x0cfb6e4bad92dc93, 0xdc473c0c49b9404a, 0x1e081a4da1f1813c
+, 0xef91b534f867ff2a, 0x7e79fee32e9eebf2, 0x1eaa0f42c1732e9b, 0x209a54f297b05624, 0xbc9e7cc192c2d20c, 0x31b05bb045783612, 0xc74b9cda97a9044e, 0x430b7123036b414d, 0x79e37e26b730eebb, 0x0244adaa074a8149, 0xe811cea994995ce2, 0x34b5d3498afb735b
+, 0x7995d0900e31ef3c, 0x756573ff84a374e5, 0x2cf017e9afe1aa5a, 0x7f560a3c07e754f1, 0x458d5f2b763a710e, 0x3e3b4a1606fc3829, 0x8926e1753017e8e5, 0x068e330fb2a2c09e, 0xf04ecf9fee18ab65, 0x20e0ac857bc16b2f, 0xd6eb34e19a03b14d, 0x5b330a5142ce4cfb
+, 0x8db2484ac8b3f75f, 0x130b7857ba1cad9c, 0x49cd09afad05c6fa, 0x3009812eb4f4aa40, 0x3d46fd661b3c585a, 0x6d92f07067be4abe, 0xb170bf0c26a99a81, 0x375835fa15140a7d, 0x95ba8a71c516b59f, 0x12184a85ecb0e6e4, 0x1c90785b8f945ada, 0x7482d1e83c30666e
+, 0xeccbcd69eafbe7f4, 0x6340be2241b28acd, 0xce595e0d423f8477, 0x2af78a49083a0efa, 0xba5e1a3f255e87f8, 0x6f3e81ea24339310, 0xab8fa0a82d71db75, 0x21bbbf8d265fce70, 0xd4e54de3dd7e4301, 0x01fdee5fda18562e, 0x330f4a792442a8a9, 0x223e8b1ecf487382
+, 0x64d6dc915dc07c7f, 0x626388000fe988d8, 0xbdbd08867b7e248c, 0x772ba1d08c9157a5, 0xce6e651dbddedca5, 0x43d5876688fae885, 0xb31ed7490b9e4981, 0x6c0b9ccd76b9abc5, 0x43dfa09f106eedeb, 0x7f443a826e151ebc, 0x819bec2f40a7389a, 0x74e4b3ee0c57fb74
+, 0x968654fa4a810618, 0x7b6db630d55138b4, 0x9daed9e83a326e48, 0x43b67c0a4bca612f, 0xc0d697954d2fd2f8, 0x2568b34c15ba48ab, 0xc9b2cc92dc41ed42, 0x2350e5babfd57cdf, 0x05a862aa4ed07a18, 0x6a49d61299659388, 0x86369707519b0813, 0x6070fb824242da3c
+, 0xed01e37ca2902faf, 0x1173f938710624dd, 0x05e485c96ff0db6b, 0x0d0cb57f09bc9ccd, 0xa49dc5491aa5aa5c, 0x25195e531aefc52a, 0x00bb7bf97ed81f3d, 0x37dfccbe577030df, 0x19ec1cb42fc8d48f, 0x5fea5fdef46c56ea, 0xb1e3c75a9abdc416, 0x2b112394de6518c7
+, 0x0a40a5381bac6eb7, 0x38082aa247821c21, 0x8ba9021b24995049, 0x172dd27fac7ee791, 0xd2fe3e3b9fd71d93, 0x70b1cf7286d8c2f3, 0x8198766bc1f3d6e0, 0x42dd26706ead7b9b, 0xb038a0c4b5f7f841, 0x7fe630c27c1285f2, 0xfdc2558711ee6db3, 0x20c986ece4b5eb1d
+, 0x31ecf6c8465d9b37, 0x01204fb7e2863b37, 0x82fb0642ce1a88b4, 0x501369bfacda33d4, 0x2be15d64f3fd5af6, 0x3b0ea6cdab52eb23, 0x31c7069b87e91209, 0x6bbdbaffab5e0387, 0x51cfdeb17db70fd6, 0x7ae87d71137aa5d3, 0x436735aef9d4a8c8, 0x588a0f1abd283a51
+, 0xd7ea7c0a74b7c908, 0x004cf1ba02af6414, 0xff1a46b16650e24b, 0x43162548208ff878, 0xa69a56483515e318, 0x26960a716d195e0f, 0xe721154a8ae08bd8, 0x30a9ea5f65221b9e, 0xff208b1d961b6a7f, 0x62e6144cfff6ed1e, 0x4c8abf48f48fe113, 0x1d34002a08eb79a4
+, 0x4da9b0b081fb0040, 0x384d5a2aaf5b87d1, 0x30df06fb143f8aac, 0x65a1cfda580d1cad, 0xc09684139792edf9, 0x359cc94da3eaaf86, 0xd968b7706605f03d, 0x39f8dfb02e21d5d5, 0x69e25a1a4ae7104c, 0x549895f121a89a71, 0xcd0676f0f21d1819, 0x67179800c4affa64
+, 0xa27744401b24de75, 0x59b0e93a179869ba, 0x3323c9e26d29fa5e, 0x2655483ac92d9c19, 0x66cc3c0846636a07, 0x743fb420acd492f3, 0x016241ae7d4c0f06, 0x37aa372d52866fbc, 0x0f2ab0b6360691de, 0x5a2a711d64495ac0, 0x65b1fdc8d8d8d795, 0x2abf1c79a9fdf130
+, 0x61376de8d742bbda, 0x392485bed3bd0649, 0xda2816c8b4fba684, 0x4deb1b3498838c00, 0x84837ed3fdc0d6c9, 0x3af06d963b6eb0f6, 0x3cd11b5dc41d2895, 0x46282b8aaabf92f4, 0x1e7fab48c0adb7cd, 0x27adf97465971985, 0xc234d679095defb1, 0x7e0ecb641ffe8244
+, 0x449a59f2ab55f27e, 0x72ea0921b02c0ad0, 0xba7dd913de843baa, 0x5901c7815c394582, 0x543b2ac756014b46, 0x1e74b77f013bd39f, 0xa41a6b1159dd7e9c, 0x5beef50102c5ef16, 0x72937b814665d614, 0x453adb928da1d3d9, 0xcd962522bf9cf7e7, 0x4bc4a7d47a6dc966
+, 0xc7b7249840d76117, 0x22edda6f410afee2, 0xecd55ff73e549caf, 0x3eecf4b4674da776, 0x06d171cb5f04734f, 0x187cd1366ebfb9e8, 0x3a5e02584d8fba8e, 0x6e4ea40091a7977b, 0x4883e23f52a108f5, 0x29360a2fcaf617dd, 0xc994d653b03d52d0, 0x3efea8d174636985
+, 0x9e5fb9ba8b736320, 0x1edbc22686986dee, 0x0f0acd126049ac37, 0x70609e74c3e42005, 0x95bf0de1b10db132, 0x7c9dd24b0409c701, 0x4e2b258dc25678b9, 0x6b2b408281a6b6d4, 0x24978f771e50ccf5, 0x7e82733499547873, 0x207a102ff9c642d2, 0x091b5ddad992796b
+, 0xb9ac0d824947b677, 0x51eb71da849ee79b, 0x604896054b7cb2c7, 0x28f63ddc93713691, 0xce73d7097c7dc761, 0x21a627a7202ee4e1, 0x9d39b19df0733471, 0x5b7a23cac806f9d5, 0x14cb44629c694da3, 0x03f42bbe305129cb, 0x990ece516ebf7c8a, 0x2ac94e7fc72e38de
+, 0x6fc2154176b51ee0, 0x2f439c6c1e9a6560, 0xb37d47f4a9639573, 0x03e99917df4c1531, 0x40a8b271fb858838, 0x45b8a015f8bef121, 0xd5cb62ac5f27d589, 0x0dafe92061f1581b, 0xe8eaf339c6ce17f3, 0x26a4d19d529d03d4, 0x1073c0aee9865972, 0x4162e994e452f2c4
+, 0xd18db05d4cd3a631, 0x7728ea3d82e059ca, 0x90d3e81979071bb0, 0x725de307eb6f5840, 0x2814f5cf0bd5ec8c, 0x26a851d694baf4d7, 0x02b4721d4effc525, 0x260ed2a893905051, 0xf7559a51844e14e1, 0x0431a7a2200fec59, 0x957ba2a499f0827b, 0x4e91b022268fc868
+, 0xc469d66d3d09ccae, 0x5e63be73846c4a90, 0x9e7b9f0463fdad7d, 0x260926c68bcfa36c, 0xc018a1aea4a8b326, 0x158cc44a5ce17f1d, 0xb1e1761881393c46, 0x4f8012d005152034, 0x73b5d668cc8388c4, 0x64c28bcc02319c76, 0x4b4cc954e92b9c52, 0x090e0c0c8b89cbde
+, 0xc04ca98fce4bd1f6, 0x4945c55bab19c113, 0x9bd11b0716c31abf, 0x651914824d4087f5, 0x3cf4ace545c4aa03, 0x0ecceaad6c767ed3, 0xe960366393e0355d, 0x7d7c5cc111301d37, 0x300d45ffcabd7d41, 0x19c84ef53a0e4c02, 0xcd08b13d0e5f3d3e, 0x7c0775d777697072
+, 0xbf397b9ed12e964b, 0x2cbd31fb08a24167, 0xe108beb2b432e24b, 0x553950bb1d0bc9f9, 0x2d5b85350c36c281, 0x139d680e96a186ef, 0x535b8f8a012dc9de, 0x3b5a6a0f043fc429, 0x1c016b6a9f4f08a1, 0x5bca08293d32b13d, 0x3c3c6158fff494bd, 0x4f8381495403bf85
+, 0x284fd7a45f78eaf4, 0x73796b567659e101, 0x06e902524d658f94, 0x2f41c85751d3ad7e, 0x88d8c42d1097b91f, 0x19bf81b18c6c9b67, 0x21e5146914b54e0e, 0x10f0b29873754401, 0xa7693b7185a141aa, 0x5df967478122731a, 0x6a54322fbab1d000, 0x0d2e486160865c7f
+, 0x228c5b654e876712, 0x7e6c2edbef84e060, 0x1bac430b51789411, 0x480a27818acaca33, 0xe7e17989dad23116, 0x6886f1c2fe95321f, 0x739f2d5cbb1fa29f, 0x5c060d86ea63c97f, 0x38e644d0bce1de35, 0x1cf69fdced8e983a, 0x4aa524422b220cf0, 0x48217af6017576e2
+, 0xa5b55cf1520717d7, 0x373c151cd69387a2, 0xc1f73a9e20efaed7, 0x17447798988aa326, 0x4210e7b6e350b8dd, 0x0d44a80c7c552d3b, 0xee6d093a772ad5a0, 0x0d1fa2747d48b8d0, 0xbd25cf5046356d12, 0x652e956a9f8f7c9c, 0xde5656f6e4cbb88d, 0x552c5a4a68228511
+, 0x65ff5a20e94cf2ed, 0x3622f49d17cba05a, 0xe52f2cd151b780d5, 0x5c4f1866ad8286bb, 0x6942d9a0da502aeb, 0x2c30bc31f47fd0cd, 0x0cc8d3e75e970c94, 0x36d80f57e42d2ca8, 0xeba16c394c2d4d65, 0x3a7cdc0014462208, 0x3b12e901b9202da9, 0x0464e4aa70e4c8cd
+, 0x75201350de3c4f48, 0x009d25b8ecf08667, 0x5973178bf83c683e, 0x07bb9709568463c6, 0x949a98c45f467d50, 0x2cd3531b305485d9, 0xe2d0d1fcd865b693, 0x5385b087d94d793b, 0xb491eb3c4cdd8546, 0x7be38ca655884bde, 0xe7e3b7b9ef4d23ec, 0x427e0315321a7229
+, 0x55d42e4ce4a39206, 0x773684b239a9068a, 0xcd205102ca1313ca, 0x4bf445cb90555dc6, 0xd2fd0f072d5d2e76, 0x0ecc3d513d472a87, 0x9a59c240e73280df, 0x5b573c030999abb3, 0x1481b0c8affd2a06, 0x0fe3290d8dc61072, 0xd926d986eebf4198, 0x06652bbd1f07170e
+, 0x7312050078945d3a, 0x3fbc9e6093b2f041, 0x2253820236007db9, 0x7acb155f5b7fafb6, 0x4993d170e5cddb6a, 0x5d3f9af9d47e8b39, 0x30a85999bf69fe74, 0x0f3d0e50d78585c7, 0x8d50f2f8f510daa9, 0x665a8e09985ad0f2, 0x4ab9450a17a3fdcd, 0x795f0d65ae210cc7
+, 0x19ea4fdb13b06e14, 0x015f3e645c663075, 0xc400c9c215cc4694, 0x097d8387285055ba, 0x66360cfa9de44a43, 0x7daae7dcd15c58dc, 0x0301fc7f6cbda50e, 0x17c81f6dbbe02139, 0x73428bedc55453a5, 0x4c5b749c8faee44c, 0x8a3811f7b1a0ad41, 0x0f7c277953735382
+, 0xaaa4f4a24b222663, 0x32b919390496eaa2, 0x09c32bba60ceafc1, 0x2b9fd2f56d11e4aa, 0x67ac3aeae19c34eb, 0x0bce889664d281da, 0xbf997cffcb9dd1e8, 0x1c020f20745699a2, 0x13f4dc6a19830360, 0x3339e2d3f9eda85f, 0x85cb6027afb92f4a, 0x1339db18a3598d2d
+, 0xa6ab47d492b8f4d6, 0x0e8dccfc9d19ef36, 0x9619dbdc68d81b56, 0x14cb75a0fbae7b8f, 0x535d274d13ebec02, 0x502db3b390fef0bf, 0x54455b7334ce1b61, 0x7ef846c46241ed02, 0xaafe1271cc077eb5, 0x0045782f91e79d88, 0x730c914f26607232, 0x0aa415e214ff9b8d
+, 0x14cdf642e601c181, 0x0ff2934a3a1639a3, 0x400eab9671bb238c, 0x65e7f9a69a47ed82, 0x48d64106dbee1cff, 0x14e5a749f4bbcb99, 0xa94878e30b5202ad, 0x6406a975f3ba74e0, 0xa2f81a54577edeab, 0x4d2345feb33fdcd5, 0xe03d5a73cd400747, 0x7f9d7818e94ad229
+, 0xe61f5d37a57d45c5, 0x1495b6137763bf59, 0xdfbfee89943bc38c, 0x23c99a34f4192c4a, 0x7790c91c037c34b0, 0x604fc116fa9a60ed, 0xc2c293e845b71df9, 0x440cc7311c87b02b, 0xa3012bb97d2a5cca, 0x1251c842ffdf23d5, 0x7ca496baa1a8550c, 0x7e2186e0149f22eb
+, 0x766b313cc0e351d9, 0x543c5f43035d377b, 0xdac18032ef7e44ba, 0x7c97c222c0470e11, 0xf27f600229551da2, 0x6e4b93860c59acfc, 0xc40a564421ba5041, 0x102d35ef09654dc4, 0x668be12a1de24f94, 0x231bdf5c778e495a, 0xe3f1144a5783cd30, 0x37ba65589adb0616
+, 0x8358fd7ae46ad4c5, 0x13719ce6baea901a, 0x8b104bddeaddd23e, 0x5a715268ba982257, 0xfd7c536f5fd99a49, 0x00535a7f3ebceba8, 0x83696a686d7306fe, 0x218bd7680e26567d, 0x4ca73707f7c5ee06, 0x69e9a88f5f44061a, 0x31f9dc78656c652e, 0x1f4185612d006b6c
+, 0xf866b63a2c628027, 0x092c4bc2b3c423fd, 0xe990cc8c88fd1519, 0x7e49281e0b736c7e, 0x291fb83c70e04bb4, 0x272466ea44756010, 0x146927402eaa3dc3, 0x397801be33d7ef5e, 0x5101097ff9725033, 0x32d8500838c9b011, 0xb4bad729986369e0, 0x1baf6b240bc2ce77
+, 0x631b3adb1513e072, 0x14e5fa7fc52b69a3, 0x7fdd68654eaf6acc, 0x4903f161be45ee25, 0x3d5a24d3d76484cc, 0x41bfac2247cb2c26, 0xd6c041ed64240c2d, 0x34bcff6fbcade512, 0xd933012600a14c6d, 0x6b75aa05f6f9de6d, 0xd1dc3488a83ec049, 0x098033c3773b57ed
+, 0xe6bb9314bf9ad4da, 0x03e3bb39c1fc41e3, 0xeb8504c64cd670eb, 0x3ab86efa77039e4d, 0xcb3ff616f9ce9eef, 0x44101212901754a9, 0x25360568f6d0c46c, 0x1cb85dc5f1cc5b83, 0x9fe38aad4733c869, 0x7d6745e4e80b3b8e, 0xc008159467a81210, 0x4bb1c3e591aa641d
+, 0x52d19398f7a53f13, 0x22b37c0570862433, 0x021ba7025b892b24, 0x714a243b29db9987, 0xc6f06942a8cd3dd8, 0x76dd327cd88bca5a, 0xd898abc52a12ead6, 0x482ddc6581351ba5, 0xe0688d5b179b2415, 0x56f599434a1f3697, 0xf500055718277573, 0x14d9fc94d5629900
+, 0x374afeb0d0bc0346, 0x5f74877890a1cece, 0xf1e7f71ae7c0ce99, 0x1d7b67aef8dca60b, 0xe08ec5ac71fef43e, 0x4bf3fd08108b5399, 0xe3c6fe67f10425bf, 0x65ded02687b5fdba, 0x88d71133bafc3296, 0x42af2530f910e397, 0x37b70870b19a403d, 0x41aa78107fa97854
+, 0xdfa6c758f0323da6, 0x3b84f45f519e651e, 0x35326651f7f55e87, 0x61a96fa250654c51, 0x16e966e61597b979, 0x10724a4a70cabe48, 0x787bc89b1a55bbb4, 0x7d5c23e75ddfb423, 0x71586cccada11659, 0x3bae5ab87039ac32, 0xff1537694c36d3b3, 0x337ccf4490d3fbfe
+, 0x224877c9d68b7782, 0x60a19b50aac86b23, 0x63a3e66349819721, 0x1eca928c874de7bc, 0x5e423d6a48e3aecb, 0x708b65eefed1ac95, 0x4e576be38b93d8f9, 0x7ea7ebbf26d5673f, 0x7aa0471e3a65caf7, 0x629f4bbab834e62a, 0xd9090d5170c8fc6f, 0x3e7209cfee82409d
+, 0x13624ab761a0e724, 0x2b499276337c647c, 0xbb72204789993fb1, 0x39727920ac7c11d2, 0x8a018cde6c391f30, 0x5816fad5539cda37, 0x800c50af3741a1f7, 0x577e26955747cdd7, 0xd95214fefb809b45, 0x719fa4ad51f05f61, 0x78dab8393a6f3701, 0x0fba68fab52fae1b
+, 0xe131e6146a8d5511, 0x7600f5a486dcd4c6, 0x704eb217fb989172, 0x157aee96fcc29e6a, 0x86dea20d0ed46f83, 0x587e57a89d7a5df8, 0xece59412a84b5141, 0x612e1a5a5b31d65e, 0xd1c10773ce7601a0, 0x206da698e06a65aa, 0x2fb501e8e352c34d, 0x1269a37926da86e3
+, 0xfaf5037271adc7d6, 0x5331aff03fd5d208, 0x5067a5537e8a4e41, 0x59af910b35892593, 0x759e11ab6127cffd, 0x5331289ce3cbdef2, 0xca490fc79744ecbc, 0x09c1708bdb0370a7, 0x7f4d60ce7650a57c, 0x2014c1f5a2d90781, 0x2a4ba7a86b798ff0, 0x3c5750e6e2a53773
+, 0x2177703b8a9b2b31, 0x5fa464bf29c9e95f, 0x5da7d4c57ba2ab39, 0x55ae5736b5e1370f, 0xa665ac0d61defee3, 0x227023039108287f, 0xe7bf896b2dc6a07c, 0x2f0ad297c80ce4ca, 0x49b2e9f5fe40ccc6, 0x5c3de8086d0ac2fd, 0x5c589a792624e859, 0x4d392d0402b34d19
+, 0x13bfec515b1d3a46, 0x2c19a927c6e2c9d8, 0x2d852f161dc6f1f0, 0x2bb8f199b426e3c8, 0x94f8594eda56f82a, 0x256a2abe3fed92e7, 0xb17e75b720048c09, 0x4bd64c4a34a8e6f9, 0x644d8b2747a2c952, 0x25cb1bacb0c3d5dd, 0x6da957419d8a8d0e, 0x61698f71a5e6f1b9
+, 0x79e03610b17ce15a, 0x02dfbadef523519e, 0xf32e56c38bedc4de, 0x274fc1465604324c, 0x73ecfd9903e4ed05, 0x29ab1c6818baa147, 0x1517ea743ab9b7f1, 0x3ca40ff24db55bd7, 0x88612ed540229988, 0x48c6fc8558a530eb, 0x0a20e4a78a21fcc1, 0x64964342db355564
+, 0xc3c4f4f00201e97d, 0x4fc49a26c0f85d7e, 0xe71533b7ae5221c2, 0x14d63bb314901a5b, 0xe37df8aa6e7eae3b, 0x605c229d4923a643, 0x45a4712132168e3d, 0x107a5f726498db2d, 0x338a94a289b69325, 0x7f0997ebac520aee, 0x60091fa3e29edc3c, 0x173bd871dc121575
+, 0xf19e9da18646d49f, 0x2fb8589681d92817, 0x34ba764e7f152807, 0x672adbf5db7be538, 0xc3b8b3a9915a24f7, 0x5089a117ccdced46, 0x849e048544b510bf, 0x437debf95a101d5e, 0x9e2bb39db8e39d81, 0x52b2ec77a058b5ef, 0x5c437ec8e6404b9f, 0x27e11ddeb232a818
+, 0x22d19a673c071946, 0x1167e1ba9b12dea1, 0x6fc51747156544db, 0x253e5e0dffa1fb75, 0x31d84dbf98866bfd, 0x12c83d1c6d7f9fd1, 0x7aa1d566016dcbf2, 0x6669ed84a9e8ba5c, 0x530ad76a53b03026, 0x28b55d233880ef82, 0x27a2b6340fe22138, 0x22f7cb61c5d63121
+, 0xa42450361e9d7b73, 0x1c24a7bd40a8eec7, 0x346408f8925d0961, 0x2858047b3c572c59, 0xa579c7537d1d47f4, 0x66d60dd19392232e, 0x599cab0eae3b078f, 0x7b404cd5b0aa93ed, 0x068b8f6315784477, 0x4a3d3a5c20809563, 0x868a962cf0ca63a6, 0x7f40f422c586b04c
+, 0xae227960d5bf85df, 0x4c1666b6742f00d2, 0x42c328962d1f3311, 0x01e6b647bc4c33b1, 0xd267fff24f33b56a, 0x787f30b81c1fa846, 0x17da71eac22acc88, 0x5f9e5f1479170cc3, 0xde610f738b0e7faa, 0x3bf953726039f12e, 0x0c6beec5f0ed4469, 0x7adc4e36f681dc6e
+, 0x7bfe8926fd6ddaa2, 0x25637b03751fe9ac, 0xc1b3a2cd8a52651a, 0x0c065059f80e1665, 0xdd053ac1f8bd5012, 0x7c4a1297bf270464, 0xb0e4d31768ffb3c6, 0x1494f861ec9c5273, 0xbb3e18922dc4f262, 0x1be010e5ecf0fb60, 0x8159bec5cbca3502, 0x78f969faba2b0dc0
+, 0xe87eaabcec9ad261, 0x1d961eabb992058a, 0x90e2509e356a2a88, 0x298a0ffbe3bc2a84, 0x03b68e34f74eaefb, 0x4d2ddc47b3f17ed9, 0xbfe36f2db355e3c8, 0x0d426e434f8f5936, 0xff2d9bdfa3027e0d, 0x0d6c005475f67bfd, 0x34f5cf8698717f2a, 0x58fcd8b2838ed69f
+, 0x1f3d2925bbdfdac5, 0x77a7c5a5430cbeeb, 0x0d592b095b741552, 0x4dff0f67a527e5f2, 0x1e938bda9d497e84, 0x12aa5978a7e41a48, 0x8be5ed5e296610bb, 0x50d6d56776830128, 0xd9a365002bc24d9d, 0x15fdb3bfc660035b, 0xcf244ac2238b4b69, 0x6ff55de9265200a8
+, 0x61cc01cdc938655f, 0x662cd268ed50ff69, 0x4c57b10bba8de83d, 0x169d29baf89057e5, 0x6b874581a9f955f5, 0x2deefa2effbbdd30, 0x19a9f1b22b0c1cd6, 0x1a75d8a578621269, 0xbe53e7d45bcbe1f3, 0x63f8b13f89b54725, 0x57484e50aace1d65, 0x7003e7bef836c8de
+, 0xf9d480f39b13a6f9, 0x08d746a795db0f71, 0x0804e0d1202d37bf, 0x20d6a1b6415656b9, 0x66528f865d963d98, 0x58eba5bc180022ef, 0x044076fcdb2501c3, 0x2f132ef3da9e970c, 0x91bd6dd720e92fa1, 0x66181576ee2ef8c1, 0x26975ebdccc8cabc, 0x7f2dbc8e9b2370cf
+, 0xa6f775ea23051479, 0x396db0bf67d24db0, 0xee3ebf7f3c0d28b2, 0x75c1679df87d37e3, 0x9e6c22897be2d89d, 0x4b1a47fadf1876b2, 0x6e57d4db3588d935, 0x75b1d5d5bcdbf722, 0xbc1b0efecbaa7751, 0x1772126364e6620b, 0x7a69e6e08d546f99, 0x0bfbdff513f153fb
+, 0xd58e58175f77497a, 0x624d875b654fb73e, 0x631e1b1b7358cdb6, 0x146412b83dfc0f48, 0x8c186cbd20c53682, 0x7aa7775a9e39928b, 0x63eb4ee2215b481e, 0x46656093c0c5148e, 0x855c37dc7cae3757, 0x4b58ca8033a8959e, 0x282020166e509dd6, 0x4a2bdbd02761138d
+, 0xbcf9ee0f09483496, 0x0e7f49d70a00a63f, 0x410d3f6621160ffc, 0x75eb520e1711a1a4, 0x72d6ac74d39a4c95, 0x7044c2ca2a3727d5, 0x4a8cd7f57aeec6c7, 0x500f0380cf2ade97, 0x5345e3e262eaeb11, 0x71cf5ee84d402105, 0xbb240489e69d5c6f, 0x1f6f4b40aac8fba9
+, 0xace5181887800d32, 0x52379cface661e60, 0x4559ad8c15f33437, 0x5473bc15604b9364, 0xc75712a19e860636, 0x6debca5a40c332f5, 0x875c3c00649cfd0b, 0x02c19a0a065b08ad, 0x21ce21ac759dab89, 0x435bd600fd288005, 0x058ef954024e2c6d, 0x2b483a39f9261d60
+, 0x9f7cb88226bee676, 0x2484309979a03102, 0x07eec840dc9032d5, 0x1ba4b328baf5b86b, 0x2d26bbbf396bc9c4, 0x75a04dad24038fb9, 0xa1d3fab40ec33555, 0x7afc046ab674e804, 0xf6cbf4bc3e2201b3, 0x44790b60f5ea6bf3, 0xb9b2cbcd8ef0c81c, 0x0f38a8302719d817
+, 0x44b75e40a28f9a61, 0x2892685a9788b2f0, 0x660d93c0157f9366, 0x1c07349221ce746a, 0xf5c4f2b347c4fa19, 0x263134058c5d147b, 0x81b49bad1e32980b, 0x24a01403b6e56721, 0xa3aac84a8897b8ab, 0x1b02b1457601b33d, 0xac10f594ff710205, 0x4c088f747ac75bc5
+, 0x253a25438d5e24ca, 0x19f24cd9bd29a31a, 0x7337150a2180e099, 0x379f13f5c3997a33, 0x73a2a70bf57d9606, 0x5f75b54c645dee44, 0xbf9071a5401a24ed, 0x713135abe0576d4c, 0xa04a8e5dcb3caf85, 0x7c8297351bd13e9f, 0xdcb34f5785b956fc, 0x2ac6b7ca8579aa20
+, 0xf758905ba266777e, 0x42c0bff7ffbefa43, 0x29f0c57c66ba3569, 0x716fd77dad010697, 0x939f5aa5a16e9799, 0x1fdf8a2d62a5af2d, 0x249444138afcce1a, 0x50cb2ee72dacae85, 0xb1354ae567e781bf, 0x01fc300d67e935b1, 0xa7d3c59e91fd934b, 0x3662574131d6b84f
+, 0x4bf687669b84e6a9, 0x4b7fcddf1f1ec487, 0x9a6f55191f77f13f, 0x7b4a058703ee8552, 0x44b847b0fbeb448b, 0x1da83377904d5bbc, 0x03eaa230a39d043b, 0x1976cbdc59b4fb54, 0x5846070616957bf3, 0x79eff038faae1bdf, 0xbe40ae20d09d951a, 0x30aaa6d8aa1365aa
+, 0x0bdbec6127ac7a31, 0x55a630d857494160, 0x964c3cf66d53a7c8, 0x6f739874a709883f, 0x9bf6da92d45851db, 0x257f8268368dc66d, 0x1790cbc5fe6f0ddb, 0x359402445bf06137, 0xaf650110633ec610, 0x3ef0da9558d166c1, 0xef445e09f1bca2d6, 0x14943fe2a44ede2d
+, 0x85756b6d1f1488f2, 0x3f593c37282b4191, 0x0fbc1bffa5377dc9, 0x74effa44ee70e097, 0x7dcf4502ccf2e3a1, 0x2c2af808f3a6bf0e, 0x19e5174bb2ee68a1, 0x2b7f3486f46dcc27, 0xa90d869051ae54a6, 0x3536c5b0b877e702, 0x3403162cf5d609fb, 0x131e7e9632a2047e
+, 0x749f2b0a1d51b789, 0x36eb92f94dd4f622, 0xd24dd615c9bc9c98, 0x69c2e8aaac0a354b, 0x2ef7a200907ca6da, 0x792938a909257a75, 0x8dca0788a9efc04f, 0x61fa4eda7b406737, 0x7c64ed0a23e91fa6, 0x55fcbf102682041c, 0xba270c1007e5aeb7, 0x5c875433a097b958
+, 0x2603aefc6375120b, 0x105f3c566a48c09f, 0xddad526dfd227f97, 0x77a45f468d3d1357, 0xe1484ea124122098, 0x2d0a062bfcd46e60, 0xdb6ea8ca1053f0a1, 0x76c590ac3f96aaf0, 0xdf628607e73abc8b, 0x1d5fc1c304a70688, 0x72dd883ae6e01d0e, 0x60050d3ce301df04
+, 0x2d93f9517a290705, 0x107d003c2738b559, 0x9c7c1d37f47a4e44, 0x18a67c5489cd12c5, 0xf7e511592933539e, 0x3d99f0cb42d00473, 0xe5088c8a9fe0b04b, 0x4ab4aaf1b4cf5c20, 0xc9dc7eefa5a203cd, 0x2a75fd222e966ca8, 0xfc53478cdd120f4b, 0x7ff22cd996a230cb
+, 0xe178495eb000b588, 0x0bac90fac28eb04a, 0xdbb963042f4395db, 0x132fe831ed4f591a, 0xba07bb348b192a7b, 0x6fe075dd2c93bfc0, 0x81fa7a6267b6d59b, 0x0b7d0ce25d7dce50, 0x2dfdce7190bba1dd, 0x1b771048e9a41d9b, 0xc5c020c516b32178, 0x1229b03c5fd9d61a
+, 0x4312561540604cfa, 0x67b02b34904df404, 0x938b5ba724cae1ce, 0x1d9c1e50f854cd85, 0x30a89004189dfd6f, 0x622c788aa72700f7, 0x8b459b3865f4c5e1, 0x0a418f5bab166901, 0x7194ce0bfa465ced, 0x60d98ff26d7ff721, 0x82d6b93cf8aff675, 0x447aa30bb4ff3130
+, 0x7761c14145d82da3, 0x23a598b2d707625e, 0x37aa09478af6d353, 0x3c9237d2402e8c6c, 0x4fc9cfe31a582d55, 0x23911dae2b64aad3, 0xfbca6a7e6caae317, 0x38405706d94a2f36, 0x0ebeda36897ee4f7, 0x635479286ca228f7, 0x92598ed59c247322, 0x1ef11378777848e7
+, 0x102b16c6729216fc, 0x3874d59b30c78512, 0x2c9be7ab4857f7ae, 0x3872b50cd6b0a5c7, 0xd43d62aa6ce93ec0, 0x0a9f2738325ca897, 0xe4dc2d092067000b, 0x12defa11b91bcbba, 0xdbcdc80ada61b998, 0x7977da4bca21ba30, 0x89ab2ead24e17a99, 0x09e56470e6108c16
+, 0x0896931f804c0966, 0x0c54209a96dd3788, 0x27819484e95622d8, 0x53dc8a0dde2245b7, 0xfc4472ccf93b23af, 0x2a03120f04686279, 0x4b8994ab087aa84b, 0x0c7355026003449e, 0x7bd23cf7bd8ec157, 0x61fabea9ef0b00ad, 0x58563130d8618cbd, 0x2e229c1694ea8f1e
+, 0x961cdc4078f67ee8, 0x6cd63620d7e794fe, 0x84b9903a1e8ceba4, 0x69b64e4e728f222d, 0xcbf1a2118ad99976, 0x1e02a884b2a325dd, 0x6ed6df3e7c9c9057, 0x1c33fa5324118f18, 0x1742f5197ec185cf, 0x54a8b1398ef3b22d, 0xd07104f1b8752687, 0x191de1d899f73167
+, 0x973fe9f2cbe3b879, 0x02ace749eea302a6, 0x4cefe801e9b73a36, 0x6da9e0947ec80e0c, 0xc86571fce65ee2ec, 0x4c6716e51b3bcb88, 0xf5401434869fb940, 0x2bf1805e47a9357d, 0xfc1d7ddabcc21463, 0x55877486b6710880, 0x215f12d4f081ae78, 0x23159aca66c91e0e
+, 0xb51386973b727591, 0x3393a11603c275cc, 0x2ef45c332c15cff4, 0x265e24dba87b2b2c, 0x2440b7b64c5e7117, 0x601d1ec34809580a, 0xa973043329dd61f6, 0x03afc69ed6da9623, 0x407989dac6f4dc5b, 0x1d039952961f6162, 0xc5f3a5fe35820a99, 0x6fd88c5cd43a3616
+, 0x9eb81e44b4e1d437, 0x55c80115db76cae8, 0xd25cc63275fa8638, 0x366b49d78a8e9394, 0x5bea540d63ca82f1, 0x11f634b8e627a107, 0x7bfb392118ae3942, 0x45f78c7a520f6cbf, 0xe892deffdc15fcb7, 0x1e1544b265d51ac0, 0x36bcbb42212d0735, 0x6fb303141067c50f
+, 0x1dd1b24ba91d0fe9, 0x6a5d4e628c127dea, 0xb5885c6a00cc375f, 0x792318b0dc61f868, 0xbf24132e385abd7e, 0x7bd00339caa8ec4f, 0x294b6fcbb0116c8b, 0x6611ba22be3bad1e, 0xb6721325f549ab43, 0x5d7d6d8cdf393930, 0xcaf00009615853d5, 0x72448f0d2bbb2e7a
+, 0xb1e4bbf6776a4f8e, 0x2b1649960cab06e1, 0xf71fa651375f4b0c, 0x4033f4f0c2951449, 0x246a535903eae6c2, 0x0c069e9e37f92f71, 0x20b03176513b86c5, 0x7890a6786c09684c, 0x658ca8903dad92ff, 0x7b62a9d5e912f9e2, 0x6e79b43a1a3df65d, 0x358304969e85efe8
+, 0xeaebb394b3040ed8, 0x6bed001be0e39da4, 0x765ccf9906895867, 0x0b4985fbeef02bbd, 0x415c144a28f58531, 0x44e949f07e8aabc5, 0xd9b4ccc042547ff3, 0x2fc998d8f42bd602, 0xfd2e178578a72d3d, 0x2144a309a472604c, 0x675e8a982c374be8, 0x4ada32e5302a4076
+, 0x1bee8b2669e919cc, 0x7954f851485c28ab, 0xe3aa71445a620dc5, 0x3f99ee3b39965ea3, 0xdfc2a771ded8400e, 0x06288e764743cf72, 0xb8cae67f82a6edde, 0x49ccd95c9650d7df, 0x1343e09d2893e68f, 0x084894f97c0d3504, 0x713240055e5c6689, 0x564a5da76c4501cc
+, 0x8c7e96db7893ed70, 0x377bb5200b06bb05, 0x918192c1087efcf1, 0x43db3d3f29c27795, 0xb89ef6cb8119ec0f, 0x331286cedaabf818, 0xc30a657ebc9acf18, 0x474b91732fdaa270, 0xe6d2ba47872f7e96, 0x52c339aaee02893a, 0x598b59ba8c0cd07a, 0x62c4199704173e30
+, 0x8c5710960fa36cb4, 0x26883417736a9bfc, 0xb4c201fe85dd61b8, 0x7908603ded871279, 0x298a7115057b76f0, 0x18b906af2622f686, 0x785d5d8984d048f4, 0x5f98aec58ca82700, 0xda85016d0a28efbb, 0x6930c8f96f424534, 0xc200081da522ee57, 0x0ebda4fbc879a4c2
+, 0x0672f673187d8160, 0x2b4d61aedc1cf69a, 0x69aa5ccfdfe24aed, 0x41c22105d0809727, 0x9e8ef849d6ab7888, 0x673fa2a3a1c1000f, 0x29fcefec1edbc0f1, 0x641399eeb0932a2a, 0xaac0bd600b62db82, 0x3f580755e3c0d811, 0x5c8771fb87a25112, 0x50c489bc3218af89
+, 0x12c13fb5c4d551a1, 0x05fb87e4b1e9b36b, 0x9a1d7b581fc563a1, 0x53408b6166763253, 0x74ec871bd73a3144, 0x5f5242e304d924f6, 0xf7d2a20e80f97835, 0x4ccc4f68c4aeda9d, 0x68a4a3db6d6e79a2, 0x3e83ff72aa3ab7f0, 0x5e977a08c7655bb3, 0x5a24e920d7ac4558
+, 0xba01e530a2ef42d2, 0x011d1b762a7996e7, 0xb211c46b8f23540b, 0x1bc1eb1b31e2f411, 0xd3442ea8ed1a8d4e, 0x131998ff54545e96, 0xf2c49345d69f4af8, 0x06445babad514a8f, 0xd8bd46a9feec64ba, 0x0d084444c7728009, 0x56766ddc6f2e44f8, 0x1552fe486f2d0408
+, 0x7c49cb3074500193, 0x33228c0cb0613719, 0x3c66169664dd4b4c, 0x5f4cf0668cd4b5a4, 0x2ba952c732a93dfa, 0x7f4b5268730f14b9, 0x595fd71cfd3ae6af, 0x14c556ac268fec79, 0xbad81207510569be, 0x2a521948b4317b51, 0x18da56018246e2f1, 0x22e3058951693e53
+, 0xd120e6aa89125e18, 0x62929ce51234d074, 0xa57587940f79e0ad, 0x620bf0452753c887, 0x6a2cccd9af3bc7d8, 0x7bc72e48873f1f68, 0x30ad1439f13a3355, 0x76476b049e3fd34a, 0xef7e03262727267f, 0x5658cc92b1c3890e, 0x07c59f06efe22407, 0x629f55f7c41b030c
+, 0xbc751d8a6a93c79b, 0x3da6a77df930caf7, 0xe7ce535f6b0ee0d5, 0x2056e5fba63a05fb, 0x4a36cc8e83e5dde4, 0x77e4d6928d4d5bd0, 0x13a7ebfedb1aeea7, 0x413c057f297bf5c5, 0x97f50f2618c27976, 0x1f974bb1a020814d, 0x7029a7d7428566a6, 0x58f277db80bf6f30
+, 0xce9c39ff58618e79, 0x7ad8257aae09c938, 0xf044798fcdc421bd, 0x039a79b9b01aaf12, 0x9330fd35334c993a, 0x46f935bdd14b2f17, 0x2601be490cb95e6c, 0x625aacfa7dd73cc6, 0xc136f6284651842d, 0x2242823266c446b7, 0x7fd79cb494a50b64, 0x251d5e6a5a1badcc
+, 0xab721c61a2bfa732, 0x39216336dfdf2973, 0x534dfccd498c5ab4, 0x010553fa18ebc0b9, 0xc3a829dd975684b6, 0x13545cb3519254fe, 0x17d94d511b5ee7fd, 0x58f6bf6f94ae3b33, 0xf5a4e1249e3ba66b, 0x187335b8754b65e2, 0x274041e4c45bffe9, 0x71321b3ddf782ea3
+, 0x180dc5b2869d9f14, 0x2584597c12dd2437, 0xda8e5c84a64c2b3e, 0x08f07b90efd90ace, 0x3f593d92849883c7, 0x22aa586fdd356b88, 0x41760ac005853ba0, 0x436a6dc5c2a62282, 0x3afd79315f0026c7, 0x658a40f54fedabd1, 0x99b63cd585b2d75e, 0x2c481e4572224d85
+, 0x987a9a92dd8c674d, 0x57b811e89d40c246, 0x65bca5c8b3b74163, 0x404138ed9de37efa, 0x5d829bdfc079d13a, 0x7c902c924bb34531, 0xb9c4efda601a8b51, 0x3553e8954271d48e, 0xfc2ccd14901a0ed1, 0x172ee7f84e509760, 0x4698ac804c0a4650, 0x6e580f0b4330b6c6
+, 0x57514c0cd6e75771, 0x03b4b2f7257c9c1a, 0xafe092b2aa02971b, 0x49f43c987c990747, 0x7dd36980a454c471, 0x57d3af830c5e5329, 0xd72d27e796fc1111, 0x33eca6dbf202d947, 0xf7c634d8532d3700, 0x07314e30f8c782c4, 0xae74f204c199489b, 0x165804c082680efc
+, 0x1e2f0f6c1e206051, 0x500edd81e46d6ce4, 0x16b8065033c38e90, 0x44a97b5d2d70505f, 0xce32a7a44a9aa9b5, 0x716b9bf13438c2d7, 0x9af0d51f6b5e7c1b, 0x242eb3018f299c97, 0x951d74b51d3386ef, 0x1c8aeae4830d5cd9, 0x8381bac472c6ec67, 0x40830ca464fc093d
+, 0x10d17c8f00f14ed2, 0x3f26be6f236d64dd, 0xe3b9cd07e0a77345, 0x22e48cee73a013fb, 0x1103b4f0e5a4784b, 0x7457ee3fe265aaa5, 0x0dc4c231573e9751, 0x6b24472076db480b, 0x009852f6405f3521, 0x0440ad700c64074c, 0xce304fbc01898004, 0x0de9743609e8beaa
+, 0x7de43b0ef6cbf0de, 0x0212ae3534b65666, 0x8822819f3def09d2, 0x0a55293fc76389aa, 0xec19cb4d8f287c22, 0x6c98faa43c759405, 0x12cf7b2bb0676508, 0x19b914de14c30e3e, 0x6fc567bbf14b9e85, 0x5f30924f8505a609, 0x6ea61757354f6355, 0x3f7f4cd736eef24a
+, 0x10ae014de62c5113, 0x6e81fe4897c4a340, 0xb28968a9bbbf4d56, 0x4a8e5643235d14fb, 0x423eeae66539f716, 0x0cca400612cc3d6b, 0xe70ba485d438b537, 0x6b7ce706dbbdf9ff, 0x1f534f2658e320fd, 0x33ac3adc055787a6, 0xf9e564e79fa72ce0, 0x69e77737f2705e24
+, 0xf50f6502295acb88, 0x473352bdbe6798b2, 0x5d836253a23885eb, 0x06cd6a6bb6ffc414, 0x8a79170e279a09da, 0x26a542da0dca2a73, 0x1842447859c91ef6, 0x41ac696dbe7022f1, 0x5b1018b0eeff0c27, 0x5acca946026e8c2c, 0x283f841f948e881f, 0x01fbe679c980367b
+, 0x1a0432afe2114d2f, 0x1c1a990e3a18f7d8, 0x85550eb233cd1c0b, 0x6f406e23e8a1c256, 0xe98f17202bac2363, 0x511d0a882594dd64, 0xfafe72729d3e7e97, 0x6ecfab693ea76fd2, 0xba4caca9b251c170, 0x05199cacdc999e50, 0x6fc5ac46a0352d23, 0x3ef465115260736e
+, 0x27a56e9e6e844e6e, 0x1a9f2b47ade95502, 0x1b3bda54f5de6156, 0x720982995a641423, 0x2f193e2f3e82c27f, 0x453af99bc47a25c0, 0x004bd24656ddbaa1, 0x3701b0afe385c6ac, 0xcd5371d6b335a534, 0x6c3b1b45e3c49f35, 0x6f0aadc487ad0c1e, 0x76d4854f1ab88d58
+, 0x2568efbb5d1df950, 0x49e5cbf0a931ff9b, 0xb56e61fe8d3d0e3f, 0x33ede06f10fcab92, 0x2dd083dfff962879, 0x6f9e66c7dda543a5, 0x14046aaedf6e6436, 0x098c9b9367f49051, 0xd6b4c0a8c1a75a8c, 0x373f6fa9a0fd061d, 0xc1762fbbacb94fd2, 0x4df33a66fc155a15
+, 0x36698c2b55c262bc, 0x5c6ebd3adc0342fe, 0xe62a745cbce0e0f1, 0x2fdc01127f1174b2, 0x9bd8bdf47a7ef19b, 0x45430acee1995771, 0xb631ca8ad3c2a69e, 0x4e0e33da16882be0, 0x4089d5afc3d76d97, 0x1e793db838ce7638, 0x79dde5c114656a93, 0x18812eeee5ca6356
+, 0xe804d9525fee9c56, 0x3238b9997fbff6e4, 0x1b12fe7514119303, 0x2258bfb03e9198c0, 0x2be82edf30c2c6dd, 0x7576f19cc3427e92, 0xb0626ad0dc003d7d, 0x7c6e6675e5e4b435, 0xedd484a87dd0a51e, 0x3f1bb6ba949a1302, 0xbed7f0cbdace0fab, 0x4affcdbebfe1f5f7
+, 0xa75b29924dc63226, 0x3c4f2849ee256fa1, 0xddc3258fac0f340f, 0x75e3eb707f490a9d, 0x2a061733c10ba473, 0x7f456a4b2c8f461c, 0xadc5f521e9526207, 0x4438d0d6a92b48e6, 0x66387d35fc0abeb5, 0x136fde144c9da038, 0x832dcb50b6fc6ffd, 0x684a55a5a6ac2ea5
+, 0x0fba40df0df5ba4d, 0x56239c4804bb880d, 0x80bb5506834a2a8e, 0x5c7fafbc29fae1e5, 0xc688c7426fa011ff, 0x19fd7d00832147e3, 0xad89e0087caeec7c, 0x5065f42cca494a6b, 0x18fd455b38660f73, 0x00f326c30e9cfd28, 0x66d6baa16422919f, 0x5d542858fbbfb154
+, 0x85283a7ab95ae3dc, 0x01a03f8c2badc73f, 0x8b3e9b8c0aa83268, 0x6596d636bc53e006, 0x8faa68d253eb96d9, 0x35ac60f75a61182c, 0x7441e24b3d00aa09, 0x3bdcae5dbd469372, 0x07d951ac0f68948b, 0x585858c6d469a5f0, 0x0ec069a9de74d3df, 0x210f514a806ae618
+, 0x749c79d958799a6f, 0x0d3b7b42c9c9ee27, 0xe32569734134c82e, 0x77b7215d5e7c2319, 0xbff263b4b438056c, 0x019263578a1120f8, 0xa6e5bb0d0bd7b2ad, 0x044e9e432bffc624, 0x8774ecaeda96efdc, 0x7a01ba739aff05ca, 0xad2f83cc029b0ddc, 0x56ce38b6ca132e8c
+, 0x8f809382287a2bc6, 0x22cc21bfaf484110, 0x56bc26bc18843915, 0x46ff2eecb88c8f28, 0xc4c2da5f314aea01, 0x35fc6d421580abd9, 0xf7e6b2522afc4bc0, 0x249f53eccfe338f5, 0x3ac1213988b596f5, 0x1c29ffe5ce1fc629, 0x21ee4296aedd9f13, 0x09d65cc6a4503328
+, 0x86f9f5dfe3470c07, 0x5dfbc08e6c5bc783, 0xca89137465ef7a8c, 0x7ae713461cf76cef, 0x698c015649c1942f, 0x2b3ee4bd698da127, 0xf0ef34ba5317b819, 0x457d09d01ecb4052, 0xb82826d3c1e29300, 0x1ce303bdf4695a0b, 0xc3b4dec4e2a76aff, 0x224e4647e713d165
+, 0xbcb63b71f0384de2, 0x10920661394ad93c, 0x0cbce53dcd3bc861, 0x31b1058cb8cedc22, 0x990758e13ba389c9, 0x58bae6cb00dfaa1d, 0x4c2ed5427ed8c41c, 0x5d14c5e9300d9dc4, 0xbadab1c1480830ed, 0x68cee861cebc68a0, 0xed7a9fc41f02ba7a, 0x2068c537d433611a
+, 0xe24c20a730327c87, 0x0cf0745b75d3d5a6, 0x76ca567cd5156b2a, 0x0bbe9122486ab4ab, 0x2bd092b75d389da1, 0x5212799b732fe85d, 0xaa663e8b8467afbe, 0x3a6233ca0425c443, 0xa7a4a7dd961c736d, 0x3668a6f36573f586, 0x48b278c3b142f50b, 0x28e28c7f00169355
+, 0x088dfe05bce83df8, 0x5c3ae4d964749938, 0x5d05e96e8bafa117, 0x31d000980b312d3b, 0x8e691f7324c1f782, 0x49305dff3e76bb4e, 0x3ccc751236938bd8, 0x37b56edc20315074, 0x059843394eeb4f47, 0x10924ed82b0d6263, 0x67e3a622ea266439, 0x43e337b0fbdc0925
+, 0x4d55994e1ae892f8, 0x55ee3936d7c93864, 0xd390ff092c27c514, 0x1f9d80518cd95d43, 0x0f131fa0db01c82e, 0x26e1c1a91f05486c, 0xd48b1139e2714fe7, 0x126781b90c188f5f, 0xeb2d8b7c1161e28f, 0x1613d8e5ed960da7, 0xb5dd0e2ecb57f39b, 0x69bab8e977b8f5ab
+, 0x0b61d311021fd015, 0x1e003302746492c1, 0x46dc0f56200fe21c, 0x1cade3a1dc1430b5, 0x40afce3c28ca5b5f, 0x0839b9d11c1555e5, 0x36df9949b644bbf2, 0x1b7bc0f355dd7a83, 0xf139316dffec711e, 0x564ce83b3a6d5227, 0x0368acbdbade5f76, 0x6d47923811e3dabe
+, 0x3b1dd5f3c2860c9e, 0x5e5e0af67a8d6e7a, 0x2c1683d17fb71560, 0x6046cf53f1602f33, 0xd582415201d706c8, 0x63d08db43cfb52f2, 0xc8d242d1b1ea5fe2, 0x54fff1effdbdc204, 0x7f007f18e732dd8c, 0x729d56b7008b92cf, 0xe330be2408eede35, 0x2c7745344e8ed35a
+, 0xfe4f7a29c239eb42, 0x7ce189a2d437cd04, 0xd668c01a8fac5226, 0x3c46a8afbc4b9138, 0x76970d1f337db900, 0x7ccaf8ab655e0f2f, 0x8b3286c304ef0e4b, 0x3d1107e9498e8b2b, 0xf70a66e6026c85eb, 0x175ee0e4e8c9065a, 0xf7cb75cb27989ffe, 0x4065e36280f865e7
+, 0x76f6a9b1d3b67982, 0x77f283bccbe9a5dd, 0x9390741a34d7236a, 0x4882c0bdb660fed8, 0x8213645112d1f41a, 0x6fb8c6cb5b490665, 0xc9b8a4919a91b503, 0x627dde1f36789a0b, 0xf1a7b23256655942, 0x2e259172f2821ee2, 0xe5a81ffd082fa65e, 0x0a6794e371082f35
+, 0xf9ac6589013caff9, 0x38f6d990c684317a, 0x9cdc971a08b3e2a2, 0x40ff0bc10595ce19, 0x08f7ab5e653b8091, 0x0fec2c04f964a005, 0x4d128f296803b59a, 0x1ceaa7b53483cb13, 0x465ae56fd669ede2, 0x5ad9024603e2bd59, 0xb8e598042e91c481, 0x7c9c360e00e12268
+, 0x29925d3967f75b44, 0x52260d54880142ab, 0x159edf28d517dc67, 0x624796cf08bdd611, 0x70bd6674f73880d9, 0x576c6e58191e9a7b, 0x54bf37d58891cdea, 0x5f8e7a1bc803d579, 0x51743d0cf1e991f8, 0x447ffeabcc281558, 0xae0b4e4a40bb40c8, 0x62063e83d5d9b173
+, 0xf33b574b96895e80, 0x682ed86ffd95eaf0, 0x112610b490fa27d7, 0x289ffedc32747d74, 0xe54f1a1b2151d641, 0x37a4b90a0d4d5ce2, 0x80cf0d24e594d281, 0x7a253141961ab198, 0xc0177b4c911f3975, 0x7d92dd957b8b7463, 0xd2899395c223c8cf, 0x7f7cec190ba30073
+, 0xa8955c4cca515625, 0x38cf18ba96482039, 0xa0ac7b34d3c006bb, 0x2ba51c2c841c31f4, 0x3207a9a40188154f, 0x6e09f2a1f4dd0eb3, 0x4d00045e09f6a9c2, 0x603dd97e6f2eb970, 0x0f81395e2118dd28, 0x52eba55194e8820a, 0xe8c76e1fb11c248f, 0x1b5fb1b15dd94228
+, 0x0708b89658941b54, 0x4ddb27889b619aea, 0xf151a8f787812eec, 0x494c192765f824b4, 0xec55ff435dbf569a, 0x509108a921e06dd1, 0x2c9cea8ff0a24428, 0x2751bef250c7aac9, 0x5af11a21d7e201a3, 0x71da6b45d5a387bd, 0x868c3f697ac8b37d, 0x49512e47fd1cd677
+, 0x20e5e1db394b0957, 0x49fabac63b121bbb, 0x72260388cc81fc93, 0x6600a311ba8c5c79, 0xe79ca8f9d369a346, 0x036216d7c583c64f, 0x2d68d83e577f695d, 0x5dd3695066a55bc4, 0xc1c1282eaa88c727, 0x5ecc32bcdd69dba8, 0x0521fa885f00926a, 0x4ac4d28872c4a4f0
+, 0x28530ca37aeac503, 0x501b5052e48b4bd1, 0xa98bc3f1378ee0a2, 0x19c815584534a281, 0xe3d48d2384267f73, 0x5aff526f576c3999, 0x491492fc2161c3b1, 0x669a7425662a1482, 0xbfa8d5d9526d5537, 0x03751fd39b75b1d1, 0x88d91562247aa169, 0x3ec1e73fee8b0d51
+, 0xd0347742bae7b080, 0x248faffb66c9f8c0, 0x9f92f1ba8591fff6, 0x1b998abf51bdf2eb, 0xd97a61bcbca77c59, 0x7e01c45fb38697f5, 0x406a23d10c3e4dbf, 0x7284d1aeaef18cc7, 0x54d21ebdcba7aa32, 0x757376a42443d0fd, 0xd8cd050ca8c83a8d, 0x3d0280f506a189fd
+, 0x5f9fca15a4f8eef8, 0x4bd3205e85b4e346, 0xc640221833ef2d76, 0x5b0e7b1178d84c1d, 0xb7d346c5da1ce032, 0x64f1c60c09f3d787, 0xcf38631a29a3ac20, 0x24e84a7ceb989a4a, 0xe3283163dea2cd25, 0x47048726eab89f19, 0x88ef78a24289b6ac, 0x6aeb3727e21229fa
+, 0x3e57d383fac3ddef, 0x17c2d8449b5ffe9a, 0xcdbc1e6ae451df3b, 0x12a4a569037937b7, 0xc616a5e39d708d46, 0x1f0b68051ae9d8e7, 0x2a8ca001ba05e822, 0x697cb6efe808561f, 0x09480f1a4ae9fa27, 0x4e37ef706e2986bb, 0x9d5a145fafc164a5, 0x1840b26b38d826cc
+, 0x6099380ec6f15a36, 0x064a2976633a3e51, 0x5f2d891d75a53bd6, 0x4d9fa452e5607073, 0x27b331817d08e86d, 0x1f0a300cac9ad3a8, 0xeea414f248fb7a29, 0x381126735678f424, 0xe3ef6ccb409f645b, 0x26d308fecb6b7db7, 0x980c5edbcebace4a, 0x0b6e5823ec816551
+, 0x51eccfe2e04e7876, 0x1e482ba9d08a1879, 0xf0db944c17790b6c, 0x3bb4776e45a28c51, 0x819ff26c0c7b0c3e, 0x201362cd611da14f, 0x05c4838dcda1e8ba, 0x6b764bb9cbffe4ed, 0xea53f00e21aedeef, 0x37929648944d1850, 0xd393a94fafa7eb47, 0x140cf59c77096e26
+, 0xa09f5dc57ded9220, 0x19512e95ba692083, 0xa9e2ad9cc8816df6, 0x5747c3baad2a9dba, 0x0b04e606a4997f3d, 0x6872d18d5f9ce6ef, 0xcd3d99186acaf5de, 0x61a77839a70de867, 0x2872472c5adb6d06, 0x150de4a36e56796a, 0xcbd8f250741d4f10, 0x09665526de70419d
+, 0xcaea1b8fe2a973d0, 0x5243056c2ad2ce15, 0x24c65ae4759ded87, 0x312942449d089024, 0x12b192c65ec050a9, 0x3b8177e1d5ba6153, 0x9a69ceaaac26de39, 0x687c21e6a72aed3b, 0x0b405d7c1e2ff91d, 0x2c996f7aa9157c9c, 0xc0e1825d9e79c78b, 0x2ecc07516e1273c0
+, 0x52523e7214d7d920, 0x09d0b7f0ffeaf28d, 0x3a0f5a407f3a6c24, 0x194c88e1925982af, 0x2bc4d318b5adb72d, 0x43964c193f36fa5b, 0x74a3c67b83b05be6, 0x145d1cb0ba76d144, 0x93d51900fa9579ed, 0x3170a776f159b658, 0xe90f52b71f32dcc1, 0x2cf576aca569376d
+, 0xb183838122283108, 0x6a497b00696d2934, 0x401915090bf1d034, 0x7d3ded25dd5f53a8, 0x4140e572f7b22454, 0x3541534ee545449e, 0xa6433e381ff37ed7, 0x064ccca0115b4d36, 0xad175b9aea75052d, 0x63af57a05a28e12a, 0x847a2735858c0849, 0x3ec8914dc4414f95
+, 0xe6ac181175023136, 0x7e19921541663a62, 0xe8ab08d3f75eab7a, 0x1b9bff1e96c1b1a3, 0x9cd0f9e99ac79d0b, 0x2b97a863fce03aa9, 0x35d6aa6e242e4e9a, 0x7474bdcf271e883c, 0x4ae61f4543aa8a29, 0x381031adf7606418, 0x782064e02cdef84e, 0x5cd0cecb1d292a03
+, 0x39010a0760d7809b, 0x1827ba77245936f8, 0x0e6d4f4a40af2087, 0x6a2ce9bc9a37ad81, 0x0b61a6b13938bf09, 0x768b41613a36ef15, 0x882e359f53380d77, 0x54acc2c2b47d8ec8, 0x2cc24e0b4573ddbb, 0x5e1dfac14c47b18a, 0xfd89886f695e11ed, 0x1f545decff5e0469
+, 0xd38caf8efba0ebb0, 0x40c2295d5a82281b, 0x1fdaaff757e24be1, 0x5c810289eaa6d71f, 0x7bc81bdceefb9fc9, 0x01b90e7d00206a0a, 0xca3d4acfc35f0190, 0x66ea1a6852cf9818, 0x619a488e8e4a4b48, 0x6d309674eca96d8b, 0x026cd88ed99fe32d, 0x606727317dbf1644
+, 0x394ca020a3da47a0, 0x117d0ac9bbb44ae2, 0xc282acad27e1e1c8, 0x7fad759b906e3309, 0x00fe8a088a8dca8f, 0x455ab5ed0aaf0d86, 0x8a97745150c2c8f9, 0x642ce2c3fb648d2e, 0xa830bdf93b35c4d5, 0x1fb22f7613f7d1a6, 0x17fb4ca20b42e938, 0x1b6f37d8e20ecfa9
+, 0x9bd81289d8d849c3, 0x59149c9a39046c6a, 0x27513a51ee307e55, 0x419d55db0b5188ae, 0xcab599062d511ece, 0x1b42493a0fd1c1dc, 0xcd14df3cbf04fb10, 0x4d1c48b2c43e72f7, 0x03548d1182d9a5fe, 0x5bbb8ec31a362d5a, 0xc842d604ed9f593d, 0x340481db59e816c8
+, 0x908be835b31a5f5d, 0x647141cd4ba38223, 0x47b487bb8c7df71d, 0x4464961dbbdedf13, 0xb6f418afa5e098f4, 0x337011aaea39fa90, 0xe7670b58de415b99, 0x5de816eebf3027f7, 0xa94aa120a5552909, 0x5b2207960be8609f, 0x48d723145d5bca60, 0x7c87db92ef5dfe0d
+, 0x79d63dc9b5d99c0a, 0x3b82277977612ae9, 0x56927c3fcb54d9d2, 0x3a8c39ba45e69c7d, 0x982c1b7110f55013, 0x183eae58faef9bd8, 0x3d95f99dfe7e5533, 0x65be8a6a1712c191, 0x935cd9ea1958fa6a, 0x55b77a51696d1f66, 0x19ff31656748336b, 0x649efcbf2aba190c
+, 0xed06cb26392ace49, 0x236cf2f3b9ef2b1b, 0xa3df4fb14e7a290a, 0x7b6e14619170459e, 0xae3ffdf3b98e0cc0, 0x6b78aff0dc27b24c, 0x1d16a1251e113c6f, 0x12124655cb019684, 0xb4fe01a8326abf13, 0x41dd3c577b94ebe6, 0x6520544cd8b5cd93, 0x26e4ffbf10ec4a0a
+, 0x4f2677bb02c742cf, 0x7aada172c191f065, 0xa58eac693b9ae107, 0x72e12e3ee1546aab, 0x33b2da2a26916efa, 0x7a4364aaed789127, 0xc6766e176c7dbace, 0x297bfc0716c68429, 0xf4deebcb330bce6e, 0x10ee2bf89309f093, 0xd5daa6796d0697ec, 0x17db69fa997f12da
+, 0x40f087c30f924f1e, 0x5d5ad5c4f64b54d6, 0x67cb6d72e6e363b6, 0x297c362238696f07, 0xbd8e8b1bdf843b64, 0x0d0927caa34e7fd9, 0xbca2b7a81e35589a, 0x22a2ca3e53f419b1, 0x60cb1af37bec21a4, 0x334a05340cf8b18f, 0xb2d288869f5795dd, 0x37fb0fea63172ed6
+, 0x240c75dc1b1b443d, 0x6fad09b5b31540c1, 0x9ca90465c2feb712, 0x69b1ca5b46789c3c, 0x30a42bc10b11f97f, 0x2d420ea7f8218953, 0x919239b1a3339f37, 0x4c4965ce9a26ef6c, 0x6752c56f78ae6139, 0x385c86e3d0f91f6f, 0x9deb66d8fa6d4af7, 0x1b5e6729d52c2e19
+, 0xfc2addbfa318d45c, 0x5a3bb1e9c0e7e874, 0xc032c439253d68b6, 0x0a41f22b5fe82129, 0x1212c30c6496ddce, 0x12b7f7d9e29ebf12, 0x1afaf128ee8cce4f, 0x75cd0830d8b54ca2, 0x9a5cc26cedaee3b1, 0x03a81180f81cc5fc, 0xd450a3aec54aeaec, 0x119699e01ea3562a
+, 0x28a41efce30a3445, 0x3be83002752809a6, 0x943b6411db69a4b6, 0x421da0672c409623, 0x55ab9d55872827a0, 0x5d7b407a8221f2dc, 0xa927629ba25bc5bc, 0x50ae3d22d9e9628a, 0xcf6232c53f772163, 0x238c78640aeac5f5, 0xc0945a8efde54413, 0x05764cd021232a79
+, 0x45573ed63d34a7fb, 0x3442f92a696fcca9, 0xe54dbc5b4b0cd152, 0x1e2b584334c37532, 0x0e58998ee4db6934, 0x2b199fa0762343e7, 0x21258cc212e7eda7, 0x17bdfe4cac75a178, 0xf5c32e61be873d08, 0x6f508fd096fb79dc, 0x2b7996a5f4b93ec8, 0x6dfbb58549340d83
+, 0x2efd5cd7d7e8b222, 0x66e51c3a71485089, 0xe6a58badb8186ad8, 0x4b6c6f3bb459be49, 0xc0ce1b2a5a8ba069, 0x5c7e34dc07b0c408, 0x9dd708d453220c08, 0x0b90cd47e60b17df, 0xa306d5e7f805e3b9, 0x1b019d702d4e82d8, 0x08a6d33d43fbb069, 0x46b2ee0c55b4778c
+, 0x35fa94f1f37af7fd, 0x2b59f5fa83f1ba53, 0xdc1615dce9411628, 0x09d976fa148d9c2e, 0xc73a5333e811a561, 0x4c9a7a54d16574c8, 0xbe79afe9910bc347, 0x458503f958006675, 0x6f2e5fd2d8eea040, 0x47eac738162aced7, 0x951f0c8b0b9dee4e, 0x072f01b0ad77f12a
+, 0xa56c57787d266a14, 0x1f3dc04f30b0f46b, 0xa1ec75f25f034ea5, 0x5b961a949f1f0e80, 0x444a6fd4ced54024, 0x7185302292f9b397, 0x58e846c8277a2708, 0x3e3dc15bf57dae62, 0xf8d6fdd6f4a826ea, 0x7158eb69ee75d977, 0xe6840eb4075c1bb0, 0x3b4d661d46b6e9c1
+, 0x37391d36ba6a504c, 0x2ca52dfed8ee8f74, 0x70aabc6aa8ff5127, 0x29012f2c1a1e6790, 0x29d422cc8bff7ccb, 0x612d2f346dc793dc, 0xa174d667d62f1461, 0x1e3780d82a32755a, 0xf2dc1c3c4805bb31, 0x7e916325619cb663, 0x12d1f4a5632c520c, 0x780426c3f03e444a
+, 0xa1000c4054c6ca47, 0x69480e6b1956e1b5, 0x90ced3008861072b, 0x17031dfd0c06f45a, 0xe08845613abc3ac1, 0x578b9d4b9cf53899, 0x6e2925d88c932eed, 0x27f94338ff9ba3cd, 0xd85a11e1e9a34847, 0x337f3bac434a233b, 0x38898d8800ab4b55, 0x7c2bb9d2e8c963c3
+, 0x63796d159cd0719a, 0x2aa8ab387557c6c3, 0x9c936ced68a13da5, 0x716550ae7ab2e1f5, 0xe0ee4f2068f1b536, 0x36d459682fbd5ea0, 0xd8b0c71fbd0f1781, 0x5ad4e4ce1e49a60c, 0x506e517caaca1640, 0x601f2dd158641d1e, 0x495f3b886434be92, 0x09ab0b0af3f38309
+, 0x5d91dc28df357db4, 0x27eec32f9d40cd8d, 0x720e600842010347, 0x231c5140fa10513d, 0x19740fee51f7a08f, 0x460846b863f75c08, 0x85c8d7f0e089ca5a, 0x6e93bbd2b85a9483, 0x8ced06bfae42ee54, 0x66f7178e88b1690a, 0xddec384614a7a2d4, 0x0806312b6bcc6704
+, 0xc6d7235d6b8ba08f, 0x6062e8ddfe43ba00, 0x5031a4bd38d350a9, 0x719823c4a04ec870, 0x6482567b1806d7f1, 0x2bb8a4be0a6ac2cf, 0xad1cc7e347d1ba7a, 0x0f127d44a0ff333a, 0x8b2553d3c709416d, 0x6a8b5cfc481c6ab0, 0x09f99d1b1b68b91d, 0x7cb64936ebd0e005
+, 0xa94cada972edf94a, 0x1e3b00e13c2aee93, 0x58fdc286b64963d5, 0x1cb356f1511a9966, 0xd3bbff56a833f5b1, 0x4bb02adcc447efbf, 0xcbde7112c3634a55, 0x515b1464a7193a61, 0xf0a91632d8d72e57, 0x2c3d70a0f7e1b7b4, 0xae9613a097e609ed, 0x7d595b76a16f799b
+, 0x4fff5398edf93782, 0x15abaa508a6ed3a7, 0x617dac9e8edf7a48, 0x39bba10fd201f897, 0xa81b9c9d9e911891, 0x70bfb7e0be72c2c0, 0x6f53d4701968449b, 0x2504f0127c8f651b, 0x708f47bc484ea27a, 0x090e4aa671341bde, 0x0f1a8e7e21da19fc, 0x30d4636a12b5687e
+, 0xf3182bdd32145924, 0x27c2b2f96349996d, 0x8b230d6006518afa, 0x4bc1dfa2b98af27e, 0x27ac78a3e0ac62b7, 0x5724c97a39e3c32a, 0xba96a3273d24f114, 0x763182c45e1c2719, 0x8b08173a91ed525a, 0x255079a464933b31, 0x46fe2aff8e20cc20, 0x456e8a78f56aa675
+, 0x01d1fbfe4457e7da, 0x6e6393e5b734e729, 0x5b0eb9da5ee10523, 0x49b4953250112d8b, 0x4fd41490e1a95e13, 0x246c819cdfdf2bf9, 0x6ba3e0e4d556b736, 0x32a5a731a6ed8b08, 0xcf03a08a31a4c537, 0x65be03ff0162efe0, 0xb4e55829521eb8fe, 0x5aab98903510256b
+, 0x8a6b8c72889a51fa, 0x51103b7485ed0318, 0x67655bdf75659013, 0x67162ebe35005ff6, 0xe6aae9b62f2a1dc1, 0x43f9cb3792fab1a5, 0x989a398967641621, 0x1fd917180451deb7, 0x113215bbd931cc18, 0x619624747b797d0e, 0x9a8a541f2f1b4b0e, 0x7e9de0cba14cba22
+, 0x930b5f52a9504569, 0x674ff30e369ab6fa, 0x00c5733808a3994a, 0x76842a0435dbea20, 0x27186c79c5196616, 0x4c2a978e221f00cf, 0x5d047dbdc7b4733a, 0x2e7e184714fb6f7a, 0xbfc17c7aeeff525f, 0x42fd011a62658ff5, 0x553469b80d2512ca, 0x207451208bac75fb
+, 0xaa1559a8a6900204, 0x481a6a1a558a7918, 0x76964a9f5b915028, 0x1a989f7235ebed3b, 0xf6b3e493cd0dc8ef, 0x5c222c9776df53be, 0xa9503a9f24dde55b, 0x15d04c30ac387def, 0xb0c9c36fed07c4d7, 0x1dce31c0799ed3a5, 0xa0727e2081276363, 0x5dfaf269911755a6
+, 0x2fbe71663f9c5396, 0x198d2d419333e050, 0xa4a114f36cb04539, 0x1c371e2f7dc20f00, 0xb567ebf2047e5708, 0x661dc654c22e0316, 0xa60b7b5602cbb6bf, 0x33b1bae0adbdc368, 0x2cd795246a8e5e07, 0x1e79a05a64cda3e6, 0x3db8650240bd2bfd, 0x490dd9ec89cf1215
+, 0xd1f5f805c4d37e7f, 0x54531751254fab68, 0xb5580f3a3b6ae115, 0x12ed517d05c8e975, 0x03425653d44bdffe, 0x01ed59d4b5b1f855, 0xbcd23fbacd56d808, 0x3e6a75eb284f294e, 0xf7dddbbd93adb2e3, 0x58bf4ecc9c184082, 0x8c1115e657a361af, 0x1d3b3cc6ebd62567
+, 0xebcbe7f9fa05777d, 0x54c56b5e715f33e7, 0xeaf19bbd13a5964b, 0x1377c5e9e6c6d54d, 0xdd8f90aa8d2c9a07, 0x0ff1f6598b2d0d78, 0x3b319e82f8ff2500, 0x74dc4a17ab612500, 0xb2b1a04e4b9f8bea, 0x4ce528b14e0d68ce, 0xeb70f72e517162ca, 0x2b9d0f1ca4607963
+, 0x5092b0f762faf9bd, 0x2df3e6729403f4ef, 0x894c586fd349006e, 0x3a9596898880d495, 0x8dd06957e19ea076, 0x49c49bdf0f70eceb, 0x42cabe75407e3e68, 0x4b2507f280690987, 0x7d1058ee271d8137, 0x29d6ed126a7a1380, 0x07e514056cc90ddd, 0x78e0346513716077
+, 0xf0f06b22892d13dd, 0x352da3682ed7cc09, 0xe3867ff40e42d40f, 0x7fbf8abfdbc9f06e, 0x9d36f981aa9e2a75, 0x64856484e7f0a103, 0x383faed1dccd3176, 0x4499260cbda05d10, 0x8cfbf83e8ea87d75, 0x79b2de4ccf319940, 0x48d9f041ef455630, 0x5baff32a924dcb68
+, 0x9a39cce9758dbe35, 0x7365800fdf0e6a6a, 0x667c261e9abf0283, 0x088030d4d21a2afb, 0xcc39c154b7738287, 0x2f6d7146df90a0cc, 0x527c03d27acfbb6a, 0x56f97e52353d91c9, 0x32b51e85db82da8a, 0x0e1c5696217b8e02, 0x05b5ccca923a348b, 0x3a84915dd61fd3b7
+, 0x53b02c1f2f83b348, 0x7aa52011219ed18a, 0xae6408e7305a8ded, 0x09d3a86c5d418c9c, 0x49f3023a64162664, 0x453cb3aec481077f, 0xbd3c2a654056d417, 0x21d44305aa3659de, 0x65eac83de420051c, 0x7cace504e8d95d65, 0x252bb93e8f2f8e77, 0x63c1c48aed0e9faa
+, 0xe870eb39dce992d3, 0x53145c0f62b5e14d, 0x947ac07a994a64dd, 0x35c74d7c35465b91, 0xf55e5d4cb1240861, 0x1da71a2830baf8e6, 0x74f2062f8e76d926, 0x7adfc52d63610335, 0x8f16c21b4812632a, 0x303dd3f4d5d38f1a, 0x51138ecfaa5b2441, 0x59b8607b89a8455f
+, 0xc927e406d0f71905, 0x3f9a48bcbd22b632, 0xc0ea80df8c737fd0, 0x6e73e356e84a35ec, 0x8998cb571651d084, 0x261bee732090d5a5, 0x38626249fd5719e3, 0x799490c9be3fbe3b, 0x7a0a027e8a72f1f2, 0x35ae663a2f9c3b2c, 0x2a44e0f10fc1a865, 0x0536ae9113c3cbdd
+, 0xe0f24e31225c6e0c, 0x1ec3a2fd7d2d8c09, 0x99a36c22a39d0d68, 0x0e4bb775df4e2de4, 0x93a13f3fa7ecb3e1, 0x6f4bf0dee3cfe64e, 0x79da0a8a838ceb56, 0x4a48fdfb44774dff, 0x447346569350ea63, 0x10d1024e4f02873d, 0xa9359878d0660c6f, 0x1e9006193637addd
+, 0xf3400ffaff3f77c5, 0x5638c0cb388a4d95, 0x2aac55efbdb0f836, 0x211350aea891527c, 0x879de19cbf997a12, 0x06eaec9d7606f23f, 0xd314a14c78dafa66, 0x0824e8ff1c4fc255, 0x193ae3d5c229ecde, 0x34c5b79047972e1f, 0x88278c736c6473c0, 0x2ace6e6b5a2dab9f
+, 0x315127084e614ef5, 0x11cb7acf791bd391, 0xc877a9dec5befbe8, 0x7f52b5b91e851243, 0x887345711f50b0fc, 0x20c051fb15b676f0, 0x7d12a790f50b803b, 0x6bfc94d9751f1add, 0x179e1f4b6122eb9d, 0x3da0867f72284ed3, 0x7bc1a08bf7635fbf, 0x6c75b0dfc027207c
+, 0xb2d1d0dd1c25829a, 0x1e2e43156cf9dff1, 0x720928f5662d100a, 0x7d71521de3a9a833, 0x25bad94964d19df0, 0x1589679da2fa1287, 0xfbeca739ccd7b128, 0x1be439f6a35909de, 0xa6e2a646f86a3207, 0x4b0fbf46ddfa9978, 0x417579ea944cac2d, 0x0ca8f7b993369f4c
+, 0xee6c7425d220ffa5, 0x703eea0eb54eba75, 0x0be90a069adfa1a4, 0x329e5ac3bd9a319c, 0x3f98f06856dc7a1c, 0x614855e73c3e11b4, 0xb90a76261913bf15, 0x152cc23626948d00, 0xef1574a8b2b604c2, 0x781fbb8d191d654a, 0x655692abe648aa06, 0x22abed3438b095ce
+, 0xa89edae7eb01f823, 0x737a7438cd292c9f, 0x4b285bd6da85defa, 0x27f43c102d8db8e8, 0xf072fa8d751738ac, 0x3d60bc1cf876af62, 0x055078b9d4a4a556, 0x7526536c552fef83, 0x835b938a06c9ea31, 0x05dbe3a61f4e2c7c, 0xeb7c521b52c56942, 0x76173229ef665c91
+, 0x3d180cbcddda2846, 0x3606e91ae0383565, 0x52c59a680150d22a, 0x351819154540adab, 0x4fee706a11c4e6ca, 0x2906a83aaf852c95, 0xee98c5f4b0785b17, 0x0fbcfed7fe3e9265, 0x8c58e9d94fa15708, 0x306dfe7074820de8, 0xfc9032b03c452f8f, 0x5e929b465417f2c0
+, 0x59a23efd3b7bc134, 0x16adc3c2aca1d251, 0x4e743c85ff4cb28d, 0x727624868fb6fb77, 0x8dc90260bcc2fa94, 0x0439bfdbf7225757, 0xadba88ff946b710f, 0x45c9e75a52a0c753, 0xd7eb6ed4409adfb3, 0x290166c2abccc846, 0xdcb07270bd515610, 0x61fce63f3622eaef
+, 0xa66e17d461b5fec1, 0x3676ab9f1fbfa0ba, 0xe4c7284a7bddf5a3, 0x3b19bc6cd89aa8e6, 0xae1e4466b549014a, 0x314267b18ac7c5ff, 0x5ff10d1089d8cc90, 0x700a949b56b51f6f, 0xb4298f655c54c9a7, 0x726167dbe6fe7a49, 0xee643803108c7c1b, 0x30eaf5b56a152455
+, 0x9218beed5f708261, 0x75367503fb77ad45, 0x157ceb257894cf1c, 0x1f522a65b06ed6f0, 0x899b15785f8c4c2b, 0x692a9f9df7d87077, 0x67d57fed1acd52cf, 0x7376c7b954d16431, 0x30eb89835a367a2d, 0x2d6488780662b422, 0x6a1dbd8f7b887059, 0x15c1f109a90074d0
+, 0x590cf7714a404ac7, 0x57614384b5d05487, 0xa6fbe9a2f9e48303, 0x715c4c2d404f3f16, 0x68567a516336b170, 0x7e5dd9bc9c5c6e6f, 0x174522d13f06f8f8, 0x4d23ed82251019c3, 0x5a94369a3e1d0ab3, 0x7d67f4343016b253, 0x2c83b411b98dc6cc, 0x7e918e3af69290f8
+, 0x8bb4c8ff6fb8fd62, 0x63a061b6eb5de6b6, 0x4631f6089e6223c6, 0x71dc427c482d8314, 0x809951c210b72325, 0x75567ddedc4018e4, 0x476d748ea3c4bf5b, 0x06f88498f9c1bb78, 0x5ac18a8ecc984c76, 0x52a4eee08d2533d1, 0xacb4098c84f4ad4d, 0x113697808d136a19
+, 0x1580e6b4069231ea, 0x1c178ca4e6e4f79a, 0x466d96f4df7071b9, 0x7426a4382dd1dc01, 0xf56e95d6506b82d2, 0x619be07d5842cca6, 0xbee52849d5d84d63, 0x7dd6129168c66988, 0x638198196e259023, 0x6e0099f531eb5113, 0x256c5f708412cb09, 0x61b7380c5fd1c145
+, 0x709c8c19024bc2fb, 0x4bbe56e6928c90be, 0x7bbbcd6785bea8b0, 0x210d502139fa04a4, 0x87e968338492af5c, 0x6d68dcb700427ead, 0x833388e6af0948bc, 0x6272e9223e5fa1d5, 0x6f9eea7042bb4286, 0x4348b3e7dcc20ffc, 0x5d2052027088acf8, 0x68af8f28b05d37a5
+, 0xcef21aeec6ae6f9d, 0x31a9180c820fed1d, 0x4101989d662d036e, 0x326057d22b172a03, 0x4248b86e9b200ee3, 0x105fde0bb9d671e7, 0x291a1eea824a1807, 0x0d7f11ba7f2efbff, 0xe18e5db31ff18d55, 0x38c3097700fe4822, 0x47db50564e640f50, 0x5e275f952cad3bc9
+, 0x564237474980203e, 0x36dd21ab97a85ece, 0x63069362a506b68b, 0x1c2f6be56ee1ced4, 0xdb436497db1b580a, 0x3053c09418d219d3, 0x7c536e259d03a439, 0x7b255fbe144d1866, 0xbb331243d83806af, 0x163241ac0113d394, 0xfcd14690aa096d01, 0x647e21d6b21ff4e7
+, 0x35338cfb0514641f, 0x3547de042fdb7b1c, 0x96ebbcbb97dd9f57, 0x0b0b1dc9d73cb5d8, 0xfbb8e3657fbf1dd6, 0x6a516afa5c8c51d6, 0xa23d776de8158604, 0x36f71e947cab088a, 0xb5ab55caff8ea9ca, 0x57d828176eef5d3d, 0x0ca9fee55f326e9e, 0x31c566ed042df22d
+, 0xd12db6be1eb1bd3c, 0x2b07d2ab876db644, 0x24e67f34b481798b, 0x2dd71dd94557f1be, 0x9c8a9eb376a3fd82, 0x7d9723613886cc5e, 0x874a23720fd55cc1, 0x52b4e7e0df5bc522, 0x71630519e0edcbae, 0x19d32d068292b15c, 0xf9301bb4576c86b8, 0x172010cbfe928af6
+, 0xc018680bb9bd7347, 0x0b6927945a224942, 0x17ff945e9ac4803e, 0x31828d8fe4c049b3, 0xde32b37f329c25d0, 0x6ba97d21687d0c6c, 0x5d3988653bc01a9e, 0x3423a05da18646bd, 0x41e6e6a7ee590f8f, 0x3cee5a5d5512a380, 0xd83a3067c7bb0771, 0x126e6b5597abf001
+, 0x8aacc428d58a8020, 0x0ec9b44c3a9b27ae, 0x3135411f1c0683c9, 0x59f1020b528d3287, 0x75751dafedf76fcd, 0x69c8aa5c8fa07fa7, 0xad006584b6bcaf46, 0x48311a6e8c5eb4d9, 0x0755c86cd49abbd0, 0x6c82057a38f69048, 0x52eabf5f93cec006, 0x57035c8cccf63881
+, 0xeb8e4d2afccef1b8, 0x2e6b33b84e1466c4, 0x0aa7e76aa1ae754d, 0x3b61f08e1aa8d03c, 0xa9cccd9899b77a38, 0x15e2ca1c422c291c, 0x1c75dfe93cfaf578, 0x799a50d6b98515f4, 0x0c8027636f2f229f, 0x2c4a459b71403600, 0x66cf3c4f3f53b1ff, 0x7d0174ee25ef29d7
+, 0x72ba6d0f3a4d671e, 0x15cb1d4114d43113, 0x358f5017d6660f10, 0x1c811baa83b864c8, 0xb5387682e96a8912, 0x2bb3fac26a36b906, 0x45d7cf3e6d86e164, 0x395414e8a9b0ee69, 0xcb5e41b4135411da, 0x44c3aece6286cbe9, 0xc88d697cdd8bb080, 0x091a9c7bcef439cf
+, 0xee8b0864c5453606, 0x0a5ef2e98993ee80, 0xd71ce063ac4a1f02, 0x7602d72d5cdf1ed0, 0x6ea192e8e6d0d0eb, 0x2dfc46c4188bf0bd, 0xbe12e52c2ee80413, 0x3dad0b2c67db4ef5, 0xe33e09a695025355, 0x58aa6e94e14da76a, 0x6bdb979e7d20c94a, 0x238e50d44386f51c
+, 0xea5fe65e1e3632f9, 0x7db53e6e70d70e39, 0x3673e332507572a6, 0x35387611d961e8f5, 0x27f34753335560fc, 0x7d0f1e0def47e1e0, 0x23d4e1351794aebd, 0x1d41e2f529f40b68, 0xec378d884b5dcad3, 0x255cc0ab4100de8c, 0x5abba52030f38854, 0x397d3fc66992c474
+, 0x40811953f8457ea3, 0x147035dad2cd3733, 0x87f2f963c5e8d7f1, 0x22060ba17f2bac6a, 0x1df39cfb3c2a8d00, 0x394b6e5596c98be8, 0x04098c7b02731fea, 0x755a284d5aa6aa07, 0x9d3c8f971df465fb, 0x3a683766fb69e6e1, 0x9bc82941851f61c0, 0x6f196441b5284e47
+, 0xbfe31d13c192cb95, 0x69f1c166d486a07d, 0x1c45cc35bcae29d0, 0x6466d29f6b341a9f, 0x4e8a0025f9a26aa9, 0x3a0e1479610ae4b2, 0x607512482888b4f8, 0x1042a4d3109d61f7, 0x60fc51c63f8eddda, 0x039d1463c7dc60f7, 0xa0ebd511a71c0853, 0x45c0b297ccdb0e8f
+, 0x3929e07fc09eb6eb, 0x69dbc61f47ff1d02, 0x752720117005846e, 0x476563036bb08645, 0xa65443e4904f71ff, 0x48b2737197f1ee72, 0x6c5968fbd30c0d11, 0x2edf1785e1603ab5, 0x6ef7b2863e4e7c6b, 0x7ef7cd687da3e10b, 0x58c1b3faccf96c06, 0x691aa9f13367fe2f
+, 0x7faa6998471230ba, 0x2d8c6570a150601d, 0x0862c0b0b9c8d93c, 0x2d80caded3518f9b, 0xe789a30880ed30ea, 0x67f1b0b05464b5bf, 0xaeeb5d3afda62841, 0x6d4a6bfe87b0da13, 0x3ac8a632440a5f2a, 0x4caa931c5e93097d, 0xd7dfb885f3d9631f, 0x448fc9922e8d0635
+, 0x281bc8cb38e49995, 0x73559b996ed4b0a9, 0xd44e55fd534dff41, 0x4cba3d5c4361d933, 0x0722bb7c00dba5e0, 0x4000424d19f7aaf4, 0x9b7cc9d717208cbd, 0x6468f4b397067fea, 0xad4be4d499ca11fd, 0x5e2adeb360a6fcdc, 0x0e9bca3f486e9801, 0x5a31912a17f3810d
+, 0x2498d5f0db49e49b, 0x0107f8a2a92f5006, 0x2c1c81f989d9a08a, 0x6d0f5f6e4705182a, 0x77f8a23ea4834303, 0x5fbda39037ee8376, 0xb2d2688cabce0d52, 0x3664973b1772fd18, 0x18309109fb6b9d07, 0x6e7aa2f26383f4c4, 0xb13c04487294548f, 0x543060171ff60e2c
+, 0x3f14d3b7b92ed263, 0x467808d9d73c1e61, 0xd3e22b4972bfc36c, 0x28be9da8796ea442, 0x838902de5b800e07, 0x56ae581e4d636e53, 0xe731944149562924, 0x3576a2912157914c, 0xf8bd5dba15aad6bb, 0x157236f40f063d07, 0xf9da3a323b6f2e3f, 0x0173cb1bdcfa3823
+, 0x37a4d8bc1715c733, 0x6b5d3743c6e05b4d, 0xb2a4a4b340c6d6dc, 0x0679194d2ad08f6f, 0x23c8c320e8828617, 0x313abb2cc30bff82, 0x1af9d4ccb2dcfa13, 0x07fc4fa8678ac536, 0x4802edb852246df9, 0x678d51508474494a, 0xc0fd4f08a5f4d6c0, 0x5b2be4555c3ad3d5
+, 0x623fb105c0b04a28, 0x7817aaa770afdae7, 0x3e0408e7cc4b6735, 0x522f2c9cb14a3a42, 0x97c44f8a69a1692d, 0x7ffcedf60d3ef56b, 0x257433f6d19cb951, 0x6c7bf3153395b3ef, 0xc1a922f81cd70169, 0x4662ac45d57f2dd2, 0x69c0959ec86085d0, 0x026b02d004354a78
+, 0xe4e4e6bb5d5227b8, 0x5a1f7a7a3e3695c3, 0xf5bddf21375eba73, 0x20e61d8441452e14, 0x041a60741cd09f12, 0x13db9bb3d5c35473, 0x2c5e678c7bdf13e1, 0x0ea14cb7001e47c2, 0xef9cca678a32d88c, 0x42b358b13f6a07eb, 0x68920519e2fe341a, 0x3381d808a2a25c99
+, 0xc48bdd0d1b2a04a0, 0x484fbb9e75dfa696, 0xfde539a841dc357f, 0x4833b4853c2f31eb, 0x7fd0178468ee903b, 0x0c33a4e06a77b4fc, 0xb3a7f5ef780ca57d, 0x52f68cf3c32331e9, 0xce238edaee163f5b, 0x7e76abcd8c848ce3, 0x305f9d3bcdee9337, 0x07600af917606a3a
+, 0x66eaf8e8ba2be30a, 0x2733bf38bb3ff683, 0xd85f085ec5bdb217, 0x49d12671e58c2ad4, 0x10cd0f175e377a86, 0x23de0f6360f3955c, 0xc19aa19a2a796f2c, 0x0aa3595d4c9641ab, 0x56575cdd363efd8c, 0x49393e81fc082aac, 0x7eb0681125e90659, 0x50c557293e27c850
+, 0x6100e39b040ac558, 0x52f43157f36d79d0, 0x5a0e04e693f8f39e, 0x54d8b1126f0f0296, 0x4fd7530569de5d87, 0x609f8be598cf045d, 0x17634c743799d0b8, 0x10db8a7c69110331, 0x7271cd8499eae373, 0x5322c916c3fa68a7, 0x8f27c66959ecbac9, 0x10f499acecc888e4
+, 0x607ddef3c9d2ef14, 0x3310c6157ff543ea, 0x567c3f649d340ee4, 0x1a47869014125b91, 0xe3615b317d78ae82, 0x57a2cdcafdb020f1, 0xcdd4be310687418f, 0x151928be2db5ae67, 0xa5b0968b20be7a6b, 0x5c0aa1b1bc27e711, 0xd8252ee7f6122424, 0x4feb18d81187a4fc
+, 0x5cbd4f93f00c8834, 0x5eb4913fea3716e8, 0x78adf29647969405, 0x07d5fc924088365c, 0xaa83f20c993eab89, 0x6c884ba1303d1ed8, 0x92160c60be9ac5fc, 0x3a8e5950084c23ab, 0xf9665e3f02287d4e, 0x25f58937cba696a0, 0x67393b84c2728be5, 0x37b00a39d853084a
+, 0x1b5f902878bb0dd1, 0x62a8d81105f8d170, 0xf980db10f7cc44fd, 0x03e13099d795c7c8, 0x4f06c53355350eab, 0x49fd21635f7fe0c4, 0x7f2c5b1e4d7ce4a7, 0x1bf957079561db5d, 0x580771b5f9b30312, 0x5d38a83462c93c79, 0xb72399c33b87a18b, 0x6fb55c2ebf0f3f95
+, 0xb1cf5278e5047f83, 0x370a043086161065, 0x86517931f3de7e61, 0x3eda1f67cb257038, 0x735b88957e041db7, 0x09e72a2ff3901923, 0x0031b570652b206b, 0x2b5268af17e4e28f, 0xed33597c4a2083b3, 0x34e6ad733cf41637, 0x014a35e2d4852691, 0x651a0539fb6ecd1d
+, 0x1195aea390de56da, 0x63b851263aa8aa9d, 0x9cd0708e4831c8d4, 0x48b0be21c4a05eb3, 0xfdc685d09a773b9d, 0x68ab42b36ce6fc5c, 0x6c3f1d0f91b7b36f, 0x3f5a37457fd3d17b, 0xf1e738e12495a1f0, 0x4c08149f921ffcb5, 0x839879af884eb06f, 0x77ddf9744e62973a
+, 0x0c2d0210088ec391, 0x02dda72833e7a55c, 0x2538e9ea64552522, 0x7fe7202aee75f0e8, 0x59e1ec042f27f9e9, 0x12c70bfa497264ba, 0x6b6aa9ff8d9738ec, 0x49998dd32f5ba310, 0xec28667f6324561c, 0x6145b6280a050283, 0x16deeb461ca2e0ff, 0x6a03b152892b2109
+, 0x7db692e75c89c723, 0x0e74678837eb5214, 0x4290ef4acb24eb42, 0x05588c456611cec1, 0xb948a2a0086901cb, 0x3c3d79a759c7121a, 0xa244f1052b9b9574, 0x2d52aff400c4f3f5, 0x9e8d042c42a36288, 0x73a38165b7e998c0, 0xc71df308624f2a15, 0x175946a92b7da16a
+, 0xa63574722c4e0227, 0x0f557c68fda1cd5f, 0xa84de499ba8922c6, 0x103fe58f24eb6400, 0x79521eb55e7b3e3b, 0x5765b463ce555e50, 0xde94f8d181742cd3, 0x30bd98363eb469fe, 0x594e0a5814653040, 0x46b26d217ac98972, 0x0c32286119724171, 0x014ac54bfe366759
+, 0x99c498e65ddf09f8, 0x58f427c2ae426736, 0x962cb242fbff0ffa, 0x44438902016601a7, 0x69b9c0b61fba4d3a, 0x5e24c37863ec4bc0, 0x1aa1d8744244994f, 0x2d6e344482e3aa33, 0x1a8476b5dfb8e1d7, 0x55531a2c4432ad73, 0x5c92f0f1e24979c9, 0x4e18b8a8554fffdc
+, 0x7f0ebaa508ef310d, 0x79bb5d46f3947b71, 0x8535b30d88b1cd70, 0x15e63b3dc2c1f7ec, 0x3c7d04e8da86e06f, 0x7cf6cc4b143555c5, 0x75df3d6aef19259e, 0x6b78603355e2d2ce, 0x0e7f887440ac5ea9, 0x28e29980a3f9d6b9, 0x357bc0e22366b625, 0x501ad6cc7a01cd1b
+, 0x420ce381354f11a3, 0x2f07b23521c55c25, 0x0f5f0738961f8f24, 0x1ec3514786b8e5bf, 0x8714d01841b5a78f, 0x018f6a48b59ff7c5, 0xa5facf41ac2277be, 0x11040ef9214426ce, 0x49af37fdd0b07b1e, 0x6ad1a16c4ae48ad8, 0x30e3af00301f6e24, 0x0def9751304811e3
+, 0xbdbcefa3409b15b1, 0x5a8b1446d6296dd0, 0xe0bb22e8acf11975, 0x3d9ec3babd3bdccb, 0xba17822e86695fd7, 0x370dea68d5368219, 0xb738462483d68e75, 0x01d390f0179db73f, 0xcab56f60d9269283, 0x2a7fad888110f7b3, 0xbc3fa8a01b1e9abf, 0x3cee296338a3a400
+, 0xe55758a79db1486d, 0x20fe46c09c945ac0, 0x9597e64a92015f39, 0x49441c83bb24e5b4, 0xaa40b68cef110397, 0x2e003534b7cf4ea0, 0x9b3b1fb8ac6b30f4, 0x6917307e366d1f9c, 0x5e8a34c9d856a4ae, 0x51c4530ae71999b1, 0x72a5713b4a27d828, 0x7e3e0afa381a7657
+, 0x12f233958704b895, 0x590bc030a389c4c8, 0x94db51ab882ed55b, 0x18bcd732bc5e0535, 0xd30725d44e68d9e3, 0x38918a955e5531f3, 0xcee3a600de7f3b44, 0x188d08fa049b3055, 0x0295ae4b27739015, 0x07f651ac7934d302, 0x0258d32014f1bd0b, 0x39f5b002044cf9f6
+, 0x6e11bd28de728169, 0x0b973821888633d6, 0x02f8e83f47375b03, 0x555e2d5a64d0c500, 0xb6aaf22051b2a06a, 0x19aee3f12cfff862, 0xd4f7b3e48d444b8e, 0x0d45a9799fd31086, 0x1619a7d359634e0e, 0x70cc9dce38f6cd64, 0x27b944acf9feeae8, 0x11e75a854cf9b3c1
+, 0x359a6947c35f8f72, 0x095d5b9acee6b358, 0x41cd080aff4061b5, 0x2ba4e76d8d98ee45, 0x4dd9eff2ddc83290, 0x4fefe81487e0edc1, 0x584a75eded4275b4, 0x6f2083552ca54cd7, 0x01fa7cb2484b9d86, 0x3acc61815d984b5e, 0x2031380a8ecc20a5, 0x211e4a85f87e066e
+, 0xc3d4566697e58bb3, 0x22eb4c24bd7b5988, 0x4075eb7358fc7e82, 0x11a57de2730341dd, 0x3e27e04b544bba4b, 0x576af4c5ba22797d, 0x64dd991dec97f6d2, 0x046b2d2d6b464f33, 0x83637c2afe27366a, 0x5d79313e9034cd77, 0x4e78ca987a01f8bb, 0x2ccb37013571e093
+, 0x812247d11d53bc4d, 0x6802e7273acb751d, 0x2c0c808f6f3d55bd, 0x1ebc08c0b798e8ea, 0x1175e3e743351fe3, 0x06c2156f840d97a7, 0x553b778186433ff7, 0x402c29fc97867f4a, 0x23548aa3b68165b6, 0x3f8f9835c8f56048, 0x6c2f1562b1d80c57, 0x19dd0e1a4f6b3a2b
+, 0xf552bd84bdbd2a08, 0x060cb039e58b5be0, 0x5888721d5b4f9dd6, 0x4da99c7f520408a2, 0xd46f8b5f12ee85af, 0x05b2593b7da9843e, 0x83523eacb6e7d055, 0x74ad04cd657b41d2, 0x02cf7110867e68f6, 0x2bc5e67814b0a696, 0xd5cea6969aaa26a0, 0x5c227074e3f2cd45
+, 0xe18b9dbcfebe42e8, 0x24291159ba3c1840, 0xe39a855d6db0eabc, 0x14f290e447d0d775, 0xd4b49008b1a44b1b, 0x14a1ee7673f79f04, 0xacffd94f5c6b6168, 0x2403d0cc0f3f8113, 0xa285ce0e21a944de, 0x2587f5c0c57a5299, 0xff8b0c8dabafd229, 0x4410a247a8b03282
+, 0xb822eb75caab3468, 0x5f7323db4dcde7f8, 0xbf967f6dd4ffe02b, 0x664d3f2fc6920818, 0x648efaaf8cb1da73, 0x7fa562d4813e7706, 0x63d5c7710906f1e1, 0x77502a9723aaebd4, 0x96dd07e4d0f0ee19, 0x6f350c2eb58da33c, 0xb036684f00720a6a, 0x3c6cc64ebd2901d6
+, 0x24dcb57c051e81c2, 0x09dd89fae29720a5, 0xb88a3a83e3af396b, 0x341d8750a726ff01, 0x22976ffe853e334f, 0x78d54a5138d36a5c, 0x1528601402aea05a, 0x360e0112d1c561e6, 0xf8ac8ee9288c16ce, 0x44689d088af688c6, 0xcbac85576c311318, 0x56f46d1d8e359085
+, 0xa7251b1324645dd5, 0x0058175c4243ed41, 0xd7119da5d554a978, 0x542c2843cb1aa490, 0x5b345d3d5a7d59f6, 0x67d431464953bf7f, 0x8ad4a5dc10d44dac, 0x53b4e380236aec1f, 0x50894254f0c4b6ef, 0x469786778e10d444, 0xa6bc767e6745708a, 0x6321171746c8fe5a
+, 0x888223c65ea3d26b, 0x342a45034f816af1, 0x83df0eeca7d9136b, 0x055e323950ccfd9f, 0xa4a3c185f08a7e68, 0x71470e3080d1f862, 0x084ece5ff1e87199, 0x31b3debced9a6a08, 0x04acf642a98943fd, 0x47381ca04678eb37, 0x95af4e795303e02f, 0x3ca875e3e3e8be1d
+, 0xa399446c1457a520, 0x139640a3e08ab7c6, 0x9dfc84a72f20a698, 0x4e6852df58d836e4, 0x5d3984cf6f1f8d34, 0x625d9592504a0800, 0x48350dd0d80deb68, 0x0c7acb0ef2d790b6, 0x3ba6bd622c5a26bc, 0x34f3deec6be67ac4, 0x8f5be593addb198f, 0x027b8cf2c1486853
+, 0x67bdb73a96894f75, 0x4fe9b94262e56cdc, 0xf34d006513e5a290, 0x56745b2f75761688, 0x8267ce1f2713bae2, 0x3b1099eedd3ecb5f, 0x2f85623b0860d306, 0x4dc6d9dec45a6175, 0x1f768267ae52ed6a, 0x1da0d71a928beab0, 0x503bbd4b08c3f925, 0x5f09cdc89a629ee8
+, 0xc60b847189462fe3, 0x4a305bb323f3c910, 0x44d9fd95b558edfa, 0x743e446e657390bd, 0xaaa209c0c993b1b0, 0x07ddd8c16563a93b, 0x7c27a0762d518ba9, 0x7bb61986fa441345, 0x128d54f1d24535ca, 0x27244845a14b8fc5, 0x80bca39037ff1b65, 0x161e694312e46a52
+, 0x70125244347499ab, 0x1180fb26b299cc57, 0x0a732eaa931a7c1d, 0x12dbdba016d47d13, 0x0968fa368563c27f, 0x48b8d7a89d0cd15a, 0xad64da8b61da7bbb, 0x1c659f3cf7922084, 0x3958ed72a7d627b6, 0x7e608b60e0849123, 0x150b2421a6c4487b, 0x0d3b2efce0b20dcc
+, 0x5af9ae1d6ddb7819, 0x7d3a4a4897803ff8, 0x70ef89fef5efb0bc, 0x63fc3b4ee6074929, 0x95df0ab744858e2e, 0x60086bb3ff4cf4c0, 0xc4ea217780ecc14b, 0x4c9e355488c830ca, 0x53be204632da4c08, 0x5833f1196320eaf0, 0x0f04960d4b281b9d, 0x0ab410b93be45295
+, 0x1d125fa2d1843996, 0x2d073905b18d2d04, 0x60847b2ce647bbd6, 0x6c60f2e4e8cc8fea, 0xd0e6599bbbf67131, 0x13ad04474a848307, 0x84b221a0429050f5, 0x35c2d1df484120db, 0xab39fd3b18a093e7, 0x6c3a80f64aea7a48, 0x230932c5f7c31373, 0x3657cd8269208c43
+, 0xc60ff43f0a43845f, 0x7cada4ada99bcf62, 0x733ce7b12117c6db, 0x1b095a413fdae848, 0xce615253fb4ab203, 0x27c15bd4a5acd0f0, 0x4d0a7a6f99de8021, 0x3ef0a3c50281f0aa, 0xdeeb09ad5f30b250, 0x68d500b58de8ad92, 0xfc70e232eba2553f, 0x2cd663df0889f32d
+, 0xd80629328bb13c8e, 0x1282fcfddc613c48, 0x9fd8dca6c75cf81c, 0x7a72586f99039ab2, 0x72471268a6aece07, 0x459a47e620418fcf, 0xfe0949af766b428a, 0x37445ed01a15b1d1, 0x6a437adf1d94f7c0, 0x1b47ee2ccb19c3c3, 0xda5723d28e317c8f, 0x6cf00679b8f9f4ca
+, 0x820db62487958b52, 0x560f0636e5c5f08b, 0xaf02a62f08bf3098, 0x3b598e55b9a5667c, 0xac2566fc6ebd51b9, 0x30e42d2874b317a3, 0x603452490040fe45, 0x65725c60d43613b2, 0x0b3585ec837db06a, 0x1acc3f2ddb6bb2f3, 0x050e49ab5dd6d327, 0x0050a9dfe5089298
+, 0x6c896274db621227, 0x4bdf44c354e9e67f, 0x07e5ee2a218feb44, 0x2675c897bdfa77f5, 0x1670dd7bb1abae75, 0x3509c415b2b903f9, 0x1380223695ee2ebe, 0x5687c020d6fdd7ec, 0x20f07cbd6bab45f0, 0x2c751d6c4ea20a47, 0x50c113f7621abb3a, 0x2193da810e4c59be
+, 0x469c94daf1ea311f, 0x3cae954acd668c76, 0x10a9528dec7788fb, 0x17282174485d30bd, 0x969595921e08fdbc, 0x757f1403bc234cc6, 0xc5ce056e8d8ef477, 0x7b629742b57eb298, 0x3dd69009c2b1cc13, 0x09e801de5da82b2f, 0x3f5f19d62c0057de, 0x5970857f5ce58933
+, 0xc86e3966f0673fea, 0x2d19104003204e6f, 0x6f899a49e8dcda5f, 0x1e18fb0641f8fcb1, 0xdf66ff8c951b3d65, 0x42238294886abfd8, 0x99890e71b3b200af, 0x0abac666abb6fcab, 0x228acfcc4bea9fd3, 0x1e80ef0cdcf8c654, 0xb158a0e8fe019a62, 0x45363eebb894be16
+, 0x11f8f8ac921309f7, 0x2e9551784484b072, 0x036ff77fc2c06413, 0x5ecf75e98ada66c5, 0x45306394d7b01732, 0x43af818419a709a9, 0x90b7210e7992623a, 0x17f79fcdf273e87f, 0x0276429875858a97, 0x77908443bb1abf01, 0x590bb918a036cb29, 0x01703369836ce19d
+, 0x4d91a822f60d77d6, 0x60c2c4a889d4e4bb, 0x094f1c92b8a33bad, 0x501823cb14e82ebd, 0x3bd588ccf9320a28, 0x53516fe2e439054b, 0xc01771c28e1a368c, 0x3f638331445aaebc, 0x9d2fe35cb42a59b3, 0x47d620a3622b90e9, 0x4dfed3d61d2bbde5, 0x1ff8ae804f39d46c
+, 0x9a9e0184fe8e240e, 0x3f71b54b0d281d3a, 0x29f7b82f67518230, 0x37f5480b64725a0b, 0x31779317dad4baff, 0x5e6ee9c1264e7f6a, 0x2c0ab0fcf7b8c6e1, 0x75f9cfe9acb788c8, 0x54ab91e0f0024d16, 0x7bd3f77082bb4743, 0xe333a969aeb04c06, 0x3f8579ca97417ecd
+, 0xbf7eff2b1799da53, 0x23e8c4a07bab347c, 0x3851878e6af0a43e, 0x1be60c6d54f5dbc2, 0xbfb3572da035d90a, 0x00db7d3aa9a1faf9, 0xd6262b12ea77f791, 0x61f1b59fd700b904, 0x2b1fe8b7d9e30632, 0x026e7ac1a0eb48b6, 0xbdcae1b1138155d6, 0x51fb397f8dfbb7de
+, 0xd7a9b017e0838691, 0x35f8b32a33a9fc90, 0x3b0e3c0317bb20bd, 0x3643a20b9d208f54, 0x3acb7ee510abffc8, 0x750844c68d8c7bb1, 0xd7be92e1379ecf62, 0x00b1081f46da3f8d, 0x7344e6c1f4b30b80, 0x41de7c7be137bfc2, 0x3dd3d3732cce52cf, 0x5f05d6e52f95431a
+, 0x4990f0866d7262d6, 0x78953f11595ff095, 0x426a837147a9c212, 0x1c02cd38ba598bd8, 0x9b3ed15635d71977, 0x4a970ea69e0f6edd, 0x89de4623e701c4a5, 0x00e0ac39a077ba01, 0x1bb59a277b859ce2, 0x57253090103ec656, 0x0b6d3e054ebca247, 0x0115cedd332c4265
+, 0x4095db0cc6bcc478, 0x505b67fde2fc996b, 0xc8996404142df048, 0x1c08e5bfcff4fd2a, 0x367ae59674e0da82, 0x399a3ae00d61ae3d, 0xc045e2d3f36a7358, 0x15d77bf06d691f45, 0x210554a5236c9692, 0x4ad5084da46a8e84, 0x546debf860888ce7, 0x34e2056118b2a8d8
+, 0xbe00c89357461b55, 0x5ee3d8b5ac12fd08, 0x09923cba41d2c976, 0x642a4ce46dbe3a58, 0xb4f74bd7e2200973, 0x20af3cc8d2998ef7, 0x19aa7ff6439e4f93, 0x3edcb7d7b981b19e, 0x03cd447adeea1d59, 0x50ea5570536d14a3, 0x79ca5218d23f8511, 0x0385eac8b6f9768c
+, 0x6f209515449360f0, 0x45523cc27e42ea9d, 0xc8feb2c8ccd69492, 0x1044392718b94572, 0xc61251abf5de1a9f, 0x5644ac030db04660, 0x48880935be5afebb, 0x72a05457c5ed44de, 0x93ef86474fb7ca47, 0x14bb81570556b16b, 0xc9ede09055c331b6, 0x63e3a92fc218bf1e
+, 0x74a531ae10adfe76, 0x4cb4928b1315c34a, 0xd63e204c74ccaa8c, 0x7077c1d76a485654, 0x2626d4584184ca5a, 0x72577235e269a17d, 0xe4801b1139879578, 0x5df7680330bb166c, 0x577284b9c84b9160, 0x2affa298fe2ec3da, 0x1da13da400fb5426, 0x503b4987e429305f
+, 0xe1e8f4dd5d13f6af, 0x3c911dbb882cc8a5, 0x12d1eeb53eaa8d60, 0x245e4fbf97d7622c, 0x10865575cf6e5dd8, 0x7faf298ffa9b815f, 0x5ce92f2c5d6e079a, 0x561dcde22ebc0348, 0x0a5be4865f3aa47b, 0x6de220eb5f0fe285, 0x6f651077497a9c07, 0x69ea469920ec417e
+, 0xd19d877ec8b70ffe, 0x7fc34b7f803c803b, 0xa7a1d6d7e9666f67, 0x1791faad0e9a6c0d, 0xefad3829e546eadf, 0x6913feadc7e560a7, 0xb419a384ed927200, 0x677aedc2d09baad0, 0xc5cae3338cfdc57f, 0x3009cf79e5d1b99a, 0x43f071d02cb11860, 0x08fb548ea60544e2
+, 0xa3536e6559cb0eeb, 0x328c895496717001, 0x0d97aa87d5833ea3, 0x037150b3e421d6cb, 0x12e9ac46eee19b21, 0x4d166398eb1bfe0d, 0x1beff6fe968ea21a, 0x0ac5571f5f4ac5e4, 0x99f596ad50d2b1cb, 0x333e887dd16e72d1, 0x21d3dd00cdd57551, 0x13143156253dbb65 };
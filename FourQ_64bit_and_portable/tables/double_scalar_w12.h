@@ -0,0 +1,4109 @@
+/***********************************************************************************
+* FourQlib: a high-performance crypto library based on the elliptic curve FourQ
+*
+*    Copyright (c) Microsoft Corporation. All rights reserved.
+*
+* Abstract: precomputed table for double scalar multiplication with WP_DOUBLEBASE = 12
+************************************************************************************/
+
+// The table below was generated by table_gen and consists of four mini-tables each generated using window width W = 12. 
+// Number of point entries = 4 * 2^10 = 4096 points, where each point (x,y) is represented using coordinates (x+y,y-x,2*d*t).
+// Table size = 4096 * 3 * 256 = 384KB
+
+static const uint64_t DOUBLE_SCALAR_TABLE[49152] = {
+  0xe18a34f3a703e631, 0x287460bf1d502b5f, 0xe02e62f7e4f90353, 0x0c3ba0378b86acde, 0x90bf0f98b0937edc, 0x740b7c7824f0c555, 0xb321239123a01366, 0x4ffcf5b93a9557a5, 0x297afccbabda42bb, 0x5948d137556c97c6, 0xa8189a393330684c, 0x0caf2b720a341f27
+, 0x892756b15bcf68c4, 0x5742f77c98a526ba, 0x340a5a1de9f89f9b, 0x14ef680aee75d0f7, 0x84e770e14043a41f, 0x0212c41116c33c95, 0x35b791e6de4dc0e2, 0x5949df08518d5d28, 0x6a0e120744ed10db, 0x5a5183ce844391d3, 0x6f618b158afdba50, 0x2ce2037e470e2088
+, 0x1f49fa149a64ba3c, 0x5f9876d519670451, 0x030105056f55586b, 0x020f1a557d8fd726, 0xdf4cb175b06d86c8, 0x694fbcbe7fe58390, 0x7933294a756a1b67, 0x09dbe9924b58f8ec, 0x590f4403cdf197b6, 0x1c07969fc87a0ba7, 0xc496477712252367, 0x5508976022f1b096
+, 0xefda361e452e1775, 0x7a0a0cccacc838fb, 0xb07e791c0be5dc5f, 0x24d9b6b418cbcb93, 0x497970f3c6117e03, 0x3986a158cb96d595, 0x8f80586ce692612b, 0x305cafda7e4df9d6, 0xc1a1c2e06452914a, 0x7ef989c0eb583079, 0x3a765b1f7364b099, 0x4fee236d58299c6b
+, 0x6f81095f770e8419, 0x53bbd86b7396bc09, 0x2b72ba726b2b4210, 0x625dda1d2901c78b, 0x0ff5bc7b18cd2b3e, 0x0556598c7358d332, 0x0991245f20ff50d7, 0x0e7f58e5e919a97e, 0x5a0561373b758756, 0x6447bc93f87c198a, 0xf9230604c34c7520, 0x6b214425475c1bfa
+, 0xe93de62d6a7f9497, 0x2129459d86f4493c, 0x456394c7c464cfe4, 0x612434fec3f4a1b3, 0x1ed91eddf44261f3, 0x0c6d3854f9e0a3ff, 0xd3fd153188a7e4e3, 0x24691fbdca16910c, 0xbe97465cd7625c9d, 0x2aa61cd373f759f4, 0x824d5763a326d62b, 0x1a0ae39e50da20ba
+, 0x32d0c8481ee4c3b9, 0x6c3687109cdd18c6, 0xe52717142fbf95da, 0x67bfa41fb52ce9c6, 0x4e24d6a088a01474, 0x49a6ca0ae3fb6626, 0xd67f8faa9103191e, 0x674888f5aa6d3062, 0x4ba73824c2e85a99, 0x406b2fd18d35b314, 0xa7087b1bea728ac1, 0x11d2f222317b160e
+, 0xf8946e007e23a469, 0x22a196fabbce31a2, 0x5309ee1bdc1216ba, 0x240fe9953827a324, 0xf9fcb89b63aeb5c7, 0x603b8149ed16b1b0, 0xb1f1876c02cf61fb, 0x4a5e32af612f948b, 0xfc491aede69a8813, 0x1ad9379136e53aa5, 0x5da50db1d5e6c123, 0x2f4014f7fe2c12ca
+, 0xe4f6791d7685c3f5, 0x4c218521c3745a9b, 0x0c0521af98555f97, 0x1462a12953cada7b, 0x0bb2ab63d6452c1b, 0x5783c531ec98bb87, 0x737def53605dbc9c, 0x49f982b930e86719, 0x75b16790cb5211e3, 0x45ad6574cdbae99e, 0x1062b72dfeec9851, 0x45029a09cc468c88
+, 0x532240de77f3a1f2, 0x17bd291eaa9ad0ea, 0xe0a2d7efc2f8a0a0, 0x3a7412052021778e, 0xb0dfb0976acc90df, 0x7fd603b689a7b1f3, 0x1152579ccb00d6c6, 0x6340743b631849a3, 0xebaa47290e0cda01, 0x143265a6d53fef0b, 0x45325d6fd981e75a, 0x0e9780cc39586f2a
+, 0xa4f68d207a8628dd, 0x50d230b51893e841, 0xf3bd769a4bb504b6, 0x55975c063969292e, 0x07727ba25fb8756f, 0x07ff86cf8ed731fd, 0xef57fa40cc35a1f0, 0x70753a70874218fc, 0x615954e2342b973c, 0x5aa9d68f1a59df86, 0x3b8e9e9ff5e44468, 0x2e749114d60a3d23
+, 0x14a1b91ec176db4b, 0x55f91a63d69aae6d, 0xf42382327b1b6d27, 0x2acf1f475facaafd, 0xfd9069b479b58968, 0x3baaf4e5c4a45f77, 0xa2ac9ab98a7aaab6, 0x5466cb5018f50981, 0x3e6ba27771ba3205, 0x31ea90cdea1bbbe4, 0x0000416b5c557393, 0x464cb0415a510d7d
+, 0xd02087d206ff2bbf, 0x2b9c8ecd7fabe736, 0xb2b56d3842caab0d, 0x046ea0b7767700a7, 0x113a7a889e317310, 0x5992a354bef7d0ca, 0x3edda94ed50388bd, 0x052661f767839154, 0x4c28edf6e19e28e0, 0x1d19c2f2d2f644e5, 0x5d732148db35ab3d, 0x680c4714b83580f5
+, 0xa374f282bb80ccec, 0x789e609bc77ae11c, 0x10d2577d599b45f2, 0x1c548b5b857721b1, 0x7baea726b4543fdf, 0x3c1562912d1b4ed2, 0xd6362203b7e82082, 0x1414e523d3c7a900, 0x7ca349951c1d23a9, 0x4da4265e3ce80fb4, 0x7981ebbcaca9ef36, 0x4ebac9e5b5bf980b
+, 0xabd2c1dcf49cb5a4, 0x3f54acfc25c6340f, 0x202eeffabbd11cbd, 0x67216b7cb3695e8c, 0xff7cbcf9b23fc9f1, 0x2eebebdff7fa7afb, 0x71156befa111f85e, 0x1b8fd98df522902c, 0x6b28ebad62519791, 0x6cf0ea960e01d8ed, 0xb4617bc2006967d5, 0x323da065cb3df0ad
+, 0x31687d0741e24d9c, 0x02db8f2b509a7cc2, 0x9243f85924320527, 0x68c360f01d6e6d2b, 0x2351c5e877d5306a, 0x6f56ccfc85c5f3a9, 0x1b09652837c4928f, 0x0b3337554c83f971, 0xe2931be2ccc783ec, 0x46829694ba08c64f, 0x9f35e36358e2c6ac, 0x1474b333b000d170
+, 0x24d792756fc96640, 0x618fda9fef868c5e, 0xb7ff5b125afd9375, 0x778dd97e0440c258, 0xfbff314886219627, 0x3417e1e1e2a7e811, 0x21e959a88f7b7bdc, 0x3508c2eb8c3c8672, 0x827ecdde111c430f, 0x21bcb19fb07aa134, 0xe0c1fa50ab2f5746, 0x401e680b4e6658fa
+, 0x2cc24bab313693cc, 0x20541c12b964447a, 0x374975b6fb81c3cc, 0x52905efb344e17f7, 0x79c5c9b56d8b5f9e, 0x3390bf75d2b9a3ec, 0x7ef3807d895bf4e4, 0x2814165a42046b51, 0x7f8cfd09326fe158, 0x3232fb4f4c9762ec, 0x5678d6dacc194d25, 0x6f7caffb0a7545e8
+, 0xbd981637b23e7963, 0x691d7b7cb88a0ef5, 0x10ba319ae2062914, 0x06fb144f8295a85b, 0x80e620976bf62f8f, 0x2a425971ec73d6b4, 0x800aa9e741d10b1c, 0x230d7d8bd1a0469b, 0x65aace37428dfe8c, 0x0fcab5297f58b667, 0xcf0e9526943af7b8, 0x7d90915b75d4dae7
+, 0x7455a46156259d6b, 0x29bcc06374cce1b5, 0xf2fb0ed3aa87aefd, 0x211a06af0e54dd58, 0x6c0c95c5723de9bc, 0x6299b6ed25008ca7, 0x7fd63e784d4dfb18, 0x2cc93b4d9bc1db30, 0xebc7e2d44c5d13ea, 0x3278e18d4d3d11a0, 0x349e3dd25a215f79, 0x7eb2a7150b30416d
+, 0x05f3d7d5f6a094cb, 0x2a3771d48e331405, 0x08ef39e9dc96f009, 0x012248373a364992, 0xf758f92fc9fd4d33, 0x2339d8c6dfd3ca6c, 0x8b000965962673b4, 0x746ff43eb99d9054, 0x47ecdc054a422eff, 0x33d8f7c8267b7f0c, 0x22fe00ac921a42ae, 0x31e57f3d31fcd8e6
+, 0xbb912315a1c50869, 0x4ac8cdb0fa7ebbaf, 0x0541d74a60973edf, 0x7234900334b2c5d7, 0xf2e545f730adfa33, 0x224e44e63db5ac96, 0xfcba3d005c6fdeb9, 0x2c93a4e6559936b5, 0x7727a0d7ad88d758, 0x2e33100216719cdd, 0x7b2ef89aeb2c0254, 0x1f6de5b74758afb4
+, 0x6ae89047114fb321, 0x3d605e9a6ec6d80d, 0x18e915c727a874d8, 0x699088b5e9d0912f, 0xaf9344618e056f10, 0x1b9169df8245e0b3, 0x5eb8c33d70f4c891, 0x1609ddfb222b13c3, 0x8131c885d1b366ed, 0x7bc3cf9d9cb1a7b0, 0xd297478d2fc93968, 0x13cbb4573a4ea7f5
+, 0xdd37b5cc64d5986b, 0x7ed3d1d7d81ab5dc, 0xac53485f23973c9e, 0x0705675d333b91d7, 0xade5d213c43186c1, 0x6a8bdf57b4bfdf14, 0xa87f88a1de717963, 0x17f29220b519bce2, 0x7af2d7fb0f95c610, 0x28d1d3923b144a7c, 0x8e73c3d8972813e1, 0x00100b40c62e72c1
+, 0x84de7a81fa1f50da, 0x4fa391d6589d8244, 0xbcc3596f0834b285, 0x4d4acbd60a24e9ce, 0x97fa98b8c1835a0d, 0x33abcf8e29901d0b, 0x60a73d1975b3d082, 0x60666aa4325b948d, 0xad54adb769284a39, 0x227a98d113609b28, 0x4a1e1ffcae6a3872, 0x1e4ee44bd67f818c
+, 0x5a74c6bb4387d315, 0x019428c0b1b18795, 0x5cc153e270bbb055, 0x2b3cabdf00dc4a61, 0x834110c026924b57, 0x2d30e985f2d9f217, 0x47116979333389f5, 0x53e3fd6a18202417, 0xb1393cd79c2e5864, 0x58d92935e4112e82, 0x86989a7ec8305b6d, 0x42a8fe4eee28f37a
+, 0x74e212ef01591901, 0x3277917a0397b1b9, 0x7bbcbe6e3d687544, 0x0b8957701d09afb6, 0x6cfbc8ee74503668, 0x48a9925ada9f8348, 0x57045753ba2d0f4e, 0x7d69ca3866223d66, 0xc7054ce22917271f, 0x41bce1e1133b51de, 0x3a3ae42df81ec35e, 0x7eaada0f42d47cc3
+, 0x13b138f1048a57cc, 0x64f98abd7e915a8f, 0x7af195eb16a0c732, 0x11be81a791d634d2, 0x97d8df47430f61b8, 0x0767c7b381271004, 0x3e949136fb940aa6, 0x3bdee340cd956dba, 0xb250ec4ff91d2602, 0x4cde2454d47f59db, 0xaf5e749530d978cb, 0x5a8e2f2119d4d835
+, 0xdf1cb5425a0744df, 0x3d3b08a7bf35d055, 0xc6335e832de4719c, 0x6eb8d97e09154d42, 0x2f6a3f8de3d20dd9, 0x13f23cfd276233da, 0xb4a6b80dfc0fa41c, 0x58d876403acfd7d7, 0x2ad422078b8e139b, 0x73dbee2abbaf494d, 0x09a2758891eca3c8, 0x6ef9a9f1178b0938
+, 0xfc7e9ecb90c637da, 0x3a04345fc10b1a7c, 0xc024e9cb62f9ff1f, 0x6c4f9c3aa4aa33d8, 0x049d6995b95ac1f0, 0x2243845195763a1b, 0xa1466a31700ac276, 0x600fb7123a325905, 0x9d391a64a0d35a24, 0x3b093b550641f108, 0x2275de5bfd2e221f, 0x25f5e7465963db1e
+, 0x3e220107f7e7fb84, 0x6f06a23bc1b85a8e, 0xb4198d19f6eb0e48, 0x5dc11761dad45fda, 0xba303e492ab52a0d, 0x127c69c73da9f528, 0xd3a5b70cf6c790be, 0x0d72b0c50819da5c, 0x193f90d62ec2cdf7, 0x67f7d0cfc4f46daf, 0x7aec083d52f380ea, 0x7c0a1dda4a28bf4d
+, 0x46fd20fe6008cba7, 0x7a588c914115d595, 0x8fb1d3daecf45f78, 0x0851dac094e7b036, 0xcae0a76e2a32a892, 0x104f861322dddb2f, 0xb79d81e46e1f9006, 0x1e4d28d7a2498912, 0xaf3175d3974b89bf, 0x613d00f9a69c55c2, 0x23f6883e8e65226f, 0x072f7ed65c6def05
+, 0x6690e643bb38e243, 0x1a81c4a7c9189b15, 0x1056d1669e4749ae, 0x0137f2a7418f190c, 0xed3192796e699d16, 0x3ed76db45c38a37c, 0x78e86d1475a88243, 0x45985aacc495b16e, 0x47d5c8208e8f1030, 0x6dbe5f68b4d0e782, 0x08d3d0182cf7f26b, 0x64c375ce172fadbd
+, 0xba0f6db3a20c2875, 0x57e1d90a53241250, 0x0315433fddf8e63e, 0x33344750e37dad9b, 0x62cc0d28ae69b016, 0x435fe80f6100d547, 0x5874aea8669d3df5, 0x3b96913f8264d4a9, 0x738067d6bb1314b0, 0x48cccf24cc6f4ccf, 0x6f5e2bbd68b777af, 0x34c2c37ba9635d66
+, 0xd731534900fdbe5b, 0x4e4f9d97afe11d43, 0x81b41214351b73d7, 0x1d48d100ad11a5ae, 0x2a4ee76628e2b151, 0x34902e901877efb8, 0xb5a8561a0fd45394, 0x44317af6d5cd5ac0, 0x354c2469e9068bad, 0x0771fe2761cad022, 0xfda76ee8212d0f2b, 0x76cdeec6d4435495
+, 0x55c98575b3e825fd, 0x2983325ed5d73a1b, 0x563c4c4fb3f466e7, 0x731b0fa413338bb0, 0xdeb519ca57a05240, 0x7a7e909b5c4f7351, 0xefb7c153dd2ab28e, 0x11ca1c865dee30b3, 0x013ca8348d9d7de1, 0x575e0bdaeee8cf9a, 0x464c98a21083af7f, 0x683ddcd85c212ee3
+, 0x1171f0ab4cd02019, 0x22c7e01c7f4d64c8, 0x972ec0ef3f2e2ed3, 0x623f83c2611a476c, 0x99b3f16be9aa25a1, 0x2d3ebc5468990e0b, 0x5d5fba8546a4d5f2, 0x4716e6919d2986e3, 0x3ab2f2bc183f5d6c, 0x5f6257d3910cd4be, 0x341c6f2a78f94f2b, 0x6ee8390b8a5064f5
+, 0x9d8640b9b83ca8e7, 0x033c5ad24466be3d, 0x6f6cd68db30dfd59, 0x52aa6b1c0f90f3f6, 0xfe7bcd4c97403646, 0x11ab3fc960b05fb0, 0x24584b77575896da, 0x427f8deb932da137, 0x928a28cb505306f0, 0x04ae916fe863820e, 0xaabaa98911b9cd3f, 0x59e588ba994d9145
+, 0x9b8f1afabeee9e9f, 0x04ffc7ef3476ff8e, 0xe9cf53ce9937b146, 0x73fe42a801524448, 0x224bda3cf3bbaaad, 0x5fa85056d59884a4, 0x8e6eead48345726b, 0x09230936d41736d2, 0xe679eb58d1ad6be7, 0x08bb759b530b1eaf, 0x9688eb527860e24b, 0x13704d2daf9af278
+, 0xd9273ac71b906f14, 0x57ee05fbbd40deb5, 0xb7788e19ba9e61eb, 0x7967b6dc1c5d9699, 0x36e043fc230127c0, 0x2a716598bb2d519c, 0xc017b2840d4d1b07, 0x1d3bfa489f756a3f, 0x4ad73abf24318d36, 0x1915e6f53e12625d, 0xb219a7c941f89084, 0x2280087a8f4762fc
+, 0x8eb280345fd1b4e7, 0x55b8d4ee5772fd79, 0xc9e63a787e2ce2e1, 0x685741adbda93885, 0xffb830ab11a3b491, 0x7e891121f9356428, 0xc03aea271a629078, 0x71c45932930a2639, 0xe7df192a6bf81795, 0x704aee8f183aadf1, 0x06ddb55a8a7a63d7, 0x52556d8763f3033c
+, 0xb76b458c6f0c33a7, 0x28666b87c362b95a, 0x365ae575a4c27b9b, 0x36ef35110562adfd, 0x89955dd8d927f9c7, 0x526e787d6a586c9e, 0x762e0bc4eff988c1, 0x6c9523b4b5ae4946, 0xe90a909688cfe95f, 0x658a7dc8b3ffada3, 0xbee148ba7a58520f, 0x6819007d8573d1cf
+, 0x75d3b5ec141be9c5, 0x4bc236ae634f3c27, 0x1192fa9b8b30e894, 0x4129d43e1d092cbf, 0xfcac068558bbea45, 0x513e8d87b8116534, 0x5377a179a155ecd4, 0x6c93531e5545572f, 0x727df81ba09aad91, 0x07527139dbc96250, 0x150320b1d8ba172a, 0x2281e85f60a1809b
+, 0x7164b7d524eba6af, 0x50d387163fea4ca8, 0xe90de17d62aebe78, 0x6ab369ba28c0410d, 0x17d07e315a95d138, 0x58b496352453fefd, 0xb87a04dbbc101b92, 0x40a8f0fb757e9b0e, 0x2148b48a696e64d1, 0x4e004a3a350c17d7, 0x17927e9f386b563e, 0x29da9cd441e3e3c5
+, 0x883d2dc357417213, 0x2e94653ff7862644, 0x53a37af548453df1, 0x04475db3c300b93b, 0x2d65fa4d815e7204, 0x231a2db74c2c3ccd, 0x1fd734c0cf4d97cd, 0x32d255c105f6d122, 0xbb74fd9201eb07b0, 0x12e33f1c81ac6f60, 0xfb9a6439bea97072, 0x52e14b7db9cdcbc1
+, 0x637ac1a91ae374cb, 0x1c8622c35adc8224, 0xeb786c50a64b7d33, 0x362823a7232a5893, 0xf22dafca688d472a, 0x18598f0e0237f7c4, 0x97b8497bfff4bcf1, 0x7abf4cb27a9c5b7f, 0xea47c44e3b3d95d3, 0x58728fe3e1827a43, 0x7fd3681a6df902c8, 0x6db1dbbdc413de79
+, 0xbc4effed1ac3007f, 0x7f31a54744887cab, 0xe6559b4f8bd2519a, 0x18a78ec5b0c241db, 0xf6e10285b15d2030, 0x5c1323ea219a8ff4, 0x134b6f20dd116b47, 0x5d0abddbc8998733, 0xa3c993938702e151, 0x0ab6aeb494f6ad5d, 0x8cf3b4beda1815e6, 0x546ce323008c2fdc
+, 0xa10eb5a6a78dbe39, 0x26d2e8a8b8457da4, 0x026ccbe31517d806, 0x2a35174b812f562c, 0x57d70499dd7a374d, 0x3368f951acd3c5e5, 0x490b2515f901062c, 0x316109e7c315c377, 0x32e20eba569535cf, 0x496a8c39d667d709, 0x5578096dc44d5e0f, 0x608a162ce73903b0
+, 0x6b2e65852cb37cab, 0x75b09a2e6ed609a9, 0x7ac84b3082602455, 0x7690cbb594e84b94, 0xfc85dad9511973fb, 0x738a74b08c9006d0, 0x83233fc939d5883e, 0x7fbfc08b5db3c9f4, 0x81a0e493fb5f7749, 0x2c255ef7e69a77c1, 0x234f02e609cc656f, 0x5960cf0b961f3cec
+, 0xac72940237b1f17a, 0x434e038a29d446ac, 0xca6a090e00d8b0c6, 0x1f1aad24001e473e, 0x6d64b6dc133399fe, 0x0899ba41e9dd4607, 0xca590b3f25bbf5df, 0x57217978b0d8ce11, 0xd6b4cb13da6de9ac, 0x3c88520cf564f75d, 0x649fbd5075a7757f, 0x3f2593b90fe72161
+, 0xe1bee53e91dcc9a8, 0x010069dce4c74a92, 0xef83968978aa855c, 0x6cd8848183b53d73, 0x0b3df59610e403eb, 0x713225d446180a7f, 0xcc23112cc59850e2, 0x105796b670a3730c, 0xa147f4ec7a2fa4cf, 0x32da1f072d75b253, 0x4e7007455e85f560, 0x76a5376a771fdd60
+, 0x47eb4fabdcc699f7, 0x4e45db6334c6ed96, 0x36066f2bab72546f, 0x04f48065593ecdec, 0x3fec02793fbb5601, 0x122f74626b64a526, 0x21d0f66ff83b4dbd, 0x1370610ede647f1c, 0x57b82242b88172c9, 0x527dcbadfdc65ade, 0x5e9c9a04385c93f5, 0x64d1cf9e52548a6c
+, 0xba0073337865c994, 0x633ee14e50bcd615, 0xf840228ec4251095, 0x49bb96812a98f08d, 0x82f57d0422f96678, 0x06d7e43bffe7e0e1, 0x33910cca752ae863, 0x04d46e7c66087e38, 0xf14935c4167017c3, 0x3f22e2f44d03c9ac, 0xa6196244f2cd6164, 0x15a2b4ce514fa4db
+, 0x5191a04c4abbd0c4, 0x0e763360ecc8a19d, 0xfef583c184a673c0, 0x75c2f30a7c7433e7, 0xe947a55547c7c099, 0x245c7ae44f6e7a83, 0x67a666f9e6bec2d4, 0x5de0b922fa645ac8, 0xdd9b3e4a5cb72e22, 0x0139c2c857adba8e, 0xa7feb68e863ac231, 0x501381ef88ec2da0
+, 0xb2b8c6a470f40b01, 0x051d65bdb8363062, 0x4ce90414a6d65714, 0x1e510b525d19df0c, 0x569e723f5d374cf6, 0x4bfe02fd38fde1f0, 0xae7459ebc50f9aa2, 0x0f7e2cb170dfde32, 0x3c3da2326a7407cb, 0x0cfc50a85ffd1842, 0x62ab34c85e85c3c8, 0x22b4d9644bb37333
+, 0x57d313b3d87c2d98, 0x4f432c1cba49133f, 0x6163d11fa4befc0c, 0x1ab94e122fddf12e, 0xfb7c9358aefc85a8, 0x5b20068f81d949b1, 0xcf8ed6ff2145c810, 0x5794afc021932d00, 0x5c8987ad9b6e35d5, 0x6bb1f4b836fda03e, 0x794f1fed4a3ea1d7, 0x0cf6d128deb0e7bf
+, 0x54ec3e1c65878cf5, 0x002811763ba2200e, 0x382d917051e77b71, 0x49e00cbd013a9e7f, 0xccf576e9a4cf019c, 0x4b4a66287970333a, 0xf772168915edfc1f, 0x278eb5eca6479685, 0x8a95c8b9cf41cf06, 0x6e58c9c7826d39db, 0x478e119889f2fe75, 0x73ecd21991bd98d4
+, 0x26e751fe9fbb9502, 0x29825b71b0632e95, 0x21668f96ef8bb5c5, 0x2f2a899e53c9a004, 0x2803292ed4345ce8, 0x72731055c7c65dec, 0x3aaaca9c4b6fe9a5, 0x6228d3ceda8bd671, 0x773e2c5effc48eaf, 0x017ab19e0fea9ac9, 0x9609e10496c8d766, 0x121e89f9b302c30f
+, 0x4e87d00a0be96480, 0x09bd8d170ba9dbab, 0xc6756f947ecd4e52, 0x2c9e40bbbccd0f5b, 0x42a5b77669fd812e, 0x66aba9583b080d9e, 0xee55df99d16e77c1, 0x4cc00c5c5eff2509, 0x8c84d5e20ab7c16b, 0x00ae5c96184ffefb, 0xb295e90346dcef54, 0x5d1bda0a39dc3b72
+, 0x75f92d72a89b5ef2, 0x259d998c9ff9ac0e, 0x8a1cfb72a6c433c1, 0x23f5b71d49d67604, 0x478d8f30914f62ef, 0x08fe61135218eca9, 0x4da2ce9bc6488c4a, 0x15f1eafd35283e2e, 0xc2d2be3ebc42ea0f, 0x2a5216539d6ee902, 0xa1e99052e7bdeeb2, 0x3a8f2631ec78290c
+, 0xb71518a82ebfbfe4, 0x24700671c46ebddc, 0x6ef52d591a221f75, 0x4794614db6a67d92, 0x761f5c8ee4bab607, 0x31d9dd8f2361b5d5, 0x1a45593be8db3b29, 0x7f06c365eb116260, 0x9d305a66e52eb65b, 0x5edcfcb5613eac18, 0xef34fd28154adb75, 0x790f805753b9d742
+, 0x6ecd5ac255dfb797, 0x0cbe14db5d9a88db, 0xc1c86c5efa815528, 0x2c636133ba59d887, 0xc75d42c2d9f52297, 0x4bd3540c21e2ebd3, 0x32e7cdf790de6903, 0x1aae3c9837d3e30a, 0xeed028e49d436f09, 0x779ae12351efed1c, 0x6e0145587d9797a5, 0x25156e4cee9a407b
+, 0xac2fd82f2ac57119, 0x7f8c026f1d182ed2, 0xeacc0d8fb3241611, 0x5968db65d2d7545a, 0x7d525846b1121dbe, 0x57949fd7b80339cf, 0x471fe9bec9b66c01, 0x5c270057f1268efa, 0xce092463083f656e, 0x16e8241cdc862cf9, 0xb7cb2bbcaa06b312, 0x3c25936bd8863416
+, 0x19b8ca966c4a3827, 0x1ae43badfd21e63e, 0x1dfd002b95a6ac6a, 0x4708e27f6d98e997, 0xb5fd6322dc31ac7d, 0x53baf4d9a16dd550, 0x025aa2ea5463960c, 0x5b5b33c7a3cfa54f, 0xdba287866ee96b90, 0x4748c1f3f3a6dc4f, 0x2333ec05a80c154b, 0x4a47745d5b99fb96
+, 0x7de331eaf403d7c6, 0x2dbf3a9f975a4b09, 0x175a8ac5d108224c, 0x6697ae0ed57bb18a, 0xcea23805c213e2c3, 0x59f1b8656d5690db, 0x4baf460a10b23798, 0x0077832eabd82e13, 0x52888a23361cb298, 0x30bf5295c5f64491, 0x5960339ec97719ea, 0x5325cd922cbb3403
+, 0xc5188bd69618e85c, 0x296f922d9ad41fc3, 0x2da59f8bff5aed90, 0x2662cc4c60ee7ef2, 0x22aca98c8405b59e, 0x043bba596dcffd8e, 0xb467008e9b87aa31, 0x1d65fdb88da19ed3, 0xe042f460ccae713e, 0x101118018bae77e1, 0xd0f26b4a5d91d8ad, 0x40770de987e00c67
+, 0x53ab21e43a35ed5b, 0x341f9cd6e64e6c84, 0x6ef8e7e707c1414f, 0x33610011d1f942e3, 0x4b019af5f2f8e85e, 0x12ad7ab4b14cf6e5, 0xc718480b770cf12e, 0x7bda44448dcbf840, 0x98bb0351df202365, 0x4b38527c6dce9c01, 0xcbd28185a819ae02, 0x7a19bcca37fa59b0
+, 0xafa3722439957660, 0x06ebdaf0dbeb7593, 0xde81597f08c3ae81, 0x33b9907bbb96d4c4, 0x3f43a76561db371c, 0x0e89a1fb68f278c8, 0xe5aed79a0680ced4, 0x4a032dae33d5d6db, 0x2db5b64487ec9e21, 0x4a8ca714b7795d2d, 0xfe9bd0c1cc1c91e0, 0x0bec01459b9b7e42
+, 0xcfa0d0003cb14725, 0x75aa85468a1e34f3, 0x68f5bbd1abf452f3, 0x249a902b7ea02a8d, 0x71ca331692213631, 0x0e54b1b6ccfadb84, 0xd13bfefa0cb35163, 0x618352c16fb97576, 0x6b6ce9a365e7e495, 0x60a6cd627054aae3, 0x1f7e7b55d56dbbf9, 0x58d1869caa022006
+, 0x20ce35661383a949, 0x4ec74a9307323d21, 0x7fbad803d6c7844d, 0x2b23d3a55363b681, 0x061c0444341b7999, 0x7e4ad0cab9534234, 0x7b09a8cd488f6621, 0x7bde5e652073500e, 0x906f8593e41d1d0b, 0x1ecc6829240726a4, 0x3de8b88854db49ac, 0x3cb4c48361531c6f
+, 0xd8d85e6921107a60, 0x24e554cc92a75021, 0x6b5fe5fcbcc564e4, 0x0b5de8db2c7373d6, 0x166518f4256f8548, 0x57f6145b58ff55fa, 0x6bdcea5977343779, 0x0b95e29ab237a201, 0x193c9909e331942b, 0x4711abbf14e0a184, 0x686611580e5381ac, 0x308709f072c2db2d
+, 0xeb5589ddd7d9a990, 0x5b09e1a65ba35eb0, 0x61f6c9a74817e89c, 0x4e22f6a84c22dfa6, 0x112d33a0173d2f20, 0x193ea2419f156077, 0x10d1fb4462291b6e, 0x3a04fff11f9c8a7f, 0xc8e86ce9453dbbde, 0x75d32f976d9e2215, 0x6898256d3553df64, 0x4a38a72818ce3195
+, 0xba7ab98e8bfb2485, 0x5df853641e170004, 0x5f481c3ad7b3456c, 0x4825b571989fa56f, 0x3e0e2e6b4f655362, 0x2c97bd263589ab17, 0x7582463ee78c2347, 0x70e9bbec916bccb6, 0x0f36d4da0df4cc36, 0x30ee10c22e770e49, 0x0f52b5b93f9d6b09, 0x4e1f3e3530d38a79
+, 0xa19c54a8dbefa553, 0x747e26c087af7d3c, 0x5acd907ea3af54ca, 0x4d31ef8cf53a018e, 0x5b3481e0e6e631e6, 0x27f2d6af0fd5f2d0, 0x1ff3ab052ef11644, 0x01e2dcfbf701b419, 0x6ad2af67df904dfa, 0x204c02189e92877e, 0x396203c9981e6c88, 0x7c958b47c85df4bc
+, 0xfed2ab02e210a9ff, 0x3eb4500e53357ed1, 0x70ec77b1917fa474, 0x64798f496ce73592, 0xdcde3ef7f5acd7ad, 0x6c28722996c55849, 0xa38e3d39198e4fc9, 0x2b67a90323847be0, 0x1b9c80b76dcd3881, 0x7e6827d0c31c22c4, 0xf549196c29955177, 0x70b3a2fa63f58460
+, 0x17ecf97299f1217d, 0x49d7e5395866ad72, 0x712713f371ffff5a, 0x2da796e3c6324021, 0xca7cc235c205f2c1, 0x5a191549c8fa2c18, 0x762ae5e9801d96bd, 0x3bc404f3dfe7ca55, 0xa435aa939fa68581, 0x2272fe5fa650d21c, 0x521728efcd0c954b, 0x6a87874ab6d92c7d
+, 0x08ec530527d95865, 0x213f4a6eec3b5aac, 0x01f239f264c69bab, 0x79d3914709659dfb, 0x0147822bf2e152d6, 0x597da9429eb1d00d, 0x53b186c4e48297bd, 0x780453c29f8a8407, 0x9d032b1ca55e9c6a, 0x095faacded03dce5, 0xf084a1922d90c84d, 0x3c7f3c63bf2b5d1e
+, 0x8ed82c9c8e738a49, 0x6c0a5ae703e53851, 0xe5800b12853d6516, 0x448567f95f0d4a6e, 0x48c5ce4694c05eac, 0x7abbb6d65f03c789, 0x3978f9f03a787ef7, 0x2bed3fb7e01fe962, 0x3a53d97b463f2914, 0x6bcd285fda5dbc99, 0xb4dcb1e7b4d21122, 0x6292a941103e4849
+, 0x2af115ce04087a96, 0x13bc28aed2ce02cf, 0x80084ed3b6b0bcf6, 0x7043d078ac6ec426, 0x57d2ebcfb8248e2d, 0x11037609977ade94, 0x2a47ef7b490f7ec4, 0x5e931f7f19313e0d, 0xef1ef971fe096895, 0x0a8ffbccdaa075e2, 0x56f429e40d8a7ea7, 0x6833e75b85f36cfd
+, 0xd35ce62175461a48, 0x74ec71e04d808393, 0x7f326b71f59deb92, 0x29c5d31fc74cb57c, 0xc9a1ba0ee1594691, 0x50309cf410c64327, 0x2f1c06585982d6a6, 0x7e5481e973d8226a, 0x97c6d087edd595c2, 0x737206f6d0a1c07a, 0xde2e03bd7fa23561, 0x656d72cc6dd817d7
+, 0xe10b039612b94505, 0x2d6fb956ed83c3b8, 0x4fead845e2941bf9, 0x41a9ae74c104a27a, 0x1529d99120b05fcd, 0x11eae3edba5f0c95, 0x50abae45600ecd7e, 0x216ca492fe86592f, 0x8f7fe5f6c767b404, 0x2909c3a245709855, 0xe06c3c67a52efa72, 0x229e540a8a27b7e9
+, 0x2363d7a3d678c9d0, 0x6c4da342c773bff1, 0x79c1c73458efb069, 0x0df082e7147a1f13, 0x097ef650bc872e87, 0x4b7f2a5c47b70332, 0x6ebaec218476d2d7, 0x4faf61b79d35ec9b, 0x10d2b8821a30d816, 0x7110115345446cc3, 0x233e2392b970b008, 0x0581dd500eb0810e
+, 0xb5eeb1bd02dc638f, 0x7ac02f76f7a98d95, 0x68eec55246772fb9, 0x6c96233bad65e418, 0x97f6d9c27ee5dad0, 0x7363cad93efc076e, 0xf56a5ae899248a44, 0x5fed54ab474b9cdb, 0x2541a9ed8c3cff4d, 0x1ff71adcba409ea8, 0x23f6903439f5f49a, 0x5ebc02ab425f29df
+, 0x47330d9c9cc86c9e, 0x0922b6484d6315d3, 0x2c92760fb309dc39, 0x69f2d4c42982053f, 0xf60b0b3692610d1b, 0x4288b2529eed2487, 0x19f6df8e728518e1, 0x7ed72df2ca9d2e0e, 0x000be435e9d94394, 0x4269bae655dfd472, 0x4b9fc14d4d2cb063, 0x4960151c560696ce
+, 0xad5af562181141df, 0x42fc7a987541ac37, 0x48a958d5559d0784, 0x55e915ac361b6945, 0x28d5cae68365a9c8, 0x557a923ad4f00fef, 0xd8de5906f7852678, 0x366730dded2f8fe3, 0x50dd40314dda6401, 0x51f1ce228f4648c6, 0xc60cd1b637800e70, 0x2c0425c06cbc5e11
+, 0x1ecea34de4ec51d8, 0x428b6621bb3a90f4, 0xdd5f32ea1db8352e, 0x125f8e393fb2824c, 0xa924c04732ee23a6, 0x05b648f88943e747, 0x69210c31b0bf5fef, 0x34c8512a7c606a2c, 0xca82c22008e028a2, 0x68dba8d39ba88759, 0x82a7279fafe0a9e0, 0x4172e55bebc009ba
+, 0xaa0903c842c194a7, 0x02a25da5825d30b5, 0x92fabc9304221a84, 0x63ae6bbfbf946e83, 0x3252c55aa1907d39, 0x7c88bbac57601e5d, 0x774b6b062e09ba6b, 0x779d80c17d8a33fe, 0x2fa605a0625cf2d7, 0x398e85db50b93dae, 0x83b949a88e464a67, 0x1aa90b6e44a1ac65
+, 0x00d8bbfc769d36df, 0x639b97dcdac7e245, 0x6e2e4286997776ab, 0x1b2bf57698602100, 0xe0493b978d4308ad, 0x16fc7d83fbb17136, 0xc27f3afd419c4027, 0x5ac8996edbeb49db, 0xeef91deb27083cb2, 0x6b118dba1b751084, 0x065678cc7ea61da9, 0x396d10a86ea9c22d
+, 0x79063e14e21245f8, 0x71f68e22554b9fd4, 0x90ded03c6a76eb57, 0x7f5683844a44a054, 0xf80896746da52b87, 0x2dc9cf1d0a44727f, 0x8f77f3a17026c613, 0x160bc731152d577d, 0xf4c8fa214ae0740f, 0x008fcbc4b5c4333d, 0xb193ad74c55794c5, 0x0e6d79dc26409465
+, 0x3ab520687585ee3b, 0x69ecd0abb4476b11, 0x40116d615ce7caa6, 0x7dab654340cd862f, 0x0c643cbdf1f722b0, 0x4e22e8f0481847ac, 0x578be8fac849a9b6, 0x5a92c91d6c7a463a, 0xe1c42011edf6bd08, 0x20df122eba94d963, 0x1df44d1d95c9cd29, 0x618527ad2c979ca6
+, 0x21a497654e7038f4, 0x17d66e95083f0b9a, 0xefe5a140ae72d56d, 0x53839e315a8cc027, 0x0baccf35628e2857, 0x5c2d100120fe95a8, 0x0a47af78f5b22ca9, 0x7797ddd43b58ff8e, 0xad64d75d1d63e2ba, 0x5fb696108970be6f, 0x02bf12e23e5bd0d5, 0x3d8ac9db92a62e0c
+, 0x3daf5b3ba4627ac0, 0x6c98ff5285b52420, 0xb4885b91176bfc22, 0x38fb84158b8c3f0f, 0xa9b5b6dbb2377aab, 0x68ab86180fd8d43d, 0x1d236cc012c4ab78, 0x2d4b375b30da0712, 0x3ed7120f613bdfb0, 0x4de3f1c513ed06ad, 0x4a04841acec7d91a, 0x7d1b573f27594e36
+, 0x6b71654bac4e167e, 0x15e6407197c7436d, 0x1b4b2123e788b92a, 0x66278be32bcd713e, 0xcf31aaaf54702468, 0x48566b8097851ac4, 0xd48a06a5898da730, 0x00af4e04ba87862c, 0x9da474c9454f228a, 0x02fa8a701a1d55ae, 0xb72e4b299b467227, 0x4c4f80ed606e620a
+, 0xcf594ae7453bbfe0, 0x502c363b8abd92d1, 0x22da668e7767f41c, 0x14f1a98bf7e5e593, 0x5ecd14a4187635c1, 0x60369f5a5d787276, 0x1012a0458a4dec24, 0x75a59f9428e9ae1a, 0x6f9e13e07e9efe69, 0x6fd9f4de56241c82, 0x86a417aedad9e177, 0x381107ef34fe0888
+, 0xda76a2176c979ca5, 0x449e8be61bac95c1, 0x201ebbfbbf27376d, 0x29790cc15a4e7ccd, 0xb51c7b2ebfcdff91, 0x0f3c5b76961565cc, 0xab01c9b01a8fa53c, 0x2a30e527c88a1bc0, 0xdbf2216dd00153f1, 0x370dc4bc432e0815, 0x8980ee99bf0f376c, 0x13cd165b4430e38c
+, 0xc7b66be019616235, 0x7de52145c16aabe6, 0x6fce19a4c2160133, 0x7177b857ddd54f7e, 0xaa70a16e210ea129, 0x0412f7e6ae45cdac, 0x23c54b48ce6976cd, 0x4972202ff0622d47, 0x553682281363ac67, 0x4c5d892f15f94243, 0xdd3f60443ea0baad, 0x5b1ef37966cc5b73
+, 0xe0f0e3a31bef51e8, 0x0b2a541edaac6981, 0x69539fab5be9555c, 0x3e624340a1d34ca0, 0x37db080a75ef381e, 0x57366bc799278e0f, 0x9cfea6d6e5918b89, 0x65314e20020383d0, 0x24a752a3089995bb, 0x31d8e53d80cf6d3d, 0x9eca917c33eed711, 0x4700a89969b2e222
+, 0x78a826d5bb364329, 0x5b341783804dd4f3, 0x16b3921143fe7a9c, 0x2119679d9fed6f03, 0x84284df0b4afd4ba, 0x3b8a5e7af8f74954, 0xe663318edf3ab780, 0x2193954419aff9b6, 0x9d6899d7297175c5, 0x01fe06de9dc2aa6f, 0xe3da5400551d83e3, 0x32b973ed718172fd
+, 0x16a03d2cfd5a3d34, 0x4f36a37747bcc291, 0x70fe0abec210ab43, 0x69cb9936162b2ea7, 0x4f9b5301cadad19e, 0x32a2938355c03cd6, 0x2e4849a3107eb06e, 0x7a30861eaef4fe43, 0x87095b2a71c6b2c2, 0x26904118df8b2972, 0x4161551e03f82809, 0x5323b605512125a0
+, 0x4791ec410c13ac42, 0x3d0abf87d56b11d1, 0x4a666e84fe9ba3d5, 0x4f3e5f59eb34aef9, 0x3c801b09f9d4c694, 0x53985943e8909586, 0x0c99618bb496ed1c, 0x61da8dd14cdeca2f, 0x8810a12466ea0030, 0x2dc8ecd8c641d614, 0xaf343cf2ee41fb99, 0x10563936c2979426
+, 0x624fc1ae14ea0ebc, 0x6df482493f9e1b72, 0x916db66b075e1de0, 0x6372c81016d058b1, 0x7075f92dd6476b2f, 0x05cf92e8b4c37eb6, 0xd9f61e57e037c1fe, 0x258f622f3f28cfed, 0x6b6082dc871927a9, 0x2084603b65e7324c, 0xd2adc29e4deed0c1, 0x45b185654f4b6a7d
+, 0xc67d6abba2cd7077, 0x70e37e300d70a93c, 0xcce5e4eae0abbc54, 0x6ba8f95309073cee, 0x38e483cdf1807dbb, 0x0a25b8046c17d45c, 0x6cf18dc8cfd49ff7, 0x2c46fa9bdc20c983, 0x47491c3842059704, 0x3b907a5142ada29c, 0x891f775524f0bad5, 0x57f62ce63c84ea8b
+, 0x1ffe528f4308fef4, 0x58633e53ed640845, 0x4f3f4cd88b8f7992, 0x1b485ee1731a3679, 0x8859af0f84cfd821, 0x7c194775a2626e5c, 0x3c218f391e18efd1, 0x273456b04eb50e30, 0xcdfb1fd0c3750ac4, 0x379a20510493866b, 0x0d7309a5b41df649, 0x04fe6c30c2b3400c
+, 0x5dd110b2173e006d, 0x5ad1321def2db1fc, 0xef3afacfaeae905c, 0x2a586a1df422eefe, 0xa12f1ec34350cbc6, 0x787f13361a7d8dc1, 0x834a775220575674, 0x398f935de6dbc950, 0x2372945941d6bade, 0x14b63d1596a87374, 0x59e2bb71dae3010b, 0x6df6892578758e92
+, 0x18a91147ff0c3475, 0x29339dc736f5eda7, 0x94372aeb17298090, 0x03cd4b6762c4e56a, 0xce5454a4123630d4, 0x22bb03f7e1b24d06, 0xa78d2acfca390603, 0x635418dfc37f8b73, 0x8dd7c2ee0ab9662a, 0x09c8d1424647357d, 0xaf10b9e2fedfc4a9, 0x52805f675de06d66
+, 0xa205c36834ce683a, 0x4a8782e35b58269e, 0x4a952d8a39091ba7, 0x68048b2d283f0ddb, 0x0ddc690ff013cca1, 0x493acf228058bd0d, 0xfef16c2230d30df2, 0x2785fb5fbdbbe4e8, 0x20ea6062fdb081d1, 0x3f574f8a73cf7908, 0x66fa42434d03fc08, 0x356e091e12df010b
+, 0x20d3cb8185648b99, 0x5a2b83332dec71af, 0xb4204e7f674b1129, 0x10c089c9040d8234, 0x6861eec4fc63f315, 0x67d870537ccc8f73, 0x79b7be27922150be, 0x00c2b5860d903eea, 0xf92d81b78684e4ae, 0x46b1231b49a2d411, 0xa4ab75697858d0ef, 0x5f0db595046921a6
+, 0x83fc50168359a56c, 0x31a62e680a5c717d, 0x31a81b5967cb9b20, 0x71f8e71498a8e62e, 0x4a9e14333cfb805f, 0x79e12b4ca670ea86, 0xcaabc8af8fa0d204, 0x15134e528e6bc672, 0x30db5147dea6af32, 0x70c0b127445c7e38, 0x4b6eec2468ec95c1, 0x5f63f9eb908145b6
+, 0x6a7868a6cacfa060, 0x72754038f1ec1fd1, 0x0891f310df745f7a, 0x0c9658009b7aa5fc, 0x1085b6c54a1c35b7, 0x05a78950af27371b, 0xefa75ed68da664b9, 0x28193357ef9301f2, 0xd210231d72688084, 0x0c4722704a2a30a1, 0xc362402a362d0899, 0x32c18e242663a442
+, 0x9014857889ef7219, 0x68d5e66737eadeed, 0x2a80d6a2ab1f2ba1, 0x32f9acb9e1aa8c73, 0x26949b1346ca4325, 0x4318b819afa37b98, 0x644e741ed72e3c90, 0x70b52851302b6904, 0xe53a7d1e15e1d234, 0x3516d7f96ef3ad01, 0xa3240982684e76e7, 0x74a91ee1f288b565
+, 0x77df389b8242128e, 0x413c379e1268b023, 0x33c254209ea6bf8a, 0x70b91584d25c9e0b, 0x158a9cb257c45f45, 0x3738561050e086a0, 0x0303f6a517843483, 0x19c30266488a2947, 0xc266cf4e80c9fc0a, 0x62ca21b9be983a18, 0xc1fd17de230e7183, 0x5dda4862cf241baa
+, 0x8dcb31571aa1d430, 0x760480607337cc65, 0xd7ff642ec7b290e2, 0x61f97996e29cf758, 0x18e72489026a0a2f, 0x4f0b9dddc0b5718c, 0xae46384365a11860, 0x63d2350d7c1df8bd, 0xf0176f562f8629d6, 0x73bc81248804b345, 0xba58474a0daf1045, 0x77770def17498083
+, 0xf79a0352aa7eeb65, 0x2707e8b5debc592b, 0xb06b1e71d7a99cd0, 0x65e97567c8fe0d73, 0x486f3856e13e7626, 0x50de3156337ab93b, 0x1be4d6effdd124f7, 0x4d58403c76f0473e, 0x7bc6b7097c783993, 0x0112ffdf51a85117, 0x268d3ba82267a5cf, 0x63de8cf19e07776d
+, 0x03b7f01fa786a02c, 0x358505ffb43fc5f7, 0xb335dced80426e71, 0x7d1ed9bdff932f5e, 0xf0fc43032119bf4e, 0x65ace2914bf57449, 0x3e7cb029731c4b3e, 0x4c67d23b8ee2bf2f, 0xf9e016fdb46d6077, 0x079b11429831e813, 0x5204f1f3f09907e7, 0x4246d9cadda327ad
+, 0x6594eb84824dc52e, 0x60a8b8eb91630a55, 0xddf1ccc868b0f311, 0x4607b9cd41d6eeac, 0x603b69aa55e2caf6, 0x51c689f5e5a0011a, 0xdbf7e269da5588f6, 0x47ea73f6e792d570, 0x811d62bdd7435772, 0x5f2d28030f8e6aa8, 0x0214d3053977aa00, 0x6513c0be4c61ae2e
+, 0x026bc9ae4fed6c91, 0x21f3cc9de5d5941f, 0xfd4c1c7af197bd19, 0x1459c22f2a67f567, 0x34e74a259a7167e9, 0x093aac658d9a1aee, 0x23819fb7c701e784, 0x24a380f20acd36bb, 0x62b469ef30686e1f, 0x59b3429775216465, 0x46bce0e7fb2a7b02, 0x1bdab2ac6702aeb1
+, 0x72d3bab333fed7c6, 0x6dfe62ae54757ffa, 0x92c912d0e31cd7f8, 0x5af090da6a033e44, 0xe542380afe3516c0, 0x3cecc63e8059faff, 0x05d93efa14f84cee, 0x0cd0d735b2bc51c0, 0xdc0d65ee5006f717, 0x18eb83338cd44e4c, 0x94364ef9f7a0e763, 0x3a703c45b5b79b5f
+, 0x1ebac624487baa62, 0x003218158c03b754, 0xcfa845f2c415578b, 0x23075abc3f7badc3, 0x26f38842c86eddd3, 0x6a2efec55b6d91c4, 0x33819136844a3dcb, 0x771006752a0dd159, 0x4f75a6e8564df9dd, 0x047c12f418d78b92, 0x107ecd0464130bca, 0x0286c41cf751ee93
+, 0x91b1b88cfa3409d6, 0x7a9da6e4c8c225bd, 0xcc19766cfcb39bb9, 0x5b8c15aa25f24768, 0xc634c02c97c733be, 0x638321e7cdc0e1a9, 0x57bed72b92740e9a, 0x1f9cc67c4e780e09, 0xb2db50ce372748b3, 0x622390c699692705, 0xdc2166cf52b4aa73, 0x2d9997fbfd281d9c
+, 0xb683cb37808c7422, 0x48e077b394f27c6a, 0xaa9e56e70a9a2cbb, 0x565b15f48ef22b09, 0x3492f8e0f0d59730, 0x25ad9ae790f6a474, 0x55f94b70439f7ffd, 0x60fbc4761f60d147, 0x2fcdecbae5cba6c8, 0x60d3907dfd30b1f1, 0x06132ca073ecb802, 0x77c16d5f82650f5d
+, 0x65d5d0b321bf012e, 0x1d8230c02bd7afd7, 0xae5dee32ad1fd1e6, 0x49eb4eaa577e0a0c, 0x80b07fadffa62071, 0x212d0b36432f2580, 0xc105d063f6f5d87d, 0x439d2da88e83ecbf, 0x25061be2b2a6e9bb, 0x602dbde636ecd30f, 0xc31c8a5678c11bfc, 0x0da2ec0c791c4434
+, 0x494a6702ebd3ca8a, 0x7706b177fbc70078, 0xa0d923f7436e17c3, 0x5352d29eef25ea48, 0x625a933247a347c6, 0x67b0b475011216c4, 0x74df29a571bbb5c7, 0x3d80890ae7638511, 0xc69f4ff3a09f98fb, 0x1af46d1de77327de, 0xaf5419127803d1f7, 0x5c6b1c0fe26b6b8f
+, 0xf9d2898eaff8d376, 0x0236a56a55c21cc8, 0xaf4a10854c97b1db, 0x0fcd1300b182d51f, 0x896f551e5dddb547, 0x5da4c2eb48f1366b, 0xffe2d68bb9eb82d2, 0x7c66cf6cb2ef4cb7, 0x21313dfa0b5b1cb2, 0x1963d5ec5fffb471, 0x9b79ba03e7b8dc8c, 0x73a5b065748222de
+, 0x11f618700b377379, 0x238106c5f861866e, 0x32330cd5c0e077ce, 0x62ecf690a361d071, 0xac9cd6eefc23f1bd, 0x47275551c2c19f84, 0xad8e7bd5ee6cb60e, 0x7364b8069cee33e6, 0xaa7044ec211b56bc, 0x6742ab7e6e4e21c5, 0x81b8d4fca63e031e, 0x01f5d5aaeda25bb7
+, 0x9ad3e9e89d85ab49, 0x429a895eaaa04a37, 0x81f10de3c18a69f4, 0x65feb0fecc8c6358, 0xc46d7efafd422aba, 0x59a633001933be68, 0x2fe7f4c38842e8b7, 0x200bbe14c3386a2e, 0x95538e34d23d2260, 0x29be712859f7c4df, 0xe1c0741312c8b473, 0x18ed5c36eb363d91
+, 0xf97d5c75e55bfccc, 0x2e8825862fb23092, 0xf8a9b28891764220, 0x41688a475d6094fe, 0xf9accd4dc8303b1e, 0x7ca15f47726948e9, 0x49b81f50feee7499, 0x7681b4f892ecaed4, 0x261869e739d8d767, 0x10e1b2fa41a75abb, 0x4983005e2e1c2c82, 0x02b7f9d8fcb3a91a
+, 0xd98d65e78e7b9f66, 0x43f503daf84e63fd, 0xfaf7dce82ab1c791, 0x39fe687010b6be85, 0x6d2cbb64fb7fa175, 0x4043579c3740ea86, 0x41b1cb9f76e0102c, 0x726b0114af6aced8, 0x11baa3edbef2b73d, 0x3be648d1315909fa, 0xb6344e40049d2111, 0x28921b0abc311e27
+, 0xd29361fd8e8da56f, 0x4ac502b07b28f917, 0x1eef67d4510b8630, 0x737c326b11572eb1, 0x9234efe8ec438d2c, 0x22c49079eb038670, 0x13244c23055f2c18, 0x344ffe71e17103ed, 0x2c65a3f47bfd1056, 0x0438fdfede70fbd6, 0x6ac1e851f72ff65e, 0x1574e3b649e476c3
+, 0xdc5cc89931480327, 0x1d85445c67cb7048, 0x9d71054013d30ffe, 0x4dec44d8cbe25bab, 0xd6b8aac8670e49b8, 0x5a0f19f1fa459b61, 0x75c233326d83fee1, 0x69ca5ee63c9bdc74, 0x7a33a5a16714efbb, 0x209d8da5e0e4a035, 0x9b4572e1e6e92122, 0x4c0d8c596e57f42b
+, 0x5949b4d9e0bbd51c, 0x4675c1cf64aebba9, 0xa8791ceffe8558c4, 0x47c317d4c3ac10b5, 0xb22de6b77317583f, 0x255155dc8d32edb9, 0x7b09723e02522d67, 0x30ed4b9ef0e6462e, 0x22accb6676a95047, 0x5526d4f393e6d308, 0x0f4c7a83ee25c1de, 0x3f78f81d7c097871
+, 0x1484823ab51346dc, 0x43e8e91ebbb82cf8, 0x855297b029c003f5, 0x0f16f5c6fb51592e, 0xf54f4f8869159cd3, 0x634ca6f6490fa0fd, 0x6617ef45e9cd8fca, 0x2da4c9a6a83d630c, 0x374ee5c45e09d912, 0x796558dfaa0cec4e, 0xc5cef4cd36a4c27e, 0x28401dcb11137b42
+, 0x822ac82602224e3d, 0x2b04edae5e8d6e6c, 0x8b0b78e5696fb06c, 0x06f3229a7243d703, 0xa8834b7b2245ec4a, 0x08ce0e54a9fa8a7e, 0x81ba206b6456c459, 0x2c1d6c1bbb52ced6, 0x2f33909afeff16f6, 0x604431af1ed982f1, 0x6a8476a5da77d214, 0x2b217f5c7e384388
+, 0xbb75d05046de4c4e, 0x34e934d108a0996f, 0xcb4c13def18696bb, 0x4291d7afab5cd8eb, 0x6fa4e158a205689b, 0x1ce71b4a6b5e1782, 0xe1af65e28457a7fb, 0x69a121857482f041, 0xd7bd31a1c8f9c12c, 0x52973719dbd6ad44, 0xa6acebf9cc5f18be, 0x50e5ac2a514fe90e
+, 0xa096f0423c7e2b73, 0x3ff11551cabd98f3, 0xd8c6ed1448eecab3, 0x305831e132db407b, 0x691ff7fcdcb7fb85, 0x5c52e6f3a0ae4ab5, 0x354eff46ae47e795, 0x0f2355d7fcfcc941, 0x530f050dcf548e33, 0x431274c516f61298, 0xb5a85488ee25e66b, 0x19099434b0f65880
+, 0xe5dc623e3babb538, 0x7871cae3b0a2726c, 0x8a28bbbf676523e9, 0x04fbb56b6bd49c7e, 0x9df31abcee96e05c, 0x1de36fd9ad5304de, 0xd2819927ef07de10, 0x5afd6548ec345c8c, 0xeeacf11ff57b6f0f, 0x7d6701241c8865a1, 0x54aa90dfcf52f82a, 0x7698bef07cc07c46
+, 0x04daa787e22eb67e, 0x15d461b64bd952ad, 0xca314bfb6c89a5b2, 0x2654fcc546c27687, 0xf189a2cfd96caff4, 0x7771c4c644c747af, 0x5666e1119610ca54, 0x316b15d7804961b3, 0xee0c84610e1eb836, 0x4dd7128ca90f1378, 0xbc508575f537cede, 0x17ede0be5cccc4ea
+, 0x507ac955c04173e0, 0x39ca8d9a7f132ffc, 0x24f55ad22a159daa, 0x79f3e0923e4adb09, 0xcab7f11e87f3ddac, 0x54137f925fb8bf28, 0x6a30cbd334053a6c, 0x569806b9a8983c72, 0x3593862bd49b3052, 0x711c94e6076dc6e9, 0x10f1679dd17dbb38, 0x5c97e53e863d51d4
+, 0x1bb36f907f8a4183, 0x0bf5ff578ae08a44, 0x04db7e5fd7ac0c2a, 0x05d93d32a5413284, 0x5781a742880dafcb, 0x135864180ec90ce4, 0x0a591bbc2e411072, 0x39c0c882e1a440d4, 0x193a84ac40bde23e, 0x0edb094d1652c11c, 0xadaefee872d45f22, 0x72695fcb44976098
+, 0x05c86cc33fe7bd09, 0x42946b4be248975c, 0xedbd78462105c02c, 0x625f29c07178d88b, 0x84c77873af8b992c, 0x5624c9edababf824, 0x73940f19221c0e9d, 0x6047f5baf0247202, 0x75f8fe828cc77f56, 0x167c134b770d92a7, 0xd073694cfac1a48f, 0x6747cd0df261d898
+, 0x422e9747b8deb773, 0x3892a45e8634d15d, 0x0b592cb6e0bd7da5, 0x74fc9a2b531f2fc9, 0x24782f3430aacd43, 0x5f92bfdf6fdede59, 0x175dafb576a2bb06, 0x01048dacff30cdcc, 0xdc8f3ee0321b9df5, 0x1c21d8a1d1817783, 0x6d9fe1c54cd3a0d5, 0x73298c741cdd6020
+, 0x3d3cdc03f31f81fd, 0x3aad019164d1012f, 0x6d5a5a7572c73ffd, 0x2417bdf7dc869d38, 0x6ffa7d46458e315f, 0x3cdd522ffde929c3, 0x06a17a20c2adc83b, 0x535f10d95f839a56, 0xa797344aa6648cd4, 0x35633828b4cc4655, 0x67be406a2ff668ac, 0x084ae76a8e00b59b
+, 0xd4cdd1104c5b7fc2, 0x2bfe747aee7d325a, 0x93bac5225864d1bd, 0x010e10174351acdc, 0xf8080d30ab4b9df3, 0x1a31a68c35550b2a, 0xce00e973a5a0ac16, 0x7956ffa4b9903290, 0x28fd83a277041969, 0x64e6327e373e2eaa, 0x489f4ef4365b39b4, 0x423314a3949cc9c9
+, 0xa0d01b0a11211ed4, 0x48c855dd2ead698b, 0xeb5ed796c6a60041, 0x3f588881923de14e, 0x661a1482b0faf06a, 0x39b4796da52acc42, 0xcb7ea05d1b4440f0, 0x0c8c65236cca2d82, 0x3f70ba814d2d2a2d, 0x1c7246e4c79958e3, 0x5ac1b7c5e0297435, 0x52e64b0cd3fd65f3
+, 0x0f49e6d4137c24c6, 0x45837e8d3b728b02, 0xd845c52c9fcae330, 0x4ef86690acb3f570, 0xd7c108424fe21943, 0x20b2c176746fd439, 0x98a8d44e7a2ffe70, 0x5e2db736b7fd98d0, 0xd09c1b4a1817ae91, 0x157c10d2d586566e, 0xef341b8c53d098a8, 0x26860da500a08787
+, 0x6462a948f4367852, 0x2ad762ebb60b4dec, 0x95d88977cf9f5545, 0x7927fb22828593d8, 0xd13b480a325a6061, 0x7f05b689bad83f64, 0xa71fcfacfee8d664, 0x7ca2ba3e75e25c78, 0xc6a5d0228b6de588, 0x01b781668315265a, 0x5520b6005fa1206f, 0x455a385f301cd5f1
+, 0xfc9f398269f2677c, 0x350000661a6a6f43, 0x7b12a433f0410711, 0x72f7d008dbcb557f, 0x71b3bbdcb02f183b, 0x3d030cf582db5457, 0xc443cee72be1cf69, 0x1b4d00368692a34d, 0x0e27a72fe7b67c66, 0x7fca35133788ed5a, 0x7836c9ba157b3842, 0x4b7d3a719eb5dcad
+, 0xdad4315721ef9d7d, 0x079db42222ff9401, 0x4828690225c147d5, 0x6f4bdd575f1f6010, 0x52ddc365d4ed9ffe, 0x5c4cb3a1310da36b, 0xc8a50c13988bd994, 0x263f085702f701a5, 0x60ffb04ae185c98b, 0x15d23163bde49d50, 0xfcbb7daece61441e, 0x700aaa76174cf10a
+, 0xa0974ebba5c532c3, 0x2b2d78e0a2a94844, 0x7b3cffafe3a3d4b5, 0x581eb518f0548d3b, 0xd6b0dbb25855e359, 0x2b6330338eb6ef8e, 0x39f41d537409a3fb, 0x7f5388aa196244c4, 0x817acc813715b2d8, 0x6f2176ea78879b91, 0x78ffcc9d764c1cc0, 0x66146787ffe9c78d
+, 0x640d947b58de2e1a, 0x26cc0bf483656043, 0x7d80680e714a4158, 0x43248930ccba6858, 0x0af599461ac0d864, 0x522fed0581558361, 0xe3ce1add657fff1a, 0x3e20b00c7420f02d, 0x53be2e18351391e2, 0x3b2926fd27c917e4, 0x9db166d5a16b2feb, 0x1c84e95940e1c9dc
+, 0x896577691742b156, 0x7fc889386efdeebb, 0xf96583c78cd4463f, 0x5fe7b058fe246210, 0x756590b9b0e4663b, 0x194b35e5569c86af, 0x00dd996e6712a5c7, 0x5087954b47b32745, 0xa112171e9b2aa910, 0x5b915d2dd2496ae4, 0x49faa800248541d0, 0x0194293d897d6a21
+, 0x18852429113c4795, 0x22ccce2eb4beead3, 0x69a980fe3e82d7ff, 0x658f4e284eaa8c21, 0x94bfa850d6e400be, 0x347247332c1d72af, 0x658df533fd047025, 0x18f728337ad978db, 0x35871eb0802e0978, 0x4b5a22cab756ad63, 0x712a794f1883c0df, 0x7f54788fc9bd854e
+, 0x939af7a16e6b4a95, 0x64c0dfa93f9a1969, 0x502170d51fab21ce, 0x7bfb46a6e38c1be9, 0x668144c8e047f646, 0x70eb4024f9af9605, 0xe8f85e2acf50cce4, 0x631c8db431cb9347, 0xd08ba72b9180514e, 0x7d3646e695db333d, 0x4fa9f0fb1f667912, 0x4170f23d3204c211
+, 0xb110fd10b82ea2cb, 0x1fcdbab9acc00cec, 0x638cebfd695e4c4e, 0x2680918531bbae33, 0x7f2ea2097101f813, 0x61637809481e919c, 0x66cf7f1f3d1797fd, 0x54ece071885f409d, 0x6a4fdbe3555e6966, 0x4ce3770a55641029, 0x9f9a58883812997b, 0x5c7945089a3f2529
+, 0xed398b144e96d9ca, 0x24f39679b8c8235b, 0xd7d2fed6350b3491, 0x7745383ad7351b55, 0x6e0d55a38cdd226f, 0x0efff2378a4f6f0a, 0x47d21063eb6a46b2, 0x59579fef5af3336c, 0xdf34c17312e9c1ba, 0x58a5eb0cf67683ad, 0x3ab2d44602e42205, 0x46479723fa7044a9
+, 0xf18d3e1da513ade6, 0x2733b5fbc33cec0c, 0x9977aad90fca9bf5, 0x560600a55c24b9f8, 0x0aa90e64cb69e874, 0x164833be18336f71, 0xf5aecc96ce075c0c, 0x0351154674ad6238, 0x753291dac51b9a1e, 0x48fedf82fc0991db, 0xf8e2a81a275b8ce3, 0x5740b4530f44ac66
+, 0x2cbbcda3292d3103, 0x1b9a5dcf28e5d667, 0xa101b46665b93b20, 0x6e9c7500171ca339, 0xb2819fd13eeb3aed, 0x3ab18277cc499df7, 0xf5f79fac4699c086, 0x7fc5259e44597000, 0xbef661277e33bfc5, 0x2ba2ddeeeeee7fff, 0x03162059addc712d, 0x0e4ef11d2ebb1865
+, 0xfc70a415ebf6eacd, 0x339e3cca338ffb23, 0x5a20cc9cd53783c6, 0x4089a5f0c73bce1c, 0x95e9e03b43df4b23, 0x1315035c55f417ab, 0x4e8c694537404cd1, 0x3b00c09d8844f2d0, 0x045476c6b73f3f30, 0x690bf08f50d730d4, 0x8deec2016d42e542, 0x42d01ada79eb65e6
+, 0xf87b0610aae71cc5, 0x427c00b69d6d1afc, 0x95984a4f061e6e1c, 0x1fe7480a317dee35, 0x97f226baa2bca9a4, 0x1221a00c03bd38a7, 0x1bc3dbfab23a6f55, 0x060d2c1febd791fb, 0xbfa5798389f6cfab, 0x1ac8929acc9f38eb, 0x161d46c8f4fd160a, 0x1e850b8fbe0855e7
+, 0x2937edd021b65677, 0x15db8d4ce3f2477b, 0x49a6a0f2e59b001e, 0x6970d8659285ab6a, 0xdcd378c53d2311d6, 0x75a0784e00ccddcd, 0x6b01cfd0d6e3a499, 0x0bdb2d16e1109475, 0x2dfb8d50bcc7e920, 0x181ed3d8cbc24997, 0x32f31d39bec93b9e, 0x00481a64c9fe503a
+, 0xd864f68b26f9d15c, 0x4a5022bb556d5904, 0x174954d56a0ff41f, 0x381672f4eaf8e38b, 0xa0a35aeafbba4ef6, 0x052271ff33b659be, 0x326ff226f8682b52, 0x002a40fae39e04b7, 0xc51e4e260d647459, 0x4905e6a66a3e299f, 0x045dc831bf70b399, 0x02b7123ce92701b0
+, 0xa03dcbae2e02043a, 0x528b9e8e799408a9, 0xbbe6fae4d442864d, 0x22ccc76bf8577a50, 0xa4da0b980c309cbf, 0x603213a1d0cf34aa, 0x42e36d4a9ebd1c8f, 0x504bd0564e45918b, 0x2ae9479fe94f3b75, 0x7d8d09ea25fb486f, 0x79e852da635d1835, 0x452c78a9a97f091b
+, 0xeed71cd216b8df85, 0x4417b94d3ba0452b, 0x307d515e59ac424c, 0x6d506e47ea8aea7e, 0x801f983fd7413a53, 0x24feec3ac086a607, 0xec8506d96e2b85ac, 0x5003c0389ca98ea1, 0xfd7384adddaf5be4, 0x551b1e2f6afa9c2d, 0xbd4d4b080cb6527b, 0x001a38c3d3f810ec
+, 0x64f7830889b41f45, 0x394c4a3b1050670d, 0xf54eb346467f20f5, 0x695df6f23a906ad1, 0x23ffe20fb8dca72c, 0x0973c6808fceb5c5, 0xdf09fe8825e6afd3, 0x46cb827ae6847b5a, 0x98b7ad4ba26b0d08, 0x0bf4d8047c148b6e, 0xa5d52a742b6b8a01, 0x607b9455280375f8
+, 0x3bd7b363f9ef98a6, 0x2400e6eeb84d2ed0, 0xfd0a2706049d9319, 0x6cd3b32bbca11d44, 0xfec0c39820e3e4d0, 0x6508cc00311a6d1b, 0x4205d8686b0622d5, 0x1286bff4fb446ad8, 0xaef9f7899cfcb9e3, 0x56e56094be5a7965, 0x21fe79623997b0ea, 0x1aaddd143dec2290
+, 0xbe025b9683c66a25, 0x3c8868f777fd7434, 0x2e93cf7c944eecba, 0x3522bc2afb422ffa, 0x90cf169171869439, 0x0e90f30a5e2707d1, 0xd4c3eb8034edd09d, 0x64ad3fc46336343f, 0x27275a18fd1714c2, 0x7fa25273ca906867, 0xbb91cdc2e51f280f, 0x14f32cac12124fb6
+, 0x9183eee595b599fd, 0x294dfa41b88996ac, 0xea35a9e39d25f41f, 0x21f302358db6aaa4, 0xda57dce02333f87b, 0x377b79a8ff20068e, 0x3c7e412241bfcb47, 0x2b3333f9ab4d6a9e, 0xe9b8f8f18152603c, 0x3a8d9ab4a6ca8e9b, 0xc7263af76b23553a, 0x7e981b09f1367183
+, 0x5ea669090446d925, 0x318f921f64c7ae2c, 0x35f278459276e3ac, 0x03f99fb7c774cd64, 0x6fef5b2022bbc1fc, 0x148fdd72e7cf0aca, 0x9052c9d97a31b7c5, 0x2bce854128c4fdb8, 0xb9105e7c87354939, 0x5dc93aa245ee253e, 0xd45ea9536b77df08, 0x53465aa51bccb203
+, 0x255f2806db8d20ef, 0x74bfeb8b5b60a17c, 0x7b66c25c79b0da8a, 0x22c83121c496dad2, 0x31298ba08916fe49, 0x60ee71715d431b29, 0xf1cedddfa9277f1a, 0x7ed7ac31e47400b9, 0xb243ba00277c4837, 0x6c3d62d18a4e88b6, 0xa7f589068a8d7d5f, 0x401c01daa9e16900
+, 0x22f94519393baaf2, 0x5462c7a3e9c3dad4, 0x6a5f6117a98fdf1f, 0x445e554bb9d83bd0, 0x2554bc5d3a0ce398, 0x1354e5c652bbbd6b, 0x1c30cc11b0898454, 0x51bd0897f180941a, 0x3d19a2ee610e40fe, 0x22be507a0b66aac5, 0xda98a70add3b0203, 0x13de1ac5289737a2
+, 0x5c9642fcce0c8cac, 0x304a9ca9db58bb09, 0xdadf2cf81e054983, 0x46856b2c51466031, 0xc329714336f05f67, 0x15357d6eb08dddf3, 0xd6dd5f488b91937c, 0x160098dd8e4db9c5, 0x72be9852fbd27331, 0x256dfe6b1d85a415, 0x187f573586079ba2, 0x499b4abe5785925b
+, 0x1a3a18f81931367f, 0x78f1bfc04c6082a4, 0xbe7990e86a7a9384, 0x6f78868e6c215f70, 0x2bce11766a26ac92, 0x412915d262b13878, 0xe49666f453530f67, 0x0c20b77397654613, 0xe3b5ee5e61aeb260, 0x42f97fa87480a973, 0x0b7c775449750108, 0x4b66134524bdfe77
+, 0xf8e379e2997eaf9a, 0x0057c223bc0b084b, 0x3ce75cf033e20aed, 0x0538b62287ca9490, 0x8acf98e3df58ae33, 0x2c60285157fa1159, 0x72f796646c7286bb, 0x2708d38682bf2f1d, 0x05ee89cc279adfc8, 0x522a9f828bd9cc92, 0x6fb3e7c90aafba88, 0x5a9a83efc2658834
+, 0x0ec3eac67f6637d6, 0x332868c1702ff418, 0x7aaf5e5ce28bb8cb, 0x0805793409bf20a2, 0x4410f1ed1909461f, 0x0e2d4266e2f54c53, 0x1f3b1fc944845ff6, 0x08f870b473e23745, 0x51d789b36088f437, 0x689a50ffc9fda20a, 0x6457b49e9c5e6d03, 0x675da23ac529883a
+, 0x80ea04d2480b5c90, 0x647753e9128c6352, 0x73efe917abe04c49, 0x42c74015b58aa638, 0x8720b0a543141d72, 0x3773910384875818, 0xc94135e1f5c8df4b, 0x67c97733e9e67098, 0x5ae4f97a4009d392, 0x31fed41d198e85b1, 0x0f8a73deb320b832, 0x54008cc619ece9f1
+, 0x9ba6ee13d36f32e2, 0x41dcd793a64dda15, 0x1c50a99f2d97122b, 0x7e48c550a4c79918, 0xe492d6564c12a285, 0x3c4f3ca0d7f2260b, 0x43613eb62517a407, 0x75fcd132825cfb3d, 0xdb071148272fd59a, 0x28215c81c44e8095, 0xd5ddda85909a7912, 0x5d609fa5fe829846
+, 0xc373160e9b54eb13, 0x1a2660b91b9ae050, 0xc0da2b42837f3d72, 0x38a4f9b46cbe6d61, 0xa99d1305254396ed, 0x2955401c90674588, 0x16b2cb42d2fa6e60, 0x55d34cf71dfaa9ce, 0x95d16069e5dc419b, 0x31b649eda7386923, 0xd3af92bf94573e6c, 0x11d2c1ae64541636
+, 0x175012ee96a7738a, 0x4a1475777c0e32fa, 0xc09b64584d085420, 0x0a6a6f80b8587bda, 0xee3dd23a47ce2ea0, 0x2d20d216583afdcb, 0x15d1a8aa851bc1f6, 0x7ef8ac5dd831762b, 0x16fd31a098e04034, 0x3883bd929de60154, 0x8aaaef15a4051a29, 0x346f70a95334ae56
+, 0xc7687bf40a790378, 0x7c929f29718ac20c, 0xfc62bb1ebddeee2c, 0x539414bc38589cf5, 0x8f1f7a2a9593cd90, 0x57a536feecc7d59a, 0x7fe9d54b4b1ea359, 0x2018391503f7e637, 0x847f4664bb0f7919, 0x5c9edd2a7d9228a2, 0x4faad518fb8601bf, 0x497abea68bf84378
+, 0x30161857ad7199b6, 0x357a0e945cb123b7, 0xeba53993cf95415d, 0x2e8411152065ecc2, 0xb5f133df1e85021f, 0x14c7cbd2fbcbf2a4, 0xac5bf233f169d374, 0x5e8552101cd81985, 0x2b972b2d91a9440e, 0x75dc5fd52888ab00, 0x83218f0ba0f3981e, 0x551e27074f3e9895
+, 0x5008ecfe5ced4d68, 0x1d56f072864721df, 0x78b654fcf8511e17, 0x72bc6da022ef9080, 0x7a8985b0511b0dd9, 0x1fe463363fbc5df8, 0xfc676b0972a397a0, 0x09b6334e4934bdf4, 0x5f79215af96a406b, 0x35de66c1df33073f, 0x665e552db9e98390, 0x6fb087e1208fbe02
+, 0x0bc89f8815079a79, 0x7d617a988f9bf5d8, 0x55b5c0fcb551ced7, 0x49459a6a0e4df1b2, 0x3e13ff9fdeb4376d, 0x06bdbda934511f12, 0x0aa5bb28889e305b, 0x561d5a75fbc95d86, 0x4ce53c933f78a4f0, 0x01b92ef9e0bacd86, 0x22c00faecba66cca, 0x16b8d98d5b2b6c54
+, 0x54f67e31cefd20b8, 0x7ce877b9980e6417, 0x57c7b7086d52da2f, 0x266c5e7895a98798, 0x5029eb50d09c8a0a, 0x33006dac868c2716, 0x6dfb586b918e2c63, 0x017e486b1ddeeb0a, 0xd031f8763539f444, 0x5f974beffbb44405, 0xd8e618d3af3563a1, 0x4fd8252e896da05c
+, 0x50fc19c2078ba533, 0x245c26eeff992b44, 0x88dfc647891eff7b, 0x59617a6bfb15863f, 0xd605f25c6a5387a1, 0x393401fc2a24a36a, 0x574e3cd31c2ed375, 0x2b486ec182551e9c, 0x28db490ac486b8ca, 0x59e77c155d7f4656, 0x59c6836db71e55d7, 0x6c92eb4f497f7453
+, 0xf97ec51a758a7438, 0x4fa939b1d95f5523, 0x8585ecfa9a696f37, 0x28966e4ba55d1dba, 0x27617f2bf04faa4f, 0x37d34869c2f8dad6, 0xa8eaf38db2a1a7d4, 0x2bc86889b36048aa, 0xd7e738aa1a42f321, 0x402e162bcd486959, 0xd72a3b4c30a67454, 0x1d2d7285f8d5c497
+, 0xfacc18028b21a07e, 0x3b620c68a8842cdd, 0x6b4368ee22ceefa2, 0x73cf75d484704c40, 0x587817021c7807b5, 0x634582340bd071ed, 0xac6003e111c3ad0d, 0x35a1ed1eaee12a57, 0x3229f9828a916934, 0x0c0979b654a22eb4, 0x4eb3956f94955502, 0x3332118aa9df46b7
+, 0x126c7b8ee5006cef, 0x320843f49b7a544f, 0x272a8de043d6eb58, 0x24fd26d14d92e6a6, 0xebcc72eead98dde7, 0x65ecca04f9b758ed, 0x914b3ada7d6fd166, 0x548c3b942f25a522, 0x6b378d5c157e2e92, 0x46104bf269c98678, 0x6b3e97757ea131c5, 0x5bba96c55ce6b2e8
+, 0xbfc6a8c30248921f, 0x15bc7f9684cb6d04, 0x9048387851425cef, 0x09d339287c7fc0c1, 0xa4a2b0b5632f8c48, 0x3f6eadd52c3f8e4b, 0x14a5061bc2a7cca1, 0x2a22eac37537f88c, 0xff79eb27f4831ffa, 0x3603aeeaefbbe831, 0x933a63a0c8a9fbf7, 0x77ef8881154ecccf
+, 0x4fa2def7bda02096, 0x1df644e8b004711f, 0x10d0169a90a0724c, 0x32a2c8ffd14c7204, 0xeda7911421241859, 0x7b6c9c066207be01, 0xefeef3f42ae8b117, 0x35a73a4a93c9cbe0, 0x7697b790d784e775, 0x60b0253d5a078adb, 0x9ca512fec457ac48, 0x71096c778031d930
+, 0x35e87b23eddb5704, 0x2df6630406a00d34, 0x6ea9fb14c1a7dfe9, 0x7d6b5ee3eac000ea, 0x10a591f91ac1afea, 0x744f736436b471bf, 0xe8cdabed5a4deb09, 0x26db2f5bfcca570c, 0x19d941b8200c1d01, 0x3ae205e3d3da172f, 0x9d26d6e375cb43a9, 0x19ccffa99c45e85b
+, 0xc9cb8b3487d5d30c, 0x74c20a6800f75f6f, 0x354a6dbadd9a1213, 0x6028041383fb53ff, 0xcbd6fcf0daa11888, 0x2c4107d57c28c24f, 0xc60a119d083a2144, 0x5cd465249504388c, 0x38964be7db88cdd3, 0x72d4556e79d8c18f, 0x524018d85904c1ce, 0x53ce1b9d21a8fafa
+, 0xe6c590a8c1b03a4a, 0x10960ad922004ea8, 0x5d4f485bc3be231d, 0x51491b1a485a0bc1, 0x6f2286d6196f2cec, 0x58818a84063953f1, 0x351ed7c4e5cbbb09, 0x6fa661bd7856b460, 0x15a950e71300118b, 0x4b476fbe88153400, 0xac484cdc4bedc5d4, 0x3920938ff0518c8f
+, 0xe1abd24eeb0c9297, 0x583d1c0f8d8b2259, 0x0b30ac0a118816ad, 0x6ad81b09fa3d066f, 0x693c29b6c2aa89a6, 0x28964e051f419508, 0x021b1a535435f094, 0x38d23ab919aa7699, 0x70881ea254047dd4, 0x2b0710c70ecd02d2, 0x09a9b7eec201717d, 0x6b42d3792e5d5d79
+, 0x1a89dd305bdf85a2, 0x471e5966c6b2eeed, 0x198929aad90c7861, 0x1c11203ad2f442c3, 0x431bdd08b7826640, 0x0196cc0d53a5c7b2, 0x95661ed5c41ff1fa, 0x374fd2da3f091317, 0x608170156fc188c1, 0x528be18eb9ffa153, 0x9950009f99889681, 0x2cad580847972dac
+, 0xf0e38c1aa9a6ba33, 0x6d03fa4771b1111a, 0xc4ddba1f41101936, 0x6ed3d4bcce81576e, 0xf555246304b2dc1a, 0x53c0bb26ab81a305, 0x111f75d9d91efecd, 0x1dbecfb94be60b8a, 0x96cb02dfc2d7a779, 0x44a2b2a5f94b7e1c, 0x20852d87c5fded45, 0x2ffb4a578f722b9a
+, 0x6d0596744f994d40, 0x6d0296fed3839036, 0xa45fb214f07e409e, 0x4ee983d7a17268bd, 0x9e43822f921fbb1f, 0x25b052e53b6bfb23, 0xec8007f47a87e02a, 0x63d756390cca3ad6, 0xb6e779294f5f91f4, 0x0e0459f075bee40d, 0xaafce841edc92508, 0x1338ada805b7b035
+, 0x7ed0fee6d6976659, 0x7df0194b189a438a, 0x015760374dbe99b0, 0x6b1a9f7584a5f85f, 0x49fb0339e4cbfede, 0x592b80d54c185734, 0x62077dd742285faf, 0x50c05e47eb39e339, 0xda4faddc2b184a3c, 0x03c97a8444bc3b66, 0x1d8e4691f99ee8ce, 0x352ee31d85c14faa
+, 0xd1cd40b7ec234551, 0x65e018c7837fb0e1, 0xda3464b313120eea, 0x15e61288c37a852c, 0x3559ab9fcfed3ca5, 0x41e137631b0f0069, 0x4be7fc3b9c9cd8ca, 0x12e6a4e83bedbb1c, 0x64257b6030ec8e66, 0x42961c1985468b1e, 0x22c48005aa03cac5, 0x2ff5e4344d486d6e
+, 0x58bd1082679a57f0, 0x4826a7b8451e04ae, 0x4220dec35bf511b8, 0x365520e200d3cd63, 0x0229d8728801e244, 0x133c130523fe1f3f, 0xc46990315dd94113, 0x55435042bf870619, 0x9c0ccf81bea8ccfd, 0x17332458441af352, 0xe8dcc43950141381, 0x500faad87bee0b53
+, 0x5a83b362504cb519, 0x14420ef05733b01b, 0x1a66b26719fb20ea, 0x6215e59c3d3eddeb, 0xf583bd6a2aaeca81, 0x7baf438f36386a3d, 0x44981a6666576e98, 0x713fdbbf26206ae3, 0x922b06f67c410420, 0x10e0df7beddad2a6, 0xd53503cc6e6cfcb2, 0x4543860007d87463
+, 0xdaffd2b1af6c2bee, 0x6ec5d689751ad2a5, 0x434c8daff38223c2, 0x602228364b5e90d8, 0x99c854278805f776, 0x5d1f3140c886662d, 0x04115d1261aa4eb4, 0x7f61f5766715a2f5, 0xc2a7dfc0e6ebcb2d, 0x1f2ab219146d5484, 0x9fb1725070b2a241, 0x266d360ceb4bac05
+, 0xb1d104ece5e2da88, 0x7d18f59a1db28c9e, 0xd09b4ffafce912a7, 0x20ffb52d49d8df20, 0x113a360ac78cd5c3, 0x42bf06900fca147e, 0xc8af0f062fb9a98c, 0x247a14c7d73daaac, 0xe6546e52a9a14c4e, 0x253018a9f9a78443, 0x9cce41f54d5e1a77, 0x726775589987f365
+, 0x6a4dc1552caba083, 0x51c592e796700461, 0xfe653e868f9f193e, 0x14a450f39eb1b0d1, 0xae8d3480811efe7c, 0x3d672388b75e31b4, 0x5cff162d40a92ec9, 0x5ab06a22927eb33c, 0x6f754a2f624bfede, 0x12cd02f473be713f, 0x505d9dbc733fe7c7, 0x2dfc4db9c3772ee9
+, 0x63abf038c5eeca9a, 0x10b489804e844a29, 0x8722aea815e71c54, 0x416ce845a1e1554d, 0x843fe2c33dcbb5f7, 0x7692d685b7f9f262, 0xdcaf12662a7e2e11, 0x4d16d5c290cf948a, 0xdc15e4336c37b0dd, 0x00e13dbd9ac020d8, 0x06962bbac66f4426, 0x1a44e4d20e8e208d
+, 0xfe5c608098a83258, 0x133150ed97b9166f, 0x83cabae5d5ba5eee, 0x659ecb464bc6fcd2, 0x41a9a70c24ca2cdb, 0x51eb6a439cee7417, 0x932e8a0982d22e3b, 0x1192dbef4826b29a, 0x79bc4d4a7cb46dde, 0x05c53dfdea4ecea6, 0x45b5a1117c3c5445, 0x1ab997a6c6159ab1
+, 0xad8e57d3dcdbc2b0, 0x659c54e06a956315, 0x023e6786be35a14c, 0x51333cd054c9e465, 0xf7092b2b07cd71f6, 0x1a1b78e73d996459, 0x4404b36d5613108a, 0x003f86a07bc076fe, 0x0bccb24de14ae5d8, 0x36c62a1f589c4a2c, 0xa162d4bb5cd9ead0, 0x2259cecda54cac58
+, 0xb0d35ecc9baf4e9f, 0x254ddaae6443721e, 0x29224d4968ab1167, 0x0e86e2bbc852d9b4, 0x19cfe4097c71fe34, 0x7421e1e2cf0952d5, 0x626fe9fb7fb5b112, 0x545f18fae1000077, 0xc80bdf59aaa01422, 0x30934da9dd60e8b8, 0x34b52508e29f84d1, 0x024567df6c125ed2
+, 0x0ff5fabead1c8334, 0x34dba7ce9a90fa1b, 0x536b4f1b7bb347a9, 0x1835b550f827f5b9, 0xb20344ee8b11cbb4, 0x5205f1cd543cc145, 0xc335696f25bde15b, 0x43907671ecaf3acf, 0xb4a81e1c9f116933, 0x48f19632e90f8b27, 0x100d29a72b1038d2, 0x68443c11c57e4655
+, 0x6adf73b91c9bbb43, 0x095406c2095e839e, 0xff8ff468ffb6700d, 0x626f164ad4bed828, 0x26e8afdafd1f6d7d, 0x7753e739591bda05, 0xf0080984c798dc67, 0x3443eb78c6648a38, 0x545e0136b5a32ddf, 0x32452dbb4079e71d, 0x42d98c64ee493c8f, 0x76a438867aa7824a
+, 0x9f8c3a91f4e7b793, 0x0cb3666c3145b404, 0x0ac07b739c75168f, 0x04a5271439d12eb5, 0xf9abfb99542ef864, 0x3223990b5599351f, 0xbc963f396dd35dad, 0x27810e1e823a8cbd, 0xff9730deef3c9c23, 0x6e8b8054210d1dac, 0xde3edc983f1e3fe1, 0x1e2e6e471838958c
+, 0xa7e6c63ec14596b7, 0x1cd579f1ba3df0db, 0x131900d5fd56d883, 0x35e0a8b4e27af27b, 0x410b33e2f222ec43, 0x5928d3dd16837149, 0xa7a55a311914fa84, 0x0a730c5d3245317d, 0xe4daa4a03dbdfc1a, 0x7b5c3fa3a87243e0, 0x052c1dbacd474e64, 0x4de4b53854bd91be
+, 0x19df6ac1f5d58d49, 0x7701efe5e3ebed58, 0x0145aae3b0aede85, 0x6f543eb73a13582f, 0xcc08754045d2e5b2, 0x753adc8c8775ada8, 0xab026b4c0c46db52, 0x75075406f14f5cf1, 0xe06d0b3eb04f70b3, 0x4074cd707e0ac93b, 0xa33c51296bba4fbe, 0x34697070cc24a211
+, 0x5995108848dcce4c, 0x1e98a3253f085204, 0xe0aa9648426e4a27, 0x7b855147bb9c2265, 0xb5dcb3a77d3cb1dd, 0x3ddffd8e738cfe54, 0xa49ca522ca2a4236, 0x6c58470d2bbaa013, 0x99e9754fb32337a7, 0x72637ccbe6da46d9, 0xda9dbea1a92fd3b1, 0x416bebfe1b7a6d92
+, 0x7f3e7f57927e17ad, 0x621dae96c326480f, 0x16d5ede5aced9600, 0x318accfce3c8a103, 0x7a4069f0b230b4d5, 0x61d49f57662499ac, 0x6fb23328c363843d, 0x324c449435f3980c, 0x0876ec8d99422ca0, 0x119512d8d5ac7410, 0x0cc1f12166638482, 0x60b5582b5b59dea4
+, 0x598d33a83af2c921, 0x42b776fbf6787ff3, 0x899bc1740ad46db9, 0x060e6ab257ff17f5, 0x2fbe7266f6a18359, 0x3db8334a5d3f9b7f, 0x833cc5c435c7bcbf, 0x2576969d2ea7f298, 0x9650e77c0e40b294, 0x2582c0e219474105, 0x45721fa2d0de30ac, 0x3e3e54a81dc070ed
+, 0x8c9fa70e19820686, 0x77f41883e550f1ca, 0x620cecc432720630, 0x30fb8f64040087c9, 0x49add94e6c6a1509, 0x2788e07bb4a46f06, 0x92f50d3526162026, 0x19257c092a2b682d, 0x4d859069e8892c58, 0x4986722f2a135b6a, 0xbf2d2a7bf6b92802, 0x4918b9840bcd31bf
+, 0x05514263a0fd8051, 0x298a55680426d215, 0xf447e3d2c0d826e5, 0x654964c376c46f76, 0xb748d6cabebb7085, 0x292d92bb5224127c, 0x4b564711e6f30720, 0x3680603d4b687938, 0x1d3652e4bc7e6388, 0x229a3ecba12970c7, 0x0a264fc5cfb98ea2, 0x72513effc8cabe50
+, 0xdf4117326f3ce394, 0x07e310a23c63667a, 0x62af8780b6b2d91a, 0x7ad41d4514cd1339, 0xbe7ecc3af9c5b82c, 0x5dd08c7761e6862c, 0x54b67c407da2b918, 0x11085f9742e2ead7, 0xf84e54fea95cdd7b, 0x278e4b4344b91e0a, 0x307f661f2a933ac7, 0x6b7d0cfe9549cfaf
+, 0xcaba05cb45c737b3, 0x1eedd5ae15305ba6, 0xa0ea856db9b55150, 0x53c5e8bd0480ea7e, 0x98f0a208979cdb26, 0x1697fbed126a5a47, 0x6bda4cbff4270af6, 0x3845c1ce08e4396b, 0x5c72eb4c7410c7fe, 0x6f74fb2418599977, 0x4dd2b8ed72bc4c75, 0x6fd05e5fb2931e4b
+, 0x356a65dcd05277aa, 0x348185a9fa8fb932, 0x7222a7cca09f5acc, 0x7e8b9ec8f977e0dd, 0xa26c58c2e5d0acdc, 0x5ab5ae5db7350acb, 0x9a91c15eba7097b1, 0x70f96462e32685ef, 0x8d51b36504055d26, 0x7da072d04df864f4, 0x6e10c593dd19985c, 0x4fca79468a2a2eda
+, 0xf536a6a47c88ec58, 0x2669bab2e3ae96d1, 0x31123035f716f529, 0x0fda973f8c070c10, 0xd2b58ebe5a334841, 0x66643cf42590a343, 0xa1b92d53e79ca3a8, 0x087670f12d162e65, 0xf87d0b3c8a7e4f8f, 0x73f72c025c573c43, 0x24640b13adf22a60, 0x69cae39b88b16d70
+, 0x67657c58bd2626a5, 0x19266a8789897b31, 0x7e26a17e66cc76e9, 0x5c20df577d716b83, 0x90cac819159218e4, 0x2dfdd27325818b7e, 0x5495b3a426fe3eb0, 0x3d6ed79a301f355d, 0x379d74ce19572f33, 0x36d2208ce4048bce, 0x48c65afc71cc6e6c, 0x788e1ad62df7c817
+, 0x1a0020e8cd1c14a4, 0x2285c253eb63ba61, 0x002dd36baa19276d, 0x7905009ce31792db, 0x1c8eae302322f578, 0x02895d77d4743569, 0x86d7b3f9c130981e, 0x673505d5fe17de4f, 0xd9860bfa518d9662, 0x02c33712971f55e9, 0xa56f8fa28973971c, 0x03e405c3abf7605c
+, 0xe03052236bcf9edf, 0x790cd821dc88d2d3, 0x37778f2f8729cd93, 0x2286f92cc0edd37d, 0x8e93cea7469f589c, 0x6ef3a8971112e936, 0xbfea81fa81eb75ec, 0x32c12a91dce3ab7e, 0xd03f6755ae6ac204, 0x0c003d30caa72771, 0xf9b44ac363dcca15, 0x14da0305211fefc9
+, 0x8459273d3c410c74, 0x737fbb8a392b00a4, 0xa1e3f11fa3e6961a, 0x5715403f7eae29a2, 0xd456ee4132e5bea5, 0x6e39ad057bd70e42, 0x9defbfdbb547c766, 0x3db9b451cf926276, 0xcc90066f500cc6b5, 0x474f9be77ba8f4cf, 0x154c26c2f8c5bc27, 0x2ad37c396177f337
+, 0x3b4082a5367896ac, 0x36b0944bf951dd53, 0x5dfb655200eeed8f, 0x4ba146beed84edf9, 0xef48ba17df4054a6, 0x17a8ff91efb4b66e, 0x3ec70449b64a3ff5, 0x7439fd375d915bf9, 0x91353bcd931b2d58, 0x50610c849396c3f5, 0x3671574b0264b89b, 0x4eae34a34cac194e
+, 0xda39b4975b68cecf, 0x7c59e7ad7a24d7f1, 0xf2e086c2f1623d49, 0x5877235f510f6abe, 0xbcfb52599d9fb2d3, 0x110634f2479eee39, 0x4eee7051692613af, 0x6eda4dc3c4e4f226, 0x41bf5508e1c81631, 0x269e7641d112e312, 0x3151182b9399a429, 0x0447d61684d4279c
+, 0x9d2c3815d5f2f7ab, 0x24659639a747efcf, 0x49185ccf180c0805, 0x7a01d56f23dbd625, 0xdbf7303a9bd3d4e4, 0x0e5b35b17304b061, 0xff7406d0c88a50c9, 0x5d5038f317b080fb, 0xe0b47d5a36fc4537, 0x286357a3fee674a2, 0x66f7548e8e2e7c5d, 0x4ccce6dd02d637dd
+, 0x82c0a9197b46b917, 0x3ecad81c6211a291, 0xd2ddbe4253bc21d9, 0x7d003c14f0791b9f, 0x18f96a6cc2efea75, 0x5da6caa58517eb01, 0xf86fbe4e6fa387d7, 0x2448152e344e4bf4, 0x45d7f728e8c05035, 0x0a8132e378b3cd7b, 0x613d8427af1ddf9c, 0x3be2b64e9d4b1dfb
+, 0x5fcb6d3461345827, 0x54be5ca918a1fc13, 0x76ab687565c6eb8a, 0x47faa20ff6f378d2, 0x6dd272774fa287e4, 0x1a50e8dc2413ec95, 0x7a65b533c229d7e7, 0x66141ae6d6de1103, 0xef15ba2f761d03b8, 0x3e1707ecb1d4bb80, 0x3e688c7d7c6395a1, 0x79efdc351380ecb5
+, 0xbf09ef42d6132815, 0x5fb60dbb79a338ac, 0x4824ef6dc74582a2, 0x1b45fabdf95f802d, 0xe44784980ca51c76, 0x088e574f5104a03f, 0xd3b762e0b9f6f4be, 0x7b1e6c6ed57beccf, 0x261ed9401973e23d, 0x2cd0aab8f888ce61, 0xcd4759614085376d, 0x344bb6afb80e4803
+, 0xcb01a6f00e534b95, 0x1b69492c6a4f0ebf, 0xade4b1da67fe0289, 0x35d031d90392017d, 0xbb7c3c7487b83ab9, 0x32c66cd9eccd7266, 0x6f017cdca3243117, 0x47668b5e95f1a531, 0x9569199ca1d245ab, 0x5fa3cae5f2806003, 0x621ad3280b75482d, 0x2a2cbbbc50dce32a
+, 0x7d983f8568dcd081, 0x28de4578abe6c430, 0x94089be1d02825dd, 0x018c8f86a8bfe5bc, 0xc508c4d2dca9490a, 0x4aa8c20928d019ab, 0x8e32e46fae547679, 0x312a02d04fc15128, 0x84a8d075f0dfa996, 0x22aacd3988712730, 0xc8b7632e4936d49b, 0x786982519e9f65c8
+, 0xb5df45efc0f1563e, 0x152d105deb3f8099, 0xef8ce208cef2c00f, 0x21b3fa4f1a3045e9, 0x29d3b6716d7d434b, 0x5c28d83ed8068c96, 0xf72e78306d2e8a4e, 0x6b018440751cb538, 0xd6085b558732b21b, 0x3b64174d5d76883e, 0x7b1c7bbc231e7791, 0x2ed912c5c494ebf8
+, 0x7db6a257de4ceafb, 0x2db11e914c2570bf, 0x0e11766679c611b3, 0x46ea9708f9e115b4, 0xba751f5ca3b7bd0a, 0x4fd00821069a5d80, 0x077d60d73a602f78, 0x7f02f347960e6359, 0xa49d814e13087d3e, 0x1427ca9e13aa2ba4, 0xa890cfb6e0199a1b, 0x0a1f2c8202650bd6
+, 0xc751362d10f847a9, 0x312765b04a7ff0f8, 0x88428cea9b0df617, 0x55a5e87a531acd63, 0xbd47c80a0c7e58ed, 0x11d9fd3730ba11e2, 0xe30a58309edc0118, 0x5ec8d9cd4abcde22, 0xb46c8b8476f88f65, 0x33b194942095ffec, 0xb7d64e66987245e6, 0x56235385b0c2b9f3
+, 0xf3a132eee27fde7a, 0x2bd9b0dce1333565, 0x7684ddee64fd6983, 0x320e10265a6102f3, 0xed5c6961923bfc60, 0x0b6df783b16b711b, 0x8b2d4d35e9b550b4, 0x40c170dc368abb90, 0x7acd5b7211ad15ec, 0x3a1f98076c9ebb4e, 0x945b4376e06e7474, 0x3d8f704d9b82cef2
+, 0x366603fa78f2f162, 0x72fac2352c9fb684, 0x9a819260c9b0c993, 0x4c327d032f33730c, 0x211e72c04f53fa05, 0x53c0ff4d2aaf1134, 0x6829714ccf5e6acf, 0x329477cd2a08339b, 0xeda4b1029967a98d, 0x67fc35118a36d314, 0xf6115604bc371086, 0x7ab03b8ba1eaf17b
+, 0x3ca4c036f286aac2, 0x3f7bf7040309b1fe, 0x447397c1ebba6cf1, 0x381a196a249f5453, 0xf96c290244f5c000, 0x0fd0723cc9d6a442, 0x287b22dc73c7bf1a, 0x589b3d965203e93f, 0x7ebd3d55bb90ef8d, 0x2cba2418ac4fec7f, 0x1346b3458dc3d73c, 0x7b4df4e877001819
+, 0xd7ab7d6fd8dc81aa, 0x15df57aa0cb8862f, 0x90bbd747890a0099, 0x6189693518fd8813, 0x82f87f7b7d1dd907, 0x401124379b54b5b6, 0x5bb8db6836ed6e04, 0x3e083d8d7f221da9, 0x8da94fb576fb5ab9, 0x3df95016ccee579d, 0xb0669caf01baaaf6, 0x0097a1a05ac4f3cd
+, 0x9a2fab32a64c4208, 0x6c916b99c3867364, 0xc76f370ade57da0a, 0x4cb01f291ce4ef4b, 0x0cba35d7be662034, 0x035e9a7d7bb9055b, 0xdb081b4068e8a5c9, 0x424be049f56ad4af, 0xed7c3dcd12baf9d3, 0x30903006f9175ce7, 0x5f02493c65db1d98, 0x41eb02eef344e474
+, 0xefd189ad0dd9f456, 0x71c9d86e2ab9c555, 0x77eb2070cc9b65f7, 0x0e7911b0ecd2f86d, 0x5455d5040f6e438f, 0x446a33d62b288170, 0xd0f959d4a3d3a1a5, 0x22728881d8e2f48a, 0xba2e6fa60bdb23c1, 0x61b7ef1661795803, 0xe15562048b49c2d0, 0x7c4b90c65f3b5d6c
+, 0x4b121eb43db99184, 0x39813ebcb06cc01f, 0x849a1169fe029528, 0x4f4ea4e4a7933823, 0xd35ad4797276b8fb, 0x3f8cfa9a9df67772, 0xa764bbae3b0b4bde, 0x4919936d2282d13a, 0x044a0ce3bc3b7206, 0x04da77d988092ea0, 0x6a1c6de0f752846f, 0x484a4b58b5a07ad2
+, 0xdccfc18133a70092, 0x7f7287d65cdfed8d, 0xf7c897cb825bd7ad, 0x37e0bd54139662e8, 0x76c8e9f609b9f0d7, 0x4f55cc6b13b0f554, 0x12430e5213c2b19e, 0x7336df4505b054cc, 0x5bb6cb4df9338bd3, 0x7ba68bb4193fc9a4, 0x745e29711889fbf3, 0x2be01ca5f02c3ec5
+, 0x97322eadfa2053ee, 0x09764c11d65afca3, 0x632f63da6e203883, 0x6e7668393479a539, 0x732fd82dea6e077f, 0x24d561ad0876f778, 0x0e43eaa0f28c7957, 0x6e69a14f8237bb52, 0x0bc9afc3c627ece6, 0x6a980c906e0af5f1, 0x6ca9cce8fe8cf3b9, 0x094de681e7e46326
+, 0x734bab547dee107e, 0x34dd0113d2016ec4, 0xad56997afecbf27e, 0x7e8ff659cce3a277, 0x29eb66194953be6f, 0x1db1509c76ad0f22, 0x88d9653ab0998ce6, 0x78ef668b9e305a35, 0x32ff76579a0b9325, 0x74b0dcb1ad7df919, 0xc1b26aa677e2e07b, 0x050052c266bc5379
+, 0x31dc56ef630c319b, 0x4bf6f70b8cf66f99, 0x6e08ebef4ede51f1, 0x4f2996d17a245417, 0xd9a5235f4e304668, 0x30b94da1287e37e7, 0x100a53b2f39a9360, 0x06f4c24f7aba48a5, 0x916f8ffd6bfa1f50, 0x4ec2e715a027b610, 0xd8ba2cb2046aff3c, 0x6ba01e82c3cfbcbc
+, 0xd87320edb56ab3d7, 0x24891a5e3be92322, 0x94062cc9f3de1aa1, 0x354a90ea097a0ce3, 0xb490fa127b44ce98, 0x0957182bf5b0697f, 0x0aabe93146832725, 0x1a441ca6c51e978f, 0xa8a0f3814417d408, 0x71b150af8fcbcdb8, 0x27ff061df1be8bb4, 0x15669069aa012fd1
+, 0x4c1de98f1f1f0dc0, 0x5013a6ee85b2eb69, 0x6c938225b3fca228, 0x21a0ad79a62e6390, 0x378ccdadba36652d, 0x17cbefcbcee37e8f, 0x5021799d3801eeea, 0x169a74ba433f6c15, 0x429fa06ad8224978, 0x13a852a1c0dbe227, 0xe1b6515c1cbeac47, 0x771e2f484264e6db
+, 0x3b8013789d287518, 0x79d0abc074b9a2c5, 0x7d6812c7eeeda52e, 0x2ddc074b5b666a33, 0x8e2b23ed5a2942ce, 0x4cae0646abd8c9d9, 0x99575326c5233a24, 0x35ea856c39f28948, 0x2ef20bfc869e1d2c, 0x73f77849cbb816af, 0x41d4d6a90e3fba7a, 0x6fc9f5cd253498e2
+, 0x9ac6975cd1514ecd, 0x6abdc779fc0bdf5a, 0xc1f5d882026d39fa, 0x1b9d51b1a10c8abb, 0x50185e9c6d2a94b7, 0x1c38bb8126b08bc8, 0x5d5ef6a5de1f6644, 0x25f6096def414463, 0xc21da960f3615f1c, 0x236e4f94ca55469b, 0x69ea2535d04b9024, 0x4f1b023f7b7e15e6
+, 0x38f99d079867137c, 0x6675a25d2c906a17, 0x1fbfe2e89920870e, 0x1643539a74c8d763, 0xe9c10f3c6529d8c8, 0x26f6455f897bb324, 0x9e8d333c66628b16, 0x5e2065473f8127e9, 0xa365dafa05806471, 0x25e84cba996eeb56, 0x481b4f70807a3083, 0x65541cf787d4331f
+, 0x8dabade809aba557, 0x73bf08726d434d39, 0x577934b259a54a2c, 0x34784c67812cea47, 0xf1cca0430ccf442a, 0x6fdf1a612e89248c, 0xfa178aca84ed5439, 0x4815659d9cc82b42, 0x622da10a0711e8b3, 0x0d066e533f8e2bd6, 0x0a6d1ba9939c37dd, 0x573b74788a3d7cc2
+, 0xa0da43c75f1d7a14, 0x27170400d846d2ec, 0x86acca6ea0fca499, 0x7044fdc598bd5992, 0xe4851709721405c4, 0x03e86ba50fd30119, 0xf1a843f79f6b4e6d, 0x0b928e8b65e6b23f, 0xea14cff736604b8b, 0x696015fa8f3f3636, 0x6645dba542e7ae24, 0x3927693f7efd56ef
+, 0xa3b8fd740339eef3, 0x56b544300a4ee0ea, 0x4a01a039d22802a0, 0x17a5122e0b0a68b6, 0x976b5895d3d702ac, 0x4d0754cbfc92011d, 0xfa222e1ea6ffc5a6, 0x17f2adfb6f702e2b, 0x2ac209b67dabce56, 0x3db233a9b8b6b807, 0x046c9b15a673c975, 0x797390ee7914517b
+, 0x72819deb0bcea731, 0x7bccfc95788b0cf8, 0xb2fe17a45bde858e, 0x144a5e30b7fa95a9, 0x535b461156e7fa69, 0x41c64746f67e9505, 0x31d8c21223b23fa7, 0x1c7d0f67956491dc, 0x9caf63c2b93d31ee, 0x01d8a604b2efd98c, 0xd1ddcfa1a6af812f, 0x3c13eb5e3d81b933
+, 0x61aae12a638db4fe, 0x76333cfb018caa9e, 0xf9239768f4bb0f2a, 0x588ad86b5ccb97c6, 0xa64153b23b4df27c, 0x22b707729c29b7e5, 0x2afa803bed4a8c16, 0x74f1cc446b1759d7, 0xbf4ce28f942604a9, 0x23b192ac6874d4eb, 0x5b216d46c83488f1, 0x0fa4dfba4277e8ad
+, 0x5d426fe84e72d41b, 0x4bcad74379ad1d2a, 0xb242ea3b08e8248a, 0x16131d0f5098c8d9, 0x3184ccd5514bd3cf, 0x61bfc30fb2c786a2, 0x6c78ca4383715329, 0x36ad8a09d3e30273, 0xb2393a8d5eafd6ac, 0x6a360a9a7346f713, 0x8b957d9f402a2b62, 0x77e9ac4d961a14db
+, 0x144bafca6af886a3, 0x40678e3048b0e3f2, 0x0916a640ee4d5114, 0x5be68c0d77a2a00c, 0xa5e226277dd6c88d, 0x03917294f46ceeb1, 0xbf6d19527e18952f, 0x4f47606956e4241d, 0x110d0dcd2125f21f, 0x636c5a124bda45b9, 0x9062526c7efe5946, 0x31be93471fd66970
+, 0x33f59e6bae604ad0, 0x3bca8d3852dfdb2a, 0x71735627645b5698, 0x6c475c3696472fb0, 0x9ab279bd044e00db, 0x365dcc134be92b52, 0x62f1728dd87ec440, 0x2b5434cc3b9128c7, 0x90d98b0c00137fa1, 0x1302e160ea72dddb, 0x0f642c645cba638f, 0x7de429b28eb9fbf4
+, 0xab719851a5db3d24, 0x2a514acc614dcf18, 0xd34c701e3f327e84, 0x6804bf1b4d73cebf, 0x06fa0de73db05c08, 0x107efa0171c21a11, 0xdcd3237336be33d1, 0x3616afb3c46fca2b, 0x742aa6b822b09606, 0x24ba08310e9b0720, 0xb8ffc45e523580c1, 0x44f4d3ca732689fa
+, 0x5bc17af3d0b001a5, 0x7bf2a28d9421f72e, 0x3dcbe5e634f4299a, 0x7fe98e1cb9c585fd, 0xdbfda717b750306d, 0x06215eb23bbd053a, 0xc88361947377ce49, 0x1a895f19ea270500, 0x80c1615befab7138, 0x5dcbc08af6fd6dd6, 0x2f3cf24005be3203, 0x406f1dee8ac43f7b
+, 0x33733ad20c4f20f1, 0x06d0aa5d50493461, 0x7df6285529912125, 0x1ec5de79a820a0d1, 0xeb2cbd7ecfc5eadd, 0x18d35f662c9a1908, 0xb9eea9cc029361ba, 0x5a70415e0db6f5fb, 0x18f7e16c788f38d4, 0x2c7a0082bbd3f112, 0xab2be05ebe0d89e3, 0x2024df05f85a0930
+, 0xa867f07c7ebc271a, 0x3785547c5488ba90, 0xa7494c1d7a07216b, 0x6999831e042d5fd3, 0x730f870307c81a45, 0x4ab45b6a4e0c83b5, 0x2134e3bbe4623590, 0x366feab77263be20, 0x5d9dad05800d9b3d, 0x4d99777e233ff477, 0x24a772af64e39a63, 0x0eaf56a78c22b863
+, 0xb5594129d6ee2e87, 0x5ea8fe46df1a1d33, 0x37f21eac3e31f558, 0x070500e2ed36c929, 0xf8bca66ae4be7b33, 0x5be02c1abdc8acf2, 0x25873c4c8ed52049, 0x599c1ac6f1cf86e5, 0x4f34adb05e97213c, 0x7bfd0d4487b3825e, 0xee33efda2e8370af, 0x5d18feca2d9686e7
+, 0xb7b0319703765485, 0x744b535ff89b6aee, 0x370e6db90411a676, 0x7efc31f8fb7fe077, 0xef168c5b18d0eade, 0x21b1647ec0627fc1, 0xd138e040555711d1, 0x34657b374bd66e77, 0xf29050b3bfd59f24, 0x60751ddcb7fc23c0, 0xa0684cecaf59f959, 0x62b19647023eb909
+, 0x07b0fba5c3a23302, 0x769ea974d2ac3f23, 0xc5f4b174688483c3, 0x076e5e144d28d5c5, 0xcf8a6973a2c5f666, 0x569e432d6c015766, 0xbf86d18f1d05f9f2, 0x73026520e2e90a29, 0xc23bbd79e241f11d, 0x239f8d67b114b1d4, 0x244b3c575d31ece4, 0x53f006b898f2e127
+, 0x937453f6659f8c4b, 0x407f78d18dfaf2cd, 0x16002270255bff87, 0x2fa65735e93aaa20, 0x0aff84474210fd29, 0x45d8fa33c718d7ce, 0xffc5314fc418447a, 0x09b45350edb190cb, 0x35d4bfdc4be67ec5, 0x5d5ea5a7177ea581, 0xb048d10093ba547b, 0x7ba85c9ecce2a071
+, 0xc904c757f9f76b59, 0x5d382d27d56c303b, 0x7745ddc2b8048430, 0x16f4d15359700a39, 0x3ab1767f96e15419, 0x514a420445963eff, 0x30387a808c288c5c, 0x1f293c73f68aff67, 0x88c823fd97d6c093, 0x4304fa51e202ede4, 0xd1ca0493656a3598, 0x54b8291c478558c9
+, 0x16e2fed63ef7d436, 0x4e288fbac65dc0ae, 0x22b15627907ecd1d, 0x254b55f042ca53e9, 0x92a470311eadc0fc, 0x6474eee57ed1185f, 0x4c5cc909a7d771fd, 0x4e2e3bb71248b104, 0x2f848fa8a9f471d8, 0x4e074f0f2706ec0e, 0xcad318c7f993e3f9, 0x5d82d47cdc15a13c
+, 0xbb713403f2c40a9b, 0x291e6a59d55a7a15, 0xf2c4b20a41c02e43, 0x5e2ce21b202ec0f6, 0x2368faf5ae71d608, 0x4015c1ca69add444, 0xc7d1ed9181f24489, 0x6bc2b17c8cdcd31b, 0x196f63ea2964e703, 0x79c9f4b343b635e7, 0x26eef6deed1fdc37, 0x2f7c1743b63a1605
+, 0xac89b4f2f204aeb4, 0x07858e073f71e4c3, 0xbb06194118d3498a, 0x227669664368eb9b, 0x6a693d12f3a4730b, 0x54dc70974d15707e, 0x1097ab10480452a5, 0x1994949fcbaa5750, 0x86f82d20ca1313fc, 0x6844c10e1f23b0a5, 0x044d328799a20d56, 0x54b2ec71f082dd5d
+, 0x3bac82e03812461c, 0x64ddc479ede2b565, 0x8e7d99e84fa67eca, 0x73864d84367768bf, 0xa99b370501046d8e, 0x14f57454b26dc4dd, 0xb23729bd585c9570, 0x63a201516f1d8630, 0x4485ee04443f7595, 0x40fb05d999b69fcb, 0xc94a0456bbc44c4c, 0x288915980903657f
+, 0x4a9fd210d0e3b9d8, 0x5cdf5b424af8b951, 0x2cf206bc14bede9e, 0x3c4f9beab04aaa28, 0x43cbe22c245062d8, 0x0b8d9ae417525659, 0x0a67cb7124519bf1, 0x4de6980fd4dc840a, 0x162696d84a9f1929, 0x7b5d9f2ba9df7167, 0xe35a4b2a1acfdb68, 0x0eab6d29de8e7506
+, 0x72f71463b2f2eb1e, 0x08ab46d0a46e06ad, 0x1122250858ed6773, 0x137a469f120b8bc6, 0xac44b0f2bbe68d4b, 0x6c62aad95b5bd105, 0xf72d757be0f3fe93, 0x0e9729a012b4e49c, 0x29256c835cbaa1b1, 0x39be36d62a4c3def, 0x9388904e2a76911d, 0x4e8ce3d97b4f0430
+, 0x4a44ff95cc033ce3, 0x352c932cf7d7b1f3, 0xfe264f4f903719e6, 0x75977f7aeb4650d9, 0x3335563e9eef06eb, 0x32c1202d1b2679a7, 0x036bcb6cde12a575, 0x486f4c6f2a8d56e5, 0x296279aa12cef6e5, 0x78d3bdcdc6e1978f, 0x5e57763a5a5c85c1, 0x74830c8e687c115e
+, 0xe5aef32c8f5ce267, 0x5a6b90b9717ad15e, 0xfbeb80f7f93e75ad, 0x1540c27018743153, 0x1d5c5a8c3d49c65c, 0x51c23c2cdaf968d2, 0x2c1abe34373de1d6, 0x013f3540ff4fe32d, 0x699a0c178a97771e, 0x433665ef4ebc91fc, 0xab8910186e7f20cf, 0x60d95e529b9cfa83
+, 0xe04f923440509943, 0x692e67860c3fefd7, 0x6091a6cd75f39bf8, 0x7fd52c439c0471ba, 0xb3626a66396f6bdb, 0x6d972183d7fc9d15, 0xff3408bf89e799e1, 0x4860200dbf3133aa, 0x0ad595631687e874, 0x4cf12e090b53abba, 0x90277737b5859605, 0x12129f9d94e7a36e
+, 0x31b270297408d048, 0x557040d5532d6127, 0xfd9cd25ca10d0df9, 0x29a15bf890fa8fcb, 0xcdda8ab8d29efcfd, 0x3a29dd294a6ef634, 0x07f27da3a91580a4, 0x14fe9f0778765ec1, 0x3c8e326adc3b7ab6, 0x353a812f20bfeedb, 0x8a66d5aa4ed484d5, 0x7a03721daf12b207
+, 0xae13b39fabd69fbe, 0x24d37547ce0a9319, 0x284bbd70e195c428, 0x5ea2811a74b44e4d, 0xa42ddcb07e521c75, 0x2a6e9dd88988e560, 0x787cc029afd0cbbc, 0x2ad47ced602d93b1, 0xef4eb276e4506991, 0x3998bcf1b32f3147, 0x5fb9b86d5adf6531, 0x24bdfbc548f2d054
+, 0x5b6a637000d68f88, 0x30a3064df172c622, 0x8cde95f338ef08c4, 0x003b0f453d7b944d, 0x7fa68ffe43f9a766, 0x20de094126845c3c, 0x1f37d570db3d3fc0, 0x5559c45e8bfc9a21, 0x59cb004c038ea22b, 0x1421b1baf2ec02ee, 0xd6956a87328eff11, 0x17a56997b4cb88f5
+, 0x1d1a47ddd0b4ad14, 0x156040da8305156e, 0x3e97ef8911b83ff7, 0x15c3fb67bbe73765, 0xb0f286b58b0a8290, 0x4e27bc4de2db6a4d, 0x911e36a13d140c64, 0x027b5e666cefad42, 0x9428ab487792be17, 0x7d0f947a43089cf1, 0xbce6646f56662b07, 0x32c7756232d41387
+, 0xccdff84d41716fd3, 0x66658c8d0cd05288, 0x9621757bc91bbb17, 0x23e4627c9484c2b0, 0x4ec7c2d5b4e7621c, 0x7087194de7f1a5e6, 0x1b426eda535c726e, 0x1070e738ab035c49, 0xd1644e474ee0da33, 0x7225cf4844fb2b52, 0xbdb51443838195b3, 0x10eb15f52d2df520
+, 0x155735c12b1c8d19, 0x635206d516ed575b, 0x77381dff95e2529a, 0x159ae80e76a23646, 0x11a7a2a671d9969c, 0x614298dea2fa8a27, 0xbc953dd630d76c90, 0x589e22cd98f88412, 0x7615802c06cbed65, 0x43d810268c8e8a5b, 0xa3801d778ae543d2, 0x2b4dec615750f06a
+, 0x1bc3b4d5ad491aa0, 0x27c8a11b20eac54a, 0x48e8022703e710b6, 0x4adf2a82899d9b73, 0x3d92ca87a9dc7d05, 0x2a546c5a866ce12e, 0x57911d971f0f0fbd, 0x06a227b4b1402f77, 0x69250087753db1b1, 0x0f82fe47c700f9dc, 0xbe8a5b9cc3479ac5, 0x6ce1bd4c6250c20c
+, 0xff0ed13cd3bf5555, 0x231591b5391a845f, 0x3732ba3bdc11deb4, 0x1977a4d9cb1c1def, 0x3079bf5c160737bd, 0x2177beeeee0f0d95, 0x84a3196c5ffd1b91, 0x705b4326830b6ebf, 0x16b94185ebb75830, 0x5bc07db73435794b, 0xf49b11cf0dea26a3, 0x27f0f1244f2013fd
+, 0x958a3ea4c621d80b, 0x038a310eaee3eb2d, 0xc4a5830479f74715, 0x0aa56287f8da6e38, 0x3a52abfea3b30163, 0x3612526f29aba94b, 0x15685ca3113e7d0e, 0x05d5998875622206, 0x6ff397c67b03822a, 0x733dfb4f59026ca8, 0x1cfb5df3f84f3070, 0x6cd04ce806adaeeb
+, 0x983a340786c114af, 0x562a3e87538c1595, 0x5899d1b418d848f6, 0x56fbd109077b833a, 0xe898e0e2191122b0, 0x35ecec69679ce908, 0xc8e04ae2fcf03a42, 0x34ad835b1b708b52, 0x896aa5028446bd44, 0x3fe37020b32ddab4, 0x7dcddcdbf758faf1, 0x118e6b848640e3a0
+, 0xcf0257bb52adad52, 0x5d264bc91c3bac75, 0xbb74c6719db14c0f, 0x40885799bbf4ddd8, 0x42b699f9e27c04cc, 0x3f9864d0c3fda09b, 0x22b02f24485b76c7, 0x6dd50c7a0526ce8f, 0x73e90f96de0df18d, 0x6e5930211bc8c64d, 0x2957dcf04441b79c, 0x0d97a820b74d556b
+, 0x90f534e17d7d03f8, 0x75eabc764507454a, 0x02677c1568910cbe, 0x3eebdd0e9d90b838, 0x11f47e206c4f185b, 0x76a6dfc2a7c0b415, 0x427e7deea2b0c9ad, 0x3f0d5c309b104de1, 0xf8fc070a06c689e4, 0x22277f22d43c0089, 0x00fbfce9214143c5, 0x471ce7b17cb1b38f
+, 0x52f97fd0ec794453, 0x27e7ba29f7ea95d7, 0xe6712e3ec70cc9a4, 0x734bf7706aecdba7, 0x030df7a3678b644a, 0x62fe0811c6400f63, 0x5e375b4562f98f8f, 0x485bdae6e77f8c22, 0x477817dc4899097e, 0x405d8ea063a541d9, 0x00f798327e5c8a62, 0x4f85c250a1197f19
+, 0x640642df414a1f43, 0x5734daadd02a48af, 0x0705a54728ef2fc1, 0x0b33ed6e36f504d5, 0x44582405cb9c9b28, 0x0fa888596f1f6f09, 0x4f4efa20d52001cb, 0x735b055b401197b3, 0x09d8fff216056750, 0x7b59a18ba1d23b96, 0x1de66551931e3922, 0x6642e3c6aa1813f2
+, 0x8c6f79548efe49a9, 0x1daa7a7c9fe0b0fd, 0xea6556c0dce04211, 0x3a8550a03f9d2684, 0x7daf5bf8b6ceae48, 0x77bf601aa3225e37, 0x9574cfe7608eadf6, 0x0a5465c7c0372940, 0x02c284caf53c6e6b, 0x38fe1288cb4e50c3, 0x01209f19bde6ca06, 0x074d3f63d68a5227
+, 0xbd36c3ddf107b278, 0x6c685ad56c9b6eda, 0x8eb32635114f7b30, 0x1e5cb62dd0b646f3, 0x04327941b3a43b3f, 0x3183f774f1da6f9e, 0xb3f6bcd8f83c642e, 0x663c978664eab914, 0x03309abee214b761, 0x0b3daf88b9b46f50, 0xa7f330d8f13fd2ae, 0x61fd9a9eea5fa14e
+, 0x186b09680bb8b9c9, 0x116030737cc1cd87, 0x9bf489fb1c1cce7f, 0x0090b5f4704bc883, 0x8093c4ab4d8fe51a, 0x7ebfda6ef9000a99, 0xaaddb77bcf4f07d9, 0x662a2765ef24309e, 0xaaba7d31ae3529f5, 0x7dd0963e9da5da48, 0x969b760e7de48fcb, 0x792c73e387c325dc
+, 0x229c92e7460efadc, 0x1a1f9ef560c95177, 0x6015f8bf752278fe, 0x7738d1fa61f1f851, 0xe8dad60e0525d594, 0x6922a35d6663d2ff, 0xf51ead8965f237f8, 0x06fe642bd80e39e6, 0xfe989eed89baea1e, 0x5aa2f5d405be5137, 0x4c60888b009df30e, 0x3dd21051d2307596
+, 0x18978a0d64a74fbe, 0x27c4dcfc13a36786, 0xa5d03b19cfa68ace, 0x79dcfff0ccc8ac64, 0xe85e6860b9437760, 0x25d5344b20520212, 0xd88aa108cceaf76d, 0x7c4b6d60e9c381d0, 0x44732ca03e109997, 0x6ed8945e80b02dd6, 0xd065ebff7c0ec69b, 0x4576e3225da79bbd
+, 0xcacb9353f4ca7ac8, 0x7bfe080a48440bc6, 0xd8779182b5dd53fc, 0x14b348fb67d2100a, 0xcf6307147849f7f8, 0x2c798c84960036f4, 0x19dc3b46bf6f6314, 0x120fa04e6fac984b, 0x84e7a158853ab2de, 0x48d090ef2e895a9c, 0xf8818eb74e8625d8, 0x3d0a8b6c20e84a21
+, 0x804f5035e732ea32, 0x6fbfe3dd2dc2f4f4, 0xcb16e946fd0558f5, 0x77ee871c0114eb3b, 0xc4c3877b7032c3bb, 0x239842200ed73dd8, 0x1b1d1e505fdd7555, 0x4b6125704c2403d1, 0x23f92516c80b1ae7, 0x7a61b8479e7d131e, 0x768c47719dcf4a8b, 0x14b2545023aec468
+, 0x7000d57595c9433e, 0x6885a277e3700a18, 0xfb407e0b8d472ad9, 0x3456822385537c99, 0x17e1c9faae8494f7, 0x564f32826b5ff7cb, 0x6faccab89df3e6c2, 0x152705847579e26e, 0x11a50b2f00b390bc, 0x4fb9b303671a0732, 0x2692263ba9f42d35, 0x64f2ec214dfb64f8
+, 0x6d6b8a7a060cbf75, 0x4c4375094a03f96d, 0xf7b384d470faff81, 0x4b6d685c65984afc, 0x582c89d717a6237f, 0x45745e96581166b9, 0x27c2b14a80d6cabd, 0x229cdd493262f88b, 0xb95254cb04ba21a0, 0x6593c7b621b63ba2, 0x20e3752a7343c716, 0x1642e9b97aa68ca6
+, 0x86c7d1cfb67257b6, 0x0b10893321cd824a, 0x4ede8c9ebdf585f7, 0x4a6927c00ada027f, 0x25406e6949dc21ac, 0x0aee9d75c1786116, 0xed5370875ae1bc8e, 0x57b378ae26ebbe01, 0xe58dab1f0caf5403, 0x6fba638e14981257, 0x8c14f52083dcf24a, 0x301ca8fe1c4077ef
+, 0x56b21aaffa5c0e68, 0x500602e8dee2246f, 0x762feaddce9b330f, 0x1c78a3207598e6a7, 0x40a517d329841c17, 0x37365853a471a1a0, 0x055aa0c10a671019, 0x7136b77c29211380, 0x80914dc6d94bd68f, 0x1b64d2e4fbeda966, 0x1983cd4a6fd77d67, 0x4eb3723d7c73e83e
+, 0x09d7c4f2c5fea7a6, 0x5d8ede6d947f384d, 0x4e550a65ccd7ccb6, 0x4577fe81563e5495, 0x70a0a889ba023318, 0x24a81f55344881d5, 0x16731d26194f096f, 0x048c6120577d445c, 0x595c6a4c6b488b0d, 0x2585076a51c67bae, 0x9d56f4bf680ac0af, 0x79bc32a7ae704443
+, 0xa889ff5608cc54d4, 0x3fda42565eef7367, 0x0b44d1373deb9094, 0x2aa75d7a17d1b1e0, 0xe4dc5bc9e22a603c, 0x1649746ff9a36062, 0xa3e36a07f416b171, 0x373ba5927d8da348, 0x93877c5d7ca33458, 0x4743a2af90bd78ca, 0x8e0a32dd4d499757, 0x0f128825bd5760b9
+, 0x1aa49b008f5deb69, 0x443bf61afa3ba4da, 0xef6eb6a9ad096da4, 0x0ed02677c6566f27, 0xedea1fe791b35d07, 0x65a7a3ecac65c12d, 0xbc76a9430ed002af, 0x2799c065c16f03dc, 0xe6eb5a35ba621fe2, 0x5dc11d6f02d7cc73, 0x59df049a29660e22, 0x6f8ae3a760909576
+, 0x5d533ab807313cb6, 0x6fceac4ba3fb1671, 0xe411774328330e14, 0x41c1f6875e30d6d9, 0x05b611a797418082, 0x69bd518103bc87f6, 0x32bb1de4b0bcb948, 0x3bc9fb1503c79589, 0xc08e020bf87162df, 0x46a8a787c13df9c2, 0x4fdee8e3549e3622, 0x02c30c81716322b4
+, 0x1cb204def7286f29, 0x6df09971431986e2, 0xc60213192820b7a0, 0x115c89901190f5b8, 0xf246a3fa0aeda067, 0x7c191bb03bb0c20b, 0xfd4122040bba1499, 0x0c674c6ee681165a, 0x59429ef4f29290ec, 0x500a575379dbafe1, 0x3c097aa490b5123a, 0x2021c8976a2a7a15
+, 0xa853a7fe2af65d09, 0x16c13b9f6dafc679, 0xf60a951c4e48f983, 0x029f6cc24ed80f41, 0xb6f4cee33806964e, 0x4d241b5ef82425c3, 0x764abc7d49b4518e, 0x5d2c02dcbb3facc1, 0xf5c320f8fda79cd8, 0x24b159434869e381, 0xdb1240496f52180a, 0x5b8c010a0c13eb2d
+, 0x08db346d9f839ee8, 0x5db8cb8198021c85, 0x7701fa9dc716056a, 0x5ae4c5bc6621b519, 0x7ba922539c22d45a, 0x0c56912c22dbc71c, 0xef2b85c748f3e6ed, 0x2d5251935d50f487, 0x998b2ad5516d82af, 0x02718259536f1cf1, 0x58ac54feae4ef6b8, 0x53a20cbc21a545bc
+, 0xa301857a60c8b981, 0x6202473688ca866c, 0xafb8d1604e899b64, 0x7ca39305d0976c9f, 0x806d2262953d1999, 0x7245100b2411e9bc, 0x31e0164c5efbf81a, 0x59cf8003ed5c9d91, 0xfb2bce63b5ad5654, 0x6d33d1f282d9bcec, 0xe5658632d46e183a, 0x586c099c76d91936
+, 0x041fe68fb75ec88e, 0x7ee04a9642736b4e, 0x3ac5c66843c6280f, 0x74499bfe9c4c262c, 0xa84310948738fba2, 0x638965bbaa5d3de7, 0x7e2d023c9902785b, 0x35a7507f1ab14f26, 0xdf361e96b31b46dd, 0x54a52971131b2cb2, 0xa8d942473e3c99a2, 0x17d3365a78234ac7
+, 0xa2cccf874c17e54d, 0x176094a73678e633, 0xbf826b3a9bbcdf8d, 0x20db997f25345542, 0xb847356fb8132f71, 0x4e6299168d589d9c, 0x9f6fa3c0fb73332d, 0x6c12da849161a2dd, 0xe21afa060524da07, 0x4c580455ca7ee46d, 0xb7b8840d0dd2228a, 0x695c60b7687f9307
+, 0x0b75fa69c14fdaf9, 0x73b444a14fd97e06, 0xb816dbaaf4a16ef8, 0x2e7fed412e8b700d, 0x03dae07e9f8a7d98, 0x67069f008eccbe79, 0x56070d3dbb5e96e6, 0x133d1986d25c2ce3, 0x8f347a223c244965, 0x0a4cbab4d55223b9, 0xcbc95ac877305551, 0x6b8512581c4c372e
+, 0xbc87c451fe83cf31, 0x13787c0bdc77c17c, 0xd49c64acf4322f8d, 0x095b5e2413f04b6d, 0x2265b4e6fe8d8165, 0x4c618aca565e2a16, 0xcd665812d3800e62, 0x242c4163763ef273, 0x08af48ac48450cbd, 0x67aa305db445a771, 0xc8b315bb30cbcda8, 0x6ee298820462437e
+, 0x1d7c6035d6ebea1d, 0x1818e7711b89d6e3, 0xb4d7a4570ce2b4ba, 0x3956df3202f7e839, 0x5b4ed39de57e410b, 0x1dc1ae531848355d, 0x5f7a192aed24b52b, 0x2af5dab33c7754ea, 0xbe542f210bb914a8, 0x6c1a96231c6e909b, 0xaee26c08df381fb7, 0x5f839a56eaea8cc3
+, 0xcdf943d40c387592, 0x1d6faaca08577b86, 0x8cd0d74647883474, 0x04fa9ff762df94ad, 0xb1daadb060d2f56a, 0x3c6ec99aa3a29d3c, 0x66cc33a88fae3929, 0x3ad9d083dc777f27, 0x6b36a63f5ebbafd4, 0x7ecdd2675abf1e66, 0x79173a3f2f80462d, 0x7820567659804e8d
+, 0x2b402081c0839bbe, 0x7453ca7951e6fcce, 0x4fec601d54b3b37a, 0x632dc914004f236d, 0x660ef10676046d53, 0x2dbda9f3b81a6bbd, 0x1e815f6f92d2566a, 0x44fb74757e47407f, 0x0aa84083c9f4a90c, 0x650f8e65097e4d8b, 0xc3ebaa916d235286, 0x7f8a4f44af1590ec
+, 0x1decce9df8ff1238, 0x46b44ad9f394b6d4, 0xe0823c67cff1d256, 0x35a96cba018c6f2a, 0x22c6e1c2ad5763fc, 0x05ba46720f6f1052, 0xb0c18b6a06f0e25f, 0x113444159c585dde, 0x0bde5404d4547c6c, 0x3384096c88dfc008, 0x18b01f6b4b281475, 0x3cbc4591f9a9a874
+, 0x83c507e315e03904, 0x1240265107b64bff, 0xcfa0753f8835f467, 0x0cb1ec4aec79b8eb, 0x4eb3b6f395a00322, 0x0dfdae93f5becc01, 0x06559966ec2c9c04, 0x15fb9c893c01a1b8, 0xdf933f60fbad1f2d, 0x6662dfecb5ae02d1, 0x9d3bdf7a4e306699, 0x52647bf5651081d1
+, 0xe20bc1802a5a8745, 0x5952d2f8ec8c101a, 0x3fa065a250ad7d0c, 0x52a9805d8df282e5, 0x68f601637855689b, 0x634574adaee2ccc8, 0xb512425c4e23f90d, 0x2658fae989a6a2ec, 0xb03c8750061315ec, 0x086854943f24d7d0, 0x44feb4254d14e87b, 0x428c4665495ac419
+, 0x18a23b830a58f27a, 0x5923073c4a5f74dd, 0x905293d015bda063, 0x5bebe01a2c1d409d, 0x9d05b00cbff1b589, 0x3e36b958ec37c269, 0xfec82fceb5cbf052, 0x0d8ee3c9217eb695, 0xb7e9ce693e92044e, 0x2db762300ada9daa, 0x6f9767f7ff1602a3, 0x6fee507cb455c499
+, 0x6bf20eb1ecac85ab, 0x484cbbe7f2800a7c, 0x28474d376eb66121, 0x239157180d516785, 0x31fa208f7c794cf5, 0x67e1d953093c4f7d, 0x0c08e7c317ec0e3e, 0x2031f2e2f7e15404, 0x0c90057627667aaa, 0x0e467cb618c6c788, 0x5ab775593ed51b3b, 0x2f865f2b18b5bb48
+, 0xf41b1ad3405cdac5, 0x3d990ad3e31cbd08, 0xfec125e3a3fdf400, 0x14d1b79b69c85940, 0xea608735cd89ef76, 0x1cbe58fbeb149200, 0xb556a377ec23274e, 0x2f35892cc4399011, 0xc3806ea7866f8b34, 0x0df15b6785006c39, 0x5a170b1fd0b4508c, 0x05e24fd59831316a
+, 0x79aa2405f2d90efc, 0x1cadc9a055c00e15, 0x6946a335d078d333, 0x176c1193cf40ae72, 0x3079fba8480bc7c1, 0x02b9ac81acc4beca, 0x1f665ca2f3fddfb0, 0x0d6ef8af66754ded, 0xc206f5cb12db7ee8, 0x0f0ea2d2ae63827e, 0xf165d134be9737cb, 0x05298583f0ef39b2
+, 0x27b8e26f8e58a154, 0x623e1099af3ddc53, 0x3df2898172c94dfb, 0x30208e100c250c37, 0xdd1cd622466108c0, 0x16ce1b6eadcb7d7b, 0x265918e2f89f6969, 0x322f6b1d46ffdabd, 0x78ca3c9a0541d66b, 0x5cb640efb8d22079, 0xf5ab4e7e413ae3ec, 0x1c745faa840756e4
+, 0x7c1672da9f606833, 0x6e61c64d8fed5144, 0x53a70c3ec4a754f9, 0x78dd246dc9a81b53, 0x40992ff8861e994b, 0x7e837372b6ff23b3, 0x86ff0a9610ed2f1c, 0x61f2cdd1b2996807, 0x42c8cd8086e96dcd, 0x65c82bb535f4a687, 0xb888aaac19d64f35, 0x35fe559ef3d8bbbe
+, 0x20b98646abe5ac5d, 0x64b3347bd7b7e05f, 0x1bbb988267e91058, 0x481389e085b9d63b, 0x85f4bf7c8cc5bb83, 0x38d9f9025197ac2d, 0x820110b4e551140a, 0x403df135da1b1cf0, 0x5a535c7be9a2fd67, 0x7f4087f1ba2aadac, 0x43a947219f19df37, 0x6e8791b8c1e0bc08
+, 0x2201e27782c7c860, 0x07dc563cc419b8d2, 0x8a110624bdeb3d2e, 0x5767afcacf080ce2, 0x29172b2fd76f4f7d, 0x52905fbd6bd2d8d9, 0xa75e9989b5ba74a2, 0x5ee38f1ade7d705b, 0x77a39b182d38f44a, 0x446871a56ce5331e, 0xd05af83959a8564a, 0x52822c9051c146dd
+, 0xb2c30692ba9d79e2, 0x46f97533b004fe9f, 0xb09204f864037ddd, 0x6bf72cbcdbfc6203, 0x2506f14bdce516f4, 0x1459914c3bb8f60c, 0x66b917fb818b5356, 0x03c183f4536c6fef, 0x98efd0d3b3e70eeb, 0x2c83271e793c6e41, 0xb23daae89fc0abd0, 0x09aeb6c2d9ee79c0
+, 0xc8f1f32c20512adf, 0x6ad86ac52dfa34d3, 0x469002056e4509d0, 0x1d193f05f2ee143f, 0x16b2ba34c8bba71a, 0x2940d523851ae6d0, 0xc2a51c98b48324b3, 0x50e03116f7404857, 0x8297d870ec12248b, 0x086bccd1d30ca0d1, 0xc141bea068bfe275, 0x74d2d0960fc43d39
+, 0x366208746a70e3eb, 0x3401c3ca6cd3cf73, 0xdad6ab23d41560aa, 0x588ae7e806527e7e, 0xd694bfa0fa61fb8f, 0x0841e4b28d4ab05f, 0xde8da0b51d81764d, 0x480fb49396224644, 0x0f1a25e9158b2065, 0x63c08e83f17d301c, 0xf77c8582774b30ce, 0x456c852bb0d0cea8
+, 0x684a0359271a45f9, 0x2cc07bd51653fb75, 0x95986e8e688566d3, 0x5807fe5c03c3dce4, 0xfa6e846fbc11e16a, 0x266d4ab0d7aa21ce, 0xa4789acc73f092b8, 0x45ce23e697cdee22, 0x971ec5804ee660da, 0x58f41335692a31a2, 0x5e19258e916ccd18, 0x64b2985456c7b439
+, 0xb88b4f5524a072b2, 0x045245a268ff7ebe, 0x397b9cf4715422fa, 0x2df66250cc640e36, 0xcf8be29b01134e38, 0x1738bcd04fa93d77, 0x64dba76de382606a, 0x2144913a7d5e6e65, 0xe74c629042e2e617, 0x2ee368884ed856c3, 0x672df54d9c8779b4, 0x756233730142f359
+, 0x2f6e7d6c9dddd051, 0x1a7c4defc33e575c, 0x64710185b12c8b93, 0x3e16beb1a0bae4b9, 0x5d3c6a36914f0d59, 0x10bd6a39cb75e426, 0x2095cc44942d68fb, 0x43b6d315aac9615b, 0xe8a754947b86646a, 0x02fdf7520eb908bf, 0xfd3ab5f5832aa3bf, 0x5fa9be37f2d67c46
+, 0x6c9f1b8d87361192, 0x7dc32e6eb5a93c28, 0x0a67613fb0d201b3, 0x419e06c3c406db63, 0x48c0fa87e291d49f, 0x0d33e392d90597e5, 0x30f0008f6a950583, 0x4b5c22aa0b68d947, 0xe4a1c20bad271268, 0x1b03ae7c483eb499, 0x4d9cb00420e83aa3, 0x70edada1a11cd659
+, 0xee0e4bde8fb17d03, 0x2535e578d6629216, 0xfc730854cfefed48, 0x2a970b50a5dcf5f2, 0x1d1a9e4602b4db22, 0x1657b8a9ec4a96a2, 0xd3ccad9f7560e0ce, 0x649dd9a6d8591201, 0x30cda5f289211328, 0x753d5d773ac532cd, 0x776857ce9e602d5b, 0x4cc005afabf9c91d
+, 0x053057cf9b44570b, 0x3afe54c8fb18d686, 0xedb285732bcd0ba1, 0x2d3ff63bb43ff270, 0x924a583e3d83ca58, 0x54c0c2ae8857877f, 0x6689d23967c883bc, 0x1191c43b05451b47, 0x75feb3a0085e9d3e, 0x39d4da564b7586d5, 0x2f5d72bbf319db3f, 0x35900503d2c5d064
+, 0xa1541da8431c1068, 0x3fdbb7988671edd9, 0x79c048d14a82a0c3, 0x1f052db0af419fc3, 0x387618aeff1e1c11, 0x2e43e0d6afc2f99f, 0xb4face3562c9a5ca, 0x2257c41d3432697c, 0x5ce060425e053e1c, 0x61d7e1ec8a6f8b06, 0x0ff37940afbc00d9, 0x75b3e53c155bff84
+, 0x950e3756a4a6b179, 0x05561ccc1151b666, 0x4d32877a48e95cfc, 0x7a8a50dde09825d3, 0x2986a4d301e830c8, 0x3749a81b3123da18, 0xad9910160539a374, 0x5c7b3ffe523cd588, 0xb3e8263afe3d463a, 0x7fce24a3f39ec3d7, 0x8568f88196f51307, 0x3ae55741abc880f4
+, 0x9967f912d43a5861, 0x516d6790f9b0ca24, 0x813f780c1862dadb, 0x03225f78d1d71bb0, 0x924944249fe6d36a, 0x204c743dfcaaf652, 0x3f9bd88c488b35aa, 0x30f90f608d7d1a99, 0xb176509feeca9022, 0x37a55bf73adf03a5, 0x60fef45e698ebe70, 0x2afd56279e4359fe
+, 0x0956a94a33799498, 0x7548104490435cf6, 0xc2988049f96e284e, 0x4f33dd766942cce8, 0x5a4e7326aeed9f5a, 0x07881d61c719d1c6, 0xc20706662295530c, 0x1d136d3a8b494589, 0xec035055bfa08991, 0x45b1b1af34791ebf, 0x69ca7f228d18966e, 0x3ac37828a98c9d1a
+, 0x829cda491c546f92, 0x305f1449817733e1, 0xdf65db14f6b0fc6f, 0x725b0d4834904f70, 0x9dde4c40d142363b, 0x0d40e05b7e2f5c6b, 0x776d5fb54d2e2907, 0x189e4614b227a178, 0xe6b6faf7e9f931a4, 0x1c615ca49f0ce730, 0x985fc1f52d8d55f1, 0x0dae7dfa4a3b99fc
+, 0xcc67ea79d9c20688, 0x1e4854bb44cd5049, 0xc8adb8c78c2220ab, 0x75e6a312c905b219, 0xd6d186c24e4540e4, 0x27c60e2aa09f2ab3, 0xcfd0362191b298de, 0x2cb2f5d001481141, 0x6d37246c4293a9af, 0x35ffda716ee4f818, 0x76c8e96c09611699, 0x23484123c6dbbc3a
+, 0xa2c408f2f1278492, 0x7107686e8241a295, 0x7fb45e8db2f07ff0, 0x5b27d3197a19f9ee, 0x8fb9cc0211536421, 0x036f9de94d7c4392, 0x8c24cb5b7e70b11e, 0x3de91f56f8701f10, 0x6692801bd6cdce86, 0x2e35bbfbe2414c55, 0x3999fb63ba9e1240, 0x0291eb7433bef96d
+, 0x6a1297f1b8f077e8, 0x2274c830705cb60f, 0x4a3865c06cacb61e, 0x7b59ad9ef11646d9, 0xc2578a396750c1bc, 0x0dfe803feda4d9ba, 0x2be87d9ac4202093, 0x1c5abfca4bb0dea9, 0xe1b966122e478ab0, 0x046cfd2bd233513c, 0xa46c3b2bc530f80d, 0x43a38bebe4f812ff
+, 0x9d42ba309d9f7769, 0x74c5f3392ff3017a, 0xb3f0bdbd787acdf9, 0x29362ce308859ed5, 0x958ee075dff58d95, 0x45675cb0f0770bfe, 0x21181c05726df879, 0x58b2f999bc69a00e, 0x6e5673b19f0bf0f5, 0x1346205999876c1a, 0xfb012c2ab870bab9, 0x1e0c365d709930a9
+, 0xa3ad5ecd9ff05471, 0x26e9a0860bfc7557, 0xbf5844ca8b018521, 0x0c80fdc3e778bc61, 0xb1e171c71925829a, 0x2de99fb86e8eceb9, 0x1891d47359777773, 0x4858b7f37389815f, 0xdc68002f75498908, 0x4f3d6fbba967334f, 0xa53e066097cac123, 0x582769cdd4fb6dd7
+, 0xb58b7dcd9a3301c3, 0x3cbf2e931d3e70c6, 0x76194bc030d001ed, 0x4e042bf6f61c17d7, 0xf79d988915afe8f7, 0x2de1d5da8b87acad, 0x9529da0eeef9a4c7, 0x19687a43630015e9, 0x3dcb2e41316aa917, 0x65ec4994f93d6fd1, 0xb4554aced8336115, 0x73c2aff295550012
+, 0x6903705ad67cb029, 0x030caa43e7e5ff8a, 0x246c6b0d2fd77054, 0x47c4c0386ec50f82, 0xaa0ea03c1dd8e8fe, 0x19adf3044190de8f, 0xec654144f5e5bd35, 0x0f94cf9b0644aaa0, 0xbe7934a9d736bc62, 0x64da79f691a43cd4, 0x0c01b4c50c4394bd, 0x5d16ca65650223ef
+, 0xb3354409003907ed, 0x03e9aa3a6af8c020, 0x097b31a842b6a8b6, 0x5166567f36b66151, 0x359f5a6cfb24db3d, 0x64fb477b070f9a15, 0xb7c7fcb2ede96eae, 0x142d037e081dba76, 0x98635d956d899a91, 0x1939b8d9d74c16ab, 0x58113cdd71daef71, 0x1cf41258b48216ed
+, 0x4a26051837230707, 0x324b418886426daf, 0xcbc352925cb06abc, 0x541de0acfa007fef, 0x6cfd188e729cfbb5, 0x0c9d69a35d71568e, 0xf97b12d19adbabd1, 0x792e842db7a8aabc, 0x0cc5bce8410fb22f, 0x15c8abcb6fa433c1, 0x2055aea191053d1d, 0x407895a119d64f40
+, 0x5d0a37aa0a6248da, 0x6c992ede8d71d52e, 0x15c405bdc3c41f58, 0x7dd8159d8ef32878, 0xc22ae40684780330, 0x327214ffe4e0178c, 0xd3f3f461c4f75c8b, 0x33be50619a98c0b9, 0x92b598d60fdee6ad, 0x157eb91e937c4cac, 0x424fe9a9cb14110b, 0x77dcce6cdd25a1bb
+, 0xbc0e3a69df85d720, 0x3cc2002c09e3de24, 0xda098a844e234ae7, 0x55139224a05e3f7d, 0xa856a282e0348ed6, 0x7585a446666da983, 0xc353ec89c837ae42, 0x281f49f86c5f40bf, 0x27296849c00f9e84, 0x7402d47a433aecdc, 0x8a3ec66e23b0cae2, 0x3ce9ea8c795f0f0a
+, 0x8d545e35edd7d273, 0x33c1720ee5a43c9d, 0xc8d20d75c552dee4, 0x2b14d4604d71d2d8, 0xa2aa4a5fbf978155, 0x32c1ef398c4f8575, 0xae3d07af9bed755c, 0x30dc7b4621a7f440, 0x6b8788afced66d29, 0x21664b896713e68c, 0x1e531a0a66854aeb, 0x3ab8cfb2c8cf9529
+, 0xfd6a56957b0287d6, 0x189137ce2d5a93bf, 0x394d36bf2b5081fc, 0x61fa5b74c5115e78, 0xf20d0af62d954153, 0x665404e13b0eb3c1, 0xc7d0c2faaa261051, 0x1e517bfbaa998e24, 0x7431aa84e1aef1da, 0x492ddf93d0348d21, 0x3cdaea0134bd614b, 0x4dcce0de0cf906d2
+, 0xbf08549d70b345c4, 0x41afe775a4a678ce, 0x2b222fae60cf09d4, 0x7fc35b4d728a46f3, 0x0dfca024e5a51454, 0x359a448fa656f6b7, 0xc99ba0c07932f152, 0x7289aecd88141c05, 0x6fe38079b2955747, 0x02cee283352a4fb6, 0xa12b86ec147674ca, 0x1982bb91e079c473
+, 0x961d6dd73b60751e, 0x78ae86eecd824457, 0xae9bd837f471e7fd, 0x01592cce5f74e007, 0xf7b9fc7161b93c3b, 0x17a2a612c75d2c36, 0xdbf80544eb3bc2c2, 0x52f4633b91c12217, 0xee1c6c8b531c40c2, 0x057ba41d30dbc2a2, 0xa1574dbb9f0918b9, 0x389fab67e3719ab8
+, 0x15be18a2766c505c, 0x6f22d71b3a174e14, 0xd19439e272c11b7e, 0x74188998464a6dc3, 0xff23d8c578a502c3, 0x6d833fd91514c9fc, 0xcb269e8e19ed640f, 0x5f0a7bb6fa32245f, 0xd798cd6c88fbe39c, 0x58ded7fc56ed8d1e, 0xb8877d6d15603563, 0x7e466d23aeb3dc55
+, 0xc29cdf2572d68e39, 0x5a40cd5d143c8328, 0xc4dafc286002197e, 0x332077d42ed024d8, 0xdaf7de833535939f, 0x5fb9a23a88708cf4, 0x84707a28e46f4ee8, 0x208c50c441d4c8e1, 0x1bb8f66e0e2e9733, 0x414e6326c0d7d8d9, 0xae3159190bd395ea, 0x4a01b8e96b29917b
+, 0x4dce09dd5012c8f5, 0x421d4290a65ec3f0, 0x4b196f806af7d76b, 0x52365b62c38a9809, 0xc79837885af63b44, 0x0a58d95cbcb4158b, 0x2c52cae191bcf6f5, 0x32fe4a021a33f52a, 0x7da768d94ab87df1, 0x6e3acb2f83dc5986, 0xb05b9b1c2585899d, 0x08313dba415c9cbd
+, 0xf80c01bfb898408c, 0x7de7e96206c2f9bf, 0x7906e8a3237035d6, 0x2b3067d599b89817, 0x6dfa205ea8a649f8, 0x19f5e21ee534695f, 0xe9b9b6f84fefd719, 0x260350ce0bf71f9c, 0xbfbb32f7c34ba867, 0x49eb557e720ab191, 0x437815904ef305c5, 0x65083a4ebfd006c1
+, 0xe037c650afdac904, 0x1cae9ba2425aec62, 0x0bba4627be345b73, 0x5870cb1bea5d6f44, 0x3e9ecda0a01f2af1, 0x2bbabf3286833230, 0xa4c12cb0d08f3aaf, 0x70daaf397b485c7f, 0x8e82aa49051db89e, 0x38c38c6eff6df6da, 0x9c19b18b3f210462, 0x11a58ceb0040559d
+, 0x35e23e8bf5d5796c, 0x7bc18d8bc5e72162, 0x5393a7f992543751, 0x6a14e912bc81d53c, 0x6ed5a5f81e3981e5, 0x2510f03eecd0b900, 0x4cbc310ef93119bc, 0x7f44b11e5e7ccee5, 0x107fab3bcb0b5ce9, 0x49bfd204e710a90e, 0x622df29a0b326198, 0x1923ed009a451b9a
+, 0xbcf1278d3eb5d85d, 0x61fd1abdc1677740, 0xd77732b122ab0b7a, 0x2e47c311569d22f8, 0x0cb74ba4856a3f51, 0x3a1835a759a66b55, 0x9226a0cfbf9bd3f9, 0x73cf9920a09d743a, 0x531f19026d884c9d, 0x5b8466095fef9d49, 0xf44250c1a2b618ba, 0x0e803783a6a1a726
+, 0xbfc4a43f8f2d4109, 0x7c3e96065a36737a, 0xc4f61d732920851a, 0x2ab4f35c4fca93b0, 0xa7fb883c67acb77b, 0x4e03483cded7af7d, 0xd31afbe9bb0ee5f6, 0x1a8063346ef5c7a3, 0xa6f2fc0a7e5fb0fe, 0x2c0e3955200c05f0, 0x05906e9f9ee1e71a, 0x2da8a7e80bcec1f3
+, 0x9de4bf9490efcbf4, 0x72af90f397575474, 0x5b3b79b1aecfed04, 0x2cfafeec6646a9ed, 0xb18b6a08264e8569, 0x715cd9bf1dc7ed14, 0x520726e0e60faf1b, 0x499b4a43dacb8dd8, 0x95860e5c782216c6, 0x21212bc9aca7389a, 0x8418aaf459125fd9, 0x01e4fbaac319c289
+, 0xb5d701efa295893a, 0x4fb6bd249eb9d2fb, 0xdc779f3bc63c6589, 0x356edba4b5cf4b30, 0x8fae05c1a9ff1014, 0x2d8831ca8e63cd3e, 0xd93cdc6964085493, 0x6e4ea68aaef40cfc, 0xa05a99588038015a, 0x67f8ac29ec659019, 0x33c53e5b69bb03d2, 0x12fb9e9b26919fd5
+, 0x21845030b2dcfd21, 0x65f1d2056f561248, 0x910a341043bdd0d4, 0x6d717a14eef73cc8, 0xd67880407d1e7727, 0x0f4c4b7b0c720218, 0xed4a38a42f942074, 0x18c65fb912c8cf37, 0xffe881f04a5bcc3e, 0x23d92d2276cab2c4, 0x8f973914bd77cc2c, 0x22ca2bf49c088d8c
+, 0x9e1e1a9eb2ba86c8, 0x04e9de5e5829b417, 0x6617e96ea31cafc7, 0x79fe68c9451d8662, 0x685e8c0c1bdec760, 0x6e84d2cc4308fdb7, 0x5fd0e5ff929a51b4, 0x77921ed754887ea0, 0x4ba2f03b633a9c64, 0x25a5e7f439a4ae8d, 0x9094e9c5e0de703e, 0x3a2302619511b3ab
+, 0x869a7c2d3e01caa3, 0x4d510232e2a7639b, 0xe0c3748d778af4a8, 0x549b520d4d9162bb, 0xa0f619f0a3b99501, 0x10dd71634b51ce25, 0x6e1f47d041377bd2, 0x33da6eaabafa87b7, 0x3fc07495d3b017e0, 0x11502b7f1f224e19, 0xac7f6dcf42235818, 0x21298ec72e8741f1
+, 0x102d8e9c84b96867, 0x3a64a19b73e755e6, 0xb25972ee8c24b630, 0x6b859242263592b8, 0xac0970db770d1363, 0x5d34e3de83215dec, 0x714656f3068517c6, 0x3fc0fd2bf1c38152, 0x212c87be0074d1ea, 0x226a55004c6aa686, 0x150b9be8ef59585a, 0x79ee4b0e568a2908
+, 0x425f1d2106f7e672, 0x2cd46d7765b081e2, 0x5c811166516e786a, 0x625e928a8473cd68, 0xdeffaf732f19ba31, 0x056de086c084f2b1, 0xf9809976e3df80b7, 0x6495ab8e839740a2, 0xc1fa019a6a5889ee, 0x1965d3c6ca33f184, 0x22f49ddd3f68e9be, 0x290cc9c4fcffc6de
+, 0xa74cb634e1294ce5, 0x3997265f259cefdd, 0x836ebbd86d51f37e, 0x43d029f7ddb547b1, 0x505d00add358f33a, 0x38eb30b569721669, 0x74b2ae54a96ba8e4, 0x58e52b0d10507ffc, 0xc133a9de78e09475, 0x0c7b3109bb88e5d8, 0x2d2ab0f6738b08e1, 0x56ac4b483fdacb3a
+, 0xc6b8cbdfb1b4eed6, 0x018344213f0d9a8f, 0xdd655df598e1e283, 0x465b6db5c2b4091b, 0xdd8014387d7db4bf, 0x7bd6d3546fbdcce4, 0x80c5ab6fc4269ea1, 0x1dd8f134a75b9401, 0x58dfb83d06802486, 0x420345bf66567627, 0xb62babf4bbd51385, 0x1b479e9d86ac06ae
+, 0xf922446e7a2191b4, 0x50101cd192fe02db, 0x56acfca055a16217, 0x52aeeca456c2e95d, 0x36f549e1acf68441, 0x35060318131fb9a4, 0x662c01bd076ae51f, 0x7431b40f4c3d5edd, 0x38fdfdc09b192ea1, 0x19927b1768df0157, 0x32b17a7e3cc997d1, 0x35a67f9d991709a4
+, 0x4ada69288011ce6b, 0x2db6e94b95465bd4, 0x04d0caf9f77b862b, 0x3092f116f431bf12, 0xa126ed73baf3d599, 0x54b86fc7b16ef31a, 0x859b91b1a7fe4e55, 0x3d616b77721ad51d, 0x7e68bf71e9885aa0, 0x4963a82a94c64a5b, 0x60bf8c087b1380fa, 0x3938e73fa3331dcd
+, 0x15260b850122ddc3, 0x26c4369742b8e79e, 0x0548d2e9e7f1ab71, 0x706af6eb2cc7fd8b, 0xd99c34f15cc40674, 0x5b2a26525ae1764e, 0x038a63aff1af3d70, 0x7770ce80cde050c2, 0xdc21afb912a5a69c, 0x707d0bc0286a5834, 0x776a28b9e1f7f0cd, 0x56d63ce06d0335b5
+, 0x4ec60115a109ac18, 0x187c0aba28453f99, 0x1ceaf819000a0b9b, 0x526b87d25a957cab, 0x0a0ba6b9f85f547f, 0x3c885e131951d45b, 0x5a271ddfb37c5f93, 0x28882981ba3faf83, 0x86ff40103c2e9f70, 0x20b538198a43f599, 0x7a679700ced7c4d4, 0x1cfa960dad99f7a8
+, 0x62575a9b9dc36599, 0x383aeab6d010b659, 0xc75ccccb924a8427, 0x7983594c2eb286ed, 0xe6308686f3844b54, 0x0b07a6f91f5338f1, 0x5ffe25201466c727, 0x3b968d1397c03d25, 0xfa6dcbb1e4a97d8a, 0x7c7ed42a6870eca5, 0xf301976f7a471825, 0x0b2a8c3705bd6aa1
+, 0xb5e8269f934bc4f7, 0x780317ea58751cc6, 0x22bd26a2d281ece1, 0x5e7809bb2eb9433e, 0x3d6a8495324d8f28, 0x4b87520dcd79b4c4, 0x28110375a5bf57ce, 0x08d251fbb07a7cd7, 0x5fa9f4d79c322253, 0x29813ca056ef5a45, 0x10865b51a1b6455f, 0x44e69192297da376
+, 0x8c75306d2fb7b1f0, 0x5d7c2fb87d76439f, 0xc60ad09151c64162, 0x730ee5f5a705ecfd, 0x2836987b2f8a3b30, 0x5ce61a0fafabcb05, 0xb7bb636ba2ff20a6, 0x4f803c2b821d5cc9, 0x4d0ac0ff9a295c5e, 0x1297ec17427a5386, 0xe62f742beafc07ae, 0x428cfbc9a64f4570
+, 0x02a9e069f88e64e7, 0x240c0c66021a1f3f, 0xc279e6f334ba854e, 0x460ab72bcc55732b, 0x5701c5cddbf67ba0, 0x4699592d43c43d6d, 0xe7cc0204a34b343e, 0x09a6f06112046919, 0xea265b49f02ca31f, 0x3902234c63a36b13, 0x495ec2599f4d9c32, 0x7a7e8e48c690276e
+, 0x95e2d94dbabfa143, 0x23b7849cba3688e5, 0x5f96cbc0693dcf48, 0x4f0ab67c03c852a5, 0xe497bd956def85a4, 0x4efbede060eee32e, 0x06c5315c7c074060, 0x639464cf334638f4, 0x8a170c5d4284f2f5, 0x42de1c86519cfef3, 0x169eb6f71fba06d0, 0x16e6d6e8df2f72e6
+, 0x00e1d7e0b0878b38, 0x1c16fc717aa25ab7, 0xbdd6e3fe832131b8, 0x5300318f801b49c9, 0xf1a9a73308172dd6, 0x1bec21f4cf3d95ac, 0xdee45353fc1d8e86, 0x61c41d678920a7e4, 0x74f0ac04c34a7f36, 0x43272eb7ba592944, 0x39c691bf65957824, 0x7e02eba5ea915dbf
+, 0x2e8fba117a15817a, 0x4467750b995404d3, 0xdcf7753d1d686ee5, 0x0ab173b438516a79, 0x87c8bb3ac1254a6f, 0x5c3c5a34106a7b4a, 0x44804b202e573331, 0x57086b6114a5d52e, 0x272e4ba1fe5c5f9a, 0x7d164df5a4248b5f, 0xa5263a1d6372b449, 0x3ffedde56940a4c6
+, 0x2d0a61bf515a5a4f, 0x4becf6153ac1511e, 0x484c8ec7cce784be, 0x35a0d40f4dae6ec4, 0x734b38fe3c8d94e3, 0x38ee2af93655d07c, 0xe7299a9e6ca72ac8, 0x780bf6080cad3ab2, 0x7dc49b73a7d012fe, 0x7c94c5b868ecb8c8, 0x8cf70cdea81faa2e, 0x44321027d3237f14
+, 0xf723f9daa03f2123, 0x3fed2b576b1374ed, 0x77aabad52554d6f1, 0x31bf88d0cb9fb053, 0x74eb75cd1c6d5030, 0x4f2d075b99ae619f, 0x838a37c85b97ac9d, 0x749428938f478bab, 0x5c556ec8b2c9da1e, 0x1cb8555c0a9d4b45, 0x8d17d3e522519453, 0x628bdb5aea9a7f3a
+, 0x53cd9bd62532ad24, 0x398287bcc8b3e443, 0x6795234180b897f6, 0x075255b5d44d2525, 0x00d9cefaa50d788b, 0x3ef7ca8ca3a91b34, 0xc3c910c868b14bd9, 0x2fbf5be9858a2b5a, 0xd54a1a20e2607896, 0x41903b05404c05ed, 0xadb400016a71bb21, 0x4b15b62694968697
+, 0x0893a5dab5f1e383, 0x56930c948b4cb313, 0xcc3b15a18e753aff, 0x488ae2aea34aec20, 0x09d5fa1b580174f6, 0x27e6d872973559fa, 0xe322c4eadddc309f, 0x38a74c47b38debbb, 0xd3f2556a99aedb37, 0x74917c87b123f41a, 0x5f581797709a5961, 0x5adc0e33ecf4cdf0
+, 0x2b556ab2cc44e2ff, 0x6bdd478defd89aaf, 0x5ebb041ae5d71f0a, 0x357493bc8601f496, 0xa318c9b524a0b3b9, 0x7786b7a7063512ea, 0x06929cd20082c2f7, 0x5273a6991a667bd4, 0x376aa2a4c76c5b5b, 0x3850f4f892956ba2, 0x8807894c1b521f0c, 0x2e572aa92efbc77c
+, 0xd339b31519c337ea, 0x5fbb2b0be49cbcbd, 0xcd2d9fee4287bfa1, 0x11d7ef91f5535828, 0x8b03b409336bc2de, 0x17b1411eb90c654e, 0x4565ec2a56fa1adf, 0x06b445d3d8beb15b, 0x8f975e4bcda62828, 0x482029c2dcebfe14, 0x2b1af68ed817e435, 0x62c642de00fb9abe
+, 0xb4637f164957911b, 0x70cae1ddbb9a3939, 0x2eeaca77a2f3c1d2, 0x3924154c1c577374, 0xd5859686c8079b9c, 0x4216d3d08e409c44, 0x34f6a0c38c7e0884, 0x19875fb8abe40712, 0xa7af61ec8d716e99, 0x387aa793d75f33dc, 0x8b0325f97bf5277c, 0x596117742c7a15b9
+, 0x4ddf426c4d45f5ac, 0x5e25dda279761b18, 0x607968c2ff86fe5d, 0x5f0391b19fb1c18c, 0xea62b033c07a5e91, 0x37826d24bf989baf, 0x78c77b1ad8c53c0e, 0x71c17e32f459845e, 0x6e1ae8d66924fd51, 0x3108981f79d65f05, 0xffee474c20f2b723, 0x35801ef7fb886d7d
+, 0x42f1a39557d48d49, 0x233be8e13c7c7efa, 0xc55aa3dcb04af876, 0x50a1a541fe5c01c3, 0x0a8f77c551d5bce2, 0x628fa17ad98ea035, 0x1b7fda1c1ddd86eb, 0x1c7646327c781dac, 0x7d5916d034f1f0d5, 0x04efcb86bc576942, 0x7b2a435661e0483a, 0x0ba82794604836c3
+, 0x4e0eeab209a2e94f, 0x601af2914584776c, 0x0628b642cd3c32a3, 0x2c553374478ad191, 0x8469198cb41ade27, 0x16ee338a6f14b59d, 0xe4144654d4ba977c, 0x56ea6e0fbc6032d6, 0x2b7670ae09767ff4, 0x129caf11f1ca3ac9, 0xf815c24f7dd6f2e6, 0x709093a366b66fd2
+, 0x92763c314a8ce81c, 0x06933dbfdfd406ac, 0x2c73271edd69e90b, 0x79ed47655d9af0ce, 0xa0ac584461482025, 0x097794a1208ad26c, 0xea5ee463b709478b, 0x7a8982ccda10866b, 0xa5fafd2412985135, 0x31561d458b8b1689, 0xc2011d6ae6003822, 0x1c7d1690deab89c5
+, 0xa333a7a48cca1cdd, 0x477bcc88c55f772e, 0xcc9297d90d28efd6, 0x160f5aba00a0c33c, 0x484d32b2573c4c6f, 0x178cc094449727a2, 0x45f7baf529dd97fa, 0x12cea2d95684dedf, 0x736d440ee8c0518e, 0x3ee63072c3e1b1f2, 0x4baa5bbea5e90c61, 0x7945a1c8d27531b0
+, 0x971876ccc0219462, 0x12e7ed252829ae6e, 0xd84a41c83c2bd76e, 0x67b728c9f02e436b, 0xb1cc6b6751c6e677, 0x0fae7303af921871, 0xd728eb4266e43c0a, 0x2484d8501a94231d, 0x9b47fb0cb510ff6a, 0x221c49274726ba92, 0x170c4c7f20e88c0f, 0x37c07014c9c50e74
+, 0xf3bff43e1697186e, 0x453c0406d9872f42, 0xd7d79c03191de8c5, 0x23cc6835bee61ba9, 0x38e2d72a1bc71db5, 0x7a7a46ed615147a9, 0xffe63c014d8476e1, 0x65cd11e77ef41adf, 0xdc777bd0e83b2985, 0x109fb7cb5ad34b56, 0x15aafa71e31ea44b, 0x647c661f53a772ae
+, 0xa6e76bcb2d807dc6, 0x3865d13bd11a70b7, 0x174f28c87331a5e1, 0x2fd6d5aa08d8a29e, 0x2d1a05fd4d1ce966, 0x646452eb9a0b60ba, 0x2ec6dad3fcddfde3, 0x04109d30bca77b88, 0x19802c75ffffee8b, 0x266f7740d73e4508, 0x25506c92db1df2b1, 0x44bbb49f5b3574c7
+, 0x4853cc56c43ed91d, 0x751e1bce0571cad5, 0xe2a8cff58a8f2907, 0x0dc47ad33b451b25, 0xc9339a0d1ee9a83d, 0x2d51a7588f5ca1b0, 0x110c4720b730353c, 0x032ccd428c55e8f4, 0x2e6d1c933a22982c, 0x1a4a6ce099ba3aed, 0x8012cfaaa78aa749, 0x13b3170d7cced026
+, 0x7d20dea285283fbb, 0x6e75ecfcf16228d6, 0xfe0d31f4335a3c14, 0x58878dca3e57f8ac, 0x08a39102266173ab, 0x75986372145b25f2, 0x84f77dae7b5c2aed, 0x119aa9f384d6e5e2, 0xd4c28955023f2859, 0x2df7c5b404179039, 0x0cdccbebd0b49979, 0x7c0bb967d4557308
+, 0x3830422b695c7054, 0x2ff3357c31bb911c, 0x878ea587b118229b, 0x58618092b3c13c1a, 0x4cd7a537fd66eb6e, 0x562b868f0ccf05ad, 0x06fc244abaefc69d, 0x0b7fc066113eadba, 0xf66ffb26934b883d, 0x0e77623c8593a6fa, 0x6bd2a36d4cd11f15, 0x41b4fb2ab00a007d
+, 0xb5f29689f405b9e7, 0x460ed746b9ddcd74, 0xf533b4b1062ecbe4, 0x71df05beba5611eb, 0x3af67b8778f76a78, 0x3cff6d6bae380909, 0x9c7752dfaf612080, 0x0f292bc4bcdd853e, 0x378f87ef0347b262, 0x1334359b89f7129d, 0x37398119fb5f5b5e, 0x107e37e0a3d10712
+, 0x760c3af6d47c0a07, 0x31563c768baa74e7, 0xc3d540d96367d9bf, 0x27716fc34be6b4e1, 0xcc75168d5c041f3e, 0x27208bc9d6339716, 0x880890b646c29368, 0x524a0ac137cabf34, 0x801c0a37bec39fc5, 0x4ee724588245a9b0, 0x3acbf696cfe599f3, 0x19983efa87d9df94
+, 0x300146f275606f83, 0x77f273a97cb2aaef, 0x062e0c093ca1fba9, 0x75d69cbfac882c8f, 0x01de66331816a8ac, 0x26ac8860622205ee, 0xaf0e832dc55d864c, 0x591ca42fdf9be3f2, 0x641e821759165af5, 0x6a251a33ea23b2c5, 0x97c40a63b2b6d063, 0x02325cc76cafa790
+, 0x824291df47b12698, 0x4524b2d3188da12d, 0x4721e7e709983db4, 0x082ba2f9f50a46d3, 0x8c29f3daefd72f63, 0x1b1a90d38b68247c, 0x6f7e3c578ab4aa20, 0x447d0a49206ee652, 0xbdf3d1ecca5b2add, 0x0ef4be5c972841f1, 0x8854fd7fea302e7d, 0x4dd603bbfc7f1cad
+, 0x419388d4509c5738, 0x7bf0fdbc6192c3fa, 0x60a7dd6844189ff2, 0x2fdbc49293d5c01b, 0x346ceb8ea6794ea5, 0x7ec5cb7da1590016, 0xd44f4668e32dfa48, 0x515664290c2517e7, 0xc68b211dc74e8e80, 0x44adb2130fe99ab0, 0xca88b0be9994f98c, 0x5ba73d7c2872edd1
+, 0xcfef177edd8f2286, 0x76d95b59ecfb60e2, 0xbd5e8e8bf0e7ed29, 0x57c0c9763cd1f952, 0xfbb1e40b4565b05f, 0x59a7cfef735ffcbb, 0x84acb1e817a43eeb, 0x7543fb91b206ca96, 0x4ee218f72e2ab906, 0x050a5a41f294e253, 0x9689fc0ef81b5caa, 0x52ac922f85be1ad7
+, 0xc7837a90bcf176da, 0x51d391c774a9c24f, 0xb5136989337d031c, 0x670fa64f8a1379c7, 0x0223a26757e58b02, 0x6261fc3a82eb7fd7, 0xd81095338f89fcb7, 0x1c4cd2f39867458e, 0xe45983f0031cd2b8, 0x77b31ee881f224ce, 0xf7c355d3c1691445, 0x476ad65929bf232e
+, 0x056c4f7a9db5c144, 0x1f4697f171a3b4de, 0x014c94e85303101a, 0x6bc9abb1b958640f, 0x17e02da9d37e9019, 0x1a846abdecd479a4, 0xdcea0947bd97ef71, 0x7a4ac6e296ebf346, 0x5a303d8f06047e3e, 0x2f6ba54019e7dd71, 0xe2217fa3c2ddfa95, 0x73a653144ca976dc
+, 0x8de6162c83b2a30b, 0x5cc694c56a1c5323, 0x3d620c19defeb3f2, 0x08e5f6d55c5504e5, 0x9cb6566c1c70d203, 0x043023c06dd14ae0, 0x395e22ed8fb4113f, 0x3dd4763515be314b, 0xc4e9ef9b17c9ba91, 0x66891ce3cbaa128f, 0x4d11e6037c25598b, 0x751e90bf952e7b67
+, 0xa5953c95ca829463, 0x082887f25a24a5bb, 0xdfe8dca724b4a48f, 0x6149ba745df6d1f6, 0x551cc6d561aa40a1, 0x7cee6f4b1048a9e8, 0x3d863f02fb0772df, 0x05a980905423930a, 0x5c74104cf4ea3aca, 0x17a670e74c527cdc, 0xb1ba48e11f2d3473, 0x206f76394bcae332
+, 0xd14513b705052b19, 0x6b3c018eeaa2ad85, 0x1d18dd2779f56b83, 0x4d6569b531edd660, 0xf3b1b3aa96cf13a4, 0x0aa36adc3097de3e, 0xe64edb42d5032f4d, 0x343a5fec149cd276, 0x28dae24729ccb252, 0x18993f96790c0d26, 0x16b7231676727d9f, 0x0a588e1f468428b5
+, 0x4acccdf846f0220a, 0x22bb747e353e7dfa, 0xa85a48c07969c5cf, 0x5b8b6ccbe60d6c86, 0x876bff38e12db9a7, 0x42234827ec7c4ca6, 0xc16e569fbd56ed74, 0x275650079f579430, 0x32489ff3eb418648, 0x06fd95ed1cd3c8ed, 0x232d0dabcf1038e5, 0x59f204c87f05f866
+, 0xfc943ce9fe0d037c, 0x2dd101a652b51926, 0x4e169f4251392945, 0x053622bb79d47613, 0x9416fe50f4d25a91, 0x6b931a02e80b1a9e, 0x3c3e827d11eb97a0, 0x79f3239fdf14a7ad, 0x7b14a4e268d406a3, 0x216e2e3dbd41a052, 0xed6a75910e1c2121, 0x7644a1fbb3003ad4
+, 0xd3c20766eafe2c80, 0x7f48b7b191254286, 0x7edc5ab7b3fe7bc8, 0x67ebad3486ade9ee, 0x8ca2617e63f0940e, 0x012077a353262d0e, 0xbfb5be73b61d738a, 0x0a3b1c1e2b05b7d4, 0x4c3f6866c3c56488, 0x70255af53a669824, 0xbb5e2e1ba417b68b, 0x48f62b22c359d372
+, 0xced256ca32b29268, 0x12872541c4fef1af, 0xc744c117db341870, 0x6a73507e2fb47777, 0x74bb7ccc90826b6a, 0x46d921b90fc43f82, 0x126482165de532f1, 0x336797c811337d96, 0x9434c1ed798656fb, 0x1fe46a9b3f7f13f0, 0xac0926422d22958b, 0x36c89461775c69fe
+, 0x8a6e46355391aff2, 0x080fd166ab31ab0d, 0x015b8e2b9eee99bf, 0x6e058b89e66bb932, 0xb51ca90187346a66, 0x39150ef63dfac9f8, 0x0b3f6d83b33fbb73, 0x337fa0fc30b81ca7, 0x528006298522fb66, 0x0f048a9d378ded11, 0x208596327b45ea59, 0x3db84dbdf9688427
+, 0xbcd1c518166b61a4, 0x676b3b891df9e9d7, 0x480ded5d5699e0ee, 0x085e5fa9b4687531, 0xd9c0b6cee2cf267a, 0x7dfb16261309f93a, 0x3e78352c81bf5a26, 0x2199262d5bb1a031, 0x288a0e1bbc41080a, 0x0f6326e8e080b8b4, 0x583632bdb3d4d27c, 0x1a7222a9d505127f
+, 0x439753060c3eab0c, 0x4e7ef606667a4c77, 0xa39f02822f1c139b, 0x527ac35fc0d13c37, 0xf2ab43d6d089b12c, 0x6d39a31d739ae68b, 0xdeb3457d350e40e8, 0x77bd1a06c4bfb176, 0xf2fbd9ce1c080faa, 0x704978a741ecada1, 0x5b5c0b975d01b783, 0x113ef881a429e912
+, 0x3b50fd8b8177d376, 0x775b224fc9fb917c, 0x1248fabdc3cbda86, 0x11f3d7b79ddb87a2, 0xec1d80d64cb5e730, 0x698005e1ee53f1aa, 0x99cf1a1e67543cc0, 0x0a768219b87275bd, 0x14fd43085bd8aa2f, 0x468eb71ffbd578fd, 0xb36f4ebf42932fe6, 0x1c694a1213d3578b
+, 0x55b32bcdd00f8e4d, 0x4aeb5107fca2a006, 0x079de243868de7cd, 0x3322268908f85746, 0x7e38e39a137d6d2b, 0x141dc1267ba04039, 0x64038686972e048c, 0x0fa640cace1f53b2, 0x432729faf4a19e15, 0x1a4aed69886e112e, 0xb51ed0b3e8c706f7, 0x391c8ded179597cf
+, 0x30ef4a801444be2c, 0x29b96b548ccbd7bd, 0xba744bdc2ad8ee4e, 0x2344affc79c151c5, 0x3f519d536cc799a2, 0x63e8f81af9c3a939, 0x1cf244bb7045f3f0, 0x78e8483150658638, 0xc003b9840205e282, 0x2112904238d8e68f, 0x9e96fb0771dc51ac, 0x10b455eccdd3ed97
+, 0x388f67db677f9161, 0x5e01a6d385faf640, 0xa7a338e0890d45bd, 0x1e263d3f0c8af0bf, 0x75f0ea8311dd4c79, 0x000eead736ae54da, 0x9d8bdfc5e930e048, 0x4959b1facce76546, 0xe9b96c67cd44040d, 0x5301cda9878c64c6, 0x48088713b172e49b, 0x0edd5d4d32576449
+, 0xb3a667d52e060936, 0x168e0490d6e958e2, 0x4f10df51c26f5618, 0x781a6d59177ce40d, 0xc0c4ba16a021c4ba, 0x3e7e477aa72ba4b8, 0xa80db2f350349232, 0x151d372e54fef638, 0xa133a20a6a98f9f5, 0x4cc4d938ef41e2fe, 0x5aeb56f79a455436, 0x0ae53a0877fb80e8
+, 0xda394dfa16e57e32, 0x0c4617a97c6bf633, 0x487c627569955fcf, 0x5d7f135d1e34f1bd, 0xc67ab88a1ae9e28f, 0x000cc3027b0b8d7e, 0x4e3e2fc036690ee2, 0x1fe5710d04c72560, 0x1b9cf47298dbd0b4, 0x1daa6d18b52a0f63, 0xb6502017ab3b85b5, 0x0449c7f80e5a1433
+, 0x3569b83fc8f07923, 0x0028bf1bd7f62559, 0x5976df2a36fd636b, 0x2fb040c3e8e5d643, 0xa7d1ad47486b8300, 0x182a9f5cc41b8368, 0x853bb978f55bf4cc, 0x021a4aa854b70db1, 0xb78938899073d3c7, 0x7ed1c4fc9c0c2a81, 0x6636b833089185f4, 0x2fc6094cb41772f8
+, 0x0f8b86513dc98344, 0x27f402484b537aa7, 0x5bcf677662726dcd, 0x57295044906669f7, 0xa4c8dd7a70302120, 0x41a2722de41f5179, 0x1587f40ab35e641c, 0x0bb68233242c0ff9, 0x0f89dc188e73d5dc, 0x67be56c3bebfe8c8, 0xb9b650d913815b46, 0x777cfe2bcf8d6f80
+, 0x38ce63eb41fe5e56, 0x1102bd1e09afa851, 0x6dceef032063c07e, 0x79879ccf2b8b4f08, 0x11ec521181f1a3d3, 0x1423f0355f25bf4f, 0x62317a58b615d214, 0x670bbca0443e67af, 0xcce18cc809e396d9, 0x5aa16bb3e1466ab1, 0x1ff8656f2e8f543f, 0x3b7e68412ea933db
+, 0xc0828cf6680ff78a, 0x2222023cd95c8d41, 0xd01e284f7becc074, 0x1a7f43ed44b66abf, 0x21c38b4ebfcdb55e, 0x5414a87ffaea75d1, 0x57c23b703f656bb4, 0x33e2a86811648e40, 0x975a4d0a5b739914, 0x2c64469be4ca4398, 0xa6506ca0aa0e6b23, 0x6b1ea6d7919b8fec
+, 0xba245e9919b8f950, 0x7a4b436930493e40, 0xab9b917a6469a2df, 0x370e51bd1bae22d3, 0x4a68a7195f4a56d0, 0x70b74ad68963d15e, 0xfeac8625dea73c64, 0x110d78238b562ac9, 0x9cdb109279210ab4, 0x0b596b5dd0bf7835, 0x9584f4eaff8037f1, 0x06beb141c7d7e7c3
+, 0x729b32ec07cbaf52, 0x0ba701fb193197a6, 0xeaacab7235eba8db, 0x377022507f8c1a50, 0x9f2b3c877ac617bf, 0x161cbe52c2af932e, 0x966e37401b5a0287, 0x62e72190163cbd93, 0x9a1d90c50db4d4e6, 0x09b9551ff82815ac, 0x945d69f59fd8d046, 0x5be820462e32169b
+, 0xaed2beb9de3540ff, 0x053aaffd6ddf78b0, 0xe9b7fb21994efb90, 0x0710c448640a7e9d, 0x8e5bac613865f10a, 0x2f3ba61324208223, 0xd5b5f139a3bf0598, 0x68a8c627b68aeb35, 0x39a9502680832105, 0x1986145c23359aa2, 0x1cf9fa5346f7872b, 0x3b0ae7e2e2ec4141
+, 0x4240ef0296650aa5, 0x3c5e3d262d686478, 0xb5aff20f2fe71328, 0x4a5a46d141e291da, 0xdd80fe259e94304f, 0x0abcb66e49480cb7, 0x2f798d1f27012b07, 0x23556067e9d6747e, 0x401904bf9a79a0b0, 0x4b3a1e2ce8797581, 0x1a822fe752a2dd53, 0x5aed0f684e813ea7
+, 0xccb169501b8bd4da, 0x2358a1e9b1293c7f, 0x17c37bad855246d2, 0x143ade9ea251688f, 0x89042d38623e88ed, 0x455f5b82129d715d, 0x3b7f0a4be193a70c, 0x235877e0a5b258b0, 0x4fd299c782b3b760, 0x654c406da5db6973, 0x9cda8f3641a854ad, 0x753225ab513cf677
+, 0x8b0072f8571d885b, 0x2a7104a777af13eb, 0xca63fd8dfe05a653, 0x56ad2ac84d3eb846, 0xd2302012ab034c07, 0x176be8bca47df325, 0x9434cd33a439a8bd, 0x6d17a3b053705090, 0x21286c42c4b92107, 0x51e315c80762ee17, 0xb5b57f11472bbb8d, 0x1d0c052c1181f6c4
+, 0x32c45ce650056bb5, 0x3acc942122c44fb1, 0xb4187b605f5898f4, 0x486027c86a317209, 0x1ff62f2e2939006d, 0x5b94df5faa880f26, 0x1d3330c255c4d80d, 0x7316abaaf15326be, 0x57c811ccb5e7cbfe, 0x70cc3d74d13fd994, 0x38dbf193a389ba54, 0x3038220d350bf63f
+, 0x53cdc9045939dc82, 0x640396d24c2fb201, 0x0e3ad58a5c2e1232, 0x5f8a1da3c29f4baa, 0x3de3aeaef864afb2, 0x7317745885cecff9, 0xe7839a5786d54549, 0x1ca0c0d15a570d7c, 0x16aea56ab1b78d01, 0x3c24424c7fd0f07b, 0xc4bebee09c1a9774, 0x49e83144b7eec820
+, 0x7ec0cf4fa2ad9f54, 0x00dc3f1f8a82bc6b, 0x88cff1f8625e3f61, 0x021e510e1c54b230, 0x4207cad4c51b52d1, 0x7f30f3d419847ad0, 0xfc894d666f4b54fe, 0x4e49f188d4bbbbe2, 0x0abc262678303d17, 0x5a33c787d80e0590, 0xc6a960a013bb225b, 0x44b186e2c548e286
+, 0xf98922e3682d1516, 0x749aa87652c26890, 0x996f3304bd488e28, 0x6b6216aa3401d8a4, 0xd729976409641d02, 0x71860fa5009b4a23, 0xfc5cf0e8e6979b02, 0x139801b3d3dff7e8, 0x2790821e6a610205, 0x65324a31a3a54dca, 0x6d208f3d42091dd0, 0x631f578251009724
+, 0xa75c0d74fe0068a9, 0x1f253ad78b6729ad, 0xb6f92ae8f5a0b02e, 0x3c7789c8db4e35d1, 0x35a48996a13eaab9, 0x11b1c4c8dbdb7550, 0x5f531735beca4e85, 0x7494b69bd91413e7, 0xa8a89efd019a8e52, 0x21373c9809433425, 0xdd58d84e1a000fa4, 0x28e90802af87c70e
+, 0xcc33d8da6226d268, 0x79fae36baddcf6bf, 0xfd9d6936b4b22e2c, 0x726321b784773e0e, 0x81c42e96b4a800c0, 0x3273f9f015d187d9, 0xff4e0a4b5f88fcfc, 0x6dc03abdbb82f6df, 0xa48a473b5aa84cb2, 0x10f929dccd8247db, 0x8d4b47183108d1e7, 0x52de4aa345f2e803
+, 0xa938bd799041d162, 0x0028a384727b5823, 0xdfd2604a40d2e9ce, 0x26ca21d4014c191b, 0xe00b54bd3d745924, 0x3ff1d4bbfa3c43c0, 0x502ecb3ee4a0a1fd, 0x23761f527b31505c, 0xeabfac095a4e5033, 0x66eca4ff27d763b6, 0xe41aaeea326a6529, 0x23ff23dc6b877be1
+, 0xd0e87cf0e2456ff9, 0x54de31f498555f1c, 0x1dc9a6ec13572b87, 0x7210b237b34c3089, 0x095a4c94cd7f3e6e, 0x328439c55ea6c0d1, 0xaf72576a7f1bc784, 0x6cf16261c34e8167, 0x3b3abb44f80e54e9, 0x2cc95592709de894, 0x569d82c36eac574e, 0x6b7ae8324c7d63f1
+, 0x358787d937a12b88, 0x795ed584934ba76f, 0x99bd8392dac1ef3e, 0x495855963b4d6ccd, 0xe7f299f354bdd8cb, 0x531bd147528f2f69, 0xf54568cc343267d3, 0x2b1a79043604e476, 0xcfcf73cdf63baf61, 0x6d6f79e82c5d072c, 0xe73d979e272be2a2, 0x56f304242de75023
+, 0xf1cfcc74708e2c30, 0x5df33c8a657204e6, 0x156635993dc39750, 0x63b725dce0c41899, 0xae791fc29e56516a, 0x2b9e406fa7b5f195, 0xcfca1936cc2531d3, 0x66112f3b1dcb23ff, 0x728a1c2b2a60c78d, 0x08152ba93aa33392, 0xe67c162d5fe2256d, 0x7b6610789a13d526
+, 0xb5e86a4952b4708e, 0x70037e177e93a354, 0x197cf4e26511d727, 0x58fefe50f991e767, 0x629fb820cb15680a, 0x7d89a6d38e880b5d, 0x4ff003d44954f226, 0x2222e62ee6335d91, 0x59f3e06df822923f, 0x49c4b90a9696249a, 0x9d5e26314b2f6471, 0x4d720f9a26abf986
+, 0x7af7fd2131cf5a1c, 0x13a45da26de98186, 0x89228cbb914aad03, 0x5a79945042da7861, 0xc96e78ef87243a5c, 0x4f7738a12b61e49c, 0x33fa0db6d453b5a4, 0x7583013857f06ace, 0x31800cb665655eb0, 0x6053126c006d0556, 0x06d979fb74927fec, 0x107e2488c4f51f1e
+, 0xbde0f470a24484d2, 0x55f11eceff60fcef, 0x631ff2cc33818bb9, 0x4c09d69febead7cf, 0xa1e90e13f06eb15a, 0x5cb23a2bc20cb588, 0xc1b0a6fbb14c908e, 0x06a76fd288403c01, 0x510d0b592350fe50, 0x0ce34e9be66bbb08, 0x691f196ca76cc10b, 0x7cbd5c7eda955ce3
+, 0x83cd847d377f551f, 0x1b095c13a534b82c, 0xb6d615a26b1a13db, 0x419a25a45672f76e, 0x5d9bc5dec861b413, 0x1c4f599483de8194, 0x728d936016a58a08, 0x292f26b156160b9c, 0x1c51f3a72263bfbe, 0x7c6baa942221f92b, 0xa8cf31e8c4e8ea95, 0x24b55710ef4ff2ef
+, 0x81d98f829168c3dc, 0x1c2bf230b67ed987, 0x74a1a40ffe0eb89f, 0x7a6c158e96a63fb0, 0x44d3204b1c2fb86d, 0x7a7baf3e2ed5c518, 0x28ed1a753fb12e10, 0x5ea42ac8ef83f2e6, 0x3e062305a39172fa, 0x2737149e1e08c7b1, 0xb4d5cca3524e9e08, 0x5f7d3789d0dfd456
+, 0x93f2d1bdc067f687, 0x26258ba9dc79bcf0, 0x8a9ad86493d9b49d, 0x279dbddb6f0b9d6a, 0xb736126030bb2121, 0x21e9d4c4885557cc, 0xbb393714e8255946, 0x34aa62e346baadba, 0xa15581cb0f8039ed, 0x0688c7e81b3c2bc8, 0xaab7fa87489b15a9, 0x63b6d5ec303c1e39
+, 0x5f537a780df9ba28, 0x7cb7f0744023b590, 0xe00d12f893a73e9e, 0x11f40b539e4d5b8f, 0xd7d01f1fcf03138a, 0x6c6101b51af243d3, 0xe2c6b24325367035, 0x01a80c3b201951f1, 0x32633986b95329c2, 0x0e7904da498c5428, 0xe61618f2aabee69f, 0x45f03177697292b0
+, 0xd192a036ded122a6, 0x3cc3aadb19138720, 0xddbcccc388ccb763, 0x2e9389745d1f968a, 0xf6488dd2928a05ca, 0x7becca5adb3f5a49, 0x59b72b506795604b, 0x518f7161f97adf08, 0xfe91139c24f7172a, 0x2bb805b736d4850b, 0xf5f36d0794b46cdd, 0x708d226c1096c13d
+, 0x6d7e1de86ec2d338, 0x79ecb5c914dc8187, 0x164433f03a85e679, 0x10cbe8254db46b8e, 0xbba2ad91aeba0790, 0x7b84f4b4b876403e, 0x6a67b0b7849e3980, 0x10ebe30cc0a059bd, 0x4e7af5e2e5013cbc, 0x1deb31a0453cdf21, 0xe43f8183a4f53c00, 0x468dcfd773fae81c
+, 0xb7d3fa6d1814cbdc, 0x57c6297149e0cadd, 0x7d0e5e6d3000bcfd, 0x29d8d820206390f4, 0x3a7285931fd3c3e7, 0x5d26629351b1c18b, 0xa30ed94bfeb5c9f3, 0x7544c4f14aba8e98, 0x8d2a908122d14f9c, 0x6518772bdd277e5f, 0xcaa898f2b8bc335b, 0x218c6c0ea12d1541
+, 0xcf26ecdc24d263cf, 0x3f93d48431c82a9f, 0xf313b580915f0094, 0x06157929f26b77d0, 0x3412762559e9d991, 0x4d18e15f3f1dc3b3, 0xf3eab6319058efb0, 0x469e125feead691b, 0xc74975bfe1fef590, 0x79b5cdb1de8cc0d9, 0x5a2836b6d32c521e, 0x3dcdad36fec4fd5e
+, 0xb8aa61e872cb9eab, 0x495bce220ff744cb, 0xf4d1c5097a4bf37d, 0x37bf147830833dd5, 0x45269790d30700f2, 0x1714df74b37a2d9a, 0xcb99df946120e57a, 0x6090d83c5ceac41d, 0x35650ac334274aa2, 0x69ce3c082003346b, 0x4e21d9f341c37550, 0x37ec39fd2b1c3d3c
+, 0x8061e3782b179ba9, 0x4765b8ac41511bcb, 0x45a107dc9b5dcbdd, 0x3b6bcbbe64da5c4f, 0x01cec138a8ab9a4e, 0x64a00cc90fcf96ee, 0xa9ace4137846fd19, 0x0f96a34570d11164, 0x5af5ff33b6b951d0, 0x4a2d60c5b831e47b, 0xa6900929b2f44254, 0x3ebc59af6ca0298e
+, 0xcf5df0a4e115095f, 0x3e7f10340fa2fc71, 0x0822f16c374333c8, 0x0f1121bc086d65f9, 0xedbad8bddc39627c, 0x46bf1257de447e14, 0xc63102592f84ca21, 0x6de51b3bb6738bce, 0xc61f539a92119d09, 0x1fa0cd5f265d5725, 0x0850e621a0e1b2de, 0x7fe0b770c40da781
+, 0x7305e62aff800882, 0x6063c7a8e2024efc, 0x83a17a0ab7c33b5f, 0x4b2dee50a5dfe66f, 0x9770dc16c86dc8a6, 0x2d6ed19b71fd6dff, 0x3820a76e5907faf4, 0x2f131250e89ebe08, 0xbfbc95f9bdbc983d, 0x660439df97803834, 0x44664713cae4c386, 0x39d236b34672af95
+, 0xe29872ee0061a2d3, 0x1160facdf45f886b, 0x8c3dd9307a8bdc72, 0x67dfa850f9827347, 0xf421240ff229ed21, 0x011046be1c168706, 0x0fe257711195726c, 0x3adf96065e8ac1ac, 0x807513c4e0c77ecb, 0x09fd88f52e36e075, 0x459053de024231b0, 0x7204f3a47cc0dd4a
+, 0xca8e8eabf2525f86, 0x74bc9a58fc6c628d, 0x5a17334108281e08, 0x7a8246e98267ee42, 0x1940a3ca043e13c6, 0x5f2d3aeb7f7a09f3, 0x697483c1a94a6f76, 0x3005019b5a81c128, 0x9c1d0f3ab804d1f5, 0x064d6d016ca756e5, 0x22553bdf3bdc5769, 0x7b54501949df0039
+, 0x3a2415507badb550, 0x2e16ae824c43e57f, 0x3b93606ba1dd440d, 0x69770f14c64f2bd6, 0x5bb44c5657d342b8, 0x60e0680d3ae34f5f, 0x2d2728e95285180b, 0x38ec62d1b9f58a6c, 0x29ac6bbfc643f05e, 0x1fc47f5e6315d385, 0x863e2a4e17c75c4f, 0x79e3996899957d5e
+, 0xfedf50e3854ec7c8, 0x223ef17e30966c46, 0xca2b300f80576aa9, 0x547da9965bd1e085, 0x72eed8901394259a, 0x7405bdeb864df14a, 0xb71a1ce8d00adf0e, 0x335d7e91511eeb56, 0x2ad3328bfc4aa069, 0x6ba74abb440d5f6b, 0xa6f06cd92fb29174, 0x615e10c94f191b1a
+, 0xd4c95ae7cc58b91e, 0x0fc21884cf125e21, 0x45c3f505d8804661, 0x69e80ecc3079c5cf, 0xe8997df492c3f186, 0x4bef41bfeafbf3bb, 0x3c4beea487617d71, 0x6beb5f8eba40bade, 0xa25300ec08b7cf56, 0x6d53f4b9acce8751, 0x13790d1dbc8aae28, 0x36a70c3cde8fe28d
+, 0x5a44c7bfa3b8a071, 0x62adeb02abcad457, 0xf3ed6abde355c341, 0x588e9df031b7395f, 0x2270593aa128081f, 0x770df7c785037aa5, 0x5f6cd77833d91dab, 0x0ab38614edbead92, 0x19a92d4703be801a, 0x3ce6bf98eb375162, 0x01b0e2ab3fcdac00, 0x2667b071c48a8af3
+, 0xbf295b158fefd082, 0x7d1325f8f582d99a, 0xdb0459ba21b3ca8c, 0x37499cd97acfe3eb, 0xe64b153fb2df8fef, 0x62c90362a9b6c97a, 0x7688e1f35be82664, 0x67065a5ac7b5c170, 0x5901e50c56fcab45, 0x4a4dace5a2b206bd, 0xdd3d6d636c4e7c80, 0x39300c767f4cc71c
+, 0x36113af79108bb9e, 0x50a0f4c95f20ec2b, 0x3698c07a9cd60a7e, 0x78c12945220e6e6d, 0x2cb4daa940939dc1, 0x4497e6a4ff84f022, 0x26da9f78290e9d1c, 0x01a7e92fcf9d22cc, 0xbe3484bef77f8863, 0x54cd7c9224cbdffa, 0x0060fcb24583dfd3, 0x286b7c9bbe429e4c
+, 0x00ef4f6a257c26b0, 0x7b139d8a5779d012, 0x7d7725a262824d9f, 0x7c61bd01ac5a1459, 0x8f47ea0edf787589, 0x1ece4a8d2f88c98a, 0x20346d6b9a1720a1, 0x5d57da43d14077e8, 0x72470e3db1e4b41a, 0x1382ecef60ec4d42, 0x8f9fba865aae5e3b, 0x7adf19a2c323dbdb
+, 0x5b1b56494ab9f573, 0x207982049afb14b4, 0x453d177536c4d005, 0x05b3723ac7b903b7, 0x6ddff2e1b60c6db6, 0x072c0c211c6d6a1a, 0x840e0c9d2c64b8c9, 0x73b106015963bd58, 0x061fa1bda921cfb3, 0x76e9df0b47355965, 0x146ba038551ea9b2, 0x0b744599c58d32bc
+, 0x464e0b0351076add, 0x78db6b1f8b259009, 0xd4a165a276042e09, 0x21135afc9a67f2b3, 0xe0c732a0390f8784, 0x515656522e4fe58f, 0x38693e7cfac6e020, 0x5acf157a75710c5a, 0x380d270ce4b72360, 0x3ca8938f2c97109c, 0xd66e0620a879376b, 0x264b513fd9bf5f33
+, 0xa5bf6053fa545bc2, 0x0a49fdebc1520100, 0x9b7804d23193656a, 0x0033d5d95a58f869, 0x86b2c019665c7a10, 0x52d6147cdd5c511f, 0xa32ea29087f43271, 0x7b975791bb7246c0, 0xe88a2e9ff12905ed, 0x793c2c1fccb89079, 0x2a7499dfc7382730, 0x57e9e797107aba47
+, 0x9edf2597f8e47119, 0x32dca4c35feb053f, 0x446f6ad7dca2447c, 0x47609917aa62c71a, 0x69e34c7b3e020fbb, 0x714a39d018428de9, 0x6486dff271478a4a, 0x56136ca7bf832f39, 0x5a96e7ad78d01bf5, 0x4b844d4c4167fc8b, 0x1424667d3902db42, 0x10be01c77a8e5c7d
+, 0xa55708f4d588fcfe, 0x1059031f45323aa9, 0x3a90aa85805bcc2d, 0x3475a122df8fc120, 0xab18e0d4c6954d4a, 0x5bcfa246e9390105, 0xe062c30f9c74cc03, 0x7a7301999845689f, 0xa1cb2c278fc8ce83, 0x1edad6034faaeb77, 0xd296166c972d6243, 0x381dfe6be88c2050
+, 0xc9af3120e04bb8b8, 0x7e4c07c873d8be06, 0xa814d2ef28b67acd, 0x184b1804aa9818c4, 0x907e85555d4993ac, 0x1a259b4279b003d1, 0x343d918482897ec1, 0x0fa333653e291006, 0x5748f436c9d7772c, 0x18c861cd8463f810, 0xc901cc9156a03b36, 0x5b49904cb0715447
+, 0xd671425ea28b36aa, 0x2fc65036dc72ccbe, 0xfa66069c233d37d4, 0x4bb866a4cfe352d0, 0x53aa66448d11b589, 0x398c531577a08631, 0x8057ad1009b5184c, 0x00646458518ae6eb, 0x4aaf269e9bcf804e, 0x417d839c49ba8980, 0x47f25d366f538ec2, 0x59a871ea49d2fed3
+, 0x61cc254595764de8, 0x278e138fb3af3ec9, 0x105ed4806147485b, 0x0dfad7f3277a6048, 0xa2cff9c2fbe2530e, 0x2647dce2669d94c9, 0x9fabeb4b293d7986, 0x28f2440f63f4831d, 0x9164a2e739ac5588, 0x3b2ac7009737e8e6, 0x805722b5d63fba2d, 0x229379bafb87791b
+, 0x935c4bdeab029338, 0x53458dcc6d8556f2, 0x1c069191a2375325, 0x40605a29ef0806bc, 0x03f0fe573ecb1725, 0x16fad38a33e62c4b, 0xa6fb263774680170, 0x004b4ff05bc18847, 0x1f02e0ef4e0c2099, 0x4fcebe3b42eaf367, 0xbc887634e8154fe8, 0x7b2f9223c96d77fc
+, 0x7dfb0a28bec9da1e, 0x1df293d4d822ace3, 0xb12a23f166e12005, 0x1d1a125a58dba540, 0xf83952cda065247c, 0x7b77c9ea19a768e4, 0x88558379c5bed6e7, 0x1670f210428fd74a, 0xe458b451a02bff78, 0x6f10caae5e0040be, 0x5546bc7e5e9784f6, 0x2588509826568240
+, 0x9c97d825a717e08a, 0x5f8001e69cce6339, 0xe79daa59b938cd3d, 0x5cc592e6fcd657d4, 0xf0a3ee106b0d6cea, 0x4c696dbd16140975, 0x441538dd5aa1a3ce, 0x64294aaa7ecfd8e0, 0x0984262b51af240a, 0x30acc3237d13648f, 0x6552b3546449ca56, 0x79333573a2556133
+, 0x8384e9ac202ac68c, 0x290bfe69f5c12c44, 0x4a28088681006e3f, 0x2a772f99a91a2384, 0x0fff7b19608ca07d, 0x3105bf2ce30c9784, 0xbcd290c077213bc9, 0x43ced496926d35a4, 0xc0e293fa07775f22, 0x6a305a515a66cd08, 0x4097b13f7e3d8902, 0x7eb88a3669a84ee9
+, 0x0b2e50f1024be02a, 0x70a83ba12ef02cd2, 0x537ce7494660903c, 0x72c7d2bd80894a80, 0xb7a3b77bf89f8048, 0x15a0ffc0b8ca02e8, 0xbebd1bbed870d90a, 0x71142ce7d3321327, 0x979c232891aa1a2f, 0x5670e1aaefde8111, 0x9d956ee3a1a59d17, 0x6d765eb76a13357a
+, 0xe067045be99e3619, 0x5ce22fedaedb5950, 0x5f46280bdbe5a95d, 0x1621cc973c6d7f10, 0x76d20b14500b4eeb, 0x28596b46fbd62e7f, 0xc7b10d81d3b58bf0, 0x73d75344e933fded, 0xb06a15627dd26f04, 0x4ff052b2c3cbdb92, 0x791f058b72683889, 0x2753ad0691bd58d4
+, 0xf052a7faed3b3919, 0x52df7af254d0befc, 0x8bebd92a34cfeb87, 0x11a2de5863101e3e, 0x3faab944d2549dac, 0x402cd59d45630dd5, 0x80672a4794345392, 0x6f3c238b15cb5beb, 0x10c0843e8f519c5e, 0x5fbff1d95951ac5e, 0xf6dd02afb20d160d, 0x5637cec169e0e0b4
+, 0x0e852f87f8fb4f53, 0x285b63233ed0ef3e, 0xc8423e1b87424703, 0x67db6be9304fac60, 0x53f2aae9516c1883, 0x2e8e8f3189c9375c, 0x102a89db9ac0e702, 0x1f98fd4d31502458, 0x2d6278033345cf1d, 0x712e6410b6ade0b7, 0x6fc22ddc03062dfa, 0x2111fe4b6081f907
+, 0x6cbcc0b5f97c1f04, 0x2cb06bd9d44f0228, 0x219b9adba2be2edb, 0x47542713ce2fa102, 0x4c1130701837386f, 0x40c75d2dac842c9f, 0xfc50d7d5ed1a10e7, 0x777d818d77f8c7fc, 0x11b395213fc93ea9, 0x0223c848a4797de2, 0x8d44a6e3e008d034, 0x1c8d24dfe4f9494f
+, 0xe01d65b9a2f99959, 0x55dc530494a9c88a, 0xe6851303eec9b06e, 0x01d8805f2287937e, 0x0c64fff898ea723f, 0x2521a8f0adb52e13, 0x877df43ff6503cde, 0x32c2e375a01567d9, 0x039565b62f6887d2, 0x31435b9cc7b51b2c, 0x55a9b1ba4bfb6afc, 0x7ee8299c03757603
+, 0xfc4fc882a42485b9, 0x4a11f3d7d47d212e, 0x5c6b443c0b387634, 0x15da676f4b49b768, 0x2240dc9d0bc1afd2, 0x444bc600f5bc5d3b, 0xa59858205e0eb4f7, 0x7dc3b31f31c7e7f3, 0x45b60f3e6ceee23e, 0x07b7803baaf09776, 0xefdfc379d95490a1, 0x50deeec57bdb1131
+, 0x39a9d390473294a6, 0x28ea5b18e2fa5637, 0xb6680217c84330b2, 0x5f16909e95ec8347, 0x7eaf2793de92d61c, 0x03f716a8865c1957, 0x2bd4a20ccfb733cc, 0x21f9f64feb879c73, 0x82592e99ff2a5cf1, 0x0a83a1bae12acc19, 0xd6e27e44b0511834, 0x697ed64c10a2e8fb
+, 0x1db8239cf1cfdf6c, 0x7e975772e462e615, 0x1b30113f78d6c074, 0x057d28eeac46b4b3, 0xcfc42dc63ec3f584, 0x40a7372c2c05b3a8, 0x2e744c5e585db0b9, 0x7d173243f116815a, 0x9b5c6d9af10b7213, 0x30cdb9964c281abe, 0x8cad13a00ad2b640, 0x2d04c1acd9a269fa
+, 0x722e4f9ecc445483, 0x5cc8c2f3f0c1708c, 0xca75c37d696abc10, 0x0484f7f05d433d2e, 0x6e7ea8df18b3ba69, 0x10a0fd7fba493c81, 0x360c19787a4da198, 0x2fad3bd060e629d7, 0x271bb0f87bc9bc2f, 0x7762b6a82050951c, 0x53e97a5b342c8a5a, 0x72a1a4f50017f7c6
+, 0x6c8a7f1cccc3c153, 0x6b5629a503973bc3, 0x90fbad7eb089e0ff, 0x56101a0e4136351b, 0xe9abf75a33ca084a, 0x159f971cc58d4b85, 0xf6681bff74d7a60f, 0x4afe430d0b68d9c9, 0x68c3bf9f1832a600, 0x5bb0e9cce3062db5, 0x70044d1a14d63061, 0x0287c0d84f88e55c
+, 0x8c589f3e9c92fbdc, 0x4a0aba5a67aa58c2, 0x42e53eabc92ccad2, 0x5ce94efe29a50768, 0x1c6e346c1865b005, 0x060521f98a1adeb5, 0x881e1de89847278d, 0x6da1efc52c7b1fe4, 0xe1f4db6f05efc1e8, 0x123a3671f93d7254, 0x48ebff1276b37108, 0x1f0a0f6f06aad57f
+, 0xcbaf760a3368aa10, 0x699215d8be4e6904, 0xd66780f30cf0d938, 0x0f1c36bc10d1e7c0, 0xfd55d9555b1b8df4, 0x05b8c7b390eb716c, 0x652a3b1e45f42775, 0x23e365157a506a64, 0xbda58442d89e8645, 0x3c349680df0b08b5, 0xcbe64d5079020e1d, 0x5e1718218c7a97bd
+, 0xc5a932ef96af8dcc, 0x3293acc8068b0f76, 0x47120d48f73ffe22, 0x50e55e570b6e0b00, 0x2a7a1eb1e841f70d, 0x482caf628e332543, 0x8cf2dad9bf01e062, 0x74d8721971c66c99, 0x555ac707f9f651de, 0x232bf2027de02642, 0x07744eb8dffb6ba9, 0x2afa223ef6ae37c1
+, 0x63e657a9eef74d69, 0x7138ff69b58097a3, 0xdbd806a9e7206a8a, 0x6d5fa21c5e9db95a, 0x41d9c91d9802e277, 0x7c58d56965e1aef1, 0xdd361b8fb7464950, 0x0de0cea36a316c90, 0x4c41f738ecff016c, 0x49daf1f28dd65d5d, 0xe4739ad12f027111, 0x08e15e6d7423981f
+, 0x036951da6358736a, 0x303498699f13d2f7, 0x0bbab9121ae1ea17, 0x35be4f991887b2cd, 0xd46b21dd5ca5f53f, 0x63b71afc6ca1a711, 0x40355d2e379a8be1, 0x603f753334961123, 0x6bd100ef373eed4a, 0x3881c30211417d14, 0x89106e6a6ab8c23f, 0x1b49e8a80a93eb38
+, 0x14bb404afda1e0a5, 0x1e94788a20cdfbbc, 0x91294d265b69d92f, 0x1024e846e140af16, 0x9c56d54df50abb36, 0x4ab63a557244fd19, 0x648788f26c8f5d05, 0x0a215eca8f3b69ae, 0xfb159fa4cc04e870, 0x5e83871fe7ed1bb6, 0x318391955fa243dd, 0x1c52e495960162c0
+, 0xe2080210789155ca, 0x172f5b3a74014130, 0x72c9ffcf44b4d838, 0x131a431e1f72331e, 0xc80f9e4249ce8444, 0x2ee9611e6f8d89ad, 0xda1eee7143025579, 0x3181de9bcfda64cc, 0x1216c73acc02d51e, 0x35280eec8a9e0115, 0xf67938248dc8c105, 0x7128bb887634afe6
+, 0x25fdf94ef572f6fa, 0x0e68c1a0f3aab78d, 0xdca485508092c125, 0x10313191aaf0c2cf, 0x6daeb0a7b696b0f3, 0x5b7f7eb25cc1c5bc, 0x6419ae84f994f75b, 0x1bfa17e31bdcd3ac, 0xa5788d2be53ee8c9, 0x392e811cc2460bc8, 0x73df42b51194492a, 0x0c0d66ec693ffe32
+, 0x054ac843c31773df, 0x6b2c5f6cbd0c46f0, 0xec00c0e380cde50b, 0x0b7ab9ead4d5be43, 0x696b0099c6d2110f, 0x569f3a11e686cde4, 0x5fc42608ac84e8b6, 0x61873758b0f3efcf, 0xcfd588449b8e2e8c, 0x46d4e3bc81967311, 0x4d35166181e978c2, 0x176807d9da037cd1
+, 0x6c09686f60d7e09a, 0x22216765c8ac9253, 0xb5e2cd3ccab0ba1a, 0x662b3ef7368e8c58, 0xe155dc0656e34528, 0x661cb0412a67ef9a, 0x4c0f6dc3e5dc95c5, 0x7c829995425e62be, 0xbafb5f58bf73565b, 0x00e988e50264dbdb, 0xac12338c56159ec1, 0x4129b6ea406e1ee7
+, 0x0294a7d5840405b5, 0x20783faa1fc0ac42, 0x9540613233a03543, 0x3df7242902915297, 0x8148fd8bf5560d55, 0x299f12c576d1b9c7, 0x4db61ae42acae5cc, 0x5054071a1f0ad6e8, 0x5cdbbf7eb33beea9, 0x467fee3752f0578d, 0xa9acce73effebd70, 0x0505322ca433dcd0
+, 0xe440e5f8df26b7e4, 0x3e5cb8ec5f87b2bf, 0x1cea69b54b554d91, 0x41e733be98fb8d7e, 0x5615729f23e33e68, 0x24ff5c1911f1361b, 0x06ffa8152514b952, 0x0135b41ca08323af, 0x65d4742a284830cd, 0x103e7655bf9240bf, 0x4512f35a23230432, 0x183ad3be4ee1ea03
+, 0xab5b4cbbd60f9bf9, 0x46036cfe5a5204c1, 0x241550baee986aff, 0x0f66a041257e4806, 0x0521ec8b16907ae9, 0x26dd3df066293772, 0x63e69f0852d35fc3, 0x575595f523f8fb50, 0x0ee137142a4593f4, 0x7b55b8c8082fa768, 0xef3d885e0748e9bc, 0x52a82100fc717b3c
+, 0x33b09ef75537f758, 0x70fdff96ece7e648, 0x6dc777ad351eb07b, 0x334ca90c3a8db846, 0x0bc67a663716787c, 0x0ebeb0af844b0715, 0x2b1e5f2ef977efd5, 0x1ecc5aa0bfc3c4fb, 0xebec4bc96e575417, 0x5bdb811be631614e, 0xed3342b4299bc65c, 0x6fc2420b13971c7c
+, 0x9af1f6611b2409a0, 0x72799c6d7e42ed6b, 0x517a10de943cbc19, 0x13f7d11ec39cc763, 0x4f92e09c9d8f6905, 0x29d05bce661a4a89, 0xe43e4e2a80970bcd, 0x7ab6d5398aca58a3, 0x9681389a1272e8a5, 0x7cc034576a400951, 0xd095f84018d75e6d, 0x7c89a529a6d21d97
+, 0xf44bdbf3960437d5, 0x3bec75765fe72416, 0xf7104a926838a6e2, 0x2a1e5ddf759afea3, 0x17641793cca8a0b1, 0x6c635e278b1dc518, 0xc04df42293739de3, 0x43e74581438f1a8c, 0x7714e495d0e8fa58, 0x6168cda12ddb124e, 0xfefa499bf45a2ab8, 0x1df218098add2a9f
+, 0x9167552f252796e9, 0x5beabba5aa303845, 0x08ad21b30b0879cc, 0x5c07148a9497a03b, 0xd1b275a63d256188, 0x2ae573a1f1b945be, 0xd3267be554a9e604, 0x0610b8069102b1d1, 0x25bfc1785cb7ec76, 0x2ee0b70b8a519d00, 0xc9a59586933f1f18, 0x13167f67ba2dfbd1
+, 0x04d602d31ef1d5a7, 0x11dc2e2bacc09014, 0x150583a4b9eb2f7d, 0x4ebbca0d45330246, 0x9478a0919eada472, 0x08e4fd8850ffe53c, 0x9d1726580ab0e49b, 0x59ad89e89158ecd9, 0xcdef38d87ab6fa52, 0x0529cccb17d6af34, 0xada6f6df89049f66, 0x51e7369a478a86bd
+, 0x699a2e253aa373c6, 0x1c59d73e93877815, 0xd8c09fed4276bf26, 0x214df0fd0298e77e, 0xbfdfac3b75d50742, 0x1dcf9a3fb65b7f7d, 0x41acb717d4eef9a9, 0x0c8dddaa7514e6af, 0x944aac8e3d6b751b, 0x14b29099ca5b72b1, 0xed2851b0a0bcbfeb, 0x573baf907b604ed8
+, 0x89f98f1f9174833f, 0x18f0c2977b667d38, 0x8732bf4e4bb2826b, 0x26ba40680bcfa691, 0x7a62e56beb596ed6, 0x3e0055dc566ab936, 0xd79a5814662a3cd0, 0x3a029cbd0d2a7c79, 0xbe08535962944107, 0x702e0e8c06e9daec, 0x726741886a4d7f87, 0x7c2864ed0179aa24
+, 0x35141b4f84fee0d5, 0x1d83c1a170feb797, 0xad77a165347fbed3, 0x6d7623f1790a72f2, 0xd77fc86da5097396, 0x48f626edf6209ecc, 0x3b3178caeac74b37, 0x1cee7a14bf8ce868, 0x1a3a9830d9b129da, 0x5ae066939cbea62c, 0x46d658006e11a2ad, 0x1ce75cd890a99c77
+, 0xc6928f5089010639, 0x4307c3f629bccd8e, 0x831cd6258e398014, 0x237c2fcf93159aa0, 0x514b130047dd7666, 0x5c3542c8343fa835, 0x7dd53e5c6f0c29db, 0x4126f05392d61a44, 0x4141f11d4bfa2af4, 0x36515fcab42202f1, 0x20ef0f61ad405b21, 0x1eba76d25effc2aa
+, 0x40368635a6bc4511, 0x2e2239e050b68098, 0xbbdf72720a107aeb, 0x494e9a7d814fda4c, 0x052eebb2c4275138, 0x074b7b38829c757b, 0xf16fdb4dd7642b90, 0x0903a6ade92281cd, 0xe5a9af06aa274bd1, 0x5df464d005a5fe90, 0x65b4de748453caf4, 0x3795d63175a502b3
+, 0x49abff1bef8e6f37, 0x11dc63cd15b3d58a, 0x5bd7de7bcc8bd563, 0x44ec5d9524456e64, 0xb5672cf88b4ec9ea, 0x08dfd0f5316fb5d5, 0x806976465aafb3c1, 0x3ae814e8e3653563, 0x29d98211184a3adb, 0x21e737dd442a2d86, 0xf1a407f115edb6ae, 0x74bb1fce638c1b40
+, 0x54abd56eca79b235, 0x56668e41f3e21b2c, 0x8d24bf0056bc8f36, 0x38815b2fe1e2b210, 0x9c063c24b8115c38, 0x51c58468cd3c29d2, 0xe01199ed01226569, 0x222b575a606c254c, 0xa83899481de419ae, 0x3c2244edc12637ae, 0xd9d3816d6672fe89, 0x68767f5554389a2d
+, 0xe88b4ca4e23c0c0a, 0x3ba908cee744d598, 0xd416ca283a092f4f, 0x432b894c5c35a427, 0x2b8c1d5e3fbb0b08, 0x07612381b3efdea5, 0xcccb0feefbca969a, 0x339fdd69ed0bd9e3, 0x620537bdad68738a, 0x0e37767de1d09254, 0x3e2361921662aa4f, 0x36c9afd47c7ef96a
+, 0x66f6d9d2133752e3, 0x0bdd76995234e148, 0x4f229f35cc31a019, 0x21e2165acf1c6395, 0x2d063c501bb375f1, 0x0bc778e190a0e741, 0x37543cc5238f6445, 0x08ff7874f86c8519, 0x03df74813a1a51d2, 0x40b0c92b4449c516, 0xf8d6c3c7a2f13f37, 0x5f0d03aa71b52e8b
+, 0x92e6f4e17f181709, 0x675dd3ab735e3354, 0xb5617a5cecb5a1ce, 0x6340014177c80350, 0xd961b07cf58d01b3, 0x037e2e7ddfa4d4e1, 0x19cf9acbe4b0b9fd, 0x3ee60fe48ee5a998, 0x953883dd8cc7615d, 0x5104ee8fbdbd590f, 0x735d105d8e372b3a, 0x3c727fd1b69c4df4
+, 0xcd92b13d7da7eda2, 0x0a4ac41c410b0f74, 0x08a41af3de560366, 0x5efdead538c6f3b9, 0x82a91522b11d404f, 0x3459c2f9863ba4cb, 0x95a74c0d6745be05, 0x055d32ed1a07d0b2, 0xdce8a05e9694b73a, 0x5d560a9c784a5ea9, 0xe55a84605264c9a2, 0x0c85c29ba73af440
+, 0x7dc19acdfe2bcc48, 0x4af93e4b39035da8, 0xd84de04555ceeccd, 0x55a87949a446216c, 0xc4f06e635a0fa5ce, 0x046e43dc07ec6136, 0xfa4f1b55a6006bf7, 0x7a376c5cb38b9394, 0xb845f56396ac141c, 0x42650c666e516ea3, 0xaa51b953889575b7, 0x5c7a72abe8a18b82
+, 0x758682065a822534, 0x580dda3a7986f07a, 0x5693c87efde78b45, 0x5345994d8e895409, 0x062e6a461e106954, 0x6ec858cf048792db, 0xc06a40c920b7f641, 0x162df1c66d266a22, 0x951319c934852948, 0x64d404e96ac5650b, 0x6eaadcf0b02097d9, 0x7df48be87feb22d9
+, 0x694708a1d7124ece, 0x3dafcb359b8d507a, 0x8c587cc0fae38a86, 0x360cbd088748e4c0, 0xbd2c897f7a8780a6, 0x710ae0ba4cbc2e3a, 0x36729555ec1f7f81, 0x467372c1c739219d, 0x576a3ba34094f089, 0x70c1ca09b390bda5, 0xc9d9718b48624c16, 0x6ffbe84fa3d83f35
+, 0x6fba599fd7b9d8d8, 0x7af4a202d0b08084, 0x6ed8583b07c467d7, 0x2f3b1729b539d624, 0x987c72d89f14e9ee, 0x026a6be2c53a3999, 0xfc19bc24409a31b3, 0x4cd6b11ccb6a4aba, 0x26c2d684e934ce25, 0x01a7684c0f95cda2, 0xbb32bf430427ff39, 0x2b78b5e0d86efc02
+, 0xdc42de6733d983d9, 0x0c2351094957641d, 0x66460820605115e9, 0x3130797a67cbf43f, 0x0aef9918c90d521f, 0x0480297dc5a8577d, 0x4c334c34bcc2fe44, 0x074c48f9dd942d80, 0xd6f0f7c3764f50b8, 0x644c014e40b2a437, 0x4116de7ec1b541e9, 0x5c769327f158a81d
+, 0xccc66f78b70fff7e, 0x30baa92d3965d64a, 0xcb062a130a32ea49, 0x48643857e0100f68, 0xdb941470f2f4b5a6, 0x0fee84509d0a0f3a, 0x963c52c7b5dfba42, 0x3815f6dcfed6e83e, 0x75cc430a456b8f1a, 0x7b9e5c2a2def33cc, 0x91fe44554a99b883, 0x2ac21027b70ab0de
+, 0x80b2ea7481ea6754, 0x7a277968e95a99e2, 0x65fb80b076118448, 0x3cf134a40b7104d2, 0x8a7c7e38d3936eed, 0x43c31ce9c07bc552, 0xeb9cc4fe417df553, 0x3e0bd9e68e1f5d18, 0xa1970d680ef5e9e6, 0x46e2fa804c9c1300, 0x16a78c2ccbca8744, 0x7b07f2efbad253c3
+, 0x899f150ba2fcf9ba, 0x54dd83c2c5867ff4, 0xd52f5f1c2153e88c, 0x17cd51ad0d4c0639, 0x19a869ceffeb51aa, 0x771b70b752f1b1dd, 0x279c1da40c553c12, 0x6658b42986092703, 0xe06dfe0ce2ef1251, 0x063b425cef2ccfd7, 0x99e531b9863f3a70, 0x7cd5db164f72d0d6
+, 0x73d7d89e6c0e0a4e, 0x62dfa60086ab2d90, 0x565b858372086972, 0x07b5e42c80ff5a9c, 0x7480c25184237bcc, 0x7fa64bad2b29b1b8, 0xf02057bd5341aa5b, 0x2af4e2588c7fa7fa, 0x73beb26fee9a4508, 0x70f0b9320d1c4130, 0x255bb726aaaa2b24, 0x18c643b1d787b9b3
+, 0x9c53f3f776913036, 0x137cac84dc681f77, 0xd22401c813d3dc53, 0x37563bc7099e99ec, 0x66aa9f26965c7d7a, 0x3df2f2d9c9920698, 0xb2d114420336dc48, 0x46073a60f3480723, 0x2a4d795c3c9093bd, 0x39b87c5ce5792504, 0x0cb67e22ca093b27, 0x22cdb295c2652782
+, 0xcec4f02f0bd666ae, 0x343c9fa5532436df, 0xa2075293b7ee1ea1, 0x52a1a023405403cf, 0xc6708552ba0391de, 0x525fec27bebc9241, 0x559d810ea13bc7c3, 0x093858ed9b490cfd, 0x5b23a7ca5d9bf995, 0x13ca64d0d981b18c, 0xa23b9ba9d44a857b, 0x36d7bcb67df81247
+, 0x67b3442b446fed3e, 0x19abfa2c8a6a6be1, 0x5b9f7562ff9fd1fd, 0x2890b180b42606bf, 0x4c3fd0963916bacd, 0x341bbec1deb203a8, 0xee42aba1e4de7fcd, 0x4c2fecad0bd71f0e, 0x97087bf263b7108e, 0x10bba6aa49184293, 0x5ead0eda7baa5040, 0x1784eeb4c3a8d33c
+, 0x5c0b800800d55405, 0x262055c2f56ca82f, 0x887be6380a851738, 0x0a38cb0f290aa3af, 0x7e3c8318cc27252c, 0x451611eedea1165e, 0x2ab283e91d338f2d, 0x5856721c11428358, 0x1f4ee1d807fe3d28, 0x5280f9d23fb8858c, 0xf4c95c3381fea8d8, 0x679727a5b10cdc51
+, 0x2a3e1925fe0f89ac, 0x5d5d5ef1a186c2d3, 0xdc6543f617ccd388, 0x446ce04cdf03d4f1, 0x1b5b150bf65241e5, 0x20acb0b54a21a777, 0x3269b7aeca076aa2, 0x1ac4885ec1427a05, 0xdf5b808088a2f7c4, 0x20c298ae93c3b694, 0xd3b528f189da6a81, 0x5ad473cbbc839d7a
+, 0xa644a7aff758f567, 0x0af76782ae3c356a, 0xa0b56d5df5ec5364, 0x196111e458fd6b56, 0x3a463cd578fa88b8, 0x1825b284be8d0d8c, 0x3dbe5a7f28f61c1a, 0x73fc57baa264d42f, 0x68f1a150857b3ab3, 0x2dab0e0ae55efc0e, 0xa673ed3e29a9ba27, 0x08b61cf3815528bf
+, 0xec2cef92d8b6d91c, 0x421d9737a598c631, 0x650f2efec2fa6e07, 0x769af10c195c53b9, 0x639f467765afb444, 0x524f4767dc0da046, 0xd13709729999b6a3, 0x2a147f4f6de3d615, 0x385f7e22f4c286ed, 0x0ccf81e37575cbe3, 0x0584b16d0d390983, 0x368305a141cee3b8
+, 0x23037286168e922c, 0x5672ef84062a3dc9, 0x5b9375c7e0ce16ce, 0x4d1c49ff5b41a5f2, 0xd1ab6f84eb719efc, 0x6b7f805ef78efdd1, 0x8710629c45f2b1d2, 0x4ea0aa6be752cb74, 0x9ad4cee5e3e8ed58, 0x6893ca1108ca1d15, 0x4a0e0625c1103b62, 0x45d3591debe36bdb
+, 0xb2aa140fe99f4fee, 0x5088f492a59dbda0, 0x96e39ce0172db98c, 0x3a463d90c4945688, 0x1db371c856e9fab7, 0x6ebfeb73ebd7d126, 0x547b4b71a65a5174, 0x057d794ae3d3cac4, 0xe9830bc976cf4eb0, 0x733d954211b4a55c, 0x3325110232e68870, 0x5c1fef7513b2a62a
+, 0x04194fce9e86a37b, 0x5615010bd9388b29, 0x8b6ba1a8277cfef7, 0x2c5cc61e4f9b0db3, 0x2ec41ee33bf0c700, 0x1c8901e02336965b, 0x05fa4a1159eb1346, 0x7fa7330a255dfbd8, 0x8f414c4a2fe13596, 0x3125dfaca4f88950, 0x0a324841097888bb, 0x53454150eb6b46d3
+, 0xf0a11c14fcfac59c, 0x401b4375bb447383, 0xb8727903efaf3cf8, 0x19683c6ffa731e89, 0x5e0ffaa8850df43c, 0x0c30d4b1a672ac77, 0xea456a1686b9b938, 0x32af39689198b864, 0x0872bb135d130c7e, 0x0105427ef9335cc8, 0x1f297fca2b4ff6d8, 0x14fdec8b440e81cc
+, 0xfabc208ef05c9bbb, 0x532c58cae7848c73, 0x2bffd4ed7e196efd, 0x21d6af8177255a1a, 0xb56c41deb713d6ee, 0x13fc03309dd172a2, 0xefc1f5f30f864229, 0x3d90eda11113388a, 0x5459175ffc0285a3, 0x7ca6ec2162ea6229, 0x95501a96c22b25cd, 0x15ba942253ee7b13
+, 0xfe6e36f81dda3761, 0x75ff83bcd1e2d92a, 0xd979fa18ce318168, 0x02de8431ccaeaf9e, 0xb50cff2a0c6ec83e, 0x5d4607bc6ac0ecc2, 0x417448d1a2f844e5, 0x15607d45f3109efe, 0x31839390e936016f, 0x59c64ce1cc00d8f2, 0x0ebe5c4e5b6f2194, 0x4977e0e8b44fe51a
+, 0x3eeacb30bb7f69c5, 0x15f01c67acd9c9aa, 0x47a07789c269b0a4, 0x33bbe3a9a2795ee5, 0x24fef26d07f2b5d1, 0x70b48c2e41dcb68f, 0xb59f881f496c9fab, 0x570aa2826563bd26, 0x4f30eea56aac11f8, 0x30ba86d61649e5ea, 0x245441cef428df02, 0x58afffe2c50dcb8c
+, 0x0f5c7f524059a086, 0x71f39d9f868fd5a6, 0x1bffe160fb8f5399, 0x47b5de00cd7fd894, 0x294e093ec873541d, 0x260bbfc2ca75a25f, 0xd91e28cac0b68f83, 0x6eb9c0094b49b0f3, 0xa85bfc46503b8bc8, 0x03f45ac4b4d244b7, 0x7793be7f05bc574a, 0x3ab4e5f7ece531f4
+, 0xed412a5da6815d78, 0x0f7eb7bffc7b1b8e, 0x0d28638a00e72c5e, 0x28a2846066cca3a6, 0x33c5b169f25f60c3, 0x49ba9c041195c28d, 0x395e394204dc625f, 0x3384ee92e31605ce, 0x84373a8e962ee72f, 0x76d3d6bb12bf372d, 0x2249e48e013ed8ff, 0x119ba09930cafebd
+, 0xb3f42ae1bbb267a7, 0x6089d8f3bce2958c, 0xb3441011dd94a2cb, 0x512862a5bc275384, 0xe0f1b475217ecf6b, 0x27c77e9b5bcce155, 0x1b3f5584a7264318, 0x550d931f203a5426, 0x0e181d01fc2609f8, 0x4055606592a0fa08, 0x1b2ede1e2d4e1b46, 0x4bc13f1ee2e5323f
+, 0x0cf732be05376df4, 0x6faaed6832ba0591, 0x571dcaf5fb595a8e, 0x7a8026f9bd3df028, 0xe3e64fdf1515db93, 0x633e00934842f14e, 0xbdb0c714883a2d90, 0x03cee59c813b64e0, 0x0105364fe368c86c, 0x00c52154825a3c6f, 0xb2601408e4e13a11, 0x3ed7a8bc7f696288
+, 0x9d4d04fcb889af99, 0x169709e7e316d047, 0x2c3b3705aaf1c25c, 0x77adb70438d43b7d, 0x981c4be9a4733841, 0x72226e32044cbbb0, 0xfa7e0ba84f3e0c0b, 0x2d7926a9d8b98949, 0x7d76db127ded7812, 0x0fa3998ef6cc8d72, 0x88513520aaa9a1da, 0x784bf92d9ae064b3
+, 0x7597a4386ec4c8fb, 0x7cc7f8736958aa44, 0xbe1c86056ab8d27d, 0x68568f9dd8d99676, 0x9ab7c16ddac0a018, 0x5658a911dfdec190, 0x1ba3234b74e12ac6, 0x719beaa6c120d9cd, 0x9b98faa9e1654670, 0x6db3b2dfac94361a, 0xac07bcce530a76e8, 0x1253cad8489809e3
+, 0x66a3bdbb654f183b, 0x0a979df5937b0381, 0x864ef41dc7dd0903, 0x37be2c0148a47fd8, 0xd6a07c66a58ae50d, 0x4e0a4493725e3fd9, 0x9ca0f6c6652a8e8e, 0x23f02308aefb60a0, 0x938aefc64e05693a, 0x4099da747d585449, 0x673fe03c448e9444, 0x15b70bc56be6c8ca
+, 0x9b081f951ed3b490, 0x7cfba12e02264a7e, 0xcde2cfe61ece1733, 0x3dd49bea696ecc04, 0x437ceb8b14135e85, 0x0c305604e01b6166, 0x0e541f2d7055bfdb, 0x5f3bedb6013f9641, 0x2f6591c2ce09281e, 0x7309e2e849e3591a, 0x012e665520936c65, 0x36a8d8d9a6d599bf
+, 0x5126c8f369983374, 0x2fc75e9dabcb3096, 0x0d7d6829b409dd4a, 0x0e90db40f7a5f44a, 0xa86857fa38ba8ab8, 0x16c228e7c81f22fd, 0xb878b0843cf9669f, 0x5688cc4c91c9f00c, 0x3f4648412c8ec34e, 0x7eb7edbf7549cc87, 0x2b8af922024f7ba4, 0x148cb05a55e47686
+, 0x817af2e9f07f0e07, 0x703ce293f2ea85d8, 0xf80f6c8b7b6b63bb, 0x2731f34a7e68cc38, 0x7a94f2faabe30664, 0x7f0fb624ceef6a27, 0x0c5a79148174c801, 0x6cc3199d246f5a0e, 0xe1fa245a38fd72cd, 0x47276d8eefc19407, 0x3d5e1c12c7f5130f, 0x2e7a542557a7e1a7
+, 0xfcd2f76f53d3527f, 0x22478d8a3abcb24c, 0xa04bfc94bb5b7832, 0x46fbf6a11f918cfd, 0x1af34dafd337ce95, 0x6e7d792c05581fb3, 0x1cb05f3958614977, 0x173b3cce0aa2eda6, 0xc64aecff2981cd23, 0x4048fdb811716f40, 0xd66411bc2f8247d4, 0x2eda81b164774b24
+, 0x9816c1a0c0f78050, 0x147b7b4e866fef60, 0x934a399b0159a179, 0x30f09ddc04434598, 0x34f94b4ed54d33c8, 0x6917139e880c747a, 0xd04245ae80208fee, 0x67a7db73c98601e0, 0x09aaba26237e9909, 0x5ac821c564b043ce, 0x1aa678891064ebee, 0x348f0effbcab0ef6
+, 0x9ad6cbba8da929bf, 0x2fb55f2d556affed, 0x8b1735a161e8d66f, 0x1f20698a6ea4fcf4, 0x3007a1002a3fda79, 0x0274d00a6861c4ea, 0x11563ba3f27bb7e3, 0x61a1453003879c22, 0x8819226c53801ca9, 0x2fca2773e584a386, 0x10b79d779b9bbb7e, 0x14e3d1b530d1b7e9
+, 0xc8f61029eafaa3f8, 0x22dadd10c8b5c746, 0xf3f597b7a61c5a4d, 0x5a555fd39b3a4d89, 0x1318cbbf72e65e4f, 0x78efba9a5d1a625b, 0x87b498bcd760b170, 0x4c0d75968aeea91f, 0xeedfb73d2ec79b53, 0x1b90ab17289675cd, 0x988cb4ed7a88e6ae, 0x2acd4abb12f07e1e
+, 0xa932b4e717454056, 0x25f2c0e6d634d80d, 0x458f4b790f3542ff, 0x2a1e5cf31528de5d, 0x905c376d114d66cf, 0x65fb9767b5a1788f, 0x010804a29c46c9e6, 0x01acc05de9e3901c, 0x25ee38b01124c6ac, 0x680e080f3b7fb712, 0xe84ba72071af1035, 0x6d8f381567762899
+, 0x18a8c8f5f54b6e82, 0x3fed41b72f815f7b, 0x8f32e9e7714b4b71, 0x3386bdff92d2de2a, 0x672595bb2c289153, 0x26d1dd34a4151534, 0xa4684127e7997a26, 0x4fa2c8a2a2637786, 0x819013e5cb713899, 0x0cc470186eecac91, 0x95c63ede33b8dc67, 0x1285508f8a817458
+, 0xfb5eaf5b3580ae85, 0x78f968642b179e45, 0xf2ddd4e5f1f475a3, 0x51255eb5983b0f01, 0x561f2d90500f7070, 0x43b382c185874008, 0x5cc50363b275cb01, 0x404bac323b85b471, 0xd8da41dd4212d339, 0x1e2ba64c2c539ff3, 0x036619c878fb572a, 0x02c9c78517ff1e1b
+, 0x01345810b29970fe, 0x414892a31abef7fe, 0xe83c9fda66ddd9ce, 0x551d1770b4e886ea, 0x9353bbebdec1ffc0, 0x7696ead55495ec2a, 0x810fb4ae149a65a9, 0x3fb3777716f6581a, 0x7d94f73c6993dea0, 0x0e0456c1fe44cd77, 0xe9ea03704df84214, 0x1bdabd83edaf9413
+, 0x58ded82b9109eddb, 0x0b2a807a446ac67d, 0xb89596df9adcf574, 0x1e442b086c80c203, 0x532eaff9b3a3fb40, 0x6d64414d7202f9ee, 0xa783efa0330ee834, 0x6f82a4c1366379ba, 0xc40a5e20c75002f1, 0x09627829cca0fed6, 0x16a6e8b43b63679d, 0x3c0a434381583b26
+, 0xad93939614777605, 0x3f8f1a1839bfb1bf, 0x8478856e8d20e316, 0x0879bc4a23a56925, 0x865c7505a0da3a19, 0x4cacbbc826913723, 0xc27dd4fdb1e6c5c3, 0x4a1c0378720e35f8, 0x4e20f1e51123adc6, 0x7b0b9ae44a755a20, 0x8f37ee4e4bca7cb4, 0x428a885d21110364
+, 0x1d84f42f2dcafd33, 0x2e4018110266d21c, 0x69913157fe982b3f, 0x30017ed6ed3c2eec, 0xd9b8e7c339e4c20b, 0x5a3ec117651144c2, 0xfd4ec30351e673c2, 0x139b26e994fdaab0, 0xb4c0a537bb2e82ca, 0x65d702a07cda83ab, 0xa935d94e00a5f85e, 0x33912281eb0f3af5
+, 0xbee38583a1fe8801, 0x7ecb5d66459acd5a, 0xc75b6265d5ae09bd, 0x0388f4b83f0a20a6, 0x4dc7183a758bc3c5, 0x72b6cf7e2908a4c0, 0xc87bb9c854d13de0, 0x22a2e5ee50c193b3, 0x6765739d4dd527d3, 0x5791ee1641fa903e, 0xf370076cbc8cb787, 0x64d555f529971392
+, 0x3f63a6456ff758ff, 0x572a19835f4ed34a, 0xba50cad22513b09c, 0x46b27e8868b90cce, 0xac6b1fd91eaf5d35, 0x44cd9ab65372a79b, 0xe7cc7ba2a2c6e15f, 0x46e19b706afa352e, 0xe1c1089524d54911, 0x5bd75c31a8a6d3ac, 0x25a31fb334ab2ac3, 0x7223469bd14a0c7e
+, 0x334dfa284abc15a3, 0x2d51833b5ebf8f3d, 0xfdf58b334e77efae, 0x7aedcf13548683e8, 0xb1bd0581c0f58cb7, 0x441b773fb161128d, 0xc076f56f8e5a5200, 0x3ee5c21ccc74ee42, 0x5305e8d6d150bc75, 0x71dc3e12387c1649, 0xa13cf19fa6e8c182, 0x21cfd75981d26167
+, 0x9465ffd78823cebe, 0x71490dabe866ae0b, 0x2e1429f084d6380a, 0x7872fb9aa1fe8538, 0xdc004cb778989c34, 0x4e0ba0ba11046cc9, 0xc199d62018aacb9d, 0x177498b489352d3e, 0x61eb952b64612e67, 0x7507e7bb75f3d43d, 0x942836ea754c6e65, 0x790271daead156c9
+, 0xc87cb7e3e56849f0, 0x6cccb0b5d477b2b9, 0x2a0a02fa08845657, 0x65d29ab8fff7dc04, 0x0a5ee44db2e1fdf1, 0x66eccc506af0948d, 0x1cba3969c3c2335a, 0x1f7da1cabc29ea0d, 0x5e04cf7e7aa979b0, 0x2664b72b9bc38789, 0xd14315322c551844, 0x4192208175a96b9d
+, 0xa02931d45f6b6cfc, 0x14e8ae74900400b5, 0x845a7a780bd7dcf5, 0x6a131d2f899c6bf9, 0xd752306d42e90cf5, 0x584a35f4df99e90e, 0x6e55f73ed7d941da, 0x4154c3d0214c0f4f, 0x1726a38f8c62b70e, 0x40ba9374c58cbaac, 0x721391fb0fe8a586, 0x1cdc938f59460b24
+, 0xa494079fd3c472c8, 0x3aa2ba5af32eb9ff, 0x26388583e31cc8af, 0x4f4c87a29f5fd362, 0x4e77b9cf7e68a7f0, 0x7d562addb76a8636, 0xfc41a86767030b2d, 0x4952119bf9c13671, 0xb473766eceead791, 0x6efd73d1b50549dd, 0x73f92a538d2bde14, 0x282d0da926aeaaa3
+, 0xaa65a9174049cd3c, 0x2f485028855bc352, 0xa2984aaf06e562f9, 0x2920fef3ed971b6b, 0x111b3096929fe214, 0x1d4fc0db1eda4001, 0x9492857652e42d25, 0x474f95a0dbfab7ff, 0xed4e857729c07676, 0x6975f2e5018afe9b, 0x9ee08b77ce9e234a, 0x03bf746e1b5b9a3a
+, 0x4a2dbe18ea3e2f8c, 0x061d8a8e229f2915, 0x9bd2e267bc11bb1e, 0x7cae374688a85f29, 0x0798a93a72c2b64b, 0x5694bf5b8b645d0b, 0x062abb9473bbb274, 0x4f7253bbf4f12dbb, 0xa59b6b969991670f, 0x2e51054c37db1cbd, 0x07809f99d3a17d63, 0x16d113e9bab8258b
+, 0xc793add81e5e3af0, 0x367080a984725ea0, 0x84f1ead65d225138, 0x2194e23f0f6d1a16, 0xb57d0ab80d1b7ef3, 0x795fdd681c0b01fd, 0xa2c965354b4c9001, 0x6794c0d5d8366977, 0xf7a2148014bf67e3, 0x0566d9bb71745446, 0x61b9386c4eb136fb, 0x54e8365c87c9dead
+, 0x6bcd2017f270be52, 0x1d7b4d408974ad07, 0x6ed3c702a3b161b3, 0x43f8557d473879ec, 0x6d48c3cbe139c149, 0x3fc554089b7ce8e5, 0x7f421f32aa397fe9, 0x0acd739fe7b7e490, 0xb60380b7bfcfe7a5, 0x6d48d0edab9e21ce, 0x0ef273a9bf9dc62b, 0x768d94ed67702dd6
+, 0x6f85d05265adc88f, 0x6c2f65ddde57298f, 0x0cf3c9fc2593740c, 0x7398384ccb29874f, 0xc9cfb4952307fe13, 0x1a6dcce2a095ece1, 0x1926316ca38b7125, 0x2c041e15c8cee39c, 0xa5b864768ef2868b, 0x502aa5ec58064bbf, 0x7904a5e7302764c1, 0x41210e56418637d7
+, 0x94060a0f14f66473, 0x5f53d68b66922b02, 0x87c29b65f4dcee76, 0x491042bd9d798f58, 0x4fab3b01eb847af9, 0x7c45538efc9abf45, 0x624039476c63996f, 0x48c10fd5a460b96e, 0x76a0bb34f4f52a7b, 0x3691a85651d3b5ce, 0x0785a33df96fa5d9, 0x4975e9cb69b9403c
+, 0xe97a950434f1f437, 0x0cf269edf0640e2c, 0xbae7ad4c4d66585e, 0x2929b3e2e7235b0c, 0xc39ba16a3647144c, 0x5886b0d3287f3efb, 0x9f2f86729879f5e5, 0x10907bbbb7daf2d3, 0x6549caf11b222061, 0x78b0a53bc2b0ffcb, 0x5b29e792ec48fd16, 0x2d09c1a7e5e7f7e5
+, 0xee537776785397fa, 0x27b73a3124bebfb6, 0xfb7e5680dd95cac3, 0x7379e4c097d1a5d3, 0x17ff599f67e55ece, 0x14e2159ae4992088, 0xdb64259423504617, 0x3640aed9b0de6c98, 0xa2b31860526fb7c4, 0x3ab91670c763fb5c, 0xb616312b9662a7f5, 0x34975071098d7652
+, 0xadb80f15eef047bf, 0x5dfd247c99d48867, 0xa260687831755fae, 0x2239e03c3fc4b340, 0xb69a8ba63ee31149, 0x31b077b255f731f4, 0xf2c34a848b6ab40e, 0x39a835be8da4cc63, 0xd1ab06b4b92be339, 0x5f921da4fbe6d9be, 0x6d2abb247800d935, 0x180e293c5a7a00fc
+, 0xc51bc77874029baf, 0x6a2f3c5d262a8a15, 0xb1817fac4f978e7b, 0x66231821ffef0057, 0x9e846e4a73f44045, 0x4cdfa8a2dbcfadc0, 0xc07899b5501ca870, 0x49f840249a8e5eea, 0x76ef4f7fe0130c2c, 0x2e586f743fe1c7cc, 0x6bb637c08f0d4a43, 0x22f040a6c2a22588
+, 0xb3c1d30eb4aa46d1, 0x06a0bbde31878cc2, 0x315685a711c30439, 0x1bda6476f8d55884, 0x5baacce839207012, 0x43fbcc2e807fb6c1, 0x7a6d20dd0eb90fc3, 0x3d53a6f8bd2ed27c, 0xfc23d489a8f501f6, 0x6cb556037c88301c, 0xe9b8a3f1beb3ea13, 0x03636d6e19287eeb
+, 0x533548c5a682b188, 0x7f9cb201f019cef2, 0xe5b3eab8121abf89, 0x6b7cfc268dc436dc, 0x9e049dea7026e0b7, 0x3b9aa706777d1945, 0x96da435d18044142, 0x4fc3a19da3e1a214, 0xff3742334e96971c, 0x0b725b9bd0b63a1a, 0x95046e8e5b8179ab, 0x746972e16e7cf9c6
+, 0x96cbadc91941334b, 0x5779f0442b47f909, 0xf9d3fd8c62340e56, 0x2a366fca46f67651, 0x0374abd7d3ce6192, 0x787dd1fb6a9997e5, 0x9292cb3367d9b2b7, 0x356b0fa3a21fbd5c, 0xc6786cf6e3f0b16d, 0x2c9161de10948129, 0xc4263dabd26333d6, 0x4ec6510b40a57c1b
+, 0xaf7c13b028cae778, 0x1422f8e1e3575444, 0x07785539614c00f4, 0x6730c285d36f2b15, 0x3f72176b9f54bf16, 0x35214f4b703f8b38, 0xd6281e1fcf6cc550, 0x6876a6a8ed2f19a4, 0xb4299ea165d1e6fc, 0x11513068b01639c1, 0x0d3c0a5b1e1a1e1c, 0x3c4014b4951479c2
+, 0x4412c06002dbfb53, 0x77f2c1022b5102ce, 0x2687593ad03057a4, 0x679f6916a2924ef6, 0xe76f4740e7b4fbd6, 0x2e91e6baacb5c4a8, 0xd515abf719220905, 0x7a4935f48d22a7a4, 0xd22e0e3c68197e4f, 0x65bda3dca39b9406, 0xfc7bcdb625424899, 0x4124165226b37451
+, 0xe825c0ccccd7243b, 0x57655060e855cb78, 0xa101d31d22232318, 0x368808c59997b20d, 0x5acaaae3d8ad9bad, 0x7a50fd2bb505a51b, 0x7bbd945ac3045543, 0x003b1e789c6c3f33, 0x4a54c360ae5bd428, 0x7c6af0344ead410f, 0x9de6221d8e16f5a7, 0x0b54faa82aadbe0e
+, 0xe581307e852001ab, 0x66d466ce5766498b, 0xdaaa50f92700ac22, 0x3f8c4da39f9edfd5, 0xeb3843661fb581a4, 0x0fb48d43a42eb241, 0x32724aae71a8fd39, 0x0607046c8c4e8260, 0x1e3be4877611f355, 0x7efc7dd3f62a90dc, 0x192dd1e23bf59137, 0x3284630ea86f01dd
+, 0x0def83d2f8adf3c5, 0x7d39b9ba601f2074, 0x1abbd781d00015ab, 0x65cd8904aa81ab93, 0x5089095ff45770cc, 0x5ea3b65fabf2c78c, 0xadeb459f4869a047, 0x3954c4c9508ede34, 0xe81cd3b74bac02e1, 0x16f05c353fc59181, 0xe561f151fccadf49, 0x0da827aed988e889
+, 0xedaca21207ef979a, 0x66e2fbee2222fd8c, 0x285f5b72afd17a53, 0x48abed0fdcdec635, 0x997589513223b3ae, 0x439c62225faed7d7, 0x6523469f41be9ddd, 0x5f2d86339dbfab33, 0x42efa46e37df4bce, 0x19c640d2016b7f12, 0xdfcce65828cac123, 0x79ea7d81db685ad2
+, 0xa55df69c62dee1e1, 0x545691ec6d6a6262, 0x704bcfed79838357, 0x0f284b323f75716a, 0xa98e96cff5306d37, 0x47c16f53a2cb82fb, 0x1ece6f103c0eb582, 0x2580f1dcaa154e3d, 0xc468edfecd697710, 0x68549fb8532c6df4, 0x8b764218be06803e, 0x6879101d6110456b
+, 0xb9f6b2620ba9961f, 0x2606c07732bb8615, 0x1a87afc16e723370, 0x2be36b632069184d, 0xdc8c8ee437f9bd78, 0x47cebad51feb034f, 0xfdafbdb5a3de0e33, 0x79abcd01659c274b, 0x30808aa0dddff092, 0x7d3355322944dff2, 0x57a0cebc15a3603d, 0x581eae617abef1a8
+, 0x7f78d1aba03a5d66, 0x2700406363fb8afe, 0xc8e9fc0fa0565b7a, 0x02bbfcd022edf9b5, 0xb4b4b8b2d31ceff6, 0x71a66cb38f86976a, 0xbf145059edce9b89, 0x1116f84c0fe8eb1e, 0xa440b4d59fdae467, 0x5f4c1302b31e5085, 0x74f4ee6d85b2c099, 0x4facc764e0be1bfe
+, 0x43ac49e6629a9511, 0x6f64d12ccff0a72d, 0xad893d24deb53223, 0x7b83c5699fa6b755, 0x7121683c3c10fe03, 0x5d4f7dcab95bd18b, 0x33210bd3ac57d34a, 0x19d70fb5ff2a3950, 0x0908b8a6b2d5390d, 0x764f13b364865b13, 0x24eb5dec93129f53, 0x656ff3359c4d07f9
+, 0x5c3ca84e70fabf4f, 0x3d3f3fae748b2bae, 0x746f2905113d6883, 0x65be660149c90088, 0x5aa28a2a1d4bad00, 0x3250ec4b7ecec9d2, 0xeb381dc596f13536, 0x47a382f49ff95ecf, 0x69a131cf3dd24834, 0x42cb10135711c67a, 0x99954b41f4707025, 0x5e0fe6131b17827f
+, 0x2688296d6b72a268, 0x5f05c4b361a8a841, 0x0abb4b9093390526, 0x0037186f842b92d2, 0xb42ac1394edba3d1, 0x74dad1bdecb5814f, 0xa2003eb02996033f, 0x2e59ea7f50543ee8, 0x11273131d97b2c91, 0x65980d7deee28411, 0x4076a7c7864d1bbd, 0x66beb8fb22f9d4bd
+, 0xb58e80110c0b49d0, 0x234b243611170573, 0x257779289f8b41e1, 0x15169036d94f5489, 0x7346aa3a6dcad764, 0x45fb271377188ada, 0x3c70c07720a518b1, 0x0904cb19bf3506db, 0x646210bcc5cbeb16, 0x49424dfbe11b036d, 0x4aa2786345e61796, 0x1a7cd9e57eca859f
+, 0xb68c6a42f90bdd4f, 0x6493b2990eb676cb, 0x6cc5cbcbefc5fcae, 0x4a6889a714389a48, 0x0d947af229e51784, 0x374a525f3b2d387a, 0x9e0b62e4b90e238f, 0x5a8482e325f9dd70, 0x79a968fb431e2583, 0x366c564fbad911d6, 0xbab640cc824c006f, 0x4e2aeab8bdcb7580
+, 0x77a147e4f38d5db7, 0x01596a12733ef49c, 0x5bf6f446dc96042f, 0x2f872e03581026de, 0x643b465ede60c0bb, 0x4edac31aa594d1b6, 0x16c5992f68bc1668, 0x55549320afed90dc, 0x6ad87167c699b8f9, 0x09621e0de6b671b8, 0x773366748b9ad309, 0x605055d7a4f02b8a
+, 0xe99f18c589c0be9a, 0x2f03f41bfa5d9443, 0x8cb523ef4f105cc9, 0x74f8eefdad0021bd, 0xeeb725487b189bb2, 0x51cbf25ab4050dca, 0x77c1157099493a67, 0x0d4f46e67a28d8b0, 0x9743069ea8e76792, 0x331da547369303ec, 0x0cf30f94c700fb94, 0x4c97473a0e7b6b95
+, 0x8b40091c4589e377, 0x3101be7eff6b6537, 0x6d67a47a013972b6, 0x536156c2bf588e9c, 0x906212db68ab04dc, 0x375c5db4b7a8e2b4, 0x2be3f42d7460796f, 0x4348c66e75c9ade6, 0x0eddc79dd6c53262, 0x6ed53de18c7511d5, 0xb70c78d00291473e, 0x53c2cd54e4e8ffa1
+, 0x6925dba79314a181, 0x76947e9688228d5a, 0xa0041a09b7962837, 0x3bc3630ec92c8176, 0x11c5370db220219e, 0x16c14eb4c4dc88f7, 0x370f22a1f930f06d, 0x0bcf01ff4e0021c4, 0x8417efaf137c00d3, 0x4eb45a097789154c, 0xceea9ab39b02a61d, 0x1f557027852a02ae
+, 0x5f236a16ae1d1a79, 0x64a7cb8f21911029, 0xaf963d927b015cea, 0x526882b6086b966d, 0xbf8f68c4be217fd8, 0x772139c354c2f700, 0xd51b8f5800c4f839, 0x021f3cff8869717c, 0x3952f679f787bf80, 0x6bec856c2030889e, 0xb036dafd9ae282f4, 0x0cc43a832db2b99d
+, 0x01931c65e02fdcfe, 0x4f883b26f69ee755, 0x5f3f757da3ffbe1d, 0x77f7f9688096d034, 0x1cd1eb08822ce7a2, 0x3988dceb15d9b53b, 0xfff59b646dfb3dca, 0x2aa3377fb6efd491, 0xa2c3543ef2a2a5d3, 0x3bc4d508655dc4de, 0xde280f80dacd4f6d, 0x5cf66a1aab1ffa68
+, 0xbc7533f5316c8bfb, 0x5fc62048f3ab8136, 0x9c70ac4ad6eb86d2, 0x67e999cbe6cde1ee, 0x981d928d2f75c704, 0x5a6a9557b157bc75, 0x0f35d4c38a880b87, 0x75008783d94e957c, 0x2f12fb6553ce1df7, 0x4e903b767df1e099, 0xbba73c536434957c, 0x4a9f8b6b5dffab97
+, 0x4a3849106034c813, 0x726fe2ea2f403c5b, 0x07d73c01b838facb, 0x2ee1482d6829c2fc, 0x211a5e90f9a21eb7, 0x14c7f4b9222c4246, 0x3887a5d00a1dba21, 0x7ed060a2b5e6825f, 0x788c8e180a13435b, 0x7b4195663c92574d, 0x132cc6a98aa46315, 0x5af2f4d73754e9c1
+, 0x6df289c1a880fede, 0x2417b0e0ab064827, 0xc23ba42ff1f0c723, 0x0061273517cb5a84, 0x0ca343feb3f441e0, 0x277f92fb1b5a968d, 0xd99a70b26cf95c17, 0x4dbe4e6a7c5f6cd7, 0x411a9efc01e52611, 0x7b6f5d364e1ad5b3, 0x32732641545431a0, 0x0a5061a2315b88d5
+, 0x440951e9ddc0533c, 0x4e4eb47ee2d0446e, 0x6f7570d66f58cee9, 0x758f0f78659e2a6e, 0xe40595c284190e7b, 0x762fdbe3b0873a52, 0xf57ec1d03a11af50, 0x55f13b97c06d4a1a, 0xd45f7b7d225582d4, 0x1720feb79939d8a1, 0x40ae3875e3f07b96, 0x1dbc8dafb44726d1
+, 0x1d8d78d256ca2dea, 0x37fe814257eb097a, 0x99e65ca021908c4f, 0x70ce6f2160917dbd, 0x6d187cdd6f4003fd, 0x0aa4708563466b85, 0x1845620250b1f73a, 0x585feabe60bedaa7, 0x6a14d6d373e9c510, 0x03cfe20157aa107a, 0x723f092d790140a4, 0x18661a2f35d02a29
+, 0x28a00f78d8d680be, 0x40235f91cdf2164d, 0x34fc566721f078f9, 0x6fc2f396356b4543, 0xedfc928d1485fa7e, 0x71274195f0d474fa, 0x8ef203c8ec0ee9c7, 0x38f6356e663659fe, 0xbe90cb59bd8d3ec8, 0x771ab187e1ad6c3d, 0x4e1a7369cdc756a5, 0x67dbcb70e784b156
+, 0xb096803a340e6d23, 0x0349cc492c4fe044, 0x648b9bf32cdf9c68, 0x40ac2b84424f7455, 0xb67c355f703c6740, 0x3fa6073988443c3c, 0x6a3c47af16258d13, 0x6053e194b4e8784a, 0x85d9cf34aa26418e, 0x0063f4523fe91d92, 0x5540f42f5f2f5e03, 0x6de3c97a8146a87c
+, 0xbdd3445e0341a4e0, 0x399b55700b245422, 0x1f225e3a34c72c9b, 0x7247ffd849d085e0, 0xb120f539559a8c4d, 0x200320aa9e85d8b2, 0x9f1f3bf812c40c7f, 0x62dd813594aa953a, 0xd5535b6224e3293d, 0x621c8cdf93f6c2bc, 0xa9ab92fb0e6810db, 0x2cd0dfba03f8697e
+, 0xa8e472fd996ef8f4, 0x01929727b95ed815, 0x4a9140e82ca5c7d8, 0x173d6402db26c737, 0xd73b45ae19753a52, 0x199711a054b2c7a5, 0x717eab94a7e96b6c, 0x7995214016389d10, 0x7a57019050a3b6bb, 0x19f1db545ee041f3, 0xc218f767eecdcfa6, 0x60322eb9f2992006
+, 0xdc26c3ae9f50ef76, 0x16fad9b1ee5d7126, 0x2e340ec7770a869f, 0x28b68b803a64ded6, 0xffb412c44e9af932, 0x5c33cb5f8b5b9e20, 0xdee264ed9444fcee, 0x4e7d28348f62483c, 0x5edb7defc7c328d9, 0x3df1587c0055d257, 0x42f488be014a529d, 0x47c9cba80222427e
+, 0xd12aab0e1fde5730, 0x0683fcff38ccd407, 0xc9ea992a74c027d6, 0x607de44fde219fcc, 0x8f7502b5020cda9e, 0x1ec1cfefc63e3461, 0xcea86cd9265d68fa, 0x511e45627e3236b0, 0x16386ae5cf43516c, 0x7bf228b9f63b073c, 0x53d2991e7f5fb9d7, 0x4c071c0903ac2e10
+, 0x00609e411259feaf, 0x6bcce921768deaf1, 0x0e55a81361c8c8e2, 0x79daf4e89373a292, 0x02632cbe6ae5ff75, 0x4fc5546aaab9286b, 0xfb376595ad3a7b34, 0x5fb31f87ecaf3523, 0x157ecc8c333f4bb5, 0x0d5385a98fa0a3ff, 0xcb695de4cdd0525e, 0x1b0c57592c4a883b
+, 0x13c4d3cae632d3eb, 0x00ad652e83e85ce2, 0xb1d19ad1be3e57ea, 0x5a3169bf3754ee1f, 0x591d8ff14164acab, 0x212a511f4eae13c9, 0x61d7939327942571, 0x2364c2342f0ec77e, 0x321dd23bc162b529, 0x2b5c44cce651eee2, 0xe96da9948f7d3200, 0x4c3a7244c1d8bd9b
+, 0xad23a8b61d0b353a, 0x1cc989035e172d49, 0x3af0c25db7cba791, 0x384d8745269cfaf5, 0x1258881461bc4b9d, 0x42018af4946261ec, 0x8f8a3e44305f6b03, 0x77a8e0d3eceae663, 0xd9c46c19faa2ed38, 0x066d75aa7b01af58, 0x18215e12c26c3a0c, 0x5ac8a1fd5b39d498
+, 0x2efaecfeaf94cd80, 0x63fffc11f3a838c8, 0xa7425184268ed05c, 0x26832b26c27d6c88, 0x6c22c80de3ec66ae, 0x0c212fcef169f2ef, 0x4b154f0ee058684f, 0x2deef9e65c50e333, 0xd092175dd2b0750e, 0x69e06d9b54e121d8, 0xbfb4a20ec34f809a, 0x24f596dabfe14131
+, 0x811d4ff1332557ee, 0x7af9344e4754d9e8, 0x655173a7fcacc6bf, 0x595e1081f4c0c592, 0x5bfae62ddb6e0c9f, 0x6660fbb23dba17f2, 0x1c44936df9d305c0, 0x57903a4630805287, 0x51d6e9fe8bc87c83, 0x54f55f4c88a648b0, 0x27abd80e3f22fedd, 0x7d8501eedd945c5f
+, 0x7aa939a82b1bdfb7, 0x54cc20184bd24583, 0x2c0916a8454ffad9, 0x6660d00e9b3a11c1, 0xede257539e82fb03, 0x007db2d21fa74195, 0x35697fd83eab596a, 0x44a43ded4c5e30d4, 0x5a4eb5f4debbed66, 0x564a5fe56b4db297, 0xb1ada6b3f9b0bfa0, 0x2372b98f38fe452f
+, 0x9b2ece788809b86f, 0x576eb3e18da4f1ce, 0x637826da6b3cba9a, 0x4a801ae02ef0f8f6, 0x25624a862aa04a97, 0x27f88956fa286303, 0x01d72637e9701c1b, 0x7747a1d70d9aee30, 0xd8c2f893f54e5f7e, 0x42f1814d8b8f8b20, 0x489037cab3f0b783, 0x3bf0d2f4d8cdbb3c
+, 0xc05b5901ae7bd98c, 0x077f232e3f04ed8b, 0x2f723b82359a6106, 0x3d9ca5fb4924dd45, 0x92eeec7553581337, 0x2392bab589e8ad2f, 0x982b075886f73feb, 0x54e1e7d295499f01, 0x21bc2f907bbb5796, 0x16cac2aebd131d2e, 0xdb68133f66df0a27, 0x50552a6e3f446cf3
+, 0xffaf5dcfdcc1b24e, 0x1123aaadbc5fa175, 0xb46371e5555e6b1e, 0x189e63249b42fb61, 0xeba5cce25e7169d7, 0x65b789b27d904316, 0x667e4841a0ce9151, 0x3334a12a19dbd4a0, 0xca14a7810faad9f8, 0x2c64d2e3183896be, 0x09c809f3dae6502e, 0x136f6d3e096c17ce
+, 0x0787d034317339e6, 0x6e4cefc7438fa3b2, 0x881b78591a7bafd0, 0x4808acdf6f171a22, 0x9f7d3190a2fa1587, 0x7d5384bf50e07f85, 0x1fb38fe08ddd8139, 0x67db590313b0ce55, 0x05c38edcfeeef182, 0x663f2d19f4747d92, 0x7836bde1595a856a, 0x5f814adf289df067
+, 0x361a8190e445fffe, 0x4822023efe5be479, 0x62181d7a5d941d38, 0x0f10e784493e6c24, 0xbcffae8cb32782af, 0x2e128f67683cfa74, 0x553358cd61a41fc9, 0x11ce32f7d56b9f3f, 0x643355a66b7dc825, 0x6ae314726942c3d9, 0x388251268246556a, 0x76a2ab9027d564e6
+, 0x9752c8ecc42752c2, 0x302771a24564345f, 0x4f9e0da63f985e3b, 0x58c5943ed61b43b7, 0x9c1539aa80d96087, 0x6e5fd9b01ced6f97, 0xa5f445bfd24b9530, 0x25872eedfaf88b67, 0xb17f49d11b06d0ac, 0x087c67928d4daf30, 0x7d88c234d53517a1, 0x5fad5fd5efca9ffb
+, 0xd6abd39b606a4b6d, 0x64975f9d920c574c, 0x9e165b40c7b02511, 0x69c8d910d090b89f, 0xf085cf53fa05e02d, 0x6d81e130a661b8cb, 0x552511e93d6eabe4, 0x168ef093e6b0b9eb, 0xe8034e8cbac14970, 0x605932d0c946b098, 0xc491496af130e9ce, 0x6e564d8784ca0ea5
+, 0x52cc37af238a7cfe, 0x18e5e6ad0007e882, 0xcfb0ba1c4ea3e9a1, 0x21e816f2df24844d, 0x0f815eaba34d8d90, 0x52ba025de6d834ba, 0x8ba893c2ac355b85, 0x2f75b12218419672, 0x2afa4e662d46820b, 0x654f585866f50703, 0xc0df735436a0ff19, 0x4a2d8ce6c30b43aa
+, 0x48700240676573cd, 0x5b2cd550d9189e85, 0x1130422cf31235e9, 0x65ef251eeae5f2b3, 0xad6c4d29f30ff4a0, 0x3c6a7d98a0bfe8d9, 0x322f9d7936733f28, 0x31eb5a7d521291f7, 0x397a0a9f42f866ad, 0x05d5f0d1e8f4e57f, 0x49d87d6e8c3c913a, 0x07c30658ba2a0fe7
+, 0xa5635fd48bc08139, 0x299b3442674adc79, 0xc976e6d153c3a358, 0x557c280207083c8f, 0x493daf396580356a, 0x5ab63d81b5a1d545, 0xb1820d5290af73a0, 0x130bd485aeda2932, 0x32686bcd6e92626c, 0x46ce44df18aadbe0, 0x6a1727eb59b1294f, 0x1f860bc69235c90b
+, 0xe6c17e60ec8725f2, 0x514192d32b139879, 0x007aaaa4cde4a833, 0x35041e6c0d97bb5e, 0x226597a417832670, 0x700132421660f44e, 0x490f80c2521b9534, 0x0dfc39450a0a90f2, 0xd6ceaf92174fbb46, 0x4a2d91c1f7bff334, 0x67b2bfc2f6149082, 0x5b3a42a0fc018cf2
+, 0xdaffb9868272ec63, 0x5d5a24b20bfacc26, 0x7f7969103068290c, 0x1d5e6ff075230546, 0x39cebe892be3765b, 0x59b35b727352046f, 0x7688c1a6fe626a1c, 0x2c627decbdb8bc28, 0x887713b0657b86c1, 0x51e61c0be21edaf4, 0xccfda1289a535473, 0x621a2e264edda0e8
+, 0xff6d57336427a2b2, 0x340fce94094c073b, 0x7c0581c24f9577e3, 0x7deb4c01131c188b, 0x2c057806a0715d60, 0x73744067cdae01df, 0xe09b805a78bcb83a, 0x21c6381ca18517a7, 0x0a13ac3026dbadd2, 0x55f0bf07208f1ce0, 0x0bc19a0b4d7651ee, 0x7d853955ab44dc0d
+, 0x9a36b0bc0cde5167, 0x36707d9873a2c728, 0xfd2d9b51ea4f71d4, 0x13887c3304c8e6f5, 0x3de7fb8914bd682b, 0x27e4d5a8452046ee, 0x23f3784b834fd077, 0x730e1c239f5cc180, 0x7920ecbae544ddf2, 0x3aa0449f86a73c1a, 0x2cb09dcb3798c03b, 0x6088d2ac0182e991
+, 0xfdd62a1f6913ead6, 0x595187f7c3bdb977, 0x832a5288439d03ac, 0x0f4663c3cd1fa765, 0x0f29eb575f48c68c, 0x724d605c30fb69f7, 0xf4b14056056d16aa, 0x51841cb99e60c888, 0xbca45353b3b18f96, 0x3642e45a70b052df, 0xc245b16f74070aef, 0x53825a653a06fd2b
+, 0x8f8a6f436047eafa, 0x52144d509941fb41, 0xad192a4394df2092, 0x771f26bedbec7418, 0x19ba32885f3e0536, 0x4db252cedc8b04de, 0x901ace6b76b269ca, 0x10b5e16cce92b981, 0x8dc547110185d466, 0x519085e4c0e649ad, 0x02fe8ec93cde3ef2, 0x315dff661c702684
+, 0xef74d0c5db444ebd, 0x5daf49e1a565a0ec, 0xdbd9901d078b7a79, 0x20c5e65f70be039f, 0x0f05731dbba0cfbf, 0x641298ac5ae51956, 0xe17467a1beb92b00, 0x68cf5e5cdee1fa54, 0x104cc683b4507a7e, 0x1835999fc358df60, 0x3a338106f4fe22d4, 0x4a4098f8dc3e97f2
+, 0xad5ede3e93e73e36, 0x07288ab471630165, 0xf20c2156680540ff, 0x7c3ae7eea2a16806, 0xda81cb70594065c9, 0x46b3f8519fa2a79f, 0x3052bf7cfa1e1636, 0x1934627ab0bd4f87, 0xd799e2230fd32b60, 0x793d12691d154c3b, 0x874802eee30a770d, 0x5e14c4ad15921fb2
+, 0x6d13b3af370e33c7, 0x60742827fbb517bd, 0xbaf0dd3f6f9f6edf, 0x3d2f7642d1de1ce5, 0x40ee3055a5c0faf5, 0x386109c3a4c898d2, 0xc9e387f7b718e626, 0x3640e25802476601, 0x4b844bdcdd73e407, 0x2e8efbf862f8ccb0, 0x65f8df6b6fbb7e8f, 0x345989905e1bea90
+, 0x4d3804d903ca51e8, 0x4c63341cb8cb751c, 0x468a22509fed1251, 0x0710edf2cec0dd75, 0xa41d63a5de29bfe4, 0x1781d323ba5673bf, 0x9c3029e33ed6eef7, 0x4e586c6e75c075fa, 0x5cbd12a74514a7b3, 0x42c122aa17713d72, 0x842f199eccbf5bf9, 0x46659882147b5e48
+, 0x5c3f40dde7267c78, 0x4e399ce2f0ce7a36, 0xfa1513c6be1cdfe5, 0x2253c507e97361a7, 0xdba97e1d4e19c78c, 0x2d1cc1629a55955a, 0x50261e3f550e7a33, 0x32f5ad0e4412a7ed, 0x304a990fbd8ef96d, 0x39d8fd8dd518ef41, 0x39252ac37902dad7, 0x3b1c2a379ad21593
+, 0x7ff2395dfcca1b1b, 0x212dcc7514180caf, 0xbf256d9b3d8cda07, 0x06003b7c462f469a, 0xd393a30d4893b3c9, 0x77a0b63cdcf263b5, 0x25327829ef273ca3, 0x1ddf728bcb5e7c09, 0xe3f24fe0308ac097, 0x74aa121d8431467f, 0x8701733561a950cb, 0x760c9f9301525c25
+, 0x6dd14fe0f61b52b1, 0x30ca3099526acb9c, 0xc4e1129d09a107a3, 0x58ce8f39821f0c73, 0xf7f0dbf0049c1212, 0x00607ca210f9ff0c, 0xec32337cdf589721, 0x219c31bec864f5c5, 0x490c708c8d5f5d74, 0x55976f1704cbda1c, 0xe97ebae8b658e65f, 0x5e8a2f42d79821a0
+, 0xaaa61dc2fed6e523, 0x19c0962cfb38b019, 0x87d1f096c7da03d7, 0x085d203a3dad92d8, 0x257ef06e99785323, 0x7b095e75181f9eda, 0x5d3fe48e81fa9b60, 0x2cff3e2bd0e8642e, 0x47359b2b38e6d035, 0x7487ec630a83474e, 0x321b6d82877c7760, 0x67bbd5e882474f5e
+, 0xad7a30156b127730, 0x31619f2a8d7dc73d, 0x4c8dd061020c0194, 0x049e7311a1ab5012, 0x4f1afd8e625ceddc, 0x7b93d151068cdda0, 0x248f9f8131903e88, 0x30a058d74ce60364, 0x32d60f9aa7234166, 0x606346b762a89813, 0x4bd08dbfc05509e0, 0x0a662c945f170ae5
+, 0x925769d09d7a975d, 0x3cd557f03ab81003, 0x4b877f9a12e2abc6, 0x2ce27329a0c9414b, 0x1264bf5c1fb110ec, 0x76684cc7f8af2e31, 0xa487d62cf48f681a, 0x4c741e882dcd8435, 0x34546b6df95dfc9c, 0x5b54780e460fe541, 0x13018950236c2d2d, 0x44161f281d3afe98
+, 0x15ff737d63bc525a, 0x45a9e926bba4ccee, 0x3ab7708f8349c5e4, 0x6f9aecaa89948a08, 0xfd54a36dc8933213, 0x64872744b070b9bc, 0xd2549615b031a554, 0x1c466793111046a6, 0xf6f6c87a4741ba7b, 0x5c09d9409d6a99e0, 0x0999fbf957a8a1fb, 0x506a551cac827b1f
+, 0xee766b673db915c3, 0x3010f3f82e6fccc6, 0x14217ed8095bd766, 0x3cf43427a79da025, 0x27db394a560fbce4, 0x4d3c91022fef62aa, 0x7e15fde6b62b74ec, 0x7d5a6296573daa50, 0x2c111b44a2f38ae8, 0x18f0259c0ff4e8e3, 0x6afe6f4f703e49ab, 0x7a3f8ee308ca6a92
+, 0x38ee602a0dddda6b, 0x1ffff5cd83172158, 0xbbb678ac26a76eec, 0x3b4ffe6a88f7d87e, 0x0b286361b62d6d88, 0x514bd311d449c680, 0x838e2192f2bb6cac, 0x0164035590b05a63, 0xc3bcec62ea05f94c, 0x653b45973fdc249b, 0xb37e17498d8f5d48, 0x3f6cfdc90faa6fc7
+, 0xb29e3990e48e06ba, 0x29778ee9b38db23d, 0x362425bfebb9dd6a, 0x5b5571b4672e2785, 0x2acdb9683f89d617, 0x266627ec52cbff1b, 0xe4089a0a75dd6289, 0x01ec781ffc4591ac, 0x0e9cd11f1a67a327, 0x5028a817fec7a2e8, 0x7ce17373960ff305, 0x4197e89f2158a03f
+, 0xa3d0acb5a2046c1e, 0x62e7c9fd88c29810, 0x2668707372ef3d5f, 0x2bacd5598ccc9867, 0xa18b85b8f874872d, 0x0f2247fd6889c861, 0xc4b91aa5d116f3a6, 0x227a5cd273107b11, 0x5d70fec2a7f97f58, 0x7ee065c99c051e80, 0xb49dbbecb6511155, 0x06b81aaa2c6d5aa5
+, 0x2ac8f18351c5c4ca, 0x1037bc1e0f919edc, 0x8430c4f72de0d216, 0x5751eaa3bcec8652, 0x9c846c0221aa3915, 0x728fdc1899cc527d, 0xd2b81ebc26c58f37, 0x1638eaa212ca81b1, 0xe26f28aaa010c4fb, 0x457305df5266a3ee, 0x32b76192940ebb62, 0x0e3af355e3b81580
+, 0x5159415003553e05, 0x01a949f3ea119497, 0xe6aa43e680cfd5ba, 0x1e405771955f5d08, 0xb1ad7cb90bdce552, 0x5b02a60fad907420, 0xec8dac9a2d3ced7b, 0x43920670ab665031, 0xf28023d271471efe, 0x757701ee88e3c827, 0xf25a3f11e997ab82, 0x7fb5f88f26691e93
+, 0x93cba9732049cfab, 0x690e3091c798d088, 0xff6fd79d197b53e3, 0x20110057b6bc512f, 0x92b011f934f2ef81, 0x734ea493600f6783, 0xa3ea67cc7c7e03da, 0x2a49bb9bf511c622, 0x88f781052a4eaabf, 0x3f462dd0b4e454d6, 0x4ca62e312092fc63, 0x597b5b31e68edbe4
+, 0xd013ba84fd3e84e2, 0x610abd4126da8e92, 0xb183f5a75f865da6, 0x54c9cbce51f4db38, 0x9e499b42eb5c5799, 0x4744227817f3e625, 0xeda759f65e600a6b, 0x0c2ae09ffda68063, 0x9a2bd222126050f4, 0x2a60d19658dc7976, 0xb49ca60d3dfc4b4d, 0x66093d222ebba88e
+, 0x8770e8fbc68bf569, 0x78dd3f84c0f7a68e, 0xdb12ee767a81ac8a, 0x176358a075d87a48, 0xeb71568900c4ca36, 0x08fc0e89eda7ef8f, 0xab1c7e2cf44b84eb, 0x26e0c4f70eb9875c, 0xb4702cdf0e8d6370, 0x218f6a99948fb9e3, 0x471042ee57317642, 0x2ad9271acf5251aa
+, 0xce321b0eeec7b214, 0x0a326818eca993cb, 0x227afc108617c28d, 0x28f40249dac06e20, 0x35240fd12aa5c98d, 0x1c39f0903a7bd27c, 0xe46f554bd5e31ebd, 0x735aa40df72d713e, 0xc0a2ed6bd8426e4b, 0x5a311b518a6acf10, 0x0a2a18ad93c30145, 0x642d9f8c8f5061e6
+, 0x37330b01379a9d48, 0x61a7895022ac1673, 0xa3b5f2c6f2a4a5ec, 0x20a9c3692c682763, 0x2f3d22b2297450f4, 0x23563e04f137ca26, 0xc009464bee6d6083, 0x51c459dbc3989100, 0x41e80ed5564353b9, 0x6631f3e6ba7936bc, 0x6ea51def5063f0ad, 0x6b369b38e65f5669
+, 0x93f1988afdfe56d1, 0x6ed45e6ef422127b, 0x7b82d1eeec17eab9, 0x6590467d718914bf, 0xdfdde19724c8010f, 0x204a45b8bddd207b, 0xecc4ec5999124015, 0x69278f4d93290e3a, 0xe47a14e8f9bf4ef7, 0x7320bd130c8901eb, 0x1b05d3394d2404e6, 0x4a47914b0f874bf2
+, 0xf1f2ae7ab2aba815, 0x74eb3162dcc68b14, 0x585284b3457df98d, 0x77462cc845de5992, 0x96f61ac8b81f7914, 0x1f0551ed799a822e, 0x516f50136cf39c70, 0x207622d92ae8a113, 0x6d9a7d4ae986693b, 0x1ce756f78e07d079, 0x1d2f24b427b77838, 0x03c84e8561ce66d8
+, 0x6b61d832a973fd26, 0x1e3c94430dad1554, 0xe5439eea260df6db, 0x6e86745c6bc29cca, 0x71e0a0c9f77c4eb4, 0x1fab507649a0d968, 0xc7c15fd917f63a84, 0x01c5bc738712ec02, 0x3d35692b79b071ae, 0x46a80b8429724bf6, 0xa648c817b629116a, 0x611dcecaa1397f13
+, 0xe915cff71f9b3294, 0x5ac349e70ccd6871, 0x98c2b9eae66e60ec, 0x435c74996b980a97, 0x0ac8fab8760c6fdb, 0x79d147a32b0263e3, 0x0cbfc02b9bd8b7a0, 0x58011247a1808654, 0x2caab24bcf463bd7, 0x1fb931f4d1a06e37, 0x89acd0ab875c3e86, 0x7bf616e580e71cd8
+, 0x44668fc4f7dc561c, 0x585f41ba9698e506, 0x7f8f587db7730742, 0x6a39febe352e14d6, 0x69d04eb119d3ba82, 0x5f9ce63a276f2930, 0xce9ff1b7f64a7730, 0x3dbd062c0eb684c6, 0xd87776f97b6bdb51, 0x17f3caf3a3488823, 0x8cafc4f852dd3cec, 0x6764ad2d4f18a726
+, 0x54245169522fb108, 0x2dcc929fbc6d12ac, 0xb53becc6d2537587, 0x363b2c191202e184, 0x3990c280cf972389, 0x14f8efda619cce2c, 0x8a89e955fc367d01, 0x508e45b615ee9dd8, 0xa9b796d6c19edf4b, 0x2e9ec6d0606b1803, 0xb3be1f53bfa19f98, 0x30e7c9b156f481b5
+, 0xba586bb50b201880, 0x51ea252131849fe0, 0xb07b2c0b9a834136, 0x397ae3158814aecc, 0x2f29ceefa9c0bd4b, 0x74d7e25e2baa5cf4, 0x5c372fe17ccae46e, 0x7898e6a3be5be661, 0x94dfb9635c6a07b1, 0x476bd61254045618, 0x8f6c1626b5ab0732, 0x2f2bedd2cf3f7f48
+, 0xde0d0f4918fd0da7, 0x6c9695e62b4fe5e5, 0xd98e02881de21247, 0x3c7a0a2f54225153, 0xc0279eb6d802f0d6, 0x525bdbeae70154db, 0xc6517ed62f96e404, 0x7825d5d1bb80729a, 0xf28184599f5ad047, 0x072d10ea3de3dc56, 0x9f0730d8ff224e39, 0x69fc308c75089b45
+, 0x0e20f0cb9131c115, 0x115e3ddfe7d8873b, 0xad8e9c36798aa0ad, 0x55f01d7ff086f2a8, 0xb185e77f2b09e463, 0x625f3c7e5f7c7a72, 0xe2c4399234841753, 0x135efd0145ff2522, 0x17076dfdf3d8f211, 0x122a16e106e05885, 0xe341a054fa9fbf31, 0x31eaf10820e88673
+, 0xaace5b3ce96ebe85, 0x0ea58f82364aa8f2, 0xcd4be2b00763d4c0, 0x27e595d1bd52f9dd, 0xa9e71313045c2ae4, 0x5fa206038f0b1636, 0xc12db0d94cbb9a29, 0x68d3b619fdb110a4, 0x3eb0197cf77bdd05, 0x5e99bdd434998ad3, 0x7b49eb7255731a3b, 0x673c90f0b88167d6
+, 0x8c1410a7efb0df43, 0x0506c80c49c81336, 0x456091387a1dcad1, 0x60264bc307383554, 0x0735417948ceba24, 0x5f0e435c28170059, 0x2caeb710bd7be2ea, 0x6adc13d084209332, 0x48d01dd2aadeb6de, 0x303fb3274aa4a789, 0x7a1b460557ea79de, 0x253fd67509cd714b
+, 0xf4b7c55849c115e1, 0x01bdad1d59ff443e, 0x507d5ea5d0485a4d, 0x6fadc2ae4d6f97cb, 0x1888213dfb49dbbd, 0x0fdb0491e72f4e6b, 0x61b7465e91a11b51, 0x7fce8594e2b54f6d, 0x7f18749eb06c21ac, 0x74d870784ee472f1, 0xc26b44c17b53042c, 0x07fc954e86f95052
+, 0x9153fbbfac67ffbd, 0x638b9a90203a3766, 0xb121801ec9df3056, 0x5111505fcd8ea60e, 0x17fdafb316ec8707, 0x1503dcaf722df39e, 0x737337626b6f805a, 0x6d4238f670cff8d9, 0x94a81b104e13d86e, 0x232db8164f328300, 0xfb2b8ad76be48f90, 0x2430ac3d21b53d62
+, 0xea28836971806879, 0x265bfbc37b3362ad, 0x896fe21d1c497f7a, 0x2cad5854c7d9629e, 0x8c3c35ef62915a00, 0x78bd5c8420a2b76d, 0x91d153eeea55f8c8, 0x13db24fd6c9bd779, 0xff64fe9e70cb3e60, 0x1ab26596e3c55c2c, 0x8250587135bb6d8a, 0x70b5e28944cd8f77
+, 0x62043b375ec72dec, 0x4bfce507b4119e11, 0x82c39c93121184c9, 0x7800f710d678f752, 0xa12788c7c016b391, 0x24ba33e6cacfeac5, 0xb26da9fa5579312a, 0x705b5c5936207d3e, 0x0d42ffec66db1332, 0x443cf26d2796334e, 0x1c962472b567370b, 0x709c5234f857fb5e
+, 0xe6d2058eb6bfeb5d, 0x7a71c98f14830e60, 0x8a4045de80268353, 0x7380f1b27825fabb, 0x12f6c073ab139511, 0x67b32f2ba1ca1a51, 0xbb01c2fcb5507887, 0x6af09ef9c5c39eeb, 0x2f8591ac2980ba07, 0x6f66b127fed636e6, 0xb569d908065856be, 0x45e4874e686fddf3
+, 0x7546976d28cde0e5, 0x7b959df2074f6382, 0x1beafafcee6158ed, 0x14c780b6c6ae2148, 0xeda7636cdca0fbcc, 0x425dd794a43bba8e, 0x675173f19774f251, 0x42c13fa2d1cf8af7, 0x45b453179c086337, 0x64c77a757c0851d8, 0x3ff75a513d597272, 0x01f9e9de97e7c346
+, 0x291349e3a0414b50, 0x0f93e9920d109cbb, 0x22cc2bea4b5f7e15, 0x3631791cdba163b8, 0xc9598d2e15897523, 0x46332fa4f10bc6a1, 0xc513ddad62a59f1d, 0x5f0307f5b394edb4, 0x366386acb941b77b, 0x71fa4644296b475b, 0x60b7e67a1d445a4c, 0x7269f70527d65e31
+, 0xc2143128bf6e3f06, 0x576b6a9f9fbf3232, 0x8d33a1db8ae8fdd4, 0x3953ba9d9fc5fa7c, 0x2ee44fe58958736c, 0x510385125b48f364, 0xc3a080d89e1bbd71, 0x24c9ec0b03837ed9, 0xfb911a6ba401f164, 0x3c16bcd331dda83c, 0xeb091620c0d76bbe, 0x1a2b279cf55996c9
+, 0x53380c158484f76e, 0x46fbd70923cc6b28, 0x1dac95c519f9054c, 0x731cc03f45a1e01b, 0x770f1894ec25daf5, 0x344308b1c9692e4d, 0xfdb7575598e4af23, 0x2f394a5bf638eea8, 0x2df838773772f4b0, 0x5397826c4b8c9c96, 0x99684aae84a0396f, 0x33f8d8a28956cd9e
+, 0xe79a0d28645a2359, 0x6b70e3216f3eb6e8, 0x9419343798a7441b, 0x6d056dffb6ee4e63, 0x2718e2e604c81afd, 0x06144a15c977eaf4, 0xbc61d20c03054eb9, 0x2fa745053300f2a2, 0x34f81375b63c6813, 0x0a8a4abdb0c9d831, 0x3a55abcdce1c6a0b, 0x1fb06db238410510
+, 0x0674cffcc5c4fe61, 0x3263402200519f44, 0xdfc8d3ac2a1f0108, 0x57b5ae4dbed2eee5, 0xbc8289acd3120e56, 0x12721147b313ea34, 0x7344e7d3ccb4d684, 0x25e217f92e231fb1, 0xaf93b11ab97f7cf9, 0x6d31381769d66246, 0x10667c2b7a2ab6ec, 0x34032d030c6b3542
+, 0x33e8162e962c47cf, 0x6b1b1d4b10d6f82a, 0xa170d52d05682048, 0x478a2c1866fe3ffc, 0xcfb02dada87ea6bd, 0x735c46e065345cd3, 0x638143c5820b2768, 0x550bf6f12306342a, 0x40c3ecf5e913f421, 0x7d9e1538bd2fe2f4, 0x1dea25b81f9eafb8, 0x3fc32bb170f2ab1a
+, 0xfcebabad374e39e6, 0x5770aa50a0f80184, 0x697504b5eb4a8f1a, 0x26b61b50350c1fa2, 0x5bd2486d33643a50, 0x16615f31d056c4ae, 0xb383183bb27de5e5, 0x539e76a97acd5454, 0x852228b99ddc292c, 0x5ea25a2ab6bfb6ae, 0xc0830826f499d7a9, 0x1d487cba5012ed33
+, 0xe4a05e4fb01bd498, 0x1e637f5f925f5fee, 0xd3cb67bc6a19c3a8, 0x5033ac3d65b6e8bf, 0xbcac8285b1983af5, 0x0720c7756b061fe1, 0xa3c1096c11a187f6, 0x5c1193d155dd614e, 0x137b33238dd04449, 0x5fe1aaad550c8157, 0x7fbe278ccb353ad7, 0x1975d7dd3086fdcf
+, 0x825e87c05ff391e4, 0x02eddc51f80290e9, 0x5f17e139783cc472, 0x6f294aa08eade381, 0x8edc57ffbff51677, 0x10c7cda5ccc7b207, 0xf21468969a95ff40, 0x269c6f830caa6f77, 0x2c5b6eb1050e74ac, 0x795f72020a119e97, 0x5f227551b362416f, 0x244c9abcde428150
+, 0xd463a6069727eb24, 0x22290e331c2497db, 0x21439b9c3f6dfbd4, 0x089026a54854bb37, 0xac926d2f8b8c3b6f, 0x20d9b891a596eac7, 0x3f85a8745fce3fd1, 0x329feecafb381848, 0x510e317ea5f5462a, 0x2e8603d97d16dc62, 0x8c656a3fa01ae53a, 0x2823f64c11743903
+, 0xac827fb3983ed52f, 0x46607263d016bcea, 0x5485c3ccac80b8f2, 0x544e2b27473b1795, 0x1f1d730ecde8f08b, 0x5df393b346fe5f69, 0x853c8be2b71079dd, 0x5cbb5725218cfae2, 0xccf191eb4337c837, 0x1170f8924dc42949, 0xc5a6189f96861a58, 0x7ff55aa1e72ea259
+, 0x501efc04647cf377, 0x18d966568dd20377, 0x513af375e1854cf4, 0x10597b1ff91ff063, 0x429b9f3f8b361760, 0x616b54ffd94b7fa4, 0x5be8b02e244d1aac, 0x6b9dc8527367f6e6, 0xc4b5c83003caed0f, 0x61ec22ea52df8821, 0x646f35d508a04b9e, 0x5c1b64d650a73ac4
+, 0xd25aa48a24368780, 0x7b81429f05239383, 0x5c7cab35a10400fd, 0x2a3890f2f42931b3, 0x5cf325402f6e0bbd, 0x723d60ab066851fd, 0xdbe63e7eeaa4417f, 0x02ed0f598c4be1f6, 0x4ab4ff7243e03022, 0x5915558b8ae50e6b, 0xaa1df8de788085f5, 0x2a05ca9096302c4e
+, 0xccf07d59e7b1a26c, 0x22dc5160cf79a490, 0x5556fc120d671c15, 0x40995adff872f88c, 0x0b2f033d949ab708, 0x4a1bdfff79d2dcd7, 0xa953b5117eaf0c96, 0x1910d3f82feece89, 0xbb23e25dea27abc3, 0x53114be40752ae6c, 0xc054b2dd5d1b3603, 0x7d0b302cb72298bc
+, 0x7a28fa536b13a1fa, 0x502b9fc7ce1357a6, 0xf59e0faae2390dee, 0x412aac996e928409, 0x46cc48e7a37190fe, 0x4e9436ce4dc35567, 0xb762d17a1e9235bc, 0x048eceba997d30bc, 0xe2ce8e0a3292fc1e, 0x0012fc002b2a3f45, 0xb95a2f18e1cfa9c4, 0x7e1020c8f23b118e
+, 0x8e8550d902226c0e, 0x235d254f763f6bb9, 0xa7fdad094eb9edd9, 0x4b9af9aee61ae099, 0x6af1a1227e201071, 0x0cf177686b7e3b90, 0xb067f3233909d188, 0x27501ba83209a5a0, 0x565f576a18d81283, 0x570364289f3a8896, 0x233ab3d5aba3bf78, 0x76c68230cfd94270
+, 0x15819e3244c4db2d, 0x0c2ebbb0b49f1dec, 0xf02ac1db2652a2e6, 0x17f92e3e42ef9f9a, 0x8257872099c945ff, 0x44ca04c5bd3f79de, 0xaed32ddac0fd4e5e, 0x51ab595df8256854, 0xac6c48adb51f8872, 0x7f39a0b191da4bff, 0x713d068540681841, 0x666b622e2245daf0
+, 0x03d3af75b3eb742f, 0x702e88aefffa4f09, 0xe04279781f1f4237, 0x6480f30cf7c46859, 0x23de73df422b4cb6, 0x7ac85d45c5de79d5, 0x10b6bb8792c450d1, 0x3683c98069188e37, 0x328e559c3bee1207, 0x16c1cd1bbbde36fb, 0xbf37e10b989f84db, 0x5b481d4cc822aaf3
+, 0x0bbda2277259c516, 0x73908fe049cc4da6, 0xc46e1250e0a45d9c, 0x61fc247f1fff8123, 0x99c7c21e4eaa1b3e, 0x476b588abe1dae5e, 0x2bc0421d0d9aa9ea, 0x63cddc667441dc35, 0x2d8706f531d5a756, 0x56e8e346ca36cd9b, 0xbc9f63919c510172, 0x2698eae9f6ee4e7c
+, 0x7455a1fe7619b6f7, 0x6dea0aecfc7d0c8b, 0x40d288ab359d6fad, 0x50ca052aabacf370, 0x5587604db8916bec, 0x16c290cec2133065, 0xdd93589f6db0be3e, 0x6037d942abb2d51c, 0x4dcddce46ecf36db, 0x7029149886a9996c, 0x1f1b65d8e7776539, 0x261275e6dd3d7dac
+, 0xa720a27a8a4e76a3, 0x6b8a16f95367d59f, 0x9037f922e16981a9, 0x7b93e0e5b5bb6f33, 0x900bf47b6c3ac6b2, 0x7b0a1ce7aa329e48, 0xb600441cc5b39c92, 0x70130169e8a03b20, 0x95f2337cb01a75b0, 0x3e6e651f93090ebd, 0x4886167b46a685ec, 0x0337aa80970bf864
+, 0x4e59d7b98267cc1a, 0x6641e2526a4aac69, 0x406a9d3700e5e56f, 0x310627b621db904f, 0x2f7472902de9e53d, 0x27d12ee6c1f0798b, 0xeda57cc492fa0b00, 0x222da8eadcbf2e71, 0xa88e52cf7a6b2b6b, 0x2e6d0ecb96c94197, 0x15d6d93a45ae4703, 0x10a0c4128f3d6d03
+, 0x812a58d8a604b7e3, 0x4d88752042785537, 0xa8dd51d705bcb748, 0x3ae4a3e091738e48, 0x9909b1df99410ef5, 0x620922df14d47a13, 0x75a41eebaaefcb72, 0x20b3a125fde089d4, 0xe44f26980a79479f, 0x0135cbe75202da0e, 0xce47837f3088b845, 0x385fefd1052e5ae7
+, 0x11b6053ac1a12f1e, 0x3cb8b06c9d4b20ad, 0x9141aaf99c631b7b, 0x453baa010d653112, 0x7ddb6fef72b21a2c, 0x2ab793ed4919aa07, 0x8e6180e5cd92260b, 0x2e7d06b08bb50683, 0x5dc1028a48c37534, 0x6fb73aff5dc07030, 0xed4ccbe13a66cab5, 0x57d5719548b106ec
+, 0x3bf729f8f8d10e40, 0x02e64d437d36a84e, 0x7f8c7ac4efb17917, 0x44927d8c124fde80, 0xa9167a983258c007, 0x0d5d46855d5fc28f, 0xc215ece491449c89, 0x5f9ec9c95165a835, 0x837af67f5106135a, 0x325857bfe9f0d2c3, 0x5b4eabb85cfc448d, 0x6b5e6886f96870c0
+, 0xfbc6f9cb78bdb2f3, 0x0e5645d45a7ae564, 0x4f163d0a37d54f79, 0x3dfcdcda7c858376, 0xed952546cbe931ef, 0x7f06f56119b7ced3, 0xce09371e92ddfa11, 0x22984c6895be27fa, 0x5ff4c06994480aa2, 0x0d89534bd5e699ed, 0x72f8cb6cc51c8802, 0x5cd6db7ee45b7582
+, 0xf2484a2260b03a81, 0x64ad4cd35d2bc95c, 0x4b77ac35bce0377f, 0x091b44e34de13007, 0x257b2048e89fbee5, 0x520e3ab7bfd9e075, 0x7f83f9fb1421ba6f, 0x472061cf9a89d311, 0x910eb02676753a1c, 0x5a533b39e38861c0, 0x37aa8e147d9999a3, 0x3871a54a1ae06de8
+, 0x982bde285ecde6cf, 0x2ccb918710deb79d, 0xb351bdedf5ed4384, 0x7d9054629e3cd6d4, 0x08950079c00f4d45, 0x3c1a3b0a01c20a35, 0x027daa8bd45e845e, 0x0ab041f9bad202c3, 0x03c2e9af2fa2bef4, 0x4066324255b62112, 0x133ecee9ed1419a1, 0x610f118ed3b2f844
+, 0x3b94a681baf3ce0c, 0x00391affd496387a, 0x6cdae1640318f867, 0x4800bd5ebdaa6cb9, 0xcc68be230c6fe63f, 0x4355d47555ceec24, 0x1423042f894a949a, 0x0ea4537341cb4e9a, 0xdb0ecf564ceb1511, 0x1db062b3bc53c1a1, 0x577b8df22cc41d16, 0x25365ee0ef65be96
+, 0x0be89d7d345eedaa, 0x47c95bda53ad5550, 0xf26da9b0921f9958, 0x2064f523d57f93e6, 0x1c950fd45b0542e1, 0x265a18658a85de11, 0x5588873dd63bc244, 0x1372cd1842ebfdd5, 0xe20dae90222be379, 0x6b3ed446b304e682, 0x6a294a5da3972fb8, 0x43c404b2ee120666
+, 0x1c46a0b185e5b356, 0x3792bf358cb66902, 0xb7fbe7e8632df932, 0x063cc136f0348a08, 0x888a3ec852100718, 0x50686f4ecae962b1, 0xe46ca10566111d80, 0x577b41460d3a3f57, 0x43c5c2b31fa5bcdf, 0x0640b84477165959, 0xc6ed136fff8da906, 0x139e052ffe45430b
+, 0x0557cf9757ebc97b, 0x5aafb564a6f7c7fd, 0x13acc4d5096935bf, 0x09cd632b1be657ea, 0xab7803b85804f932, 0x300db81f9e626629, 0x98b37f29eb6161ce, 0x33806edd75da86e1, 0xe933a01595d67353, 0x5846cd1e51799536, 0x40e046231cb64d57, 0x313dfc70991b02c9
+, 0x83761deed3959f20, 0x4082ee856dea64f5, 0xaa85d90599eb04e0, 0x5b96c5b065ca71b6, 0x5fb600ce7eabfb3a, 0x4b40e6d36d16d610, 0xc8bb715512b21fa9, 0x67fc17334946a882, 0x35f418f5edddaf1a, 0x790b252bec603b8d, 0xf0314a54395ee664, 0x30f16e130b1160f4
+, 0xa16329a83a3b7117, 0x1483560034d3dec3, 0x64adebe0a3c1cd14, 0x3857a38a4d0b7187, 0xd011c5c72b474f06, 0x5e28eae13b052f77, 0x2276b32109b56256, 0x01a30a3229e9489f, 0x1213273546860557, 0x525df9900d705118, 0x9453249d6e37e752, 0x0c7caebaddccda93
+, 0x38d2d301fa8dc44e, 0x64f37b660ccf50f1, 0x8e1a34296572aeda, 0x7225cc110eb189c9, 0x45dd98156a462109, 0x12892a5576a507fa, 0xd1481232adb33e11, 0x4f3aaa81575c47b9, 0x826b4324d67d8cf0, 0x79bd3d33480b5cb8, 0xa474bf03954fc2e2, 0x7302bab3df52ff37
+, 0xe48924f3a6282262, 0x0eb3b73361d1f10e, 0xb74b53a66bda31cc, 0x089496e17fecb011, 0x81a1f0372bf360a9, 0x588144261ca7a21a, 0x010d451da5cfeb7c, 0x50728bfa634e3572, 0xe0277a6e05fc6ef7, 0x094342b69f169be0, 0x63acdf248cbb9905, 0x4800b50ef82d7b60
+, 0x8a3b31d054c9259c, 0x0c98722ac4d324d1, 0x6d1c3384db4860a4, 0x1b8b9f729631799e, 0x7ef3a6380858721b, 0x081f366420a0f284, 0x81d8ee9820f9a69b, 0x52352d6347a40425, 0xb23fe2955e85de46, 0x63d0c1490f253d5b, 0xcbc75ddbf5bc0010, 0x5d7c60cc8985cb79
+, 0xb67a77c18ff6aa28, 0x7d1700cd5cfad00f, 0x257ae7e080f46690, 0x4a57b300ead2ef67, 0x3d8dcd50d2539824, 0x35f16be190fe96e0, 0x23667ae7656fe3ff, 0x70121e5e79cfee8f, 0xefe483579896e133, 0x39ce7e66d181dfac, 0xd8dd7a16c19c5b55, 0x5dc7bd0d97244fc6
+, 0x5386d1f3ab0de7c8, 0x796cfae6d97fca9c, 0x641bc971a2aa3d03, 0x71eb734fc5390dc0, 0xddbdfda2bcd655d6, 0x4bd6c997a68da67d, 0x87f8664153bcb256, 0x157444de27757e79, 0x463f7d22d6c37f2e, 0x1a525628edf00582, 0x053ecdb9c678597b, 0x40e0829f88ccc918
+, 0xf999c6db2a9d3dff, 0x6a7a460def926f94, 0xf50b93ef8f30fa17, 0x34dbe68719f0f011, 0xbd57582ff540a494, 0x779bbde5c2626ab9, 0x7df94111f570f2b2, 0x0a66286ff0f1b87a, 0x949ac58c24e7ce53, 0x6652c927daacb716, 0xc276042df4339612, 0x5fdb04512a441a25
+, 0x378c3a731cf952ee, 0x3eba81123bcb5f81, 0x66c28707e038784c, 0x3b784a29350d0f0b, 0x8b89beaacc9e353a, 0x692726392cbb1e56, 0xdc1a93bf693869d0, 0x5537931290375e63, 0xee1f2cb56f1ea201, 0x3b470e7354327753, 0x7fb3e84c226e4098, 0x60f258e1ea37a6ba
+, 0xcb8905cbd7f8d64a, 0x57abddb746773c1f, 0x0a870a3476505363, 0x29c1bb7d0e30373c, 0x9322c55bdf28de19, 0x58de6d4d988a8d61, 0x55fbc4a59665c9cf, 0x73eb773d43d4e4ee, 0xb9ef05ba686e9f82, 0x19fdcfe596fcbf76, 0xe16ee28535cc44e8, 0x627fc64e58e3584b
+, 0x60020ccfa65b6e47, 0x2058e0d0e67783b4, 0xb571cbe6f8fd99e6, 0x5d3794e130ac5eb0, 0x9e222282b45f0139, 0x2cd9bae297b21322, 0xd8f018f8d1315ec1, 0x7e3d2e745151e7f1, 0x7d414f008493761a, 0x19071afe96108d6d, 0xc43662dc814e6510, 0x33e5622493773ac8
+, 0xa63e55897c60d065, 0x5f9bded7acd06881, 0xe6a6cb7278b27645, 0x6e8e8227b2ef4407, 0xb73560f8271875ae, 0x447eb9487582ffe2, 0xf25dfd4c5b70eb36, 0x2ac2cbe24fe66b65, 0x7e889eef2bc74f08, 0x08f3d358dae96f85, 0x240ffce2128dc08f, 0x5f6fb087fa335a40
+, 0xf9e5f20d91359edb, 0x659df7c221599897, 0xd9a4068c66a17c94, 0x6e4ac098d6679d37, 0x435d0cccda8f5175, 0x5f621a5e5712cd81, 0x2112ee0fb6a170b0, 0x0e31be86d67391e9, 0x6e0d1f45329fb79a, 0x536aa2bb9150952b, 0x902a7220dcb39d38, 0x60f64d6d37f0e146
+, 0xd524b02de2a732fd, 0x2453bc275568084d, 0x9ac8ae336a625e9a, 0x331a103c9b691525, 0x10dc0211654342f8, 0x122e9c5ae7918fb3, 0x649e95f3ba951d59, 0x6dfbef02330ba6fb, 0x2ad660a62ea6a451, 0x5a5e70d1181678aa, 0x76e5b7a322a91e7e, 0x5f80f219bf0b820e
+, 0x94a7a935d06f824a, 0x778026b5f5ad470a, 0x5db66e3f74ec3be0, 0x5704fcace8f38038, 0x5ef46ad55357e48b, 0x258c2a516a292a36, 0x18e40a8c356505cf, 0x1a74bef7f8b0aa04, 0x1c86a14b2244051c, 0x300856b0d7610e25, 0x275f59493341bedc, 0x1f57dad45b547a07
+, 0x62892c913282671e, 0x19a996f0923ae7f3, 0xcb576f2195bb7789, 0x65ca6a79c927ade7, 0x500d65dfd34cde25, 0x06e054c8edf41864, 0x58c6cd9b49374e1a, 0x3d4c8f1851b93cf0, 0x6e7d65ebc179dacd, 0x38c5fa3448cd918e, 0xa74d5790958334ff, 0x085f53a1467dae56
+, 0x012c334367020ac6, 0x604feee1686c895e, 0xd6ce4c1d8d9d0271, 0x16293f9bfe803d4f, 0xe04303f14f823db3, 0x6c537db62ad567e0, 0xf02dac57bb58d5a6, 0x77cc3f2de81e30bf, 0xe31c83934acd8199, 0x1f768eb26e9201dc, 0x0db9c2ef317a18df, 0x0455bc47b571a312
+, 0x7c591f02c894e384, 0x5a117795428255a1, 0xc7c5c83204a758dd, 0x53c579aa8534c6c9, 0x70d957548dd3692f, 0x2354c5f8d39b1304, 0x091e0cf952295759, 0x3f57aea636caad01, 0x922f3e88b58eb1c6, 0x3d89cb6bc6b2fbc8, 0x33c03f116df03b94, 0x5f36cfbf3dd8c82c
+, 0xa3c05f062ccdb844, 0x05b971660df86695, 0x0a15ed18279e2408, 0x4c70ad59c6091fd2, 0xd8201a9ba7e35ad1, 0x49b3231ec1125dad, 0xe31864d2c0bc1c4e, 0x39d5f490d8291ec4, 0x20cd82f691a24759, 0x1d4c520b772ec426, 0x81aa67cc1c8c11c1, 0x30746ce5e4dfe737
+, 0x328cf64a5c1f324b, 0x391de211fc73efa7, 0x71e62a6094c8a554, 0x48e1084be1f0c3e5, 0x5345bd385ac3ff9a, 0x67d7aacf0bf12182, 0xd43f4ea8e850b328, 0x586072dc276ba15b, 0xdb86a394facbec2b, 0x45140b1275801dc6, 0xbb5278d1584ebe40, 0x3645808fdd211852
+, 0xef5193f2e867ee28, 0x28eb72f1dc71aeff, 0x36bd7801f6ae0ba9, 0x0b590ec9c9eb9fb6, 0x393ae060f9b52761, 0x47f27cbe68ed4a89, 0x7eedf345ca1566c9, 0x6b132e40181dacb5, 0xa4f7152f018e4399, 0x7da8b6d37045ff31, 0x94184f14af2b57a8, 0x0d0a38ae83bced15
+, 0x1ee584758ba87cf6, 0x244e64bbd07702a5, 0x4ea18da17fa7e9d3, 0x1dc289e810fc020c, 0x51567f78aeaab4d2, 0x4042fc48f3a68693, 0xd23912904b0d9b94, 0x132e1b9d461391dc, 0x634ab303191f4673, 0x3958991fdc737dd7, 0x8728afe3b862df27, 0x3a2ff8edc230e302
+, 0x4f5d7b24dbca364a, 0x70ac624f09528d02, 0x38daf061022f85b8, 0x4828d00c8038776b, 0x3c40d17a0dc9aa9e, 0x7dda8efdbd8103a1, 0x0e0443dffa526aef, 0x21d808218f893818, 0xa3aa7aea1dce57ad, 0x5d0fc6c192b224f3, 0x06f8a2c2d6441b84, 0x4b44f08970625f5d
+, 0x7109579fffd2bd3d, 0x04d880546d7ec177, 0xedbe3ecf67f7c42a, 0x77895359b10b3d07, 0xacd09c043db0a6c7, 0x68fbfc9d03b14822, 0x3232ef9264437ff9, 0x4e994904124ab84b, 0x0e01b854c3e81836, 0x686bb70c96679669, 0xe40f2647c51fa636, 0x356e2e81fe732981
+, 0x64603406dd92e67e, 0x643f167048a2f9cc, 0xd7889443b7a56c40, 0x306cc645a71c766e, 0xf485c889bfaf163a, 0x65396b8dbdb4044c, 0x260456f5796d0495, 0x79aec8c96454079f, 0x54cf74710dc36688, 0x37ab12ce90efb937, 0x116c014ecd6fb43b, 0x20058a58a42f4cce
+, 0x72bf4a2318e32559, 0x65cbd250211997dc, 0x74897224203b44a7, 0x5dcb69c38b01b945, 0x60e0d7e13ee0f6b2, 0x708bf1a6fd05873f, 0x3981f02dc7c39544, 0x2e892da52c863a08, 0xda722c349aac4fb8, 0x1a263ec2dbdde09c, 0x5daf194bbf458400, 0x69d0968b7a7f2216
+, 0xe518a46e1120f094, 0x6f49105e3123b327, 0x37bc4156773391e2, 0x7644c876b5cf8725, 0x62eae9fb7e907317, 0x29ccadea9c40410c, 0x845595641c44ad52, 0x37aa8fdecded36ed, 0x72f0f8a3853aa490, 0x673c42179dad0efe, 0xb5d27f3dbb7fde2b, 0x065370568a291c4d
+, 0xb4a7b0420b2269d1, 0x7b2789a797d8b6be, 0xc483290e02133e83, 0x5e6238b7275771f8, 0xb169c2eb2ccd663c, 0x30cb53e5a9e66dc3, 0xe0fbba47b846e905, 0x3e1cad4f4b8cb929, 0xd1a32563d07473f0, 0x3704deb6d448dab1, 0x0a58f20aa2d5e0ea, 0x74b29afd841b30e2
+, 0x3e7ba680e971f2e9, 0x26c16c2368d76e4b, 0x02307aaad414df43, 0x0ca5d6e3a1e1ad6b, 0x9154907e37125cd1, 0x0a5910d747ba1ace, 0xbc48786334aaa599, 0x475c818e8d0f6d66, 0x7e875cd806a3e228, 0x4dfbdb5a2a8f8d21, 0x619e4c59520873d6, 0x41b0dc9010b2f75e
+, 0x54ba244267c525f9, 0x58582d23f9a50450, 0x6e545d1f01b8682b, 0x3387e8e7600b38d1, 0x6246c793725fe2f9, 0x10e2210d13dbf7ee, 0xfc34fea38705a750, 0x2551254a1c6bce11, 0x7c2d47cafe09d0cb, 0x220eb4ef391419f6, 0xb95124f0d916a497, 0x216ec21e2f8a7adb
+, 0x4ce24bf167ebd253, 0x31d69c3cb6cc18a7, 0xc6f82435321dfa7a, 0x2374ba93a9ba10c2, 0xd266514d6248832e, 0x625e8469ce7cb1da, 0x80fbd2ed6fc99ec4, 0x67b87642545c4de0, 0x3fe26e9a23915b91, 0x2dd18e500a82d630, 0x5c57410064d97d5e, 0x64e0cb8436282d36
+, 0x381bd7d3b32d122d, 0x2b50ae0d5ad3325a, 0x809b170af002b5f7, 0x7bdc4d2c61ff62ee, 0x467d831dab3aec56, 0x4f71798666a5ff14, 0x0793fa8d6f797d16, 0x2b6a75b9259f4ea8, 0x59723c4514208104, 0x64419f4fa4d89629, 0xe1145f31ca2e5d6d, 0x087c795a961ea808
+, 0xc83af2115255e480, 0x15c51b113472b0a0, 0x0bad9fbf50fa9b17, 0x311ea018bcbd980f, 0x014be5666afe3a4d, 0x2f1827611d4b5b70, 0x6f1af0c8c5ca0113, 0x506c3a5d017b72f8, 0x7d87564b69524101, 0x7b3ad8afaadb400b, 0x6029bcd04cb4bd79, 0x4acb10adcb2e7d57
+, 0x8acd603d683ae90e, 0x39880651ca1cc7fe, 0x5250b33c89ef270b, 0x4fcab6deb380c20c, 0xb0511d51414049ed, 0x2e1a1da3813bac8f, 0x662487847e13da4c, 0x2cc6e39d5122605a, 0x28595b9116fb63d3, 0x0e0cd8cc73ee4cd8, 0x1c594b56d9aff42b, 0x38cb6b08979ee748
+, 0x65a2df04487adbc0, 0x3b8d394e0930f881, 0x91a2430c6835ff20, 0x61af7bf528898134, 0x95ab9188a7d17aac, 0x0108f97bd68f9ccc, 0xa461cf459f30820d, 0x4152afaad83aa130, 0xd61fa618b6c791d1, 0x01d4f1990fdc1d77, 0x0bc924ca0faa2f36, 0x6b31b278c817f5b0
+, 0x60cf67d7f7e2de37, 0x588f20a11a98caae, 0xd9537cca22e1cd8d, 0x5a102caa00222b88, 0xa9659671606e2a0b, 0x2455f4a0ceb5f0da, 0x1bbb85d953f501f2, 0x2790993193bfd50f, 0x9138ae37f22f421e, 0x6d363ec032670f58, 0x63eb1b6ed4003285, 0x731ec45b8fb5eae8
+, 0x821c1da9e44cc481, 0x2e969bc686667dd7, 0xf2609c8edd8e74ee, 0x6fac20570628fd8b, 0x8d0e46721289c9cf, 0x4e9f260580a5189c, 0xc84b7c688bd098b3, 0x4022500d3c4ffd2e, 0x3604130b556a720f, 0x5b037d87e02c79ba, 0x9ff01d0b6c7836b2, 0x16b7a90f63db761a
+, 0x3a18960df0d42d86, 0x0cdbc74dcefad36a, 0x3efa209534996387, 0x4c98c069f3ee9272, 0x1189f55d78ef926a, 0x790cf4ed1b594689, 0xa4812dd90e43ede0, 0x41a8afc07247af7e, 0x5d774e40204726d6, 0x3930a775017843e5, 0x05a1a8c996a17be4, 0x146c53a7ac30c09d
+, 0x1994989705afc49d, 0x45b12f5657729ec7, 0x9cc14e4380820530, 0x6a64512f69e996f7, 0xbe7f1f81b5ebc44d, 0x2285bad784f02b52, 0x812a9a5d2d381560, 0x2391afac32638525, 0x13ee2f20dc840e78, 0x77fbba80662dff45, 0x36ffd15c58a34f16, 0x17214ba76df056f0
+, 0x8d1f0aaa2bb23ec1, 0x46a009250f6effc3, 0xec14c3e4052ad64f, 0x0768f4865facf279, 0xafecd37f920a0291, 0x53f335648aa1ca02, 0xea8359225a7e8b43, 0x3d4652d7c1f4ec96, 0x4ccd525e2fe97c71, 0x6f605ebf95a23eb3, 0x4db49c2749c299df, 0x1ad868b8674ed7e2
+, 0xa84b0dbae63bc099, 0x027261902fbf88af, 0x59191a8a35f038d4, 0x18d7cf870c00dab0, 0xb688e846831d422c, 0x12d6586b96c8638e, 0xf9680c632c3bf10c, 0x453b00b8fdfcc78e, 0x71b0980fa30dab0d, 0x4748bc704a99bf12, 0x550c89ef013902d2, 0x42364cf77bd2f1a2
+, 0x47b71c16567302d6, 0x707e79db2a7dd306, 0x6a3ce41a1692fc61, 0x29757d68645f5894, 0xe80897b2f6f2fcda, 0x68b9776b9e28eb95, 0x73081b9180078e46, 0x013fa5dbf5fe0d5b, 0xf07b41d0b8af5343, 0x72802906ff445c35, 0x82019581015d2172, 0x222814085f9f9b17
+, 0x28b86b7385ba6b56, 0x33f1c6a5e00e97c0, 0xf0df974bd9be967f, 0x4a293375da3c10e6, 0x91f0e728b8a92afd, 0x464e00858acc2ad1, 0xb5d3cc6eb5c922a1, 0x0ecc9952917ca407, 0x54a2062d1fb6586f, 0x791df7347c6af439, 0x02390255e759b178, 0x134c0e9e939dd23f
+, 0x4f1271217632724c, 0x6a3745e3589c3c06, 0x49feee777026bebf, 0x51dbe137fde624b7, 0x52b0dee7a4eb3450, 0x6b23718410e06dae, 0x205ef0559c57d18a, 0x432b33cf84aedb7b, 0x2110d6933b90f0ea, 0x78f738a243da26b5, 0xeb0afb4ee1d6aba1, 0x3d77006f33928a8b
+, 0xc02da87f6c59d593, 0x19124b554c5ecf85, 0x553411748c7937a9, 0x7fe1dea097f5687b, 0x903746150e009850, 0x50988d01a36d6755, 0xccc607bb49e82fb9, 0x4956f9d0c34b084f, 0xb0196baa4559aa41, 0x7d6c0b1e84dc022f, 0x62135dec91495045, 0x6ca697c7840e0b18
+, 0x60a1cecca2ac64ab, 0x6321e4b0e1ad114b, 0x4f632cd18b435e54, 0x2accb0f6fc1aed0d, 0x47042a24f47a8fea, 0x57a8ecf9a5e3e98a, 0x49a6022b1e6efc4a, 0x5760835825d2465e, 0x6aeb6a2ef30bfc3c, 0x18652d825faf7629, 0x2bb4371008771472, 0x23daa2ddbb59ae74
+, 0x0c911d4686e18ead, 0x0769961a718a283e, 0x77c52f608f206140, 0x4d82a2f522ad29a3, 0xdd7d52a419015517, 0x1987c0c3ba291809, 0xa1576aff0c7fc663, 0x6357dcc5436208b1, 0xf342328a6f3225e4, 0x6b6e9ffd9980552a, 0xb179b876d3ef3d3c, 0x35880bc03eaf644f
+, 0xa6ebcd1391b0420a, 0x2adc66a1f7036e28, 0xcbb33d90f9c33942, 0x1771c29c549c081f, 0x7680c77a907f67e7, 0x209d285a640b8c21, 0x6a7842bfeb89b3f9, 0x00270dab933cb430, 0x21a76e2cbcfd30b2, 0x1db971b14c1ddbc5, 0x41d89361f3ac1070, 0x2c5e70236658798b
+, 0xc028d91b555d8b2d, 0x0affa92fa005af7c, 0xb662365078ca36c1, 0x2856594b997bde4e, 0x91b52e866756ea24, 0x7e7781729630504b, 0xcb4714d302143747, 0x7037080e676df5ac, 0x81a58741c1c8c20d, 0x636c2fc47d5c0503, 0x67778035b6880138, 0x114dc594c3da9b31
+, 0xb67501fc43953274, 0x778624df49b1d1e9, 0x750d82b2a9d8bde8, 0x06787035232472c2, 0xbb76fe493d5d1763, 0x2fc040761f622958, 0x0c09308a71141558, 0x18276c958c2c95b0, 0x2fb6f9e0af3787d1, 0x25b7f066bf420682, 0x27cdf36164e26565, 0x1934b519d001be1a
+, 0xba2bf748743bad8a, 0x078296b0edd64561, 0xc88af1da1dfff865, 0x05f54b5e7d7516d6, 0x57215139fa131472, 0x656194d3de0a74d8, 0x51b0084a48f9b36e, 0x69437e764811c7a8, 0xd21abc2f02226bf6, 0x5be044f96180bad6, 0x8de0eeb3128e3d05, 0x23778b3283e55d81
+, 0x2643035f3bf585a7, 0x33035dab8b00c127, 0xd42aa161fa62ffc1, 0x73f3d05772a7c3e9, 0xb7c8902b0040922a, 0x77b1a92381807c92, 0xf15af518b3d74c7b, 0x7819556a708b8622, 0x0717908a5376e754, 0x1c5f72e80cd14b9c, 0x62bc36f3296559cc, 0x7cc5363d7c6e1116
+, 0x02b2a2907c56e0a8, 0x226e411ae34f39df, 0x30e245e4ba1465aa, 0x078e6f9cd9bff338, 0xf0979e969058a118, 0x068a46cc31cdb00c, 0x711529af81261af2, 0x344aa7247fd6aa27, 0xa162b64c76e65395, 0x66c310d2a0a9a711, 0x5a370b69d1e6f210, 0x2fa557b729b693f7
+, 0x1ab99643b372698e, 0x79c02edc7ce47e65, 0xcaf87c6111620e04, 0x19a9343755b1799b, 0x3a89a65f498c51b7, 0x518e1691e20daecb, 0xbc13050a2eba90d8, 0x1348832ad8f904a9, 0xfe5ed1a8f0a98499, 0x746df5285bb89c63, 0x6e0264aabc4dbcb3, 0x743ac7b7de4cbe25
+, 0x1daf7caab9d94b2d, 0x482fb56836726d71, 0x7e26de41473671e8, 0x2681d878dd9085db, 0x9bb067ae0f2df10a, 0x527c3a452d9ab302, 0xc6d6a1da141eb5bc, 0x54c76c088fb049c4, 0x4eb9854f24ced5ba, 0x63fe1cb1deddda47, 0x7191a712b7b11f32, 0x089f0934427e4efe
+, 0xc84e8ac1590334bd, 0x53a7c3e4895cb1ae, 0xfc4c65d49c0c67a3, 0x3950d438d1a16c70, 0x0fa0819de6d5c17a, 0x53c727c385e861f8, 0xf23b4344eccc7fac, 0x5b30dd6a0d175265, 0x26e683eb0bcc2810, 0x0c42a5319df90674, 0xa44e320d04a3765b, 0x2750f2f2ae107f1a
+, 0xc3ad4a3d427c757a, 0x1fd8d0da33156fcf, 0x16c69b134450debf, 0x4819f01bbe76de0d, 0x0b99a20b8c816529, 0x1170dac415e1524b, 0xf3bb920cd40f4d68, 0x3a2590fae78e52b7, 0x19e668401c30dca7, 0x31ce56574a65ec9f, 0x90076f260b294993, 0x1508ea34ef7adaf8
+, 0x8ed391bcdaf90446, 0x0a463375c9068b69, 0xf18e597d815488ee, 0x5f993e88208866f1, 0xeb62ae19060e88f5, 0x599792cbc915ac06, 0x302694b356cb7abf, 0x1a462657b6b13beb, 0xc650d130ec5b98a2, 0x4124bc0014fc94ca, 0x32e2c4bfdb5c23a2, 0x78fbf927bb3971fa
+, 0x9daac925855ff46f, 0x61070174483230c5, 0x4bb8a4f0623a5dd9, 0x4a380ade134ee99b, 0xa7953719cb5e27fe, 0x2ed307845426ca23, 0xc8e071e763110788, 0x24ab9c721efbcfa1, 0x5a74a8fbfd7e221d, 0x0177d68ff42ae156, 0xf5af9cba5f08299b, 0x203e84586dc51371
+, 0x571d221473731041, 0x442d4e98f9b94415, 0x5d37f04bc55272f8, 0x7812a9a99e7579f7, 0xb92e540253c3cdc5, 0x7a8f05d31e637b79, 0x39158048b7eeddde, 0x2c65c48cca58e765, 0xcfeb5ec00dd90cb7, 0x6f7527b364419c81, 0x56e4d46a6c395d42, 0x7673fc8523634079
+, 0x6ad9ff5ea6aff351, 0x24953a7eff1f69ca, 0x8659e3e2e94111b2, 0x200c69e68a49f7f5, 0xd60cdc5f7c7481b5, 0x7a90acc25b3c57b6, 0x2add491c64e33399, 0x165e973937d78c2e, 0x42b73a437219d477, 0x230d53eeb3784255, 0x21bb2378c2633316, 0x68bb4b7b09bbc80c
+, 0x8546a202b713ceac, 0x0f7ceb1f442540e5, 0xfc0eab8fce614f60, 0x07ef1483a2b10ba4, 0x71963b13c866622c, 0x7891fc41583f11cc, 0xc95de67d3736b909, 0x51a8d51207ca277a, 0xb52a4e89f16753b5, 0x29bcc15ca436a834, 0xa4b066654d570b18, 0x21e25dad47d16e4c
+, 0x841886afdf9443d8, 0x1b5e7d581047184f, 0x57e2181178bdbcba, 0x0facfdbef043ef55, 0xb7b04c421eafa899, 0x66ada012c876fbca, 0xcb48533716794378, 0x6896fdc1406be363, 0x623505335de861f6, 0x7acce5a7a8bf9b2f, 0xb5c4af797a789f7d, 0x1b5c281ffe448fc7
+, 0xf6b9e8eace1a6473, 0x15cafcd484058016, 0xa1537d9360393e08, 0x310ef5cb00317908, 0x70e538ee01f4f7ab, 0x177ecccd44164a5a, 0x4020855d44acbe1b, 0x0b2cb92dd0355ef7, 0xaafc599f48d5bc9f, 0x4fd4043cd3b2b017, 0x2183858e4998004e, 0x5d54710719aba894
+, 0xc9239d85283cef4a, 0x32a4a339d23af209, 0x5770171da8567338, 0x4432590e1f94c823, 0xefb344ef54e36ab3, 0x0fae420d4b34e0d9, 0x4e83ec15c7d22a60, 0x43f7ff5f682f16d0, 0xe6b512420b470330, 0x489bf6220d2d62b4, 0x9ff26ae15ae7d65f, 0x7e30ca41c710f5ee
+, 0x18884e3629ba808d, 0x665c16babd2d0f82, 0x08877d6b389f94b0, 0x19c99c0097358b9d, 0xa00af603e604cfb3, 0x6e2d46ba50f492bf, 0x261989d314589a42, 0x3d23ac07507bd17a, 0x1922908158b7b794, 0x02ca5cbf6f37fde4, 0xbdcb76c4f51e48df, 0x5f2b072751942da1
+, 0x31bd07a7ba43cdee, 0x56847dc054bdef17, 0xc1f631480cb4783e, 0x1e281853533387e1, 0x7759766b6e6d593c, 0x422cdef41e547bde, 0x5b9d520b38722a97, 0x410eba348c9b683e, 0x16c0e47334ba5848, 0x7d8483b639842da9, 0x905aac5f91a38eb2, 0x790ae60c5f10df3c
+, 0x21e1ed59fe43a4e1, 0x68a51948d11458a4, 0x9ae754fc131d29db, 0x78d4c29272561b0e, 0x23ae015a4bf0064e, 0x79b7d1d193241eae, 0xf9b1900658621275, 0x22b686e10f807b7c, 0x51db8799b3d9232a, 0x2a033f9a17a4f108, 0x16792514a12f31be, 0x71df8cf5fafab680
+, 0x8bf7addfa41f14f5, 0x381e6967a53bb379, 0x02e9cea0630e72f0, 0x577d9ec4bdd99bfe, 0x3597973079195715, 0x05e568041fed45f5, 0xc2e8a9327376b26e, 0x08f0037942f9b003, 0xdc7d852607787f5c, 0x5c33bd97cc48e811, 0x30b7f2dff4f54c7d, 0x183ff9162787d8cf
+, 0xfcd9f906d99f9e76, 0x6e105016e56203ee, 0x0b1b3161b6fee437, 0x633eae918701fb32, 0xe02fac0db3a36f4c, 0x57dce0b3154389c1, 0x573e87370251151b, 0x6f8e7f2593000ffb, 0x5efdd512871bc34c, 0x14abb874a8ec12bd, 0x185f96f9766882fb, 0x7a55ac70ca717c6a
+, 0x01ff19b29af9af06, 0x5dff0856f7385815, 0xb3450c6662d8e9bb, 0x7a02612dd10fe9d3, 0x9c2e6f8da9ee57c5, 0x19916586bd31a9cf, 0x15d0403ce8f0dfbd, 0x24a7dfb764dcdee1, 0x149e6f4810b05368, 0x749dc2e910217510, 0xd3ef7674c16cdd23, 0x512cd596a3ab55f0
+, 0x0f405abf78ca05c1, 0x0b9f6392ad355860, 0xf19dc103bb285dea, 0x473c60499aa84937, 0xb186c86857711630, 0x649dbc98403aac56, 0x8c3e4c05f0373901, 0x102de38334ba950d, 0xf7705fb982513805, 0x3155929b898547b6, 0x4d6ae09ba62e309f, 0x7ef95ac86b4d7711
+, 0x69d640c4630e3645, 0x7827a6f0f5369cde, 0xb0acc8781588d95c, 0x19c9368ad74f6999, 0xa046ce838afce50f, 0x10f88c98eded31df, 0x5c18e3881c9c9627, 0x31315ce76b035204, 0x8d466e8e418c6ca7, 0x2a1260ca3829da4c, 0xe6af907ceed26ed3, 0x04f66c7f6b2ce0b4
+, 0x423e83e094b69eb0, 0x38303cb5bb2054fd, 0xd9f717cd07427f7c, 0x0a6e4b500f01bccd, 0x2ff1f806ed361234, 0x22fe1f69c23b9a39, 0x03430cc0462a9087, 0x777c945442be7015, 0xd1bd32a10445969f, 0x543076f0568d363e, 0xc04e6c6c7a22d2ea, 0x1c9a7533af22762b
+, 0x26000052e68ccc0a, 0x6633d4a2d5ca58cb, 0x410fe8f88af252fe, 0x7433b61b2d20b02b, 0x7972bff417a3b273, 0x4ce6b697c9d326e6, 0x9fcf902e33fea51d, 0x044f519ba2f3fc94, 0x41fcbc1158fc61d4, 0x1715a234a1069e17, 0x16e37a39f77efcf0, 0x23acc332240cee79
+, 0xa24c534b1db3c143, 0x00278c3fe03b8042, 0x85fd6a66b318f08f, 0x03c9bd6887c4766c, 0xb330021b3a6477f3, 0x1096ce12e159ab45, 0x251a0dd1f835334e, 0x372762a8a87c1d2a, 0xf55ac10d560ea204, 0x0b9441b1debc342b, 0x2df00ce0460ddc02, 0x59dc512871b27db5
+, 0x34c60f25d2c0fa55, 0x3163e1eef259c8bf, 0x9ffe14c268c7c13f, 0x111e8c79ba2c410d, 0x750a686fea7b2212, 0x65dadac1a6af2dfa, 0xbe27a7fcbb9153b2, 0x4ef3e12c2e0b86ae, 0x0872b85699d0f077, 0x1955d0bce7762df5, 0x75ffc7b55b52c07e, 0x50bff5b7bfa3dbd9
+, 0xe91328ad93f6bb86, 0x77e1f5dfb494ab34, 0xb3fa08e2187eaf79, 0x00503915515177d6, 0xb30a8894849aa13d, 0x3bb74f77c97ebe92, 0x377d7b902a65ce25, 0x4b8b25bb5b267218, 0x15b54cad0e9b9b84, 0x27afc28612db688d, 0xf329ca3abed3368d, 0x5ed9d407d2d4c725
+, 0x8140cca8bcd60e2b, 0x5b389510fe5046b1, 0x7e22bf485b73b0b0, 0x50daf556c2fb8106, 0x6a73d8a9c1700def, 0x287ecbdcedee7968, 0x381885e502ec672a, 0x47a691d94b239c8a, 0xfa53a0c2354a5383, 0x64384c916970b7ff, 0xb1e444718b177ead, 0x727325a179d5b92a
+, 0xb2b7e2ca6f0818b8, 0x7bc577fd03d6ada5, 0x3004c8623976a7c7, 0x76fd28361b02e6ec, 0xf0691016cfec9784, 0x2b0b54130a23d71b, 0xa01c4baeafe9f9c7, 0x197fd0b02492bc77, 0xd569273eec43e9fc, 0x2a0eadf38b9f2167, 0xf856e43dd4250b8d, 0x476008f3df9227f4
+, 0xf46c23d5bd761df5, 0x4768cdfd512ba947, 0xc6bca6b2e38b48f4, 0x10882d26b3b84aaa, 0xfa5fa660294bd220, 0x6a920658c4370b23, 0x68922a30326b3514, 0x5b03df87715ede2f, 0xd2981d3b4d519220, 0x4487f029d4f238d4, 0xd7629cf0dcd91e19, 0x3408c333b92a39fe
+, 0x69ac17d7f34c808c, 0x235b1bc91a0b9124, 0x738103ba199eb8fa, 0x35dd7a2aaf364f12, 0x44c6af4476a3b53e, 0x720d17d855ee4fd5, 0x22006645f9f997e1, 0x34d8ba9d2ffefc85, 0xc927c678c1664c93, 0x3a6327a3ca3b4b26, 0x338e4143e032c247, 0x4e7a102a754f479a
+, 0xda43cf9267864305, 0x7bdf0d6e9c34528a, 0x338b6820efdc2de2, 0x7e9d36ca4fdc3607, 0x76e5e1af767cf9c4, 0x03c1045434f6f2aa, 0x8cdb34ed129158e2, 0x36a1fee8f52bc231, 0xb7bd9ce42041edc4, 0x7426714e8927e989, 0x09599c4cd614cbe9, 0x72834fd8ffc74b0b
+, 0xafc7a5d0e6734cd3, 0x691ed4e75c667258, 0xb51e2d9e5fe4c70d, 0x6cada08f760151bd, 0xb28309d24fa94009, 0x514b24cf5ed87704, 0xe7fe5e5f599725c8, 0x3181c252c5224832, 0x8f7e1b5f3d2919e8, 0x7fa15a9bd0d201ea, 0xc371068ed0607468, 0x48ebfcf9c8a46030
+, 0x0b075b885a9b1611, 0x7058d41f7bd0c002, 0xb59cc22e8270919e, 0x3c6662d5de60505f, 0x172b1ddd6957c4eb, 0x0daada2c512fb170, 0xbf81396ecb92c261, 0x24a4c11c2518a5a1, 0xcc0e5059b08a830a, 0x17c666cccc3cab7f, 0xce51000cafe69dc7, 0x45f3241c60ff13a9
+, 0x3afcc55881bcff1d, 0x365bfe78be3b6f48, 0x47d2196865fdc05c, 0x28d96a925cc6a36c, 0xb4f364ed1fb154a0, 0x356b4d5c74ca9b5b, 0x99bd28d6dcaad53d, 0x07777eedb85b2dbb, 0x7a222c71cd78fbff, 0x00a6c89aa416dfeb, 0x0c92324dd4f3ac2c, 0x3591f04e9db0d158
+, 0x557ae7014a4a1b6d, 0x3c9c600dd8c136da, 0xab968d1e9b828fa0, 0x482862818ff92866, 0x115839bafae8c1c3, 0x08d903ae29433445, 0x455380edbf7d212d, 0x2ee55cd318a461b9, 0xb54b19680d5f1e54, 0x590c8b8fb1be7546, 0xc6088fd50b5ba11e, 0x5df29db3b5980877
+, 0x45d230c00f9059d5, 0x5da682ae3b5ca33b, 0x98edf56609568d2e, 0x7bf95a458c53b81a, 0xfed053545aa909f0, 0x1763eeb9c6ca19bb, 0xd1a4a683ffda2fa2, 0x3c2698fb48c10b6c, 0x405e568997f7d140, 0x245492dbddf1c571, 0xe503274f8825bf5a, 0x6e8a91cde6f0634b
+, 0x871b5c42e71112e7, 0x23da21c70c098abc, 0xac197c9e4aea7dbe, 0x09e15969416f3f18, 0x42239bc73da5c4e0, 0x6774212e2867eee7, 0x028ece0f4d73e4ce, 0x54dda2f22a668192, 0xbb8e8c2ee8448e40, 0x298a1e6ac443acba, 0xedbe961da2f412b5, 0x06b9d67e054c4bb9
+, 0x33c21ed2b6b74f35, 0x0e574948d8ddcff8, 0x56770a5ad39c3b2a, 0x4eb94f89833838ec, 0xb6d52aab4f1f5d01, 0x2ac4af46d854c25b, 0x5ef50d47d172fb73, 0x1ccc6ab230c762cf, 0x9659715e28230edb, 0x377bb394588ce0a2, 0xe106fd711ca8ea35, 0x50dd4fa281d75206
+, 0x587b0eb388c5e838, 0x76dc4a01842e7065, 0xc233a5af3eccabf4, 0x77a982951d86aef4, 0x57e5c267b1c08b12, 0x0f83f0612ffc7970, 0x9562d0705585a96a, 0x3a63f41fc48d7e0e, 0xbc452bf454c0ee37, 0x4974e35fca28f1c1, 0x455495070a4847bc, 0x120e19748569b73a
+, 0xed132f2774ee6689, 0x7c83ca7b286f184c, 0xa08eba82381138fc, 0x12a9dd6a4524dda9, 0x3012a53d84d53bfa, 0x1b20a6326d6a23f2, 0xce476708f4376661, 0x13e545b7591ad68a, 0xd4c3eb587ebdd7a8, 0x30abba6f0083ef2f, 0x06f41d4a1cabdb34, 0x57b54b92ee5b12c8
+, 0x6bd486ed901d67aa, 0x74e349b606435d36, 0x6c5d5dacc408cbbe, 0x62663ee51058e773, 0xac5d2400996c0306, 0x59814b763dad4b6b, 0xc383817d3f8ea32f, 0x2f18e07b69bb0b06, 0xe8cadfdc427501fd, 0x6d5ff65cc651b424, 0x7cfcc7f1adc9d35b, 0x26f2253a06c40ef3
+, 0xa7bd440bd7394970, 0x0e2569fc70beb174, 0xe78d1984ce534ecd, 0x52223e91cd5ac740, 0x973e5d1426e6b583, 0x5979f60a287076ba, 0xd943e8beaf103fff, 0x5a590e4b92659bfe, 0x5437d4b51bd5adb6, 0x70461c0ff784ca93, 0x68254b6f1daf535e, 0x25cc86bd5ad7a471
+, 0x7fb58528a9764ef0, 0x3ff22401d2763152, 0xe51c531c1e67b718, 0x4be7bbd3a857b1dd, 0xe03abb44c5cf261a, 0x36d83b1ed915f5b0, 0x98eed2152170e6bd, 0x48250a026b66cf49, 0xc605c413b1183344, 0x0aa42092b9ea44a3, 0xe5ec40f53996b5a4, 0x4700dd2779ac5acd
+, 0x4f3297a3458f7c3e, 0x02429dfe741a6a3c, 0x5246c53ad9fdad87, 0x691d8032524402cc, 0x93383d97f0c6d3a6, 0x78a4c804185d1b52, 0xfed93219da6a83a9, 0x4719f35ae3c8aa87, 0x56165c45a8cf4de3, 0x6529ad4d79a9befa, 0x5fe2bbe870d89cef, 0x2d93d00c4adff855
+, 0xde87201eeee52135, 0x2e1ad9a9413ed5f3, 0xc66324e12dc10716, 0x50cac1208167fa85, 0x2d99fe95bd58844c, 0x2f5c8a09dad6b150, 0x89ca91ef475d7520, 0x1b223887a3129fce, 0x968162ff5c2bfaf1, 0x07ebb757dff65b4a, 0x0a783dcf91a8116e, 0x150048f3e1e96f98
+, 0x528361970430e697, 0x63c321742d6b7d48, 0xf8c0382cb4645b55, 0x2f410ee8f1623745, 0x1c6f9b1729f3a6c1, 0x0fe5882fc72e68c7, 0xf9362e592c5a2db6, 0x35a701cdb41e9dd3, 0xa85759f5f4ce1589, 0x4b325e02878777b0, 0xec122069fece5655, 0x72158bab1c1734ca
+, 0x436e90dc8d1d4c84, 0x09eeab0eff9931a7, 0x3b7af797b8034bd5, 0x087f8c2755e03fc7, 0x0bebfa906ba8145b, 0x5b6627c226f9ea8d, 0xc9a5ba705face196, 0x3bcf70e0310ea026, 0xc07f8ad0d17164fd, 0x3d195b3db0426ba6, 0x9c21cfabaa65e38b, 0x1cc42322b57ef119
+, 0xc69c7ae3234a0073, 0x0febdcb75f8e0328, 0x7df87d9f7dab6cd8, 0x5dd160d172147207, 0x73d0163ffd0e1833, 0x4efcde3ec5e21ca2, 0x4de8c690b1594c78, 0x51919dae96571d40, 0xb87b24c3efec67a9, 0x5ca743dca7cbc319, 0x743ce94d0cde64ba, 0x03cd5a5159824c12
+, 0x7e74194b6ceae060, 0x2afa61cba54958ba, 0x0f9d80809b6f95e9, 0x798b3627a1309eaa, 0x5c1f2cfdbb109561, 0x3fdc769417b39470, 0x5ffc53b5bf04620d, 0x40bebe0cfd6e7f19, 0xe9f22def0e4d914b, 0x5ba78dd9ff1f5ad3, 0x51e6f008a9ad62a1, 0x1f2a7b777f67af13
+, 0x83b70bfc09aacf1e, 0x7ef21bdd6b62d0d7, 0x7549a6d505ff0acb, 0x261af4a7760daaa8, 0x64b925b1f154881e, 0x31b1b9dedca28053, 0x8064fdb300f40029, 0x2f8c50e96707005e, 0x45c871ebeb084e7d, 0x1b7e922c8d43b5f7, 0x2df1550155e7aa0b, 0x60ec69a017c0431f
+, 0x8420b2654087848c, 0x0f1a5cc1d2c54119, 0x31ea5f2bfac4a261, 0x498f301aa28a37cf, 0x2b1c7fd800cbcc88, 0x50d9d9d2db6439ea, 0x20ca74582146a1a3, 0x4da73f8009e8d38d, 0x2345da0a4462cc26, 0x5c08721c767e268d, 0xd5290aa97eac970b, 0x675d1e509a9c3935
+, 0xc528b25d4991b41a, 0x108d9784478667b3, 0x068b67419d3b5d9f, 0x62c20b342815c4af, 0xacd15e301d25505b, 0x19faecc3fd0ae5e8, 0x9e3ee049e950e7b4, 0x2f5b0adcbbe97495, 0xd1f914cb486381d2, 0x5429aa16af9bf2b9, 0xc118aa1d7acf4a26, 0x65cdce1cc8e4c7a2
+, 0xcc791b2a3d2ca55c, 0x2571bfb223d4a7f1, 0xec8bd0abfe4533b6, 0x25fec5a8ee7fa7ae, 0xbf934688914a06d3, 0x46b533bf0b10f52e, 0xd909d6bee10117f7, 0x58ab182e8162fd23, 0x11de1adb229f3f1c, 0x63f8c4789106318a, 0x3a6c59de2b038a3c, 0x028fa555d1a2ee99
+, 0x527c790ea1156cb6, 0x3ca763ca1f18c274, 0x81a3e26b0d95b6b2, 0x74fe7e744e5ab98b, 0xb69f0a2ce6a538fa, 0x05244d44d07b7d92, 0xda233572c44b8c92, 0x510e221261f0f6fa, 0xa60d785ba2e3d3bb, 0x293a391785b03ee3, 0xec3c350f8e63b00d, 0x074e345e814d2f57
+, 0x82f42ad6387c8bff, 0x341a0bf7474410c8, 0x245c24117936e733, 0x65a1e9e3fa17bdcf, 0xd6d441b743e86a0f, 0x138825b76ddedb34, 0x8e22ea7ce18d9b8e, 0x467fafc19d374418, 0x48cb05ff03e3af08, 0x10c08cd97393ea86, 0xc5e020d34feb12ab, 0x5a3046ced7e06ab1
+, 0x5a5862a6d023d313, 0x2b33b4563201b126, 0x74e0d7bc11b4c30e, 0x7698019071250b98, 0xf3f5572b34473a57, 0x05ea6ec1141646a6, 0xa391d31049e47015, 0x398603d707a755df, 0x07d1bcd68236fba8, 0x1d0f77db5c76d0ae, 0x430f6ef1204b67ba, 0x55dafeed68d477fd
+, 0xee96b81310657928, 0x0f7ecd79ac7ce106, 0x85bb4e05ad3e0369, 0x1c4e871f2f6a528e, 0xc014d432b29ac56d, 0x52f86256e2efc73a, 0x554960efcc78912d, 0x742de24eaa893868, 0x991ba34c0b223878, 0x3711b1578efad0d9, 0xf2eae301be19ad8f, 0x0b4c31489c697767
+, 0x6c8b7eeaedd35ad1, 0x52cac877018ed666, 0xe8ce40f385ff140b, 0x40911977a2ce0643, 0x3da227c62d9aff4f, 0x15852a3c248243f5, 0xd3eb05a584c6b2bf, 0x77d4b460a3193112, 0xd51bccab5849a987, 0x21634c26fd36af63, 0x7daac60e1a10d16e, 0x7cea61be334740e4
+, 0xf7a5783a9c226934, 0x1e997e71bc6f6ba2, 0xf7d7cd3b466291e3, 0x77518280673b270f, 0x844f22fc025ed149, 0x3172bae757b38230, 0x8e486e057ae9b8d4, 0x51a9f1606435ed07, 0x391eea5b8cba6f19, 0x46eff629e0dd9668, 0xca7cd0a3a508767b, 0x1caf3bd4bea8bb99
+, 0xef21ec06067fb80a, 0x260702dc12a67104, 0x4054d69ea405d07a, 0x29cf06926fc1af12, 0x6a13b095c72c05d5, 0x25737d00a40b2ece, 0x8c01b19b40f3aa6b, 0x231962dd5639e006, 0xf20fe502d3dea534, 0x0271ffc708d8d492, 0x1b93c093c202f6e1, 0x6263e639f0b89489
+, 0x2efe578945f6788a, 0x05f4f565474f757b, 0xc2d51bd586e42096, 0x0d95f0460f955bad, 0x183afd0af3ac4fd4, 0x3439c4635be480ce, 0xf07cf0c9e4301d70, 0x21b98dc684bb5001, 0x0afbc0b432e0aecf, 0x3f56666a23aeb920, 0x3f2be622a67b2e55, 0x32d24ee8ea0163a0
+, 0x422410c5081f06cf, 0x3dcedf29764a1491, 0xb114de67f75b9198, 0x053357b0ebdc3ae4, 0x27a5e7d56ad29c78, 0x11d1d282abd7eaf7, 0xad6cc66a6f2d23a3, 0x3a8f0ff1a88c3bd9, 0xf23cebced730b8f7, 0x5f8c12271527fc69, 0x92abc582c56c5943, 0x4db2bb9753eebc38
+, 0x57f8b0f0a9bfcbcc, 0x2de53963f496ffe7, 0x8ad3346fb7da1051, 0x66ad1751d4472101, 0xd7bcb8837e1303a8, 0x1e894eda7f29ac35, 0x290aba6703b2c961, 0x61e31b9a855e272f, 0xc979f0e78447130c, 0x1a277db9e232b134, 0xa2958dbe66808bca, 0x228832baa02e093d
+, 0x50fad8ba4cc1954e, 0x079107d58a9677f5, 0xbb2ec896cbb9f75e, 0x1ea4049b418fa749, 0x2f3f5a323d46eaff, 0x5d423ab3685bd4e6, 0x4bc6a6d9bd9c283b, 0x36891cdef00acdb0, 0x2f7eed3666bba7f1, 0x668cd636419f7e6e, 0x36f7bf230a565cea, 0x3df9f7d4ed04278f
+, 0xfd76380b3ffbdde3, 0x7af352b03a6fcb22, 0x39f82c76742fb4f4, 0x2246f844c25042fc, 0x6bd2112fe98c0f8b, 0x6ad2da46661bb550, 0x91506663d88f0eeb, 0x32592a99f9107846, 0xd1f5af1fc5ce1b0d, 0x6da6eb8c9501f963, 0x831bb27d7fca9f65, 0x3f6263900472afdc
+, 0xff31bf47858be785, 0x1d98b00360d4179d, 0xffaacf11a940aa58, 0x32f982854f8abe02, 0x3a04a8dc48593fe9, 0x1fc040eae5d4bba8, 0xc6dbd801c9acd6f8, 0x345c48bc0e3ddff0, 0xd6cbe1af762633a9, 0x0dc0fa946cd06123, 0x4e69d7d5e0c52692, 0x1a3b9e6ea3be8e7d
+, 0xe2966dc1f32529d8, 0x526d796278ae2047, 0x628297b0fc0e4e7d, 0x2ef2a7ab8dfd27c8, 0x90cc4b4557451a3c, 0x6be515c998639efd, 0x2f1fa778e95115f6, 0x7ebe9922d56b0ab5, 0x34d91aa857b8e71e, 0x247a6b6066657313, 0x6f197bfa7da0680e, 0x77b9353f041260bc
+, 0xef6b6d76b4b27da8, 0x655027d36d965e20, 0x6665520193477fc7, 0x71588929372f234b, 0xeedbb410ab6cbb46, 0x3442226a73624f50, 0xf1544cb26a2f0ccd, 0x16fcbaa2b3d30a45, 0x482ab961a413b267, 0x2a0ee4e0b3aebad3, 0x74de3cd537c11f8c, 0x01c33e981aaa8616
+, 0x95cfab4e84f343f8, 0x246eb8b189e5116f, 0x866c9eee90b63d11, 0x4e930e33ed8d7667, 0x8579afdd48606269, 0x43e33f1fe57ad34a, 0x7a34f74620c5b029, 0x55dd695e1b9ca09f, 0x876243eea745fdc8, 0x0664ce9c319980ed, 0x3026bc10989ab1ec, 0x0ec3443a959daa1f
+, 0xb28b19befc1e7fc5, 0x565ab9ca5984b5b5, 0xa7a222bedeba5d40, 0x2f675d4976693182, 0x6feedde901bda053, 0x517c7521801a1086, 0x05d23d2d25dc1817, 0x64e0d3aeeeae2cf7, 0xad13a521f4397e47, 0x01349373aa1fdfe0, 0xf4ccb2cdb9d70307, 0x508d81831230e431
+, 0x744eee5f4d480b0d, 0x4c8f0fd3dbee60c2, 0xa97dbb612aff84d2, 0x68aec38b2e8bcebd, 0x62ef7ab793ec16f5, 0x6a5bd31eaebdf783, 0xf47cfb6395a62e1b, 0x4609c1a61b5e7ba9, 0xafb39f8b474c5467, 0x44a4b377c88ff975, 0xca95ad6f87e01b93, 0x50281da2c5160368
+, 0xc4db65fe0b98a3d6, 0x04f1300328ae5fb3, 0xe195293ff3ac221c, 0x483d4c34aa2754af, 0x3884d44b27f6ee48, 0x0cdda0cf78ce9aaa, 0xd08b2011bdb1f1ca, 0x389eeba2afeba449, 0xb245b58812d6f077, 0x7e0310633d1ed919, 0xa2d499bcd536a341, 0x4505f3f6b3f02616
+, 0xf8bbd12a8d9a49dc, 0x202b14af4c5ff1dc, 0x70c292922bc7e376, 0x59fd91e15ad79e2b, 0xc049568c5d1a14f0, 0x30d0c7b7270240d1, 0xbbd9c6b61dc7ec4b, 0x3861da8aac749c4f, 0xe39c8a064df2333c, 0x349e843b551d578e, 0x341dceef35630fe2, 0x12d19ba0e06180f8
+, 0x68b671b35c49578d, 0x0c822829a48c95e3, 0xfc11093ca90e0a74, 0x5ab97bad9ca0f4c0, 0xd8611a08011e6b80, 0x2c9dfe50ca553743, 0xbfe459b726ba9b64, 0x472be7179ba9ce3b, 0xc96b82bcf3152abb, 0x652cc2baeda2e55a, 0x0d26ee144f9e87c8, 0x50e6f360e4c7018d
+, 0xccc9ef842cddebbc, 0x59e0d7603ab5ee54, 0x5639f4318408c937, 0x6fe65260ef9c5642, 0x0d4febd03aca7aaa, 0x027d80a4b824d4cc, 0x5aea1447880ab7ae, 0x1315241dc650af91, 0x5893d242536db0f9, 0x67c587318b3daa65, 0xd1570e3f9fc81a5f, 0x411e857f9f4f3831
+, 0x8aa2ce4ff9744259, 0x3ade25b490461db8, 0xe21bbac829dbe267, 0x0606fabac09ec285, 0x01081c12e33d9d78, 0x2c909172398dc090, 0xd3964d2a09710386, 0x4067930a6669da1f, 0x12920f8ebe4e3fef, 0x0fd038fe741328f9, 0x9b2454d6d13b1241, 0x3a796d3ecb346fbf
+, 0x179fcc2078fd173a, 0x788f62270b50dc35, 0x4b171b2653ae129b, 0x71d6992d99ba12b6, 0x393d42a49782ab06, 0x592cab97501f7588, 0x3d9ad42b475eed09, 0x528e9eb92e0d0beb, 0x8b62bd908be2e452, 0x3bef7aff46f6f9f2, 0x609e76b592e35bd0, 0x26739e0584d5a482
+, 0xb81ca291cadd13d1, 0x07443036d5020e4d, 0x57dbbaefc6f889c8, 0x7f8c7324e219153e, 0xc333e6ba511443f9, 0x0ec4f43aa68a9648, 0x39a048c27b27c761, 0x4ad7787750c69475, 0x59f023d79527a382, 0x44c1ef4a4992f257, 0xbfda3d387ecf2997, 0x4863c3b635e7bb38
+, 0xc6df33dd177e6e71, 0x36382d8462b7b2d8, 0xc11b83af4bbde4ad, 0x2371a003899b5c21, 0xc2bde8aa1466247c, 0x7a372b8bba979e3b, 0x66167bbd12216c7c, 0x1aad2f5fe4d4f358, 0x5f20377053b55d62, 0x0616cda08ca062e4, 0x025e024cc2aa5f34, 0x26817bbf9ad27be2
+, 0x974bbadc708b95b0, 0x2febcb65abbb2c0b, 0xc19ce3a3f791ee9b, 0x71bb84acd197bd93, 0xd18a50ebbd7be97f, 0x39a956ea32560fd4, 0x2396481b1710436f, 0x25cc238c7276159b, 0xe37dbb8b8308b602, 0x49d4c2b1a74e5588, 0xf4986ec524b6f70e, 0x6b6bcbfd5469e100
+, 0x6e6287c453b94a59, 0x5c402ac34bd824cf, 0x11038edb78552f30, 0x194ac0e85ee9851a, 0x8ec53cdd39296803, 0x09aab813608686e5, 0x6a93a062d78c9fac, 0x309758be8ccd41a0, 0x5ee37309cce763b1, 0x0ce2a80da5015449, 0x5b8b35fd7415758e, 0x35263549267b7631
+, 0x6cda503eef4b6998, 0x374b3aca4ef04a4f, 0xf1e675d544d32d77, 0x62e0e1c27cda953e, 0xa3ccfb2b3c326741, 0x7bc5a27b678e416c, 0xf472c0cf35395547, 0x4345887a2fef1f4f, 0x17bd722d01f2c055, 0x7ed65e60df6c4ced, 0x718b4794f6ffb32e, 0x689054cbefebad1d
+, 0x461932677cfcdd15, 0x620197c0211f64e8, 0x7080fbed0e72404d, 0x3fc90ca006024d1f, 0xab9871c17b98643d, 0x6bd02ee2b04ab7f4, 0x67b47a9de4bca10d, 0x4e6a4e4dffdef383, 0x6d0525282f2c95b2, 0x450cc7d898a03bd1, 0x1bd95f53f52e07b7, 0x3e425603ab9dec87
+, 0x241e5e228c1bd5ba, 0x40261310bb1c89a6, 0x0498893022e3ad2b, 0x19a872df3541eb64, 0xcafc4b3856fdcc8f, 0x7176db9ab794d23d, 0x3a8119946010c705, 0x7d695fa02d5d0932, 0xc8f8126863d79e69, 0x2221d3fecfc03c6d, 0x0e09cbb6dd2f00b8, 0x4e012f5bf02e22eb
+, 0x5c85a7186a3d795d, 0x0233a21e913b23a5, 0xd4202929681ffcc1, 0x02fedd423d275193, 0x1165caff380e9c5f, 0x7e15c8b75eeb17c5, 0xcfe2e9fbe09d5048, 0x0211078d39c4a1df, 0x8e4e3d9aa6c0aea3, 0x3714afa3b8ebe5b2, 0xfcc50902f54dc5a4, 0x749dc8673336497b
+, 0xf2faafe9e2e37271, 0x0c7f8c649f389701, 0x100496157525c43c, 0x1ec4005dc8ba4822, 0x9b8d0392252dbfd0, 0x2d2e5e947f489c61, 0xd0a17ea1afc9688a, 0x4a3dae8d7fc95a0a, 0x60d79d72eaf5ce70, 0x304675ddae25c711, 0x93d630653c9c3f67, 0x7c5b6761de28ed62
+, 0x31870f0ba06cbda6, 0x3c5b9545b60a8aae, 0x88c8271ee4946c42, 0x1e7d87acb0105af3, 0x34e06efc19bca014, 0x3ebc9d88227cc94a, 0x7b20fad8bc476685, 0x04ff3766df739e4e, 0x0cc5d83a63d483ab, 0x1586fa3434b55fe5, 0x58eec01d2999a242, 0x2e69fc2b66c12e65
+, 0x7bd1ad128845a939, 0x416c8628879b63a3, 0x504ee257c49e610d, 0x3bfe871433ffeda9, 0xc84326f96b8fdb85, 0x05d6c2d8bb9c619d, 0xf298485da387452a, 0x5c648e4e7aefb8b1, 0x519dac5ec1623676, 0x5c84e0d697306ce8, 0x4c45b48c10f4f5e1, 0x7404b92319b8e874
+, 0xc10a88cfaeea8c2c, 0x7d77019fe840b500, 0xc24599ebcb74bac9, 0x6858bd7357026242, 0x4d925955bb70ed7d, 0x41b14c02b704b349, 0x97342a0f6b215f3e, 0x55db61fba8a614b1, 0xdc0fbaf919db492b, 0x0eb05dbb3f96054f, 0xe55a718333afe148, 0x2ade0d745450a40b
+, 0x21f874dce3e7d8f2, 0x19b898b1dd58f6bf, 0x38f4ad77b18a9bb9, 0x0e14aec3ce12c1c3, 0x7beec1e7996ca4b4, 0x2dad726d9d80b65a, 0xdc9bd3ebfba70c7b, 0x635df98bf5b582fd, 0xfe196fb04c737658, 0x6bf83e8e903ad124, 0xe2c78be8897bdf65, 0x4c7c9414b5c74983
+, 0x7b95808b85400fbd, 0x2b1508eb801648fc, 0xcd5bc7ed5822ff96, 0x3c1992b8f7ba55d7, 0xd78e7f82d792e79e, 0x318d4b65b20f299a, 0x7fa5fb418141fd7e, 0x2d48a2b632093f02, 0x26bfdf5983365ccb, 0x3e6608751ac18fdc, 0x9c6e51a035a4d58d, 0x7112fced3377125e
+, 0x11473d9c31f485f7, 0x36e4a986e1e43f3a, 0xde2b1ac6af09ccc9, 0x21282400b6123e4d, 0xebc0c52163fe7c99, 0x5f2b3fbd714b35f5, 0x52626e6ba6aacbdb, 0x005a5df4b590dbfe, 0xff8f05ff638ecd45, 0x4081d839c562bd58, 0xca0c79d2784f060c, 0x070b73187b2efd24
+, 0xe6456cdea5131a47, 0x1bd2e72d626a292e, 0x242265d6ccf5a4bd, 0x2e51d0c98767de5b, 0x488a35fd453212f9, 0x5148885675e7865c, 0x9df189e31dc863fe, 0x0212b77d034ad775, 0x664d0dea5eec2da6, 0x69cbf278aca6ecb1, 0xde0720c30374b111, 0x14eca7d26bb9dc61
+, 0x3c5a2578246d83a6, 0x1fe6598c76156845, 0x924e5f36b122c93f, 0x561a31a5634f5c53, 0x98b6631d6366b240, 0x263e6bbcc5a11c6b, 0xe3ea580ea1503deb, 0x122ece8444a65ba5, 0x0a7918c89dead446, 0x5d947d06b4748a90, 0xb72aca9261c907a5, 0x74dfb0c407e8866c
+, 0x7852d97e1fc9a546, 0x61c7fbef46408bbd, 0x91d993ccbfee528b, 0x6a55776560a57edb, 0xfcaeb6af2f8271aa, 0x1485c1d4ed4149de, 0x81e6e9f18ff4bdbe, 0x06e8ee5e1b94288f, 0xc93af4630013a009, 0x5cb41b563e0e123f, 0xc609920764e541e0, 0x08313c4338856c84
+, 0x8cb5e9d1fc538cc8, 0x5eea135e7581f35c, 0x50380e15946d700a, 0x25f2e7804d9a7ffb, 0x7c4ae7cec8f68c35, 0x090255c4f114d3ae, 0xeca5ab128dab5658, 0x23c19b97d931c0f8, 0xbc3d08d287a294fa, 0x72ca9a838483c538, 0xbd26625fe47d8f78, 0x52d7a88fa8f4987a
+, 0xbffecb044df01f05, 0x01a0d8584f8480a7, 0xbe607ac4a5cee7f0, 0x304dd8e11a48d9ac, 0x163fa63bdc6625e9, 0x5c0088726865a536, 0x917e47df09fc91c2, 0x0d4c8da046e81849, 0x261dccbc6cf406d5, 0x0dc37816814134ae, 0x98ebc6d93f8d7407, 0x3d2e598fceea2359
+, 0x4d1b079f8b1a427e, 0x29682a3afc441e20, 0x6bf1e3ae445531f2, 0x1e9f1cb0fe5c5d59, 0xa6e8ca9d41399b9c, 0x2ee1d15579b151b2, 0xe711097892da02b1, 0x60e1eef49a4d4bbb, 0xdfc77b05608d1be2, 0x629d466b6ecf5b9e, 0xbd444eae3747fadd, 0x7485f16c180cb78d
+, 0x946a0717ceada8be, 0x40a5ba51f900cdfe, 0x41ca7dadf357c606, 0x4ffa2729344abebc, 0x58e42a6148663383, 0x211ddee02410a250, 0x0fd79a544ff3a1cd, 0x298a34e552b05ee0, 0x1ebc9d2821833711, 0x19cbd8cb9cb3dadc, 0x475af99fc672ee1b, 0x0f3afc23aea1ed13
+, 0x7eb8c62e13ba77ef, 0x1dc615cf6fa83ecb, 0x9647b1ae36f68dd9, 0x40ec60bc8ce23cb6, 0x045022e3e8bc5f31, 0x30fd25ab2cf13339, 0x40b8e3f04a50f6c6, 0x1e36b21f9275347d, 0xfd7911c50b229bb3, 0x43ed6857cbbc09aa, 0x0c22b1af09958856, 0x64a9227215a65b8a
+, 0xce4a89e39ad2e7fa, 0x1bd058dab885be0f, 0xf1c4dc6c767cc907, 0x3d31d580eda2cdea, 0xb53522926c1c4ee3, 0x74b5cd6811197f31, 0x35ef5480cf818a76, 0x51375fb0563b1e20, 0xbb26577729c88df8, 0x0ed44de89b3f3a3a, 0xc811117bff425861, 0x3e6b7e6dd4211c1e
+, 0x3e58bb9d396ead0f, 0x2e717d3b6af3461e, 0x50fe27cb7d129d54, 0x2ad7c15d32bca3e4, 0x4e4b0b325165ac7b, 0x485cb497b2f9c09f, 0xc91fe4e6be6f72ec, 0x619f3d2619d16c95, 0xcc805a9240984d3b, 0x46eea3e607fc77d5, 0x1a2c34deac34eb98, 0x584b764d2e35d7a8
+, 0xd8d7c97483c145c9, 0x70b86dfba1f8cf96, 0xd1a0bec208ab51de, 0x54c9a5056d1b08e9, 0xe7fefdb60386dbaa, 0x5fa744370bda3c40, 0x47c60b2180c2d02f, 0x4feece26395d1e23, 0xd1db7a6aef36a92d, 0x016abd108a2c3e79, 0xf91e9de04ec94974, 0x2eefc615bf7b2344
+, 0xa0ace0a1734be47a, 0x60f28196e2571b4d, 0xf4f070a68b6eba11, 0x7886b667a9ea5524, 0xd6bdc58cefc7fdd4, 0x4a7bf3ce1cfc61d3, 0x833cbb7340ccc946, 0x29bdc5be49100894, 0x906a598eae48bc19, 0x6ca31389a5a931d8, 0x2085cd812d704f81, 0x762ee4bed308df28
+, 0x0d385276e6010c7d, 0x12821083edf6b56d, 0xf0d127bfb0502fd3, 0x0c51ac0d9ada62d7, 0x430818c45184f3e9, 0x11ee50bb8a499cef, 0x9424660fff7667d9, 0x31620641269033f1, 0xcdb920b9a6dd8ba1, 0x7f346a4e6e3df599, 0xd948b4b5716b45cb, 0x341e26595d6b8200
+, 0x88d85c300d4a3da2, 0x568529d1405e66f7, 0xc5f7afb72d2ebc60, 0x0cd35520cc82ac07, 0xb00607c5ced1058b, 0x37f12ddba29b4d3b, 0xce11f81db9ed8f32, 0x07c6bb497435a279, 0x98f5cc9119658739, 0x78391e04c9d378ed, 0x1037a594270c8a93, 0x3ab183de425f86bd
+, 0x8fc3c73662d8caf7, 0x15cb56bf0232d7ae, 0xb461cc6050074f6a, 0x3bc655df5d98fd30, 0x3cfa1b984b4df882, 0x63983585f423dd1b, 0xdfd5fc69f80be023, 0x0e27a48ce1be2fed, 0x42474a96ea329a44, 0x63e624d7a5450d66, 0xb1fad63e76b9b721, 0x2de40bf8a6644dea
+, 0x8bb73bd950db8339, 0x374f11054419ff48, 0x630253fd9156b0dd, 0x444d3540e5e525c7, 0x08859eff8789b8c2, 0x0fbd4f4dc2040899, 0xb60602f3dc476157, 0x7c89866ee2e1f587, 0x72e1da9cc3b20ed8, 0x4349e5334a25d061, 0x92a6127ff73f9e31, 0x40ff4282789f5aff
+, 0x9ba471035d242491, 0x39ae0ab9a844aefe, 0x22b4191602c10947, 0x276862bb92ab0095, 0xbd199f07fbe6696d, 0x70bd5d967ca4cb4b, 0x59d00050245bbf62, 0x7dc56c21ef3c48fb, 0xd84a8d3c2e4453a8, 0x30a4f3f174294339, 0x66e7327411c398c1, 0x2e807c0448353cc5
+, 0x77a73272e61737ac, 0x358dbf97685fcef2, 0x79758560bf40ec75, 0x3403398266214ef0, 0x32b5a1494534389f, 0x33ae9bb361e9cda8, 0x82bbcde6c06eee42, 0x2890289b22b10841, 0x2084964309f0dfea, 0x3e0a71f2ae761de9, 0xfca08d8f3546e6bf, 0x1d5a60322a1b5a62
+, 0x52d669e95d40f6c0, 0x1077959c4016eb2d, 0x875780ff1af19622, 0x53c622f077958379, 0x76622e784ad6ad20, 0x00d67cc73b94ef1e, 0x820dbbd2a32b75af, 0x0d3e7469eb896acc, 0xac53bc6aeb9207df, 0x47e904068e54aeb4, 0x3e5eb79348c5e25c, 0x47a117f82d818b36
+, 0x454b00e8c86494c5, 0x70009b06547ffa27, 0xcb92ddc0bfddb66c, 0x1fa9c3427b036150, 0x5e70e571763d3927, 0x36c24d19b5fa8952, 0x432c1e6697eecc1f, 0x108930c709925c02, 0x8223ee400fbd4c8f, 0x787b1045468da998, 0xf42b4eaacb33b5be, 0x3be042aa5385e24f
+, 0xaea434fe870f4992, 0x44cde6b652280851, 0xf342d962f782d12e, 0x4fa12e72ec3d430d, 0x35bd6b282a4d7ab8, 0x5e6be64254d19ee5, 0xaf8428c235484b67, 0x32137442d5957df2, 0x4e0f2c7a4713df8f, 0x2940e76ed402420f, 0x195c3bb1a7766642, 0x3990f713f74daa90
+, 0x37c63672d2b011c2, 0x37e8688804d3cb1e, 0x4b29496cad73270a, 0x6cb08cee62158872, 0xfe5038f3df454a16, 0x33eb060084fe7436, 0xac4a9af44077f051, 0x4489c1fe2a6cd13a, 0x7bddfc3c7d8ac299, 0x521deeedd7cd3c0e, 0xf93c1764860c5f9f, 0x6f2d399f61acbead
+, 0xe4b72d915df1e30e, 0x3a5351347c9b31e3, 0xeb0af534f5e5a273, 0x557337b2800f33b5, 0x95751ece938dd903, 0x088b8d3de722546d, 0xbc4107d6ed9f29f6, 0x769c188edb4d5431, 0x0835fc56c529a5bb, 0x67940a8effc7b293, 0x3eb0044d88affdc7, 0x06e933f1c0563e52
+, 0x5a76f83172688bc2, 0x710c86255ba24861, 0x3225061df97cc579, 0x1ac0f916bf70bf53, 0xfb3c6375115f9d12, 0x0a8d22555b4e54a9, 0x462caee7b4c31c03, 0x19b4f05efac67780, 0xa2a963974b374413, 0x309e1bf82b755eb9, 0xde7b8073de939437, 0x2954b7c233b5a16a
+, 0x8bc28bba33e64b0b, 0x42fe0262936a3bf9, 0x4659f05ed69bab48, 0x6a797e76b2c1c3db, 0x8b3bee9a2514e684, 0x1ad4b07a031f0b48, 0x9d6b0a2abfabab65, 0x6c22cf820a627cb9, 0x3200c904351e99da, 0x4a762a0227f756f0, 0x78bbeccf3ad7329d, 0x46e58575c6fb5593
+, 0x7a671755b4ed7030, 0x4f9ea412cbc9b7a1, 0x65101b44c906ac10, 0x35a4a27b42e10c49, 0x35517989403170d2, 0x3195f582a6ae47d3, 0xca3c9d2dcf010364, 0x472588006904cc7b, 0x8dd98f689c18f346, 0x220b7da24340f40c, 0x8ba6a0cd5837b2a9, 0x651cd8714e85e9e5
+, 0xfb434f1f41134142, 0x4a6eda1f00eefd8b, 0x5f1988747247954c, 0x487d2e10abcee359, 0xe40e889d910818bd, 0x2966127fd5ee5c79, 0xb71d399badb4cbab, 0x7a1b0ea3d4e3fecd, 0x445c0b34fba0b764, 0x3c88b7deb8d81b69, 0xdbbc6af5cf9b5038, 0x5da5c045c3f605f7
+, 0x27bc23f0b705258e, 0x5c281d1284ec3bab, 0x1b2c2231ee1cc531, 0x6e73aef91eb64c6b, 0x9d1a969ccbbb4443, 0x508d1cd63780f267, 0xfb63743fe5594ce8, 0x622ce92f765157e0, 0xecfc099a6f039794, 0x56e7740e65ba65a2, 0x047e2d42d0b7415e, 0x0744684ddada42af
+, 0x095852a33b57097c, 0x68e8ec858f7c77e0, 0x5ff04759711a9b1f, 0x342e16b4d8eb6476, 0x0e56816d70e6b845, 0x0573e36bb403f76d, 0x63da6d876b388183, 0x43329fdcfce2e424, 0xd4a9e33199cf41ce, 0x6e74aafb94156744, 0x6676688566dc04c6, 0x364a5144baeb9250
+, 0x7a5e5fe7aa2e9c8f, 0x41ff699f15b3c15b, 0xd42c418faade9c50, 0x49e8f65c4498ab84, 0x53b35a4c73625831, 0x602ca3892f8876b2, 0x2a71b50d5869d264, 0x193a3df9c0bfbf63, 0xf9409d0e21870f65, 0x711fc88c5334c33c, 0xed07aea527df99ce, 0x3678c73df4e862d1
+, 0x6f369418a954f06e, 0x71f3f43bd3c6b69e, 0x129eae3eaf1ec968, 0x4a0c5e325abef2b6, 0x33e8360e21979582, 0x7689b12e29c7b2cd, 0xc1ebbb159d9074ef, 0x0ca92420e368fabe, 0xdd591c5b0a70d234, 0x50c8bf5dd92c2d19, 0xd03a136fec9a74e5, 0x53c4b4ba87ad5b52
+, 0xd34a279872522970, 0x46cf00ec927bb762, 0xe0c90e281864267d, 0x1ea4c9293ddb5712, 0xca561b1ff41c4709, 0x5abef315433ba6c6, 0xdfe66a893f4634c2, 0x732cf2b34664d094, 0x05daff92ebf3e0d5, 0x27e7ab70eb429bf5, 0xdca9fcf2c614ac73, 0x0fda41c3e6f2c6bf
+, 0x2a7aae8c1e2d4d25, 0x21156dd684e1e961, 0xcf089f2109231b4c, 0x7a2f53c91088ee66, 0xbeaeb7f9cb520bd0, 0x50de6ca861585df1, 0x44bb2bfdf4a36a21, 0x73c7e400756389ba, 0x156902a4c3b6299c, 0x7dd1b89b5ec254e7, 0xbfe47064ce1848c9, 0x37dbaf5662ac2d5b
+, 0x4add52db6917f09b, 0x1a4d5a683d595911, 0x2c02fcc34a768482, 0x3ec1fdedc2ec223a, 0xcbd132ed37505eb5, 0x4a453b714ad66c65, 0xcc24da5c38a50b8e, 0x24ec29059afeeb21, 0x31817e08c23f64bd, 0x03abb1612dbd151b, 0x8485c4476aa468a7, 0x57c7c2863568527a
+, 0x43a9ddb25aeb82fb, 0x5b6e611461e17ca2, 0x4f9f8234b45bca90, 0x623e66c676a2561e, 0xed851e90ccad5b9f, 0x6fba030cbe6a3c45, 0x0172638d3e8028cb, 0x110d8a0ed3939883, 0xafbbd1acc780c0a7, 0x70d3c4dba564ce0e, 0xa7c9e5da0dca398e, 0x04ca48bc6969f9ea
+, 0xf78bda2a7d419eb1, 0x76f720a7d78c517c, 0x6525c7577aaf1752, 0x22ba27576bad3866, 0xbc052afcfd633330, 0x3024e1b2af9c13b8, 0x130f7c0328feda74, 0x1a8505071410957d, 0x34b83ed4c68e4c2b, 0x66980a1bcd3f8e18, 0xa72d67456a4c462e, 0x451e99e7b4572958
+, 0x653a98ee78e90c93, 0x610ffffc35703190, 0x7305d490817182bb, 0x550dbad206191318, 0x94619a7a4ad4551d, 0x7a66ea7439adb02a, 0xe128014d25f176ad, 0x0f1f6086d6c5e322, 0xa4e43bc88ab98372, 0x49bd03a396f1c822, 0x0b81b6bf9c500df5, 0x1e0f9700565392d8
+, 0xea153a1d45917786, 0x61e0ea8c13efbe40, 0xed8fe88e045b6a86, 0x3663431cddbd0411, 0x846b082f72d9fbf2, 0x4938489bb24addcd, 0xece2b8ef96c7a308, 0x5245e97a5a74e1de, 0x63046ae03a8ee388, 0x308a8b2e4334678b, 0x357b6b8138cebdbc, 0x34a558063ebee4ec
+, 0x5a3f4eb3391da134, 0x124bc89afb8947d4, 0x4e2538971d87c084, 0x444fce05234158c9, 0x5693519dce7b669b, 0x126beef0acf044b9, 0x6a6d243f3512563d, 0x5666bd25edd385c5, 0x52bb99a34f53d4b7, 0x6b4eef073c8b3c9d, 0x973090e6218ce20d, 0x2323149be5805db7
+, 0x91ade25e2e1a5613, 0x405f9027d69eb448, 0x6d1c843db61d46ff, 0x67a1e7f32f540521, 0x7c3b86ef7f5511ae, 0x7fe4c0352c767e78, 0xb37d80d14c1a0223, 0x67f89f9d4ad73cce, 0x21fdd966146c1245, 0x53b84bdc688853de, 0xacaf6d36e9f608a6, 0x708b0759cb98576f
+, 0x57877a25710d3934, 0x2cef0fd1e848f62e, 0x726879ea5766b9ba, 0x57d0f2e83ea2a35c, 0x7e9e98a78604a7ef, 0x7e8bf3bb4947f6cd, 0x0bd40e18d9332974, 0x5bc0b522742d8135, 0xf88716c53f9fc981, 0x03f89b5b3274664e, 0x886161336673e8dd, 0x04fd8b7d409c5475
+, 0x07785c701e378fa8, 0x68fec736982ec2b1, 0xf633c0d8d4c5e63e, 0x102d3411a81158dc, 0x1338c8f2c446530b, 0x1193845d883bee6d, 0xd110006ce28d6976, 0x5344af55d7bcb233, 0x23135d50180bbf82, 0x553e0d03c82fff33, 0xddea3b5947d0c926, 0x35ffa86b494982e1
+, 0x5777dddb8e66a167, 0x57cdd1ebeb128204, 0x74b3a5d10ff930ec, 0x4e05f001d3130336, 0xf2cb7c63f3a98e10, 0x3bb8aac3dad72ffe, 0x64cf33e60f091f17, 0x6e602daf0f76d42d, 0x3c0fd06eb59d7523, 0x35bf5f9e2dd2674c, 0x3b73427e2556d65e, 0x2481f77e0d3e2e8e
+, 0xd45572c77d6c22e2, 0x5567ae9fa0ff3386, 0x438fc5fc0ab489e5, 0x029dfe30ada119e8, 0xd20d0fdf9f36bec7, 0x7921d396802be67a, 0xa45dc9a4a7863e86, 0x0dae3569414b677a, 0x380b7dadd9816792, 0x7479cac111e2e8f0, 0x389247de5d34fc75, 0x030fe304367f26ac
+, 0x528ea21f2dee4c4f, 0x6b29d01454af7395, 0x19971b8b0db36c0e, 0x47142d3964df9716, 0xc2207d27e73e744a, 0x0b2d167fea43d951, 0xb03542f880ca3056, 0x5fbac78b74b42902, 0xa237db9e8dcbcb22, 0x575d7b06712c2e77, 0x233a09993995c532, 0x62d2246a0b1fec33
+, 0x83077fc453f0e3d5, 0x1944d7061ed19203, 0x4280226f083effc8, 0x7e4063297346f0cd, 0xd6b0fe71672ed5c9, 0x5b5f724ed11c1ba1, 0x7a3412515fa1b71a, 0x69f1233d83446fa6, 0xd30fdfd14a7dea05, 0x590c4ca673b35aa5, 0x758963cc0db0a450, 0x284b175ee7200dec
+, 0x8c49615eda36fd48, 0x42da36d8bd7f5538, 0xa5e6a9c7c5e6bae2, 0x5f9b78f1dca095ce, 0xd4d219348b7f00c6, 0x6531ae062509c215, 0xecc9b444ce78b509, 0x5af9270cc2ad13fb, 0x37aa6490f4583f77, 0x29716e52f465601c, 0x6a6ed80882e77c2d, 0x0eb6a0a5ea8b51f8
+, 0x3d42e4b8974fa54f, 0x20b1c36f84457b96, 0x5001e19ea981a3f6, 0x4c30cc82d11b7c60, 0x408dc6ee0db6086e, 0x29cf465c84173c69, 0xd050eec3eb447a2b, 0x2ac55bb74401251d, 0xfb1b8663162d6283, 0x021afb366f7adf0d, 0xe92d94e5329e2f22, 0x13b03e3d6c932bbb
+, 0x9d5c68ee6461e27f, 0x48437d81b31e7a52, 0xffd9e3aff0cd6081, 0x2dcce017cb86bc25, 0x1cece363cbb21d59, 0x64ba9012272f3a35, 0x0d6ef8491eff7fd7, 0x41dcfdfe468cfe2e, 0xb26e51a088080d2c, 0x051dcfb8248b1d11, 0xf1efbfb1ba23f4b3, 0x5c0bb4873bbea512
+, 0xbd0ed896f82e8707, 0x266f235e3e2d4f48, 0xb170a89f428fca20, 0x1fdf59972c98683c, 0x2947680146c672e0, 0x64ba8710c04f2b74, 0xf7246df936162c76, 0x55e9eb461030c262, 0xa49dd1ce2f2a5eee, 0x0b1b407239312d0e, 0xeec3a5c7ebc75445, 0x19b1faca700c7938
+, 0xa841ff65f7a5d39a, 0x5796d5f6bcbbee00, 0x656fa9ef947e44f9, 0x2b06a2f5f65d760c, 0x4418c62c5d1f8bf1, 0x1229916b93f43d09, 0xe54de185d0eb9fb6, 0x6641514a1200b753, 0x1010ba0ffd690d19, 0x5f972ad99d6099ad, 0x89b743eb4b22b667, 0x180fb94689141a5f
+, 0x7ae071aec29cf648, 0x42bece1768eafd8c, 0xf9caa426c6998fe5, 0x19a4fdea101fb97d, 0x4ea076552008be26, 0x3510bf213a1e2082, 0x6b8c914a60c0ca68, 0x76f1c8965330b53b, 0xb03d8a72272dd088, 0x09b8ed6c99cd5b84, 0x8e4eae748310f914, 0x199f22b6f7c37235
+, 0x39f2241d5f72acf7, 0x718fed7c1ea2fac5, 0xdc4958dd162128b1, 0x09ae953c6806eba2, 0x0159423be5c6866a, 0x53971d26c53a47ba, 0x8b51ee2cedd49f0b, 0x02b1bfd2e40baebf, 0xfdcd1ec275d588d2, 0x7a0960576735d6d8, 0x3315f31f5184d786, 0x6cec1b8f76cc8680
+, 0x7c01fd1d6a9fcafb, 0x3e8221ef40d25f37, 0x0d3458a37fadbc7a, 0x44b1517a9c1365d9, 0xc0c62275ff3a3bbc, 0x75726a8765de281b, 0x76ac25ab4d4ac87a, 0x49e1d60e530ba544, 0x754bf97ebf43ef14, 0x64df5181b46bba79, 0xa54149186f3994b3, 0x11a92928a8bd520c
+, 0x34a7d4580f23f673, 0x79f39be53fc306e0, 0x9bb0f67fdbf7bf91, 0x7bb9fee611f61210, 0x820dde8939875740, 0x649c8939e02ac135, 0x7e00dfce4ed4969a, 0x0aff96e90dbd134a, 0x5df898b1eae871ef, 0x17ca8100cc51c813, 0xbdb9854fe3bad26e, 0x23141e1af76329fb
+, 0x618aa29fecca9a40, 0x4b825fd46951c8b7, 0xaaebb15e502e1cee, 0x24ce8e7c092638ec, 0xa666f50ee387c4d1, 0x1d3c04fb7d847826, 0xbdf3b1f07cb5c53b, 0x418faac51743eddd, 0x0aa5b6684d2e9600, 0x2eb54f5e97814488, 0x9654a689b57e0fcc, 0x5b1fd3a99c850be2
+, 0xaf7e7daaa8cde68a, 0x2b3996fc32684515, 0xe633f1686d9f6e67, 0x190954296c738dab, 0x08113f51172a7fd1, 0x01f38085da05caf1, 0x4c77b227139c446e, 0x2d62fed7bc8fe782, 0x047c049645fe9213, 0x16394e07975da501, 0x2fb4f0507d54d05d, 0x3cacd9bdf62e59b8
+, 0x701f49e7e899e00c, 0x06b0d74b05f6963a, 0x5c68f2d158d4fa90, 0x714ca2e99f526a48, 0x639e190adbdea378, 0x5e2b26ff19af5929, 0x4974e9d71a2f294d, 0x0d754de025ba6525, 0x16e75c33531f25e8, 0x0de9c7b99d012d37, 0xc6f7edaac55a0972, 0x4b22df2e3a98f7b0
+, 0x62a3ece7ed1bfe5b, 0x20b12ee782cd83b8, 0x506c028c5358b794, 0x7a81cfaeb701e91b, 0xf758487461414ab1, 0x14a025e5ea6f1b07, 0x5e5351ab79ef00f4, 0x4e2a86a0f79785ad, 0xd6019e7cd1ef26c8, 0x49b15646b485ff76, 0x7992854f8f7c127c, 0x7dbd1fcaa0e0a851
+, 0xc9e0a0d1c1c6a7b0, 0x6b996ac0eda003ad, 0x3660283a5353bfed, 0x55875f81ecc63be6, 0x186981c46764f15f, 0x4ff3a87204f1f2b4, 0x9d8d0023484f75b3, 0x27fb5ce078ef7383, 0x5facc54d35a02993, 0x2ac4dadcf745b81e, 0x49bdf9d0f96d5daa, 0x6c9004bddef4da58
+, 0x48d717d7a077117f, 0x730b8013d4f16ebb, 0x45548a9029ab9f8b, 0x18bbf29f6a9bc8ff, 0x0a177980a43182ca, 0x6dd4f4f9b36d9636, 0x5ebfae3f5a734e47, 0x633e2ee70fa17844, 0xc9df9e5e9d2f7b25, 0x13a67fa507793f05, 0xf3a055430b29c605, 0x32da701b99385475
+, 0xf4f9dea561df0455, 0x7bdbea667a0b1458, 0xeecbe43c4eb602ee, 0x5813744f453a6e4f, 0xdda12ca2009471d7, 0x17d7f060c981272d, 0x408f9675fb266226, 0x7c06b9d394e02ec5, 0x1b15f1ec14753545, 0x219929f43053ae6e, 0x54ac612fb0ecc8a8, 0x2955cd417600bbaf
+, 0xd3a3f86c4357cd2d, 0x497ae1805f2cbbb6, 0x6c75040eae1ea273, 0x5b2b9b060aab5a59, 0x33ec16153f2f11d6, 0x26b5fa7101835f20, 0xe39e694db2de3f00, 0x3104c0fb0243f259, 0x867c628036057249, 0x10b736ba531fd184, 0xcdea276fa821389f, 0x241aabcca4e69610
+, 0xd5cb3b6a72a903be, 0x4f3881e23814d185, 0xbfabf0b499959bb2, 0x09589357f38aa651, 0xe794ac5fdfdde62a, 0x1031b24a80b9fcbf, 0x38ce5dbabd1f44ce, 0x759e7a18e8b11f6f, 0x2bbb93f657cd34bf, 0x2f6ad27eda687eeb, 0x1db4ae8ddcb4d5d1, 0x3d37ea1f11944d04
+, 0xb13e19d0fa0a9ec5, 0x16924393b4e7c14f, 0xb09267fac7846983, 0x3a6d37511150296b, 0x8163e77158c8c43f, 0x2b6f348b2c3a5232, 0x8706733ccb296977, 0x5ade334c1b639133, 0x72aaa3c40d28bc5b, 0x799f311f2dcdd4d7, 0x4a8194988feb1cab, 0x1588ff87ab8e1889
+, 0xac3d93102f0e9b9b, 0x3171eff19ee47564, 0xfa455dbe7ae292aa, 0x0efa832235a6e5b8, 0x155d3fc99c99aa01, 0x4e99c122bb96768b, 0xd837848c2111e75b, 0x451a1e6e46312f8f, 0x09c24ffb5becf14a, 0x447d8e30f3222315, 0x7ee4ea7ba694b330, 0x6b2a7b2f23989e36
+, 0xe4399196adb7bb0f, 0x12b1d28a53b18ecc, 0xcb00005e8ab2ebf7, 0x6cf739428a2767f8, 0x046cc073ab899bcb, 0x4ab6ce6f69ba6fa6, 0xb2cfedf1afcbfe24, 0x48e2bea2bf2a37cd, 0x935030d2ba208f7b, 0x4c671d5e59ebbc1c, 0xa3f2a13b4454e34d, 0x67f91153147d571f
+, 0x8eb61a845018e872, 0x1867004f35f114e0, 0x86cc17dabc70ce37, 0x2090be75bf477715, 0x9cadcfaf0b156f45, 0x338fd1b33dc756b3, 0x77501f45d5b79205, 0x272f670b2882d25f, 0x16028c6771746544, 0x570e0d865f7fd3b8, 0x0fd07e9aaf65c5ad, 0x434906fd3b11c3b3
+, 0x5164c6f83845824a, 0x017f77ab28fd4e46, 0x25ccf46e051ef39a, 0x4a5180194bc2fc29, 0x4dadad6e4e44a5f4, 0x5756c8cd353cc348, 0x1864b8f95e4985d8, 0x1808366a1b21ef93, 0xa8176912beef7ff4, 0x2a54bf58d1bec762, 0x56cdab7805293b51, 0x28911260746c9049
+, 0x688be44dc88d9de4, 0x724dbad11962ee1f, 0xe5c13700c0b88836, 0x1346675e75909893, 0xdbd5a48adc3f467c, 0x43449b9a82f58034, 0x61c48c55eac5fc4c, 0x22ad4e32c0d4f500, 0x1ae79f0bcd425e33, 0x01a834d1520b6771, 0x54a369f1ad79f1bd, 0x1917dcd00fb2c351
+, 0x2f459883d24d8678, 0x04a0d8b2bda82483, 0x4131914b9a38055d, 0x20abb93955624104, 0x3b6c84a77a3def05, 0x6370c723aa77b760, 0xf47775601f2bf765, 0x1211296e088e91ad, 0x04ab96a7d561a097, 0x7f01d43def5386bf, 0xb2ae13744e8ef945, 0x5164238b0c7c1287
+, 0x74ef9b30464ffd5b, 0x0073bd11b956c937, 0x7a17ad3941f6a0f4, 0x7937f84dec8d00cc, 0x925cca8727630222, 0x0aa4babce294347c, 0xbe273ccfda71a9b0, 0x30fc6f0f9af63f6a, 0xca2ba3313c13abc5, 0x7f56ce5356e7f0d2, 0x16dc3ab2603d3f26, 0x70fd3ba8bd1da481
+, 0x07788fc718d10ac8, 0x76332767eb97b307, 0x658e8defb2b39421, 0x62a8498fd909ea0e, 0x72de85a4ec05b25e, 0x22190463c2192dcc, 0xbc99ddb0a618acd4, 0x5a884dcbec9ccadb, 0x65cd293f9888ed36, 0x201c1a2362d0998f, 0x7d56b03e73680a01, 0x254a50b9c4ff5836
+, 0x04947d51ae7659e9, 0x7c1f386e6344c25a, 0x1ff827064a397925, 0x580400ad38236637, 0xe3e273b1185f6046, 0x08184ef989b468ed, 0xd9e6b45051db7683, 0x1089b64f88848286, 0x9507911be3589c62, 0x4c8833ddeb921f08, 0x01e48078e4266b68, 0x5cbd473f4ffb60a2
+, 0xad0e7d2852c108cd, 0x4ce26df7b0cf5cfa, 0xd7460e6e2069287e, 0x5298eeb3ba126341, 0xd5fafa1298ad6445, 0x5935e29443ba968d, 0x9bf915fc60f8f566, 0x2d21f2e674ddf3e1, 0x87130bd6ab5eba0a, 0x305447a7a5f28c33, 0xa9306357a5c4b13d, 0x1a9bc76058d54515
+, 0x412f542cb0a2aced, 0x2f16d646ce90f09b, 0x838b84f519fd0474, 0x13156954a776309d, 0x78e50fb66dddaf88, 0x4b41679273cb45a4, 0x2408ca8f60fb8bab, 0x47c009412f1160d7, 0x20e96d745ba0eeae, 0x66fa560ae7ba42a4, 0x0c4ae27752fdb62e, 0x22705e940a7a0228
+, 0x53d5535eda2c09ec, 0x22061af99c7bc069, 0xb4978ee0e790f04a, 0x7110dbbe9cf7a6da, 0x5504a036a2781880, 0x34e596e5252deaa2, 0x0ffb88be843f2a92, 0x1e1ecd98734a9395, 0xa1daeecb27600ed5, 0x2bf712930f73d4af, 0xf53e62d6bce9662f, 0x7d2ace5f6e604c54
+, 0x727e65dd895a0bc8, 0x4b5659d42b2c5846, 0xa6e36b0930c2af1b, 0x0383364520b4af70, 0xc56c0f497b0fa3f8, 0x672eaf80d63fedb4, 0xf3dbc6942f5e5511, 0x1244d9ef5b4b2490, 0x33755982a3cdd145, 0x0229f20b042cfd85, 0x30d29a56654e7c75, 0x5706cae7ce222b73
+, 0x50d9c7ca8e621d62, 0x0a6aaea278f971dc, 0x2ea96242aacdf8a9, 0x6a8c1940117ebd8e, 0x0ca7b14489fcd176, 0x54af06e425d05f52, 0xd2e55d825b2e4116, 0x22d05a1062e49154, 0xc80e11d58531c70e, 0x2ecd9a138b2627ab, 0xba20fd0295e49030, 0x69647adfb3ffdbe0
+, 0x1ed864aa175d864c, 0x570308e35ea91924, 0x206429ad15b70ad1, 0x7332697537cfff95, 0x035b1027461a2d60, 0x52b0b4a5fa3ee5ab, 0xaebdcfc36711b140, 0x14881206c8b02139, 0x81ce6e1a71d952d2, 0x6f2ee59932e50700, 0x62114135bf5e2e5e, 0x3b54e42f897b45ad
+, 0x9b410b6cb4d7f010, 0x6855d4cfb663e4c0, 0x408e46e9778eef66, 0x624cfec1bfc6e406, 0x98ddb1da006a8be1, 0x29aced4931dfda5d, 0xedbd536f2155bd88, 0x600ff79994730d75, 0x70a15184181d5388, 0x6a0fb752d0ec683b, 0x2331ff620a814037, 0x5cc91aeb80939243
+, 0x4ac9a97c6414e05d, 0x0acf41d65fe22d0a, 0x5d26d78364db2608, 0x74f89903bdc79dca, 0xf61ce09a834f3b56, 0x79f460c7377c4233, 0x6b08a2a52a42f514, 0x3b7e109836c16cba, 0xc1e7d3792148148f, 0x2537710903d4e15b, 0xc8f370252ba379a1, 0x192f8b8ccb2b38a7
+, 0xd3daad63d3390bc5, 0x08e20795b29b0c94, 0x472c2d6761ccd5c3, 0x73ee63639b7a5876, 0xffa61d0cc3d1e8bc, 0x73f0adc4d8e43b4c, 0x45a9d6f5bf29edd8, 0x7dc273358a0fdbc4, 0x5866d4204d72a227, 0x6227dfc14c742f8d, 0xd1626184d0ec8596, 0x5aa8a1ca7cd5285e
+, 0x6f406de5eaa1da43, 0x5190404de6310665, 0x453bcf65312dafa9, 0x6ce884a8c20ee3db, 0xfe95f33e1db4886b, 0x63c4c96a62ef082f, 0x718066c45c0a1f90, 0x3667780bf673349a, 0x7b48f400c9cd94d7, 0x3eac85ae722a44ff, 0xeaabda0b314fc994, 0x3f1c0d2fa0396b3a
+, 0x0dee92f1bddcd475, 0x2bb5e4d9d119c849, 0x447a06c168862c15, 0x7c4717cd8877cd8d, 0xb7dff03174df3db4, 0x126be30bd1e078e2, 0x7d7f9d0af99a663d, 0x49799179398452a5, 0x326ddc6ab07b0646, 0x174eb7913ecaf6f9, 0xcb18f6e036821478, 0x5f3a8fdcfb75815e
+, 0xad599ddede91c9c6, 0x7df41b47262b583e, 0x24699e807d55f26b, 0x6954cfe8ffb16f17, 0x8a0549f021b731e0, 0x734a9b94f1867884, 0x9e7a20ab0b998f6e, 0x74d28a5f4ebd135d, 0xc3caa1a743df78e3, 0x68889dca4edfd8cc, 0x204bff827178b31f, 0x57f3315eda597b3f
+, 0xb20e4f188be543e4, 0x713b1a9e7b707c64, 0x29690cddae803a6a, 0x09655f216478db4f, 0x167d1fb696143b6d, 0x03d7780a046e524e, 0xaf4691482b15a404, 0x7ef24ee1ad9904ab, 0x84c44639a4af20e5, 0x3bae5c75cd5fef88, 0x6f72b94d9b930a3c, 0x5b8f5e4e322423af
+, 0x92cdfae7ba27779f, 0x0b9ef4dd89583bb8, 0x7bbb7a11ee8646d3, 0x24629ccc2a025424, 0xf8e8c46135d0301f, 0x2cb39c11b4287826, 0x1082cb9e6180a94a, 0x1362d605cf0a61b4, 0xb255a185a5455665, 0x1fd2e2bb55155ebb, 0x8d6a782673098555, 0x22d8671c734b4154
+, 0x11ebab473102d6c1, 0x11d8b4175c9164b6, 0xe8e775b2616ef54c, 0x1d05e90ac99785a0, 0xcab0730ad9a80eca, 0x55034b347ab7314c, 0xa76cb69367627f38, 0x1473e90c94a8e06b, 0x1ce9800faf48fc18, 0x031a7dd6dacae157, 0x810f1534b1312dcb, 0x0ee0b13e368fa52c
+, 0x57f0cbf9a3414604, 0x59c3a6a927e57aba, 0x978d0c7b9a100c7f, 0x23a4d95881e8e6ff, 0xfc732f054ea6bceb, 0x3c1cced464c560cb, 0xeb594e5210a9f1e7, 0x2a6bf16c7412056a, 0xe647a2bc306985a0, 0x26108f922ea2dc46, 0x0f99d3792c2c13ba, 0x53c4ba8ab5d36c4c
+, 0x5709a03f7e185d24, 0x655f2543b47b0a52, 0x0d1adbe383a97d4a, 0x0c6b63af53c743d7, 0x2d6db1de395da36e, 0x6d2bd7a2034e5cab, 0x54464ee0163e237a, 0x39435e11e4e2e7a4, 0xe76fa67e67c9a0ca, 0x6f60712f672608ff, 0x631373ce1dfc50dd, 0x7933735519419671
+, 0x73285a32f9951125, 0x6be641b50c05aab1, 0xccee39aa0fb8c437, 0x63918be073623c98, 0x07350a750fbda7ed, 0x4fae94877b38bb09, 0x908c52c4015793d0, 0x183686110048b51f, 0x7a3cb7bc03773cb4, 0x07f83c677dce9791, 0x0a4ff6189524a48a, 0x5495f10cd6256644
+, 0x7eb5b7d369c77942, 0x38a93bb12694d95f, 0xa5860b8eb6f40ac5, 0x7aa7bd2a740fd302, 0x59624fe0a0a5d219, 0x1f4d842f1c537977, 0x4037535af064a54b, 0x062813ce432c8b1b, 0x81e0c43ed0fa411c, 0x05e5ad240df87a78, 0xd02f262572d3aa50, 0x102b018c882dda56
+, 0xa98a744c371ec471, 0x5bc0034a80d44eb3, 0x8d1695086d848880, 0x410e95a9c9a3e650, 0x03a990c638e6c2b7, 0x1bf26fc1a62c061e, 0x555c3d47f8a30cf5, 0x1db72c43ad078a37, 0x290030a2da9bb971, 0x56dcb5b29d18b572, 0xb262832b7cc77868, 0x62566bb0671e6e2a
+, 0x8a6db1afc87554fe, 0x4557e756aa611152, 0x57bd234b334c4e79, 0x78cd608f44289702, 0x02cfd689a24ce80f, 0x7f7438c91233471e, 0x229fb18a8efd9d13, 0x7b6c4ce48b387279, 0x46593430956cd835, 0x7b0f5c5f9738b9f4, 0x87b92ac56e925412, 0x01cad034b848bb52
+, 0xfdd4dc81e1816412, 0x468edefd8dfaa09d, 0xea2d352da068189c, 0x747ca46aec2e1aba, 0x5b5f06930da65787, 0x623fcb8c37145cae, 0x82f8aa4d8e63252e, 0x3c746d4c034e90af, 0x340daed87f2ae28b, 0x5ce88dbecb471b3b, 0x57dc6c34d4fb53c6, 0x61c158ec3a66536d
+, 0x400d56a30d45d5c0, 0x1d92577f2966598e, 0x5f6058e365876dda, 0x143d3fab43326e4e, 0x6f9a301554c9216d, 0x1c29641b7b5f4ca3, 0x77a7e4779affbea9, 0x16ab7c3fe9b6d21e, 0x51d8b8a8b8025a02, 0x62cabb8fced71f5a, 0xb6bf08e4b89b4ff2, 0x4cd890de59630bad
+, 0xc44459dfc160d6e4, 0x34247ca29778e9bc, 0xbc919368379820fd, 0x630532892e1ed311, 0x46ae2b75493e4ebe, 0x223e65e81b414011, 0xd940740576452c6a, 0x441f027c2a5dcb56, 0x2b6329bf046dfb0a, 0x794a2d95c5f6ebaf, 0x02061cbfdd431030, 0x1e1bd9b6d0d68b0d
+, 0x2d6b5399a9354c19, 0x778a6b832607a965, 0xf95c956f963f067c, 0x0ac067e02ad19040, 0x02803aca8f92d991, 0x4047f574856e77a3, 0x204ffc0873b23b9b, 0x7f08a7d676429088, 0x5bfd4b456d605502, 0x54be62a7e263b6f5, 0xda0fc30c43cea3c2, 0x70111b93e3cf5fe7
+, 0x1f335814ccfd5d64, 0x17faad11de3076ab, 0xc99da470921c9104, 0x621e8f7036b97ff8, 0x6e6ad0a8be1c5964, 0x2c8b5e358e926512, 0xd5088d923007904c, 0x7d1a8867fec3b0ef, 0x8b9f441352982f13, 0x1ab49b448a6becab, 0x1530be83a581977f, 0x0ec700b185267375
+, 0x44906686e560bba5, 0x2f8bcab2fd203138, 0xf76a58a0ba402f61, 0x48eeb74d6458992e, 0x8eec5d6ceebd0ea1, 0x699356622d251c54, 0xd6254b9e76631d94, 0x15b98b0e2e998a8c, 0xc769b7206830a846, 0x0c594974f2c0af08, 0x1aa8a8a894e2d33d, 0x0e536893a3710d3a
+, 0xcc2a66f3750dae47, 0x331ea830c088ff9e, 0x46cc00b646d1e3ad, 0x679afd46099bb97c, 0xdf86bddae074b0ba, 0x2e914a14086d02f9, 0x7ecc8dcb5110b047, 0x70c05557cde87ad5, 0xa64d2725dec18aa9, 0x593f6d26c9d47310, 0xfe8f07e35ed0ee78, 0x3cb7df4c71aa7173
+, 0x6bf4618e82fcb681, 0x612e8ad40fda9ab1, 0x5f17516b894149b2, 0x268fe93c4a43fec6, 0xa471256f825f683c, 0x6b40c2d16de2cef1, 0xe2f28ca870e2bf2e, 0x7cede2643bcd2914, 0xa2249580384308c3, 0x06045d1602d50076, 0xf31eb78a6881367b, 0x0e44456e2c0d367d
+, 0x4ab17b1dc92a9dcd, 0x40649355293efc80, 0x96fe8fd544576477, 0x4b1dbcee82d8403a, 0x2cc4910e485c6882, 0x1ca1c8415550851b, 0x21c6ffd74979cc01, 0x5c7aa1c2ca348efb, 0x71911e142f27d5f0, 0x3b29556a854803a1, 0x5fb961db6b71a4a8, 0x79fb77530a9a772e
+, 0x6b0ecfeeda424498, 0x2549d8e769ccba86, 0x50d8e2b3a0b48f15, 0x713123f0bcc8f3eb, 0x7ab0f43aa4dda8db, 0x41e36907d5817191, 0x725983e74aa9c093, 0x32a2180114e96e9e, 0xdbbcfc8b33ee5c9e, 0x14f9c8df99e6a1c7, 0x9a9d5237fc0a831c, 0x74bed52ab694bd2e
+, 0xede499f551d68c14, 0x157aac6de28a98aa, 0xd495c549f72b79e0, 0x586657e7ff33fe59, 0xbc37dfa63868e3dd, 0x2171f03f76300c9d, 0xf107f070a896b2f6, 0x615345a5733e1bb9, 0xba012dee33675762, 0x2ec32a813336fe71, 0xe16a1b804214aa10, 0x44aa99a18ca16585
+, 0x07e133a3978d3885, 0x08135053b37963a7, 0x5a2858eb67e433dc, 0x5f18c76b53d2a4fe, 0x551a7ab2d4ac0314, 0x40ec1e62ce3a7988, 0xd924bb5a82c0143e, 0x11a72380defc3c1e, 0x631567e8e15e901a, 0x44305cebe2e4bdf7, 0x2f756b12d09816df, 0x32f62323e5be9f9b
+, 0xefac8c41ae5767ee, 0x07ab79e63ed659ac, 0xc39590c56c1a79aa, 0x66f98131b83d3f7e, 0x785d671eaa61bfdc, 0x180ec92eb3f34880, 0x3a37e2037b139b1a, 0x42fe196a677749d9, 0x3e4d7bba1e57582e, 0x74352c81ed5a5556, 0x766f22be714f0868, 0x0121c8b8f62da7ad
+, 0x8023889d1f4df524, 0x13ebff767fe908c3, 0xf09417464e881b7b, 0x3a362b4d22344855, 0x7c1fe8acacbf1c75, 0x544d9d11f78b50ca, 0x5e7b3856fe87b387, 0x5d8d8a5ad6f4204a, 0xfd795797929c78c3, 0x6f6b5c39bce085a6, 0x2017c5cedf2d9268, 0x3a07d7131aae8f0b
+, 0xca212e7a55f6bfc2, 0x0f1ab405265cfb6f, 0x99f5d7cde66b3c46, 0x20b34007e730f2d2, 0xe842e646ca5a8174, 0x70db62d6cb8e7b9d, 0x79381fed4b74e477, 0x52aaf8ed04a06fb8, 0xcc48932890feb30e, 0x2cac3323dc68086d, 0x1a3371922c9c709a, 0x4543e5c79579ac75
+, 0x678eebe80163c230, 0x6914ecf6462a8364, 0x29946f3a90abc505, 0x347aae52d53e960f, 0xc9e2cd06ac8b280b, 0x2171fbc7969ecc56, 0xf7e842ee363e9ff7, 0x3abe03719518e2c4, 0xddf87a2b79999274, 0x57fbbdedd7fd1d3a, 0x572839f8058aba30, 0x73cdbe247f6e3c58
+, 0x38c0582f6d2da42e, 0x406e4141bc9edf3f, 0xd8e8d5f4c0cb0bc1, 0x4e5a79ceaae73625, 0xf0d56263d14a34dd, 0x7a3bbc341332fb21, 0x9297817d163df85e, 0x3104fa9ea9814c47, 0x05c53eebe1a9a1fc, 0x208f28088d2da5ea, 0x68c5e70a5f92e539, 0x29b67410c6a88ddb
+, 0xbe34a6a96132baae, 0x7f2a54a8842bf72a, 0x3d8f08133d463534, 0x7470674dee9a9ad1, 0x38ecbb41fcc49648, 0x73ed87c06fc13f05, 0xb54dd56ecc1851ce, 0x38c541034c2a0b86, 0x7af914fe872d6bff, 0x240a20c00aebce79, 0x1544530a1c9c9d15, 0x3a074e644560c894
+, 0x789790c6e7b99787, 0x7646c8d26e314b4c, 0xc163b56e430ac2e2, 0x412886909833db50, 0x51045cdf73f7d019, 0x45c0590bce6ff4d5, 0x42845a3783a30411, 0x65095f1711faeeb8, 0x06f5530c39163542, 0x1983f967b8819a27, 0x813b0804bc62e626, 0x4ab642495de98912
+, 0x80037e774e6d94b0, 0x0c37c61d9ca4ecb4, 0x514440dd20b6d23c, 0x688fad335412e504, 0x935da78d17826608, 0x6ca88bbd7041f0d2, 0xd7c2fdbfbca942a2, 0x19c8ac7db0a7a3d7, 0x5f2f7ffe5badeb38, 0x0fdedd8b5e84bd87, 0xec2f847f28a2c800, 0x4bc9bca988d72013
+, 0x1f6a1434fa716573, 0x6e7709e29c3c8552, 0xe701c4d4eac61eb1, 0x73a40db7e83d7980, 0x701e4eed56b0bc17, 0x08ed2f70f1560754, 0x88305e78a661c36a, 0x48300a256f4eb2bc, 0xf5fa454dd99c8c80, 0x068d0e94f6d572ac, 0xcbfb2c56d4d566ea, 0x5a2b03a51440ff72
+, 0x36fb4b8b1e664c79, 0x5ce084f040a20311, 0x6778fe8a3709c1a6, 0x2d21f35e70e570f5, 0x819f2809ddc730d6, 0x2ac6076393eb7b3b, 0xd5322de116a52eca, 0x73fd49ee8d836d5c, 0xb12d852d8e9b6099, 0x2fb573faa0a65c1e, 0xe4ebfdf4c488fcfe, 0x5dd09ac7698ddc57
+, 0xcd041f475d62f30b, 0x7e75574cefb5e792, 0xea1f686d713481ba, 0x371afbb8373afdbc, 0x9b2ba4b78bff0485, 0x7a6a44d2a419ab79, 0x8d3bc6503506d095, 0x673007f764f77fc2, 0x725c21b02d14bc36, 0x48f4f13758b17566, 0x8b59021b264189a9, 0x716d308b71ba0ea7
+, 0xd99f27f7e78ce172, 0x4deb7b592a9d7113, 0xa21dce251f4a64c9, 0x52d1b9f9d52273bf, 0x553b8d26d74d8d3c, 0x134eb3c2d8345461, 0x0d1cc6acc35f4727, 0x6769fb558fd2ecfc, 0x63d2c0257294fb6b, 0x13dc69efd4782330, 0x9ac4ffb9dd18b822, 0x5745fc4913f57b77
+, 0x982661daf924dd99, 0x112c817d1e6f5545, 0xf9b94fd0c4b7bc9f, 0x45ae5282cd6c6be6, 0xec04b3aa5065cbca, 0x14b13be81d10a3b5, 0x9388daaf00c0e930, 0x1660714ad07d4530, 0x68551fec0426b667, 0x7a5a376a87410dd9, 0xe6ac8a1c3f081930, 0x702cef4f618f6abd
+, 0xc616dfb1af687cdd, 0x7f02edbbb93132ec, 0xfc0bfd356a3e7066, 0x2a43df8bd90791ea, 0x9c1cb3ce3bd1456a, 0x455d252ba03576f4, 0x89946ddd436daedd, 0x10aa025400e10de4, 0x93c63619bca7f6ed, 0x2d5a59723c6bf62d, 0x2a3631e0fc02dc20, 0x1180624f75598a13
+, 0x79061eee9b449244, 0x069c08820b0a4293, 0x0365ee6ab27e20b1, 0x6e2e406b0e92abf4, 0x127de2c33fa53e04, 0x2f8fdec1394a673f, 0x645f9f0583c14aed, 0x745a297c50033090, 0x1decef3af42476f6, 0x4b9ca81e82021e7a, 0x040980d882327f81, 0x5244951a34def378
+, 0x6106e87a77ff973c, 0x06caee26933caf1f, 0xcd76e990d13cc000, 0x4f4f709324b80776, 0x0f691fda43b4c4b5, 0x0dcaf075ee23d2c4, 0x99e9df59ac98218d, 0x01edabeedeb7123d, 0xb42baa8ec6f3a949, 0x62ee610b109fa4b9, 0xc828350bd995ad4f, 0x39a99436b52d6fba
+, 0x34e820fdc4f8f9d5, 0x6a9ba480bd16f137, 0x40bcd4da0f73c0d8, 0x03f82294cf40f54f, 0x541569e44f8b7c87, 0x1d1b524fdecc720c, 0xb443d69b30d8f533, 0x4f86e9aab9fae7b8, 0xece4f5ebbf55f5fa, 0x716c745739f70177, 0x9abd5d79e42a4149, 0x34e2837e83098601
+, 0x500ab523b3129006, 0x4a4314e2b8dddbd8, 0x65e5a00fad761a7f, 0x41e5d70fe5cf9910, 0x5fed6285e3d749fb, 0x2f11a8c23e4cf228, 0x5ea3cf2c2f9da189, 0x0a01ab0056b1b9e5, 0xdd92c14614a6ac3d, 0x4ead7e83ab257db5, 0xe0086064885fbf58, 0x38b7169edecf2267
+, 0xcb17e4ae49e7c9ba, 0x49b3c3647d8a01fe, 0x97162c0712397091, 0x79ac2b921cad0d98, 0x8f3412726524a7c5, 0x676fb72064af11c2, 0xfaf3c8b6765271a4, 0x21a11dbcecc70578, 0xc848e64e623aedcd, 0x16f1a52e92218b6b, 0xe8add6e2263e1b97, 0x67e736a19259efc2
+, 0x8b901347f2fc5391, 0x2ee874f80b488cc5, 0x28dc4db3a69f7cb1, 0x5427b5910c84800e, 0x84402172fe6e08ec, 0x511e4927e64a031a, 0xb044b9ce91ea05b9, 0x0afb566e250e3b0b, 0x4175c4e08fb53eb6, 0x5c33520b46274fa7, 0x712fc185b1cf5761, 0x6ea85a19f54a1210
+, 0xe42047602a843b39, 0x3723cbbf8e526dcf, 0xb0ea12b83f24ab4b, 0x508ab9bd8645052a, 0x10e308013edb0ef0, 0x3428596995adbe87, 0x8b0e4683e01f9526, 0x7e4a1e9e0a8d7c9d, 0xec207d65099d8448, 0x65a3364561f02054, 0x8543b75df0f3f4ad, 0x5dfb957033b3e68c
+, 0x2af39084455fce85, 0x1756e62d911c0351, 0xe1e5d840c2987260, 0x185a7f5d36f8bfd3, 0xffcdbdcefec8ae66, 0x01c2a1daf23bb181, 0x8263e6b37736d34e, 0x79eec9f107181cbe, 0xb161c2920dff15ec, 0x4c16eea3a369d326, 0xc8d608392852972d, 0x1ba7c9baf807b79a
+, 0xe01f96be5ac0020d, 0x418b8ff111ae59f7, 0x8051fbf0b536225e, 0x0dc8fd0f81006dbd, 0x5dfa47f3a01fc06d, 0x726074493a1eb999, 0xf420e259fd5d12c8, 0x19e99df6535816c0, 0x7beca03e896f4541, 0x65cbb9a014651fca, 0xc76d344e954dfc32, 0x2906e392417378dc
+, 0xbf92b77a8486052f, 0x23f509286783adb6, 0xe7c8dab6df8c7198, 0x4deb1f272dbdf030, 0x5e40a8dca67177fc, 0x752412c8297d99b6, 0xd444fc3ef43023fa, 0x67a29cb91af08924, 0xd94f2579351520db, 0x018115be569a5a20, 0xc40f1bb477628187, 0x41cece3aea1ad9d1
+, 0x6d34407f1aedbaa9, 0x6bd18b93c2eebd35, 0xe27e80728dccdfb1, 0x1aec18f3ba2ab4bb, 0xcdd6832eb334250c, 0x295e3a53399a0d2f, 0x2e9f9de4ecbba756, 0x36244a04948e8277, 0x4904344f35130d52, 0x506b3ea8e94d40be, 0x717b7ef1b77ba52a, 0x7196144717f030ed
+, 0xc7a4cc2e0ae70882, 0x440f991b19f4e44d, 0x9adb5277f045c9fa, 0x2bcc936cab41d417, 0x6815bfe86fc21ebc, 0x470f3b31b77eafee, 0x6389a7b5702dab56, 0x3c11f44ce3d6ff74, 0x91519a7c7de527b0, 0x012d58964ef0ddfb, 0x030f02e7706ac3e3, 0x0e1603fb41d835fc
+, 0xdf61cf3a64c6b8d0, 0x58c9dc2f83d0d163, 0x790f7bae1bf701f4, 0x2e7c77a14264f419, 0xfa72e3168223aa4e, 0x4a879dd868f5f8cd, 0x914751743b14b3f4, 0x0f2acc77bea309b1, 0xf60ff1cbd843beb1, 0x3eddaf2320544956, 0x2b898d2287876a97, 0x36e509331561fb52
+, 0xe5199b025a531e0d, 0x0be57896ad6f83ae, 0xe0bc5e882413d11d, 0x12f2f9e884fa27a4, 0xd9bf4a3c467f2169, 0x5029dab6714061a7, 0x00e60aeeb0fa9b3c, 0x6e4e9c5de3b4628e, 0xc5edc007dc45641f, 0x188f7215aa97da6d, 0x8a967d1a04c756b3, 0x671aab4fa53148f8
+, 0x6c23b19ce544e951, 0x727f9b9c4af00b63, 0xdbd5cf4583a62d97, 0x042e1aa8a5381d1f, 0x8f9a98ad27b84c8f, 0x4ee036a8e73f186f, 0xd1c3c295a7c14d96, 0x4fce32c784f07de2, 0x969f110068c5848d, 0x504fde8c7e8fbf02, 0xfa1d010ab84d2421, 0x242dabfde83fa547
+, 0xa2ed5853ec078caa, 0x003cb51977c91cf7, 0x24df13ab5cf54b70, 0x1f538c8c2fb8d610, 0x7644be5ea68fb1f3, 0x5c3d8fa52ca0cc84, 0xba36a652f4cd5597, 0x4908538c514a316d, 0x71a5043095c85913, 0x7e3c3f75116c7a53, 0x8f762cf098824e64, 0x7b551d46ec5055c0
+, 0x6920dfa750902ea3, 0x409551ffd6ec6f3e, 0xa91af6ffee88bb8f, 0x4b4ca89dec6f3cbf, 0x5d6c5846bf0beed1, 0x61cf65f03cf6c839, 0xc7f8e0ab6e095992, 0x45b1d159c4716103, 0x608ec6b37a109341, 0x5cc144e84e40819f, 0xe4c3487d545cf2e8, 0x56ebf1272c543891
+, 0x7588a94160514cfa, 0x1023b1b95acda0ab, 0x506332390c3e45a6, 0x16cf77328d988b86, 0xbf25d34ee2cda3bc, 0x0d111e549dcbca43, 0x15ee5ef4ee6fd354, 0x4b202e2e3d5b3dba, 0x3f9f70f0957bfe50, 0x425cf86cf19f4f5e, 0xa6cc69b840a2688b, 0x6ec60a5f62884d9d
+, 0x46292146db882bf6, 0x6d0ee0cf19477db0, 0x57fbab3e3302ae42, 0x61588b7d5a4a5253, 0x1e3be24d4e482a62, 0x7d4486e517707036, 0x625fb175e834533f, 0x5eeff6dfcf69ff7d, 0xb4f57139a4b40972, 0x40b85c19e03087aa, 0x4c03c80bb7e3241b, 0x4d0f1dded1685402
+, 0x3495e8ccd5caf796, 0x17675ab53082ac1e, 0x3b2390e0224d857b, 0x6a7e23b9f5e30d72, 0x7c832727d73bcd74, 0x7c8bdb46eca9ebd1, 0x0ab9d9f4a4320463, 0x0e3b987c8059aa7a, 0x1096ff56de90d792, 0x4987601375ad48e9, 0xabd0b87ca23848d8, 0x7d66c32fbef1574d
+, 0x89e0e3232f4d869c, 0x69df86d3b6cbba84, 0x6f0007e259294768, 0x6849cdf219f58745, 0x6da29bd01052e363, 0x762f8d73dfddb1ac, 0x0eef3cc8b61dff3d, 0x0d2dc743377cccc1, 0xce42b7ff7f83bd59, 0x16e8b740198cb959, 0x43ea34f199f93011, 0x25fc79b851922b70
+, 0x16eb0d111ae6d038, 0x2e6ae1adff5ec51a, 0xe7e8142fb6e52ab3, 0x394effa451fa6f1b, 0x4d8d73cc0df5bce1, 0x7db1613c9dfbeef5, 0x8e76667a7027ed2e, 0x0b615a19f8a62534, 0x8ce45b9da9d5d70f, 0x33c23facc79690be, 0x77fbb7c8fb002ff3, 0x7d224a4d2b0aa13a
+, 0x9384dcdf553b4a1c, 0x4e6bd3b38ade3e9c, 0xfa8be30cc72f6c23, 0x61fc36911a2e4e01, 0x1d3989c01a4865aa, 0x6729c2390314f3b6, 0x6dd9e61ffa04cb7a, 0x30a6c3029327779c, 0x5715bfe861bd7b9d, 0x27ccbbdf674b06a8, 0xbb7f7d43d1f426e4, 0x651b36a952a0b770
+, 0x28f7f3afe4ac3dcd, 0x08bacc7c4173e0a0, 0x4fcc5dc14f6ea730, 0x151619a8f274d38d, 0x255ee2d507406d36, 0x5f8f6a55cc91d6cd, 0xb3e6ff5507e5993c, 0x405739d426d27db9, 0xd6bafda016e46405, 0x3e3f2651f08a3500, 0x910abe78c1b1736f, 0x27017c2306dc40bd
+, 0x416ef43e7cda1b65, 0x62598f0a42264980, 0xc576d6f34de601f4, 0x78552be62a1b53ad, 0xe91f2413bd08e501, 0x0c72f3edec1f7db1, 0xbff0eaef46a948c5, 0x28ca533ef558a511, 0xbc7dd84e94c447da, 0x3ee430e7e9fa164b, 0xe3c2bbe92e4e6244, 0x067c99ac61699b7a
+, 0x194cf853e47c21fd, 0x353a556e38b60851, 0xa79b86278a40f16c, 0x67d22421e85fa75e, 0x51db0cc10f8d2cff, 0x33b54ee5ab5c5be1, 0xf7b624bfda781b6e, 0x07a78d461969681e, 0x5808f84d36e1a450, 0x24375f2dc37c97cb, 0x705ff23cdac59d4c, 0x561a64a14891ba0f
+, 0xe9e4fed90fd0b1a1, 0x4c12bdd5500ab831, 0xaa4c0517b7958f1b, 0x20207628ea274ac1, 0xc134b6292a3942eb, 0x13d9a6433f351c9d, 0xa73df198fd650673, 0x71e2929ce36278ca, 0xce828970fe2c6586, 0x27671ea329e0319e, 0xb3b4c3093cc0a664, 0x630edac59910d9f5
+, 0x24219742c04cb6dc, 0x233381c7c226bc7d, 0x4add966e3b885b47, 0x6cd40da914cfd98c, 0x7e29bae72bad44fd, 0x11963ec01b7d1c4e, 0x8d31eeff5bb84dfd, 0x37eb6482e9a6bb86, 0xb7f26735d8fbb14b, 0x5a987ad459bdacce, 0xcbe8450b0ff50563, 0x36ff147e3676f772
+, 0xa529059e24041db7, 0x0aa6f316cc4fe652, 0x095d314696b41da8, 0x7cd8f140813198d5, 0x3f26ed74ef5a395b, 0x0a47eb79a65de7c0, 0xc114a60f8e998694, 0x60593514d5fc726d, 0x5077935f4db9890c, 0x1a34aec258c680c7, 0xb132bc1d89e04b48, 0x71cbd9e5600a17a8
+, 0x117dfa3269716f2f, 0x172a45a505f86b6a, 0x7591d4d5ab36329f, 0x5e4b7256260ba810, 0xebdcdc723fbe61fd, 0x2a620959f1ab6bf5, 0x7dea761360b22da0, 0x7fa3efd8cb2061c3, 0xdc982125f9dd975d, 0x1574f25dd1451912, 0xb3eb5cc30de8faed, 0x4bf5e44c73e819eb
+, 0x229a8344b5b53390, 0x74cc42136fa9f0e8, 0x54f5d267a2b6708e, 0x048158fba2efa22d, 0xa512e3a2e5e076af, 0x00f3d7cd64b3417b, 0x5cc7c505108b31ad, 0x02292252d9ee99db, 0x94798ea82d3db6f4, 0x25214a43a14c862f, 0x325f95114bdb5ad7, 0x17fb3b5d2cad2436
+, 0xf359f663ba321c95, 0x51fb4ee54485793f, 0x45fa4f0cd6c50d52, 0x3f07ad5455006188, 0xbb7d8eecd8e4c610, 0x075d1f63d90adac3, 0xa252a7019def18c1, 0x56c125c41caf1e8f, 0x691fb1b199a3de51, 0x5f90d14c4c9ce8d7, 0xef94fa9beb7cb28a, 0x2197381db76e1756
+, 0x125f1fc5d91ec1a3, 0x3c3cf6e32ffeb826, 0x3a7d6fade3bf3afc, 0x7e8bdcb2dcf08983, 0x2a1c62fb841c3ab5, 0x716a44f08278885e, 0x2a5cecfc53b659a0, 0x55f107bfd46d151a, 0x45715eca238e7f49, 0x25be9d445a0b24ad, 0x8e88ec2cedc03a15, 0x2c57ffd7386c73d9
+, 0x40574f1f69191e98, 0x2328b53ea61b0d18, 0x122fb59f8af255b3, 0x024fb93de0b0f080, 0x1402d7bc48d9dc39, 0x0c75447c9e90beec, 0x433286c1b3ab9911, 0x43c3b890e4053c53, 0x55966c8b6e18c5e2, 0x465fe2ffb2bf6cbb, 0x9c36b48d646ce453, 0x0746915582aba138
+, 0xfdb997e967025141, 0x5be194d8f4c15bf8, 0x8b27565189adda85, 0x242b47e8a3a2d31a, 0x536c361345ca3ef7, 0x3fed6715f567de7b, 0xeff3596d3660c593, 0x7d988fa5f646152d, 0x223604bae6b7757b, 0x7adf8e63afa2d372, 0x2dad2d73a15d220c, 0x24e3b3f837cea0ca
+, 0x21637e82e3318972, 0x41552789f1a1dbea, 0xca763d9ac3653353, 0x284c3f49cdb64373, 0x355e816cd364bdf2, 0x1f43e6eaa6ec21a0, 0xd47aa41b46d84c78, 0x10244632ddefa880, 0xd9d63474ead1b25a, 0x1ed03ab17fa83092, 0x3e685db21d341ca0, 0x6593a7b271dced15
+, 0x99b61fd3557d1fe0, 0x3c859ca060f54b5a, 0x87c45bcc1a6ef86b, 0x14c6caeb32c051f6, 0x73992d7e1fc8b731, 0x4e29d6862a1b4d31, 0xf453f733dbefa93c, 0x43eae8b7e7137302, 0xfd65d340ec0b37fb, 0x1f8b273c00fb0ced, 0xd8125c707b6aae56, 0x36ddecfc0e826cec
+, 0x63bd820e7687a010, 0x13dd04f126b64be4, 0xc1e8567ec3a73ef1, 0x30eea62e444d10ed, 0xacbf7df23d74e858, 0x5f4b205d3313f779, 0xfb124161674f4932, 0x7cc85dd0829052f0, 0x501d21ebb91cbdaf, 0x2466ea1e2d0ef96b, 0x41f48848812cdb90, 0x3945a6dbc9054fe1
+, 0x38026d396a5791de, 0x2746682c18bf3b78, 0xe205a7a3d8378b63, 0x1d07790f39f16141, 0x2455b81c7beeb81d, 0x1836536874d9f474, 0x4927a1c09abf68f6, 0x3338e757f7d65a62, 0x620f359dc37cf16b, 0x400a40ddba2116ef, 0x50245d128c824915, 0x26af13055c13abcd
+, 0xa7ebd26ae30ad0d1, 0x6d3576ee39133056, 0x11f78a6136ed75a9, 0x46cf32e0cd535518, 0x889c0ecaf9893976, 0x44f9b4da7a4d4786, 0x406d920b0676e50c, 0x4c690bb8335de85e, 0x4c31d6b5918001c5, 0x06a21d2856262b65, 0x977d412511b8354d, 0x4c505b675549f390
+, 0xe7ea23784bd549ee, 0x15474330c192085b, 0x814515d1bcb2948e, 0x6f2fffdc72b425fe, 0xdd1731ccec46a891, 0x63c0c23ba0bfa09e, 0xe165606a7777a608, 0x36f8005287304848, 0xb1c3afe7af65165d, 0x5262abbd018c28e2, 0xb7417e5ed9871b41, 0x59c2a27750a9f2c4
+, 0xfe9a1decc5d2d788, 0x4d2a435e9db2ff21, 0xd0b212eab7085b10, 0x11e984d25f318978, 0xdb5505a8883d3381, 0x244e71da02aa67b2, 0x5c493e567fa2f26b, 0x5f9d6c97bff8cdd0, 0x7f4b6c51b2c31041, 0x7cd4a6138f911897, 0x367111edcd347f39, 0x1d6db6c280c5073d
+, 0xe67b68f7d52c9b67, 0x59bbeb8297285959, 0x8430d088a970fd91, 0x590798d6ecd182a7, 0x2647302e0db34d81, 0x52d4c97c63218b1a, 0xf5dc3c06fef3e96d, 0x2a1ecd471f2188ae, 0xf6bdba1e843b9683, 0x3b44ec918a2f531a, 0xf67c06f68a40c942, 0x271ba415614c03e8
+, 0x963bf6873a8391a9, 0x680127851dc25a11, 0x6518e4992bf2ff3d, 0x32b3b29ce7b8cf2d, 0x0be65d917185ed16, 0x2fe53a0d3e14edda, 0xb72a1554a8d90337, 0x68cdf400072b3c62, 0x95db4430d39a2240, 0x6a9bacff305e2163, 0x82780fc8ec0fad42, 0x6cef220dcbc7adbe
+, 0x20785690f9b95144, 0x2d319141738f1dbf, 0x889d86fe3ebdd594, 0x5742991af3e07691, 0x9792ef69108a31d6, 0x76b6d17eb801de43, 0xef4dee0b2312950a, 0x1a4374981c7bf005, 0x013a45a4b7176cda, 0x7790bf265863eabf, 0x48e5f9b0148caf84, 0x76c7d7a346bda58d
+, 0x94e03085dca245b8, 0x4409b929fc43955b, 0x2df3eb68f40678b7, 0x5438674af611c6b6, 0xbd9bbf079f4a38f7, 0x26b57b29bea5aba0, 0xc6bf49f35c202bbe, 0x5fd0fc28e1608762, 0x303edefba1e9c378, 0x6e71b3693b5914a7, 0xded16ec8bd462665, 0x2f7a555275c6c9de
+, 0x9c24b7ab49588ecc, 0x7774dd14c0039d17, 0x464cb3e2fe5e92ae, 0x2b530e86e61fc739, 0x72bc7266f456ea8d, 0x369e31fb2b3510c5, 0x81e79596e3c32140, 0x399158c514908af0, 0x80b01e13e13e0cee, 0x3533b22d024ebaaa, 0x81b5b00e1284f329, 0x45357545bcc23750
+, 0x5ab0e7c3a45ea60c, 0x576ce10840fe9b6d, 0x50fe1d45c43d4add, 0x40b4777a80839b54, 0x17b6a7938cbc8e37, 0x1343bbee23ae9ade, 0xb2618102f6815903, 0x7919a73501f5e59c, 0xd097813588c33b53, 0x12329e2ecfffa8f0, 0xd8328da22fbcf5a6, 0x23a067864ece3e5a
+, 0x44955b062a6ecded, 0x7791feea9015f170, 0x736bf603d12fc35a, 0x2632adbca5388026, 0x956e4c48e1697c4f, 0x4ee9adfe8600e32d, 0xa584042a0da56406, 0x34a3d7f4bf457353, 0x8d4fd4fe00176fab, 0x15321ee855941f4e, 0x670701ef81f340a4, 0x0c7d7c618aed0ba8
+, 0x73283131d9bfd9d6, 0x34935a39e31bac65, 0x466cfbbcaae8b991, 0x250dd54e18478ac6, 0x659e46c51e40de4f, 0x618ea014fec50e04, 0xfe64d883080b877c, 0x572cabbb6688c4f7, 0xa2c817493a834146, 0x06cd734876378120, 0xe3de0b717336a849, 0x36942f5191db53c4
+, 0xa3f9adf66abf4d88, 0x2a9a144b8087fa96, 0xfe49fefcb78a5b4f, 0x1be40a8616928bab, 0x07a901975521f7aa, 0x1fc66ea683693510, 0x4dbf0084ba42380e, 0x1f374495b918c737, 0xb8346956a380a00a, 0x1346f4766fcdaa07, 0xb4db5689d46312c1, 0x775e7f3274dc1316
+, 0x07898828f32341c0, 0x144390a33b3e86df, 0x70bc604ce1e9c5e4, 0x127652de00220873, 0x2874bc669df50d45, 0x236f4585150161f4, 0x3bfa4ffd318214e2, 0x7cc92a6165059745, 0x2fae0e92090ef72a, 0x26676bd59c4fcc3b, 0x220c030974d1d447, 0x66455887e98686e7
+, 0x4164b8e4d8760ddc, 0x5517a86f840feb63, 0xd9b42c6c9371cade, 0x3a7f03ceecc160b9, 0xdd4086d64cae366c, 0x1b6290c327842533, 0x144efcd2a7a0e82b, 0x16621925ca10d31e, 0xa9dcd13118e208f1, 0x5a90f97edcb1c54e, 0x80c47331c8749d99, 0x6f061a3569a80b55
+, 0x0f6abf619e2a15c5, 0x29106c98122245f4, 0x5860b10985c9b47f, 0x4f379a379e15f410, 0x2dd6f45df68e1678, 0x2c475167ad9b283c, 0x23b7aa00952a6a3a, 0x5532bc26a40c5365, 0xa5c0a8be3596ce22, 0x4fa3127a9aefa56f, 0x944e843aa973e67f, 0x3c7727d45ae87854
+, 0x48fa2ce675117ea4, 0x7bca8e04ad3bbb9c, 0xd57439e4726f88e5, 0x3337d3a6a03b2286, 0xb0b6172902005953, 0x514bd76734e6c0a1, 0xf97f8934eed7c6b4, 0x0abe13cee7f1b75e, 0x6c88107a120e54a7, 0x634f966d7a6e11df, 0x5044c53109b94097, 0x68d49fc65522b73a
+, 0x69e295cd8c444666, 0x542c4c5fd999a224, 0x13ff89418b5da76f, 0x7133fa786a87ecb4, 0x2f180926456402b4, 0x52ddada7931c4dcc, 0x6eaf0d2130c71590, 0x014ec2a2ec231826, 0xac05b61443b34dd6, 0x157acbfab118b219, 0xe4e2f4b84ad01099, 0x0abf4a4da29a0eb8
+, 0x5f852b85b59eab1f, 0x1bd259c4726869ed, 0xce565d9287790a15, 0x17a48442bcf58a00, 0x01e519522381363b, 0x2336d07a710da07a, 0xcfebf2fbdc714cb2, 0x2f7a51474c23b8a9, 0x77db2a07d4e3716c, 0x40e8d8d2d0a09806, 0x644363ce6d401ae4, 0x53f9cae0470172fd
+, 0x58d96ecd8ddadc53, 0x15028204f3d6d696, 0x6f40a09214439ce2, 0x738c5371236c3e56, 0x64f87ee7a28bf9fc, 0x4f1899449a810fee, 0xd0aa95f4bf21e376, 0x6170cc24283856bc, 0x9dfc4927d764ff75, 0x227ea1563fa2e012, 0xaddd3665622ce087, 0x473d3bea07a5285e
+, 0xc0b986ee0d2b0eb2, 0x78e584c740dd18ed, 0xd5adbf30a04fd508, 0x1c6aed5ab59bedbb, 0x25d05fccbddb5ba1, 0x4a58fb6b3f896319, 0xdb2f6343fd8144fa, 0x46a445de6d5b07e5, 0xf67a06684fe9e1da, 0x57b2515923b15c9f, 0x50439940820a2a0c, 0x62f4b9b26f04dab5
+, 0xe79ea601d01b033d, 0x009bc6176f10fffb, 0x333bff2f907ed39a, 0x253d0a9e626dd400, 0x7a9bbedcfcbef06a, 0x2d1b6a7a5b39342d, 0xbadfb462a124cc9a, 0x2e8cde9d82c15cb0, 0x7c3f81bcd6f1b2a1, 0x04cb0b8fa4075294, 0xfa36d3db38cbd304, 0x59fef93442883553
+, 0x91982a741cb9342e, 0x7b9d63ac17b01982, 0x530b4ec25a293ece, 0x611069ad9fa0f0a4, 0x7a262a59b656a79d, 0x6fe6f8f4d6d015b0, 0x2c2fd7641a5d4e50, 0x24b0c507058c911c, 0x834882e492fe45ae, 0x68d0b01b13432761, 0x0eacaaaf94178b8c, 0x123e3a93006d7d01
+, 0xecf2fe69377ff33c, 0x4fc960ab4408584b, 0x2adc445b1ee45654, 0x4989681cd1d09a93, 0x79509599afe9e3b6, 0x7f6ffbbeee861c15, 0x2ed2859fd6391b25, 0x5e8bd52289b6ad27, 0xc949280adbce7c79, 0x510999e865f0cd54, 0x7f957314ce7d373b, 0x4b2c0ea4bab08ef2
+, 0x2d7cc08b5c05a8db, 0x4609a0ea23507697, 0xe204ba35182c55b8, 0x5e4d5903fdef61e6, 0xfe63842f2826598b, 0x782a3fd3ab62a179, 0xd2f01a1979e5a0f3, 0x0fb4c6bdd637fba2, 0xfbff4c192020c350, 0x14859008c3d223c0, 0x65ed7a889c1a2e55, 0x1d78daf483fa12cb
+, 0x5b54d11b01bc09ca, 0x54fde75737306515, 0x89725231105b63a7, 0x712d1f394adcda99, 0xb554006ee9abefab, 0x04dd8f7bbd4c5381, 0x98d22b3a31995549, 0x637a53de6b57122f, 0x8367d69b4c92da63, 0x236f2a9514250df6, 0xb265509af63d7b7c, 0x08522e36bc4b65f8
+, 0xabae725012ce8301, 0x493b257197a98ce9, 0x33185838570e5f0a, 0x65f5477ac414eb6c, 0xd002a36854699753, 0x2be693b4d96efdb3, 0x3b32484119bdc53d, 0x55691ac09a8fae1e, 0x0249e394514c047f, 0x765674c90b78171f, 0x1166f64638d6ab37, 0x746adba4cb52d18f
+, 0x93e293653dda6cda, 0x5d004ed52ebf0b68, 0x65c7c42d0ad96cc2, 0x3350dbe11cafca74, 0xc638cfa8942fef67, 0x0ff2dfffc5ac1164, 0x9e1b625e649aa471, 0x13a219d03d2eb86d, 0xdb92859ebaf9f7f9, 0x645c50918f7d5abc, 0x25c10cfe99f7e5c6, 0x13d858b53f90170d
+, 0xddb258b13ab1e7a6, 0x4849ff49f4e13fc4, 0x9ef87fa85511cda8, 0x48c50d4d3b4d2f7a, 0x6c98422c8007c9ac, 0x3fdd72e65a3d3491, 0x56b18cb165b4ec3b, 0x6e2c6df9e3fc3daa, 0xf6db5aa98ddc97a4, 0x423fd4082f3fb795, 0x42f8f5edf424d0a0, 0x1a091c2696139936
+, 0x3161c2bbb3b2d58a, 0x2e8d339eb0fb9099, 0x45ef7d11f6fab685, 0x7f222a068db3da4b, 0x9af96f9742549a7c, 0x55370df31dcec81c, 0xde98e81b131af02e, 0x58bd0622a474acee, 0x8ab40fa7ca882e0d, 0x5b4db195655f2410, 0x4754eb479ada77fd, 0x67a8a437d6fc8a7d
+, 0x9888254a4f0c9d58, 0x3232ba83bed0c618, 0x587b0de0207b57d9, 0x020df6becb096aa7, 0xef9e41052a29a8ab, 0x4ae671ee70a15a69, 0x167ce954923ee086, 0x6878c3996c1de887, 0xb29c711490ac097e, 0x1cf41a9c2577d144, 0x0590796ba46d8d29, 0x1c2e6dc8d4aebb65
+, 0xbfb904f8ac9b4cb9, 0x4ea1742c786469e7, 0x5a422f48401be57d, 0x0be0afdc77d6d32f, 0x5e8765cba2c738d3, 0x7dad0475059a089d, 0x9288ae0c40df7df6, 0x51c65f97715a16d5, 0xa9615d4c786ff9d4, 0x507ffe03ec0189ef, 0x1c1f46684604e41f, 0x282fe9d567db0efc
+, 0xebee7f8381fb8178, 0x5bd4b6045c208d57, 0xf35694743439ed71, 0x7cddd5a373ebc5ec, 0xa58df33cc68e3b5f, 0x40e6714f5c5c8df3, 0xea881d4bfd489131, 0x6b36400b491c28c1, 0xd4475cf594b6303b, 0x5b630cddc72e654a, 0xa0b587ad34394ce3, 0x3ea3ba6014f86275
+, 0xc3deac125d20eeee, 0x2ef3568410a2b3bb, 0xee6ba3fac5d7ec00, 0x5fabcb3337aaa23c, 0x6b1212e7b817889a, 0x0b37d285a9be51d1, 0x617ca543d762bf51, 0x0896b4ca694b01d0, 0xe3add9718277a1fb, 0x553dee7dd4784865, 0x904b8f7e936cf430, 0x5b6a78f20b244b90
+, 0xa2b876c2914b9bfa, 0x704de952e9d969f4, 0xb04ea1b54b7e7654, 0x5d307bb3949cf660, 0xcee4c23ebd049d17, 0x7a88293bb1031063, 0x00b8432b8286f656, 0x260a9c86a16216e5, 0xd140e6e6629d8686, 0x296011ff5601a000, 0x536f0f76cd9b2928, 0x267409c23a823dd4
+, 0x0f041043797f8423, 0x3da6102605962ca9, 0x2e69dfeea02098ea, 0x427e7eeeecd3a0c5, 0x75efa5e8a590793d, 0x1f5841df6dfdfc91, 0x1aa1e1b8b9f3c326, 0x07bd5b0983fcee91, 0xd169420be9c48939, 0x7940334f0bb9023d, 0x9bb330fff113764f, 0x674ff1b0cfe246c7
+, 0xe2083f8d7129cbab, 0x7e6223e3d9c04904, 0x9be411a7d5e883a3, 0x72642664e7c25590, 0xbb1f783b5c412322, 0x46716e8fd737280b, 0xfa363eeaeffde271, 0x6c256c131fc2c3b9, 0x13259abfcb2ce1d8, 0x53b96556e96aa708, 0xfaa7c8d25119da19, 0x05019f438e9f8995
+, 0x05e1d55a9424f1ee, 0x63e8e14e6c2f3f09, 0xe9d844e997a10158, 0x51904ed1e94a0ca5, 0xb09462d4df6bc6cc, 0x2ee5308e62172691, 0x3f8438484547187a, 0x62b92b8d9739ddd4, 0x3ca54ab5d39f083c, 0x25b3336048a288d4, 0x7cab0fd67e296979, 0x58ba2e783962cbb7
+, 0x77808f1a1b8f3515, 0x290c219ee7153bdd, 0x7584441f79128f01, 0x0442db406f5135e3, 0xe741de52ec030a9d, 0x37469756586776b2, 0xbd64c2a7173adde0, 0x2280b66d20888d0c, 0xdd1b53cb4adb0fb2, 0x3974964394c445be, 0x53b6a95e7c7fdd97, 0x6eacdc6f50496d95
+, 0x178d04c0578a5bb3, 0x0d171a5f5215c9c8, 0xfe0d0171c504962e, 0x04eece54b220495e, 0xac4d145001db67aa, 0x6577c466962160af, 0xcddae62d99686ad7, 0x7a053a048d230d89, 0x1ff09aa0e605a880, 0x5d260426f355232f, 0xfbdaf7b0b53aab89, 0x5eef31b9eb0df78c
+, 0xfb787e56b7276288, 0x4dcccba87d630d06, 0x415e4a4bc0a44b01, 0x0f0a981f71d8ae33, 0xe0ebb786f98a1502, 0x0ea4aa3ce70dc628, 0x8d36240617ebe037, 0x2d20c0e1d2002b5b, 0x336f8aa411a30282, 0x1d87c67d8178ec4c, 0xe468dff8ac26b63b, 0x266086bd7f11c9bc
+, 0x05cfeedc80d829f8, 0x146902a029dd3355, 0x413db9327c068394, 0x55fa413791f64c38, 0xe06395c10021bf9d, 0x18d66268cf79ce45, 0x9e7ae6858dcc21bf, 0x3ad51dbe97b558f7, 0x06792c747aeef43c, 0x27ec9b782170abb7, 0x6aafca394a23e935, 0x18f7cbd98db64112
+, 0x34146ce6b36edbfa, 0x1dcfb4eab7ccea23, 0x68498e1f45b35467, 0x1b20d71a3b71d412, 0x7a875fc94e602e3e, 0x78c15fa449576c2b, 0xb52326d01ccafe8a, 0x3f53f57324d70666, 0x3830836e39bcebaa, 0x27a30c73dd02c884, 0x5dfed73dedf2306f, 0x75ee4a8b6cf54f74
+, 0x97ecc9c5851a8e3e, 0x496b581690c3df2d, 0xf7bba1fe2d169e7d, 0x4b06184810a77bd3, 0x40e6d643b903c7bd, 0x3c90f63b5176906d, 0x92f47e1ac51f1ec6, 0x70c2454c53cc0dcf, 0xb5a75d246c653b4e, 0x7e5173a420a8b0df, 0xcafb44c471d0f4a3, 0x69a3a4e92bbe5977
+, 0x26e93183cdfeb424, 0x1e0489b56fa7e130, 0x669befa672fe9979, 0x0f8aea6a7ef65bf9, 0xff0b883ea96b51ff, 0x31a668763c3c8867, 0x6887a0029701c9be, 0x545644cd70c87d63, 0x537b6fb7db9410e0, 0x6ca227f10229b3b9, 0xc7d1b4d71ff22468, 0x522058d3b20569f9
+, 0x5f4bfd813a51fb62, 0x105b94a3a42424a1, 0x96dfdb685825857b, 0x14d98588154500bf, 0xb4db83514c7a9404, 0x67aaf998856faf37, 0x1229d7e95dbc821c, 0x7e617a17a2f72bd3, 0xe964cdba7222695a, 0x677619cc40a07eaf, 0x7f82c099a8df7538, 0x2a219175ec95a1ad
+, 0x755ac147b51ff3dc, 0x4a87f652f86823ec, 0x6d8d4a923f50278d, 0x4bb952ac98c0120a, 0x968c57a6a31e482c, 0x0855a11481fd5653, 0x3f05db6ac608d16d, 0x33f9e5746e1079c6, 0x1f3458e3ec51f53a, 0x4ae3fc836ceccf81, 0x3c0b2e2db5875ddf, 0x42336a1262cbb5e0
+, 0xe3651453cadc3868, 0x25081cfd6e80a2de, 0xd4cb31092872e53a, 0x16ca9349a11a9c37, 0xb1d3ae440d1cb675, 0x41b2d6ecbccbd6a4, 0x475e6a844c3d0ca1, 0x2cd0e0dedbf07023, 0x85ad446ddb002a6e, 0x72a06e5419a64609, 0x9e779387e9a3276c, 0x414a8163a9408b10
+, 0x25c7b53c1791333e, 0x3ea57190b42cd838, 0xbf20b346b094f121, 0x47570cba99b06c9d, 0xe6bd01c8746cb5f2, 0x3c0b0b8c4c0968ef, 0xb22009690e243975, 0x251737e4a5643da2, 0x3cdd49123ab89dea, 0x68748cd1e3cc45a6, 0x563746685effea7b, 0x4e4c5b1c86eb3a29
+, 0xe1ba017516d32070, 0x5cdd35a0c4ba93a3, 0xdbc66a0c7de30288, 0x22107156a0f700f1, 0x0fb69045aac0f647, 0x111dcb9763d08bc0, 0x266db39f6d78cced, 0x02a32587c7033892, 0x76fc94ce6a2a4b19, 0x474db0f12fcfa96f, 0x0c44584c08377ac7, 0x5f435bf43140f4c0
+, 0xb9741c3014eef7a3, 0x54596c23b536ff04, 0xeadf56bb6ea39450, 0x32f24f6e1a656b10, 0x21422e4dd5f54e3f, 0x0d6ad57853660607, 0xf6f62ffdd0bf9928, 0x72569c930015caa7, 0xf4293579931b9216, 0x049d6a4057e6827e, 0x6223e20060be0e05, 0x20d91ae969dfa9a4
+, 0x02611b345456d47a, 0x601dd413d1bdea0f, 0xe6b017b26bbc9bf8, 0x63399ff3d6542359, 0xdbdfe225045a9764, 0x10acd93346649beb, 0xc652d5a50e0535ce, 0x49efbd5639c4caf1, 0x65a5dbd8a304de65, 0x08ddebed0e865be8, 0x5db8337d5e715261, 0x34cf4c75496807e2
+, 0xd840c7416e44b56a, 0x10fd30d282d8b151, 0x36ffe6df2c1c9568, 0x66d8a38b6d31a2b1, 0x01fad3aa61984774, 0x412a9fd87b303d90, 0x2720945ee0f0ec9e, 0x0c91b4c7ea84cf37, 0x98462f25fd5832f0, 0x6f4cd578c490d842, 0xecc7d24c31ed3342, 0x580ab96994515fd8
+, 0x6d8a97ed98465b3e, 0x16995dc010908ae3, 0x50626a4e555b774a, 0x082636e5a8a9b568, 0xa99435cc4823b413, 0x41fc423d10eff4e7, 0x114236dce6f9f9dd, 0x6c3995c4bbe0aadc, 0xf3f22c975935753d, 0x6b1b3f27edec2a78, 0xdbadaac32ccc292e, 0x3856036f8a3795aa
+, 0x947154caaec01d73, 0x0a22e573e3f0f49b, 0xc50c949f39c184a3, 0x2aadd0868535d0c8, 0x22bc5bbe5f992446, 0x15d36adfca3ace90, 0x038010e37a6308f9, 0x161b06d8d7180307, 0xcfbf4e3abef8d056, 0x2a1765fe9c7696ba, 0x6a15d44ce18ef392, 0x5405239c0369de64
+, 0x5fabda1210f58e29, 0x40cbb03974b37035, 0xa29fdf2875322520, 0x3b32ace85edac547, 0x0f0c92b41d679df8, 0x7f07ecd47a7d2f0c, 0xb5fc65c05accc95a, 0x0e8b1da70636f221, 0xb2ebd131f4e8a846, 0x7df51e4aba57f391, 0xaa2f3d40fef689ed, 0x0ee1e115fde5d582
+, 0xf7d025b42e240ae6, 0x29fc1befeb526af2, 0x7c5ffcaff205e565, 0x4cf4d0d8840e2e1e, 0xb8b00d1810ad0ff6, 0x44d3af686ba915ff, 0x86a8fd1eeea8d08c, 0x3eb300adcf6edc4f, 0x8db03c266b588186, 0x289d0fd301e96881, 0xba83ba260cccc170, 0x26ee69546ceb0c77
+, 0x1109d8bf92c4ea05, 0x033aa036671937d1, 0x4bd9902e5a664a0b, 0x42bd48ed44fdbb71, 0x7359e19357a9622d, 0x0d6ee92855dae22f, 0xc24debb323643859, 0x4c60fee1e191766e, 0x3beaec0e99faa328, 0x056c2ae1709c5b0a, 0x7fe89e0c62710909, 0x7e3b5cd3ac4e6ce1
+, 0xe9d06486ac7370a4, 0x4b1a8c62e99f9429, 0xb11a50e20bc3197f, 0x75ec513c25dac300, 0xfb9fd064b1466dca, 0x290379cfce59308c, 0xca3ee3fb7db99943, 0x2af7a3e930faea44, 0x0d294e6d1505e35b, 0x7d534585181e001f, 0x90285700831d4cfe, 0x419f25105d06c90e
+, 0x5f71e79f5f828172, 0x02921e2a43326798, 0xa0981553e84d4a6a, 0x220c82041938573d, 0xfd2b5b78ef20c927, 0x3c99a2dc611caddb, 0xfb1247fd99ed2828, 0x4b3a3739f724890c, 0x7775ea2d7d2d1017, 0x3ab07cb5ba8ac987, 0x82e5123a20a6b5c3, 0x44965098aa82161f
+, 0x20948c77e9ac4c0c, 0x521e934ab214157d, 0xc8f4f4052dffedab, 0x1da963c2ef46f27f, 0x3be7631e212fa2e0, 0x0d188e88d1a4184e, 0xb4483ed385de4bae, 0x4ffadfde83d2b0d9, 0xacebd9a51a938608, 0x40968c0c9302b0e8, 0x85704404d06f3a5d, 0x3e9f477a61a26d37
+, 0x1da1efc7cbd18d12, 0x4fb87a47b9f2cb04, 0x7556a45e8b5c8caf, 0x7f6991b7723b35cc, 0x3fa10a169532635f, 0x15e61b1cd72bd52f, 0xe6b45dc3b4667c21, 0x45cf3bd4bbf39baf, 0x7343b0636a9d63f9, 0x457551c49ac49567, 0x331e611a3fcec018, 0x7d19e2584756b92d
+, 0x78951df174059655, 0x0573cd896a793337, 0xb3e37121fd458870, 0x3cc032b1a1bebc3c, 0x2571dd06d24d5a41, 0x017382ec4aa29ffa, 0x6cda850c15a224ed, 0x6af59bee2d7586d4, 0x287d3c4027f80ee9, 0x6aa570b9e51d4f25, 0xf29f327c5e0490d5, 0x00fb62f93f43edfb
+, 0x7b06e602dc313277, 0x5d8dc98e723b039e, 0x5bb61813041a589a, 0x2a4c9f13eef7f1ec, 0x9439edcb4bbaba6f, 0x027f4d494e7784ad, 0x087ae2a2fd6bbc8d, 0x230f37ba41aec2ff, 0x63876e43daaac09c, 0x28abd7ae6e17dbe3, 0xd354d50cf000982a, 0x1dd774a1273aea75
+, 0x243658930d4b0902, 0x0df50723a2da63d7, 0x22bc07b9ac9628c5, 0x134123d68aa939cc, 0x4e84ee2cf0d450e2, 0x53a8c6dbd4aa9ed1, 0xd06e741c45610565, 0x608da7f96f2f7e19, 0x59b7fc9fe6a0243c, 0x0da36bb46fd1eb3d, 0x09a11de836914182, 0x3becc1cc0b96f1e4
+, 0x820b8a4cad71c17f, 0x2a425dd0204a843c, 0xf6f7fdaae1523c28, 0x5fb74c0c961e6fb1, 0x0c76e0f72b7845a2, 0x273db117946ce778, 0x7a22d35cdea5934f, 0x73aeeb1b24265d5d, 0x938a618552e4392d, 0x6050215beb6c1923, 0xf32f6ab781efbf2f, 0x2e4ece5c476e1354
+, 0xf2a4a59613812356, 0x555185da018933fd, 0x2fffbf95863bce54, 0x72644f9c3181e7a6, 0x98c6b1d509e3d624, 0x5bddd5730939d7d0, 0xdd197613d550fbad, 0x7671fafa1facb923, 0x13dbb61148c5b802, 0x616bc5c73ccdc3bd, 0x0b175b4c46fd8871, 0x498a1eeb000ab870
+, 0xa49f1ca2d7802521, 0x6906346cce00be5a, 0xf1bc33c727dd52b0, 0x5d005ff3122fd749, 0x51318ad5d7c622e7, 0x50f93d6d15e46e82, 0x88dfa2123ffff3b9, 0x3848e6fce3cac6e5, 0x6cefc31a33ea4f5e, 0x0cc5e7dc4e5e144f, 0xee2009402e59a7e2, 0x257679fdb86f4712
+, 0x4cf68953d8b17e83, 0x710f970c16ce2070, 0x4000b8e9e51e6aad, 0x5af48dacd01f24f6, 0x209679d5d3fcc916, 0x0a3538dd7cbe8232, 0x2d6d7aba44d990d2, 0x46c718f2d4b2c1a6, 0x9953d799a378233c, 0x4f4e80f4a682e7a0, 0x9912f04acbb77eee, 0x317432079a195b2d
+, 0xaccccda6a1c11e3b, 0x3fd895817d0f3be2, 0x016db17673f750ea, 0x635fc619a24009b6, 0xb8447ab3370da1e7, 0x6c893aa19abf4221, 0x5f35ac703d8508d0, 0x13533d324d4adcb5, 0x84610370dece8512, 0x2223f126f9a70f4b, 0x18f00d60f3bf6a04, 0x174bd78b20ef8543
+, 0xeb179bc6a1698189, 0x732bf44a62015302, 0x98352342bc0e4bc6, 0x053f6640c1549e85, 0x65eee8b0397c7ce8, 0x790451f39f2fa27b, 0x36ffa0cb286cdb97, 0x46d07cec4c967bf2, 0x7c849ace30868412, 0x6dee239d339ef499, 0x8ab78548f273e57f, 0x01c5bebd8b7f5ef0
+, 0xe440e5f042eae93b, 0x65583f57fe057db6, 0xe6d5d26c24a565c9, 0x6b3b87a0a6ad702f, 0xd3f5d533117b8e64, 0x4addb9d0da92df89, 0xf1bd51990e0f9bfa, 0x30c624ec1dbcd0a4, 0xafaf2f00da7023a0, 0x3086e132b54574e4, 0x93bdbd4bfd3dd8c7, 0x690976ee132c892e
+, 0x86fc11c79524d198, 0x0f6b95662e02c734, 0x5b78bb385564f568, 0x55c9b3f55d7cd16b, 0xdf1316434ad1c07f, 0x093d67d3fdf312de, 0xa1fd2257ea57b3d6, 0x4b5b18abe4b54439, 0x66c28f5b59d796b2, 0x7baffe6e642fdea4, 0xb9d3753265e68ae4, 0x40903bd6dfb02d6f
+, 0x357958d4d72d6bc8, 0x179330dea4659dd3, 0x5a9ca85bc8721aef, 0x0209f09e03c9b225, 0xc0bf2e9738933495, 0x5e0dde4d715e50c5, 0x2743c96b66a6b951, 0x6af96188a0d6d358, 0xb2f3c72820f2a709, 0x5e9b8fd43327d9a0, 0xf0b13f5324012177, 0x7abdeaf4f741bace
+, 0x8e71f809c25204fe, 0x2ebb7b37d53ce671, 0x85117544f57e7142, 0x6b01295558ed3194, 0xb90518b25e20b15b, 0x4f72fa4b2206b35b, 0xa6602df22a663970, 0x78f110bf96701863, 0x1d9acecaf584f47d, 0x37ec8b293bbf2c26, 0xc89c96d1ba00d299, 0x027e7781c561153b
+, 0x66c5cfa9a1a9cd56, 0x7e13896c49e82652, 0x0d1460afb01a079f, 0x61cc409eec223565, 0x8dd12ab6e6fe042c, 0x526d8500bd504572, 0x1f013bce59e6b0c6, 0x6e534b5bef2d7649, 0xafab37aada602d46, 0x2dd66007052f56fc, 0x6ebfbebe82fb8a28, 0x2705bffa6f07b812
+, 0xce43976f5cd071cc, 0x17b2b48b1114283e, 0x5c5d694e10832c01, 0x38d73eaa3d389994, 0xcbfd7c6888529921, 0x3453da778a079eb3, 0x96bd234cb6ff0d05, 0x7d60e249da086be9, 0x9f82a6e305d8b42f, 0x4870861f46d686d4, 0x3e1faa1ac08b6aae, 0x3d05063bf1506a4f
+, 0x2a5e85a5c9502826, 0x2fa6e1efb48a7e40, 0x785524bd06117bec, 0x27045e44a71da6e8, 0x6e46490f768002dc, 0x5053040141dd4b96, 0x58063025d2d7c242, 0x2db4016be15167dc, 0x9eeba12779f58415, 0x1d809b0b57cf83e3, 0x61e520f2a4aacfb6, 0x208baef99ce836e2
+, 0xe2c10f0c33c3dd8e, 0x7d4fba6d1bb13908, 0xbcb44038069d9d3d, 0x3ab330362e680370, 0x53c08d994364d08d, 0x4cc00675b64c9328, 0x7c55f2417c60bd78, 0x7a076b37e98a7c57, 0x32a3943b5ddc41c1, 0x6b6b6d4805ad777f, 0xed4e6eacbcc5b86c, 0x545dfa661d921daa
+, 0xfac3b6fa9e45bcde, 0x7067d31e3606d834, 0x62e2f77c0c388a90, 0x1f8c4a45e268e15a, 0x8c235a561aaf8a71, 0x16d723d1e55efb48, 0x35fcdc096f8d2b93, 0x0e02ee35957feb94, 0xc4e9cb0c94e099d0, 0x6c82d2e9ef85d831, 0xbb449d1009abe03b, 0x65ae8419015276c5
+, 0x17ab5e5e9a506958, 0x01012f23fd36be0a, 0x71176db8e2ab8489, 0x5600051493730cbe, 0x6e2a8eceab8d9760, 0x5d1ca824756a40ea, 0xe65eef8bba6d95aa, 0x070fe6a4b2b99f31, 0xca87dc46a751dc00, 0x5cf8215977c03f9c, 0x2797ed152c82f3fd, 0x282c220d30b615d8
+, 0xc60d848380ef85b4, 0x466ff34cbc86a6f4, 0xdfd432c782c3003d, 0x3ed47a346efb1fa0, 0xb4ee56fee7636246, 0x71d7f76274c37839, 0x29fb6b5cd5d5645c, 0x1e8d49e9caf17e92, 0xa151c4ca4a2def2d, 0x651cf415587b245d, 0x539001acefaed426, 0x5fcf24ac44d1d78e
+, 0x74506f6fea5366ec, 0x0921d3a4b9b45ce3, 0x7bd958e7da9e021a, 0x5f79f6992c9224fb, 0xe790c1d3d439a24c, 0x624b31764efe3109, 0x2e9eb4234277a43e, 0x3815dfac4a74d61b, 0xa1768fa657b8a19d, 0x5451c4f3aadbd37f, 0xd4528af5e89f1483, 0x65c261d5cc9ce1e7
+, 0x8b1c97d39350cec2, 0x1e76f1cea5ec5035, 0x9bab43055e804783, 0x359d4e0ca3199be7, 0x78a2fb95b2321b04, 0x5be854f1f154e9a5, 0x8e5ad7920df0ca78, 0x4b84f514742b0b09, 0x981cc0adb06d0271, 0x4f4899a450a6f3ba, 0xa6c6329f318c1c77, 0x25317e4ab64c3867
+, 0x04541cf9aae38d31, 0x5149a79605f45a3a, 0x17d92d53439258f2, 0x29af42a557785718, 0x6c2c8121783c0137, 0x26b60a3eecb829b3, 0xbc900c3f94e19b78, 0x6a97e016957065ec, 0x8ff24ae2d5b10530, 0x1364872a089b6a8e, 0xeea7d96119b9faa1, 0x30add8d65f8a78fd
+, 0xc32e58e6c806d47a, 0x77103ea8c25e5a0c, 0x215e7d71ff63b7a8, 0x43323e9bf4cfbedc, 0x7cb89121cbceee75, 0x1acb18f16672ca0b, 0x17fe6fa1257d384b, 0x7ba64d3237ffb371, 0x3e6f197915be4458, 0x306e70df9f1f822f, 0x636d6f7d8fb977fd, 0x20be889a01c70b81
+, 0xc965fde4466225b5, 0x12080e91dae60580, 0x02c2ef338c535cf5, 0x0d2c10ba384f9a17, 0xca918accebfa9e22, 0x5923fcb5c79602b5, 0xf3b03f68686c07c7, 0x789523300aeea7a8, 0xd3b4724e163a5154, 0x354a2aea1811d8be, 0x2216c66bbcb3c5d3, 0x6d225be19e60baa3
+, 0xdffbba980494d2c5, 0x3b3a15134a3b6d28, 0x82d094f5fb6b2749, 0x7fcb7d84f7689b32, 0xb5d7cb569bd9effa, 0x6a3c542b3ea43496, 0x6df6fa1fea2392a4, 0x4415993164dec901, 0xa15ce34a5cf3e84b, 0x5adf7eec0ed80c61, 0xe62a93c1855cb291, 0x5e3fdaa143b775d0
+, 0xeefa426ddaef981d, 0x531187de36ea9a00, 0x8564d05334b3eeba, 0x283cd3c2f754b6c3, 0x96bab685f62f71f6, 0x440f1124768f0cd0, 0x37a57968a2e9b7f2, 0x090d288664157c3a, 0x7d06a0ae8166a93d, 0x55f3da40202663f7, 0x83c156f6cd4a8b41, 0x11ae2ad0b4889ea3
+, 0xdb942f60927c52bb, 0x19e863d1e228c1ac, 0x6bb95734382ac921, 0x191c5eb8e5027959, 0x18f78d73b4fe3034, 0x69070995079e4dcb, 0xc6dab1fefd565b53, 0x0280ee9e79333561, 0x6dc5147e9ddeda2b, 0x2883af366c02e9e1, 0xd537ca90f4b61207, 0x72cc8d7c00f9afbc
+, 0xa80c0839d175f0fe, 0x41a04c40c66bf270, 0xe4f2765b7333f02b, 0x4355c56048491dde, 0x23a0b91e1539fb3c, 0x385b8bef5a41e5b1, 0x501ddec6c07805be, 0x4faba2ed05e46c60, 0xf86012a3d9baecf8, 0x7f077e48bcb4c593, 0x7b47f80442ab5fd3, 0x7bac9e60e388a875
+, 0xff20916e79cce840, 0x6e92dae0be9aa6b1, 0x9abc9c2f874bb08b, 0x66b84e9249a9af07, 0xd079727d2c3ba7fa, 0x3cc9b4ab42bbcb58, 0x1c05140684e7f2d8, 0x42f2e22de9231b55, 0x5ed35d21a458f273, 0x04a69f1d834e8b5c, 0x6674d387d8e5fb7a, 0x5e39141f13be1f09
+, 0xc31efd596696a903, 0x65a5970aa107dfc5, 0xce7f339b9c57fc35, 0x05b60bc9c7035f59, 0x7ff6dd5217c3044d, 0x7d31a994a7035795, 0x8a09198268f8dee9, 0x6ae984ab888fed62, 0xe8f01994fbe2fc35, 0x02a9ab63fc82e8c1, 0x5ce65b755bbc6f93, 0x24964794b67fa80a
+, 0xaac9f48c42b00556, 0x24091c4f22b26312, 0x6d30fef9c8d2a0fb, 0x30c8de5b318fee1f, 0x6aa76f4817ddb562, 0x278652b800f9e287, 0x927f2407e8cd1d09, 0x06294595a9a38e97, 0xf74111dae605b9be, 0x124b573359096daa, 0xae705465e4b29e77, 0x4351062531f2c9b7
+, 0x3688d7be2f54bd47, 0x2d5cce8c7027a741, 0x247d908af9b4d913, 0x02b6599f9fd810e1, 0x2b19fcaf75b4700f, 0x6c5e798f7c301a77, 0x6ae183a3a6614a7b, 0x70a94de0fdbf2442, 0xd2be57bf6d1caa84, 0x59cafb9b651aefe0, 0xf94199db25d1f46b, 0x389af5b09e99e5ba
+, 0x090946ec986c5e3e, 0x31ca5014e71b788b, 0x1b98f5f759d206a5, 0x5b4b2ed46ebebd99, 0x737eb2ef00593d27, 0x2a3faa466c5ccb32, 0xa4389f7707854704, 0x159c3039c372f1e6, 0x5daf6f848dd62d4b, 0x443df3c7ae3dfbf4, 0x65b7ef92fc278528, 0x69772cc673419ebe
+, 0x964b3675619aa430, 0x5abf8400dc08d953, 0x208dbc74e84fc1da, 0x6a2f4f82bcb351c9, 0xbe8d9e42ed3c30a6, 0x033760a913eaaa72, 0x324fa89e69bc9f2d, 0x785bf8493d25b38d, 0xba8b6aa883229fea, 0x4cc358eba80a0ed9, 0xcaae57d70fc92f08, 0x40cf65a40431d67d
+, 0x5e3dea459af2ec88, 0x5faddc7f04f158a7, 0xb45816497cd240e3, 0x369488ee7753e717, 0x724e899b5e5ed35f, 0x79698731fc79651b, 0x4b00f97b0a51447b, 0x49cf38dfb92ff373, 0xfc63963f06c990d0, 0x7ac88a353752e3e6, 0xa352c78bd4972645, 0x3989f9343056644b
+, 0xda357b1b2faa2e45, 0x129a85e16e68a645, 0x7a4e8609655f311d, 0x13c3ca0262b6246d, 0xa0335043cce62d63, 0x0f38f2b155ec2e0d, 0x3eb848e7d8d637b2, 0x276e046a25f65cda, 0x0bd83b24aea42fa1, 0x06d509113cd37f55, 0xbc31d994df0259f8, 0x6843fb43a9fe7c38
+, 0x149a41eea59170a9, 0x5a7a674d1fe36faa, 0xe6facf24dcb20948, 0x05dafc6df4cc92e9, 0xef487c3fd45b5a6c, 0x381519a813c57bc7, 0xac3267431b6c5da0, 0x7fd0f99c768cdf6a, 0xb6ce90fbbab8b2b4, 0x26901123b37e3dae, 0x8ba9c65db9aa481e, 0x6fce3bd66d2c1ff4
+, 0x784cd711bcac99bb, 0x0120bcc18bde4f33, 0x279fb57d0a70536d, 0x218a147f3b8b5a34, 0x9b79083ec05faea0, 0x4f268eba938c2b8d, 0x4b4e96492b7e94fc, 0x725bb1014cdd2193, 0x2f629dbe04c9278f, 0x17eb19bc179fef33, 0x64c02c4fe71faa7b, 0x2bed16727da907f7
+, 0x0e94a2ffc6f6be1d, 0x690639746653d0fe, 0xea58300f91bb5828, 0x4a18fd6c3f37901f, 0x8d8c9121792e1cb4, 0x400aa105779f5bf8, 0xd36ed767f44bb2a1, 0x202f19a9d2581abf, 0x88d0c1437c525211, 0x7faedf80a8361935, 0x84ef1a6105f78762, 0x75ece1d7cd9fddd3
+, 0xc2473ce78ceb2f44, 0x361de3f71cf93e19, 0xafedd803d58ed318, 0x57eb005eb6df4d37, 0x890850d283902e76, 0x3ab8f0eb0a8ab5ac, 0x4274651ca2982a94, 0x73c1c2308a966564, 0x88b3f51ccb3ed44f, 0x788452138b871e35, 0xf50816cba5b8fb81, 0x73c834fe3f77ad7c
+, 0x13fc1a6ba6e718d0, 0x34fdcc417880b539, 0x1d2a67b1ce3b5120, 0x7070398d1bf28a30, 0x9ed3973a28644b15, 0x63e2a8fe4d0b74ea, 0xc85b211552d67cf6, 0x59edce67216b54db, 0x51e06f08c484ede9, 0x1195f6f6a803c734, 0x8a6c6000e59b6e7a, 0x5e17c3e93672fefc
+, 0xa1bf1b926a88f92b, 0x32c6e0dd70d99747, 0xca914e8568b06125, 0x42444a7080682234, 0x5133877cdd44badb, 0x4273ee7e23cc3f9a, 0x4ed7524d3b142478, 0x24d5c329a89a2039, 0xd3a501ffd093dcef, 0x2eba9190d4ce8fd6, 0x5ede149ab4f0be41, 0x2983f244322f8488
+, 0x126713647e566e54, 0x16388e40eccad7c3, 0x8b821205a5fa5a26, 0x3acbe8b3140dc8d5, 0x26b8af4fb4f65543, 0x373adc190e0fa48f, 0x5cde6e2938561c36, 0x5fa3a87ae6f764f6, 0x9347e005262af823, 0x2b2ff25c04c0d122, 0xef98973ee5594142, 0x19d9043228b7a62f
+, 0xc86d0b4c639124c9, 0x051952543e8a5559, 0x232ed76431076949, 0x2b4e347b77c7d891, 0x0e0c557f40d30524, 0x36fd8d9c29bc7d34, 0x59dcb743fff54c43, 0x174556b3f859bc65, 0x80869ed5a7e1e5f1, 0x0e928161e669f525, 0x61f8f37c763f8b04, 0x49b9c40144241aa9
+, 0xc93010076dda7c66, 0x604ecdf469f922fc, 0xfb74b5afd0b4a90f, 0x37a189e443c2cd2d, 0x29b1de015998a809, 0x76d09300cdfedd89, 0x96bca9d0065901f8, 0x7e519486c7547e85, 0x7afff76233b00183, 0x1231f594531dc973, 0x32e4265909a59150, 0x21b0eea2b2a29943
+, 0xe220f1174a206093, 0x58cbff3d1eb86cc1, 0x901cf98e01b233ff, 0x708e45c90d79fe1b, 0x51da253e4d41f6da, 0x250f59d34936f6fc, 0x8c243951f201ee99, 0x5f5ef56612a4f499, 0x9aae67e56e46e8f5, 0x0aba0529edc2aef1, 0xb806e7cb7a945d13, 0x5f039f7112c361fe
+, 0x1b7b5469d438277a, 0x04f460df77aaefef, 0x62a66add024f3460, 0x4ad2dd26c92be86d, 0xe2f4aa34b7f664b4, 0x100dad8137eb161e, 0x300e31b14659de06, 0x527287ef595dd996, 0xa55535c4e29d89cc, 0x584afe0e800f27bb, 0xc7b1a5ba9a0495f5, 0x36a876c5e4563883
+, 0x0df0cde7641fbc08, 0x6495f3152e265dfe, 0x80bd58ea4e6e448f, 0x010fadb86892b256, 0xe8bf34ee67602d81, 0x354d68ff6d6bdfbc, 0x1ccda767f1785419, 0x142f76cb1a8ae545, 0x354825645ae7d69d, 0x622b90fd445bfb21, 0x6252720cb0313854, 0x795dfec85a0773a8
+, 0x7129048cd8e4de09, 0x0861133f4d5a079e, 0xc1611d35b9de606f, 0x04917b99dfdf7934, 0x84842abd90ecc3ea, 0x68e846568197fead, 0xa0699828808ffb65, 0x026da2f93daba8e2, 0x92ec9524b3272c8d, 0x2a052b20553038f9, 0x876bcb3c1c62445c, 0x4f944fab9256ce6c
+, 0xa3ac7d43a1f2dfce, 0x47c371cf4bedacfd, 0x7344d6bd75760bd3, 0x0e18bdfb0f54f9a4, 0xc4b9f10e990d0975, 0x6e2d1bb7655cbe1a, 0x07ed391400d703b9, 0x184d0d1c065ad756, 0xb36d3ae1d0d08ee8, 0x6789b29a6688baa1, 0x3ecf4729fe9d6738, 0x565e257d4a9f3bc6
+, 0x3f7ba4729e6b3a98, 0x6f09bdbbcaccfadd, 0xb089fe953160883d, 0x39cbbc17206a22d4, 0xdb86fd9ed56f6aee, 0x0666caac0c48876b, 0xef8bb79152d81067, 0x31b36736d560bbdb, 0xcddd00eb58a97d0f, 0x362b59966ab84656, 0x2058d03cafc6bf9e, 0x062f497f0e198810
+, 0x1093932097ef6cab, 0x18d60c864cbaf808, 0xa6e8fdd3f0f8c3f4, 0x5fb48054709c0ae6, 0x6f783f5925eca3f3, 0x6b525bc9350c1672, 0x7be5a47a7c7d9d30, 0x766326ffed7d2e21, 0x83cd4a636e4e6d76, 0x56eebb8acd2f0870, 0x84517e4e7dbf9886, 0x4574bd5467b6c8ed
+, 0x7a7ff1e3245cab37, 0x1370a00345fa9354, 0x488b45431eace69d, 0x73abd5b17979434b, 0x5583cf146069ac9a, 0x1a25466acbce3b8b, 0x02726e9d7a32e59c, 0x0d2cc727c10aa308, 0xe1fd3f18486b065a, 0x4eb2ad3b046edd0f, 0x058d817876c8f207, 0x58101603c8158a84
+, 0xd48f531495e407de, 0x0815dc475d734ca4, 0x1e2207964340de50, 0x0be7665fbd1e81d5, 0x49608809236d1517, 0x53df7100a12d6712, 0xc193cccc00f8302d, 0x10092c1f8e918ada, 0xdf5ea38b52ae8311, 0x5e384a9c2c595615, 0x1b54ceafbafe51fc, 0x387f2316f19f845d
+, 0xb77176bf74263102, 0x1308720f342c1973, 0x388d6df3d782e2cd, 0x0e5f66ea020f8eb0, 0x5e807c53519e4654, 0x7de448c866485742, 0x09117741b9a21b3e, 0x38802f32184ed670, 0xcac6db447541914f, 0x231e8055f042d2c3, 0x9df6405aa9cec9a2, 0x49edcf18c499cac7
+, 0x9c3e25c06e7bb91d, 0x469e758cda673c7d, 0x8644dbc2d6861cf6, 0x0e1e9f70a8b0bd2d, 0x9fbd1a1fb44f1a2e, 0x51cac801e6b7d4bd, 0xbeb3e3c08c93475b, 0x15a9e19b0e54c6f9, 0x7079d3ef65061146, 0x57206ad88602d2a6, 0x73304a3d1f7e9c3b, 0x3178a8a8996a8c51
+, 0x15a68fbde5ae5eda, 0x4b6922bc7b73f1a2, 0xe72686267b52fcb6, 0x4d935777cf7e114b, 0x4fcc677352b2499f, 0x10cd2b07029ac98f, 0x598f129e72bb5924, 0x6df47b30b9c06a24, 0xca8af8de537e749d, 0x0852006d061ac128, 0x51855bc0a200efa9, 0x768269e2f0fbd556
+, 0x12425594dc966e37, 0x5a04485049cbc9ab, 0xc56ea1ae890c4be7, 0x48773793b851b04f, 0x84fc8838712601eb, 0x3c3e044b61db758b, 0xfc2fb331cb560707, 0x5b9e2d922f7a172d, 0x2d718614662cd8f2, 0x2d98a5e24f6971ab, 0xddbe6608236704a0, 0x40e417ca05dfe848
+, 0xb6e3bebb39845ec5, 0x2bed2597478ba3ae, 0x491070398b4cd694, 0x1709f6180fbac96a, 0x99ab8b396781dd85, 0x281a73c6fc10a8aa, 0xddb4ebaab8152203, 0x4cc0997933d4be4e, 0xb6c343df2f6d0da9, 0x78a457f003869d6c, 0x161a73896ebbcd00, 0x4044aaace3f9318f
+, 0x790077010498849f, 0x282a27f81879a31a, 0x11e11534f24934d3, 0x34491f9a036145c5, 0x90f1104872a44d83, 0x4fad286de6b30939, 0x7e431830aad1171c, 0x300c88b138185eb4, 0x7743b1692dd8f5ca, 0x4682f891a08775d3, 0xa75a721d610cc8c4, 0x3dc67ecf92bc456e
+, 0xff07604e842bea8c, 0x793ca6ddb49f4086, 0x9e3215935c6c38c1, 0x6c21f6eb852de4ca, 0xb7c7c06ec232ae3e, 0x6ce20da5e591ec12, 0x0111deccdee5ac41, 0x340535d608ccbe7f, 0x511278ff0466c5de, 0x46e13155e72dc5fb, 0x38b0d7c3f99e3713, 0x297f68d2f08531cb
+, 0x26b0b55122022f4f, 0x69e8409b93820745, 0x434b1f0f566b56bd, 0x0373bb6ee7147406, 0x63c751f9ea0b6e05, 0x3f36ce6206219445, 0x555cf69a012e7e2f, 0x55b5b46aae15755d, 0x5de095e1d991f315, 0x15c43b346f5e645c, 0x818f56b9509a0dca, 0x21e19179d8bf822a
+, 0x96b3ea04d4a02d94, 0x0715c5df4f4e301c, 0xf0dbdaeed67a365e, 0x479b96def4aa47dd, 0x421f3e23ec47ab71, 0x343f303a8c43a06c, 0xda49a77fe98f8783, 0x5aad9c070bf35fa6, 0x400bbe2180df1d8c, 0x21ba4f4a3833f2eb, 0xc47e682f767b6c7a, 0x79edd1ac87b93148
+, 0xdd27f133299ad173, 0x7c3764e1e8b0cd7a, 0x727b539d92057631, 0x2d68238b34898bd2, 0x50af70f092df14b5, 0x3f921a543f9feed9, 0xacb93ded5ecbd9c8, 0x1ed8c6493cf954a0, 0xc48f397dea1a132b, 0x6b65f8f7e62d03d5, 0x773f00807a1e2c4c, 0x319457f073d928f8
+, 0xe2aa20b1a07618a8, 0x4b9e0df0162f5cf5, 0x3ccdc39e1a097de8, 0x3d1eb9ef9c8819a8, 0x913c80ad1cdf2cd6, 0x0bb01886a7d65d15, 0x1afb6429ae2caf6c, 0x5683edb458b15017, 0xaec2b62ee7ba3c93, 0x347595f76d5bfce1, 0xd5cb66bb516c6792, 0x52d4df4c90db9312
+, 0x87f0d16f778c5957, 0x25349b2e3ae4aba5, 0xc4e820668b0b1943, 0x309eb38a56e8ede6, 0xa58f46767433412f, 0x349df803e450b56f, 0x90f8a3dc32561b64, 0x68299577d7ec049c, 0x02e498c987638aa2, 0x40def94d56c26322, 0x7bf3e0ff5dc05d94, 0x6a7577fb1dba380a
+, 0x88207101c9de1eb3, 0x471ef15fa62591a2, 0x106ef3c6060df999, 0x57e835eb59767ef7, 0x7296a6b4fd8084e1, 0x0ce22202d2134ab9, 0xaee8a6947d4b4ccb, 0x54adf0506f5ba563, 0x67670b437f6fa9a3, 0x1451f92421a875b8, 0xb27071865a08646a, 0x17b5e80ca4e5804c
+, 0x004f53c3e83559c6, 0x4e3cdc1d57afd566, 0xc7f89433af15269e, 0x4c74bcbf65089d37, 0x59eff80fe1e89aae, 0x0745f3a314b88583, 0x2f56770f3340e34c, 0x028e96175283c32c, 0xc2f678af26f5217b, 0x3af473011b8dd8be, 0x01679a007fa51fb4, 0x6d2a917665f524fd
+, 0x191c2afa4db4d78e, 0x4be9d7d2a7fac6d4, 0xb34a933bbf7b5457, 0x189953267b5612e4, 0x655ccde463e80295, 0x1fe93c2b61b1d5fa, 0x4e6e69f72417b79d, 0x1592d5d28ce76fc0, 0xc2aae844b793772e, 0x0f8d3c473825e455, 0x7b0d1b699be576fe, 0x67c89032af27ecbe
+, 0x5fee28add67060be, 0x145209fc4e6c28a5, 0x3d0716237a2b6064, 0x747881bd4b644698, 0x01fc6178169b6c17, 0x115b5fb6183672da, 0xc593e5e3d4004d13, 0x579cb584923b71e0, 0xaae7bbcc462122fb, 0x294118c3e8cff0bb, 0xb154b16e6c8df4bb, 0x053652583138e231
+, 0x0e30e7ca5a38eb8b, 0x5c8f47a48a18da76, 0x75a337768705165c, 0x1ed2b9b71d81678e, 0x69834fc8fda114e9, 0x65ff3d5fe4d38549, 0xd62300c2f923cc2d, 0x4178b7d593b5a2e5, 0x0532e4ad5051750a, 0x0255a8390653983b, 0x1c4521edfb1fe8f6, 0x2f3a6b5010a72a00
+, 0x79152cddaffd1af6, 0x0f0a79cc85a61075, 0x0fcb457a098c0e30, 0x710418047ddfe63b, 0x366871970b08ecdf, 0x5c763652aed2d420, 0xf7d2e9ef4c8ad532, 0x4a43b8c44e6d2ec3, 0x74120dae518db896, 0x53f801ebb099c1db, 0xf20eccce61d1dc89, 0x5f39d6c4611d1468
+, 0x02de175930926fa6, 0x5e726c6213ad4d10, 0xc0dd566b50aa3316, 0x63f1eb7c74fe33bc, 0xc573ea0c270a7a61, 0x6f6370d7375d65fa, 0x104caf5d18692f6b, 0x09fe9242bdcf3ed0, 0xe0d8047ab16d1934, 0x0b398a0e4bafe9ff, 0x2a576abe60dbde1a, 0x58454afc7f54f4ab
+, 0x5aaa8e3ad187b67c, 0x25d3906fa2e258b2, 0xa7aefda45922658b, 0x6ddec43a0d046c94, 0x6b8056b7f76456aa, 0x712add84b4b59e5e, 0x215f8c303db44047, 0x538f845755a9e7a7, 0x0461f38f90b6a341, 0x7fe9eb795922019d, 0x4848b80fd8f3bcbc, 0x2d99757886a153de
+, 0xe3adca3e20eb702e, 0x7d3c0503d0a3f409, 0xb5a8e41208d5cbbd, 0x7cb3e4229a27456b, 0x3c28a52725fa627d, 0x01293a82cb1bddfe, 0x372ee1d727a16903, 0x232e7afb711415bb, 0x51c3021c51eccff2, 0x0f10e2bc650801f2, 0x037cd776971c68fc, 0x33d3f2707632fa69
+, 0xe5baad6d7adb7320, 0x0826e640d232482a, 0xb8ae9d839d393009, 0x09fed4ed4492ffbc, 0x062f9ee3ac2c64c9, 0x4c9421fd234f65f2, 0xb9a0824d55f29361, 0x462fca021a0bae6d, 0xc3dcde2a8db7c11c, 0x1ced2fdd5ff5e230, 0xb4a7c64c5cad8fb9, 0x54170a16cd8f756a
+, 0xe5d997d3f59f24df, 0x5da1c5d4bde51147, 0xc44149919425fc0d, 0x090254c81ad60a3d, 0xcd71397bac019e76, 0x1d549b1938095d5c, 0xe67774c76df3256f, 0x7466980532e4307b, 0xf40b4207ebd5f703, 0x20dd613441fbe712, 0x56e1eaa4096a077d, 0x376b84ed795dbd00
+, 0x8db7fc4c7a802bbd, 0x65fe04ff10b386cb, 0x7f620ac43d2d6809, 0x361b4c1d501a6507, 0x25b9d72e0f0fe018, 0x278331addd2f5fab, 0x7a08d1b7452c4d5e, 0x24fdefab552ee8e3, 0x2c1d8fb3fd0e8253, 0x677ff0650db81e07, 0xe66bbb99f36331b4, 0x4e69b45c7e0edbe1
+, 0x30f3e19a03e978c2, 0x25a8a596d703365f, 0x9fb8d41b67378c29, 0x7b4c4d67a69a84ac, 0x1c0586c3c0fa2752, 0x375e24868b09aa8b, 0xe4eeddc810360a3c, 0x468dd1a2163f2b7e, 0xdf96cd248842214f, 0x7307816f0dda8211, 0x43dc96b0a61fc05f, 0x75adb0e9a4f6ce10
+, 0x0439fcc83098d555, 0x71569c609ca1de14, 0xfbe858f81623e25d, 0x26b01cbe131db073, 0xcb6e7932946c0c04, 0x037dee8d73f86ed9, 0x969978d5e0ccf8d1, 0x198538df3d6441b7, 0xb27020b9f37c09cd, 0x296eda198454b80a, 0x871d22f39dc029ae, 0x13df76f999f0c02c
+, 0x54dd162fdd971dc6, 0x598a5346292d55a6, 0xcb8a5e3677542f99, 0x76a2237af0f7c46f, 0x9d2a3c11c3c6a83a, 0x4de00f5cd4f2bc09, 0xe99711f94d672dd9, 0x0e00c74c7f7ced09, 0x3982ed71885fc998, 0x155caa4532f7425b, 0xb39b60e091a99ccf, 0x62b6354da2e8fa35
+, 0x5c9ff98f93f0269f, 0x2094d8c2610a7cc6, 0x366f062e1ab924d7, 0x24d5d5d12e3be0ad, 0x7f14e8af5780f628, 0x778d24f4f9ae5931, 0xe48cd9367abcc598, 0x196687002fc80796, 0x52c4fcb72209b386, 0x0676d113b310c73c, 0x8241c23d82cb3c4d, 0x53ee306806a89ff2
+, 0x927e2b011a6f05f8, 0x1c74c2c1fe52689b, 0x1c053fc6abfca7f0, 0x5407aab4d9a873d8, 0x2b0fecba523a5d95, 0x189f75aaef2a8cda, 0x480efa8cf923ea23, 0x3dbb693ca644da39, 0xf700e878c83e4ac3, 0x0580b622bf4a2d82, 0xc1c4f2863f100bed, 0x6050d6c3a884e58a
+, 0x734032840c05c8f8, 0x2776de4edf3f0b14, 0xf15f4810ab971efd, 0x453a2369d42daec0, 0x061946c9afbd95cb, 0x4fb878641c5fec53, 0x9322608aee6cdf29, 0x3a95e27c1dd53b77, 0x6fc8d19194ac154b, 0x60c0f25944b6640f, 0x098b4a0c0c337fa1, 0x14d0c6272777853c
+, 0x8ba539e9be5e1300, 0x7074d564e1547f04, 0x7d3aba794dae7dcb, 0x6bc696f01eb600f2, 0x0a9896a64e921691, 0x24a4492b8074d6fb, 0x894591ec863875fe, 0x10130f2e79503558, 0xc0dcec0b3d9ae708, 0x14a6ab3f3a309e60, 0x1f66eb8df4e094fa, 0x71617339f5f49c4e
+, 0x379013c85d65671a, 0x0a98f320c066e165, 0x3462de4276698572, 0x28f6d7816527832d, 0xdd6b1dc5da8cce43, 0x788a46cd018d04e8, 0x592f5d21724dd742, 0x7f1d4fd764d73e13, 0xdde508fc94071244, 0x4f39da7a80d79b25, 0xce14b9b8bfabfa40, 0x05103dce983312c0
+, 0x6247dd82064ce3c8, 0x3a970d1ed2ede9f7, 0xcaf318b8c000206c, 0x4a1f29c17b4f3b0f, 0x984de88f4b3f4a4a, 0x0fa095165756579c, 0x0e33c5984955b95e, 0x3f52a69915b4f089, 0x3f8f56b7eb642588, 0x2354425f2fb51a13, 0xdf675342440e42aa, 0x7d8cb1765ba4aaf0
+, 0x3a7f6bd0eddea383, 0x214c89804e6f5ede, 0xf95550a207a0a121, 0x3cb9dea6d844ddee, 0x22b2f03ff887c015, 0x0d4541cd3a0597fe, 0xe514283e506cc707, 0x02967e8661a3acf8, 0x5c7512733f80f82b, 0x66e4a3b05e89eb75, 0x61b15223eb950921, 0x5b26262fc72dff40
+, 0xa263fe09838bd03d, 0x67c9d205b6707465, 0x5823d3fbc68a388a, 0x0c793feeb593f92a, 0x674511a861ee513f, 0x623cb12277d83fff, 0x5776f5a0d9f916bc, 0x312a7791a2bb9379, 0xc68acb3be3e1beeb, 0x7c2b8ce17d615e1b, 0xce9ec87104c39107, 0x3fc40bb1d48900a3
+, 0xeb25756cd88ad99e, 0x57f2f7c59610c282, 0xf59eeb422771fe29, 0x4e8a2f4419526433, 0x1767cee77c2e56d4, 0x7b5a67e8b772a094, 0xf2764ecb164fd6a1, 0x45873cf2fc60a24a, 0xbaf61dd7e4b38a48, 0x0c2af9d71360a11d, 0x2b4463bcf4d8d1f3, 0x49ffa6d0df4b4bc7
+, 0x389321375a9e8b14, 0x309c360acbcfd1f3, 0xa4292bf6ae84942d, 0x3498bed23d233f3a, 0xf8001a7d15e1c2d4, 0x7fe05b7356e42030, 0x056c4b7d0560e393, 0x17131cb2d84a6d14, 0xddb35efb50a87c66, 0x32a41979ac61d161, 0x3c55aeb89fb03ac0, 0x54e0a7369567f313
+, 0x7776184562e6b50e, 0x1e7b74735204c35e, 0xbc3704e0b4c0b427, 0x0efb4c9ec4c1f057, 0x44019a2d92386591, 0x05d845e096b77230, 0xad219d26ebb227d1, 0x00b195e45e8d8faa, 0x2b0ce26847469e51, 0x1e7b23033edc8f90, 0x467d9c79ac0620ee, 0x7c1f167a41b8c097
+, 0x1e7fe0e7559a7955, 0x2eee8695ded3ece9, 0x5fbeac53f5e65d58, 0x7a4f73a3094c46ed, 0x67a3a592f7b5dc8d, 0x346db83e75670a16, 0x9ae3fbe517848ba3, 0x2c44c0f4d0129ce2, 0x74c9026564d84827, 0x21f6d6a5edb2ab9c, 0x0daf69403f60fd94, 0x585b5bb7aca4c8de
+, 0xe25524c98a9ffd09, 0x3de50abea6b88519, 0xca9f369c14245ac0, 0x734d822f6a26734b, 0x5bf4b3a3d3349c5a, 0x1c455fe359c40864, 0xa43b87ecee82fcf5, 0x4c3c48bc27730918, 0x2f215ecef49fa901, 0x0478f3a2105dad2b, 0x15e90959144f5a60, 0x3970673ed2bad357
+, 0x370509fa6d9ac659, 0x63a8e8954ec0be8a, 0xd4fbc4b0c5e2f051, 0x61f85a16963c1de5, 0xca1a957624f6baef, 0x40965726c32f5bb5, 0xd306358e9b7a7ee8, 0x564c3f1ced165145, 0x15c498e75cc03566, 0x4fc92292f00db3d2, 0x963d80120fb0df7c, 0x79c1e54694d105c9
+, 0x374d8d411e924824, 0x0f5881aadd60723e, 0x041ee65a086da367, 0x2d1eb1a2ee3dab90, 0x1d6f4ef93623e0d9, 0x0b04b92ec7523fbb, 0xb6b42a1cf3fab51e, 0x0a9e2150e2ccf666, 0x3bb5d10249820113, 0x5ef3aac00fe4759d, 0x22bda866f7e6aaf6, 0x39a8824e02b28edf
+, 0x203ce8ffdf30a4b6, 0x5dd16137db42048d, 0xb4b1e3fa1a548e38, 0x0d195ad50b9080a7, 0xb8c3d61b901a3c00, 0x78f0819e4cc2fac1, 0x0614e8f99a6b520b, 0x33b7c971dc7aab63, 0xb1287924162a4f70, 0x52ea4365d0d4c24c, 0xc19830a3dac4b36b, 0x2f0c50f8ce98a9f2
+, 0x423b87a95d1167a4, 0x237160ee8e47539e, 0xff6cbcd57a8e66a5, 0x1054567a24d43039, 0x3554e2eec53cf89e, 0x1ceebe03be350185, 0x79aca9720c3c1ccf, 0x60a377ad9a2a4adc, 0x331e2bbfeb6896fc, 0x529b6e7892d65f60, 0x2de25d6386d2f02f, 0x35582d49bd719701
+, 0x3c83d81fda8e796c, 0x22ee4941ad71c9ee, 0xd97b16282de0232e, 0x629f139b981a9a32, 0x28f5053797bf570a, 0x3303f7e448650d84, 0x21722cedd2e78d5c, 0x7caa99bb7dba18e6, 0xb82a0181aefef6bc, 0x5a277a583e494b1a, 0x68e6b80e182c098f, 0x15883e114abdf029
+, 0xa5d92512a7efdb5a, 0x42e112b2df11ef6b, 0x9fd0fa9464162afc, 0x0de0d15a64ad6e68, 0x83aa927ac7deedd6, 0x7486cb90b8d8a781, 0x99a3680c2c1a32c9, 0x42130745b62e6095, 0xe3f228f51946bcbb, 0x0834bb884cee1ef5, 0x0f8a9dfb3099ed83, 0x7cde4af466ae2f9c
+, 0xdcacd0bf3017e1fd, 0x15caad82b9dc1a75, 0xada87fbcf0789084, 0x1f189b65c3efcffd, 0xf01ccde9acef6422, 0x13f7c96374303dd2, 0x3fbfd79b67edf64b, 0x6e50baa0bec3968c, 0xb1964c544699be74, 0x6f3fc2f1c131ebc8, 0x675cf297bab4ceba, 0x500e22e741428a0c
+, 0xed2676f92494db17, 0x4549a16d472bda3d, 0x624cfbebb7c0990c, 0x75ba0ae254f5a5f2, 0xc6c2aae45d15be12, 0x1ea4807b3d840b15, 0xc4e60e48f7081018, 0x0b5b52d65f86bc44, 0xfced71759baa3fda, 0x41995c301cd3ecc1, 0x9fffcfaa09132166, 0x3beb39a4f8795edc
+, 0x7bddc120c23a77b0, 0x086c28e5c0c10552, 0xfc7bb21194b2ff9c, 0x2f5787ce8049c487, 0x3c478ec48fec0d9a, 0x7514d7e37f7b0e8d, 0xddca2b02dcbf22be, 0x70b78ec3169a38dd, 0xdde9bffad4b5a170, 0x2f2c801573f14b3f, 0xd5022d986b111774, 0x10627d919b0a4536
+, 0x4a316d9e8161a6ce, 0x00cd0f5dc76bfab9, 0x661d1ab56d8586bb, 0x67ed6ad0c164c3f8, 0x02702a01987b4717, 0x4710ad22ba05a13f, 0xe8d90eca51ac4b31, 0x22dc72b3be33d97d, 0x22a9720e2d703e9f, 0x478b2fffd75efbc1, 0x737e0c11a3b31cfc, 0x4113fdff5ce3b059
+, 0x3eb2303770a80b5b, 0x5b08a98c6fb6f704, 0xdf352a5626a81abd, 0x4b182f9b4677bec7, 0xd9e3fdc81da0e897, 0x3808042d75725fc1, 0x96ad719ae6c90c21, 0x1be74899ad1d9283, 0xf11f50780001ee8c, 0x07d06d5de0206f7c, 0x66fd3b9518f0a943, 0x5ca4c574ea9af34b
+, 0x8443b6bc35da6da3, 0x24c279e382cd62af, 0x5b91d35d74beefcb, 0x34ad263fcca8021b, 0x113242b85d6f6020, 0x23bb104cf0c31cf7, 0xe06409a1af2064e6, 0x5b8be7254f41bf07, 0x975ce3a52d3a85dd, 0x010c9946713c220a, 0x5638062bbdc0fcb4, 0x587756ad310c0ba2
+, 0xaaa1e83fe1c076bf, 0x7a22a7b4aaba1b9d, 0x655384f4f5ae2001, 0x111f1a4939741d0c, 0xd3045989690d7074, 0x09a4c2e207e2707d, 0x9d0d7168ff94a41c, 0x1345b8a96a9bdc0a, 0x388f9a37bc53ea06, 0x53dc0c98e563976d, 0x5edd5cee3d838f30, 0x1fc169e9e9629b1a
+, 0x75bc3ba550b9ab51, 0x656c27fec4564b68, 0xb54c46724dabc2aa, 0x3cbf237e229cb3a2, 0x80584769552155a6, 0x3ef5c857ff7bc1d0, 0xe00c54604c4e6768, 0x43c5dcc14e805663, 0xec65a429d223a42b, 0x2b86e610f7a4b06c, 0x0b3d477800f1d1a7, 0x2a44125b6e5f87b0
+, 0xaee04c64f2f0780e, 0x3cfb6dea1412e1ad, 0x8cf545c53f22eb93, 0x0e3dca30fe4a817b, 0x0a0f0646e0d0b88a, 0x1dc4e132b2844385, 0xcd80055df44e685b, 0x67697ddac11cb6e4, 0x978399d50afee64d, 0x59817e867083b7d4, 0x41c0b04d7bc293d3, 0x65bd10de54794138
+, 0xbba4207786adb65d, 0x4fcd7614eb81b12b, 0x6224c558ac866a18, 0x3bffb60b25123b42, 0xac15ca762fb3b5b4, 0x03ed17c63d70e840, 0x13e724cbfd02f4f5, 0x5e2ce91293a818cd, 0x066475cfebefbd6a, 0x5a47e18651de34d7, 0x86065e30e79d2e93, 0x5a83aa94c2950256
+, 0x702b168a5e44cd05, 0x56d42fc33e39a59d, 0x3e0bb32ccd9a2492, 0x0f6beb9f650905a5, 0x294fd9eb03e71134, 0x0ed502e42de89ce7, 0x2f08c42151d5ba0b, 0x0e47e25a422a3388, 0x35cac582afe131aa, 0x75603e13abe78ed5, 0x0ab5b6c9fb4bb78a, 0x0c2330e39bd35f74
+, 0x148e6f416cb9e0eb, 0x10fb0c009773732e, 0xb8ae428290885aea, 0x73ad17feb4f06822, 0x2689594c05528131, 0x574f934673da218e, 0xe1d5e84e2bd69b7a, 0x3fc82b61a46b63b6, 0x04889691b79ba3b3, 0x398d0890526b9278, 0xe80ad8a2bd09bfc7, 0x64c3e1cfc944d248
+, 0x8c7030e8ab4e5a40, 0x4a8aa5bb0885125f, 0xd77e2fea6c1d8e84, 0x61d5db6d4883a67b, 0xd098461eae890f27, 0x7064c9de21cd0f08, 0x74588748d09cc933, 0x1144b451db712ae7, 0x5fb7e9d9425f19ae, 0x2ffd742f9fc95ce3, 0x8bc6cca611a528b2, 0x00b4db6fff33c2f0
+, 0xd47da46b2958fc43, 0x62b8f6c8a2dee671, 0xe374274378d8c293, 0x2210f8a16f8076d7, 0x78f52f71fbbc9abd, 0x0f29c234027c02b6, 0x6810d38ea8291685, 0x46aa6761cfa73171, 0x7e33073bb44adeb7, 0x629db902e3d54f6e, 0xf14047046419bf7b, 0x6dbb9ce12b627e84
+, 0x2225f2425a912ec7, 0x1fb5660c743426dd, 0x44de2dd8b15f8e9e, 0x62a8adedffa4b6e4, 0xc8130ca8cd27b2a2, 0x4c7a1445fdca8bb1, 0x7e9fe7d17682115c, 0x319245b09009a47b, 0xa8c19dbc9ac9df5b, 0x268d70837679e221, 0x8a34da4ee0401b6d, 0x63bde735fee515d4
+, 0x52870bb171c59be9, 0x5eea75eebe1e4c3f, 0xc3f03d508a91dc72, 0x1e9f3f00a5f19bdd, 0x2f8551c669776852, 0x2ebf6cf5d1a11f0d, 0x8ea8a7fd21ebb544, 0x25570ea4410f20d7, 0x169307202d4f1036, 0x0997facbbefd1396, 0x3fcdb7b6fe993494, 0x783c0c33119cf700
+, 0xbbee2ab9ebdfa15d, 0x29181b0e4f62caa2, 0x3aca5aad7166704c, 0x67536f706a56b0db, 0x480b6720d8a05722, 0x5c7d1a3e210d6e1a, 0xfb3015af85701ef1, 0x724247851139af98, 0xc4312a2254650e7b, 0x45ad01a452c59e01, 0x0166affb206aff51, 0x6fe936bc5c7b1870
+, 0xa3215efcf2979fc8, 0x4496523d88fa74a4, 0xec4b441a9b388ccf, 0x0adac47617debefe, 0xbb29f15ede2898cf, 0x38f57abe2e5410a3, 0x05a2c4b3f3a42c9b, 0x120b0b16ace909fd, 0xa0edb25d5792b22a, 0x105000b02bf085eb, 0x95dddc2530e803ba, 0x1357a7da9b329245
+, 0x12f3523db9df345f, 0x2e8ce8820b90afcf, 0x5e54d2c9373f4956, 0x0f5f13c2c46f56fb, 0x22b6c55634c44feb, 0x78e2b68bc94fdab5, 0x557327d3a607eb75, 0x1c3421a1afd9a946, 0x12aebae0209603da, 0x5a2dc537fa1503ea, 0x627a63e293b73a77, 0x67099df042cfb1ff
+, 0xb9af772eaf8a8f7e, 0x311d5424872a4892, 0x843f24824f7b98a0, 0x22ba779ca3de0199, 0x998e6a90625da078, 0x70867ea98c184bdd, 0x750ab728712d7e20, 0x3354677546433294, 0x978c6905e7021bca, 0x7347a9f95fc217be, 0x387a415bcfc98421, 0x5019ed4fe7d32882
+, 0x4431fb315ded4054, 0x68cf2afd089baa06, 0x14280d177bd546fb, 0x21c00ea84fe0543d, 0x1fe5ff11f0382b42, 0x577ac744a93c8649, 0xf6589d80637d658b, 0x2a6bd1ace5ac9816, 0x05ac90c2cf9b3f06, 0x3605c782fb4c70e6, 0xca14d815dc28a09a, 0x15d1271c350fd8e7
+, 0xc9d9865d9daacbaa, 0x4a4bbbcc4b3dd9e0, 0x584406e29b71696f, 0x44fb330dced38784, 0x9d4a1ca0c2140c88, 0x73ba23f780abcdab, 0xb3db10b715e47634, 0x63adefc2d7cb51a3, 0x2b341a7db12ad730, 0x2eeb13ce0a8359bb, 0x20b3e74f0a52209c, 0x5d2751e834edf632
+, 0xe19e3f47adfbc864, 0x508ea101d9f15fea, 0x0a90521099552ea5, 0x5e0c78fe1fc64321, 0xa701322b8623af07, 0x02406d630da6406e, 0x5a6f18a87c7d53af, 0x075dee250481febd, 0xa6635e248fc9ed7c, 0x3ecef5811d276b32, 0x2b0dac8c3949a180, 0x1f17767bbfacd81f
+, 0x292aa9c5ce43ce2e, 0x0e68491efb805a64, 0x1b916c8b70e1b168, 0x63ee074de83a5f75, 0x00c0afeefe1ec9eb, 0x2b0357e5dbfab616, 0xc01303fa5716fdc4, 0x39e54b925a9629bb, 0x0b9d6ea21f17f513, 0x301736eabb7cd0ad, 0x79527309f54886cd, 0x6b7d632c6ac95c29
+, 0xec92b34738d6e9ed, 0x5f12f2c37f939519, 0x9cfe95e8981f2fa9, 0x415e841d19014c56, 0xc63d162e18b70f1c, 0x2298118bc731b6b5, 0x5a08b84ad86fa408, 0x3d877a7ed9d595b0, 0x568275ae4e46905b, 0x43dcda5a010e0f76, 0x6824b35ad82322ed, 0x28f94c673df8a65c
+, 0xec6850e31e490bb6, 0x7aac4c88d3c5ce20, 0xa4c611e755ce22d4, 0x4f3037c0c1a101e1, 0x0c1b6b69c0ff89c3, 0x34a7c2965708c6ed, 0x71f818cb47d265b2, 0x3baca305cf0b6d92, 0xf1541f01f5d56025, 0x2466dd13cb5210eb, 0x336b8a0963f61a0e, 0x300e55a0abb76bfc
+, 0x212437a242fd2bc0, 0x0d3f1d2b212a04e4, 0xe0e168be7da6becf, 0x21a177f1fa2d3b6b, 0xb055ecc557520ef7, 0x523b549c76c6c54f, 0x745cd02ce492da62, 0x66841edf751274da, 0xc6e582626fa08801, 0x7223541e926cf5c2, 0xa6c01b2f02352dda, 0x2a04030cde006993
+, 0x750b7533b96ca647, 0x5fc178a955174c5b, 0xe98228d2a8c75626, 0x1f252e813aacd524, 0xb5e862cbbf079fb2, 0x1d4cf3943ff465f4, 0x5d4f653e9c2f3e7c, 0x0241415bffb0e83e, 0x7f1fbfd050b465a8, 0x25a7a3495d1517e6, 0x0fcce4f105d00c9d, 0x087d85a6570305db
+, 0xab3b2ca6a97dd5f7, 0x3d1e94f91931dad3, 0x3df40692baf7e483, 0x20e46856aa422674, 0xf5956c399491295e, 0x6ce351f87a954215, 0x9452c4784828bf3d, 0x5a6e91b594c050a8, 0x7cb6924de450c248, 0x7b7e92162118dc03, 0x9895c12e5d68abc7, 0x10c5a49a31adf4ee
+, 0xcbd5cecc9aa5ffde, 0x6dbff6c60282b9e8, 0xda9fb9255157cced, 0x3627df7e64c9e853, 0xeeef220d5f216bc1, 0x3ed46571ab9ad728, 0x2f7d6b33a14cefe0, 0x07c932cf42986f72, 0x118634c8b234d34a, 0x359202622328f91f, 0xcec8cae9bbc1480b, 0x125d0a6f0c76e584
+, 0xbf0d701057db44c4, 0x00f9a08b98d7cf23, 0xc342a1c7e03579d4, 0x1f34594861a3e3a8, 0xb4bb5bea7643cbac, 0x7678ee2c7c71052b, 0x3dad52217ee63942, 0x651b11de50e2ef28, 0x57198de305ce0e38, 0x10abbb78cc6226e1, 0xcd11606de4b1d0b8, 0x3db3a79ca11f47bc
+, 0x467acde791ed99f7, 0x28b749dadb993f2a, 0x07839480be035ba1, 0x08b6097587a2b1a4, 0xb2aab79de96b3cf9, 0x0d14cdd8b25dd576, 0xad1bab5d11fe2683, 0x228877694ad342fd, 0x73e842e39a02cf84, 0x229e56434fc94082, 0x4bca58d5d7f1e00a, 0x54c1efc009ef9bee
+, 0x0519025d650616df, 0x008b15c1733654ce, 0xac7b622bc503b775, 0x1553e7ce50d61ff5, 0x304cddac0ef81166, 0x3c84dc032c8a2469, 0x325cb8b4bc1552ed, 0x3059cffc1db7a948, 0xe64f6cd6ab509289, 0x1d561c8146424865, 0x6a614356ecc78fe0, 0x7a910805f6267f43
+, 0xefb12cf42b677bf4, 0x18a69cc91586f6a5, 0x843852e85790c03e, 0x3b49aeaea065ee09, 0x73edc5841ac0ea94, 0x6f2c2ed2365c77b6, 0xb81018272e67b881, 0x7e3fd493c632ad24, 0x1eca72c714e5adfa, 0x57ea72198fd219f7, 0xd9b3049ae86fb1e0, 0x767c2f81c2eca62c
+, 0x438121eabfdd269b, 0x5f2c5244a8a2ad6a, 0xbce045eddf10213c, 0x25e7ae53aada6a2c, 0x99cc28039ba9f48e, 0x753045c8458d2a81, 0x55475cc4adc6bf39, 0x6b11793b3fb47fe4, 0x5b4f3894390eea9e, 0x6cd2f19ba2c50a55, 0x5cbb59d4b10f5d86, 0x559a71e89fa9f7fd
+, 0x2421a701264c487e, 0x3ad306d58d62cfe2, 0x7095354b4349038f, 0x505f8a5866220651, 0x7a8d87f68bb54abf, 0x3405baa84f5aac5f, 0x2b5fc64c3bdb2049, 0x0f592f78c7f96dca, 0xedb4b3455196825e, 0x6dcd6006adfcf115, 0xd03c31a42f90f9ba, 0x07c80b99a8fca111
+, 0xc02f2680ff7c0267, 0x6b6d059c945d7fb3, 0xc85403c1ee78ff9b, 0x4f79bfda570519de, 0x59f26988414f2fed, 0x50ec8deec85e0d69, 0xcf3dd6213c6a9030, 0x1007b02d298bae84, 0x8aecba2c26af6cf4, 0x522d76e2a9a8849c, 0xc270bb16c7aa8ced, 0x30378c907f8b9661
+, 0xabf5b515972e3e39, 0x13351fc00409e366, 0xf8158a83a715bcd1, 0x1075efd591d3f71c, 0x615a497530748d76, 0x68cd900e60cf128c, 0x3188311b9cf90bce, 0x3b62f5a4a657e89d, 0xa70c8e00c9de4687, 0x2b7c08a78eb9db78, 0xdd51b94bb90859f1, 0x599630161c92abd1
+, 0x5c9c85fe5b2c2d2e, 0x648d5b2a694e2993, 0xf57ee47d57034a52, 0x0f7dfad345ff1582, 0xa227aa6ff75c1967, 0x7b43760086b987a4, 0x60a5d68efb497317, 0x03f881b82276c8a5, 0xf3f4da0164ddc65b, 0x43493d9a6bfaca58, 0x2a1d10426ab3a363, 0x1b4cac2dfed5d1b0
+, 0xa5b070391ac1eca4, 0x4a270a8465445368, 0x5410d3b1fd13b57d, 0x4df5aa1746696d13, 0x2d23c4c98453560e, 0x0177d8b3ba8cab3f, 0xac8c2530257e63ef, 0x310d78740fce9a89, 0x8d8c4e562e76d358, 0x4d74490377dbbec0, 0x52e9dae912462f1d, 0x49be8fc4840b7869
+, 0xd9420113c850f9b7, 0x5eb3bc19c8251ecb, 0x46bb57e6ec7c99b4, 0x35451f80444c9711, 0xf3cc30ec44be9966, 0x4db36725283dba09, 0x5c61d920f12857be, 0x7a45c1e09f30b04b, 0x8a53a738f6a98f50, 0x6149931e42307174, 0x3bf2fd42c80b97f0, 0x5a23880bc43376d7
+, 0xa1a27464a926405e, 0x6984d079c4cbfb69, 0xe7837f06f4cd0fbd, 0x217d332f787b5ad5, 0xd572cc1aaf6464d7, 0x717f8fa8a2c1d36e, 0x8d709e58bc8ee44d, 0x11173ea84e0da76f, 0xfa7b291b4460fa4a, 0x0b6078ee858d5556, 0x706e2cf2f0132753, 0x4d2dd09afbe33b10
+, 0xd1c953c4829f7f89, 0x46be94ee2f3f291b, 0x7c78a37e1e816d6f, 0x3f694bde3a2d4dac, 0xe5af1f197accf019, 0x6dd49c1b6036ec20, 0x74912b774f6a042c, 0x620541021b9873e8, 0x9b72ba156a926d84, 0x3885829598a8951d, 0xb2c9134fbe03c08a, 0x3c02c43044a9e4bc
+, 0xc813ce182a1427ef, 0x45d3f6276e147fbd, 0xb646723192405436, 0x0207404101bc728b, 0xf2885cb5b3e2508e, 0x2a061d41ebf7c2c1, 0x683624d1886c3038, 0x1c0ace954325ccc2, 0xe5a3f05c2553d5bb, 0x4f57b9e6cf245121, 0x524c477812485c27, 0x0b6d89954a61ab24
+, 0x01358e79b71afbe7, 0x2710d62c813b58d5, 0xa58ba5317c33bc94, 0x590f933e85f287ea, 0x35667e8380750859, 0x6cc7b01a2fcb8605, 0x6ccfcb3b73a0ff13, 0x4820cf726240611e, 0x93f862efa1a6806e, 0x173e74626ef6318c, 0x34205f9c21c690e7, 0x38099b40e2560b5e
+, 0x068aac4b0dba261f, 0x17e413dbee0c0bbb, 0xd1331a9d83d46d1e, 0x4fcf8d3c43f0f40c, 0xace49e23d2307715, 0x3d0e32a05be00978, 0x0a7a8f5d3a11a22d, 0x62ab52df79c30ec7, 0xe13d5af0af06bf9c, 0x701da52a78e63f73, 0x6f8a118a9b92fc7a, 0x34c297ba44071199
+, 0x3dc1e3f2050346d6, 0x097c8c7abb7a50a3, 0xc9b350c9140c52d1, 0x06dd245539cf7008, 0xa0c55b54d55fb102, 0x05f11ad38877f602, 0x7ddbeb2ff687d74d, 0x7e34591b0834493a, 0xf5db46d45ad66426, 0x6e7261f047124a44, 0xd52f56783a9f7c8b, 0x6be65a19361543de
+, 0xb4d8404e0c48b3a2, 0x543f86cb88776f08, 0x22dd24126be356a0, 0x3d306caf597e9499, 0xabb4dd273c91e3fa, 0x273a5136d01e2dcd, 0x84a8604fe6c166ca, 0x29caafffcd0b0398, 0x53ad165ca51d52ec, 0x50b7d91892a69689, 0xb934c1d2a183090b, 0x2982482e0e2c9240
+, 0xa1198f4da9a30299, 0x4ac6ebc5b9814676, 0x2ac5284d24d60202, 0x07097286f637a7d4, 0x87cd86530245e43c, 0x5ee7c78f63410628, 0x68e085ce5502343f, 0x3864885aa529617c, 0x687ccc063b736597, 0x57dca8230c3f2bc7, 0xbc432c74448036a2, 0x4d4efdcce30e7b83
+, 0xea54c1eaddbdcb7c, 0x51b50688a16482d0, 0x03077ff082940ba5, 0x746e37282c271838, 0xc04bfd6f6be17778, 0x2cf3afd95e59f918, 0x39d2f5e0c459a07d, 0x7a09ec6bd67abffa, 0x0fa42470790cdaa9, 0x13205be6c97d6b13, 0x6628224820efc5f0, 0x7fe43efd82ae114e
+, 0xbc627fd2006f606c, 0x06c40c6474aa46bc, 0x512ffefa484188e4, 0x7f3c301d4a5da15b, 0x2e230d2aacb9f8a1, 0x7dcb53d3915eb889, 0xe0d656b063ff89c4, 0x30e96b2fc0b3f075, 0x85d49be016bb405a, 0x5daeed855b9a0eea, 0x549a1cf6b1c02a5a, 0x13a5a2db2080c558
+, 0xc7a333533ac34441, 0x5324896c52bf24cc, 0x4720884c5f1a7b02, 0x657aed03091d7a4e, 0x61720e06ea69f47f, 0x709714b691aaa3a1, 0xaa9abef895f88b40, 0x05c00e8d27695fb8, 0xf8081a97352cabaf, 0x30613f87dbe795d0, 0xb3fb0569c618318a, 0x59e592eb0b2d2caa
+, 0xe7125263bf03bf9f, 0x3616d1df99b57444, 0xdb69c83975f8bb7a, 0x1134b2abbbb9f70a, 0x49b1c3b500c9e8a8, 0x15fa73cdea72e216, 0xdffd4ccdc47fbe92, 0x4e13cd0477af22f7, 0x97e9ad6acae72cb7, 0x24b337364587117c, 0x2bef470a5c5bf499, 0x79d5e1f8dd99ee8f
+, 0x0175c45915c2dd3b, 0x1d10ee9913a81474, 0x37c24588181bbc16, 0x69ef511614fe2b63, 0xf5d5e0a5650b2249, 0x2a2925244ab41215, 0x51c9314c69d92ae9, 0x61dabc3b1035ef74, 0xdd68ad2b8e4a5bfa, 0x1de5a443239a3aa3, 0xc4046be5ddcf8883, 0x3ce66492d7ddf818
+, 0xe675ad156c1e4618, 0x53ad576f26f4efbe, 0x9c428d7ea1155bf1, 0x296ae5bc4e0d87b1, 0xb65f5b2e44e758e5, 0x433079930ae82430, 0x59ce9302a6244cad, 0x48a3d3432174eb04, 0xb9f62341c8112c66, 0x7535145effd1ce4a, 0xe67ca2e600c3ed86, 0x3a66ae35a2528f3a
+, 0x85eda03acc47919f, 0x198d3acc868b9a52, 0x9f8439a3fd8c48b3, 0x1f4704a867131fbc, 0x3575f439d912c1c0, 0x2ee520859eed5e6f, 0xc76e4153076f76fc, 0x518c9437cee440f7, 0xaec398a7ad4094f3, 0x74393f90793804e2, 0x0f35d4c614710314, 0x459f09998a92e4ab
+, 0xd4394f04672c537c, 0x3ea7a2b1abe6c2e3, 0x06cd7b33c69fff57, 0x194acaa0a915a92e, 0xd0dc8cbd8693da12, 0x73d058fb5da12f6a, 0x76780509db56d631, 0x56ebe862476afa37, 0x169b2e2136732589, 0x5fd5face5c1ec9f0, 0x43376c13a252f64e, 0x42c3ebc8fdf63efb
+, 0x406c4944ab2b85f6, 0x7d50ac5dc7d22ed6, 0x00f3488697e8b6a3, 0x2b6efe572af9b8a4, 0x2df141c3ca589597, 0x037ced85bfb19094, 0xe0c2211871a2f303, 0x5b1bedaa5ea50c2f, 0x031163247dd7f02e, 0x7ae44de93bb90038, 0x6872964a48ac808a, 0x1167c762413305b3
+, 0x77623c5e6855d991, 0x4868cc16a20736b1, 0xccf9bc5721e242af, 0x65e67b35b94d8a92, 0x4378cbb31f880e72, 0x1dbe2cf753c37670, 0x8657550b458fb292, 0x01bded0ac806152f, 0x6f493771eb7b6b14, 0x345ca8935be0a231, 0x9dbf272aad2bbc13, 0x6e210e8e381aeb6e
+, 0x45900400a69bb88d, 0x41e67e120c262125, 0xdfc20ab3dc438bb5, 0x6b3f73f4b1024ee4, 0xd9203af9c13f7e17, 0x68a017778d783658, 0xefe9669b3a3c5c57, 0x5ae80538b093ae7d, 0xf5bf198f6cada5ee, 0x33774ca5f70a9862, 0xee39f982beb78a4a, 0x48edc86673e32477
+, 0x5997dd7fe46e4621, 0x5066d6dd07d58eed, 0xe259aa27239cfd97, 0x4419fd62c5ea9940, 0x0399d5748533767c, 0x23c50bffced29cee, 0x7db583f156aa9f6b, 0x009faf0cd620e7d0, 0x89bdeb45b042a14f, 0x30a4b37407863d18, 0x374a2cc56abe9c43, 0x0231b0490ac4fa3f
+, 0x58aaf19be73b331f, 0x23750c0374ccea6a, 0x85a54383e3c2b774, 0x78ba9c5e7acc11e5, 0x0594327dd69066a7, 0x2964852a3febdfd8, 0x61eb5df5699c49c9, 0x41b9cc9fa18c4324, 0xde723e5832ea64a4, 0x7998f5f1700711b3, 0xf4a72f78569bee16, 0x08149f70b67747bd
+, 0x9388de3e50b54826, 0x4b4acc1e527e325e, 0xab6070ecc328dd77, 0x3b244fe6673cd347, 0x1392eb73da10d76c, 0x77ea8bafa6ea614b, 0x5bba1a149a51d710, 0x58bf2f2ab4ff2149, 0xbeeb7c713187c9bb, 0x7253d8373cb68f96, 0x6b1d1642d8571673, 0x5f78a2e169cfb761
+, 0xb14bc14166183ab7, 0x5d364e79c08044c7, 0xca3f675e96038dbc, 0x40a6107a879a8268, 0xbdb001323c72140f, 0x7c5701975de674b0, 0xbcb4a7f6a0118731, 0x37ba7dd031185453, 0x631c6bace575ae06, 0x638e4a1e9a8a1039, 0x3634a7592343acee, 0x0b5dc4cfcec882e7
+, 0x43995e9432d17565, 0x0cee4306c00433ae, 0xf6bda416299fbb04, 0x1110a63d80314b6e, 0xa05822453cd33892, 0x03942ee39d982562, 0xf69f4f18380681b0, 0x7b8d285a7f4ff979, 0xb45a49738fbde2c8, 0x116a536f028ae7d3, 0x7328b75b9126aee1, 0x45e6e3819891c3ca
+, 0x350367712c6e828f, 0x59b047ae026f04df, 0x761a7dfcbae10a8c, 0x517a19b63bd7e036, 0x458f76797e317cb1, 0x4e00b0c713227d89, 0xe882670404d12211, 0x4c2c5ba4d69d385c, 0xa8464acf7f6d6618, 0x7665b323033a47fc, 0x2e04b9f08febe02d, 0x2ad4dc240cef8e65
+, 0x00d0b1477a8d50b7, 0x4ed41c4514e25567, 0x99c30b92a40ca920, 0x11679e25a6a91fba, 0x608025df367bba56, 0x727dc4cc32e7fe6e, 0x0ac283a691209aa3, 0x419cb853f7370dee, 0x4ffb8b6b379b33d8, 0x0dddce7c88cfd43c, 0xc1f4642121be8ba7, 0x7faf656da96f0a20
+, 0xb1d0cd21b9618156, 0x7e0e04221399a603, 0x3db30e8abf2de6c1, 0x035e54bf25fc6d53, 0x187eaa3689d7348e, 0x7b72719c570cca1e, 0x0ec75ca3e367e8fb, 0x258244e63420d4ef, 0x3002852237efbc0e, 0x55625b33d3007012, 0xcaa5af473058287c, 0x45fabb9561fc8d77
+, 0x87bb9caefa213ad9, 0x4a83ff75f64e4bb8, 0xe60f6ea5b117d7f1, 0x691037b4114b2fda, 0x9eb799d32b171a95, 0x3dd78dc391b5e515, 0x6622839909d84109, 0x2f3029612fe7cf1b, 0x8a36d823750c1501, 0x7a4aad3a00f37804, 0x68d5a419a99510f6, 0x2b4f715a84fb8096
+, 0xcdf21b5e61138c8b, 0x743ecdfe0ee78ae9, 0x26575296a8fb6634, 0x4f1b5d702c7c8444, 0xdc50a83008463b17, 0x421a39968d4ff7d9, 0x3c69fef2ea423f85, 0x1e097c405dc426f2, 0xa4704202e468aaa8, 0x49b6180bd5d10d63, 0x833cfe866a76eb63, 0x034c12a4a3fea75c
+, 0x40d5210802e61b4d, 0x74adf16bcb3ac6b2, 0x7b340241bb6ad809, 0x65fbb20a581ab145, 0x62b617224957655d, 0x7c9f208b08786157, 0x6e5cf57d1242dc92, 0x401fdda4fc9c50a5, 0x858bc4a6ab5d236a, 0x0c7b493f056c4924, 0x4dc96c6a3563e0d6, 0x27b1ccc1df6ea1c0
+, 0x7614cc0a395b54c5, 0x298d3ce56b4e864b, 0x734f9cc92e8e7600, 0x3e2654baf8a51984, 0x2e1194b2f3de4f23, 0x48b5e1d1d52ae0f7, 0xf1c2cd16e61c5245, 0x17e20cd798b73c98, 0x02286df199306a3e, 0x45da7ca0b4ba0de2, 0x0b873c9c70dd78ec, 0x0cee0fd7b6bf6822
+, 0x1900a6ebf7eb34d7, 0x168e6dd5312dc9e6, 0x44a041e6f2cafcf5, 0x62311eccd6cf4b0f, 0xf5e014379b8c4853, 0x73d8496b310406f7, 0x0a09d45fce281e8e, 0x78e940f2346a7877, 0x19ca667a2d48da02, 0x5cb567febd1f5d37, 0x784100ed78e9c79a, 0x382ad480c3c1bdd5
+, 0x56a153a5b25bf4db, 0x74b5ab10ecce8ae0, 0xa8450d916cf44959, 0x15c5c3a47d16e311, 0x150991bfe88f4dc7, 0x64dc7063d77c5392, 0xc2ce4e735555c873, 0x59cc42d01f862f8a, 0x686596e8be765cdc, 0x5e2b24c04afa9a89, 0x798262027368643d, 0x4e6fe8b2d96a62b8
+, 0x4bc47a285401f7fb, 0x701390f0a50f75dd, 0x6a4d58b93080b0eb, 0x345053917c9cca9a, 0xe073b47308b01c58, 0x20779d0fd9d93bb7, 0x3193aaaa13386067, 0x5b75d323945dee53, 0x1a9be2b6847f851b, 0x0c4793c4dfe79e74, 0x08d460a4766c49d6, 0x53bda8b09b9d3eeb
+, 0x4ecd859060fc2d6f, 0x74e511da57b3643e, 0x8e622fe5b5e90632, 0x12f8c2c59e207088, 0xbfc4b85ae668b23c, 0x072f768483aebc58, 0xca6a147f81d04325, 0x252884a823923d4c, 0xb1f295df28d22d7f, 0x7b744bfdad631c51, 0xfb6749e68f49852c, 0x2fbefe9e24feb67d
+, 0x0781dfd0a33aa0df, 0x3aec5f29c7cb5819, 0x054accdbe2819105, 0x7da595c606de0979, 0xfa89eb8f5d4e09f1, 0x38f73959d15b505a, 0xaf814c478e4da742, 0x1207fc8231020a42, 0x2bfbe074279c17c2, 0x464ec2bff5fbcc3f, 0xac185e8b62069c95, 0x5d89bc6b543dc7b7
+, 0x28da1b678056a54e, 0x4f14d2e380c6d349, 0xb843392dd05b3adb, 0x68fa5c72533f6c26, 0xe164844bd27135b0, 0x7140f2fba588aee6, 0x0f1a23007d6a0509, 0x646d4250fa517723, 0x7c2b64f2346f887b, 0x376e80785a2a0cf9, 0x9c7c0da4d2a4424b, 0x27d6c355c3978f78
+, 0xff438df757ad8b64, 0x36c1180a92baa747, 0x0ad7050acfc9a946, 0x6b240ef47aa1e44e, 0x4e63abd39e0217dd, 0x15da1449e3885b89, 0xa13ec3338974dea5, 0x31438efded9332a7, 0xdf08856acb2a3c77, 0x63ef5b3915f5db86, 0x4c8f49f080ba5c65, 0x2db8bab000da84ee
+, 0x3660bc65780832c3, 0x2186aba26ed5bb1d, 0xb993d3d6e90298d0, 0x0eded72e4f0a18b7, 0x71b09fe720879671, 0x58a03f02ddd87c92, 0x02bf9386eda6260f, 0x3662c70ff2939ce9, 0x3db4372a318ea56a, 0x28758e69d7a80733, 0x4f85b647b230ef39, 0x01c8abdd69d68c82
+, 0x2314868b859766d7, 0x492210d3d23723b7, 0xd6a66aed8737cbdd, 0x707f46ac911198eb, 0xfbd17c04ebb8417a, 0x01071a446bd364c7, 0x65454538bf6294e8, 0x437a658d39f520e7, 0xc0146926c709d0b3, 0x43b2afc81227bcb4, 0xb75af7a760097313, 0x6c78b0f5625ecdbb
+, 0x0cb3d48b9517b3b9, 0x23f2e44a7024fc54, 0xf9811401659011fc, 0x6c74ab7f8e7f306c, 0x37158e229e201180, 0x4c8b0431706b05ae, 0xab4444cde4703d3d, 0x35f0b0598bd76b9c, 0xae4ccefb0cfda7b2, 0x20022ea599fd78e9, 0xb0e6922d7d5ff04a, 0x1f8489a6baf14790
+, 0x9917b838d10a9eec, 0x2f2184a166633f80, 0x3eed33e6663f3987, 0x763748cbebf58abe, 0x177e5512aaeaec9c, 0x7b7161332e71a1cb, 0xbf9152a751355de1, 0x264c5c14a79b56cb, 0xd5df7adbd4c4e77f, 0x1c658c3d15155415, 0x8408eacb545d09cc, 0x529145afd9afcde9
+, 0xb0c58723d0cc0b42, 0x0a034794509f14c5, 0x9720ebabf7fb1078, 0x44d6a3df142769bb, 0x86f0ea8e89902ae2, 0x4a28f120e7907642, 0x7767347cfdd89c8a, 0x3807f0abdecc49c1, 0x13bd4a5d28e43270, 0x18e0008682fa790a, 0x6b0507021147b119, 0x498067dd72369b35
+, 0x7b22854d29618b35, 0x2ab9e7e899c9a308, 0x19bf5c565c9b1d6a, 0x73069e660ad166f9, 0x9347c84d4be44ed4, 0x5ab149a9d006e3a2, 0x13b0284acde8eec7, 0x78729a7b0d3d3aca, 0xee8e33a71b31bde2, 0x5d543f842e023552, 0xd857d2f56da12399, 0x2129b696f5097614
+, 0x71218328cfd91f15, 0x43f5fad4b95b2bce, 0x1fbd5930def7bbe4, 0x00b5d541160e43c8, 0xe33a55018490c6d5, 0x7039e9f266420c05, 0x0d9dbf0a97a87bd4, 0x185533fd8d3f9234, 0x91e7d29639090892, 0x29914c2e8cf9b8d4, 0x2742575aed9a9b2d, 0x05ea1717c1382716
+, 0x8a70e819a57552a6, 0x4771a5c7ffca1df3, 0xb6e10db912588dd4, 0x620c8f698964fe46, 0x115cd1d92be53fd4, 0x6fd9dafb80ac21fa, 0xfc2dda007aa11ee4, 0x729cd16390ae04cd, 0x532579ef729555c0, 0x7a8b5f487656c8d9, 0xffef296b860a97a7, 0x1da8faf19c636704
+, 0x32dbfd485739717d, 0x18f3ae5492b44665, 0x9c0844dbd119712f, 0x7842f37c2c0301c5, 0xb70580b7513e7f69, 0x6913176568a32b2a, 0xbd0c7a8e2ee7ad31, 0x1b9e80ca5e0899c1, 0x4b767adfd7ad9d00, 0x7aeb4c9f0cfa420d, 0x1189ebb7ec2ccc9f, 0x1af358a898741b3b
+, 0x599910d58d347d62, 0x0833414699c59633, 0xf27e510ac1295793, 0x48f8efc58b01c2c1, 0x437491de8d0bac63, 0x464c35c80def0069, 0xac8c12c87394e1cc, 0x05a4db38b07d8f4c, 0x5e855d6d91991e4c, 0x1c13adee4a581df7, 0x40b7421e918233c2, 0x38d3828ed1fb65c7
+, 0x376680b2f9b02494, 0x10410ef0773d3af2, 0x64aff3ff5e627052, 0x71c0f0d0e8bd17b5, 0xe76b1ce4a746a192, 0x4b59e278a3ef894f, 0x57b91084e5b6e1bc, 0x4c33c7a8083eb519, 0x1c99216e82369134, 0x508ea71f9aadf009, 0x5a6de3a077c7c14f, 0x01a87460c85b6b18
+, 0x2841770cf261b51e, 0x0152db3e9de81b7e, 0x8a6156342bf75848, 0x575ca150ec7e992b, 0xe26886ff6131478a, 0x6eddc1f84403aae8, 0x93e34f2f8780f2c4, 0x5f5f42a9b7c195b3, 0xb62f8c2698bad50c, 0x451b5b2293bd26ff, 0x9be64cef0a06d31a, 0x6a85c8ce5bd0b877
+, 0x9e7d1e93ac5500f7, 0x479aca061772805f, 0xcf009eb533f5fc94, 0x21664df5dd34a407, 0xd3490cc149d64356, 0x5e5938d4870bdb65, 0x2b976a8fdbd1d73a, 0x18c79c923f3ad521, 0x2a8beb5ee4b28c39, 0x68fad6d8b66cbb76, 0xdd407103e081d91e, 0x3a6383c93be31ca4
+, 0x78035229b27404aa, 0x4601451478bc50f3, 0x0aa2b89deb1d0657, 0x60565f8f68cfb50e, 0x5510a97e669039d4, 0x1ad77fca7aeb5e19, 0x556bdeb53d039a21, 0x7e165feffcf73440, 0xf8bcedf1c186fd99, 0x5339c58eea707404, 0xa8408c76d1c317a9, 0x7d95a73d2f4d2bea
+, 0x5cc8923b1a1724b9, 0x716d5d64069edd89, 0x79fbca15fa22c89d, 0x3db72327f764a621, 0x41a99660267de618, 0x640bb9da129a9323, 0x7d4e7c0ca0f51d4b, 0x102b6fbeed079da0, 0x418344bf54724595, 0x253228543283ea05, 0x6ca0f0cbdc93779f, 0x546984edd807e93a
+, 0x82224b6406ce22f7, 0x3fe26e1194792886, 0x39dc27fa28229e4f, 0x405f3960d3e4351d, 0x2be08685341e42f7, 0x295927da3fa53f8b, 0x04544fcf26c5537c, 0x524d6c2cd7975eb4, 0x74b3eab940a32d52, 0x100aecd541d61828, 0x6efa42384a6d86c9, 0x5736a24a97847580
+, 0x9bb3afa96db9ee18, 0x70d133766f165f73, 0x9ef50ac9cfe3f077, 0x6e75baa0ff414518, 0x9c05ee2c2b2c4ecf, 0x76318800f82a967e, 0x2554a0967343fee9, 0x249c2066fcc6c865, 0xb9148e8f3fe4f739, 0x286dd9bbf7d86a43, 0x0d2d15d41846dcc8, 0x2cd781b5ad4dfa0e
+, 0xb57eb48f4df078d0, 0x0705e4661c21667f, 0x62bb7e67a676145f, 0x379b3af849d0f5d6, 0x8bf550c8724bdb3e, 0x4f15afb9b32be01d, 0xa7c22168de9d5277, 0x2277d13e536bb176, 0xdf4b34b993ae96d9, 0x7de261997d43bffd, 0xb05295753b10d42e, 0x505ce8c2564bf182
+, 0x70ef3dd256996aff, 0x576441a729fac1ef, 0x35b650efa4a33f24, 0x13f9ee0aabfcc75a, 0x281706bf0ec11fe8, 0x7e61b04547c9f131, 0xc304270a1a648629, 0x540ef80e5523a2dc, 0x8c263bcbb7b93feb, 0x0de9c8c8607dd3a5, 0x8ff6455c27d45c9f, 0x0ea96ab7a22a7239
+, 0xd233f9438749606f, 0x2b4ffa8e60b3d7bb, 0x7a7c11996a478e81, 0x1613705b522f09ea, 0xaf5cdb142bcc54cf, 0x1065bd6d50b91443, 0x76fcf403781d9bc8, 0x649b441255afc87b, 0xb0e28955fc277d7a, 0x093509f25093549a, 0xdd60695c6ecd7042, 0x28d839594436dd71
+, 0x53b2fdb5d38889a5, 0x468677bf6fc3b896, 0xdd819c7a270bee43, 0x5678b305ab1cbffa, 0x874ae01d6de9557b, 0x3b5c4f8f6470ba2b, 0xef5cc9da2b3379df, 0x79757871a781bb35, 0xce5a568234fb2cd8, 0x45a52b1e4c5b3eba, 0x0310fbe398ebd164, 0x6731c86a7f82c27f
+, 0xf3f34bd0696ec132, 0x2eae16f697995462, 0xd3d517cade2988ea, 0x5c14d465f0fd22e1, 0x5e19711e042ca5dd, 0x23cc11fc8b077da6, 0xf7308c7b260b62cd, 0x0378aa2564769dc5, 0xe713758a77688199, 0x7b65bb0489656a87, 0x40f093da2d49e8fc, 0x4faede4573d9fb68
+, 0xae789e641f78976a, 0x472af5bcb427302c, 0x777338e4b32244f1, 0x615fd491534f662c, 0x2ea16bd668fa1ae0, 0x2b42d45d4f88595d, 0x20791564cc06da76, 0x40a160867a91d199, 0xc68880e4e54c5196, 0x3bc9830b68d4f64c, 0xa1a28e36a65139e5, 0x18852b1b10aac3e3
+, 0x45427295e12d91aa, 0x22dec82ca80932d5, 0x38adad929fa10f55, 0x53dc58df8c604508, 0x1622b792d9fbcab0, 0x6937f19569e0f4aa, 0x41b2429ebff4f7a5, 0x3e1e03ba6a2707b0, 0x2025b5d8de63de6f, 0x31ed33438e8af236, 0x5d4229b466062712, 0x0985d5799ca63878
+, 0x4209b067ba0994cd, 0x078f92ede7160f3d, 0x88dc90bf72f6fca0, 0x4b90d2a2265decd2, 0x6fb22de94e93b978, 0x244b17a008aac4e5, 0x2dab07638d53b69e, 0x63b59f6d2190135a, 0xd855f79114de36c2, 0x76c12b45b0c95fdd, 0xc5b77b9d01904ca4, 0x62dadb0a8b1d3c74
+, 0xa2eded3c20b266b6, 0x216999a8e41841a9, 0x16d2a749eaac27e3, 0x222c6f09aa739cc1, 0xe0805c80d99d6687, 0x160043cbcc6a414b, 0x08a55c2cab87f93f, 0x78d3837c71e7d11b, 0x0b43f47268fe7568, 0x14336cbbb0578745, 0x1ce15d8356f4931d, 0x244ba962ddf06677
+, 0xc39a8f9330f92939, 0x1504a5e2d9a5d09c, 0x9b3cd58c5ee33a91, 0x207129545867eed7, 0x37517a265e1ecb33, 0x183080458d04da8b, 0xfdb1049fe0affcce, 0x525eebc49c8ed3c1, 0x22121bd4d0ef4967, 0x03704db89667140c, 0xe15c6a5190dc6974, 0x77b0ef96c670a365
+, 0x3c67068839c33133, 0x6cd667d5eb121982, 0x91fa1fa391c53fb0, 0x4b51aa1634736b8e, 0x51733f89d20a4d8a, 0x36989f3531669d05, 0x3aac50bea25a0500, 0x5d852b4474f7cc4c, 0x05af4c6cf037f05e, 0x7cf131a9cfed1f2e, 0x8beee60977cf939b, 0x5c56dde10dca034c
+, 0x26b4c472a0629777, 0x4c418fc1876abde5, 0x0329a78405d530b0, 0x65f322e1cb1bec61, 0xf49be8c2913ba232, 0x0559bf3b8d6d2b9e, 0x03a1f864e30ff5dd, 0x35981313fb1b15c7, 0xbbe9f658e4d52db7, 0x5ecae99a5bb23253, 0xebfe8a8ffe5d0894, 0x39a57589170ec236
+, 0x2be475295fc04bcb, 0x6ca6d46a8391cf2b, 0x25786f756339097e, 0x56185101ba11e47e, 0x55fc55886fe06a5f, 0x16edf156aa5c8280, 0x865c80fb7d36c73c, 0x1e1a9684e52589c7, 0xb9541067632aca34, 0x151a2a6ff5c34791, 0x1b58393eb03fcb87, 0x728cd8308c06d5d2
+, 0x2ef271a01787a56c, 0x502a0ed0441cf82d, 0x5e8f818e256c0caa, 0x35685e5b032a354c, 0x2ca5d525025df68d, 0x54638e2a16773afa, 0xcc6499e6798a9013, 0x6e61b33a73d150bd, 0xdb706a4ccfc17f37, 0x2763f83e1fe53f51, 0x9e86945a33007d48, 0x0a1be208b6fc7c13
+, 0x76dba417ef4f9d5f, 0x563e716c45e94db4, 0xd22bef90c23750e5, 0x15421bb0e48f5cbc, 0x522121dcd06c68bd, 0x01b2dfc85b6eee9b, 0x89d90c298be295f7, 0x5a5f456567d1bb4a, 0x0db7f16253e33814, 0x364f904185a5c6b7, 0x9891ca4cef3a89bb, 0x700185482580502c
+, 0x1aa9f59619134244, 0x2d99517d389833fa, 0xe02e4a189094fae5, 0x3cda95dd98e29f96, 0xb3bcfa7d4c1a0bbe, 0x1e5540988a494f54, 0x8c606a8bf41558d8, 0x5508d60675c1f65b, 0x7bffd1fb9680825d, 0x55e85012bc804031, 0x7e584af0860bcd40, 0x5cb3df55fc8c4285
+, 0xb8be14650fc13610, 0x50fa797d4ad46096, 0x3c44960f6151c40d, 0x32b16c5321334526, 0xe94502414f39dca6, 0x38f2e284e91ee3a6, 0x969fd531da78b76d, 0x238025f813abcfcc, 0xd863c7417144bb5c, 0x01cf1d48039058f8, 0x6af5fd2c810823fa, 0x2c1ccd65726c8a1e
+, 0x8be45d3fb757b767, 0x16bdef0c2927b810, 0x4f337ca659b9b86e, 0x4c71a1e21737e740, 0x8f9284c2cf26125e, 0x2e124ab6a6a5b9bb, 0x6bd1b8b048a49124, 0x018deb3ccf0df534, 0x7a801fac3a4c66fc, 0x24e4fd8d63fc387a, 0x4292c5888892a300, 0x6def60090f4479fc
+, 0x57233e6738dc9a9f, 0x7be254fdae4811ed, 0x4319440d67ec592e, 0x6f72f371a60e4e05, 0xb42b2abb8297cb8c, 0x4bbfe23265e57398, 0x715f92d4bb4acad5, 0x7dd19a885450a1e8, 0x5152712cd3db21d6, 0x437d50f021b16d81, 0xa3bc971cdfbc62c2, 0x2a9baeacf48c8ee0
+, 0xc02c1976c694198a, 0x657344ef9292d427, 0xd0d62a95e69062a9, 0x157553ec18278068, 0x50c95fcae37e1f66, 0x3dec576fe5b17ebb, 0x610dacb6960fa495, 0x07d9ed23d4e06534, 0x3b132a19257300dd, 0x66323b30a08d9cac, 0xe3d4703f59b82800, 0x7af025db2729cbc8
+, 0x96fc63246d789d14, 0x79d1c0db7fd84c36, 0x972a337c6cdcd0b9, 0x0308fb2f854aa267, 0xbe9b970d81d7607a, 0x00b612ff4bb8538a, 0xa8fd5327c5363792, 0x496e6d4e6a838f60, 0x02d1f90cc6b3b2dc, 0x4095a2bcdb44b169, 0xf5ef89cd17f21c63, 0x0a528af6abd341f0
+, 0x362fedf04ea6c27d, 0x78e7f97f8a92273a, 0x753cd8f39ba55ab6, 0x3ebd2c296649ea14, 0xb4873705e72b1cf6, 0x6b6ac50a069a5f92, 0x4a31bb4acf53062e, 0x0a6616eafbb66de2, 0x2ff2208e4ddb2359, 0x06a5dd65363df761, 0xaba9a4c369ce8322, 0x62626041ddd54d5d
+, 0x38ccca66c0ddacb0, 0x69d699cbc576e7b8, 0x9b1b84ba01a70b11, 0x324dd9280ed8d1be, 0xefe22b81b25e3361, 0x0bd202321efd6bc9, 0xae6f1aebeab13ace, 0x08b2baa55141bc05, 0x5472dcec8650bbdc, 0x758914235bab2031, 0x891eb749a9974b94, 0x6eb71f442355d4e3
+, 0x663017e95ee5887e, 0x2fb1d8a23298dc80, 0xa5d684ce4bbdf031, 0x47c1687d3d761093, 0x02d34c356695256f, 0x2e5e5ebeffbb55ee, 0x69f1abad395e7eb5, 0x3189d0fff203e383, 0xba9a7f3ed7b16845, 0x023376ed9e81e8a1, 0x14842aa28505975c, 0x16c322c61fc6e302
+, 0xa647e6e604241510, 0x442ffba3ffd5bdab, 0xe9ff24afcb487939, 0x5e0726dcde67b31e, 0xc5885964c6caeb50, 0x1f3dd7306e543dc7, 0x94fbbdc82bb24573, 0x5ba98083f029b1cb, 0x46561bb237267190, 0x4ca0a63f6ea074a5, 0xfda43a83f7c3eff6, 0x64dfa26199d4ce73
+, 0xc360f9dd9ac82b67, 0x2231a1c971626a52, 0xf870cec87af081e9, 0x0488092c25ada377, 0xea4e2e2247d5f866, 0x668f03421bd7e64a, 0x6466e342d0ad2aa1, 0x1517ea74c22b0bed, 0x192c097001dea16c, 0x39ba0a52f9e951c0, 0x0b16fa95e1cc7314, 0x7c394db380a6589c
+, 0xfcb35706a1488563, 0x4ef0091b204e0324, 0xaef736b269f5913b, 0x58f0e8eb90895cf7, 0xeadf36697addf720, 0x208bbd837aa3ea4c, 0xf86ceef9828928f7, 0x67d7bddde900becc, 0x655cb127a738bf75, 0x77fe1953a5f205b7, 0xca93d3ae3466fc93, 0x230c36578428ca6a
+, 0x4e0f4534d3b84f5b, 0x4626d429722cd8d9, 0x61aee4e641bbc726, 0x75944532008be545, 0x3e10e84f7367743d, 0x13298fbb32414ea1, 0x1841a647910f31d2, 0x37bc1c49b09529de, 0xfd9c5b36d2352f2b, 0x1a8a138facc9da58, 0xb3074bc109f4468b, 0x182289e5e5a4129c
+, 0x7a017797122152c1, 0x5e4f9a26a071dcaf, 0xe0ec3e7a481901e4, 0x40674741e6248edd, 0xa41b11a44bf765c2, 0x0758bb6a896254c3, 0xbc44cccb9968f8b8, 0x7d7e84e645dd3284, 0x5938f711c992c4d6, 0x1ccc135c15333904, 0x60e39af39ab50cde, 0x5f7ee48af4b62729
+, 0x47bd58b238ccd0f8, 0x1482f03fd7f3ba0c, 0x29671bfce435f291, 0x41038e6f69ee2039, 0xfe1cf21996c116d6, 0x52db8acdbb2da01f, 0xd1d531260dffb5df, 0x04b4873d841bc972, 0xcd2fa6d2eb854936, 0x3e8e2a6ae6384af2, 0x88114ba5d9e19ad8, 0x75d5e1b73dc889b5
+, 0x98a4e411d1694d38, 0x07b49690b7eda607, 0x463d1f9c46276613, 0x279a09312146adc0, 0x788cb0a9bbb5c680, 0x0bf219a48c32285a, 0x9b5926e8bb4d33c2, 0x38ddf6cddbc34c84, 0x691ec183fa69954b, 0x0fd0f685024a731d, 0x333e13fded24b530, 0x58851ce91644b575
+, 0x6b75a283900031c9, 0x3071bb008bd4e725, 0xe08204806e1b05b8, 0x7ad0d7787975b651, 0x14424d412b348272, 0x7e873d2b69c89f47, 0x74658795ce9795d2, 0x1eeaaa54f5ab50a2, 0xff1c07594fcd932d, 0x2d0ee14cabd77383, 0x6bce2b3732faed34, 0x6a8cc577b7d3c1cd
+, 0x2df40ce0fdaac83f, 0x10ec16cd845d6b94, 0x316d250298d393ee, 0x64e2a8d2398b3582, 0xc1007758a2c6f800, 0x5499b9019f2dbdf6, 0x12dd934de41a4ada, 0x2728eff575b45a4b, 0xf7c61c46e28afe52, 0x776dd87c5565e3ac, 0x1ec0db52e6c9b7d9, 0x042ad15c9cbf2f51
+, 0x6449399c7d209f2c, 0x3565a6e61534bcc1, 0x3610c5e8c079d76a, 0x6bd9e33c5dd2fa34, 0x4fda14ac5271f80e, 0x19985c0472786fe2, 0xacc3c67163d2b64c, 0x73224dcee938d587, 0x38274dfe8f6104fb, 0x2212f8a23b9bec47, 0xe43f0e3ac79eaaf5, 0x3c633c5c0efabf45
+, 0x24c47d3f8553d867, 0x504c0dd0a4b3f940, 0x861b7e3f23139042, 0x08fedb3ecab3e3a5, 0x28daaaa7d91c4424, 0x0950360ef881d895, 0x4e253d1a6396c8fb, 0x15839744934b82b6, 0x70f544f797ad0626, 0x073ba6524ca89c35, 0xfdc06884e8eff137, 0x30d821526b03b06f
+, 0xa221cb5a3dc0940a, 0x3b426df166779d6d, 0x2ae9502fde2c0e51, 0x15829780fdef5efc, 0x0994fc78f20152ec, 0x08fed98a2c005b7b, 0x4eab63003a6cdbe4, 0x47481bd1ae52c79d, 0xe69ba366dbe017ad, 0x4f42a8b1977fea05, 0x5b5570571b866a1e, 0x698411e4296cfa34
+, 0x349047f837e75fe9, 0x2eabe8dd653ad56a, 0x84e5475077fe9311, 0x5065a7ecfa7fcdb9, 0x99a656254c0cc24f, 0x65e42c30aa733a8f, 0x9cf8a3ce6d9c6579, 0x0e393228c1f68070, 0x7336fd1f7f901461, 0x0d28e06a71612962, 0xef110dfd8b588f11, 0x49590aa711a75147
+, 0xebcaa368cb1ec685, 0x617a3a347ec37c16, 0x5522541124b0b846, 0x280ab8d427af8971, 0x5e844a80701030bb, 0x0b6bc6d57007d5df, 0x1cc269c79d42dce5, 0x2fc7cf8b2ceb3c3a, 0x3ce955cd9d1bbeea, 0x4562c343e01bb1ca, 0x800941e47c1ec609, 0x6675d402adb48776
+, 0xe4a944c8c9873d4b, 0x491906a4c68a427c, 0xc85e76d0a1e64722, 0x4df8d0c0fe0d4288, 0xaefc65c2a4b554bd, 0x37936aeaa1d4f172, 0x98732b89e91c783d, 0x3513fc8029ea27b5, 0x7ba63808735f34cf, 0x5275a8332e9fac71, 0xbfe35b9a2a8c68fd, 0x50527043eea2b727
+, 0xed8b55e256116b52, 0x4f6430c78e90dff2, 0xfba2ce3dd7c9b328, 0x6a05ea2044278728, 0xe6a1fef42783177a, 0x7d86694f42e2f38d, 0x01e3b436cb4079cb, 0x2a2e6fef7bac2980, 0x10cd88becefe7952, 0x02f237da18c8a8cb, 0x3df718340d200e21, 0x579681081938ae8a
+, 0x82c25181289647d8, 0x7a4dc3606f37e6ce, 0xe917d100197ea393, 0x7fe4694ad5986bd6, 0x3543590b66566872, 0x77222f0e9d50b7d6, 0x15ae13314f30b814, 0x0825187fd54e55bb, 0x59ccf6a5aa8baf84, 0x409a6503128e4dd4, 0x189cbebe36a9bb85, 0x7b5aae0cbca830c1
+, 0xdcec9e8f278c7516, 0x503e5ede3e1d1064, 0x4eb01cc1aac604e5, 0x1dc18e3197392ac2, 0x12eb8afb1767cd26, 0x68b2ea0c9b6b32fb, 0xfb0439ac0287015c, 0x5c2124daeeac46ae, 0x1a1dca4c6b6ecb06, 0x7accc5f4f93ab71f, 0xcc35e69292e662f2, 0x7fc04cebcd57461f
+, 0xd7713cc51ffdffb1, 0x70b7576114a0e702, 0x62abf88dc5362881, 0x2cd007ae8bf4f285, 0x53c82d4fb23cfe2a, 0x2cea4c96a7f3fdfd, 0xc961e9f2aede27a0, 0x50531254c25fc480, 0xfb05d2d6b7fa3f3a, 0x34c0d331c8da8413, 0x6ada5b8661f9f6db, 0x0c2df508e3b6b979
+, 0xf2edb475954c3fa5, 0x6be5bba2560972dd, 0xf0933cda6949f236, 0x532afe73f0ecdace, 0x460cd45d9bc0564e, 0x3b4cbd80aa0a5578, 0x57093c8458b8dbab, 0x4acc5045f48d0e09, 0x4b4b4242c75275dd, 0x4026729b9e909ace, 0x12661476727521a6, 0x3be4e520ce98bc4d
+, 0x23cf662688e8e5de, 0x737186af4a2de956, 0x364c3a664ac74712, 0x35fbafe4d146db53, 0x70137f8525dc216b, 0x52bcb6d04a727c36, 0x32c02a6a60ae8717, 0x064b07e090e0192e, 0x43c1a5f7edcde7f6, 0x656bf8a42012428c, 0x1f30477464f6a3bb, 0x467b087c150d49b8
+, 0xdef3d4938de868ba, 0x0d2fcfbc721057bb, 0x3df4484f2a01f3f1, 0x2837be111234194d, 0x20690e820a385669, 0x31957bcdca4c00db, 0x35be47e11429fa98, 0x22e19499b6e370e4, 0x24c4f389b37f3d60, 0x086c1a5db78acec2, 0xdd98063aacc977a9, 0x504747731eb4d2ad
+, 0xf261902a13777b34, 0x10f4b2dcb73a919e, 0x6a9b2873e2f6ef52, 0x0f6631fca61cb8f5, 0xd3f9a8b062fede25, 0x4e9b277cddba660c, 0xc0c24ef19fd183d3, 0x60e5145931324065, 0x12f97930efb99fdf, 0x0a85c1b024021721, 0xe7d1cb74b70e1ece, 0x4288dcaf240b2d23
+, 0xa4114226268c9a3d, 0x60e77292efa386d0, 0xf8ed35724ab48b0b, 0x2b8b1ed5821a5640, 0x1f6ddb34970567da, 0x09735c177d9bcd19, 0x78b3f77fabdc6f9d, 0x12eca339541f2e9f, 0x67948f609eda848d, 0x242a0b67a9353dc2, 0x5954aa3feb74f9a0, 0x6f8280c953a0cd87
+, 0xcf5c8d9f3b9c3323, 0x19e870329caa5ae7, 0x5c73b214e4fd7e0b, 0x241d005b63110a45, 0x832b3c4a02aed3aa, 0x49feda1046881b81, 0x8f245d4b9191e156, 0x47bd9db0ae8fba16, 0x6caa8e42a2068826, 0x3f5f410d39c40ded, 0x3a3469f61857c5a6, 0x3d1d8c60b458cdc6
+, 0x7eb8887cbe55d443, 0x54636c176e6efb70, 0x572eb41419d9884e, 0x356f195791f65cd9, 0x40b90128a1dd3b44, 0x2d69380991d8d618, 0x2454cab965e20528, 0x66c8297e78dee038, 0x16a332d1d7811fa4, 0x1735c9d45d10bc35, 0xe72f6222b01ee203, 0x3d81405331358346
+, 0x5e1a8092dab16542, 0x3bd49cf8130f9baf, 0x4b5722414b7aaeaf, 0x66e6f85fa48f64c6, 0xe3e3144f86eb6b14, 0x202c96029390e84d, 0x19e47869ab236eef, 0x4ffac16110816ab1, 0xe1d9e80d23ee512a, 0x50b375efb8670907, 0xf57c25588fc4239f, 0x3835e70037d1c842
+, 0xc538628b1b62530a, 0x322721d1db02c455, 0xf5d47e127710c696, 0x258132a27e9d1f0e, 0xb3c7f50faee82a04, 0x336157bca2257b01, 0x40ab0252ee3f7d8c, 0x48dd907282bb819b, 0xf8b0a87b3f4b0fc2, 0x4031212f976e417d, 0xfa09000687112cc6, 0x4013c14c342db054
+, 0x511f887f480a9b0c, 0x721d692c2eb80de9, 0x3f1d839a6c4bdf23, 0x32d8ada7882b717b, 0x006fa68532032c77, 0x35394a6d6bc96eff, 0x767189a727199714, 0x4eb19eca17953b57, 0x40018c2e6e77f283, 0x4abb26042621028b, 0x5ea08d4f332c0fbc, 0x004fd71f0c9a916a
+, 0x7707cc7f6f4df084, 0x6ca5a966db896cb2, 0xd66b16dc96bbf212, 0x060461aa3398734b, 0x47d68620f87d7292, 0x0bf6762a4946784f, 0x3631188ea3435486, 0x5bf249590192da32, 0xadbadca4dcd535fe, 0x75e38062e2bf02c4, 0xdcb9060493175547, 0x29b06cbfd122c1ad
+, 0x69dc48eaf06c199f, 0x6d6ef6bbd7a23163, 0x7b19b63f0f201129, 0x1a318eb60bdec0fc, 0x315d8e7a8e669ca6, 0x000bb9e5e45aa3d3, 0x75add00daa7f561b, 0x5b86476d28a5e669, 0x1e1711af00f113d6, 0x4368e75c48b05ca3, 0x3c486c3fe65a1fc7, 0x6b2fc509a35cad05
+, 0x88dd4cb64c64f778, 0x267effd0b6a4c0e1, 0x5f2626a46e6159ad, 0x0b6032b7ada705b2, 0xd8217bf361e45eec, 0x7d96023149445db9, 0xc15968acd1125df5, 0x1ca5d949775150dd, 0xc9711c9643f8f467, 0x6dd0e6cea071549d, 0xeda49f59c07abbc2, 0x43d252cc516c23d4
+, 0x0c63130ca776e583, 0x5960542d91efe251, 0x67a43a430535c4fa, 0x0c9eaaa160269aae, 0x4bec86ac041b1f34, 0x6e8dc7e77b80e8be, 0x2377f71baf3822f9, 0x6badf7defff4a7b4, 0xe88adb311d40d48b, 0x2482940931b2778f, 0x820353c16b5f75a7, 0x15b52424339898ec
+, 0xe432173ad41abad0, 0x45e37a451501776a, 0xfa365184c40440b0, 0x5a3b466df12d0213, 0x495745ed52e78fd4, 0x22dc0d25f93d1374, 0x4aaf037753b37846, 0x5efe0fa364e86db7, 0x46a43c7e1ed2af08, 0x4ddc62e26a667025, 0xe9057da7fd589282, 0x05341fa624ab625b
+, 0xf73f4de3c94c854f, 0x770fe21a96d2cef9, 0xf703ba69fc4e6047, 0x1506ad65c0b38e34, 0xd8129f84a6f09cb8, 0x07ed2038efb9568f, 0x58c36722cd3dcda3, 0x17480199a749c5f3, 0xd09b08e8299728c0, 0x5b7f8507cbefad7c, 0x38d4f47ea1aeed8c, 0x3b2d7d89afaed22e
+, 0x05691d83321b840a, 0x2785acbdb24652f5, 0x81c100426a402117, 0x45e61f418610bede, 0xecc406011e4b8486, 0x14670a2050897b8d, 0x5ddfca4c2c526efe, 0x7ceae067a5a36b48, 0x467db49036dff82d, 0x475bdd22f359e9a1, 0xc26a126c4901c632, 0x4a461e269b0f1171
+, 0x487dea209656883f, 0x3adc0be428ce84a4, 0xaf319e3dead2dd82, 0x20f12784baf464c3, 0x8d4c91d2a7469182, 0x3cead1bdf3805e76, 0x3c834ef0158f45db, 0x5b83d3b4f3dfb123, 0x368e62c0c3b8f470, 0x10af2c51952072bd, 0xf808dc494275662d, 0x4b4df9e1d3b5217b
+, 0xfc00439ee4ce60d4, 0x01c0ae9affa6fd0e, 0x67ff95fcb55a1eaf, 0x14ef6a57e46c1d12, 0xc3b4ba9daa7b314b, 0x455592d3adf84366, 0x514dbbc641d64250, 0x0924f909934a31e1, 0x765e392d81dfd09a, 0x67dea33dd2c82cf6, 0xf358750263be15eb, 0x2c122c12c32ff7a0
+, 0x71d2d118f08c75c1, 0x6989b5782bf5b29d, 0xc982e0669dd22633, 0x5037e85e166e0b07, 0xbf658f68ccf5b300, 0x35a6a47992cb39e5, 0x818f6f7762a59ef3, 0x7f4bdbe90772ef84, 0x7aa58dd4d4f72591, 0x2770e83ea25c160a, 0xb492e677db55102c, 0x4c3b869f96805d15
+, 0xdb914161620be3e9, 0x481f4d2fe1a9ebf1, 0x2860cdafbb415e63, 0x5c701a2ec71eaf0e, 0x327821eb34992cb3, 0x08920c4da9d58c18, 0x78e2786c447059f6, 0x300a09b269610018, 0x9c6d682a7d0ef5a4, 0x4d046b30f8c69faf, 0x0d11884eb2b3c4f2, 0x61d01d8b7ac7403b
+, 0x00298042e5d88596, 0x6e117d506342a56e, 0x6495dc1add1d76e7, 0x5c3eb992299902cb, 0xce40e75b6866ae54, 0x5d3963448495f603, 0xa58bc91361221c9b, 0x2bca0ed7ef1c26ab, 0x45bcf08b5333534b, 0x5d9375f82277acc9, 0xbb48bfe94faf080d, 0x050346ddb79dc2d5
+, 0x0cd07283f89f7977, 0x4d4bfe9077675e1e, 0x4062a850e77b3fa0, 0x3e742280bd7e3dea, 0x811b91cd68a2d2ac, 0x1d2c43c795c7d3a5, 0xfd6f9e88cc33e8de, 0x40200ce26638d4f0, 0x9d82682d9cae06a3, 0x58746e0120087226, 0x592815fe1c76118c, 0x17d97097b69d192f
+, 0x262e9f71e814ae90, 0x4067986ab356cc6e, 0x220f1f7140350444, 0x7818713efb442323, 0x6ad94a822c5f5fe4, 0x7278f918d9b16723, 0xafa354691a0640b8, 0x19960315978a9ff6, 0x659f097983f3fb25, 0x48532173b01a2636, 0x83c295716c3de625, 0x6008a239dcf2b72b
+, 0x07883b5f0299bf4a, 0x6cf3dd3339aebeb3, 0x45fe3f60974b2977, 0x488e933017af35d9, 0xfc57e86871018578, 0x3114eb134aa4bde9, 0x3130f34dddccfbb6, 0x3ad9595abfa7f110, 0x0aa67449f7c94c6c, 0x728917fae1f56f6a, 0x7796467f94f66b2f, 0x7ff0f541a016248e
+, 0xb7cb90e75b654160, 0x006a636f45c18fa8, 0x0444f635798e6ab9, 0x00241171037e970e, 0x7cb10aedcef3b980, 0x16a9c598a19f8703, 0x5aa8bb6000cf48f0, 0x0719763740f233d9, 0x1d66e870a9264572, 0x2d3b39de58d3f654, 0x14c5d0695c2b639e, 0x2770e1737e3f14ff
+, 0x4ecad99c45cb6d0a, 0x36202d151a16e71d, 0x28dd1546d0e28a12, 0x001422fe3470fa92, 0xfb16764cd696b7cd, 0x5cb3ae846576d528, 0x7f97c6e8b8d8e134, 0x354997a3f11866c0, 0x0c718516204511b1, 0x5eee4330f9037d05, 0x0104280984666bd6, 0x46779804eb662df2
+, 0xf794530f405b0ff4, 0x6ca71294dde77974, 0x31c426a7010820b7, 0x161e73998028e1cc, 0x91f37f533efcaed2, 0x3fe8dc00ff83dfec, 0x760d0b3637630877, 0x5c46b6c0f6a58f32, 0x7df4be07a049d818, 0x22ad144106a7639a, 0x3b437a0904788ea3, 0x5910d0fdd33079b6
+, 0x74f194e5b929501e, 0x37113109128d7d9d, 0x4b84cd37cfa03a1b, 0x0ae4f1e4f5f049c7, 0x2a17c43d1f77b4d4, 0x6af5a01e32164b11, 0x527b0f34f446dfb7, 0x1d5d06694ecd93d6, 0x6c449ece883069a2, 0x00a121afd9d88180, 0x5bcd7f257005466d, 0x7df85ccec26181ac
+, 0x6cb7f0bc7e87c10a, 0x72c59f906f53166c, 0x49ffa684c82a3399, 0x69470d5a12022069, 0xba9f6625191e7000, 0x28ca9806e6d9b6c5, 0x56ab6fd46d34f278, 0x76c1d678a37fb1e6, 0x0a677a125f968f36, 0x6b194294167e1638, 0x5a6001fb58540428, 0x7f776b8800470fd5
+, 0xc3685f2ed4caa42a, 0x0cf35a14377bb2c0, 0x3d182259b29bf408, 0x5c50f1e150896070, 0xb2d4da038770a338, 0x1cd3cab8d27c5ddc, 0xdbe19d62adf8b3eb, 0x6bbc15c4effaf1a8, 0x703a453333e09f85, 0x75dcc987a641f956, 0x4a98b7dfdb1ffd3c, 0x1a587cccae764381
+, 0xa554bb139072d148, 0x582489fbf8e6b38e, 0xa497e65fe1cef380, 0x09f1bce5e0b190e6, 0x78109d251ecb9dc3, 0x358487e9998a3fcd, 0xafb8c9b97263c535, 0x4d60dfa03cd3eb12, 0x5bf10c6c94970015, 0x7154312b45100431, 0x83c91b1f517ce00c, 0x79533af33a620cef
+, 0x36ce9c4b3e038540, 0x1d6789cb5dd6f08d, 0xcae0fe84905104ef, 0x092a8344e7584321, 0x0345c980d190e3ea, 0x61955c3a447bf031, 0xab992a339e8110db, 0x772d545d9298c9a7, 0xc590fa6ec9ee4383, 0x6e27fd7468d98b06, 0xdafad618d4b65b24, 0x5df7bf75ad3fbd48
+, 0x2e208650a3d556b8, 0x5a175cadd8f971dc, 0x6df3649a60430eb5, 0x762f90f58cfde4d1, 0xcbffa73440e0da6e, 0x58e88b48969f7bcb, 0x1b3c267cee9d1d1f, 0x3ed160f5fa5846a4, 0x4be361c1457acfd1, 0x0be587ad2452205e, 0x2f1fd5d910c3bd57, 0x200fe4434a5bdff2
+, 0x51439922412b19c4, 0x1b9809fa9ba5c450, 0x89e08c580ec55fe3, 0x45e3459264e57970, 0x53b4ede9e4b5c2e7, 0x584dd392cfe70035, 0xa6794dc2184eac3d, 0x0ab182d8dfe4aa3a, 0x9ccb76fcb4da9b84, 0x1a9c747c7d44eba3, 0xf9b2a034ffd8c130, 0x3f76516cca7d8e7b
+, 0x0ca97aa772fbaf94, 0x336a1366b9a468ab, 0x7aac48519ca91afa, 0x398285ef8c9e2490, 0x3e9c8bc408a2faed, 0x7b41e02066b2bb86, 0x4534f444e715de4d, 0x323818c7b32348f6, 0x099fe7483240fe5c, 0x06b6d3da4f09e8fe, 0x9799902980f9ad3f, 0x60b5404d8f72e459
+, 0x2fc77fb4dd2d97ad, 0x405f27219fe7e288, 0xafa0d2f06f388665, 0x0eff9b02ecca2f26, 0x060bbff2051d9b7c, 0x59aac4827450f9af, 0x58fc63056099c0c3, 0x32eff77e374231ad, 0x5296d898a331cd8d, 0x438c43e74f7fcf8a, 0x970f9ba301949fb7, 0x45121367f42a871b
+, 0x0408e2be0a65e823, 0x5c8fca669b45c2b6, 0xab442a9bd00543c8, 0x0428283d27ae316a, 0x9dff369e1ff89245, 0x74d382fe8edbcdd1, 0x6b8c3b1c755608a7, 0x2231172076fb39a7, 0x2161de96a0a10d6b, 0x4c54f832ba71c7a8, 0xf5965f5dc31c40a4, 0x76f433432cc1a77d
+, 0x188c3b821dd6b3ff, 0x48928c0d7339b30b, 0xbb6ef13eaa2d14c7, 0x15a15117785098c6, 0x90f7ce34b84ba987, 0x6360cf3749c177bb, 0x1ed16253cc908da3, 0x2130d70e5247815b, 0x108834ffb46c0275, 0x2ddc378c3892d664, 0x26b5bb01639c5e6a, 0x4652e65d31594fdf
+, 0x80eaad6ed2f49123, 0x58a620cfef7f360a, 0x98681f6751a42ec9, 0x610c135945f1c92e, 0xc27dd92affc766ce, 0x56afacf29a3eee95, 0x0f63dc0bf372d94b, 0x72b0a0b4dc8b58b1, 0x86621fc53bf2df9f, 0x3e8b98acf75e6dda, 0x4f9260ee7aa9ef44, 0x2bb174f29cfd8ea2
+, 0xef333fe03ed56342, 0x7558dd99e02de1d0, 0xa16b7b3ba1e03991, 0x7b59fc068218a1a8, 0x595828a18bb76006, 0x00bc907e5a48ca0e, 0x0e870329db56ac77, 0x59dfb4614c7d86e5, 0x512cc79c29df9abd, 0x0214d256a867d172, 0x83c0fc444d2a67bf, 0x28d0e3ddd0723993
+, 0x1d3718746654bc73, 0x09f5275f591efca0, 0x6c5f7bb51c74fe14, 0x0c540460ca6456d0, 0xcdb44d1dc3016512, 0x79c2aa5385a5e1a9, 0xb397db4c7146b80e, 0x458a3b6783d65e1d, 0x6ff56431a6476dc8, 0x2d42984233af18ba, 0x2e5356604f11a217, 0x50d370f85cabf6bc
+, 0x85b5fbf09ec87121, 0x3771cfec0bd6454d, 0x5443fabac51f3555, 0x3b6daef03ea3c4e8, 0xcc7c43bbe808b003, 0x1b8c0c46ae914587, 0x3794f0c4e474692f, 0x1f6a379578a1f56e, 0x390e6f14df8b5d62, 0x72afaaa1eab01edf, 0x751f77530644fbf0, 0x7385455414d36174
+, 0x8a75bb9d9f7df54a, 0x71fc08cc71a5e5c4, 0xace7c783b84a50b5, 0x316ea67a9da434b6, 0x6e5a30f4c3c0d20b, 0x666b936650687b6d, 0x330db1e712efa089, 0x3762e3c24151cf9d, 0x0c1f8a455a08371c, 0x1a417b103cf2bdad, 0x29753602ae5b5d6f, 0x392bfe5a73e1fccf
+, 0xd76d8751d73fc406, 0x13497c3a38c74d25, 0x33ae42f31dc4f117, 0x57c8746433523dd1, 0xd8bb13361e2e686a, 0x2dd4b22b76fafe55, 0x545f33302fa8f97e, 0x4fe9aede51ba32d0, 0x05bee159f6c42ad0, 0x155640b961e20515, 0x09ab0aa99090a24c, 0x7c47999a4cd1ec1f
+, 0x7c7e78776008923e, 0x0c23413a6bedc2e2, 0x73b8c0586230fad5, 0x16062549f179dfb5, 0x79e7cecc1b7f7275, 0x62272a3952e50db6, 0x4f6d084b9b0d81b7, 0x551221728883181c, 0x64bb9191be1d0813, 0x4c611396e6ba0d02, 0x1dea3132a22ea9d8, 0x63d13b079e1fb3d9
+, 0x3d510ee44f1487e2, 0x27cd2b7be1ba0677, 0x7ff8411b31c8cae9, 0x757223bccf3164bd, 0x52cc60015831262c, 0x605b0fe7d3453f14, 0x7074cd6a4164a8d1, 0x41249dc6e0ade9e4, 0xd3e3da91ffa23da6, 0x509ea7ab35b45ea8, 0x8a35e66962b37543, 0x4b194cc72f40ad1a
+, 0x4212a43fbdb344f3, 0x0a83bac4ff391270, 0xe45bae9314012793, 0x14aab67cc3df77f9, 0x0d75ac038350a416, 0x4ef5dba67a0fa039, 0x8407a73214ca71f4, 0x72f32ff7c9fca525, 0x0b504b0d1cbe68d0, 0x087b73db5ca03128, 0x094742872f793fa2, 0x52f67600412cc4c2
+, 0xbba10e50a467a296, 0x79342950eece081c, 0x8c0130333fbb7b94, 0x02645028cc78df7f, 0xacb824a891f7a8f3, 0x205f4f4395ab9e14, 0xf7c5ebbd46b3fdd7, 0x7fc7f93a52b446db, 0x66f05848014f3f70, 0x5ba7cb5247c313df, 0xf89f9c5433cd82e5, 0x09363c03bd8c87d6
+, 0xe95e247cbca10b87, 0x494e5e0adf8a5326, 0x8c9a5ef01718b166, 0x53ffb7694a8ef31e, 0xe48eb9fe04a83a3f, 0x26e926fd9a7a61d9, 0x94b5e4d9fdbaa0c0, 0x0a5b5957de0d4e00, 0x1c31fd09461da21c, 0x33432189e496ce8d, 0x0aadcefa38c1e1aa, 0x6543d2b4bbd51d42
+, 0xc9b191efbbf33693, 0x5f888451be028aab, 0x2c41f4f2982c9c28, 0x2e6ac303d188c423, 0x9c3e4f321f364135, 0x4073256241cf1cda, 0x8f6b549e00311a4b, 0x7aced3a7d5ab9a88, 0x612f99afb3d616dd, 0x1acff5dd9cfa1369, 0x98120a10db025531, 0x5218d828ba447334
+, 0xc4874eb9cc69c3d7, 0x64b8c61eaa4cc408, 0xf6dfc7ba223293e2, 0x3d922a42d12b0ffc, 0xba2e3f72dd44329c, 0x779634bf1207e21f, 0x1b661d1846802d9f, 0x2919dbd71b8bd55e, 0xa5cacac9db71ebda, 0x300ff11675f9f136, 0xefbabd83b9212c5d, 0x4f8c3e6f8b5745b4
+, 0x3413d91e8c1bd22a, 0x42b7a45ae2392dd3, 0xd886be1a3801d883, 0x74423e778410aaf0, 0x996a951de6e6c60d, 0x14814e57b4343c3c, 0xee2cb348b9c1adaa, 0x52002d8f68fdf31c, 0x5277a742d3cd9058, 0x04999b6d48b791af, 0xd70e4def93e9e861, 0x4bb04064ecf3cbcb
+, 0xe6ce2a25e7dce2f6, 0x72c7867d26b70b91, 0xe3e58822d752fa27, 0x7fed68d92e47a7db, 0x9552a59082009764, 0x1429ef42f33b3e77, 0x48b79994ef4b60ed, 0x28b58fd23f8f259b, 0x6128c666d9185d4f, 0x2852bec22c2cd816, 0xe9be5297a3aa1c1b, 0x461d418cc731f0ba
+, 0x2f1d7f508ed6074a, 0x5e5fa55758f97c3d, 0x732b8dd15c3d5f24, 0x0cae92c11214d4b1, 0x755d007d94ca9814, 0x1d2d3492e9d82d2d, 0x7f372b3979ed97eb, 0x05c1f333687b2660, 0xe9e770a3c9bc8bc7, 0x06b70f9203e97c4b, 0xa39418c23226c373, 0x526c2b9d35ea0065
+, 0xe350b70b9eb23472, 0x13071687fe96b686, 0xf246797c7ef9b724, 0x1d12b216482a292b, 0xddff65d5791592c8, 0x41d88572d3f86910, 0x2ea25b63f185bc02, 0x3141ec3b2fcede7e, 0xeab7e5a1e28ddc84, 0x0ae7f43df289f045, 0x18df7489785a4c0b, 0x182122b3f27022d0
+, 0x81e1e8c77f86002e, 0x270b4266c5c73cbe, 0x5da0a60a3c4deb30, 0x3eeefd81f35389d5, 0xd23a98ab98271472, 0x5cd01d7f4f4d4033, 0x43afe2e711a95336, 0x016b3a6bc5c7afbd, 0x2aab14695996d026, 0x50fba7abff26900e, 0x7454eeef460a9f30, 0x0afbef7e779a0485
+, 0x4c890bd1f9bf9126, 0x1672ad8b051a7d11, 0x05f7134b99d8c304, 0x7a446323bf336ab2, 0x1be1802dd0f6ac59, 0x48d35758f7e0db17, 0xabf2cf25f5d20d1d, 0x5ae4d09f673daa17, 0xa52bfa190345e839, 0x4797b0d6821442ab, 0x8780805e3b365d5f, 0x14aa7c3c29df7f6a
+, 0xdeac87236a8e1933, 0x69275ee59b1b4466, 0x6b782f9baf7ecb8f, 0x08a981c0024fb7b3, 0xcd64a503c99b2691, 0x754d784a89f71869, 0x66a91769841f8475, 0x48da81720bdec2be, 0x90fc8cf1a857a1de, 0x0060587b741c2acc, 0x16b2251155c09894, 0x44fd5237e9a82a75
+, 0x238405e51e74987f, 0x0ad0657799a3f0c9, 0xe5603c7e4a99ee19, 0x355256b9ee0d0ebd, 0xfe7b24fcd5a4a7a7, 0x71020ed99218d0f3, 0xed58f35498019e1e, 0x4a751bb2f036e95e, 0xd38f23cad03cfd5a, 0x3ca995cfb1f9329d, 0xddd8927c1741a175, 0x7f52bb364e0163b9
+, 0x6e31e87261969316, 0x53f9871e69a0eafe, 0x48c517e37c41acbc, 0x41a45c2daade0cfc, 0x03b3124775ab726c, 0x480aaf26037b3b34, 0x58c634bb002e4217, 0x50d8bba38f74d61a, 0xe2aefdd8d536a312, 0x599932d5f5a2bca9, 0xd6deedbb5cba31c6, 0x49ca2bbd5eea44d6
+, 0x7d385a2364b44890, 0x717a19b0f8b93f56, 0x8d785e642f4b71ea, 0x402917100c913143, 0xe5401645fdac743f, 0x5bad2fb796a843c0, 0x8de2dea029c89323, 0x30d69a0bd3e5e40c, 0x921abd2158b95721, 0x4aec066d3af1e7b6, 0xe931ad69f75afa5e, 0x0f4f933d5a546e29
+, 0xb6fb77b0204b3626, 0x3887b6841f5b74a7, 0xaa4083756ede5bb1, 0x3681aa6f49c721c4, 0x10f6f6c1306e1734, 0x72d88fe5574f3ce9, 0x4d4b8fc7e5d119ca, 0x2478a73d30468486, 0xb7a19fa688889de2, 0x23a90b3f3166709d, 0xc1106cf98391352c, 0x68610d0d6a164305
+, 0x9e4a082888a69a81, 0x49e8edc488e7010e, 0x13380770e229392a, 0x2282a797623f07f3, 0x4c76b19cca8c2bc9, 0x17c3f7c04d6e9418, 0x171aa6e3c9b36a7f, 0x4ae7b0840d97cc87, 0xf8376793d91bc196, 0x6c1d976ba44c0a96, 0xee5c306edb1b4002, 0x669fc707b99d9b88
+, 0x876759cd1efbdc50, 0x41386497ee075164, 0xe6a783806eb5707c, 0x1464fc03aa265194, 0xcea4262cb5916df5, 0x31541ed145b0e23c, 0x1e89634cf0074e90, 0x678a7d5d0520c152, 0x6052fe381ff54e87, 0x75dd17a6e22fe4bf, 0xc68154b4fedb90dd, 0x6faf4b5012cfb0ea
+, 0x3823cd1d02035d4e, 0x4bec696bd18566c7, 0xad4f8e86e9581caf, 0x6f5b935e75620c39, 0x62cbe730b0c28a00, 0x2caad958ffb01c44, 0x9b8c1a4ef2afcdcf, 0x6f4802fa1251d60b, 0x044fb1290e48e79d, 0x10471d0b333f6dff, 0xa425cb611b2fc5d1, 0x2d8e6045474f9e6a
+, 0xfd7c065517bbf1fd, 0x0f24bcc7b95db671, 0xcbb3a02caf8f2fab, 0x1b226ac7802d8878, 0xd79ed1057cd5dbda, 0x3d31688a6faa7e5e, 0xf8117f4397908096, 0x54b1f74242485968, 0xacc5c139d21a6715, 0x0b728c25abe8150b, 0x8f618417120da684, 0x34ff4ccc7601b266
+, 0xf9c9a6b665d63bce, 0x1ce20c493f3ed92a, 0x370057460691c5fe, 0x703108b8525457ae, 0xe800e10fa8fb6a2c, 0x6c18dc69f63e654f, 0x98aad3e4a5c36a63, 0x4ba3c08a0c833a38, 0x76aa7fd827b49f6b, 0x77e7f64b80da8ea5, 0x9e8fd33fcba4a1ee, 0x0f3ea0b3e76b78a7
+, 0xfaa28f3f7b625116, 0x138c6f2515a9bdc8, 0x46a6f051ada74c96, 0x37c7c6b6d59db964, 0x5741cd583da3248d, 0x2a0c3d6e80e0ad08, 0xe957d0256448a764, 0x71bd76450209141c, 0xbfd51ac4f0cd4f6d, 0x5aaef637d1764a69, 0x06318de235815a29, 0x56ccda5dd93a0a52
+, 0x7eb06bd8f87f56ee, 0x721c32b5cd699349, 0xfc0476368ff65433, 0x56b2a071ab29ffaa, 0x28038632ead92e70, 0x4a6ee3b841a75506, 0xd215d2d3da34a866, 0x2414d8749fd12f3e, 0xdf1e9cd03e7690d0, 0x5719a6485c3ac4c3, 0x83c499d21d064e3b, 0x42a7dce063f48d74
+, 0x924e9f394ad341d3, 0x6e3cb03c0d3c0b08, 0xf8ab7be4483d61bb, 0x16007575a5c9eda7, 0x96842b675fbcef46, 0x479f217df908dbfa, 0xd998bd9770fa4935, 0x62ea04d597124618, 0xca70486ac6e1436f, 0x2493e0a1c075a15b, 0xc112902ea1dc13da, 0x3f696c0639093035
+, 0xfb91e6638e26e32c, 0x4df019963b5bdd1c, 0xb0007eb046991d1e, 0x7752980356c7d1fe, 0xf31e7e058e29b0e2, 0x73d7f17c67ff76b7, 0x81fada54f1c808a9, 0x6d9de8ad1584bd02, 0x89f81ceab32fb035, 0x75ebaea31ce722e9, 0xf2356c1366a5a45e, 0x5d5d270e4b0676be
+, 0x72ab40daa46c02c1, 0x27581db75edab65d, 0xfc718d25e2e30db1, 0x5a98422ab9687d63, 0xff49e96aeddc72a6, 0x4bfd34c1907f9f54, 0xcc7114b522a125ff, 0x5c5934cc0e11be9a, 0x086b8569de1e367c, 0x691527c1852d5e2c, 0x4a143f6a265ef75d, 0x7ae52d20288621ac
+, 0x1f09e369c84bcaa0, 0x6167746e4389805e, 0x98900696af29bb47, 0x38f3467e0062df0d, 0xbe90ee869c184d13, 0x10b3be8a93fbfa88, 0xa96147bc7cbf21f1, 0x0c17f5fb3154b1cd, 0x7ea3a96b27e1273f, 0x0dce8b64615ceb74, 0x2b70fa57b2dfedc3, 0x0e84d636ec88dfb0
+, 0x70325ace4e48a331, 0x4ccd731127016d70, 0x7180091a8d56305c, 0x17a97e13f4167373, 0x6ffe3e04a1d834fe, 0x0e35ba83ecbd503a, 0xde11bacd852449cb, 0x3fc1dfd26c914d4f, 0x04195649c971d9e3, 0x35a07215732b7ba4, 0x26f57c1142a5a5b2, 0x0d5be378517adaa3
+, 0x7e50a6c2061b7115, 0x5c6576ed858d6945, 0xd415638c9187a1e8, 0x4229cfa6625b151c, 0x3559ab3aef2f5fa2, 0x156eafba92af2f13, 0xaf8bda55b81b5176, 0x37f30fadd0975b9a, 0x3cd42858a22d6f0a, 0x43998a98b45020ec, 0x738a7af90d5a343d, 0x57b4256ea50d61bb
+, 0x7f0eaef1467dd0a1, 0x2bb907d6edfdf169, 0xe668b69dbd4c912b, 0x29230557975b792a, 0x3ec91d0a2f76f911, 0x28e7200110f753aa, 0xf5e376cc0d6e644a, 0x722485423e73ee61, 0x53966a6a9602134a, 0x5b9019f17dca7a20, 0xcb1c92bed0f26799, 0x28115562a9882e03
+, 0x07994537fc0c4d13, 0x031803886d8598d0, 0x6ab27bca5a9bc2a3, 0x08eaef162442c14e, 0xf02765da767af96a, 0x1f866e3a8fb9620c, 0x6a5680c46f22c449, 0x6bdcfe00cda41d91, 0xb72b6c4870e0ca57, 0x4f58f504f35a4870, 0x5af68772b06e21f1, 0x7e020266f9c26ac6
+, 0x0cfb2a5188423ffa, 0x3f473d64e778a054, 0xcefbbd4107082de4, 0x38f2a694375aff2e, 0xea87844abe912df2, 0x7ef0f138e4252ed3, 0xb2e4191fe974d0cd, 0x04b595317caad117, 0xb826e090d714ae98, 0x3e63ae294cab6c0a, 0xf6db0af4ae45522e, 0x46d50d6d40b5cd67
+, 0xe3e6d7003bb47000, 0x5473eedd6201c8f7, 0xa63abfd8865a44d4, 0x443352c51717f551, 0x1a9fdef9b5688351, 0x445049e722c9332a, 0x0f8f2cd02efed888, 0x26bddb1eccae5f80, 0x0d211240ac90e639, 0x4c8a7e6bd366496a, 0x3256a6373781892b, 0x054c33c317fa0a74
+, 0x29b250227d226779, 0x46f40185c9ff8d5c, 0x75748c04c67da4ae, 0x06f8eefd5a61f8b5, 0x9dd1a1fe19911edd, 0x3f115f1dfb1c3f34, 0x4ec3c9c9660c3b5f, 0x09aabad6ee3cc759, 0x5a541594347a3789, 0x29efc72270861b32, 0x5665d2d422b6f848, 0x29c806bde48aed12
+, 0xdeee0db960fbb044, 0x396709603cbc9da9, 0x7f8ad2f81d6ab966, 0x51520fcc6ad0e37b, 0x5ba76c6705935316, 0x6196e4badd57105b, 0x871b3a7530d7c654, 0x5e0bd7398fc37870, 0x387f6f2299edac77, 0x1adec261c8c4f572, 0xa600d3fc5c983a26, 0x016f5cb2c6e4b632
+, 0x0f65c36c5acb927c, 0x7df4d1d205c58ad9, 0x1e101efa25716734, 0x66d2357957472182, 0xe64f64ac930471b9, 0x50a0d0abd3a78f65, 0xea249ee75429b908, 0x2315e66afec0376f, 0xf1549ecfc0c7ca12, 0x7cb50c4dc8b949f7, 0xe1e8aef1f3b66fe1, 0x6c9ccc6e137fbc6f
+, 0xfff35182032f42fb, 0x1f54ab1f33a619c5, 0xe9ee19903cc1c456, 0x0486ca268eeaf41d, 0x8d9eba0c03625bd3, 0x4f1cf9eba2563d99, 0xe3fd246417670f42, 0x7f2c2c7c1f0f8545, 0xc30026acbcf41843, 0x60b76589a2c93e7e, 0xea164bcf4c214a08, 0x56ad73d02e8a2752
+, 0xc6d76265bb2c4c76, 0x39e522d1d76fbc4e, 0x1e511d1208540b3c, 0x6f4601f5f5b18b7d, 0x2dfda33e9d8c1771, 0x3b86e6d8a6902251, 0xe586fa3831cc3436, 0x49b68421f5f1c4df, 0x97d7c6249318a9ed, 0x2ac48099a3eb9f98, 0x39e2ba30d06fcfc0, 0x67821b61f2fce5d7
+, 0x5fd0f7b105572c3d, 0x289ee41bd1365afb, 0xb04fa97d02173ed2, 0x7eb8f7e1a494a396, 0xe86acdfa1a9238fc, 0x7ca28d67911cd8ae, 0x5b10674e4751e198, 0x36d78b26bba2d8e7, 0x7ea40ce1d383b89b, 0x2f035a77410c6a30, 0x020b2b0b0bee6efb, 0x5040347571470082
+, 0x54b5bc39054fbb7d, 0x3b082109ddd77768, 0x644e5d0a7177b6e3, 0x6f202798d6ddbbb4, 0x8647fab70019f386, 0x3485da8835206ceb, 0x30b42a5d1615008c, 0x23b9e6832a99957f, 0xfe1545c2cf7f4144, 0x5b11e4d183836496, 0x85fdfa33ff6eb3e7, 0x79d25b8bf9b95caf
+, 0x9724e26f8c32a4f7, 0x55fda8dc6e9718e9, 0x180c8fc30f2c6d0f, 0x663bad517838afb8, 0x8ae7ba6892529eb7, 0x3edd71687f5ecbba, 0xb9ab448c8042ff9d, 0x0942cb9c6a880083, 0xe873b00795eed508, 0x7a586ddc7fc9cc9b, 0x33fa0fcc56a1afdb, 0x3606f7310328ab2d
+, 0xd9892761816fd09f, 0x7211cf2184ddeacd, 0xfadb4d4ef69f6877, 0x2bfd93d0f844175b, 0x0b4c9bb57008472b, 0x592b09b0c7016ead, 0x854c24f786607197, 0x7332ccbe8baf2966, 0x684a8dce0efb2708, 0x3d64887bbc63fcf5, 0xd8b16095cf561b68, 0x056f56cf623a4d52
+, 0x58f98e06ca00138b, 0x63b660e8a55e2ad2, 0x680b02482f302436, 0x2f11d1e7799946c2, 0x36304522764f2186, 0x12b96d2c681165f3, 0x6bfcafa77601d01d, 0x2d919a1ee2043f21, 0x2cb9d7daecf8e372, 0x52c41c345bcac5b4, 0x6f6f7698027e0570, 0x62107b339228fc91
+, 0x3c09c938a703d6eb, 0x680604420ea6065d, 0x2805b01494461ae5, 0x23f736972e4e5c5c, 0x275c6f52b6354701, 0x3f8f9b589142dc80, 0x622390c42c77568a, 0x0e4a911d72d1569b, 0x30d31e6b8f192002, 0x4ce8ba01844b3f97, 0xb4dbb0387bf54146, 0x62c3d699f5580976
+, 0x21dbd0cce8bbbe87, 0x491daa346d15f0b2, 0x870df28e622025f4, 0x5cfd3d0ec5899284, 0x55e4f229383af3f5, 0x05655e87cd1e5908, 0xe8dd0e93f11db516, 0x7eb14f7d2337380b, 0xfc7815335d955e73, 0x2535e4593976e68b, 0x6574c4da5a782cbb, 0x0c462ab42140f809
+, 0x649817435c2d4f8d, 0x088e85d13eb603e8, 0xa29fa9ad828d3b20, 0x4a42b4adfc1ec674, 0x3a8743cfcebf7879, 0x6dfdbf5658894a8f, 0x84dec80c09e392b9, 0x350c6d214dc96d7e, 0xe3d6ad001b7f2d94, 0x554d9de4eb6c9e12, 0xaee2763eff620cb9, 0x6cb93e2847ccd3d3
+, 0x10f6e37cabf93319, 0x4bfd69851e404fb6, 0x7647b311e2165a7a, 0x32dedaa70b0a0b04, 0xe97fc394c36b564d, 0x1b58828accf2b2fe, 0x356eb13de7db5f6c, 0x6d513a181d3d36d4, 0xd476cf7f449a88df, 0x3f7e7fe1b941affa, 0xf1aaf0da962e1b27, 0x3c8271f15c213129
+, 0x0153a783329f5f72, 0x6bc34ca9fd89d7ac, 0x172418e29248699a, 0x5300267a18ffcbcd, 0x25e5e839613fa98d, 0x6274df7e3148e1de, 0x6d6d418327940866, 0x416669138f27df07, 0xfd2492e4e1765588, 0x41bae600bdc53e51, 0x35801551949041aa, 0x6266990f454a197e
+, 0xe52a475edabacf04, 0x4b214b19346817f2, 0x248f95df5c2a759f, 0x32e513c40e9b69ce, 0x71d114be7a8c3379, 0x0d601bf38a25ae06, 0x7e0930e88b60e4b5, 0x48edcc7d19d8697e, 0xcaaaa7cab41381a9, 0x718291ecff3af733, 0xdb208866efeb58d7, 0x4232f4d364b4b63a
+, 0x0f17c1a0f0443c64, 0x4869a62000f554ab, 0x8b5f337d9281273e, 0x5c6ef2906c403c4d, 0x5990220e14484f87, 0x21e8ba51d194670e, 0x457be566ee854b39, 0x7803ad43cea46e89, 0x7cbde4bc7044e5b8, 0x6a73b3633156047b, 0x5714baf022dc0ef1, 0x11feb23d8ac2397a
+, 0xcd3258638ecb96b9, 0x367c67fdfab3a0c0, 0x5fbcc7fe9888832d, 0x6f6155287f2a7f23, 0x4ef98e77c22196a7, 0x4a76eee670c52082, 0xc982f4fda98c85b7, 0x2b43a5a07298adaf, 0xca9575f438d68a42, 0x19740f23ed64fcc3, 0xba99bb50e3dc4da3, 0x59b880fe1f24c452
+, 0x575d25d43a5b44ec, 0x1818f8e7244c8c20, 0xb991c0db9a267323, 0x33f1d227fbaf497a, 0xca213b96d6dfb16f, 0x1a4320cf25fa14fb, 0x6c007b75f5a17c26, 0x0cd2d53882a3ff57, 0x47c440521dc9242c, 0x4193760e17bfd1b2, 0x6bd2ae8ec5a37fbf, 0x26d7665cef378e4b
+, 0x0502bdedf4cf11ae, 0x3938fc2106041704, 0x96847343bf29b966, 0x2b0a6ce41ac748e9, 0x7d359aff1b3d1f41, 0x11f53597fae577b9, 0xf7200509772a08de, 0x3d013705f1155966, 0xc7e2bfdc4ed0b034, 0x6edb3e70fa050198, 0x590d47afd167b6dd, 0x2a695b382c07fd2f
+, 0x872ae9bd1a1ecf74, 0x6e63be96d5001efb, 0x298a01bd20a222e3, 0x6b0d101ebac87f16, 0x5afa5dd8ceca3d20, 0x35f7786096c1bef9, 0x629b5d46370e7371, 0x1712dbb0c9b71447, 0x7ce31a1f63bcc734, 0x0f3146b75425c5ac, 0x450e885c61fb0b39, 0x1ffdc88b8eeecb3e
+, 0x4d2de28f0a959182, 0x1bf5d56279e5adb3, 0xb182e323dd77c709, 0x171ab790cc0182a9, 0x299f8c63b1e2a48f, 0x6936ffaee3accb59, 0xd16e51e9e772605f, 0x5374f45cd8381084, 0x358b38fe2d1b4148, 0x589dc8a20269198f, 0x72c325974014d2cd, 0x249e99fd3484a5d3
+, 0x56d5bae69cebd3a5, 0x4335d778c1bdefb7, 0x40bbcad8fce29e09, 0x3bd042af58580653, 0xd5015d6e5c753b50, 0x555ce7d24937effd, 0x123ae01cd0f45628, 0x58829b5c474febf5, 0x688e0278f2c18a21, 0x2d154d2a302a19ef, 0x6df64fcae454a082, 0x3e53115b3f7be592
+, 0x8b1799e41f2a991c, 0x067faf281ed05b31, 0x35f3f0fd223cc0de, 0x1e904e0e455f97e4, 0xa9e6e55045103edf, 0x7b12aa5a026fe6a6, 0xe5784bbf8002783b, 0x2d549fd5124e5d5d, 0x896d64a6150a74ae, 0x174bf7ff884d00aa, 0x448af5688b9a6f2e, 0x452435154c09da26
+, 0x7c640e26f8bc58c1, 0x7356c778a57a7f9e, 0x819c7de18ed07783, 0x19000b5fe38c02de, 0x46cfcb80f0d9bb77, 0x301c0f62a45b5423, 0x17edf09b349dafb8, 0x6d2bd63173de78a0, 0x107c703f49391d43, 0x0c682248dd421f9a, 0x19a10237a8c224a3, 0x6663504e79087ec5
+, 0x6b7ba68c26a68211, 0x10d800fc3e478199, 0x074b4cb9a403e949, 0x1fe9ee150fe5b7ef, 0x340655bce5d9dcc0, 0x4a99d643aac45a82, 0x66417d1f462e78c8, 0x64bed97e6985ae9b, 0xac16c124b58e274b, 0x416b0c0d7e092785, 0x669768d18035ce18, 0x1275a6a24f2a89a4
+, 0xa846246d479939cd, 0x55139a71d10070de, 0xa2cfa6ba3a32fac0, 0x4205d6b3cb293527, 0x811ee06b5ac664f0, 0x38da61db3c0183b9, 0xb641d9b16db4ec6c, 0x2a6208e901d2e936, 0xadde325a6df94a29, 0x7dbf4b3ee45c4edb, 0x041c19dc904e01de, 0x2f85a463a306129f
+, 0x523c380710b18995, 0x721a150ccc936425, 0xd3d325a42aceced8, 0x7efca3d360e9f625, 0x339b1251b4745d23, 0x59df0fbbea20045c, 0x2ddc6d6ab3b6702f, 0x225fb2819c2ca832, 0x2b965700afd043fd, 0x5c5e910e2a4aed26, 0x63fae8887b73efea, 0x50f162f6330b8a8d
+, 0xf43c244f25dad30c, 0x50c57593edddce20, 0x06cc311a431f0eb4, 0x6503e983e324f7f3, 0x5bac3295f4ecb057, 0x423a9f0860dc770f, 0x9c79d28fe6f09fb3, 0x32f0d09d1cf10671, 0xd465ec6b24789216, 0x1e14513fdd2b338c, 0x796091a2d426195c, 0x69811ed6c4ffc539
+, 0xe8754f207799cbd3, 0x12d781188df155b4, 0x2e3b37bcb6d7c82f, 0x6aa939b9504396ee, 0x29a09cb30bd895e5, 0x4b7bd92abcdc918c, 0xa3ac956216020548, 0x77517f7edf9e1720, 0x285f087f704c97c1, 0x1d72fd4b691a81ba, 0xc0936e6118dc8fde, 0x23388c36285476a3
+, 0x66f5167e97164ae5, 0x6b96b2f47ce6ea0a, 0xe54d0fc9669aab05, 0x25ecb7e4ca9ce550, 0x1d8d58b9f030e6d6, 0x081095dab1eb108b, 0x46e4a65e0d4d118c, 0x0872538b36b66e48, 0x3c84d5035003cee4, 0x06a572ac5f7e4839, 0x3cc56448514853b4, 0x7447ae2dbda653e5
+, 0x0b08f2cb458a4bfe, 0x7d980d7d9f66fea1, 0x8a254b105d58713f, 0x3529c331bcf560d0, 0x85a8a551d0c0a649, 0x239cff6999176697, 0xfc681f9aa5458d77, 0x144f8813a421b26e, 0xe6ec2c469a6d33b7, 0x4370577f105d1621, 0x18ade9569dcbc0bf, 0x6ad0852b3c158e4a
+, 0x2ddc372037ec03ff, 0x3078f4b3194a0f14, 0xb3258a20512615ad, 0x0b8e000cd1620461, 0xa2c7eab193e80369, 0x3a482d96cc796f21, 0xb71a93971b517184, 0x12934860f37f52f3, 0x5d48b2f87b65793e, 0x7bf73fe2e5abd41f, 0x4b06479bdaddfc7a, 0x45d197704d6d191b
+, 0xa987d24a5332b2cc, 0x054a17f2c1da0878, 0x1e019b33c2faa0bc, 0x2cff7bb867ed3050, 0x362d31b3463f9ea2, 0x1b01d4c3dbce573a, 0xc7de5aec783b23cf, 0x301db347c5885695, 0xa90a2125f6a2f079, 0x4a9cc1d176a7b57b, 0xf0aede9788fca88c, 0x097690656c8770e4
+, 0x30122dfdf8cd77c8, 0x765ef0d0800bdb1e, 0xc988d79bb3a5d06e, 0x2e08a9b2629a60e3, 0x9f303b1548dfa7dc, 0x02746134c95efa43, 0x4f1b2fdd7f0f1ea1, 0x32186540a5315b8a, 0xba6a3de08cc0e81a, 0x7adc7470419666a6, 0x2db93ed45ce35d8d, 0x6dbb40ee9797c2b8
+, 0xd417a308f6346f37, 0x26798b583c54a874, 0x44b93312dbeb9c9d, 0x1883427400aa1d95, 0x217f374229d836ad, 0x36898e0932512865, 0xed7bfdd560de29b5, 0x107e461aafd5aef5, 0x25d1788feeff3ac9, 0x1a3b264aad5623e0, 0x8dabc557458e8b04, 0x645bf55f423783f1
+, 0xcd1627419864e48e, 0x2b489e532fb70cc5, 0x12f45d668bdd5fae, 0x52fd8fe0f5c7dc82, 0x9b45bd26af370486, 0x1478342598c1873d, 0x402ba095cd38c6f3, 0x4b52cb2a3f1bacb2, 0x6b3274abbbe126dd, 0x6a5a747043f143d6, 0xf8b7905955932b57, 0x4ad2d3238429435f
+, 0x15532b59dd6f660d, 0x6a8002de4a0bdbe1, 0x599437a088d4a976, 0x11c82e086a8fb246, 0xf954ae0c614976d0, 0x471e8ecb563f177c, 0xbd7fbce6eeacb7d8, 0x4cfb30985144b455, 0x8a4829d38715640b, 0x21f6d6f151f069c8, 0x6d56cd4e9bd28e7b, 0x26ec1e7988da372c
+, 0x1743d0ed7cda8abd, 0x22ec8d49e756a0a5, 0xe9e41f6af1074ae5, 0x024e07a367106efb, 0x89f9aa114a2f46f5, 0x7935415a05d762e4, 0x811a3388f428a0d8, 0x5016783e0c173ace, 0x71005b516661f653, 0x6ef38d3db8b91647, 0x2127b150aac15acb, 0x54e3c0826fcf96a9
+, 0x09b3a597062109d7, 0x745aa26fca7c630b, 0x23c47e1ac0139583, 0x04e281d16efbc363, 0x16cf211672ff9862, 0x05e5c96ab4e2175b, 0x644bcd2edf91753c, 0x70fff2338dd51543, 0x62c32718640299d6, 0x24653dcd5135a504, 0xd2584d3482353740, 0x6b9c0687b0e29393
+, 0x6260493cdd2e29cf, 0x38653f5d49476d38, 0x9ee9b94f6aa86be4, 0x3333860f837017d7, 0xf126b6efa6a21d1d, 0x728d0fbbaa90ac29, 0xc1fa303c176c1bdc, 0x6a84ca78b1871c69, 0x8659f8dce30e5510, 0x2988bd19d232d868, 0x9f777912b8846d95, 0x2d1d3f5fc65ad01a
+, 0xb4197b9f7f7c03f2, 0x091c1e236d82067b, 0x13f3b359b8411b69, 0x4aba2ca8432539d0, 0x16e90a1216442abe, 0x01ad4d20c720a1c9, 0xb662dab7012a7040, 0x45900a80d8e6be05, 0xba15444696a228a5, 0x31825503525c2449, 0x17a04e1d295d6557, 0x0f42c21ca0902b23
+, 0xeb713e167987cb75, 0x5fac0f589771bccc, 0x7fab84e703c51796, 0x58edeb8d3d51f9db, 0x692722582a4e5ea6, 0x089126221be5eccf, 0x600e1e21334d0c9b, 0x453725349f3be1e7, 0xd1e47efe46b66bd0, 0x7b665acc3627f565, 0xce195a5a1c8d29cc, 0x611ad6c6ef901e4b
+, 0x11de1a2c8694284a, 0x22508dcfa1b3ee01, 0x421503e47d883306, 0x0a054e9888f108e1, 0x5cf2384968b2b1ab, 0x48bf7704e7a48833, 0xca466adf35573f74, 0x60b70dab823afb25, 0x93a3bc85fd018f05, 0x387dbf86a79404e9, 0xe7e9185af3196ca4, 0x6ad98987bcc81e5b
+, 0xeed347c5caf2fa5c, 0x7b45790a91652386, 0xa4e97e1a10dd7576, 0x2c4309b148fad269, 0xf04a22cd7857f861, 0x33d8ae5c29cd5b5b, 0xa5ed97ba13d429ec, 0x6e96b54ace6aa0ed, 0x493ff2e9a47a3224, 0x4b666bb76686485e, 0xa0f6effd51523c62, 0x50a327314b0ca0c6
+, 0x4e4d97e460533324, 0x4d52e35aa3f5cc03, 0x1b20a01d8df7ac14, 0x407e69bf40206579, 0x64915b77a0d7a830, 0x398b89dda74e772e, 0x8f34cc7012b5ec58, 0x29d1fdc1cc4aa7a9, 0xa854236974758276, 0x4b20e92e0652661f, 0x12158ccd30447ba7, 0x65f2207818a08eb5
+, 0xd23e30e0fd35eef2, 0x59d84c8ba21a50ea, 0x1209b32f51672844, 0x1425ab7bd410d746, 0x612f76a867785932, 0x023a95237c4ae953, 0x6db62b94488ac57a, 0x0e1ec48b3e04e367, 0x302ecee61dc44c2f, 0x2e42798a86db61ac, 0xc01a19bcd7b71822, 0x03a6ec8b58d8f0fb
+, 0x70a7410d355f0d4b, 0x58e9aff8ca024059, 0xbc8761ed2aaf30b4, 0x2bd2935cda723709, 0x1b7ad84c01038409, 0x663000b1f0fa44fd, 0x798eb40d4e5db22d, 0x70ad0205b22fbd55, 0xe6ccc13639a98e06, 0x13a6b46d6769bf6c, 0x02733d5df2d3416e, 0x64c50fc0d2ddd1b5
+, 0xe43715820ba0636c, 0x54ac0a94101587c5, 0x4734dd0f06aab4b7, 0x38a3be2de3ab34b4, 0x4cbf702d67113d64, 0x290098aaa29d2b2f, 0x18b9d22477c0bf77, 0x70df74f07a3b5a51, 0xcc816fc49591dc2d, 0x0919cc8367859a2d, 0xf412ca607d9b69bd, 0x57b5d7af84c1fc31
+, 0xfc736e666474bfc9, 0x4893fe54f279efd9, 0x8924f477abb80c1c, 0x7263162608031150, 0xf06e10f60f31ba0b, 0x12288b30d1824c39, 0x2416327d7b69dd7e, 0x5fe12f173125c330, 0x1045024358163705, 0x6db38312c1c6e75d, 0xf5c6f6117ce5cb9d, 0x380a10aec1492dda
+, 0x93de145ac766fd5b, 0x5e90fd5e5131ba8d, 0x2403f6ef11445704, 0x7ac234c9e1691ac8, 0x50cc02656886909d, 0x7a41cbb1f3a372d9, 0x3267241f52b9ae6e, 0x32f0fe77b2568981, 0x2c84aa6afd62595f, 0x226003821a0e9e32, 0x6f5ddb8c4c0b5002, 0x44888bae6eb5e900
+, 0xe880ef2120088661, 0x241e8690367859a5, 0x2cb6d4d942914dfe, 0x3960e5add3ddcbd7, 0xab49fd40a77dad55, 0x1ca182abaa0c3fae, 0xe7f90fc1b1ff25d3, 0x6e582f54fc03ecf5, 0x06c728406b6bae97, 0x2f3c4d0d77792985, 0x0dcdc71ada384505, 0x4fc0fba0a901fe3c
+, 0x62c7027a288a5ea1, 0x5a01c0a86c5d98b4, 0xcf78ff2b6f467ce1, 0x61d4304f64659a2b, 0x4c731404b20299a6, 0x5b23f487ed583e0c, 0xafce5b574a0498a9, 0x1cffef3475281e64, 0xa2b2808d6d6ee3e8, 0x6f15656b2cad7a31, 0xb59b358344337851, 0x198ad82f1d3762c3
+, 0xaef38c61c4e3ea6f, 0x51462b80e3607e0d, 0x00f90101707de243, 0x1fb8cc3662be3c0e, 0x96095f0313f2c579, 0x47dad4e5c107a769, 0xf8fec48148bb82ad, 0x2c9addbf81d4fba9, 0xb5d61f02b6544d28, 0x5eec6753de4b7e8c, 0x2e3bceb2058d707c, 0x0bbcfe75c43ea213
+, 0xf78bf4fc1400b099, 0x218fa38e61e6c442, 0x158aa9e09e7897dd, 0x2f5f8da554fdfa33, 0x4222bec19f5a5f26, 0x72dae6328465cb3f, 0x6f6fb4d9eeb7f1a7, 0x771c67c61e5a2bd0, 0x417706c30b755f06, 0x5ae84a5d3a1f7f6d, 0xa54ef9be6c5db5a4, 0x13f6e59b283fb835
+, 0xcde8e934325cc8fb, 0x1e3f4cbb030c32c1, 0xabeb0a4e4c901b53, 0x301c344e9d453af3, 0x0a5fcb41e251055e, 0x37a4a8821f6df3ff, 0xea69da3229055868, 0x3e33e1f5724bc2ef, 0x7ea5254ff2aa5f26, 0x2efd52d51b3ed229, 0x3f5efaad0c2b97f5, 0x1d0068410473d420
+, 0xb021838ff1b8618d, 0x5bbb13effc6d72f6, 0xd67733ff81ad1115, 0x64c086585d1df682, 0x9e691a5191c5f8fa, 0x58f278f69af0e8f7, 0x943b8d09689e9a3b, 0x3bc6d89567edc1b1, 0x49866e9fc5983e99, 0x4a59859c7e61ab93, 0x9a0ce1cf274dc31f, 0x360ba6e2f08c97ac
+, 0x9618344768b93520, 0x13760d13e1be7c8d, 0x9b57b28c7c196d2d, 0x7505794588c7dd0c, 0xcf1749b01a406dd0, 0x33a3de334d922c36, 0xad3ea4edc7ceec01, 0x11072e1652ddd853, 0xaf75220ab55d150d, 0x4b6a214eec57b791, 0x15b242fa7d1c00f5, 0x2d12e36c40634828
+, 0xc9dc9f942ec34899, 0x51df2c77904b58da, 0x60d0213d104d7c56, 0x08fef96b190213f2, 0xbd7f3a60b8fce55b, 0x1188865ab4c11b20, 0x69703613ce8cd22c, 0x46f49ce382629b1a, 0xa599c66467e39be0, 0x75211da0d2f91052, 0xeed4a93239c13de2, 0x135cea3d0401c89f
+, 0xd80ee5f512e1e130, 0x12ca9f6626fdfeb2, 0x3af1eecaed8541a5, 0x36d94edeed77bce2, 0xad0b3301609a531d, 0x43da9ccda536b988, 0x16709f9c1ea0095b, 0x6614276fda5e9cb8, 0x127586e6d8ca4a0f, 0x16147e8ade03e1ab, 0x43baa34f23f9758a, 0x48cae7ad607dd5fc
+, 0xada591061dfed38b, 0x496048fbae8db82b, 0x67d7327fa04a5ec8, 0x6c3be5c5d4f62962, 0x7a16acd105d54b4d, 0x38155270afe88477, 0xcd134e9a5b5a4169, 0x5505713812ee5765, 0xf01af42843d20c93, 0x1ce2881347d98fd4, 0x019c592535c6ce18, 0x601df0f6b492013d
+, 0x907c757710f2813f, 0x6d1d08be12acefb6, 0xebee018997f18afd, 0x4fbc4243d7b23a9b, 0xaccbcbd81993220b, 0x50b053fbf367a18e, 0xb9c80a4db4118b98, 0x7f3701e49fcaf100, 0x27b30adde05e8bdc, 0x52ea0733e329bb07, 0x069946f379d3a170, 0x5b34de8263277a0b
+, 0x7c398e8c9173e77a, 0x3e23b9e47de3ab3f, 0x09107364c3372abb, 0x47500ca445b3f5d4, 0x8c2aa0f6195642e6, 0x7e185cff039f4769, 0xa6f20706fff99ca8, 0x6063937cba39f8a8, 0xa97ad49e0fad270e, 0x23b935c06cb1b586, 0x0ee991be24b24e21, 0x20257e66c8882b47
+, 0xb58d4e96ae943017, 0x0c4bf22562fd028d, 0x1f6308a2755048cb, 0x340214e97990800b, 0x8b4753fee20da199, 0x1dabfdfaf30593d3, 0xb7b3116bea97f9d6, 0x7c64ed1910a5134b, 0xbe26427c7cf6e87f, 0x5ae2fafd1062077c, 0x9b3c291583ab3f41, 0x5d50fd3be5df205c
+, 0x87edfe5b26207112, 0x002132aff8f2a3f3, 0x09bf1546a5abb316, 0x2f9feb12be888311, 0x37c230153e4a149d, 0x2571fc113e3710bd, 0x3013edd6a5d0aeee, 0x47486bae649b4407, 0x9ece008f600d9554, 0x051e341ad1cd155b, 0xf1d40f4898d4a7d4, 0x258ebb00df8bab4f
+, 0xde4a1cf3c9e1e19e, 0x38494f3228132a2e, 0x124ff4e6aa9aa179, 0x69213badcfcbb6ed, 0xa4f978c8ac0ab390, 0x2ef510c7bea0b76f, 0x39bfff4f6d48c650, 0x06832806f68eaab2, 0xd3b42c1cc9f71cd3, 0x56eece391a617144, 0x93c00547e773331e, 0x58279c52875920b3
+, 0x21b8b6b8233538b7, 0x21345dcd896146c3, 0x91855b6d5bb95807, 0x013456cb3a00de2a, 0xfafcc01649ce03f1, 0x270f75a1dbee138a, 0xf67ef40a60cdaa28, 0x58feabd574feb739, 0x2d5a1433f56fa96d, 0x17395dc8d57cc96a, 0x62517e0280cb082c, 0x1a3076013a13458e
+, 0x5f245b216dd62271, 0x54b1e07fd670fcfa, 0xd122b74a96e35def, 0x129b37c9eebca8d3, 0x710e484df85d5578, 0x30327d9327cfe212, 0x6b32f8bad1546091, 0x5ae614125d53ac68, 0x7883896495472142, 0x79f21519beb0a074, 0xb06312bdd2efd101, 0x0c38596caa1dbf64
+, 0x3b2604a12badee79, 0x3069aa0c8b7744d3, 0x493a132c17e7546b, 0x2f8d858de52d6f70, 0x594f7bf7bf01e704, 0x64d51ce338a97549, 0xa11c56d4c71a5ffa, 0x48554d768c060cc4, 0x54b8b90bf5b72755, 0x14f26591e6ba0179, 0x6909ce0ce2594f07, 0x6433f9ee4aceef4b
+, 0x4a0f5ead2cdf9d58, 0x6fafbd083326668e, 0x5a559584886374ef, 0x7aea9a73f0095c6b, 0x0a77c3b7277feb8c, 0x6554870ab9f211a8, 0x72f52202c7935ffd, 0x043db42ba036bb82, 0x6b4dbbdfcba83682, 0x37f85e5823e1727a, 0x8a604fcf52735e83, 0x6d0920523c7787bc
+, 0x8ef6da262c1c4eb1, 0x3295da3d2c650209, 0x7f7fbe6f507acaa1, 0x1a8c4e56fe3d1761, 0xc958832435178b7b, 0x1f3eef5e415970af, 0xe421d2ea689cffef, 0x76c87253ee527621, 0xa99a3af1927bef59, 0x16bbfa08652a23bd, 0xd746d29d21db9455, 0x3b39d37a04cfc222
+, 0x9aa65dd314133d20, 0x06597e63a699fb1b, 0x059fa16f567341e6, 0x7ab5116126d4ad9b, 0x7cbc1f56b328f908, 0x5255ba7d13f2e4e6, 0x3aa579e7497c36a0, 0x1e77663124aa4d95, 0xf3e2e8f04d486f1f, 0x7c697f99e45d4ce4, 0x98660ed0e6fb33fc, 0x43d3de42114fe3b6
+, 0x8e4706a6c8262ff6, 0x3257ecd81072af37, 0xc6a86822cb18e0cb, 0x217b4883287d6ccb, 0x7667d1e1fcb6ada8, 0x67becc0e70734be3, 0x34ba8cda9f09c116, 0x5b4058b13fbf1252, 0xab04aeb5e1caa5a0, 0x258c594389f4ac08, 0x0f0ed63f16df70e5, 0x257987a63b866736
+, 0x459abfdb73053827, 0x19fbe13f859ee8d0, 0xc8bc52440da55013, 0x126d5df47f1d73ec, 0x6ba415372cee099f, 0x66ce2ca387120e6d, 0x944e7f2df5c6a902, 0x4fd4bac35ff9263a, 0x7b3a8bfc7e4a3793, 0x1d9080bce1b2d1e9, 0xd7cf10713f710fa9, 0x4c9044d16e4ab6ff
+, 0x82ada6a4a6a5af2b, 0x6eced37d61d26be7, 0xcec1cd720e9d2341, 0x5ebc79f7d2c5d117, 0x0e6380fe94746543, 0x3528ae6ab912c65e, 0x3a5702b882b06afe, 0x28c9d29be8b14c9e, 0xe085e75a81bafd48, 0x48e2c46f8adb23dd, 0x6c38043d8ffd5e1a, 0x06bd27d949dff0b8
+, 0x55b70af2bfcbf4cf, 0x1f156ee7fde4f9a6, 0xc58978d52926d3bf, 0x0671c666c490e0a1, 0xf4ab8074d12991e5, 0x1ad3da8265bc9f19, 0x4322f930f91dcb6c, 0x0e3d3789718521e3, 0x52fcda483ddef88a, 0x310fc9fa61628083, 0xd5299b811e6d1df0, 0x5813038f803b4082
+, 0x478b459f40ef99d8, 0x763e4e2d3c76ab5f, 0x4fd383bb8da638b5, 0x7e67f1dd54738ec7, 0xb9ef25981f4b2ee6, 0x66202446828ed1d0, 0x4d38b9f9bc000d31, 0x7c8bd2b3f9011993, 0x5c96ab1882de2e3d, 0x384d24d44c29f32c, 0x970b292efc9c9643, 0x409adf963e067867
+, 0xcd8c1cebbadaef37, 0x324575cc826f3ddf, 0x8b377a7c1344b4e7, 0x7b01714b5409d8bf, 0x5f202aecfcd079d5, 0x02a8f47afd8c32ff, 0x26ecd7a538ea3d25, 0x1bcaa1914cdcd438, 0xddeeacb44d0f6638, 0x00e5c277a7766baa, 0x113f8ed19dd5f4b0, 0x3c0978987854bebb
+, 0xcdbe6a7a5b453dfa, 0x5897000e3ba8350e, 0x22735f6c024ba922, 0x649a77dca39c5ec4, 0x4461a3d923e08d6b, 0x18dd3232387cb989, 0xff05d9d37943516a, 0x1da61593c315669c, 0x8b598d32392b46fe, 0x646a5e52d5063267, 0xd317653b6fccfdb1, 0x5073ec1d86d9c6af
+, 0x5afd569f2a2c131a, 0x14bc562e3508590d, 0x88f13d865ec19b7f, 0x1ee52b1cd0256098, 0xed1bf7327ddea790, 0x00da3cc0882b6986, 0x5e833149f994a99d, 0x499d78236de892cf, 0x90639c2b906f85d6, 0x2f5a9257e6c0e14f, 0x15dc057c3be096d0, 0x75d3dce18d99d004
+, 0xfdd5bf56cf6304ef, 0x2275238f46d552f0, 0x58821e4114ed7465, 0x32f4c661ab2ca76e, 0xeca6dfdfa576880d, 0x3fe0988352574fd2, 0xb458a9ee797cf685, 0x1d47279e6c993002, 0xe0678e291ba9ef2e, 0x0d308601092017a7, 0x76f55ff08410ecbb, 0x019c1ee3d7b91532
+, 0xea228dd9dd2356fe, 0x415287792c4df98a, 0xef312706a7375a2f, 0x5434dfa2c32f0ff7, 0xaef89e63e016bda8, 0x1013341cd151b31c, 0x53f0c4fb4e182453, 0x08a29578d90b2429, 0xd227525c806b1595, 0x061faacf3f822f38, 0x9cad66ca4d8d5113, 0x01433b36a9f51d4f
+, 0x0fc630d53d73c5d0, 0x696f45675a9dfdaf, 0x0a2654319b882808, 0x1514bd81d3d725e7, 0xc2e029b3a5f904bb, 0x7da916967dca8679, 0x6d32e5bf6eb856ed, 0x0c3eeb7f496d857f, 0xe67e4879f03d0bc3, 0x2a6d8f450b66a268, 0x37531a9f41060f9a, 0x1e1ab4635de33577
+, 0xc3303d94c2a744f8, 0x4a6d9ca17d23b8fd, 0xcecd3ad3585c9a22, 0x07d3f5a13be95668, 0xddc8cae57f9c39a6, 0x4c0efd5dfee37d76, 0xe128088502dfea66, 0x4c9ec20453e00c49, 0xf1c3707f149348d9, 0x73aeba002ef067b5, 0xaf01661a97875f10, 0x50a0767a59ad7af7
+, 0x8973dff7e1b2e166, 0x621f2cc5c46761b7, 0x01c0161b5086c7cd, 0x3f2e6982d83a9c6f, 0x1742f83b464de045, 0x75670c629d6752c5, 0xf2ee079117f7c54d, 0x5b1a6e06ee78ca4c, 0x263356adf3b6181d, 0x61b8eec9808cc827, 0x0f91a6b0b86d7adf, 0x7906eb093dd843aa
+, 0xfbd62bfebc95b503, 0x67238d2e5e284371, 0xa42b68b4b099cb37, 0x324f5d68a660f836, 0x4cc06bb4e20d3313, 0x3eb914b370c1858d, 0x355418276c4a3fea, 0x7b114b5e36ee5662, 0xd826b64ce4556998, 0x5a2b9737d1597cce, 0x9525075dec4b0073, 0x37b1253252afd52e
+, 0x827167855755f38b, 0x5879e46561e1b63a, 0x288b9ae34ef84748, 0x14e999d54f038df3, 0x3ae231a0c9d6533e, 0x02af8066d70bdcdb, 0x571e5c768d621f66, 0x1d64f96ae63f2847, 0x236291b80a55d8eb, 0x28fa85b012be9f40, 0x787cc3e7fc67ce97, 0x32eae26760c97a4e
+, 0xc28d3ae102eff90a, 0x3ad8583ab21ca84a, 0x7f358986db871ff2, 0x634fa797bb3a3a80, 0x955529ba61b19a20, 0x6db59e9f491a74af, 0x52ac3ea4cbb290e6, 0x528da21a1daf9ef6, 0xeea7b7aca98c1400, 0x185794938d6a09e1, 0xba60a098fbd4e383, 0x5a24d45ce487170e
+, 0x04c2aaeaf94e0daf, 0x371ab3cbe9be348c, 0x34dbcb5fbc22daca, 0x207e2ba7501287ff, 0x4353e0d8d142d31d, 0x1a7b564b48ca6eda, 0x9185ab658bd576b4, 0x041003d77f019d44, 0xf948eb65ce577e4f, 0x1cda40147d31486c, 0xcbc4906da1dd1e3e, 0x6a7fa8e0d26b173d
+, 0xa2aa85c710b8ce89, 0x7024155e5d5527b0, 0xec226a342a0b55a4, 0x5fe13ec69375be6d, 0xa11c397d041deb5e, 0x5c014f0a50282f77, 0x51886929fec00ee7, 0x20a2006d1d5165dc, 0xd3b6e79b02501975, 0x623f1dec2e796865, 0x2cf0d93a44ad94a9, 0x21d03217b68ff7ce
+, 0x71065d4af9d46f1a, 0x793b3067ebcdb66e, 0xa989059371d3495e, 0x588acb91fce58ceb, 0xc8ca5302ba7b3aaa, 0x4d2eae260a050796, 0xcf2293d988b83fda, 0x573b25a901cbdebf, 0x6ceffc9545d38f98, 0x6730c9600a96fdad, 0xa3cc1014bb3d7b79, 0x7f9cf303f558e2ed
+, 0xce5c13ac3c800fd7, 0x38bb221e87ccb34e, 0xa4be6f36ecfdc4b9, 0x299841fd6a79a0ea, 0x35be5c2110ae7a93, 0x658e1c618827e7dd, 0x185cc98f12f7560d, 0x0f3b8f110a116967, 0x30db97f5938e167e, 0x3c0df71ebbc80d1f, 0x46be9e711f04b02f, 0x1f53e21993d9c3bb
+, 0xc7952bec2242985a, 0x4289d35a2c0697a7, 0x34bb4a389c03d693, 0x4bb4c34ba50c9878, 0xf9361ab2d8abd8bc, 0x3073ed34a8736579, 0x66f153635201d22c, 0x027fedd8849118e5, 0x1500fe38c14e6cc0, 0x2898f156e019544b, 0x99edfeffa302de4e, 0x360235f8ed30e19a
+, 0x26a6af3c30a50a88, 0x68231447819e3f9a, 0x17c1fec466d56791, 0x2c8a6fd775c5e8be, 0xca134c51a6998738, 0x2b2e2268c24cc128, 0xec63dc51cf1a8065, 0x6c6ffa720c512151, 0x0143d9d8c339b27f, 0x51ab6bf23c9114dd, 0xb2458a0d9c53c232, 0x7f66b5369ced2e3c
+, 0xa7c5f795742c38f4, 0x3f4aa4d640693349, 0x816b2e706f2642bf, 0x1ca8e7a8733530be, 0xfffd03b98bdc16a2, 0x0b3a243a64bf30bb, 0x8f5f4c30d76a972f, 0x06066c98767474f8, 0xad9923c05305cc12, 0x4a40b187e1442fa2, 0x7372d5b7422e8675, 0x2664154853e06701
+, 0x27737a923890b56f, 0x34d3ddf8899f3a12, 0xc01a80db5496a7e1, 0x41867fb1980a441b, 0x546150654b7c462b, 0x4ab4fe519107bbed, 0xacae0cb4662c8694, 0x24f26c70f4cbf266, 0xcd322dc062bbfbd0, 0x5e8858b2cddf9257, 0x2f2e8e632af48888, 0x479fad0d0ba9af57
+, 0x7628a4b7dc578e43, 0x24f9175e674f8a79, 0x1a1f73e917c9aac0, 0x02f0da1bc0fdabb5, 0xc02f83ec4277f750, 0x798e3549b5bf048a, 0xf208acb648a047ab, 0x22afdda114b69c85, 0xf5ad8d899c926d66, 0x323d56e16afaec20, 0x5348dbe71c85729a, 0x7e1a7f52c49b4850
+, 0x263fa1a17e71362e, 0x048ff80bebfd0d36, 0x91882470909832a9, 0x1462017924f37afb, 0xe3272a97bb209b57, 0x16e23ba9eeef34b9, 0x5654cfeacf6fd445, 0x355ca5dc8379ce62, 0x21d7fd34b7be7603, 0x1bd0ddeaf18c16ef, 0x17201870fc381a5d, 0x16cea08858dc9021
+, 0x556d07f5764debd6, 0x5173c993c8b9bfb5, 0x2474bf36aac0cec1, 0x661bc2aca4d57b76, 0x5b3b9b636558ee7b, 0x7d2692b4eadc817b, 0xe545753f6e453e7f, 0x54aaa09eac60b812, 0x84fe3f971d8ea8c4, 0x59bd68f72367054b, 0xba38f9a7f9c7c104, 0x232de6e2a414ea57
+, 0x710dfd1ad57be501, 0x141c58329720f38e, 0x095b11e5d84da49f, 0x2788547ff7654aef, 0xfd82debd91e08501, 0x1561057f935ed886, 0xa632a2fb5382fff3, 0x65a0bbc01a02fccf, 0x7026f36d6393a8d6, 0x6c2f8101e2a4c1ee, 0x86ed7b49a78f825c, 0x03bcbf8ccf4b6389
+, 0xa56343a602d0aef0, 0x73fe006539b2b276, 0x0ecfa01a52fd3a23, 0x2de27fbfe8945963, 0x095b0367b7528cde, 0x31c09a8aaa438aec, 0x48eead94693f2c2c, 0x044944d4656c4a7f, 0xf202d609e4910be3, 0x4f55d305fd77d033, 0x7375043adfa673d4, 0x0262ec51961213e8
+, 0x5f4995b2d4243717, 0x353b322dbc0b63a3, 0x923fd28c383a2db0, 0x42204eebd4d94421, 0x14b8ac50b397bd8d, 0x1c844a2384369e09, 0x97811e43818cadc4, 0x422e3487db6f42b8, 0x0eeef2de3ea38a04, 0x146d3c313e094b50, 0x3cb9600a96c6b869, 0x611680ba1163cb4d
+, 0x8383c8f2377499d8, 0x22b57f111bc4bdcd, 0x7e2025fe754135f3, 0x15116bde442548d6, 0x0ef3d8359c323604, 0x2cfb377be544799b, 0x8191bee05dc8a025, 0x2042a90e9eedb839, 0x5b76bfcd79303afa, 0x5a893b528f62777c, 0x72e2bad71c03de03, 0x7c99f3a99902932c
+, 0xc8edb3ba92ee37d6, 0x4ff453a69fe60402, 0x1480388c67816759, 0x1044b1db955148cf, 0xa749040677cf436d, 0x64214782836a9ab9, 0xbe54439ccdd3e30e, 0x01ec1a0801202a34, 0x495e1ae172a05c44, 0x475c62f73e99b9a7, 0xd14bc4dccf5f5dcd, 0x1746e3aa1e7db7d5
+, 0x43fb79f495270b50, 0x1067a5bbd36b5bbc, 0x50d42726d6418557, 0x647ff82b01f992a5, 0x0bbbb34d98a89433, 0x761c017305868794, 0x4aa65196aa6dc483, 0x03d3a44141bffcbf, 0xc4024801fdc1b716, 0x2eb18b77ab6f5415, 0x69813c41cca52236, 0x2dc3d9e4b06e7a80
+, 0x92dd55d5b678ba18, 0x0fc0132bef817903, 0xec7c405929f2ba77, 0x026f67fe77b6d8cb, 0xa89869927998d41f, 0x6df8d0da1f039160, 0xfce544714c4180a2, 0x0c596fe7f5852927, 0x8898254389dad7b4, 0x645e0d207fbdca91, 0xa935a616340f4a37, 0x796dcedf994cc6d8
+, 0xa8a7ff3c50b4da3d, 0x62038cf1c2cef9c2, 0x67cd7cf8d8b36362, 0x54c264f1be3db794, 0x717dd2e213031827, 0x0e22de91e02eaf69, 0x3a4acba76cbe5bb6, 0x5c4f1d91f5ac43aa, 0x156849e55a72b32b, 0x2de323bcdb2d2aae, 0x6abaf26ba0ac15cc, 0x4390e3485b1ca57b
+, 0xee488de359d0cddc, 0x2cdc509fa17c12d4, 0xefcf36b3ad8b4037, 0x24e90f30f60e8094, 0x51ac564ea55a17d6, 0x052760bbc6fb6fa0, 0xc61c8b7a360b1743, 0x1c17f6863644c5b8, 0xab5471666454cd4a, 0x53cc1e9365c5b0b7, 0x1b73d979a9bd0319, 0x14ce413849bade29
+, 0xff46a850d8e73ea2, 0x38e395ced2c9701a, 0xb58ed9cc20910af4, 0x393073a3064592a5, 0xb78dc279b560748d, 0x00d29d1cba2b823d, 0x1ec55adf0538d725, 0x03e9fe503a567c7f, 0x0f94a1ccd7650ff7, 0x159614fe19a7451e, 0x7502a583c1bbae8f, 0x7dd9f822ccecdfd2
+, 0x3904dcf667521718, 0x6e15c54dfa83e3a0, 0x2ad9a2187fc2b91b, 0x4a820e8ea3c76fd5, 0x4844248b0a4619af, 0x53b817fa61b9e293, 0x92f1f2107f8cfb33, 0x5435296b120d5d12, 0x1632ef27c53aa46c, 0x75b129fc9e8f4be6, 0x6083d5435cc5b7b5, 0x1c26905cc1fcee3d
+, 0x092e08e4c0702c55, 0x2c3ab873759c52da, 0x5a88877edaccc5fb, 0x29fb8d239f1aa05e, 0x14353f250dab21cb, 0x4bf54f85c02bf8ba, 0x2cd1350b372fb310, 0x1c83d7104bad81f6, 0x10532ebd93ad0edb, 0x734ea0679c88fb04, 0x2b2b00ebcd275718, 0x4b9f1aa0b1a4e6f3
+, 0xa80201cd80be1013, 0x5ad1fe0c7efc2c8e, 0x16ea80e2d8e5ae92, 0x082d02390d58d562, 0x6e445878748a38a5, 0x2700ed89a16260f9, 0x1e897299633b7564, 0x75b9780cdffa72c6, 0x14fc73cb473f6a05, 0x4f511f93211a96cd, 0x0f602929ada25115, 0x61363403f5ee62f5
+, 0x4343f33215847479, 0x71bdf81fbcb68e21, 0x27bc09ceb16f2163, 0x59b9779c0542711a, 0xab99bc2b780a167e, 0x48c7aa517d19a422, 0xa8d5ad4103c90106, 0x327291a840376700, 0xfe9e8c31a0683bc7, 0x47ad451dd596e870, 0x6b10798f61f80eb0, 0x30ee2753cc47a77a
+, 0x735905dce59611cf, 0x210497787a0e4182, 0x14943013a23c60d8, 0x7171d74c7bf1d049, 0x758afa420b57b4f3, 0x53ec6944b0a46738, 0xf576f548b9cfec47, 0x1fcde918f321bc77, 0xe4d5094a30b3d4d2, 0x74ba5372bb00991b, 0x40e96763ad2ae56b, 0x744b15505212821c
+, 0x8d97a11e91f73267, 0x1ad2db9b5aff083e, 0x5177ab499c5a1424, 0x20df631ae65ea48e, 0x3ec8844222e794d3, 0x50724a0df804fa82, 0x370767bcaecc5d42, 0x370db6e86c7fcd7c, 0xdaf3a38521f33e46, 0x1e9dc79d5a003461, 0x471b03b8e64e7798, 0x2505528a24a75556
+, 0xda47c8e999f092b8, 0x7dce42d1f752eb73, 0xcad173424da35014, 0x77c5a309fbe33f69, 0x34715c99c914c36d, 0x6e0af6b300fa9cfa, 0x430085c1ee15cf25, 0x258ecf2c3e7c0e7a, 0xab82558d1c01350f, 0x6864a264168d3b73, 0x21340ac15646e8c1, 0x3cb24af063a59434
+, 0x4d8c166eb37814d0, 0x05e97c26ae39f588, 0xd62aa4639225f080, 0x7eca0d9d550ce397, 0xb86b03e558603380, 0x3d7a7364c36f195a, 0x97568454d50324ee, 0x73487fe7ffb3f6fa, 0x22c2ab9cb641a823, 0x1a4a535d3e8eedd8, 0xcfb18adba0f06dbc, 0x2c8d529dbfcf6ce6
+, 0xb61b9a229cae0d7d, 0x234ea038ab363a04, 0x554f57ae1dccaa86, 0x46e98fb8d1986b85, 0xa82533472cbb4a3e, 0x30cee54e8a9c8752, 0xe5d288030b516f42, 0x5f24b54b31427896, 0xbcb08b5479302710, 0x5e8f60cc615a29d5, 0x86f493703702d6eb, 0x29d389ea3322839c
+, 0x5af38642ad5059c0, 0x259310e3c21af768, 0x50b74ac9903c83a1, 0x23d596d5ab6d65a1, 0xb063c50afbb233de, 0x77e6db6215f5ca04, 0x87f876d1ad242bcd, 0x3cca8b4546ecc984, 0x9c3ed721755f0263, 0x0d7b5a029947260d, 0xc9edbbb22f23a1ea, 0x2b01d7789d9a1f5e
+, 0x9194f9a072434a18, 0x4a03f01925a9b93a, 0xada787e1fdaa851c, 0x1e8afde735f51dfc, 0x3d89ef4a18d0608b, 0x13c3c0812d523fca, 0x5abdcb9fa981518a, 0x2b720ff3b4d05981, 0x05ba8d30bb1b599e, 0x042b5ff1721506c9, 0xb3d8eb75dc7f7f30, 0x168923f709a7e785
+, 0xe601c230864324a9, 0x106573e9622e60ed, 0x7178f0a8a2d6cf0a, 0x0d30652985050a1d, 0x9181b845c181e36e, 0x5f4252cae48c66e3, 0xec06ddac3931623b, 0x0ad6b384f6230df8, 0x8f4ac0546b2ac853, 0x482c53a6d0c27f4b, 0x7e96009784ab6b10, 0x5d6f192ca95cd163
+, 0x749554d0264e0a9f, 0x754ed2f8e8e4c6c7, 0xc199a32f1b6791ef, 0x23d36a76f3ffc04e, 0xdc414352be3c57e2, 0x7609e4fe5a2f8533, 0x844ce90a86c4c24b, 0x16b73f4ba99e9b7c, 0xc08678cd6467264b, 0x742bfa6fa995b951, 0x0a2f40b51bb08ee7, 0x325b99eb81f15af1
+, 0xd707efb9a0dd937d, 0x52261a078f591beb, 0x1987956a09424947, 0x4d07b5f0398ab9c1, 0x2909e53a309a16c8, 0x1f6863a9d9927790, 0x838ce050704b28bd, 0x17aefba1780e8803, 0xa722bebca448290b, 0x34111410575339f4, 0x745e53a17eedc506, 0x2b53169f533aab88
+, 0x6ba8a6a7ea6d3433, 0x085cf07f48e2776b, 0xa21cb10301d92795, 0x4565b2c26ff4b376, 0x10597e24001f7f74, 0x4f50546b0e16f770, 0x92a471f9f6da14ca, 0x00bd63a2db78a479, 0xc9d2077ac3f5ea0e, 0x5328acaf928744b8, 0x1865dc7d86eb94ad, 0x111ca24af985852f
+, 0x2eea4320d99e2f74, 0x35be55123989ddff, 0x26cb4d7f51bca858, 0x2ceca6d01bf0f62f, 0xd2c1ff93bef6553e, 0x5c6261e563d33ff2, 0xe2aafc3e376074a0, 0x1a6b0c22c6f261eb, 0x77606d5137984b48, 0x43161bb5d001214f, 0x2cd058ff7901e7ef, 0x687430bb8e70227f
+, 0xbca78c735744b714, 0x79ede541417c5aea, 0x5527c128605f2d3a, 0x6038269c76cd5290, 0x0d296c93cc77fb4d, 0x301fd73e84bb479d, 0x63ac368596c9b85b, 0x050de632fd3f4c6b, 0x771aa0b01cedbc21, 0x765cc5884a9cdd86, 0xa9bc0e3db058b117, 0x26e15efccb14dbf3
+, 0x8f6b2d10804fc1f2, 0x0343e98db60ec658, 0x40cd27d1c8298431, 0x4cd5664f32be9176, 0x3ff9890a2f738a98, 0x3b7f3123d9a654f0, 0xc4236cea3fc27f11, 0x35923d3897cef4f6, 0xec64e2c43e67a525, 0x61ba626a2c2a4bc0, 0xc8dc36bdeaabeb19, 0x3aa683d072d8e49f
+, 0x1c4cdeb6fec3dcc0, 0x46fde82eded30411, 0x7fafbd46536387ce, 0x1090eb83563dd5f0, 0xd23faab4f4952839, 0x1b503e879eefa094, 0x1f4e9fc9e8dfd87b, 0x3db61b4f59f3b3b1, 0x8faf93db71e38a15, 0x5cdb335d54823b5b, 0x8432f9385926d1d1, 0x035099bc78e09a06
+, 0xf5a2881013378561, 0x5ec31757f18b97bb, 0x1188db22e66c9733, 0x727b791254b58fbf, 0x8bac794bc40e8a85, 0x5a9224650374e74f, 0x6f98609a59a2bbfa, 0x05ac053f5581649a, 0x9bc26b7eb1445f70, 0x013c6e8877b96419, 0x956f469decb13958, 0x2e8e9a73cca61972
+, 0x47bf99a89463d333, 0x257c9a76ee1f3339, 0x436d78c6d327278b, 0x115f833836b74e15, 0x670df77b0c46fe96, 0x714f84e608180138, 0xbc3d82eb9b905993, 0x2f52c3ec9a03f8ff, 0xdb95470c741ed653, 0x68a34806544a2d45, 0xc139007e70587865, 0x32a1a7b2e671f997
+, 0x07f19a22728fdbd8, 0x69ff8d6d04f2e90f, 0x23caee0dd50d0728, 0x02e8c375053d8459, 0xd4c2775f6b7f0045, 0x53a91dbbba6178e6, 0x70fe964da1c48400, 0x53d2b57918337620, 0xc14d4ccff362a3f2, 0x009e8a173acc9dd3, 0xb47ad9a11a37edd0, 0x571b39aab024b10c
+, 0x3e75f37a94147ee1, 0x7de61a04c45ccd3b, 0x33cb4fb8e6f5de19, 0x571d020682660752, 0x0f49079f140a75b5, 0x2c82f5bb94779bc5, 0xd5c952e6277ac374, 0x56b503a6c41cd37f, 0x5fc0d3b895a03504, 0x72ae2c924b80ffa2, 0xe91868c937153c35, 0x1a74604db0c9c8b6
+, 0x68389f9f8dfbeb76, 0x667ffa5313eef465, 0xd6a4d0a249b9ec98, 0x43803d993da1c6c1, 0xea1e1caa6655662a, 0x61bb76d81e6143fd, 0x5c059652a35ac4da, 0x02a4f2a7b00142dc, 0x7e97a65fee8899db, 0x46a92533ca83ab8d, 0xd3e32c4c797f2998, 0x3a98df01fd063088
+, 0x39164696310b166d, 0x5b6b87663758264e, 0x74866c1d05dbc6e5, 0x30d2627a0bda6142, 0xde658c50358d68df, 0x408b16b7a0370fa2, 0x62eb2068c559ef0f, 0x78f92c55a9db5724, 0xb678cf74609066ae, 0x69c68829ab528e54, 0xce2dd06726b3d290, 0x4de5755dd08beaaf
+, 0x58d69d562846a2fd, 0x019d22c0b55a01c4, 0xf722d25231a8b3ae, 0x5a02a5fb626aa770, 0x4eb576c04e9d025d, 0x002e7911408da1e2, 0x8730cdb1a42763c8, 0x10a1c1c06f8ea8f8, 0xf3f86cb7a994ff3a, 0x1010695b0f3e38f1, 0xfcea1e9eacf9fe13, 0x5f627e15df15980a
+, 0x69313603c53bbebb, 0x60f81c5f6aebe82b, 0x4b0e8a07aa4a45de, 0x484bc3f333d41e69, 0xe2e519baf62714a9, 0x5c86f4f1109c9119, 0x80221a15443cc410, 0x0892d349305228aa, 0x75d3181688d51775, 0x216ea46cfdaf3d05, 0x00a751a5f68c6d46, 0x3cc09a7819f41dcd
+, 0xbe8b59e3ebaef8ad, 0x6ee70f3da87fc9d0, 0xdca98e7c720421b7, 0x03a8b38b2d049a30, 0x771014e495c9db15, 0x67656515439c466c, 0xcd5e01a6ddb8a3fd, 0x03fadd3b45599e4b, 0xe4e2463c0a0a5eae, 0x605c9520eaaa6c20, 0x763c477599ce9096, 0x2c740e80385ae5a0
+, 0x3999b3f081092a3f, 0x2dda5af27bd4cd99, 0xd82841d4db251bde, 0x504a2b92bb83d624, 0x9ca5c52322ba3a9c, 0x0287c8e7d3eb19de, 0x855beb2c5bb05f3e, 0x1fd3a622bb2eb53c, 0x7ec4d6ac679bfab0, 0x660786e3e582edb3, 0xe8cfa9cf43956ec6, 0x5700eed999a01df7
+, 0x7953254792b1e6b7, 0x4fd5cedfb969be57, 0x290c58a87339ddd4, 0x008fa2f66ef5d149, 0xb08397e27e690c9e, 0x30950cde6e6eeb3c, 0x8d4be18939eca5f5, 0x42415c12442b92e6, 0xe8cd1021ed62b97d, 0x5b1e010b277f249b, 0xaf483f5b908d6294, 0x365917a89090b6ec
+, 0x5f54d5fcab77faa4, 0x32267fdbd33e01cf, 0x1607b88b363793f0, 0x43ab32cb53e17d22, 0xbcf520af6cf53a91, 0x3d9f16772af95616, 0xde8bc312e163ff62, 0x7d7ff602786d5a66, 0x719a8843c287063f, 0x7e10b65a728a6302, 0x19b63d61716cccc9, 0x00d983bc1159855c
+, 0x2b7a0b4291eecd53, 0x2a0f295be1f1d163, 0xae6e1761d0149ffa, 0x7478307cf3e7a6a4, 0x49ce0fc6cac19e98, 0x6168c6a38befeef8, 0xf1045cb5b90a769a, 0x78b51458e6aeeca4, 0xc3c8ed1b6b2ad3d6, 0x5a05ece659663b07, 0x8b663364b6d13cee, 0x0217e916bcee467f
+, 0x9ff2996ce7092a1b, 0x4a5414d42a29ae7b, 0x93a8ff0be7dba9d3, 0x53254d7eee8bca76, 0xc62577717c1d7da8, 0x5a3358ce03fa7085, 0xc2cd1214cfcd67c4, 0x03af3ca4703d0f40, 0xc1ca6058565dfa77, 0x77e1a39ea5450418, 0x15941a119f703818, 0x4c09aed31f0a84ab
+, 0xf757070d13902f1f, 0x28672aab84bf62b9, 0xf12b914496a30fa0, 0x6ae5abeeaf14e337, 0x7542706dba48a6cd, 0x6dd00f67c1598c0a, 0xe0d7c4c6bd0cd3a7, 0x07dc14b8dacbcac8, 0xf33a9863a80c7c2d, 0x6e1115046e1e3883, 0xd9b731f43b64b9fe, 0x50a67845688dbbcb
+, 0x85e6c80b4dc468d1, 0x71beaf8b880878f6, 0xb4053887c030d366, 0x2931f5b98a25b8dd, 0x2cc9c02ad2d67270, 0x3b48ae3cd8c1a7b5, 0x1096db3370d2b969, 0x0c554cd15a2c6c62, 0x7882500becb856cb, 0x7ee75ff73f71fb70, 0x1b77358e3cc2ef36, 0x351a7c737ecb9b78
+, 0x4ddbd2a348e15841, 0x72002170e4cf746f, 0x1df23c75f27a1518, 0x271a6098700f15af, 0x93ae1078c856e2b6, 0x02b599a8e0c279b6, 0xeed18f2271d9bba2, 0x1a078eba419d5f3b, 0x1f000f322b0cddeb, 0x43a2f4a977aaa091, 0x2e35c3144f128fb7, 0x24e2544752ce0303
+, 0xd897cf95da79423c, 0x45602c1c08c8a35b, 0xe1d7077eabae6022, 0x7387ac84f2fe1382, 0xdb933a2beb37b977, 0x10d3d49e20074260, 0x9211f4f4bd32da61, 0x3907737e874261e1, 0x4801b74167fcdc22, 0x027f93c1784297fa, 0x64a3872678c80645, 0x78313a0d5c6adec0
+, 0xa4a2a01f1f75160b, 0x727cd2a726c91542, 0x3ba4250fbec0bd8a, 0x7eeed4709d4cdf77, 0x6bd309c63f55e221, 0x5485848f8686b898, 0x87544765ebfccae4, 0x0028a157fe104a5d, 0xf80639413ea53efa, 0x41a66006b0bf7386, 0xeb3d526856afcfe1, 0x29b8b67a70f16c7d
+, 0x619bd4f0ba3e639f, 0x474d88473b8d6bde, 0xaef96c7a32c6d5c0, 0x0b75b41b1dd376e1, 0xc6938246ab47dc73, 0x3d983d4b4beca424, 0x604e53fc83c7a318, 0x08b07c5e57eb93c5, 0x442cb1f596cb52fe, 0x6b97d379ad425e1b, 0x04c436895c0b73f8, 0x23bca12bd1fb8fb0
+, 0xee3b713c44210257, 0x0f40a2406f089c52, 0x61c5053b66005e4f, 0x56a4ce1a2f707e24, 0xccb62e5b4a3ddeb9, 0x60f80fc3084b0d33, 0x00554d7d82c304cf, 0x4a72dc5ccef70760, 0x7620d3d82b49bafc, 0x1e59451b156355b2, 0x2630bbee84437ea9, 0x2a168c24eaf2b47c
+, 0x8fb7696d449bba8b, 0x5cc322ed3f2cf582, 0x79ee34e55edfcfeb, 0x6239e0a00afad316, 0x14834f7454d8d021, 0x79902dc0164c5eb4, 0x1a43aefae138535b, 0x43fba1c778716409, 0xdc581cf3e822f72e, 0x66ff069495833818, 0xa415293654ec6d04, 0x67f2e554f935232d
+, 0xf9346f086bbc790d, 0x3d3fe74108bcbd19, 0x843e681adbd73239, 0x437425b25e5d9f85, 0x71f73875dc8c8fa5, 0x21eae131105c2b4a, 0x716a6289f491cd34, 0x3f21b488a7c11e39, 0x4b4a1112089587db, 0x48224cd764b6508c, 0x556bfe437a8a3733, 0x1be4a89e5e6a9c7f
+, 0x11e0307f215e16b4, 0x2b8099e39e7a324e, 0x95d7234fdf8388ff, 0x6eefa613057d6895, 0xaa2c9fe2eeb68145, 0x148082b97d6d42c6, 0xc1b4af0b01b0ace7, 0x05b1a945507f9166, 0xc15b239cd227cdeb, 0x5da698cddf071ab1, 0x9d52d27221f8bcbf, 0x211bfc848eccf5cd
+, 0x4d3681bfa049f3c3, 0x486bb57786591d47, 0xffbb036d08547172, 0x723ef9cd5a0731c7, 0x364819ac1664d414, 0x049c2fbd2369e524, 0x239f0acad5b5658e, 0x5514c748c5a7e7d2, 0xf8bad89fefaadd21, 0x0f015710bd85f68c, 0x79ddd57d76291562, 0x002e198457924b56
+, 0xe554aba47383bfec, 0x623665c90338ed8b, 0x92290dedf544706d, 0x5a5982fb9e3508b9, 0x74cf08c61344f5b8, 0x74060f7b7123f1cf, 0x32155c4fd2ec0fc2, 0x747f85bc26a69de1, 0xf4d74866b7d99053, 0x7617f847a17d8a3f, 0x3495f913808457aa, 0x5100719021611b6b
+, 0x0986eba95df250df, 0x5fb87c9eaec24310, 0xca577102460079ab, 0x4fa78dcfdc9bd3ea, 0x4f4959b7b7f4b39d, 0x24786221afed9978, 0x1452de9636a36ecd, 0x3838dad6cdf3e372, 0x44b90043b8d6237b, 0x78d69fc5c82b5c75, 0xe97111cc29aecb68, 0x7b04406044a6ba10
+, 0xbce460a3dac0a286, 0x46489838dae2fa14, 0x117169959e57e313, 0x5a72021daf8d826c, 0xe7745c2bc2434740, 0x4551099eda0e70b1, 0x437ae53f0d0b388b, 0x35944672b9d38d0b, 0x645abf45935b126b, 0x022777d97ed4a3c8, 0xe67f88163975e603, 0x3832a64166d76909
+, 0xe5b02467143d33db, 0x7b02534d628d2490, 0x852c8990489bb370, 0x7ba830c052dba006, 0x709a6bcf15e9d725, 0x0478b41a18af0e4d, 0x669c888067d2996b, 0x0ecefe70cc8da0d9, 0x0e9ddd360535c4ac, 0x08b42309ecd5ff6c, 0xf3df6c30ffd81dfa, 0x350719459239bbe4
+, 0xb2bf95a2e407d4ed, 0x79526e38d5d1440f, 0xd5ea9697b7bf6912, 0x7e321ccd5f1c58ea, 0xb465f8b84c31af9b, 0x3afcd3c9f3d6afa5, 0xaa971f38284b076e, 0x325079cc13499176, 0xf7e9905d5b822682, 0x09e466d93a6ef671, 0xa7dcb63a3a69aa2c, 0x785aed2c36e397e0
+, 0xffda13b2cb841d17, 0x0afaa72a6bf397f6, 0x77f7a18980c662bf, 0x299a1654296f5555, 0xfc80c325124e4171, 0x03c440f80e6d571d, 0x6f4573832d9393d8, 0x44cf16b15e7f7076, 0x7c7c79c43af4dff3, 0x2fa4368dfd11f9a2, 0x17f7c487287b797e, 0x7c62bb01c155694a
+, 0x81447ad9df138975, 0x4eb90e2503b7070d, 0xe1d7b37eb2c8e7e1, 0x795cb5914af449d6, 0xa0614ae4a794eb34, 0x25b095bd93b70092, 0x2141ca8d017f684d, 0x172230bab03dd4a3, 0x4a5306f059fff1e8, 0x0f146c6b1d47d465, 0xd74917acd14e52ee, 0x3f2294327af2d031
+, 0x89a7bd0abb7966fb, 0x110a1477df04182d, 0x0d7b535eb80169fa, 0x6d50647d6e85029c, 0xa96824d4480ae45f, 0x316c291ccd5d233a, 0x4a54a827100d47ad, 0x0f12a9e430bf037a, 0xb845db08e6b4985b, 0x0230a555ae7ec5d6, 0x559ca5478abcefce, 0x3f6d5502bed916f8
+, 0xbee7e61adc416fba, 0x2619efd66eb06d13, 0x0abf7ab46e8ed89d, 0x09146993bdfdaacc, 0x5a87a5b09784ff4a, 0x0705b8a4d6e4181f, 0x093acd12db4d2416, 0x481d1cfd08698e24, 0xf9becffa899b2d3d, 0x3aa54b2b60993c43, 0x8d2bb63ed3b09fd8, 0x504b83005f93e7d1
+, 0x235806320738efd5, 0x14a8e6cee539b5cd, 0x221808a566443d4b, 0x15fe2ea77cad59c2, 0xc5819a368900926c, 0x565afba4ef8d7f99, 0xc245a7c84a3fe564, 0x21b5d5c52ca1af35, 0xa3145cc9340f479b, 0x6218cedcc016002c, 0xe1a3a52056f3c621, 0x714b1538bfe34415
+, 0x2c9707085fd41904, 0x32bf36c2df45cd34, 0xd57ccaba321e7b83, 0x25fde057b1281f1f, 0xd3469ccab935c3e4, 0x6c7edc56824d0bd9, 0xd033f4773b2e8453, 0x59b1eeda4402a542, 0x892005af0b19313a, 0x0a20e08b890fcdcf, 0x79588e5b42e1dca2, 0x6a77a3d20ce6068b
+, 0xddc9b4865e3ab5c6, 0x0c416221e426f6f0, 0x77f795815c8b4bb2, 0x308d5c02082b2f7e, 0x99b6fa5b2630786c, 0x43bf5ee57f05fe0f, 0x381e0a11afcbd84d, 0x0eb021ee0c9dade8, 0xce8931a5590df6ac, 0x37c55ea1bbd0a989, 0xf17f1085ba76ecea, 0x6baf0be5bea2cd9e
+, 0xbe7211609166e404, 0x54e80881c73104f5, 0x98b8372dc438e432, 0x78570481a35ef77b, 0xd46e30433886a818, 0x2f26b8474c28b8f0, 0x578509ac94be09af, 0x29c3c377737f1048, 0xce1484c86b79c5e9, 0x31de62f6d328e13c, 0xed749930c89cb0a6, 0x7824f712e32e1910
+, 0x49875c7b90cf0afa, 0x20faa67e0dd3e4aa, 0xfda34cd3233288d5, 0x682d10344fa447d4, 0x40daf64f89df999b, 0x1145001255087924, 0xa27981314cbac749, 0x3bffa3cf1b1e214c, 0x7b0c12840cbe7d14, 0x01c85ec9c34a47c1, 0x3f9cb48b80792192, 0x0f3999a39d3d13bf
+, 0x8f756cfc712564a5, 0x35c76ac21da35977, 0x7b833f3724caa750, 0x39a4335fca04f1aa, 0x3159aed306155b24, 0x089f789aa5e4f1a7, 0x0732b912c0284135, 0x261cdf1c978c4e5e, 0x7d0cbb2bf12a66c0, 0x06a4fc1cbaec30c3, 0x0ab0ac84dec25798, 0x06d3bb0412b2c0ee
+, 0xa2e25c04c4a8f018, 0x4b40b4c5bf899d75, 0x59590d810793b754, 0x30853dc74a1cc387, 0xf15493b0ad87ba7a, 0x05b791481ffd31f0, 0x85d6a93d6969dfe9, 0x15378832da29e845, 0x82ebd3d19469a37c, 0x7be7b8a0db50f0f1, 0x34b991692911a592, 0x299be759c7be4696
+, 0x824e1ba7aebf8b17, 0x528d3dc2bd009d4b, 0x75ef902e55ec3392, 0x7c0759114b42d56b, 0x759b800c38920a84, 0x52c2d69988904952, 0x1f7da6efcdd7ac88, 0x268a9a540c33831c, 0xa0201e875bed1bc2, 0x2983de6bbcfca132, 0x260d822c6742bd60, 0x7e8f2d9bd98fd107
+, 0x5b0170a6d683a6eb, 0x3a0fd4b593109b0b, 0x7f4637f58ef87f84, 0x5cefae7de54e58ea, 0x791741b722050155, 0x4da5a21423d85a99, 0x0a37953f6fce1185, 0x288ab7a0e29871b2, 0xe721ae1507d58cba, 0x3d1b1d0f27675a4c, 0x075e7cbc5316f2f1, 0x7bfe7e521ae04f98
+, 0x7bf413d06ca0ff32, 0x71ab3aaf5b3f7bb2, 0x94f7b74be60d32e2, 0x189b7185c85d3854, 0xa3a8071767472ee9, 0x41876d5d3b7c6864, 0x93aada693cda074c, 0x195b82b4d55d60ed, 0xa60afcb6c3f518a3, 0x0b16e012b54a63bf, 0x6707db6afe376d4f, 0x1d18c5457c061da3
+, 0x8d049bd192289b8c, 0x034398b4160e66e7, 0xf5acbb03cbf55411, 0x133e5ab019661b93, 0x0530d236171ee12b, 0x097d9ffae2bd8939, 0x68d5bbe5c0e55817, 0x73df54efaa74c927, 0xe717016abc10861b, 0x2718d7e27acc6607, 0xc92ba4554a789544, 0x194ff383015e40f7
+, 0x1167293c31e8d452, 0x6a224123880d37f2, 0xdbfb7739a406bb5e, 0x4d7e5ce9ee9f7dac, 0x677704a7a6477c40, 0x65a5fb4dabe6e570, 0xf1bdbef507efeeb1, 0x0c75ece5dfe1f5a1, 0xa8b8fd22bbe9d218, 0x3fe73ddd0236cbde, 0x48f98ba8f063be84, 0x363af7f6a2ac7135
+, 0x393032c32191dd71, 0x37c48b55275a162d, 0xe419cc1c8b93476e, 0x2bd7d471bcaf267f, 0x1b522161f9e3f3a5, 0x61acbe88eb57c6e4, 0x5e964984f21f49ca, 0x63ec7907955bdaf3, 0x1278163a6cc30eeb, 0x2d705054a89bda0e, 0xcc47c2eda46f9eba, 0x480d8b7f82ee778b
+, 0xbb449670de5ab3d2, 0x27cff350d42d3e0d, 0x9af894f4f4058c62, 0x06c74c6033e8ed0e, 0x35c2567949581e81, 0x33b6e163613854cd, 0x73702cf71e207b2c, 0x644fd3636b6758ca, 0xafb8dd8da839c80e, 0x25dd6c05279218b3, 0x1bda983225d285fc, 0x6e531fd37022a3b2
+, 0x5c060b5a2e5845a2, 0x0d646a23132fab49, 0xd7b76ed9aff6dec0, 0x60ba34e7c7bcf116, 0xba0a4afdd3bd0db0, 0x4131c0a51796e777, 0x4342576884dfd2e9, 0x68bdf6de764449a9, 0x997411df146b6f36, 0x5003b1f6368c3b7a, 0x87658f908656c812, 0x1c13288cbdec968c
+, 0x0442d1b3f57ea506, 0x61f3975f4b24844e, 0x450a35c024998feb, 0x06150eea03994c61, 0xb6fb866a47f6bf17, 0x41ced12e4773668a, 0xf2a267f8f9f8a3ab, 0x21336952a92fae72, 0xb275048806c73d92, 0x2055462941654e96, 0xdafedd3d0f20427c, 0x4df57c7d0394809d
+, 0x3c24fb8aca680beb, 0x65e631eb45fee5a3, 0x42ac9e552734521d, 0x62f77896bb1d9f52, 0xf39d9169cf31f06b, 0x1fdf8e927d9ea657, 0x06d3f11596913143, 0x121b1124cce44eca, 0x1c5bd72092186d04, 0x74ee3de448b8fe93, 0x972dd0074248189f, 0x7e42309e42a7c5be
+, 0x836bca59d51b982f, 0x31ba9fac5b4be344, 0x50574e89a23d6bc8, 0x675234dd226118df, 0x1f453a719c65de33, 0x176c303546266a6a, 0x59ffcbfccb1af31b, 0x51a0426d3a2e5458, 0x6cb9b52d55be4a33, 0x7ccc4316c5d64828, 0xc8d95763eb4caf8d, 0x7d5595ea3ae67456
+, 0xfbc330d141ccab92, 0x4e3bb81eb0ca0e4c, 0xb735e52983cf4e3c, 0x19676ceb9eec3d62, 0x988b058a53e9b255, 0x2fb0d1655f59fa9f, 0xc50fbce3033e6d09, 0x5a9680a38c9dd7d4, 0xedd75dd9fbcf9b2f, 0x4dda98ca76476926, 0x5bc813614ab32513, 0x0cf458b36898d1be
+, 0xcdae29be17438e76, 0x1679a9d0ae706829, 0x0b7e4e67b3a9cc57, 0x10f0eadbae97c099, 0xef60aef1469a46ae, 0x34b945cbc2f49a00, 0x2f58ef80494f1166, 0x63a029dc46e688c8, 0x9307a579b7dd11b6, 0x224062a624181168, 0xc0f660994c4b5ec0, 0x61e960b0790d5b29
+, 0xf61fc03fcc792d2f, 0x41463880e87852d9, 0xb5bd550e1636fdaa, 0x215d4142dc86900a, 0xbda2a958531b9b35, 0x33d1ce1be3338fb3, 0x37a1c0c37525a217, 0x661712a1df0b47c4, 0x949da6d84e45da61, 0x42824c7af9ddef00, 0xc2da251e8cc6da35, 0x734e054fcbfa9ec7
+, 0xca4a524ce07e3ebb, 0x747f60129630904b, 0x63d75dce65cbc741, 0x34867533a617f0dc, 0x3a80357b8d118b28, 0x191b1820d9aa1827, 0x026d213232000b06, 0x1d805fe279416ee1, 0xdf92e80edb1e4077, 0x480bb4d3bf7fe28e, 0xefd9274b45985006, 0x31b62a9a16f2347b
+, 0xaeb2a9077ce2a3cc, 0x03c500bf4f2a467c, 0xc92710a01399ee46, 0x7348f6cccc0745ed, 0x1b4eaa263d53e951, 0x2b28a7f776cfae18, 0xf30e607d9a735f38, 0x50fe0d6566322e4a, 0x581f44d41024b01a, 0x72f6970113a9171e, 0xeba26702e4c7392d, 0x38e0a99fd80cfe6d
+, 0x4370fbfd3dded715, 0x1ac7dda4827ff30b, 0x086ca7152f8a9059, 0x41c48f683c446ffa, 0x3ad12c65a89260eb, 0x0977176864c71215, 0x48ae8a8035302e36, 0x40ebd93554e01de7, 0xdaa09a39344262d4, 0x770c6f2c35dc5dcc, 0x831a8845b3534ad5, 0x728202aaed37ddbb
+, 0x5515926bac587d1c, 0x001bcc6b579e3e40, 0xcfdd934058b7e626, 0x2e314389bcec11ca, 0x457862e52f53ffef, 0x00bc3eb7f698103d, 0xb84fe2e115d812be, 0x3ae8f0c2907a2f9b, 0x204f5364051ac1ca, 0x499fa81c1ebc9b8c, 0xad353297c91dae6a, 0x1341140c0a60ecdf
+, 0x075506c81bd246e8, 0x3de434694539619f, 0x653d744f5996d9dd, 0x107ea82e4dffb590, 0xb385016526667056, 0x240d5a4c3d3d2928, 0x7e9022599c4712fe, 0x16b5e5c69d9461d7, 0xc064d5f8bc90a45d, 0x1984276cc7f57398, 0x7b57117632695be7, 0x43473f07f7b83784
+, 0x068a486018abe9cc, 0x66285802d20c5cbc, 0x0c3a3efa156ee089, 0x48d095866f926a88, 0xff6267273693efb4, 0x2db7b36c26a959bc, 0x5a9647143308b416, 0x1919cd729985a09a, 0x18e76b1c3bc944e1, 0x2051925e9ef6fc33, 0xed70ace10da445be, 0x108a86437f1d7735
+, 0x63fde303a51d04b7, 0x3d5967736c287ea6, 0x3f5416a3a51c7db7, 0x762f85ca54b2daff, 0x039f496fb3fc2f82, 0x661cc8f3d7d7e83d, 0x671a1a7782b50f66, 0x68e625e1ca6a17cf, 0xaf1a90abf6395952, 0x7263ade1bc0d1193, 0xf908a22d9c906662, 0x097cd9c98e38d148
+, 0x2194549b4f342b9d, 0x3a58b348a250b9c5, 0x2bfd4eb971771142, 0x609fc074216adfc8, 0x8c694ac824bc53e1, 0x5a256c36dfa10dac, 0x7122b56f19dac48e, 0x6c9e548211c9b4f8, 0xe6a5688b1cc67a41, 0x1d761e220f4b8f2d, 0x62d33d7ca74a5ccb, 0x175e316ce3ebd92a
+, 0x50f5be1e5a507dd2, 0x4e9e9a072cfe3afa, 0x4d9786ccb03c34f6, 0x5b03229d2094d609, 0xc26776b7afc58be8, 0x6cf7ecd5545f0236, 0x323dc9cb9eda8af3, 0x4ccfe1a1e3faa45d, 0x8b346c0722a0cbaa, 0x59159f401fa2add9, 0xfa95ab3b345d33c3, 0x0d282e11520cbe77
+, 0x517cdc61f2c85936, 0x3032162103f537cd, 0x1bdebd3dc4f3362e, 0x3278b9ef85c471bd, 0x6f892e821ac98ed1, 0x3945165b1ba2f2e3, 0xeb2475bda8549ad7, 0x0318139bcceeb296, 0xab2d26f662c3abb6, 0x0c0c19d694557f66, 0xbf242a7e8d9f0c40, 0x6929f9ba473ecfe9
+, 0x66f7d48c21ebdea2, 0x5e33928bd11ecc8d, 0x6dbb1f3a8e9ec0b7, 0x50f248323d5fb2ea, 0x46fde7754bef3d6e, 0x4cefd558da1abaa0, 0x68aafd61a803d4d6, 0x51e1342e2a1fc684, 0x90ff7510c7f74c11, 0x49cc4c9797ce6e52, 0x076924ac6a727f63, 0x168a42030cb9503d
+, 0x0fbbdcddaf52ed00, 0x5bec9e72ea829aee, 0x6dd668c5e3acc84d, 0x31c634c5048c0c84, 0x5efb61feaa2ccba5, 0x6f612580539192d4, 0x529ce7482221628d, 0x5d098edf80cb32c0, 0x11bc8b77ae1fe91a, 0x78c276813a6a153e, 0x571bc7d612be0fdd, 0x48e475e9fbc7f228
+, 0xdab7522de927fb60, 0x72e342c4ac2f84a9, 0xe580da751f4f9025, 0x156a71411aeab0df, 0x603a75bcfd759331, 0x6c84b6bb000b2c95, 0xfe8001aa4ec6fd07, 0x6ba490954f119af1, 0xec3bf5cdd2603de9, 0x6bbe15037470fa6a, 0x88098d8d30b78ab9, 0x7b05ca8319bd80cf
+, 0x282f5da45dbba553, 0x7ae9b7aa87587a84, 0x89b7df6387865232, 0x4ea8fe614ef5fde5, 0xd5061ac276f694c1, 0x18c85de188687176, 0xab6e1e84d61e53f6, 0x48170f05f7be53a1, 0x9eb8d0cc780a8615, 0x319fbced0bb37c30, 0x973246affb817c0b, 0x6c5dac0ccbc0362c
+, 0x53f43df5f4b7f8a4, 0x7f562686f6055040, 0x718e3f10ae68cf31, 0x0c8e2f7580c782c2, 0xa22e1750e6cd454a, 0x0ce6146efc428be4, 0x65e24a04a9e10db3, 0x75dee24ef4fcc215, 0xb7367cc10906d722, 0x1125ae5e20f14798, 0x1a52d97e8ac3e891, 0x46c9e8192abc1e3c
+, 0x2305ff465e006b31, 0x3f09e8ed17d7a00c, 0x29a24c421e735db4, 0x166b63f40eafb9bb, 0x4df94c5a886887a3, 0x6005a691d9a774ae, 0x37cdb0c8d3de9d66, 0x448790c5d7197dd0, 0x9b5c66548a4a2e0b, 0x24b025c0f80abaa2, 0x432668b86bd1aa12, 0x7482095682295d2d
+, 0xa52161269851c0e9, 0x2cda4a84cc9b6862, 0xa57964201efabbd0, 0x6807db8376a15136, 0xc38629d474486e49, 0x44388427af568eff, 0xfc2ccc4e8a6254f9, 0x60ae41265866f9d1, 0xc27d233ccafaf312, 0x1c2e6966be4cbab2, 0xaadb9a1382e93e58, 0x63de555175c24a9d
+, 0x4f4c6e59dab1a19a, 0x44f69f9fb1b73212, 0x32f69993ea18f4ac, 0x0be3a1ddbb6b4143, 0x5408f34504eba5cc, 0x5d62d5ca95f62461, 0x10d605f33a826de3, 0x38b3eac0f33b3867, 0xbda58d41003b54c6, 0x2f57b863b7e12143, 0xd094ffd37a97948a, 0x0ad475ef47ba514e
+, 0x89c538b1aa242ebd, 0x0d7b4368903b8608, 0xda9f3b55964f2972, 0x3a80c56044618811, 0xc075386c7dd37498, 0x7a84396f5ed13477, 0xa816ed4074ceb518, 0x00c5fcfbedd98cca, 0x01911563f3cb5caf, 0x25126b255c0e2587, 0x50e725e9b2c59f9d, 0x7edc50eb1c0bfc00
+, 0x0e45e7bd2a6f97cf, 0x3a50fd886c2afcba, 0x9cdf2b977b8effdd, 0x23126d8f32ac5338, 0x3c724c899d99aa77, 0x73471ad36af35fbf, 0xa91f9fc76e618a8f, 0x3afadc287c7f2a20, 0x464cf21815975c9b, 0x4d9db6329d542071, 0x0b7eab3aabdd990d, 0x7ba89ae4c89839e1
+, 0x96acb925c7d13c23, 0x5940ffc474e06f7c, 0x9dbc2a6040fd2802, 0x1d136e4ef74688c3, 0x5578db96f668dc48, 0x221ef42b0cb82bca, 0x6ac3b7a309788c09, 0x052ec853e4712d62, 0x56dc899ab6b4cb4f, 0x0d55e157be294f02, 0xeb955d9d8f647afe, 0x72b4ce57c38fe878
+, 0x88ccc70675e1365e, 0x74c8edbb75087ac5, 0x8b41a5b38b282ae2, 0x1253e8be57c1de08, 0x13694ca5d646afc7, 0x35e8b5e71972e5ff, 0xfee64ca13bbfd5a3, 0x6a4f53b4799967c7, 0xdfee9719a280d9b1, 0x2b3ed1dc0f33e489, 0x611f1ad6f01703a7, 0x0af3c41417b84542
+, 0xc4d8784f51100880, 0x05a160c17f35a02b, 0x93b37e841f8404e4, 0x206a4e9fd85f7187, 0x927cdf4c1c528638, 0x7d4eed693faab309, 0x18c77121833499d2, 0x4794f36e0c8900db, 0xedc6dc4403fed214, 0x34edf15068e1e19c, 0x1b1ef6422bc2e7b2, 0x2df446f168956b0f
+, 0x99f4947f9286cb3a, 0x129ffba54c846837, 0xfe83ef90318ec532, 0x6df1a4c9f680ed3f, 0xb7caca3dd19b6391, 0x6237b5ba5386100c, 0x19b069fc92571f84, 0x6eed57a3d3f32dbd, 0x3ff2145216700161, 0x09e9b3db8f8d152f, 0xd654f62f4aaff655, 0x3c3aa94b05fc92ac
+, 0x077f0210d3a3d450, 0x6a60565cdfb1ddad, 0x05131e1ce87a0be5, 0x09cf558af524c59b, 0x6fedc1c85f072d0d, 0x457d9e4fcc6e8bdb, 0xfebbc74e09b1c812, 0x7af9c0d0389b0999, 0x10170fb3a69c4952, 0x79e17670110b48b7, 0xff1dc69d0b2b732a, 0x14375a94ed9d76cc
+, 0x494e6c950cb95cac, 0x3a392a1f816ff2a1, 0xbbe843106081aeaa, 0x3c3952c3dc059982, 0x5ace6bf2cd60a02b, 0x73be32261ab0cad3, 0xa732177384525321, 0x35403145a99e06d8, 0x50af832636f19ef9, 0x0c5c2aa45a32b513, 0x3f78e52f08979131, 0x15e635aa7f262b76
+, 0xc1590c613c1092e3, 0x698ee8fe626c1a77, 0xaf58ee6261c29434, 0x19ebffb579f2390d, 0x78f2facf472ded86, 0x476fcb6e04c1e66b, 0x0477ff0bc9cabb10, 0x1049a6483c075946, 0x1c4c4691ad019fbd, 0x050c9c7e1baa3bea, 0x092fd6ebb3b11254, 0x7b362b5379451456
+, 0x92666cbe57743b77, 0x3ec85fc17e498b50, 0xded307e73b835e8e, 0x6f069d0e2d2626dc, 0xc3811ca528162f43, 0x6cf21e0e3b42c8bb, 0x5f4e39b42f1e5bbd, 0x0b53ddef8014d097, 0xcc9068556c189a2f, 0x0b528a1a17456121, 0x947060c654804ba1, 0x2f010104b3550748
+, 0xd1f65f86f5395f6e, 0x255ef79ea9ff57b1, 0xf19c9977781b26a0, 0x2cc8d8ed39aef78b, 0x9bf545b406cb548e, 0x604127748ce0cfb9, 0xbeef51f27653729e, 0x5a6ea1aecc30aafe, 0x0bb79fb5ef4c8fd6, 0x3105341b776143b5, 0x1e0d938d3cde7d22, 0x3baf3df13d623d8c
+, 0xa01b26ec2cc10330, 0x382d7f0fdec57b4a, 0x73c12eb1a1e9d52a, 0x24cc3e19d255bf4b, 0x06725e4231459d89, 0x187f5d1aee869919, 0xcc1febc0b36d2e75, 0x7e82b84179f0912b, 0xcd2950a477b8a9d4, 0x616a8b40f96a390c, 0xea496c1683ad341f, 0x7039af021938994b
+, 0x5e96257ed5b5ab51, 0x3988fdd844efc4e3, 0xb43f0dde28dc8861, 0x6a6db2a1833c4ebb, 0xff779a876a6e6f89, 0x5e90a6e7252594a9, 0x5c2561a078f66623, 0x2bb6f4b8eda545f9, 0xfd098b6b4dfc0988, 0x28ce6e88547a9467, 0x8036dbf607d0916d, 0x41b61644df661319
+, 0x90a5bb4da450ca1c, 0x3c40903bd053808a, 0x9418e0c19d72985d, 0x4eb7cee2217227fc, 0x0004e71b3e177e04, 0x70bc80474f62e0bc, 0x382c2d7c413ed3dd, 0x7fe50e4e928718a8, 0xf99772f953c433db, 0x7eba8b42f2016373, 0x77260918e6ee49f6, 0x60871f77213fa87c
+, 0x1101ce92eeea8d49, 0x1e47e17e76058011, 0x4efb07a40f289172, 0x4a65581714ccee62, 0x14d841e6fcfe5122, 0x6feae85a93c90fb0, 0x0a5779b4d04843e4, 0x5f920a947fc387ea, 0x0d46ddb5690b9bea, 0x2d907ba210f136a5, 0x118e65444e4e5e68, 0x5d2495db1dbe8d2e
+, 0x62d151bc34371e11, 0x0fad6fd46b40d3e1, 0xdc3080bfc945b11a, 0x07ce44878eca0d93, 0xd2a33381372431e8, 0x2c3225e053ada46d, 0xee2efaa01fd30603, 0x1620f5fb1d98990f, 0x58ed1e21c3daa3a1, 0x1b6b189f1a421860, 0xf12b558cdf9a184b, 0x5c04e42634ba0a83
+, 0xd5477e7289d7b21f, 0x1019ed66b77c5a69, 0x82f33d142136695c, 0x7d6bffd1c83dd3f3, 0x1890fc2073bd983f, 0x173fa1821a427feb, 0x8f1897052a37a66d, 0x78a2115da34ee10c, 0x636538dbcf30e851, 0x5b7a01eacbf707c5, 0x43112d63e1241f3a, 0x68b3451d5d1c7967
+, 0x120a98f04723b2ea, 0x49df6d82bfe74cf6, 0x333f0f8743f64ae5, 0x5d2d61da3730831a, 0x10a02b43cbb643cd, 0x2b17f0fae6e6d9c8, 0x8f8393048a971d8b, 0x0e40afd864c4a36e, 0x172de68c346f5029, 0x7d658d73c0144fce, 0xfd31121db57bbdde, 0x1b5a62d282737f08
+, 0x8a29c8187f8947ae, 0x1e63cdb5cae28f27, 0x229b62eb03fed31c, 0x08fd54df7172cd64, 0x2cc162233bb1877f, 0x65ef91218a39a53b, 0xef0c248288ee5a14, 0x1dc19330b43921a0, 0x6f08704ccba38081, 0x6ab58992b7134191, 0xbef1429f40abaefe, 0x136f5e6375c1edae
+, 0x30c15448c74733fe, 0x7392b9e693b7d6ef, 0xbd481a7defad0f95, 0x69eaeb96a7693e54, 0x611cc0aac5f74002, 0x1768682aa65da93a, 0x0d39741d14a665cf, 0x5d2afb86b03c1dd7, 0xfe5af1b676174af1, 0x5458f2850afccb1a, 0xe0a0013b3a1d2f18, 0x2bd06c0aee854073
+, 0x922274a267a7a508, 0x1e26f3efcdce30f6, 0x7b70d4c5558b4522, 0x615e1967fb322909, 0x6d0d16978b4bd7e0, 0x5f37dfe0fca60bf7, 0x6a71ed19fc2f899a, 0x6ce3cc3afd4ae413, 0x51dd84c23c0f408e, 0x661f61cc8e11699b, 0x9421333eafb48b8e, 0x6597428209a9e293
+, 0x0fcc40c16a126dc9, 0x332078ddf940d561, 0x0bc937cb497d4f69, 0x447698e19158d085, 0x3836c60bb3b10668, 0x6af55429742a0037, 0xfb4c7d23c482a516, 0x403fe25ac5707caa, 0x04519a4c4fe65c46, 0x40da91f9db27fd6f, 0x581e1aebe504267b, 0x6cd3388c75befbd0
+, 0x02a507db2a61ceb3, 0x0efd0f52c39f079c, 0x63668b9a16cdb142, 0x45c6e10d53100b23, 0xe6c5bb306e35ff9c, 0x13f12df32667112d, 0x85e00188f7303e16, 0x740eba61d5b0ab58, 0xb8db5c4df647902c, 0x2e4760ba7321064c, 0x7cb3fd084785a308, 0x0dd05152e43e3480
+, 0x485f4eb20974aaa8, 0x1d87d86bef6c2449, 0x9b777946886c01e8, 0x4a357d2a3de605b0, 0x26280348968d9438, 0x306de685f7318a8d, 0x50002c67560c92f9, 0x523dc81bbd43e21e, 0x4cb99b4ba6731d42, 0x202b506cf6c95bd5, 0xac818c8c519cd5db, 0x66488ee0c02b3263
+, 0xe20f02293457ceda, 0x16a4e43ac51b4628, 0x354921f6d97be4fe, 0x1fe6649a212a8e11, 0xf1840b6d913e9285, 0x393cdb11f6513f35, 0x7593ea7706bd0ba5, 0x0e393701deb9a58b, 0x61dab2a3f4d5581c, 0x626dbd7f11cbd907, 0x528a9c468fc8f062, 0x25263abdffc5851c
+, 0x210a05c35c89ad4b, 0x72d9a4a35c9f2e01, 0x247d70772fef41fd, 0x70673335b34f3e5f, 0x241a435832624624, 0x087d46ddb6bdac7e, 0x0ed083b35b319f1d, 0x72a91bcd29e154ad, 0x5c12b8147797ab20, 0x6588648fe47ad809, 0x88a06b47eb3ec538, 0x6160a0df43738749
+, 0xfa7c0e57e6865f67, 0x284dee31995031ee, 0x18ff44cb15055994, 0x0e487ec939304668, 0x1d29e9fc310b709c, 0x78435cf285063249, 0x1485e3941e48afdf, 0x6a8efd8ccc890b76, 0x5c958ac0f8fdda9e, 0x3f792bc69cfa40ee, 0xf581740adc2127be, 0x582be683cb5937eb
+, 0x7d90bc1732785b15, 0x7eb27411b0b98b61, 0x450f692063995f77, 0x53d659dead17798e, 0xbe792219a5b1ec81, 0x09e226ccbde78a3e, 0x37eb2ebfe5a90335, 0x1ddec7d3b63500ff, 0xb502611b708038fa, 0x6c8470a01df209f5, 0x1ba4a4497368fdcf, 0x6c83562d8f1c5f59
+, 0xc448b9d67872e496, 0x77fc75e1cbb05151, 0xa08847ec7be060de, 0x44d815d321c7f537, 0x8d6982ab657d77b0, 0x422da7718b725652, 0x7026c9c920593baf, 0x3a90a11de28d3e0f, 0x26ded8a1a3f1cf99, 0x03c5b56617a7582f, 0xd10ba976276bb17c, 0x7b2d126425a37084
+, 0xb236fddbc2494838, 0x4f5967b37ca4fd2d, 0x6d5b11020c1867b8, 0x7d5c881c159a20db, 0xbb40f8a9ee70c1a6, 0x41d5658f100bacec, 0x29ab0bf3cdf2ae45, 0x22e7dbc6cd680af7, 0x4d96eabb3d7a638d, 0x6e44f9ed105065f6, 0xbe9659c6b212bdc4, 0x6d24bf2ee5d9facc
+, 0x203f8fd4ce100f51, 0x79119aafe52d256a, 0xf8b639bd0e8ee0df, 0x4a1dfb09c3535df2, 0x06e15261bea67ac5, 0x726d4cb43efc65d9, 0x858e9229d5314cef, 0x75bec49c07c5cfcb, 0xcc2661eceef408eb, 0x605df86a8837bd37, 0xe06400d330335d73, 0x47f06740bd0a1c3c
+, 0x4e7aa57e2d914d2f, 0x3af42c95b314efe4, 0x98b10b6e4551c859, 0x1a4c0057b3eca088, 0x48f34988437b7a52, 0x1767205c597f153f, 0xb5907881c5f7b508, 0x51090709d43d3cf0, 0xeffc0413f20d9c0e, 0x7d6d59c6ba8a64e6, 0x7125ebf06b0b6ee7, 0x553ce8d9f271b4c5
+, 0xa53dfb9232936a7a, 0x10f2760f27179959, 0x52dab9b347888fce, 0x75214187effa4193, 0x4090f36ebede3c5d, 0x11c18921a142ade3, 0x21b666c27d3c00dc, 0x57475c19d9f57d90, 0x39e914de852f1213, 0x5575234a4a097fff, 0xf9ac3db13c860742, 0x24d5bc953e882714
+, 0x797eb6b2b031be92, 0x01ea261047e93824, 0x94d26804f33667c5, 0x2d53b567fb561a40, 0x67e4ffd86601be3f, 0x5595b48c60734c16, 0x37b2309be25a21b1, 0x08dbaa14fef55d44, 0xfd9f4e24493a1a4d, 0x19f80628c7a4dc52, 0x53b0da1a1f278445, 0x635a02a7bb09acdd
+, 0x0d3e7ea20a14aa3e, 0x6ba7db446d47da2a, 0xae1a11150623b728, 0x56bdf37173e00c21, 0xa7069eb6ebce511d, 0x744dd9b63caea59a, 0xc5a60521e6b3b38c, 0x6a7da6786a7e1ffa, 0xe817cf77c8822b95, 0x774bf00729e7a913, 0x2566b18dd799ac9b, 0x4f81b4f011964ec6
+, 0x4c49727a1b3fad3f, 0x65d3ff21cf7e846f, 0x9271f2b95cd49786, 0x0d85476ab17352bb, 0xfaeb288e189cdf7d, 0x4463ab986f181465, 0xf7cdda4f0306c7c5, 0x044031f103fbd1db, 0xc6e9bb16ed2dc8ad, 0x1e0f5e3e01532695, 0x55f1512eeffb35f0, 0x718f8bd801f1754a
+, 0x42c5676af172290b, 0x4422fe59f365b873, 0x0fd200274a0e0bbb, 0x09f33357f9f427ce, 0x70d76866ab0d2bf4, 0x3924255262612114, 0xc72b240938e0f3b7, 0x2eab81ecac080ea2, 0xdbd3cd43c397f07b, 0x6e179a5e2d45e9f5, 0xccf5387207484a77, 0x126112766c49327b
+, 0xd8346ffb4ad2ffc7, 0x1594ca00661a7e80, 0x2d428ea87a9f2c11, 0x4a5efc279f302391, 0xc21a8f5e025ac9ef, 0x0b8327c0a3ee5979, 0xcc051347fec70910, 0x139be0e8911ac484, 0x831d37e01ba578e5, 0x26898f4ba3611799, 0xec2a4a4d2467367b, 0x0ffc9db892fad952
+, 0xf3fd97d39653ae37, 0x658bc59782884e32, 0x8299444e49285c6c, 0x4e20a42806480a8e, 0x7b35f86c72757d5e, 0x438b7cfd183d17d5, 0x6d169f9e4c0d19ad, 0x1e0c7787d95d7ee3, 0x67014b6c9fc91c64, 0x26e21c818266daab, 0xf780e48117815db5, 0x2f88e36297e54deb
+, 0x3315b70638918f28, 0x45581c1150b92384, 0x473138f66dc96ddb, 0x66992416faefbefa, 0x29820f8fd43ca97f, 0x2c518cfec85303e5, 0x2534ab11759ae119, 0x29bf84ee421b1ac2, 0xf4654e154694824a, 0x07419ebafc81cf62, 0x16d33f6a986ad4ae, 0x1816eece6916728c
+, 0x3230e2f98bb6846e, 0x73af561b18e48126, 0x1f428cdb20310295, 0x37798f2b95800c2e, 0x3f4a0a101c930c91, 0x7d4116decf8208c4, 0xa6c92324b0c9ef7c, 0x6d45fa581a84c101, 0xb6adf752c3390916, 0x49a17a11dbdd021b, 0x3f8902ce2a870486, 0x7c68799f6da7a63e
+, 0x4d743d47f0c62b5c, 0x091a8bb0922eb864, 0xd12c5611a2b0bd88, 0x35464a2d85c143be, 0x5c14891aa8a233b3, 0x308103f25eb76e5a, 0x11b1e2ce3921a41b, 0x2b50ec56223d1ae1, 0x2c6c0f7b3481e547, 0x326f9984e9087d10, 0x6cedb49b86a4d8a2, 0x084213eb2cf18597
+, 0x929a8a32ab3bcfc5, 0x53a3393e00c72d32, 0x7198f5918d415c43, 0x2f82374b4cbb5e10, 0x97bf4e22ed4eccfd, 0x1697087eaa57354f, 0x632277afec518d29, 0x649460e82ce46cd4, 0x1947672d1b8700be, 0x246f86673f2aad74, 0xf5df8fd12da84215, 0x3cee1af461975905
+, 0x6c67b6db92845562, 0x024595f59d814ee7, 0x3c0d520c48b6ede7, 0x3092e3e194cade48, 0xb45154d4dcc396d4, 0x3e8c3b439db92d3b, 0x0d796e99ae42f2d9, 0x0103f315a10e2548, 0x3901e991bc6fff7a, 0x6f3fddec2e6dee2e, 0x4295eff3e852398a, 0x0fae1a64e4624173
+, 0x5f056160c2ff323e, 0x720a37d0a9d8667f, 0x55e6d6af632a650d, 0x397f8ad31238025e, 0xbff091783a2bcbf3, 0x5a8838042abbc9ee, 0xcf44ee0939582056, 0x0594b3af06830770, 0x3f0d2bac795a5137, 0x0a90683f5d487d1c, 0x34e5775c46a9abef, 0x2c395fac8f10948b
+, 0xfafd3329a3e21a08, 0x79247f1f5ca3adea, 0xf51f0b4088ddb94c, 0x3330200bf1ae65b3, 0xc1880a0b33cf664d, 0x1214ffe4b954dac6, 0x0a3ac105d60459f4, 0x1d6fc69b3839b3f8, 0x73336569ac749671, 0x1471af36b0993460, 0x7fdd4ebe5bdda6d0, 0x0aecfc6e8bef3944
+, 0x0d7069081172e876, 0x0baa1d117062a07b, 0x6c689a78cef8075d, 0x1a875d027d63aaf0, 0x1e74ed881069c0f5, 0x2c49fbec6d9f7f42, 0x88bf81af531a54b7, 0x11a4c57c5153bfa8, 0xcbfdcbddc963ca40, 0x7f98007c8800334f, 0x14041674e4b6644d, 0x59e4334000f67902
+, 0xdc040c9a7522a779, 0x1d32a54f6393173c, 0x3d0480db0c354626, 0x1794b42c7e2f51ea, 0xe43c69af78984710, 0x36184a62aa5f34e0, 0x2cb0d1f91c0c7932, 0x689e5b93f89fac5d, 0x881253af4d1835b8, 0x1eb19af97b9ef44e, 0x64b3b8f8818d2284, 0x2b540464431a90f9
+, 0xaf386b53217bbb77, 0x57fce5ccb1bcc983, 0x1fbdbd6c8797edd2, 0x6138d7eb277d3973, 0x6ebf01d7252e2892, 0x57781e45b6507d0b, 0x94cb6a9955605812, 0x51a06a2394fcae0f, 0x9e120ebb7c793b35, 0x4af6f089bcbb8acb, 0x6ce800c6a97bdf2f, 0x1dac14d8d3f6d486
+, 0x70ea238b1e2a93a3, 0x48b8b1947eeacaf1, 0x96587700e8ebe6bc, 0x2fa5588a55bb7d0f, 0xc94fb903a0268f11, 0x26f6f82305896b62, 0x7cf5d087a78127d1, 0x182ab56f516d06f7, 0x5bc6e6bcb43e150b, 0x1e8b923b24deb069, 0x43e162c0581af4d0, 0x5a44c1eee586e45d
+, 0x273ff34c6f8a7257, 0x246a07599086d5df, 0x429ccba563f8722b, 0x02238b8447b7e89b, 0xe947767d42210cf0, 0x39f804df21cea8cb, 0x0e572bd3e5a5e1f0, 0x1d2c57dd815cdc93, 0x78d44b90ed0bf641, 0x0560a2ed52c99842, 0x1205bd6d3550acfb, 0x1d837d79765fb5e9
+, 0xc9584075e45c3344, 0x60adef172d43cf11, 0xa3eec4fa952e4ae6, 0x31cb9dd4b64a7aa9, 0xd9e49f3f7441718e, 0x6ca8acec5ace59e9, 0xadbf7dec04c8830a, 0x4cc92a37cb96eaf6, 0x1c9711e755037976, 0x1b81c1004168e580, 0x6fb0465e504c6da9, 0x5e36c8c5662eca1c
+, 0x5ab2e62b1e209889, 0x04755a4a32ed75fc, 0x07cf5bcc03b56662, 0x5646a9dc865ad344, 0xf008c8ddbeef62ba, 0x3e9f2e22320ecbfb, 0x037d43a04217536b, 0x1d5158255bd6f874, 0x4955642baba57df9, 0x26399a1438610b37, 0x8ebbddea7e288357, 0x018539178e6551e1
+, 0x117a33341fca7275, 0x7459ef3625adc962, 0x94e90d814e4e6ceb, 0x1f455fbd5070e1c5, 0xd861be4e3abcded9, 0x7809010dbe8b4672, 0x59ac6454272bedc9, 0x7fd6022648e2e2f6, 0x3bc98eeffe46effd, 0x70aadc8c9b8a6791, 0xce98fb06a2541613, 0x5c0866d6845b0500
+, 0x03f4ff87e2cc82b7, 0x6c16aa8886abd1c1, 0xee5fa54cbdd04ea4, 0x270dd2c5ea2c9738, 0x545743e3868da837, 0x2d2b8260d9a7ee0b, 0x2223d04170d35d02, 0x360da3f6ef27e78d, 0xb8ef244b88d40f4a, 0x2ff14ec28a9a662a, 0x5bf8a41870a27941, 0x55c0c61b2e255c49
+, 0x9097aeafdfc26a40, 0x697662cd09d5ec0a, 0xbba002c79b931262, 0x45bce353d39622d7, 0xf063984c7396f590, 0x4eee3067c679fcd3, 0x3d10b5bf93419d23, 0x59ce7fe9f8ff6f12, 0xbb15d1559d957fb4, 0x59c529e44e40e5a8, 0xbc1b0f1739082ec1, 0x391c2d38372ae767
+, 0x2e55b6044ce65851, 0x07913e7f177be59e, 0xa61efae91a7ffcdb, 0x7537c9338fe23c71, 0x9207f27bf28760a0, 0x45b9a2643b84a31c, 0x647c2998758e8b05, 0x0c23f3ae4e5c1ad1, 0x9bff63ad847399dd, 0x4d79f41ac04b7cb9, 0x24a3d9b1671e7b18, 0x1c5c43ecef516240
+, 0x21d307304df92a0d, 0x3edad3e509c0d5c8, 0x19e682c32f248a35, 0x5589299c251af01a, 0x95f4373a3abc917a, 0x29758bf78b1e4e22, 0xc423db9a51b4db1f, 0x1d54e08f139d0c33, 0x4ab8016d57ed2aac, 0x697ac96770a5254b, 0x1587955beff7f448, 0x21062c44c26c67ea
+, 0xb4b73f61d46d1da8, 0x1275f13684cb8687, 0x583c33599b3dd614, 0x07d726d68a387e5c, 0xd2fae3a6ab765190, 0x54655572682b9c40, 0xee3b25ac06fc189e, 0x7ade91e6d69d0e88, 0x1081b3e26aa72b9c, 0x33efdd9ae1046617, 0x69a4295f31f4e2c2, 0x1741e15941a56fb8
+, 0xbe252b71279c865f, 0x2f419098c7eb0f3c, 0x475a2c291cf873a8, 0x1875c338d41764cf, 0x816c8403fc01e0ae, 0x57011343a1a3cc45, 0x4e8393a6b2ad7784, 0x5f8d6ec657a2ad26, 0xeff031a55d4ddad1, 0x1e34774d595329e9, 0x4653b9a6a8d6d111, 0x4afc9298214835de
+, 0x9c2054553335e41c, 0x199d87c2629f1c26, 0x7fcf63d9675fe234, 0x158f21fcabf02448, 0xe9587a8729c8fd1f, 0x1a4bb3f24e1101ba, 0xa7fe22bf77e19ced, 0x13d74e893317d856, 0x1a60766395a0a372, 0x261adb9d0fbfc636, 0xd32fededd81ba95b, 0x6fe2d536f0a81808
+, 0xfb075df9e1d18814, 0x3d4356837d527c60, 0x26901424b385a749, 0x6169944a3e856c92, 0xea8a989364033ea8, 0x310a785b7c4753f3, 0x169605a473a31769, 0x5a52d05c3dd94036, 0x652eaed10e133881, 0x51ceb36ad587be46, 0x0709a662651bdfd6, 0x591788acb8eddba9
+, 0x73c949b94c953ef1, 0x719c43f7d014a14a, 0x5c6013ff3a56ccfc, 0x1d443e9770b79f6e, 0x764cb4538d5fdfa9, 0x7d11681a7513a394, 0x2b55d06c23fd1f7e, 0x11f63d4447cda6a8, 0x97e734c6bb63a56e, 0x6ba404d49f6e003c, 0xf588c286535f80b6, 0x4ececf26242f2fae
+, 0xb25fe1eeb2584388, 0x3eb455286ee78a8e, 0xe4bc00f00cb8ba4a, 0x282fea6f6e41d4c0, 0x2ff49797a75f26a7, 0x63425447e95e05f3, 0xd60dc6f68b4005f3, 0x50481be40acaa785, 0x2ac501a604b998d8, 0x527f7cf4353d5138, 0x9df95e74a76b9dd9, 0x520e1c874f08b5f6
+, 0x186bc8db5c66d250, 0x3796a89234d2631d, 0xca4f71a5064f6cfc, 0x5928088548662706, 0xb7e0ba34837c41ed, 0x389568a445f6023c, 0x829764ee44d09b10, 0x2f92e26450ed94f9, 0x19234c34f1535578, 0x372a901821500eab, 0x8029351e791b4886, 0x707cf429b8d40b8c
+, 0xd2afaa1cf3911e1e, 0x50c9aaebb2a356d3, 0xa83ec2440a375a70, 0x0f115b7eece755eb, 0xff0208b1021054af, 0x7db710ded08d82b1, 0xef77810978ea6bf3, 0x59654af4627c0bf6, 0xfe3329ca2ec5bd4a, 0x3d976f98e3418648, 0x9d343d4067dd52db, 0x104ad50010a2d66b
+, 0x130dc8e9eb1d1a05, 0x5256bb083dfa6a50, 0x302def70ceb2e90d, 0x4e060a2245bf1089, 0xe88bc14bf68b2d9b, 0x25de632dd35c9ebb, 0xc57ce79b7ef7b3fc, 0x75fa20e87076e0f1, 0xca2171081c4844ab, 0x1ed91b53d95e5278, 0x8e20eb56459f72d2, 0x7170ea47826fab44
+, 0x248f7234cef3712b, 0x65fd42b3f9ee7c3f, 0xaa3ad9d917aa17e9, 0x7051fc4c630e52f8, 0x20184b80893b5a83, 0x003230671d6cf4fd, 0x647589e349e49643, 0x125b1bdd7f3aa4f4, 0x0c4ba19b154de07c, 0x6456a7877bf4058e, 0x23fe23200b6b27eb, 0x4634f2be37cfc56b
+, 0x217b148ba05f51ab, 0x43b92e3e97fb8049, 0xfbbd12a6c093453c, 0x056db27073e58f99, 0x9cae68076d2cac67, 0x5f2f8b23e930aa38, 0x9c127d92ee4e4c38, 0x1456c445fdf80ca0, 0x39f5ba40f347fa13, 0x70ca8a0278b3d8e3, 0xb5495c11b58e8988, 0x225f7a3a8c9f23bf
+, 0xd24c94ba6694c3b2, 0x727a80bbf37df014, 0x72e6eaae36034c96, 0x7f4e1356ac20ac96, 0xa4b1b00ffab36961, 0x456a46e88214fc31, 0x01ff59bb41ed8465, 0x6b12c373a3ddee0f, 0xaf801508a0db118e, 0x1611fed941861950, 0x80a2cb94c7a3015d, 0x627d980e7d681523
+, 0xec882c659cd459ab, 0x5e82d2924b0c755e, 0xb7759e153e4304c7, 0x2358f522a339b938, 0x1321b77b5b25e8ca, 0x6ccfee1bd8714637, 0x451d9c6289474235, 0x5194b854df30858a, 0x4b26998ad88be54f, 0x5ac52a0748a05ef3, 0x1c91a49dfc16d7bb, 0x5d259583590ea99d
+, 0xac47c56e9714e594, 0x288b993f9abf150c, 0xb324a3c0567e30a2, 0x6e5692e6c003432b, 0x4d8c3e3125008949, 0x5b35d93f43d11f36, 0x1468f22ba4f2a787, 0x567a0cb9dfc3bda5, 0x8cb0093c5959f856, 0x293201da312c0327, 0x9266df2c426f3155, 0x3fb5b48be6af92ba
+, 0x195c848837ae232c, 0x65a2a7beea2657d0, 0x6e679ae03aff56cc, 0x64e0e30b2c9f3ed0, 0x5bc8c5c168c68f34, 0x2d334c3152b03d77, 0x8e3c9c16b0f2c121, 0x2723b57618476ac3, 0x847045a62d01137b, 0x7c230bcd0fa3a202, 0x986c718cd3e987d2, 0x6987725828d308bc
+, 0x5a9f315e71813102, 0x1cd00938f1df4a96, 0x401ea6c3547206d1, 0x50595e548629255a, 0xe156f05addce833a, 0x4604cc94e59402e8, 0x79052020b7e14cbf, 0x66bc293414f38b54, 0x056172bf15dbf7ac, 0x0b86bb3ceb5a8ba5, 0x44923507231e9d90, 0x36acae679244941e
+, 0xa1bd1ad8dd2c9fbc, 0x430c6f3a10be35dc, 0x477ca0766a902b78, 0x1228c1d06c3c6e89, 0x3b858aaaa8a9400f, 0x50e0f2c50d035285, 0xa558344c9d8980ca, 0x44889f4bc4cdc333, 0xf99cbf989703de7e, 0x057d45dd06b84e96, 0x3fde93c46343dad9, 0x2b3c27f05b59b7f2
+, 0x24eaa5cfba5070cc, 0x452e1523fda9de67, 0xdecb69d08c861c96, 0x2f84425c04d8a1e8, 0x2e9e2f83e25013ad, 0x1ffccdb418049d56, 0x15cd74b7951877fa, 0x5e7e7652d8fd7fe3, 0x4ee051608192ea46, 0x72662cf5df7a5316, 0x9f5e89ad6a9b9d4c, 0x56b003b201f0d686
+, 0x6194663b8cb19a85, 0x38b37bf10b3fa138, 0xf47949be308b8e3f, 0x34fb667be9069179, 0x32c82291fac3b2b7, 0x5c13f1a6d66bbf6c, 0x50271f623730ad10, 0x72a01caf03c6c00b, 0x4c9a4e0d6c78b9e0, 0x7c19a9420c9094ef, 0xc0a60883a6933033, 0x0f2df7e6b502c359
+, 0xfecbb8dd207777cd, 0x4b000868183bc640, 0xc872044ff2315496, 0x31a1f8419cf42fb8, 0x025507924fc6b76a, 0x5769f231d9b1023f, 0xa450747c574c6286, 0x189ddc9f085fe6a6, 0xd1a39db967864a54, 0x5032d1f603e7df46, 0x8d0759ff5ab58540, 0x4b25ec67e368cf2c
+, 0x058a1612586e8a5a, 0x0f0ce4034f72649b, 0xde93b45e7fad58a5, 0x1770ce5b79dc2791, 0x63cc94efbead3241, 0x631be619edede00c, 0xd417ef628934d36c, 0x746ff4738f23c9c4, 0x5156c92678f1e7b9, 0x16fa5a99c89a331f, 0x19dbd2fe9495dcd5, 0x419ad7bb6b592383
+, 0x6d641b8711460f6c, 0x10dcb0641eb5af4f, 0x835236e4b4f78a85, 0x3fef96c1e5703671, 0x50a7e1add3372903, 0x786d4cb57351625f, 0x6cba2f4e5593f583, 0x51583fe5ccf08f7b, 0xa382b5adc61ac01f, 0x2600a43814a7f00b, 0x8cc3e4e785f67114, 0x27ea86b4f32d30cb
+, 0x35f99444ddcc5d66, 0x7a65876c4b98a241, 0x841e5a6695d85fba, 0x257a87a2c1852259, 0x58a90f7f59be160f, 0x472f84991111d94a, 0xbccc7ffd26353eaa, 0x09951de3c52126f7, 0x25d925782c47ff18, 0x6dfff3a94e499cc9, 0xa7c9fbc683068584, 0x59616e1e99f98c3e
+, 0xc57f654f89e2b050, 0x6023055682c4aab8, 0xb356ff2d6b8ecf0d, 0x32c4479e46d9bf9d, 0x76fa071da2e6294b, 0x4c115313a9cf2a8b, 0xf425936fab7d0fad, 0x6f68805b0235992b, 0x8c4d058f665a4dc6, 0x6aa4807697bcadf1, 0xf6cca317d051ea9b, 0x7c0465bc6fe01732
+, 0xa40c9a913c60c2ff, 0x3269d04266534c68, 0xe1d8711e443d6284, 0x31e1dbaf93597f61, 0x84e09c59c3d5c8d8, 0x6a88f8d0a7bf439e, 0x57970e432a329263, 0x4e80a5f6686bf3e3, 0x1dbe8229e0068d9b, 0x11bdb3ff86407851, 0x9a42be32ab88baaa, 0x4da1d59aae84ce92
+, 0xf2f36509287ab17e, 0x1d0ed9905792b805, 0xf5357f1e948bf8a9, 0x038ca80f96a67ba0, 0x13f1c4824f5dd072, 0x3db203e44d3a71cb, 0x6e36edf97ab3046b, 0x1ca7918ab9e2425e, 0x6a023d3e3ba40ccf, 0x3f6606c59fb46346, 0x233b9ca256c54f01, 0x2e5412bd5e154114
+, 0x524815d7659fedf2, 0x7245a59a5f835a99, 0x10fa6a22ba402278, 0x7776958b399c061f, 0x94707435ba14b47a, 0x279bf1bd766f08e7, 0x5a74484b4b2f75ff, 0x31580d4beadee12a, 0x560e9345449b38b6, 0x4fff2f4204fab4a1, 0x018f760f0ecab707, 0x1a9f3dc9c77ea130
+, 0x5cfac96f83b86b5f, 0x0347faecfb515ce0, 0x8ed6e0ce169054e8, 0x7e010aba478f9aec, 0x6c1b1a63024b08ce, 0x7556776bfa1767d8, 0xeb6b1f2cc80ec2a4, 0x1bc2e5f5a3dd5940, 0xf900a763f3e2f40d, 0x59a6eca872e70919, 0x9a97fe58acd452a1, 0x76ef9b51af4c1cfd
+, 0x5d3471314a930d4c, 0x4073ce94badc7853, 0x3147348ea334f37a, 0x2291be6068828c7e, 0x08bb9757312515c3, 0x16514482616e3dc0, 0xa71e23f7b3ee8269, 0x6b6b97cc1f33dc3f, 0x22f42b234a15f5f2, 0x527b72546fcd5174, 0xe734063afc384f96, 0x5f2ac2dab22d2f1f
+, 0x437b58ca36ca305a, 0x16b3636217ab9e75, 0x1bf1f708a73a985e, 0x7cbac41c29d4002d, 0x546ce80b0ff6108a, 0x5477986835df8897, 0x2f8f7b0c2d170365, 0x1be08ea48a75e395, 0x964acae45fa4e869, 0x3899a5b313bf2838, 0x9e739ae4ab7b9606, 0x5dcf678f61139496
+, 0x1686b8ada2220198, 0x5c78781b299a1c7f, 0x5be21f5fd1b8f550, 0x1aa22480e0032c53, 0x2c76f77289b2ccdb, 0x243ce70f268e5ee2, 0x6702fcb4cbc840f6, 0x284c368dfbea59cc, 0x533c78a7433cf6f0, 0x56d1a97f56446728, 0xa69006767de51a95, 0x61875032c235c90c
+, 0x852e884f7e98ff69, 0x1ebea8f49c085a43, 0xd34503deb2211be1, 0x2345e9d999c037f2, 0x4e7b173e8e7cf39c, 0x69127fc449760c75, 0xf14ea0eca4d0d7bc, 0x75f1b3dff40d2c1c, 0x63f9b5ee2f1c0bd4, 0x29b5205f08b7b0ad, 0xb5b30c5218f1b6f1, 0x7d45f2d9cae5bfd2
+, 0x19f72fc5073e9db0, 0x1ec3e0cd4fb0b9e7, 0xe6f1faa9c1460c47, 0x0eaf0b4cc1debf9c, 0xe7548e7130b31711, 0x09627fa6b388575a, 0x1eb9059d317515fe, 0x1085d478c6d97e57, 0xed6292fa9d6c6662, 0x201aa4b0943f0d07, 0x0bfbbd73ff456929, 0x5822564200343444
+, 0x5ea995ce78c77b7e, 0x464c55ff5cde6273, 0x2cc9e06bcdeacc23, 0x2d42268aa22cfcb2, 0x432f1588a77c949c, 0x3b5fa030f79a608e, 0x40edcc807fcb5873, 0x1e587d9aec4f17e9, 0x655f500c315bc7b9, 0x5139d537fc1d0e57, 0xc87b11d3021b5fb3, 0x369823c51b077bf9
+, 0x3c126aea15edefce, 0x71c91fd999484dab, 0x1db5a9370d1310dd, 0x26ff065338402f53, 0xca796171c402c6a7, 0x3584793268c36145, 0x8344cedbc9b405f1, 0x2be8605301c2d954, 0x263afe486c874d17, 0x1be987218e7939c0, 0xba44c924fa7fe207, 0x256937eb2293044c
+, 0xa34dfa4a5c21d277, 0x549e42f965db9930, 0x5fc56ac5f15e28ec, 0x75ea480e56898079, 0x00b7eae518d2c16f, 0x51b86fad14bd3ad6, 0x24cf830ce5aed1c6, 0x109eb67b9adeaa66, 0x82373f0c77bbf415, 0x72d9fd938644de3a, 0x383842321701d820, 0x4a2f75b704557e13
+, 0x872bc4d654919f41, 0x478423efa44010fb, 0x7fcb2097c890fceb, 0x483680efb2b1cfa7, 0xd9b8e8a63ada0d8f, 0x4276d702dff7e509, 0x5f7c1dbc17caec65, 0x59ebe3629ceb42f7, 0xd54942db4c9ede28, 0x6c735df53bc7ab1c, 0xe58edcd6e5fdbc56, 0x730a48c7393dbc7b
+, 0x4af7f013200fb37c, 0x1f6aa5d2ac30fbe6, 0x016e63b78f95a0ba, 0x311b31b4a54d6c74, 0xa79073737afb5030, 0x20c94f9168c893c3, 0x76aeb82d88dd3893, 0x1c13bcc2766f5153, 0xbbfb8623139c720d, 0x1b666cec8f6f587a, 0x934d10ec4dce82ff, 0x64f11af9c3f8ba7d
+, 0x143c3b5d2e17ad7c, 0x266752feb2ceeac6, 0xde5a1cdce9ee8b8b, 0x2d4a01027ae63c0c, 0x808dd1bcaac9f2d8, 0x170ff9855f391f9e, 0x7f69e2ea00683ec5, 0x291c3c2961bb3608, 0xd03f5b549f9d0242, 0x4583f8dbc59a2386, 0x1deac1bcb740c2b0, 0x3ddf0c56d10ffb94
+, 0x5c6c9b0bf73521ed, 0x0b2c5b0d0dc740ad, 0x942f21bb7a259f0c, 0x032b9dd5d19bf4e3, 0xb63bd0bdd8bc9e57, 0x01ed2e744cc3355d, 0x41822d213bbb7097, 0x5ca8e9907b8c0f5b, 0xf6f980944cc7be82, 0x0f8f775489c48ba5, 0x6d268eaee4f5d4e0, 0x442578ed57dd9c4a
+, 0x2ddb105e3200e42e, 0x65b42000fb07b28e, 0x163ad98c2aa9fdce, 0x3c748013d538fe76, 0x7c8f05b17b08f77a, 0x37d9206ce0cc9525, 0xef7923715f1a67bb, 0x403c3f99862abf12, 0xef319ef06907e157, 0x17d793925e17b01e, 0x3692d65f5d1e7c30, 0x002224dc0b5c6299
+, 0x70b56d044ed24852, 0x7314812f2be48c67, 0x4a3ee31b292c8144, 0x0465e8dbe47d0d17, 0x81d54b18a5f5ae98, 0x0d9f5afeef57c82a, 0x722b19058b1b589f, 0x7afc895cbe8db168, 0x2d01645ad9543621, 0x1c7929c0b48dd7cb, 0xea470ca6adf68523, 0x409931eeddce6f1e
+, 0x5ecf732cbd868ae4, 0x5a5c550f27ee03e1, 0x9e9ae9c1d01c9405, 0x2f7c7ee5d83bdb0f, 0x9abdd34add43ddd9, 0x6401dd527393cc9b, 0x158a466deacf064d, 0x3201977ccde60321, 0xf2a788d88e9e11a8, 0x502f4b4cd259f883, 0x8f5babf156f58aef, 0x7d2cab7d2037f3de
+, 0x5948b445a9c5c8d9, 0x592d155aaf2c03af, 0x94915ae962923374, 0x28179ae87b601d02, 0x53ede1a6d1ed4502, 0x456900b179b57f35, 0x1b64c5e58ccfccec, 0x47ced45776a3c20a, 0x6a2d19526e7d3b1a, 0x119a370b39a3597f, 0x97a6dabbd202731a, 0x4abfe6ce584b7692
+, 0x11dbb4e86caa65b9, 0x4587f7096d4be6d3, 0xd99a50b93a642f7a, 0x7471b218c90e4c3c, 0xe1c22039515e419d, 0x0e428b4efae423cd, 0x9dc29ab8aeca4b11, 0x2b4b980d20d88624, 0x3d034f7cc1aa8166, 0x34f047d8db7918c4, 0x9e8c77ffd8378273, 0x06169d76def7f6eb
+, 0x65d3f27320977191, 0x73e4036713e382de, 0x3b8babf89e3b2ce1, 0x4ab56a53069b387b, 0xc623014bcddb70ee, 0x74a7a1b63c7c8dbb, 0x87fd48d1836827fa, 0x4797b2265ad75d0c, 0x97ce75bdd4b81176, 0x08f6fe136dd19d90, 0xd5f42acfa4f757f6, 0x1fc5487a82bd3226
+, 0xa18d1b562f9c7e25, 0x76d422d14063ee85, 0xe609dcdd6f4d6f27, 0x146f40fb5741049a, 0x0b8264c6294c2f1e, 0x4ad520451de33e71, 0x437b8b960e73ce99, 0x278158a74e4fcad4, 0x472fb1ef5739e883, 0x5043c73bb36e5a91, 0x64c9e803406dcbb5, 0x25ac7aba80a09353
+, 0x18e4fcd8658d2b1b, 0x513150e2e3a3bab9, 0xd9c590e06dad6982, 0x50fee0619f86408a, 0x269a065bea9ebddf, 0x4de7a83a9b3a2e0b, 0x7277f707141670d9, 0x14349cd3f96d134b, 0x9466fc8e89ee3707, 0x753a8ea9a52ab850, 0x9a997495f0a29a88, 0x5b706ea132c09bae
+, 0x0375ce2fc521a795, 0x67285f0b000c0e06, 0x4c0d8db1cfbe3000, 0x3c928ef829d8cc5f, 0x0317478c87572524, 0x6e3a1f339a2ec390, 0x93ed4aa290d0d066, 0x0698af1252546562, 0xa3e39f86e15ab6ae, 0x0e680ed50a8af4e3, 0xe03fb32a0de6f33e, 0x0675969d81fce174
+, 0x3953868ab90b87ca, 0x08682b62e9792315, 0xc672bd3396e25b24, 0x4d08df560a401b99, 0x807b33a6d8c63d92, 0x4372971524da358b, 0x454eb7402af5614c, 0x4fa57e987327ca1c, 0x428363a909f346ce, 0x13f79447852cb020, 0x6555566157da984e, 0x29a16512696afddc
+, 0x1d5d006434101830, 0x4bba87f22dd07b8e, 0xcddede23c5c6a6ac, 0x31abdbc0d15696bb, 0x56b15e8990bf4a56, 0x1e9f7bff640c1b68, 0x10c25b2c8beecbbf, 0x7ad37bc4bf250a81, 0x75aebd64f78f053e, 0x5cbdc0419707ff1c, 0xb5179b27bcce99d0, 0x1d2cf2d6988afdae
+, 0x63045433dd6ef83d, 0x13cc7873310c1ff0, 0x8614f3b4a67b79a1, 0x1f5cfba2b124513b, 0xb0ff302fa021fe01, 0x09a3bbdd16fc10bb, 0x7b0ea7037a5112a5, 0x46849e38d2f0ecea, 0x9e5a512aa3af24d4, 0x1c9e48e29799811e, 0xf28d16fbf9de2688, 0x3e1d2c71ee128527
+, 0xd2643ac296f1514e, 0x0ada1fadf88b18ff, 0x6974fcfc29645968, 0x15cc8d5961b99e66, 0x0c08ed974d7ef89e, 0x0951d91aca73ae6e, 0xcdbaf1b1353295cf, 0x4b617b4ae1064853, 0x6cafc5c70b7dff3e, 0x75ad9aaa1e1b247d, 0x3c5cb334a8d52629, 0x07d1c9733117a8ea
+, 0xed13e19233cdf2a4, 0x49557a899234f8b7, 0xcdf904c216218ca9, 0x6c3597750a6bdb68, 0xeb4a06859b541e59, 0x743a1a6148f092c3, 0xd3ace28779300a37, 0x413390d4bb4d5ee9, 0x110565593593e2ea, 0x3d7d4708a8526474, 0xef9b70762f9e40e8, 0x738bce0fcbbba760
+, 0x365358d944171388, 0x3bdd580cff27542f, 0x0e7d33fafe822664, 0x5430556ee4af510e, 0x3bbac13b66e686d5, 0x303173494124acd7, 0xced32a1677ea0e42, 0x13b0ac6f9632aeb1, 0xf552f1024a87a02b, 0x3d806d91b66f29c0, 0xe3297a57551c7a62, 0x747449bd50384c6b
+, 0x6892cd0c09aff7e0, 0x11eb6f017197e2a3, 0x3dce45409b112ba1, 0x204d7235c39d2181, 0x0fa0de919ed321d7, 0x0edf5ac119a31e1a, 0xad3b1bfac3bf6134, 0x02b326504d7624c2, 0xfaa70298bfdf3cca, 0x5034c7474a8e6622, 0xfba88032af7d7a66, 0x77f0783f1d92b2a2
+, 0x4db973c4a6cdd2b4, 0x65bc8ec0653f40ac, 0x23278bed68c4477a, 0x587c836a1f587256, 0x6d311bf2f482d5bf, 0x38c01188f4202dc2, 0xdb54eda4619cebaf, 0x25f4815c60897a87, 0x224358acd93334d3, 0x273a4a7bc3e6d940, 0x04becc599d4cca8c, 0x4cebdc3dc2824ce4
+, 0xb44b636c0aaa33fb, 0x5cc39fcf69273b63, 0x6a332862ab6d974a, 0x4a6cb87a83496cd0, 0xa9a87180e8b69535, 0x0eb3f5b4309bfebc, 0x96c505839f298688, 0x2ce39a35277a8d3e, 0x3c1440c756646eff, 0x263841e31b2abae7, 0x0a8e0907b3f1248e, 0x0ad59cea77ada76e
+, 0x16742f273626e36a, 0x6163f5c03bd1720f, 0xddddc69782468bef, 0x572094b8cb68401b, 0xab76e9f2024ba73c, 0x76e03f847dfd9006, 0xca53b18007f856f8, 0x3953b8a927e37f30, 0x3d62de1e934dbacd, 0x2e22cf0fe71168a0, 0xc963e9b11ebb16df, 0x3dc11819b4854f34
+, 0xd7c9b5a2c2e6e349, 0x02f1af1a3aefe57c, 0xbf3f9b28e5c522f9, 0x6e46aa89aca99a0e, 0x761267e0cfe837fc, 0x76a8f303042acb31, 0xa87ef45f464d915c, 0x475e30fbd9b2df08, 0xce09cb20c556f269, 0x4644b402d628df46, 0x85a401dfe29e541e, 0x613607fff027a2ff
+, 0x2008a7b07d3e9e29, 0x318c7595e018bc3c, 0x9c33455049cc0b79, 0x256128f1a6b92de5, 0x557dadf8b1f2d70c, 0x5186869bf0019f1b, 0x349c35759e25cb98, 0x4f8b683e0e033002, 0x9c2ddb32fb27dda7, 0x750bb60082a252c8, 0xa73a085c768ae76a, 0x22d31f78b458feca
+, 0x3e2287e9ccf9e451, 0x5aa796d47f02df4a, 0x533fa50e5807ee39, 0x36eb83c2e35aea33, 0x161414b599b4b9ab, 0x6cd69c7e91dc5e53, 0x1c4c5afd6a97beaf, 0x138da135c3ec132e, 0x97800ca8a2dd5045, 0x4dd1f02a28c1cdc1, 0xf37e07010ed066de, 0x0fc4442015c666e8
+, 0x3515c95b4f8f8ad1, 0x01c231309820fe43, 0x8622e1f95f26f289, 0x4abc776923437fec, 0xd722f39517429e44, 0x1cc17fa97bec8b11, 0xa6bd05a7442413c4, 0x6e687cf200107353, 0xc2cfd66551a10b02, 0x1b558e9b37b70b1f, 0xe6adc670a596d2d3, 0x2f5ab51fbecb0611
+, 0x986d5da95ebaf15e, 0x4ca4cb92c2e0c3d4, 0x369c3b7b94f3202f, 0x4746ff66f57f1c15, 0x5b0f9834e6ecade6, 0x5bd1b631e24d9963, 0x5967806c8254497f, 0x3785a0ab35213995, 0x01a8dba560d13b79, 0x57f0ab6a5429e110, 0x0ee4e283dfd2f222, 0x31898468edd1d9e6
+, 0x4c14ad0103f07c25, 0x62d74591b2bbfcdc, 0xb318c898800ea80c, 0x73c71574679c9ab8, 0x32d141d807eb717a, 0x0246cb023c243250, 0xcc8eecb9b7177409, 0x101709931961e462, 0x4bc54ff4811274a8, 0x43865fc7516a078f, 0x7f298d6bc0869a60, 0x73fcc42e6d7cbbff
+, 0xcf93ccbc5dda303f, 0x3f34c6b6208cf385, 0x5b722afe263ace3e, 0x5ddb7b1e7d284ea1, 0xa08edf43feb1873a, 0x35e7ca25e4fb55ef, 0x0f76266c5320ac82, 0x5a38f5c5a62a61a3, 0x698f0ce5d348bb96, 0x50e3b6cda45d89e2, 0x25913fd9e77c5f33, 0x509e7221d6af92f1
+, 0xd35d3612274c43d1, 0x6579ffa3b409b4e4, 0x9ff3fd080942ed42, 0x32d1821ed67e0e39, 0x2e73a8b073a9e072, 0x6d6359865265a26e, 0xdd263494c6fa3ce0, 0x6b139486ec9bf9bf, 0xd66f099a7c940d46, 0x11860dff45a2e937, 0xf9b9e9a212da5c2f, 0x3ed643031ba9ea23
+, 0x5ebe31469e0e3fa3, 0x53033754334cc4d3, 0x2d13f5a1887cd92f, 0x67bae50f540bae98, 0x7de6ad31e13f1c25, 0x2ae9b283f0d8b3ec, 0xbe614a952d36caa0, 0x56018752896589c2, 0x5f5e5e006deca108, 0x06c017b596104e37, 0x53a430e6b49f7b40, 0x4bc62dff4d41324e
+, 0x7528d81d0f616ce5, 0x47dd1dd523f111c1, 0xf8d7fe54b81d075d, 0x03c288e9db03f2ed, 0x9aef07e8e277a29f, 0x4eca6f7bb30d116f, 0xff607e3224020112, 0x69f014a615fcde78, 0x5f72d52237d136c3, 0x0d759c4b78635817, 0xd545d46cbc1396d3, 0x071b7b4b8bef4a5b
+, 0x5cb7f480f39b5d79, 0x5f0110bb6c1815d6, 0x820c2a4786a39882, 0x0a90962fb8073021, 0xa8bdd3cd4ed37244, 0x5d6e5ffdffb46066, 0xe3b4a6a40875948a, 0x3865af0bed10fcfc, 0xe2f80fa308556c6a, 0x099cad817dbe9c8c, 0x28cf01561ad50838, 0x21f4bd3de41e5063
+, 0xaef890b440a6ae6b, 0x6f6668469ee4083c, 0x7f2dcd560dcd1864, 0x10daf42cea663b16, 0x34c68fd70613394b, 0x21fa5c88f31d532d, 0xba8ca988f92d2c4a, 0x6171780a0b0f2c00, 0x1fefe8de195b0136, 0x40a02c3358215765, 0x75728d52f3b18416, 0x62f29d2b587ad0f6
+, 0x0297f82e92e2f5c2, 0x65c0a6ef52d02396, 0xf6aac5019080efc2, 0x59a07dfbe9c03e57, 0xa92c7a5694c560c5, 0x1b874f2a021a175f, 0x4e9d9c22c6095b6c, 0x1f1174b921cd852a, 0x273d436c8d371d33, 0x3772b284824e17ad, 0x4f04a4c6036e899d, 0x65a88b190caf631d
+, 0xb540d07036efef46, 0x58da2e652bf6c85f, 0xe65453c784a9f848, 0x2e6d8102b95966eb, 0xdbe86bbf708bcc13, 0x4be06e35bb99bd12, 0xe6a280ac18e5e0e4, 0x32a1e5a286000445, 0xff5a8b894274a9f8, 0x18c0f7eced7cad17, 0x00002b3a57d2778d, 0x219790fff85a00a6
+, 0x4baeef888c23c513, 0x54d4e2e235c7458e, 0xc489566d8b95d0ab, 0x60934442b7a4e3cc, 0x71cdd3616c601c50, 0x33f476fb9f9c589b, 0x7304b879d65e3e97, 0x698f6863786d8a71, 0x3909e2231dfdecf7, 0x024db748d4afceae, 0xb4826978d3be966e, 0x51b800433a84603b
+, 0x9a4f0d744f95aac6, 0x6f050d913c1f5a2e, 0x9104ab157f8af7d9, 0x545be2ca3cf6d197, 0x95f950a093596190, 0x49483f67b89b1fc1, 0x59ba27e3f15965f7, 0x2325c65cd4d73655, 0x95f81d437387bd9a, 0x3d440a2cb977b0c4, 0x22976c35fbfe37b8, 0x43347ae7ad29c7ac
+, 0x20bdf629dfce7b5d, 0x629c75da2dca7653, 0x14a5aa99872d6fc1, 0x1964aae96c432c9e, 0x885fa972be13a8ac, 0x61f860297b77d9a4, 0x56714cfc7abe8a5f, 0x36465d0148303bfa, 0x87e9db6cf3f9fdfd, 0x10edaeb447a75f13, 0xc2b718ac6ec9f54b, 0x791e0e8e878b11fc
+, 0x4820a5b81d477403, 0x2431446879d017c7, 0x4dbc6c9e0cf25061, 0x07b797b02093852c, 0x2c26449b899db3c1, 0x50fc2eba2e9a11c6, 0x24607866313b095b, 0x51d755746116c513, 0xdd3ecf31aa2647f3, 0x61d5d288ec3ed781, 0xc914e3e99e25caed, 0x0ffa953ea5a3d9d1
+, 0x034a3666f1e9965f, 0x51ab3a2444ccee00, 0xd45dd7935b851535, 0x30f81396a1a02e78, 0x74f30dc75d292e93, 0x3297a44f57fa1fc6, 0xebfc296715f4ea2a, 0x324ae3ffdc591e05, 0xcfa1f464e74cd767, 0x1082fa19024bfaff, 0xfbfe9e0ffedb021c, 0x2460862df4bf5122
+, 0x7d7b7df23ff14f30, 0x433fd1c0302e73fb, 0xa7819ac9d0c2aca3, 0x03e76bc018f868e5, 0xc413bcda24a07335, 0x0174e024ac7bc46f, 0x69134ac77d74f3d9, 0x737c920dd0c4f8e8, 0xcd5768e2b7b4e7a3, 0x0c5957ff20d84a4a, 0xd7d786a5b871e800, 0x5206da602f402b32
+, 0x4644186325d2487a, 0x74ac4cde8fa8b382, 0x30108c9036607fd6, 0x63970ee71f4a13d9, 0xa60aad2a91a93747, 0x43e669b51e68e5e5, 0x714ce270d069a8bf, 0x52565d5ff52eb8da, 0xe53ddd1de56870ea, 0x7b3d57b0d022d9b1, 0xd995204ce601f67e, 0x69533f2341109012
+, 0x196769f65ea610af, 0x48a6427ca3c03b29, 0xdcab946484d3772c, 0x78d12edd3d82145f, 0xf818dd7a0798143d, 0x135563c7e75a6602, 0x959ed759cbc89456, 0x486c0eac4a4f7c96, 0x76cd5ca912529fd9, 0x1a2bc714c5ef66f7, 0xaebe32c560924ddc, 0x141b4bcc385cef6d
+, 0xbfd7a749dbf518ba, 0x730b3c2d98a640ba, 0x739832d8b6141929, 0x6405128dee5ba8fa, 0x80c211d200159966, 0x3e4d207930a73641, 0xeb05ecf36c489904, 0x68bb3175d0a28729, 0x898b547b9b42569a, 0x61c01c4b6c0c0414, 0x8a5703c0fe37c44c, 0x39e65c03e6a007ad
+, 0xaed1dca01da971a5, 0x359e9ff34cda6e48, 0xcc4c9f2cceb94ac5, 0x1a9647086e9ec506, 0x5717e225e58b172a, 0x4bb61e320026a189, 0x7a048b2a17685165, 0x41b8e105cd34c44d, 0x3612cf85f37ac19b, 0x0540db86b478709e, 0xf73106639de36387, 0x72af6e857dc72020
+, 0x58040f1e67e40bbe, 0x79a4537127b2c59d, 0x7610fdae2ac92827, 0x622e3b9a0ca265c5, 0xe7edbae849154498, 0x0bd131d0abfdbd03, 0xfc9ea9e3922b194b, 0x695535d426902667, 0x49ea1999034d8e0d, 0x043efdd84686bd30, 0x44b310c27d15a0da, 0x76e1bcb717c52031
+, 0x5ce30eb75a1dff9f, 0x0d67d26a6b6f03d6, 0xe28da77e774dd2fe, 0x315b4bf5b103794f, 0xcfd35f25f6f6c1e5, 0x73be563e1b28f6a0, 0x77e7f302f3832cba, 0x628f2c6ddf6c9185, 0x1f05e8bdd9396c22, 0x32c8cea164e74dec, 0x098ea52a1f4b6ca6, 0x4e509b71ae98847f
+, 0xb818abdb87c13bac, 0x5ff5167139051570, 0x718d1cb4b273daa6, 0x796dc146cb7f5b48, 0x69f9cffaceb8f131, 0x24857cb199a2ee12, 0x02e0e2fc79a3d715, 0x4c3cd161640be0fc, 0x71ab2da775eb61d8, 0x1b237e475776279d, 0x72ba32428a149b0c, 0x048da56b6d2f521e
+, 0xc2f170327b2510fe, 0x41e82c383ee57893, 0x5b3344c93249cf3b, 0x3835f98a592144af, 0x6c51764db6e157fd, 0x59ec8f36cf87c248, 0x4189f67909e8e22e, 0x495c367d961dd613, 0x512018d56d007fb8, 0x2e28280e939ed54b, 0xc3849b3927ca0e78, 0x48196daf05080c4f
+, 0x0f25a861bb34706b, 0x0c1f5ab2e5a1b870, 0x306aa5e8bb6182a8, 0x37120f9480235e47, 0xbac8e19403f5c699, 0x6f0f129880f658aa, 0xcf9af8a55596dd1c, 0x2cfe134a26c082a9, 0xf6c2a5229c22f89b, 0x1d76b63eb0835a80, 0x576675c8879c6e76, 0x7cc234152d2ce0fc
+, 0xaaa6cbe60e2c7f7f, 0x58e13d7cdd891071, 0xe309add66490550c, 0x66520ec6de0f5e88, 0x33be42f17dbb9c0e, 0x006f464dc2b85534, 0xcc96ac4694320b33, 0x0f0ebe8ede2c72e4, 0xce7db05485b41343, 0x6e5c08a4d1e6ffc7, 0xd60c760b5f9ce5e8, 0x50c6ad31b66baeeb
+, 0xc17ae224aab13591, 0x2a2c3ecca3720345, 0xa6aa1063ea6a55c0, 0x790f22aeb4093b89, 0x74ccd0b635a66266, 0x06d447e1136adc96, 0x1a2e5cc933110aa0, 0x65bc6bcfbaf8d767, 0x95416a535dddf129, 0x4b8009b78e192c34, 0xbc6dcbefdd4ef19c, 0x63b80089571a1492
+, 0xd906c296771239ab, 0x080e707246e3a153, 0xb2f37b2965381a9c, 0x60cfde3cb23f147b, 0xc569ab5e30e3e197, 0x54e8e4212987b491, 0x79c9b3bf87483e5d, 0x511e17a69f2c91fd, 0xe24cb44f8351e409, 0x748c4a58ba21cda2, 0x7bff779d28ff2505, 0x20106491f5fd5d7b
+, 0x96724ba0052c1bc3, 0x1ded017f81a2c53d, 0x2afd5f1a72174c7f, 0x6569b0faabb08b07, 0xfeddad038b81c2b7, 0x2920e4317f3ff6c7, 0xdcd550cb14a7f2b2, 0x27d71098c8ddcc45, 0xed460cde1b049fd3, 0x323313bc54de22f4, 0x21bcea0f11fc01f9, 0x07ee7e59bbedbfd9
+, 0xf603d50d32f2c8bd, 0x11d99664b36c3381, 0x4972d9e416afb57e, 0x43b785ace83b4785, 0x8b19a722aff55ef0, 0x45828d9df38ad027, 0x7b39ad9880eb58e3, 0x43c9a5c6330167b9, 0x67ef35cb7b0be6d9, 0x306736f4371ea665, 0xa4c1967a97c4b9c2, 0x30c8df036213f30e
+, 0x40cda3c98228de97, 0x38a47e4556856796, 0x935a97cc96e524cf, 0x7ed6cd57b88479ed, 0x92851de7017dd41b, 0x2018ac042a1f7c06, 0x79e428ecaa53ac64, 0x47331737ed682a2f, 0x813eb77ecddb642c, 0x14f9b12f93a2be27, 0x59bce9dced1abf20, 0x4fc333c34023e742
+, 0x15e3bf457d5bd14c, 0x0b658056c0f49fa3, 0xade0f3614e16a9b1, 0x6d6cfc927a4409bc, 0x28e3a6cfba29a84d, 0x04d322b434cad0a1, 0xb034cd8336db976b, 0x2f7cf5a0bec2cba9, 0x292acb62316b9591, 0x404ffd47a3e9754e, 0x60ec1f9a4b20ae61, 0x047a1394011cba31
+, 0x193071ea442bd6c1, 0x7ee704767072fa10, 0x569212913c17b92e, 0x63d23193dacdff03, 0xab1b7288f0657034, 0x0f968d1ffb6e86ea, 0x993ea8b4ddf8e217, 0x3099bb4a2e82af97, 0x7a8327b26effc9b9, 0x31b4e954c9cf4a20, 0x9ee84691882f2f53, 0x782df6c63bd2bebb
+, 0xe25893e9716d5a27, 0x2ee6ae48ba142d75, 0x510bb542b84ec7cd, 0x761e61333a4547a5, 0x20dc7c7a9f2ad527, 0x36784f95673fa05d, 0x937c8774b775145a, 0x52d9ee78cf679313, 0xbfa62b76318e6a8d, 0x0443e18fa75827ca, 0x934e2fa968e68cd5, 0x0d3aca7784c4dd71
+, 0xd5f48b158b98e1af, 0x31b99ad84493504c, 0x89ef1d0bf869afa1, 0x46cf59b5a6ea93a7, 0x3c3f51b9d41f74b8, 0x768d2fb7b4b92c2b, 0xb7e2414a19ef0c0b, 0x5235f478d35d4ebb, 0xa60368ff83f5f66e, 0x11eaa1b521b808cf, 0xae7685415ed05189, 0x7741af3f3f9ac43a
+, 0x22a1b75fec41d1b2, 0x077b217967228fc4, 0xbe917a459e9a0061, 0x2fe504f02487e8ff, 0xb6fe25256aacf446, 0x32b0d79838c51824, 0x78d0b2f650757da8, 0x623f452374776005, 0x2030ee711659d992, 0x545809ea5db641c8, 0x5a4b97473f71bf7b, 0x1fbd3bfcc95de812
+, 0x977306e03e7e6819, 0x41b89862c71395a4, 0x124c5d69b33227be, 0x7d6a4e810e1b5647, 0x964b7a01ba7e7839, 0x10e83e75592d2182, 0x2564654916904813, 0x4a649f83dfeab4c7, 0x7526393d7c5f8737, 0x0ed34a37896b39fb, 0x6f937fe730d24012, 0x0032cb45ad939ba3
+, 0x90bd9ae609ec995d, 0x1bf1d4bb39215b22, 0xed7913be6bd56e7b, 0x27ffb4616f730c1e, 0x5b905a6ee4cdc849, 0x1b8058b93821d05b, 0xc8a1d978a58f3a72, 0x01c06b60e576fc9c, 0x768dc7abeadb3b55, 0x618b31e8a1e48fc5, 0x22965cd0126584f7, 0x1c5891e91636eef6
+, 0xf5e7c2a6911e07ec, 0x465c447dc9b56e1a, 0x0885fbfb5ce174bd, 0x7f345b14b669ae20, 0x88bfb4cfee89dbfd, 0x192d3c403ec3b90e, 0xa7e900f873cb5743, 0x714a6351c4bf465d, 0x9c65fb136400b7db, 0x13bc645f24758e51, 0xc54ca5ee4753fbe3, 0x4bb3075acd1fbc65
+, 0x038192a61f28bf65, 0x482591aa5ac8447f, 0xe521f4c103ce342e, 0x6384d6f36e351697, 0xd3ed597b17db9fe7, 0x17d1d5eab80f6407, 0x449b222ccc726024, 0x5dc402e105bffcd5, 0x74844f25e39e8b8b, 0x51e274559ab30f92, 0x807ca7e98925d5cf, 0x6b9a977335ce6f82
+, 0x19fa151fca8bad93, 0x4ee71574289baf76, 0x8f901bb992d3e8cc, 0x7ff85ffdb1e5ea49, 0xe6f600044d212701, 0x6f6276bf4d50f094, 0xf82e29a354e0fdb4, 0x712d4ef2a4e53821, 0x028164d750f90a2f, 0x39e36b8cf6a02f2d, 0x8575b4bd8d9bfe2e, 0x09f3429d95ba9ddd
+, 0xf246414e78930d43, 0x7205af31e39291ed, 0xf6b542df37c5f188, 0x305d0c9960cb7e25, 0xb519beb018badc5c, 0x6ae3b06735703f9e, 0x53d5fe1d5e8e91cf, 0x1738e0468868b771, 0xbc209701da874d24, 0x0f3dd70a1560cf9e, 0x90f82c30072d1459, 0x29e292756e0d52ca
+, 0x0b9f8e63eed79871, 0x7f38eaefd39b2bf8, 0x2ddd0d44e61f4854, 0x10fab967ac386b83, 0x68b56e52f73f6b89, 0x0c18cb5a4ce5e1b6, 0xf4df58eb2ed6638d, 0x539409f9579ea291, 0xff6d9a08138337e4, 0x0321027675beaff1, 0x83baa1d8601b82c3, 0x0cac50b183e71dcf
+, 0x994f4bbe7fac433b, 0x2e143bdeb8ceab2c, 0x405cbae5aa9e3c68, 0x76a910ac392bed93, 0xdbd21596d919d525, 0x46ba2a287d8b7431, 0x288cda5e38dd1fe4, 0x53db8e14c57e5833, 0xbadca6cfdf03bf8a, 0x75cf5233509c0755, 0xa64bdf10ad743079, 0x6cbea05772368369
+, 0xbbab25e747831520, 0x3f7bb818189d5cce, 0x648e834c5c785e4d, 0x68a7eba1925b1530, 0x693d07c3ebe8dcb1, 0x1112a1714a769d8e, 0xa728f137ee86057c, 0x06d8c16f71c2d413, 0x2f5d09c202a8fca1, 0x716c94aa18603082, 0xeda4814014263232, 0x745890afcc5a0b60
+, 0x13a32883ab6cfd2b, 0x412e0499292ab9a6, 0x94c350c4c67fc637, 0x123ea45589a4b468, 0x37174e2845826457, 0x3ec04fc7d347b3de, 0x5cda00090c0a4a09, 0x6a7f742526aeb898, 0x83beae641138b815, 0x444c9c927521859e, 0xdb8f710ca0feb222, 0x438ab3e30600bcd4
+, 0x83e03df9b38c740e, 0x31abe78b1d98090b, 0xfeb19325d0570755, 0x3a2072c47791d49f, 0x93eae92bcc275865, 0x2044fbf63ecc7901, 0x8d5123c3e9ba0c2c, 0x5cd6449fb911696e, 0xd4933ef4f7e3bbbb, 0x0eac6b4bcaa2d980, 0x222bcf369bb476df, 0x5bb8175a618dcccd
+, 0xae3f24e1df62f748, 0x22898e2276caead5, 0x3e28449032e8fc2f, 0x4dfcdfc88021cb24, 0xe80b97f64f7e80a1, 0x55f5a50eaf7131f8, 0x4a08a14ebd495aca, 0x47f42a17a112a681, 0xe1fbbd3ccb26ea41, 0x0ef03a3cbbda5293, 0x72b4cd8a7f370d8b, 0x045f86dd4ad6d85c
+, 0xdfc7583791bc98d8, 0x3560c3ad2e7da8b7, 0xeb190f0336250237, 0x3ff5132193f2ef5d, 0x0ed6af6c0556f5e2, 0x0c05dab0517ba260, 0x60c3951e831c0032, 0x07b7d07fb4dd3605, 0x4dc8f8440ad4e3a5, 0x5f4a91ac8cd72538, 0x73c1e78cbb8871c7, 0x3b0047ca4a46e3c3
+, 0x47dd37ce2cbec45a, 0x22702f6364ef887a, 0x5e0cc3e06a8a73ce, 0x13e2fdb9ab81d462, 0xf107ae439d94d726, 0x24cf75f867395394, 0x6a361f0756ab9ef5, 0x34e1d22ff5437f6e, 0x58ebb8ee19ceaf8d, 0x7e5aa1e463e2316b, 0xf6d34d40299aa91f, 0x389353b72edd83d2
+, 0xe4470b7cc167b12b, 0x6f9c5bad6ddc92b1, 0xa4420a15a21ea295, 0x61c21d2b95fc5682, 0x1b2d274f1f82ee61, 0x4739404e0b777cda, 0x148597599c954ba1, 0x6d043e9e46469cad, 0xc7b11b6ecf222263, 0x70a531a6d54aa40c, 0x59ca203f750a2a57, 0x02609c7a16762f92
+, 0x21b049a55be94966, 0x5a13498c25b1d9dd, 0x0b29334605c59e9d, 0x1243683349f74904, 0xbbdff50c091da0e3, 0x437b1b9c8c237498, 0xd36d09281d2277e7, 0x66c98e88009ed564, 0x8b7d6e1baed202b2, 0x0932b4c9eaa7804a, 0xf53020088e0c7e18, 0x05642df84fa9d882
+, 0x4b275edadd9a9654, 0x7fbf62c5e85b771b, 0x9370eb743d046dd3, 0x70909afd194c394b, 0x7bd395478f102b40, 0x63ded2618f0319df, 0xcdf3bf838f879d34, 0x7d5921efd10d92ff, 0xd4d4c442e9c713b4, 0x3922ebb328806833, 0xcf09fe672cbc3aa3, 0x5e0d2e40c3267203
+, 0x5cc98a6138393f88, 0x468192df35d24c68, 0x642f37d6dcb9957f, 0x247b20a0627f9ee7, 0x017aa79a455e3563, 0x237331227f5e3a28, 0x93251cc85d604709, 0x2ee70e49d03cc2b0, 0x1c0be528ebd00344, 0x2a8e13f9744395b9, 0x59fe70a6bba22091, 0x67c8625333de7e6f
+, 0xf236125d6ff4949f, 0x7e88aee169dc6a28, 0x5cee9d1e7a29c316, 0x3df2ca6ecc27653e, 0xe61c427a48b4abbb, 0x0d7a853307f2037f, 0x7a704ac31ebc8e70, 0x6760f64bf3521dae, 0x9889d2a5309ff3e5, 0x78c0176ef2bce9ce, 0x7ace34d42c5aaefa, 0x51853bddff646b57
+, 0x0ceb9df0685d57c9, 0x5ef0475a7e922d87, 0x740a9ad1b818d822, 0x46d1861d78b800bb, 0x118b84721f16bff6, 0x16e46cba143cdc27, 0x430c397a90fd4daa, 0x4295087f53c5347b, 0x0f3c77c1b9f0dcac, 0x4123053816118182, 0x833b0789d89a5e51, 0x7cf84c843a9281e0
+, 0x4a6079e419ca94e4, 0x19bd046816341085, 0xf5845d2f97315ebd, 0x22b4501cebf73c9a, 0xd9d507581d2632a4, 0x6a9aa7c8cc6ab7bb, 0xe16b8dc23b5f9350, 0x7222c0780b2a0de3, 0x8d635ae914c48aeb, 0x30800ef0c4524505, 0x4f4dcdf83880696f, 0x600f2d7f0e5234c6
+, 0x3bb080876def326b, 0x28632c6d0b257047, 0x397adc1c8eae2a4a, 0x552fe7498077c692, 0x6d518edb7bdb4e27, 0x47878d39fbb900ca, 0x7f22b6c857fc4b3b, 0x5155d6f3e97dd86c, 0xb09a182c571e5195, 0x411286c9adb2af3c, 0x5136e55614da2453, 0x4676479e3aa74003
+, 0x6c9739eb00986cbd, 0x41159ea8f4624ddb, 0xbb772b6c0d2b8bb8, 0x68caa874e3af700d, 0xfd0a56f0f6696f81, 0x01fbbbff0416efa7, 0x57093eb1f055705e, 0x787adfe1763ec954, 0x5a2c4b81c661b08d, 0x794652628e2c6c66, 0x5af222145313b25c, 0x4e84398f816510a3
+, 0xdcbfbaeae7909360, 0x1fb80988c2e3e9d9, 0x86acdd669e93fdfc, 0x502ce68dac92d584, 0x9cbd83ffee063e76, 0x7e461cc2cd968e29, 0xffe22e844277b192, 0x0382fa6f18a459bd, 0x523d51797d4fac39, 0x3638a732b8b3d03f, 0x346652054b9845f8, 0x0ca325c8516ee468
+, 0x9c10f058ae1a94ae, 0x08874d1fdec8319a, 0x39e9048cd1e9b126, 0x1cc9d2721e725775, 0xbdc8e7de50df8a13, 0x646931cff37bd903, 0xe47ca1e60f3e7554, 0x5fedd14ee0340775, 0x7d9ebd67c56f7c45, 0x5d9a9632122ca0ef, 0x9a65fd2bfeb9a457, 0x2d24cdadf5231e1d
+, 0x68c532c4b9d33531, 0x4768e7888b32addd, 0xb85dc312cc352d5b, 0x318ed1413aefd6f0, 0x5b8d2e2f4a14ca13, 0x22be211caa6c1404, 0xeb25e1e7876ad03a, 0x00eaa2dc18a3b309, 0x5afc222ba3664bce, 0x42765d8a61e43c32, 0xc87d0bab89b88b9d, 0x0f00437a2535613b
+, 0x2e925a33544cfb0b, 0x540c90cf6e81b501, 0x31419967474e6054, 0x59b8f85431bbe50b, 0x54953f45c56b010c, 0x78c1a19e2eb297c8, 0xa8b90e4bba82d657, 0x32cfbca6a95e3140, 0xfc27ee5d1e582276, 0x5358a222b12296e5, 0xf8b892fd495c226b, 0x1e51c738be510755
+, 0x96c3be8bd882929b, 0x613fa2bee3eecbe0, 0x968fea0a0723fe1a, 0x5db9334d6d4bf663, 0xb13a13fea25886ac, 0x13e25696dcf46839, 0x03db1ae38d27a070, 0x0730037b94dc7e97, 0xee5616a884d2146f, 0x6c0e3b4e2bf65d80, 0x65d3a8497375e8f8, 0x125d878d0a2e381c
+, 0x449eb74b967ceb19, 0x56a2ce7e8bd6f55d, 0x442250f5fa698ac7, 0x4b40b718ae378cde, 0xfd4a76fff84d7306, 0x05b0da5a0f209ed2, 0xf094090d3a0bad24, 0x3ad70036fdbffbc7, 0x70cf62259cbc0971, 0x602222dd9412d0ba, 0x4d6c3dde53b3c7f8, 0x45adea9f162819dd
+, 0xf79c79101f8e452e, 0x2f01e10cff9c07e5, 0x2c741b05513437ec, 0x23cafe49f1aa7f9e, 0x1a08224108afa7e0, 0x27c0f2d4452e0120, 0x9fd3e9e925e4ae13, 0x6b0d72a8e32bb847, 0x936250256bb2f912, 0x7bbe3cbca7430d25, 0x278e92cf9ca0792a, 0x29440dc264406b40
+, 0xe1d71d824db9dd73, 0x2d2ed6a6701f059f, 0x13b79bee75101aae, 0x3930eab87990aa32, 0x03a1ba6cd687477d, 0x2f43fb555cb9882c, 0x41ee91df319891ba, 0x4e853100ad711f71, 0x339e8b1d7378b70e, 0x3045d686ebce55b6, 0x1d5b7d1b781bb612, 0x15e525bac061011e
+, 0xbd95fb2331a19145, 0x52da39348786ba3d, 0xd9c3593b2b87f12b, 0x5990bc014a09c256, 0xe4234cd17468b97e, 0x78c9b1554b381fca, 0x9f1fa3f16b0986cf, 0x6e8c98c86ef295d6, 0x2a508588207bf8f5, 0x2c05048ba9d1b14f, 0x49d8b0605c1259a1, 0x32b0d3a2c365fa72
+, 0xafb537ff297edef4, 0x543fda9f3608d563, 0xe293cf4a0e488bc4, 0x5962c80854133c58, 0x7d4c4fce5b817b77, 0x5f99a4908946d85b, 0xf946e803f3034be2, 0x76f7af5b20834bbb, 0x6dc6ff3c824b5b24, 0x42109213c29fbf1f, 0x71edc58d73bb77bb, 0x72f8aca084241939
+, 0x37debe6772c17416, 0x705a6f4330fd6899, 0xfa3cc31dbb978ef1, 0x45a244d6e175fed7, 0x2fb529c0a933eff8, 0x663fec1d2d674159, 0xc8ef66a2921e64ca, 0x414baeaa6831b854, 0x81db376520411d14, 0x350836f753219984, 0xb598b12ef0f83cfa, 0x497af578c8fabfd1
+, 0xfe1d9980c203e9fe, 0x4896df64bc3098a3, 0xcca4af6421007007, 0x601a36da5c976099, 0x7364a2c2c355be2d, 0x05a79ff5e5216dc3, 0xde54a3907c6286e4, 0x11dab11be717d814, 0x7874f663e91287df, 0x7f36c95ab543ed95, 0xa6a46dc657d14361, 0x3a5d6f1796f47c3d
+, 0x60675e3c3454510a, 0x6c11578dc1ec8c1a, 0x445007c0492802fc, 0x55d67a1c83ce59d5, 0x72be793f1ee86018, 0x52766a6c5c79e649, 0xe466b7fe0697af6b, 0x77ff17604c005b5d, 0x5469dbbb142c96bf, 0x52c6f53ee400bb5f, 0x76ed7c97f934262a, 0x5995021652a158dd
+, 0xcc908c3eed2826ea, 0x7e30cb443e864434, 0x0a017f46927c8e48, 0x4f22a1384e782827, 0xf29eeb9678c54956, 0x3235098f002afe72, 0xc0222f375d7826d3, 0x579500da1f423e02, 0x134bafa8ef088643, 0x636c059bad48630a, 0x81eee396cd98d459, 0x5e544adfd633874b
+, 0x27ef7a77f770a353, 0x6de93ee88ed34c2e, 0x197c8a8a53ca985c, 0x04aa819a9ca25a3c, 0xfe1dda34d3bcc51f, 0x7ac733348c52e92b, 0x487dd9761b60540c, 0x02d6a89c36385fa6, 0xaaccb8d034a22799, 0x594e0760ed0ca5fa, 0x536795c7e0bd9fb2, 0x04e653d010324747
+, 0x0adeb181d8d21977, 0x02dab6c707d288c4, 0x9e48f725b1795d78, 0x7a0d17135bae04b9, 0xd989cbdd1c3074b0, 0x091c7935a8155325, 0x328ed903cf694337, 0x2cdd2a256c2e7296, 0x9cc90d4d81e1f190, 0x5c7e09de16699591, 0x2c9765d07ee3be1c, 0x58caca55685e66a9
+, 0x2891e0424d690071, 0x6abb3f3102a312f0, 0x416df5648bcc0703, 0x7a181873ca201ef7, 0x79d0f931aa9c6cfb, 0x3adc2d215873987d, 0x04fa9d31c3b93d6d, 0x1e856e77de540e1e, 0xc36086e8c0d46aa4, 0x345e555c611a343d, 0x22c13a1412fa7e5a, 0x536d8b1ecacba07c
+, 0x45d8241e7877efd5, 0x70ac9ebd53a764ee, 0x6c6d76b1639c92f2, 0x22eb8d2e8569e269, 0x9e0722e06da9446f, 0x6fb8eecaf4144605, 0xcea2ff6f93b19888, 0x3f47870bc2a66855, 0x028d0d6aa835a446, 0x7bee4f1db7b9c299, 0x2f71d5edf0f2678b, 0x6ff78d436442448e
+, 0x455b0eb57fe93ea3, 0x182528c03684ebda, 0x5b32749e32ebd6a9, 0x1613851cee8faa13, 0x5ec3d92fc6751512, 0x61ca61efef212f5b, 0x61c6efc60b5d3f35, 0x44621793ccdbd345, 0x8c5889e354994167, 0x631ecd8ae2eb5759, 0x999ee7478b877e93, 0x5e52a744b2d29663
+, 0x30892ff0ec2bc91e, 0x42c078a27bdbdf52, 0x042755930d8f8442, 0x47818a56e09a1de3, 0xa014b23f17f8ac8e, 0x15b322114056b0a3, 0xa3560c1788e9eb41, 0x4ec1ed0431c084b7, 0xcf36e05426218641, 0x666d2eb4bae2d777, 0xe41b5c50b868e55d, 0x275654021ab7efcb
+, 0xa4b69052630b53de, 0x1e0235ab4d4188cc, 0xeda871411c60ffbe, 0x5f5325d804821612, 0x22454111c094a4c2, 0x0a25fd975a7e0f07, 0xe495e9066a63f0c9, 0x02b53daf91551f1b, 0x424f8274d10444e6, 0x44d00a8249fe6891, 0x1f106c6464fd230c, 0x244d92ab62c9b4fa
+, 0x1d8f1ab69f92eb2e, 0x14217a83e41a46b5, 0xfdfd0c4b3fb0cc46, 0x6a7971bc631e6fd4, 0xcd6f7afa77a0a9f4, 0x469b4057c0746dd6, 0x5e7e2e19bbaa8982, 0x18ca679d0de3d565, 0x0b747816930ed7bc, 0x0d32cde0fc83bb12, 0x47555a356561f670, 0x58a3cf8767874222
+, 0xe179486bdac420a5, 0x632ea4209184e05a, 0x6ff8696d2461c0d2, 0x1a40cefe59a12dea, 0x263727ff079e5385, 0x51105e805881b42a, 0x4c326e4d564d41a0, 0x2768a008619b3845, 0x0c4d68ce9c2f0ea2, 0x46a5eab376543ee2, 0x4d06e9ba4b22e929, 0x1c315423333b05da
+, 0x0f9d36697b332e8c, 0x46aa833f76fa9376, 0x277d8608a50b345a, 0x39df8cf1e55d0f7b, 0xdc19e8f55842ea87, 0x4702d6d2ee482aad, 0xee4d38f30260ffc3, 0x6d9570a6fbb71dd3, 0x936e75c7884b4d5a, 0x234161bc6c6e52bf, 0xaec7270b85da2c76, 0x1c1d719e0fd6a963
+, 0xba0e75557bf83b33, 0x40c2879cb47e3cc1, 0xcc28b792c3b72b5a, 0x59e45a3d2b064ca4, 0x70626935d1a1ad02, 0x437b007090653bc4, 0x2d69ba3131d0dc1f, 0x4e9f317623194669, 0x1ba4b20ca04ff002, 0x01badc334e442b0f, 0x4114c6ff2d952aa1, 0x79a17a6a6aedf71d
+, 0x165300df711a9d52, 0x0739a750815d94d2, 0x348f7b3df280ae14, 0x0cfaa6bddb6f5438, 0x9feb07ae25b63ee8, 0x20756c4c61c1a77b, 0x292aa1702a5b56f1, 0x79978851736518b8, 0x16b3d115c46e458c, 0x6ee381048da0b991, 0xbb1edad0a7c78755, 0x051052cc64bd0986
+, 0xf67c5fd721867e93, 0x365e0ea91c72cf7b, 0x1ba9dee372ce2310, 0x7836a89e6afe2a2b, 0x73cea19fa6755287, 0x1a6b2dd53d29f26b, 0x3646cd37e290f0e7, 0x575658fa9464d326, 0xfd7336cb2ff0a10c, 0x72ea59d137f23259, 0xd7e336fb6e79b68b, 0x0e13db088f96a5e3
+, 0x866d9db390d41da4, 0x175afb437a01c209, 0x4ca274dcfb1e1299, 0x16f0053a34fe98ef, 0xaa3e5c01843aca82, 0x3cf0b471766e5580, 0x204a645c4d22c514, 0x0d7e3a4fd0e01223, 0x5f2b9edf32646dbf, 0x1b9de750ea497c34, 0xf9efd460a63f8e42, 0x2458c346bb4b2b49
+, 0xe6ab2e4b57be75fc, 0x6d3feda13598126d, 0x0fb40be50bd48080, 0x2c2af8cabf69648f, 0xbf0a3c557da5b59c, 0x303dce09683f3da9, 0x2f9ba320b1811ff0, 0x0020c66599302fe9, 0x52bc397b87d07efe, 0x7109586c466b0b4f, 0x2e55a7f8f3b4addd, 0x391ae75b26988449
+, 0x20fc56500b154c90, 0x50a09936177f3701, 0xf015754fee05127a, 0x63c01c0ef6eed830, 0x0ef5a8e5cb0a478d, 0x528e87df8ced392f, 0xdb83d2a0ff103d2d, 0x4c3e0b95c313f8ee, 0xd6c8f9d30dc2fa5e, 0x4c162f23e9fac5c3, 0xc6065b12e087949b, 0x73157ef49d025bcb
+, 0xe32bc0ed4b5ce53b, 0x757e86abba880db1, 0x397879ab09a307c3, 0x0d2a6dac16366124, 0x43992eb8d1a1f1ed, 0x0cfd0d02c71b9be8, 0x3b1c083d77694079, 0x3aceb371b47b5098, 0xde2898b5d98f3eb1, 0x768b8cea44571860, 0xb97495f70824a2c8, 0x617362e9c8ab7b5e
+, 0x2e135b48173a4aea, 0x69362224efdf692c, 0x01e0d0f1bbd10032, 0x616a02dc44400115, 0xf5e1cda866c37418, 0x5b69e98dca973f4c, 0x7d7ce713a632db87, 0x31f2c3bbc52f3c06, 0x20af672f527f9ffa, 0x4371a232a284c2c6, 0x1fe1f60db51a3f64, 0x53ae25e34fb00064
+, 0x65676c594538950f, 0x527e23898f20182f, 0xf6c5390322b80a03, 0x2d577ffb74fcf25d, 0xbffd5ac1b9b6955e, 0x34068a07a16bf37c, 0x210b588f2439d21a, 0x77eef5862226f1d6, 0x8ba459e1c005c6bc, 0x72d002736d3f25ba, 0xc738667b70417583, 0x61bbcdc48aaf58b4
+, 0x93fa7eac71fbe68f, 0x76d0ba0f3ef485ce, 0x643b44cf44ee1aff, 0x4b9032925c3688e8, 0x1c547ce5387909a2, 0x332e565cecb821f5, 0x6a93e210a347dbde, 0x51f4a40b70a878b8, 0xbac36ed47bd1a6b3, 0x0210d2cf13f8946b, 0x580afc58052feef0, 0x48293cd710475875
+, 0xe1742b581d20b14d, 0x6d5fdbf5b1a36d00, 0xcf29a60aa0c22e41, 0x6bd776a0c774b80b, 0xc09c526f7223f466, 0x7ea95611f84f05b9, 0xfe64053324ca616e, 0x01cd8d7e8130705f, 0x5e8fab332b1e09cb, 0x1bacd7198129d8d8, 0xd323c35e3a0969ff, 0x2139690babd01140
+, 0x05642bb5bb8d9b2e, 0x16e1f87efa51a2ab, 0x92c07158481743c8, 0x44680a444b65580f, 0x027bc05436810c6a, 0x6c2e0e3f885188ff, 0xaf4aa76a68da1b09, 0x0b444643e99be7c1, 0x1ec8cb90034814bb, 0x1cd4425fad6cac58, 0x8cb3229c67fa30c7, 0x7994457fe6485f7d
+, 0x15fc97587cc8b3ca, 0x455121dc8ee3c162, 0xa1a788335412463d, 0x20ff5f0c06263bcc, 0xdc94d3def416869b, 0x7c94f9d9297261ad, 0xdbd4148e36356fc3, 0x63523ff490906cdf, 0x075fb0a8521a4a28, 0x07544acb4fe80876, 0xe33f30658d45d646, 0x0d844f98f789fb30
+, 0x58b9350f220bea06, 0x2a14b848bfdb7e50, 0xe0b5c16964fd1c00, 0x7a4e02074a438e02, 0x3d15a25fc205a468, 0x5efaedba28442c96, 0xcd02f3f71629a090, 0x2e04734d0f410506, 0x8b3289bf9a90a7a1, 0x63c9f0e7f62ff3ec, 0x6bf3611df80c4799, 0x4929e592c8aa7e3e
+, 0xee2ce721be8b4247, 0x7370c10fff9fa990, 0xcaba4f6cc820ddb6, 0x5da490df5f9dce07, 0x916c711bf69c895a, 0x00081e04f199ef22, 0x5ad29276c6cd34cf, 0x180f7fe0a0e881e3, 0xb8e644df1ece5ec9, 0x2802f624681c741d, 0x54b7de27d8024937, 0x0ee4743ccde130bf
+, 0x307a2ddc83f7fc6d, 0x44210fc33c8c7b6e, 0x1637088c06010b2a, 0x12cb1cd8be167c83, 0x6694c8ba3bea80ff, 0x3bb82a16c32e99c9, 0x56ddc35dc35d392a, 0x297f7a10ef6981b3, 0x64fcafc2d54dbac4, 0x3df4b2e5967a8fd6, 0x6ae38e6682302fc1, 0x611f6748b4ee85ce
+, 0x02c0bd80ded818e0, 0x3c2f41dd487ab67e, 0x8603de21ad614cfd, 0x290872fbe5ad1e2c, 0x22f58cb9957def81, 0x777acf5d6d409ed5, 0x6138398e1568efce, 0x5c8ec8ebda3c7e79, 0xb914b0fdff162d8c, 0x05b756a50a8268ef, 0x8bd43108d6126406, 0x669cd7f418419acf
+, 0xb05ae760c197d60c, 0x540356feb75a2e28, 0x5f806959a8d801c2, 0x0c4d4136271ec4fd, 0x3cc57964f1bef114, 0x1dcbd445255075d3, 0x3a941822a8975468, 0x691410ea742d8cf5, 0xf8b8288ae0a5f31e, 0x46b492463b1f0cfc, 0x50bdcf9014bd0914, 0x759dd5cc2d4eb7c4
+, 0xd45ee8c0f6d20f11, 0x36879a33aae65665, 0xea5bae7420ae17d4, 0x729e07b1f1196af2, 0x5004bdebcca2ae7f, 0x1aa0209561cd5e72, 0x3e3be8934289d0c1, 0x0583d4ba9adfeb09, 0x2d41e1c951e9707c, 0x11adb0521a17a266, 0x0a4bcfaed9535af2, 0x156e02c445c53cdf
+, 0x5b50f130fa619fd3, 0x410a45167e6005ee, 0x67b496bf833e86b8, 0x43cf44d4ac562b98, 0x8b33e0ca1b5d95f3, 0x10ff8aea4f023d5d, 0x085fee31e9d41cae, 0x29eaa0a73e19204d, 0x4e9a32a26cd0f298, 0x067567e2503da1eb, 0x2339cae9ec5cfa2b, 0x0ac03cc46f10353f
+, 0x849b34d18383a209, 0x3af080117c5df817, 0x9d470d1a27169b41, 0x58e353662c71b30c, 0x02706d26e227c2ee, 0x02a27ce8a8831362, 0x416ad5155e2cfdd1, 0x6b8174b67f8521da, 0xa36f4c85424c5212, 0x5535edf4ada6019f, 0x7d8e7af579b95394, 0x136c2288e43574fc
+, 0x8c64f4c1e60aa3e1, 0x205902533d02b0f4, 0xc0571ad6a4737161, 0x19657234000c81c8, 0x6bcb945ff5c94848, 0x0a69004cf3875f17, 0xf75c9b3eec075f5c, 0x1df4d9707799f65e, 0x68269c1f94d434f5, 0x30079d0706216a73, 0xc1da36b4b9db8161, 0x38c7c2ae15101f04
+, 0xbec4e5e0ca1c9ade, 0x597b920c9f715a70, 0xcec0b6232d3e0d35, 0x60a98555a748f741, 0xa5753e19edab36b0, 0x471daa58173af0ad, 0x24cc22cd4a1ee287, 0x77d4ecac8d782875, 0x51ada1969f3390af, 0x3bb6f11bfc6652d3, 0x61d254ffd4ff4a97, 0x2b90baabe45de0f9
+, 0x2616e650362ca669, 0x6dd23db5d40fc5f5, 0x0528a8b77d084ff5, 0x1e5d99c7093b194a, 0x2716706a9bae3d2c, 0x16b5401f815d1bcd, 0x9ad502399d51b47e, 0x3924c431e75fe10c, 0x6cfe8b70ee2bd207, 0x5759e4fc1c2037ed, 0xb87399ecc5160ac6, 0x553fd838b4bea99d
+, 0x419d49a852a5331e, 0x69e19761d5a1404c, 0xe28f03dbf751846b, 0x6c4dbeccf78650af, 0x8a40b73f8116f96d, 0x47c8019303b89a50, 0xcc93962bbc756eb6, 0x618c0b3e7400e2eb, 0x9ea9a2a769b1ebd2, 0x78473eaead40243d, 0x2b3149da52fd4339, 0x2946e03845638c13
+, 0x1cd938b4be588c15, 0x33f7d131ddf0aa7f, 0x2ac8ad46bb01ec73, 0x24086bd79776255b, 0x43394f771ac98f28, 0x38ed8538f18acdbf, 0xedcbbae1164d3bbe, 0x26edbdf67ac3ecfa, 0x74780f7d547f4d97, 0x7432999f8020da75, 0xf109cecace94b8c5, 0x3d12c337f872ecae
+, 0xc70839bfff95921f, 0x0ccfb8104364a135, 0xd50b145cb18a46be, 0x227b83a3ed91d17d, 0x32dc91c0371777c3, 0x47e3fd1e61de748c, 0xe2e12a0ee08975cb, 0x7fe25c0bc28f1452, 0x174ee8f018ce2b4a, 0x2ab2adf48bb80040, 0x8c203d65d97c1f43, 0x360a2b09cca34ebb
+, 0x4939f4721151b4a2, 0x42cfe4314bf5e2aa, 0xa961e0567ef67c04, 0x7f8728a6c3d7af03, 0x3810755c1a791b2f, 0x28d64dbb727c848c, 0x6e8b911fe4b4b145, 0x68e08de8a6f0a14b, 0xd8a0697bdfd60a81, 0x223a830fb2b03fdd, 0xc3aa545d011c36ed, 0x4494de70fb6f4de1
+, 0xaa6edaeda75094a6, 0x20bbaa8996c9e6ec, 0xced7e78270bcf6d0, 0x04bbf8c520a59ab7, 0x9b13f9e3ed9a9555, 0x68e08c1dbba71370, 0xb55b2864bfcd7e15, 0x74f08f5acbbf6faa, 0x4938d6566866b0be, 0x656a2f0fcc326ca9, 0xa6cac21604ae34f8, 0x58939d8cf8febb5b
+, 0x63a966ea95da02f8, 0x00a3cd58c4b5c5d5, 0xc93ca14a654012b9, 0x153742c9ba566df4, 0x2520472dc58d5672, 0x72810a8cef5551af, 0x1d4e25f3fd3e6d92, 0x3d9bdb5b2749ec68, 0xd76fedcbec65c4fd, 0x4356575a063cd3af, 0xb077bec38846c011, 0x71c11b5076f37e54
+, 0x05f196f4d76e0963, 0x230e59d87f64571c, 0x642edf856537094a, 0x0995c267335f1409, 0xdde3910724185353, 0x5e195fcebfb4cb50, 0x98408a69522cf989, 0x5478754ae05105be, 0x8acf4bdb88f52770, 0x77005c2a7c3ad13b, 0x61966bad94aed53d, 0x792719535e69df0f
+, 0x9199444d1a2e8edf, 0x1ab8ebae5d1437e8, 0x9cc0d7a3cfeaaafc, 0x23774132e051dc53, 0x1f52e9d556c65467, 0x668b38becd0bb645, 0x422bc77f3395841b, 0x0a2b6f563befd4e4, 0x3ecc71e88ef5d4ce, 0x3a32b227d17c7a0a, 0x185cc0d6ea30d656, 0x5960729567211918
+, 0xbbc4ed5caa612c35, 0x69a001c935e38a54, 0x9097f1d9cac7b053, 0x027d96ba11cb64f7, 0x9428056af25db9af, 0x074b4097b21a3f6a, 0x89b0c32423bbc72c, 0x195dc8e591ff1fb1, 0x9b7130ac0f55363c, 0x3eb719ac52bc42ee, 0x1ce7d213e62ac984, 0x3b23ffa7a6776eb8
+, 0x1c491d00675e4375, 0x23bd15078ae7eff5, 0x93a9c3db0f412d56, 0x3275b29b73f61bdc, 0xfd2570279e7a4769, 0x7963780260515b7d, 0xcdf70027ab9a682a, 0x5ded3c512eb1369e, 0xa2329bdd0dd8541c, 0x276eb2504ac31f1b, 0x8c4ce627f3174c0c, 0x095cc91adc4f0623
+, 0x2410da79095b5f02, 0x167a523e5a921b7a, 0x703cdc0db2d09e91, 0x7b521b997e6c79cf, 0xeb83c5297f781fb7, 0x60e3ceb97fa9e3c6, 0xf666c6f34328339f, 0x6d3814083d924463, 0x46e514344cbddb4c, 0x08441cce7de770fa, 0x815afa86217d5f60, 0x04763a394cdb54c3
+, 0x1a60759b17a860ec, 0x6845f1d4f293aaaf, 0x46c4dbe56a367f90, 0x6718ff2a31320941, 0x16a49ff1bf5c3e59, 0x6e56e7f9ba2a9634, 0xbeb2b4c9cfcfeb42, 0x673e9d3a16b73830, 0x2b9839271f60eba0, 0x03dfec41f037dece, 0xd4f0bc876c82380b, 0x60cf6a6733b3e6a0
+, 0x71adb644f5000ec3, 0x134763a0e96749f9, 0xe5ccfc71451ffa0e, 0x44926217096f4a8f, 0xe7d2ca806140814c, 0x4bede8f186109ad1, 0x0088c180cc79b083, 0x3568cf4b03f6b553, 0x2b89906cc79ff5d6, 0x123d42c4f157eaf9, 0x9d5d92824b9c070d, 0x119ccd856e993e1c
+, 0x86fd1e7179e22c68, 0x2b81ad48ba369e75, 0x7ed7e8eb51af6327, 0x5c49344f3d271289, 0xc4802a13c950b11a, 0x3bdc1ed80aa04283, 0x94cbb503095641c3, 0x449504189f05d38a, 0x3037dcc0f37d96d1, 0x6a9024c57d643131, 0x1503ecf0fa54a704, 0x698582055a44b803
+, 0x267bf6ee48e67b2e, 0x164ee81c82834bfc, 0x30614b28562f3210, 0x2d926d44e066c2dc, 0xc93cd559ae814b15, 0x1808440e703cfe89, 0xae30c98a927dee51, 0x1f937bed0de91baf, 0x319441d937e25ed4, 0x574e7e15875503c3, 0x7175825005c8e5a7, 0x061f8556191fd85a
+, 0x1287691b6e0c0caa, 0x694728c918ab1782, 0xe74b539e1367ee7b, 0x158c142ef4b6b855, 0xcfdb2b8f8e7a74ff, 0x3408aedd80fdc097, 0x7b14e3108d62ccc6, 0x5e766b045c0cf989, 0x6c984093ef539498, 0x6039dce6a5913669, 0x3291bc0f8a195840, 0x32e27a24f1053541
+, 0x525cdeb282f631cd, 0x715bc1530510364c, 0xdd2dd2d66102bacf, 0x19218a299eb1bab2, 0xf4332e6fe4f60701, 0x4a340aa7cf24d350, 0x173caa40f97d2aca, 0x6b5cb957c4c9f0b1, 0x84fa9b0535a7953a, 0x0fa4e20e1ea705ca, 0x22dd66c1cc10e7e4, 0x76f7384d94492a53
+, 0x449dc2b1b0beef51, 0x13878336428f2722, 0x5b7d51d9b01141e4, 0x6ce11bb19d7513b0, 0xb3aba6c4efc2d520, 0x19eab5adad02a416, 0x7838eefc5c697c61, 0x746e927e1e2b69f4, 0x4c26d01b017f5573, 0x5bdc381fe3f1e5fc, 0xaf6dddbfb8b3a017, 0x61f6996acea02ca3
+, 0xfefb5fb921f87fe1, 0x5c81993fd5b6fa75, 0xae67ccd40f51047d, 0x2afc5f891951b8a8, 0x645cd869b56a719e, 0x020aaf562fd2626f, 0x67efae739211c3cc, 0x42526d1288127a37, 0x8c2a2315c7c99548, 0x5383107f0b849fdc, 0xe446655ffa37227f, 0x33286f5ba24bd790
+, 0x6f8b572060c8de1d, 0x6e6c92d34ec6fa16, 0x9cf488ffc57512b2, 0x03f1a5a8bed2aac6, 0x7325b360ffa0f68e, 0x5328657d271e7bc9, 0xd545150f2b486236, 0x3c9715b235a884b9, 0xa67b7449ae6ed864, 0x73a1aff8f9803042, 0x674cd18f71d2ae0d, 0x4d186491ea1b9134
+, 0xd00faa35ea4540a9, 0x6d1e20c2b81435e5, 0x5ae802a323436fb1, 0x14abd7de8deddb54, 0xcf557d066300f575, 0x1447a640f644cdb4, 0xa5642b997115aa79, 0x15ea78666b254d43, 0xb8992c5c6f2d8675, 0x068879a6593c11b4, 0x0e1461ae86673c03, 0x546c7ba12dcef553
+, 0x6bcb92afaf8c45c9, 0x7f810a7a2fd00447, 0x6a776ff1d2219c1a, 0x0d3e16f8045c8c7d, 0xa1cb03ecddd6390a, 0x75d706cf9d1fea40, 0xa8c3e2174b5243d1, 0x474d0fd517e3b155, 0x8812085625db3e43, 0x79e0c63747f36f1e, 0x6ceb35fb49612c03, 0x70c7f883db51908c
+, 0xa37af7937dd45c38, 0x0f70ab38ba41096a, 0x4ed3c0bc094cdfdc, 0x1a9599e92146f237, 0xe87ec270d850bd35, 0x45125b56655a0b81, 0x24dc4a9150fde52c, 0x78c38c31adca6f25, 0xe1a9b106678b7956, 0x7985e8960669dbb1, 0x165274c98a2cd409, 0x73083897a37b6ab2
+, 0x15c067c55e44cbfa, 0x49f51dca55b0dfb4, 0x978582af35ac42a3, 0x5f1b0478e028ee4b, 0xefd918f2414f3f39, 0x44c145e286d5aa7a, 0x35c412bc9ca68c23, 0x14056b84161f7138, 0xb698db07c1b4705b, 0x2cc916191d32b689, 0x5bcf0ebca2f60ce8, 0x6ba7c57114e1ed58
+, 0x93ed675fac5eb3f5, 0x18da069c78eeb51d, 0x4c292ec368236957, 0x5299649f506908bd, 0x20bcb5841f33788d, 0x68dc97f9e7037a15, 0xbd0e73285fe549cf, 0x7fb3d429196f4d88, 0xe0e73d139a19ed3d, 0x3fbc0574f28a2a9a, 0xb7ae907046861a15, 0x1dec9f188eaf3fc7
+, 0x85302da80e3a4494, 0x00e1a30746332057, 0xfd3a733975dafeda, 0x385fc8dd4d521bbb, 0x009e469c970c153b, 0x49c2cda40d04d3d4, 0xa90938c7b4920e31, 0x272acf8a81b735f0, 0x4050c34edd684bfe, 0x39e849d07dd9ad83, 0x7acd348668713d62, 0x678a08d1ad57505b
+, 0x26a7fce9623239da, 0x745959da393d75db, 0xefbb64b145d09ba7, 0x71c5b2745e7c5c44, 0x12ec14b1bd1be5bd, 0x73b3044681cf96a2, 0xe6857073045e4a18, 0x04ceebba9ba14074, 0x14218bba1f97f255, 0x782077156e17f3e1, 0x6d80bb5ec0283135, 0x4b6279e93bbbb87d
+, 0xa742ea8609b3b595, 0x59d3a3ee42143250, 0xe7ed01b0bc4ac62f, 0x6c650c67c7d006cb, 0x30e4f9deb2b446b5, 0x3cf938899c14c880, 0x2e14a0f519acff4a, 0x196cf4bbc4cc984b, 0x46983be457151140, 0x49ef2e5c9f9d833b, 0x3da7bed7239ec488, 0x4a9e6b210ee9c53a
+, 0x9e8a65622aa3fb24, 0x37867dfaed018d0e, 0x86c2ccc684559ff8, 0x5d232449bbeb154a, 0x9ecc4d60fdbbf1f3, 0x730c5c8281ac6b77, 0xe4062609d8f47027, 0x4a4fc5f6952c6c76, 0x3bb5082a1a2823d5, 0x2cd35cb3f822fdcf, 0xeb6fc6f619a96401, 0x260791e0da26f1b9
+, 0xf4685080f9c5870a, 0x517f674ee2863ea6, 0x758eeef8c4d77f01, 0x719617c6dd82411a, 0x41f065fa5fe0c2dc, 0x756573b61e425a61, 0x43b5e46c2f98a46b, 0x2c55e5620c75f83f, 0xc78b8d52cd445215, 0x4cef19154f9a31a0, 0x1ad2d45150a28080, 0x1c82796af16dd6ce
+, 0x528cd5d119a3eafd, 0x2e50b7bb8e3b48e2, 0x60438f60d7512b9d, 0x6334968d39abfb10, 0xdb42c10eb15f3bff, 0x6b7279581846a42d, 0xdef3b04057b510c4, 0x5c37527460d493ca, 0xf8a99aa99efc2aee, 0x6e9da2640d7c1f85, 0x90374ac6e5054ebc, 0x429391f6fe5eef83
+, 0x44389f392c4fd677, 0x3c54910b632d296f, 0x171923cba8e2b1a7, 0x1483b7e2bd0b8c6b, 0x48c5730ff87fd789, 0x7d30ae59ea1270b0, 0x22bf4f40167b5690, 0x663ccf92059ab0f0, 0x84d9deb9bf745a16, 0x4c3fe77b911b29ab, 0x451abf48fe7a209b, 0x6f2d15037a1dd72d
+, 0x72496401421c891a, 0x0225eae5e1418d3a, 0xad1e47ce0a37f3a9, 0x2ab1803acc430258, 0x622a07ed95a33a85, 0x003dfcc2e03d6f20, 0x6cfb9cc26d136adb, 0x3c0c289161185d8b, 0x8ad073f4b600b0e2, 0x5248cbfd2ef068c4, 0x9e1ef72471f2651f, 0x068f69e8477a2047
+, 0xb2fe43e604ae218c, 0x3f132e281c09c20f, 0xd7d0b454bf848f2c, 0x4e4bc14df666784f, 0x48174118c6ff435a, 0x16895cef54057866, 0x5acb16cb162ea2b7, 0x0156fbd49efab958, 0x6641034a06a453a5, 0x30bcec4e34417604, 0x3c4ab291f771904c, 0x3cd93fa399aa90b7
+, 0x44842135319d6e66, 0x4c16573bb6b7ae4a, 0x5ca4645ee583060a, 0x24cf9bd1be5b6571, 0x37c554dc0d31a854, 0x461f6f655889a92e, 0xc0cf6ba8e978c4ed, 0x30daa5cc3f421822, 0xe2d13c6caaa53ab0, 0x4ea4bc7d9cf5bfc8, 0x7cf185d5305db13d, 0x200f490b0aa7f305
+, 0x9874cd2f92dd18e1, 0x5cdbbfe3a5f67aeb, 0xaa7dcf05d12f0571, 0x6050d935e600883f, 0xbfac18489289d829, 0x3bb47c670263c9a7, 0xd391e3ee23b3eda2, 0x0f1ab2a2e00d88ce, 0xe5b7c013d9fc7f57, 0x234a157ac2a3fcda, 0x6aa5320fed37a8ad, 0x7f40d34d0e6be1d3
+, 0x2c24f03376041127, 0x6f7e2fd956e38d4d, 0x5e064771ed36827c, 0x2a7e07d9fcf56f08, 0x007825b3b667e594, 0x6ba32438e5e70a23, 0x202efd52d0ecf40d, 0x62dd475fa70cfd99, 0x5f11ae02bd7062bc, 0x16b681c321d80106, 0xb4b01063205f9b58, 0x371b2999c0454fa9
+, 0x2bbfef0bb8de4d35, 0x6ea12e0e27100935, 0xaf7727e6d5fab37d, 0x3e6fab71cc97f540, 0x7f536ee4a19ac6db, 0x6221eb21c9a80e23, 0xb3cbb2e3b3fed60a, 0x2f56021097076004, 0xe4d441b41e20a5bf, 0x19f3ea21944eef72, 0xad3c595b361ff37b, 0x0c82940bc0d33cf6
+, 0x11df933d78833a2e, 0x45c669efa06ad997, 0xdb3f56867e9242d7, 0x5a5da7fbf1365770, 0xc216c827698254e9, 0x14c9489e768aa0fd, 0x23224dcf0b104734, 0x70507df258795c60, 0x043e5e3eb03f5974, 0x5a0719c7e7cbef23, 0x571fe20f151c88db, 0x791210a3e022b01e
+, 0xce59d08478d8909d, 0x4e5a133bc0f6dbb0, 0xf842281adf1b5f9d, 0x114bd0c43a6e6a01, 0x9c2ad29fa03d4f1e, 0x6d65a23e18788d1d, 0xd73b40843a889fc1, 0x3b3184f76f66422a, 0xc467ec7d4bedffd0, 0x0f8b00d4e9f74197, 0xf45b5f4aea116402, 0x111622f90be8bf9b
+, 0xd85d56ef4cc1a040, 0x32c3bcd6d87be353, 0x2c56c34385591c54, 0x057bb95cbed5c91e, 0xee3f89949581b4a8, 0x7a31d413deb95ce7, 0x83da4038f996de23, 0x0a1a25b4844d3eef, 0x14c4db7e33f8e577, 0x4d3dcb357b1380e5, 0x3e1b1c72c05cde82, 0x295483aeb39d5a2c
+, 0xb26d8b0f244b3d24, 0x1d40dce8d7416fa9, 0x410280c8703405e3, 0x69b82912bc072625, 0x8a21672f49391ced, 0x3345e875d83417a7, 0x74a62deaf375a4cd, 0x55da688835d6ede1, 0x50a97dabeaf0c8ea, 0x576ec554539acfd6, 0x179645a82f5ff3f7, 0x0cb1bc585b4ac887
+, 0xe0fa1b7182b461f3, 0x71fe8aa86a5a6a78, 0x9a196dd8775a7d91, 0x41bdab770937c10f, 0x8c6f5e1aa0c0cd04, 0x1d9ca17a9b88924d, 0x9c403edac8ed1b91, 0x1a530e1419bbfc29, 0x4381634cf882d04f, 0x5863d759e2224fd6, 0x2686a5cfb6f75e3d, 0x2daf8329d4a8224b
+, 0xc373a06159d82797, 0x5e8a8b7d5a7c7725, 0xf9447722505ebc15, 0x4700e1686843663a, 0x010eb5c4e7d6385d, 0x07876b9a70db0306, 0x771f78457a20b4ca, 0x6334a8823479fb29, 0x0d49f67eb06b3d1d, 0x24c90abee40dc4c1, 0x84fd08ea438879a0, 0x684179717d51f1c6
+, 0x67b9c279d3e63387, 0x72b922579a0131ee, 0xe4dd2b4cd62f6d13, 0x0f6be2b3349f9d1f, 0x8334aa477d5c777f, 0x6bafe9bd85d867e4, 0xa249349d3e298274, 0x5f09cc2e9485ea0c, 0x29e0f1ab334da2fe, 0x621da075f53ca4c0, 0xb425f23336dee587, 0x4036019a037ae190
+, 0x088d15e64424177c, 0x2192f9117c7a83cf, 0x6a038557589fbdff, 0x1d4049f499005c67, 0x07e1103171173f01, 0x0d001fd198fbbe65, 0xbd147bd43c5698f6, 0x586114ddfcae6754, 0xca358231f04bd228, 0x3ba32d9729d50b1d, 0xcd90d9ad8cb7295f, 0x2cdddd75cdb5704e
+, 0x50214f81b948427a, 0x04425068e2904ae4, 0x9a762ab05637d7ef, 0x1aceaf95b4edeb3d, 0xece28878f1162625, 0x484c3d5ed21dfcd1, 0x2e7912a42123518b, 0x5cfe10df3f4cde32, 0x77f87d5b71ac86e6, 0x1954ca19827dd3d9, 0xb298f489ca71a2b1, 0x0f46a4cc4d29ec5f
+, 0xc72f2059c0c05079, 0x08192902a08a2e74, 0x3d683e3a0257a139, 0x5ff15523758a5ffa, 0x8c2b3eb32f8daa11, 0x2e6d6a7f158937e0, 0x0efdf1a0d3edeb7f, 0x4f8034ffdbc81cee, 0xe1ede1aeb15ecfea, 0x7923d37b739f7991, 0xdb42bc539ae9921c, 0x5c17834314ab91a2
+, 0x754b48252edea572, 0x6c25da161134b3b3, 0x6abab2a906275718, 0x6fa5bd62fc2bc3f4, 0xec7376157fa7fcf9, 0x2966645489df0c83, 0x9857088288dd92e1, 0x36f45c91b5ef0ed2, 0x20c9821a9264a2f6, 0x737b4d8d5c6ec55a, 0x358350f97c8c36ee, 0x47c66188b5ff2a5a
+, 0x0a60084b38fded96, 0x559b96ed7da57d25, 0xe4228d54c7169da2, 0x12845b7f08ac8270, 0x7927055f49c84fd5, 0x1c0e65d95c0d2f2b, 0x722ba4f03a54500e, 0x29fadf36dd93a59a, 0x19390ec67a3e7753, 0x1f267a327c2146eb, 0xd73921efbdbfdbcc, 0x726fa73e607c2155
+, 0xc1cbd0e1189d0df1, 0x46c0533ce644b42d, 0x7d9e2b1a5ce926e4, 0x08694b0ba0757914, 0x32a73fcba0e8b6b7, 0x7fc054c0bbc78e2a, 0x4b17c059c8e8ec02, 0x46dba543f790a8e3, 0x3a8425da52712142, 0x644ef342819b1f7a, 0xfb42d8e13c4fbc7a, 0x7a98f0f14baac590
+, 0xa19fa35abb079743, 0x2ba4ee908c5efd5c, 0xa7b29156832a9053, 0x20f5e0317a49bdb3, 0x1a545f4e1d8030aa, 0x1bf3a572adf02c66, 0x337e27dfe193e372, 0x509366bdf7693656, 0x29662b54ccb84f5a, 0x6fa211d4c9aa0af5, 0x09a6edda64737b75, 0x0d8ad62e3ca33375
+, 0x300ff5ad1efba9c6, 0x33386865fe5586e2, 0xf8f7c1853a2d761d, 0x5fbca0b75fc0f9db, 0xdad09a6cad552e96, 0x2220c3993972d706, 0x26e767bc97d2ce29, 0x78e1a0efca266997, 0x38c17c30467892af, 0x659975256005f658, 0xcd0dc1d8bc6ae7f4, 0x0a0a5929a135e4fc
+, 0xaee55b29a87d5c2b, 0x4508f9e020c5f8cc, 0xf453700fc02c479e, 0x0589fb539999277c, 0x90cf69dfbf0b8093, 0x56900104339facd8, 0xcc32e3c5cd7e8481, 0x43555fdce6ac71ae, 0x0b071ce1fd2030e3, 0x5e19a86cce1788aa, 0x1cfe8885dea77ed2, 0x6a3a9de415e51ffc
+, 0xdb79864df429be6d, 0x37f5f03adcb22d7a, 0x9b2b3f1fad047358, 0x00f2426d340f2bfe, 0x890175f085292d1b, 0x2038e21e57b7f36e, 0x5bf1632d063741df, 0x299d479e18d1ec0a, 0xa569ce9d4ece03aa, 0x1968491ab5d51eb6, 0x20c6c8ded77fbeaf, 0x6c1975e06e1d740c
+, 0x12ca5a95ce58c9d4, 0x0410d8b9e8b0362b, 0x2384695a076e111a, 0x727287c27140c7bc, 0x8d0edb652a15092f, 0x03486e223670adf3, 0x3124bbbc463d505b, 0x7762edd5fc4b844f, 0x0172561190988c10, 0x032cc0e8a36ed48b, 0x8610abf5e30be7c3, 0x443f2d571c8f8ba1
+, 0x3dac8bd1750f24d4, 0x4355d06145b96a9a, 0x48b4b4c8641ab688, 0x51e19040e8006c7f, 0x8595ee012be4c74f, 0x4c46e406d26a0ed7, 0xd0f24aa23b116823, 0x7f656d8a9173df36, 0x41240d6891df5f9c, 0x583ba6de753d4508, 0xb128ca1996be9611, 0x21bcb6a28d944b3d
+, 0x530179847db63fa2, 0x04892643dc381c9e, 0xae9e39af3243b149, 0x7825d04ffa43306e, 0xff039dc197b77518, 0x07db1fdde275a044, 0x863bfa3e58a8f3fc, 0x77d7146fc51687cd, 0x302b61130be015cf, 0x2a12a7caea0e7d09, 0xa6ad3dcb6118a18a, 0x49eede3547a5a575
+, 0x5dadd031a6fb7d3b, 0x1a08d470bde706e5, 0x24d43d2613fd32cc, 0x09c92c496614bda2, 0x248e45a8831c7cce, 0x069d12f954826688, 0x368cac033de7cf1e, 0x57a7d3ac504225a8, 0x08db70fd8eda205d, 0x7344e2dd5a2a9409, 0x512d122010a78f20, 0x5fbd5d85d92562b6
+, 0xdb896a347bebcc42, 0x69a7562e528c2a8d, 0x15788614417a74f2, 0x2efe4b49ce8c52aa, 0x605fd7a869562e48, 0x2b638066af326482, 0xb6d314cb74b4594f, 0x709a87e53427974c, 0xbab7c247782dd96f, 0x2319c55128c30f67, 0xbb0aa6af4b33e4d4, 0x3b40f66d8660a62e
+, 0x96686f725edfe134, 0x7d27e74d86ebbcdd, 0x9f7c07bd23793646, 0x4d2f7c111d9d6200, 0xb8f3e8c515da6850, 0x675688d1c6ece027, 0x460eb65c729134cb, 0x273f6907a6fb8698, 0x3ef2a2a4bee17cd7, 0x25dd2a66a690996b, 0x50458dd0e4d7f422, 0x7477f6f1ea1677d5
+, 0x58d1c9f54f780bd7, 0x56b79e4f7508c5c6, 0x876b071ff76164c2, 0x65fdec2c73872f2f, 0xc8a2d0faf8a4bb4c, 0x6e07c47d2357be95, 0xed9188f8dc9715b8, 0x3fc86e9b034dd198, 0x854b44035b484968, 0x70700bc600dbd66a, 0x69d0ac5840dacf80, 0x1bd140021d0fc3ce
+, 0xd9c197909bc19689, 0x58f8080928608c17, 0xf54f2c2420717fad, 0x1a3a4722e13b54a9, 0xd50672350b0fbc45, 0x544aeef40bb1e255, 0xf4306e9b046473c3, 0x33244bd6dfe31e4b, 0xa04ddeb686cc0124, 0x3db7fb42424ab925, 0x121439923c393957, 0x27339cf95a095583
+, 0xa778e16b323895e2, 0x6e606466e46fcd29, 0x561723946386dc04, 0x1670d25d0430cea7, 0xeb552677fe1d9e87, 0x588bc1a2b56cad85, 0x979515b521498082, 0x01e82cfbad4f84c3, 0xba82c8a7ae4195fe, 0x4c9e0b1790bbbdb1, 0xb3c914f889226264, 0x56707fc831ea3988
+, 0x22b16ed629ae861c, 0x30968ef27888b0bd, 0x134016f089374da6, 0x6336491c38620e90, 0xeac5a0a6f18b25ce, 0x5ba418c997c70002, 0x7f29a49c85876253, 0x03edfff5463d516b, 0xc3129e9b014cf346, 0x31005a49f8519665, 0xe6834587437160b7, 0x3a147f1344b768e5
+, 0x929befc0937785aa, 0x6d5a05589454647c, 0xc194247ca7af31e5, 0x418d9b30c4c2c176, 0x29b6c36f620634e6, 0x7ab3d1bfd4261b06, 0x47d378fbe55803a8, 0x553a0deebc515e60, 0x6cb00f0654d712a3, 0x0da9cc0c1d694f0c, 0x186578a85763bab1, 0x37726492b3bbc3eb
+, 0x0e8ce06104bc1f15, 0x52294bf91cc93f57, 0x14f88f719eacf5dd, 0x1a20cc1d74640e87, 0x4424b98cb401495c, 0x0c771609ecfecdcc, 0x71d334555eb6df56, 0x63c2739d57e39366, 0xeeb8554ec77aa981, 0x15592564f9ec8f8c, 0x3e01174854d994e3, 0x68b679cddc238d6c
+, 0x247a460c7eb36d9b, 0x656161880b857c31, 0x59f9e2f4b827dbc5, 0x5a167e28cdcdffe4, 0xa4e8ab9bcba2e3fa, 0x3ee9d8c39df32cd6, 0xa7e7809d51f54aa0, 0x3231edaec6005257, 0x54993796f96e2651, 0x5163404fe90ea16c, 0x7af945c0cdded8c6, 0x352cb9b52ce40b7e
+, 0x68d34608eaa51333, 0x51a0ac18c7a3a249, 0x4979beecb2de2244, 0x55907b8a3a85e3c4, 0x6ee652232a22ef42, 0x46a3f4bf27e322c6, 0x42ff69bd4f53da42, 0x6d08102a092bfc55, 0x0ba2f57a86a3cd1b, 0x3e0c1c4adf0fe9f8, 0x07c7299d3fa23da9, 0x4967b05ef2885fe2
+, 0x7707fea53902cdd1, 0x27b127c80e856bec, 0xb9812d2e83cc17b1, 0x6940d2d5de962dd0, 0xa0e6db890db7a506, 0x5ce3a3817eddc564, 0xe133746f6a2db45e, 0x47e748f142bb390e, 0xb8349c4899f706db, 0x239962fc2f3cef67, 0x314b1f71180bf207, 0x4668ae3f7b0f559e
+, 0x5fc801fe231ce854, 0x51c0cb3016f8be32, 0x825fb5d10008abf3, 0x265a97621c549304, 0x68bb770ebda51ef7, 0x68472464ffc86989, 0x990b11d45f43239f, 0x74dcba69c3902b80, 0x683725376b3b8221, 0x2bb34c0481fcec44, 0xb18a3a0550bdc4b9, 0x0107723725d857e9
+, 0xd67841dd1b85fa94, 0x51f1865c5ab9f5bb, 0x2be6b4780d703504, 0x5b302ebb4c88d767, 0x6e24a8e947c30093, 0x4a9858458e12d9f4, 0xe3c017497cd81211, 0x12d3f40887dc6e63, 0x0dd2b72ba49fabb9, 0x46b5896a95640bc6, 0x7d90eadaaa872eab, 0x053ead915463ccfb
+, 0x870e0487dfa213e9, 0x2077b141442276aa, 0x1d8b1302c9a7769a, 0x61ba12aad77ad881, 0xee0b1041d1451053, 0x18dad8b67fae3631, 0x235501a2557972dd, 0x3048b37d4076fe2d, 0x21017bc5dfe8dc9b, 0x2913b35863838482, 0x859f18a73ca8db17, 0x16bae666379b9455
+, 0xe3285f0c0cdbeae4, 0x60cc77704c72f104, 0xf84556cad087be48, 0x1f7a898c27ac1698, 0x291b1a72cb6ccc24, 0x504c048c3e1fa201, 0x541dca1fd546dd2f, 0x433bc718c8c57ca7, 0xdec1210320a1818e, 0x693f86f642b1ed54, 0xcb4d40dc0c1a034a, 0x6162adee5522d41b
+, 0x79c5b26f97c62673, 0x69851cf2a8feb31b, 0x894958e1ef3d17b8, 0x1bd67a3268f53767, 0xc5327ff58420fae7, 0x0a0d6a436539c846, 0x781ac1324a92ea66, 0x2a037a8be6be7d6d, 0x52dbe3207aa04032, 0x7e852f0d4269599d, 0x1cc592c03dbaf574, 0x57bceaa85a25578c
+, 0xc53965b4e0ca33d6, 0x71c0a92d306c2bb6, 0x83a103f25c7b987d, 0x1985f9a873ec221e, 0xd6db203110cfe273, 0x30e297182414c5c7, 0x4d295b4b0949c383, 0x46def7d5b4f9c28c, 0xdae6cb9b56f3173b, 0x7407b8354ad579f5, 0xa0b4d0c3ed943d9b, 0x2c5248ce14bf455c
+, 0x182471cbf075b96f, 0x185b489be0970e07, 0x2dcea21601a721d4, 0x5dd5eb221f8c04c8, 0x5b34bf95c7fb55c9, 0x39a51fc2858f0439, 0x528a1169c4388d6f, 0x7d3f813c183378dc, 0xea64da81a93ab82e, 0x5e670dca743a3d1e, 0x922e00df967ef1f9, 0x5b1eaedcd210a186
+, 0x27053117d833a017, 0x6ccd513a4219270e, 0x4a591abe7b816a39, 0x46c787c8e14df47e, 0x7d0e52c0d611b1f1, 0x3ff29049057fba6f, 0x691f328950dad935, 0x3aa2fffec55d9420, 0x9ce083666f912b07, 0x5f6decdd89d64548, 0x375f02db8f9bfdcb, 0x6c3b827502934752
+, 0x0e120247a41103ec, 0x7bdefe4369d4693f, 0x91466c116ee642ea, 0x61449f4ba31bb0f7, 0x0444b8a1a5e5dfe0, 0x57a0a2e258d24ff3, 0xa09fb9b58e703e1e, 0x6caeff29fd979f35, 0x472d3b12ce0a6558, 0x4d3414ce0630cb39, 0xb0ca33aaab8d8110, 0x41031e238dce46ea
+, 0xc2d2a9c246bf9a71, 0x343013c6e4c79917, 0x64435dae04362906, 0x63e377cd910a91a4, 0x1a97a5234a5299bc, 0x51c995dd9beb843e, 0x4c7bf87432450b5c, 0x43966ec56ecd5231, 0x0b6bd1d142469668, 0x3249d92c64fdb78d, 0xfeb9da43e4f2e286, 0x5c7d9e6dd28df110
+, 0x287e93cb941e54ae, 0x2882c6b5bf67f13e, 0xba25e7c048e17a0a, 0x3b8b97b7ac059027, 0xf0e2d4edcf1a1617, 0x3bd0a2899800c966, 0x29d197d6d37299f8, 0x506541d0b550ea32, 0x8ba2456fd609999e, 0x3c8fbc5e214e33ad, 0x29fef9e934ee616a, 0x2c3a08d3a667b111
+, 0xd160c1fba133f976, 0x308f4cf8a37aba75, 0x2558542b215ed191, 0x46364efcff4d0d3d, 0x03e255649e742d64, 0x569f6a4e4efaba20, 0x26d8c17dfac2cf71, 0x6f9ab8febfa579f8, 0x8520e972acc2c70b, 0x68245ea7c7363290, 0x1af90f7484cfd1ae, 0x3c4e10b0085ece41
+, 0xb54624d267ace1bd, 0x6378895d44467b73, 0x6fc6ccecdfd638ae, 0x15c1392e6fc8bbc4, 0xd0316ce77739474b, 0x338cfb3a99c62b9b, 0x3680131a3fff9cc8, 0x68c316cb2ddb387b, 0xd8142085390f6255, 0x168e459c39142c57, 0xeffc43bb1f7b8327, 0x5d6db560413076c5
+, 0x2f786337a9c8eac5, 0x419a4b67eaf2fd6a, 0xf48771cabdd53965, 0x7034269481c0b72b, 0xa13f4550d6342182, 0x56388d709a73b691, 0xd86b85e634d63d94, 0x23cab4bf0652395e, 0xbcd201ba2e67dccf, 0x54817b2f06eff200, 0x65b2d5c1725ca1ad, 0x5735679368cb29fe
+, 0x7ecd373916921b47, 0x634c0522bd2a6dc5, 0x677c08849781299b, 0x7b71a4bb604e9691, 0x47d287df0ac07fd0, 0x3689b4597a5e8a66, 0x211bb1d3b7079596, 0x041951017e9406b1, 0x29ef8e0d67f51b34, 0x2c03e3356890c537, 0xaff376c1f76fbc78, 0x0405ca118bf8c8b8
+, 0x92d8da307ee817b8, 0x2f8f8f7358f89599, 0x055aee41bc9bee74, 0x5a2fa32125cc1a80, 0x28bd69de568149b6, 0x3c043d288ed3b418, 0x305431ab9172ac1d, 0x53ecfb3f32767fd4, 0xcbb509d840980596, 0x2c0c9afe9450e12c, 0xba3c8a4d49994192, 0x2be1c02d4dd39f71
+, 0x1d5bcf20251bcaa2, 0x0a082ec7ea19f164, 0xfb76aa865350e433, 0x65121ad112f97e72, 0xe9b97fc6bca444c1, 0x727f3d549b82b50b, 0x2132c0c82601f818, 0x19a5aeadcb396c60, 0xc2a89921c275c025, 0x659fbe23e9c1664d, 0x74270a8abadf245e, 0x373a1b6d134330af
+, 0x9d8a58c952a7ed1d, 0x0ead694bbe977aba, 0xa24f370d739a394c, 0x68e4518a496e8e9d, 0x6a26f6c11aff22a6, 0x58afb9d9314b459c, 0x5eefda739d4aa61f, 0x3b6b750aa180805d, 0x7bd8546b88345078, 0x29918eeb1138d2bd, 0xdcf8cb4fc2e3bb25, 0x527490d2be6630de
+, 0xdb7d8b2f4752a8ce, 0x34f2a47bbf019a6c, 0x32a13413aa0e321b, 0x5407f093ff3963cf, 0x27d675c9110d3425, 0x063999438bd80293, 0x0bc9c0b3bac2788a, 0x1fce4e1768e33a41, 0xe0c1736a5076b6f9, 0x4fab551888af57d5, 0xccd251c45f22ccc4, 0x790ee9a35e646b71
+, 0xaa0df5c3d0b30dce, 0x0d5b1e1285579053, 0xc99f5f6369e7ebe6, 0x1ea94c6abed122fd, 0x5b88643fb23f7c4e, 0x2bef2e005c58c587, 0xf0074c34cb4f8c42, 0x1b6804afe6983616, 0xc3889782249a0374, 0x0592ac73e5383c26, 0x9f772be3bbbfaf79, 0x4e6519b7f54a7850
+, 0x5fe495b853ce637d, 0x49b93df439afbb70, 0x3d672bee6759174e, 0x0dae682541ed7d9b, 0xc21ae5267693a16f, 0x1b553cda7fcfae07, 0x4212972b88d548f4, 0x241c0c968414d9b8, 0x09157a62e8720e6d, 0x4fe46618c0ea56a5, 0x8c0a9e8b2b04811c, 0x71e3d3363763bee7
+, 0x9d9f59601f3d5a3d, 0x103202baaf9943c8, 0xf7d4ef4ba71a1b99, 0x534c748f10552718, 0x04ca151b801b23be, 0x671d8d9d7aa1c3b3, 0x1785131ffe5518c7, 0x3e8cef60408c3854, 0xcc9cdfd4742f1f62, 0x7f75d78be98c0732, 0xee9ca5c9f4500d49, 0x721969b9b6b63c8a
+, 0x7af85db590ae22ca, 0x0d8da2e88aa87752, 0xbed2930aba3cc03c, 0x75ae7dfa79735461, 0x02d5c88de77f5a47, 0x0b28d70198dec7b6, 0x97a7ad739db8fe3f, 0x18b9da33f9d8923a, 0x1e45757747247cdc, 0x2bdafd869d5e6155, 0x76ce3bcbccdc0285, 0x38597c343c9eb493
+, 0xd3d65f421208e579, 0x273e182a90d93800, 0xa876760030a2aae8, 0x1272964e6ede039f, 0x8c4fb055fae8775a, 0x3080f170ddf1c1d4, 0x72f1d58b4a579735, 0x37095c76d0281693, 0xb2795d77a46b2c45, 0x34d25b5b3a009f07, 0xe60e7fbd7214b6aa, 0x1c3f39ed7bf2e5a9
+, 0x59cf633d2aafc137, 0x66bfdec73e1d530b, 0xabbc4fbcee91c855, 0x5408f8d54ab8e4ae, 0x2f85ae9ecd51bc24, 0x3e096e193d96e3c6, 0xd26e353fcb7aaa6d, 0x09487fc91111590a, 0xaf848b1c01485321, 0x5cc7141cdd3cb50e, 0xc48a7469f8e236f0, 0x27652996ae9d72cc
+, 0x8f702e90abbb6369, 0x2f0e07164ebeaa9a, 0x0cbd9ba8e388c449, 0x3baaf33517f1ebe2, 0x0e0f9dd7ce2e1429, 0x08f3a0c25c0257b1, 0x93eac335338a5a75, 0x0c532101b37d7ec0, 0xe5d904e0fcbbc140, 0x611c4334325536da, 0x6d4c58475941467e, 0x081f8971837f45f7
+, 0x41bb299b24ba2518, 0x08d75ac37eda4684, 0x81c8c7e431163577, 0x7e3d7c2e06ae53a8, 0x3e570f969de7d3d2, 0x1fe4dfe8b8ae99f3, 0xbc6aa84afae78eda, 0x705a7ec5f40ddf8e, 0x19c301b05ed1422d, 0x3cf8d9e2dd855c97, 0xf0fa9fd85cbb21a8, 0x61669a6b8eccb038
+, 0x4e0d61d088f991f9, 0x04d4b7f8c64743e1, 0xb632bacc29b4db81, 0x72d29e2898c5a4c7, 0x5c0e5728e037beae, 0x001ef8a8037640c6, 0xc72fa37a9a57f90d, 0x35a23139e4e065ae, 0xc14591b9aaa65561, 0x5934becfe9098d88, 0x3ed4f73d922cd4a0, 0x65d9a358303eebcf
+, 0x71cdebb6c7b72f8a, 0x4b5c83091b318fa4, 0x1c777283984a9a86, 0x7a7e2d86e5c1b117, 0xf6618fc006b41cbe, 0x3d7853abf6210357, 0x694c57ce1fe24f76, 0x024b2c3f03e75030, 0x281b19d372c3724c, 0x5daa42cb882ee73b, 0x23f08f5d9d9709cf, 0x2ae474ffdc31294f
+, 0x6b3381a94b1f298a, 0x24f660a7a16a6cca, 0x423160359dde4835, 0x6fdff5a8374dda47, 0x90e655c53fe3f332, 0x7477886636a10907, 0x4a83b6452012cdb2, 0x6f4757ace10f90ac, 0x33726787baa84939, 0x7fd5d4e193adf292, 0xfd6970faff1968b2, 0x494b6bd6c2cfb0d9
+, 0xf1ae177c28186b4b, 0x1fc1811347baec29, 0xf01289a205e1cb01, 0x7b37d586036970da, 0xa020ead6b66409be, 0x01b08298500445f1, 0xb9147407714ade8b, 0x47368d4737a1e0a8, 0x9d431090500eea4a, 0x1c3e262b41d8d599, 0x7848dfc383babefc, 0x56a900c0b7a49f25
+, 0x0fb9839c3f5f94fc, 0x7bd3ef9e7777e7c7, 0xd1beba756e6ef32a, 0x1db06f76c3651799, 0x47d73fc8f60b5664, 0x5b64b08e3355ec1c, 0xe189605c02e4b53a, 0x270a9bef459d1ea2, 0x3eaf07873b721fd2, 0x65486a231824e435, 0xe44530412767b622, 0x31a58b2d148f02bb
+, 0x79439d9f9a53d632, 0x1a671d64a94f7e0b, 0xd264849107621cd7, 0x5b1504d372f73fbf, 0xbaf5f4c1a2107d97, 0x77dbdfa3d18f7408, 0x7f4abfc45e4b09c7, 0x031088d4c31e7622, 0x32bc446b3240e050, 0x202059de22036a4d, 0x515e9e898fca0227, 0x5ca8b0bbe415b5eb
+, 0x5009d07a73c85920, 0x7f6fdf2ba9192c38, 0x5ce2a4b54fdb655f, 0x4dc3f63cb1a14a13, 0xb24e1ad1e32b8964, 0x18464d1976f65755, 0xe52908aa2147975e, 0x5726df0f2555d43f, 0x69dc758c9356a38e, 0x12a2049fd16bba97, 0xa49f2218f2538c93, 0x367634633598074f
+, 0xc57502f226949af6, 0x1a2db82badc5b8e8, 0x0322e8de4e3e9ba4, 0x44e63e84f4007eb7, 0x0dace585cf802ac7, 0x6237ceeaf06caea0, 0x25aa86088d02e87c, 0x31ab8c09227c48c4, 0xb9ccd422aa72f344, 0x08a1c44075eacd4d, 0x0d92804851e04d63, 0x2bf23bfe8403f5f4
+, 0xf13e40fbc469b1c6, 0x0cf3dee51a4120a1, 0x4f376a0f2c32d993, 0x1ef8503589d5524c, 0x519403a0ddfab378, 0x5aa01ef640b4b792, 0xa6f2d844c1d33d4e, 0x3a5d84e7ebacaee3, 0x544a8d5e1bd9b27f, 0x2a14b4253cc54be9, 0x6567ef39237e2097, 0x5d7cbb966c681708
+, 0x717e7c626e1a47ad, 0x472e6f5522d113b7, 0x4cea056af2ff9b4b, 0x175623832459cb15, 0x8a781f1875a52a4b, 0x5a6bf5b14b883b51, 0x1b94b91fa5954eb2, 0x1b480c5b86d9378d, 0x872f7017d7e3d20a, 0x7618e21e05a1d69f, 0xee4e961469e00c0a, 0x558bb6fbc656cab2
+, 0xaba968c3d71367a8, 0x4a9a877278fd61e9, 0xe12de33dc4254d9f, 0x1df993bdc839282c, 0xba6517bc5b1024d2, 0x45fad1e14ef4de3b, 0x06b84edeedbb65ea, 0x083badbcb2f3b731, 0x2502138b85b637a1, 0x5dda5d87f5c714b1, 0x95a894a582684b61, 0x107f3e76562dc328
+, 0x835b1b62daa9425c, 0x2c5be6e9c26afbcd, 0xf92737f658c89c6d, 0x1d97ecc5b09cbee3, 0x8a331a29e09db97c, 0x7c07e367f0b18532, 0x95a18283c8aba291, 0x1e7e4994f3c778e7, 0x17b6ff9ddfde2aa8, 0x306987dad386e34f, 0x26e58f89b465bebd, 0x62b46b043e1f1dfe
+, 0x3c38833491318865, 0x67a207196c37aeca, 0xad26a7bf4ac76879, 0x36c841d597b223b5, 0x679c9b49a54e7b9f, 0x3f1e71ca6a7c7772, 0x1343521ee40b002c, 0x286df91d44a3ed37, 0x0fd8c783b57bc947, 0x149b4a5eeb1c48c3, 0xa960f88222f21f8f, 0x2b7b597eb6d7d3c7
+, 0xe758a1b704690d0a, 0x0171e711a5d2fff2, 0x542e7a37c4c152a1, 0x2c8fe91b3ebe611e, 0x94edcca586101228, 0x71b0cb73da6c421f, 0xbb034c999c54d14f, 0x323a0f9c49de5f1b, 0x516abf4b06e2a9ba, 0x77a756436e9d0796, 0x098f5a24be74f256, 0x6a0bb865b23153f0
+, 0x87dfc9d6719367cc, 0x5011b4b67e41ae77, 0xe5ce48ae91419a3c, 0x73c9b9e6e6712c28, 0xf4b15d5d254bb8e3, 0x55adb3ba2847f7ed, 0x8252aa86fdbde25d, 0x3a1af0feca4569a8, 0x8fd1d110ec6644bf, 0x2a53986f5961166a, 0x47f635051d28e9c8, 0x5b1d70687b0b80b2
+, 0x707ba0987182c622, 0x3b52ed9a1be659de, 0x64fac5a180e61a6a, 0x5b6fef61481a30f6, 0xbaf5fb97da38b96c, 0x78535ba807d8fb6d, 0xfc609c7254737a81, 0x7d76d662c498274b, 0x5ab3873573e15d36, 0x4ad7aa238055bd68, 0x30212c6ddabbc9f5, 0x7d603bb3817e7262
+, 0x68fb5ecf0d5e6e54, 0x76e00aaecd07b5e0, 0x903ac5138f2d7b46, 0x14c7adb75fad641b, 0xa55db5243e42e53a, 0x64a06b7135641f40, 0x72360a50df5df6b3, 0x6cf4c0d266b6c512, 0x926221c25f4632b6, 0x494719f939f09303, 0x92f75a0353ca75ab, 0x26afa1fb42e8bb14
+, 0x8e8b96b282f4412a, 0x19ddc20848a0fd25, 0x7d825a68fd5e9557, 0x43808884c7596d97, 0x511b3df6fa87acad, 0x38f4905dc15a3196, 0xb54fb0be19c8cb6b, 0x7cae8828073a54a7, 0x6fa94e7e10f97cdf, 0x02f5108206cfe1ef, 0x6911caae72c946db, 0x72dfe3e03771fc87
+, 0xc2effbef654d746c, 0x174b1e9fda0781d8, 0xc68994e23fe81273, 0x79fd5158828ed4de, 0xae373c537b2e188e, 0x07b9011ab5c7ac11, 0xf9442e6c3aba6e61, 0x7b2849ec8a8e6c28, 0xe6639fad4acd51ab, 0x17c378d82ca9752f, 0x33f19b3e0e3583bb, 0x1db92c1568f35e7b
+, 0xe8efd9c9bca7e7bd, 0x41e30f8f264d3c37, 0x39e0a3010e1b3b62, 0x3375b762928a2f2e, 0xcef5bcc0e6cb28dc, 0x44b254fa8b9bf672, 0x4dd4e27d43f5cec1, 0x17f3b4b26aeb54e3, 0xf74be8e3307cf6fd, 0x577521e5c08eee65, 0x6dd781bda9cd29ee, 0x0442d3963dac7cb0
+, 0xda473ad73a979acc, 0x21796a874ae69b31, 0x566b187811ee91d3, 0x74c227d1f8c9716f, 0x108109710133fd56, 0x14f9144d854b14e5, 0x96b8fa7a2d60f5ba, 0x64046d9614c8f876, 0x74ce255ad51706e9, 0x7cbeb9a528b98534, 0x6606610edda959dc, 0x7931bd42a586561a
+, 0xb46b2eab2e01b452, 0x1f956a507de33359, 0x1b28bb67bf51b0fc, 0x228a54172855e0e6, 0x81648f09685d8d6f, 0x58d7dfbdc945c599, 0x4ce5b79833b3ff15, 0x2378f86e72138f20, 0xbfb57451f6a5b407, 0x336f201527afd6cd, 0x966c663b7db903e8, 0x6bed646bba99a4d4
+, 0x68626c40a259763b, 0x1db65395c88d3f63, 0x87d9701f966340bf, 0x7d71b43f64b2f2f5, 0xb59266fe9f242eee, 0x2ff5fcf8a4ff6aa0, 0x6a7d7260fa133a58, 0x0189c311c6256b91, 0xcce65acc2068f2fa, 0x1572e093ebc9e51f, 0x6709643bdbfb507f, 0x09a6943e6f1366ad
+, 0x07018e6bd9eb805a, 0x5b756fc6351da7ae, 0x5068194285eb3191, 0x0cefaccc64d41463, 0xeb2c49f0f1f54276, 0x3bb07088ab52a7c7, 0x96d15a116818852f, 0x20fa91786c6275d2, 0x1f4a162dbc0e185c, 0x4fbe2eea3b051bfc, 0x7f312333e8b61c34, 0x45c59e5f5b88ecbd
+, 0x8f2b287b1eb3cf9c, 0x592f8b27e9a8b06a, 0xacc8b6c149f8b200, 0x62a16fd53e0b9e50, 0xb78ed153f2237dc9, 0x7595b378ea6c6bec, 0x71401833bfdc82ab, 0x491117a7fd30b98b, 0x52f8ebbf28f4f220, 0x7fa0a4f243ae5d63, 0x158af95788712221, 0x00c4b4092b7f7dce
+, 0xb3c15beee7ce1c0b, 0x75756b7060c327dd, 0x3630d38cb0ecf174, 0x20b78a4213d6c90e, 0x1472d4beff1888fd, 0x06fe1fba2cabc03a, 0x1434a97c0bde2d44, 0x4587cf84aa6973c3, 0x90e05a5ac8aa843d, 0x30d0443805eb0adb, 0xb60a0715500a0a71, 0x1bf786bad3d692dc
+, 0xb2354311bc99403f, 0x4ddba739e09ace7d, 0x5d79fc9992c6ef6a, 0x44486d8b565a7640, 0x5087e7a554ad3b05, 0x0cbcefd69eff3a73, 0x30307e4eaed94561, 0x2ec7d2c8174440fc, 0xdaa2913edf7b7993, 0x4d9d6d533cc02d59, 0xac96bb11e0364be7, 0x42f893ba4f0c2a60
+, 0x0e3f37a9d878d73d, 0x3c8e8a53f02ab0df, 0xd745ab2bafda66a5, 0x0503133470a60849, 0x8c9e59409df5b650, 0x1eab24209a9151a5, 0x04bb774fe6a2a1be, 0x5a2a5c229919870a, 0xfb5a076448265127, 0x3a6a89b82c710af7, 0x031cbeefea187cbb, 0x76a5b879182b8237
+, 0x67d931dc0994e4be, 0x2c917b760db1c448, 0x5bed2295acfaca7f, 0x488759c03cc28a28, 0xaaa4f133a1aeae9c, 0x42841863d6c55daa, 0x2efbd3e932ff31c8, 0x5032d67e9cbe47c1, 0x76018010f994778a, 0x01d0068c51d979e1, 0x50c845b44b8a3e22, 0x7f8fb10d2456f503
+, 0x4805e21235d1d747, 0x2d7361f03946b5a1, 0x430680039f0136b1, 0x0689719e68f44bbf, 0x93d8fead5a43350f, 0x02367dd50bc24385, 0x3943b1a40b2b0dbd, 0x0663c315f91ec122, 0xeff2c790874b064d, 0x02ce52abe89ccae6, 0x1adf1e35cbc66397, 0x7c1d0e78a2ec32b9
+, 0xcecd40174049c53b, 0x281f7dd77699fe33, 0xa38d5517758ebaa0, 0x43b3813afb136d29, 0x3c51385743f59c2f, 0x1d2b1bbda4824867, 0x0ed6641bd7f49a02, 0x1f990121bca55910, 0xb93da3937a346e1a, 0x597bc855943b9e9d, 0x0948488cade182d5, 0x29fe269e295f54c1
+, 0xa223da031129e76f, 0x67579a97f7db1689, 0x041766151c91d673, 0x1591e07753ccbc22, 0x194d28926b67b8e7, 0x75ca029abde12fb2, 0x9eff3fd9893217bd, 0x3e379f208e550af3, 0x0fcdcbbc05ca24f4, 0x12a41b6b8d98dd86, 0x0eb915f2925ae481, 0x2e9a4ce2a36b9849
+, 0x7de82bff4911bf44, 0x5b1ae86c5bb43470, 0x9b53d55a337f7c14, 0x3eb15aa04f82b2ff, 0xc757c5103b421ee4, 0x526a35c285d61b4e, 0x5c506d929b17015c, 0x142544ba96413e35, 0x448261da8dab7eaf, 0x3144601bc79de566, 0x3733d8e0a9838a87, 0x37756942ac0bb4d3
+, 0x7fd9d4d10bfd8abf, 0x44fabcf22d7ff082, 0x81d49418a812665f, 0x1bb8edd2c15d2833, 0xd42b61273ef993c4, 0x3752f90a7c8232cc, 0xbd4e7fb306cc3eab, 0x63ed3687c57bef5e, 0x20576f752b79d3d3, 0x5c331c4d0857dc53, 0xce38b43f22382cdb, 0x0572e42845741f70
+, 0xebadc65c34beed76, 0x5316d7905587e698, 0x0423f61e33ca5906, 0x4b59f69de9bf7813, 0x3e8b706324039ff2, 0x2c2ac72e1409fb40, 0xc7e61e943b7c2220, 0x775ec887fb0991ce, 0x53f3b884409a8a72, 0x77e9b273b863972b, 0x375f5c87ad7c3334, 0x7713fac7b2c0c36e
+, 0xe31fd17059182056, 0x60dcd0fa4a2dae6b, 0xa4c5ba3429dfaa59, 0x4cb7aaf4563eb7c1, 0x4822450ffd64fa78, 0x7c30cd98b34e5876, 0x44e563d52fd75e47, 0x695967655e170a0d, 0x4c3bbefc36e651fa, 0x71d454a97c903fc6, 0x5ab9e5f9e4dcaea5, 0x0867e126e1d83346
+, 0xe0ca5ca8842bd940, 0x64318ec5ede91a0d, 0x6ffc2c10470e0573, 0x130b5a850dc44fab, 0x1f1282f5c6bbdae1, 0x03887dbcd89c3c38, 0x84a01d699dbd5aea, 0x024c92ab17c4f372, 0x57c513971b60b5d5, 0x398590b4df45a633, 0xcd156a84a1372a0d, 0x613a508c0cf55a34
+, 0x86ece96e1a3c9339, 0x0e67b54b675f3376, 0x27cd10f2654e641c, 0x296bb4c3c4822a74, 0xc455a104492f34a3, 0x72314e026b852e42, 0xc225f1e7e18cbb16, 0x343db8691f7f1a64, 0xf976bd5c1d53ec57, 0x03d6282ee996d811, 0xe52ded25c0fcf1b6, 0x456c830b5106004a
+, 0xb309e5eaf3a0b2a5, 0x2b9ce495646932f6, 0xdc7c0d708f46de2d, 0x3caca83f39f3de9e, 0xfa1403879e7adfbd, 0x1f4af95b859da392, 0xeb9d2cd68f004057, 0x6ee1f79e648dc093, 0x935711ec94c375a8, 0x593cf0e4b96d27d1, 0x4b7f5051e036a5dd, 0x2e3ab5d3c2a059ce
+, 0x9224a4a40b5587bb, 0x12fe568ba3ae4dc0, 0x914f7ef9d3ddb2a2, 0x45f87cd42003759c, 0xea0cecbddd807b23, 0x346035eeaa1ea543, 0xb4edca6beef3b8ef, 0x7f153cf5a9352f8c, 0x401d269a0c3b307a, 0x572ab8265637660c, 0x292bbd38b346081a, 0x3287af2db2f59bd3
+, 0x67daaf0ac7784d72, 0x62b4406ada03dd51, 0xd71f71c64c9e421d, 0x589f278a23b6f592, 0xb61c1fdd2d7dfb23, 0x66547c1a2df0592d, 0xe764886f4f8442c6, 0x4b6d17dc66913c8b, 0xed81242fc8ffd916, 0x7a93522c7de0eb01, 0x4f7c773e61b5b0b0, 0x232381a4874289fc
+, 0x71effe68d61ddb76, 0x26f389ae9a3bac54, 0xe847192490236e42, 0x6ddfd3937681b717, 0x844d4b7c3f2b2f9a, 0x172e38129bdecfa5, 0x342091b74eeb7ff9, 0x5ceece2573738556, 0xf7bf4e812cc1c5a9, 0x3c509db2d6315ac3, 0x5fd504d9260ab627, 0x222cc0224bf6dcbb
+, 0xd2999a22f40768fc, 0x2fcb353d67aa4844, 0xcd41a8d7007f6918, 0x062eaf2c3832b660, 0xbe4de4f5449e5538, 0x6d0c665c659b9960, 0x389705b3e09dcce5, 0x64dfbc76e037a831, 0x6e78f34f8073dca8, 0x1a1f2106a98ca510, 0xcd2167e11844a630, 0x06793b8e2277f085
+, 0xeecd95c046e6b3e4, 0x60fa04aeefea69b2, 0x74c71bff5c5f31e4, 0x010d485e3b97f408, 0x51fb1a92122f80a4, 0x6e2a6ef83747b265, 0xc523bddc50c40378, 0x1e85e2fa9dba579f, 0x236df7e765b17318, 0x47fc8274e1e13c5e, 0xdf7fcee6c0bfbf82, 0x0c8b94c47bd85ec2
+, 0x0f0ceabd979c65ea, 0x69e63aa4df928ac0, 0x7a271428d73bfa45, 0x0c1b76c3b5a13883, 0xdb6dc030f0249544, 0x11b5475899cd09a0, 0x6349c1026f4fc27e, 0x0c9a05d9e6905836, 0x2415ef8ca498d24d, 0x1af495e7a6d67931, 0x7945942ded23346c, 0x022c927ad2f2d091
+, 0xdd2e2617d2181dda, 0x1550bd021648a073, 0xb44982f48ab2f325, 0x0afc152044840c9a, 0x5e1c7908e828ec27, 0x788613bd14a5cba0, 0x5eecf3349fbdfc4c, 0x3cc7c7d2de4a4606, 0x7e8cec086135d385, 0x67b603d87b490d73, 0x3b83b705cf9fa7cb, 0x473318e5e1dd3c9a
+, 0xedd240a2beb6091a, 0x0e5c2b7e87c1cae7, 0x289c4ca2861b9ecd, 0x7fdf3854b542e4a7, 0x70b1d9ed08f1c4a1, 0x105a6b405c16fa16, 0xc3aa3f72aac544f9, 0x441cff2158fc1ec0, 0x608008a4788de939, 0x5b348aef8c884392, 0x0b3b1a9beacad307, 0x4d957236a919aa7b
+, 0x37a1c7682043da49, 0x1087fcd55005c924, 0x6e4161f9a5f55459, 0x0e472842805fa43f, 0xb2868eeffe334b95, 0x4c4573529e836a25, 0x565b5021cc32e52c, 0x363f6201a304c967, 0xad64f742c2991cb2, 0x29bcd65f2d6d03db, 0x460307b004eacbba, 0x007c29fe83f2b21b
+, 0x887a29c0c6668b2f, 0x153d52ccaf095d08, 0x1ac0fab5086f029e, 0x65ac7016b79df97e, 0xa0abf9c54d591d9f, 0x6dacac61c9ff3a9e, 0x5530f554cf98b1bf, 0x2c8ee5a4d224fd0e, 0x65c6a5ba302530f3, 0x71991471a212ce14, 0xcc77a5bffdfe1439, 0x18c82c284f35db2c
+, 0xa720e9d1dbd2fbbc, 0x0be083ee67179b76, 0xef641185ed7af9f5, 0x129b41eb4e0989f1, 0xb9953475851f99b2, 0x2c2706814b71d416, 0x227cdf74829d67f7, 0x70aa6fe0e3ac3324, 0xb9e094f9400ffe35, 0x5f1b27666e87aa25, 0xba65716a60f1f7f7, 0x500f193080f58511
+, 0xa01da56663982b89, 0x60b64d6cb955182f, 0x2a003d79d1702d62, 0x609d5bbb7dc39144, 0x3cadb1b806da6920, 0x557dedba446d8614, 0xde432a7434cb3063, 0x07874b275c259f4d, 0x19289f3851cfc368, 0x1103c4bb68dba61d, 0x9af123ab34485df0, 0x421df7c822337461
+, 0x432378edb270d080, 0x56d78a73fc8aa880, 0x2f0b835064e58c2a, 0x274ba0f387f4a1fe, 0xc6f21892a3555843, 0x39db7539019826bb, 0x32f8653a0f37706d, 0x4d682973d6b04b02, 0x7c31fe8c1ad6d348, 0x3be7c86b35753cc1, 0x38d57528211bb0de, 0x7e0208a8707ba8b5
+, 0xcbd3d01634791e29, 0x33deb25beb87f191, 0xb55cb555b432dd85, 0x30621c04fb03b094, 0xdb54b8a4f4e1bbe7, 0x6e36abc52eb9ee51, 0x8631f14abd43f9a7, 0x6d4c56e9042661c9, 0xaa68d656b2e63e72, 0x46660d3e0e869126, 0xb56286595a9b8036, 0x19a09904632c705b
+, 0x929853873287e3a1, 0x4010659057f02ad2, 0x6acba6cf95ee7b0c, 0x008fe1bede963d34, 0x07b2feea78bc8588, 0x3b397b9ebf30b461, 0x7058db1dd629b9b0, 0x59406ef60c678af0, 0x9f7f1a8edbe7dca3, 0x64f417a5707335ba, 0x4d5d8ddedbd0a688, 0x74e1f8e0fd73b49c
+, 0xc733aa235142bf92, 0x1e8e847c23ce06da, 0x8825aeeb3d48153b, 0x4fcbb1517fe2e0b3, 0x17023aad4f06b3b1, 0x1709c7b91e17d6b3, 0xd707976b7994e72a, 0x2c3db28fa0f752f4, 0xd3cbb2ecf40c1fc6, 0x2c54d14cc73b62f4, 0xe14780b20f8d8915, 0x25718755c41955dc
+, 0x6ddffd992e3b62d9, 0x1e384a293684c1e8, 0x58e042b3b9924d62, 0x09d28c77b4ccaa7f, 0x0aef2afd0f95a4fe, 0x09d46f3384ddc139, 0x4d11d009040e0ec9, 0x294d9e787dfb53c8, 0x002e33ce230abf85, 0x116c812af8f303b3, 0xb2ecf43568c60f2c, 0x03105882a048ca6c
+, 0x855189b67507943f, 0x173d3d53c804dae0, 0x734132b513d5d2d2, 0x2f3d9ff56c05fba9, 0x8ab6b39edc5c5b71, 0x3dc05841f88da6ad, 0xbf3287bc10c24bb9, 0x044a5d0d99a47d8a, 0xbb28ec763e14588e, 0x4efa444231e4c508, 0xaeb75fa04b5ea439, 0x7927484856eecc86
+, 0xade22c7dfa181ecd, 0x1f00a1b1cdbef9b6, 0x5a22dc174399d79c, 0x260877604eceff2b, 0x0f24b6f01e600d67, 0x422333a136afd79c, 0x45f8fc7192cd34ba, 0x2b9c72b94b7cd5cc, 0x69ae5ef34f61e15e, 0x14b810b88359ae73, 0xd16b0fd940c5ff55, 0x0b32bc9deabfa35e
+, 0x161ecb4f6cdb8c7c, 0x12e9823dfb8f1d3d, 0xec095428af2a78c1, 0x231b61b829807655, 0x7c78371e4f95f6d1, 0x0c2b4b9b7d12ed53, 0x888fe969cb7ecf45, 0x45069131f54438bb, 0xcf3e20c6d4bb2170, 0x173dc5e1caea6871, 0xc17499fe33dd6458, 0x788ccb33f32fdec5
+, 0x17677731865b99e1, 0x7e5c63ad39499e43, 0xc179b685e5f37de6, 0x7e682a6c1a9b9662, 0xdade19bb0d094fba, 0x0767313b5bf13e40, 0xea753945ea235038, 0x691e52efd12b232a, 0xa42a5300bbd25c98, 0x571e4acd5517d716, 0x68059e2623720003, 0x1a0bb1e5f1e1d5c5
+, 0xccd0ad76f28ff6e8, 0x6523b31edd821659, 0xf6259a691cd46664, 0x2934ee21c05ecfa3, 0x364983bd5ec09412, 0x7f5b7c4812654ee0, 0x1d9a3ce17849175c, 0x26e5a7fb41608926, 0xca3fa2b48c4b0ac4, 0x69d517ff9118adfd, 0x290776a67a5c578a, 0x024113fc34b544f9
+, 0x5d12ed9503ece3e0, 0x481bcd8b1233722b, 0x4b7efe6df2e2540d, 0x05a82c41eb63e630, 0xbec2c5464e897066, 0x6d4da7caaa391d08, 0x0c39e8051454d8ec, 0x34b3440476822178, 0xac1a16eee21688b2, 0x0948da9ff13502e6, 0x1a0e33df85229d7b, 0x0a2f1c94463419fb
+, 0xa0250f8805bbcd62, 0x070b0edd1e0c8b61, 0x48de48be1e6f2d03, 0x7563023e8767827a, 0xb1aa869cc8aed430, 0x5f884612fbc601d0, 0xc91dc91e5d2dd34f, 0x3c7b94e68a9f210f, 0x1835a35f5009cf16, 0x02c118954a83e140, 0xf7e7d45c6925099f, 0x3c05d03368322872
+, 0x3999b476d42c7a4e, 0x1d83513b0394369a, 0x8d20735db4876c4a, 0x6a70706c2353a17c, 0xcfbbc8742538ee52, 0x7ac9c7b46e8b59a7, 0x37ba61629368cfd6, 0x242d4bf7530a5b8c, 0x3bc029970796efeb, 0x29184006d5a684e6, 0x91172545ad215feb, 0x6f9fbc1c70ef111d
+, 0x614eb05d4a0df453, 0x66d17bdf277bf752, 0x19cc26d3a043abf1, 0x436151f5557a815c, 0xba91dc5655686415, 0x1424128b7d2f0254, 0x21ec597a85799508, 0x79a34bdfb3ed8b2d, 0xb498297f56000ca5, 0x393b97baea851acb, 0xfa59c1b9cf5d3ac0, 0x4626f8d3c3718d99
+, 0x5d4c4ac54038297a, 0x0250146acd906cb4, 0xea67dfc9e53a6182, 0x3ec78dcc7878c8f2, 0xf383b2ace7ac2bbf, 0x6a06fce830d338de, 0x38ad6048560d5a90, 0x7d9502b043f1c226, 0xd2dfcf85ee2b6629, 0x50fe2b70173b5eb7, 0xa0cd0c797b2a9e88, 0x40957277af327026
+, 0xe47653488cc7f765, 0x13ececd2b9c703b3, 0x615d4fab41bc1d7d, 0x0dbc118e42599d81, 0xe697d971cf63d62d, 0x163c4cca0672c923, 0x70f34fe578df62cf, 0x470cb57467217816, 0x8bbd2902d448d347, 0x3b8d7dc01c69e825, 0x93e04d73dacd1dbd, 0x190c0ab1c36b943d
+, 0x6719879064c59043, 0x39e2aac1121812ab, 0x93168f8de4ba5142, 0x097e01612e338a17, 0x6adcfb05d86e1273, 0x06394ff2f0a9b284, 0xc3f869bb4377e29d, 0x6c0e45bf5e85edd4, 0x0e9f799958410f86, 0x109725a6927c49fe, 0x435cd4b41549e1da, 0x0457fecd6ff21802
+, 0xca890aa2b0320446, 0x5efe6877cc914f89, 0xadb46d29186e5f91, 0x2fc5c518d9a0d45c, 0x2a86b6203362f0c4, 0x6789b58de46ba6d4, 0x37ecdcd4979ed15e, 0x3d67bc2c17e63c56, 0x198c6b0940f4e131, 0x637670edecdaf3e9, 0x80f2959d6d5922d8, 0x2447dcde15a62178
+, 0xa973ee98113387ef, 0x660ad906b2f03a3d, 0x7939fcdbb30d0b6c, 0x1718b28aad1ee910, 0x52d12762e6fe81dd, 0x039a13cc942ad816, 0x22865f225f8dd773, 0x665bd584e3f55e8e, 0xc61e4ae164c31c6d, 0x4c8cdf3a4e21f00a, 0x96df9e0907e2da80, 0x566c012c2647a890
+, 0x2fc1a8a23d93f5c6, 0x1bb85841fcdc299a, 0xf6f96db72c9aeb57, 0x71df58560ac75eb4, 0x95e9163c97b678cf, 0x5b91c6322998871f, 0xee3fab9ad21f6d3e, 0x482583f333506eba, 0xe19d925dae95a921, 0x38dd43eff8228b6c, 0x24fa9663dac3a407, 0x1cd33fb41a29a129
+, 0x9c457b53a2870f0a, 0x56020a1c95823acb, 0x477d49d20f1c9ced, 0x040ffa0954bd6aab, 0xa4028a5965275064, 0x2cf309b85259fffb, 0x12ea7aa9f249565a, 0x6c82048de11bbbd0, 0x35ca82bac969b348, 0x40d78d529bccd84d, 0x0b79c152c61cc050, 0x15828a1d61bb90f2
+, 0x4d07a6ebd943ab29, 0x2156989c5a8dda9f, 0x489592bcc283339b, 0x384ba073e405ee12, 0xca0c250ba43f30d7, 0x6c7edcd6b2917220, 0xe73b487eeb7826aa, 0x52a1b99e91bc03df, 0x1c6d9cf03a721564, 0x7ded3d36b4d340e7, 0x123fb71ea53743cb, 0x2ed9918f9f2755b2
+, 0x82a120b84780f4e1, 0x376116146b034d88, 0x02e2258b2e22f9bc, 0x130e8de882fef7ae, 0x2d74a2a05888b3a4, 0x2c168d22812a7303, 0x69b6ec2e12e97d4c, 0x384502731adf6f24, 0x629e7065ffe7d15c, 0x3be52479b1928ec2, 0x338b63a5d85f0526, 0x49ef4be7751d5c70
+, 0x36131f700189923a, 0x5fc7c8cbb43c80f5, 0xd22ade4c2b5bf151, 0x77fee03fc4d69149, 0x85f722795c235ce0, 0x4425a6239e19e71c, 0x302ef623025149ac, 0x3f215d5a56870440, 0x0fa504765af3002b, 0x409369e77f3c484b, 0x4bd7316ff01a0d61, 0x4baa3b90765d93f5
+, 0x456266dbd47bf150, 0x34dbe3113a9e9c18, 0x8b76262013f48316, 0x14fd8088a37e40aa, 0x75b4dc28558816e1, 0x3c4cca6a692bbee3, 0xe4bf22107568a003, 0x0797dd5fee1e23c0, 0x4bb41e093ac5efea, 0x0a4af48ccdee3cdb, 0x10f0ac20ed552e17, 0x5b147c3bdf365e82
+, 0x771ef0ae3a758104, 0x3a98e848d5905b95, 0x2e5a68c1415d2b60, 0x36a94e88e178dd73, 0x6f07b824725f00be, 0x7eb351457d91869f, 0x4e9ab9fe03c10b65, 0x76542ee8275ec623, 0xe000effef91efb2c, 0x460119ea715739f4, 0xc863953eb53c0e68, 0x1f1c9c123cc775c5
+, 0x5d046f84ded21518, 0x31591a7a7f9d601d, 0x62eb40b4a33c8d7e, 0x7f5ae44385406424, 0x683f06b070998d45, 0x569d0f597dcca629, 0xb00d4f89a2396905, 0x3a287a9f215aef8d, 0x51e202c8320c84a5, 0x1907dddbbafefc5a, 0xb69adf3afd9ca302, 0x6f8902efab14c0d9
+, 0x668c2d0e7f45b9c0, 0x4b3f439759bbfd0a, 0x5fbac27e76ba0239, 0x1335b9d7c02335f1, 0x68b4e826b8110eb8, 0x27b2b15ed399d932, 0x278d8b208a36194a, 0x0c47248907cead76, 0xbdb4ef87d64704cb, 0x5182d3164f3e2870, 0x5f2013505fd7e5a6, 0x3c8d30903e3ca4ec
+, 0x95a20010fd4cc23e, 0x3d11a82ba2e3fb2e, 0xa5ba569f503e44e8, 0x7825ffa0e56a4963, 0x857f1af5936889d8, 0x565ebab469da1ee4, 0x155ffcbe3771bc2b, 0x7576c85c23941b2d, 0x7154b8ad8637537e, 0x034693b742baed44, 0x6cc62edbaea6bed4, 0x4e8092275160b558
+, 0x094b2d4e6a311285, 0x50602e78a6a132ed, 0x9696215c3606a9ad, 0x3a857027ac0569ca, 0x80973d0183d42963, 0x347ae7feec2e8d8a, 0x8e6dac76fa1c851e, 0x15af7cb81578c892, 0x988729bafb654191, 0x4774e4f8b7e2dddf, 0xbd1aff7ef3523fc0, 0x762cdab539b97f3c
+, 0xcd415d5880c4af1f, 0x34685daf28f9799d, 0xebe3142489ce315e, 0x70dda80da765224b, 0xff212f3e7bd10b4f, 0x04681263fb0d55ee, 0xd129f91e04b5915a, 0x5b46cd9bdea2638c, 0x786003bebdca2cef, 0x7954e92154b854bb, 0xe4b9e03bb900f59e, 0x2c9ea9d28addfe34
+, 0x9f0be4b87ad971d8, 0x76ca12c1160292a6, 0x437d53fe586778d1, 0x12d0f89d3abbfdd0, 0x706de2cee6b07a77, 0x4fb16733a82aecd5, 0x70672e7d6c27950e, 0x119797bddff7daf0, 0x70b603797c067f51, 0x6066c0177b6fa3de, 0xd3cad3b69301b493, 0x0bc5a1ee3ec3aa83
+, 0xfd2750095cf907e4, 0x0236bd5e3e13fbf1, 0x620746669bada3c8, 0x33d3c0c2c5931cb3, 0xa68832f19b09392e, 0x1e0f19a0bbbd35ba, 0xc3a4d60898311a9c, 0x2da70e8b43fc2550, 0x2fb2e4cf447ac9cd, 0x7f331d87870a02ef, 0x0d7bb35f3bb0d1d7, 0x293f8b920d15f94d
+, 0xd34419096a4fc852, 0x25ff0f4fbfb3ee52, 0xf2e20216b02f72fb, 0x0c0e892e7545a32b, 0x556619069611b98b, 0x610bc9daaa2537e1, 0xc8a924169f6bda43, 0x72af8695f3c9cd3b, 0x91acabd500b65f18, 0x7b06af5bec454fbb, 0x2d60127af5d5529d, 0x7b00acd381b99329
+, 0x384306ca525ec71f, 0x04e0a8349f03f94f, 0x471fab01d52cec85, 0x51531fd53d0367e6, 0x59e95ae88a3dc1cf, 0x456d0fc14901994e, 0xd66909711fbfe0f1, 0x284eda5a3d25251c, 0x83ddcee68a8ebe38, 0x3c28e39b327c2767, 0x93e70e9faaed1200, 0x432a17aa1d26e42b
+, 0x4cb0c13d196bdb88, 0x0b17195940974062, 0xde82bc09fafe1c09, 0x284917315f89889b, 0x89b88f30112bde1e, 0x11948e6881abf2cb, 0x122b5a04644c9819, 0x59e131b291782feb, 0x85b2d423044fe0fc, 0x2a30e769b818cdf8, 0x3094fe3cc1026896, 0x6cfcec8845e47e31
+, 0x1e0359e885eea0d9, 0x3759ee60217ebbf8, 0x94a52a5e10311900, 0x0f08b41de4a7dad0, 0xb95cd1c9246310ef, 0x6f52918daa3990fa, 0x95ec105bd2716952, 0x68119ed7882267ac, 0xe2e8c885aa2f7c78, 0x17ccd000d373f3ee, 0x989010df94ce4a2d, 0x613ea73ce5bcd096
+, 0x4f4402284df1a833, 0x597fd2dec4fd3dc4, 0xe33e7b7b8b83e7bc, 0x5b7eeda0943d2fdb, 0x0649ba77fde58933, 0x25d599ac5dec9e77, 0x1a35905290952a3a, 0x7a8c96b37c5e4dee, 0xc765a25a5a27ebcb, 0x22f3e224a33ac09d, 0xa3885e6a7e4caf31, 0x6bb721056b3ae49e
+, 0x3843391e032eb8f6, 0x72e523ca276dee1a, 0xe096703d28f22bae, 0x3b525e53966ac38f, 0xacf84b5b21089373, 0x28307a3f795679de, 0xd4e7077940b6b6c7, 0x1e39629a7498091a, 0xd0f18484f21c43a1, 0x572639b05eb25411, 0xd8b5742d0655b191, 0x4216157db1c8bc60
+, 0xc53bd87826c62664, 0x16e6127e32a4afd8, 0x3874c698248ec662, 0x6f323dc076ea1451, 0xff07204cfa04a649, 0x4bbbd36c60f06149, 0xf7062561c35c8e03, 0x47de688365427a9f, 0x3b4136a46a978907, 0x1038b6ac4a5b03f9, 0x114f6e6ddea00729, 0x292e3f83669555f5
+, 0x4e8db729767c5e23, 0x0115edbd50f7dbda, 0xfb8d96c91bf5ff52, 0x333cd5f73dd25520, 0xd0dd8e55f67479ed, 0x5e1df8a40b3aeafc, 0x5cc9e95b092ca205, 0x07963f2e4a7ca74d, 0x1ee808780ec026a8, 0x63911ac7eca5b329, 0x7bba4164e2c31fe2, 0x3a81a95c29ccba6a
+, 0x7060a04fe204e379, 0x6ae52eac851ade68, 0x7777e3c0092cfcdf, 0x01bf3482bc28bf8c, 0x5f72fc2656b3d8d8, 0x33c9327fb58f0661, 0xa1cbbf14a25b314e, 0x48404446a2f25166, 0x5653cf3587645afa, 0x7815eff98b3e8183, 0x4430da7219626da5, 0x59612d27ae325222
+, 0x8b00dd13535a2566, 0x445a6709c50af440, 0x364fdfdb2851a227, 0x1ae773783a56b6c3, 0x83bf7265466c52bf, 0x3826862fa352527d, 0xdfebea2544d4c9d5, 0x0f8894ee16c3a257, 0x738b2ad19f7977ac, 0x4f7547fea36a4462, 0x08f9f57f6ff2cab6, 0x4e92c22fa8d9cd34
+, 0x3bb7866609d849b6, 0x50fe467c78903655, 0x7071b15e59ef8a51, 0x7223272c4dc9618b, 0xc0ba2f5637b617e2, 0x65cd2b6200937021, 0x8e6497553e077928, 0x4e0d1bda86353bbe, 0x1684db6a8cfdb046, 0x5ad37e12dae9ea03, 0x7bd00ab2f8e84292, 0x521f9b3bf8ebe189
+, 0x0a12e27258a7b440, 0x08dd61d4e70bfe6b, 0x99852ddf9fcd76b2, 0x3d1ab6887d7d1e75, 0x00dd5f77347719c2, 0x451661261ccd1825, 0xeeea0b1cc2b800a7, 0x136b6f3764a8c09f, 0x1d2f31413b73fcb2, 0x48e07d1dafb28513, 0x6041e7206e68e618, 0x595a0c981f3c1b0b
+, 0x791082bdd0cac373, 0x74565d10667b00cd, 0x585c39d03a535978, 0x48de2cab5316288b, 0xe6b43fe2e2e711b0, 0x55ed67737fdc5a4e, 0x1094ec964a577aaf, 0x6cd9ee79780b410a, 0x1f6b3ac696b3799f, 0x69d51baa68c0ac8f, 0x5d7ad985fc64b07b, 0x1bbde1ecdcf688f4
+, 0x1840b6b676b918fa, 0x0a22ea5f6002ea60, 0xfad5be8667a0cf00, 0x7a7a8ff71372b2d4, 0x9b3989ce8fe97121, 0x4f0ab86110d4368b, 0xfe88d475ff762ca4, 0x224f095e98011179, 0xddc9bec80ced5cdd, 0x2f93888a81dc33df, 0x984ead2834b5b4e7, 0x5b077f04d5a7eb22
+, 0x1ad2660418e47a88, 0x6923f1bbc860e70c, 0x0a16e3aac399d43f, 0x5685579cbddcf8b7, 0xca7671d5e1a293bd, 0x033a95627bf576cd, 0x7c29673caf1491be, 0x78d8aa3d73b97283, 0xba96bd8a8ca1f957, 0x0ceac55a774ed137, 0xfc1f8a56e42e96ad, 0x7e6f716e79deb5f1
+, 0x9d10900439fd7cca, 0x53019f15123bd2fe, 0x264413a43d91e526, 0x724707affb3340c9, 0x5d0a3f6cb28282ad, 0x090caba7f7215aca, 0x0561f03e173aa1ca, 0x2f4b9b1f33ff98c4, 0x68f37724798c6b7c, 0x6d8629d3bffa87e2, 0x9b25841c2ac3d855, 0x604d4e03ff0cea3e
+, 0xe448ae76bc2960f3, 0x1cfb2e5e655cf76c, 0x23ce8c10b3003eb0, 0x1b744ea7f4fc14a7, 0x49f21e3196fc17e0, 0x1e88ddf875cd040f, 0xa1209c772db6fc95, 0x494c21e56ec9214d, 0xfdda59bbc89333fa, 0x5272a2bac48d9d5f, 0x552c3759dc0a68bc, 0x22c252d588249c9e
+, 0x3024954ffb321532, 0x140b49fbfcf44500, 0x7d0e7908e5b1c772, 0x14b94886cbca15aa, 0x6f64318ab2a1e93d, 0x2cc0198bf0441de6, 0x5274ca01a3260ec6, 0x7a83c22a17e481dc, 0xf8849db570f44128, 0x1149624ddf1e16da, 0xb66323759c6510fb, 0x5d20c4e5878ab2cb
+, 0xb7426fe6ee379571, 0x19cb5d1c4420e17a, 0x51c014b9f29f7b32, 0x596c69743a4a3485, 0x03664bbe5d423533, 0x08d5dd0d2f1d1b1b, 0xe7ebbf0aa2850cda, 0x0fab01a8de24b346, 0x231a6d51df480b4d, 0x3e3ec1f98958af18, 0xa54e00be4e2da542, 0x635644918c197db3
+, 0xf9095e16e9fc3ead, 0x15906fda4fa74a12, 0x47a806679658c5c5, 0x480105d797dbb465, 0xd84a683e83e39a03, 0x106e2b293cdd1155, 0xc8dd6e25feb1d870, 0x1ceb33e155cfcf73, 0x26c21b912e647f14, 0x0e6f0309a9a0077a, 0xc8fe7bacac31fdf3, 0x5ff23fbe14194f60
+, 0xd25e79ebafb4bb18, 0x4a458dde678bbd3b, 0x0efe9dd6f065a5e3, 0x3de57f93de1426fc, 0x616f98efb212c346, 0x1271cc78daa10419, 0xfd5a2dd8c4dcb0dd, 0x5a4bd7048380b850, 0x5597980ef80d72e7, 0x38664bfc5b70c005, 0x8cb65d8953231233, 0x45681e1625986957
+, 0xc2cd6d939d52dd65, 0x0c07cac86f1b6936, 0x89c20a2378dbdfd6, 0x26353ace420f85c9, 0x1d5f2c342935e1f5, 0x48f4026d31101b1e, 0xe0d4bbda350a7180, 0x7088195b10b80ee0, 0x996f1267b2699ff3, 0x51ff34e639df921b, 0x73d64ccd0cd1d8fc, 0x101df177ea7ef6cc
+, 0x3eb09c8527922ef6, 0x73d06a8f6b4e4c8f, 0x99d0884eb804d215, 0x0bba3375a526d7ae, 0xc783d2caac8fc0b2, 0x5766e9ce4823fe5b, 0xd2c8e4b65e3e3164, 0x369991fe52d48307, 0x74c7521b8df2b99c, 0x4f6de2d4475e5adb, 0x06ded5533a4f1f73, 0x6aded578bed7495f
+, 0xae79efdb3d13bdf7, 0x293873a5a5d26621, 0xe415f91926dcbfb7, 0x72a6ec75007c54eb, 0x8a9fcd9bf5c0168d, 0x38daa8acb8141288, 0xa4b906b1a928c256, 0x05e8dec2c7a6159a, 0x9ae0cc48bb5c41d7, 0x4ac5a8178ccd10fc, 0x0bd2464d5e78f412, 0x248a85886f0eb2ca
+, 0x38bd34f292ad5a27, 0x18c44a2e7ed62f2f, 0x7fbc9ce80b123913, 0x14b493c57207eef4, 0x0baac3e6b90c35fa, 0x28100b0d20288ed2, 0xe36edea2971ef835, 0x481d288e2d8a46c5, 0x7248a1d9fbcecec0, 0x0323d5250942d716, 0xe9710e10673ff8ac, 0x557ca333d85237be
+, 0x9d1fb724f22b69f9, 0x638ac2b5bf892f43, 0x004f2219bd8f751d, 0x2e6d706895732a82, 0x4431cd030ddd7fce, 0x6e5f3ecf067fb18b, 0x24effbff715de121, 0x4c240c822ddbb4d9, 0x82339ed43932d96e, 0x72fb82cd59a8806d, 0xb601d6963f59055c, 0x00eb0ddb73bbac28
+, 0xb1ed943e35cf5182, 0x407b9b82876c8137, 0x1fe3954a98691352, 0x39f6f5465747194c, 0xdd2449b845e5099e, 0x6ca41546375478e2, 0xe2370d60680ebd65, 0x6141cd86e2857015, 0x640dfc643fd0803f, 0x29d362cc5973e156, 0x1e0a7f4685464812, 0x57f5f1f415294da6
+, 0x3aeb2f06cb9aa4b9, 0x08dbe27c4505c024, 0xd327f9a21c053d45, 0x6acb9ad495421821, 0x5fd3c78c65c85fe1, 0x0016a1403acc5ab2, 0xb754d6f3de0a5bb5, 0x5ebf32fcc61ff2eb, 0x38979c2487928c20, 0x20f08cf9973bd475, 0xb55e382927687022, 0x4e8ec76e5a2729ca
+, 0x9517d2ae94c88b4b, 0x5ce1f8b22f1eef48, 0xd0f2f35180550126, 0x7526e3cc252b4c54, 0xfd114c05ffd9f419, 0x7aba19671b2eb944, 0xd268870906f1d026, 0x062f391c8ce36ccb, 0x44fa74fcd7582188, 0x12e1cec678eb1f21, 0x6bc961bdfcf9131e, 0x2dc308aa8ef1437d
+, 0xaa33e623975c3f52, 0x471924a977a3b2bc, 0x6fd2157ca83e7389, 0x61db3a723d72307b, 0x7f604b5dc124a211, 0x23953427c61fe775, 0xa451f9a9dd43ef32, 0x7339523d2aae5dc8, 0xf880ad8b3681d770, 0x41cc05d3e04664bc, 0xf4a2ed2967175fc5, 0x37195a8984fc3113
+, 0x62dcd0dca3f6daa0, 0x7e4ef1941f3a1979, 0xce113483df423253, 0x4ee88d778fb87957, 0x26bb29e3a7abfeea, 0x03bfa7da76f9089e, 0x45aa2280a246366e, 0x45d10f122fde183f, 0x777b258cfdc47492, 0x37aeeb0f8821c8bc, 0x3dede8f9aa0507fd, 0x78099472ee5012f9
+, 0xafa9905661930a1d, 0x7379c4e46b432afe, 0x46d2dde0dfd19bd5, 0x04c452edce00d332, 0x8fca8c463e68e052, 0x697310a055c31260, 0xe54ed93f54d7cf7c, 0x578890e777556eb6, 0x06d13876169fb4bc, 0x656f3a6448b5507f, 0x88169ca5129a51a4, 0x5100da65fde82090
+, 0x0f287796ba428bbc, 0x681c09bb5712a1e2, 0x9219dc7afbd3c49c, 0x24c37d15bc2ed415, 0xfb5af982b9828dcc, 0x591eac66967093fd, 0x376e9f0bbb69d1c5, 0x7301d3dc4b0aa569, 0x151b8d05c8e2497f, 0x2d5f72e96bfda3dc, 0x7b90986587c63398, 0x5189306368d7ad48
+, 0x3ef45d6c93180ccd, 0x04e864440303b1ea, 0x3fdfda6b07746fc8, 0x76791f5f6db63762, 0xc14104638ed7f593, 0x1948d03d815cef03, 0x4e5f4258d30e17f9, 0x410b7aedfc3e26c6, 0xfaa2094f1e41329a, 0x7aa7bfa76ace0e0b, 0xd694a0b0e0805521, 0x0c7a8db57692666e
+, 0xf1436efa37541fc1, 0x29240772b8c49a19, 0x7d8346d921f53306, 0x516cb477f50aa47d, 0x3539c946361c09cd, 0x169d9cdd243bea86, 0xb1d3af8fd8b43362, 0x71f29a8cd4f1c059, 0x1a67f695d9da4f3a, 0x0c3a1e3535168016, 0xc7081f29839516f5, 0x2005ce8dfdc3d35d
+, 0x1c8b08d6c59ab8f6, 0x48d7503d47efde5e, 0x497305404ecd188c, 0x5960bd15ee6bb6d8, 0xaa9065ee568a9717, 0x2079c9e38ba5d11d, 0x0740f9928de75eb8, 0x083e8e2c324fac4b, 0x8062e7294d2d33c4, 0x33d630093502251f, 0xbb643e0f8bb372bc, 0x5db3283deb5bc6e9
+, 0xcacd97b9b001f155, 0x6eea5bff35afa691, 0x49590a54929c8a30, 0x26f2337f60b5244c, 0x123a0fbac7cbb8e0, 0x2bf0cfc596a00ae7, 0xeac0c964b2d6b9d4, 0x7ff2fc9ae9e4831c, 0x358759b1dea0e32b, 0x43f2f71d25af5e7a, 0xd1e746767daad64e, 0x2d2e689dfcab12df
+, 0xf3cd55c1304f71e3, 0x1e37321d8b93cd6f, 0xf373e307cea1dd1d, 0x67b76b3e722460c3, 0xfb1d4fcedd23a108, 0x45024676e788f931, 0xe7d04e506b23ea34, 0x75596772e2d6c164, 0x54174def076ed309, 0x7bce5f7930621c22, 0xadf02b75d075fef9, 0x73abb554765fb4cb
+, 0xbd1d5b1986a9e807, 0x676ab9983e346121, 0x7367c53b42127145, 0x40166436fc6d4712, 0xb0affa6f316b42e2, 0x676dedd3cd80ef2a, 0x50a6a9dc04d0ccac, 0x074b48f0c3a46f13, 0xa86068b330a9c76c, 0x2e48b58ba8e01ff4, 0x16d47b1b2304180d, 0x679413d74859c92b
+, 0x658eb8c8a955ba96, 0x10a442dcdf630742, 0xce25763ba480f2f2, 0x234338d72fbb1a73, 0x68a9128d7e9954d7, 0x20dcc447efd2098e, 0xa045551766b21388, 0x610cb54336f67235, 0xc5fa6cf97758cdc9, 0x63733f22ca35975d, 0xe2ffb0f30158bb57, 0x6bf8d37deeb9935c
+, 0x7db3cc1fe774640c, 0x738bc57227338484, 0xf58bf38031c2a6e7, 0x039c7cd28d2dcfe7, 0x7e45d1c5547290a8, 0x0694a23005a44c4d, 0x877a567b1677aa90, 0x286d4a870754273f, 0x7bb75cef331c1dac, 0x7ce72618bc0105b1, 0x20411db8f5791ff5, 0x4a302fff0e6724d3
+, 0x0bc79cc371feef42, 0x6aa810498a4dc2eb, 0x960aab780204a84e, 0x4289be03716623e3, 0xc50d305a50649671, 0x06aba77f227ee80a, 0xabdf74ae22585ea1, 0x7f627035b7e707df, 0x1cae26aa3b773a3b, 0x151e080902c331cc, 0x263c2898c9a46668, 0x168726624eeab81c
+, 0x6f006249351471f7, 0x3204eb91cfe9ed6c, 0xe09af1c83c13afa2, 0x6d70ed88d5de535b, 0x2078873d1a2faa1f, 0x5c73bedb8d96f3da, 0x41bbb407a3a1ce1d, 0x7a40ec2fb54eea85, 0xd6d569cb9dd722e3, 0x10acf67805927b6a, 0x27c61d818cc0ea05, 0x57b175c9f59904e2
+, 0x4f7b40bc92b5a60d, 0x51431f647b46b89a, 0xcd84dd55cc2a720e, 0x6b36059700809a1c, 0x78e3e5dd060e9a0f, 0x630c0c1a146c77d4, 0xc9925b0dea8fee2b, 0x4728f0604b16a06d, 0xb4601050635b2318, 0x2484f7281864709b, 0xbe2ed2a2523211db, 0x6425d4ff23dd3a5b
+, 0xf0868c09017aef5e, 0x2733d1e1adc6d5ee, 0xa631db49f17f87e9, 0x36d753ced54d5727, 0x451d17fb6c4af537, 0x1dcc4d611dd55b04, 0x0bb8de0c8d3e549b, 0x2fb2ca1271592c3d, 0xd877914ffbc31ced, 0x190809a196504d10, 0x44bdd65a970277e3, 0x13195c678b4b01fa
+, 0xe69a41a54f84d41f, 0x61c7c870565e4508, 0xeca2d2fc6f0e1c9b, 0x7f065480e257152a, 0xfaaa9f7c3a8873b0, 0x43fcdb8db58a324a, 0x969a79026e9da7a2, 0x4eab135af328b9d9, 0xb38aaafe87f85f7c, 0x69eba4fe1a6b6f32, 0x5607f6c6b4d27cbc, 0x273072bea774f9e7
+, 0x3c1149e3c8d51db0, 0x161f8cd433c28bfa, 0x765a61f218fe70da, 0x442b5d405f2036bb, 0x96f790271c564cc1, 0x3d5dbb33505cc956, 0x621a38b446af395c, 0x2da978b45bb70ce6, 0x755aca711da49388, 0x46f2e33e55e86df8, 0xfc5b454d5cb7be24, 0x67df47d68d8f6d12
+, 0x7a1e224893898aad, 0x0400219c89c2d13e, 0x6c969e4d63d460d9, 0x4df64d5df8b60ad2, 0x1feed05a45ff89ed, 0x290c4b59e684b4ef, 0x97ffbc3df096adb6, 0x4ac6037e76561c96, 0x1bc40299115e51b1, 0x7169e0a1d96aa1be, 0x43f55f8b6bac596c, 0x1cc6a0603081a178
+, 0x8e1d2db69bc925d0, 0x6ffb86eed51d2931, 0x3ad1eb242e0af1b5, 0x338198152fcd6d7c, 0xc1f381496df13943, 0x05d9242fe1c60b02, 0x39617510de7eec81, 0x24d8ba5ac76b12b8, 0x280eb2db9e548483, 0x6c51317b3a8a93f0, 0xb2a9f90939bd1235, 0x2da9de86c39f9aa6
+, 0x7f54917103127b97, 0x7be2be5ad3276169, 0xc969d703d31e9da7, 0x0500df3bbb1f8a4e, 0xea05c77685795917, 0x049575a992d09345, 0xd567f8de2daabe35, 0x383fad35a8e035cb, 0xb9353eb2bbd43d56, 0x52b3953221860c5a, 0xf9e4bcd46dbec03e, 0x4b0db0b4a7b3279c
+, 0x8cc5f6b6e1ff80c0, 0x1bd2ce464b552215, 0xd008eb25b39c4236, 0x3b4ce5bb2f42a9fc, 0xe1f249681d153d9d, 0x3e022cb14bc4c5b9, 0x8a11d021c8ed5a53, 0x560d3fb258bec495, 0xf4405852705a6012, 0x5c8bccd2b1b3efd3, 0xd93c0f63ba7ce0c3, 0x337798cb3e93dbba
+, 0x7a9f68cf800c8e88, 0x579afe689f3ebcce, 0x7dd41d6cdfbdb4a9, 0x3802410c4e1b274e, 0x64241d770cf0db02, 0x2f7c8133c74bde23, 0xf3c3fd835ed1952e, 0x741b1d88a3cee37b, 0x74e1ae644683c68f, 0x0c80dd9e0f7a91e1, 0x3984d741f3e47c24, 0x4b3eb97b6a39d252
+, 0x32e9b9410da9a195, 0x11d09fdc04ec3b41, 0xf92fd5e53cddea30, 0x296e095589e0ce05, 0x4e3200c3a283b696, 0x7e33fbba44ecb32c, 0xed3c039790ad0033, 0x5c8ebb260b5ec084, 0xa667455bb79d2e9d, 0x12fbec9d4f5bb155, 0x3aa5f6bb4d0d8d49, 0x0ca652ed7065d80b
+, 0xb7938753d51c6f83, 0x41644ac1a602f9f2, 0x84223d4d63c38f7d, 0x71057b4b8b931282, 0xd39fa015165f47b5, 0x7536c8a19c33c201, 0xbe713ca4166c2dad, 0x456c98c2b4198511, 0x4793f25e1cb44658, 0x1d002f1cfe1a1ba7, 0x9f9ed6e1e1a27957, 0x095dece028426bdb
+, 0xe57d3412fc1001d6, 0x481c63a0d9b25e99, 0xc756b6ba0dc02aa5, 0x24af047d79ed4683, 0xe37ac10133b68275, 0x418b45e570802012, 0x87578def0c3900ce, 0x7c5661923b8c9740, 0x5f4ab0a6fdda7366, 0x0ac6100825e4eb3c, 0x308528e42c9e4d32, 0x436e5979933ddde8
+, 0x0cd6ebe123352222, 0x63d1768a46f33dc7, 0x96cc55dff38c9273, 0x474438da7140411d, 0xa184b89b81cf6402, 0x6bf820a3aa675050, 0x3bd4720417391f0e, 0x3f2b8f859a8e0cba, 0xed952561b125da29, 0x07eb1ac74165097d, 0xc3f70d0c7db0a9fd, 0x5ab896a489294a6c
+, 0xd4b608975c20018d, 0x6243b039f25d0456, 0xf766e98fc24c7464, 0x20035c09d2291e42, 0xcc0e5b5eeb462524, 0x24bcba5505f90657, 0x43a98d98e4fa9bf6, 0x3b621ec4188264d4, 0x633472fe235c812c, 0x31a20844a3316d23, 0x47b80db7d7f5d0bd, 0x22d482f5663780f9
+, 0x4df227dc52142020, 0x25076d0624bf137e, 0xcb4a6ee30a657645, 0x0ce469dbb5ada433, 0xfdb06251f65b9c5b, 0x44f82274a8e8f538, 0x98fa4c81cdec4b97, 0x0ccd61d1abb61d0d, 0xb9dc371344c5ab54, 0x35dcd9ccf8e5f919, 0x67fc81f369ba5722, 0x121b5aa1af6024da
+, 0xe0b1b16b0fb1f1fa, 0x4dc688d6d3b1805b, 0x05c187cf10e40104, 0x71af39c743daacd9, 0xe691e97f82acf4b3, 0x0c46305b9243bf5b, 0xb063af137fde616b, 0x4e26e72a1de067f6, 0x61fe66d01a221004, 0x172fe9240cea50b1, 0x4ff50d37b2effefc, 0x06be02ab0b89aa5d
+, 0xdd4aab96717af213, 0x32322555b58a7ffc, 0x7812aa965889326d, 0x1bd608f60d6457a4, 0x2c7b6b44e999e141, 0x113a86a87856a8a8, 0xd95469fc33814855, 0x4a18dc36f6bfd586, 0x0706b60bdb854fd3, 0x4dc356685650fa90, 0x24ef7cfce41f8dcc, 0x19049c3e632deae8
+, 0x5c9a4e28b7138a89, 0x0f0b7dbc1e5087e2, 0xebf49cdc66a362d2, 0x19e4b815e6576c85, 0x1896051ee3b6063d, 0x09ecc741852a68e4, 0x4009034def986795, 0x36b440ff39b4b5e8, 0x9bc2647ee28af1cb, 0x62613c9dd152b3a8, 0xc2018ae5dfae5f2d, 0x29ce5ef30009c855
+, 0x0b653558b21d2b1c, 0x45e2c505d1f74936, 0x48304373240553d3, 0x0528569885a82310, 0xa90d402e33924181, 0x5e610edc23cb9555, 0x28890ae7e007d28a, 0x7e5132b6b1ebae37, 0x0d5252eb7c94cb1b, 0x308ddaea1fdbb672, 0x99fac0b431730534, 0x77d54ed63b9325b9
+, 0x4d647bcb76c6ec3f, 0x0e968b22ec2cad86, 0x4b22b5ec30b08a35, 0x3b31df3b52326b5c, 0xbe84f638dac3105d, 0x7db085f133ecbed3, 0x7a8b694596f2cf2a, 0x67b2e6c15d16e0aa, 0x4808b20bf173011d, 0x25d5fbbfbe66f864, 0xf67f3f3cd9743987, 0x654250e89617ddf3
+, 0xf5a1a7e0ba0a88c0, 0x3616c781799ab50a, 0x2669c27a2d256902, 0x3a8ec380e12fd7dd, 0xa25361f44a418e30, 0x2942f3001d233645, 0x60f1d3b7535a4133, 0x14deaaa12e5c7bdf, 0x0089fbece10c8d6f, 0x4bf7c313757c803d, 0x65aa30bfbb70567d, 0x4fed47af409a3fb3
+, 0x07557dd875d3daf5, 0x36c49c2380e3c9bb, 0xa21f643d329ae02f, 0x6cf6f7474338bcb0, 0xb5df78136a0f3012, 0x031fb2df2e00e9d4, 0x4d86fccbe75e79cd, 0x23f890e082d03b7d, 0x5716a1ffb50a8262, 0x0199b50aa6cf3302, 0x6a1be351f86090d5, 0x36095efc13349364
+, 0xffe752be8ce46920, 0x65047a340b652f65, 0x320ee55fd03156a6, 0x5af6aa45278409f6, 0xa6caf283b1cf3850, 0x4e3a988f61072f96, 0x750f67926b18f680, 0x09fc3f2927d21a4a, 0x914893c2f2ce1169, 0x4d15b367121b3e75, 0x6cb12559723774f2, 0x3ee5b8c2a70e054a
+, 0x7dd9b3518d84d2d7, 0x147d5a5a53f57a58, 0xe1bd0904ad842a05, 0x3a0f3b029c9a5845, 0x7153c03261410074, 0x4e203d6737058c17, 0xebecf5cb79f28af9, 0x574b889870c279f4, 0x326317b005f444a4, 0x7480da44b34f4b1e, 0x7c5f21cdc46275b2, 0x210494b9ee24e4e0
+, 0x3cbf6ca1f4aa4ead, 0x6bf3872ccbfed940, 0x19e8a84673a566ca, 0x61a80e16990401a2, 0xea2e029e7f9b3824, 0x5762298465f0ebd3, 0xf60e36d4969f9af0, 0x00b826180531c799, 0x17120ec95cf3c61d, 0x47196cd6de85c7d0, 0xb0d47cff46a5cba3, 0x29271400d7ede26b
+, 0x835908353516b894, 0x4bc57f8c1eedec8e, 0x2ec5deede5c0db5f, 0x7b9fc48ac4a689fb, 0xf82ce6de88fc10e5, 0x6c5d84a70e03a3d6, 0x88a211fc4ea531f9, 0x7d5583e5918aa03e, 0xbdf2d70766fb8f39, 0x5926497e734ab18a, 0xd6a9872b800cacb4, 0x757c1cd521fd22d6
+, 0x22d50b0c13ec4bc0, 0x288a77d34a15e99a, 0x95c8e78fced3d4eb, 0x45ece109c15be169, 0x878ef262d0132128, 0x48110e9fd98939d6, 0xe3fc5425d2e7741e, 0x050ca6e71f599c65, 0xe02f97605d9fe375, 0x2af48b9bfee410e4, 0xfd34a1c107229a54, 0x43dc6f0cdcbd41fe
+, 0x15b4eb7d65cc562b, 0x369a7b0dd3e91248, 0x2b087611edd32810, 0x116b234ddce09d7f, 0xcdb03cae8e90d2b0, 0x4017d51587566038, 0x081793739242b600, 0x5086e8e633cd52a1, 0xf5ddaee155cb8087, 0x773311b60d59a7e9, 0x36e5aa0acadf2068, 0x7126a4281b192882
+, 0x54a10df54f7ecef8, 0x3cd7d2fbb6e33f67, 0xac31eb6c3e740c25, 0x517db54840feb2de, 0xf17cb269b3ce27a2, 0x04a8fecd1dcc99e7, 0xfc887c1f2f85a2da, 0x280da7425bb55b01, 0xa1af72f5256a5a53, 0x71da839fc459f465, 0xc203fe7ba6587f71, 0x08a4201f77a4f335
+, 0x6cb9ea5683014d96, 0x5da17076b6b51ae2, 0xb55ac168c3e3997f, 0x41b9a32373d78f7a, 0x96f58033b8600a50, 0x6ebfba3ec9d956cc, 0x0ff8883707d66d0c, 0x2f562b035445226f, 0x2388fc015bd368c7, 0x2b7d802ce27f627e, 0x301f0369c24083a6, 0x77e139f6da8d5aaa
+, 0x9f78574697fce43c, 0x02726c94565421b6, 0x1ad6007338e26585, 0x6134cc5eb35c02ff, 0x77ae739c9cdcd1e1, 0x04e96543233c7a13, 0x97d3926dcded2e10, 0x6bcdff7e14cebb73, 0x9c46ae2b32489774, 0x04a97b9a0473af8d, 0xb0350bd910d9784e, 0x448212d3e2164ad7
+, 0xf3464e0351f5e995, 0x68ab4d24b3ade8d6, 0x86854d534002af20, 0x613f7ffe5de92aeb, 0xb385b4f4608a370a, 0x220dccecbc6f2688, 0xc31ec5384abd3680, 0x25a82841a2000fd8, 0xd19e422504694236, 0x0bc1124d541781f5, 0x0808651edcd99176, 0x41b81f223d429c76
+, 0x1a6dcb2662cc80c6, 0x0b101fb0ef0d1f74, 0x6f02aed8f8327119, 0x5b4c5176ccc4a340, 0x8fcefd200d6ee8ed, 0x0548127287f44749, 0xe1efeca1fadd1341, 0x0e74bc189dc9016c, 0xe90470353f46cb12, 0x69513d3455bc890c, 0x9503686f1f2497d1, 0x280a0bb7733f1086
+, 0x14e5f99930a91dea, 0x7840ad84b03c3878, 0x46e32c654fdbceb1, 0x7e88d2822bb2cecf, 0x4d78a8aed7f8661d, 0x70eb17416ef40180, 0x97b6f1733c474a10, 0x3d0d27fc4c7084ef, 0x730f60f6a1ee0d71, 0x7bf6e3885d3d9302, 0xa1e8af33742f1611, 0x73b798ec129822ed
+, 0x0f669bb094642a70, 0x142927de789fc4a4, 0x0db18e01fa98cbd7, 0x6ae4d37674be1451, 0x7175e98f178b4b74, 0x40534e319bc52c6c, 0xb7211d252c4db879, 0x1a7651f8f3ed1aae, 0x9c9a43932d50cc97, 0x630b232b7201c359, 0x327d77575f5b3839, 0x5f0e19e78431864a
+, 0xbfbb00b6530a3bb6, 0x19ba9d60d97f7857, 0x759779de744bd764, 0x5facbe63177791e1, 0xc74ea511c56a3b61, 0x1d8909e84083c31d, 0xcd20094b507af492, 0x2ef1b9c07c92ab37, 0x8430ed9ef8494fc9, 0x3f9170e6df5b1fa1, 0x1fb8dbc837175d73, 0x65b961b58008d022
+, 0x7e1afb6816864b6f, 0x54c4b92c534871e9, 0xc0a1dcd60d61ef84, 0x4390f0e992c41298, 0x1e54e2c8b7c27348, 0x7a987e01a2ec308c, 0xee42fbd90c4a89fc, 0x1ed8c77f8d7c609d, 0x569dedaca99a3346, 0x0eb471e609fef4ed, 0xc915522a3b9fd03c, 0x726453b246746bfb
+, 0x4ed3cae53dc5fa4b, 0x1bf1e4b34b9feef6, 0x0850df9f0401fac3, 0x0a58d33cb2422e2f, 0x3d197f9603ecfc29, 0x45e46edba1cc432e, 0x96c0c93310d9bcaf, 0x18de3a458be2c33f, 0xc9e65e5bcc12a49a, 0x71a5345f0239b187, 0x53b3b2f01c5710b3, 0x438350f57ce2ec4a
+, 0xdbbd368a760391db, 0x4033638dfec29fe2, 0x297ad75ed73117fd, 0x269c08d54b106e8c, 0xa4e3e4fd238b4218, 0x1f48a1cb09208aaa, 0x9575153115cf5fa7, 0x59feeff0876fb74a, 0xfdedb4af6f368710, 0x79be1fe79fa674d4, 0x689d6bbb4c707c39, 0x394a451499057bb1
+, 0x5887d4fb21fc43b3, 0x37628dfc4b5c23bf, 0xc66b76944b34bd13, 0x6e97f0a8a45bcb36, 0x3ac6b10139edbbdd, 0x313f4846b6745833, 0xf8758d9777cd9037, 0x02fdc98f02692537, 0x9e79f381fff833a5, 0x25ac5d68c49b105c, 0x1e9f48a076d8c9ee, 0x788c85c9fe9543b3
+, 0x776ea51db3b3b778, 0x0007c44055b64db2, 0x3c392c2a82fddd25, 0x65000203be8ee976, 0xea119666ab7c50ab, 0x528b2700e8f82d39, 0xc4aaf797118b8282, 0x55e5a7d5382e0d3a, 0x15a80b22e89f1039, 0x199f68594b1247a0, 0x8d5630750d622435, 0x2687f48cc6def5b2
+, 0xa16b0c0259eafaee, 0x7aeb10834e93595a, 0xe31bcf34ce679d9f, 0x4e2c19829eee3c87, 0xa46869cb8ca35c9d, 0x3cd35313c08504eb, 0xa088eca66e98389c, 0x44c562f0f7262740, 0xd3eb8a28f447523a, 0x43a0e059bfe37576, 0x0312c5d6d0f2e0ad, 0x5f30aaf0d1614c61
+, 0x6f09a7a6e182b0aa, 0x575db3d21a82296b, 0x6599bb5eee7925e6, 0x093f89458dcc2fe3, 0x70c4af785151fc84, 0x1230c0c519de5480, 0x0e66f8f93075a4f6, 0x5de4a122633a5c6d, 0xdb99cf83f9ece1b6, 0x1c3acd4a13ded617, 0x4dfe69e68f59c447, 0x482ba1f7715a3c16
+, 0xefeed2a7c81ea8fd, 0x4e089eeb713a572f, 0x78bc74acfbdf322b, 0x4b4951ce8eb86fbf, 0x0eafb6b46ac6714d, 0x72913ed109f7d404, 0xb498bf6fcde9e3a2, 0x3c08a283ef5ded62, 0x9af09f593a48b346, 0x7ed52441d00d4980, 0xa78e843ee5df44ac, 0x25db12d420a86151
+, 0xec840e7e89d049e0, 0x5a34cbe928bf96cc, 0xd875dc5525da882c, 0x2af4442fc256827d, 0x089fb428c2ef5a5d, 0x0b573ace080a3d9c, 0x6f57282554c240da, 0x425ceda6707b6bc9, 0x94b5a8c3dde824fb, 0x264f6f6a445b5da9, 0xadf292191c5c1eb7, 0x5e302e82fa4e5533
+, 0xf51712fc44237f35, 0x2b0af62c42e56e66, 0x10392cb4d9c71b75, 0x4d7e08fe8457a95b, 0x210b9eceb04534bf, 0x73329d1c7d88e1e5, 0x667a43fdb4ba79e9, 0x3435ec04276ede87, 0x38b8540a1a78b098, 0x4f6c266e6793bb78, 0x447ea35172754041, 0x109d7b742d8c3dac
+, 0xe3ccab45d2a4f6f7, 0x59040bb73f3bbd2a, 0x730b39d65645bab5, 0x5c61aed2f83382aa, 0xa992143de3cf83e1, 0x13455cb889b700f9, 0x54648228b310e2f7, 0x5b837752ee0f733a, 0x3923a6c0e5ea0dd9, 0x5ebebd01fc9ca9a2, 0xa34c205b8fd94258, 0x7d1a10029a0b6cd5
+, 0x6c83c02241a46527, 0x4127c85d6be1fc62, 0x26f86ff5ca7240b6, 0x2167391e7dd95cd9, 0x79227506ac78caef, 0x1a2cf919b8832a0f, 0x07745266405cf574, 0x38095a07f5713ae1, 0xe5eeab985ca3e7e7, 0x6a5dd9eeb734d639, 0x991027ebe44a4822, 0x311085fb4de9c1f0
+, 0x33f361e21066c3b5, 0x550091d2dfc8688f, 0x376345c5532bac13, 0x0aa0898f990931b5, 0xea2f3346e5d3226e, 0x208790ab78776afc, 0xac7c2ae63433850c, 0x3c5c373ada10ef52, 0x96c1b4003f4cde6a, 0x4546a9c475c09781, 0x6c961fd3e8536294, 0x43f36e63fc0d5066
+, 0x296601d8c42167f4, 0x241c1fc38565471b, 0xdb00a27e11ce9617, 0x60381181b7e7e4ee, 0xc1076b7635ac4d52, 0x0166010ffb8dda38, 0x5238f69becc43e0b, 0x63303a2015708b17, 0xe8badb2e5bb22591, 0x3a10a4e218b6131d, 0x236ab01aabf1a7b3, 0x1ce8a51a68a4126f
+, 0x59e775e2a2a87928, 0x770b48eb4b738301, 0x0b43c2be176bf79b, 0x1957850fb6424660, 0x44455ee1ecb0ab2a, 0x620ceaa116eef4f0, 0x0198f62cb6183f6b, 0x3274f78eaf2d55db, 0xd2ba4e460cf7ed5f, 0x19cfc17bc0b66f43, 0xcbae6f45b1942722, 0x5d93e44739147b58
+, 0xd07180b9d28fc597, 0x35372b21b2ea5a46, 0xed2673477f083464, 0x7a9ebeeecc57e6c2, 0xb51d991a81a6b314, 0x35e7d90f4ed6de58, 0x45f21e209510dd05, 0x446ffd2715c8d380, 0xe69b5c7a9b6d3e76, 0x1379e79fb96912e6, 0xc161c848bd508738, 0x22264a049d8cfff6
+, 0x32321a68ff7ef7b3, 0x57b0e50cc585b333, 0x1c08c65ba9d764e7, 0x5534c793f92f00f5, 0x7a1ced97eafe6fe4, 0x6b8933739202599c, 0x618c5f8fcadd3ff2, 0x2a8719b3e6548653, 0x346a9ec5c4200f0c, 0x7a36b8d00d0eda58, 0x844b22b75021accd, 0x769737059fc5e465
+, 0xdb1ba69b5019f266, 0x1777242305db9ac1, 0x491d11ad264b6ff3, 0x136198dfc57a3053, 0x4a6cc64741eb7176, 0x14e811c97fc97650, 0x6b64667f71be386d, 0x3286fcadf019eb5e, 0x3f2591f4498e10a0, 0x674fa7c32df7867b, 0xbae8ec7ee100dcf2, 0x03b2c0a20a6372a4
+, 0x4c8d76b471e24474, 0x421fb6a7b8a3216b, 0xc672bdb2fe8f514d, 0x202af653d9aff3f5, 0x05e5f80f9626953e, 0x7b721fa3ccd42ffc, 0x99d8e481c0f70479, 0x054c31746d23362b, 0xfbef2e20430e8025, 0x60e1e3f02e7720c2, 0x161701874eb347e3, 0x363924e90cbb77a6
+, 0x180f5ee1863a1a6a, 0x2f79c0046ff79fe2, 0x44679866e35447f0, 0x1c64c6dd73e0d636, 0x1d8175566341469d, 0x5ba634965b8b9e87, 0x8f48744f976952a5, 0x744f28d23db94c8a, 0xd15e84b1f232da34, 0x556f3d7aa38bee8c, 0x14693c56e866ef89, 0x1564fb9a0f81eb03
+, 0xe97eed56fa2b483f, 0x6d3f7e01aebd1957, 0xae8f128aca3b3e45, 0x3d41e85ba2afd3a9, 0xe4fe485e4b6d8328, 0x65c49b4c3e98098e, 0xe96a00e054d6e91a, 0x394a2122738cd006, 0x715cca3dffd90785, 0x7bc3dcde15890965, 0x6dcdc47a33a148ac, 0x435db9d6dbe1bd55
+, 0xd74d4d6e0fd89c27, 0x25e727f6a5380553, 0xbe54127ba6c5189a, 0x65c87d3c3e61939c, 0xc34a6d122a809e2e, 0x7de6b787f097eafa, 0xb8f8b6e701758661, 0x10705fbf97042046, 0x1591614e6da2d44f, 0x7c74f26ec6eb070f, 0x9ad98c1a50249c60, 0x6e1bbd44d64b2302
+, 0x937cee76047790f9, 0x5b4ccbc70beaf690, 0x332e79ae75ae0dae, 0x2e6394161d093556, 0x4b378bf68f6849f0, 0x6c419fa0cebba72d, 0x8bb431e1e273f2a4, 0x357cec80bbe024fd, 0x83a6e913962f11a9, 0x7808df02e2523718, 0xb6690b5dabc49e13, 0x6cef23259375972a
+, 0xd18ac767b5e551fc, 0x5a0ba1dddb15bd36, 0x6f7923de219e3e1f, 0x3ec23588db9b5cfe, 0xa4fc23d42c83bbe0, 0x21581a00768658cd, 0xa295b6e57110218e, 0x3e7bbab1d15f477f, 0x2266c03d3f0d0635, 0x4174f08a95be03b5, 0xaa1a674abb8cbeb8, 0x6bdf6ba553ae3390
+, 0x8a31f824638545e2, 0x2a9e37a0f0eede53, 0x148a53d8cba69f65, 0x64c587e816d96316, 0x777a028a47e97e93, 0x13728e46befb2e0e, 0x13138b44862fa665, 0x0fca8c38a87775f6, 0xcc44bd580dd067fa, 0x40f2f7642e22d02e, 0xab3ba6db80c2f728, 0x5068aa2e2d25b7f9
+, 0x5a8a842c0a2923ff, 0x67c39e8a1006c196, 0x8f5cb9ff55460a84, 0x2e735c20a419a518, 0x0c6ee3fcbfdc2da4, 0x5bf6ed60a87b92bd, 0x5e4ce130e8e1608f, 0x0932ceb3e50028e8, 0x793cf8a0538cbfb8, 0x4e89e2c018beb7bd, 0xcaaa79642f5060de, 0x542a38a4d13f0016
+, 0xa1b0fd9aac663e55, 0x5158bf1f7b33c0e4, 0x060e82f65a4119fe, 0x32347069a1529fc4, 0x5c96ef69127480d5, 0x409a902134df6ffe, 0xdbe8c392eb6c7013, 0x73f2c48b0e3b4a79, 0xddf5060b937e2dff, 0x1534f901278611d9, 0xf47fe29ae4fd49a7, 0x7a2c0bfe75539f29
+, 0x61d431e05f0d566b, 0x15e09da672af5074, 0x1539c22a644f67f2, 0x73015e1fcb3527b5, 0xffbac602bb1bfaca, 0x2948e0afb1ccb93b, 0x263b4b66c845c42d, 0x3acae7e91a8d567b, 0x4df341959275821d, 0x356cf25587fdddb7, 0xd24b5954cbaea410, 0x53ff5780642074f7
+, 0x1d8ddc6079a4194c, 0x4f69001c7246afbb, 0xd708a1dbe8c3a5b3, 0x2cabca2303211f51, 0x936c0d257add0328, 0x6352529f6e3a1803, 0x255a12166381c11b, 0x4224d44035d2f01e, 0x48845a605aac6c4f, 0x1e5d2e74f0307647, 0x05f156c47718fd18, 0x727d025f3113b268
+, 0x7011424b3ec3a1bd, 0x4707d733b00d234c, 0x4fdfa8a733e3398c, 0x179dd91b21fb523b, 0xbdb1488db70fd65e, 0x7403f64429fa7468, 0x55d40880bff509f6, 0x0546235d023df28a, 0x2d21c328ba090065, 0x1e63ce495fe9e537, 0x99a0264790e11bde, 0x2fbbf8479be81646
+, 0x92644b3b29ef019f, 0x56a2dc98c4724541, 0x072c3ed9220495f6, 0x3a3d787a23483d30, 0x1906f294a9d64e55, 0x1afb83ac0464118e, 0x74a120e39730a0f3, 0x29f8708f474cde98, 0xab0c734a0e3e63fd, 0x5f58deee1d5cd701, 0xdb2338b7e4ab83b7, 0x5a43e5bfcb5c17c5
+, 0x0ede76bbda7ed8bc, 0x0b0de99503467e4a, 0x3b905fc53ed39dc1, 0x3a2ba952a058c608, 0x939d9c6a0d41edcd, 0x49510e3b5ce8a07a, 0x67684a81e6939edc, 0x78201e08e7e3d198, 0xed58b1e24a41fa5e, 0x08a5a8ea35959caf, 0x046b7d7a7a2ee348, 0x77358e54bb1d4623
+, 0xe34284c7f10a1da4, 0x37e36a32f608769d, 0x8780e719b7f8db3a, 0x4fff13c7439175a6, 0xf0fcb8464f7a9692, 0x51ba0cc756acb263, 0xc514331681245796, 0x05ff6469c8c38247, 0xe279b84782ea86e6, 0x60424885a4f6e2d5, 0xb20fefc1a370b551, 0x4182c7edfe04a110
+, 0xddcbe6aa14e8c72e, 0x0cce23e9b994ec6c, 0x866c323cb185ae69, 0x29b7b0fa7ffe208b, 0x7c467d4daed6b792, 0x4680d716306f5bcb, 0xdf6561219c4f3d2b, 0x55daa33ba6910d33, 0x72faeaa5e2c39200, 0x241e78e412980877, 0x440d5d5ffccfea61, 0x7e14a6e93bb5330d
+, 0x16de06233efe91b4, 0x585d53771707a024, 0xba898b098a79e4f2, 0x05f0938b06bbc089, 0x2aaf6299284795d5, 0x175c97271ac48a8d, 0xc08ef97014a68783, 0x5d0669e62eb1969c, 0xd0b6af3a87252335, 0x0ead663edf6c99fe, 0xf42e54fccb9be037, 0x6a4afe5c859078e5
+, 0x5f4d44f2fa080acd, 0x6fecb4d6123c3d94, 0x0be86ebf55dd544f, 0x71814dbe138ecc2a, 0x2344452b32a1fb11, 0x4f396ac781643c58, 0x1a30a076ac350f9f, 0x723a15a8c8f58615, 0x98ab7831a2a0ba9f, 0x7610c85f14282755, 0xabaf5aec2748b1c9, 0x3bd79be762cfa03f
+, 0x61d38bc0dac38b55, 0x33a7354c0eb3ca81, 0x437eb59540611db1, 0x2eda5e7a6110ba3b, 0x829e634ea6697883, 0x0afaff28a758a47d, 0x2bb0dca6029754eb, 0x213ff8cc6ec6f98a, 0x0c2bf33402d672bb, 0x1cf3c36fc45ce547, 0xb84472469c19b024, 0x71f368fc3d8198cc
+, 0x04b859d5fc1fc772, 0x67b72f7d3ca1848b, 0x4c98a5a6749d4335, 0x61f9dd0f30986d31, 0x055216bf228e193f, 0x0b92e8dbed9265bd, 0x94f30aef067d0cd2, 0x7ec165d81a0f64d7, 0xdd9ce941f8f37e7d, 0x21b2a29e01d68e68, 0x9e84e5aa18d45ac7, 0x06b1b01db68cd5e4
+, 0x20cf8616a121e6a1, 0x263d2a834b8ec4c1, 0xc1e64198abc4ee87, 0x068a6ef41ea8d6cf, 0x4976a43483252b01, 0x4d5ff783db212003, 0x8007c2b7b13df29a, 0x1fa132c3b57b512e, 0xc7b2dedac21a7488, 0x71cd322c5044e2fe, 0x2cc12193fed41aff, 0x660904f21ed043d3
+, 0x0eeb13c7c8ba72a6, 0x03559276ec91f89c, 0xb857f8168e17edc4, 0x51d0caaef5ff4469, 0xc1184ad4ffe83a05, 0x49906e2c676bf4e8, 0x79be44af981552d6, 0x2c2841470ce9830b, 0xdab7b08aa996dabe, 0x32e464f9c860aac7, 0x8f6df06984f55f1f, 0x1524e0253c2c22e2
+, 0xcddf6271f69479b9, 0x6ba91d2103a069fa, 0xaaec428919c113d6, 0x3a2fb1a432a60085, 0x3d4be147868a7fc2, 0x7fe3b377049ece67, 0xda01d12ae970e15d, 0x73d777d3dd914b81, 0xd6212d7a41b51282, 0x140768136b18e332, 0x6336451c0effa8db, 0x39d543198553895b
+, 0xe73bb2fc12264176, 0x21cea2f7247567f0, 0xc73b27843025732d, 0x371996d7b32f7e5b, 0xdf0ad827ce3c83b7, 0x0f62c6b8bd9a0fb2, 0x7e31aa2b172f10b9, 0x3a5cb4a264452253, 0x16e4cd15b7914829, 0x18d9047ba43e3472, 0xe59d1b5e0f0c85a1, 0x30d064c1b05aa569
+, 0x58b07513217087f1, 0x344f839d2f690ee2, 0xf45916d007f9e8b5, 0x28a8967f3d4446cd, 0xde5e7731b267b7d2, 0x32aa118a262f77cf, 0xa84046f59e8d37f2, 0x2a54c2e96b24716c, 0xc2e25534187db382, 0x53a1778baf7c8942, 0xc52deb2f82ecd988, 0x5744797e8b934ada
+, 0x2977229872e4f395, 0x63aef38810b43ea2, 0x1c0b30ba2d1a7d4c, 0x6879f7b87858ec79, 0xa79fb334dc8c47b6, 0x26a87201f4ffb854, 0xedc0c8bcee580f02, 0x2a8f996952700058, 0x351eaec6d81c281e, 0x5e52e56d769ba8ba, 0xa3aa77ff2008b9ad, 0x00a8045b05b4ad20
+, 0x331a6d5d55b82b0d, 0x7c249dfd07ef5b7c, 0x9a398b52f16fd1ae, 0x30699dc156fb544f, 0x584f57628572c965, 0x4fc132e0f2c88345, 0x18d101a45843d458, 0x0aac10204f1d4ddf, 0xd7c22c469cfa1e0c, 0x6fb844b0eec559b4, 0x6a9b62bde291a3d2, 0x7252790ea43d6251
+, 0x61a39aa501b09a94, 0x09249e35c45900eb, 0x80fa7a7e95f20710, 0x2e55ddde7f86365e, 0xb985075d1dfb27ca, 0x2cf49824429f53d2, 0x6df55d12965d6ca1, 0x776e6939699e46ee, 0x570d03acc28aef96, 0x383925ace0c9a23e, 0x7e5e5fccb87eed57, 0x5987df426d46067a
+, 0x964c6f3c65fdfbb0, 0x6ed9d47475ea3a8c, 0xfa69b99f273d0915, 0x4fb08a3341eed692, 0xd356c9a54bb77d5b, 0x2fed523fbf707806, 0x2fd35669ecfdd7e9, 0x6b8dd3c402d5d52c, 0x2c90e7e4f52352a2, 0x42fef4b3d5968a5f, 0x29b20694e548a3c4, 0x1ac05cdc874302a0
+, 0xc234e0bb5b3db6f6, 0x4f9c16fe85c1c7dd, 0xa36307f98419e1fb, 0x4748dc68e1e03040, 0xf22dbd5bcce6b7a7, 0x5a65bf1ece7dcb84, 0xa225d50d3585bd30, 0x451f78118a8b88cb, 0x9777824e57f907a4, 0x062192027eccad60, 0x1428f3167a41eb57, 0x52ea739db283e685
+, 0xe6729da927dd155d, 0x584efa7dbfda3e10, 0x29e4628791ebf3cf, 0x09e46f14d795a69e, 0xded87dda61f5b738, 0x3aa09cc41b8a40f2, 0x707824df26cade63, 0x543e2f9357c62f42, 0x68d3084421feefef, 0x6ace0092784cf55f, 0x58224a8ab3a7c0f0, 0x206d85cd4ce2523a
+, 0x93aee56a362b18b6, 0x64794e3a42d4b66b, 0x9a8131c5d39ba736, 0x1a133f7bb892808c, 0x83085a65e8cab40f, 0x173c99a1aec130b4, 0xf3cd221b43e14e98, 0x2a1ce94d0ebfee80, 0xb6a0b5e984b0e8d9, 0x0f0248d818283ef4, 0xf222aab3099e3193, 0x3601de846a9143a6
+, 0x994007f94b32b238, 0x15f3fee72122bdce, 0x4b8dbd72bc2da144, 0x7e2d82fb7bed6a1d, 0xbf74162d69206821, 0x32afcc67f17507be, 0xcaaaa39bd455d461, 0x726180858dec3e86, 0xcdb79de2f28e0a08, 0x3510e6f89a60e299, 0x2511013301f5a3c0, 0x3d2cbe668b85b48d
+, 0xdea5b05adae7f7b6, 0x2614424460c05628, 0xa152cb86074beb51, 0x6ebd3268162f1f81, 0x5efd726e6a3ddc88, 0x7a4531fcfa9b9009, 0xac6df1427096bdbd, 0x4ce4ec86a683371f, 0xc608f6109ffe1b55, 0x72596553610b2414, 0xa8010e59ec27b758, 0x66d65b6a20e360ad
+, 0xc2174e520a6ff57d, 0x431cbd3b344e34ea, 0xe0bcaa4e547461eb, 0x0f1b02e4cc09b49f, 0x1b828bb6704985e7, 0x640bd63224ec9553, 0xb655e84250255658, 0x75f21727f44d160e, 0x55bdee789c9106b4, 0x69ec1ad9c34445c5, 0xdc0b5f0b85d513e6, 0x073c0cffa242d5a3
+, 0xd9e2d1d1cc7d81cc, 0x375914b689c08974, 0xa82f2a327bf85043, 0x79b195810a12ae46, 0xe61ffd2f4fd71873, 0x0e9734ccfa26309e, 0x852b8de87efb2e9f, 0x244a6299dec0cab8, 0x20baa565a32e157d, 0x27aec4c694a36534, 0x7cb0f44da799179c, 0x15b3f8047c619613
+, 0xba19ae549548afb3, 0x436e1592ba6cd89c, 0x735814e5bbc9298c, 0x1118909d40aed45a, 0x7c72d5ab6eaf0155, 0x1d0fb329dfee3b3b, 0xce0cdc9f5f073d0a, 0x465cd7c3d07a524c, 0x0a82455c30497068, 0x02ed12b2ff7ac2e4, 0x2488aa8758e3af99, 0x12b6c15028f2c992
+, 0xcf524bfb93c46d3b, 0x793c9edee2110126, 0x27cdeb957a14f07c, 0x7ae0742011b93da0, 0x180a41b66c4f3427, 0x4eea9fb17f6bf6e6, 0x17c1ff7c6549a596, 0x1ee0ec66d67e48b3, 0xd23e4b0441d52293, 0x0ed48a81b62ae5c7, 0x2979bc3e6fa264fb, 0x10b38cbe862d6705
+, 0x1cfdb92433b0f2f4, 0x34b2ff9ccf80062a, 0xdb6c0f52bc19de55, 0x78e388c6753ed000, 0xea9409388091a7e3, 0x567466c8c8be5b96, 0x9fe9d91c89665830, 0x45282071df546616, 0x7b5975f6967b8f69, 0x3c77bc6f89c9ae25, 0x0100c6e65a4c1eb3, 0x0cc9dc909d546cff
+, 0x4d8aec1e714dee85, 0x5bebc8abab322c1d, 0x753e84086a318de8, 0x7f436e9d4210f43d, 0x142e89d66637c752, 0x435489b5fe689fcf, 0xe874bd92119e8f7c, 0x36b9b71d3e1d7662, 0x30528dd1602006db, 0x55543cedb589d053, 0x103f0d1e2fdf71bd, 0x1fc05eb48bf5c6d7
+, 0xf01eed91a8e1ebe0, 0x38bbeaf8f12b9317, 0x7facbd46444af6d5, 0x2ce3b20a832d2066, 0xa95103d229dcf99a, 0x2a477adbc87dabc8, 0x67814149c1e10f50, 0x28cd364d7e4666eb, 0xc5c77dd2d0ee6845, 0x3a4aeb5443756c8a, 0x6f66c1a0a65de127, 0x41be504e6efb6b7a
+, 0xc93d8a221c4c3da4, 0x34c1a50a2eb16370, 0x483c1b1f7673ce59, 0x7b5631bb21ce6615, 0x6b8bf684cad6e45f, 0x6d69280417de3466, 0x845786e1575eef9e, 0x247c80a347fb193c, 0x2cc82d6e28abe0da, 0x040b581f323ade74, 0x0bc64f77477c73ea, 0x4f6d30f869c14f1f
+, 0x6aa1ef243a41cf67, 0x380fe826f588a5bf, 0xdee9e084f0b0484f, 0x2063b0ab58e78690, 0x77b2d2d719278f6c, 0x0f5c801e3c417cfe, 0x32a26b2bab198097, 0x467d2e63498f5a46, 0xac49ff79da7a2fa3, 0x0677dd8804540ff2, 0xc09b3b90e95c31e8, 0x78d9fb37961c3409
+, 0x7ef43402084eeebe, 0x3ba79dba37cd2fdb, 0x01b5c31f4be41c49, 0x0a12bb2e6e33149b, 0x150f2ea25c02444a, 0x3651b09bbd00b7c0, 0x31def0278e6cf409, 0x67659f93017e20ab, 0x17ba3413b447107f, 0x65ef63d808c2dda5, 0xc9dc4f484d91a723, 0x062cc749fdb08a7e
+, 0x92b4c06aa83dde5b, 0x23c4f00863e62698, 0x8d17ab0dfaf097c4, 0x72a507b73b0f000a, 0xc05559ae2179a47d, 0x36ee0422cc499e69, 0x56044bec818482b7, 0x041cfa1974b0e0b3, 0x82e49584bd88305e, 0x77e9515cfc48b766, 0xe655ba08ea17453d, 0x5d79467143c4665b
+, 0xf353b15869cc6f2d, 0x6997066085b8170e, 0x61b45a2c2263823e, 0x100c0f7122f0c7a1, 0xd2ff250c5de2504a, 0x4063c04e3d11945a, 0x3d0ce2d7f672a9d1, 0x0cab75aacb433d95, 0x77cc0b5674ba1260, 0x7f1755f424d60b0f, 0x99cb65502042ac7c, 0x245b469bcb598cf3
+, 0xf9bbc27d44d46354, 0x7bf755e94ffc1294, 0x02290ebd4f157382, 0x79ff5edea031a2e2, 0x4ae972ea2840e62d, 0x4232189c10b2a65f, 0xab66adeefe437db6, 0x0fbc40531a1239f0, 0x9f51b5134791ec82, 0x37ad600e3ded3e0b, 0xf105938fefa6d7ce, 0x0fb74487b945a175
+, 0x7bef289a987113a7, 0x0aceea18fe043b91, 0xb247ee4494cdfcfe, 0x3d3e3f5cda72f6f7, 0x6bd51116f65335d4, 0x7dc220cfef1c4e87, 0x3cfb0feded39d491, 0x6f00e231b3f45e5a, 0x3a917be46615eeb3, 0x339ade1232f10dc3, 0x76eabafae88936f8, 0x25b255a95418764e
+, 0x3663cf713988a6de, 0x0e0388ead7c704a8, 0x0461ac1853238b23, 0x7f6d63bdbfc1adba, 0xe14008c641ad441c, 0x52073f711712b70c, 0xfc0b07bbce75ed25, 0x456e028de6c08be5, 0x58efc3baa372a89d, 0x560d286b91e38cca, 0x5686e4a5e368a4a9, 0x54d8ead9630a9985
+, 0x2f54808778d72130, 0x0475639aa6cb45f0, 0xc6b7b26950ed4b4f, 0x28d0cea6fa5f05a2, 0x60a0ec747501cfcb, 0x341bc3157614e7e0, 0x53a3839c243e4f44, 0x0ba8430f84175708, 0x79b0161477c99ec1, 0x7de7a56c5896896a, 0x64ac8e12ede093f3, 0x09774a75911369e5
+, 0x8d562ddfaf955802, 0x2d261850da2e7664, 0xe4a25c90715252b1, 0x76a8da29853099b4, 0x016f717abfe54e30, 0x40be61328c536321, 0x2ce9ac7caea56797, 0x72042d91a877cdf9, 0x260b5d126bd0948a, 0x01991e1f273a090a, 0x3f5a0d4493c19087, 0x0641233c4a4238b4
+, 0x16288394653718c6, 0x477410d9571e6563, 0x86c63fe124fb98fc, 0x62fe397035c1bdf4, 0x40b33233a8d507d6, 0x6d16a1a7a6e2c0ad, 0xd5eaa00a67404b1f, 0x38868544adc741b5, 0x6ec2b787ac422215, 0x431a7ff8e958b79b, 0x5b3babcc12421d19, 0x2d65a204d3948acf
+, 0x9dd7d3e1877c0b25, 0x6d0da0d73c757c76, 0x6d32858247a2fa01, 0x4b031333a7ccfa62, 0x18891d176b16befa, 0x08e10baf38814dd6, 0x959c36cd13bcc755, 0x122b0b17b387bc7a, 0xf40cf31c7216dc62, 0x527793c0f7c50660, 0xa99f304d10613f31, 0x64220b0c463601f0
+, 0x854a98380398e4ed, 0x3e136b2ff099bfe3, 0x08567133141188de, 0x59908e446707ed6d, 0x02730be31fe4b152, 0x702fa5c0b7a9c542, 0x7e8862421ad42da1, 0x42503d868848603f, 0x4624f9c597213ad0, 0x7e6b65b759f7f5c6, 0xe61d6230ada56a8b, 0x6069fc3a8a57fcd8
+, 0xc690557f696cbbda, 0x28cdaaecbfb9a048, 0x68f49df4db513d6d, 0x264032ec7c2417ec, 0xa1e290afb492c4b8, 0x63cddc9970c7334e, 0xb706590c3b624b4d, 0x7e8bbeba2bd107fb, 0xeec40e7d1dd829a2, 0x04bf2a6156b598cd, 0xa68acc4de06a3cf5, 0x31239426f3d4fac5
+, 0x680db6896af7bb0a, 0x6af5142dd447e051, 0x07cf3db31ba8b182, 0x42981e0485f548dc, 0xd27c4305797de12a, 0x5ed7e3b8618c93e5, 0xc3ddbb2a50c39992, 0x7cd1098cd94c8349, 0xcd2ee1187ca6e6af, 0x3e9953b5551954a0, 0x322933d716fa2bac, 0x2fe61d3dbd04920d
+, 0xed1724742babe695, 0x2debcf1ed68fe1bb, 0x1a56eb903ea34bd1, 0x70c7eafcaef1d021, 0x6efda3d1c9ac3172, 0x6d9235fb82edc916, 0x0457fbbe3387333e, 0x05cbbfc67c16d9d5, 0xc5aa7cb881a3cd7c, 0x2c349cced8d1450e, 0x5ac238cc28a0161d, 0x69d4975671650998
+, 0x091f3edf2381607a, 0x2e4fb8ccb2f04d49, 0xfb59fe987f5b1eac, 0x616c41a5a3b56412, 0x052c5ed6ddee0810, 0x0e249e2088e9c790, 0xb9938fb896d162cf, 0x7ce0889110becf6d, 0xb1803431ab689c7f, 0x531f39017539e7f9, 0x7c3f5204ca91f1ab, 0x7f6cce5aa5943411
+, 0x3970ff2059caf6cf, 0x2d909ffe15504583, 0x2330d8088d2fc46c, 0x034df72c88ab8daf, 0x52cbe2e3a5273d59, 0x3c61e28489825f61, 0x73ff778071ad7158, 0x5d14afe88425494c, 0x5c71d58c4ca7338c, 0x6b6e07d15eb99f4e, 0x5592d9f2b94d64b7, 0x28e493775c115a60
+, 0xc810f44213f9131b, 0x651af44e5b919e06, 0x083eeed1b4884442, 0x08f5d10465eb36e1, 0x0996e5b280df3c63, 0x66acda94bed5b97f, 0x178b26a2fc34e17b, 0x11579aa74b36ae66, 0xb08e3c49cf3b0797, 0x4ce1cfb60cb70dd0, 0x1f9fb8dbf8de6184, 0x7258658224d39845
+, 0x49a2b89d6f08080f, 0x50b4f85905abc180, 0xeb86376ece250501, 0x2620b372cda33050, 0xad330c195ee19048, 0x7d75dea6a663276a, 0x839cf59f1143aca4, 0x78e296a3f8db15c4, 0xf6b33e34a97b31c2, 0x411e6f77c013fefe, 0xa095abd0535f3ffc, 0x0c733aa98d1e5c47
+, 0x5bc99b610aa4d5ba, 0x6a64fa6ea002773d, 0x18807ae46ac19aea, 0x5126274c4cc5f2aa, 0x7f8d44a1d5f8677c, 0x349bdc7148c3054d, 0x3141b64ad7af68bf, 0x5d0d8fa3fcfa9d66, 0x7d7c6176e1670636, 0x79f67bfebc1f5584, 0x03c03810a0355262, 0x1ff7360720c0bf32
+, 0x8b3e353202c93e71, 0x358bc73618abe9ae, 0x792332ee1b3d7552, 0x249449685007b231, 0xe60776879b2c297b, 0x3af252a1c4893d48, 0x1b44c45a257764fd, 0x6b98f18a8ee80a9b, 0x9e7e93487294aa5d, 0x157dda9635602be2, 0x0b3f53420bfd8bbf, 0x5898880e6b682165
+, 0x0d722bc26012299a, 0x3b3546aed0c8319e, 0xb7c6e19c7b56fd19, 0x5d9247e9349723f1, 0xcb47b0888e6cd5a3, 0x52e42a9e90379cba, 0xf446254a6a682c6b, 0x6f4e42a95b7d6fbe, 0x369751f41ece6f86, 0x049ebb332111d488, 0xe563e0305e7d377d, 0x0c8def3e2eaa3b65
+, 0x5e14eb2044de8fea, 0x5c5f0a874c3dd1fd, 0xbd0058577c64df1f, 0x6b8fc66ac58dd208, 0x23cac642f3fc4de5, 0x2521cc00bdaa04ff, 0x57a5dcf329ecf7aa, 0x4ac9b17106f66dac, 0x9c75810fd96efb70, 0x7c528001a704105d, 0xab8050138033c336, 0x526753b3c05d1222
+, 0x63ee5bec589d029b, 0x1201f308cb4017b9, 0x6205ec496c816984, 0x18291daa3b962453, 0xbdffe7980587d4c5, 0x1e2da12e85220650, 0x706a801a11388a4b, 0x63ba42d0c20a5c1a, 0x13ceb3405166b42d, 0x1c20c4857321e2dd, 0x348b3e6eae7351eb, 0x635003b98e4d3ec1
+, 0xce1969e8cc0e26f7, 0x18d0f77ff565ce7f, 0x94270ff5fbf01134, 0x7e3da661825a3af6, 0xc6510f2f598e630b, 0x09161692424c10df, 0x4d7faa0b769bb7eb, 0x1ed8c31a0de7f3d4, 0xac2d87127285827a, 0x72c1ae6d14320584, 0xa23bd37e5a4146b5, 0x258be33ba4091249
+, 0xc4def2c463095326, 0x57b8ce85f1120c18, 0x9f2676d4506137af, 0x0f8fef8937729324, 0x829a8a63582f7b7e, 0x4e68caf1f4f2f3c5, 0xb0f4fbca616d5d39, 0x2bd52a1960719c11, 0x69b70b9d85bd4490, 0x71a9bea9ddad7c9d, 0x62ebd9258b6156bf, 0x3240e85cca4665e9
+, 0x78429de94e0aa343, 0x3d4ce556849e40c1, 0xd20093121284caf4, 0x148e40e6a8872009, 0x8db880a498450c53, 0x0a67ada1ba05c803, 0x4aeb0504b6e8d65d, 0x04f51b6001ccad05, 0x5730565bfe0ccc66, 0x3601d600e063246f, 0x5af620aa147b364c, 0x6e843e0b34e8ac40
+, 0x4c28d33be38c2fdf, 0x34dc3a0b1732fc81, 0xf4de526ffdfe5a0c, 0x03711d3ba0bffbea, 0xb8659eb4d19251d1, 0x7ba4e1fa7d650944, 0x06ba803db1534ee9, 0x26872d5847e073f7, 0xdbc50a440b6e8021, 0x0d1d86a9393ed878, 0x300bdae71b96e6ce, 0x0f7b56f51d92f3f7
+, 0x7077011622b5da86, 0x79d64769fe7380ee, 0x8f5398ea3300d3b4, 0x35c69839381a4de8, 0x0b35b9ff09d7f1da, 0x1752e54aa48ea0c6, 0xd3955f4787d5ac7f, 0x0a3190ee4668c447, 0x9096f02ab12e410e, 0x607d1c6e143a6548, 0x6328565786e1243f, 0x6a80f6be0abcaf5b
+, 0xe8b111c25b6b6189, 0x452ed49c9a378593, 0x49cb09ac96000a15, 0x7c3ae51cea6e373e, 0x4649616d4f01fbb3, 0x5039907dbc47f129, 0x0455845e6957e954, 0x73efd468d2df2dc7, 0x26591a756d479f61, 0x626d600d2fc3c4dc, 0xc3c2511dbef3c437, 0x4f1e143676e2621f
+, 0x4d9676ded83cc558, 0x2b5550befc3c68c7, 0x5c7b25aeec0a4afc, 0x0fd8001abd34532f, 0x00e67a7f0ece9c8f, 0x27e90db15a5af42b, 0xea3492d1770ae1fd, 0x2832cde9440ec4a9, 0x3c559f17f429c70c, 0x7a33e3884c834c36, 0xadb150f3f09c2590, 0x02c3ed35fe90203d
+, 0xbd5018d9c6bd998b, 0x77c8a1a27e09a4a1, 0x97c31e94cf94d8c3, 0x182165daabccfb88, 0xc8c35366001a7bbc, 0x7048eaefb9c546e5, 0xaac9e2dd607922b5, 0x36a1f40152930a1a, 0xd64e81351849f6c6, 0x4f37488340593a9d, 0x7a1885514df39a13, 0x4d7d1a665b2eb8f4
+, 0x58b32b88de702cf3, 0x0629e29fce606bc1, 0x084eadbcf64e1523, 0x0279089e0f190172, 0x94bde4b18a720370, 0x7f07a9b3b0ebabfd, 0xd86ec6ffe8107ab1, 0x0ff4f82792dca729, 0x4561a77fa3d1ad3b, 0x53fe0a46667b6839, 0xfcbeea2d21ac9f6b, 0x1d5bf51e806a3734
+, 0xa3df6ba0b3e89039, 0x28324410d442daa1, 0xdb1a1643383af9d9, 0x7b5f7bbf5154d160, 0xa929c1901ac6012c, 0x013e44980ba82536, 0xe5ca8d1422ee35b1, 0x4395c3ce0ed02c54, 0x748d4f7c4afb0ab9, 0x079809b0282f2913, 0xbaeb1f6db5e845e4, 0x67c426ddd10e31d8
+, 0x1937276ee9aa8a58, 0x46621cfdcf99ddcb, 0xd724b81d21a6261f, 0x249e8c440a7b8bc8, 0x89c49035905bc344, 0x1d1722b78038e0b2, 0xcb1a0394a16c166a, 0x238f5634f82a8d53, 0x8e43abd3ece061d9, 0x04a6711ac3d98b6e, 0xb013e56878e8d207, 0x1912a0d533bc31ef
+, 0xfb83291260a137db, 0x619f3f5caf45d03c, 0x7a0c9126008f63bb, 0x0df880575d8ae903, 0xfe984db7ba168f28, 0x19b785709c2ec903, 0x2c49765061e2af50, 0x6dbe0a224fc82626, 0xd5ffcaabaa59fbc9, 0x1911d1aae60eda1b, 0x054c344c34879059, 0x434c72216578177a
+, 0x4b3e89af6518eecc, 0x1b0bc539d647d457, 0x398d92697b78e291, 0x7e2493325bd1ea8b, 0x7ad0676312f40d3c, 0x5ad9acfb8198f735, 0x0b93f231cec6ca4b, 0x5b2eed2d3d091415, 0xe7cff1435c5f9f1f, 0x15e450dd19fe791b, 0x6a6344f482bfa4c6, 0x6b129548a3109131
+, 0x0ec6cc0a5717d8ad, 0x235b882a5a6e7555, 0x1356ec27bbdc5d60, 0x01f497083b79701e, 0xf3801de09774cc3f, 0x51f92f68d45c2228, 0x842a57be8b355414, 0x4539cedb79de5ccd, 0x667140cd02389083, 0x562770fd07255d25, 0x4a13a92e21d2335c, 0x171e6a154c70fa00
+, 0xf7e371f7eae38134, 0x248c237f598b08c3, 0xbaab9c5e6a9acf4d, 0x61784384e2519b16, 0xeb0ee63adbaa9a91, 0x402c32c603c0ffbe, 0xd2f203603534c6b5, 0x61a3a2688f1062da, 0x5fe66a39a0c45924, 0x36cfbf0ac5b6a150, 0x1b779b9805c6655e, 0x014d27374cf8be1e
+, 0xbef7a4a67d2b1590, 0x763eeaf8c3f0adc7, 0xb514091a9de96574, 0x2e1e2ad45ea387a6, 0x2f69e6f15a68df94, 0x54aca4ba5226856b, 0x2d465d2ad4497160, 0x363284ab91e2fc8d, 0xee36ef92d3bd6c7a, 0x069cf321fd424c7f, 0xadd3fe96c1ce0d1c, 0x1076d99cfe725aa2
+, 0x77323375c5fc22e8, 0x5317f459159c8118, 0xb783dd40dfa067f1, 0x15d367ff9eae7c16, 0x31093bf150c2f8c0, 0x29827f59b7e40bce, 0xe04c7da20d1b90b6, 0x0dea3590fef51fc9, 0x3569630557a8a08e, 0x68f28a3cfa5e0991, 0x07de3f680ef49362, 0x59f9f71dcc35ae32
+, 0x4933f41b9cd4e48d, 0x700321413b587663, 0x762b4093b8a779ae, 0x329a542235e91079, 0x3e18712e146baae9, 0x14019cb9171bec2c, 0x01f0a40ac38117ac, 0x46a4ab9c6d155412, 0x2a353c0ef74f3a9b, 0x15b47d1b7eee5995, 0x108f96d00d957d29, 0x2f270e9baf48c684
+, 0x6e183af8f62855f1, 0x6d4a061e42d37599, 0x7292a1a648a1dcc0, 0x72e1311853f0402e, 0xada7272e630ca30f, 0x083f59212fdf48e8, 0x9cdd130ce20efdc0, 0x4819db3dbae4f4ce, 0x19dcc43771cae2ae, 0x49f4e59f8dc5b10e, 0xcaf0ea5eda9c164d, 0x09a10dfb1aafecb0
+, 0xcc33bd98f7b3237c, 0x7c1c1c8a0b478a48, 0xdd2ac833059946c8, 0x6b59f2204cd0bb20, 0xcc6da400d1803c1e, 0x0e2718dbfdfa00f7, 0xbd507be8e86488d0, 0x18c5ccc7f008226f, 0xcdf37cbcb1da63c5, 0x58482577c7b58190, 0x82c814c2f58f8af8, 0x44343f844c65ea03
+, 0x110fa64c59b69c9d, 0x6beb28c5e3c11bc7, 0x789cc022b3899510, 0x285be4767ab05fda, 0x6331400352046f28, 0x065c405a66d29fc5, 0xa6f13d776170a713, 0x44aaede9fdc7d6c8, 0x8781ea6ff12e3aec, 0x3af26f3e5e59ce25, 0xd8c525de126e022d, 0x03789618222dcc4d
+, 0x857f04c83f24ff63, 0x49e55ee644d4c2dd, 0x81c2bd4fe64aa553, 0x27acf7170b6c3605, 0xb86017908304d78f, 0x4eaca811874d6443, 0x2cfc7658da50fd6a, 0x224cc4ca01a04251, 0x6ce44d868ca64d27, 0x082c6b406fc7585b, 0xd529613c930ae8b8, 0x09a667cc65ece222
+, 0x948dcc0e3bd0d604, 0x7c34a46e08f7744b, 0x5548f37e4849f78d, 0x327bd066d1e6fae5, 0x0b1cf03e36fe2224, 0x3a5ff4c734eaf880, 0xaac69fe92c3b7fb5, 0x4104113dc17eee7c, 0xdafd92f5596f0e11, 0x34c028c151dbcad6, 0xa4520a9d5143051f, 0x666bce0582754e2b
+, 0x3ebbc2a58575578a, 0x109a6c9adf22fb4f, 0xd05548e34e2c860b, 0x18eda629bd0f6a26, 0xd747cf67899ae871, 0x4ceefddc7eba078a, 0x8302cb0eb0753406, 0x0048b0569175726c, 0x7c4edff8667b0ec5, 0x336fa59ab32458f4, 0x76d071fe4afb073f, 0x7e318ae456def24d
+, 0x2fccdf5e9f8a98f8, 0x1c419b08a7504a7f, 0x93e12a3089cfcd17, 0x39e1fe37c5a6bf57, 0xe7b81064fa33d212, 0x44e0eecc0bc0f9d6, 0x753de78e37a2ca91, 0x670fe3840111210c, 0xd1f307f164eaeb10, 0x7c2766c4c61ca151, 0xcc568ec6bb77889f, 0x4dc84d90b80bb93a
+, 0xfb903088b66888b0, 0x1f141b8725959abc, 0x307aca7a2aaf0818, 0x3ffa8a2de61098d0, 0xf1d93bbb403ea642, 0x0a1993df89485842, 0x05b5369664caf77b, 0x2e2248b5bdf1fa8c, 0x78e68aca850619b2, 0x1d5502f054d57c7a, 0x5ab211b8554ff508, 0x023e0f8604c81816
+, 0x6caa4a4e975ccf18, 0x52b0947cae335761, 0x41f56a1bc7b406ab, 0x3d79af561f6c07c2, 0x1622c3a863e26b83, 0x78673016dad2e497, 0x2f94a72c4b00d390, 0x185119d13117ce64, 0x027b09394ed3bed4, 0x7f51a5d7f86a8f98, 0x3eb43fc8b2b361c2, 0x72af4f242c795e0e
+, 0x308e87da7d3dc530, 0x6f9553618be27f47, 0x197c40d121de9e01, 0x6e34ad4f693b8700, 0x932098056c06b80f, 0x6b3be9761d7f8dab, 0xf365e7ab55da1104, 0x3e8664a68d9d12dd, 0x5545b66254fd3803, 0x5861c13e8e3c40cd, 0x38c65922bb18db66, 0x431eeb94b0ccbf39
+, 0xc41aad3beea62cdc, 0x1ccf42b939fc1c75, 0xfcce9b8046902815, 0x541aace8098e6a7c, 0xc0dc1d4760ab37af, 0x4b09c6bd81461c45, 0x94f6c30b6491c646, 0x623245739cb8478b, 0xbe1d2dc02d9f7bdd, 0x1dcdb5842cb3a3e2, 0x3e4835d04adcf575, 0x69ad08493db51fc3
+, 0x05e5e42fde7e5061, 0x463d2162780995cf, 0xa998734ec54658ba, 0x3e61e78e2c5b7305, 0x9fbaa4f8a8843a4a, 0x2a6801b5eeb7e5b3, 0x4d7b0a791adf1e5e, 0x064da647fbea08f7, 0xcbd1c2bc03b5167f, 0x7f8e7069dde7b5c5, 0x733055bf16da95fb, 0x0d3351728bba9858
+, 0xa2a4be8104b5dafa, 0x480e41ca17a21615, 0xad6958b7908361fb, 0x42994dff39d64d2b, 0xdc83033834b630ca, 0x7adeb479f15a05ab, 0x16213a07bb5ef484, 0x00f1aa2d215a5998, 0xe03d0f59513a6dfb, 0x600217d75c94b328, 0x8acff9efca1623bb, 0x0773d111b84f4f36
+, 0x0792bbd7cefe57e8, 0x2439bed387e8376b, 0x173e821d9f56cef2, 0x19b8de030bbcf368, 0x175eb0668564e3fb, 0x2ef989e14c72699c, 0xa68731c8e773d1e4, 0x6329cc70b3b7bcb4, 0x77c1706daed36020, 0x3e44953cb4909468, 0x906032e1483ba649, 0x31934c475d5326c8
+, 0x7bca73fce3fa31fe, 0x2af7694536f24ab2, 0x7db360e9b90cfb79, 0x544aec94acb689c0, 0x66aa7867fac3b974, 0x3f9c19449d0ba8f7, 0xe3cf3596448c1ce8, 0x04950756d19707c8, 0x74afd55e840d789a, 0x267a484574a5b377, 0x986b19fc2e0d64ec, 0x21c0cb47bfd3062e
+, 0x4e675289ff0fa3e3, 0x164bab7cd34dde0f, 0x31fb9c1ca670f455, 0x35e1e8a42aa2ce74, 0xff4ca3245b4dcd5d, 0x20538e65dcec73ce, 0x3488e5f5329284d5, 0x3003131e4f970295, 0x46fdc0bde8604fe2, 0x4b15caae9fb4e8c8, 0x9b14570aefa07fb6, 0x0aa6a4183d21c1e1
+, 0x6dabc8eee5196f37, 0x63416e116ac71fd3, 0x86ab08168263cc62, 0x0bb274589623d1d6, 0x8b95b8e28aeda6ca, 0x0fb9172e68cba72c, 0x923c05fdab7050ad, 0x106f551aaf0d907c, 0xa784ef6ce606f3d3, 0x1c32ca365f9b8f43, 0x7f5bc500c91ce8b6, 0x16fe914ff5e1c3c7
+, 0xb2c3b2612f27625e, 0x2af8fe2d30d1d975, 0x6b1cccd5eb13522d, 0x4261897bbf999147, 0x3b874d60c5976196, 0x4060ca1a425dd08f, 0xf2b01a53e5bd0e6e, 0x55dc04eb6ef960d2, 0x06330b33e08c050d, 0x4065fff7c3ff0759, 0xc1bddf3ece655a84, 0x7a9f8f6e1d430a3f
+, 0x40da643b23be759b, 0x43bbc6b07002c65f, 0xdf269e7d0ce2e8f0, 0x600b6e48114ed804, 0xf271883b00cb1b5e, 0x4d55c2734134a889, 0xcff19807fb588fb4, 0x6baac279a1d593f9, 0xb68f0147d550fa77, 0x709a1ff7d2694a03, 0x1cfd48f6d561afdf, 0x06ce5b8491cd21f4
+, 0x348f586773e7c6d9, 0x6de98c5021863902, 0xfdf5ae36cae79418, 0x5f54f4ff7cb63c8d, 0x044bc5ff80d20eae, 0x3d5a76cb0b36b68d, 0xfd8459a5fdf5a309, 0x00b228d1b609774b, 0x45c3420cad2b6bca, 0x205c1d8eb49f6832, 0x3b86dabcad8b2712, 0x6f524bc38be96906
+, 0xe2ac2d79134c88d9, 0x3deac6dc7e91a9b0, 0x16b5d5882d9b7efe, 0x3f8bb0932ec4dc94, 0x483e999bc366117a, 0x7c63ad886afcf439, 0xc807806f0219d925, 0x4bb1466f02457b6a, 0x9f9c732e38b76a26, 0x457a9a9581a7b0e3, 0x33eb985759eafce7, 0x3ba79546b6d9bd00
+, 0x3699462bfffca44a, 0x792a825f3ee93807, 0x7dc7d65ed9adfd81, 0x6d12da1eb1727fad, 0xfc75020106d62db3, 0x6c461db1e8a7d636, 0xb7a825afecc45cdc, 0x6df381eda0d8ee54, 0x331bd5e5b6a4c71f, 0x71c27af5183683e2, 0x6867eaebf3f81a33, 0x3deb9c64faecc9d7
+, 0x53cf84418a86ffb9, 0x67efb6b7b802b418, 0x90c0c6198a1fa1f7, 0x404106d16c6b7513, 0x64fe2b4278eda9fe, 0x6c22784eaaa2ca5d, 0x3760f02925f0086d, 0x5f2ed0ab5e2b1a6b, 0x59fa1d099fa9aaab, 0x5b06d247354c416a, 0xbe01432ad3b2b394, 0x134118a8b29ae75f
+, 0x5611598a93357f51, 0x7a5c2cb4574b67d5, 0x4906781027708612, 0x6454099d18e7a306, 0xa067731ed0c32a33, 0x3416d97ba5275d1f, 0x98ae8b5273e477c0, 0x39ce2bdd9cccead0, 0x06e475c0b1b5442c, 0x44a89ab1b991fac9, 0x5aef5cd095ddea73, 0x378bdcbe2cc15eb1
+, 0x07143ad0c6347e97, 0x0511ebe614fab90f, 0x4162896a3d80db90, 0x0d2bcc801cdc1536, 0xe713a06d6e87de4a, 0x27edda2a75710f17, 0x5199dde28abebb43, 0x6b5d255443dfde0e, 0xd5627ba2b5382412, 0x196ec203bd772207, 0x11321f457593b696, 0x19c601d904bd8b3d
+, 0x9afdd4e3986c4eb9, 0x4ae853f0d0e1daa5, 0x297e8cd6846ca613, 0x41290428ea40ecf7, 0x86a56f3efa18c585, 0x0d584dafe0c32760, 0xe737c1d08ba62ac2, 0x54415167189b9f40, 0xa1ecec87e4bf688d, 0x24b69c841f6f2d53, 0x248d302e9324604e, 0x6b381021a7034b5c
+, 0x87dc87d32c54e031, 0x7acb0867b7ff9081, 0x310bfc3f1ca12810, 0x38df3e80f96e35aa, 0x3120e8a61381a443, 0x7666f963a59dd7d5, 0x7db0584458630f50, 0x2605b15a41a648c7, 0x639a057c128b388e, 0x2d2dda44a433574e, 0xffd4d22d5e5b5f7d, 0x2c67a2cad4259e6c
+, 0x4c3458ceb80914c6, 0x7c99b3a6780830bf, 0x1305ec5c0d2a63e1, 0x77786287c0b4def8, 0xeed1b03158857ae7, 0x6aa4bbb7d3000b5b, 0xe57ae179b80deb6a, 0x7a7b532d99dc6b9b, 0x7cbbe54877a502c8, 0x33f7299aecc04e11, 0xe4221a6549984adb, 0x6a0ea8dc61672a05
+, 0x6691c0400a03ceb5, 0x43ad07293fe12e0e, 0x1a05f2066bf94f6d, 0x41ac61a7700db9a6, 0x9b50768a6b24482d, 0x703bb987f8dc3771, 0x6e4301a80054c70f, 0x176c6ba7b0dc28c1, 0x52d966b28b39ba61, 0x6dd6068e4a856621, 0x65baac1ce8f98620, 0x1c88b7078fdc22a7
+, 0xabc766e815210532, 0x79428c2b39472fdf, 0x7b8ada5137d669cc, 0x498c7c7233a6306a, 0xed1aa4f1376ec66e, 0x4ac52395e4e6d6ee, 0x4ab1ceb516313fd9, 0x39b94b52d6bdd62d, 0x4c1e969b74748631, 0x5d5722c95bf2756b, 0xafdb0d74b9d36b01, 0x640b4352dda6105d
+, 0x535a036eac7076b6, 0x18b587d362af2c63, 0x32feab8a60408e48, 0x7fc35a281eff628f, 0x03f4da72b8c96690, 0x5bea5febadbbd75b, 0x169418c83f63f57e, 0x048ab681bacc027d, 0x7bcab7cdf63aa639, 0x6bda9cb65f303112, 0x71c30994298bfdf5, 0x3bad19fe29246e2b
+, 0xa84ab6da13ed11a5, 0x7cb2c1d684251883, 0x50a2497b23b5b97b, 0x589272aa08b1f958, 0xb7c951ef02617c29, 0x7336bcf6a451cbf2, 0x05219d8e15b88d5c, 0x0839a42f8ba4ec47, 0x934f76443a81695b, 0x08eda0d3d122f881, 0x3f642b73bcefaf67, 0x6b6853b87fe3546a
+, 0xd1826a3fa5150748, 0x666174adc9546c34, 0x6f4f2b44b867cdd8, 0x127aee34f54c4fb0, 0x337f13636d190629, 0x150c33ca930aeac3, 0xaf0c44033e301b03, 0x19900d5cecc391f6, 0xd678c319aadcf5ca, 0x4ae448c0176b378f, 0xff50fd3bc0ccc502, 0x3bcb167ed4bfad77
+, 0x6e7fd4fa15a128a8, 0x0344bc3dfd92d609, 0x7b491a722d6dfebd, 0x0164ea16c6310a74, 0x02f8386c5447ca3d, 0x6fca7402013b5ec5, 0xeb486e287affa37e, 0x60d48f313564c76e, 0x1903da90d40d682d, 0x5da6dc4e9642e84f, 0xd5ad848002a3d49f, 0x1f2dd157c510ee0e
+, 0x6eb2497211b9d817, 0x73c533c6682e6ec5, 0xf8979633e3b7dc0d, 0x7f0fe2d59a27eeb0, 0x8cf75d74b3323077, 0x329e585f595728b4, 0xabaa457f9f8ebfbd, 0x0c2776320af009ff, 0x0daaf2b80f805a47, 0x5bf4d516942cf935, 0xdc940a5d8f78f500, 0x68dbc7833d8e0104
+, 0xb0b4cc82e4ddba82, 0x24057a74e73c4559, 0xed312432fc51d8d4, 0x08aaeb2e89c29c5a, 0x9a3a212e270f1db8, 0x74ba787b5057664e, 0x4e643bf36a0e9337, 0x052b6ee84f968688, 0x940e91229693075c, 0x6e17b773b1a23180, 0x5c5c3149bbd47276, 0x6eda0e41b93f2e37
+, 0x9aeeb7682fd2c3c1, 0x7062d112efe71007, 0xcbb4979e0109cf49, 0x1d01798130a2a8b8, 0x7d3cd49787e63bd6, 0x5adb086d9da2bff1, 0xe8d73e42c7602c8f, 0x6c9f531017addcc9, 0x09cfdabc0ae831dd, 0x69f10ec83e3a5ff8, 0x88468a1200c44041, 0x5e8ab9dff0cb6798
+, 0x67337c49a883fa61, 0x36904c0450d3ea6c, 0xf09ffef2efb0d81a, 0x63d94c663e7a9884, 0x89caee2ea6252c83, 0x2ce7db67dde9f4d9, 0x5d425be530d9f2fc, 0x7896c7737c98e07e, 0xbdec22aaa9944ebd, 0x5d7741f7be603aae, 0x21d483f206b87379, 0x70cefedaa7a5ac43
+, 0x5c38bd5fc08b02d9, 0x0320b9296c4a68c2, 0xd5d23823ef20974f, 0x39edd3033ba93b88, 0xbe1583fad0b73f15, 0x0c56872597fc5c90, 0x20c441502a29b8e2, 0x7242469cc596c4d2, 0xd8c3abedb6a266ca, 0x6217b53912996186, 0x28114f295eeda255, 0x08f25da2c92a698f
+, 0x026dc9b5663c2e6f, 0x328832a11d2840c1, 0x0044a7b4cc3f850e, 0x587278f160c4e711, 0x44ef5860c77ef2c0, 0x22a39a075a358ea0, 0xde591e66fc7ecf36, 0x42397ff893c0e662, 0x77250827b84ca63f, 0x60767917ef15ff22, 0x1dde698b1831179b, 0x4dcf7aa6fadd534c
+, 0x5652d040a47baeb4, 0x5f45d31ecded853e, 0x2926a94140e26309, 0x463e14c02e45391b, 0x2b0d8371d8339973, 0x125f3e6a83bc6703, 0xd736e6f503386d26, 0x15926e9cdfb3fe31, 0xde4d86c0ed820e32, 0x3ae197438241ed14, 0xfe68de7afb312c19, 0x324bf1cb2223220c
+, 0x10e5ae3001f0eb38, 0x7b84b2e9c133d8d9, 0x077706e1352d16cc, 0x04d976486a1a6bae, 0x50e35aac48b8014a, 0x2f4022b4b5a23456, 0xd35d0e1d03b85d8d, 0x4b03f0767e2186f8, 0x319d1528bd93e797, 0x19f83be8d2581c38, 0xaadd93917514d801, 0x33dbbaee50957e89
+, 0x7a9975f68470fb28, 0x54952bf0f089a18c, 0xa64cc74578b4aa40, 0x444ce19fcf31f387, 0xb6185bc420ed46c3, 0x20c2527bd629fcee, 0x14d672640e896825, 0x6597de3b36e9ef6a, 0x46c0889664549ca7, 0x7a6d12440feed09e, 0x412377022356253e, 0x12d56369fbf7c10c
+, 0xcb77d47964f15c62, 0x7fcb5ac61d45b5b8, 0x3b8947345f88afe4, 0x1c22d3edb5f6e199, 0x11fe9669c187d234, 0x55340111c89fa0df, 0xe3fed0a554df5b5f, 0x7ee1f699565bbf02, 0xb3ed3a157a2ed2f0, 0x1739d22e13584a72, 0x975a6a04b580647c, 0x72780e9ea55b7d14
+, 0x0c11dc9dc6e95c9d, 0x7cb2cca96ceda71f, 0xe912328db1603496, 0x5fe5291a146ff8e0, 0xa61a09a8a4824f67, 0x791c809cdbd5558c, 0x483077e3f215ca9e, 0x051f279d8d552d4b, 0x86ae7ae6460fc411, 0x74ed1181e3269dfe, 0xb9a7c2a3ef4f11f7, 0x0af619d4f2f95992
+, 0x356a6d5c55d32b2c, 0x3031c56835a8f8ac, 0xdb54b027514735bc, 0x6b0ae9fe3baa7e9e, 0x9b1858801a526de7, 0x362345a9c0c19ea3, 0x0f0b9fe64be27609, 0x3c72c5c15e647a3f, 0xd0d32798754cf4c8, 0x5aa336f426b7e272, 0x829d4b8a1140af1c, 0x62a4f493593e5951
+, 0xbfb3e49b55c62dea, 0x6d39f7104b393457, 0xe67755fdeb389dd6, 0x08e90c3152440224, 0x8ca33d483c0c9a4c, 0x370587913a3d66c7, 0x6d440e0fd94a4f29, 0x18cf3da1c3513f60, 0x75ef1d049cc76b26, 0x15350a9c10891207, 0x1d4d792431518485, 0x358271dd919985e8
+, 0xdb83f509657c1c4f, 0x73c10d124c3fa85c, 0x79a464b39810893d, 0x43f74b921f4226fb, 0x35971a1a9027bb3e, 0x5649bb2138195a56, 0x1f0f558d688cfdd5, 0x1f2710fbbebeb08f, 0x2178f7ff5627b907, 0x2d50716acb0cbd2f, 0x7749df3bc7761d50, 0x345ab0d3e37997f2
+, 0x4d2ba95d5f33ba2c, 0x22aca9fc22b7689f, 0xae08a09a43b6c3d8, 0x33659e4e1acd8f3f, 0x1cb1f6ff1e08d288, 0x58df66d015cc3521, 0x91f82269c99eba35, 0x36cef552c4a38036, 0x704ff625b30b5e49, 0x42fe7eaf5c5a1d40, 0x9dc1bfd4f99551e4, 0x11b84b6a2ee3638b
+, 0xfb8100659558049e, 0x3085c623748a0383, 0xd2bcfe42c7f09ca6, 0x3ed26865011ac025, 0x86c8e05607bd5cce, 0x637103fb85bbbc36, 0xc1c873eb4f5d951b, 0x6f8088b9823b727d, 0x7d029acdaa49b163, 0x2ac3563dbacb2baf, 0x90e443cfe99e8968, 0x0d3f783e59a7b8ea
+, 0x3082621d564d07f1, 0x4c2cbe1a4b4122be, 0x10963e899c2edc05, 0x7435ae474a47a65d, 0x9ab6a245820ef574, 0x3a9abfc9e45f68b4, 0x9e4a10d3b61f8537, 0x6524578c3d95184d, 0x6db466253da8b86f, 0x391ca177ceb50dcf, 0xdd8f1f34ffef2c65, 0x54f1f9e4dcecef6a
+, 0x39f77ff17d83ed7d, 0x410dc9b741c8b2e3, 0x4b0b1afb2e28ea8e, 0x43b6a5614fbe2bda, 0x6cd2b9563b7f7b48, 0x091a84609b2a6e0f, 0x9b67ec1b24ca35ab, 0x379ad6a66187b405, 0x5d80cc5d040c7d77, 0x56135ce5beabf1ac, 0x94fb1f210a32adc8, 0x08bae671ac7d8ac2
+, 0x3948b2fbf7bf2098, 0x19d4c6533f036d05, 0x8e4c8c54d7994385, 0x0ff46d9e36af676e, 0x255b1456cabc710d, 0x5b506093bac6ca41, 0xa7b8cf30e7267604, 0x3df97f29d5dd90bb, 0x188c3002b33a20e4, 0x4cc39936cf85eb7b, 0xa758fafaa9f00fd4, 0x4635d5527c18226f
+, 0x05e0c29567c0904e, 0x2d3c022382080a35, 0xaa77e5708293e223, 0x612c6dc19cd11ff2, 0x90ec9a9820438e22, 0x435f5c21be5399ab, 0x754965854e11af72, 0x106cd3de01e8201a, 0x053f0e55321d8595, 0x33e2cbc63182c2d5, 0x40bc2de82e35ad46, 0x2cdb3fc6cfa59f5c
+, 0x156f3cf18412d643, 0x5d911020d7647e0d, 0x00ba48e238bf0e60, 0x060dbefe0bdbd594, 0xca949c09adeb5942, 0x587618a8764ceb0a, 0x44373d89057fd5de, 0x4196ac996be12e26, 0xbedb748e86d8cb51, 0x5ffbf3b5a5978990, 0x180888027f96ee43, 0x77648c7225d43bb1
+, 0xa4fe84eab6296579, 0x782f82a5deab66be, 0xcb0ef9a011f0d230, 0x56d32df2074119ff, 0xa04622cf8382e408, 0x33ac65be4a346d38, 0xd1f99d4e35b31588, 0x01d5d52b7c9c7676, 0x9eca760b4bc69b3c, 0x2417152e1cfb1aee, 0x72a9aae6ef3b3d28, 0x128163fd1bd4aad8
+, 0x341dce477b56408c, 0x009134c2120fbc2c, 0x19a3633faf6672c8, 0x4ecd925090ada8fa, 0x6852af8b094afc81, 0x06e0f8211c312d1c, 0xac82c99fb48903be, 0x2c014da23c4e2d97, 0x9c6b82b76b7a69ac, 0x36b0362e38dcb986, 0xdca59bf45ea27c64, 0x3a7688e837fed619
+, 0x4dea868a0df2f2c0, 0x0c8d99d13c2b3a8e, 0xb1cd927bcdc7c26c, 0x50d74b9dd4aa76c0, 0x7990faecc435a633, 0x75cfc41c43e6d921, 0x3a12394fd204a5de, 0x6c51151a703ca5c1, 0x90e32a5a946c3baa, 0x7824aa1a17025133, 0x743eb83e7d0e86db, 0x6c17cac6a7048e2e
+, 0x81fe47843fe4c1c0, 0x25c9aa7191290aa0, 0xf4b918e93c2908e0, 0x1f8445bec38b68df, 0xd56f862d1b8a2238, 0x67ae624801091519, 0x7676d6bf0a68c969, 0x58ca0c94bc2dfe9e, 0xa8bd1595fd9c59c6, 0x6d4809a549092178, 0x5cb576da734a9a37, 0x22b88c3b00998e62
+, 0x2972b93f7ba08ef5, 0x07f8fb1593b465e5, 0x004bb6874eb6d874, 0x32b894925a97e7c1, 0xf31535e562d93dbf, 0x71f08ed31a8e6aeb, 0x0c4ab462eda11664, 0x107f4dbeebd5d17b, 0x82b342cb58981b2f, 0x3048364065195407, 0x2e18370c2dac7f88, 0x77e3e22d8749a1fa
+, 0x36d03570bd0962b9, 0x051143b15a722ac3, 0x468ff06032f12f19, 0x3a0be48096a9cdc2, 0xf92a4ec2d1121bdd, 0x3c3b3ef185c612e4, 0xd5ca3e4521dc3b3d, 0x2eee8936e298e035, 0x858481d02c31cf97, 0x1fb359e42784d7cb, 0xe11d6554067fc329, 0x29d342dc5afe692d
+, 0x32e163a198374746, 0x3ca1bc178a7c3923, 0xa7b4527859afa0e5, 0x580acff35e6cf034, 0x632ab1e63b3f74b7, 0x3f70d0616b81dc2e, 0x2862df3d48ce8f25, 0x74599fe82019fe13, 0x79dcf7fe35973bb3, 0x2e78220abc708774, 0x7f2646bacce07a84, 0x273e980dc6a3fb8c
+, 0x9a03e632c18805c0, 0x6e6bedcd3be0d1f6, 0x9cbe759ef3752010, 0x132e13f4aa06f370, 0x8547485649e21394, 0x40de2e6a36043311, 0x834e350cbd8e35b7, 0x14de4a0e936b4fa4, 0xea74137cf00bbe30, 0x4832546e18de7c52, 0xd53fc202dc984929, 0x14c20b1c792b3235
+, 0x7ac9303191dd7690, 0x21b9afb33dfe837b, 0x6683575d6b873684, 0x5a21ddf450c885b7, 0xc3a43519e8db22af, 0x5736cf45e6517758, 0xbf5cc1c69f7ee365, 0x6d9008b187d493dc, 0xe32cabe1b851a520, 0x5f1fe728823c3677, 0x828d6998b98bd16c, 0x13d43c27ac91632b
+, 0x3fb43018d4f64510, 0x3420042d34d10ecc, 0x8afc24f65cfb4d8a, 0x317967173e0e3089, 0xd61e938a4253a0d7, 0x220bd570fbd446d3, 0x98f6d7195324e843, 0x669fe235b3c62290, 0x9bc9bd0632aecce3, 0x4cba8ac35bda468f, 0xe2db805c08e1e583, 0x119d1aeab26bca66
+, 0x1b7256d6af3d5e44, 0x361876c7ec8677b5, 0xcc73d00ceb347733, 0x47dee4df898bab98, 0xe1bd119ecf417dc5, 0x37be6f2af86570b9, 0x70add9a063addf00, 0x74061d1e501700a1, 0x475eaa43643fc837, 0x3cc0f71979314520, 0x0e4293c0db398cd9, 0x0abea60fdd61e8d3
+, 0x02cb06db374ad818, 0x306469fe453ff9cb, 0xf9ec359c28d14ea2, 0x6e6e97c9cf3d26cb, 0xc6338c4d4994d0b4, 0x32494672af1b13df, 0x85bb696f43b3a0f3, 0x774c8e8e9adec9d0, 0x194d1cf09abce26e, 0x1191cde3e59e234d, 0x5ed8fe44a2306798, 0x54a8a2f728763113
+, 0xcdd52123fe32b461, 0x5a61b3d789f50544, 0x7cccc5749a38a76b, 0x70bf625fb638298b, 0x03b9e64add453b04, 0x64bd422b2a93c432, 0xa4329b2a02beedb7, 0x5b27cd1e328fbaba, 0xe80fdcfba4200198, 0x4150dc926dd9ee83, 0x7e4367de9a55d3eb, 0x6d18b9cb07572ac1
+, 0x17c2d6a62d464869, 0x09414e5294b2b2c5, 0x5ba47a76099c7583, 0x64ee24387002b9b7, 0xed8cfd9b5b8a5342, 0x7befd8cdbc38bbcd, 0x654c1fa36e406a53, 0x1f379e70c60a998c, 0x68eb008e5694d206, 0x6d87e593d84b0624, 0x7dd93a753c8f701b, 0x69272ac1dfc3829e
+, 0x3c6e4cdb04e644ce, 0x4fc947692f291875, 0xdcc57ee962935b47, 0x043234d711f453ad, 0xbaca720167413381, 0x6cae85bd4717e88b, 0x52e93d741eaaead4, 0x3adcef8a4913d95c, 0x0e22a18029842245, 0x14157cc50669676a, 0x5b1d2c7ba04b8f0a, 0x07a4ac849ef23b4d
+, 0xf828bbe822f31663, 0x72b0a103e0d8ed44, 0x9584885599f1af73, 0x7b940734897eb834, 0x17a020891c565af5, 0x3453b542c85e7c6f, 0xcbdfcb5070b9f080, 0x33f2c5c93795bda3, 0x114889d46c8d9e83, 0x65f11e4f5c0d0fcb, 0x4024391bf7687e6b, 0x2ddcfaae8d37bf96
+, 0x52cbe3925da74025, 0x386a42803d7b3b42, 0x4ad28d2bc137d313, 0x058e869b70dd7ccf, 0x282cccc033c466bd, 0x4b012c7292106f48, 0x7100a6b4fbd5d427, 0x69b19359d5f29365, 0xebf68027cb996cab, 0x7c7afa54b141caf0, 0x97555489153e2292, 0x31a0ed555ff02224
+, 0xc6043922e3d60048, 0x25e5964c41ddc7cf, 0x964c7b528c9f1fc9, 0x441f8f33377a98b0, 0x59e30f0161d23bcb, 0x1cb4b9c12f72d20e, 0x0ddb6380348d42c6, 0x57974e01437f4080, 0x51a0788e4600c62e, 0x6214cbf7e2e8f604, 0xe866c1454bc749ea, 0x76d5e6925c0f0d84
+, 0xd590fd2c3282866b, 0x79306269e53258af, 0xc258790542153ae7, 0x7b83dd5bb6b07b40, 0x5d46df8502abc563, 0x3fbe9f24a0745ed6, 0x95a8dc0dd80221cb, 0x19832b58e3b52593, 0x7e05b9caafaee398, 0x7841ba04f6709324, 0xb12a8edd3b94c3d9, 0x718ff8e54814f0ff
+, 0x0f438bd63645d02b, 0x2d013a6503d1d9ae, 0x8787a1e27ad0eb1c, 0x2b7116baa5ec4f3f, 0x6735fab7b88ec68d, 0x4a8d0e9c7c592252, 0xa3d78e06f18a116a, 0x01eee855f14e0bff, 0x5df9ded962e47c13, 0x4bc5f904cd349bfd, 0x956d255cd9da8a59, 0x3fc8b2aedd29c4bd
+, 0x5f3f7f4f9d31b08a, 0x07bdc7a0f2e10467, 0xacfc0f06a1cc186b, 0x0802d8c4854deb10, 0x9d42ad075674be97, 0x407535473ecad5be, 0x402b44988b85cfaa, 0x54ca51e4e561be5f, 0x8697ee5bd19799b1, 0x310db04f9f80a122, 0x6da5ae308bb69175, 0x4a0e3893c11f0e4e
+, 0x92bd415467c0051e, 0x5c4e8a52523a0706, 0x28c9b07d88743b43, 0x700513d57f00039e, 0x2cda9b895f3a8aaf, 0x7de9d492ddf0e011, 0x057a60145931b960, 0x0c6d32888a6464d2, 0x270abd7d45f6f8e6, 0x4717c8f825083a18, 0xa8c73e096128d9c8, 0x60d1f95e706886fe
+, 0xc909213599cc92fb, 0x1a3c59ca74285063, 0x59f057fff0072a18, 0x509469b4e7eeba61, 0xb237a3085de695e9, 0x40b8cebec7964202, 0x79e6750f9f087fa8, 0x1ed92a3beeb5b15d, 0x73446c6448d89d77, 0x335bbd284d98d5f9, 0x7762cf748ec0d898, 0x45230da1c0076b81
+, 0x4eec3a05a5fb68bf, 0x5ef771474dc27ff7, 0x53463083a5cfd998, 0x54a70d934033b562, 0x7f317336e8330354, 0x51446514471ade42, 0x618f44da5aa3de18, 0x26407fa6aaaba49d, 0xb877500f972a2d73, 0x526827bfc03870a3, 0xcbfe6a547b73e855, 0x630200db91adff7e
+, 0x92d30bd931217b51, 0x33099d5a3348ffec, 0x2e03696523eafb17, 0x3494ad4dbfe38bee, 0xb670ee4ffbc3883c, 0x14eb3e9a40072179, 0x49c17fbb0ecdc8c2, 0x62668bb2621e7c48, 0xb5b255554a733a07, 0x224a5c58a85e4a54, 0xde918eb3459d5f2c, 0x47341339af907f50
+, 0x301fd98b257c4275, 0x5ea0a7d348ccda17, 0xf4716cca2f2a2d99, 0x12fca4f6b66eadb0, 0xadedd43ee20246b0, 0x6dd2f99bc8656cea, 0xd092ba261754e05a, 0x3e3b1c70f1d85db4, 0x21e5e1e269e0e5ff, 0x677923990f3441e2, 0xfc8dcf7849baf828, 0x46767b40e03671c1
+, 0x7c63e626b026eac1, 0x0c0a29258fbc98e9, 0xd159c813ae20a182, 0x05a23afd9a13081e, 0xd9090f6e8dd4bb2d, 0x47dd7812c1c02216, 0x37a1326c4e24b6a1, 0x33d4a6b37726848d, 0x89c4fd9aa705c62c, 0x53e8a18b93d49e5c, 0x0efa8d4db2fb9a87, 0x01609b268f1b25a5
+, 0xe23ca522630f15ca, 0x2a713e5999f22f4d, 0xef8d1bbbede04e68, 0x054a94ca898e50f2, 0x88f18ac28859ad9e, 0x5bca9a42d88105a7, 0xac22cfa56b1f46f2, 0x50f8807c8d1a0253, 0x464eecb9c9fc655b, 0x5d5fc24ba62193bf, 0x35fc48d29b266bd8, 0x1df01cc5a63a3c8a
+, 0xe1bc11d1986ed821, 0x155461063dd5a10d, 0x4dfae61ef5330017, 0x3f18d8eb9dcabc42, 0x1495bf995e2c6a0e, 0x6b432b76677ba09b, 0x7fb476fead0dda9a, 0x6d40ac28fca8d253, 0xcdba2604ab906923, 0x7959ae6c264c1937, 0x73eef94ae19a7e35, 0x17c97418335d30a8
+, 0x47e518a37dcc861a, 0x7a11b76308f5fe34, 0x619235e8287037d9, 0x393f85b60ee86d6b, 0x4937786eb995077e, 0x7d623ce53c6eb5e9, 0xa3b976cbf208a3f8, 0x78f7323ac55fe4e7, 0x966f3d318cdc4fed, 0x3ed599e0d6560996, 0xf0e93b5fb5a6e220, 0x29d37c20a0388f86
+, 0xc3d24e22b21606d5, 0x4863afffb00a33f8, 0xc569e263dfb6d478, 0x7ee5878b965aa2e1, 0x59c88ce246ed0752, 0x38c47e3b75ee9a3c, 0x4f98830017fdfe27, 0x4a36c5a45a200048, 0xda45fa5a54dca0eb, 0x41d96fac55802002, 0x6d092828ecd49b94, 0x53ed7ea14594713a
+, 0xdfa50469ab278456, 0x434db90f6cb525b6, 0xad776683c49594a6, 0x1497eeff160c24cf, 0xa6f2917cdeb9dafc, 0x0c586af1c3c20c16, 0xf11fb5f7677f5f7c, 0x7f56470bb0ceef71, 0xffb4e80c23597b30, 0x2ea68ec7e9940b13, 0x49ab89a7c577e12d, 0x098c1f3312c8812d
+, 0x88903d7067a8317b, 0x0cad8a2cfab9c03d, 0x784e3343dd3386de, 0x3e6aad21737c709c, 0x59be566604459bcd, 0x75de537226797275, 0x9d1f169e3596b987, 0x0aa2ccbf6cfe40fc, 0xa7e63783b573b715, 0x79af59befdbc4bea, 0xda77f2fb77281889, 0x44b542ac2eba4a89
+, 0x43eb7c9f1c46c5cc, 0x6260673325ca551e, 0x30b5d8c308855523, 0x4e18e3d2d3eacfb1, 0xccd3778856388666, 0x733fe911b781ca59, 0x4ffb197e81b6b68d, 0x5bb2fdb7e1920ffe, 0x1c9f45a2d90e4e2d, 0x5d93953275c10701, 0x2de3e23aabdd21ce, 0x5a97fe6986be9dd9
+, 0x2264aba8ddb209eb, 0x2be56ab9a74f01f5, 0xee47469017de5690, 0x1bae65c0ee186085, 0x84b1b427c99a342f, 0x206115854fc9c2c7, 0xfe7640fc7d3feed3, 0x0669f0b4401d37df, 0xa3acecaa82f5df98, 0x40a9855c19d33bcf, 0x66992ad168b2bd19, 0x227bfa0f142235a2
+, 0x8c49fba42e443c1a, 0x6013bc8ddeb216b9, 0xd74ac338bd766929, 0x457807869c7fd2a4, 0x1915d4c143878abc, 0x6c72b0fa6523b9bb, 0x1f3823ee649d08a5, 0x53b063b94bf4a770, 0x60b6bbd18724bce0, 0x6368a492ec19c5ce, 0xe2c5a2cd2945e64a, 0x11364857b74a9ec1
+, 0x7a0a97d81e1ab754, 0x3bb102cba01564b6, 0x5f815c933cb6972d, 0x0772fb120e6a0ad0, 0x43d017093e4fb8a5, 0x0329a93f92f85f4b, 0xca9913e66d518efa, 0x3794b49b937078f8, 0x137d8a49a7921598, 0x525374e140feb267, 0x8ebff3d6dfb42a89, 0x1b4a1270f13a6187
+, 0x41ed8d92d39d5f74, 0x79abecba1a9ce7e4, 0xccbc07f9034d0b7c, 0x45d35ec927e3bf9f, 0xa9e0329d0ec42b2a, 0x278e1d3cc1419077, 0x5df6b14703646e09, 0x2ce7543f422b1c60, 0x3b8bf00af9a839f5, 0x2838fadfbe648ad4, 0x06b110636ae1809b, 0x6d88f8177c03668f
+, 0xa3d20069a1e42d53, 0x6bedd427704aa3d0, 0x24a8354d419db7f0, 0x51b3f2e2d8cb26e8, 0xcaadd16fb5468ed3, 0x37b6324b7eece59d, 0x2083f7de4202eea1, 0x42c5542a8e2783c2, 0x06e6b41cbecc5638, 0x3fde99ac6e16fc9f, 0x3b3448c0f8202d4d, 0x2e7fc4216908b8ef
+, 0x80b6f9e215a4d718, 0x235494c9e81ab189, 0xa88db32d9241f7b1, 0x25fe5c6cfb31a40a, 0xa0cc58f84c293390, 0x2f30ebe5074b4fb9, 0x0a4049660bc34682, 0x5af3833eec6c7bd4, 0x5c70e9705a33e65f, 0x6e13c5c190df0fe0, 0xfcd40a914b0dc13e, 0x5b3810a63cb5d7a9
+, 0xe2c6b68d03679e73, 0x26ef5292a1d92555, 0xecd8c948d6c7069b, 0x78059fb0b8834b13, 0xfda296ada46236cf, 0x48bb5bf3094dad77, 0x97df648c48fbc24a, 0x27d2b785eddc6428, 0x25bdb0db5866ace5, 0x7ade2c368289acbd, 0xacab495c68b68bc6, 0x4c1cf22374039ecc
+, 0xb9bfa24197e4128a, 0x69e25b9ed36075cc, 0x9f579b71cac3a8bd, 0x7f75680fc8e45728, 0x5f93dd46a6c37eb4, 0x08809632b88b9533, 0xe65fc8288e0e57af, 0x48c6dd97447d2323, 0x03ff899868228cf4, 0x459b965735fad7b0, 0x4583d233e8f8267d, 0x7ed36b96023d8062
+, 0xe1da5670e434f5e2, 0x2cdb4038870f89ee, 0x65bd73f1fec068f0, 0x796aed77831119d4, 0xddb2f8038d070f92, 0x4556a94b2894bfdb, 0x25d4fc2c4688c4e2, 0x210c86c2785dc1e2, 0x9acfdaa65f37d8fb, 0x35b3e1198849126f, 0xf52e8a1ac3e5b8c4, 0x13a5d52783539485
+, 0x7e615ca36d9d2173, 0x6e3dd241a7725070, 0xfd5f5b0b5eb80177, 0x1bfb576706fa053e, 0x982be44923a2a4c6, 0x5fa79e8b2bbdc7e2, 0x97b8b12aef107ab8, 0x79f2002eab243b45, 0x4df8aada81d27401, 0x28489c6a4ba7d401, 0xc59f7ee3e63dd1c2, 0x5983d7b8e19b9658
+, 0xfa9133924b288c12, 0x43ab560f74696449, 0x7e8e46c019210edd, 0x604e2f7955930d48, 0xcc11b16843253b86, 0x498b86536406c465, 0x2c18f4d6d970219d, 0x530a95f031705f90, 0x81c9c0db925da74c, 0x609e473b76e866c3, 0xa25239985ad6b66d, 0x5aa08f8570ebc756
+, 0x7be7265b4dbbe908, 0x14a66d5f423bee12, 0x73d6756b0f6dfd57, 0x43eee5fcf3fe1b3b, 0x26124e5e177f55ba, 0x5034ad146c25ee0c, 0x0d1a2c07543c0c88, 0x539ab8be433fb7dc, 0x502cb9cb799d0300, 0x63784463748dce6a, 0x67dce9b154aadc5f, 0x5ccaedb8b7f80e6e
+, 0xd23dc586449ea10b, 0x4ca2520104615f4f, 0x7a18311789381654, 0x1d36ac0e2105c55f, 0xf27670a2ac590090, 0x1557f039282ab24a, 0xc67c5a7e5bb3a134, 0x76fe3117d4a082c5, 0xfa31f8d746da3c99, 0x44ce8fdb1647b9a2, 0x3e8cc626104e0475, 0x230cb9edcbae8c32
+, 0x8588f88e28be788d, 0x561b1b47e9e62dd6, 0x3c508dc9fff9ada4, 0x66f9cca79f259c5c, 0x29af24c529483411, 0x545cb885cea4594e, 0xf5da538dc3c70adb, 0x7bfd3f2de1e12b03, 0x591f40ef764d58b9, 0x4bdab85aec4d351d, 0xd02090f12421e1cd, 0x41e91e3fcf91eeb1
+, 0x61bf3066a1e8812f, 0x7fd295f7c0f98f13, 0x5039af6f2b287fca, 0x18b5a88d6816e153, 0xfd6402bea314dee0, 0x51550002e08d493a, 0x452880b61a2e1578, 0x5ca3fafcea68daed, 0xe90d7b9eb8c34145, 0x06ac140375f30f0e, 0x97f558d3fd325161, 0x68d3c3fe5486edd8
+, 0x9cbfabe3bef2b2e8, 0x5bb053bb66f96555, 0xa42cc20b75262f7f, 0x2d8de14975c768b4, 0x6b23d7287db184d8, 0x28c0db9a015954ba, 0xd1b16afc62eab777, 0x0d03923b284ff654, 0x478de64faba5e89d, 0x5c7abdbbdc7b811b, 0x9f85fbdbab923848, 0x75309161b938f8ff
+, 0xcf3a482d7d710495, 0x0838a5a134d6f4e9, 0x370c75b447e5c696, 0x4ab5fd3aea28e497, 0x6b9af89ba521f73e, 0x1d59584d5573b04a, 0xb531a673147f9c25, 0x442120d3f488cd4f, 0x2ff7f195fc6463aa, 0x6a89643e9e1ffeeb, 0x46ff3051616b1cc1, 0x350513dfedd5bc6f
+, 0x037d96130aa5bce7, 0x41aafa77a4d6b24a, 0x00a67fea73d0ca51, 0x4a631d22e0ec41cf, 0x5ced1276ddca3469, 0x77a0d1c06d36bf7b, 0x2869eb87df7f57bc, 0x20ffbf1e7aa83a0b, 0x93a1fd1c6fc67872, 0x4c8f76ff45091321, 0x2b426281d601c968, 0x2c76b5604f21c777
+, 0x1388f7d129d004ec, 0x23b429a2d628b33e, 0x903fba1ab5f995d1, 0x56ad717775056000, 0xc222ec45dd819110, 0x1491923effa252ea, 0x0cd060a0e5998d69, 0x27c161c70248df68, 0x4801e382fbc79155, 0x2e42f3125f746c5b, 0x71ed547254c45f78, 0x0b75e232eaeff3e7
+, 0xaf5f8fd136e0b4f6, 0x590148207a4add36, 0xc723c192d1ac2cba, 0x24bc05467e650855, 0x36903af05a24be98, 0x1f9c5f8f66c0a722, 0x8fe754de1573ea98, 0x607c3a64ca33b39b, 0xcb58f979a3260159, 0x2f455bc9f009fd3b, 0x852b55f591fb7607, 0x1bca23f96a97d7dd
+, 0x1fd43dfa9d966891, 0x07f19fddbf9de3b0, 0x66953e1ae8f1a47a, 0x5b10115c74ca6918, 0x221451f4999d3e0e, 0x5ee326279e6b3dfb, 0x71d151b2c5dc4658, 0x398d9ff18719a78d, 0x176a85761ba64497, 0x12617f6c73f748ed, 0x09339ae8e67b7c2b, 0x245ff3a86fb90d46
+, 0x32545564a122394a, 0x7833a4fdc242e75e, 0x71c8f1364f99fd9d, 0x4a49e3f333cd4a34, 0x0139e1e74547e2ea, 0x2756ae7a3e702a00, 0x8bd755b9eae016c9, 0x75c962a8b607e086, 0xb60e67aac0bcf1b0, 0x23f2071c645e5779, 0x8ef2646985d82db7, 0x4118ef7ea1f53c17
+, 0x993d4ef0cbc912de, 0x1fa3fb4ec8a1885b, 0x0e1fa1f8f276a96c, 0x0a7f5076c0bc358a, 0xef0ce9aa53bd8819, 0x719c391668b3a5bf, 0xf0e17e3ec4285959, 0x36d79bba23356b55, 0xe69ab4a0019ba2bf, 0x2528bc238e342f4d, 0x17e86e27737a52bf, 0x63d7624ec6561559
+, 0x7962e9426a5abd16, 0x6191640c198693a0, 0x247d37d553bedac7, 0x22c95410c6052660, 0x9679cf5ac7beada5, 0x20d8c5b5c85bdfc7, 0xaeadd407a0f2aff7, 0x370d16c334d640e3, 0x27677fdae965e7b5, 0x01b8e37abb97e054, 0x8198413dce3f3fab, 0x08f80b591c40e04d
+, 0xf03cfab9a434b2b0, 0x2647081494e76a7c, 0x57e1f93e392fdd3a, 0x07311adf5928e2cf, 0xfd3d3e9d26a2bde3, 0x1aa615480080f1b4, 0x70108b8c9e4ef10d, 0x2a66e4f8569bc02d, 0x8b65f4ed820c7424, 0x27a41900b0b3e35e, 0x04ae828f6af37c11, 0x2de2a9a417d72894
+, 0x5e6bd80a1ca5872b, 0x588f2c97b3fef911, 0x6977ead1a347ffa0, 0x2fe5742fe36a43f7, 0xdb536dfc323a3536, 0x380855feb0ae601a, 0x5ac9da841b7f96fd, 0x70dfed478a261346, 0x0cafaa8526c75507, 0x76ab5938feb46b67, 0x0477294d5e0a984a, 0x200cb8cf260774e3
+, 0x86f449c381491032, 0x34a9a647ab9dc50b, 0xc05332780cf8d4d7, 0x5d4ca3506861c03f, 0xc71f30cf47c3006c, 0x65df9bd955248506, 0xa9eea538a8bf0a7e, 0x49f2cc06f9429dbd, 0x97d906e202230f94, 0x29adfa90b5749434, 0x7c132a27fc936581, 0x16833f8aa69c31be
+, 0xac8cf58c022ee96f, 0x20c3893432300f94, 0x8ed732628206816e, 0x26651f280958daec, 0xfc6d8624529decc1, 0x4a8fb16de75330a7, 0x03e1d674d7880791, 0x3724c0285589cc40, 0xc9daa804834d0252, 0x4475710683a6449d, 0xd615fcbb204529f6, 0x3b8ce328f660f40f
+, 0x99cd1018be2e5d6a, 0x2f23d82ed4c209ff, 0xe5f2496b74c82f4a, 0x3d16ce6cdcb38ad2, 0xa6e49dfbf051a6a9, 0x63109fcf3e9edd7d, 0x42c81e3df6501c44, 0x28981eea8f6ee266, 0x4ca07e6b7d8dba32, 0x1cda8cab461c0453, 0x33156274504be914, 0x39d6643c1621e4df
+, 0x49041dc234d5bc88, 0x46efb4f857435a05, 0x250e163933fbeecd, 0x44a2e7c0f0a6e9e8, 0x9aca15893f142428, 0x4253422c7ce6d733, 0x85ee92ff76027111, 0x0a90cb612ba09cbe, 0x8b08f80f08ed6f81, 0x5597a38ca18460ee, 0xde425d4f248d47ef, 0x02329582156c67ad
+, 0x1c6a9a21de91cdcc, 0x7a61a0677c9d7b17, 0xd1d4786c93d1ecc4, 0x3ae47904821e32a5, 0x63b3adf8912ba93c, 0x76d9885cd58017bc, 0x9432d3c8aecac428, 0x1e092688be0e93e4, 0x33e954fc93c72a4d, 0x2fd3028d2d4aad7f, 0x735dc9225e62d47f, 0x5b6293130ec4c6ff
+, 0xd0e776bdf459a5c6, 0x1de7e6e0c76eca12, 0xb0cb2fa1d523ec58, 0x067e24386dc1d1e6, 0xf8a3e712357fffa9, 0x1738bcc3bfecf922, 0x7a3ef8e581d352b4, 0x1baea4e4835a59bd, 0xdb4d3adf72898d52, 0x6c85030c9989057c, 0xff2978c5e919d4cd, 0x4a76e49ed18ee618
+, 0x14fe2d6d3c5243b7, 0x58df36cbe19bc413, 0x4c5008905489553e, 0x67b41888ed02cb54, 0x4a80ea42b3bd88d8, 0x1a01ec4d97b150fc, 0x19e4551fb9a5d0e5, 0x59e418d38c5faf0e, 0x63a010f5ef0227b2, 0x3fa886689ab0efbb, 0x9ed51ade0bef0d62, 0x396af093177e30cb
+, 0xe9d847f1237759f0, 0x500f48094722aac2, 0x5be623eca33125ad, 0x793252cea16e8bd7, 0xbe915e9f77226b20, 0x2fed487ad494d21d, 0x44ff71f70f3faf6c, 0x5c02fcf1da3fec7a, 0xeb9ab912f645490c, 0x4d5ba5c1a06a19c2, 0x06bc9a8e4a0cc73d, 0x0f8eb2588e805d54
+, 0xb3a0eac7f962292f, 0x6358e9e53cfc0de6, 0x3e20cca0b61edadc, 0x67ce50d2d24b5dc0, 0xd4d760c62320c11c, 0x7227bbc663f3cbde, 0xc8e495fb94c2a264, 0x37cc4f909ee110d8, 0xac0413017c60bce5, 0x0cb16042f40b22ed, 0x04f26167fc6ebbc6, 0x337d919c2f5de6fb
+, 0x5dd7f10d88b526cf, 0x123c4d0faf768f7b, 0x99e48ccfa173942a, 0x0dd5beef25d09cc4, 0x21c0aced176be429, 0x2bc9efb841ed5867, 0x51825263cafb4fe6, 0x55f645cf89b4c66e, 0x84905b928c2e188f, 0x7fd99a149c5b7b07, 0xc9b2ad98a86ca994, 0x6181cfaf6acefec9
+, 0xaed331fd222f523c, 0x3504d517f62d9f52, 0xea720dff7295a318, 0x37b286d6d4a8ca09, 0x7a8a506b7214265e, 0x18a6d31e1090a962, 0x70c2e5a834396dab, 0x118f4f3be419a9e7, 0x6310bc8694f57b22, 0x32f053580d9cc9f6, 0x787b75f67d44492d, 0x2c21a2059a2cacab
+, 0x8599ad008c0e2ac4, 0x73874fcd0586ccb4, 0x17e98745e47c0605, 0x715a2ca8c7d83a82, 0xfacb660b84133bf1, 0x64f58b4a45e6cf0b, 0xb6536ed44077c021, 0x22a31da0a9c13f34, 0xe58ade8979f440eb, 0x5193736665f27e61, 0xcb6fb2aa1398359a, 0x6874a5fa8ade2916
+, 0xc352407b66a05746, 0x54adaf77cf324aa8, 0x023d1bf96c7536f2, 0x7d55cd9bbfc5b86c, 0x6724a0fa3a38787c, 0x6233ac1b59072661, 0x8ffcda6db37c1183, 0x08659b98c2b93731, 0xa5e2f40703e90b97, 0x531910f41dafe770, 0x089f32d77fb9ae63, 0x339531d4c4f48cac
+, 0xb97d2253936b7fa9, 0x517fa5accb5ecba8, 0x7656e39aa73f5f69, 0x1cec776a1f995e5e, 0x5a40313d10511816, 0x3a17cb27fa2effe0, 0x11d098cc36f9b666, 0x722acbafafb78a86, 0x9bcb3a53e820ef8f, 0x4975637e4e7f1b99, 0xbfba51038e403c91, 0x0fcdf5d65351f7ea
+, 0x395070f6deec352b, 0x6061431b0529b1f4, 0xb27bc3aca06e7776, 0x37b9f134dd511a5d, 0x01e257deb9ce961c, 0x67c6c030e03e572c, 0x9e1d47666f795901, 0x5466c181c366c1ee, 0x6ebf75d0ad1fb242, 0x296a62ea08bb55ec, 0x23da5f72a5426008, 0x27c3118ccd11871e
+, 0xc0fc81dbf5ab9942, 0x60105135de17f389, 0xc6ca1fafacbc3b9a, 0x796425b3660cc35f, 0x830bddc21d83e612, 0x0767547f2e896b84, 0x9f7940ec3ba091fe, 0x4d25aa118a9c20bb, 0x8b238e1bb3c9a98f, 0x2d2067425dd1b12a, 0xdbf25c7f78cbde2a, 0x3d18317d4b17ce87
+, 0xf8ee758289e12e32, 0x3adba8a72f87dd5e, 0xbe5c0af4fc24bcf7, 0x2acf2456b259bb68, 0x4ffac1559a70bd32, 0x49e5efe0a13a3c4e, 0x5a1163e9d4d25ad4, 0x50c77812c6818be9, 0x312f22bdce132b2c, 0x299f8ec48abdd8c7, 0x5d3ecc47b507bc2e, 0x49c4abcf818ae82d
+, 0x2a10653eca4d74e8, 0x12ba60b2ed63fc88, 0x51c8365985a0df06, 0x21aeab7382573b69, 0x21b37696192d5082, 0x17ed17cf46d9fe0b, 0x9a7695d2ab574891, 0x7e20fecdc8e04094, 0x3eb89051893498c7, 0x0180f11543c9b2b0, 0x6b21b0bb4961268e, 0x6195bbd3dbcd089f
+, 0xb86a6fc7736c354d, 0x6930fb40dfca25e2, 0xe95662291ff1ed0c, 0x7eafe83818126679, 0xe655eed373c3c6b9, 0x2c7a2a56fc0f8fd8, 0xb0c18efc38fec9fb, 0x6f5f04da32117133, 0xa48d99a3b4bba201, 0x241b62a6f6ad08f3, 0xf86558917dc971d0, 0x0cb0c9a944717ff8
+, 0x946a5ef48e245fa5, 0x7ffa22fd35fd2fa6, 0x12a92d81c84479a9, 0x4e149849d4f42635, 0xa22e0ee8d45804c6, 0x68996914d3eef78c, 0x2f566b65ec8c28df, 0x0d2212ea42fdd233, 0x5ebf38088fecce85, 0x708c962d20ad825b, 0x8a58b72d0590b707, 0x2bd77a4a3bc94f1c
+, 0x2ec9cc5227ddff80, 0x79f7aa8823bbf0f6, 0x3f77b3c3164fe349, 0x289135bade275872, 0x1dd57689bfd016cb, 0x7e07b92f59c6d794, 0xd5835ee705afabc1, 0x4a6e4287712b9cf8, 0x3a5d8cb5f2ceb770, 0x2c4dc9ffd7e170b5, 0xa1dc918a7233da83, 0x70c022061d84fa4c
+, 0xb0b9905d5f90691a, 0x136093c00f5d0861, 0xcd6653f0fbe37aac, 0x7cc982c1733c6894, 0xfe58bad6363696bb, 0x3543cd60509264fc, 0x1129ccceca2c83fc, 0x512cf66a9b06f976, 0xd5034d69d217c821, 0x30d3bb2d25cc9b08, 0x7f41a54c3741bd0b, 0x73c193a63e87a456
+, 0x37be22c52c355bb5, 0x7aceda702cac48cf, 0x426ba8ca12380775, 0x78a908a9d1ec91f0, 0xd47f39ef447278f3, 0x32d670062de46d99, 0xc30e6a58a75798f9, 0x2c2ef8cc728e53fb, 0xba1cde1b74e07238, 0x386c90b8b388175b, 0x1517577bae4a6833, 0x27f5a775312df9f4
+, 0xc39ee6faf81f9d97, 0x0586df353f5c814e, 0x3102ef8046ea0d55, 0x45c4544362e8753c, 0xd5b0d8ef6032738a, 0x791f154209ed2093, 0xfc147736098a84a0, 0x7f7aecbd4e56d646, 0x0bdb43ba608e68e9, 0x20f9040e2f85bb8c, 0x5f668ef0a5dfe2b4, 0x30beebba53aebb30
+, 0x1bea3f54d1590223, 0x08afc07e1c4814ec, 0x803f3d95fe56adb4, 0x04e78a837e1c42e0, 0xc6ed9d8a48907b22, 0x64dede2c44632c08, 0x7e367576588ab70a, 0x78dcb307da39bf9f, 0xd44160799a153d65, 0x411acd79f0695ca7, 0x74bba4e71d429be9, 0x0f4eb91e91b536e9
+, 0x74665dc2fb9ac527, 0x38542f8fe897cfaf, 0x0b7e3c390508700c, 0x19639deb1baf78be, 0x2bb626108a1ee4a9, 0x18f23d128b5a2725, 0x2dfb3082354f44e5, 0x4ef3d955dd61bdae, 0x8bf8ad38d5416036, 0x52f033f6f8bdcd9c, 0x13bbb333653ab237, 0x252e4aabba875ace
+, 0xa823f1903df67f2f, 0x10aacf8bdb6950ec, 0x1033f8bfce08d28f, 0x009495a5f6f2880e, 0xfd99fb9ceaa4db5a, 0x2efa2d01b727dd18, 0xa71c656603829f46, 0x601e3051f0fa74e7, 0x21a6597a042807dc, 0x028787f7ed696bcd, 0xf0412f6f9ad3fea7, 0x38c42176751823bf
+, 0x5e00f72a51af326f, 0x56bedcbc8206159c, 0xa458e0a8574a3b69, 0x11b9681d30ba39e8, 0x624a657c8b26c950, 0x5452fe459c9450b2, 0x6955ad02858322f4, 0x45cad9a064cd0051, 0x035ca3b632429b74, 0x35f8df5d3a1a5f2d, 0xb9da64375faa592c, 0x4a8e5c82b452478e
+, 0x30a043b7ea958a47, 0x79383b90aa455e66, 0xda548b60579cb745, 0x794371d67e5f54d8, 0x8156b22edbc33c52, 0x00fdcbf7364e3dce, 0xcab48e19bb07c488, 0x2d09a9591c635e01, 0xd1be2b6b6151d987, 0x5e44f4c67e8d3204, 0xba65347f33bc8bb0, 0x361f16276c487436
+, 0x380c068a986ea104, 0x614e98ac51ba222d, 0xedf764bff3cd9684, 0x541eb725b96cab9c, 0xee47af1707a484d3, 0x64a71c2b5c6237c1, 0xc99c757e2a08b802, 0x40d205742e877ee0, 0xf229e436590f3c96, 0x154140f3e872f3c7, 0x726e70d65c4c574a, 0x53776d9fedc63ed1
+, 0xf95f20ceda54eaa6, 0x6abbb21a54687b9e, 0x484153053a1abd54, 0x3fb03da48e208869, 0x7fef45d60fc72c7c, 0x34dd15de4c7b2400, 0x395619521b99fc9f, 0x48c91a6040f3fdb2, 0x716f87d6fd807641, 0x13a35d0c2fcef57d, 0x17c75a06bd193ee3, 0x6e10dea54608a218
+, 0x6ce8a8fd111158b5, 0x50ececaf42cdac48, 0x4c9be63b10b3b4a3, 0x448c19be30234280, 0xa05dfab280f46ac8, 0x5aa2837190175de0, 0x95ade1bed8e62a76, 0x08e79688240ccdbc, 0xfe42baa76f8fc516, 0x3fc1467fb032ec83, 0x3e2ce1a1f8fda267, 0x07190874c7cc0606
+, 0x6e1e940bebb37508, 0x559e695c842c1c6f, 0x4b46a954300dd106, 0x631b502afc94f65b, 0x7c1e886c4e15acf2, 0x50e12515528d1715, 0x9e91131dcb6c9f61, 0x01f20c01a45d29d5, 0xdbb5ff413e950642, 0x67f6c030329ef541, 0x034a5bce29b9d665, 0x512fbf25a31f576c
+, 0xcbdfec0f7188f9ed, 0x05c1e2879ebeadf3, 0xeeba87b0053824c0, 0x0a7379287de1066e, 0x7b0f5e2c60f9dd06, 0x761ca4aabc1a2586, 0x7d1e5784961c016e, 0x1810bfa4a779c81f, 0x355eae694883b834, 0x213df017a5b0d8ce, 0x3940ea640a895b35, 0x422ee85b6c33bad7
+, 0x82d934e00801c3ae, 0x3b064accbc34f59f, 0x94139096c68a7e3f, 0x39f5226e3fa94abe, 0x8774ecf3195a4447, 0x27fba96221e1e28a, 0x0d62ce9978df9d79, 0x09661c72dbb26949, 0x81f11eabbb6f15b2, 0x10be7d9a0da7bd64, 0xc868ea801e5b6ded, 0x7c617c7c9b131826
+, 0xf2382ce31daee65d, 0x2f1c0e0bfe36b232, 0x1e6540a4dffe03a2, 0x0d1fea66eb58d2d0, 0xdbc551c43691addd, 0x1b3777a2b5e751c0, 0x61bebe84d3c36d9a, 0x29df8319ee41815a, 0x53e63209aac472a3, 0x52bae5bc4da0c281, 0x15417b417d9449a9, 0x38eb03e2899c0513
+, 0x9826083d5bf99eb1, 0x6000aadc8d38a936, 0xf24063c9de4904ab, 0x2edbdab815b5efb6, 0x7487245fc4702a67, 0x30396a804d1cc443, 0xf58e03846e8fcbff, 0x3f7c4701416f60b8, 0x4565a8c6eeb69378, 0x7c92bb77fc8f17ea, 0xfa7335a7b70fee38, 0x3304da972b512d07
+, 0x457f8d26c63d1a0e, 0x29144d097a1c0972, 0x534f9a8ef2d83e62, 0x05c1df85f1604ade, 0xc5fec059bf669117, 0x543cfb7da7178c2a, 0xc6298f7cf01b4539, 0x262e3fd9a50c9a19, 0xc573799acb743d3d, 0x33f1989e875bf2b4, 0x91d59859af572f92, 0x60a84d40959783f9
+, 0x424a84ca25420d6d, 0x245d08004e201e82, 0x0df6a8f35fc2a080, 0x1294bf2076c5f13d, 0x95877dd582d5a834, 0x6adf77fda1a184ab, 0x0ac4225d70db2b99, 0x66c87b874630bd0a, 0xbb5be2cce6796a5f, 0x27bf3fc069223aeb, 0x52e12c449148f4d1, 0x6b27ef4c485466ca
+, 0xd0d0c8181669656e, 0x4384f2ef0e660ea3, 0x44c2127772796d54, 0x22f6504e35bd64e2, 0xe76d8e466271e7cb, 0x3e5bc577e9b6c88c, 0xf9afe0f1e36b3a71, 0x144d7981f3087e51, 0xa92e4bf3949308fa, 0x566d259e339ca08b, 0x7d1ed56beabd580e, 0x5418cf99409a3267
+, 0x997321c7b02cd1a1, 0x7e8c760e14f41d56, 0x6ebacae73b41c523, 0x42961bebb1d4d94b, 0x611173bebcd14f37, 0x629bbed48e2fac22, 0x3943eeb9ba9cbbd2, 0x675ea35a074d1a02, 0x9001d83ba2010b91, 0x005b1986a7faa432, 0x058390aa2486f875, 0x02728853855e7d9d
+, 0x09d7cbf5bc64a258, 0x762f1eb7cf80653c, 0x72c1ef5586ca1753, 0x4106ace8c0da5317, 0x972517bb324c58bb, 0x1d80c2eb35ca576d, 0xd6c2fedbcc584e1f, 0x006958ae326b6d5f, 0x3f9913591686fdc6, 0x2ab8ac0fbcdd5bf5, 0xbe69777720adf280, 0x2fa83bea952bc9de
+, 0xf7fdba16efd57f73, 0x2248f0385a819ea0, 0xf849bb318342ec6d, 0x2dad496b3f2a1a8f, 0xd805295efb8aff2f, 0x26006f9f80d3415e, 0x0398791c8cc534b6, 0x4666c9a3b6da2e85, 0xf2376cc3b6e6095d, 0x1b75b5084a839507, 0xc6edd9b8c4d6c962, 0x4b489f85e4022dd0
+, 0xdcd2d85ebdef86d9, 0x01453f8a3c31915c, 0xa13c59131d90cbd0, 0x3a03ee97869c220e, 0xe673e8683daa9006, 0x07c6ed28c86e6d46, 0x99130167a789ca88, 0x78e730d573f98515, 0x0eb62275b3a66200, 0x5bfe762246cb9cc2, 0xb0b05387781869eb, 0x3a21d9c9c1d16c7e
+, 0x70eb6ee4050a7931, 0x3c65e68bc7ca38db, 0x71d546f7c1349d74, 0x3680ff9887d2cebe, 0x9e15f19a37b9a170, 0x65f600837af330e8, 0xf049aeb47426db4d, 0x16d20656d82e0293, 0x835412d47d53cf25, 0x7f20928159c3530d, 0x6f06592c6243ff7a, 0x755572f9a83ac97b
+, 0xbf84bd14e7c47b06, 0x48d56b2216d68dfb, 0x269f3a95f61888b3, 0x50e86cbbe3e78586, 0x8d24ec506838fe94, 0x0dce7cc75b124dc5, 0x0a68b2bf701e5b7d, 0x07c5c46e62397a28, 0xa3633981eed7b1a9, 0x4cc369fcd82aa41a, 0x721e726056a17abc, 0x4faff66af8ec5d14
+, 0x4daa7b6c1a354ea2, 0x2a87525b7445b45b, 0x5a5ec385074cfcf9, 0x25191b99c548c639, 0x2ff0f818c185fa74, 0x3f683d58383c7677, 0xb4ca6ca2e6c12ec0, 0x7860fc0284fab612, 0x0f552b6420259925, 0x0cc873e05fc158bc, 0xda6f80c8dbdd32d2, 0x1741f018fc1bf0d2
+, 0xea17526a4dddd263, 0x4cea9751916432cb, 0xf450842a78b5632b, 0x4400e7e63eacd388, 0x84dfbbf143a1a58f, 0x4982f92a5891613a, 0x3a778401c0883193, 0x0e7565684a2e42a0, 0x3fcdc019ef4b3bae, 0x0e7b2acf8f7e4529, 0x2823dc0ea004d65c, 0x6195d11174be3696
+, 0x37333d9c160327c5, 0x7ac1e092835c89da, 0x4abc65b87b8940b3, 0x7aeed8c0f3aa04aa, 0x7992e98952eaa893, 0x03c6db3fd786a5b0, 0x783d1d716bd70426, 0x7afcd5818fe81cfa, 0xda608512101e37e4, 0x01f3936a1e7a8444, 0x454ae7853302329c, 0x6c5f9789449deaad
+, 0xdc8837b6b520c92d, 0x55972531509b579b, 0xd0eedda4d010b7b7, 0x79ec504524721519, 0xaffea85c6ff6873f, 0x7169db38801f858b, 0x6612007ca7a6a0b7, 0x27323f0f7c631e2a, 0x4d01bbe9ee4b8a3b, 0x1fd8dbb12e3ae823, 0x183880701331884e, 0x358365d8a24942ee
+, 0x55067c1d0596261e, 0x6da41239cfad7fd4, 0x2c4885a9e58cb491, 0x75157a1355586707, 0x1007ff05cb21073a, 0x7c807fd2a52062a8, 0x2fb9463d720e1de1, 0x5b31e59fc48658d3, 0x3c4ba10d13312df5, 0x43d1b711520547af, 0x0c94e79afd95f7f6, 0x06eac7a66c5a7a05
+, 0x0158679a243f7187, 0x673603dddfb4d13e, 0xcaebafb6d409f609, 0x5856bc7e9ab79742, 0xa71c23963e3fa8bb, 0x4c5993eb12dbbfc5, 0x6118276597c94a6f, 0x0cac040829cfc717, 0xdccb8d26f83dfb51, 0x0cb4b14ca6bbc674, 0xd44198612a7fcaa0, 0x39f9764a507f1b9c
+, 0xd7558cb083c1fdf9, 0x42e98e0e5180a17d, 0x755f780546c22e67, 0x4ab182fc89297999, 0xb2705039c9c71aa7, 0x1485a582038f3e3c, 0x685a834586226e0a, 0x6124f25342ebe4c7, 0x3bac2b39710cab2c, 0x6149849c40617841, 0x5f6a45b72bb74c60, 0x79342cf1dfcaefcc
+, 0x6309725e483ecc54, 0x003b1f933f911694, 0x2a0c2aa13e398c41, 0x00503b61770e62cd, 0x0292eb9849971acf, 0x724d571ce57ca6df, 0x158a0ce50f858dbc, 0x753a38a3d23f4276, 0x217b2c9e558d5a3b, 0x25823d97ba4c0ef7, 0x14acc733cbb247d9, 0x41271612fed1f361
+, 0x97c27514c99e982e, 0x64a89209f9faa140, 0xbcf0cdf9c2248d8e, 0x741c996db014a2d9, 0x5b63d86b17c4ad94, 0x7e3ca5659c1f7b04, 0x43e5a1e802ec37dc, 0x5ba3a0c5b48dfcf1, 0x37d863402b265522, 0x524a3378c0a7bf09, 0x2c654ae3c0af16db, 0x7a107291d24274cd
+, 0x26b01a68d2e05c0b, 0x4783b080f4754450, 0xeae27e07baa315be, 0x1ee61e87735a4efe, 0xfc7804fa7f4a5455, 0x1a8b76d366207c0b, 0x95323b5f6bd425fe, 0x4025ec2512b82d6e, 0x6b8222ccd06eb612, 0x18131b79d70fe3fe, 0xe50dd91ea4fe0089, 0x199565f158859fc6
+, 0x1c6771cc129cf691, 0x71935bb8a285fc1b, 0x8365202a3df12ffc, 0x049f04104beca3ae, 0x338f33b5b451a817, 0x6fd7b70dfb1efe0c, 0x9b470d331964e76c, 0x1f9c2ec6339ae4d0, 0x79935f169a70e490, 0x067112fc03d1c934, 0x7c45fd1fda3354e5, 0x58f5188ee3e9e6de
+, 0x857ab56899db50b6, 0x2de7bbb75977158e, 0xd64e4faf6806acc7, 0x411ee31c6cab0b3d, 0xeaf824c7c8d24d36, 0x7195a3bf3d33ca77, 0xd50dc123a1f1a883, 0x1eb5327089d10714, 0xb596c1251eee717f, 0x51d3fb73f48c0c4f, 0x0764d668e3f189cf, 0x23706a711e9cfb03
+, 0x06a884bbd4abcc67, 0x2daca5ea36f88deb, 0x7d0f7f70af146bc6, 0x075e7ba1b81657ca, 0x486046aaaa174305, 0x3cb9f74a173a2cd0, 0x1ef47e52f125e24c, 0x09005a6490145500, 0x77ea04581926292f, 0x6d29a5db2a39221c, 0x90a02ec4493200c1, 0x64dd7f09c9080908
+, 0x3760cfbe2fbcde9f, 0x4d524a8105942cb6, 0xa756d7da5097683e, 0x3c5442cce5401741, 0xb1cfa75103ab3c1c, 0x26f254ed7fa9aadc, 0xd39d49fea5980373, 0x3861efa6f17fa6ef, 0xc542e5ce6b222b57, 0x780c5703701d1d06, 0xd8e5f171d7a5b1c6, 0x0b04c1a799bc1901
+, 0x62df6e50ace420f1, 0x220c81dec64b6287, 0x1ee984c0ac267cdc, 0x13be72a6003c4bcd, 0xac74eceb32d3968d, 0x0ae3d8b8ca1494dd, 0xbc4bfa8902d3d5c1, 0x79874e37b3d9254e, 0xa46ffe062d1a23b0, 0x7e4770ad8f62b1b6, 0x1afd2437d0496632, 0x5e05c455ef688ea3
+, 0x9bd73c0074e338b7, 0x0b4a48f9c86dab36, 0xf77a94719ea87721, 0x74e9d7125d6846b3, 0x0ecef492b6a1fb06, 0x59c5cade2bbb6abb, 0xe737cb42f138a79b, 0x6a3292101043d30b, 0x39d5d39aa851ce6c, 0x2d571cd434488e3a, 0xfaf2485c7ed82aae, 0x04fc5ddb55600d0c
+, 0x51299b296299bcd6, 0x1062901449719120, 0xdc98eba05345b6b1, 0x110f23d8d7ab6944, 0xb63e5ab62f19bbfb, 0x0c811f50e28a1d42, 0x006b91b3fd7a49fa, 0x2a4b1a99fb72cc7f, 0x12eef254922f14f7, 0x5b79915a456a36ac, 0x0eed7c9707b24a3e, 0x11d4c64122dc5217
+, 0x30b44378f9070112, 0x69d5d3a76b468e18, 0x9af7e65983d95d2f, 0x766cdeeea611210c, 0xf220744ed5909de1, 0x441c2ce107540bb2, 0xeb72ebe982764eab, 0x368b213a556b56b6, 0x534287119e620556, 0x2d56619ef5655990, 0x4474b5a1cdba5616, 0x6d412100e0e7318d
+, 0x9fd6161b450edaf0, 0x68e25f0a4c49c17d, 0xa060b2ba5e39f7db, 0x166c7dabd7649b87, 0xeafc24e95cf3e874, 0x6e49471eacb7b785, 0x4cc05203a6ae5a21, 0x51ea44ad4576ad77, 0xe09a649ec0e1324e, 0x41fb502331b450d8, 0xd278a10d01da52d5, 0x63d442331a1c1453
+, 0xc7f5326caa9d7bd3, 0x2f5299b9881a739f, 0xc74a7613a3cfce62, 0x6d12c8e98828f65a, 0x1fb587cef473368c, 0x61cbec09ca6a63e2, 0x108b8c8a3f4d139a, 0x5a6bc627738ebc4d, 0x44df065afa764c03, 0x054adb610ee533d5, 0x2b93323606653be0, 0x7eb74ba4f2e6d019
+, 0x992aed708392663b, 0x38794df285c1a0e0, 0xc7095d437d9d858c, 0x253cf6f245028b49, 0x60ebfb37c8803b41, 0x29c536d5ab382524, 0x2ec304cd34f6cae8, 0x34a629c8f4b5bc6f, 0x7f7d3e45b039b16b, 0x597b1f4e67c3fbba, 0xcc29128db07da685, 0x4a828ae34a2a3f87
+, 0xaa537b1077460387, 0x71bb91adddcc62d4, 0xfc55551ecb4ddb1c, 0x7df23759eaf15787, 0x44786952d8c58381, 0x4d38ee9879402c66, 0x126a4a7043204d6e, 0x375f282c45793e1d, 0xf524c4ec9d850a82, 0x6d96d8f08ef9cbf5, 0x1dbdde297f303702, 0x24fde3b039604273
+, 0x863e4ace18eca8be, 0x03ccc0b900cd1583, 0x1c0cc2265dd361a3, 0x69e727bd94490db6, 0x247357bbb7f57f61, 0x696411eace2d994c, 0xff0ff64deb40ca1c, 0x5b8d4e28fdcfb5d1, 0xdbea06301c4b50c7, 0x3acf06370bca9c3c, 0x8d7ad711e9e6ec1b, 0x3379bb7444ecd3bd
+, 0x64822168c034d62e, 0x49179bd621a07d22, 0x4ff062a850222975, 0x7f5803206058f3f6, 0xbc100c510264fbfc, 0x1679d26255c462ed, 0x6ae74dd7c2a58697, 0x21de77ae8ef58463, 0x87b794c2b9574b6c, 0x22cff81eadaa52cf, 0xc2c19153ff9aa535, 0x5f3ce94e0ac99859
+, 0x0a734476a654649e, 0x2fe240dffc632d2e, 0x9a30db0822f0710f, 0x33023db0e6520e5d, 0x66043204f24f9f05, 0x374c12da05316975, 0x1053e068368e8697, 0x67bedc6bcfd53f33, 0x5b339e4965c4ccb1, 0x367e73f14aecc540, 0xa88cf1c7c39754cc, 0x57219b61fc2c7f04
+, 0xd3cc059fe5088194, 0x2136edeb105446de, 0x9b2471444c1086a2, 0x72e63b3f9c686a94, 0xb4ed00607ecdb3cc, 0x2de1ee3ce6ab99ba, 0x6b6ecb648f048929, 0x25fbccaf964527f1, 0x156957359c1ea9dd, 0x64bd270fd61afa57, 0x93fcfe4ca50bd3c1, 0x1a4f2d89a2021392
+, 0x57be723341cbe055, 0x7fb4e3c45ab9016f, 0x904d55d293f4291a, 0x315d58d1bd078eeb, 0xb6583038f7808263, 0x6489aee01daaab45, 0x302cd7998bae8b4a, 0x62376506aecd61cd, 0xc9fc23fbc38a23f6, 0x21987d5f61b98eae, 0x4be48dd243e0aa7e, 0x36048df268dee247
+, 0x3f17c276acbd0e3d, 0x50385796831c448b, 0xcef7d66e7614d350, 0x3c7579aab381fe14, 0xfddd6d546c463cf5, 0x3e3fc6e071ecaa2e, 0x19d87d8ab51e8322, 0x128a22cced7734d7, 0xdf877853562b2f63, 0x334b20525bc02564, 0x171a9c6bb8aef4c2, 0x2a198167634f03d9
+, 0xcb7bfc384538df45, 0x02fa9293c2fd9ade, 0x6a62bd039359e043, 0x59c49ea1b41daaf4, 0x45e8df02ffe3189c, 0x02bad99fdd3d610c, 0x1e4451cebc404521, 0x7cbaa95c8dc12232, 0x9a977276876c3b2a, 0x4f6ce7de48e999e9, 0x54ebaf39cb426cdb, 0x1698a24cda20fe0b
+, 0x6e3406811a4401d4, 0x5224cb006857c53d, 0x58c5d9220f89779b, 0x5f5d632a3a471e81, 0x784db9604cc1e8d9, 0x3a33b2fceff8410e, 0x3e7bcac43394ed11, 0x4267e9b131e898fe, 0xdf8aeb9c24d92050, 0x4f2728fa86321e7e, 0x0986aff63b90aa25, 0x6135b09a0d71cd04
+, 0x24e946fb6e80e606, 0x3b61b3dd6d8ad71a, 0xfd2d74316224cbf5, 0x3eb9d31e07697f5c, 0x49c7eba6843bb7ed, 0x4ad1d8e8c2e52dc6, 0x2bde07f441b0f01a, 0x5073797b09e115d0, 0x08dc8b321c36021f, 0x557c4ab038a729ca, 0xc706b13152f43219, 0x04b983f0b5c24cd8
+, 0x799e341fe81673c1, 0x3bb4a3aff5bd9180, 0x3b0fe10bf05a9400, 0x34b1f837e49d3518, 0x5da363b0924005a9, 0x1a4115d514870bdc, 0xde825f30f06ac551, 0x58b150d88a493be3, 0x5181346626f56254, 0x501aa1e6626db964, 0xf72857fca1045de3, 0x5e653a57f130bd97
+, 0x98e92c3e4721d877, 0x3a1721ea9b6be079, 0x06bd88cc427c7b11, 0x2bf94b95577c62bf, 0x0f996429777c8a8b, 0x2aa5fa8d85e40f02, 0xf093af8fdc477945, 0x50a941dd4cac8f22, 0xc735bbdffe36263c, 0x58cc3bdec5dff30f, 0x9cbf11ae27b4f265, 0x156c9461e02e1aba
+, 0x657ed3b4ef9bbaa7, 0x39a6f8e9c45df0e9, 0xddc4be2480713a98, 0x0cef0e56069d6488, 0x22acc1c58ed77179, 0x41522e04aa4d6060, 0x7df162f1025acfa7, 0x5c9d971931b8d202, 0x3f7fea4e5a8b2825, 0x343cb5029e63d7e7, 0x518093596204d0cd, 0x2df046cdc194b03c
+, 0xe4e1ed83cb8b8beb, 0x475e8906173ea6ed, 0x19088e279892c2ef, 0x67610f79a93d529e, 0xde3cbc3ef435548a, 0x57d38918428c8369, 0x12bf6a28db975c80, 0x062cc1e9e7d3702a, 0x325555cffbb89538, 0x637de4afb44ac7e5, 0x1b4d5cf084caf8f7, 0x526f36f01100663f
+, 0x25ef9dd2c15b4a1a, 0x35e10b33e0e970e9, 0x54a9b0b81a9399bd, 0x197117ba911f6f5d, 0xfdfd556940598279, 0x01f7500a7925ef06, 0x0f4bf56af30ddd7f, 0x6094dd9d116d9059, 0xb28c9ea56d3a2240, 0x7ddb746dd1fa69be, 0x23eae3be240a72cf, 0x1bd4c078955d7b74
+, 0xaef2a7e5ba2be7b4, 0x7799b24b3cc18661, 0xb60d5217ed3b2359, 0x5a8d5e74c3c878ce, 0x07f04cfd0e79a49d, 0x2f1c3686ce10d131, 0x8991cb1438b311e3, 0x532bef7d54f81deb, 0xbeed8c7778e3298c, 0x2d2e9046582eaf79, 0xec3921c36555fd20, 0x6930795f233a3a94
+, 0x38dcbaccc2df9ac8, 0x0ba3c736c77c21c6, 0x59515743a41f6ea0, 0x4b0be0babbf5acb7, 0x9fd7491d1e5e5b2e, 0x5760f11774d068ef, 0xf6a93ccdee2e346e, 0x30f98850f75172bf, 0x30f5697c82bead9b, 0x5d3bf50d81058ee2, 0x21b9c66458b7201a, 0x57e193c85bee48f8
+, 0x84ecdfba7c751fb8, 0x2cf3dd5b1381f88a, 0xaf8791f251c46090, 0x268185cd352ac349, 0xc2db00bb74e6d261, 0x30c994ac4869a3c2, 0x8c84ad4ccc1903c3, 0x0906fddc4c349c3c, 0x5543ab3113522640, 0x5deea037d4173060, 0x6b74fa9e9b72b97a, 0x4f7a5a8865c4e185
+, 0xb5311d2f463e27d4, 0x7c9ee86e775af93b, 0xa6d2db685b275f18, 0x6e7a80afb5635c89, 0xcab7997abe5a72c9, 0x4f993a4adf90e160, 0xaf6d1c676628fc28, 0x2b5e169e737efc73, 0x43d3f2a67d512893, 0x74b4a8dbd0829683, 0x20e4a117de0a50e5, 0x2ac080649626dd9a
+, 0x3641276730d19925, 0x7526ef51044d2f4c, 0xe1c5c233e956f9c7, 0x7b3b04e6b8ab8838, 0xe728ce2c5ecf4030, 0x745eed60ed9d5ae7, 0x91a3dcdbfddd68f0, 0x2e5ab2db3251d379, 0xb3be60c3fca23c7e, 0x062885622bdb03bf, 0xf5aab8ba1703e4a9, 0x6ca9ccf4953e04dd
+, 0x8c4dde421683edec, 0x56a55a7d8260c1a3, 0x6f5764d91d0de7fd, 0x40e5e31c9e89fe61, 0xf92f4d9fba1e8cd7, 0x4da191ebc0961870, 0x11490df6e386e912, 0x68c1cd55d1af1e48, 0xb44739bcddfa768a, 0x479189b6adcd45c7, 0xb4df1751c8fa70bc, 0x451e8ca5f5c836d1
+, 0xc65ffadf2abb1efd, 0x15dcbca022333a67, 0xfcfff659b657c9fc, 0x4cb7f70d6f04af1f, 0x10d6f9de0423bf79, 0x4046ac2a3576e016, 0x2d03ee25d459a4dc, 0x1c80a3618fd08ccb, 0xeceecf287e386ba5, 0x0971e8bee8855061, 0xf73db20daf17d865, 0x661b1f5699c0a40b
+, 0x0608ec4a6556278c, 0x254d35d4f227a649, 0x59d2803dbcf0a8b7, 0x5fde41537d4e8709, 0xcb007b55671d8d70, 0x72fbe3b848f781c3, 0xe4d90cb181ccc611, 0x1e481e99e0c47884, 0xb9b0bbd01eb32c38, 0x011cbb2ebddba0ef, 0x033217092e4d826c, 0x547417de766813f1
+, 0x7095b5edc2bd07e7, 0x4addc0f41dde5aa8, 0x64fc4d260b95aa44, 0x0b3f0cd286baa73a, 0xa60875e1989f7749, 0x5d187dbd3a6e6645, 0x2104b0bdad149f41, 0x1931d0db7d0ef14e, 0x2607727df8922110, 0x605811e35bb9508d, 0x4a170a35cd192db1, 0x22955d5c1f701970
+, 0xca6f44a0ad1561a4, 0x482636619dbd9967, 0x24afa7357046d3a3, 0x664cf6cbe49d64f0, 0x605961f4313ac20f, 0x4cca62bcf9d5bce9, 0x008b57205883c290, 0x41706515f6a2b10c, 0xb47e22aafe8a0742, 0x103b42b03dd4a971, 0x8a4725aaa55a3a00, 0x6ba017d6cfe0d238
+, 0x4d37813441581522, 0x320a719d66bffb7c, 0x87818f22dff85f1a, 0x56f14012541d87be, 0x81dc29adea9811b4, 0x2e9d21af621614a5, 0x28de97ddd13a411b, 0x044fe365484c90c8, 0x02388fa1e4ac0ea4, 0x7875f0b4c5c89660, 0xff86fe3873147eaf, 0x2a99b02b4c8b80bf
+, 0x9ab831c72b1691de, 0x43665d50d25b74f0, 0xc4bb6f8a8713298a, 0x24effeb7ee115ea6, 0x1a175258d59c7220, 0x60802d398628957c, 0x43c23df1b162bad8, 0x559fe9d6e7999e91, 0x87bf988b6971910b, 0x10adfe9b2c46964d, 0xbd2bfb33e1ce09e8, 0x04a2a75f400f83cf
+, 0xcfe0a0dd4520a9c7, 0x0397cd684e166322, 0x072062d8b6cf2c9d, 0x66787b051d502cfa, 0x6774486b60301f4e, 0x4967fba9f9c78c65, 0xd3b4ea4ad5a1749d, 0x4d331e245595f479, 0x53b442124f223081, 0x0b3ad8e64c58c3d5, 0x0831f77998f3be1f, 0x25effcd33f446408
+, 0x38ff6c87be65f411, 0x2aaf08cf85c6f8a3, 0xb91ea62b09063f2c, 0x321cc1e269c96251, 0xb3d276ec59674556, 0x4cf5e33b23b38336, 0x222f541de5dd2186, 0x11ebe9aec785ddbd, 0xb51789f8920cf563, 0x57216b4e7bf081ae, 0x14fb5897bb1a9fdd, 0x599414b9c1546c86
+, 0xc4469b93de0c39cf, 0x72aef52a77988705, 0xe3e7860270ebd189, 0x6781877798e8fa84, 0x4e0c9a158eca3e1d, 0x422300ca807ba2da, 0x98ab346b7282a40f, 0x5c3978585d3a2eeb, 0x0bf21c3157887100, 0x17b512c37cd05ca5, 0x3a9efecac0506620, 0x0cd55e3a25f0a96e
+, 0x98d80d238a33bddc, 0x3784dac61576313b, 0x239cb1959c810c6e, 0x2940c306cfe4b0cd, 0x3fd8f85dc0ac781d, 0x55238f4f72780dd6, 0x586dafb30ce65e5b, 0x079140729be0fe5a, 0xbfcb3963e261f3ef, 0x3c282575a1880d92, 0xf88d6b07ca2eb85a, 0x710f536cf48a7624
+, 0x5daa9da5a7b83c64, 0x2c5f76baff2e4fcf, 0xb3479b0e10610c15, 0x775f9bdd30ed36f3, 0x8f8a8161dd6eecf3, 0x2512d572fb0ba97f, 0xbc61c2f818199f9e, 0x31ab2431b5ff27e1, 0x18d820f685aaa8dc, 0x0949a562d473d661, 0xa65a29e48f3bdd54, 0x1345a524887c88f5
+, 0x683fa036f69decbb, 0x7f314df234697378, 0x207144879b76bb1c, 0x523f118570dc2470, 0x48c54948f7e52060, 0x6f5621381c4bc37f, 0x3bd772499d18f6e6, 0x2d792e01d2172974, 0xab095a8b276b4981, 0x1c523d3084bdc687, 0x6e88da2c4ea5d8f0, 0x33d3002394f0e677
+, 0xf31ad91f49ece341, 0x3c0291f57c647531, 0x272cd2bc1e39e252, 0x6846822a48651302, 0x98652f498430f351, 0x61bdeca1ce760148, 0xc46acaa8d8b59670, 0x649fda1e14588e7d, 0xe59392d7aec50da6, 0x58cf3f0de2ad0594, 0xc8156fbbf073d714, 0x6b90adc06b54b1e8
+, 0x99ab4e82d3099811, 0x52342592cbcbb6bb, 0x1d487b6ed3867b49, 0x4d1db6c99f41beb9, 0x1702478a6280d38f, 0x0c1ba8346f4cac9c, 0x31b05608b0578c8d, 0x7a9193c803b5297f, 0xf0a3e56a8ce50853, 0x212eced55d5de116, 0xa2a95f224270eb8b, 0x26ee7f3f820f190f
+, 0xdfda899c85512867, 0x37b47264685821bc, 0x743b57f2b1a6c718, 0x1cb1e6f60e2336e1, 0xacab8cec4a656b65, 0x24783bba3e933255, 0x71004ae7e25ff15b, 0x08aedc2e6a9b69d4, 0xcf7291292589b36e, 0x42e5db5a7834b88f, 0x2f5ae180f3e8e793, 0x359e7806b1ea6639
+, 0x721cdec99115d8dc, 0x4a935ddcf3db2253, 0xb7173b890dc2ca22, 0x4bbf7007c4b54180, 0x41b4c81649af3121, 0x036f5c9d870376ed, 0x15cec9a0d47b1b0d, 0x01b030d980f30a45, 0xbe2ea30f22b5d6ae, 0x183d648c3b5eb25d, 0x3caba751e59337bc, 0x76990342890ccc13
+, 0x4a543e41a8524adc, 0x7d9681efa9a08b58, 0xfc20645eabcf204f, 0x2636d5c4cca32a2e, 0x9b64e4d67278beb8, 0x15122f473f7b4505, 0x5d5a41dc928b45b6, 0x02a4c9e1112abefb, 0x3344f9b98cc98405, 0x177e726ccebc1c7a, 0xd947468b8169c430, 0x0d9a51fc6e1a6086
+, 0xced4b6ca1fa5f347, 0x7fc1b7faa410069e, 0x85f9e90705eead1b, 0x160c3ae4d7b577ff, 0xaf90b0704f3a27f3, 0x60e525f3d3c03e1c, 0x77634edb349bb296, 0x0b9fa4985d42d232, 0x00eddb8e8143fa2d, 0x222e3f219bfc1696, 0xb4111bab7653efcb, 0x4a5118ea27d4639d
+, 0x849f12bf57b20dcf, 0x04b77d108a814d03, 0xad3cbf5b99cb10e1, 0x186fc08609f4c04c, 0x54cc47d22e9dbd94, 0x2707da8833c9ca9f, 0x3979b4dcbb524091, 0x339ac474824d3001, 0x1c56a8b3ed85b7f2, 0x3bee5b32c8678d0f, 0x9ac3179cb8a3e904, 0x584d55d81a68e51e
+, 0x19c8dbcde1a33753, 0x01afbbbe03adbc59, 0xec3eac458491cea1, 0x57584f58f1bb3649, 0x8ce2bfe99b2ff9f9, 0x4a6101975dac3c9e, 0x264624b198a02c6b, 0x376a052ef879a3b6, 0x31491fef100fd158, 0x2b6b7b6c3e8f1ac4, 0x71b2a321e81c0a0e, 0x0e4d45d2876dbd58
+, 0x095716e2197ada73, 0x18efdb3093750d58, 0xcda9037c21a4c4e7, 0x778694ff8352db1f, 0xcbe16ec690569f2d, 0x59e458cd393eef91, 0x05505a9bb62c9103, 0x190e88198f0aef3f, 0x56a0a90c01b6d539, 0x4d7c4bb7ab4fa221, 0x097475a78cae6b20, 0x28e35721bbd7bbd6
+, 0x392ccb3db490c141, 0x44df2464c90c6f36, 0x82c24c3ed283eeac, 0x2a88330afe8505f7, 0xf304762be127d372, 0x728bfa655be5c04a, 0x664b20b7096aab19, 0x41f137e86c314e5f, 0xe3ed4c2466422a5a, 0x13d3ffb3ef79b0ff, 0xadad23551c109a78, 0x0e3059c97c805beb
+, 0xb1941656b97f6c4b, 0x6b858ce457664463, 0x3543064979ac0297, 0x720d8e9a1f5f51dd, 0x6782f4ee7ee13197, 0x32054f367231060b, 0x1ad0e7aceb770bc0, 0x0a50b4092aff4059, 0x9806778c1d6b84ce, 0x7f6d47fce322faf4, 0x5fb710db0e4292d2, 0x240218ce4c9424bf
+, 0x71ae53310f698227, 0x2903753f56db0741, 0x3655e530eff2a46d, 0x2bcd967f095d6740, 0x9bc2d792a0a2f7f3, 0x5afc32f8ca69a332, 0x4c578a308a440b36, 0x18f9d9f3e54f7657, 0x3669bc369250c341, 0x0f40024c3cec3cfe, 0x2c63b62138121b12, 0x24506ea4d0b4de81
+, 0xca468ccee389105b, 0x3874df0c7a69cf50, 0x675ef7ef68d54177, 0x27423ff878504e9c, 0x88a41d06e81b2239, 0x2d1bd6a10eb63f2c, 0x0e44c0f183b7bd43, 0x034272f4a6b6eb56, 0xeb5b083c4e056245, 0x315050c09cb4afd9, 0xe4f3e477e8a71175, 0x7501f0a9d30162bc
+, 0x4667c9517270773a, 0x2a1f78172e6fc031, 0x84de2b10094d7771, 0x273c6a7051df9be0, 0xcce63c796b51c01d, 0x6aec8c5121833bfd, 0x322cfd4e7ebbfbc1, 0x7f142e86b7ac0dd1, 0xf48024fceca2b435, 0x51d6de778a3a2133, 0xb1cad261369b55be, 0x51ade58b8808e1d9
+, 0x3e2c51a668db3dfb, 0x15acfa85296f0cdd, 0x7ff06f860f32cdec, 0x120c3c09366ab6a2, 0xd862eca783641233, 0x704d5f561c09ea05, 0x6a25bc68adca2026, 0x2cf72632849d1992, 0xa5ea8e50a0505be5, 0x521ef475a72769ec, 0x05c72e2080793b10, 0x008b8fd49dc752b6
+, 0x68344c2e1389b7f8, 0x4f6338097609bf0b, 0x2f02d08c4a5a9e8e, 0x7ac98d215da07a7a, 0x6b76edbb270de8f4, 0x0c9dda466d01c708, 0xadb8892fe2a339ba, 0x64ff5ec25cc4b0be, 0x667a83e83aac8bff, 0x67407038618a1644, 0x4f09497cb8a04dd1, 0x41e6e14577bd3684
+, 0xfea04e8d7f109573, 0x1b62368308cbeaf1, 0xaaa1905998dca009, 0x74755e8bac425723, 0xb92336885093d864, 0x0c6bcfb50ca8fce1, 0x6061816b4186c806, 0x2b2918143c1d4817, 0xc2dbac570f721852, 0x264dcb2a0f838c55, 0x3b13a9cb98db98a3, 0x7ebcbc604006a432
+, 0x0d656cb8e7280e12, 0x6911b0e3b4d1621b, 0x809c2423b3e19fed, 0x2cedee6f2171c93b, 0x8405a9c6473ecaa1, 0x160cbcb6eb381e18, 0xb4488ef417c2e671, 0x2954a77829a7a007, 0x5d0cbd327aabda82, 0x0d3858f88eca7dc9, 0x9321a0fa924636df, 0x2ec538f87fe29782
+, 0x89b3f17dd690cc6c, 0x355215a2c91f0b07, 0x5e55da6f6023ac9e, 0x5092ecbba852fc2b, 0x6b53e0cba4e31676, 0x56011e4f634470a6, 0x4d7d750c26ccccd7, 0x28aac70e3a0a9eb5, 0x082639797d48c09f, 0x17947ff721b87546, 0x6909a0a077f1424f, 0x53d8e8664ccf61d3
+, 0xff8c0461ac0775cd, 0x34cd5a63c9958225, 0x947263ab39b88c28, 0x6cdc0f2d7ef6843f, 0x151f929647996d00, 0x2b004d4f6855bf5b, 0x26a091bad51fc675, 0x3f761c727c515517, 0x8e71013d17a74f11, 0x115961f7d0e6e76b, 0xef2e351c0e8e4b89, 0x3ac2e49cbeb453b0
+, 0xb256d8e78702f03a, 0x57748613739c76c8, 0x133562ea3eb8f3aa, 0x00aa3637702e6dfd, 0x2fa8c6d9379ac18e, 0x7016b45f8bf7f3b6, 0xf66c111c85f7bdc1, 0x272ab154fed4e21d, 0xe31fb62cd4c2e877, 0x4fe63763a792ac93, 0x1b40d4c624e46c6e, 0x3fdad76374ce06c9
+, 0x8f94b199c687f441, 0x117ec9ad95290bbc, 0x2b3db0cc28750a00, 0x63e7d4a191ddd9ae, 0x031b547ed7da0710, 0x69d0752d1d15f320, 0x1bbd76ab1c5495c4, 0x5ecded69d9d158f0, 0x6b10a82a7a13407e, 0x05adc131ba7f927e, 0x65f9d0c1c26d159c, 0x7dbab0fd9be3475f
+, 0x01291861d20c0856, 0x15972d1a8f51c899, 0x58a0e48a28194c6b, 0x008e528a4d79252b, 0x5ac32c04b784affa, 0x289942623f11d738, 0xedb37ce1d36f41e3, 0x173ca1ee5d97379e, 0xabf9c59002690ecf, 0x250f3df2c95e147c, 0xbf0f140602283da3, 0x059d3642e4eb7a74
+, 0x6850d77a0d86e019, 0x11db693a2ada2ec5, 0x1db65479488c056f, 0x770e916d3973b525, 0x54319b31260a95bb, 0x1c825dc9914be611, 0xff37cee1abdce827, 0x7f91d23020de8824, 0xcdf423b35e3673c8, 0x5cdc0cec83bf4b56, 0x537140273c21bcef, 0x35e4dd67a1a2d510
+, 0x902317b13e8ef5aa, 0x13dd4df4b237ecb1, 0x1d511bde284ca5b5, 0x06d2bd272da8d569, 0x5500b2f30b0bb3f5, 0x2acc2b4cde3832dd, 0x546b9f5f1b773e2b, 0x4e1136887094a4ee, 0x1dcb4d6c81723559, 0x4ef9b026955d3021, 0x3d1af84e71efe714, 0x2f0284a34e248650
+, 0x0adf26c707ab2b0f, 0x41443c1bcce338fc, 0x6c0cf56da0a9c498, 0x10a365de0afbfcaa, 0xaddfd82947ce5130, 0x2fca4c7d68c7d6bf, 0xb5960df7ccbf9093, 0x0f26d2468dc3301f, 0x3133690973265e40, 0x0b6317e1b3e039b0, 0xd49dd88ee2cb1f11, 0x1606cc3e783be9a5
+, 0x3f9600251761a7d1, 0x43e3f4912a221a84, 0x8ce5d4cc977cbe61, 0x400e29b3e5f42099, 0xe6b555c6c9928b91, 0x08dd0cf8caf7777d, 0xb12e05aa6b4e03d8, 0x0b1be5490ebb3fff, 0x57921e9e127ad9b8, 0x64dd5e7238f0dd8d, 0xe2030a617831b8b2, 0x0cbd603158fc6ef9
+, 0x4dc825010c050562, 0x1cdb8ae6a9164013, 0x9689573c1c195268, 0x04f5fc248d852d9a, 0xe36a0f245ac8dd31, 0x71f65cc3b82c3a11, 0x2e3b14763537cd32, 0x569635f6cd2390ed, 0xc3a1909e135fa590, 0x3526c21033bcefbf, 0x8b4fc3123f76948d, 0x2c09737d7e9f7fe8
+, 0xdb779257c8bed3ce, 0x5c7c5611dc5f4062, 0x8c96a1f2538ee356, 0x07296d7132dbd5fc, 0xde813e496f86d91f, 0x551023d3ef3b3e13, 0x65c07250010873c1, 0x12a3103f42fa3b7e, 0x2a4522c10234b6ae, 0x01ed434c6affbd0c, 0x9d52c813624da1fb, 0x06bf4b402d4663a1
+, 0x23e6070508b5df25, 0x4217504adbce062b, 0xa2e882405519f972, 0x42600c4062444ea1, 0xbd5788bf6fb4ef5e, 0x06835b0cefa86a8f, 0x9982fc4637496a06, 0x2c0cec23278eae19, 0x797ecdf6cceb18fe, 0x7b7fa86f46e99bbf, 0x4b84d893771cf3c8, 0x69ee4314f1729ce7
+, 0x6b2ac8750b5218c0, 0x25f294478a315ef0, 0xe6f812a27851ed17, 0x7107cb4b21b33751, 0x71125c177d56b489, 0x4b8e26081ac7739e, 0xb720df054c08de70, 0x33e08a301cc7d063, 0x530facb2c7d92a5d, 0x250d7c13d9f0e62d, 0xdc219479399314f6, 0x5c2a6c76f73ad940
+, 0x6f83e84667c74c4d, 0x14aa54e8d88df34f, 0xa06fb44cfa98c076, 0x092605cc462b475f, 0x375f827b3a5a7b61, 0x119a25bd6627be64, 0x4ee3a2a7376f4f4c, 0x45135163d95e7ee8, 0xad5bef0003024f35, 0x459f6faf8b99443b, 0x45a0a068c2b58ad4, 0x7c899030db7f7e43
+, 0x0e3e1ab0eefcb9eb, 0x6965f1bcdb44ce6e, 0x5b8d76a4a8a0a4a9, 0x49aba7b5439824fc, 0xd0a2cca9d5771d84, 0x6f74d284a947ff29, 0x5cc8c41155d13308, 0x5e36ffc95089776f, 0xa6ed9a5507e105c3, 0x5bc15dc275678433, 0xde574c99ca795adf, 0x3e2d0ee75635342c
+, 0x0078c891ec4104d3, 0x562bf3d9ba1ddd3a, 0x1de4d97827810820, 0x6d5ecacd851d20f0, 0x314145cf9658490a, 0x5497824b92ff3c1e, 0xde3d3b71487ed274, 0x51ffd2dc507caecd, 0xe87a4ba49f2e38ba, 0x5785d9093efad606, 0xd1a92afc491ccd2b, 0x3f1ce03874369c35
+, 0x660806a594b3fd0a, 0x19e49c02cfbbacfd, 0x0a066a423f546089, 0x1ec2770593d3f3d4, 0x754d570f9b6cc003, 0x428fc2bf82021ee3, 0x704759aa1927ebd3, 0x56c685542ef5d37a, 0x1bed654dca3a2c61, 0x2d34395b3cde7daf, 0x4815980aa029c8c7, 0x3ef785ce8d0690d9
+, 0x516450d65bc60b6e, 0x10ca0e4e250bc607, 0x5e473ddfa011fbbc, 0x462d23185330af10, 0x86f08cf80c082eea, 0x1886636bef5ec4d9, 0x2e33e6cd20b66861, 0x7c2567c14f6fa760, 0x45b9f61e9137bdc4, 0x2c81fb201974270e, 0x6455a16cfc2d0379, 0x7318c23d8a6d5999
+, 0x4d72c5dc06a704d6, 0x1a8f83419f9658b2, 0xd96730e9422e0fee, 0x65c3c1ce7f1b4780, 0x3990eb6afed0fa57, 0x15e384328d14a9ec, 0x8e1ec11360e88239, 0x4331295728132089, 0x8134d616e824f441, 0x5f95352a1296e9b3, 0x70e2e7ba5a5ec1be, 0x59629de7be3e856d
+, 0x9ee62d56893c4a78, 0x171bc669a8f9677e, 0x749d97cd88ab43ff, 0x76b5661a89574e61, 0xc024616ce63d7dcf, 0x79e9eef7bb357e69, 0xa8304208bf50ebf0, 0x1ba0fe8bb6384d62, 0xc6f1d13e59d6e6f9, 0x4e2570da7f767944, 0x1ea595016a647cc1, 0x754381c1ca95f3c4
+, 0x14c44e4fe2988b41, 0x3cac1a657c899a03, 0x4586c19ae5f51cb2, 0x0822f76a9537945f, 0xe1cd5d29555730fa, 0x4b31c78f3d36bb2d, 0x10ac44ebfc8c9005, 0x5d18ad5e37cf8dfd, 0x1147a9c3198dcf31, 0x3a7322a3f04d5b3d, 0xf6e2c11ba5c42c9b, 0x4eeb3273e42de50d
+, 0x7b624d203718b7d2, 0x68b653ca059e0eef, 0xd891a8b962c74022, 0x117635841f973f2a, 0x74fbb7a3068ee12c, 0x07830bd5b9aeaadd, 0x7849b489efdd2e43, 0x612ffc51d5c8be80, 0xe560450dea68af7d, 0x1b0a8566acc03ba6, 0x02e976065c01e64b, 0x229d39e95f292f5c
+, 0xcef2121b4bd0ca00, 0x6e4dac7fe08cebea, 0xa5327a5b3da20cc2, 0x1560ef7e3b778fd4, 0x0c1f723254fc2bac, 0x5f040bd47ba87bf8, 0xa1e72b00e45b7684, 0x5ffec8d172cea504, 0xf972697c7d195f94, 0x04475f0efdf07077, 0x1dd05e386eb6a12c, 0x2f47991453446b75
+, 0x2c26a9eb85ee7de7, 0x0ee02f6d258a8d37, 0x34038c0dc4eca700, 0x5159bbdf41d8faa8, 0x91851b9e46f4b2f2, 0x207d04e6d93bd277, 0xc634a337e31267a5, 0x2239710066f9db43, 0x8f2cd94e788f0382, 0x0ac3a7a73162ec69, 0x61f6c417a9302a8e, 0x2d3cbecabf976d80
+, 0xd122f087c9a49650, 0x4e51c57b0dde15e2, 0xa94b6bc672a2bed0, 0x096d82f8cfafbdc2, 0xd7d144f240bc6b16, 0x537087a02196caeb, 0xffde0d6f6506ff5a, 0x57073ad4846fc319, 0x2c86bc846c37f4e6, 0x1a385a6802098107, 0x7c509571ecfbb9f0, 0x4970711630080324
+, 0xa18a9a6cf70412d9, 0x5b971d7cb08f6404, 0xece1d697e296c4b4, 0x5d5269fb3bba7ba5, 0x46ee8d55a802b030, 0x0fdd07f34afa1aad, 0x41f9b2f225577507, 0x2c2e07ed6fd11686, 0xa6d86e0e34663b3d, 0x221bb6bcd5af0204, 0x49954194426abd73, 0x5cdcfc8cc1214017
+, 0x67ccbd8c7a33c5b5, 0x709d435833e3d2e1, 0x3b9ff20157a20dac, 0x2c698fee5876191d, 0x6562da93924648a3, 0x4de0c2b08e466ee0, 0x9f388fd9a337f8f8, 0x16f6f8b10a4316bc, 0xb61cbc50785f6ea0, 0x22b7db17f644c0b2, 0x2891e5ff2ea3619f, 0x21b2d841bd3a725d
+, 0x8bc26b9560537ec4, 0x182cf68639dd1417, 0x425cd848f73ff2fe, 0x5b56ff734331c9fe, 0xa3fd0d094d4b381d, 0x3bc269a3ab886976, 0x2e3be94db7c6a05a, 0x256744ce0a9f47e3, 0xb6225cb4aefa7ebd, 0x0cdaaa555dace0cf, 0x2a0d659f8ecf6499, 0x7533048eba655aa1
+, 0x59ce5e4af0d02d98, 0x6cb6015f2a345169, 0x3620f03748ebee88, 0x69c7b470bda8b706, 0xbef2cd32168bb346, 0x13beb7c524c7d1aa, 0xdd9209fe4142444b, 0x1ebf14826011b908, 0x803e7b3e4329eb71, 0x246833019f36e177, 0xfbc71f279d2e85ba, 0x6636b2c24e9ce72a
+, 0xb960c233e75e1617, 0x273bba7f45201e0a, 0x3c1e97699bb1af12, 0x1d5e13bdc1f5b4d4, 0xcbae3e4bc4a6a309, 0x6815e6ac4cdbd907, 0xbe1236d2abea1559, 0x2cbdeb07c1297143, 0x97d360ac2825231a, 0x65d15602eb9ffbf8, 0x1556d6a5e3d56342, 0x102221509b870004
+, 0xdf659337680397f8, 0x3459d0828e439640, 0xae31b46cc3a521c8, 0x51740984476e126c, 0x295e9b3685de5e87, 0x2d852bc9b63129e1, 0x8358ac7353516c7a, 0x78475da5d46b0b8f, 0xa3f96fbd1d3773d7, 0x3ccb1d2975af552a, 0x633ad360a8802dfd, 0x77a1da382306ba1b
+, 0x797c99b2536dd157, 0x258d1f813fa0065d, 0x312a1c90691a9c3c, 0x364d4cbf11ce013f, 0xc24e4a2a24813c8e, 0x4c0e7bc8dcf91666, 0x7ec1794d00b39d56, 0x1228e2d8cbcf3bef, 0xc23038a926f539f4, 0x4f0eb6c1e5551d1b, 0x90fc0db200bd12f5, 0x410e407fd04f5810
+, 0x616a58a92e5d8dc4, 0x40a75a0ec4f4b9d2, 0xdd118153d1fa3eac, 0x44c2d53b6af23d2c, 0xe1c83166d4ec7b2f, 0x4b1aaa2920517b93, 0x1b442a6c77af438e, 0x3ec11e978603cf4b, 0x1c55ee1305b19015, 0x29f13a0cf362ca6f, 0x45ddd3cfb8f1ebac, 0x0e9ee7748e58f8d1
+, 0xab070805b5813780, 0x47653079fdc8c9f4, 0xc9036c01f85ced00, 0x5a07451e8497d955, 0xee2bffeae933d940, 0x32a6a43c20e5dca6, 0xf84d0c062043d854, 0x609d8d312d3a63ae, 0xaa0a7a2374d99b5a, 0x118cf236159e66c3, 0xaf76be0bbf47e01f, 0x1b181439018ba514
+, 0xd663aed4cf26598d, 0x38fdb1f3783ccbdc, 0xd6cddd74b9934866, 0x2829eeb93d2e9a1b, 0x29e4a8328466d99e, 0x1ea7eddc2af4f438, 0xb4f4f1ecfde4f2c9, 0x5cda9e5207dddaf9, 0xd02c470798edbb8b, 0x4def95c1a3ff8d96, 0xc9405aca1a097085, 0x43b107144fa7e484
+, 0xfea2c63d2c545602, 0x1d330d1906ec8701, 0xf64e114009d146d1, 0x763b94925b8ba4ce, 0xc57c3779bc50ae9e, 0x6b4c199d87d114dd, 0xffa564107bde03e4, 0x37fec16d87e66825, 0x57eea54abab0863e, 0x090cee474685123f, 0x3f8b9145ff36a0cd, 0x65763761d0f67de4
+, 0xc26d30e08c68eaa9, 0x0a72d421467995b8, 0x757ad87f16459660, 0x6d0d41490f58d7e5, 0x50fc7d92d42c42ed, 0x71890295f3b27b53, 0x8fb23586d8e2a038, 0x5365ef319d7f4664, 0x84bca323307b280e, 0x5358b1254e7242e1, 0x5c3533f8795477a0, 0x7c5b243436f30876
+, 0x9b465a38ca046d01, 0x3b6eda7011d78c5e, 0x476062d8b988db7a, 0x186de955dcf1fd83, 0x1f35a5e0464317ad, 0x1238b75e97acedf0, 0x55a1ad8bd5f60f6c, 0x71f5a0f40934b4c7, 0xe9e7570786b12203, 0x0f715687567d1240, 0xb2ab5cfa62441699, 0x7cecac6922e6057c
+, 0xa3cefdb86a148a5d, 0x7a2d1bee5a66300a, 0x9489149ff145fd1c, 0x12ac7a754e5fa447, 0x41cb16c983fdee94, 0x0a190bca2bb12281, 0xc912d4c43a2af340, 0x2048f2c9c09c15fa, 0x6a4ddd656b78188b, 0x3b60f2ad1970aab3, 0x29888f437513d5f2, 0x2f85ece205ef15a7
+, 0x0f0df5d45e23c9c7, 0x5000c71eb4bc5757, 0x7b231da3d2a63574, 0x450056c4952c4381, 0xafa6f8a7ab94b594, 0x626a74565db5fe7c, 0xd1c59a06a54864a9, 0x77c39304f5c23e18, 0xb0d2b6abba4a600d, 0x722a7bc43702fd3c, 0x2fbae094056792fe, 0x3b92e78ae19b108e
+, 0x367be940c3d5bf4d, 0x67379c2d47e0e8ba, 0xa28b18c9a8e617ea, 0x20e5bc6074754b7b, 0x59ef7c6c5c4f22f3, 0x3bf723fd8d9c085a, 0x43cce84b7ebb5c21, 0x044a778d664cb2b9, 0x7d49c8357e316596, 0x6d004fc0f4dba750, 0xb84cad5e98309b5e, 0x24ff294ed0c9679c
+, 0x7ccbf03fbbb64a40, 0x1a0568582e188873, 0xce2b6064933fc018, 0x0565c665e45010d0, 0x6eb19ed6d9eca3a8, 0x5b079436b5c6711f, 0xa9d1f207b9b6e0ff, 0x6e4fcc96c48c1c98, 0xcc45bc93108c046c, 0x75a4caede0a4aa84, 0x49e5650484ae80c3, 0x60cbb72611252ab3
+, 0x38d5b7e3afb7c8ea, 0x2f86e89933a3b004, 0x1df5a7d50dd8d9a3, 0x12af45a0c0785ebe, 0xf29416cce5bc83b6, 0x2fa6b9bb2b414802, 0x6a2aa2112c7ac215, 0x1499ed111f89239a, 0x74d06ed47277a767, 0x3b2c7125029b750d, 0x7d4f5a4b0388b8bd, 0x004b1963ce4e26e3
+, 0x5deb0fa7ff2b93f1, 0x03e2d26d7f32cf57, 0xcb15bae1387111ab, 0x77c8ff427dee1505, 0x2549eb3019be533c, 0x3a84e4193873baca, 0xff68b728f6b41e66, 0x48f0c13c1f26b297, 0x4115d838590cd3ba, 0x25d7cdb2e6284ea3, 0x8eb69a4c41e081c0, 0x507b1cf239e440d2
+, 0xa59a9992e181351e, 0x6116c59ba1ebe8ee, 0xa408448e2a3419e8, 0x54578f2103301a21, 0x0b4ede4caf504720, 0x38cc585099cde5d1, 0xba2e60b3d0f82ae2, 0x1aa650fa6a89849f, 0x984e05d907ce62f5, 0x3b285460ff97b607, 0x70804375265296f6, 0x25ae7b99d42bba88
+, 0xe34bff4c536a8dce, 0x22bb716986085e6e, 0xb79f5b902887a6f5, 0x374f91396093358d, 0xd8a294fb7264bd22, 0x3341b9726d980b13, 0xc48194905c4f7837, 0x3f7700f1d1680da0, 0x951c649fb8789403, 0x66489611eccecabf, 0xe901513a95bd558f, 0x7a32fc89c63a29f1
+, 0xd5ed9d1e055cfca1, 0x48d9ca98b05340fb, 0x742f2e344604cb57, 0x428667df27e10f4b, 0xba4351b7f190a404, 0x046c320b8939a721, 0x9b32f8106bb7a1cb, 0x575f3f3ab77e9f73, 0x670d03f92e6e5110, 0x0164bee1e63dfb70, 0x52f430539fbb6801, 0x2e3c89e2419101cf
+, 0x3438d92740ac5059, 0x6c56bdeb622db908, 0xb41189fc80815c30, 0x33980799d4e0c1a2, 0x26a8b759122eea76, 0x02fb4588f9d7c378, 0xd8de154d9cdb67e0, 0x548befd6f51278ad, 0xa7a60fc6e68d9fc5, 0x1b6593805db82718, 0x8f777c3ee1c99caf, 0x721dfdbd18adcad5
+, 0xe9062f8b44aec050, 0x64bf69f90b6aef23, 0xb4e5e9d9948d57ed, 0x4884f5ce671eb1b0, 0xbfb0bf1ce3a053ff, 0x3409f269326aa6ae, 0x2ba17a296d435419, 0x5e5e2898cf5f9190, 0x5d90d4c5952ec204, 0x03fc315b24e7ffa2, 0xb187e5abd02ecdc0, 0x4e5affb85fccb2e0
+, 0x0f52bfef38c4b6ee, 0x10867ff3ff01d318, 0x554ba62470ca06c3, 0x1d52b7f56c82eda9, 0xa66a293d4786f602, 0x28d7c452407eb5ef, 0x4186d756557f1867, 0x542fe2faa6f45920, 0x8e96c4a4ed072a1e, 0x0069863d9f39a6b8, 0xf361a94ee0658bba, 0x6593d4561d7591e5
+, 0x831bae6609e5c246, 0x2239bcee80f57f52, 0x47b5e8532309ab20, 0x0ad5717820e7826b, 0xbac478293382cceb, 0x4c40a959960ef08a, 0xf2e4a5ae18a28626, 0x246c1a57ea0cda9d, 0xbb09699a6e503580, 0x36a8fb37faf49a79, 0x3b399f9820d7ab20, 0x52c721ad1b344a27
+, 0xf190972aa0e1fe24, 0x6b49efe4f50243f9, 0x111f940a38d57ae3, 0x6e026c2d893d89a8, 0xaf0bc6d3f003a3b0, 0x06f6812dba6d5155, 0x6f4c9b466cebbc20, 0x70479ac4a2586f3a, 0x90d3efc3b53423e5, 0x61f1cfc4d0df09f2, 0x0ab719e8c2a04f9b, 0x14f739960faf2029
+, 0xedfa7f8090fe3ad4, 0x5f5f7188a7ff47c2, 0x03e20e936176e4d1, 0x468536f0c5ad15c0, 0x06ac754e97d8c19f, 0x70a08f6c0c6357ef, 0x641817d4470c498f, 0x76c039e97f8f1b3f, 0x4826e7f5004341b1, 0x5efddd51191d7a71, 0x4fe4df619a3bf1f9, 0x4edd8ffafb2d6987
+, 0x768e4a9d9b3b2c4e, 0x1e16becef5f4eb56, 0x737198cafe2a27a1, 0x732531bdfdfa5952, 0x6803e356939963c6, 0x0ca0392c327a1d64, 0xe72611e5d71c4fc0, 0x2bc6d93b87824546, 0xe63d1fe149cc4797, 0x481c3fd33c099d4f, 0xa3517c58e2e45d0a, 0x707e304ec691f206
+, 0x72f093faf09d1bfd, 0x59701fe815e574d4, 0xf598f69a9e00fa0f, 0x0bfb738ee7e132e3, 0x722a7bc2025c66f0, 0x3e0fae6333b6c43a, 0xb8f0743e8b48f2a6, 0x3fe809e69378a4d7, 0xf74a5925b11658b4, 0x0e6eeaa25c384aa3, 0xbe8235610e33fa26, 0x2036e6619b2ceda1
+, 0xb339866309e9e3d1, 0x69025b3e0953b540, 0x5043ff57807c39b1, 0x733b0c111853ed5c, 0x8540c558efeb0948, 0x60a9e23203cbe0bc, 0x43efe7d41c6d47fd, 0x0615d3d708acff2e, 0xe8f5764b8ce79a9d, 0x5e2cf5f4398e3a9e, 0xd575bd94e8300892, 0x7025abfb8b6c847e
+, 0x332a1394175a9858, 0x1b9a82175d951b41, 0x6452acb18f97318d, 0x51bb8d0fffe93903, 0xc0f982a4bdc08960, 0x15ab9ac2e9de34f0, 0x079643d3897b8c98, 0x3fd7530a59ce2cd4, 0x67c33b29d4a61487, 0x2558f3a3d5043032, 0x5052216564a6628a, 0x62d79470f7fddc42
+, 0x95de3f5454fce0bd, 0x521d3d6b25e6362c, 0xfed3ecedf0f70772, 0x60913fdd15521495, 0x39f68bf67158463d, 0x30ac0f5655aa5478, 0xe16ecb8d179f2dd1, 0x4e42ea43645aa9f2, 0x3df54dfeb9135ca6, 0x176b47cf47e75971, 0x01e206013ee204e5, 0x516016c6461d4a76
+, 0xf38bcafb46205987, 0x4b34fd32a691e34f, 0x66902a2fbaff80c0, 0x7894ffd128ae55be, 0x7649bbe98e7e0721, 0x2e2261a409bc30a3, 0xfa4262dd888cee87, 0x1e82e9117c7e58e8, 0x91bebdcc386066f6, 0x05cf9634e6dbc32a, 0xa6aed31de2cfd019, 0x7629fae6a3b79b3b
+, 0x7f7ae491a3183493, 0x0d238bbf35ca9e78, 0x20f14dd80f6381c2, 0x5826116fb52d8d13, 0xba9f7b873bd9d7f7, 0x70613ac750ad489e, 0x0492cfc8e4af9864, 0x35e18315e68523cd, 0x4299a69e4ae45867, 0x3c7f70b80887048c, 0xbb7fa97d47de86cc, 0x3762f3a71e9eb160
+, 0x4b03d342497ba7aa, 0x2f09f038ba24055f, 0x253d1ed9afcb4b32, 0x19f7eca19405d862, 0xd0599304645e6113, 0x4506058d3fe60caf, 0x7b6fabaca38fdcb3, 0x4e4b11b18abd7486, 0x1ef5d4b14d21e2d9, 0x1b0e8de00f4b24b4, 0xc6da562f8a818551, 0x3e5d948c00f845ce
+, 0x975afa4a3722609f, 0x29db730e32a7f7d6, 0x07f8fcf610ea8f21, 0x7c44f329549edb32, 0x736dd031d09aec2d, 0x05dbe7a9264c6af6, 0xba53f5946e89451a, 0x434e96334a4a5db5, 0x2a52e10d58ca5574, 0x39debc2455d5057b, 0xdbe246359846570b, 0x03204b5e10e23837
+, 0x24ed09ee599b7bdd, 0x318139c1aeec8606, 0x1e666820409be26f, 0x22d997cac29f21d3, 0xf2e1b3e962ec2a6d, 0x365734f2611f4d9d, 0x260ce71a18ffc04d, 0x6795d1e894b46ba8, 0x252a455b94817245, 0x0b07ddaa3dfbb2f7, 0xc6e7c429620b0141, 0x15444df6ba1d8685
+, 0xecbb74280c009b06, 0x3c87441db64aa2a5, 0x65ed6d9fcd091558, 0x65e0ac7cefca0a11, 0xa8a8e60b8204d8db, 0x7e884ebae2eecf49, 0xdb479ba5003a97d4, 0x5e7c6c53dba091dd, 0x2acfdccbf12188de, 0x166f6bc08f14cebc, 0x98dce69965e54eed, 0x63894a9825e6004a
+, 0x578990646dd3e13c, 0x6caa6f776457d2fa, 0xd6ab617bf32076d8, 0x182ab1dfa3cc06d6, 0x72354e5a50fce15f, 0x3198a632d4aad9ac, 0x4740c0955a04b919, 0x62ab7ba5f7469fde, 0x4260fe12beafcc3b, 0x69872d2e211a626f, 0xc7c735459a57783a, 0x489ef0a5affa34ef
+, 0xfa27576d7b160583, 0x16d057d09aee9210, 0x01ef0366907a5e08, 0x24d3bf5853b966d8, 0xaceb24987fe468a8, 0x35384afbcb40eabd, 0xe2006a9a18d25fef, 0x00d73a72440ffb79, 0x4d593d7942ccc717, 0x1d6131ee4fc662ed, 0x914605ba7b333d47, 0x4b2782fb871df49b
+, 0x1a8ed0694d0663df, 0x3a0d7ccd2f584133, 0xc94be7c267503de4, 0x7a655c5f8b87f379, 0xde67d1d089187cda, 0x3042d4e48a9aeb37, 0x02cc120e4847c866, 0x5c7958558f02de90, 0x0f1690b66e89a405, 0x61a9e90d527c9244, 0x37a3e838c0cd64fc, 0x1f4923956071e68d
+, 0xd1f60d04b408903b, 0x73589cb97fd496a2, 0xc11aff08a654ceae, 0x27b96a737e5e40a8, 0x86111294094029ca, 0x542d86ea5ec0b2d5, 0x997be45ff65e86c3, 0x68345035894e73e7, 0x07709d3bc8969152, 0x0d367069a4c7a226, 0x76d31e447cbc33c0, 0x7a94bb2bf35a978c
+, 0x8815086fc8c1fb30, 0x2bec59fa2c5b295f, 0x1601744708fd515e, 0x1769eb1790ac3137, 0xe42ff34340033946, 0x4128a455c9eb8ede, 0xf6364bb64c38f19b, 0x5d6f1fb3ba6013e1, 0xb037fea36b2cbcca, 0x4b99a52e2fbb25fc, 0xba7b2b5312ebd668, 0x16c1f8e0f55ba847
+, 0x9c68bc0d868a2408, 0x1a983a33570a16a4, 0x363fe723bb4e07b2, 0x51b0eaf54d87160e, 0xf310e29969b4f8f7, 0x63dc65f9e3a91009, 0xab80a069a95f4cc4, 0x19dd435bf032179d, 0x8932c2bdb73a29ed, 0x1d150f7f4ce550a5, 0xefa8b66b0bfa5222, 0x049b107849be392e
+, 0xb5c1d7fc0b450081, 0x0a4103736b914201, 0xa29738b6928e2d03, 0x4b6ccf32c31b6300, 0x7180e24037059302, 0x7ddae88f55313c08, 0xd76b84696b6fec6e, 0x6cb9315d4a311158, 0x9beb6e8b68df2bad, 0x26c68e070392bb7e, 0x3600b176845717d5, 0x4a9fd115b9773322
+, 0x7b9b482100a3636e, 0x4df2dd319d2ed9e2, 0x1039b58fd924e474, 0x054c8cb4c33895ca, 0x4ae49ee82e370876, 0x72ecf4a20fcc5ca4, 0xc542425a7be62885, 0x1686bf4c34aa4a54, 0x1a500c80e393828a, 0x3b2d1f65ad9fac96, 0x2968119d9e1fb34b, 0x58ca51ca77eabf55
+, 0xcea0c8ef1538f813, 0x45810f63da7c35d3, 0x593743fc703065bd, 0x6e8e81f17934f957, 0xbdf02b0200315aa4, 0x2df7eb195cf7fabf, 0x3e44627a41cb16b6, 0x2c93d09608c47d1f, 0x669102fefbb52e9c, 0x26bceb8174f3f42e, 0x201e85643263bd2f, 0x1b00faed7709ebd4
+, 0x3c6d8bdec091b8bb, 0x2faf6ba0a703f9ac, 0x75b58536e3fe208d, 0x35078cf287f57d22, 0x66f4451cd4fb09ad, 0x71125be6b2bd3d0c, 0x8cc527c2acdb1fd1, 0x7195855ce45e0866, 0x3826cd832d47e2bb, 0x0d9663a4386931ba, 0x2e362ee89137600c, 0x3443fda9a521a3fc
+, 0xbc45630b49c834d6, 0x28cad310d0bfbe4f, 0x08dfa5cebb70dd0d, 0x75778c3edfd5e22f, 0x1449acaf0a42c841, 0x3b4954df3f8e11bf, 0x21360fb117bf3860, 0x51796da571bc4e28, 0xc3a399e032d56d4f, 0x5231de11cc6daa14, 0x2798c7dc7bcfb83b, 0x0dba616d816d996c
+, 0x9292838b26ee1f90, 0x18da95bd917c691b, 0xc7052babba2e252e, 0x559bfef58221b26b, 0x0a2e0b936add60dc, 0x54dc9e374b827364, 0xa3abc5bfd0952bcf, 0x234f949d79115b22, 0xa08fb489de2e2998, 0x30273356e9a4785d, 0x940f74d39d7f2aac, 0x77429b0bcedc17c4
+, 0x13d6c774c7edd7e2, 0x6211c6ee2bb57b0f, 0x2017e4b01a32af96, 0x1d58a35e1a30d6cc, 0x74395f7d2f09a50e, 0x370d3557d2cca6ef, 0x09b85c9a407173c6, 0x69f2ecf6cb496a7a, 0xdbb39fbf739af49e, 0x1f23f4207f4de221, 0xaca8a04a99af15b1, 0x3bf03cd3ff657fff
+, 0x065a76624c5d6226, 0x612d136b928050d9, 0x293131eb9ee4da86, 0x27f7a98ca1aa6010, 0xe6ac3547b4602b4f, 0x2b3693cdda0ae3c1, 0xc019dc4a17ba91bf, 0x099cf8771a9cac6a, 0x8fdd5d763f18de85, 0x2b5a49641577d91c, 0x432669cd95fe0b96, 0x2d15327b6bc33db4
+, 0x80ec6eadca735ea8, 0x2f4e0b432b9e6914, 0x57f098f0df63f807, 0x117558a91871e276, 0xb3c7ddc15e771e79, 0x2a0baca5706656ab, 0xcdff917658fd167f, 0x037d7f1066779098, 0x3e82c4424829d026, 0x6fe8a6fd038fa1cd, 0x57ec9dc30a8944b6, 0x25420ba39aa0a271
+, 0xbe9caacc007c385b, 0x4cc2b0d1db42e0b9, 0x4d121faf4c80770e, 0x2e2f2ac32c5a3748, 0xe7ea779e336ee795, 0x254bd3fc96c9ce0b, 0xdc66b21dceada3df, 0x4ef799b339844432, 0xea8da0954c0c0349, 0x4aba1a8803d73b05, 0x570650625ccd4b31, 0x419b397a5e1eba91
+, 0x74bc34dd5c4c6979, 0x4803c67fe1c12d70, 0x208f10a147545969, 0x3ebf676e1c0c6e97, 0x7a6c5a8e5150a7fb, 0x610c00ee2ba37942, 0x33302c5bbc9e2c27, 0x633791c598945492, 0x417bb3b6b5891d6a, 0x15374df26253d948, 0xe0d1f21e8a8b1661, 0x1b66d25018bd9bcf
+, 0xfc2da3638c27c41f, 0x7b1688656e7cf799, 0x20ca1e6a9bfd8b20, 0x179786d230f73948, 0x3753387ccfc395b9, 0x2b3f368dad366011, 0x5c63011b205c8876, 0x3a9252aaad690859, 0xc7a5f9adbd894955, 0x6147e6446755d2e1, 0x92790ec846027037, 0x0d81b5c409f232d2
+, 0xe4fb10e6f074a6b0, 0x4bbaf0778a9e4535, 0x071b7b0c641f50d9, 0x4746720a9f8c59ee, 0xa8500133fda6f7ee, 0x484a6c0acd45397f, 0xab76ca7c1f7c721f, 0x553a76af41180e18, 0x952d9ac38568c6c7, 0x548d83cbbc590369, 0xceb272439fef7c53, 0x08b135367ad0df6c
+, 0xf5f304edab6b6643, 0x5ce4401ae2e6fd8e, 0x50e4f0d627240159, 0x0bcd079236734c55, 0x6df2635c4aad4d7f, 0x019ceedbc3ac71f0, 0xa6ed8d96639a7699, 0x570b3812e0320683, 0x0976eb9a548580d8, 0x12bdf18309b1d884, 0x8eca8f53edecfba6, 0x06b1ca5d963cdaf1
+, 0xa36e1b4d01a2e1e7, 0x229f8f9adbb849bc, 0x554f9a6c52b1c6d6, 0x3fdd642d63005be0, 0x80ea290d738f2619, 0x1a6af88d505e5693, 0x18006752009bc182, 0x18aecd6e9101f4d2, 0x0f7a1246823ba8a8, 0x778998166a8e7702, 0xb71a2feae1936a5e, 0x625272a8532a42e9
+, 0x92d5fb59152f8f7a, 0x62cbf63ab8f099f2, 0x8ed2bd7997580848, 0x4edcd6873b776158, 0xb4eb955e2f768744, 0x2599dd22bca040ff, 0xdb66c5cb9adc2556, 0x657a393882880050, 0x5e01b2099296e19c, 0x5205bea7de566b3d, 0xddc9ea6344e48141, 0x5dd4d24574810a54
+, 0x5cdc165b1ed1f38b, 0x37a8ea85c7cae5cf, 0xcede0a47dd667692, 0x73962e0b62d21da9, 0x757a9c59f6c92ae4, 0x1065596f38f0c029, 0xaff610fe630e7e0c, 0x12372de08ea541ee, 0xed487e0874c95357, 0x1b2dea30ddff1fef, 0xe6ef3b353bcb1c9b, 0x10561f34a9157f33
+, 0x275b3865044cc16b, 0x50d8fb0375080232, 0x7dab92fd8c7dfb2e, 0x1f18e0abd5d99d4b, 0xa0314cae5bf63f84, 0x55e451c18ed93ef8, 0x4b5ff8a53678e5c0, 0x7de614dd816a6393, 0x0715f4528ed429ac, 0x5bd2144827dbe02f, 0x8c3a64e70e5af99e, 0x185a9b5fe6039d05
+, 0xc8d51a7faa1b5e71, 0x22e6b336470bbe67, 0x511af9f3ffe816c4, 0x75d442cd31785f98, 0xbc763c2b6ddfc363, 0x5e187f2f055e5740, 0x9ba62b827b02e40f, 0x2da8527b0e5efa24, 0x37da3da359042939, 0x073588036b98eab5, 0xfe96a465fe6f0d7c, 0x74a6a7665f677171
+, 0x501cc334377cd195, 0x64c1ea26bf948526, 0xd7c31c8edbad7d1a, 0x7bda40160096bae8, 0x4d11a9969010984b, 0x45b78689fcfd81dd, 0x8d3f9a1f79083259, 0x0de3a239eb97e1ef, 0x8b66b692c42f8f69, 0x12be4e287a20b477, 0x962bfbe129ded8eb, 0x484d4bd4cf432da3
+, 0x62caa3b615bd5500, 0x5838f817affd2b8f, 0xee48d50c27ed79d8, 0x2d885a55446cc29d, 0x43f48afcb1223400, 0x2fc598e94b4e143f, 0xc017d848c34ad84d, 0x298869754682434b, 0x694969d90f3d09f0, 0x62fd4ffd936f3d38, 0xb7336048191cf3d9, 0x589b33cf0654d4f3
+, 0x4e628d59932cdabb, 0x190df0f9aba54e93, 0xbf5ded3ea9cc5a30, 0x375a5d545a89e7e2, 0x8582b7b7b4cad64d, 0x3392c6f648715d4e, 0x07eeed7a3547f5df, 0x66163b74c4949982, 0xb42af74c9fecf525, 0x00b4919d9029bb7a, 0x9869f9fc48db24d0, 0x40e399012e6179be
+, 0x58fd5e1c12b95088, 0x2c810319643e117f, 0x3d7b92b255035abf, 0x3ad6b64ff1e5c6e1, 0x5ff31b1e9581738a, 0x09e1ef079dde28a7, 0xea27614c57f7da0c, 0x3a84554032b64ea6, 0x1c4aa0a913a3d406, 0x32781f4ac7e6b814, 0xf3ac6dfce8807dea, 0x406f4eb2bef90e3a
+, 0x6593d118cbe14e28, 0x68396f99baafb968, 0xc288c4046f66bb24, 0x453ebef77e9437ae, 0xe7d36de535b303c5, 0x70081568a3606a43, 0x4bcb068e3728780d, 0x2ec8f35bffcde58b, 0xabebd3ee74f16b4a, 0x15da04131ee0d580, 0xb5ba122eac7a791d, 0x708fb5073157f72e
+, 0xde5d1a25dca1c636, 0x728054bf3eccb919, 0xa0af64e5410d70b9, 0x7ce61c781301fcfd, 0x91a39eb8304052ea, 0x70f37473cf3caa62, 0xd88a44e78ed23c41, 0x5663a84edb8b1e55, 0x883f2aef9438b58d, 0x78e394ea2c7e9ffb, 0x8ab78a8b8b2936ec, 0x637d5fc5b444f51f
+, 0xeea2933b7be6ca07, 0x143a2d190c90b11c, 0x0a0a33306b808561, 0x755f280b3894bd7e, 0x44e7b0f52678cc7f, 0x4408fe9b46e2da9a, 0xcaf7b25e2ac1d6e1, 0x01b03bf371ee6036, 0x53ebc244ad6d0e53, 0x074c62c8e96fe5ac, 0xf9b763e90bc6d2ef, 0x5600a6a67d770a46
+, 0x888c25d0f4d58c6f, 0x596a1268d4a67460, 0xb397082166fbc546, 0x02b8704185916a5a, 0xba0e5ba4ebabd6c2, 0x1cca64a767ebb32b, 0x09f26d93720b7930, 0x550d42cf30a9fc9e, 0xdddbfc4034f51c9b, 0x271ddec89edc6ac1, 0x59d8bec17673fe23, 0x1b2241d3288a8084
+, 0xd2d011eb87a4ff80, 0x40d0c230e6b501af, 0x3d325b5d4687954d, 0x186a4b8f554aacc7, 0x1390f6d3472dc79b, 0x6baa4242b0062c4b, 0x243457560ed0b91f, 0x10e59e21b1a67da3, 0x6a5e374767092b14, 0x5b2881ab2d1c87ae, 0x8948b49f5c6bdf50, 0x17e8197ff9b1f515
+, 0xeccc18d4076b4869, 0x32652ff7a85a83fb, 0xbef099d942f8befc, 0x65b05f960c08eeeb, 0x3cda4f4a96363289, 0x66bf6783145c5315, 0x1980742d6b36e44b, 0x3f1772e92b6c4fbb, 0x1e87098c43fab3aa, 0x758ff3e9cc4502a2, 0xa3762b5b922f3eda, 0x224166615f0d279f
+, 0xf1d8880ce418f37a, 0x28b204c9e1e36fbc, 0xe65e7372882ca654, 0x5e91aa231298d269, 0x1193a3df10856499, 0x209bf40b614b2eb2, 0xc537b11770e8e715, 0x1ae3d47c960f9cab, 0xaf23a92eaac486b3, 0x3f25018c6857504c, 0x187a4e23921fc6d8, 0x4c5b204b032cf764
+, 0x080c080acd004f2d, 0x7d787f055ae8a541, 0xee4d12f4e5878b0b, 0x35f2be4818176694, 0x03891891310b39b3, 0x174d1c7d259aef73, 0x643f2d20ed1cee56, 0x1b0428c1a0cd7e53, 0x2916be392b45d688, 0x4f0f730732fed5ba, 0xae72868ca12bca53, 0x1a66063b35cc2082
+, 0x91db9c722bf8ccc5, 0x0824ec94ddb49a8c, 0x57acc1dcca686efd, 0x16444b8b8d1458a1, 0x5c5a4268b0f863fc, 0x77f960b5808d9e33, 0x782dae814bb6ffdd, 0x16a81a5af4da7186, 0xa14e0514d971f0a7, 0x583f669d71ca516f, 0x2b02a0a2f938ce65, 0x39bfedd6c5da2d25
+, 0x0c7e804178c6f2e8, 0x3a27ae2e9eb9f845, 0x66ca28d1a4d4ec44, 0x3438fe5e6383839b, 0x9aec3f785a82911e, 0x3abf3627b9557abc, 0x9b9189f293916666, 0x2203a8da6e196ad1, 0x88703078571bb04f, 0x00ebedef00d9b90f, 0x9e072c6adc21a079, 0x23662077283dbc59
+, 0xc386e1388bfd436d, 0x4e79fdba412235b8, 0x47246dfca5710eed, 0x0f6d48d01cdef4b8, 0xe1dc932eab4d5909, 0x5e4b843acb9bca92, 0x01174f083bbec9f5, 0x208ce0b9a0781c0a, 0x5e46577ffd2d9ae0, 0x4413dd16932dce79, 0xe60e7df0cecf1f72, 0x60c9775d377d0c70
+, 0x53b5978a5aa7f41f, 0x13043ae708bd7b90, 0x2bfb90453fe2ba90, 0x6d9b140518417bb5, 0xa08f5dc567a094e9, 0x4404d5db600e9d90, 0x1014038939a7e211, 0x612886cbbbb184a3, 0x8d9952a8404c073d, 0x5ccc45a63a6610a8, 0x426c2601c8c4dad3, 0x735dd19896010fb8
+, 0x0034fa920d63a717, 0x139bc3c50d923938, 0xfcd3b6315d0b70d9, 0x1996356da20f5681, 0xf95f19f4c9f275a4, 0x72ce7df9ebbc8718, 0xfb2337439451d16d, 0x4e5a294d29ba1305, 0x6f5a7d18bef59a4a, 0x586c0f2d4c0c6573, 0x52c01333899f2d9a, 0x17dca9187a3017f9
+, 0xbf82713b43cb5acd, 0x0a2f1d6da4c76d37, 0x836b81dbf80b373a, 0x00ac6ee351781461, 0x715c46a438b00eb4, 0x1ef0b0626757bbc2, 0x2e627a413f5f00f8, 0x131c88fe9d3a50ce, 0x69ad70feced20e40, 0x4cdad04a306b5239, 0xb64084930b3b03db, 0x18b05264d3359076
+, 0xc05cec33d08e7b12, 0x065bc8d22b5a19b4, 0xd911e0815e60a3bb, 0x067f60060aa090d2, 0xe248c10048061687, 0x602d47cc80c292a3, 0x07e108702f10e883, 0x304e15317c39c663, 0x1587c6e3dd70f6f5, 0x56100ac184a32025, 0xb0fd17fdc20479a6, 0x6a3e80f51412f71e
+, 0x8b6a5078e525fcba, 0x7fa100df19cbb7a1, 0x7d6d1a70cd21613c, 0x6125af2af8d6130b, 0xd98ac271d92f52dc, 0x061be63ea2fcbe03, 0xd3a0c7e914e7f64d, 0x24d9a6f88403b7aa, 0x52572d7ab774aba5, 0x205e8a4060465296, 0x0747bd08d0de52b3, 0x4b8d7ba0cd402873
+, 0xaaa30d08bf90a13c, 0x2d797a37f3b72ae4, 0x0b89c14b5ee8a1e3, 0x6eb4141202eaeb48, 0xff4cb7d9b326f86b, 0x501a0a85d1c5bc5b, 0xa01afcdeeeb74533, 0x413875ea0ce35953, 0xca86455da35201d8, 0x10dc64f327fdd961, 0xe9643e7e51024f9c, 0x050be148d0d049d4
+, 0x0bbe4938cb770572, 0x7c683121f7b1a926, 0xb12cdf0576839dd8, 0x4053805dbb1b22d5, 0x54fbece70db71272, 0x3e04ab1f34aa11ed, 0x20de271e1819b9f0, 0x135983cfdc4a9fde, 0xf50d18579a6eb163, 0x1939c4c301e2d2ea, 0x8320d8c270659da4, 0x6028e0ead2e74bb8
+, 0x278cdde7c3080419, 0x361534cd6215d36c, 0xca9283c73054d61e, 0x1392c8614d5a7e3c, 0xaa773f7c6eddf11c, 0x5aff24f2e9be942e, 0xf17d30f4b79e0b54, 0x027448e42a999b1d, 0xd075bf30e4dfa5a4, 0x07a6c69917c5dc7e, 0x1e2fd9d84288a6e7, 0x032c8b835ca5b0f1
+, 0x32debff47fc1751a, 0x59f0e7f8cd6da20f, 0x7240c608265e7859, 0x458031d99d0e782c, 0xad3ed7c81478d26e, 0x48513ddaef2f9bc1, 0xa69a96095ffa912d, 0x3f1261153e1339a3, 0x2f6b45d5a0e32221, 0x3e63ec000d27dc9c, 0x2e07f512f1e17a6c, 0x226c67435e489f69
+, 0xa1a53f072bbc7b84, 0x2be024b4693209b3, 0x205321490a24b8ab, 0x5b44409e02461f52, 0x09dd3c0951fbc359, 0x3581f2fb50663376, 0x7124fe803cedb0f3, 0x220e0df58779f678, 0x71b84288e18e8a3f, 0x766f53c917ea1c09, 0xdcfb8262e9589739, 0x28a6633df94a9eb4
+, 0xaad45f707f573661, 0x3e99f885fbd83d0c, 0x40151a44ad0ec8d2, 0x75bf61f0058ae907, 0x7656f18c4d7ad4ad, 0x131b2bb21189d3ba, 0xaa54b4db35ff73ca, 0x440a626898b6f631, 0x0c9e480ac5f5c7b5, 0x5e4644d1961a3602, 0x7688d6287edb41d3, 0x0b3152c72aba57bb
+, 0x7d0c29f8b189a9bb, 0x008a0f147e7b55b7, 0x4ae967f392e7ea15, 0x11a6575beed1bd64, 0xa286bd9e902e83e5, 0x188400469eb687a7, 0x8947ab609bd42022, 0x569191715d7e4d75, 0x92d0b0467f6ad821, 0x3d6142e1fb2aadd0, 0xe834b802dbc1b3fa, 0x608108b3e0662dfd
+, 0x7e55276fcd9c7bf8, 0x3b2042e6c68d3f07, 0x6181a29f959d35d3, 0x64c51e351fa72976, 0x28c3d98dabf4d1ef, 0x2080b53b871fcec6, 0x633fdf2bf9d17880, 0x28dc91469f55cb7c, 0x1e882b950de856f8, 0x612052a8f688caa9, 0x64f89fdc93d352e3, 0x6b2cb657ba3f93a8
+, 0x2e9e37478ff86682, 0x48aa40c16af1e821, 0x512bf2da9aeee5d1, 0x7788c5c88b2777ce, 0x5549792d13fefead, 0x5c1d2a84385ddd85, 0x23821edb0f520129, 0x48a05469ca09e433, 0xa1ffcce40ce45b3a, 0x25ee6faa9bf528e9, 0x064af0d808221d97, 0x28fd5e1aeb71f7a2
+, 0x5b54b370df61335b, 0x6e93ef870fe84523, 0xed2de0f9333cb045, 0x31ba28d79ae3ffac, 0x6d8fa1c9cb499b23, 0x748eda076527dedb, 0x7465038b47eb35a3, 0x613016bf7cf0e576, 0x1b08a6f84c276b0e, 0x520e8b69ee684cca, 0x342ff48361157658, 0x22e396fb4db537af
+, 0x75a31c3020b764cc, 0x06a1ac762b2a4d91, 0x12793a8eaa9ecec9, 0x207fc066b0b29828, 0x280a443ce3bdfe6d, 0x6d63d140efdfab93, 0x1742b28cc024f1bb, 0x7632d6336ab4d0e3, 0xcacf2860fdd7a07f, 0x20b6dc6d1d732d15, 0xad4db0eff256a148, 0x4110e10b2d598163
+, 0x322a177813dcee89, 0x38c87f39f9563a84, 0xdd86b7dfe3a777a3, 0x2c0c67049c45d9e4, 0xd7e5fe478b3d5fcc, 0x7b7cc4d347231236, 0x5f723a1e22712c80, 0x1d34236c45f8d3c5, 0xd8d9139a3440cf1d, 0x74fb21538540a7c9, 0xbbd1bfcde9d21e42, 0x4f840877af5a59dc
+, 0x8406280988427e74, 0x4d0fc6e891534f89, 0x936bd38ad1f74f77, 0x77cb8c58fd9887d0, 0xf4840aac459febaf, 0x022429e4dcc707e2, 0xcca57a86bba60e2e, 0x321dbc100fc9f4aa, 0x33f458bd6245ba4b, 0x575f674530fdd917, 0x43e40bd3e680ee2e, 0x5bf0df949536b658
+, 0x13fa668641d3d702, 0x6ff912332a1b3439, 0x166e0c2c073afd38, 0x25d38b1d56455805, 0x8049326622da307d, 0x08cf60f65da9e551, 0x9a3f23d359118158, 0x6dd0e395ae6724f0, 0x61fa5b954708a437, 0x3c18feb80d03f7c7, 0x0b5b6d453e563ec4, 0x111c004c0ce88a59
+, 0x9285d536191a8591, 0x34c148d23ce800da, 0x60900fccf460e7f1, 0x7e217dc37877e1ea, 0xdeb13fb918a4b930, 0x12156ff828b580d4, 0xbf1caae116aae7ca, 0x39b62a66a4ba62ed, 0xde8f429cfc482d08, 0x20aa0384eff996e4, 0x731becdeaaac0235, 0x66609d8ab7269966
+, 0xf34ccbfd076c1bf2, 0x1b5d5159f1d61407, 0x239795efe1cccde1, 0x23b5d085b3cc5a56, 0x68b998e62eb72a69, 0x2d1dd75be9a7ba95, 0xa67ebe78ff6291f1, 0x0bab38044bed9576, 0xcd29702170481868, 0x2b6f0bf7d413555f, 0xfe71ba2ea0bd0637, 0x3c3aa084acebda39
+, 0xcb388d1963139e36, 0x67288119cd91fe60, 0xbafcf9283a9684ee, 0x06121376ba13d0c6, 0x2f9a8d02dc017ee2, 0x6d0e8f685c626534, 0xe52ae4fd0e10197b, 0x44c0deab70258356, 0x23ed8ab3a69834cd, 0x587e317e37337074, 0xbbcee454d646e191, 0x338deef2e6c90407
+, 0x9380385aca26b0ea, 0x3b342399af2be3ad, 0x4116955026ad259e, 0x14abdcdfc7f2fe3d, 0x2cb54acb976540d9, 0x743d000664a0c38b, 0xd8b18c503b8b8bc5, 0x706b03de4739c75d, 0x368ab112a5f00627, 0x6b00cae37563c6ca, 0xace8044fbf1bbd0b, 0x10b0577c0b15566a
+, 0x05b5623600d19d01, 0x79eab10d8cef3eb9, 0x390291ec68f8a0cf, 0x36282fcc7f95474b, 0xa92c6c7ba69b92bd, 0x46c73370088d4a9a, 0xbb6e7c165b271664, 0x6e29f9f3a19f38e2, 0x90c6dd391bb7ef23, 0x3167ffc030286fb1, 0x497c5a3fca7344c1, 0x395e8128a163ce21
+, 0x1ec7a82ac51297fa, 0x7b1c6df1f211dcf9, 0xa3da4eb0511126da, 0x235f25d292ba286f, 0x8e2a65416e716261, 0x6e4d079fe4f0ce0a, 0x9dc7bb4782efef74, 0x06a69ddd03489584, 0x6e16ad8308ebd558, 0x78d80ea834e57dca, 0x4b9c044ce975cb3f, 0x7c252998ff0a841c
+, 0xf238c25376de5d4c, 0x4577261cf9668bd5, 0xf143c0eac073ca71, 0x0dca6f6315d9071e, 0xe8c85e372965382e, 0x4f1316b40f8e1876, 0x6545b3fb1fa1c177, 0x06db2e06f657f12e, 0x2afc8df92222bc86, 0x338339b23050bf96, 0xe1120d83ab3387ab, 0x6309fce277e8c6d6
+, 0x608e4c28f0e9169e, 0x1aed859d6a5b7de1, 0x51a7179e108811d5, 0x257bbf2f714cb920, 0x21173cb36d769703, 0x44ce506754c27ba3, 0x22f4f823507ed188, 0x397978c7e7b5b50b, 0x44e57afccc7c01a8, 0x0bad9913b62892e7, 0x938f97ede319fe7b, 0x5d497db3e724ed30
+, 0xf643962d19365785, 0x3781b79b506a6d11, 0xdfe6a52f66f4fb7e, 0x70f3456ea426ce70, 0x28c18e8dd718bcb8, 0x5f487104b0e7e97f, 0xc8b08332607de917, 0x3e0a26fd1172944d, 0x121f6bab824843ed, 0x3faf7889fb191fa0, 0x2cdebaf053c3ba39, 0x61533848df6bc78d
+, 0x023779f0cb46ba1e, 0x05fe283779ff1de8, 0x4e4648a992417cbc, 0x260aa7955ad3388a, 0x44099272ed96c560, 0x76feec378be4fd21, 0xe99b850661e1cd5c, 0x442db79f3c6cf6b5, 0xd85ef7fdebfa0069, 0x1599668b514f368a, 0x0e2db246ec26cb53, 0x5b47d1fff80e0e81
+, 0x3c2082bb1a430e86, 0x5c4859cf9309bcd9, 0xc2cbc379dd8b64b3, 0x21700403e1bf9350, 0x4b796ca106b8588e, 0x3325a7ba3dde4f7c, 0x08ea59da9edbec48, 0x085f57cd89c0b694, 0x3c6b3ecaa06016f8, 0x16fc154b0fd6b7f5, 0x7c53b19b9c112b5f, 0x43ea4fd9e4183de3
+, 0x6ac1fc9098583f8a, 0x4812905fe02813be, 0x707557dca4ddc887, 0x500bd3d92943f686, 0x96fd7cc9ca8ea98e, 0x4cfe52a3920376e3, 0x7a8f2e954d103f64, 0x79980e66945b1937, 0x8a3200d0a77a748c, 0x1dfc648546d2c811, 0xe8ffbf7c109e4e1c, 0x443de532b79f90f7
+, 0xd483cb3ef566dc03, 0x7fc6fadc34a2bb0c, 0x700409adb2c1d5fd, 0x7c4815505f5e1c7b, 0xcf02aca6f495b2f4, 0x1b6ae87e0287ac98, 0x7e584f47b8f86260, 0x238af5bda6140477, 0xe07bdac316782c25, 0x1bcd95a1a48573c2, 0xac0f8409b9d2d217, 0x1ea5945df9cfccc9
+, 0x0f55bb0a32651fbd, 0x395b50465cfd11f1, 0x83d338b252717424, 0x64110601915439b1, 0x2dce38a2244eaf3b, 0x47731ba936c4f825, 0x3e914b1632ef1b93, 0x791d7bda39a74b41, 0xd88b062c52d3ebf1, 0x409bc1494372a5fc, 0x53b580a5401d5df7, 0x2e87421ff06afcef
+, 0x59e27e32520d42ba, 0x1daefac73897f64e, 0x3cfff2abe1412f37, 0x320c25fc3563c762, 0x616d66f091e666aa, 0x1910602d43668edf, 0xdbb6ac6d9141575d, 0x14123d9208624366, 0x078d119b3ce90130, 0x4db762fb3fd46e09, 0xa824ad9ceda71e14, 0x23ce23f5aa7b1ff5
+, 0xfbd303410c19b8ea, 0x417f7b9afa29da49, 0x12e34ac75bc709f5, 0x58b53ebb65f7e6ae, 0x6f9a0aa4a85f53b1, 0x7f1e648e5cfea938, 0x88487c383e8d4bd9, 0x1d3985222c272e93, 0x8955ac99257a6bd7, 0x6fc525afc450fba0, 0x419b0d06ed9adedc, 0x71a0c35bf0642113
+, 0xc1cc19bea665dc3b, 0x021a851e621eb2a9, 0x694f1679d082fb91, 0x24548efad57bd424, 0xa8cb9cad02d721a7, 0x14956726a85ba772, 0x1d9faecd24a2aaf9, 0x3c3c77a8eb7f15f4, 0x126275b710b34a5e, 0x4b255c9d8055c05a, 0xcf5a0f2d0439e2f5, 0x2dfc4344ae06546d
+, 0x852aace7fdc3f1d4, 0x4f356e3fbe767c17, 0x9b8431553e4a9232, 0x3c179e63f791987d, 0x2e3fe9594f5e2261, 0x7bb7344e85691786, 0x07871cb5a2879510, 0x19b74e2c788e6c29, 0xb96437bf2963645e, 0x1da350467918fc97, 0x9012c5be10ec5b72, 0x02af1f48cfede282
+, 0xb1994c80c1d70c47, 0x3274e24e782d1f66, 0xe035273ef1e14d2d, 0x1d2aa96e1bf56ea2, 0xd13f327daaf4c9e9, 0x71cb732c5a74d51e, 0x9f7e548da5cf93b6, 0x616bf4208f0a3236, 0x07c159fc23100092, 0x7243f1efe53f8962, 0xb83856e688594b65, 0x6da8bd5185dd91e8
+, 0xb61c33e407ff7dc1, 0x70f4396a6bbc473a, 0xaafa900e0cca3fb9, 0x45a8981955a25c14, 0xc5c846ed51847071, 0x49d38d128551ab3b, 0x41e649113a3f4936, 0x56f1c89f525f8b22, 0xfbd1a83c19c2b246, 0x2077b3e5b94ddbf9, 0x76c1ec023724c603, 0x55c2d1b20d72a2e6
+, 0xbf9f681104c5bb2a, 0x7c35174ea6f2619a, 0x03f8e33595efd613, 0x762353bec063fcf9, 0x47f50c4d9ae435d3, 0x6f8d84221e52fae9, 0x05d3ffc0f24d86d2, 0x378aedd988d579eb, 0xbaf33053825f5cb8, 0x4d3b88eba7cf4e42, 0x8f985b67884c474b, 0x3247782a586dbe07
+, 0x8237f3002fbebbc4, 0x02f2bf829c5665fb, 0x06fd7859a4e58bda, 0x2f7a6b9a362d1731, 0x6958a9c4aa745b63, 0x40dda6233223d3b1, 0x570f24af36a1f860, 0x34c0afeabae7d9fb, 0x9e2b39295c8f2ca3, 0x657e9002b8dd08d9, 0xf43a890ab442c32b, 0x40786794f4063bf0
+, 0x468e338db9f7bd7c, 0x4546ff10636e6013, 0x069e29294f364a36, 0x2eaeef750c1538cf, 0x5717a06985ffa6f9, 0x26e4a8b6c9e90bfb, 0x8ca5e41f4c389ab4, 0x02dbcfe223b08577, 0x1ee660e1faa61ba5, 0x087a4b28017e07cb, 0x5eb73f4492399a58, 0x7a64db21f9e5e6bb
+, 0x4cdd7958ca086d69, 0x061a86892794bee0, 0x090a9cc016e9f571, 0x678c40e987822bf0, 0xb44fc38d247e323f, 0x179b55008bd9b253, 0xea1226c57acd752d, 0x6f7a711cb802b502, 0x3d69c5ab265e332d, 0x566c74a988eb2b9c, 0x1f2d0a5d3b324b4a, 0x12a42e61dbbb8c2c
+, 0xff953d99ce5d4c21, 0x035f7db19b36e163, 0x8767cb37583ea350, 0x2754058c0eaaad2c, 0x3af2fcb3e30b9e82, 0x189b4ac9bb54855c, 0x7f7e1d4ab79caa2b, 0x6512bf846bfb81eb, 0x6b5e576a5627ec06, 0x3c9d5a79933946c5, 0x34c0ac9a90ca0fe0, 0x008468ac94f11b5e
+, 0x447c6d5bfc6d6c28, 0x3acefe0ee348e56a, 0x53acf7e8401fecf5, 0x6432943e9f8de4b2, 0x18e3d4d4e2105c80, 0x2d44ccc4720cc012, 0x848ca0c0776da155, 0x22ac22c03022f16e, 0xbee612723d11abbb, 0x67b6ceb1f42715be, 0x3ba3bd757aba3ba8, 0x4bee5739162704ab
+, 0x4812f80eb796ffa5, 0x1a58912591ec6f7b, 0x88c38522e3000a78, 0x11a11e6b20f68cdb, 0x718df0c8e2dc6bb7, 0x6a68d2dfd8bb7ffd, 0xf3b903dc97b7fa1f, 0x135b1106bbf5d0ac, 0x735ad475704b8d0b, 0x60e0b031275895df, 0xad0dd7a4cb19694b, 0x6264c318d28922ef
+, 0xfcd1f4e2ed393ba7, 0x5fbb0467283a9506, 0xc1962e541eaba963, 0x2beb2be9017c3ba5, 0x4818e261fa047bdb, 0x26a1be59d6dec377, 0x0b8c67dfaf958e4a, 0x17b8dd1a051bb89a, 0xdb57950134f62007, 0x50b223a5d8385c24, 0x7a870aecda963e2d, 0x296c88fdeacaa799
+, 0x8a086664fe16b6cb, 0x76a88ed70cdf3e5d, 0x8e3d110d6c368982, 0x6e917858df62b949, 0x909b9a6c7fb4b913, 0x2bf04814bce1c553, 0x920400889c2689b6, 0x0da1920895cb85eb, 0xb069745617e2358d, 0x05e96aea5e7b6d54, 0x72a0c69c35a31549, 0x7112b45c2084ba6d
+, 0x67f5445c11ee33c8, 0x4253ec816fa6a4ff, 0xb26bd673ef7d4cf1, 0x0b7d702ca7bcba0c, 0xb5aa5f25f319986e, 0x1deff72719ca0249, 0x951e99ea114c21de, 0x03ed7e890929554a, 0x568e030da337abbe, 0x5fc33cbb72e7fa7f, 0xb1e2f6e587d9f6de, 0x52bb68d18d39a989
+, 0xfb6b8c00adc04981, 0x66bfc86498cc1b3f, 0x902e14463ba467b7, 0x50eca99b14ce4dc1, 0xd3878f0773ea5740, 0x542aa65c1a59c4b6, 0xb17a136d7edc5c4f, 0x4a7a72e738397130, 0xc81bac4a79111a4e, 0x57b8af3d0b34dff8, 0x5adf676c898310eb, 0x7ed09a57ca6e6290
+, 0x5bccca912bc6334f, 0x10f5705fa0864a2b, 0xf3ddd2d53932b1d1, 0x1e26b3f0d2c492a1, 0x0c5fc71429d86c13, 0x79cbdc84f8dec870, 0xba8c63e6ccafc54e, 0x01fa0fa64f60defa, 0x25a3f71f6fa48e59, 0x1d2da7f570cb6050, 0xcaeecef087847e95, 0x2b2970295f7e8b8b
+, 0x904b843ecd138994, 0x00595010a72adbea, 0x12239bf2a1dac039, 0x32779d2624419a73, 0xff76f4b74afcc668, 0x4b2f8cc660a87cb6, 0x24b549e7aca27152, 0x206efaed02a2bcc5, 0x47de789987d0da2f, 0x7a7497f6dbebbc72, 0x19dc3aaecd58c042, 0x163a4917f83a3d0d
+, 0xd16a9cc088435351, 0x5eda52b05a012f47, 0xb6bc9635d2b726d8, 0x7b9dfdbe99d03cb5, 0x34f507650de67d87, 0x32097629f912cfed, 0x0cf4cfe6f6cb505f, 0x5d1989381ad6b0ab, 0xb6db9559dc06e2df, 0x47d43b0730d853b1, 0x3179a7645bed6c04, 0x01e1ee98a59a70cf
+, 0x25f2b52025cf7bfd, 0x489c8571466e820a, 0x0925f7af720a3712, 0x6eff5e713fb1e511, 0x87feda71dcbf4b61, 0x1896a3f26473ace9, 0xcbfad185e2d8e5ea, 0x1da88a6ba047426f, 0xc1046b01c4d6e0da, 0x1589307b27703599, 0xe40df9ddbe859402, 0x09a99e16bd50dbcf
+, 0x13654b97eced5ce4, 0x62a85d664f0fe538, 0xdc29c771f2a55159, 0x22ac8acd8d1336c0, 0x9ea4f71d9d3b0413, 0x152782e8b22fe064, 0x066b99951b51658a, 0x429e2a13f60c71f2, 0xbbbf5882f5b309a5, 0x6f58847cecff3a5c, 0xb6199e6aff78a93e, 0x6b6bfb6d92a116fa
+, 0x6699a09319a3c14f, 0x70dff172468926b5, 0xe3f75519e6930872, 0x2259b6774ef85061, 0xb6e2801fd56425c7, 0x7d00a13bd4b01e49, 0x2832d816737acdb5, 0x660914169cef3ee9, 0xc5ef0f03b0640201, 0x29fdb7ef39cb656f, 0xa2cb698d057b89ea, 0x45b2b736f67288cc
+, 0x53c9dd6f6ef35413, 0x21bb3977685d9558, 0x3b7617dbc19f30f5, 0x134d1ec2ab21edc8, 0x95daae6ed7af355d, 0x340672e4462fc249, 0xf08b612ea88956ac, 0x3ef49ebe0e3f8d6d, 0xddda31eb440cf945, 0x176088b8e52feb25, 0x8eec74361a8328f6, 0x24bcd3ca3e18e088
+, 0xdd05da4a99c616f9, 0x419d5ca9a3963f48, 0x4ea81e27afee86ef, 0x7620dd70b645f5a5, 0xb22ed52b5138bd54, 0x09d2d2bd16475540, 0x1826bfca241696c3, 0x3cbd903b1adf646e, 0xf8d78951b6a0f29b, 0x231ea926df2d360d, 0x95350db3a8768604, 0x5d0e9b09642b3368
+, 0x826a4ab3ce9cfb53, 0x54d66eb1f783bc7f, 0xc332008746e07305, 0x78f9e3b18c2b445e, 0x5807ca504cb5fc54, 0x69e5a3f1f3556aca, 0xe9e268eb6c6f64d5, 0x672501056a77d0fc, 0x7f8250307dc25eb4, 0x334120bb96a17629, 0x55bd4af9f3bc0c25, 0x03e7d55498627844
+, 0x19e4b7b3a3d0684c, 0x09300df8606d2bf9, 0x1688fe07174063c9, 0x1f998d3ce4a9a37b, 0xb87af0f8d4eb2f50, 0x2cb4cee88cb9e67d, 0x31dd2967713e6a65, 0x7fbedc62be8c024f, 0xf810998a7b70dc34, 0x76275bd51302cc51, 0x76a0817ebc83dd4f, 0x41e308983a9a0850
+, 0x209b421f480e2609, 0x3f36cce03abcb6db, 0xe9efaa94c7e346fb, 0x4879b1ae4a7620dc, 0xbd4c3232a0920894, 0x3ce681c5a2e8e063, 0x724acd272697506f, 0x7788eb5a5ba18e93, 0x78475a304ca11586, 0x224767211adf1330, 0xdd99eb0ebd806803, 0x5de8a061e7f2f1a6
+, 0x9589a7caed0aced9, 0x79fff16971515c9e, 0x5f99df21dafc640c, 0x226cde621f89fe5a, 0x47bbd15943ee30a0, 0x6c420a7f25eba93a, 0x7faaa8c24106010f, 0x34b2572caff41929, 0xfdc31f54d842bd06, 0x0c7cc3a2072d7fc1, 0xf31439230c8dcd21, 0x24ae9a0fe3913cdc
+, 0x661638889c23b96a, 0x222d0d8a523ca5e2, 0x2ba84bca17d4dd72, 0x0e349f84fb19ce03, 0x97cda26a637b270b, 0x06958771f240fd71, 0xa5daf775b3629e51, 0x3f84ac2fd091381e, 0xf96c6ba2a441a5fb, 0x7f9491620c91b87e, 0xde6565359982f706, 0x352eb96ba872db90
+, 0xf0d1f0e7c4af611e, 0x54f9cfa79bd2873e, 0x3cf13187705d7d02, 0x08a6e60b4bb148ed, 0x2f23272eb585fefa, 0x0160b341c2224daf, 0x972df5ca7014ce81, 0x667e627cabbe975d, 0x0174616f294358eb, 0x3a4c044078e732b2, 0xfcb1747698d2d1f2, 0x0d1a754fe846df50
+, 0x58fe0a94775735a1, 0x17e25b3b9b334953, 0x1de2aa8ec3aa264a, 0x5d6fd74dd66c3e46, 0xd08681955ab0a4d4, 0x2f33d37ce1f4d932, 0xbb0072fcc0248d5b, 0x72f57a0dba026544, 0x96fd9239c71a558e, 0x457dbd6c53bec337, 0xaa310f8a123302da, 0x0a6ba5a7d52b6951
+, 0xbce86ef05e663b4d, 0x79ab95e88d5a402f, 0x41c879820cf39bc2, 0x1be0cca1fd9d8bb6, 0x8537a9369e9427df, 0x182ced036faddd21, 0x3e8f6389214c17e7, 0x31020573093d30b9, 0xd37e5904e9717033, 0x2df6be876aff2dc7, 0xa0899dc0bced6467, 0x11c7f1a1c92b4e5d
+, 0x7ac11ce09f2d44c5, 0x3bf3385f8eb3241f, 0x75df56024140327f, 0x733e9f8a6e8f1511, 0x4ec8347a18a76267, 0x25825dc40090122d, 0x4173bf313ec5fed4, 0x19d132142b147ebf, 0x4b9d29e1e8d7d834, 0x6998254511df30f8, 0x80b44acc5afb0090, 0x1a368bddb915e9e0
+, 0x809c3b6fd21fe732, 0x5eb3896d321dc5f7, 0x650f2b2ab1b9e0a0, 0x2d2997014aa735a3, 0x9e16504ecfa5a528, 0x41e9c47ab9d939d0, 0xf4739cc2c6ec2ae4, 0x6c10a3c96d89d4d3, 0xedc3a0b8d319ff0a, 0x5963bae7327b170d, 0x34c39e2b11f50361, 0x499b21496921bbcb
+, 0x27bf88afadd9b378, 0x71e3eebf0aa8d2a0, 0x15dced5893cfbfa7, 0x03f8338b6cd3e5d3, 0xc0fc5c253c996f35, 0x72084f8ca4a67dd3, 0x2ca814ab0d511016, 0x6586f721b81285aa, 0x3482caf5655ed7b1, 0x53f7346b980c1708, 0x3540dd3d3ce19cf6, 0x284fabe8f94691cf
+, 0x1768957d355117d4, 0x0dbd6c6f406b9912, 0xab23a73da06ce811, 0x5831788c333512fd, 0xe61da3df0e1d372b, 0x5478fe2baffabb97, 0x2ac22b1273f2037e, 0x74cf0b28cc62f28b, 0x55695fc1b2d1e8aa, 0x482d15c3a0271684, 0x07ca4e60751a39f8, 0x3cc26fdb38016a16
+, 0x2161ced81c335311, 0x5defab9a3160229c, 0xe0d0aed186d053c6, 0x781094aac92544ac, 0x06ae78a4981b34ee, 0x1ead96f419a18661, 0x9a11db2762f301ee, 0x58a37f8e3294d436, 0xc733b0c421b306db, 0x1f23730118decd23, 0x0f79cdef380a10b6, 0x3c35466a0aa0505f
+, 0x6441ba62866891bb, 0x009b45467383cc0e, 0xd7a766132682c188, 0x64ed6c390b515627, 0x9383515d831acf3a, 0x124136b07d562e65, 0xdb638c65497f2945, 0x525b7c402f3351fc, 0x32ee061c288b30b9, 0x5beb3ca49d54f838, 0xb64be6da5bb2354c, 0x6b8e36a8f4ff165b
+, 0x44cfc999cf54a45a, 0x2e5943feefc68dab, 0xe0998fe43d66f6a0, 0x13e9516e488d96e9, 0x71f4197d5fe2c8e3, 0x5d727f0b8df6ac0e, 0x986d0d3158d21550, 0x22e1a26ea9fb1e3d, 0x84745f2d9cc2b2b4, 0x7fdc0120d7ba8803, 0x4e6d409221271252, 0x5eb5eed7bde61567
+, 0xd09e148d80fbc535, 0x398a65f541c0ca01, 0x8cb24277a25550d4, 0x59a03c53c6216c2d, 0xe33c0b9d9d95383a, 0x7508a6d642680602, 0xed1ad5b1bc8bf420, 0x7202fac88cbb959c, 0x25820396c39da0c6, 0x60ea3a5034cf454f, 0xf002d5799e5d2e64, 0x4ccdc1afa0e66844
+, 0xacffcc51a865f8b7, 0x4d6760a42ce17394, 0x9009120eb4770eda, 0x7b8c29c2b5e5456e, 0x0d281e8d2602eaf6, 0x10ebf65d0c122ccc, 0x7951356cca994c11, 0x56a0ca5bf8f976f8, 0x4c5a6977bbc43795, 0x016dfa339323b4f5, 0xa3c580f26e3e5c31, 0x222dc94e8eab8097
+, 0x99ef4b64feee4a06, 0x535475b66580f0a0, 0xb2a8cbaa9e4571b9, 0x782c67745709e04b, 0x8f9d26fc57858087, 0x173692ba9eef3ad3, 0x4a8b2c94198b813b, 0x0b85a0e2be6f87c4, 0x3efaed70b5040617, 0x526f7e37e570045a, 0xfd21816d15943c67, 0x4aae8e0faea067b8
+, 0x865327aa37176483, 0x157f68b05c29ec03, 0xa1ffcd1839f36b5f, 0x267a62bebb90a39e, 0x41e06b6854b1e02d, 0x4204464464bc1b9f, 0xf4cfbf3dd84680a8, 0x7adcc47d5771ab23, 0xdff7cea7c45aecc4, 0x39cf614979355063, 0x2403c137eb47ccaf, 0x718f852d3024665c
+, 0x413ecdda85691d17, 0x54d15c56d39ca1c3, 0x822da6d8d4c55297, 0x7c5feb9cf6f51bdb, 0x3ac11ac0d5f957c5, 0x53c062893e801fc0, 0x842a55104ef9e850, 0x7bdcd68ecf341ea1, 0x2d8ffd3bb449c212, 0x79c89fe526edf585, 0x3801f0e6f77ae4b0, 0x2367938cdd168257
+, 0x8984b4ba4efcf08d, 0x1b8df1954788aeba, 0x693a7645b57da7cc, 0x520b0eae7ee37ae1, 0x7dd34c56704f3144, 0x521074a149cadf3d, 0x930eb56cfb2466b6, 0x774ff9482c625475, 0x98d6c42ed14d8ec0, 0x4511b11ef6062628, 0x9217348b300f6376, 0x1d6219fbec22d205
+, 0x5b0d6e3cf8bde39c, 0x64397abf82e16221, 0x8a14ce605f12f908, 0x5041c20f7128daec, 0x158cbf082a326a96, 0x02dbbdfdafcec875, 0x8caa63727e12337c, 0x2e4105e09554c2c2, 0xa5cea1691c9f9ea9, 0x103d5a2a82a69b3f, 0xb883aadf194bd93a, 0x32bee082e605346d
+, 0xcc0385e0f3168dc9, 0x15554fe7eb52e5a2, 0x6da4a4cf8e304225, 0x4423c005d18c69b3, 0x7a31e1f794a3bfd7, 0x447a4646f0f42f3a, 0x835216351eecf989, 0x576dabf22d5bfa8b, 0x05d08088f196daff, 0x7b857296872d9e29, 0x8347d89215f2d273, 0x75be6014afa5d7c2
+, 0x0e8918c261ce7c21, 0x4176e639bd563cb6, 0x188a6c893376388b, 0x587a04c2153e6038, 0x852c0d7946521644, 0x0bd445f11f3662ab, 0xf39143fb8187d315, 0x7c0a24f79e828452, 0xfc178697f01031b5, 0x46c0cc1d548aa775, 0x6ed2f95e2a442ae9, 0x1281ed0336798cd2
+, 0x414ea37b6beb592f, 0x4d22ddf089d500fb, 0xd536986769c32bfb, 0x4da1e1ccf24d4f07, 0x81d1f6a671ae1e6b, 0x30827635a4b997df, 0xd486920923ed8e33, 0x65eee7272800b15e, 0xd569ee9ecec22ecd, 0x51b5a9f423882a37, 0x44ba8b3fee8ef22b, 0x4187456fdcf67cfa
+, 0x824f183589068c85, 0x3777bf851d650edf, 0x48a8c752a025b14e, 0x38982f690592c59b, 0xc6b6e14862be9ef1, 0x5b347eba40630701, 0x70d636c65313e262, 0x70fe4e4ca2876eef, 0x7659b28ddc39da26, 0x203f21d375e3460d, 0x82e5dcfd52ddf5d7, 0x76bfd6a56c1e2434
+, 0xc0537be727cf9e33, 0x0c4e5ee98b79a9a9, 0xbf41aab14d3b6378, 0x75b306b790b6a1a1, 0x441ed628e2cc3b06, 0x29d47122dd57b3b6, 0x9053e138f518323b, 0x3408c4c9cb892759, 0x544b6e4f976282f7, 0x6c4e02aaaf99028f, 0x13039caa3f616e48, 0x41815bd9fa466a47
+, 0xa5886ca4ed233094, 0x7b1773f88723690f, 0xfe205b3e1d0871c0, 0x4007b191fa907d7c, 0xe1dfe66760f49d4e, 0x7f1d15cd4a20481b, 0x493751849ef305d2, 0x0035b83d81ca4053, 0xae11bc5ccaa83893, 0x6b0c3b8b9dfa68b4, 0x1129d8b73ba819b6, 0x5b90c92d16dfc6f2
+, 0xbf4bdb72df1036ec, 0x06be264de87ece62, 0x3597a17a9019bee9, 0x25b38a6fdb85222e, 0x7c1adae23ee150c0, 0x60a7541269be291d, 0x34c68eb6a06abaf0, 0x4327afc83f80fd49, 0x85251069f89bedd4, 0x4ea9f142adc113e8, 0x6f87fbfc48cd0942, 0x1f199c2c9814aa9c
+, 0xc3def9a7ea03050b, 0x27b51b5bc8e7eba2, 0x875995dc43ae25e1, 0x03c150a1656d4142, 0xc643d9b04807f2b4, 0x0362823f9260866c, 0x3784e7ad2676dba1, 0x6b7da50045bd543e, 0xa1af007bc2257bed, 0x1086db9c6f35d864, 0x53725722b0046dd7, 0x538d645ccf993dd5
+, 0x4317eac316212b33, 0x41e16a8051b4c059, 0x05212f693578bfa7, 0x4bd1e7627c5aa97d, 0x755f7b4d648d411e, 0x48900eef2e6208dc, 0xf6c76ddfdb440243, 0x7cee530b861f3896, 0x44c2a065b0cc1f1e, 0x1ac4864431916155, 0x5eaf848d5e14d1c1, 0x5a8c31e2643d76ac
+, 0xe419c764bd404a73, 0x46f4d49a4d6ff947, 0xa419ba4d47f6cc83, 0x43257e2cae1b2c6b, 0x4a6687cb2a00be54, 0x41af9df84807d0b5, 0x18190def690f32c9, 0x237fd44217b4e23f, 0x8d37c458361c2fba, 0x2ea875fd14bcc889, 0xe68bd6f67d6dd60d, 0x05361c6fbb4df43c
+, 0xb08d15e2387237ce, 0x41a14c54b85b712d, 0x0bc7434f6e2ae5d0, 0x37366daa0d5a14b3, 0x1aa5cb7a4ffa589c, 0x3c23e68510f27198, 0x005984e22f5c03b9, 0x1868bb43ba5fcae3, 0xa45bbb7f2d282788, 0x531bf0122672f08a, 0x186b9785a57d3215, 0x23b11c61270df380
+, 0x350d88b586c01c50, 0x26b857054f358424, 0xb59354d8f8e0a679, 0x767d1f46da5d8850, 0xd7e56a91a9d405d1, 0x2c34d6c096d634ea, 0x769b36b2b1399284, 0x6a77f7166307dc73, 0x37fc7aee5300321e, 0x48f72f9b544c7c16, 0xad20d9eb1900f373, 0x06609dfcf2bcc6f1
+, 0xbcd189d272edf8f4, 0x327cb99cb5f613fa, 0xe8632be978c62ff0, 0x5beeddf6c27be360, 0x9fd8a4c07525db43, 0x1ac46ff06c4e2b7d, 0xbe6cbc0a5ed0ee1b, 0x643b02da50f0672b, 0x88d04d6b42d08f5b, 0x666406baae1f395e, 0x814e4d69c3bde376, 0x2de6a6ea99b3a60f
+, 0xe6c97257e673ccf7, 0x332fc1315bcb3fe5, 0x520c343abbb665ad, 0x73575aa24fb2b8c9, 0xee357324031f6524, 0x043698a9d9f783f4, 0xa2c8f73add3c8bd1, 0x1625413e5d776c82, 0x3d8d65471c012bc5, 0x78cea10640230d4b, 0x4e2511e8622836df, 0x30fa946935e16329
+, 0x5d01509a35b7a493, 0x3303a4e21224bbf9, 0x95a16033e4958e06, 0x37cdf3f0feaa72f8, 0xc86b61e87a09fc4d, 0x3e3c67a6d8d3405e, 0x2647281f1639f05e, 0x7c4c470ea58be03a, 0x4d34906b640884ab, 0x47d375b7fe95aadc, 0xad2071fa6077136b, 0x49c222218145577d
+, 0x54ad12aec55f23e9, 0x767f057166286eb3, 0x4b1734d44e72414b, 0x61a76931f6269edd, 0x092e007a438d132b, 0x4b5d82726a61d600, 0xc7c471c2b0841012, 0x3c88c18b2131878a, 0x449079d813db5e9f, 0x1172e94693e26b81, 0x7feef4165684c910, 0x4c126346600588a6
+, 0x18949078468b7456, 0x4d71cc86f5d1d43e, 0xe10f48bba24fd300, 0x68e9afd6a1318882, 0x795b54e8ac17bef5, 0x5bbf5a9fc283fe7f, 0x6524e9f0963817ec, 0x4c976b66daa9ccbf, 0xfd60ea8d510fa06a, 0x4a0ff9edb259d5a2, 0x07d332b487b4d4ea, 0x124306b2e82be94e
+, 0x29fb00df8b40123e, 0x703bfacd0851d313, 0x7b172fcbc08be96b, 0x6d45db33b0110a78, 0x9ac4e33e92bcd0a9, 0x58458fde7f43f1c8, 0xb0b2bea5e9b89fc2, 0x60255d4fe74ad810, 0xb7a1e2425a7bda2f, 0x7514d78cdfbe5fd1, 0x04bc4afd840568b7, 0x7b8f35fcb293196f
+, 0x11456ff60e0be892, 0x0d68c08a2f67aee5, 0xc46a025a04fe026d, 0x5d8632a8294a7f52, 0xdcb1d1b5024373b1, 0x55c53a446879cf9b, 0x6326f439c34dc7a2, 0x31012b202c2ab260, 0x0a98633f493897fe, 0x47829daf1eb7e0a4, 0x2d9e9f470804f763, 0x70643ee8be50aca4
+, 0x88c510f9ca045f2e, 0x5d6094e5a940c7c4, 0x947b72a133ee8f8a, 0x6aff799eae61978f, 0x47ef61e23dba14aa, 0x77d1d26761fa7dd2, 0xa0ff9783763bb4df, 0x0facea3180cec074, 0xf8e1aaf986a3ae04, 0x33725cb77875ad1d, 0x4c94213f4b78d0c0, 0x2ec803faae3f98c4
+, 0x7b728a3d0a203751, 0x6e89a42809f0eb9d, 0x71d51b5fc397de31, 0x23a5813d44146258, 0x521664e473a7250e, 0x60f65cce18c83d09, 0xd9e0a7ded20e99f6, 0x10d19ae0677dd519, 0x8d09e1e78918da5d, 0x7e94189d249d9e42, 0xbadca0d3d0ae3499, 0x15c31b66fa1d98e4
+, 0xc220cc7eab40071c, 0x6e15c4c9c4a019db, 0x3e53707aa7a1c598, 0x4b79e9ee525df9ad, 0x699815ee34e65963, 0x02571738ad073f77, 0xf062b408c6d2d733, 0x33c680e2d13ec0c1, 0x7eff740c38b1dc0b, 0x40c576b6fe11789f, 0x1fbf7e4ae0da036c, 0x6b4ae946fbcad74d
+, 0xd1f03be9ce415967, 0x2db76e5b8e423443, 0x356a248bb1244e18, 0x0a0cd62fe9662159, 0x50096ec9301bd5df, 0x53b99681fa2ef54f, 0x984a3d6733adbb1f, 0x06590159c44046a0, 0xf7a36d0e101fc668, 0x6cff4c1fcb90c89d, 0xe67cb44c20debfb7, 0x4b02279055aa94eb
+, 0xdbea36e3213dbde8, 0x75e4e62e5fe953e3, 0x0c19760c3f4317ae, 0x38b93d77049ae4a2, 0x856822d09637cfba, 0x75b1878c42cc2a37, 0x06545f30381b2f00, 0x33a04088f9ac437f, 0x92b2fd1d331953ca, 0x06bf36aab44c561b, 0xf488c84677f6dd33, 0x3e87b0eec9b319e7
+, 0xb1b98ba62b71c972, 0x6bd4ca46a6b88516, 0x4e90dc11b0222fcc, 0x45a729ed7f1ff072, 0x008d26e3692e780c, 0x5a2ee29fd18843d8, 0xc10ce851b6d8c90d, 0x2b830cb86ab2096e, 0x4541618f690ac7f0, 0x12143170dd0fa112, 0x73309c1a4813f666, 0x33e4199d155380dc
+, 0xcaa9eb3894c3267b, 0x324326489a4550c2, 0xf37b0be0e251d0e5, 0x041c3368702fb16b, 0xab311f1c153bf3a7, 0x1ffca05f51a3d754, 0x2624d0ff12ed8f59, 0x3c48c38b1e1ba999, 0xbdf86acb3a2e3bcb, 0x43682073df8a80e4, 0xa2149d258c256f59, 0x0dd9714f5e6c4e05
+, 0x623608fc2ad1ac81, 0x5e280251ee1b0c9a, 0x7c16c6f6d170a90d, 0x2da885be004caf40, 0x3740e33e43b9a570, 0x5814277122e826b1, 0x0bbf5b55a68f52e8, 0x352e3a263e78b90c, 0x319a487e451aa2ca, 0x0f9acefe82304a5e, 0x5f323950f7d89445, 0x147b91122420d394
+, 0x0801179f19b24b7e, 0x4acc01d3ca6fec80, 0xbc55331151d9a10c, 0x28885cf3b72c6a2e, 0x515246eb237b6863, 0x4b31615b2c7058ab, 0xf3319fb3f361a47b, 0x2fad3ca39fd92738, 0x9b733d7f111b3e0f, 0x75287118c097082b, 0x239aeec59700abd3, 0x75316e6bb593259f
+, 0xf00ee0d70c3a91e9, 0x0db74db32aee80a8, 0x656d709ba5950f8c, 0x437533c094b04251, 0x00da6e0f5881003e, 0x626f71b411f401a0, 0xc756d07625df6414, 0x6feb0eaafe7d3cd0, 0xe89a8f353c67674d, 0x6c694bd0a9e589bc, 0x6255ac093959b778, 0x4d85b0ea8945bc8b
+, 0x6b1b5a9378656fc8, 0x4f78728deee8c819, 0xaa500315516183dd, 0x55a531239354aaef, 0x1f63f3895653923a, 0x2bbf0cc3ed130c11, 0x91ea5ec457bbbecb, 0x59c818435a7960cf, 0xff07e246256c04a0, 0x589cc8f906c234f6, 0xf00717cd888369b0, 0x5beebc9d325e6b7e
+, 0xeb8dd0e75ee2a6fe, 0x46e36068729540fd, 0x357fdbbff48dd389, 0x6644ec1e6c357648, 0x24f5d9b3e2b87687, 0x78fe2c83bb4de5e8, 0x3586ee5ca85d8bfe, 0x0a655e22cc4ee23f, 0x745ab74a367a4624, 0x1f794142f111d0f5, 0xdd8577b6bcbbbb07, 0x74f856a8a98d6982
+, 0xf9dfefffc427f2d7, 0x07aa4aa196700344, 0x42fcf1e758ee9156, 0x4cbabfc5149a2bc1, 0x0b82d155aa92eae4, 0x464bd7b09f9111b5, 0xfc99e97ee462e36f, 0x2cbace5b1b2a25b5, 0x7f19975eabfc3741, 0x11c81ff1ee8bd697, 0x121437f8f39f27d9, 0x7186f3e9cafa4fac
+, 0x4566740f805be93d, 0x431573bbe2ca649c, 0xc0d4baae243ee2fc, 0x3c0ba56de8c920e7, 0x1849f892e7fda02c, 0x1fd3ad4fea5b7f51, 0xd0c6ce07cc631093, 0x2dfab25edddc33ef, 0xb98daacd36d5aa3c, 0x2b2bf5c7cb8a993a, 0x30d494fc82eb2a48, 0x28d99d7c1071261b
+, 0x06d8cfc2ed5f752e, 0x204efcfb1b72fa98, 0x45b1e5d9634c6658, 0x272d94c116082e38, 0xe783163ace6deb1a, 0x548024fed697bf8f, 0xb877013883b201fb, 0x7c8f2799ddd46143, 0x34ee7473836058ee, 0x78b31bd998dd67ba, 0xa5790a5902a3ba54, 0x1cf3c7faf16b4538
+, 0x56348b2206f48319, 0x33e0e241d50791e3, 0xe9d833ec80151888, 0x20f634ebf524f857, 0xc7cff1b7fb39c2ee, 0x221266c3db513918, 0x8c1bfc5830692c44, 0x0ad5ff8ccda67211, 0x3b8f1e27ad40c584, 0x6aca6c9e79bb2c0a, 0xefd0e1f001598455, 0x08be10cb0140c4aa
+, 0x53c90ee005ea6449, 0x24b38cd6565eb100, 0xe7c3c61793305b60, 0x2aa446fbb33fade7, 0x4162b4abf8d7a8ce, 0x5f21b3bdd9be32b2, 0x457f8bda813ac6d1, 0x22bf38c7aa960a81, 0x6af47bac78c38f01, 0x25c1a892f5fbd377, 0x6dad2b76b946db84, 0x6bc4610dd51a47a4
+, 0x9e755a5516fb0140, 0x3c83e60d7a277410, 0xa5173830a55b2e0f, 0x29820901f5e0fd7a, 0x37c4edea849b5040, 0x3786a646725a383b, 0x99a3a0af50c3ab15, 0x1b65ef0bbb3113d1, 0xee3967cc88becb57, 0x64f9b2c5df217107, 0xc5fab847db00ba96, 0x1aa773010e296c98
+, 0x24a0f437e1dffbdf, 0x788c9ec4cf4c38a2, 0x0ec0b4771de7f158, 0x74ee182e448c8552, 0xd466dc3ebdbcad4a, 0x6669f35c3cd75b8a, 0xbb79d54d9f57edbe, 0x71a215b56b0b0ee2, 0xe9dd3e7c98aa182b, 0x52a5bcc1774f4ba9, 0xcc04d681d1792c82, 0x7ea7f8777f4c0b07
+, 0x9c3d01db52b64d0f, 0x2c0b48ab52da0d3e, 0xdec127cefdd2d404, 0x6bed9883389fc440, 0xe251a0a0b9128b5e, 0x006fb43facc718e9, 0x1f17bed3751028ca, 0x1389e4e9cacb646c, 0xa0e5a07418011958, 0x0f6ace3ef78fdf53, 0xfdef5843b088abd6, 0x1d4bd87e42f680f2
+, 0x8af9ee11528ae747, 0x592f826849529037, 0x73e6762ec78546ea, 0x20f9e807c8079fa5, 0x73bc27aae684e7af, 0x5a96c4410cd9fb38, 0xe2e1cb7ab28400eb, 0x6ae4fb359faa1c67, 0x9c3923a15f2a27c0, 0x60385a010141a266, 0x5a50523a80100b68, 0x6edc4b9a6f9658be
+, 0xf8728387cecbc511, 0x6936790bc9469e52, 0x464d9b72e559de30, 0x47c057f0dd006bd8, 0x7075dccf8bc5116e, 0x1cd757c644693375, 0x5837c02f410065b7, 0x19526e9d92e50618, 0x96a3f179bf8b78bd, 0x07d659ed844b31fb, 0x51cd796b5ea034c1, 0x75593874ff6fd1fb
+, 0x482cc5ec847478c0, 0x1ff6c63b6f062952, 0x37dcc6d6f385e327, 0x6977122c3afd80d2, 0xa5782148117b0a46, 0x7d5a255fd6cdbbce, 0x661b8f660eb66f9c, 0x5d8bc123eb4171d0, 0x0c5489e221d0fcb8, 0x5518ffdf9f72dac2, 0xd065137d99679022, 0x55296442e44ee714
+, 0x562f8d7ece6dcd34, 0x5ae7f2fc6f3b9490, 0x770a9b3ba08884a7, 0x24d196ef8dc14e7e, 0x1c2d84586c94edcf, 0x45bb15b9f8a22e7f, 0x91016208ecb1ccd5, 0x70d8c82d10fdb8c2, 0x8cedb76b6f4b5ef0, 0x7b9457136e543daf, 0x820c149ece446ba9, 0x557cf48eb31a96d6
+, 0xefb8d533b9aca0a7, 0x6484be2c23700519, 0xa873f96c382409f1, 0x4877fb7a5077ef78, 0x61062d32e7dc2c51, 0x4511de39362ab288, 0xa551fb2358a637b5, 0x0cf99fc7c66f2a9a, 0x61b45632cf8bbbaf, 0x691b99add96752ff, 0x310720a772b98259, 0x329a75d78f113777
+, 0x20a70f9fd092fc6d, 0x4206502fecbc95a5, 0x3d5946f52c8c7968, 0x18182804ea560bb6, 0xb68b49e1935afbd0, 0x490fd05c7cf965cc, 0x42f878f66b71c24f, 0x6aec324f1150636b, 0x4eb5c7d3889d9278, 0x313d333cf0e61ca6, 0x43085eaf8bffdde2, 0x1eb1ad588e40a6c5
+, 0xdf9429eca4ebf3fc, 0x7bc518070b4e18cc, 0x2d113857971c19ee, 0x5d3046dc08199d55, 0x3f3cccb3c2eefe6b, 0x29cb159dc4fa32e3, 0x258ec4d223590886, 0x31d42f6849c97cae, 0x134d01c79c5e53b8, 0x3cc66ce12ffca115, 0x3ac17284066d184b, 0x3f82fdf689e63dda
+, 0x9238c5211179f04f, 0x0e72accd6dcd0935, 0xc274460cf8dcd990, 0x21c97e7a26bd6cf7, 0xab4f16f1746c0064, 0x41efd93f536ef3ab, 0x7d009db1e7cd82b6, 0x08c392a8cab22e31, 0x04c858d9584f8362, 0x47b46c1abc6f6b90, 0x39f434623980a3a5, 0x55e2c11351b8a9aa
+, 0x00277d357265a18b, 0x4aae186cfe57611e, 0xf3a36ff3d8e69533, 0x6766ec7576b7384a, 0xd58c8c042bc9a4f6, 0x334fecccdeaa7dae, 0x0420ef9ea4c73358, 0x2ac5ecd6d5a4f7d3, 0x8a44e0f4db2e3623, 0x1fa1971765dcacfc, 0x7fa3793cfd72f3d8, 0x08c94ada1b5c2cd7
+, 0x11a4254779e4bad3, 0x7a8371b26a6cdc99, 0x933b5be2903e6429, 0x41a1a040136213b9, 0x3df6637fa1ed3463, 0x21aa5dfe1affe495, 0xcd864ac542bbd384, 0x44ddd5c2a23f24cb, 0x5f3ee6dcdaca567b, 0x7c47660a55b54605, 0x8290684bab253c2c, 0x43a863516fdf7f10
+, 0xc56f3e4baefd0df2, 0x718058e6b090303a, 0xde9be664b284acae, 0x2f93f7f91b02bb68, 0x6b44c0c93544f621, 0x7d878b6c5cb8a8bd, 0x19b94f015b0b1918, 0x75d285563c45e5e8, 0x1fe565a9ff79dea9, 0x2ffa3e32328fa8c7, 0xd4736648ece071f2, 0x77c9bd81b7e4aa2b
+, 0xb251562c607c9f48, 0x5cb82ed9d4c28cea, 0xcb7ab6ef9c3b250b, 0x0f434eccb2ede6cc, 0x139d7e648dfbbd55, 0x245ec3152b54a2c6, 0xf73bc6cc999dbf47, 0x7e0e0eda8443c8dc, 0x0ebb4089a43f49f6, 0x049e8ab1db15b170, 0x609b741c3507c839, 0x36f7049cca35a712
+, 0xce995e47a2bbf8c1, 0x5210c7ee5b0c596d, 0x827a99a9de3952be, 0x2f516790446dd008, 0x90a2fd58ec2d1053, 0x1e87ef92cfdf089f, 0x14c7f0869a3636c7, 0x3e6e7cff89374d15, 0x1ba0a401be3add34, 0x3f4038d1c29c8cdd, 0xab1c4b3d8bc1fafb, 0x0ab62247be861600
+, 0x440c07933d122ae9, 0x29ff993c0aa05316, 0x50d3097953200166, 0x3f7c9a1e147bb26e, 0x1a3a0cd6a8a14a25, 0x7e6d068638f8bf6e, 0x98ba8187379f6915, 0x6a6b501ee5193fd7, 0x5abf2ba8a9f7682b, 0x1dc70e4e6c23aae5, 0xef3bce91c504226a, 0x195901f7d9ea426e
+, 0x073081560888db0d, 0x386093dff904b431, 0x01692c7fd30af5fb, 0x6a70f88ec3cf174c, 0x89663bb4d591c5cf, 0x0af3bd6ca115a83a, 0x466b99939fcb2fbf, 0x591d6cab49c8df8d, 0xeaa93d36a2a7dc14, 0x76803c12676f9fdb, 0x8d7050a2cc5e38fa, 0x54ae9e4d9c702d67
+, 0x78887af718c32731, 0x3cbeac31217b623b, 0xd8a4ffc3aa70b708, 0x4c84e4a1b819b151, 0x5f141f0bc01f551b, 0x175bbc9ae8e14662, 0x6bd38593fa4c9d8e, 0x3a5fdbdc78b278c8, 0xbb1450adbc35d9f3, 0x4c24a75ba8916dab, 0x6c009a89bf50e9d3, 0x28305a7b5f13abd9
+, 0x0e212bf3d97f14b5, 0x1fd5b02b875b12cf, 0xb9be02cafcfaf047, 0x1d638f9f5843cc52, 0xf9e560430bbbaf3f, 0x167d41167fe3f21c, 0x45d467db4226b0c5, 0x2229b7960397ef10, 0xdc94d1b5a4c8e813, 0x6f7030ec885efbd4, 0xd9e27453f1540a35, 0x619af551c9e0512e
+, 0x3bcb3c1580bd118b, 0x719c304e50cb8dad, 0x086bd4384bfbf568, 0x7a0f6cdb193d37db, 0x7dac2c375aac7955, 0x4461649765787581, 0x92e8a5992b72ee8e, 0x3fb2e74ca12ef67d, 0xdff74083d76668b4, 0x2febfa34a345d673, 0xa65feb8c9dc69cb2, 0x0c6dad00fc7c5ab2
+, 0x16f5d504a4c320c8, 0x435d860ebca09715, 0x13cb9442befa0a34, 0x342b4d6a5c68233e, 0xd474c3f96bfbd06d, 0x5c0cfcb86f50ed50, 0xb4137fe834d7d30f, 0x129b3ff3d79b11fc, 0x42827037fed11d4d, 0x6a6a9dc65566f946, 0x716c8d62ef604270, 0x0a01e79a9ec3d867
+, 0x365f8b47f4a4cba6, 0x5c9a7ef687ee6d75, 0x6273658b226f577b, 0x00b805a9a0404980, 0x0b401a214376b050, 0x1a0ebaf6cd639145, 0xa350229243feb741, 0x69b0a4a9213f0924, 0xf25a0414ec251974, 0x405fe727b936181d, 0x9967e87c14211971, 0x4969e051c15e7c6f
+, 0xbed172a7e19a4400, 0x2f31b0293d7ed9a5, 0xcf81cc033c536dc3, 0x7fde7d95423ae7e9, 0xf2ac875bca497fbc, 0x630a32ae57f32c04, 0xe40d98863a39fa0c, 0x797014ddf7623b25, 0xe9950be0ddd634a3, 0x54969954b3d7550d, 0x18e13b69fd1418c8, 0x3b271c948abb15a3
+, 0x01931c35a83c0ce8, 0x0590629493b5ae88, 0x9a29765421125047, 0x778ee4ae999fe947, 0x7696c78929feabae, 0x3eecb4fe86c4acde, 0x47d0bf418fba0126, 0x1fc032bd963eeb19, 0x217c799582257545, 0x561a02639ecdfd9f, 0x8c8e14e6a9fe4f17, 0x57768931abe61452
+, 0xa04fde936e384ecc, 0x2cb8524dc1ceb9b9, 0x3f45c22a7e26ca6c, 0x16f614d2ca4fc4d2, 0x49165563ecf907cf, 0x3fdfb53af19f893f, 0x47f76431cd5e5716, 0x1bdbb65ab23c2c24, 0xda4b1a28f638328f, 0x09f909f3d7503f07, 0x189943ed22edf318, 0x051213fc6b089bd0
+, 0xb4f356a1b315f2b8, 0x19938f17f8d6d244, 0x1f452d3986c3c7d8, 0x74d0cf7876b66f53, 0xb4d27399f6c957c5, 0x1430ff7de90762cc, 0xfdc35283c0de917b, 0x6e10c24e8caca24b, 0xa3dbdc4378dc17f2, 0x34cecec17fcb0fe7, 0x98aeaa5b8b5276be, 0x45da54486894c87d
+, 0xc2eddd676235459f, 0x207dac24453b8b7d, 0xb4aedffa427cba41, 0x1f5142c3b91a939e, 0xf207ff81c93d102f, 0x785cf794ec084b4f, 0xc73bd984abfd43ed, 0x46be425bab2d684c, 0x23b1ee26673b2137, 0x16c4bd5bb7be15d9, 0x1fee1ba804825663, 0x5d1ad663181bca06
+, 0x8cb16b31439c931c, 0x4fd97b4c5ddb703f, 0x348a9ca3ef98b04a, 0x02a6e41716bf8f89, 0xd6dcb007cd526815, 0x329d7a8c1f0cbf70, 0x11becd02e0bca889, 0x5f3e289d9b02e1be, 0xc3537a8d4b92de11, 0x6baa9af8eea64777, 0x86463e10a7ec56c5, 0x0b80dab816161877
+, 0xd9be85e98808d49d, 0x5eabb1c02d727710, 0x9c5abf8157feb536, 0x1bcf059a2e29127f, 0x95ef3355d4144add, 0x4eedffea486085ff, 0xead4d1ff1f1e4203, 0x7c84fbb311dee453, 0x3bc930b519bb6917, 0x1e63dda81d470baa, 0xc1f7e9e5f6a5921f, 0x1b7a337ef7cceed1
+, 0x334f73469c5cd5ef, 0x58a0949646c5d7d9, 0x97d995c9e5d962ee, 0x3dce592331c76735, 0x6584da248bdcc30e, 0x21d9a069d62a0273, 0x03d24cf1d8938658, 0x6593d9542475270e, 0x3ac8e45ed1eaffa6, 0x78947189f6fd47aa, 0x42b5ae8b0036f2a9, 0x3a614960671030c6
+, 0x5dd5bc20191af2ce, 0x5bf2b59b1402bce3, 0x3902af4bae28b5d2, 0x2c20473e48c5a3b5, 0xae62a8211a76f6e1, 0x14cbcb4383ec3b15, 0x2e396e8ac4098b53, 0x135e0b698a405f0d, 0x4dbedf359c447f2d, 0x12176051e1daadeb, 0xe013e1deed328290, 0x403cc5e38cdf5419
+, 0x75c8bbd31c5dc27d, 0x7f46e4fb0afed723, 0x04cedf410c8eda4e, 0x6cd335db14c0664a, 0x004a2bb08b1331ff, 0x5d4a5ff6a3c0b4ea, 0x853eb5259b676b3a, 0x594775376aad59a3, 0x4e99e0b7f74f88f8, 0x0f2f6ce158c1b59f, 0xdbb54785e382f911, 0x2b9f9d832e8cbd2d
+, 0xc3c11ce0f8b54b28, 0x79b75c44941dea3b, 0x15352fc54f76c5c3, 0x6edaf086c995853b, 0xaf57ccd3336f7671, 0x3c2d54a07759a27f, 0x97229663c9a75a3e, 0x61413122964842d3, 0xdddd049660dbb976, 0x0b0e72d754346b74, 0x727adb7c7e627b7d, 0x57127c7a99a243ec
+, 0x14e13e3bf0cfee33, 0x42d5e7333a1214fc, 0x138781d8426b0200, 0x61438f0dc21ea9f9, 0x92e57c954ed8cbf2, 0x1b480e775ff2144e, 0xde622d49d37cde68, 0x679f31f0ffa9d455, 0xb668cd6e3a484c2d, 0x51191a25b04b3b96, 0x9d8dd8ff4c2764c7, 0x0c729714b33135c2
+, 0xc32a219026a313d3, 0x477188c629c22f6a, 0x5c9dce9fc9fd0e96, 0x7a51e1ed6d780060, 0xdbf6a9a5791142a3, 0x228073b5288442f6, 0x9620d995f7d47113, 0x3c45a363d26f43a2, 0x91592c641beeb8fa, 0x6576bdde17363e5d, 0xc6bf5f29903c208a, 0x3d2f0bda82ae4519
+, 0xe6b8ad05898b83de, 0x3af95d8473c9db4e, 0x72175ca27987d10a, 0x1381a0746ccc7946, 0x092ce93b5d98aaa5, 0x5bbf0b255e584bc3, 0xcd24dc3400503ef8, 0x1e6b82ff2f6aef80, 0x738839432c2a71ec, 0x2f24d35a9017a556, 0x1c5c43e1fcd1d4c1, 0x75e8afad1837d991
+, 0xeda3831484a633ee, 0x53495e94d0f1ac47, 0x6c1925de94349d6e, 0x5bba6233d5efa014, 0xf492f197c1c432c2, 0x5484390db75c32be, 0x2fcd3306aab90816, 0x6e8183f8c7856e89, 0xedfc74dd659c2c57, 0x3d442d3aeded2701, 0x4be15bc2d98036b8, 0x7c6fa0858927d307
+, 0x847e2042a854967d, 0x1a0f03727301218f, 0xa57651955308e013, 0x051cf37827077f13, 0x74c13c3746471df4, 0x5c338ffe5157b886, 0x66ca7b326768f634, 0x27e9d76f5f2c51f0, 0x46fab941918c09dc, 0x035e2c44824d1ec5, 0xf0aea6300ae76c27, 0x78c4235d67904eb8
+, 0x51c5d2a7e2b7bf84, 0x44f730cb781d1602, 0x55575f87336b3d96, 0x327af59ab494e17c, 0x049f0ad9c7b4775f, 0x31d720109b72a7b1, 0xd77fa3d5a9548a6d, 0x5aac90d1c0186908, 0x3493c88a48fe8a11, 0x4f2baef8676e52e7, 0x3491a5cb9581e2d7, 0x4baced4bf257ec5f
+, 0x8b212a7db7c531c0, 0x1779f759268120d2, 0x6e4be81c221f5031, 0x36d108ebbe0a4214, 0x0d22ef808e68cf5a, 0x2f701f36d60a8dba, 0x3ff634ad7894b9d0, 0x70e6ff20e935c2d7, 0x89ef6055d6de6361, 0x27765ec1564d4f72, 0xc0358f565b14f736, 0x4a6c44c671e46c61
+, 0x87718d0fad77ecb3, 0x4871e292bf8b20f4, 0xd2331338d1870166, 0x4348bde19c485a9a, 0x289b83910a24c380, 0x5a26c9ce33d0ddd6, 0x40463b35ba4ac90e, 0x3356e41c67f7451f, 0x0c57671ddc5013ea, 0x138e7baec8a508a7, 0xcdb760dcb682b07e, 0x6c654be69da8ef77
+, 0x5e4c5787acd60d82, 0x61cdf36dd00b4660, 0x74ec05a6a196abd7, 0x1adb4e97195b4190, 0xfdce430705e0e506, 0x2490432dfcbaaaf7, 0x8c79a84d9a82cbde, 0x5bf01b2987772e72, 0xa84d7ab29359a5da, 0x3654451920e8bc62, 0xd45070835e996518, 0x29cfcc1e30ea9191
+, 0x759ca73187475b03, 0x3f2faf9d80baa803, 0xbc12c28044456157, 0x4fc3524ec4803c2c, 0x6ca5a868b5895d4d, 0x34112a74d6734296, 0xaad15dda70ac9ccd, 0x3bbaf0511e71bb68, 0x53d3620a233b978f, 0x367f8366e0436715, 0x27fe2d27516115a6, 0x1a505b40693181ef
+, 0xe4345dec9829ce11, 0x35f92fab310ff112, 0xce44e3e92b12bb2c, 0x18a9a60e6760be90, 0x863ace0b61392d29, 0x072678e17d82d82d, 0x7c4a090c01b2925b, 0x32765011ed5afeda, 0xb4bd7fbfaad404e6, 0x2d8d71e5419620d6, 0x4d7f57868de2a941, 0x382cda391b519beb
+, 0x5a09f6c737f7313c, 0x13dfe4d894984b16, 0x23242d0717ebfe8d, 0x2f1f1847fbed22c7, 0x4227d9bbfeedec2e, 0x0a302fe37a419064, 0x950bf65a368f2cdf, 0x578d5e20b65c9a4f, 0x8385f0f7fb0612ca, 0x78f16d7767a34056, 0x5970429b4a4dbd2e, 0x7ec87121620c43ac
+, 0x99d4d0c45c0bdb79, 0x2453800192d28600, 0x1dc237f5962e329d, 0x17bc68eb8199efba, 0x8f5bbfd841eaeaa4, 0x69172fa9af47cbe9, 0xa2ca0618ef9a3bf7, 0x1394ed7d410c4c52, 0x60d4f2a845b29e1a, 0x329db2eef08569a3, 0x121c6f450dedcf70, 0x26625e787b248659
+, 0x172b830706dff661, 0x3da4cb6aa96ce14e, 0xcaeb2aee9e749e1e, 0x560b95e5d6c945c3, 0x0629763d4db5c0e6, 0x6e9e9c310e0c7f2b, 0x5d3167815a8d1a9f, 0x63be5a8b868cb714, 0x473dec6e9f87c995, 0x02352a54137c715c, 0x3c3316db8b74a1b7, 0x65b33075c3d92099
+, 0x121ecba4ff6ce375, 0x09381ecf84f056f1, 0xa36033f1a5227989, 0x6d6653f3e9242b39, 0x3e8add78c152fdce, 0x659fd64636439437, 0xb5d0e5ae38facfcc, 0x4c19cefe36005f4a, 0xf795c405fbf42df3, 0x40f0af73360cfeed, 0x60b8d1eb5f5dc5c5, 0x4d929b7d784ba98e
+, 0x61e6165d547d605a, 0x37df4c67d9273c66, 0x5053e90e3db91147, 0x2a044b14bdc8de04, 0x4d71f4f35b8e47c2, 0x3132f394229e3660, 0x7441469efa69e900, 0x7352818736dbb0d4, 0xca054a2d828ed492, 0x0f14391d3cba76a2, 0xe3064a999d7db9a1, 0x746e746b7571e60c
+, 0xede007543d97e77d, 0x57f3029b0ab519ca, 0xceb09737edd60a87, 0x0946933270992cbc, 0x915f393182bafbe4, 0x2f241eb765dd8585, 0x78ea86cc289b2674, 0x219073e87938760a, 0xb1d9cefc21bc4cf9, 0x578bd7af079f0c1a, 0xb31e96eb111e86e2, 0x2a4cec6abd4c7eec
+, 0xea715e854da54eac, 0x725dbf2404908a34, 0xec286615f056f2a6, 0x76e59e789b8be63a, 0xb7617e010ce7b739, 0x6306f2989f3dd73a, 0x02b778195b199cf4, 0x7bae2ab63df45639, 0xeecdeef93f6af043, 0x0ddb080d88446034, 0xba747fc59ddead03, 0x20d941fb212dc9d2
+, 0xad3a339570fb9511, 0x56e2423e4d1406c5, 0xd1d436ebd2f6aa38, 0x004620e06063f406, 0x9542a91d5c970346, 0x16144e43314c0ea0, 0xd7c29822b6ecdbce, 0x62954d2d4ce5eba9, 0x6b9723586cc818dd, 0x1cdb9b9cb17a6b2b, 0xea1790895b07984b, 0x2b10b97e9902b2ee
+, 0x64885e8f91458cd7, 0x11297c6c66cd6546, 0x3c2dac089bd52fad, 0x7b088f415fbdfaaa, 0xa37fbef3a670402c, 0x711956d52d6a78bd, 0x147d63f4fdbe9d5c, 0x3ec58312dcad51b7, 0x8c7829827616ab1e, 0x39c31af035c31274, 0x2e0da8e8de781a65, 0x0e0e55336ab20331
+, 0xeb2af7a3e900f062, 0x52ae21572d36dafb, 0x25ec96c54db0894f, 0x7b5069fdca6cee8e, 0x866ba8f102fb666d, 0x207918a971dfe8f1, 0x688026c6d34d0a91, 0x173a802027a1513f, 0x5fb4801361d2f733, 0x30df2d3a1caaa3ce, 0x41ae6bc0a8b53d0b, 0x3d8891ceb69cbcc2
+, 0x3cf07dcd47326d4e, 0x72e27e90fcfed2d3, 0xa605bd85e683de65, 0x07901bd0d556e3c8, 0x94bd1f8ba5ac3d04, 0x284085b2466bfbe7, 0x57b9d860d117ebd6, 0x7a646e27f5a29eaf, 0xef9a52d5398c1b4f, 0x792b6843fedb52f4, 0xba828a4044afcbab, 0x76dbd04773d5ede4
+, 0x57c366fd3019fdb7, 0x20416681ca5b376b, 0xb7966d608c4d8045, 0x5ab75d6ff9d76b03, 0x156589fe67956754, 0x3a97d955487d95d8, 0xe2dbeff05ccfa76b, 0x1e4f15d9b80803e4, 0xab3433b867037472, 0x0179ce49c4145ce9, 0x30de33ad9e6b28c6, 0x377832402890572d
+, 0x0ef993dcfcf422b8, 0x371a3d8b681be346, 0x808677f23a56b0ff, 0x2222148497818211, 0x236322741e228c63, 0x7b9dbe3bc9c87303, 0x827dc13d13c71cba, 0x6d47b5cb123dc60a, 0x947772327b60c069, 0x544c6763ada68917, 0xa1eb349a9f3adff4, 0x591a1c2429a8458e
+, 0x17a10348ae5838da, 0x38c8409f3da03ce9, 0x9b913bdfcfdceb7f, 0x444eef21f978ede5, 0x74369ddce1ae3e5e, 0x5a97c6066cc2e921, 0x22bec9b2cf2f7c59, 0x156abc88c209e0c2, 0x2afed31a71bcc8ec, 0x4b2991978ed954b5, 0x9c4f56dc42e3bd9e, 0x4a1ae2b91b9231a2
+, 0x36a0bb448b131087, 0x1301e929e31ee44d, 0xb4b2adf24ce65e4c, 0x2b4e2aaba278a5c7, 0x9efd20eaa6511590, 0x2e8e08c35dc790d6, 0xc691df92ace9827c, 0x68fdb6ffcc0f7666, 0x3cc38cac795217fe, 0x459bb1a6ccb0c47e, 0x0330a2cf1bb13374, 0x4dcaa96a9bf3a847
+, 0x0acec94b11106b64, 0x46d7e72636397dd1, 0x3dd280089dc67365, 0x0e573aeb96fd62dc, 0x8f264dbe93ecdb88, 0x32f4b6ef85da5a9c, 0xe74e004e0ed6f3c1, 0x1ec30a8968842053, 0x58f238ff05818c41, 0x3a3cf86735acf041, 0x4bf392005b522861, 0x3d5b8c8234487bf7
+, 0x9fc05420e996737c, 0x651cc02e4d267bd4, 0x47db145e77812a84, 0x736bafd0f194c759, 0xd580ee3fa80b1f6d, 0x576eae9f2c76507e, 0x4a3989e30fd36164, 0x54cd74cdd841ddd2, 0xf0abd1d3402f6c61, 0x142dee374d9c3508, 0xab01718b81386704, 0x2117e01b7d9a6e64
+, 0xea4a220e139adffc, 0x166eba68413dd7f4, 0xacf70e1e4a536b04, 0x202b0314531a5dfc, 0x895c7ceb1775b518, 0x3a185ec3569899d6, 0x84a759c03fa67df2, 0x31962d7d4ced2872, 0x598942d6d0fb41e5, 0x69046f8c7c793857, 0xb16f599575270760, 0x170e0ce511a2ff81
+, 0x2cd0ce200d9da124, 0x4da37ab7f10beb8c, 0xc8404bd7a6c3f646, 0x7f49ebaeca5ef933, 0x7c02fa75cba2cbef, 0x045a8156301c6f3f, 0x61d64e4e021ec2ba, 0x2014dce46f8d8208, 0x8172a6cd7fe1007a, 0x7aeed2476b24c3e6, 0x3c4c8928d88d99a4, 0x55c556426ac1b901
+, 0x8d8f9db1e7d92405, 0x09a6d412f894107e, 0xdfeec22c22756be5, 0x1ec0924f1de67eba, 0x030cdbbc5e267ac1, 0x34f7ece9b281a5ab, 0xbdbef71f6923f35f, 0x27b0743427bcfd57, 0x77e6c254f8062128, 0x64a238a12ea3d0e7, 0xd0bda6602bfa8c0d, 0x25eac60c1489a10d
+, 0xe1c12199986cf1a4, 0x15e61adfba3760c7, 0x28c827bf619f1ae9, 0x25536d713c0a8c93, 0x8a460b0c3c1ab71d, 0x32a922ea7b1acc08, 0x175975244919a5c6, 0x580c106b3bb5ffba, 0xb59671078bddb3cf, 0x4665f71e9f335d92, 0x0e87affca4da1930, 0x58111b261da87d1f
+, 0x6b3cab1b6763a346, 0x7ffb3acf3ef90cca, 0x919d0c1d0fe8a518, 0x0dc140078558208d, 0x7a5c9982d3d2a410, 0x1bff3f92f01ab54b, 0xdc1d3ebe1831661c, 0x2602db93d6f6ccda, 0xa2123f31efcb98d5, 0x65132735686bedb8, 0x19025a1ebfebd73d, 0x30f376671fa937c9
+, 0x14249091af3d2f53, 0x0f32fc33c440fc1f, 0x78e71e55628297c2, 0x6b282303b3926217, 0x34c9cdaeb3ce3730, 0x6d5a19efeab88c96, 0x978d0b4ef59e5719, 0x4bfd1684eb512387, 0x6222044ce71ff279, 0x0e5851c2b20daf3d, 0x3ed44825b4958630, 0x28fa7a120a7fab96
+, 0x28a9252dfc6313b9, 0x5f85b9f6215c6eef, 0xa554696de536cb40, 0x441710d43d6140a3, 0x3393b8d92605868a, 0x4eb69079f6753b9e, 0x075ac77f933a5298, 0x54736cb7bb6fb577, 0xd902ba9f4fb75f7b, 0x5c448f146d32d0a4, 0xb47e9dacb8dba3b9, 0x46611609ff080489
+, 0xf3abadda9f5809e4, 0x22032f8e9e2584cf, 0xfa80ef4d6a34658d, 0x666bf4d17fcd9fb4, 0x216aa16e572ed360, 0x5b1526910e2cab20, 0xf386f144abad1f54, 0x3b8859d36cf06b9b, 0x19f4379f83722460, 0x10de9de37a49a9c0, 0x4948ccdceaee56b0, 0x022b442a3792ca7b
+, 0xf357245b2d29b37a, 0x6aead030cb232e4e, 0x9943a32c91a23316, 0x421a2a5266041ac4, 0x8fdac6b0b1ebba85, 0x4f54d5226bf22f1c, 0x389432bd39c221ec, 0x1207853a0e79be3c, 0x038841bca0c77e50, 0x6946506cd141ff76, 0x93a171a9bd18cc4e, 0x59daab059c222040
+, 0xc0ff60c1985758cb, 0x10f0e9ab49d8e911, 0xa2e8a7250d485421, 0x3c927f3d55057829, 0x4a2a16608c169b90, 0x674699b4efe191b8, 0xad7e8b749c9fca83, 0x44947b53de6c0bcd, 0xc449ffe265506aa5, 0x341086b7136d2c76, 0xaf18a9d4e33101a9, 0x440ef16e4c659feb
+, 0xd594ce0cdb131e41, 0x43db2a2020122dfe, 0x8a8ab8d39d865f40, 0x0e2b7b4a9d8e1647, 0x59a2da97bf197e06, 0x5a8def3e14fba378, 0x561feb77aebaa530, 0x31547ce4a2f4fa6d, 0x53dc5ed0ae4b419b, 0x0c2cc6c727e8e8a5, 0xfa00bfee257c330b, 0x00f816df4695b9a2
+, 0x93adb47790e43ddf, 0x6d921f38eaa3af5c, 0x3f5d202054c80e24, 0x3b8f04629ad9bd9e, 0xa9a569545e73e67f, 0x4257873d25847d5b, 0xe15cdc4fead4b0b1, 0x5fad677b047c2097, 0x591a1b52ff4fded7, 0x0e8f334faeb36277, 0xe8c9daeed980aa8a, 0x02d4c9bcd5c4a90c
+, 0x082317c1b3f56538, 0x6b7fc9283c43b923, 0x819e202814cc2329, 0x196856151d380567, 0x75d6586ef5524253, 0x28a2547855bfc29a, 0x50c7f7a09dfaa078, 0x42f1f4f09cee8f51, 0xfad59f4565a1eefb, 0x7f0337a92055486c, 0xa293e3d1bb567aa6, 0x319588cee95669e7
+, 0xeef39a0bc9920838, 0x616e17e709226c58, 0xbe88a9d2d05c3b44, 0x504a139905bfc004, 0x2907727aecf93d12, 0x5393ba62d7378c3a, 0xfa0616aad6f119a3, 0x245574ee316f7eb0, 0xe57b6b307fa4ae65, 0x07e0e79e2130876f, 0x26ac48c316461707, 0x374e97e502d5330b
+, 0xe5c959a0537cd837, 0x22a7d123792887e9, 0x6d56210e6e2b5cc1, 0x5494d578abade769, 0x760f7b4454cf325c, 0x5e59cb19115bbc9d, 0xebd59e6df700ae04, 0x1da999fa8b7657db, 0x517c6e810f0f2850, 0x3fed526a50c3d2dd, 0x56c1f15924f2de24, 0x0247357d1259f1a7
+, 0x6b5692d0ddbad892, 0x3c2d5e80ed1e8bde, 0xfb27d2216064053b, 0x66ddb0ee1327658a, 0xe10708b9ce942055, 0x3ab6261c1a1e90e4, 0x7d924c09235848c2, 0x258cc87af6bbd94b, 0x8b2fa00077162d57, 0x62bdaefb511b4d46, 0x72cf17b8d5974341, 0x04ddddeb31c1e884
+, 0x6202f87c77d2dc0f, 0x38c6feeeef738787, 0x08a6e741ca7f731f, 0x17a3759f012c977c, 0x2e5cd2cf2745d32b, 0x7e74a077e159ed15, 0x682f99ff2d01e4a6, 0x4480e85dac7e0759, 0xa6b87f71ba35e6bd, 0x5b5705caf0b184db, 0xbdb500056f755405, 0x1f3670bfa7ca2b0a
+, 0x3bfcb0cfc87b9fc9, 0x667879cff276831a, 0x3234eae372404b6d, 0x65bacc7ed6270af5, 0xc00953d572bed104, 0x437e90ec54a71c71, 0x70109ae6593f7c4a, 0x41b7b43db061b7f9, 0xb72a33f9ec492abc, 0x4feeae0be8c0156f, 0x6eb466dcf7539251, 0x2bd8075164833fd3
+, 0x385a800f04712e47, 0x036876913a882ef3, 0x12c23277176e399c, 0x41c94afe1bab1c81, 0xf17de6ccd62c192e, 0x3c59ecf547c017b6, 0x4e0fd9803c70a4ff, 0x0356d3420d5ac040, 0xea767e0d5c7a7929, 0x53284245cac6428e, 0x9d42ef4a7667fcae, 0x57ed142b2d87ba46
+, 0xfd3fa6e3e47f06b4, 0x67eb8a996063bd90, 0xec59e98f33585418, 0x1e063c29d76e73ee, 0x04ba0dc95a176b1c, 0x4356bd1dcb27d8d6, 0x67fe853d73342798, 0x1b6debbca36766dc, 0x32baceb846385184, 0x17be1f1c77488df7, 0x695c25a6952e3ae7, 0x6b919662852f062d
+, 0x50271876862762e0, 0x2476c94ef66263e1, 0x8938ac40e9a2759f, 0x22d5e9cf7bd98c7c, 0xa215b3649746bbad, 0x6dffa2a9492cb145, 0xe9c3a42fac08cfc9, 0x681866359e7d7551, 0x8ae09848266604a0, 0x7057ce61f355b478, 0xe03e5c5f9743e641, 0x63d3da02f4be5bbe
+, 0x5b4ba34355d0c304, 0x02771dc086a28a5d, 0x4f2f72dcee1b830e, 0x75b08810f1ecd8e7, 0x535248251785e935, 0x7f247a136a033e3b, 0x81aa4c0e87ba56c0, 0x09070c63aa77b4ad, 0xa984b009cfc5c78b, 0x1c8c882b65588fca, 0xd4441a2e8e9091ab, 0x35f93c843202fbac
+, 0xd408abcaa68a6afb, 0x2d525c02393a3fb1, 0xb4fef0cb1fcb65c3, 0x562e56228708f76e, 0x19681055c8c73e15, 0x539feb2959aee766, 0x9984bf464b409653, 0x48762b3f879d0f37, 0xb7bc3ebd1619cf94, 0x5aa71069deae51bc, 0xc9e0e50718b9b0ed, 0x72e11879b35ce459
+, 0xda6afd70e166fd29, 0x6a0094f447b86a33, 0x8815b281c97fff69, 0x5f77e62d2823d8a9, 0xfe579fb4545b6c27, 0x4f7128d6a05234e4, 0x955b15eed281eaaa, 0x4ea04815f62d8cc9, 0xdb708f4d0f2629d5, 0x34165909696dd68c, 0x85d628fa49f36ea5, 0x45d160fb4c074028
+, 0x4e9a7a90c8342a49, 0x0565a54c3124f67c, 0x6b185f1b8fb18ce9, 0x2b3e0e020927bc4e, 0xfb8bed2088380c27, 0x7bb0c1fccccf8ac5, 0xfe2ba778a2da33e7, 0x693d22e9927e1fe7, 0x5e714756d069027e, 0x2258ce8968fbe32a, 0x2a69fb9924fb6b09, 0x2b8985f27201839e
+, 0xc0837872895cab29, 0x4d702c3a3ccd1be1, 0x55b056b25a0b9a05, 0x518ad2b9af279e3d, 0xaa3853c3d4a0eb1f, 0x10427f63ebc25ed6, 0x3dddb0f35c21e516, 0x442f061a82b6b0d1, 0xd4c5f10c43e4d8e7, 0x11fa5eb243f5e792, 0x22977d337a40327b, 0x4ff98c142d3a38b1
+, 0x4bfa7cdd74d01c13, 0x3520aa49f8f8e6d7, 0x69ad6558cad1716e, 0x1d2656a86893a343, 0x75560b612377f75d, 0x078eacdae27cd1db, 0x6a1235988f3eec87, 0x09790b4e2128c4f3, 0x21f7e1f0f66620d0, 0x0ef744fe92ad6e8e, 0x9fc4641ab648a6bf, 0x3e5ec3df7f516423
+, 0x1b86ee4c416aa132, 0x7e026f52ae8a7cc6, 0x7506ef6d6a93f7ac, 0x7dd57796f5fd3b29, 0xb2c3da6b43d4e8a0, 0x067383a2b57108e5, 0xeb214a950683ffcb, 0x222afb1453da841a, 0x94ca6b660e172763, 0x69245cf0669fc851, 0xb9ed706044c71101, 0x79bf87bfb7414d93
+, 0xba2a8a4af335ddb5, 0x32c2653cd3d58e7f, 0xa7297160215e39ef, 0x6580cb148140f4bf, 0x30cc0395700859bc, 0x0addce52e3e9449f, 0xd0af9cfd8e4746d0, 0x3dc85e36fd13656c, 0xdcb7bbb7b950ac3f, 0x0b09bd0c985613b3, 0xdf6c851ec53a776f, 0x722861ae17a456d9
+, 0x19078d35aa84fea1, 0x0b95fb3d135341a2, 0x9b9c129788b95a30, 0x025dd3459ede7a51, 0x7600aed5911dcd59, 0x0f081a445d910b15, 0x1e71681a86a357d7, 0x2bbdbadf948b4b6d, 0x321c3bf97f3f4989, 0x5736d085747ef80b, 0xb9eeecf5393ae50b, 0x1c623c522d1e1a35
+, 0x4545157ff3951248, 0x4e8823fff8a4bdca, 0x29b9fe25d955f48f, 0x1fc82e0c24fd79c3, 0xe18a17d15a66e608, 0x3e203faf47b248d0, 0xd86bcc4b5b7c22f8, 0x5a85797e13e5ba87, 0xb0ac48850085ab99, 0x4ed4fe0367240ddb, 0xd418b97e48428acf, 0x3c0760a29ba65713
+, 0x0ef6b20db96053b6, 0x39fc65d1ba8a3c49, 0x797643d23a19a415, 0x4f595d669ac81e81, 0xb6d8f1b3cf8d4ef4, 0x7f54cba87945a72c, 0x48d1a6f04b5ec26b, 0x0dce05bdbfde1537, 0xe37699f9bfe1350f, 0x631cad1a83964c12, 0xd5defe41f7332e9b, 0x3904ff618c1b2263
+, 0x8da20751b6b12d8b, 0x3efa5959246e6771, 0xea3d507ea0e17351, 0x4db0a2a0e8a36700, 0xdc92f009a8fb7292, 0x609e3f83a699a49c, 0xc20b70b112defc60, 0x2af29ddb68bbe7c5, 0x8dc8cc3269301ca1, 0x7f91b9823fbafd77, 0x61ab955c4e479ef9, 0x450b81dde618ac99
+, 0x20e9bf7b5e2b6acc, 0x70208ee81dac7ed6, 0x86c203064cbaea74, 0x4d3fdafe7132fdbb, 0x312b5de77909c09b, 0x09483456c1fdea73, 0x232d8ecf5f208cd0, 0x583654e0f05376a9, 0x9119c3f84638d1da, 0x5b01b7ab139f02ac, 0x2ff1e97722b36f34, 0x787fc2e34b878644
+, 0x8769451e4388c551, 0x6831155ba8b33c22, 0xeaaf43d5bc57bcd9, 0x3b920e7fb9058c28, 0x774fc69df7c27bc9, 0x5ffdd87c0910d615, 0xb475b67a1b1b0693, 0x4bac2e1df85e2926, 0xdd1102ca89be67fb, 0x3f50a45be92591a5, 0x8cf871b11984b26d, 0x24c82500429fadc7
+, 0x763205e0742f737c, 0x47e27bd2e76aabf6, 0xd887e156bd3e4300, 0x0de32c7d51b5cab6, 0xaca14b1e8625dba0, 0x07a7e98fbb7ed70d, 0x9017864cddd42a5b, 0x2b75159128f8f615, 0x7e9f0b0503379d11, 0x384c61338d25d194, 0x34f53129cfb01615, 0x38e7943cd3616565
+, 0xa584c8bc68d10178, 0x2cbba0382709d893, 0x442d93fab402fe83, 0x5a5c6947823e3a86, 0x062ffa8986d93d8e, 0x26e23299f9f29525, 0x0644e11c0d60d6b4, 0x1a9c0655d294529e, 0x9f230537ef7ec619, 0x4523631627228d2e, 0x26136c03eb98579c, 0x4d281694961bcde0
+, 0xb2f230db8ba438b4, 0x61428665d3660875, 0xbc03f3be3eed9f35, 0x1d582fb8d219fae6, 0xcde196568e5b4808, 0x4699d79bb8c080e4, 0x175cc24a10d9d0d8, 0x06067913e02d0713, 0x22a07aebd565d302, 0x137c891a46cf129a, 0x8df95c34932ca962, 0x6f678016b52ffa55
+, 0x309feb48e272583e, 0x467594e06ca6cc94, 0x13294eeb34350908, 0x3fe8697334f16adc, 0x50aae6925ce94fc3, 0x6c2e705c4529d837, 0xbbb5e8ebe88d99ba, 0x7e0ba495aa69dd9b, 0x86ea4cfd868c8414, 0x3317ec11e282dc71, 0x7f0bf90f63405546, 0x0f3dd53fc0f2e7c1
+, 0xb72b922dc33b4927, 0x4c8430ffa4791663, 0x3e67c90d25e8baec, 0x43943ae822fef99f, 0xdaa5788de5b14ae1, 0x0eee28f635a15e7e, 0x8b18a5582a0065e4, 0x0a04a0a56afc6a06, 0xbdf06e4fc281f8ed, 0x2228496e70cbea8e, 0xa7eb56c3159ff76d, 0x58112a81c99a52a1
+, 0xfb7db3c6c46d9ec6, 0x5d6265a28f2062bc, 0xc85ba1e4a98a5336, 0x779cd6c693578ebd, 0x9c04dd03352cc933, 0x36816971cbbf65b2, 0xa48c8a2d88485fc3, 0x5fd3496aa55667e2, 0x9b9ef59061e8adeb, 0x49b31c272e73e383, 0xd45d5413859e4435, 0x0037da61113c5060
+, 0x6bae0da6c33e1815, 0x2ac07532684f12cf, 0x7bcf4fc961983ed9, 0x0925ec4b4853b2b5, 0xe657f86c84b85f52, 0x1095ce65737b0c32, 0x0fd49acf176475a5, 0x29d7268ac6634894, 0xf657a85e8e0ab112, 0x66781f0b426b1efe, 0x75be813a7ff4498c, 0x6ee5519038204b43
+, 0xfccf822c456a9cd0, 0x37605d8a562bbb78, 0xd14e3e4c8fa31797, 0x3791acfeef9c32e1, 0x38f70db09ae527cc, 0x3a3784b4cf19463e, 0x87f7f28279b8d5e2, 0x48be8887834263c5, 0xfddc9c5d61ae4e23, 0x677b6df828661ef0, 0xbd6c7adc88effbe7, 0x155b1726d880347b
+, 0x3bde1e1124ef49d0, 0x231da53545ec40e8, 0xdb7dccb129bc5d58, 0x7c2c6b920e7e00ee, 0x1149a9821deb826e, 0x24e11d7ae0bebdfc, 0xe0ba43502ffb1422, 0x6f40002f4dd76f07, 0xaa52870011812e92, 0x11e9468496727a8a, 0x4db9dc0418541b92, 0x562baf5cb6946375
+, 0xd48df89519c6a632, 0x2989af39adf9079c, 0x589a9771dd971814, 0x2e9954be70fe3c4b, 0x2c1770fe9f52f2d2, 0x76ab0df94d6315b1, 0xf9682cb8673d7938, 0x5e5b16eecdd5f165, 0x3a2b78de96b0f5be, 0x22b177fbd227c2b1, 0x8f17e43a8a2e4122, 0x0201297cc956b0d0
+, 0xb262171f3eff2c57, 0x30106ca355a027bc, 0xa01b2c2f328e2488, 0x6072a3732ef7d31b, 0xc4d37368e5ed43c3, 0x310c8a5560e9d1b0, 0x4bee01f8f4a813d9, 0x5b2f2ff18e114831, 0xa69255b5805eaf76, 0x5ba76bfc6fa06e38, 0x51de34013b1da0d0, 0x4c13f6dc731813f8
+, 0x22025331940c0596, 0x52a91598604d55db, 0x48d59e0177340b3c, 0x2c0ce396954dd07b, 0x10af86de48c7e510, 0x64a1093c7185c6aa, 0xaeaae8ba45436235, 0x16ad9d453fd86507, 0x1b98eb656d3605b8, 0x0bb0ae9a2fa3e955, 0x4eb017a7ad2cd14f, 0x64dfad56e8ac87de
+, 0x9f3cb75abd350a5b, 0x1e37e67debb8f799, 0x58789140d10cf0c6, 0x7ba25c874fffc02e, 0x06fd779bdaa67aed, 0x787e1c98c37569a2, 0x3d66b69d7ba7abc3, 0x656cd4cef29595a1, 0xc23bab51f2ada791, 0x4e1b19d3a99aa12d, 0xe6afeadb263a955d, 0x050c7f03168d7a79
+, 0x920e845778fadde2, 0x129241a7dcefe476, 0x664cc43c1bb27100, 0x7e7d6209ae3daba9, 0xe8f868387670abd3, 0x52af9f07aa38804f, 0x4c140d55c9a4926e, 0x1ed40b68b6488e9c, 0x32e2011bd189fb8d, 0x6d5eb5be970386fc, 0xc34975d750a79d16, 0x0b7f3c74b93d5128
+, 0xe6d3fdc38a50db20, 0x19decfcb28c92ed9, 0x61163bb3dc8e76ec, 0x22390bc6d193725d, 0xbdc463c231b8e3c4, 0x3dd2a1b811389559, 0x1bafe12ceee178be, 0x627be2e3eb79a0bc, 0x625b1f1985e44fb3, 0x3468c333a04a16f9, 0xcd16b9bacb32ba48, 0x44ca091d6148a0f9
+, 0xa05fec8f4e40d000, 0x65025061fabb7745, 0x35cc9e5e9fc3055f, 0x0e7b557733b8998e, 0x10cbcdf883d26a35, 0x5dbb0503900070de, 0x198f86fbdb43ae2a, 0x3e4cbbb655258431, 0xe9088207cf8ecbe7, 0x07fa91d48a0877f8, 0x54dfb069b1417f76, 0x4f17c214501961c8
+, 0x1a637c391d0b21c3, 0x3b1daa01695ea5cc, 0x2576fd3e91834c06, 0x266217e20ac9166e, 0x79812d3ced883fc4, 0x5a197e7a787ec7f5, 0x79431af6de47c65c, 0x7d22e7767514e82c, 0x75e7fce0a80df09c, 0x12858914d0abb698, 0xa5306465a7ed7b89, 0x18416bc9c9e461b0
+, 0x00bfb316b24f7dac, 0x5ae61dd0c3be89a1, 0x4bc0c553a246a92b, 0x1a57fa13c51312fa, 0x1b083714f277648a, 0x3bafa1532d399afb, 0xfd667bae8ef0e13a, 0x634aa21ae41b36da, 0x719bfae532f5dd8b, 0x64d1b96e52b56d43, 0x92b23c76ff844370, 0x2aa7c6a0c0ef267f
+, 0xf37692764d84b9ab, 0x5f7a3c94fd4d9cf8, 0xc493bcddaa7b0f87, 0x4202952c71b5c62e, 0x37c39750e8344ca7, 0x314123216ed19d59, 0xc95f118051b1551b, 0x62e43dbbbc2d8f5f, 0x6071f1f6375053a0, 0x53c05caacfcdea88, 0xd10189e802032f94, 0x5692d0ba44ec6849
+, 0x333bd389f9609992, 0x000f7aa4ebf56ce2, 0x24394cc7f656f6d9, 0x4b6ab35df35799a0, 0xfbe59664a0cb7589, 0x769f04fdb268797b, 0x8725ef11f18cb419, 0x09a6a2d65a1d0198, 0xec1230f5a2f0e8cd, 0x38c4e20458da7c17, 0x843109eb3519170d, 0x380bf49082ab915e
+, 0x2ed36e0d5cc3acf7, 0x48c1f518b5b2715a, 0x756520c6e0cb0d95, 0x44f276fbbe278375, 0xd6cff6a7a40d1cf1, 0x7bcb7997b6238575, 0xca99facbf7513e26, 0x7e7f0f6f953c4648, 0x84b2ef739396cdeb, 0x7964906442fe1578, 0xc9a9e996f2a190ab, 0x1f98c0d78030c250
+, 0xe50240e8024301a1, 0x2b098591926b2994, 0x243c1a6702206655, 0x4db5fe2c1b38924e, 0xfc824a65308f552d, 0x4e5a5b558b97935c, 0xb4f1172628da4e63, 0x197b15b210c042fc, 0x42570ecedebb77cb, 0x28ba0d17d2c54e05, 0x1b613784d303b2cd, 0x5bf1e5f480db460d
+, 0x171f2e8f0f349a99, 0x52fefe225f9b381a, 0xd378004bb62a163c, 0x25b524cf5618bd3c, 0x6a0371ad3086be03, 0x5c832171d3a53d32, 0x17d3265c432a5b1a, 0x03e9da3ebe883f58, 0xc8309a7b73d383eb, 0x3f7386a018f0c92f, 0x3afe29077ddd9844, 0x22213fe8ec8e5c0b
+, 0x768afedb720abaa1, 0x3b0653a4c0ca491b, 0x337cbb4ad5d3c9fe, 0x26093dd77d6cca42, 0xdac094f120da0e00, 0x640a29318bb35e96, 0x2e9a1483e97e746a, 0x285086aef301d83a, 0xff078a881fb5251f, 0x6a4bbbfcfb202a9c, 0xf9ee786b6f27ff4a, 0x716e154d2b6df888
+, 0x1668a4c3de42ebf5, 0x017518647d237d2b, 0xf9015ae409261428, 0x5cde1e27affbc502, 0x7738756568ba1a05, 0x59c8841a83d835ad, 0x1a4d3af460c8863c, 0x7f25d9e05de92feb, 0x96c601b3626b7f6a, 0x5f6f0cc437164ad9, 0xf8cfba336738b197, 0x565d5fc0dbd5b486
+, 0x964df5fbdefe730e, 0x272185b07227babc, 0x4ed9529ab23ad6f6, 0x1d86ce7233880dd5, 0x478d3375d42e7fce, 0x15de52ad8bd43ea4, 0x9b29574010d2fcd5, 0x76c074feae0f0f28, 0xc4b4c2a080a72f90, 0x2b780ee8cd593372, 0xcfe07ef0016c7697, 0x723b411833118fd3
+, 0xd5dd95994aa301eb, 0x537880e71310fa27, 0x5fe35699d8873a16, 0x354421c718661cea, 0x8e5a168fcc2d4fec, 0x74be603d255b8395, 0x00abf61dc4ffc39b, 0x3370a0fe6487fcf2, 0x4f527cc6949f2b09, 0x7dad491512d2079d, 0x182538d6f306aaa0, 0x1673b692f73a6e13
+, 0xb7678dcde99d096c, 0x6ac0f8e8429a6f8e, 0x8bfb9d739248fc1b, 0x45db62987ac19c9c, 0x463838d0440d8d48, 0x3714cb3c1fb523a1, 0x60fffba2042590a1, 0x0fbf0d55b17a0b9d, 0x35d5550d92998d75, 0x7334af88575a6b7b, 0xc7670687250c6e2b, 0x377da81a621d215f
+, 0xf408d4905a7cb225, 0x4034f7867b8029e7, 0x06c648c18e043f00, 0x6d250fd0edf25c92, 0xa57252dbfeb33db4, 0x04f0c86b5f3064e3, 0x2b247a6bde44c1b1, 0x79a1d4fed7cc33b5, 0x43ff161cfcbb0633, 0x7f00471762ba40d3, 0x5d56774e1f9936ed, 0x60a00d348de436a0
+, 0x636395af73755fb9, 0x08919b72b5e450ba, 0x86f310c47587f190, 0x2413add5f216bfe4, 0x2f9b82a7cf9cce2d, 0x3064e2a973d405e8, 0xd022880b30db67f5, 0x111381cb398aedb8, 0xf4eeee7addf3db89, 0x6d06a4bb9f3f70e0, 0xfb7d1d75995d8ae8, 0x7e68629c8a63319f
+, 0xdade9c4122e21f52, 0x32a512acbcd8eb78, 0x5b1d09839dbc0de5, 0x7a8cef401c30a7fb, 0x729fb0c1a937a1d2, 0x4162063da0283c0d, 0x3e497c46e6988ac9, 0x69f59ee87bcfc6ec, 0x77dc9c1d7a30842e, 0x4db81ab37550fbd0, 0x7ca2be21f1a00214, 0x4f161810683cf458
+, 0xc2d4a9cc41f29dc2, 0x5cbfb5e00a136f14, 0x4d0ffec62eb069d3, 0x17d5b0d3f150992a, 0x71858ecd93ea70af, 0x01af7fe62157e32f, 0x822e04a45dcd59b1, 0x68501190aabd8200, 0xd84d9e542ec5a4ad, 0x667b7d9ef53c0fe8, 0x12ed1b9d09a23487, 0x23680a633202f973
+, 0x2bb9a07408b2952f, 0x09383a35166d2546, 0xf47249bbf1ee029f, 0x7ae56750aeb70f03, 0xd3af515ac9b4aaee, 0x2fe872b5ce134ce5, 0x003ea7407dd8e07f, 0x3b721516f44d398b, 0x43ec9c1139b25847, 0x79f4a193edd9f643, 0xd11e37a1bcaef615, 0x59c3bc4d8eb2adca
+, 0x53bfa95881264bb8, 0x7651f0e5c9f22708, 0x88d3436d72861135, 0x4241843334eaa10b, 0x4ec566c8de9b85cf, 0x3bd8b12488be4f66, 0x15e15bb984c16cc1, 0x220e1121d0e3b6b8, 0x235df1359b843be9, 0x3ef6ae46e6bf26ea, 0x20740db4aa86cd89, 0x09dd3e31c8f2a500
+, 0x9357fd4bfb95855d, 0x1833c5f5e64f6fbe, 0x273013850bddc2dd, 0x223eb1ac91788dad, 0xa2f8d761d4c99262, 0x4f219d5e20f06d44, 0x79b51f36caf50fd3, 0x35ee02a3a4891caa, 0x74ed20466b59cb7d, 0x6029ebdfdf054b49, 0x839e6a39fc379eb0, 0x2d21153ba45161e7
+, 0x681386e8827866a8, 0x48f31b119e013311, 0xda3d3d433734e934, 0x52d51e80ed2dc4c9, 0xf556a74f92462a9b, 0x210ba72935416b8c, 0x267a6dd448eb86df, 0x2bf7a2bb2be00b04, 0x53c2d51541968d1b, 0x1fdb77807028b1df, 0x2c63f44e14b7dc8b, 0x06f48535a21d98cc
+, 0x5cfd531d6c516020, 0x4154f2ae39245f45, 0xd1de8d130cb3f519, 0x2057d896a0707a5c, 0x22c7e86c88acecb9, 0x12a0037abbbca3d9, 0x9a54d2f14aee97c7, 0x57eabdcf1dc351b8, 0x7836d5c594dd9b8c, 0x7d99e62075ab75ff, 0x7c905ee72fa3f2b1, 0x38bbdd5ab6ed8aa7
+, 0xd5ab1316bbfa38c1, 0x5520d09d78e5c377, 0x4276e0532a43cd19, 0x2e7681f380b8e578, 0x675cd6fd105531a5, 0x05e222b5a5630e87, 0x74639f58a110ab90, 0x3291d3a839f56a7f, 0xdaf335cc7e30d16a, 0x2b261dee8c6893f9, 0x16f9755688011460, 0x02994f7997370d09
+, 0x369c0d7fe750c746, 0x46a1a8cf87ea59b1, 0x03fcdd50f2b5dd21, 0x313313601a7f56da, 0x3de16c01cf0d9c95, 0x4e6760e46491beb9, 0xe798485bfb509781, 0x21b54a1f86e03a02, 0xf6166a639abbb324, 0x4bf8f581cef3abe8, 0xc49d58f02e584a1a, 0x25a8c1974cdb766f
+, 0xd86830e6711c5257, 0x6a047ee0774c9a40, 0xb7dc8fdce2091fd2, 0x2c35cb88b767ada2, 0x1cffe1cd6a44cacf, 0x7aa77a90bed42277, 0x4dee9951c5e17f26, 0x55d79fe2e8a6e565, 0xbc7dd855f33e3fc5, 0x56e882a8630e1c73, 0x97d559e76affcb0b, 0x12cc96356ed8d63b
+, 0x56e8cbe61b0a6069, 0x09861be14b809255, 0x44c7804e678dda59, 0x1d95354a8b4d2801, 0xcf61e13e89530ce0, 0x585ae473e0f7160b, 0x3c9c02fa694cbdff, 0x22237d92a7450713, 0xd2f79f7917382864, 0x5d75b423d384b274, 0xa1fdd5adfc0efeb4, 0x232af9e38aa5b0c6
+, 0xd31078e3b07f1696, 0x1f16ad458cec0a9e, 0xc90be2e6df586a49, 0x3ec5a33460c779bc, 0xf67ed2ce88044f3a, 0x75e93dcac8f8ecca, 0x3969f95128727b97, 0x6cd5f8fe75078a06, 0x543513facb68d96c, 0x2ad758e9234cdc20, 0x679e26d75501a432, 0x749463650f1487a6
+, 0x9b56777c11f590bc, 0x5eb9420625fcdf75, 0x001ff033d75aa685, 0x7888efed81d25591, 0xf2209a21546895f3, 0x7f8cfe3564397a30, 0x3ebfcb1086525bf4, 0x668008ccf8548b6d, 0x571098f0afae7526, 0x448e1ffae3b5c6c9, 0x02bdbd3bf887f614, 0x6135c48ad74f6d61
+, 0x2b2dc8634a26ed2f, 0x4c364426fbe4689a, 0x68310d504220b101, 0x075bb65bfc2059e1, 0x748c33bafe174f8f, 0x26f2746cea9d11d6, 0xc9b4d49ac9861ba4, 0x6e77f089ea1c2253, 0x93aa46fdfbb36e15, 0x7d468009d85e4ec2, 0x8d9ba5da98bbf471, 0x3893eafae76d4d81
+, 0xa777c0d3135cd0c2, 0x240d1f566a95e9e1, 0xe1bc884d53abae63, 0x158d2a3570ad1d7c, 0xeb8808f362a79e6c, 0x721847e75e2791ee, 0xce067612b86136e8, 0x5ac3f5a6669e98c8, 0x992a762f87cab112, 0x4fafb05644b93322, 0x5ea80401e29e64d6, 0x316cd7a38680222b
+, 0x05db34bd0ed37011, 0x0adb16ba3f38e4dc, 0xa2fdf85afa275c09, 0x6f998dd200694792, 0x2f36164263205def, 0x36b406ae9b3c25b7, 0x04e04c5422a7837a, 0x17d9ee2641b7534c, 0xf2525e799112713a, 0x09a6a11378208116, 0x01700888b8665ed4, 0x1975cf7ea9a5583d
+, 0xd31be4f10c40d9c3, 0x7f0e3bbf8fdb22e2, 0x61433152a2c52a4e, 0x488bab3e77d38fa3, 0x47dbc3263340d473, 0x061d60285ba55f34, 0x86af1c37422da9d8, 0x4ab04f282109b098, 0xba21e605291797cb, 0x3e27258f7a330f69, 0xee382c54e2d944ca, 0x3b7ec732b2b28f93
+, 0xb3c5744496abe453, 0x51772dba8e3fd214, 0x770bdb048d204a29, 0x09a765805f987126, 0x186db065c8e66120, 0x262af040b0a4b1f7, 0x65f448f8e2a1a786, 0x0c52cbb6ac210019, 0x18ad2dd90c931844, 0x71277ddb419f666e, 0x0fa731e4d721c66f, 0x45662577725eb79c
+, 0x3f460afa6f613f56, 0x6bcdbd7bc334031a, 0x59c0dd24d5c09d1b, 0x20b56774855ea435, 0x7922094e0e7853b6, 0x35051aeb85f1b523, 0xe42ca5124ab39b3f, 0x12c4cc619d95fa0e, 0x746f8d9c994d2fbd, 0x29061f1752e128cd, 0xb3ae742955b62937, 0x6917cabc0802a963
+, 0xec6de4ce402fe31f, 0x425559f536c39137, 0x848cb0c2bcde23eb, 0x4ea35a88b90136cf, 0x596536e3effc5a8d, 0x2ee7f4b7b665eaee, 0x80a9ff4c6c6dce87, 0x13d80cfe60b4cce4, 0x9d83505c591c9c8c, 0x0babf26be360da8d, 0xfdc47bcf0d3f6af6, 0x7a131709e5392440
+, 0xe1d4e7bd54f7f3bd, 0x6e5d1d439d4280be, 0xfff6c242838224a3, 0x0020a353e138376c, 0xb6b6d1f540ecf7a3, 0x68ca3b110bd1dddb, 0x06185b262bd4d80d, 0x28eec2b0ffb6f856, 0x81bb504e0aca4bbf, 0x5a731542d1ad6e2b, 0x4ffe29cc0519b2a2, 0x0c0308f67a04a160
+, 0x9e2806b6283c55ac, 0x41814f979eb943a8, 0x081c2222ee1296da, 0x692806cf5971d61e, 0xfad8b3b03d5ee757, 0x482a1c8bc113c080, 0x4091f79d500d0635, 0x397f2857bd3df794, 0xeaf11c71bd55b57d, 0x2276fceb276461bb, 0xc753288a232f01ad, 0x6f270847c0f5ff06
+, 0x9d9839fb136b0fc8, 0x178226bd2a906670, 0x7c93e3c08200fc57, 0x60c9e36c11d8f522, 0x2a2286d66f80416f, 0x55997d3609aabbb7, 0x3c4f5c640839d83c, 0x5c115d19fdd2cae6, 0xae2d299e9f826fc0, 0x4d1ff058613a12b4, 0x1966981d41782be2, 0x29401ed4fbeded58
+, 0x6fd06eb2b76fec2c, 0x33a83920a52d48b3, 0xdb569ab55b15602a, 0x75a3e40a76a81a5d, 0xf401ebc8ed790a8c, 0x3e4e8c216d48cb13, 0xdb37422f944c7a35, 0x6c89eb3a76709769, 0x1ed14188c98bacf2, 0x7e22ff9a7a22a911, 0x2e1d61b834bf6a24, 0x1110bab3604aaf9a
+, 0x91f3c071a0887e8c, 0x4500ddca5b8956c1, 0xa8bfb29d846b7ad3, 0x1a00607ddb5f828c, 0x7201a23bc278bf25, 0x462c4c2c3412d20d, 0xb7b53383251612d2, 0x368e2400605dc31f, 0xd9f501f892128e09, 0x3df25700403c4137, 0x7cf7e8777e538cfd, 0x69b7c42aeaf551cb
+, 0xc2b73f3000821933, 0x1f9ff727eb06c911, 0xad53f66405b080f7, 0x31662a55d8e36be5, 0x9ecf7a918aac9af9, 0x413ada7aa130e482, 0xdd8f5b3ee145b76d, 0x1b6c0766ddc94d58, 0x2dce98da80a353a6, 0x15559bbadac30657, 0x2a37b9cd7822c61f, 0x0a6621f16663bcbb
+, 0x64ae60d34065d201, 0x405694e95e97de2d, 0xff4b5d5dd56c9466, 0x1ee2bf067ed0975b, 0xf686c2da7539b72a, 0x771a6303a4ccf10c, 0xeab62c87d57f2ba5, 0x57b1cd588bdf2ca8, 0x7b991ed257124a44, 0x2d59441621a0bbef, 0x18d49781e85e4600, 0x4a25d5d9e69f5a1c
+, 0xadd822173de2c9bd, 0x5031a86caa4d0a1d, 0x329fb81d3b0a432c, 0x02384a804700725a, 0x4d157d0dead813b8, 0x305c8ba0e58b682d, 0x9411eaccb7b0fe05, 0x07b9d2c13c7165dc, 0xfd6234c65bba262f, 0x402f773abfcddde7, 0x21b2ec50522eb002, 0x54ce7e30d64e4c70
+, 0xb4381f9fc9d51431, 0x34cc69756e9af47e, 0x9bb61bdab824667e, 0x2acc497635516789, 0x2b962d8801828204, 0x31bd41ee26dc9179, 0xbeb37035e0723dd2, 0x49729c57e94b6767, 0x95ca8610e958a74d, 0x0fd8235d7f35bf3f, 0xb9ac95347716be56, 0x203145e73920bcfa
+, 0xe7c10c7df26ae0fc, 0x0ba0844a84652540, 0x53d53dc99c86f775, 0x68f4c1cf21c2ed13, 0xc8a9572155087841, 0x3bbea66c3fdb351c, 0xb341f20aa5f2705f, 0x11a290d730448df3, 0x632b929db11ff5ed, 0x614e0dccb2fcdccb, 0x1de041962da4a5fe, 0x0c5ea03db320d0ab
+, 0xf9a221827288efba, 0x59eb94b5c7d8614c, 0x10d382784142b872, 0x6315d26238dd49cf, 0x00c21605e42b47d6, 0x49e57439da1b6b25, 0xa5d8e5cfa9e8d189, 0x620a1d642448aeb7, 0x23b3ed01538aafc0, 0x1f10a6a5d0d763d2, 0x4a51f50a078fcea9, 0x0e676dc21ef755a8
+, 0xdfb6084a5f8db16c, 0x705be5260eaf66a4, 0xb497a30b69d72a96, 0x73ea2d26cb30f8e4, 0x225cd26745b42f58, 0x5a36bcce5bbc903d, 0x1f672fc17feebd01, 0x4fe698a8abc08d28, 0xa7e5381334d89e96, 0x4b126ddb02cd9aa3, 0xc810274d14ac2cb1, 0x5fc99b31f1e32a2a
+, 0x00d19fa6f79af958, 0x308d4075b0720208, 0x8f3697ef0e4a5092, 0x2f181ad93ea3432f, 0x6ab2eb960c0743ea, 0x6b8170ea4cdd3696, 0xcd3b3c038a735e1f, 0x5e246de487213182, 0x64eb0c29062bdaea, 0x15cd2aadc96ad6af, 0x3cf1b50964323ff4, 0x3dae8a36c531b85e
+, 0x8ee0201de6371ea9, 0x2065c48ffee33c40, 0x7b8b419713eb1646, 0x662871d4f5d88ef0, 0x948aec1ecaa27950, 0x1adaa3473faa8698, 0xb162555e4271e12d, 0x72cff5ead70400dd, 0x7e868267c04c205b, 0x583490f3d53d1ced, 0x45cb1a699c6bb8e6, 0x47dadd1349935f0a
+, 0x7635eae9bf1e26ed, 0x36a2cd753bae2d57, 0x30cd0b6bf4727c9d, 0x5b70a6574e506133, 0x1cdca71c22365b14, 0x6f45ad9ec4452055, 0xd1c32e8f22aeaba5, 0x573b11396a31a5d1, 0x4cf2feb16171ea83, 0x031b44390e5977fa, 0x1e253d24ac8ce79e, 0x13cd65d8098dc139
+, 0xe8e5e2af51c3c520, 0x5155f8b4e4a3d601, 0xd23a8c2f3e46f2ab, 0x3c7c6506b46a2ee1, 0xc4f74792cedc1e5b, 0x55688618ff4c32b5, 0x771ee4348a282d97, 0x5f341aa1feb29e51, 0x2070b68d5cb044b9, 0x3f839c3e043281cb, 0xb682860bfc188b96, 0x4c07ded6d20cd9c1
+, 0xd18092f863f62d0c, 0x4756fc741f53039d, 0xde6dbea67a907e58, 0x326cf744975181b1, 0x7fe5f4bffc5da40d, 0x531b58c6553819ff, 0x1081d882c59fec07, 0x7e0fbd63fa854ea8, 0xfff7cc5a969b0b23, 0x1997ab1ce3ec53a8, 0xf4698810f281ee1c, 0x58547f15f1c9120c
+, 0x9dff7315b0224fdf, 0x7688091c1abe8e4f, 0xc035d3ae2b7f9106, 0x0d8a5a5e9cb3f73f, 0xa4515dbc516f6f8b, 0x4f6260f9e2f34319, 0x0ac626e3d33a0111, 0x7b86ecf2bd97c877, 0x53a81d03ce69a0a6, 0x0ead5f76fd4629e5, 0xb95df737689d2dec, 0x48ea407ba212d682
+, 0xe62750e66edeeaa8, 0x57c2b479df011ad3, 0x037f20be2f46154d, 0x390f94b50a152b76, 0x39c9b38724454da5, 0x65d72d4f220dd2fc, 0xabb9b02415edabf2, 0x6109d393302d8152, 0xe2995b744ce87dd1, 0x1bd5c96c6426add7, 0x6a3d8dfb5dd9749a, 0x59e1929acd84b914
+, 0xfd9b876fe779b3cb, 0x3cf5d1234834839a, 0xdb4631742bf2ec9f, 0x06797ea38d6158dc, 0x95d75ebc69f226aa, 0x233ad46a5925c366, 0x7d5308997ec1e88e, 0x32ab6f7efc063c7b, 0xd41205b42ff4af55, 0x5c310d8c3f97fcd5, 0x36c9c40e63678f52, 0x1399e39559ecfd37
+, 0x7a4a131da7cbf880, 0x57f17555c53c6361, 0x04f33ebc9b49eea2, 0x70cb5d454a032c27, 0xe086a7ad521d560e, 0x034b548016faa1d5, 0x14f7b2cffe8e81e6, 0x072b36f81775f4e4, 0xc25bd3da55e458f4, 0x1b88e96281431296, 0xf3a765e665c78b75, 0x351c3088ded05106
+, 0xd2d0956ba1f16f0c, 0x4cff92d4a521cf62, 0x47ac98ffbff846b3, 0x463312ec36fb321d, 0xffa1cb5638361006, 0x5364df39888e71ec, 0x33bbd73946876a40, 0x6462572c4c4b8222, 0x18190799f558e22e, 0x0c346f9b0fa989a2, 0xdf715e51d24deb19, 0x01a536ac11bc99af
+, 0xc9a4235e3643079e, 0x350a1c71140258df, 0x2dba641c7a89b201, 0x460537a48c32ebeb, 0x428321ad9824404d, 0x11603e385cbf557b, 0x043d5e4098cb1682, 0x4eab2456f04c41af, 0xd8863e17c4c22caa, 0x7841f866c93cac0e, 0x681c139f3b4f796e, 0x49d69321cfd51f6c
+, 0x84d3f2c08b9dfb54, 0x10b4cdb665ce76af, 0xc18393a5d1d082e5, 0x151824fbe71ff1fa, 0xe4bd5d8f534b5e0d, 0x72e20ef9cd5cec2c, 0x075cfaa5b1172b9d, 0x6a70441f6ad2799e, 0xb9e0bb8ac5048620, 0x25610e0256641594, 0xd0a4b2ac401366b1, 0x74f143995232bf74
+, 0x0e10803d87e59fec, 0x05d52eaf4e11159f, 0xca91a4cc8229e106, 0x674f4bbd199f0104, 0x8710eb7e163cc0cf, 0x22ebd4a372ecb9f3, 0x8fca6e274737f9b8, 0x6b507718e4a3c0d8, 0x85d30ec45893655f, 0x6d590af96bd309f8, 0x7c346ad2ad0909d8, 0x15862b935c06b5e3
+, 0x9fcff820b8d2b084, 0x68fdf0a23c13a8da, 0xf850221a4cd8e198, 0x1afda0a793cc9c50, 0x1e1e180c0c3a93d6, 0x3e886452e259700a, 0x93137c1db80fbaad, 0x1cdcbd03b2f6d6a5, 0x4e929a498b1470c8, 0x06399c29a2766581, 0x7f58d0b6c88e52e5, 0x223ebe3290e27468
+, 0x0c2de64447a21579, 0x56f351affbe1a9e2, 0x0899a3ec4d8e0e4e, 0x7fc78d464c296f52, 0x25237cea9a242c0c, 0x12fa2e9979a1f4a8, 0x8e97e9b03ac9cc46, 0x72a4bf51afd7406c, 0xaffed53269b8efec, 0x442cf4d63ababc56, 0x79eb3697e6aff29d, 0x73f6806e3679f7f0
+, 0x509a4ebe4b5feb03, 0x2ea896bcd7a17e3f, 0x6a8c9b46397fc9a0, 0x7e817a051af4992f, 0xa1b9f39cd792efb9, 0x60d7c3566c94b35c, 0x87bfdc3fb45d1256, 0x016072456b4c1446, 0x70d78a84cc33fb55, 0x648c6f5bbde14609, 0x579b8b1befefb984, 0x4ba1f24f2723a9d5
+, 0xd825c4869807d17a, 0x43e230753b38c7ba, 0x1e43d0ac2ef67c84, 0x48005eb5c1513d91, 0x5a0cbb28df7914d3, 0x0406e1ec02fcd8d4, 0x625d28b852cac434, 0x1c01ecfaeb9b856d, 0xb2847e7a5db44061, 0x5e0fe4ee57f28d06, 0xeb7df8127aaef22f, 0x4cd0d0189c925d64
+, 0x0d45a054c1d937f5, 0x58627a5cece77b57, 0x12d31f6b4c172025, 0x3e49ec53c83610be, 0xea2c42ce74636364, 0x79fb37e2a68f131b, 0xce3a9a07260fb8e3, 0x472a5c210c3c4820, 0x31cd6c6ae1867718, 0x08199fc6eeb09b1f, 0x11d41c952ba0f0d9, 0x46b9646a43da9da4
+, 0xbd70702ba736a498, 0x6daf244cbf22de5a, 0xa415225aae685b67, 0x3637b617ef7440e9, 0x6e3ee33da9236f9e, 0x1bba0f38850308b3, 0x504015addf3ba5f8, 0x19343e9651f505d7, 0xb54d783080dbfde1, 0x1020c1eca0233ee0, 0x918c5f9b3b6050cd, 0x6b3d77752be96bfc
+, 0xbdf0d036dea971bd, 0x31f2776c792b9c48, 0xdb15752d32cb4974, 0x5f0915e525003e9d, 0xfbf3b8b03b255640, 0x0642d74ab069e7e8, 0x388e4bdcbf98041f, 0x061e107702e7b237, 0xd1f3acb2e0921d94, 0x17617d8741d1fb96, 0x0ebfd501fd6e0902, 0x7ca435b276cbb59d
+, 0x591f97bdaca4fea4, 0x04c7255fe977ac28, 0x76af7c5f13674679, 0x4444a3b2d88208ed, 0x905ccf8d11d3b713, 0x4ae8928111ec76db, 0xf33438b2888401d1, 0x0c3601b3320d1ff6, 0x985db43edcf5516c, 0x1d230654b0c94ed7, 0xbfe61c2c8a650c68, 0x742547fa8291d4d2
+, 0x0e688ee8147bf1dc, 0x3b05ba6ad21caa61, 0x6e027f0c789e2d18, 0x0d53e2f573cd5351, 0x35783bd6f1d74868, 0x65c04369dec7b8f5, 0xbfb572baffef5b82, 0x1df32bdbee4ddb61, 0x6b5b402422a515ae, 0x36994fff46e4d224, 0xe7663c101a5c6cee, 0x4a26273604de5bd1
+, 0x369ef6ced314532a, 0x742590bc139a6ecf, 0x648199c95428dca8, 0x399113cabcfc844d, 0x3805b8580fccc3e9, 0x6b532199bb066000, 0xf0750edeeca216cf, 0x10cf3122dab6da23, 0x5c98661d07c483d9, 0x369a3c0352db821f, 0x65c27a804ce66137, 0x503e42bdfdf3c19d
+, 0x0e66ad991bfa3abe, 0x3ba586e62ad78918, 0x60aa95d8251b90d2, 0x5195c21509b3a12e, 0x5b695d9f735b5862, 0x38e4a57998fad170, 0x5181c5231750ed34, 0x0ae19f9406167427, 0x3d5857223b136889, 0x6fd53472cce1f090, 0x94e3aaee036b1bf2, 0x12ef9907054335a1
+, 0x50fa70e677b0433c, 0x5821e77c213eefe0, 0xeeff9093b9d4dbc2, 0x100b7ce029c1463b, 0x03cc2115c785785f, 0x2ca896a18782ea97, 0x250b34d2ba86eb70, 0x0deeddc1399b5ceb, 0x2098c7ef85590468, 0x5acb773a0e003bf4, 0x1f39ebaac1af1684, 0x44ee4515e0ae4244
+, 0x8f2985c7e7bd8f99, 0x05ddb71fcec93740, 0xdfbb2c46e41894c9, 0x7d7b6a94c871fade, 0xb5d7607d78ce5467, 0x27c8200e88b7be2a, 0x92828768ef4364d0, 0x53430b93403c6ccd, 0x0d9291e805edabc0, 0x5a397fb66e4c3401, 0xd3a04f780a76e5b7, 0x248d8e6876797f34
+, 0x6dc79d92ed7fac61, 0x1c254c58c8a6fbc2, 0x7ee047bc4a73b984, 0x2e17bc1615cfb1fd, 0x400d65b6a819172f, 0x1c680614b2ab0e19, 0x92c950383be0e9f5, 0x0995b6638f5d7438, 0xb189ec90f7ab04d1, 0x01c09d890de70aff, 0x9ae2c17fca28b0b4, 0x3e8aa0886556b5c2
+, 0x3f98ada38ab55cfa, 0x6e973b7d01903332, 0xeb2f68703f177256, 0x08f4122dd4170306, 0x5118bb9a69f7cea6, 0x344379645ca65640, 0x2879ff9847e06afb, 0x719269b99e4101f8, 0x42329b19326d565e, 0x20618ed2400b8b13, 0xe40647cd055a4ab9, 0x719fb273b51648d0
+, 0xee53a76f5edee12d, 0x2faa5ddf2202fdc2, 0xa5d86fd8e6d4a2bc, 0x0f0653739fe21527, 0x5e33f212e1de5e8a, 0x55d88d4034195d46, 0x8b912a967aaa5eb3, 0x1e65dd6931ed59f3, 0x0ea8fc086dbb1a27, 0x2d603cc352b868b8, 0x7ed17c0c362cb503, 0x2b3d31c3b45d8195
+, 0xa5315a0ad732ee1f, 0x7407b5ea87add990, 0x6d138995988d0b42, 0x7b1baf0b9bfe1dcd, 0xf44b8b9b08c0c45e, 0x04597d706c30cb3a, 0x70755a283f676536, 0x00306e8ed5a457a0, 0x04f2efd99a5e33e3, 0x3a034a25cd851445, 0xd1fac1dbec36f555, 0x2221ac4550554766
+, 0xa89edbc67e5afbc1, 0x17c70374d175705b, 0x5bda42e227516362, 0x13d8c0340ca04869, 0x88acdb419c32c495, 0x2d77797c0ed93f69, 0xf788a4a69cfac7f0, 0x6bd7c533902e2cae, 0xe78d139210f74851, 0x2ef03294d83899bc, 0x5989ccb19241216a, 0x2db63d660346cabd
+, 0xd051ea03dd38906b, 0x7a3d102d096d7206, 0xe9a607cbaace5fd1, 0x7e2eb978d90ef7e0, 0x4f12271de79d396d, 0x163618c141781c2e, 0x746a463c0b056077, 0x3b23ca6d0f06f8d8, 0xc3cc0d5dcdd784e1, 0x12c40b9662de4449, 0x4d4488895ed2b103, 0x620f28831e389bcd
+, 0x7e2592ecd177c75a, 0x416b1cb4d5645936, 0x3d32e4fd16bc2062, 0x63408c8f1c3b204b, 0xde282b8348a0db80, 0x3c515f23b76fba83, 0x4f96a06ebab30034, 0x15d537f8b8c1c331, 0x0b010665386ba9ec, 0x4e7e38a4a5d3a102, 0x0f17b1500d76ceb5, 0x5de98354169b2ae9
+, 0x5582d1550c02f792, 0x4fe02ca115ad034a, 0x05a4d94112774790, 0x49deb9df2eea1b8f, 0x5e7631ad9df9c8b0, 0x5aedaa96705ed7bd, 0x017980726219bfde, 0x1104b79842cf21e7, 0xfcb20b4d3f963204, 0x2fbfb626e997461c, 0x1cd410a4645ce2c4, 0x46acf35b755aa9bc
+, 0x94b470496bb0001b, 0x400c01be26b13888, 0x0c20fe72b952ace1, 0x6e80f6cf2472170b, 0x4127d803983033e1, 0x4d6946a07ec23603, 0xeb20f5f13294dd72, 0x47076dc1d96c361a, 0x476a967928517da4, 0x148da98eb694beb6, 0x42b577709c4dbddf, 0x3f102aa3b7b76cba
+, 0x6afe44335880c5c7, 0x6440bed2af35ab6a, 0x7d18dc3cf3216106, 0x073ab739fa28c5e0, 0x122342f3f813fa09, 0x5ce7799ca1aaeebb, 0xe651c145d2d15437, 0x71bbf42ede1097c6, 0x8dd3bac8b50f6a86, 0x254ab6e1d6b99d63, 0x181f69ecd9b9cc2c, 0x3bfc79abad993acf
+, 0xfbad58d6e7644b9a, 0x314ba59f912f08f2, 0xa628f781864ef80f, 0x2c6972481f22d07c, 0x4a2880f5535f1fd7, 0x55165471b002c0f8, 0x781513966da02eff, 0x41f0aa082ac4283a, 0x3ba509cfd690e090, 0x3b5ef964ded83883, 0xf359c449ebfe0e50, 0x3d8fa70933871e5c
+, 0xfaf9727117b07b85, 0x5b9baf006e21f4a2, 0x5bd682e44b1c6736, 0x1485222ad6b601a2, 0xd08de5c1f1c2dc74, 0x7c4da3bc57381f55, 0x710be39ff54947a7, 0x2b1d581b3f9df9f7, 0x7df6b02324490c01, 0x1415f8667b6219ec, 0x3acbe2f823db296b, 0x5830791009dd4dc0
+, 0x40de026c230d308c, 0x426c8e0960cbd3f3, 0x1a8362f9299f1b27, 0x1ea11a786ce45188, 0x8d02f888ec519d23, 0x20768cea36d6a23f, 0x64c6ac8418ee7435, 0x6a0d0a96ef3b9f81, 0xad930526c0aa5c9d, 0x0ea3c5c3a2a26184, 0xfc288a02397369e8, 0x5296cf5586be08d0
+, 0x3e55d5f5899dc7ee, 0x4a49191f4c7bbe5d, 0xaca74740c6ed88ce, 0x3885207769cb2b45, 0xf80c7e1b59401800, 0x52fc97698c64e4c4, 0xdb9b044580940bc9, 0x7c63600601ef80ca, 0xb05f3fe71b3fbd9b, 0x7d926710def43804, 0x9e2501142d4f8b22, 0x1bfb83790521da09
+, 0x87534b5a582d2ea9, 0x60500984ded992f2, 0xd25755bf7032e74e, 0x3fbbc26c895a1e84, 0x5b977203b0851a47, 0x38ee0bb799ab641d, 0x399105e6a8f01124, 0x0d1cf3d4f5224a95, 0xa5ce3eb14a5e0e2b, 0x785465e9b2f9ee1c, 0xc9594489dcc3410a, 0x26483a6d888abd85
+, 0x35f796c6b15d7303, 0x7327e963c5ee694e, 0xb5f745645a88e9a3, 0x7bb53c5f9f88da4f, 0x35a0f5c0a1bebf8a, 0x7c7e3a564aeb1929, 0xce23b818d0a3dfdf, 0x0b5b8000b22538a1, 0x57dcb1a8ebcaa5d2, 0x503203a6629640ad, 0xd5de2e0e4a7a8b75, 0x3304becb1d83d08a
+, 0xf6fd5d5b813e0e95, 0x42ab22164f1e9b17, 0x5af01abf8a0cd75e, 0x5d68fd6813738c29, 0xec50bd6039b2b5e3, 0x22657a3263fb3b1c, 0xa04e6b7c90d96892, 0x7f3a2076a2eaa5a6, 0x7e92ced06ca79060, 0x065f7a4d136156c3, 0xf0f9c03a0065fd32, 0x3a056a7c016e18c1
+, 0xc732c8dbd64d60ba, 0x2aac121aa77d098f, 0x4325bacbc19052a2, 0x3e5c1a499287a754, 0x2d6deefd3888e5bb, 0x564b99df13963a17, 0x3a6a16a723e09bbf, 0x7e4d5134c1c5326a, 0x22a74de92d2a4d8f, 0x54742763f2ce94a7, 0x2d910ae444c294fd, 0x6007f288cec90c3b
+, 0x67000d950444bca5, 0x43285b33544bc4d8, 0x3f51966c3a0cc08e, 0x0d84d8ad40b23b13, 0x52e2835cc432e3c9, 0x28bdebc53cdfddf5, 0x98e88ee7ab0258a3, 0x79265c9aab6a3713, 0x0d9595eb441009ad, 0x5f053936b4e7737d, 0x94ae9062d9aa79d6, 0x3633ef3f2584dce5
+, 0x6fb200c4b2936851, 0x4765f4067f0bb7ee, 0x1edda45947c48e3f, 0x6f3564c3d069a43b, 0x2e403c75c6cc8574, 0x23426ff29600103c, 0xe9248969479584c2, 0x514202419d0dae76, 0xb22e34a743050522, 0x5dc44b84bdc2d5b2, 0xa550a8cf2a29e456, 0x6bc3195817625c5b
+, 0xd19d5925fc6c612e, 0x6923a141ef01b8e1, 0xe8815b777f708d4a, 0x05ab9e45d115d1b3, 0x563723f4c45206c9, 0x3982e477412a7698, 0xd8696e430983b434, 0x554a59d1d6ed1c07, 0x8c6638f92f97e52b, 0x557ed70ddc0b9353, 0x85cae78f231f895c, 0x41a763694c275ff6
+, 0x07c00d2e8b3f3aed, 0x5512c436c574db5b, 0x14936215da608fb7, 0x5075d0719d450512, 0x11f8d7a16eb47c12, 0x03a49d6732b1627e, 0xe288183c4628e924, 0x54112e923d87a681, 0x10ae5a711bc4f78a, 0x75181ac714a54711, 0x8368f1024ad97ef7, 0x1bc6bf5160cb0fe3
+, 0x45546e49e4321f56, 0x492a9133ed46024c, 0xda2e18427d75f7c9, 0x398d255ca381765d, 0x515aca03f9f48328, 0x3c6a3b2d1eb61691, 0x8bd0b12c45d04cc9, 0x4e08f2fcd8e6baf6, 0x4bbd591e8f79348e, 0x50e2d04732dca35e, 0x7dc40befd55a73f3, 0x15882550e3b8cd4f
+, 0x8536ea6115e1700d, 0x796108384a9fbb27, 0x3a198719845cc1b4, 0x76e8e1b14deaf2b0, 0x7f4bfcec94001122, 0x4b8342cc9136021d, 0xb32bea070f2fd4d8, 0x6b7c9bf5b887d5c4, 0x25a060c4d15b2689, 0x30c7d9eb20f1b7fe, 0xf0678604d12beeea, 0x2d1aff483619d960
+, 0x911222669cd1cbf3, 0x79a824fe623fe76f, 0x298082c5484fe4ba, 0x5c011734d6f59f52, 0xcbb7413e96155535, 0x1c5351b388194cd6, 0x917aac1645c607c1, 0x4423043859282bba, 0x1f442fd4badba2ca, 0x6eeb914d84cfc644, 0xe893a23abb2f8192, 0x0a16da2e443f8196
+, 0xd350cd80b84a8fab, 0x3c697b36592f63c3, 0xc62e0dc7dccc3cf7, 0x51f20702774b87da, 0x0f70fc35599bf24c, 0x251c3f0765cc4741, 0xc07ed4ad53d9dc11, 0x58b5925d160637ef, 0x13dff426ac2e9a79, 0x04d954dea6ab1973, 0xc4e469a2cfef8565, 0x73ee03cf20cdb564
+, 0x962a7a705b471169, 0x0abc98407b9255a3, 0x01bb59657fa73520, 0x33c5a3c7021e7f68, 0x42aa1ef17ddbd6b8, 0x78949e651409b464, 0x19cb7f224e9eb9e5, 0x106d25477703e320, 0x4016535122a213a5, 0x76491738743eb8d8, 0x366046f33c4b2f83, 0x1b6fb174117e6a1c
+, 0x0ca11bbd46cef834, 0x0dc9bb61729a941c, 0x3da8601b45a48c27, 0x59822b68d73018d6, 0x704ee85a5b4f6086, 0x1aeac93b3ba0f3cb, 0x21300fabf1f1b620, 0x5be51bf191ccedc5, 0xc9c3ff722d7dd5c6, 0x096879ff64390ddd, 0x5a2fa0128f4d2430, 0x733d1809914771e6
+, 0xaba26a33c91f6b4e, 0x608c0ba9538711b6, 0x6fd6ec0b3ad2638f, 0x4cd7995a69c5d6a9, 0xe61cda2b231ac127, 0x2b5fcb9b8d988ff3, 0xa3c2cb7d330f2c71, 0x471356f61f06e03e, 0x036a8e4915108116, 0x548dc80493a5c0b7, 0xae32781cfaf30367, 0x0ac4b7d6b22bb876
+, 0x7e384f31b6237574, 0x775accffbf27c0bf, 0x85a6701cde45f75b, 0x383589b356159a68, 0x28c147c244be8dc3, 0x121c6ac423e2a1eb, 0xc42dc188d9f29dae, 0x185b9aade986dad6, 0xa00422472f19ad40, 0x3920e7683a7056c1, 0x7700765b5014b564, 0x4e4243b4f3b25eac
+, 0xb401b32d8372dd25, 0x5852f83e5d07e100, 0xac2b231511508109, 0x2e8ecee5acc67869, 0x834f11a729b610a5, 0x4fe92401b5c44612, 0x1ef6fc697c9e5983, 0x1c6a25c5f63d2122, 0x8e14a2a602a90af8, 0x0e4ccb8ef2e4b7dc, 0x6c4878023663735e, 0x454fe37d22fa37e2
+, 0xc15f37017ff9f873, 0x0ec651c355617f56, 0x47e00b491af4ccad, 0x68e5443e5ae5afbf, 0x0df536e6628781e5, 0x0cc91015004d364e, 0xdca6eee3fc2f7cbe, 0x5e9e232452e39880, 0x69b854b97667f37b, 0x74f4a4ca91a9a205, 0xca477957004930a8, 0x0f0a6fcec9863000
+, 0xb2f0bb694675d6b7, 0x5add0dd49f63cc45, 0x42bc2f36cb2cb64f, 0x0745770de554baab, 0xabc12ce5eeb38680, 0x21d7b0e1aefb163f, 0x8268d7f7551d0148, 0x41560b7bdbb853e0, 0x490ceb0119caec28, 0x6c5b6cee4cc46834, 0x756db5f42349ee0a, 0x418c8b9d3fa9f84f
+, 0xeaf8a84b6126e53a, 0x642c69733df6121a, 0x26fc94ba17a14e9f, 0x34039d6b61f15ccf, 0x113bdfb37c897c23, 0x39185785e31edc47, 0xfc35b20b80850dcd, 0x69a40c24ff2708a9, 0xe92b6a662f22af23, 0x1edf149e1516937e, 0x6f285a316ffb40d7, 0x24a9ed3d1bbeea52
+, 0xa18bafb242c23490, 0x05d3c8c8516b7d54, 0xcb45fae8e2ba8d1c, 0x4ee6450bfe1bd4ed, 0xaf88e78803d823f9, 0x4d96211fba30db1b, 0x9781ac853b7da923, 0x411b41801dbc025c, 0xfb84f9ea29a643fc, 0x1d7439405fe9dd05, 0xe2483d3a1b5514db, 0x6c0a8cb4b0b773e2
+, 0x7e8649bd84fe07b9, 0x2c81da323795c237, 0xded55a33c4378fb4, 0x65eee5449a566842, 0xb3df413056c04662, 0x7d3fd53b5b3547a6, 0xe82751bb6a5f5405, 0x241be1942361b0f5, 0xc1b55a471400fea7, 0x5344ced29923ad6d, 0xc4dea1e3ced856a9, 0x10a930dc27a1a663
+, 0xe17dc46c8b21f62b, 0x2dfdea03490fae78, 0x8fa9504df4656557, 0x7067f1498ac0f21a, 0x742bbf206d24d127, 0x2ba2ab3e97ca73bc, 0x606f0ab24bd524a6, 0x0e39eb7af47255c2, 0xf6f09ea77ad84bd9, 0x1961b37fcc4220fd, 0x6542a7925e076176, 0x18b1c6ea15377331
+, 0x0992fe7eab001096, 0x512c706fb2d9d040, 0xab1aa6c3e91232dd, 0x3c6d146c18f397d2, 0x294c92dc22c1252d, 0x3c52351482812ae2, 0xbf400f13522d7566, 0x2ac9ffc0d4e44866, 0x500730da1445bdd1, 0x5f7bf5bed9fa5bbc, 0x65297f3eabd6b216, 0x5c5aac320c4c1f0d
+, 0xd75b7ea44e8405bc, 0x021b25aa0bd1e3ec, 0x70fe87c7c33fced0, 0x05f2d3928470bda8, 0x87d91d86886b6764, 0x35ad00b2071effaf, 0xf26d5066dd715f88, 0x20fd2bea53e403e9, 0x394df4d8a8fa4f44, 0x15e1ff3c56d280c1, 0xa23ed0e70e92bbbf, 0x4222af365fad48be
+, 0x403433d347f0b9ba, 0x794eb5b00203be64, 0x4634f05cd15a57ef, 0x1df0736729a31f44, 0x0f265cbbce880657, 0x1353943239848347, 0x284521d4b0d5855e, 0x631716d3651d9c03, 0xfb09ff9ec337a90e, 0x5c732d67fa024864, 0x752f746b2f951865, 0x015c3c7e59421444
+, 0xf61473588d5e33f4, 0x2d28c3a6064438cd, 0x55dbfb89a7410b67, 0x1bfe641d8d736c32, 0xcd6646a3d60b6bfc, 0x1dd5894750950947, 0xb5ad2ab2f3a28a74, 0x2bbfd7b6ec7d05ae, 0xd85b49c0353e1e24, 0x7b95de17ccfbef34, 0xc3c125bd1623c5f8, 0x746cf9f6eca9ae82
+, 0xb86bcd8b3565e7b0, 0x13faa6974827845f, 0xa276dd8a7501f50b, 0x4a30c7e45a1c011f, 0x6c18dc7cf42f812c, 0x5a00af57712b5fad, 0x7bd8654d6c641faa, 0x455307d3aea71b5b, 0x54a560e3501c0dff, 0x2af13cea2d6c92c1, 0x785eb1dee9626f1b, 0x0c9234075d6fe367
+, 0xc2bb65c453aa4b24, 0x333a88fee9272bf4, 0x4ce7fdbff2df92e1, 0x6d8107114cdf707f, 0x8466b96438ad2fe0, 0x47b5aa097db68a76, 0x5080952f76c1f265, 0x0a887e4f5eea603f, 0x75b2a454bca1540f, 0x68b35464c2f5d6be, 0x9be5196524161e3a, 0x6008cd49643a995c
+, 0x2c673962a7ae558a, 0x5c042d28d7a0d2e8, 0xd2ac92879d32a0c1, 0x295d81e6cefdd826, 0x014529a2fc01c71d, 0x61295b2f34dbdd79, 0x2036ce3d95fe1c66, 0x00e79bd8ac1ed29d, 0x8cfcbd20c36ffaa3, 0x7840a3420cebcd8b, 0xaab3c00a1f4e09df, 0x0c10f2a2212c83a4
+, 0xbd960a9b7d968e71, 0x1417b75a09ae29b7, 0xd2e445f201b20651, 0x32d27bb6550848d1, 0x68e329a4c410d0e1, 0x41e4f010789f8bef, 0xe8a23b7423eda19f, 0x087d17156811c023, 0xfd1a4be2f542c8fd, 0x350970f7ac1aa67c, 0xbfb180f123dbd335, 0x1ea44a2449383873
+, 0xa4830c2d72ccd105, 0x4c3aa56807f59b10, 0x2288f96509a60a06, 0x39b4ae12c09bdb4c, 0xca67172b7966968b, 0x42eefc26cab81fe0, 0x40cb09cb6c0e2a17, 0x7d88976e0b91796d, 0x01d90edf19b65ab6, 0x2f89c16505f7e4d7, 0x33bd591b93956176, 0x50df1bfd2b387c1f
+, 0x8ec29eedd04d2c74, 0x4fb07cad7c25dcf8, 0xaea73522f45ebb0e, 0x6697474207138102, 0x3e0cd20b7323109f, 0x596f16815795c15d, 0xb7e0a381c88ea64b, 0x0d85e77a8d4cd9e6, 0xe1c6555f29fc1e5b, 0x7469957fb4a775c8, 0x76ba9ecd6e5f4488, 0x04f2ae3e36769795
+, 0x793f7d43820cd258, 0x65f8d3991c463752, 0x62c8ecaf07a1f9a2, 0x61d6dc3f5f716e80, 0xb54f03d2b73a4ee1, 0x2f73007a22fa6eb0, 0xbaec139a705d8d50, 0x045a5a3d3f9ef458, 0xdd38c4d985f97b1a, 0x287e25ac40729976, 0x9cc6da857f7d7856, 0x5758ae9439870471
+, 0xcaba923c9f0992e6, 0x5e132d456b3963a6, 0xb45421210df78faa, 0x14ed97147794c403, 0x5d44d5455979992b, 0x35ad964a5c48dc9b, 0xb817dc6d4423fdc8, 0x06a50e120d191575, 0xa20d274482d27c90, 0x3cf5f68e094dae62, 0x17565f07d44ea696, 0x5516b419f7bb0714
+, 0x5c0409cdb3f4cb88, 0x142071480f6b7ab3, 0x75518052c7c189e0, 0x3004edfd6bce62e5, 0x5c53345f8eeccbd4, 0x3d4a95f8de5e854a, 0x2c4c7cb5d9c5c749, 0x6e51cebd80a9ff5f, 0xc1fc1a2bdf8036d7, 0x4f1454bea4450a3b, 0xc04bfa50cfb4c856, 0x2e3253abfa71e91b
+, 0xff0ac77deb423c7f, 0x4428f8db253bfe0f, 0xbde75f34bbe20c5a, 0x02425b898e64c177, 0xd3b7982d90f7b9bc, 0x66783985e9600279, 0xf3b17fedabed7e7d, 0x11b60d90f11a4bf7, 0x0248e5100aa3d912, 0x23b2b5ade7c82e15, 0x5e23630d49ba1a86, 0x28653ef36d6e1307
+, 0x6b05827c51d8bd1c, 0x684fdfcc18275065, 0x0e7c9202d160d6f6, 0x45b72c799dd6f5d3, 0xc856f6bd72a97438, 0x4c0379bb793115d2, 0x115484675f311914, 0x02dffd46c740e657, 0xb44f233799fbea58, 0x7b1ac938f86d7057, 0xc6165ce936af5c2e, 0x05b4bcb63efb02db
+, 0x3d015c020733b271, 0x1a2ec9e69032afe9, 0x4f457a0fdad973fe, 0x61671eb0b8e59a94, 0xae9379a129669e39, 0x7fffec766a873aed, 0x14911ec1afcc85d7, 0x12e9c82ef2a30e0e, 0xe61084de806812ea, 0x7128a8c1b89cfd3d, 0x1e4ce203694498e0, 0x13ebe6899c0a5206
+, 0x35948ceb2f47068c, 0x403133771f9d51be, 0x9e0e3e28f3c3dcca, 0x760719db23e44174, 0xd891c411aad5d78d, 0x108785466340c58b, 0x25578162886d417b, 0x5d6a6761e3245ce1, 0x5e7bb11f36405f2b, 0x71e8b012d1926672, 0x6189bfdbd58a344e, 0x628c8c58743689c6
+, 0xdb04918712129663, 0x1539e341a2d96971, 0x45cdc3fa11c92400, 0x450e9f5579e18ce4, 0xfd71f080e9691f8d, 0x31b4ef6710c9aeac, 0xd9f1c0dd7066f51e, 0x0cf62032cefc946d, 0xf028d27eac349fc5, 0x157ea41efdeba6eb, 0x8a31dd9950fd1c5d, 0x2fb0a5bd2fb3d104
+, 0xd53e59e7ee2e6483, 0x6ac5a77743284d0e, 0xea531a29730dcb54, 0x40f8430e3cf4a905, 0xb6457b61a0310635, 0x19bc4d9c1108352b, 0x5631d7a51abfe9a7, 0x5a0625a458b26f28, 0x276aff819f8fa638, 0x3d8f6955449ce166, 0x2f55d62bc2eb3375, 0x3c2f2cfd0f79b25c
+, 0xb31f14d2bc34f8d9, 0x535a233df198446c, 0x8a44b40981f6dcbf, 0x62bf3063311449b0, 0x2047d9582f701bf8, 0x3c0fdfe0cb584a6a, 0xbe184053e0a205d1, 0x08e9bbf1ce15cd3f, 0x45cb5b968acf85eb, 0x1ded284b66299314, 0x912b49bbd538a0c7, 0x714d1cdfc930f06a
+, 0xb275f689164d874e, 0x590142caeaa7145d, 0x686a869a9501e3f3, 0x43d06128a308dbb3, 0x79d3960682d44ebf, 0x2928af4305154c5f, 0xae3288593942c77b, 0x6e41c9b046bafb57, 0x326b11acd01b4b71, 0x0e16fd6e69d01708, 0x362b8deaa6ed9cc9, 0x4cdffdc2d808fc64
+, 0x11d84ef2e51fde1f, 0x31b36761c4d8c610, 0xe560006832abe98a, 0x1e49dfee0074d265, 0x830555fa9439b68e, 0x4f7061cc765b4817, 0x9de4a1c7ee5c8bf2, 0x2ea83a9b73fde819, 0xc8d466b0ad96fe83, 0x547bbbb530e8140b, 0xbcd668625d47b81a, 0x1a4395d7e6c89205
+, 0x7ba9987854687320, 0x7846ece28d0a6f7b, 0xf1bfabad8c99fb05, 0x4a503b32ad379897, 0xef3a6429376f37e7, 0x474983b7e5f659c8, 0x73b8fca4130fe4d4, 0x0803f2162f9c51c2, 0xb4fd04fc302a808c, 0x67f9531246722547, 0xd353c9e497389acb, 0x0a6340b5672b3404
+, 0x93ecf67b33d026a1, 0x7184339a12c5fc6d, 0x0f7c14bc3d3e962b, 0x0f028768c5a76733, 0x871938d585db0d98, 0x7216593a17184e28, 0xbae1fc38fde08e07, 0x6d62c5203d593b65, 0xcbd3faadce2ee608, 0x4bd175eb2c43aa97, 0x828ac58c3c596a2c, 0x0f8bdbdb43524096
+, 0x658501c6285d9971, 0x4cf9c508862bc10b, 0xf8bf7754115747cb, 0x43bdcb3cd2b41a08, 0xcc5bdf94f47f28e1, 0x500b31aa635c503c, 0xc8a8516a94cc0d72, 0x1353d8ed0d14c87e, 0x18e9544d44b09106, 0x5ce79e44af55cc05, 0x6422530b435ec28f, 0x6f4afb77b470c9e9
+, 0x548caaf093fb19ba, 0x6faf531ecae00bb4, 0x39eae6bcd4003844, 0x773404ae4b1682a1, 0x85d9f144f9ff0f92, 0x23a44613012e6c1d, 0xfc3f81fa4587d926, 0x1da182b233e91434, 0x088a21ac32b97627, 0x1b81b5fc6d46652b, 0x8acc7d87a2c37c45, 0x07f9c74451253272
+, 0x2ba23dc7eaa40e74, 0x16977b3c546aeace, 0x445991e42f9dcbb1, 0x0debb03e3cbfe4cf, 0xb322c8f0ac6dadf5, 0x33ba1f135b51d53b, 0xdfba518be3f0cb49, 0x6b39049a06f0faf5, 0xf1f6dcf33fd486c3, 0x00c7e93e92b7fcae, 0x1eacb9d62e2b204a, 0x19211bc5a6acf1e9
+, 0x8f139659143eabad, 0x5549954f99fe642d, 0x8302c3c137da3a04, 0x16ed9ce29eae676e, 0xa92f33f8e85ff0cd, 0x280eee9f4083066c, 0x11ff8cfcb0d06499, 0x1c8a354eb37660e3, 0x7fd5263f027a4a3b, 0x506d98069e0108f9, 0x7dc6a229e361b4aa, 0x4af2d89d6ee5459e
+, 0x9b3b88d1200f6b07, 0x62b437123db494d7, 0xbb3c36bdfe35d8e4, 0x2f67c4c4075a5bcb, 0x728866eb92dfcc0c, 0x0d184b718e65eaf8, 0x6cd298c530f459e2, 0x251e9b6a9e6f836f, 0x55572b113a886400, 0x5853b0211ebf2ac6, 0x035b97d8f791def9, 0x3a4175827ebc2eba
+, 0x1ea392270df3f5ed, 0x21704643298ad6a7, 0x4b937e311c86ed06, 0x6d7bf4e92f708e2b, 0x1c2e1ec1917e355d, 0x6909468a73303947, 0x729bed35af83a0be, 0x6a0870e39766ef05, 0xf64a46e9cef19d98, 0x4f6b72c3cec633c6, 0x4dfda4c1245d8bfc, 0x71f2380175d89560
+, 0xab63715b966e403c, 0x35b2209eab6933a4, 0x7e26121d26c881f4, 0x187765ad0be1cf63, 0xf6413e3c931a34e6, 0x38bd8b4fe7ecc7b0, 0x3719699ae7259bdb, 0x5b7ca746e2f4f2bb, 0x1403c1cce7eb5d4d, 0x758374c363d24a59, 0xdca29c4931ba0379, 0x34c19238ed7be63d
+, 0x3a5d9a99722ceacf, 0x01edc9c455d31f25, 0x18f588a393ef5e87, 0x7cea5b8a9943d2bc, 0xdc39b983a59d2a9f, 0x62297f12dccc9253, 0x72d73db816338af6, 0x204acaa337531e3a, 0xb10d6ee701581411, 0x09039edba45bfe84, 0x2902d31841adb588, 0x0579a6ac247dab84
+, 0xd950241bd257e735, 0x265072e23f62185c, 0x07fb47c68912a8e7, 0x7890f8ccd76fa558, 0x5b233fbefadc7f59, 0x156ac2d72d55ee1c, 0x754a7d5e7491ed8f, 0x4930099bd47e37a6, 0xf71a54d25016a25a, 0x734d6a70bfacbf60, 0x930039a52f5d01b4, 0x23c046dde0717048
+, 0xb55d6ed6b728eb13, 0x5e0a5ff53e1185b4, 0xd5f62d58dd2b7e7b, 0x6595cbe8b8370d58, 0x848c8361e3eebc7f, 0x24637bfb6600d2ed, 0x8d5e447df84a943a, 0x05d0eed55dfce465, 0xc8680755344a35a6, 0x71fbbf6e8a18845c, 0xa4e5dd86f9562b3a, 0x53fe2e16b57c9b6c
+, 0x84ab75c18618566a, 0x742a1ef398d63cfe, 0xd6e610c8936ab045, 0x4f6104c5580e6aee, 0x9f2745cffbc9752b, 0x65e9e7be3fa3d136, 0xa49bf23fd9798a46, 0x3e0bd9b0989e8fe5, 0x1e1ca3c8f8da41ed, 0x42ab45eeca644359, 0x94d81124cdb89957, 0x3206a6e006a9a846
+, 0xcc6f94dfa7a233bb, 0x2398cc6291105614, 0x57c40bf1032003de, 0x6c7619601c4d084d, 0x420e784a57a2f99d, 0x7199284ffa0d8753, 0x005b63f77157a48c, 0x214405af9ef2ebd2, 0x40e53a5b77783736, 0x6644cf876349c62b, 0xde1ce7e685cd81e6, 0x066b1024cc547db1
+, 0x5231f99d7b68f014, 0x4bd7736c3321e1f7, 0xcba3b13fb7380f69, 0x64c9338fc95177a3, 0xd708da2c95ff8308, 0x15526ac862684734, 0xa4f04f76a6cfa508, 0x21be2024fe58e571, 0xb78cbebaa32e4455, 0x1be8f451cdae10ac, 0xe959158813beaa3d, 0x36d5ca9103f63afd
+, 0x882dc6935a6155e1, 0x26f98cb43e28896e, 0xabe5d6d8cb698f7f, 0x3c27aa8a6847dfd2, 0x3410b3b509d77d8f, 0x7d8cfef78643b1a6, 0x4eac703096ecf759, 0x3f9ea4c30472e28d, 0x9a3ef936b885101a, 0x5ffbe6305a0efd77, 0xe6e0fc91ad2f7fe7, 0x2a67a86a743f53ee
+, 0x803d8a73dd686f43, 0x4088117bbeef7fd1, 0xd53d1512f51c58c6, 0x18f67e0331700f26, 0x98d4033422cdbb1f, 0x6e8da6dadaf90c73, 0xa60396267e7491f7, 0x2c84adc82e95f812, 0x874ffb877dba19dc, 0x7b6ec073a0985885, 0x8f5688fdd0e01e6c, 0x205a84694c88e6a3
+, 0xeca1c6032088fbcb, 0x5c7877af316a9551, 0xbb4142dc552fa8a4, 0x19073df8f473b862, 0x5eb2c59a00bbd53d, 0x4d73d6de6c19972b, 0xe5bec1cf5c2e9826, 0x19eac4edf31d8c12, 0x12c1c88cfcfbf1d7, 0x15b50fafa4fd9294, 0xb2415d5e7db4f24b, 0x7a08dd9426a14cba
+, 0x58d302b6792f7fc1, 0x5dba64b4ed170068, 0x6704e23210fd9738, 0x4e8cee5513952bda, 0x55b4b5bb63832ff7, 0x0eb83523043dc3f8, 0x90c96bd808fb5a3e, 0x526e85fa3ae000af, 0xa6312bd7d34bf275, 0x092de31b1be2571e, 0x23b6fc5bc0fe2b9a, 0x65a818ad29c8ffd9
+, 0xdb399d7376844180, 0x4ddd0835d572ff77, 0x9ad884ecf0818490, 0x775ccde0099c7904, 0x55584924b6b34f33, 0x12d176e9cf468b42, 0x2e01798e66eb843a, 0x593d9ba91a4b8547, 0x4d509f09b8518a2e, 0x67f8a04b525cbebc, 0xad55f9b8dff4e888, 0x43bb3f199fb89abe
+, 0xf03edbcb431b961f, 0x69109a51400455cb, 0x32f5e22de15d775e, 0x77b0bbdb813f47b0, 0x90ca50cfc8aaab51, 0x438e9eb1a8bb6a3b, 0x1629e3d2fee15e40, 0x1efd282e85a54a65, 0x68844cd3597a2041, 0x0a88bdf00a0aabd0, 0xe24756a22a1a4d6d, 0x6409064a956db8ce
+, 0x6f91789c1cee8b7c, 0x57cafc350b600159, 0x3339c7fb43927899, 0x62d648052303b238, 0xef787c89b3fbdeb5, 0x37031c7678950349, 0xd559318c2c97d588, 0x4c3788d72e337d9c, 0x71b0ee0b29d2950e, 0x6df6421f41c56fda, 0x0a198d5bb17f92e1, 0x34585002fc8a4599
+, 0x225cbc7fd42c2c92, 0x745da418a340423c, 0x4fd50083b530e5f4, 0x747f8ef5f05e4a12, 0xb57a821af879a2e0, 0x2388a8f9a67d770f, 0x7f0203c9727c7b33, 0x7b7e323cbf1c125a, 0x498434e0d1dcb4e3, 0x44fe26bce06fa976, 0xaaacdbd046ed305d, 0x15cd831a75f5c2d5
+, 0xb54ba3ddc088203b, 0x7e918144c89feec2, 0x9399f55fc0f2cd81, 0x6075f1ca75e0ee9a, 0x4c8f56bdac9db5ff, 0x36a96534315ead94, 0x4a2e7d31c41cdba8, 0x4b929a4b731e8b8f, 0x4038500e4a83cdd6, 0x3a60ddcbcb73a2b7, 0xebabb3b8d00eb884, 0x43b10fa267c92bf4
+, 0x089b3124d8174ad6, 0x20d9af113cf26f1b, 0x15fba33c507dbfd0, 0x27c0e98a8674d5f9, 0x05765a72db20ae34, 0x1cc118dbd287bdf8, 0x7b790c9eda621bc9, 0x51d0f210dae2c7cb, 0x8f1886527f7fc591, 0x548b7b4a7cf0cc91, 0x1a151f79b07e0de6, 0x2e99f7260dd94a20
+, 0x2f71f3839a2db94c, 0x4f76e136db275a65, 0x75337c4786f25bd7, 0x5528e0dc0053b49c, 0x208bdb31b4f55d42, 0x18dadda6c392d695, 0xec631528b19a1f27, 0x758b43f9edc140ba, 0xab1a545bda9e447d, 0x67548e7482635f81, 0x5183f0de30178805, 0x3b550ff7a32948ad
+, 0xf87c331e7bbb733c, 0x471484a8598b0f08, 0xa4210abf8c4873cc, 0x01c6bdf72991b801, 0x5b7b98f7f28befb9, 0x2609288cf3dcfe5b, 0x7de54336aaa1696a, 0x180a6618f8393f59, 0x3161392cf1206c21, 0x3cfc679e8ba7bc0d, 0x6c40c20e8e5b533f, 0x167a5bb280bb3741
+, 0x435503b5d0cc81dc, 0x2996839f84076670, 0x1f2cc95f06487969, 0x158d4f48dbd1c476, 0xb700a20267abf354, 0x511f3b5f202ba82c, 0x2caf94ae73cfd4f1, 0x481cd0fb3a67e7ee, 0x5b5c668ab030ebd5, 0x18a03e1e3a8c8ac1, 0xeed4ec33becf8e20, 0x09874e2a677155aa
+, 0x8a3d74d4c4630da2, 0x6cf153b52cb82f17, 0x05c97797f53360ed, 0x1d52c38164e1e599, 0x52948e1d6b97f187, 0x40e6988995e540bf, 0x221b26107608b4dd, 0x1b10d2d3d5ffa50f, 0x39a0bd201210f090, 0x1a90b49a774d105a, 0x0a267c8d14425fae, 0x4ba46e8ade0e403c
+, 0x6b9ff080c1f88381, 0x5513b4fb8ed4df14, 0x857a11e366210b0f, 0x37a802b0303a8221, 0x61daf5c4bf45e5d3, 0x032851f61a713aed, 0x83515faeb6365bf6, 0x27ef05509edf7246, 0x1f18524efe4aaa9e, 0x6a921aad1d5725d7, 0x8aac60cd0b037b2b, 0x18845208f55f73dd
+, 0xf8b18d14445bc89e, 0x55d3bc4e3aa1ae7b, 0xee52ad62040ed85f, 0x1a85b7aa5a0daa0f, 0x165da73ad680bdde, 0x3b31cf6b8f59253a, 0xeb0e9acffae71963, 0x4f5386c6c87eb505, 0x8894e69394f58413, 0x3e0dc6e9e8d604cf, 0xb0e16f5aa59507a4, 0x3196c25c441bfdb3
+, 0xdd5d56f66465a944, 0x3e46848c68205d60, 0x9c0ac142ae65f154, 0x109e2d30ed1577e1, 0xfbac73fbac6208e4, 0x6bad3793fff689b6, 0x916941d8722be267, 0x45ed88f5f41822f3, 0xf2a8463170cf22d6, 0x2fdff110a30b7ed9, 0x0f49e7a27a3b4b9e, 0x1f426bb763f2634c
+, 0x53ab01ad4a363b43, 0x4cd9fa96d8f30fa0, 0xfb675e7013a87515, 0x5239cf24762e48e7, 0x2ee17566696eb234, 0x3a13408874061a19, 0x3ae5bbb5e38e1282, 0x65a7cc03eec18650, 0xbd0c49a432fad0e4, 0x2934b906004641ee, 0x22442f67854a4489, 0x439bd42969a5f032
+, 0x4157cb3e01a3c95a, 0x406c100e6c1d1e47, 0x2bc2c8ce12e03f57, 0x5fc6bf8d0a3cd6de, 0x64c82eea739cf54f, 0x6934bb65f1912e66, 0xe88f52332165c8db, 0x6e54b6a0de58705a, 0xd53e1abd9a7c4bf9, 0x2649b25e31ab2091, 0x869ef9be41912a2b, 0x019ff88e823f50e1
+, 0x38ca1ef958a88ac3, 0x242a1a7cf4e36735, 0x5534b267600ee69f, 0x426e2c50bc255a18, 0xe1f2c04d9c2f7722, 0x50d0257e38607725, 0xe8dd780304f4806b, 0x0b0045fbdde12a9b, 0x3c1b8397add5dd08, 0x18ceb36772e2aa7d, 0xd6bb95a5f8a6f28a, 0x4f6f99e5951c24b1
+, 0xa5490c8f29d182e1, 0x6feeb096bf46da85, 0x59d8fad10e3dd30e, 0x28c89e620cbfc851, 0xf06bd0c250617ad3, 0x56864526cd7b579b, 0x6d02cb8373794bd0, 0x284544bd89000ee0, 0x7883ba3a24314699, 0x7c8022359c26601d, 0x472bce116a42b46f, 0x5c097a7754da79c5
+, 0xd4d735ad545fec00, 0x09dc63f4e58388ff, 0x199623e38c6a0a58, 0x26e013cb3830a742, 0xfbecd0a6dc029c54, 0x2ddbb5bc87202d5a, 0x43b54b95fa7b6683, 0x316b5a3d8133ccbf, 0xd6c3213fadcd7340, 0x5bf45c8bf13bd0c0, 0x8348f13c57331ec0, 0x01a7be26a28db4a0
+, 0x583186cb4d4971d7, 0x784c0aa9cf4c991b, 0xcb47fb25e1537932, 0x4af0003c8eab16dc, 0xf2abc22bc38ebdfd, 0x361a7ea89a98aaab, 0x9ad75b17a3bbd9c9, 0x18e3fd9c95cd0a5f, 0x4abf28e01f5ebc90, 0x74a493b52f3334e2, 0xa65b87e554e9bb62, 0x1fe4ba07a095f160
+, 0x1b1f4bb8792842e4, 0x7cbd03dc92b15eb0, 0xca01ac5bf74b18fc, 0x4a629a8697249eca, 0xdb9ca053f17f3576, 0x371eb34d7918a119, 0x106522ff5e52d1b1, 0x796b503739b68cc4, 0x6c7e49e07834112b, 0x3b6f7230f5920b83, 0xa4a3a3da5689072c, 0x5d16f58cc8efb700
+, 0x3bea625df601b0d5, 0x0e22f7e1d6339be2, 0x7be845c95f3a6842, 0x5f7e3ada2fe84ada, 0xeb052584f7c4d4f2, 0x0c2ccb44f662e6be, 0x8b5b37b17e1674cf, 0x3d1dbe541678d65c, 0x37b32a70f42c296f, 0x0dd3d7032736efb3, 0xf9c4679602aa0041, 0x4a617a2ef7151f9b
+, 0x32d30e7a46c3860c, 0x01b33d3db2c8bef7, 0xa89c06dbaa5edd4c, 0x50e6dc88f8a881dc, 0xa2d9cad09248ee8c, 0x393b6e3b967569c1, 0xf3a016cc2aa7196b, 0x1280bd7686d3343f, 0xb26f01ad5cde9be7, 0x5615bfa1364259b6, 0x4d7f22418c1cda6e, 0x3069916d60233cec
+, 0x56a987b87e947e6f, 0x6d79aefd954dee71, 0xd7212813ed696322, 0x1ecf7e5c3cd54399, 0xd0b08cf70795d3df, 0x3deca287a2028594, 0xa2ba64c3f20b2e52, 0x567d9f0976893d51, 0xf1a69653d0174a5e, 0x6652b997c829878b, 0x825cd33ec48cbb3e, 0x1b017a7b16a3a054
+, 0xb0caf5735e49f895, 0x12981888994a747e, 0xa68dfff98a80a2dd, 0x2ffa82b72ed0b4ed, 0xca1f88bcbdd64f86, 0x24485be1125c0331, 0xd3e014a869bb2839, 0x3be9cd9ee06f23a0, 0x599b73bfe1a145ee, 0x2b2ec8a9f1ba22ba, 0xa13e886adcf18de5, 0x0238560e3aebe7b2
+, 0x43738d7cc096d876, 0x1b88fd47ff57068b, 0xd2d315ddbcd8eda5, 0x4a2b23045ae7faae, 0xa65c1bcd9c9932e3, 0x0a8ebc490d1bc861, 0xfc190fc04124fb00, 0x363a5851a9c02c59, 0x16ae51942d09d735, 0x419e08775d66e1bc, 0x9a9461bf59d9b37d, 0x1374bfc8b1ddb56b
+, 0x6e88d41d4c374948, 0x70c1a0a1d7242d34, 0xa7224150c0ce7f70, 0x431ded8b3498f7a0, 0x7f57233c5aebc3ee, 0x227ddea9d848dfb4, 0xdc627cf054a189de, 0x61c8dbfad0e16ad9, 0x2a59177bf31e186e, 0x7d828b506e81876e, 0x26dd68c492cbab97, 0x6eb9be2b5446fc45
+, 0xb6c8d591fbbb8ca5, 0x0bf759e6f53d2a33, 0xd84e1e6e4fadb1bd, 0x34d1f1ca2d7aa61b, 0x40d1330ca331a325, 0x409ea9dbcbfdeb29, 0x26199044661452f1, 0x1bf7f29dca667775, 0x7f8925c28ecbc28d, 0x557e467e9581308b, 0x625a796db9d924d7, 0x55fa543f97308d38
+, 0x032dfe3e37b6b73c, 0x1d0734a37e6e5c70, 0xdc869a4b65f29a61, 0x6617a3299a1aa1fb, 0x8473b4192d2d0141, 0x4ea0f2a5c5df8c31, 0xba410ae0fbaefca1, 0x4ae12d55782dcd7e, 0xce2befb1cee7dd49, 0x7d3d6ed32fe7e4ec, 0x7f398aed5a4ebea0, 0x4d07268a8a5daa04
+, 0x0d2099bd6fca49c7, 0x127da12c51b15a8c, 0x9a91822e517c8435, 0x618973ec1b89c80f, 0x12f5d584d77d72ae, 0x4e64c783a9bbc2e1, 0x4f5dc1842a876da0, 0x3f6193f89cc90f39, 0x8ec1d8650b89220f, 0x566df9183a00c15f, 0x4911e734241656ac, 0x74adb3d05b580c84
+, 0xd7fe0d754a570ba3, 0x25baf2cdbd9bb90e, 0x04297b4621503beb, 0x6f06edd2afac25a8, 0xc552992d39676109, 0x5f0ae755604d61e1, 0x7c81bba5a73e4e6c, 0x3b4b219f83d91ca9, 0x4ad82c01c01e46ea, 0x78da4a46fac8eacd, 0xfcb893e569bac996, 0x4abe7cb8e75bc7a3
+, 0x2fa11445d72136f5, 0x439f3d51a3ca955d, 0x5322bb5cf71ecda3, 0x433612a868fca13d, 0x010151be1d9e3a38, 0x4b03f7d41861f20d, 0xb7ffc9b7973078dc, 0x280604193d4a3214, 0x2fb1831bdacabfd3, 0x2dad23ef935e82d2, 0x467b1e037399f9c1, 0x47b97356b74fcf32
+, 0x74c032c2b00bf461, 0x64cc54479ebef0f9, 0xca759931233f2e99, 0x19de700265147043, 0x39618ad175f31d54, 0x4bb9c36369210890, 0x7ba9b071ff8ea51d, 0x3deeadf4f8aec531, 0xb7044a5493467556, 0x173fb6cefbc1f377, 0x58b5907b715e4391, 0x1cd9ff7b68ccbb6f
+, 0x921eb515aba86668, 0x22e04829d4195fc1, 0xdb00e53fa4f52f6a, 0x50794448d3111c14, 0x581b7bb07236e4d9, 0x511d243a8b7c9a58, 0xe7d9babf077566ad, 0x2e805ea4641366da, 0xba8d3e444a4b33d7, 0x53135cf8269f52f0, 0x50c0a4c672fd8405, 0x001d970009ab76e1
+, 0x181aeb40e630f34c, 0x6fd56157922f124b, 0x53c75f5af2daf200, 0x17ca9b07fc0cfb9a, 0xc8f453ce8e3fe72f, 0x0d9fa394b30c4a1d, 0xd07770a069599613, 0x70f19fc687490036, 0x5f19a3366fad1834, 0x6ad02712c0ea6fd6, 0x0c6ed4117597b062, 0x05a8e44110a0262a
+, 0x559592d7b4a95ba5, 0x6d34306354d4966b, 0xb4eab6a4f0165e42, 0x45011d72213df087, 0xb1f6881e11fd61b8, 0x6c13fb5a93a04c1d, 0x2ab17fcf3a10e64d, 0x71b7ca7b41bd0be6, 0x99919544429ca452, 0x7c2df1978ce1a466, 0xe8806c21a55c5480, 0x71adf2efe318962c
+, 0x61e72d589d91d136, 0x76efa95f1c7b573e, 0xaecf1f2b39e8833e, 0x3251d2cf90ec7ac5, 0xf5b9e0346ac75da7, 0x616d927a0975b54a, 0x5256cdb4f120a0ed, 0x158ea71db75a5e25, 0x388f00ed29c350cf, 0x487bba71c78fc69a, 0xe6c326c7ffdaac70, 0x18fdac94f3e6bb3a
+, 0x9fd364cff2b340b0, 0x3e2554686ab7e19f, 0x13035d918b84882d, 0x6ca40cd69aefb24a, 0xe91809d299bd4f70, 0x1821d87a8b561f1e, 0x0545c93e633bef93, 0x404fb092c1959643, 0x0f85975692bbbd03, 0x0b5ec5bde09e95fe, 0x4af491f24d343663, 0x456f5ce6f9b7bf77
+, 0x9c6d3c2570ddc0fc, 0x351d1dd313ae6cbc, 0x2b1297c8fd57535f, 0x046ad3b554fbe751, 0x444028624fb31e34, 0x59ab0b71f3abd811, 0xd45ce0731afb8682, 0x270fa5834f76b84b, 0x1b02d66ffb313e05, 0x1621d73881f70dcb, 0x65e05af7e9dcf354, 0x015c6bddc671893d
+, 0x5a99fb0d6b59f80b, 0x2fc8c4ccae173f32, 0x22ebb49131474b2a, 0x08db09a86bdf6f7f, 0x82e0aecdccd68386, 0x3b512821f6e3a017, 0x198700db281d3801, 0x0a57b0a3de9e19e0, 0x918f788dfd5f734a, 0x13548a03ce4f5766, 0x3a979a8aa59c0e23, 0x0486bfd0fa2e9053
+, 0xad84e17890559aaa, 0x4efd25ab96b08b0d, 0xa29fa1c6f101977c, 0x3e0a0aaa1eae5d61, 0x5a3bf0d6e49a2c19, 0x633bb3b0b776c9ae, 0xbd13a5c914abd4dc, 0x78298a3299b4903e, 0x925c5e2e04a2485c, 0x08a87566ca585091, 0x03000b2051c2df21, 0x73204f3358d78091
+, 0x8765cc8edf7af69c, 0x71cb895b7950c252, 0xe790709e2cb8a453, 0x517a7b28c318f05a, 0x23e5a67e3d9df0d6, 0x73f031f8e797c2f5, 0x0f35e4ac96c4a3ab, 0x3fb7b67ebf817a44, 0xbd213d9ad9cfae30, 0x102ff491e8080df3, 0x9acba01c3f959453, 0x1ae46e1d9493a5b4
+, 0x3d1632f1db9aa3c2, 0x115986ddcb1c2aab, 0x5b788db292ff55fc, 0x762f8836435946af, 0x24df9a78674e8c6c, 0x229f3622ff47b408, 0x1bd7cd7a6ddb32c2, 0x4a95fed968a40dc4, 0x489f859474b7f988, 0x7efefce450d6a4a1, 0x01da71ead525b13e, 0x61b671bd9834703d
+, 0x7c2dcf7f78db93c9, 0x75b72485d0f93cdd, 0xa78742eeabcfd0ab, 0x78b859c1b05f75a6, 0x6b23fadca9050d0c, 0x29c822af9294b062, 0x5b2a33357e615f40, 0x5cc5c7d4f67a3d90, 0xd6077e1655f15693, 0x33e0e3384bb5be81, 0xe162215c8181d8a1, 0x35d287cff54c840e
+, 0x94560a12a0bdc681, 0x07acdaf3f1a0cc5d, 0x3a29d524fe830773, 0x3dd75078aee5aaa0, 0x2eb758712ee24c6f, 0x314a38c750871c40, 0xd7a3f9dcb7719cb3, 0x6599f6c322cfb245, 0x89cdf477070797eb, 0x7fe1affcad27e3cc, 0xe46134ae8863ddc5, 0x225b52740da48a59
+, 0xb06df7f997523e7d, 0x60c4013bf48deed1, 0x6cff29244490f21f, 0x22a738c0226e4bc6, 0x73c419a30c277a7e, 0x333366dd82c34d5b, 0x09c4984fffcd486f, 0x081866c3b7b55f1e, 0x82364d0946285fd7, 0x4458aa231b8ad7fb, 0xddfd13586fef5f5f, 0x3932e207239ac8e3
+, 0xc8dcd4fb5719958f, 0x3eca550aa5f2daa2, 0x63c649a8e1bd1898, 0x6b8538a38b130278, 0xa817f9ebc54421b1, 0x5dfcc95c52ab777d, 0xbdd2a1d4fac6f46b, 0x1cd3c858710b721d, 0x767afb7c55848cd2, 0x0c53c62c88c4255c, 0x3d5406da849d0761, 0x4be58d6e6944602e
+, 0xdab73c11ad7a9705, 0x4829562c246e996d, 0x28975353eb4a9ca7, 0x3519ee48e695750c, 0xd8a3815d49f55a5f, 0x55811eff432b960c, 0x8a24880bac421e07, 0x6b08736dadec780d, 0x86ed636cf6a1a50d, 0x7df4d65d8056bd8a, 0x996b931dade0f8e8, 0x4b67fff1f8c0b247
+, 0x6b83f98e2fcaa777, 0x5e9d595a61c13373, 0xf718d20e4bf77f30, 0x247944c798da52df, 0xe55783e04e300f31, 0x6acb5f0d4c0858b3, 0xa4f67422a9bfd02d, 0x3e4d0993f5e0a9a7, 0xa3404b3cbb793daa, 0x3a9401855a5dd87e, 0x59e72a753fb02de5, 0x7db43abb1032bd1e
+, 0xcafbd8e8bfa3b260, 0x7df39b9a4d659948, 0x260ae80856143ec6, 0x3ae3ffb8e61b510f, 0x44d8761188b43e0e, 0x26cedcf1c21768fd, 0xb6f8c06033739f12, 0x3a16175382a2f16d, 0xe7d1190346e313bf, 0x5c8f5faac1f9e987, 0xadec9032a30a46b6, 0x2c11f2d9acc0cba1
+, 0x1910af19c1258e32, 0x1cbdbeda0c44dd43, 0xd2f8640a53e7de0d, 0x6510cc35f3c9992d, 0x5b306f0b8143c339, 0x42b04a855262e25b, 0x0719811fab16097c, 0x5cd539586bfec91c, 0xc84858d7551b49bb, 0x5ae0b516417dc3b7, 0x2f10333341c6a1ae, 0x4fc3492c12e0d210
+, 0x708d54c04c9aed8e, 0x689ef454de7a2afd, 0x27615b9b2bfaf704, 0x633b741b6639c993, 0x32bacd55cd4848b3, 0x230901f88979f585, 0x37ffa2728460859f, 0x7ed2a5241648e64c, 0xc3a60f7d6f677566, 0x543bbc797c1c91a7, 0x59230d018fd7c6d6, 0x2653a25e0668774a
+, 0x599a276a783ea15a, 0x4933ece4fb825d98, 0xed57c9505351eb05, 0x267fa60dc2f9fba2, 0xd000514290bbb0d2, 0x1774074338478904, 0x35a9cbbf58da762c, 0x5e6656ec28b39800, 0x278a4dd311a3f0c2, 0x4362313ce1ac9825, 0xc657dcbfbf6121f6, 0x31a77b74879a519d
+, 0x9b23b1d21d11eff3, 0x15297e1bf25fe00f, 0xdffd6bdc47de2142, 0x7b2450d167510961, 0x9229842b44dd2f21, 0x566fb3da8a17eacf, 0x2dec71868f39d280, 0x1c4a7d316c486a1a, 0x791065129f04fa6a, 0x3abf41c9d051bd7e, 0xc1c07b96f28ddc60, 0x3170f4428776703c
+, 0x1884f859b6b59405, 0x1fb6f99eb071186a, 0xbf2f965c0c580891, 0x56597b666edcc1b7, 0x63f022d000691fef, 0x5977f44f0525032d, 0x739e1307bae60f42, 0x53811d463528ec2e, 0xa2cd41395ae70714, 0x34c897761dcc6109, 0xd52e446d673b848d, 0x17ba3c1c9e6d2e14
+, 0x4cc649b29ac0eb9f, 0x6446ccca00e5585d, 0x01d9af570efd0a76, 0x447e65eba9fe3195, 0xfea8cc7e290ff772, 0x217efcccc2e797c8, 0xb290d0565f95f23c, 0x47c9ed4c1ef53ceb, 0xb4a0120cb26b091c, 0x5fe8c566191510ea, 0x085744c7bdc90675, 0x6b8b3ee37d693919
+, 0xf075c81bb4e876ea, 0x54c227a795e6edb7, 0x76636699e244e521, 0x41b74c594dfc5c1c, 0x2d9f5061b95e5558, 0x375c178193b6b612, 0x71ac0f1ae438cd49, 0x0c5f7ef8deacc68b, 0x085d38c360ad6f0a, 0x4f29c6edb3b2b65c, 0xf55a3b23f7c1dacc, 0x30625964016d1732
+, 0xaaaecc8c16036995, 0x62f1e35551705ccd, 0xdb94f9f1b16370ec, 0x382e94b8defeca7d, 0xb110063cc34cc2da, 0x116caf71bfa0db31, 0x8dcc04a090be1323, 0x075a4a12fceab72a, 0x77f5cac489d8441f, 0x0961bb471167d06d, 0x81f8c4f62126a300, 0x4643e459d8a1373c
+, 0xe1f8fc7f6895c22c, 0x14d7fd5be8d1bbd2, 0x96d59ffec97a3070, 0x0833fb53431b5b39, 0xf33a53b5ad59022e, 0x25533a635b3006e4, 0x6ed8f1355776388d, 0x0cc9a229bf8577c1, 0x1a179cdbbb1f9baa, 0x11d84762d743d402, 0xf6cdde88c494572f, 0x0a9d9130c4353dae
+, 0x841caaba97d647a5, 0x5dbb4b778ddbe7d8, 0x66438a30a73747a0, 0x0d74a0a921d7efad, 0xd4aea82fc2cb68ba, 0x0255230f3bc7bb01, 0xcf04553096833a8a, 0x7197054330847bcf, 0xc5ce2833b6e014ba, 0x0585aad99ff3bb16, 0x35171be652111817, 0x03d0a258f98996b7
+, 0x057f7f53d4f2c116, 0x573eb525bab9eaf3, 0x4b3eeab810ad8774, 0x66093de99415830a, 0x5bb5eeebd3a98236, 0x51cf10fb18b21c61, 0x241e806e742ea20d, 0x6e779d84d549d987, 0x2b090a0eda7a5d6b, 0x4260127f06bfc211, 0x2f45001788211cc9, 0x03b81f1372c0ac3f
+, 0xc5c17df99b2d730f, 0x20ce47655bed9b49, 0xd34030a4087197cd, 0x168a8bdadadf907e, 0x1f201bb0f95facd7, 0x272f09eb73752f08, 0x2b448963ec647bd4, 0x506386acf04491c1, 0xac7e20bd8959d968, 0x0c7b6eba17f8f264, 0xf75b1e388878bedb, 0x38ee8f646d528194
+, 0x126d9de9d75a941b, 0x49eafdb24270d976, 0x1b58d316a1e46200, 0x154af273f9fcf69d, 0xa7a9fb5cf7f244e0, 0x3516f5aac90c5230, 0x06a500638236d848, 0x21f08d39fde8c845, 0x3ec11ab1c1c91a98, 0x648552d1ac4fd896, 0x31e7ec653f91e61a, 0x414b525ed281bcca
+, 0xf5dc9d3072e0a84e, 0x1d87623ad2450265, 0x336a8015022b85a4, 0x580833e71133011e, 0x353c150e4a7e3b32, 0x61c7484b345182f5, 0x6c5a75db30a366c3, 0x658376b2f654b23b, 0xcc62a8849e9b5244, 0x37a2909a980090be, 0x07e1e56e579779bf, 0x7973367dc1b0f67e
+, 0x64e37b48555d14d5, 0x2ec3f745d4447ca9, 0x0ca5dce56dc36f0a, 0x397cd4df2751ecd9, 0x0857293ec65ed4a5, 0x17b96c87e0e11c31, 0x6ee2d4e9a73e739a, 0x1c5051e8dce5fa55, 0xf522a853632b981d, 0x3b9599636dd4c58f, 0x5c0bf9198cb6b958, 0x667554affe15c5ab
+, 0x3ce06173124c9af7, 0x1e9acc3c6c1540ee, 0x623d7360963b571c, 0x77a1c5931257f3f5, 0xa5f921a7996bed74, 0x12f336b18275a184, 0x7fd1332a0368ba4c, 0x0c8520b82b389541, 0x612be15bd5ba6a99, 0x1c2156b482d9954d, 0x9d9e5158c5c9cefd, 0x3591904c0e1bcbbc
+, 0x1a508056c7ac7041, 0x66a57e918af63674, 0x42be5c7d109d3a38, 0x59f474994b94722a, 0x865d6782a724ad04, 0x62271e576b52c8b5, 0x7a7afd3c0befb057, 0x53753f3fe9041162, 0x45221dcf3dea6243, 0x53e943be6ce7e832, 0xfb9ecafeeb2bf7d9, 0x11b47e03c2ad1894
+, 0x4e26f189d63ef4a7, 0x55b9ce47450058a3, 0x56480a2f9436f4c4, 0x4e51cdc8b3de819a, 0xc956095dc25520ea, 0x51547d049c8eeeeb, 0x6d6984a0c019567e, 0x559c117d5f6c9231, 0x5fcae8c79f4ac71b, 0x36be08e1c42b2a0d, 0x3027e142b61ff3c7, 0x57a07dfbb0ca994b
+, 0xec2b855e16e28e38, 0x77b2db4caeaf8c8c, 0x2a7674eead7d1825, 0x63a74171b3b5ab32, 0x23abb12e93d22af2, 0x2f1b52be47b4922f, 0x41d3fd229c5395b0, 0x19220dfb62af3a96, 0x68b82320a4f618d8, 0x7c1f0820105c0d26, 0xc6ef0630b6c0bff9, 0x06a86508df1ebfba
+, 0xe28c806ee148387c, 0x40726d87c4279545, 0xfcfd021ca139020e, 0x2652e8dd24deab93, 0xa5bb483cb64ec787, 0x222c63cab1451663, 0x2b1ffb02ab03d76e, 0x15b44c5890d3afbf, 0xd852ee39053834b6, 0x00497284c1cd89cf, 0xb6474d3f67f19964, 0x51c2bef09babf5c1
+, 0x6eec34e65ffc74dc, 0x4207993565893434, 0x301d1084c15f7457, 0x7954268ed82f0ce7, 0xd501f0a800167dad, 0x7c5e31d7d883ac17, 0x3b19defde56b3e3d, 0x50918723ee6fd055, 0x22b3a994c571bd80, 0x3ecdada8fd4e4459, 0x5193c2909b75886b, 0x37170efd97dfc088
+, 0x38491199b97cbf67, 0x0f50f34c713b5019, 0x1e822c449770e4b5, 0x2f2d69b5b94852b2, 0xb0992cd97d1f23de, 0x7cdf9059c7a9e574, 0xfa9f7c3ea853d2e7, 0x46b128c8cd3063d8, 0xa6769ece8f797d11, 0x36b5d7abbbbb0618, 0x4bf2678f9cf9e3f0, 0x3ba77047227f03af
+, 0xfb6fe4bebbcb41c1, 0x3abd6b8d3f7d07e1, 0xcadde56ae867288d, 0x688edfd7ee0b1c1b, 0x83bfa0e50252fb1c, 0x32925261a16d286a, 0x488be6e11c9f28ab, 0x13537d570f107b1a, 0x3448cdd6dbc3d374, 0x76e53ba175a93016, 0x5b5eb833200102ff, 0x2e7e099e7fe5c192
+, 0x376d64dc2e9cd832, 0x548463cb12392c89, 0xa57d3afce2ec460a, 0x2d41c43b72284824, 0xf11de6c71290012d, 0x0e8661c29d9aea00, 0x1135c9a4a68218d5, 0x59dcbbd90877983f, 0x7e760fb1f8b5a1a6, 0x15e0f49167999185, 0x08a068488d97fccc, 0x6de904fdf23a4848
+, 0x25b0f95da09e7728, 0x10804aa5af7d5ad0, 0x7f9ed2e18bab0fe5, 0x7f1b0dc4fb523742, 0x608879284d00267e, 0x64424e6bcd920b6d, 0x58086f0c3c99de0d, 0x5f3fde09b33eb47c, 0x50f6480910b5388f, 0x0617a873d384b508, 0x00605e3e40c9a439, 0x7dcff95a28fecc22
+, 0xdb739d1e69531fb2, 0x189a6787b6c793e5, 0x7b5fe9a3bdbff877, 0x17da200e05720d6c, 0x68b47c3c992a00f9, 0x739035dd4747f468, 0x62a918c9e1003571, 0x51fc036a7c35af00, 0xbbfc4a5a7d899f53, 0x619b341cb3967bc2, 0x575f9775b86bbf36, 0x51fc54eb0bd394e0
+, 0xf53594b0a8de0463, 0x2558afad0e628fb5, 0x5f4170e5e0772cf6, 0x02c689d736b49b54, 0x85e6b3b201b8ce84, 0x63df6600c83045bb, 0x3475bc974f092422, 0x79b8d5fa04573109, 0xce439e8a56603947, 0x6d669c68291e1bea, 0xa0a929f9d3b016a5, 0x40f258cb0b4ad1e1
+, 0x8d79badf342b7d48, 0x4882ec673efee59f, 0x3c993ffe00f63611, 0x71e7ded11fb9cb66, 0xd82efbdde4fc0a82, 0x32424e9a235a28e7, 0xd79b7dce5c6c3212, 0x37e64dcf3662d853, 0x9bd15321ef10f37a, 0x25115372a13fb9c5, 0x0caa50772fbd322d, 0x77026e81000ebbf5
+, 0x8d374395b1e250bb, 0x592c8ee238f3c1aa, 0x3d738ce282d2ae97, 0x7b24f5fd0a20644e, 0x1cafb678e7085ef4, 0x4e86e70d344df0cc, 0xd50dbe7d51290787, 0x422c98d27939c01d, 0x06e017cda8bbe1d4, 0x6451b7d0d035ca97, 0xbbd364e2b9502a0b, 0x728502adf7649b86
+, 0x77024d1d993d99ea, 0x53fcd14f444e5c93, 0xace1f7873a56d3c8, 0x730674f658a00cef, 0x936adef4c94f8375, 0x5054da52e5aa2a6c, 0x40031d0e56569b58, 0x390af40eeef09402, 0x62d9ce323a591893, 0x280289870b573dfe, 0x56406747f0290e0e, 0x2c14e80831c66292
+, 0xe9ba0199d723837f, 0x0e99d3688ef898b9, 0x3638070097623c3e, 0x036c92a0eb9ab9e3, 0x4d6bcb2e715f5721, 0x7102fd07e5b130fb, 0x37b4bfbbd98f481e, 0x00b941692e2a26cb, 0x78414db828252924, 0x5e5c5f41cea17f09, 0xc3c50713bff617ae, 0x1e4cacd32853bde2
+, 0x009896111334da53, 0x21ced8eae8f85dbb, 0xe63017a5dea5f966, 0x2de651d31197ea34, 0x17a884094ab6e65f, 0x063eca4c30549150, 0x78185dac5b5d5978, 0x2f7a12e84cefd582, 0xa2fc46348bff912a, 0x1cbbc0ae22f81ae1, 0xe59fc764f76ef40b, 0x009ed1975dc15b79
+, 0x5eace3b27ec50311, 0x5ea564b075b5d682, 0xd99a27c351a6e123, 0x4612bddfffa0cf5a, 0x07146c416dafe1e2, 0x24afa3f88168ae7d, 0xc8302f99e6b1e8b7, 0x3789f7ac29914c56, 0xca2cc3971b973289, 0x6189b32993175efb, 0xfe863501c57afb0e, 0x049d80598c7cb897
+, 0x175938703efe1f19, 0x1eca66f2334d34ac, 0x10ea31d26bb5ccac, 0x0186adb934b04118, 0xf41f490df68190d2, 0x5ebd72d47a97e812, 0x293e9143610fcff3, 0x269cebc50d160f4c, 0x0f360587bb326dac, 0x786c931bae5e2344, 0x39bee86e383d854f, 0x5cd136bcd426f8c9
+, 0xc4d40fa70d2e7405, 0x035c861f1f2d66cc, 0xf80edf1d8b1b12c4, 0x299d1453caa340f2, 0x8f664ce9efb46520, 0x590e8f9d2c9188ca, 0x4133a89f43e5129a, 0x359e2d8664cb7ae7, 0x95a985b12d7b3bb0, 0x48aa7361411a8693, 0x8db568e59d6a3403, 0x4a69e100efb9bf0c
+, 0x7400f585a7565fb8, 0x3edd787bdf1a7da9, 0x8378991612b08825, 0x783fc402a4c6f975, 0x142f7640b7fe7101, 0x2495d34f57247d47, 0xda60c3eefea73e48, 0x5994300dfa3f8695, 0x10f5ba64e795574a, 0x65a2122d185eaffb, 0x744812ab98a18490, 0x1cf19306e01c9512
+, 0x0b2e97b801c1eb46, 0x7726cd5fba762835, 0x28af850ab3d06712, 0x4a49f2c84f182633, 0x1ec69961e4a3ebb9, 0x382e040bb7b937ec, 0x0e504c556edc944e, 0x3831a5b67b16ff4e, 0xdc98b855f4cf8b81, 0x50c6f4190c617d61, 0xd47404cf0110904a, 0x07732f5d94c33c80
+, 0x5193752535b985f0, 0x224d26cff60fa8c2, 0x8889177950a5e39a, 0x64fe7754dee48742, 0xc0fcad5e4457f171, 0x3158c901372ed7a6, 0xb4039f5b10a7d86e, 0x44e470b6359befd1, 0x4da98685f0b6425f, 0x14a1736feb87bb8f, 0x4e5a5a1d569837b8, 0x6a1cf61122ce39da
+, 0x3ad1e69bb4ba1407, 0x1e95afdcd5e0690b, 0x80499ba7c6cb5c8a, 0x2e5ace65454a2b94, 0x1a447c6a6a3c5291, 0x7a3a2866aa8ec647, 0x4a0354525e5cb363, 0x0108f456231d2530, 0x63d2203462a99609, 0x6072e77f6c25c214, 0x055a1d649104d77f, 0x4e20dbdce870eb0c
+, 0xf5247444a1303b0e, 0x19b1ce8e3f68c854, 0xa367d360af57a21a, 0x39927d7d17f326c2, 0x4577189f30797d41, 0x2968be34a8cf1643, 0x04eda7f2c9e8d6ca, 0x31b1254fdce05665, 0x569fc7c61c898c0e, 0x56eee6bf0bef056e, 0xad1f31deec2b2929, 0x5192ed817a2ace27
+, 0x6dd5efd7a1853e44, 0x05e6c9bc959f194c, 0x0877366faa9e7174, 0x368e0d4b69a166dd, 0xa19fbd03a31cf82e, 0x6ba8078a56cec3a9, 0x2f43307336cb2e6b, 0x428f0756c80cedc8, 0x7d3bcdc92a82210c, 0x486e25fd8a646683, 0x256c1600081f3c82, 0x7b0e0b072577b2cf
+, 0x0b1d271cecdad4b1, 0x048ffdbd873df8fc, 0x3ca873f3fa6b3788, 0x39c4b123830da1c5, 0x95ae1c889b513465, 0x65da6ff787351c4f, 0xc31ee6dd1528b631, 0x1c8f166f467e371c, 0xe0a908eccd158871, 0x03a80b5b0d094617, 0x5e4e9bf841366584, 0x19edfda34e7aa4c4
+, 0x32818d3dc3995095, 0x0081d370bfaa367e, 0x8c09b6596f047b49, 0x157a16f74d81dec8, 0x395621c1c9d99b80, 0x46c52c7575168d09, 0x5f46c520f22ad683, 0x2896c6b7815bd2c5, 0xceffa00ad239dd25, 0x3a4e09684e017e7b, 0xf0f7f8407ec44781, 0x6ce39bf421cc8dde
+, 0x397abf51d107810d, 0x36d55ac32fdb0d22, 0x1a7aee7fff3a4b3f, 0x5a98a7b96f3b6e16, 0xa49c2e1edb597017, 0x1ee8c99b9b30938f, 0x0c2126bb37a69707, 0x23a3093d667eb62b, 0x89116c46aba83cc0, 0x6cbd1817d98b75dd, 0x88dd4b897dffc263, 0x2127a3a78037b220
+, 0xf1b24b50663a2ad3, 0x0f57c5c92ffb0c4c, 0x4fb19e769d34cbb7, 0x66a5fd079303dc85, 0x2fd5ca57a17e6817, 0x488bc764eae5cc91, 0x8f07240d4fb1ec1b, 0x09f3ab78a6db7164, 0xc7af23f943ec5492, 0x053ae2495dafaf5f, 0x0dd84a4c6baa2a39, 0x39d0075d6dbe59a7
+, 0x2ef7d868c60763b9, 0x3f368d6000d52e62, 0xc4988977a9ac9130, 0x5c8e059d457c9e86, 0x0d47bc2c109c6b53, 0x67ecf77739eb0905, 0x55232250074702ea, 0x426b79cd203d4c29, 0x63bfae811d0e9afe, 0x6352f11200a66d11, 0xf1da8c1faf18fa70, 0x19dd13d44e8291c6
+, 0x1141fc565054003e, 0x5c6f84affe140130, 0xd71cf4755964ac42, 0x150797d5d1f9a2db, 0xf66aee5405efe9da, 0x21a1534184ba3081, 0x4a61816d0bbebf16, 0x02104088175e9742, 0xe6885bca2c6f0dd7, 0x34c07ae469a2fc39, 0x05f4bac4172ee6f9, 0x63ca2094d9388fbd
+, 0xd912b41fae5ad4c7, 0x712ab575d5835b57, 0xa8bcf38cfb0abfdb, 0x52311c8526e76b81, 0x3531a216907e3f18, 0x0afb8cb6add02b74, 0xfd31e9122c03c6e2, 0x30c4648828b4c3c6, 0x9dd649ba0d1da032, 0x320a619cb2c6c8e0, 0x3de853e943c4dfba, 0x7a4df1d300508036
+, 0xacc66be8dd9a9b12, 0x6eacce8d9dcab196, 0xab54f8fc41c3c9a9, 0x01733ddbc9bf14c1, 0x26506e2ca98abfd8, 0x06dcd667936ab798, 0x84bbd52b9a7cb871, 0x08054a2ab9acce01, 0xf1795290404535ab, 0x7303ee08c59dd9da, 0x434a76655d44ca1d, 0x7bac9f5c0623a02b
+, 0xc23344a80306be04, 0x4f6323da7ea20466, 0xf830942abf8a1117, 0x66211a65f1bc7ccc, 0xe5b70a51362f9b7f, 0x7074569fcffbea60, 0x0ac62aca2ace2545, 0x627fcd2817f63f37, 0x24740ac689b01f7d, 0x4e039345a4cd443e, 0x717147d83c7b49ea, 0x7635dc0b4a54d138
+, 0xfc91e537a16600ee, 0x29771e5ae8357191, 0xb66820a62dc3fa20, 0x20d78b2da5eb8f8a, 0x22a6a132fad8b18e, 0x5785e50fc3379252, 0xf277186563f210e4, 0x675d319681680191, 0x6c277876391c8f57, 0x0c8b4702ff151ae7, 0xa6745edb52b793ab, 0x79aef253b9b92273
+, 0x324353a234523dc7, 0x6fdf43c425eb1320, 0x73954bd3d98399d6, 0x4bea072b88e594bf, 0x0256b2aa3c25afc1, 0x11baa715a72ab3b4, 0xed1012b311558e75, 0x481117b2b3218f16, 0x7ffc94c98192b2ae, 0x75cea5e018e43916, 0x1102a549948106b6, 0x57903ec55197c264
+, 0x331b3fd42c5be5c4, 0x4c46dcffddddc7cd, 0xec8d52ab9043283a, 0x067240d4638f9174, 0x3d95a7d0433ec481, 0x670d79b3ee7275fa, 0x23c99b50e6595182, 0x55df91df729d1bc9, 0x1e919692887bfab0, 0x77224909d962fc82, 0xd112a6b1b581b071, 0x44894021cf4891f7
+, 0x39718d91e36a4a36, 0x7f50c00b1e631dbe, 0x672fc28e8dec8716, 0x2c06cc082cd67926, 0x03236fd00d176fc0, 0x216ceffeb79f4407, 0x46fe68f56b9ee108, 0x31bea1dc04404639, 0x5008ca4aa982c979, 0x1d87194af4885649, 0x92cd56eb4429b9d4, 0x5bb7f9190f194fd5
+, 0xcca48db060e6f8ce, 0x45527a28693d6b1e, 0xb39d753aa5ecc5c2, 0x2bfb9a09e720cfb9, 0xa2ee74464ed13fc0, 0x3fda8f5c0bf90598, 0xabf18ff9cc31faf2, 0x30f14a1e54cb3075, 0xf6fabeac55c5122b, 0x57acb0d0909483af, 0xba12f0c1db21cafd, 0x735b87a8a334808c
+, 0xe27603efe7737938, 0x7997aecada8dba4c, 0x9d7a90e75f763365, 0x575122e488dcbb38, 0x49ebf39787cd6d77, 0x230a8580a6e8e009, 0x1cf41bd93f22732b, 0x2767274fbccdc7cc, 0xfbb6078cd1af38dc, 0x33cbd1c0d3f89a94, 0xd7d03ee8ce2ea2be, 0x52af28e551f20b67
+, 0x4ebb10f073fdfda3, 0x2546106f6e19ba8b, 0x55a8c39f40d837d7, 0x36d46944bbeb067d, 0xbda0b7c6f6027d8f, 0x1f3a919d3402c4c3, 0x5d0bb9931a77d8c3, 0x5f1e3bb8ac64320f, 0xfa2428de13ae7cc2, 0x430f6564d7d7cf34, 0x793ff72dc57f1012, 0x73b752ba86cb6b29
+, 0xb52f374f420eedb7, 0x1266e364839cc0a9, 0xa6c9aebb65792050, 0x61a5e58a38a13023, 0x3c818e5354581b4b, 0x1b02930dcd65169c, 0x665f71a560d2e798, 0x742b407bb82b4ece, 0xd72ebd348a9db12a, 0x7e07adf60c71d1c5, 0x64d185a2ae1491ef, 0x533ef227ad39a995
+, 0x0de170906768f35f, 0x4da09386b8e6854f, 0x85ad732927198f96, 0x754000a0da07b1da, 0x5784df70964b1f05, 0x083a92274749b61a, 0xf8af5339261778ce, 0x3d58d3823c8787dd, 0xd1f9622bd7d9112a, 0x40155d6cedf0be32, 0xe1458e483876420c, 0x4f51d7e12301f11a
+, 0x445f81879e25d11b, 0x0f5e625ecbddd94e, 0xacdf4c1102ccd20d, 0x62e16e58de4cf785, 0xae693a1f9f35fff2, 0x52d72f4480d0c11b, 0x3b317507655ca4b6, 0x1f189cb7251864ac, 0xc580f378d57ebbd8, 0x5af753f70b54fe35, 0x9374cf2d52998c93, 0x7345277942dff83c
+, 0xb629c2f9c5f96e27, 0x22dbcc3af5a0da76, 0xd62df2eaf7ce9054, 0x04f3747539c3bcfc, 0xa3da8095d022bdf0, 0x3b77ff2cf921aee3, 0x6dc71266ad01006a, 0x6d18bbbac898a6cc, 0x448af441c7362cf3, 0x7865a4baab75b0b5, 0x02a5c2b03f9a0648, 0x3077e2ca8477a20a
+, 0x04a31b80e00b52cb, 0x2d391118a903b3b4, 0xd59f9ffb693c2a08, 0x220ab3ada7976c3e, 0x2ff05b37eb00c8f1, 0x0350095a94c04e23, 0x8f2b66f9865d984e, 0x3b653c1f9602b877, 0xe2f37417358548df, 0x468107f7d063fe8f, 0xa40dbdb83bad5cd9, 0x160d30741df96fb7
+, 0xd8c74eb39938ea74, 0x723ad67012e960cc, 0x008bf95648a33f4c, 0x0066d58804e31c94, 0xf987e920f4559198, 0x1be827f9107409c2, 0xc6bea658ad41a2a8, 0x267054efe736d926, 0xa848d73e5ad3d973, 0x649f8346dd5cbf82, 0x78a939c3b8089dd0, 0x63363b65f71939de
+, 0x54f2bf403b421350, 0x32f0e9a6fa06437f, 0x29220d258a9fc37b, 0x53962584e1f9de8d, 0x04a8454155b4c040, 0x513c361129fb0351, 0x7833e144ed8a6c07, 0x0cf712fc43f3ac7f, 0x7cf6fd8b8bcd027b, 0x35048a142ce4d7f0, 0x8c47e7fdb5648fd9, 0x07423cbcb54a6f10
+, 0x13a284361335992b, 0x2210ea765a375b20, 0xbee154edc794dd6c, 0x54e8be2f32c8c700, 0xf0746996d88da0b8, 0x2a92d06416edb415, 0xe22958b31fc3735a, 0x4c89cd91daec6b72, 0xcdb88b550a93517c, 0x70c3c447118ddefa, 0x3c224d1bace0127b, 0x3e349fcb3c1df22f
+, 0x91f122fee9b966dc, 0x2d8a9854bba5bb5b, 0x842833b7f77b874a, 0x0438cb62da4fe9bc, 0xbb345e2d9d9e7324, 0x7a35b8556b660574, 0xf7765068289393d5, 0x38d0c7a44fb9c7aa, 0xcf34d83cfe732b7b, 0x6bb0075a53679126, 0xd4ae7f7b472cd45d, 0x048cee7c7fbe6a17
+, 0x7fde726f6ed2b199, 0x1f5937cef0812c1b, 0xe8638bede8c7a79c, 0x3b3ec8fedd3408a0, 0xac10446dae89a29a, 0x3558fa2093cd6591, 0x94311e50b32fe563, 0x0ebc0cc66a6ab512, 0x766e208648a9c4b0, 0x01c129e3cc1d6005, 0x6426b6264e8fbf73, 0x72d11d487a637bed
+, 0x0669647c0e135fe7, 0x3ddeb9faf0e9db7e, 0x8b12209f862ddf34, 0x1e076ed9b52fecde, 0x41541f86345322d3, 0x65a8ce5e8561d16d, 0x2dbaf0ea2ce8639a, 0x5cec0142c3435442, 0x5aec7d7f323504c6, 0x42fd2b0833ef8545, 0x529c4db8d8560b74, 0x4e40c221a648b6cb
+, 0x5b65405850ec315a, 0x529a56c7972c03ec, 0x9612ddd177dac86c, 0x76a0425935fe79b6, 0x03fd1c11c4aff4fb, 0x75da6662cef7bede, 0x7e02937018399e82, 0x5bc98e3ddfdf8712, 0x5bc70f5919beee7c, 0x2332a8c0d4bd1e6c, 0x8c5d2b1fdd245b36, 0x31f4205df7f3ae3b
+, 0xbcf061e673986fb5, 0x5384eb633abd8e5a, 0x3e8044ceba59e38c, 0x19eec50f918b1939, 0xf353fc38483702d3, 0x7f07e56ae65fe9d6, 0xb753de66d3c1df33, 0x38d654493a33abd8, 0x789a8c39caad50bc, 0x2839b3f483dd2ae0, 0xf3dd04a0d27879b0, 0x5b12d42686a98706
+, 0xd02e20017351e39f, 0x47d9e74c6f6821cf, 0x55511c0b096dc860, 0x291e3ff8a6f8a760, 0x6686cf8c32322553, 0x0f35b6ea7fbcafdc, 0xf7747ca7db972820, 0x1bd410f78f30386a, 0x3865a6465deec438, 0x459e8000738730cf, 0x43a46f12d245d301, 0x08db6e64b3bf05f3
+, 0x6b5378b710e568d7, 0x6b9e401cdd23c973, 0x02a102e3bbec3c27, 0x5db43e2143a20202, 0xc74e4aaa8ff4c096, 0x08e1b38574e820e2, 0x44fccd59ec20edeb, 0x216eae43788c337f, 0x37d8d0c2acc60d44, 0x0d0d4ff98e3d0ab5, 0x1cfccede61bf1c1b, 0x05a2935b5863d570
+, 0xb5c2130c903fc5bf, 0x3c436ec1b62cbc2c, 0x5946c7553462c166, 0x4fd16b0a87e17bbe, 0xb52f369fd584c972, 0x195c379db7d651d1, 0xdc540e5e6c732b06, 0x1b75d7fa710e6b2a, 0x8a4d043803405745, 0x3b3213c7948cbf59, 0x89c52e9b58d355ec, 0x5d152db03455b904
+, 0x7d24872f6a05dd37, 0x1f3cad97d578f224, 0xba7237d0c15911b4, 0x1b1d9c9e31f888a7, 0xaa5bf93a33facfbc, 0x5500235327a4707c, 0x6c0e3e78edec0187, 0x22f70cf32dfac713, 0x47b1dc9bde8f95cf, 0x00b5063c37c59971, 0x344a0eba10567ab7, 0x40e29218b86ee40d
+, 0x607678e1fbcd0486, 0x7fa9e9facc510e79, 0x591b50d0996b0f38, 0x25b7bda74d24caa1, 0xb8c7364ea6afee25, 0x4f4cdff327b8f6d3, 0xf0b9b7adb87b1792, 0x3932c427e64eda22, 0xab9b85a87cc4b85a, 0x3fa65bc48ab94145, 0xa8a7a3288c7360b6, 0x1e99a83daa93c4d0
+, 0x7a386682ca74cb3e, 0x6dc3e816730bebad, 0x06225945539d42d0, 0x6b49baea632284fa, 0xac2170827ca28489, 0x4968aeffb048c5ec, 0x8072950ff59889b3, 0x66fe5e33ae4c733e, 0xc81c2ac022db1ee9, 0x1728bc47069661bf, 0x08acecd24396ebb4, 0x12e8a34b82a8b982
+, 0x55ff0cc9df1dd1be, 0x76589bbc91021da2, 0x3adb96842f2eb388, 0x698f0428b2c676a4, 0xd45f4094c7fc5105, 0x3e6e2b7c2913bd0b, 0x27589385b020bbdd, 0x797cff7171f3db76, 0xaaa9f3b5aa898d18, 0x79bdb34037238cf6, 0xa231022589496139, 0x27e66679f25f162a
+, 0xc47514bcffb0460f, 0x057d44bd457c0249, 0x56ff890982b2ed89, 0x311f08b099fe9708, 0x9aaa7b9913fba073, 0x63b96febbdaa449c, 0xc9c0c25c87904b22, 0x3e8f2411cf20abda, 0xb0b055e6c5b1cc6e, 0x6228164d2c998418, 0x4832e314e919c0d9, 0x29bb9a82cd952a0c
+, 0xea2df71f1d5a26a1, 0x78cad78b98548aaa, 0xc2c01118ee4deb5e, 0x1140ddb714295e06, 0xc224d33c4ab107ba, 0x62367069fbbee32a, 0x8775e18bf048ab92, 0x0de29a7d01e78437, 0x0e9032cfa4c49cda, 0x48c228449e0013f1, 0x402ba09b6f84bc68, 0x0bcf46a7bb4e528f
+, 0x28cf085446c50173, 0x02a4239c85ac55d5, 0xdbcd31c039b64744, 0x62585ab7be6a5efe, 0xf6509cb2868b05c6, 0x1f26da788547580b, 0xbeecc3accba3c952, 0x311f822e947d96fe, 0x4f1e227f8c89d39e, 0x4458704c0f1eaabb, 0x021b9b6897b40228, 0x614531100aa070e2
+, 0x4f9764c806f2a488, 0x79965e5946594cbc, 0x7de5d6d90a838657, 0x22d64c077c2dcb8a, 0x82ab596ca7535cf8, 0x1214394a2b66dc5b, 0xa145da6a868def2f, 0x399a35784129dd44, 0x1c397cfc02dcf58b, 0x79860236bc8f2b27, 0x58ad4a924651607a, 0x305dd63cd616759a
+, 0x7fc9e9a73f7c1f35, 0x5446ccecd327ee7e, 0x0a8a2c6e03079781, 0x46c77c2094ab1cf7, 0xce8db8d9b19f06f4, 0x2717fec99d6db778, 0xe0c7522a34a1274d, 0x3dd851c62b096f15, 0x69efe9f66f4c2362, 0x78e0d7260a53d1e0, 0xb2e9d2465a9a33c4, 0x65c65b5941ac084a
+, 0x344e3a258e76e322, 0x2d5267da73f139f1, 0x327e081179cad0dc, 0x685b194949d4197d, 0x81f250f04be1c224, 0x51b879a5c0ee5989, 0xfdff15842f313d19, 0x5f5a6159598836f5, 0x1b9289d8c50a54e3, 0x0a4958ebe15d6177, 0xb6cb8bd5965b3fbf, 0x46eeb6639c67f4c1
+, 0xdffe7d34394d59a6, 0x63f8a46e86e08996, 0x6dd5840bda61da92, 0x1e61fb2a042ee2e9, 0x033885675fc6ac1b, 0x738f83aae1bf7ad4, 0x9bc24a15d990ab9a, 0x33871d373f69cc1a, 0xb7d4506f2d9bcd3f, 0x7853db7ca6a431a8, 0xcd73bf83d5db472f, 0x760b73ccb094965f
+, 0x1b10eb5d7d804532, 0x7522b12e1eddeacb, 0xfba8e85c76eefffa, 0x10b56e28fa90e5d8, 0xe82fc2023d8ad43d, 0x36209cfbbd923f07, 0x0eca1910472b738e, 0x0f658da04a45e1f4, 0x1b97be10a59b421b, 0x350e0a6e70dd4bfd, 0x3c0f86f2c276e769, 0x673516527768061b
+, 0x0eeedce0f3299a49, 0x0b06ed1261128350, 0xce3e3798537d134d, 0x560775f495e61926, 0x78fdad3b3af7199e, 0x71546dc264004233, 0xaba066c7fb044726, 0x5b9391d78a80f94c, 0x56b187f74886d90d, 0x0f14f96ee8d3f5d6, 0xe5bb610d6d37c0c8, 0x3574aab37c9bf95d
+, 0xb7e40ed23aa7a3de, 0x50f5fb227637f818, 0xe43c37c52fd6136a, 0x4935692c186e4584, 0x73e3a4b0534be810, 0x61422ba5ad2841ca, 0x8da71f88b14b8004, 0x4653c422ab79fad8, 0xf1a4c1ec3c6e0c52, 0x1ad7cae4c86e2983, 0x9f7b78ed710547dd, 0x7f3b5d5dc17eae8a
+, 0x41eea5b33c2103a0, 0x5698756f0420f3de, 0x573312e8c56cddd8, 0x6d5e58cfa90bd963, 0x64303fdd8c938efc, 0x76d0f2134fb64256, 0xc65a6f17d233ca24, 0x14a90c98882f8c0f, 0xa54c81fcecdbc7e4, 0x3e62cd309b6ee998, 0xb75c6ad0d187e825, 0x0839cb588e17b917
+, 0x39f53aca9e5c1764, 0x28435526f0a042b0, 0x5ebe068e5481b3c6, 0x07f030f079fa4442, 0xd9dbcea3b5061232, 0x20119cf48c6fb945, 0x0e1e8e54eacabe41, 0x2f4a403609e9edd2, 0x8af7dcbd89958a28, 0x5df099ab642427a2, 0xc99055607d235e85, 0x06f23254b3f62fdb
+, 0x844058f0cef77d04, 0x7694fbe1c6f97ce3, 0xb3ae12f62fa21606, 0x3371cc10d356ace4, 0x3b42dbe8274bbdd4, 0x63203b400ffa7c17, 0x90982cd8edd65906, 0x5dc780dc01ba3d3a, 0x44456e554ecc99c4, 0x44508dc96be58518, 0x0811b3df3832a64c, 0x3f60ef8dec84d59b
+, 0x6db1e527d3631cb0, 0x2f0a7e78076e05ba, 0x40d7da80c49aecea, 0x4cb0a48ff5271755, 0x2272712907e5ecc4, 0x2ceb3fd76a8cd7ef, 0x383d72050fe93f03, 0x75d48521393a3958, 0x263741c4b2c815b6, 0x1d1bf6ea357ff9f9, 0x4bb2720c7bb15c7b, 0x2ddda19be8d9de02
+, 0xc928fd7edd7ec8a7, 0x076a66615977e740, 0x1ed1d185a6466de9, 0x0c748167bf20abcd, 0xf3e44b4f764460dc, 0x508b2a429578bb79, 0xa92ccbedbd8e6bd7, 0x3cb00dd1b1719967, 0xec4fb2176dac9ec4, 0x6943285194c3ce6c, 0x0dc40ded1f6b3e84, 0x5085b12b41e8221d
+, 0x9be60b17716f80ef, 0x72b17eab6a93a37e, 0x5b021c647cdd52d5, 0x353c5f53606b616a, 0xefa680cbd4a05ab1, 0x17600113a4b43a65, 0xaaa3c9361fd1ae32, 0x4f18f02fee93f3e1, 0x4f18bc65ac0580bd, 0x0433136d779d8a6c, 0x936da335ed9923e8, 0x5d04047df94d736f
+, 0xc29ad60255ba4b39, 0x1e54a3b9f562be53, 0xb4aaadc18086ef8d, 0x07173325aacc20ce, 0xdabe9861b41b83b9, 0x7bba81f81d8989a6, 0xe973b0117de618a2, 0x4d85492e840b1fa2, 0x595ec76bd393286c, 0x7a3c670b15c24dcb, 0x78d3fb36a6cd7a94, 0x0e7a59d4177d685f
+, 0x0744b4bc4a397195, 0x67c62fd1a80b5752, 0x4a7d8a055da079bb, 0x15d4315967b78d1b, 0x436279dc8bdce7a1, 0x039636ec0da43db6, 0x1e02349fe633de62, 0x267e70075b08d741, 0x8407c85194bac5e1, 0x3bb7a5d991ebca8d, 0x9895c18cb45ca072, 0x47731178ab0cfd27
+, 0xd1c94977863228d7, 0x6dc5b937164c3ffc, 0xc328f645537bed0a, 0x5c88f207a2a3e48d, 0xe922bfc35c6287c5, 0x633705d474d3ac74, 0xa681fe4408b88117, 0x7557494f5b5fc1c4, 0x34177518a6cef07a, 0x1d6d4e86ab30194b, 0x1395c594f5086819, 0x32f3df9443afb1e0
+, 0x3498b69421dc09b9, 0x075684a7c5a358c0, 0x85a5edfaabceb140, 0x33bd4b8ed161918d, 0x785b9cd41d2a3f79, 0x24ba9412857c0ce3, 0x99fcd8c920ee9e22, 0x7488fdd2e917b851, 0x9f523bb0c2a6839c, 0x013f8d4e5e7c10d9, 0x5a899dbec1ea2546, 0x59c1f58f2c4779e1
+, 0x480b0934ea55d6c0, 0x401b398193f74a32, 0x4a9423250f507bac, 0x39aa912ee8744733, 0x94616ef861932b59, 0x3b3c8695af688cec, 0xb38fc83ba452e277, 0x5e67ab521aba56c3, 0x20fd3d50fb738919, 0x359ce426912604b0, 0xd22fa24f110de8d9, 0x41fd472f7be3ddd9
+, 0x15f17b4701f1c3cb, 0x5a40994a0ad37aaf, 0xb03483c2bfd9fe5f, 0x6e46c9a6d46f5a84, 0xdae836e9b5395ebe, 0x372b90a762101d18, 0x82c53651c1c0d1fa, 0x19c6e3d0372cc8ba, 0x72412b4b6da967c3, 0x5ed2ab1160b7c707, 0x63e4ca09671bcda7, 0x5d5efe36efbea963
+, 0xd26bce0f2d7cad78, 0x59d271602ba40311, 0xd1b80828352c2f8e, 0x04343f4b764fd872, 0xfde8eb5b62ee1641, 0x4d596a4cd3366295, 0x8a6a35af4910f67e, 0x7a6dc2d942660744, 0x5e35a016c8690ef8, 0x6d8255fc693306bc, 0xf680f2bc91094a39, 0x2682914314aef354
+, 0x2434d0dbef75f44d, 0x393a9cc26a0bd634, 0x695111b421be4e43, 0x5dc07088e470eadb, 0xe959d7aafabd9d06, 0x7c57d35a9e008520, 0x8f826a09f5fcb018, 0x49a7c0ca602e0293, 0xb509ecb38fa97fb4, 0x0bdb44732001fba8, 0xebe4e86882862f7f, 0x1a2d6f0be6bb90f4
+, 0x37c6991316d08edb, 0x3d00222a680b7041, 0xf943481a22a46d85, 0x1fd0148fc65619fe, 0x6cbf17738df0e646, 0x5acc64d3ec676f3f, 0x89bf982f046480ee, 0x1cf665634185c6b5, 0x08b00df786dc4ef1, 0x7dc35903a60cfd6f, 0x28408b9755cd72e6, 0x02264abe8878e44c
+, 0x44851b4a0117f85f, 0x535a758f72371e5e, 0x0c920afaa79db24f, 0x4b7c37567642e71a, 0x369d04f298b9bf7c, 0x2ecbc3a18c0d0a94, 0xbde55b5f2b7b6013, 0x6bff4dd59cebc3b6, 0x6a7868d7122151c4, 0x471f8c942a051008, 0xd5c4a64fc88e148a, 0x501f209fe5966a76
+, 0xe6e4e092ecb6d296, 0x1f9be022964eba8c, 0x6cb0e55801bf7d6a, 0x09517ed04ce81e6f, 0xb2715758377cc305, 0x2462fa1fb9b96658, 0xaed260c686f60189, 0x4ed9c0b948c407de, 0x2974b631c271b472, 0x766f3645b70d0f33, 0xbd6eb602e81ef0bf, 0x4bed3a07fa216751
+, 0x0c633cc20107a266, 0x17d7ea71abd245ed, 0x539cb97dcca3d3b6, 0x7cde350afdcdf835, 0x9af338928659b49a, 0x3e94df1aa203bc85, 0x6cd054a85254345b, 0x1683becb78c6e52f, 0xb772cc47aa94efab, 0x7c053264d1d02ff8, 0x099f4498d350f5eb, 0x2c7394663b3fedd3
+, 0x7a282030228983c2, 0x1039d965a1e63101, 0x882c01488eac63f0, 0x30679f2984de862d, 0xa1dc76cdaeaaf420, 0x6a08afb6bdccbbf7, 0xbb75442374009fdc, 0x747da8810143c814, 0x20176a4b24309ee4, 0x1ffbf74fe100c3df, 0xc2f631306115aba0, 0x4f3831c308b6e77f
+, 0x914c5eb03566b6ca, 0x58469156f195e0de, 0xc6ebf122142ae7f6, 0x6d85dae9f22a98f1, 0xfb1d139a2d6a2b0f, 0x282faca2f22d2d13, 0xbc02646a6ac63acd, 0x73cd5222ea3e06aa, 0x683867e322d9264f, 0x74bcc88063dfad9b, 0x6226a788b7c4aa0a, 0x2ef5f91e1908b4a9
+, 0x653c765f012176d2, 0x48c2746e04c1c21f, 0x294bdbf149f937e5, 0x48ac479df71261f7, 0xc7e68ea3b62643dd, 0x5f8f9b1a56f553fc, 0x7342ebf74514f901, 0x7604bc7a911c5f57, 0x5888a1aefbc59558, 0x269fb9d61025e45c, 0xe2ff7c84fc9af215, 0x78e4454b7ef9974c
+, 0xe65b898950a36630, 0x315e2222f7fe47f0, 0x66cf0bf20e1a63b5, 0x3775a5f03e02484e, 0x2c01eb17015c6c99, 0x2c127f011e676f68, 0xbcec552dd96846ac, 0x447912f9afaa4811, 0x3ce6f7a45e664a03, 0x72f4289f0c94e311, 0xcd66cc7b9818b80b, 0x1baad325616980be
+, 0x7ca2fd30d5e2a1b2, 0x3c22aa8a4670ff7c, 0x55d4f61856d28bd7, 0x3fd4cef1d2aaa007, 0xb7b4c4e569a0820c, 0x2dd12200ab9c4493, 0x130500ccf73e57df, 0x076f411a6e556d48, 0xda48d9cc6b06092c, 0x52b0b54ec13dee2a, 0xd106c068014b3eac, 0x7cc108d3cc2ff23c
+, 0x51b668889767a569, 0x509ed3eb893b4fb0, 0x09aa7a9032ab1354, 0x23815cae74fe39ad, 0x2f5ef347fdd1d7d6, 0x61c94756648f9870, 0x0cf8c7e747ade0fa, 0x2f25d561a5d0ba36, 0x73fadd7a0905635b, 0x5567cac168b2cb30, 0x1c635f68b383eb43, 0x7bbcd8eaccc1b933
+, 0xf1be59c2ab5d474f, 0x3f33bf517b1cf9cf, 0xaad3f8bf6ea161d8, 0x7aaa7be718176a45, 0xed21bfe48a4807ef, 0x0aef66ba275daf90, 0x79ec6b9806deae9d, 0x5603d3c4691d924d, 0x643584c46e90772b, 0x23da1a82bbad2e5e, 0x24df70de4a0e2670, 0x213a401ac71e9981
+, 0x64145b5f39a9e5a4, 0x6395c8d8749b394a, 0xa8d60c206f483069, 0x4a81c819bf5eafb6, 0x7ba2c5b533d003de, 0x163ae6ec1c69eca9, 0x8f31231b42b86357, 0x74c62126a96cf048, 0x86f9fe38d871245d, 0x5b4f4fb2c7d9f8bf, 0xe64fffcc4084feae, 0x70ecc8444417fc50
+, 0x9c9bd53ae51aeb95, 0x2a67dfe104a77a45, 0x97c7bcc0e6da4206, 0x1d0510cd219c58bf, 0x78cadd51e78f77ee, 0x7270323258b08efe, 0x751f07b439aa7ab9, 0x206e970449bd271c, 0xeaa7245e15531eb1, 0x6a37f7ea7222332e, 0x709eaa5226bf89a8, 0x02765bcb28947a72
+, 0xea61be2d999c4fb0, 0x5d09775d002addbb, 0x721a677e2a0d97df, 0x4e8124d20d96c3aa, 0x5abd748259c42b85, 0x7773348f56c1b54b, 0x75b4d672e7d547f5, 0x7be31b135ff8cc71, 0x6442a63987644242, 0x3048652568445937, 0x3317aca8ce4813cb, 0x0d5918b4ee0de669
+, 0x8bec676993302ee7, 0x60f74c6e8ead24c2, 0x2c8b5988e3dffccb, 0x3b9b172f5f066b85, 0xf6425d3f3aa81d72, 0x6dea58f5c202f2a6, 0xb38eaa094a9b355b, 0x73a333f5b3e38ea0, 0x667bfbe548ca57b4, 0x13850cdcbe26e786, 0x0d5893e3923cc91d, 0x3eab1e7a2930971d
+, 0x6c1e20ef38430605, 0x692e425f0c198e47, 0x1f62642e459f0d20, 0x226444161807a91e, 0x70be03346483835a, 0x3b5e447f137a06ca, 0x8277f09f868ce10f, 0x483935c332da53df, 0xc986a1ab346f8fa1, 0x564f27dc09b3be91, 0x3748a792ba329c9a, 0x03aa84ebaafb80d3
+, 0x8c230fdce4ad0448, 0x5f1ed30173bb796a, 0x80c47792110316fd, 0x1663313218a42d95, 0x2dd65b8485cc9702, 0x3c3fde94135d0073, 0x2779534fa96b1cdb, 0x675194c914d3a885, 0x11dc51cbae8b1157, 0x4fc90cf7548a3f5b, 0xb1a2502bcc149e05, 0x3b83284c0867e9a7
+, 0xc264b9f6e4b3caf3, 0x727ebd0f4e598317, 0xa1137b96d17269ab, 0x1a95686ed923b593, 0x6b66c8d3772546ee, 0x42c6f4df2abfd27e, 0xab8d7991583f308a, 0x40320b94c189650c, 0x135c56948ce74511, 0x2171f02c010031af, 0xa87f0b06e47c64ae, 0x41d0b491d4018fa4
+, 0xf0c1c15fd2e6663d, 0x55abb93b328be66b, 0x45cb1413bbeabecc, 0x51e81290115bda81, 0x9e65b68f09053d4e, 0x1dcef798225ed1a6, 0x89d1617a66ab3c4e, 0x0db143cc2297bf66, 0xd040120deb46b765, 0x79038da3da43e211, 0x80bf37e325365091, 0x1d4a3e3cfa92a14a
+, 0x19e04d1b2b0fe7fb, 0x56381ebd8181b50e, 0x5c8970c249df4ac3, 0x08acaece8ede7685, 0xc44f1a71aca0d20b, 0x623edc8d92e4ac3a, 0x5496a7e5885a0c95, 0x20a9ba37315b116e, 0x3765873809f5b55d, 0x23c44c42ebef2ff5, 0x56a96d921f724573, 0x3217815b72b8a9eb
+, 0x2cc1b42f5350a489, 0x31f0b36e85b8c70b, 0x504a5c8c4d2ce34d, 0x1af8ea26b3786eac, 0x69bc5e26d7afd62f, 0x21e399d04247bf9a, 0x6e6d6676a88efb27, 0x476212b9fe9a6fd4, 0x0740fb65284168de, 0x5f7570be65e69408, 0x0166c3279dd81c29, 0x6565489007c4ed6d
+, 0xbafb5bd37b5219c9, 0x00251709f2e210f7, 0x0d22639b51c1198b, 0x0f3c0df3be3de811, 0x3552612be3374eef, 0x0834744318ffa0aa, 0xcb9f1c1e3557a00c, 0x20c359f5de8b6614, 0xd319482a34d05268, 0x42165771b46b75d7, 0xca336c22e8d911a6, 0x4d072f70067a47e1
+, 0x9022c6f101555e9e, 0x4c8c7eaf7cc2d697, 0x629810b2d8044817, 0x25110bc01b06c9c1, 0x1bf9c06bf39eaff7, 0x6cc36f151f52b4e8, 0x76b73a6a14b62068, 0x47dcb0dc89db3821, 0xfe9dfeac2f670f41, 0x625b5c93b973c417, 0x5f8c917930133c1a, 0x6bd35f3e0992bb2b
+, 0x03b5391a85409e5e, 0x7981d8fd16362767, 0xdb45c80a32a23cb6, 0x67356a7ef48b2dc3, 0x6189236e9f01adaf, 0x07a1e954e5032bd6, 0x53d627199c69727e, 0x25d67e4163cec014, 0x18e7bb6a63a80738, 0x3112be4cb5dcbc74, 0xad9ad6d381643f04, 0x116112cbeabb734d
+, 0x32623abe2d66ff07, 0x4d780300822436de, 0x9bed066c04497808, 0x40db29b39ce86700, 0x6e5e5eb3805602a5, 0x52f227f2b1b9b40d, 0x51c2c4c197a18394, 0x6d8bca423ee270bc, 0xd6e60cfe8fb07f72, 0x7dd66c3970f940c6, 0x66aea7b59a0b17cc, 0x75fcf8b00160d729
+, 0xbedc5ea39b2402b5, 0x0dc3600425feedd5, 0xadc1ddf2cb1b6631, 0x205ee93e3aae976a, 0x7a2cb4e333c98498, 0x7d12eb776d56872c, 0x8e339bc1b41599fe, 0x4600f0a53fac9427, 0x1049d3a372f14304, 0x7b54e020b22db742, 0xd567962272a35739, 0x27a1178b1115f0c4
+, 0x6cfb39d619c35e1b, 0x5cb96fd1a9d9d486, 0xaf45cef7fb4fffea, 0x4a73d7b2ba9321d1, 0x44b46b4a80be86ac, 0x2769b50579e8f734, 0xab5d109e7472f372, 0x2bccfba1cbe995b6, 0xc00026115332f6a3, 0x7acb287da1561c53, 0x21555c608cd90dd9, 0x7731d1b2878dae13
+, 0x32122bf5ec1a0649, 0x592b5fa180ec8467, 0x876be1b5ad9ce66f, 0x484c1cc5bb34819d, 0x08e4cc425b30b06c, 0x2766065f0e4d22ce, 0xd90825644987aeff, 0x3a835fcc7fc456a6, 0xf4d801d2cc806d69, 0x41d767ecca55f839, 0xf2dea9fd01f1e74f, 0x74d01b97462211cb
+, 0xe43e280ad29f80cc, 0x5cdf66a69029b231, 0xe8d655a03c862cd9, 0x388e38b58d0e8c79, 0x5d9aaa4848ff83a2, 0x14d6fbee4d6cbe74, 0x0426dcda912109ea, 0x1bb7b9cd75d4b541, 0x3a3c0504b39b8505, 0x35a3c5882b31367a, 0x678793d635a6473a, 0x66abca7e20202034
+, 0x4a90ff1dad300021, 0x18f29036544d2684, 0x2036d39b8f69095d, 0x36490f5645d18cc8, 0x9414d7368ad3562e, 0x7f8108a04558487e, 0x93db0e56d653e40b, 0x03f413ea960537bb, 0x984717b77f7267ef, 0x6c5d9da4a5ee7305, 0x725318dc36060a49, 0x274397f8e79a239e
+, 0xbda7965b4095bab0, 0x6292b2505c7866e3, 0x451fb6a0672d6733, 0x37c560f40242a859, 0x151e56eb818f1423, 0x63451986f0c22ee1, 0x9275ff873a5c75e1, 0x178cdc734a32b96a, 0xff7adbb24244aacc, 0x76518aa0dfd96ddc, 0x161c1c8c81071219, 0x0584d44c10a3e6dc
+, 0x2727282a09e9acab, 0x1298e49c34514ebd, 0x0323d059ca1c0e6d, 0x6072c8b87dd26bc6, 0x36eca2ab28d36f26, 0x2a977cb5aae4ea2a, 0xf157d43a0b9546a7, 0x04d60af0ed661d29, 0x34bc1080126e4402, 0x7677ef9a21589171, 0xbd13797278f07a40, 0x32c0daf0b57f20ac
+, 0xbc83fd1b8366dc2e, 0x6cd07286c4e670ec, 0xf35485a3f339dc8a, 0x6e7e9285f2247e8b, 0xa9d19d3a09943bae, 0x43fa5197eed852a6, 0xf911398a043242fe, 0x4a100dcb1312cbe9, 0xbe2fd86be910a692, 0x614fd829368d7937, 0xdb5a98b1a92d578f, 0x46f1d23e1b0dca7e
+, 0x8bf4c6725e813f36, 0x68bc89078129ce91, 0xff56503ae28f5c7f, 0x2b6e0f4e42178ce5, 0xa97cd947ec65895b, 0x7aa90b66280ff6c9, 0xebbaf32df158a0a0, 0x6a748d0ac02bb713, 0xdf79b5d619e83397, 0x16934947f6485b69, 0xe75185521ab32881, 0x20791e276a7460c9
+, 0xd25c403e22c70bc9, 0x0bf079518e66e1d3, 0x45dd5c971d3711de, 0x66bd2c6a30be232c, 0x607829e5b29e53ca, 0x30ed414e71dc08a2, 0x3fd38589ea0f1d39, 0x5a881a121f37fc5c, 0x27b9394368987a4f, 0x321fe45e13afae2d, 0xc6feb75080f33ea0, 0x02166d52f45eebbd
+, 0x15026a1b0ccd2fc9, 0x1141be93d5bc3d6d, 0xfd20df606fc676c9, 0x4059e26b00ad78c4, 0x0709b409cec6b505, 0x68f020e8acf478e5, 0x875d77d1f5df0cfc, 0x66eb377735162ff1, 0x860482ab417a32ae, 0x21175f47da213935, 0xa07ff0cda099ecdb, 0x26ae5f177ae2b8e7
+, 0xa9a070ea5120eaf7, 0x2581feeba7383f81, 0x49e0f137f1fa2a7a, 0x7fe93c51cfd1ec62, 0x2d74dbdca7777f7e, 0x562da2ba74e823ff, 0x543b4f8609d77a2e, 0x3a0f65212f234ec8, 0xf842e3fea270ebc6, 0x4524322c6a289e11, 0x80815887aa6a8576, 0x46f49d53c3fe29a3
+, 0xbcc93cedfdb0d388, 0x4db312076ef0ad2b, 0x1f2cd56373654ad9, 0x4c6446970034d15f, 0x34d2cdbfd5d7130c, 0x6198950d03db2ae5, 0x736094b72faf1b1a, 0x1f6ca46a9f2588f7, 0xcba0b03d6259772a, 0x24e5a23d8d6be3a8, 0x7090e340c94f6d6f, 0x287ba27ee54e8466
+, 0x87320c8822d607f0, 0x44fd5802509df171, 0xf35c09860bf6ba4a, 0x6cf53130ef77cc0a, 0xaa81167a00b48ce4, 0x649f4c775b0d8b48, 0x59a25683ee98d33d, 0x651479007d1061a6, 0x155487411f6e16da, 0x411d036475404bf2, 0xc231f1344162458a, 0x4f36b7633f7dd368
+, 0xa98ddc0a4e7a89a4, 0x55d8a5da6eacd542, 0x5c3fb48b1001ed45, 0x5c7785ccafa702b9, 0xa64369fd216afb79, 0x1f405ef10e940669, 0x755f4831bc327b6f, 0x2bc1b67d71f1882d, 0x8eab15cfed7777d0, 0x517370d580d99326, 0x0811b75701c9db39, 0x234d84cb52f7b621
+, 0x970c4fbddddae49c, 0x3ba8d842475e41e1, 0xb0720f6ad75e7008, 0x275cd5c5184bf345, 0x5eb9833888d3796a, 0x1b3a42dfde11c2f3, 0x946548fe092b5f4d, 0x119917b50f263cc9, 0x622de955a20a3f82, 0x6a552ea3a60c7ff4, 0xc79230138150372a, 0x18083b9518de76a7
+, 0x55fb74dd7d3b5455, 0x523eea9a70ff8334, 0x5994a7335e356271, 0x3bb011f60430f1d2, 0x1ec434cba1d6ea7c, 0x69b632960feb5780, 0x46c50417541ebf07, 0x01470bfbf9d23830, 0xe9551f4c049bc5cc, 0x1c124638f35ee8ed, 0x09ca3a9141e83a38, 0x44daaf3e7411127b
+, 0x0e54717b6c2fcd10, 0x518ab46b26d5914b, 0x528ac6c82341e833, 0x2247fa99d41f4672, 0xabe30c65c0f327a2, 0x3ac74e012b77e1b4, 0x35defd694c0e86b3, 0x7c382e10bfe60e4e, 0xf37e382996b8461c, 0x4d47481c53631e1a, 0xac8f167884f7b7b1, 0x5ae1bb6ab1a4c643
+, 0x63eb02590829df80, 0x623126862a793fa1, 0x6e1e242f1ce09807, 0x7bf96130aaecfd2b, 0xedc5e9ea10bff70a, 0x66b548233b94d26e, 0x70c70ee4594d30ab, 0x79b0006c8811353e, 0x4352792c91710c1f, 0x0c7bf15181a9f539, 0xfc995ee769e3779c, 0x44871c6cb9dcedcd
+, 0x0d180bbf2c9a046b, 0x5445c598c45d0cd9, 0xdefb32386875fb94, 0x5b0d235355660f35, 0xbe1dea825b3a7973, 0x10658ec4e1bbe147, 0x48af5e87fad77504, 0x55f5d3c94a7dd694, 0xa9a3e7062cad6ba2, 0x36c0a7e3f9e0ea31, 0xc4bd65217010aebc, 0x1d031dfc8b9fb598
+, 0xe3621c104113889e, 0x774b77ee1e6a6477, 0x124c5b8a07785fd7, 0x5a6c0df18188cada, 0xf4adcd545e72d7be, 0x38100fffb66ba966, 0x2100cbe35fe4a4d0, 0x4489be2df052c175, 0xa03a22403b26899f, 0x5ae4a0a0fec13928, 0x89dfbfb802795eaa, 0x34917e9c4ecf2532
+, 0x64b93674c60cbbb3, 0x25c098506334c71d, 0x8a723f66f1ee34e1, 0x3a960adf48f141e4, 0x659f386695e440bb, 0x577a0fbf6e8095e6, 0x8ef419b0f4b25496, 0x044176a30b9e465b, 0x7a98705df2013e6f, 0x77d0b2483aa95ce7, 0x309e917b978effd7, 0x08f1e55bfe942c7f
+, 0xfc241629b8d613c8, 0x140f2e35cd68949f, 0x38899f6a3ee4f9fa, 0x7abc8ecdd300f3b5, 0xd3dad23505d23eaf, 0x75e73f09376b2c7c, 0x5644a663b60ec5c4, 0x511ade8afe1eaec9, 0xbb005fe4e1abca89, 0x2838de73b0ca1f6c, 0x800a6658b80d28c8, 0x48aaba61c91641ec
+, 0x222759cab704d4e2, 0x106dd3c0ce85beca, 0xa1ce1ce341f69d03, 0x1651b210e8e4ee10, 0x47329a5e7133e136, 0x58c02f47dc9367b9, 0x09dcba56947b02af, 0x435c251178125b48, 0xd56979a3f0cd9315, 0x2f02b0a6422afddb, 0x23920f500731f32d, 0x0ab833238232cb5d
+, 0xa7b3d1bfb0bb60db, 0x2342c2a03c6eaec2, 0xac5e6e5a14d5282e, 0x5b9a421ddc42a24b, 0x018506414543e056, 0x6d7c377c084954e6, 0x4f8bf71ed3db1ced, 0x5150dbc15ab10979, 0x00b50a1b373a7fbf, 0x140be5c3d3244705, 0x5005bfe96e5b7911, 0x77cea555bb133f3e
+, 0x2ab1e1a9d7a973c6, 0x3897ac98314968d3, 0x9e0f74764b23c9c3, 0x2e5ecbbae41997cd, 0x43e2ea5648f12433, 0x3a515a0e4808e69c, 0x17d36c03c36bb343, 0x44cebd053481ce43, 0x89008656c21b0d76, 0x2f8513fcb9009be6, 0x2e223f90208a0e83, 0x3828c2d4efd36a73
+, 0xbf17d64f89a8527d, 0x59ebb42b9656151d, 0x7d7bc7245c7dc5ef, 0x191b682a0cb695ec, 0x8931172fad9f9add, 0x239b6cbbab2ebdcf, 0x76932f9ca7002dd1, 0x0c140548f858d8b5, 0x6c7adfddcf741ea5, 0x3b39c4b9e2e1a567, 0xc5135a25f87436fe, 0x690d8fecb7dd0ae0
+, 0xd782a618ecda10c2, 0x4f2a84b3134cf832, 0x35a81f71bbc955a4, 0x457f88ed64ae6398, 0xc27eb71c31479985, 0x4ae91808569aab32, 0xa5f2e9785a75eb11, 0x619cb199b837ed36, 0x0e7e5912b9484e40, 0x3b5831e87fdbcaf0, 0x49a2779c2d2b039d, 0x3d4b81e07f49061a
+, 0xaa119b0fa222b55c, 0x265c1b11b42fd4e2, 0x6b4d28e519dd7637, 0x3d2da7900de5a4b2, 0x99b06586b5f21d63, 0x4ce62bd9e6a1ee18, 0xb671e753932f8c92, 0x390b7821d0987834, 0x1adf7c73c3f1fc2f, 0x78c636a8514a7af9, 0xaee3b35fe11e7533, 0x7fbd199278f6ffd7
+, 0x41aabbf4363d77de, 0x1b27fdf18b96bf6a, 0xda264a1dff9a981c, 0x36efc08530c0bf9a, 0x5bd8862a5d830854, 0x23d7c905e656e6cb, 0x4523324c5b64fdcf, 0x36627f376238665f, 0x564f53925c6d5ea4, 0x17c7cc86a1913022, 0xf90db52a543b009b, 0x15192dc91f8b994b
+, 0x80bfa3c1a79ec6e2, 0x48fca8ea99772ecc, 0xfee6a3b98c0f1824, 0x46a8c75601b81e22, 0x2cb3c402a8895fcc, 0x1d1dff9c04305ce2, 0xc1aefe78e85971d7, 0x79c6a083ab5a80b2, 0x379c7bca5dbf2518, 0x2419358989b3ca02, 0xc9c42c9cfa5f470e, 0x4481c2ce91b14459
+, 0x6b04dea1ea26deca, 0x26ee3ceee0d0a101, 0xe36cc6bcd8fa4f26, 0x4d14709719764fbd, 0xe0572a706f1fef52, 0x0f75fb69a23f2ec1, 0x32ae4b04a864cf3b, 0x0b6373a91b944773, 0x1a8f2bc20bd088af, 0x586b0d5ace401747, 0xa0e6b094a3c51433, 0x1752a123c268c1c7
+, 0x643c2a93b5770ea1, 0x536cb9d1b71eeb43, 0x6bfb0525d0cc6b3f, 0x1f4dcfeec3adefc3, 0x28a0169dd0bf57f0, 0x1336c9aa20a35449, 0xbbcda068703ad7a1, 0x5e33478283c1e03d, 0xf1997733d18fdaf2, 0x789af507a17bb867, 0x79970c14d5695613, 0x79452342e845256f
+, 0x6c12f9367a26a018, 0x11beda1c8f9cdfbe, 0x720e6ddf24b30929, 0x7706e91e3e544755, 0x4460381d3a6c9059, 0x7e01916c3678c424, 0x6024355a61d2bb07, 0x68bae01d79c869e2, 0xf21cbcff285df659, 0x02f7ee6aeb57c933, 0xce0f078c17266467, 0x039b4fdb5170a103
+, 0xd5de0fec61a4ae1b, 0x33d37a152a778695, 0xea64e40e6a10ded9, 0x1f1d394373bdb213, 0xf63598b6ef59fd14, 0x57922adc3ae52283, 0xe39a90e18b76f4a1, 0x27f3dbebd98a9dae, 0x18179dd9c03804b3, 0x511d72c1912e2d73, 0x88e1f6d24b2f3225, 0x56009999cdc2997f
+, 0xda6df977b7d82fe4, 0x76f746bba63da226, 0x0b5facfc3bf13bd7, 0x4a31eb04f66f0e18, 0x8ace73d5e7cfe28f, 0x19aa731bc30c20b1, 0xa91979fe73400317, 0x6795ce71a09c7c9f, 0x93d55501933700ba, 0x3850eaf08b1fd14d, 0x450c5abc89edca71, 0x1be5db848bdfa5ef
+, 0x77667d3f4fcf082b, 0x673b6e6c4824bc45, 0x6f22c12a5fe0ed6d, 0x006ee6722b5dfed1, 0xb47a13c1468d0c62, 0x40564879a378e6e4, 0x0bc6b553a9d3ab58, 0x21761c79e44dfcfd, 0x66f36ed3eb1050fb, 0x2e67df1312dd01d3, 0x48744c4a68dbf2ad, 0x7844962b6d6e039c
+, 0xe07b5675d378b65f, 0x336262aa3d2c1df0, 0x320a5667d78c2e2b, 0x4f668dd96dda5e2a, 0xe21556795c7b8470, 0x3061905b2ef82bb1, 0xaee53211472206b6, 0x1f87377fee0d7a39, 0xdac58c52a3b1a0c7, 0x6e3c4ce04f0d7ffd, 0xfdffec45d4a3990f, 0x4b5340f79e2ae2c2
+, 0x0537c8b7b3d1f332, 0x55292744ae35ee1a, 0x42336d0e6d057f1e, 0x5ac40e9e645cb3d7, 0x848f7b7f845e46c7, 0x74bda86736eff150, 0x891acf622baf4f35, 0x14bcef9cf39667bb, 0x9aa1354d9731b9b3, 0x27e855a19295e59f, 0x1a829a8e10662ed0, 0x3bbc43f9ec4437a7
+, 0x8bfa8b1cb1de5341, 0x3432778068d35549, 0xe3d807da41f25a48, 0x1bb6ee1ce2efe552, 0x08d9bded0bd3affc, 0x290f1c5299a917a8, 0xda8dfd79562f8939, 0x1bf7aae68686211f, 0x2ab6daf9bc860765, 0x7bef6e2f0eb58a0b, 0x8746faab7c439b94, 0x017ea87750bb8bda
+, 0xf8dfeb22239c9a7c, 0x35cec0d2887b3a13, 0x68aa94ac601f1606, 0x7470553f8ba61767, 0x37894f91c9eac410, 0x55b22aeb8337f732, 0x53f8d90f29a2fe94, 0x0aec068aec69023a, 0x40506162ad6182ee, 0x6a327ff1ac1e5475, 0x968d7095492df3c8, 0x3f93f46195f67521
+, 0x4983bca28970d546, 0x2716b931296b53c2, 0xf42b013266b6f8b3, 0x76f29b084b6a369f, 0x8e28749222216249, 0x4f2fa1d3a6c1acfd, 0x0ee66697eab8f954, 0x37c33e28fec0cce5, 0x7d0419e2bafd1dd1, 0x01f04d4299b94daa, 0x5ec06abbc1e5c7e6, 0x3a24c66060ed72a9
+, 0x0db764e15f960f26, 0x1d5973d5d59f9c3a, 0xf3dc2608dc6d9149, 0x1d80e0461b72f518, 0x2264dccd49c8b09c, 0x1f03e7a246334d5e, 0x2d6e38871b1fc2ad, 0x418588ae4f284bd3, 0x3efb071bafe1afa2, 0x0799ba0c80bdd8dc, 0xa6b273222dcc4a76, 0x13859f08ac8a4b23
+, 0x0194acc2663c5acb, 0x459fa55bd0bbedf6, 0x1b055550f06f8cc1, 0x09e5fad46599ea75, 0x6b3916ef772958a3, 0x4aaaa5c18093a431, 0x8e1503e36610f594, 0x620ef55048a263b9, 0x5a28963c8cb8ecbc, 0x6aee46b1b740c15a, 0x67e39606f59cfea9, 0x13a579e3777ca8b1
+, 0x45ad92f61cbb8de3, 0x53068a1a42460eab, 0x9b163546de379578, 0x07bf38a7cecd4860, 0xf84c77031d282de1, 0x402aed6399f78ffc, 0xfb83dd20295f6d45, 0x3702e257340d2ecd, 0xb8db2d8b979b97c8, 0x617526d2a50b0c51, 0xd86f6278313017db, 0x2f35eedec55f9d92
+, 0xeecb69493517973b, 0x7a111a74e0baf09a, 0xb82c6da8ec39f63d, 0x4217076312833746, 0x5d36d11f3dda88d9, 0x7baebcb360f2a887, 0x9829b62d093d6cbb, 0x10f17a2f6edf28fd, 0xfe3efa4353f40626, 0x731ca3065c118e34, 0x6185678827960895, 0x07f906a4f4c6355c
+, 0x361d9cd10e657142, 0x2b5f5d452dd861ce, 0xa3e01df05d04b69a, 0x533723bc4cfcc0db, 0x820384afa1bbccb5, 0x4e67e941595d8dfd, 0x0f8da50839e13646, 0x6887a0573a596968, 0xe93dd1df5ace7343, 0x0d4076f28ecf96c8, 0x0ba2f854988074c1, 0x5eb2a314a41a40b6
+, 0x49ff6d27a676b27e, 0x15f7ca40acd5114e, 0xc171f9a750d7da95, 0x3bedbe891f79eb5c, 0x5b643bceb83f74ff, 0x088b1af3aa331a4c, 0xde294c7e0a60c4a9, 0x0a0770fc8120b151, 0xf09b757a0c7c1937, 0x34b797c03efd9c88, 0x051e3edb2c28cc49, 0x66db34ec5ac5122c
+, 0x95fde0d3d3dc8cbf, 0x797897c8121818cf, 0x1fd46d197710f89d, 0x533a505803f809c5, 0xb60f1c090c9fd211, 0x4a7c3479af5c9d82, 0x4bfc3ffa4c8cf5a5, 0x6949f4a61306821f, 0xd814c949c67abcdc, 0x419a5e33166863c4, 0x9de646f6bd0895e0, 0x497cc1449a54545a
+, 0x69eb31247fe126f2, 0x323c83233967f477, 0x52e0db4d3d78127d, 0x42a0e188e7b9380c, 0x3a6b011c46e34e7e, 0x79f4168aa9a0b4aa, 0x94270a25d708fa4d, 0x2bb28618cbc9cdc8, 0x741e46bb04606819, 0x02790c52fb2ce982, 0x6dbb92d0c6d0af10, 0x32aa96ae061e9412
+, 0x1376700c90d98eaa, 0x4d1dfe650c0a7136, 0xb397f8eef89aff20, 0x4836ac4a041bae37, 0xf37c1076a80a02b8, 0x0d063fa2467b3a37, 0x498f2617b56b7e7b, 0x65ef1194db859a5d, 0xd1fe25d5d28ffcb6, 0x228ee6f49459c083, 0x6b7e82b3b009b15b, 0x713b185ef1fccbfc
+, 0x552468f1ff60c298, 0x2b7ba65d02519614, 0x8a86ad90ff0816c2, 0x7bf9249284bd02e5, 0x3008c56e474c2d10, 0x171473b77f804540, 0x15fb79d07bdea766, 0x66ac67c7b9b0951f, 0x34bca15bb6d2f652, 0x13c63dd2687d617b, 0xc515ae237715c19c, 0x0e543c6765fbfef2
+, 0x668c80faf156fb5e, 0x1e2e9e3b3d9962b8, 0x89ebaa264394e113, 0x322add21cf1659cf, 0xf9e6e26733619f8e, 0x723bfc8b792147f0, 0x79aef2837d7e092f, 0x1aa61c59290b5011, 0x9955ae576a499cd3, 0x2c3d6e6a5a1ce0da, 0xb864cfa199a8676b, 0x4961a21f1080285f
+, 0x828e184adf9d997b, 0x0c84bda97e7ce725, 0xe6974677094cfcc5, 0x4ec8cd773946105b, 0xa48681bcc95fb5c6, 0x6ade87f8f7a5f269, 0x9b97628fdd39c03d, 0x3bde0ee1f19f1842, 0x4ef8c8fb117c0ca1, 0x769bf8f8d07de9bf, 0xc8f5f435b78a57e5, 0x79987aa861bbcf9c
+, 0x7f6c557204b02022, 0x119bd819111c69d1, 0xf0c61ef00b3eb70b, 0x4317f0511bfb7b39, 0x36a2b944e84d608e, 0x1c1a3862da3369cb, 0x37dbf471085f1775, 0x3835751e107419ad, 0x04ab0c84bb07a3fe, 0x63758bfbc7df13a0, 0x15ffd20cb554f23e, 0x1ff11c442b1515b7
+, 0x171377f1bf937186, 0x615efe82b83538f8, 0x321e7cfae352a761, 0x7af02427d7241502, 0x86546e47f2cc559f, 0x65a1d8a017659d75, 0xc95d8aa5b8bfdac9, 0x01e887cb68990623, 0xf1f8ee8c466bcc3d, 0x40ce5e4f2ba3908f, 0xd2b81a3480c16b35, 0x51625d3eabf708cd
+, 0x44d770a210105739, 0x7f1de74a022958a0, 0xfbe4c91bd1e8f732, 0x204fbacb13586460, 0x97d79097d62e3cf8, 0x541ad5591934b114, 0xfdfb47919c141909, 0x354926e5244fdecf, 0x6291b0a0e2e994b0, 0x2b9a9a69d3a6c3d1, 0x8189be54302371e7, 0x3645c65df1a881cd
+, 0xdf0460f445e3877b, 0x7ea384dc52d0d26e, 0x0c2e5f768d46b6b0, 0x1f6e62daa7c5d4e6, 0xf8b026b33b2343ee, 0x2b7183c8767d372c, 0xbd45d1b6b6731517, 0x4ddb3d287c470d60, 0x1031dba40263ece2, 0x4e737fa0d659045f, 0x8cbc98d07d09b455, 0x34a35128a2bcb7f5
+, 0xd67a89186b67f7f7, 0x0485b55c63a054ea, 0x022df582b37cae98, 0x09df88e0b022d555, 0xf4d50a279431ad48, 0x136ee46e04a83bf2, 0xabcd31432b41c5ec, 0x044f332904b55bc6, 0x67aba8511ca39aed, 0x09aa9b5b6879a44a, 0xfe504440a2ffe51f, 0x3393b3789df24b74
+, 0x7c1b49032f02d460, 0x4d963d715a2f9b6a, 0xcaf608ca35ab8a74, 0x15ecd2c7ce16b48c, 0xd603443f7ede9274, 0x046085b00ce83ae9, 0x838540f05e037b98, 0x30eb0ce4082340c4, 0x424b0415d3a2e1bc, 0x4b0694d50e59d33e, 0x42e28cada0fdd5e5, 0x35412f0347c740a7
+, 0x8e238126eb2191b4, 0x3a4817c4981c4a44, 0x0ea417bf90729c7a, 0x53f4b39a0a96924c, 0xfdccfea0d55a2b76, 0x7a50d61f77f02d5b, 0x1f9efd11d5e3cd5e, 0x681188f6eb609c63, 0xd42c785c237cb980, 0x6967f35e77a9d010, 0x69936fcc59185cef, 0x3228a5a9e2dc5fb4
+, 0xae3d773e171095b0, 0x4ec2c51ccba19209, 0xba6280f9d7b86775, 0x1a0bfabbff287607, 0xf02a2adfbfb174ac, 0x51c629e551750875, 0x344d1111fee7a42f, 0x261d1b2a993db0bf, 0xef47e45b4f95b354, 0x164cda1e29d6662f, 0xe38c4bba25026cec, 0x31a2bc3a8d879c77
+, 0xaf64573183574465, 0x43ea015306db32ec, 0xca237c27c2c35216, 0x3fa7a8a7d8703c74, 0x01dcb7435801ff5a, 0x2738b3402a0c9ccc, 0xd491abc8e0a6b715, 0x0fb804f567699e80, 0xfaefab5a929f07f7, 0x43ad6cb7e2a703c2, 0x0d1c7cce172ee8ef, 0x17a5531ced786ab0
+, 0xbc590e52c0293bc4, 0x682d0f1109fd485a, 0xe0c0bf60301dc4bd, 0x5f802eb572f2b825, 0xfa23eea474501f01, 0x6b64c705cd840588, 0x6e17128b22ff936f, 0x41b02de52f49734d, 0x841756c656120edd, 0x0431503876e11e1f, 0xfe2c6f7bac8a7dd0, 0x4c895ee389e3dfb5
+, 0x3677d442d9d5e5b2, 0x3ee1f140008cd86d, 0xa0f3a0ab784bf0dd, 0x04c41174968d6980, 0x087ce5a4824d472c, 0x405caa5101af47bd, 0x92846aa3f1ba5a02, 0x4be85c1a0293fa01, 0x75468f60dabf0e39, 0x7776b73bc624b11f, 0xc4b2de550c485e7f, 0x3effeaac0b12cbf4
+, 0xace065e8a9f4d8b8, 0x6c934fef46752ac2, 0x080d9d3d94a4c1a3, 0x17c5e39bc2d1f839, 0xfd98f8efa7b13947, 0x3aca8fab8506b3e7, 0xbe294c27f74f704d, 0x35122ab222555996, 0x79e6a88af867cf4b, 0x30550a6f46a766ca, 0xda8251a837a1c0a0, 0x4aa3cbfedfbc1bf0
+, 0x41538bf9877677ad, 0x12088ce4700c0277, 0x17ca3056d9242fcd, 0x694b91316e093eb8, 0x229d647fe167d6d8, 0x1c44f58451422e23, 0xc30cafb8c9883dc3, 0x58a285569d459f19, 0xdf64c1520ee25f08, 0x0133bc9147c7fcce, 0xca072b66f37edcad, 0x22dff316f98b0bd2
+, 0x8a5737c6d770f791, 0x76ddf459dc6d3475, 0xd60755994a314329, 0x3e4938123cac6ddd, 0xc19bd7a8b9052ae1, 0x54a0773d3cadb0f5, 0xcf99a525f9717866, 0x3425dc15084a5e77, 0x87526c1ee454d435, 0x5d8100a33b69fb8a, 0x256dd35c1a07c098, 0x6fbc19f1aae91cb2
+, 0xf593297a07f8acc4, 0x4a09c89cff3f98af, 0x7dfa970768f31f11, 0x5661eff49cad194c, 0x720a4d87ef663aad, 0x759a92c430057f94, 0xfb69dc211a9ae865, 0x69a987121f413a03, 0x1d03396044f0ea0d, 0x1b0dbfe6fe71e284, 0xd4d44c10b577fb1c, 0x6f10d16400c9cbeb
+, 0x84b17a64da2cff84, 0x3867a8851b393881, 0x77343bddf8676d18, 0x19ee638bf7ae430d, 0xe6e75e5e9c06ba80, 0x6ea4557c2b0e7b33, 0x05f876dd49ace992, 0x2ba836e4cc9cb80a, 0x1081d1987da94e5d, 0x1d50aa05d4cf0950, 0x29d45fe7b4dea54b, 0x670e231fff930dff
+, 0xcdd6c99de11cfead, 0x10edacced4287dd9, 0x0d55c32380233432, 0x4c9d26acdac27b5f, 0x9e6ea7ae80a4e2d6, 0x3f5dd1ca9a56f417, 0x46467dd5b1e461f6, 0x6ac4fa1b0b9bcdb5, 0x8f963f5b101385fe, 0x62823bf962d11a2a, 0xdadb2192429974fe, 0x443c2c5fd1be864f
+, 0x73f37e751f6df995, 0x42c7257c4609bb2d, 0x24618a492a85f181, 0x30b332043d173d0c, 0xaa87789dd48c9738, 0x338e08e98f355af4, 0x3d14d02ce67911ec, 0x13526eef2ae1fa93, 0x23081a055a9364d9, 0x791ef50fd26249ab, 0xc019457f10b210d4, 0x5eebbfd164430b06
+, 0x3b2c203d725a1879, 0x50959e7d692c309c, 0x0e312816d2d6f46d, 0x024894453733f0ee, 0x620d6085187b9046, 0x5a3b229fddce811e, 0xff8b6e35ae8d22de, 0x52afc2c3c8b5212e, 0x6f7a38ba98aa12c4, 0x41dbc83af80ac0bc, 0x06752c65b6592d47, 0x6d95ba30a23a4b64
+, 0x5e97608020150c62, 0x4480afac52d344b2, 0xca2df3545444d6fd, 0x2f05208a588bb440, 0x1cd1f8ca1f3c8496, 0x2b5e47c79b3a9e93, 0xe979e5c369cc5d5a, 0x127c10194803931e, 0x84233f92265a9b9e, 0x5bbbaf2266cc9df8, 0x24897d733c867f78, 0x709aa9ea62070961
+, 0xfb3483a51d716a41, 0x5f2d480e3602b8e1, 0x3c2041eb28668c4d, 0x7ab1bc25d1d845e2, 0x29082acb789ab2f6, 0x6673823262dda8d0, 0x82e5c85191258354, 0x4f9215abd498ccb6, 0x5bf63d4e914352bc, 0x395d932ad53ffec9, 0x6e69686c89f79027, 0x3cad197c14a914ee
+, 0x3a131f66acdaa173, 0x748944a67942f741, 0x100e12cbd9c5d461, 0x2b08cdbdab077de9, 0xb43adb7f4bb30164, 0x3a8bbd50668667cf, 0x5e76da49857c793d, 0x5cefabca294566ca, 0x951c88332a2964a4, 0x3c1fcab18add8d20, 0x3d7886e0885c98d8, 0x5bd1eeec5b0d8275
+, 0x6ffa6d00a30c5cf6, 0x44e4d3961e479536, 0x0a758e83b33c0e14, 0x146cd6d694910a12, 0xceb7cb2e09eace00, 0x6d207cca5b0efdd9, 0x7a328d9a097e532e, 0x59161455cdee3f66, 0x9f35df4953f9da49, 0x150b00bf7733e114, 0x762b6c1413eb0a1b, 0x1331f12c4fe12b7e
+, 0x65e8025a57379e1c, 0x17c81359f58a6a2c, 0xd4cd086d55601f05, 0x42e3facf4cb6c341, 0xe1df209241d4ac46, 0x488b93f7bd1d2c4b, 0x220d66141cd4e2ca, 0x7491ac6415d8362d, 0xbd9a3cbbb1305a64, 0x491c7fbebc448ebf, 0x4900a62207ca9357, 0x15184e9f5640e308
+, 0x16ec832c8dd1e253, 0x1ae60af4a41f5c0b, 0x656c4f5ce68a0c12, 0x1d47f396f68c3191, 0xcd49f904aad0639a, 0x3f35e94836da4294, 0xe64ee736ac164802, 0x21e9adee26b6097d, 0xbda0a99b5127b21a, 0x50fde0459e478550, 0xd2c7d14f68e8b103, 0x33037b72d00c3798
+, 0x4407cd87c7168acd, 0x2dbf34bbdc15910f, 0xd1370a845f9047c8, 0x0f0a6f349717d3ff, 0x8d1de038273e13a9, 0x33b69e5af0c76777, 0x8b58656ad053b569, 0x3a3832efa59ad7fe, 0x193031555c282ba9, 0x7a25531932656c8e, 0xa1ad229fd459ddf5, 0x2bd4348cdd1476d4
+, 0xd9a5b35fc733ccb7, 0x2fdb6bd44e3faef6, 0x9a3832020853a924, 0x4784b4f426d8097e, 0x70aad7b350cba76a, 0x23b8d642b9ea4f38, 0x02af4177bb74e44e, 0x1b9b70f9f54a4fba, 0x495897be2c610b69, 0x41d39bd169c6aef2, 0x9d9f3af7d3a11f73, 0x7b3b7c0df77781e2
+, 0xa88ddc1c1680bae5, 0x239dcf53b45efbaf, 0x686aee245a2fb6f9, 0x34f67fe12e2a0ead, 0x28b731da126fe656, 0x42dd29c93edac13f, 0x282bc50a3a53fd53, 0x365167761affc28f, 0x20ee25c7c5ed96fc, 0x579adb216fcd0f67, 0x3c3e3e3e48c9823d, 0x21454ee564281655
+, 0x2ca792cd5bbee3f0, 0x4cfbdf90bda61ca8, 0x77bda89226d0dfb4, 0x2f6b325fb1218424, 0x7688f8af204f8c2c, 0x2995b61f82d2dacf, 0xe4eba5b54f33df50, 0x6d6ff0af382cfbc5, 0x22525b4f393c6a82, 0x07a30614f1f45870, 0xbb84bbe9647696a6, 0x4a80f44ae153c4be
+, 0x3ecd4b44d702b106, 0x7fe6994e308cfcbc, 0xc464fa54262d0d52, 0x5639074618fba5bd, 0xc0873500dedc163c, 0x5b5b2cf6435cc9d7, 0x875692b16bb23d2b, 0x0339653cfea5892e, 0x76d652edf3391937, 0x2303e50f13c0dd4b, 0xc6e0dea98c00dcf7, 0x36ce7a7d691384d8
+, 0x2a74265adf0fa018, 0x21d0bfdb8607d277, 0x30a8d58ea244a8fe, 0x5fe2f04fe9e29944, 0x3f081791cfc697b6, 0x2e81df72c287915d, 0x81ea68b05e08b819, 0x32b01921cb49e0fe, 0xabc6e53d1c9ff301, 0x24467f42c69b54c0, 0x2cb55ad3eb27e9cf, 0x5fe44b6e0bcf7ee3
+, 0x74c7b252a4bef6b4, 0x2f88b4683a596998, 0x0bf0bc74378ee067, 0x0cc12a3d1b4ccabd, 0x912bd345dfaf692d, 0x4482fece8d4f0eb2, 0x9b7c405da76fd229, 0x0c9fd89964829ae9, 0x893c42bc0b44f460, 0x5f6fe79d1c618dac, 0xd286b589e619ec5c, 0x11ee288dff7a010d
+, 0xd5b5a99a5e900241, 0x7293fd29a04a5b05, 0x6727bf1b513603ca, 0x0d10afac93973967, 0x6b0661370efec579, 0x03e0703febc95a22, 0x0b538d75ece57f1c, 0x19e93fd11700a217, 0xb1a73a67976a1c0b, 0x3efcbeb6b561ab7e, 0xac63293f55e6bea6, 0x1582d956e87d6475
+, 0xc6256b406f005271, 0x30e3182227639503, 0x80357b817de099fc, 0x467b1182fc510c21, 0xcdb2fdc53977feee, 0x2564570938cba54e, 0x9437387c93dd97de, 0x52dd2c08d9dfd294, 0x9f3c237749f2de2d, 0x38b32d7c1b96c9d3, 0xeb001f34db28ab66, 0x07c1872b3c6e0ea1
+, 0x54bb1af485256fe7, 0x634b757039078d41, 0x2a66db3e09c71865, 0x0ba4e5ff6aaf5101, 0xd32e8a3706898f17, 0x56e0f2649aaeb630, 0x60879ce42b317cf8, 0x6f590e37b48c1a46, 0xeb98f1f349e8cf8a, 0x707bd0201358e60f, 0xb07eff1ecb135469, 0x4e1c76778d4d3442
+, 0x848cde605310072f, 0x22790d06ad2fbef9, 0x8ddc87e725c4e284, 0x42d60844bccdc857, 0x8ab3f232f7ddfd51, 0x51d50fb2611f9bb1, 0x717963c51cf35ad5, 0x146312f207a29420, 0xe306136db2361ce8, 0x4c7c3b7ec34a5f68, 0x6eef6a14cae316d2, 0x23bc0e00f13c3e4b
+, 0x18f057d3b1478cd8, 0x1845241a7903aec5, 0xab37106769d0c58b, 0x7409357dd2124a8c, 0x23f0b0bf926253e1, 0x25b914f44808330f, 0x3b906d7b997b2057, 0x36f4f1651c0c99fb, 0x866a5b72f7c92dbb, 0x2977aa5b7bc689ca, 0x87d3853527e71e7d, 0x144a0143601dfb43
+, 0x91ad6dc691c35927, 0x5c415a5f845f10d4, 0x1954d805a9a12649, 0x6a406108bd25631e, 0xa48f2bd62ebc6182, 0x730128774f395641, 0xd0609ef1c4c4726b, 0x6bfe854d34fc634d, 0x83d63e8edb3b172f, 0x5681d2f133f10bb5, 0x1f37d54d26c42a83, 0x524570651fd3a4b6
+, 0x40dabbade9a8f8bc, 0x01352967e13ac97a, 0x21ac469d42fcdf21, 0x6a00c7fa19009fd2, 0xb3eb9a2b8fbbfb4c, 0x270235f1a3a08871, 0xa5d9bf4db80fa8cf, 0x0b7bfaaa96143226, 0x4de1267648f15a8c, 0x1043998cb5a9187e, 0x0fa094ac9ac26f41, 0x49d463def26a3a6e
+, 0xbbaba6632b33a977, 0x3981fd3196989f5a, 0xbd8cbc5b445eec5d, 0x79f894ed4f96de50, 0xb8ae04360b853164, 0x75ec7d4fbab3e459, 0x031f406cdfa7db7c, 0x790db708421e7988, 0x646e0e4bf2789f6f, 0x5dbb505b90fe6d4f, 0xb5d76b7edf5405ff, 0x2085c160dfb35b8a
+, 0x9d3538acbf00d12a, 0x4b2cf29faa540624, 0x5a4d3bf383e8c9ae, 0x2a3be7d14e2963b4, 0x124c4a42af9ea837, 0x5cf20fafabd3d421, 0x98407225613e6ed6, 0x5f3852127fb654f3, 0x38c5447dbf8aecd3, 0x1d8bce347e7b7419, 0x3aee545443900f12, 0x36d0b83fcce2d38d
+, 0x1c8efc6a864f0d52, 0x70058bbcf0e148f8, 0xf35de2c2d04b6ab8, 0x1b023439f9810abf, 0xaf07806f0076d7ab, 0x65ffc52697207783, 0xb8b5a31150de0f3e, 0x5b54ab4c1c9a6e7b, 0x240175b97d8033c0, 0x1c75253c6697ed40, 0x5028a4f3ae676da8, 0x6de40ed708eb0562
+, 0x771594a461273a3a, 0x3c7c6103da43fe83, 0xca230bc761cd797a, 0x4f1433f4e13fbe23, 0xb96d4adc6244d654, 0x3b8d4b7c16c63d5f, 0x4a4f7a499b6704ed, 0x3e602333575f53ad, 0xa832096cc87007b6, 0x43d59756f19abb8a, 0xe163f65dac934243, 0x592191ef69ad3352
+, 0x1a9a3c9b5ed96e7b, 0x23634d4c704ceb14, 0x9afd328258949bce, 0x515710d5aa479f5d, 0x932e3bc33b67164b, 0x49d73ed1521a38b5, 0xe303e5063781471d, 0x3e3b83c9ab627272, 0xd342a6cf3d4dc46a, 0x28f2c0eb33bac3a7, 0x43c69a848eda2bec, 0x719aa7e3e2375d4b
+, 0x2cb816690e5bd082, 0x25e4c2413d3e4399, 0xf4247cc3b1db0eed, 0x214100c7bfb86b63, 0xeb08d0d7f1aa1588, 0x69a98cc5df5f87da, 0xb92f5805f396f2e0, 0x79618012ccb5aae9, 0x2fc5471ebe5733ee, 0x0ef2d971ef3ada47, 0x22ce51ae6ba76604, 0x1d1f9b945cbebfa3
+, 0x9a3b13808fa2c104, 0x1e3baae38ad76aa3, 0xc875d6cba937a82c, 0x5a5d7e5afa1f52a6, 0x82e4162715172616, 0x062c8f6ae66d0877, 0xdaa8d0522fa8b5a7, 0x25309e085a83660b, 0xca483b78359abb0b, 0x69f0e7c88d60161e, 0x967ddf5f76882b8b, 0x51a47e201f2d5873
+, 0x0f3c6283e9ad28bc, 0x200656f5ecda6721, 0x2344aea3c49eeffc, 0x37f712bed1b9de9c, 0xcceeea0c833d3959, 0x56abdc4950e5c0fd, 0x3379bdb93fe56d3a, 0x43d2742b47e4c5d0, 0xc9b9435d40332aa3, 0x279ed7b462d81b09, 0x08a3b8b9a2b4ec2f, 0x68666274ddc52b36
+, 0xd5266d6f10aa172d, 0x7ec75c72df9e362e, 0x784e6e4639db3bd6, 0x4100d4918f7c30c6, 0xce3fc9ffe6420ef6, 0x5c5d9caabfda54f2, 0xbacec9ba34da4d42, 0x3920c75dba62ce7e, 0xc537ee4c47ad6b9a, 0x7f55be2cf9c48a16, 0x8cd2be1e3b87d08c, 0x786e07044b17514e
+, 0x5c520d83ca02307b, 0x627a9f5b709cb7cd, 0x4715b718c5e8b842, 0x3e4318b466aa540f, 0x41391a24a0336fef, 0x5b3c67fa4f04d19d, 0x74682e4e3bdf9d3e, 0x29353bfedbf24d93, 0x6fea3b7322c146bf, 0x145a2618194d9ec3, 0x295beb9e89d7737f, 0x4abecd8eb647dd66
+, 0xef94f46a5aa1037f, 0x5ad33ef5a2175391, 0x7db04ae33cbc745a, 0x0f693dc62d4cba0b, 0xdf3f039742a50766, 0x5228c031041e2982, 0xd6908ace068d6158, 0x3c8f441f154198f1, 0xcb62e135d97dba0d, 0x72b31012f3986b49, 0x579f46c10a12b735, 0x65a9fa6fd9e56c25
+, 0xcfc7f251806235d9, 0x4e7603571baae9e9, 0xcf9484544e3b7f83, 0x4fe4a243423a8677, 0xd2c14822e915c635, 0x70967f6d0e81b9eb, 0xfa1d777893fc9ccd, 0x7e43428f7dc33d07, 0x8c822de44552f04f, 0x19285896cbbfbb85, 0x785be210860d2c14, 0x0f02f261a28e785f
+, 0x3b46fff788a3e058, 0x39f0b4c758ea11c6, 0x9dfe266eb07a2fde, 0x2c601adf9b7908fb, 0xb45e9bea1f7b1437, 0x1096fa34f47c5322, 0xbcb9db48b9f1afa8, 0x498870e976bd6e42, 0x9fa52748d0abf717, 0x648ffd57e5d4b08a, 0xd18287d4809fa32b, 0x7772a0c1a2960eb7
+, 0x063d4b1c8db70e73, 0x60a46604bd1ca8fe, 0xa11c3c1b95745808, 0x515df1eb3caaa14e, 0xb652fa0eb01dcac6, 0x23a9ed15057ccc7e, 0x8f57477499fddef5, 0x50b43044da918d8c, 0x49bda4d7ccc45174, 0x09dadb66362317c6, 0x8fa4d48b0b7f1d88, 0x23626375c88d66af
+, 0x6acdd0733eaecd53, 0x04714381866d164e, 0x0028a72d5bd2376d, 0x36ce4b04bc847def, 0xeda06eb5a21ac758, 0x098ac81e84e2a615, 0xcfea29f33fa8fa78, 0x2268605dd226e3b8, 0xbcb74c9eab87386c, 0x273bbbe02b5ed9cb, 0x2d53e12fca470a93, 0x6ba1c99ae7464b2e
+, 0xd4e00d96bb3a68cb, 0x218cd51a781e6529, 0x4ea8444591988280, 0x10b022430b4f6310, 0x4e110725f1603a4c, 0x3cb5a5ed8bf5f866, 0xfa4e7fdedde33b28, 0x322af3f92c972021, 0x39def0e031c467c2, 0x46f1d8607ef0827d, 0x1304ff8adeb266d5, 0x04cb47f6a893d1b4
+, 0x7475cdcc92449e76, 0x6acbd24538257813, 0x7492c25404837d2b, 0x2582556aeec8215c, 0x4c43a61a7537f738, 0x398d48b9e6619a7c, 0x7f8141fdabc47c85, 0x1fabb53613c08df3, 0xa4ede1f9930da16c, 0x484a8a8a6ee50bb1, 0xd38dc372b6b595e5, 0x3c35fd019fb4bc90
+, 0x5606f63a79edba12, 0x4b96b47ad37f52cd, 0xba6140c019ca5a8f, 0x079ffceaf4881610, 0x960a5e3c03025575, 0x1139ec7fb4942595, 0x4ff4d051d8cdd809, 0x37db0da92128d1af, 0xc914f376f8050aea, 0x25354e7e73a00e7d, 0xa0754ffca9e529ff, 0x5f7333ccaf828746
+, 0x2c42a10907b91f9f, 0x43a678f84686344c, 0x56b1a9bd859cc422, 0x2dce5ba18d1e261b, 0xc1c02e0e4c955e91, 0x4543b9ce8321e389, 0xf6a6b5a8cbe9425f, 0x26a7b71145162c2a, 0x5b02a4dfef429551, 0x24f10eff5e8dec3d, 0x6f14e232c301f1b4, 0x17ce4066286a97dc
+, 0x5f05199155709eaf, 0x442f15d70950b7c4, 0x5ca3c4bc24596dc8, 0x2ccb133c4cfdd6c1, 0x9de20a3d02eba87f, 0x326040c6bf489696, 0x601a6b90044ca6d1, 0x16c1b3eb05faf208, 0xd09c433593f6b56e, 0x70e3147bbadb909d, 0x08df6f784a224b2e, 0x5e43788ad1799560
+, 0x6a232fa2df4a68c8, 0x3c1ec888a5393b69, 0xca5d1e0327781303, 0x67198f1cf22e163a, 0x7a5fed4f31f6846a, 0x63f8b0585e2fa55e, 0x6a21eca03fa4e704, 0x71c86b0c79a788c5, 0xf92c88660715a121, 0x5146ee8ae1e0ca69, 0x079cc67e9158d93a, 0x7beceaf6631679d5
+, 0x7eff2166c5ac6796, 0x6eb157005dc9f783, 0x01b8a4ef520caf57, 0x0a068e8879e68ea1, 0x081c780cbe29edfd, 0x4a98ea3964316f5c, 0x32256f7b4c9a70b6, 0x04050e320f71b673, 0x2dca4fa4e30703d2, 0x40003bc25d390136, 0x71a586d4d9742239, 0x14b58655dd77a50f
+, 0xac08e8fb4da1cd24, 0x0a669734d19462f5, 0x27e2064c539be056, 0x274fc60b4e26139b, 0xa593b78f5ea0a044, 0x4121377d467a332b, 0x46ff296872aee8a3, 0x0d4dbd03b7ac1077, 0xa8fee2e915bb493d, 0x3a9d7ef30c6aa2e7, 0xd728e8c93c38f64a, 0x2dac12fbbcdd7080
+, 0x9c4fec727b5a7bc8, 0x0b65e510740b2782, 0x6cd07ca5851e6970, 0x27f1108e0c34f7ac, 0xb2ba9911f21e23c0, 0x5feac5ca0845beeb, 0x5c15d858137f27ee, 0x1d56afdf2cf28059, 0xdf3891e64ce711a6, 0x0328139f4687cc27, 0x6672fd8076a74c7c, 0x743794ec6d0ccfca
+, 0xe9484d37fe4fdbe3, 0x17d2b895f82955c0, 0x91900f689c23643e, 0x63431957f5edc3ca, 0xc87ff8baaf6d138e, 0x2af895b51144bdbf, 0xf32bcdf84302d2fe, 0x2ab99482e6e02fbe, 0xa04b99b843a1fddd, 0x3414e9ef555e2f32, 0xa8d96deb66267d00, 0x6f152f7ba2a2af4e
+, 0xb7dafb1e400c173a, 0x64c3f10a19280d27, 0x608aac08f92cb059, 0x58b8f5d012b2f542, 0x3cdcb8872a1dcadb, 0x62a63f626fa20af8, 0x54ce496bf1165753, 0x35084dd4ed9d0ffd, 0x26d2f179fb345211, 0x395ce21a6ed03ec5, 0x89ccc454a36ea97b, 0x5bd104744b9ec7c6
+, 0xad9d4218a38aeaf1, 0x53b8061a84035f8e, 0x17de798c4408255d, 0x4699d84ded818be6, 0x5837417e6600ccfe, 0x6cf11c0e784c3b63, 0x8a27cb0c172352a5, 0x0a0ec0fb4d056efa, 0x14e325a223368115, 0x06178ddabb834eb6, 0xac6f2e74bf147d9d, 0x11e9dec6cb9d656d
+, 0x57ad53b15a1f91b0, 0x28f598d5de3e77ab, 0xef0cfc015d29955c, 0x6372cd483199913d, 0x592053a9c484200c, 0x5704477ee5416d30, 0x41145be8efb476d9, 0x3083013cd7f517fa, 0xe345bb34397fef85, 0x604c73a964c203de, 0x8391a8f9a60b1ca0, 0x5b734e89e3b67a35
+, 0x19bfa6c31289b6be, 0x2815929227694f74, 0x92d3d8a68efbd809, 0x09e881acf9c0c261, 0xb9a0781496f4e39f, 0x5581ec5611079d45, 0x81ae6edf4b34e06d, 0x61fc67221fe9e4c9, 0x9fff2c972dd824a8, 0x354f0669fd5ae564, 0x56f8666c273fe91e, 0x2f120409683a7c4c
+, 0x150acbc7fbdc82fc, 0x5a2fe5e10109c9ef, 0xb74db2d5b7304a4b, 0x7f59cfc3c7bcae62, 0xc28a6c077d786439, 0x552c9087a69affca, 0x8a22dcca6cce167d, 0x203a5811953747f9, 0x04f424bd7facf7c2, 0x706f3f0a95747749, 0xcf4a500a39140092, 0x6759d3628cf83516
+, 0xb61aaf0f90607504, 0x7425e61e5138f355, 0xc2914464c50d3cfd, 0x0ab314b43c1b2170, 0xe92eb82c565cce10, 0x58bebffc589057e7, 0x2b54939f2f84ade6, 0x2c06ca35fe7f7744, 0x52233e5fca1f7efb, 0x7481b1511bbcc007, 0x63c12ce125a29573, 0x27f3204077794ac4
+, 0x8bb3cd4809f1e113, 0x3f301948a834c2ff, 0x29719e6b3f6a5374, 0x4314c95cc8e8e31e, 0x042578645b80fda4, 0x10df072e1752949f, 0x38f34d21624a7ffa, 0x780dc8ae72073f6f, 0x39e4ffbee81c4a1a, 0x07bec8bb2f1393a9, 0xcfa171d3863954f2, 0x7dc12c54adb3bb6b
+, 0xf69ab92f4dd7fb2e, 0x4b92090d0be17fdc, 0xc22acffc82aa5f02, 0x64006c71b525c72c, 0xd7f54375182c6826, 0x32fc2493beec7622, 0x5e61e6d21d41bdfb, 0x119e7c07e84179dd, 0x1229d279cfa58904, 0x2571b1158c796f38, 0xa6ca84dc03d8f2ab, 0x4b492f7242fcdc81
+, 0x4f48f9b87981954e, 0x05627dcee5723768, 0x03b8433c51584d31, 0x70c297e86ec6276f, 0x177472f66c3aa842, 0x31f52b8fb6dc9fde, 0x9952313b4d08d75b, 0x4de8e318fce400e0, 0x7e4777391386ce74, 0x123c11f5928b472c, 0xc134df88074dcb25, 0x6a134e1cf1de3426
+, 0x30b028d872cfd935, 0x1f855de0f1a3087f, 0x7dd599e75baf910b, 0x35fd1d74ff7e3e3e, 0xe705ca4f409f1c99, 0x4ff01c43aa040784, 0xa680817741aebcd0, 0x53047c42ce85ea21, 0x224119075c5c0f77, 0x7a85566aa2d7a604, 0xf92fa88b47b4d8ab, 0x2d6d06a43b961043
+, 0x9b61ae26a9180c09, 0x1cd7bf61920d2874, 0xb6a11464bea3ec1a, 0x0a512d307419cde7, 0x9f27a92d2883d969, 0x28b2e73b611edd73, 0x03923b10257326e2, 0x059098af58d56cee, 0x6e290ca71a19bac6, 0x7869d07dad458535, 0x30b889af6ba9e701, 0x14fccc56644b895b
+, 0x583f264eb0fd5d43, 0x140e8eea51ba3a85, 0x39a2d38c7e23ba66, 0x710b180d0dc8a397, 0xfe612af9534b5d10, 0x0309fb1707c12940, 0x37921603e172c410, 0x1d9f14dbc709e675, 0x14a59573c1f3fdd5, 0x071360c44b4f5ae7, 0x518e10114d15f6ec, 0x7b1e4de585a07783
+, 0xfa26b91b0dd0ab3f, 0x2b5139d5d48b87fa, 0x7b9899213ce898b1, 0x1e2d051c0e975e69, 0x0fcde1fc0cad9cc3, 0x3bbf1d7c9feb8af5, 0x26b36529b9bb719e, 0x1eb40acc44cac453, 0xe543b84570adae57, 0x4f012e94b7e8017a, 0x3618c6c7f63d8412, 0x7b97e210506e2089
+, 0x333ddceb36d3ab00, 0x0539e29df384edb7, 0x724a11c6c83c3712, 0x0cb2927aac2060ef, 0x0df27015eb3bc329, 0x343cefc361dad1ea, 0x5f2135cbc9134d86, 0x350dcf743b82d6e3, 0xbfb52c8f86c78aa5, 0x3f81273a8af0f13f, 0xee6c9d80581571e5, 0x0da4ad00bc82cd3b
+, 0x70c878cd04ef399d, 0x10bdc31458ca76f2, 0xec4db12ac7f8c70a, 0x2072c598cd88d3fd, 0x920c4dee92caeedb, 0x661c16467e84ee09, 0x3fd4e602df3d05a8, 0x24335a3be1564dd9, 0x8b037b324c1e98b2, 0x371ac8b28c94b01a, 0x24ef4520069dad68, 0x247cfc7a710158da
+, 0xb0bb04e386fd846f, 0x2b82119ab6b146ff, 0x6268613cf547be61, 0x41737c8376fbb15a, 0xcd7aad84382dbcef, 0x284c49eed7b6faf4, 0x71ff2b402b7ef93c, 0x64c938868a7a7bba, 0x39e16c5d7d59f525, 0x1ae05f85891727c7, 0xb7c4dc5c78528fc0, 0x4d7bff60b293891b
+, 0x856c781212bc31c0, 0x3248ea6e87136b25, 0xa2e80ef2f722f684, 0x63f66e144b5fb9be, 0xdfcabe46f75df570, 0x79ef7e3c8364c877, 0x974832bc31c5c416, 0x400366a6ef44b00c, 0xdd08b2c3f6f78afa, 0x7b9c2f2c16957368, 0xef3211569fc3dbae, 0x3cf929521f08f035
+, 0x3cd56f04c591fd0a, 0x1d29c9142bc8c4bf, 0xf15e6118f8ea7f7a, 0x0a59153e17d714f5, 0xdd742a649b5a6f3a, 0x11c7d5732272bd73, 0xda91bc456cffa836, 0x158e656f6a7c7988, 0xa97924792040218a, 0x56bc16fbdbe83f41, 0xc8c42e3182afa814, 0x14689fc3eb87503e
+, 0xa18ff99a49aeb265, 0x4e1aea0a17a20154, 0xd93ae43dabba1251, 0x6c1391967153c76d, 0x5890d1ee450504d1, 0x7e1d59805dc986df, 0xb0063fc5dcfec273, 0x4bc0b28973473276, 0xadc36cebd6386e58, 0x3a4bfe72ca5f7901, 0x864c6ff2b3195c22, 0x51a7d7b8c3df4f9b
+, 0xb647830f02a29d98, 0x3ad07066f48fc054, 0x3e27f883447e7cf5, 0x5c4c4431b2d8077c, 0x4d4c2c248e4d5f59, 0x1e3e192167b2cba1, 0x5246834def92c068, 0x79d6e3b17fc17509, 0xa709487a39e9daa2, 0x5d006fbe23ea1beb, 0x98173deb40c6b793, 0x7a2f447c724c4918
+, 0xb06c590d4ec886ec, 0x5de372243038cf0a, 0x17bf817607435724, 0x2f07417d538b1434, 0x31e1fbc6d3470f0b, 0x7d815311ac5e946e, 0xf9be9a60ecac393a, 0x05d92490799a6ae1, 0x16205bc8d6443bc8, 0x1ef72341746910d5, 0x923c13c35767ad85, 0x4bcea1dc3b941fc8
+, 0x8c95b42f0829b5b9, 0x3724b8d23d4086ad, 0xc4d0e2f5c3722b58, 0x4dc350eaac17ca2b, 0xe911be1f0b815e30, 0x60688819f69f2470, 0x7639fcdc670d5ebb, 0x102b7cae5e1ab12c, 0x8d2b9ed59a116422, 0x4174c5381d3dd303, 0xa81eea9e5cf19945, 0x0993389721bd7bba
+, 0x4e9d228ced658c86, 0x416fc5878129efc5, 0xdc96ab3e4872c36d, 0x5a3dc1b1146df901, 0xce0118e89bb59b34, 0x71256524ee4ea949, 0x682967a477e77249, 0x187d56efe807d35e, 0xb39718e730a7ee21, 0x6cba8923fca2342f, 0x2f9b360436f7e815, 0x32d2ffe22b0a8a4e
+, 0x26c3e965c4fe1d2d, 0x31741e33c1d50b7c, 0x9f031b30fd64f0c3, 0x5ffbaa90782d76aa, 0x1d9a49a8b62380f9, 0x31a0869c06e8a7e2, 0x19cc60dd1eb8171d, 0x6d28b5fc77f82313, 0xe409095379da4319, 0x229f0efd2cda03b8, 0x6263ec6bb1ed6f3f, 0x571c553fc3fcf79a
+, 0x838acfcd030beea5, 0x03499c1f257d00c6, 0x0f39a5ae279cd90f, 0x405a1b305f848cff, 0xeab21da74b659da3, 0x4702493f81cf3e8a, 0xcd3e811c9397960b, 0x33a306f63b59068c, 0xce46ad87a9a7e9c9, 0x327fe8b4578051fc, 0xf06493e88c0c7a24, 0x6c5940c78eb99eae
+, 0xfdbd5c76590565e3, 0x7cb29ca3722c8de0, 0x6ce1376daf216707, 0x5a5089b309d1ce8d, 0x5dc5cf7d886e7af0, 0x273f2e94bccc0ac4, 0x5bdf478f71731b41, 0x3d4247baf258902f, 0x940a4b03a4a46d1e, 0x593b478e114a1d38, 0xd34e49bb0484762b, 0x5f7ec57f91104af3
+, 0x265dd4d83461a776, 0x518e7965dc64c296, 0x34589cf56ebb9296, 0x5ebc36539142f970, 0x99d969859064bed2, 0x1c15d165ee186333, 0x4fd6e6808801bc75, 0x4d7951c613e7cc29, 0xbd2f709ba07deb04, 0x26c7bb8967dbdb13, 0xc96ffe79a07a93a7, 0x5568d0800000ec8a
+, 0x5a2bfb3d0d7c5618, 0x381f7afedc6390b4, 0x82d598c1945030c7, 0x4355f44e0903cda1, 0x2dc46e4374bd8905, 0x10739888e4f91947, 0x2d35ed148d509a00, 0x108fe50ac977fc5a, 0x21b40ffdb5a1410b, 0x510cb24774f171aa, 0xc87bfab1e0c5720c, 0x6aaf76e70c4e8f8c
+, 0x1a0d2876cca1b24e, 0x549d85bafd5f4008, 0x2163110ce7ee057e, 0x42f57f474877dffb, 0x26ae54fb47d2afce, 0x6b3abc566a8f1bfb, 0x0cb096d82247376f, 0x30c1265c45106bbc, 0xdf01bb3c792f74f8, 0x23c8912ef93a014b, 0x59bdbe2d1a225191, 0x59c0bda1fd259646
+, 0xd8d338f2c988787d, 0x2ceebd6acbcc82f0, 0x5c0da37976ef3fae, 0x012414481c5ff0dc, 0xaddaf128139b228c, 0x1936a4199e189b42, 0x8355d214b7d86d07, 0x45dcd346279b21be, 0xbc75f29626e1fd33, 0x4e6b87384f97d79c, 0xdddb58e4f37c9233, 0x1bcb9f0e1e363b46
+, 0xd714211b6a6d6bda, 0x2f6d96d8b63bf4fa, 0x580f4a1ece1814fa, 0x6d9b72a7702dce6a, 0x7c99db0817df5b44, 0x70e5ab82c9d57bc0, 0x12b266ba406e2285, 0x41deeb33aa449fba, 0x322c332e423c593e, 0x345809bfc8a5c43a, 0xe59a975d2087db1b, 0x064858afadc632dc
+, 0x340c233ee7a113c3, 0x0d1d39a1cb489220, 0xc578a836eb686419, 0x4e29f750ce20b7e4, 0x69a05eca7ef159d7, 0x3d8cd689ca2e7f84, 0x6b67f6c92ba18ba2, 0x4328193331d77513, 0x0de01ad400b950a9, 0x537bea46f3c7cfce, 0xbbded244bb343161, 0x7dadb89f764e4ace
+, 0xc962d84ca46859a6, 0x4357d578721c5993, 0x7f38d015a21051a0, 0x44f6b144ed037d24, 0x6d788aac296a190d, 0x0be74a4f93e36a2f, 0xfc3c02374ce39496, 0x3da4961f9bd30149, 0x2a2aae3b5f3f312f, 0x7daadc1ec7db645e, 0x0d58ac686e26607b, 0x430003e5845736fc
+, 0x0a43bb45d6b64301, 0x55ed09b6a6d67251, 0x929f04c863d8ffed, 0x6e2524ec10d4f29e, 0x995b5c808ad37e8d, 0x4b330fb7e57b30fa, 0xc18aa16604dca829, 0x2a1f4c4ac5937869, 0x2463cb97877a3525, 0x295887a6fed763e3, 0x93056c3f52efcd9e, 0x059386921cdee89f
+, 0x83085891e70eca6f, 0x1b6f6929ba213443, 0xae877c5f00474b6a, 0x594de5b450c2bee2, 0xfaf77f7dff8f852c, 0x3fb589e10f87d86a, 0x3d4add08bd276392, 0x081eb79568e0d0eb, 0xdb488e76c524f4c1, 0x08b965b53db2dfe6, 0x71a8cd3f76bad4ee, 0x4fc66bb79327ed74
+, 0x0ffe30d7fee55de5, 0x70bfe4c6590c454f, 0x8cef675d6bd6860e, 0x087cbc36081bc39d, 0x613dcdd0d2a3a2e0, 0x55a1f09b8590c928, 0x261637637c3d8078, 0x26a5d290f544240d, 0x0472eca0fa6a11a5, 0x11003d1dcda25b4b, 0x20209535657ad0ad, 0x5cbddfb4cc77897b
+, 0x66c6c03683ef7b71, 0x5c74b71e856e0728, 0x913d9583d9946069, 0x7a6f2326ec786d1e, 0x065a08282f4f9dd7, 0x32a8c2a579e69c35, 0xff20ef8442effa25, 0x119e7be71dcb7ceb, 0xc438ec1198857927, 0x7399003f5b1c38b2, 0x6acf8041960ef3ad, 0x38091a898f4c743f
+, 0x233ac75a2215896b, 0x0e80fe374621f75e, 0x8269849263c2e11b, 0x64cec9300cda17e6, 0x92bfd7ff9a9c572c, 0x61097d2bb2487b1e, 0xcbf035685cae7034, 0x3f25b58d12729899, 0x4aa1435c450e97c0, 0x116e778e784ab955, 0x359632239ac12b4d, 0x29689fd900171ba6
+, 0x0c424195837904e1, 0x305f2e4069143902, 0x31bf838a25d52239, 0x7874a7e3050c5c9c, 0x646429256aee0135, 0x7fef38fe8db3ebb9, 0xcc78dc8fd5eb3d4f, 0x4252648143f71c62, 0x4403e81d13c8d6bd, 0x18414dbb96c73bcb, 0xbfc339fb2021a7ff, 0x7b5de53fd6e00229
+, 0x054e4a3c2a8ba76b, 0x31d30e83a333a0ca, 0xa5154036efcd906b, 0x7ea850a4f43e172c, 0x3209a79b0bddaf61, 0x22f11b5b474cd695, 0xdec4f6321dbc1afe, 0x14752848e7d2dd7b, 0x7f0664d31c303891, 0x39c575b8e50d0cd0, 0x81461f2df47adc1e, 0x7e4c647e68069256
+, 0x1679654fd5af05fa, 0x31ecd714ad2e7bdc, 0x63f6cb2743c13cdc, 0x01f173f778537b7f, 0xe5e18389589bf850, 0x569b5ac0be02d930, 0xbab2caf9e723ceac, 0x39463c68dcc11d28, 0x5750c85870e35f1a, 0x1098e7aa812216c5, 0x1508c80fb22d25cf, 0x587ff40d5939f293
+, 0x1ad5d04baee37703, 0x1725dce507948291, 0x0f292521643a3eb0, 0x086bed64b587c220, 0x48526065581a13de, 0x0fa0d127d2b37752, 0xed292160d90a74bb, 0x2c106edd0b736adc, 0x5e340e2e558f3c5d, 0x7c577d93c315b1f9, 0x33743e736a6cf2a8, 0x4c24b91e4358ae26
+, 0xafc63a16e5603c0f, 0x28279e8a0b10f429, 0xf97da6ad3bd2a2cb, 0x7083f0688f0a343c, 0xee646f4e78cc428f, 0x415b93c16928d3f8, 0xbed868ff20610485, 0x2c7eaa3b07088d8a, 0x2751c9eaf52b7933, 0x4587c0262fe6fd15, 0xf1f394586067f288, 0x5115806874ff1b03
+, 0xbd2e5553c9ec57ad, 0x1cdb3a866e49ae40, 0x3ed055312507f28f, 0x2474a2a3eee79de3, 0x216da5fdc9a28440, 0x3935f9d78d741e1e, 0xa870d0556d6ebd2e, 0x7c8b0a4ca2475faa, 0x8271836ff6374c6a, 0x792ba4e86a54a492, 0xeb41cb6371cb406c, 0x3d424b27e35b3a4c
+, 0x9da6556742f3cd6a, 0x279c27759e832c98, 0xfc8c3e9dd011438d, 0x68193080900e0758, 0xacabe0bcd34ed000, 0x2acf1b381b53bb4f, 0xdd032387e0de706e, 0x548337a03b077588, 0xc26d24f1ed31fbb9, 0x7027e9e6fa9316cf, 0xf0bffa8ee45848ba, 0x2fbe917f8f46492e
+, 0xd1395f80c85f6e46, 0x10387c2784c5a919, 0xa480c5175c4c5598, 0x4de6a044e0152653, 0x19edd2038630b0b9, 0x2c93c68a261c96a5, 0x8c4e98efb7e70dba, 0x27ab3deac91608d3, 0xa476cd34b8c4a380, 0x4a9b1b8cf42b3de0, 0x45a4a6e1d9bb0fa7, 0x4e8dcbd3fd56f307
+, 0xf245ffec2ebef3aa, 0x07ec15a540d74cf4, 0xed7ccb38d49d2a56, 0x709a18bc584bc8a1, 0x19235b9e7e45f30a, 0x7e40b6b084099e1f, 0xcdefa9e601458a27, 0x34763381e6c27d8d, 0xe1d8ff7a6d3f1659, 0x372f229b93d7404d, 0x196fee581b580da7, 0x09996950e1a273e8
+, 0x530da0adc4126378, 0x78a936733c423848, 0xfdb1daf6377e85f8, 0x177022386673fe1d, 0x22328acb64e23719, 0x0ecb42b8498c7cac, 0x1ee6dec866a23b83, 0x4f316404c8ac32f3, 0xc42013634621894d, 0x3cfc63564db3814f, 0xeb3ffa11ba146cbc, 0x5728b12cd84b21c5
+, 0x861e857aaac52037, 0x14a8894b3cfc830e, 0xecc6ed81fe737651, 0x1a7124610653e3a3, 0x425433d9645fc145, 0x4db9249cd568aefc, 0x8629100b71bb0133, 0x6d9e6a8fbf5057e9, 0x3f839e599f095fe7, 0x25c738d313bcab30, 0x9ad5648cabea7654, 0x151865c42a2c514a
+, 0xa34a8542a1d5eea5, 0x08bab0caf471e0ee, 0x26db9e4596ec19db, 0x5ab0002f0358405a, 0x22fb92c4e166503a, 0x5def417c167b76c3, 0x8788ea02c3fa19f3, 0x4d043b6a380efb10, 0x2bd7b82e6858939e, 0x5c44c14aafb92023, 0x082558f58ba7016e, 0x1d3b615ebf57be02
+, 0xccd3558a39a24bd1, 0x7cf135a7b9e6cc21, 0x54556a5821dbae32, 0x64a1c56b8f58c5d3, 0xbb1b29eabf48a3c7, 0x062de4af0ce07316, 0x48335ff89ebe6529, 0x7f4aeccee0e3f5d1, 0x50d684efb7a8b5ad, 0x4740a4ff3ca7088d, 0x643bc86f0f32de6b, 0x65de3a0aad59374b
+, 0x843eca66b31276ce, 0x14bb77c44467d05f, 0x8c852422a826f9ec, 0x2b079e33c7c36418, 0xbfeb546b3e8920af, 0x4b611ed1c05623a3, 0xef08b6ad45c856e9, 0x2c605c4074fd52bb, 0x998a3f3aa0307faa, 0x053d9414f36c8a6a, 0xda430f0b3c411aa6, 0x02ab36c84366e6f0
+, 0xdda5ef86c6b2c8d8, 0x5d3d64f56abb1f93, 0x4e6a3606d6e3cbee, 0x63c6eebb7e98f4da, 0x3933fc4419343d14, 0x22617bdddde80b64, 0x8b95e003e69621f3, 0x20b9dfb521f3a689, 0x3ccc4333e1237a01, 0x036a4a5cc252ccd9, 0x284d40b794d41d9d, 0x03be9743919ce8db
+, 0x4c16532ae59bb222, 0x0ec7510a9feebe29, 0x469b1b8176810829, 0x4e93798cc1355f3b, 0xc29d8b1739f9a2d5, 0x5b30d1f21aebc0ef, 0xbbcc7bf12efa7bc0, 0x79a1639010822241, 0x335cfc50bcecbfdf, 0x5dfcb5f1e984462c, 0x22c3029ce7db0c4b, 0x249cca758d7e1650
+, 0x362e83d786dacec0, 0x64bbd2b389bd57a5, 0x84c8752524a644fe, 0x535f4f067dec913d, 0xe8c302324ba9793e, 0x18957c201b871741, 0x48fe233a6b8e7788, 0x07504ebe3486b480, 0x8403d8aa373a8242, 0x0c845625d6174fd8, 0xc6059513dbde3131, 0x70ce15f26707934b
+, 0x0a51439673656c6a, 0x1842b8635d81bc2a, 0x7f90950920950932, 0x196b83ae5ae13146, 0x7c090c1a07d86fbf, 0x19d479bd8d5e6da0, 0xb7fbcf0ad1dffd29, 0x5a6bda4d5469e1fd, 0xc8345638c56b6cc1, 0x37ff936eaaa31305, 0x9a86bf7308ab7314, 0x05fd39ee290ca592
+, 0x9b8faed0e206626f, 0x36874ce534a544c2, 0x53d30f7ffc0e5354, 0x7edff7bb0389461c, 0x321c781b4075fbbd, 0x258158f35a6d06d0, 0x03eaeba905795afe, 0x4ac174c89d3cff97, 0x793f20bc289a1820, 0x592356d2001ba34b, 0x9a538786307c99f5, 0x597f30848f6cf49f
+, 0x7d6e1e01691f5612, 0x02103b5cd320e027, 0x62bdc85a6809032c, 0x16044d077634a47d, 0xe038e75e0bba8d09, 0x61905ffd45d053ca, 0x7b2523cc74e3a143, 0x3f8746053bbfe7ec, 0xba616b862c0d6619, 0x5000b3789d533065, 0x079d5c055f06922b, 0x6935e066f730d606
+, 0xb0b7ef3b7de2dfde, 0x1163c3ed79303a40, 0x5dc8108a73c22799, 0x3b24eb0e26342518, 0xe2fde4b8267dfe45, 0x3f714e961fcc2002, 0x674b1bd9a7341a60, 0x52ed1fd62f766e01, 0xcbf0d442af91850c, 0x7af69d740a3981b9, 0x5abb2800b575e31f, 0x46179ad385da0f69
+, 0xd0f980ac9f7208bd, 0x3815476d2986bc02, 0xe5c1384cbdcf5d32, 0x1af4f73dba459507, 0x881eb9f9b4731897, 0x440d636040564b4a, 0xcbce8d66c3f7b4a6, 0x0e78c6b7c8f59c08, 0x0fedb24300f9894f, 0x0919ef224effc09e, 0x852a2172c7a1dfe9, 0x36a29c364be071f2
+, 0xc6faba1307cfc92e, 0x227fdef28781cafe, 0x548fddfe567785b5, 0x6fcfec76087fc021, 0x44456d2dc8cd6cfd, 0x194d951a27536193, 0xd8e37fbc6e8c3977, 0x5bef29f884529eb7, 0x6194965e0429f2de, 0x297e626546df2707, 0xb9bb3ad6b2a5b973, 0x676c96a677b70518
+, 0x72eaba6edfbc4c10, 0x4a04aa56c1a50b24, 0xcdc89b393c1ffb06, 0x404689d27ffb247f, 0x4cb20e95de1df992, 0x6218d9634b26c4f4, 0x8cd6f743643de3ed, 0x4fb96737f99c0b1e, 0xea716139a907be12, 0x32f8cf4d596e9c46, 0xe11ba226499dc44d, 0x6319ee79adca8925
+, 0x9329af41e73e7937, 0x55ec16bdcc341e03, 0xd6873ee4f44c7799, 0x77282822096957f7, 0x0955b96906a7e8ba, 0x57be37c3bc20e467, 0xaee772957f295eab, 0x0d43631ce35c61f1, 0x9b9dd0907ed5c8c6, 0x41943eb15f62cf9e, 0x99c863e8c6d4b686, 0x7a67577898694895
+, 0xc5db5e22afde12f8, 0x2de7c7bd2bc4510c, 0x909a3b98873eaaf0, 0x1233976a9a283eb1, 0xeb9d81da05c7e596, 0x2bc3f68e100e5292, 0x78a4a3484cc203f0, 0x27e549568f026237, 0xa993e2dba9bc6b26, 0x5e23dac38eee8b31, 0xb4ff5570625d82e4, 0x7b08697e0181725c
+, 0x93948336dfec86f6, 0x2d7e30d1366e3064, 0x544198bb87ee4f4e, 0x485f901f3aced4b4, 0x4eb619d885a4364c, 0x33931225c3e10214, 0x7caceafa684ae851, 0x4569b36c6d988faa, 0x2ee8333cf7071814, 0x1435ca31e3e880e8, 0x2414557c81121c1f, 0x45ab58e699203eac
+, 0x0dac03b26a9adcfb, 0x617fc210194ec4dd, 0x35b2d2de4ddaaf53, 0x40a0f8458e246f2d, 0x8e4e0ded281539ed, 0x2193f779a03ef7ac, 0x4f2a366207db9274, 0x7f57199ef3a60601, 0x64c64c83306464b7, 0x637a924333a69120, 0x8f9272f0abb014fb, 0x0da220721e9f4476
+, 0x9beb46c2c2b20b58, 0x1713305c61a83a44, 0x2f37824a930d1010, 0x75f8f03fa8b22dc7, 0xa759f5a7189759a2, 0x2ba9f5c20f8628d6, 0x4d18576aa1d9979d, 0x47318d8299bfa344, 0x1dbdcebe8241ac66, 0x36a450d309311212, 0xb25ded41e5e6bf4b, 0x56c051acefd474ac
+, 0x15116d75320c62c7, 0x6e75c9b676050396, 0x800569a4d618ffa2, 0x71fc0b33b6a1de6e, 0xaf930a0bd11f593f, 0x0069afc4f2621a9b, 0xe61fefac9b11071d, 0x36fe11c8cb806dff, 0xccf762aac04d1489, 0x3251f1c7e5e6ae2f, 0x8b542eba5cc7a5d9, 0x7b36b88a5d7bee26
+, 0xf40fc9b2b394e89c, 0x1d273397c0207c40, 0x60d5ef43149e306f, 0x2d6bfcc96afde3af, 0x1bc850c48112dc1b, 0x7cc89493a3771438, 0x9efce70e9199f168, 0x7b4665dbadc2c420, 0x031d35fd801dfd1f, 0x321fbc0e0f15f564, 0x481f5cc77ba4f6de, 0x442a91b90a1d94be
+, 0x2a8dd0e6fb5c7864, 0x6256ec3860f718b7, 0x42110b7c78834964, 0x17f94380c4c229ab, 0x291f89e6805d217f, 0x0f16034cb403caf0, 0x316a87bd2a5bd814, 0x4d566f80664e846b, 0xc3a181dbad9dc13e, 0x4bd83fd58e0116f4, 0xc1c7cf62036cc395, 0x4a3bb553d2514c2f
+, 0xdacc3e9538a62cfb, 0x6525cce0d7ae6a64, 0x01ccc675f98512ca, 0x741eb473a1e3a79a, 0xec9bea25d7b8312f, 0x2d6599de9a3439c0, 0x774c8ff8af394653, 0x4c5b7cd77a625149, 0x62b105845df21193, 0x4f76cf5c8c4f24cc, 0x6907cef230030182, 0x17fef4a1b8d16615
+, 0x5fba85654dc15ed7, 0x15124ba6d29f6667, 0xc1246a184a266b18, 0x03e7cb2b4368a5db, 0x88168fdd81e9c063, 0x7bb09b2bcd8eabff, 0xc64bb409e1f89d24, 0x58f6c368590070a5, 0x5439839afff56d20, 0x4019c0d51f44583c, 0x8fd936f62bf4d5c2, 0x6feaaa0bfa0e9ccc
+, 0xa10b18f29d15c683, 0x76c6eb81056362f1, 0x1b3bdaf1ce44ca46, 0x3f1d89240b1a1ea2, 0x1d74a1f9158a27e1, 0x1a54ee153cfc91bf, 0xe2c04c1cd0052989, 0x1a4c463408f5455a, 0x8b05db3b491b03c1, 0x06d78f5c8a2e1a8a, 0x6885d2cc00b48059, 0x412e1e02ee40b530
+, 0xf432d009413e429f, 0x231c37a55ee5edf0, 0x68595fd6c88998dd, 0x2025f7cabffb603e, 0xef6343b5f3e6d983, 0x40a98b2b412ab2a8, 0x6f9ba57ae3b4062f, 0x28d4a4ac3245fc19, 0x31f9877a0bc72a3e, 0x50c2d29c80678cc0, 0x379db883acf78c90, 0x6697c51aca8db6eb
+, 0xd2c7197def4b27c9, 0x13c986ad8e0d911a, 0x49360707c9933d8b, 0x6a5db007891cc793, 0x4d95453b26b7420a, 0x35f4bb0029b640ef, 0x3eba6644dd5048ca, 0x13b9c7caad1fe84b, 0xb2f78ec5d2f253ee, 0x74128da8adb27f88, 0xd1686948ec32ecdc, 0x27f15d0bd67357bd
+, 0x5aa69ebd00fbdfbd, 0x7e666ba19ac8a709, 0x99eb49b8ac0f27a6, 0x6757f0e8af2c3c80, 0xf65074ce23f789b2, 0x37c15fe3a767bf37, 0xc179ef84a43b6ac4, 0x2216b65a786636e4, 0x722616fdd840bc3d, 0x1085facd4535b212, 0x397d6f63798e1ab9, 0x799df1f2857362fd
+, 0x45e344b0ba82a814, 0x71ad78ea7cd22450, 0xf875cf55d45129fe, 0x34f00e215df53dd0, 0xa015278adcd96f31, 0x23c0595af0e45299, 0xfc2706989e2d1e8e, 0x2e3ec5437d5ee420, 0xede6e58792e7a519, 0x2de644e6f1002730, 0xb0948c193f0b6a2a, 0x73c6e476ceb4feb7
+, 0x40d3e825aa32ef26, 0x18bbb7ae5f27988c, 0xe5afb2338ef6fd54, 0x053653beb15242a6, 0xaac6e364faea2aac, 0x51fe23b56d00a141, 0x2615cd069db61859, 0x7d70dea0bff6cb1c, 0xa8f2eb70ae84ad6b, 0x5b1778d0cfbc3597, 0xf8ce82aa300e2932, 0x0066ccdb9f55f00f
+, 0x43b931861629d2b1, 0x53e88d5fcf3b6682, 0xc8b462bc6a6cdaf3, 0x01cf764eedd393cd, 0x66ae2370259e7021, 0x1f453db67bb932b4, 0xff6bc2912ebb3e07, 0x06c56be4d85e9bad, 0x94a1ba7d1b74ff52, 0x4e56fabb309a7391, 0x86f46b3ad6460f56, 0x2305d9e555f17f44
+, 0x8b309ae97be4cf85, 0x4098d6b0fea73edf, 0xaf927bff9bf32d62, 0x049963648308a918, 0x5a7ef9ae9e3c9689, 0x4de556fa74cef725, 0x32bc765b63d52753, 0x52e93202ad1c30f3, 0x8aad3b3bc066dd87, 0x3431d9bf9fbb6e11, 0x26556705ff12d625, 0x205f67626ce0a369
+, 0x4131ade56e831905, 0x0cacc746a859b129, 0xebfd9bc9554728b7, 0x10714a7ce31fce82, 0xbf53c72054a81313, 0x1593e5e7fa3f64a9, 0x8d6a3a7e6ab472ff, 0x055335b97c7a1f16, 0x29f77f0b5018b915, 0x7b30d66ef7017def, 0xec8e9cfc390d9a25, 0x35a2957fdca9c145
+, 0xa2c9bd92b1586fc6, 0x6c4b7eabba91d165, 0x475b815311d24e24, 0x2f76bd8cb1fb76e6, 0xdfdeb9e68f95b8b3, 0x1f81884131eaff46, 0xf4568587807326a8, 0x52b9f8bd45359c78, 0x9df89716ec9a2271, 0x2814f6c12a2d1021, 0x23fe158f9745db35, 0x75da0f9d8783b12c
+, 0xca10828a37247ff1, 0x298a0fbff668a029, 0xc89ef9ba62f50eb6, 0x17812dc4d9511782, 0xd0a01938c3597c42, 0x4151752893cd888b, 0xb20dae6fde53ab57, 0x5618ad1abe8deee7, 0x0127b46de8b4e12a, 0x3fa26b942b5183ed, 0xda879deea7a60b1c, 0x3c900c49a1459ddc
+, 0x582bcc6cc0666950, 0x1084ddd9a51d934f, 0xb0d9ec6cb2fda7d6, 0x185d57062c37a6b9, 0x2eaa3193aac6b000, 0x6c4f023b6f86413c, 0x1c6d95469524fef4, 0x235d8dbe9e943171, 0x074be0bf7bba3853, 0x2fe668140799ad27, 0x42f08a2a3549966d, 0x735709b21d187ab3
+, 0x886ca91dfd5241e1, 0x418a9db4359a8c26, 0xab049b55a32b4e1d, 0x6b542d8a0dd433ba, 0xb9798e643d211346, 0x782f1834db85ac48, 0x4fb5285a5c9415bd, 0x1352ffd83b971e82, 0x01dae6b531a986f2, 0x44f0db3f33787afc, 0x7df99d94baade360, 0x76a010ee1b245307
+, 0xac461c07e3c882e2, 0x633965b064ec7feb, 0x05070a8f6e8aec04, 0x7ae172353a4c0025, 0x4b8fcc9f63f3979a, 0x5507ae6a8245e5d5, 0xb3893d297774497b, 0x735624f0eea1c16f, 0x6cf1562f91d6e002, 0x7f79c65ed5deca16, 0x4cac605b2d79c2bc, 0x5d04676a3aea2d8c
+, 0xdf20b467129c9c8f, 0x5220237e2897e212, 0x3cade2ab0f24ed8f, 0x62ffc24ebe07acc5, 0xf5665180e8069069, 0x774e4f59500d88de, 0x96601836d1b02a4a, 0x4cd55fe4146d6c05, 0xf0059239444f328c, 0x7a8e27afb65caf01, 0xba8f59d38770c192, 0x62b47a27b29e66be
+, 0x7375eff66d58995f, 0x33a1538b649f201d, 0x4119589a6d5c6604, 0x425670ffbdc3f388, 0x26a17404a7a620b2, 0x29a97893a541d56b, 0x47f2ec9719eeab1d, 0x0017294fd3bed256, 0x1e632d9ac7eed442, 0x3db52c2a3c42333c, 0x9e27ca934a8580b6, 0x153a8740ea739970
+, 0xebdf33d54e631a62, 0x0ebb60b44ac35f9a, 0x36782b09489b2a97, 0x59d812c06f40e959, 0xb1a93d006224a286, 0x708558bb676ccc3c, 0xabd469be7dd11a5a, 0x5f0d5e6742dca562, 0xa98f886f4f2fee9d, 0x09949327f9eebedd, 0x94e8e94055e9d169, 0x2214d22bca5f13b7
+, 0x3c26835b7d745584, 0x5bca5cfe4efe97c9, 0x22373aaf911707ea, 0x30d6783fa66681a0, 0x1855ff3501e36e3d, 0x3bd6dd9991a6c052, 0xf810a2029280695d, 0x39c5dc0ccf7fca4d, 0x872eef2c931dc5bf, 0x2d1dc7043f9ef58b, 0x8f20afcbb0471d82, 0x2cc74b8aefad1284
+, 0x391d2a670452b6de, 0x32bc81914fd347e9, 0xee683937be2f1b13, 0x255cc61509e4528b, 0xd14ed7df57964fd2, 0x0e0e7352197ef1e5, 0xb7b545273925d021, 0x6d096167371956c1, 0x91f32cbabc50624a, 0x593746ed5130cd4c, 0x99e88b3720ea6d9d, 0x479f704e892a94ba
+, 0x4ceaa09ca8a9bdb4, 0x055728dee383ae52, 0x4a20c48a0180a8fd, 0x0feb7a88277f7751, 0xbb617b7be146d3f6, 0x0889a608a59e9d1f, 0xfdc0cc296c1e1b63, 0x022ebe884bbdab0a, 0xb2b578ecd8c1e1c4, 0x5bd9a721ce2e25b3, 0x16df3637dd8cfbdc, 0x63e5ba57c5dc0fbc
+, 0x12c27927c606c80f, 0x6b4a016dea4cdd33, 0x6fb0af1632414026, 0x12e19620b761e90f, 0xc4b685ee5be024b9, 0x12c533501bb3b3d1, 0xffc8e9b76905c440, 0x4a8607325ce9f060, 0x5ee8159de38901a0, 0x38080681a585536c, 0xf302d5017ae62fe4, 0x70fc28876a18eb7f
+, 0x6fc8faed36d50193, 0x057a20c0a5269f3d, 0x39a946d45fbd3728, 0x70cdb773594d9a1b, 0x980030a9001bbc34, 0x08dad0043dde8237, 0x1582c9c5524472a7, 0x4dbb791741bbb269, 0xddb71fca20fb63c8, 0x6a2891c96a131bbd, 0x684f1cb3b70bfada, 0x6c3eba207e1d7afb
+, 0x50ef78c22cdb7db5, 0x3e772df3596385a1, 0xb09faa0a803047ab, 0x187c7bad22cd6801, 0x13027053da0e292d, 0x7566e6eb62827e11, 0x5a5ed409737d4620, 0x572d8b1e5e7d3464, 0x9d7f18396077b88f, 0x3c309ec566ed938a, 0x0ebcd7d90ef45757, 0x7e930538d5819865
+, 0x29a6d7a4f90ba1f0, 0x7ff50189de101837, 0x32f49d04b1f0ed8f, 0x2e19dc47202a37db, 0xcbb30e8ac681f74e, 0x219939a9b5566a1f, 0x378a07e070b06971, 0x05b865667e1549a6, 0xeb2cf09540418a33, 0x4205104f8de7e52f, 0x772cb57dc4549ae7, 0x1a6c9ad2613ae866
+, 0x66414128974b8ccd, 0x02bf6be7527d897f, 0x81de4be1e2ea65f6, 0x6d85ed9ddeef06f8, 0x669abef077a7f937, 0x41274682d410b0d4, 0x6d04bf5e7d988a37, 0x27cc8f6823be20cd, 0xaf06b0b6df6ca2b3, 0x58efcfb0654dbddb, 0x285aa1acccf75fe4, 0x6a34779f501eaa3e
+, 0x17521f358500d596, 0x5137d7d2071e546f, 0xb798e86c34afd879, 0x6654c3844ffafe4e, 0x97b1c847c9b83d14, 0x30093b18ed253829, 0x86ce50108a120134, 0x58c84a81a2667f35, 0xb7112639a92a5594, 0x2a12d49f186f0901, 0x849096cd77bb5494, 0x605f7e82dd1e41f0
+, 0x99b2007b1b1f2fa5, 0x04bcd9d93001f9ce, 0xee15920167c0ed3a, 0x5b8c789b56c96e0e, 0x9aea82bf755da5b4, 0x2e20ddfc322d9ab7, 0x0ba3d8da08afc76c, 0x1e37349650df2b57, 0xd85a9e57ddc0012e, 0x6c199f4736def858, 0x67d2b906b6011c5f, 0x7d67701867a3ca91
+, 0x3133a81eaf1b80df, 0x79d3101f73eb9717, 0x3017fe8882ff53c1, 0x4cd835b5722c548c, 0x91e6fdaa899709d6, 0x2853fdd018986aad, 0x2700dade650a73ce, 0x1288f028695620a5, 0x3d5653a5ccddb7f4, 0x57be4b6c884fc149, 0x11a9162014da07fa, 0x5854f6f38da42fae
+, 0x65b2e4ad37c40746, 0x4160024b2d913aa3, 0xb833b826a6ab41c0, 0x36aa8cd78129a370, 0xc74882473418ddd7, 0x39a4b2288cf805da, 0x184d06e8f07298c7, 0x2dc2550803e83c66, 0x9727f5dba2b383ff, 0x503b224a1777eab7, 0x834937b40af85243, 0x13bdecee31d6b438
+, 0xe152759e35cbd328, 0x515e710e07596f4d, 0x9378d419313600b3, 0x62d190a0325c2bbf, 0x81368419b448a9dd, 0x1ce0d411d606636a, 0x23c710199e08312e, 0x6dedbde72c281013, 0x6807ea21d88a05b9, 0x4f01ba6675e22e55, 0xb81fe0efccd8abd6, 0x1cf2e4dd0891d0e4
+, 0xdbb6d47c8fe6547f, 0x3dd4d830a0264b58, 0x05c95aefee657727, 0x59e8c5a787ae2278, 0x1a7dbcefc597b406, 0x0107593d2e3886a9, 0x74da669b2c3304e4, 0x4afcb47858f44871, 0xf816742dac065ea3, 0x014f378f109f72c3, 0x151e22d30f6f67be, 0x47eb9066bcb3533f
+, 0xc1f1834c5f88a912, 0x714c21f525837af0, 0x4ea7d9f459f14b02, 0x0d219a85cb929715, 0x92b95ad6ecf9064b, 0x7716bb55e8099357, 0x11c77071e3ff212f, 0x3d8bc22b04ba2bac, 0x9dc90dae8d05d845, 0x1a93aea567592dcc, 0x0423fbd80b5a3307, 0x066a937c8fb1c045
+, 0x107c31e132e6c058, 0x0f34d51f66bfcc26, 0x7fa5b01424f548bd, 0x4dcb661646e7a08c, 0xb16a2674c893ec2a, 0x73a0892a30519a67, 0xa4d526d185084ba0, 0x7d9674b021efbf42, 0xc5ba2f66e70b31bc, 0x0f7778b5ea9387e1, 0x3df39263a0eef835, 0x344fb8f87e236a8c
+, 0x4351e50a46a3e0f0, 0x24d1fe112b7be035, 0x76c21210b9ad3574, 0x4c8d177d98ff03f8, 0x53f535fcfd40535a, 0x2d4a370f51dca753, 0x5ae46f9251fbcf0b, 0x50ce87769ea6a13d, 0xbb639b2a03498966, 0x402bf2b211018f93, 0x8ebbc440a22b2e16, 0x5cf860461a56b426
+, 0x39651480ac5faec8, 0x33ecfed23fb40cbc, 0x25e4954a2e8ca28a, 0x7aa255c4765e7d78, 0xf326ef527c8b2a86, 0x088c58ddb2418866, 0xc150852d227a9b65, 0x7266a5f0cfa1d050, 0xd861cf72ca8b6eed, 0x5e4830a9f3f8fbdc, 0xfa0a5de32060bde1, 0x3d02f6ec2c86d5ad
+, 0xc44b1720bce76429, 0x1091a3ed9cca816b, 0xb01a8bcaef3d4bf5, 0x76eea5ac45146a96, 0xc4bf6a401e6d0b4a, 0x62bb3b467c9106d3, 0x993942dabb0ebc6c, 0x1974a13e4b89b23c, 0x9ac85a7f74cb2187, 0x42ac1919f1dbdbce, 0xdfa66c017a2b2dae, 0x024cefd0b27fffe4
+, 0x79426c3ce632ce3e, 0x7ef4d2a447554a7a, 0xaf22ba3d7f30ac37, 0x3edbd83635f19d20, 0x4fcf8d7dda9be502, 0x42ff9742ec55bf7e, 0x33d62a6094240081, 0x7aff5a6e61a1312c, 0x964d1f5efcb7db5b, 0x22c0cfe6ea678866, 0x7fc6550bad787ac6, 0x308c5c10dd9258e1
+, 0x1c32853977ff7a3e, 0x1a553782579c15d5, 0xc4dd01d261795760, 0x5b4e9605d045cb5d, 0x462705c0afe81aa8, 0x2be68ee2cde0fd45, 0xa4ae86ef302e177c, 0x461f274abff05894, 0x8028bf93d08c6647, 0x466df32941d48217, 0xdf60081ea0860199, 0x3cc9886e504f1bb2
+, 0x5cc6e53ca2d31c28, 0x4c958fca8156c627, 0xbdfe01217a6def0b, 0x683bdb2b1f94fab5, 0xc171ba71c55d749b, 0x0cf1446a6f6e6409, 0x78a62c7841b9448d, 0x037d99e6f59f71e5, 0x346309340fd22334, 0x0336dca7a4d2db9d, 0xa352c486251d43ab, 0x06e9cc7aa67a8bb1
+, 0x7bb0406623fe76af, 0x5d29258345067810, 0x02642c7d1055ddb8, 0x1bdf297356dbc962, 0x15561ee65136adee, 0x049e5f30db996a34, 0xbe17ca9fd653b09c, 0x3341e42e034847c4, 0x115bb24f8b448f04, 0x697b764637e2cf55, 0x264a70c50c3de1b7, 0x1dd1aa9626c5ad4c
+, 0x0c9a5ce885328156, 0x7d511f6018b344b8, 0x3fd1c1879b58229c, 0x733c929c960f2d75, 0x95131c117cfb83f4, 0x24afe142b14c6452, 0x4466153a70a12ac4, 0x6dc474d882821600, 0x565b351a83354b7d, 0x1b07d0636c05e48f, 0xd498b66af6a741ce, 0x452f08b43982038c
+, 0x452add083a36d3e4, 0x1324284bf7b97338, 0x08915bbd32add6fe, 0x7ab3adb466890d59, 0x20343f45d2c1e423, 0x2f182b66c18e885b, 0x54063ef53381e75e, 0x255c8c7404f77a83, 0x84f29bc8db473807, 0x7d9c730e7a084da3, 0x10fce07e78d1c288, 0x7c00bb2a2f7f8640
+, 0x7550295cc2e8ef47, 0x5f37d0fe8d709b4a, 0x37724386436a42c4, 0x2d77e0cb9a30b536, 0x6a78c4dde7b350a0, 0x1643c918374b1c19, 0x199411d9f44096ba, 0x2b666d46e69111b1, 0x5a17be72d05a8994, 0x796d3f4216fa4baf, 0xcb300af8465f8558, 0x65a3fc2fcd1915f8
+, 0xaf1b7bdb71b9235f, 0x5689323058402267, 0xe347d97fee06499c, 0x3fe04cfb84a525d5, 0x481de15dcc17d851, 0x2df716b9ec47de32, 0xdc7a158336223fe2, 0x3ccc406a11d81aed, 0xda708e600d039869, 0x456e4ca2b10144e6, 0x8e2655ee8894ffa7, 0x2a3b74bd94ba71e7
+, 0x2d8e6092dffdcf56, 0x39857ce8d2ee2574, 0x23fafa3d8e35a9b0, 0x7cf5bba433236066, 0xdc8d661f2a572e8c, 0x4f4e51755f41c5b3, 0xcf0661139b2dcbe8, 0x7c7437299ca96fb3, 0xcf1ff6f9ef154f23, 0x2cb4fc1f61dcb74a, 0xb5ffd64875325c59, 0x4f2833f459859f1e
+, 0x88e45daaf690f21d, 0x581f8df26cc39043, 0x0d2110f1a94e8a1b, 0x569e4503553426f6, 0xda027d4824a097b6, 0x37e871b566ad1cc6, 0x233fa34b4828f2d0, 0x05acde1c4a913b90, 0x11dec9321f8292ea, 0x3501941b7d4f83b0, 0x46213e053f96538b, 0x78504aadec0118b1
+, 0x698e7758a72f41ae, 0x755520f29f65ab59, 0x874780d1bea6bd1c, 0x4e760ccc2642887c, 0x885f8fa4d11af4c4, 0x138185009f373921, 0x12b8685213050b6c, 0x6f64aeec639acf8a, 0xf7d12a4b6da77631, 0x3be1bbe1b236dd8f, 0xf0aed818f8487841, 0x54ea62df85e9e8c0
+, 0x62e4c5fe17becc20, 0x62cef1af99d947a6, 0x885241f75536ce49, 0x6b6ba88c9bf55f00, 0x7c5c53b1194e3f2a, 0x418b134f9baca4b7, 0xdd73574a4d50aa6a, 0x1cec73e279a5ef5b, 0xa5260932581ac561, 0x04eafd67d45bf3e3, 0x5666736bb7d7b868, 0x142dc5cc3e719a93
+, 0x4d2553ff1aba613d, 0x4c8a60025d33ee61, 0x3a117e1844508670, 0x7554df7898100b38, 0x79975a19454aad25, 0x115294c8e5b0c146, 0xc4ef9918c0a7a15c, 0x1a7987f894e22c53, 0x0a9a570762c413a3, 0x0a0a90417bc884c5, 0x32afbeec82668972, 0x4676ba5544ac5122
+, 0x6f9a45c3fa6d8d93, 0x24cd478489720dc0, 0x623c1390e9fe5b85, 0x05b39c3f095b2f34, 0x59d763241255a291, 0x662d2e0e0ffaf71b, 0x7e6fb4495d4be3ca, 0x5796cc95b7993e3a, 0x2ed34a14d3b9b852, 0x486bfa621ad3d529, 0x18a04e6a82bbe346, 0x04a4e504bbc79e3e
+, 0x97acbeb7737140c0, 0x37e866de3654f841, 0xac2e296db5b86e22, 0x686d898bdeebfd49, 0xd67177e622362bce, 0x2dfe301c21874aff, 0x39dc2e3e3963cf1f, 0x478c5419017b9add, 0x2f9c96720073aa94, 0x2a1a28d8d811d267, 0x2b589714ed6acc76, 0x54909369806d5fc8
+, 0x582e933f2a17aa92, 0x78fd6a4a4a7a1d8e, 0xdfff1acf6539fe2e, 0x36c57e6fffa2776f, 0xa88f33578286f082, 0x7abac06a5cfc50ca, 0xabc505c9fce7cd32, 0x665305eba608f1d5, 0xd210e50d4d7806a5, 0x453666a09d8d2652, 0x5746aacd51fd5579, 0x6eb39a556759b5f1
+, 0x9ae216669a31fec7, 0x30221f89b7010d55, 0x9e02dfab0aa5b17c, 0x1ca417543d351694, 0xe5814573ca41e202, 0x34afb4bbfc62bab6, 0x0aa97ab81351d66a, 0x7927aef7fee9588f, 0xd5d1128e8f352d9c, 0x0cfb6e4bad92dc93, 0xdc473c0c49b9404a, 0x1e081a4da1f1813c
+, 0xef91b534f867ff2a, 0x7e79fee32e9eebf2, 0x1eaa0f42c1732e9b, 0x209a54f297b05624, 0xbc9e7cc192c2d20c, 0x31b05bb045783612, 0xc74b9cda97a9044e, 0x430b7123036b414d, 0x79e37e26b730eebb, 0x0244adaa074a8149, 0xe811cea994995ce2, 0x34b5d3498afb735b
+, 0x7995d0900e31ef3c, 0x756573ff84a374e5, 0x2cf017e9afe1aa5a, 0x7f560a3c07e754f1, 0x458d5f2b763a710e, 0x3e3b4a1606fc3829, 0x8926e1753017e8e5, 0x068e330fb2a2c09e, 0xf04ecf9fee18ab65, 0x20e0ac857bc16b2f, 0xd6eb34e19a03b14d, 0x5b330a5142ce4cfb
+, 0x8db2484ac8b3f75f, 0x130b7857ba1cad9c, 0x49cd09afad05c6fa, 0x3009812eb4f4aa40, 0x3d46fd661b3c585a, 0x6d92f07067be4abe, 0xb170bf0c26a99a81, 0x375835fa15140a7d, 0x95ba8a71c516b59f, 0x12184a85ecb0e6e4, 0x1c90785b8f945ada, 0x7482d1e83c30666e
+, 0xeccbcd69eafbe7f4, 0x6340be2241b28acd, 0xce595e0d423f8477, 0x2af78a49083a0efa, 0xba5e1a3f255e87f8, 0x6f3e81ea24339310, 0xab8fa0a82d71db75, 0x21bbbf8d265fce70, 0xd4e54de3dd7e4301, 0x01fdee5fda18562e, 0x330f4a792442a8a9, 0x223e8b1ecf487382
+, 0x64d6dc915dc07c7f, 0x626388000fe988d8, 0xbdbd08867b7e248c, 0x772ba1d08c9157a5, 0xce6e651dbddedca5, 0x43d5876688fae885, 0xb31ed7490b9e4981, 0x6c0b9ccd76b9abc5, 0x43dfa09f106eedeb, 0x7f443a826e151ebc, 0x819bec2f40a7389a, 0x74e4b3ee0c57fb74
+, 0x968654fa4a810618, 0x7b6db630d55138b4, 0x9daed9e83a326e48, 0x43b67c0a4bca612f, 0xc0d697954d2fd2f8, 0x2568b34c15ba48ab, 0xc9b2cc92dc41ed42, 0x2350e5babfd57cdf, 0x05a862aa4ed07a18, 0x6a49d61299659388, 0x86369707519b0813, 0x6070fb824242da3c
+, 0xed01e37ca2902faf, 0x1173f938710624dd, 0x05e485c96ff0db6b, 0x0d0cb57f09bc9ccd, 0xa49dc5491aa5aa5c, 0x25195e531aefc52a, 0x00bb7bf97ed81f3d, 0x37dfccbe577030df, 0x19ec1cb42fc8d48f, 0x5fea5fdef46c56ea, 0xb1e3c75a9abdc416, 0x2b112394de6518c7
+, 0x0a40a5381bac6eb7, 0x38082aa247821c21, 0x8ba9021b24995049, 0x172dd27fac7ee791, 0xd2fe3e3b9fd71d93, 0x70b1cf7286d8c2f3, 0x8198766bc1f3d6e0, 0x42dd26706ead7b9b, 0xb038a0c4b5f7f841, 0x7fe630c27c1285f2, 0xfdc2558711ee6db3, 0x20c986ece4b5eb1d
+, 0x31ecf6c8465d9b37, 0x01204fb7e2863b37, 0x82fb0642ce1a88b4, 0x501369bfacda33d4, 0x2be15d64f3fd5af6, 0x3b0ea6cdab52eb23, 0x31c7069b87e91209, 0x6bbdbaffab5e0387, 0x51cfdeb17db70fd6, 0x7ae87d71137aa5d3, 0x436735aef9d4a8c8, 0x588a0f1abd283a51
+, 0xd7ea7c0a74b7c908, 0x004cf1ba02af6414, 0xff1a46b16650e24b, 0x43162548208ff878, 0xa69a56483515e318, 0x26960a716d195e0f, 0xe721154a8ae08bd8, 0x30a9ea5f65221b9e, 0xff208b1d961b6a7f, 0x62e6144cfff6ed1e, 0x4c8abf48f48fe113, 0x1d34002a08eb79a4
+, 0x4da9b0b081fb0040, 0x384d5a2aaf5b87d1, 0x30df06fb143f8aac, 0x65a1cfda580d1cad, 0xc09684139792edf9, 0x359cc94da3eaaf86, 0xd968b7706605f03d, 0x39f8dfb02e21d5d5, 0x69e25a1a4ae7104c, 0x549895f121a89a71, 0xcd0676f0f21d1819, 0x67179800c4affa64
+, 0xa27744401b24de75, 0x59b0e93a179869ba, 0x3323c9e26d29fa5e, 0x2655483ac92d9c19, 0x66cc3c0846636a07, 0x743fb420acd492f3, 0x016241ae7d4c0f06, 0x37aa372d52866fbc, 0x0f2ab0b6360691de, 0x5a2a711d64495ac0, 0x65b1fdc8d8d8d795, 0x2abf1c79a9fdf130
+, 0x61376de8d742bbda, 0x392485bed3bd0649, 0xda2816c8b4fba684, 0x4deb1b3498838c00, 0x84837ed3fdc0d6c9, 0x3af06d963b6eb0f6, 0x3cd11b5dc41d2895, 0x46282b8aaabf92f4, 0x1e7fab48c0adb7cd, 0x27adf97465971985, 0xc234d679095defb1, 0x7e0ecb641ffe8244
+, 0x449a59f2ab55f27e, 0x72ea0921b02c0ad0, 0xba7dd913de843baa, 0x5901c7815c394582, 0x543b2ac756014b46, 0x1e74b77f013bd39f, 0xa41a6b1159dd7e9c, 0x5beef50102c5ef16, 0x72937b814665d614, 0x453adb928da1d3d9, 0xcd962522bf9cf7e7, 0x4bc4a7d47a6dc966
+, 0xc7b7249840d76117, 0x22edda6f410afee2, 0xecd55ff73e549caf, 0x3eecf4b4674da776, 0x06d171cb5f04734f, 0x187cd1366ebfb9e8, 0x3a5e02584d8fba8e, 0x6e4ea40091a7977b, 0x4883e23f52a108f5, 0x29360a2fcaf617dd, 0xc994d653b03d52d0, 0x3efea8d174636985
+, 0x9e5fb9ba8b736320, 0x1edbc22686986dee, 0x0f0acd126049ac37, 0x70609e74c3e42005, 0x95bf0de1b10db132, 0x7c9dd24b0409c701, 0x4e2b258dc25678b9, 0x6b2b408281a6b6d4, 0x24978f771e50ccf5, 0x7e82733499547873, 0x207a102ff9c642d2, 0x091b5ddad992796b
+, 0xb9ac0d824947b677, 0x51eb71da849ee79b, 0x604896054b7cb2c7, 0x28f63ddc93713691, 0xce73d7097c7dc761, 0x21a627a7202ee4e1, 0x9d39b19df0733471, 0x5b7a23cac806f9d5, 0x14cb44629c694da3, 0x03f42bbe305129cb, 0x990ece516ebf7c8a, 0x2ac94e7fc72e38de
+, 0x6fc2154176b51ee0, 0x2f439c6c1e9a6560, 0xb37d47f4a9639573, 0x03e99917df4c1531, 0x40a8b271fb858838, 0x45b8a015f8bef121, 0xd5cb62ac5f27d589, 0x0dafe92061f1581b, 0xe8eaf339c6ce17f3, 0x26a4d19d529d03d4, 0x1073c0aee9865972, 0x4162e994e452f2c4
+, 0xd18db05d4cd3a631, 0x7728ea3d82e059ca, 0x90d3e81979071bb0, 0x725de307eb6f5840, 0x2814f5cf0bd5ec8c, 0x26a851d694baf4d7, 0x02b4721d4effc525, 0x260ed2a893905051, 0xf7559a51844e14e1, 0x0431a7a2200fec59, 0x957ba2a499f0827b, 0x4e91b022268fc868
+, 0xc469d66d3d09ccae, 0x5e63be73846c4a90, 0x9e7b9f0463fdad7d, 0x260926c68bcfa36c, 0xc018a1aea4a8b326, 0x158cc44a5ce17f1d, 0xb1e1761881393c46, 0x4f8012d005152034, 0x73b5d668cc8388c4, 0x64c28bcc02319c76, 0x4b4cc954e92b9c52, 0x090e0c0c8b89cbde
+, 0xc04ca98fce4bd1f6, 0x4945c55bab19c113, 0x9bd11b0716c31abf, 0x651914824d4087f5, 0x3cf4ace545c4aa03, 0x0ecceaad6c767ed3, 0xe960366393e0355d, 0x7d7c5cc111301d37, 0x300d45ffcabd7d41, 0x19c84ef53a0e4c02, 0xcd08b13d0e5f3d3e, 0x7c0775d777697072
+, 0xbf397b9ed12e964b, 0x2cbd31fb08a24167, 0xe108beb2b432e24b, 0x553950bb1d0bc9f9, 0x2d5b85350c36c281, 0x139d680e96a186ef, 0x535b8f8a012dc9de, 0x3b5a6a0f043fc429, 0x1c016b6a9f4f08a1, 0x5bca08293d32b13d, 0x3c3c6158fff494bd, 0x4f8381495403bf85
+, 0x284fd7a45f78eaf4, 0x73796b567659e101, 0x06e902524d658f94, 0x2f41c85751d3ad7e, 0x88d8c42d1097b91f, 0x19bf81b18c6c9b67, 0x21e5146914b54e0e, 0x10f0b29873754401, 0xa7693b7185a141aa, 0x5df967478122731a, 0x6a54322fbab1d000, 0x0d2e486160865c7f
+, 0x228c5b654e876712, 0x7e6c2edbef84e060, 0x1bac430b51789411, 0x480a27818acaca33, 0xe7e17989dad23116, 0x6886f1c2fe95321f, 0x739f2d5cbb1fa29f, 0x5c060d86ea63c97f, 0x38e644d0bce1de35, 0x1cf69fdced8e983a, 0x4aa524422b220cf0, 0x48217af6017576e2
+, 0xa5b55cf1520717d7, 0x373c151cd69387a2, 0xc1f73a9e20efaed7, 0x17447798988aa326, 0x4210e7b6e350b8dd, 0x0d44a80c7c552d3b, 0xee6d093a772ad5a0, 0x0d1fa2747d48b8d0, 0xbd25cf5046356d12, 0x652e956a9f8f7c9c, 0xde5656f6e4cbb88d, 0x552c5a4a68228511
+, 0x65ff5a20e94cf2ed, 0x3622f49d17cba05a, 0xe52f2cd151b780d5, 0x5c4f1866ad8286bb, 0x6942d9a0da502aeb, 0x2c30bc31f47fd0cd, 0x0cc8d3e75e970c94, 0x36d80f57e42d2ca8, 0xeba16c394c2d4d65, 0x3a7cdc0014462208, 0x3b12e901b9202da9, 0x0464e4aa70e4c8cd
+, 0x75201350de3c4f48, 0x009d25b8ecf08667, 0x5973178bf83c683e, 0x07bb9709568463c6, 0x949a98c45f467d50, 0x2cd3531b305485d9, 0xe2d0d1fcd865b693, 0x5385b087d94d793b, 0xb491eb3c4cdd8546, 0x7be38ca655884bde, 0xe7e3b7b9ef4d23ec, 0x427e0315321a7229
+, 0x55d42e4ce4a39206, 0x773684b239a9068a, 0xcd205102ca1313ca, 0x4bf445cb90555dc6, 0xd2fd0f072d5d2e76, 0x0ecc3d513d472a87, 0x9a59c240e73280df, 0x5b573c030999abb3, 0x1481b0c8affd2a06, 0x0fe3290d8dc61072, 0xd926d986eebf4198, 0x06652bbd1f07170e
+, 0x7312050078945d3a, 0x3fbc9e6093b2f041, 0x2253820236007db9, 0x7acb155f5b7fafb6, 0x4993d170e5cddb6a, 0x5d3f9af9d47e8b39, 0x30a85999bf69fe74, 0x0f3d0e50d78585c7, 0x8d50f2f8f510daa9, 0x665a8e09985ad0f2, 0x4ab9450a17a3fdcd, 0x795f0d65ae210cc7
+, 0x19ea4fdb13b06e14, 0x015f3e645c663075, 0xc400c9c215cc4694, 0x097d8387285055ba, 0x66360cfa9de44a43, 0x7daae7dcd15c58dc, 0x0301fc7f6cbda50e, 0x17c81f6dbbe02139, 0x73428bedc55453a5, 0x4c5b749c8faee44c, 0x8a3811f7b1a0ad41, 0x0f7c277953735382
+, 0xaaa4f4a24b222663, 0x32b919390496eaa2, 0x09c32bba60ceafc1, 0x2b9fd2f56d11e4aa, 0x67ac3aeae19c34eb, 0x0bce889664d281da, 0xbf997cffcb9dd1e8, 0x1c020f20745699a2, 0x13f4dc6a19830360, 0x3339e2d3f9eda85f, 0x85cb6027afb92f4a, 0x1339db18a3598d2d
+, 0xa6ab47d492b8f4d6, 0x0e8dccfc9d19ef36, 0x9619dbdc68d81b56, 0x14cb75a0fbae7b8f, 0x535d274d13ebec02, 0x502db3b390fef0bf, 0x54455b7334ce1b61, 0x7ef846c46241ed02, 0xaafe1271cc077eb5, 0x0045782f91e79d88, 0x730c914f26607232, 0x0aa415e214ff9b8d
+, 0x14cdf642e601c181, 0x0ff2934a3a1639a3, 0x400eab9671bb238c, 0x65e7f9a69a47ed82, 0x48d64106dbee1cff, 0x14e5a749f4bbcb99, 0xa94878e30b5202ad, 0x6406a975f3ba74e0, 0xa2f81a54577edeab, 0x4d2345feb33fdcd5, 0xe03d5a73cd400747, 0x7f9d7818e94ad229
+, 0xe61f5d37a57d45c5, 0x1495b6137763bf59, 0xdfbfee89943bc38c, 0x23c99a34f4192c4a, 0x7790c91c037c34b0, 0x604fc116fa9a60ed, 0xc2c293e845b71df9, 0x440cc7311c87b02b, 0xa3012bb97d2a5cca, 0x1251c842ffdf23d5, 0x7ca496baa1a8550c, 0x7e2186e0149f22eb
+, 0x766b313cc0e351d9, 0x543c5f43035d377b, 0xdac18032ef7e44ba, 0x7c97c222c0470e11, 0xf27f600229551da2, 0x6e4b93860c59acfc, 0xc40a564421ba5041, 0x102d35ef09654dc4, 0x668be12a1de24f94, 0x231bdf5c778e495a, 0xe3f1144a5783cd30, 0x37ba65589adb0616
+, 0x8358fd7ae46ad4c5, 0x13719ce6baea901a, 0x8b104bddeaddd23e, 0x5a715268ba982257, 0xfd7c536f5fd99a49, 0x00535a7f3ebceba8, 0x83696a686d7306fe, 0x218bd7680e26567d, 0x4ca73707f7c5ee06, 0x69e9a88f5f44061a, 0x31f9dc78656c652e, 0x1f4185612d006b6c
+, 0xf866b63a2c628027, 0x092c4bc2b3c423fd, 0xe990cc8c88fd1519, 0x7e49281e0b736c7e, 0x291fb83c70e04bb4, 0x272466ea44756010, 0x146927402eaa3dc3, 0x397801be33d7ef5e, 0x5101097ff9725033, 0x32d8500838c9b011, 0xb4bad729986369e0, 0x1baf6b240bc2ce77
+, 0x631b3adb1513e072, 0x14e5fa7fc52b69a3, 0x7fdd68654eaf6acc, 0x4903f161be45ee25, 0x3d5a24d3d76484cc, 0x41bfac2247cb2c26, 0xd6c041ed64240c2d, 0x34bcff6fbcade512, 0xd933012600a14c6d, 0x6b75aa05f6f9de6d, 0xd1dc3488a83ec049, 0x098033c3773b57ed
+, 0xe6bb9314bf9ad4da, 0x03e3bb39c1fc41e3, 0xeb8504c64cd670eb, 0x3ab86efa77039e4d, 0xcb3ff616f9ce9eef, 0x44101212901754a9, 0x25360568f6d0c46c, 0x1cb85dc5f1cc5b83, 0x9fe38aad4733c869, 0x7d6745e4e80b3b8e, 0xc008159467a81210, 0x4bb1c3e591aa641d
+, 0x52d19398f7a53f13, 0x22b37c0570862433, 0x021ba7025b892b24, 0x714a243b29db9987, 0xc6f06942a8cd3dd8, 0x76dd327cd88bca5a, 0xd898abc52a12ead6, 0x482ddc6581351ba5, 0xe0688d5b179b2415, 0x56f599434a1f3697, 0xf500055718277573, 0x14d9fc94d5629900
+, 0x374afeb0d0bc0346, 0x5f74877890a1cece, 0xf1e7f71ae7c0ce99, 0x1d7b67aef8dca60b, 0xe08ec5ac71fef43e, 0x4bf3fd08108b5399, 0xe3c6fe67f10425bf, 0x65ded02687b5fdba, 0x88d71133bafc3296, 0x42af2530f910e397, 0x37b70870b19a403d, 0x41aa78107fa97854
+, 0xdfa6c758f0323da6, 0x3b84f45f519e651e, 0x35326651f7f55e87, 0x61a96fa250654c51, 0x16e966e61597b979, 0x10724a4a70cabe48, 0x787bc89b1a55bbb4, 0x7d5c23e75ddfb423, 0x71586cccada11659, 0x3bae5ab87039ac32, 0xff1537694c36d3b3, 0x337ccf4490d3fbfe
+, 0x224877c9d68b7782, 0x60a19b50aac86b23, 0x63a3e66349819721, 0x1eca928c874de7bc, 0x5e423d6a48e3aecb, 0x708b65eefed1ac95, 0x4e576be38b93d8f9, 0x7ea7ebbf26d5673f, 0x7aa0471e3a65caf7, 0x629f4bbab834e62a, 0xd9090d5170c8fc6f, 0x3e7209cfee82409d
+, 0x13624ab761a0e724, 0x2b499276337c647c, 0xbb72204789993fb1, 0x39727920ac7c11d2, 0x8a018cde6c391f30, 0x5816fad5539cda37, 0x800c50af3741a1f7, 0x577e26955747cdd7, 0xd95214fefb809b45, 0x719fa4ad51f05f61, 0x78dab8393a6f3701, 0x0fba68fab52fae1b
+, 0xe131e6146a8d5511, 0x7600f5a486dcd4c6, 0x704eb217fb989172, 0x157aee96fcc29e6a, 0x86dea20d0ed46f83, 0x587e57a89d7a5df8, 0xece59412a84b5141, 0x612e1a5a5b31d65e, 0xd1c10773ce7601a0, 0x206da698e06a65aa, 0x2fb501e8e352c34d, 0x1269a37926da86e3
+, 0xfaf5037271adc7d6, 0x5331aff03fd5d208, 0x5067a5537e8a4e41, 0x59af910b35892593, 0x759e11ab6127cffd, 0x5331289ce3cbdef2, 0xca490fc79744ecbc, 0x09c1708bdb0370a7, 0x7f4d60ce7650a57c, 0x2014c1f5a2d90781, 0x2a4ba7a86b798ff0, 0x3c5750e6e2a53773
+, 0x2177703b8a9b2b31, 0x5fa464bf29c9e95f, 0x5da7d4c57ba2ab39, 0x55ae5736b5e1370f, 0xa665ac0d61defee3, 0x227023039108287f, 0xe7bf896b2dc6a07c, 0x2f0ad297c80ce4ca, 0x49b2e9f5fe40ccc6, 0x5c3de8086d0ac2fd, 0x5c589a792624e859, 0x4d392d0402b34d19
+, 0x13bfec515b1d3a46, 0x2c19a927c6e2c9d8, 0x2d852f161dc6f1f0, 0x2bb8f199b426e3c8, 0x94f8594eda56f82a, 0x256a2abe3fed92e7, 0xb17e75b720048c09, 0x4bd64c4a34a8e6f9, 0x644d8b2747a2c952, 0x25cb1bacb0c3d5dd, 0x6da957419d8a8d0e, 0x61698f71a5e6f1b9
+, 0x79e03610b17ce15a, 0x02dfbadef523519e, 0xf32e56c38bedc4de, 0x274fc1465604324c, 0x73ecfd9903e4ed05, 0x29ab1c6818baa147, 0x1517ea743ab9b7f1, 0x3ca40ff24db55bd7, 0x88612ed540229988, 0x48c6fc8558a530eb, 0x0a20e4a78a21fcc1, 0x64964342db355564
+, 0xc3c4f4f00201e97d, 0x4fc49a26c0f85d7e, 0xe71533b7ae5221c2, 0x14d63bb314901a5b, 0xe37df8aa6e7eae3b, 0x605c229d4923a643, 0x45a4712132168e3d, 0x107a5f726498db2d, 0x338a94a289b69325, 0x7f0997ebac520aee, 0x60091fa3e29edc3c, 0x173bd871dc121575
+, 0xf19e9da18646d49f, 0x2fb8589681d92817, 0x34ba764e7f152807, 0x672adbf5db7be538, 0xc3b8b3a9915a24f7, 0x5089a117ccdced46, 0x849e048544b510bf, 0x437debf95a101d5e, 0x9e2bb39db8e39d81, 0x52b2ec77a058b5ef, 0x5c437ec8e6404b9f, 0x27e11ddeb232a818
+, 0x22d19a673c071946, 0x1167e1ba9b12dea1, 0x6fc51747156544db, 0x253e5e0dffa1fb75, 0x31d84dbf98866bfd, 0x12c83d1c6d7f9fd1, 0x7aa1d566016dcbf2, 0x6669ed84a9e8ba5c, 0x530ad76a53b03026, 0x28b55d233880ef82, 0x27a2b6340fe22138, 0x22f7cb61c5d63121
+, 0xa42450361e9d7b73, 0x1c24a7bd40a8eec7, 0x346408f8925d0961, 0x2858047b3c572c59, 0xa579c7537d1d47f4, 0x66d60dd19392232e, 0x599cab0eae3b078f, 0x7b404cd5b0aa93ed, 0x068b8f6315784477, 0x4a3d3a5c20809563, 0x868a962cf0ca63a6, 0x7f40f422c586b04c
+, 0xae227960d5bf85df, 0x4c1666b6742f00d2, 0x42c328962d1f3311, 0x01e6b647bc4c33b1, 0xd267fff24f33b56a, 0x787f30b81c1fa846, 0x17da71eac22acc88, 0x5f9e5f1479170cc3, 0xde610f738b0e7faa, 0x3bf953726039f12e, 0x0c6beec5f0ed4469, 0x7adc4e36f681dc6e
+, 0x7bfe8926fd6ddaa2, 0x25637b03751fe9ac, 0xc1b3a2cd8a52651a, 0x0c065059f80e1665, 0xdd053ac1f8bd5012, 0x7c4a1297bf270464, 0xb0e4d31768ffb3c6, 0x1494f861ec9c5273, 0xbb3e18922dc4f262, 0x1be010e5ecf0fb60, 0x8159bec5cbca3502, 0x78f969faba2b0dc0
+, 0xe87eaabcec9ad261, 0x1d961eabb992058a, 0x90e2509e356a2a88, 0x298a0ffbe3bc2a84, 0x03b68e34f74eaefb, 0x4d2ddc47b3f17ed9, 0xbfe36f2db355e3c8, 0x0d426e434f8f5936, 0xff2d9bdfa3027e0d, 0x0d6c005475f67bfd, 0x34f5cf8698717f2a, 0x58fcd8b2838ed69f
+, 0x1f3d2925bbdfdac5, 0x77a7c5a5430cbeeb, 0x0d592b095b741552, 0x4dff0f67a527e5f2, 0x1e938bda9d497e84, 0x12aa5978a7e41a48, 0x8be5ed5e296610bb, 0x50d6d56776830128, 0xd9a365002bc24d9d, 0x15fdb3bfc660035b, 0xcf244ac2238b4b69, 0x6ff55de9265200a8
+, 0x61cc01cdc938655f, 0x662cd268ed50ff69, 0x4c57b10bba8de83d, 0x169d29baf89057e5, 0x6b874581a9f955f5, 0x2deefa2effbbdd30, 0x19a9f1b22b0c1cd6, 0x1a75d8a578621269, 0xbe53e7d45bcbe1f3, 0x63f8b13f89b54725, 0x57484e50aace1d65, 0x7003e7bef836c8de
+, 0xf9d480f39b13a6f9, 0x08d746a795db0f71, 0x0804e0d1202d37bf, 0x20d6a1b6415656b9, 0x66528f865d963d98, 0x58eba5bc180022ef, 0x044076fcdb2501c3, 0x2f132ef3da9e970c, 0x91bd6dd720e92fa1, 0x66181576ee2ef8c1, 0x26975ebdccc8cabc, 0x7f2dbc8e9b2370cf
+, 0xa6f775ea23051479, 0x396db0bf67d24db0, 0xee3ebf7f3c0d28b2, 0x75c1679df87d37e3, 0x9e6c22897be2d89d, 0x4b1a47fadf1876b2, 0x6e57d4db3588d935, 0x75b1d5d5bcdbf722, 0xbc1b0efecbaa7751, 0x1772126364e6620b, 0x7a69e6e08d546f99, 0x0bfbdff513f153fb
+, 0xd58e58175f77497a, 0x624d875b654fb73e, 0x631e1b1b7358cdb6, 0x146412b83dfc0f48, 0x8c186cbd20c53682, 0x7aa7775a9e39928b, 0x63eb4ee2215b481e, 0x46656093c0c5148e, 0x855c37dc7cae3757, 0x4b58ca8033a8959e, 0x282020166e509dd6, 0x4a2bdbd02761138d
+, 0xbcf9ee0f09483496, 0x0e7f49d70a00a63f, 0x410d3f6621160ffc, 0x75eb520e1711a1a4, 0x72d6ac74d39a4c95, 0x7044c2ca2a3727d5, 0x4a8cd7f57aeec6c7, 0x500f0380cf2ade97, 0x5345e3e262eaeb11, 0x71cf5ee84d402105, 0xbb240489e69d5c6f, 0x1f6f4b40aac8fba9
+, 0xace5181887800d32, 0x52379cface661e60, 0x4559ad8c15f33437, 0x5473bc15604b9364, 0xc75712a19e860636, 0x6debca5a40c332f5, 0x875c3c00649cfd0b, 0x02c19a0a065b08ad, 0x21ce21ac759dab89, 0x435bd600fd288005, 0x058ef954024e2c6d, 0x2b483a39f9261d60
+, 0x9f7cb88226bee676, 0x2484309979a03102, 0x07eec840dc9032d5, 0x1ba4b328baf5b86b, 0x2d26bbbf396bc9c4, 0x75a04dad24038fb9, 0xa1d3fab40ec33555, 0x7afc046ab674e804, 0xf6cbf4bc3e2201b3, 0x44790b60f5ea6bf3, 0xb9b2cbcd8ef0c81c, 0x0f38a8302719d817
+, 0x44b75e40a28f9a61, 0x2892685a9788b2f0, 0x660d93c0157f9366, 0x1c07349221ce746a, 0xf5c4f2b347c4fa19, 0x263134058c5d147b, 0x81b49bad1e32980b, 0x24a01403b6e56721, 0xa3aac84a8897b8ab, 0x1b02b1457601b33d, 0xac10f594ff710205, 0x4c088f747ac75bc5
+, 0x253a25438d5e24ca, 0x19f24cd9bd29a31a, 0x7337150a2180e099, 0x379f13f5c3997a33, 0x73a2a70bf57d9606, 0x5f75b54c645dee44, 0xbf9071a5401a24ed, 0x713135abe0576d4c, 0xa04a8e5dcb3caf85, 0x7c8297351bd13e9f, 0xdcb34f5785b956fc, 0x2ac6b7ca8579aa20
+, 0xf758905ba266777e, 0x42c0bff7ffbefa43, 0x29f0c57c66ba3569, 0x716fd77dad010697, 0x939f5aa5a16e9799, 0x1fdf8a2d62a5af2d, 0x249444138afcce1a, 0x50cb2ee72dacae85, 0xb1354ae567e781bf, 0x01fc300d67e935b1, 0xa7d3c59e91fd934b, 0x3662574131d6b84f
+, 0x4bf687669b84e6a9, 0x4b7fcddf1f1ec487, 0x9a6f55191f77f13f, 0x7b4a058703ee8552, 0x44b847b0fbeb448b, 0x1da83377904d5bbc, 0x03eaa230a39d043b, 0x1976cbdc59b4fb54, 0x5846070616957bf3, 0x79eff038faae1bdf, 0xbe40ae20d09d951a, 0x30aaa6d8aa1365aa
+, 0x0bdbec6127ac7a31, 0x55a630d857494160, 0x964c3cf66d53a7c8, 0x6f739874a709883f, 0x9bf6da92d45851db, 0x257f8268368dc66d, 0x1790cbc5fe6f0ddb, 0x359402445bf06137, 0xaf650110633ec610, 0x3ef0da9558d166c1, 0xef445e09f1bca2d6, 0x14943fe2a44ede2d
+, 0x85756b6d1f1488f2, 0x3f593c37282b4191, 0x0fbc1bffa5377dc9, 0x74effa44ee70e097, 0x7dcf4502ccf2e3a1, 0x2c2af808f3a6bf0e, 0x19e5174bb2ee68a1, 0x2b7f3486f46dcc27, 0xa90d869051ae54a6, 0x3536c5b0b877e702, 0x3403162cf5d609fb, 0x131e7e9632a2047e
+, 0x749f2b0a1d51b789, 0x36eb92f94dd4f622, 0xd24dd615c9bc9c98, 0x69c2e8aaac0a354b, 0x2ef7a200907ca6da, 0x792938a909257a75, 0x8dca0788a9efc04f, 0x61fa4eda7b406737, 0x7c64ed0a23e91fa6, 0x55fcbf102682041c, 0xba270c1007e5aeb7, 0x5c875433a097b958
+, 0x2603aefc6375120b, 0x105f3c566a48c09f, 0xddad526dfd227f97, 0x77a45f468d3d1357, 0xe1484ea124122098, 0x2d0a062bfcd46e60, 0xdb6ea8ca1053f0a1, 0x76c590ac3f96aaf0, 0xdf628607e73abc8b, 0x1d5fc1c304a70688, 0x72dd883ae6e01d0e, 0x60050d3ce301df04
+, 0x2d93f9517a290705, 0x107d003c2738b559, 0x9c7c1d37f47a4e44, 0x18a67c5489cd12c5, 0xf7e511592933539e, 0x3d99f0cb42d00473, 0xe5088c8a9fe0b04b, 0x4ab4aaf1b4cf5c20, 0xc9dc7eefa5a203cd, 0x2a75fd222e966ca8, 0xfc53478cdd120f4b, 0x7ff22cd996a230cb
+, 0xe178495eb000b588, 0x0bac90fac28eb04a, 0xdbb963042f4395db, 0x132fe831ed4f591a, 0xba07bb348b192a7b, 0x6fe075dd2c93bfc0, 0x81fa7a6267b6d59b, 0x0b7d0ce25d7dce50, 0x2dfdce7190bba1dd, 0x1b771048e9a41d9b, 0xc5c020c516b32178, 0x1229b03c5fd9d61a
+, 0x4312561540604cfa, 0x67b02b34904df404, 0x938b5ba724cae1ce, 0x1d9c1e50f854cd85, 0x30a89004189dfd6f, 0x622c788aa72700f7, 0x8b459b3865f4c5e1, 0x0a418f5bab166901, 0x7194ce0bfa465ced, 0x60d98ff26d7ff721, 0x82d6b93cf8aff675, 0x447aa30bb4ff3130
+, 0x7761c14145d82da3, 0x23a598b2d707625e, 0x37aa09478af6d353, 0x3c9237d2402e8c6c, 0x4fc9cfe31a582d55, 0x23911dae2b64aad3, 0xfbca6a7e6caae317, 0x38405706d94a2f36, 0x0ebeda36897ee4f7, 0x635479286ca228f7, 0x92598ed59c247322, 0x1ef11378777848e7
+, 0x102b16c6729216fc, 0x3874d59b30c78512, 0x2c9be7ab4857f7ae, 0x3872b50cd6b0a5c7, 0xd43d62aa6ce93ec0, 0x0a9f2738325ca897, 0xe4dc2d092067000b, 0x12defa11b91bcbba, 0xdbcdc80ada61b998, 0x7977da4bca21ba30, 0x89ab2ead24e17a99, 0x09e56470e6108c16
+, 0x0896931f804c0966, 0x0c54209a96dd3788, 0x27819484e95622d8, 0x53dc8a0dde2245b7, 0xfc4472ccf93b23af, 0x2a03120f04686279, 0x4b8994ab087aa84b, 0x0c7355026003449e, 0x7bd23cf7bd8ec157, 0x61fabea9ef0b00ad, 0x58563130d8618cbd, 0x2e229c1694ea8f1e
+, 0x961cdc4078f67ee8, 0x6cd63620d7e794fe, 0x84b9903a1e8ceba4, 0x69b64e4e728f222d, 0xcbf1a2118ad99976, 0x1e02a884b2a325dd, 0x6ed6df3e7c9c9057, 0x1c33fa5324118f18, 0x1742f5197ec185cf, 0x54a8b1398ef3b22d, 0xd07104f1b8752687, 0x191de1d899f73167
+, 0x973fe9f2cbe3b879, 0x02ace749eea302a6, 0x4cefe801e9b73a36, 0x6da9e0947ec80e0c, 0xc86571fce65ee2ec, 0x4c6716e51b3bcb88, 0xf5401434869fb940, 0x2bf1805e47a9357d, 0xfc1d7ddabcc21463, 0x55877486b6710880, 0x215f12d4f081ae78, 0x23159aca66c91e0e
+, 0xb51386973b727591, 0x3393a11603c275cc, 0x2ef45c332c15cff4, 0x265e24dba87b2b2c, 0x2440b7b64c5e7117, 0x601d1ec34809580a, 0xa973043329dd61f6, 0x03afc69ed6da9623, 0x407989dac6f4dc5b, 0x1d039952961f6162, 0xc5f3a5fe35820a99, 0x6fd88c5cd43a3616
+, 0x9eb81e44b4e1d437, 0x55c80115db76cae8, 0xd25cc63275fa8638, 0x366b49d78a8e9394, 0x5bea540d63ca82f1, 0x11f634b8e627a107, 0x7bfb392118ae3942, 0x45f78c7a520f6cbf, 0xe892deffdc15fcb7, 0x1e1544b265d51ac0, 0x36bcbb42212d0735, 0x6fb303141067c50f
+, 0x1dd1b24ba91d0fe9, 0x6a5d4e628c127dea, 0xb5885c6a00cc375f, 0x792318b0dc61f868, 0xbf24132e385abd7e, 0x7bd00339caa8ec4f, 0x294b6fcbb0116c8b, 0x6611ba22be3bad1e, 0xb6721325f549ab43, 0x5d7d6d8cdf393930, 0xcaf00009615853d5, 0x72448f0d2bbb2e7a
+, 0xb1e4bbf6776a4f8e, 0x2b1649960cab06e1, 0xf71fa651375f4b0c, 0x4033f4f0c2951449, 0x246a535903eae6c2, 0x0c069e9e37f92f71, 0x20b03176513b86c5, 0x7890a6786c09684c, 0x658ca8903dad92ff, 0x7b62a9d5e912f9e2, 0x6e79b43a1a3df65d, 0x358304969e85efe8
+, 0xeaebb394b3040ed8, 0x6bed001be0e39da4, 0x765ccf9906895867, 0x0b4985fbeef02bbd, 0x415c144a28f58531, 0x44e949f07e8aabc5, 0xd9b4ccc042547ff3, 0x2fc998d8f42bd602, 0xfd2e178578a72d3d, 0x2144a309a472604c, 0x675e8a982c374be8, 0x4ada32e5302a4076
+, 0x1bee8b2669e919cc, 0x7954f851485c28ab, 0xe3aa71445a620dc5, 0x3f99ee3b39965ea3, 0xdfc2a771ded8400e, 0x06288e764743cf72, 0xb8cae67f82a6edde, 0x49ccd95c9650d7df, 0x1343e09d2893e68f, 0x084894f97c0d3504, 0x713240055e5c6689, 0x564a5da76c4501cc
+, 0x8c7e96db7893ed70, 0x377bb5200b06bb05, 0x918192c1087efcf1, 0x43db3d3f29c27795, 0xb89ef6cb8119ec0f, 0x331286cedaabf818, 0xc30a657ebc9acf18, 0x474b91732fdaa270, 0xe6d2ba47872f7e96, 0x52c339aaee02893a, 0x598b59ba8c0cd07a, 0x62c4199704173e30
+, 0x8c5710960fa36cb4, 0x26883417736a9bfc, 0xb4c201fe85dd61b8, 0x7908603ded871279, 0x298a7115057b76f0, 0x18b906af2622f686, 0x785d5d8984d048f4, 0x5f98aec58ca82700, 0xda85016d0a28efbb, 0x6930c8f96f424534, 0xc200081da522ee57, 0x0ebda4fbc879a4c2
+, 0x0672f673187d8160, 0x2b4d61aedc1cf69a, 0x69aa5ccfdfe24aed, 0x41c22105d0809727, 0x9e8ef849d6ab7888, 0x673fa2a3a1c1000f, 0x29fcefec1edbc0f1, 0x641399eeb0932a2a, 0xaac0bd600b62db82, 0x3f580755e3c0d811, 0x5c8771fb87a25112, 0x50c489bc3218af89
+, 0x12c13fb5c4d551a1, 0x05fb87e4b1e9b36b, 0x9a1d7b581fc563a1, 0x53408b6166763253, 0x74ec871bd73a3144, 0x5f5242e304d924f6, 0xf7d2a20e80f97835, 0x4ccc4f68c4aeda9d, 0x68a4a3db6d6e79a2, 0x3e83ff72aa3ab7f0, 0x5e977a08c7655bb3, 0x5a24e920d7ac4558
+, 0xba01e530a2ef42d2, 0x011d1b762a7996e7, 0xb211c46b8f23540b, 0x1bc1eb1b31e2f411, 0xd3442ea8ed1a8d4e, 0x131998ff54545e96, 0xf2c49345d69f4af8, 0x06445babad514a8f, 0xd8bd46a9feec64ba, 0x0d084444c7728009, 0x56766ddc6f2e44f8, 0x1552fe486f2d0408
+, 0x7c49cb3074500193, 0x33228c0cb0613719, 0x3c66169664dd4b4c, 0x5f4cf0668cd4b5a4, 0x2ba952c732a93dfa, 0x7f4b5268730f14b9, 0x595fd71cfd3ae6af, 0x14c556ac268fec79, 0xbad81207510569be, 0x2a521948b4317b51, 0x18da56018246e2f1, 0x22e3058951693e53
+, 0xd120e6aa89125e18, 0x62929ce51234d074, 0xa57587940f79e0ad, 0x620bf0452753c887, 0x6a2cccd9af3bc7d8, 0x7bc72e48873f1f68, 0x30ad1439f13a3355, 0x76476b049e3fd34a, 0xef7e03262727267f, 0x5658cc92b1c3890e, 0x07c59f06efe22407, 0x629f55f7c41b030c
+, 0xbc751d8a6a93c79b, 0x3da6a77df930caf7, 0xe7ce535f6b0ee0d5, 0x2056e5fba63a05fb, 0x4a36cc8e83e5dde4, 0x77e4d6928d4d5bd0, 0x13a7ebfedb1aeea7, 0x413c057f297bf5c5, 0x97f50f2618c27976, 0x1f974bb1a020814d, 0x7029a7d7428566a6, 0x58f277db80bf6f30
+, 0xce9c39ff58618e79, 0x7ad8257aae09c938, 0xf044798fcdc421bd, 0x039a79b9b01aaf12, 0x9330fd35334c993a, 0x46f935bdd14b2f17, 0x2601be490cb95e6c, 0x625aacfa7dd73cc6, 0xc136f6284651842d, 0x2242823266c446b7, 0x7fd79cb494a50b64, 0x251d5e6a5a1badcc
+, 0xab721c61a2bfa732, 0x39216336dfdf2973, 0x534dfccd498c5ab4, 0x010553fa18ebc0b9, 0xc3a829dd975684b6, 0x13545cb3519254fe, 0x17d94d511b5ee7fd, 0x58f6bf6f94ae3b33, 0xf5a4e1249e3ba66b, 0x187335b8754b65e2, 0x274041e4c45bffe9, 0x71321b3ddf782ea3
+, 0x180dc5b2869d9f14, 0x2584597c12dd2437, 0xda8e5c84a64c2b3e, 0x08f07b90efd90ace, 0x3f593d92849883c7, 0x22aa586fdd356b88, 0x41760ac005853ba0, 0x436a6dc5c2a62282, 0x3afd79315f0026c7, 0x658a40f54fedabd1, 0x99b63cd585b2d75e, 0x2c481e4572224d85
+, 0x987a9a92dd8c674d, 0x57b811e89d40c246, 0x65bca5c8b3b74163, 0x404138ed9de37efa, 0x5d829bdfc079d13a, 0x7c902c924bb34531, 0xb9c4efda601a8b51, 0x3553e8954271d48e, 0xfc2ccd14901a0ed1, 0x172ee7f84e509760, 0x4698ac804c0a4650, 0x6e580f0b4330b6c6
+, 0x57514c0cd6e75771, 0x03b4b2f7257c9c1a, 0xafe092b2aa02971b, 0x49f43c987c990747, 0x7dd36980a454c471, 0x57d3af830c5e5329, 0xd72d27e796fc1111, 0x33eca6dbf202d947, 0xf7c634d8532d3700, 0x07314e30f8c782c4, 0xae74f204c199489b, 0x165804c082680efc
+, 0x1e2f0f6c1e206051, 0x500edd81e46d6ce4, 0x16b8065033c38e90, 0x44a97b5d2d70505f, 0xce32a7a44a9aa9b5, 0x716b9bf13438c2d7, 0x9af0d51f6b5e7c1b, 0x242eb3018f299c97, 0x951d74b51d3386ef, 0x1c8aeae4830d5cd9, 0x8381bac472c6ec67, 0x40830ca464fc093d
+, 0x10d17c8f00f14ed2, 0x3f26be6f236d64dd, 0xe3b9cd07e0a77345, 0x22e48cee73a013fb, 0x1103b4f0e5a4784b, 0x7457ee3fe265aaa5, 0x0dc4c231573e9751, 0x6b24472076db480b, 0x009852f6405f3521, 0x0440ad700c64074c, 0xce304fbc01898004, 0x0de9743609e8beaa
+, 0x7de43b0ef6cbf0de, 0x0212ae3534b65666, 0x8822819f3def09d2, 0x0a55293fc76389aa, 0xec19cb4d8f287c22, 0x6c98faa43c759405, 0x12cf7b2bb0676508, 0x19b914de14c30e3e, 0x6fc567bbf14b9e85, 0x5f30924f8505a609, 0x6ea61757354f6355, 0x3f7f4cd736eef24a
+, 0x10ae014de62c5113, 0x6e81fe4897c4a340, 0xb28968a9bbbf4d56, 0x4a8e5643235d14fb, 0x423eeae66539f716, 0x0cca400612cc3d6b, 0xe70ba485d438b537, 0x6b7ce706dbbdf9ff, 0x1f534f2658e320fd, 0x33ac3adc055787a6, 0xf9e564e79fa72ce0, 0x69e77737f2705e24
+, 0xf50f6502295acb88, 0x473352bdbe6798b2, 0x5d836253a23885eb, 0x06cd6a6bb6ffc414, 0x8a79170e279a09da, 0x26a542da0dca2a73, 0x1842447859c91ef6, 0x41ac696dbe7022f1, 0x5b1018b0eeff0c27, 0x5acca946026e8c2c, 0x283f841f948e881f, 0x01fbe679c980367b
+, 0x1a0432afe2114d2f, 0x1c1a990e3a18f7d8, 0x85550eb233cd1c0b, 0x6f406e23e8a1c256, 0xe98f17202bac2363, 0x511d0a882594dd64, 0xfafe72729d3e7e97, 0x6ecfab693ea76fd2, 0xba4caca9b251c170, 0x05199cacdc999e50, 0x6fc5ac46a0352d23, 0x3ef465115260736e
+, 0x27a56e9e6e844e6e, 0x1a9f2b47ade95502, 0x1b3bda54f5de6156, 0x720982995a641423, 0x2f193e2f3e82c27f, 0x453af99bc47a25c0, 0x004bd24656ddbaa1, 0x3701b0afe385c6ac, 0xcd5371d6b335a534, 0x6c3b1b45e3c49f35, 0x6f0aadc487ad0c1e, 0x76d4854f1ab88d58
+, 0x2568efbb5d1df950, 0x49e5cbf0a931ff9b, 0xb56e61fe8d3d0e3f, 0x33ede06f10fcab92, 0x2dd083dfff962879, 0x6f9e66c7dda543a5, 0x14046aaedf6e6436, 0x098c9b9367f49051, 0xd6b4c0a8c1a75a8c, 0x373f6fa9a0fd061d, 0xc1762fbbacb94fd2, 0x4df33a66fc155a15
+, 0x36698c2b55c262bc, 0x5c6ebd3adc0342fe, 0xe62a745cbce0e0f1, 0x2fdc01127f1174b2, 0x9bd8bdf47a7ef19b, 0x45430acee1995771, 0xb631ca8ad3c2a69e, 0x4e0e33da16882be0, 0x4089d5afc3d76d97, 0x1e793db838ce7638, 0x79dde5c114656a93, 0x18812eeee5ca6356
+, 0xe804d9525fee9c56, 0x3238b9997fbff6e4, 0x1b12fe7514119303, 0x2258bfb03e9198c0, 0x2be82edf30c2c6dd, 0x7576f19cc3427e92, 0xb0626ad0dc003d7d, 0x7c6e6675e5e4b435, 0xedd484a87dd0a51e, 0x3f1bb6ba949a1302, 0xbed7f0cbdace0fab, 0x4affcdbebfe1f5f7
+, 0xa75b29924dc63226, 0x3c4f2849ee256fa1, 0xddc3258fac0f340f, 0x75e3eb707f490a9d, 0x2a061733c10ba473, 0x7f456a4b2c8f461c, 0xadc5f521e9526207, 0x4438d0d6a92b48e6, 0x66387d35fc0abeb5, 0x136fde144c9da038, 0x832dcb50b6fc6ffd, 0x684a55a5a6ac2ea5
+, 0x0fba40df0df5ba4d, 0x56239c4804bb880d, 0x80bb5506834a2a8e, 0x5c7fafbc29fae1e5, 0xc688c7426fa011ff, 0x19fd7d00832147e3, 0xad89e0087caeec7c, 0x5065f42cca494a6b, 0x18fd455b38660f73, 0x00f326c30e9cfd28, 0x66d6baa16422919f, 0x5d542858fbbfb154
+, 0x85283a7ab95ae3dc, 0x01a03f8c2badc73f, 0x8b3e9b8c0aa83268, 0x6596d636bc53e006, 0x8faa68d253eb96d9, 0x35ac60f75a61182c, 0x7441e24b3d00aa09, 0x3bdcae5dbd469372, 0x07d951ac0f68948b, 0x585858c6d469a5f0, 0x0ec069a9de74d3df, 0x210f514a806ae618
+, 0x749c79d958799a6f, 0x0d3b7b42c9c9ee27, 0xe32569734134c82e, 0x77b7215d5e7c2319, 0xbff263b4b438056c, 0x019263578a1120f8, 0xa6e5bb0d0bd7b2ad, 0x044e9e432bffc624, 0x8774ecaeda96efdc, 0x7a01ba739aff05ca, 0xad2f83cc029b0ddc, 0x56ce38b6ca132e8c
+, 0x8f809382287a2bc6, 0x22cc21bfaf484110, 0x56bc26bc18843915, 0x46ff2eecb88c8f28, 0xc4c2da5f314aea01, 0x35fc6d421580abd9, 0xf7e6b2522afc4bc0, 0x249f53eccfe338f5, 0x3ac1213988b596f5, 0x1c29ffe5ce1fc629, 0x21ee4296aedd9f13, 0x09d65cc6a4503328
+, 0x86f9f5dfe3470c07, 0x5dfbc08e6c5bc783, 0xca89137465ef7a8c, 0x7ae713461cf76cef, 0x698c015649c1942f, 0x2b3ee4bd698da127, 0xf0ef34ba5317b819, 0x457d09d01ecb4052, 0xb82826d3c1e29300, 0x1ce303bdf4695a0b, 0xc3b4dec4e2a76aff, 0x224e4647e713d165
+, 0xbcb63b71f0384de2, 0x10920661394ad93c, 0x0cbce53dcd3bc861, 0x31b1058cb8cedc22, 0x990758e13ba389c9, 0x58bae6cb00dfaa1d, 0x4c2ed5427ed8c41c, 0x5d14c5e9300d9dc4, 0xbadab1c1480830ed, 0x68cee861cebc68a0, 0xed7a9fc41f02ba7a, 0x2068c537d433611a
+, 0xe24c20a730327c87, 0x0cf0745b75d3d5a6, 0x76ca567cd5156b2a, 0x0bbe9122486ab4ab, 0x2bd092b75d389da1, 0x5212799b732fe85d, 0xaa663e8b8467afbe, 0x3a6233ca0425c443, 0xa7a4a7dd961c736d, 0x3668a6f36573f586, 0x48b278c3b142f50b, 0x28e28c7f00169355
+, 0x088dfe05bce83df8, 0x5c3ae4d964749938, 0x5d05e96e8bafa117, 0x31d000980b312d3b, 0x8e691f7324c1f782, 0x49305dff3e76bb4e, 0x3ccc751236938bd8, 0x37b56edc20315074, 0x059843394eeb4f47, 0x10924ed82b0d6263, 0x67e3a622ea266439, 0x43e337b0fbdc0925
+, 0x4d55994e1ae892f8, 0x55ee3936d7c93864, 0xd390ff092c27c514, 0x1f9d80518cd95d43, 0x0f131fa0db01c82e, 0x26e1c1a91f05486c, 0xd48b1139e2714fe7, 0x126781b90c188f5f, 0xeb2d8b7c1161e28f, 0x1613d8e5ed960da7, 0xb5dd0e2ecb57f39b, 0x69bab8e977b8f5ab
+, 0x0b61d311021fd015, 0x1e003302746492c1, 0x46dc0f56200fe21c, 0x1cade3a1dc1430b5, 0x40afce3c28ca5b5f, 0x0839b9d11c1555e5, 0x36df9949b644bbf2, 0x1b7bc0f355dd7a83, 0xf139316dffec711e, 0x564ce83b3a6d5227, 0x0368acbdbade5f76, 0x6d47923811e3dabe
+, 0x3b1dd5f3c2860c9e, 0x5e5e0af67a8d6e7a, 0x2c1683d17fb71560, 0x6046cf53f1602f33, 0xd582415201d706c8, 0x63d08db43cfb52f2, 0xc8d242d1b1ea5fe2, 0x54fff1effdbdc204, 0x7f007f18e732dd8c, 0x729d56b7008b92cf, 0xe330be2408eede35, 0x2c7745344e8ed35a
+, 0xfe4f7a29c239eb42, 0x7ce189a2d437cd04, 0xd668c01a8fac5226, 0x3c46a8afbc4b9138, 0x76970d1f337db900, 0x7ccaf8ab655e0f2f, 0x8b3286c304ef0e4b, 0x3d1107e9498e8b2b, 0xf70a66e6026c85eb, 0x175ee0e4e8c9065a, 0xf7cb75cb27989ffe, 0x4065e36280f865e7
+, 0x76f6a9b1d3b67982, 0x77f283bccbe9a5dd, 0x9390741a34d7236a, 0x4882c0bdb660fed8, 0x8213645112d1f41a, 0x6fb8c6cb5b490665, 0xc9b8a4919a91b503, 0x627dde1f36789a0b, 0xf1a7b23256655942, 0x2e259172f2821ee2, 0xe5a81ffd082fa65e, 0x0a6794e371082f35
+, 0xf9ac6589013caff9, 0x38f6d990c684317a, 0x9cdc971a08b3e2a2, 0x40ff0bc10595ce19, 0x08f7ab5e653b8091, 0x0fec2c04f964a005, 0x4d128f296803b59a, 0x1ceaa7b53483cb13, 0x465ae56fd669ede2, 0x5ad9024603e2bd59, 0xb8e598042e91c481, 0x7c9c360e00e12268
+, 0x29925d3967f75b44, 0x52260d54880142ab, 0x159edf28d517dc67, 0x624796cf08bdd611, 0x70bd6674f73880d9, 0x576c6e58191e9a7b, 0x54bf37d58891cdea, 0x5f8e7a1bc803d579, 0x51743d0cf1e991f8, 0x447ffeabcc281558, 0xae0b4e4a40bb40c8, 0x62063e83d5d9b173
+, 0xf33b574b96895e80, 0x682ed86ffd95eaf0, 0x112610b490fa27d7, 0x289ffedc32747d74, 0xe54f1a1b2151d641, 0x37a4b90a0d4d5ce2, 0x80cf0d24e594d281, 0x7a253141961ab198, 0xc0177b4c911f3975, 0x7d92dd957b8b7463, 0xd2899395c223c8cf, 0x7f7cec190ba30073
+, 0xa8955c4cca515625, 0x38cf18ba96482039, 0xa0ac7b34d3c006bb, 0x2ba51c2c841c31f4, 0x3207a9a40188154f, 0x6e09f2a1f4dd0eb3, 0x4d00045e09f6a9c2, 0x603dd97e6f2eb970, 0x0f81395e2118dd28, 0x52eba55194e8820a, 0xe8c76e1fb11c248f, 0x1b5fb1b15dd94228
+, 0x0708b89658941b54, 0x4ddb27889b619aea, 0xf151a8f787812eec, 0x494c192765f824b4, 0xec55ff435dbf569a, 0x509108a921e06dd1, 0x2c9cea8ff0a24428, 0x2751bef250c7aac9, 0x5af11a21d7e201a3, 0x71da6b45d5a387bd, 0x868c3f697ac8b37d, 0x49512e47fd1cd677
+, 0x20e5e1db394b0957, 0x49fabac63b121bbb, 0x72260388cc81fc93, 0x6600a311ba8c5c79, 0xe79ca8f9d369a346, 0x036216d7c583c64f, 0x2d68d83e577f695d, 0x5dd3695066a55bc4, 0xc1c1282eaa88c727, 0x5ecc32bcdd69dba8, 0x0521fa885f00926a, 0x4ac4d28872c4a4f0
+, 0x28530ca37aeac503, 0x501b5052e48b4bd1, 0xa98bc3f1378ee0a2, 0x19c815584534a281, 0xe3d48d2384267f73, 0x5aff526f576c3999, 0x491492fc2161c3b1, 0x669a7425662a1482, 0xbfa8d5d9526d5537, 0x03751fd39b75b1d1, 0x88d91562247aa169, 0x3ec1e73fee8b0d51
+, 0xd0347742bae7b080, 0x248faffb66c9f8c0, 0x9f92f1ba8591fff6, 0x1b998abf51bdf2eb, 0xd97a61bcbca77c59, 0x7e01c45fb38697f5, 0x406a23d10c3e4dbf, 0x7284d1aeaef18cc7, 0x54d21ebdcba7aa32, 0x757376a42443d0fd, 0xd8cd050ca8c83a8d, 0x3d0280f506a189fd
+, 0x5f9fca15a4f8eef8, 0x4bd3205e85b4e346, 0xc640221833ef2d76, 0x5b0e7b1178d84c1d, 0xb7d346c5da1ce032, 0x64f1c60c09f3d787, 0xcf38631a29a3ac20, 0x24e84a7ceb989a4a, 0xe3283163dea2cd25, 0x47048726eab89f19, 0x88ef78a24289b6ac, 0x6aeb3727e21229fa
+, 0x3e57d383fac3ddef, 0x17c2d8449b5ffe9a, 0xcdbc1e6ae451df3b, 0x12a4a569037937b7, 0xc616a5e39d708d46, 0x1f0b68051ae9d8e7, 0x2a8ca001ba05e822, 0x697cb6efe808561f, 0x09480f1a4ae9fa27, 0x4e37ef706e2986bb, 0x9d5a145fafc164a5, 0x1840b26b38d826cc
+, 0x6099380ec6f15a36, 0x064a2976633a3e51, 0x5f2d891d75a53bd6, 0x4d9fa452e5607073, 0x27b331817d08e86d, 0x1f0a300cac9ad3a8, 0xeea414f248fb7a29, 0x381126735678f424, 0xe3ef6ccb409f645b, 0x26d308fecb6b7db7, 0x980c5edbcebace4a, 0x0b6e5823ec816551
+, 0x51eccfe2e04e7876, 0x1e482ba9d08a1879, 0xf0db944c17790b6c, 0x3bb4776e45a28c51, 0x819ff26c0c7b0c3e, 0x201362cd611da14f, 0x05c4838dcda1e8ba, 0x6b764bb9cbffe4ed, 0xea53f00e21aedeef, 0x37929648944d1850, 0xd393a94fafa7eb47, 0x140cf59c77096e26
+, 0xa09f5dc57ded9220, 0x19512e95ba692083, 0xa9e2ad9cc8816df6, 0x5747c3baad2a9dba, 0x0b04e606a4997f3d, 0x6872d18d5f9ce6ef, 0xcd3d99186acaf5de, 0x61a77839a70de867, 0x2872472c5adb6d06, 0x150de4a36e56796a, 0xcbd8f250741d4f10, 0x09665526de70419d
+, 0xcaea1b8fe2a973d0, 0x5243056c2ad2ce15, 0x24c65ae4759ded87, 0x312942449d089024, 0x12b192c65ec050a9, 0x3b8177e1d5ba6153, 0x9a69ceaaac26de39, 0x687c21e6a72aed3b, 0x0b405d7c1e2ff91d, 0x2c996f7aa9157c9c, 0xc0e1825d9e79c78b, 0x2ecc07516e1273c0
+, 0x52523e7214d7d920, 0x09d0b7f0ffeaf28d, 0x3a0f5a407f3a6c24, 0x194c88e1925982af, 0x2bc4d318b5adb72d, 0x43964c193f36fa5b, 0x74a3c67b83b05be6, 0x145d1cb0ba76d144, 0x93d51900fa9579ed, 0x3170a776f159b658, 0xe90f52b71f32dcc1, 0x2cf576aca569376d
+, 0xb183838122283108, 0x6a497b00696d2934, 0x401915090bf1d034, 0x7d3ded25dd5f53a8, 0x4140e572f7b22454, 0x3541534ee545449e, 0xa6433e381ff37ed7, 0x064ccca0115b4d36, 0xad175b9aea75052d, 0x63af57a05a28e12a, 0x847a2735858c0849, 0x3ec8914dc4414f95
+, 0xe6ac181175023136, 0x7e19921541663a62, 0xe8ab08d3f75eab7a, 0x1b9bff1e96c1b1a3, 0x9cd0f9e99ac79d0b, 0x2b97a863fce03aa9, 0x35d6aa6e242e4e9a, 0x7474bdcf271e883c, 0x4ae61f4543aa8a29, 0x381031adf7606418, 0x782064e02cdef84e, 0x5cd0cecb1d292a03
+, 0x39010a0760d7809b, 0x1827ba77245936f8, 0x0e6d4f4a40af2087, 0x6a2ce9bc9a37ad81, 0x0b61a6b13938bf09, 0x768b41613a36ef15, 0x882e359f53380d77, 0x54acc2c2b47d8ec8, 0x2cc24e0b4573ddbb, 0x5e1dfac14c47b18a, 0xfd89886f695e11ed, 0x1f545decff5e0469
+, 0xd38caf8efba0ebb0, 0x40c2295d5a82281b, 0x1fdaaff757e24be1, 0x5c810289eaa6d71f, 0x7bc81bdceefb9fc9, 0x01b90e7d00206a0a, 0xca3d4acfc35f0190, 0x66ea1a6852cf9818, 0x619a488e8e4a4b48, 0x6d309674eca96d8b, 0x026cd88ed99fe32d, 0x606727317dbf1644
+, 0x394ca020a3da47a0, 0x117d0ac9bbb44ae2, 0xc282acad27e1e1c8, 0x7fad759b906e3309, 0x00fe8a088a8dca8f, 0x455ab5ed0aaf0d86, 0x8a97745150c2c8f9, 0x642ce2c3fb648d2e, 0xa830bdf93b35c4d5, 0x1fb22f7613f7d1a6, 0x17fb4ca20b42e938, 0x1b6f37d8e20ecfa9
+, 0x9bd81289d8d849c3, 0x59149c9a39046c6a, 0x27513a51ee307e55, 0x419d55db0b5188ae, 0xcab599062d511ece, 0x1b42493a0fd1c1dc, 0xcd14df3cbf04fb10, 0x4d1c48b2c43e72f7, 0x03548d1182d9a5fe, 0x5bbb8ec31a362d5a, 0xc842d604ed9f593d, 0x340481db59e816c8
+, 0x908be835b31a5f5d, 0x647141cd4ba38223, 0x47b487bb8c7df71d, 0x4464961dbbdedf13, 0xb6f418afa5e098f4, 0x337011aaea39fa90, 0xe7670b58de415b99, 0x5de816eebf3027f7, 0xa94aa120a5552909, 0x5b2207960be8609f, 0x48d723145d5bca60, 0x7c87db92ef5dfe0d
+, 0x79d63dc9b5d99c0a, 0x3b82277977612ae9, 0x56927c3fcb54d9d2, 0x3a8c39ba45e69c7d, 0x982c1b7110f55013, 0x183eae58faef9bd8, 0x3d95f99dfe7e5533, 0x65be8a6a1712c191, 0x935cd9ea1958fa6a, 0x55b77a51696d1f66, 0x19ff31656748336b, 0x649efcbf2aba190c
+, 0xed06cb26392ace49, 0x236cf2f3b9ef2b1b, 0xa3df4fb14e7a290a, 0x7b6e14619170459e, 0xae3ffdf3b98e0cc0, 0x6b78aff0dc27b24c, 0x1d16a1251e113c6f, 0x12124655cb019684, 0xb4fe01a8326abf13, 0x41dd3c577b94ebe6, 0x6520544cd8b5cd93, 0x26e4ffbf10ec4a0a
+, 0x4f2677bb02c742cf, 0x7aada172c191f065, 0xa58eac693b9ae107, 0x72e12e3ee1546aab, 0x33b2da2a26916efa, 0x7a4364aaed789127, 0xc6766e176c7dbace, 0x297bfc0716c68429, 0xf4deebcb330bce6e, 0x10ee2bf89309f093, 0xd5daa6796d0697ec, 0x17db69fa997f12da
+, 0x40f087c30f924f1e, 0x5d5ad5c4f64b54d6, 0x67cb6d72e6e363b6, 0x297c362238696f07, 0xbd8e8b1bdf843b64, 0x0d0927caa34e7fd9, 0xbca2b7a81e35589a, 0x22a2ca3e53f419b1, 0x60cb1af37bec21a4, 0x334a05340cf8b18f, 0xb2d288869f5795dd, 0x37fb0fea63172ed6
+, 0x240c75dc1b1b443d, 0x6fad09b5b31540c1, 0x9ca90465c2feb712, 0x69b1ca5b46789c3c, 0x30a42bc10b11f97f, 0x2d420ea7f8218953, 0x919239b1a3339f37, 0x4c4965ce9a26ef6c, 0x6752c56f78ae6139, 0x385c86e3d0f91f6f, 0x9deb66d8fa6d4af7, 0x1b5e6729d52c2e19
+, 0xfc2addbfa318d45c, 0x5a3bb1e9c0e7e874, 0xc032c439253d68b6, 0x0a41f22b5fe82129, 0x1212c30c6496ddce, 0x12b7f7d9e29ebf12, 0x1afaf128ee8cce4f, 0x75cd0830d8b54ca2, 0x9a5cc26cedaee3b1, 0x03a81180f81cc5fc, 0xd450a3aec54aeaec, 0x119699e01ea3562a
+, 0x28a41efce30a3445, 0x3be83002752809a6, 0x943b6411db69a4b6, 0x421da0672c409623, 0x55ab9d55872827a0, 0x5d7b407a8221f2dc, 0xa927629ba25bc5bc, 0x50ae3d22d9e9628a, 0xcf6232c53f772163, 0x238c78640aeac5f5, 0xc0945a8efde54413, 0x05764cd021232a79
+, 0x45573ed63d34a7fb, 0x3442f92a696fcca9, 0xe54dbc5b4b0cd152, 0x1e2b584334c37532, 0x0e58998ee4db6934, 0x2b199fa0762343e7, 0x21258cc212e7eda7, 0x17bdfe4cac75a178, 0xf5c32e61be873d08, 0x6f508fd096fb79dc, 0x2b7996a5f4b93ec8, 0x6dfbb58549340d83
+, 0x2efd5cd7d7e8b222, 0x66e51c3a71485089, 0xe6a58badb8186ad8, 0x4b6c6f3bb459be49, 0xc0ce1b2a5a8ba069, 0x5c7e34dc07b0c408, 0x9dd708d453220c08, 0x0b90cd47e60b17df, 0xa306d5e7f805e3b9, 0x1b019d702d4e82d8, 0x08a6d33d43fbb069, 0x46b2ee0c55b4778c
+, 0x35fa94f1f37af7fd, 0x2b59f5fa83f1ba53, 0xdc1615dce9411628, 0x09d976fa148d9c2e, 0xc73a5333e811a561, 0x4c9a7a54d16574c8, 0xbe79afe9910bc347, 0x458503f958006675, 0x6f2e5fd2d8eea040, 0x47eac738162aced7, 0x951f0c8b0b9dee4e, 0x072f01b0ad77f12a
+, 0xa56c57787d266a14, 0x1f3dc04f30b0f46b, 0xa1ec75f25f034ea5, 0x5b961a949f1f0e80, 0x444a6fd4ced54024, 0x7185302292f9b397, 0x58e846c8277a2708, 0x3e3dc15bf57dae62, 0xf8d6fdd6f4a826ea, 0x7158eb69ee75d977, 0xe6840eb4075c1bb0, 0x3b4d661d46b6e9c1
+, 0x37391d36ba6a504c, 0x2ca52dfed8ee8f74, 0x70aabc6aa8ff5127, 0x29012f2c1a1e6790, 0x29d422cc8bff7ccb, 0x612d2f346dc793dc, 0xa174d667d62f1461, 0x1e3780d82a32755a, 0xf2dc1c3c4805bb31, 0x7e916325619cb663, 0x12d1f4a5632c520c, 0x780426c3f03e444a
+, 0xa1000c4054c6ca47, 0x69480e6b1956e1b5, 0x90ced3008861072b, 0x17031dfd0c06f45a, 0xe08845613abc3ac1, 0x578b9d4b9cf53899, 0x6e2925d88c932eed, 0x27f94338ff9ba3cd, 0xd85a11e1e9a34847, 0x337f3bac434a233b, 0x38898d8800ab4b55, 0x7c2bb9d2e8c963c3
+, 0x63796d159cd0719a, 0x2aa8ab387557c6c3, 0x9c936ced68a13da5, 0x716550ae7ab2e1f5, 0xe0ee4f2068f1b536, 0x36d459682fbd5ea0, 0xd8b0c71fbd0f1781, 0x5ad4e4ce1e49a60c, 0x506e517caaca1640, 0x601f2dd158641d1e, 0x495f3b886434be92, 0x09ab0b0af3f38309
+, 0x5d91dc28df357db4, 0x27eec32f9d40cd8d, 0x720e600842010347, 0x231c5140fa10513d, 0x19740fee51f7a08f, 0x460846b863f75c08, 0x85c8d7f0e089ca5a, 0x6e93bbd2b85a9483, 0x8ced06bfae42ee54, 0x66f7178e88b1690a, 0xddec384614a7a2d4, 0x0806312b6bcc6704
+, 0xc6d7235d6b8ba08f, 0x6062e8ddfe43ba00, 0x5031a4bd38d350a9, 0x719823c4a04ec870, 0x6482567b1806d7f1, 0x2bb8a4be0a6ac2cf, 0xad1cc7e347d1ba7a, 0x0f127d44a0ff333a, 0x8b2553d3c709416d, 0x6a8b5cfc481c6ab0, 0x09f99d1b1b68b91d, 0x7cb64936ebd0e005
+, 0xa94cada972edf94a, 0x1e3b00e13c2aee93, 0x58fdc286b64963d5, 0x1cb356f1511a9966, 0xd3bbff56a833f5b1, 0x4bb02adcc447efbf, 0xcbde7112c3634a55, 0x515b1464a7193a61, 0xf0a91632d8d72e57, 0x2c3d70a0f7e1b7b4, 0xae9613a097e609ed, 0x7d595b76a16f799b
+, 0x4fff5398edf93782, 0x15abaa508a6ed3a7, 0x617dac9e8edf7a48, 0x39bba10fd201f897, 0xa81b9c9d9e911891, 0x70bfb7e0be72c2c0, 0x6f53d4701968449b, 0x2504f0127c8f651b, 0x708f47bc484ea27a, 0x090e4aa671341bde, 0x0f1a8e7e21da19fc, 0x30d4636a12b5687e
+, 0xf3182bdd32145924, 0x27c2b2f96349996d, 0x8b230d6006518afa, 0x4bc1dfa2b98af27e, 0x27ac78a3e0ac62b7, 0x5724c97a39e3c32a, 0xba96a3273d24f114, 0x763182c45e1c2719, 0x8b08173a91ed525a, 0x255079a464933b31, 0x46fe2aff8e20cc20, 0x456e8a78f56aa675
+, 0x01d1fbfe4457e7da, 0x6e6393e5b734e729, 0x5b0eb9da5ee10523, 0x49b4953250112d8b, 0x4fd41490e1a95e13, 0x246c819cdfdf2bf9, 0x6ba3e0e4d556b736, 0x32a5a731a6ed8b08, 0xcf03a08a31a4c537, 0x65be03ff0162efe0, 0xb4e55829521eb8fe, 0x5aab98903510256b
+, 0x8a6b8c72889a51fa, 0x51103b7485ed0318, 0x67655bdf75659013, 0x67162ebe35005ff6, 0xe6aae9b62f2a1dc1, 0x43f9cb3792fab1a5, 0x989a398967641621, 0x1fd917180451deb7, 0x113215bbd931cc18, 0x619624747b797d0e, 0x9a8a541f2f1b4b0e, 0x7e9de0cba14cba22
+, 0x930b5f52a9504569, 0x674ff30e369ab6fa, 0x00c5733808a3994a, 0x76842a0435dbea20, 0x27186c79c5196616, 0x4c2a978e221f00cf, 0x5d047dbdc7b4733a, 0x2e7e184714fb6f7a, 0xbfc17c7aeeff525f, 0x42fd011a62658ff5, 0x553469b80d2512ca, 0x207451208bac75fb
+, 0xaa1559a8a6900204, 0x481a6a1a558a7918, 0x76964a9f5b915028, 0x1a989f7235ebed3b, 0xf6b3e493cd0dc8ef, 0x5c222c9776df53be, 0xa9503a9f24dde55b, 0x15d04c30ac387def, 0xb0c9c36fed07c4d7, 0x1dce31c0799ed3a5, 0xa0727e2081276363, 0x5dfaf269911755a6
+, 0x2fbe71663f9c5396, 0x198d2d419333e050, 0xa4a114f36cb04539, 0x1c371e2f7dc20f00, 0xb567ebf2047e5708, 0x661dc654c22e0316, 0xa60b7b5602cbb6bf, 0x33b1bae0adbdc368, 0x2cd795246a8e5e07, 0x1e79a05a64cda3e6, 0x3db8650240bd2bfd, 0x490dd9ec89cf1215
+, 0xd1f5f805c4d37e7f, 0x54531751254fab68, 0xb5580f3a3b6ae115, 0x12ed517d05c8e975, 0x03425653d44bdffe, 0x01ed59d4b5b1f855, 0xbcd23fbacd56d808, 0x3e6a75eb284f294e, 0xf7dddbbd93adb2e3, 0x58bf4ecc9c184082, 0x8c1115e657a361af, 0x1d3b3cc6ebd62567
+, 0xebcbe7f9fa05777d, 0x54c56b5e715f33e7, 0xeaf19bbd13a5964b, 0x1377c5e9e6c6d54d, 0xdd8f90aa8d2c9a07, 0x0ff1f6598b2d0d78, 0x3b319e82f8ff2500, 0x74dc4a17ab612500, 0xb2b1a04e4b9f8bea, 0x4ce528b14e0d68ce, 0xeb70f72e517162ca, 0x2b9d0f1ca4607963
+, 0x5092b0f762faf9bd, 0x2df3e6729403f4ef, 0x894c586fd349006e, 0x3a9596898880d495, 0x8dd06957e19ea076, 0x49c49bdf0f70eceb, 0x42cabe75407e3e68, 0x4b2507f280690987, 0x7d1058ee271d8137, 0x29d6ed126a7a1380, 0x07e514056cc90ddd, 0x78e0346513716077
+, 0xf0f06b22892d13dd, 0x352da3682ed7cc09, 0xe3867ff40e42d40f, 0x7fbf8abfdbc9f06e, 0x9d36f981aa9e2a75, 0x64856484e7f0a103, 0x383faed1dccd3176, 0x4499260cbda05d10, 0x8cfbf83e8ea87d75, 0x79b2de4ccf319940, 0x48d9f041ef455630, 0x5baff32a924dcb68
+, 0x9a39cce9758dbe35, 0x7365800fdf0e6a6a, 0x667c261e9abf0283, 0x088030d4d21a2afb, 0xcc39c154b7738287, 0x2f6d7146df90a0cc, 0x527c03d27acfbb6a, 0x56f97e52353d91c9, 0x32b51e85db82da8a, 0x0e1c5696217b8e02, 0x05b5ccca923a348b, 0x3a84915dd61fd3b7
+, 0x53b02c1f2f83b348, 0x7aa52011219ed18a, 0xae6408e7305a8ded, 0x09d3a86c5d418c9c, 0x49f3023a64162664, 0x453cb3aec481077f, 0xbd3c2a654056d417, 0x21d44305aa3659de, 0x65eac83de420051c, 0x7cace504e8d95d65, 0x252bb93e8f2f8e77, 0x63c1c48aed0e9faa
+, 0xe870eb39dce992d3, 0x53145c0f62b5e14d, 0x947ac07a994a64dd, 0x35c74d7c35465b91, 0xf55e5d4cb1240861, 0x1da71a2830baf8e6, 0x74f2062f8e76d926, 0x7adfc52d63610335, 0x8f16c21b4812632a, 0x303dd3f4d5d38f1a, 0x51138ecfaa5b2441, 0x59b8607b89a8455f
+, 0xc927e406d0f71905, 0x3f9a48bcbd22b632, 0xc0ea80df8c737fd0, 0x6e73e356e84a35ec, 0x8998cb571651d084, 0x261bee732090d5a5, 0x38626249fd5719e3, 0x799490c9be3fbe3b, 0x7a0a027e8a72f1f2, 0x35ae663a2f9c3b2c, 0x2a44e0f10fc1a865, 0x0536ae9113c3cbdd
+, 0xe0f24e31225c6e0c, 0x1ec3a2fd7d2d8c09, 0x99a36c22a39d0d68, 0x0e4bb775df4e2de4, 0x93a13f3fa7ecb3e1, 0x6f4bf0dee3cfe64e, 0x79da0a8a838ceb56, 0x4a48fdfb44774dff, 0x447346569350ea63, 0x10d1024e4f02873d, 0xa9359878d0660c6f, 0x1e9006193637addd
+, 0xf3400ffaff3f77c5, 0x5638c0cb388a4d95, 0x2aac55efbdb0f836, 0x211350aea891527c, 0x879de19cbf997a12, 0x06eaec9d7606f23f, 0xd314a14c78dafa66, 0x0824e8ff1c4fc255, 0x193ae3d5c229ecde, 0x34c5b79047972e1f, 0x88278c736c6473c0, 0x2ace6e6b5a2dab9f
+, 0x315127084e614ef5, 0x11cb7acf791bd391, 0xc877a9dec5befbe8, 0x7f52b5b91e851243, 0x887345711f50b0fc, 0x20c051fb15b676f0, 0x7d12a790f50b803b, 0x6bfc94d9751f1add, 0x179e1f4b6122eb9d, 0x3da0867f72284ed3, 0x7bc1a08bf7635fbf, 0x6c75b0dfc027207c
+, 0xb2d1d0dd1c25829a, 0x1e2e43156cf9dff1, 0x720928f5662d100a, 0x7d71521de3a9a833, 0x25bad94964d19df0, 0x1589679da2fa1287, 0xfbeca739ccd7b128, 0x1be439f6a35909de, 0xa6e2a646f86a3207, 0x4b0fbf46ddfa9978, 0x417579ea944cac2d, 0x0ca8f7b993369f4c
+, 0xee6c7425d220ffa5, 0x703eea0eb54eba75, 0x0be90a069adfa1a4, 0x329e5ac3bd9a319c, 0x3f98f06856dc7a1c, 0x614855e73c3e11b4, 0xb90a76261913bf15, 0x152cc23626948d00, 0xef1574a8b2b604c2, 0x781fbb8d191d654a, 0x655692abe648aa06, 0x22abed3438b095ce
+, 0xa89edae7eb01f823, 0x737a7438cd292c9f, 0x4b285bd6da85defa, 0x27f43c102d8db8e8, 0xf072fa8d751738ac, 0x3d60bc1cf876af62, 0x055078b9d4a4a556, 0x7526536c552fef83, 0x835b938a06c9ea31, 0x05dbe3a61f4e2c7c, 0xeb7c521b52c56942, 0x76173229ef665c91
+, 0x3d180cbcddda2846, 0x3606e91ae0383565, 0x52c59a680150d22a, 0x351819154540adab, 0x4fee706a11c4e6ca, 0x2906a83aaf852c95, 0xee98c5f4b0785b17, 0x0fbcfed7fe3e9265, 0x8c58e9d94fa15708, 0x306dfe7074820de8, 0xfc9032b03c452f8f, 0x5e929b465417f2c0
+, 0x59a23efd3b7bc134, 0x16adc3c2aca1d251, 0x4e743c85ff4cb28d, 0x727624868fb6fb77, 0x8dc90260bcc2fa94, 0x0439bfdbf7225757, 0xadba88ff946b710f, 0x45c9e75a52a0c753, 0xd7eb6ed4409adfb3, 0x290166c2abccc846, 0xdcb07270bd515610, 0x61fce63f3622eaef
+, 0xa66e17d461b5fec1, 0x3676ab9f1fbfa0ba, 0xe4c7284a7bddf5a3, 0x3b19bc6cd89aa8e6, 0xae1e4466b549014a, 0x314267b18ac7c5ff, 0x5ff10d1089d8cc90, 0x700a949b56b51f6f, 0xb4298f655c54c9a7, 0x726167dbe6fe7a49, 0xee643803108c7c1b, 0x30eaf5b56a152455
+, 0x9218beed5f708261, 0x75367503fb77ad45, 0x157ceb257894cf1c, 0x1f522a65b06ed6f0, 0x899b15785f8c4c2b, 0x692a9f9df7d87077, 0x67d57fed1acd52cf, 0x7376c7b954d16431, 0x30eb89835a367a2d, 0x2d6488780662b422, 0x6a1dbd8f7b887059, 0x15c1f109a90074d0
+, 0x590cf7714a404ac7, 0x57614384b5d05487, 0xa6fbe9a2f9e48303, 0x715c4c2d404f3f16, 0x68567a516336b170, 0x7e5dd9bc9c5c6e6f, 0x174522d13f06f8f8, 0x4d23ed82251019c3, 0x5a94369a3e1d0ab3, 0x7d67f4343016b253, 0x2c83b411b98dc6cc, 0x7e918e3af69290f8
+, 0x8bb4c8ff6fb8fd62, 0x63a061b6eb5de6b6, 0x4631f6089e6223c6, 0x71dc427c482d8314, 0x809951c210b72325, 0x75567ddedc4018e4, 0x476d748ea3c4bf5b, 0x06f88498f9c1bb78, 0x5ac18a8ecc984c76, 0x52a4eee08d2533d1, 0xacb4098c84f4ad4d, 0x113697808d136a19
+, 0x1580e6b4069231ea, 0x1c178ca4e6e4f79a, 0x466d96f4df7071b9, 0x7426a4382dd1dc01, 0xf56e95d6506b82d2, 0x619be07d5842cca6, 0xbee52849d5d84d63, 0x7dd6129168c66988, 0x638198196e259023, 0x6e0099f531eb5113, 0x256c5f708412cb09, 0x61b7380c5fd1c145
+, 0x709c8c19024bc2fb, 0x4bbe56e6928c90be, 0x7bbbcd6785bea8b0, 0x210d502139fa04a4, 0x87e968338492af5c, 0x6d68dcb700427ead, 0x833388e6af0948bc, 0x6272e9223e5fa1d5, 0x6f9eea7042bb4286, 0x4348b3e7dcc20ffc, 0x5d2052027088acf8, 0x68af8f28b05d37a5
+, 0xcef21aeec6ae6f9d, 0x31a9180c820fed1d, 0x4101989d662d036e, 0x326057d22b172a03, 0x4248b86e9b200ee3, 0x105fde0bb9d671e7, 0x291a1eea824a1807, 0x0d7f11ba7f2efbff, 0xe18e5db31ff18d55, 0x38c3097700fe4822, 0x47db50564e640f50, 0x5e275f952cad3bc9
+, 0x564237474980203e, 0x36dd21ab97a85ece, 0x63069362a506b68b, 0x1c2f6be56ee1ced4, 0xdb436497db1b580a, 0x3053c09418d219d3, 0x7c536e259d03a439, 0x7b255fbe144d1866, 0xbb331243d83806af, 0x163241ac0113d394, 0xfcd14690aa096d01, 0x647e21d6b21ff4e7
+, 0x35338cfb0514641f, 0x3547de042fdb7b1c, 0x96ebbcbb97dd9f57, 0x0b0b1dc9d73cb5d8, 0xfbb8e3657fbf1dd6, 0x6a516afa5c8c51d6, 0xa23d776de8158604, 0x36f71e947cab088a, 0xb5ab55caff8ea9ca, 0x57d828176eef5d3d, 0x0ca9fee55f326e9e, 0x31c566ed042df22d
+, 0xd12db6be1eb1bd3c, 0x2b07d2ab876db644, 0x24e67f34b481798b, 0x2dd71dd94557f1be, 0x9c8a9eb376a3fd82, 0x7d9723613886cc5e, 0x874a23720fd55cc1, 0x52b4e7e0df5bc522, 0x71630519e0edcbae, 0x19d32d068292b15c, 0xf9301bb4576c86b8, 0x172010cbfe928af6
+, 0xc018680bb9bd7347, 0x0b6927945a224942, 0x17ff945e9ac4803e, 0x31828d8fe4c049b3, 0xde32b37f329c25d0, 0x6ba97d21687d0c6c, 0x5d3988653bc01a9e, 0x3423a05da18646bd, 0x41e6e6a7ee590f8f, 0x3cee5a5d5512a380, 0xd83a3067c7bb0771, 0x126e6b5597abf001
+, 0x8aacc428d58a8020, 0x0ec9b44c3a9b27ae, 0x3135411f1c0683c9, 0x59f1020b528d3287, 0x75751dafedf76fcd, 0x69c8aa5c8fa07fa7, 0xad006584b6bcaf46, 0x48311a6e8c5eb4d9, 0x0755c86cd49abbd0, 0x6c82057a38f69048, 0x52eabf5f93cec006, 0x57035c8cccf63881
+, 0xeb8e4d2afccef1b8, 0x2e6b33b84e1466c4, 0x0aa7e76aa1ae754d, 0x3b61f08e1aa8d03c, 0xa9cccd9899b77a38, 0x15e2ca1c422c291c, 0x1c75dfe93cfaf578, 0x799a50d6b98515f4, 0x0c8027636f2f229f, 0x2c4a459b71403600, 0x66cf3c4f3f53b1ff, 0x7d0174ee25ef29d7
+, 0x72ba6d0f3a4d671e, 0x15cb1d4114d43113, 0x358f5017d6660f10, 0x1c811baa83b864c8, 0xb5387682e96a8912, 0x2bb3fac26a36b906, 0x45d7cf3e6d86e164, 0x395414e8a9b0ee69, 0xcb5e41b4135411da, 0x44c3aece6286cbe9, 0xc88d697cdd8bb080, 0x091a9c7bcef439cf
+, 0xee8b0864c5453606, 0x0a5ef2e98993ee80, 0xd71ce063ac4a1f02, 0x7602d72d5cdf1ed0, 0x6ea192e8e6d0d0eb, 0x2dfc46c4188bf0bd, 0xbe12e52c2ee80413, 0x3dad0b2c67db4ef5, 0xe33e09a695025355, 0x58aa6e94e14da76a, 0x6bdb979e7d20c94a, 0x238e50d44386f51c
+, 0xea5fe65e1e3632f9, 0x7db53e6e70d70e39, 0x3673e332507572a6, 0x35387611d961e8f5, 0x27f34753335560fc, 0x7d0f1e0def47e1e0, 0x23d4e1351794aebd, 0x1d41e2f529f40b68, 0xec378d884b5dcad3, 0x255cc0ab4100de8c, 0x5abba52030f38854, 0x397d3fc66992c474
+, 0x40811953f8457ea3, 0x147035dad2cd3733, 0x87f2f963c5e8d7f1, 0x22060ba17f2bac6a, 0x1df39cfb3c2a8d00, 0x394b6e5596c98be8, 0x04098c7b02731fea, 0x755a284d5aa6aa07, 0x9d3c8f971df465fb, 0x3a683766fb69e6e1, 0x9bc82941851f61c0, 0x6f196441b5284e47
+, 0xbfe31d13c192cb95, 0x69f1c166d486a07d, 0x1c45cc35bcae29d0, 0x6466d29f6b341a9f, 0x4e8a0025f9a26aa9, 0x3a0e1479610ae4b2, 0x607512482888b4f8, 0x1042a4d3109d61f7, 0x60fc51c63f8eddda, 0x039d1463c7dc60f7, 0xa0ebd511a71c0853, 0x45c0b297ccdb0e8f
+, 0x3929e07fc09eb6eb, 0x69dbc61f47ff1d02, 0x752720117005846e, 0x476563036bb08645, 0xa65443e4904f71ff, 0x48b2737197f1ee72, 0x6c5968fbd30c0d11, 0x2edf1785e1603ab5, 0x6ef7b2863e4e7c6b, 0x7ef7cd687da3e10b, 0x58c1b3faccf96c06, 0x691aa9f13367fe2f
+, 0x7faa6998471230ba, 0x2d8c6570a150601d, 0x0862c0b0b9c8d93c, 0x2d80caded3518f9b, 0xe789a30880ed30ea, 0x67f1b0b05464b5bf, 0xaeeb5d3afda62841, 0x6d4a6bfe87b0da13, 0x3ac8a632440a5f2a, 0x4caa931c5e93097d, 0xd7dfb885f3d9631f, 0x448fc9922e8d0635
+, 0x281bc8cb38e49995, 0x73559b996ed4b0a9, 0xd44e55fd534dff41, 0x4cba3d5c4361d933, 0x0722bb7c00dba5e0, 0x4000424d19f7aaf4, 0x9b7cc9d717208cbd, 0x6468f4b397067fea, 0xad4be4d499ca11fd, 0x5e2adeb360a6fcdc, 0x0e9bca3f486e9801, 0x5a31912a17f3810d
+, 0x2498d5f0db49e49b, 0x0107f8a2a92f5006, 0x2c1c81f989d9a08a, 0x6d0f5f6e4705182a, 0x77f8a23ea4834303, 0x5fbda39037ee8376, 0xb2d2688cabce0d52, 0x3664973b1772fd18, 0x18309109fb6b9d07, 0x6e7aa2f26383f4c4, 0xb13c04487294548f, 0x543060171ff60e2c
+, 0x3f14d3b7b92ed263, 0x467808d9d73c1e61, 0xd3e22b4972bfc36c, 0x28be9da8796ea442, 0x838902de5b800e07, 0x56ae581e4d636e53, 0xe731944149562924, 0x3576a2912157914c, 0xf8bd5dba15aad6bb, 0x157236f40f063d07, 0xf9da3a323b6f2e3f, 0x0173cb1bdcfa3823
+, 0x37a4d8bc1715c733, 0x6b5d3743c6e05b4d, 0xb2a4a4b340c6d6dc, 0x0679194d2ad08f6f, 0x23c8c320e8828617, 0x313abb2cc30bff82, 0x1af9d4ccb2dcfa13, 0x07fc4fa8678ac536, 0x4802edb852246df9, 0x678d51508474494a, 0xc0fd4f08a5f4d6c0, 0x5b2be4555c3ad3d5
+, 0x623fb105c0b04a28, 0x7817aaa770afdae7, 0x3e0408e7cc4b6735, 0x522f2c9cb14a3a42, 0x97c44f8a69a1692d, 0x7ffcedf60d3ef56b, 0x257433f6d19cb951, 0x6c7bf3153395b3ef, 0xc1a922f81cd70169, 0x4662ac45d57f2dd2, 0x69c0959ec86085d0, 0x026b02d004354a78
+, 0xe4e4e6bb5d5227b8, 0x5a1f7a7a3e3695c3, 0xf5bddf21375eba73, 0x20e61d8441452e14, 0x041a60741cd09f12, 0x13db9bb3d5c35473, 0x2c5e678c7bdf13e1, 0x0ea14cb7001e47c2, 0xef9cca678a32d88c, 0x42b358b13f6a07eb, 0x68920519e2fe341a, 0x3381d808a2a25c99
+, 0xc48bdd0d1b2a04a0, 0x484fbb9e75dfa696, 0xfde539a841dc357f, 0x4833b4853c2f31eb, 0x7fd0178468ee903b, 0x0c33a4e06a77b4fc, 0xb3a7f5ef780ca57d, 0x52f68cf3c32331e9, 0xce238edaee163f5b, 0x7e76abcd8c848ce3, 0x305f9d3bcdee9337, 0x07600af917606a3a
+, 0x66eaf8e8ba2be30a, 0x2733bf38bb3ff683, 0xd85f085ec5bdb217, 0x49d12671e58c2ad4, 0x10cd0f175e377a86, 0x23de0f6360f3955c, 0xc19aa19a2a796f2c, 0x0aa3595d4c9641ab, 0x56575cdd363efd8c, 0x49393e81fc082aac, 0x7eb0681125e90659, 0x50c557293e27c850
+, 0x6100e39b040ac558, 0x52f43157f36d79d0, 0x5a0e04e693f8f39e, 0x54d8b1126f0f0296, 0x4fd7530569de5d87, 0x609f8be598cf045d, 0x17634c743799d0b8, 0x10db8a7c69110331, 0x7271cd8499eae373, 0x5322c916c3fa68a7, 0x8f27c66959ecbac9, 0x10f499acecc888e4
+, 0x607ddef3c9d2ef14, 0x3310c6157ff543ea, 0x567c3f649d340ee4, 0x1a47869014125b91, 0xe3615b317d78ae82, 0x57a2cdcafdb020f1, 0xcdd4be310687418f, 0x151928be2db5ae67, 0xa5b0968b20be7a6b, 0x5c0aa1b1bc27e711, 0xd8252ee7f6122424, 0x4feb18d81187a4fc
+, 0x5cbd4f93f00c8834, 0x5eb4913fea3716e8, 0x78adf29647969405, 0x07d5fc924088365c, 0xaa83f20c993eab89, 0x6c884ba1303d1ed8, 0x92160c60be9ac5fc, 0x3a8e5950084c23ab, 0xf9665e3f02287d4e, 0x25f58937cba696a0, 0x67393b84c2728be5, 0x37b00a39d853084a
+, 0x1b5f902878bb0dd1, 0x62a8d81105f8d170, 0xf980db10f7cc44fd, 0x03e13099d795c7c8, 0x4f06c53355350eab, 0x49fd21635f7fe0c4, 0x7f2c5b1e4d7ce4a7, 0x1bf957079561db5d, 0x580771b5f9b30312, 0x5d38a83462c93c79, 0xb72399c33b87a18b, 0x6fb55c2ebf0f3f95
+, 0xb1cf5278e5047f83, 0x370a043086161065, 0x86517931f3de7e61, 0x3eda1f67cb257038, 0x735b88957e041db7, 0x09e72a2ff3901923, 0x0031b570652b206b, 0x2b5268af17e4e28f, 0xed33597c4a2083b3, 0x34e6ad733cf41637, 0x014a35e2d4852691, 0x651a0539fb6ecd1d
+, 0x1195aea390de56da, 0x63b851263aa8aa9d, 0x9cd0708e4831c8d4, 0x48b0be21c4a05eb3, 0xfdc685d09a773b9d, 0x68ab42b36ce6fc5c, 0x6c3f1d0f91b7b36f, 0x3f5a37457fd3d17b, 0xf1e738e12495a1f0, 0x4c08149f921ffcb5, 0x839879af884eb06f, 0x77ddf9744e62973a
+, 0x0c2d0210088ec391, 0x02dda72833e7a55c, 0x2538e9ea64552522, 0x7fe7202aee75f0e8, 0x59e1ec042f27f9e9, 0x12c70bfa497264ba, 0x6b6aa9ff8d9738ec, 0x49998dd32f5ba310, 0xec28667f6324561c, 0x6145b6280a050283, 0x16deeb461ca2e0ff, 0x6a03b152892b2109
+, 0x7db692e75c89c723, 0x0e74678837eb5214, 0x4290ef4acb24eb42, 0x05588c456611cec1, 0xb948a2a0086901cb, 0x3c3d79a759c7121a, 0xa244f1052b9b9574, 0x2d52aff400c4f3f5, 0x9e8d042c42a36288, 0x73a38165b7e998c0, 0xc71df308624f2a15, 0x175946a92b7da16a
+, 0xa63574722c4e0227, 0x0f557c68fda1cd5f, 0xa84de499ba8922c6, 0x103fe58f24eb6400, 0x79521eb55e7b3e3b, 0x5765b463ce555e50, 0xde94f8d181742cd3, 0x30bd98363eb469fe, 0x594e0a5814653040, 0x46b26d217ac98972, 0x0c32286119724171, 0x014ac54bfe366759
+, 0x99c498e65ddf09f8, 0x58f427c2ae426736, 0x962cb242fbff0ffa, 0x44438902016601a7, 0x69b9c0b61fba4d3a, 0x5e24c37863ec4bc0, 0x1aa1d8744244994f, 0x2d6e344482e3aa33, 0x1a8476b5dfb8e1d7, 0x55531a2c4432ad73, 0x5c92f0f1e24979c9, 0x4e18b8a8554fffdc
+, 0x7f0ebaa508ef310d, 0x79bb5d46f3947b71, 0x8535b30d88b1cd70, 0x15e63b3dc2c1f7ec, 0x3c7d04e8da86e06f, 0x7cf6cc4b143555c5, 0x75df3d6aef19259e, 0x6b78603355e2d2ce, 0x0e7f887440ac5ea9, 0x28e29980a3f9d6b9, 0x357bc0e22366b625, 0x501ad6cc7a01cd1b
+, 0x420ce381354f11a3, 0x2f07b23521c55c25, 0x0f5f0738961f8f24, 0x1ec3514786b8e5bf, 0x8714d01841b5a78f, 0x018f6a48b59ff7c5, 0xa5facf41ac2277be, 0x11040ef9214426ce, 0x49af37fdd0b07b1e, 0x6ad1a16c4ae48ad8, 0x30e3af00301f6e24, 0x0def9751304811e3
+, 0xbdbcefa3409b15b1, 0x5a8b1446d6296dd0, 0xe0bb22e8acf11975, 0x3d9ec3babd3bdccb, 0xba17822e86695fd7, 0x370dea68d5368219, 0xb738462483d68e75, 0x01d390f0179db73f, 0xcab56f60d9269283, 0x2a7fad888110f7b3, 0xbc3fa8a01b1e9abf, 0x3cee296338a3a400
+, 0xe55758a79db1486d, 0x20fe46c09c945ac0, 0x9597e64a92015f39, 0x49441c83bb24e5b4, 0xaa40b68cef110397, 0x2e003534b7cf4ea0, 0x9b3b1fb8ac6b30f4, 0x6917307e366d1f9c, 0x5e8a34c9d856a4ae, 0x51c4530ae71999b1, 0x72a5713b4a27d828, 0x7e3e0afa381a7657
+, 0x12f233958704b895, 0x590bc030a389c4c8, 0x94db51ab882ed55b, 0x18bcd732bc5e0535, 0xd30725d44e68d9e3, 0x38918a955e5531f3, 0xcee3a600de7f3b44, 0x188d08fa049b3055, 0x0295ae4b27739015, 0x07f651ac7934d302, 0x0258d32014f1bd0b, 0x39f5b002044cf9f6
+, 0x6e11bd28de728169, 0x0b973821888633d6, 0x02f8e83f47375b03, 0x555e2d5a64d0c500, 0xb6aaf22051b2a06a, 0x19aee3f12cfff862, 0xd4f7b3e48d444b8e, 0x0d45a9799fd31086, 0x1619a7d359634e0e, 0x70cc9dce38f6cd64, 0x27b944acf9feeae8, 0x11e75a854cf9b3c1
+, 0x359a6947c35f8f72, 0x095d5b9acee6b358, 0x41cd080aff4061b5, 0x2ba4e76d8d98ee45, 0x4dd9eff2ddc83290, 0x4fefe81487e0edc1, 0x584a75eded4275b4, 0x6f2083552ca54cd7, 0x01fa7cb2484b9d86, 0x3acc61815d984b5e, 0x2031380a8ecc20a5, 0x211e4a85f87e066e
+, 0xc3d4566697e58bb3, 0x22eb4c24bd7b5988, 0x4075eb7358fc7e82, 0x11a57de2730341dd, 0x3e27e04b544bba4b, 0x576af4c5ba22797d, 0x64dd991dec97f6d2, 0x046b2d2d6b464f33, 0x83637c2afe27366a, 0x5d79313e9034cd77, 0x4e78ca987a01f8bb, 0x2ccb37013571e093
+, 0x812247d11d53bc4d, 0x6802e7273acb751d, 0x2c0c808f6f3d55bd, 0x1ebc08c0b798e8ea, 0x1175e3e743351fe3, 0x06c2156f840d97a7, 0x553b778186433ff7, 0x402c29fc97867f4a, 0x23548aa3b68165b6, 0x3f8f9835c8f56048, 0x6c2f1562b1d80c57, 0x19dd0e1a4f6b3a2b
+, 0xf552bd84bdbd2a08, 0x060cb039e58b5be0, 0x5888721d5b4f9dd6, 0x4da99c7f520408a2, 0xd46f8b5f12ee85af, 0x05b2593b7da9843e, 0x83523eacb6e7d055, 0x74ad04cd657b41d2, 0x02cf7110867e68f6, 0x2bc5e67814b0a696, 0xd5cea6969aaa26a0, 0x5c227074e3f2cd45
+, 0xe18b9dbcfebe42e8, 0x24291159ba3c1840, 0xe39a855d6db0eabc, 0x14f290e447d0d775, 0xd4b49008b1a44b1b, 0x14a1ee7673f79f04, 0xacffd94f5c6b6168, 0x2403d0cc0f3f8113, 0xa285ce0e21a944de, 0x2587f5c0c57a5299, 0xff8b0c8dabafd229, 0x4410a247a8b03282
+, 0xb822eb75caab3468, 0x5f7323db4dcde7f8, 0xbf967f6dd4ffe02b, 0x664d3f2fc6920818, 0x648efaaf8cb1da73, 0x7fa562d4813e7706, 0x63d5c7710906f1e1, 0x77502a9723aaebd4, 0x96dd07e4d0f0ee19, 0x6f350c2eb58da33c, 0xb036684f00720a6a, 0x3c6cc64ebd2901d6
+, 0x24dcb57c051e81c2, 0x09dd89fae29720a5, 0xb88a3a83e3af396b, 0x341d8750a726ff01, 0x22976ffe853e334f, 0x78d54a5138d36a5c, 0x1528601402aea05a, 0x360e0112d1c561e6, 0xf8ac8ee9288c16ce, 0x44689d088af688c6, 0xcbac85576c311318, 0x56f46d1d8e359085
+, 0xa7251b1324645dd5, 0x0058175c4243ed41, 0xd7119da5d554a978, 0x542c2843cb1aa490, 0x5b345d3d5a7d59f6, 0x67d431464953bf7f, 0x8ad4a5dc10d44dac, 0x53b4e380236aec1f, 0x50894254f0c4b6ef, 0x469786778e10d444, 0xa6bc767e6745708a, 0x6321171746c8fe5a
+, 0x888223c65ea3d26b, 0x342a45034f816af1, 0x83df0eeca7d9136b, 0x055e323950ccfd9f, 0xa4a3c185f08a7e68, 0x71470e3080d1f862, 0x084ece5ff1e87199, 0x31b3debced9a6a08, 0x04acf642a98943fd, 0x47381ca04678eb37, 0x95af4e795303e02f, 0x3ca875e3e3e8be1d
+, 0xa399446c1457a520, 0x139640a3e08ab7c6, 0x9dfc84a72f20a698, 0x4e6852df58d836e4, 0x5d3984cf6f1f8d34, 0x625d9592504a0800, 0x48350dd0d80deb68, 0x0c7acb0ef2d790b6, 0x3ba6bd622c5a26bc, 0x34f3deec6be67ac4, 0x8f5be593addb198f, 0x027b8cf2c1486853
+, 0x67bdb73a96894f75, 0x4fe9b94262e56cdc, 0xf34d006513e5a290, 0x56745b2f75761688, 0x8267ce1f2713bae2, 0x3b1099eedd3ecb5f, 0x2f85623b0860d306, 0x4dc6d9dec45a6175, 0x1f768267ae52ed6a, 0x1da0d71a928beab0, 0x503bbd4b08c3f925, 0x5f09cdc89a629ee8
+, 0xc60b847189462fe3, 0x4a305bb323f3c910, 0x44d9fd95b558edfa, 0x743e446e657390bd, 0xaaa209c0c993b1b0, 0x07ddd8c16563a93b, 0x7c27a0762d518ba9, 0x7bb61986fa441345, 0x128d54f1d24535ca, 0x27244845a14b8fc5, 0x80bca39037ff1b65, 0x161e694312e46a52
+, 0x70125244347499ab, 0x1180fb26b299cc57, 0x0a732eaa931a7c1d, 0x12dbdba016d47d13, 0x0968fa368563c27f, 0x48b8d7a89d0cd15a, 0xad64da8b61da7bbb, 0x1c659f3cf7922084, 0x3958ed72a7d627b6, 0x7e608b60e0849123, 0x150b2421a6c4487b, 0x0d3b2efce0b20dcc
+, 0x5af9ae1d6ddb7819, 0x7d3a4a4897803ff8, 0x70ef89fef5efb0bc, 0x63fc3b4ee6074929, 0x95df0ab744858e2e, 0x60086bb3ff4cf4c0, 0xc4ea217780ecc14b, 0x4c9e355488c830ca, 0x53be204632da4c08, 0x5833f1196320eaf0, 0x0f04960d4b281b9d, 0x0ab410b93be45295
+, 0x1d125fa2d1843996, 0x2d073905b18d2d04, 0x60847b2ce647bbd6, 0x6c60f2e4e8cc8fea, 0xd0e6599bbbf67131, 0x13ad04474a848307, 0x84b221a0429050f5, 0x35c2d1df484120db, 0xab39fd3b18a093e7, 0x6c3a80f64aea7a48, 0x230932c5f7c31373, 0x3657cd8269208c43
+, 0xc60ff43f0a43845f, 0x7cada4ada99bcf62, 0x733ce7b12117c6db, 0x1b095a413fdae848, 0xce615253fb4ab203, 0x27c15bd4a5acd0f0, 0x4d0a7a6f99de8021, 0x3ef0a3c50281f0aa, 0xdeeb09ad5f30b250, 0x68d500b58de8ad92, 0xfc70e232eba2553f, 0x2cd663df0889f32d
+, 0xd80629328bb13c8e, 0x1282fcfddc613c48, 0x9fd8dca6c75cf81c, 0x7a72586f99039ab2, 0x72471268a6aece07, 0x459a47e620418fcf, 0xfe0949af766b428a, 0x37445ed01a15b1d1, 0x6a437adf1d94f7c0, 0x1b47ee2ccb19c3c3, 0xda5723d28e317c8f, 0x6cf00679b8f9f4ca
+, 0x820db62487958b52, 0x560f0636e5c5f08b, 0xaf02a62f08bf3098, 0x3b598e55b9a5667c, 0xac2566fc6ebd51b9, 0x30e42d2874b317a3, 0x603452490040fe45, 0x65725c60d43613b2, 0x0b3585ec837db06a, 0x1acc3f2ddb6bb2f3, 0x050e49ab5dd6d327, 0x0050a9dfe5089298
+, 0x6c896274db621227, 0x4bdf44c354e9e67f, 0x07e5ee2a218feb44, 0x2675c897bdfa77f5, 0x1670dd7bb1abae75, 0x3509c415b2b903f9, 0x1380223695ee2ebe, 0x5687c020d6fdd7ec, 0x20f07cbd6bab45f0, 0x2c751d6c4ea20a47, 0x50c113f7621abb3a, 0x2193da810e4c59be
+, 0x469c94daf1ea311f, 0x3cae954acd668c76, 0x10a9528dec7788fb, 0x17282174485d30bd, 0x969595921e08fdbc, 0x757f1403bc234cc6, 0xc5ce056e8d8ef477, 0x7b629742b57eb298, 0x3dd69009c2b1cc13, 0x09e801de5da82b2f, 0x3f5f19d62c0057de, 0x5970857f5ce58933
+, 0xc86e3966f0673fea, 0x2d19104003204e6f, 0x6f899a49e8dcda5f, 0x1e18fb0641f8fcb1, 0xdf66ff8c951b3d65, 0x42238294886abfd8, 0x99890e71b3b200af, 0x0abac666abb6fcab, 0x228acfcc4bea9fd3, 0x1e80ef0cdcf8c654, 0xb158a0e8fe019a62, 0x45363eebb894be16
+, 0x11f8f8ac921309f7, 0x2e9551784484b072, 0x036ff77fc2c06413, 0x5ecf75e98ada66c5, 0x45306394d7b01732, 0x43af818419a709a9, 0x90b7210e7992623a, 0x17f79fcdf273e87f, 0x0276429875858a97, 0x77908443bb1abf01, 0x590bb918a036cb29, 0x01703369836ce19d
+, 0x4d91a822f60d77d6, 0x60c2c4a889d4e4bb, 0x094f1c92b8a33bad, 0x501823cb14e82ebd, 0x3bd588ccf9320a28, 0x53516fe2e439054b, 0xc01771c28e1a368c, 0x3f638331445aaebc, 0x9d2fe35cb42a59b3, 0x47d620a3622b90e9, 0x4dfed3d61d2bbde5, 0x1ff8ae804f39d46c
+, 0x9a9e0184fe8e240e, 0x3f71b54b0d281d3a, 0x29f7b82f67518230, 0x37f5480b64725a0b, 0x31779317dad4baff, 0x5e6ee9c1264e7f6a, 0x2c0ab0fcf7b8c6e1, 0x75f9cfe9acb788c8, 0x54ab91e0f0024d16, 0x7bd3f77082bb4743, 0xe333a969aeb04c06, 0x3f8579ca97417ecd
+, 0xbf7eff2b1799da53, 0x23e8c4a07bab347c, 0x3851878e6af0a43e, 0x1be60c6d54f5dbc2, 0xbfb3572da035d90a, 0x00db7d3aa9a1faf9, 0xd6262b12ea77f791, 0x61f1b59fd700b904, 0x2b1fe8b7d9e30632, 0x026e7ac1a0eb48b6, 0xbdcae1b1138155d6, 0x51fb397f8dfbb7de
+, 0xd7a9b017e0838691, 0x35f8b32a33a9fc90, 0x3b0e3c0317bb20bd, 0x3643a20b9d208f54, 0x3acb7ee510abffc8, 0x750844c68d8c7bb1, 0xd7be92e1379ecf62, 0x00b1081f46da3f8d, 0x7344e6c1f4b30b80, 0x41de7c7be137bfc2, 0x3dd3d3732cce52cf, 0x5f05d6e52f95431a
+, 0x4990f0866d7262d6, 0x78953f11595ff095, 0x426a837147a9c212, 0x1c02cd38ba598bd8, 0x9b3ed15635d71977, 0x4a970ea69e0f6edd, 0x89de4623e701c4a5, 0x00e0ac39a077ba01, 0x1bb59a277b859ce2, 0x57253090103ec656, 0x0b6d3e054ebca247, 0x0115cedd332c4265
+, 0x4095db0cc6bcc478, 0x505b67fde2fc996b, 0xc8996404142df048, 0x1c08e5bfcff4fd2a, 0x367ae59674e0da82, 0x399a3ae00d61ae3d, 0xc045e2d3f36a7358, 0x15d77bf06d691f45, 0x210554a5236c9692, 0x4ad5084da46a8e84, 0x546debf860888ce7, 0x34e2056118b2a8d8
+, 0xbe00c89357461b55, 0x5ee3d8b5ac12fd08, 0x09923cba41d2c976, 0x642a4ce46dbe3a58, 0xb4f74bd7e2200973, 0x20af3cc8d2998ef7, 0x19aa7ff6439e4f93, 0x3edcb7d7b981b19e, 0x03cd447adeea1d59, 0x50ea5570536d14a3, 0x79ca5218d23f8511, 0x0385eac8b6f9768c
+, 0x6f209515449360f0, 0x45523cc27e42ea9d, 0xc8feb2c8ccd69492, 0x1044392718b94572, 0xc61251abf5de1a9f, 0x5644ac030db04660, 0x48880935be5afebb, 0x72a05457c5ed44de, 0x93ef86474fb7ca47, 0x14bb81570556b16b, 0xc9ede09055c331b6, 0x63e3a92fc218bf1e
+, 0x74a531ae10adfe76, 0x4cb4928b1315c34a, 0xd63e204c74ccaa8c, 0x7077c1d76a485654, 0x2626d4584184ca5a, 0x72577235e269a17d, 0xe4801b1139879578, 0x5df7680330bb166c, 0x577284b9c84b9160, 0x2affa298fe2ec3da, 0x1da13da400fb5426, 0x503b4987e429305f
+, 0xe1e8f4dd5d13f6af, 0x3c911dbb882cc8a5, 0x12d1eeb53eaa8d60, 0x245e4fbf97d7622c, 0x10865575cf6e5dd8, 0x7faf298ffa9b815f, 0x5ce92f2c5d6e079a, 0x561dcde22ebc0348, 0x0a5be4865f3aa47b, 0x6de220eb5f0fe285, 0x6f651077497a9c07, 0x69ea469920ec417e
+, 0xd19d877ec8b70ffe, 0x7fc34b7f803c803b, 0xa7a1d6d7e9666f67, 0x1791faad0e9a6c0d, 0xefad3829e546eadf, 0x6913feadc7e560a7, 0xb419a384ed927200, 0x677aedc2d09baad0, 0xc5cae3338cfdc57f, 0x3009cf79e5d1b99a, 0x43f071d02cb11860, 0x08fb548ea60544e2
+, 0xa3536e6559cb0eeb, 0x328c895496717001, 0x0d97aa87d5833ea3, 0x037150b3e421d6cb, 0x12e9ac46eee19b21, 0x4d166398eb1bfe0d, 0x1beff6fe968ea21a, 0x0ac5571f5f4ac5e4, 0x99f596ad50d2b1cb, 0x333e887dd16e72d1, 0x21d3dd00cdd57551, 0x13143156253dbb65
+, 0xcd29ba545d71e9ae, 0x1f23d8778e7c1129, 0x24d04943c9179189, 0x6cfb5083e7252c84, 0x10ad9a18f523fda6, 0x0c0257b9aeb53c41, 0xbefa30ffe2f9d766, 0x0d10c452dc80d38b, 0x0595d73120f998f0, 0x64e5d060f7a20bdf, 0x87e035b1dce6f5f8, 0x10c215621246e773
+, 0x4e01ccce4a149e02, 0x0cd0578f72ed8534, 0x36f9442cfa0dc484, 0x1298f724126c1f8f, 0xc356ef5956bd4bc7, 0x1e80b1a67a4349da, 0x35981b65dfb9d790, 0x49ab1bd75abd1b72, 0x28429bdb4b9eed02, 0x21cc1f9ad65a1bf1, 0x38cd30c3d17670b7, 0x11a7e7f4cebac6c9
+, 0x3fef4ae7654a1b8f, 0x7feef42739612869, 0x44e32ad24cf7bce2, 0x6fd087b791acbd0b, 0x25daa80820d9b1c4, 0x5728ca441a2ef227, 0x1d078c2aa18d9b2e, 0x153a7b5fc23be6c2, 0x9b562553333d8005, 0x5be8f9cea68c2078, 0x5e04104248ed4cbd, 0x3374148492109c29
+, 0xbe662c090ebae659, 0x46414f28fceff087, 0x496b7ffb36d7cb50, 0x5cf4fc93354a9029, 0x683e50c4721be9d0, 0x64b7bf60ca86ab24, 0x25d03b99f6656a3b, 0x0b45d132248f24d9, 0x994b5e1336946d14, 0x6efc68e048b9e00e, 0xc155048a3d8e7b56, 0x6fb487bcce6661e2
+, 0xd6211e9e6a44ba42, 0x7e7e22ec7fee43f3, 0x6697bb9d490517be, 0x64d01a0453005dc8, 0x41e1b9e06cc74c67, 0x67615db160fbb305, 0xa426e6e62d436c0f, 0x4e81941be2823feb, 0xa055852586e1ac62, 0x00400ce767382d10, 0xdf4221a17a761fae, 0x370eb23c9d096c67
+, 0xb2fcb0571a178ebe, 0x6b028192e67ff326, 0x40d45336bcafe5f5, 0x4ea93c9343d67d2a, 0x386c45e5cf6fbd2f, 0x79e4713cf71fae48, 0x916a0a63d9d634c9, 0x6b3ae8f513344eba, 0x8147cb7d94b8d233, 0x79364843440a7a89, 0x8a5dfd3cc9ddb1f3, 0x544c2e43145632cb
+, 0x0d12db42852eb55a, 0x397cc83298ecac60, 0x5be11250c6b773eb, 0x044eed4399574625, 0xf7259e2105ff4afe, 0x3414e11daec5811f, 0xe67d27cccfd06868, 0x4222283b9c16c71a, 0x36209b02b9fa5fcb, 0x59f4d6425084b44b, 0xac03d3f49e1a4205, 0x5e6d299a38b511c4
+, 0x64c3106484e3675d, 0x0fadbffa24714824, 0x2de4648ca1e00be6, 0x4c9c62f504a209ab, 0x51eaf7a7cce6f42b, 0x0f71638dd1db5f8d, 0xb2769547a9e61c6d, 0x2fa3ea7bed9ff86b, 0x3ac66e5dec9613f6, 0x3dda5d468971896e, 0x8a10e9e83e38f77f, 0x2829dc9092811419
+, 0x2c02d2feca629399, 0x4492d55f3c33e7ea, 0x6a9a39517bb0545d, 0x2ee81ded3929cd9c, 0x61a1e4a2e429a227, 0x6bddea88546ad09f, 0x2328706537ac774c, 0x649a6a8e2a9bff21, 0xd014b7b3ca871700, 0x23434659469a703b, 0x58b2cac48545d542, 0x70c300e6835eb6d5
+, 0x761decf91692293c, 0x7d3397b41038d091, 0x23bf4ee5580fd43a, 0x6adcb6eeaa2b8577, 0x993e253f355ce773, 0x0a86d2ee2c28e914, 0xdc3a47b3a5217a42, 0x73efcca25397c1e0, 0xe9cca1cf3fa16f42, 0x7eb2da7b06050f82, 0x16ed674ff1f12ebd, 0x4c58f0b1191884ec
+, 0x73a6df232c586f5b, 0x61d337e8fa6b4d36, 0x11cce0bcb7266956, 0x7046465b3c08d247, 0xa38519661eccffea, 0x2a45d9fadf3c7109, 0xe8ebf3d4b9882acd, 0x33df101b0ee0c7d0, 0x042b5d457f032a0a, 0x0046c7cb7a1e34a6, 0xe93675859b1ad8ae, 0x293df4df3082f4d0
+, 0x09b310301b5d2ca2, 0x24060a4209ad4d5e, 0x57d1620db2bd8df8, 0x610010f6c16d16d3, 0xe78f3affc2cd56e0, 0x639c228774eff2cf, 0x30ff0de8a075916f, 0x2bdb4b8b0f156ab7, 0xbf234a5bfa0186ab, 0x23b781351d485e78, 0xf7511b3d8944a0be, 0x39166b243e8f42b5
+, 0x75b0f81873e77123, 0x68bae87c2509a723, 0x3a80cd85fb7f74bb, 0x2c245bef44d8b4b1, 0x663a441a28bba369, 0x612f371f5d8fd7a8, 0x8f32db41bc02d961, 0x7fb91771b4f19883, 0xc180490313be899e, 0x12615c09a864edc8, 0x529316a61921f0ac, 0x0c33d4a286d4cff2
+, 0xf86ef7bbc9453c51, 0x387219df683bd883, 0x8169aef978277fb2, 0x788b34ea410c1c12, 0x2c771492698630a3, 0x022babfa3884baa1, 0x4aea76ae9750a0b9, 0x263b076c7638d3b6, 0x645f9590584c0e4f, 0x5f95a879dd9b4299, 0xc0ef417bb5f304da, 0x2813c12c6a5835bc
+, 0x127984950edcef21, 0x22af6a80615034d8, 0xb94679f7689f24f5, 0x327eb39b514592ce, 0x7a436cf730eed843, 0x5a25116ea5ae8069, 0xba5c012f21034dc6, 0x66e2201530dfb3b5, 0xabc41d670fad5447, 0x244c14e55dc642d2, 0x9326cb19a1dd2bed, 0x4b3a62c9336758c8
+, 0x553b28b1592b155c, 0x0c2cb1ac6cce2107, 0x3301190803e6df0d, 0x472be3cb3fe7d526, 0xbc1cd9e9dd521fcf, 0x2cafe665687e8081, 0xcd0a08236a802cd0, 0x2ea7a1a71ad1c548, 0x159b28587074e4d0, 0x1e6009c7e5d3cf61, 0x9756fc9e63b08975, 0x2407819ec4c83cd8
+, 0xeacbd77e89030622, 0x7397c460d738f6ef, 0x4299869a703eb623, 0x4990f2456f7e0954, 0x1e6310f85589e612, 0x080645819f7406c3, 0xb6c1754ad812ecf2, 0x3b9068c913e352d8, 0xa442db9c9d170585, 0x22e31e249e89f712, 0xc5e27e5037f31c35, 0x468a4b15c5ae2f80
+, 0xfcff21919c39d4fb, 0x0f0653b1371d0bfa, 0x6c712fe2bb37a026, 0x01955e7248cb1ba3, 0x523fa9f04f943baa, 0x44a9af2a37479988, 0x013cbffcee5c1e9b, 0x02c8b61037f7098e, 0xed769d57803a4a28, 0x27f346a3dbacdf57, 0x8ebc5d50253412b4, 0x34b8b7ea5ff49655
+, 0x5da57d746250a30c, 0x5d8ed96fbcd7e98c, 0x7cc5115b0f45e04d, 0x655d17280ae5d46b, 0x165268dac70c8698, 0x06e94609d5aa10ba, 0x9971a054c279411b, 0x3e22ee22759e886d, 0x6937244f469bfe28, 0x5a9fed8d3ee72daf, 0xf81c3eca691a88ba, 0x2cd7443cd0a65672
+, 0xc67cff79fd5e43d4, 0x35a1fcbcc02b9cf9, 0x4e1e574bdb654895, 0x6e686fcdfc2a62df, 0xf14200a5e8517ad0, 0x07775158bc25ced2, 0xe596457559411be5, 0x14693429ad61d468, 0x0b6144a9d7ccd38c, 0x5181e21da53fd72a, 0x8a275a78fd283a67, 0x348ca398218621ad
+, 0x2b4f038e5590d801, 0x6ed843e36feedb32, 0x2c018f7df4b2c42b, 0x544e9fd5f543823e, 0x58bdf8dff5a2b5c0, 0x7c4a1e83a2d7bda0, 0xa5bfb09988953e90, 0x352aed5fdef8a1e7, 0x1238b98607bd856c, 0x13ec55ac9199a001, 0x27cffe824ef025ec, 0x44eaa9165c54a2b1
+, 0xb1a487393bccdd2b, 0x38d7334b9dcbe60c, 0xf30fc7dce3ca7243, 0x43ecdad2b01cc57d, 0x2f967157ba543c84, 0x0302d41c33a958c1, 0xfa8ad54ea9981818, 0x4c586e9f9283e7f6, 0x80209d2d90fb1546, 0x5e88ea56f5a913bb, 0x54f1b4641e74a379, 0x5901c47609564ef0
+, 0x4127de36615d3a6a, 0x1952223208e84274, 0x25feb7a662c8b6ce, 0x0ba52342d58a475e, 0xf69ff28d69546e66, 0x0be4ee1c2e69206e, 0x5ca4e8896706dac3, 0x4df57bd3702d5f44, 0x1bd37c34f1fa5254, 0x3bbb4f3fbbfe5721, 0xb101decdb9938194, 0x1ebfe1dfbcd1ef3b
+, 0x7d766fe42d1fcfb4, 0x5d6abbec4b9673a4, 0x468c9d96f8c7ed16, 0x2e7cf8d311c542ac, 0x75d4ce9d857c7c12, 0x16e45dcfc4109315, 0xe046a9ab3874f5e2, 0x73b462f5605d93a4, 0x92c8c74a9361308b, 0x6a167cc0952b70d4, 0xc44def91017e2b48, 0x344420f1279f0019
+, 0x44e4831d1668186c, 0x71e324ace783de39, 0x8629d0d59176f0df, 0x24c4d5ef13da921c, 0x3a81ed1d1f871e2c, 0x0f69bee9cea3a378, 0x5b218d8394b0d148, 0x6569d7bacb985b97, 0x77db4235a0203e8a, 0x789256c6dff1244e, 0x30a7c53ce9b9df54, 0x6e1bfe80caeb9386
+, 0x07a1ce746ca44974, 0x2fc10f805be9f7d8, 0xb89839f6bd4245a1, 0x20ad780297947fa5, 0x6029375b24683062, 0x3216eb60e68e0312, 0xf47e1b400cb6f8d8, 0x2d02752b4f9abf75, 0x85c81910c1ae6df3, 0x218bf5b0a0fe3df3, 0x000bd01227f49f35, 0x237536a7878b4652
+, 0x0b89c902841e4818, 0x345024e42f2c3f12, 0xcb38ccd58751eefd, 0x6b8c371c712b129b, 0x09df596832a59535, 0x0e99b2dae8a7a224, 0xa53931d28f9fe4a5, 0x3bf6e7f450d4e199, 0x78d46217d79dc062, 0x006b8058588b5825, 0xb98833719e5ae418, 0x4e0e8ffbf9b411a9
+, 0x0d39f40753c35ef3, 0x000b12bd8cdfd0ea, 0x3b2080da7920422a, 0x41cd5ace524626af, 0xe501d26db3feab55, 0x6e268dc2e2a3677d, 0xb15ee24d4abe6ab8, 0x02ef07d4bb85274b, 0x6151e90700bf5710, 0x0ac1ae4add9aa274, 0xb0e103718e9cd8c6, 0x5c6563662caa78ea
+, 0x8985afb398ca7fcb, 0x283f081a55390a35, 0xa8b0439fb44bf014, 0x0e490ecfda1e4031, 0xbab87966df29fe23, 0x0f42855e1cfa85a9, 0x10dd0ee1c1b5d2ef, 0x7241a4e0ab31dbcd, 0x547f5acb24de11b6, 0x0c383bba0cafb518, 0x0020bb124dca83e1, 0x60894a994f6c0357
+, 0x0376cb72415e92dd, 0x704e707b9247f30e, 0x5d40a4747cc0d44f, 0x32ce9408e1add9d2, 0x76357e99fb3ac3a2, 0x42a6da0ec6a557c7, 0x74aad111cd4e7409, 0x74c412b3938365a6, 0xc811f8deda8e349a, 0x71173402438d8dd6, 0xdfc58ce4f4d14f41, 0x22f1a308bc8cd468
+, 0xa89fd3bbe97a485f, 0x14f30f2c2ad18cad, 0x2cde7128e4e07d73, 0x142b193f87660bf3, 0x2b57c2f9838ed29c, 0x7d4db9eb606ed10e, 0x847ac16f788333ab, 0x5c1db4f024e46fe5, 0x562f7a2b6a870b9c, 0x781a3903680e131c, 0x2aa6c9177ab8e500, 0x426730a075dac915
+, 0x34ebfea0f9dd2d55, 0x0b822d27cdebeb86, 0x7665585ef25d3050, 0x647867eff2f53e37, 0xfb3672ce04d7221e, 0x2350e3615738a544, 0x5232c20db44a484f, 0x46ae9e5f4c43eb05, 0x24aaf7211bd22291, 0x018e187008831767, 0x4eb20d15c9e13a45, 0x5d3c115e7cfcb072
+, 0x6d7445fff165571e, 0x4463369e1447c040, 0x90b86208d53c6147, 0x4c358fd7b17300a8, 0x9ef0946de0399d5f, 0x632ed34d31ef4422, 0x8a4a77655eab6347, 0x6399d1a7a0bad61c, 0x16d9282ff33c3ffe, 0x616f6eca044f6a7f, 0xb8ccd5dc6a2cf4c9, 0x5660877bdf9d6270
+, 0x05928a8b0383fb58, 0x23ddf99fd315df0a, 0xff22ba166bcc9c3f, 0x1d6e077a5ca7d7be, 0x25c8d61b70fed02d, 0x14c3e590273aba79, 0x2310f01eb6049a51, 0x72b594b769d22e6b, 0xeca0f3d33ac59615, 0x2a929efbbd40bc3b, 0x89efc5be721f33c1, 0x680449ec1a05f146
+, 0x6636d07f2abdc503, 0x70a377b94f4d234a, 0xce0469bf6f41e0fd, 0x5b5eea09d599fad7, 0x82c1b6b59ddb33e3, 0x2f4d4c08e13d8637, 0xb7140b4ea2a3be56, 0x0935168e7e990f01, 0x1d2add088db941ba, 0x2b21c217c09bda0b, 0xe41dd3346541c8d7, 0x0519856e8d58309a
+, 0x7dff3c71b557e50a, 0x113387973ba01358, 0x0138cc449bb6e4be, 0x2bb5910dc853a3fa, 0x16137a98c6375efe, 0x7aaefe41aeb81400, 0x07a01a0542d141ef, 0x2912b72393ea981e, 0xa77d51a6988c7d49, 0x1148408f60b35888, 0xa4d01bebe8d8d2a3, 0x294cd350a9dd8ba3
+, 0x08234d619a1c3830, 0x6783d3d063b38205, 0x5bccfb75bc97d04f, 0x1bbc112f163f71a8, 0xa62f6cefafe5b6fc, 0x7a9e747b0f82979d, 0x4054b79d909ae5e8, 0x28ff3340b892d9d4, 0x4c125d5686827377, 0x37f2a0a5a273c33c, 0x78feea72368a1b9a, 0x68a636faa3eb7e88
+, 0x561f57691761587b, 0x6cf61adf43e11d88, 0x2da700cbf7dede9c, 0x437337dc2dbb821a, 0xede63f8430c433bf, 0x0072e9d0011b9290, 0xa2eb8c98f16cf2d5, 0x38805b2030589f1e, 0x41fdeda61f7bee67, 0x0ae29f061fa625d9, 0x9349ad84d1a64214, 0x1d33f19ba9e62663
+, 0x09bd8506427ecac2, 0x36b14ad7f89737bc, 0xfa21df6934990190, 0x46b64f48b806f1d1, 0x2792f234066d593e, 0x5611fbb37ca8a310, 0x16fff531f9a45519, 0x4f33d301c5907f7a, 0x9b536e25af27c7a9, 0x168a012d801dab27, 0x6eb92f6190e89fc6, 0x18f029dfd31a61f0
+, 0x0715e8ceec59a172, 0x4d565ea63eb6e242, 0xe113ba5fe7ad71fb, 0x11e2ea0403a36b64, 0x7980bb1c7edc9669, 0x1dcca85210ee12fb, 0xcb39eca8a440ce7c, 0x40d76d86e578925c, 0x190ec97889dc4e80, 0x59cfd178d25f34f9, 0x002083106935df35, 0x5c133d4e706bf59b
+, 0x5465f23e41565d65, 0x68b1ad3d8a297a79, 0xf30d1a7dae3aaa0b, 0x4dc23051d1e2f7c4, 0x3ebba34189591b9a, 0x60a9c7e601dd66bd, 0x13d3dda20a7c627e, 0x4f9b0dc4c4e8fa99, 0x1160d53d9d51f2e7, 0x5a3700f4dacce2db, 0x09885ed541bbbafa, 0x1803fc1741a4047c
+, 0xe5f4c1b31b7c420c, 0x64489dc42492c589, 0x4a7c614fbbef7294, 0x1ecbcd7b55656761, 0x937eb13f38aef87b, 0x782f232adfd9ae70, 0xcccf3a66937ad2a2, 0x37c03984d5ceb865, 0xeb386229034cb093, 0x59f5c48e0b8864f9, 0x4582823ed0695113, 0x1a1b458926dec994
+, 0xbfe9a166714b990a, 0x5559f572c5c74327, 0xce3702af3062b045, 0x081084f99ea47e97, 0xa7caa361fad7801a, 0x5de9fdf11d77ca63, 0x9844c4070b3954eb, 0x3a228b06ba2d7b11, 0xc230f1afbd00a110, 0x666d38ffc34556aa, 0x66ce3732e8ac27de, 0x41929e7dd4b09ff3
+, 0xfc62471af7bf4a86, 0x676e707ecc06fccf, 0x83f8abf13def905c, 0x0a1d593cb77f7b5f, 0xa12e74eeba20c888, 0x5f269b77ca1e7eda, 0xc03a95d4aa22593c, 0x491718c8e77a50a6, 0xa7fc82b298e65b69, 0x6e0071794870153c, 0xc5ceb4b6a16224f5, 0x07b1ca674d103e24
+, 0x2250b5e978675269, 0x0a81c5984de2a349, 0xe1d989a19d635be7, 0x0e819fec10b7da17, 0x2dcb00ff4c42aafe, 0x6c712adb1b6ea91e, 0x4f498a2a72d81b2d, 0x1df7bc85f7b3a287, 0x566abad8fbf661a3, 0x02e931f81fd9680e, 0xa4da2f0a2b70e6b1, 0x50cbc42758250ef8
+, 0x37776917deb3b6fe, 0x794a966d72eba874, 0xd43ad97e6a2ef284, 0x59518cd24b56b295, 0x1a7d4d54504d902f, 0x69ac820c3b079c22, 0xdeecaee192799e92, 0x1d1170e6ab3d1824, 0x9c403f935b789a3c, 0x2cbdea3ff4d0aed0, 0x75e9e61e11fdf69e, 0x01abb7e04f5572db
+, 0x04f2a97f30f4ae50, 0x2bb570d8b8d68275, 0x3483082806aec395, 0x423a68a1b4ae9eaa, 0x46a102ad4d0a08ac, 0x0aab163d664b028f, 0x701185550400efb2, 0x323562dd17c32fab, 0x3056724f0f200d62, 0x1952feb6f156772f, 0x556bcb37dbb59ed7, 0x2da7d509797f1298
+, 0x546299c286673578, 0x53e3f55621102082, 0x6258ec478f0fe66c, 0x257a20bfdc5388da, 0xd78b037a0ea718c8, 0x6e90b22edf086a85, 0x824baffae5295996, 0x1b7367364b2c9954, 0xb6cd638c764889b9, 0x723313bfb9ae7aea, 0x41e45d0f8c8f7d95, 0x5ff3de74a2cafc67
+, 0xbaa496020816ba30, 0x5dbce4fda9a71682, 0x06ccd9332f28666d, 0x1c12a5d01c6277d8, 0x522dd8ecb3c02ac5, 0x102bce2d0a53ae1f, 0x95dbd86bc5a2b03a, 0x321101ef3313ed10, 0xfd3ecc35c0a04de0, 0x3350371d6db50ac6, 0xe8bd96f5aa51e429, 0x34ed427159b78689
+, 0x34e617c6e63ab336, 0x0f1cbce6921da2e0, 0xf1baffd3ada86ac9, 0x157a2c3ea3ffc112, 0x0bcd8731421d0ee1, 0x44763e1e860fc451, 0xf77fb33d540c2e1c, 0x1344ae30ce23fac5, 0x6144902efb42c4ff, 0x7a104e3af283929d, 0x42396c011876c0fd, 0x37279f2380bed3fe
+, 0x2ada80211f89dd79, 0x31f63a5a646d39a4, 0xf560b9576386a742, 0x5ac4906f8adf4524, 0x142eb471250fb797, 0x04d64215f0061d33, 0xa0a2a15be9e7d862, 0x6e016a92c4572ccd, 0xb2ebe1629721571b, 0x154994277c578498, 0xc8b8f56729fc39d9, 0x6443b990eeabb72d
+, 0x96753dd765890509, 0x0a5b75eab0eac518, 0x5196e92983b3825b, 0x4e1be62a50806d0c, 0xde0030ec4aadb822, 0x61f1a2e0e2866e78, 0x19073563cd553d19, 0x373bf4d284f99019, 0xb02b8cbe1c0a481d, 0x0547d23cfd0052e0, 0x5627637c7ba2b459, 0x48973becbfe7d33a
+, 0x16ff5888a2aeab2e, 0x06841b1a8da03ba4, 0x92fde3463afc9792, 0x1834e485a7d3ff51, 0x77132fb30589d427, 0x7430670bc94a8703, 0x92772b37249b5853, 0x333d2995b7efa2ee, 0x3f8c0e7aef9511a6, 0x69d37ff5ac46e3d5, 0x82a7aae04e519718, 0x17378615b4583082
+, 0xac38a582bbae0759, 0x2eff0dafdef96b92, 0xfdec0d93ef8e840c, 0x762639daa21fd852, 0x5f57e8a924def64d, 0x482cd5af83497667, 0xe026794de1374fc7, 0x5f028a6e34128d98, 0xda65261d912e9f9e, 0x22e005f8a6b69eff, 0xb78942148ba3b187, 0x64366535c25d3ba0
+, 0xdf0b52253083c97b, 0x4a2f79e4e94bcf41, 0xc21edd2abb9a52fe, 0x683473374a359bec, 0xa37ea14b0f3fca9d, 0x420594da6b2c79e2, 0xe8ca90f30dfea346, 0x1079a1ce099c1590, 0x1fe629c4f5feb470, 0x44e4157acf87564c, 0x088e5e02ea416a27, 0x1c3dfa6277da251d
+, 0x5f8f003d40aa4d96, 0x5cafd6733b163b27, 0x5da30efa7a13282a, 0x6ec51314046d4f1b, 0x7567b1767361df00, 0x5b7c32f0443b2cc1, 0xb562ef6049b84fb4, 0x3aeee4727a76397e, 0x41b53fa295347e42, 0x386591d7f7da7d00, 0x2cc74ce92427dbb1, 0x1257ea30f91179f6
+, 0xad39989c01a8e8bd, 0x44bd335fb3d72ad2, 0xb9d2aac1d18bb011, 0x6a6ce48eaf9e6eca, 0x154ac4dcc1e842a8, 0x70c1a0afbd45f938, 0xab6eac799cf08794, 0x4fd1d30932287461, 0x5dfb8d5c3fb5096e, 0x6e0ac449ecf9a78f, 0xdb8b4083e3b9b11c, 0x1f333052e7606323
+, 0xc5ef86d59604424c, 0x77939cd55e66b2f3, 0xb43dcf78df72de90, 0x58b786e512d52cfb, 0x3284c3239bd45240, 0x3c441b065e0a4b1b, 0xd37512181084c380, 0x575364238b27e817, 0x7cd02f47dba86600, 0x7d13ed5d338ac0a1, 0x257f81559c34abba, 0x41f01bedfa90197a
+, 0x49a1b656abea0081, 0x543f8a26e027ec27, 0x5fb8b4b41d467592, 0x10fc425fc6cfab69, 0xd439f2c18b1a5d86, 0x5ae831a2388522c8, 0xa2a6fc22069007a9, 0x13b74f36047675fe, 0x3401c784f4c24627, 0x687ded307722f0a9, 0x217046129440e7df, 0x45e77e2980003f37
+, 0xb20da325630a66ed, 0x63b0d113e262e342, 0x643a83c146c55144, 0x32f093ce85e2fdae, 0x56b36dfcc888331c, 0x717529204733c2ba, 0x9303cc92773804be, 0x1d11b0aa6588d39e, 0xdc960415f3cd44ef, 0x17e49447ec764e40, 0x9a43704793a40579, 0x021ad2d4eb1dc93f
+, 0x1a7e604ec85e3575, 0x1a51e42c19c6c570, 0x68a04bbf89d082d4, 0x17dbac2e246a91b4, 0xaf8c4947c0a772f7, 0x0d9b2a60438653ac, 0x80e61650ad34512b, 0x690b9c9b3f32f623, 0x1d058e97b2ecaae2, 0x74f420be10f8d31c, 0x3e1a0de35164247d, 0x7f55ee1bdd17c02a
+, 0x0b6862e5629218f8, 0x384dda11d8feae23, 0xbf228a0d830aec86, 0x5371106370c603c6, 0x9d3206b59211a0df, 0x43229375caf3e356, 0xb0f883bba79a3ada, 0x2c2d8e0a452d4653, 0xf4a460304c2ea812, 0x0137d4f52c540d9a, 0x3cfb7b7fdf7db070, 0x739b1bb6c9fbee75
+, 0x071875f854b55bb6, 0x4790a7fa0bee4434, 0xf53b48583b2f205b, 0x3ecbb997dec804c8, 0x2e0bd761f1a8d9f6, 0x4ab1d4e87774ecf8, 0x042f6c3f788407ef, 0x61f4dea5e48cd582, 0xf9ce803049425e2a, 0x0dc797483fe9a800, 0x617f8a73151b5ee9, 0x44bfd816680d52f8
+, 0x5c79419ab804903c, 0x63ad816cd196067c, 0x7d15aeb3658b519b, 0x022cdeed52c817ce, 0x19c6d8bba6e19189, 0x29c4d44cbd6e6d1a, 0xb79862e765684df0, 0x2101590b816db6d1, 0x65ed8f2f2d46ea23, 0x38b674735938f48c, 0x0139bb9f245019a7, 0x190ab3f649f3d19f
+, 0x3483e796f42c55aa, 0x5079ae670fbf3d19, 0xdc0c82fd6c335f37, 0x73b0fbb11f37e9df, 0xea98168b8177882c, 0x1a5a7c36e7a3f982, 0x686b0c3cefedfc3b, 0x33c18c97fabb4b1d, 0x5bcb942b2fbbac51, 0x16dbefe68d7845d7, 0x0afa2826391e3a5c, 0x20621219782c5cf9
+, 0xe84c754a01eb3581, 0x10f7a28a305d597a, 0xb5869004c8657301, 0x6b7875ca01cb6e02, 0xbb072ef33e179bac, 0x5077686280e0ce29, 0xd9a8742ff4ba40a3, 0x2a8b7664a6a274b2, 0x38e61bde61a5eb2d, 0x63508023cf5b3e0b, 0xd9835037c099e530, 0x093e9f2719fea5b6
+, 0xfd4fed2c8de54ad8, 0x070a008fa8c7ae91, 0xceb1d5b60efedec5, 0x684c3a918c862ac5, 0xb18f51c960ca0981, 0x57b477637eee4206, 0x80b30715e8b5c19b, 0x4dbba088b7ca60b6, 0x9444a94423088a04, 0x6732cbc296892ca7, 0x53490d6fb3d56acf, 0x49eb6adfa9c8d100
+, 0xc9a62800605b147f, 0x7bf865444b9aca1f, 0x94e053120aab6cc5, 0x1086e0ca88500c44, 0xccde59208232446b, 0x383468c2b6aef138, 0x83ea739d74291b35, 0x1e99da2c6768658d, 0x56e8b5a5353d7d74, 0x2d32dd77454271b8, 0xc55c2ff2edc6b2b4, 0x00cac5176a1a99c9
+, 0x4f7903be6e4aa62f, 0x1a273c2cd0681a64, 0x365f7e8141d00617, 0x31a7636813efcbba, 0x887f8cc04d913bde, 0x52228eff2ba1e690, 0x642f0e2b19a60ced, 0x1665314e70015dea, 0x80a6a90a6a52ba10, 0x65359c0fc072b0fc, 0x5b9219193ca467d3, 0x74c3abd6d6f55bf4
+, 0x3a28ed8d0f920541, 0x670754478bc34833, 0xe6cfe7169cce7afb, 0x246676fd74cb73a6, 0x9171df2a1cf9aba9, 0x41d25a131741e3e0, 0x66b46621722a2556, 0x26cf38efe1bf2c26, 0x18201e8a03c47d7c, 0x622b7c4df0e6dc75, 0xdf1410886cf0eb52, 0x3fe9980c8c3d7b4b
+, 0x3a8c9f184eadabcf, 0x57035121b998b02a, 0x78f4c92a90e811ca, 0x6f49f00a01cde8dc, 0x7fdcd27411ecc535, 0x022cb96d2286a257, 0xdc0134fe701043b9, 0x25392e58e843bf8f, 0x1f09c999ea785503, 0x0ca2ad7dc81b5bcc, 0x874c82aec949229c, 0x7c48f0e9f0f4bd53
+, 0x69678a1916d24b16, 0x7afcb5657d1c1c14, 0xe4aba027bb2b9cf5, 0x183b3608404a2ce9, 0x9ac1b95c916180bf, 0x289566a2368855ed, 0x2687df7355d7f18b, 0x2b359f72cc8f0a05, 0x0278a408b883c174, 0x7e58c0cb389fe7af, 0xed33fee252c3925f, 0x0c625da54df55c55
+, 0x6ae96b3b769e5439, 0x0e5d2fa0c7b35705, 0x167607262d24dbb5, 0x0ad948107535b75a, 0x0388a028a8f10d77, 0x108207b40d75601e, 0xe5027b4293eb843c, 0x48ed3ca5e6fd0de8, 0xf6549af48870fd5e, 0x456b30048846a9a3, 0x4f4fa1c2a1cf7289, 0x2af7fa2540c04b53
+, 0x38ad9215a895ec95, 0x68703d4464d781bf, 0x5646db639337e6d6, 0x3f9699616584a463, 0x61a5028024c80561, 0x6305b29ca2c6b5ce, 0xfb2ea08bdec80336, 0x100211ada2b7f066, 0x2d1996e24df4d1d4, 0x26b28a7d64d89d57, 0x74b1001303d7c7e9, 0x5b22bbcea3bcb5dc
+, 0x9c5600d7aeb9362e, 0x45880a9b7e328030, 0x478f4b86891c62e6, 0x2a446ae719a3b70f, 0x7584c0ed4052bf3c, 0x41964793240c07f6, 0xd14e79ceea7e3363, 0x7824ff6a35303f6a, 0xcd05df50f80a3cc6, 0x0ca38ced8fae8c95, 0x308682adc91d622a, 0x10c66d7051807540
+, 0x2a575d13cc870171, 0x330dd323f0a22663, 0x4a3743f3905ac700, 0x47c7e24870823767, 0x717cfb03bbdba592, 0x06e05ec4c060784c, 0x0ec0e1c53f99271c, 0x2408c0e6b4a3abf4, 0x51e3a3af0d08f2ea, 0x215ba8286db812e8, 0xf59b256c75b400a9, 0x26a6275957007176
+, 0x6cdf48a6b3832146, 0x18ace0e3c65a5e99, 0x360db2a9bd05c63e, 0x59e83ab4bab62637, 0x8ac3262739424ed5, 0x76153cc0a3d67e1e, 0xe72c9878d89b15cf, 0x10e121a0b5018cfa, 0xb951a60cab920ba4, 0x5e97fc22eef22a32, 0x5f84790e808b4de1, 0x48a02c399ae7548e
+, 0x611d789ceb856ad1, 0x1eced941d4fbf27c, 0x94677356573bd5e1, 0x2b0444db2b1adc17, 0xfda084cfe2f7ba9a, 0x49ca4c2351236775, 0x66b1d728743a232e, 0x68a8f615f19c7a5f, 0xd0f56f7fc0894da3, 0x5f7acce0ee28323c, 0x5e9a7f1de6b43efa, 0x210b102684f03335
+, 0x440dddb2418687b2, 0x34cf764884f7188c, 0x63d890fc87dbd001, 0x5e8381fafacc2240, 0x20067359d30aa6ca, 0x4b2a529a6eae9700, 0x5d426f39aca243a6, 0x50b3a227c686ffcb, 0x85feed98319a22c7, 0x3b61852f2bcc2029, 0x545c1f095cd5ee94, 0x0d88cccee359177c
+, 0x0b829774ab75f2e4, 0x1dc4e2909436bd7d, 0xc2a3c03b9093ebc1, 0x2fe31399e65360c7, 0xd1a89edef3ade404, 0x68ab90cc86b5823a, 0x167f619e52629dd1, 0x084c117578b8558f, 0x8981ebed797f3464, 0x7df22d24c650d9f9, 0x07cc357a4db7a569, 0x1cc2bb6d02a3e41e
+, 0xf59a9d0d05709494, 0x0d6e5155782cdacb, 0x8b52847a0ec69a50, 0x6ca8c858c42f4661, 0x42d1b19d814601e7, 0x047469efe4d839d6, 0x4153b36e58c4f08a, 0x55ebdf6228474806, 0x999501f8b7483909, 0x7aca808801cf4aa8, 0x8d1e931fd632d7df, 0x57d2bca6d266752e
+, 0xe1d9a1bcc88f32b8, 0x1b97314a01c8cce4, 0x603084152dca4daf, 0x32f3acb3264f9160, 0xb40ea5bc40da6aeb, 0x34db56485081ca27, 0xa1ce6178a6f47f17, 0x2f5a30106f3215a3, 0x1f59085e86c22ec9, 0x0c868c7920e8c4b4, 0x601d9a49ae49b8ef, 0x48ddb64e1faed71e
+, 0x5ff13dccb968ef71, 0x2c4ae6e291e197d5, 0xce02f9aab81ba2b9, 0x36aa938122532582, 0x13755ba4a778518b, 0x6815deb59e533c95, 0x0a442845b663d655, 0x3fc46973ef3a016c, 0x0ebe684cd6e0854c, 0x633f83338e4f1570, 0x44337057ea41c794, 0x1747ab7ce3ef6a7c
+, 0x0cd19b552168f965, 0x33d061fa3a57f305, 0x32a6302bf0e22078, 0x725c445f88b7a0fc, 0xf27cabafde3d318e, 0x7094e8dda6a84559, 0x1e6b834a9723a194, 0x74765fc8b8925c22, 0xaf6979f63300be90, 0x626687a87a8d077a, 0xdf2c0f078b8e82ba, 0x00819125c04e01d5
+, 0xf8aa3dfee6349b42, 0x6219268a4509c909, 0x663c434c2a53510d, 0x25b0a841bf3d026f, 0x9de41c9bc01223dd, 0x68984cdc21593b38, 0x45e27e96c3506b42, 0x74c54e7befd329e3, 0xac50c13c4726acfe, 0x61233d956a50c324, 0x618c38a1bb47ba07, 0x4f2c5c2e1f6b8aa4
+, 0x3440e29ac4735186, 0x061aedbf9e5a3861, 0x4eb6a486160df972, 0x3a29dccfa8d23af8, 0xa124b00a8e171606, 0x326059e54bd06661, 0x2e41cb19584cb762, 0x22864630e416be8a, 0x687355932251ec2b, 0x5c857b8985d4da78, 0xadf767140904b717, 0x6fb34256f36ea510
+, 0x2a90a1b1fd914fe5, 0x27c71089459b127b, 0x3565c52d0ded1816, 0x5a741e6c5bc90359, 0x5abffa341597bf3e, 0x1ce96547f6b8d9c4, 0x4e7a98a60c64dd6b, 0x7b95ca73efc98661, 0x7b16c67968a13df7, 0x6ee006f7e106e463, 0x59ca73412b5ba6a5, 0x20e93671ab2fa475
+, 0x644b3cc9010a6399, 0x7ae26be0bb1a4574, 0x22f9f625a96cfc89, 0x2547c4f2d19f8ec6, 0x24f36df9db1b72ae, 0x767b8d019e847d10, 0x8282e839044fafb0, 0x6ac835bee4101a98, 0xe470f3b4e66651f5, 0x2c917bea5e857130, 0x896438a795dec910, 0x15a6b6576a4de674
+, 0x433f3232a1810547, 0x7390d0b2062eae75, 0x4a7d8d63d2b9b8e5, 0x334864271b36590f, 0x3ff7e96c611e7a5c, 0x0db8990e6d2895ae, 0xadaa28b5006e0e95, 0x6751ba1e5f17ddf8, 0xd47a880b9ac90ece, 0x02f9996d94f97466, 0x4d15afba6260b395, 0x34d351b3e3619af5
+, 0x4195c61d1f4ab3d5, 0x7ab31fa2e402f04b, 0xf47b4a666678acb0, 0x70baf7cf38f26b8d, 0xbb3652029e505363, 0x7fcb41b1d5911d8c, 0x51c2d985ee097513, 0x6f33455c2efdae43, 0x65c2eb547d0dc9fb, 0x5a76a852215209ba, 0x02f4fd09b2b3b8e7, 0x5a9729f41fd19f1a
+, 0x25add1c1e69e6261, 0x258b3306387424b1, 0xbc2c5ef1ba0c5ba2, 0x375a04ad11a00d14, 0x06b895ce08675206, 0x316cb3cca7e0bd6e, 0x748addfa40833d6a, 0x7597de524711d217, 0x14e4d753c21aa44e, 0x0f1e2311993c7baa, 0xc2458e5754d88b1f, 0x54fc0eaba0aced66
+, 0x5c6439df4a45fc75, 0x258f1d0936b965fc, 0xb4374b03dc5d730e, 0x121deea090b94bf0, 0x306b2784ddf99c04, 0x494e7add01b1f3e7, 0xe9a2e01ae4eee8d6, 0x618caf393e9734b2, 0xe76df1401bdd9d1b, 0x768d0aa487eea367, 0xf899a112637b40ab, 0x6ff5c90f4ff8a165
+, 0x4da01a0f75aeda5f, 0x18f6edd001e019fb, 0x9e9b2d7bd0fdba99, 0x3e315c91a522f48f, 0xfc305d0a80259c76, 0x1c6171b78b20f8df, 0xa10afe5b50b58df4, 0x34a3db99db6533b8, 0x2da68c3bbedac4cc, 0x5824948013626f39, 0x1383fddacc65a3d8, 0x6a283b6626a91402
+, 0x0668a6f19bccb91b, 0x4b9bac19bcfb688a, 0x5a34f91a91ca39ed, 0x61f7518eddff596d, 0x7a2abec0ffe11da3, 0x2bffb2e499aaeea4, 0x48b9326c070fd779, 0x4a9eb104eceb0f22, 0xaf00afcfa4a8c306, 0x513cb40612ed5991, 0xcf654a8ed62e9fc9, 0x4926e64a4af6c919
+, 0xc832ec71685c15fd, 0x2989bc993691265f, 0x829b2b111b3af877, 0x4718b16c71f00de1, 0x78b88b772db53b2e, 0x5abc96f7af398237, 0x680baa9c44666ac9, 0x45292dbc8afe3bac, 0x4b230bf09d05d0fc, 0x489b43ce328ca771, 0x1d1ec83854be7b02, 0x7a96b765be73debe
+, 0x8deedc36a0b12cb1, 0x7122e088ef9fba7d, 0xbbac2d26cfc0e332, 0x7104e51d664a2a61, 0x933d7498e2f7fcc2, 0x40a558d74a05c2a2, 0xe61c469892a8457c, 0x4e019d5b07e76c7c, 0x4df8b71354f25919, 0x642daf22227b77b5, 0xb833ee0fbf42fb0f, 0x383a17b39ac7dbc7
+, 0xb78a12b128cb1d70, 0x19d5f5e73e68341d, 0xd7ad0f710e0e9026, 0x5d84d8f31657940b, 0x7e7567d5341ee103, 0x418b55322a4b588b, 0x521c87ffaa7420a8, 0x505fbd9e8cfa1956, 0xcc0acebf4d9c048f, 0x120e7f1fcb8ae3fe, 0xcd729ad92877837a, 0x0b05eb03c1e2a239
+, 0xb6b0c05b9db6fcfe, 0x53de60d89789db5d, 0x31285f9a39c2288e, 0x4d0ab34c1113f8ac, 0x4a19c72f52bddc95, 0x6b2dd509ccec92f5, 0xf75b911cd6407080, 0x76d2f9aa94b67b6f, 0x9feb9c0f6e631804, 0x180f6905a69247ac, 0x735f7522ff78441e, 0x3dda390d023bb595
+, 0x4fdafa9f579c8c52, 0x4bf6c961af60969e, 0x394a007027b0d900, 0x629fa34863d47ebe, 0xb45fc564cece23fa, 0x485bbf6060b1c94e, 0xb483189056e588e0, 0x54209e1546f4db59, 0x50df6f872269157d, 0x69c7e2c333dbadcf, 0x72fbb3d3db3fc8b2, 0x7b4b4c73439c1eeb
+, 0x18c04c72cdbf9268, 0x72b5e90ebc14efec, 0x18828521e3ea716e, 0x3ec8ea0a3c187695, 0x06934168bffc8376, 0x38e2d67df284ad44, 0xc3bdf582a07af4ab, 0x0e68f10ad939005c, 0x1c74be4d69621d64, 0x11039af3bcd4d10f, 0x8ab09afc3fdfcdd3, 0x2282b2fd31da5c9c
+, 0x2bfabf895eb287f5, 0x3f0e7fb49122c784, 0xb5ce966738b18dad, 0x7123f84e73d04303, 0xc313788de4975c44, 0x1ccc460a80dea340, 0x15734c6a05dca172, 0x7442097f9fa3edc8, 0xde14967b023b0f49, 0x725526d93c877711, 0x815689603066b98a, 0x5389d799b5ba9d2a
+, 0x57bb4593c7fe046f, 0x5960bc7468ae5a12, 0x65da48d017d048f1, 0x6017af871009a1cd, 0xf0e7aa6b5ad82a92, 0x3b7dbba8ccec4773, 0xbfdbd51253599415, 0x53fc6d21f230507d, 0x35db75e7ba9eda67, 0x0ef5b0034a618a35, 0xaf63c65d63f3288f, 0x6b8c2578a33d1871
+, 0x7737be2e2b044dca, 0x520e6964a9c53060, 0x866a9d0f82ca4fd8, 0x119e308a51104964, 0x9a04106fda7fc64e, 0x18316e8de07cb595, 0x16af0f4acd821c1c, 0x197c07d4a47dd0a9, 0xb39c156b5ed2e8ea, 0x704416b38b0e42c6, 0x4930b7dcde048667, 0x016f074ceabcd0dc
+, 0x0de21d77f3243390, 0x2e0f0a5f894fb0be, 0x42e96638e930a039, 0x263623737ab03f44, 0x4c0dd1e4d32bd36d, 0x2c95acd0c65dadfb, 0x64698f08a074d529, 0x6a625e9880f88819, 0x4ab66c66fde97288, 0x361c9054be48eb23, 0xcd097fdd8fe78037, 0x2079ca2b3830dd74
+, 0xc3de73950ec03b1d, 0x7782c657549a9672, 0xa602e60e07e28455, 0x73c0711fbf624876, 0x1d7b7b9089691604, 0x32de6559d32e0e9d, 0x975f2658f1d5046c, 0x7f7a456c5737a0dc, 0xfa35f20a1d2c884b, 0x74ff625a725929bf, 0xa7b2df16b78f903b, 0x6f34e2f97a6b8453
+, 0x69d413ac707c3933, 0x343c02ab8e6f16be, 0xf8834eaa83789e80, 0x7386268951f86a33, 0x62264c2207e6fce0, 0x16498e9f96646bd4, 0x557eec0beb010620, 0x4b12bb1730ec8c09, 0x8e7bc26a40959b38, 0x36c42231a63edcf2, 0x94f28ecf0d8552f9, 0x760cfb19dd6e1c00
+, 0x6a2fc521db70d98b, 0x080bb0be0ff5d561, 0xef261fb3177cb1ee, 0x59a9556570c6014e, 0x96108200871589b5, 0x312bab217ec61d8a, 0x2e415d6a7f98c8bc, 0x4db39a19b3a4bfc7, 0x9c103ba918269a23, 0x6d494975a606fbb1, 0x867856e5f77c017f, 0x7f1f7bb3e5b9f570
+, 0x413e9208d870d96f, 0x4f867b931b3a065f, 0x2687e1c66b1c6044, 0x0a1fd072e67d783c, 0x15b39eef5e33cbd2, 0x39892e7265c5283f, 0x25190b682c18dd42, 0x53211cd477619013, 0x29680946cdd62385, 0x5167bfaeb3111301, 0xec828a5f0d1d1169, 0x19c5ffe72e3f69bd
+, 0x20306548a01bd375, 0x4cbedd7c3af93f5c, 0x509ef31dcda47200, 0x2c50fb6bc6b29bbd, 0x7001320a470aa3e4, 0x5a972cc245de6ae8, 0x12e64edee7f3b8f2, 0x7451ed120be3b388, 0x2e20cd5c68e38ed3, 0x14563996ce9af2c5, 0x131b183433b307b2, 0x7340278a3b548b38
+, 0xf0138f5167992b43, 0x38245ca467f70b38, 0xa4f8cb259b116da2, 0x1967e3a57cd31b76, 0x900fe0082c716e80, 0x64b9460e1c40b265, 0x3e311b935a6856fb, 0x6cf8e25ba4944ec0, 0x67d790860fa62866, 0x55d12e9feeddff38, 0x026cd928bad67793, 0x0c0137b5940015bb
+, 0x414ed65cc439ca47, 0x258993f505045327, 0xd7298481d9f71868, 0x5701ed63eeb17e35, 0x1ba11ad45d314dc9, 0x09bf82225f5a1e1d, 0xb1e54b36cc4b445f, 0x7091bd8babf0c61a, 0x12fd0eec18eddbde, 0x292800a4ecd0213b, 0xa87d5350ff9a7eea, 0x5f36bf61a8ed0e45
+, 0xc872f3f540016115, 0x1e2a9eefa24f2e31, 0xf1bfe6fed28f4332, 0x523888a419927fec, 0x3d44c3de648271d8, 0x333731ab316fe653, 0x945f813155213ada, 0x4202914f2665baf3, 0x95b07d7ed0c1fad7, 0x1135bd5c79ad94f5, 0x8d6cfc73d0bc0961, 0x7bdbee2d41ecdc69
+, 0x749bdcbae9ad9006, 0x524d617900939396, 0xc54fd77a6d1a3ea3, 0x02f6521f0c638a4d, 0x6ebad727df9d480a, 0x42f17a6fa7b9e9d7, 0x790ee8d16787d3f0, 0x24ad4fb551cb3f30, 0x9fe665d7a1fa44f6, 0x58d6c9d5a0001129, 0x35b327442cd12911, 0x7e4e434a5ff0b234
+, 0x8ca2e4abb4ae8d91, 0x13591f65811ef89c, 0x18d7353154e38173, 0x51300a367d9a21db, 0xf6c4e48f87ee36bc, 0x54eec7bb279abb98, 0xd13971cf2dbeb9a7, 0x7188b1c5176da1bb, 0x5bad84b62a5ca10b, 0x3ba13c6c82b909f3, 0x4abc41b8ab91b9ca, 0x35c6bdcb227f689d
+, 0x7daa3f855b72014c, 0x47e6a13c98ce0491, 0x0aa04f0f81df067a, 0x1db1884100eefb25, 0xff09063a408d734d, 0x549613d12932405f, 0x8c798eea72cb7a2e, 0x75ad5bdc75827842, 0x4ec75b3d3b0c1a0d, 0x18a2ff42be9a7da1, 0xdc0bb4b483d7d2bc, 0x2823bdc09a467881
+, 0xe79a1e675b42397b, 0x0287c919c5634398, 0x69038e7732b1fcde, 0x7a646d147e388bef, 0x0f30c5b6c9f31151, 0x12ae894af71d4268, 0x445d53ddcdf08391, 0x2cc67e576f2a1493, 0xf784557530b0f97e, 0x63f2ca684318b0d9, 0xdf97e4d2ee826c5d, 0x561af7e33b0926a8
+, 0x77e3f2b9dc812d4e, 0x54263709d2164e7b, 0x8b2f87eea1eb973b, 0x4310f5233baca5d9, 0x03f320a341cf018b, 0x79cd18751d9bbbeb, 0x29d52e4bf6d0e65a, 0x6c0ca8f561fb8789, 0xae04997db7cfffed, 0x4f4699cfbfdd2a5a, 0xe61dadf252dbd6da, 0x290bbb0d8b045626
+, 0xf310ad17ff353c45, 0x283f329d639e9822, 0x46e83d3b940deebb, 0x5c4d8ba174335ab5, 0xb209cd365aa5fbda, 0x4012aee56329acdc, 0xb5a71d9dd29a0266, 0x6f6d7cc789277c8c, 0xf60d6f475e56205c, 0x6251b18b03f92ad6, 0x2a0bbc8193543d5f, 0x00a4a69e045bdaf4
+, 0xdf0b593e2aa4a7a2, 0x6010400f5f8ec15a, 0x209ba49a66bfce61, 0x0da85ab80fae1e6c, 0xe021d5536d64b228, 0x221d44b63a00157a, 0xbcd59d6db366458d, 0x35133224a9606708, 0xb4275c1161b456d0, 0x5659a81fa20e60ac, 0x9c336f994c5a214d, 0x34d21a90afc07827
+, 0xf9fbf02652c70049, 0x64c06b3848c1d521, 0x2f9c60958a09523e, 0x7b655277c2a54bfb, 0xc93d3c2a2a5afeca, 0x4dce3463c1ae3954, 0xee9685e202213914, 0x5893897570e41a56, 0x7f84b324a5788068, 0x3c78cb81c4f02f6d, 0x7a27738ccbb996fd, 0x0fb58eaf3e7367e7
+, 0x30287d720430b558, 0x68cee5b250ef42f4, 0x4f9653b517c88a79, 0x6e183ee0bd7ed936, 0x6c3f7f6cca6ae287, 0x6878230f0462a825, 0x02ce9fc87b5eadb4, 0x5f67462ea7eef43c, 0x060bdecb5ac68e87, 0x54a724ade180552f, 0x8a8ef8cf8902bb58, 0x70a33014c1d0c849
+, 0x1bf28e7df4f19443, 0x1afad951ba98667e, 0x0a54fc858b7d2fb7, 0x05ddc5a69b4ccd94, 0xa6e298b83cb2e7cd, 0x2f829174e4c7ad5f, 0x13c1f4ff5ee11b91, 0x6c640c502fc71fff, 0x2af02c4483428871, 0x6f132aa79e876346, 0x34b2dd02262ae77c, 0x285f622cdb3287b8
+, 0x042e2b0bef3fd0d1, 0x1d1d839355c860d7, 0x6a704af11859a51f, 0x0dd53e1536b62d7c, 0xbbf01a057d6c2130, 0x50519801184c833e, 0xd65670870589c8ed, 0x1708b92b856a8ca3, 0x2a9abc13323318c8, 0x6a33bd76b2156bf1, 0xbfdfd556bc237165, 0x5c071619d8f82e4d
+, 0xbaf82974bf1eab35, 0x6d2ca40b1a567068, 0x68af92cd415b4738, 0x27df6633c4701f7c, 0x09950261b7f2927f, 0x523e95b0cdbb79e1, 0x2a0506ed2789656b, 0x26e798caa439e1f1, 0xe2395868792c84e3, 0x11d872f90861464e, 0xa43f0d736af25856, 0x46db4e119cb5bc4f
+, 0xe209df9939f29ef7, 0x31cef94d520c268d, 0xcd9b7c8781cde3ae, 0x4b8ae96973a390f6, 0x059d26817ce7790f, 0x2b63b3fb9514e7a4, 0x0cc909307ddd6a6c, 0x0e74dc75c3f8327d, 0x48799af08dfd3af3, 0x43fd9e98bf9353f7, 0x8fdd4cb1e66665a9, 0x6d764a98678c31d8
+, 0x9bd09719b261798a, 0x581c2b44f2d99108, 0x822aa9151359baec, 0x0e09fb882687bf2b, 0xa06bc9ce05e0392e, 0x7de5e1f5a11c5404, 0xf5554fb2905012fd, 0x0aab734e8354a019, 0xdbb73b6fcf304409, 0x6d7db6a9986bc49e, 0x304458937bfffa38, 0x5a1d1c59fc07af88
+, 0x2860146f8f900d04, 0x7f0aba3c98197998, 0xc7e7cbd01102b24c, 0x70cfd94c00598967, 0x63d4e37201af5fcb, 0x1579e4c29e5e8dee, 0xf57fca46533fd05c, 0x50257d2ed59ee16b, 0x4c7581f02f9ecb08, 0x1532a552dba1bd90, 0x4ba0672c81e0406a, 0x45943b7323db3de9
+, 0xac44eda8c8132f0a, 0x18cf60ee8fe14662, 0x5859bd45e6e11a95, 0x3f885452d1b5fa56, 0x4b94c1225e2d6768, 0x65c5131446597a1a, 0x15624400bc99ac56, 0x23bdea95c2f43b9b, 0x6e590cde83917e78, 0x79a74ba920679f36, 0x7fed0c37977a5b90, 0x0dc681d76e875f6e
+, 0x021ae74e39868b26, 0x273aec371914701d, 0x9cf4fe67e76bad4c, 0x3b846dff1f3ace94, 0x37f08cea9be7b5e3, 0x31b3c519608c357b, 0xd5028203e7fbc86c, 0x0817018f2200fba8, 0x25f46552a0bb2ad7, 0x18e866c9a8b132d1, 0x2d45f17d3a4faa86, 0x0985d1e6d2f64353
+, 0xc18f13062eed0260, 0x5aa2f3024263d257, 0x3e1ecf155e36b8f5, 0x6f29631cef0ae1f3, 0xdb922060163d04b6, 0x2077ff70ccdbd4ef, 0xdc00d08ae9d6da14, 0x7a5646c0a3439d2f, 0xbc90c26c57bdd4e8, 0x0f8bbd895850012c, 0xa13d3e11caf65543, 0x3f09bbd6674cf3dd
+, 0x1279d963f13fd356, 0x2efe38bf6c23daef, 0x6d959355940cea37, 0x59d62f84071cf41c, 0xa38a90157176bcf0, 0x35cbbf925aaa1dac, 0x1f11f165683eabb6, 0x5a0609978922d487, 0x82460e11a6c88c43, 0x12f931c1ff874aa8, 0x46c09093395c4151, 0x664941702aaebe2d
+, 0xd095b4d0641b9275, 0x35b0bd31edb9f5fa, 0xda242f05be89e127, 0x4a7674517882aed8, 0xeb0aaff8b7d7a459, 0x34d22e0a5dfaf1a3, 0x185606b61a734a27, 0x55fbf45a0b5bed37, 0xa8aaa283b7a1d602, 0x204706e3ad831228, 0x966a1cc940fa3ab2, 0x2db337397ca70bcc
+, 0x4da110d57f55bdee, 0x150c4e12074a0050, 0x781ed22b25618e4a, 0x264b13eeba9fddd6, 0x885ef07cb18952c5, 0x6330af5aa05b5323, 0x22c6e9a758906dee, 0x2c7f9f947edaffa8, 0x4dc3fe856aacc76d, 0x0de7be90167fc20b, 0x19cf024d0ee68589, 0x35db45fc8767ebf3
+, 0xd30b6d65fa129444, 0x5affec4bb815549b, 0x8aa1f057644ec46c, 0x69525e0e10b14939, 0x9d0e3b0764508a9b, 0x121370b97e9e89ea, 0x8910064d9427baa5, 0x7fedceca29df0b54, 0x238fe7fbcccffcfb, 0x5db7d08600eff747, 0x40839395ef40467f, 0x6d9ef3d8238c6f9d
+, 0x8aa5773b85a81c2e, 0x6f1efccbdde8f0d9, 0x75672afac524e05a, 0x2bab32c5b7c2d4cb, 0xeaf03c35e8fa3f16, 0x27c7d287c68e683c, 0x83e284d172998503, 0x126f344e5c2daf8a, 0x96cc610511f1b5f1, 0x61a8547b7e06208a, 0x6640236522cddcc7, 0x2a55311b956c3873
+, 0x7cfa8153fe7f3a3e, 0x5da5a038e7b3a221, 0x6cec7b203e1f779d, 0x6d8b4019b09c0e05, 0xbd14391985da89d9, 0x3eee32e69dd91fa0, 0x399d6584c84cf545, 0x7615c887bafc2f79, 0xa6add752a351d406, 0x62a105f701730080, 0x52a7f0c5877c82ad, 0x69a2e10c2c1c1017
+, 0x3e61c7168d9bf4c0, 0x657f50094df4279d, 0x4147e80616ab099a, 0x3ad7b3d4259d42c6, 0x8f8ab8f7e51c7f15, 0x2dc500eff69840ff, 0xfce9525bd49e1699, 0x180e88e1dad770fb, 0x909c22db25baf7ca, 0x65dae639ee2113d9, 0x513d72f7b66a40dc, 0x0bd264a2b4fdf72c
+, 0x8f7595507e4fbeb2, 0x6974f3a5ca0890f4, 0x00c144f22dbfb92b, 0x4c01a502fc10ea9b, 0x9350c62da3708896, 0x61d91839b6912250, 0x038b9c4d831af1bb, 0x1983bc112e2a4e7d, 0xab3a3742eb385e54, 0x73d2a3740c017b52, 0x950d68f7be1196ee, 0x290bcc1eaf3df69f
+, 0x5e79731a7bf7be3c, 0x12c5399b85d387aa, 0x516c60398d1dedab, 0x362e9cf5c82e4e11, 0x06c126e49acbc301, 0x7f7fc85be313627d, 0x5a9cc812da2feb9d, 0x24f6e5e7cd5dc43f, 0x4269484921efac4b, 0x6e6a5093f85ec520, 0x51d703557cf7c29d, 0x15d7696c67c52445
+, 0x580e6525963e0a03, 0x2cc8962181c36e13, 0x897210e03278a2f5, 0x471e6d21ad3f7dc4, 0x9a75eb852313f1ca, 0x39ec6e94c7a306be, 0x738b26b12c302684, 0x3dfdf18ff8c35571, 0x5cb0d747b065292e, 0x6a26a39b21ce2660, 0x19a3f68d5613e5b2, 0x07176db181432c73
+, 0xd3488d9a3aa9b07c, 0x2cfb78a588107423, 0xf9bf96475309ae7e, 0x33bb8a5504911b07, 0xb0e3ef0eb7ea4f0a, 0x538b5ea3d43e8527, 0x8a1fd2f01fbe3b56, 0x605b4449526de4aa, 0xa9c520cde50bfb0f, 0x3f461970754eceac, 0xce4e304dce0d737a, 0x4c348d3ea6bd724e
+, 0x06306da7f06b6707, 0x6e413316a5a4a0c4, 0x75295ead0d7b8b8f, 0x764071aaaa3e2cfb, 0xcc668fd9b0caa8b2, 0x27593f6474582ce5, 0x331841778e6d8bb6, 0x7db557a456959089, 0x49fc6fa2cf93d78b, 0x7142ee460164e428, 0xca6f9deb3a0525ae, 0x74b2e7191e92a40b
+, 0x1cdf191bd94b41c1, 0x4647d17d37169fbd, 0x4fda35e8e1706ee6, 0x526277a280e7df4e, 0x32ad7a0ba6b356a8, 0x7cca11ece4725565, 0x87d23d6a0d92d9af, 0x6d979b63b4842bb7, 0x8cb0200bf776d9b1, 0x16f59cdcc841ac12, 0xb7879dd1554f9682, 0x74226fac7a8ec3c0
+, 0x1e942f109b641dd2, 0x412ac8f5263ee145, 0x81550717698bc3b5, 0x4d6fe7c377b6ab7a, 0x355a98f4f1909d60, 0x3fac29226179630b, 0x82cc379d5824b108, 0x6d57d71a005b522d, 0xb367b6b00d3c0ed8, 0x45cba7a92be14061, 0x7c1b838e5ad435b6, 0x2affb34cf4f8020a
+, 0xd96bcf2caabe01cf, 0x6b1b0db094332558, 0xedeeec683046a28f, 0x1b575a9574cb43e6, 0x34f3d42d45236320, 0x7620f3be3e12f483, 0x646698d80a1e5a35, 0x29cc2cf861bd65b3, 0x28e30a9133054770, 0x6ee5edbae2b4a178, 0xd0f6710bd0a41fa0, 0x3559131d07a8fb9b
+, 0x30f45fa39b668795, 0x14867b8ab695413c, 0x78bb3ffb0821fade, 0x034985976038b469, 0x323c9e0fdb8c869e, 0x11f4bb82eadb4f28, 0xb77ab20aaa2d2e75, 0x64d1275ddc0eb54a, 0x5e4842556a97d5ba, 0x79bafa99a7b0622d, 0x62c35b7738ca7081, 0x6c404a41a6a5e71b
+, 0x2d755b2fb9b4cee6, 0x7559cb0c005218cb, 0x104e6be70db575f0, 0x51bfc2180fb9f8aa, 0xc3d9ccb92a4cee31, 0x573336a2c071fd72, 0x6f6abe30783b2ea9, 0x3d021690ec8d8b74, 0x6d17bf4fc52dc34b, 0x7adf9b47b4e85716, 0xd76b9a926758bfdb, 0x49869482df72679e
+, 0x6be5c4f4ad257b95, 0x6eb719b5bbeba4dd, 0xef69ac8d9608df72, 0x71f887093d153722, 0x2f70b72433064992, 0x1f0921c1c756c166, 0x2e3c87c7756ab6bd, 0x06fa9d767543f4c3, 0xdbdfa5d586cabea7, 0x655c402be28c384c, 0xfe5b01f0eb98e5b4, 0x3b00bcd7ce67ac66
+, 0x9f1b01ae005ec9b0, 0x41714bb9d8fca486, 0x52673154bbc80e85, 0x6dc8bf6e2336b4e3, 0xeb89e99c6450455c, 0x37f47a35f5fc131b, 0x928445991ec3161e, 0x6167fce88c3c0abc, 0xc45c2bf7a48a0cb4, 0x144fa74fa20477e6, 0xf6e9458cb1b5b118, 0x1efa71bb9c2f8b26
+, 0xa9a3b9bd7db733dd, 0x68c68fece684b4f7, 0xcc3e3251a731c6ce, 0x3e5318d023af2d72, 0x6787fcbc485aeb52, 0x64dd5ad1b838068c, 0x3d4a33334cb4c96e, 0x36a9cb29b2bcf078, 0x2aabc218d796010e, 0x1395a0273ec0605b, 0x864680a0ad57109f, 0x1543415da1ea02d7
+, 0x89e472b86a4a0c69, 0x66cbdae39a3157c4, 0x180fe02d1b6d7905, 0x3c90ed27740f2661, 0x577ce5eeee34c5ff, 0x36b43ee115a0fb8e, 0x94b2a3b417b035a4, 0x2d5ee0c180f05337, 0x492e3bad1a38ce45, 0x345715b5d17d8189, 0xbf581e12ae32e325, 0x100bac73cec695f8
+, 0xaf6502cf26accccc, 0x683edafe463dd637, 0xeada649cec0a6b31, 0x24a7c01c649d845b, 0x0b65f8d202a16679, 0x6f5243c831c8736b, 0x58dba5685913a637, 0x76b0e688a7be75d4, 0x033dcfa1ca72a68f, 0x4329b93ba919d394, 0x60ed8df9eae25798, 0x6924e0afbc58fc54
+, 0xea4829e99a4a312f, 0x5426d86e984121b2, 0xbeb84d6ece2934bb, 0x738975bbdf2017b7, 0x55f8cc452ba9f801, 0x72489d312c5ff9f0, 0xe7dee158a3e50810, 0x1638e568b24630a9, 0xe59fd3efc86f63d3, 0x2f458f2792404f23, 0x1547d5806782bbc9, 0x1e492b15ac8b5f04
+, 0x79516cc1ff657588, 0x2e4ebb60935bcbb4, 0x5b9f9b0f48ff242c, 0x13f9a8cf23ffc71e, 0xec5a085db840822a, 0x64d7651ff417b0e3, 0xb4a6979beba89cdd, 0x040d9ad06e2645f9, 0x8e96a33f6c3c742e, 0x0446df0e0710e2d9, 0x0d5cb7f2c7221781, 0x3383e942a336bf01
+, 0x01e436b959ae81cf, 0x7729e2b8d914589e, 0xd0b3ef058f4bd7c9, 0x58c8c5cca1508e29, 0xdb80e189ada0eb42, 0x7fc2ade0bc77bdbf, 0x144741ecb7a45556, 0x3c26329289c3eec8, 0xba42640cb8d0e2aa, 0x391de51eedf143ef, 0xf7fd5112b7016f16, 0x3d6f64dda4664d82
+, 0xaa7cc4ebd939bbaa, 0x2b939f677a359a38, 0xb5dc242c06348017, 0x0a781db80c10a634, 0xbb768901c654591d, 0x629cab27c9ff2f68, 0x47815d5b3ea8695c, 0x1803c3285be9e81c, 0x317ccf53888f213a, 0x757a6f14e6da9e2f, 0xb65dd6e5814c0e41, 0x01dd124cb7e42814
+, 0x6c2bccd23d5ca125, 0x6801760412e3a09f, 0x039d75f9b6516b28, 0x2907faf770ca0d7c, 0x5dc56d4dc4c66a2c, 0x70efbf1b1092ce45, 0x80e29bf077a320f4, 0x76dc8f397f13cb37, 0xc9818bfeb103f98a, 0x4b7480117abec786, 0x5fe9f0cbed56d3df, 0x5a310999ec60b006
+, 0x0a4d9cfa49e722fd, 0x6e66045a6e83ac4c, 0x91a95583de34effc, 0x755fa397d989f137, 0x3de1b80efe632cbb, 0x2a6c19f77e90524a, 0xd5a6374ae78c34fb, 0x303942eba95834f3, 0x7d4bb7c7fe0369b3, 0x7e1d6d4e80a6d8a4, 0x1804a763f30f6abb, 0x28863996accc2d1b
+, 0xcd553d3e81e7c04a, 0x14399b79c5ae79b8, 0x1be501c553a19b03, 0x759b0c9eed456134, 0x27a6fb2caedd87d4, 0x3065e21488957f32, 0xc74d1571d184b99b, 0x552727bbef0df36b, 0x15b24fb74ce70aa8, 0x14f68da091f61233, 0x13ffbdaf8d904c81, 0x48d21dee93766c1b
+, 0xe1524d13073fdb3d, 0x5b6f85624513b6ce, 0x0e58424f396a17a8, 0x711366dfb91990c9, 0xc643baaff7af87f5, 0x20d723a1339c6be2, 0xbb48b6e73e162312, 0x097105257699e188, 0x26f882f71fc54e76, 0x5f80435a079007fa, 0x06de9bd3d34ad204, 0x04a53cce9e4aac15
+, 0xbcf3c6ae4f7be572, 0x297a487d82b2ef94, 0xcc2f3ea726cdc965, 0x5d63850bb67fa5d0, 0x472a04ca5b7c4f91, 0x0d68357b035f91b7, 0xc3b179f6456f4e64, 0x5a3a6785074ea661, 0xb0b081cf1af47871, 0x2862d667bf697d3f, 0x652aec11b1f3ed0f, 0x7bba6309f95dac12
+, 0xc830a0a7e8d09de6, 0x552ccb431be3d1dd, 0x5b974505b408ab9c, 0x297fb14599a30742, 0xa3fe0fa0287b8fd4, 0x5ca1e36d535d8da7, 0x8ea3cebdacc172be, 0x7ae418ff80e0e6e2, 0x160d431c55e3740d, 0x1c0ed4357ffe754d, 0x5afff6bb74dd8e8d, 0x0bcc2d95b86fb737
+, 0xfc1c85805e3ea7da, 0x738f11559094ec3c, 0xc5278afe0e5d6e72, 0x0e3ce8586b62f7a7, 0xb8716cbfacc8cd51, 0x585257b12758e1f5, 0xfe7445949de1af0e, 0x485e23bebc5cd9a4, 0x46cdbfebc153fdc5, 0x4b42e43eb0e30b9d, 0xd7f88e5cffa10dea, 0x12c5f6eceda86f2a
+, 0x54f46bcb522f6e44, 0x641dcd8932fbd236, 0xd415d1e96aae9588, 0x425b52e1b1b08981, 0xd6c5eaa6d4134153, 0x617cc7fad557c3de, 0x30ebc45bcb0498aa, 0x22f56cf004a7e63d, 0x61795d8dd1dc4085, 0x19aba445a914a632, 0x45774666951b0ed6, 0x29016978df11f054
+, 0x29f7c201298e410d, 0x2f4035fa51478aeb, 0x910cca18999b5cd0, 0x73235f1575399bdf, 0xc4776f39ed912a2b, 0x72e35b593fa41d06, 0x643827838fc81234, 0x7aea2a00d4cb00f5, 0x3a43fb745987860d, 0x65e5f39185081a06, 0xef5621b4210ff072, 0x7ea5949987538e89
+, 0xcf7020019508af87, 0x3b9c4062001c0a8d, 0x718ebfe209674834, 0x01134a36c2bbe43b, 0xf4858be4aeb09655, 0x069fcec10834c996, 0xb183bd4749c695e4, 0x6503916cfcf2f9fd, 0xc7440b28b723bda6, 0x531f00c2fe5985aa, 0xf2b372ba716ef1cc, 0x4fbba4b9f9b0b606
+, 0x1ec7bb504d810e5a, 0x7b90dc1314a0d3bf, 0x3af89e60239b4583, 0x63809d79273bb287, 0xea24779ceea9b8e6, 0x4d63ae2b471bff17, 0x7a40e504f1a5e120, 0x1327d6161dc8964f, 0x1b083774e7e86efe, 0x727593bcc3f42937, 0xf56a364690eb7990, 0x5fa186fe468dab02
+, 0xcd5ee1407f6c16d2, 0x100011a5bcb5c492, 0x271c68e644483420, 0x2f41dbec9febfa96, 0x5b8a6bbe99d69baf, 0x62b6172e0e2cabe5, 0x4e7c62c7eb8139f5, 0x61ae5fa65a7e9217, 0x22d8ddb3c0bb3e2f, 0x34e6a2700933ca20, 0xfce9b4733c3e7610, 0x7954386286fb13c1
+, 0x3ec653f78b14c77c, 0x4d0f0813344b3c82, 0xd09d73e07597cadf, 0x6245b4a7117e1e0a, 0x0a21a71e27df63d3, 0x1a65d710a895399b, 0xeb28ae33fc9990fe, 0x2fe5c35acc90c900, 0xa1c9c2e2a794c6b2, 0x4414000d9dbafb4c, 0x4530747929d0531a, 0x24d41075f265f229
+, 0xcee46e1c8170088a, 0x7c682743e2175c21, 0xf9a50ae1306b450e, 0x2d75b1f725ecca09, 0xb00503e6778de870, 0x7250d1184922c23c, 0x0f3d0a9f677c69f5, 0x3354d1ae2877efcc, 0x3146117819d461a8, 0x6f8f2617e750ed6d, 0x484b7f1830976a64, 0x25324a76c542dc57
+, 0x1beb4d023946968c, 0x12b15ac52eccb8a7, 0x252587baae7e8bae, 0x3af500dd1993f17a, 0x78fadd50f1a88218, 0x7c0eb1833ee74892, 0x5d861b655852148c, 0x5294308b616fd82c, 0xa2f163e73d70d5b2, 0x1303986e83b0e004, 0xe3dbc40ded727ded, 0x51145ae8e23d55b6
+, 0x69527b60f0fbaec1, 0x3fed7182a01a76e2, 0xdf5aa64962ff5698, 0x07a92137dafcc6de, 0xee92ab5d6fcdf9f7, 0x633250f3577fa8d3, 0xca9477d0efc64924, 0x628439e326946eb5, 0xd6c051f265389156, 0x5b5511a3fdd0d1f0, 0x99a14210302be79c, 0x1f344d95804c243b
+, 0xac2b9a250d4c0f00, 0x36ad08e7bc9115cc, 0x14be506ac23dfd1b, 0x79d37c3bb5100a57, 0x9d472ba43a96ea7b, 0x02cb7dd1d2b3dcd8, 0x4a3a836e3f58453e, 0x42703f6d1f7be336, 0x8d8421c978c206f8, 0x1f6093fc90e72002, 0xf7a49e9117ba67aa, 0x48c8772941d1be36
+, 0xf01e65ab91058501, 0x5298bc2c7562bbf4, 0xdfd9ba0174352e14, 0x2894a7aeaa3c41be, 0x93dd5bf0df5672fb, 0x05df1070a12408b0, 0xd8e9be6466ca4a04, 0x227c244d2648a991, 0x414b54dab3391e59, 0x5b8d8a4b404a9253, 0x8053364e82c33270, 0x24a7a34b36ec0213
+, 0x5ec0a8d6fe4ced66, 0x4522ea44d8ea8a36, 0x00cd3b1ff60c3bbb, 0x0102d20615c6bfb0, 0x6eb45eb5d90de3a8, 0x34a0384c6786acd3, 0xd1e510bea98aa24c, 0x4d465ef018993b6a, 0xc513af34c742cb11, 0x73e50fd2ad1669e8, 0xc9da4a9036883867, 0x7455950fd6048815
+, 0x98cd75f3b6ce43a3, 0x682ae7e979ac362d, 0x4adcf3be8c22b324, 0x01ee2eae67fd9132, 0x2fe71524964bf20a, 0x5ee8015bc2da4a52, 0xdd57204deaa8b5b5, 0x4c688725e73f1541, 0x5aae7961d2fc8659, 0x0858a2b39c7b62a1, 0x63113e72884f8619, 0x2ee4af737ca8ca6f
+, 0x05f4c8ad950d942d, 0x665ba65db8355dbd, 0xabc084c6c126f18e, 0x5c0df5035d4b65f9, 0xd8c0e71b2540697c, 0x08fbbe7720efea1e, 0x223f76f176cf4391, 0x18c3f6a52e82f483, 0xfecf69ac6e61ac36, 0x4742ade6b57e49bc, 0x89d96c45ec9cad08, 0x1545c20995feabeb
+, 0x8ad2ee3903b1cfb7, 0x63afc81364db5613, 0xd8e2018a05483af1, 0x03705ae7b2c345e1, 0xd2a63c8b5bc73a6c, 0x0493cee611400781, 0xa6efebb90008d513, 0x43d0ba2517e8a7f7, 0x5e2a1efb4a62e27a, 0x3c49449bab20547a, 0xefcaa6ca7f073794, 0x0ece2d166dfbf020
+, 0x8581b872a4dccbd0, 0x18c1df0d05d16b66, 0x2e0db0412648398d, 0x5225859188e7476e, 0x80bb76150ab84b51, 0x120bf52fc5e1f5f8, 0x11ef0d0ecedd5da5, 0x090f031d5df27d8b, 0x835eb0ccfa69a693, 0x749ea685152d25b9, 0xa44e3d1b13f2e0ad, 0x5c9f241eb6b28a8e
+, 0x4fe3175a12c99a34, 0x1229aeeab12ea5ca, 0xc4694e17cef6cd2c, 0x5e235f4aa41a839f, 0xe5ea0f4c5364d2ef, 0x73164fd392e62edf, 0x0c6a493a1911591b, 0x53fbd8b25696e218, 0x1b41da364e03dc3a, 0x5e0f446ec05a369c, 0xde38eaa75f097854, 0x198af38146a5dd52
+, 0x9da6a8e3096964a4, 0x1c4a203893c2689f, 0x9a813e0bfd6e5581, 0x74369f569fd1ca96, 0x49400270d9124a09, 0x3cad7b971a984a29, 0xcbfb7ef1e64ad615, 0x7cb6a85eaf8f57d6, 0x680e22d62ee308d4, 0x2762bd6ced548243, 0x500e6b2bd4fdfd6f, 0x5166e24bd601607c
+, 0x23b1aa04805be7f8, 0x2bbdb4075186cc64, 0xc89efb80df0e6795, 0x074606304f5a6d2b, 0x289d84bf8611d264, 0x73651a1bb1d83bcc, 0x555ab1268dab6d3a, 0x2061ede2bc03a017, 0x285c70e1260439f8, 0x522c67d4594c7c55, 0xd21ed82966e4c590, 0x1dcacb018263f9be
+, 0x5092aaa3a1c822ae, 0x763514b831e64544, 0xb1b2ea062afa5eab, 0x291561d9f389f9ce, 0xa8645f3007c291de, 0x10afead6364a3ed8, 0x22327f46724e91a6, 0x300e3a83c3a82bc4, 0x2c6ee3860fe86ebc, 0x1dce013a6a125c8f, 0xfd120f6e9b71fee0, 0x5610ed232f1b5f17
+, 0x1a19bb20084899b1, 0x2a7862462d892b5a, 0x0523cd1305ef8dfa, 0x702a5dc7f1bc18d3, 0xede118e82001a609, 0x745912b1874c35e8, 0x2e80265dd37b2d37, 0x51ffcfc27f88b090, 0xc419fa8e4a6af93e, 0x59bc80ff63d86edd, 0x6a5848837853d80f, 0x3ae0a9888548c3a8
+, 0xb099a65381fe271f, 0x573889e70abc081a, 0x2e7d9bd39c499d15, 0x0eb86ff62e3d44b0, 0xf0d1388538cb9ae1, 0x781f53d99c4f8f11, 0x9caee6bef59d1dd2, 0x257faf372c2c44ff, 0xe456f797dacbda9c, 0x16c3609ca30b3e0e, 0xdc1b58da1b794b5e, 0x3f30c7c89acfcee3
+, 0x73e12225d0cb6aa1, 0x6740eff88df6b79b, 0x49b64dfc6449540a, 0x089ab129426f99c6, 0xd272833e1762c254, 0x7b9f14a619767ad8, 0x35011453d3081559, 0x4e007e0b86a616cc, 0xcd46ad8c8ca0e865, 0x1bcebf13940955dd, 0x67a461b834d31f25, 0x230a91ef7aee9c60
+, 0x7c9fc9e2c0a710cb, 0x29825370b65b7a28, 0x2efad827770d8490, 0x6bd4a4873daee6d4, 0x0b12778177377104, 0x7e234b552e1f2682, 0x266e76e3d0078794, 0x4e63991cd0114b39, 0x4cee16f84d53c525, 0x780a73ec3fb88c6c, 0x2f3cd337538c79a7, 0x11cc3ed8a37297bc
+, 0x2c62bde95e97de1f, 0x3875df36df94abec, 0x56dd6f0e0814ca9e, 0x3a5039432fef7d56, 0x03cb485fd00e6511, 0x0390b3dc068150f3, 0x469fe4c365f67c54, 0x7d39098e6fa9706c, 0xdd8001429d9e7005, 0x5afcdd4f06122064, 0x053a445e0d677b1f, 0x2731be3222e9cb1c
+, 0xf336a51898161543, 0x16317ee847dc68e3, 0x6540becd28efc016, 0x34354fcdfdd24846, 0xa128eecfa4e26f30, 0x4aee5ff8617d3d33, 0x0b4c67f61b4a12bf, 0x37a14ec7b4f8e998, 0x471ff51bf117bd00, 0x73c9812e3f686e26, 0x37f449c0d5f6b31e, 0x5094d287f81b75c6
+, 0x8ecf75688db97406, 0x282cb14ccf10923d, 0x7397104b12916382, 0x36bacb1bd7d4f6c3, 0x270e9075a6fccedb, 0x093825919175a65b, 0x5b3cad32ee5e0dc4, 0x049369fb9e24c767, 0xaba9ed87deeab5b0, 0x29d514e58f5dd0f9, 0x5be7ec26d7ea1157, 0x5445298cb676a7d0
+, 0x3c81e0f213ac0e1d, 0x1372148515870de2, 0x5f8621a639fc4ab3, 0x4b6beacf464e78c0, 0xdd8c9429a03157f8, 0x3275ae2c7347f139, 0x5b9c70e3b8619a2f, 0x51eafd74920924f3, 0xb8ac17d00d0f3350, 0x1b1ea90275614ae9, 0x87305ec3b653169c, 0x1bd02c5df5cc1dfa
+, 0x01e94bc2807fe3eb, 0x5aedc5433552a29d, 0x2eacc812a18e73b2, 0x63ea9300bc2653af, 0xb7567a01df45d23c, 0x39377fa64a58ce25, 0x35e3cc5b6a4e7cae, 0x3c2ec56951877456, 0x21e54bac905ace20, 0x3104f300530ed36a, 0x73b1df89e9c30a26, 0x378661326fdc8541
+, 0x464427448683c51e, 0x0bbd0c852cde52dd, 0xce338f108b9a0ece, 0x4cc06e5766cf7078, 0x36f2c99064ba4370, 0x37b9d8f861538b12, 0xc96be2dc85ed37ad, 0x6e0a8c77c3a19ef7, 0xf5e9909db3d858fc, 0x3ef7b428c32337cd, 0x8c6555c263b05b9c, 0x1e89f60951042a03
+, 0xeb54cfb4ad5efed7, 0x424fcac20cacb198, 0xc604a9dd7b657289, 0x2b008e78294f1706, 0x369109a3ecb45f9c, 0x1a62bf8690ad4aeb, 0xcda7cb58de1df85f, 0x7cf44a25b9463b75, 0x3d80b89a83710108, 0x37df1c501066a452, 0x191fd248e9f5895a, 0x2885cb041c25de10
+, 0x5e16214df9fcd27e, 0x57f275c015a39940, 0x1f9bd3b9b7d2130e, 0x61b7a660d8742659, 0x2c2dddb436cc9c12, 0x5e79c15385c446cc, 0x38fa113dbdd89e94, 0x2c8eb81bf6db2368, 0xd8c79ac51ac026be, 0x532a3b670f318b35, 0x2f58de8117557e24, 0x372fc4c865d7156d
+, 0x60ff3f7b3818ca5a, 0x3772c742d6e36752, 0xde194fe15f52ca5d, 0x4d5bc9a039af57c4, 0x4ee4f708014e25f3, 0x0ca9526d63725181, 0xead7b766f2cdc6d0, 0x4c501cb02d2d2ab6, 0x46b3f1c6862a2cef, 0x05d259ef4573645e, 0xf21c2a66395ba949, 0x12f11ca12a9a76a2
+, 0x7804f980f675428a, 0x1cd680b1e56b6d24, 0xa773b4e903ad7cbb, 0x54e2a2bcc917dc96, 0xb6543b7130f77020, 0x6f3dfeb2a30c1689, 0x2b2b11fac240309f, 0x10c7c0d56bc92c8f, 0x646f5c47c4ace977, 0x50234b9578184089, 0x1e5005ae181f1b54, 0x19f9863a65edea0a
+, 0x32d156075fef719f, 0x58c07b5f1ff82bd4, 0xcc6c45197fca77db, 0x74e4b450a05eb7a4, 0xbb3b95e22ae0ac51, 0x050870f254d41807, 0x9405454b6c938bfe, 0x31890e3c3f2fd62f, 0xef4215c3298ca0b9, 0x3ae6de6460523154, 0xa16108678a5136eb, 0x6b79939705bd447f
+, 0x77854eed79e13dc8, 0x769e7da5fb3ac403, 0xe8c60017d65648d9, 0x23ac43702127ad8f, 0xe1e6f71690411ac5, 0x073d97c7b4397490, 0xa0db0d8556b638b6, 0x49c7c1610637e4ec, 0x8dd590ec6a2e1cee, 0x03f7ce79e7083f3d, 0x9bf87cd6917ce0d1, 0x5cc48cfb161521f0
+, 0x0f9ffa0471c35af7, 0x54814a780e3ce32b, 0xc01351e44c5d2630, 0x074b9c2465d3872d, 0x85626f1c7b93bcfb, 0x73696209a003810e, 0xfdef99de35f95ac6, 0x307536f71380550c, 0x13d9838c54741c4e, 0x5669db8b59334203, 0x7ff279313c562016, 0x3c5093808a0b5f55
+, 0x9644f7f307658a5d, 0x70b6aec5073cabd6, 0xc7e01c06a6fd8489, 0x66e3dccbddff2cb6, 0x697f2132b6f02416, 0x33005a33c6a77411, 0xcd8f52090998fe6f, 0x4a4a99ea050002d8, 0x215267c6a19b5b18, 0x49b86850bbf19157, 0xf610623d51e0d92e, 0x42ac88ec778f2cad
+, 0x058b9d164329f5b8, 0x728768c1ac617b10, 0xa237424f714ab064, 0x2829489a9fbf4926, 0x2e1b67317d926591, 0x2903704ed2d6184b, 0x44ce59351ca1448f, 0x479771877571b0a0, 0xb5c854912de83e8f, 0x6b8ae3b22e0da53a, 0xca41ac943255ef27, 0x263473526ba185a8
+, 0x5fd511f6b17593db, 0x58a1bbc7768ec918, 0x76b65913407437fd, 0x1c6e74dc6926fd32, 0x61eceb74e8f3ee79, 0x64b31ad9fd546c76, 0x25940ed39de0315a, 0x7e3e044e7a23b3ac, 0x11bf5ac9d3943492, 0x0bbd328686d97c41, 0xda6240f058b5a284, 0x7bae1c86156da24e
+, 0x2f3d73e065fc1e91, 0x0f05d694dab66658, 0x5fb70773d061e85b, 0x72e31383a8943a26, 0x0d8ce39c09c61da5, 0x04bc7f7680adb8ec, 0xc0023fc5b764750a, 0x316b2c1fff421ebc, 0xf005999b687fd5a3, 0x56ee3cbaa224c507, 0x2bea29e61f5f73a6, 0x3a38569c0075417c
+, 0xadfeb5c2194a4cfa, 0x213c399ff734430d, 0x76b89190c6c16cc5, 0x4e4f6ba08e252454, 0x3a9cf920950d7f88, 0x6ac5b72b426916c9, 0x03629a3d0fcbee44, 0x3685c9fd19598144, 0xfd3bcedb4a0085a1, 0x784482b605d98827, 0xa555a2c360706084, 0x60ad961aa5bc8118
+, 0x2541cdd9262a233a, 0x2c926668335fb044, 0x67980efeb8d83dee, 0x450386bc52c3d171, 0x9c9299c5be5cf2d8, 0x334d1fd28821a317, 0x39253be53357931e, 0x08d6c792d7de8dad, 0x4e0673d0d3a40260, 0x04f0c757e1ee4a4f, 0xa03f168cd194da5b, 0x736eb571a8faffb9
+, 0xdda01ffa13545f0a, 0x0382270351ff8b2a, 0x34a1746b7f19fad8, 0x4182a7b4245c99e8, 0x8c272ec018261c63, 0x1cf3abce46bce2a3, 0x59e271724ad307e0, 0x7dbe50ff16e7f6d7, 0xaf66a4b6021188e3, 0x57833da44ef92644, 0xef824a8cee135a41, 0x0f1b91159db67871
+, 0x07d4f3af1f653293, 0x02b8d849e2a9b71f, 0x454d70d32280fb06, 0x7429c607aa4106b9, 0x12d78bbf94c098c1, 0x7453a088a0eb23be, 0x4ed9594afb8e16ea, 0x2d22da04b3ca68ec, 0xc7cd97f55ac01e53, 0x25961ad2e294234e, 0x0ab33eb868888ec7, 0x2364ed5b80cdd35d
+, 0xf28cad5023fe6c23, 0x287f6ebfb42b99c4, 0xcae0abe3df4530a2, 0x5dfc61a9838f3e55, 0xd2613cd07ddc361f, 0x0755be088546e87f, 0xfcb638b47ef5faaa, 0x4499e32d61f555fa, 0xe6ecbd1900e84e38, 0x45af4c9e3a6a5d36, 0x7cee855ff27fafc2, 0x0b7cb40d22c38f9b
+, 0x7b1f0e9962b0464a, 0x6509e90f5090a233, 0xab428bff96b22a45, 0x3ad3ce4e00f9cb9d, 0xc223d89d3dfa8c17, 0x3f7593691218aafe, 0xd2d6d71771c895ae, 0x3b4d8e7572b978ef, 0x32704eb313cbe473, 0x4e237de417bc92a4, 0x2052efc82c059bad, 0x0adc4305fc9221f0
+, 0x9ecf03e8458e30a0, 0x605616a0a84ba5d6, 0xc4a0013595e6b878, 0x1cf67e06f199eb91, 0x2584577a29656bff, 0x31298d927fecad3d, 0x39771dcefe8ba9e6, 0x345094e0fcaff6eb, 0x2c6416187fff5ec7, 0x4ac9f7359a0af955, 0x063ad504ebdf2b0f, 0x5ede6b7832248e6d
+, 0x1782ba26f26671c7, 0x57c2f8f029ee4a16, 0x9947371997320551, 0x369e539c812f4021, 0xe282da083370140c, 0x268d3e06300632bc, 0x8b600fae0e0059af, 0x664a6fa8a8294e86, 0x0c5d1ed39de108d8, 0x2b6e8938df90e78d, 0x28551d2b6974cf44, 0x124a25f6ce2ec062
+, 0x51f4cc5455ed8655, 0x35c39abe797137d6, 0xc8a78d5248717c11, 0x02922977b850ace7, 0xc1df19d3e378d3dd, 0x490cb2322b67c10d, 0xd5364df938d853ff, 0x2b2cc93feb87834e, 0x03e669dc943fd1af, 0x019d2858b81bc247, 0x2227c11348427a91, 0x48f3fe687da3bcef
+, 0x1a91c7aecd9509a3, 0x33b399b3edbab696, 0x0869dfceafd4ee46, 0x411a2a32f93d770c, 0x31207503b74aaec8, 0x1a7072a683415b2d, 0x8e21f8dcaefb265a, 0x5d6cc7a45c94e06c, 0x4c8faa505b89c4a9, 0x20b306192c6cc8e8, 0xa4f4b4412ed66c15, 0x4c710dd42aca11c7
+, 0x450ce8416730ffad, 0x40cbd7d73c708fac, 0x5c9a1d5956e51cdf, 0x24e7964f570f42db, 0x156ef42c8469399a, 0x419406b88c7c7ce9, 0x9071a13d9da64564, 0x0a1a8d1bfcbff435, 0xf785097f4e459600, 0x263c2293af5bce9b, 0x50a802cdf5ba6241, 0x1c674d43f2189009
+, 0xe187f9d58e3dd909, 0x08e4beae2a57ec98, 0xede81cfdc20881de, 0x763e5f147752ae2f, 0x7c24a45684f48949, 0x7be34f86887da92b, 0xc153599d62a5202e, 0x17f725b22588b78d, 0xe9f9ee991905a062, 0x6a51e1fb2de7f3e4, 0xe2da7319cc59099d, 0x578b6634faa6ca58
+, 0xd5481fa3e9241a82, 0x1e8f4857c513c680, 0xacdca9876221e6c9, 0x4d9a852390cc49cf, 0x3ac210ca6d64c94d, 0x2d4c1f3e4710ad61, 0x3b9adba9cf908b96, 0x3a5063bfe36eb75e, 0xab1ab2232e2090a0, 0x11a295c97e5fb06a, 0xb3f5f341c399b099, 0x72312cb0b41b2007
+, 0x73afd5a7cd9c8754, 0x769e9af4abbcbd1e, 0x35582fd1cf32b9e3, 0x103740ce93d0de92, 0xff0526f36681aede, 0x5dedfc985fe390f4, 0x3284e93331877b7b, 0x535ddd67a6510bc5, 0xa39b69f115790238, 0x66294cde724b9e85, 0x10c32c18806fe166, 0x6ab8ff63435bdeaa
+, 0xcd860a49574bcd6b, 0x508cb36441c1834c, 0x24fb839b7436ea95, 0x3ddeb30683184f8d, 0xabfe9291d1d15a65, 0x2634776b71f3fd87, 0x3e5f153c91cf1a8a, 0x7f14deb35a01e89c, 0xfee0bd7900d9b140, 0x177ac4613a0b30e5, 0x001820fc03e11d26, 0x7d43ddd08de247ef
+, 0x43fc986685d2054c, 0x2cd5cdc211067236, 0xecd75646a38f2e63, 0x59fc1f052bc648fb, 0x412a49610f254283, 0x1838e9162305d563, 0x675af84110efe0b7, 0x2b31312b54c2e239, 0xf59df930bba74fd7, 0x1cd88731116fa8f3, 0x67aada7bc1522bc4, 0x1de717f5e06b3ac8
+, 0xa563a6f605672528, 0x5bede337ca391d30, 0x1af777ff60be02fe, 0x16fd19e483bed0bf, 0xf5dc45f5e3930ef0, 0x57aa8d7423d4e8b8, 0xdcc0d87c2894ab16, 0x1520053aafeb786a, 0x1c6d153aa68b3c73, 0x7fb23641f6bfe464, 0x9890de17f907e062, 0x74793c09d71679ad
+, 0x9368b6df618b07d6, 0x53cf0389f8c0a376, 0xd010789a4b650fdd, 0x6f8daaa4ee20e98a, 0x64b3d9fa87f5b063, 0x6113f379cff4ceb0, 0x405fba357e35fe7d, 0x79df8783667a6cfd, 0x3496358236560c6f, 0x7622eb255c0fcb93, 0xe40c61bc7e52e8d3, 0x2d1f1c355e974091
+, 0x8c34063ff100797e, 0x3677cbd7b33904f4, 0xd8b6425bc264c69a, 0x121d9a7c3a75ee42, 0x7c08e24fbf440d7d, 0x3aa99bc89f8c0578, 0xef62095e037d8763, 0x411c15b6839b5bb2, 0xbcca2413855129a4, 0x2b11c9bcd13c776b, 0xd76a76ceb8344de2, 0x351b05c1fcb8b4be
+, 0xe24e17e1e03fb1fc, 0x1d95615233419bd7, 0x7981b5cd5888cebe, 0x138d82fdd832b644, 0xe6a307d86b3d09b0, 0x5c0b0a0810762886, 0x5014cc0f10834cbd, 0x40a609d280ea25a1, 0xdea29930d3220f3c, 0x1d40840890a22562, 0x491899eb94a0a7ce, 0x1bbb84684eac6f52
+, 0xf2a4d2f9521af8db, 0x6b239f06d72fa3ac, 0x95bbb0225f976c21, 0x3547f5fecdd7c7f6, 0x094cb3485056106b, 0x053ad6c685e1968f, 0x154ddbaa135d23f2, 0x652c72d6e95cafb4, 0x261d5f7455dfbc33, 0x409339765387f929, 0x1be7a7c11c45d0a2, 0x5a04ec810a4f3a6b
+, 0x9582ac6ea4c338f9, 0x55165b29f6bea7e5, 0x50bdd40bdad17ea9, 0x0dbbef3c2fdada63, 0xa9a32c00d1a6019f, 0x64a7381731815cd8, 0xf3d2d12f9d21cab5, 0x04f6d5d2a5dd8758, 0x1fe38a2001cf4565, 0x78c881d15c4af485, 0xa4533060a47ee3ee, 0x6af15cba832e3885
+, 0x985f49b6b6733024, 0x133affc33ead7244, 0x7ff23be514e48a90, 0x361e196986ba779e, 0x8834ac0a75ea31a0, 0x2e7dfce8831c4bcd, 0x21577845f6a899d6, 0x1559b171275dfd91, 0xf29b83909905b088, 0x407d5a36960174bd, 0xcfd37709284e4b2e, 0x4d35e487425a1a1c
+, 0xdb57816b6d8fda8d, 0x1a6c3934d90b4775, 0xfba10557539a9211, 0x76b7a8222c94a258, 0xd998289f0c1b0d40, 0x4daeadfd54889836, 0x3e4ffaa3c41ccebf, 0x2678dae36fd85015, 0x8a62a4171da8d441, 0x617bc25db19d7a10, 0x349dfc7a4cc871fb, 0x6905bd6b1b401eaa
+, 0xec703dc4a18afd65, 0x51445bdefd85841e, 0xfef10cc54865d5f6, 0x49c728ada5980d27, 0x337acd6609fe8c5a, 0x1eefa1c9552d47b6, 0x52db9578067730d8, 0x5088e94436501510, 0x4a7c68b5f0db12b0, 0x5c2e22852148f285, 0x44c289a12d250505, 0x3c591027a39e50c7
+, 0xe6b701f303435e4e, 0x0879361cb07067e2, 0x8ecb44739014913d, 0x04a1a59c55e176fb, 0xbf5ba54a9109deb7, 0x5b9f7e5d568d1f7c, 0x2f4fb46173ebf908, 0x7b4da47074219fa5, 0x0975b730836dfe78, 0x377de2c305ace835, 0xe417dd8bd81e74a8, 0x61d830ab3e6d071a
+, 0x8ddd502e23c68412, 0x66bfea2d679a974d, 0x4e323daa01debae6, 0x119aa5f2639701d8, 0x698cb347e88ae696, 0x5cd25a13a18d5fae, 0x4bf6535385981c4f, 0x7fb3a99b56a2ca1f, 0x8c0493dd55355365, 0x1bff638835bb6440, 0x84f3b833ead7f5dc, 0x7aca0be0f2391747
+, 0x49bab8aa99f0b918, 0x6bc5ccfc23858d0f, 0xb4eb2df7188031ae, 0x558bb2dd13cf7675, 0x736b095e8472a1f9, 0x6a127bdc781c4afb, 0x47db658b05f13c67, 0x53e11d8db326c03e, 0x9bf65abe1c313925, 0x3e8a8951801e0be7, 0x3d41f21eafa56a21, 0x158bc7708bd888b5
+, 0xeb25f6e25f96f562, 0x2fcd0682cec84e9a, 0xe15a00cc602c0a38, 0x1ed2c53052462163, 0x93ced87564888b08, 0x0fe1cd21b68bbf6d, 0xf0f7f7541d166f2d, 0x6bc214d0270a9ab8, 0x5896db0ee2fd5011, 0x2df49bd565eb265e, 0xa763c09d34c194ee, 0x49c864a686c5f9bf
+, 0xd1435015bc8f1043, 0x707432669b448844, 0xe07eb24a3bb0c957, 0x00f13ae505adde33, 0xcefb80c57679a5b3, 0x03a226f14e9d2758, 0x016ea1c60d3e4162, 0x69635bd773314114, 0x6648e8cdd8055418, 0x1de89a1aa0bd8af8, 0x35b26a40befae1c1, 0x2e15449288dacf9e
+, 0x42f62a7fb2af4a3e, 0x19ca7cdb035ea646, 0xa499cd0a091db61d, 0x200e71a5fafb23ae, 0x030dab3c2ee90373, 0x6e39198f5a107472, 0x5e68cf45f1db2c03, 0x5a2b1ec45c16d42d, 0x61cf487f6cf3410d, 0x4f58b1c105f9eb31, 0x541aab97f7101ce8, 0x1aea2a539edb653f
+, 0x9a83eeb504cfaf52, 0x5b7a9d76975ef0d8, 0x8b56b70c1e68aae5, 0x46dcda9b3c75caab, 0xda49f58b890ecb18, 0x2877c3b33c773dcf, 0x01f456f51c1fc6f8, 0x2e82ee03cdd63052, 0xb869ddb294d7cca5, 0x0582dff7238b0664, 0x183c59996a21adbc, 0x790c9d91df40c90b
+, 0x5ba801403327965b, 0x3b7b171522949f41, 0x19fa67179c326395, 0x190c86c244587383, 0x87f36c7da87b80ee, 0x6c79b5604c1dba0f, 0x30dc913f91966b19, 0x45378e91ca77ee6c, 0x75383d408fb64c6e, 0x3f397cbc2146dd17, 0x562f6e5420ee8891, 0x00002c81bbc8f248
+, 0x788c9a6bbd6ca95a, 0x066f7baeebb106c3, 0xba37112ab1987a72, 0x1d54fad6b84bb8aa, 0x30809fff4601a139, 0x26ee140e988a2a12, 0x07acd1fb3ca8a000, 0x3bd25de51faeda77, 0xc72f80b6a2a01b2f, 0x6a014bac1a968b58, 0x5dab0d09133f5b30, 0x1d4b3d0ce8c10e46
+, 0xff79361f5643f306, 0x40e9581f112b2eb3, 0x73c5b5ef5796af6a, 0x3cce49736b765c9f, 0x4e200a963df97efa, 0x3cceab97e55b83f4, 0x299c161bfe39fe09, 0x52974cbe6d49d2fd, 0x6d77b941b6d140ad, 0x1893f6c9427c3ea4, 0x067f5eab6206e0d9, 0x2970213f607e701f
+, 0xba56ec49c034cea1, 0x3ade15e5efdaa3ef, 0xe193cad96c35205e, 0x3c9be3522904e5d2, 0x33120b24e7866faa, 0x5aa9d1a03e77aed3, 0x30065a41291607c8, 0x3af4d6566dbfdc95, 0x745755cbe59b26e7, 0x206ef1d343908566, 0xb26e140efea5c75d, 0x32b3a39e34c55f89
+, 0x46874b95cf542d9d, 0x62c4b4e8331befce, 0x50170202ae61091d, 0x46c22d7d957fc262, 0x3407c71b440bc4ab, 0x01cc306c49ab81e9, 0xc6045ebac39a80a3, 0x4abf8762e95a3a8f, 0xea32e872d41b286c, 0x388d10db51fb77a4, 0x7bdaa0aa9ddb9520, 0x4d8445501ca98742
+, 0x5b1f63319488ba79, 0x2e3d0152fefc0cf5, 0x8d0fdd2237f24f7d, 0x651d52f5453bfcf0, 0x01771353bfc81b79, 0x75d26300610c460a, 0xec22d1b5293fa521, 0x4d743ed89525bb04, 0x01f54f765eba716e, 0x06822d3c5a75bf07, 0xbd133a7f293223e9, 0x67e0efc8acca0d3e
+, 0xee4d63cf48c32816, 0x6ad8f4038e708083, 0x7c08ef874d58d225, 0x29262b1ea6c1c45c, 0xc995d63ad31595ef, 0x3ca7ec6e051b7c73, 0x5080f47f65efe225, 0x7f9c9197fcac82df, 0x1485569363abc5d9, 0x2b776b0c30aae676, 0xcfae454e9a777910, 0x53aabf2392f41609
+, 0x70aeeebab15ac3b8, 0x12db4025c37995e6, 0x156a0ad3a531452b, 0x4830b82c1a7ac841, 0x0e968aa9b2f29b20, 0x12414316af117a54, 0x1691849998a92a69, 0x6d030b30d5b70357, 0xf96aee24ba34bbd7, 0x7d2a3c9bc2a8add5, 0x54f962067f7e6a27, 0x0f6f8abcb275e9c3
+, 0x4a9380082a18ef1a, 0x3c7cef481049cc7c, 0xbde5db3d9005ff77, 0x1585a49b4787e913, 0xcde8d4cc091462f4, 0x49b41def9d7558ef, 0xec4631430a59ce69, 0x1809e8170ac8d1eb, 0x2645ca2528812724, 0x0f6d66db0f5bbb29, 0xcb56bb169d418885, 0x2fc2c2516ec978f9
+, 0xe2be1f379b77b76b, 0x6a1ad60786522838, 0x3a465cec337dfec2, 0x0aced866159cac63, 0x55892ca156b93a8f, 0x7609bc9dbfa5c4fb, 0x0c0a7bf360825632, 0x6600fe04e92893cf, 0xde98ef0b27c3a798, 0x76aa29093e7cfa44, 0x20940c1cd771524b, 0x5f2d8d20c6ec613d
+, 0xf6e5faf499261c1e, 0x0fe22fd7e31789f2, 0x372f13933c2a8f90, 0x50b91cb90fd75f65, 0x74600d6a77c5735f, 0x7c01ddabb824579b, 0xa52a74b26ec8646d, 0x09b6a6cf11639b57, 0xb80de55eb15ab62a, 0x711fbe85b4e88371, 0x86d293c9d84d4b03, 0x6ee3b44346a9f9b3
+, 0x00810300bae6218b, 0x6503e41fe16461de, 0x7eb38e13b02c2d35, 0x517d1d2e5cc302fa, 0xd21a73bd618aecfa, 0x789ed17a4abc36cb, 0x9a6b3296148b93f5, 0x438cccfeead62892, 0x56bb972fd07f047b, 0x0df2d2f5a000d3bb, 0x9e63c21f783bf7d2, 0x1696c0c5771bd841
+, 0xb085fa80a9783bbc, 0x2bad215c51aeb24e, 0xc860ce5028b473e2, 0x7c9ad4146b2cd3ae, 0x24e33842c35b7cb4, 0x6deca7e9462e98df, 0xcaf6d0fad00096b3, 0x0cdcdde5bceeb3be, 0x5bf1e5fdc779cfab, 0x30a04460cece8f69, 0xc9f1a20520ab24dc, 0x308510e647010e34
+, 0x9c6acf29c7da97a3, 0x5152d8da0501b120, 0xb09053d0124468a9, 0x092857d386dc71b9, 0x3976b51183f0c633, 0x7baa48a54ef95f43, 0x89abfee359e83a1a, 0x615684d30b9457a1, 0x18dae4319cc95ece, 0x6070bc29ea5fcb21, 0x86cf7ede002893a5, 0x35908b8b94602b66
+, 0x3fcd566008b2610f, 0x6b74191b2e58b854, 0x93aca8af55e11979, 0x6777762ca8baa1f8, 0xb68bcb315eb84447, 0x5c9817ef07cdc9c0, 0xeabd961aeed8e388, 0x2d17e136012f695e, 0x008684a9cb36b505, 0x600642d1b4d498c1, 0x8feedd48aeb4dadb, 0x02da33195ad0a8d7
+, 0x87cdc894bf4180ee, 0x60a3be9571e9c852, 0x576317f480212b54, 0x3e562789e115a815, 0x45394dd5b7d4a168, 0x25fa654bd8932fc6, 0x9f20307e63811c63, 0x770835c3aee426f7, 0x0827f877582ac01c, 0x3ecb2654ef37e607, 0xeb159ef6ac9217e4, 0x66a109a77867bad4
+, 0xaf19a4d7feba8673, 0x67a797f4748aac0c, 0xb82bb7452a6951ec, 0x1c616706fe0db38a, 0x48af8a57bec2c44d, 0x197b24d0700c1c7c, 0xac6743dd62235012, 0x2b1b0df27160e44c, 0x7bb86da6b9190ef9, 0x1c8660cfdaebb418, 0x36cdb788d7c41589, 0x43cc5e7e9e1f56cc
+, 0xd5eb0b5567cf24d3, 0x7042e0bf9ab8f2ba, 0xe537a85cb0538938, 0x61bb218b1889faf1, 0xf8aaded55ec94246, 0x5a2468371996c4f0, 0x1f8a58f234696aad, 0x12ae8051d9d0466f, 0x0df3d2eb80b9ca9a, 0x6fb459d6df8e68c7, 0x99bef5564e55c6db, 0x6b816895ca45d97d
+, 0x7224f204209e3990, 0x73a4ad08475d95f2, 0x7dd3eac700df469c, 0x4b3efc48cd789e25, 0x03a230035ea7e5f7, 0x6353737ad4ee2b3f, 0x9e5dca22923bbb81, 0x2e718a4375340a2d, 0xb327af6b974a4225, 0x229a04a73c017819, 0xc87d486b1f5d7f7b, 0x314a16180ad90d20
+, 0x5da14aea4886dd15, 0x6db6e4fd2d61aaa1, 0x4ac645819c181714, 0x45d3204645d1f3f7, 0xf3c8485f2ff60f30, 0x4cfee181f03db1e4, 0x505a38a350675769, 0x3837eb397be34e87, 0xf18e990fb55187ec, 0x52f6957efb4266f0, 0xcaad417d2312afd5, 0x59a4926deb61a387
+, 0x3c472237073507e7, 0x722a4a71d5d894fa, 0x93d0ee448e4cd77a, 0x49159aaf54263f0e, 0xcb2a7e4320e53d96, 0x48731b3837f6195c, 0x1ee464e1e122276d, 0x3f2a0d44926c3578, 0x21613d1d7f9d8f33, 0x264c874336edb2d4, 0xa0ab1f004b7fb62c, 0x72591ea2b42e9b57
+, 0xbeaa76158c88f624, 0x7f27a24329ff5554, 0x7d9153d65e9c5392, 0x3dc8d27c09003a12, 0x5bc9e0fc49e8b02e, 0x7c88e0e891eb2298, 0x3864b34c93a9885d, 0x3dc8625ba1aa0a93, 0x793c5b3b07e7fa14, 0x44fa7319e75970a9, 0xfe906f67614c49d8, 0x7a3111a1d675db7f
+, 0x75fe11d33a603748, 0x579e7cfff0d5085d, 0xf5f3da8ecda66197, 0x32e10996b3e183fd, 0x8ec1626811bc48cf, 0x5f5a16d34a0bc85a, 0xe1f41a88fed98f3a, 0x01f4b0de0c87cdaf, 0x225eef97b21c6c3a, 0x20b17a5d78fef4eb, 0x9e2243514916684a, 0x1d6eac35f2c46e26
+, 0x731e8192de7187cd, 0x35507e85b679ff60, 0xdc265988219c1d3f, 0x72379195079a0ebb, 0xcc588496788c41c4, 0x3229fad6f10a0e90, 0xc2ab918b061ee976, 0x58380629f20f9c9c, 0xc3c73fcb0ac6ae39, 0x0fe1fc433d5bfdb7, 0x8feda29771dc2777, 0x4501237d79ca266d
+, 0x241423a615f743cc, 0x4a56c0bb93c771b6, 0x019fc752f884f893, 0x537b3793d10cae43, 0x796f0248b125d258, 0x53889cb372aea329, 0xb33cb8b62d1e721b, 0x43e79a80c105a995, 0x61af968a3853b8e8, 0x46ba633f1e440c36, 0x6daf60823732573d, 0x0b1e2d2029d578d3
+, 0x8500820e097b56f5, 0x7ea1efc0c7ba763d, 0x9b9c1be099dfcdcb, 0x16fa3dffa995a191, 0x0842cce8cce7a92c, 0x6ac83092e1ac758f, 0x8b4a1a3feccef2ce, 0x796b7d5dcfc52b76, 0x9347b745a981dd31, 0x4cf3daabf42d6e33, 0x871f4160708f71ed, 0x5bf4107f4579ac79
+, 0xd02b7e49c803a246, 0x30df87470507b30f, 0x8dbea98c95389389, 0x1f8dcb1a6e4dd1b5, 0x1f4717e47658af91, 0x6a4f6a62b955fe63, 0x57f6b10390f047ae, 0x32f34d0c718b7df6, 0x2c451023063220b0, 0x4f56f8107082c8ec, 0xbee949c03f89b643, 0x7b53a2118ab0ab26
+, 0x12e2b13ab18eb5a6, 0x33c33b3b802384c5, 0xeac3828c5e9f4f7b, 0x1e3b037dbcd0be26, 0xb5cdb5bed7882139, 0x19e7d277c2b541d7, 0x6d36f80d10063c73, 0x4aad0eddb937a1d2, 0x84d9afdf6e13a433, 0x046799cdb87a5efc, 0xd5a5887015e0a3c2, 0x34b735a47ef5b457
+, 0xb5b459ab7a441cf9, 0x1e28287f3883eacd, 0x02f315a4e18fa7f1, 0x062f57b61f5cec0e, 0x9fa9d8fcae93d6ea, 0x5d226c5e77ae96a0, 0xb7117ee3fe85b4f0, 0x45b476aebd47ee14, 0x99ff7ba3b4273ed5, 0x6295b32cf7badbeb, 0x9a8758f0450d9449, 0x4e568b099f537686
+, 0x1c5ae7125060b966, 0x0342729752baecae, 0x197c31d23e82e6f1, 0x44de2938e9adafca, 0x35c8405fbae4d5d2, 0x6a94424184fe28bc, 0x29cc0dee36cf754e, 0x3daf2264d8c024f9, 0x5c311ddb92184891, 0x3dad6f7840bd2745, 0x44681ff2a54050d0, 0x060405b3b8afc13a
+, 0x9d6ae9a041f538c3, 0x2a3297403228fd7b, 0x45b48e0b14ab60cf, 0x543e912ff06681ea, 0x1e20ac4795aa004f, 0x7fc45bf950a068a6, 0xe39673872c703c9a, 0x2275975c1b0d3179, 0xb4ec587ebbdecb46, 0x1b85c2a9243844df, 0xc36e025fed6c4061, 0x48755eaae3b4b4f3
+, 0x5890a413bee5b19f, 0x1f036790f2225dc4, 0x58ff30a1140bb0a2, 0x34aafa4841f4329b, 0xe70cdbc460ddd454, 0x1c6a30b320820543, 0x1d74640ac82e7f53, 0x7248dd98d1764b4a, 0xd465ffe8fdfd32d5, 0x57ae832791a83d45, 0x849e08ecd32a9b69, 0x55bf69d6a20676ed
+, 0x132f26b7c58405f1, 0x66f6f76039407bae, 0x0cfa977088063a00, 0x6e4aa4cbcfc51f26, 0x9f15ac365ed8b10c, 0x3214bfc16b93d8e6, 0xf267d4feebc709aa, 0x4369575b5998db3a, 0x910bf2bf21b39292, 0x3d8b6c022393d22a, 0x319ca474158340c9, 0x02a1c5878e71f0c9
+, 0xae33d2ca9ffd8229, 0x43ebbcfea7bca640, 0x0d860b526182622b, 0x783ab44d1b45ed25, 0x60014dd9d6015841, 0x488d3e6bae0bca4c, 0x0102fef4cd17744f, 0x32a77c2b4d18eb0d, 0xea24e2d83b1caa60, 0x7b3d9db64d1c5a98, 0x64142f5f1f72f76e, 0x5ce0e13342fb558e
+, 0xa861185b6260fd98, 0x125d9573e6152576, 0x48ac23e0995fb864, 0x25c6f17ad912a296, 0x4479f8cee8a0c5b7, 0x4259557380afdf37, 0x0a90d9aeeb58fb73, 0x672f4e5e796b135a, 0x5e4077b0610d715e, 0x1f1385f9d252c0bf, 0x97778753d4be8810, 0x32068a87258f6811
+, 0x00faf668c760069b, 0x1a1fd835bad97faa, 0xd14792432a2e5ee5, 0x376212c14a7fe327, 0x2ff963463ac5f0ed, 0x233c0abc7efcc830, 0xe0b7e08d931bb898, 0x3c40391a6888047d, 0x69e341c8bed96e54, 0x25031aa28ed5356c, 0xc173326d55f65036, 0x4c610569213d9736
+, 0x842849ae058e52da, 0x292fb002820a6d59, 0xc740c0bf702b9f8b, 0x29b0d8a9aa2c3fb8, 0xc16591901ed7c468, 0x6cc37aa0c1ae536e, 0xe4f3289eb39c2f1b, 0x3c34277cb7ce47db, 0x3b8c63ffb70abe50, 0x781c56acca6a6dc0, 0x8cfe078ae6c61996, 0x329779ec324b06bc
+, 0x2f9b03322393397f, 0x389fd01efe282e02, 0xa93a133ba4b1432d, 0x482cc10cc88b8eb8, 0x89efc30486ce4628, 0x29b166f4a3e10cec, 0x57e94b4a93398254, 0x6cc930a3b05df0ff, 0x2722be99af436b19, 0x574db5e823bd1a0d, 0xae2def0e4e7e5a51, 0x2d68a598b464ddd4
+, 0x589c90c9e8d3f080, 0x499d4a880ea9c118, 0x6dcbaa967347b388, 0x71930058cb0ec76e, 0x26befb61a134be1b, 0x49a50370cff3a243, 0x8fbe896c4902194c, 0x441a6e8af211f709, 0xec444eadeeaa80c7, 0x7c3cad59f254cbfc, 0x83b740ae015bb8d5, 0x7eaf920c386c6ef8
+, 0xae4b68c4a4d1bed7, 0x2c564dfca40ebb3b, 0x0658b960771b95c4, 0x2ce323a2278e38c7, 0x0b85186c6aed97af, 0x68407105ed8ee906, 0xe2472a766ae05c9c, 0x07328239b1e61b3a, 0x19d886ec9db3640b, 0x6984b31b635282fe, 0xf69c6903a5fc2ce8, 0x6c93d1c9be5b3232
+, 0x458b43ebc1fb2305, 0x29f94152a979bb65, 0xdfcec20ddc8408c7, 0x1a98adf9f2ca9fd1, 0xee1be6fbd0c96f96, 0x27cc2860e7d00415, 0x5261ebc0885e8f3b, 0x6571abd006632df0, 0x93190d2f608d0ee7, 0x2846c4f045b27da7, 0x778df4efc2cda830, 0x32a6e57da2900db1
+, 0x3f105ecf7e916e83, 0x1cd9f0bf8d454b72, 0xa486d58440c00548, 0x7b2fd432732f88fb, 0x95f9195a4ca4666b, 0x204e3cc5874bb889, 0xc6547cb50f17cfae, 0x18725a9b2c5988c3, 0xc03c51159faf238b, 0x4b7ff90de1371763, 0x2564a2c7abd9a4c2, 0x0dce8a2bb16bc002
+, 0x88c516efe4ba4a34, 0x646f08641634ea8f, 0x5ff5231a1d79a256, 0x357b117a3d0909dc, 0x0d48fc43361b72af, 0x30dc381e92d33a3c, 0xc42c709c678b3fb9, 0x6d1526d14c2ddf50, 0x322ed0744f574564, 0x4b87d777373e531b, 0x3c12860b3444a0ad, 0x5f9b7c5be14f0534
+, 0x007e406615ce3c9f, 0x261582d43727da6d, 0x56ca78adb82ab999, 0x433745fc35f092a3, 0x3592a22be91194b7, 0x6ab5326b916b3dc2, 0xd393502ca93b13e4, 0x6f980d8de9b0d24c, 0x2302f27531d6a555, 0x44902a39177eb376, 0x597e39104c4aa393, 0x4bde047614a39dbd
+, 0xdadc4194db2eab5c, 0x475811d1865af670, 0x0ca68a6d8771fb09, 0x134d25d45d82a27d, 0xc052dceaf09e9091, 0x7dd04272a92b4961, 0x280d781467074951, 0x3edf58e5f52306b9, 0xc23ca6fd2ca85202, 0x37816cad99b32fe0, 0x103449085c1a3b0a, 0x37cb2950fb846154
+, 0xe2b0b3a89a61b1f0, 0x5541bf86e862930f, 0xed9e8256c3c6166a, 0x1299639976e32a9d, 0xa1829bb88064698a, 0x66a343edbf25352b, 0xf16d42aee184a754, 0x27405481a33243ed, 0x21f46c850d2de4a3, 0x62b663c7b8bf72c2, 0xa9c289b6253b85ba, 0x2282ed0a174b94d4
+, 0xab52504f0621d6a0, 0x337a63a4f1281943, 0x605bbd8917923f8b, 0x4148e907401bcc18, 0xf34acd47db4c4e8a, 0x7301ae6e2dbe3c05, 0xf7f73d820b712e44, 0x52ebb0d2dd3c617e, 0xa1ad771315d5fe23, 0x49e60e548ca709b9, 0x18e721fd7fa4b558, 0x0823c6e51d9fed77
+, 0x96e882b3593f9f08, 0x492958e8eadd415c, 0xa010fef68464ec4b, 0x5355bb37ec36ec2a, 0x9be17a876d558232, 0x49e5556f96fb17ec, 0xf03437f771266c99, 0x392494a0c5209c9b, 0x374eeb2389793433, 0x7ca5a4b80f479e4c, 0x1d92a80f6a8efc25, 0x4403ebdfce6f68a2
+, 0x61355b47803d1b70, 0x2799f472aba1972c, 0xc8e7caec1fd7f806, 0x4360b910aa414cab, 0xea256db86db964d6, 0x1c203fb57ddd7387, 0xe2f3f2c5e267b6c8, 0x3f03167fd2f63dae, 0xc88954551c4e0563, 0x2cce6999e2deec28, 0xef4d242ef2aeefa3, 0x7ae7496f0c3a4ee4
+, 0x92de402daccd7272, 0x5adb58de9864b294, 0x92dd23906105bcb8, 0x08e6073168151b17, 0x6d29a4263abbed3e, 0x1dcf825ae6ac8baa, 0x9f3b93341be6bc27, 0x5697bcbedeae914d, 0x06585ffa8aaf2d80, 0x247e92d88be7fb9f, 0x07eb741708320140, 0x1d99146cf7c80b1b
+, 0x01a8f6c2a6fd11ed, 0x79cad09c7474c382, 0x66758678918da960, 0x14b36f79ff068286, 0xfa644439ac6ef252, 0x563e532cf4915430, 0x15096fc9278e5e9b, 0x36041e69001dd45e, 0x71802bd64aff317b, 0x21a4215baf1b58fd, 0xbb53317a2c62e67f, 0x03cc661435a36685
+, 0x545774c98e259e9a, 0x76ce27e3edc46bb3, 0xf1a14681fa0037db, 0x27fdf568a02800c3, 0xb2d7967f8ddfa33b, 0x1bd56f8203928e03, 0xa7cf75ebdfbeb31c, 0x38877a75c97cd183, 0xa81b16d4909ff0ee, 0x41e472951af98831, 0x93d1e5a4643e8c69, 0x314ced4ca244d526
+, 0x8c052a260f715f10, 0x7a16e8872f656834, 0xef4735cc23b66c60, 0x469f0cd3255e38d8, 0x2256cfb0150b5880, 0x6439b909f2f6a1fe, 0x33a9d008aa05951b, 0x671cefb5293c7639, 0x213ae15d396c83e6, 0x20df0207632b3f22, 0xda789650371f7197, 0x462bc8ad4b9ba246
+, 0xd1bb6606e6832bf7, 0x776babbea22319a0, 0xb0b57c305b00df2c, 0x2fb285324f4a7e62, 0x45b20bd81dc80f7f, 0x01abcb8fea3686a7, 0x46d2279f6d80274f, 0x39997f0fdb97a7ec, 0xa00e91d0cab0de22, 0x284aebbe35e328f3, 0x23c085cb1519751d, 0x1159307ae77ea6e0
+, 0xeb449f4acaf7127f, 0x134187a06ededa5c, 0x74635e62f987c46b, 0x481dae0b784dd283, 0x8a798868aacb0563, 0x663964b6756dd91f, 0x3277ee3e51800437, 0x4e454b000a3b8899, 0xdf18672e5c6f48f5, 0x54c83e491bd98422, 0xd3e7742fc10bfe81, 0x13e45a392b8cfb65
+, 0xf477a41142a4ea5f, 0x61fb9f33ef134a4b, 0x4b977f61663b28a3, 0x39c6a2654323fb55, 0x9b851a5b36da66d8, 0x16820bcebe472f8c, 0x517106d277e40d9c, 0x70c07eb3a145aafd, 0x2d0a8ac7f59d93c5, 0x6dbe72728f1ac57c, 0xfe08a02ad79d57f0, 0x0e00731fda39a556
+, 0xc368bcb5ea6c952a, 0x7e48a47854611c57, 0x53d6f69354fa27ca, 0x5615ebc19b25cd3f, 0x80699c149794344e, 0x33bc6234ccc2e859, 0x86cda6e62d0fb3b4, 0x0564179de8ff0f8f, 0x1dd69ce903ef167f, 0x47a0af46ac21ca8c, 0x420331d1f6f64dac, 0x781cac7629a23012
+, 0x280119cafe7ded6e, 0x1e30f0fb118028ff, 0x910e449268f62a04, 0x2f74f9b5896d5522, 0x24d09ca844d0ea4c, 0x7af82974f4042259, 0x267cfc656b1b2dac, 0x2423db0c2dc33759, 0x02b4aa1a33d10917, 0x4cd9adb38880bc8c, 0x11f57e8ad2a105f2, 0x37eaee28befa3285
+, 0xd7d765f586c08153, 0x136431e3fc80ec44, 0x9bc78340c43b30ac, 0x13112e2633ecd679, 0x7dc210f87d035d8c, 0x680cb2e837953448, 0x02d5ca01bb682ea5, 0x360fe989d4f7ff67, 0x68248e226bff44fc, 0x5d72d2137df3824f, 0x49f2168bd1db8837, 0x1a00ec9b899516c9
+, 0xc609b3deefad7732, 0x3e7d508ab1c132a5, 0xdfd83095cc077ac0, 0x5fd117e31239ef7d, 0x0a6204d43188f396, 0x283bc2aa230237e5, 0xd52608466e2e4c16, 0x1b2aa800ba830eaa, 0xca209c98ecb4bd05, 0x3ef62929921a564c, 0x3fe3f2faabd9134c, 0x1e79e90c926cb253
+, 0xcb62b210daf9d4b2, 0x6bb659ac8339f30b, 0x6e8ab58b10eeab36, 0x0accd16d4cc9cc9d, 0x181865fb35a381e7, 0x3b5bece12105afdd, 0xc7bf845cb2180cc5, 0x581fdc067b88297f, 0xdbf0f30039e87144, 0x1f15fc3d5ab60ebe, 0xbbe869335da30c21, 0x11d3b173130d9263
+, 0x19de9b3bac21930c, 0x702c218e67400ba1, 0xaa80cf2ece3fec61, 0x658b3969f25295ad, 0xee1ce2c85fbafb61, 0x181e8e650ff59a8a, 0x7dd6f2b275cdc45c, 0x188658becc625bc1, 0x61d61c44c395d2c3, 0x42ff502a4b9c6bc2, 0x0308c0ca164c95e8, 0x4a92aecced1b1661
+, 0xc315f41662cb040e, 0x5b1f019861e0fdfb, 0xd6e109e6c8b94160, 0x53844a7bbad50b2f, 0xac33bef836ff2dcc, 0x78852ed1e3b114c8, 0x32bfb7283c5e8a65, 0x184535c14c2f1569, 0x35f3b492f7d537ed, 0x1508533559671f85, 0x221eccf01c91567c, 0x2ff28303f23e646d
+, 0x83c813849dfee4fa, 0x1593fa7f1f450ea5, 0xe2cb89bc47df395f, 0x07e9cf55344de041, 0x71c6aeeac269c436, 0x51f2af9a584f7fd4, 0xb34d286a027396bc, 0x6622b6906daa0882, 0xe6fb3b872a8b03bc, 0x41bb0c8c58a29715, 0x3c541c3cb6c31712, 0x22274f2252858074
+, 0x6a44ee95ae7a0881, 0x58ed52fc0688c48c, 0xe3999d97a324e2a3, 0x410ce01cbf2d877d, 0x494f17a13d312b00, 0x66b44591ae3bc186, 0x3c0ef6b14e5eb433, 0x66f77066e5b5de70, 0x40570f3971f8fb7c, 0x383fb7ea9cd70f44, 0x3114d9f7d91ced69, 0x719b9b9245188fbe
+, 0x842b16f9a45c5628, 0x30ec22f063de418c, 0xb3e738726018ed42, 0x5139bb60083ec53d, 0x179b97e1e263b7e4, 0x742fed0131c210bb, 0xb4dcc1e85df16c0f, 0x71d0ed79f9f388fa, 0xad2b4855db0cbe23, 0x6b4c65d766f19677, 0x8dfb97a9a4735e35, 0x17d44a23a25e83bb
+, 0x2fef8c1c1db3a02e, 0x6ce326378054016b, 0xf8d78a1e98e70216, 0x59c9b6b34fde5c02, 0xfdf6cd44cb1b54af, 0x1c5837f1ca94e395, 0xc065bc81b9567d42, 0x6a1fa86114cd3a0c, 0xa4daf26ec762e96b, 0x02bde09464268780, 0xf084306541b1115b, 0x695c48900720f329
+, 0xc87102708121f03f, 0x0680c508d0c49aac, 0xf777b45d970cd126, 0x358a351b24c957ef, 0x195c686757868248, 0x669fe7a281f745f2, 0x994b55cc26b9c6b0, 0x694bebbea0ae9f5e, 0x7fc4e6ace46b1fa5, 0x4546c61985b0805a, 0x5b9bd1bb135f48a9, 0x36d998639d17c88a
+, 0x7ed73963247c57ed, 0x088ddf4cff081373, 0x931df2efe14f42ff, 0x1e74e1f700d96637, 0x003a79d883108cef, 0x3ce23993c414f6de, 0x55a73bfe6def6803, 0x057d40b6a7fbae53, 0x8d97d9304c923e74, 0x2f70eae6d6f1891a, 0x8c8c50d35551d062, 0x11e987a7353d1051
+, 0x46f5f8c37016b7df, 0x64cd8ccc84a73edd, 0x333cc887169ae55c, 0x073ea8ed8efbdde5, 0x78d96b42dd24e223, 0x6e1ae6fd70f5732e, 0x03c51a1bb469f7a5, 0x40625fe412d30b1d, 0x492ba623e3c8cc1c, 0x7b51d2f0077320d0, 0xaff94f3fb7e9b133, 0x0116d5e458d887ab
+, 0x286e3907c5bcb3cf, 0x33fa235bdaa7c8ca, 0x167f907f99e85e65, 0x46ad6681b0224ea1, 0xcd64390377dfebbb, 0x16a52762e940528c, 0x7f1b7e34d946d0b5, 0x11e813cc834e391d, 0x49a2ab9f15168426, 0x7a02065c201e1b56, 0x318fb1bf436e3c9b, 0x7727973123a3b011
+, 0x5a94fdec4a4d1126, 0x7a96fb21490bfa62, 0x37abe08c98d71e96, 0x374e4aa7bae2e4c7, 0x6711d5ecc5e2c40c, 0x5fd9ee02ccc8f1d1, 0x40b232166497bc13, 0x66d18ea214de2412, 0x8ee5d53b83057335, 0x6648e5ae06982b8a, 0x40bc489d50dd9e84, 0x7b8bfc7d631286d3
+, 0x6d61b4fa09de61f1, 0x6c1d9162535b3e73, 0x33f7305464d7dab8, 0x033ba6588cc5ac88, 0xc9fc2de8062c3495, 0x083719fa2d55e476, 0x5c9dcb0545e257a8, 0x2a995bac8670099b, 0x390f63ba6260f7fd, 0x30c5905487e7cc37, 0x33cb9dca4c46c711, 0x1593bba625fcf320
+, 0x6e0b7a9ea5fd68c3, 0x77d6e73485a7d348, 0xfb52b180deabc8f3, 0x1b59a838b01932eb, 0x9a043bf87c81e131, 0x44b83537824e02c0, 0x2719f182596a633f, 0x2b058b010d62cbb8, 0xcb96ce0332721c5e, 0x059de49a81595984, 0xff99e0c8d2b4f467, 0x71d3b8edd646bdf8
+, 0xaa24b5071e0c6ccf, 0x3d4bd34835997506, 0x02d854f776e7315f, 0x71ce067e232d7b78, 0xce7c8fbac5f13a51, 0x3f3752f7aa7509a2, 0x3b951da46abe9cb0, 0x65bd06049aca980d, 0xc57973b29b21ac17, 0x524ae9970ad33f29, 0xb5a999c95ab5a0d2, 0x4c7fd092e99e025b
+, 0x1b90bea27d987759, 0x66c97bf332efd372, 0x9b0d9a20c4826947, 0x493ecb22a7e31120, 0x59aa9937383512d0, 0x35d39623205b2272, 0x129b41834ae8117e, 0x048cb26b0f657dde, 0x1f125fd89f2ccba0, 0x78b56e52727cd7e0, 0x157ad7417208fc09, 0x3786647405b609ed
+, 0x09f85b1fc01e9e30, 0x37d9b12258757712, 0xf438b175dcca42be, 0x2fcf30e25c7ebed4, 0x15632eac1b3d50b1, 0x18fe8c6ea570df61, 0x182839f4bf392d5e, 0x56afe086dca48014, 0xef7b9eba89c680ca, 0x7c15fdd30e252303, 0x993d06d2f91c780d, 0x67ff7322bc21b8bf
+, 0x0b4678cd9d516a2f, 0x3ae07276cf2cc77d, 0xa5a1cc755dc78b88, 0x52cb3f7a628c4b02, 0xaa98ed5f22aef05e, 0x428f797a6c6aefa1, 0xc471b9709de928fd, 0x60bde12e364742d7, 0xf44c5b97b32c5544, 0x0c9ee19bbbb473db, 0xc981ba9edebcb192, 0x5fa17012ffc9427e
+, 0x5521ec5aa95b90cb, 0x64efc58ae017028a, 0xfdad7cb89be470bb, 0x50a28c80f3dd92b7, 0xe2e9319ed18cb079, 0x67f2f149f1016124, 0xc35d0edf728151e3, 0x33202b32dad80e0a, 0xb8e949afb73a2030, 0x32c2908a59df7483, 0xa7c69c7020a361f5, 0x1b8f3a1eef0a6dd7
+, 0x46d9e44704acca93, 0x361afec0d39db7aa, 0x5c366147b69a0355, 0x1387f0c7e5a76828, 0x6b6ba0ed25fd2df2, 0x39c0f7319b908b44, 0x89939f83baedf31f, 0x62e7b08820aeb7de, 0x8ce79058ae05b38a, 0x3f12fe63ff1ee166, 0xa8eb5fc574c21c60, 0x508ce0d71e9f4152
+, 0x82f19cb8b1dc463f, 0x103164f7fa84426e, 0x65f3eaf9ae8aa0b6, 0x565ede6f7afe9933, 0xb9cfbb19d68ab411, 0x3576e29396de5ec2, 0x8dcfed863698a4ad, 0x3a2444fdb1713e20, 0x9cbfde00c92c1559, 0x042e38d4e405c24f, 0x78395941487972c5, 0x37d9cb5731701af6
+, 0xcfbf8469b88f49d0, 0x5f938194e705eace, 0x2687fa0f07fbd6a6, 0x64dac2e02ee6ee3c, 0x3fd258c42a036d25, 0x22955448d9188e21, 0x8833f630b4e8594c, 0x68ef359afecf6565, 0x8d8500d031b12624, 0x76b94a25c7cb7b1f, 0x9983f21705f3e4e2, 0x025ffc51bf1404b1
+, 0xc82067bd72e6dd3f, 0x11045f79fe873d85, 0xe68f13f738319af8, 0x31d00540c3361618, 0x5405ef7e5dd29eb9, 0x7865331a6abd9496, 0x2507c91227a99e1b, 0x11542907d39349e6, 0x2dd7922a5d391d06, 0x7418f14b3ad92d9b, 0x6dfca75ffc69638a, 0x2583532a9541dc38
+, 0xb799d78d889672d5, 0x2d5b5d92c7e60d86, 0xa55eec2c49aeea4e, 0x2a49ad14e9bfbf89, 0x852c1f3fe9b88f22, 0x4579f0e31224c267, 0xcb69f507b477a8dd, 0x2ff7f0809c500df8, 0xdc129c21edc30df3, 0x0f5b0732dbc295cf, 0x49c3926deabe796c, 0x69ed04293d286920
+, 0x97fc486d896b3ff1, 0x5b6ce27f82228d01, 0x880b51c00b321ead, 0x5951a403c1899579, 0xb9bc334599c437fb, 0x37c81a047b091032, 0x5f06a548ba205f37, 0x09d91daaab245ae1, 0xdbea9da5aaebf327, 0x1b008db29b5e854e, 0x120f6df0581cf476, 0x2164e803e7818b44
+, 0xee86220f08f55a9a, 0x42206025b76d8ac0, 0x1c5065e713e5e93a, 0x6961353363411b62, 0xce32e59bd7e148d1, 0x68834975f22ad90e, 0xb16cef5f7d66e50d, 0x58fdcc4b27a0a649, 0xcca42aa7733025fe, 0x17232b558a63405f, 0x1a0011c566a21942, 0x3911ee4f0ea38f85
+, 0x8ea8db849ef51a64, 0x61b0891f935714ff, 0x9e8e0fe239bdf1ec, 0x14c739263eac98a6, 0x3db3e91116a784ed, 0x55100bf92bee8488, 0x081f22412c4f934d, 0x2f966fc47cac5686, 0xdf289ceb21db15f6, 0x1248d30c3d53e59b, 0xe53661bebae96167, 0x638cf5540f82fe77
+, 0x9ae4d20977120fe8, 0x3adb21e9e1f86093, 0x8f2bd9a59c4c34c8, 0x2b2bbcf821ad1dbe, 0xc9ab399b7f9b7566, 0x55f9fb9ba329aba9, 0xd245608427efe2f5, 0x620005bcd1d0c093, 0x167cb82d66dbf48c, 0x5869ae0932444eb9, 0x2bf4ce112b4bdb26, 0x26737579eaf9a1a6
+, 0xb28f41c9fbf8816c, 0x018f93b15579eab2, 0x0396e34f0ad68768, 0x304d10b5e90ec700, 0xbeb10ff070cfb80a, 0x1a1b6ee9217111fc, 0x7beea57dd31794ea, 0x7315804da1d21f21, 0x871bd037c451ec88, 0x107f9791348b9474, 0xc05586b2af709a05, 0x3ecbc735b0a832d0
+, 0x128aaf45ee76773a, 0x4b0c4a1af4745424, 0xf6ecf7db756cf48a, 0x611092d43a5c694c, 0x4581ee039b64e375, 0x0a745ace92032fb0, 0x994cb4b1d530847e, 0x5d525f0ea92a38fe, 0x696d26db5b8a0369, 0x7a53fc8ba932f5bd, 0x3d40744322f58211, 0x7488a9bda3d06c72
+, 0x678b9273e40c8dc2, 0x247c871e2b6a677c, 0xa565c16facdfe946, 0x4f45593e54c58234, 0xe5fe6b2e611777b1, 0x0c945d86ba36e822, 0x5eb0aa20f66e3f82, 0x1d51975e7b1212ed, 0x0f65c5d58c2dbdd8, 0x39255588e531f8b8, 0x1f78272e00c80423, 0x75a2b12c6ed7b487
+, 0xe0d34fa043a0540e, 0x60eb17501ea8454b, 0xcea77b50516cfd6c, 0x16a07f714ed1b0ea, 0x8ed30a622fc5d9a6, 0x35d4f36a136d3126, 0xaae4deb1fecb0b4b, 0x70924d461953b71f, 0xd27be9dc928eb8fa, 0x6eb2c76b5fc19cac, 0x32548f2c55c25528, 0x198ac5e13a7f9366
+, 0x2aa0cc00162a5471, 0x4cdf866473ae76b0, 0x7faa840c38e40be0, 0x63c8e2b6f773980b, 0xf66a49d17e705f9d, 0x608726319613f166, 0x366dae3344e5f57c, 0x5e91048845b0298c, 0xae92a61ffb60ce49, 0x426de1be886efd0c, 0x88d93ecccf1730be, 0x6577edc9c0679db1
+, 0x8c71c81a3c39385d, 0x7f515ba381d21c01, 0x28ae1ab1eb148412, 0x17857e1af974b7e6, 0xfde4fc7590061351, 0x57728b0d9ff6987d, 0x9a8ab257c733bf21, 0x7acc0ed5d4e6b26e, 0x79bfc3bc50cc3591, 0x1bbd8189107158e7, 0xa71002071d856e65, 0x53e48f65bc6ee353
+, 0x52f9b166a43860bd, 0x7f4244cf7d192cda, 0xafc63288aea535c7, 0x2a5251565abbfcc9, 0xb4f2ed1dfde9cdd3, 0x6c78d550fa4c3e47, 0x1f4c53927d843eea, 0x05e720a3c7329100, 0xaae7ccac2ef12d1d, 0x11f70fa3d67eb725, 0x34d576ff467c4c3e, 0x2429ebc24e3208c3
+, 0xa1afa7d20fe28bf7, 0x0dff432f535c25e3, 0xdfc49b896ad5c3c4, 0x40231e93fa0cd42e, 0x6c699644e9e431e9, 0x6c619472438e9e57, 0x221ffdcd9b8db7bb, 0x45fe1a5fc0946a4a, 0xd7850d6363a0c771, 0x406a2c7c0de86eb9, 0xd44d9631925a5fe1, 0x5b8a6c77482285ea
+, 0x595b46f9ae13fdac, 0x7d13deaf3c349c22, 0xdb30da41518850c3, 0x0093d975b84023d4, 0xc2a4b28ffa0510cf, 0x6299dd3ee61b5b8a, 0x560393830ba8e14e, 0x11868c4519b08f14, 0x85d93f864bf04cff, 0x57ba72a89034ae85, 0xd2b5607e96196e1d, 0x5119cd347385add8
+, 0x04b2229ca5442431, 0x0627c682a87b24cc, 0x6dc4e4c045db8a16, 0x0d4d8f107bddee26, 0x73911f0b594d07a3, 0x00ed8ead2abc7a3a, 0x4887cd95f6e7309b, 0x058259b06f976af8, 0x2cc8395c94b321ed, 0x5f8e4cea773ccab0, 0x246893a3fe2bff04, 0x385c31acaa7b9791
+, 0x748e81bb0220b118, 0x46a3df6a3b6f7bde, 0xf8915cbfe06239f0, 0x1cd6c8962b6c32dc, 0x0f3bf56b808c298d, 0x196ae2dac18ebef5, 0xd69beaab2958cf5a, 0x75f613e4cb51e844, 0xf2ba46312a2dc823, 0x7ac67225f9d32da6, 0x45e89601e1173fde, 0x3b25b8836281ebfb
+, 0xad313721d747039d, 0x6121d4be4bfb2c7a, 0xa79b52a7b2211a6e, 0x6dc7c65bcd7207fa, 0x62f880ad2bd25c76, 0x4008ae740ce52e52, 0x7f323f01b8b76195, 0x31e1cca337a6e8d4, 0xe9af8bb4a008a1b7, 0x063cd62bdc795d47, 0x4878c39f62decd89, 0x4399035176e68db4
+, 0xb7f5ed45a50df7d0, 0x315a264050a1bd20, 0x14e5d8ad8990082e, 0x5c4f1b002db6ba70, 0xe5789a042b42d872, 0x24d249a269172b9f, 0xe9b9658fc2b17dac, 0x736c821ef83dfee8, 0xc5498f0efd9b3f11, 0x619ca3e68cde3ff4, 0x0d85043b16c9c876, 0x48fa7c23467f01a6
+, 0x7a8fa2c3450e2246, 0x4f6e4512cf714aa3, 0x301df10d66c1025a, 0x134596d04c6e7413, 0xec8cd8fe6ae79a3e, 0x1ac8dff299749c5d, 0xc1432c1debe91a2a, 0x6da2d8a5bbf00e81, 0x92b37fc6a9bc0085, 0x15400ddc69199b94, 0x420fe557bd88feb6, 0x706c6ba94a7a5f0b
+, 0x45c0ccc1c142a513, 0x14a766bfdca2b8d1, 0xf32749cbcd5c5bba, 0x3c57d1ca154b2cc2, 0xaf966333be31a8bc, 0x1652f2fbc41bc1c0, 0xc5607a3a7e7bc7a2, 0x5c8fa4cb4fa4d7cb, 0x2ae14b19270975e0, 0x61da3f5fad8b3ca0, 0xbb73f096aa1f5619, 0x12f8aac12af17fdd
+, 0x56acb708780efc78, 0x3abaccc394667057, 0xe7845af31b5c54ff, 0x75e1addb306c70b6, 0x1564faff6695046c, 0x71f7b24e7d91ef51, 0x88a28fbf4b183e56, 0x79d90d2dd07d6a8e, 0x527dda05357af20a, 0x170651c166867d59, 0xaacebe559745aa42, 0x795fd04a72f4c6f9
+, 0x2c3f7d92058cc6f9, 0x0299c1705a1ca2f9, 0xc0618dad91b20244, 0x0f0ef9ef46496d29, 0x6f1a0fb05c159e0d, 0x66753b87f250ef1a, 0x4aabb9ae22c18923, 0x22eb16a20a52f404, 0xc73d184b43440898, 0x28c8298be6069ff3, 0xf50bbd2bbcae3be7, 0x3d21dd29ad48e8aa
+, 0x5f4aeeb00f79cac2, 0x200ff5104aab4d18, 0x9cb8b3a71572fb83, 0x32f14be4f04a20fb, 0xbc926bbcd22ae67e, 0x5e69660fd99954fe, 0x42292f7c0bc75aa0, 0x3022d17208d7da82, 0x0098ecda52dfc42f, 0x0dd35114d2484d65, 0xa1ef4d5a0a86ec64, 0x03909e6573210ad1
+, 0x49abb10320128a42, 0x6ff66b65366064e2, 0x352bc255c8968b72, 0x482199d0bbc47d6c, 0x3c233cd36c5b9ed1, 0x452bcfa6d53788ba, 0xfb9a5978e0836b93, 0x50fe7a2630d30683, 0xd4a6e39f2f9b60be, 0x5682f61c6f90ad21, 0xc5d2fab83a0f0f15, 0x1c5b043efd1e3c83
+, 0xac45a937c71d0d93, 0x428641510fb5931e, 0xf6700c99ce636b54, 0x567481340bd9309b, 0x95b0bfa6278a8acb, 0x5ea9b2778fb77c6d, 0x0603149efb035102, 0x063fc766372efc69, 0x892bebfa1ed681da, 0x755304ce6fc969d0, 0x9d697508834cbe85, 0x3598b4347698689f
+, 0x4d68c72995c6f117, 0x251599a166022b32, 0x9cd0b8c9e1c0e53a, 0x5a0bf6199967597d, 0x080597784ad8cb82, 0x1088997700fe1aaa, 0x5420160dea77aae5, 0x2ae3d82411b77416, 0x0c13d9c1a53a4fa9, 0x7fe2b7d389b47ed0, 0x90438bb6d289c89e, 0x0a06ca084220faa7
+, 0xb1a21c02d5307ddd, 0x13233c0852a28207, 0x303d11c3b44c7062, 0x4469b34558ab8bbb, 0x41603484f71af44f, 0x4b645e50070bd398, 0x017814a0c4e10eae, 0x2d39c8dafc52905b, 0xb445d07e479458a2, 0x16518c4cade879e6, 0x1435fc930a0e2313, 0x64e9bce9f5c978c2
+, 0x83d00264a180b4b2, 0x6cda02bed7309188, 0xcd5ad9756bd19139, 0x78aafe32dbc89797, 0x6fc2fca3e0a0067f, 0x102907f831d94f3f, 0xa26da5d1cc297812, 0x08141b609c4d75cd, 0xe9bd21955db8620f, 0x33f75d22823e2742, 0x699d7cf7db97a546, 0x70c4c60ff9e90b6a
+, 0x6d99fbb72ab0b96a, 0x598bdc7d2f807bcb, 0xa72a485870f52d40, 0x212d00f58ae48f15, 0x8c7bdfe060ba2cca, 0x4bccbf2b3a749acd, 0xee05b5b487cd3243, 0x700bce76f5ceaf40, 0x9d13c92b7ff445f4, 0x131f3138d47bff57, 0xdcc551341c717168, 0x467b382501faaa7d
+, 0xff60d6af232daaaf, 0x6e9fec7bdfa57c51, 0x2f380ff76fea8baa, 0x64336afae0e9ca2c, 0xa4056912ec2a718c, 0x4f7f67ad33d961df, 0xc69e6e49571bd1c1, 0x47d11605c1fff51b, 0xab2afe9b9ff4b4ef, 0x40e1eee485dc0b8e, 0xcf0590d58c18cef9, 0x5f16e3859fbe10eb
+, 0xba7eea0c9a0cea4d, 0x4eaa2e29e4db5c3f, 0xe2aa53bfefaeea3c, 0x042ab1347455d904, 0xac6b9c696059f92f, 0x092ac8fc720b14e6, 0x100fe9f10b290046, 0x5d8c72dfa2baa6a6, 0x834061fd3c5b8337, 0x0a05f366e3c3f287, 0x505c6d754d7efedb, 0x6da1722773e6119c
+, 0x8c27bc4171cf1298, 0x7cda56ff15d7d770, 0x3154186384392cf0, 0x26574a7e8a29d3c5, 0xce026e47ba93ad7e, 0x1896a8d8182cb1a8, 0xe6de5a3c7c5b0848, 0x10089198de8c13ed, 0x1bbd1d7a0b443cae, 0x31b17c5b0e25f34c, 0x493dc71c448f3efe, 0x209e20c93773c368
+, 0x221c52f704ef9da8, 0x3e3c9753c9ead9d6, 0x610a91b4cb4f8d60, 0x00fcca3c824b7a91, 0xa0ca58f48395d8f3, 0x58d24c0719b4392a, 0xf8826ac9c8fbe425, 0x6123c28ad3923d27, 0x78ce28eb01f267d0, 0x5b80f588a09cf3fc, 0x97c04901b06840b3, 0x5048df15923d3cc7
+, 0x32b6df2bbb2f8d55, 0x2aa0ae91bcb1f6b9, 0x2196256f57d1b945, 0x5b94adfcd10cc358, 0x3bf1f88b5e8f140d, 0x40a9fcaac640a818, 0x242d6b56ab2dad5a, 0x09a04bb34c13df46, 0x7970e07d5eb0fa63, 0x77d84f74e7395152, 0x01737cc898a6727a, 0x38f2f8f9b22ffeef
+, 0xa11f2a39cf7e4956, 0x784c41a15e4cf69e, 0x36991b5542173355, 0x45bb5fafc90031df, 0x4a6ff674bede4c57, 0x71417fcea2c0a395, 0x2ef193f8d50b9952, 0x3f98fa3d63d17e68, 0xcbd3f6dac3f6a640, 0x40ae23c9c392e65f, 0xe6d35808a4051c54, 0x51c88fb6a3d64e37
+, 0x2028ac3d38523514, 0x7a7c5db814c62b8a, 0x4d2bb3650816174f, 0x77bc5b51c491627e, 0x6eb231ee17011f1f, 0x335061257b1e08c6, 0xce6302cd3d358fd3, 0x65a0dfe433b3fb8d, 0xdce046f0a8dbc812, 0x6fbdb2ff677faf15, 0xf9c0fdbaf3f564e8, 0x4e1da55e721a8889
+, 0xb1eabc0387759379, 0x2a3e6bce0fb5222d, 0x2dfb915449d037c4, 0x1e2f7cd8c33fe8d1, 0x658df24fce6cdb53, 0x54982a2262d4a6ec, 0x7f40cca878085ff5, 0x4a21c1b6b2ad98ac, 0xa17bd469de9d1495, 0x16998c42a2c5ce69, 0x6b81920df8510cb9, 0x11c3b122f5121257
+, 0x9947901387548836, 0x51b79e96bb5d7028, 0xc16a0d51be1e6625, 0x00986fb6ef7f769f, 0x2794957db8a9103d, 0x4f99b23e0df7876a, 0xc40e0e0e8055f60a, 0x27a36c42fbfdee16, 0xd653f739531e09fd, 0x4693355ce97cccf2, 0x5d158c722f420a76, 0x03ec80f4911e450d
+, 0x46c2a298e62dff77, 0x52d10a4e75518975, 0x80d5c70f0d1e6e52, 0x712f807dd9aab521, 0x956da0fe96a519ad, 0x67e5c28636373608, 0x2efbe8329deb119e, 0x10da8194f241a7c2, 0x5f719dbd80cc535b, 0x2d2d9a0a65c2501c, 0x8d03a793317f0e4b, 0x7a6d109e7e3b9c6b
+, 0xded5c50b447e6edc, 0x51e0ba040ea01e06, 0x647ac73fc7456b71, 0x6d1155b992f737f4, 0xe29dada8cdfbf864, 0x3033282393ee3732, 0x2124bc6352860b92, 0x4c7380bc82e896f2, 0xd3ae219134d9d5b0, 0x305f3e5efc2c9767, 0x04b1c75cab8e3dae, 0x394482a30e97a41b
+, 0x7eaf90c5b30fe592, 0x15ef690c60dcbcbb, 0x7671a55b42e4d3ff, 0x2f37c427aa64482f, 0xa21e5cbb3dc202f2, 0x49cf44221f1ca4bc, 0x195e4a0c6a1d60af, 0x3fc83104168be57b, 0xe9bb479e760070cd, 0x2786508539749bd3, 0xf53dc447f81d1912, 0x5b6f43dd748df458
+, 0x2c4a13a532a7707e, 0x2be5416369b16308, 0x675ecd599ce38724, 0x63e9ea59e696898b, 0xd4cf6fc7599b488f, 0x0eb8aeb5b1a6a72c, 0x89c64583f6154952, 0x2cb3a8ba3d7c4642, 0x0c32dab214752631, 0x52a92866cea91465, 0x517343929a7b7582, 0x3ea2052bdd1d4618
+, 0x37277afff375bc44, 0x416fdf8018d16f12, 0xa8c377366ca8b7ed, 0x402dfc83c543acd8, 0x5acb8e6665c333b5, 0x09895474cfb0bebd, 0x4517e29f651ca25c, 0x50715abc50a99778, 0xdf1b34cd9da75aa5, 0x62d47bfce4a3dcb5, 0xa1ccd404ec7d8b04, 0x089d59893698c1a9
+, 0x96e20ff74e7d992a, 0x2acd5ae32080839f, 0x163385bc027a4a60, 0x72afab4d81b06f5c, 0x7a9e44b2a533c41f, 0x211164b8c4038ea1, 0x448b596967eb21f5, 0x1bbb5131bd274d1b, 0x0123f9096fca6dbd, 0x669a4a5a798d8412, 0x837cdbc6e4169f4e, 0x287d769cb967e948
+, 0xccdb65c044ae6b43, 0x7c7cf008999da192, 0x0ee987967bb0ae66, 0x2b0ad241bd785afc, 0x409c1a69926a793d, 0x07f9de6a19409fd8, 0xcd05a9e55297aca4, 0x2a500914fc6437b3, 0x80c3cb74d0382ea5, 0x4a56779365ac95d9, 0x0b1c23d7b35eeb8a, 0x06e0e9cabbe03bf4
+, 0x7f28be0b1571475d, 0x2629504645de464b, 0x6d91e79b9aa54672, 0x66bbdfc59e9fd8e1, 0x840078d7da6cd74f, 0x60e0a14c5404ca03, 0x7fd7ff2c0db094e9, 0x397d48da4267df4d, 0x39a78326b76db2ce, 0x0e37811b399ba869, 0x186ec2c31a1a6e0f, 0x1ca0786586522b3d
+, 0xa2fd6fa44344fd7c, 0x6e00f831aa800730, 0x58913973a6210156, 0x41bd264d4d09ccf1, 0xa244a8d5eea3a258, 0x714ac83789660a83, 0x56fff1ec1547708c, 0x5c348547aa248d91, 0x09e636258d2b9c14, 0x42fbee13faf4b6e2, 0x76ac122e689b65a7, 0x0e435c50940c5b24
+, 0x9bfdba0b9e845b42, 0x6fe7f34b306ad226, 0x5365c31bb96bb629, 0x70ae52a4c0a854c0, 0x15c708ebd72a4268, 0x747ea2e21eec6fd0, 0x58ae013a716a9a82, 0x1b7cdd5e46c6daf6, 0xddfbb342629b83eb, 0x3086f67845718f2c, 0xf40f9dd1c43e08a4, 0x18be0445757a9f88
+, 0x18fe98815bf9cb8a, 0x54ee154e4a4fea6e, 0x44dd05d6f2417904, 0x771779a11852815f, 0x3599b5eea3eb2e50, 0x154ddbecebadf5a8, 0x7792151d850861d5, 0x13052af56c590b89, 0xb971218e7822c4ab, 0x5d8382ce1aa4a7c2, 0xcdf8f89b1a2ae04a, 0x6469c5e1cbae0276
+, 0x601ce9d5dd3b4c5e, 0x13ec99537208c7fc, 0xfb454fd10b3ffc19, 0x0363bd8daf64b427, 0x193a1323fc213e24, 0x1b6f6d601f8e30e8, 0x342e58e9ee248847, 0x7393196f53c71383, 0x07c247e27f955562, 0x7f14b5cee72d2941, 0xc89e5e2badaf6c4d, 0x0f449651c16216d7
+, 0x8f0b1a09de16096f, 0x6126cb9adb9da0a4, 0x3550af6ed078ee79, 0x60c09b61398af3ff, 0xc7be67835fb039a3, 0x5bfb0be5187c46c4, 0x6c008891a10e3d90, 0x5ca15995683074d9, 0xa3f4f634922cb0fa, 0x38e71af65610ac8c, 0xaf2dd10a26d6d196, 0x6aca2ede678fa066
+, 0x9a14c74b5559f59c, 0x6980e64d34ed2f56, 0x0ad7e4c3f3df68de, 0x597086054330a1cb, 0xaf9955c17a6f5f4b, 0x6a856d795182e0be, 0x55515409b9f4184d, 0x3d41c2db1e915f98, 0x1b26f119e69617bd, 0x745924c343d7fba4, 0x3d93ac73676f2c7a, 0x24515314dde5c936
+, 0x684acdb158884369, 0x4f9776a8c622cd07, 0x1930dd19839b9e21, 0x560dfb2cb8e4076d, 0xa17f2866d9961873, 0x3393fb82d0674756, 0xee42999db8cc87d3, 0x5151934586606310, 0x02e606b93c9cfaa5, 0x2d430486cf881d61, 0xb2d4a9f8d5e958db, 0x7c4492e541b9637b
+, 0x1f8fb6de03e033c1, 0x38f935ee5a22e987, 0x5cb51b26a100ce5a, 0x7628d22c3173d8fa, 0x4c310b90a27ab4e4, 0x3595d3a18cec9b88, 0x3cd26aa83fb6c746, 0x1a25352f17945bdf, 0x16f39554f1716c3d, 0x7f58119500a27585, 0x4c3574d577a5dfa6, 0x39f7e5af3bfed9b1
+, 0x463be07254d24cc5, 0x1490f0f3b2d368d9, 0xc147a3e9af1bc5fb, 0x7742f3e786d02f89, 0x72aed2e55e8594a5, 0x66b0f8554e1f9481, 0x75900b6e79bec989, 0x1acfd15ce084db1d, 0x46f6f5550dea4aac, 0x238d01e53b9d19c8, 0x0edecf947646cb90, 0x06de0e0473f31496
+, 0x03c0b377c6d32f7a, 0x39a038eeae9e8098, 0xd7e02bcf4a4da285, 0x66ea008a4fe11fc9, 0xbbad82f0dd194974, 0x51bf89679fffcad4, 0xe76628dc69d1c15b, 0x5ee5417f1394c1a9, 0xb07743b584b231ff, 0x4e989089eea9adaf, 0xfeb94dc5c9b42aa8, 0x0328d5a6ae2ab6de
+, 0xccc937d6cdaf72b4, 0x69e87b5d01b24ae4, 0xe6f9a3c907411e0b, 0x14110b6018c85f2a, 0x7814b0fbd187e61e, 0x7228113b2b6cae47, 0x6a8c30705a4dea16, 0x2049a0e4e813d037, 0xcf3d379a6fc515c1, 0x14d13c043c82a806, 0x7afba9ad55a14ba8, 0x38d5fff94f9e6de2
+, 0xa210b0465a8626c0, 0x594b1fc94dd0c6c1, 0x81b401266460e248, 0x2738461c08396323, 0x566ffe2b77480f65, 0x6a143d98538ed5a3, 0xa4ab77c1400956b6, 0x519be0f29e4ade8b, 0xc6bb52a6e3fe7699, 0x60b8b803469caf89, 0xd1c0d381bb95921f, 0x29846fcbdf7d245e
+, 0xdbad1f4a14bfbd77, 0x33e351d31e96f72e, 0xcd97a638cdcb3314, 0x06ba52e0999faffa, 0x453fbf1576b6fa2a, 0x162255b86b435ada, 0xf9a00cc44b3a3db2, 0x7d2ade90492af235, 0x14f3668942de6a21, 0x45a59c7038413a07, 0x967c448badd8eff3, 0x6b79a765c7030451
+, 0xd2428c24de683f04, 0x432643f3ed2de725, 0x1020f920f5190974, 0x0e473bd8c63702ce, 0x8796cfc7ac27f097, 0x543ed9f3b2b7f554, 0xb7716d133281b017, 0x3eb6d79ee4c6ab95, 0x96f315f394750f06, 0x382d4a26f1d0b9fe, 0xf144ce3a10333e96, 0x3166f7066e28dc44
+, 0x6a91c2fd071f63fe, 0x3800405351c73cfd, 0x8abdc85980ff702c, 0x586d4dd0d878afbf, 0xcab0db81c249b039, 0x5f00c7aaa9d8ea39, 0x926675aaa9662dc3, 0x119e962b205b2465, 0xaf3c2075468fc2b4, 0x7c2634189a31f390, 0xfeb9b1145403a1cf, 0x2a7267de7aff8f00
+, 0xbdf335db6234a2a7, 0x06fe3f764a70e7a7, 0x386fb16e19fa1956, 0x444a36c45ffe17dc, 0xcb5f32fae1833a96, 0x55127dd6b935de36, 0xa73374b4b03e593c, 0x5667dd9dd3921eb5, 0x8fae9930d853b685, 0x0c5f87002828622f, 0xf2cf1ee0b58e0034, 0x61e2972d7a47be6a
+, 0x7d3aaf0d626b8fcd, 0x144cf2b4f13fd33f, 0x6b439aa2ddc84e2e, 0x570a0563434988ae, 0x2c0d9634789158d4, 0x78145265f5cdc1ec, 0x2d63fd8ba1265083, 0x5e130133c77b72c6, 0x571afd1663af5f65, 0x45655394d45f0502, 0xc6868c9b548c07c7, 0x1c433f56afb2ba25
+, 0xf159274746c21a54, 0x4472f09e3bcff8e5, 0x288889952dc1a56f, 0x504bfb770ee3cc83, 0xbb7754a0385f0260, 0x0b88ad45074db11a, 0x6afde17d3243a546, 0x5f4db93ccbc14eb0, 0xba238ecb46ebe412, 0x53219dcdfb30f115, 0xd329933f2a66ecdb, 0x7a0c416f960149e6
+, 0x7ea2325b8999d347, 0x67729d2cb4c7b8a0, 0x79f816ac068bc11c, 0x45cb355759778d85, 0x3a06312e1c31b8db, 0x49207b2e541af3cc, 0x3a12769c82ce2fc4, 0x5c704e31009b6222, 0xa1d549f3a5bac596, 0x707350c3285ac13a, 0x0354bec64518d9ae, 0x4ece3997c2eb998f
+, 0xbc4d49ace929abc5, 0x14bd276ac8a5377e, 0x529c2e82ec56d70f, 0x1886d5191ffb5e5a, 0x92b9914269b7a7b5, 0x775125701fd38059, 0xa64561d606f20a15, 0x2a67dcc1fd72ecb0, 0xfb131f30a1518389, 0x5b0a26ad1bf503a9, 0x033f4398378fcb1e, 0x4897bdeca7a66913
+, 0x4c04b98514a002ce, 0x49410925724688d8, 0x25576bcf2c3db9d9, 0x4952e6b476be3a4c, 0x18aab2de48989bc2, 0x50d3ffa724efab91, 0x51c785ed7189d1c7, 0x1a1b35dd6d32d89e, 0x932fdac062c477a9, 0x161ec5333d144642, 0x658168bd89fa0907, 0x26820b4865085528
+, 0x756e7f6a40f12781, 0x17c083ac5efb5680, 0x01868c48fce40fad, 0x01f69cb75d189a99, 0x85ab8bfc7d80141c, 0x067db63b73eb24f6, 0x73edf0610cc053f4, 0x091839cd6d95dc7b, 0x0b7874b28edad1c1, 0x48bf13c9e989743b, 0x1c476a4818c9d0a0, 0x24f70906f6581baa
+, 0x0928639e6740fa60, 0x0fa962a07561b0ff, 0x831c2b88a1a5c33e, 0x4df7a97695a2306c, 0x653362af000c79ca, 0x3d4a0a4a9986b907, 0xf383d5c458b8d90c, 0x01d3e2a0c31fe4bc, 0xd65d2bf917b1db9e, 0x019b0c47614106ae, 0xde72fa7f005922b5, 0x13edef46d725583e
+, 0xe32161357d9b165b, 0x0fc882887cad9851, 0x889912b1e8237383, 0x7a4a23d38e41bf95, 0xde34e0d11940869f, 0x0706cae6d8fb19d0, 0x17e56991b40ea696, 0x2af213924b3ea665, 0xedbf9340981df49e, 0x04999764f181f0a1, 0xdcf07183c7348471, 0x043bb3a21b817b17
+, 0x0ff9eb0f4e204d33, 0x2f8543ab13ded7c0, 0x8ee9e26c93ca0759, 0x69380f6e2642505e, 0xfa02fa6a053e104b, 0x38df5f7ca69c79d5, 0xd48f19e45561a8f5, 0x6d4954ac3b81fada, 0xdb5b07a02991a565, 0x7c0dc9ec573a1ec0, 0x09a64e127cc574a1, 0x47295ddbd7e48386
+, 0x645442ef6fe1234d, 0x6dd9310fdec965d4, 0x11cf26fed984b533, 0x022560be0b3a77e4, 0xbcb0994b4709dbcd, 0x5cb6c341729f0d04, 0x296df9b990b27500, 0x5e35d1ae31cf3606, 0x147ad325a40bf1b4, 0x0a5876e47c242d8b, 0x1d447cd27a56d0a3, 0x70aeb9c72e33bca7
+, 0xb119c0e71139e65c, 0x18d29a4e2ce049be, 0x58a32160042f12bf, 0x3d7df8421f385a48, 0x9bf548b11594e2b7, 0x70df771bd6e084f4, 0x4ae0daac1a08b7f6, 0x3ed6fe2acbcbe2fb, 0xd6cd57838d665a5d, 0x0f9480aaab8ec147, 0xbc6d4e310b37daae, 0x678041d8811b52fe
+, 0xf6ea3d66e3fa9dab, 0x7ef95bb96e040a24, 0xa1b465552ef37cc9, 0x1bc0a309c829e930, 0x7a19923cd7bd313e, 0x39fb9186ffa7e64b, 0x1a3ca079bb46d978, 0x1f53ba2ed74d323f, 0x8442193530cf7dd0, 0x7f6bbc9dbb01c62f, 0x1002b099b9130403, 0x2d940c0570455e96
+, 0x291a50525c300211, 0x6becd46eb3afca10, 0x2a3eedc7cb8c6f0f, 0x00fd8481e6f09f0e, 0x346bf624dd619ad4, 0x68d2a49e3979cfc3, 0x26792706143416ef, 0x46917d1c8d9c9876, 0xd163259b64d8ff0d, 0x7e3816e8d1f0dd27, 0x4c7321e2a7f92566, 0x47f61f1d101276d8
+, 0xd757a9b661e7f33e, 0x33bda26db9d5b6d1, 0x058bfc847a40ae89, 0x192f4c5772bc1c8e, 0xd13a761ab34688fd, 0x5aa20b0d3d488a5d, 0x3d8201fb3b626285, 0x16bdcb4dfe85ccf5, 0x2988e5571904db8c, 0x78c7436f518df762, 0x8ce9cc5c97b3b439, 0x4716821b54fd8c3b
+, 0xed56fa88546b7ee6, 0x16f12a260517b81b, 0xc7308c23d2c07b23, 0x3452e6e7482061ff, 0xbd7605834993425f, 0x63b1e34d0788506d, 0x0df94e92edb3e96d, 0x7421fb699543f507, 0x4a76be6fac513875, 0x6e676c1909ea7015, 0x4ffdc193800f7505, 0x0fdc5996b3d8b7aa
+, 0x6e362c635a4d8b87, 0x3c36987c6c3a0b55, 0xfed5505989de9c9b, 0x700b4e7d7029362c, 0xd9256ab5b79f33db, 0x28598d2c90141f6e, 0x2cdd30285f1b82ed, 0x333051051a0ff592, 0xfed6486d30a71f32, 0x000ddd6ccafd1737, 0xa2ebd6c9461fbb7c, 0x7a7ad1b80e7cc52b
+, 0x152fd694906f2ce2, 0x592283d223097e89, 0x582fef8c6f99ff1a, 0x23c3669d15e9e752, 0xe372c4a81093a114, 0x3a7b239d3555d701, 0x12e5ec2c087ed410, 0x47a7995c7ac051a6, 0xa92ba942949978a3, 0x4df300cb32908ece, 0xea75ffcbf4bc6406, 0x02ec5cf53b99c147
+, 0x3ce6ef87959c63c0, 0x704ff9906618bd35, 0x8141c071d4739d1d, 0x3f095cefe7b04221, 0x2346627b26323d05, 0x188d30aeb368dae1, 0xbc6e95a123d38cee, 0x69f3eca195ab8790, 0xb1873ce391dcd7f8, 0x414d3e13233cb171, 0x180cbadf40101c54, 0x2e3798c9374996b5
+, 0xaafc68aa9d9bea6f, 0x1919e951f7316397, 0x0282d3cced4f30b2, 0x75228f81a2b91b4e, 0x4dd302185c0ab56b, 0x33584c1cb253c7e1, 0xe22616c30a9eabcd, 0x0ae3870e121f0fb9, 0x09db52a4ca004259, 0x606567581daed02b, 0x389d9ca0b0d9d3c5, 0x38b11cdfb48cadf7
+, 0xac42fd66ae90c3f5, 0x416d8bdab8f6e0ce, 0x1a2fcaf38b7f9b38, 0x7354a0fd71c47fa6, 0x5dffd24fed7347e6, 0x7fa9da877a27f5bb, 0x2f44c76094970618, 0x6f1a6eda4bff9916, 0xc4d3c562a47b02b3, 0x26a93a77b656b40a, 0x1b42092830ea3c40, 0x2734e056ba25da7b
+, 0xb3583786f7f33387, 0x44446270b0339678, 0x5dfbdd34ed9634a3, 0x706b33453f1d3b87, 0x94c35a3c82b1f92f, 0x7ab20b6ddc568e60, 0x8ee8d9ff218fbb3d, 0x44e93f7af523498d, 0xb57cbf89e9e8ee9d, 0x4c3cb43888b5c090, 0x8d1330cacce4749e, 0x393bbe118d02de81
+, 0xfcdae5cad2cc9847, 0x4719ea9386beb59f, 0xf1d8a1c60f514b18, 0x41f03e3ad53cd6ca, 0x2fe992ae86d29043, 0x60b04749b8f7a3d3, 0x3cb075640d1f065f, 0x5d495ed90bb64778, 0xecf6f45808b8dcd3, 0x31b4d7d1cb6f7498, 0xd3451eb2364101f2, 0x15f731d79b2e92fc
+, 0x86587c5b7f663b57, 0x3eeda953a9f0ef4b, 0xc495b2efa8fccee9, 0x11a07a2d476ba16b, 0x5eba0cb7bcc865cf, 0x2dccd85e77d177f9, 0xc8770569d38fa8e1, 0x20a6f8f4e9eae10e, 0x2fe513629f364238, 0x4a6a6348eaf42fb1, 0x089054208a392f67, 0x581d0a70da6dce0a
+, 0xc77e758a4453607b, 0x7e2d143edad6f8af, 0x87569b9f5e093a1c, 0x39cd26f97384cba8, 0xce841f7e8ef0564f, 0x5ecb5dd7fd691db2, 0x2a8901f76b53af86, 0x08a3edf4020c0e7e, 0x897a564a52ea2993, 0x4becbb9c3a6154f9, 0xc6317c9c4239a15b, 0x5a4e80e339fdda4f
+, 0xe8ab7d500a585250, 0x05c68d71354de105, 0xeb143bdab535fb43, 0x7b359137f9d37cb2, 0x0f193ca14f84608a, 0x3fef15504eb61b50, 0xa11a6e382f42ee7d, 0x5546e40790180046, 0xd98b61a15ae41fcc, 0x5071489f6fb1b406, 0xc7617428015d1cf1, 0x3978691d7c24737a
+, 0x6b209d189a3217db, 0x21469dcee1a8df7b, 0x55aa073c9dcaab11, 0x63c468101e73c94d, 0xc42109908b09814d, 0x4e45e25a5085ea89, 0x8c8ad261d29b973b, 0x27a5d7d9059bb739, 0x7021c69e1d842f6d, 0x0e47cccda3299773, 0x6ab1000b97526708, 0x24c61d6f48676cf5
+, 0x8607a87504072d35, 0x52b0a9d0ff91f211, 0x9c879c1d6844fcf2, 0x6616fefeec3922a5, 0x54e43812ebe502f2, 0x752dafa4ad43f10b, 0xc89254dadb53e7f5, 0x7f34e7d523ce2f5e, 0x616a91dd3b1ace97, 0x4de796cf29c85ab7, 0x489b05b43382fb10, 0x44a6d519130de0ca
+, 0xe0a163c2e38e0191, 0x044deab8439c2e0f, 0x48911a452c13444c, 0x77bb1e6c7033ce2d, 0x320b262da68f5ce9, 0x1d4cfa8a45d257a1, 0x1ca1fc12d109e426, 0x11e6d6e7f9b9d309, 0xac09481abfaeefb5, 0x4420056f5f8eb71b, 0x54a83921d7b9d56e, 0x20e518970e1d6198
+, 0x5826e5064df5cb9a, 0x238d4bc59f31ce30, 0x7607b9c1e25d8416, 0x4dfce3307c5f2511, 0x1abf4942243ac3f8, 0x02f0dcaf0aa14cbc, 0x82c2ae1dc5217a6b, 0x003fbb6a0a243794, 0xec16318a91435ac3, 0x2066fda5424ea376, 0x18fbc67de451aa98, 0x5f40a1a091c5060d
+, 0x90984ce9244673d8, 0x10392d397a99793d, 0x861b25364186909c, 0x07bdb1e6b798e0fb, 0xdf7c49a2974b97fb, 0x6773848d84be6815, 0x0f1177b52e4d95f0, 0x0812ab34b0644c16, 0xe746bad3a8e888e8, 0x72d0cf1c5a9a61ad, 0xbf13643d67a609bb, 0x2f0af58e5742efa5
+, 0xe79a3584ec80876e, 0x3146e9e5d124e020, 0x698bef329450de73, 0x27bd0cec345fbb5e, 0xc8c6d8e381a6789b, 0x376d055f479e48a2, 0x9c69895639580a44, 0x65181fef22dbf9f1, 0x6d75e84ce8fc5149, 0x714c5cffc8917e4e, 0x5c24aa1d542bee62, 0x587fca4b2c188fe8
+, 0xaea0135f158a4cd8, 0x2279d23b7b8b9d52, 0x667d15d8134c802a, 0x73726aef3755fc4e, 0xb892be95d745b747, 0x6b81985484d55317, 0xba628227bd487072, 0x1235342a8baa1089, 0x83e1e7cb8887fced, 0x6f0f35f29cbab1c7, 0x8eb1f1512f94b862, 0x63e873b53547a2ff
+, 0x4550896aa823c416, 0x45776458a9544586, 0x3d3d95887cb307c2, 0x269e9c0ac66035af, 0x531e0204017d0b48, 0x4741552ef8c3f304, 0x3f160639bf52cf49, 0x405e9cbb8782d7f9, 0xedff0652e5679acf, 0x174f6cfd144a061f, 0x61a6db17b7a030d8, 0x1e20333cc859652e
+, 0x59532a1e3df311e9, 0x564ac9d930a481a9, 0xcb49061cdee7f270, 0x0d1f571129a13d9c, 0x6b5ce418d2a35298, 0x660b0f68743a0751, 0xc5851e815e8df235, 0x43e958b110c4816d, 0x49d4178f4a71f786, 0x24171a45739581cf, 0x06760a8a89bfaf7b, 0x50c0be15d8e206f4
+, 0x437fd3a17c8f0c08, 0x494b4919b6d691c7, 0xb56a53629731732d, 0x23efe37b0969eda9, 0xb557f0042d52e52a, 0x57b11782f9ff0ba5, 0x59adce40a42ab25a, 0x37278182259851f7, 0xb1752bc885528ad2, 0x08077d6978f63651, 0x9654a52696152635, 0x3ecb61339ae9ffe3
+, 0xb83e533b506f6e33, 0x74d871cd36b388ea, 0xdf2e4f8ca65d18d5, 0x0df36b872233bb71, 0xe7c298d057e281d0, 0x4df088d61a0f02fd, 0xb9bcde5bbdaa9e59, 0x41775c5737158a2e, 0x7f19b27a363589ca, 0x3e938fe5eb4652d6, 0x90f01277c0e2c8c3, 0x15ee116a33584e54
+, 0xe54e2e8e0a4898d2, 0x4df19ddc6fd233a9, 0xda45eed9314878a7, 0x4bd714fa45d60f3e, 0x6b2d0adc27e2caba, 0x33cb297768f27752, 0xb245922aa36b56f6, 0x7b0f958052bae58a, 0x2b57ec093ce50c7f, 0x39d839e9d2b986bc, 0xa22d469683c211ad, 0x4feb5c0f82ba7c1e
+, 0xc5a1e3f9d56f842a, 0x5da2a3fd9f78e2ca, 0x1a457e2d15c5fa5e, 0x31e9d9a40aa99a07, 0x358248038adcd7d9, 0x5026f238016aa980, 0xd5620b66729bc3bb, 0x50d4ac81fce0910c, 0x7b6d7e41ed8b0c33, 0x03ccf068d230da8d, 0xfb4c73c1d87da5e9, 0x5985f2df3439b2b6
+, 0x235a31b7702d6047, 0x3e022e420fd8e56d, 0xdd0b1eaf2a87e835, 0x2c478c112ffef91a, 0x9efa035d6a6af4e5, 0x4f34fa02da4aad06, 0x860c8657bbb1f189, 0x5c78e8a31b6e7b29, 0x4de510a392365031, 0x36c408d6b90238b5, 0xd9e8dede9e161402, 0x6a0be4ef9cc723b2
+, 0x8cd5158c22d9f70a, 0x61a6abfa3ec39e24, 0x06275b7a822c159e, 0x4ccddee790f68910, 0xd19f1ec78f98c69e, 0x0f27a4f90097174d, 0x6425759a6a26f119, 0x29b9de2aeff671fa, 0x5fadb0464b84ccb8, 0x2821fb449db0d7b2, 0x441367f766e17b4d, 0x2cb287b0989a2ef8
+, 0x2f0dd7b2f9a3ab90, 0x3bfa9bb3d05c8a91, 0x568330f34c8c62e4, 0x2a14515d3319ccc0, 0x9192051e76e9790b, 0x444bbcea39cf4858, 0xed1f2805bd2e3efd, 0x0e6b98247d602a73, 0x4a74671c84084163, 0x4006196cf8d142bc, 0xf245fe55f1655f51, 0x2967dd2e6ab916ad
+, 0x79dbfbb1d5a15e52, 0x73420a18fe6cdb9d, 0xc5259e3b70c91ebb, 0x1d8cc1fc743be4a8, 0xbb20f9cc3516511a, 0x46ef2a126e1b4b51, 0x3c535239ec4827f6, 0x670c565e31397dd5, 0x4a2bd9e5fbf51f81, 0x3695dba999ef1ed5, 0x86bfff984db899e9, 0x1ba811db373587ea
+, 0x62959ba7392d7bee, 0x6768a898829f8898, 0x2bf6b50ba5bbe9fe, 0x2d05e2ae5d88b06c, 0x89669f23fc7fad1a, 0x763504e8ee506fda, 0xd4fc629be9a68a6f, 0x0ad81840d749fe70, 0x59cbceb6ed7a6f8e, 0x57949aa4bd95aa47, 0x111a68679ff59e33, 0x7cbe9e116e84a8d6
+, 0x8cf40aa523000257, 0x237717494c923c5e, 0xaa3b38d4c50124a7, 0x4120ca47f073583d, 0x32fa7decc63eb8da, 0x5cd08037eed47588, 0x69de35885eb32709, 0x0c425d21515b9f1a, 0x5db64add62e77f77, 0x520ec9e4825d7dd0, 0xf136d557b00b70f6, 0x4a6876c6a05634e0
+, 0xe6409ed7e2e7000f, 0x1ee5e975c9edfb61, 0xc1b3c9c541b4af45, 0x71068783d7516e07, 0x8e449b4e4ed24489, 0x1f34f5d59a278349, 0xf68c850f20e622b9, 0x463c490e0dd3343c, 0x9e227e4c88fcab66, 0x71676cb817bc168b, 0x2333339542066eb5, 0x17d01b1dcd9cd529
+, 0x52be3c85a7786865, 0x5fb55be4d566a608, 0x2665fa47ec5737fe, 0x2891e61483e5d878, 0x5504e090a0fc9c7a, 0x5f44ed4c223ef294, 0xd4450da58745599d, 0x461c85c8e7b8c67a, 0x2e048897fe1d109c, 0x20d832782dc8b896, 0xd5833fb66b3bb936, 0x43d8a2c276a5707d
+, 0xf2ee98f0282b28f1, 0x73f72d1f454dd658, 0xcb781c8f7c2898db, 0x3d625886d66971eb, 0xac0a48085c31fb95, 0x10b2f795270d59b6, 0x27bd08d952071016, 0x2a6385df68e13e68, 0xa7e2b74f034cf97e, 0x302c9267f65bbb2c, 0x83768a139ef2f625, 0x3031eed8b49a0a29
+, 0xe2bc4c1004ea1862, 0x5ba2bdb7fdc3075b, 0x7ce26e748951dea2, 0x4aba2b647d20ad45, 0xa13b4e0485eb501b, 0x4e9d865c76f2bcb8, 0x2fccd752e2375b4c, 0x6eb98125fabae07c, 0x3413f0239829483b, 0x09c8c28337e08cf3, 0x39fdc1f3dc98a1c0, 0x0dcae19c9871bec4
+, 0x2af4cafae8ec782f, 0x0fd35226f3cb0960, 0x8fc300c526281709, 0x2e996ff894756648, 0xf1c07a941845b5c9, 0x5a1e59ef8dc30850, 0x4745a0932ed89322, 0x41e3f42d2ef6e818, 0x086b60890e310e4f, 0x6e3150770e8b85da, 0xfdb5a168e7457eb3, 0x394dd18c0be6df96
+, 0x0c75ea859e2e3edc, 0x073e8f6e44b209c9, 0x6ec51c63c20e88e5, 0x55a7c650f57956a3, 0xf026e910c69a73aa, 0x496c2694141c9c2e, 0x78477909f2193ce8, 0x3529dab203ece92b, 0x522b4f7ab99fa856, 0x54b9a4a3704b8715, 0x1d4eda3de3115d54, 0x62b69871920ad528
+, 0x729fc2ef1d4f3b00, 0x3c018a174a0bfdce, 0x5e788f859956bb6d, 0x2a7051f77a158345, 0xa6b0965852c3feb4, 0x5b169567f13fa62a, 0x44e0b3a9dc038ade, 0x38432615616deb41, 0x5f771325fc125d11, 0x6d07ed298d78b473, 0x6f1c83d90665e07e, 0x27b150d00b96e507
+, 0x18939f970a084267, 0x66ae74d84a266e28, 0x1f4cddf2c5c6a37b, 0x0a955dd6ec3e94ac, 0x5eff9551d3233f32, 0x647808feb9623eea, 0xdc075009cd4b265c, 0x27f99cba1fb75667, 0xf810a2be3aac4841, 0x22129e697527d792, 0xe282772081e54707, 0x388fcaa0f481aad4
+, 0x802f20372dc70b92, 0x267aada4f68653f0, 0x37a2dc19ca9a9a75, 0x53b8b0f4b32f12cc, 0xb06683b612be58ab, 0x31aac6c7361fb868, 0xfd0a663b567dbf7a, 0x712816dcfbaced95, 0xd983b52487c6397b, 0x3179a4f64232bc41, 0x754965f4784535f2, 0x65d36d5196af3d98
+, 0x6686c60cd2b1c5ea, 0x66752e935e0930f6, 0xd44c6d7319dd5a6f, 0x060bdb39ef64d065, 0xd11584e921c8eef1, 0x153065e71f419cce, 0x95b76f41aa83a52d, 0x3daf5bb6ea6089ea, 0x80569439eac9fb0f, 0x2681b9841414f1af, 0x1bbbab1562795c6a, 0x0f8cdf0154190a9d
+, 0x3a32f6c1ee4a81cc, 0x51a21c2583f07556, 0x887dc6f3b18dab8a, 0x28fd20d8cc0dd6af, 0x69e01b2e3991e13f, 0x7a7be898b4f4f14a, 0x5a5c7296e82ec78d, 0x0277586f180cc11a, 0xf58cadf77e9940bc, 0x6f33534458f8a085, 0xd480ea050c61148c, 0x23ecc452558e91f0
+, 0x5ef6e583b624c34a, 0x356c201ebe80a14f, 0x41a830df66202b0c, 0x685069c5bad2b215, 0x1435e7cf38022825, 0x6058b064ccaeb796, 0xbceed74300586c58, 0x2a8544735ffb91ee, 0x757598eb6b9f065d, 0x6013011a84057214, 0x04a72a1f12b39054, 0x2cf418f6b2aa9d38
+, 0x231b8e4ad6b84196, 0x64e3a7b728c107c2, 0xd2dd49dfebbeed2c, 0x719305a27a315b35, 0x7ce72e10eb31df51, 0x2d71824b35a6799b, 0xb39f81ac9df2b3bc, 0x649f23529cc14098, 0xddce352188a17e2d, 0x69608fe658e3e102, 0xba26116eaa8cc8c5, 0x51c0f4aeae0eca63
+, 0x1717c07a31c34e24, 0x2ab248fa4b3e5047, 0x3f1fbcd58c924729, 0x143f0492e567a32f, 0x57a9a6c05c5a1266, 0x0ff1588a2d70732b, 0xce3b2397789c2cf9, 0x1fb8073ffab02a83, 0xc6ea6ab0a1be50b4, 0x5f5259af07527fe4, 0xad9075f0dcd81314, 0x1475d897ce7d2994
+, 0x07194dd1c9ee3523, 0x0d55af0963d91f1c, 0x32b54f058c977096, 0x64b10555473ede07, 0x1a7600c45cf00a8b, 0x5aeeac0b30a4bab8, 0xeff3e91adcaacf5d, 0x1151ece6a31bcbcd, 0x11ad05ed3990f699, 0x464113bf3cd4ea4a, 0xb8fc5cc4764035af, 0x00a7459b0d411d6a
+, 0x332b1a0e94c74ff2, 0x35eeb61ef8b1c6a9, 0x89648fb4c71618dc, 0x599f9991315cbe64, 0x883549b12cb6ad2a, 0x2bbdfb570c0d2095, 0x36521640e795d7ef, 0x339e146a0635dd06, 0xa5dd4dd94ea25422, 0x5172e90ec1fe7b23, 0x04b68804ceeafe1d, 0x1440260fe4baa34d
+, 0x44622cb35fdcccd8, 0x14345d15d4bedeef, 0x8d0ab3f35cdef59f, 0x5306a627c76d5d89, 0x309c7d5cce882199, 0x3809dbe15e9da64e, 0xff59d44697b6af3d, 0x3b20265d1f8fcda0, 0x65785782ee9216e1, 0x66cb10df626288af, 0xc1a50fe6c6a9fd8a, 0x3dbbf8c1cb15490a
+, 0xe3053318b39c4365, 0x001dba2bfaaa9488, 0x66185e6878d2c881, 0x697858d5b8193aed, 0x558747e80d69b4e5, 0x09d5ea292e5d4ed6, 0xbd5f496268c235d3, 0x7ede9c30c4c1893e, 0xac10808da9fe9bcb, 0x47a171747d95e107, 0xe2c222585784bd81, 0x63794a496359c244
+, 0x861487970201bef7, 0x20774b88474dc6d6, 0xc355ff5d38d30903, 0x092807fa30d364b3, 0x19061fe123bc92a6, 0x004f2df3251e48f4, 0x50e14c0ca8ce6ceb, 0x4e60afe30ee350cf, 0xf066b063f394592f, 0x0278f15758be0f69, 0x2764ae9db0a8926c, 0x2c1f850123de5362
+, 0x3558babb111c69a9, 0x77f9aaab02e1e7e0, 0x6fa78f6cffdf3fd2, 0x5384e01d001d5f3d, 0xf87abc3fc3af320d, 0x6706904f54fccc0e, 0x268f8d7e7d9572a3, 0x6446dd24c4907eca, 0xb53e522464ed26e9, 0x6dc9335d24e49af1, 0x286d094c06e7cee9, 0x09d89719491a112e
+, 0x0046d19c91e5ad5e, 0x692de492b255d0b1, 0x0659845bbb625953, 0x759deaade1602d6e, 0xc5cade132f0c67cb, 0x005a563b9ecd275b, 0x004314f06e51a5b0, 0x7a865a35854c572d, 0x59aadedb14039653, 0x09be2732efcc44aa, 0xa2351f0a4fa95433, 0x1455d2549dc79f89
+, 0x09609fa252e3ae60, 0x1e3bad90d27afc52, 0x1744cb642c688c87, 0x6c5515b071bb02bf, 0xbf042497e74ff701, 0x49d72def35702492, 0xadcacde83d4e2098, 0x264b0d019be70483, 0xfdd05a1b08911e1b, 0x12cb3955e78885fe, 0x04878e0faac62773, 0x4f36969d0867e4b7
+, 0xfe959d2f1d794ef9, 0x70e94d612f5c644e, 0xbc3835c7c94884c1, 0x5d4d3c2f5944f370, 0x8a8245969149bbe5, 0x61e1785fcb075582, 0x8ead7af2773c6b13, 0x47b73fa5b4bbf8ef, 0xc4bb482af3c00409, 0x09e623aa10b72764, 0x3b504df391e89a74, 0x27d32dcb342cac28
+, 0x43b3bc60f2e36022, 0x65520ebd6964e1a5, 0x298bb37d8a8ed2d6, 0x498bc97e907c5144, 0x6a0972773550dedd, 0x262c7d2d0c4680d0, 0x4765543ec954fcc2, 0x27fb74b9c374e09c, 0xdc46150746163dc4, 0x30a52ac351142938, 0xf6532f4d68c8adcc, 0x30abef363b30a081
+, 0xf1a6aec6337e46f6, 0x79ff7d1f27ab31d6, 0x3a293d18933b22fd, 0x163fb15ceab88e03, 0x738b6d8abf75243c, 0x7ce36334abc8aaf9, 0x0b4d529592dddf5c, 0x4964003b194d96f3, 0x05c61642e67bc823, 0x192b3d2665c0bef8, 0x317019eeda0d4f73, 0x4f5b22491b65b8b9
+, 0xb6e1e57ad3283b95, 0x6c70222645e7b825, 0x87f001ef268c4c8b, 0x711d1cdf8faa00cd, 0xe1c6d057a1c9fb5b, 0x1a0e09bc09d176d8, 0x0dfa940549c76f1d, 0x55ea7382c648dbae, 0x2f4c6e1ff10b0215, 0x2c8d88e183077352, 0x1195ab0261dfbed3, 0x43bebfb4685adb70
+, 0x39f15883bf94eebe, 0x16149cb6b714c3d0, 0x1486ce68aafb66f3, 0x6173187c44d8aef4, 0xabb6ecebd438831a, 0x2011785cfb02d571, 0x916187c8922d0cc5, 0x58524e6394ff8fc0, 0xfa60fd15c504864e, 0x4510cbcff9ed6f73, 0xe1e4ad562dddfab6, 0x132594e4ff2ac317
+, 0xcfad19b38e78b07e, 0x0caca82d5a538e1e, 0x6ebabb810df2e1ae, 0x0b0457274d0a6115, 0x05df7901e025e14d, 0x44a937cb404d0045, 0x2bd3b649e2c45878, 0x36400cbc522e4a13, 0xd770be97902384ba, 0x363a9b7ddd034153, 0x7309804bebd1d0dd, 0x61e0065f1fa6090e
+, 0x164612f22b4d6fbe, 0x431c5fd0ad7d966a, 0x0b5cea6306bebec9, 0x33529ed14429ed28, 0x4029eb0a735806ef, 0x0f886d1784d6ccde, 0xf08c922bbe15f64f, 0x6071a0de4abe16e7, 0x3b5e9e24092c1217, 0x4c032eac30244df2, 0x9919996d939d30bb, 0x3995d0fc8045d580
+, 0x398155fad6368842, 0x46bba41c76123f26, 0x72f7c4942a931a6c, 0x46bf498bb35e8dd3, 0xc1d12afc53936194, 0x73ba549b5760703e, 0xc04118dbb694af31, 0x05d228fd200ac71b, 0xbdfc5aad93899d16, 0x4dabdcae9d4fc9ee, 0x98cf7b002f3b2ff4, 0x2bd532ad430c4fb8
+, 0x10ee5a4321c65511, 0x03b944eb9d83c13f, 0x770f527eb2d0e8da, 0x2d3b51b04f5b0724, 0xd3add897afe6d11b, 0x75eca94b25142576, 0x26f6d8d6d364261f, 0x31519d9d0e1fa739, 0x20819ea679ec602c, 0x17cdfecc25d1d535, 0x0aaf0733c2d1bb1c, 0x3ee95b958699c4e6
+, 0xd3babd2e19de4008, 0x4e507e6b9d2dd56f, 0xcb8761209a38f6b9, 0x46ca605c5f598b54, 0xf742d0fe660cbd8f, 0x762a4bee082dede3, 0x9026953fdda77ea3, 0x27a755641d126e8d, 0x955865c00e132ffc, 0x77440bb967699aeb, 0x05aa6f41b6e4d3e3, 0x2fb377418dcc6942
+, 0x5222b7579f6edde6, 0x13af42984d41758c, 0x945a5e4ee46bea76, 0x233f63aea7ab18ff, 0xddfc97135137ce4c, 0x64242cdfb745c8bc, 0x26caa7e45d5681fc, 0x211624fce2e0e2e0, 0x26bb2e9abc560b2d, 0x7902472f4801fd02, 0x8d4993a187e71839, 0x697082091250b34c
+, 0x11534618147a1d86, 0x660c81f7a81ea300, 0x873ea264003f4fdb, 0x68e6216c489afb12, 0x07042c259befd346, 0x0734efa0fab6a7fe, 0x15b1569ca0ea1eae, 0x6dd86898c5889fe6, 0x237d52df1b2533b2, 0x108ac021bb0d0e6c, 0xbc34daf59479c2ae, 0x798352d9d8080148
+, 0x0849bc3f737f4a0c, 0x3f9b0d34fb7a6e8e, 0x1083cf7cf8653eec, 0x1bf5fcc27b9d6162, 0xb84802f7d50b2633, 0x6ad4562a5ec6381b, 0x65f5904c3551aa80, 0x6f76ad3f664779b6, 0xe818e9b484ab2b7c, 0x212873d8ca01db43, 0x525695eb7a7d169f, 0x08b49439ef0b39a8
+, 0xea895e6a4d0e585e, 0x6e8c0f22f7f82dce, 0x3c27c24c0ca12560, 0x46dd54b2538601ca, 0xc61d9d924d1dfbf3, 0x70c45b831fb2c46d, 0x37c352e990b522f0, 0x49d5bfa5587e3364, 0xa7df8e07b0435070, 0x5a79971fa9efe631, 0xf19f90ec42c105c6, 0x4dda8866dec7b390
+, 0xd0c1fee8721b6c1c, 0x09b82e3ed0d07cd1, 0x29c1fd9f3275792c, 0x415bfb85b1c7b96d, 0xd341a295ab26bb14, 0x6c8e1b8ec4486d08, 0x9504d4ff88a0ed6d, 0x088601b6f32af11f, 0x504adf776cc1a976, 0x1f5769c3642822db, 0x5b30c2dc836f5670, 0x7abd032abde70e96
+, 0x1753142f2f522b6b, 0x494d3ae15da48b6c, 0xb541d261e110c03a, 0x416dcbdc0532c5c0, 0xd66bc8325ff2c3eb, 0x2e3e252451343d41, 0x756076182d8d8b55, 0x3ec14c5b6e72eec1, 0x5a835afb490964fc, 0x55a13de39e55894c, 0xe6047a0521a7564c, 0x48cd566287018825
+, 0x42306574f4016337, 0x40ae90adee924256, 0xad133696143485f0, 0x34c231c73ed084b6, 0xe34ac6447160380a, 0x144b421b11901b90, 0xa576569e3a525a38, 0x7419ef230e7443ae, 0xe9895d4d94794867, 0x5ac454008b45241f, 0xcf29968c3642ea8a, 0x5368e2f7494667b1
+, 0x517d8a08d5e8587d, 0x2dc6b04ab9d0b0ac, 0x0b9e4228af4354f9, 0x6425aed83bcf0d0c, 0xa12d36a7b4c4c3f1, 0x13f1d6f72366d4bd, 0x0ff16e71edfb56c0, 0x1d0f6f29bedcbe57, 0x48ccd46755529acb, 0x32298a7a7044e307, 0x0702c6297704773a, 0x30e776fb91e13dee
+, 0xabe0c1109765c0c6, 0x2944f1e22b28e199, 0x36edf7f11acc3a00, 0x4b68b9e80ffeff17, 0x8a71c872ac03f565, 0x1991fd78819dad70, 0x5982b23d867c1806, 0x35a2f86209451505, 0x5125508110651621, 0x448d2cdc54d0d33f, 0x060336a69ef64add, 0x2ea2fc66c74af5f3
+, 0x9ddbaf5c86fa2f41, 0x5b9411bf41897af9, 0xc582323c5cfeb582, 0x449335c2c9013b76, 0xaa07e3c6e2ff6160, 0x2ff78a7bc221e7c6, 0x5ee2d95c1eab1965, 0x1d6e2623460d41f8, 0x92b9a802eadc76ef, 0x0a8bdaf528f1db33, 0x928de6f7ac538fc8, 0x6cf373169f068c60
+, 0x5a0a15681409ff00, 0x707cc3e40686ff06, 0x0a8931855d692be5, 0x7b1130f87a992d4b, 0x0e6b6c93da576ed4, 0x0a790f393c18695e, 0x009f8e0e9767c77e, 0x124d09ccb042637c, 0x958eccf70da21437, 0x1ee3be4ed26288cb, 0xcbea56765f17fae0, 0x375cd6d1b0a6a8bf
+, 0xe4dee5a6e10a8836, 0x29fa5229ab753373, 0x3cc09c306c61ae6b, 0x194f18a5319640d0, 0x9743a0116e28e763, 0x4d54813cc96c5a35, 0x2edc3d706b7baf62, 0x53daa600b7d31e96, 0x3355cc75e34ef940, 0x60732082e65c3e0f, 0x6444292dd852dc1c, 0x56a2979ffb4da456
+, 0x254158eb96a99bbc, 0x609f2be2ae1f15d0, 0x01a655e7917a5b90, 0x371cba8fb3fb948f, 0x08c7d3ca5a4ac276, 0x76e2c0a7e39ddbd9, 0x98690f2d1700270b, 0x0d08d18dae1ea08b, 0x3ae60345fb42ff9c, 0x2ea11324fee87fad, 0xc074836e9113f368, 0x0ebb1324ddb4f7dd
+, 0xaed9889bf442efd1, 0x747531ff82a976b8, 0xe2449dad21edaae6, 0x7b392895af232db1, 0x70315e1853571201, 0x2ed2099a05aa579c, 0x89241386a3fca803, 0x1ce388db7a744e62, 0xe9ef2dd7868b158a, 0x2b38d5a6fc434891, 0x7af1ab944414a8ee, 0x558a8e5610713d88
+, 0x609b67e36d4a2fc1, 0x58478b8864c20ffa, 0xbfc7ccf44ad055cd, 0x1e9b54519a9468ab, 0xa39d4d1be61f0bda, 0x5fe67eafc40c51dc, 0x84e16237cf87b232, 0x372959bc92a4a29f, 0x4f941f5bf9cebc8c, 0x25bed1cb99bfdb18, 0x49c9a23863c6ec01, 0x529c8adaab5b5d42
+, 0x1550a5cfec0f1803, 0x474a926be76a9244, 0x11f451b613cb46f7, 0x40de5af201e4cf81, 0xde278603831bda79, 0x6cb597749f6844a2, 0xdf6123e7d7a4c918, 0x14e6336f85bb4b65, 0x544ece77324465ca, 0x262e81445b5090c3, 0x137ac9d55ef00711, 0x3c95f7e78a7556bd
+, 0xe751999c29e9e370, 0x3222b32ee687cece, 0xfcc25044179fb97a, 0x43232328d848fe13, 0x2361cf6d73ed0fdc, 0x452cff94902b111e, 0x42a9eb4363252d11, 0x0cf3dbd797ad1881, 0xe20dd6f0502f03a8, 0x086e02bca496fbcb, 0x0ec628f7087bd35f, 0x6222559493e536b7
+, 0x4f67504fcbe8502f, 0x39d121209cb78009, 0x6fdb6ab0c6801434, 0x48450ab113b8658e, 0x8637f4f0ac61a0bd, 0x7f42ba631f579937, 0x196a28e2d7ce03a9, 0x6cbb291bcca6261b, 0x5fa3cfb66215995d, 0x025c0ab791c2aa71, 0x3de6e894c0cc62d2, 0x4dedcd02f00915de
+, 0x27bf3f3b13c54f5f, 0x635e829ea6251829, 0x8a57037d23b767a1, 0x34e1de255ce06eba, 0x1ad3e57423d4089b, 0x59b749caec1ae965, 0x4dc8a67294dd1278, 0x084f00a394d1b25f, 0xa4a49f49752cf342, 0x7a6568c50c8183a1, 0xfa7d944d7c97730c, 0x2b1d6f91265d462f
+, 0xd0c7fbb37434902b, 0x71726f8b43b7c5a3, 0x9c24da1722d770ca, 0x43261e86f8764326, 0x7c0e14eb56bbfe4e, 0x1e2f03e39b7f020f, 0x9f6627a55e4f69c8, 0x1f60fc260ae8e559, 0xc88cb2ea248aecaf, 0x20aca4c9533f5c22, 0x25eff6b59d7a623e, 0x1272ffff0d9738ee
+, 0xbea78793abd41cfe, 0x070ab4ff36e48ea7, 0x0453ab2d6c865a3b, 0x427fc903c76fbf38, 0x1cf451b8cc924ec1, 0x18e8451460997c89, 0xa6a48c6a70ddf7b0, 0x448bff1d7e2c11e9, 0x5e12f09d7a155447, 0x684591b6d17017fc, 0x27a7a461917688d5, 0x4c11d93701c73b44
+, 0xe9c7b4610b4f1420, 0x59d2060a65d6f27e, 0x74c9bf27dd59c07e, 0x0afb5336358cf4b7, 0x3f05e7c5a7b9987e, 0x00cc9a3303da23e2, 0xc6c384477865a8b5, 0x067c80b35ad96ba8, 0xd0b12f167f1526ff, 0x567680c0c174e8e3, 0x14990fc0064391d1, 0x36ead843bf647f11
+, 0x8d79ed5ebebda549, 0x3e4a5527415d2763, 0xf99d49dbdb5bfca3, 0x067f3220518a37ba, 0xb5b3b6c8818ccf37, 0x155f802ce6667b50, 0xec920f5b87482c43, 0x0d89fa0cb39bfa59, 0xc2d9ca6f7d5f5005, 0x7efd79fc03954a22, 0x67050e5a1fe88cfd, 0x63cddb90eca8fa00
+, 0xf46b9924aa71fa40, 0x60dfcf0f5da5bcb5, 0xe5f26590eb972922, 0x4c64303535771d71, 0x706a5ed798f0e17d, 0x73f73e6d320dfed4, 0xb4c5afbcb1668e53, 0x040ac7890fa75a08, 0xe9447391b83b468e, 0x4b5220673ef5860b, 0x3aa8d366c45863f7, 0x31fb8055fc1a2f51
+, 0x460d0608bc150daf, 0x0edc908d11be2e00, 0x4e8b0e37d19dd4e6, 0x22478675f60098e3, 0x3d561a590818cbbb, 0x7a32f7a44a163a28, 0x44526563f57c091c, 0x1069225e885f3bf0, 0xc7ddcabb0b33370e, 0x4102b5f77a35bd65, 0x7d1d5089992505fb, 0x1ad9c8b5afc17e6e
+, 0xdb9e80c4af354ea3, 0x5ebb42cca090d62b, 0xb7af87fb195f7db8, 0x714fa47d73a284a1, 0xaededc2ad8f60cbc, 0x7e51f4e4d60b79c7, 0xe04ecca8eefb2259, 0x2c8cb6e03e647c68, 0xf95a32af69e5e15b, 0x4fb736b941e2712e, 0xf5b77b0c7468a161, 0x42aebc9d12de33a4
+, 0x55049a96f2fdb52e, 0x30d70bef5679c8c3, 0xbca40650b8a3d0bf, 0x2ea44422c92281da, 0x76551b70227b226e, 0x1270a114fe6be537, 0xd0ea5a141d124047, 0x068c1ddb2186a257, 0x699b824c6e697b45, 0x2e94ea2ba3e97087, 0x8ed5c34a9cf66ab7, 0x1bd5d67c0cfa8638
+, 0xf09115d83c2b7371, 0x428dff6bced9ab18, 0xb9e2eca9210c4337, 0x4dfe8cae5b6bc81d, 0x39cd68f6f09a157a, 0x4758dd888cbdae68, 0xc468ea9b8daee8bd, 0x7ce0543564cc8209, 0x152f2784b6e67434, 0x2cb16af923617217, 0x106852ac5246e8b8, 0x01acf52af87dde18
+, 0xae9291b4d88e421c, 0x4385753576ac6ab1, 0x40173e580286ad62, 0x2eb9b8fb438b0ffb, 0x9eae0cdeaa5d1646, 0x0f82e2b79cef6c2d, 0x3b5d19ea61999325, 0x5a437b6b11faca17, 0x55bab9f58b6ab9c8, 0x45513fc00cc61f63, 0xb1866a6a8d72b309, 0x7f80006025f867bd
+, 0xb1289575b562b49d, 0x25ffb262b1a9c972, 0xeceaa480563fd55d, 0x5910c3906d7f266c, 0xffd325626a8c311c, 0x51db88caead1e8ec, 0xac88851005cff393, 0x76fbf0d1ce6af9b2, 0x0e8b45ba23496ea6, 0x33cbf495a4b1b55b, 0xd632ecd773403607, 0x0bcd9bc1aab156ab
+, 0xd37dc2332c8cc0b3, 0x6853e73eac44f5a7, 0x3454ac94434db680, 0x19aeef92c98041b2, 0xd1c0c80911989d24, 0x1696e9fae6a5c1b5, 0xd6b14bfc4b48afd2, 0x4a743012d90e2721, 0x1eeb26e865fa5bd0, 0x2041c4349eb78d91, 0x084012e101afc881, 0x43023e11e3c2d419
+, 0x8eb32c09c6c39de4, 0x18805433a87b049a, 0x25d7fd0355cf7623, 0x007e51d87fad49a6, 0x2b6e7a0ccf468b5a, 0x6980fe557a4be81f, 0x4e83af7f299649d8, 0x03acb78767f7b7fe, 0x6026d3ce94e9533a, 0x658503e1e9a1f34c, 0x0c4872eb4947acd4, 0x413e1dced366e69b
+, 0x0da2a946fd56ad7f, 0x130c9828f2604a44, 0xd5072a2361975bbf, 0x662f4aa68b7d3856, 0x0c8241d8a660fcd7, 0x250c7cb07c65ca15, 0x4a0153decd7cb799, 0x6d53c3ed05e9d6db, 0x6595ab95f020f417, 0x7333c1b0133a09c2, 0xc6fb0659b723a41d, 0x45da99c2423d269b
+, 0xdb789f18043aa58c, 0x0bb460e53f73b6f1, 0x494c63f54549311b, 0x34f429e1c358e0b6, 0x37328ad3c904f4e4, 0x77a7d45897779e27, 0xe8a613874d3c786b, 0x3a1ee7593955cc8f, 0xb8ef93d69252b432, 0x7682eef0f5f03c51, 0xca18e1f98662f0b4, 0x1304856d6f9929e9
+, 0x6124156dcdceb25c, 0x6e7bc11431fbb772, 0x84251b223262cbfd, 0x7e5361b33d0e2f43, 0xfc095911c1fc34e3, 0x75557a9e2b5fdd92, 0x480fe13dd9ea5ec8, 0x2900e3fa9f772a2b, 0xd30d909b71846f2c, 0x317aa53c52154972, 0x93dc5159a5e9536c, 0x6a6bd0cdc4dd5b9c
+, 0x63c8f24c1ffd4a5e, 0x305707baec2cbdd6, 0xc627ebddc0284d19, 0x66d5731c8a83466e, 0xb0381eaad1fc4431, 0x2f4776a6c0dc4a5d, 0xbdc2914b81bcc9e0, 0x2d28eaee8650bf28, 0x463328ac387bdc27, 0x23b367bc5b01564b, 0xafde7b081619deb6, 0x6753265522d88260
+, 0x6069bc46fb7f0700, 0x00349ea9ce8ee1ec, 0x5d460aed22147117, 0x0930bf8240573af4, 0x24b29570c7aabae0, 0x48c66fecd5a65afb, 0x81120830e263d97f, 0x39f49bf5fa867ebc, 0xcc70555f23c6d839, 0x08b509b0824338c9, 0x4223331305f03a21, 0x462de0420bfb5a92
+, 0x19f02465d6393427, 0x6102aacc6a379eca, 0x9fb36088ad3efa4e, 0x00bcbaa45fcd1620, 0x9a73c49781726c94, 0x07116c96f901f85a, 0x28e4f8a16d6cf9bc, 0x781fe427d0d85e73, 0xd37096b1ed8c8393, 0x00f698621396f33c, 0xdc7e500acf5f3376, 0x18023dba0e7750b8
+, 0x2890b54206f9c49b, 0x64b370a544b9a2d9, 0x4e269956b08c2e7c, 0x2cec27fe8b14d5e8, 0x55e41429991ad223, 0x0d9070da136b6261, 0x086e63159f93309f, 0x3aa8896e7196213c, 0xd16283c94ae69111, 0x105cd52334209a30, 0x02606e57cc44e3e6, 0x03de22393e1d8e3e
+, 0x43eb72d2da8ee018, 0x20ef4b4e3cb478ce, 0xc4d7e26365737727, 0x1adeaf06337a643e, 0x2b435d62dc696489, 0x322cc003e906c72d, 0x6cb6248f6e913ac3, 0x33859d751c2bc160, 0xbf51a67507ed3d41, 0x0bf864b551aba96b, 0x965bf30d27bfd830, 0x0a3532ef12f792e9
+, 0x8e8b38f04d75d04b, 0x28a677e19a51d6dc, 0xf4ad227e0ff58a73, 0x0959e77446e03d53, 0xf3eef03124080487, 0x6ebc1fcd8f91cc31, 0xa305936fe54aca54, 0x0d11a2f556a58aec, 0x8cbcfdc207cea8d9, 0x4eff5d14d3b6fa3d, 0xdee2cb425142a1af, 0x083fb8a5c9b28862
+, 0xe048764549a4918e, 0x12f0a8e66be2b697, 0x9db94f69b55c1855, 0x0aa1cc8c09e8061e, 0xd96f7d1fbd47b6f4, 0x1e6be9d93980713a, 0x1d16d6b41325193f, 0x08e7c3af3bf4b0a0, 0xb6e5b82877c0e3b3, 0x3047bde347869c13, 0x332913d85323eb84, 0x36eee244ba470e27
+, 0xe8652d0f81a7b604, 0x69fcbb12a3fc8d14, 0x7b3be60c96a8837d, 0x0791eb5b4b32f866, 0x1d78905c4f42eb9c, 0x0492cb21729deca8, 0x72e63ea6fa934550, 0x542b1c33ab09c150, 0xf9ca54317804baec, 0x6e76bac7af54775f, 0x13e320cdf438ea00, 0x4d4d3420195c7423
+, 0xba3a4868b28672b1, 0x7d080f4992dbfe66, 0x79a2ec2f22245966, 0x4550a780a0c9e687, 0x0cd88cb6bbed499b, 0x33c0829147bca099, 0x836e19d286384224, 0x22a0b1bf42863ff8, 0x788072b6eaf5b9c5, 0x11ae90dc5739b148, 0xb1f1e09522440bb8, 0x4908ef2aee0e6ac6
+, 0x16392cfb60557f8d, 0x341d892fda3028be, 0x8e866be71834042b, 0x4872628722b04693, 0xbc39f4c542c81f35, 0x39fc8250a4ef91f8, 0xe9d97ea6fe0990bc, 0x0edd65bdb3b11fda, 0x02ff6d10dcd78044, 0x7f14382d5cd36d2b, 0x0797e02c3450af88, 0x2903c9ec4b389ab9
+, 0x3637ba18732d87ac, 0x3bd87dcd92501774, 0x0126eb5b19c93d56, 0x5203220782324abe, 0x3cddce5eaaab73cd, 0x41d9293741b9312b, 0xc2949da029105b78, 0x195bf9ba78d32082, 0x0ff2e52508d11b84, 0x78bbeb49ce91ee26, 0x6dda01823fbbe74e, 0x5c8e34ef34fa8a51
+, 0xf8533315dbd07ac9, 0x14b9a1312fbb18f2, 0xb5438f611d3aac3e, 0x02c7ba4046c1f600, 0xba528f66b466c277, 0x7a7009da2b3394d6, 0xa8fce3326694be72, 0x0843a10b7d3015a6, 0x0cf9eb9c48fab5cf, 0x297af288647c5049, 0x7ffb2a34a8b1e04f, 0x4dde8c845327fbfa
+, 0xd4d03555e2d4945f, 0x5b82bf4399b18b03, 0xc8cdbcb609f06907, 0x763736a0be8fd665, 0x8082b06685c3b17f, 0x680acfe926be0cfe, 0xf5ff8ab9fba38de2, 0x01f6e307678366e1, 0x896b275f10804382, 0x233b22948afcefdc, 0x21c9141064941850, 0x6157f604f962d976
+, 0xee5d741bc08cdb61, 0x17ff8c7e36cdd05c, 0xb2c1c44d5b4868c4, 0x79092bc6db03fb1a, 0xe14d4dff57413bde, 0x00ba8efdea16be92, 0x96f53aaec0e03274, 0x7919ad1b7d2b8dd7, 0x915a2f6b999434f9, 0x6dddc86891054ae2, 0xe8c9ee11b8a83c12, 0x1342a4b4de8b8710
+, 0x4de49e046e7e879d, 0x42dd47608eab68f3, 0x258b76d9e754d5b1, 0x61697ce18eb20521, 0xa08282b83ccccd3d, 0x04a39ef17967ad51, 0x45b73d617cc4e3b9, 0x166f2e98f0d3b141, 0xcee22194c1bc618b, 0x0a1b71b6c80a3829, 0x50077a9780cf0aab, 0x0187f10ba234e299
+, 0xcfe45331bdb99f4d, 0x54bea64a39e845d3, 0x3ddfe7a6c918d7b2, 0x6f23fb0d0aa20f10, 0x4bdaf0dc5a4b83ac, 0x2a6ee79253367f88, 0xf8e5383464e0ef29, 0x0a372b69a57ff6a9, 0xb4318227c9c49834, 0x0e7a091239ca847e, 0xe5e9051a118a364b, 0x16ee1e3b428f4385
+, 0x969a36398fbeb06e, 0x1f0e22c98d57847f, 0xa4286f3079086660, 0x4e612bac79a88dc1, 0x4b03d56c0aec46b2, 0x75db1e2c854c5702, 0x4b58369db0046220, 0x5afcacd38474b227, 0xe16f846882604745, 0x78a1d08d368807b4, 0xe8691690c15f6deb, 0x18fee753ccf94226
+, 0xe590c44b2677dc0a, 0x2a7314f7e3612541, 0xa8f3a92a077f3d53, 0x4e7498af8583b414, 0xbc08021d45a016c2, 0x4fda5456f5585d80, 0x58409f059586fe88, 0x20afc773acf62ad2, 0x917d4d768bbd09ff, 0x39ed3254f675fd95, 0x2ea403691b48687a, 0x77ebfba0f990c183
+, 0x7ea4e23d68932a71, 0x46d7b4c26f1cabfb, 0x3d75af88cfca2376, 0x48d97ff84df0e23e, 0x19759af2c3b17a29, 0x14551de1752385c9, 0xde906a98caa10873, 0x1d84e46249acb056, 0xaf9e2685dd6b5a8c, 0x1afabf1365122795, 0x69a3d63cb1bae562, 0x4b9b81490023d472
+, 0xaccfbc926336b723, 0x2188f5e40363c2c6, 0xbf293199117b879a, 0x42c325cedcab837a, 0xa60e6187cd5981cf, 0x5b64a4dcf49032d0, 0x088c44c0623a84a7, 0x78cd6366603047b8, 0xe4607acc68c658f7, 0x62058c42e3ef45e8, 0x67a9e6bc15d9664c, 0x311113e37cf324e1 };
@@ -0,0 +1,525 @@
+/***********************************************************************************
+* FourQlib: a high-performance crypto library based on the elliptic curve FourQ
+*
+*    Copyright (c) Microsoft Corporation. All rights reserved.
+*
+* Abstract: precomputed table for double scalar multiplication with WP_DOUBLEBASE = 9
+************************************************************************************/
+
+// The table below was generated by table_gen and consists of four mini-tables each generated using window width W = 9. 
+// Number of point entries = 4 * 2^7 = 512 points, where each point (x,y) is represented using coordinates (x+y,y-x,2*d*t).
+// Table size = 512 * 3 * 256 = 48KB
+
+static const uint64_t DOUBLE_SCALAR_TABLE[6144] = {
+  0xe18a34f3a703e631, 0x287460bf1d502b5f, 0xe02e62f7e4f90353, 0x0c3ba0378b86acde, 0x90bf0f98b0937edc, 0x740b7c7824f0c555, 0xb321239123a01366, 0x4ffcf5b93a9557a5, 0x297afccbabda42bb, 0x5948d137556c97c6, 0xa8189a393330684c, 0x0caf2b720a341f27
+, 0x892756b15bcf68c4, 0x5742f77c98a526ba, 0x340a5a1de9f89f9b, 0x14ef680aee75d0f7, 0x84e770e14043a41f, 0x0212c41116c33c95, 0x35b791e6de4dc0e2, 0x5949df08518d5d28, 0x6a0e120744ed10db, 0x5a5183ce844391d3, 0x6f618b158afdba50, 0x2ce2037e470e2088
+, 0x1f49fa149a64ba3c, 0x5f9876d519670451, 0x030105056f55586b, 0x020f1a557d8fd726, 0xdf4cb175b06d86c8, 0x694fbcbe7fe58390, 0x7933294a756a1b67, 0x09dbe9924b58f8ec, 0x590f4403cdf197b6, 0x1c07969fc87a0ba7, 0xc496477712252367, 0x5508976022f1b096
+, 0xefda361e452e1775, 0x7a0a0cccacc838fb, 0xb07e791c0be5dc5f, 0x24d9b6b418cbcb93, 0x497970f3c6117e03, 0x3986a158cb96d595, 0x8f80586ce692612b, 0x305cafda7e4df9d6, 0xc1a1c2e06452914a, 0x7ef989c0eb583079, 0x3a765b1f7364b099, 0x4fee236d58299c6b
+, 0x6f81095f770e8419, 0x53bbd86b7396bc09, 0x2b72ba726b2b4210, 0x625dda1d2901c78b, 0x0ff5bc7b18cd2b3e, 0x0556598c7358d332, 0x0991245f20ff50d7, 0x0e7f58e5e919a97e, 0x5a0561373b758756, 0x6447bc93f87c198a, 0xf9230604c34c7520, 0x6b214425475c1bfa
+, 0xe93de62d6a7f9497, 0x2129459d86f4493c, 0x456394c7c464cfe4, 0x612434fec3f4a1b3, 0x1ed91eddf44261f3, 0x0c6d3854f9e0a3ff, 0xd3fd153188a7e4e3, 0x24691fbdca16910c, 0xbe97465cd7625c9d, 0x2aa61cd373f759f4, 0x824d5763a326d62b, 0x1a0ae39e50da20ba
+, 0x32d0c8481ee4c3b9, 0x6c3687109cdd18c6, 0xe52717142fbf95da, 0x67bfa41fb52ce9c6, 0x4e24d6a088a01474, 0x49a6ca0ae3fb6626, 0xd67f8faa9103191e, 0x674888f5aa6d3062, 0x4ba73824c2e85a99, 0x406b2fd18d35b314, 0xa7087b1bea728ac1, 0x11d2f222317b160e
+, 0xf8946e007e23a469, 0x22a196fabbce31a2, 0x5309ee1bdc1216ba, 0x240fe9953827a324, 0xf9fcb89b63aeb5c7, 0x603b8149ed16b1b0, 0xb1f1876c02cf61fb, 0x4a5e32af612f948b, 0xfc491aede69a8813, 0x1ad9379136e53aa5, 0x5da50db1d5e6c123, 0x2f4014f7fe2c12ca
+, 0xe4f6791d7685c3f5, 0x4c218521c3745a9b, 0x0c0521af98555f97, 0x1462a12953cada7b, 0x0bb2ab63d6452c1b, 0x5783c531ec98bb87, 0x737def53605dbc9c, 0x49f982b930e86719, 0x75b16790cb5211e3, 0x45ad6574cdbae99e, 0x1062b72dfeec9851, 0x45029a09cc468c88
+, 0x532240de77f3a1f2, 0x17bd291eaa9ad0ea, 0xe0a2d7efc2f8a0a0, 0x3a7412052021778e, 0xb0dfb0976acc90df, 0x7fd603b689a7b1f3, 0x1152579ccb00d6c6, 0x6340743b631849a3, 0xebaa47290e0cda01, 0x143265a6d53fef0b, 0x45325d6fd981e75a, 0x0e9780cc39586f2a
+, 0xa4f68d207a8628dd, 0x50d230b51893e841, 0xf3bd769a4bb504b6, 0x55975c063969292e, 0x07727ba25fb8756f, 0x07ff86cf8ed731fd, 0xef57fa40cc35a1f0, 0x70753a70874218fc, 0x615954e2342b973c, 0x5aa9d68f1a59df86, 0x3b8e9e9ff5e44468, 0x2e749114d60a3d23
+, 0x14a1b91ec176db4b, 0x55f91a63d69aae6d, 0xf42382327b1b6d27, 0x2acf1f475facaafd, 0xfd9069b479b58968, 0x3baaf4e5c4a45f77, 0xa2ac9ab98a7aaab6, 0x5466cb5018f50981, 0x3e6ba27771ba3205, 0x31ea90cdea1bbbe4, 0x0000416b5c557393, 0x464cb0415a510d7d
+, 0xd02087d206ff2bbf, 0x2b9c8ecd7fabe736, 0xb2b56d3842caab0d, 0x046ea0b7767700a7, 0x113a7a889e317310, 0x5992a354bef7d0ca, 0x3edda94ed50388bd, 0x052661f767839154, 0x4c28edf6e19e28e0, 0x1d19c2f2d2f644e5, 0x5d732148db35ab3d, 0x680c4714b83580f5
+, 0xa374f282bb80ccec, 0x789e609bc77ae11c, 0x10d2577d599b45f2, 0x1c548b5b857721b1, 0x7baea726b4543fdf, 0x3c1562912d1b4ed2, 0xd6362203b7e82082, 0x1414e523d3c7a900, 0x7ca349951c1d23a9, 0x4da4265e3ce80fb4, 0x7981ebbcaca9ef36, 0x4ebac9e5b5bf980b
+, 0xabd2c1dcf49cb5a4, 0x3f54acfc25c6340f, 0x202eeffabbd11cbd, 0x67216b7cb3695e8c, 0xff7cbcf9b23fc9f1, 0x2eebebdff7fa7afb, 0x71156befa111f85e, 0x1b8fd98df522902c, 0x6b28ebad62519791, 0x6cf0ea960e01d8ed, 0xb4617bc2006967d5, 0x323da065cb3df0ad
+, 0x31687d0741e24d9c, 0x02db8f2b509a7cc2, 0x9243f85924320527, 0x68c360f01d6e6d2b, 0x2351c5e877d5306a, 0x6f56ccfc85c5f3a9, 0x1b09652837c4928f, 0x0b3337554c83f971, 0xe2931be2ccc783ec, 0x46829694ba08c64f, 0x9f35e36358e2c6ac, 0x1474b333b000d170
+, 0x24d792756fc96640, 0x618fda9fef868c5e, 0xb7ff5b125afd9375, 0x778dd97e0440c258, 0xfbff314886219627, 0x3417e1e1e2a7e811, 0x21e959a88f7b7bdc, 0x3508c2eb8c3c8672, 0x827ecdde111c430f, 0x21bcb19fb07aa134, 0xe0c1fa50ab2f5746, 0x401e680b4e6658fa
+, 0x2cc24bab313693cc, 0x20541c12b964447a, 0x374975b6fb81c3cc, 0x52905efb344e17f7, 0x79c5c9b56d8b5f9e, 0x3390bf75d2b9a3ec, 0x7ef3807d895bf4e4, 0x2814165a42046b51, 0x7f8cfd09326fe158, 0x3232fb4f4c9762ec, 0x5678d6dacc194d25, 0x6f7caffb0a7545e8
+, 0xbd981637b23e7963, 0x691d7b7cb88a0ef5, 0x10ba319ae2062914, 0x06fb144f8295a85b, 0x80e620976bf62f8f, 0x2a425971ec73d6b4, 0x800aa9e741d10b1c, 0x230d7d8bd1a0469b, 0x65aace37428dfe8c, 0x0fcab5297f58b667, 0xcf0e9526943af7b8, 0x7d90915b75d4dae7
+, 0x7455a46156259d6b, 0x29bcc06374cce1b5, 0xf2fb0ed3aa87aefd, 0x211a06af0e54dd58, 0x6c0c95c5723de9bc, 0x6299b6ed25008ca7, 0x7fd63e784d4dfb18, 0x2cc93b4d9bc1db30, 0xebc7e2d44c5d13ea, 0x3278e18d4d3d11a0, 0x349e3dd25a215f79, 0x7eb2a7150b30416d
+, 0x05f3d7d5f6a094cb, 0x2a3771d48e331405, 0x08ef39e9dc96f009, 0x012248373a364992, 0xf758f92fc9fd4d33, 0x2339d8c6dfd3ca6c, 0x8b000965962673b4, 0x746ff43eb99d9054, 0x47ecdc054a422eff, 0x33d8f7c8267b7f0c, 0x22fe00ac921a42ae, 0x31e57f3d31fcd8e6
+, 0xbb912315a1c50869, 0x4ac8cdb0fa7ebbaf, 0x0541d74a60973edf, 0x7234900334b2c5d7, 0xf2e545f730adfa33, 0x224e44e63db5ac96, 0xfcba3d005c6fdeb9, 0x2c93a4e6559936b5, 0x7727a0d7ad88d758, 0x2e33100216719cdd, 0x7b2ef89aeb2c0254, 0x1f6de5b74758afb4
+, 0x6ae89047114fb321, 0x3d605e9a6ec6d80d, 0x18e915c727a874d8, 0x699088b5e9d0912f, 0xaf9344618e056f10, 0x1b9169df8245e0b3, 0x5eb8c33d70f4c891, 0x1609ddfb222b13c3, 0x8131c885d1b366ed, 0x7bc3cf9d9cb1a7b0, 0xd297478d2fc93968, 0x13cbb4573a4ea7f5
+, 0xdd37b5cc64d5986b, 0x7ed3d1d7d81ab5dc, 0xac53485f23973c9e, 0x0705675d333b91d7, 0xade5d213c43186c1, 0x6a8bdf57b4bfdf14, 0xa87f88a1de717963, 0x17f29220b519bce2, 0x7af2d7fb0f95c610, 0x28d1d3923b144a7c, 0x8e73c3d8972813e1, 0x00100b40c62e72c1
+, 0x84de7a81fa1f50da, 0x4fa391d6589d8244, 0xbcc3596f0834b285, 0x4d4acbd60a24e9ce, 0x97fa98b8c1835a0d, 0x33abcf8e29901d0b, 0x60a73d1975b3d082, 0x60666aa4325b948d, 0xad54adb769284a39, 0x227a98d113609b28, 0x4a1e1ffcae6a3872, 0x1e4ee44bd67f818c
+, 0x5a74c6bb4387d315, 0x019428c0b1b18795, 0x5cc153e270bbb055, 0x2b3cabdf00dc4a61, 0x834110c026924b57, 0x2d30e985f2d9f217, 0x47116979333389f5, 0x53e3fd6a18202417, 0xb1393cd79c2e5864, 0x58d92935e4112e82, 0x86989a7ec8305b6d, 0x42a8fe4eee28f37a
+, 0x74e212ef01591901, 0x3277917a0397b1b9, 0x7bbcbe6e3d687544, 0x0b8957701d09afb6, 0x6cfbc8ee74503668, 0x48a9925ada9f8348, 0x57045753ba2d0f4e, 0x7d69ca3866223d66, 0xc7054ce22917271f, 0x41bce1e1133b51de, 0x3a3ae42df81ec35e, 0x7eaada0f42d47cc3
+, 0x13b138f1048a57cc, 0x64f98abd7e915a8f, 0x7af195eb16a0c732, 0x11be81a791d634d2, 0x97d8df47430f61b8, 0x0767c7b381271004, 0x3e949136fb940aa6, 0x3bdee340cd956dba, 0xb250ec4ff91d2602, 0x4cde2454d47f59db, 0xaf5e749530d978cb, 0x5a8e2f2119d4d835
+, 0xdf1cb5425a0744df, 0x3d3b08a7bf35d055, 0xc6335e832de4719c, 0x6eb8d97e09154d42, 0x2f6a3f8de3d20dd9, 0x13f23cfd276233da, 0xb4a6b80dfc0fa41c, 0x58d876403acfd7d7, 0x2ad422078b8e139b, 0x73dbee2abbaf494d, 0x09a2758891eca3c8, 0x6ef9a9f1178b0938
+, 0xfc7e9ecb90c637da, 0x3a04345fc10b1a7c, 0xc024e9cb62f9ff1f, 0x6c4f9c3aa4aa33d8, 0x049d6995b95ac1f0, 0x2243845195763a1b, 0xa1466a31700ac276, 0x600fb7123a325905, 0x9d391a64a0d35a24, 0x3b093b550641f108, 0x2275de5bfd2e221f, 0x25f5e7465963db1e
+, 0x3e220107f7e7fb84, 0x6f06a23bc1b85a8e, 0xb4198d19f6eb0e48, 0x5dc11761dad45fda, 0xba303e492ab52a0d, 0x127c69c73da9f528, 0xd3a5b70cf6c790be, 0x0d72b0c50819da5c, 0x193f90d62ec2cdf7, 0x67f7d0cfc4f46daf, 0x7aec083d52f380ea, 0x7c0a1dda4a28bf4d
+, 0x46fd20fe6008cba7, 0x7a588c914115d595, 0x8fb1d3daecf45f78, 0x0851dac094e7b036, 0xcae0a76e2a32a892, 0x104f861322dddb2f, 0xb79d81e46e1f9006, 0x1e4d28d7a2498912, 0xaf3175d3974b89bf, 0x613d00f9a69c55c2, 0x23f6883e8e65226f, 0x072f7ed65c6def05
+, 0x6690e643bb38e243, 0x1a81c4a7c9189b15, 0x1056d1669e4749ae, 0x0137f2a7418f190c, 0xed3192796e699d16, 0x3ed76db45c38a37c, 0x78e86d1475a88243, 0x45985aacc495b16e, 0x47d5c8208e8f1030, 0x6dbe5f68b4d0e782, 0x08d3d0182cf7f26b, 0x64c375ce172fadbd
+, 0xba0f6db3a20c2875, 0x57e1d90a53241250, 0x0315433fddf8e63e, 0x33344750e37dad9b, 0x62cc0d28ae69b016, 0x435fe80f6100d547, 0x5874aea8669d3df5, 0x3b96913f8264d4a9, 0x738067d6bb1314b0, 0x48cccf24cc6f4ccf, 0x6f5e2bbd68b777af, 0x34c2c37ba9635d66
+, 0xd731534900fdbe5b, 0x4e4f9d97afe11d43, 0x81b41214351b73d7, 0x1d48d100ad11a5ae, 0x2a4ee76628e2b151, 0x34902e901877efb8, 0xb5a8561a0fd45394, 0x44317af6d5cd5ac0, 0x354c2469e9068bad, 0x0771fe2761cad022, 0xfda76ee8212d0f2b, 0x76cdeec6d4435495
+, 0x55c98575b3e825fd, 0x2983325ed5d73a1b, 0x563c4c4fb3f466e7, 0x731b0fa413338bb0, 0xdeb519ca57a05240, 0x7a7e909b5c4f7351, 0xefb7c153dd2ab28e, 0x11ca1c865dee30b3, 0x013ca8348d9d7de1, 0x575e0bdaeee8cf9a, 0x464c98a21083af7f, 0x683ddcd85c212ee3
+, 0x1171f0ab4cd02019, 0x22c7e01c7f4d64c8, 0x972ec0ef3f2e2ed3, 0x623f83c2611a476c, 0x99b3f16be9aa25a1, 0x2d3ebc5468990e0b, 0x5d5fba8546a4d5f2, 0x4716e6919d2986e3, 0x3ab2f2bc183f5d6c, 0x5f6257d3910cd4be, 0x341c6f2a78f94f2b, 0x6ee8390b8a5064f5
+, 0x9d8640b9b83ca8e7, 0x033c5ad24466be3d, 0x6f6cd68db30dfd59, 0x52aa6b1c0f90f3f6, 0xfe7bcd4c97403646, 0x11ab3fc960b05fb0, 0x24584b77575896da, 0x427f8deb932da137, 0x928a28cb505306f0, 0x04ae916fe863820e, 0xaabaa98911b9cd3f, 0x59e588ba994d9145
+, 0x9b8f1afabeee9e9f, 0x04ffc7ef3476ff8e, 0xe9cf53ce9937b146, 0x73fe42a801524448, 0x224bda3cf3bbaaad, 0x5fa85056d59884a4, 0x8e6eead48345726b, 0x09230936d41736d2, 0xe679eb58d1ad6be7, 0x08bb759b530b1eaf, 0x9688eb527860e24b, 0x13704d2daf9af278
+, 0xd9273ac71b906f14, 0x57ee05fbbd40deb5, 0xb7788e19ba9e61eb, 0x7967b6dc1c5d9699, 0x36e043fc230127c0, 0x2a716598bb2d519c, 0xc017b2840d4d1b07, 0x1d3bfa489f756a3f, 0x4ad73abf24318d36, 0x1915e6f53e12625d, 0xb219a7c941f89084, 0x2280087a8f4762fc
+, 0x8eb280345fd1b4e7, 0x55b8d4ee5772fd79, 0xc9e63a787e2ce2e1, 0x685741adbda93885, 0xffb830ab11a3b491, 0x7e891121f9356428, 0xc03aea271a629078, 0x71c45932930a2639, 0xe7df192a6bf81795, 0x704aee8f183aadf1, 0x06ddb55a8a7a63d7, 0x52556d8763f3033c
+, 0xb76b458c6f0c33a7, 0x28666b87c362b95a, 0x365ae575a4c27b9b, 0x36ef35110562adfd, 0x89955dd8d927f9c7, 0x526e787d6a586c9e, 0x762e0bc4eff988c1, 0x6c9523b4b5ae4946, 0xe90a909688cfe95f, 0x658a7dc8b3ffada3, 0xbee148ba7a58520f, 0x6819007d8573d1cf
+, 0x75d3b5ec141be9c5, 0x4bc236ae634f3c27, 0x1192fa9b8b30e894, 0x4129d43e1d092cbf, 0xfcac068558bbea45, 0x513e8d87b8116534, 0x5377a179a155ecd4, 0x6c93531e5545572f, 0x727df81ba09aad91, 0x07527139dbc96250, 0x150320b1d8ba172a, 0x2281e85f60a1809b
+, 0x7164b7d524eba6af, 0x50d387163fea4ca8, 0xe90de17d62aebe78, 0x6ab369ba28c0410d, 0x17d07e315a95d138, 0x58b496352453fefd, 0xb87a04dbbc101b92, 0x40a8f0fb757e9b0e, 0x2148b48a696e64d1, 0x4e004a3a350c17d7, 0x17927e9f386b563e, 0x29da9cd441e3e3c5
+, 0x883d2dc357417213, 0x2e94653ff7862644, 0x53a37af548453df1, 0x04475db3c300b93b, 0x2d65fa4d815e7204, 0x231a2db74c2c3ccd, 0x1fd734c0cf4d97cd, 0x32d255c105f6d122, 0xbb74fd9201eb07b0, 0x12e33f1c81ac6f60, 0xfb9a6439bea97072, 0x52e14b7db9cdcbc1
+, 0x637ac1a91ae374cb, 0x1c8622c35adc8224, 0xeb786c50a64b7d33, 0x362823a7232a5893, 0xf22dafca688d472a, 0x18598f0e0237f7c4, 0x97b8497bfff4bcf1, 0x7abf4cb27a9c5b7f, 0xea47c44e3b3d95d3, 0x58728fe3e1827a43, 0x7fd3681a6df902c8, 0x6db1dbbdc413de79
+, 0xbc4effed1ac3007f, 0x7f31a54744887cab, 0xe6559b4f8bd2519a, 0x18a78ec5b0c241db, 0xf6e10285b15d2030, 0x5c1323ea219a8ff4, 0x134b6f20dd116b47, 0x5d0abddbc8998733, 0xa3c993938702e151, 0x0ab6aeb494f6ad5d, 0x8cf3b4beda1815e6, 0x546ce323008c2fdc
+, 0xa10eb5a6a78dbe39, 0x26d2e8a8b8457da4, 0x026ccbe31517d806, 0x2a35174b812f562c, 0x57d70499dd7a374d, 0x3368f951acd3c5e5, 0x490b2515f901062c, 0x316109e7c315c377, 0x32e20eba569535cf, 0x496a8c39d667d709, 0x5578096dc44d5e0f, 0x608a162ce73903b0
+, 0x6b2e65852cb37cab, 0x75b09a2e6ed609a9, 0x7ac84b3082602455, 0x7690cbb594e84b94, 0xfc85dad9511973fb, 0x738a74b08c9006d0, 0x83233fc939d5883e, 0x7fbfc08b5db3c9f4, 0x81a0e493fb5f7749, 0x2c255ef7e69a77c1, 0x234f02e609cc656f, 0x5960cf0b961f3cec
+, 0xac72940237b1f17a, 0x434e038a29d446ac, 0xca6a090e00d8b0c6, 0x1f1aad24001e473e, 0x6d64b6dc133399fe, 0x0899ba41e9dd4607, 0xca590b3f25bbf5df, 0x57217978b0d8ce11, 0xd6b4cb13da6de9ac, 0x3c88520cf564f75d, 0x649fbd5075a7757f, 0x3f2593b90fe72161
+, 0xe1bee53e91dcc9a8, 0x010069dce4c74a92, 0xef83968978aa855c, 0x6cd8848183b53d73, 0x0b3df59610e403eb, 0x713225d446180a7f, 0xcc23112cc59850e2, 0x105796b670a3730c, 0xa147f4ec7a2fa4cf, 0x32da1f072d75b253, 0x4e7007455e85f560, 0x76a5376a771fdd60
+, 0x47eb4fabdcc699f7, 0x4e45db6334c6ed96, 0x36066f2bab72546f, 0x04f48065593ecdec, 0x3fec02793fbb5601, 0x122f74626b64a526, 0x21d0f66ff83b4dbd, 0x1370610ede647f1c, 0x57b82242b88172c9, 0x527dcbadfdc65ade, 0x5e9c9a04385c93f5, 0x64d1cf9e52548a6c
+, 0xba0073337865c994, 0x633ee14e50bcd615, 0xf840228ec4251095, 0x49bb96812a98f08d, 0x82f57d0422f96678, 0x06d7e43bffe7e0e1, 0x33910cca752ae863, 0x04d46e7c66087e38, 0xf14935c4167017c3, 0x3f22e2f44d03c9ac, 0xa6196244f2cd6164, 0x15a2b4ce514fa4db
+, 0x5191a04c4abbd0c4, 0x0e763360ecc8a19d, 0xfef583c184a673c0, 0x75c2f30a7c7433e7, 0xe947a55547c7c099, 0x245c7ae44f6e7a83, 0x67a666f9e6bec2d4, 0x5de0b922fa645ac8, 0xdd9b3e4a5cb72e22, 0x0139c2c857adba8e, 0xa7feb68e863ac231, 0x501381ef88ec2da0
+, 0xb2b8c6a470f40b01, 0x051d65bdb8363062, 0x4ce90414a6d65714, 0x1e510b525d19df0c, 0x569e723f5d374cf6, 0x4bfe02fd38fde1f0, 0xae7459ebc50f9aa2, 0x0f7e2cb170dfde32, 0x3c3da2326a7407cb, 0x0cfc50a85ffd1842, 0x62ab34c85e85c3c8, 0x22b4d9644bb37333
+, 0x57d313b3d87c2d98, 0x4f432c1cba49133f, 0x6163d11fa4befc0c, 0x1ab94e122fddf12e, 0xfb7c9358aefc85a8, 0x5b20068f81d949b1, 0xcf8ed6ff2145c810, 0x5794afc021932d00, 0x5c8987ad9b6e35d5, 0x6bb1f4b836fda03e, 0x794f1fed4a3ea1d7, 0x0cf6d128deb0e7bf
+, 0x54ec3e1c65878cf5, 0x002811763ba2200e, 0x382d917051e77b71, 0x49e00cbd013a9e7f, 0xccf576e9a4cf019c, 0x4b4a66287970333a, 0xf772168915edfc1f, 0x278eb5eca6479685, 0x8a95c8b9cf41cf06, 0x6e58c9c7826d39db, 0x478e119889f2fe75, 0x73ecd21991bd98d4
+, 0x26e751fe9fbb9502, 0x29825b71b0632e95, 0x21668f96ef8bb5c5, 0x2f2a899e53c9a004, 0x2803292ed4345ce8, 0x72731055c7c65dec, 0x3aaaca9c4b6fe9a5, 0x6228d3ceda8bd671, 0x773e2c5effc48eaf, 0x017ab19e0fea9ac9, 0x9609e10496c8d766, 0x121e89f9b302c30f
+, 0x4e87d00a0be96480, 0x09bd8d170ba9dbab, 0xc6756f947ecd4e52, 0x2c9e40bbbccd0f5b, 0x42a5b77669fd812e, 0x66aba9583b080d9e, 0xee55df99d16e77c1, 0x4cc00c5c5eff2509, 0x8c84d5e20ab7c16b, 0x00ae5c96184ffefb, 0xb295e90346dcef54, 0x5d1bda0a39dc3b72
+, 0x75f92d72a89b5ef2, 0x259d998c9ff9ac0e, 0x8a1cfb72a6c433c1, 0x23f5b71d49d67604, 0x478d8f30914f62ef, 0x08fe61135218eca9, 0x4da2ce9bc6488c4a, 0x15f1eafd35283e2e, 0xc2d2be3ebc42ea0f, 0x2a5216539d6ee902, 0xa1e99052e7bdeeb2, 0x3a8f2631ec78290c
+, 0xb71518a82ebfbfe4, 0x24700671c46ebddc, 0x6ef52d591a221f75, 0x4794614db6a67d92, 0x761f5c8ee4bab607, 0x31d9dd8f2361b5d5, 0x1a45593be8db3b29, 0x7f06c365eb116260, 0x9d305a66e52eb65b, 0x5edcfcb5613eac18, 0xef34fd28154adb75, 0x790f805753b9d742
+, 0x6ecd5ac255dfb797, 0x0cbe14db5d9a88db, 0xc1c86c5efa815528, 0x2c636133ba59d887, 0xc75d42c2d9f52297, 0x4bd3540c21e2ebd3, 0x32e7cdf790de6903, 0x1aae3c9837d3e30a, 0xeed028e49d436f09, 0x779ae12351efed1c, 0x6e0145587d9797a5, 0x25156e4cee9a407b
+, 0xac2fd82f2ac57119, 0x7f8c026f1d182ed2, 0xeacc0d8fb3241611, 0x5968db65d2d7545a, 0x7d525846b1121dbe, 0x57949fd7b80339cf, 0x471fe9bec9b66c01, 0x5c270057f1268efa, 0xce092463083f656e, 0x16e8241cdc862cf9, 0xb7cb2bbcaa06b312, 0x3c25936bd8863416
+, 0x19b8ca966c4a3827, 0x1ae43badfd21e63e, 0x1dfd002b95a6ac6a, 0x4708e27f6d98e997, 0xb5fd6322dc31ac7d, 0x53baf4d9a16dd550, 0x025aa2ea5463960c, 0x5b5b33c7a3cfa54f, 0xdba287866ee96b90, 0x4748c1f3f3a6dc4f, 0x2333ec05a80c154b, 0x4a47745d5b99fb96
+, 0x7de331eaf403d7c6, 0x2dbf3a9f975a4b09, 0x175a8ac5d108224c, 0x6697ae0ed57bb18a, 0xcea23805c213e2c3, 0x59f1b8656d5690db, 0x4baf460a10b23798, 0x0077832eabd82e13, 0x52888a23361cb298, 0x30bf5295c5f64491, 0x5960339ec97719ea, 0x5325cd922cbb3403
+, 0xc5188bd69618e85c, 0x296f922d9ad41fc3, 0x2da59f8bff5aed90, 0x2662cc4c60ee7ef2, 0x22aca98c8405b59e, 0x043bba596dcffd8e, 0xb467008e9b87aa31, 0x1d65fdb88da19ed3, 0xe042f460ccae713e, 0x101118018bae77e1, 0xd0f26b4a5d91d8ad, 0x40770de987e00c67
+, 0x53ab21e43a35ed5b, 0x341f9cd6e64e6c84, 0x6ef8e7e707c1414f, 0x33610011d1f942e3, 0x4b019af5f2f8e85e, 0x12ad7ab4b14cf6e5, 0xc718480b770cf12e, 0x7bda44448dcbf840, 0x98bb0351df202365, 0x4b38527c6dce9c01, 0xcbd28185a819ae02, 0x7a19bcca37fa59b0
+, 0xafa3722439957660, 0x06ebdaf0dbeb7593, 0xde81597f08c3ae81, 0x33b9907bbb96d4c4, 0x3f43a76561db371c, 0x0e89a1fb68f278c8, 0xe5aed79a0680ced4, 0x4a032dae33d5d6db, 0x2db5b64487ec9e21, 0x4a8ca714b7795d2d, 0xfe9bd0c1cc1c91e0, 0x0bec01459b9b7e42
+, 0xcfa0d0003cb14725, 0x75aa85468a1e34f3, 0x68f5bbd1abf452f3, 0x249a902b7ea02a8d, 0x71ca331692213631, 0x0e54b1b6ccfadb84, 0xd13bfefa0cb35163, 0x618352c16fb97576, 0x6b6ce9a365e7e495, 0x60a6cd627054aae3, 0x1f7e7b55d56dbbf9, 0x58d1869caa022006
+, 0x20ce35661383a949, 0x4ec74a9307323d21, 0x7fbad803d6c7844d, 0x2b23d3a55363b681, 0x061c0444341b7999, 0x7e4ad0cab9534234, 0x7b09a8cd488f6621, 0x7bde5e652073500e, 0x906f8593e41d1d0b, 0x1ecc6829240726a4, 0x3de8b88854db49ac, 0x3cb4c48361531c6f
+, 0xd8d85e6921107a60, 0x24e554cc92a75021, 0x6b5fe5fcbcc564e4, 0x0b5de8db2c7373d6, 0x166518f4256f8548, 0x57f6145b58ff55fa, 0x6bdcea5977343779, 0x0b95e29ab237a201, 0x193c9909e331942b, 0x4711abbf14e0a184, 0x686611580e5381ac, 0x308709f072c2db2d
+, 0xeb5589ddd7d9a990, 0x5b09e1a65ba35eb0, 0x61f6c9a74817e89c, 0x4e22f6a84c22dfa6, 0x112d33a0173d2f20, 0x193ea2419f156077, 0x10d1fb4462291b6e, 0x3a04fff11f9c8a7f, 0xc8e86ce9453dbbde, 0x75d32f976d9e2215, 0x6898256d3553df64, 0x4a38a72818ce3195
+, 0xba7ab98e8bfb2485, 0x5df853641e170004, 0x5f481c3ad7b3456c, 0x4825b571989fa56f, 0x3e0e2e6b4f655362, 0x2c97bd263589ab17, 0x7582463ee78c2347, 0x70e9bbec916bccb6, 0x0f36d4da0df4cc36, 0x30ee10c22e770e49, 0x0f52b5b93f9d6b09, 0x4e1f3e3530d38a79
+, 0xa19c54a8dbefa553, 0x747e26c087af7d3c, 0x5acd907ea3af54ca, 0x4d31ef8cf53a018e, 0x5b3481e0e6e631e6, 0x27f2d6af0fd5f2d0, 0x1ff3ab052ef11644, 0x01e2dcfbf701b419, 0x6ad2af67df904dfa, 0x204c02189e92877e, 0x396203c9981e6c88, 0x7c958b47c85df4bc
+, 0xfed2ab02e210a9ff, 0x3eb4500e53357ed1, 0x70ec77b1917fa474, 0x64798f496ce73592, 0xdcde3ef7f5acd7ad, 0x6c28722996c55849, 0xa38e3d39198e4fc9, 0x2b67a90323847be0, 0x1b9c80b76dcd3881, 0x7e6827d0c31c22c4, 0xf549196c29955177, 0x70b3a2fa63f58460
+, 0x17ecf97299f1217d, 0x49d7e5395866ad72, 0x712713f371ffff5a, 0x2da796e3c6324021, 0xca7cc235c205f2c1, 0x5a191549c8fa2c18, 0x762ae5e9801d96bd, 0x3bc404f3dfe7ca55, 0xa435aa939fa68581, 0x2272fe5fa650d21c, 0x521728efcd0c954b, 0x6a87874ab6d92c7d
+, 0x08ec530527d95865, 0x213f4a6eec3b5aac, 0x01f239f264c69bab, 0x79d3914709659dfb, 0x0147822bf2e152d6, 0x597da9429eb1d00d, 0x53b186c4e48297bd, 0x780453c29f8a8407, 0x9d032b1ca55e9c6a, 0x095faacded03dce5, 0xf084a1922d90c84d, 0x3c7f3c63bf2b5d1e
+, 0x8ed82c9c8e738a49, 0x6c0a5ae703e53851, 0xe5800b12853d6516, 0x448567f95f0d4a6e, 0x48c5ce4694c05eac, 0x7abbb6d65f03c789, 0x3978f9f03a787ef7, 0x2bed3fb7e01fe962, 0x3a53d97b463f2914, 0x6bcd285fda5dbc99, 0xb4dcb1e7b4d21122, 0x6292a941103e4849
+, 0x2af115ce04087a96, 0x13bc28aed2ce02cf, 0x80084ed3b6b0bcf6, 0x7043d078ac6ec426, 0x57d2ebcfb8248e2d, 0x11037609977ade94, 0x2a47ef7b490f7ec4, 0x5e931f7f19313e0d, 0xef1ef971fe096895, 0x0a8ffbccdaa075e2, 0x56f429e40d8a7ea7, 0x6833e75b85f36cfd
+, 0xd35ce62175461a48, 0x74ec71e04d808393, 0x7f326b71f59deb92, 0x29c5d31fc74cb57c, 0xc9a1ba0ee1594691, 0x50309cf410c64327, 0x2f1c06585982d6a6, 0x7e5481e973d8226a, 0x97c6d087edd595c2, 0x737206f6d0a1c07a, 0xde2e03bd7fa23561, 0x656d72cc6dd817d7
+, 0xe10b039612b94505, 0x2d6fb956ed83c3b8, 0x4fead845e2941bf9, 0x41a9ae74c104a27a, 0x1529d99120b05fcd, 0x11eae3edba5f0c95, 0x50abae45600ecd7e, 0x216ca492fe86592f, 0x8f7fe5f6c767b404, 0x2909c3a245709855, 0xe06c3c67a52efa72, 0x229e540a8a27b7e9
+, 0x2363d7a3d678c9d0, 0x6c4da342c773bff1, 0x79c1c73458efb069, 0x0df082e7147a1f13, 0x097ef650bc872e87, 0x4b7f2a5c47b70332, 0x6ebaec218476d2d7, 0x4faf61b79d35ec9b, 0x10d2b8821a30d816, 0x7110115345446cc3, 0x233e2392b970b008, 0x0581dd500eb0810e
+, 0xb5eeb1bd02dc638f, 0x7ac02f76f7a98d95, 0x68eec55246772fb9, 0x6c96233bad65e418, 0x97f6d9c27ee5dad0, 0x7363cad93efc076e, 0xf56a5ae899248a44, 0x5fed54ab474b9cdb, 0x2541a9ed8c3cff4d, 0x1ff71adcba409ea8, 0x23f6903439f5f49a, 0x5ebc02ab425f29df
+, 0x47330d9c9cc86c9e, 0x0922b6484d6315d3, 0x2c92760fb309dc39, 0x69f2d4c42982053f, 0xf60b0b3692610d1b, 0x4288b2529eed2487, 0x19f6df8e728518e1, 0x7ed72df2ca9d2e0e, 0x000be435e9d94394, 0x4269bae655dfd472, 0x4b9fc14d4d2cb063, 0x4960151c560696ce
+, 0xad5af562181141df, 0x42fc7a987541ac37, 0x48a958d5559d0784, 0x55e915ac361b6945, 0x28d5cae68365a9c8, 0x557a923ad4f00fef, 0xd8de5906f7852678, 0x366730dded2f8fe3, 0x50dd40314dda6401, 0x51f1ce228f4648c6, 0xc60cd1b637800e70, 0x2c0425c06cbc5e11
+, 0x1ecea34de4ec51d8, 0x428b6621bb3a90f4, 0xdd5f32ea1db8352e, 0x125f8e393fb2824c, 0xa924c04732ee23a6, 0x05b648f88943e747, 0x69210c31b0bf5fef, 0x34c8512a7c606a2c, 0xca82c22008e028a2, 0x68dba8d39ba88759, 0x82a7279fafe0a9e0, 0x4172e55bebc009ba
+, 0xaa0903c842c194a7, 0x02a25da5825d30b5, 0x92fabc9304221a84, 0x63ae6bbfbf946e83, 0x3252c55aa1907d39, 0x7c88bbac57601e5d, 0x774b6b062e09ba6b, 0x779d80c17d8a33fe, 0x2fa605a0625cf2d7, 0x398e85db50b93dae, 0x83b949a88e464a67, 0x1aa90b6e44a1ac65
+, 0x00d8bbfc769d36df, 0x639b97dcdac7e245, 0x6e2e4286997776ab, 0x1b2bf57698602100, 0xe0493b978d4308ad, 0x16fc7d83fbb17136, 0xc27f3afd419c4027, 0x5ac8996edbeb49db, 0xeef91deb27083cb2, 0x6b118dba1b751084, 0x065678cc7ea61da9, 0x396d10a86ea9c22d
+, 0x79063e14e21245f8, 0x71f68e22554b9fd4, 0x90ded03c6a76eb57, 0x7f5683844a44a054, 0xf80896746da52b87, 0x2dc9cf1d0a44727f, 0x8f77f3a17026c613, 0x160bc731152d577d, 0xf4c8fa214ae0740f, 0x008fcbc4b5c4333d, 0xb193ad74c55794c5, 0x0e6d79dc26409465
+, 0x3ab520687585ee3b, 0x69ecd0abb4476b11, 0x40116d615ce7caa6, 0x7dab654340cd862f, 0x0c643cbdf1f722b0, 0x4e22e8f0481847ac, 0x578be8fac849a9b6, 0x5a92c91d6c7a463a, 0xe1c42011edf6bd08, 0x20df122eba94d963, 0x1df44d1d95c9cd29, 0x618527ad2c979ca6
+, 0x21a497654e7038f4, 0x17d66e95083f0b9a, 0xefe5a140ae72d56d, 0x53839e315a8cc027, 0x0baccf35628e2857, 0x5c2d100120fe95a8, 0x0a47af78f5b22ca9, 0x7797ddd43b58ff8e, 0xad64d75d1d63e2ba, 0x5fb696108970be6f, 0x02bf12e23e5bd0d5, 0x3d8ac9db92a62e0c
+, 0x3daf5b3ba4627ac0, 0x6c98ff5285b52420, 0xb4885b91176bfc22, 0x38fb84158b8c3f0f, 0xa9b5b6dbb2377aab, 0x68ab86180fd8d43d, 0x1d236cc012c4ab78, 0x2d4b375b30da0712, 0x3ed7120f613bdfb0, 0x4de3f1c513ed06ad, 0x4a04841acec7d91a, 0x7d1b573f27594e36
+, 0x6b71654bac4e167e, 0x15e6407197c7436d, 0x1b4b2123e788b92a, 0x66278be32bcd713e, 0xcf31aaaf54702468, 0x48566b8097851ac4, 0xd48a06a5898da730, 0x00af4e04ba87862c, 0x9da474c9454f228a, 0x02fa8a701a1d55ae, 0xb72e4b299b467227, 0x4c4f80ed606e620a
+, 0xcf594ae7453bbfe0, 0x502c363b8abd92d1, 0x22da668e7767f41c, 0x14f1a98bf7e5e593, 0x5ecd14a4187635c1, 0x60369f5a5d787276, 0x1012a0458a4dec24, 0x75a59f9428e9ae1a, 0x6f9e13e07e9efe69, 0x6fd9f4de56241c82, 0x86a417aedad9e177, 0x381107ef34fe0888
+, 0xda76a2176c979ca5, 0x449e8be61bac95c1, 0x201ebbfbbf27376d, 0x29790cc15a4e7ccd, 0xb51c7b2ebfcdff91, 0x0f3c5b76961565cc, 0xab01c9b01a8fa53c, 0x2a30e527c88a1bc0, 0xdbf2216dd00153f1, 0x370dc4bc432e0815, 0x8980ee99bf0f376c, 0x13cd165b4430e38c
+, 0xc7b66be019616235, 0x7de52145c16aabe6, 0x6fce19a4c2160133, 0x7177b857ddd54f7e, 0xaa70a16e210ea129, 0x0412f7e6ae45cdac, 0x23c54b48ce6976cd, 0x4972202ff0622d47, 0x553682281363ac67, 0x4c5d892f15f94243, 0xdd3f60443ea0baad, 0x5b1ef37966cc5b73
+, 0xe0f0e3a31bef51e8, 0x0b2a541edaac6981, 0x69539fab5be9555c, 0x3e624340a1d34ca0, 0x37db080a75ef381e, 0x57366bc799278e0f, 0x9cfea6d6e5918b89, 0x65314e20020383d0, 0x24a752a3089995bb, 0x31d8e53d80cf6d3d, 0x9eca917c33eed711, 0x4700a89969b2e222
+, 0x78a826d5bb364329, 0x5b341783804dd4f3, 0x16b3921143fe7a9c, 0x2119679d9fed6f03, 0x84284df0b4afd4ba, 0x3b8a5e7af8f74954, 0xe663318edf3ab780, 0x2193954419aff9b6, 0x9d6899d7297175c5, 0x01fe06de9dc2aa6f, 0xe3da5400551d83e3, 0x32b973ed718172fd
+, 0x16a03d2cfd5a3d34, 0x4f36a37747bcc291, 0x70fe0abec210ab43, 0x69cb9936162b2ea7, 0x4f9b5301cadad19e, 0x32a2938355c03cd6, 0x2e4849a3107eb06e, 0x7a30861eaef4fe43, 0x87095b2a71c6b2c2, 0x26904118df8b2972, 0x4161551e03f82809, 0x5323b605512125a0
+, 0x4791ec410c13ac42, 0x3d0abf87d56b11d1, 0x4a666e84fe9ba3d5, 0x4f3e5f59eb34aef9, 0x3c801b09f9d4c694, 0x53985943e8909586, 0x0c99618bb496ed1c, 0x61da8dd14cdeca2f, 0x8810a12466ea0030, 0x2dc8ecd8c641d614, 0xaf343cf2ee41fb99, 0x10563936c2979426
+, 0x624fc1ae14ea0ebc, 0x6df482493f9e1b72, 0x916db66b075e1de0, 0x6372c81016d058b1, 0x7075f92dd6476b2f, 0x05cf92e8b4c37eb6, 0xd9f61e57e037c1fe, 0x258f622f3f28cfed, 0x6b6082dc871927a9, 0x2084603b65e7324c, 0xd2adc29e4deed0c1, 0x45b185654f4b6a7d
+, 0xc67d6abba2cd7077, 0x70e37e300d70a93c, 0xcce5e4eae0abbc54, 0x6ba8f95309073cee, 0x38e483cdf1807dbb, 0x0a25b8046c17d45c, 0x6cf18dc8cfd49ff7, 0x2c46fa9bdc20c983, 0x47491c3842059704, 0x3b907a5142ada29c, 0x891f775524f0bad5, 0x57f62ce63c84ea8b
+, 0x1ffe528f4308fef4, 0x58633e53ed640845, 0x4f3f4cd88b8f7992, 0x1b485ee1731a3679, 0x8859af0f84cfd821, 0x7c194775a2626e5c, 0x3c218f391e18efd1, 0x273456b04eb50e30, 0xcdfb1fd0c3750ac4, 0x379a20510493866b, 0x0d7309a5b41df649, 0x04fe6c30c2b3400c
+, 0x5dd110b2173e006d, 0x5ad1321def2db1fc, 0xef3afacfaeae905c, 0x2a586a1df422eefe, 0xa12f1ec34350cbc6, 0x787f13361a7d8dc1, 0x834a775220575674, 0x398f935de6dbc950, 0x2372945941d6bade, 0x14b63d1596a87374, 0x59e2bb71dae3010b, 0x6df6892578758e92
+, 0x18a91147ff0c3475, 0x29339dc736f5eda7, 0x94372aeb17298090, 0x03cd4b6762c4e56a, 0xce5454a4123630d4, 0x22bb03f7e1b24d06, 0xa78d2acfca390603, 0x635418dfc37f8b73, 0x8dd7c2ee0ab9662a, 0x09c8d1424647357d, 0xaf10b9e2fedfc4a9, 0x52805f675de06d66
+, 0xa205c36834ce683a, 0x4a8782e35b58269e, 0x4a952d8a39091ba7, 0x68048b2d283f0ddb, 0x0ddc690ff013cca1, 0x493acf228058bd0d, 0xfef16c2230d30df2, 0x2785fb5fbdbbe4e8, 0x20ea6062fdb081d1, 0x3f574f8a73cf7908, 0x66fa42434d03fc08, 0x356e091e12df010b
+, 0x20d3cb8185648b99, 0x5a2b83332dec71af, 0xb4204e7f674b1129, 0x10c089c9040d8234, 0x6861eec4fc63f315, 0x67d870537ccc8f73, 0x79b7be27922150be, 0x00c2b5860d903eea, 0xf92d81b78684e4ae, 0x46b1231b49a2d411, 0xa4ab75697858d0ef, 0x5f0db595046921a6
+, 0x83fc50168359a56c, 0x31a62e680a5c717d, 0x31a81b5967cb9b20, 0x71f8e71498a8e62e, 0x4a9e14333cfb805f, 0x79e12b4ca670ea86, 0xcaabc8af8fa0d204, 0x15134e528e6bc672, 0x30db5147dea6af32, 0x70c0b127445c7e38, 0x4b6eec2468ec95c1, 0x5f63f9eb908145b6
+, 0x6a7868a6cacfa060, 0x72754038f1ec1fd1, 0x0891f310df745f7a, 0x0c9658009b7aa5fc, 0x1085b6c54a1c35b7, 0x05a78950af27371b, 0xefa75ed68da664b9, 0x28193357ef9301f2, 0xd210231d72688084, 0x0c4722704a2a30a1, 0xc362402a362d0899, 0x32c18e242663a442
+, 0x9014857889ef7219, 0x68d5e66737eadeed, 0x2a80d6a2ab1f2ba1, 0x32f9acb9e1aa8c73, 0x26949b1346ca4325, 0x4318b819afa37b98, 0x644e741ed72e3c90, 0x70b52851302b6904, 0xe53a7d1e15e1d234, 0x3516d7f96ef3ad01, 0xa3240982684e76e7, 0x74a91ee1f288b565
+, 0x77df389b8242128e, 0x413c379e1268b023, 0x33c254209ea6bf8a, 0x70b91584d25c9e0b, 0x158a9cb257c45f45, 0x3738561050e086a0, 0x0303f6a517843483, 0x19c30266488a2947, 0xc266cf4e80c9fc0a, 0x62ca21b9be983a18, 0xc1fd17de230e7183, 0x5dda4862cf241baa
+, 0x8dcb31571aa1d430, 0x760480607337cc65, 0xd7ff642ec7b290e2, 0x61f97996e29cf758, 0x18e72489026a0a2f, 0x4f0b9dddc0b5718c, 0xae46384365a11860, 0x63d2350d7c1df8bd, 0xf0176f562f8629d6, 0x73bc81248804b345, 0xba58474a0daf1045, 0x77770def17498083
+, 0xf79a0352aa7eeb65, 0x2707e8b5debc592b, 0xb06b1e71d7a99cd0, 0x65e97567c8fe0d73, 0x486f3856e13e7626, 0x50de3156337ab93b, 0x1be4d6effdd124f7, 0x4d58403c76f0473e, 0x7bc6b7097c783993, 0x0112ffdf51a85117, 0x268d3ba82267a5cf, 0x63de8cf19e07776d
+, 0x03b7f01fa786a02c, 0x358505ffb43fc5f7, 0xb335dced80426e71, 0x7d1ed9bdff932f5e, 0xf0fc43032119bf4e, 0x65ace2914bf57449, 0x3e7cb029731c4b3e, 0x4c67d23b8ee2bf2f, 0xf9e016fdb46d6077, 0x079b11429831e813, 0x5204f1f3f09907e7, 0x4246d9cadda327ad
+, 0x6594eb84824dc52e, 0x60a8b8eb91630a55, 0xddf1ccc868b0f311, 0x4607b9cd41d6eeac, 0x603b69aa55e2caf6, 0x51c689f5e5a0011a, 0xdbf7e269da5588f6, 0x47ea73f6e792d570, 0x811d62bdd7435772, 0x5f2d28030f8e6aa8, 0x0214d3053977aa00, 0x6513c0be4c61ae2e
+, 0x026bc9ae4fed6c91, 0x21f3cc9de5d5941f, 0xfd4c1c7af197bd19, 0x1459c22f2a67f567, 0x34e74a259a7167e9, 0x093aac658d9a1aee, 0x23819fb7c701e784, 0x24a380f20acd36bb, 0x62b469ef30686e1f, 0x59b3429775216465, 0x46bce0e7fb2a7b02, 0x1bdab2ac6702aeb1
+, 0x72d3bab333fed7c6, 0x6dfe62ae54757ffa, 0x92c912d0e31cd7f8, 0x5af090da6a033e44, 0xe542380afe3516c0, 0x3cecc63e8059faff, 0x05d93efa14f84cee, 0x0cd0d735b2bc51c0, 0xdc0d65ee5006f717, 0x18eb83338cd44e4c, 0x94364ef9f7a0e763, 0x3a703c45b5b79b5f
+, 0x1ebac624487baa62, 0x003218158c03b754, 0xcfa845f2c415578b, 0x23075abc3f7badc3, 0x26f38842c86eddd3, 0x6a2efec55b6d91c4, 0x33819136844a3dcb, 0x771006752a0dd159, 0x4f75a6e8564df9dd, 0x047c12f418d78b92, 0x107ecd0464130bca, 0x0286c41cf751ee93
+, 0x91b1b88cfa3409d6, 0x7a9da6e4c8c225bd, 0xcc19766cfcb39bb9, 0x5b8c15aa25f24768, 0xc634c02c97c733be, 0x638321e7cdc0e1a9, 0x57bed72b92740e9a, 0x1f9cc67c4e780e09, 0xb2db50ce372748b3, 0x622390c699692705, 0xdc2166cf52b4aa73, 0x2d9997fbfd281d9c
+, 0xb683cb37808c7422, 0x48e077b394f27c6a, 0xaa9e56e70a9a2cbb, 0x565b15f48ef22b09, 0x3492f8e0f0d59730, 0x25ad9ae790f6a474, 0x55f94b70439f7ffd, 0x60fbc4761f60d147, 0x2fcdecbae5cba6c8, 0x60d3907dfd30b1f1, 0x06132ca073ecb802, 0x77c16d5f82650f5d
+, 0x65d5d0b321bf012e, 0x1d8230c02bd7afd7, 0xae5dee32ad1fd1e6, 0x49eb4eaa577e0a0c, 0x80b07fadffa62071, 0x212d0b36432f2580, 0xc105d063f6f5d87d, 0x439d2da88e83ecbf, 0x25061be2b2a6e9bb, 0x602dbde636ecd30f, 0xc31c8a5678c11bfc, 0x0da2ec0c791c4434
+, 0x494a6702ebd3ca8a, 0x7706b177fbc70078, 0xa0d923f7436e17c3, 0x5352d29eef25ea48, 0x625a933247a347c6, 0x67b0b475011216c4, 0x74df29a571bbb5c7, 0x3d80890ae7638511, 0xc69f4ff3a09f98fb, 0x1af46d1de77327de, 0xaf5419127803d1f7, 0x5c6b1c0fe26b6b8f
+, 0xf9d2898eaff8d376, 0x0236a56a55c21cc8, 0xaf4a10854c97b1db, 0x0fcd1300b182d51f, 0x896f551e5dddb547, 0x5da4c2eb48f1366b, 0xffe2d68bb9eb82d2, 0x7c66cf6cb2ef4cb7, 0x21313dfa0b5b1cb2, 0x1963d5ec5fffb471, 0x9b79ba03e7b8dc8c, 0x73a5b065748222de
+, 0x11f618700b377379, 0x238106c5f861866e, 0x32330cd5c0e077ce, 0x62ecf690a361d071, 0xac9cd6eefc23f1bd, 0x47275551c2c19f84, 0xad8e7bd5ee6cb60e, 0x7364b8069cee33e6, 0xaa7044ec211b56bc, 0x6742ab7e6e4e21c5, 0x81b8d4fca63e031e, 0x01f5d5aaeda25bb7
+, 0x9ad3e9e89d85ab49, 0x429a895eaaa04a37, 0x81f10de3c18a69f4, 0x65feb0fecc8c6358, 0xc46d7efafd422aba, 0x59a633001933be68, 0x2fe7f4c38842e8b7, 0x200bbe14c3386a2e, 0x95538e34d23d2260, 0x29be712859f7c4df, 0xe1c0741312c8b473, 0x18ed5c36eb363d91
+, 0xf97d5c75e55bfccc, 0x2e8825862fb23092, 0xf8a9b28891764220, 0x41688a475d6094fe, 0xf9accd4dc8303b1e, 0x7ca15f47726948e9, 0x49b81f50feee7499, 0x7681b4f892ecaed4, 0x261869e739d8d767, 0x10e1b2fa41a75abb, 0x4983005e2e1c2c82, 0x02b7f9d8fcb3a91a
+, 0xd98d65e78e7b9f66, 0x43f503daf84e63fd, 0xfaf7dce82ab1c791, 0x39fe687010b6be85, 0x6d2cbb64fb7fa175, 0x4043579c3740ea86, 0x41b1cb9f76e0102c, 0x726b0114af6aced8, 0x11baa3edbef2b73d, 0x3be648d1315909fa, 0xb6344e40049d2111, 0x28921b0abc311e27
+, 0xd29361fd8e8da56f, 0x4ac502b07b28f917, 0x1eef67d4510b8630, 0x737c326b11572eb1, 0x9234efe8ec438d2c, 0x22c49079eb038670, 0x13244c23055f2c18, 0x344ffe71e17103ed, 0x2c65a3f47bfd1056, 0x0438fdfede70fbd6, 0x6ac1e851f72ff65e, 0x1574e3b649e476c3
+, 0x44955b062a6ecded, 0x7791feea9015f170, 0x736bf603d12fc35a, 0x2632adbca5388026, 0x956e4c48e1697c4f, 0x4ee9adfe8600e32d, 0xa584042a0da56406, 0x34a3d7f4bf457353, 0x8d4fd4fe00176fab, 0x15321ee855941f4e, 0x670701ef81f340a4, 0x0c7d7c618aed0ba8
+, 0x73283131d9bfd9d6, 0x34935a39e31bac65, 0x466cfbbcaae8b991, 0x250dd54e18478ac6, 0x659e46c51e40de4f, 0x618ea014fec50e04, 0xfe64d883080b877c, 0x572cabbb6688c4f7, 0xa2c817493a834146, 0x06cd734876378120, 0xe3de0b717336a849, 0x36942f5191db53c4
+, 0xa3f9adf66abf4d88, 0x2a9a144b8087fa96, 0xfe49fefcb78a5b4f, 0x1be40a8616928bab, 0x07a901975521f7aa, 0x1fc66ea683693510, 0x4dbf0084ba42380e, 0x1f374495b918c737, 0xb8346956a380a00a, 0x1346f4766fcdaa07, 0xb4db5689d46312c1, 0x775e7f3274dc1316
+, 0x07898828f32341c0, 0x144390a33b3e86df, 0x70bc604ce1e9c5e4, 0x127652de00220873, 0x2874bc669df50d45, 0x236f4585150161f4, 0x3bfa4ffd318214e2, 0x7cc92a6165059745, 0x2fae0e92090ef72a, 0x26676bd59c4fcc3b, 0x220c030974d1d447, 0x66455887e98686e7
+, 0x4164b8e4d8760ddc, 0x5517a86f840feb63, 0xd9b42c6c9371cade, 0x3a7f03ceecc160b9, 0xdd4086d64cae366c, 0x1b6290c327842533, 0x144efcd2a7a0e82b, 0x16621925ca10d31e, 0xa9dcd13118e208f1, 0x5a90f97edcb1c54e, 0x80c47331c8749d99, 0x6f061a3569a80b55
+, 0x0f6abf619e2a15c5, 0x29106c98122245f4, 0x5860b10985c9b47f, 0x4f379a379e15f410, 0x2dd6f45df68e1678, 0x2c475167ad9b283c, 0x23b7aa00952a6a3a, 0x5532bc26a40c5365, 0xa5c0a8be3596ce22, 0x4fa3127a9aefa56f, 0x944e843aa973e67f, 0x3c7727d45ae87854
+, 0x48fa2ce675117ea4, 0x7bca8e04ad3bbb9c, 0xd57439e4726f88e5, 0x3337d3a6a03b2286, 0xb0b6172902005953, 0x514bd76734e6c0a1, 0xf97f8934eed7c6b4, 0x0abe13cee7f1b75e, 0x6c88107a120e54a7, 0x634f966d7a6e11df, 0x5044c53109b94097, 0x68d49fc65522b73a
+, 0x69e295cd8c444666, 0x542c4c5fd999a224, 0x13ff89418b5da76f, 0x7133fa786a87ecb4, 0x2f180926456402b4, 0x52ddada7931c4dcc, 0x6eaf0d2130c71590, 0x014ec2a2ec231826, 0xac05b61443b34dd6, 0x157acbfab118b219, 0xe4e2f4b84ad01099, 0x0abf4a4da29a0eb8
+, 0x5f852b85b59eab1f, 0x1bd259c4726869ed, 0xce565d9287790a15, 0x17a48442bcf58a00, 0x01e519522381363b, 0x2336d07a710da07a, 0xcfebf2fbdc714cb2, 0x2f7a51474c23b8a9, 0x77db2a07d4e3716c, 0x40e8d8d2d0a09806, 0x644363ce6d401ae4, 0x53f9cae0470172fd
+, 0x58d96ecd8ddadc53, 0x15028204f3d6d696, 0x6f40a09214439ce2, 0x738c5371236c3e56, 0x64f87ee7a28bf9fc, 0x4f1899449a810fee, 0xd0aa95f4bf21e376, 0x6170cc24283856bc, 0x9dfc4927d764ff75, 0x227ea1563fa2e012, 0xaddd3665622ce087, 0x473d3bea07a5285e
+, 0xc0b986ee0d2b0eb2, 0x78e584c740dd18ed, 0xd5adbf30a04fd508, 0x1c6aed5ab59bedbb, 0x25d05fccbddb5ba1, 0x4a58fb6b3f896319, 0xdb2f6343fd8144fa, 0x46a445de6d5b07e5, 0xf67a06684fe9e1da, 0x57b2515923b15c9f, 0x50439940820a2a0c, 0x62f4b9b26f04dab5
+, 0xe79ea601d01b033d, 0x009bc6176f10fffb, 0x333bff2f907ed39a, 0x253d0a9e626dd400, 0x7a9bbedcfcbef06a, 0x2d1b6a7a5b39342d, 0xbadfb462a124cc9a, 0x2e8cde9d82c15cb0, 0x7c3f81bcd6f1b2a1, 0x04cb0b8fa4075294, 0xfa36d3db38cbd304, 0x59fef93442883553
+, 0x91982a741cb9342e, 0x7b9d63ac17b01982, 0x530b4ec25a293ece, 0x611069ad9fa0f0a4, 0x7a262a59b656a79d, 0x6fe6f8f4d6d015b0, 0x2c2fd7641a5d4e50, 0x24b0c507058c911c, 0x834882e492fe45ae, 0x68d0b01b13432761, 0x0eacaaaf94178b8c, 0x123e3a93006d7d01
+, 0xecf2fe69377ff33c, 0x4fc960ab4408584b, 0x2adc445b1ee45654, 0x4989681cd1d09a93, 0x79509599afe9e3b6, 0x7f6ffbbeee861c15, 0x2ed2859fd6391b25, 0x5e8bd52289b6ad27, 0xc949280adbce7c79, 0x510999e865f0cd54, 0x7f957314ce7d373b, 0x4b2c0ea4bab08ef2
+, 0x2d7cc08b5c05a8db, 0x4609a0ea23507697, 0xe204ba35182c55b8, 0x5e4d5903fdef61e6, 0xfe63842f2826598b, 0x782a3fd3ab62a179, 0xd2f01a1979e5a0f3, 0x0fb4c6bdd637fba2, 0xfbff4c192020c350, 0x14859008c3d223c0, 0x65ed7a889c1a2e55, 0x1d78daf483fa12cb
+, 0x5b54d11b01bc09ca, 0x54fde75737306515, 0x89725231105b63a7, 0x712d1f394adcda99, 0xb554006ee9abefab, 0x04dd8f7bbd4c5381, 0x98d22b3a31995549, 0x637a53de6b57122f, 0x8367d69b4c92da63, 0x236f2a9514250df6, 0xb265509af63d7b7c, 0x08522e36bc4b65f8
+, 0xabae725012ce8301, 0x493b257197a98ce9, 0x33185838570e5f0a, 0x65f5477ac414eb6c, 0xd002a36854699753, 0x2be693b4d96efdb3, 0x3b32484119bdc53d, 0x55691ac09a8fae1e, 0x0249e394514c047f, 0x765674c90b78171f, 0x1166f64638d6ab37, 0x746adba4cb52d18f
+, 0x93e293653dda6cda, 0x5d004ed52ebf0b68, 0x65c7c42d0ad96cc2, 0x3350dbe11cafca74, 0xc638cfa8942fef67, 0x0ff2dfffc5ac1164, 0x9e1b625e649aa471, 0x13a219d03d2eb86d, 0xdb92859ebaf9f7f9, 0x645c50918f7d5abc, 0x25c10cfe99f7e5c6, 0x13d858b53f90170d
+, 0xddb258b13ab1e7a6, 0x4849ff49f4e13fc4, 0x9ef87fa85511cda8, 0x48c50d4d3b4d2f7a, 0x6c98422c8007c9ac, 0x3fdd72e65a3d3491, 0x56b18cb165b4ec3b, 0x6e2c6df9e3fc3daa, 0xf6db5aa98ddc97a4, 0x423fd4082f3fb795, 0x42f8f5edf424d0a0, 0x1a091c2696139936
+, 0x3161c2bbb3b2d58a, 0x2e8d339eb0fb9099, 0x45ef7d11f6fab685, 0x7f222a068db3da4b, 0x9af96f9742549a7c, 0x55370df31dcec81c, 0xde98e81b131af02e, 0x58bd0622a474acee, 0x8ab40fa7ca882e0d, 0x5b4db195655f2410, 0x4754eb479ada77fd, 0x67a8a437d6fc8a7d
+, 0x9888254a4f0c9d58, 0x3232ba83bed0c618, 0x587b0de0207b57d9, 0x020df6becb096aa7, 0xef9e41052a29a8ab, 0x4ae671ee70a15a69, 0x167ce954923ee086, 0x6878c3996c1de887, 0xb29c711490ac097e, 0x1cf41a9c2577d144, 0x0590796ba46d8d29, 0x1c2e6dc8d4aebb65
+, 0xbfb904f8ac9b4cb9, 0x4ea1742c786469e7, 0x5a422f48401be57d, 0x0be0afdc77d6d32f, 0x5e8765cba2c738d3, 0x7dad0475059a089d, 0x9288ae0c40df7df6, 0x51c65f97715a16d5, 0xa9615d4c786ff9d4, 0x507ffe03ec0189ef, 0x1c1f46684604e41f, 0x282fe9d567db0efc
+, 0xebee7f8381fb8178, 0x5bd4b6045c208d57, 0xf35694743439ed71, 0x7cddd5a373ebc5ec, 0xa58df33cc68e3b5f, 0x40e6714f5c5c8df3, 0xea881d4bfd489131, 0x6b36400b491c28c1, 0xd4475cf594b6303b, 0x5b630cddc72e654a, 0xa0b587ad34394ce3, 0x3ea3ba6014f86275
+, 0xc3deac125d20eeee, 0x2ef3568410a2b3bb, 0xee6ba3fac5d7ec00, 0x5fabcb3337aaa23c, 0x6b1212e7b817889a, 0x0b37d285a9be51d1, 0x617ca543d762bf51, 0x0896b4ca694b01d0, 0xe3add9718277a1fb, 0x553dee7dd4784865, 0x904b8f7e936cf430, 0x5b6a78f20b244b90
+, 0xa2b876c2914b9bfa, 0x704de952e9d969f4, 0xb04ea1b54b7e7654, 0x5d307bb3949cf660, 0xcee4c23ebd049d17, 0x7a88293bb1031063, 0x00b8432b8286f656, 0x260a9c86a16216e5, 0xd140e6e6629d8686, 0x296011ff5601a000, 0x536f0f76cd9b2928, 0x267409c23a823dd4
+, 0x0f041043797f8423, 0x3da6102605962ca9, 0x2e69dfeea02098ea, 0x427e7eeeecd3a0c5, 0x75efa5e8a590793d, 0x1f5841df6dfdfc91, 0x1aa1e1b8b9f3c326, 0x07bd5b0983fcee91, 0xd169420be9c48939, 0x7940334f0bb9023d, 0x9bb330fff113764f, 0x674ff1b0cfe246c7
+, 0xe2083f8d7129cbab, 0x7e6223e3d9c04904, 0x9be411a7d5e883a3, 0x72642664e7c25590, 0xbb1f783b5c412322, 0x46716e8fd737280b, 0xfa363eeaeffde271, 0x6c256c131fc2c3b9, 0x13259abfcb2ce1d8, 0x53b96556e96aa708, 0xfaa7c8d25119da19, 0x05019f438e9f8995
+, 0x05e1d55a9424f1ee, 0x63e8e14e6c2f3f09, 0xe9d844e997a10158, 0x51904ed1e94a0ca5, 0xb09462d4df6bc6cc, 0x2ee5308e62172691, 0x3f8438484547187a, 0x62b92b8d9739ddd4, 0x3ca54ab5d39f083c, 0x25b3336048a288d4, 0x7cab0fd67e296979, 0x58ba2e783962cbb7
+, 0x77808f1a1b8f3515, 0x290c219ee7153bdd, 0x7584441f79128f01, 0x0442db406f5135e3, 0xe741de52ec030a9d, 0x37469756586776b2, 0xbd64c2a7173adde0, 0x2280b66d20888d0c, 0xdd1b53cb4adb0fb2, 0x3974964394c445be, 0x53b6a95e7c7fdd97, 0x6eacdc6f50496d95
+, 0x178d04c0578a5bb3, 0x0d171a5f5215c9c8, 0xfe0d0171c504962e, 0x04eece54b220495e, 0xac4d145001db67aa, 0x6577c466962160af, 0xcddae62d99686ad7, 0x7a053a048d230d89, 0x1ff09aa0e605a880, 0x5d260426f355232f, 0xfbdaf7b0b53aab89, 0x5eef31b9eb0df78c
+, 0xfb787e56b7276288, 0x4dcccba87d630d06, 0x415e4a4bc0a44b01, 0x0f0a981f71d8ae33, 0xe0ebb786f98a1502, 0x0ea4aa3ce70dc628, 0x8d36240617ebe037, 0x2d20c0e1d2002b5b, 0x336f8aa411a30282, 0x1d87c67d8178ec4c, 0xe468dff8ac26b63b, 0x266086bd7f11c9bc
+, 0x05cfeedc80d829f8, 0x146902a029dd3355, 0x413db9327c068394, 0x55fa413791f64c38, 0xe06395c10021bf9d, 0x18d66268cf79ce45, 0x9e7ae6858dcc21bf, 0x3ad51dbe97b558f7, 0x06792c747aeef43c, 0x27ec9b782170abb7, 0x6aafca394a23e935, 0x18f7cbd98db64112
+, 0x34146ce6b36edbfa, 0x1dcfb4eab7ccea23, 0x68498e1f45b35467, 0x1b20d71a3b71d412, 0x7a875fc94e602e3e, 0x78c15fa449576c2b, 0xb52326d01ccafe8a, 0x3f53f57324d70666, 0x3830836e39bcebaa, 0x27a30c73dd02c884, 0x5dfed73dedf2306f, 0x75ee4a8b6cf54f74
+, 0x97ecc9c5851a8e3e, 0x496b581690c3df2d, 0xf7bba1fe2d169e7d, 0x4b06184810a77bd3, 0x40e6d643b903c7bd, 0x3c90f63b5176906d, 0x92f47e1ac51f1ec6, 0x70c2454c53cc0dcf, 0xb5a75d246c653b4e, 0x7e5173a420a8b0df, 0xcafb44c471d0f4a3, 0x69a3a4e92bbe5977
+, 0x26e93183cdfeb424, 0x1e0489b56fa7e130, 0x669befa672fe9979, 0x0f8aea6a7ef65bf9, 0xff0b883ea96b51ff, 0x31a668763c3c8867, 0x6887a0029701c9be, 0x545644cd70c87d63, 0x537b6fb7db9410e0, 0x6ca227f10229b3b9, 0xc7d1b4d71ff22468, 0x522058d3b20569f9
+, 0x5f4bfd813a51fb62, 0x105b94a3a42424a1, 0x96dfdb685825857b, 0x14d98588154500bf, 0xb4db83514c7a9404, 0x67aaf998856faf37, 0x1229d7e95dbc821c, 0x7e617a17a2f72bd3, 0xe964cdba7222695a, 0x677619cc40a07eaf, 0x7f82c099a8df7538, 0x2a219175ec95a1ad
+, 0x755ac147b51ff3dc, 0x4a87f652f86823ec, 0x6d8d4a923f50278d, 0x4bb952ac98c0120a, 0x968c57a6a31e482c, 0x0855a11481fd5653, 0x3f05db6ac608d16d, 0x33f9e5746e1079c6, 0x1f3458e3ec51f53a, 0x4ae3fc836ceccf81, 0x3c0b2e2db5875ddf, 0x42336a1262cbb5e0
+, 0xe3651453cadc3868, 0x25081cfd6e80a2de, 0xd4cb31092872e53a, 0x16ca9349a11a9c37, 0xb1d3ae440d1cb675, 0x41b2d6ecbccbd6a4, 0x475e6a844c3d0ca1, 0x2cd0e0dedbf07023, 0x85ad446ddb002a6e, 0x72a06e5419a64609, 0x9e779387e9a3276c, 0x414a8163a9408b10
+, 0x25c7b53c1791333e, 0x3ea57190b42cd838, 0xbf20b346b094f121, 0x47570cba99b06c9d, 0xe6bd01c8746cb5f2, 0x3c0b0b8c4c0968ef, 0xb22009690e243975, 0x251737e4a5643da2, 0x3cdd49123ab89dea, 0x68748cd1e3cc45a6, 0x563746685effea7b, 0x4e4c5b1c86eb3a29
+, 0xe1ba017516d32070, 0x5cdd35a0c4ba93a3, 0xdbc66a0c7de30288, 0x22107156a0f700f1, 0x0fb69045aac0f647, 0x111dcb9763d08bc0, 0x266db39f6d78cced, 0x02a32587c7033892, 0x76fc94ce6a2a4b19, 0x474db0f12fcfa96f, 0x0c44584c08377ac7, 0x5f435bf43140f4c0
+, 0xb9741c3014eef7a3, 0x54596c23b536ff04, 0xeadf56bb6ea39450, 0x32f24f6e1a656b10, 0x21422e4dd5f54e3f, 0x0d6ad57853660607, 0xf6f62ffdd0bf9928, 0x72569c930015caa7, 0xf4293579931b9216, 0x049d6a4057e6827e, 0x6223e20060be0e05, 0x20d91ae969dfa9a4
+, 0x02611b345456d47a, 0x601dd413d1bdea0f, 0xe6b017b26bbc9bf8, 0x63399ff3d6542359, 0xdbdfe225045a9764, 0x10acd93346649beb, 0xc652d5a50e0535ce, 0x49efbd5639c4caf1, 0x65a5dbd8a304de65, 0x08ddebed0e865be8, 0x5db8337d5e715261, 0x34cf4c75496807e2
+, 0xd840c7416e44b56a, 0x10fd30d282d8b151, 0x36ffe6df2c1c9568, 0x66d8a38b6d31a2b1, 0x01fad3aa61984774, 0x412a9fd87b303d90, 0x2720945ee0f0ec9e, 0x0c91b4c7ea84cf37, 0x98462f25fd5832f0, 0x6f4cd578c490d842, 0xecc7d24c31ed3342, 0x580ab96994515fd8
+, 0x6d8a97ed98465b3e, 0x16995dc010908ae3, 0x50626a4e555b774a, 0x082636e5a8a9b568, 0xa99435cc4823b413, 0x41fc423d10eff4e7, 0x114236dce6f9f9dd, 0x6c3995c4bbe0aadc, 0xf3f22c975935753d, 0x6b1b3f27edec2a78, 0xdbadaac32ccc292e, 0x3856036f8a3795aa
+, 0x947154caaec01d73, 0x0a22e573e3f0f49b, 0xc50c949f39c184a3, 0x2aadd0868535d0c8, 0x22bc5bbe5f992446, 0x15d36adfca3ace90, 0x038010e37a6308f9, 0x161b06d8d7180307, 0xcfbf4e3abef8d056, 0x2a1765fe9c7696ba, 0x6a15d44ce18ef392, 0x5405239c0369de64
+, 0x5fabda1210f58e29, 0x40cbb03974b37035, 0xa29fdf2875322520, 0x3b32ace85edac547, 0x0f0c92b41d679df8, 0x7f07ecd47a7d2f0c, 0xb5fc65c05accc95a, 0x0e8b1da70636f221, 0xb2ebd131f4e8a846, 0x7df51e4aba57f391, 0xaa2f3d40fef689ed, 0x0ee1e115fde5d582
+, 0xf7d025b42e240ae6, 0x29fc1befeb526af2, 0x7c5ffcaff205e565, 0x4cf4d0d8840e2e1e, 0xb8b00d1810ad0ff6, 0x44d3af686ba915ff, 0x86a8fd1eeea8d08c, 0x3eb300adcf6edc4f, 0x8db03c266b588186, 0x289d0fd301e96881, 0xba83ba260cccc170, 0x26ee69546ceb0c77
+, 0x1109d8bf92c4ea05, 0x033aa036671937d1, 0x4bd9902e5a664a0b, 0x42bd48ed44fdbb71, 0x7359e19357a9622d, 0x0d6ee92855dae22f, 0xc24debb323643859, 0x4c60fee1e191766e, 0x3beaec0e99faa328, 0x056c2ae1709c5b0a, 0x7fe89e0c62710909, 0x7e3b5cd3ac4e6ce1
+, 0xe9d06486ac7370a4, 0x4b1a8c62e99f9429, 0xb11a50e20bc3197f, 0x75ec513c25dac300, 0xfb9fd064b1466dca, 0x290379cfce59308c, 0xca3ee3fb7db99943, 0x2af7a3e930faea44, 0x0d294e6d1505e35b, 0x7d534585181e001f, 0x90285700831d4cfe, 0x419f25105d06c90e
+, 0x5f71e79f5f828172, 0x02921e2a43326798, 0xa0981553e84d4a6a, 0x220c82041938573d, 0xfd2b5b78ef20c927, 0x3c99a2dc611caddb, 0xfb1247fd99ed2828, 0x4b3a3739f724890c, 0x7775ea2d7d2d1017, 0x3ab07cb5ba8ac987, 0x82e5123a20a6b5c3, 0x44965098aa82161f
+, 0x20948c77e9ac4c0c, 0x521e934ab214157d, 0xc8f4f4052dffedab, 0x1da963c2ef46f27f, 0x3be7631e212fa2e0, 0x0d188e88d1a4184e, 0xb4483ed385de4bae, 0x4ffadfde83d2b0d9, 0xacebd9a51a938608, 0x40968c0c9302b0e8, 0x85704404d06f3a5d, 0x3e9f477a61a26d37
+, 0x1da1efc7cbd18d12, 0x4fb87a47b9f2cb04, 0x7556a45e8b5c8caf, 0x7f6991b7723b35cc, 0x3fa10a169532635f, 0x15e61b1cd72bd52f, 0xe6b45dc3b4667c21, 0x45cf3bd4bbf39baf, 0x7343b0636a9d63f9, 0x457551c49ac49567, 0x331e611a3fcec018, 0x7d19e2584756b92d
+, 0x78951df174059655, 0x0573cd896a793337, 0xb3e37121fd458870, 0x3cc032b1a1bebc3c, 0x2571dd06d24d5a41, 0x017382ec4aa29ffa, 0x6cda850c15a224ed, 0x6af59bee2d7586d4, 0x287d3c4027f80ee9, 0x6aa570b9e51d4f25, 0xf29f327c5e0490d5, 0x00fb62f93f43edfb
+, 0x7b06e602dc313277, 0x5d8dc98e723b039e, 0x5bb61813041a589a, 0x2a4c9f13eef7f1ec, 0x9439edcb4bbaba6f, 0x027f4d494e7784ad, 0x087ae2a2fd6bbc8d, 0x230f37ba41aec2ff, 0x63876e43daaac09c, 0x28abd7ae6e17dbe3, 0xd354d50cf000982a, 0x1dd774a1273aea75
+, 0x243658930d4b0902, 0x0df50723a2da63d7, 0x22bc07b9ac9628c5, 0x134123d68aa939cc, 0x4e84ee2cf0d450e2, 0x53a8c6dbd4aa9ed1, 0xd06e741c45610565, 0x608da7f96f2f7e19, 0x59b7fc9fe6a0243c, 0x0da36bb46fd1eb3d, 0x09a11de836914182, 0x3becc1cc0b96f1e4
+, 0x820b8a4cad71c17f, 0x2a425dd0204a843c, 0xf6f7fdaae1523c28, 0x5fb74c0c961e6fb1, 0x0c76e0f72b7845a2, 0x273db117946ce778, 0x7a22d35cdea5934f, 0x73aeeb1b24265d5d, 0x938a618552e4392d, 0x6050215beb6c1923, 0xf32f6ab781efbf2f, 0x2e4ece5c476e1354
+, 0xf2a4a59613812356, 0x555185da018933fd, 0x2fffbf95863bce54, 0x72644f9c3181e7a6, 0x98c6b1d509e3d624, 0x5bddd5730939d7d0, 0xdd197613d550fbad, 0x7671fafa1facb923, 0x13dbb61148c5b802, 0x616bc5c73ccdc3bd, 0x0b175b4c46fd8871, 0x498a1eeb000ab870
+, 0xa49f1ca2d7802521, 0x6906346cce00be5a, 0xf1bc33c727dd52b0, 0x5d005ff3122fd749, 0x51318ad5d7c622e7, 0x50f93d6d15e46e82, 0x88dfa2123ffff3b9, 0x3848e6fce3cac6e5, 0x6cefc31a33ea4f5e, 0x0cc5e7dc4e5e144f, 0xee2009402e59a7e2, 0x257679fdb86f4712
+, 0x4cf68953d8b17e83, 0x710f970c16ce2070, 0x4000b8e9e51e6aad, 0x5af48dacd01f24f6, 0x209679d5d3fcc916, 0x0a3538dd7cbe8232, 0x2d6d7aba44d990d2, 0x46c718f2d4b2c1a6, 0x9953d799a378233c, 0x4f4e80f4a682e7a0, 0x9912f04acbb77eee, 0x317432079a195b2d
+, 0xaccccda6a1c11e3b, 0x3fd895817d0f3be2, 0x016db17673f750ea, 0x635fc619a24009b6, 0xb8447ab3370da1e7, 0x6c893aa19abf4221, 0x5f35ac703d8508d0, 0x13533d324d4adcb5, 0x84610370dece8512, 0x2223f126f9a70f4b, 0x18f00d60f3bf6a04, 0x174bd78b20ef8543
+, 0xeb179bc6a1698189, 0x732bf44a62015302, 0x98352342bc0e4bc6, 0x053f6640c1549e85, 0x65eee8b0397c7ce8, 0x790451f39f2fa27b, 0x36ffa0cb286cdb97, 0x46d07cec4c967bf2, 0x7c849ace30868412, 0x6dee239d339ef499, 0x8ab78548f273e57f, 0x01c5bebd8b7f5ef0
+, 0xe440e5f042eae93b, 0x65583f57fe057db6, 0xe6d5d26c24a565c9, 0x6b3b87a0a6ad702f, 0xd3f5d533117b8e64, 0x4addb9d0da92df89, 0xf1bd51990e0f9bfa, 0x30c624ec1dbcd0a4, 0xafaf2f00da7023a0, 0x3086e132b54574e4, 0x93bdbd4bfd3dd8c7, 0x690976ee132c892e
+, 0x86fc11c79524d198, 0x0f6b95662e02c734, 0x5b78bb385564f568, 0x55c9b3f55d7cd16b, 0xdf1316434ad1c07f, 0x093d67d3fdf312de, 0xa1fd2257ea57b3d6, 0x4b5b18abe4b54439, 0x66c28f5b59d796b2, 0x7baffe6e642fdea4, 0xb9d3753265e68ae4, 0x40903bd6dfb02d6f
+, 0x357958d4d72d6bc8, 0x179330dea4659dd3, 0x5a9ca85bc8721aef, 0x0209f09e03c9b225, 0xc0bf2e9738933495, 0x5e0dde4d715e50c5, 0x2743c96b66a6b951, 0x6af96188a0d6d358, 0xb2f3c72820f2a709, 0x5e9b8fd43327d9a0, 0xf0b13f5324012177, 0x7abdeaf4f741bace
+, 0x8e71f809c25204fe, 0x2ebb7b37d53ce671, 0x85117544f57e7142, 0x6b01295558ed3194, 0xb90518b25e20b15b, 0x4f72fa4b2206b35b, 0xa6602df22a663970, 0x78f110bf96701863, 0x1d9acecaf584f47d, 0x37ec8b293bbf2c26, 0xc89c96d1ba00d299, 0x027e7781c561153b
+, 0x66c5cfa9a1a9cd56, 0x7e13896c49e82652, 0x0d1460afb01a079f, 0x61cc409eec223565, 0x8dd12ab6e6fe042c, 0x526d8500bd504572, 0x1f013bce59e6b0c6, 0x6e534b5bef2d7649, 0xafab37aada602d46, 0x2dd66007052f56fc, 0x6ebfbebe82fb8a28, 0x2705bffa6f07b812
+, 0xce43976f5cd071cc, 0x17b2b48b1114283e, 0x5c5d694e10832c01, 0x38d73eaa3d389994, 0xcbfd7c6888529921, 0x3453da778a079eb3, 0x96bd234cb6ff0d05, 0x7d60e249da086be9, 0x9f82a6e305d8b42f, 0x4870861f46d686d4, 0x3e1faa1ac08b6aae, 0x3d05063bf1506a4f
+, 0x2a5e85a5c9502826, 0x2fa6e1efb48a7e40, 0x785524bd06117bec, 0x27045e44a71da6e8, 0x6e46490f768002dc, 0x5053040141dd4b96, 0x58063025d2d7c242, 0x2db4016be15167dc, 0x9eeba12779f58415, 0x1d809b0b57cf83e3, 0x61e520f2a4aacfb6, 0x208baef99ce836e2
+, 0xe2c10f0c33c3dd8e, 0x7d4fba6d1bb13908, 0xbcb44038069d9d3d, 0x3ab330362e680370, 0x53c08d994364d08d, 0x4cc00675b64c9328, 0x7c55f2417c60bd78, 0x7a076b37e98a7c57, 0x32a3943b5ddc41c1, 0x6b6b6d4805ad777f, 0xed4e6eacbcc5b86c, 0x545dfa661d921daa
+, 0xfac3b6fa9e45bcde, 0x7067d31e3606d834, 0x62e2f77c0c388a90, 0x1f8c4a45e268e15a, 0x8c235a561aaf8a71, 0x16d723d1e55efb48, 0x35fcdc096f8d2b93, 0x0e02ee35957feb94, 0xc4e9cb0c94e099d0, 0x6c82d2e9ef85d831, 0xbb449d1009abe03b, 0x65ae8419015276c5
+, 0x17ab5e5e9a506958, 0x01012f23fd36be0a, 0x71176db8e2ab8489, 0x5600051493730cbe, 0x6e2a8eceab8d9760, 0x5d1ca824756a40ea, 0xe65eef8bba6d95aa, 0x070fe6a4b2b99f31, 0xca87dc46a751dc00, 0x5cf8215977c03f9c, 0x2797ed152c82f3fd, 0x282c220d30b615d8
+, 0xc60d848380ef85b4, 0x466ff34cbc86a6f4, 0xdfd432c782c3003d, 0x3ed47a346efb1fa0, 0xb4ee56fee7636246, 0x71d7f76274c37839, 0x29fb6b5cd5d5645c, 0x1e8d49e9caf17e92, 0xa151c4ca4a2def2d, 0x651cf415587b245d, 0x539001acefaed426, 0x5fcf24ac44d1d78e
+, 0x74506f6fea5366ec, 0x0921d3a4b9b45ce3, 0x7bd958e7da9e021a, 0x5f79f6992c9224fb, 0xe790c1d3d439a24c, 0x624b31764efe3109, 0x2e9eb4234277a43e, 0x3815dfac4a74d61b, 0xa1768fa657b8a19d, 0x5451c4f3aadbd37f, 0xd4528af5e89f1483, 0x65c261d5cc9ce1e7
+, 0x8b1c97d39350cec2, 0x1e76f1cea5ec5035, 0x9bab43055e804783, 0x359d4e0ca3199be7, 0x78a2fb95b2321b04, 0x5be854f1f154e9a5, 0x8e5ad7920df0ca78, 0x4b84f514742b0b09, 0x981cc0adb06d0271, 0x4f4899a450a6f3ba, 0xa6c6329f318c1c77, 0x25317e4ab64c3867
+, 0x04541cf9aae38d31, 0x5149a79605f45a3a, 0x17d92d53439258f2, 0x29af42a557785718, 0x6c2c8121783c0137, 0x26b60a3eecb829b3, 0xbc900c3f94e19b78, 0x6a97e016957065ec, 0x8ff24ae2d5b10530, 0x1364872a089b6a8e, 0xeea7d96119b9faa1, 0x30add8d65f8a78fd
+, 0xc32e58e6c806d47a, 0x77103ea8c25e5a0c, 0x215e7d71ff63b7a8, 0x43323e9bf4cfbedc, 0x7cb89121cbceee75, 0x1acb18f16672ca0b, 0x17fe6fa1257d384b, 0x7ba64d3237ffb371, 0x3e6f197915be4458, 0x306e70df9f1f822f, 0x636d6f7d8fb977fd, 0x20be889a01c70b81
+, 0xc965fde4466225b5, 0x12080e91dae60580, 0x02c2ef338c535cf5, 0x0d2c10ba384f9a17, 0xca918accebfa9e22, 0x5923fcb5c79602b5, 0xf3b03f68686c07c7, 0x789523300aeea7a8, 0xd3b4724e163a5154, 0x354a2aea1811d8be, 0x2216c66bbcb3c5d3, 0x6d225be19e60baa3
+, 0xdffbba980494d2c5, 0x3b3a15134a3b6d28, 0x82d094f5fb6b2749, 0x7fcb7d84f7689b32, 0xb5d7cb569bd9effa, 0x6a3c542b3ea43496, 0x6df6fa1fea2392a4, 0x4415993164dec901, 0xa15ce34a5cf3e84b, 0x5adf7eec0ed80c61, 0xe62a93c1855cb291, 0x5e3fdaa143b775d0
+, 0xeefa426ddaef981d, 0x531187de36ea9a00, 0x8564d05334b3eeba, 0x283cd3c2f754b6c3, 0x96bab685f62f71f6, 0x440f1124768f0cd0, 0x37a57968a2e9b7f2, 0x090d288664157c3a, 0x7d06a0ae8166a93d, 0x55f3da40202663f7, 0x83c156f6cd4a8b41, 0x11ae2ad0b4889ea3
+, 0xdb942f60927c52bb, 0x19e863d1e228c1ac, 0x6bb95734382ac921, 0x191c5eb8e5027959, 0x18f78d73b4fe3034, 0x69070995079e4dcb, 0xc6dab1fefd565b53, 0x0280ee9e79333561, 0x6dc5147e9ddeda2b, 0x2883af366c02e9e1, 0xd537ca90f4b61207, 0x72cc8d7c00f9afbc
+, 0xa80c0839d175f0fe, 0x41a04c40c66bf270, 0xe4f2765b7333f02b, 0x4355c56048491dde, 0x23a0b91e1539fb3c, 0x385b8bef5a41e5b1, 0x501ddec6c07805be, 0x4faba2ed05e46c60, 0xf86012a3d9baecf8, 0x7f077e48bcb4c593, 0x7b47f80442ab5fd3, 0x7bac9e60e388a875
+, 0xff20916e79cce840, 0x6e92dae0be9aa6b1, 0x9abc9c2f874bb08b, 0x66b84e9249a9af07, 0xd079727d2c3ba7fa, 0x3cc9b4ab42bbcb58, 0x1c05140684e7f2d8, 0x42f2e22de9231b55, 0x5ed35d21a458f273, 0x04a69f1d834e8b5c, 0x6674d387d8e5fb7a, 0x5e39141f13be1f09
+, 0xc31efd596696a903, 0x65a5970aa107dfc5, 0xce7f339b9c57fc35, 0x05b60bc9c7035f59, 0x7ff6dd5217c3044d, 0x7d31a994a7035795, 0x8a09198268f8dee9, 0x6ae984ab888fed62, 0xe8f01994fbe2fc35, 0x02a9ab63fc82e8c1, 0x5ce65b755bbc6f93, 0x24964794b67fa80a
+, 0xaac9f48c42b00556, 0x24091c4f22b26312, 0x6d30fef9c8d2a0fb, 0x30c8de5b318fee1f, 0x6aa76f4817ddb562, 0x278652b800f9e287, 0x927f2407e8cd1d09, 0x06294595a9a38e97, 0xf74111dae605b9be, 0x124b573359096daa, 0xae705465e4b29e77, 0x4351062531f2c9b7
+, 0x3688d7be2f54bd47, 0x2d5cce8c7027a741, 0x247d908af9b4d913, 0x02b6599f9fd810e1, 0x2b19fcaf75b4700f, 0x6c5e798f7c301a77, 0x6ae183a3a6614a7b, 0x70a94de0fdbf2442, 0xd2be57bf6d1caa84, 0x59cafb9b651aefe0, 0xf94199db25d1f46b, 0x389af5b09e99e5ba
+, 0x090946ec986c5e3e, 0x31ca5014e71b788b, 0x1b98f5f759d206a5, 0x5b4b2ed46ebebd99, 0x737eb2ef00593d27, 0x2a3faa466c5ccb32, 0xa4389f7707854704, 0x159c3039c372f1e6, 0x5daf6f848dd62d4b, 0x443df3c7ae3dfbf4, 0x65b7ef92fc278528, 0x69772cc673419ebe
+, 0x964b3675619aa430, 0x5abf8400dc08d953, 0x208dbc74e84fc1da, 0x6a2f4f82bcb351c9, 0xbe8d9e42ed3c30a6, 0x033760a913eaaa72, 0x324fa89e69bc9f2d, 0x785bf8493d25b38d, 0xba8b6aa883229fea, 0x4cc358eba80a0ed9, 0xcaae57d70fc92f08, 0x40cf65a40431d67d
+, 0x5e3dea459af2ec88, 0x5faddc7f04f158a7, 0xb45816497cd240e3, 0x369488ee7753e717, 0x724e899b5e5ed35f, 0x79698731fc79651b, 0x4b00f97b0a51447b, 0x49cf38dfb92ff373, 0xfc63963f06c990d0, 0x7ac88a353752e3e6, 0xa352c78bd4972645, 0x3989f9343056644b
+, 0xda357b1b2faa2e45, 0x129a85e16e68a645, 0x7a4e8609655f311d, 0x13c3ca0262b6246d, 0xa0335043cce62d63, 0x0f38f2b155ec2e0d, 0x3eb848e7d8d637b2, 0x276e046a25f65cda, 0x0bd83b24aea42fa1, 0x06d509113cd37f55, 0xbc31d994df0259f8, 0x6843fb43a9fe7c38
+, 0x149a41eea59170a9, 0x5a7a674d1fe36faa, 0xe6facf24dcb20948, 0x05dafc6df4cc92e9, 0xef487c3fd45b5a6c, 0x381519a813c57bc7, 0xac3267431b6c5da0, 0x7fd0f99c768cdf6a, 0xb6ce90fbbab8b2b4, 0x26901123b37e3dae, 0x8ba9c65db9aa481e, 0x6fce3bd66d2c1ff4
+, 0x784cd711bcac99bb, 0x0120bcc18bde4f33, 0x279fb57d0a70536d, 0x218a147f3b8b5a34, 0x9b79083ec05faea0, 0x4f268eba938c2b8d, 0x4b4e96492b7e94fc, 0x725bb1014cdd2193, 0x2f629dbe04c9278f, 0x17eb19bc179fef33, 0x64c02c4fe71faa7b, 0x2bed16727da907f7
+, 0x0e94a2ffc6f6be1d, 0x690639746653d0fe, 0xea58300f91bb5828, 0x4a18fd6c3f37901f, 0x8d8c9121792e1cb4, 0x400aa105779f5bf8, 0xd36ed767f44bb2a1, 0x202f19a9d2581abf, 0x88d0c1437c525211, 0x7faedf80a8361935, 0x84ef1a6105f78762, 0x75ece1d7cd9fddd3
+, 0xc2473ce78ceb2f44, 0x361de3f71cf93e19, 0xafedd803d58ed318, 0x57eb005eb6df4d37, 0x890850d283902e76, 0x3ab8f0eb0a8ab5ac, 0x4274651ca2982a94, 0x73c1c2308a966564, 0x88b3f51ccb3ed44f, 0x788452138b871e35, 0xf50816cba5b8fb81, 0x73c834fe3f77ad7c
+, 0x13fc1a6ba6e718d0, 0x34fdcc417880b539, 0x1d2a67b1ce3b5120, 0x7070398d1bf28a30, 0x9ed3973a28644b15, 0x63e2a8fe4d0b74ea, 0xc85b211552d67cf6, 0x59edce67216b54db, 0x51e06f08c484ede9, 0x1195f6f6a803c734, 0x8a6c6000e59b6e7a, 0x5e17c3e93672fefc
+, 0xa1bf1b926a88f92b, 0x32c6e0dd70d99747, 0xca914e8568b06125, 0x42444a7080682234, 0x5133877cdd44badb, 0x4273ee7e23cc3f9a, 0x4ed7524d3b142478, 0x24d5c329a89a2039, 0xd3a501ffd093dcef, 0x2eba9190d4ce8fd6, 0x5ede149ab4f0be41, 0x2983f244322f8488
+, 0x126713647e566e54, 0x16388e40eccad7c3, 0x8b821205a5fa5a26, 0x3acbe8b3140dc8d5, 0x26b8af4fb4f65543, 0x373adc190e0fa48f, 0x5cde6e2938561c36, 0x5fa3a87ae6f764f6, 0x9347e005262af823, 0x2b2ff25c04c0d122, 0xef98973ee5594142, 0x19d9043228b7a62f
+, 0xc86d0b4c639124c9, 0x051952543e8a5559, 0x232ed76431076949, 0x2b4e347b77c7d891, 0x0e0c557f40d30524, 0x36fd8d9c29bc7d34, 0x59dcb743fff54c43, 0x174556b3f859bc65, 0x80869ed5a7e1e5f1, 0x0e928161e669f525, 0x61f8f37c763f8b04, 0x49b9c40144241aa9
+, 0xc93010076dda7c66, 0x604ecdf469f922fc, 0xfb74b5afd0b4a90f, 0x37a189e443c2cd2d, 0x29b1de015998a809, 0x76d09300cdfedd89, 0x96bca9d0065901f8, 0x7e519486c7547e85, 0x7afff76233b00183, 0x1231f594531dc973, 0x32e4265909a59150, 0x21b0eea2b2a29943
+, 0xe220f1174a206093, 0x58cbff3d1eb86cc1, 0x901cf98e01b233ff, 0x708e45c90d79fe1b, 0x51da253e4d41f6da, 0x250f59d34936f6fc, 0x8c243951f201ee99, 0x5f5ef56612a4f499, 0x9aae67e56e46e8f5, 0x0aba0529edc2aef1, 0xb806e7cb7a945d13, 0x5f039f7112c361fe
+, 0x1b7b5469d438277a, 0x04f460df77aaefef, 0x62a66add024f3460, 0x4ad2dd26c92be86d, 0xe2f4aa34b7f664b4, 0x100dad8137eb161e, 0x300e31b14659de06, 0x527287ef595dd996, 0xa55535c4e29d89cc, 0x584afe0e800f27bb, 0xc7b1a5ba9a0495f5, 0x36a876c5e4563883
+, 0x0df0cde7641fbc08, 0x6495f3152e265dfe, 0x80bd58ea4e6e448f, 0x010fadb86892b256, 0xe8bf34ee67602d81, 0x354d68ff6d6bdfbc, 0x1ccda767f1785419, 0x142f76cb1a8ae545, 0x354825645ae7d69d, 0x622b90fd445bfb21, 0x6252720cb0313854, 0x795dfec85a0773a8
+, 0x7129048cd8e4de09, 0x0861133f4d5a079e, 0xc1611d35b9de606f, 0x04917b99dfdf7934, 0x84842abd90ecc3ea, 0x68e846568197fead, 0xa0699828808ffb65, 0x026da2f93daba8e2, 0x92ec9524b3272c8d, 0x2a052b20553038f9, 0x876bcb3c1c62445c, 0x4f944fab9256ce6c
+, 0xa3ac7d43a1f2dfce, 0x47c371cf4bedacfd, 0x7344d6bd75760bd3, 0x0e18bdfb0f54f9a4, 0xc4b9f10e990d0975, 0x6e2d1bb7655cbe1a, 0x07ed391400d703b9, 0x184d0d1c065ad756, 0xb36d3ae1d0d08ee8, 0x6789b29a6688baa1, 0x3ecf4729fe9d6738, 0x565e257d4a9f3bc6
+, 0x3f7ba4729e6b3a98, 0x6f09bdbbcaccfadd, 0xb089fe953160883d, 0x39cbbc17206a22d4, 0xdb86fd9ed56f6aee, 0x0666caac0c48876b, 0xef8bb79152d81067, 0x31b36736d560bbdb, 0xcddd00eb58a97d0f, 0x362b59966ab84656, 0x2058d03cafc6bf9e, 0x062f497f0e198810
+, 0x1093932097ef6cab, 0x18d60c864cbaf808, 0xa6e8fdd3f0f8c3f4, 0x5fb48054709c0ae6, 0x6f783f5925eca3f3, 0x6b525bc9350c1672, 0x7be5a47a7c7d9d30, 0x766326ffed7d2e21, 0x83cd4a636e4e6d76, 0x56eebb8acd2f0870, 0x84517e4e7dbf9886, 0x4574bd5467b6c8ed
+, 0x7a7ff1e3245cab37, 0x1370a00345fa9354, 0x488b45431eace69d, 0x73abd5b17979434b, 0x5583cf146069ac9a, 0x1a25466acbce3b8b, 0x02726e9d7a32e59c, 0x0d2cc727c10aa308, 0xe1fd3f18486b065a, 0x4eb2ad3b046edd0f, 0x058d817876c8f207, 0x58101603c8158a84
+, 0xd48f531495e407de, 0x0815dc475d734ca4, 0x1e2207964340de50, 0x0be7665fbd1e81d5, 0x49608809236d1517, 0x53df7100a12d6712, 0xc193cccc00f8302d, 0x10092c1f8e918ada, 0xdf5ea38b52ae8311, 0x5e384a9c2c595615, 0x1b54ceafbafe51fc, 0x387f2316f19f845d
+, 0xb77176bf74263102, 0x1308720f342c1973, 0x388d6df3d782e2cd, 0x0e5f66ea020f8eb0, 0x5e807c53519e4654, 0x7de448c866485742, 0x09117741b9a21b3e, 0x38802f32184ed670, 0xcac6db447541914f, 0x231e8055f042d2c3, 0x9df6405aa9cec9a2, 0x49edcf18c499cac7
+, 0x9c3e25c06e7bb91d, 0x469e758cda673c7d, 0x8644dbc2d6861cf6, 0x0e1e9f70a8b0bd2d, 0x9fbd1a1fb44f1a2e, 0x51cac801e6b7d4bd, 0xbeb3e3c08c93475b, 0x15a9e19b0e54c6f9, 0x7079d3ef65061146, 0x57206ad88602d2a6, 0x73304a3d1f7e9c3b, 0x3178a8a8996a8c51
+, 0x15a68fbde5ae5eda, 0x4b6922bc7b73f1a2, 0xe72686267b52fcb6, 0x4d935777cf7e114b, 0x4fcc677352b2499f, 0x10cd2b07029ac98f, 0x598f129e72bb5924, 0x6df47b30b9c06a24, 0xca8af8de537e749d, 0x0852006d061ac128, 0x51855bc0a200efa9, 0x768269e2f0fbd556
+, 0x12425594dc966e37, 0x5a04485049cbc9ab, 0xc56ea1ae890c4be7, 0x48773793b851b04f, 0x84fc8838712601eb, 0x3c3e044b61db758b, 0xfc2fb331cb560707, 0x5b9e2d922f7a172d, 0x2d718614662cd8f2, 0x2d98a5e24f6971ab, 0xddbe6608236704a0, 0x40e417ca05dfe848
+, 0xb6e3bebb39845ec5, 0x2bed2597478ba3ae, 0x491070398b4cd694, 0x1709f6180fbac96a, 0x99ab8b396781dd85, 0x281a73c6fc10a8aa, 0xddb4ebaab8152203, 0x4cc0997933d4be4e, 0xb6c343df2f6d0da9, 0x78a457f003869d6c, 0x161a73896ebbcd00, 0x4044aaace3f9318f
+, 0x790077010498849f, 0x282a27f81879a31a, 0x11e11534f24934d3, 0x34491f9a036145c5, 0x90f1104872a44d83, 0x4fad286de6b30939, 0x7e431830aad1171c, 0x300c88b138185eb4, 0x7743b1692dd8f5ca, 0x4682f891a08775d3, 0xa75a721d610cc8c4, 0x3dc67ecf92bc456e
+, 0xff07604e842bea8c, 0x793ca6ddb49f4086, 0x9e3215935c6c38c1, 0x6c21f6eb852de4ca, 0xb7c7c06ec232ae3e, 0x6ce20da5e591ec12, 0x0111deccdee5ac41, 0x340535d608ccbe7f, 0x511278ff0466c5de, 0x46e13155e72dc5fb, 0x38b0d7c3f99e3713, 0x297f68d2f08531cb
+, 0x26b0b55122022f4f, 0x69e8409b93820745, 0x434b1f0f566b56bd, 0x0373bb6ee7147406, 0x63c751f9ea0b6e05, 0x3f36ce6206219445, 0x555cf69a012e7e2f, 0x55b5b46aae15755d, 0x5de095e1d991f315, 0x15c43b346f5e645c, 0x818f56b9509a0dca, 0x21e19179d8bf822a
+, 0x96b3ea04d4a02d94, 0x0715c5df4f4e301c, 0xf0dbdaeed67a365e, 0x479b96def4aa47dd, 0x421f3e23ec47ab71, 0x343f303a8c43a06c, 0xda49a77fe98f8783, 0x5aad9c070bf35fa6, 0x400bbe2180df1d8c, 0x21ba4f4a3833f2eb, 0xc47e682f767b6c7a, 0x79edd1ac87b93148
+, 0xdd27f133299ad173, 0x7c3764e1e8b0cd7a, 0x727b539d92057631, 0x2d68238b34898bd2, 0x50af70f092df14b5, 0x3f921a543f9feed9, 0xacb93ded5ecbd9c8, 0x1ed8c6493cf954a0, 0xc48f397dea1a132b, 0x6b65f8f7e62d03d5, 0x773f00807a1e2c4c, 0x319457f073d928f8
+, 0xe2aa20b1a07618a8, 0x4b9e0df0162f5cf5, 0x3ccdc39e1a097de8, 0x3d1eb9ef9c8819a8, 0x913c80ad1cdf2cd6, 0x0bb01886a7d65d15, 0x1afb6429ae2caf6c, 0x5683edb458b15017, 0xaec2b62ee7ba3c93, 0x347595f76d5bfce1, 0xd5cb66bb516c6792, 0x52d4df4c90db9312
+, 0x87f0d16f778c5957, 0x25349b2e3ae4aba5, 0xc4e820668b0b1943, 0x309eb38a56e8ede6, 0xa58f46767433412f, 0x349df803e450b56f, 0x90f8a3dc32561b64, 0x68299577d7ec049c, 0x02e498c987638aa2, 0x40def94d56c26322, 0x7bf3e0ff5dc05d94, 0x6a7577fb1dba380a
+, 0x88207101c9de1eb3, 0x471ef15fa62591a2, 0x106ef3c6060df999, 0x57e835eb59767ef7, 0x7296a6b4fd8084e1, 0x0ce22202d2134ab9, 0xaee8a6947d4b4ccb, 0x54adf0506f5ba563, 0x67670b437f6fa9a3, 0x1451f92421a875b8, 0xb27071865a08646a, 0x17b5e80ca4e5804c
+, 0x004f53c3e83559c6, 0x4e3cdc1d57afd566, 0xc7f89433af15269e, 0x4c74bcbf65089d37, 0x59eff80fe1e89aae, 0x0745f3a314b88583, 0x2f56770f3340e34c, 0x028e96175283c32c, 0xc2f678af26f5217b, 0x3af473011b8dd8be, 0x01679a007fa51fb4, 0x6d2a917665f524fd
+, 0x191c2afa4db4d78e, 0x4be9d7d2a7fac6d4, 0xb34a933bbf7b5457, 0x189953267b5612e4, 0x655ccde463e80295, 0x1fe93c2b61b1d5fa, 0x4e6e69f72417b79d, 0x1592d5d28ce76fc0, 0xc2aae844b793772e, 0x0f8d3c473825e455, 0x7b0d1b699be576fe, 0x67c89032af27ecbe
+, 0x5fee28add67060be, 0x145209fc4e6c28a5, 0x3d0716237a2b6064, 0x747881bd4b644698, 0x01fc6178169b6c17, 0x115b5fb6183672da, 0xc593e5e3d4004d13, 0x579cb584923b71e0, 0xaae7bbcc462122fb, 0x294118c3e8cff0bb, 0xb154b16e6c8df4bb, 0x053652583138e231
+, 0x0e30e7ca5a38eb8b, 0x5c8f47a48a18da76, 0x75a337768705165c, 0x1ed2b9b71d81678e, 0x69834fc8fda114e9, 0x65ff3d5fe4d38549, 0xd62300c2f923cc2d, 0x4178b7d593b5a2e5, 0x0532e4ad5051750a, 0x0255a8390653983b, 0x1c4521edfb1fe8f6, 0x2f3a6b5010a72a00
+, 0x79152cddaffd1af6, 0x0f0a79cc85a61075, 0x0fcb457a098c0e30, 0x710418047ddfe63b, 0x366871970b08ecdf, 0x5c763652aed2d420, 0xf7d2e9ef4c8ad532, 0x4a43b8c44e6d2ec3, 0x74120dae518db896, 0x53f801ebb099c1db, 0xf20eccce61d1dc89, 0x5f39d6c4611d1468
+, 0x02de175930926fa6, 0x5e726c6213ad4d10, 0xc0dd566b50aa3316, 0x63f1eb7c74fe33bc, 0xc573ea0c270a7a61, 0x6f6370d7375d65fa, 0x104caf5d18692f6b, 0x09fe9242bdcf3ed0, 0xe0d8047ab16d1934, 0x0b398a0e4bafe9ff, 0x2a576abe60dbde1a, 0x58454afc7f54f4ab
+, 0x5aaa8e3ad187b67c, 0x25d3906fa2e258b2, 0xa7aefda45922658b, 0x6ddec43a0d046c94, 0x6b8056b7f76456aa, 0x712add84b4b59e5e, 0x215f8c303db44047, 0x538f845755a9e7a7, 0x0461f38f90b6a341, 0x7fe9eb795922019d, 0x4848b80fd8f3bcbc, 0x2d99757886a153de
+, 0xe3adca3e20eb702e, 0x7d3c0503d0a3f409, 0xb5a8e41208d5cbbd, 0x7cb3e4229a27456b, 0x3c28a52725fa627d, 0x01293a82cb1bddfe, 0x372ee1d727a16903, 0x232e7afb711415bb, 0x51c3021c51eccff2, 0x0f10e2bc650801f2, 0x037cd776971c68fc, 0x33d3f2707632fa69
+, 0x6f006249351471f7, 0x3204eb91cfe9ed6c, 0xe09af1c83c13afa2, 0x6d70ed88d5de535b, 0x2078873d1a2faa1f, 0x5c73bedb8d96f3da, 0x41bbb407a3a1ce1d, 0x7a40ec2fb54eea85, 0xd6d569cb9dd722e3, 0x10acf67805927b6a, 0x27c61d818cc0ea05, 0x57b175c9f59904e2
+, 0x4f7b40bc92b5a60d, 0x51431f647b46b89a, 0xcd84dd55cc2a720e, 0x6b36059700809a1c, 0x78e3e5dd060e9a0f, 0x630c0c1a146c77d4, 0xc9925b0dea8fee2b, 0x4728f0604b16a06d, 0xb4601050635b2318, 0x2484f7281864709b, 0xbe2ed2a2523211db, 0x6425d4ff23dd3a5b
+, 0xf0868c09017aef5e, 0x2733d1e1adc6d5ee, 0xa631db49f17f87e9, 0x36d753ced54d5727, 0x451d17fb6c4af537, 0x1dcc4d611dd55b04, 0x0bb8de0c8d3e549b, 0x2fb2ca1271592c3d, 0xd877914ffbc31ced, 0x190809a196504d10, 0x44bdd65a970277e3, 0x13195c678b4b01fa
+, 0xe69a41a54f84d41f, 0x61c7c870565e4508, 0xeca2d2fc6f0e1c9b, 0x7f065480e257152a, 0xfaaa9f7c3a8873b0, 0x43fcdb8db58a324a, 0x969a79026e9da7a2, 0x4eab135af328b9d9, 0xb38aaafe87f85f7c, 0x69eba4fe1a6b6f32, 0x5607f6c6b4d27cbc, 0x273072bea774f9e7
+, 0x3c1149e3c8d51db0, 0x161f8cd433c28bfa, 0x765a61f218fe70da, 0x442b5d405f2036bb, 0x96f790271c564cc1, 0x3d5dbb33505cc956, 0x621a38b446af395c, 0x2da978b45bb70ce6, 0x755aca711da49388, 0x46f2e33e55e86df8, 0xfc5b454d5cb7be24, 0x67df47d68d8f6d12
+, 0x7a1e224893898aad, 0x0400219c89c2d13e, 0x6c969e4d63d460d9, 0x4df64d5df8b60ad2, 0x1feed05a45ff89ed, 0x290c4b59e684b4ef, 0x97ffbc3df096adb6, 0x4ac6037e76561c96, 0x1bc40299115e51b1, 0x7169e0a1d96aa1be, 0x43f55f8b6bac596c, 0x1cc6a0603081a178
+, 0x8e1d2db69bc925d0, 0x6ffb86eed51d2931, 0x3ad1eb242e0af1b5, 0x338198152fcd6d7c, 0xc1f381496df13943, 0x05d9242fe1c60b02, 0x39617510de7eec81, 0x24d8ba5ac76b12b8, 0x280eb2db9e548483, 0x6c51317b3a8a93f0, 0xb2a9f90939bd1235, 0x2da9de86c39f9aa6
+, 0x7f54917103127b97, 0x7be2be5ad3276169, 0xc969d703d31e9da7, 0x0500df3bbb1f8a4e, 0xea05c77685795917, 0x049575a992d09345, 0xd567f8de2daabe35, 0x383fad35a8e035cb, 0xb9353eb2bbd43d56, 0x52b3953221860c5a, 0xf9e4bcd46dbec03e, 0x4b0db0b4a7b3279c
+, 0x8cc5f6b6e1ff80c0, 0x1bd2ce464b552215, 0xd008eb25b39c4236, 0x3b4ce5bb2f42a9fc, 0xe1f249681d153d9d, 0x3e022cb14bc4c5b9, 0x8a11d021c8ed5a53, 0x560d3fb258bec495, 0xf4405852705a6012, 0x5c8bccd2b1b3efd3, 0xd93c0f63ba7ce0c3, 0x337798cb3e93dbba
+, 0x7a9f68cf800c8e88, 0x579afe689f3ebcce, 0x7dd41d6cdfbdb4a9, 0x3802410c4e1b274e, 0x64241d770cf0db02, 0x2f7c8133c74bde23, 0xf3c3fd835ed1952e, 0x741b1d88a3cee37b, 0x74e1ae644683c68f, 0x0c80dd9e0f7a91e1, 0x3984d741f3e47c24, 0x4b3eb97b6a39d252
+, 0x32e9b9410da9a195, 0x11d09fdc04ec3b41, 0xf92fd5e53cddea30, 0x296e095589e0ce05, 0x4e3200c3a283b696, 0x7e33fbba44ecb32c, 0xed3c039790ad0033, 0x5c8ebb260b5ec084, 0xa667455bb79d2e9d, 0x12fbec9d4f5bb155, 0x3aa5f6bb4d0d8d49, 0x0ca652ed7065d80b
+, 0xb7938753d51c6f83, 0x41644ac1a602f9f2, 0x84223d4d63c38f7d, 0x71057b4b8b931282, 0xd39fa015165f47b5, 0x7536c8a19c33c201, 0xbe713ca4166c2dad, 0x456c98c2b4198511, 0x4793f25e1cb44658, 0x1d002f1cfe1a1ba7, 0x9f9ed6e1e1a27957, 0x095dece028426bdb
+, 0xe57d3412fc1001d6, 0x481c63a0d9b25e99, 0xc756b6ba0dc02aa5, 0x24af047d79ed4683, 0xe37ac10133b68275, 0x418b45e570802012, 0x87578def0c3900ce, 0x7c5661923b8c9740, 0x5f4ab0a6fdda7366, 0x0ac6100825e4eb3c, 0x308528e42c9e4d32, 0x436e5979933ddde8
+, 0x0cd6ebe123352222, 0x63d1768a46f33dc7, 0x96cc55dff38c9273, 0x474438da7140411d, 0xa184b89b81cf6402, 0x6bf820a3aa675050, 0x3bd4720417391f0e, 0x3f2b8f859a8e0cba, 0xed952561b125da29, 0x07eb1ac74165097d, 0xc3f70d0c7db0a9fd, 0x5ab896a489294a6c
+, 0xd4b608975c20018d, 0x6243b039f25d0456, 0xf766e98fc24c7464, 0x20035c09d2291e42, 0xcc0e5b5eeb462524, 0x24bcba5505f90657, 0x43a98d98e4fa9bf6, 0x3b621ec4188264d4, 0x633472fe235c812c, 0x31a20844a3316d23, 0x47b80db7d7f5d0bd, 0x22d482f5663780f9
+, 0x4df227dc52142020, 0x25076d0624bf137e, 0xcb4a6ee30a657645, 0x0ce469dbb5ada433, 0xfdb06251f65b9c5b, 0x44f82274a8e8f538, 0x98fa4c81cdec4b97, 0x0ccd61d1abb61d0d, 0xb9dc371344c5ab54, 0x35dcd9ccf8e5f919, 0x67fc81f369ba5722, 0x121b5aa1af6024da
+, 0xe0b1b16b0fb1f1fa, 0x4dc688d6d3b1805b, 0x05c187cf10e40104, 0x71af39c743daacd9, 0xe691e97f82acf4b3, 0x0c46305b9243bf5b, 0xb063af137fde616b, 0x4e26e72a1de067f6, 0x61fe66d01a221004, 0x172fe9240cea50b1, 0x4ff50d37b2effefc, 0x06be02ab0b89aa5d
+, 0xdd4aab96717af213, 0x32322555b58a7ffc, 0x7812aa965889326d, 0x1bd608f60d6457a4, 0x2c7b6b44e999e141, 0x113a86a87856a8a8, 0xd95469fc33814855, 0x4a18dc36f6bfd586, 0x0706b60bdb854fd3, 0x4dc356685650fa90, 0x24ef7cfce41f8dcc, 0x19049c3e632deae8
+, 0x5c9a4e28b7138a89, 0x0f0b7dbc1e5087e2, 0xebf49cdc66a362d2, 0x19e4b815e6576c85, 0x1896051ee3b6063d, 0x09ecc741852a68e4, 0x4009034def986795, 0x36b440ff39b4b5e8, 0x9bc2647ee28af1cb, 0x62613c9dd152b3a8, 0xc2018ae5dfae5f2d, 0x29ce5ef30009c855
+, 0x0b653558b21d2b1c, 0x45e2c505d1f74936, 0x48304373240553d3, 0x0528569885a82310, 0xa90d402e33924181, 0x5e610edc23cb9555, 0x28890ae7e007d28a, 0x7e5132b6b1ebae37, 0x0d5252eb7c94cb1b, 0x308ddaea1fdbb672, 0x99fac0b431730534, 0x77d54ed63b9325b9
+, 0x4d647bcb76c6ec3f, 0x0e968b22ec2cad86, 0x4b22b5ec30b08a35, 0x3b31df3b52326b5c, 0xbe84f638dac3105d, 0x7db085f133ecbed3, 0x7a8b694596f2cf2a, 0x67b2e6c15d16e0aa, 0x4808b20bf173011d, 0x25d5fbbfbe66f864, 0xf67f3f3cd9743987, 0x654250e89617ddf3
+, 0xf5a1a7e0ba0a88c0, 0x3616c781799ab50a, 0x2669c27a2d256902, 0x3a8ec380e12fd7dd, 0xa25361f44a418e30, 0x2942f3001d233645, 0x60f1d3b7535a4133, 0x14deaaa12e5c7bdf, 0x0089fbece10c8d6f, 0x4bf7c313757c803d, 0x65aa30bfbb70567d, 0x4fed47af409a3fb3
+, 0x07557dd875d3daf5, 0x36c49c2380e3c9bb, 0xa21f643d329ae02f, 0x6cf6f7474338bcb0, 0xb5df78136a0f3012, 0x031fb2df2e00e9d4, 0x4d86fccbe75e79cd, 0x23f890e082d03b7d, 0x5716a1ffb50a8262, 0x0199b50aa6cf3302, 0x6a1be351f86090d5, 0x36095efc13349364
+, 0xffe752be8ce46920, 0x65047a340b652f65, 0x320ee55fd03156a6, 0x5af6aa45278409f6, 0xa6caf283b1cf3850, 0x4e3a988f61072f96, 0x750f67926b18f680, 0x09fc3f2927d21a4a, 0x914893c2f2ce1169, 0x4d15b367121b3e75, 0x6cb12559723774f2, 0x3ee5b8c2a70e054a
+, 0x7dd9b3518d84d2d7, 0x147d5a5a53f57a58, 0xe1bd0904ad842a05, 0x3a0f3b029c9a5845, 0x7153c03261410074, 0x4e203d6737058c17, 0xebecf5cb79f28af9, 0x574b889870c279f4, 0x326317b005f444a4, 0x7480da44b34f4b1e, 0x7c5f21cdc46275b2, 0x210494b9ee24e4e0
+, 0x3cbf6ca1f4aa4ead, 0x6bf3872ccbfed940, 0x19e8a84673a566ca, 0x61a80e16990401a2, 0xea2e029e7f9b3824, 0x5762298465f0ebd3, 0xf60e36d4969f9af0, 0x00b826180531c799, 0x17120ec95cf3c61d, 0x47196cd6de85c7d0, 0xb0d47cff46a5cba3, 0x29271400d7ede26b
+, 0x835908353516b894, 0x4bc57f8c1eedec8e, 0x2ec5deede5c0db5f, 0x7b9fc48ac4a689fb, 0xf82ce6de88fc10e5, 0x6c5d84a70e03a3d6, 0x88a211fc4ea531f9, 0x7d5583e5918aa03e, 0xbdf2d70766fb8f39, 0x5926497e734ab18a, 0xd6a9872b800cacb4, 0x757c1cd521fd22d6
+, 0x22d50b0c13ec4bc0, 0x288a77d34a15e99a, 0x95c8e78fced3d4eb, 0x45ece109c15be169, 0x878ef262d0132128, 0x48110e9fd98939d6, 0xe3fc5425d2e7741e, 0x050ca6e71f599c65, 0xe02f97605d9fe375, 0x2af48b9bfee410e4, 0xfd34a1c107229a54, 0x43dc6f0cdcbd41fe
+, 0x15b4eb7d65cc562b, 0x369a7b0dd3e91248, 0x2b087611edd32810, 0x116b234ddce09d7f, 0xcdb03cae8e90d2b0, 0x4017d51587566038, 0x081793739242b600, 0x5086e8e633cd52a1, 0xf5ddaee155cb8087, 0x773311b60d59a7e9, 0x36e5aa0acadf2068, 0x7126a4281b192882
+, 0x54a10df54f7ecef8, 0x3cd7d2fbb6e33f67, 0xac31eb6c3e740c25, 0x517db54840feb2de, 0xf17cb269b3ce27a2, 0x04a8fecd1dcc99e7, 0xfc887c1f2f85a2da, 0x280da7425bb55b01, 0xa1af72f5256a5a53, 0x71da839fc459f465, 0xc203fe7ba6587f71, 0x08a4201f77a4f335
+, 0x6cb9ea5683014d96, 0x5da17076b6b51ae2, 0xb55ac168c3e3997f, 0x41b9a32373d78f7a, 0x96f58033b8600a50, 0x6ebfba3ec9d956cc, 0x0ff8883707d66d0c, 0x2f562b035445226f, 0x2388fc015bd368c7, 0x2b7d802ce27f627e, 0x301f0369c24083a6, 0x77e139f6da8d5aaa
+, 0x9f78574697fce43c, 0x02726c94565421b6, 0x1ad6007338e26585, 0x6134cc5eb35c02ff, 0x77ae739c9cdcd1e1, 0x04e96543233c7a13, 0x97d3926dcded2e10, 0x6bcdff7e14cebb73, 0x9c46ae2b32489774, 0x04a97b9a0473af8d, 0xb0350bd910d9784e, 0x448212d3e2164ad7
+, 0xf3464e0351f5e995, 0x68ab4d24b3ade8d6, 0x86854d534002af20, 0x613f7ffe5de92aeb, 0xb385b4f4608a370a, 0x220dccecbc6f2688, 0xc31ec5384abd3680, 0x25a82841a2000fd8, 0xd19e422504694236, 0x0bc1124d541781f5, 0x0808651edcd99176, 0x41b81f223d429c76
+, 0x1a6dcb2662cc80c6, 0x0b101fb0ef0d1f74, 0x6f02aed8f8327119, 0x5b4c5176ccc4a340, 0x8fcefd200d6ee8ed, 0x0548127287f44749, 0xe1efeca1fadd1341, 0x0e74bc189dc9016c, 0xe90470353f46cb12, 0x69513d3455bc890c, 0x9503686f1f2497d1, 0x280a0bb7733f1086
+, 0x14e5f99930a91dea, 0x7840ad84b03c3878, 0x46e32c654fdbceb1, 0x7e88d2822bb2cecf, 0x4d78a8aed7f8661d, 0x70eb17416ef40180, 0x97b6f1733c474a10, 0x3d0d27fc4c7084ef, 0x730f60f6a1ee0d71, 0x7bf6e3885d3d9302, 0xa1e8af33742f1611, 0x73b798ec129822ed
+, 0x0f669bb094642a70, 0x142927de789fc4a4, 0x0db18e01fa98cbd7, 0x6ae4d37674be1451, 0x7175e98f178b4b74, 0x40534e319bc52c6c, 0xb7211d252c4db879, 0x1a7651f8f3ed1aae, 0x9c9a43932d50cc97, 0x630b232b7201c359, 0x327d77575f5b3839, 0x5f0e19e78431864a
+, 0xbfbb00b6530a3bb6, 0x19ba9d60d97f7857, 0x759779de744bd764, 0x5facbe63177791e1, 0xc74ea511c56a3b61, 0x1d8909e84083c31d, 0xcd20094b507af492, 0x2ef1b9c07c92ab37, 0x8430ed9ef8494fc9, 0x3f9170e6df5b1fa1, 0x1fb8dbc837175d73, 0x65b961b58008d022
+, 0x7e1afb6816864b6f, 0x54c4b92c534871e9, 0xc0a1dcd60d61ef84, 0x4390f0e992c41298, 0x1e54e2c8b7c27348, 0x7a987e01a2ec308c, 0xee42fbd90c4a89fc, 0x1ed8c77f8d7c609d, 0x569dedaca99a3346, 0x0eb471e609fef4ed, 0xc915522a3b9fd03c, 0x726453b246746bfb
+, 0x4ed3cae53dc5fa4b, 0x1bf1e4b34b9feef6, 0x0850df9f0401fac3, 0x0a58d33cb2422e2f, 0x3d197f9603ecfc29, 0x45e46edba1cc432e, 0x96c0c93310d9bcaf, 0x18de3a458be2c33f, 0xc9e65e5bcc12a49a, 0x71a5345f0239b187, 0x53b3b2f01c5710b3, 0x438350f57ce2ec4a
+, 0xdbbd368a760391db, 0x4033638dfec29fe2, 0x297ad75ed73117fd, 0x269c08d54b106e8c, 0xa4e3e4fd238b4218, 0x1f48a1cb09208aaa, 0x9575153115cf5fa7, 0x59feeff0876fb74a, 0xfdedb4af6f368710, 0x79be1fe79fa674d4, 0x689d6bbb4c707c39, 0x394a451499057bb1
+, 0x5887d4fb21fc43b3, 0x37628dfc4b5c23bf, 0xc66b76944b34bd13, 0x6e97f0a8a45bcb36, 0x3ac6b10139edbbdd, 0x313f4846b6745833, 0xf8758d9777cd9037, 0x02fdc98f02692537, 0x9e79f381fff833a5, 0x25ac5d68c49b105c, 0x1e9f48a076d8c9ee, 0x788c85c9fe9543b3
+, 0x776ea51db3b3b778, 0x0007c44055b64db2, 0x3c392c2a82fddd25, 0x65000203be8ee976, 0xea119666ab7c50ab, 0x528b2700e8f82d39, 0xc4aaf797118b8282, 0x55e5a7d5382e0d3a, 0x15a80b22e89f1039, 0x199f68594b1247a0, 0x8d5630750d622435, 0x2687f48cc6def5b2
+, 0xa16b0c0259eafaee, 0x7aeb10834e93595a, 0xe31bcf34ce679d9f, 0x4e2c19829eee3c87, 0xa46869cb8ca35c9d, 0x3cd35313c08504eb, 0xa088eca66e98389c, 0x44c562f0f7262740, 0xd3eb8a28f447523a, 0x43a0e059bfe37576, 0x0312c5d6d0f2e0ad, 0x5f30aaf0d1614c61
+, 0x6f09a7a6e182b0aa, 0x575db3d21a82296b, 0x6599bb5eee7925e6, 0x093f89458dcc2fe3, 0x70c4af785151fc84, 0x1230c0c519de5480, 0x0e66f8f93075a4f6, 0x5de4a122633a5c6d, 0xdb99cf83f9ece1b6, 0x1c3acd4a13ded617, 0x4dfe69e68f59c447, 0x482ba1f7715a3c16
+, 0xefeed2a7c81ea8fd, 0x4e089eeb713a572f, 0x78bc74acfbdf322b, 0x4b4951ce8eb86fbf, 0x0eafb6b46ac6714d, 0x72913ed109f7d404, 0xb498bf6fcde9e3a2, 0x3c08a283ef5ded62, 0x9af09f593a48b346, 0x7ed52441d00d4980, 0xa78e843ee5df44ac, 0x25db12d420a86151
+, 0xec840e7e89d049e0, 0x5a34cbe928bf96cc, 0xd875dc5525da882c, 0x2af4442fc256827d, 0x089fb428c2ef5a5d, 0x0b573ace080a3d9c, 0x6f57282554c240da, 0x425ceda6707b6bc9, 0x94b5a8c3dde824fb, 0x264f6f6a445b5da9, 0xadf292191c5c1eb7, 0x5e302e82fa4e5533
+, 0xf51712fc44237f35, 0x2b0af62c42e56e66, 0x10392cb4d9c71b75, 0x4d7e08fe8457a95b, 0x210b9eceb04534bf, 0x73329d1c7d88e1e5, 0x667a43fdb4ba79e9, 0x3435ec04276ede87, 0x38b8540a1a78b098, 0x4f6c266e6793bb78, 0x447ea35172754041, 0x109d7b742d8c3dac
+, 0xe3ccab45d2a4f6f7, 0x59040bb73f3bbd2a, 0x730b39d65645bab5, 0x5c61aed2f83382aa, 0xa992143de3cf83e1, 0x13455cb889b700f9, 0x54648228b310e2f7, 0x5b837752ee0f733a, 0x3923a6c0e5ea0dd9, 0x5ebebd01fc9ca9a2, 0xa34c205b8fd94258, 0x7d1a10029a0b6cd5
+, 0x6c83c02241a46527, 0x4127c85d6be1fc62, 0x26f86ff5ca7240b6, 0x2167391e7dd95cd9, 0x79227506ac78caef, 0x1a2cf919b8832a0f, 0x07745266405cf574, 0x38095a07f5713ae1, 0xe5eeab985ca3e7e7, 0x6a5dd9eeb734d639, 0x991027ebe44a4822, 0x311085fb4de9c1f0
+, 0x33f361e21066c3b5, 0x550091d2dfc8688f, 0x376345c5532bac13, 0x0aa0898f990931b5, 0xea2f3346e5d3226e, 0x208790ab78776afc, 0xac7c2ae63433850c, 0x3c5c373ada10ef52, 0x96c1b4003f4cde6a, 0x4546a9c475c09781, 0x6c961fd3e8536294, 0x43f36e63fc0d5066
+, 0x296601d8c42167f4, 0x241c1fc38565471b, 0xdb00a27e11ce9617, 0x60381181b7e7e4ee, 0xc1076b7635ac4d52, 0x0166010ffb8dda38, 0x5238f69becc43e0b, 0x63303a2015708b17, 0xe8badb2e5bb22591, 0x3a10a4e218b6131d, 0x236ab01aabf1a7b3, 0x1ce8a51a68a4126f
+, 0x59e775e2a2a87928, 0x770b48eb4b738301, 0x0b43c2be176bf79b, 0x1957850fb6424660, 0x44455ee1ecb0ab2a, 0x620ceaa116eef4f0, 0x0198f62cb6183f6b, 0x3274f78eaf2d55db, 0xd2ba4e460cf7ed5f, 0x19cfc17bc0b66f43, 0xcbae6f45b1942722, 0x5d93e44739147b58
+, 0xd07180b9d28fc597, 0x35372b21b2ea5a46, 0xed2673477f083464, 0x7a9ebeeecc57e6c2, 0xb51d991a81a6b314, 0x35e7d90f4ed6de58, 0x45f21e209510dd05, 0x446ffd2715c8d380, 0xe69b5c7a9b6d3e76, 0x1379e79fb96912e6, 0xc161c848bd508738, 0x22264a049d8cfff6
+, 0x32321a68ff7ef7b3, 0x57b0e50cc585b333, 0x1c08c65ba9d764e7, 0x5534c793f92f00f5, 0x7a1ced97eafe6fe4, 0x6b8933739202599c, 0x618c5f8fcadd3ff2, 0x2a8719b3e6548653, 0x346a9ec5c4200f0c, 0x7a36b8d00d0eda58, 0x844b22b75021accd, 0x769737059fc5e465
+, 0xdb1ba69b5019f266, 0x1777242305db9ac1, 0x491d11ad264b6ff3, 0x136198dfc57a3053, 0x4a6cc64741eb7176, 0x14e811c97fc97650, 0x6b64667f71be386d, 0x3286fcadf019eb5e, 0x3f2591f4498e10a0, 0x674fa7c32df7867b, 0xbae8ec7ee100dcf2, 0x03b2c0a20a6372a4
+, 0x4c8d76b471e24474, 0x421fb6a7b8a3216b, 0xc672bdb2fe8f514d, 0x202af653d9aff3f5, 0x05e5f80f9626953e, 0x7b721fa3ccd42ffc, 0x99d8e481c0f70479, 0x054c31746d23362b, 0xfbef2e20430e8025, 0x60e1e3f02e7720c2, 0x161701874eb347e3, 0x363924e90cbb77a6
+, 0x180f5ee1863a1a6a, 0x2f79c0046ff79fe2, 0x44679866e35447f0, 0x1c64c6dd73e0d636, 0x1d8175566341469d, 0x5ba634965b8b9e87, 0x8f48744f976952a5, 0x744f28d23db94c8a, 0xd15e84b1f232da34, 0x556f3d7aa38bee8c, 0x14693c56e866ef89, 0x1564fb9a0f81eb03
+, 0xe97eed56fa2b483f, 0x6d3f7e01aebd1957, 0xae8f128aca3b3e45, 0x3d41e85ba2afd3a9, 0xe4fe485e4b6d8328, 0x65c49b4c3e98098e, 0xe96a00e054d6e91a, 0x394a2122738cd006, 0x715cca3dffd90785, 0x7bc3dcde15890965, 0x6dcdc47a33a148ac, 0x435db9d6dbe1bd55
+, 0xd74d4d6e0fd89c27, 0x25e727f6a5380553, 0xbe54127ba6c5189a, 0x65c87d3c3e61939c, 0xc34a6d122a809e2e, 0x7de6b787f097eafa, 0xb8f8b6e701758661, 0x10705fbf97042046, 0x1591614e6da2d44f, 0x7c74f26ec6eb070f, 0x9ad98c1a50249c60, 0x6e1bbd44d64b2302
+, 0x937cee76047790f9, 0x5b4ccbc70beaf690, 0x332e79ae75ae0dae, 0x2e6394161d093556, 0x4b378bf68f6849f0, 0x6c419fa0cebba72d, 0x8bb431e1e273f2a4, 0x357cec80bbe024fd, 0x83a6e913962f11a9, 0x7808df02e2523718, 0xb6690b5dabc49e13, 0x6cef23259375972a
+, 0xd18ac767b5e551fc, 0x5a0ba1dddb15bd36, 0x6f7923de219e3e1f, 0x3ec23588db9b5cfe, 0xa4fc23d42c83bbe0, 0x21581a00768658cd, 0xa295b6e57110218e, 0x3e7bbab1d15f477f, 0x2266c03d3f0d0635, 0x4174f08a95be03b5, 0xaa1a674abb8cbeb8, 0x6bdf6ba553ae3390
+, 0x8a31f824638545e2, 0x2a9e37a0f0eede53, 0x148a53d8cba69f65, 0x64c587e816d96316, 0x777a028a47e97e93, 0x13728e46befb2e0e, 0x13138b44862fa665, 0x0fca8c38a87775f6, 0xcc44bd580dd067fa, 0x40f2f7642e22d02e, 0xab3ba6db80c2f728, 0x5068aa2e2d25b7f9
+, 0x5a8a842c0a2923ff, 0x67c39e8a1006c196, 0x8f5cb9ff55460a84, 0x2e735c20a419a518, 0x0c6ee3fcbfdc2da4, 0x5bf6ed60a87b92bd, 0x5e4ce130e8e1608f, 0x0932ceb3e50028e8, 0x793cf8a0538cbfb8, 0x4e89e2c018beb7bd, 0xcaaa79642f5060de, 0x542a38a4d13f0016
+, 0xa1b0fd9aac663e55, 0x5158bf1f7b33c0e4, 0x060e82f65a4119fe, 0x32347069a1529fc4, 0x5c96ef69127480d5, 0x409a902134df6ffe, 0xdbe8c392eb6c7013, 0x73f2c48b0e3b4a79, 0xddf5060b937e2dff, 0x1534f901278611d9, 0xf47fe29ae4fd49a7, 0x7a2c0bfe75539f29
+, 0x61d431e05f0d566b, 0x15e09da672af5074, 0x1539c22a644f67f2, 0x73015e1fcb3527b5, 0xffbac602bb1bfaca, 0x2948e0afb1ccb93b, 0x263b4b66c845c42d, 0x3acae7e91a8d567b, 0x4df341959275821d, 0x356cf25587fdddb7, 0xd24b5954cbaea410, 0x53ff5780642074f7
+, 0x1d8ddc6079a4194c, 0x4f69001c7246afbb, 0xd708a1dbe8c3a5b3, 0x2cabca2303211f51, 0x936c0d257add0328, 0x6352529f6e3a1803, 0x255a12166381c11b, 0x4224d44035d2f01e, 0x48845a605aac6c4f, 0x1e5d2e74f0307647, 0x05f156c47718fd18, 0x727d025f3113b268
+, 0x7011424b3ec3a1bd, 0x4707d733b00d234c, 0x4fdfa8a733e3398c, 0x179dd91b21fb523b, 0xbdb1488db70fd65e, 0x7403f64429fa7468, 0x55d40880bff509f6, 0x0546235d023df28a, 0x2d21c328ba090065, 0x1e63ce495fe9e537, 0x99a0264790e11bde, 0x2fbbf8479be81646
+, 0x92644b3b29ef019f, 0x56a2dc98c4724541, 0x072c3ed9220495f6, 0x3a3d787a23483d30, 0x1906f294a9d64e55, 0x1afb83ac0464118e, 0x74a120e39730a0f3, 0x29f8708f474cde98, 0xab0c734a0e3e63fd, 0x5f58deee1d5cd701, 0xdb2338b7e4ab83b7, 0x5a43e5bfcb5c17c5
+, 0x0ede76bbda7ed8bc, 0x0b0de99503467e4a, 0x3b905fc53ed39dc1, 0x3a2ba952a058c608, 0x939d9c6a0d41edcd, 0x49510e3b5ce8a07a, 0x67684a81e6939edc, 0x78201e08e7e3d198, 0xed58b1e24a41fa5e, 0x08a5a8ea35959caf, 0x046b7d7a7a2ee348, 0x77358e54bb1d4623
+, 0xe34284c7f10a1da4, 0x37e36a32f608769d, 0x8780e719b7f8db3a, 0x4fff13c7439175a6, 0xf0fcb8464f7a9692, 0x51ba0cc756acb263, 0xc514331681245796, 0x05ff6469c8c38247, 0xe279b84782ea86e6, 0x60424885a4f6e2d5, 0xb20fefc1a370b551, 0x4182c7edfe04a110
+, 0xddcbe6aa14e8c72e, 0x0cce23e9b994ec6c, 0x866c323cb185ae69, 0x29b7b0fa7ffe208b, 0x7c467d4daed6b792, 0x4680d716306f5bcb, 0xdf6561219c4f3d2b, 0x55daa33ba6910d33, 0x72faeaa5e2c39200, 0x241e78e412980877, 0x440d5d5ffccfea61, 0x7e14a6e93bb5330d
+, 0x16de06233efe91b4, 0x585d53771707a024, 0xba898b098a79e4f2, 0x05f0938b06bbc089, 0x2aaf6299284795d5, 0x175c97271ac48a8d, 0xc08ef97014a68783, 0x5d0669e62eb1969c, 0xd0b6af3a87252335, 0x0ead663edf6c99fe, 0xf42e54fccb9be037, 0x6a4afe5c859078e5
+, 0x5f4d44f2fa080acd, 0x6fecb4d6123c3d94, 0x0be86ebf55dd544f, 0x71814dbe138ecc2a, 0x2344452b32a1fb11, 0x4f396ac781643c58, 0x1a30a076ac350f9f, 0x723a15a8c8f58615, 0x98ab7831a2a0ba9f, 0x7610c85f14282755, 0xabaf5aec2748b1c9, 0x3bd79be762cfa03f
+, 0x61d38bc0dac38b55, 0x33a7354c0eb3ca81, 0x437eb59540611db1, 0x2eda5e7a6110ba3b, 0x829e634ea6697883, 0x0afaff28a758a47d, 0x2bb0dca6029754eb, 0x213ff8cc6ec6f98a, 0x0c2bf33402d672bb, 0x1cf3c36fc45ce547, 0xb84472469c19b024, 0x71f368fc3d8198cc
+, 0x04b859d5fc1fc772, 0x67b72f7d3ca1848b, 0x4c98a5a6749d4335, 0x61f9dd0f30986d31, 0x055216bf228e193f, 0x0b92e8dbed9265bd, 0x94f30aef067d0cd2, 0x7ec165d81a0f64d7, 0xdd9ce941f8f37e7d, 0x21b2a29e01d68e68, 0x9e84e5aa18d45ac7, 0x06b1b01db68cd5e4
+, 0x20cf8616a121e6a1, 0x263d2a834b8ec4c1, 0xc1e64198abc4ee87, 0x068a6ef41ea8d6cf, 0x4976a43483252b01, 0x4d5ff783db212003, 0x8007c2b7b13df29a, 0x1fa132c3b57b512e, 0xc7b2dedac21a7488, 0x71cd322c5044e2fe, 0x2cc12193fed41aff, 0x660904f21ed043d3
+, 0x0eeb13c7c8ba72a6, 0x03559276ec91f89c, 0xb857f8168e17edc4, 0x51d0caaef5ff4469, 0xc1184ad4ffe83a05, 0x49906e2c676bf4e8, 0x79be44af981552d6, 0x2c2841470ce9830b, 0xdab7b08aa996dabe, 0x32e464f9c860aac7, 0x8f6df06984f55f1f, 0x1524e0253c2c22e2
+, 0xcddf6271f69479b9, 0x6ba91d2103a069fa, 0xaaec428919c113d6, 0x3a2fb1a432a60085, 0x3d4be147868a7fc2, 0x7fe3b377049ece67, 0xda01d12ae970e15d, 0x73d777d3dd914b81, 0xd6212d7a41b51282, 0x140768136b18e332, 0x6336451c0effa8db, 0x39d543198553895b
+, 0xe73bb2fc12264176, 0x21cea2f7247567f0, 0xc73b27843025732d, 0x371996d7b32f7e5b, 0xdf0ad827ce3c83b7, 0x0f62c6b8bd9a0fb2, 0x7e31aa2b172f10b9, 0x3a5cb4a264452253, 0x16e4cd15b7914829, 0x18d9047ba43e3472, 0xe59d1b5e0f0c85a1, 0x30d064c1b05aa569
+, 0x58b07513217087f1, 0x344f839d2f690ee2, 0xf45916d007f9e8b5, 0x28a8967f3d4446cd, 0xde5e7731b267b7d2, 0x32aa118a262f77cf, 0xa84046f59e8d37f2, 0x2a54c2e96b24716c, 0xc2e25534187db382, 0x53a1778baf7c8942, 0xc52deb2f82ecd988, 0x5744797e8b934ada
+, 0x2977229872e4f395, 0x63aef38810b43ea2, 0x1c0b30ba2d1a7d4c, 0x6879f7b87858ec79, 0xa79fb334dc8c47b6, 0x26a87201f4ffb854, 0xedc0c8bcee580f02, 0x2a8f996952700058, 0x351eaec6d81c281e, 0x5e52e56d769ba8ba, 0xa3aa77ff2008b9ad, 0x00a8045b05b4ad20
+, 0x331a6d5d55b82b0d, 0x7c249dfd07ef5b7c, 0x9a398b52f16fd1ae, 0x30699dc156fb544f, 0x584f57628572c965, 0x4fc132e0f2c88345, 0x18d101a45843d458, 0x0aac10204f1d4ddf, 0xd7c22c469cfa1e0c, 0x6fb844b0eec559b4, 0x6a9b62bde291a3d2, 0x7252790ea43d6251
+, 0x61a39aa501b09a94, 0x09249e35c45900eb, 0x80fa7a7e95f20710, 0x2e55ddde7f86365e, 0xb985075d1dfb27ca, 0x2cf49824429f53d2, 0x6df55d12965d6ca1, 0x776e6939699e46ee, 0x570d03acc28aef96, 0x383925ace0c9a23e, 0x7e5e5fccb87eed57, 0x5987df426d46067a
+, 0x964c6f3c65fdfbb0, 0x6ed9d47475ea3a8c, 0xfa69b99f273d0915, 0x4fb08a3341eed692, 0xd356c9a54bb77d5b, 0x2fed523fbf707806, 0x2fd35669ecfdd7e9, 0x6b8dd3c402d5d52c, 0x2c90e7e4f52352a2, 0x42fef4b3d5968a5f, 0x29b20694e548a3c4, 0x1ac05cdc874302a0
+, 0xc234e0bb5b3db6f6, 0x4f9c16fe85c1c7dd, 0xa36307f98419e1fb, 0x4748dc68e1e03040, 0xf22dbd5bcce6b7a7, 0x5a65bf1ece7dcb84, 0xa225d50d3585bd30, 0x451f78118a8b88cb, 0x9777824e57f907a4, 0x062192027eccad60, 0x1428f3167a41eb57, 0x52ea739db283e685
+, 0xe6729da927dd155d, 0x584efa7dbfda3e10, 0x29e4628791ebf3cf, 0x09e46f14d795a69e, 0xded87dda61f5b738, 0x3aa09cc41b8a40f2, 0x707824df26cade63, 0x543e2f9357c62f42, 0x68d3084421feefef, 0x6ace0092784cf55f, 0x58224a8ab3a7c0f0, 0x206d85cd4ce2523a
+, 0x93aee56a362b18b6, 0x64794e3a42d4b66b, 0x9a8131c5d39ba736, 0x1a133f7bb892808c, 0x83085a65e8cab40f, 0x173c99a1aec130b4, 0xf3cd221b43e14e98, 0x2a1ce94d0ebfee80, 0xb6a0b5e984b0e8d9, 0x0f0248d818283ef4, 0xf222aab3099e3193, 0x3601de846a9143a6
+, 0x994007f94b32b238, 0x15f3fee72122bdce, 0x4b8dbd72bc2da144, 0x7e2d82fb7bed6a1d, 0xbf74162d69206821, 0x32afcc67f17507be, 0xcaaaa39bd455d461, 0x726180858dec3e86, 0xcdb79de2f28e0a08, 0x3510e6f89a60e299, 0x2511013301f5a3c0, 0x3d2cbe668b85b48d
+, 0xdea5b05adae7f7b6, 0x2614424460c05628, 0xa152cb86074beb51, 0x6ebd3268162f1f81, 0x5efd726e6a3ddc88, 0x7a4531fcfa9b9009, 0xac6df1427096bdbd, 0x4ce4ec86a683371f, 0xc608f6109ffe1b55, 0x72596553610b2414, 0xa8010e59ec27b758, 0x66d65b6a20e360ad
+, 0xc2174e520a6ff57d, 0x431cbd3b344e34ea, 0xe0bcaa4e547461eb, 0x0f1b02e4cc09b49f, 0x1b828bb6704985e7, 0x640bd63224ec9553, 0xb655e84250255658, 0x75f21727f44d160e, 0x55bdee789c9106b4, 0x69ec1ad9c34445c5, 0xdc0b5f0b85d513e6, 0x073c0cffa242d5a3
+, 0xd9e2d1d1cc7d81cc, 0x375914b689c08974, 0xa82f2a327bf85043, 0x79b195810a12ae46, 0xe61ffd2f4fd71873, 0x0e9734ccfa26309e, 0x852b8de87efb2e9f, 0x244a6299dec0cab8, 0x20baa565a32e157d, 0x27aec4c694a36534, 0x7cb0f44da799179c, 0x15b3f8047c619613
+, 0xba19ae549548afb3, 0x436e1592ba6cd89c, 0x735814e5bbc9298c, 0x1118909d40aed45a, 0x7c72d5ab6eaf0155, 0x1d0fb329dfee3b3b, 0xce0cdc9f5f073d0a, 0x465cd7c3d07a524c, 0x0a82455c30497068, 0x02ed12b2ff7ac2e4, 0x2488aa8758e3af99, 0x12b6c15028f2c992
+, 0xcf524bfb93c46d3b, 0x793c9edee2110126, 0x27cdeb957a14f07c, 0x7ae0742011b93da0, 0x180a41b66c4f3427, 0x4eea9fb17f6bf6e6, 0x17c1ff7c6549a596, 0x1ee0ec66d67e48b3, 0xd23e4b0441d52293, 0x0ed48a81b62ae5c7, 0x2979bc3e6fa264fb, 0x10b38cbe862d6705
+, 0x1cfdb92433b0f2f4, 0x34b2ff9ccf80062a, 0xdb6c0f52bc19de55, 0x78e388c6753ed000, 0xea9409388091a7e3, 0x567466c8c8be5b96, 0x9fe9d91c89665830, 0x45282071df546616, 0x7b5975f6967b8f69, 0x3c77bc6f89c9ae25, 0x0100c6e65a4c1eb3, 0x0cc9dc909d546cff
+, 0x4d8aec1e714dee85, 0x5bebc8abab322c1d, 0x753e84086a318de8, 0x7f436e9d4210f43d, 0x142e89d66637c752, 0x435489b5fe689fcf, 0xe874bd92119e8f7c, 0x36b9b71d3e1d7662, 0x30528dd1602006db, 0x55543cedb589d053, 0x103f0d1e2fdf71bd, 0x1fc05eb48bf5c6d7
+, 0xf01eed91a8e1ebe0, 0x38bbeaf8f12b9317, 0x7facbd46444af6d5, 0x2ce3b20a832d2066, 0xa95103d229dcf99a, 0x2a477adbc87dabc8, 0x67814149c1e10f50, 0x28cd364d7e4666eb, 0xc5c77dd2d0ee6845, 0x3a4aeb5443756c8a, 0x6f66c1a0a65de127, 0x41be504e6efb6b7a
+, 0xc93d8a221c4c3da4, 0x34c1a50a2eb16370, 0x483c1b1f7673ce59, 0x7b5631bb21ce6615, 0x6b8bf684cad6e45f, 0x6d69280417de3466, 0x845786e1575eef9e, 0x247c80a347fb193c, 0x2cc82d6e28abe0da, 0x040b581f323ade74, 0x0bc64f77477c73ea, 0x4f6d30f869c14f1f
+, 0x6aa1ef243a41cf67, 0x380fe826f588a5bf, 0xdee9e084f0b0484f, 0x2063b0ab58e78690, 0x77b2d2d719278f6c, 0x0f5c801e3c417cfe, 0x32a26b2bab198097, 0x467d2e63498f5a46, 0xac49ff79da7a2fa3, 0x0677dd8804540ff2, 0xc09b3b90e95c31e8, 0x78d9fb37961c3409
+, 0x7ef43402084eeebe, 0x3ba79dba37cd2fdb, 0x01b5c31f4be41c49, 0x0a12bb2e6e33149b, 0x150f2ea25c02444a, 0x3651b09bbd00b7c0, 0x31def0278e6cf409, 0x67659f93017e20ab, 0x17ba3413b447107f, 0x65ef63d808c2dda5, 0xc9dc4f484d91a723, 0x062cc749fdb08a7e
+, 0x92b4c06aa83dde5b, 0x23c4f00863e62698, 0x8d17ab0dfaf097c4, 0x72a507b73b0f000a, 0xc05559ae2179a47d, 0x36ee0422cc499e69, 0x56044bec818482b7, 0x041cfa1974b0e0b3, 0x82e49584bd88305e, 0x77e9515cfc48b766, 0xe655ba08ea17453d, 0x5d79467143c4665b
+, 0xf353b15869cc6f2d, 0x6997066085b8170e, 0x61b45a2c2263823e, 0x100c0f7122f0c7a1, 0xd2ff250c5de2504a, 0x4063c04e3d11945a, 0x3d0ce2d7f672a9d1, 0x0cab75aacb433d95, 0x77cc0b5674ba1260, 0x7f1755f424d60b0f, 0x99cb65502042ac7c, 0x245b469bcb598cf3
+, 0xf9bbc27d44d46354, 0x7bf755e94ffc1294, 0x02290ebd4f157382, 0x79ff5edea031a2e2, 0x4ae972ea2840e62d, 0x4232189c10b2a65f, 0xab66adeefe437db6, 0x0fbc40531a1239f0, 0x9f51b5134791ec82, 0x37ad600e3ded3e0b, 0xf105938fefa6d7ce, 0x0fb74487b945a175
+, 0x7bef289a987113a7, 0x0aceea18fe043b91, 0xb247ee4494cdfcfe, 0x3d3e3f5cda72f6f7, 0x6bd51116f65335d4, 0x7dc220cfef1c4e87, 0x3cfb0feded39d491, 0x6f00e231b3f45e5a, 0x3a917be46615eeb3, 0x339ade1232f10dc3, 0x76eabafae88936f8, 0x25b255a95418764e
+, 0x3663cf713988a6de, 0x0e0388ead7c704a8, 0x0461ac1853238b23, 0x7f6d63bdbfc1adba, 0xe14008c641ad441c, 0x52073f711712b70c, 0xfc0b07bbce75ed25, 0x456e028de6c08be5, 0x58efc3baa372a89d, 0x560d286b91e38cca, 0x5686e4a5e368a4a9, 0x54d8ead9630a9985
+, 0x2f54808778d72130, 0x0475639aa6cb45f0, 0xc6b7b26950ed4b4f, 0x28d0cea6fa5f05a2, 0x60a0ec747501cfcb, 0x341bc3157614e7e0, 0x53a3839c243e4f44, 0x0ba8430f84175708, 0x79b0161477c99ec1, 0x7de7a56c5896896a, 0x64ac8e12ede093f3, 0x09774a75911369e5
+, 0x8d562ddfaf955802, 0x2d261850da2e7664, 0xe4a25c90715252b1, 0x76a8da29853099b4, 0x016f717abfe54e30, 0x40be61328c536321, 0x2ce9ac7caea56797, 0x72042d91a877cdf9, 0x260b5d126bd0948a, 0x01991e1f273a090a, 0x3f5a0d4493c19087, 0x0641233c4a4238b4
+, 0x16288394653718c6, 0x477410d9571e6563, 0x86c63fe124fb98fc, 0x62fe397035c1bdf4, 0x40b33233a8d507d6, 0x6d16a1a7a6e2c0ad, 0xd5eaa00a67404b1f, 0x38868544adc741b5, 0x6ec2b787ac422215, 0x431a7ff8e958b79b, 0x5b3babcc12421d19, 0x2d65a204d3948acf
+, 0x9dd7d3e1877c0b25, 0x6d0da0d73c757c76, 0x6d32858247a2fa01, 0x4b031333a7ccfa62, 0x18891d176b16befa, 0x08e10baf38814dd6, 0x959c36cd13bcc755, 0x122b0b17b387bc7a, 0xf40cf31c7216dc62, 0x527793c0f7c50660, 0xa99f304d10613f31, 0x64220b0c463601f0
+, 0x854a98380398e4ed, 0x3e136b2ff099bfe3, 0x08567133141188de, 0x59908e446707ed6d, 0x02730be31fe4b152, 0x702fa5c0b7a9c542, 0x7e8862421ad42da1, 0x42503d868848603f, 0x4624f9c597213ad0, 0x7e6b65b759f7f5c6, 0xe61d6230ada56a8b, 0x6069fc3a8a57fcd8
+, 0xc690557f696cbbda, 0x28cdaaecbfb9a048, 0x68f49df4db513d6d, 0x264032ec7c2417ec, 0xa1e290afb492c4b8, 0x63cddc9970c7334e, 0xb706590c3b624b4d, 0x7e8bbeba2bd107fb, 0xeec40e7d1dd829a2, 0x04bf2a6156b598cd, 0xa68acc4de06a3cf5, 0x31239426f3d4fac5
+, 0x680db6896af7bb0a, 0x6af5142dd447e051, 0x07cf3db31ba8b182, 0x42981e0485f548dc, 0xd27c4305797de12a, 0x5ed7e3b8618c93e5, 0xc3ddbb2a50c39992, 0x7cd1098cd94c8349, 0xcd2ee1187ca6e6af, 0x3e9953b5551954a0, 0x322933d716fa2bac, 0x2fe61d3dbd04920d
+, 0xed1724742babe695, 0x2debcf1ed68fe1bb, 0x1a56eb903ea34bd1, 0x70c7eafcaef1d021, 0x6efda3d1c9ac3172, 0x6d9235fb82edc916, 0x0457fbbe3387333e, 0x05cbbfc67c16d9d5, 0xc5aa7cb881a3cd7c, 0x2c349cced8d1450e, 0x5ac238cc28a0161d, 0x69d4975671650998
+, 0x091f3edf2381607a, 0x2e4fb8ccb2f04d49, 0xfb59fe987f5b1eac, 0x616c41a5a3b56412, 0x052c5ed6ddee0810, 0x0e249e2088e9c790, 0xb9938fb896d162cf, 0x7ce0889110becf6d, 0xb1803431ab689c7f, 0x531f39017539e7f9, 0x7c3f5204ca91f1ab, 0x7f6cce5aa5943411
+, 0x3970ff2059caf6cf, 0x2d909ffe15504583, 0x2330d8088d2fc46c, 0x034df72c88ab8daf, 0x52cbe2e3a5273d59, 0x3c61e28489825f61, 0x73ff778071ad7158, 0x5d14afe88425494c, 0x5c71d58c4ca7338c, 0x6b6e07d15eb99f4e, 0x5592d9f2b94d64b7, 0x28e493775c115a60
+, 0xc810f44213f9131b, 0x651af44e5b919e06, 0x083eeed1b4884442, 0x08f5d10465eb36e1, 0x0996e5b280df3c63, 0x66acda94bed5b97f, 0x178b26a2fc34e17b, 0x11579aa74b36ae66, 0xb08e3c49cf3b0797, 0x4ce1cfb60cb70dd0, 0x1f9fb8dbf8de6184, 0x7258658224d39845
+, 0x49a2b89d6f08080f, 0x50b4f85905abc180, 0xeb86376ece250501, 0x2620b372cda33050, 0xad330c195ee19048, 0x7d75dea6a663276a, 0x839cf59f1143aca4, 0x78e296a3f8db15c4, 0xf6b33e34a97b31c2, 0x411e6f77c013fefe, 0xa095abd0535f3ffc, 0x0c733aa98d1e5c47
+, 0x5bc99b610aa4d5ba, 0x6a64fa6ea002773d, 0x18807ae46ac19aea, 0x5126274c4cc5f2aa, 0x7f8d44a1d5f8677c, 0x349bdc7148c3054d, 0x3141b64ad7af68bf, 0x5d0d8fa3fcfa9d66, 0x7d7c6176e1670636, 0x79f67bfebc1f5584, 0x03c03810a0355262, 0x1ff7360720c0bf32
+, 0x8b3e353202c93e71, 0x358bc73618abe9ae, 0x792332ee1b3d7552, 0x249449685007b231, 0xe60776879b2c297b, 0x3af252a1c4893d48, 0x1b44c45a257764fd, 0x6b98f18a8ee80a9b, 0x9e7e93487294aa5d, 0x157dda9635602be2, 0x0b3f53420bfd8bbf, 0x5898880e6b682165
+, 0x0d722bc26012299a, 0x3b3546aed0c8319e, 0xb7c6e19c7b56fd19, 0x5d9247e9349723f1, 0xcb47b0888e6cd5a3, 0x52e42a9e90379cba, 0xf446254a6a682c6b, 0x6f4e42a95b7d6fbe, 0x369751f41ece6f86, 0x049ebb332111d488, 0xe563e0305e7d377d, 0x0c8def3e2eaa3b65
+, 0x5e14eb2044de8fea, 0x5c5f0a874c3dd1fd, 0xbd0058577c64df1f, 0x6b8fc66ac58dd208, 0x23cac642f3fc4de5, 0x2521cc00bdaa04ff, 0x57a5dcf329ecf7aa, 0x4ac9b17106f66dac, 0x9c75810fd96efb70, 0x7c528001a704105d, 0xab8050138033c336, 0x526753b3c05d1222
+, 0x63ee5bec589d029b, 0x1201f308cb4017b9, 0x6205ec496c816984, 0x18291daa3b962453, 0xbdffe7980587d4c5, 0x1e2da12e85220650, 0x706a801a11388a4b, 0x63ba42d0c20a5c1a, 0x13ceb3405166b42d, 0x1c20c4857321e2dd, 0x348b3e6eae7351eb, 0x635003b98e4d3ec1
+, 0xce1969e8cc0e26f7, 0x18d0f77ff565ce7f, 0x94270ff5fbf01134, 0x7e3da661825a3af6, 0xc6510f2f598e630b, 0x09161692424c10df, 0x4d7faa0b769bb7eb, 0x1ed8c31a0de7f3d4, 0xac2d87127285827a, 0x72c1ae6d14320584, 0xa23bd37e5a4146b5, 0x258be33ba4091249
+, 0xc4def2c463095326, 0x57b8ce85f1120c18, 0x9f2676d4506137af, 0x0f8fef8937729324, 0x829a8a63582f7b7e, 0x4e68caf1f4f2f3c5, 0xb0f4fbca616d5d39, 0x2bd52a1960719c11, 0x69b70b9d85bd4490, 0x71a9bea9ddad7c9d, 0x62ebd9258b6156bf, 0x3240e85cca4665e9
+, 0x78429de94e0aa343, 0x3d4ce556849e40c1, 0xd20093121284caf4, 0x148e40e6a8872009, 0x8db880a498450c53, 0x0a67ada1ba05c803, 0x4aeb0504b6e8d65d, 0x04f51b6001ccad05, 0x5730565bfe0ccc66, 0x3601d600e063246f, 0x5af620aa147b364c, 0x6e843e0b34e8ac40
+, 0x4c28d33be38c2fdf, 0x34dc3a0b1732fc81, 0xf4de526ffdfe5a0c, 0x03711d3ba0bffbea, 0xb8659eb4d19251d1, 0x7ba4e1fa7d650944, 0x06ba803db1534ee9, 0x26872d5847e073f7, 0xdbc50a440b6e8021, 0x0d1d86a9393ed878, 0x300bdae71b96e6ce, 0x0f7b56f51d92f3f7
+, 0x7077011622b5da86, 0x79d64769fe7380ee, 0x8f5398ea3300d3b4, 0x35c69839381a4de8, 0x0b35b9ff09d7f1da, 0x1752e54aa48ea0c6, 0xd3955f4787d5ac7f, 0x0a3190ee4668c447, 0x9096f02ab12e410e, 0x607d1c6e143a6548, 0x6328565786e1243f, 0x6a80f6be0abcaf5b
+, 0xe8b111c25b6b6189, 0x452ed49c9a378593, 0x49cb09ac96000a15, 0x7c3ae51cea6e373e, 0x4649616d4f01fbb3, 0x5039907dbc47f129, 0x0455845e6957e954, 0x73efd468d2df2dc7, 0x26591a756d479f61, 0x626d600d2fc3c4dc, 0xc3c2511dbef3c437, 0x4f1e143676e2621f
+, 0x4d9676ded83cc558, 0x2b5550befc3c68c7, 0x5c7b25aeec0a4afc, 0x0fd8001abd34532f, 0x00e67a7f0ece9c8f, 0x27e90db15a5af42b, 0xea3492d1770ae1fd, 0x2832cde9440ec4a9, 0x3c559f17f429c70c, 0x7a33e3884c834c36, 0xadb150f3f09c2590, 0x02c3ed35fe90203d
+, 0x19e04d1b2b0fe7fb, 0x56381ebd8181b50e, 0x5c8970c249df4ac3, 0x08acaece8ede7685, 0xc44f1a71aca0d20b, 0x623edc8d92e4ac3a, 0x5496a7e5885a0c95, 0x20a9ba37315b116e, 0x3765873809f5b55d, 0x23c44c42ebef2ff5, 0x56a96d921f724573, 0x3217815b72b8a9eb
+, 0x2cc1b42f5350a489, 0x31f0b36e85b8c70b, 0x504a5c8c4d2ce34d, 0x1af8ea26b3786eac, 0x69bc5e26d7afd62f, 0x21e399d04247bf9a, 0x6e6d6676a88efb27, 0x476212b9fe9a6fd4, 0x0740fb65284168de, 0x5f7570be65e69408, 0x0166c3279dd81c29, 0x6565489007c4ed6d
+, 0xbafb5bd37b5219c9, 0x00251709f2e210f7, 0x0d22639b51c1198b, 0x0f3c0df3be3de811, 0x3552612be3374eef, 0x0834744318ffa0aa, 0xcb9f1c1e3557a00c, 0x20c359f5de8b6614, 0xd319482a34d05268, 0x42165771b46b75d7, 0xca336c22e8d911a6, 0x4d072f70067a47e1
+, 0x9022c6f101555e9e, 0x4c8c7eaf7cc2d697, 0x629810b2d8044817, 0x25110bc01b06c9c1, 0x1bf9c06bf39eaff7, 0x6cc36f151f52b4e8, 0x76b73a6a14b62068, 0x47dcb0dc89db3821, 0xfe9dfeac2f670f41, 0x625b5c93b973c417, 0x5f8c917930133c1a, 0x6bd35f3e0992bb2b
+, 0x03b5391a85409e5e, 0x7981d8fd16362767, 0xdb45c80a32a23cb6, 0x67356a7ef48b2dc3, 0x6189236e9f01adaf, 0x07a1e954e5032bd6, 0x53d627199c69727e, 0x25d67e4163cec014, 0x18e7bb6a63a80738, 0x3112be4cb5dcbc74, 0xad9ad6d381643f04, 0x116112cbeabb734d
+, 0x32623abe2d66ff07, 0x4d780300822436de, 0x9bed066c04497808, 0x40db29b39ce86700, 0x6e5e5eb3805602a5, 0x52f227f2b1b9b40d, 0x51c2c4c197a18394, 0x6d8bca423ee270bc, 0xd6e60cfe8fb07f72, 0x7dd66c3970f940c6, 0x66aea7b59a0b17cc, 0x75fcf8b00160d729
+, 0xbedc5ea39b2402b5, 0x0dc3600425feedd5, 0xadc1ddf2cb1b6631, 0x205ee93e3aae976a, 0x7a2cb4e333c98498, 0x7d12eb776d56872c, 0x8e339bc1b41599fe, 0x4600f0a53fac9427, 0x1049d3a372f14304, 0x7b54e020b22db742, 0xd567962272a35739, 0x27a1178b1115f0c4
+, 0x6cfb39d619c35e1b, 0x5cb96fd1a9d9d486, 0xaf45cef7fb4fffea, 0x4a73d7b2ba9321d1, 0x44b46b4a80be86ac, 0x2769b50579e8f734, 0xab5d109e7472f372, 0x2bccfba1cbe995b6, 0xc00026115332f6a3, 0x7acb287da1561c53, 0x21555c608cd90dd9, 0x7731d1b2878dae13
+, 0x32122bf5ec1a0649, 0x592b5fa180ec8467, 0x876be1b5ad9ce66f, 0x484c1cc5bb34819d, 0x08e4cc425b30b06c, 0x2766065f0e4d22ce, 0xd90825644987aeff, 0x3a835fcc7fc456a6, 0xf4d801d2cc806d69, 0x41d767ecca55f839, 0xf2dea9fd01f1e74f, 0x74d01b97462211cb
+, 0xe43e280ad29f80cc, 0x5cdf66a69029b231, 0xe8d655a03c862cd9, 0x388e38b58d0e8c79, 0x5d9aaa4848ff83a2, 0x14d6fbee4d6cbe74, 0x0426dcda912109ea, 0x1bb7b9cd75d4b541, 0x3a3c0504b39b8505, 0x35a3c5882b31367a, 0x678793d635a6473a, 0x66abca7e20202034
+, 0x4a90ff1dad300021, 0x18f29036544d2684, 0x2036d39b8f69095d, 0x36490f5645d18cc8, 0x9414d7368ad3562e, 0x7f8108a04558487e, 0x93db0e56d653e40b, 0x03f413ea960537bb, 0x984717b77f7267ef, 0x6c5d9da4a5ee7305, 0x725318dc36060a49, 0x274397f8e79a239e
+, 0xbda7965b4095bab0, 0x6292b2505c7866e3, 0x451fb6a0672d6733, 0x37c560f40242a859, 0x151e56eb818f1423, 0x63451986f0c22ee1, 0x9275ff873a5c75e1, 0x178cdc734a32b96a, 0xff7adbb24244aacc, 0x76518aa0dfd96ddc, 0x161c1c8c81071219, 0x0584d44c10a3e6dc
+, 0x2727282a09e9acab, 0x1298e49c34514ebd, 0x0323d059ca1c0e6d, 0x6072c8b87dd26bc6, 0x36eca2ab28d36f26, 0x2a977cb5aae4ea2a, 0xf157d43a0b9546a7, 0x04d60af0ed661d29, 0x34bc1080126e4402, 0x7677ef9a21589171, 0xbd13797278f07a40, 0x32c0daf0b57f20ac
+, 0xbc83fd1b8366dc2e, 0x6cd07286c4e670ec, 0xf35485a3f339dc8a, 0x6e7e9285f2247e8b, 0xa9d19d3a09943bae, 0x43fa5197eed852a6, 0xf911398a043242fe, 0x4a100dcb1312cbe9, 0xbe2fd86be910a692, 0x614fd829368d7937, 0xdb5a98b1a92d578f, 0x46f1d23e1b0dca7e
+, 0x8bf4c6725e813f36, 0x68bc89078129ce91, 0xff56503ae28f5c7f, 0x2b6e0f4e42178ce5, 0xa97cd947ec65895b, 0x7aa90b66280ff6c9, 0xebbaf32df158a0a0, 0x6a748d0ac02bb713, 0xdf79b5d619e83397, 0x16934947f6485b69, 0xe75185521ab32881, 0x20791e276a7460c9
+, 0xd25c403e22c70bc9, 0x0bf079518e66e1d3, 0x45dd5c971d3711de, 0x66bd2c6a30be232c, 0x607829e5b29e53ca, 0x30ed414e71dc08a2, 0x3fd38589ea0f1d39, 0x5a881a121f37fc5c, 0x27b9394368987a4f, 0x321fe45e13afae2d, 0xc6feb75080f33ea0, 0x02166d52f45eebbd
+, 0x15026a1b0ccd2fc9, 0x1141be93d5bc3d6d, 0xfd20df606fc676c9, 0x4059e26b00ad78c4, 0x0709b409cec6b505, 0x68f020e8acf478e5, 0x875d77d1f5df0cfc, 0x66eb377735162ff1, 0x860482ab417a32ae, 0x21175f47da213935, 0xa07ff0cda099ecdb, 0x26ae5f177ae2b8e7
+, 0xa9a070ea5120eaf7, 0x2581feeba7383f81, 0x49e0f137f1fa2a7a, 0x7fe93c51cfd1ec62, 0x2d74dbdca7777f7e, 0x562da2ba74e823ff, 0x543b4f8609d77a2e, 0x3a0f65212f234ec8, 0xf842e3fea270ebc6, 0x4524322c6a289e11, 0x80815887aa6a8576, 0x46f49d53c3fe29a3
+, 0xbcc93cedfdb0d388, 0x4db312076ef0ad2b, 0x1f2cd56373654ad9, 0x4c6446970034d15f, 0x34d2cdbfd5d7130c, 0x6198950d03db2ae5, 0x736094b72faf1b1a, 0x1f6ca46a9f2588f7, 0xcba0b03d6259772a, 0x24e5a23d8d6be3a8, 0x7090e340c94f6d6f, 0x287ba27ee54e8466
+, 0x87320c8822d607f0, 0x44fd5802509df171, 0xf35c09860bf6ba4a, 0x6cf53130ef77cc0a, 0xaa81167a00b48ce4, 0x649f4c775b0d8b48, 0x59a25683ee98d33d, 0x651479007d1061a6, 0x155487411f6e16da, 0x411d036475404bf2, 0xc231f1344162458a, 0x4f36b7633f7dd368
+, 0xa98ddc0a4e7a89a4, 0x55d8a5da6eacd542, 0x5c3fb48b1001ed45, 0x5c7785ccafa702b9, 0xa64369fd216afb79, 0x1f405ef10e940669, 0x755f4831bc327b6f, 0x2bc1b67d71f1882d, 0x8eab15cfed7777d0, 0x517370d580d99326, 0x0811b75701c9db39, 0x234d84cb52f7b621
+, 0x970c4fbddddae49c, 0x3ba8d842475e41e1, 0xb0720f6ad75e7008, 0x275cd5c5184bf345, 0x5eb9833888d3796a, 0x1b3a42dfde11c2f3, 0x946548fe092b5f4d, 0x119917b50f263cc9, 0x622de955a20a3f82, 0x6a552ea3a60c7ff4, 0xc79230138150372a, 0x18083b9518de76a7
+, 0x55fb74dd7d3b5455, 0x523eea9a70ff8334, 0x5994a7335e356271, 0x3bb011f60430f1d2, 0x1ec434cba1d6ea7c, 0x69b632960feb5780, 0x46c50417541ebf07, 0x01470bfbf9d23830, 0xe9551f4c049bc5cc, 0x1c124638f35ee8ed, 0x09ca3a9141e83a38, 0x44daaf3e7411127b
+, 0x0e54717b6c2fcd10, 0x518ab46b26d5914b, 0x528ac6c82341e833, 0x2247fa99d41f4672, 0xabe30c65c0f327a2, 0x3ac74e012b77e1b4, 0x35defd694c0e86b3, 0x7c382e10bfe60e4e, 0xf37e382996b8461c, 0x4d47481c53631e1a, 0xac8f167884f7b7b1, 0x5ae1bb6ab1a4c643
+, 0x63eb02590829df80, 0x623126862a793fa1, 0x6e1e242f1ce09807, 0x7bf96130aaecfd2b, 0xedc5e9ea10bff70a, 0x66b548233b94d26e, 0x70c70ee4594d30ab, 0x79b0006c8811353e, 0x4352792c91710c1f, 0x0c7bf15181a9f539, 0xfc995ee769e3779c, 0x44871c6cb9dcedcd
+, 0x0d180bbf2c9a046b, 0x5445c598c45d0cd9, 0xdefb32386875fb94, 0x5b0d235355660f35, 0xbe1dea825b3a7973, 0x10658ec4e1bbe147, 0x48af5e87fad77504, 0x55f5d3c94a7dd694, 0xa9a3e7062cad6ba2, 0x36c0a7e3f9e0ea31, 0xc4bd65217010aebc, 0x1d031dfc8b9fb598
+, 0xe3621c104113889e, 0x774b77ee1e6a6477, 0x124c5b8a07785fd7, 0x5a6c0df18188cada, 0xf4adcd545e72d7be, 0x38100fffb66ba966, 0x2100cbe35fe4a4d0, 0x4489be2df052c175, 0xa03a22403b26899f, 0x5ae4a0a0fec13928, 0x89dfbfb802795eaa, 0x34917e9c4ecf2532
+, 0x64b93674c60cbbb3, 0x25c098506334c71d, 0x8a723f66f1ee34e1, 0x3a960adf48f141e4, 0x659f386695e440bb, 0x577a0fbf6e8095e6, 0x8ef419b0f4b25496, 0x044176a30b9e465b, 0x7a98705df2013e6f, 0x77d0b2483aa95ce7, 0x309e917b978effd7, 0x08f1e55bfe942c7f
+, 0xfc241629b8d613c8, 0x140f2e35cd68949f, 0x38899f6a3ee4f9fa, 0x7abc8ecdd300f3b5, 0xd3dad23505d23eaf, 0x75e73f09376b2c7c, 0x5644a663b60ec5c4, 0x511ade8afe1eaec9, 0xbb005fe4e1abca89, 0x2838de73b0ca1f6c, 0x800a6658b80d28c8, 0x48aaba61c91641ec
+, 0x222759cab704d4e2, 0x106dd3c0ce85beca, 0xa1ce1ce341f69d03, 0x1651b210e8e4ee10, 0x47329a5e7133e136, 0x58c02f47dc9367b9, 0x09dcba56947b02af, 0x435c251178125b48, 0xd56979a3f0cd9315, 0x2f02b0a6422afddb, 0x23920f500731f32d, 0x0ab833238232cb5d
+, 0xa7b3d1bfb0bb60db, 0x2342c2a03c6eaec2, 0xac5e6e5a14d5282e, 0x5b9a421ddc42a24b, 0x018506414543e056, 0x6d7c377c084954e6, 0x4f8bf71ed3db1ced, 0x5150dbc15ab10979, 0x00b50a1b373a7fbf, 0x140be5c3d3244705, 0x5005bfe96e5b7911, 0x77cea555bb133f3e
+, 0x2ab1e1a9d7a973c6, 0x3897ac98314968d3, 0x9e0f74764b23c9c3, 0x2e5ecbbae41997cd, 0x43e2ea5648f12433, 0x3a515a0e4808e69c, 0x17d36c03c36bb343, 0x44cebd053481ce43, 0x89008656c21b0d76, 0x2f8513fcb9009be6, 0x2e223f90208a0e83, 0x3828c2d4efd36a73
+, 0xbf17d64f89a8527d, 0x59ebb42b9656151d, 0x7d7bc7245c7dc5ef, 0x191b682a0cb695ec, 0x8931172fad9f9add, 0x239b6cbbab2ebdcf, 0x76932f9ca7002dd1, 0x0c140548f858d8b5, 0x6c7adfddcf741ea5, 0x3b39c4b9e2e1a567, 0xc5135a25f87436fe, 0x690d8fecb7dd0ae0
+, 0xd782a618ecda10c2, 0x4f2a84b3134cf832, 0x35a81f71bbc955a4, 0x457f88ed64ae6398, 0xc27eb71c31479985, 0x4ae91808569aab32, 0xa5f2e9785a75eb11, 0x619cb199b837ed36, 0x0e7e5912b9484e40, 0x3b5831e87fdbcaf0, 0x49a2779c2d2b039d, 0x3d4b81e07f49061a
+, 0xaa119b0fa222b55c, 0x265c1b11b42fd4e2, 0x6b4d28e519dd7637, 0x3d2da7900de5a4b2, 0x99b06586b5f21d63, 0x4ce62bd9e6a1ee18, 0xb671e753932f8c92, 0x390b7821d0987834, 0x1adf7c73c3f1fc2f, 0x78c636a8514a7af9, 0xaee3b35fe11e7533, 0x7fbd199278f6ffd7
+, 0x41aabbf4363d77de, 0x1b27fdf18b96bf6a, 0xda264a1dff9a981c, 0x36efc08530c0bf9a, 0x5bd8862a5d830854, 0x23d7c905e656e6cb, 0x4523324c5b64fdcf, 0x36627f376238665f, 0x564f53925c6d5ea4, 0x17c7cc86a1913022, 0xf90db52a543b009b, 0x15192dc91f8b994b
+, 0x80bfa3c1a79ec6e2, 0x48fca8ea99772ecc, 0xfee6a3b98c0f1824, 0x46a8c75601b81e22, 0x2cb3c402a8895fcc, 0x1d1dff9c04305ce2, 0xc1aefe78e85971d7, 0x79c6a083ab5a80b2, 0x379c7bca5dbf2518, 0x2419358989b3ca02, 0xc9c42c9cfa5f470e, 0x4481c2ce91b14459
+, 0x6b04dea1ea26deca, 0x26ee3ceee0d0a101, 0xe36cc6bcd8fa4f26, 0x4d14709719764fbd, 0xe0572a706f1fef52, 0x0f75fb69a23f2ec1, 0x32ae4b04a864cf3b, 0x0b6373a91b944773, 0x1a8f2bc20bd088af, 0x586b0d5ace401747, 0xa0e6b094a3c51433, 0x1752a123c268c1c7
+, 0x643c2a93b5770ea1, 0x536cb9d1b71eeb43, 0x6bfb0525d0cc6b3f, 0x1f4dcfeec3adefc3, 0x28a0169dd0bf57f0, 0x1336c9aa20a35449, 0xbbcda068703ad7a1, 0x5e33478283c1e03d, 0xf1997733d18fdaf2, 0x789af507a17bb867, 0x79970c14d5695613, 0x79452342e845256f
+, 0x6c12f9367a26a018, 0x11beda1c8f9cdfbe, 0x720e6ddf24b30929, 0x7706e91e3e544755, 0x4460381d3a6c9059, 0x7e01916c3678c424, 0x6024355a61d2bb07, 0x68bae01d79c869e2, 0xf21cbcff285df659, 0x02f7ee6aeb57c933, 0xce0f078c17266467, 0x039b4fdb5170a103
+, 0xd5de0fec61a4ae1b, 0x33d37a152a778695, 0xea64e40e6a10ded9, 0x1f1d394373bdb213, 0xf63598b6ef59fd14, 0x57922adc3ae52283, 0xe39a90e18b76f4a1, 0x27f3dbebd98a9dae, 0x18179dd9c03804b3, 0x511d72c1912e2d73, 0x88e1f6d24b2f3225, 0x56009999cdc2997f
+, 0xda6df977b7d82fe4, 0x76f746bba63da226, 0x0b5facfc3bf13bd7, 0x4a31eb04f66f0e18, 0x8ace73d5e7cfe28f, 0x19aa731bc30c20b1, 0xa91979fe73400317, 0x6795ce71a09c7c9f, 0x93d55501933700ba, 0x3850eaf08b1fd14d, 0x450c5abc89edca71, 0x1be5db848bdfa5ef
+, 0x77667d3f4fcf082b, 0x673b6e6c4824bc45, 0x6f22c12a5fe0ed6d, 0x006ee6722b5dfed1, 0xb47a13c1468d0c62, 0x40564879a378e6e4, 0x0bc6b553a9d3ab58, 0x21761c79e44dfcfd, 0x66f36ed3eb1050fb, 0x2e67df1312dd01d3, 0x48744c4a68dbf2ad, 0x7844962b6d6e039c
+, 0xe07b5675d378b65f, 0x336262aa3d2c1df0, 0x320a5667d78c2e2b, 0x4f668dd96dda5e2a, 0xe21556795c7b8470, 0x3061905b2ef82bb1, 0xaee53211472206b6, 0x1f87377fee0d7a39, 0xdac58c52a3b1a0c7, 0x6e3c4ce04f0d7ffd, 0xfdffec45d4a3990f, 0x4b5340f79e2ae2c2
+, 0x0537c8b7b3d1f332, 0x55292744ae35ee1a, 0x42336d0e6d057f1e, 0x5ac40e9e645cb3d7, 0x848f7b7f845e46c7, 0x74bda86736eff150, 0x891acf622baf4f35, 0x14bcef9cf39667bb, 0x9aa1354d9731b9b3, 0x27e855a19295e59f, 0x1a829a8e10662ed0, 0x3bbc43f9ec4437a7
+, 0x8bfa8b1cb1de5341, 0x3432778068d35549, 0xe3d807da41f25a48, 0x1bb6ee1ce2efe552, 0x08d9bded0bd3affc, 0x290f1c5299a917a8, 0xda8dfd79562f8939, 0x1bf7aae68686211f, 0x2ab6daf9bc860765, 0x7bef6e2f0eb58a0b, 0x8746faab7c439b94, 0x017ea87750bb8bda
+, 0xf8dfeb22239c9a7c, 0x35cec0d2887b3a13, 0x68aa94ac601f1606, 0x7470553f8ba61767, 0x37894f91c9eac410, 0x55b22aeb8337f732, 0x53f8d90f29a2fe94, 0x0aec068aec69023a, 0x40506162ad6182ee, 0x6a327ff1ac1e5475, 0x968d7095492df3c8, 0x3f93f46195f67521
+, 0x4983bca28970d546, 0x2716b931296b53c2, 0xf42b013266b6f8b3, 0x76f29b084b6a369f, 0x8e28749222216249, 0x4f2fa1d3a6c1acfd, 0x0ee66697eab8f954, 0x37c33e28fec0cce5, 0x7d0419e2bafd1dd1, 0x01f04d4299b94daa, 0x5ec06abbc1e5c7e6, 0x3a24c66060ed72a9
+, 0x0db764e15f960f26, 0x1d5973d5d59f9c3a, 0xf3dc2608dc6d9149, 0x1d80e0461b72f518, 0x2264dccd49c8b09c, 0x1f03e7a246334d5e, 0x2d6e38871b1fc2ad, 0x418588ae4f284bd3, 0x3efb071bafe1afa2, 0x0799ba0c80bdd8dc, 0xa6b273222dcc4a76, 0x13859f08ac8a4b23
+, 0x0194acc2663c5acb, 0x459fa55bd0bbedf6, 0x1b055550f06f8cc1, 0x09e5fad46599ea75, 0x6b3916ef772958a3, 0x4aaaa5c18093a431, 0x8e1503e36610f594, 0x620ef55048a263b9, 0x5a28963c8cb8ecbc, 0x6aee46b1b740c15a, 0x67e39606f59cfea9, 0x13a579e3777ca8b1
+, 0x45ad92f61cbb8de3, 0x53068a1a42460eab, 0x9b163546de379578, 0x07bf38a7cecd4860, 0xf84c77031d282de1, 0x402aed6399f78ffc, 0xfb83dd20295f6d45, 0x3702e257340d2ecd, 0xb8db2d8b979b97c8, 0x617526d2a50b0c51, 0xd86f6278313017db, 0x2f35eedec55f9d92
+, 0xeecb69493517973b, 0x7a111a74e0baf09a, 0xb82c6da8ec39f63d, 0x4217076312833746, 0x5d36d11f3dda88d9, 0x7baebcb360f2a887, 0x9829b62d093d6cbb, 0x10f17a2f6edf28fd, 0xfe3efa4353f40626, 0x731ca3065c118e34, 0x6185678827960895, 0x07f906a4f4c6355c
+, 0x361d9cd10e657142, 0x2b5f5d452dd861ce, 0xa3e01df05d04b69a, 0x533723bc4cfcc0db, 0x820384afa1bbccb5, 0x4e67e941595d8dfd, 0x0f8da50839e13646, 0x6887a0573a596968, 0xe93dd1df5ace7343, 0x0d4076f28ecf96c8, 0x0ba2f854988074c1, 0x5eb2a314a41a40b6
+, 0x49ff6d27a676b27e, 0x15f7ca40acd5114e, 0xc171f9a750d7da95, 0x3bedbe891f79eb5c, 0x5b643bceb83f74ff, 0x088b1af3aa331a4c, 0xde294c7e0a60c4a9, 0x0a0770fc8120b151, 0xf09b757a0c7c1937, 0x34b797c03efd9c88, 0x051e3edb2c28cc49, 0x66db34ec5ac5122c
+, 0x95fde0d3d3dc8cbf, 0x797897c8121818cf, 0x1fd46d197710f89d, 0x533a505803f809c5, 0xb60f1c090c9fd211, 0x4a7c3479af5c9d82, 0x4bfc3ffa4c8cf5a5, 0x6949f4a61306821f, 0xd814c949c67abcdc, 0x419a5e33166863c4, 0x9de646f6bd0895e0, 0x497cc1449a54545a
+, 0x69eb31247fe126f2, 0x323c83233967f477, 0x52e0db4d3d78127d, 0x42a0e188e7b9380c, 0x3a6b011c46e34e7e, 0x79f4168aa9a0b4aa, 0x94270a25d708fa4d, 0x2bb28618cbc9cdc8, 0x741e46bb04606819, 0x02790c52fb2ce982, 0x6dbb92d0c6d0af10, 0x32aa96ae061e9412
+, 0x1376700c90d98eaa, 0x4d1dfe650c0a7136, 0xb397f8eef89aff20, 0x4836ac4a041bae37, 0xf37c1076a80a02b8, 0x0d063fa2467b3a37, 0x498f2617b56b7e7b, 0x65ef1194db859a5d, 0xd1fe25d5d28ffcb6, 0x228ee6f49459c083, 0x6b7e82b3b009b15b, 0x713b185ef1fccbfc
+, 0x552468f1ff60c298, 0x2b7ba65d02519614, 0x8a86ad90ff0816c2, 0x7bf9249284bd02e5, 0x3008c56e474c2d10, 0x171473b77f804540, 0x15fb79d07bdea766, 0x66ac67c7b9b0951f, 0x34bca15bb6d2f652, 0x13c63dd2687d617b, 0xc515ae237715c19c, 0x0e543c6765fbfef2
+, 0x668c80faf156fb5e, 0x1e2e9e3b3d9962b8, 0x89ebaa264394e113, 0x322add21cf1659cf, 0xf9e6e26733619f8e, 0x723bfc8b792147f0, 0x79aef2837d7e092f, 0x1aa61c59290b5011, 0x9955ae576a499cd3, 0x2c3d6e6a5a1ce0da, 0xb864cfa199a8676b, 0x4961a21f1080285f
+, 0x828e184adf9d997b, 0x0c84bda97e7ce725, 0xe6974677094cfcc5, 0x4ec8cd773946105b, 0xa48681bcc95fb5c6, 0x6ade87f8f7a5f269, 0x9b97628fdd39c03d, 0x3bde0ee1f19f1842, 0x4ef8c8fb117c0ca1, 0x769bf8f8d07de9bf, 0xc8f5f435b78a57e5, 0x79987aa861bbcf9c
+, 0x7f6c557204b02022, 0x119bd819111c69d1, 0xf0c61ef00b3eb70b, 0x4317f0511bfb7b39, 0x36a2b944e84d608e, 0x1c1a3862da3369cb, 0x37dbf471085f1775, 0x3835751e107419ad, 0x04ab0c84bb07a3fe, 0x63758bfbc7df13a0, 0x15ffd20cb554f23e, 0x1ff11c442b1515b7
+, 0x171377f1bf937186, 0x615efe82b83538f8, 0x321e7cfae352a761, 0x7af02427d7241502, 0x86546e47f2cc559f, 0x65a1d8a017659d75, 0xc95d8aa5b8bfdac9, 0x01e887cb68990623, 0xf1f8ee8c466bcc3d, 0x40ce5e4f2ba3908f, 0xd2b81a3480c16b35, 0x51625d3eabf708cd
+, 0x44d770a210105739, 0x7f1de74a022958a0, 0xfbe4c91bd1e8f732, 0x204fbacb13586460, 0x97d79097d62e3cf8, 0x541ad5591934b114, 0xfdfb47919c141909, 0x354926e5244fdecf, 0x6291b0a0e2e994b0, 0x2b9a9a69d3a6c3d1, 0x8189be54302371e7, 0x3645c65df1a881cd
+, 0xdf0460f445e3877b, 0x7ea384dc52d0d26e, 0x0c2e5f768d46b6b0, 0x1f6e62daa7c5d4e6, 0xf8b026b33b2343ee, 0x2b7183c8767d372c, 0xbd45d1b6b6731517, 0x4ddb3d287c470d60, 0x1031dba40263ece2, 0x4e737fa0d659045f, 0x8cbc98d07d09b455, 0x34a35128a2bcb7f5
+, 0xd67a89186b67f7f7, 0x0485b55c63a054ea, 0x022df582b37cae98, 0x09df88e0b022d555, 0xf4d50a279431ad48, 0x136ee46e04a83bf2, 0xabcd31432b41c5ec, 0x044f332904b55bc6, 0x67aba8511ca39aed, 0x09aa9b5b6879a44a, 0xfe504440a2ffe51f, 0x3393b3789df24b74
+, 0x7c1b49032f02d460, 0x4d963d715a2f9b6a, 0xcaf608ca35ab8a74, 0x15ecd2c7ce16b48c, 0xd603443f7ede9274, 0x046085b00ce83ae9, 0x838540f05e037b98, 0x30eb0ce4082340c4, 0x424b0415d3a2e1bc, 0x4b0694d50e59d33e, 0x42e28cada0fdd5e5, 0x35412f0347c740a7
+, 0x8e238126eb2191b4, 0x3a4817c4981c4a44, 0x0ea417bf90729c7a, 0x53f4b39a0a96924c, 0xfdccfea0d55a2b76, 0x7a50d61f77f02d5b, 0x1f9efd11d5e3cd5e, 0x681188f6eb609c63, 0xd42c785c237cb980, 0x6967f35e77a9d010, 0x69936fcc59185cef, 0x3228a5a9e2dc5fb4
+, 0xae3d773e171095b0, 0x4ec2c51ccba19209, 0xba6280f9d7b86775, 0x1a0bfabbff287607, 0xf02a2adfbfb174ac, 0x51c629e551750875, 0x344d1111fee7a42f, 0x261d1b2a993db0bf, 0xef47e45b4f95b354, 0x164cda1e29d6662f, 0xe38c4bba25026cec, 0x31a2bc3a8d879c77
+, 0xaf64573183574465, 0x43ea015306db32ec, 0xca237c27c2c35216, 0x3fa7a8a7d8703c74, 0x01dcb7435801ff5a, 0x2738b3402a0c9ccc, 0xd491abc8e0a6b715, 0x0fb804f567699e80, 0xfaefab5a929f07f7, 0x43ad6cb7e2a703c2, 0x0d1c7cce172ee8ef, 0x17a5531ced786ab0
+, 0xbc590e52c0293bc4, 0x682d0f1109fd485a, 0xe0c0bf60301dc4bd, 0x5f802eb572f2b825, 0xfa23eea474501f01, 0x6b64c705cd840588, 0x6e17128b22ff936f, 0x41b02de52f49734d, 0x841756c656120edd, 0x0431503876e11e1f, 0xfe2c6f7bac8a7dd0, 0x4c895ee389e3dfb5
+, 0x3677d442d9d5e5b2, 0x3ee1f140008cd86d, 0xa0f3a0ab784bf0dd, 0x04c41174968d6980, 0x087ce5a4824d472c, 0x405caa5101af47bd, 0x92846aa3f1ba5a02, 0x4be85c1a0293fa01, 0x75468f60dabf0e39, 0x7776b73bc624b11f, 0xc4b2de550c485e7f, 0x3effeaac0b12cbf4
+, 0xace065e8a9f4d8b8, 0x6c934fef46752ac2, 0x080d9d3d94a4c1a3, 0x17c5e39bc2d1f839, 0xfd98f8efa7b13947, 0x3aca8fab8506b3e7, 0xbe294c27f74f704d, 0x35122ab222555996, 0x79e6a88af867cf4b, 0x30550a6f46a766ca, 0xda8251a837a1c0a0, 0x4aa3cbfedfbc1bf0
+, 0x41538bf9877677ad, 0x12088ce4700c0277, 0x17ca3056d9242fcd, 0x694b91316e093eb8, 0x229d647fe167d6d8, 0x1c44f58451422e23, 0xc30cafb8c9883dc3, 0x58a285569d459f19, 0xdf64c1520ee25f08, 0x0133bc9147c7fcce, 0xca072b66f37edcad, 0x22dff316f98b0bd2
+, 0x8a5737c6d770f791, 0x76ddf459dc6d3475, 0xd60755994a314329, 0x3e4938123cac6ddd, 0xc19bd7a8b9052ae1, 0x54a0773d3cadb0f5, 0xcf99a525f9717866, 0x3425dc15084a5e77, 0x87526c1ee454d435, 0x5d8100a33b69fb8a, 0x256dd35c1a07c098, 0x6fbc19f1aae91cb2
+, 0xf593297a07f8acc4, 0x4a09c89cff3f98af, 0x7dfa970768f31f11, 0x5661eff49cad194c, 0x720a4d87ef663aad, 0x759a92c430057f94, 0xfb69dc211a9ae865, 0x69a987121f413a03, 0x1d03396044f0ea0d, 0x1b0dbfe6fe71e284, 0xd4d44c10b577fb1c, 0x6f10d16400c9cbeb
+, 0x84b17a64da2cff84, 0x3867a8851b393881, 0x77343bddf8676d18, 0x19ee638bf7ae430d, 0xe6e75e5e9c06ba80, 0x6ea4557c2b0e7b33, 0x05f876dd49ace992, 0x2ba836e4cc9cb80a, 0x1081d1987da94e5d, 0x1d50aa05d4cf0950, 0x29d45fe7b4dea54b, 0x670e231fff930dff
+, 0xcdd6c99de11cfead, 0x10edacced4287dd9, 0x0d55c32380233432, 0x4c9d26acdac27b5f, 0x9e6ea7ae80a4e2d6, 0x3f5dd1ca9a56f417, 0x46467dd5b1e461f6, 0x6ac4fa1b0b9bcdb5, 0x8f963f5b101385fe, 0x62823bf962d11a2a, 0xdadb2192429974fe, 0x443c2c5fd1be864f
+, 0x73f37e751f6df995, 0x42c7257c4609bb2d, 0x24618a492a85f181, 0x30b332043d173d0c, 0xaa87789dd48c9738, 0x338e08e98f355af4, 0x3d14d02ce67911ec, 0x13526eef2ae1fa93, 0x23081a055a9364d9, 0x791ef50fd26249ab, 0xc019457f10b210d4, 0x5eebbfd164430b06
+, 0x3b2c203d725a1879, 0x50959e7d692c309c, 0x0e312816d2d6f46d, 0x024894453733f0ee, 0x620d6085187b9046, 0x5a3b229fddce811e, 0xff8b6e35ae8d22de, 0x52afc2c3c8b5212e, 0x6f7a38ba98aa12c4, 0x41dbc83af80ac0bc, 0x06752c65b6592d47, 0x6d95ba30a23a4b64
+, 0x5e97608020150c62, 0x4480afac52d344b2, 0xca2df3545444d6fd, 0x2f05208a588bb440, 0x1cd1f8ca1f3c8496, 0x2b5e47c79b3a9e93, 0xe979e5c369cc5d5a, 0x127c10194803931e, 0x84233f92265a9b9e, 0x5bbbaf2266cc9df8, 0x24897d733c867f78, 0x709aa9ea62070961
+, 0xfb3483a51d716a41, 0x5f2d480e3602b8e1, 0x3c2041eb28668c4d, 0x7ab1bc25d1d845e2, 0x29082acb789ab2f6, 0x6673823262dda8d0, 0x82e5c85191258354, 0x4f9215abd498ccb6, 0x5bf63d4e914352bc, 0x395d932ad53ffec9, 0x6e69686c89f79027, 0x3cad197c14a914ee
+, 0x3a131f66acdaa173, 0x748944a67942f741, 0x100e12cbd9c5d461, 0x2b08cdbdab077de9, 0xb43adb7f4bb30164, 0x3a8bbd50668667cf, 0x5e76da49857c793d, 0x5cefabca294566ca, 0x951c88332a2964a4, 0x3c1fcab18add8d20, 0x3d7886e0885c98d8, 0x5bd1eeec5b0d8275
+, 0x6ffa6d00a30c5cf6, 0x44e4d3961e479536, 0x0a758e83b33c0e14, 0x146cd6d694910a12, 0xceb7cb2e09eace00, 0x6d207cca5b0efdd9, 0x7a328d9a097e532e, 0x59161455cdee3f66, 0x9f35df4953f9da49, 0x150b00bf7733e114, 0x762b6c1413eb0a1b, 0x1331f12c4fe12b7e
+, 0x65e8025a57379e1c, 0x17c81359f58a6a2c, 0xd4cd086d55601f05, 0x42e3facf4cb6c341, 0xe1df209241d4ac46, 0x488b93f7bd1d2c4b, 0x220d66141cd4e2ca, 0x7491ac6415d8362d, 0xbd9a3cbbb1305a64, 0x491c7fbebc448ebf, 0x4900a62207ca9357, 0x15184e9f5640e308
+, 0x16ec832c8dd1e253, 0x1ae60af4a41f5c0b, 0x656c4f5ce68a0c12, 0x1d47f396f68c3191, 0xcd49f904aad0639a, 0x3f35e94836da4294, 0xe64ee736ac164802, 0x21e9adee26b6097d, 0xbda0a99b5127b21a, 0x50fde0459e478550, 0xd2c7d14f68e8b103, 0x33037b72d00c3798
+, 0x4407cd87c7168acd, 0x2dbf34bbdc15910f, 0xd1370a845f9047c8, 0x0f0a6f349717d3ff, 0x8d1de038273e13a9, 0x33b69e5af0c76777, 0x8b58656ad053b569, 0x3a3832efa59ad7fe, 0x193031555c282ba9, 0x7a25531932656c8e, 0xa1ad229fd459ddf5, 0x2bd4348cdd1476d4
+, 0xd9a5b35fc733ccb7, 0x2fdb6bd44e3faef6, 0x9a3832020853a924, 0x4784b4f426d8097e, 0x70aad7b350cba76a, 0x23b8d642b9ea4f38, 0x02af4177bb74e44e, 0x1b9b70f9f54a4fba, 0x495897be2c610b69, 0x41d39bd169c6aef2, 0x9d9f3af7d3a11f73, 0x7b3b7c0df77781e2
+, 0xa88ddc1c1680bae5, 0x239dcf53b45efbaf, 0x686aee245a2fb6f9, 0x34f67fe12e2a0ead, 0x28b731da126fe656, 0x42dd29c93edac13f, 0x282bc50a3a53fd53, 0x365167761affc28f, 0x20ee25c7c5ed96fc, 0x579adb216fcd0f67, 0x3c3e3e3e48c9823d, 0x21454ee564281655
+, 0x2ca792cd5bbee3f0, 0x4cfbdf90bda61ca8, 0x77bda89226d0dfb4, 0x2f6b325fb1218424, 0x7688f8af204f8c2c, 0x2995b61f82d2dacf, 0xe4eba5b54f33df50, 0x6d6ff0af382cfbc5, 0x22525b4f393c6a82, 0x07a30614f1f45870, 0xbb84bbe9647696a6, 0x4a80f44ae153c4be
+, 0x3ecd4b44d702b106, 0x7fe6994e308cfcbc, 0xc464fa54262d0d52, 0x5639074618fba5bd, 0xc0873500dedc163c, 0x5b5b2cf6435cc9d7, 0x875692b16bb23d2b, 0x0339653cfea5892e, 0x76d652edf3391937, 0x2303e50f13c0dd4b, 0xc6e0dea98c00dcf7, 0x36ce7a7d691384d8
+, 0x2a74265adf0fa018, 0x21d0bfdb8607d277, 0x30a8d58ea244a8fe, 0x5fe2f04fe9e29944, 0x3f081791cfc697b6, 0x2e81df72c287915d, 0x81ea68b05e08b819, 0x32b01921cb49e0fe, 0xabc6e53d1c9ff301, 0x24467f42c69b54c0, 0x2cb55ad3eb27e9cf, 0x5fe44b6e0bcf7ee3
+, 0x74c7b252a4bef6b4, 0x2f88b4683a596998, 0x0bf0bc74378ee067, 0x0cc12a3d1b4ccabd, 0x912bd345dfaf692d, 0x4482fece8d4f0eb2, 0x9b7c405da76fd229, 0x0c9fd89964829ae9, 0x893c42bc0b44f460, 0x5f6fe79d1c618dac, 0xd286b589e619ec5c, 0x11ee288dff7a010d
+, 0xd5b5a99a5e900241, 0x7293fd29a04a5b05, 0x6727bf1b513603ca, 0x0d10afac93973967, 0x6b0661370efec579, 0x03e0703febc95a22, 0x0b538d75ece57f1c, 0x19e93fd11700a217, 0xb1a73a67976a1c0b, 0x3efcbeb6b561ab7e, 0xac63293f55e6bea6, 0x1582d956e87d6475
+, 0xc6256b406f005271, 0x30e3182227639503, 0x80357b817de099fc, 0x467b1182fc510c21, 0xcdb2fdc53977feee, 0x2564570938cba54e, 0x9437387c93dd97de, 0x52dd2c08d9dfd294, 0x9f3c237749f2de2d, 0x38b32d7c1b96c9d3, 0xeb001f34db28ab66, 0x07c1872b3c6e0ea1
+, 0x54bb1af485256fe7, 0x634b757039078d41, 0x2a66db3e09c71865, 0x0ba4e5ff6aaf5101, 0xd32e8a3706898f17, 0x56e0f2649aaeb630, 0x60879ce42b317cf8, 0x6f590e37b48c1a46, 0xeb98f1f349e8cf8a, 0x707bd0201358e60f, 0xb07eff1ecb135469, 0x4e1c76778d4d3442
+, 0x848cde605310072f, 0x22790d06ad2fbef9, 0x8ddc87e725c4e284, 0x42d60844bccdc857, 0x8ab3f232f7ddfd51, 0x51d50fb2611f9bb1, 0x717963c51cf35ad5, 0x146312f207a29420, 0xe306136db2361ce8, 0x4c7c3b7ec34a5f68, 0x6eef6a14cae316d2, 0x23bc0e00f13c3e4b
+, 0x18f057d3b1478cd8, 0x1845241a7903aec5, 0xab37106769d0c58b, 0x7409357dd2124a8c, 0x23f0b0bf926253e1, 0x25b914f44808330f, 0x3b906d7b997b2057, 0x36f4f1651c0c99fb, 0x866a5b72f7c92dbb, 0x2977aa5b7bc689ca, 0x87d3853527e71e7d, 0x144a0143601dfb43
+, 0x91ad6dc691c35927, 0x5c415a5f845f10d4, 0x1954d805a9a12649, 0x6a406108bd25631e, 0xa48f2bd62ebc6182, 0x730128774f395641, 0xd0609ef1c4c4726b, 0x6bfe854d34fc634d, 0x83d63e8edb3b172f, 0x5681d2f133f10bb5, 0x1f37d54d26c42a83, 0x524570651fd3a4b6
+, 0x40dabbade9a8f8bc, 0x01352967e13ac97a, 0x21ac469d42fcdf21, 0x6a00c7fa19009fd2, 0xb3eb9a2b8fbbfb4c, 0x270235f1a3a08871, 0xa5d9bf4db80fa8cf, 0x0b7bfaaa96143226, 0x4de1267648f15a8c, 0x1043998cb5a9187e, 0x0fa094ac9ac26f41, 0x49d463def26a3a6e
+, 0xbbaba6632b33a977, 0x3981fd3196989f5a, 0xbd8cbc5b445eec5d, 0x79f894ed4f96de50, 0xb8ae04360b853164, 0x75ec7d4fbab3e459, 0x031f406cdfa7db7c, 0x790db708421e7988, 0x646e0e4bf2789f6f, 0x5dbb505b90fe6d4f, 0xb5d76b7edf5405ff, 0x2085c160dfb35b8a
+, 0x9d3538acbf00d12a, 0x4b2cf29faa540624, 0x5a4d3bf383e8c9ae, 0x2a3be7d14e2963b4, 0x124c4a42af9ea837, 0x5cf20fafabd3d421, 0x98407225613e6ed6, 0x5f3852127fb654f3, 0x38c5447dbf8aecd3, 0x1d8bce347e7b7419, 0x3aee545443900f12, 0x36d0b83fcce2d38d
+, 0x1c8efc6a864f0d52, 0x70058bbcf0e148f8, 0xf35de2c2d04b6ab8, 0x1b023439f9810abf, 0xaf07806f0076d7ab, 0x65ffc52697207783, 0xb8b5a31150de0f3e, 0x5b54ab4c1c9a6e7b, 0x240175b97d8033c0, 0x1c75253c6697ed40, 0x5028a4f3ae676da8, 0x6de40ed708eb0562
+, 0x771594a461273a3a, 0x3c7c6103da43fe83, 0xca230bc761cd797a, 0x4f1433f4e13fbe23, 0xb96d4adc6244d654, 0x3b8d4b7c16c63d5f, 0x4a4f7a499b6704ed, 0x3e602333575f53ad, 0xa832096cc87007b6, 0x43d59756f19abb8a, 0xe163f65dac934243, 0x592191ef69ad3352
+, 0x1a9a3c9b5ed96e7b, 0x23634d4c704ceb14, 0x9afd328258949bce, 0x515710d5aa479f5d, 0x932e3bc33b67164b, 0x49d73ed1521a38b5, 0xe303e5063781471d, 0x3e3b83c9ab627272, 0xd342a6cf3d4dc46a, 0x28f2c0eb33bac3a7, 0x43c69a848eda2bec, 0x719aa7e3e2375d4b
+, 0x2cb816690e5bd082, 0x25e4c2413d3e4399, 0xf4247cc3b1db0eed, 0x214100c7bfb86b63, 0xeb08d0d7f1aa1588, 0x69a98cc5df5f87da, 0xb92f5805f396f2e0, 0x79618012ccb5aae9, 0x2fc5471ebe5733ee, 0x0ef2d971ef3ada47, 0x22ce51ae6ba76604, 0x1d1f9b945cbebfa3
+, 0x9a3b13808fa2c104, 0x1e3baae38ad76aa3, 0xc875d6cba937a82c, 0x5a5d7e5afa1f52a6, 0x82e4162715172616, 0x062c8f6ae66d0877, 0xdaa8d0522fa8b5a7, 0x25309e085a83660b, 0xca483b78359abb0b, 0x69f0e7c88d60161e, 0x967ddf5f76882b8b, 0x51a47e201f2d5873
+, 0x0f3c6283e9ad28bc, 0x200656f5ecda6721, 0x2344aea3c49eeffc, 0x37f712bed1b9de9c, 0xcceeea0c833d3959, 0x56abdc4950e5c0fd, 0x3379bdb93fe56d3a, 0x43d2742b47e4c5d0, 0xc9b9435d40332aa3, 0x279ed7b462d81b09, 0x08a3b8b9a2b4ec2f, 0x68666274ddc52b36
+, 0xd5266d6f10aa172d, 0x7ec75c72df9e362e, 0x784e6e4639db3bd6, 0x4100d4918f7c30c6, 0xce3fc9ffe6420ef6, 0x5c5d9caabfda54f2, 0xbacec9ba34da4d42, 0x3920c75dba62ce7e, 0xc537ee4c47ad6b9a, 0x7f55be2cf9c48a16, 0x8cd2be1e3b87d08c, 0x786e07044b17514e
+, 0x5c520d83ca02307b, 0x627a9f5b709cb7cd, 0x4715b718c5e8b842, 0x3e4318b466aa540f, 0x41391a24a0336fef, 0x5b3c67fa4f04d19d, 0x74682e4e3bdf9d3e, 0x29353bfedbf24d93, 0x6fea3b7322c146bf, 0x145a2618194d9ec3, 0x295beb9e89d7737f, 0x4abecd8eb647dd66
+, 0xef94f46a5aa1037f, 0x5ad33ef5a2175391, 0x7db04ae33cbc745a, 0x0f693dc62d4cba0b, 0xdf3f039742a50766, 0x5228c031041e2982, 0xd6908ace068d6158, 0x3c8f441f154198f1, 0xcb62e135d97dba0d, 0x72b31012f3986b49, 0x579f46c10a12b735, 0x65a9fa6fd9e56c25
+, 0xcfc7f251806235d9, 0x4e7603571baae9e9, 0xcf9484544e3b7f83, 0x4fe4a243423a8677, 0xd2c14822e915c635, 0x70967f6d0e81b9eb, 0xfa1d777893fc9ccd, 0x7e43428f7dc33d07, 0x8c822de44552f04f, 0x19285896cbbfbb85, 0x785be210860d2c14, 0x0f02f261a28e785f
+, 0x3b46fff788a3e058, 0x39f0b4c758ea11c6, 0x9dfe266eb07a2fde, 0x2c601adf9b7908fb, 0xb45e9bea1f7b1437, 0x1096fa34f47c5322, 0xbcb9db48b9f1afa8, 0x498870e976bd6e42, 0x9fa52748d0abf717, 0x648ffd57e5d4b08a, 0xd18287d4809fa32b, 0x7772a0c1a2960eb7
+, 0x063d4b1c8db70e73, 0x60a46604bd1ca8fe, 0xa11c3c1b95745808, 0x515df1eb3caaa14e, 0xb652fa0eb01dcac6, 0x23a9ed15057ccc7e, 0x8f57477499fddef5, 0x50b43044da918d8c, 0x49bda4d7ccc45174, 0x09dadb66362317c6, 0x8fa4d48b0b7f1d88, 0x23626375c88d66af
+, 0x6acdd0733eaecd53, 0x04714381866d164e, 0x0028a72d5bd2376d, 0x36ce4b04bc847def, 0xeda06eb5a21ac758, 0x098ac81e84e2a615, 0xcfea29f33fa8fa78, 0x2268605dd226e3b8, 0xbcb74c9eab87386c, 0x273bbbe02b5ed9cb, 0x2d53e12fca470a93, 0x6ba1c99ae7464b2e
+, 0xd4e00d96bb3a68cb, 0x218cd51a781e6529, 0x4ea8444591988280, 0x10b022430b4f6310, 0x4e110725f1603a4c, 0x3cb5a5ed8bf5f866, 0xfa4e7fdedde33b28, 0x322af3f92c972021, 0x39def0e031c467c2, 0x46f1d8607ef0827d, 0x1304ff8adeb266d5, 0x04cb47f6a893d1b4
+, 0x7475cdcc92449e76, 0x6acbd24538257813, 0x7492c25404837d2b, 0x2582556aeec8215c, 0x4c43a61a7537f738, 0x398d48b9e6619a7c, 0x7f8141fdabc47c85, 0x1fabb53613c08df3, 0xa4ede1f9930da16c, 0x484a8a8a6ee50bb1, 0xd38dc372b6b595e5, 0x3c35fd019fb4bc90
+, 0x5606f63a79edba12, 0x4b96b47ad37f52cd, 0xba6140c019ca5a8f, 0x079ffceaf4881610, 0x960a5e3c03025575, 0x1139ec7fb4942595, 0x4ff4d051d8cdd809, 0x37db0da92128d1af, 0xc914f376f8050aea, 0x25354e7e73a00e7d, 0xa0754ffca9e529ff, 0x5f7333ccaf828746
+, 0x2c42a10907b91f9f, 0x43a678f84686344c, 0x56b1a9bd859cc422, 0x2dce5ba18d1e261b, 0xc1c02e0e4c955e91, 0x4543b9ce8321e389, 0xf6a6b5a8cbe9425f, 0x26a7b71145162c2a, 0x5b02a4dfef429551, 0x24f10eff5e8dec3d, 0x6f14e232c301f1b4, 0x17ce4066286a97dc
+, 0x5f05199155709eaf, 0x442f15d70950b7c4, 0x5ca3c4bc24596dc8, 0x2ccb133c4cfdd6c1, 0x9de20a3d02eba87f, 0x326040c6bf489696, 0x601a6b90044ca6d1, 0x16c1b3eb05faf208, 0xd09c433593f6b56e, 0x70e3147bbadb909d, 0x08df6f784a224b2e, 0x5e43788ad1799560
+, 0x6a232fa2df4a68c8, 0x3c1ec888a5393b69, 0xca5d1e0327781303, 0x67198f1cf22e163a, 0x7a5fed4f31f6846a, 0x63f8b0585e2fa55e, 0x6a21eca03fa4e704, 0x71c86b0c79a788c5, 0xf92c88660715a121, 0x5146ee8ae1e0ca69, 0x079cc67e9158d93a, 0x7beceaf6631679d5
+, 0x7eff2166c5ac6796, 0x6eb157005dc9f783, 0x01b8a4ef520caf57, 0x0a068e8879e68ea1, 0x081c780cbe29edfd, 0x4a98ea3964316f5c, 0x32256f7b4c9a70b6, 0x04050e320f71b673, 0x2dca4fa4e30703d2, 0x40003bc25d390136, 0x71a586d4d9742239, 0x14b58655dd77a50f
+, 0xac08e8fb4da1cd24, 0x0a669734d19462f5, 0x27e2064c539be056, 0x274fc60b4e26139b, 0xa593b78f5ea0a044, 0x4121377d467a332b, 0x46ff296872aee8a3, 0x0d4dbd03b7ac1077, 0xa8fee2e915bb493d, 0x3a9d7ef30c6aa2e7, 0xd728e8c93c38f64a, 0x2dac12fbbcdd7080
+, 0x9c4fec727b5a7bc8, 0x0b65e510740b2782, 0x6cd07ca5851e6970, 0x27f1108e0c34f7ac, 0xb2ba9911f21e23c0, 0x5feac5ca0845beeb, 0x5c15d858137f27ee, 0x1d56afdf2cf28059, 0xdf3891e64ce711a6, 0x0328139f4687cc27, 0x6672fd8076a74c7c, 0x743794ec6d0ccfca
+, 0xe9484d37fe4fdbe3, 0x17d2b895f82955c0, 0x91900f689c23643e, 0x63431957f5edc3ca, 0xc87ff8baaf6d138e, 0x2af895b51144bdbf, 0xf32bcdf84302d2fe, 0x2ab99482e6e02fbe, 0xa04b99b843a1fddd, 0x3414e9ef555e2f32, 0xa8d96deb66267d00, 0x6f152f7ba2a2af4e
+, 0xb7dafb1e400c173a, 0x64c3f10a19280d27, 0x608aac08f92cb059, 0x58b8f5d012b2f542, 0x3cdcb8872a1dcadb, 0x62a63f626fa20af8, 0x54ce496bf1165753, 0x35084dd4ed9d0ffd, 0x26d2f179fb345211, 0x395ce21a6ed03ec5, 0x89ccc454a36ea97b, 0x5bd104744b9ec7c6
+, 0xad9d4218a38aeaf1, 0x53b8061a84035f8e, 0x17de798c4408255d, 0x4699d84ded818be6, 0x5837417e6600ccfe, 0x6cf11c0e784c3b63, 0x8a27cb0c172352a5, 0x0a0ec0fb4d056efa, 0x14e325a223368115, 0x06178ddabb834eb6, 0xac6f2e74bf147d9d, 0x11e9dec6cb9d656d
+, 0x57ad53b15a1f91b0, 0x28f598d5de3e77ab, 0xef0cfc015d29955c, 0x6372cd483199913d, 0x592053a9c484200c, 0x5704477ee5416d30, 0x41145be8efb476d9, 0x3083013cd7f517fa, 0xe345bb34397fef85, 0x604c73a964c203de, 0x8391a8f9a60b1ca0, 0x5b734e89e3b67a35
+, 0x19bfa6c31289b6be, 0x2815929227694f74, 0x92d3d8a68efbd809, 0x09e881acf9c0c261, 0xb9a0781496f4e39f, 0x5581ec5611079d45, 0x81ae6edf4b34e06d, 0x61fc67221fe9e4c9, 0x9fff2c972dd824a8, 0x354f0669fd5ae564, 0x56f8666c273fe91e, 0x2f120409683a7c4c };
@@ -0,0 +1,2573 @@
+/***********************************************************************************
+* FourQlib: a high-performance crypto library based on the elliptic curve FourQ
+*
+*    Copyright (c) Microsoft Corporation. All rights reserved.
+*
+* Abstract: precomputed table for fixed-base scalar multiplication with W_FIXEDBASE = 10 and V_FIXEDBASE = 5
+************************************************************************************/
+
+// The table below was generated by table_gen using window width W = 10 and table parameter V = 5 (see http://eprint.iacr.org/2013/158). 
+// Number of point entries = 5 * 2^9 = 2560 points, where each point (x,y) is represented using coordinates (x+y,y-x,2*d*t).
+// Table size = 2560 * 3 * 256 = 240KB
+
+static const uint64_t FIXED_BASE_TABLE[30720] = {
+  0xe18a34f3a703e631, 0x287460bf1d502b5f, 0xe02e62f7e4f90353, 0x0c3ba0378b86acde, 0x90bf0f98b0937edc, 0x740b7c7824f0c555, 0xb321239123a01366, 0x4ffcf5b93a9557a5, 0x297afccbabda42bb, 0x5948d137556c97c6, 0xa8189a393330684c, 0x0caf2b720a341f27
+, 0x161a7650414a5f89, 0x6da8a7b57033a9ae, 0xf7864910f858e40b, 0x02a988b92409128f, 0x45dcea2d26c96faa, 0x0a55b199f1c7dae1, 0xac2d65a89a9bd31c, 0x3174c7dfcfe082d3, 0x1732da4a0699eb59, 0x19e1db4e5932b20e, 0x1e250936935d1d6c, 0x2c105eac60a9cb2f
+, 0x3a8ba018fd188787, 0x5546128188dd12a8, 0xb0b3cc33c09f9b77, 0x1baeeaf8b84d2049, 0x006425a611faf900, 0x18f7cd12e1a6f789, 0x6dccf09a12556066, 0x448e05eeace7b6eb, 0xbf2f33689d2829b0, 0x6d911dcb2957bdb4, 0x9f2353dbdc3c03ee, 0x06c54305babee501
+, 0xf9c3295a5aabdaa4, 0x4a980e5c3b9fdea0, 0x764bea4c1859191a, 0x19b733f97883ff71, 0xdf04baf16b82410b, 0x563e24a9bbec944f, 0x5053fcdb2d0d0287, 0x0d27913c21d36721, 0x04958cb1d37de9ef, 0x5806d46457fe223e, 0x12adc55ccc977760, 0x2dd2222a45148c29
+, 0xab9513aa2234f601, 0x044c33595f5fd4fd, 0xa0ddbfa946c2f385, 0x6f400c2ec162c3b7, 0xaef71f82972e423d, 0x42743805a41a6262, 0x1618ded0c36ec71a, 0x633aab2e10ddeebb, 0x8e879d4498b16c50, 0x5127b67dbf823636, 0x04d6b1b09e639742, 0x6cb7be072410480d
+, 0xda79290cd7d6bcb2, 0x4e053533b7aec018, 0x947071a5bac395f2, 0x493412955b7ef199, 0x97b9d74f82599cb4, 0x69378345eeb8805c, 0xc61672519fd17ad0, 0x4ddf8eed5022841b, 0xf3e2ae57b0feab74, 0x39a33882af9bdfec, 0xc17870803b69dfeb, 0x2c20ea8e3b4c2c16
+, 0x688e91a0e387e44c, 0x7010a8f6d738b934, 0xd188793c70d22fa1, 0x4149c3e064c18922, 0x923b2d8dc1b9e066, 0x2db871f146f6765c, 0xa92e1273c57cab96, 0x3765c85e696fc8a7, 0x23a23ec4fc99a088, 0x0e115b676449dd22, 0x02bf9cadb0a1737a, 0x3da6300981580851
+, 0xf486323e498cccad, 0x45eaca2dd7f9ecad, 0x019f609ce946ebb4, 0x65974e1d60f42e64, 0xf880d2fae7a9b3c1, 0x2c15dfc2665976e6, 0xf4809ffcd00577c4, 0x3184405a0afa059f, 0x740b69998ee22cc2, 0x0070125b6d3e9ae8, 0x5862b4f91550da87, 0x3f128b197bd558cf
+, 0x2eaf45713dafa125, 0x72963058648a364d, 0x61b7771f9d313ef2, 0x4f41c7f8bfe2b069, 0x408623ae599790ac, 0x4d33858644330a42, 0xfc5696649cdd7487, 0x74df72e0e598e114, 0xc9a06325913c110b, 0x076bd4115fe4b0d8, 0x76619e65d6bff3d9, 0x249240147cee3a08
+, 0xf112fbb367449455, 0x458919465293f890, 0xdc45891cc3cbadf2, 0x164f8a82e6c3023e, 0x73dc67d9153809c3, 0x73a04bd32d569c61, 0xd10a529c6efb56d1, 0x4f6cb8d0dcb1a48c, 0x8b2a843d9c386ba6, 0x045dc799ef740f8a, 0xceeac8c2ca86e343, 0x5b9730fbdef7afe2
+, 0xd695b96148965a73, 0x28aac8a28829f706, 0x41f1c05329f7a57b, 0x441ca9e89f03e00e, 0xe1aa38ab8bf7241e, 0x58f28cafc832b7f4, 0xcadaf8b8fa5400c6, 0x34b6d106284e863e, 0xf5498cab3af15097, 0x6dbe7790017d9c49, 0x63bf76a81448e8bc, 0x6371925bf23ae006
+, 0xdf22f42cf4c31527, 0x733594fc336df57f, 0xf4b7210911fc686b, 0x4b426513983d933a, 0x5a5cd13d3a5d30d9, 0x26d511ba60a1777c, 0x032912f03375df88, 0x328ff8c886c19ceb, 0xd7dfeff6031569c5, 0x18c77e0b27b06147, 0x4695e62aa5c1f140, 0x236995acc4eb9358
+, 0x3e4578edc34425de, 0x3a094615deac25cc, 0xbc985c3c0a0cd380, 0x0987545205de607d, 0xc6400afa3ccbc978, 0x689a7cebe7c4f5e1, 0x42d8c0d7dd994d64, 0x19f666f4803109b4, 0x39de21cec89e6a81, 0x19093d0e68ccfbf5, 0xa7039be27ad1da4d, 0x35dcd67551184dd5
+, 0x9936feffc9d2bc5b, 0x736e1f5312af3d45, 0x37cdf8c89851926f, 0x558d2ffa168ac4a0, 0x6acd09cf12551023, 0x29d8dc422311761f, 0x98fe794f505ad99a, 0x2abed0b17091ec6d, 0x607aa9760b6761bf, 0x215962adc8417cd4, 0x941a35071af59cbe, 0x10aac75d6b0fc5e9
+, 0x4afb5a8f28680292, 0x6706d091aaa29625, 0x1795308a49183606, 0x2d7551956a77cc5a, 0x91af8aed79e4039a, 0x086673a9de93834e, 0xf4074d9c4a719916, 0x7dc79097f636fc31, 0x580b014d570188b9, 0x07076857246b53e3, 0x59d4c57986b19dad, 0x248b080fede19f27
+, 0xa3c120c5a83bad87, 0x777e3e941d8e0fce, 0x3322bfaeaa82c01f, 0x5dd7b90e532a5623, 0xe3c4ef040056367d, 0x41cc3d244b9eac85, 0x71af19bf03736add, 0x451daffc984dfe68, 0xa27a86e397b406b5, 0x7dabb3b5ef672b21, 0xcb115d124e4ef485, 0x05883fb0dc16f423
+, 0xc2065588ac5ef824, 0x431af365eeb745bf, 0x026e1e5dcc69d908, 0x59b1f84db3164ab3, 0xe4028d1bccdfd36c, 0x120a64e7e4c20329, 0xd998e2e0b0a59f4e, 0x41b0b9a85ef820a1, 0xd7eb98e5c1ee3193, 0x4a2a8581b0ccd0f9, 0x9858dcaa81074d65, 0x6c1f5495ed6b7934
+, 0xd2885bf49f0b9d79, 0x73a9e13e02d39459, 0xa624536c99c28bac, 0x4789fef67a5c1034, 0x27f5dd64b70cafac, 0x6ce85d167d68dc69, 0x45b8e67049285fb7, 0x2652ba658f933ece, 0xa7b55247410e75e7, 0x4b74f6809255b27c, 0x90608b988b53d010, 0x022da58d6f913674
+, 0x5a3b44cdbd958743, 0x4755126c3ad63efd, 0x1b7b8b88ec815db9, 0x224e039b31ea37b6, 0x63c510ca03a10c29, 0x4294f83ae4b205e5, 0x9a0f4c94daff5cd5, 0x19870823cff87e4a, 0x5058e2577b9a414c, 0x61d73d691a0b9644, 0xcfbbee4aaab7d2c0, 0x5125c3ca43f42c71
+, 0xb1d5197ffaabbd05, 0x5e48eba1266d476f, 0x14e35f05dd681128, 0x4d2487df77d56f55, 0xada0c2808eda128e, 0x32d708e12959c4f2, 0x16f68408939ca0e0, 0x17fa72bde7b2cb6a, 0xeba5f5fad287adac, 0x62453edbb15afe1f, 0x49b50a64ff563629, 0x4a188810d26e67aa
+, 0x9a935091313d6bde, 0x68919e4df92be7da, 0x694a44f9388037c0, 0x6bc9f68e91e8c2a5, 0x7adde93039316b6a, 0x4da1f53ca5a7ab91, 0x34910ec3fbdbbbdf, 0x4307506278838b98, 0x22f00b6df84a97fc, 0x2d1b51673f8549d8, 0x66017a1542f8669a, 0x6a588891d7f176b7
+, 0x856179b2f8103dd9, 0x7ca79c25ebc4a797, 0xc8cef044b9e47f9d, 0x6b2a16cf59e94309, 0x86fdc80105645428, 0x03fb26a86fc16492, 0x042a1350306c341e, 0x7b194e16bca2b099, 0xbdbec46fe4bec790, 0x0a04b3c14c1bf127, 0x9675944f1abde049, 0x5f0eac8fd6cd7d2b
+, 0xaa151852bceee492, 0x57bc696ee1bfa674, 0x14d9b0386071b46d, 0x7502c8d9e268d8cc, 0x4d8310644002d09e, 0x6aee06f984cde76c, 0x5615db6f43558fe2, 0x3f020a852101b147, 0x602bfb797174f37e, 0x1d856010c9a57fca, 0x003886aa57624045, 0x69ebf4a9cc51cf51
+, 0x9d3448fc5f28c607, 0x3dca9096b689420c, 0xc82d5c0f65164dc3, 0x62e55304d4f87992, 0x619a0b52ac5ffb16, 0x1e4c36a4827a0401, 0xf2d9a8a4ebbf54f3, 0x41717fd49c9ded12, 0x1dbf3414cf12a312, 0x7a4a57808b655aeb, 0x6d18fdfce9fe9268, 0x7c0b334b45fa4bc0
+, 0xbde13ea0a8686f62, 0x28de5a6e9ac11bc6, 0x7ae986f13123e78d, 0x52f6b2e9b9766d99, 0x28eb209c3963d46d, 0x29ef39cacb9a13a4, 0xe479e4ba33bf9fe5, 0x4f280377d494dcc9, 0x9f3c306f0fe96e75, 0x0ebb1977ff85b884, 0xdeb739250bb6681e, 0x4c48615df3f90bb7
+, 0x414af7287eebd234, 0x59eb76ab1578ba39, 0x5a9af4180fe1f1fc, 0x3f609ef36db86975, 0xdecf3462c604250b, 0x543132c84e059408, 0x6a1d0aec45dfaedf, 0x104ecf5ed4dbacba, 0x33de64b2286a9c77, 0x19aee86fa5e948f4, 0x1b384d5484bc2460, 0x7210f810a2ad05df
+, 0x8f35ab4a11aabb16, 0x373ba4a97769f524, 0xcc7dd449dc91941d, 0x25f93b44554d688b, 0xe48dd39fe5e0fe0f, 0x185750f8badd5bb7, 0x27d2699a1fcf0673, 0x396f39ecd35c733b, 0x79dccda39d0776ad, 0x17ae3782d30d9d2e, 0x04386b2aa2af0f0f, 0x0660435b2076cdc2
+, 0x50c2fc65e6f283f6, 0x2181f234982dad76, 0x29cbd41c63688a22, 0x64e19b724a62b5d7, 0x211d1392fa7ca09e, 0x234c084b9361b9b9, 0x93b2b070389b5f78, 0x64cb28e54a1a68f8, 0x3306cd63178bb3c9, 0x6dac9fd4583a725c, 0xfb5590224ce43f1a, 0x14dcbde183c517c2
+, 0xc45323162f3fabc9, 0x5731d0e2c26f9f7c, 0xb1fd78014c1c55fa, 0x62bfeab380401cd0, 0xf5d50fbd51bc2eb5, 0x3755ef2039444c6d, 0xb519ed79395ae9c1, 0x1b1f83f23777e1b7, 0x36221bfdaa9f5156, 0x5ff60f6345945f7f, 0xfde72cc4f252d9b1, 0x6d7282d70ca67588
+, 0x16a165addbcc5fcb, 0x0b16b1b40f25fff0, 0x90a8b9ecaadc793f, 0x12930038863e921f, 0x6236014b09e6c4ad, 0x08b1162a4b33c298, 0x44bff18af70d2440, 0x27c15e6e54e9f7b7, 0x698e0f9a868a584c, 0x3e8144d1aca27f79, 0x561f6d1aaf4a724f, 0x7bc593cd824fb0ff
+, 0x0a1cadcf6fda2f18, 0x47179a06f44cbacc, 0x4489beb58584d568, 0x6b8d40f4c41249f5, 0x5aa4d041a4e77c8b, 0x68c4ec6494fc7dd8, 0x9ac37f0f3bf05dc5, 0x06c1e79372bece11, 0x4e87d4af03bd8630, 0x50af57fa29817ac0, 0xa7c9e28465154772, 0x5becd5e355ef9c95
+, 0xd74a831b7dd718ff, 0x5ef9cf354d0ba493, 0x9ea3ee86b7911fea, 0x13e77ce4e114de08, 0x449c4743397695f5, 0x4e5a9c66e5f3219d, 0x04f0775e9cb0a13c, 0x20f99dace646834c, 0x66b3e221e56bc3b1, 0x6e6dcb142f902263, 0xe858897795a0beb1, 0x02e6a127769711af
+, 0xc5e2c721bded81fa, 0x4ede70eed68056ab, 0x8f3cd9b5b4975810, 0x4752fd192f0a9aa8, 0x318794eb1f734414, 0x11ddf7d2c8468662, 0x2613b06f72b1a34e, 0x465575b37ab06770, 0x40b9845f82638d2b, 0x48894050790298ce, 0xbedb93a501b4f131, 0x04f3560d2889b2fb
+, 0x9d3591479615f5d9, 0x3124286e94d0df8e, 0x6224961c3469f7f9, 0x3f1250987e8388ac, 0xe240e58c1194bb70, 0x1270fceccbf4a152, 0x840db57917bc0b41, 0x0b04731ef69dcb39, 0x7be9bce24282bc0a, 0x77961abc3e56b5ad, 0xc9e5d0ef38d7bba8, 0x030b5b856f33e5ce
+, 0x457dd875115b278b, 0x56f25ee54d92858a, 0x92d4c1cdce0c977e, 0x078fca4187d74996, 0x3bbb2ded76cc22a1, 0x117b28853ddc2bf6, 0x43f3767cb9c2baa2, 0x73079e25e0ea8a8f, 0x0177992b5a15796d, 0x2e77721480d9ef92, 0xbe09883567372916, 0x258f176b7af7576d
+, 0xe5d9ac72270967c8, 0x0438d0e477baca5f, 0x8740d83acd77e247, 0x535f7bb2cab2caaf, 0x9cec38ad19ab4776, 0x713f329cbd6147e5, 0x7a0844072163fa29, 0x01529a409f4f81f6, 0x3b30649fd4c52a04, 0x3d1f6935b6e495f6, 0xef09d01ab3f71afe, 0x4f17820b39fe2252
+, 0xf4a2c7f980319928, 0x60d0b50a41bf1558, 0xc9766ffb787f74a8, 0x133aa749cb784781, 0x28ae7d78d5010880, 0x13bb96671d30c87a, 0xf37fe101415324db, 0x1408c67f0f641fe8, 0x8c87cfe65e537cc8, 0x4397295f9f83dfaa, 0x06c4183bc1753090, 0x7082cf281e9eb7ec
+, 0x932271d859da4cc3, 0x3b4c94c69a123882, 0x51465bce006bf124, 0x01bd8c9ec3fbff61, 0x7be7e81cb0c04ad6, 0x2f11115278ce6e0a, 0x46819e99ec65c276, 0x7a4ffe1cc0ff70f5, 0x89e6eeefad02dc11, 0x368a792360eb9793, 0x0aa99aa055a272e6, 0x4e3a6c77f6cf05ba
+, 0x7529b9fa8a5ba0f3, 0x55624a7e534a3949, 0x97474ae6fd3b90c9, 0x3910359546fb12a1, 0xd221d69adc902eae, 0x002f7e68e8d6deb6, 0xd95ca7c7f264bab8, 0x0e51cf655f85a954, 0xf1ba6f677d3c1ee5, 0x08addb1c191dedd0, 0xd2a34896e115f839, 0x07a775289732083a
+, 0x7d049888152920f5, 0x580ee93e26d2f457, 0x0d1dd666767cdc94, 0x51f92c259e4d1b38, 0x3e1fe160f4b0558d, 0x2826521e38727be7, 0xdbe939b8798b003c, 0x526288b1454b7310, 0x8d351f66c064a406, 0x26d06c97c98e8a03, 0xe321f767aecc1a50, 0x0240909d01daa0d4
+, 0x308338fd6168391b, 0x7285925f9a7353a4, 0x862c0fd04fe85114, 0x53259ee7423aeb51, 0xfe0031a84b3b1a68, 0x1a4f1d661fa071fc, 0x2ddd54168dc928a7, 0x60185c1adf196a6a, 0x49809717dc6da9b4, 0x6062094b4dcffc03, 0xa41ea6fa05fa7e8d, 0x4a4fe06f277148a0
+, 0x17b1bdbf3ef47f55, 0x3b09d6b564854620, 0xb9c0faa55aff03fc, 0x7c8301bc649bffc6, 0xb95939b7488882a3, 0x5e66ff596a7d2560, 0x27fd812aefd8daf1, 0x54806bc2002690a8, 0x37942e3808025ca3, 0x3b4babba1f7438a2, 0xea6529fe37f15a54, 0x6924797012681cef
+, 0x7bb253a9ee9e80f0, 0x419a928bccb11733, 0x84323be66a9a039e, 0x01b2d1ae972814bb, 0xa7588584d3051231, 0x54df1e20cc979dd7, 0x91d906fe3e2f22dd, 0x4e36e9975fdf1a0f, 0xd81871746b747634, 0x3e5e31baeee13433, 0xe4da80979573baa3, 0x4b852ad97cfe77c6
+, 0xd23bcd2c9565b193, 0x7fbdcb53c9d09546, 0xdd93d623c0b2a358, 0x23aed0a155807084, 0x1282c05521cbc3f9, 0x6d93ad79a7ee97de, 0x86b9345f406b39a5, 0x424e34f4a1772577, 0xd3baa968ec65e748, 0x6784cc718e0611cb, 0x9d02afa0ef5a30ff, 0x6ec39ef3af67cfd4
+, 0x74b1a127a934944b, 0x42e1d37fe929d305, 0x90f4a534b3415f36, 0x7bab53eb05933a2a, 0xad7bf7357b229664, 0x71b0b30bc7a9a5de, 0xf28e639436d0d9ac, 0x471749105db54720, 0xca9f54371d444338, 0x052e1244e5448954, 0x67e2c41de55aa23c, 0x71a25f5c02bf834c
+, 0xad9847ca4b96b218, 0x3b4b7455c36b3667, 0x0dbba9d2cd3db7ae, 0x20a9f1eab71cc830, 0x72372f1f4248c39c, 0x582b10ce7c2e883f, 0xdd4b26ac04dd0c0f, 0x2d152a02e978af71, 0xf3193397ea87ad38, 0x24b283a5a821460f, 0xf377c4c1a8bc9de1, 0x0f07a491f85becdc
+, 0xe65c638ffc6ee154, 0x2c1632e18e54abb1, 0x38bada9beac77542, 0x66ae188bf1dc22b4, 0x3bcbfc52f483c7f8, 0x154fd6337fe0b85c, 0xf8e14c7a7616934c, 0x4299982e8952b3ec, 0x64b9e59d80150130, 0x6209aef9b84c6869, 0x72b0aa7a4ea321f6, 0x1bb35ef1aec5ba8f
+, 0x8cbb97f5008742fa, 0x0db09107ce9c8fe2, 0x782f1fc4d4be2a44, 0x0f7e29616a7f2a2d, 0x9d8c9f47508da2b1, 0x2e3be55ecf941d80, 0x482402bd4ff0cea3, 0x4b388612dd184a68, 0x985124e94f5635e1, 0x7e7acd2f6b90449a, 0xb81a868e04f97a07, 0x613c2f0c0714a7b1
+, 0xbd31da04539120dd, 0x319fd80adf962369, 0x011ad6139b777131, 0x0b0b3a49af52398b, 0xa56345d4034bd818, 0x72973038243035c7, 0xa5b7283f5b04aae0, 0x06cacd96a7883f43, 0x12f278cb04de5306, 0x4385a8749e470182, 0xa8724ce512e87c9d, 0x0dc21340769d7728
+, 0xf4e51aac43c31b09, 0x070f59a542a98fde, 0xe4082cf7fef6fb44, 0x0dab6d98f53713fd, 0xeba84d8a17e4744e, 0x281bfb4717d2fc87, 0xcbc2a10ed5a29c5a, 0x0f05a258b72d1bd7, 0x82e65a267be0b4cb, 0x6b7056b75d21e1eb, 0xd347400e86883a25, 0x567d6e92a6006bb2
+, 0xe8f4dd6547ab366c, 0x155d353492c77c59, 0xd6b2b9828e6eb8b1, 0x53216d9f09771e14, 0x2d0831211b8da410, 0x1c839c315beeb260, 0xbf8a80be9d577480, 0x5baa2192a0592562, 0x190b0bd00a4fec56, 0x1e5ae823c4405bc1, 0xcc83796d10c6a7b7, 0x16ae107b6212c6ac
+, 0x6f5a68cda5dc7ea4, 0x5c2bc23ce89a519c, 0x77f2067882d3e4c2, 0x47f822d02d377ac8, 0x189314e9e1b59544, 0x44a2b146c4bd42ee, 0xbd3fb00f6b55984d, 0x02aa53b60592df33, 0xe8cce0910359561d, 0x6fce04d65e89ad88, 0x888893c589e0504d, 0x2021070c84a4fa1d
+, 0xaf8e7772a45f5442, 0x2ae07a8375755828, 0xb733e7e87187a4c6, 0x073dc48bfae1ea6b, 0x81a7ef4033c579c3, 0x6d692798577ffcba, 0x28dace3773e82915, 0x2ff17bbd714d1c97, 0xb3a244114cb7fe3f, 0x527b58cb02f94bf7, 0x903d346f0a6d538b, 0x4cfa3e824c5158b5
+, 0x78caaf482b7ef4c0, 0x3ac14c1f77aa165a, 0x1218663183d37652, 0x2d22fdbea6b97e08, 0xd05ef302200973ee, 0x1d5b69ef9b552849, 0xf993c0da0c3fa84d, 0x5cff685e669278e8, 0xd6304cabe35ba28f, 0x1538f683c5edfcd5, 0xe92d29dd13819e7b, 0x4ce144602312334f
+, 0x867a71b916d04f1c, 0x5d677237ee0bf992, 0xb8d7637959e56bcd, 0x5822f3b9548c34cc, 0x0e2d14129c684fd9, 0x50aec8f87b66dd2c, 0xdcc1bfc03d5d4e37, 0x4f9d4af7432c5e62, 0xc99af1d7893fc347, 0x4fd114cebfc6e11f, 0x02b63c4c8a52ba5d, 0x5fa08e9da4793cdc
+, 0x069e0b13de87811d, 0x6ce2de6d05defa5e, 0x60c5e0d633a8528c, 0x0d52452af00187a1, 0x5bc451b092e064dd, 0x0fc85205b9ef55b0, 0x84a9ea12aed9d998, 0x20c8a813e6bf3d31, 0x30d50246396423e0, 0x2c6897ca1fa20625, 0x437f7386caa3076f, 0x5bc20621738ea1f4
+, 0x628533c28dde0617, 0x5fe0824c546ea18d, 0xae4df6586bc9be2e, 0x0434ce681b3f6de0, 0x57740157575c8e8a, 0x5becec6546c6e9bc, 0xb6c627f174676f23, 0x260a04da5ee973e4, 0x2817e242928ce662, 0x50e14fc2e2d12384, 0x93907088646f2fb1, 0x130bdbd1a24da9b5
+, 0xf5a50c02cb238050, 0x6fde781eb2a654f0, 0x2893931a1598af8a, 0x745562886dc2f1e1, 0x041d1011dd9a900e, 0x2af1cb073ba156b0, 0x711b613cc8553bb6, 0x589f7193307fcedb, 0x5bcde0896c10dff7, 0x58037624ed260efd, 0x119d1ed25e092612, 0x665562aa7f18b5e6
+, 0xf374b3e388cf241c, 0x764a600557264585, 0x778ac194a5ea6c3e, 0x657040ea157dc6f8, 0xabcc0b65ebab505d, 0x3959fb8170cf0a89, 0x71c9e28c486320ff, 0x1b0eb6afb7ced59e, 0x1aeaa519b669f5dc, 0x06b926766f9ed1ca, 0x238811cc5aba2561, 0x026c4453bbf37036
+, 0x3c7358d0f8c87825, 0x6982fcbf6e3a3aaf, 0x74a2543a24b6acdb, 0x4adca42aefbe698f, 0x75bb85a6884f5242, 0x7148aab79261ff2f, 0xfbab21b026afd52d, 0x71bfc79e01c38b44, 0x6059b3a4465be890, 0x30e80c5cdb4fe15f, 0x01529e4f9db428fe, 0x2df9bba6fbe2cd2d
+, 0xe9502493729b1426, 0x14a7ce7a9b2d1f23, 0x757cb271b6b66874, 0x72c9fd87677fabd8, 0x949a8ab019cef62a, 0x6d97c7f6ae28e970, 0x8ba2fe4285d83098, 0x2011088fc7f3f099, 0x84a978554862ea30, 0x0f8f7a351591d350, 0xbde13529dd3d01ff, 0x6645c8c8afa13674
+, 0xb65de576f911d478, 0x512955880b401fc2, 0x1c10b30bf586fb4c, 0x7da629fa502560ac, 0x875752118e741240, 0x02834fb9dc98e15f, 0x24f2fbe79b69fd8f, 0x70c410067be3daa3, 0x44a94782e640311e, 0x3f145bdd714f7acc, 0x9251712d437fe0d2, 0x76f5b6308c9a1118
+, 0x41608bfa50a80d5b, 0x63841f5b9f7a3d51, 0xbb5a05ff86fcd1bf, 0x5dd09dbaa5f86aed, 0x453c457cb12acb0b, 0x47ea1b06ea056404, 0x7c5c5bc540ad8b88, 0x02b240b30fe77ad7, 0x2b9299d33d08bc25, 0x3dcd692daa9673ad, 0x1cab5f55f9373a89, 0x6b0b2c4fd66229b6
+, 0x6412b74439ff775f, 0x60fccb1ebe05fe6f, 0x9b1573ca701c48a5, 0x3a4424f1bc7aa993, 0x29687a742608652f, 0x7b30689cd23d1b2c, 0x26f078c09ac6e352, 0x7ff746144b975ab2, 0x3af492d349c38519, 0x30ffc662aea4bda5, 0x5dc32f3e69e616e2, 0x741591e5d627e437
+, 0xf87f8cb7a2b72a97, 0x7751f7dc5694bd7d, 0xa8f710eeded6e130, 0x0131e798d904285e, 0x553ec20aadc36ef4, 0x0f45128b37355122, 0xfdad4f4758bcf55f, 0x2e6952b8635a990a, 0x82ff527b193b86b5, 0x562cef07e2e4aec3, 0x13502c858410b336, 0x70398ca60f4c369f
+, 0xbd974076f4469a57, 0x4deaf51309ac22b2, 0x4e1d34aa014d5e6f, 0x78cf89011ee5de2d, 0xd89ecad19ad7d994, 0x14b0df83bb2b6c67, 0x94e852f33a48c909, 0x2fdf09e22abaa1aa, 0x3489f1be1fd3846a, 0x16e44dc6e95f7dab, 0x7ccc3af5557877e7, 0x79cc14d5ad547981
+, 0xb84df05142728698, 0x3b16d5cf7e8bb3c8, 0xed017cdfc7cdce65, 0x717154d3139a9fad, 0xb8f29418d1991588, 0x7f06bb8d7bb42dfa, 0xd0917ccbaaff88d6, 0x3a3c68ae448e550f, 0x341d88ff71149471, 0x4040bbe50250df4e, 0x22abbb369448b00a, 0x59cce405b5ec9a7d
+, 0x4b4827a68e4f8682, 0x6030eda45f3fafc0, 0x035ccc57f814fab3, 0x526c76ae5dfe5f4d, 0x367166dbda2fa80c, 0x5b47036f25efc033, 0x160663831d411fee, 0x27393187aaf2d3c1, 0x64fc0f210a6b34c7, 0x26c1c6d01ccdb72a, 0x32345a7567f7b70f, 0x7e702278c4c2ae8e
+, 0x955de360d2546a37, 0x0ab8f820c6af1d20, 0xb061903e34778705, 0x15ef836626b82d13, 0x2fa366d1fce26e98, 0x734bf155b73b1793, 0xe715b6ecb455aa72, 0x3832a30de7d38a13, 0x7a56105163eac4dd, 0x278e896d4548bc25, 0x82c83f950a5dc5b0, 0x5795db2daa07613d
+, 0x57f66b9537d0b026, 0x2ead39eb09b5212f, 0x21739572e8cdbef8, 0x4afadc79efe581f9, 0x2eea1ee8ba6e81e2, 0x0919941bfcd1073b, 0x302c033d9101b5e3, 0x31d6d194fa8a86c5, 0x8715f805cf2466dc, 0x6897a6d6245ec8af, 0xb095d1167423decf, 0x16921644320fd7db
+, 0x68262334a438a93a, 0x40f1ffede2e7be03, 0x49ecbaf107413b02, 0x69f35b21e6bd046d, 0xb013540da97241f4, 0x71cae2d23fe2d8d0, 0x530a860329c01c38, 0x21cea7252312c579, 0xf83c8b427564d562, 0x4db8fed7bd255b9b, 0x1fcb054c68ccd6e3, 0x70503f2939e9462a
+, 0x45488d14feb328e8, 0x672b18f05e198e55, 0x92945f1b0f90f23a, 0x48bbec41039e2dcd, 0xa2a2a4e97f2dbde2, 0x1273ed721426b3bb, 0xd6a329f9b8ebdde4, 0x2cc878f2fa271a80, 0xa04e0c911a2bc87c, 0x5aea54844fa3e124, 0xa630e8109490302b, 0x6566d09888e072bb
+, 0x3a83d2a1f6fc63f1, 0x189a524a4837aad5, 0x4943dc707f9763b7, 0x067c86ee21b46e9a, 0x610cf5cc9bccb098, 0x76f13084e03be390, 0x6760e8d290df8f02, 0x141389a2fb27805b, 0x1021575dafad9ffb, 0x2ea613e154da9431, 0x12e9a5ce270d10cc, 0x32ecc0c75217bbd4
+, 0x67ab73ee9929600e, 0x4b7eb92de1abe834, 0xc918e06cc69e9b48, 0x1105ca016a594ee2, 0xe5c6394c3f1a6fd2, 0x6438846a9900ce04, 0xd961517fc9f67a67, 0x760f40caf2bde1ec, 0xa8caba5d46530fad, 0x00de360c4f83b648, 0xe84bc386637e366b, 0x605783b66eb7fa74
+, 0x42156e606eac059b, 0x3854d1f85fc73a0a, 0x6a147d9f25cf5ac9, 0x1b4a2a324102c7bb, 0x9bba1658f0294715, 0x3bbe305537b8a988, 0xa98c3aab39495cdd, 0x01a681e1cd270b15, 0x939942087f25fa9b, 0x1b38741e499f4e6d, 0x0fe7e025cf1b8465, 0x0ba856d8b02dcaa9
+, 0x1dba55d1fe6889db, 0x22b099e0c0a326e1, 0xd0d9646fd5721c5e, 0x74debf3348141744, 0xebfa423800dc4a3d, 0x5c879888f463fc5f, 0xdbed9f91c37eace0, 0x5771a6d9f5d759c2, 0x430934558e03dcb6, 0x2a7e37b65a386c22, 0x3b3c964530e41002, 0x334058805013aa09
+, 0xebb194592562c7f2, 0x09a4a1676b1e2d0f, 0x3afb8f9fddb874bf, 0x51c93a088655b078, 0x940baa91d3243bf7, 0x74ce3af525b84ae9, 0x96c9955a67e6f24f, 0x7b2aeb43a5a0c510, 0x9162c73d01c95c57, 0x03e48458250d9679, 0x1746ccb38f0f45e2, 0x4b34e73639c62bdc
+, 0xd16d377bd7c0a966, 0x3b03245d9e6ed818, 0xaa9d5b168d3b8262, 0x41974ebd810d7b63, 0x6309990b15701719, 0x79b74cda2e746c75, 0x87bfb9dfc0340149, 0x6ee352dfb5dfc1f6, 0xc75693ed6421a11f, 0x0eaba8dfe0746059, 0x1d7e16153f8de945, 0x2363c08f2dd9f00c
+, 0xbd7a7ae32f853afa, 0x33bcac6f42abe9b1, 0x302effa9e77a556b, 0x4e3ff71a44861bd3, 0x0187aa0287b06e45, 0x21e7ef4efb814deb, 0x91471493fb907f41, 0x3377471e1463ecf5, 0x52c6cdfebdc0aa2c, 0x2d6f68dd6dbbd11c, 0x75c376a98f54c7d9, 0x0f6c05119926d7ce
+, 0x186df7b8dfc8f508, 0x1384bf057450cda5, 0x9016792da9a0a52b, 0x0fc6cf20dc43d879, 0xcf44e172f98c001c, 0x02c6461c7c33781b, 0x47cdfa3741f18cd5, 0x2643cf8c58c3b876, 0x99fd4206c5e7a49c, 0x594eb4cfd897893e, 0xa2a86a776a47d789, 0x36a2531ed716ac24
+, 0xd02de6b23bc39cf8, 0x1adcf3032a6fd61f, 0x6ce7ecfb5058772a, 0x24570b364f8d798b, 0x91689b7475321b33, 0x004fb6b1428c5f07, 0x4aa839488f2f0ed1, 0x42a90555916f1c8d, 0x2f5855981142ca56, 0x4d53c6efa19797c2, 0x234202724a456973, 0x3a2e59085f300cd8
+, 0x7b8533f55a9e7074, 0x4c068925f183b834, 0x4ff56ec1298a7860, 0x1f202641bb6904e5, 0x7c8ff8d408824e63, 0x7d78d591ab44b919, 0x6cc7b1eda98ca23a, 0x06242f46650a4e69, 0xcd85117937913d19, 0x49b12fa9f2a5c4de, 0x2761f652f69c920c, 0x1fd38500bd30b481
+, 0x7fe0214a9eb2e916, 0x1d408422f0166fd5, 0xa78b8a5b3acb8d33, 0x4458025b197ce70b, 0x76a6fc1512d3cfa1, 0x462b118a34b062f4, 0x4bc10814c7470c64, 0x5c56a5d63c8a8635, 0xd8b00ba8291bb4d0, 0x0d1dc662650b32f7, 0xcdd6752b16758d64, 0x38154f376e9a6106
+, 0xa75c2b9e9b312f02, 0x6389d143b35a2517, 0xd792f06ae0565081, 0x6fe735bc976afa0f, 0x40c9cd6d1549d490, 0x30222c14a1426145, 0x0d0d0cd2de6ffc34, 0x4e09808ea748039f, 0x8ef52d0f40018cea, 0x541bf879fc283ea8, 0x516287526b90a9bd, 0x1f721ceaea94bd5e
+, 0xd019d3d23bc0c565, 0x07841ae9413311d6, 0xe4a941d77ffd3d48, 0x26137bd1748e9ff4, 0xd0fd1837d1bb822c, 0x4c29b32924ae82aa, 0xeb287c7c33faba6c, 0x27f780ef0dbad63d, 0xefc32aa4d9f447b4, 0x010bd71573ed2e3a, 0x5875c7ef89b13011, 0x1ca8e34ebf9b9c43
+, 0x8abe9e451d62a85b, 0x7c02d2c4e2429720, 0x46f40abcfc6454f1, 0x1b5ee53c77cb1b2f, 0x5dc1dca8afffd1a1, 0x06a6bd368649e441, 0x23522f8df401c3d7, 0x08fd2cfa6efcf70c, 0x92a1b08d35350852, 0x108e724d2032ff4a, 0xdc689cfaeb515107, 0x490940fa41149509
+, 0x7b2ce97fc8c9bbdf, 0x49d3262cd0e0c7cc, 0x49b429528d3088cf, 0x763ad0afe6d341fa, 0x91cd1d23c13907a3, 0x6f1adf6fee9d5762, 0x0d8757f5419a5afb, 0x248116a2df9abfab, 0xb8135ad81ad80371, 0x58ed2cbce654225b, 0x4b7031bbdc8cde85, 0x655040d570550541
+, 0x80273f93dfbe4168, 0x1d1c3029c0a1be67, 0xcc2e768baf8fecbe, 0x4654223b1b3a08b4, 0x6ba73034fd5d3630, 0x730f9072ddcbe6c0, 0xe8921b8b940362d7, 0x342ebfc4f62ac4a6, 0xcaed5011d34ccc63, 0x645db54ed876dee5, 0x93e8d20367fba5d9, 0x0f61c2fb0ffc2e3b
+, 0x284cb813911e95d1, 0x3303dc64108cc000, 0x5a0699f01dd95498, 0x3fb248bbf370bace, 0x5e2ca48f8e8d1c2f, 0x44b2aa408523f3eb, 0xec7cc212686b4c30, 0x75b979d5c4c30354, 0xc9c4be96b8ad8abe, 0x65b9519f91167e12, 0xbcd38a1c5b9706a2, 0x3cb4124520b76556
+, 0x1c8ce16869077d43, 0x72294fe8eb0f4a66, 0x0d323925ef0b776b, 0x4f65eaa2f567ab6b, 0x20cd0bb50267c29e, 0x48a5c208bf56ab2a, 0x2e8248dd1851317c, 0x2dc2511f3bb17f38, 0xbfdf8b6e6814b3aa, 0x71a6ee842c94b4f3, 0x0da04e5be75a279a, 0x3fb9d1672758e951
+, 0x05e2d9db47f1c749, 0x3df7cc5fca1a42ed, 0xab3ab9f7fd3156ea, 0x5d2cf91c70b27e0d, 0x96bd43c2adbfc22c, 0x2fbbafc185af9518, 0xbde55337c0e2e187, 0x340e99afcbac3ced, 0x272b2b700716f8bf, 0x253e2cd168e924a3, 0xadaae3639ae434f7, 0x365d219d0d86bdf5
+, 0x881201b2d82d83b0, 0x79bce442c4130770, 0x64309f5e9b2bc62f, 0x0bcba0cf87f23b46, 0xa465b289586eff6f, 0x5bd4ee3383ecbd19, 0xcfcf1f6f3ffd241c, 0x617d7efd61b73216, 0x038424afe078d957, 0x559124c65b14a88c, 0xa1ec33c0cfe0fad3, 0x6364b8b891126378
+, 0x7c2b39406fe855c1, 0x68a2796f66f04dc6, 0xac530ac0d30b6ab9, 0x143d6fde4750093c, 0xf4bc35c893cd3607, 0x30284c5efd07ac4d, 0xf29ccaae68036429, 0x0bb82d160ca48954, 0xd5339582de92faf2, 0x0355f75d341218f8, 0xb14e439765718df1, 0x2c74350975a8efc7
+, 0x46e26e40d1b3b438, 0x23460283db72ec22, 0x631287b94dd9daab, 0x60a2c02bd8718d42, 0x9a72b0272e713be2, 0x6cde491787cb4fa0, 0x09cd4f8fa9056e5c, 0x03393d31c9dbb506, 0xa3213f66305c283f, 0x2f771c57acec143c, 0xe7c7c5ab130d2b8e, 0x03f9efd79a69bdbe
+, 0x84b0e4e08084b227, 0x4bd04b3bff6ea608, 0x548b3cf0a9531018, 0x2817913d9581408d, 0x9ffe91908ce8ed5c, 0x387e0c1fce4abcda, 0x5fb65271956b0843, 0x2ab4aa26636fca79, 0xc5399264a1e41311, 0x3645a9b0f0ec6e89, 0x1fc738d0dbfe6b7a, 0x4786633b6fdea407
+, 0xeadb42d29c7195b3, 0x2c44520eb84fd122, 0x66683c10f86ce4a4, 0x385f6c2a04da119d, 0xa67a796182e3724d, 0x0f6b99303cfa97e1, 0x2549d3a780020efa, 0x115776cbad4c983b, 0x45a9ff2ee3f774a8, 0x306df604cfcb90e2, 0xab1b5e99255d7c7c, 0x5f34d78b6b83b2b6
+, 0x0d82424c606efafd, 0x0a56af479ee397a4, 0x7cdbe400b90c1f81, 0x38e8116da75eb3eb, 0xdbdb29855f8805d8, 0x488ef9981aeced25, 0x87b2613402ba3612, 0x2461e05d2110f6f3, 0x0562c815d1cdfdff, 0x03621e4ea87e45ed, 0x87bfa1ed445e2331, 0x7a9ea550c4367f93
+, 0xf51e524d22124b79, 0x3bbe0c87cf7ddd74, 0x3877b486139fcc31, 0x339a381c6477f2e0, 0x8cc6275a6a8f8d07, 0x324135983448c301, 0x6268d7634b68cdca, 0x4d92ca298f3ac971, 0x63dd386541da1b5a, 0x57882183127478d9, 0x1932472df7a5628a, 0x0bc35c49849847f2
+, 0x052da96c63f91a95, 0x0110c9c18b3b2418, 0x74cd695be027c043, 0x522221f4e10c69ac, 0x05add20afdf95396, 0x4a8792587f6f7c2c, 0x829d2cd74005d0b6, 0x08c263be4315db09, 0x9cce4771ebdf9216, 0x2bf1d3e46309c835, 0xc6589ac6997c30b3, 0x30ac6a9e5c0309b9
+, 0x1c5ffe93eb98ba50, 0x5035cc153b0d26e7, 0xde5f3b73d694f654, 0x15c357e9d4347896, 0x8f92ab8b0225eba8, 0x428b1e1fa15b4c7e, 0xf39ab153e1db8378, 0x0bf53aeb80a16ab2, 0x07e38c92f63a4bc2, 0x00f02d483b70cb19, 0xd5cb39df97f6dbde, 0x3bfe11c3e4a76fbe
+, 0xb46fdec25a2ed99a, 0x5abed04a7e10363d, 0x846c2233f8f7ffc0, 0x1768be6a07cafbbc, 0xd6a1bc0827d1e53d, 0x7768052236c04072, 0xdd54d911e2dcba9e, 0x163a600b148d3d4b, 0x55a2d01e36ddfade, 0x3a86c040246ee19b, 0x3f79bab131c9e9a8, 0x6e51a1dc09cda9ca
+, 0x162ce0c7c555daf9, 0x2ac7590086c1533f, 0xf2430c9414f6f79d, 0x4088f6f18894b37c, 0xc9ff749e2e2e08df, 0x54e45b9c3e781f43, 0x49bed58f95a90bf3, 0x4dace605a19d76c1, 0x3fbc4c84a0745aff, 0x3d904d694087c772, 0x1902da214e81f54e, 0x684cd44920c27bf2
+, 0x9ff18c9a43271f72, 0x4780c64437696bd8, 0xa037a41381c9fd9b, 0x61001af2028b453d, 0x6cf1b9c728fbd586, 0x07f9a32f0e56e762, 0x192c4d72ecd17612, 0x7ab590122745b7da, 0xc9ea4100230b1e58, 0x696dad10df1db9b2, 0xc22f2b8174455797, 0x6ae52ddb182401b4
+, 0x49b1b36f08e5d906, 0x0462fcd91f66b0a9, 0x70a0b7876ad6c0fc, 0x27d77663aa142dab, 0x910840973c464543, 0x0a4792df9223dc7e, 0xb6c3811ba0ce55c3, 0x5ef276ec84e04e0c, 0x806b4627fc781fc1, 0x76315c0dc4525b9d, 0x0d2be0d336ae1cc2, 0x381f08cd4174ddcc
+, 0x0fc3c737083d31a3, 0x4ac32fa19ab6fb64, 0x484d342421eb7644, 0x2ff24b37e691770c, 0x5f3d4fd314a3a657, 0x2cc39f4c64f57aeb, 0xf8dd401f21b0bc97, 0x00eaa4b58e354795, 0xe549190a3a8b2058, 0x6eb3a7b10a26db0b, 0xc5253de34dbcdeed, 0x4268364aa7b2652c
+, 0xe1af4610b4d6056d, 0x66ae03f8539a1a8d, 0x5b8056f2a51d0943, 0x43874f7df91ec8d9, 0x3807e659c5ddf1b2, 0x38a2194057d23721, 0xcb3fbe60b2678295, 0x0d1c4328ead9043b, 0x19715094e74ca568, 0x47e8096e08a11ffd, 0x052981d0cc4b7c3c, 0x52b8cc9e2c3a007e
+, 0xb46f0ce736dc17d1, 0x20fc94263f3e54d3, 0xda811e3143d7d1c3, 0x784e0499413ee645, 0x11cd62838ec7fff7, 0x2622b33068f1bdc8, 0x8ad022a3538e9ae6, 0x7adc3a2cb397e2e0, 0x8ecdd1869389b7a0, 0x05783985ce36ebf4, 0x63a788b38bd609c4, 0x487ff7832809df2b
+, 0xb86b1e77cd8b0d17, 0x0eabf51f49eb4601, 0xe4540a3664993dd4, 0x2c63774eacb335f6, 0x8d6c0ecace2d2121, 0x2f227e8c35dcfe05, 0x996f3b6f5028c399, 0x5cd00995de041a22, 0x5e4966ac06c98e4f, 0x59eeb39d6af714be, 0x6ccc8aa05f4b742b, 0x37448bbd533de236
+, 0x12470793cbaf785d, 0x4f48fa07f016260b, 0x46c7671428ecab96, 0x79d94ea57dfb91a8, 0x468a19bcdf4f625c, 0x0abeaaab0e8d6034, 0x5a0933488dab66d8, 0x3fd2ad30271101c7, 0x9772a14e832c64fe, 0x6ff42058da39bbaf, 0x826e20e1e670e376, 0x10004f14952bbbe6
+, 0x02b89485da194618, 0x659b0e6eecaea534, 0xcca9c3555f2db756, 0x70feee4bcf8e3cb0, 0xf25eb89df81d850b, 0x7dd2ddc75edfe14b, 0xeacd2d4f10eafbeb, 0x761e201892460d45, 0xecb51a035e341bf4, 0x52c3b9f1d66a33b4, 0xe3f039d87ec92baf, 0x571dcc7651197838
+, 0xa30e68680caa39f2, 0x36e526a1aa3bcad8, 0x17cd0fee3765d0ef, 0x1b1c073ced5862ae, 0xd36044140fee18a5, 0x7acb5e5931717d99, 0x766084c616657b63, 0x18e9a67a2b194f17, 0x9b8071142c1523c6, 0x0f9f27072b792adb, 0xb430741df84bd098, 0x019fb67ba66634e6
+, 0x24f655ad201ad75f, 0x053392418ccb7b6e, 0xb60f5490b2061105, 0x094e74e9842acde6, 0x4ad80522b709002b, 0x1b904a34a02c209b, 0xf285426e2cff0a7b, 0x1b444e677cf9690b, 0x3231e5dd1de86dc5, 0x594bbe1b17323a0d, 0x60ba12bfc0428099, 0x2d05a912315a7593
+, 0x835b896af1679ed6, 0x0cf4c704936d1b7a, 0x4b107e0a8fc29372, 0x387c2a4fa342592d, 0xdb9e18f895dcd664, 0x4ba6dfa2d6668155, 0xd4a895c85933d869, 0x780a70116f12e2d0, 0x62ed798fa969dc59, 0x75c0dc12afc42c22, 0x88d2b8ccbd00de8e, 0x24f792fa941b0ccd
+, 0x08de4de8b9fe4775, 0x1600a89a6554307b, 0x11698e68fe1e31f7, 0x5ee3f0aaa7a6b5cc, 0xac6f831d54d26688, 0x17197c302bde6fb2, 0x29227a5c3a257858, 0x40d7d938d93e6935, 0x07e9ef40f1fcebc9, 0x4b7ecf440d975d9f, 0xb6dbaecfd18fb13d, 0x278ecbe651ecf1bb
+, 0x55a73c1cd97c4851, 0x28a9cac651b44544, 0xd4c22a344901a980, 0x01e00dffc0a5302d, 0xaf2956828c36f722, 0x781fc40c1b9d1890, 0xad891f226b12d436, 0x33f28e637ce7aa71, 0xd70a06ecbeed6067, 0x4c07061c5925dd88, 0x98b05cccd3db9050, 0x6ed9b825b38ee1eb
+, 0x94234ef8d2d013f3, 0x1ef4c0a9f187cdd4, 0x9b3e77b91a1fc961, 0x4ba94a3f61d07f3e, 0xc2e40a4ecb47827f, 0x619e0498761a9741, 0xca172d3460b20b39, 0x1413172fa9621283, 0x6d300c15a0aee1a1, 0x3a7647718b13ef40, 0x242a8142e5327a5b, 0x2389e7b423f7f6fc
+, 0x791a5ea122d40d61, 0x49a857cfdb016e20, 0x840a5c50bc5f72a7, 0x06ffbcf4aa67f938, 0xebfa85d51abfc800, 0x4fac34afbe6d35d7, 0xa83354691a60e802, 0x28d0a6fda6ce259f, 0xfa0ae213724db7ed, 0x0bfbdf897e8cacc0, 0x6210bba8b3263bc9, 0x782c2dd4b5e7f489
+, 0xcde2bf5d4c7974f7, 0x29c574fb3c7e4314, 0x87883c67d84a55e4, 0x5eb612a09fd2c7aa, 0xc2ec6a7890980c4f, 0x3ab4473ae1df4175, 0xe707ef1780de36c2, 0x39518b14995f64c8, 0xd5a4159b784d7539, 0x6643c551771bba82, 0xcf5914bb5f8f234d, 0x703378efa80e9f80
+, 0x5c3c4622232f66ae, 0x2574bcee4efca2a9, 0xfadcb83ac30ae8c0, 0x5bd081195b35b246, 0x55e854c8f6355434, 0x02d4f206cf9a82f1, 0x7ff09c519544b2da, 0x3d6ad3e749671690, 0x52358692892a7c05, 0x0ba1b860524d112f, 0x7e18fbc239bdec52, 0x42a9aa5a9c9cebd5
+, 0x4d4ecd2be69ad2d7, 0x16fb4eab249178d1, 0xaabcc78124e21ff4, 0x796ac872444302aa, 0x86f5380dfcc1f429, 0x49b44c9ebe1cce36, 0x085d53043a1d5914, 0x10c7317e97b40211, 0x2cdf24e44db104aa, 0x665fcbd6188088d6, 0xe6a8574609c497c9, 0x04468f62bc361daa
+, 0x2f1b9186416c4ba8, 0x3bc7a1a79008e1f5, 0x2023805e2220a4f9, 0x39e5738d6a769f03, 0x19c213665ed680b2, 0x63406ef24d0243e4, 0xb7198ceacdbc6eed, 0x4ff8ab4f3d1d2b80, 0x7aaf0b26fd10d31c, 0x5824369e2c337a53, 0xc4f35a5cd045e1bf, 0x45694c0a8eb7881a
+, 0x36d371f71eefc216, 0x7560b2a017c3bf88, 0x42fad3eb815ebc44, 0x5c789978c4698af5, 0x7fe37337a68e84da, 0x636871b166a67191, 0x7cc6b28048cdaf3a, 0x2c6446ba3beede08, 0xb0356d0357cb4ab8, 0x515db458c9c5a359, 0x9eb9278d016ea8a0, 0x1b5ab8835a35dac5
+, 0xc53665bdc35a9912, 0x6eb985f63a32245f, 0x85b94405ad20a0e2, 0x1c8bde0ee832416e, 0x42e7d0bd63e758e5, 0x78ca41e668af52a5, 0xe35a176e2773774d, 0x290e9d1eb9aa43a2, 0xb793a0cda2258387, 0x4e66c62a9f4192d5, 0x64b13796af303c61, 0x315b20a31827033d
+, 0xea76e3d60cf4f65d, 0x69223de0ca7a249f, 0x6599430edbbc8804, 0x6a1ee07d527994c9, 0x1e8716264937a342, 0x14551e13986a65d2, 0x20b518df171f6c4b, 0x74c2727c8b165dcf, 0x3426c5a601384e27, 0x45ea60eafbbc6895, 0x08dfae794f4a7d03, 0x1bb0db43f9944a63
+, 0xc425eb6fbafcda62, 0x622661919fb550bd, 0xe658a1c33f9a0bb1, 0x2a8821751eceaccd, 0xffc3ac17c4c586da, 0x3967b84f4435bd4e, 0x5be82f4ab6b6808f, 0x634fe75fe4ce0c94, 0xc4132f99b4c17c6c, 0x6c3b18b4991aab83, 0x8311b57c3f481472, 0x094299005c3fdb0f
+, 0x8a8ea5394d3cc589, 0x2e4f6d017898eae7, 0xfa06af9ce0f06a74, 0x0a85266270b9ee7f, 0x66e970b1addfa6de, 0x537d89f126978a22, 0x4976c9ebb76033ea, 0x45e0a05983c97ff7, 0xd168e23542b23bda, 0x7afa46bf1e7ba569, 0x909951fcf09bb8fe, 0x33c0f39a046ad877
+, 0x9e914ed98b1fc521, 0x2aa8f6f1c3b714a8, 0x65c138be9e5cb62c, 0x2511c884b6f75c32, 0xb3f180e6b7dd302f, 0x48f9d51f513d1ba5, 0x70e19a6ff4a4d9b2, 0x5730645bd7b49136, 0x3dcc29436beaebae, 0x03db10ed2c4fa887, 0x41184ca7d2572078, 0x563c5b3bec37f3f0
+, 0xad35813f865f6fb7, 0x627d588c47c1c377, 0xc2fa6393b5f74445, 0x4af168280acb84d1, 0x4340e377551e0fc5, 0x0c8bbfd1153d89bf, 0x79f9507d64e75788, 0x44e7b09bfab87849, 0x6a9742766ebf231c, 0x622c93d025fe8a46, 0x6ae343c581d3b4d4, 0x6c10595e84f23867
+, 0xe08b346714418b9e, 0x283d719b2fe6ef88, 0xb7339d2de45c180b, 0x75acfcef11d2d5c8, 0x8f40777a8c561876, 0x0c54ac40a7134c4b, 0xb92e287d66baee08, 0x6f357e5006a188bf, 0xc5903319ed1e6971, 0x747c45ef91dafd40, 0xde4086a91d2f816e, 0x5dcb27edb3b3ef7d
+, 0xc9744971b65f6463, 0x767c33b2636ddb95, 0xc8c1dc2e73bbff64, 0x0aedd2bc936325e3, 0x4eaa9bcca599038f, 0x741764d357b9b74a, 0xe07a765920b63e68, 0x22eab9ed460802db, 0x085fe3df9dbeadd2, 0x344511de37a59ba5, 0x08595a6a81af24da, 0x464d3980588c82c0
+, 0x43fdc46cfa1dd2ee, 0x51551f9f70966498, 0xb54534f761ed9bdc, 0x453455b3073fb07f, 0xf24773e383cab70b, 0x679be25e758cf4df, 0xda17edf2943eee29, 0x3dc9e5b8d6dc0f66, 0x56a50cba413fb75b, 0x1e65315bc5a8537f, 0x5ff90242802c7213, 0x73c9d8c8f425252e
+, 0x6094c4c3c7ffc262, 0x4c17aa9a24c8134f, 0x27d8ac9628aad338, 0x5a84d7d17c49f035, 0xe82b79212b26176c, 0x3d82cffda7bea503, 0xce9d3977f27522c4, 0x4c91551494947b1b, 0xbc471a192ebe675f, 0x374c2caface982ea, 0x3203c41c2b6eb1b0, 0x7536031963130d8d
+, 0x05bfe7aee5a265ed, 0x76f8863469c316a9, 0x1226b5a86254b98a, 0x1449ff44faede5e7, 0x80c721e5e1f809c4, 0x521610c0b5a5affa, 0xb2f2c0df965a864d, 0x3d745682db1e13a7, 0x000f0a44a17abed3, 0x56f5bf40530283f1, 0x182dd1b6aafaa4dd, 0x58f2cf0b2235791c
+, 0xfa7446482b2368ce, 0x505274e39ee08f0f, 0x7b87fa0f5ec5d7f5, 0x2ad4dba58a06f6e0, 0x33b5aa77ba4a24cb, 0x7fc2a2b21454a23b, 0xf39088a3caf332df, 0x45b60fe9c0d31e11, 0x41ccb6e827a4db9f, 0x2fe65f0e4fb85cd0, 0x836e2ab03ab45f1f, 0x1b8563bdffc99d2b
+, 0x134d6f57f92f2486, 0x611ba78290ef2e31, 0xd267b83161248846, 0x613e455a867cfe69, 0x27fa4d1f187cf829, 0x10b0a92f0d52fa3b, 0x120df7dbc37dc0d9, 0x5c5d6bbe73ad640e, 0xc13e5e6281c026e8, 0x35abaf0d182ae166, 0xefb0266b12a04e45, 0x433d81f700c0b3e6
+, 0x824f23ddba647d3d, 0x787ce8f5818a4e60, 0xd0427ebbbacf2b87, 0x5ed04a5789531eba, 0x743b1db64b8eb1b1, 0x11a45707951f8735, 0x8c9d98069972cb6f, 0x31a1d94a8da419e0, 0xac7d28afa97d5122, 0x4e349cfb7399e93d, 0xebb99cf597daf697, 0x4d8a5cb55889f484
+, 0x3c637b8633198c8f, 0x534f84b3ed414f33, 0xad313e72dedd6902, 0x5ed57e941cdf33af, 0x5a6fe01d2a57306e, 0x73b63dea344713f9, 0x39cb70570f1c2bf3, 0x2df8c6e49f1a18db, 0x661bc349677797e4, 0x501ae7cbbebe9062, 0x5b52a88de8959643, 0x0372752811c01d51
+, 0xaf4d9642669eaade, 0x13cc489b32dc1d2c, 0x1f2855c330267048, 0x5a212712c55cd0e7, 0xe6f76b094fe02f22, 0x75fe6370bcf50826, 0xe741901309ef3514, 0x6f93bd1ea0a8fd99, 0xb7b0767fed1a2061, 0x4891c7a955388273, 0x30bd7db19a22ec65, 0x25dc3baccedcf989
+, 0x010c57a2301bb928, 0x378b317155554fc6, 0xf883fa4229a02cf1, 0x5f0047b850d7db29, 0x4d247ae328402daa, 0x0d030627a850a2bc, 0xb4e65d9a88a443f5, 0x6ec9686b2d6db089, 0xde202e08fea1d987, 0x5c64e1d3f28d7600, 0x157d17bef661bfb7, 0x56392d36dd75334c
+, 0x14e324f7e1c23a6b, 0x09b868fb036e10ee, 0x9e6bd4a20c1dfcac, 0x2c574b64b16f849e, 0xdcab82e495f7e45d, 0x1e2c7d20e68aa8a1, 0x581e5ef10892d88e, 0x431da2a71b788e79, 0x4b291557134b950e, 0x2fd5b59759c39beb, 0xf4912be07e90180b, 0x77de823f89d6816c
+, 0x430cdc1f04cb4f00, 0x3db8b8f5686ced40, 0xb8ba3749daff50e4, 0x2cb5cb49875050df, 0x0580e0f45c8f064b, 0x7c2d6fba2984ac9d, 0x7200245a0b128cf2, 0x6f8a51e23584b6f0, 0x29b4dc4d6b741705, 0x2cee4afd6fa9ab77, 0x88f135b255f71733, 0x2a6d0d65a56d6cfe
+, 0x54e2d05b31b68645, 0x5922f8c138f3098e, 0x0167ae24102af8b0, 0x3069d99f8a14cd9d, 0xa82642e44835f666, 0x19ad5224ba9043bc, 0x15164ee7ef40faeb, 0x2334074315f0f545, 0x2b29fc620dfb1d0a, 0x31281e00f2382f16, 0x74165af5dcb0df0a, 0x46afa20ec79ca207
+, 0xb9659d5dbba4e582, 0x48982c3a6b70b790, 0x9eba1a523014f488, 0x7d2c273391237e3f, 0x6d762b24b9bb9f6b, 0x54eac18875cf2dcf, 0xbdb821c605776f56, 0x7a73f53792401636, 0xb8da98aa151ac75b, 0x263ea8a428ae4118, 0x3c53f148f20a1c6f, 0x6a90383996e3bede
+, 0x4b8f51e9313c5b1a, 0x26e594a9851d6c8c, 0xba1192761077f6f6, 0x66980d1347ac187c, 0x6ff9142cf6869801, 0x75de33f6717199d2, 0x989ae3e86495960c, 0x6e2fa442a44b2e02, 0xf777b1438116efa1, 0x7de0a99a94eef033, 0x792dbbb55ce358b9, 0x4baa39bbd06e8ffd
+, 0xcabae4a34d093944, 0x781129ebc4f52ddd, 0x8b860de344487ea2, 0x56ebc9f824c36634, 0xd8d467d62ea5a530, 0x2a563b52e4c6c927, 0x803fbd13d56be09c, 0x036fdef83a1eb1ef, 0x2035687afffdf0f2, 0x3ebf6eb649c6819d, 0x846dcd90eb75224c, 0x35ce05403159b339
+, 0x51404e67b040b636, 0x160c6e7429218423, 0x077bc7ad0c6eacbe, 0x2ac63ff8663a7097, 0x85cfa8a4f43b54f0, 0x21b24761d9dad70a, 0xda0f9dee21284b4f, 0x2abf0bc83dc2f39a, 0x6d57b7928100842b, 0x518a0e0d8c0a3654, 0xb14f9e6f789fa2b5, 0x6044d6ec5735519b
+, 0x77a8f57513af96ec, 0x45496b15e1e4ba1a, 0x125148aee6ecb3ae, 0x5b12e7ffd2a9ff05, 0x3e8cd4b4188c0d7c, 0x3ae51f1be282979f, 0x5f81ef2dffe90ff6, 0x3ac5b189d55790ff, 0x126f70e006f00e38, 0x4e0ea813e19b967e, 0x4c5173f1a4e29504, 0x765c713b7d90f62e
+, 0xff2169652b34a588, 0x3045e915beb9b03d, 0x064a6e5c45988a59, 0x60da0634aa34eca7, 0xfaac2567460a69aa, 0x4862959f765a9c5c, 0x8ec51273536d88c4, 0x626cf3b63f54d281, 0x4a3d98fc2532d3cf, 0x0870cc761bdd5da7, 0x540871d3a5b0b4fd, 0x282f6f5c5711210a
+, 0x6b12853b7dee1b26, 0x6e7b8566ed1e5527, 0xb5730df0e36c71c9, 0x08c02aedf3c1466d, 0xddf8b9335b426098, 0x6f1ca7b5e2571549, 0xa324ef3a9f56e694, 0x2d1a0b662e7a9f87, 0x88093ec45b119016, 0x7b3233b719f9c43e, 0x520580de082a8f5f, 0x0fd3383bf0499ceb
+, 0xd9a7fe25202f3acf, 0x2d22cf1682b80710, 0xbc27c50a0565fda1, 0x74c1b0139a396264, 0x82e735e46a7960e4, 0x12282705292705c1, 0x76b2df1e3e8cc223, 0x60234f9c0647dae1, 0xf9527bf122a38ce1, 0x0415514d03e11c72, 0xdb40617e68bc14e2, 0x439fbaa7de857f38
+, 0x599f03d5590c59df, 0x6f64ca8d27ec4b61, 0x1e4888114825962b, 0x471d647fb2c772f3, 0x73d932e9efde27b2, 0x47dfb9115a592213, 0x0a9e34c39b4c4b7b, 0x72989ce3fdcb1b5e, 0xa91af0f77af676da, 0x30b49c4d4e2b25f9, 0xb2e282fea5cff8cd, 0x78aec85775288217
+, 0x14be5e7fdb9ba9a1, 0x653a8e6f45206e7e, 0xb5b23d43b61fcf5f, 0x5665e6c4fd10b4c7, 0x10bf4eb2f2188e97, 0x62af8e9779570661, 0x3657082a4a017026, 0x7a69cc7ddae8cc4d, 0x95f154ddf2602a84, 0x4b4be28e986017ad, 0x78527df635ea73e7, 0x501ec9285f3b5e8a
+, 0x13ee5e7927bdff6c, 0x2d0cbc71988ca0ff, 0xac08a3ff78f0fa3e, 0x2a09894d31b36467, 0xc7ba9fce27ccf1e1, 0x5721021f66e4baa2, 0x5da823fa19aeb80f, 0x7035591299dd0060, 0x2551a751fca50073, 0x2ff512a6e8877240, 0x26ca093f31e3c422, 0x4f80b3cea44f87c3
+, 0x696e340b14f80903, 0x05e0b906f774f3b8, 0x225ab7a41b9fd705, 0x3d42eb929a09f605, 0x4d8c6f513959ea9a, 0x4c6e56c331a5ca0d, 0x90b058de134e19b7, 0x12168771c6186e26, 0xcc4a64bd90d6639d, 0x7cd7a16b32fa78b9, 0xc2134ac1f8cb5553, 0x18899e541b5c8753
+, 0x04480249b39cbb78, 0x7fad6228bc2076af, 0x8f92c9fded13bb4f, 0x566fd0614e3d440d, 0xc085c6ba3a5b255a, 0x472370a3cb221b2a, 0xabf53a7ec0658551, 0x399082983f979b0c, 0x24faf21b970448bd, 0x4d34eb3e68028468, 0x991f14f8120e5082, 0x3936898a42c29ce1
+, 0x3d636fa82855539f, 0x14263ca27db9d32e, 0xd8da8b7bc459f89d, 0x09b2d6d7d7ea78a0, 0x9ceda02fdf099fa3, 0x5bf4efd930f73892, 0x14fc145b8f11fe25, 0x5d099506e975ed0b, 0x794a144b248df0e8, 0x6c16bca0a8874d4e, 0xbf2fcd2a61b6fce4, 0x33effc468e2db6c0
+, 0xc72e12593cdd2d5b, 0x08e2277592aa62d0, 0x37f586179c9be1ae, 0x5384b52a8ba061c5, 0xcef77ed5180d06af, 0x054300e659bb4d2e, 0x176f1396ae6be469, 0x1f92e6b2cfad5298, 0x5ebb1e5234d04151, 0x1277eb24f8aeb857, 0x8724b031439d69f1, 0x6d28aa91efbc6371
+, 0xbfad841ab73098d8, 0x5d0d68407cfa3d7b, 0xcc446d0c86480b4c, 0x77b5e4bc4734955b, 0xe26f69f9be97012d, 0x221c250ceb1c6815, 0xed2854a208f7cfbd, 0x340f5881c7243a64, 0xb2c30cecd92341c9, 0x28f2ca7e0b4590c5, 0xa9ada43ac3043c72, 0x572f3e74ef602d8c
+, 0xe873e2043da51f2f, 0x42a4923bdeba86df, 0x4fc5d7980e456f84, 0x2bc5d6f646f41b62, 0xe7f61da378db16d8, 0x21828014d8b3ee00, 0xf963c05ca711a4ac, 0x7ed57dccfb38f61f, 0x366ca28abe1360c0, 0x1338ab08e1f053cc, 0x95c3ebeaae88c626, 0x5075e5bfc9019d5e
+, 0xd9078e63c7b108bc, 0x1daebab1b6f9ff39, 0xfc5d1decaec87f85, 0x3da479760284ca4d, 0x6215682345991246, 0x049fb36b9562e815, 0xaf2a971396380c95, 0x373d546e008aef5c, 0x21f24a25bbe4854e, 0x63991d54375091fa, 0xa16a1426fc37ab03, 0x3a482eb1a1e1d589
+, 0xe25478d8bd19155c, 0x146d4f2d3d336afd, 0x9bfbe00bf94e15e8, 0x2b185a9a6adf10c0, 0x926527b3ed52ab7b, 0x67997e1473101e80, 0xb58f4ff4947cc541, 0x36f800c7fac99a7a, 0xd0302e32400456d9, 0x4372e43640bc697b, 0x9144cabb4750d898, 0x75d25afac9a23cbf
+, 0x9b9519376879149b, 0x3ad2a7bfd02967ae, 0x1f4eca20a0d75c67, 0x6fb4ca7dabd63cda, 0x192e872bcf4a2334, 0x71da7fe4aa448cfb, 0xacccbf53779e639e, 0x0979e2c7cee0ee9f, 0x43c6cd6f7d5a93ad, 0x1f9fb2e3f62cfb4c, 0x8dae6a8a884ebb83, 0x3af7c3e1e1534069
+, 0x794591767655cbfe, 0x74db216617fc4b07, 0x7057b2242566d0c9, 0x1d543b5908417b23, 0x19c280b444428783, 0x352309fd8b6cc3ef, 0x37833d6ac068ae72, 0x4ec0671a23c019f4, 0x9d9836e1a3d05bb5, 0x44fe1adff224efe3, 0xa296bc3ce57efb4a, 0x2efec86835a14150
+, 0x848592cceed36695, 0x67af5d8c960ae921, 0x8cfff9359bce21cf, 0x529b9f899d339e3a, 0xbfbe7e695733e69a, 0x1ea7bd881fed5c60, 0x5799e0a52f934fe7, 0x15494ceb21f8c01a, 0x370f17ce8b98af71, 0x6eef14a455f96a36, 0x277ab9510eb94396, 0x1f0b3fbca8777bbb
+, 0xb4d9db82c9514c51, 0x4f2a50cf0b87da56, 0x46c9ed2a897eb8b3, 0x7d8c9a0d0153b820, 0x2caee2dbbcbb58b6, 0x67eb233d7e282c60, 0x743d5e973289831a, 0x295c9b2e892b11bc, 0xb5915ec2598a9b2c, 0x57141c281e285a0a, 0x14cfd9319f2fef47, 0x1c6d802dd9af0efd
+, 0xcb9b7fd49210185f, 0x39d0e77dd467204d, 0x8bd39be0b1672f76, 0x57b62d44b5f8bc62, 0x3575293abadbdc7c, 0x73c67e5487eb80a1, 0x202075d35f3972dc, 0x3bbea171894784f3, 0xeacb50d82eb78e1b, 0x797f2e113794881f, 0x7f8284dbdad4392b, 0x44d855211b4f1a4a
+, 0x0ad0c8c7c04e0f85, 0x58fe130f3ba2c286, 0x218e5defa51fb863, 0x118de67c55691b53, 0x19ed09d1dd9727f4, 0x3be2dcfb4f05fee4, 0x68c327e3edb327d3, 0x0271cb8f74ef9457, 0xecdd65e4990a5bbb, 0x3eb0bbddf4e1379b, 0xbed32535f3a65866, 0x157772bca634c755
+, 0xdf60e02b77b9ba2c, 0x12b3262f07c1a219, 0x9d6f52c0b1f5bc2e, 0x3b41f524e738efc4, 0x9af5c950242916fc, 0x1d4fe74ecbb6c882, 0x4892177eaa09d635, 0x3293da5207f96b51, 0x5a9029691c1db50d, 0x171863066e8e9278, 0xfc7c8930aa6d176e, 0x0b55b8abcf6484a4
+, 0x2fe19c09fb194bca, 0x18cc07d3953cd206, 0x5bdff217c9c0b9e0, 0x671aa756581abcee, 0xe1cc33ae28f7d1a2, 0x1b6f254937a0a3fe, 0x51503d1665babb83, 0x74b95636d5889211, 0xbdb97ae4ea96f869, 0x1507ce189e2510bd, 0x796e4d54fab93b13, 0x6a81765f05960929
+, 0x593a94ec3347b611, 0x1e6f40db35cbab01, 0x2324984a9cdfa2d8, 0x44f32188a8674743, 0xa17f308af43900d1, 0x346136489b61514c, 0xc6f67ec3dc54b481, 0x33984698653a0872, 0xf87fab8007f30d92, 0x607e99c20fad67cd, 0x31e4d5168d34e5af, 0x10b75d500b2d9216
+, 0x2e940521e5a833ed, 0x3bdea532b245f644, 0xbea76975ffd52693, 0x64b94848ba6d4ed6, 0x9db52d0194e33ec7, 0x71cf65da55639f25, 0xede73b1fdb5a8138, 0x12e4d13b6c62dc22, 0x9d19b0c265185517, 0x77a011d257b5fdd0, 0x1fedc5caaecd84e4, 0x46844e151e3492d1
+, 0x721aaeca1d2450d3, 0x6c4e5d517f271e40, 0xbc96906f2ab1cad2, 0x58792f3221c01e74, 0x5a68ed9cd01ba16f, 0x6bfe1c9b47a73331, 0x2c75c7885ef91551, 0x663c8f49facc7fc5, 0xe6c4e3308d680339, 0x0e57e0357c144ab1, 0xf3e91ae6e75719d0, 0x564ea5ba0fea2313
+, 0x98748ea083153d4c, 0x0599bba2d42e2046, 0xc99e8de6a5df1e43, 0x4f0e4bdd697c7907, 0xece3a5a999ba059c, 0x6983d64c1c056d90, 0xdde51970327bb051, 0x16c2a0890a9b67ab, 0xf195d3e663d2d707, 0x660c32768143753f, 0x24388a174cdd23b3, 0x39425b853f037836
+, 0x8406dc8b57852861, 0x6e438aa656a06218, 0x7be0fd4265815115, 0x1b0223e1b0afaddb, 0xff05337a3cd89793, 0x60cd12f2fd323050, 0xa8b191c13c6d2766, 0x03246f88d1e5b87f, 0xeedbbe3ec1450bb6, 0x59b19e6a2f370ce4, 0xa310f6346ecfe586, 0x38297ed92f0be1ea
+, 0x3a73acec165eeb87, 0x3fe649208aa46620, 0x0c690cd3bff064a2, 0x40620cf8aa9314da, 0xedf8f666653de9f0, 0x47073f7ad998c22e, 0x51dfe41eebce4df4, 0x6c8f695233723f4b, 0xf1b4992313e1caf9, 0x00ed2778c80cdbb1, 0x1b307c2caea4da89, 0x7d716559e64add0d
+, 0xa15c6570d6ac4195, 0x5a91bb24b6fff642, 0x204c62f70dff736a, 0x5153f1cc84cdcc4f, 0xfc60da57c7343c05, 0x23356c4050263f6d, 0xfad07b39b786cb40, 0x2fda8355e3fa4ab8, 0x77cf02260ef62619, 0x131a551ef6edf273, 0xda385d6ab6076832, 0x61344ae239c30a61
+, 0xc1b0e00ff5965ceb, 0x53dced2beece6f00, 0x3ea178cef3d0cff9, 0x4e77adefe273e079, 0x3b34bfb502c61917, 0x15df0ecd276dc459, 0xa353e1c017c2be00, 0x4a4c11f5109e66fd, 0xb764bd3123895d6a, 0x7ed592b40cb2b5c6, 0x6485866b9d88ae89, 0x57e3c516d33a35fa
+, 0x33a3574e85528e83, 0x406b1c8987989a67, 0x35552003bfd40168, 0x2de68bb16365d719, 0xa5a92b10b611e67f, 0x45f43eed19c1e364, 0xe69a5f3b12eadad7, 0x7e1855690d021e2a, 0x7b582d6a9803f789, 0x5d8927c4887328c5, 0x56fcb4313459d7f6, 0x4e48b1154ac0d887
+, 0x82d00e2a8027f275, 0x2f3691be565a1cef, 0x5be7ac7f427828b8, 0x26096e6de95b0163, 0x1e86ce3ca23452fa, 0x083b89d77bf2ca18, 0xe8b2c374a0d2accd, 0x0b968343b55f0973, 0x3ab17811b0c22f88, 0x37d6dc8381ab4c6a, 0x46e63e57d4696bf1, 0x33aed288a60852f2
+, 0xaba42aedc790ea0d, 0x0ca1e542b2762c76, 0xa74f77afbd733615, 0x2d260b5c67521498, 0x8d954172056f2d66, 0x57583026813a8c7d, 0x5e6c193daf2a1703, 0x4146e0687f9ee79b, 0x0de218af6ceb1d34, 0x64d654edc2f4407c, 0x2fc82cad422bb3c0, 0x6a7b0c126e790602
+, 0xac3beb60219eafe4, 0x2523683626fe9a10, 0x9b740db3ce6ec824, 0x0895788929bd8b74, 0xa21d24705032b3e7, 0x79df8789aac295c9, 0x2cb368bb898b57e2, 0x4fd0c6b87c64be8e, 0x7dea68e53ead4428, 0x46c2bda49ea52518, 0x0821e028a45fa8b8, 0x2238320507967d9e
+, 0xe7d4f87b4943605d, 0x44a59970351d5f39, 0x4d6a95c95d48919b, 0x6f674073115d02b2, 0x8b5f26bd08d59cb7, 0x1fa7f5beb49e49cc, 0xfb07e635df4b4fb8, 0x069124bbf7458ac5, 0xaefb963c1fb41a71, 0x37066ab4daf24276, 0xb5e96789b3cc03ab, 0x00ba63c7a94d40e4
+, 0x5e4f1e007ae43567, 0x53aa9b67771c4c1c, 0x444e1355bfe11a1b, 0x2c2776de64f1aa59, 0x4c1bc42efb6e1625, 0x7fd4a01711a07122, 0xb1010c8813be2029, 0x2b474b77dd9e93a6, 0x415687b1d5bd31cb, 0x142b0151d7751976, 0x6e40b12f6ccdaeac, 0x58b34c1490122a88
+, 0xe583e8a92619e5f0, 0x7b32474c274648bf, 0xc6024981518ea58a, 0x402549f1bc5f083b, 0xd7da721d59fc85b4, 0x3fbab2a3dfe4e3c5, 0x4b4c8deb17b46c12, 0x5c3da167c4aff91b, 0x725574c877d169f3, 0x6055a0c82ca57923, 0xbc4970653b78b484, 0x62cd5bcc850000e6
+, 0xcd19a94b8a2bab86, 0x12236d4bc28b89e9, 0xd3e617cf0fb93425, 0x3c532c840b6fcc5a, 0x3398cd4cf762a315, 0x526cd13ede92c6f9, 0x52d666ad20421fba, 0x3fdcb7cd3aa34936, 0x9c2af9c1d00868a6, 0x2859019d44f0a39f, 0x1f07303d8e65a5b1, 0x51d7b5024ed9b032
+, 0x3b037b1eea675ac5, 0x67658287dbd2ba14, 0x06c5199fe76e2d34, 0x55b920b4961abc01, 0x49e247f118634a90, 0x0df471e1bd66cfc8, 0x9c7b9b605acf0801, 0x7c0068a1f7117d19, 0xaf0e793bc50a7393, 0x51088dc401d58028, 0xce3f102a4e178aa8, 0x4b2622da72373819
+, 0xe2d4be5788755c34, 0x4936d30394ad1920, 0x5a9ab855ec01ef78, 0x29a58e0e0739f8ee, 0x8e7a09e06a1d1e4c, 0x6fdd5065242dff7e, 0x6cb5768d93a05594, 0x34c4ba5a44c1430b, 0x9e807836cf26147e, 0x0604d9bf8afccb48, 0x07b9c5d5c4d29d80, 0x1db83188785094ce
+, 0xa3fa5a248fcb65ea, 0x016ab7d93c34ccdf, 0xac2a010df9771b58, 0x2677a4d18d2e852a, 0x49fb4910ae02afd6, 0x022fd580602f73d9, 0x6a6e93c36a8f7e8d, 0x6ab911e56c38b853, 0xd3ad05b46757431f, 0x07dfb9809792cce3, 0x5cbb478c83d0fc47, 0x735e597fca71bcdd
+, 0x2b3c02a93fc6b15a, 0x74d5c4857daa4839, 0x8e949d8e91d2e89b, 0x00b5146ad9bea6d8, 0xbed0aa0d356ddb2f, 0x75dd8620b5732b7f, 0x08418032b8af1c17, 0x2e1680772bf39166, 0x716409a7b69bd35d, 0x09cab41238a571e4, 0xd30414feb7f0dc95, 0x1ccfe6a8f6b5f634
+, 0x640ab89c7164c457, 0x3bc683167955bc0d, 0x3574438120f6f5b1, 0x0f52fe4382a965fd, 0x3b53e4f13c57ae1d, 0x23ded3143fcd2d28, 0xde9db7772b46f2e6, 0x7644a911fe8ba3d9, 0xc2d820bdc1bc86a7, 0x3bfbd5ce449ca39f, 0x07eec280d62f0126, 0x50c7dbc54938be2e
+, 0xb22ef93784a5f27b, 0x5096ce143ad54bef, 0xe8f564a396383335, 0x266c070d765282a9, 0x44a2b391642fa0cf, 0x3c8a9645eb086b0a, 0xbaf917d1c4a8502a, 0x4cfa00615b010b0b, 0x965e3bf236dd160e, 0x7aca56be21697995, 0x0ab7359e1b11530c, 0x4c6dd48bb65a8b5b
+, 0x0fefbca3f34a4191, 0x174b18b5ba2f0c4f, 0x5d95b171311e573d, 0x52e582f15e7c3eb1, 0x6925ae148ca31b0b, 0x54ac01e8c9643afb, 0x7cc1dc5ae82a9ed9, 0x4cf55616f2b7f576, 0x77eb26da622f2859, 0x4e4477204b12c726, 0x78ca27a81e3ab245, 0x63520cd8af9bbb1c
+, 0x39f5fa8be9b32665, 0x793313bdebd65b3d, 0xe9db2b3670b67261, 0x6adfc2dd8c2a993e, 0x0ce1620cc107451e, 0x7d5bc6eb5c6c79d7, 0x2450e1796a67692d, 0x5829cf5efc49f22b, 0x7fb3af830ae3e60e, 0x73cc93e91014699a, 0xfd7bdbc37db4e737, 0x02e462a6e0e4ed67
+, 0x4919187ce948c5e5, 0x24b586b65ff6fd87, 0x94e98b0924aa7239, 0x442f4a87a26bd9dd, 0x8b8e3be1a20d09c4, 0x24ef06def11eb2a0, 0xa1c2462cbbb4f565, 0x20c66a529e1d37ae, 0x765c32ba8bebfae2, 0x75efa86af7524689, 0x6ea2efe084aba013, 0x7209d710c257a667
+, 0x6f7d8540e8719b44, 0x6b6201d02ef6a34e, 0x4e750346348e5422, 0x589ed0ff9108bcb7, 0x2cda6ed40cd625fc, 0x3de669400dac4fd6, 0xae5feb86094d4c3b, 0x62168152fc002f22, 0xae54d0abd720e7ab, 0x60b33ea8f917aad5, 0x355287827ce699d3, 0x2391908ee78aaa18
+, 0xda20167982ec3d3d, 0x4a05cc6f160d2e14, 0x648bba939b772141, 0x5bcf5c1e3aebac5c, 0xae6f50df3114f987, 0x12ab06b4b9aa452e, 0x1697265e7837e5cf, 0x24d150fe7f62f048, 0xac9011d8017680b7, 0x31b3275e6472a4d4, 0xf631a3914542e4b9, 0x66c9873b9930b639
+, 0x5042c7a11adffcb2, 0x03b51f47ee5fea9e, 0xdf6b96547a0d8b6b, 0x0d456bb86b6cdf23, 0xdc6c54588b88e97e, 0x6585687a096ba526, 0xfbd66765abb566cc, 0x02e2704c6f137f92, 0x59084e599b2421e3, 0x0b0a59e876357d23, 0xfffece551dd6a260, 0x782a89b7adc9e672
+, 0xc2f892d541f13578, 0x3339be23d5a04581, 0x7de1f5c169993279, 0x2213f54dbed97afb, 0x9275ee84ba41bcda, 0x15ae83670638f631, 0x000c02a83e93cc7c, 0x505333efbd15108e, 0xbdeed4432d94f80c, 0x2bffc78fbab62127, 0x890eadf7ba89b315, 0x4e8f7be4e9bc56bf
+, 0x8d3e8d689ac24e76, 0x25af2600e26e66e5, 0x8627a191f4710019, 0x7acd0d0e24efef8e, 0x49c5b9e79dc06678, 0x41cd823eb10eaed5, 0x2e76a2524d937616, 0x1cea5294a399127e, 0xb08a8011ad67eda1, 0x3a6a001688d0eb6d, 0x42559a5d7bb5a2db, 0x6be0eddaa539efe1
+, 0xdf3b00210cc598ee, 0x5979a5a162d49637, 0x77eb6ad53971bf93, 0x45695893da172b1b, 0x6e520c2db733157a, 0x6a118fff9ef2633e, 0x126f06bc8cbd0d08, 0x2dada18851567f37, 0x577a9beabcd91484, 0x62a4744a08f4b66a, 0x209b3489941ce2a6, 0x2288002f9a53a36e
+, 0x91ee980182f13824, 0x3be88ea3ca4a4f2c, 0xf5cb4bee4d630d87, 0x4b9b9b8b2af27a6f, 0x6849fca76da038af, 0x3e57ad1f5c9dc715, 0x3c028eec045c8382, 0x6244d0e9c26c316e, 0x205b72e8ad5fcc49, 0x135153fb41252d9d, 0x939a3bc4029e827e, 0x7f12fd1ce287fe70
+, 0x0f0ee31f758ba4e5, 0x494c3da96f81d724, 0x26880123c8abdd1a, 0x1748496798c6c63a, 0x8415be29a6d066ed, 0x26baece538f7661b, 0xb07a2be570d4aa7d, 0x0ea60264c518d97f, 0xb60280e85df3e555, 0x5aa6cf71a4b497ff, 0x658272559847374d, 0x7ddbcf7f29a7b9ab
+, 0xe182512ea3b99768, 0x67986ac76562e929, 0xb2ea2063a7aed490, 0x2977cb8e2da06e0c, 0x8d22a35c0b10dd7a, 0x1ed50e2a090cae7a, 0x1de7ec8a887797cc, 0x0df4ae16deeb13bd, 0xfb9e23c045e95725, 0x12f3e01e6c43d201, 0xe129c302bc28f01e, 0x3a2fc6cfb56e40ef
+, 0x04c0a1fb7346963e, 0x2aed78e215b900e7, 0x61953843a35f3159, 0x1db41daad60a5170, 0x750d06feacac191c, 0x29c9926edffe2cc0, 0x4c29e0a51bb48ba0, 0x3a6dbdaccaa4df84, 0x988bfe3d1421b81f, 0x7801fd1f1e3362e4, 0x1caa337896000d52, 0x58bed487800be732
+, 0xbf2038c574609b53, 0x1c21460f0030f82b, 0xf4f75e34123ae63e, 0x58c14894cfae4de2, 0x4cbe1895a94c2b09, 0x0c70d90601d81370, 0x434de2f01516dc85, 0x60f773aba29bee4c, 0x1a12558f07085764, 0x5962bcaca5fa8147, 0xef6fc456b0339339, 0x0e6de6c25c3d303f
+, 0xd9b9323d693e106b, 0x6c2089a31bd1eb2a, 0x2b79bfa6afd78c0b, 0x7fab9c34af9a6176, 0xce8966e0e152b0b6, 0x4ad676e61b65278b, 0xce9d2b251e48e240, 0x423dd12606590a1e, 0x621421f2068747c5, 0x0877435b5741097d, 0x05b4a2cdb77c7cf3, 0x378f5a9337499407
+, 0xf0b55c02753cac7e, 0x33190c7f68a4d42d, 0x0af65e71f569e562, 0x2cc3c894e288670e, 0xfbbedf3a3922d0fd, 0x402d3d47fa294ca8, 0x462c510628d93136, 0x0be6d83380d3c1ab, 0xbb0089c992746b7e, 0x69283a1f2339f338, 0x029ac6f2a91374ba, 0x353928fa904f67f6
+, 0x2be0fff89e6cffd1, 0x6c4c12110508cd53, 0x2dfd1aadbb4fbeb3, 0x69406c8d819e8fa3, 0x0722870dc549805b, 0x65e5e2e8403cabe8, 0xff7a17d76b9c5ab0, 0x1e644de08d24a8fd, 0xaafff5a7911e0881, 0x3b4480566752c30b, 0x929114694a4ee7e6, 0x467086fd88cfde2d
+, 0x45d6ae41b3be3c30, 0x0564f09f234e5673, 0x3257543ea71d66ae, 0x70a8fa5decfd3fc2, 0x2dd6f931c041ec0b, 0x5e5603ca24df8e18, 0x2665e292551982c4, 0x761a776a79ba8261, 0xf93bc2e30796e5bd, 0x0c008575e98e61fa, 0x053b730f054cc8fa, 0x7762021714a0e6ca
+, 0x3121ce6bb17c3533, 0x15507d6d60e37166, 0xbfee86215595d2ca, 0x24715b1f2f523bbb, 0x88e110822d0922f7, 0x16f5adc958b7d422, 0xb85a6c7ef4a63cd6, 0x63b076db6111b35b, 0x37944a0d61a61033, 0x5e8744f0a86d340d, 0x4765affeb22b1572, 0x22b9ecb600356ccd
+, 0x6a15ef51caec8e2f, 0x0033a432da2fb699, 0x3a55140156947288, 0x38027223b3645d5d, 0x1b5360b9396989a6, 0x11bd6f5c777da21b, 0x2f7b8063ff62e11d, 0x16df1b69365cf176, 0x7e49d3303ee2f5bb, 0x74af2765b76e62c0, 0x5793623c47526936, 0x12ca7e85d2f3cb36
+, 0xbd389b17ba07da66, 0x77e9c39a4f245ef1, 0x2eedcecb49078a25, 0x79b1865e495dd6ba, 0xcc80b5e73ebb6c1d, 0x3670c2439364d00c, 0xcbce61f9beb03673, 0x4f7b54f16ea972d2, 0xb073b1ea0438fbf1, 0x4768e9419efe240e, 0x6a2271d6f7a69880, 0x450af0ddc4edb68a
+, 0x932c72a6328b6283, 0x2738908670e53593, 0xb2550b1073be3f6f, 0x2e0c65294bc40cce, 0x3fe6432dd17e74f8, 0x0dbe470a2822cca3, 0x2eda3f41070b35bb, 0x6db63dda8ac27fc0, 0xc2ffeea5fffbb19d, 0x5ce570f69bf3f836, 0xece3118ce0721526, 0x269c61133b5f64f8
+, 0xbeff871929eaafde, 0x01b45f7f9a60ba1f, 0xb85dbceeb9710486, 0x1f80d8ec4b1b0e47, 0x1c9d144574179030, 0x4f5985cb45ff9fb5, 0xfc8858ed243b67df, 0x0aed1d52bed8f349, 0x13046ab790f2150c, 0x174009e2f444ecc3, 0x60e08e877ada85e5, 0x3a11b5c9e752ced7
+, 0x31351900d4f92e8c, 0x7ede41f662111c1f, 0xbb40d9093b4d111d, 0x38ee8a1391aa51d1, 0xb9651ba7275da457, 0x392bb4882ae893db, 0x1f5a6209a4d7c733, 0x2f2cb7d7a062ea1f, 0xf4c182c6c9b1132c, 0x2d3bd7d2f5ff3368, 0xa44608d4e212a7e7, 0x03ace10a2854dc34
+, 0xb39020a56d26e855, 0x648ca78560757450, 0xe0406487cfb2dedf, 0x59740cc1753063bc, 0x03ee2b7f0e4f8aa9, 0x1a619a714172cc8e, 0x01a9fc260288bb57, 0x311633b4216b91df, 0x9fbce892787f77c2, 0x5ba174d23cdd1611, 0x11ca790ba3ec5569, 0x272454da53cd2a3f
+, 0x7633d2bd015b699a, 0x1f726be9fd4a4613, 0xcb9782cf88e3fc92, 0x2f25b07f2aecd659, 0xb7056ed7fcb9bbb8, 0x04bffacace828957, 0x016ec6b24c9a5518, 0x3ffd954677fc4fbb, 0x71b3dd4da9cdee62, 0x0e3a406fd077625a, 0x5d556f6d9045fdd7, 0x13d197d0d4411a45
+, 0xa3e1cf951c7389d2, 0x18f6d5f8f6caba1c, 0xfa73612a87604c7d, 0x2521b820881f92cb, 0x4b1eb0aac330bf97, 0x1f769bdac8777826, 0x8178736aac3f160a, 0x5d66fb330c61e21c, 0x331414caa0ca4b5c, 0x3903644c31fff76c, 0x6adc73e1288265f0, 0x42328493cb152192
+, 0xf64fe2dd28f33729, 0x278899d335a67b45, 0x07b3bfa1e90a9092, 0x08da1da0cfeddc8c, 0xe185b06488e7e345, 0x65f37f48c3bbc2a3, 0xbe351ecb6a4dcd80, 0x7e300036c82f2b9d, 0xbad861ee00eba3e7, 0x65665ad53a95d9a9, 0x1b4da160b0fdc3d2, 0x50d382725a84ff98
+, 0xb7195cf507d88066, 0x3fb75a25ba90af43, 0xe2553662439f75c9, 0x15c4eb5e6cbece9f, 0x8afc67ac95df8196, 0x108e3fa3ffa867c6, 0xb313769a05dc37ac, 0x63ca289b02c7ee27, 0x8b07b247714d366e, 0x5f9022fe19ef8136, 0xb9b040fcb25d400e, 0x00e8552ca33e06a9
+, 0x5119fa090802de21, 0x67c4f78d3ed3db1d, 0x8b51ee90d0de98b1, 0x2613bf91de80a726, 0xda07c5b0faa2e474, 0x7a48c6e4d253b95d, 0x7fd8e266f89af8d4, 0x749637e4f25a63c6, 0x697d6b37bd59bd0c, 0x415ada5db2f5d337, 0x4e8ce00942be14df, 0x452931e4ad2c8ed4
+, 0x72de7cb4f0e2896d, 0x20ddf526e3d8baba, 0x3a4dcbc1056a3041, 0x7090e3addc80f216, 0xede4b287e683d75e, 0x443ed3aa792c8b56, 0xa933bb17596cb250, 0x3bb76abcc3124fbb, 0xc6695247de96ab5f, 0x5dd0eaaba293a7a1, 0xd6ed34513581c7d4, 0x06b92ff14a3e2ffc
+, 0x630c1294692688a1, 0x6b9e65b07be7087c, 0x210716a37b0c4b3a, 0x2aafac6114b43ffc, 0x4b57c0ecf9a09b9c, 0x522bed931417decc, 0x0d3dc1f9589ceae3, 0x3ab640415427a068, 0xc48ada6d6b0c1292, 0x03142eca9666ae14, 0x7ea643b6f8fb008a, 0x3e8ecdfa3a70469b
+, 0x3c0d431243dd3bb9, 0x22e09b57abff4e84, 0x3a6e92d0d5e1c7b1, 0x100f7a9ccf66288a, 0x50273e4bdf657577, 0x7bbcf59cce4b17a1, 0x3ae27ad179775e11, 0x188f40eb597823dc, 0x4ead278e0cde72e6, 0x07692f9ea526beec, 0xb7a1447a0833d8ba, 0x0bafa1eed9c8af2f
+, 0x30d5e6327ef84886, 0x19498c7759992a7d, 0x1395c26440744a03, 0x2de16375d9f01b6b, 0x3d73407b4aac670f, 0x5482cda978493ee0, 0x0dd2f48705c8cf0d, 0x6d29d57747b30b6b, 0xe1292db0858bd469, 0x084bede3c9595a3c, 0x7db9421226c9f883, 0x70c4137f6f5e0838
+, 0x04c7708dc10ee239, 0x637adc6087d68a3e, 0xea0141529aa2fd61, 0x6a75213d6f62d6a2, 0x98f5a6d3691cb7ed, 0x31be95b3fa4cbf33, 0xb7f30c2c089c6466, 0x3db8def5d87138dc, 0x840d3a5f9b9d56f6, 0x2925a66291473bc0, 0x64a529cbfe632d38, 0x59b021e576637103
+, 0x7b4005bce6f8ec5d, 0x2a4d581e6105fbc0, 0xc96efbe0c819654e, 0x5779f41f2133eae2, 0xf3382a39830a0d7a, 0x3830b6258c902fc8, 0x671756e6abbfceaa, 0x28008aba0bf31293, 0x98accc78c19ab146, 0x4348290418ef14a9, 0xcfd97b14666253ee, 0x30ce4c74ccdcec31
+, 0xae1b1051eb9a237f, 0x57784cbad6b656ce, 0xaf6323f22ea4f042, 0x3fddfaae32bdb0da, 0xa9002b71cb9565c8, 0x5d66a61f2e98e385, 0xfc10ee2d413b7b3c, 0x49c5ba47fdb2f8d9, 0x95b149d2d796ef65, 0x3b3484e0e9e52d36, 0x23e28cbfc8cc5724, 0x26e72cc8890eabd1
+, 0x96d3305fdba5974b, 0x2f2077f6b7d9377d, 0xa887edff306ac68e, 0x6c085b57d48621d2, 0x8841158b5dc8704b, 0x3173d5961c8ff226, 0x045217be501c0928, 0x13a432ccf120d821, 0xc756c2d667331c18, 0x7730782d02562333, 0x36050a6cd8282c7d, 0x71e30bca9246c021
+, 0x4e85aa2e010525c5, 0x549adf8e01b02865, 0xfac1e80e70e34343, 0x4fe6e1bc78844523, 0xc5b490c6d92da504, 0x0ab4ab53040bd9ad, 0x9c5f937ac2440a96, 0x274bfecd606ca9a8, 0xa785a14031c002e6, 0x7ba7ccc22cecb8c7, 0x0180579995421acb, 0x5c4f1836708d89ad
+, 0xe63c9eb1ed26e526, 0x60366a38439b4d32, 0x4014bfa2d2b798a0, 0x3e09bc908a785a2a, 0x220a450e57906bf0, 0x076683b1f5ae525b, 0xab533e9499d3e4d9, 0x1406d28999572439, 0x79c5550187d28d4b, 0x757ad6407e70b392, 0x4d0a024e4657ffb1, 0x3a417e93c65831a1
+, 0x18755075bbe558b6, 0x17636e0ff81eeb4a, 0x687e9e0bf46df73b, 0x66f95196adbb53eb, 0xffc600c5f98a72df, 0x0388be7fd5b26ddc, 0xd944157aa687b18a, 0x1c3d67da023743a0, 0x721bea1aecfffb65, 0x58c62e7b08741453, 0x8e1d641fd34a0b4f, 0x660f76b143af3dbf
+, 0x9c5d87d31bd91ee8, 0x30d9b1895966f2fa, 0x4508bd4004200621, 0x294fe0df206fb6b2, 0xc6d113cd933fa833, 0x6eadd6710fc7d6da, 0xabbdf1db50848816, 0x03989a0639c82eee, 0x74a247679d39eb11, 0x1a9ae2c79ce472e8, 0x372d12362e00fe0e, 0x5b69a1713936f8d1
+, 0x17754845cbe8467d, 0x117bdd8013096d85, 0x793a5ef5cb7181af, 0x1ed4bf770d7a7d55, 0xf761d4e88a4b3cf4, 0x12ffbceac5bbc2ed, 0xc77dcee74348600f, 0x233c5d08276703ec, 0xdf151e44589021b5, 0x454b42587be6d51a, 0xefd939fe7b815a74, 0x12571ad35f677bee
+, 0x831ec7c0b6300b5e, 0x18f0cb82b40e9f0b, 0x7b5ee996f555a937, 0x1a9a53aa267d95d4, 0xce886bee64d472a9, 0x6a49ad89f9f73b04, 0x025499d787347d27, 0x2465ab7f2d64a121, 0x699636cc902180c5, 0x1bca717828cafb9c, 0xa99ca595872dc1cc, 0x6ee9a885f34878e8
+, 0xe256cc7b4073af99, 0x4fe0bcdc6e4e39e8, 0xac81f0e2b01eb747, 0x3393598ad2439b1b, 0x0d48c95ca50766b7, 0x4e4381d2e486fb49, 0x4c24a36f301383ee, 0x2e005098b68459ab, 0xa8f7b1aee851fd40, 0x45f9a45afb75cc01, 0xb5db3cad5091cad3, 0x2b5793ea6d4a9ac2
+, 0xa72f8fe7df355f6a, 0x6c3fce96f161666a, 0xafe4bc8d927b6164, 0x374454f500a8fbd9, 0xa163efb1d9a145e2, 0x430f0ee6844de3b0, 0xdb20baa017b7bc4c, 0x481ece0fc74a531b, 0x8ddaa88a045d8692, 0x21f817a0d4a6923d, 0x6a88d317eca60345, 0x369d56e83ca7844a
+, 0x5b82c30ad1159384, 0x7706016193c20f99, 0xe3b40af39fc1efcb, 0x208925308d7291af, 0x0f999838a3ae49a5, 0x226f4123de0b2256, 0x277329aff207440e, 0x132df1c2ffd33982, 0x394e37b1ef6296a6, 0x0a2c81ebec682ab1, 0xe15d0876f5034d37, 0x30fdc7ba0f76e129
+, 0x27a8ee37a72c6a8f, 0x29e158c21b322884, 0x9e06feed77a83a69, 0x684c67eca6db2e10, 0xb534bcd571ff9d36, 0x1f5bad80ddefebc0, 0xe5adbad3843eaadd, 0x0a0f789baffa69d2, 0x8ff8bcb7bf67fd39, 0x2090886d905e069d, 0x759ca39d5169fdc3, 0x51c2924bc0771baa
+, 0xc9239a4c19b3ca51, 0x5490db748581b18f, 0x55bfbbd8b6189db2, 0x2dcc69488c133947, 0x362788da68258efd, 0x6da4d320e53b50b3, 0x477eeeba53ea4f94, 0x74d20a81b6f0f21e, 0x27e5438437227be8, 0x0146adba8302de48, 0x63955576dc406c38, 0x0b97f85b30cc6816
+, 0x97042e6b436f9233, 0x30477c01acbf7faa, 0x4793104e900caee8, 0x52a4545d55d43398, 0xd7ad20356411f45a, 0x3c26b0f770d2f1df, 0x52f76db2dabd69c9, 0x71de04dac8deeb84, 0xe2b284e7c808d214, 0x68c4000ababe4e12, 0xc5e7fddb8b5190d8, 0x3f82ff00ae094a5f
+, 0x939ecb47cb808735, 0x0dae6173d71444d3, 0x6255b45e3bff4af4, 0x22ef965c085a19f5, 0x4592905e70f1725c, 0x03194ecf989d3ac4, 0x87861cab2b84b031, 0x4f1b880aba9a779b, 0xfeab8b8f8f11c9e6, 0x0b4125585c6966e8, 0x11a8c0ba6736011a, 0x45834a859783986d
+, 0x9a80c4e8485b7e0f, 0x6167c32d8d778026, 0xa85c5647cdf3ad63, 0x572e9ce6a7df1f13, 0xa9ed24f5258947cb, 0x7dba38b43ac59f5f, 0x80f1afc2f427854a, 0x11b70f59eb89dc0b, 0x1e2485f209a66a72, 0x7df1ecdcc2d6a299, 0x4264e31fdea58422, 0x7ddae398e2492e82
+, 0x5c6751664aaa0352, 0x7ab2951b86aa5124, 0x969a57d1ba002189, 0x21d292717320e26e, 0x7af55e6b539959f2, 0x5c0dcabef765e257, 0xc60822337dbbcef6, 0x331252e6a3ec6a25, 0xd31955dd0ae6c423, 0x48a0889979e0bd9f, 0x747f6af314e001df, 0x4df8737a3e26e897
+, 0x1228dd60c596e200, 0x15c0659c2c58ce69, 0x78fda77ff76724cc, 0x4ba7caffd9f45bc4, 0x4527987c13c9f134, 0x46af00f563463703, 0xdfb76cf6f9218639, 0x4df8265ab80534ca, 0x8e0bd9b050a3a650, 0x18795b34137ef573, 0xf5ae6c98eb794b7f, 0x1236cc62e98ce244
+, 0x613741cbd1a4bbbc, 0x3126d54e0114236f, 0x33f3e2e4d6ac71cb, 0x1fb394e9edad510f, 0x0efab0849f3e40c7, 0x6a76cdd82d1eb036, 0xba85e4bd32e46432, 0x22772362c3f2ca08, 0x52845d89cd1082d1, 0x1a4f6eaebba54480, 0xdd3e9ea842a85507, 0x612a6dde358c6af3
+, 0xd8df5537b09772c0, 0x5ab768f796363be5, 0x3dde5b1b9b6ea713, 0x62dced5ae117d665, 0xb44191cdc6113491, 0x36ecf5e8317ca15f, 0x4184647b140ee2e3, 0x5cfa1ad028545f0f, 0x1aa2ae4f1eb2330c, 0x120f2718c31ccff7, 0x0683c358ffa104ee, 0x12cf25bea7f81049
+, 0x659a65dbe7b8f7d0, 0x5faaa1aed8923d90, 0xc3c799130ce49420, 0x6c272e6fe276abae, 0xac9a50c268d93f08, 0x69045b0853e3bf88, 0x8b568bbc4b91be95, 0x6116d526cf09bdfe, 0x51351243e2359af5, 0x23133af22557be5b, 0x36c3c8ae49056ff6, 0x445e906245452e20
+, 0x93ae744fca059dd8, 0x0b1d95a077686b54, 0xae3275326b9a0f77, 0x6db1e553b59ed10a, 0x7f4fd5550825baa1, 0x448517b7be77effc, 0xc619a528b6b9feb8, 0x1e95ff1e536ee33c, 0xe3fc2c114b94e47f, 0x0f4871ccf712b6f6, 0xc18a41074a264bf4, 0x2c0532550c9bdec4
+, 0xd3b46061a0092c6b, 0x2255cec9aa1b8e42, 0x6b235c45faee6bde, 0x2fb6bce8e3d4a501, 0x5951825f2a0ad079, 0x1ea5abe83f4a5ea4, 0x7763be1d827f912d, 0x1464356592d66842, 0x6cdb5e3840e58e80, 0x5bf2b87471076893, 0x1daafb5666d2f1db, 0x09db24a78b4bf920
+, 0x9db820fac919ec32, 0x23b155c662e691e9, 0x30fa86a39fa3f609, 0x51b5f498276e44cb, 0x8b15be6817e2c33b, 0x18e283d2e37f0462, 0xdf99d393f0b3670f, 0x68e7a791e2d01d73, 0xf4fa6da9c77218a9, 0x0f7296de83d5c188, 0xc974bab926ae2c0b, 0x7e621edbbbd9f9f4
+, 0x4246b03c3cec13a6, 0x606a09b33640578d, 0x5b3e1eb1ee58ff53, 0x2d06ffb573c3f2e4, 0x5c9e83bd152a8e2b, 0x6e8b1fa087a332ea, 0x48dfd0ceadd1773a, 0x3b6ddba86cbba93b, 0x239b6bcaf7e3321c, 0x54da7adf92965019, 0x30c7295ce444c1e7, 0x723b8cd0b7255267
+, 0xec91016b98172a31, 0x3f7f49b89fed3079, 0x3d2911333caa1564, 0x54208d1b51f64c1c, 0xbd7e71148f136cf3, 0x3b1d129686809743, 0x96eb2d705c33abe7, 0x7d75abb2f71b7d4b, 0x438657a7a8be3836, 0x2efde2e4ee16085c, 0x8e13f1b9bdd0b3d4, 0x192c69e8ff896020
+, 0x03a9a78809cf722c, 0x4473eddd1fc09267, 0x8ca32db111787c01, 0x5479f95b5e4c3bd6, 0x4d6a31aaa5f5a5de, 0x0e27304081780d4f, 0x8eea5e3b227f01cd, 0x5133e0ed26c60b7e, 0x9c2fe8a4eb44966e, 0x3ab818b93988847e, 0xd7feed5e2b3ce965, 0x203889e9d3be7602
+, 0x94d0d2e6ea6b2b44, 0x5f6fcaf8bcfd3177, 0xaf34ab4b2d422555, 0x373dc9d9db75a0e8, 0xf3bdbc208d3361a8, 0x6e28caa93923e603, 0x135811c0bda59273, 0x1334de9c9f04583a, 0x4fcd2f597eb18fa7, 0x332b55a04db719a8, 0xb62c4d35cab03784, 0x55d7682a9ad072cb
+, 0x1921ca8f15c007dd, 0x457d4c319c66e5e3, 0x3b1b00440cdf45cc, 0x1924c39fc65c30bc, 0x83034823735bf8c3, 0x33fef017043df03a, 0x55d019297bfe3e50, 0x4a28c3f7ba290dcc, 0xf36d97e84f3e9d1d, 0x43de78fa956486d2, 0xf40611410c8d71fd, 0x7512a3e641ca3bf6
+, 0xd8334a98d5ec6680, 0x2876abc2eddf5413, 0xafaee6847607b01f, 0x3c9a73a73592701f, 0x041b3d08bfce8416, 0x0d959583620ca2ac, 0x579896412152d624, 0x13a67c5766addf64, 0x26c34db54fccaf77, 0x686ef6ebd0bfcb8d, 0xeb43e849f7c9c4ad, 0x52e0378f83070a84
+, 0x6cc8890241011707, 0x0901a4fd05baf8c0, 0x646fd5aa6b96cc1b, 0x01db97292a7e4e12, 0x63bfc0a628d9ef7c, 0x041deaf9f7ab7eec, 0xfcdf672849fb08be, 0x7903893d9bf3fad2, 0x9dbc37be667bba96, 0x7eec4421f37d7d97, 0x1c8a78babfcd4928, 0x15693eff2a14d385
+, 0xb8541a3051bdaf14, 0x6396d259518b7d9b, 0x409308a980f93f3f, 0x64fdaba49eb4080c, 0xdcfccb4d69423dd3, 0x3673131027c496c4, 0xee3d8d16e3e8af00, 0x7b3e2308286c83fe, 0x4fd2173bbcf31df6, 0x4508ecaac4dc7181, 0xe065b40843d1fb56, 0x72266f3978359a17
+, 0x998198d64f58c3ae, 0x7ae2b12e6ca3b69b, 0xf67b46d71115d499, 0x525621dec39c0b28, 0xfa5bf2d08cade52f, 0x0ad558580b73014a, 0xec6861d0dfc13934, 0x24a393a522fce369, 0x5632928535f6721f, 0x5eeb6f613b79886a, 0x535e3a1079dd1832, 0x05ce2828b682ed2e
+, 0x3b0862f46fc19227, 0x4fa90234ec5a2eff, 0x49b4fc389bbf64c2, 0x255a58521e306c0a, 0x297512502afc1238, 0x5515e33aab96a83f, 0x0ad80bbc93644ae1, 0x3601a1acc0ce1c1e, 0x5a620239bfb81f47, 0x29cfc9c66b72b50d, 0xd8886edfa9c9e293, 0x05abf4ece29f0377
+, 0x8afd71c507c66740, 0x1a089c87732118f1, 0xbf5e8f2c9c85a7cf, 0x66d0538e5b78652c, 0xd7bb0c1a043adc2a, 0x16e554c42f19f7e8, 0xbfeab10bfc248f16, 0x11303345c079300b, 0x9301ddc3edc26aa0, 0x7aee8728c37dc491, 0xf22435a8588d93c4, 0x6aeb22917e2a5820
+, 0x825f58e4296b0db5, 0x398781e0f0550d6f, 0x60a615c0b75cb296, 0x2c962f45185fd2c2, 0x2d9635e60c20c44e, 0x01d727d024efa368, 0x2e9339b49562c3d7, 0x1dfbbe4a5cd2d2a2, 0x3605f896c43d22d2, 0x6fba79cab93d439f, 0x4af86ff9db068140, 0x787a8a6166f24f3b
+, 0x6f4a604518a987ea, 0x2b06e2387fb86207, 0x01c6daa229c1c57f, 0x199dd9659318c246, 0x0b962ca1efd17bfb, 0x378a5ccdbfaa58d1, 0x52010f29a430098d, 0x374e12008122bb02, 0xdbadc19a0b52baca, 0x63c3c2ec43f6f58c, 0xc594a3cd46124333, 0x6778b067970237a2
+, 0xdc37509583b9f296, 0x3d0fc12cb1a63786, 0x3d63aa987be78d38, 0x7b25a28360add198, 0x2666c7673797e36d, 0x3d23466bbe9d7238, 0xe2b2a2fb103763ad, 0x725e1fee160be69e, 0x11b98239ec4dafa6, 0x3bc737ee3929e1ce, 0x9009384f0c6eff64, 0x17435aa431aaf748
+, 0x66215638bb20fea3, 0x7c36b951f88cd5a0, 0xa076853b1cea10c3, 0x5045a60df177bfe0, 0x517f1f61833a5535, 0x4f7e0f07886fefca, 0x661c05a148be48cf, 0x37d5f7eb490132a1, 0x93890e010ade1910, 0x427d765998fac2ac, 0x9f4f3a5e2902a925, 0x564eef10a24140bd
+, 0x776da038bf25ab0c, 0x10a94592843eafef, 0xb10c9bc16f533931, 0x4e1dc8a534dcdae0, 0x0295e0112baecef5, 0x307ffc3824504557, 0xb9f9bc3022c6884b, 0x7688f12b83b767ad, 0xbda4e3b19b541f54, 0x39172d06be2f53ec, 0x60499ca05e18ee97, 0x03c31701beecae57
+, 0x0cb2dda52ca88c9c, 0x1c466ec0b78518fb, 0xa2d1dab66c3fd88b, 0x5444893ba5c8050d, 0x88fd9426d1b651bd, 0x0599c6a86715bfec, 0x3d4b6d43fbb02c05, 0x74ee59d9b1be754c, 0xbfbf25895707f988, 0x2bd18b1d5ecb7fae, 0xe542eb9638a50fa4, 0x2a8006483f494c11
+, 0x4e5d01baff0a9e8e, 0x5a04495e4a72d16a, 0x94ed065e196d5889, 0x2e1261f78b10f986, 0x5301fdb965f6da24, 0x0f4484085175a6c8, 0x61004952677bcf12, 0x34eb628b9a76816c, 0x9a89803953aee615, 0x687aba4431a72beb, 0xa479c06ce475e624, 0x28c25feca8099006
+, 0xb6eaa34d42bc1090, 0x2e764c3a62f315f9, 0x813ebef6f8a8555b, 0x2f93578495496c01, 0x727532815cbec7a2, 0x05b76edc3f31f0cc, 0xab28d02b0f862e00, 0x787094734040f356, 0x149bc5b3817c543c, 0x7bb5be9c9698e7b9, 0x7fa0ffd6c654f99a, 0x524d2ca2305ef7bf
+, 0xfdd05c074977b492, 0x6e58c1afae306275, 0xe1f603345a42d709, 0x17bbee7ac617bf1b, 0x1baaa45eb0667689, 0x23cfd2c35b3be218, 0x4901e8cc68ce5212, 0x7692af84e0393773, 0x6150f38b12f55584, 0x066045184babf99c, 0x7540b4029a535766, 0x1035ebcf3e1467ac
+, 0x541721a7bb8293e9, 0x3c74a2eb7c6d8805, 0x0cedae9a8011162e, 0x74b2da9fd19d89a3, 0xe95cb32aa934eacc, 0x2e2b56061a2007d6, 0xdfe9b328d9638125, 0x0e0f9ad07b58ba82, 0xda7893d8b7a5d584, 0x3285119355f82f89, 0x0bca555c0d46f5c9, 0x16df2c759775d070
+, 0x17509e7d71cbec58, 0x7ad97076ad38f1cf, 0x21bfc6c18325b400, 0x665962ebbca00930, 0xbcc4727cafb2f6b1, 0x0bde2b7e0df17949, 0x12cd16e04f71d8ea, 0x62b1223f8ed390b5, 0x1810f9e99fdf014c, 0x05167085970297ea, 0x8095003b4af40234, 0x738afb6ff5a9ddb7
+, 0x71d66d853c486120, 0x3fed306a449a343c, 0x063d6613c489c664, 0x020f6fdc639d0318, 0xa19b0e56040403c1, 0x6c9da040d2341a6c, 0x89d253f03d6133e8, 0x36d5155b59fd297d, 0x196784d9a1bcce6e, 0x70c9bdf563591083, 0x1f34fceef993f015, 0x2a10ebd14a35ce24
+, 0xa9fa3110f4a9c61b, 0x4f6b07d351f84e8d, 0x34be2be08b176c3e, 0x260eddc4dd71c0be, 0x35daa67e35b124d8, 0x54a80b8e80be4d33, 0xe6bdd9b18281ebbd, 0x0d3865f4373d20ed, 0x3bc9d87e6bbc7c40, 0x08f006f7d2535d3d, 0x0544438017e7d973, 0x202137c8d156add3
+, 0x733da1dfd68a5df5, 0x1ae3a3b2907da3ba, 0x15b11446f9a8e1bd, 0x3b93946aacca220d, 0x5950ae40f87e9b1b, 0x5cdb9727b1247ca0, 0x9b74f0cf6a2b3a79, 0x6638f363479f1d44, 0x5ec042e8b930758b, 0x7f539b8f859f3a6c, 0xdcf057af41b6b739, 0x07edb7ff9b34ab35
+, 0x22c63d6e90a6b7c9, 0x74f2d5899317fdb2, 0x3737efafbef1b97e, 0x34c3efb8cd2f770d, 0x2f5f34bee0ef3f5e, 0x49458592ba915a3e, 0x0da5a1f309639232, 0x44d91d90e2fa14fb, 0xff3636d4402474f6, 0x666bb1d1eacd33a4, 0x6498333fbc806fff, 0x1095db850633c279
+, 0x8841d88ac74ff93a, 0x4dfed04471694dd2, 0x15cb8dc124b3c307, 0x0ac240063f41750c, 0xafe3de215c37dc53, 0x061ade83e952b003, 0x53450eaaf68363eb, 0x7f76d3fab36865f6, 0x4f9cfd858ae0f0d9, 0x743d289e1746eada, 0xa8a58eb2c18526f3, 0x52baa5da41655336
+, 0xa3faf95d259ff5ba, 0x080ecaae5b261a13, 0x2e237a0c83ec66fc, 0x0a481ed8db6901e6, 0x21289aab84a0fd7b, 0x1596ecc72aae8f77, 0x8be5c4900fa63692, 0x028745680fbc1c1c, 0xd9efb1e1cfb1d458, 0x1f6dd9d2ec0228b9, 0xaa28ae812d610770, 0x5549533615c2ec2b
+, 0xd912f455dc4647ba, 0x67fb2b5c3ee10e86, 0x4ee4820bd6485367, 0x22beade533d37612, 0x32eadef79b0d525b, 0x4fd565e4cee3120b, 0x91ae18f6806c2f6e, 0x188191a8700ed64c, 0x880ad31519247de3, 0x1cba5db79d6730b7, 0x77efb013e600f71c, 0x28f2e3c2612777c4
+, 0xc25376a68509fd72, 0x783252dd0369ac31, 0xa259c80bf942abe0, 0x4cd17d0006a9170d, 0xea6b6bb7de4e2fbd, 0x0503e4e107d2d0de, 0xd00fcf8163884faf, 0x434999d1d31968b4, 0xeab8201cd2b2f0aa, 0x67b19300212a1958, 0xe61df32d91c4bdf0, 0x3eb0ea7726b3edb3
+, 0x1bc2f8de679390ca, 0x5d7ed496e3ba5e14, 0xf9d4220ab045b5b3, 0x571f0e947cd80fca, 0xdf83a78e24a4a2dc, 0x5b7bcf61123a06d9, 0x1df2aeb8014f17c6, 0x4a0bca0e7f6f2bad, 0x6c8e7b4b0405f871, 0x1e3c4923fdcb7bec, 0x82831f96d065d337, 0x41dbc49810d265b5
+, 0xbe973259c5523526, 0x4d71501cdb5c19a5, 0xa9b36ef0235d2fdb, 0x6bfcc3050be3bde0, 0xe5d92a0796c5e97a, 0x0e4f045c97e5f5fd, 0x553a141b36b044ae, 0x3c0588aa74fba1b4, 0xe6d8f921012676ee, 0x4670c00f13238fde, 0x7d709b560ad4b089, 0x5b5e2a080fe5a40a
+, 0x062e9b1ec5eee736, 0x4b1d8d8bf1fe0833, 0x5fac2d5f53ebb127, 0x6ba7443a809e6ca1, 0xb047a5031cb817e6, 0x4564e733e8064702, 0x928afd807a2ca634, 0x4424539e3330fdf8, 0x2eaa670190f5340f, 0x23a294cd0b65abff, 0x3590addf4684cdf8, 0x47ed8d77a98dccad
+, 0x451d7516c83a4556, 0x50067db42f7e4009, 0x6720913fa7f71afc, 0x1ff48364e87b4a4d, 0xfc5712658e0cd1ee, 0x1d89425ff0210ca4, 0x7a574f2a44236b47, 0x0efe80b9144c6725, 0xf08b99ccd2494c3a, 0x452bbf6a63303ac3, 0xed5fb9fe41cf01d4, 0x4a7ccc8ed9265d7e
+, 0xe10cbe6a967243c0, 0x57f424e2911a0b4f, 0x5c592eb81f1bee25, 0x6e4111b08d24cb44, 0x70b8fa17911e380e, 0x781f3211eab92a6e, 0x688db0d16e2b1e94, 0x042d8b2fdf3ddfa6, 0xa04776ca063ac5a6, 0x4c34218742b29074, 0xb313e2748751f9ab, 0x78d12d33d37de153
+, 0x1e17bad0235845bd, 0x1f2645cb01ac255d, 0x580560e8841081f8, 0x2ba1e6bf35c145c1, 0x8b02e567a7f0e953, 0x56f3d12ec3f2ad4f, 0xdcfd8d9ef517c44a, 0x47cad5484f304da1, 0x2e34ce110ce0028c, 0x6436c2c5b4c16d1c, 0x088d0fd9ee129f29, 0x49670db1ee38c885
+, 0xb6de9575a5f2b6d5, 0x7d97a73a5f10818f, 0x55776c0623ee60f4, 0x2ce167113aade77a, 0x7cd40df9107680e2, 0x59fb00cab921d0da, 0xf0102fa99d18c318, 0x5d295fd030f800d8, 0xb8df72e6d659cb98, 0x29504afb45a3956f, 0xaebf6d5a5f5f631d, 0x4f3365e68b976bf6
+, 0xa00563b9e4c26bb3, 0x11b13d8911c63ad5, 0x07fb43b408e1f1ab, 0x381edbfad6a0c674, 0x6380759461dd125d, 0x1de97a436c8fb516, 0xadd7241d631e02db, 0x65468af0933a5b8c, 0xa5697ad81759bc16, 0x6cceb6967f0f47ca, 0x22d047422599d9f8, 0x14421bd366504d87
+, 0xaf449f2927efa7ff, 0x4a131f05996298c6, 0xb159b6a257a7df36, 0x5361a244c03dee65, 0xcdd6aee93cac7f34, 0x1b08e1c3f8541905, 0x448310a001c32cd2, 0x4cf7bac9214ad9f4, 0x2ce181f56087bfdb, 0x72ba9964f9bba0a2, 0xd848cb4d840419b4, 0x4278daae4be91480
+, 0xc002a7d6304bef55, 0x156c6adeb72d622a, 0x9cf99b9f8e7584fe, 0x39e9f7c980695139, 0xd9888766851f5029, 0x2c0dc6e78da34fbd, 0xc0bbd5104f21dc0f, 0x762ca074f9c79b4c, 0x734ea084b0e5cb34, 0x7d6af5d47c53f3d6, 0x58643e36f32e7a14, 0x27eb7be0f4dacac5
+, 0xa952830810df7e24, 0x5548703bd115a243, 0x281f1e2efbb8cdf4, 0x266482c9293a8d39, 0xaf7cfb9c9e652182, 0x614d00be367ce40b, 0x5ef587581d4b4223, 0x7826027c4027ada4, 0x01afb40cce21b84b, 0x55b22b199046cb8c, 0x3f082a1415166b2f, 0x26c11e9056bf4e76
+, 0xb0f7574bdfca41c7, 0x22e3b80e41dbc096, 0x7ec928fd15a33f26, 0x16d39f10fe16c7b8, 0xb4db1bc337a4c7be, 0x1d43c0f66e725df5, 0x668f079b0cafaf4c, 0x74e2ba078cfc0643, 0x80f5a90014811a5c, 0x54a58afb52ba257c, 0x9919dadb79bdc091, 0x64943cb9a3734f65
+, 0x6d73ed0d36a7c8da, 0x4e0e57650d378d06, 0xde87a94a6d9b4297, 0x2341088d40687d79, 0xf80b7cae58591eb3, 0x67e44e93c1712bee, 0x28d0a0d363e0b41e, 0x33894109c5f91031, 0x9949034cd3705eb9, 0x31d0b632232dd40c, 0x23853a0915dfe844, 0x669ea3281d2777e8
+, 0xdb9f3aa27c785283, 0x203cef46465b3b91, 0xec747310d73e92d9, 0x24049c8417aaf6e4, 0x760351e48eb51d9f, 0x480183741ec1c2b7, 0x1fb874682bb57337, 0x7a2d2d10b673b8f9, 0x4beb4b3c843357a3, 0x6893a90616d073ac, 0x719b6602eef07b21, 0x6e713d4e60e8ca05
+, 0xa8f2e45bc4d23917, 0x3c67e4ec4a49d23a, 0x5856cc02d66eb212, 0x5bad2d3dafcb230b, 0xb8d95f5940464f92, 0x29b0b9bd84d2823c, 0x4e2c40c8227cc34d, 0x6075c0c210d1ea13, 0x8190533c423ded32, 0x5366a80604faca02, 0xe9490e0733f3d966, 0x1b3c4bc95e4481ed
+, 0x2859b498260867c0, 0x0a6b55300350adb5, 0x7d69b9d6686ddc49, 0x410a46947a85a4e4, 0xfefd915c2c89c1ad, 0x4db0e2087add0a07, 0x6f5ab2d73f92fe74, 0x4c1e32c244153b67, 0x92a5e9247bc33167, 0x249873cc10bedf04, 0x6d33758b451f1e8b, 0x156a4e63984965fa
+, 0x59f0a032f1733879, 0x4f7a30f39fbe1bea, 0xd2817dba57dcdf4f, 0x10a21f5b52044bd8, 0x86bbb60abaefc800, 0x10e898a4c1e9a126, 0x8d4d5a69840538cc, 0x58dc1a62e12376af, 0xf3f0fb818e0f481e, 0x739f60d5c1203c69, 0x4ea90ea25cfa093f, 0x4c9a032d6ed7b28d
+, 0x03e05f048195ccf1, 0x7860020eaa003709, 0xc31c7f280235ac91, 0x5686eb6702084352, 0x45ede44b5f603d7e, 0x5bb4ff4958ca7e5e, 0xa7b920598adfee7c, 0x0c77a5e091ec8696, 0xdb31f38877b500ac, 0x0207afa48c23bb3b, 0xbe209178bbdc78f7, 0x2ba5bd2490fac832
+, 0xe31bc556ba83218d, 0x2d4b19b0c7c9bc65, 0xf6deca8263268a30, 0x429ea994e0bf2203, 0xbbc930ba68a18875, 0x132994cb905bc01a, 0xf661e5da025e38d3, 0x2939f3b8dc07465f, 0xbc715132152728b3, 0x0e0fd855e26ab070, 0x92918ecf7ff79f57, 0x6ac249b6e9795312
+, 0xb46d1d2e21d1e17e, 0x5b5f5b8f079e0a4f, 0x0ef661c5e8b61445, 0x3b7bfe92bf61086c, 0xb5f7f55e7b0cd71e, 0x6af8f35e38736cf3, 0x539066614221b442, 0x5a372b0f38d8f23f, 0xa420ed576805862d, 0x7e82fe97381d0b9d, 0x69f9ff35cf6e9ef3, 0x061087fe464dfecf
+, 0xe3440e3b6303d2fa, 0x110b487d2873c6cd, 0x5c70b55d228eb579, 0x5b1f10bfd7b15cfc, 0x6c2398ccacd56f00, 0x3c9c8ad9c39ae69a, 0x7f28037e6a617789, 0x55b51dfdc7a8fcfb, 0x7f2a2e2a2f5e793d, 0x01f4c685ab17c01e, 0x8fae39ee48dae2b2, 0x5ad2da905fdb7b39
+, 0x72b4acfe01ce02ff, 0x53f729ef73e9cb80, 0xb744b3c7488addba, 0x45aa39a0f6239fb0, 0xd6fe3d8b883a0a23, 0x62a99bd8b9c5925e, 0x3adf154031c54205, 0x3733a2c11acb4e00, 0xf62a0d727b8de012, 0x253ff8f49eb21f6d, 0xaa0af35fa4941558, 0x164943933ab1beb2
+, 0x5030c45c48c16dcc, 0x351f9b104ce80190, 0x4e4b5fca04d06ece, 0x2da6a062798cb012, 0x37662740959ed09d, 0x7afdc7d3ff00685f, 0x99d5ca68f5b06f2c, 0x1f30c2014dcccc0c, 0x95d7ee12923c2cfe, 0x355cba56837f9a82, 0xdbea63ca4294c1c1, 0x1b64b2b320b51216
+, 0x3c72efe6a4c8ef61, 0x35d16ca52a846f4b, 0x317f8e9e207f63d4, 0x4f091590e1bbf6e5, 0x46d6e660b024ea56, 0x429fb40b294a3851, 0x7cd312a31149936b, 0x5f71f5d9989a0951, 0x8147c2f077fbfe8d, 0x7d229d82bc36ce66, 0xdc656911e0802315, 0x4042007f4bf78a06
+, 0x0cf37e682eb5ebb7, 0x30642b3b63dd89f3, 0xdf2cdac15e5bfaf9, 0x4d3ea77e5796a27c, 0xe360c8ec3caa20f4, 0x0dcd35b8138dc987, 0x780d8398b8b3f9b5, 0x1cb7863597c40268, 0xdac3e4b0be8ee883, 0x7bfee610f7bab5a0, 0x42952243c86f55a3, 0x224b87487ac4932a
+, 0xa7d2cd3e7c66fd77, 0x4449defd787025ce, 0x788bb472af588697, 0x5444c937260f574b, 0xa6b826242284ed3d, 0x42afcc19fd3feeed, 0xf7a3364f2fa7fd23, 0x5619883899fb6b38, 0xa4151e82d9d71d8a, 0x631ef491d8a9cc45, 0x698181453573d6b4, 0x33338c70e119fe4a
+, 0x6807f3f865d65ad9, 0x3d46b38322fd2bf6, 0x4eb1fac43dae94b2, 0x61d15e651bf586c2, 0x9425557912d9194f, 0x236c78d2d200f5f6, 0x82645a0b6ed45aab, 0x13848f34d2c9a807, 0x9802903738964d7e, 0x5437d006b470d057, 0x472650f98c0f866c, 0x14f0c688f0897d59
+, 0x60e20f5eafd1270a, 0x290d76ed714cd582, 0x42dfd126e4443bd7, 0x372d678a251487bf, 0x288e5f5d73c7f6c3, 0x483986afe1801a75, 0xe07e730870744d1c, 0x4a6430af4a71b7ca, 0x31aa67c1cd756fcc, 0x4cc714374360430e, 0xb2f705c20023b174, 0x5bef4f70a32272ec
+, 0x70232fe36f712b11, 0x2746a07433cd8167, 0x963a4fea8786fdd1, 0x0d09ac1ad19bd408, 0xd5910978a3ca2053, 0x7c030a1d886394b9, 0xccaabc1db6275c63, 0x442a5de3ba2f843f, 0x18bc43ada8ddbce6, 0x4ee4ceef2055b43a, 0x9ea0415f2ebe6e6a, 0x457c3f2535f2c6f4
+, 0x725073c780204dba, 0x1b093cfeae371c6d, 0xa3f162342a7e335f, 0x6749a9f12e61d5d1, 0x881f4c4c59194ea5, 0x60f3c7b31fe6529b, 0xec538c0e959172dc, 0x2008862f6aa99c5c, 0x2c20f6f0cbe7a14e, 0x3fe0a05e722b01c3, 0xf80925f8f7eb7c46, 0x65602b5f9708e183
+, 0x5ada33cf20ed80fb, 0x2042e91b354c4e79, 0xcae64fb37e3432f8, 0x26183000f92291f0, 0x1bf645c67544f01b, 0x7640bd74aee74216, 0x4b19d3a8e5a80291, 0x0fc1d492b3870788, 0x52ae2db37c1b9bb6, 0x3ed997fc376c977b, 0xa0f7c34364759990, 0x32a1902e517081dd
+, 0x51ad5307ef459151, 0x4dace2148454e139, 0xb9ddf584c89d9898, 0x6e73d5291ba8f060, 0xc22dbede53301422, 0x31277b0e9601ed7e, 0xa7d504a744788b58, 0x1d714f26e1a67324, 0x50094064475ad308, 0x59ecefc204f2e1de, 0x29500ec682051607, 0x69f463db5b22a16b
+, 0x0f15a1a050b92252, 0x1b4fc194e4977ec3, 0x2e9b42bdf1c70bc8, 0x513c2930473a86ab, 0x69c9c93cb67d54b5, 0x3aaaf6b601391399, 0x2680fe27545cdab7, 0x396684b916835d9b, 0xc1f43e24ae691311, 0x5ca747d2a6341285, 0x1fbc5997909de9b3, 0x764bf3dbad20eda2
+, 0xd9651e95e455b755, 0x7d3ae998f03eb4c3, 0xf0ba0ec413802d9d, 0x4fc599d9e80b90f6, 0x4751b2339b86b6a5, 0x6d40d082b7bfe0c7, 0xe0bb769570a6ec7a, 0x4fea8fe07048a1a0, 0xd00d8d00405d650e, 0x32aa98ba60e955c9, 0xde6cf53360322b04, 0x02b6f7a8b8af70f2
+, 0xaf85009faa68749e, 0x4c0bdb160583c1ae, 0x67c97bd27dacd71d, 0x7d9fdf9315319c8c, 0x5b98bcb3104837dc, 0x5cf9c0a704b1fa3e, 0xf599729e6840a9a0, 0x2f5673f3e416735a, 0xd62026fc9c818f67, 0x7a46bb0dad58e2b0, 0x2f711868d30f7817, 0x384e0d6e7ba8ae77
+, 0x52938dce4725eb7b, 0x05f775fe83627f8a, 0x37b27ef214539b13, 0x5e95e4866b16f375, 0x6ebf99e4765eec92, 0x6713d299c8b32e56, 0x9080f2b62768fb0c, 0x3b62bc2291748615, 0x7e6a9aec82c0ee53, 0x05143822d7340b8d, 0x9e4505d98ae90107, 0x72ce52e159a79a23
+, 0x16d91288d6c5f3a6, 0x2e6c25f563d36528, 0xa50cb57343d102e3, 0x5605179bc0905aa8, 0x956b0aa7e1f01600, 0x327a3cb5f40ec923, 0x8b520cc46fde6f75, 0x7808b1e5192bafcf, 0x34a6ff4d909aed14, 0x4a3c39371fc7080a, 0x704fbc194fecc13b, 0x41a161668ee573be
+, 0x0c84aff28e06a21e, 0x0fa6c650980474e2, 0xbc57f2958cbb3a11, 0x3f7bd18df38df75e, 0x539907e6816a42e1, 0x441cacf0e7c1acce, 0x6990df67974495ed, 0x62a460956cfa63fa, 0xa4288fb9eac88859, 0x2c53f5644db268fd, 0xe7f7266844e18520, 0x225c9518883ed014
+, 0xc8bd539a25abd64c, 0x310ec8a6502b1d58, 0xc9ee388748fe8575, 0x30516fdbb0610141, 0x4701e9c89a7f69f2, 0x4ebada2925e6577c, 0x1f66d4f1cbd296f4, 0x2dfce7dce3a688dc, 0x61ff1fb2c04e591a, 0x03ecf2d27a1a4b45, 0x03ead31116f27f6a, 0x172d137e05c3715b
+, 0x4ab1858e56cb3f4b, 0x4eadc359b5ba3119, 0x3af5d84dc7c46717, 0x1b2e3cd8362c3885, 0x4f764b8383ad4cca, 0x583f4df4b03adf63, 0x35c4dee0c2abcf89, 0x73132aa7067c112f, 0x9ce5c422c4f060ab, 0x170d0aafd2d9c11f, 0x80cad366e82e9be9, 0x1b43561b2d572ad6
+, 0xea29e0efc157ef4b, 0x6d368423bcd7a732, 0xa98d4b3eab002e4b, 0x75dc260309e858c5, 0xb44945035c2ee5ca, 0x4550bdd3adb8dbf5, 0xcf2d35ce1dcb93a4, 0x101eb4549278f746, 0xb29d4c4ebb7026eb, 0x1cabb8a710d474a5, 0x4dd56b40b27c0216, 0x35baa86b2b8690c4
+, 0x71fdd4089f74f537, 0x2d6fbd8fb405913d, 0x65bee531be2ff9e9, 0x45201a3c9a594872, 0x2fce33ce0ced3661, 0x33f184ed9288e456, 0x95796bcf8d4d6f80, 0x233b4d0f2e9b3475, 0x8ffbbe8c882a71cc, 0x05008c031364733d, 0x68f4acc5da35cc3e, 0x74385845a462fa13
+, 0xf053550401bbbd57, 0x56b3e3449d612fdc, 0x4794c0916ca63302, 0x4d6c85ea5b4f54b1, 0xc7a477622ae65357, 0x0431beb694446a6c, 0x6a3c8e7215b449bb, 0x5c827b7d5b78e911, 0xb03c0b0a61d34b42, 0x4865b49358d334cd, 0xa9b7bdeb3152759b, 0x6e9687a4918aac0a
+, 0x12f0704ba152789e, 0x3403a12744ab7ef8, 0x1b596b80860ed59b, 0x0af3a630938d9a79, 0x2c9a31e48a69674c, 0x4817911159bccc22, 0x7fe49a754ab573e0, 0x7af4b06b753438f8, 0x243f810068c5b93d, 0x61d125f10a62d66a, 0x0afab1094f8bb600, 0x7c9ee15826e2300b
+, 0x0c58d3f9df569a0c, 0x78e9abaa508ca3d4, 0xabb68c67bb8e20de, 0x58e6549eb0c311ae, 0x3662f9b258095e07, 0x5eeef1b83f209449, 0xc0da98d0dd3ce994, 0x4f5a85e8327fa65b, 0x5b9a2899bb65ddae, 0x0c25189b5f805634, 0x510c4d26cd31dc6d, 0x20c30af4dae73e2d
+, 0x80d0e4646b426660, 0x77ab21d54bc12de1, 0x1132694f3679f328, 0x50405aef3efb7812, 0x25196c556483a60f, 0x6357914f55f27894, 0xe7d87dee1bd31262, 0x4a0c7a70452cb57d, 0xed2ed74f6cdc8d8a, 0x1a194e2be58a0719, 0x844e9ceb055e6e78, 0x1489afe4b4c7c2fa
+, 0x440193268741127c, 0x613434f05b539f02, 0x41277ae10e26e295, 0x7a02f4b213257607, 0x0c701a289c71cf52, 0x5e69645e8691d262, 0xc44698aa6fcffd76, 0x400d4d990a8b4cff, 0xd8a03c642ec0606b, 0x58c12e6e73b21ebf, 0x844b6f154befc19f, 0x4c509f9db76bad85
+, 0x69478fe46c77872a, 0x38c432b7c1feafd3, 0x1e3172ec77425bae, 0x6bbee0051e187623, 0x5b4c8a6fcaab17cc, 0x66ce5d30a45e2df9, 0x92100675cd6a385b, 0x7ee5d9ba554ba29b, 0x520a81df41060747, 0x289f722a10fb0d30, 0x9708466b9e5c88ad, 0x6927d3da8b98fb99
+, 0xa2e78ab5d57643ea, 0x1a72222bbc57fec2, 0x84edf0b648a7c5bf, 0x7c3623bc92186933, 0xc622e73927f0eca3, 0x2fb69080a22fffe0, 0x28ec5ca59a0c1669, 0x26b231c08b047311, 0xa94b3a3969626f6b, 0x1a802d860dd8e080, 0x28f5596c48bfc582, 0x74026e9fcd40e505
+, 0x147fcf9ea8706776, 0x56becdc1ff95d248, 0x9d9f9771374682e3, 0x50bbd576970d8d6b, 0x41984eaf588e7753, 0x6d79bc9391ae0612, 0xded7a63180f2d8f1, 0x63800874ac4dae40, 0x02aec6b6497e7e0e, 0x00da457769f6dcdb, 0xd7a28e6aed4d370e, 0x046c9d65653a3f44
+, 0xe7e395eb3eb02f9c, 0x5e2ac76270f59cac, 0x38ab913d5707b9fd, 0x3f313268c8669ac7, 0xd180f2bbd366fc55, 0x32e9898043ebcf34, 0x5cfe724937c64241, 0x73b48e2c1f695f14, 0x06d376152ba4f291, 0x0ec71fe38d1b8f77, 0x3838e5d0601e7526, 0x1f882a524d33883e
+, 0x3a903cfd1f13a207, 0x6130bf3db47866a4, 0x2ffb5458ffd1f96e, 0x22621a1c11638aa0, 0x2116f3fdf9ec7007, 0x33bb53ed5aede829, 0xe45d249940d9b9f0, 0x586a197111067b6e, 0xea72837a6dd91b7b, 0x55763ae2b093be1d, 0x5acf5d82bbcfb678, 0x17d9a4c786c7d6cd
+, 0xaff55ef853ae83c1, 0x2db33369d221b771, 0xe45574050fa384e5, 0x0863ac2b070e4b11, 0xe8819a9b764df7cb, 0x1023a9f127095b1b, 0xfb3af5b3ca0bf0b2, 0x55ec9024296fa5bb, 0x89884c432c942a3f, 0x1e2e5f0c617cb56e, 0xf6ab5ab8f602cc7b, 0x5c685a3dd1210e42
+, 0x92c9ad9adcae9401, 0x158f3e1c6954426b, 0xa9924059fe109127, 0x4f5a0ba15e5353c8, 0x6775036f79ea7f2c, 0x231be6d72cc52bdd, 0xe199f07b843446bf, 0x7b0dcb2acaa26b31, 0x64a5995af5d6fdb8, 0x6bb36ae428a2a867, 0x57eaa4b90c67343f, 0x65a948ee48397915
+, 0xdeaeb771e1564073, 0x6353b9688da86336, 0x408b54fb7113216d, 0x65d39969c288b108, 0xb4f1a1f16bd6bd73, 0x0eb4f02467cbcb92, 0xf9e8b0545caa8e40, 0x4d316608105e470a, 0x30fd8f2ed2cf1d92, 0x3e25733c9823c683, 0x27ff070d5347eb42, 0x2690aa75ac10ec30
+, 0x315e0ada63b5cc5d, 0x0a7992a83fef69b3, 0x1bab19bf1517dafa, 0x06b8003eea9f2917, 0x81c3ff437ccd5837, 0x7eac93f9a9f4ee22, 0xa8975584dd97cb12, 0x4ee9f621f9503619, 0x6cd513cbc259c7a8, 0x7e1bc85d70f59652, 0x647c56e3436f142b, 0x361c47a466ae7982
+, 0xd94a334327ddfd23, 0x3c5a35104befc760, 0x7c19dbd804562ef5, 0x39370d0f898a9dd7, 0x370cf108ffe8f1cf, 0x7782044e13702014, 0x41b3104400186a81, 0x30ede29f48f20062, 0x369d17bc93a4e094, 0x21939dac16cc9d43, 0xad9be1fa136693bd, 0x04af4588b6788b4a
+, 0x9e3165d34c692d69, 0x5f5bad0c6916de11, 0x849dc21369702716, 0x486531213434939d, 0xfcad2cd1cb01e2f5, 0x3d1140805e61227c, 0x02018514a89b29aa, 0x7c67dc46cd12840f, 0x2e664b523f512081, 0x03955e27681ff807, 0x9820ad3cd1be6b58, 0x1f7803ead43ce319
+, 0x876bf5b3ba1473e3, 0x267b3c804e639a2c, 0x9bf05ed2e4df7243, 0x2a33eff08556cddc, 0x1ce9fb8dab7b9521, 0x4397248df8b42d25, 0xb508fb40ff27f700, 0x0be7ccea3d4bf218, 0x4612eb24a6ea8d1f, 0x26faa330aed1d912, 0x246371431f3a4960, 0x64c23ad60a760726
+, 0x43b347af1be92af3, 0x7b68de7dc7385f6e, 0x354cb2bad7991dd3, 0x428c344ec4acf6b1, 0x2d4c44ecdfa2fe1b, 0x274d5d6c27233cde, 0x9d0fe92defff27c8, 0x4ce6531654864d5d, 0xf6a34976180433b4, 0x024b3a719e2401ce, 0x760557dafea3c27a, 0x7509e6cd16bcbe6a
+, 0x70996682f50c6299, 0x05ccb719d97219cd, 0xb92d558888fedfeb, 0x183f7f0c252b76fa, 0x2b3567c0cddd562b, 0x10c99bc57cbee16f, 0x82753a95c3c0aab3, 0x259c7ad8efe2bb07, 0xccf2dfd05037731d, 0x18c28a1e0c587e6b, 0x68078f0d77f29f8c, 0x311daba3e5f7de07
+, 0x1b27f954151516c7, 0x0fc213166e384c69, 0xe3127d01c5bd2c80, 0x53c9d354ef713b6c, 0x3480ef755898281e, 0x03bc01ebcfe3aac5, 0xcf27263af095d835, 0x2b4c88ae63192097, 0xbd87c40fc3553fd2, 0x0cf8090a15c2a198, 0xef26c2e1fa07b530, 0x5ec5772bc8e747f7
+, 0x9a9f61cf593092da, 0x2604dea1e0cf0d43, 0x555fec1958da0e81, 0x328556031d3b31c0, 0xa6d9dd1fcfe26064, 0x2f7d3b2551c60fc1, 0x08ab2fc1eab4619c, 0x24af87b19904336c, 0x5dd76600f8adbc8c, 0x689825cd3818886f, 0xdbd74fe558031904, 0x1fbc5437ff6d8964
+, 0x29aae16fcbaf4c54, 0x655b8188649c9d11, 0x478c6fb5af192728, 0x4c87264821e3c4eb, 0xdc3bc24f4eee06bc, 0x26891c77010090ed, 0xd4f77547fb8e713e, 0x467a488ac4c9af54, 0x25fe1d1305543f39, 0x594e199dd2be34d5, 0xcb98ef0ad91ecf3a, 0x1594a1b0752e0f5b
+, 0xeac410c879beba6f, 0x6e4a97d938f6b12c, 0x94910082e3d9db8e, 0x45aa341276fadbe0, 0x959ec744f820aca7, 0x324b54d8e13eeaf6, 0xc44874c75cc1e882, 0x18eb04f3439d46b0, 0xc07bcb30add05cd6, 0x23046f9ac4d3918b, 0xbcc0f53dcb3bcb46, 0x37f784309776d1b6
+, 0x47339aca218d0cd8, 0x13d6857d622a50b3, 0x75207b9f6da509f3, 0x3f124ae5f8a8ffe9, 0x86f261ce3ebe137d, 0x6ecffb6d8c6bf2b8, 0xe3e6ead928265dec, 0x56bafc3bcecfbfc4, 0xa317cdb3f864dba3, 0x17da43982c35ac90, 0x69dc945a208eb549, 0x142a29efc4d1cab9
+, 0x3b77ec2ad9ebf37b, 0x4b1e2fc202f3b2ec, 0x25de777664135a37, 0x694e9099a0f315fe, 0x5c260e5c8303642b, 0x5ec7f3104212e91c, 0xb706e17f5d79fc36, 0x295e0cd75c2ef803, 0x9831541d87c7da15, 0x6d65b8d3e24855d5, 0x51b75cecc6f41f8b, 0x0896d3f037b26b12
+, 0xd5ebccb85a565a16, 0x6170a530a87c64a7, 0x76adf193fbd49adf, 0x1c9f68e98e7fd543, 0x7307fc80c2c15b67, 0x3b2cbea7b93703f6, 0xc9836bc496a05e2f, 0x0aff76851b7cbdb9, 0xfe47c9ebf50cb5cf, 0x0d6a8d80af369836, 0x450ae40d49fccebe, 0x7895b615fd647f10
+, 0x4762af7a0b6ac45b, 0x3ba9da76d129beb7, 0xd783d768842108c5, 0x3e80364aeb57f968, 0xd8382919cc1024b8, 0x7df573b19c4857fb, 0xf6153974d5edd2c1, 0x03f62a91170ea84a, 0x1d56b9d13bf32e8a, 0x48949526b1c2a2be, 0x2090890563d0586d, 0x3d8a2817d7ac31ff
+, 0x6f9222cac520ab79, 0x6faac71dd5994333, 0xc2e09639ff851ca9, 0x36ce567797268fbd, 0x830fbf8c0a0b3de4, 0x0ed7034fe4e326a5, 0x55b77b981c290662, 0x75c32313208100ac, 0xe587eee948e37b68, 0x185ca93d483ae64f, 0x80dd180357955c67, 0x6857393eeb850ab7
+, 0x567f6acec297bd1f, 0x1184385d6bdb5a4e, 0x84128c2135ba23a5, 0x438ca52c51100f58, 0xa4b5cbb68144a803, 0x622ad79144185eff, 0x416a8d2b82aadc95, 0x6fb4f9ddbcd12293, 0xdc5d4cf4d9e54790, 0x5aae1eead80c3a51, 0x89247ac7fa3d64e0, 0x0b47bee905cbe0f3
+, 0x237ce38a114ccf78, 0x7579b2f64c614e2e, 0x7a322ec1b4851f38, 0x05a0b968fa08a581, 0x917616d6398945c0, 0x32c9d33337393157, 0x553939ab663528d9, 0x51405420fc3d5cdb, 0x3ff5557254d41359, 0x571faa6b818a31f9, 0x3bf97d8023608290, 0x1d86ff3cac6cd73f
+, 0xd5e941fc53d29e26, 0x46d33a21347a6c99, 0xc93cd17d017ec52a, 0x63149d97e1213c66, 0x275ae1e9f146a320, 0x1926592c5c3c7e5d, 0xd2e36c704cc9eb9a, 0x1919d778e61640ca, 0x7c88faa414cf645b, 0x53828338df2f8e0a, 0x657447abbb42b23c, 0x7e50749be8a5578c
+, 0x26639b92adf1e582, 0x5a490f5ebab85896, 0xbecb09aa1fce7db4, 0x51b0745d8e25b846, 0xe5ba80a7bd70210b, 0x21191b2f4c8b6430, 0x11692cbf4b756bd0, 0x311d9aa7798e10e9, 0x8aabeeadc06d71c6, 0x5218b99b31eb80bf, 0xc62c3bdf43988e02, 0x6fe422ce253ead4b
+, 0xb42a648a703a032a, 0x26b69eac983e13cc, 0x3033873e9c6f181c, 0x683e402ebfb921b8, 0x67b81808b52113ae, 0x2d8f362e4062b5e9, 0x6404110f99477d01, 0x2877ce1651ada64f, 0x76e860fb073d1e48, 0x059f6895cad10944, 0x5fa0ec05948138a5, 0x3269bf4e92ab0caf
+, 0x1045ff73589e225e, 0x67086552621326c2, 0x881a26a531618e55, 0x206a589281336134, 0x5ddb73c636ba619b, 0x3cc56c557c11334f, 0xfd4433fad47a78bf, 0x44ff239679815159, 0x8cb62f6b695e8c4e, 0x0eb93b418592cd9b, 0x5140c9ef46dd5f7e, 0x2d420f45b2c06e2c
+, 0xa61d04f26b2118a8, 0x53e9b0b10d9d8775, 0x68863cad2c332255, 0x79326b0298e003f8, 0xfeb1248b267d7beb, 0x5a81ef978d122082, 0x2cda97677634ea50, 0x15f05b25126a87b6, 0x7e4758195f4a4013, 0x593fc9974f0b08bc, 0x346963e5755573b6, 0x22727e2cbc647026
+, 0x47d2bc5b3e54069e, 0x7524c14e86bb4a3e, 0x654a7fdb188c6cd3, 0x0e3783a353640079, 0xb118255bf95a1871, 0x5968f099d01384dc, 0xb684915c4855a1bc, 0x01da83e4eb961321, 0x9e786228ca7d7847, 0x43ca67eefbe730ea, 0x39a2da8701aa2b5d, 0x46a36f982a1364e4
+, 0x71c58fd190b47db3, 0x3497a5ab97153ccc, 0x6afb9b6ac4cb9208, 0x20715559d8e34e46, 0x1d0e7a6fd7014fb8, 0x38baa0ba20f36961, 0x97182d494428956b, 0x3b9033707391e230, 0xee56685a72943ae2, 0x433ca8ada99b6a61, 0x4c02ed0879975aae, 0x4b7eb58749ff82b1
+, 0xdd074626d2fea8a4, 0x6cbc37ec4c0c8bb3, 0x0642cdd652d7f026, 0x2f95986fa0ddf901, 0xcdb1e6b7107715a4, 0x24102a954ed5348c, 0x28dee5a0f3a6bb51, 0x2c6f307638934140, 0xfe86227edd65780c, 0x50a5d278ed4f89d6, 0x925569eec2d7e851, 0x3b5b6164db0aa62a
+, 0x365a8ab93faf009c, 0x7b458fc5de637113, 0xc9dabc3f30bc1205, 0x5d52ed8751c446d6, 0x3b342fafc58bd570, 0x01ce2f26adbaa926, 0x87e29fab4a0b3062, 0x5dfdfe2335b2a4ee, 0xa1aead34ba3d9f7e, 0x1514a444d46731e2, 0xff67ee67672d0a01, 0x20bc91914e6f6416
+, 0x068f907b2e3d23c8, 0x080897a66704be02, 0x38a0b3a874fc50fb, 0x448346c098abdf78, 0x7841b52f992e6f1d, 0x5fc349d8c36b227a, 0x3d359ec4e87f51cb, 0x4668ac134f6f29a8, 0xae90498c884e4a9f, 0x09738225a615e209, 0xf1753d8033ce31d1, 0x267cafb7d6f140d5
+, 0xef0ece49d0962d7a, 0x1b0c1d862923003c, 0x816246b10af79cd8, 0x028d2ce8a41d2959, 0x513e8d80aea9005e, 0x745a0a54d1468b6c, 0xefefcfa4edb9e6a6, 0x7aec6ea78ebc3240, 0x29e6b4f57429f632, 0x747b6098ce921366, 0xdfdd1e7a1b7052ef, 0x61bb554204bb2a6b
+, 0x7767eec4ce21721e, 0x462765b241e94478, 0xbb4cb3ad29c9d950, 0x10ddc84cc5d42bd4, 0x3d7f490c5a1b5c14, 0x1202eb9d6c5d4352, 0x3291d01d11d3a8a1, 0x7c59c191df325644, 0xdb7f4676839f2493, 0x5eb30b54365e9f7d, 0xe648e9bfc4a327e0, 0x48531191a279b659
+, 0xa47378f2611a04b0, 0x7ad587aa79be1697, 0x2f9929b3e1bb3f58, 0x56cd4c42f6bd3ac3, 0xc7f6859484743c5d, 0x4420c03d5601a524, 0x467c36640cb62828, 0x79301a9cdad435bd, 0x4cd7876b555e54ed, 0x1d84f27f19922f74, 0xa2a188512d933e76, 0x40ec3fba001021e2
+, 0x01531584f1522c5e, 0x12a925a0affc831b, 0x9c131e094af60eb6, 0x0b5d084c916e04d6, 0xb0bca2e103aafcd4, 0x2c4a6c002926f4fd, 0xa86a1f08955d13b5, 0x7350b4e9aef4f627, 0x68d4e58e62aa657c, 0x3ca7d9ff2bd8aa64, 0xdf31f6847ff98093, 0x53e69fc55662c685
+, 0x3e02fdaf9f9e31c2, 0x3ebab8080009aa5f, 0x34cb1ffae7159c22, 0x067b41610d47350b, 0x4870869721660eaa, 0x1e98f7f9c0c76c7f, 0xe78e8fbe95b339dc, 0x4ecd64df7344ffa1, 0x7ded93b2254aba0e, 0x332e575769df2be6, 0x5cc2ebd860a20ef9, 0x03f48176d8cfc0ad
+, 0x78b8d4b06ca3dd24, 0x07580b11d436d8da, 0x6d5e22cebaa4e54f, 0x3d1b32788ac1321a, 0x8faa0fcdfdae56cc, 0x4d18e7f26889a535, 0x29d90635e3e7bd0d, 0x6798e08595c8ba2e, 0x77d3db1279aed914, 0x484c144897828d0f, 0xadc2b55191c93c70, 0x6baaffca9628e6b0
+, 0xd000ee2c7b625930, 0x2b6c74b1bc6d3d9e, 0xf6da9bbee6a8e86d, 0x5b0665a6f82b91b5, 0xc005c7f812f2e2ec, 0x54584f4a62aec77a, 0xda471cf2dd00cdea, 0x1a144ef6d9225b68, 0xfb80bb0585bf9d7d, 0x51f9182e44398cc0, 0xf6c4c9998576c9a0, 0x3818cf9dc990e8e0
+, 0xdfcbc873332b273c, 0x08b733c0bdf4e333, 0xdc26e48fd214af8d, 0x01e5f45a3dcd78b0, 0x86890f78e1b8279c, 0x77a2e3505cc960a7, 0xef40b2e935d79c8a, 0x24179e2e92775f14, 0x8c8903cf715d6c78, 0x093f3d839bf7312d, 0x163bbb843830a3af, 0x3b8193b1abb880e3
+, 0x8cac85d7cb59001e, 0x0e1e0859ccf9f6af, 0x823e92d75caf334a, 0x27283db53df22c4b, 0xb3f118e3ed074788, 0x7b97161241a6cb74, 0xfbbfd4b32f20e6a8, 0x0cec0e2c8297002a, 0x731d465e64bacf84, 0x2dfb2402ea6da5df, 0x8da002cf3e9464f0, 0x3987fd3fef417fbb
+, 0xb3f895c2d8c6b5d8, 0x685a48f30947733d, 0xec579a3193ddbf78, 0x55bd1eeb6bdd4cac, 0xec53a962577163e8, 0x5d6dafb72c57985c, 0xbbe5ceb87e0d5fb9, 0x369926b7828783e6, 0xcdc19074d8481788, 0x36b896bf752128e7, 0xd540c6cc21b13bc8, 0x6affdb51802e3354
+, 0x204c4af533a7f698, 0x03e8688daae328b1, 0xc731825c65f37ea7, 0x4d8575d4d4cf59e7, 0xde7afbb23ece7328, 0x761ada51ed0c7acb, 0xa5ee14a69fae0953, 0x4562e9103d117412, 0x66458aa061d05f7d, 0x7f79240b76352e53, 0xed0528e7a001a7c0, 0x06ee63a72fc396fe
+, 0xe39519c6214c0e87, 0x2c86ef1ead6d1931, 0x5f15f45c40b923ae, 0x40483240e87b37e8, 0xf688368c644a22d5, 0x2d7e2b5146341e56, 0x4dbba83dfa2e745d, 0x4a0bac4727e6e2c9, 0xc173953b85bf6ea1, 0x05306ed364644dc3, 0x9c5c95b8661a9031, 0x1ea070c8b879a686
+, 0xd6691261a271e225, 0x00ff783b72470fd1, 0x5380b8b52312f93c, 0x1cf93560d75d50aa, 0x33eabd2d2da660d0, 0x4103678b0545bf4b, 0xac415b517029e979, 0x5d63cb0090b083f5, 0x3e2f64f410dd66e4, 0x2e03d2503ff9d84d, 0x023e2ab9f34e79fc, 0x10bb3d77576d6403
+, 0x64d19a0e82400425, 0x065475524dd47975, 0x00f58e4a78563f5b, 0x14fe1fffa7678a86, 0xeed2a13e55912707, 0x62365aa133cc2f39, 0xf18c5c35a7b2b6eb, 0x68334f90223d667a, 0xbb2fb416dd5b81e4, 0x11fa2da4aa180ee6, 0x43480ced295d50b3, 0x2982ce887e6d3be2
+, 0x30145fec9d34fb5e, 0x0ea5cbcea80005b0, 0x9944313c18007db8, 0x408dd38fb3ecf8b1, 0x1185fc78648dc74a, 0x2925123f2026c552, 0x0e8ff258efd52f8e, 0x42a2ea268cb6debb, 0x85a603495a16b465, 0x7310b46981a80377, 0x7587fae5314195ee, 0x64f6e3d646f4de51
+, 0x021e59c437a956da, 0x1168546f4cc3d7f6, 0xc7bf222b9b311ab8, 0x18ade2b02061fbf3, 0xe913f0fe2a7cdcb0, 0x13242b5f883edfb9, 0x127330adaff8a8fb, 0x56dd363b2e281bd8, 0x0ded77dee986b36e, 0x74fc5975e0fc5012, 0xeab1e8b1b027b684, 0x5a690cce86cb4dd1
+, 0x7134b71bff72cd47, 0x04c69e65bcb4212c, 0xbddd6a94f8e4aa4e, 0x7169d632f7a95711, 0xa596d80912e8a769, 0x285292e3e60d501f, 0xf9f11a466b80bcb1, 0x4a970d47769e9b0e, 0xb0d1d5fad8a75a55, 0x2cef9f483c22c163, 0x64d8f14089ecbbae, 0x7bbffb0516d822e1
+, 0x0d52ab621e8a378e, 0x2b0acfa3d3403dd2, 0x120de2901c21e392, 0x4d6e5198127c5c3d, 0xda5fcf457e858dd4, 0x70a088c51c8e2168, 0x6e2b08fd11e6ca94, 0x319bf10560851017, 0x15be9e5b2ab467bf, 0x2b6c9a507deeaaa5, 0xf830363c76888032, 0x3afe4e13103ac28f
+, 0x575bde495f2a5123, 0x44b71cfbf757d14b, 0xb64dc68962c2b2c9, 0x7273910288e32198, 0x0dc969e308649b94, 0x1f24ab4082a9adea, 0x5af5a24dbfbdcf17, 0x1cccb03cb8b907cd, 0x5329442ed00f7265, 0x6cb210df86cc24ab, 0xc167758fd170dcf1, 0x15008017f094040f
+, 0x60995341791d5b2a, 0x622ffce4f444b06e, 0x7b231d40fd037e8a, 0x3ff24834df655726, 0x9d8af482ca190a08, 0x68b40e5b1f85be2e, 0xa23adb0d9afa51a1, 0x5350dd695260b3e9, 0x07facee641e94321, 0x0468afbcc0175316, 0xbaa6f1fabdfe9db1, 0x46f299125e6d5d55
+, 0x2b9f36fa7374aede, 0x35cd4661a891311b, 0xf0ea0ebe1505ab82, 0x6cee70651d8e4403, 0x7e2462d39313c88d, 0x72a20647165a43f3, 0x3b52d1b91c81169f, 0x43baaff405a84ff2, 0xc3dc28612b6a2fe6, 0x65c428d6af640e3c, 0x9f4c134742e3d86c, 0x051c79d2cd91bea5
+, 0x9dffdcef44eedd85, 0x7293bfabfaefb673, 0x9013cb38705bc73d, 0x2ac6975fa408329d, 0x517448c82ba2edb9, 0x50c4720ee388e37e, 0xd60fdb7df4b95cc1, 0x36ad3b1e0e70095a, 0x5d7495ab2b2aa966, 0x5248ed54e768ff09, 0xe8d2db2c56489e4d, 0x5329ef7598f15e38
+, 0x5a4f7c1c2438c28f, 0x2b4b3a3495bd5fa2, 0xad0597b79ca025f5, 0x2d42bbf5469af056, 0xa3243e760dd70fca, 0x3f6e147092aaea2e, 0xd2a407df23fbd2e9, 0x42a513688f1db5dc, 0x4947c6baf6b9342a, 0x6a61d87f7bec6a20, 0x21ba424d6d8ee7a8, 0x1078bf41725f713d
+, 0x9dd55a90768bc93e, 0x0bebabc819186b6a, 0xdfb3dc89b9d8e7e1, 0x2688f4692818f5cc, 0xb159b6c3995ba11d, 0x72b6d7db451c89dc, 0xed65450e5da7bb87, 0x0d1dad34c4c9aa01, 0xbc987cde9c4099d6, 0x7c2bff90b7699d88, 0x403120aa7eac0309, 0x7f0b2dea4cdca430
+, 0xa3d5328cd48bf955, 0x1e1f6c3240425903, 0xca1b450391895b1a, 0x0f8bb07c871d463d, 0xe45445b23d466aff, 0x09c6ee5f3834a28e, 0x9afda532b2dc8b66, 0x782a4da99f500455, 0xb350dfa7bcf17eca, 0x69d0cbdd54069156, 0x767f71acb958eb60, 0x740e7526c16ab4b0
+, 0x636e766750ec4853, 0x7a11f90477999ea0, 0x9d66f879205ffb4c, 0x469f1d6fa7a57843, 0xd352bca87f18a649, 0x782580dee3196bfb, 0x30c828f74c78aa24, 0x4ae24e60e52a134f, 0x9966d5e974d92fae, 0x58ed2361ddb2aaeb, 0x3cf649235e340277, 0x7da4d406901cf193
+, 0x9fd5e29aa0243418, 0x7a44cd663275717f, 0xc1e863ada3fa8bc4, 0x3aad3d66a698a719, 0x3fbbc00d05cb0ff7, 0x5b83d5b1aef24a0b, 0x705cd72d38818aa5, 0x3062c2cde72c4cc5, 0x140ecee81b3a65ce, 0x3e3aafb32e1a9b89, 0x27c3263c2b96919a, 0x218a0d4391a097fb
+, 0xe0bb74913831a914, 0x396ea0828690328d, 0x864668724b5fed87, 0x63056603f609be3c, 0x9e46211ea736b6ae, 0x1c13c573b3df9629, 0x338f37698b5e4051, 0x520ce3bf3596d0ae, 0xd65724c99feee258, 0x37aaefddec30698d, 0x92fed176d35b15e5, 0x436587f376b13ffb
+, 0xd8158c5b4f9eb418, 0x3e5e12e7e282d9fa, 0x83bfda97da0ece01, 0x5f7d5d5ab59c05ca, 0xcae2cb352c5fc651, 0x2afdf3f0b933d69e, 0xd98a39eaa12638f4, 0x060d7619bf9e3328, 0x04230a615a709c8b, 0x6941be14bd900544, 0x98aa51b2171ef309, 0x68afbab5e6fb7362
+, 0x57a35aedefddc5e3, 0x546db9f3d783a9fb, 0x7dbb283537714137, 0x1984db6620545845, 0xcef919cf3762316e, 0x02872307272537ca, 0x60c00c1a5e4167e5, 0x340f7e95bf2fa86b, 0xf34c954689e23f54, 0x6cce02dce795b771, 0x4d13f4a12570f43d, 0x08a40e3fcc4bbae8
+, 0x6d10e633e5fc4cb8, 0x4d8f64fba896f42b, 0xbe4dce7da014dc9c, 0x6193c18dfdfce84e, 0x24c67743b7952bd0, 0x7fc99b27a478d3b5, 0xfb9b64d006adab29, 0x54ce49d758964f90, 0x021df0ced414dbc3, 0x5dd6db8261a39288, 0x6b98dde9a60701ec, 0x71d636078d770ab6
+, 0xfcc8dd814237ef59, 0x670cfb91f060d1e6, 0x71cc5511cfb68a0c, 0x3396867d146d28b3, 0x3bc4e9f439eab1b8, 0x0b1d3825a39c37fa, 0xac85a5692444c2a2, 0x4285f097d122a096, 0xf5f549c8bf617850, 0x2ca701527961c687, 0x3edccd6d0bbc2a24, 0x1bbc842cbd53f353
+, 0xb23bb426e2d3844b, 0x4a2e3aba5dc621b2, 0x7a204e5bb34bafce, 0x7fd0ab6a73a37b68, 0x61d173491cfdffba, 0x1b62055e39a38912, 0xb74b9d56d0b03597, 0x56ade358068328e9, 0xa58c88eb9eca7d59, 0x07e7d7f1e84918b3, 0x9077e5d55b631946, 0x30a696fba20ca7b7
+, 0x5cc7466fbd604fe8, 0x14836ee6c46baade, 0x5df1d9afbb61ba59, 0x63045cd4d5d597a0, 0xd511342fefb74951, 0x506d41ac47dcf488, 0x882bd9047d7ecc7d, 0x526ec056e9b07665, 0x92fa6bcd8c634021, 0x6c879303def486d7, 0x402fa434c4d003c5, 0x379fca3ceac5f937
+, 0x04713e5579798433, 0x48ed33ba8329eb5b, 0xa15292ceb7fcce22, 0x240affe743e11a93, 0xcbe90a91b84932da, 0x09886aeff54d1679, 0x7b9f100a8b1afea4, 0x6fc79ece73d0ca0f, 0x38a65ef9be0b8e99, 0x2775442d1bb98f2b, 0x8897197f03ea95ac, 0x04ad5370718fb56e
+, 0xa8b4adfe4cf5fe6d, 0x311c7b0672515383, 0xf4f3814a3e6db042, 0x16fe974236ea5d8b, 0x6a20354a2f783938, 0x63a7bf8f83730e89, 0x034a03b880fb8fb4, 0x7d2b87f54f15705a, 0x4d83c6600c95c6c9, 0x415724033a868d8f, 0xef74b01e3830982b, 0x7896c891b77c1632
+, 0x8dc2422746d184ce, 0x70db0f0b631b5f17, 0xdbd6c614e636adfe, 0x0bce48b4c0133bc7, 0xc63665f7533e67c6, 0x3ddc2cd98c29e01a, 0x9d6a8eac5dee19ad, 0x2742fce2d71a2ee8, 0xbaf097f908a8d4c1, 0x77a2b4a9694b461e, 0xf0d18bd1e2e2410f, 0x062a5528b204dae7
+, 0x6bd0414b08f09a04, 0x23883d9756f968a6, 0xba57325fcc93a633, 0x4c792579be19e7fa, 0x169ecd7a1f9a71f6, 0x514767b514f4310d, 0xdb44209d44b3de04, 0x14bc0adf0176a094, 0x8712004f43e4aa56, 0x2f8ab85e0746d91a, 0x33aac04688a27848, 0x36d9da3cf70784a5
+, 0x19a767f3ee51a349, 0x4f9c7f4c56768a5a, 0xb117d3b40092ada3, 0x6532344b9ce1af80, 0x53d32aacdef85a72, 0x7792668447a92734, 0xb42cbbaca5ea4e9e, 0x33b8e832ad9ded77, 0xc5817a1353a49abc, 0x4dc90d90973b12f0, 0xb6d93e79047f394f, 0x2c83c6acdc7c5878
+, 0x6f5ebe1e77e76b32, 0x7252bc70725fc870, 0x3ce06c1e50152eab, 0x7590580aa852c6c2, 0xfc6526380ab58216, 0x6bcd6f2c1447dd56, 0xf79cc04b6cb4494a, 0x5ef54790d1d0eb70, 0x91728822455bdd0c, 0x2d22d1dceaf79d22, 0x4ccbecb409714f7e, 0x65d5f8fc8b83f0a2
+, 0xec3dc80305a75d76, 0x162fd43cb2b17708, 0x1798f004063d0cc2, 0x112a48ebfdfb0317, 0xd41129eaf1a0b52f, 0x1614ca14b91e8cea, 0xa1290f12b3962f7d, 0x4a07cab92f842d59, 0x8a1aba03b557e6ff, 0x4d23c6a41578f6e1, 0x736a5a3d985e901a, 0x003671c0d819829a
+, 0x58db9d2d561cea50, 0x310a29a0f8266626, 0x47905d83d613d059, 0x43d4cf433c72f63b, 0xb6f6e764db79d2df, 0x42d96ec852ba9b5c, 0x65ed772c94c77c9f, 0x15d8433db7bc11b5, 0xd43ab0c085e421f5, 0x012abc2a10ff7a0d, 0xaaffe0f8f47f3858, 0x291f1b4c7bd3efa1
+, 0x3792de3a5417dc5d, 0x33ef350db81c5cd8, 0x83e6e653f9039ccd, 0x4dc3e1c696c7b745, 0x869832e8770f51fe, 0x3e98fc5d79d99ea1, 0x28997ef760f11cc6, 0x7cc0c1aac1097b42, 0xde60841ee879ad93, 0x1142b1db17f47cb6, 0x42647fd16f66fffe, 0x734ea447760e4505
+, 0x33ed56f09663ef78, 0x0635d6d74fc70ecc, 0x095a4755542ccbfa, 0x53346697beed5c3b, 0xe9565ac575e41ca1, 0x3b99a3b32871b956, 0xa63b9adab16309a5, 0x71aabcc90a7a7e81, 0x469593896809d1b0, 0x0a0f581d591f6674, 0x231676661b55d12f, 0x39fec154deb30501
+, 0x0d763dc0addd4b70, 0x53f3896a620bc697, 0x134d21cb149815a7, 0x6cd92bbacb877673, 0x43791c5f84260c4d, 0x544fe7a56d32cef2, 0xbd40608c13517169, 0x028f734611e45768, 0x2706ea21715f50fc, 0x3f13f34de25ab726, 0xbe05e60e35428cb1, 0x083f46e8188654bf
+, 0x96a53b039f7d6daf, 0x2121b290376b4f25, 0x55fd323edea43831, 0x307c7d0759b23823, 0x70c737e1ed7274d2, 0x28f63c09dcb090aa, 0x44647427abff0b31, 0x17ed21aa03708465, 0x2067a5ae990e27b3, 0x136e419a41672988, 0xd6ca271e2884132f, 0x09eefd6b9860aa20
+, 0x4257d71bfd91d9ad, 0x4c2413ad0f7d79f1, 0x8dc66fc32c1285fc, 0x6ef53eebd8fc9eb4, 0x7c1c1cd65265079a, 0x2acbdde82f71077f, 0x9bf3ee39f8e1610f, 0x7f9995ba1a8c93e0, 0xa0c1e0b7b27f522d, 0x44be7a50aa039075, 0x6b09595bf0988f2f, 0x3078c2a581d72edc
+, 0xe647ed2f9774fa37, 0x5486c7650ed58ac6, 0xd3f25096b353c03e, 0x2a7acb335dbd1680, 0x38a757712e4ea5ef, 0x51281dd799c14ac7, 0x0ad11b2a84f947fa, 0x16a6cd182edb4dde, 0x45e8609c3fc7e408, 0x1484709f77b9b9d7, 0x817626281637d7ba, 0x53f57248c38928f0
+, 0x12ae014146fe6036, 0x2a3cac389fdd091e, 0xbc3d22fb942e8327, 0x43a686a4f698a2d5, 0x2da41cfb97f5521a, 0x5a6ca00ec770437d, 0xd8fe01d044ac91dc, 0x574df0ec449c34d9, 0x2c1ac5bdeb9b7157, 0x6c26ff3d7fe2fe0e, 0x96824d5bfc6dbd46, 0x029547e2cf05c212
+, 0xc53635d1b58a9b29, 0x55bd3d7a4bfe8502, 0xd0436c163ee3fde2, 0x0bd59ec18ac2b4d6, 0xbc851d1ac43cf7be, 0x4317887dec13c956, 0x1f88e92c14ed05c9, 0x7e7d6b23d6f35ae4, 0xd3ec2142b4467a19, 0x6a276ea08a67ff86, 0x5ed97d9778656a8c, 0x761baa5650d4de43
+, 0xea6a76e515218d13, 0x12b0dc0d839d004f, 0x72279009c8c0392c, 0x2d4834ed7a9fd715, 0x9777927248291120, 0x3c88311d5b686b81, 0xdaea9e93b84c3db5, 0x4c334e53d18f5bbc, 0x52e11d6227826e60, 0x1d7f296c9a4e5b64, 0x09f5bf4d4d9a3978, 0x3dbdc776523e20b4
+, 0x21bd97a5d3707e44, 0x0f43e6baa9ee782f, 0x4d3d1691652a00e3, 0x47c649682c4a208d, 0xe00b338507aba2db, 0x7ba0725ff5054bb5, 0x33c1f76abe1fa0ed, 0x583ab3e76fdd74b2, 0xc4da94245defcf63, 0x65dcb6c0bc452c87, 0x7496579f0da5b430, 0x596b3e1735bff834
+, 0xac68c162fe78f719, 0x57807c932317a0df, 0x32c97d9b56245a10, 0x5ce0e571e66772fa, 0xc40943c21d229dee, 0x7bf490ea593c185b, 0xb5fa4d4faa5b55a3, 0x36bccaf9e643cb1d, 0x873598b4e41bdd62, 0x7a4b5e98d3ff4859, 0x74b9a1f1696c6397, 0x2e5a4899fac610dc
+, 0x651027cf77c192b2, 0x2b10eef4a28a3903, 0x66fdae4581203f47, 0x536e7c27dbb34220, 0x2b709902bca2586a, 0x6f3a93963d2e3975, 0x102105b749e682f2, 0x3c88b07452d8a651, 0x938d85403c7c605c, 0x190aa676ae23526e, 0x48211e33667bedb6, 0x7dc7d9c01ad02576
+, 0x298f38d19775fe21, 0x7c1f8aed752a103d, 0x628fd3622102f2ec, 0x44842bdb59426d6e, 0x21b727b490502c9c, 0x5c797ddd74c2ff19, 0x414ea69322c8afe1, 0x6f1c9981046c8bc2, 0x301658724eb50c60, 0x287a185d570c5ad0, 0xd9995e6d1780250a, 0x56a51f27784e1175
+, 0xc04f4ebf42b9a462, 0x74d419963293096a, 0x63862716fbf274ea, 0x2c0260d1e5a78d60, 0xfc4f1c09345fa185, 0x324c5e788da7bf10, 0xb513d8c44fc2967e, 0x1b22149886d73462, 0xadf0697c6a47b6f1, 0x1ad6777e90b5c62e, 0x1705a22d5933eb7f, 0x25cbf66584efc851
+, 0x18dc8527dc2948a3, 0x23e476efe2e8f713, 0xc4569ce42b82f979, 0x5494e3dd73d64c91, 0x76b20d943f083bd3, 0x3de13ea7ccdeab52, 0x58ef894236e04949, 0x6c5df2601ebe9ce6, 0xfdf53c1651afda07, 0x1fb0eb03e7982207, 0xc1c5bb2318d01ab0, 0x23b5023beb8e53ed
+, 0xf49eb1ccc128d8fd, 0x7b878bd62b769712, 0x95b3a9d61b684f26, 0x10b2ef3479888e4e, 0xa13a52d7efef8a23, 0x753ea39504523277, 0xbfda1efc02d7f4bc, 0x65f59684ca7659f2, 0x74fcc07cea348a0f, 0x102cf39fb1563cdf, 0xdb14f5e36aac34b9, 0x316d9fd5a8254864
+, 0x2426de98044f348d, 0x34856468b1b6b37e, 0x3de24f9b1eb37766, 0x42ad75d81af9d09d, 0x7a97140bfaa2fea0, 0x764e772c4713129d, 0xba343d540643a50d, 0x0129cf23f23a0019, 0xc0d4d3958f4a88e9, 0x43ebbf21dd36eeb2, 0x2ee139fcf1fd1fbf, 0x7c4dfa3427310d23
+, 0xab42f36db488540a, 0x215147ed789ac705, 0x31889ef1ab2d688d, 0x1b5ec6775650fde0, 0x5749a2f2faafeed1, 0x4b6878b6bbf7d578, 0x72f092d8682b7593, 0x6e34fea2fa680996, 0x28d44f58832a38eb, 0x688b772814eff92e, 0x2192d8265c00f46d, 0x4a14b38dc6a89624
+, 0x9f00903289b24c2f, 0x452bb5a6e08bc6a4, 0x214ea6e32e0a69a4, 0x5d1498a3acc01ebf, 0xa2216613ce954669, 0x5a831eb842b105f2, 0xe6a2b80006a2e5a3, 0x7d41b7d8997dfb16, 0x400197a857d3eeba, 0x2588b0026b6aa3fb, 0x544d79cf148af28e, 0x666f9bac367b9f59
+, 0x5ed85843a4812364, 0x11e727a43e493ce2, 0x5bfc4d8a99bc1fb0, 0x024a05ccdba870a7, 0xef8444248c8ae761, 0x1a9a0fdce125ddd6, 0x726ce730c27222c2, 0x5fef6aa969799123, 0xd616d3e5ad2f66ba, 0x7731586e9962dbc2, 0x67e5d5655c898a7c, 0x2367c1af8a581ef2
+, 0xa2111d3e29318893, 0x237323ee54fc771d, 0x89ee54d87102ff00, 0x6b15a9afd4369dfa, 0xcad771c47777adec, 0x23f052c298387819, 0x97e1ca2291f61346, 0x4e09e99d71f5ac8f, 0xf7db4211c0ab33dd, 0x5ba8b003578b9801, 0x4e2f4072de4e1fc4, 0x4733be3dff12f697
+, 0x880b807c5b2ed1d4, 0x191fef58e5278e6c, 0xce312848e08ad07f, 0x7736d532a7680d0d, 0xb32fd6a63cf3fbdc, 0x0853ac5009ac8d3e, 0x02991c2c87d3d893, 0x4e46e03b00c1e447, 0xbcd09075b39784c0, 0x1ff922d3054e5c54, 0x453a5b0f8822e94d, 0x027d4e52a109edbf
+, 0xd4d8a3df2c34c9c8, 0x122b2aed441609fd, 0x8e4033ab36905fe4, 0x2998f246f92afd77, 0x27f3de5f7cf08c57, 0x5ecb47ce687b7c83, 0xe6750c9723fbbbf7, 0x20fd6d8abbeb5bf1, 0xb1d1e2ef7879688d, 0x4a6410b3682a79a0, 0x0d96d6e34e55c26e, 0x599f50346f17cde5
+, 0x06de34b714b552f8, 0x6df67b049f706eb9, 0xdee27e2bfc5f9246, 0x68fe7f61d9c33271, 0x88704c2d3a218421, 0x0bb1f7198db568e5, 0x3788c3dbffe367cb, 0x7f7af578bb9d6f63, 0x05fa595d9baea260, 0x040c78c8e1935ef3, 0x9410f2be261c6950, 0x08e843098b236e70
+, 0x2b0714063ea9311e, 0x5d3933cb9b00559d, 0xcf469a0c70bfedcb, 0x595631218c4804b6, 0x67aabd35d71152ef, 0x3dac216b822c93a1, 0xdc75af918a7bf001, 0x34d93989fe73d643, 0x322df1fbe814c1e9, 0x0197c8b31e8a7c52, 0x476f7be0f55ad0a7, 0x1385ea21c5d80e14
+, 0xa5944f4f0c1fb8fc, 0x7c603dc967d3b15c, 0xa69d81c7ad9e67a6, 0x66180b0e45a8d3cd, 0xbbf888144553e50d, 0x6ed36e781d58e179, 0xebdb7278309ef490, 0x7b5ed394c2d66de2, 0xd8df2f4dcf502a30, 0x67def82001f8cc62, 0x567073384a7c5d31, 0x11445c60244ece03
+, 0x31fe52374e3290dc, 0x6f0e09ec972efc43, 0x31e8b7efce5255a6, 0x060e9128dda30174, 0xfa50b2ffb90ed916, 0x33e7331775d414ba, 0x6a6d31d3513da251, 0x0dc706dc4a735f5f, 0x4b0bfbc3f9470b65, 0x68638be833bdd6a7, 0x906a6ca6ae1b481b, 0x21468f34eb96523b
+, 0xdba2592417a0db7e, 0x7d6fe4d5fc32dd42, 0x748315b184965352, 0x4d247af257c15b3b, 0x2c89ff897c0a8e58, 0x6c1b56c23de80340, 0xe50376e5b73ba781, 0x0e1088445f03c0d6, 0xc407195012e5ca7e, 0x0bf386804e1c0242, 0xdee77e76423003d5, 0x55e2449241dc67d8
+, 0x023ac7e5b010b413, 0x49ea8cee86da7a7b, 0xb8f37596fba0f9a2, 0x2c7e6901558a530d, 0x7679ffdc483b5ab6, 0x581cc7fc14392117, 0xdcfeb9fd536f9207, 0x0aeb8f9c1b26deae, 0xfe918ff0e5e2d2fd, 0x41a199ab909be16e, 0xc87e701dc2c0072a, 0x6bbbced2c0fd1733
+, 0xd3182bb0ad3f5932, 0x48e05741abf8e5de, 0x3ee09df174aba575, 0x0eb76aeab19f5be0, 0x9a7341dd7f135dd0, 0x76cd3e27da14c8af, 0x7dac6fcf5f63e905, 0x1d97b2d4ba7b8760, 0x153e14af6cd2ab0b, 0x46e98bd3d611ccb7, 0x944ec695a89b0165, 0x5cfcc892ba520f0d
+, 0x3a31387ddb3a45f4, 0x387a0c0e21d91b04, 0x5a653d0d84f340eb, 0x19fd192f090e195a, 0x64159bad8fea9ef0, 0x3b37dae705d90da6, 0x49e5bade9d27a91d, 0x621f7fb33c80f7dd, 0x65807a3fdf76f042, 0x2a08e7fd32bcbbc0, 0x9fe6c60d133990bc, 0x735f8f278756c118
+, 0x726acefed1a0149a, 0x2f0ef0501d70607d, 0x20a6fce5b26d9ec0, 0x5265cb14e8bb9905, 0xab5cbc15a316c90d, 0x7056c4777a5db974, 0x288b1129a6979ce2, 0x3644ee0c3297df6c, 0xbe1dca516a42e104, 0x2029718b06e00220, 0xd9fb04a7cb0a3fc3, 0x1b7091b4a767b79f
+, 0xaccade6ae2e30999, 0x6d421794b534aba7, 0xa601d727d76cb7f3, 0x54e6cf172ed821ed, 0x1fb7704800854968, 0x10f2a36978b1876a, 0x500abff6142263b5, 0x1da96fbdb7c27270, 0xa141dbb6677d3b7b, 0x4b60147792a81eb6, 0x6ac121157522e293, 0x34ebbc90f90f52a6
+, 0x46d475c9d41262ca, 0x341efd0899cb645e, 0x3d6bcdfd0add4552, 0x467e3cbbfbcbd513, 0xb098233e8db3ca47, 0x19dd57a2efffc11e, 0xc9c9e8273971c3ce, 0x104df324c73aac97, 0xcf7a4fb9f3b5e582, 0x31039f2cc8a4b466, 0x01a61d14d8312971, 0x304a1e4646ce1575
+, 0x62fc233b77260ab7, 0x5aa7932cb4194fe7, 0xb69a8752d7d94656, 0x22efe5f659ef2fad, 0xe59c42596575b77b, 0x7b63173fee13ff19, 0x0bb746a126f382d2, 0x3b52a0e812affc2c, 0x6b1e90e203eee9e3, 0x45e72d9954326f36, 0x99318b4a9630117e, 0x64cc98611ae69de7
+, 0xd2fea9e7b759e2e4, 0x67c16516193aa57f, 0x38a4af89acc1a82c, 0x01b1e1265eada507, 0xe2a6b20ab9cfdaf5, 0x2f5c17b61d9757d8, 0x8259f52190fd71f2, 0x0db553d1ae605a28, 0xc30f248cd649bd1e, 0x3ef0ebd0c4fe8cae, 0xaa537c40f83a311e, 0x26c07dc839918d20
+, 0x1aa393087f7fc88a, 0x5274bd7b65c6b3ff, 0xe30c7bb7e0b5cdef, 0x0096585b8003352f, 0x3b6d10f7e66463a0, 0x4614af7b090e65ba, 0x0e786413397e0d91, 0x580bd90c836a532a, 0xf12e29111e866937, 0x123e79c3755a27eb, 0x80a66f724d2a9c80, 0x272b537cfe718d07
+, 0x4c3e298952468426, 0x016c57793791c133, 0x08e2bc1efbbeb1cd, 0x57595ece7d0f6365, 0x58601af2c30a4ac5, 0x5286ec55a56779d4, 0x7feed70d7d9958eb, 0x172292549c2ea8f3, 0xdfa789522d0bcc98, 0x451dc4c389599f8b, 0x03a0653d1a9c1f15, 0x03e39f4085df2381
+, 0x9c7477fba19e2b35, 0x3435f13f2702ef23, 0x3a088d1a1126edd9, 0x07d8a598c43e6e31, 0x49dd3fd013565125, 0x1a3b1ca4298380e2, 0x707c8249cbe9fbab, 0x4b45833f86ac72d2, 0x6871870750aab36d, 0x46e34009162bea9a, 0x794484890716084d, 0x6b1bef7a33fdac0b
+, 0x89e99c3b653787ec, 0x58a2d17ff074fda4, 0xa99a09e2ea0a4e79, 0x240e5d590c65db1c, 0x8ac089d5209d4187, 0x5250370f9f42ca94, 0x96174560326840a9, 0x489918cdc6803920, 0xd8380b8b48545743, 0x18d49dd4fa1274a4, 0x42c7e619ffcc249c, 0x75e29c170d0ff020
+, 0xd2f9cf4f4a2607aa, 0x3da1dc3d5002690a, 0xc902a42367460564, 0x5467cd7d0ebd990e, 0x06313fe487f53dbd, 0x15cbb8feb1c31357, 0xe49a3517458a0c67, 0x02569571a5f85971, 0xca082b52a4fb2c0c, 0x4cbf4ac89724172c, 0x35024a3c5ca4a044, 0x4d110dfad36e9a2f
+, 0x9975687df81a664f, 0x6d22c93c43d8e503, 0x95659b78aa0b1847, 0x37a6cecb63202bda, 0x81d4fc0344ea7512, 0x1ffdc05d6e1b4b40, 0x112662bdbc60fc0d, 0x29a759ca62c64296, 0xf7c68791fac6e27a, 0x77c73c30edfda363, 0x14991407475d0852, 0x7bfdda12088b2fa0
+, 0x5dab51824c0e1847, 0x562d8eebd4d79765, 0xb1459073db0e8787, 0x2a45c289f164f54f, 0x43d3fb0c3f169aac, 0x5f535f37312e1187, 0x86f50435f7a3689e, 0x7fc2b6db96ed5f01, 0x28def000f96ac056, 0x5e71ca8bb3551950, 0x11c5edfc968765c0, 0x5e615769d383ccaa
+, 0x4f9d9a2beafa000c, 0x5b2d5f5abd2ed39a, 0x1441eeae4aa0f472, 0x31c5c84a40f2e7ba, 0xd339c53664853f6e, 0x1d103d2289f402bf, 0x129f519ef04b05f3, 0x6b77963ecaf74b1c, 0x1cd5aff1c1b44ed8, 0x3b49e10dc91295de, 0x4251ddeae78f442d, 0x07971c902535b07b
+, 0x7c87cf966949fa53, 0x7e49a4d92e723f38, 0x1a4037313a6f3dbe, 0x0aac640d4cdf14e3, 0x1dc11c4b3605d05d, 0x376afa34cbcebd2c, 0xd1a88cdbffb7a75d, 0x37d869799ffce039, 0x805753877f165bd6, 0x30ba538baeff80a7, 0xfce303b78ebae7bd, 0x4170a3080dfdf54e
+, 0x0d8451fc0dbd39fe, 0x16624fcc51e61604, 0x286ad01ccbfe1baa, 0x0f7c748cb3feae17, 0xaadb9fa5fe2543eb, 0x1d318ec07b78a0d3, 0x9b1b2812f7871281, 0x6f35a8a9aeb20217, 0x392470377ee68057, 0x5e5e0592791872f2, 0x6e3e59c70a858867, 0x699af2d555bc3fc1
+, 0xbc6bc68ec6201a3a, 0x6f2883d435c8d1ab, 0xec90264198ebf77a, 0x71fa4d4ead7dd730, 0x2d75620764152f00, 0x2460883f872d375d, 0xe9e879e7c16e880d, 0x5234e48f9bf1605e, 0x8b45d0d0bcf6ef4e, 0x13bbf83dc3483d9d, 0xb0d8f2703bcb8f3e, 0x020f4ce4b130d63a
+, 0x73aad26f809bf54e, 0x288a61f6f7d00850, 0xf548a06cd153af5b, 0x51ba5a920bd22d22, 0x895987fe0b9cf8ea, 0x63e5e2db1e602807, 0x6a51f1c68d588a7a, 0x304c4bdcc1a33551, 0x1ee33ee92654a41b, 0x2f46f4a3812c4ae6, 0xf5855ec18e84fa0d, 0x21bc85d626626bc7
+, 0x21ec4d25a4b3353a, 0x17ade08c7941e009, 0xf8be38d597224ad2, 0x09079c2be153613c, 0xdfde9c7136077c73, 0x23d806e3f7fee357, 0x6efcebf6b61bcd32, 0x6ac2f07dbe80b7ae, 0x09068d77c1d4e7ca, 0x766341fcae244efe, 0xe1096cadaac1f387, 0x1edfe24c14bd0bb1
+, 0x5f67bc24aacc118a, 0x234169c2424a8090, 0x5d40aa44e116220d, 0x2dbff37e0c94858d, 0x798ea3bb92d4e047, 0x35585b5c42f8dbc3, 0xebb0dfd29995ab9b, 0x428edd96a5470f3a, 0xd9548d861e64fdd6, 0x100bdde1571d0ef7, 0xd1a0c727a42ae0e6, 0x5d91580f5921dfb8
+, 0x9302f7dbe2eff677, 0x2aba98540f46c9c4, 0x84344f1278492bc2, 0x714a497f798f9d1a, 0x2667887e20b187cc, 0x00b5c043506c3634, 0x3c98bb291fe5ffab, 0x7061470a56f39f43, 0x1aea4bc1eb08de71, 0x02d15877c6a2d998, 0x42485acaa5ca690a, 0x037a09777ad9cbad
+, 0xb95826cc8e00df5f, 0x263479cec25b997d, 0x321b67b0503ce27b, 0x086f43bd90be2247, 0x348fc15a1d9b93e9, 0x52afc45f4eebcaca, 0xcf55d718433e2680, 0x7b3e82d781b5849c, 0x0a001bb2e4543a1c, 0x4cefd1b29a03602d, 0xba07588d9e049252, 0x7a06804f171af890
+, 0xd84f0999c355afaa, 0x3ba918075af0e682, 0xa7afe1aede198a36, 0x773b22400ec836f4, 0xe82b5a5fe57c78a3, 0x628114bd33d29e46, 0x6897b97e4894c34f, 0x13275398c43c3027, 0x036555f3d4f8b101, 0x065fa78aa3f9bdc4, 0x54d866909aaefcc9, 0x49e4bf141018e0f0
+, 0x0546842722010b55, 0x2a99db48af6cacfa, 0xbbc84dd4341ed21b, 0x54beaa72f6e99c58, 0xea01b6852135fe79, 0x633feb7c36a9d453, 0x0c648555c288a0ae, 0x67120bc7b700efbd, 0x8db23cc2eac4ce3c, 0x30276a7c3690fea6, 0xfef8ed2b09f073b5, 0x6c248f236845eabb
+, 0x24e8f10bde7f195e, 0x48d8d0f5ccf6310e, 0x55137596edad27c5, 0x24de3529efd53a11, 0x2e3f9d219a148a01, 0x11af9240ee66be8d, 0xaf33223f495b1f73, 0x12f5db1db17f9ccb, 0xe57b0dee29453875, 0x63fdbedcba1d0cbc, 0x23d9cb95ea5411f2, 0x2168610507016858
+, 0x549fb28fd4098f38, 0x58ee4f24e600f3bc, 0x75b82687a0a1d6ad, 0x078273041cff8bfd, 0x832a6789dd0fd1eb, 0x61ccb546185deae7, 0x9be4c792e3e0d9f8, 0x6bb2f610861f95e3, 0x0d2259ebfd5c5ecd, 0x5c07ea4061bddca2, 0x515a11978e396e33, 0x09b587f04a6bfc93
+, 0x80487f547ae29399, 0x43e281d24617ee33, 0x19dcf2e607444742, 0x6dde8f5f206ef35f, 0x2279775f5a0e53af, 0x7b9b91fda7108dca, 0x016b9f2cc6f04f1e, 0x7ab7dd0df4a3ecef, 0x84bef8cfb9f3a08d, 0x75c36d9826535998, 0x8e8b20536cd1ebe6, 0x34f48f8b1a305bf8
+, 0x262e2a0a7b9fd870, 0x17829fc014584e33, 0xcc7dbac447885a86, 0x1a264ff7900b9f32, 0x9232e30fabb66c6a, 0x55fdfcf40c11f396, 0xf949d7cf56912f7b, 0x3100763ba5ae04b4, 0xc1a5bce00b185e36, 0x4825da23319f974f, 0x48e116965adaddc0, 0x15a79a298422ebe4
+, 0x0576b34de26bace3, 0x095bf9ec9c4862a8, 0xde2298c4e3bf8550, 0x0fffb9e6593ce76a, 0xac6c157100ba3091, 0x1a4cc6c876aaa28e, 0x0a7e03d3fbdb2703, 0x25f2f4e9fdfb2288, 0x294673cce1d03667, 0x49ca3bc6d1ae4031, 0x84baae72d4f351b4, 0x627d3d131bffe277
+, 0x7ea5461c78498091, 0x7191b12ac3a4d065, 0xc41f2c0e652fe2a6, 0x2055126b2de33a7b, 0x8988b2b1a1678e57, 0x58d9423bf10ce7a2, 0x148f953675c01d2c, 0x228abbdc768f0ca1, 0x3276afd9f45d2c1e, 0x4387b195e65968ed, 0x729751ad7640bfcf, 0x6ec28237ba668c43
+, 0x3102de6c1362a4ac, 0x5c88cec67a16cf9c, 0xf3f8193d796396df, 0x163cd15e70e576f7, 0x885716030ce9af32, 0x777369306cb8965d, 0x5612c95619ec516f, 0x3bce9602c644d1e9, 0xeadd6ca94fa54a88, 0x5aa129228cde4e8f, 0x04b6aa5b1680e8fd, 0x088b8f46feec086c
+, 0xade7ec567865f2b6, 0x2f9fad4637a84862, 0x85ff02514af387ab, 0x4f859d0de16f6f00, 0x0ceea9e143c9ed07, 0x1f339a05512c9019, 0xf6c1a8092230014c, 0x0b576ba98eb84d1a, 0x527935445bf9015c, 0x1ab534008dd3a481, 0x3a0c0bdc27ca6e3b, 0x41514063db31330f
+, 0xb8fd055a1fad5be3, 0x0894c85e9081ac9e, 0xb6f5d0b3c13c9dbb, 0x40a38a661292c8a6, 0xa7de0d9eccfbb4ad, 0x37e74b4964215bad, 0xca3352b42a18c668, 0x350127995136531a, 0xf8878ff9c53302ee, 0x168f8371faeb0581, 0x754962890c7afe0c, 0x46cb633fccff7496
+, 0x26b3045882b3f8ad, 0x2a5ffe2cc60a79ca, 0xea795202a2949d2c, 0x525f71e0ab9d5f5e, 0xd34e8ff2d99e13d3, 0x70e731358d56f05f, 0x826254298b115f75, 0x2dca0f6069ab5ecd, 0x6969b46576f44518, 0x00f597e05ce4b1ed, 0xe7b81dc6857f518c, 0x737c2b154cff6a36
+, 0xe57c362e18ce4ea4, 0x7578c59f53673333, 0x0a5d382ac8c9f167, 0x5ac85d01c2ebc6fd, 0xd29b4ac3b78b37a1, 0x28d155fb3a6e5f0b, 0x6ec3ff655c0461f3, 0x4ca29133544a69a5, 0xc1f5790eb37e854d, 0x5dfb05b572213595, 0xfed2881236774193, 0x3b0ddcd4af5e21b6
+, 0xd8addc43f03b35c9, 0x4e188ec0a2d4245f, 0x187eec24e766ffe7, 0x40f0e56cdbbaa1ef, 0x80237a00fcb7e367, 0x7e88d94c6f5d8e93, 0x21255f995dea685b, 0x18498e3088184969, 0x4a438381102af664, 0x7121a51e9c4312ad, 0xbb6ba5f75cc7f44b, 0x237630143a323d13
+, 0xda526c774cd168c1, 0x7ca64dbb797333b8, 0x3f7a739764d4e5dd, 0x1314e9ae1f627583, 0x20a17101f65e6fb0, 0x644219b9e1486313, 0xe7916b69c19d7dbf, 0x3fa6c17b220ec5cc, 0x0a83e0dd251c10d9, 0x5f124433938a15a3, 0xbc3e1d21d6d9b85b, 0x78f837e589009bfd
+, 0x52bf535b69250011, 0x7e9a18ef44b1e54e, 0x1b645f3f99114462, 0x2fe1300ec54faa96, 0x550129b7a15d9833, 0x2c945ad79a67e07d, 0xf4139004e0eddf19, 0x2b76c4ebb73c0878, 0xe6c8124380450d00, 0x705c65deca63baf2, 0x083f4c87f31808d3, 0x3839048e6ffbb22e
+, 0x4548fcbe3068de39, 0x1e7b8042cc64f1f3, 0x52f1ffcf90fe9170, 0x0ea8d4068d3e3bbb, 0x356d694e0a6451c2, 0x43b42d2678f77cb3, 0xe47575b58d536f34, 0x22b871788701b66f, 0x1b48176eeb4c775f, 0x7953d73295031a01, 0xf5e6d1a3e596e521, 0x11e479a7c0c16167
+, 0x474ecc6be276987f, 0x4e42af71fe394d91, 0x9e5def91947b40b5, 0x4f7e1372867cb8a2, 0xb52331e8d72afea9, 0x686dbe525d65d93d, 0x21e0ce227e456cb0, 0x23d6da420b7422e6, 0x6844e1f5ef707c97, 0x7c790ff31c2575f7, 0xd7e31cf227f5ae4a, 0x2ab72706032aa5cd
+, 0x9d7ba2f6de38de31, 0x643ea0fbcf7201b5, 0x8d88e7decb947730, 0x506c4ca9c67e99ad, 0x55a6fb8a8f25e489, 0x3b0eae4551620485, 0xebd153af6a6d5445, 0x3a7b89a4ca107f83, 0x869d22581e7cccfb, 0x4ec891c84faa6239, 0xf6c11d7bb7c6769b, 0x64bf75139fbbc3b9
+, 0x45a0686b4e41d061, 0x1a2f417831796f15, 0x2a0c959873607fab, 0x599f5411efc3673f, 0x5fb40c0f9acfb8e9, 0x3a8e94903b27c752, 0x26c291c67366296d, 0x418d2d5930fd946d, 0xa2c31e7a53088ad5, 0x3c9587cff1f28e4c, 0x4a14f3242ff5c35e, 0x376b32b598353d39
+, 0x4a5fbb85893e5ef7, 0x626de2c016dcebe9, 0x2c2c22320e05ac69, 0x17f56600bdeaaba5, 0x62e1688843561cd8, 0x273c0e90aba498c0, 0x6b1a63745be6c281, 0x356e162dccd93c95, 0x4d807a51e3301830, 0x1e44b63d5a5ae506, 0xc9ed355339d24010, 0x05f94d80e4a71a78
+, 0x00657d2d741ef713, 0x1143784f2c5e976e, 0xa3441697c7e747e4, 0x2b8ee9d88c91613d, 0xd2a3e242b2565df7, 0x08ab94c646aa08fc, 0x8ac6d5fe92c2b948, 0x7a52f07efbd4ff2d, 0x2f9066b618d634f4, 0x534c4de496e2a906, 0x5e0310ce4fbfef1f, 0x4f7b1021a898da5b
+, 0x4b78e6e261f33c24, 0x7bd7172d3c25f188, 0x9c2c3cf48b55f834, 0x4decbb360d75324d, 0x20a4e87e4eb2cd3e, 0x3a69ec255ec407ea, 0x980fcc5fa5138e7b, 0x3fbbd51f4e711a79, 0x84ac8d14e0227145, 0x33b1a29f867d69f6, 0xf4fd353d71a0861c, 0x3070652611cbf80e
+, 0xd8ddc3565b53cda7, 0x59de6b6e612fd656, 0x7fbc0095d3b4a74b, 0x082f2735f741f62a, 0x0abf776441ec12b1, 0x2f9c67fee2e933cc, 0x9cbd5a98658467f1, 0x1aced6d928634b55, 0x14ccedc8bfbbd230, 0x5e49d1cfb13987ac, 0xce173b87e3b39018, 0x62cdcc1bc63999d6
+, 0xad4e3d962399f127, 0x43fa4de128c55bcb, 0xd24df17df768bc3e, 0x4ec95d2807788a36, 0x83c488a504e3dc20, 0x0ccc7444cf5f6f51, 0x7a24fca9a4ba547c, 0x121d1f95b536920b, 0x5d1643327b0e051a, 0x736c97f7b7feb136, 0x8994093a2253555d, 0x698ccaa5aa2e1b4b
+, 0x2718b8a4a572e4ec, 0x269bb2c383b01d58, 0xd789ec1bf4c4b19d, 0x6fe6d7e6e359f93c, 0x06a7c090958019e4, 0x17b3bebabe44d7e4, 0xd9c986b4600fcc5f, 0x5defdf5e87457c61, 0xee3c99694f674e72, 0x3ee6d82274acd8fd, 0x603b6d9d290bea69, 0x7cd54e08415e5dec
+, 0x0daf9deb84355f39, 0x5685298acfd1cf10, 0x25f679637f933639, 0x285858638d15ae16, 0x83544360e78ecf7d, 0x55666fd0a2d77026, 0x150e9c724a0e827f, 0x16d1b53f86332bd8, 0x364fa1d043116147, 0x37f37ef74728c6d6, 0x198c6448d1cfc07a, 0x7e4a50cbca5dd28b
+, 0xe1adf4ce49421e8d, 0x11eea27a972c348d, 0x7cc6e35230c578ee, 0x2636149c6241f1fa, 0x84c282e562909080, 0x66978cdc6e4aa9f2, 0x0d5670bc0f486174, 0x57c6a6de67034360, 0x845c7bf021f44f02, 0x1c68f60a03634f51, 0x0521746a6275324a, 0x04b38b04a3db7ab6
+, 0xc4592f76fb22fde1, 0x19e2629b4c864956, 0xd4b85895ca6c2369, 0x5c3e420ced4efd66, 0x383dd4aa434419fb, 0x58c45e39e6db27e4, 0x8a1f10742903d772, 0x150506f182d2b1ef, 0x5bd08bc506f5fab4, 0x383158548930d269, 0xef23422c8e84a320, 0x629bdba822f979ce
+, 0xa2aeb65fface8fbe, 0x123d6ff6b181b49c, 0x2c9e033f9f0b0e9b, 0x69524af5e12ad045, 0xcd8007d6cfa13ce1, 0x06ce80e064cc4447, 0xb8c19c98fb355ec4, 0x59820e967bb1c1f5, 0x00c3ac1a58f2f91e, 0x07db1c1357192146, 0x99f4f3154c88911d, 0x1fd056fc248b352d
+, 0x4f4d3f34394686d8, 0x479038cefd31a07f, 0xafc74f3c4b0bc775, 0x68838c28388fe857, 0xa084bb45a6b85f1c, 0x7a7340cfc1035bff, 0x7d2def44df2cc29b, 0x0e203cb0b3ba115a, 0xe2fdf93e081956bf, 0x7e8c4d1cc6cc01c0, 0x55cc2941a80aa06a, 0x7858f37e9d3cbfd0
+, 0xe6c593d1837a523d, 0x413f0ad0508f97b9, 0x55115bbbb45d4a81, 0x384f611ed2534ac5, 0x87348757b3cfaef7, 0x7c79d2012d82effc, 0xd8ef0c943bc1c0ff, 0x68726fe3b0f6adc0, 0xbc8a22c3ff8908f6, 0x0a5e78f9a885258e, 0xbcffa708034c3beb, 0x4135f09455f8f8b5
+, 0xdc4914e275f731dc, 0x248b6c7330f35b02, 0x31ae1e90b9f1b8fe, 0x479e62e289849f53, 0xdd77bec08cfc9ead, 0x306213ba17aadf29, 0x24997906dd17c28f, 0x197b4e7ae415e766, 0x1276e67f1a007f11, 0x43922c2294b69324, 0xd48b91f7d65a07c3, 0x2d05d5fbb2993677
+, 0x09efaf6d480c4e03, 0x387dd96e03cfd0f1, 0x0c98f2c34acf3625, 0x7e19004f09d388ed, 0x532254b03928e866, 0x79d902b644ce9903, 0xb2e9ceb16f7601a9, 0x2d683373380c7347, 0x941e973620411f84, 0x16be5e64ff2ea306, 0xb5428cb9b9f51072, 0x037ecc47feeb9d65
+, 0x8080f92af7cb859b, 0x3d9ea7d8d6ac6b71, 0x7529dc93c46c119b, 0x1b23d986081e9a6e, 0xa3d32d9cc9abcb0f, 0x3a307511f39aa715, 0x8c3325183d4315d8, 0x77948c64aef2bb29, 0x4e5454c4869ea7ac, 0x5ba3e69d9369f6c8, 0x70245de762e84405, 0x15138781737a7e25
+, 0x5523418e67d62c7c, 0x384c0d8cb7381197, 0xbb02b96397fe4dd7, 0x46fb94592b9759e2, 0xf36842530eca32a1, 0x0714889172e433eb, 0x1f08546723f32944, 0x13e3cd50cbe9362c, 0xac21fa5730ac44a6, 0x5447026ca0fd2b27, 0xa116b6fd65605299, 0x4fa6d765433bc607
+, 0x0f2444bd8034c96f, 0x57bf3febb508536b, 0x8704780e7368a4e9, 0x4d3b05bce725fa26, 0xb96f4a0b17beab95, 0x0593db3b01c402d4, 0x6f33f815b9a428b9, 0x68ca8e3d0851155f, 0x3528fed3916a4376, 0x70295c905ae9e6fe, 0xb1e4d5a162490e9b, 0x671d546b141f52af
+, 0x58be4481b4f608c2, 0x117524095bebd68f, 0x4be5fb208596263e, 0x0ef05b8b44904773, 0xd158e1ffd5d999e4, 0x014eee862f9e60fd, 0x642eeb55f84e43c7, 0x339220af97a76692, 0xa0ff26f252c529d6, 0x7ad348943a4adb0e, 0xddacc99a601409d0, 0x577b55aa7e1776cb
+, 0x338e48dab2e547e6, 0x095bb27620f411fb, 0x9d71c0acaddbdb3a, 0x6ef1e1f3ea9faa21, 0xe855910ca8ea0054, 0x33d78444745d75c8, 0xebb190923658e0cb, 0x33b073a745652bd9, 0xce9ad11756d0a7b7, 0x3a0bfaafcc742271, 0xd9257ab30b517ba0, 0x1b7ef115e46d6ad6
+, 0xf895e5f24d801bf4, 0x0e0e0443df47d707, 0x95ea71abf164a6b9, 0x4e889789f74d5d6b, 0xf54e55907ee4fe84, 0x3040c9a8d5241bb7, 0xcb17a2a73744bee8, 0x717038bbc41e3736, 0x5b0f75eb4a005f3b, 0x4f9e0b78c3a308c5, 0x87d8933bd415229b, 0x5d0f52d42fd50fbf
+, 0x941ee7c1fa040834, 0x7ee41672d63b97bd, 0xa17dbdea2e1c7f23, 0x2963fc69158e3241, 0xe0e374c70b1b03de, 0x1a4f0f2e02c226ed, 0x60d24b8fa30053f9, 0x10a003fd22916343, 0xe62fa73923e97a65, 0x3991f04f02c865fe, 0x7e9f0f8d6938e6da, 0x5419f260e557bbcc
+, 0x510a60f7d189c75d, 0x1a7869b6fb1da36c, 0x84de4017723c2538, 0x638fe827dbe2ecd5, 0xfb280c2743b18568, 0x1cd3eaa6a08ff942, 0xdafc838a3e82c5fc, 0x52cb654df7114f9e, 0x33aee8893f13d1bc, 0x6ebf4528d3e11ba0, 0xaa90fecb87640c15, 0x4b76b20fb2a7500f
+, 0x122a19dd40acb192, 0x50181fa16ed161b6, 0xfe90630b14f974ef, 0x6e0143244580b273, 0x03dcf8e5c866059a, 0x1921461bed3d812d, 0x21680fd3bc78723b, 0x1214545ec07faac9, 0x0fd5df81366501fb, 0x27403fe2916ad587, 0xb94f0b6f644b1524, 0x1a123371acb2670a
+, 0xa3fc6f7b3ca9cbac, 0x63d1fb3da5cb3d3f, 0xa30c05d9d5bbd170, 0x29454f70ce52b9e2, 0xefe89c329f7c9142, 0x4130dd1bc80420e7, 0x7ad8592a94c31333, 0x68882d64fea06802, 0x06afc729f1676f3d, 0x2fc0678b03e85208, 0x0f3a3ba60202da20, 0x6f5d2ada41ccaecb
+, 0x76ec10570241d35c, 0x2c26eee1a3947d40, 0xf818ba0dfa16ec1b, 0x59a807878a9f269c, 0x08f2079e824695d5, 0x5fcb7a85d99748ae, 0x17440c3f2746da8c, 0x7624115cc0c17f2d, 0xca1af7330e8bc3ae, 0x6185c56cc4304674, 0x7411c05aa5d71429, 0x30475c085f4c66b2
+, 0xd84deea1bedfd236, 0x2200c8c27e9bf042, 0x6178bc4bcca2f2b3, 0x15791de9c068fa00, 0x87544c8a1f84b06c, 0x0678e1a8de1e091a, 0x45fe0853a1063f32, 0x15efaebf7f62303c, 0x929d701e3a1b1fd9, 0x3ac82f9e8cc10806, 0x8e5e85d6b3f244a2, 0x1786356b81cbfc78
+, 0x6a7a9b14f78f4b5a, 0x10310e98ce1ce45d, 0x3d9d0e1e91a43bcb, 0x3425cd084254847e, 0x4de323fd6fc6fe66, 0x196025145449b5df, 0x2506cb879c2e2ffe, 0x66829082b30573a7, 0x672e7af34dc8c06c, 0x0d78a3093912fb3f, 0x00da11765890a5df, 0x695bf0089dcea3ad
+, 0xe2a9264c2e8c1c80, 0x08263574eb68b041, 0xfd2498b0a655149e, 0x532997e18ac0d8b2, 0x329588df9e9d9906, 0x087475ea8766919f, 0x08e87f6770021e97, 0x7ea6ddf202f9caee, 0x64875059b349e318, 0x7193ae26c3b0c9ee, 0xe571de90ecf762b7, 0x3ad40bfe06a9cf0a
+, 0xc502b16cddf6a2dc, 0x4f48a16b4dd4e0c8, 0x776ecc86bca7a21b, 0x5a1bad391fc64f6f, 0xcbd268a8fdd342e4, 0x4d691fe23df10b70, 0x383bf476312e247c, 0x72e535a1b1f2f7ea, 0x37cc9d99a1ccd939, 0x55d1b400361cf187, 0x1261dff8f5c56c90, 0x73459958d8643090
+, 0x65dfabe840d6952b, 0x548a8b87b7eefec1, 0x428331760f72e342, 0x0251cfb2812af50b, 0xd2e8e46c7e85cb07, 0x7c2e9b1b3c3f03a1, 0xd93b67b246bf8f2c, 0x4d056e5d8b34e751, 0xdc84b98c0308881c, 0x4c44d4679a773a55, 0xf456fc6592d8dd26, 0x38ebd2877e10f483
+, 0x3974a3014c6187fc, 0x43b6de988bd05b73, 0xc2dcca0e3f95b27f, 0x1538a0c7207c728a, 0xd706f608c13a76a0, 0x3f4b5bfd39b0dfa9, 0x6101699e83fd98d3, 0x4365777e70c4d865, 0xfc49be595fc80e7b, 0x1284374b889a126a, 0x70e03de8166372d9, 0x679dacae4201a308
+, 0xa2841e027e73da8e, 0x6f779d8ca581afc0, 0x85b340608b00f2a7, 0x055364137476144e, 0xa67807199743b80c, 0x3ff8283cc72c650b, 0x95d02dd8d74eb107, 0x42e5e163999ff987, 0x8d8ac71e83d75ad9, 0x417a5fd5410a8f00, 0x0d5bb6ae517ea403, 0x2e9b5878a45c3187
+, 0xa6c7bb79e0ffb0d0, 0x6e807ce4d2ea109a, 0x3f85f512b587ebfe, 0x106d6dce75caa809, 0x902e370117bb8d54, 0x1f8193d3b6ac97f2, 0x01fc90f51d236950, 0x0fa7d3a254956899, 0xa1275febe1820285, 0x37d213d1ba1188d7, 0xcf395b8920337a94, 0x123652c17ed38307
+, 0x260d1d089df0ea86, 0x0b587a51997b00b7, 0x3348dc32eefd8e90, 0x2d45b72c0cf5519c, 0x00fb471c7a1c350a, 0x29df3464f216aa85, 0x4d0d309f2cadb09a, 0x3ec64a8a368bbd5b, 0x6295d0a784ebe615, 0x2664092df62d2e85, 0x98c71d54d7f29239, 0x1c39eacf51693765
+, 0xfb478497771f2fa8, 0x4e91f6012bb8f437, 0x893f3e7244190dc6, 0x4e8bbd65114d0671, 0x470b6878f455a75e, 0x4c8130471779bb96, 0x126fc3f8d5da1535, 0x73f6701d3c56cfa1, 0x64d1b9531e8d8c60, 0x734d426d5eff62f6, 0x94d1783b07e19bd0, 0x6437f5eccd331119
+, 0x2098c5106b790115, 0x5a15c333544a89ce, 0xebc775ff593429b5, 0x04ea7672874901ed, 0xb5b1ddd0d772088c, 0x2f07cc57d9f584a5, 0x1f3821bb7cc1e90f, 0x6c42acb2dacf12f6, 0x1c44ed69575dac6c, 0x680e5dbc047f27e6, 0xa66ef32555aed717, 0x729e666dcbcabb04
+, 0xb17a84ed66c1a084, 0x6fc3c5825d6f60f2, 0x6248b3d52e7889fe, 0x5e9b9dcd030350a4, 0x43ca79c0b32e2e3b, 0x28763c62de924e73, 0x3ddd7e0605b275ab, 0x4c370b3e4a80dca5, 0x01f92b5b6f70a6bc, 0x5043ad8d27515295, 0x8f4b08cd5a93d775, 0x1252ae57c10f90fa
+, 0x2280c16f887d5a65, 0x44f0240616459ad1, 0xc23891fd97d4c0ec, 0x5d64a84743172bea, 0x25feec40e46662f0, 0x327d57bbffdb93bd, 0x90ae01c2333774a0, 0x7ed5dda7cce457bd, 0x3203b1e8a01123e7, 0x30d0f8360f2919a1, 0xd83fd3fa2aae56c4, 0x04a81edc4b6759ad
+, 0x4199ca632a19dc9d, 0x36db5a356f54efd6, 0x3b204e2a04f8a8c0, 0x6d9a3f407506fc8d, 0x088eea2e94f2ba19, 0x7583a62c2c0e3e2d, 0x1aea0843c86c2226, 0x616c6154e3ea6405, 0x2fa1308d251b3933, 0x08e9d7f445151e94, 0xf8203a8caaab37fd, 0x2945d19fbe2a4681
+, 0x5b1642c9da653e79, 0x6bdba7573c704e59, 0xf7a55782c54595c1, 0x0b115dcdbf0b7f41, 0x2d4625d19613d200, 0x73a6f16f1377d598, 0x3d7036fa9701f966, 0x4793952d06573c62, 0xc2f5c2159a418632, 0x1788e487267c7277, 0x0e589182e9193b40, 0x0f1a3f9696a92e92
+, 0xf2fcac7f9409ac77, 0x7e6dd837222ef1ba, 0x5ebac584770a14ef, 0x41379a699692ec2b, 0x8b65312e0803b2b2, 0x70011c445c9bb2de, 0x2e853e2ffd3deea4, 0x298ea681f839de96, 0x8c2afb35e9882edc, 0x101a8e668e62eeed, 0xdafe4213791f9100, 0x044004b4e2d26c14
+, 0x3fd1cd3c566219bf, 0x01c6ca771a037512, 0xee272903384d40c9, 0x019ed02d12788368, 0x0c89fdf5397e8d4b, 0x1edf777c6c6b2014, 0x59d8d57137d61d53, 0x060532f5656397ec, 0xae48a254181dffda, 0x33be73563d55fc3f, 0xbbb08b657bf12a47, 0x7d4acb4b71348cb5
+, 0x5d54f06fd842c9ab, 0x0c36598fb05660c9, 0x1714c3a5e1f77666, 0x2fd9b2a2d980a3a0, 0xa9bbc9544bbb60a0, 0x1ff863bb000e48ba, 0x85a82268ac3b1976, 0x52c723b534e03b1e, 0x4d0212e4639fc7b3, 0x3ac548428348ce57, 0x10af8123cbeb5dde, 0x50f46fa58acb34d2
+, 0x6f25229f886e97f2, 0x38caab6b64269f54, 0xb8a12e0d8630c288, 0x120f986471b7a7d0, 0x442c29d3dd85b0e9, 0x6d36b59d0b0287a7, 0x73a68052cbde1bbf, 0x3689353e19dad66c, 0x85306decebd7b70d, 0x35ff7c5c8b5822de, 0xd03863b4242343df, 0x2527183804526e2f
+, 0x34a85a470ad8868b, 0x14b9c197e55f8f7b, 0xa36cf531dcd7f70c, 0x0a66407559938f37, 0x141ad7bd89ab51c5, 0x66e81e56fe05ad7e, 0xc62d00e09c9ef49f, 0x0170984cf6d2ccbf, 0xcce85573a94bdf95, 0x31dc8ee3d4cebf26, 0xbd43ac931ec92fb2, 0x5871f09aa5c4affe
+, 0x30fc0f342839234a, 0x14cc91c0352e5a3d, 0x1472d9daf31586f5, 0x291d6f1def468c27, 0x35616dd866f8cf72, 0x2cd7a8cc3a4f2462, 0x8fa99edf8ca0393d, 0x2a1827de4b9d7cc1, 0x1288b436d14095cb, 0x2b014332e172466a, 0x45fd28566b1ec574, 0x52011e70b3a93560
+, 0xcb03d5fe515c7952, 0x6da8c2f594d79f81, 0x7ac8999ba42a0641, 0x1225aaa032a0a8c8, 0x77dcb7232e8f9c5e, 0x7cf50087c026637f, 0x7552a0d2b9b2ea0e, 0x3c821ac71ac64738, 0x2356ae4be025d192, 0x362ec784a16be7a3, 0x450b49b5bfa7b4dd, 0x6db97dab61f2541b
+, 0x23ce6ef748db8f7a, 0x4f06b9127011da66, 0xc337a6a7755b6700, 0x5567703e6a67c5a7, 0xdfda8c317d0e3dbe, 0x1ecc171d97158c34, 0xd247505a2f5b11d8, 0x38e53f9dcf1de4bf, 0xb81e60d32d10ffcf, 0x53cabf53f74d39e8, 0xb4e0c24f78c6de8a, 0x277dfa1648b80963
+, 0x2255a88c90100f83, 0x726bb024b9e696c9, 0x2575e0a7be5e5cb6, 0x7060b1727ca2b4f8, 0xea6b12935293a9dd, 0x10e12b0aa3c7ade8, 0x098c66b94c8dfac2, 0x32da76b91f278e3f, 0xb3a5e037a6be94ad, 0x18a572922fb7cc7f, 0x571f9164c3632727, 0x2ce0d693b33910da
+, 0x0cbc4eceec43b5d8, 0x67d51e27c6589b31, 0xf2fcc3833cbed298, 0x56c2ca0e6e4d2c32, 0xb27c5165d6c0ab31, 0x59508b5bcd9d1cec, 0xb61ec53bb75e46fb, 0x402ab156ef686316, 0xd81f4d85e6c6d9aa, 0x158e8390e895b487, 0x7d18ed8150532f59, 0x2a97c2eb40c5773c
+, 0x870607a0e0e6cbee, 0x067ebc69c40323a4, 0xbeb55ba249491e79, 0x301ea62190d69b4f, 0xdd80b6bd09f974f3, 0x559ee4ffb80d0800, 0xe638cc8c9882ed99, 0x3a589ba12c2ea56f, 0x704a6e0754a133ee, 0x579ed520b44352bc, 0xabaa9583b3958c52, 0x479ccbba5df9ed6e
+, 0xbfe07c435295a7cf, 0x5fbadbae075d9327, 0xee8e71c97f58ec4f, 0x478a2dc29b12a50c, 0xab66e7c788e34750, 0x591ceab609f173ea, 0x791c671ed21032d5, 0x3e30faf51960019d, 0xdd00d267260abaeb, 0x5542b2d03194e50b, 0x3ca4f9545a777943, 0x5357571fbc49d16e
+, 0x1836a720c43a4ace, 0x76ff575a5023b4f0, 0xc01d83a7d4ca21d4, 0x5a428d2ab0457f8b, 0x979aae2ef7d0a8a3, 0x3f19fee8d4540b5d, 0xe73d88921b51f16b, 0x569413b1ce0281dd, 0x07608ba4f6cea86a, 0x3cf9c97b80f9586b, 0xa24f47f3691dd3b3, 0x711ee9660995da37
+, 0xf92a6d2746a3a7ac, 0x5fee71478b4bf112, 0x0be502cf81386da0, 0x216b8c864e54aaa5, 0xcdd1d66fb24135d2, 0x1ce761b2ca25f1d5, 0xddf3848de1f52d1d, 0x61d5a06c92bc0e69, 0xf6526c0793ba4b31, 0x69d94e14f992e28b, 0x881378896659ba7f, 0x090582a5fa5613d9
+, 0xeb50ffd98c5a3427, 0x2363387e8dcb0341, 0xd12db79145950b1b, 0x1350640e006fc2cc, 0xdc6f31dc94b3e164, 0x402129748caee4f9, 0x7968e35f4ce97577, 0x68eaa87a67c741d4, 0x3b32a8f4c8ee393b, 0x1306005f4a629bdc, 0xe169740afdfd7eb7, 0x1cea461c7e2e56fb
+, 0x29dfbe290ede279b, 0x31db96140e96f16b, 0xa4e51cfaf2936eaa, 0x60e58c5d49179bf2, 0x43d3591d6dc6d2ae, 0x5b48ad1282509b0d, 0xa65afa5d51b94f69, 0x669d67a2688254e7, 0xa190eb951d5b5ad7, 0x5b7967083a5e11b2, 0xf0828ee8ddf8590a, 0x234ba195bb87fb0c
+, 0x96760e041d39f7fc, 0x035d6ab669a64920, 0xa4c541766edc0d40, 0x04e8bd93db9e241d, 0xa50f82e52579208b, 0x686d6d27f0981ac0, 0x3e279103d6e9dd5c, 0x081d409ba5072f94, 0xb5b97c9d6ab66b8c, 0x3f0d893577b81950, 0x35466d7745a66353, 0x067a4d3d34981c61
+, 0x9760be70369b2cf1, 0x046cde72c5cc72f3, 0xf9a96c27399b62dc, 0x3c7b4ea567184bd7, 0x5210df3d23293f56, 0x1fef7533a06200eb, 0x5c93d16c5b14cc89, 0x670a64ea44d0ab5e, 0x6332d13fdb802604, 0x19b2ad9810c5dfcb, 0x624fc195f2393aca, 0x76b00d27c7c4b78f
+, 0x2f97a2867dff0492, 0x44feb3d0c3bddc6e, 0x25a58b0ff232d8e9, 0x3054975ba3b94a80, 0x55227275f8ec4a0e, 0x4296fc218299905f, 0xfebcb4832bc4f9f0, 0x6a171caafd264499, 0x7f681716a465042f, 0x209e01c376e6f4a6, 0xfa28336778cedb58, 0x3a70d95d49754d32
+, 0x8d575f6ac89b549b, 0x18a97a1d2cf3839b, 0xab52c0307648cbdd, 0x705c383b12747376, 0xa973eb8d7d089675, 0x232db53845b1f628, 0xd0571eb759169275, 0x294d29d2b70535c2, 0x917b814857401e17, 0x62662fb2f3c991ac, 0x79f1e4ad96187644, 0x033330feb1a52720
+, 0xbd47b86acebc2c7a, 0x3b024a4d3d80cd59, 0x3f7cbf7d849550f0, 0x096100e9294008d7, 0xc7af82857721f43d, 0x56b887ac5139449d, 0xd10bd4039e912870, 0x33beb08a842a8e90, 0x87c8dfbccb2fe900, 0x7a90420fc45fbc44, 0x6791942cc353a345, 0x3b0effaecee694df
+, 0x04e8c9e073409871, 0x4f4d7636807c20fa, 0xd18e2d2aac0313ba, 0x667e280e599cfe14, 0x320bcdc501de9bd9, 0x664d719ff3f21b61, 0xcc3f74b76ae33adb, 0x03a9a2aafa34c83d, 0x0d23ce80aadb5425, 0x145339f9d21c570d, 0x6b75744f914a80d7, 0x43a5014c39e4e138
+, 0x998dbcee7bdd901a, 0x57947f39495f32bb, 0xf56059e3319bbe99, 0x3bc4994a65dde695, 0x3a6a0724907fda80, 0x0c29e9c8ad3628c8, 0xccb5cdb265002293, 0x6958020a58c42b5f, 0x9305ffb62c004bce, 0x435693ee46df4dbd, 0x3d6a91c48edfa2d9, 0x5eb6c5aead81f9ee
+, 0x18d21bcf5d6c6c22, 0x776a796159d004e4, 0xd4e682c1d7c50682, 0x74a43ef8aa6f10ac, 0x3814c1afcf281a36, 0x67a869043fa91f53, 0x3a05ffbeffcd9d12, 0x306df432d01e70a6, 0x0479dc1177a001ad, 0x1d7f1ed77513bb46, 0x620e439ef27cf4da, 0x0305e9695d7e6d6a
+, 0x18ed490c2f047d26, 0x2736bd643fe18845, 0x2a6df51ef7e2f91b, 0x36092b30c2148682, 0xcc96c83abcfeec1b, 0x3311b4702a8c2f06, 0x1c5f3832bab190d0, 0x310525c2b117b70a, 0x29dabb5c767004ae, 0x5ec11c116f184a16, 0x552836a9f5fb3644, 0x1d5a4059363ea8b4
+, 0x72dbca149b93ffbd, 0x3c1d289fc2d0c1f7, 0xf971ef6b06f66644, 0x6b4a182041421df2, 0x6d3873ebc0770985, 0x608e97d929f4e3bb, 0x779406c23c5b5d38, 0x28240c3a41d50f26, 0x738f345d9c86f614, 0x4f921450765a43e2, 0xac7af980771fd227, 0x0e973b278f04ebaf
+, 0x4b2c2f08aef3f017, 0x2f19330a3ba91788, 0x3ed95d1e36bc1ef8, 0x47fb0e7939047451, 0x98d361e2c38631d2, 0x44d5f6872f59107f, 0xe269ed14842b1c6e, 0x733fda6a17b2c980, 0xef18527c8e02644b, 0x589ce78cbec2e786, 0xc008b0f4b753b426, 0x02d3220cc4f19b08
+, 0x6179bbec277adba8, 0x53b4ceb1c336b627, 0xbad8fb4a0c3acc6c, 0x0abba513cfce4b42, 0xedf9476431c8a33c, 0x1dfb6b10fa4a8b47, 0x46c853aee8ebe1e2, 0x435d63253d5af0fb, 0x7c89dd3705725f03, 0x41d641071bd827c6, 0xd41824a7943210c7, 0x04193681ef7225b2
+, 0xb3ac5bbb4d8c6aa3, 0x7e32d0d375e6b237, 0x104f5018343b4aa1, 0x5fd3942eba0aadc6, 0x6eab8bf2f0dcff52, 0x31f0ee40082ece81, 0xcbfee03e010140a5, 0x5d0a1e75fbdb21e8, 0x80723871c7fa1b50, 0x6b568b6713ea6c81, 0x399e8e2136641009, 0x175fd411a40e5fae
+, 0x97ce52d19aecd90b, 0x10f143209dd10b5a, 0x4740cb780142194f, 0x10291a9c8b5e8332, 0xca3fa44bfcca3a94, 0x367c1ad1e3af6245, 0xd3a10e1873cf9487, 0x27e7ba7fc8e94820, 0x57659476f2137021, 0x10cf15b50b37ff0c, 0xb6e84465788ae5ec, 0x291fb6a313b70f5a
+, 0xf659e2f4f58acb51, 0x0dcf8adcc9a8734a, 0x26b063dfb1c52641, 0x36444b6817de5e2c, 0x1b3b5e0a9d8bdbc5, 0x4b0c7d8aceaf44dd, 0xd56c0fad1a3e42f1, 0x36afe47d3090fd1d, 0xb4515a39b4f5c574, 0x2332e996909a6b64, 0xd6b37c4f4274a966, 0x28e573ece2a4e49f
+, 0x5a9127e25729123c, 0x49f05a5d6291cdb1, 0x8a8c2a6264ac972a, 0x68dc5bed456ad99c, 0xdbd370da095a5674, 0x7d4e30be182c8d08, 0xd3c3e493648d3d56, 0x2f350e48ac55bb01, 0x36bd3af828e54b5f, 0x77175e6b3ce1ec12, 0x62c74a65448aed37, 0x710702f44abfa9f4
+, 0x5c77705230a96599, 0x23f993b2da834f67, 0x216914fc7acc00ea, 0x7e3dabb7da741432, 0xbea90a587affb917, 0x42b70435b8e0143a, 0x5e189ab22fb3b46e, 0x1e99b561afde90ee, 0x127964877c8d984f, 0x57713a7a4c0ede11, 0x7aa735aec858cc14, 0x78ee8fb28824ce69
+, 0x4b5beaf8ccfe53c9, 0x422a5b0914fdabed, 0x2c6b70ae2ad66e2c, 0x71d0ba99cccaa3fd, 0x65cf9e22e374d0f2, 0x036d842d2e083123, 0x2208d7cbf3954b62, 0x0c0c9bdf4af96507, 0xb4224e5358a7a5b0, 0x6bb7e6655eccd0a6, 0x54bf7b1dc088f802, 0x3ad3f58b5e122f32
+, 0x2c5ba28176f9bc2b, 0x333e185aba7bc6e1, 0x791b66b0bb5a2809, 0x1f63835cc4452765, 0x6d8f8214b78c9f8f, 0x7822751a1bbb400f, 0x56f1f7b2613a78f8, 0x24d632a5b2148535, 0xc2f2567057212006, 0x66e7fb08ae50f655, 0x9636b311443f6d26, 0x14c341ba91c74f08
+, 0x06ccc8c1ec362067, 0x176e7a8dd392d321, 0x57946537088ad423, 0x47cd1bd34585ffa1, 0x5d785adecdab018e, 0x5d60a69419eaf671, 0x414866ea2de1cda9, 0x2490dd5f8bf898dc, 0x1e07fdcb590ed31e, 0x54b0da9a9b752d05, 0xba2c0f61612c1bfe, 0x55b6714a0e2b63d9
+, 0x887120b17166750d, 0x284dad13e49f8de9, 0xb696877fe7d9c17f, 0x11c14e0f3d549ddc, 0xd01c7df91b9a2648, 0x4f0f3fbe687166ec, 0x3e7bc5cb98976185, 0x314623fd053a6b2a, 0xcb08e882460abdb2, 0x6439329ec2551c1b, 0x6d53f1c1f5e1d6ac, 0x74bc5fc94eb49665
+, 0x1c41ed1eaffeff71, 0x659adfad4c4c34cd, 0xd786506b21b9f04f, 0x00237c2ae4e165ec, 0x42e95b7f34f0f048, 0x0357497e490ee153, 0xfdc33833181b846b, 0x505f5afce0e4d0bf, 0x2caf022af4cf5246, 0x22d31699a8137920, 0xbe5c6696a363aae4, 0x2b1fd627aa9467aa
+, 0xa592dd72accb8b41, 0x48cf99892f282cab, 0x8d8b05cf027d8506, 0x2c8be7690437a8bf, 0xe54aa9333bab3379, 0x30ee7fcad93db9c2, 0xd515b5eeca17c922, 0x7e1f71f6474a2296, 0xeefc6e15c018fa56, 0x5100484465116fa9, 0xaf42d12e5adab63f, 0x34bd5443f4fe2cdb
+, 0xd29174cf2ec15899, 0x1fec57a76345b46c, 0x78fb8f27e34ecf2d, 0x6f60fcdcdb60a1aa, 0xc075bea4bbf04bc2, 0x1d9c67f9fa3aacf8, 0x88ecd7fa1164d19a, 0x70fc181303495520, 0x95bfe4992cf9792a, 0x0e9f4bd7193bc838, 0xd6e651846034c8a3, 0x648ee8481135c70c
+, 0x4bb0ffaf074f1128, 0x096073f2cb90ce3e, 0x5bdb265942d83689, 0x06d169be17dbb0b4, 0xc18af96ba8ae57d9, 0x35e556cc706a07c6, 0x0975b00a998639c7, 0x294c18c8f43a0dd8, 0xfcbd934ae1b7129b, 0x5e7d65ea03249a7a, 0x405389da47b07c6b, 0x43bf3d0457135aae
+, 0x8003a9ff257314ed, 0x71b58ea594859cd1, 0x6d357b3613a76ac0, 0x24d7eba4668ede33, 0xea4cbbdf6861a9b4, 0x53917335fc3adf49, 0x51be94735b616146, 0x49783ba90a160a7f, 0x5b73c759ca1c41e0, 0x7292a78f0455ba50, 0x220a02661453c101, 0x6ab93105e597fde9
+, 0x2a126b1bb04ffdcb, 0x3ffee87ccd55ba33, 0xef2b29a70ec7d541, 0x594153dcd96da7ec, 0xcacda9506ad97c6f, 0x2e44eee6a9f769a7, 0xe9095b9e18f5ed28, 0x08b912c535c0d776, 0x2ede3267b1ae616b, 0x752f22127d87bfed, 0x31bd6b02e62c1a71, 0x57de87659d93391b
+, 0x1d25d96958565fc7, 0x3aac305992c04d1a, 0x6af3fba769aacac0, 0x4ac41cb2aad46d42, 0x37e2f042c8f28d2d, 0x3a6419f4c47ab329, 0x3a0d4ec358062f46, 0x464ac30c0a98a9d7, 0x62f89202b801bd94, 0x7b6f65c786666914, 0x79fa15934c93a958, 0x74fc078f740075d1
+, 0xb81db5835deb3346, 0x4c7ec52dbfdced1c, 0xf9b2114c5fc0bf35, 0x0b167372f3ccada8, 0x58329d5c8b3f69b7, 0x74ec233ef5c97ee0, 0x05e2539939384b2a, 0x0900229e6aa1b577, 0x006832b53fefc8e3, 0x43127e2e26b13ca4, 0xa2e2f46d7c6aa8bf, 0x46365943f5ff10ab
+, 0x3c6c29b8beb6a8d5, 0x63b35f434d6942ee, 0x13593c3fcb2d054d, 0x1edc1d7340239e24, 0x3a9833c8f81145d6, 0x69e48a8948311b13, 0x573827192ffcc585, 0x4649cf4349907ea8, 0xc4aef7df0e571c33, 0x5fe6e6b47c024d4f, 0xb34093d8c0104d06, 0x7a96a5237c5bcff9
+, 0x06a8197f456f7189, 0x32543617ee7ef0b6, 0x53f36a0e67639e02, 0x4fc92a6cf3f16bfc, 0x78b7ddbc3a0e08be, 0x11f7e5ed57628de5, 0x6f99c85f33981850, 0x18060a9d2d030eca, 0x868c2e0baa7c92f9, 0x700356a884fefc07, 0x34d002b615fe9298, 0x6f4afb047f629ba1
+, 0x2e2904cde130b85b, 0x6e44ce1271389ab0, 0xe54f613b461346e1, 0x15dbadfe2f6114df, 0x98782f69e5286d31, 0x5d4295bfefe02fc5, 0x4ebdbf48751891d0, 0x5f2aa0ed22073e68, 0xea1df3cea16db8d7, 0x0502d7f066bbcf3c, 0x10791f76f2c97d0c, 0x704e11982e3de40f
+, 0xb4b2a94515a22d93, 0x451459db0e132731, 0x448ebfc87ee7b60c, 0x582a5fb7016da865, 0x91abdf7c4e02c3bf, 0x417d634c6c57932e, 0x66bf5fb8ed18cd1f, 0x7852dde702fdf5f0, 0x97984438727cba69, 0x27478e4eefa16d89, 0x3759041c5a98a650, 0x342bba7ed5466161
+, 0xa9e61d20615509aa, 0x011541fde9c1934f, 0x980b3d46bc979e35, 0x21d2a8eb7e80b99b, 0xa667495619eb6b2c, 0x2411a3b8856d9d04, 0xe7633de364546641, 0x6491dfeb72ddd372, 0x4964002044bc1b89, 0x3822649e16e39469, 0x47d684cb846eb736, 0x4dded77288751b69
+, 0x7a529b1899d4314c, 0x6beb354938058e4d, 0x8b25ddc147391663, 0x16fccf4d8bcd31bf, 0x4abceb34c9dd40c5, 0x6e0a388ef0d61d07, 0x180e0e379a87bb71, 0x6c3f47dc5fb83058, 0x8e41bb2b320673f4, 0x7423b363380e5e99, 0x829035ffd6e2fd72, 0x09d1131ddcb35605
+, 0xa165208b3101ddd0, 0x7a8e5af9b06145bc, 0xc14aecfac1f27f6b, 0x5570a7f6d1308b7c, 0x572aedbfb63553b4, 0x5b7553e70b0cf0d4, 0x4a5a19ebfb24d5c9, 0x28c938bd1a416e34, 0xc4013452b47bf9d2, 0x3da5cbf4bc488f7d, 0xbbd64f11b0c8feeb, 0x6022eb64be7c2405
+, 0xa60deb1be21f0b22, 0x3a7356168a8b8519, 0x34f5f0c8ac6ddfb2, 0x530c7326b248c405, 0x12ff4933beaae62a, 0x514d048d51b3960c, 0xdff68f4907925c4b, 0x1b72f42a2134e8d1, 0x13ce04d657577056, 0x11319942c4c0d1d8, 0xdc272df738a82e0e, 0x5f71e7c238e1520a
+, 0x992f94f5977a2612, 0x2b32c7e56d0b92ea, 0xad04f1357923410a, 0x6f3ae142575d8ca9, 0xfa24c629ffd1feef, 0x72f9ecd4304fddfe, 0x4b7e451e74f60a86, 0x4bbcc003dcf8c512, 0x469562729f8953ed, 0x7ade0622bd347eb4, 0x33d0d668c3d4ebe7, 0x7ff063723f8f6e4f
+, 0x5d30d1a721b3826e, 0x20844ffb3b287e7f, 0xeb5f14a6743f83ee, 0x53049438ebd073d5, 0x39052a827a6ab3b7, 0x6ed83b54c70675fb, 0xb4d9d9613e2beeeb, 0x608a8a8368c973dd, 0x1b72d1ee64d5e13b, 0x07b4699bf13b8f4f, 0xf6f2b1751ef25f40, 0x44846cc8024c6666
+, 0xcb7f3528d52f554f, 0x574538746535a86c, 0xfd1e02e9d4fa0526, 0x3f3155e7033a7508, 0x29c8b60209e67fc4, 0x40c7e5ad4e482531, 0x71978d90624ad6d6, 0x234cf3eee35f4054, 0x4a95fd6a4cacc465, 0x7b4cb074a7bd95dd, 0xdb9ae6386b00b6be, 0x7a549ba09a2845e0
+, 0x1aa180378721b96d, 0x4df1a2264a12b86b, 0x1cd125b86cf367c0, 0x10e4cb910a53ec0a, 0xf2c856e33f92cb7f, 0x5df3478723ab964e, 0x672242171573d7aa, 0x163bec106efc4d8f, 0x98fc558dd17f4fd7, 0x6fdd60b571e01c11, 0xf39ab9d02dccab94, 0x5efcfa12667650f0
+, 0xb2f12bc96567d2c6, 0x217d68eaae7b00c9, 0xc3b49b6a8606aff2, 0x71bbf8b65354581e, 0x63aff727918977f1, 0x4df9119231013009, 0x12aa8c0fbc56c07d, 0x7d0c98336cb7d098, 0xdf85a5e856035d55, 0x79510ed5248b685c, 0x02393dc54ea4a837, 0x2897b89a19fa8820
+, 0x373dfa7c53c7b591, 0x171b1e823c0e496c, 0xdece7146a81ae8e8, 0x591444e3f8cd69b1, 0x22cd402c0cd03743, 0x418674f38ecc681f, 0xba60d34d4ee126fd, 0x643bb65ea814aa06, 0x5c4290d5848e7872, 0x6d610998f9e93b8f, 0xafe8cf89bb07a3fe, 0x24cc9857e16b9b08
+, 0xf3262742f0040111, 0x6f8cda5c9119b154, 0xa9bd0bc6a69ec571, 0x0fc37c0e0675ac0d, 0x8fe32b206326df07, 0x7d58c8aae3e554ce, 0x630d40f9f580a862, 0x5ee3457cf422266a, 0xdc528499a5c5932f, 0x35ec2987c1821a29, 0x74d1937b3bb957be, 0x5ce11f666ca47fd0
+, 0x59d0bdb7205640dc, 0x276e891bb11dea5f, 0xc5e6b84fd45c6e42, 0x37a65b3954779ded, 0x913990478f060107, 0x5cc0e070c3cc34ca, 0xe8c1cceb55d5d703, 0x4bf745f83d494eba, 0x8b5df3f2e67dc94d, 0x7e401abaeeb487a7, 0x9f6c786bfb299982, 0x6fbca80abdca1f54
+, 0xc48c1a5bfde03202, 0x6bf6187aad0a443d, 0xbe06c1c7b7376a84, 0x47c2c3c0daac3705, 0xa29fdcca968c9bfb, 0x796032784d4e9e8b, 0x989090c1f944f43f, 0x716b47bfb171dfcc, 0x15be4f57dd143cec, 0x0c84361b7ac8fc32, 0xc665980ac34ac1f2, 0x07223ca30c751c32
+, 0x14ff1f3f664c69a8, 0x48d8cfe9ba42e693, 0x31971a435a3f5958, 0x179e937bcb17a299, 0x1861d6d4bddb9edc, 0x4d7255b4739954d9, 0x72ffefa2f288c5a1, 0x271f6ae6b2bacd57, 0xd64615b2603436e1, 0x539dcdf23129332c, 0x867cbc4b7dc81555, 0x71f0e70928e7e51b
+, 0x45ce1954a0f2606f, 0x32ed2cab356a2b95, 0x9d25df84692ab1bc, 0x30952e64a694aa19, 0x1fc6aff3c561b38f, 0x2902e4f7ef8fe9ff, 0x8b02ae8f02d26ee4, 0x14df9c4e0649f9fc, 0x0c34d8f41f5a3e2a, 0x1b61ca82939c394f, 0x70249f2c8a749d32, 0x5b3236e70af648e4
+, 0x9e1251d7f9e9432c, 0x457951fbe9565baf, 0x0a440379434ef1b5, 0x75aa9f53ca042e60, 0x4b0c4ac943ee2d54, 0x7167e41975b49c93, 0x3a990746ecd2b107, 0x72380a0402a7e278, 0x6648f9ddb487fe8d, 0x6092169e2243fafe, 0xfaf3edd6e3c88272, 0x7658e1691a827df1
+, 0x0fd2ebf2cc42a82c, 0x3cd3834f40a028be, 0x282b732adb8e5b48, 0x76c0f7ca10f2cd50, 0x66518a6e96eea08b, 0x7a690d321d71c225, 0xe2269f534eb90999, 0x4636dbccb26a8bd1, 0x03028a43329e6314, 0x18d2dbaeeff6e541, 0xce19f78d2d41bc6b, 0x66291c2ea04d2157
+, 0xfcfe97891583070a, 0x4b1926a5edd26850, 0x78c36836b4cc3651, 0x62b94ceec2b64842, 0x21cb04c330365cf1, 0x5eb6af560aedf442, 0x2e15850e1d55caf8, 0x21db1b0bb6472faf, 0xa2efbd5ce213c1a8, 0x74f6ac58771ad19b, 0x7c99a294b0e8570c, 0x6a6ce6d51af9d05a
+, 0x2e6c2e5872b93b0f, 0x3205f62c9f40aa3a, 0xcdf35a6bce798a03, 0x4db20d3e22070a12, 0x9f2028b940dade88, 0x296fd84be5e35a91, 0x889b8a1e51e161e1, 0x4b4fe69c9afd2f4b, 0x21c106bcdafe2019, 0x570723c1f40f0581, 0xa4a361d92993bf37, 0x18c176424f45e2cf
+, 0x6a8b2bdea43e6787, 0x327624714b1abab5, 0x8a10157fe9d6427d, 0x3982349fa42685d8, 0x02ee5a1476c0d25e, 0x50a748f11fba0634, 0x590ac2318d6d72da, 0x19621e1cfea7f9a7, 0x8866083e0fcc1f6b, 0x6e425565bb54abb3, 0x6e231405abd84323, 0x0f67278ec2046475
+, 0x36d76f0f2fffb9e3, 0x04f83aebbe65353f, 0x29f5077c424d07da, 0x21f2f618eff3755a, 0x15d6a9194382e77d, 0x77039b46bcabbb19, 0x7d9987afe8917a0e, 0x09406550329fd520, 0x06b430950cf17a29, 0x3dc98856c9865460, 0x5541e6dd33cd88a4, 0x24a0a827ff7df833
+, 0xc380c9a400c0c6e3, 0x3dabd841b878954a, 0xdb9f33c32818484b, 0x7fe057414af3cb09, 0xa28be8591aaa3abb, 0x788722e72f2f76e3, 0x3729c4927c82c465, 0x3ec059f4c23f955a, 0xf3708e75cdaaaf44, 0x480aca385d24ffad, 0x789fd6e5ad970f7f, 0x1aa93fb9e9a44da1
+, 0x1a1e1d2b59d4c23b, 0x51de5bcee6d6dd67, 0xd5a1315d0f2269be, 0x262cfc0bbc9b5161, 0xe0803f17d119085c, 0x7a714db3fb8b0b28, 0x8d20ebcac9c3b3f1, 0x60ee95ea24e5ea21, 0x57a527c38b924408, 0x554ce4fe35402ff8, 0x2570e4089a1853a7, 0x18027db346cea232
+, 0x39c95b73138b771f, 0x0543053b064e63a5, 0xc46ed50ce378c8d5, 0x054a088e290e3125, 0x6ca991990c3cefd1, 0x66cbc43d6b83bfcd, 0x1f5f793eec64f068, 0x4bea5e182ebc05d0, 0x77a4946a6348baf1, 0x4483624037488358, 0x9baf0440f26dde16, 0x07255b2e05d633b5
+, 0x3d2aaff43835850f, 0x7e278ef2bd774c0b, 0x92576f683dc3f454, 0x3e1f0eab996068d6, 0x966a3e6c6cd525db, 0x5bba4a3d2e3ef8da, 0x1917dd86367605df, 0x6295c3c032930000, 0xfd806dc286ddc240, 0x3474a777f7568a3d, 0x2f7d661d50727383, 0x23690691df29a95f
+, 0x99f0903b1ead2980, 0x2357853150c1ae87, 0x24fe5a432e6a2a14, 0x4de45ae525fb672b, 0x5ede2f3e0bf18095, 0x41fccb370082cd43, 0x47d40d37f6bc91c4, 0x7c25b78728543a12, 0x72a235fb66039a6c, 0x798d9009a9cada0f, 0x09c3f66e9d19974a, 0x35e93ac050d0cc7a
+, 0xf47374fbc5a79767, 0x339af4bee859c5ac, 0x7410d5a43eea7e1e, 0x318da1d626d84355, 0xe822242a19ddd420, 0x3863ec312f3ca452, 0xb859cced3ed694c8, 0x27bc88b877bb21bd, 0x7293e297b9f43c1b, 0x3690067a5bc04b7f, 0xc5f92172cbf4e172, 0x4a21515f8c98f85c
+, 0xe152beef50119c58, 0x6981534fb87579bf, 0x867a4d30e1334551, 0x26d1eb914745ef5b, 0x5d92de78af94e3ae, 0x60fe6a75a4229ba0, 0x055eefc5830734d7, 0x0f0df550f553acbf, 0xe940c2bbdd39a340, 0x0e0ba6b03c2e0ab2, 0xc7dbd6610020d1ae, 0x0c49b25a4fca0939
+, 0xa36a0703387a6bbd, 0x51a9dbcff37c6d32, 0xd0a30aeda64a4086, 0x75a638cdad41885e, 0x43d18bfaa3640c8e, 0x4def0e94505ad38e, 0x7534aeb649fe4083, 0x4151c79e331a509a, 0x0bf840f4828d61d7, 0x5b8ce84c1c9df7bd, 0x09e7a8fc8b7b581d, 0x52d76f62b270aa20
+, 0x0903c7011fb18650, 0x322f883af820de3c, 0x95e6aa430bac1236, 0x0a7f2b161c5376b4, 0x78a8afcea4b3b7b1, 0x0766d527277dad34, 0x0400877f6bf1f083, 0x077d03f96c146464, 0x62ae891b704eaa50, 0x79313704ecd3524a, 0xb5428d46826c3856, 0x593536d2f856c59d
+, 0xe53db0eb7971a7fa, 0x017b16bcdb1684d3, 0x588860043bcb887b, 0x53464ec95c95a966, 0x23ffcaec72341a7d, 0x39c752df5de58405, 0xce6b281614f6c60f, 0x01584fb24126c2a8, 0x055d7373c5fe0941, 0x7ec3fd924e9707d8, 0xf2749be7d5e965d4, 0x0e4f95298b402f70
+, 0x8410ea7a8a060f1a, 0x5da4392d11dbb39c, 0xbd32771b1fa6fd52, 0x6e49009000d19226, 0x9d317b203244050b, 0x67807c87d2467c73, 0x6b9e656a173be910, 0x52cee3c1f7502b9c, 0x1aa3e439f1cfe551, 0x154b2d111be02f2e, 0xbc17ca9b70d73e47, 0x6d6dae02b61f77b9
+, 0x9d50e636ec1e3b16, 0x29edf6f0e38e0fca, 0x7824bec2da9a8547, 0x2b32b6c06c85c11b, 0xce011ac123cd9b95, 0x76193689275705e8, 0x3b0577633b9b4978, 0x63cc33a594e4de2d, 0xd0afb6d6e8b9c78b, 0x24002cb1a9ce365f, 0x723ddf1000721068, 0x3b34427f455a000d
+, 0x832a9e51c132c19e, 0x23d785c0499510ad, 0x962899c5cfafd16e, 0x211250f75c0a9b7e, 0x792795c44cf6bb89, 0x0538a50351b9152d, 0x2ce3c1052457936c, 0x382c6eb4880fb5b7, 0x678c1b2c16f0f142, 0x5afad74e9efd2902, 0x750fe01da76c3278, 0x3ebbeff865c3b923
+, 0x5f6749a4a928b674, 0x34da08a2134caf97, 0x4d51bfd3ada33f42, 0x7f160636a80d0d4a, 0xf12443d0f03ee2ef, 0x2f88b1a57bbeaefc, 0x121ee23e7846de51, 0x64f1f8ed35597b8c, 0xc82bdb9a80e1d409, 0x796c7ca48258faed, 0x85cda537007195e9, 0x392af02aa5c5bda0
+, 0x29058690bbc61504, 0x5a17497a13b99db7, 0x8051addc870d67b8, 0x61873909bee5aa86, 0xeeeb997593f7229e, 0x4a2654aff7f0eadc, 0xca1ac9671910e946, 0x7bea0f6ec61e167e, 0x74ec2e931965ed97, 0x67e490efda55b880, 0xf4a697ab4d5298a0, 0x7750c9668714b22c
+, 0x195fa15fd553dcec, 0x58f54cd3f41649f4, 0x09ff7366d9a99c87, 0x10d7958ff678bea1, 0xdf92cb86986d3656, 0x78414c22639bc837, 0x33d851b277eed01d, 0x681d530959da0f58, 0x013648f9d121684f, 0x1a631a624f6d6326, 0xfa6e2755d6aba79a, 0x35060e53c41bd96b
+, 0xbc34cc630d462774, 0x2ab72fe6657d0ec2, 0xe2767291af51706b, 0x2e5c7d0511470c8a, 0x90be57a8d239c3cc, 0x673e0bc4d8ba8313, 0xf6ed8b650f4bbb70, 0x0cc061c6e267fea5, 0xf7472074d420d1cf, 0x0fd9f24d7dd009c5, 0xcb46e8192d71ee96, 0x6da730941a44c80b
+, 0xf61a1594636ad06d, 0x5a7d880a7e2dec92, 0x3a31e0b85ca76dc4, 0x3c80a5cf43e96197, 0x66db55298c3e4675, 0x0dbfce22cac8f6e2, 0x0ce47b47bd746323, 0x5efa5d1713576dc1, 0x84f018d564f11654, 0x4c9d50fbca2c5ff4, 0x4044d4f43a616369, 0x7ee9a4b4f11e4ac4
+, 0x73ea9255d5bfecee, 0x7828b3df430090f4, 0x46fd0668b28bec3c, 0x27ccc64b041e3d16, 0x5346752c112d768b, 0x24e77e25b06970f7, 0xbae14ecd497a519c, 0x0e49ced328eb29f2, 0xe7e8b5dffc6150f6, 0x662f257af8930103, 0xae7f8a0e7e55a28e, 0x08e0071e71aa6986
+, 0x0d76351cc3f7d4bd, 0x2b285396ccf8cdac, 0x2774c19678048c69, 0x09e70dcf7027d5f5, 0xfb6411272c73f41d, 0x12afe9776b4ee738, 0x172879d3df030500, 0x0da77cb136b65551, 0xc6e81f71e75f2b61, 0x1cf6c76df0926464, 0x21b1cf90a64850bf, 0x172655446dcd102e
+, 0xc6628d002a212d46, 0x5e4180a0e1d20f87, 0x8b7ba91a41dc7994, 0x5e98a4d7bae2b7f5, 0x1d5b938cd84c10a5, 0x17b3799e50986f43, 0xbfeab114d7015370, 0x6f67c958be07a8ce, 0x1c121e92fd4790dd, 0x63885a00b3d89030, 0xae134fc8e170c383, 0x5d93a269c162b029
+, 0x5511e3c371675685, 0x339248e45c041128, 0x73164ed6eb8b2459, 0x5fe28c3b75c786fb, 0x7786de580b9376f9, 0x401c3b1d62479c24, 0x0123ca57638512c8, 0x643c5a7e61e2b212, 0x33da624fd70c26aa, 0x2993d1ad3207bac6, 0x2c30ea16678effcd, 0x1cd8154c92292e54
+, 0x08e65e692be3ab7c, 0x3a6b411e2ccf1ca9, 0x027e54029dfb7747, 0x4ef18d6e007ec6aa, 0x1703d1b1560a278e, 0x23eb3ff0c72be441, 0x17d256e39fe03069, 0x67edfb397aae61fd, 0x1cefada73801ae60, 0x75ccfeab352355c4, 0x18166578adf8e496, 0x177848c0fe327fbc
+, 0x8dfe7d740765a3a9, 0x537a8f3eaf02fe1c, 0x3571ba484c7f19f3, 0x4326b80e23ec18fa, 0x9d983d76186a1d98, 0x7f057695ce21b9d0, 0xb98da01c63514722, 0x1a6247f34d17b732, 0xca33c47e13f22567, 0x106d93a670326526, 0x0bdf04d552454ab2, 0x298a1b142ec9f1d3
+, 0xb54b0971110f765d, 0x4da04e8f948799a3, 0x873955f4fdf9ce43, 0x062f455719a7314d, 0x0384b3a58f970701, 0x62c7d58dea7caa2a, 0x50a8d721ebf8fa40, 0x50a064c543b9e8dd, 0x3975729bb9142ca5, 0x7ceeb800feb72c91, 0xe3add014d153fc7d, 0x4079363f93b07cdb
+, 0x57abc38941f30911, 0x498d225e5047aa59, 0xc982d3f88ea02b06, 0x4eb2a39fc5aa46f8, 0xdd458e539a3e9f0e, 0x24a33016879504fa, 0xcb21efda7e671bea, 0x51d269aa603ffd28, 0x2879ffd7175ae9a4, 0x44414d665cde1373, 0xa37b66937bf15b1f, 0x372e5692bf2452e6
+, 0xeedba1f233fde60e, 0x7352688d3e5d64a7, 0xb4f4631c054b3eac, 0x462fada4aca5d0bc, 0x2bee8701578008f0, 0x3d792d2bfc36657e, 0x7b488ca5b5178b83, 0x52e40947fea74fec, 0x52d6c8a3b9a76fe0, 0x4605f75e0eb9809a, 0x1e219c2b4eb61e83, 0x3c63659170bc5b92
+, 0xc6b516695f021cb5, 0x0cecd81607c52142, 0xb5f058486cf8a11f, 0x1897ac952e8c1da6, 0x3dcbabc02dd8e0d6, 0x0c0544ea70f131f5, 0x0c2ffb193e090ac5, 0x271ed5af0338d81c, 0xb4fd6e0931dc2555, 0x197b32a08595b109, 0x76af4e970001061c, 0x7fb3baab0f486eeb
+, 0xb9198327d1e2e826, 0x46ae3fe6e2adaf59, 0xc236cf879c191c80, 0x0d1853c01b1b2a54, 0x9b408bb231d121b2, 0x6029a2a868b5a389, 0xcb004c557aceda60, 0x78cbefba0a13f55f, 0xa7f33ca2147fbe8a, 0x1e32667ea82818f7, 0x2ee08f5915ef9c29, 0x523bde2c1e55d913
+, 0xa5e6e173cf14b9b2, 0x169c3a84bdce8f7c, 0x1cec5ab463c29e1d, 0x1ac7379247d880c2, 0x562074ca82b54c9f, 0x38f0f36f010a5349, 0x9586e4ad5162349c, 0x4ecc656a9227a8d9, 0x09314c8d22043a86, 0x633c361d5883ddbe, 0x276e455a7303ceb1, 0x22556acd02c8ee40
+, 0x5dd50e7ce5ce22f7, 0x4f9dc6855ebca66f, 0xab50230e9da276d5, 0x25ad939f44d7604c, 0x56d26060e9a507bf, 0x659cfcf068de8f13, 0x0840400e2673cf85, 0x6efea49c3bde7c8e, 0x303ade504ae3dadc, 0x06faee23ca1bb9e8, 0xbeffca2b643925ab, 0x5bca2fd96e8e6443
+, 0x87d010396b7d8891, 0x5477330c16da6171, 0x1c02f23c9b54bd67, 0x7a0278abe63810d0, 0xcf41406cc8e60cfc, 0x3c73ef8d305158e9, 0x66d400f62a20c243, 0x6672806caed1b615, 0x481e9f8eb818528b, 0x348982bc298be4a7, 0x90e89f912906bcd7, 0x0c2f8af47d635261
+, 0xa3476aad50fb9889, 0x181d81c6a93b8c4f, 0x690209d9f34ac543, 0x30a34a96fb1a1076, 0x3abf9071076240b8, 0x4a2af25f0e04100c, 0x14d1d79c66326204, 0x50ec3562dbf80d88, 0xf8598cd428acea29, 0x72808ab57cdf5670, 0xb0918cdada5828db, 0x5f1a42fda0f97aef
+, 0x6af2a3d14a128bff, 0x618e8a11e9a2968f, 0xda009797b677590c, 0x4d7a7a826cf21a53, 0xe145bce87154ed19, 0x23d927ffacb65dda, 0x983bdfd07a8d224f, 0x192e30283f8b6b8f, 0x787c990b4260b76f, 0x60d5d7df43ee890b, 0x8d3ab3aafe310031, 0x7bb58cdb22995e50
+, 0x2b38d3b7a9aa949a, 0x424e17b2421557d3, 0x33016c6db1089a00, 0x3709e4ab60a98e14, 0xcc74ff51821b814d, 0x4a02cd832271575b, 0xa1e910a2ff810e23, 0x722c37a4509fa9f9, 0x108de5d4b2400f9a, 0x154ddc090476686a, 0x7d13fe8b28927f0a, 0x510b9b4c2d9804a4
+, 0xe55a969ac7c80169, 0x6ee4719cbf5ac71c, 0xd502797a88ec593a, 0x0641f356038e707e, 0x3b556d6eeff16ac9, 0x2ce17db9da1b0a55, 0x73d1cba0e391cc78, 0x3a8685fb5d5ee0e6, 0x6292c676d0643659, 0x56c1572902dd2291, 0x6082074dfb645ba5, 0x47bf60e59b8575d7
+, 0x11df9388644497ff, 0x42985d4f6cec089f, 0xdf9a26bfdc76c09f, 0x68416b28df513167, 0xf47fd3fca8309d78, 0x36953da7770bd235, 0x20f44c94511302bf, 0x0db7e8734cef9322, 0xcc38e7a0ee989565, 0x471131e4f3ceac83, 0xe03e9159a71045da, 0x4359122c267f4dce
+, 0xfc95770c054a5346, 0x03915d041748938a, 0x53160a5086ad1c83, 0x0d552e440facb04e, 0xc4f6c61bad5d4e08, 0x124d7b39596b8d33, 0x6d1aba4499e4a8f5, 0x2d16253f3c354762, 0xdf63ecba22b15f72, 0x2a98f2959ef5b458, 0x8d8b075ff38eb893, 0x0b83e845cdcec2ae
+, 0x15bfb81821df61cb, 0x1a1cc83181d79a19, 0x7046acf4dbce88d2, 0x15084ae93f2ce1eb, 0xea2788c64a3346b7, 0x3589bbfaaba2bc20, 0x244c9e8f23c93ad5, 0x005488527b14b727, 0x5d0f2d680184a50e, 0x452aa0da2aa09a47, 0x247d25a0ab526691, 0x318b57fbcaf6206c
+, 0xbc81099fba755922, 0x07f8c4c4b7220df7, 0x30df87c7a90172c7, 0x42504de97560917d, 0x1e820885c06312ee, 0x4a053f09af295a48, 0x00b0a5d7af3015f2, 0x42791b9fbba35087, 0xb372103a057761c0, 0x1eeff0a8cecb6b97, 0x81444d670c44a010, 0x2982476f13956699
+, 0xf2505e70b8ce2287, 0x3edad5066c57aa83, 0xe0c7de0c60e781f4, 0x0982a52368034822, 0x6bebbcaeaea4da1b, 0x4e1c5c950b32bade, 0xb3b88c30391f4bb6, 0x2073ce7926efec70, 0x779e90ca954b7b30, 0x3081dc444acd4af1, 0x6493134481eb32ec, 0x490622ccb8950842
+, 0x3633f5af0686c215, 0x21e0d9c3a5c222cf, 0x4244568628a8f8ce, 0x6e98b964e90162cb, 0xe7271688ffbfd896, 0x055c30cca31e7840, 0x96b252feeff2f0ec, 0x37b44942ed7a5d19, 0x5bac4b537bc1d94e, 0x4a6c589ab3ec0917, 0x6f5e3f52b373f54b, 0x6897c3f74d5c1366
+, 0x73a62cecd8930356, 0x70ab97b40cae0632, 0x5d64c91e10f05c44, 0x5214eea58d61b16c, 0xc8fd70dfb465b496, 0x3201c4b7db8e74e8, 0x3c06ac8163e32aad, 0x11e0809a75e2339e, 0xa12d79461d2ed166, 0x3531220fa7da471a, 0x89712f488e58c04d, 0x7ce5179f401fa66f
+, 0xbe52f5ca38c9b3de, 0x38df0793d58437f3, 0x64e3754b0c20552b, 0x554ca757dd5416a4, 0x363039eab059204b, 0x4dcaf295b63c8ae8, 0x1ee1559f2e9cf944, 0x70b9785d80229b4f, 0xfc226492fbc32098, 0x64c1eabe87ea744b, 0xb95ca12f0e36e16e, 0x36294878c09b86e3
+, 0x0b647f44bb9fbcfc, 0x49009d8269029e33, 0x188b6d82f7275ff2, 0x4fdc877b15a685ae, 0x93418e2023003678, 0x7eb3598f7701f990, 0x017dec85e6eed2d9, 0x1a69f34edb64a7ea, 0xbd7ab107d43ea8d1, 0x12dd47d08778b97b, 0x89050e558eba699d, 0x24bc34b56f717747
+, 0x7e77e2a3ced78b2d, 0x4d1c78d20a15da66, 0xcf5745534643daa7, 0x540bf83b5f390582, 0x38c518485669e099, 0x78851d62c12c96b4, 0x48aa91d886f671d8, 0x5b65a906613425e1, 0xee90c38815552671, 0x11748df54275346b, 0x74379f8540a88c8a, 0x042252ef8a12bc94
+, 0xd3368881eff71ae9, 0x26c77d749afa3339, 0xb6b251735b2ab96f, 0x0086090edd2dd08a, 0x9651182532f15d18, 0x6c3749290782df17, 0x0cad7584c22b2657, 0x683e4e8f6964557d, 0xfeb31408c8625cef, 0x008375ed967392ef, 0xbf33e63400ee84e7, 0x34956ead07e9ae36
+, 0x0a3b7b60ee809f03, 0x74a7931bd4272b91, 0x9a55ad17b20b8b0e, 0x63981f8d7238daf8, 0x08b1a184f3ea4873, 0x71b8e2f91f4e2881, 0x64fe441a67e40f7c, 0x4f6f2b0744ef9e7c, 0xceaf8360f7ba4105, 0x015857362e0f215d, 0xae1b3b206de391c7, 0x34ad158ae103b54f
+, 0x66e7a17168109762, 0x6b8c688f39459893, 0x34fdb803eebfb645, 0x392c8ac385e7c54e, 0x903cedac1cf2ce24, 0x46c2b2c829d7b6dc, 0x0b1105ac6b7965ea, 0x1811f8cf1d3a8914, 0xb4c0f919af756d54, 0x783d5e637a24e071, 0xb76fe5e9fb572480, 0x4279522a2e78188b
+, 0x599f56bd026bdbb6, 0x6523c335f453fdfc, 0x44dd2b029dcb120a, 0x23ea5daf26600f9f, 0x8910c121cc156d3e, 0x0f1176672c235359, 0xfdca3429e1472778, 0x1df79c11d0deddc9, 0x954446f856ca5794, 0x080b8b5c027cf295, 0xde8cfc8bac344408, 0x0b07f6a4c3d88228
+, 0xa020766b323f9d72, 0x4d0c1069778c5eb9, 0xc7fbe572de719733, 0x3a8a0edfdd01ae89, 0x0c88e52df14d6a3c, 0x43248beca6b1cdce, 0x6ab6f37d49d0db8c, 0x79d2e1a320a9ef79, 0x1b3379196da5ba6b, 0x29861e8233f1e4e1, 0x5c647f36cc743c5c, 0x161c74ab00054114
+, 0x44138a86ce1951fe, 0x6672ee85870c8fc4, 0x50b8c4b77b826d72, 0x48c2b35002b7a45d, 0x2757ea83316f9fac, 0x3742de026f1512c1, 0x626398b331d6dff9, 0x0da6590ec900ce84, 0xe1775a59f5ec06ca, 0x1e529277e9fabbec, 0x77f58f99d71aa53f, 0x6de661dfb0a7cedf
+, 0xa16ddf4fe5acb63d, 0x2dbf633ed1145d3e, 0xfec49967604405d2, 0x201a7df1cb492a35, 0x0c2a678635cfa39f, 0x0321a49ae6a8697b, 0x195a467134a026e6, 0x1af94b6d4b9b2447, 0xb1babe667764dbbc, 0x11adb6fd21b24df3, 0x6c935694f237f92e, 0x33afe5994905949c
+, 0x29755226b1e78a94, 0x72271944e2bc45b4, 0x55c519ed0b83bf8d, 0x761745bb518aed99, 0x70fc9ee160766eaf, 0x72126c91b1734a6f, 0xc71ce37c7b9d319c, 0x4334f12cc4813173, 0xa789370d92063b97, 0x4061d66a40891203, 0x4577f66c6bfa829a, 0x1905e5d3e0d934c7
+, 0xe897d0e9571674b7, 0x4fc52ee5a4a11181, 0xc0954b37d1b6cd42, 0x18420396244c118a, 0x9dc5267bc3be3e61, 0x175dde5f1ebb0cad, 0xf54e3cf8be5853ef, 0x493146f4eef3b56c, 0x6c2abfd665ed5595, 0x258cf6df0f5b95ac, 0xe17804b8342cc1e2, 0x4978992f3cfd0654
+, 0xb8066356dc8dc7f0, 0x515e2327dc92377e, 0x629910d008eebae1, 0x220c200696351479, 0x74eab0d040224313, 0x24fff43429f36f4c, 0x1fc5011230435111, 0x755b38602e33a9a7, 0xee77db2e31151bbe, 0x4993711e46e096b4, 0xdb56738e0eb53d9d, 0x45ded4d273e9d133
+, 0x4c40ebe55f6d81d4, 0x73e10d5cf571d8f8, 0x13b2686426f13525, 0x4cf66d408730b246, 0x6083b791b4456797, 0x14b772c0710338fd, 0xaf8f6d556a5ac512, 0x2c9af16ec3845136, 0x61b62ea566fa18e5, 0x0c4cc7ef41f905a8, 0xda1a813a47bf04ba, 0x66934220864a429f
+, 0x86542690029afa4e, 0x7f7080974ad29c6a, 0x30182a41e09d01a5, 0x320cedb0c57c29a5, 0x0536a682175f08a1, 0x259cb15430b29f4c, 0xcfdde5c5a597d6ef, 0x73b4094a848e44d9, 0xe0d7fa5e371c9837, 0x1e78afc2eb243659, 0x299c99a0cf8665fd, 0x7d7a87748dd52371
+, 0x009c5e87470cd93a, 0x0cd92149674d2279, 0x16f23b70c4f8cf72, 0x426747063e1bd9ee, 0x62acb03b06446ca2, 0x6876d802da2d36cc, 0x59bf249769bb255f, 0x45a538a604b3864f, 0xd774a55c3bde9e8f, 0x47d93a07a2ce74ae, 0x0e1e15fd53f79ff2, 0x2ab965efd3ad6ab6
+, 0xf8aa65e210986924, 0x388a0c8afc243c55, 0x37166dac6a6e3303, 0x072f5a69140a2df7, 0x4050187ba1063627, 0x41a41da3d610361a, 0x257f0fcf4c568813, 0x280625d24780a41a, 0x77240ebecd20c6db, 0x08f3f942c443fa97, 0x89778edda9dd3b7e, 0x62566a187c03c6ea
+, 0x69a847fde785ace1, 0x559632ba847ba680, 0x671d9cad2f126067, 0x7ad51c8d5e1dfef1, 0x7532d74f21cfaef2, 0x71e6b15b0705259f, 0xf338df153ce42ef8, 0x0ad0ddce40651de4, 0xbb8d57f2ec11b5cc, 0x118944d6044bf2cf, 0x9cfa7b1f904cd17a, 0x3ca6b311e3234412
+, 0xbb768bcd8d29e3e6, 0x29354288f82d1064, 0x4b10ddbb95af80e1, 0x252d1f367160d0c2, 0x3ab09286342932d0, 0x10fa640674866f03, 0xdddede35aa4c42d9, 0x6ceddcd87c028c71, 0xd77d73f7603905e4, 0x1a8114d2082b50b1, 0x2a2ae9a8b5d1846a, 0x12322f12e78d6719
+, 0x32269bdcd74cdf32, 0x544f94c42bec6be1, 0x6e74cb8f5220d351, 0x0529729b32c8017c, 0xccfd1ce17880a49e, 0x68243708dccf3959, 0xba7c94707e7541b9, 0x5af8a3b212e3af33, 0x2fb850956ddd3b2b, 0x39cfca02fefae36b, 0x01dbc255ba6249d2, 0x630f00294cd8d14c
+, 0x21e2c4ecce524eee, 0x3909bab429b57878, 0x3a12d4614ea8232e, 0x23fddc66f44a53ba, 0xa11cddfaa681489a, 0x03ccbbb515812f25, 0xb0f1565509660197, 0x64d2a7476b293536, 0xc20b09c5afa5e17a, 0x1bc565c78ff09305, 0x76ca5b8139e4cd7b, 0x106f35fd4cb906ca
+, 0x7c6441c106bac0ab, 0x33754a67b01a1a08, 0x6fbb3277d16a9985, 0x1325a7a9ca5c371e, 0x4acb5c5e9197f1cf, 0x666d5909ce1cd542, 0x60e0515c73f7eb30, 0x4080b9cad08fa4d5, 0xb4980b15bcfeb841, 0x73d3a7889d475d68, 0xc56c058dcb349fc5, 0x6fbe64242dede760
+, 0x52ee4fe70a645541, 0x1e83c6fb5ccaf1c8, 0x503d0050eb54d998, 0x709260b353b14ba1, 0x831a249ef5bb6737, 0x66d30f1a569740b9, 0x2b52f795f4c8abd7, 0x691387819924a1b8, 0x1ce529d9ae3f66bf, 0x5f57b423b4cbf6b6, 0x59af786bba1da5c7, 0x4fec06b0cb3e9531
+, 0xdf9aa703938032f6, 0x6ea9156726b5b7b1, 0x11b7b3a07b95474b, 0x16c6f58834fdbac2, 0xebd4d9e94ba8f0be, 0x48779be8794e6a2f, 0x1d4bd4edeca23efd, 0x0b7a40a781cf0015, 0xe66f0088775164ff, 0x7845027ab58cbfcb, 0x2e2aadc3d000b7ce, 0x1ba0d941f40d81c0
+, 0x9ac9a5f2907c1e09, 0x0fb800c87ccaf900, 0x0370e94d9e21040b, 0x5bc5c5b39943b024, 0x4f7e5199e728a0e6, 0x545d536730d81f2c, 0x14a24cd7382bb0d1, 0x7b2b181cb3f934b4, 0x004f363556545c93, 0x68314fb5f011f1a3, 0x0e5f5fcebf82e0bc, 0x416edd43190d11ca
+, 0x285a9125058baaa1, 0x43dc29273a76fbac, 0xe879134daccc2fe9, 0x64de62d4a9e6477f, 0xa00b5bb5207088b7, 0x3676beef9a17118b, 0x6711f32760f41475, 0x18915c8ec01ca78e, 0x5a4f47e1f6de4808, 0x592fb693ac66823b, 0xb32949bc4ee82a1e, 0x5a219a2085e330d1
+, 0x19ef35b7e314d9c1, 0x3488185efbd84cbe, 0xc03837422b18ad14, 0x05068d589dc3b9e5, 0xce61c4a7b668c8c8, 0x5b661914792ec4ff, 0xe804d372f141d795, 0x0045eee557850a11, 0x8f67d51546e0e754, 0x57a8082c7c995c4f, 0x25665eb1b5f32307, 0x2ff3bd07ce6dd154
+, 0xa07a271de7b99b16, 0x239234f87481c74e, 0xd1200e5bccf5d015, 0x7661ef03ee02492d, 0xb324fd0fcb25818f, 0x7230cf17a4cef926, 0x87688585efc8c5dc, 0x3dfc860db5ef029d, 0xd4e47ec511153308, 0x1734376b88585d17, 0x388074983baa808d, 0x3ce14fef4281d257
+, 0xb7a7ea42b7a04221, 0x5fd031c0fbd4ed79, 0xef10d51f6dded458, 0x5ab85243e84131bb, 0x259b505acdb49c80, 0x51ef061d908e55dc, 0x803187565355d7d2, 0x644c25b02d7c96e9, 0x2f14f6902507e767, 0x54b37b02127ef060, 0xfb816ce37f137fac, 0x7f029d5da17cc49c
+, 0x26e93f476caea2f3, 0x5800ea242acb2580, 0x3ae51b76253d7ac5, 0x1a3e4435712428f1, 0x328347742f4bb031, 0x4548ce1058bc981d, 0x3abdbe38c07e77a6, 0x29283170ec892e6f, 0x313b1e757edd5a58, 0x12d94589cc9587f2, 0x93aa0c717ed3560c, 0x4be9eb0d724c5cbe
+, 0xb293fabe399886a5, 0x57363cd998f8d40e, 0xba66c93f30bf320c, 0x0d0d4443d7df26a3, 0x67fd3bcea13fc250, 0x69ffe8e3eb9f5514, 0xa03e475742636cd0, 0x2cdc3096a8bc9a8b, 0x0f340627af909655, 0x2bc1a24c5b7ac358, 0x2c52d526cb914fbf, 0x68115abac983a4a7
+, 0x0434207770ab0198, 0x1ff56548f15c3924, 0x164f59ce2a73ceeb, 0x590bab2bb1cd127d, 0x82fef49ed3e6f7b2, 0x469ea07b33939a05, 0x962be225cfb38589, 0x38b2f9e3e0ab2a7b, 0x759d5479395a3926, 0x46271f0179eb48a1, 0x0f92dfb8def95a7b, 0x387f8eeda325cfe3
+, 0x9a26c895117a4591, 0x363b0b8c4f6965d0, 0x39b55e5d1a5ac018, 0x1e9d4b7baf1b9f45, 0x248733c314491379, 0x555d216270db466b, 0x9543c73167a4d13a, 0x720c6113672bc4be, 0x866124f710c64ffc, 0x2b9a5500644deb86, 0x8a164915e0339c1d, 0x284b0695669671dc
+, 0xbc82a541befcb5bb, 0x1d443e98043a580e, 0xdbac215a192156de, 0x372622ed7ac7af10, 0x3df1fc56930321cb, 0x50c10ed9a2d1e7db, 0x816a1eb338597f0b, 0x32a0bdaadd48f00a, 0x7e44991cee632519, 0x5855e1dfe9bdbe42, 0x5414e6cf1e1a2d26, 0x7f7a4a77128d4434
+, 0x1731c53c96ba58d7, 0x52820f40cf7f72e0, 0x5947bb6aaef082d5, 0x204734e3fbaa80c4, 0x911848ebeafd2849, 0x1b3504b859cc9630, 0x3d090dd779371a92, 0x05e66bbd50f053a0, 0x22d7ea68ffafb3b4, 0x18ecca2debfb8716, 0x140f1a325e89d4a6, 0x23f3f4e7e4c25530
+, 0x49d1ad0c648c835f, 0x244a7d10899c1a24, 0xc3ec514c60ebcd4d, 0x2cbc9c446dca4a71, 0x16ebe36f8a85ff8f, 0x2ce868e4f0308bce, 0x63dc81d1a2403bb7, 0x68f9ba48f396fc8c, 0xb3ffb2585231adff, 0x74c76c6837689c73, 0xf92a835d97877889, 0x3476d6166f0469fd
+, 0xaee646896d0943a4, 0x19ee0e3de2a65ffa, 0xe28d281ea2af465b, 0x4bb526dbf9838e1d, 0xe76ef5ceb8e5488f, 0x5031f8b717df2efc, 0xe81733a839a2b265, 0x6ad86c936ded142b, 0x816126a473b4a82d, 0x7059cf7281b1bafc, 0x17c5bb68789337ad, 0x596bf3fdd15dab4f
+, 0xb1fa7bdd17d42672, 0x4257501920efa75d, 0xee10cd65f3d3fd0a, 0x6c17252f04545f82, 0x60866f56f49f1065, 0x68881b40ac8d15f0, 0xf80811467efa91bb, 0x15057338a5492b5e, 0xd1215edc2bf9de4c, 0x262b5f798441813b, 0x188606cb3f3181fd, 0x28b356496a3f38cf
+, 0xf9c04bf2359b000b, 0x6cacbea4c06b1665, 0x65605e0c02697eca, 0x13b586a1f5a32a18, 0x769705d76cb6c0b1, 0x53685869d1f71b0a, 0x06b50926c5ca5693, 0x73445e1f58310a5e, 0x21591a6416342d13, 0x1734c1e26a6f3abd, 0x284cc5642e4aeb80, 0x5df3f7df11f1ddfe
+, 0x7a88013748da927f, 0x45de429468bef94f, 0x8644998391391961, 0x1822e8ae4c05a947, 0x91a10e7eba648037, 0x5687daae7869af95, 0xd3ac2a77ff87d68d, 0x5748e17097524e15, 0x7441535a8307c9b3, 0x5c644994140ad107, 0xaccc28820d116650, 0x1ff20210000c6084
+, 0x8c8121ac6e3c0e00, 0x309ef2ef9f886c2f, 0xa7db7eddd8ae74c7, 0x050db042260a9785, 0x1b92b1aae6ee17c3, 0x4a6a539dfcab6982, 0x9ff96fdbc13e749a, 0x231399041108b97a, 0xf394dc6b7e1a2e2d, 0x54af79e12e217064, 0x590f04dc74ec62a5, 0x2ad44e3f59b4e7cb
+, 0x2f6bbb3b3ad61e79, 0x7f01e1dd4ada67dd, 0x6e4ec1c4ddd796b6, 0x3ee9b7979b9c90e9, 0xa5d51755e1f02fde, 0x418c53fe52d46444, 0x9a96e15b2dc673c5, 0x7dfb42bf7a6c6189, 0x4d4ee63c834ee8da, 0x39c7fbb95c3461a1, 0x915e20ae4949544e, 0x35f76a4d19571091
+, 0x2028ebabfafb0981, 0x3e61a1f3ab786ce7, 0x550b6e2f17cfaaa1, 0x1f8f9202701bc15b, 0x1be87803bb917950, 0x43d35b97ccf8dfd4, 0x9e39d49d44fd2350, 0x10d40d0ea6a00f90, 0xed5c58cd142d4327, 0x15eec701672aea29, 0xef5dc3d8b2ec6bcd, 0x1cdca2328f5f8842
+, 0xbfd128e96a250029, 0x33c2be8db6effabf, 0x6f0ee668f299c0e9, 0x22936a855814d1a2, 0x0eb1d83ced132473, 0x7eadb21fb1a78571, 0xea8de135791a6a26, 0x319a0da2d852507c, 0x6560c8adbbf8d027, 0x110fa345ebc1ea4b, 0x9c63527edef7c79c, 0x518cb76b34087cc3
+, 0x6f0e98ab1fb5d006, 0x4a821594e3bd4163, 0xb0c920c729925a23, 0x5a2d5eb306844f14, 0x7a57519ca1e4770b, 0x4c59dfd4f3c90663, 0x1ea8af344633d796, 0x016ec042d9921dca, 0x9ddad895209d4c12, 0x3a62b6a5222865aa, 0x3309422ea64e461f, 0x2be0fc2631d42387
+, 0x36f354b2b66c1b64, 0x49c952b1a51c9ed3, 0xfc7a02bd38a5c453, 0x73e011f51e064f43, 0xca5398e079f4078a, 0x114e567c79d1c688, 0xad27089d300404e3, 0x58c3191e765814a4, 0x4997fe5b1f861ab2, 0x45df9df004acbded, 0x776289e4fcbcc70a, 0x3981bdcff0168479
+, 0x74b32364c34c6906, 0x34ed489b1f4de20c, 0xd45c19d5d8a0d0be, 0x2fbebf5e7a7b14c7, 0x8aa0924a43dbbcbb, 0x44bfbffffe02161a, 0x97ff2f4970f37646, 0x6060845606da93c4, 0x07e99d7589a2100e, 0x55063b5376210b09, 0xa856057245a47da1, 0x4fcf8bb3aa0f8e38
+, 0x38bed4704a5a92fb, 0x5c0d2ed645473f0f, 0xaa5f54b6f566ca67, 0x57a4f508dc71ef93, 0xe35948acbe099f14, 0x5a18f5528c0853dc, 0x749c0a2897ad875c, 0x51fe9e0abf53d061, 0x24acb02523a316df, 0x6765d040f7b68a27, 0x2bdeb66956229e2f, 0x70a5cfcc6a0600fb
+, 0x0e72f32bc7c6ef91, 0x18b828f242efbb23, 0x6f98ed652c54c68a, 0x327894712be10eb8, 0xb2ed0aee398f56d1, 0x1e62e68501f03f3b, 0x11681da1a0a3fd1b, 0x6868d1bf70f6b6cc, 0x016e926d5a15b923, 0x6e5a0377d6ed4332, 0xcecaaa1ffb996d7e, 0x42c6a76cf2879122
+, 0x8bc042ab6257ff28, 0x4a034d36e8155bbe, 0xc24f467f127ffa6f, 0x1821fdac0307b35e, 0xd389cd1589502980, 0x4638a61b58cbd9e4, 0xdf2f1578ca4b17ed, 0x3a33cd4c1da65375, 0xe2afb10644b107b8, 0x36b7354da09e4407, 0x0d4fbd5769ecc71e, 0x060264d30f97c51b
+, 0xcd9d9da6fb9174fe, 0x54ce833eb41204f9, 0x394cd85153c2db94, 0x65f551c5d7de83dc, 0xdacd48c85ac79c84, 0x2a1f41736f776a7d, 0x3cbcc7d3bd63edf9, 0x672303e567604859, 0xd4ebb045c7fd59e2, 0x394e949c5979b064, 0xacaefd01f5021c2c, 0x6419dcf8e3f24856
+, 0x7d758c0996805212, 0x44cd1e5f30531da6, 0x50d0c1c427dd0c0a, 0x047c523be992f45f, 0xc2026684340c95ea, 0x099f7fabb748fdfe, 0x6ed72e4519e2850c, 0x2f8666e832ca2e05, 0x3fc7af4d86d6ac6e, 0x661ccd7134cf3f5a, 0x30f00d05a8870006, 0x745d322a3c9e3b5c
+, 0x1b83c92179c2dd09, 0x3ac4dac46194ee41, 0xf3bdefdc77eacaa7, 0x502322aafbf83e3a, 0x507b65e66e909ed6, 0x4b45d6e612f0141a, 0x26f7d7d6803bbf14, 0x73fadd97932323df, 0xd7074340216d1d8f, 0x6b59b758d1e626fc, 0xda47e4906a87ae4f, 0x55f6b17e050aeba6
+, 0x5bbb993208538b99, 0x7b14174fccf88556, 0xcc075a14662c379d, 0x636c14f1ced633c6, 0x5460b80e34615d5d, 0x5cdb73e31546188c, 0x5c033f20d3229f7b, 0x3f335ae93848906a, 0x1198a771bc8dad03, 0x756626cbd0765a55, 0x20215498955ba506, 0x2f429f4e99a5c29b
+, 0x3140d32b5e61bb90, 0x35269c9227c62570, 0x00af60af62c66184, 0x712d9a0a158c8363, 0x4f765f357ac0ba5c, 0x1c9d34fcba9d93f5, 0xc32f4a6c8a8f4e87, 0x6ca9a945a03bd43c, 0x18331e43ef61b6a5, 0x439fa8f9bc9cc877, 0x2fdd2f2c6140b6b0, 0x2c0da529e317866b
+, 0x033431961131e9b5, 0x1a4b3c8497071498, 0xa2b9b382279b2cd4, 0x2d88498e5817fb45, 0x35166c4dcfba2812, 0x47bd680a444fbf27, 0x3ebfd5a895ed6e3c, 0x20ac63446e66273e, 0xedf9786f45d197c6, 0x3683b2ea82cf6cc2, 0xde7e9ed29163994f, 0x529ac2beb05ba114
+, 0xe6f5847db9802bdc, 0x090f4b972b3459db, 0x38a51eec486de000, 0x54f06db9260258fc, 0x9597295569364380, 0x631e2b267b842fc3, 0x483c1c73cabe0a82, 0x445edff9a0ac809b, 0x20cc37a1e9c06f37, 0x3554b70d1e95d714, 0x4f15e51907c668ac, 0x1efdd7442b45ab3d
+, 0x91d22a097edf258c, 0x753fa48c7eead2ab, 0xb33ac7f7ac98ccd3, 0x46144301f1595a3f, 0x9364e0da7cf88749, 0x15e1238a662faf42, 0x56fca99814fad4c0, 0x407eb0e902e22310, 0x76f6413d6c578421, 0x629fc8dccd73c5b6, 0x6c231c2576840240, 0x2cc82c724d136124
+, 0x3906b1ddd8136777, 0x72964a1937124a0f, 0xcd1cbbbcc7fca1be, 0x413bbc979883a344, 0xe64b5612d8607dd0, 0x1cddca371cf68046, 0xd16797df23d73934, 0x6101051dd6ffca3d, 0xf8663c76bd12749d, 0x32a965a5684b508c, 0x4a2508f580ca6299, 0x151228ed41b87185
+, 0x0de2f0ff941d25ab, 0x7b75990dcfc4d6c0, 0x457beeb73aba0c4c, 0x3f5c2b835e2b5a67, 0x2022d0375f2d5621, 0x1acd634b1ac5a8e8, 0x7a6d7df395abe272, 0x59126f016115a39f, 0x54aa9c6e238c01c3, 0x4859f7c1d609ac9c, 0xc16f8fe7e6cb78df, 0x446d22e44a53b52c
+, 0xbbe8099d4f31c942, 0x1e8af7dd3f48d3d0, 0x684438ef6c4e15bf, 0x0993eb87d6b7f0a3, 0xd0783be8ed7bc6e1, 0x5eb3d86ce30d7663, 0xaf8575d488d250f1, 0x3e68c073b4a0c515, 0x06b9d9e4746ddd8d, 0x254850d437d03f95, 0x0aa4aa7a85e0d327, 0x3c4855699afb3889
+, 0x895aef4d14433455, 0x2093b7cf6ad74850, 0xbf0e0a148028daf3, 0x580216532f199d35, 0x2ddeafbe63f00c38, 0x254aeb4a80190efe, 0x66a0921427e3030c, 0x2d67a6569f1e3441, 0x01ba4bef01aae6a6, 0x69493c0fb6162ae2, 0x033ec8424073229d, 0x139be2faffa9e5aa
+, 0xfc5c4f74168a82d9, 0x38badd730f05a4e3, 0xbe7b92fe14bab31b, 0x48c97343bee869d7, 0xd81b30788ee770f4, 0x6fd4aa91795c8326, 0xed0e7207aad7047d, 0x790002bbcbbee9c1, 0xe6f0a44d0753e8da, 0x417b87dd4ddb7b4b, 0xd75fb5086935a03e, 0x19c2f52210c5cf38
+, 0x9b9c95e3414145fe, 0x06f76931393d82a0, 0x0df43d526bf70ce8, 0x37eb6258a30a3cc9, 0x5c18b01ad440a4e0, 0x34e4459bfb6180d9, 0x00a02739187afac8, 0x18e1ebdfac9f9070, 0x26da9dfcaf73b997, 0x0997d0d93ca6c85d, 0xe9f6dd0b482f78bc, 0x44e210a165a9f54a
+, 0x01318390394e3e1f, 0x60392fbbfec45813, 0x7604a91822d78d54, 0x369bd55242a9ec71, 0x95cc09e2c59a0245, 0x72d974dd9337dcac, 0xf749000036854977, 0x3501c67246ba15de, 0x7f9db7bfd07e1ad5, 0x7fc33fd3d534e876, 0xa6816997599c536f, 0x5a0fb48fc1ae3d8c
+, 0xa931771321addc34, 0x3b39868bf00d360c, 0xea0d9b9a58ce6d6f, 0x25784b8ddba30346, 0x129e191d4a497ac5, 0x1c06cd9afb7914ed, 0x7d3060487ef831a6, 0x5f871ed8fcdd011f, 0xdc85d9506d9137f1, 0x6346970849b749f1, 0xe87ff26c92db545d, 0x279cc695cebed5a0
+, 0xbc34515a09b81c81, 0x66d103175d30a797, 0x92a4ce5265145696, 0x42d59d384be5a2b4, 0xb5af95466db5d6c6, 0x02d24cf3e8ca5eb0, 0x78997a2e55fd0bc9, 0x1bb1fbfc3ffa75f6, 0xefb0994ea214e35e, 0x4a55ff5663400eb8, 0x059401a8acbdd6dd, 0x1fd87a6ce45374a1
+, 0xb56f677c35206bcc, 0x2494e93df832de78, 0x0f145c2debaa1bf8, 0x508ac8bcf0f34b17, 0x36fde6a335873ce8, 0x12bce705f96209da, 0xa1293f45c1bae1c9, 0x7eb993277bf89836, 0x2eb8c2fc105e0073, 0x0251103433210004, 0x2e5679b816eb4e64, 0x5bec075557436c54
+, 0xc545f5a1f7b12551, 0x5faf44c991f41877, 0x33be3605c7500302, 0x69b508f3c05abc9d, 0xc237ef5418278941, 0x5e07077089a834d9, 0xaac90d88aa0af730, 0x2ebdab6b594641a2, 0x4a9da3901bb5fe54, 0x250a1df6aba0915f, 0xe55cdc5505e01024, 0x35062f0ddbe259c5
+, 0xf91308db0e1f1f18, 0x08d9be2b53f40f8f, 0x2b147259c7f2f7c8, 0x5c388713a276e443, 0x42acf11c39cffed9, 0x32411ad9de60ff4a, 0x0ee358bbb06b36dd, 0x1f56cb6416205a35, 0xcfd00e4912d9d3ff, 0x7302bf07d1c3bb8e, 0xc1ac77eb3d86158c, 0x269caed4f35d5a3b
+, 0x2d172fb01f09fb18, 0x090d526413258390, 0x49321e4be83f0c65, 0x27f221dcb9b906c6, 0x41322d124f61c186, 0x2ca8dadd3f786534, 0xeb14de80a79f7ded, 0x171f361894fb225e, 0x37ce7a08fb6cee0c, 0x2991743c5d0cf630, 0x1de158a5af5847e2, 0x5fd7e74e8a4b0abe
+, 0x13f126de674a137b, 0x5ea3958e1bd912b6, 0x78310c12a1d5a1ca, 0x799f0a37aba35eec, 0x9ca0a92defc73bf7, 0x7635083476b03ad8, 0x7f7154412543f82a, 0x7532511519aaf1ce, 0xb6e93c52a3fc4f80, 0x1f56c581df84442a, 0xfcbab39d66a14b81, 0x19ce3518cd46ed09
+, 0x67f3ba57001a674b, 0x7528046afd4d9cfa, 0x5eb251b84e067182, 0x595ab55fb3ff3994, 0x9f14cd9f192ac9a8, 0x2caf4631e1220124, 0x1dd732b95f03a2ce, 0x24e65ccc9bb97bf2, 0x582a59381c0b0588, 0x4ae69d1cf4085a6d, 0x694219647bbb8777, 0x3a916fddded22bc0
+, 0x717a8ebec6da0c92, 0x3c13347fc92921df, 0x22e829caa291284f, 0x02253633c2469dd8, 0x55dc6fd4598aaee3, 0x5f9dfd5530204fb0, 0x9529b2b68dab0929, 0x2f2b2f5cc894960e, 0xe92ec0d0a03656e3, 0x17cc640cec9677c9, 0x9e1a11d1a8e0ccb9, 0x1b7fb603d6e84906
+, 0xbcd5f8c96b0b67af, 0x2b38c914c9b914aa, 0x2168eda4fae7dfc0, 0x2898de2db4b5578b, 0x9de8cc12ae4f0b32, 0x37541ad5a8b92ee0, 0x5d900d61d82d140e, 0x75a8a37957ec534f, 0x6202776be079d013, 0x6dde680915664d24, 0x86608d46fa1bdcea, 0x2fd0c304e7174436
+, 0x9a745c0c88ab75bc, 0x58760d6bee60ff2d, 0x616a52e1d23c185e, 0x03c09970acdafdc6, 0x296e0b4c4f7ba49f, 0x4af2527c97e399d0, 0x20262181ba8594c7, 0x400a5f7a00cad303, 0x66992f9c535fb089, 0x3cbb5a187cadcf29, 0xdaef123861dfbc98, 0x105d424d7909a32f
+, 0x243f11d0c4425c6c, 0x4d9858ace45b66a8, 0xd597cf54be14f23c, 0x198ccb884d12f710, 0xd8fb4446b4f84f1c, 0x33e20bc67f4706e1, 0xfd4eb885a53b5829, 0x7098a8954a2b5b8e, 0xc9d9cf730caac36e, 0x4cfa8330ce3707ee, 0x626e7852e0adb733, 0x555910c2a8a281fd
+, 0x49faa3071296a89b, 0x0a0283a2716092da, 0x1442cab8ed63cfed, 0x68048066e5afc161, 0x11c900c1ee7f5a56, 0x15a9ae15d7f61332, 0x3cbbc890f9b0c985, 0x68bf443a60537156, 0xb101cea77763215d, 0x3bc55969d2e2853b, 0xba40573439acbcb8, 0x615562dee2b62995
+, 0x5a7a8e325ae25c2f, 0x34919c6b4957c89a, 0xc7232cd573847ae2, 0x6e4690c9634b85e5, 0x6697c07000985c1d, 0x5e21dc14b4277eeb, 0xcf533c0622ddfee4, 0x3b712da954e95fbe, 0x56f75d7c87dd493b, 0x05c14e091776bc8d, 0x0e7d1a9b4ba598a3, 0x1fc77c8aee72416e
+, 0xfb5000023089417b, 0x795328d201766a15, 0x285ce2ea5d3f121c, 0x2d2abf3b03308ddd, 0x4110f7896085d207, 0x277d24d039a43df1, 0xb552faadde35c688, 0x610dac99c71f26b5, 0xb7b879f2a64af5ac, 0x4bfac7285b99e5c2, 0xea882d7d77297cfc, 0x41d823cbfce36bab
+, 0x7aa389b9b6d8b393, 0x7f2e8fbe46293741, 0x7c8bf446dae4dd2b, 0x7ef60aba27a79e7f, 0xe5aede4a5f608a24, 0x77572c2b349e2f37, 0x586a39b4a8ace1bb, 0x43f12fd72eec8743, 0x1677b0fe7c6ad197, 0x52e49d84c5fa7b3f, 0x7b37e7a7efb66932, 0x046148e97e4209c7
+, 0x8abc5f4dc5ce493e, 0x7d73f8457057a1e4, 0x049498a6918d2a2b, 0x2bb9693d0aa05382, 0xfced27696e9c204d, 0x623c36e3ae46a8d9, 0x14c65e6db74e9552, 0x56c517ce03bd1064, 0xb6542a50a7fb3e33, 0x16ef5b878c9a6755, 0x978beea0de1bab8d, 0x53698b3ffcf1642e
+, 0xc967b5a51b94f60d, 0x4cc1294d0a2aa1eb, 0xdb96bcdda856a314, 0x734aded24e188a23, 0xa0bf2f59d78e9571, 0x4ffcda8bef3162e9, 0x42af1c6efead221a, 0x14c8bdc709611c62, 0xddac9011e6ab04dc, 0x346e5884359509c5, 0x2884eccd19c85309, 0x42e27999b8c5b46c
+, 0xf22684d9448ca3f2, 0x332cd7d92c11570a, 0x5d6fc08e33232f7b, 0x4c53fbc2c9a66c73, 0xc157afb08f19a265, 0x11529271309f7cc8, 0x468ef590e9d60cee, 0x40b5298fde6c6526, 0xb33a156ddf8e2db1, 0x69ce77a6483d32f5, 0x92a8b5de4f989339, 0x1afb6fe28b7027f6
+, 0xa4ed6ce379df5cd5, 0x327935a57891f813, 0x75aaea885623b752, 0x2e1b0262d13928d1, 0x5aaac054f2e4d1cb, 0x6d564443dee78b7d, 0x511c8a87d920e93c, 0x39aa2d5bfad4d352, 0x622a27f23b282175, 0x2ab48aa45f7c8e8e, 0xba9b9f68507c672c, 0x678fc48fe04a46ac
+, 0x2ab42d14b7237907, 0x6ae59bb0f83270b1, 0x31e5f48424290df7, 0x47484473c36ba4b6, 0xa988b88f19a3d665, 0x74fa6cf539fed52d, 0xec7c203ac8ddd709, 0x3318831157d8652b, 0xa274e7f7dd4095fc, 0x190d1a5756ad2dd6, 0x5495bfec4a1dd03e, 0x0f7aeaf43be411b6
+, 0x36362e71d31a32b2, 0x7a68e9421d9902dd, 0x82f7d39323ae4be6, 0x507c6d01aba96672, 0x3357e5db386b748b, 0x2a1ebad92cda839f, 0x33cef19b962c8629, 0x3cb09e398d45ad73, 0xb20b23ac9203e0a2, 0x28da599ab1450a43, 0xbbb17e7b441412cd, 0x1c7dfafa01d41291
+, 0x2756d0f8c5d899d5, 0x5492c21550bea1bb, 0xcaf684eaf1908183, 0x71a31238fc8d0b64, 0xf1136642086a2f07, 0x0353c9b31ea38d35, 0x393dc87512a7e281, 0x5d0f757a67b8c1fd, 0xec1ba46238fe0c66, 0x100fd88db9bb733a, 0xbb0e635ef43aed16, 0x7043ab73a0cd2406
+, 0x926454dfb16ad4bd, 0x6684bf16fe482da6, 0x4b8fc8ecd52975e7, 0x7178442fd47c9c0d, 0x3bbbeeda3aed67e2, 0x074096d110cc3ebb, 0xbfa2afd35e22b845, 0x061486bf63fec85a, 0x8669c3ed167a5e7d, 0x6f9c1f6d1bd868cd, 0x2c1983054188dec0, 0x4bb0d2a77a2b94fe
+, 0xaf71d772b13873ea, 0x6d9ffc721f470293, 0x38b4503e2bb35e3a, 0x50cd17f2e98141ae, 0xb0978c7d30cf4069, 0x3d89b645ce0eef8f, 0x9871c57a75a47d12, 0x4344931bbc425ff5, 0x969b196f96b1f899, 0x08edbad46b332206, 0xb590b8651479188c, 0x67924538f3877113
+, 0xd5eddc97e334c6f4, 0x317cd5f032d22d6b, 0x43f6945eb750ac43, 0x3d52ed55b3b4b88d, 0xed01dba524b31577, 0x57627c43d63cc7a9, 0x032bf58d05366c71, 0x7a15e9908765aa39, 0x4049a85900879248, 0x5277d6298599e5c3, 0xe45302b5de837240, 0x54cf2ff35a09e0a1
+, 0x10106401774c5d17, 0x2a827c4be7044def, 0xe06990c05043a24a, 0x4a402ecb20a5579e, 0x0e6b68a39a384a18, 0x4e0501d23b6847b3, 0x1c601349d7d52607, 0x6d02f8b70ae74646, 0x6e8ad06a68cd4d93, 0x65e03937cc447500, 0xdc2fd84a1accffda, 0x137870d8dec168c4
+, 0xcb3170f016d3f05d, 0x3ff2b0f2f54efb7a, 0xc33d9f4bd00d42f7, 0x151bc318424440b7, 0x4fa503b8a4d92afc, 0x17d12ee52d89e0eb, 0x83db66c81f7fa300, 0x4f62ae1917038516, 0x7681e6b6212d535c, 0x2212cd263f5460fd, 0x40255fb811e16153, 0x0fabdd9f6725d1ab
+, 0x2141dbe27e514a8b, 0x16336dd2ce17a2de, 0x925edfdc37dd661c, 0x7b13bc6a69a6000a, 0x0e47651ada64cdbc, 0x38152ebe0c59e84b, 0xbbaaafac5ec5960f, 0x2abd2a125f0f8288, 0xb784cb296fadb285, 0x3f2130b6e3684203, 0x857e9701721f5faf, 0x5d438f39fbae651c
+, 0xab68ac948932e4a0, 0x527f602872f5bcf1, 0xc180f10f9919aeb5, 0x31aed5771765b634, 0xac60e79b242a45be, 0x3ffe7bb120ed3c69, 0xe98de596fff4a299, 0x2e15475947b59435, 0xe61f541a85fbda8c, 0x2a747dbe7d437f4c, 0x9a533f1f6b9717c2, 0x6537ff3259b259cb
+, 0x600ad0133e1e13ff, 0x429be833c44da73d, 0xc38951c8d0cc6840, 0x31f33f5f569d83d6, 0x5648daf61831c41b, 0x1396133c108188ef, 0x6857157930c58eb6, 0x03348c5e5166fd8e, 0xfda1031498197114, 0x6dd1616c34f558e0, 0x5e7c3d9fdb965519, 0x5f8bd74b53496d07
+, 0xb0b7f6eb041e0863, 0x2fc801b63a0f0fb8, 0xa97fca67c7a3c62e, 0x6a1aac18b8452fd8, 0x168728260dabaf97, 0x4be5ca063c6f568a, 0x46b73ee59b43cb5e, 0x50dd69fc1967aaec, 0x57a3488ca0fd77ad, 0x127b1297fc0c2dbf, 0x301f93e63a25cce2, 0x4a04038aa216a27a
+, 0x1cadd2941bf3edad, 0x73e8b7bac661bb46, 0xdb397ea651ed2dd0, 0x2ee32c6f34d46419, 0x5f56207480f49cc2, 0x462c6f4af32f7648, 0x294e61ba51d0375b, 0x12aae16f1bc35496, 0xf614195481515c41, 0x4275b73514a27e36, 0xd33df33fba880234, 0x48c05b0ccc0cc8d7
+, 0x048c077a3db90a4a, 0x30c23678f44aa2f9, 0xa85052748a9938a4, 0x36e61d2d21158bc0, 0xcba6ef3c05b72902, 0x0007926ba2560842, 0xae7bd13de4acf962, 0x2e45ce1c83269075, 0x7eb8b9e5f0527f6b, 0x14be3aa1a0281d1a, 0x2540d0d18746aa01, 0x44aca8add1ce1710
+, 0x58cc1e7f6245299c, 0x0f368e699705109e, 0x1fca2ffd97c27edb, 0x5d198b9b9abe2f69, 0x31889bcd09e701e8, 0x47bc394e13b31705, 0x233fbbe36dec47b0, 0x6aba1ad6b6c4701a, 0xd4c967b39566876a, 0x19aad3ec8a7c8e14, 0xa6ee731d145e19b5, 0x6fad45a85e40a673
+, 0x28a1741fd6135813, 0x35e5de405240c4e9, 0x00df1b5a09d366ea, 0x7b05749e58f33af2, 0xd870fd4e6aace9c5, 0x763fbfd21d1fbdde, 0x5cf891ccb28a0a70, 0x5a897d465965d99a, 0x0851f7f7495ca710, 0x5050f5d89adc69d8, 0xdb75c3713b2b6360, 0x4fe6a7c44ab2267d
+, 0x98986a665d3df508, 0x13c3b8596242c4ac, 0xb6f778bde2cd041f, 0x7840c397d4f3327f, 0x7f92f0bac8ae8b01, 0x41958e612952f0d0, 0x1f13b18e2f674439, 0x2aec8e5e0679d2ff, 0x4603ef9228422f89, 0x74d06590695afec0, 0x32e94dba07aaa25f, 0x4b5913b036df15f5
+, 0x090174188759afb0, 0x752f22be837707e6, 0x5c1ee1df1550024d, 0x1de9e063e191faee, 0xa5f4b4615223a90a, 0x1a9c97bd4718e1d9, 0xf088c730ca80c010, 0x1843d4fc5e0c2aff, 0xbb3e1636384755bc, 0x69ca18c7834410c2, 0xab79dd46ef4fef8a, 0x0580ef9446595259
+, 0xa882d001be54874e, 0x6a8849cf6dbe93f4, 0x3806f913d26814fe, 0x5a761646d12231d5, 0xdf30377422f368dc, 0x58ccf12fc18525c8, 0xc249c35389aa5168, 0x5f1534b9bc0e53e4, 0x9fd1220a6a2f74e2, 0x3918a9c04f4383af, 0xbde1451373b2e290, 0x4e08ce2ae7fc25e5
+, 0x2d8792cfc83b0890, 0x0a4ac5a8fe3da380, 0x2fb98d8278464447, 0x10812b07b7abff52, 0x8ed079428cb0a9b3, 0x3bb589e71ee8cd07, 0x2c40eadfe8a4670f, 0x2f712b2370cc5386, 0x58c1702958367b6b, 0x5ca6bcff53295321, 0x1c671ca34e9bec86, 0x30bd3c35f828026d
+, 0x97ad6fcee3b8a34f, 0x2397a4213f78cdf4, 0xb4dc230a338c0446, 0x2ea951a576494c8f, 0x5748b96530812181, 0x62192c5c9eddd66d, 0xeb80e424c7e747b6, 0x368dac42cb6eca89, 0xffe0220a55a9abae, 0x5172b2c82dfdf6c8, 0x7488cd384a4dc784, 0x3821a83fb5f19d0e
+, 0x8646fa274f301a02, 0x60740f0eaabc42a9, 0x62c5252a14953310, 0x42177c9ac377d810, 0xac7b325407bed510, 0x2d8a9a334da318bf, 0x5f9c6df37d11d28b, 0x589a52f46d322f64, 0x44a759737309ea3b, 0x55c3210f0b822163, 0x0c39d8fa31efe5e6, 0x78ef3ed2e258029e
+, 0xac55d36eeef2f807, 0x3cef9c7f6f66f61e, 0x9591de983fd76ea0, 0x0cd0e0fdd70774ac, 0x05d2fb027c02ec9f, 0x2dfbe4feb6d1cc08, 0xd11540b026c74259, 0x2da40f7a8a3af7e5, 0xf45bc7c408ec70b4, 0x6756869a748acc49, 0x3710ba10e03b98fa, 0x37cdab5e18100bda
+, 0x39dc3caf36aea2c6, 0x590b951b0740089b, 0x3d6c54be8d5cb273, 0x21cc13641c29ef83, 0x835b6761b150fb5d, 0x795e03dc61c9385a, 0xe24cad8717d63930, 0x4fdb9f0e8fbf3a55, 0x3704ab44411265c3, 0x396b3fb8a1962cd5, 0xc13d8b99cc291a09, 0x7078a3449af6b7fc
+, 0x28b66b6c69841662, 0x131a5103b3feae25, 0x6d052e17ee5e7ef4, 0x5f272a9d977ae3b2, 0x2795e149455748ad, 0x2ccff9e3a2da1ce2, 0xf4cddcd1cb6848be, 0x4d775e3348413cea, 0x96ff11cc4d6e5e4d, 0x40b5c2fbb487ed94, 0x9fd7ee5b68ef28c0, 0x0e4b117179c0078e
+, 0x2f197fe2a4e87c00, 0x6cd08347f9511fe0, 0x1dcbb53ec60a1d2d, 0x012d4100528a48a4, 0x168acb1d70ddaa06, 0x1e8d561da5260268, 0x7881f96283a95b4b, 0x3a285204b7ee6852, 0x8a686bfc9c3d3a21, 0x044fe492179582b8, 0xbff3d897c7aa9240, 0x64a3f00ed7d92200
+, 0x5bf54a0380c05e12, 0x50058265fe35228b, 0x8a0258fd8dc667b3, 0x643edc8ccf8e7755, 0x08fb8921c4e815f7, 0x4312122c065da339, 0x121ff64b7ec87e82, 0x72d03b985ee58cb6, 0x7fc89f28016e8c2c, 0x504011b345a33a7d, 0x00f20618036f92b5, 0x4d13a1fe4e579bee
+, 0xf16ad0ffd6089db3, 0x48612446c1491dea, 0x107b03c521eb57c7, 0x68ac11e1d9b699e0, 0x70a7088eea6eccbf, 0x6d5ad108b338e172, 0x68082d3f08e530d6, 0x1099d4c2f8bad543, 0x38a15ac85b00ff40, 0x743cb738776a95a7, 0x7a83c07878b1b591, 0x6177eff6e0de75fe
+, 0x74d77d1d1234922a, 0x1c8e361b624e7908, 0x2f44815f7ce8f87c, 0x0ff4360171c0b615, 0x7c22ede3bd1207c1, 0x416ecb4faf728458, 0x6a3e32619e635e9f, 0x5f6c60f6a2c9e660, 0x13255523265c44f9, 0x65556c2da53dbce3, 0xefa6d63ecf62168e, 0x719df3c3932f108c
+, 0xa72d3e61e6756f5c, 0x6bab90a8941986eb, 0xfd854eb3e5f9fe81, 0x6bbc2fb4abd4644f, 0x6baeec35c7d9a9c4, 0x5082818129c1ac86, 0x5ec0315ea7a5f198, 0x7b8e90d181b80e1f, 0x5936014ad294af8c, 0x7d9e7a3e0c5a0035, 0x27c59aebef808ba6, 0x111b20d1162bfc7c
+, 0xed2952fa9f817cf2, 0x5f81b8dda72c7849, 0xa64e2c68ef811951, 0x469ac8bdfd1e3d77, 0x210a6f55c23a5034, 0x33ecc871f25ee657, 0x0161c73b505eff32, 0x0b7d18e0516ede92, 0x9a33e557a96c329e, 0x2284810d7c3f8c66, 0xfbe7cd23bf0601b5, 0x68e4851b5fbb1a4d
+, 0x8340872bfcd2d547, 0x1ecdaba5048c85c3, 0xb7e6899e04c85339, 0x5fa6a73b56104ad8, 0x3b7023441b475bc3, 0x31d8e831273463b9, 0xed9152a13bb502f5, 0x7553c19b22f79da8, 0xc6c1dbdc9c341808, 0x7eaa2ce19490b796, 0x2869937e13bfcfeb, 0x3e00eb30c17ae979
+, 0x052bfa280fd76a5e, 0x113abfdd1530e410, 0x32dbc3ace21d9423, 0x547112613ada2476, 0x0505041da15e8f89, 0x35040168c3f8ff5c, 0x03055ddb6ee4e829, 0x44842eecc445df78, 0xc1cbed8fccd95a7a, 0x3b7383f86a188e1c, 0xfa78138825572707, 0x7904fa97dc272839
+, 0x18b1c25375607d0c, 0x447d8e0f9de9dc8d, 0xf0d2c58945937d9b, 0x3c1191e6594296d2, 0x0ab070f914cd243c, 0x37fb15c99005d1c4, 0x956eae2425479041, 0x0537245471e62fb2, 0xceca217615530af5, 0x33fb2cf681d2546e, 0x16962c5ae6109013, 0x1f358b97a61f0121
+, 0xe723386a86940abd, 0x2f0fb25c0a5a5e08, 0x33fc5141f47c9b2f, 0x3a7e5e0586542486, 0x78cb52c2f89bc043, 0x75aef4e1f71a307b, 0x4da2e677cad352ba, 0x7d15fb795e3a7bbd, 0x811628b0f0a51f01, 0x5427785394143550, 0x2a512cddeed7ca14, 0x7297f00f5c9a9ad7
+, 0xb5b20e90259a272e, 0x70c4b68c35dba0ff, 0x852b9a49244ed47b, 0x155c14202313cde4, 0x3252bba7c0697f8b, 0x5531423cfa4e42f6, 0xa7e0f1e9711b3b26, 0x755022fcafc09209, 0x2162e2c7bdfeeb52, 0x5c48099cd96c1bbd, 0xf8b726103fa77ab9, 0x4824c11e0c96e23b
+, 0xa1524c270b9a0a83, 0x6947ccf2d9a8788e, 0x44e1d80b5f7b27eb, 0x5c213720492250ea, 0x216b4789386e1765, 0x0e0b68198069ef72, 0xdd9926433d41d1ec, 0x220bea96f6057464, 0xb37e290125f6c342, 0x2726c63f3f08af6b, 0xe3e6b4880b3d4a7f, 0x3683bcc151eb5aaa
+, 0xfadfcbbefd9b6217, 0x62e606e4fb69ae3c, 0x47656e688ea1d2ec, 0x2d4cd80f21d2a007, 0x4122885bb12a2b59, 0x77aba7c46d6d573e, 0x9791e061567f3c9c, 0x7148bb24d06d2f83, 0x49f4861559e2a81e, 0x2cadeff2ea1825e0, 0x5c6cb1d4d0cce1a5, 0x3d6391d6c5c4a522
+, 0x6ebc324bfa8ad755, 0x4d64018bb17343bf, 0xab70c06cfc673dab, 0x5e8eca34bdfa06e7, 0xa406ef62aa8f2e6c, 0x3a3c35ca8f37c1de, 0x1a0837facd07d557, 0x42b799f606680017, 0x12556772f366d4c3, 0x15bacc0c84fff422, 0xc31f8b7bf5d62eac, 0x236a6223e59e138b
+, 0xcee8e5e227b77bd0, 0x34668bab66fc30f2, 0xabf2e2628c277b76, 0x2aae7662ab826720, 0xdbfeff5d14894df4, 0x25043ee6318b1ad3, 0xb05104b5511396f7, 0x44610e5acc384132, 0x289392db606329d9, 0x562f9ea63b68f8dc, 0x69663ac57a0089da, 0x70236b2988173446
+, 0xdfa043ad259c0532, 0x08d0aec27fd7a5d3, 0xbeaa996429d3779e, 0x5c2620770340cdaf, 0x6489857c9d5aed9e, 0x25ef51535251cc73, 0x700c9a80a6c9cb75, 0x10d4e5b42a3cb8d9, 0x383f1800805a5a4a, 0x1edb6d050491a309, 0x6d37a501680f7c5a, 0x2bb3420c5649f802
+, 0x357883d822d7c163, 0x0b83e04b02cd12ad, 0xfa03a48c73b50cb3, 0x1e8c77e5d35c96d8, 0x43f9ff3ed492b957, 0x67f44c85bea39994, 0x5b0c7451d4b75df9, 0x7898e6340c17ddc8, 0x24c396fe7136866b, 0x6e3fd88e8d4cb7b9, 0x8eed778c2ec4a2ce, 0x34c00ab651ac21f1
+, 0xdd9722164b4ef236, 0x6b0f59a878125b8d, 0x957d3b1d6f42eba8, 0x043b9b9276dbf82f, 0x31f4a26a709441b1, 0x3a6d3b5a95cf29b9, 0x62bc63f2ebe65e6f, 0x08f9e96cde643580, 0xb7a2bfe493af2983, 0x21f98f2c6ed20262, 0x45aa845b8b725b9e, 0x5b0f380b81d73945
+, 0x87a599d82caa066f, 0x0a6e7d64a62d1d64, 0x0c267fd34df59eb9, 0x646d19aa43e1456c, 0x82c394f74f8ce35c, 0x6fa258afd8d0615b, 0x11b7006cd42e4eaa, 0x3392708b5792ffa5, 0x0706cc56eca36e3b, 0x03a8111fb400b37c, 0x09a85c82ed006a97, 0x01d16985b51cfaf4
+, 0xfebfada3b6d17f48, 0x65494e2cc7353516, 0x3cd40e9c1ed88b45, 0x5df8cb270c24ac25, 0x37057d3e27ddc622, 0x13d72f6005971745, 0x4838466fdd241dfb, 0x561243dc44a1c15a, 0x39cd1a8fb246fcb7, 0x267a86bbea8266ba, 0x1093309fd8eba730, 0x18c2ad61b2dc62b5
+, 0xcdeefdccd4e15b66, 0x2a6d45ca470a4a37, 0x7148ac6c7722e68d, 0x08494383e13945f8, 0x1d22637b56cd61ae, 0x6ad99220f6717f08, 0xe2ac0474b4f8f995, 0x4c0a1a2d4d337d0a, 0x9a1dcc4686fd1290, 0x3bcc6f322fd671e4, 0xbd8b297d113951ea, 0x619f19a637af3ed9
+, 0xd1909f16ffd32a3a, 0x15d34fd62ed33bab, 0xbdfcc4dbeca30dd7, 0x64f58a512cf66111, 0xc99782824af61ad6, 0x023dd37798778bf3, 0xe301a4eb271d22a8, 0x1ba7362c76691948, 0xc0d438f14df6c511, 0x793fe66228a611fc, 0xe9930aac4b2f37d6, 0x44d5f73ccc2803f4
+, 0x120d7f01c27674ea, 0x5e1171ec648d93ce, 0x96f8c21eb912f2c3, 0x13dc0f072e12b68a, 0x2c44e397f1accf86, 0x0388bd749a61f685, 0xa2684d7aa09a2b09, 0x78cedd0d2e048fa1, 0xed3f76800fe05070, 0x3465daf93ed27bc2, 0xb0e1e3b1c2c3f01d, 0x272ed3dcc3053eee
+, 0x7380e18f08e249cd, 0x4a2ad541623c8f77, 0xb03ad95e3ef01deb, 0x025276d73000634f, 0x4921e9d93d6c90ff, 0x768f0e8671d65e5a, 0x13529ff06daea942, 0x24a12c7b7a26e24f, 0x7a372e37788defd5, 0x5c2fbbb2585f0e7a, 0x0a85fa016f4012bd, 0x29b2bd9954e69d97
+, 0xc91c8ec09a97e509, 0x72699205e1bdf17e, 0xb106737812adf7a2, 0x79495d6ca1cfb586, 0x4c1c677ac1de602b, 0x439b04b14b60f509, 0xe0797b14b02ae119, 0x3485c5880be2041c, 0x0c450e51f92ce83a, 0x599361579c0925e6, 0xaf1699096f5633ae, 0x1b6d692452b50449
+, 0x34f9ade1cf83da4d, 0x4dcc04b1c9eca9b7, 0x1292e488d0b94376, 0x1c96662694dd04bf, 0x15994ed6276c676f, 0x46e9f37aa5f231f9, 0xf293d83f438677e0, 0x69259003aa5da9cf, 0x5bde4d9041d23303, 0x47c66af75f810498, 0x47c9c0058e353e8f, 0x24433795019dc76c
+, 0x5e3f1de80b82194d, 0x687fd39f27efcf0a, 0x3cb74f6a67879041, 0x00a75901ab9a1932, 0x4c044b4d498f57eb, 0x6751c65519a11582, 0x8cf39d15582768df, 0x4c9c4fad1551a3a5, 0xe951099fb5a34ce1, 0x5ff32d4b22eb5ec0, 0x39589d2103d30bee, 0x5923d73ae443b569
+, 0xd7e3891ba62eb030, 0x1586808bbe5e573b, 0x485a65d25b3dd921, 0x138e505247095b6b, 0x1ff2ffb5edd0f193, 0x053be1f819f54a2d, 0xc4da664bb302ab37, 0x1c9f03c979efacc3, 0xc156d17e6e7cf03a, 0x1e9e5e38f96b22ed, 0x3623e81eae2e04dd, 0x4016ccfc961b750d
+, 0x21b0d1d8922026a9, 0x7a0d71925b40a426, 0x835e3da1c07aa5e4, 0x17d30a4795b0bf8a, 0xa7132fae76b4b844, 0x244bcf45e5cd53cb, 0xf56075722c4c01db, 0x7275eed6d53eb31d, 0xd5cb644e133d022e, 0x1203bb0dbb7d8b0b, 0x997055865be03960, 0x2084c57503135aa3
+, 0xa55f0fb7298742c1, 0x685c0471f7f73cc8, 0xa97de53a1bd0ea73, 0x73bffe36695fc134, 0x4c49ac7046dd2bde, 0x3d3b15a55b975f7f, 0xa6523649c1ae7e37, 0x6db243bffd7bf734, 0xa484cb9a47d40184, 0x4f09b6a9eb5ff91c, 0xa3ef7358b5127aab, 0x5c4d42e777c37c17
+, 0xc8ce0e4d7f62e1b5, 0x0e6c687f1f0f10ff, 0x8b764d8ce805f78d, 0x042096822dd79e15, 0x2a975fec850a67a7, 0x2a0de8bd591b5c73, 0x782bc2a074c8f21d, 0x13c23bd31f96f202, 0xfe0cae6bbfae0fdd, 0x2afc84a7b052dcc5, 0x5b5b1653dba7368e, 0x673d18c24aef1442
+, 0xd054be9d49c799c9, 0x7667fe5e57576981, 0x43f7d2da857ef277, 0x1ab269754b93a959, 0x2ec2aab4688cde61, 0x5b1cc5c0fde11b8e, 0x8f135715a3ef63aa, 0x6a75a985f0600fc8, 0xb564bcdc5bb5d32b, 0x76b43dc894dba8f0, 0xa2e9629e352ec793, 0x32e49d5f0ba184f4
+, 0xb9866357452c851f, 0x6822a5a7ec81b683, 0x58dbc9464fb63867, 0x1a3ba97fb2087bcc, 0x151b1688acb9f777, 0x478b7e27979be051, 0xa6eb870e6e5c067f, 0x464c30a2cd2ad301, 0xbbfb1916ba6c94e2, 0x1ecbdf9c574d511d, 0x55b98fc6de0c743d, 0x781c6c16e5d052f1
+, 0xf61eba18e6cd6903, 0x2180690ff8398f57, 0xd6c8653aaba41827, 0x5b07ad201fff2c84, 0x997c3fe1da999c38, 0x755bacf7bfc53c92, 0x745d82dcb89c41df, 0x7350d5c3299c18a4, 0xfd1950caeae3de27, 0x0a08cdc40af5fdf8, 0xd10cc960f7df827f, 0x5e0de48061de6921
+, 0xa56b966c31c870c6, 0x429d18936cbb5a19, 0x95f23fdd756f8df0, 0x71525695e4e7a143, 0x6cb23d434de521a3, 0x4473598a77eacf5f, 0xc4d8b94f19e45f85, 0x3204c9c0d94a995b, 0x5b2ace3afbbf747e, 0x5be7c70f44bd8191, 0x1254485433ece9ad, 0x25b119f031878213
+, 0x6bca423d62b60175, 0x2f8400fc0a12776d, 0xafce69951983edd4, 0x39a4aa654b8abc02, 0x4712ae17192d3781, 0x02b4906e60686005, 0x9e709f4b3a2d8625, 0x5c4ef221d2ca4c23, 0x6a11506942f8705c, 0x33cbbd37bdd96cd7, 0x8b30174c6e9d2011, 0x5332c1a334092d8c
+, 0x4498404b16fbc114, 0x44c70d03b464b972, 0x44d1c5c4ce5bbb70, 0x2650f0f3292b5baa, 0x4a50348e8820c08c, 0x56800119798d74db, 0xced3cdd4bb7b162f, 0x2fc8903c7d5bf2a7, 0x96acf4904a3f7019, 0x35554a43af8c04b9, 0x02a3434be12da974, 0x4511da962923b90b
+, 0x11d11aaa0da3d9a1, 0x0a532e946aa1bdfa, 0x011aa2861463f16d, 0x2938775f8c04f019, 0x5decbcc743de7e93, 0x466eac0e0aae5be1, 0xe7266f3f4c6b172f, 0x343af4b8d422ce4a, 0x64ed67e1edfd5041, 0x1e9ee9e1969a0e0c, 0xb36f709d436868cd, 0x60d2a627c287eba2
+, 0x9bca52e45653734a, 0x0a5f3d8c56880dec, 0x04f2ed24d00d0e7d, 0x73d8d44e89b72c97, 0x090afc4981af46cc, 0x6b741ef01136fdc8, 0x0e3ce38758da3d1e, 0x331fd333cd78b89d, 0x8693baa9acb967aa, 0x631ee0c39bf1563c, 0x3916c8e4af84eae6, 0x4850253f612be01b
+, 0x6f42c77c202daa9e, 0x15f010654bd5e368, 0x37c379f2ada4da08, 0x3a45d7f3daa1b634, 0x5d6389c2ea14d8ec, 0x1df9871daaf7ce1b, 0xb0162487806b91e6, 0x281efb1906ee173a, 0xbe695b660761753b, 0x239ac795b6636734, 0x0082f71c7d0dce24, 0x4cbf06f4765f4e17
+, 0x200885b04920db9e, 0x656952f3f9abd372, 0x067323e9934b3fc0, 0x75afb50ef3cd9c27, 0x5bbbcf824fd966f0, 0x75a9a572a4b1d2be, 0xbcc9ba58ad1a44b8, 0x4b6e08b3773331f7, 0x4d3d74739abe64ee, 0x542401714860390e, 0x68009517bac2f106, 0x41230692b0b6363c
+, 0x3e7fdea532090dfd, 0x59c73301834c92ad, 0x1116f8827e3f85ba, 0x426ce836d51ed42a, 0x6f9aea063644817b, 0x1aaec8a4ec61f372, 0xac6fe184182910e0, 0x597f61069d6e3096, 0x8f0c36a52f31af16, 0x1f50302e93ea1b3d, 0xe85664dd3129a64e, 0x4ac66458568b9c0b
+, 0xa5c60cbb3fb076ac, 0x0820923942c25b74, 0x1256d256f48534d8, 0x0ef03d60f7bd0470, 0x20cd154318d43615, 0x68ab8c20beb14fa2, 0xb96a93488420ee73, 0x02f268965e710ba7, 0x9cac348eed9da7b2, 0x4ac91ae3f6bc1aff, 0x5a5861f97e678466, 0x728f1b58b01137f9
+, 0xd104cdd7b8b6779b, 0x5b0ce4ab309ada73, 0xfe47a5dd5ab8b144, 0x36b9aad486c76319, 0x0889af83838733eb, 0x1fda28c4ca844940, 0x495196648b514d13, 0x2913d709d781c6dc, 0xd713462b3eee147c, 0x539009e0520f9b80, 0x77c46df7819bd203, 0x5bc379c31666af66
+, 0x1dc1793781b3ffcb, 0x3cf6cce17ec3ff4d, 0xb75d35ffb2def62e, 0x2405e158a1ca2ab2, 0xa1dad8c54683189b, 0x3bed39bcd850efb3, 0xc9a42010d298a827, 0x67b7f186d5154768, 0xa084ad32b85242e5, 0x6272b83171437584, 0xbea3e8f204b35ade, 0x33f4894e0017ca14
+, 0x3a3d6928b47bce9a, 0x34060ea7aae838cb, 0xbd98165534444085, 0x65daaf5dc9a123d8, 0x730bf7ecf51e03e5, 0x046c500eef6119b9, 0xc8755a9aa71dc8f6, 0x2f88a269ddd0afbb, 0x3ab9c3d91d44431d, 0x066d35097eb01f62, 0x001400d73c78800d, 0x009b53d1170327bc
+, 0x94542eec3538e328, 0x06c6e04e949906de, 0x837892646b60040a, 0x56ebad24e84e6b9e, 0x241b64fc3c1ca1d7, 0x32fa31aa5c835edb, 0x5ef5e230717a1825, 0x27320ddd8a3fcd5f, 0x707a537214f4b647, 0x45e24604ac0b7536, 0xf8cc2b5e248dba8d, 0x013e26d188dca9a6
+, 0x4b8243728c21ab8d, 0x363dd15aac292927, 0x2c379b02f5f1188a, 0x71c4f76925d52393, 0x1d8e363ca7cd669c, 0x45e501a102ba8bb8, 0xdf93d11075d7439b, 0x240d82cd7dd4cc10, 0x200fa62e49a00ae4, 0x4b4f75eca5228bc4, 0xa4d29ad0940c23eb, 0x29abed274e3e9794
+, 0xc1929048caed1049, 0x6edaa741042d4408, 0xeae9a3b30eacb37c, 0x18a3522029e64dc1, 0x34e7bb9ecd1f115d, 0x5c5a670ff045dfd6, 0x26ec5a7a01a5ec7a, 0x1a22f466cfb83e25, 0xb26533061b2a6777, 0x2204c00ea94350c4, 0x7d6f677e90417491, 0x7d51370e755df3b4
+, 0xb81167f2b546916a, 0x4d09f5653263860a, 0x32b019b3599b7560, 0x575ec936e5b822b8, 0xa0dfe310e476509c, 0x3634c823e030f235, 0xfdf60baf996fe6ae, 0x49801553b5b7ceca, 0x939cc86fd6810798, 0x7d2c0c69f2f20c2c, 0x24dc1da74958559b, 0x2e6fe3052bfcdb24
+, 0x36daa3458ba3a19d, 0x757d67ca9fc00a85, 0xc88cac36a14b99d1, 0x69b7626aa8261ff1, 0xed2e4f435054e54f, 0x457a83912b80c45d, 0x74994c4b7dc0a46c, 0x48d6742562c733fc, 0x53c5a973a4b31642, 0x2d241d8156dc4037, 0x9209577624bea00d, 0x33f36d896b9635e4
+, 0xa32bbe4634417370, 0x7d85aabea55b9006, 0xbeb4064ff44ca1d3, 0x77d816e17631b6b7, 0xb4e764371fc67865, 0x00daf1e15351fcce, 0x20acb55386b0329c, 0x45ae2fcfc325eec0, 0x938646924182ddb5, 0x1ee7c7a1099e2dda, 0x62f53b0cb82901d1, 0x3c86d8a18bc4c856
+, 0x4d9d243047feb12f, 0x612debdf2bd8e5c9, 0xde2854ed649d0170, 0x6ee2d1833618a860, 0xaf8c2996699da2db, 0x011eb02cb5f7572e, 0xe769d0552c6c5012, 0x3302f3eabd0d78f3, 0x80fda53cdb3dc5eb, 0x368e5cf4d8544a6d, 0x977e17db09bfe76f, 0x53e60f3b4ff0f67e
+, 0xc1827e9bb0f5e204, 0x05e32e4e60130364, 0x4db87584908b503c, 0x4843c2736a0a74ca, 0x700dbbfbbf61d22b, 0x4672363ee6c230e4, 0xf855a244f469447a, 0x1d8dd0b984f3cfc3, 0xc9773bb99d9e6926, 0x44695e8cee30e8b8, 0xa4759e5ca9dff4c8, 0x259a3a00195e42a4
+, 0x0d4fde78b9f6ea91, 0x2d0c568d674a751b, 0x31e3b12c399ae023, 0x5f9835c5eb298fb6, 0xa89d7c7ffa50518a, 0x79cf89a5fbde66b3, 0x098764114dd30b7d, 0x1984bfc6897a2eac, 0xc8ba4693f6694ae3, 0x1cbd834d67affbed, 0xcbd16b98ed229c31, 0x1a49c9214f0ac134
+, 0xa3b7713cf0be835b, 0x550e6f3021ee6588, 0x95cafafea734008d, 0x6fc0a03ffcba3013, 0xa556aa9912499d30, 0x29ed752286d571a6, 0xfec4255e1404b478, 0x570175367cfce428, 0x2ffa56f1281f0a4b, 0x6dea4d711c22a0fa, 0x618269ac876bd42f, 0x4a72a781ce9d2c40
+, 0xddc2fff8cc2af28e, 0x1c6cca5eac6d3e78, 0x69bf62570e8a65b2, 0x704bd3ba1ce33ff0, 0x73331d05e01cd0ca, 0x7091a8ebd2f76a04, 0x8e48e4f5ab922020, 0x6a2c128b925d9452, 0x78148efc40babd73, 0x66677273cdc782d3, 0x414b7f72f69359fc, 0x58197f076a789011
+, 0x27871f122e5d2bdb, 0x3f108b3ff2d34a67, 0xb9430f2ca3acb9d7, 0x4dba954c74c782d8, 0x3b0c5ebe16b6bf51, 0x758c603cf820c71d, 0x1aac2199894f38a7, 0x7b110d28ac07dae0, 0x4e0a45ba00fe32bf, 0x6158514162d046a9, 0x33058519ac1ab424, 0x0c6b5712460b380a
+, 0x8f82f7308fd4168e, 0x198390167d883da3, 0xddbc76d15f32d4c8, 0x45601051382618e3, 0x2beb4cc3c74a5e48, 0x3bf9a454c45d68ce, 0xd66977f2aa396a93, 0x505d557d34068b47, 0x0130bdf3cfedb977, 0x5b3d14fb49641032, 0x48c76f6efb7bfb11, 0x1fe4f7511b2563e3
+, 0x63f134592637269e, 0x2e9b1821c2c53ae4, 0x8cac0f4b52a4ffd9, 0x2f05ce5da5cfeff6, 0xfbd973d149191341, 0x1577e30bae78065c, 0xd2c87a7dcb0630e9, 0x6ed55f123c0369a5, 0xdfe5a52247f1a2fc, 0x313ae129b8da6790, 0x300455d439919a6c, 0x36b7fb565214715f
+, 0x25dbb0abc1d8b51d, 0x52b80d5d94b08b23, 0xb05a535d0fe358da, 0x39510c448471e2b2, 0x26c26cb933220ca9, 0x6708816ec948f86a, 0x64d0952d87d20d2a, 0x49f67e6c9c23dac4, 0x1a9116f9aff36edb, 0x08c0b5e1b3edfd4d, 0xb6e8d1faf75f190c, 0x2acca1574b958583
+, 0xe5a3c2c58ce6d26b, 0x5b5f65d038017544, 0xea8b227957b7ba6a, 0x0c14351524c071fd, 0x617c635f0015b2bc, 0x77b59402692f0168, 0xa989e250f5b67328, 0x1111fbcf1f68060d, 0xa2415796d216c107, 0x0d383acac9e13089, 0x1f12007688461167, 0x1d3d8fa7bab86c16
+, 0xeeb739948fdbce5c, 0x1f1345f000ad798e, 0x70412628e72b6bdf, 0x01445a36e791abcd, 0xa862e85604bb75fa, 0x698a733f5ad07629, 0x4144c7ce91c706d5, 0x0307e7604f7fc735, 0x10be629f0de86d0e, 0x0949010e93c5aa68, 0x94ead7875c0c44c3, 0x7f4d8a81a80eb4c8
+, 0x5b06bab0c65eff77, 0x6bbe45f04c91701c, 0xd3cc4734a3076635, 0x65123e0fe873a053, 0xd061c185e5e8d3e4, 0x4545e83c11097420, 0x081f34f512c0bc28, 0x3c974ef0487b1634, 0xeeb3e0dc40d69ab7, 0x66ba4da6fded25f5, 0x8aadb9203fe29310, 0x117f3e6ffbbf25e7
+, 0x43c0939e4c75e425, 0x7d0f9d1220eb7287, 0xf86e9b2eba7d044c, 0x46f169b308dfbc6b, 0xbc3f65051358d5c0, 0x4023803e8c4754ad, 0xcac366f05e63f53b, 0x6b821d3971eab8e9, 0x4def1e5df3441abc, 0x5e11f62a78ea30d1, 0xf62bd1f43c795cbb, 0x01869b1e93bbb0c7
+, 0xe58b292ed09ba7d3, 0x5dd698aa53c4099a, 0xbb23e5998842433f, 0x4a7d802fa95de370, 0xb7bd790a55d6d905, 0x500455779609c2c2, 0x9556e4e898395475, 0x5951121c4f749064, 0xe60ec6856e3d2b07, 0x59e4f943fc76e897, 0xa34bbc6a8b8611c4, 0x6d6b8d7d0839a1f9
+, 0x23d5c23361cb1261, 0x58fcd8ac4a06a392, 0x0a51cab714fbb98c, 0x6f23221bad370676, 0xad72c43216f24849, 0x23435ed0547ddac5, 0x162466244ed50a65, 0x78a89212bd6baa4d, 0xed5f2df608031985, 0x26cb5495463f0edf, 0xfa17cfcc91ea8e2d, 0x494dc0a0040d8a93
+, 0xd1a0fc53622e2926, 0x3ef3c63f5f98a37e, 0xcf465efe3d8ff994, 0x4983b15c657f28c9, 0xc1335e093a6526f8, 0x134d26dde0952b2c, 0x7b8e5b61936824cf, 0x60d80bb24e29c9d8, 0x215fb7648832591e, 0x31a2bf87e8f050cb, 0xa5bc040a29b18d1a, 0x0b8c0bad8210f4c6
+, 0x70b41def4758fc15, 0x58a96e7677b59494, 0x838d34ed355a81eb, 0x409210bf45bf0e6b, 0xc54429967774f485, 0x7a8b95bbf6329b95, 0x1fee32b760314876, 0x0c5cbf2ea1b8cf71, 0x6ed0f371a6110fab, 0x4dc4f4c3247c2e81, 0xa33d8b48f37d07d3, 0x01fc1547f9ff473a
+, 0xfc84060a6a9b25b8, 0x3ee102fbd648a0f4, 0xf8d243c444e114fc, 0x3351116b0fe71547, 0xcc2014a8a32f760e, 0x3e318db42d6844d5, 0x39e7f395a6180d80, 0x217d015f1268c180, 0x118a6ba638738d25, 0x6ee0753cd5c13ffb, 0xc60b18bbc5f20193, 0x58cf1cb1bcab78b4
+, 0xa3a5b97f224498fc, 0x134c48279affc6bc, 0x87b261e95719aa5d, 0x207ede5e0137e5c8, 0xd63aeccba7e436da, 0x4b6750e7b42a7cfc, 0xbf10d5598905833a, 0x7a6fae3ea4a14e11, 0x5ea2abbf6f07c473, 0x4407b263ee9eb6d5, 0x3567dfc68b240049, 0x6a85e8a16182e42e
+, 0x80bb0f3ca08b4ca4, 0x46381b913e166e7f, 0xe5403595747d6674, 0x78f4025e05549ab3, 0x91d9a2ffebe686a8, 0x6874a76c1040c8c4, 0xc110d51381ea2ab5, 0x5cd0645c9ec1b78c, 0x968f328f44d1e71d, 0x1adae18183eaec5f, 0x0a853dbcd15d3e17, 0x6cdfb5ee477076b3
+, 0x357740c00a92cef9, 0x37579189fc9325e9, 0xb04d18afc8c7860f, 0x77ce6d3b66e19d48, 0x46a61b6e9d50b201, 0x15e7c598813d5556, 0x7c54c072573eab2b, 0x6490c4706bc17abe, 0xb5e673415c1e9d27, 0x06e29d66b659f2b3, 0x70545de020191711, 0x29583026c808915a
+, 0x29eba6d56c945980, 0x5779f2f57858d48e, 0x96f5e52cdeb7b04f, 0x0eb212098039615f, 0x7468b7c7c4d34319, 0x6963594618807731, 0x62cd1f6b510a945b, 0x64092b55dd88f3a8, 0x7a52f01ffea94888, 0x4cc41b61cd137b12, 0xe4b341e4622dea75, 0x0c4b4093281766bf
+, 0x4ea5c0ea3db97659, 0x4b800050c71d5d47, 0x7524bbe7009b63d0, 0x66edf31334bde0f5, 0xdff1f3ba7c628c89, 0x0063e90ce908e54f, 0xb9e0c6d8cc6cd994, 0x46e1b3706d843828, 0x7b83c081037f2867, 0x2b431d5cb27b3176, 0xcfc45c9a10227448, 0x47db1acea993d37c
+, 0x2819373407b53262, 0x7140ce6df2c6493d, 0xc0f43fc59c5c9f3c, 0x6057df7909502561, 0xf1592a202b89d05d, 0x1ee751ae16d44018, 0x09c451f8df70759a, 0x4eb2ed52b6450e25, 0x18f5863e2cf0f828, 0x3423a0c0584de5a4, 0x5ee0b2de45fea094, 0x5fb076cfc0d58240
+, 0x655780e7cc3c49c2, 0x5e08b08b766c12ed, 0x0f8e64e2494d160a, 0x16979338e736609d, 0x75254bb1d2159f6d, 0x6368dbed287ad269, 0x8a809fca04b79509, 0x266dec195cd18527, 0xc8d62a1b949d4738, 0x7beb79b8033dc25d, 0x581f1400168ab777, 0x7a9524cabe8accae
+, 0xbe8d91406640e919, 0x2451b9a12e9ba226, 0xf4e01f4e5364c23e, 0x08717e9ff16325a6, 0x399c10fd5ac71953, 0x0df5703203f707fa, 0xf12f3547f82e6926, 0x7df392b0078f4ec5, 0x2cbb66af155af427, 0x34cbf6760ec59b5e, 0xc6b4fc998f6826df, 0x4af07e433a160668
+, 0xd99440f25dcfcdf5, 0x5d3db47b78b7ba01, 0x54ea75b90ac66834, 0x5c6507c9dce79dc0, 0x3ab80a2d7f1194a2, 0x2043289e5314c674, 0xe4d9d262b2c0c2db, 0x7a99cdaf3374debf, 0x8e996b248e62a224, 0x63cfbbb8529cb68b, 0x4d829288f2c1cb84, 0x1d15e795889c2a3c
+, 0x92973ec49f05cfa5, 0x0b3d32bd0beae898, 0xd83888457fde3fdd, 0x78534df6fe7a9010, 0x0ad5ea574a48518c, 0x1af69e80f358ffed, 0x4ac72d592d0a6f11, 0x72e66bdac8a5dd67, 0x28ecf4c5298a2d4f, 0x30ba880c779523ef, 0xf48240a50836737a, 0x217b76fa3c5463c5
+, 0x196a25e1233b9a66, 0x3571032795c53eb5, 0x71a678a1595bc88a, 0x7bfc7735b92bd263, 0xe8ce30128dfcc3c8, 0x50dbb8c2b2767645, 0x08d21aeed5ecb580, 0x204bdb5dd892f941, 0x4bafb46e4a9709a9, 0x454fe5104af08d6c, 0xe2ddbf4952cc0ff9, 0x5e669accda4a614d
+, 0x8be93efb27dc00b5, 0x72ddbd048c72a87c, 0x5d3b323a4b8bfeaf, 0x41c39293c6f8eaed, 0xce3d63f93bd0d42b, 0x1855060204631ff0, 0x83444da472e8242f, 0x41dc33cb6e37189b, 0xf66f477ec4eeefc1, 0x51ae81e3973b2096, 0x515f94cda8443c9f, 0x100878f6895a0d01
+, 0xba6b36f9be7fac4f, 0x73e03cb861ba9a3b, 0x084286cc3b389793, 0x042c5aee1e557452, 0x6563a064396226fb, 0x1ab4ceab396dc241, 0x81f79bf3a60ce9a0, 0x0907911f73d04192, 0x35ba3c928970ac43, 0x48aba7d42bdac742, 0x6c15d93897989a84, 0x6c7356b441d82c05
+, 0x46dc03f317ba041c, 0x0988a675a5507044, 0x662a1e14efcf952d, 0x15cecd293e232852, 0x696b6252cb2e45fe, 0x3ebab4800d0ad65e, 0xd71d78e303ee2c17, 0x60b03f0a5cae667e, 0x43d86a01695329bc, 0x410c7b2aeab76150, 0xabb765a995f3cc9b, 0x518782748b489d6a
+, 0x8486cc8e7e717e8a, 0x350d02a3df211249, 0x3c1e0e2bd8aa7a73, 0x5b8593844f6a637c, 0x1b02a834a7ee50a0, 0x0f69a4143284e4d9, 0x2a11a6abb2be286c, 0x28378e6d7b08a968, 0x814a0f751932a1e3, 0x09e72f17342c3d7c, 0xbad9b32d142f0b04, 0x152266e5014bb914
+, 0xfdd4e522f5b3068c, 0x09dce69340674b8f, 0xc50dd2ec478d6a2d, 0x78d81d9af38f6166, 0x67b8f4537625a4b7, 0x7ada1bf42ad2c53d, 0x7c0a4fc23440b7b1, 0x427c1b357a4fddb1, 0xf67fb9f1953bc03d, 0x2ae0aedca765891c, 0xd59b5e91dbd2be3e, 0x1b67fc19022bb427
+, 0x8d9d71d714ed2969, 0x308a28464aad0fbf, 0x19582b4c86dec9a8, 0x5424790d79fd2b77, 0x55db537977d5cf57, 0x0f63bb5ca1deaba9, 0x51e25dd4b1342061, 0x5a88346448bc1cfb, 0xbcd87afe8c5e386e, 0x2530b39b478358fc, 0x7fa07e6669a039dc, 0x1179ba7b5abf3258
+, 0x5c8f4ae7e4ccb177, 0x3bdad8de78fbb855, 0x26c1db51d3eff3d1, 0x2c772852aec5d734, 0x1006fa22e51caf65, 0x1589a0b0999eeda2, 0x1c26be4f82921e2b, 0x161dce10b1d79f55, 0x2351492029c1542c, 0x2d0618d116e20eaf, 0x53208ede39c1aaa4, 0x6b290ff22730ae04
+, 0xabbeccc32e107698, 0x76615a75e532f453, 0x2bbbdc78808560c6, 0x272b24db142bac10, 0xb9fd5d3c058f9aa5, 0x62775653446f4da8, 0x2934207b604b8b78, 0x3453b590571198f9, 0x7a255f2bcb4881fb, 0x44cc1d1f31434da3, 0xdb426830715184f9, 0x5bec77571e2ec139
+, 0x73a2cd1400b6b03a, 0x7a921f8216a6037e, 0xc2378d10270d9037, 0x3fe4bac61a3e00f1, 0xc76ae7d57bded8b2, 0x4845b3336b6f7492, 0x05f8963a253ac539, 0x1cbc3d3998a84ff2, 0xe7c4aac2119e7ebf, 0x4d8468f1592c690d, 0xae6b0f213eedf7b6, 0x7895310a509e9b98
+, 0xe2d7ccb7977e4815, 0x56a40af05e15ff6c, 0xcd6cd0f9c8ba631a, 0x78075215aa88c232, 0x8130f118ee0a8731, 0x08d59a22a1247b43, 0x770811dccd478742, 0x33bd36c69cf65321, 0xf78e61eca574a1eb, 0x315d368c499a263a, 0x99d3db7e551ec9f2, 0x09a3e2bb8a77598f
+, 0x9bc0d80066021311, 0x489d33f0fb9cca51, 0x284391468be7ae82, 0x5463ddc0fe912aa4, 0x5e703e9a93f6284e, 0x2bc42eb155e3c2e1, 0x05d7268010de7339, 0x12f8b8dbd6cc1a79, 0xcb9d250296161721, 0x00d1a1b4f9ad51be, 0xf373d11d0df8f2ce, 0x204405867e053ad0
+, 0xd40fe6e0d2178274, 0x0188eeaa9162f44b, 0xccd003d364d25cfe, 0x1d57f90b3e8e48e4, 0x5bf008738e5a0f0e, 0x2336b6ca4319127b, 0x2c8a90e0d3db2a46, 0x74818b6a854791ed, 0x73b35439e89c61f7, 0x0c3b95ac3afba271, 0x58caff6fe90e1828, 0x6fe797169178aa46
+, 0x6033ac273ed8b059, 0x1095398c572c76ee, 0xeeb0f38ff5e7d2ea, 0x34158ce612b6118e, 0xa985115e60976aac, 0x465a7018dee7f954, 0xdd37df1986c1bcc5, 0x105316ed84fb1e71, 0xb0faf448161eaea1, 0x1f59435f83576f4b, 0xcd63a534f4ba3b87, 0x532faa5af5a641bf
+, 0xea32f5db9815fa60, 0x6d8ab6bfc8aa6b21, 0x16b7bf189605dcb0, 0x47395272c84d77de, 0x20d4b1f219ebaa23, 0x55cd97dcceb75fae, 0xd40337a87277d653, 0x3d2b03ee4d34fb30, 0x8507523164d87a39, 0x64dfcad1a9b59c49, 0x5076b3e0533c140d, 0x6b41a58ebb60e363
+, 0x587ce77a17d21853, 0x2253b88da6daa1f7, 0x361dca986dc160bc, 0x0d998ba8c2a00e76, 0x441ba57f691c457f, 0x4603a7595d97c089, 0xcd3179d3c580bcc9, 0x7e169648e38d1050, 0x6f31362422de8198, 0x0b8da456508685f1, 0xadb006d73698b425, 0x61d0193c0187aed5
+, 0x38016891c24a2f52, 0x137ef58801d4d4f3, 0x7e56aac374739161, 0x483b8dddb018f4ff, 0xc7140108bb7992a0, 0x1b6aa813dff408df, 0x7b5ee738b357d9c7, 0x22201f023d428964, 0xe65603c879d0cd8c, 0x2d7a768b541a84a4, 0x6c8c75ebd3457faf, 0x08959fe174eb556f
+, 0x6f264f8d39a82718, 0x60236c1e63c1fabb, 0xf5a01b23c40108cf, 0x61a2a14a5df80d9f, 0xb98635c32efec70e, 0x1728433de5f5e199, 0x0ab912ce799215a5, 0x68f9428b8d3d830c, 0xddcf3cd6bb9f8a39, 0x2d1652a70433b97d, 0x8608bf7665fae2ed, 0x24afea47e00c5ff4
+, 0x6b6cd8c0429b3c8a, 0x0a5d4b972d4fd918, 0x670137442b11d82f, 0x00286a071f97d726, 0xd33c3cd908b8c58b, 0x23c5cb10597d2d0a, 0x49935c46304a4bbb, 0x682cbe14e6f34a10, 0x2a46170c8076ec85, 0x508c976596100b90, 0x72d4b3c882ad0e8f, 0x0854225b183f3b64
+, 0xf8496e15efce252a, 0x052232bb39dcba9a, 0x66862a7ec95ff170, 0x7a0fd0da4413e460, 0xd83213c9d9e05b32, 0x6864dfebd657c04f, 0xb6ddbb97c90aaca4, 0x0a5cc2ee4cc6056d, 0x8fcb1c535f8b8185, 0x17874e4e4a273d52, 0x70c7a0fe0c58b452, 0x1a88782118859ff9
+, 0x54166009bc3e374a, 0x39f581661789882a, 0xd814abff13c64d14, 0x4051f18f99876e12, 0xb733a1e1d530923b, 0x2becff125c4ca352, 0x7a2686291ac256c3, 0x3fc4883dc9c58522, 0xf7332aad538f842a, 0x1ea1e7a3b338b6cb, 0x74ca2fbe8504446d, 0x334fa7d62078fe8e
+, 0x37bac66959ebf5e2, 0x3b6fb24dcfb65a71, 0xc65decf20d027a80, 0x050cc663c89e1b08, 0x8a49cd3caa7aebc5, 0x54b6e968d0979328, 0x078eb685b6fe1570, 0x10ac82f0217493e0, 0x5ff4d8961e8e99bb, 0x7ab0aaf4655aba91, 0x4320d334e68eaa0e, 0x3dfd0191356aa321
+, 0x93010cfc230c5c2e, 0x1fe041987284fa71, 0x8956232db52935bf, 0x109f4b5b31542472, 0x088bbd44447c60eb, 0x20eefbea335fd3fe, 0xeff8065015b4a23b, 0x4b5d35dd3ce1df97, 0x5f88551cb904c02d, 0x2e344b1ad8646287, 0xda1219050a729e9b, 0x5606a9fcb335eb62
+, 0x9fe5883168e64dc6, 0x23ee938aa9361c49, 0xab46905145c6a92c, 0x4eda390a9ea120f7, 0x5cd07eb9926e9241, 0x4f4904da8f6ce24b, 0xe8926e3ce781a04e, 0x6a1ab68179b13923, 0x0917b8fd6e44ca91, 0x479f9ea63dd023a1, 0xffa92af8c880d5da, 0x19411292716db6cf
+, 0xb4f9284279758866, 0x4047f9eec0dba6a8, 0xad83567566be9b99, 0x5134ef4acd9ec494, 0x71fbd8494170d24a, 0x2107e7b0878ae669, 0x533f7631a61be1c6, 0x2965a37c4f18918e, 0xa6a2275340378657, 0x2a7db84012562af6, 0x7c26335777aa9197, 0x06ef3daa3b2c8914
+, 0x4738973fbc83bd5e, 0x61c0282e543c67fe, 0xf421ccf9b64dec99, 0x1cd645b53ee96a16, 0xe8d88dc12c1f5ed7, 0x515d9e5abcf3376c, 0x653a9ef0ef9374e1, 0x4e63855c9c57e09b, 0x5642e4c6d8b1ed99, 0x25e38e0ced59d40b, 0x519248e123eaa8da, 0x56fa8a4fbfee820b
+, 0x535d2fe1bfb6d296, 0x7a8f8d4f55c53fce, 0x504be74635fc981e, 0x2df13d2c822b03f4, 0x4b2902fca4676754, 0x4cd492dbba96d1e7, 0x086211cbe439cc95, 0x744eeb2ffca1c57a, 0xeff664a6b18b55ea, 0x372a78d192239819, 0x879f35bd71fb3fc0, 0x1c3f67c55ea64983
+, 0x929f3a4f7aef9b5d, 0x23e18533aa7cff7c, 0xd0410ab3749651d5, 0x2382166056cc076a, 0xd1894f2e16d63343, 0x0deefccbe4b6a381, 0xdcd861b15701f3ae, 0x7d109de092821b7a, 0x556acfb0e6c8de73, 0x35aef27e62455676, 0x1699723af7f0e39b, 0x48b59f9d81cc12c5
+, 0xf507148ea09fcf36, 0x486c685ceec5446b, 0x4d6af7e4d9452f5b, 0x41939c7bf482de04, 0xc97ee037c681994b, 0x1dcabc6c1fdef821, 0xf85894be74575128, 0x6d120967f591faf7, 0x622047309d011006, 0x76cc672a744c49a6, 0x5d17be2c2c7b47b8, 0x1f94b90377675feb
+, 0xc1c8cc42d001d738, 0x40a6f1285083fe0c, 0x08b68d4476dcc87f, 0x0cd967b8af796608, 0xfb20f15889bfe298, 0x78227c725b618695, 0x4a1758ee23105cf3, 0x0d1cbfcdbcb8c531, 0xbea9d3e06ec35f85, 0x7ac9cb3048254b78, 0xfc5a11a8cfc1fd10, 0x5a7cf52d4eb8327c
+, 0x7430510d8e8253ce, 0x335df7712f4a14ad, 0x7257e9fc8be55239, 0x7877b8b05e58ca09, 0x15160ff5497cfded, 0x7ad83f9dccefbe99, 0x2cf7b34e37016951, 0x1ebccd011951e4ee, 0x4deb537de25af00f, 0x60a213b35a8aecda, 0x6ff599565833b3df, 0x358ebc32838654e8
+, 0x960526b4e1842717, 0x521e51e7422a539e, 0x14b823d800772f2e, 0x023775d271fa6783, 0x02a9d0c7a7900f5f, 0x52f3f1c4df01dbf8, 0x70caa0c5c6cd46ef, 0x5f315a342bfdd632, 0x15db225a7ad849d5, 0x5368723418a69498, 0xb50b13739122a3c6, 0x26046c0e57298be1
+, 0x97ebf8a67da0f59d, 0x39a0e67a5d996b39, 0xfc6b092c889a381c, 0x1c0f07e0dab56cef, 0xd081943991a286bd, 0x21665fd230186499, 0x2cfbf3c0bc07167a, 0x2ee7aa77b1e23c83, 0xdb304a1ceb14a34f, 0x623a7e457a59b79f, 0x0adfd176decc3c18, 0x3fc7c9ae9f5585fb
+, 0xb1d68d9c30724ca6, 0x30d399c0475c192f, 0x2bfa8d96c148b664, 0x1eee310377dd543b, 0x45084e77181fb427, 0x17fd3212214fe56f, 0x7bacfc3617618b6e, 0x0b0252b364d6c505, 0x82746f055e385b17, 0x54efb0e8c741ae90, 0x22c46688dbd621b8, 0x093809e2454df3ae
+, 0x3cc2d860f7f0b38f, 0x6821c392e05d95a2, 0x25997a5b0f36d738, 0x787deea1399d277f, 0x7d6f303f5a5f0cba, 0x3c09f0d3d2880c4b, 0x884e3258328d99c8, 0x012d570a1a4848ac, 0xad2983decb4c82d5, 0x2274971275f37867, 0xc8a938ca4386bb08, 0x5283a7f18c0f96f9
+, 0xb6fa80d036348b06, 0x5ca3d8730fdf3397, 0x8b51f2ae35bdc7c7, 0x29de0e2ebfcc6def, 0x6b9a65a64b0d2259, 0x554e4f6728d1a1c4, 0xe3ac7b9196ceae0b, 0x119b4e5ec7633af6, 0x39926d4e6694062a, 0x35781ca6748f6d21, 0x6e90371243328b35, 0x241a494da7fb6d82
+, 0xc188f04ef8686191, 0x55e9416990951bc1, 0xebcf5210cb5ae6ce, 0x0663c3e3e697c189, 0xf5a2d193d2c8c4c1, 0x3b0095fcc84b7cd9, 0xa7a78d4242f0f5a7, 0x77cda9a00ea77471, 0x9fed2c05b0692c07, 0x07f00c9f9debc5b2, 0x6a8ae973ccecabe1, 0x045920d8236c6ff7
+, 0x28babed0b414ff2c, 0x24c11e194955d348, 0xab93513920885d11, 0x3d47a10b35288e7f, 0x4c0b3db7ab197e4f, 0x6f241a85cd4eddcd, 0x8606793ca7df678e, 0x7df7a57e8faf2979, 0xa26c2683100f5e02, 0x34407bb1d32a72e5, 0x95ea2fe3f75cf65e, 0x35a394398f94a496
+, 0x731df2f477381f9e, 0x2d89826535cf2167, 0x16dad4685f591a11, 0x04a1f957b59d771e, 0xc444e511572ebf5a, 0x4ff3fe76e45caeab, 0x54c0f5c2af724077, 0x061f08e5abdb7b74, 0x05907fb75acd2fb1, 0x78fd95d9f6f70b12, 0xdd2c0a893bdafcf1, 0x5b90f2021d083a60
+, 0xbc40be243958c117, 0x6f846852df4c2718, 0x98312c7d6b7e660d, 0x6905e83f85daa497, 0x0c61ee60b38c65ad, 0x294c342dcb2ee0be, 0xd251936575907ef5, 0x48decf8d4291509c, 0xecc6313ef755633b, 0x1d69f321679f4d71, 0x2688b9b01702309b, 0x505143b7874e671d
+, 0x916361d71db293ab, 0x08c3631b427992e7, 0xfec0af4f8f6f28f2, 0x4e8fceef4c1fa809, 0x9f77c57a00ff9097, 0x3e768c2120a66bf1, 0x441d1490500d359f, 0x1af676f464dc83c7, 0x7947fbbbbdf5add5, 0x406695c1b16dbf06, 0xceee324af3b0f4fb, 0x779df238e97f4750
+, 0x6f32c7da1c78592c, 0x54a31d31c19bfaf3, 0x47ec05ef4cad51ad, 0x519d12423fe1b55c, 0x667fd22f96e86970, 0x7b32970607019501, 0x6a829f106137af2a, 0x7f5c99902a526e30, 0x3f36c5d048a5197c, 0x0ecc951366e2d614, 0xa131e6a37eeee843, 0x0897516fe26b4f92
+, 0xd0efb65fba1427b7, 0x5c33a3f361706089, 0x366656f1f782c702, 0x3f632575899b2149, 0x915d0e248dc9aff5, 0x5bfe50c5bdfec3ac, 0x65547f0549e9db4f, 0x1beff8c88c0dca38, 0x7003041cfc400f4e, 0x43c0102a4d114d72, 0x28795b8c433a7f4b, 0x5a7df408aaaf828c
+, 0x0470cebb4f533d2a, 0x578a28e71911b901, 0xf41ae49c04580e31, 0x2e3ad02f870c1a1f, 0x413607fd506e90da, 0x0cffd33631a5cf90, 0xcc41910e4dbc769d, 0x251f7fb6340a331d, 0xdddc7a23fcfed418, 0x51838f57eb67b132, 0xf39c6a5839b3412e, 0x5924b61ee2f2c975
+, 0x51f9bdb94a4e9b1c, 0x07504d3268a96383, 0xc51daaff6e5f606c, 0x62a28c561d2acac4, 0x7ed40318cdd42027, 0x65c18376ab3b5e19, 0x72f98bab49c062fb, 0x28248a3f0423b4b4, 0xbf50870ef2b8fa81, 0x421c718f834ae342, 0xbdc22910a603cfb7, 0x658c1465d6dd1bcd
+, 0xf81eebe2a36041a1, 0x0cc71ed375baf4cf, 0x012b13fd0f0c8dca, 0x6580e2baf92b4adf, 0xe0d4d9c962e2e669, 0x73dc25a0204fc9cc, 0x0013b65498671394, 0x28fd26fa227da065, 0xd133c6c21b3b17a5, 0x60d4f435950dc953, 0x22ca44be337ebc6c, 0x2846d6faeca8f0e5
+, 0x9dbe6943718fa6b5, 0x70cb341ac38e94d0, 0x5d89209dc16e82bd, 0x59964ae95b44766c, 0xfd95d766a5b1cd2b, 0x71834efbda6e8e35, 0x1779bd9d38ff8354, 0x2f15ed754d7cbfcf, 0x97ab75031f014b66, 0x227dde21c0def672, 0xfd20fd0474102bb0, 0x3b8adcbb2e5d08bb
+, 0xe3d800ff6dc7c3c1, 0x54d95e81c66e796d, 0x5a760d8df359d66e, 0x2e6529637d2afd31, 0xe58dda96d02bcddf, 0x322b4c5e41038348, 0xe44b50f7e8a0d88b, 0x1aaed9d7ebe896e4, 0x86e1511863ea710f, 0x62394ae1fcfe6c03, 0x9fd93a9f301164d9, 0x2c780135825e7a8f
+, 0x3fa31754ad34ffed, 0x72d4ed4e7b1a7a5b, 0x6247dbcc01ced928, 0x52acc376d8968272, 0xd333574855dc6395, 0x7d5c3e42a51e7998, 0x9bda0bc2693fbec3, 0x145c705aaa93491a, 0x9f944e75b84771e3, 0x15891dd486b5e5a2, 0x79f4b537d06484bd, 0x60e6bd4217ff2aa1
+, 0x341e746fd4905987, 0x460e65b894e0cdf5, 0x9e000173545a52bb, 0x743592dedafe3a45, 0x5a778f36d9e6dd5e, 0x352778189420649b, 0x218deb975dc72505, 0x657cc967537bc5bc, 0xce2557b23b05aeb9, 0x6f57e4ae92b4b835, 0x8542a110310eedf5, 0x70b96659ee659969
+, 0x95d03506d7bfd587, 0x1b91b4306e413a93, 0x3617900012f367bd, 0x2eed707f4d192655, 0xd182f7ff77e90804, 0x5a1dfcc6abc2235e, 0x813325b84710f75e, 0x1f579ce2d1dbb170, 0xb6a3fac0747016d3, 0x6b5bf35ddbc7ce23, 0xcbc9d313368cb94f, 0x4974924d6ec09948
+, 0xf4a7d1e8356dcdff, 0x40fbe1943abdc2d1, 0x8ec19a11a70a194f, 0x0dc83420f2765a9e, 0xcd730474df916e6d, 0x290d0bdd2e2ce8a0, 0x081d03107ec263f4, 0x3583cec555efaafc, 0x2c94dd7909405c13, 0x11b6f38454d060a8, 0xbf04b77a18d610d0, 0x151fb48099c52dab
+, 0x39942940d0becfd5, 0x5316f2ddaea7e8a2, 0x8b46b85a3631f009, 0x703ffbfaf8dea1d0, 0xac3e5fb6076fb012, 0x0e45edd1bdad2776, 0x783423dd53e3bb82, 0x268fe73b3991a497, 0x03752644f740d7d8, 0x6df43240e310abcc, 0x8e73a18fc4a01814, 0x059b477d7811548d
+, 0xd890cf9bdf49c2f9, 0x442d710d8861cf39, 0x2be5b126e779186c, 0x64a912f5f59d5488, 0xd9976888a81c5bc8, 0x533ca588360fd943, 0x2ddf67362d2444b1, 0x0819f4dfb2828b29, 0x0c61e531d61f0a46, 0x616ff18cc77ac9b4, 0x1f1789f501661cdf, 0x41d05d602c0e4073
+, 0x2e6a641c6f454ab4, 0x74c90b1898d18eb3, 0xd5b19e6b6fcf2e9c, 0x1ab263e34b54ae41, 0x825ebc68a0505adb, 0x4d2e097a050531ef, 0xdd959b5c2db00e43, 0x2a377df1a60ee665, 0xc68b4e5c38d53c30, 0x14ddd52a83d2dcfd, 0x783199c13a6eb684, 0x23cb94e7ad12f650
+, 0xb30903a5a477d28e, 0x5edf9435291d48a0, 0x936bdf8df8b6a418, 0x325bffe5812fa7d5, 0xf6a2a870a5e8cdd2, 0x60996d4c6829161b, 0xc1428f01b4cd5203, 0x7f3c5e46aefcc3da, 0x0b6176f6c20b8f3a, 0x126bb90bfeb982d4, 0x32c2f2dccf95f38e, 0x1bcc31f7727ad062
+, 0xa58996988d3fae27, 0x5e38f6135440ec16, 0xaeae6f664aef6976, 0x3abce63302e3ff60, 0x1a662a43448353bd, 0x634fd42d90f2a57c, 0x12820f7b03c77caf, 0x5cee117dc955dbdd, 0x79584f3830c25e27, 0x5d932f776b6d93fc, 0x2101f88df9ce36ae, 0x713fbd532d45f02e
+, 0x083e14cffb0741b9, 0x7ffd0f6b0c4d0e3f, 0x59fe75fb443953e6, 0x114efeb666decae0, 0xc94c9eead851d641, 0x0c8af8036ef26a05, 0xbfe9a2b57c16b2b2, 0x4f6231b213c744b8, 0x5c13540d502cabb4, 0x0944680e493164ed, 0xf1c4b9a6fb35d200, 0x4da91db1c247f7f2
+, 0x826b9b72e4c61165, 0x0fcda9bc7c191bad, 0x8814b36ab188bc50, 0x169b9eb8343b8e1d, 0x92bcaaf8ff28b727, 0x6f58f63de8d96526, 0x6b115043144d0271, 0x6cb7bd44ccbd4b05, 0x333dc601227593e0, 0x641e49dc359d1fae, 0xf8be13ff22b63a55, 0x184cf4af8b85fd1c
+, 0x7b2f3a2d1d771826, 0x0da0da05c8bc9fbc, 0x8567269f54f878c4, 0x347d5611eb75133d, 0xacefe6c809985c74, 0x724f77905d681b7c, 0x497604330986f98d, 0x12119bb67c5beb2d, 0x24a2c75ddf82bd53, 0x75133d1f99fd74f0, 0x86b5f3d61c09e025, 0x0ad4764135c6e344
+, 0x8b92b3164b56845c, 0x119f074231857ee8, 0x9035a55c330c851e, 0x5f509ab214423b12, 0x41864a74c5e75dda, 0x18dfaa56b7e0a88b, 0x7c82b80f5d6c3045, 0x03ac65afc4ba6bd1, 0x34e7923c8b666577, 0x0eaa992458064a81, 0x3abdc2c097f0dd14, 0x770909e24e0a87f4
+, 0x9674f85ee7ebdb1b, 0x5dbbd913b80b1dd8, 0xfee0406bc0c5d5a2, 0x4706243679ee2031, 0x21c49f935807cc34, 0x733b48e73f5b208b, 0x7c6ef7d874497420, 0x59b859dde481bfdd, 0x72f93249b7191bda, 0x0083966b6ec098d8, 0x0dbd67d073c0a026, 0x49872b557da9a78f
+, 0x74b1351afb349ccc, 0x507d1819e6f9864b, 0xfde93e495e822810, 0x5c3883348db11e0b, 0xfbf0c536b8d47b5c, 0x294399b1ad354bc1, 0x30f28e5fe3f9aaf1, 0x23062d69f62be797, 0x2917dae213dd73de, 0x72fa836ab4c134be, 0xe2338fdec2311edb, 0x1a12b32e5e777f58
+, 0x1a151cc52d7d97ea, 0x22e22b09f2b36e03, 0xdaf252a1c8d7b1ed, 0x69a5443207e65f80, 0xbc60f751e022f6a6, 0x67aaca1b43f8272a, 0x24284c30f3237852, 0x15330f33af692ea1, 0xd2ab0266dce8846d, 0x6ec12e8b9681df29, 0x0ec0a26e0011f300, 0x1d59da73976b08b7
+, 0xbfda7d2fa2b30aa7, 0x34aa7a1c026d8b81, 0x58637e2737331572, 0x5353cb23c6bafbd7, 0xee0fe5892f61148b, 0x644e1d5911a843a0, 0x160f78ccf0fcf08b, 0x61e4cefeb092168c, 0xbcdb478e9dcee83d, 0x7d0d7634107c9518, 0x1f820ba561d81976, 0x3c72c80e937e3b2b
+, 0x82cfca7c603ecb93, 0x6323798f422b8b49, 0x2ddd852a4d72d47e, 0x6bbe944cc5ef944c, 0xbc0dbe85f004b692, 0x0ca2f1fa8b110b64, 0x3e102a38ff02376b, 0x297a85e49fab9e44, 0x316f5187f97be724, 0x51d2b8182aec21e0, 0x1574dfabeb101ce6, 0x0a33c0fbc220cefd
+, 0x74034e210c8b6730, 0x63c5bf8a9aaee421, 0x62b1236f45bf8f7d, 0x7ca784b3040c043f, 0x5aff6b1b5cf58eaf, 0x14732f99da500f40, 0x397bdb02d4800554, 0x35f6b0a24124a880, 0x871d06be21e5b75d, 0x53e98e03e9612c40, 0x40e257fca027fd1d, 0x4d6fd7c76f99ea9e
+, 0x0886d93e298f0aea, 0x04c803e8aed0cda7, 0x09b1d37281dee642, 0x758c00f60c8233e5, 0x2a209411f2db90ba, 0x4e702f7949d82494, 0x0b965b28db1ec8ae, 0x5a43c2c85d3786a0, 0x7b17b9f3f1f7691e, 0x07fae70da04f6fbe, 0x2274d52e30cf9348, 0x79c3aa515c4fedf7
+, 0x8c8d9c42f30b31d5, 0x7650a92062c0c066, 0x64e64c2176a809a1, 0x7b632d863b185651, 0x7280cec38ff43848, 0x16adc36adf4e4030, 0x5c37531b282680dd, 0x4326956992a0f2d2, 0xfbabaf6c08baa001, 0x5ddddcbd58e57d07, 0x348012255361ef81, 0x32ca97e0067c3613
+, 0x120ad3ea18df9070, 0x3db9cc415e4d765c, 0xb383c172d08033a7, 0x13515fa05c584d8c, 0x50bf41eebb284eda, 0x2ccbabfb7c2bfec5, 0xd6c3257948b69053, 0x552f73334c611618, 0xf9d49b793eb3443f, 0x1893282558ab71b6, 0x07fbfaad493b2abc, 0x1f56f070aa8b14c5
+, 0xc5af6644e599e7bf, 0x7cad34b53589e510, 0xe467bce47b3df7cb, 0x3df33891c4c0ef92, 0x7487355d2a7d739a, 0x25189e93bf0169c8, 0x0f5d3add91dd0c58, 0x261c637fe896f1ad, 0x53608dc129cb26cb, 0x7b4ae16e10c740a1, 0x651bc6df89a8b953, 0x08f33c923751024d
+, 0x583fa4e3a0f8ca54, 0x069b372c41197a4c, 0xbef6400ce844f034, 0x1084ee585eb50d24, 0x10b93c9be4ede322, 0x6577acb20b952d10, 0xd022afb4ca87c63d, 0x7938d5572a10317b, 0xbaf44102ec675c9d, 0x119d637515f9f614, 0xeb7034b2b99e02ff, 0x4b52c6c2d1aeaa8d
+, 0xb5c0b6fa34b0a9ee, 0x0120ad9b67cb55be, 0x1292b562c6ccf871, 0x540b3bc7fd44fc8c, 0x649ba1f3f4ff8222, 0x43c22a829c591ef8, 0x034c74d856a19625, 0x636dfdc914b484bd, 0x5bdbc7c43933c737, 0x050e29e548aa4b15, 0xa964f14126e02dcd, 0x2a26294a169259f1
+, 0x3729f83db1e08057, 0x68ac5c4394176fc9, 0xb1936372a078877c, 0x2c7db9974d91200c, 0x05a0e7d5eedf039e, 0x46471f3ba688b8cb, 0xb3cd59e261bc4e9b, 0x2f0d42c6285037c2, 0xe934b4956aa35a9b, 0x19375af231fcdaae, 0x1aa1a118c15052bf, 0x688979374d1b9ca5
+, 0xa5a13f7dd77192b9, 0x23c183ef4b037bd4, 0xb3f8ec3108d7c117, 0x005d5595df401e6e, 0xc4c85155d88c9525, 0x01a1e0d7ed0d92da, 0x06ff275e44e6e653, 0x13fb3e544e0bb7b2, 0x16d5e061fcde6085, 0x2b66475c072e8afc, 0x11dbe55341fff8f9, 0x1f480f005daf68b2
+, 0x372d76e285a463fb, 0x04eafba72278f147, 0x745c7165e671cfb4, 0x7b0ffa5d64995443, 0x804a110465cd9b6f, 0x04fde2ad1aad2307, 0x0d481c030881c9ac, 0x73631a1cd9978a98, 0x2a0941a5ce0feaee, 0x38dbe81434c8a9fd, 0x7a5ec7c786f46560, 0x6ffacf54ec808823
+, 0xc89ed024026ca421, 0x09675ced9c6d9752, 0xd0e4ca33abbc80fa, 0x1fa29b24f30dc1be, 0xcee7c4b1c60d714e, 0x44991dd8b8bcf845, 0x5105a0ed5c567c9e, 0x7215eeea961bc9d7, 0x79a5d12d9699283a, 0x1164bf68534a3f79, 0x234b2a350fbdfe42, 0x27fd18f12c33a697
+, 0x547de318d03fda8a, 0x4504024d8a62c36c, 0x987ca653d4179865, 0x670e914b67e736a5, 0x6b6e90dc3388bdf8, 0x2dc10b8b44a6fd75, 0xdfe4dba71ca92f1c, 0x0bcaf039f3bcc209, 0x8fe744f741747038, 0x65fe5976e6da83bc, 0xc65df56f6a14ac94, 0x43a2be077d8c78b5
+, 0xd7709f5f1d9c2c42, 0x2e6314c6259c6128, 0xee5f4429670cf32e, 0x62904dc0343b19b6, 0x320c81f950dfb763, 0x30962be7cacdcbcf, 0x9ec78a9895e9ebdc, 0x48b8cd1a69635c14, 0x6411eaad71afc7c0, 0x0ce97f2981b1481b, 0x4432bea115acb2aa, 0x2dde556d75db8c4c
+, 0x410897b7276900f3, 0x125495d6c663697f, 0xc12dd2a61b519490, 0x2b6c860bcff94097, 0x7f840bcf2de33411, 0x540187586e49117a, 0x42b698d2f9eae3e9, 0x2199a3e4ea2219e7, 0x9ce8e545b458f8f5, 0x2922419429214a94, 0xddf2d5442b485c94, 0x43601613181b6f54
+, 0x21ff38797cb075e2, 0x72c90ddffa220621, 0xc1b8c14260973a01, 0x4725abc35be70f01, 0x1368c2d68b72a34c, 0x7fbdf27002fbe365, 0xdfb3cc8f649f7299, 0x270adcec88edec94, 0x64688533d5641b16, 0x3f7c07377f0d28b9, 0x65889395e7dbccd9, 0x7bb42b6e4b1e29cc
+, 0xfe4afc0c99ccf18e, 0x0fd6266f5dc2613b, 0x704aac7102494b42, 0x20920dc271b9fdd0, 0xa7d5adf77e94faf1, 0x7fa36d6da28c0bb5, 0xc3f65baccdd16b21, 0x503956bb0b495b17, 0x837004a90661b9fe, 0x340b8dfbcfd6e85d, 0x1fbea29d47856fb8, 0x50d1f812b0bd4802
+, 0x2ae1accc97f261a3, 0x30943da01d884b81, 0x43de11780ce5f957, 0x482bca2c15f7424d, 0x4d8e080aac3a001c, 0x2345dc5d078dfa3c, 0xe2109944c0668a03, 0x62704a8605972ac1, 0xf8dfa27c8661581a, 0x44535dd06b814c00, 0xbcda01a3ba04cee7, 0x6828d2985fdfd1fb
+, 0xd3280dfaa7363407, 0x7599e3428fc0271b, 0x1db24c5079409320, 0x5c86c887d3b0631c, 0xf66749db6f0b09ad, 0x6ccd1d726908d99f, 0x3314a5b274a85254, 0x791e069a8b6c136e, 0xac811cb44bbcec20, 0x0c38cd05bdf0858a, 0x39d91f6fa32d030c, 0x057e6c837a5734f7
+, 0x5e36c75300fb62bb, 0x5e4bf465124977f8, 0x1a803f9a664f5618, 0x739c06c8aa65d498, 0x60a5993eb363f7cf, 0x1f7bceca131d933a, 0xf9056bcd8b0a8a8e, 0x20226eac878cac1f, 0xc9c4eeccb02558e1, 0x6d37e94e204217f7, 0x1938207944429ffa, 0x30fc06ae1d144841
+, 0x1c87b91d0fedc939, 0x3d68986428cb5910, 0x1c8df743f0c2f07b, 0x75135d6d1339c956, 0x6054c281c6d60e4b, 0x650db03f122f7b7a, 0xbfa8a0231162bcfb, 0x50bcc75aa0e7eb39, 0xd25bfc63c1bfd100, 0x58b867d5e5a67c67, 0xacbb1cc281e32a79, 0x067fad522a5d0697
+, 0xb4dc2a5be7c5b6b1, 0x6f314a0644ff1cb3, 0x82b6de9931a72ab4, 0x51cfe0ff500cd568, 0xf92f8a556851b49d, 0x3f50a1fa61cc3b2d, 0x4b2b22cbc488992f, 0x7a6901989865fc54, 0x5aad5d9be2150607, 0x5b12a4d0c7e09ceb, 0x8a92a315174daa92, 0x01b85e56fdbd05e9
+, 0xdd5bfb9d1304c8c1, 0x7f1c86914454ed06, 0xcda7852e8b045e79, 0x039bb41d39ec813b, 0xb69331636fdad8c1, 0x3fa237d979e87b52, 0x85708804a1545e86, 0x0637dc8cc574b3e5, 0xbc0a1381dd69a6bb, 0x77894e758426bff1, 0xa3e9cd8efcbb9a61, 0x07764e76ecf90a64
+, 0xe173ab70b05dd330, 0x678f1fb7fc5b7c15, 0x94d93b69c3f7ece2, 0x013d7264fbf0d78c, 0xd9968b67b63f9553, 0x4194a43eb15c7d91, 0x82d3de23b949d7dd, 0x6362f1d24fecf1ea, 0x50a7e492f97ea753, 0x492c27a135446950, 0x27e887c305135765, 0x3dab8cfd5c08651c
+, 0x1129e360e23282b8, 0x35cf82fef6f1acb4, 0x616ef8655a4ab690, 0x196cc6d1f6fb071e, 0x00d9adbec1be863f, 0x57097e0dd3b916f5, 0xd29e43645e422cb4, 0x10069c4141543ae5, 0x97380a429620fa14, 0x07e381536a1c9b76, 0x30e93106391fbf14, 0x53bc5c684eb4b05f
+, 0xcac0013dc60fc1ed, 0x2b7a59ed4f08bc0d, 0x1c7b1577700dc447, 0x70030a6ea094a9f2, 0x1216e11a94b73d35, 0x165c7fc03e9d4db0, 0x6e308ee5a6922083, 0x5c7bee657208d48e, 0x196e0a9f55cd063c, 0x26bff51f2cca5964, 0x6b8a398858bf90cd, 0x260c43e60f549b23
+, 0x1448702d540d76e2, 0x0a50bcdaafaf9f27, 0x5d66ca3401cb6699, 0x50b05314c4cc9c0a, 0xc0863e7cde27c1c1, 0x32111b6b2527f745, 0xb1a53f2e3b2970e4, 0x75e911a2ba921aed, 0x8a0535b599f14d79, 0x075bebb83926e84c, 0x95c5d25eb4556209, 0x2cdf2fef27ff7cff
+, 0x4ea05b04ec974bee, 0x0baefa8aef189e7f, 0xbee2e5692437bca0, 0x4d6eefbc6a921237, 0x0a7637fbcc3ab58c, 0x3e28f6b9f48a35be, 0x1a22c3ab9e7cbb6e, 0x66aa7cd8dbc1041a, 0x683536a3de6d7d20, 0x2a8813bfec17fd44, 0x4b2018769f998de1, 0x4b6cca75e2ba4dc8
+, 0xe7ba521f8a57cf1c, 0x2e6b2ea3266e0920, 0x74fd1d077a05bbf4, 0x6716a2c5c7b36565, 0xd12a718be25ccb60, 0x6ece12ef10bc271c, 0x6ba6f86786280b62, 0x5d49ec40e50058b5, 0xcd66302f05ac607c, 0x16bed17e1e6afa8c, 0x2e24022a5663a44f, 0x422c8659c01ccd85
+, 0x5590b1f6bc3468b8, 0x3249e2df876eeb3e, 0xaf4876365702884f, 0x2df9dcafd5604d87, 0xd0e3ec3512243c94, 0x0d527e7ac952bacc, 0xdff431d85446a234, 0x4ed49c607b266f34, 0x405b327718c61681, 0x292becc8549b31f5, 0x7888ce00786f9b39, 0x557d043bf8b79f7b
+, 0x1c5f5e9ba5efb9b0, 0x1496983c53a0787a, 0x23da50b05032a405, 0x1504a30efdc9d6f3, 0x580856dc65c1cdfc, 0x190c674c8b6feebd, 0x29d39b10a885ade6, 0x6b5fcefc8eda481c, 0xbf0878cd0bf59327, 0x2580bdfee1c859b6, 0x9a2e16841825d6c9, 0x12bacdb7cb4f3369
+, 0x7c6129d75a4452fd, 0x1badeada1983aca4, 0xc23dfc92b2c09c78, 0x0e4ce2fe75376086, 0x8538630294f7a933, 0x795aea08e0bb42e1, 0x7f76a91b76bff9c3, 0x0924d0d5dc220571, 0x50600e22caf97663, 0x2927561a98c85416, 0xf61c3153918ad1e6, 0x310ba5f165d2a682
+, 0x9928ddafea2f0004, 0x1176670d4935db6c, 0x395b7df30fa3445f, 0x5b8e03e7328f3ce9, 0xd7fefe9b0f566746, 0x1b1f1fa244612d98, 0xedaf11f0006f8041, 0x41a7d972505fc7ba, 0x2310187f39b17d46, 0x0526866cef072303, 0x619625f4baba72a4, 0x16fe57299836e4d8
+, 0x74b1567a4b64253e, 0x48b4898310962813, 0x68f85cfe6244feee, 0x047f70c0447d7e17, 0x91ddfa98d63d7cb0, 0x0f75e69b2d9e6be4, 0x0292ff18732daac8, 0x382ea35de1a97925, 0x061311fd09a2fdb4, 0x76900e6cd469ff52, 0x732711be06c52e64, 0x2eda10231a5a4771
+, 0xb4cfacf83b5d6902, 0x095893432515983b, 0x42f2a730efbe1699, 0x28d743f3789f997c, 0x148b9ad685917aae, 0x6b1880a4697a6b9f, 0x9e8692d99f8aaea3, 0x5d5d154914050d04, 0x903e7dafdf70eb52, 0x0a95a77941b902fb, 0xf0631d3db0ca4a39, 0x6165167e6479a0ff
+, 0x120bedf1d504f483, 0x5bab0f82bf5c153b, 0xe0ff451af45271b2, 0x3af891c6dc4a2254, 0x8fb1df2558b0ed8e, 0x528489be4387da51, 0xd8a6d337d1990775, 0x1df53e693a4dad56, 0x7f0e3278734b9f6e, 0x0519d779bf288b88, 0x3261a7ac24998fc9, 0x6e9985ab446f246c
+, 0x0d2fd876eba7e9c9, 0x4f5bc478440ffa5b, 0xeb35dc8dee96830f, 0x777b8f583a503402, 0x65f6c8a420263d12, 0x376b979911048d0e, 0xebfd91101a411205, 0x20d4a6e0c3de9956, 0xdac4873ffd1900f6, 0x46125a853f083ff0, 0x4705eb7a0c560947, 0x07e49b15867036ea
+, 0xdb3630d2e9e06927, 0x5b735bb16b2f49c0, 0xa6aeaf6f7481f113, 0x0b75637004566000, 0x65273d43419716b8, 0x603058ab6bf2b6ef, 0x11c9af01ad95a686, 0x096cc223a610d400, 0xaa2fabafb7607a49, 0x6f4f9501c85daaaf, 0x39e17ed3438be307, 0x01cc32b5eb27190f
+, 0x927ce05c19f32f4a, 0x0760930154e31b65, 0x4b6bf97759a6824c, 0x1dc88a97179c6617, 0x76192a0fda2c0536, 0x3c868b7ac15465d4, 0x7886412f0dedf349, 0x03870aa25403190e, 0x39ef5244c8019c64, 0x4885b2a53a4cc9b8, 0xf09d253a7117100b, 0x688f407bc8cf5dd5
+, 0x079a21e8b117fb34, 0x74056d9c81059eec, 0xc557e907fd4756a6, 0x135db9841c592b4e, 0xa4e50aabc597efc2, 0x538455546d76273b, 0xb323f2a0df4a42d0, 0x31334aaed97a6d11, 0xfad458a6c4cff583, 0x1ac0afb3882db29b, 0x6c1ebab76a960a8c, 0x1091b07e593a3771
+, 0x6a2012b6f1103dd1, 0x33e886706b34404a, 0xbd87d5d07452e8a0, 0x00bab055fc8758b0, 0x297cb4951ed926a2, 0x056421e5dfdacafe, 0xa2cf26ba08e99ce4, 0x439b76a83cdf582d, 0x07c31e06d690784f, 0x68496f4110107d9e, 0xd48121751306bbaa, 0x1b1b2f15a435c9d6
+, 0x4dad27a9abfa9439, 0x764e188fc335a0ab, 0x7ad0cee7ba807f93, 0x4b3e13727e77a808, 0x1da93709d773eca5, 0x550695be3a0a8af7, 0x1da685fba3b54460, 0x3ba5c397d9895fd0, 0x9839f4805264c234, 0x2c64d115df322f17, 0x0791ac5b3885aef7, 0x1e2a4c9caf5bea2f
+, 0xf73233b3d560577e, 0x7813a7ce8ee3a2b7, 0xadb10962c306ca77, 0x695fb574bb1bdf46, 0x77a85e585c03fb99, 0x37ac78debe782af0, 0x7b7fc257e8990ccc, 0x0c9046cc5da689c2, 0x5f374b27f7be86e4, 0x531b4ebd49e7aec4, 0x32ee001247358b4d, 0x3bf504325c6a1880
+, 0xbe33333bf669fb51, 0x2f21eb042a760772, 0x92483a82d284fe31, 0x4326c8827a20c402, 0xeac61aa57e8ea09e, 0x40ba82ce30d61a0a, 0xb579c4ac70c8c034, 0x13f36f0f69c243ca, 0x66eaa3a4144045a4, 0x621176f25e022485, 0x75ae197795b577c9, 0x27979b2604cf75eb
+, 0xb16e4e6ce2ff5e06, 0x4234bb5f5eae995c, 0x0419e4fe85936991, 0x3b9f7b9bbd3b04da, 0xe9559d7b3bea1c11, 0x01f12b51f752f884, 0xc8d9b3d22043beb8, 0x671b41a18c7ad346, 0x432eabde990da552, 0x19785c6fe863e22c, 0xc2e7cd9ab04665d3, 0x0d3f386d8450c1fc
+, 0xb6c41df08c570d87, 0x16b004bec3d942cd, 0x2ac780bc051cea40, 0x0beb711ce0137cda, 0x047f9fe6c9194fdc, 0x75593f7e618c05b9, 0x083253a158d56cc4, 0x06d2ee26e6381c67, 0x3b2c939f1f9d6c29, 0x1cdca4dcd23c58c5, 0xc72fb18f863da09c, 0x62c15046f484b603
+, 0x2bcd7a49b5a0aabb, 0x4ce27b9dda73bc22, 0x7affb811667e353a, 0x1935972acf53d22f, 0x70a6f5453e05f851, 0x4c05a8bacfec0fcc, 0x9ea8d84f5a33068a, 0x4c09dc0196acaf36, 0xcfe65352d09cec3b, 0x693375452b6ce268, 0xd5a77d7b71acd5ea, 0x03634dd09df21cfb
+, 0x898bdf0125353d48, 0x785a246ef3980dd9, 0xe3556cdfe1cb5633, 0x05612951ffe6255e, 0xaec7888c32cfb803, 0x0725a6ddd7776f05, 0x285f0fd7890c4d2a, 0x09e28aa28b469c99, 0xc1c318a76584f44b, 0x4830c1f3a3846278, 0xb0f5d75395cd30d0, 0x5ebb8bb629482b49
+, 0x5d60e00bc272deda, 0x45bfd16c267a86af, 0x0ceb8424a00faceb, 0x4402fbe62310b3d1, 0x51fa4af6d2a5e854, 0x2a5ac980ebc300cf, 0x2379dbb774afc7db, 0x0e777f12739c18f3, 0xcbc24734c8c4171e, 0x01dcd3f6cb17693b, 0xfb65800ef45f1cd7, 0x4aa97fdeaa798964
+, 0xcaaf700c1359fde8, 0x3276a572565271fc, 0x4b3545bc7af8719a, 0x6681be7e35c9f43a, 0x8ad46e19c96759f0, 0x30edebbb63a53f0c, 0x3c8cf5085d92ad25, 0x5047b5186eacb384, 0x8d9124bfa1b7a780, 0x4a43c325069185f5, 0x6b74f797207ef9c8, 0x4de6e69f9309a7c3
+, 0x1047786641ff7880, 0x105be6a01435caa5, 0x5c85b673babe8f37, 0x0d0ded7ead3517c4, 0x9731a6f2f94ce67a, 0x2c305fe48d6970a3, 0x7a26a10d82871049, 0x7663c6ff5fe76476, 0x218be9ec9c7319c3, 0x4b5a1854766d5246, 0x4edea3186a9ae472, 0x53b0e98dfd3389a6
+, 0x08c1e3563c316d5c, 0x618c35cf009b0fc3, 0x868e6402352a432c, 0x55d5b659fee8b1c3, 0x8d669d04da193c50, 0x46678058e306c00c, 0x23efb1efdce986cf, 0x2c62c783defdfe1a, 0x4ca33472155a1a4c, 0x4d535169a1458567, 0xd13c2ff6b52bc2aa, 0x67ba511fa65c77ad
+, 0xa5e5482bbfd88c17, 0x6210fdaa6efcdb2a, 0xb81bb115a6398584, 0x2747b965e2bd41de, 0xb61cb3c98d0675eb, 0x682699d9b26c5d67, 0x6a79807ff3891c2b, 0x60acb6de54826d5e, 0x82ee849f8d5721a2, 0x5182da9c52a7ca63, 0xed59008ada0d6de4, 0x047fc48637dcec0f
+, 0xfff54189ca51c00b, 0x063053ac8ce52595, 0xf5bcdcfdae331fbf, 0x2f9394997bd4e324, 0xf742f6c0baf4ccfd, 0x7408c096de0f6004, 0x1da366d7f4c2252a, 0x2a1cb7d6213e5725, 0xf841c5fdf2081d77, 0x7dc0741609c25f3f, 0x03fc8f8ad9b3a7af, 0x2c041241e4e8134f
+, 0xfc4e5a2b274f3e99, 0x3b29beb1fb845059, 0xdf27a73dbbcc7686, 0x5aab492df79d9030, 0x858d692ea61d6e89, 0x623036ebbf970a91, 0x141a05da738a5c75, 0x1d99a7b0aec8ca1d, 0x0c070368dbe44074, 0x393393976b648682, 0x3d1fec21c88af2f4, 0x23243600770cda70
+, 0xdb7bc2f09eee63fd, 0x07b75e81236938ef, 0x44212c717d561924, 0x10a66a827c0efde7, 0x14cf0d1c536240f3, 0x7a86eb0eef6ecbdd, 0x23db1da8714b5a79, 0x04316359e0af1520, 0xdbbf024923f6b6c0, 0x3139479b49d16004, 0x1c774ea74d6c3ed1, 0x59ac272d29ef8b1f
+, 0x4daedef98ad124f6, 0x0d3a38501b55f03a, 0x09f866a1fc7ab49d, 0x4f2d81e503ec93e4, 0x7bb2c5e597e61296, 0x451525cd3fc10600, 0x78847e71e2e0aecd, 0x2a3e0228f3ed8f31, 0xa982fdd36b12d68b, 0x7b412f39f598fb08, 0x6e6d70340043d9da, 0x3adddca51e4c1391
+, 0x8e283b7bbf059c6f, 0x001b9433e9fb1254, 0x51cacd7d9ae3426d, 0x23b7627bc9d2944c, 0x295e49593734472f, 0x5b3a26068e565544, 0x5f4ffda1e2d6e3ac, 0x41edb5c13c531b7a, 0x8f47f333c3924120, 0x30f2c078b0157152, 0x127771c9d16cc619, 0x731bf6b64cb30c58
+, 0xcadb677977f66807, 0x59db14c00bcddbc7, 0xa1c976b9d8535aee, 0x1d0860bf8f111aa4, 0x3eac3e9bf0d3a6e9, 0x5f32043790b2f727, 0x33dd2ebcfa432a4c, 0x1f78820e6b6d67e8, 0x84f9f2bf6ff2c05c, 0x6a475ba9cb4639dd, 0x9fad888188772384, 0x789f3c80a7ca10bc
+, 0xb5e96c03ad224a37, 0x51a05a345a008bd5, 0xfdf77ed02ac9cf1e, 0x73acbef526399928, 0xcd5414440eaca7bb, 0x0fd8993d24fbd26e, 0x0e8fe03bf4a33eed, 0x1a3f4583c7a62b0e, 0x67a3014dde510771, 0x245126300900ce96, 0x946bb6c7f1632980, 0x17c21be3e4097112
+, 0xb9f3c88dea5195d4, 0x2edce28a11c5b429, 0x07e720a553281dac, 0x01caf1debf3f48c5, 0x493d3561d53f6e87, 0x27d51273c1aed2f0, 0xcbc51f392a29994e, 0x142a65d773aed36a, 0x0c22a7afed6a87f8, 0x00d72008549cf7ea, 0x1f71d9d4a8958722, 0x67b21a76e4fc56a5
+, 0xf2fca9f21f10c693, 0x5365467717bc49e9, 0xb6436f749849cc99, 0x2a37cc2d6a1841ed, 0xb645a38f5dc39b68, 0x5460d55a6bc466b4, 0xa4e425e2d46f923d, 0x011e3c05b7512fd4, 0xf5418ca32d79245a, 0x6a43606e61104fe2, 0xea89d9785063f9b0, 0x0d42ee0ead228ff8
+, 0x83af22c7d51ebec7, 0x12512fb982ad27f0, 0xbad3018dfcfe809f, 0x4b8c9a52de33e555, 0x04ca1eae5599083f, 0x7223277d37c527ac, 0x083182f542e3aa81, 0x3a2fd34fa3153bec, 0x2b31b942c94934c1, 0x72066c50bd54d27b, 0x934a40611f087bb8, 0x3823e1685b56b435
+, 0x3a2c39d7514a5b53, 0x3c5e09232456f2ad, 0x7a5f79bbb67dba2a, 0x51d50a3f90cd7dc5, 0x5faf3a94a235ca80, 0x462d2f1e9bbd93c5, 0x618e4062aa7db4a8, 0x3adcae056385572e, 0x04b16d815106304f, 0x4db1fb10db0a6ba2, 0x8f18e080bd3cb0bd, 0x7acff4f8c28f5520
+, 0x163cad8eba7a6f57, 0x78b2e5065f9665ab, 0x55def715fa0b08f1, 0x058de1f2842edb46, 0xf286dca11e2cf8b0, 0x5984e09d8a6fd07c, 0x41597cdecb380968, 0x7c45f2681b21af61, 0x3975307677dfb8c4, 0x286ed91f18fbcc56, 0xeac7c61318c35d39, 0x28484ca9220a0ca5
+, 0x2cff3d60480500e8, 0x74e4094020ce9826, 0x097017273f041719, 0x51c60112219ae4a9, 0x69be2a575b248899, 0x6e1c2a52b38cc288, 0xb75c77c050f5d03e, 0x3b296c7c3a1d1757, 0xad0ba3b3e91e611a, 0x3f42316390d5d51d, 0x811e75f570e8c15b, 0x264f5e5918a46ed2
+, 0xf273cd6bb183f45a, 0x5954c12864538e60, 0x5cc14cd06289e420, 0x709160e7880ec596, 0xc108719d6139e5eb, 0x62676f24fbec694b, 0x1f421e9b74115fef, 0x68ccadef507a78ee, 0x9d1d25bd387989f5, 0x3f97cde4dcb92526, 0xd636bc3d7d1dd3af, 0x0d1142c223040502
+, 0x59957e3e5c060423, 0x3dd2e9c9d11765c3, 0x747dd3a940ae7c72, 0x2ca0a7713be14855, 0xc74b66195f86d347, 0x165a5677451643ca, 0x63faaef16eb51416, 0x28c22cdbba1d75de, 0x62a79070f24063a4, 0x4872316b6f3e9487, 0x85f89c40635ecb18, 0x39c45d73ae1b9d0f
+, 0x1a55ade27c2c6cc9, 0x4b7f325277a22cb8, 0x1c80019604a70d7f, 0x4502bb9e210a851a, 0x496c4d449e9b741e, 0x054c523ecc967260, 0xd3eb81c4e017f423, 0x2b6d307a41c101c6, 0x36fa4ba072df9036, 0x3fbc59a744615452, 0x668e8998fb6e46d5, 0x28bfecc564a05724
+, 0x2c7dfc22a95a727e, 0x3479a116c88597ab, 0x74a5de5632d43b04, 0x54e93dbfc438b855, 0xcb42fe8d375faa3a, 0x045b4e839f7ded7a, 0xadfbb7272415d8ea, 0x42116142efdd92eb, 0xdcaba7bc0a261dbe, 0x0c7fce03c0735256, 0x6fedfc4830459e7f, 0x175e0fca8591416d
+, 0xca7d7fd6850d0528, 0x4a1f926e704b9484, 0x2e846eb716f4ee41, 0x439ed56e2cf74fe6, 0x4aa6e758b0308642, 0x3e03dcc0312b818c, 0x419ea4b239674094, 0x7ebe7f7e2a9e73f9, 0xc85972849711de78, 0x2ce96af5c3b48eac, 0xe42c11b41f371aa0, 0x40800517e0af5075
+, 0xe2b47d9e67721017, 0x08686c7baa3df757, 0x58b80e5f5c6cc43c, 0x06487d7b92b88a66, 0xbd9cd067c9c89e93, 0x470216f5ce42db75, 0x8962658d1358cefa, 0x47f1b403ab8f78c8, 0xc10c5b656affdc6f, 0x7eb1086e00bb394b, 0xba70b855e8463225, 0x62452c6ce65bfad6
+, 0x93566607d3a66cb4, 0x4fef9b419f56a776, 0xe125f08f24d1aee3, 0x3740de73b63e8178, 0x256046a3525b9451, 0x7a71b53d3c2aa984, 0x9a478012d78c3200, 0x1dc5678a56b0f9c5, 0xe9d2ad634f15c0d4, 0x348e6435e7cbdbfd, 0x396502eb3ea02b7b, 0x6fd5ffb290f89456
+, 0x696c223b60f63c60, 0x16ed6e7158960f49, 0xb70f4b00ec0585e5, 0x79675f64477fbf0c, 0xad5ec349081f9f25, 0x2a35f74a790a4809, 0x92e2c4330deb4f8b, 0x6d49b4951704afe1, 0xa5469f9e90e221cc, 0x4554104c84d83d6f, 0x74f89838e9b50339, 0x6f7973f0ba227dbe
+, 0xc932ee43cb9644fa, 0x55757d6a1d849e8f, 0x6edbb7b859c0877e, 0x04c7e51bed64cfec, 0xe43bb0f6aa94695c, 0x7314f29a6ebb440b, 0xfc0ab3eee0159438, 0x4c097b45fa76f001, 0x91fc74ec6fcdb8c7, 0x7f5fdd8c9f344f16, 0xf29f37c0118149ba, 0x0329767fd0730bca
+, 0xa813a71805daa95f, 0x757f6ddd9d166eed, 0x1c31fd35ab906f71, 0x4d8795bcce28b9be, 0xd06e47b918ccec3d, 0x410282d68b93e27c, 0xa06f4d5db6a06c54, 0x728d8338d3cea901, 0x9e16c7669fa61f93, 0x60badd0b1ceed57f, 0x25c39de7305ba2a9, 0x5dc7e7d596757fc4
+, 0x083e492c071cc4b6, 0x5bc39212c4b5a12e, 0xecdc7c9efeb978a1, 0x310725c675d175a8, 0x7d8e6e065dab3753, 0x7ddf80e4c14646de, 0x92ed6c0a5b688fdf, 0x34c73fa366aee751, 0x02800525a3022f94, 0x6d3828d25d32c2d6, 0xca1ff890670e7407, 0x3f6de9847e0e001a
+, 0x62dea3020d6d364f, 0x7d4435da79e557bc, 0x2a5d58a1ffa33224, 0x40154afa6d2d27fe, 0xcafb468e21d16273, 0x2246c76df2420212, 0x781d9dbc11b6740b, 0x6e200b50af8df787, 0xb40f33f855d95f10, 0x5b841cc05c0ad47f, 0xb7de4807074124cc, 0x4b34821882f5c35e
+, 0x4df83eeb9798e08b, 0x570a29cae5371b9b, 0xd64d672572ab0f9c, 0x169271bd397c384b, 0xe168f52a12139c12, 0x46a9c04b8fdd31dd, 0x57156a466b2d9072, 0x42aa2e0bf400031e, 0x4dbbf9f86d11ceb3, 0x5e6cb9526cd352d0, 0x865e04eb7ab2f781, 0x245c4a6b5592a3f8
+, 0x57237baec581a5c4, 0x55bac577ed493654, 0xe4b14781e7b68c21, 0x510b7e2404b7d8a9, 0xdeb013c961c3a61e, 0x7c6e43cd3c0e49b1, 0xf8101e2386f7003a, 0x43fc76c8aa358752, 0x4603cfcdf5d7122f, 0x67dff8ec6bf8053d, 0x706a401af2353004, 0x0e33babfa3381faf
+, 0xbf43e21807a7fa07, 0x30f4fe1b15629114, 0x32d99b9ffddf7fb1, 0x3676d5fa7f30936f, 0x2d7fac9e74263469, 0x36f25c5b46fb8cbf, 0x233935c53f73fd63, 0x31b78e2c65f1a41a, 0x84652291dacaa21b, 0x3fe29237aa3859bc, 0x8af5d17c0f272aa7, 0x41cdb9b409598eed
+, 0x6ac7bf8c77d23d80, 0x270f84841321a546, 0x5a160335420f2721, 0x6e1e51d157f72ca4, 0xab6e3b1c4acbd1d8, 0x1047f5383bedd763, 0x5a7995c28cb284ab, 0x06668efa51692c4f, 0x67ea60ab8c62c0c1, 0x6172c07df96cbb6d, 0xfadb6bf1a91b4c4d, 0x66684673dfdbfb14
+, 0xaaf20389aa3f6f81, 0x3970e220d53e83fa, 0x66b3fa8ddfcbcdff, 0x0272df400d389b04, 0x5048073e4d5738ec, 0x3d68de11643a35b6, 0x317b58cf65c0993a, 0x440b020cbccf11c1, 0x3f19569b08f35131, 0x490677f264285755, 0x90b394877b46e90b, 0x543582983e210cec
+, 0xc0c8aff16b19021f, 0x550ae97136e5e1f9, 0xcf8a1ec0cb2a1efb, 0x281384b98b25fab9, 0x7198b8a7e220b136, 0x4b4af5a083ca020c, 0x84fd41eb954eccd2, 0x1472f277b44b9a68, 0xc788b1c9a84ef6bf, 0x117f2419da649e5d, 0xf46cadb82e1d22d0, 0x77cc2f8459823295
+, 0x054e079db66dd9f7, 0x2debd68164569575, 0xbc885d0fcc742371, 0x1d9ff87a31bdd011, 0x0461ff3e9f4a080a, 0x3d0f7f2fb9dad13d, 0xa04d90dd6c158823, 0x4c3056d6334f48f2, 0xe79b2544a0672b86, 0x5428149e5699603e, 0x76988ba1f20bbf23, 0x787c645b04d2ab20
+, 0x5077ca001ee43815, 0x5a040b797e9425c7, 0xd83e41da13d7e53d, 0x52f3c87e9c314a20, 0x9ca19e3532f88de5, 0x5b290ad9a848450d, 0x6c26ccbcd1b3acf5, 0x481a751fa10d2db8, 0x8020211df6cc7b7f, 0x3547f9f127e435c0, 0x5266fd648f7dd9bb, 0x261bfc0eb136fb0e
+, 0xeb86d4b05aebd790, 0x094d04ccd30a54a2, 0x2d0a35e8b418ec57, 0x416f729bf0933b6a, 0x51ebb5ef98891cde, 0x0e8326549a2a88ab, 0xde8031509337e0bd, 0x58a516a78f410acf, 0xe794864ce8bbeb16, 0x4db4ac32ff382e40, 0x9eee412084483b4a, 0x6cc900077f7d2324
+, 0xaa7072859d42ea4f, 0x05562307d72ea47f, 0xa34bf40e1ddf0499, 0x7b35e55f82b6f29f, 0x3de7e2bb9d883c89, 0x7b12181bc76447df, 0xaea5808166f27d55, 0x76d02544be44577a, 0x8ea77db3c10e4880, 0x0a54fd97fea5fe94, 0xdea4131f1fe60787, 0x5211c6bea01a8b6c
+, 0xba2590e9a11d7243, 0x7cc1c929ee311ed3, 0x65aeefb60e6216e2, 0x07d34e90578bb5a2, 0x9a446704b2fb8a06, 0x42ae46cb7ca3ddc4, 0xa03272e38d3043d2, 0x2489c8ccb49460ac, 0x545f14c789d319ab, 0x22bfb0a13115403f, 0x0a317a85383b8a1d, 0x6765970c0974fbf7
+, 0x7021ab52df324056, 0x54fc9fd0ece27b48, 0x41aad132697bd0e8, 0x34454f0ffd3045b8, 0x719778b2627283f6, 0x4364370cc377469f, 0x6fa6f7e51a5058db, 0x2bc10aec7198bb27, 0x46886dc13d541661, 0x024ebe22d291ac38, 0x870204f5fa915091, 0x004aadd20f1ae1e4
+, 0x9eb5c27fb03cc390, 0x33a2523e20a15658, 0xddb70cba32ea8999, 0x5ca6dfdaafa45f57, 0xf71cfed593bb535f, 0x254a01faf1b21e63, 0x42a9e30fc61f27ac, 0x0f83de0bc0d9eca9, 0xea419d752eef44f4, 0x67445e3b6a957ea7, 0x53fd32af9101b6c8, 0x04289ece27967eda
+, 0x3a80bf7bc6b334b4, 0x0ba0e682e3995e0d, 0x0bec7091a15ced77, 0x4c1c72ed9ab08dc0, 0x63c013a86a7afb0d, 0x5980ee7306ce9be8, 0xbf098006142ef541, 0x0b8aaa9f3cbb64e9, 0x0f839ae3960b7656, 0x5a31f53a5a857871, 0x608a35b9ab5e99a2, 0x000954dd175456e3
+, 0x79b82ada087cbc2c, 0x3ef3e7e003cf6469, 0x8119e7581b4f4376, 0x4b9cabc14a94a229, 0xc237e2f411a1d949, 0x6e40b19ce69b8dd1, 0x5b8049d843aaa2a0, 0x49b8698907405d5a, 0x2b853486744c9e9f, 0x259cda9bcbfda609, 0x484ce1f89752435a, 0x6e97c0c32fd6457a
+, 0xabdaf41edbc10abd, 0x3f09ecf83bdd5bbb, 0xbae4823ef590020e, 0x010fd0d8a91344e2, 0x448e0161f5bb0637, 0x78824e9a545ebf93, 0x7a1f85fc7fc069bb, 0x77feee29e8e7296e, 0x1d0710af1fd2e73b, 0x219ac4a6288ff447, 0xdeabe019c10b09f5, 0x1897e3716a1590b6
+, 0x0dbc42b79813cd10, 0x0d6cc6611cc79cdb, 0x7270287fd82ae78d, 0x7ab50549d28e0313, 0xf0c6cad417d2cbae, 0x33e3141940419308, 0x27befabb658afdbf, 0x5fea0322505d3b0d, 0x341834d54b46399e, 0x7a73c5ae579e86b0, 0xa1c3ae88726adf36, 0x310bf631e3beb22c
+, 0x9575241384e6c4ab, 0x6ac86e14be432bd5, 0x605f3d05a387b1ab, 0x4c111241cadb5a5f, 0xb1f352fa9f673f8a, 0x63c9cd2123b0e276, 0xe36fa06c49d6ff20, 0x00dfb825ae2a43b8, 0x58610840ef65ad75, 0x162b9d24ccc4cc67, 0x7377786537f50b5f, 0x160763231e7cd296
+, 0xcac4c9232dd0ce31, 0x05bf4e71640cf40f, 0x49440a2952a68641, 0x21bd592a29aed14b, 0x1f7b2e347b64fcd6, 0x7c44863116c3a1d7, 0xa5e26e12e1a12e35, 0x3e805f9c1f04005c, 0xb939781fb91ec32e, 0x24fb38741e061aee, 0x556550a068886347, 0x282b1f3408ae578a
+, 0xf34f3625740ee265, 0x414ef96d662f101e, 0x73a4bd12ac49a64c, 0x15ce3f08ca0edcf7, 0x97cb1994adc2a683, 0x6794eaf590e0218e, 0x95c44d1b81d48498, 0x1b10598da203a9b8, 0x2fc57ef4d071a4e7, 0x3590e26e20b53731, 0xfa2d5db1355e3a04, 0x040629e4560284d7
+, 0xf673134d66d99c4f, 0x03b72c153dc52356, 0xc23c74eaaddf93c7, 0x6569d65845f037c7, 0x89d2caafa27fb212, 0x778c7a9fa7266bae, 0x44302f7109680151, 0x332aabe585b79e87, 0x452bd6af8d3d614b, 0x6b267c71271fba7a, 0x521659e78ffd2c32, 0x3d5b13ce577b39c8
+, 0x19f010a3aa949fa6, 0x2dfd7fcc600c60bf, 0xa4d37ab39e2b4159, 0x3e2fe051d163aeb1, 0x09d256a2f6ffe5f3, 0x3f52cfadd34cc093, 0xebfbb2eb0c52aebc, 0x7a5f9e749ca6ebd9, 0xd01918566ebd8de3, 0x4b7e7e07a42410ae, 0xbfec14da7429f65c, 0x403d024df9bd106a
+, 0xab1d6a4c41e576a3, 0x668596eb36a2b170, 0xdebf02a996cbf3cd, 0x29f3148c9e6bb0b3, 0x305a74a2bff4e9f6, 0x47d3d9ec66d3e53c, 0xd60525b39b8ae79a, 0x3fca19a32705cef9, 0x36d8aeb01cf47710, 0x6655951fcf7e7b09, 0xa6a1b196a5620999, 0x08f60d4384f10b9c
+, 0x03491d8fbda620c8, 0x53999f10172af466, 0xab8941c822418382, 0x7139d77ef74f8911, 0x354d0b138aeb72bb, 0x04d91e31e1c952cf, 0xe17f2b9f5b93369b, 0x36decee6261e0ceb, 0x0c62eba6684365ab, 0x1e034d36f24946d0, 0xdcc9902a71e9f311, 0x483e4d93754f98a9
+, 0x1de9a0f3a32b956e, 0x6b2fe21a445c37d2, 0xb08a891a67ae5343, 0x01e93a136b1f000f, 0xdef8c816fd04229a, 0x170217095aeac8f8, 0xf10c48ba8e34f4ff, 0x64aacb7531807c24, 0x3a93587b7f69b931, 0x40f3771580e3d8e7, 0xfb44ec6e09ff7f73, 0x29df33fab5986c92
+, 0x8ea7bb776faaafa6, 0x6452d112d80d981f, 0xbbc1b4393b899563, 0x37ad3b73257f0579, 0x1f5c1427d9206ea5, 0x465df0eb47938af3, 0x78b716180a3c960a, 0x29606853a0e4188f, 0x6e5a3be5f84eee57, 0x07364e3c1a7098bb, 0xcb2396d2b3bd1e5e, 0x7d165126b04a5919
+, 0xbd8ab0474ff8a718, 0x4a75d54daf23b613, 0x838e3f17d78ad2a2, 0x3bc7e493930eea4d, 0x471342a55fd37835, 0x586fc61d0f804b4b, 0x3eca6b62cf3d0161, 0x5dc8f09b7e4f17c5, 0x8d3ad87e7ab9b924, 0x32b9b52a844021e3, 0x0141a86dc1d34987, 0x32ac77e46a31b910
+, 0xa14f17afdba6862f, 0x4dd736976ed261d2, 0xe4483af68cc784d9, 0x39fba60cbbdf7780, 0xa7e3d8c4ce37dd49, 0x27c3439873c31313, 0xb961ebb0b24845b3, 0x6fab7b6a8b1d03d2, 0xe568df5e48d68347, 0x5cb7427122c6ee8f, 0x91bd4dcc86c2240f, 0x4a7bd7918aef5ee7
+, 0xcd8bc14c7a5b9d8d, 0x4380a3fa8e369aa6, 0x69ca8bcc990f29ac, 0x108be5e8012a2441, 0x6295158f8bcb9530, 0x3e0c5e40e202b11f, 0x3dd8efb41a9557fc, 0x091456b101e52fcf, 0xb6b310ad1a6410ce, 0x13cbee7aa055b8b3, 0xa4d36e5be93856dc, 0x01f9b5e1360c2017
+, 0xa74e864dc57ff096, 0x4888b6bc7a821045, 0x0a29685cde046dd8, 0x761ab03148504be6, 0xb9650c3ba21360e3, 0x7b28ed5f1fc32669, 0x91f1370df2ea1bc4, 0x2b2cf1c7acf14921, 0xcea0f353ccd35036, 0x6f095211936347f7, 0x08fedd06dc7c153f, 0x6e2417431b4235a2
+, 0xd2aa130c6285da71, 0x1b57e5cee79ec69e, 0xc5d2e127fa0d58d9, 0x00fc62e2c6aacdf3, 0x2ac84282cb1f0e3b, 0x51458bc017b60aa5, 0xb0487edd2da4fd42, 0x070677fc177344d9, 0x68ca04fd21868a59, 0x707222f0ac78dc4d, 0xf9198369ebab5b8b, 0x33e0be60d515cf25
+, 0x00f18c388e928360, 0x1e4552fa429f5959, 0xb4027814aa80fdc9, 0x066b0f700804b016, 0x840719fbcbc442c3, 0x00b0152efb97768a, 0x288ac815654b1189, 0x3ef780a5bdda7452, 0xc13160e1a48b0928, 0x4e66229e92c75dfe, 0xf15e6e92f927d099, 0x72058fef3a358cfc
+, 0x0b965683da25a89d, 0x67c8062fc94533d8, 0xf0016892dfd013fe, 0x53bc4e08ab1c0881, 0xfb98ad7822fd1441, 0x1c188aee7ab9eaca, 0x09b723e48b2ff124, 0x415d46ecaaf43739, 0x425f58f6fc6df893, 0x3d677f617b1786a9, 0x315a6b16bbd47239, 0x3aa55148fd5a2072
+, 0xadec200aaf198ba2, 0x50b79cb207febd16, 0x2d7ed669faa6a8a0, 0x6a88c8c596fee08c, 0x7b37cf9264759967, 0x29bdcad123688271, 0x8c24b21930f88c4d, 0x4a74d0bda5443022, 0xbd808b3d8b5a17d3, 0x4f2db216afde95c6, 0x01cfb2c84d1eb857, 0x765e4aad95762d35
+, 0x3bb5fe323e023382, 0x373c66baa66d80b4, 0x2d6e71ed35d0cf45, 0x24e4926a2862c320, 0x881f1f5889347d56, 0x6465d10f16621265, 0xcad16acb0ed71596, 0x365a8389cc48a9e5, 0x8bde3784963ee37d, 0x3f11ab7224918166, 0xf96a90b0c43d20c7, 0x230b8c304c2fa771
+, 0xc8449eabf1477427, 0x5471726f0fc16923, 0xe6e5f8f733f3eea9, 0x1fbb4e0d77084883, 0x83523d0f950cd845, 0x6206c5a6d8e7556e, 0xfcc272b8665e546f, 0x2d9cd60cb8411c55, 0x39846282c1e0ad04, 0x52dd9943c281dc53, 0xa46b08ae2827f5f1, 0x3f07dc3aa5253620
+, 0x0327a65c2b53effc, 0x2bd3cc8fba5212e3, 0x2afe981b525d1e88, 0x0d40e73e20f641be, 0x485af2707862676e, 0x752c176279dd9a58, 0xfef6a50ba678616c, 0x7ba3e97d6d954763, 0x69ab99996008e34e, 0x7cd7d3adcdd8dc2a, 0x1355280c5869bb19, 0x1e062770aaf0dc0e
+, 0x5c5e5a29da175353, 0x66289c195e0ee06f, 0xd8d5214e2d2b2402, 0x53717735337f80ff, 0xeda9153de497285c, 0x7144a034e33d3a97, 0xda301a677ec7d78c, 0x28a79f13f4025552, 0x7ad85fe40bf675c8, 0x082fa608abee33f4, 0xae54efdcc21b8b78, 0x0c91c9368bb18142
+, 0xb5a3c13d7a1f4099, 0x7404c384af6d5268, 0xe1446a6d8ff83bcc, 0x386310f701a48597, 0xb03c41a5d9e23c30, 0x536769aad5728347, 0x8ceef9b864274ec3, 0x05a9ea01f700abb0, 0x63e90c645515d6a3, 0x5030819b3c5155c2, 0xecb74b5af2039608, 0x64b457233c15b86d
+, 0x0fb972bec0a6a364, 0x3c827f142c144423, 0x1beb8cebdddd6fcd, 0x0992de56f06a7ac1, 0x7269f417ec989a18, 0x491a90492fe00b05, 0x825b0c1c48ca0c77, 0x249cd48243e519ea, 0x538aa71644d3bb0e, 0x25330fe0f56644b0, 0xb103927a426d7109, 0x70ca391eaccf6f59
+, 0xf2dc0b96af5eccba, 0x7825e9798dd02c09, 0x77dd8c1c428e6190, 0x7af6ca3fc62013ef, 0xc8d1ee0803962bc2, 0x50c025b75f7ca13c, 0x315a3f2e3ccfea55, 0x3911733adaca457d, 0x3a500656fae93ef5, 0x1cc366bac13bbdf5, 0xde574892a2b88c20, 0x162cc3660fbb758c
+, 0x4ee1c0b488266bfb, 0x4e49bc1a01077424, 0x51b2ee332c892d3c, 0x7eaecb27503b868b, 0x95dd0c93c55f5964, 0x24ac08efd5022322, 0x09715590a969d52a, 0x53b7b01124d30ae3, 0xd3f434009a08f871, 0x41640a3e556b0f92, 0xd9f55ee11bb564c8, 0x15ef34670c6e48d5
+, 0xa313e99f632c093a, 0x40feef246fc25c07, 0x0fc2a81df6a69449, 0x1732fc11c803b495, 0x1f9646fdbe1de9b5, 0x0575e0632e852046, 0x4e2e0dc972b1a9ac, 0x4dddebbd45c0d6ac, 0x27d5b5f56bf1acfd, 0x34e1b8eb30c5c89d, 0xf1b661bda2be07bf, 0x7de88dedbb153006
+, 0x295072a547c5e896, 0x376b052f466b5c02, 0xa8f85e8fe6f04072, 0x1db6f7bd571c042b, 0x91d338a8bdc099c9, 0x10b560f5cd1682ca, 0xf4258ddf0bc81aca, 0x179173e1c75bef3f, 0x56d763566ceb2b23, 0x719b6b5ebd236605, 0x44e0b3aeb4790bab, 0x6d15115109c9993f
+, 0xd46fb9900442b4f4, 0x351d074737024c60, 0xff4d63f71a052f09, 0x7b7a507daea43269, 0x8fbc2b20ef8e4971, 0x78e5f0f3834740ba, 0xb12c8f4338987a87, 0x22235abac845976a, 0xdb51c14321b31f65, 0x50356d0badf1ebab, 0x4d3d5b527345ac92, 0x7c3fcc91afc46bae
+, 0xeef24297be7c9866, 0x4d4fb936cbc147db, 0x353a07ef6d2da942, 0x608ec473d2fd71c5, 0x0fe82df9674fbd5a, 0x7c1d254c77705c0a, 0x493b8ea88d22c1c5, 0x4b4e8ff102dae37f, 0x9a6bbe1844c0f789, 0x48cddf4b4f06fa0d, 0x09f7a5cfeca54d92, 0x5ea8779716b24b8c
+, 0xf94afb55d6c6a0d5, 0x1da98de992c24e1d, 0x7bdb32c522d8c8e8, 0x3059fa313404802b, 0x53281634f07a8e0a, 0x14259fdd20e78258, 0xf1049043e149059c, 0x3250cddae9043fbb, 0x6284231f9eb26acb, 0x2f19500c56ac1e10, 0x6f9fb9d167b19b3f, 0x6fe270b478d3d03a
+, 0xd7f3a6f0afbbf1a5, 0x6a65033410831707, 0x73bfb5876003607a, 0x1544230f3bc0ac1d, 0x91a4ea61d78f5b49, 0x447df38db28bb8d6, 0xa4b650e0d89006a0, 0x62fba4c06888e8e8, 0x0bd9eb3046dc2927, 0x15673d4b8b6017c4, 0xb23977749ee681b4, 0x0e0f4ced30b3e391
+, 0x54502d2d3abef507, 0x3b2b00bcf07afb24, 0x06db3153eeddf918, 0x796cec5fb72d65dd, 0x35b9b5fed0382c95, 0x42b794a511d508c2, 0xf39ee1daffcebdce, 0x28624f5282089336, 0x236022ea87ed1936, 0x0c4e6ebe50bef456, 0x5da5f1885f976361, 0x174d9b46cb53922c
+, 0x79de636ee287231e, 0x48f9c0108b758b00, 0xf44798f129a24688, 0x2f1bb83153b2f8e1, 0xa24441c02f168b15, 0x6d91b8ca4611ba5d, 0x77683851f67981ea, 0x1c746b68e0452bbe, 0xf996ab126aa2cc3a, 0x2b85518ac084b624, 0x3b04f27622d4d7cf, 0x1cca51e33570af21
+, 0x22c755b77df66f00, 0x606c980092c1cd23, 0x261e45f878976926, 0x77c3c1f8b73ba1c0, 0x55d86ff30835c0c9, 0x17af8543172d9ceb, 0x714b9069ce20d488, 0x1bc6d207e2ec527d, 0x59646f2bfc988313, 0x26ff3ac9e24796cd, 0x518cf07e1a19c2f4, 0x2acdf80614f263b0
+, 0x43d40cd54b409832, 0x089f627d6f7ac1f6, 0x593b2f0f279e21b4, 0x48cdda3a40abb19c, 0xc8a330b178f0fced, 0x44a514ad0d128914, 0x859ee4f0f23f02da, 0x477ddc81f4f5ec04, 0x4500f3fc6af02ba7, 0x4eaa7ff97ea3c1ec, 0x740153eefe01dd5a, 0x58327d43bbaf0369
+, 0x187fbb090a3b599a, 0x2d70511fff0cf75a, 0x556a5988b81dd7a0, 0x7a0f109b3607b15d, 0xf8ae4303535337b1, 0x6b116a77ce1533e5, 0xadc5f40e501dbefd, 0x7ea5b5a2bc5fc9de, 0x6fbe3da3e2e9dc31, 0x7c8f4a3ed916a19c, 0xc726ae44991597fd, 0x761b07dfb5487616
+, 0x9e7e1f8ad40fb239, 0x01678fdca3b5e9d0, 0x0b8e14c978cb31ec, 0x79262653ffee0637, 0x24f4b7f935549535, 0x2a5ef5fb9d2066dd, 0x44099a0f1e48bea9, 0x0de8358d0513a3d6, 0xfd7a8d506d04af51, 0x44f6587db0528750, 0x70826c854568ade0, 0x331357c3d2e32fec
+, 0xd41e8cbe76646b62, 0x128a57209bb945d8, 0xbc3570046a794727, 0x5cad6db9c73c6e1d, 0xbb47ec94038d8681, 0x69af23ec7faf5872, 0x0b0e3bfb031a8687, 0x1298a897b79f92c3, 0xa3809d8c34da5670, 0x4ebdd75d8e017788, 0x7bd82d49e96e4c04, 0x5d7a8fe0191bf560
+, 0x9d061177821b8f21, 0x450f4b3e17d5af06, 0x48871b79316a807d, 0x325e5b3d98a1f7bd, 0xd29a94009cc8bab9, 0x1f37be248a7d165f, 0x8df1629a8f01d793, 0x22cc832b380e51f0, 0x467ff78642f260b8, 0x0e5017236bd26a18, 0x2a5136cbf5be2732, 0x7b0071b178ee5572
+, 0x80518d5039c9a456, 0x4994996791df9c3e, 0xb2182dc72f22fee7, 0x469512df15818458, 0xc013ad828aad5db9, 0x1da7d2983ece598b, 0xe4dc0fbf32c1748a, 0x313f8df518b440f8, 0x23cf0afab35f95df, 0x6a2b900134936a39, 0x22c421df966ba1f5, 0x38fbc24068bcd152
+, 0x75f21c2a7e8abfc6, 0x0fbd32d98d188796, 0x5954effd47119afb, 0x37b5fd1a2dd7760a, 0x833df34e9771f711, 0x0bc51f7a602d2db5, 0x25f8b02cb6710134, 0x0253efb6970bc9e3, 0x47b40737cf2aa201, 0x68be67769c820aab, 0xd364e3071f9d701c, 0x18b27c51f6953590
+, 0x3edad164de8270f4, 0x7f51f9d71bfe646d, 0x344e0fdb1c016350, 0x6539d2b76809bbd3, 0x4b17322621b047d8, 0x02a2df47f0cb8ffd, 0x40a1ff71a3eac8a4, 0x61ab80cf1531c4fd, 0x9425a7ef41fc74d4, 0x271dd7e92015c9e8, 0x9798ba07d67e0d0f, 0x27bdd29419b0341b
+, 0x899eb6118d10ec98, 0x62e7ba1e1cd69234, 0x0adcc098cd5171f0, 0x63896a3e32cbc03a, 0xf5e55bd09d1704ac, 0x3ea5ca7b107e9788, 0xc86d350591c99993, 0x149b4f2e02fd565a, 0x2f56c4f98d6f947e, 0x3f1d1c7387dcb87e, 0x4719feee158cce7f, 0x7e96740d5b73bcba
+, 0x7419c6985c66c9a6, 0x2d2000b3a7f0d6a0, 0xc715234207850ec5, 0x24f9da8130a90496, 0x7dae94b7d5970e59, 0x0f5a06dd87fcbd12, 0x3de0b90964ccef4a, 0x0603ed8573c2912e, 0x7f86a59f003d776b, 0x66bcf26a3b7d4a0c, 0xbd5b063a0483e7cb, 0x25e09b1cb8a0d2bc
+, 0x7a423a31904220df, 0x5b3165c747e8f099, 0x1c665eeadf35e22e, 0x7802b556fc45595b, 0x85a2def4015bd2de, 0x17f2ab87957166ad, 0x19cf6d352060c1e5, 0x122a7ad1be408e6a, 0x5b79bbc8645bf766, 0x20fb009d4d0adacf, 0x97526a272ba28538, 0x7041b4e90d420bde
+, 0xfb1869a4e9cc73de, 0x51a641ec2fdda28e, 0x0f32fcb73f281839, 0x30097e0744e045d7, 0x13851c1dc92bbb34, 0x14b219ffc0f52e1f, 0xac334b199e83ed64, 0x27faa65c4c9180d2, 0xfe1df72922127e41, 0x603fbe28ebbd3200, 0x2e42ae8641e7925c, 0x77efee04275a452a
+, 0x3b30113358dab057, 0x3d398b66f0d24243, 0x91a5999a03cd4708, 0x1eae2409cd938096, 0x66dd6b604c36108c, 0x1713083789081968, 0x57cad6917125dcfd, 0x34b06cb89704f1ca, 0xdcafe8e71f35abf2, 0x698331198d544db9, 0x6287676643af075b, 0x200950e5559d2b6d
+, 0xe31bf38f70a5edec, 0x0048786624a0c5e5, 0xf0592c2b2dffa7b6, 0x57cecfb514a82575, 0xa195765ab394fbd6, 0x1e2c7256535b555d, 0xdcf015f5007546ee, 0x7a71972bd3dc9c4e, 0x5eb44cf5acc9e7ee, 0x4c5dcb2acfa161a3, 0x0b7e866d40cb0fe5, 0x2ba344f33f614c2b
+, 0xa30c9d6f9b339ef6, 0x7c25925eb30ec0f5, 0xdffdecd64b097171, 0x484db05070a83ab4, 0xd7dbe912445cb114, 0x65dbe7fde2ebcd04, 0xd7eb83a8e3cdcf85, 0x4701f2c2a959fe11, 0x41dd3ea3f430739a, 0x52226802d2c5b29c, 0xd1c979798e33be27, 0x1f7d32cf2b25e3d1
+, 0xa7ae2b26c10c4daa, 0x197711175e75f466, 0x50f0168740eb4409, 0x29939de93b4e9585, 0x19dbc47716f66727, 0x7adcc96066ecbe2a, 0x03b653bfbf0f58da, 0x7f72637d207addca, 0x417f78e6dcdff16e, 0x637a3386072f8387, 0x486914ac9e922c42, 0x50a0a283b9bd5f12
+, 0xc12e5d2c71c4ca71, 0x5ea6f5e766f75c0b, 0x00d5f277e46aff50, 0x1f1b206bdec25c7a, 0xedef715b6f897fa2, 0x6466003eaf4cdaf7, 0x05ff5921188482cb, 0x1b01f7d0cc248c91, 0xa05976729f7d1a28, 0x5ab14ac1629bf4ea, 0x2b72569b8b2bd6ed, 0x3e03b90dc2f0a9b4
+, 0x131c918c9e0ef33f, 0x38d69db77f7b36e6, 0xfaa6fd3f323445bd, 0x58696fe5518eb494, 0x4d085be7a91ec4e6, 0x6ef06d3cdfaaf800, 0x5a6e0d3739e1f84f, 0x5a4455e66e594e1c, 0x92875f1a1c544997, 0x2a7bca6a0b280216, 0x11fa64acc7d84bbc, 0x535683a22175557e
+, 0xd4f63fc3ecdd9074, 0x7473317142ac13a2, 0x96b0030805319356, 0x2c20ffe0244378ba, 0x4889511ad26ac01a, 0x4ee327219997fcf6, 0x15ffe6e70f0bf8ea, 0x6b617fb4a6d0a6d7, 0x4916dca1c52f7324, 0x3c8269f086468277, 0xc24210c4c837e04b, 0x4e480b4f915a542c
+, 0xc4e2882822c10934, 0x313fb7b34b28f83c, 0x1c6c7b5347967ed5, 0x53d9bc8f4405719d, 0x7abd5645a9d2a0b5, 0x2729b03063bb803f, 0xd534f542f62e277b, 0x059272ca42fbb1f5, 0x2035c4f3ff222c4f, 0x473ac2e3bc383652, 0x6576d49eebfd1186, 0x2073217b086f09db
+, 0xc5fef3b09a7fe35e, 0x31a501de44fd84b2, 0x79f29e4940a407b9, 0x0ba7e03ca5cce5ab, 0xa7a8b2058a74d8ea, 0x46f4c7810e26dadc, 0x46171ace94a1128a, 0x44db55025495a811, 0x7f889e1a4bf18d5c, 0x4d4f172a43f306b2, 0x33a99766bb1cffad, 0x6254775924d39aca
+, 0x6ce5a2c4626ab9f6, 0x52fee3f27b755211, 0xbfd7a6b6af1d6a0f, 0x1466274530a0f680, 0xd06ab168d251f305, 0x038f34120ed29d05, 0x6c4f26120ed8d30c, 0x69d416ee2545c974, 0x1aca44a2682f3b7a, 0x560afe07c4a28598, 0xbcfdced5ff7f165f, 0x2347790b0abe76ce
+, 0x549e08f78a0d40ed, 0x427f21cb37117786, 0xb87c8e11b6e7ee1e, 0x6a9ddee040c18079, 0xf1de9fc3497896b7, 0x4ae83b1ffa29946d, 0x65f646058d3ded68, 0x7265338666247c55, 0xfd52118613cdfe78, 0x5fec452bdbdcbbb6, 0x16836bb92099f7c7, 0x036a3eebdde2cbe6
+, 0xc65e436a42d725d6, 0x1fdab1c3320dff4c, 0xe2a08777ec2a76f9, 0x7d6baad5cee49b14, 0xdf1ec49e58d73fbd, 0x72b7fabf9ad31c47, 0x28d92ad80754f0d9, 0x46cb036a0dd84bec, 0x6e5433325cd4b151, 0x35700422a0d29299, 0xeb76804b7ea0e6d5, 0x3f4ac9764090ebec
+, 0xd577bd714528d7cc, 0x600a938c8a92584e, 0x861dfa9cfcd2be62, 0x7dcee70f57213343, 0xcc2b353f588d7d0d, 0x4c21442318b1af59, 0x1a94ae609769ee90, 0x17b3f5494c32d8eb, 0x5a9adf3b3c7959b0, 0x55fd8fbccad16bbf, 0xc13f7f8d985985df, 0x4c4477d8c28a2d59
+, 0x437d7a6fb02f29bb, 0x3f8ee5e89353adbd, 0x8f19b3a457d96cdf, 0x2601207dd71d641b, 0x0986d0aecd461320, 0x737731aee7c03223, 0xfc590fbc14c997ee, 0x170592f98db8ee1b, 0xde76c3d52de1de47, 0x34004115c2876722, 0x513a6417351cb563, 0x6b8a2af916be5a58
+, 0xb7c46730a595c798, 0x4fb311d134b8b2b0, 0x26fefd27cfd8298a, 0x4817b2e2c2477c39, 0x9a660dd5f49815da, 0x749fa7fda91ac1e2, 0xd3de456a1d77de93, 0x661c71c2af9fb285, 0xdea20ba51d36a042, 0x76d80937e41341ae, 0x0bc2475864ac2424, 0x4cd5827df2948093
+, 0xabee228524b35b8e, 0x713c360a289491ff, 0xecfe6f995090e374, 0x61d60bd5f53ba0a6, 0x0cb6df3f1347753b, 0x44a5d6b1b6b490c3, 0x0b1c2961f45992fc, 0x43998db75eaa1d98, 0x834ce9fa599edf78, 0x1af37fd9d4d97149, 0x335c19ca8b44ca6f, 0x42259dc7f7932d96
+, 0x08f3bb0e8dda46bd, 0x20f5fffe162f3663, 0x111893b47f25aab5, 0x7ad9760637572524, 0xe04d72197dc09a00, 0x3ed004a7e3395fa0, 0x7d8a43c1bb6e10d2, 0x4b954b87369c1125, 0xfff21625d8371b04, 0x514b1ff03046aaa7, 0x3cc2379ce4c470f8, 0x1fa5ed56728da109
+, 0x517a314f71b9938b, 0x777bde1456713849, 0x7d392f5d15040224, 0x71ce5b5346e544be, 0xfa840d0df843e371, 0x431907a2e27a0330, 0xae615dfed0126128, 0x3c3d588ccab53946, 0xd76ec0d8b6639084, 0x6e3698463f9b10dc, 0x596d19f276527f69, 0x4fbd0d5075f400b5
+, 0x97ba1e5dc0654ce3, 0x639f2791922a29fb, 0x097aafaac176080e, 0x7903648ff1b89270, 0x883059e5dcc8446f, 0x7909c9dac3207614, 0x1023b5e6a8e57b6c, 0x71d39cf1b708e813, 0x350c734d74743998, 0x156182b6a60e94bd, 0x3452c4995503d648, 0x6082e30c5f65ddb9
+, 0xd482abe520baec94, 0x318ba9f5ea47d220, 0xf9f34564a89087c7, 0x5180481901efd08f, 0x627adb64b876970d, 0x4b3e6f99a9d67071, 0xa0fb43697920e4af, 0x1e546b898c944659, 0xb0f62a2965c0de1c, 0x5a22e78057c78f53, 0xc036ca780e1d230a, 0x418b0b60916a0543
+, 0x93c278b1e8f640b3, 0x048b5f5f1a72d089, 0x9d1a82e276acc94d, 0x226e8589d5abb8ef, 0x55564fc27d7bccbb, 0x7d966108062a68ff, 0x3dc2d95f398141ef, 0x66aa6b019ed6844d, 0xcf0b150f6912cd32, 0x440dc46551e101e7, 0xf64e680ae93a7cd2, 0x7f66f79b37ec39f9
+, 0x8f9c8100bccf28de, 0x4ac1b9fc99498770, 0xe2064efcbcc3f7f1, 0x497c48fc9b3f5f31, 0x2332b8ec2213f386, 0x234fa2652638bec4, 0x4fe4478fe0447a0c, 0x7340982c8cb82251, 0x1b920b236d130e0f, 0x4da5455267acfa91, 0x4b79ac49ed6939c6, 0x1d4904f442a36d36
+, 0x9b4f7c3e534d8c82, 0x713ff991d085d4bd, 0x297646558b0471cf, 0x5874588acc760be0, 0x7ab99e1d05a9b17f, 0x2719c2954f07912d, 0x4ed7be54f046ed64, 0x5d078586a85a25e4, 0x72c50fe0fae61a28, 0x445b58291d183117, 0x287dfb6dd4e5472c, 0x2dcaafe520258a2e
+, 0xa42b9d43efcbd181, 0x6f38fe7ee24f9db1, 0x64a2d6a43ddea58d, 0x46e4489839b7d52c, 0x0bad3332bf488c79, 0x7eab6fa7d6833be8, 0x148bb1fdd9426722, 0x11032d9d0fd3504d, 0xee8ece0178078978, 0x4f7e8aa3388fdfff, 0xe3cabe5800035002, 0x61bd2cb8bf9909bd
+, 0x38cc8789169043b2, 0x3f60f7684b77f3fd, 0x53211a61296da0a9, 0x313b133092ea0854, 0xb8d7024217ea9129, 0x4cbd4b479a87d912, 0xbb3b8185fd5720a4, 0x0fbe271e8c165545, 0x5071c5cbde43b789, 0x60ba2e4770379c64, 0xbc7d8f2c7f0814a9, 0x100f60ebcb04347d
+, 0x4292a0af16222509, 0x312fe34abc7dd7a9, 0xb16da182fff59c9a, 0x5fd42376aa1da9a2, 0x2fb0606a364051fe, 0x33370f287e621c66, 0xb28c72a1960be561, 0x0a28b45c06eee025, 0x4b4c7c7b234288b3, 0x3df3c2275aeffde7, 0x863a58314f9db76b, 0x28e2f5f61fe633f2
+, 0xd8cd1d8420515443, 0x45574e48a60e7642, 0x51146276a62cd026, 0x577c67868cf51478, 0x6382ee0e96695da0, 0x513d87c3a73c7b47, 0x39082f9ecb08c7d9, 0x72b3d8a67de0f9cb, 0xade8635a4c8a12bb, 0x2f6aadd4c31cf314, 0xbca760f2eae8ad09, 0x7dcdee4d4ad82bba
+, 0x4fbd585b4409287f, 0x0e68ac02418f87c7, 0x671581445f3fb26b, 0x24b3a49aedb14177, 0x1a29f91f5037fc60, 0x6a564aa2015584ae, 0x89ea175242cb72ac, 0x0f79c73cd88af02d, 0xa62643a222a382a8, 0x1f6e9068002e1d57, 0xca24eb428ad63b8a, 0x74d19634b72c70be
+, 0xdc5caaa04abc319d, 0x7e94d1fcb78dd6c3, 0x2b12cc320decea92, 0x2494050fca516a7a, 0x4510cc638d412748, 0x2fbe7b3112c1d820, 0x1c78e73361edf384, 0x760ecab0c5425cf5, 0xe6765fd09acf64b0, 0x1061131f8610f899, 0x2365ff13db84832e, 0x7614907c681bd8b5
+, 0xd9c09dd62f1e9220, 0x66b1ab149690a9c3, 0x20ffacc2d0f4ef41, 0x50456ced2a528d68, 0x52ba9c36ab48f037, 0x4a7a8ae1b86cf704, 0xfdda74a97f5e52f6, 0x27e8d12853a74fc7, 0x86861287de38e4a0, 0x04b4bb9c879baa77, 0xfd84ade9f73e6f5f, 0x0b237d8ee53d4ad0
+, 0xd855230ec225136e, 0x1c544dd078d9211d, 0x12fe9969f63f63ba, 0x069af1dc949dd382, 0x305bcf40cfe5c256, 0x63ae90924bbbb595, 0xe451097793b7de06, 0x09780cf39fc0043e, 0x827af8e7eb798871, 0x3ace8a6c77577a37, 0x79df061332e055ba, 0x561dc07aaacea92b
+, 0x4435d0484d07c319, 0x03dacc9ec0457fda, 0x4ea59cd65f41df88, 0x4ecef595daaeab9b, 0xb0649f2b2815f896, 0x41f2683d326e8daf, 0x11ca9cefcb307d9f, 0x4a1ba95ecd1e2420, 0x1e52435408749e2f, 0x2066680d5fa20bf6, 0x32b7c39a382deb12, 0x2b61409c98561ad2
+, 0x7e4422d9820d2673, 0x6b85df83e0af5348, 0x1f151ac1ded8526b, 0x35ead8e5157142bd, 0x6da6ef6c33c79dd4, 0x5f2ea04d2594fde4, 0x91037d0cc027d5fa, 0x53b5401007b0331b, 0x810f198a3d4ba5a3, 0x4463bd259ba94195, 0x32b894acec2acf9e, 0x78711761d64349ce
+, 0xd40013c53bf045a7, 0x13c6ab2f349d4111, 0xb1666ad37b486e6a, 0x60640a8befde1589, 0x26b206be6e50371b, 0x0b7568447472226a, 0xae86617c1f7ec465, 0x2f08426dfb43af27, 0xbe3f1805d91cb3bc, 0x78127b9b13079f1c, 0x5c999354a1fd12ac, 0x6df522462fe67646
+, 0xbc3413da20bd706f, 0x500320fa57d5aa2a, 0x1412ba54f9400b08, 0x7c6dca4962027a5e, 0x4b7fbb2f9d2edb46, 0x52c4547371713ad9, 0x20d5db357f4f7137, 0x68882aac2c2802d9, 0x6700f3f203c8737a, 0x733ab0d2c61b62a6, 0x860c738e13828f3e, 0x2642e2473b25d9aa
+, 0x34de9ca6fb3a7481, 0x21a70d5f980a3c8e, 0x4034a362d82e1348, 0x37854eb95eb12c4c, 0x248117e25bc1ec1d, 0x19b0a64a593e4422, 0x639408c63020f2f8, 0x3e2c07866704f9fb, 0x535e298bd263c8b0, 0x4e5b86fbea394db8, 0xc86af12162e05e41, 0x303804cf79e50b3e
+, 0xa09d75b53198d9d1, 0x572579c2ab8d2e8b, 0xe035b3a6327371fd, 0x3d42f50f4f3d90d0, 0x6c1c50be9e541c41, 0x50a7dbf8d543a406, 0xa134d2daf71f868a, 0x53fd5387efd7c58e, 0x078a050bb21f7d6b, 0x27d40994ec0b517d, 0x42058a891acae56d, 0x730611117f726de7
+, 0x339bfd1a98d0d794, 0x6daf11f23551be90, 0x753ebbab5a4d0782, 0x2653505061e85768, 0x4babfb78e53dc542, 0x2e8c6330910262ad, 0x237f2fc3f7f74e73, 0x09ba436d52aa461b, 0x3504580c268f9179, 0x13c7e49de68e3a4e, 0x01947f985963f72f, 0x5fc14bf1d3ce28e3
+, 0x253ae1b3f51fe211, 0x409e4b3f535b6463, 0x3a236d10da5e49de, 0x19d2b1029c21336a, 0x2835f40436aadd90, 0x0942a31505190b19, 0xc189131876828279, 0x3afe96c3ca8e1f9c, 0x9f1801b491230693, 0x39e28db8625fd091, 0x9fab50355dd44c8e, 0x145155da729b280d
+, 0x9d3004cbf10ddb6f, 0x5309b0d42631b9f3, 0x188a177cbcb74c8b, 0x2df2ab618ce3ad66, 0x97a0dacbb3d23d47, 0x749919b7d2b1629a, 0x49d1f99e4343c5f8, 0x0c2505b7f657c1fd, 0xbeddca0408aadeeb, 0x2f93264221c3020b, 0x859f65865047a22e, 0x63998513f95b423b
+, 0xd3ccf8101d4d76d5, 0x5a0faa1a8c2b6c68, 0x3cc66c84cb54ea8a, 0x51052ce3f566c773, 0x3bee14de65ae9ff5, 0x7586118a01ccf024, 0x089e791c896bf15e, 0x35ff022d261d93d6, 0xcd3ce13d8f7d1cf9, 0x4f1de98f95b7b8f6, 0x51e68a2462dc41b4, 0x61ad9e3c23f6dd29
+, 0xbdd3a932dd359d4b, 0x7abbfe9cfaa0f678, 0x5cb8310e9d89ebec, 0x7e7ab1d34d70b991, 0xfc35074a62f40ed7, 0x0adfb5dc37c58cb5, 0x2fdcaf757ea27a97, 0x610ef57d7db8961c, 0xc0e202e128ed393c, 0x3dcb71f104e3b5a7, 0x74b5cc85eb2cb175, 0x79bff089388d1b4e
+, 0xb043226e894bfbd6, 0x5e07ecb2c84c78f8, 0xe8c8462ba2de38d4, 0x524f6dd6dc643ce5, 0xf1c046bf2f715a2c, 0x2627666b3595dcdf, 0x5d35b1b769b3f4d1, 0x29818c20f8d3f251, 0x77a71f9dd59f5651, 0x35d367a3e4c9b1cf, 0x04d4988ca722b808, 0x429fd24f979451a4
+, 0x867f0a174a1cd9c1, 0x351c98db01200ec5, 0x5c334e9d5bb1668d, 0x214b5381f5b7d3b0, 0xb790d80aea0e5eff, 0x15ea4fe44295db8f, 0x7e2d33c4827d97b6, 0x65fc632d43585452, 0x4768cd8ba15af5a0, 0x6ea4e76bb3598698, 0x166a3ce0b0b926fe, 0x25f85f2885f2e06c
+, 0xc75936825b626803, 0x766d89387f2967a6, 0xdb651a2c537aa76c, 0x058b90acffe148aa, 0xdd069c6675b93aca, 0x3c1b78da1c60414d, 0x331d778bd7c2f5a7, 0x5ebc07079ce50d65, 0x634342660a93d504, 0x4c07f711db050d7e, 0x6470efbe0c7f9bec, 0x3f81f22937413a42
+, 0x7f8b6fb31e4ae9a3, 0x362800061e211dfb, 0xc08de8001b1ce9da, 0x313613545b1b5382, 0xca4caae7cfb994ab, 0x15f55a88b0199419, 0xfd52d5172184331b, 0x74923a37776ba8db, 0x47bda9deafb61677, 0x51a1dadfec8a2295, 0xe7b0c78a09286158, 0x674d29b91c5b256b
+, 0x6caa6e2093c88f52, 0x73653a49328163b8, 0x6ef3b1ece49cce13, 0x47f1a06b661a23bb, 0x2ba522077fe392e7, 0x428efc0319e349fd, 0x807c21716a5e23e7, 0x18d93afb3fb84c24, 0x743d1526a86bbda3, 0x030cdbaa0dd70e87, 0xb89ed30eca6a6c02, 0x5b34ffe8f5977e27
+, 0x2626358aa1b0d5f5, 0x686e3aa6c63b9854, 0x94a7d88720099862, 0x07903ca67f2ca772, 0x349e0960313b30c6, 0x705a0b4d2bf1f8bc, 0x3972f574e2ebe454, 0x76326a0140aaf0d6, 0x5bca8393307c3a6f, 0x5dfffc6b2d486c14, 0x93c7802cd13d5520, 0x5d5091c79ec47066
+, 0x2cff1fc1c3ddd533, 0x29218b0086063342, 0xf2ef89229bd51618, 0x7f71cc8c17d6ae19, 0x0ab9f90e25b65a8d, 0x44c538eeaa7a9a51, 0xb5cb97017f9074e4, 0x299235990e940991, 0x2b4f78f1709438f1, 0x15e4c96f926b62e2, 0xe566f397633a03af, 0x385d9df9f4ac0868
+, 0x88a45a7921d3d576, 0x0a70ad2a702b5cce, 0xf5590a7c13101218, 0x6f03f913d026bbd1, 0xa929f99648a428fd, 0x518bb03c8097dd71, 0x0c4f7947ad49ac66, 0x655feabfb81b92af, 0x04a7f2a010a9130c, 0x5ccc21298d34c347, 0x91fe4f015009e805, 0x40c62835b66fb166
+, 0x11fc926f91992dcb, 0x5e5348dee73770d1, 0x574df46d8079b953, 0x45c63ecb7d33b20a, 0xe4c470b9abcfa5df, 0x31b14eb60f01dc41, 0x496c5395f478285a, 0x7e01414097315b5b, 0x2ee2b92762928ebd, 0x7c6f64a8aa2d04f4, 0x8bd81382fc2cf62b, 0x6a50fc509e130f2b
+, 0xe197ce8de5ad640e, 0x4386548f44194d59, 0x3b654db2ea340abf, 0x2cafe858a8377046, 0x618458cfb4e68510, 0x186d53bf24eedee0, 0x0bf94d02413fc7ef, 0x418a29d251775c5e, 0x8864366e9d3f257e, 0x495680eb30086e10, 0xcb313d3c54cf280d, 0x07cd510261a7011c
+, 0xeb597d2c92a2e53b, 0x1385712018dcb6ab, 0xfee3dbea582e4c30, 0x56b5d01b1579f1a9, 0xb30420f533014319, 0x52a86c126ce79f20, 0x72852f0850c1569b, 0x59df2f547b7d705c, 0xd469f2360d98aed8, 0x211ccf7571abf810, 0xb6658bd76b230769, 0x5bb44e0bebce56f2
+, 0x49aa9e7858ec205c, 0x6e17281fbff7eaa5, 0x99b7ba263e3fb927, 0x4c38a115f454eea5, 0x6aa4f2835642e839, 0x0d92b9f71b171807, 0x4737cc4c73164817, 0x1041193d666d1bc3, 0xccba18ae044b22ce, 0x4acf392e6f8cba19, 0xb6612c2c2a6ff41c, 0x3337b2d5c2198fa3
+, 0x77e9b6225f9a4c4b, 0x0c3f57a63bf683ac, 0x41828d7dff295188, 0x7a620a1aa00e77ce, 0x47e0612c53524476, 0x3e8fac3f626c85d9, 0x0f3bf63c20da4e1b, 0x7e6a3b1131d1a42d, 0x54834ab7e40268eb, 0x1d3536c545ae269a, 0xe74e781f5e990a32, 0x72dc764eace2386c
+, 0x27b71dc37156c3d3, 0x16266d7387a4002f, 0x00c3b5e16fe25639, 0x283ebe09a2efea45, 0xc78da3babd69d501, 0x1893541e03b9764f, 0x2a2973c7fdf75cab, 0x526e35548c53dcba, 0xc1ab023d702c5520, 0x1c5d907e6abdcd7a, 0x688d79e280e22890, 0x1813210c68c6c514
+, 0x9ea4d32a780b377b, 0x4bc3ac83c7c6e861, 0xc889b4bb6a5067bb, 0x7cad0304fdc70d3e, 0x1ba28b038d732019, 0x3b17491761b06673, 0xf9d5496dd161a62a, 0x206898bdfeeb3af0, 0x985a68c265c4a0eb, 0x1f042f682cbbd6c2, 0x48d5e4beb13a2cfb, 0x33af21ad3186908b
+, 0x2a1a69d800a8751e, 0x237663eb6557cff0, 0xe3353ea39952fb95, 0x2e602d2b71f75b7f, 0x8e879163957f9b19, 0x396b2926a5b6e27f, 0x7d3a6e96ae11a5b5, 0x5f9a613c0255ea22, 0xa218f9d52562a3d1, 0x5e82f106b05c1477, 0x9f3b376ea47cce82, 0x21324358dd0a3118
+, 0xc13256baf53bf2e6, 0x7f2d8bfa948b1d32, 0xfda462166cd97363, 0x6a9b451407668abd, 0xbe3fdc50033fa6db, 0x52560490059eafe0, 0xc1d54e2df3d7c85a, 0x097e7f0e2f10ed37, 0xec82197ec0b52689, 0x6ed1931e16ee05d0, 0x93aa389045ecc7c8, 0x515c4aee5c9bf392
+, 0xd4121edbf8b9bb2a, 0x127b1b8ea946441d, 0xeaca12cb073747b5, 0x25034e5913daff79, 0xa7ec45f7719edf2c, 0x1fd039d91577167b, 0xc871f7cce09f1102, 0x6b798a4c9761ff4f, 0x22bbba2d932208b9, 0x02b8703437d36c83, 0x83244f89982effa9, 0x5c59e07d43bdb1b8
+, 0xb7053912469e8879, 0x41f9f67709f57292, 0x4d86d1a72f019577, 0x05695b26bcb11107, 0x67b87e6eaf5743ac, 0x257e8ec455e910ff, 0xf9b491ef6faf842a, 0x3f87aaec9e84473c, 0x532e22c8e69f6a00, 0x44ba1e0e499b468a, 0x09b4c5d1bcfd8bda, 0x521a8d4d6feda8cc
+, 0x5f0b202ecd1393bb, 0x106ca17932464628, 0x4aa9f2ea7b493a7a, 0x73c4f9d2ee0d8b4e, 0x069c61e368fe6c3c, 0x387d9de2246311ee, 0x15f1049d1d31ab16, 0x7be9ec3d149b7dfb, 0x6400d928ac723481, 0x426f8ec60e18962c, 0x4965284f023ff416, 0x483a70bfa91bb707
+, 0x0eec1dc0550b345f, 0x26facccd745a8de1, 0xf94d9dfd05c7ceab, 0x2090c6c54c8a5c9d, 0x44541aa02cc23c0a, 0x3fcea87eaca0b8c8, 0x3a711d943d038b57, 0x7dc061b2fdede211, 0x05ef4fc6f43135de, 0x4154faac8d50efdf, 0x80bd5990a6ffdabb, 0x184256ac65083921
+, 0x5de53213f67b7261, 0x36434c7504f0a08d, 0x4fce1a4b7b5c0f0e, 0x2d61d045e05dc780, 0x9d4ac30d138063a9, 0x75fcb952245f9147, 0x2aa507118b076e94, 0x7a34c46bac14b9c6, 0xb5375dcc5c874772, 0x2a731e8c6192ef92, 0xa4a4a4ec7e4e861c, 0x3f1dd1de651d464f
+, 0xf7f6fb8507b3376b, 0x33eb11cc33187baa, 0xbf73e38c5da29497, 0x2be006390a397d6d, 0xe0b67e40d848ceb3, 0x4747f7403cfe7ee7, 0x04e7541b95f37c18, 0x4639678c47e0a32f, 0x30eafe3e2282fe22, 0x5bf1d4dce6da1a8b, 0x3f55f9cf38a25e6e, 0x55efab665c5feb1e
+, 0x9e525e5df93c1246, 0x4a135931b5107574, 0x3c1167b937d779e4, 0x5f0449c719b0ee1b, 0x81775a5a1373c803, 0x2a36b4118e621e69, 0x1bdc956e22510a8c, 0x2383733b129b3305, 0x88d41464fff61a40, 0x1065f2ba42bc6db0, 0x4b69932e5e8ca888, 0x2920317eeb354095
+, 0x2ce609b112bc3aa3, 0x2d03402c7db9c7c2, 0x16aaba92347af288, 0x29c90d62b2c08fa2, 0xcb4296e22882ac88, 0x1673345d99376579, 0x243c7562745d1b4a, 0x3dab90b84d7fa2f3, 0x5bba69e8557e0c70, 0x4e122b4dee91a109, 0x53ecce70ed0a2007, 0x63c5aefb9ed83547
+, 0x55b9214dae74a074, 0x0bb0a0eabb07330f, 0x21a8903b701312d5, 0x771ab96dd7777d6d, 0xe0135655b696e7f2, 0x1f8de8b496219044, 0x6388f7667807297e, 0x051dac1e1e15ce1c, 0x76920d5d7901be9d, 0x2012fd6500aa71f7, 0xcffd5fe2a8db4cb2, 0x33d9c4b9c2a20e93
+, 0xaecd1ce33b09f1c2, 0x0ad5201659e0a904, 0x73172cf09a9bd608, 0x631403da4b3a2c2a, 0x943313d93494f1ae, 0x0023c939f6e85ffe, 0x22b82912c986e045, 0x44ea71997cfb2323, 0xb7a5e75cb10a3742, 0x49f668cb2331e823, 0x329a369660db1fd4, 0x3a7fa17f4181da73
+, 0x8f39c8be1ca2428e, 0x66ff84dbc5c1a73e, 0xad1506f54769e470, 0x4b7f0dec8402ba2e, 0x060c8d32adac1d2b, 0x6399a600f04401c9, 0x186d1e7b3febabc5, 0x12fa8b36d69d4920, 0x84d29a0ac21057c7, 0x28eaf6f1bf1959dd, 0x8772b9e3d3b4c72c, 0x3d2c66d3e7bc3a90
+, 0x3fc55115dfdaae82, 0x2f0df645f0bf3fbe, 0xaf8c10068d12bdf1, 0x63e74fb31f329857, 0x77afe4c6ef801344, 0x18365125ca0e3287, 0x5b6dbd5cc751e9a4, 0x39114c53cc3ffe93, 0x0e31eb9587a66fea, 0x12e9f41ce13ce0b4, 0x6136271ec7f56310, 0x790c74703dacac08
+, 0x850138ab3fdcc242, 0x220c8937ed00042c, 0x58ed53a84134243c, 0x78eedee1c8e23b47, 0xd7150ddbceefba99, 0x7b35605da04b972a, 0xded29297934336e8, 0x61b66ed8c1d7504a, 0x6821da05d6aac096, 0x02dea97a64200ff0, 0x62505e4719c81744, 0x6970a474267e425d
+, 0xfab0b5090d9aa427, 0x311a2108d069930c, 0x5f61a2ee47a00dc4, 0x7d152bb1805f24b6, 0xe86203ce4efa7a28, 0x1ca9784203ec7ce6, 0x99a7cf3cee00302b, 0x64a497503e8ffc8a, 0x71dedb0b4c59049b, 0x38e58dd42d0c0a10, 0x5704672ad807bdeb, 0x6c0272ac2f72be07
+, 0xb14a9b5737917594, 0x097512a73a8d1ebf, 0x15de69f097db29be, 0x41385a67701f0c5e, 0xed7d5c46eaa2d56b, 0x4902226f88e356b6, 0x4ac9e1a00734c462, 0x644bf0a6e1a4e01c, 0x38b66ac99c24c52e, 0x76864b708fb562f0, 0x8b3802a6afaa70c2, 0x6802f6f24eef5261
+, 0xc280ac324ce4b24c, 0x2df22647ba424c5c, 0x893e302d6fb44b54, 0x1ba10c2fb8ba0986, 0x617ddf096664135b, 0x7d2a24a0077bf6fd, 0x4e7e9a1421298b66, 0x6120f080a9e88c68, 0xbc8521ddcc5e3f1c, 0x4d4cb5abd883e504, 0xac0c5b0e299f2854, 0x6b10ef5c0ff03de3
+, 0x63eaf4f45eaf3556, 0x74aef1503f452f38, 0x1eed805bdc9c1f76, 0x3c8dc5745e9476a6, 0x06bc24cdc7893846, 0x75e0b26c510d3354, 0x073d9dd5f79844df, 0x5ccdbe3b73e93279, 0x993d3350bcd1b070, 0x175bddf03cabdb1a, 0x76c70c1e7322af20, 0x306df889fffa337b
+, 0xf19001a1adffe925, 0x752970df77d7a97b, 0xdb08e0c5798b66c0, 0x23b7c1e348598e21, 0x463b5e5b76cdd741, 0x398fe796b2a230b0, 0x033c2b037a8b57cb, 0x79f7217c71746f45, 0x704845f1eb0b4d86, 0x3afdc6eb697fe172, 0x453d0feee24bef0c, 0x638462e132156cdd
+, 0x071bee134241294b, 0x4714223242a6847b, 0x838903efc32f699d, 0x66ec0f53f1fb37e8, 0xb553528c42b39b87, 0x2c75a8c285a140b9, 0xc5e7817a9594f253, 0x57eaee418b9f8173, 0x997d78a336c3fc27, 0x77687dbd0c12899f, 0x4d53d0800aca8937, 0x161702f35efef892
+, 0xe2144c49bbe9a816, 0x134e3e2067720afc, 0xeb4f4ceb00ee6228, 0x0e6692c0fd59f26a, 0x29850ef96fd875ed, 0x2bfd98e6ac17b487, 0xcafd5214d7aff65b, 0x69328f5b09c9114a, 0x89d51dec5f5a1ce4, 0x45218fba53edabef, 0x9d0daba65733ffcf, 0x3fd7987a77655edf
+, 0x2e1cc281df53db2b, 0x6ff45809d106f7e1, 0x91b1dab34b98d0cc, 0x286db2204ef1df00, 0x30329ff132b1a789, 0x01d8012775b8211c, 0x1d185ecb6647c454, 0x3615ca07a007b93f, 0x34028b656d45e2d6, 0x46777e68239ddba8, 0x8ec60f47bb930db0, 0x58d89dd7b471cf75
+, 0x412749322816991c, 0x2b08a95ba1c44a8d, 0x0e81598a9eab6576, 0x08119f990c1fb29d, 0xa3899acd98ae8830, 0x0ac20310e64b9d61, 0x70de1617cb32dd54, 0x05f505f2de713e67, 0xae99954dff8420fe, 0x7cb8b570aebfc4c2, 0x322c315bbf93db1c, 0x1fb4a11c4860d444
+, 0xf0dc1800bc8cbfe3, 0x22d1ed5a9d350199, 0x167579c0b629f966, 0x0e9176967bda5f68, 0xbd430194c42eaa0e, 0x1d27d0dfaf69e876, 0x2a969b2456c2cf67, 0x6127fc10595bce03, 0x7ea4a15673508636, 0x705dead91e26377d, 0x28d2b9b38b9d84f1, 0x601ac67c0a0e66f6
+, 0x2a1d6eff051d8c00, 0x27745d6e90c944b3, 0xc35a218cf817d527, 0x631a237b46b766fd, 0x08e8e830643818ce, 0x5be13248782f14af, 0x9afc646c81fd2996, 0x31382b5fa0c1c708, 0x46ca116fc70bbbac, 0x67e233aca53dd9de, 0x73f3a047e17ce503, 0x6499012c09561e8c
+, 0xca74972c899119d5, 0x35bfc18e721da758, 0x0821b6a3e70543a2, 0x3008796843156fbd, 0x3158af38b03e0f8b, 0x6168162ae518dbbd, 0x23492afada14d78a, 0x6ef2e6fb67ab25a1, 0x39b9afc95f132507, 0x1dc484833af87082, 0x66624052e1e96ad0, 0x5ec8681ba53bfd43
+, 0x0848619bd777a492, 0x76dea9e486c75c85, 0xcfca93d9a19e2678, 0x39021358ac11f00a, 0x47dfa156ea21c7ae, 0x6804c78ac77ab06c, 0x646cb38512ab97c5, 0x43c572e16895a228, 0x2302e2354a9a55cf, 0x1fc8832e5e342b45, 0x0dd75e3e8f573891, 0x3e65ac25fdda1e52
+, 0x9963693a92641074, 0x2da21699adb5c294, 0x1c9406787fb0662a, 0x1f366a13c6ffb1d9, 0xd93b3d57bdb6bd34, 0x04f98df74fa9fc62, 0x7e65ae6410ac68b0, 0x144f8b511c31003f, 0x57e23976e02ef6de, 0x53d209ec921cca66, 0xc4161aa8167f5765, 0x290a688082a046ba
+, 0x54249821cad7eaa6, 0x7308ca3fb738a158, 0x2d3b16a71c112740, 0x03e78de1afc1a413, 0xa78b19aabd0eb2cf, 0x4ddc390ef4afa4e2, 0x20c1a5c1ac42d40d, 0x355de624852da6a6, 0x53f9a390f4c71388, 0x2bf737a2841dc005, 0x71ce94f39da15907, 0x7b1b4e82ad1a0b4a
+, 0x0e237003a3c9b6df, 0x1ba4ed50a36c35bc, 0xca8476e28faae926, 0x55e36ff660683d56, 0x39a1a1b05e3b5282, 0x512610380f4d6770, 0x711900306a7e8f78, 0x7825ea5b4e54ce09, 0x4f6d37fd9dcb3b24, 0x38e2b8a1bd4b2b77, 0xa54fb9af616711db, 0x691625200cba7206
+, 0x04b0295514d45c18, 0x09e6d42af8c740d8, 0x4a5bd65cf9a47098, 0x6d306b74fa1189c8, 0x3551f4e556821e5e, 0x48acd4b498136f30, 0xb4e9270b6c26f7e0, 0x77e39362aecf9866, 0xb7563066060c095f, 0x6b869ba3842fc3bd, 0x4b5e2286a2d5f4eb, 0x313e3fb2dd139c1c
+, 0xedda2d1b5fcc7335, 0x0ab5146843570c4a, 0x66c2e15647833f86, 0x60b7978a76efb047, 0xa3d9f51bf7ea3216, 0x22c564f01c53fc9f, 0xd0456a4663a8ae3c, 0x650b536338bfa793, 0x532fb7c179dd86a2, 0x3cdf3c726e78fdbe, 0x9becabad6e8d1e70, 0x1a29b9899ca9dbf9
+, 0x5ae002214e316219, 0x4ee9cbf2ded253ef, 0xdb31e0ac7012bd8a, 0x7d10550d20ee3453, 0xda229941c25495c7, 0x0207f0bc1b724f3a, 0x0316593cdac6e7e7, 0x32a7005b36a9ee41, 0x8ff240e657b006b9, 0x588d3a1cbe23efac, 0xb7fe9f42304c3aad, 0x477351058975e9b6
+, 0x6cf1302280be79ff, 0x21fe3eca20b3103e, 0xc0913c4d5a15e31c, 0x1288ca0ab4ec1f90, 0xbbfdbec5d39066a7, 0x623cd81a2edb28e8, 0x6fabe6f16ad7b7cb, 0x66300b25b899cc8a, 0xd74f3ac3a9d77b27, 0x0ae87e73f99950e3, 0x80b61be37c8c5caf, 0x14f02a46b9a7a656
+, 0xa302435fa7f7c1b5, 0x5f1c391ddc69d375, 0xd6494fa13cdd7123, 0x11a86c0c1f99fe64, 0x1cb15e6ae9c9a672, 0x4304b91b4b2f8477, 0xdb98819adaccefb0, 0x4955960fe21ce66a, 0xbbb85ed11fec6fe0, 0x5ca35f770e1a774b, 0x031437e0e403e1b8, 0x164e2bcca9657900
+, 0x0cc192418ecc789f, 0x464b83118f6750f0, 0x6082132ce348998b, 0x693943c3d1e82639, 0x52d21e9cdb882168, 0x13e63d3a80f61f23, 0xdc226927785de45d, 0x124484f387e86ae0, 0x1946a081a2206d9e, 0x3f240b5c47a5b2ff, 0xf601d113c440e7f5, 0x6fd85e5227010b84
+, 0xbd90cac7c3df9df2, 0x6e16abbee6dd4551, 0x3d5e14b21264475f, 0x41bf25d807624516, 0xda531e99e3763e9e, 0x2ac4ec39375db632, 0x558bda5821fb2993, 0x13c6a64b480a0c17, 0x0a9fcaecfc3bfc26, 0x3f41a0a16cb716b9, 0xedc7f807683baa25, 0x01e0cc43f2ba4083
+, 0x679b22559f6e8e4f, 0x45a6abdaeb0b2490, 0xebf5f89bfb0b26b5, 0x632c7022549ed004, 0xa7711611116e773e, 0x1821602b141a6442, 0x0a1c1e107a6b6ec7, 0x66e1001be99a2615, 0x289906b8dfd4c185, 0x20138f164235a083, 0xcbe0d30cb5b0a727, 0x41b2465503befa63
+, 0x2a93e0d38202df4c, 0x1f4f5352307bc876, 0x5a34e313dd7be97f, 0x6b037689e7addaa3, 0x34146612033a5fd3, 0x34778aafb0d299ad, 0x0777814d1cc83383, 0x0b6fdf08e1f32656, 0x78ad780d76bae937, 0x0d1277a1bf41de0a, 0xc5816964c79f2e1e, 0x628940820d63d975
+, 0x23562de5bc8b8c38, 0x2d49082e1c5e4544, 0x6378cf76b8f9bb35, 0x4dee31de05c70d2c, 0x9f6df477df70b7e2, 0x0b3be49e97cbbb78, 0x0cc6a35004485e6e, 0x2e9b3918afd1671e, 0x8c4bde9c29089b1a, 0x28fa247952f2be68, 0x735a91530cf07bc3, 0x1ac2f38ccb169f4d
+, 0x9b7de9e8147870cf, 0x009703b0ea2e6a40, 0xef9dc7f80cbc296d, 0x5b54b298973bf4d1, 0xffe6b1dae96a4ab9, 0x477c72eadc95a466, 0x22d90fcaccdf15ca, 0x29c63dfe030dc635, 0xc761d12a6d6eff11, 0x210fa05fa3a4abd5, 0xeaeb215d4e6a55c5, 0x5bbb1dff72e180df
+, 0x4202d9ac83b0eca8, 0x4800c09e7d0872b1, 0x2cd7b38f9390a2a6, 0x4aeab358981b4568, 0xc126fa69f24a68c2, 0x570147004cc086db, 0xb1cdac620b7e0540, 0x59d4997089c7614e, 0xd1a63cf5c0c3ee3f, 0x02e1307bc6495bbd, 0xd8f8e8186d6bc0bc, 0x0783bf3024ca64a5
+, 0x316acac40263e086, 0x52c06ad0a28bfe29, 0xb8dab60736079dc7, 0x029522137aa95c06, 0xde4dd4e547cbab5e, 0x366966bb62651331, 0x4d1b8c29cf3cae02, 0x5e34e6167cc8d38b, 0x6b17feb9f519719e, 0x0c0ab2aaf4c06213, 0x167709fb0bef27db, 0x582b060a31f09fef
+, 0xf93b04686ea7f529, 0x560b116a63c0d81d, 0x89f06824b5917f6a, 0x480196051573c8b2, 0x57b759f00244d294, 0x3679263cdb2e2a0e, 0xabedf5fd2e4bac19, 0x4f43aa8c5ba8f372, 0x933cce401454b49c, 0x1912d43c04392d50, 0x3f66bfcfe71ac77f, 0x71aa112bab28e16a
+, 0x9fd93962cd9200f6, 0x7908bc7083f6eb3d, 0x2a6b331f26c1179e, 0x586d8b0c40c67d2d, 0x20aa3f3c8f856fb1, 0x621e9617e3f1aef9, 0x8837780ae2aa8c28, 0x60aa895a8e0f86e1, 0x0b60d267d8b42caf, 0x4b94ef14d705d430, 0xbe7b3fafdf611e71, 0x6cb822398f0db4ec
+, 0x601e63fa42b862a5, 0x5e56a3562fc45ac5, 0xe374b17cf8df7104, 0x1e4a23506d7ef80c, 0xe391ed2cc38f657f, 0x62e13f9b69bb2fab, 0x74ef4f34f91f8571, 0x48cb63f1bb68e2fa, 0x6ab2289b2a18e1d1, 0x0ea96339da802fe9, 0xe2e54801adfdb571, 0x1495577aeefe64a9
+, 0xabc5792b31973dcb, 0x60c962c789f37956, 0x7c35a12305a45057, 0x48bb25f2aa758bdb, 0x12421b5952f79c53, 0x2814ef0335312eb0, 0x41c2480aaa9e26f6, 0x69538ec2a22b4386, 0xa6bca95aa3208385, 0x6937ae31158d72b3, 0x93f6377bda27f0da, 0x604f5a1865dd235d
+, 0xc02e0ede126d7a6d, 0x18b1081e27ebe262, 0xb681e2c33011a034, 0x19fca8db6a0dacab, 0xa88f67767c4479fa, 0x01c2077a591d318d, 0x537983aa2f76232e, 0x7df089fd08c63a13, 0xa0a0d78725a38f61, 0x01995d994cd1e9bb, 0x002b36cd1da3e7cb, 0x5458d9e63f737c85
+, 0x8dcfcbe8cf8cd30a, 0x4b74f5e65194cba9, 0xfe6904bfc01e0513, 0x09c6df2c838d8759, 0xcea95dce0248d281, 0x36a88205e786f715, 0x79c7e55dacac33ae, 0x0c850b5cb0977c11, 0xba7057f25fadd943, 0x731738257542f949, 0xe4672a12df7a4b1f, 0x4385f598555f3374
+, 0x47066e9274e8e3d0, 0x420bf54fbe784bab, 0x1afb50511cdf0bbe, 0x17c726f4dbdd99b7, 0x5978a8e1164ed066, 0x55bb56225948fa10, 0xfe5874df634ef00c, 0x2817389373b3e3b3, 0x16fa472fb000b237, 0x25d431f940a5e288, 0x59e10048080e1e85, 0x205c3116df5c8749
+, 0x4b144300fe9a1f89, 0x416f8f6ea8eaeed1, 0xf900220a96be74e7, 0x74541741a4c3b85b, 0x3d97f4b6fd0d12b8, 0x513ab9d319ebc1f2, 0x7c73d247d7c45eed, 0x67a669e486114521, 0x6b208f1829882a83, 0x79df88bdb71b4e85, 0xedf0b2db96e13ca1, 0x7cafd2dc453ef88a
+, 0x5b98f72f4bcdd20d, 0x096f36d37e101e24, 0xabd47206f87782a2, 0x1394fb57a4e22a58, 0xa125697bbb73e0fd, 0x44d8eccd2f6721ba, 0x677b0d8721982ec1, 0x507e915576c33f63, 0x83eafc9d62430b11, 0x39ccf59289ca6fe3, 0x0223fc0ba52c3972, 0x1b3f63d271dd02b7
+, 0xf1a0f7210fc6faaf, 0x137a793f76ad5fda, 0x792c9114a4e4fff9, 0x11debd9b1b8f75c1, 0x399c1d130c4c0e06, 0x164c611c9311b2dd, 0x39660475e5715da3, 0x2e93ea8b91146c8e, 0x26297fedb55c71c2, 0x735edfd7613b00bb, 0xca213fe9fe39cc04, 0x1e0ab69568dd8bfb
+, 0x1ad9e35c3af4f868, 0x48fff73c3f0e8d51, 0x7258c74212166af1, 0x1cb14fdf0044b92a, 0x6ee1389b06a8f68c, 0x68379d0fab4923f5, 0xe03adc20af362ee0, 0x364ce80cc164f2a7, 0x30818921123ec182, 0x1c7832e760851ef7, 0x81a011a968432ada, 0x5ad77db1c7776ce5
+, 0x926588e5a418c223, 0x27da5e8dbafe1848, 0xd6b0b590c62ef8c3, 0x6a945037b4e3c1e8, 0xb49ff896f54d3b12, 0x303fc7c150ba1073, 0xef5f38d279fc830f, 0x3320bca1ed9a9604, 0x5d84fb5ccbb56043, 0x30054804bbd52470, 0xc1a36aa568bee9c4, 0x429cf9d1e016135f
+, 0xd7668261d337c525, 0x1925723ec3ddef89, 0x38597b79665099c1, 0x2ec316f0c8fcf23b, 0xb848d3afbbee0702, 0x1354d3e4be29ce41, 0x035470bd90a29917, 0x22bbdc6a659c6028, 0xceff8b55a61376c5, 0x04a32d7ef5cfaeb9, 0xe81f39bb5113fe20, 0x0e918988a2ddf31e
+, 0xdff601a5fb08f3c6, 0x290efcad48348386, 0x682813a1bd7db3cc, 0x16f01df7c99f6e1a, 0x15e7b64effe94749, 0x211a566ab0d61a2b, 0x131e1b39c7788694, 0x7939b00ca9a791d6, 0x8f1b446544e749b5, 0x48885523dfa87632, 0x3f60b2cab1a0254f, 0x459f9594f7be91c0
+, 0x2f6db5a19bd97c46, 0x12ead8c1d6cf51b3, 0x3531328e4a746f24, 0x15e8f209e9b8e4e0, 0x4be42864b38bc32a, 0x5a4ad13ed8d69bd4, 0xd3f9f101e32a8f71, 0x5e098b39cf827e22, 0x6a3cf36e8c77c77d, 0x7fa1b7fcee110553, 0x32ed5ad98dfb1899, 0x69defdb52f264d99
+, 0xe738e37fc46e55e4, 0x4399554009b55e41, 0xb40c8d9682d0fbef, 0x7cfec41ea367a1ab, 0x3c5211d2c956c92c, 0x20ca3afb5d66312d, 0xe2e4e7d767cc9d36, 0x701cb9e3ea476fff, 0x55e6edf4e2cbf54e, 0x0a690bfa0b1e746b, 0xb1b0d023bce793c8, 0x1616f3a573da15de
+, 0xc5789136f1b596c8, 0x13060d41a7dc290d, 0x4e921ac4d7a2926f, 0x7be5b7f8a3ef0c7d, 0x6cac85abc888d95f, 0x247317d18b84747d, 0x7a4f9efcf07c85ce, 0x7602b7aff33fddc8, 0xfe9b6a7870ca890d, 0x13acfce0c4c7cd6c, 0x749413de7a5e3ff3, 0x665bebb9c3e4fdd6
+, 0x844524c62a60e497, 0x5639a9624a77f27f, 0x57b613e80cda81cb, 0x536a2e1161895c8c, 0x3afdc59f097e385d, 0x437fb790d20e760d, 0xe779bffc6239691c, 0x344ad2471e618095, 0xf1c6ec1ae3d1729b, 0x219e40c38822615c, 0x33817658d145bf07, 0x193d15fc8e0dd4fc
+, 0x42c0a342d3e7324b, 0x4057910dbb85fff5, 0x7e33e7fb8bb7cac6, 0x1bb9a17ecb8fd50b, 0x1c89be9996541eb4, 0x6c83b4c72160de51, 0xc1fa51e734bc287a, 0x4ab3b48ea0eb7eb4, 0xec73e95ccd72a63f, 0x6ac91adc026ac701, 0x9947b54241594a7c, 0x57678670c5ba45e6
+, 0xeb706b3c3b2c50f2, 0x216db3667388f763, 0x928878cdaa6eb9a4, 0x039f87fa2ba39763, 0xef5ec5f6ae599fe8, 0x48d00eae708e859a, 0x7941263be18cb426, 0x3afd2fa6ad12fcec, 0xf530d442fb642a55, 0x7f2b93cbb3ed0c42, 0x9d8bafd91c01bca3, 0x780699b9bc754bbe
+, 0x165f1d5bf24eb17a, 0x779878c74f143e18, 0x54c7faca64488a7d, 0x0b40f50a9e6bd543, 0x27f823605b1dc401, 0x61b81884aa46c8bb, 0x0f5b49cc74b53b80, 0x1f2ad67b4bbfa974, 0x804ee1769116751a, 0x3fa45c45e34c9f2b, 0x98d0c5b1f9614d8d, 0x48780673512a30f4
+, 0x63aaf4528c3d4710, 0x5fbb6df88de89a9f, 0x637d7c78a3ebaaf2, 0x0859c209dff37dbc, 0xf64e06497ad19913, 0x3793ad90de50378d, 0x1566ee3d17b57a8f, 0x6ff1c40bcf3841ec, 0x80317167aa076b37, 0x4ef3abe9fb341b53, 0x1a477ac7048610ae, 0x4c2c9c8d415dcd6b
+, 0xe1aec9123db2fc45, 0x76233e1ed1b1336d, 0xaca88b396602608b, 0x62ec307962984b1e, 0x159c31a4f6a2eeff, 0x622e3b9bcc318e87, 0x5a543d6eb2e2ac02, 0x00f0839471a7bfdb, 0xa2af1cccb76e6520, 0x164d79fbd602f33a, 0xdee4088d4d0b969e, 0x2e6ab2298fb8eae8
+, 0x4d5ca6a78fea4b5d, 0x59d0d8d002e85b3f, 0x00c0eb7e7107c6b2, 0x0de1b3d24630c42c, 0xf8c60753b7e77af3, 0x34e30a7f12ab8428, 0x7614f8bc0ab8ac61, 0x3ffe3551e389ea40, 0xd95c2a43f5c5c5ea, 0x3110bcedd76cfcb9, 0x400e06aa7cb46540, 0x05d19cf4ae46b05b
+, 0x0ea951c1f24d0fa8, 0x4210354b4c926df3, 0xeb1f745a628e18e8, 0x52ea4a5790bba365, 0xdcee2662e07fbb6d, 0x1b5e6c807ad1d40b, 0x70fdf9c3dfe15f5e, 0x41f8fa284bc6dcab, 0x7dd1f131c4239ea0, 0x2050ab5c4336ce50, 0xa86f19774e05dd14, 0x02fbfd4ea655c224
+, 0x584fea6480ebdb51, 0x5d52fe073f9decf3, 0x9afe483eadf336d5, 0x1dfa03c980b1696a, 0x55f73d47ff819a19, 0x697bf55d361100ed, 0xded4804446399419, 0x618c94467fce259f, 0xf2597ff1f08ef50c, 0x07c935b98dd933c0, 0xbb758cbc78ded5f6, 0x1e9a0d06af13148f
+, 0xa91e30c51647a92a, 0x0a9d1deb82e4dab8, 0xb225259b5d002846, 0x4839bf1ca6bdca16, 0xae413c93f7ff0e83, 0x76d66ed1af839d77, 0x3f7e28978d3b03d9, 0x7ee178311186c783, 0x38b0c626d4aca16e, 0x1ab300e35aab6a35, 0xa97cd6aca31eb895, 0x34f48fc47aa50507
+, 0x879ce1457f4cd4db, 0x28396ca1962d4994, 0xf5095a3dc57605c3, 0x1e570f3da4c527b1, 0x2af69a3904935787, 0x591ee376fdd01cce, 0xf77b58df88bc8633, 0x5464d651b2f395d1, 0xafbc096b1e9a86ae, 0x6ce2df4bf65b6b28, 0x3b3a828d2e9d3e08, 0x6382011d8d2d66d0
+, 0xe780588ed64bc839, 0x0afcd9a4f3d04b25, 0x2bb24c9fc8ff330a, 0x019198367b19f438, 0x9d8bbe65efe436ed, 0x2a13586438800915, 0x790afe4730f5ed0d, 0x4685f693be9ca9a4, 0x1a501f572fa4b1a3, 0x1f1ac61fec48e5ac, 0xbcb530af579de8e5, 0x6f22f718b3ec6bea
+, 0x46e7e25b09eafacf, 0x46b078e24307a1ff, 0xb5042a032e373014, 0x6a4f0e7f5820641c, 0xf89aa050edcaf55c, 0x6aaf0332cd4aa34a, 0xfd17ae025b8881cb, 0x16d2928bd632b49f, 0xe6d3a35255b8e6b7, 0x6ddc4f228b5dbc08, 0x2cfa8784091278e0, 0x1830a810938b8e77
+, 0x909efac14a8c873e, 0x36ec4511d12dc709, 0xcd96bd1137579e52, 0x117ef3e5a90a8ca7, 0x8303548d6e33c461, 0x51f6f49e22c32d5a, 0x4c00eeefa5f47d12, 0x42f20b28b8c4a723, 0xe02b2807f355997f, 0x423386465e46ae06, 0x96013da707526d3d, 0x5b53bb98d16d744b
+, 0xd3674ed64acde65d, 0x55f8c7d37db8eeac, 0x196298a87359e528, 0x3612f517ca01144e, 0x2b91e4c348b3cdb8, 0x2d1fc7a552b86093, 0x03797f6d4c8437f3, 0x49615d8ab07bb784, 0x67d0410981b0997e, 0x56b87ab4fb61dd7b, 0x6965dbb93bcb439e, 0x2d636ffe2b3810f6
+, 0x11a91047404ca909, 0x6445589e5629b6e5, 0x83f9c50da1dbbeb9, 0x23349172a422d8c0, 0x9e99d99221445a6b, 0x712e6ad34a77c857, 0xc9b78eb901fce1f5, 0x4397cef1aa709cff, 0x6e419105e5918d53, 0x23d78f3397f4de36, 0x9a1f4bd5d9363f1a, 0x6469fae1ad390184
+, 0x94987ca64d3d193d, 0x50ddf70d3b6d56af, 0x8d5df67cc8ad15a9, 0x39208098bc5b1f92, 0xce99f520dfd5a4fb, 0x323bbc87b86a7ba9, 0xe13f88a8d803c789, 0x56ffdcbdf2200055, 0x3aff0da31b24c72d, 0x70011566460c0c16, 0x76f7b7f53ac46a13, 0x1c069bfeb7077bc2
+, 0x00115d250c5583ba, 0x73860ee57af3c0c2, 0x56d6722620701cae, 0x2a73e5e60f42853c, 0x8836d3842b8b6704, 0x5a00c64c65e307e2, 0xcc3f664128766cf4, 0x12f7ac1200fd219a, 0xe04f257f2e1951d5, 0x2b57c124a1aadec5, 0x955c452768c0a895, 0x2fe70455b2c1ff27
+, 0x8f47193ca14a3c36, 0x6d73e34af088de3d, 0x634b2bd9317d6634, 0x5b404738b77f1ec8, 0xf34fabb71ca1cb1d, 0x054abbcaca546a46, 0xe8cdcadd08eda660, 0x6971abbf958bdef1, 0x41338557dddb4eaf, 0x1e158585b079b67c, 0xd2270474cfa26068, 0x53b36d32b3cea469
+, 0x04794794cc52a060, 0x2fc0f7310db6c03b, 0x0f33e9b79096f0b6, 0x52392a5c614178d1, 0xcfad5e35f9afd726, 0x6af0ef423a06ff60, 0x3a6c88fc9342a255, 0x056de8540b912f32, 0xe6a6517b0571e209, 0x5b62f70a55fdfb54, 0x6fc654d3112f3fd9, 0x6de77de0fe546f7e
+, 0x9f07777d3172ff23, 0x793d958698aa052b, 0x2c4556bfe8e5ed2c, 0x4955992e22d54a37, 0x5f9650e12f37fe9d, 0x1dcef7b58809ffe2, 0x80e2bf1db99c69b1, 0x44552ef73fe5139d, 0x184be96b316e62b3, 0x712f4319785247a9, 0x9102fe86e519adb1, 0x15150c6b653b4e28
+, 0x5ce3d30ef986f9b6, 0x2b68b8d2cbec25fb, 0x936f810a0e7c3383, 0x0849b77023bf8e11, 0x023a342f06c7286c, 0x0776a1ed8f0a3dab, 0x43893f53aff0b599, 0x61872dcb62fc93b8, 0x4c3359b4fe7edb40, 0x2e29457d0a1f587d, 0xf42b6c0b936e1c85, 0x5d14b1391ecbd951
+, 0xe2110ff7ddf051e0, 0x21847ea3de2a485a, 0x2b5c3278004c9b4d, 0x4d2d83127b0f511f, 0xbeae5f44b0942e14, 0x339e24f64a69c76a, 0xbd26f25ebed82f09, 0x2cf29574d3f23614, 0xdaa17ce87de8885f, 0x79c4bd34f50d18e6, 0x012619b27128122a, 0x1829dd8edfaf3755
+, 0x730fe00178198afa, 0x2e9b667f14790957, 0x85ff3a57f613337f, 0x30e3fcfb0d023a98, 0xfd30246500a17bc1, 0x348915af92647f87, 0x9cb49d12b46ba7a1, 0x3301fbf2fb39b11a, 0x026399d4ef9464ad, 0x29f62c34e2f5f9c8, 0x3a68f826be199c78, 0x0c0171ac0d6a6ca1
+, 0x679207433c107b51, 0x3353e3975e633bec, 0xc01d21e5d7764959, 0x3296a1703acc8f86, 0xb9464bf7a8832bb9, 0x2351b24900dc8378, 0x720d15918695df93, 0x63d4dbbc140fc8d9, 0xd1ea45e92e772c7a, 0x262b36a6f8f3cb6e, 0x3e31fad9b3c4c03b, 0x13f6b8dc1ffe0860
+, 0xda664b4be647dc12, 0x14a403f0d1ca5e03, 0xac9efc2d0e77b55f, 0x575b7943e7c2e9ec, 0xfe4fa7a22ad8ef00, 0x518db0634f517f96, 0x211b1c67c6fced60, 0x1a3ed6561e91b9d6, 0x5b8a0b1ffa6357a8, 0x70a4dada9929a24c, 0x41dd6117b1988e29, 0x21be23897ffb1832
+, 0xd8c8ed8718f75306, 0x298375e3d67c930b, 0x3199f7bfd3347a88, 0x3ed78403135b8505, 0x67a1ed5df2db9ea5, 0x1977dbbada9178d2, 0xcdc9b356bd852376, 0x7e2a773c132cace8, 0x0083729810e43627, 0x09c2c4a67e70aea7, 0xdf09d7b530a20f0d, 0x5e566616cbdcc7b7
+, 0x7a49022ed983acc4, 0x482c5ccd4e583520, 0x326b12b552c74f30, 0x25b32e6b7ab67a19, 0x392eacf95179c8d8, 0x2e38ac68f83ea4ec, 0x4c1bb52a6e61149e, 0x2386a9d4749001e3, 0xfb6884557504acfd, 0x178c6f37b17c11ef, 0x3385324fd24d5718, 0x2773d310e772e6df
+, 0x7fb0745cbbb5f8d1, 0x4b4515ec056668c7, 0x7c92f9c46af07b99, 0x0f75878180f52d99, 0xb80580eb3a5ec09b, 0x676ebe4bb67c55ce, 0x0c9acc8bb25ae150, 0x7ad0363b6292030b, 0xb0ca4d9b31feac1e, 0x3311f4c26ee57bac, 0x8c76cab6d7ee0db6, 0x28a1ecc4932b02cd
+, 0x2f4413e6dacce3cb, 0x2f414e487ab5c6f9, 0x83d50a36ac5d9625, 0x06c70e6d2f544c05, 0x89ed537b52267aea, 0x15288e6627f6ce59, 0x0926878443bf4189, 0x57f12eecec8d9548, 0x74b1e018ef8e387f, 0x0228c9fc6e57f605, 0x2b1e3a1eaaf5c0c2, 0x5ad249e6dc0aaa49
+, 0x52abde8198e09124, 0x73fe604e43c1293f, 0x9c1762a0b2df5121, 0x31802f335b7ed5f0, 0x2f7f809611899e2e, 0x2630b0176e98ecc5, 0xd5efa214650a18be, 0x225dd410568a16c8, 0x264705dd2f64b257, 0x0202667ff127caba, 0x6873a922124cd48e, 0x49c7329797b94908
+, 0x76fad18692fdccef, 0x4c63dde3bcbd8101, 0x99aa39a3bf84428e, 0x17cdf28c339c5aa4, 0x9ff020d0969548f8, 0x6756c7c635b593e3, 0xf610fa01dbd0dfe8, 0x149becabfa4be628, 0x9ad930a4aa8e6457, 0x56b61dfcb4015105, 0x9608941ab075dd5f, 0x052d97e1b3d38e6c
+, 0xc119d4aaed275f8e, 0x543baffa94b0e235, 0x77accaf61cc1a0b2, 0x72e7e643d3845367, 0xe5f25f24fddc2664, 0x29473b6d98b4c030, 0xa545682d9cf6ef13, 0x49648694e51568f2, 0xe84e532a0faf2208, 0x5967987d64653c81, 0x7952ef3b8a43ee51, 0x6263c8e9830dc03e
+, 0x89928b8b2d90ebd6, 0x09028d39c71a08d6, 0x8d08ce4a8263476c, 0x115657dc0d2ee5ce, 0xd07ed8efa1df260e, 0x6ba418fbc29bedcb, 0x99d9eeaeca8bb8bd, 0x2283fe420b443846, 0x74c21a99b398593a, 0x5b053666fa556dc1, 0x92409bde7e8a2fbb, 0x004b8a73713c3b20
+, 0x22a65aafbc2e3da4, 0x199a4bdc29744571, 0x352563b61c79aec8, 0x7462ab8917211f8e, 0xaa6021cad73fc2ea, 0x21c0261ffd93a841, 0xecf09cba62e68e31, 0x7ead8a395953f42c, 0x336d00963e749a1b, 0x50c9580c7f9426ec, 0x734b86219eae717d, 0x3c618c17147ae878
+, 0x3011aa4d9722d703, 0x7d8dca7bb29ab5bc, 0xda186f63e0e0247b, 0x1c01c67847b1993f, 0xc647798217f2c1ea, 0x3b1c4ca8be681db7, 0xf39c86bc9e8515a1, 0x416bafe0c664f172, 0xeb7ad768f450dc93, 0x1e0342b9de12993b, 0xcbf4f38b6bd4a4ea, 0x2f90ffda71129ce9
+, 0x45e7706b60d3480f, 0x77e221c469e343ad, 0x2d2c9252bf8c461f, 0x4f13b4c82e24f486, 0xd549cc4f21dcd30f, 0x08b5ee4413434b0f, 0x7a83553857fc3d77, 0x3f0984b51f5623a6, 0xf2939aa4fdba640d, 0x6f5d743492bffa37, 0xb9d166c727f9163e, 0x2c231d093a718246
+, 0x79ed94ddeb0808a1, 0x55fc622bfe87ee28, 0xff0653fdc18ff317, 0x7bffc97440e1a3be, 0xa7d5d19171f6c3ed, 0x234077430e8c25f3, 0x550f78749218f886, 0x418e78fc906b8384, 0xb5b938dcf35b5535, 0x76f33d5ca25d865b, 0xde8c6847ceec20e8, 0x77e6a05e63c921c7
+, 0xa403c9b49a2f8cc7, 0x3ce14f0b8e101b8c, 0x1da051cad9984f5d, 0x13277a6fdde33211, 0x36b6dc23ee6bae9f, 0x6674624e21588d59, 0xad0a843afb2958ed, 0x3401e7c9df5bb293, 0x9e5c2ab8aa07049c, 0x02519d37579dd348, 0x8b2a3d1679923e11, 0x20290d65f695b548
+, 0xcbeb750b19c66fef, 0x0a7658d85ea1e3e2, 0x92c4d2408bd32902, 0x19853ddae6c1ffbc, 0xfa4bcb353e22736c, 0x37b775bd733f0c57, 0x57ef8db327bcedf4, 0x198f404a20fffd35, 0xc212e2cc71c345d7, 0x3c357aff93a50c8b, 0x4a742ebb0e51017a, 0x429c0d7a6ae171aa
+, 0x011523c16c543d08, 0x4668e92c5f73314e, 0xbaef3ebe4117acd1, 0x04037d1aa713931a, 0x68e118e4e390c68d, 0x6b80cd55a44c1575, 0x7307ea8a5729c032, 0x5cc5475feee99ab2, 0x34450e424c14ac75, 0x3f09157e5db3dcd8, 0x62ce2b1b50588052, 0x27a899c54e652f8f
+, 0xd0389f87aa339f39, 0x08bf5e869ebca1b4, 0xd6a09674e61ca3f7, 0x640871d732132677, 0x44806456cff74d97, 0x0ee7a6bb6f2da4df, 0x08ca565e13881144, 0x51ac90f0a4b08ce8, 0x70a68c630b6bfa43, 0x0c09a838b4a26438, 0xf8898d8fb159c426, 0x627972f16d03c43e
+, 0x0acd039f2fc2a5ed, 0x4b4044ddd5813eec, 0xc04d189e90a75958, 0x242551bce71d33a1, 0xd95af96b51f87f05, 0x02988820f809d815, 0xb27f65f73b9483c5, 0x2ef60745f4364b43, 0xcb66bdc93f4fb8b9, 0x2b86c9b48756bb8a, 0xf8ebdae09b9867a1, 0x441e70184e6fe9aa
+, 0x2009ca6597ecfcab, 0x31ab0972481def92, 0xaa20333f96fd9fea, 0x4cde56e1c652a456, 0xaa650a6108927a7c, 0x277b3a73cc0f1a15, 0xb2996efff15fa29a, 0x7892e0e8fcbbb0f1, 0x57fbabbc746beb14, 0x0ad82c10a0be4e16, 0x5b674135006c300d, 0x73f3fc757ae11e41
+, 0xec9c7ca0ca7d0517, 0x0a69e3bff0cbfdec, 0x9f2f46875de771f7, 0x1f098f7d3a90e854, 0xf5f5d56aaf07d2ca, 0x14106215831f085f, 0x673cd51d457f1ed4, 0x4e5e80f18bff4eac, 0x58970558e69611f8, 0x4970a00e85f2234a, 0x1b671dd3d1a567fd, 0x185278d67010b5aa
+, 0x19717302e8cf590e, 0x1454f9a68e5cf362, 0x3908bd722960c48a, 0x651d9d053c2d0ca0, 0x4d7f84a5549cd1a9, 0x2a0db50b7267dcd2, 0xa5eb9f605d3c667a, 0x3776299a26627156, 0xd58bc59a758a4df3, 0x6bd2bf8a41087625, 0x214ebe1d7e7ca2dc, 0x7d2865ed7db52ae4
+, 0x20b28ca61070363e, 0x1a0098ae8a6ba7d4, 0xe4c90d02bf68cc83, 0x666875e7d9568cbd, 0xee369e6509d538f3, 0x1f72eec876cfe0be, 0x579b4f5846a953a8, 0x7ac36af5c40a1dff, 0xed464736d540746e, 0x780fc775b13e2aa9, 0x8f74fe035dee0b44, 0x289839f6b1805e52
+, 0x1988d15e2e20ae27, 0x1d2200c79254b913, 0xf8605726753ed137, 0x2a9dc3745fd0d5fe, 0x0067ab65b109eae4, 0x4913f429f22694ac, 0x2eda4d489d53b6f2, 0x66d93382bf7cd0bc, 0x7a1747ccb7a11bb4, 0x5a0f11236435eb26, 0x9e51ba0df40769bf, 0x141b088332af9023
+, 0xfdc2530330cc1289, 0x47d8d65a8b4d6992, 0x8c03b6fa30ae74be, 0x1ca8693cc3bd99d5, 0x699eb1511018f2a6, 0x3da04764d9f4fff5, 0x361720433d3aab59, 0x2fa911612cb857ff, 0xa4057da10c2f1cac, 0x48a219b933a5c619, 0x42341020d15f0bc5, 0x73f8895046a09dad
+, 0x26c078dd877b4a3b, 0x336235aa6ee272f7, 0x94908e04336ec652, 0x149f19c800440336, 0x7d7228dc9bb92ded, 0x2044b4eeee1e3385, 0x07d43f6f72e48b82, 0x42c5fd229a2852f0, 0xc96786a3b9053252, 0x39bc92d3a88bce3c, 0xcf4a1b6fcb953e72, 0x2502b71d454ba56f
+, 0x1bad5312c67421b8, 0x4194771b368e622e, 0x8cc71a79e44e0dff, 0x4b4564e45467f1c2, 0x7759f16aafe52093, 0x391b71dcd75fbea9, 0x2a1c0694ab4ef798, 0x023087545444130d, 0x4b7ae1ffcfaa1aa1, 0x64e26f32d73361e7, 0x8da47038bd0b54b9, 0x148cfa6feaecee15
+, 0x7ed5f67a82ebf5f2, 0x774d01e4118b58aa, 0x62204139562ab897, 0x15259ba80b8cd902, 0x297709c5a14a3499, 0x05983d1882b3660c, 0x824018c5eb088df1, 0x6b1e281fbf4a79d4, 0xc5cf66ffc56c389b, 0x4648bfaddf51a836, 0x06d4374c1b4844b4, 0x7a67935cae5095f6
+, 0xa7ec5574e8c51b9b, 0x3f4c7feb2d603369, 0x832a294beef6799f, 0x590c69761e357df2, 0x8e874c779c06f8ea, 0x5a696317ce490c18, 0xb77285c6486753cf, 0x4bceb5bbb17ab6b5, 0x7c9eef51e20bcdcd, 0x4c124825cbc7fc9c, 0x4881d514398c73e8, 0x37b15686ae509c95
+, 0x01e4352a161e6773, 0x240f882c612e67c0, 0xd214165e767c999b, 0x451fa692e46f2bb6, 0xaf917be6a759e330, 0x487966d7208ec5f5, 0x30a5585d0f4b91f6, 0x62d973d96cb569f8, 0x3274f598b7b535c0, 0x01c328ed6d7ac0f3, 0x8ad68690b1db93ac, 0x30ac5eb11db4b4b5
+, 0xbfb958f519bc814b, 0x61f1005f2e40788c, 0x10b4ef4f7cc08a3b, 0x5576bb806885795a, 0xd834a29829f47495, 0x0ce80b8cdc8dfc93, 0xf7ad7ff6ff41cee0, 0x78fe0e0955d76f9f, 0xfe36cd333b9ad2de, 0x6172c8663cc3cda9, 0x079bb8118a1656be, 0x1eb13179e40d25b7
+, 0x3609fc03584ade99, 0x37f36e604988f2eb, 0x0a66df134988f534, 0x5a3e521f13f5b689, 0x415a2830b477af71, 0x269c06efff0237d4, 0x62a0b58cc468669c, 0x1bf95efd027b7243, 0x4cf33b3a57df34f7, 0x19b9f66ed6d210fc, 0xe79dc476d07a701e, 0x61febd7acb9aba57
+, 0x272cfc281b5ff6c7, 0x016ef45b0c83cb36, 0x5e1fa08bb4f9e71c, 0x22ac88509a21ac45, 0x064f7d056b654cc6, 0x7d3fa5b444f17daf, 0x0a4ef666f2d1fd64, 0x4ea2e8c4bd3807b4, 0x84f3227840d8648f, 0x7861720fc00d2710, 0x5606bd86a87af247, 0x04345dfc850ce08b
+, 0x0c51aafb4dc67fdc, 0x746fafdf92ad9eed, 0x38fab98f6f54f53b, 0x2e3b7170df649707, 0x6dff782aa45e0450, 0x79abc3ce7ca8da7d, 0xf41832562b963748, 0x333983d03971a78d, 0x1da9b8b73b0f5559, 0x145efa15427e8b70, 0x3c2329b095bd790a, 0x514f69479ddcaebc
+, 0x15a636a643db1fc1, 0x23b69005c9c6ce13, 0x6f442b97cfeefd61, 0x06154325d99a2bf6, 0x4431a8efa85f6182, 0x5b4bce52c3b81525, 0x6e34d5891189b166, 0x6f60ebe1ca4297c5, 0xbad9e5c2f28670d8, 0x44b07703d106341a, 0xf268ccc8b74b50e6, 0x3bd833d1d135a62b
+, 0x6ae1241ec0a006b5, 0x3611c6f4f40277d1, 0x1eae6a063579b6ee, 0x5b95ec4e25279924, 0xec334902b3e03372, 0x4fd0a23ee948ae65, 0xcd8a3f80f5201a00, 0x66d7ac2b52f74131, 0x3c3503f2e5446fc3, 0x7669fb928b5a867c, 0xe9addbc2fba8b0dd, 0x28e2dca557724e35
+, 0x74d677b3634b951b, 0x396580a36def9877, 0xdb6b4781277515b5, 0x32dceae64be674a0, 0x7bab0eb6b3d8d856, 0x4101a780d50b55a2, 0x3851ae630cca1d89, 0x75d7450026a22a4c, 0x188aea344dbd3c82, 0x25acd61db994d8e8, 0xb6e494b1b52187fe, 0x599035c63f889523
+, 0xfb94422ff476e7c3, 0x16a2ea31d6adb2b7, 0xe4eff732df9f2c45, 0x3633fdfe51afd37b, 0x459174466558f1c7, 0x4b6775af507e9fd6, 0xa89a4cb32f8d4e30, 0x33d724a6ee18e6f6, 0xa65d3407dd2a9558, 0x4771e5f6da91cd8a, 0xa216a2082d481ab0, 0x6afc8aa04af3c84e
+, 0x4ed467604e0324bf, 0x2aa11da9f69917b5, 0xc910220ca139f740, 0x73c37d6c237f9cfc, 0xd0fc15c4ecc3a488, 0x00d4e3e8448272cd, 0x0f2df8f83efd2ddd, 0x5e9afc20db39e598, 0x5ee1948095db103d, 0x7e710cf452d60b44, 0xe41ae6027d771b1a, 0x0c14fc0d0e2d1bda
+, 0x5e09af55fcdbe98b, 0x46676f2e255806cc, 0xfbfa20b66808b86a, 0x445a2e2c6157659f, 0xa4351b52468e5239, 0x574c6f59c3463925, 0x3827440cb7c8a1c2, 0x6d1835abbc834593, 0x64234c2f6135e4d1, 0x7d1ac001c39544e7, 0x9c8d013c1e0bc645, 0x126789810781eb72
+, 0xa186c4062b91ca61, 0x1616c271d7ef7eca, 0x88a8688a199b13be, 0x381eddfec4435730, 0x67ba75fccf937dd9, 0x66dcbd46d2cb3a16, 0x2c4509a8d6ceb386, 0x42e2a0bfb96336ee, 0x925cb72fd8c0b7bc, 0x5171be0e099859d6, 0xa0b24f2ee898e5c9, 0x6ff064e63bb9e638
+, 0x10cd270c512fc769, 0x2ac34749c8aabd9c, 0x27bc32999cf68e62, 0x76115656904c52ad, 0xed2358c8545ccd42, 0x01aaaab80f40ae59, 0xc31b74d7e38138c1, 0x172261a34be6d02f, 0x1598673c85fae1d4, 0x701ae19b6e3fb70c, 0x2e7193a51d2d9fb9, 0x70eefe148eb9e156
+, 0x16ec0e68ee382438, 0x6e7f668311a1b6ee, 0x0ef77f63334a45e2, 0x4ce6d03d117db078, 0x49fd36f761bcdfe8, 0x0a163688bda7dd71, 0x7fd8b72bc5c4391b, 0x4a5241fd819a80aa, 0x7010ce6f0057c448, 0x4e5e8f4a1ba1dc6f, 0x16756fb0280688fa, 0x621ce7c634b0fbb6
+, 0xe855923dfbf5a538, 0x0a3a976af71d9ca4, 0xc61f3b877fb8ace1, 0x0463e796ab8c56f3, 0xd113f68d0eb38b00, 0x42aa4a0a78ef78a3, 0x67fa2648cd2b3b3e, 0x65111408ab74dab6, 0x284a62a1de5fa558, 0x74d94e417eaba97a, 0xad0f25743d7b78a4, 0x7a794af5577df7f6
+, 0x62eada39d43a81e4, 0x11d279e330ca9f7d, 0x14bde4c98133a0d4, 0x6dee98c8d9091c6d, 0x2e99b7052f5bef33, 0x38dafe0f782db58a, 0x1929eb8ca808a0e8, 0x59557578e96721f6, 0xa6ad1d5ea5cf88f8, 0x664115a21d025854, 0x81a9cc35d10ca228, 0x62081d3a8ced3cc8
+, 0x0cf5964aa2658c7d, 0x458be1c89d689c46, 0x5374c28c11db4818, 0x08b66c8a5f83a812, 0xa54a9b058a92a9e5, 0x7177f1313c7cb3d0, 0x72714409d4459a63, 0x451299cd91f01365, 0xc68eb24c9d97b9d6, 0x1d231ee286bf3f1f, 0x9bfe132930712afa, 0x4e62e21145381895
+, 0xd84310a946cbf18a, 0x35424f219ba001fc, 0x3d6ee16aba34ed5b, 0x0bf6058925ced774, 0xfe886763371e8051, 0x7d4f3b9c3c1b20a1, 0xc7e02af3ec0d817d, 0x0e85cb27af1beda6, 0x8da0e6e657b8a68b, 0x4bff8fb02b860cec, 0x2ffc80c3171966fe, 0x2fb146e1c1331e62
+, 0x8ab29f819fed7994, 0x2b5a6d8a133a7302, 0x6fbf2b50610db761, 0x5e28e87af6086790, 0x8c09687b9bc5b1e1, 0x73c784cd13197ca6, 0xd6db36dffb8af7ec, 0x3ca033ad2f75024a, 0x2e8c9ceb84b4116c, 0x193923d441610e7d, 0x66f8ac9f06c911da, 0x20e73bc18e4527d6
+, 0x4e1ff6cff606b1a7, 0x3c6405518d00a132, 0xbe72c059859ee019, 0x1d8549f2dc23fa56, 0x79d934e03f311146, 0x01b77a63c7dcefa9, 0x566517a30e962d29, 0x15c3257158e24dbe, 0x0d179e9c6be68c10, 0x2344c9be75927c22, 0xbb01e744fa69de05, 0x38947d324a480684
+, 0x0f98bae04df2f336, 0x781fb9783968d290, 0xecd053dde99c2e5e, 0x04c8522d6dfce445, 0x8cd6af9f83d90e1a, 0x6bf257fe6b7e37a4, 0xcfb895da860213b2, 0x4bba1203010b44ba, 0x7d1baa63605a02a9, 0x310a80c1199692e5, 0x1f1aacdaf7229170, 0x19518aefcfd0d777
+, 0xdd8dff79c5cec906, 0x6d260c0dd275a9c0, 0xe38ec3b78b6194bd, 0x028a858d13a2b1da, 0xd990f4b46cebbec0, 0x6103a412ddaf557e, 0x7e6c7508d61cba42, 0x4a9f49c983f4697c, 0xbe2c77abe3e7a3d1, 0x09db0b4d87081f08, 0x281f550cb103e3a2, 0x490d460ec718aac2
+, 0x0df5f7d28a169601, 0x7499c978e63df437, 0x946e2e97af9ca51f, 0x3f76f417662828f3, 0x70c06907c6cdea98, 0x5cd6eaecf213fe50, 0xe60de0b839c29aa9, 0x6855aa673561ee0d, 0x945e5eaeb17deb1e, 0x5565c6e12d8df659, 0x72ce7b7e8b543225, 0x3c2ab517a4d42474
+, 0x9f470bf4a226cfe5, 0x351f8f4a8d1250fb, 0x4fbff273200d0606, 0x58cc8e9284b175e4, 0x20917afd1e924b1c, 0x3702a26b28cf359f, 0xf5698be408a4a4ee, 0x4d8e8501258f7204, 0xc95b222a7b19f8cf, 0x1b7635e93e26fd54, 0x9093da49f06270c8, 0x35188d013bdaa14d
+, 0xb09a3085f88c241c, 0x781cb2a0105e3e65, 0xa7167626a8165c61, 0x0dc2d08b13caab07, 0x82b097845f1e2690, 0x2d03354637e5b8a0, 0xf959803c2036db71, 0x72a1912989936a2d, 0xbee113145dc6e79e, 0x0dcc73aaba495871, 0xb9d3e6b1b2ac962e, 0x5263915661830d0e
+, 0xca0ae67e3d6e4037, 0x11d273fa89104d2f, 0x945626d36cd56f8f, 0x4eb91fef422112f3, 0xf1a50e35624c72cb, 0x7edfadb57904172c, 0x473d2561c2f6ed71, 0x418475aaeaa51277, 0x0279bfe18d223b45, 0x62249fcdb95bde36, 0xc53d126231d09f8b, 0x073998816fa06fb1
+, 0x4d7c60ae60c68bfd, 0x77e5a30b0edec021, 0xddc4d17d667b8ce5, 0x714415aec37b3ebd, 0xe221c2ee8d47e588, 0x3fb5822f00de7ef9, 0x65634abbfd824651, 0x29afa29c9ac70d1d, 0x059043f2b90fd4a0, 0x0984cbba5603bbb4, 0x133a9589cbf07e61, 0x458fca93cbaa930c
+, 0xbf39bfabaf864452, 0x26671b328ec30800, 0x1b06f5e777f45a64, 0x4d433c6363e716de, 0x325d3708c4efedde, 0x3df49b3a5bcf8e1e, 0x770abe65ff414b37, 0x65cb19de62195f2b, 0x6d1b99166a48bdc4, 0x6ea84f3e166e8d43, 0xe42b9db23b611df4, 0x256f24f38f32e08b
+, 0x5f8bb99c57118e28, 0x3c5b5c3eacbe79ab, 0xcbf13157ede1000a, 0x06199e872decb73b, 0xa44991e617f7f596, 0x3a6c3579c7d7ca66, 0x6262c4b9c7e47628, 0x4e146845578122a5, 0x952c1b1a708e3078, 0x3d3b261910612ab8, 0x75e6294c357058f3, 0x466bff901f5f2c61
+, 0x15f583f71642bd26, 0x699a9e02018fe4f8, 0xe7b5fd1e8865f5ee, 0x0f8a294a61bbace7, 0x0d1e63241e7b40da, 0x521d6ed92b443ade, 0xf6e5c07213ad14ba, 0x06744769817cf2f4, 0xb44e75488cb63d2f, 0x00be6103f32b76ba, 0xc244109624fdb506, 0x424e06aa3828ca54
+, 0x07f0a030d38084c0, 0x128df0979d17da24, 0x375724f69b8bef47, 0x2c546904aa6cb63f, 0x82d55a6ab00f29f2, 0x1257c9bf14797236, 0xc8bdeafbab527a5c, 0x0147d69fdcee5515, 0x57c98ae0d4ffeb3e, 0x65426a48a03804cb, 0xc902964cec20d89b, 0x308d260b8911c56e
+, 0x88cb9b74cb5e91f0, 0x10a9672844ad84db, 0xda3cf4ddc57d9d63, 0x3bc40c4617fbd374, 0x1f183cadae503ffe, 0x42ed0f7b8a60a174, 0x3a6373a1bfcc8fd5, 0x34f5c355712c8aa2, 0x9ee9224821584680, 0x2babc34d2b76d9a8, 0xf171f9014ed6baea, 0x6313cc8b2f44d89d
+, 0xf2e515e7aa706aae, 0x47e88100b7e4a530, 0xb4fac772aff41532, 0x75a3707446104d17, 0x6dbaca9a37f1ebea, 0x5fbc852d4cd7fc63, 0xf5f7bfdf5462e1af, 0x4dd07b63e253e08e, 0xf843479401194d02, 0x5bdc418ce93fbb9c, 0x583cc9a6764d3366, 0x2c8a517d8e9d1526
+, 0xe94cf05b96902d91, 0x7281a3e31343ab1e, 0xa2af567d0f004216, 0x0ecef3ead26d09bd, 0x8725d8f31a65cdd8, 0x1be1a06b0cbb2c68, 0x5371b1becddfc841, 0x2c924d9e42eeb8ec, 0xee6deda9c58feb06, 0x40e459401d2c9d63, 0xc09a4dd7c8157aed, 0x6c83ae576e22136b
+, 0x3d782e6a384c4d1d, 0x717296dcd783aff2, 0xcc671fe79c68ac18, 0x461fbeb803f773a3, 0xeb56fb2967d5eb0f, 0x1fabeeef7657fbd5, 0x4847530c2b459e15, 0x12516796a2f87ff0, 0xb05a1a4411dbd611, 0x313e4762ea780196, 0x25ef4d56078a849d, 0x7c71acfa067db541
+, 0x245434cb5902371e, 0x727770c08ced3f09, 0x1ed8e03e82f4e527, 0x03bba5250f0951da, 0x3b9f5f506c1a488e, 0x274b13847aca13ff, 0x3a07d5cbabab7b12, 0x45f8f7f1d27d77f3, 0x48c396ef4c94f286, 0x1cd9b08a8afaa1c3, 0x2cd8301aa7813ae0, 0x0d41c7d35cbff5f1
+, 0x5dec5303454a8645, 0x46e3c024e9edabf4, 0x2303dace93fef367, 0x587b800f038ef70d, 0xee7d0e1335bc29e0, 0x567c2f5adb5a9d4d, 0xcb55112f245f012c, 0x1c79a61d6a5ff88b, 0x3710da4acd324ae3, 0x4d0a26010632ee64, 0x620b06bfaf9f42c7, 0x7769705f5bd10377
+, 0xe28308e7a5614233, 0x06796db6f1af1e95, 0x1ffc09971ff89af8, 0x38d582575ebd4218, 0xed68522dc7277cf6, 0x21193810b68ba5fe, 0xf338cbc28e48dcd6, 0x64ecb71f8044cf46, 0x2125e5f8a90ce6c2, 0x2618c3285732cb1e, 0xf2a89d0de1d46da9, 0x1487592dd139a081
+, 0x49dc1b4b7a66421a, 0x6f5c5c3fc65507ac, 0x0b1fc2d8bcdf39fb, 0x3161ae3b4371628a, 0x2a2e04b85a88785d, 0x0ad9f540853c5196, 0xf9e5959f5ca52c97, 0x00eb6bcf69c37e62, 0xcaa437b2e8de86e2, 0x54b94ea7a41bd977, 0x54aece9ecd45b4ca, 0x14dbd3c545349efd
+, 0xeb12bbee0f5e9ee0, 0x08149ba8066bcc65, 0x73afd514d7c7d4bf, 0x215e91aa08425ee7, 0x8a0692bccee3ea6c, 0x127fa931fd92527b, 0xa7f5e110e67278a9, 0x0ec097a7b819e904, 0xad9ff4f184f592d4, 0x202dd09eefee4646, 0x4ad3c5c3e4857b61, 0x0b89fe3d06a5e689
+, 0x53d3aacc7ec80714, 0x1e4bdcda379d62f1, 0xafe6123bc19745a6, 0x00c6349dc91289a8, 0xe7e48ee8b39cf78a, 0x7c928bf4bee47164, 0x370fa2891bf074aa, 0x12d13b1817f325d2, 0x591f8d37703da9cd, 0x5cf18128a4c582a3, 0xf73d854ae449ac18, 0x3422f5bb732c18f3
+, 0x105616b84659d7c1, 0x290ae86fa6908f07, 0xcd3c82e0b4244ee7, 0x58735331114efb52, 0xb7aeced9a9d0317d, 0x7670aab6daf9ef9d, 0x76ac5263940bb207, 0x544317a18d9c8c68, 0x7763339417f05344, 0x7b910a13e427bc1f, 0x71a7ea7bdf2d84b3, 0x7196213379959da6
+, 0xb09c58446a66a228, 0x2cced4c5dac439d4, 0x38034792d9be9c03, 0x12badbb2b5f4b40b, 0xe78882e9fa192615, 0x158c1f414fe225eb, 0xea84b9c42b201320, 0x5644cdfc97390c4f, 0xb7f8499743e26505, 0x03ac3f2b99eae831, 0x39610fcc4d4d9cc7, 0x6bc1ed0c348e3867
+, 0x93ce508c79d100f2, 0x1a47d34fdddf7e9b, 0x410f96ec59b71fe9, 0x4ea44ee68aa7f3ad, 0xd89c65c92a9ff53c, 0x61ae2780023f3e68, 0x038c1e54c7fcf657, 0x5101c1f038f2c9f4, 0x3b0e614ac8df2937, 0x159b9a0231436009, 0xf56a5c686ee6be8e, 0x0d075fe43cade07e
+, 0x01e71d2bcb90e79f, 0x14fda6a3c5792f5d, 0x593dd710e7c45998, 0x30b4990d66fe5fe6, 0xe9106abd05dbdc00, 0x0af6a736f44ab7fc, 0x5dba5208c7fe084e, 0x6059ff941f72a675, 0x2df7769ad59b53cc, 0x6b26f9e14550561e, 0x16a5b5ef749bb86f, 0x1867735e1230886e
+, 0xebe67a1c69a073e1, 0x2aed2fcdf25b0dc4, 0xbac33e1756f74b24, 0x3714a98d971964a5, 0xa4d925d6754f511a, 0x325b4de80c34fc99, 0x879192aee50836dc, 0x3ed250b8f1738b1d, 0x3ef62b7c65db792c, 0x2f6d0c4c2372aae9, 0xf75bba86a26ab302, 0x4c2a73da895a2528
+, 0x4ce3c5e523212f14, 0x27720b06c40e464c, 0xa026a6e1a0ab09b6, 0x3f239bb3721c5ad4, 0x53ea40e0ff2b6a15, 0x0e372f90b7dd7df6, 0x7a5d8c241e8b7825, 0x323604d2f1f8b0bd, 0x64e62f2a7cefac93, 0x1a0f3ed6314c50da, 0x588acf01fc0ea0ae, 0x424b43a45ec627e7
+, 0x95838a0a65d57ba6, 0x67b259f675206d90, 0x34e5a7e63726b402, 0x33f312654921956b, 0x49f357184d09f1c9, 0x45878aa8b5a0068b, 0xf1b0c8d53451e511, 0x3fd45353208f3e2d, 0x13d106997acf7141, 0x799f2c0a804da5fc, 0xd35663b68f797146, 0x670abba3c855e18a
+, 0x065ec21ae3aa962d, 0x45255a7aadca2f3c, 0x8d0ec6636139c8bf, 0x1a93924d7dce98c9, 0x60dfe61894ed4e5e, 0x461738f79f92b43f, 0x295d61ce4db1436b, 0x3ad708fd3ba4c84f, 0xdead31496d5896cd, 0x3daee95d76f3843f, 0xa403f669c592841e, 0x72d34aebacff1ed6
+, 0x8d31cdb4bd4cd503, 0x22aaf7d36f015cc0, 0x0b2a92c69946a40b, 0x64891c50f76d5907, 0x188a685f94086659, 0x4b8095468edb7b7e, 0x236c741451b928ac, 0x68f7c0b21ba15805, 0x00cf5820e9370ffa, 0x7780d33b6a9e6041, 0xffae12a8d6b9d1de, 0x0067879b5913eb0f
+, 0x814616d6c05ad30c, 0x5d1425e3c31a771c, 0x2cdc8e178de15103, 0x457d1a01a0b37be8, 0xa0274559760dc316, 0x1c7455243f44d251, 0x317aca18303cc6bb, 0x70c4a9a5f2cc7ff1, 0xae37010c4771b3e9, 0x6225238841809f59, 0x2c4293e649c7a122, 0x659a3fab218757a6
+, 0x100c080a16e311a4, 0x1b981538c2aa35ca, 0x5656c9767f935b35, 0x58578af560c00885, 0x7d7e75455b0f113e, 0x1b87ed23513c80cf, 0x2137ec682b2123f1, 0x120f6e6a59b9581e, 0xe48330eaba0dc442, 0x3aa01b81684391a9, 0x1d947dc384beeb96, 0x0a079cd1c7f0225e
+, 0xe0f56edea5550878, 0x21a51735ad8eaecd, 0x1ab5ecbcfb0f8f65, 0x56aa0f9e75ea6953, 0x5f8ecba2d5f9d601, 0x135514a1dc3f5c48, 0x2cf06c10749d3865, 0x47b2a659148f842a, 0x399b273e7aaf6613, 0x028cc97d08e649af, 0x0c72d9e78440b599, 0x698ff549568974af
+, 0x2499b88d6ca6c79d, 0x2b922d252a7c6968, 0x373619fb9bff7405, 0x0764e8a51ec252f1, 0x97308f2a8c13c4ae, 0x08f7a4a1cd2f193b, 0x2c4a0177786736ff, 0x5b60a88ce73fc7df, 0x509bba0b9365d765, 0x0d19c7a11cbb918c, 0xb20b3168bd753204, 0x02da123e5c3fd57c
+, 0xf0135ef35679f86f, 0x3c34d5f9bc65942b, 0x1be8b1b4ea9432da, 0x2c7296585f0e7c2a, 0x78247a673e1695c8, 0x7485e187dafb2ab8, 0xc5b00b8405eb6e09, 0x211957b32174d122, 0x0fcc092d27e77d43, 0x5ccf1dabdb35741f, 0x7cd94bd3b5a20162, 0x7ff5578ddcf4a680
+, 0x2e3960d6cd3af754, 0x7ce2f081abca640b, 0x7d750539526a9650, 0x51546ac69e675af8, 0x3b4787eeb619f88f, 0x5121058854189d37, 0xb5c374ca262837de, 0x6863ad506c568e78, 0x77120cc1fcb714b1, 0x54fb076834bb2bc2, 0xdf8b645918e9d0b1, 0x05dbdf22dcf53e18
+, 0x696da3afff271b35, 0x38ba91be2e659125, 0xa04ea3b5af587566, 0x74761729e1156931, 0x9164d2e1659ce551, 0x55efbaa332fe7100, 0x28767c2081e34b2b, 0x480ecdf882d3567d, 0xb3977451a43af150, 0x18a67b7c7491c143, 0x90565776add1ef2a, 0x5fc05e0f2f53a89b
+, 0xbdfad395d5add787, 0x57e409e247e21acf, 0xa061a0ee3e5ac961, 0x78c6c210b69e47d5, 0xf4d2587d00fb36a3, 0x43beae0f52ab29d4, 0xbe1250289ff5bc56, 0x5b669affe175078f, 0x2887e1733991b876, 0x1cd3260920626633, 0x912a004b7d849d24, 0x7bdd5e4e263f9a31
+, 0xc5bfbde9eb47443b, 0x2881d3213fd7a984, 0x003223a38dd1909e, 0x20c61e65a7048d95, 0xdaf35548fee38f00, 0x1dd6a51708222dbc, 0xb98d06c40a614b89, 0x072a791da86e05b5, 0x28d51ed66edaceb1, 0x28dac7a5ee604feb, 0x573af958459204ad, 0x577cb85c11a1f6d1
+, 0x7b038c89c4caa241, 0x1619d4d507a099e7, 0x31832ab2b0c5971d, 0x1301f3b2ecab5307, 0x9be15946c2a061b3, 0x710c14509e853d7e, 0x21fad2b4ae69e07c, 0x5344dd01eb346652, 0x0f6428d6fc57332f, 0x0c3a1d90c843cdca, 0x50ddfe34b420459c, 0x7847beae83085ef8
+, 0x971ba0969f553030, 0x2b92d43089ab2ca7, 0x76a8ef0275de22de, 0x585066f0b895265a, 0xe3614cd3b50b8c5b, 0x0c6fd1055e0141ae, 0x240f5ce4b84fa022, 0x52a923efc425331f, 0x9e286c2bf1cfaee6, 0x6f7b0761ada1c246, 0xcfe32cbacbdb0733, 0x2fa70199540ea2c0
+, 0xf248d91f4ad54b92, 0x44fd02f4e5ad6fec, 0x77c0139d58fdf3be, 0x7fb73f819fb8216d, 0xc19b8544fc7228ef, 0x0ee4b82c5a26bc1c, 0x88b5fd5243646cf3, 0x35f8d5ec97806f36, 0x56de1c896b7fcd30, 0x535a7d4ec786ad51, 0x5bc16921807312f0, 0x4ee490d2e972692b
+, 0x93a7c05b19d7a1dc, 0x342a378b49184575, 0x9689c311a5e0fbc7, 0x00d494e66a4b96e8, 0xf42778031b86f5ea, 0x70d955b03d845acd, 0xad0aaa7557f7b12e, 0x249951c681ac1206, 0xe6be5ef9178f2776, 0x6f1c5478d3f3dc5b, 0x7901829a0aec1b35, 0x003d3201bb48e2a1
+, 0x87f32d4690e8f91f, 0x4da9c5ef5b38db4f, 0x38bab7a42223e7d7, 0x30a04c2091332dd2, 0xbf763c7e37338236, 0x06f743829ed0c3b3, 0xec67f1d61cf382b6, 0x4a3ec01c4f87a074, 0xd3c549c4d62cbb3a, 0x00426b524add724e, 0x44b3b2d0d8de5c3f, 0x173e432ad5fe9447
+, 0x140635134967fea7, 0x5eddb8cdd3635c04, 0x62f0bb5ea0f91d8f, 0x24ed213792ae3602, 0x2530531d696ff51e, 0x134b65621f36d137, 0x5a7e896f1f710c6e, 0x634894eff318e457, 0x0b326034157d1819, 0x282834aa20be27da, 0x7389ab7263e558b5, 0x0aea95ecbe6bf111
+, 0x18146e320ac0f32a, 0x5a334d165d105d2b, 0x73176f4092ae28ed, 0x485cca377aab92ed, 0xe0948955ea455489, 0x040beb49302f6100, 0xf5c4c2507264ac0d, 0x692339e72739ffa1, 0xff18e0dc6cca0011, 0x71a500e0dbc5a122, 0x3431f32c759c12dd, 0x36249fa36dfd89c5
+, 0x254da6369923ea0b, 0x3e06c8666056d3eb, 0xe51f728618dc1512, 0x2af68dc91e367d07, 0xd98359710f4c6b75, 0x758e15c655f00c85, 0xbdc93d89f778faa1, 0x729bdcfa9895d803, 0x6a04d531c2af78b6, 0x05701f5dc1983e08, 0x53ed93122c4a0a2a, 0x76823590b28cc983
+, 0xf7b42fd6471892f0, 0x6f42aa20bd842605, 0xb3aa4693439b3ccd, 0x44d04ebcb74de56a, 0x75ae94e059c98128, 0x21962cc50cfd62c1, 0xa33aa6998518f537, 0x5f99f79a6f9e90d6, 0xd222e0eb78eefbee, 0x64b1f629a7446aad, 0x447ad15f04fac35d, 0x717cb970e01ca2e1
+, 0x9d30e089508905ec, 0x3facd6db998f7534, 0x75359fb101396c36, 0x2461d3c7f572cbde, 0x1b095f4cf7733604, 0x7a8e1ecb24e14d44, 0x7345f08863b131b4, 0x76d0de9597f6fe71, 0x7b70a8ccea4cceff, 0x2f8b3cab898ac560, 0xf5b9f350562e2199, 0x6b2cdb9f04ba774f
+, 0x8ca7de636c093d04, 0x6604655f0dd1f32a, 0x86aa294314c36dd9, 0x4f5c9e8f16045f62, 0xf2706471246413dc, 0x10f343d2356492ef, 0x31f9917d0bb79ec6, 0x3d04ccfd17d6eaf9, 0xc0fa25df904e7886, 0x1007705b9809e94c, 0x33343ef6a76d99a1, 0x644550f7e8363f8b
+, 0xd0ea4caf0ae7723d, 0x20f6da365e35e2ee, 0x6864ded61bca6f34, 0x3c4f253937978eef, 0xa9a96287dc18ad1b, 0x400f6f54a3eef73f, 0x660377f32f535ec1, 0x469a5d84a97942eb, 0x43005b264e55a2ae, 0x0c64377e32913102, 0xeffa7d5aff6c25d8, 0x728fdcdc18f7a54f
+, 0x42f21530de87e291, 0x47505ec1216ecc67, 0xdfea3c10011e5871, 0x68038055bebebf4c, 0x20d9676bb744bd1e, 0x0f255d84970d10bc, 0x13865b545b657a71, 0x7194af57a98e4095, 0xea063f207d697e06, 0x534043819582e269, 0x208713274832afc7, 0x420a0864f4d88aae
+, 0x6e1b298e57cd2f3c, 0x0508c6bd7a261e31, 0xcd1e7d76592f82cf, 0x096f457cbd1d4b02, 0x376fe3b3e59e0410, 0x21548e69bed7d1cd, 0x1dd3aa1149ccc2a7, 0x7cf7f3a542664eac, 0xd00c18edcd9caa54, 0x504615eb8ea133cf, 0xdb902e7ecfa31931, 0x3299b0fbc8a56e92
+, 0xfb16a3aafd51d36c, 0x2c6d29e7980b3f1d, 0xcd71e6059f3b35b0, 0x55b86e1b823cb729, 0xb2a9a6fc8b1b59d6, 0x2a4bfded8c5fadcf, 0xb8680e96ed1c12c2, 0x51cf341c0661efb0, 0x161f406fbfa4ade3, 0x2239ff44e34ab0a8, 0xfa93fba9c387b1fb, 0x3607336c7d16934d
+, 0x6aced791ae0a5e28, 0x55dd4b7d6cf226d4, 0xcb68734b40ae4de2, 0x0e1a8e85167f2da7, 0x0802ea14ea71e590, 0x2b360fdf3f6a94b2, 0x90123032be5d0518, 0x79b705f9f1c81196, 0xd81ba689c2ee7871, 0x1731a293b65bf31b, 0xe791942cf421f395, 0x22e584a70f09bd74
+, 0x282f4af5118fc0d0, 0x0e7dfb76d1c9783b, 0xc12a5dcf19fb44c6, 0x55981047b6394aa7, 0x8c01d7c2e77d2d9b, 0x2ea9ec71a20b0f25, 0x69f7505de2aaa456, 0x303bba46bf35dcfb, 0xe16f8f422ce92edf, 0x3bddd2482a0c4569, 0xdc07e8da1dc101a2, 0x226a97e1da993dc9
+, 0x9e8623a7eb1c5e9b, 0x68e4bd48dfa46885, 0xc98f579542e44bd2, 0x1923caf288b5eede, 0x078c7d297b330615, 0x2a6563e73fc05007, 0x6f09f113b010762e, 0x18cf19691d3099f8, 0x1cc7bff1c269514a, 0x7d5a6e8e9019651a, 0x93161e796f92340e, 0x64071b9ace7fc8bb
+, 0x6b3c70169b56baa7, 0x0a592fbe6811d3bd, 0xb8ce22019ce16e79, 0x4118fb7fb2070d86, 0x08142da800439f92, 0x435d7aa83e327f58, 0xf06a8253722d1f90, 0x7c75a3fb14b8021e, 0x12e4386212bc86b8, 0x777a612690bd0e0c, 0xb509feea0f3ff456, 0x07919fc878a9c8fc
+, 0xf460cf3c57bedf77, 0x223d182cb9211c19, 0x0f8a635058662879, 0x37d744a2748af07e, 0xeb580d3413b43113, 0x6a6b81d5e6f1e41f, 0xcceb43408580da40, 0x3075cfa01e23aefa, 0x4523f6b09f92b3d1, 0x77beb32e0913c96b, 0xf9ee02efec433306, 0x798eef9d9d3402cd
+, 0xf1e7bd9ec642cb61, 0x09a7718db43c4fbd, 0xccf830719ae36563, 0x54308ecdceee01a2, 0x452f89c7f6523f2e, 0x26425e6ce22108fe, 0xabeda0421db9ed11, 0x75d3cd312a41c990, 0xc7b25ca03f7d4ca2, 0x61823b003da56db3, 0x1be0b3b9815f6b00, 0x28f228564d014a7e
+, 0x321fcaa979b2ff44, 0x7a0be1bd750e0826, 0x5f8f9d52e9816c91, 0x28f06fb15305290b, 0xb65f4746e8a594c7, 0x209ed4e3ea9f1dce, 0xc3fc3d47aa7a6c97, 0x7e420f01fbe4eb73, 0xcb0da35bda2b5f42, 0x6498f43e39edd388, 0x7ef728a886b926f1, 0x58d7aa21d33ec54b
+, 0x4a6bccdff31fa5be, 0x101e3fd2f78a3e8b, 0xbb015baaf263e9f4, 0x2e15891f87d38db1, 0x1edd5ccfc300acf9, 0x1445306a2505cb36, 0xaccbec58489f1619, 0x74eddce4d49471c9, 0x03c4954ca2132166, 0x51e609b9a4ef6152, 0xcd4e89381226c7da, 0x517c21914c2e11ec
+, 0xf1b4e8460198c8c7, 0x1da07535662e5585, 0x9e16a5ab5f04e05f, 0x69594ac17627553e, 0xc47b1d94bf155480, 0x4ffaf40e1f862206, 0xd28cda409906916c, 0x4b353773d78983dd, 0x81df7f281b05b864, 0x1cb51448b5c4ace6, 0xb6309191ead83606, 0x3f775c6b1a138935
+, 0xce682b72b0e1a2b4, 0x286026cce8a1c2f3, 0x7be4830d2089043e, 0x0c23c6f879bf6f7b, 0xf7cc429f5a3dc058, 0x763121935ead0e7b, 0x5eb0b3cfaf55609b, 0x203f42f0f0333331, 0x9e3c943fc645e8fc, 0x66040142bf5f43e8, 0x9dd6a826d262408d, 0x3e6cfa24c1d80821
+, 0x095b0585c2414057, 0x599af9ff3862474e, 0xde8534476c076721, 0x0d06fb9c68b3c335, 0x31cac7afba96ba9a, 0x49d37780a8881803, 0xe9a81de285ded12e, 0x2b8b9abe40469f73, 0x1f1545f3a16cce5b, 0x78306382ec726654, 0xbf342f0eac054a31, 0x2fd49cd52e9d7666
+, 0xf20afa09281e3fe4, 0x1c9ebec30d99c3c9, 0x88487f931f3fd3a9, 0x0441c62329d2a116, 0xbfa8a9a1c517714f, 0x3b5ee690732466d2, 0x52d4de4848ae2a0b, 0x641d059a9b967933, 0x9f03709bd4f114c7, 0x0e68947c11fbdcd0, 0xde01a6e69522c143, 0x775539e6ac7e478e
+, 0xa3fcb2d8255e6883, 0x7aaaa86b88ac3820, 0x7c830f432ee7bc64, 0x6fff48fe0149fcd1, 0x38d031193deb39bc, 0x0147f8b6365b0f17, 0xac52444dfdeb29e4, 0x7dca14d2cfb474e7, 0x8aeb85da6b4fb67d, 0x30bcf6da9a5ed9c9, 0xf6619c8d9b04f637, 0x7892e2ddec9ebbb3
+, 0xe4ebabe539f315a1, 0x038f7b4c1e14c3f5, 0x77037b40b92c8f1e, 0x7b2317af650c8d98, 0x3abe2a48e241ed02, 0x651167d332a67b55, 0x85d1f4a4a0137e9c, 0x710c8a3498b0d2f9, 0xcea37fda63f160d0, 0x6c4101160c3e7bcc, 0x360f15f83e15449f, 0x77862e558aa9306b
+, 0x09105a4028b8afb6, 0x045fffcd0385dfb9, 0xbb3d8dab59bfd379, 0x4f5b464770e6aade, 0xbc71e62216222325, 0x02eb8edd61ee6353, 0xd6c053c141be6d93, 0x58f60f7dd44a73de, 0x92c0a31d2047b459, 0x20de0201864d5a77, 0x719eecf872c59689, 0x5b95e23b999bc82b
+, 0x15f6185cd8e9d619, 0x555b491830ae3f54, 0x92e06e07ae46425f, 0x33f7831698f67cc4, 0x1b5b2e69ffe4fd1d, 0x00d076fbcb7e5d89, 0x395f82c002161f4e, 0x07fb1bdf0c0eb9e5, 0xeee6fa8f6b490825, 0x5c756a38fa608032, 0x2159ac4685bdc69b, 0x06e428818856ad5c
+, 0xd2a71fc44b77399c, 0x0fe16f3ee5808c96, 0xc140c792e9bdc82c, 0x19978a96f5932c34, 0x91f608834676885e, 0x4de0cf9a56635cbc, 0x82b7c16571a04b18, 0x06c59e83c49b3a97, 0xde5d472aa898be56, 0x21e7f24c5a1a0136, 0xd371d5e2f0bfeac9, 0x1f1db2ae8d4108db
+, 0xba42afa1b4bf81e0, 0x0c5b94414f5352b9, 0x3dfc6f05cc0002e8, 0x5e13d8b1d42d49b6, 0x10cd9b740ddcdc9f, 0x493d9e4b26e25bbf, 0xef251fec9895e78a, 0x7fc13f0d793e924d, 0x90f3b3de8c02e4e2, 0x0a1b6883e95f85ef, 0x73e926b8a9f4c498, 0x16e9f96e25dd9c6c
+, 0x673eb13c6260c73a, 0x1fd75f39d7d532bb, 0xdb9f0a9635222134, 0x7559e00204b0d813, 0x5c7a598e4f61d1dc, 0x1500a8a818beb390, 0x9fed7a40d1283f3e, 0x66e41bd8eca6512d, 0x5516fcca16df3d64, 0x28948f4a0e5a3eee, 0x2c382bd8beee82dd, 0x1cd49858856ab3f2
+, 0x39feb10ba96e8d77, 0x69fcf628a317c792, 0xe408ca901c5dd888, 0x2fb0da4edc24624e, 0xb1b375c8d2c87074, 0x0cd1c431d736ff23, 0x3f4c7dcb4fcd79dc, 0x2d47bf274e69f45a, 0x59be805c2e9200ba, 0x6b20a8671a1c2e5b, 0x8a0a5754748f0ef2, 0x325dca8056c3c687
+, 0x22f3dfa2b7ae55a2, 0x0d7eb9870031752d, 0x7731b09b80d35f25, 0x2603174cc1e535ac, 0x2b3a227d9e6feb21, 0x5ec0a853ed162b47, 0x8c0056a0e5757214, 0x60b615a34769f737, 0x66837b7d5fd636bb, 0x169713fc17db253e, 0x9e7cfb1fd223bb49, 0x1131c2179d464343
+, 0x4991608a32dd337e, 0x49f70c52fb032ec2, 0x90576bc91d35991c, 0x14b3dadfd5373464, 0x37095adbc1a0e3a5, 0x7f6f987c03d53623, 0x5adfd27a7fb54489, 0x327c01de70e4efcd, 0x402164a536b8aeae, 0x2f5671747d69414f, 0x776eb7ebd080bd87, 0x5dde5efb416f5e5f
+, 0x273b54e8e4eb50d1, 0x647ffef53fc9e298, 0x24c0544770e3f03f, 0x06a7eb249a81d646, 0xca0892a75077c077, 0x484d2ca242ff6fc3, 0x067bb07937a06471, 0x0e093486d62c1e07, 0x9f1152635640e78b, 0x5036cd7489f88bd8, 0x0be0a7dfd9e2db53, 0x4d5749c0f2196af0
+, 0x621c34f70a2cd02f, 0x43b8a67df33f0a31, 0x1ee65c3614c8daf6, 0x3fbf0faf516ca1a6, 0xdc85331e64057d7b, 0x70ccadfdebfc35e2, 0xf791fee8a1799a37, 0x75925fa1941f6a75, 0xf2c09e37b07f1be8, 0x4add1e02eb1e539a, 0x94c9811542f0efb5, 0x59873cabf79f3121
+, 0x8bca74100653f8d7, 0x18563b74af96a797, 0x76f90247a6d3c6b6, 0x77a747182fb0ab3e, 0xc543d557527bc36c, 0x3a730195d6676e93, 0xbbd11725ec025a2a, 0x0a1db480ba707055, 0x8bbcaf6612b108dc, 0x00740da986e3c210, 0x16ca4defa5c8a982, 0x006cd963fe355056
+, 0x558bab9ac38f5183, 0x5ba3b0daccae966d, 0x8f8368a8f91be738, 0x59004d1817737228, 0x982f041ea1216b8e, 0x0ac40c6b60bc0d2d, 0x9f44b19e025b22e2, 0x6986ec05649146d0, 0x19ec7fe7e53611a4, 0x74b85f20bf640f67, 0x83c5618ff1507769, 0x04e3c9fde5181126
+, 0x6797a8e6e8043982, 0x159ed70f7dfc1cf0, 0xcae6326fa5ac95b6, 0x6e94edbe05adb37f, 0xf1fb6ddf9d858d81, 0x2a58261f9d329910, 0x6831424c587c692a, 0x0b9e2aefbccdc3c3, 0x632e62938ad6174e, 0x69cba2e9115bdeec, 0x68e0d411a2afdb9e, 0x0bb392a9df2e84f5
+, 0xea33928a1913b83b, 0x41fb55124b26187f, 0x04256ad7bf80f5d8, 0x0d4bfc5578560aee, 0x82926a281b239f3c, 0x0163f910533aec8f, 0x219fd519e83fc6c0, 0x0f5c55899e1bef93, 0x34968c7f7d0781c2, 0x3fc353eef1d2d88b, 0xadffef831f06e520, 0x5c74162d6e5067a9
+, 0xf572a74822a83f75, 0x3cbf96628962d2a0, 0x44991f3554d82bb0, 0x1f80610a1094d9fa, 0x892c5cc8a3108626, 0x4b1caab792f72715, 0x663abb9735eb7de4, 0x59c5cc67d0fb93cb, 0x42e3efae0625a051, 0x1d39b8185649857c, 0xb9c4c074f7a4fb90, 0x24abc0bb666ac2f8
+, 0xdc4b807be882f573, 0x37948bf495409012, 0x3575b9fb8d10cf03, 0x679afd24a0b7ca6a, 0x5aacab1cf6702599, 0x2f0a2c4f303ade8c, 0x12067cd7b8bf5810, 0x7c550944b53ddf30, 0x11e080dc0c8da2cf, 0x30a0e2019187ec7b, 0xcad62bd0cb21aed9, 0x365e8be70a78d770
+, 0xc3a5db425fdc4770, 0x779903af7ab0ed64, 0xe4c7c80cffed194b, 0x774b1938c99b099d, 0xaecbf24b210faf6e, 0x050763c4d8ae4c53, 0xb016004fca47c6e9, 0x53a55b3af5b47af4, 0x8fdec40e36467e27, 0x255d0448252cb403, 0x0c7182d7a52a2b10, 0x21a5cec853168d15
+, 0xe970d9cc296c7950, 0x6a80a9470eb3c28c, 0x4ac940dfcd2f7398, 0x5acfc0d5950a9429, 0xac056fa029029ead, 0x365d8bf36f6b58fb, 0x72be292b37cc00d1, 0x554c5ea4a8997162, 0x35ea1a55c7c93118, 0x17c13a2f1a4863f7, 0xa31d7196b258d489, 0x561af537441c6b8a
+, 0x43f1569c194c4fcf, 0x1674f72b27249014, 0x835694fd2134893c, 0x271f0c519acd9d19, 0x6398a7c9bb8d2f70, 0x350ab090da4f3c2c, 0xd81befb2e608be5d, 0x44698c9056863f3f, 0xc2f46d2df8dc3714, 0x7c31ef30e011c435, 0x529122d489058c53, 0x6d605725495eecb7
+, 0xd916727aabeb24ae, 0x571ccf72837c6791, 0x16ee7f3be10ee9ff, 0x29487083f6a52e78, 0x007dafe361e6e38d, 0x3ce49ac34fb1d077, 0x9b4acd53383a70b1, 0x7e8b8c0197eddafd, 0x87accfa61ba7c933, 0x07627e39bb745618, 0x9a48e2d11a205179, 0x49147d91d501bebb
+, 0x80f86a9f276c6a7a, 0x61d9247d54f95ab8, 0xf71ca257d2168bcb, 0x27ab18aab586ba24, 0x7761cd3a438e9b04, 0x0ef837617ddd847f, 0x0c9237592ebdb458, 0x2cb62fc8a7e8f43d, 0x99e8caa66739f32b, 0x13a7ff20166e984e, 0x6e852f1c5f3769f8, 0x2c6fddf0c4d44eac
+, 0x425a4a2b7d7fa9d2, 0x20671656ef400852, 0x5d0beeae034c001e, 0x1780d5125ce03917, 0xcb0fab8474bf9958, 0x0c4568a1a5091c23, 0x52360194c396213a, 0x315aa205b5908980, 0x0676378b17ecf911, 0x7105f141c8cf1b4b, 0xd7f3c99c0f07fd2e, 0x3a7c05023b407a0b
+, 0x9aac553992775dae, 0x38c455b9f3159b1d, 0xf17e9de3275f17d8, 0x6eb4358bc6196ecd, 0x630176c40defff6a, 0x27c3edd239cb2052, 0x3a61ad9bc9753709, 0x1a16597c347461e3, 0xf7d24a1135f43dcb, 0x7922752eb7ce6b27, 0xc78001d5be7e9f66, 0x454173ee1d51774e
+, 0xd8c3bd685c33a057, 0x02212ff5ef68bb0e, 0xfacef4366b464411, 0x757fd2927b2f8d79, 0xa643b659c5dba1b3, 0x4c48676e3ade8ac4, 0xd9573fdb287aede3, 0x5d881eb453f9312f, 0xec7848ca1f72198e, 0x403f9241c74ff99a, 0xed34f1d278e7eb2d, 0x594564094b7d741f
+, 0xc082ceed0c7a8737, 0x3a7de8095f1f8f3c, 0xa8e8f2b06367114f, 0x204ba03c43f1ebdf, 0x45839bafd6f46d48, 0x2c505de4d595b923, 0xcd9587d82ab25392, 0x6dffbfcfef1fc616, 0xdaf0f97315531914, 0x3e5af40fd5f5402d, 0x19d64bd439a60cf8, 0x3ac8d237a7dbdd8a
+, 0x7a27894c4645ad67, 0x728b4b12907bdc6f, 0x00ef367e8b846083, 0x2e12f47468e5da15, 0xef26c60ce2b59e08, 0x6735a4ce1bf8af0c, 0xefdb6d3da3ea03e1, 0x0e7c6cf0ae42e94f, 0xd0640dac61626058, 0x60cd54794c23f6da, 0x3246ab6e236df530, 0x38faff8eac19d71e
+, 0xbc59d436a732da94, 0x59538037cc874e80, 0x7034f8884ce66e31, 0x285441ca83581886, 0xf9aacaa543d81f18, 0x3737e54c55301a9b, 0xf57399e30dc0ed09, 0x07502c204245d12e, 0xe9fadca7f40e836a, 0x189b2e767baafede, 0x6dacf25558302421, 0x0cefa9061565cfb5
+, 0x6c2575ac4b597d50, 0x3c88a29f145ae42b, 0xe83f38639442af09, 0x39365e56f40e1fcc, 0xb02467cf5b3da636, 0x3ed5688bced3a940, 0x7b61aa5d79e102e0, 0x4d490285a655543b, 0x607e9dced9a0bf0f, 0x4b0d804924b73707, 0xacd90090bf36df8e, 0x2e442644f3810b4b
+, 0x61714d48c0657dcf, 0x4d748fbc2c8439d6, 0x343c99b73a0fb38e, 0x3cd2bce2f4849347, 0x5850ffc5efea38ed, 0x09f558522a53da78, 0xb7b11484356998b9, 0x63eff2d0aeaa8156, 0x5f0f61f9cc1e040b, 0x3613326ec703e75a, 0xfe00def95d710e77, 0x4ebe1caa62aee96d
+, 0x197b3b195cf42c56, 0x58764dfa86c33ec7, 0xda42f48a471b196f, 0x1bcaccd3f2dcc092, 0x7d494ef3f7333d56, 0x072b58de8d418db8, 0x9bd3d9433d57edb1, 0x0dd3b23acbc9bd31, 0x5c84666bc0a92905, 0x5159a903e98c391a, 0x40339d1018ec8a54, 0x1149d9187b9a078e
+, 0x8cad594c6bd81df3, 0x466d052d8cd6ebac, 0x8a04c9e024e1e1ad, 0x0bb8169614752b16, 0x4e47c287d64b4bff, 0x3d8977ab5a5a1491, 0x36da7678fe8078a1, 0x04d36d3f949eecf3, 0x514283cd42e18269, 0x4add0357cdbda55e, 0x8e91fdb72198102e, 0x55eaddf5f78da0c5
+, 0xd5bf054e241b2514, 0x506761f732558549, 0xbe2d4e6cf8d6b57b, 0x2d1c9109ea841489, 0xa259474470b1856e, 0x436e90b436b49f74, 0x85aa962f05a85e9e, 0x50e0edc8dadc96c9, 0x4dd1ed9b5eca62ef, 0x49702828e2cfafc4, 0x170dc4b022b7deff, 0x71550cf91fb6613c
+, 0x987c50658d55ee69, 0x2ca8e637289c71ee, 0x92b654c028b0e991, 0x26300f3af780ae76, 0x0c9473ce99cd4ed1, 0x44e99a9edfd1ad1e, 0xe4f7c32930f05a11, 0x6b5a0d6a869993d5, 0x84ea4986c8b46843, 0x4f8aa88462da92e6, 0xae9d4418e2f11b62, 0x316db54e6df50a8e
+, 0x4ce31fde7ba04cb8, 0x575b4cc8f7545f62, 0xcea456a626b04de6, 0x212a195efd262a4d, 0xa69f8b69a76975c0, 0x7df43167c50d2ccb, 0x5f28a2a3d2a7c00a, 0x7021bb101fa42b21, 0xec9911c919146eb6, 0x36cdda56c20f2085, 0x5554a0a4b9b54ca5, 0x4ea417240a25772b
+, 0x862af1ed5d1f107a, 0x219c1c3e09afae9f, 0xd74c41aaeab8dbeb, 0x18d7489ca9ef2333, 0x977357156c728c73, 0x2f0c8d424d5ad090, 0x3f22060897e191b6, 0x4e07b31d483058ad, 0xb54ded8be8e44873, 0x2218e93d72cb987a, 0x2c0968e37ad75611, 0x3577b957d1997681
+, 0x16f353e625a0c3dc, 0x5ec66c1012ccc171, 0x6cd13dacc5e8ba81, 0x35193abaa0235ce1, 0xe6c317c5f28eca9b, 0x39656e5d93c55f63, 0x1e60a3d61fe90e2f, 0x3855313c871e0993, 0x6085b8124dd7a54a, 0x57972350d4699b38, 0x2fce832856aaba36, 0x3f813f72629a4c76
+, 0x157f0ae337299870, 0x35922801f8725806, 0xe98c463c730edf5c, 0x5a45f568ebfbafb6, 0xa80a43207b6aa724, 0x0cdcb2b460e31aaa, 0xd0f6b2271590c2db, 0x1c562f99b901634f, 0x749a2b46062963f1, 0x1e3aa01a0989e7c2, 0x57a578ac882ef15d, 0x59bd4605bc08e18e
+, 0xd7d791f061b46baa, 0x517a01874de17319, 0x08109f02cd882b8b, 0x4c9b28dbb9bae14d, 0x62281efc7ea645d8, 0x2345e6630203e989, 0x29a98be840c6fe5f, 0x45c94b6e2640b688, 0x2259c88ab5d6049a, 0x2135206f1db237db, 0x4a7ed44badc169a2, 0x5143f36bdf73258e
+, 0x7088e02db06c476d, 0x18137d87d4885853, 0x354160a12c37b7f9, 0x22044b7f018468de, 0x4a5a532515ae0621, 0x29a72048a3b439d1, 0x9c23c758b04c1007, 0x62f235b4bc5377ef, 0xcc69fe58389cf125, 0x6f1b49454140fce8, 0x8ad0f544a95ffb2a, 0x29e8391c237f8351
+, 0x75615256bc74d948, 0x185630bd121cf2df, 0xe501a31e1999b7bd, 0x66e75535bb42408c, 0x631665ec7bcc5e7d, 0x242495f3e85e7998, 0x66b0fb3f9edb03d8, 0x5ab167406775bc5e, 0xd42be366800683df, 0x6d8812bedfdd6c4b, 0x760725b2413a3c37, 0x4f25496eae7d7755
+, 0xc29c625d2e8b3487, 0x150da8611bc8fb07, 0x3f1ba0b650333c90, 0x34db3691c27334a8, 0xb82a1dae483ecd10, 0x32b96279314754c3, 0x5d76728319423cc4, 0x33db57b92b187ef4, 0x47ac64fd8dc333da, 0x3a0447e51a7231bb, 0x882e3bbac28e5a9c, 0x6811d61cc1fef210
+, 0xd2ad423d153a4f8e, 0x28c7f4fa2b07677a, 0xce37043163643e93, 0x01a11b30b3fa99f9, 0xa1a764dd5c766174, 0x5ac99c0485932440, 0xfda522a43702d2bc, 0x76fc75fe77f5a3eb, 0xbe461bcd9f4ef6f4, 0x0a56e11d063a8f9e, 0xf2c15b0aa5c6165b, 0x27354d0a631d14b8
+, 0x6aed691fb08dde28, 0x26faf56c1962ced5, 0xe4c0ebff7594ed9a, 0x3d8a1cb91c38948c, 0x761a0c9b6362eec2, 0x389096f165429ecf, 0xccee071cb833dd86, 0x16ada667fc36cceb, 0x70bb5979fce6bbbf, 0x4699398daea007e1, 0x57dd58d30e05e5df, 0x13f21c14ba13f4f0
+, 0x2d4230253eb6ce96, 0x7e84c825c547a828, 0x81c70c2972c04172, 0x2e4245beb7e583e6, 0x52938a10ce5d0fca, 0x4470d74c1016e542, 0x5fac12fdb63d74c7, 0x64d6852862bf14e0, 0xba92555b0a89ce0e, 0x39e5da89b4a1d658, 0x3073900263db468c, 0x21e0eada93edfd15
+, 0x5a17b3e0be793057, 0x1f40f547ed092058, 0x675fd6df88b36dd0, 0x6c53f891a0ffa435, 0x485ed48eca754a7c, 0x4afec0ade849bd90, 0x723cda1d6e3974ff, 0x0c6c62430108abfa, 0xaacdc73c6317cbfb, 0x416c908094fbc70d, 0x2855bc7093265cb4, 0x46f38759667f1f28
+, 0x0e9bd0a977e86b32, 0x55e91577122ebd97, 0x4a0e297c778b2b7d, 0x5155983f240c13a6, 0x4e586d220fc93fa3, 0x782ed25682f2c183, 0xea645334ca290752, 0x16f45b62557023c6, 0x49ffec145c0d1552, 0x727b659efe5a1eca, 0x8f70d77e73d5e0da, 0x53f21cbc83fc429c
+, 0xd05e54cb9c8b8945, 0x1c1e65545c59571a, 0x5b241861038720f1, 0x72870313cd2959fc, 0x008dbc94c1ae5930, 0x5b24d40c297f87dc, 0x45db709a6f90c372, 0x53bf89845d470da6, 0x031f87b91ed777d1, 0x69c33febab3b41f2, 0x4058a2faf6823d00, 0x79f549dc55a57818
+, 0x7db4aee085388789, 0x39611fb81690f1eb, 0xa757e3dc7f478948, 0x267ce87a99ddeb23, 0xa02a43178d968c18, 0x4a15b517c723f6ef, 0x2a557eb4cb59bbac, 0x6c0129cca1adc15c, 0xc2e822fd5f46effa, 0x331f058fec9f8672, 0xdddeb4cfd02e8c38, 0x02feb613ec3d3fc3
+, 0x9f7b7c06715d9fd0, 0x1aff4877aebe1824, 0x2208baa7506dddf3, 0x4022a4037c012c53, 0x12309a6a0798bf20, 0x58cd9cd2bdcd42f4, 0x5a289e07756c3cd2, 0x7fa6138a2cae7b49, 0x59e5fbdd58c63d9a, 0x5c4b5404db5a1924, 0x8974d7fcdb0a60e6, 0x64d3e83e7502bcc0
+, 0x373255e4c6ff85b7, 0x165ed8c8c71f6b84, 0xe10fc88ddc44031f, 0x00b8c0c6d0a62303, 0x5dd8b3f5e6fc8919, 0x38ef0028c1cfdaae, 0xaa14b63b78cafd26, 0x7f75094688b5a34c, 0x59e052d6943de87b, 0x1b94b631ff00f423, 0x24f64ab67ea8586d, 0x02fdab259c672bc8
+, 0xf9c45c25dd5b0a12, 0x5296fac2b9d05a98, 0x36374b125b541a9a, 0x2714c2d7108fb4bd, 0x0687779494b377ba, 0x1db75848d8b0eb34, 0x3fa84d262322a4d3, 0x677cc4ac43eddeb5, 0xba9d573d39007c83, 0x4124117e2f950ff2, 0xaf3100155b95c528, 0x76ad2734481b74f1
+, 0xcbf4be592998b21a, 0x35ba4b077b9634af, 0x37d770d03dc0710d, 0x6086ba8f26101a0d, 0x1f12d0f91d9b75eb, 0x17046c86f38e230c, 0x30b78c7433f78372, 0x3a4c293af496b178, 0xcb2c806e2a575d7d, 0x78f77c4d28494066, 0xe6dea0fd96a36d77, 0x250a31a1cb1dc97c
+, 0xcc907e538b099c97, 0x6fd834e0f953a7e6, 0x00c01fbf1dedfbfb, 0x6c5abcaaef4ad205, 0x41b8e52c87b18410, 0x01d8452c46750294, 0xd5617d51bea18e2b, 0x16929b6c5102f4d6, 0xa1a5b75b7368950d, 0x6dd148caf2629218, 0x0c843db75b5810c9, 0x4ef09ca009a30178
+, 0x38735482f4315105, 0x6a8335087efc0da8, 0x2dc244fb0287855c, 0x30ba7b5619b725fb, 0xa415f0610d32739c, 0x4123a073825a35cc, 0xf724234479351cb9, 0x24073f47c98a7879, 0x70dc9a74cc50a259, 0x54f9a1fc03bfd3c7, 0x2b74cd82e4f014b5, 0x6b98bc8833bbb98b
+, 0xd751ea8302c20035, 0x7e1d0cdacf4f6045, 0xa20b8ffbb842a2de, 0x601aadbe81f9bb1e, 0x9659f7a8d05bddd5, 0x02637328876fb970, 0x964717e94010d507, 0x142cef54793e4d3e, 0xca9b4fb5fc7ca4af, 0x3eab98c2a60de54e, 0x751842f1e3357301, 0x238b061e712ba4fd
+, 0xd921d9ee2277743f, 0x431a4ff98f6aa142, 0xa78b7ca3b64fba37, 0x59732f4cd7c97a0f, 0xa0c3fd380017b1dd, 0x78263000e11d0114, 0x0ea914167af57728, 0x0db7c166896253db, 0xb9a8c004fce4062a, 0x3897c3691a0fa09c, 0xbc400431814f7735, 0x328eb3210083667f
+, 0x9a971c1fddef19ed, 0x72d90a1ce3b8449e, 0x28008e3d4f1e22d8, 0x29748e46b9ecd4e1, 0xfeec8813d5890425, 0x10ec2dec161d3458, 0x049253fb47e7ab69, 0x54b936a47ecc76df, 0x830f07e47493940e, 0x0c2113149eb22a43, 0x461ec976fc7e184d, 0x3e7f734af08bcbce
+, 0x4989d8e2ff898eb3, 0x5875dedbe8f02e25, 0x38620e0550690af3, 0x3d58824b51ec4e35, 0x20f21ac5d5036233, 0x14ff3c368f9ae77f, 0xa776d8ccd2539b51, 0x75d580041befed39, 0x71e3841918a90c85, 0x1abcfe220ad2fe88, 0xb6af2b445f34cd93, 0x32685ebf27c18ce5
+, 0xc7a472eda222b90f, 0x5e27e3a46cb46a0b, 0xa86802a933bac3b3, 0x62f6e92a88af23f3, 0xb6508990cb3074fc, 0x4a673fc39d485033, 0xc18dfe290e3bbe3e, 0x43dd1147f17fee4b, 0xcf499f60fd539213, 0x322991a24b5f7559, 0x4f2e2bc5487d32f1, 0x0cd5826572435fdb
+, 0x593be52c32c2c6d8, 0x1513d5688c2ff7dd, 0x216188e53f2fdc7c, 0x6e692148299c912b, 0xf6716ed6b9309e62, 0x2b0a59a0a356ae54, 0xd00d42279e289d6c, 0x750adfe973d8fc81, 0xd0f0c23ecc9b9edb, 0x5b37e828a0d8bdaf, 0x4f9795d17c7977b2, 0x3d11bdfd23b31dbd
+, 0xd3d3d84ecf04cdc9, 0x1dcd65dfb12fbef8, 0x9b663bbe314f82ff, 0x26a31df71344fbd7, 0x43598eddd708cb9d, 0x11911d8693743a59, 0x0d38f3676206294b, 0x6818952c51e83523, 0x116f02c709e1211f, 0x5de19025a8e14d48, 0x565a24a1781cd4c9, 0x5ed01882d5730f69
+, 0xe72c16ab6908c0b8, 0x74035a52cdd94dcb, 0x76f5094c65c8088a, 0x36c254a5549b2fb9, 0x9ef3c6916dd02bab, 0x79d8e3ded94f6479, 0x5833ab9f7d9a3e76, 0x28cc37cbfb5c3a11, 0x3af26cf01f42aa53, 0x3d49c107a1dc92a2, 0xb17449f437faf048, 0x5325e8afebd142db
+, 0xad255ec11dd2f7b5, 0x1b28794fcb77b02f, 0xa5d6f087edd0f9a8, 0x13d93d0d36b9c203, 0x6c49663012ad781a, 0x4104efaf8124d60d, 0x8a046d00c327026d, 0x3820b6181e9349b1, 0x21c4ea481476cfee, 0x0f39561eff625867, 0x0ba2eadca05c2285, 0x7d5e90bbdf79395e
+, 0xa17128e96c441207, 0x6f69386538dd733e, 0xb0416fa281e4ebea, 0x456ec01b2f862ef4, 0x2e4ae1a48dbbe37f, 0x3334e16db8e7256a, 0xf49481c1d24bde5c, 0x22f1d9d2ad69e297, 0x5c8424c53fa58aec, 0x5bf57be6e6abdf96, 0xa46f873936b4adda, 0x4f78627d271ecc4f
+, 0xd933bb1225ed2fa9, 0x6d4b5a0b4e47f193, 0x01dac94efac6f4f3, 0x413c6840e7588c20, 0x11533cbdf784e8c5, 0x1fb3259b39dce685, 0x14381baa4d5b6326, 0x50726bb31fc0762b, 0x8367b5bbb09a10dd, 0x3eb0464d935ffc75, 0x74ffff130f747692, 0x648cc4cd4c818596
+, 0x9770e70fe6e039fc, 0x68c562bc430690f9, 0x5fdefcd078aef590, 0x341fcabfd46dfe39, 0xd699424ff09ae7ec, 0x4cea4a7c48f1d1da, 0x0b22fef6baa51c80, 0x1f30b531485977b7, 0x8ec95bb91da27357, 0x08c3ff38ad2a96e3, 0xe7ca28498388b122, 0x223fd9e5d9e22c33
+, 0x40b142d303ebff2a, 0x29bb726e2538fdca, 0x8525b8576f561cfd, 0x02de0a60f9e1d7c5, 0x4d20fc9e2b8362c3, 0x717030f971f858e2, 0xc85135a51e4042a7, 0x75d513b25a7b6ac3, 0xcd4024c237846525, 0x64d369a9a68ddcd8, 0xc692f214d687d12b, 0x6db5ddca8a05a6ec
+, 0x6cf4b232c4fb78d1, 0x0ce22052a01f20f0, 0xf89e19dc4254b673, 0x2edb58e02079d73d, 0x75de961f04770a45, 0x5810453e8e5e600c, 0x2a3120aaa58ce755, 0x255a36fbdf4f8885, 0x97f2fef1cf5d2718, 0x4365d842c558565b, 0xe1478133aa95e825, 0x6d13a52934a7c4c0
+, 0x42ffa963cdb686e8, 0x2fd56c9bd01c488a, 0xa472c3df84788d70, 0x6ef99aaf199070a9, 0xd3d75e368bd7e0a9, 0x665b7bb556aa2318, 0xfc80f4633b7fbbf2, 0x44c4ee4c33d23b95, 0xa4b1408043b06a4f, 0x2d2c413de2d489e8, 0xe8957ca0b48228d5, 0x5d131fa6ee7e442d
+, 0xcbde08fa1407cc22, 0x7aa4379e5c5183e9, 0x3378b943120a2632, 0x629c99468316112b, 0x69677ac980faf306, 0x5b22b8ec351653c7, 0x089b6dba4107b152, 0x355cb9fd7a854fd2, 0x5509d049e4926a4f, 0x640016662aa021e2, 0x7f08e043f5057176, 0x46de0c8b71db94ea
+, 0xe5445a59ca28b632, 0x1f6d3474f45e59fa, 0x6cf21147679bc0d8, 0x7f076f54099fd219, 0x86eb9e9374da002f, 0x03ef5060bede5efa, 0xd68a2aa51a8747eb, 0x4fda83610eda9e9c, 0xafe068644c48a16b, 0x4d749bfd6532ebc4, 0xc4a630da70a3706e, 0x5c2731a115d1db56
+, 0x5d7591c044c0199b, 0x4859e570924391e1, 0xb65011d16ca2a8c0, 0x0fad9b8f8db7ca41, 0xbb8690c33037dea0, 0x2325eac13f54ffac, 0xa6d77b81e289388b, 0x18fd5b08c9fc6196, 0xdbc371e5bc6473af, 0x2bc7b01e2d9ff0be, 0x413a903aa1c486d9, 0x7a7966b1a28d942d
+, 0x70608164206c08e6, 0x609fcc95b3ce4089, 0x26c4becccef89cf8, 0x65f07a9a4ba90ac7, 0x4c4ccbbb09036eec, 0x0fac57d51ab7ad19, 0x713856654315498b, 0x6bfc380cb9476634, 0x732531d3a374bb28, 0x0c63c4536865c271, 0x8d2fe547b85b9b21, 0x3e8a00ef67c5d2d1
+, 0x27d6f30e20a89ebb, 0x7cf3be8c7f0aa06b, 0x412f086cb42b585d, 0x0029796b3aad75fa, 0xaae8bb65de32adc0, 0x36f3cfb6d66a67c2, 0xdc1653b6adc297ab, 0x465e58893548828c, 0x6cf0206813f5e17c, 0x49b0683edce30cb3, 0x47ee8ff7a2cc8a13, 0x14714b5dff8cb94a
+, 0x081cd7d9fe0816e0, 0x272fd1e80c1f25d9, 0x46f9e24d38e14cc3, 0x40a2494033ee8faf, 0x04ed91f39e32143b, 0x57657e32d15150a2, 0xce958af4608a2e22, 0x60b799e82314a52b, 0x1a259d9e9acada18, 0x7c018e20538f8d98, 0x7a6675a8fb3e169b, 0x435c6ad7236f4073
+, 0xa61eaf4cc77ac1d1, 0x7957d57e93aa500f, 0x013e7784d1f72ca2, 0x58570ce818d32f2e, 0xecde06e878142b53, 0x3cc1edcfe2a9a900, 0xd8817ddd948fd37b, 0x50d11a91d1ecc387, 0x23bc8b1ff6e7ca78, 0x245e85dd0c45546a, 0x6ab35833a710b7e4, 0x4010e3c7b223ba13
+, 0x5814cb06a7b4c437, 0x038c162db1d4d60a, 0x3ecb29bb218e34cb, 0x0d186ed4595c7783, 0x4a36cf6ac951fdbd, 0x725316d3411c78b6, 0xea273b6d6f506aa7, 0x16822e2bd423e9d4, 0x7e7a43c00df8e9ac, 0x6c7affd5be9feeb7, 0x86581043c64f032b, 0x1a4809417cd029a5
+, 0xaad4969649222177, 0x308cfcff7c963627, 0x084ea5bd45eaf7ef, 0x600ad2991b8a429f, 0x6bed3fea904c4776, 0x0079af2a64b3d52c, 0x1ae6c683e2d73d02, 0x7a21792231b45858, 0xdb9bb1fe24b16237, 0x393e18d479f5dc77, 0x3677f13202851fde, 0x3186aff52c8cdfa5
+, 0x4910bcc778257f61, 0x08bfe4f98efd4fde, 0xbe658ee8e93a595a, 0x052c0bfac9b85cc7, 0x2bcd34b08999d3fb, 0x317c421347a0f969, 0x73275b4a0f1bee28, 0x6011e43c23493b83, 0xd65a4c9ef2823e54, 0x5ebb970c2c0d9cc3, 0xc4e199c1c0fbe5ec, 0x1056ee39d1c2a970
+, 0xbee69f16ea360b35, 0x2791fb693cb662a7, 0xe3584fa90e82b6c4, 0x7107ce0934c9ca2f, 0x6c3d81aa672497c8, 0x56543c5d9e145683, 0x2171b7ccf0b96407, 0x52871cddb04bdde5, 0x0423487afb9dbfbb, 0x0587c017d1dd66c2, 0x1a11c080d5105012, 0x3b4a3b34d7f410ba
+, 0x648fcac0d26efe97, 0x78e76f1004f21add, 0x27aa7c8561e59949, 0x0ca703ccb57bd116, 0x79279b470ec10a6f, 0x70cc7ddb0a13e776, 0xf5f30630fb726e48, 0x78d21b8db5df4482, 0x9507e872fa98bac8, 0x29dacdb5798b029b, 0xc5625fc8f554cb56, 0x7900d69f4bd6d952
+, 0xcdebe83d0f88de02, 0x2a84cadf3d415097, 0x0cf4b3a58d0aa770, 0x14c73e46754e347d, 0x0b8b2a04f2d9e9ec, 0x681486804b5c009a, 0x278b20af76b507ef, 0x336f764b1e163f61, 0x9cb78e5b551fe46b, 0x7707ab8f47c4170c, 0x44f679a1a223a7d9, 0x1cffcaa67d34f465
+, 0x83adbde8d284ba02, 0x2752408869dd0079, 0xbee3f1b385f90436, 0x6be5f6e15d250157, 0x461ccc8aaa65c0ca, 0x542113244e07f855, 0xf07bdbce21d79ecd, 0x5df2488b92041f11, 0x7cdc5d3cd27224a8, 0x0225c0a14b0df723, 0x33abba9d0330b4bf, 0x50439fd0f07a8198
+, 0x23dbab5237678ba3, 0x0eaefb0a360d2ae9, 0xda6d40054973acc8, 0x5fcacf7ba15c87a6, 0x46ad163a123a5f42, 0x20f592a59c35b72f, 0x5653a8af5d70fb31, 0x4661699589bb687f, 0x905a2a16f73d7256, 0x3c4e37c73a2c82a9, 0xd25d97eabc27c6a9, 0x04758ac4ce2f13e5
+, 0xaf366752480d709d, 0x2aa983b1bb92a003, 0x78a814cd5e7bf86d, 0x2e47dad179dbec36, 0xb191eb38490c4332, 0x1652158adc27ee31, 0x3998806003ea7483, 0x37d1e4db2472794d, 0x45a257429a828bbb, 0x58d928bb97c2c255, 0x4b3c3ac0a6958c1a, 0x051dc6baf3aa69fe
+, 0xed587999ffd7ee3a, 0x2ed4901895de4d4e, 0x5f1fdd791c06eb6c, 0x27dfc9baaadbb94f, 0x78a424a42c6fbac3, 0x6db84ac7661be91f, 0x6829300be5eb0c25, 0x5fd274c23944adbd, 0xb603f1301273b931, 0x0a24b95d2a8d995e, 0x12d7da7a235ca79f, 0x74187293cfe26e36
+, 0xd57b97c3fa9efd60, 0x0ce8cbc930006ab4, 0xb4ee39cde9b0395b, 0x77049238a3463852, 0x46877662dec7b4b3, 0x3150c1ada240c042, 0x71621c3743fe864f, 0x5eaf4ca804da79f2, 0x87fe67c117371452, 0x179dd17cc030ffa7, 0x194b895d29b0c4d3, 0x53e75b71636ec816
+, 0xc1cbd4cc82b42563, 0x43e36f1d3448b373, 0x84a4c9e21e765bb5, 0x42f42917b192a59b, 0x59f7e66ea3380aa2, 0x3b178b8f63d4dede, 0x0b807f538546510d, 0x2c93faf14e57e41a, 0x908c07924013bf1d, 0x369dee3926cf63d9, 0x6e79a3e5309ab350, 0x1526c71711507d81
+, 0xa1fe13dbe3c64ff6, 0x1a0b6f152e1812da, 0x031e234f82712a7d, 0x6fc48bd14be1bd39, 0x105c1fefcefb743b, 0x327663f5b436a4f4, 0x2e4ed8e562cc1aed, 0x1f798b96db330064, 0xd2accc15f28ec175, 0x0abb3044f537747f, 0x96b613a9955f9b07, 0x570520392a36e9dd
+, 0x7668e98add55d69d, 0x49b4c96b3f67f648, 0xb7f41ac63f6759dd, 0x4767f29afc5999a0, 0x1991a0a97151757d, 0x7e0d85db5f3cb178, 0xc1a86c3cd7ab70ea, 0x7ff15e1ac871da2f, 0xba87ca342716a86f, 0x3e2bbb311fd4fbd2, 0x187bcca575627739, 0x7b9921fcc7d53bff
+, 0x08c7a3d778ad0209, 0x0f7e6f9a64762725, 0x09e7662c630521d9, 0x3184f6e39ae1b449, 0xc25ad78975044991, 0x10a515e3e3bb87c6, 0xeb577109c0813a3e, 0x0982740c44f37b95, 0x0aa26d8e95c13fc8, 0x088572ed496a5390, 0x9bcbd43d7a022130, 0x6a83082d36f6252d
+, 0x8526b41d3307f1f4, 0x6f72dbb76e277fbc, 0xa5e0235405995fff, 0x0ac789583dc05449, 0x8cdaaad57c7fa132, 0x5d7af50d8e1a594b, 0x932c962cd5edfd8e, 0x6c8d83b220886332, 0x836623799fb259e5, 0x1829d78b5f522910, 0x89b27222e97f0a81, 0x58d9489d02192d49
+, 0xf1649f39199a2c75, 0x5d984924d5c596d2, 0x60c76fb4d88e6cbd, 0x7c388ac14b1c4380, 0x3773458acf955b59, 0x7b39f433bbb0dbb4, 0x87643dc97c4ef887, 0x7c346d2e95e7fb9d, 0xfb3e9022dc24c723, 0x2a159f6b3ece475f, 0x025cb5de8d527797, 0x1c833e2a9394bf32
+, 0x79a15ef39c4c7631, 0x001a92f19d5f32e1, 0xc5770ef3c5c714c4, 0x51c89997839f64d3, 0x24d4a35ee605f9d3, 0x6d865249c080690e, 0x3e95cc1de2bc35e5, 0x6a8ee5291d36164f, 0x537dc3d0daad2a6f, 0x722b83491af0e94b, 0x56f236cf8ea52ccd, 0x50d4e6e4d9643ab2
+, 0x608ba959dd2c7f88, 0x5ec627c4b0bbb984, 0x3fdb81804261eb5d, 0x60dc512d969383c8, 0xb22f89c629052f40, 0x6e7f9b4e87984bfc, 0x5a08aa79693f9dc9, 0x0a43ffc77023ab61, 0x14b897063816a6ce, 0x0bc78aebf1a5af5c, 0x9ab22122561d5e02, 0x0cb1f698ba07be80
+, 0x6b79e212b5c8f448, 0x4522168b7f2597e1, 0xfeb5d54b50ad27bd, 0x44a82a43f4569800, 0x073beb3707054a06, 0x5b897349fe3d8a72, 0xd08253c8640b9240, 0x6c2e1bd1a35e717f, 0xdd56272c9f662d07, 0x59ce19c8bed6e238, 0x82791bd967222643, 0x1f404bc0365a659b
+, 0x7dc1fe30fad462f8, 0x11f1fdc655f75cbd, 0x7728fdb6273a689c, 0x21636fb270c46974, 0xcf110fb9e9192586, 0x1ce1cbb07b0fd1f3, 0x0c593e34d6b55ffd, 0x6c11555188a2ca9d, 0x91b7163bf68c5ff7, 0x29cc35e43eec9058, 0xc5363189d8b5d542, 0x67bb71cb768aed99
+, 0xb4ed48312228e97e, 0x6ce9669313a684db, 0x47792fa3c8170385, 0x376f9b1afbdd77bf, 0x684d0b2e8b80e86e, 0x1cc790e06f385ac2, 0xffed3777aa551ca2, 0x55aed3418c680909, 0xba87eb58cbae0f38, 0x7c4d06bebeb21996, 0x9c61479e0dedf0dc, 0x7cff3f9f74bb6baf
+, 0x152bbe49ce09e789, 0x698926b5992a8c08, 0x82e744700bb6a05f, 0x3d935ce7eb2becf8, 0xf22a98d499bf3486, 0x13e04f2078184b72, 0x43fc60ac9ed34735, 0x7de02aed8d42c9c3, 0x72c4e724c1c3ba0d, 0x1d677e2e80017901, 0x2eb469e826370836, 0x5c0a2dde99e90419
+, 0xbf38b9839d7eb610, 0x0f070fe2bf035040, 0x3df656da6a60e5a5, 0x0925495dbc4f1921, 0x3a20e1a4e1f29a57, 0x14aba99a572adacf, 0xdff7c526077cc7b0, 0x247946a5dde2b949, 0x62d84ccb5fe6d6d5, 0x211ae9eb88e3a69a, 0x3f4eaa9a20d08007, 0x441d5b02423fc62b
+, 0xea5790a0469aef42, 0x630b887b4fc5df96, 0x3627194a33a730e9, 0x3f8c48036e6176a8, 0x9533d942da1700b5, 0x1f655987646eafb5, 0xca42b95757d05fa8, 0x572a4ddf7b794080, 0xbcaa2f1561a06e00, 0x2d6c4a9715c36b06, 0xd9750ceaf5a0a99d, 0x33a025f98f41379a
+, 0xd9176b9914cc29f1, 0x01f5804b4ea1532a, 0x5d29d90fd881ee91, 0x609ede681956b1cd, 0x1ef5ca62f8c1aff0, 0x3504bb143fb33d58, 0x977752c3394455d0, 0x0907421db64b6d1c, 0x01f2fbff095bf704, 0x343490b243fee024, 0xadc121f26af2439d, 0x38aa1b826d57400b
+, 0x6e24f557181e2bc1, 0x3d115b303d60b0e7, 0x25c24782cfe2d27d, 0x33b880da38a67db1, 0xb078062fccde1787, 0x60a344e22f58532c, 0x2e11198db7adc37b, 0x02b2157f611b339a, 0x7a1896ff61a349e6, 0x3a69f673d03c322b, 0xc2475c98c646d565, 0x41ba2c314051ab91
+, 0x800597c16b3f7256, 0x607f0de904485eff, 0xed51d8fd80a0c76f, 0x09367bd69e8056b0, 0x7fa7d324b7ac5ddb, 0x1285b79f1429b97d, 0xbe8e290aee649a54, 0x4bdfcdb6b04490fa, 0x46c3a818f6f402f7, 0x30cb567b4f913434, 0x457d66a3b063cea7, 0x13aaf30e3178d99c
+, 0x6c6f510922ee0a27, 0x57189de784cf3036, 0xe77ad2a272e28ae7, 0x4b17929c05cd396f, 0x9638e3a1f15bbeae, 0x055f6f8e2609c666, 0x6cfb57373d8ff0a9, 0x42e39ac6ff4377af, 0x5647907284f4b324, 0x004188bba6a03436, 0xe826161715df496b, 0x5b1a08e9dcb9549f
+, 0xbbdf94236e39d910, 0x5fbbc503ed1fd02a, 0xf2ad03a838825aba, 0x22c36a38596a50ac, 0x36b3eabb76f911e1, 0x1ede33e4fd2cce17, 0xbd656d269fff0710, 0x26324ab689fbce78, 0x6ba26d66497eeeca, 0x78608002989a5204, 0x2930201cc8039872, 0x10c386d341d650c0
+, 0x5ff09eb12980fa66, 0x35612cc66beb5322, 0xa4fb540d15f42378, 0x202fc2ccf0204276, 0x56c23ae17fd84f9c, 0x3b0e5efb3bcc5a5d, 0xe760c33d398c9ee7, 0x40dc1afd5c27d6a6, 0x8a88619d6dd6140f, 0x5c54baa77b35a677, 0x06e5410148e8d4ec, 0x0185c0a3a223ac8a
+, 0x34447c215cd67593, 0x065b37e2bcf6c834, 0x71185432549ff7f8, 0x0a807fec044418f3, 0x7d979bb8cffb964e, 0x6633e6d0a80c35d6, 0xbf4a0d25a07ca752, 0x36d077d73e178e4d, 0x6c2b922cc53a0ec7, 0x378035fa6b97b2ae, 0x65bdee411b9b3c35, 0x33f323bdfe59185d
+, 0xe45fc0fa200525fd, 0x47896cdbe6c8f446, 0x62b6540dfdb14351, 0x71ec4d4bceee8e64, 0x249200d39fb1c1df, 0x7ce8ca6257771af4, 0x166f4c39c18bda90, 0x4914a60b995550b4, 0x31dc9df487a4b004, 0x7f4cff311144fa68, 0xd21aab7396fd5d95, 0x619c08254d3527c4
+, 0xa47ade7e7fb7a166, 0x1f5c6a5f957b5065, 0x6fe9508497c776e3, 0x755c15d7dde4c5ea, 0xf22f86a93b65d354, 0x3218dbd58e7559fd, 0xb0b3b7b95fbd5f56, 0x3f363ecc0f3660c2, 0xbfe58bc890ea75af, 0x0f8d3132ecf26201, 0xfc50e93cd2ceb654, 0x6226ec1322d790f4
+, 0xaf0f9210982e80b4, 0x27535c4fdfeed874, 0xfba87038cb03e45f, 0x2287f358f1f6fe77, 0x65c5d815c1804214, 0x3e33b9de5a8a46f0, 0x10753fb96ef4dac2, 0x6ee033c29c495570, 0x31b7160510b55cdd, 0x35079631e644c3a8, 0x76f86fbe7f81673e, 0x1cf6431832ffdb8d
+, 0xf42cd82e1cb084ad, 0x102f0a87e80329de, 0x1a1c7812ea9981fc, 0x74d41f54b52a3b7d, 0xeb3f1e52a584b4b3, 0x15fa5b7e333ccc5f, 0xfb359bde4ad18ea9, 0x7f6947196998be81, 0xd10a92d0f8b289e8, 0x2799532b9060411f, 0xb08e9412818229be, 0x485b2228b4a9baba
+, 0xc4439a808d03d0a9, 0x60c6bcf9f512d158, 0xb4dd105a727e9eca, 0x737dab141c63f3fc, 0x2dfeecf7e0d91415, 0x0a1286798a08e05c, 0x029bf5833bcf1bc3, 0x5be0ac2ee761ef2f, 0x4d5e0d0a34006906, 0x105f562f18c2b7b1, 0x38a419ec0add56d6, 0x471d0341d20f5a57
+, 0xd25d6b21b9f51409, 0x5924177db50aab3e, 0xe190d7abce398c5f, 0x65c8e32dd9a60af9, 0x2cbdd0158b5f8f8f, 0x597eba613e6d1a54, 0x6f4067f1fe768b5b, 0x709d64873c20be02, 0x0bb2c357c9993c41, 0x6e688772ba4d0127, 0xcb064c97f87a2572, 0x0f5c9dd908b5c0a3
+, 0x53acbd049cb7dfd1, 0x792b48590343ebc5, 0x160b7f315f3468e5, 0x0eafe76e7bcd0069, 0xc70c02b4bf7f21d1, 0x64e49b285688362e, 0xb848f9e84c840618, 0x7ee732693464e764, 0x1033683ad7b92354, 0x7aa774a96356ae22, 0xa682cf5d92a7951d, 0x16095cb4759df315
+, 0x7f74048fe36ba80b, 0x1cb0ca592f5a31f3, 0x8426e1f8901f344c, 0x2f6474cdde2953a2, 0x7705b0538943e83a, 0x5dd432ccf2dff741, 0xc63153bbc1ff1fff, 0x04ec6dc58e1f5b84, 0x81e98449a18e314f, 0x422e6af1f3f15028, 0xebb2d7e75d1508b8, 0x341e32c1c13da62e
+, 0x91c2cfeaabbfb48d, 0x63f5a97502eeacb7, 0x878dfb60fd2bd1d8, 0x5f6ca59009f9c879, 0x6d5e8e63740b79d4, 0x146e90b20a1bfa4b, 0xc154be3fcdf8a296, 0x4416e64e822cc73f, 0xf83b09e661699786, 0x51d70a13ec405b13, 0x59f91a9107f34743, 0x7696daf53af7009a
+, 0xcef2fc4e4a08a50b, 0x460c1b059d0c8fb4, 0x6b2ad9a44c2c5428, 0x4706ae16c89f6824, 0x517b2ccbb21e2daf, 0x7ab2ea92d0145dbc, 0xa40b535857a6f11b, 0x2dd9f608ccaacfc5, 0x97431b7d3d264409, 0x199387a35f7c9b0f, 0x94db37693f2d39cf, 0x7a06e6a9e272606a
+, 0xb2c6cfde48bdeae9, 0x513ea507948a1af4, 0x8a5e6db0caa95fd5, 0x2af9738c50576dbd, 0x02b9ceec1712b2d4, 0x1fdae197cecdf0ec, 0xe8f2f73828bf7c7e, 0x3654b006688283d1, 0x4ab9d14be56052ea, 0x2cfbb5a593c42191, 0x5a8a0a0024019833, 0x404e4c04a75e02b4
+, 0xfc31471a7e8b9ccd, 0x2814b417e33f6b9e, 0xc513dcc07a908e12, 0x5460654166c32373, 0xfe35410cdb40fb6c, 0x2fc304f5557ce186, 0x913b785a641dfda6, 0x566ae0b5de08e296, 0xbd7ad641bc9ab69a, 0x24ec67e36f239dcf, 0x50a77e562bf34ba8, 0x58b8c1420a4dae1b
+, 0xc9537d110487ba94, 0x37c841b3f38b6e3e, 0xce2f0e3e262c563b, 0x75b91046c638358c, 0xa75ff3d5e9a3fb3f, 0x19b2fb18e91d148a, 0x28adff9f4cdcc1c7, 0x456a6e01ae8bb8b1, 0x9952cb17290abd53, 0x30b4c123ba716280, 0x9f65584815df8f3a, 0x3700bec883cd64c0
+, 0xd74489788393c2ad, 0x79c988b00b5ced89, 0x8cdbf92824ed78f5, 0x4b375cdfa9af8afd, 0x7e11cdd16f010de7, 0x58bcf19bb1a3101c, 0x390680a121c5a84c, 0x0bbc0439789237c3, 0x398f7df84389c424, 0x32ec0a9fec4a477a, 0x22b1540c56e8417f, 0x071a0cc03967e669
+, 0xf14e68bf9442a330, 0x12073d840ace3509, 0xd0c71e2067c81d5f, 0x7a12c83e44c77ffa, 0xb24e5b0f06e210fe, 0x48b82da0368b4752, 0xda55827bf3d07734, 0x0b61b91dab80a5d4, 0x703270ba9baf2cb1, 0x37eb3eb5bb787bd6, 0x67f9cc7b26020e2a, 0x6b7658cd71d12246
+, 0x86bd38059a7a3867, 0x413c00198518b32f, 0xd504a86ffe8876b1, 0x28c44c9d5b3dd373, 0x730e0ea389f9de34, 0x77090c4a5aae5dcb, 0x3e35ea216548195c, 0x275ef8a2539b142d, 0xa1d704d70595b512, 0x21a04a401676818f, 0xc6a01adfea85e292, 0x1e93c17a5865950d
+, 0xde4232af64a7dab7, 0x24f17bf2938d26cf, 0x00674e7a62ec3e5b, 0x2e7f4906569b4585, 0x046c959323f1c85e, 0x1b0983f3cd898a8c, 0x7c6ae63a8398ffba, 0x157a6df52f1103b6, 0xd5e31314a119aaf8, 0x152420f0ba263432, 0x8844b36c7bdcee3a, 0x07ee6d93c6e359a6
+, 0x9731094c8797805f, 0x087e15952dc0f876, 0x0a198025da98c7f8, 0x3cdc1d518aabf95f, 0x1d5f4c243b148ac5, 0x5c3f4c5dca3414b2, 0xcaef48c2a4251469, 0x5c60171902e96f08, 0x55659beebcd0a9bb, 0x2bf350b4b0a1f129, 0xbfb288ef4cdfcf09, 0x7374973cd5c19492
+, 0xc25af98c302ae336, 0x4397dac27e541477, 0x55457364405c167f, 0x5c552b3567b2094f, 0x194db4e59a64f302, 0x17871af4bd2e4d1d, 0x98839cb736750228, 0x42dbd5b68c7c67e8, 0x0a1fb4aeb679a47e, 0x24a1362fac993ffc, 0xf3f8b1956dde3862, 0x3e623eb46f5f72c7
+, 0x16fbca3358fbec78, 0x281a45ccb7bcc1af, 0xf24a4f0952c673bf, 0x4a763d51850443c3, 0xdf38f121b25eb662, 0x129ccac95ff0cedf, 0x63eb9012595e4175, 0x23835ce5e1ed17be, 0x11389c454257dfce, 0x746cbb4d4f6e7b6b, 0x29733caa0c6f3869, 0x4ad446921b8a5428
+, 0xeec528933b8fd1eb, 0x71bbb2e51c1d1fef, 0x8f21a0aac8d32968, 0x32ff87d504931e50, 0x1dc7bc40290fd0de, 0x099ef161df9aea05, 0x8e89ceebc833310b, 0x0b72a4a2fe411a78, 0xca5be3e6acc1861e, 0x6c5fe01f5dec6a0d, 0xe9362d82c80013b2, 0x3a0e5041d75129a1
+, 0xd4188ce084027ee6, 0x2b65a4cea9b76799, 0xad0c47b63acf5026, 0x2fe334ed1e7ec03a, 0x42491d33e1001d92, 0x5ca4b74b8cb2942a, 0x96634f5abc47bf43, 0x307a0eae46cb124d, 0x4915264ad265e140, 0x2dd2e343078ac6db, 0xa7f03f0d6b168aa1, 0x6db66c0485c6e336
+, 0x1b6dc7316841f268, 0x37c43d08ace61ce2, 0xf25d1e1518e5d676, 0x3985fbeedee61d5a, 0x6af6b05cbdc9b992, 0x02e1cc322cac3dd7, 0xba661af920ea50fe, 0x2498e68986e0fef3, 0x337175717f63ab3a, 0x35cb2124e2f274c5, 0x8b52f586a53464d9, 0x7c17578bacf91f7a
+, 0xd59cbe430cc27fa9, 0x60e7f4a57ecb997a, 0x7480218fd09212db, 0x2374cf52180c556f, 0x82da565b38c24f2d, 0x6d91ebc522f32ce4, 0xa779c901285ca4c2, 0x6292b61d67a387d4, 0x3998a132a9906f53, 0x64a45ec8027a8c9d, 0xb0d3e02669d90cff, 0x665ebdc6a6cb74af
+, 0xedb26e41c330aa9c, 0x545bae98e70e294a, 0x172337dd193e86d8, 0x0a135da5eac9d2aa, 0x39c3f56cd8e094d3, 0x00333436f5b1d6de, 0xc3c91e87882077b5, 0x332bc6e1f48fd13f, 0xd7656c16d505d3a2, 0x73d876de900958f0, 0x90ee74f5bbdeeba1, 0x786d8f6b622c98ba
+, 0xc7dc53ee7906869c, 0x023aa3c76ad12613, 0xaa0e4f009bd0a42d, 0x53800ac2c8864766, 0xd59403eb8848f39f, 0x47bc476cfb201284, 0xe1a9bcc65831b3fb, 0x559218d4310c978d, 0xe37c4848b668c5b0, 0x700cbe4998bfbf0a, 0x0045e6e5e3b19e4e, 0x413e3d17faa4908d
+, 0x437e7e21c668d1be, 0x147cf79ed91a91d2, 0x32d510b0a9497107, 0x616ee28a692b605a, 0x76a256918fb78da5, 0x52a4e4bb2a1c5dcd, 0x48e8eccc97e37e2a, 0x38f0c93f85ca5998, 0x84e18edcb59b2c06, 0x437b1cdd24031ffd, 0xe709744a9ebd37da, 0x096239b0d8e405f5
+, 0xf1066d761b21db3b, 0x09d629cd981debf5, 0xc17283c1ad5119c1, 0x6d8579181179f829, 0xbbf4c37b948fcd86, 0x4d1f8aa279aae64d, 0x466eff8d8180a10e, 0x6ce576c4b3644056, 0x3e281c5ed021dd22, 0x4a03bbb3daff902f, 0x70562d9d4d6573ea, 0x1d168b55c38afc1a
+, 0x6fb47270b095d2f0, 0x49e6f45c7f64a928, 0xf91b209a5bf808dc, 0x41169266c60037e5, 0x16feb717d3f256c5, 0x02ec0415de3ac17c, 0x0dc4932bfbe953c1, 0x492e1afdd8f781ff, 0x5bcccf347f970e52, 0x2311e59b0585ef72, 0x0dcde531a6590590, 0x5c4cbbd08be02560
+, 0xb8bc05f848827406, 0x05c124e6af418c26, 0x49366ebbafa827a2, 0x28701ea902e6e9b6, 0xa3a0613304055037, 0x46e086c0452ddf59, 0xa95ed669f086a2e2, 0x1fa2c21ce4c69f54, 0x074c6c8eebcfa2d2, 0x05249501ba5828b8, 0x70649f7c85f49932, 0x107d314bbdafc1cb
+, 0x2e6bca8f54da58f1, 0x5c09ca54c30acc03, 0xc027a0b28872b39d, 0x669cf15e8f5725dc, 0xad9b2dba0c649c83, 0x308cb010c0b8922c, 0x204b1bd9e7a63fac, 0x2b731f499e2ab127, 0x79186dd7d4398615, 0x39183b86c2c15721, 0x761c8155fe72e95a, 0x346bb1bff91dcaf5
+, 0x3182f2be3d74704f, 0x7ceb2c5df6a1a45b, 0x6a95f04c9ebdab9e, 0x45f7d0a1476e1a79, 0x05fee5944eb6e3ea, 0x33d2a347feaa694e, 0x000bedc2c9653945, 0x48c86e74aee1a245, 0x890c9f3afa1584a4, 0x0fe4b869b8f01e13, 0xa87bb329d9554d05, 0x3834296699a30090
+, 0xe943ce84bed0db01, 0x20d5a0161b504e4b, 0x2f6da5ba90913870, 0x6823d7440a8b2faf, 0xd655a2cca591fb39, 0x7ea6b172f586e941, 0xce2b9c63330cfca2, 0x4b830677bf0b9cf9, 0x31de4bf1cc3032e5, 0x164b99195f93e345, 0x3c0c3f506841dfca, 0x29b118fa24754152
+, 0x990ed7d197165c23, 0x7fb3ba7fa2de51c2, 0x1960cabf5971ec2c, 0x132c05530d731fc2, 0x6968cfbba97e99b4, 0x4170f47d90a9b1e2, 0xedd20fe1c605399a, 0x70f95f6ccbfc265e, 0x44eb03a23f7f024a, 0x531eddf58f85c2ea, 0x943547a59843c186, 0x7b5f182c013ec72b
+, 0xb3468f839f3b01d5, 0x064484b853d9e459, 0xaf6c4af7ba9f6dae, 0x74ba563fdeea1012, 0xa9ce2d8d754bd221, 0x46cbdf5a52fd68e0, 0x15eaae935963603e, 0x16a9d6ce04d234e7, 0xcc4a1903cf2f2f3f, 0x3142cfab497534c1, 0x8eebb9da6f8e3c57, 0x7098df907de65e6f
+, 0xf96834b50e2c8783, 0x307b83aa35a1c9d3, 0x91f92c5ea51ab2b9, 0x589412173742a270, 0x461a88aa0c82c486, 0x04165a5b6d87c2ad, 0x783df4244fc1114d, 0x396cf44c9ef391a1, 0x9742e9c24080b445, 0x0cb36421134066c4, 0x857fc2e45992aae7, 0x65fd48a2856ea48b
+, 0x18e24684dcc28375, 0x4ec518c73bab92f2, 0x04980f1723fe91e6, 0x5cc95eee2b914b16, 0x18fc1611d996eb8e, 0x0b671854e3cf3bbb, 0xd227c8efa6c95576, 0x3a971574b347bdda, 0x766fc10cf35a94ec, 0x655c444bdd83df71, 0x0292909e4c7f1339, 0x4c76d417599d07c3
+, 0x8dba5699ada3d103, 0x603e03ec330c1d7c, 0xac3da79e270265fd, 0x1c1cb49a25c14529, 0x2885af8f7bedee49, 0x37e7d33fc30116bc, 0x6e478ea29a3331a5, 0x537e3456f4f75c73, 0x0a4693ca96d79210, 0x0c2b4fdff0dff8a4, 0xde56a9fbe0fc7fa0, 0x2f2eebc3eb4f538c
+, 0xb79ca2c5cceb35f6, 0x41a65de1b1903230, 0x6ba817d99e9201d8, 0x35a153a3adda2eb5, 0x5c0ba9d7709d7986, 0x4d871c9d73f2bed7, 0xbb43b96c64df4b47, 0x6082aff58a004c30, 0x3a06efa58cc867b3, 0x1ce67538c8d47e2e, 0xa50aa6a1d83146b3, 0x452490d6a6803713
+, 0xb60ad6d9da0d3da0, 0x02194366729ed5b5, 0xa8c36862d3f028c7, 0x55f6343c37190e01, 0x5a51a3d7fe9b370b, 0x1b59b17bd0bed162, 0x3f7dbec2cf0708dc, 0x3392aa96ea37e68a, 0x60a008937cae2796, 0x4969f553196678a9, 0xcbb20e2de72a7e94, 0x242e8709b77baff4
+, 0xae41ae72af502092, 0x648e317f1b66e468, 0x297e7a819d81aeb9, 0x12b41f36e5abcd6a, 0xfc29f1a37c75efeb, 0x116dc1b640dfcef8, 0xad9c6ef5a7c014f4, 0x47a56cb512eb9132, 0xbeee1ac5739de6b8, 0x39f97405aa8093e4, 0x679c4866e37015b5, 0x5aa41389ccc3805c
+, 0x4396cf732172c48f, 0x7dacfe081776af1d, 0x8505564cc22f5071, 0x3cf0adc2e948af09, 0x671ea268b7c05737, 0x56758ec12a0a6ea3, 0x769d0a481a967a86, 0x2b074b3c39a4f3d7, 0x63b59aaf062dade7, 0x67625f06b63b3c10, 0xc6e248a1a471bb9e, 0x5fa7ccfa98078189
+, 0x4377bfe3973cb437, 0x07f27019317527a3, 0xe0d893c10f4212da, 0x7999118f15a702fa, 0x8a7ba83338442fdd, 0x2e5fde2955d314f8, 0x88768029cf62cbb9, 0x60678097d7507e1f, 0xf9d8435af0cfe20d, 0x72790d9ab97d7782, 0xf07b4c0f91a7dd7c, 0x0b9f6898cf861413
+, 0xeb8271dbd16600a2, 0x7c0e5561ce7ec5b2, 0x8883190dee374f7a, 0x5a73902d1e392d4e, 0x2ae116a3604e9bbf, 0x4f9330d2d9f8427b, 0xcecd30f04d7fb5da, 0x10995eef2d60e43b, 0xba8225d3beb49ff2, 0x14c36e96be9d2bce, 0xd0691679b7a7f875, 0x4089804418a95a1b
+, 0x008a3af3a6b88730, 0x0cb11d6455de9d52, 0x3c77e611f8d988e1, 0x4b9b95b03ce4981d, 0xef1a447bc00b9a00, 0x5d3f5581bd03dafd, 0x0a6c3e806620f0e6, 0x75fb34f8f15aadda, 0x7efe8396485e41e6, 0x799ee00b4ce28516, 0xf0db07e1c91e3ff8, 0x4e3b4f40f006ec4a
+, 0x0939facde27b4fc8, 0x5eed509154b607d1, 0x2247d3e608f734f4, 0x759c04a6d802c96c, 0xa16a2c8c70a37ba4, 0x2a0a64c6cd1ffb80, 0xf8492d26bf90cd78, 0x2780272c89f5c8c1, 0x8be435dd364a5b6d, 0x477bd892af393e84, 0xd3c31051d4cf23b3, 0x117e00204e3b9210
+, 0x00844dd5b8282724, 0x15afaea23514e68a, 0xb38743338130bb5a, 0x458c09563c11dd72, 0x45ebf628a6f46c17, 0x37dcfe566571f537, 0x1f90052a5823870b, 0x2588570c2d73413c, 0xde287fb9df4ffe29, 0x508b168d27622571, 0x60e29d57335eae79, 0x005a4168b2c6ec6f
+, 0x07505a4e75c9cd53, 0x7b70c0b4fde4d081, 0x15cdf390ab77a412, 0x4ec87dc187898037, 0x3a4c13310ea8c5ff, 0x26a81177bea04fe5, 0xf460a60a6aac01a0, 0x66e0746f9383d115, 0xa82f87d1c1a4ecce, 0x651aec81a1e314b6, 0x8650ec0c49cd3a3f, 0x3369c4ce89206419
+, 0x5f5ff28f64465793, 0x6b4df0ec7e891c5a, 0x5b19c67a140fc087, 0x580a95c782739579, 0xa705e8112ed9dbb3, 0x046b205b20fdead7, 0x98e1e3791809d8d9, 0x736c6d2b3957b438, 0xd66a78dada2c9e33, 0x4d5cc3b0ab198ed6, 0x53d1d955bbc0f65c, 0x790801ba50f383ae
+, 0x954b5309e243bfe2, 0x307cab3617577e33, 0x243384d7480989c3, 0x067bb2188f3a6fe5, 0x84faf1252de667cc, 0x5157b866d9acccbb, 0x21c599a6677e7474, 0x26ff84887f96e2bb, 0xeaf8bb66c98a60df, 0x35c5c69c0a0ee446, 0x5455215a701e1ef7, 0x52a67659b35230cb
+, 0x26a57fe02f642d2d, 0x65e58db48af6b430, 0x55cdc2ff28e1121d, 0x04b5db61127cf7a7, 0x34321377708bc205, 0x137b0a17c523c415, 0xf37fbace389cecef, 0x1ddddcf6662e8e28, 0x9f4b4a2034628d6e, 0x3cd3b30a346c0963, 0xdea3784dd3421068, 0x37075c8e9bb31820
+, 0x9c6134c4d36e3c40, 0x3ed19322d57f6562, 0xda60b9428c310fbf, 0x2e30b0510f349f65, 0xa068fe102336436c, 0x6e0596be7cb80c4e, 0xbede241ae493035a, 0x60ef6bbe1b12a7fd, 0xad470c1bced79682, 0x37c73d31d356104d, 0x5f19189aed4a1015, 0x393134c6ce11a479
+, 0x927c0709b59c2c40, 0x4eab8cbe7ee45799, 0xbabb91810de4ed7c, 0x5a4cabe12b77f607, 0xafde70b1e6dde218, 0x3ca39e999e8a10a4, 0xc30726faef7da6cf, 0x53de04562d7339f1, 0x90baee3def1753ab, 0x6358e139fb2d7758, 0xed03c273643b5602, 0x6d7007391d2d05cc
+, 0x710247eab1465395, 0x0efff0716bb6948d, 0x988f9a5078c7321b, 0x1fb63c8ac98a5f8f, 0x77b655f1abbb549c, 0x2d2e516967e1b5b3, 0xe4caa71d40137038, 0x2f87958202489e60, 0x547deb31e7ef456a, 0x55cf587edf09869d, 0x48d10d18363b0d58, 0x034bf3d052f04474
+, 0xe7f0886bdbc73cc5, 0x133d6da856f6f46b, 0x149796c396225ecd, 0x38b986b450dbc092, 0xeeb5acc682ae9191, 0x0eee9ee8ad8f2802, 0x9a99d5d78357bdaa, 0x0c467a35d6a75d23, 0xd22b7d55effd64ce, 0x25f0318a6764093c, 0x559151ff1c9a5141, 0x1721192df8fc8d33
+, 0x18c73cc6f23b226f, 0x7eb8129e0c14df85, 0x574bca2937ac8776, 0x339b4df55316c180, 0x29bee1f9ced37651, 0x21c826a2097eb1fe, 0x0d08f160fc91a3f5, 0x39beb435a405a553, 0x8cd418b74faecdf3, 0x2f4d61806641cdfc, 0xa8e7698c28e3d218, 0x471213f8ac45212a
+, 0xc9b3d3eb6af80795, 0x3e7660e600070c86, 0xb1b17b905ec91c68, 0x0d979e7ffd549d40, 0x616189b9f1822aa2, 0x5f271ea4a3340208, 0x20a781534cff2e7c, 0x29063935053f56a0, 0x06ec0acb82f0952c, 0x5cac0fbda3053a8a, 0x8c02be9a9c686e37, 0x1bb02806119cf06b
+, 0x41e5b7295bb783d0, 0x05e0dd3119f2e39e, 0xfcb42ba99415a946, 0x72c7d6b31a995621, 0x2c108276400ad52d, 0x2f9e9ce9c5eed627, 0x4b39f8580595e7c2, 0x1c9f6c5298d46bad, 0x6c072043decf9c06, 0x233122e7bd60392e, 0x882bf3ab1ab5acff, 0x69844b7817d82b7d
+, 0x24ac4d2a12230835, 0x3f81d4674ce1a184, 0x6f2a2bf77681a660, 0x70afe4a045f1b9b8, 0x21d9325836d516a3, 0x18aee5ed8fcedd43, 0xfeece442494af904, 0x0e4ea43c67b11545, 0xc1792050f7b97f93, 0x4c1f11f4f464016f, 0x8af7def837d9f191, 0x6af8795bbd348aa8
+, 0x352065bb75609084, 0x1ddd371634211f61, 0xc003ee01fa779297, 0x334cec04614cac2e, 0x947070f3319f360f, 0x0fafedf92b557d12, 0xe78a5e4ab584712d, 0x4eab0c8a55d63c3d, 0x788a1e566b38f374, 0x70506f19364c6881, 0x38bc8bbce30dcd7f, 0x6e384c43113f899e
+, 0x36bcf453ce7531d8, 0x1be41e8975ea2b70, 0xc089e7649b27c9be, 0x3478db760637e62c, 0x19ddba915fd11a69, 0x7fe39d9b200c6728, 0xb8e43f817d939520, 0x6c2b96d8659b07bc, 0x03aa82be64f9421b, 0x1d316358f2869ddf, 0xf0188ccc91f14b88, 0x5ca9abf6a57cd291
+, 0x796eb4aa7af38033, 0x2a4677f91e39cad0, 0xa4eac4fc9c739408, 0x4c2a2daa4377c84b, 0xd02e013cb5167b11, 0x1b973f5f8fc5d688, 0xb60ff0007ce6802d, 0x748d2c7ed5efd387, 0xd555f89d54f301eb, 0x08f5e913f40250d0, 0xccd57f25dccc6599, 0x34e2144f706a3973
+, 0x90d6b92ce2e9a84e, 0x4801a183e2aadc28, 0xdc5f447e05d2bcfc, 0x518033cbca42ba97, 0xde58a3a22bfeb0eb, 0x294b5617060923cd, 0x871746095cbaa2df, 0x3c6292e64a4a1422, 0x09ba6212db4b4370, 0x53d50b332b50d0e3, 0xdee754ff028e0a08, 0x1d556de89ec4dcf8
+, 0x1be2468a952bbc2f, 0x4eab225b0ff67892, 0x032a4d333063dc56, 0x07b8b935674421a0, 0x335ca71cd4acfd31, 0x261ba669a57f59d0, 0x26ef3ed59165a252, 0x77965cc52deb8d2a, 0x6e3cd2fa1bbbf941, 0x023f2c4e2a5341f6, 0x09283673fa1f2d36, 0x62554d16e41dd81b
+, 0xf002047ce65a5f86, 0x699cd79a52f89dcb, 0xd2e62ba6a8756122, 0x2fd5c2e27752ccc9, 0xcca05185d13e1ca1, 0x4f9f51affb47f464, 0x8e11a0a3cce865c6, 0x5661e205e866836e, 0x5e8663d750cc1b85, 0x005788f4322bc2e6, 0xb175bb3a179a6e07, 0x02561730d7c700ac
+, 0x674219528d4527e1, 0x36f4c25c9dcc0571, 0x749e480d72e42f18, 0x01d2d25ba9626243, 0xcca8c9a36ca6f4d7, 0x2ea19c820f5cc15c, 0x7875d14767f718a4, 0x6f584ee648912e44, 0x224a564c1a801fe2, 0x546f59c627d36743, 0xa26e0195eddf6dee, 0x6b00ad765aa4a8f7
+, 0x135c02cfe2779987, 0x56ceea90f989f5c6, 0xbb70a289e9417cb0, 0x6da2d34dc00cb222, 0xac0e84858c3a922c, 0x3f96f620c3187827, 0x69640bf0f48e563b, 0x16444f4666238a60, 0x24f0476589085563, 0x3d4c7c3e36f28b71, 0xd83efe73e6ff801c, 0x078b52d204d7ee5b
+, 0xdc06682f92557e95, 0x4d749ad35f7ba1a3, 0x60093b5340a999a0, 0x551b6fd9c90e615d, 0x2888d442d002f4b6, 0x48182e2fa9e40fb8, 0x2e45322ae72fb074, 0x15de49ea4c7b5df1, 0xbecc2d227bd2e60d, 0x305ba3fa3faab82c, 0x28a688280216bbfb, 0x7de98331469b4ef6
+, 0x7649ee0fc5b15a42, 0x3c5e0f1820aace52, 0x9273e9c987feed3f, 0x559c539c5eb9f945, 0x9e12cfaee523642d, 0x2c300e5a96b4877f, 0x788614aa23a18836, 0x39099b82aede5cb8, 0x2e96a68682297642, 0x007f30373b4fe004, 0x44209cc7c96dde15, 0x43ea2a3fec71316d
+, 0x38d0aed4cee8f2ec, 0x5a2aa26dca3905e0, 0xd7243f732d499199, 0x00fe93b7bab138ce, 0xf2ad197041a23308, 0x20bace9ae33c8d46, 0x41026258e634dfb4, 0x1aee0947cd777ab2, 0x1dc9b74302f549b8, 0x0d5c75fc3307c599, 0x01209a5dc12e295c, 0x39c8a7f4de5ffe9c
+, 0x315d3b1a7679fd9e, 0x085f2cd85664ead3, 0x8b80001b71642a73, 0x6f99c8e263bf45dd, 0x39989876ae0d3b09, 0x4cc7ec7280bd400c, 0x5a53de85101852f3, 0x788e7399e5c5e879, 0x55dc8bc992d17fbb, 0x18fff19f31d251f3, 0x3a7bd40474c757ca, 0x4682ada4197fd5a3
+, 0xc613584ef067c9cf, 0x573d43cf09071d88, 0xdc15c3ebced47450, 0x2162f466cc375ddb, 0x2fc83d46cf506c66, 0x776db59a93f8ea07, 0x6e241d3d01a00e1d, 0x4dad2069c14c644f, 0x412d254c666310bc, 0x57f20d6726b757c4, 0x03c598cef09b1bad, 0x2a8e0231d4952384
+, 0xb20fc49584b95c4a, 0x6b5b199f16c3d256, 0x0989bf65ac3876dc, 0x6f7c82645e7fc91a, 0x83df762a3cee9ab8, 0x10718ccc19920b34, 0x8954e2dac635bff9, 0x550a547b5cd5cd67, 0x2f8db09d4bbb7fb1, 0x5e9275115da35ad0, 0x7deb55746181ba31, 0x0f78df93b7fb70c1
+, 0xa9e2ba16fc34763e, 0x5f7eeecfed08d75e, 0x3d94f13bf85a4908, 0x23d9614d89c7cdc7, 0x13d5715cb4efc6ab, 0x1fff3f1701f6c41d, 0x456fd4004b062be5, 0x17cbff8668d35143, 0x42f4007bbfe7ae1d, 0x6fe560092ef695a9, 0xfd98dab56eae18ee, 0x60a317842a213bf4
+, 0x18dff82b75d12c9e, 0x331fa557f255fd95, 0x32d5c6d370679026, 0x6632867200a6fa0b, 0x7268d11282cb60be, 0x4764e3fc49546dad, 0xc6433e43415bf4d6, 0x1b76a24e024696e3, 0x815f5761ed268700, 0x58819af765168a14, 0xa9f9f6f3f0fdd4ca, 0x6b0914b18e0f554c
+, 0x7034e262f7732768, 0x64428a87379e408a, 0xaa78e31304f4bf58, 0x79f9064fa26454a8, 0xe945a95ce8fd31fd, 0x13289971d6230f54, 0xf69e5397eafcb5e0, 0x56b78b702f128305, 0xbc3b6e12fd5d6d1f, 0x08561cc7e1142c9d, 0xfaa0bf3ccc407866, 0x66ec062d49ba6671
+, 0xe3e96ddace3191e6, 0x564e1f8a97d3db27, 0x9a91954e6f2e7f55, 0x1181541b73c186de, 0xa06b0ad8265b3f80, 0x1345d0c4ec26b1ce, 0xb374a74c5c6439af, 0x5bf97afa3c54e92a, 0x4eb9b5887a01fab6, 0x3d0af9de812bc010, 0xe2726379ada57521, 0x21a04c719d0524ee
+, 0xb57a4675020f47e0, 0x1a87138b2343c833, 0x0467245a2d4fd87f, 0x0115e3947d8c8415, 0x8f83c9ce60b2f04e, 0x723b23a9c8705091, 0x25c96bf95dfdc2c1, 0x704738dfd8d8a203, 0x5019894d8429cddc, 0x6578b762325917e1, 0x1e698c5d28ca0d1b, 0x77f458434de856ea
+, 0x9d7fe72869ad1805, 0x3dd77c158f151d6b, 0x390b149852bdba2a, 0x2c3c46364af03570, 0x01f462749b268be7, 0x04e1b1e649933480, 0xa4f9dd644134bb36, 0x6df82dd0770c7b84, 0x689a5e5253c891d9, 0x074527d4f0acda71, 0x451af1dc3e1a0cac, 0x303bef80c76f593b
+, 0x87e831354fd9f455, 0x707e090ec495ec33, 0x25043ee61ff28d2b, 0x3c0a361baae0bb6d, 0x6d018b54809dcff7, 0x026ecab306b12478, 0xb99425fa9d19d3d5, 0x68ea3407a7f34e81, 0x8b48db6b16533eb0, 0x2c5611dba4d60258, 0x908eddfddbb96c58, 0x1245ba49b60c669f
+, 0x44c6848770005782, 0x057b662be11a96f6, 0xa251de3ece46341a, 0x3c6c935137b89cdd, 0xe0a0dea3a657a309, 0x05365e196c88d010, 0xac0a2bf444c13aa1, 0x7b699329e7bce87f, 0xf08e30afc5e39f1f, 0x6e657b4a49de7894, 0xfb4a4eb95cb435be, 0x414dac69f92a8db0
+, 0x27c4e4421de8a753, 0x37b648e9378c093b, 0xfc1a9eb075f5f603, 0x0e7bab1b4c38467d, 0x005389af8b56dfcb, 0x2cbbfee156042384, 0x1c9968a34b3f4dcb, 0x7b73a14533f4dce0, 0x293d0ff296dba6d4, 0x62c8e2383a48a3af, 0xe5272ad6308627f5, 0x29e65ae09b46a676
+, 0x55187fa5db2ab470, 0x3178573166640be2, 0x960463cc682bd8ae, 0x6bd8656b4deb08f6, 0x4c4712d1bf656c8f, 0x16634ef5d98586af, 0xe9cc25315ca832dd, 0x6af6a24a9492b007, 0x771371cda84b7b12, 0x6cc2dd7235f53559, 0x3d71413488e4963e, 0x44d00c1a35fdfbe1
+, 0x2d90f2e186753a05, 0x7981518fd990e336, 0xd34f39ef3247dff3, 0x5b6eaa9698f10fb6, 0x5d2f7569b76fdf3e, 0x6c6ee9319663adaa, 0xfba2f46553747676, 0x151e84362ae9c8dd, 0x49fafc5f146704ec, 0x27746581f3a12b5c, 0x9e17587404548dfd, 0x3d6a6281d1e758cf
+, 0x7b108e512a17cb1d, 0x3ea5d0ffa515aea0, 0x0b290e07ca557d7f, 0x091c38f732290ef9, 0x178d1bfb77835d8a, 0x58e405d25c490c83, 0x789de83318299afa, 0x11bdeb8863d42c4c, 0x727b6c04ce14800f, 0x20666c052b0bb6b2, 0x998317c865424792, 0x70045fa6ef899b84
+, 0x4a32a7b193d2c5a5, 0x3acb8da1f6fd9193, 0x49f9839450c073d4, 0x477d280bf8e96f27, 0x5f9bf88c4a747f42, 0x257c808527430379, 0xb7c8fb3c5ccd0ad8, 0x246a85a4f2a4d064, 0xb580aa492ab72dc2, 0x2649c74f118cba60, 0x34206de695004c23, 0x21aa24cf80e735b8
+, 0x63efff9633c5c34a, 0x73536c0bc0ac1218, 0xd4bc955552a8cbbe, 0x17957fbc1f259859, 0x94abd6a3850929d9, 0x553028ab6431e7f4, 0xc9bf1e5a58605f3d, 0x614837ea2fc524c2, 0x0c2cd64d0d97f74a, 0x5357765c3b56f9db, 0x0fcab06d2fa66063, 0x7873caf646b8b1fb
+, 0x665a6f8e7b375571, 0x7759d7b5e895054a, 0x018ebd8f248c8bb4, 0x3387634a0bcfc823, 0x62efd718c652b6cc, 0x779e60bde849174b, 0x9ba28e704b790f84, 0x180fd1f1699fff43, 0xff24e685e56a2c0e, 0x57906ea675f19566, 0xb316858782c8c9ef, 0x33850acb6c058e0d
+, 0x8e25fbe1e4e0e1e4, 0x003f1fe8ecc56c22, 0x46fbfa8313556174, 0x597e33186f8ea78f, 0xc8beb52afb83f2b0, 0x132a38c8c834393e, 0xf7c857cb84a147c9, 0x6f9d93802bcfb3c3, 0xd2163d83aa0f4576, 0x192416b0efb0b433, 0xd338b6c02fdda1f8, 0x181a698e72613a47
+, 0xc3fd75dbe454624f, 0x6084120f6979bf37, 0x0c62a58fb3db902a, 0x12d1f98795afba24, 0xfb3590ea4371f0ff, 0x3ccbdcb57db16474, 0xf8f1f53a91f78120, 0x56c98ed5a4de40b4, 0x8772808b739234cc, 0x7bec3bbf49baa333, 0xee728980d1263ddf, 0x140e2b6f43f4a900
+, 0xd23e684817ce4910, 0x07c345f94c20191b, 0x82b722cbe0c25c73, 0x06720708a2fe6f2e, 0x7751c373eb328185, 0x58fcf785c7777c47, 0x162640ed97ae53cb, 0x034f74487fae953f, 0x16032d9a5e2979ee, 0x1d3af96a0c8b3002, 0x2e3603a98f3405ab, 0x43120ea408be1c9a
+, 0xb552d5ebff207b00, 0x47f8161d9d3be52d, 0x6d4eb3dcaf2f6ba3, 0x213aef5ce3f2d659, 0x2ee06e7b1bbbc400, 0x0b813b406b793a72, 0x942938066359d042, 0x61a355145ed192fc, 0xafffb66e18e0d5df, 0x561b426f431a627b, 0x8ae9d34ae8a8c9a4, 0x5984b3e4ca9b7f7e
+, 0x5583a152b72aa8af, 0x76d45bc7fa2d8ff7, 0x8689ab2bf7975dbb, 0x7d481a567b10a563, 0xbf3696f80f4081fd, 0x1f0c71b4f7a5ddb3, 0xf5aafef3fea358b7, 0x5305132b7efba6e6, 0x9ad20118146a25db, 0x51c5d263b3358b47, 0x4e3e3d523156d801, 0x1e4cd4e8b2a74477
+, 0xaca03bd3f9950765, 0x6467299fcdb8def6, 0xc601d1c00761fbe9, 0x52f36959500fbcca, 0x82d7920d8d73744d, 0x001c69e1b54378c5, 0x639aaad160cb761b, 0x311545e41acfe735, 0xd690c623ef294b0b, 0x653ed71fee4f420e, 0x12857d13939291d4, 0x7fd7cf11860e50b0
+, 0x9df51619b615aafd, 0x4f865fc4ec3c309f, 0xff26abfac76ee059, 0x2b24ef1f26897662, 0xcb96790ace748aeb, 0x6c952597b72fbc5e, 0x4df1fd4d3fb38899, 0x69a2b96c93207e31, 0xf6d62f4c086ab99e, 0x30971506cee9ddec, 0x87bf48ca2a79624b, 0x623cf8f74f58ef9d
+, 0x6e6e45e3c55ff6c5, 0x649c112e418fa220, 0x92f1c6ed37e9fb65, 0x0a6426c94479ef2d, 0xf32437616a04fa76, 0x5217d268a7d302b6, 0xd0f4a8750d11e59f, 0x5027cb64d63ef50c, 0x966fae452a230f28, 0x759a21ed9febc2a9, 0x3ee629711c0eba7f, 0x780e2c360d7dcefc
+, 0xf94a6cf3ae9c7092, 0x0a01ce91461a11a8, 0xa6326bc9a8cefe4e, 0x2002746c2a1ff072, 0x2ce7b0f850e175f0, 0x7eac810f4b168f38, 0xa8d61059e13644d2, 0x7b33fee645265ab8, 0x2ea01dd09c9f623f, 0x0bf96645f425e41b, 0x73c3f5f7485687ae, 0x71811c26dc14d3b1
+, 0x6b0778f46e3cb0b8, 0x61f2a7f01c309e9d, 0xc523804ff84b03e5, 0x5079796fccb2a30c, 0x2bf2884f01ce690f, 0x7ddc0b49c32e7c8c, 0xe208e935ad425b0f, 0x2b4f646137ca7c15, 0xe4609e15fe7021a5, 0x48d21553e8a69a6d, 0x70e63238e6f77a52, 0x4d473dc874265ecb
+, 0x861ef3d18a39e159, 0x5a2c020cde70fe50, 0x7f569c04d7489133, 0x4218ed9a3047ad73, 0xc3a05d67d935774c, 0x7105c98affffcd51, 0x5f181c36b667cee4, 0x513b3448b4c21f42, 0x7b4c7ea95be5b269, 0x6ad1e2cef9101c4a, 0xb03ba8d6cc921ca5, 0x0112f99c7e842de8
+, 0xd4e299d7038162c1, 0x6e1d4c8f5c7442c2, 0x0621984a48249931, 0x7bfb0280771686c8, 0xd0343427961473d9, 0x43c0e24e56f08550, 0xea2fdd328ca6c937, 0x64825fa70f67b49d, 0xdd92380febf391d8, 0x445671fbddeb572b, 0x22db6eae96868313, 0x7e2d6784ad455d2b
+, 0xdea80b4496026bf6, 0x0df3ef1ab96516eb, 0x91387db5a19d93c6, 0x2e6890d73b0df6aa, 0x41495a3f79f55d8a, 0x0b0e266bc5e00b9c, 0x053bf802c6132598, 0x067c3c98ceacef5d, 0x8ddf3ee4d6a74bee, 0x4924453b8af430db, 0xd17126b9806dc7af, 0x10b48d852f6f1408
+, 0xcd7a507193ee020c, 0x4cce4c487fd84bc0, 0x4225fed90bd113e1, 0x259273a275ed034e, 0x4ecf3d9593b8f7bf, 0x50029f687bef0a6f, 0x27aaab9078b3ac42, 0x31adf82b2fe5b894, 0x892fc7a2561955ff, 0x38059d0fc4ac56be, 0x895043b1cc1fc9b3, 0x0be963e4b4ba0e69
+, 0x113836a5250958c6, 0x39376232e53ae472, 0xf62c0546ebb32837, 0x5a43411e89cdcd7c, 0x9cb36a05954cc8e7, 0x479ab2031f6b7212, 0xcf30bbea3bf45eae, 0x2430052062431807, 0x5a7dd3e586f0916c, 0x74d0c0af95273ddb, 0x0d82aefc60db5ec8, 0x72a4b2e1bb6744bf
+, 0x9653cc77082e8649, 0x286a75922021e108, 0xd1c13a5443608c2d, 0x5f931c17c11edb8f, 0xa14ae73b010c19ed, 0x16566d854eb28a8c, 0xc26742ec16e7f1dd, 0x073f7f0afeede323, 0x48af0cfcd48d56fa, 0x53555fda1fc20aad, 0xd6b2945c4a4b2d3c, 0x779ee6bd6555c8cd
+, 0x77a18a5ef0f16123, 0x3743b73100ff5948, 0xe96f91e2da7f72b2, 0x3fe6bcfdf7760f65, 0xd187f44382864cbf, 0x33827db5267564a3, 0x003bcdc7e9f47dee, 0x0353f677ec470de9, 0xb27ac488e87ee89e, 0x4d278d3280c83451, 0xadb08e3f988c0453, 0x053e80bc7062556b
+, 0x48ea7c85e9dd51cb, 0x5427267399afb0bf, 0xc515139734d44201, 0x3e168360a22dd540, 0x37daf60e65f85231, 0x6668f73c00b0ce92, 0x8405383b69f52364, 0x0f3afe3c99e6b6fe, 0x9a02691f671c03dd, 0x28efe9f1c42d72e3, 0xf41e18924bb0b77b, 0x45251790a4ee7995
+, 0x0202591e6704d6ee, 0x56428dfbc96c4a7c, 0x65c7f34fb4885b08, 0x69c0c67f700c4662, 0xd355b3a3141af9ac, 0x7fbe1e1893a1e3a6, 0xe4ea1b6f9882af16, 0x60d6f60816272655, 0x7eb3ad8adc6c023a, 0x7d396d35bc9b3de4, 0xe54e318d28dbb02e, 0x4c58861c7f30fd1e
+, 0x2a953a92bb1f0612, 0x5724fed14b6ca928, 0xe69beaf8a737becd, 0x0f38cd31fcc2f7c9, 0x351ccc987487c8ec, 0x4a9fd8974e467b80, 0x6e5b12f7cb6d53f9, 0x06ca4a59d8d99550, 0xb8fca827f64d9c33, 0x2ba241a40b543bca, 0x0508844f8753dfd2, 0x3735c68d21221a0c
+, 0xadc5eb4a7a270c96, 0x492fac9c201a97ac, 0x1fa214dc72942ce0, 0x5332f5730d1ec337, 0x02eea5f71e0de881, 0x0325465fe71e7805, 0x78a4dd1add0f914e, 0x5bab7f7b7a6fe23d, 0x62440ef41000202e, 0x2672d50db139aaa9, 0x395c4c92d921bc08, 0x2f1141e682903e0c
+, 0x2fd50e41410b6137, 0x164f21a84e9f94a1, 0x8d1831dd02ce5227, 0x4d2074ec1f7465ca, 0xd52491411b271135, 0x396c56eb8338c49b, 0x0e671b089a817975, 0x1922fc010e2678ef, 0xe97d735d0a3eaa19, 0x2f8c822e4bb84d66, 0x9ffbc02e90929e1d, 0x2c2527f996e4b9a2
+, 0xee4a2be54ab2d534, 0x14d7fd642f8b94bb, 0xb1000c6ab20e8a7c, 0x5c8ac7db800203ce, 0x758d8bad8494a6fc, 0x46afbf54c48f9810, 0x58f066c4af2c392c, 0x7f0fcb6eb5f5fb13, 0xb4ce87780e30e1b7, 0x083a54eb8c16b225, 0xf6d443e2698d5337, 0x25ae33a4f6ea9a7d
+, 0x8314b8534c9f4e36, 0x287592474a3d60a5, 0x0f71c242dc0d19bc, 0x6a04115a2e10de37, 0x56353ce475a90981, 0x039cc97b172ec287, 0xc795e7d2898b8a7d, 0x44d77488205c77ca, 0x7ecb016b3832d68d, 0x74f2723b5224a932, 0x4e47ea435ce229cf, 0x2b9eaf8ec5b45349
+, 0xa071238d2face68b, 0x7734d399cf65e6ec, 0x148f6a4408f5ad32, 0x14e9d6bd79a90fa1, 0x06706873083a6656, 0x3db95e3407abd595, 0xccb5144c1bfe7b78, 0x5d177a1cfa9d480c, 0x68db222a35191cab, 0x3752120b2dd75aac, 0x059a9d00762a50aa, 0x7fb676d2a8633f96
+, 0x1f040ad580bcf991, 0x658671a4bafaf966, 0x217caef8e2dd5350, 0x4c2c1585ce921b61, 0x11d014c35e3252f2, 0x2d6c6b7fd639e776, 0x29c77c951e8c0900, 0x545ed35a9a74d000, 0x3c5dcbac8734f730, 0x6851c4dcdb0e926a, 0xf4df99cb18bfc59b, 0x6715c3e59402d8f8
+, 0x874e7dfca83242c1, 0x7755cfb872336c41, 0xa92632675640f2c2, 0x07f1da408500ee6c, 0x93f8c2b282830565, 0x21d17e731bf07e1c, 0xff54f4247847e61a, 0x7a8685f82a6827b4, 0x7b5c3caa341e9ab6, 0x4114f0a86510bec6, 0x38a7f58a59b079d5, 0x0d26959c62327bd9
+, 0x153011bb4c5e8b04, 0x5cd01b447f4c455f, 0xb927f110b024b819, 0x24b166ba57bd2c03, 0xdd1b9165050572a0, 0x5ddb63b98f8ef647, 0xd288deac8eadfa77, 0x53085b7626559c92, 0xe63d26c38721d688, 0x5714a56854e18d61, 0xc5099a9263813b4c, 0x2ddd091ddbce922c
+, 0x9bdfccca1ac0a4ef, 0x38defc65851f06ef, 0x76fb730f46f684ea, 0x05e403aa94a2e5d8, 0x7fe9f39d442ac33e, 0x46473f38bde5f2ed, 0x06befb219951723c, 0x2f5aeb3f74ffa16c, 0x654a84e0b10ca479, 0x0c4375460d038e2e, 0x01b4b847fcd5abff, 0x1ad850f6c692046b
+, 0x1c1b856f8b3a4852, 0x4a9ca4694a75eb66, 0x83d969031f8c0da1, 0x118a8296b2e1d486, 0x7afc8aacc67ca699, 0x171974afeb8223d5, 0x89932593e138e68d, 0x2f8d95f979cd26a1, 0xa5648cd6701721fe, 0x167d9d3c25142805, 0xedc2d40c54c5a699, 0x4712361c8cc4de5f
+, 0xaf6ebdc065dfef41, 0x382d7f47106ba827, 0x9a0d5dd9508ef51c, 0x1373423d4a4773e2, 0xaf042213cf23255b, 0x5be0bf8d45a9d48c, 0xf586335716b163c0, 0x34ca04b4efec3e71, 0x23a1eb6a71aca939, 0x270d19ae01a91044, 0xc6915eaba845e6c2, 0x1bfe839ca67f0cd7
+, 0x1ead989cd63f0712, 0x50b1424c187a08a6, 0x6791b2cf0119a3c4, 0x6bafb04ae4214b94, 0xd0aa1078ac7f8eff, 0x7817eacb078d45cd, 0x8f1d8f3eb0f3bfc1, 0x35979ca3ff21377a, 0x8679c8193b15f6d8, 0x0498373047e8c079, 0x8bfe7c32e72f1b51, 0x6e6909d95bb67352
+, 0x81215bdabcada8f0, 0x151f54417bd2fe84, 0xb8b2789d6a004cde, 0x57e78834d04e6fcc, 0xfb4a3d79184864f1, 0x19082f105d654644, 0xb0fef5b91f276c01, 0x3c79dda75b4a584b, 0x9075e2974764068d, 0x48f66fd0db34f31d, 0xb6ba37cb686477b5, 0x59380b184189850c
+, 0xb4fc383249f41e04, 0x2a77e9697e45a1a3, 0xe3fc9650ee4853bc, 0x5d76682ceb910a34, 0xf1999cf24e0d4b68, 0x632a8b675823133a, 0xc27db16170bb1d00, 0x00c8981c88d30a2d, 0xb314012e73ccf05a, 0x1ec5e27375877f51, 0x66bc9ed211cde6c0, 0x5168153d43f6932a
+, 0xb58dd1caeb266e48, 0x014647cf4f008a62, 0x368710d9e5d0c6e4, 0x6037b5e4508da5b9, 0x98240ae18ae2834c, 0x5a82d9c141df906e, 0x081c95b2c83b2f9d, 0x3f3b046e984afbe1, 0xe1283191d4d45665, 0x586f451e2ea41a24, 0x8ff311dbdf1532ed, 0x3471cb1c47a60f60
+, 0xb226bd4811536626, 0x1dcc9be44cea79ec, 0x54e7c56c37de53c9, 0x136d6fd6d79a02a1, 0x6e6e5c64146c63e6, 0x4ea6a461cbf11ac5, 0x52befa0f25998e85, 0x48305392ded13337, 0x88eac5fd211e2bde, 0x76e9c94a4e6541d2, 0x3838e849682420d0, 0x211213bc69197225
+, 0x8a0d48978c138401, 0x22667d99b56faffc, 0xaaa5ff3f379187d2, 0x2e7c91f439b04f9e, 0x3ca7275905ffb3f3, 0x69754f31c6485738, 0x12b5cf442911b057, 0x1a26959f0b5b6308, 0xb8e2030d09fbed77, 0x194c848308b91dbb, 0x5112d9e897e34658, 0x2d5b254d2ffa4efa
+, 0x755912fe090f8d23, 0x1c2b424759f0e096, 0x912b36a5279740fd, 0x13e5a7a6e1d166d1, 0x5c15ab328aa198dd, 0x0e9e78cd0b3c3dbb, 0x9f1eddee62b57715, 0x21830ac1af38ff25, 0x113d5598384676e2, 0x01c6184b4e745cd9, 0x89eba10236936ca7, 0x75c5082296721250
+, 0xeae64fdd79df7e26, 0x30f2378bb35fb2d8, 0x2edf1a03df24e494, 0x408697ee28a31378, 0x5e9dfb9427d46977, 0x4ab549ed468f5b73, 0x19f7238cfe5d8a18, 0x394a5f58826ade70, 0xfd08e11b374f5c69, 0x56b965602d6d7f17, 0x426c45fa68636f72, 0x7783a6f20e2fc49d
+, 0x6f4d5c945b791c0b, 0x6ce367e446639aa7, 0x99c893ceb64b4ef3, 0x34a76c6e0f31be1e, 0xeb8970bc76b10e92, 0x6bceebb86f3d04eb, 0xdfc16fdd77f73c76, 0x7e3d7d25c541144f, 0xc9d38ba31eed38c8, 0x0caccc9f301c5ece, 0x41e4b0891e5dea40, 0x56d9bf4e2f624d57
+, 0x3d2e66c8153b5815, 0x2eb84c7ebc300ac2, 0xabbab1e2b7cfaeb9, 0x1f9f046a47a56961, 0xa2b5ea31680dbc8c, 0x198c66e302a84821, 0x939951351d2d1546, 0x2bdd11757dc6603a, 0x7ed590cc651c1f4b, 0x1e5d5a87e9d2cb08, 0x366af5d99e975711, 0x487d5cf3ba175f2d
+, 0x31d0badaee1cf188, 0x0b097e2b54ead829, 0x3111031d5924e549, 0x7c7a3e769bd6198d, 0x6a783c1b3d480686, 0x1eba28e9ccc07f8f, 0x71610771aa6bf814, 0x7f21a07d783a94ca, 0x02d68734d63d33f1, 0x52bd35e464a9edf5, 0xf2aed3224521eb83, 0x021583737c8d012c
+, 0x9604722d891d5c28, 0x464faf64c7330247, 0x328e7c5e3ac0fde7, 0x4d7825102c03d5ea, 0x0f8f147ddbdf1bee, 0x6c0f4b8e17444b55, 0x3a76cd5ddc66caff, 0x182eac548cf721f6, 0x55595b51a5f678ff, 0x5bdd455ff099c142, 0x1e55a451be7baacc, 0x57691f3cc6f77c24
+, 0x3f3425abbff53f5d, 0x4265cf932ea603fc, 0xeb5a751ed7fa98af, 0x7f222e13168fbf72, 0x0328a4465dc24ebf, 0x3257ec819f536b2a, 0x9c1ef8c3da66de20, 0x54de35f5cd65810b, 0x4b14807bc8e39493, 0x7d4d62d77978e6b2, 0x6fe703a89bdbf5e4, 0x47c39663c9f3fc69
+, 0x863cb50df4d4737a, 0x170bbbc37654d03f, 0xde68b81d068003c0, 0x3ce3cce21c34ef75, 0x7fa978bc1e37b761, 0x2b3fdd7d7f732b4f, 0xce54ec6cd730e7c4, 0x36b99b4b0ff33a71, 0xe1ef30ca94b29c63, 0x33caf40cb25ef8da, 0x835f836ad0cff071, 0x35569f44587274e5
+, 0x01d5bc250e4a490f, 0x4064dcf273de937c, 0x76f8750a8f63e09d, 0x10109d5b8aee8570, 0x970cf685b83cd83b, 0x2f29d9b870174515, 0x2aeacfe299df1ae1, 0x3949ab2fca13af23, 0x2a5c939861b68d36, 0x5ae5d3a120a1016d, 0x96ac1c1896e8cf8d, 0x61fd118dc0221509
+, 0x246465df8fa044a3, 0x1b00ea57be2ebf01, 0x4fe55db19f3426b8, 0x00f955ee38a7130c, 0x54afc78d4652d5a4, 0x59219d062172544e, 0xca662bcb705fe108, 0x7713e11f1b12e443, 0xb4bb758773700613, 0x73274c6d8f07922a, 0x8327661160809903, 0x17b33ae92b05ceee
+, 0x36065d80cff3ce77, 0x7f3be1364386a7f0, 0xbcad4ccfb75a9f0f, 0x1078e26a7635237f, 0x98ddfaeac68f2515, 0x67aac8d4cf51363d, 0xf95132386ecc7409, 0x6dd5d3848a5b219f, 0x0281ef3128df6e7a, 0x57a0e738c29c1897, 0x8bb0cfe9ed0f0a54, 0x40a4c7b2cc30ce79
+, 0x1ef14d15eca82cb1, 0x305d16e11872dedf, 0x2577ce0d8f3b6aa5, 0x666e7d89d0577477, 0x9e75e2c34a8b0ab8, 0x64e3c62bcfe2c74d, 0xb5e21ee75fdf8e28, 0x5290d3bcc59dd5a0, 0x9d41cac93cdfb5c9, 0x77b3d6aa980a74ec, 0xd6465e74a68f934f, 0x0479d0386c60f638
+, 0xca1a71bb69c58190, 0x59849d09785ea5bf, 0x37e656f4eb57c662, 0x27b1636c5f042c10, 0xdc3cf206bf060ef9, 0x349f858fa5d01dd7, 0xf4cec3ca18bc3410, 0x14ac2da6baf6a0dd, 0x37bd14b9dec7ac03, 0x38517b6309feab3c, 0x42cb6884c06972b3, 0x649548806abc0652
+, 0xe574d2ad08256eab, 0x12feff0ea999ad3d, 0x874736aec691281c, 0x7c49124acb649a9d, 0xc2a2cf3d63946d8b, 0x6f5af86ec654011c, 0x36b7ffeff7b713a4, 0x7633fb93dc81fea8, 0x81c20099823079dd, 0x014d0fdf2afc8437, 0x28446edfb10347be, 0x0d38d59f227ed79c
+, 0xe104d1234e43a04a, 0x75a2e197c3fb4c2d, 0x68c8e38fbdb7cadc, 0x1ef7002addee4c12, 0x37c13cb5f681517f, 0x3d4c184975d353ca, 0x39b5d1bac29cfd10, 0x6678f3093176781f, 0x82ee0ce12c9e7205, 0x20373a2833ee32aa, 0x5452717b3d6cfd83, 0x69e4065873daf47b
+, 0x39e3e58950ce93c5, 0x2bcb2b839e3fb8a8, 0x76d3dfaf6e119fb3, 0x0d9455f04dc14c15, 0x2dfa29b57830e258, 0x5800e6b9de2c7d7a, 0x06364d770950804e, 0x19646f0ba57508c2, 0x0e2d472ea1b40a35, 0x1837ddea612733da, 0x58f2491e89894576, 0x38fe037b7cb26aee
+, 0xf6fc051650ef432c, 0x1f1599f56702df15, 0xabd47aa1a25c7623, 0x78ff79d27048f9d7, 0x2e016d1d02e3b87c, 0x7709728f104269e2, 0xa796cd2e2c04bf9f, 0x26a9cfe9c89e6463, 0x21ab92bfc9e824cf, 0x0b839ed467d24227, 0x7b3184f5ccfb3561, 0x751444e7b9726c2f
+, 0x289019681763b838, 0x6437ef6aadc8609c, 0xb4aab9db361d35d7, 0x0d1ae144c91ce3d1, 0x9a8b28a8af915fc0, 0x6863a2f2c6c84b76, 0x3f93d1ba28aac120, 0x6a16ca82b16f08b3, 0x195b0edb463469ff, 0x16ce772e8c7cebb1, 0x6061f2e2b9dbb618, 0x7c005610da077d44
+, 0xb4bbc1e694e88f1c, 0x57751ec2ac2cdce3, 0x2cedcf15576f91cf, 0x2f33ee82694c4aa9, 0x65bf3fbd4f1307ab, 0x5ce66f740b18095b, 0xf8214c4becb26ccc, 0x44ae04784d7cf68f, 0x55a5c542063d25c1, 0x4246e2ae0f9d4a86, 0xa6e92121ef5bed36, 0x36b7222adee8562c
+, 0xfd1f3de584de01b0, 0x4873a18417720ca3, 0xcded54070284bc86, 0x251ced739fbe8cf1, 0x0829a3b3f784eba2, 0x4a3336517c404e3d, 0xf1442a574765ecf6, 0x07c3c43ed538a07b, 0x81191eb93b2a93a3, 0x3b98d841f6c4d61e, 0x6f0d38c0d5771db6, 0x036faa4848c9cf9e
+, 0x7a1e66b856aeb79c, 0x2a20704b41ac9c67, 0x23b6820395ee012c, 0x3fd376917253aff9, 0xbf111069b1ecbc29, 0x7cba928846b01f8a, 0x3ac63a6fd5e07400, 0x702c9e5184ce75b0, 0x5626fb9167478eba, 0x5e434941351656b5, 0xcd1afbb89c92284a, 0x13ebcb9f328ec3d7
+, 0xcd495d0e8e5281c5, 0x035275e5251c1c08, 0xa5c6166c2c69312d, 0x1452db584e6d3507, 0x1969bca4652c2153, 0x2cd4e849429b0474, 0x6bdf95290bf4ab72, 0x5ff01bc9a79a1ea7, 0x6301a38f37956d36, 0x7543a95f21390bda, 0x81095047d55d16d6, 0x30b405b76748fbbf
+, 0x4945463fec0d5c69, 0x42631b201a8da705, 0x68b0195eed98839c, 0x01086b32c60076be, 0x190780f0506543e5, 0x1e947d24f254ed31, 0x3e0700052226b03d, 0x55fd8c50b1ae962d, 0xce2bb425ed7ab545, 0x36e3b9fc59f73022, 0xba455c442661692d, 0x1700e89837204255
+, 0x28abaa6f5687471e, 0x4f2fdd3bca00f332, 0x9996cd3634b91117, 0x7e23d790bf27fb38, 0xc3f515a5750d0381, 0x0ef8b9babcc6e17f, 0xcf94871a4afa854b, 0x55d7880c496e6e6a, 0xf7ce736379bb8787, 0x7c00e53c5e55547f, 0xcb2e63efdc59ba52, 0x354c1a8b36844a5f
+, 0x6bad26c732d5c1e5, 0x493de62b989a2dd9, 0x5ce80427dca69a58, 0x145277c48c439da2, 0xe8c9cf81fb84f254, 0x11a181e0674385cb, 0xda42860e457a56eb, 0x1131674d97d03e4a, 0x831df101cec7114d, 0x7d0c914d9157287e, 0xddc66537d08343f2, 0x596cdd890621aeae
+, 0x8531016854573b1d, 0x4ae65b7c826c7b73, 0x68ca4cdbd7b1230a, 0x7e979b1f079a35ea, 0x1dc2fad2ef79474e, 0x7ed41091d7443ed6, 0x9640c9db4535b8be, 0x216d50fedc5157ab, 0xc413919a75600c0d, 0x1ecd6eaca28a154c, 0x6ff6d143d05aa147, 0x14c9052a3fe8d5ab
+, 0xbfceb08f0423f8af, 0x1aee6cda6eab7c92, 0x88c3dd1d1fd860d4, 0x74dd6a229297377c, 0x194a20ddd3a5442d, 0x369e5f6b28e3920d, 0x60977ba567b0af73, 0x6faba8e701d66383, 0x5af0e644d32a6a6f, 0x2beb9bd6fe3843d5, 0xc6d62fd6e4d1c84d, 0x731ceebce92a35ae
+, 0x10b214410f1f4552, 0x0f96136bc17bd000, 0x70896e03dc4f57c3, 0x54662f413d98948e, 0xa613bb28cce8b15d, 0x152c6c09920c59ec, 0x1f553dd747e3dc46, 0x76b3d82a1a151291, 0xac882edd278d529a, 0x63b6a274f29709ea, 0x31ccafcb7bf63e6c, 0x07386664d2504fac
+, 0xc49618cead53fa24, 0x0ab0c36d9f201536, 0x7d762c9f350b1a5c, 0x640393b0719ab0ab, 0xeeb2dd0a58df2107, 0x37f30f495f519626, 0x803cebd07de40bf7, 0x1e075683231c5652, 0xc7a3cffd67d6b919, 0x3bc98113c7f69a8a, 0xfe1b149587032538, 0x0b2dfe51d0d547f8
+, 0x9e117157100076d9, 0x058aa7d49905d1ed, 0xed5e0e776559f24f, 0x62aff2d452f4ecd8, 0x790990ad80108d82, 0x2eecaed9501d3fa9, 0x7c7b29b043e6fe13, 0x62bb0975b5fbc543, 0x2542558289f72631, 0x4e95efe553a17802, 0xf32ccb02df6649b3, 0x59d0946a958afa2b
+, 0x4e7cdf3754125baf, 0x47c47180b325d22c, 0x3dcdfb27d380bc1c, 0x227228a78f68ed4a, 0xac1e4c5ec57d6882, 0x2dcd6fdd98c477ff, 0x0e3ce59e7b2e11fb, 0x27349ba0c3da217c, 0x30ceae7ed68471f9, 0x510de5a1c49499b3, 0x5aa9618ba3c301ee, 0x3d582a1ca621e24b
+, 0x431a5602d4f990a0, 0x7d8d4ebcd1573bca, 0xc0b428fc122cdeb9, 0x62c83b7d40e11ce8, 0x965c6cabb0c40f1a, 0x23b58f196426a9b6, 0x5be2f88ee65b4f6b, 0x4a13c999f0b37ef5, 0x9aa400c4a3f715a3, 0x48d23a611813a2c4, 0x1d62d091780bb2f0, 0x2738507f7f671fa0
+, 0x9713451e65ea1df6, 0x6b754b0d1686a470, 0x2b45d12c7f16b619, 0x2c15143bf3aeb3ae, 0x36d7e4c8fe04e522, 0x03f8d96a4a79fa54, 0x7d8a528136ec4c47, 0x3f847d5b890ba6a8, 0xc4c1ac5a7947012f, 0x5a389f001d131071, 0x45fc264eeca8cbf2, 0x34116a316ed1542b
+, 0xb76f796a9afcfd36, 0x5fb08ba378e60f0d, 0x70fbb162136d8717, 0x750ed4454543cd17, 0xb7f91041f4b69612, 0x466548e200241580, 0xfe5d117e12713c5f, 0x03ab010cd7a4660e, 0xe627deccebb1c564, 0x4b40e3afed2bb501, 0x7e1a04782cf75721, 0x3950ce5c3f853e17
+, 0x879e284d9522fef8, 0x302f308d8a2276bd, 0xfa90c62e32e91939, 0x6e6e4fc7b9f72444, 0x4030042f6ef2229d, 0x0316a1c844459c12, 0x111b3a78135d5bea, 0x26d0ecde48837bd5, 0x00b768ab0c712758, 0x5498dab129b1f88f, 0xade971a5332ce48f, 0x07983170726c6a92
+, 0x228484428d6973c7, 0x0ad1c64870660cd1, 0xe1a00d22d4dfc9f3, 0x1bd7b3da385262be, 0x35f8dca149adf3d8, 0x6ed56b798cc52697, 0x6038b922e1cdd4ac, 0x0b0eac69b2412d95, 0xaff70254303dcc63, 0x0bebe487e915a39f, 0xce76009456b26d39, 0x549d1f5ad1a26519
+, 0x4450b70448214187, 0x0ce68b174f0ab53a, 0xca6202062e69f453, 0x38657be844000a8d, 0x5afe26df638ee44c, 0x72437afe80b0bd58, 0xa6f62b671c57657a, 0x1e65de627f6abc88, 0x170acfe07aa1ba8a, 0x37cd2b46c10f9041, 0x97b12b524a0ab2ae, 0x60f37a9f5ed4202a
+, 0xd5e25fd606ec8b0e, 0x4dc67148285788f0, 0x3c69627840a39159, 0x4163911bb2b0c288, 0xa105de6cba2750c9, 0x12d0b7b00542169d, 0xbc8b2c7b003a2873, 0x3b467b91c5f8ce87, 0xb82a28716dce9a45, 0x5fc9dbb464476f4f, 0xb1cecf49e335d6af, 0x14dd8505bbcd2ec2
+, 0xcc82994e7c4efedc, 0x1aa21c3a20033fda, 0x95a6ecb907f6bea9, 0x2607e530776b6a23, 0x58e6746f232b95e1, 0x4812cf44d6bc8c95, 0x22c995bc4ecce94c, 0x27111a5482238778, 0x22bb22c89131ab6b, 0x7f80166d0173112c, 0x0ba1d38bdc6e508b, 0x5538e80b76ff83e8
+, 0x9a6a8a1aba6e3d7d, 0x508b4815b9e9cdf7, 0x2a153c02b7e8a852, 0x68f92a88826c444e, 0x6a9cfed9aa9d2d34, 0x2763fb8a16e5d191, 0xbf95b3cbd2a31592, 0x25e6826275d51af5, 0x74891df6d3983dd3, 0x72f03d5b01ca85a9, 0x810ede4e97f31aa4, 0x5c9814eabac96720
+, 0x4e04a24fe1453c58, 0x41ee6b6a83a51a5c, 0xa0fae6ae6a36368b, 0x60b54c63897e1124, 0xa91422f172bee485, 0x37e62ad4226a3795, 0x313a395f3633812c, 0x7e33ce118a4a8853, 0x5dbc83a06ab87bb4, 0x781af6daa923993a, 0xb848c6b8e69c9688, 0x3a8568f17246182b
+, 0x794894daf899f381, 0x228f2765186a977c, 0x37a094a97ea58794, 0x4a3bbbceb72a6d55, 0xb88bd2555b134fe6, 0x4c268c016f33550c, 0xd871179f83f71d5c, 0x5b56f2dce75d1a58, 0xdbe04adaa6804e05, 0x75f7a685073267ff, 0xb984988ba1f5c9c6, 0x6c74b9569e411303
+, 0xb1130fb91a807f69, 0x5b3c7c6800d06142, 0xf5c8a033008f9948, 0x205a96822da9e12b, 0x273369bc912397fb, 0x458d03d2cc0ea8d2, 0xdc0dbee8e3cd51be, 0x5ff94e4a9147d3f0, 0x7ce34bbbbd21a5ae, 0x46f0fe101b8653b4, 0x532cc4b1128279fe, 0x7c55633b53632115
+, 0x85d2eb0bbc70f94c, 0x457d1fe782b57018, 0x02ee06ac36e84e9f, 0x0d2da33db8bd994a, 0x1565f41f692b7d1a, 0x51820be44932c2f2, 0x27e51f56e4c12fbc, 0x2cdc8dc87725b295, 0x9bd28589df48d49c, 0x725bdfe6fae45429, 0xb0c266a79a40f7ea, 0x180406ba8fd072aa
+, 0x7747bf46df96c8cb, 0x45d2747fc6f598cd, 0xeaf1d78e61212b62, 0x7772cfb958880575, 0x8051bb42efbe77f0, 0x3ff761a3bdab9e9c, 0x0157978564834680, 0x6246713de7629ffe, 0x2ca65a3a5029c699, 0x7e88cbbe4496f5a6, 0x45e2880e694efc57, 0x6ca32b529ebc03c5
+, 0xc815b221dd2243e5, 0x7af8d37207e27af2, 0xa8442c9f70668271, 0x718685873b322b07, 0x687da5dfcf8e1bd2, 0x3a70d4349cf8a592, 0x858c1b4ef6052a11, 0x037fb94cbd5796e0, 0x14176ebb604c368e, 0x2846886fe88d83e0, 0x5b9586d5d664406c, 0x36c9b57d3be1e03e
+, 0x751872ed0e156553, 0x2c0d4735f7281fed, 0x05848f0f28cf66de, 0x1e1ca3702de01c2d, 0xf653298fce988df2, 0x0d99ab39ad378712, 0x652814392c7cb56d, 0x0b31f0afce2d2fb1, 0xc04290ca70462f9c, 0x76b6f69e1bf0f677, 0xbf3b6c818ab99d7a, 0x52c73e9d8b6337c3
+, 0x52dee3e62cd97afe, 0x0c264b06b387a413, 0x5eddbb72518d15fe, 0x74e5681af2ad73d6, 0x83b25275ab735ab6, 0x61358fd8d9b8c1f2, 0xaa721fd53eb1aab9, 0x0ed344fd93558a1b, 0xc72ec13b8097c041, 0x60c1025dceedb7ce, 0xdcc706e8f45eb1fe, 0x032e9b9b544b3142
+, 0x366ae38f39fccd42, 0x6dc59e25ac97f403, 0xbe3e83a87e710382, 0x58d2850c2f5ac470, 0xd85e728c38faaae2, 0x5bf9eaa4bc8f80cc, 0x86d9381d006aedd1, 0x63c7963bfc05e5a8, 0x65788b1ce54c02cd, 0x01d6ca3dc51cf0f9, 0x0656a042fb10f1b4, 0x2ffb958331a28872
+, 0x19c5d1420c34ef75, 0x34b0f060da70b855, 0x890d742bc91e837c, 0x64ad69884410765c, 0x51578c7c0d7ca203, 0x32d04a17dc62dc70, 0xbac0824995c62ce6, 0x05abb15a94279e9e, 0x9fc71a5f93a00d03, 0x46aaa84e46056852, 0xdb8f63291b816a9e, 0x68f3e83f5ad16f5a
+, 0x6d71809b20230a0f, 0x64ec983a72308579, 0x8a8dc7698c54eedb, 0x1f7642df973b9572, 0xc1633a5a77a23465, 0x6149869405a579d7, 0x53cf854660705b6e, 0x03595f9b2cbee4ab, 0x32a702b1314c3ec6, 0x057786ecd02b2384, 0xdeb4d1e480bf201d, 0x0d54e7d9852ea170
+, 0x8e4ae33a3219c804, 0x0d61c23003dddb73, 0x7d4feeac07052e62, 0x2389733112217e90, 0xfb92aafb7cee388e, 0x705e4d704e86059a, 0xb592ab188d9fa12f, 0x057247eabb5c79ae, 0x8056e5ed393c31d6, 0x0fbc7e03222d7ca4, 0xa26f2261a5d333c6, 0x2bbf18630b02189c
+, 0x9fbdd6e5de478c42, 0x409bd9cfa48c21c1, 0x88a0a96295363725, 0x03acde4d8f813000, 0x015296ffbad694b2, 0x564be0c6d63c658c, 0x9b863ba026b58387, 0x4770fae57c48c395, 0xe4606533714401a5, 0x0ee6c888695b50b2, 0xde1157b8bbd7f9fb, 0x76b0c60cb8767729
+, 0x1afecb4bca725315, 0x729093b63fc8ff39, 0xb4d25baa573fee7f, 0x171db8afca5c2f2d, 0x8bcae222d4ada48a, 0x236addc119e1818c, 0x9b806738ced17bc1, 0x6b2f1b284666ba8d, 0x69b86ca4b1e89a7e, 0x377287d4ddc3a608, 0x3b6892b56a64ecc4, 0x4c9a433b1f2d080b
+, 0xfaf76a112d7c241a, 0x2d1e1685e8dd1422, 0x7ef33f4a082c1775, 0x22f6dd45c6e80902, 0x150ce96de3d69506, 0x226e66b13bcec862, 0x8432816d8cce0343, 0x40160e975c832309, 0xdf2838959fd414d1, 0x7e47b06f2f17f35e, 0x3a4e002d8d042ba0, 0x0474f4c4e257941d
+, 0xf39117154e3f4b76, 0x5e202afc38f19ec1, 0xba4af9b8abb34d2e, 0x2c49b5e3fab0be27, 0xf9986e05ced8954b, 0x4560cc52034ca51f, 0x7d663a53be87dbe5, 0x40b2356792f75b16, 0xca86b404e6255cc6, 0x56abfce7de71be69, 0xcec7b69a5c30b6fc, 0x2071345e1432ac94
+, 0x72f5c5ed3ce63c67, 0x32b6bd0a0b0dc706, 0xf89ea5edc74d8154, 0x1ad950253fa0fa10, 0xfc0f10aef63ca3b5, 0x1171e462f353b5a9, 0xab919abd063f669b, 0x29573f54ae77fe1f, 0x2c4a547b8eccb8b1, 0x3076bd44493899e1, 0x0ae8b36a2052ef9f, 0x15244550e2099045
+, 0xc7eaf9b0a84eb25b, 0x3d8ef5ad93de084a, 0xa23bd7d6e6b10295, 0x4eb6a0081261876d, 0x4c1d9ad98761208c, 0x2cea101f5da408f0, 0x8f6612a7ffe78536, 0x50edff7959090962, 0x123ab4191ffb7630, 0x6cf920a413d28387, 0xb6674641090bf0de, 0x65499b6bedc9609f
+, 0xa328713c76f8da25, 0x64dbaadc1ba74341, 0xed72e3966f9d15f0, 0x25ff39b641c8d0f7, 0xeaeeea0b7e32f143, 0x1970b674074893ed, 0xcca2543466d51a08, 0x2fde30a3586992be, 0x7116c63e658a7a21, 0x2969e98355e1c6e8, 0x12297c5aa7551b3f, 0x09f88559ec48610b
+, 0x3798051b11648a5c, 0x34943c6ed56b8593, 0x5c7c82d5102ad181, 0x52079ce810080975, 0x5514d9d59dc89af5, 0x71b35a71bccafbde, 0xb88af546d9a667b7, 0x54c2bcc520528373, 0xd74319e2d201b9b4, 0x71b406079b75ace5, 0xdd49244f911e6c1a, 0x70daadbf5aca4544
+, 0xc61b0be2dd0bb290, 0x099576e7e3e345e0, 0x61b5343d9776d617, 0x76c8d512509c9968, 0xd26d8f9c2e8f29bb, 0x402c01a5b3ec8b7b, 0x60cc112e2e2bce56, 0x43afcef1c82d2861, 0x7f53160bb5d7cf15, 0x39b5301c62e67a0f, 0x2ecef134c10e0476, 0x51045307c6662884
+, 0x36cec97ed84a551c, 0x6dd030699ec81526, 0x554802c4af6e5099, 0x7bf9afd5550d8e1b, 0x5516b0536b5cf662, 0x2dbe71636371595f, 0x0a9103022aa43e50, 0x2fbd532a09ac340c, 0xd259bbdf65a99a84, 0x3ae8998f02787507, 0x47459be15b4696a9, 0x6020dd06c98e1cb5
+, 0x0055c3d5ffa6b818, 0x11d2e45e45914d4f, 0x3dde1824ac33908e, 0x6f2001a85ff85751, 0xf05c91a945243886, 0x002cf93cbbbe590c, 0x393a1057a3b111a1, 0x2f3a1025d6bc7dd8, 0xe938adec04b66596, 0x76b84c8dd5991d29, 0x3b3e9fc236745cc2, 0x66a00d05948debee
+, 0xa6c1ef1698906fbc, 0x0a9a2fe391313ac8, 0x711d59ff100934d0, 0x3f0846c430e4f1eb, 0x63bc6a7ae5849196, 0x6374012a5bb85953, 0x4b2f864cb7a77539, 0x788394562e60bebe, 0xdd783885053b0080, 0x1581d6169d9beef2, 0x266bdddd1e0e2d1d, 0x2bc4ac7b7bd834f7
+, 0xe32c243e3a2e7e28, 0x3ad2645b27399f5a, 0x0fd63c8ec1d7f709, 0x061630d1c826d9b9, 0x2b0bfa837eabb8a3, 0x5f6944645b353198, 0xfc0028d95209e157, 0x014e034503f1419b, 0xacefa0919a8a9ef9, 0x0732bdc7c0b8da28, 0x234368c2057e6e87, 0x2672d6a6b0fa44f0
+, 0x406b71e49c3da420, 0x3c5d3efa666ff7cb, 0xc9604e8befc848b8, 0x18526f649a6ae2bf, 0x7af352401e667035, 0x16201626e4335a84, 0xb3c1743a4958b344, 0x2b770f233443591a, 0xb7ba3ccf18c68dad, 0x392f450c69b7bdba, 0xa1a15da6a7aee347, 0x0fca0b2601694194
+, 0xb1d13f31dbf291f9, 0x721a04c0d0d69244, 0xdce4a19612ea8c59, 0x05588c9714faa7d8, 0xa46cca4a65199eff, 0x7194cae511dc026d, 0xf4efa71e6ac95a1d, 0x1dd8c7e0d8514eaf, 0x34af506fc38e694e, 0x13edd902963b7d6f, 0xb7a29e4872ba3562, 0x4f46a1340143a2a8
+, 0xa4677441e0fd5589, 0x26c21628f4571ab6, 0xc019a8d7e7a94e1c, 0x1e2e10f87c390ac2, 0x5c0744c9643fef4f, 0x48cbfa5e887a230f, 0x6cea97314bdbfc3d, 0x2349be996c3013db, 0x0ab50ca9e15ecc3f, 0x7a7e9240edee3fe9, 0x3d5c309a594fdcfa, 0x478e53a657b3a0df
+, 0x604eb8bb9defcd51, 0x712a84af23da6676, 0x2e75b9f2dbf5df63, 0x37367a507812c459, 0xd436f19ba9f161e2, 0x089539df85a8eef8, 0x430de4f2dd41b665, 0x1a8fb0a5559625b7, 0x761810e8a02aaf64, 0x04123e4c0bab1600, 0xb9bd0b1d5747ed71, 0x483fdc4f8eb99e2e
+, 0x1e339d6eda0d6d77, 0x42a287a6bb2bbb7b, 0x53602e21ee836cf1, 0x574fcda5b9d08ed8, 0xca7bf9f597e5b4a6, 0x0be115693d352e0b, 0x88acf2cd799db6a1, 0x363dff29ffa55c95, 0xe8631affc345fc17, 0x5fee65c8e5aa2ff3, 0xb64d4e2d7c9f3b83, 0x607e3b35c89b0c78
+, 0x19df6cf87b6104d1, 0x1ca45a8fe194a735, 0x7f79c86648ef8442, 0x4b553a93cdcf13cf, 0x68d7899d99532983, 0x21f2705cf2ae2b90, 0x52b9b69c263599f4, 0x18e04da0c64d09de, 0x2a98f647b67479bf, 0x46c6ee0403e1525d, 0xb5d09eb2e10e3de6, 0x326f15ec80695fa6
+, 0x0786ee5e318f81f1, 0x06a910a3b27a0a84, 0xa5256097d0392af1, 0x1e672abc5fd5aa91, 0xeabb0089ad0029a8, 0x53961565922f1115, 0x46a6df5a3b205540, 0x6340928bac791cb0, 0x555a61d53be06782, 0x54b6b29a14ed6ca4, 0x675672895454a89c, 0x23abd4b765dd7d12
+, 0xf9b445956bbe9629, 0x072c622835b9a3bd, 0x458b665c8728c277, 0x7540b73897962e36, 0xd1c47e73445e18da, 0x1e2df06f62bcf69c, 0x5a8b254d574aa4cc, 0x59d1d11e7bfc0524, 0x0ee9d2b8a9356f81, 0x6c2016c6cae0fe40, 0x5f2982fa8d27a8d0, 0x3dc03281360d5ec9
+, 0x3045804e2e1d3ddb, 0x591df54df09d3727, 0xdf6a539d9733ac96, 0x05e0f409a16c050a, 0x9b365d3eb8350536, 0x3222a0eaacbc8d20, 0x30fad8ef2c238520, 0x0bb4dfed7b4d9ea1, 0x19dbd9130ca6c4b0, 0x4d1b7a5a4385acf0, 0x313774c7db146e28, 0x58479c940c20eff4
+, 0x328275a7c9cb4be0, 0x5e9b0d6beae21904, 0x98d5072717c06d01, 0x071a88e669aa3bbe, 0x372cde0be1b54f22, 0x57a6569f7afd0569, 0x053b24fa7133f02d, 0x337fb1cb86d3df2b, 0x97c1c606e9ab01e1, 0x771d3df2d2419b24, 0x434e8aaf1f603048, 0x04cd8fe47d827875
+, 0xebecccc33ecc10be, 0x7c9eca160edb4a12, 0x675796903b3335dc, 0x2f769496d588f52c, 0x8ea4c94b1e5a7d17, 0x503160579b0f77d8, 0x0b1172d1ee90fcd8, 0x558d5b1595abd6b6, 0x39e5c519845a8b2c, 0x57254589f88aaa85, 0x0e66260a49fd8519, 0x38f0a148aaf79455
+, 0x986698cdb4b327bf, 0x7697fcc5fb4b5071, 0x48cfb5d8718116eb, 0x6c21aa0b39aa304a, 0x20b99817d09bd9aa, 0x17853f67b03f44bc, 0xa99fb491032333e6, 0x2c1745e3ab872d45, 0xa75d87dcdaa8444e, 0x2764e7c12e38959a, 0x3bcec6c508b1dc4e, 0x458d173f5378ecd2
+, 0x771d5a0d801c0d76, 0x0b89dabcf48fdcea, 0xed0c9eb3d2fa58d9, 0x05a9f269f220a69a, 0xac8166a44f75d700, 0x46cff6ccfc751fb5, 0x4d7a53b97bc1f199, 0x5ff7463d34b04de7, 0xeaed3165a98f42a8, 0x58450807b86da16d, 0xb83358d66085d2d9, 0x31fb800cafda8138
+, 0xde416c6eabcc6ff3, 0x0df1bc1f6631baec, 0x888227be6e0535e4, 0x5150e8f56c94a6f8, 0x7d59c563d86f34ee, 0x46aaffad7598c32c, 0xcf409c31c8844e7e, 0x79c42533c7aa909f, 0x479db5f8f576cc3f, 0x66eda53badffc321, 0xad18408b4295e32a, 0x6bd4ed4d21f6915f
+, 0xe5081bc37f1340b3, 0x50c0bf665d2c720f, 0x841e5e210c4ffeb4, 0x211eaa42b8db6ffb, 0xabb1c1fcd863c9f1, 0x3b5eacdeb4d577bc, 0x0e98b587fe3b8988, 0x60c3da91d010fb92, 0xe2183c2a6260c36a, 0x6798d0057712ff4b, 0x12d8012dea4ced86, 0x0264e2f9f3fb30d8
+, 0xa84a664e305cc9d3, 0x51ecab8514cc7cb7, 0xd6329ebc8c947aee, 0x0ab56086686ecb70, 0x4dda93f995af40d5, 0x2deb160b9a6d7da6, 0xf15e67f97198f8ed, 0x5e20b36b6a4edbdf, 0x73f28bb863a4545f, 0x586a9c15a11ab76a, 0x93f98b873f1f5b70, 0x10df3763a352d44b
+, 0x4e0f7ca9472be00b, 0x4d9e9c56e397a06d, 0x6ae583c05ede9ebf, 0x5c5760ac92a20b55, 0x29d7f3ad36d55e91, 0x6bdcc724026ce82d, 0x5a93bcd246ecfbf0, 0x3d066abbf57a2374, 0x83730aef4f5c07c5, 0x1dbb816de4cf8ddb, 0xbd2fa1e40db57fce, 0x00fb8001bb1812a6
+, 0x9bcbdde63fd03b07, 0x0938a63964da7e62, 0x78a2de4bd5e27012, 0x1e41656a29ee5244, 0xd8648b501457b35a, 0x381e725a96931d26, 0x69aae3f609365a5f, 0x2203f7b76370794e, 0xe6f27686ff9d1799, 0x458ee0c9ea2aa586, 0x44e6da71cabc2ef8, 0x3fd3770714b55f78
+, 0x5b8f134d1013d974, 0x49f18db919df7947, 0x74e0dcd60b43dc09, 0x3d1b16eb4fe0332a, 0x53c403ee3d887cef, 0x2c73d23b70b0331e, 0xc9fad4fb3389a776, 0x6c711088360cbceb, 0x69554a99a4e50be4, 0x2f18bb249b32e372, 0xec5f2d5d70362ac1, 0x37e3f549498ab958
+, 0x478f619e5365a440, 0x393eecddb943f8d1, 0x4bd93611d11c5071, 0x369678effa1a0bf3, 0xe6381034bde213f4, 0x659e8d9fc9a23bef, 0x21a1622f6228f446, 0x1c4b69c8349e404d, 0x8dc90693f95b7baa, 0x283ae0528c988063, 0x9aad3bd73abbbca6, 0x5c98defb27885e50
+, 0xfb8ba1ff0c413f41, 0x234f091bc7b8a9c3, 0x3f925c6506283b13, 0x2e1c03c94141d282, 0xc4d9bf7d1e89fce4, 0x63fc000266797ab3, 0xdcd0530080f41672, 0x53b161d9378b278e, 0xc63cb383becae2a2, 0x114e9729b34a0faf, 0x945a1a6b5810d9f7, 0x5f26ab4121e3c1df
+, 0x4409ee053f919244, 0x5714bd90513f419d, 0xd0142389b9d5ff54, 0x463d9c7ec0f72716, 0x05a9deab332697da, 0x2922bcb7a4367989, 0xea5dab61efba9626, 0x3f8d581cf644f36c, 0xd5831ec80016492a, 0x3f5361c1306b66d9, 0x9e52c51edc709e9e, 0x5f7456826b48ab44
+, 0xc454fcaff8f27ed7, 0x58866c65d40d6df1, 0x128ba3415f8888bc, 0x5c29e5f12ee53bbe, 0x421b7717db371fc2, 0x5c18debec75e281b, 0xb38c1ffe92923737, 0x2094854ae2383320, 0x4a18eb6f5acc5d17, 0x5c70ca1444f29d2d, 0x5c4223fbeef1d525, 0x0a351b3cd0bd2c85
+, 0xb3ba1729288afd0e, 0x2a58a438fd1474ed, 0x6f1ad918bdb7eb53, 0x6874813ea7feb87a, 0xde099c1f72d289fc, 0x2ed6f1110b5028ad, 0xc82c5b6229530785, 0x446a17af5224f363, 0x614f597f08286f7c, 0x0500da37d07ee5fe, 0x6b640277945e27e1, 0x1c36f78aa2e0533e
+, 0xcdd993e339ae60eb, 0x42de4fe8e16676d2, 0xd13cd0874801d18b, 0x42477aa1460c8df7, 0x1742da473fe86aea, 0x64a82d7b9dd1dd63, 0xb5974ab382b36577, 0x4fb4a0a795e1580f, 0x2f3fdcda6f9b3598, 0x0ea67c3a656fba3b, 0x0600216890c15ccd, 0x212a49ee76761c43
+, 0x91d8a205177bdd56, 0x7ed474c07d3a1675, 0xd10288334e13b11f, 0x21f0fb3b5bae4457, 0x879ece5803acb69b, 0x51273bde6c8cdf77, 0xabe54a964a3a1bf5, 0x5343df7927e70bb3, 0xc64bd7dab6b36e98, 0x75c772a49a2fbd2c, 0x2294ac74ebb64e72, 0x5db6b1c7ecbff6a7
+, 0xa4512a78b5dbf482, 0x344816060e0dd8ff, 0x4cd27e4e4928c5f8, 0x62df12fd07e98f0a, 0xbcd9c444e63a2151, 0x0d23eda951deacca, 0x7f4c042377f29a12, 0x670312c021c579a5, 0xba0469785c8ef6fe, 0x33f9f06132c39eff, 0xf8d61e62aaba534f, 0x694f697c01d8ba35
+, 0x2ddabeedc49edb09, 0x65bd21624601214b, 0x64baaaa63cdaba54, 0x3f13411cd7086ba2, 0x165d4fb800fcfff3, 0x0d6ce698f4fd4ce3, 0xcb6c2f1b47100ccb, 0x2e4e2f4b7325777f, 0x3128f002537d1f03, 0x25f17a938828550a, 0xfe1b47fe96c62251, 0x758c3cd842d7314b
+, 0x77882bd9e6317007, 0x6b799b80744d041b, 0x02c668515c450e05, 0x187fcdd2c53e96db, 0x81444cd4e75ebd08, 0x162a70f9b0f01540, 0x3ff0f7f4cf2cdfb7, 0x1b68e5ebeb2a1579, 0x3c20b54767c74832, 0x22100fa4ed1b31f4, 0x642caf072862f506, 0x5a88fefb6e9b46ce
+, 0x74f59c3fad2efba6, 0x7ffd51c2774da49d, 0x6ec3ce7738066c8a, 0x0f2f5a293575b4f4, 0x7ee6fc5034e6136b, 0x17adb494e4f13445, 0x0fc5e7906354a88f, 0x60cb06bd325b7c44, 0x58e03562f5f0bd80, 0x13674b53b9b416a0, 0xe36acf3dae37f6fd, 0x3982cc4a9d3b8924
+, 0xff868f027f5217a9, 0x5a6398a45130eba0, 0x87348d17b407ac1c, 0x039ea692095f0857, 0x62972e5a412cc2df, 0x05d1521199bed3d7, 0x166cb5c1bcfbf5e1, 0x37f732ae339fd680, 0x5b480b8c9971eb9a, 0x5a1f3740496978a1, 0xf95a058d682f0eee, 0x0333088cdc049b95
+, 0xcf0a2316a6cc4612, 0x15450f46c00b829f, 0xa5edc4b5802602e5, 0x6957766aec7ec6ec, 0xdc3d2d76f90798d1, 0x7ca7f0d50695163b, 0x7db22675d9fac778, 0x14b7bc968a8aa51c, 0x57b509d7d41bc054, 0x37995bb7f88e9fdb, 0x472b60ab9b424561, 0x06598d08439edf73
+, 0xed77c187d241e1ca, 0x357714ae13c4e8ee, 0xd796ce5998a134ef, 0x50119bd88e15a0da, 0x08e282ad14bff0e8, 0x0871cb0e7e87580b, 0xd9881b2b949c2ea6, 0x3c18bf898de638c0, 0xcc465289c362ebe7, 0x4a5482171ed8da7f, 0x3cd1e6ffa4cb5b37, 0x503daab88213024f
+, 0x2dfd636e508195d8, 0x336d8c663972deaf, 0xa11266b338518993, 0x2789a28c60eea963, 0x57a9758faf0bce2a, 0x2a4fd9d14118da97, 0x42e84b0a21200fa5, 0x406cbd7a800fe858, 0x1a1cbed1ff0b97da, 0x02b80242d990a124, 0x16953ed5aa58baec, 0x63b25b7dd067bd5f
+, 0xc392292c17402442, 0x74bd014655c354c4, 0xd22c4dd285eb83e7, 0x74c58ef371903530, 0x7f84bd669e371de2, 0x77a786f0f1a06e6e, 0xd13c054e715ad2d8, 0x6da8e92fa320bc96, 0xe2b86f86bc26b820, 0x7b5047b6016b1e13, 0xcbca6342cec2cb3e, 0x451dfd37ee3c6a81
+, 0x92c39ff67ad962a1, 0x2b37fc73e1cbf2f5, 0xef425da9cafb163a, 0x4f986ca7a27193e1, 0xd16f4d659e064e0b, 0x09cbdce7d52051f4, 0x8c31e7069b2de38b, 0x17aaf91761d88985, 0x61a342a2f679deb1, 0x6370ac53327b5acc, 0x01efc4aeec629960, 0x0490f34ec712ae99
+, 0xed30036b5b114db8, 0x013d35ef5f0dc48f, 0x76272e71b041449a, 0x49186a7c9b885692, 0x921960e368adcf66, 0x575eee315f0d3484, 0x3e1b2b7f4636ba8e, 0x0b7b0255339bdca6, 0x9f2cca6a32b935c5, 0x08083fd4d5171f80, 0xcf9a712a117cfe60, 0x43eafc9477c19aff
+, 0x3f3ddbfdb939de9d, 0x395683b441fa6882, 0x757ec23d1d16a08a, 0x6f7108b0ec39ee0c, 0x7b2bf13daea714a7, 0x5687bfd151ce33c6, 0x06db2959b83a14c5, 0x5c46d292d6123932, 0xd01c66c65c53cd4c, 0x5a004f3f2acaedb8, 0x717942369f46e11b, 0x58a700e3f4f7a3c0
+, 0x8e6c6019ed1268ac, 0x56003840f68f46a1, 0x47b64129b3dffc1b, 0x57ef38e524b5b9d5, 0xe322b888d963f211, 0x671acde604fa5e48, 0xbcab009e58c09615, 0x6e5be0758d515cb1, 0x0716dccf036cadf2, 0x0bb9402fc0ae72f3, 0x4af353800ab55875, 0x39dc63c2d69b5a0a
+, 0x1c37ca82bb66ffff, 0x671e56a0574f50cc, 0xce73b9819ca2ff70, 0x3bf068fd802a3252, 0x3013be481c45246b, 0x396d15d50002588a, 0xcce0bf9ee2b68f6c, 0x5d7a3844e5f88b68, 0xa5781fec52cd78db, 0x02cab3a89edf7965, 0x6d348afe3f68a131, 0x11d747a5fb19f4ea
+, 0x686d3dcc26bc797d, 0x0eb531e1a866e443, 0xdf652e6587f61b4f, 0x2a26d06edabfcf21, 0x98a8d3d70d567db5, 0x32030049b42e0384, 0xb5ce88759c6121e0, 0x29ab32d3445e91d7, 0xf50fa444a800bbb5, 0x6c2646214958d7e4, 0x48e1057ac43687ed, 0x3ac3a39f7990d92e
+, 0xa2f3157e167a1c1b, 0x5bfd627abaea3fb0, 0x1c9f14d9044b39be, 0x37b4d9e59eed073c, 0x5ff37f4d6262e4cb, 0x1917382a6a7937a4, 0x7dae88b9e582a6e6, 0x606fb74bc82f3d0d, 0xdce505d37597a67e, 0x08b3a6e2c7777175, 0xac2bed3b0a4a72ac, 0x6c93d2e39dc62cf6
+, 0xba7431d2d0333c2f, 0x1950b6e5ffd10b49, 0x3d82e5000b341d0e, 0x4c4a2967e2294d4e, 0xf8be54fc9f0b1ec9, 0x629923d1bbbb28ed, 0x21a61a851226c95c, 0x27d5fcfc7aa70c82, 0x9bf4bbc9bebc9c13, 0x08ed3e1f6413fdb8, 0xb410adb259240ce2, 0x42a58ae0143bb12e
+, 0x74bd7f0dcc61e2b2, 0x4551db2263c72683, 0x9ad0f83ada6d861d, 0x484a39e0fed35b20, 0x7215f88cc9391237, 0x1831c654353070e7, 0x7493678ba4798933, 0x6931e592b12eeaba, 0x1cf8a7105423dda5, 0x6a532293df90702c, 0x45534902f6c72db1, 0x01afbeb9716b4463
+, 0xc6bc65e4219861de, 0x6222d5cfe6cf21ae, 0x04db08affb5715e3, 0x55aaa99b3b88ccbc, 0xb8fc45df9a90eec3, 0x710265585d2491a2, 0x2978e9a6add53029, 0x51d26472053e2166, 0xb64928fc67c33bf6, 0x0804a0d962d3abd0, 0x25ae82c67bdde591, 0x3fe963b13479b815
+, 0x071a574651a538f3, 0x62f1b77ce96e53af, 0xd1d3535e58974835, 0x2c773a8e92b41fe8, 0x04dd4cca8d0fe7d1, 0x0fe6ca600f68eab2, 0x82154d709889af01, 0x3f66fa47fe7c8830, 0xdd6bfa9b228df5bd, 0x5790ab89a63e4722, 0x820cf9119ad85ba8, 0x634578e2a614eb96
+, 0xe1daf6f31849805b, 0x03d741b3328f2bae, 0x0a833e1e9406f41e, 0x5046cea71ade6a7e, 0x1ae796641c450dfa, 0x47296c06acda27c4, 0x0a8c619f73829728, 0x6e63aadbb7a57e89, 0xf8a694ea13e991d3, 0x38ceed5be21e6a4b, 0x231398bbb8f32876, 0x6677147cd6d255af
+, 0xfa8404d7486be210, 0x294757381a4654b0, 0x7f9d30b8b4ea716b, 0x25c8490b9fcdba9a, 0x9f7421f8cb141dcf, 0x7e2f842aaedc8a8a, 0x39e2f54c80e50ca4, 0x2a576933826cb867, 0x46c5f27c871d9bfa, 0x2e3f2d488d59332f, 0x4c04b0a960de4540, 0x27e274a408024b6f
+, 0x0865b1582b2c614b, 0x19d73ab60a4a3fb6, 0x71e927b5a5d50acf, 0x2662c90bb008b329, 0x5a381aaa245f6a6e, 0x38b1c155630ec425, 0xf66d841a5a24260b, 0x0960abc749eeabdb, 0xed52069082e35452, 0x3caa5d13e7b854ff, 0x83b750ae5ff060f1, 0x311de664ceab6c2b
+, 0x458e67f0b50f786c, 0x5e20d83fbbde89cf, 0xd8094a613632f3c7, 0x79d1bdf00fd5f363, 0xe6deaa9e386b1887, 0x43615e835f648982, 0x82474ab45f12c0b9, 0x0068ce9bceec3b77, 0xae6a7d2af0de21c1, 0x17aba0c84212d7af, 0x4dfb13233d85a1b7, 0x4c8157ae7894f2cb
+, 0xb7b41b06f575de4c, 0x646d7e28f9a5b6e3, 0x45b7a74fa8e8ca39, 0x59b181230b9ad9c7, 0x2db026b200fbc4f7, 0x7827af45372809af, 0x84c7c1df205f7aed, 0x3d43e27f7894d953, 0xc72048a93e6b8793, 0x10bf4a94be5f2689, 0xfcd4cfaa584a086a, 0x7af63a1f2acbfc0d
+, 0xe7904b4a08bb7692, 0x4b4f537300469cf6, 0x0d36e1883198ae1b, 0x71fc112a54d2252e, 0x5aef4fa6679c548c, 0x38590b5bd55d65e7, 0x842a4f8205326582, 0x264a8858123b69bf, 0xa2cfd5a917446f6f, 0x63cec60ca08b6a4d, 0x01f6e3477fdb6136, 0x7b89628b8bfcc8ee
+, 0x9e93df3c9172b071, 0x0999b313df0a77ac, 0x80089a60766f5a0d, 0x20412e9df0126d8e, 0x6c819b1af7cba4f7, 0x45833c8eec4bd705, 0x8ac3ed9bafbd1ee4, 0x3c742f0ab782369e, 0xf88e3e1f17a59daa, 0x38c67435d1a7c99b, 0x519faaf0911f5cb2, 0x1eb4f38256c0526e
+, 0x7a9c2057f05cd460, 0x00d1fa2db7db0855, 0xac096b1454433757, 0x679b67061cadb68e, 0x956cdc41c65a6429, 0x41498e88ab2d6ddf, 0xd7ebed5118476f8a, 0x51fd314d24c2ee0d, 0xda63fb0aeca6a645, 0x0eea17165a4cc5b2, 0x9ec3b88bf21ab6f0, 0x4031228f405876a2
+, 0xf7375dbb789e34ba, 0x324298423daf8696, 0x15426e2b7ba8d595, 0x2a0fb1362b936035, 0xd5347c592c6d07b5, 0x6571f0df7658589d, 0x0d462c731e722b03, 0x2b2979e5b1aff7b6, 0x4d205dfc006f0614, 0x271e29d09c394053, 0xcc3c746c25eb672d, 0x61a1791def9e97cb
+, 0x26ceb1dc6196166f, 0x6ae37572789ceba4, 0xf61f2c035e383497, 0x406f54a4ba05e465, 0xb740d510ab4c56b6, 0x78e579b275526fe4, 0xacc4f1256936010e, 0x41a75a23a1ea672d, 0xc2322a1c8cfdb010, 0x75bca8491bad17e1, 0xee49e6476b486c63, 0x3970659586e89f38
+, 0x854c3e4fe46f7514, 0x2f50c3cf805de023, 0x11650ccbfdd7981f, 0x54fa140d57ad1c7b, 0x55e52a5e8e6bdc17, 0x4a6a2f24096a3902, 0x6a7217a9cc8600dd, 0x2af988f8a22c22f8, 0xcbc33a6395e686c5, 0x373c8b608904ec6c, 0x586c3cfc4a0ac636, 0x5c86c4095cf2352c
+, 0xc9dafbafa53c160c, 0x6f17051918466ca0, 0x9a92da0969483fc4, 0x03ecaf7a3fb1f9bb, 0x1d6c62e06fe9c262, 0x10185c133d6d2a4b, 0x46d7f3acfc47b148, 0x684336dd82002fa6, 0x3ef12f19f4585b6a, 0x63dc76095262125d, 0xd2a31074593de701, 0x1908aae25b0e5f88
+, 0xa6e95d9ec7a4ee3c, 0x4da711e574e2cada, 0x0328c9c246548dd1, 0x4e2414f0c26b4d6d, 0xd9d0bf98cfa4ac2e, 0x5df447628872f83b, 0x41e51d6392e23872, 0x25e78f6bbd496581, 0xbb7541b4ae27324d, 0x3bf2af3975127de3, 0xf8e19aa300a5936c, 0x3d214b442be02fdc
+, 0x6c28863a9aa59f53, 0x61fdf6e34e47c2e7, 0xc0e2d7908849358f, 0x08714b83945a7ecc, 0x57b4a93dd75dc9c3, 0x07fbb45351600b8e, 0xf4155008ea65c709, 0x2413f1b6e07ca59f, 0xb978bc15f2b1302e, 0x01ff5e313ef5e274, 0xa2e32abbe213b3ec, 0x23d97f9a91835dad
+, 0xcd930d919e737f53, 0x500b006a212202be, 0xc81b56a54e4a2344, 0x599910cbfe342a02, 0x3e2b69b33b8cdfb2, 0x36003f0c43929603, 0x93cf9bf6e4223df7, 0x7213c84dcb908220, 0x81b2c40ab3fa65a9, 0x1f94c12ac7df8393, 0x7511d766f56685bd, 0x01978c2b31b5fdce
+, 0xb37b83a6dca83f6c, 0x60a6ced5da57f93c, 0xc0aeef033ca727e5, 0x51ecf875511e12c5, 0x2f35e2547dd0fcff, 0x60b5c18f9291f267, 0x269700f44332edb0, 0x1e927a3b30e8e918, 0xf48d2416a64f6488, 0x7644ee1de2eeade3, 0xf3e391d13179bcb8, 0x7278b4e333c03eb8
+, 0xf2258baeb56d20ce, 0x2802f9a4fbda1572, 0x8d81a688794c9f38, 0x511dc86187ffe571, 0xa72bd3bf9d2d50bf, 0x7db1b1efd95666da, 0x9fe3f057a74dbfd1, 0x656a821388e51617, 0x53b982ab4c54528f, 0x7649abeb8033b0c0, 0xb7b9412a1821414f, 0x430c0f063d958fbe
+, 0xc3af412b0283711d, 0x62e106e55075924b, 0xf3a6044797b46863, 0x196c7cf8fcbbadd3, 0x651bb8ad744b6a51, 0x180f09631fe37021, 0x83e80cc46a2cbd96, 0x43aa7f6b003792ef, 0x1aede3d1387e7d39, 0x3f4522072ab431e1, 0x02eebd5035c335d2, 0x7a0fbc96c71fa090
+, 0x3d2281c0a91a5086, 0x1dbce7e11f33d8b6, 0x88a42820c1ac146e, 0x7d96eec3b789f4a3, 0x3bceb27e5b244c5c, 0x7b2b3dd63239d48f, 0x1b375d17632996ff, 0x264554c8aa59c185, 0xb90b1c853c37bd88, 0x6e1c44b5a59d3180, 0xb46461bf2db26785, 0x439b3d49e4239896
+, 0xc038718f170b09a6, 0x1f824faeeec243f5, 0x4006a14845019fa4, 0x79c25145aaee2f0e, 0x06f7b714bc206ec0, 0x44a93ecbfbe0e038, 0x7891f75554ba962e, 0x5017b08baaea529d, 0x245f267382362a99, 0x47df057b7640beed, 0xccd681afcc59fbf1, 0x408438ac8fbdce7f
+, 0x85949863dfed2462, 0x32d97949da08e370, 0x7a8c04457b2738dc, 0x7daf4fb79f75cb15, 0xdccae413159e7717, 0x74d867617757f948, 0x9b7c0ef62e71c3ec, 0x122fae195fcbb920, 0x139b9f3cd7aec2ef, 0x2b9ed802a0424fbf, 0xf9cb7351aaa22f87, 0x429ebdbcaae656b4
+, 0x3ed18880eadefead, 0x131f339e2b93a646, 0xe065bc5d7d11e3e1, 0x15a670d2f5f66518, 0x122d7fa5f7022a2c, 0x3d4f7689c28ccfbb, 0xebd686432c396818, 0x7471f4b7652cad36, 0x79f1236b5c715be4, 0x2db553ea6ecb0486, 0x8edc57b6de27ef61, 0x136f9f82e04f0510
+, 0x1b2de4ed2e5ee742, 0x0d1a1bb834db60e3, 0x1a74f35b5ba9ca1b, 0x45f666e5ea1f008d, 0xebd3ddd8b9ddcb1d, 0x26bf1ffb5841b668, 0x46da76010605ed99, 0x7e2d20bf14a7acab, 0xbe5f4179a6ace67a, 0x3eeb0559f859293b, 0x2456ea7acacdcb83, 0x7cbc772881c357e2
+, 0x3173476b0ec13c12, 0x2a284df7577bedff, 0x126c7754f73c86b5, 0x5413ed8742c4da72, 0xbc783b5277be3374, 0x51dbbb43e7c5d290, 0x5ca30ea04f7bcd0b, 0x2ad38eea35e3f3e4, 0xb50aea60545ce66a, 0x2a972cd524b78494, 0xffd0a9d472043a8a, 0x62c98ebceca581fe
+, 0xa72490e4745ecb7d, 0x15f19608d09cceea, 0xea634774684623f6, 0x6e946a28c756e321, 0xa27889bfa0a4f1e4, 0x38465d49d8e94ee3, 0x89de87f8d86aab9d, 0x561dd6d7d906dfd5, 0x126520bb8e584fbe, 0x239c55945755f8d8, 0x53963917c9b84627, 0x0de2fe71b4f2c878
+, 0x5533f6d73d3bba88, 0x2cff4be264aa8e64, 0x6fea7271a98b4f5d, 0x16efb90afc0b9c3a, 0xb167266094074ffb, 0x240efc6d203dd4eb, 0x8b99600d50c7cef3, 0x44307d059b5f1386, 0x708739b0b9689a2c, 0x7bdaede94e431705, 0x34b825b44fe87bea, 0x7da6ca01b4e5a35f
+, 0xa9cb24796b15ea5b, 0x0d163b08f7b04d4e, 0xe723f196b358d48d, 0x487bdf80eb422811, 0x024f300530d1dbd7, 0x755c72f1d494e21d, 0x53a5f86bc49bb9d3, 0x728bf1ffaf37e983, 0x5418decc01e44f2e, 0x20f5b32a7bc7b031, 0x2ee3164a5f1741f8, 0x2c03449598891db4
+, 0x71aa943ffb06c3f0, 0x2db9acb1ee8a7c03, 0xd2a1830d7c75d2c7, 0x30b51ab1afde7427, 0x4cb1d6f3a911a7ef, 0x703dbfd314ef1421, 0xa0e8d9b31c4d55ef, 0x2f762063bec7b2e8, 0x441ebf5caf3db4b7, 0x36a8b6276ad1630d, 0x2b4e2737117e3427, 0x7583d30bd7f0edef
+, 0x3aa8e31c6c3d17e1, 0x662f5af68992c7c5, 0x2fb31ff5dbef39fc, 0x49e058d4f8bbc952, 0xd8b231c2069d9b25, 0x2e7d9bdc7f2101bd, 0xa5cb695121f079c8, 0x77fe37f013d7849c, 0x1fe6df2144ce7c98, 0x72cb210c5b9b1ca1, 0xc83fc577a9cd372f, 0x79a345b47528bef9
+, 0x750fe0615641f6d4, 0x7f931e3a49da5b17, 0x87c2facf9528b899, 0x1e6b0dcd3be47c3b, 0x7cd5ef0605dbd979, 0x1c02c238af80161e, 0xa0ea0691fb7159ab, 0x65ac537bd675faa8, 0x986afa8c4fa616e3, 0x3d94b4fba8a589c8, 0xe63559b6a4427c54, 0x6ffb406a61743aff
+, 0x44e90f213bf1dc82, 0x3db5b19fddb16db2, 0x8839ffd544acf4cb, 0x6c2e1b6e2365c354, 0x262465828ce0d75f, 0x1ebceb12c3f370e8, 0xd27311cdc1028aa5, 0x45663625a80143e9, 0x6e38cf13fab51852, 0x4b30ef2fdf149703, 0x488f1380df454b10, 0x60bb74c1ce8d9348
+, 0x6324fb2d0b0b6a9e, 0x092b75732593fc47, 0x7fc37471963942f8, 0x7a225ba219794212, 0x2742a400b1047382, 0x25d1026c484671f9, 0x3bb7e82e5a1de78e, 0x44d264d866363809, 0x40272a17f0246cd5, 0x3c7ee5608133da94, 0x835b31f07275bfaf, 0x27f95636f17fb464
+, 0x55a69292042540e0, 0x61ce345f032dfb05, 0xa6edb1d977c56467, 0x47886d9cfa3829b7, 0x57119dad6cff0c59, 0x53e85e298ba2d468, 0xf338a9a0980f405a, 0x3dc8657e4cfc8bd5, 0xc6529df7819580b9, 0x142d368d2e404919, 0xe769550725357962, 0x686c05e330cb5378
+, 0x020a636b58294492, 0x3a6f8961bf7cbf6b, 0x18d908918b67b157, 0x15af6f566697314d, 0x8915b346811ca3f1, 0x4170318707d75352, 0xa75f58626614ee31, 0x7e65c7cf7002c0a6, 0x712db5d7e601893b, 0x70435743e7c1ba85, 0x6bd0b5feb5ba75ab, 0x04c99be0b63267d6
+, 0x89cd5a7090ef4bbc, 0x7d54062ef2d25271, 0xf15fac76fd491ea5, 0x49d504338aeb19a5, 0x532c93e98c9518cf, 0x45dc7d5fcaedae86, 0xe06235ded8e677ae, 0x2dc0a8a652c99339, 0xcc7f588d4fde5a45, 0x78b21f88a7f9f407, 0x0207256354f136ce, 0x6ac6e418d5afc88c
+, 0xdf8c7c0918ab2cd6, 0x14fff369e8e66ba0, 0x2e1eee5f718e7048, 0x1d9b51a0ad28c3d0, 0xdbd4c78404304e1a, 0x1e2445fc12a0d668, 0x6891de8a56dc4c6f, 0x3406cabd7aadb9d2, 0xca29d02fd9270aaa, 0x093245b0a0463b43, 0xdc121a424e5288f8, 0x35859da7a81ece42
+, 0x4ee33eca48010f29, 0x1c8758fa80cb6c50, 0x1c13cbff9c266d0e, 0x5f3ad836ee9a0e1d, 0xaa3d5bd7769426f1, 0x2ecaf2f51cccf35e, 0x8d9796f9cc40dcaa, 0x3fb8fb125b801c83, 0x3ab7874c0f534597, 0x6f20c9d7bada2c94, 0xbe7f43d2b366e17b, 0x2f36e572ef822bbe
+, 0xea0837b290c155e1, 0x2ce834ffc893c239, 0x01d01680c61f1863, 0x7cf6135068b2cb07, 0x41710bf2e043e3eb, 0x0399e95d0b92339b, 0x842c6f10d6c759e2, 0x1624cb090fad55e2, 0xe746402e6aaa161a, 0x6f20c0cb1c0f0ae7, 0x98085c012563b02a, 0x249c4472f0774355
+, 0xde31667a7e4dbdbd, 0x4adf219c8cbfdbe0, 0x8a77c5b38fec4a7d, 0x0a2eee511335e684, 0x55170f15e93e773d, 0x02530dcdad3724cc, 0x5a0774a4eb1813e3, 0x71dbeb1f2ef96c78, 0x5979a7c8025a1c47, 0x2431c9b095042474, 0x620dd7e2db2886c2, 0x61492e27ca864ea0
+, 0x0812a36c66cb06fe, 0x79bacde27e3c9502, 0x8064686548935a14, 0x74ac67a9161fe745, 0xa90bb0ef8fbacb19, 0x6c0e490100690940, 0x358dd36fc583745a, 0x2e8669458d1293e9, 0xb74201c6ae008c66, 0x744b53467fd9def2, 0x6cfbf866ba72a892, 0x6b0892af05784ef5
+, 0x80ecc1cbe8ecf370, 0x5c37a5e15c8924c7, 0x1845137f48d833ee, 0x4a984b4482057e5a, 0x12b6ccf90d15acec, 0x3c426d4e885abc7f, 0xf28e8df887b56d9d, 0x03d492f3e8dac93f, 0x6d13a083216a6097, 0x199b9e8963568471, 0x8ae7a3691339a31d, 0x595cc5ac1a259a33
+, 0xc985d4e3b254faf1, 0x402a439a3e32803b, 0x3d674b5483138e61, 0x16811297b4bd6684, 0x87b2b803b64288c7, 0x5ce2196c6881b10f, 0x5520bb2ba4137b5e, 0x07e63a867401abf2, 0x0d26bb68139ae861, 0x694e2d7913427f5a, 0xbcab7734f030517c, 0x5aafac1b3fd83011
+, 0x0dbf4e4a7e5c5f0b, 0x584c23e8934c56bb, 0x80ef7420fcc2de39, 0x09317a9f4b59eb0e, 0x324b5d92640e996b, 0x1f5000f10c879c94, 0xb51815b0537fdbe6, 0x5c0f00c7dbe0af33, 0xf4f5c517354c2953, 0x2da2930a2e00c18b, 0x03a6dab5997cef1c, 0x40ee2963111a9c0a
+, 0x278990f852fa2067, 0x1b30719654765e92, 0x6220f82803468189, 0x0e926335e40af731, 0x26ed32148a39aeeb, 0x3513f89d800ef533, 0x924fd2f90eb8046d, 0x27a68e3ed2428502, 0xebf0d9734a632720, 0x48390a41ba7ef7c1, 0xff8b3a91d48f2b54, 0x40e7768a8918dd2b
+, 0xfb4d97fc3eb2f961, 0x427ccd5ffcff296a, 0x2001f87eb559eca4, 0x0d522a0543a8f583, 0x8d2c5650b9fae8a6, 0x31095328e3c3a995, 0xb111c81c0ed768aa, 0x7f4e0c8f25750d7d, 0xbe27afbd7acff502, 0x10d9e68d3e594f48, 0xd5c79b982448cb5a, 0x761e71e348d4f636
+, 0xee264e70d5131efb, 0x76b1a798b321c397, 0x36e61712175fa915, 0x5c6e3863e5b675ce, 0x4251ed9b1059650d, 0x695b7cc089d4c369, 0x2fbfe906aa6c9fce, 0x4fa35ff4dcf68df7, 0xbb41026ebbac3a56, 0x0974e7007a022152, 0xb8c68551fd86d1c0, 0x2a5cdd9b595b1354
+, 0x2b7ba2e92e977817, 0x51ee7a034d965187, 0x954bac39855a365d, 0x007af7e3c1c44952, 0x70c1fb27d82cf3b0, 0x616b372d43136141, 0xcc842aeed70cf805, 0x4f06341e2d3e0a02, 0x48d6aa4966aa24b8, 0x237d8aca5d056cf0, 0x7fc07f1f049fdd01, 0x52afa93e0d67cf3e
+, 0x8d929e7066ad914a, 0x4329ce7d1d67eb04, 0x2be7f85662baaca4, 0x3e0b542c75449a5d, 0xfff02ac3edd21f8e, 0x38183ba36ef88db2, 0xb1036c27f1b27ad3, 0x0041a75043863a8d, 0xbe0a633c20ba9a49, 0x19683a8d0b8931a5, 0x6524546d579e2dcb, 0x20ad2986d8bff3b8
+, 0x78775a3d27f3f501, 0x675815676e406876, 0x61ed5f1d9a8b5795, 0x19f1c3cf9f57867e, 0x2ef9aab62b8b1c68, 0x3e56d9f70d969eca, 0x43edb6bee01cbd39, 0x1ec97a5e8b47ae1c, 0x04a1495b8da5d2ac, 0x65ce4ed97af4498b, 0x44a9698ed7ac38e0, 0x056dceac0230f69b
+, 0x66eefb51fee71bdc, 0x4679d4dda27fab74, 0x0ee5a1120c9ad197, 0x76f2d765317c3933, 0xecc08679fc977b63, 0x1f3ca36a15e57b94, 0x28bff98f984a4e28, 0x45c488748e0e52d1, 0xd4f4372572af86b4, 0x3a194ef7bd2db45a, 0x53f92d77fe98a9cb, 0x501c6f4968c55ac3
+, 0x190c37ab051e19ab, 0x70cff101ae99ab95, 0xe1d815a992af6d32, 0x6cdbca4bf1279d70, 0xa5e81ef34817a7ad, 0x48ff47c217d936e1, 0x48be734018a60fcd, 0x0c1e276ac3c7c817, 0x2b8776ac74b071a0, 0x6b92f5b5185e6847, 0x8226f6e4cd2e3aa5, 0x34d185dd7b9ea761
+, 0xa9ee2f98b7a61ca2, 0x6fb65b16aa020982, 0x07c18cc244000803, 0x66240ec922350792, 0x9c71926075fd7eae, 0x1425c8b7aab7b593, 0xb9357b2bfe6987ba, 0x36bdefbce38267e2, 0xee9b931634c781b9, 0x0c5692e3ed440c98, 0xde2bf72e8225b783, 0x46e0e584bbf13afb
+, 0x1e7e3a603baa1ef0, 0x34f9be3f9b605e36, 0x885c7d33f1d290c0, 0x0589188761d214a4, 0x908c4be4e6cfd633, 0x2ea29afaeee98bfb, 0x9116e85459bd7a04, 0x5612939dcff87a18, 0x0ec79e31df59f46f, 0x573b3f431ac3e21c, 0xaceba7a95a46aed1, 0x582738e06b9994c7
+, 0xede976eb0565d0e9, 0x451eff5748f49225, 0xd2029a18fb66b3e0, 0x5041c1ab6bc2dfcf, 0x7e492d1006054db9, 0x5ca0d0ab0a1fb9cf, 0xba496d3f2523a72e, 0x482adec539e614d1, 0xd728cf131dc4ca09, 0x5d5d5466234ea58f, 0xcb81e16807085ed8, 0x513d435f8c498e00
+, 0x37f3f226bb1b929e, 0x65e4dcae4545e318, 0x72b379ea86ef18a6, 0x560a21152e529e91, 0xd564786b81fad3c8, 0x6254b8c3b598898c, 0x6cdb4dd92a824e49, 0x6207e1d88e33749a, 0x56d4b748dcca1066, 0x750ffcba2cfedf61, 0x2f563eacbf4692d1, 0x468a910e5ea94bbd
+, 0x19a5c157897c420d, 0x5cccab12350d8812, 0x876547f93548a4ac, 0x3b4b9ce5fa6a2001, 0x81897b8264a3dde2, 0x245fd2fba2a97017, 0x2d2b55f5a887a330, 0x40729f947f61063f, 0x58a3888f0ef96a6a, 0x6ea5de08e00c9829, 0x415fa64d370b2ff7, 0x4c532af0234c8a30
+, 0xaf09b8ff441a60c9, 0x0b2f44115c8d8307, 0xdf339951db4b14e6, 0x30ef6b1dea9f56f3, 0x730081a969afa97f, 0x7b05ae84d70488ae, 0x6d7b9f157d96c2e6, 0x2350cd841f68e86b, 0x179a61aaf6d4dc7f, 0x10b3a6bb112ed697, 0x0035e456d066f2ad, 0x5c42dd73134a40db
+, 0x560439b0db4e655e, 0x22e41cd9d5786276, 0xd7a6b936802fd0af, 0x23f59472817acbc9, 0x1e1bd0ceb06f6692, 0x0dddaceed5e69275, 0xf852ed74ca62ce7c, 0x6b299721598e8c2f, 0xd361d87ddc034e83, 0x55edd5e17f2e84f7, 0x98dd7dc777e11d54, 0x32bb431518e7ef11
+, 0x78033ef15510036d, 0x0a90365f184526c0, 0x988c05373dce2118, 0x6c51bf4dca36f16b, 0x5a4a5dcf8bba8022, 0x6a57efebf4f6c5ad, 0x663b3812b5ae1e41, 0x19358be4ffcc1da1, 0xb41d95b0e1c5e646, 0x1a683daa17d3b030, 0xd3608cda6a5ee6d6, 0x08a717cb2f4c0807
+, 0x7d3f5cdf1fc211de, 0x3470fef3adcad83f, 0xe65f12d136fde79e, 0x1f3d4a1b31542fcd, 0xc777b08b37f4a4c0, 0x793ebc785919d296, 0x91e00f07d5d48b84, 0x452582c9eb43bb5e, 0x28bf98f011667490, 0x26266719fe46d89d, 0x37a96f376007d96a, 0x3f4afac83cf32add
+, 0x653b2caf6e5570a1, 0x524b1d028591664a, 0x51c85b7427b7863a, 0x79c50dedc55fe9e5, 0x2afe3b76297c3092, 0x2f0396f39ede2ce1, 0xeaef36d391173011, 0x4997ed7b95e7792a, 0x2df98c87994ed846, 0x6f64f3d1ee8feb31, 0x23448b5a4736ef34, 0x13cc59aaa2fbd06f
+, 0x39ab23912b05a369, 0x04209fe30368dd12, 0xf2a2342d668065e5, 0x3f5f945b3f4cf0ce, 0xd64a8a551850c818, 0x31a14e0bdfe88ab4, 0x57dccea3779a31fc, 0x0265577d9227f96d, 0x957652ef0246ccc6, 0x146c498b3c68ccbb, 0x8c08e11c70fe8f9c, 0x6a43d05f304f84ce
+, 0xe03a29252b616950, 0x5eab082b72313e02, 0xdcbf6e8bcdd0a6ec, 0x7901f21c2e6115de, 0xf5f435935df00d72, 0x2d12a6d11a371733, 0xb933d592f770461f, 0x3c2684f22aa07f70, 0x41d48d9f8ccccfc6, 0x5477795c238c7164, 0xb15c2448ebf535d5, 0x32e5a57b41488ee7
+, 0xa0a1dde686a35c30, 0x5cc4d364c7264c17, 0x05f77ccab143e8e2, 0x35b487dd662e7538, 0xb84575ab30185260, 0x7230021da7ca6281, 0xf58729a1f8da7fe8, 0x0cc061ff002e1b4e, 0x07567110d3c008b5, 0x4d1f7bf6bde073c4, 0xdc91cead8dceee09, 0x60dafd4195a64e8b
+, 0x5f51a4a6027b9900, 0x27f3a44308a77c2b, 0x556e485d7025678a, 0x75deacb9f75dd7e8, 0x8a96cc57af840ae8, 0x147510e4451ffcdf, 0x66e26bad8a7f17a8, 0x24c69b12b4617495, 0xc1cbaf2081e075ab, 0x466145d487f3a58f, 0x836a852d84a3bce2, 0x15391a6715456fd8
+, 0xbf68d2f398ed6397, 0x0681c8b3241c8912, 0x4eed47077fac6529, 0x6707e0d0f98fa8b5, 0xcbf33f739239c556, 0x731b08d0ee08c98e, 0x6be29fb072a99868, 0x096fd1315b3ba42d, 0xfe47b8e932f0ee46, 0x1b2458773eca9218, 0xf05b9f61c4eadf96, 0x0af32b797db22695
+, 0x9261481447e2c89a, 0x35efad5c39cc352c, 0x0361096d828220a7, 0x1d15b927b8727443, 0x7a967b63b73b7fa0, 0x042769559ca021ab, 0xc45fd98143aa63f5, 0x56bbdc87b9741d81, 0xca58136bd043b8ea, 0x5eeff49a1fe1fb7f, 0x561af42177136143, 0x573d516e37c3d103
+, 0x12e975799fbb41b4, 0x21c714bed13b3a59, 0xdb68ed4bc3791d71, 0x3d64a9337d8b7749, 0x908ef0568d4c2519, 0x529abfcbcfdd77ac, 0x6906a1452050965b, 0x483e35611dfbceb8, 0x6dece8c4cf4f8946, 0x6425ba2b6a933cfa, 0x54a76e3dec442dbe, 0x27738bcc1f4a92cc
+, 0x316955b2f7c158b2, 0x506cfd40e5a38de2, 0xcb7857479d70b789, 0x0a649fab59a5ac2f, 0x4d00cd17e300f679, 0x091545895566a866, 0xadd56dd09f9ced6c, 0x4d42f11c9fa2f1e0, 0xf0dfbb8ab8490f99, 0x2044d6683469e18c, 0x1e6c9f897ef11da3, 0x570392c62277f333
+, 0x9ecdf3fbd44d2284, 0x6831e8e2249c63bd, 0x17bdc106f3720842, 0x03c1e19b52cf7c1d, 0x65c12b4df80052b4, 0x6a2168fce594f546, 0xa4fdc58b24129332, 0x3fe0ec9a185a2292, 0xa664dd20f080ceb6, 0x20fa7b7fd819ff8f, 0x8430621d349e9a62, 0x755a14f148a27d55
+, 0xa64e9d04756bb0f5, 0x18d0c91fe0d4f8ec, 0x30ec21047f281d08, 0x56d60244701373cd, 0xd33db3929a35b2c9, 0x54b47b8519b3ec58, 0x20518015a8015037, 0x51abb5cb7874e151, 0x08b8f69cbeb83e8c, 0x4abb166135887688, 0xc715ba3063d4140b, 0x2faa3e4b74e15b7a
+, 0x4c2a7682e5bcd31e, 0x75906fee0d5aad6c, 0xee8b34097f8200a3, 0x35d2e8d7d2c0b720, 0x0e999b2e7b8f4f98, 0x503bd2cc06e59160, 0xf861a30f7787e412, 0x52654db6d0148955, 0x03fcafc226ce0c6b, 0x2dd7fbf35bf4536e, 0x4cb94f84cf05c667, 0x70edd858d3b91e44
+, 0x098bc096227cb78a, 0x74886e25ea9e284c, 0xc40edc82bfa2f079, 0x2bc0fb226e01f8fd, 0x4f4c81353c0c6a20, 0x783eb2bf41703f35, 0x9c49ad4f40920a9f, 0x5ecfd4f1eb1579c9, 0x57c66f36716940e3, 0x611133f3e2a9268f, 0xfe51381d896b090f, 0x67d1c94f3ef7f1cc
+, 0x4ea2052014d0c709, 0x1514cc76c4236021, 0x456e18086e599a1a, 0x7f3f8bc34c698b94, 0xd777fa863d0a243d, 0x2771018f75f71ed7, 0x51ab728e9d1162a7, 0x67ee57dc2b497658, 0xce93d221322b16a9, 0x65e461268f68c4fa, 0x4f57bbbd2e343acc, 0x621867fd8102e9ff
+, 0xee4bbce9d397b36e, 0x6e1f807c349b6646, 0x1cdc965c0c5feeb9, 0x5576bd4acb7b9781, 0x0f8e2d9b64108e30, 0x0287b1c4c77f7e14, 0xb9b5c99fcfdf002d, 0x6750c9901fccaec2, 0xe0a13921fd5b9a64, 0x763b6ab7a9012aa8, 0xb948ab1a048bf10e, 0x4fa86495013ec181
+, 0xb14d9616af165735, 0x67e2b5726bdd710d, 0x2a701d86415cdb0b, 0x1ee62b2ec1295c19, 0x55a6f70ffcae1f66, 0x00e6f75130430546, 0x4c37491b0c3dd010, 0x34fb19282f615138, 0xfd56396d570c0889, 0x5546a933752c2a7a, 0xa494efcdecd3546d, 0x4c3ee305ef5db4a1
+, 0xdfa2c66d74e16fc9, 0x2c58e32b23599332, 0xb3d3a2cb41f3cdfc, 0x056e95276e4382e9, 0x6709611e680190fd, 0x4c83697d375daf43, 0x2ab45891caf55aea, 0x306196b6136f7cc3, 0x2f91f99349ff9963, 0x21296604e529e37b, 0x3ed95d2e1d17b78c, 0x7cfcaf0ed48c72d0
+, 0x8b10ad21745b0c25, 0x58d186a33903db13, 0x1d5718064a80a68f, 0x66d8464e9619c9ce, 0x58038a81cc737206, 0x782356134683b774, 0x888f822305961129, 0x32d3900e72ba96de, 0x0a59b4e8215531b8, 0x675567f68270d43d, 0xf222e65466cca99f, 0x7e66f64dde1b06e5
+, 0x113dd0fdc63683b0, 0x75e21a2e78f88aaf, 0x6d27f41ab4aa4458, 0x7556d581bb91c163, 0x9f5432b31507002f, 0x4b916b18360b2f82, 0xa28cbd65fd2aaef8, 0x13761d6b259b5183, 0xec0496a407619579, 0x156d770f4f025d8e, 0x9a59b8d1f5664d8a, 0x7429baa3ba00cdff
+, 0x3452951d2e0e5d56, 0x1529b9b6842b5b58, 0x5360e11194451bf4, 0x5dffc6d31c1631f8, 0x8725846ee184fd98, 0x1ae21f1927726d9f, 0xeb76e19340dcc87d, 0x1aa4963f95754bcb, 0xae2255ade1770579, 0x2eb4e4b5cdb2fd52, 0x226b1a4f5b4c929f, 0x09879a6cf9bf33b6
+, 0x9b48dbd275e58041, 0x423da477f00e2829, 0x2b99283c33181a83, 0x40fd8654a3b26be0, 0x0bc8fdfad02a7e8d, 0x54edcc1f54199f89, 0x60c7d9b07eeed5e2, 0x6c53abac0db73b5c, 0xe605d127796a3575, 0x4ccc38591526c6b9, 0x52bc5fd68a0ca3c5, 0x1f085a3f99466129
+, 0xe4bd8ada0fe37360, 0x30dea0f3217917ac, 0xfa2f855b38654d20, 0x7208755ceda03239, 0x81a89dd9ee6bcb5c, 0x76725ea07a6367ea, 0x8ff3c318f1e2370a, 0x50e5ffd978e34ab9, 0xa0bc9263b3035747, 0x2c8d4fe56de45014, 0x8e74fc77442bf6a8, 0x01554ee8800e33d0
+, 0x05650c539cf6c6a0, 0x321f327798b3e9e8, 0x3120693342455ce5, 0x10db2f51dcbd5b69, 0xb2c94908cd5f5700, 0x0b7f397595cc1ce5, 0xbc4f18400267c49b, 0x4de457c027eef438, 0x2811dd9855b0adee, 0x35ab996b1f5fae2b, 0x38f3b71bb50a0991, 0x5c916ef60a46c87e
+, 0xdc61dadd6d7a00e5, 0x1864131b5f8d69f7, 0x8ef819f2a4608a4d, 0x67a035a449860b5e, 0x25fab917aa49d9c5, 0x052d1bd7a696709c, 0x0a99fa1fc8365174, 0x1878713f6fb9d903, 0xe225f019473b6e38, 0x6d914d28ef9df215, 0xb11b80b3e3a955c5, 0x608ca3911d952e04
+, 0xb554611de08771d8, 0x310c9552782c2aa3, 0xacb11686ad1e1ed5, 0x3469c70bf1a26a7f, 0x59f44b5ab99369d2, 0x75333373bb191e20, 0x53413d80c01911a4, 0x66e2b9176a3e7076, 0x4cf811fd644d1d1f, 0x49c65a97b8001c95, 0x2c2003c1cb66a462, 0x4cda70ba8c75b2e3
+, 0x0942f989676a7312, 0x551298a6c2b7a031, 0x079c58ee930a6db7, 0x255087046c64e604, 0xffa0d9de0f091601, 0x26919c74132261e2, 0x81f4a108224cbb84, 0x01c21aa13da33d64, 0xc4d8550795e5af93, 0x1a8ba00911e94884, 0x50727d27947615b9, 0x08d9e3b05e57fbe4
+, 0xeed7e01b319ee494, 0x041a00b079a174a6, 0xe904d0b18564d861, 0x1f94676df5cd8531, 0x248140a704a448f8, 0x5f95cefe2f2178d6, 0xfdd81827045038ea, 0x34f1a720c926f9a6, 0x2f1051f542038545, 0x35e0ae9dff4917f3, 0x8ce3372e45fe0824, 0x133eb5af124aa087
+, 0xa7fc2091db28f870, 0x50cff1c818c64105, 0x90d10f7421d7aba8, 0x0bff8f99380bbfe3, 0xefc3835eb0c24b8b, 0x6cbd6b0cd9d4f398, 0x8a3dcbbb3b166f49, 0x3280118912854e19, 0x497b68f09e6d9feb, 0x11d2d682c2f7ab10, 0x91894df4b299e2e6, 0x32a9b5559893b531
+, 0xc71bfa245ff59da9, 0x5b24a972b3da0bbf, 0x53b125223912ad5d, 0x4f027e263ac105da, 0xf265c217d456257c, 0x6e70e3e9209a9532, 0x809d5d6f7a7b15ee, 0x05927af4543625d5, 0xae3ae3ca15e63adf, 0x778fb118573daddb, 0x9e508e04f9adf4d1, 0x14cc7cc60db9354a
+, 0xf793d91d8cdf3340, 0x72b214d76ec0e9ea, 0x1708723aaa26484e, 0x6d5e4037e9fb2237, 0x5c3b1b5cce6c0ba4, 0x63b948b1d2f2331f, 0x02268705ef12b9d5, 0x60c1bf271fd6c67a, 0xb0400fc64a18237e, 0x74bd300a7dba7e4b, 0xd570081e27c6386c, 0x33caff73380ff978
+, 0xb6f7ab0fcbff9f52, 0x785396419aadd0dd, 0xf9418f9960f06948, 0x1c8e1065f6ed4959, 0x005b33b771a7c00d, 0x5d8bf74f5c3efcbc, 0x7c6ab6399df9064f, 0x21c9d3fedc64a4bc, 0xd8766208bca9bf63, 0x617fdabfcf011acb, 0xe8509fa297d2bbfc, 0x3de4c90d0a4a6589
+, 0x7cf7c9ba777ba447, 0x4891959486dbce1c, 0xfedd85ed8eb7af12, 0x1822270ccccd75d3, 0xcadf604c68ea8022, 0x34a636389b312a0f, 0x700b443b238921e8, 0x59dfbee852a5d224, 0x51f2d19545fb3dca, 0x009e4981c923e479, 0xac4e17a7ebe233ec, 0x57ac1b33e5327d69
+, 0x050ac0dbcf64a256, 0x0f327dcd45dae126, 0xa5293b6aae95d959, 0x4d85261353c143de, 0x1cb2f8120d5bde1b, 0x1e267ca9b57f7366, 0x0066268efc4b4083, 0x32f45433196ba7f1, 0x687a2a8cc6d9c918, 0x3b3b63f2c34fefa5, 0x71639bd0b48c3951, 0x22ca954a79a25c28
+, 0x9f0444739b87e3cd, 0x51f00bd78079cd0d, 0x03cb1956cf49118c, 0x3cda59ee7d09f89e, 0xebdbcd3d15a4e2c7, 0x3fd47e4930353de7, 0x5aebf0ccd4afc7f7, 0x12a57db1a8f2dc78, 0xd70f81cd5da3dc60, 0x503d767a0841ac62, 0x964f794dd889f9ff, 0x32aea9443e170d1d
+, 0x3692fdb037041c1a, 0x47cb3a3e36d6d79d, 0x95a5fb27dcc8c96f, 0x015da6b36bd0326e, 0x4b4ad0764d174fac, 0x7f4fc86cd55acdf2, 0x7bdae5e090021e84, 0x338aff1f3d56135e, 0x4b89e9d93ac7358b, 0x5ced32e0d163420d, 0xdbebd032550c3559, 0x61fddd57e697bb23
+, 0xda2ea02962d9e15b, 0x460803c3327ec93d, 0xe72fbf78a667ca6c, 0x2cf3674c1d59f8cb, 0x4f059bc52c40cb07, 0x0227a19056dc625b, 0x85ba60e137cc955a, 0x18ddbbd81b9cc54f, 0xb709056eca7421e2, 0x05f40519c316c700, 0xda51b051e2310c9c, 0x3f83e42c65799c7f
+, 0x6059719131740676, 0x0c227b208e24b3be, 0xec27ddc4ff57d31a, 0x30649d1fc4376ad4, 0xda755088d12da1b4, 0x1aa22402185e8227, 0x99f010f322dc6fec, 0x09953b7ba68ec8fb, 0xb1ffca551bd7f7f6, 0x40584e622cd92764, 0x03e60a961b330539, 0x1e50c3e7a4e9e1e0
+, 0x38b99245fd966993, 0x007becbec77bdc79, 0x70972eea3fa3387a, 0x4fe0012d00a18ef3, 0xcbd7f402e8220eca, 0x7b3e59541f4abbf5, 0xebfd6cf332109679, 0x0f7235e1379ce02f, 0xbfb1b3329dd730d4, 0x71f24927e373aa73, 0x959b9c8818c1a823, 0x0e33bf776059611e
+, 0x4bc1896d870351af, 0x598e7894e4d491a1, 0xbb60a6f1b6b95dcd, 0x5cdaf99498fce161, 0x9bc98575b706ecbe, 0x220f8246fac09dbd, 0x986bd010206b345f, 0x038006226ebc6544, 0x6bf7435e5bf21cba, 0x5d55e467c29e4eb4, 0xf5e9912c6ea08063, 0x4efb35ee9450d7f1
+, 0xd1bd9a8589b401e8, 0x1442395fbd04ac36, 0x84da0f6b4a184552, 0x23a8b6540ef59deb, 0x4c812efe7e16b00b, 0x56db9f343f2d972e, 0xf2ba832fedaa98bb, 0x0cbc767113fe13ca, 0x7d7ce2839932a0b6, 0x062929eb9707b018, 0x32f39f9afdf016f7, 0x207daeb75a9048ae
+, 0x7904bff20e680e56, 0x488cfecc8bb05266, 0x98e23fc48373d6a1, 0x19ca2ba4186eabf9, 0x9b069f38057a0c10, 0x02c124fb6633a708, 0x5be3dfa1da7d6735, 0x218ee91c1a9e6921, 0xa338dd4b94860fc4, 0x7f6097e812903568, 0x3aef92efc52a364d, 0x61b8310bb82c2127
+, 0x6ff9098f4a3adc14, 0x2ce3d034f665375e, 0xbd3e426d2c26f1e4, 0x54cedcdfa1380b1d, 0x12d5cfc9baabadde, 0x687fafeb50983b6c, 0x62b3f93e234e2174, 0x66d4defe6198b6ed, 0xa969eb38eccb018c, 0x46d91db300ff419d, 0x8b73453e814262dd, 0x1b29f06c80124398
+, 0x6afd50463303c6a9, 0x5921af7589d995c6, 0x24ad69fc05b22256, 0x09c22805dbdabe22, 0xf2b43e4b629b4792, 0x3d8d9f6a2640f4b8, 0x10520df9daf8e12c, 0x37a689bb347d5100, 0x3db8a332185d1e8a, 0x11d2fdc38733932c, 0x28657e61a8413cfc, 0x5b65672457b8836f
+, 0x984c400f62c6a933, 0x2a6d876d8c7fa1f9, 0x982145be439ae903, 0x7a6fbf5a32c44710, 0xc77e114a262171d8, 0x6b394546487fc3b1, 0x6ba4121b276b0c7f, 0x3fe8f6f7c47d356f, 0x0f83112789cd32d7, 0x7ca2df9af6274eb9, 0xd5d1d25879514b72, 0x254a493008c10a17
+, 0x43dae5c1993794ac, 0x5a99342c84163e7c, 0xf5a4bacaf982763d, 0x380e23fdf04eeea9, 0x422bff478d054cd3, 0x12910098ad72b32e, 0xbf275ba325d9679a, 0x1a9a72b007e79463, 0x345b29031c3a26e9, 0x7f93feb4c6da4858, 0x5be7ae889e284a37, 0x0beaf8c2e2111d6d
+, 0x294737112a083a5b, 0x42990a7706bdabdc, 0x2fb67cfc7d528fc2, 0x645f90c044b6100e, 0x3ea720f7cace404d, 0x46b72f008eccd4da, 0x8aca2220e5c868e7, 0x7f89faf5e7a08d78, 0x5cac8fbda287edab, 0x192c1f5f3c69efb9, 0x18ae97abafb9997c, 0x118f23a21c102839
+, 0x3124d9d5b8e4a284, 0x7b6c5f743dead1d5, 0xea3595462e62341a, 0x08ec2b3aaf7cf03e, 0x824818b45047390e, 0x72135507048e7e7f, 0x4859225aa7b7baa0, 0x15e373065a182817, 0x2df281187dccb07e, 0x7eddcb66ecd08615, 0x6fddfe3092cdc2e6, 0x19add9fa35b3a649
+, 0x010c52329fe3a330, 0x17c4926c99f59a1d, 0x7643f221b1e0a440, 0x2a69f4c92b460c33, 0x1cfcc4680761f324, 0x4fa1b1c225c99d33, 0x381e578fb1960667, 0x487abc9aba19717b, 0x24586942c4ef47ba, 0x644e0acdad1d7268, 0xe7dfd40dbea4fa0e, 0x65b4d171be39b6dc
+, 0x613b7c02e55f616d, 0x14274ed9815d3ece, 0x369b8c3b654d3663, 0x7c77350f132d3dcc, 0x1ff374d1125ac8aa, 0x5c87e02120dbea5c, 0x852fe40062f7e95c, 0x71464c625351f090, 0x4d4edeeba8feace0, 0x56340fd52f8e08cd, 0xded75a75586cc075, 0x03ced8ab3c6b396f
+, 0xd73f38a69ea21216, 0x4571964fc3240211, 0xc397fad5c24df15a, 0x5573f2e1e1511801, 0x70127e92f78cf405, 0x24615b93f571ac96, 0xbfeb1a9eb2c29f9c, 0x1b05155c0ef1a0aa, 0x964d0dd62dd60df7, 0x562ebfdc3c7c1034, 0xd7ef45292c051abc, 0x330e2c447e5df54f
+, 0xb198c07e761aa19e, 0x2c6486d952d53779, 0x0bf810557c5eb2e4, 0x432aaf33155793c9, 0x192b1f5dcc7934fd, 0x2f163dbf510dc3b5, 0x08c85e3018c955a2, 0x27a3ecad91c0e6b1, 0x4afe5e7a6080dc8f, 0x4845b4095f71968d, 0xdcb067cc0a555d9d, 0x09113ef52efcf6ed
+, 0x78e55d046843b161, 0x792b08c1f46bf5c5, 0x53de40993ddbe3b5, 0x456385804d48ca71, 0xec63e3d72b0561c6, 0x37111cc1ece8ae2b, 0x36c09c9422677c21, 0x0673206b53f348e5, 0xcab139f3062330a3, 0x19918f11681bce62, 0x1c7898f82a94d14d, 0x66d414a3b766aeaa
+, 0x79310059a1f2559d, 0x704bebefd117f94e, 0x0458345bc3c063d3, 0x581253f4e36f9bdc, 0x019dd2e839d966f3, 0x532d6f2c2259cb1b, 0x1868c1a95ffee53e, 0x6ad9d020a6b0a075, 0xec79ee2bf3294edc, 0x49f2754d891ece92, 0xc6aff23e8b6e3a56, 0x23ac56e4c96495b9
+, 0xe862a2dc2ec305c8, 0x714a0eab5283f2a0, 0xebaf463b03ed7140, 0x2acec5466dd1dc9d, 0x51ef54b30fa8c5b7, 0x51658e229ce37f9d, 0x76515db996addcc5, 0x458a8e360bcde2f3, 0x38482c004f3bb576, 0x0ca34aa5479f9916, 0xee57e5be71d73836, 0x3412c9fc4b93ac6f
+, 0xe01d708a67fcffc2, 0x3df84010d525f7aa, 0x54e7ea705b8c2725, 0x7d458afc208f83c7, 0xc0953adee39e481a, 0x6b9ca6fadf40b486, 0xc40aba575d68dd5a, 0x21dac45ad422446c, 0x3c473ec722336a2c, 0x2ecb7c0648cdf1b8, 0x57500febefb1855e, 0x65160335ff6b8170
+, 0x043caec416debe58, 0x331a4016d5fc9d4d, 0x251951c2ad9ba7a2, 0x74571198b8103a10, 0xdb22e4afbb569158, 0x0906b2c65897490d, 0x16c8cc1e6832ee1b, 0x26b6001d6f58e1c5, 0x0e5cc4cf41075e09, 0x750cd3b3b4984d7f, 0xf00b6df32c33f8df, 0x203d92dace69ebbc
+, 0x68969c4b1bd15fb9, 0x3b8f1c5989686d0c, 0x0580654860b00728, 0x780edceb60f47534, 0x45e5ac7f5f729125, 0x06779b14e8dbe594, 0xe280df10734fcf02, 0x779903fc6eee1aaf, 0x296a59f73c84f877, 0x148d1c7c933e5a2f, 0x5551a731d8331deb, 0x7f71c4f72a13d99b
+, 0xc53ad562d17c726d, 0x504a1af96c3a5e67, 0xb7b35786672af9d2, 0x5a0b89904bd3ae7a, 0xd10498ced1c49d2c, 0x1f4e0919591621fe, 0x2305d300a7a14bf1, 0x076c4875983a3779, 0xaea3af321302da2f, 0x0c8764b88f61e7ee, 0x3b847b3893b1b8ff, 0x0e59d2d358570d31
+, 0x6c69c757c87087b3, 0x147ffa1d431a4011, 0x2f93fff1fb2c07af, 0x1ea4cae6c2b155f3, 0xd8279043c8ce4332, 0x20fc33d9e05f6a3a, 0xfb9cc6b1ae4cc74d, 0x2446a52968f3e322, 0xcf13a11ed6ebd939, 0x3f3fa9928e6ff167, 0x2c71181942e71641, 0x3dae956c8876d1a4
+, 0xca8807f5783673f6, 0x699445934929c778, 0x9099236557cf2102, 0x460efe50175511b7, 0x583f29f8ed098ac1, 0x70066d8c83e325e0, 0x39310f47bda2695d, 0x1e6a6cd30e94f5ce, 0x313dfb5ccf36db63, 0x28ef857ebee1b3be, 0x6b601a8bd7e4436a, 0x0d845846257e1c2b
+, 0xe01e1cc8021d1fa6, 0x5bb62431b942cb10, 0x24a90a6b773aca7b, 0x01f4845171ada87e, 0xc95429a7003c96c1, 0x174e02c9eaa76d99, 0x95b734c992c586d9, 0x6364c7d3ceb5c8eb, 0x8728d4ed2e3fb1d8, 0x2306c3c897645c53, 0x20c9a764acdc9440, 0x2589676ae908583c
+, 0x352c83741a18a8a5, 0x415a27b73418689a, 0x8efcb9987fb04ab2, 0x2298b1cef880e960, 0xcf8e0364b6a598cd, 0x4287c188ad165f4d, 0x75c04e858943613e, 0x6200de77bdf71fb2, 0x4f0c760b149a060d, 0x6b2f6b365de1077f, 0x443860406c44fba7, 0x245256ac0e990004
+, 0x28afb77b0f16b8ac, 0x11a75531eb5f47c9, 0xcd1df50131a38aca, 0x3e528f929bc48467, 0xc0635c12c3829653, 0x2448cc619922f6f9, 0xaa6de2b20884b331, 0x70db19fe1c04df44, 0xa9163df6f87b33bb, 0x6172e4de6e433e9b, 0x06ee09d26e3f10bc, 0x10ee072f858f3952
+, 0xb0cc8b146a3badd2, 0x043221cd603187bf, 0xf15fc75290108730, 0x32f2c5b8132af89d, 0xf62a953987125345, 0x1b319e0d2ff4710c, 0x9364ff62913184e3, 0x06a4360ba98e9f52, 0x95fe5103740f45ed, 0x205ec3e1bc7e1e51, 0x79ac9c71c50dd5c9, 0x7b406dc27aaa3fbe
+, 0x207d2d66e36ff4b5, 0x01610123c8e33152, 0xf1b1d8c80433d5e7, 0x4ac3b2ebaeba755f, 0xe3a48331859e316b, 0x158f43e9c0d88114, 0x334fb7babd2b582e, 0x1d9864907434344a, 0xd3d095d4c45af094, 0x2ac2d470bd82a43a, 0xa5f6b6f5804efeae, 0x6fdaa22fabec4f83
+, 0x4dfde000a2157a31, 0x40811fe30809cc21, 0xb2f89ed17d68f01b, 0x6e136062a4693468, 0xd8d8aec186d262ca, 0x08be510acba84fa1, 0x47ed2709d1b5ad5c, 0x2d32fd6971d5a35d, 0xfb46bb2e940d1797, 0x304cda099050ed79, 0xa1e349a264094904, 0x71fddd96b63b40ac
+, 0x5f9f9f653e6a6ba9, 0x033f7dcd99accd0c, 0xac687665fe3fc2d3, 0x5362e870bd3a4bc4, 0x12a80901994e9c7b, 0x4aa48ec7698e73c6, 0x65806a9f631756a1, 0x613e5a3659cfa37d, 0x0b1d1560e9dcf74b, 0x4511fd893c1570e4, 0x01782337287aef50, 0x251168ec167ae7db
+, 0xd90dad2a4c02ea12, 0x7d01e6fdc89e9d3d, 0x955ec71c6aa7e0d9, 0x43fd4814a5120288, 0x649e7d716d98ec19, 0x7f967a188dd21512, 0x26bd83d8da773414, 0x5c2134c5686cdfae, 0x8f3f276c4fbcb439, 0x376d4542935eb1ed, 0x7f1fcc0f3916d500, 0x29520b5308ef1a0d
+, 0x5fba740926cfee59, 0x4c9d8ab3ca9521c6, 0x00fda0cc8902725e, 0x0941c48ac015f7b8, 0xcd981a04a5941571, 0x6fe13b2553a460e5, 0x243bf4efba10f4f3, 0x425557bf666aa49d, 0x7a34ef2d3aabe121, 0x76df3fcbd2866d8f, 0xdc52be95133f0599, 0x15c5f426350cfd79
+, 0xadb56bb899b070e6, 0x78aef01834242e02, 0xfaaabecefe5f48af, 0x4a374f215a377689, 0x74a728631f11ca76, 0x16d44bc44b5e7448, 0xfb4279ed76e028e0, 0x3b664e49d1c799d5, 0x355c47a59f231d33, 0x775503cdee44d389, 0x47cc8df5885bb91e, 0x3656895866593ca4
+, 0xc8279498b4fa30a1, 0x4cc52d85b80050b6, 0x7f9e86f11a5dd705, 0x1f41695238195eab, 0xcfa901af9c772c1d, 0x3780402297e3aab6, 0x49fb2f22acd30961, 0x765be362621ec626, 0xd3d9e0d73e286bbc, 0x428ef1f83fc44284, 0x640f8f491454a230, 0x06eb6632b6ffb936
+, 0x720609a0f0ee3433, 0x5af7e908afb16693, 0xbdc532cef5ab49ae, 0x1d4d3eee7581ea74, 0x82a4c1d5c58b0cee, 0x748d4f5354222b6c, 0xfbda7a971cfafb66, 0x6976986f86162fe0, 0x86cb28396f4c21e6, 0x0d9aeff48482d359, 0x7505b441d6a5d4c6, 0x73028228e04793e0
+, 0x54c1316a83905c27, 0x20f988187b8f2abe, 0x585d0538181a1068, 0x3305b396a07bed77, 0x008b0bb99b3d8941, 0x348fe44b48920b69, 0x4474d93872f2032a, 0x5833f1d216a34ca8, 0x0493769b5ff50a2c, 0x572d17e27f2241f2, 0x519b965dd8f81570, 0x7823fc028d92fca4
+, 0xa48d67fa92407850, 0x1164c49dfad21635, 0xab30fc443d78fa40, 0x76d52d78c49be464, 0x909eaddd47c03980, 0x61c0c6c180467ebe, 0x39c0a149d548f5a2, 0x51eb5c6371087f8c, 0xdbd3641932ed5b38, 0x5de6b20d11f252c3, 0x8037544108dfcd96, 0x6d7e2ef851651d90
+, 0x7efbb4d4822d3253, 0x4d30801c425b11a5, 0x7e813fb8072d145d, 0x183675e10ce22463, 0x911e52ec608c2e20, 0x0bc1a1d0e2e792ee, 0x36dc7c5ebb5eb9d0, 0x002ad234f386a1b2, 0x38dabd5192841784, 0x0db082e5ac07ae08, 0x38baaf540cc21565, 0x09010be628f816f9
+, 0x55818b4dda7382b4, 0x293443b0499f605c, 0x938c27652d23ef26, 0x4c25774e4f6452b6, 0xc8fb572a3edaeeae, 0x2fe1a21790b1a974, 0xc108ef0387995a2c, 0x36ef1ec5286f932b, 0x356ef3195ba4c88c, 0x5ac2b17bd0c24698, 0x11ae9b961fda8cb5, 0x0b49568f7284bc08
+, 0xd70278e1dc8826f4, 0x4e6484e059c0b874, 0x1d825686112b7c46, 0x65664224ef80538f, 0x274120002f43a9f1, 0x1a7c245e2bcb708d, 0xf68dd457c45fc4ce, 0x33da6d500efc83fa, 0x2c11ea852f706db2, 0x1df3d84f3daa8c40, 0xd08dee56c7188287, 0x003fb42ed024827b
+, 0xbe238445afe1c225, 0x60d10490910cd67b, 0xcfa3ac4198599d40, 0x3aa123c4d736ad66, 0x6c5b98b5fcc0bf24, 0x672c95142056968d, 0xab60296f15a8494e, 0x1407ac54be75ddf7, 0x6f53d662c9060d62, 0x0a7b0aab55e5743a, 0x078e09915cb237a0, 0x1ef8cf0bce4cde33
+, 0xd54b9a6e0e7252bd, 0x789fe445347d7ad7, 0x011dba2702243930, 0x3c975499097521c5, 0x2b2fdeb1331c7d90, 0x6def5dcda7cd6c20, 0x029173b5b12463e3, 0x135cb473915300c4, 0x381e46cccd8ed988, 0x13d9ad4b3cc35165, 0xc4a6f00a8474975d, 0x418c72e61f2e2683
+, 0xaf4eecaa6ef34878, 0x74b0c93adeb66e82, 0x3bc24af2922b149f, 0x797b681296020173, 0x7bb24fe873ede9cc, 0x61213f7f57472e86, 0x353f5d39a9dc6534, 0x343cffbc1b383e47, 0xa50bce00f048f737, 0x15394ee34575ce50, 0x6eac36a5dbe2f178, 0x601e8854312a0e4c
+, 0x5ff1f2bc16660703, 0x5c6e626143ab116a, 0x0e7e698dd0a8d47e, 0x36d6db2d8093f7c5, 0x4c27088f6e01360f, 0x5e6d6298beba59e2, 0x1a6e2b5966a1c6ff, 0x2e42fcdb09da23b9, 0x1e235d54f46b78e8, 0x382238efb6568b85, 0xd3566aef6f88a8f1, 0x5322195f243f8a33
+, 0xa5e7699bb46ee35e, 0x65f9734968b58aaa, 0x35e12de1482920c6, 0x0d9bf175675e6ed2, 0x7c66cd386f5fb260, 0x028cb267c6c68560, 0x8ef409493e1f104a, 0x1c7428eb862f299c, 0x874cbb66a42f86f9, 0x12c4a2302bce037c, 0x5e70d1e8ee628496, 0x144569d5b621f114
+, 0x9e4a2cd7a5bd2441, 0x6ddb094bb1acf3e0, 0x18d637c5bc31f1c7, 0x67f8a881a156d18c, 0x559afb08ac22f4e9, 0x58c0a372b60a0733, 0x8dad1883fc2b7d77, 0x16bdb6298110cfc1, 0x30c6905ed6fd44cb, 0x73792319c051e380, 0x845e99b669609186, 0x402d55e6b934447f
+, 0x25a41a75b2d6e586, 0x1c85a3cff14bb2f5, 0x2bec73048eec4d3c, 0x75aba9af8fb728b0, 0xdc8137011f544ec8, 0x5722e578d481ff40, 0xab01734a3d7f5b39, 0x1ce087ffb557fcb1, 0x3c6a55f572a02a8e, 0x4fb653d945b7861d, 0xd2d231e38bdc7d85, 0x2739c015356de9f3
+, 0x8eb2c6dc26df1ac7, 0x296ebb4ab76a98c8, 0x8f1da3ef0b920f15, 0x0c1768b49a3e278e, 0x794968d664b71f08, 0x533cc6c82d3e7455, 0x151feda9011061dd, 0x7ee5f245952a4a6e, 0xa02266367ddc8ba7, 0x694ef740b563b0c5, 0xca073cfa556e00cf, 0x392c3fe1f9f8bb4a
+, 0x8ad7f8d323b48c7f, 0x2f6ab4bc3dadada6, 0xfca1d1f001c2a891, 0x08bd53f45a5bbf79, 0x1cf1c3c1ebc91794, 0x7883eb1b6b52aba5, 0x1cc290fbed06ffd8, 0x5e04f9f9b2c79b25, 0x0270ceebeb6609d7, 0x25cf1af74153b160, 0x4a88954ed7a71f60, 0x35456f7c9a4521db
+, 0x26f91cb9c015babf, 0x3af79f5869b5c455, 0x2dcea685a39c64b2, 0x7e974db61a115823, 0xc48a60016b8b5a32, 0x77e41500b86d6347, 0x5780af2e682d4bd9, 0x246adc9ffb0a865c, 0x625c696848d43beb, 0x1eb075e851b49cec, 0x85c10a8d0d03f8a5, 0x46c34a3a39dabaf8
+, 0xef91c2ecb45ac8c2, 0x174c0f74ba38a6dc, 0xdf072e9dba69ba78, 0x5c0f00d2ee803e04, 0x727fa8479d70de99, 0x254045eba2061481, 0x48123207c0fd1abd, 0x11a242b6a8c58e89, 0x9e265537ca4071f9, 0x42c93d901f0f7117, 0x3afa16f97c4b6db5, 0x567c4c4bd87dcd11
+, 0x868a398440e675c7, 0x43d96719d348c169, 0x468027b8bbbc7356, 0x22ee9637948de56f, 0x540ffc58670720fb, 0x3d0e2ab674be27c0, 0xf02948d59ff6d515, 0x38dcb8b257f93ab2, 0x08297b851aeca54a, 0x0ac456d5345bd563, 0xd48cf315da965a40, 0x22aacb86e1111309
+, 0x31855de59510871e, 0x7514b71702968e39, 0x6783577ab449f7e7, 0x171a36df68da3d2e, 0x70962d373f538fe5, 0x4f3f9817fe3be1f4, 0x01a86c8805a4f7ff, 0x1b1e7139798f4fab, 0xf7490a0b035e3dbb, 0x125ed25cdac5f667, 0x89990fee75d84894, 0x2799dfc5c73955b4
+, 0x3a2cc67a566a71b3, 0x1f5d7454c904f1f9, 0x298fe516d9b4807a, 0x1a92001c388fc2c2, 0x421732190522e751, 0x1065517bcdae29e0, 0x262059085df7e759, 0x05374592cfe6cdcb, 0x5a0b014552d62652, 0x05f6540f6f56e712, 0x4250a241a203026f, 0x629fc4f1015706a8
+, 0x427ef0ac63cc4fe7, 0x75285b09814e27fd, 0xa6ddd0300478c932, 0x4d5437329413e79c, 0x02986e0624244dd9, 0x67d91f5dbd7706a3, 0xc00a7e24a0bcd677, 0x604ca7fd6ac15435, 0x88763a199933862f, 0x05b076ee54ec2ca2, 0x78c925c5aabac562, 0x0cb203d3ead5141c
+, 0xd77ee7de4f137ea7, 0x1ccc6c8672399a42, 0x694504bb52561511, 0x255649d7885392d7, 0x1f513c0e3991d9e7, 0x35d52562169464f5, 0xee104b366a115ddb, 0x5a550aa312a84aa2, 0x713efafc7c51ea6b, 0x76b14567b60bd66f, 0x6ef784db3e5d9d5e, 0x54f591f3854a7c8e
+, 0xabc41a04ecb7c4c3, 0x799e2cadc186e5fa, 0x3b4011b7e5b0ba21, 0x5601cba49884858c, 0x44264790e91f180b, 0x72a8daf70c3a3fa0, 0x7d52e335b6e53fea, 0x23da08a64e5d48fb, 0x3fa36e662c69dda0, 0x040cd6a53cc5fce1, 0x31c2c56378bc8851, 0x4ef3d09417bc8359
+, 0xb3fcfa9fcd3d9f9f, 0x37b40c725ca29d38, 0x73574135f4871b0c, 0x69c413e49986d20a, 0xce131b5b29705e4f, 0x4b88e2b4b5ffd343, 0x4093a92bc7b7894b, 0x033e3b761191173d, 0xbe92e7f9a977d8f7, 0x5d140e430ec5426d, 0xa895767753e3440d, 0x582c98a269580e7b
+, 0x4624bea9552350a9, 0x689b4b9acf2ece31, 0x20202cf394ef8e3c, 0x3b1d478280794f18, 0xa18a6e39b2740bb4, 0x5805e5eb6c76544b, 0xfcabb6a40dd33014, 0x2d57e166ed732f57, 0xa96d386f74a0348f, 0x3a1469121a848477, 0xa942106906da67eb, 0x6769bbab2f59e72a
+, 0xf9c531a244f0f07c, 0x215da71700c9e37b, 0x367fba8ac5cbe4b2, 0x1df0cbfae710794d, 0x2fdea708998631a8, 0x21703659b36a08f6, 0x454a74979eafb903, 0x41b705a01fa90bae, 0xde841ff9d97275e9, 0x3b700c810957c0cc, 0x3683413eebdc674f, 0x23f3d1d185678d8c
+, 0x4dfd83361f5004bb, 0x048f4050db5e3a84, 0xc42f4ec4413c212a, 0x386c31b45253a6f8, 0x91d31eeb0fc317c7, 0x63c8a43f7448e20c, 0x04690ae0ac59b563, 0x14c5b54bc54a2688, 0x836bc5e5d7506be6, 0x33dc1f4bb7f80234, 0x8c31c7f2a5997cb0, 0x4bc4f007a917c3ad
+, 0xd646d4b8271262fa, 0x5b0844df92023611, 0xebf88cbd1a867e07, 0x1253d6163b65a3a1, 0x8eeb40079b98567e, 0x4e2692f5508cd46a, 0xe54e608f071ac28f, 0x062a531cf96d7cf6, 0x8e7de413ee771342, 0x29cbba48af1e75e9, 0xde2813ef8e3a69ac, 0x79182f59b926a499
+, 0xd673869c61b7e7b7, 0x756fe6ea29a59840, 0xed77a5e35a3e0dd1, 0x707b1a533bac2b78, 0xa18196553f22bb6c, 0x4236ae76093707a1, 0x57d2315e611fd484, 0x1b3e45b1f1411f88, 0xf69c60c41099a940, 0x2f5eabce4b3848a5, 0x8f8e013f72c03fdb, 0x562b9acae83bb774
+, 0x24249ce52fc99d63, 0x599901566ec63f6e, 0x2962d02304810137, 0x47db459964ecb372, 0x09a9d3d1c11c25d6, 0x329958ce8869f7b3, 0x55e0c76bf736f756, 0x652234d74503134c, 0x63d2b95d97a22c04, 0x7161c5c67b537679, 0x0de3408c140dc000, 0x04b89be7baf4c94a
+, 0x034dc0d53e5826ef, 0x1080af4f6be9ea4b, 0x6d209e071f696609, 0x7ddadbe2b698acaa, 0x5f4d42c25e5e0a00, 0x7f24bf8ae4497d87, 0xc1f922ea8e59684c, 0x3d184768d2da1db4, 0xee39f22381e89aa5, 0x70d85c5c3b1bcc53, 0x12cc42e9c055e4b9, 0x24a38c455dc129df
+, 0xea6bdda48e956f61, 0x5b50e6884b084655, 0xf7a6b0628310fb2f, 0x46bdfd087ffe6c54, 0x14ee2a563938800f, 0x31245bbdd4907b55, 0x14441e48b66780da, 0x0f58d4acdc60342e, 0x2aee393cc6225c65, 0x19ac9a29b3c194ae, 0xd8b312bcc02ad90e, 0x491faa1334c399e7
+, 0x78ed4077ba9a20a1, 0x308a20287c73b5d9, 0x564075cfa266274d, 0x7f059d9946ee062c, 0xe98a10ff6e561b4b, 0x34234020fb2e6fd6, 0xfa16644f96399531, 0x6e191da1e777c601, 0x5874399578d9dbe1, 0x15365e952a252a90, 0x45060e26828fad5f, 0x646f24bc2124db70
+, 0x01f5925e304a3f5d, 0x0e17b5c82b9be87f, 0xf340e8cc337cfefd, 0x4e1ad060ec9d9a24, 0x61ebefb443f6cd23, 0x5ac373d891edaa60, 0xbc2b3a0a0adf2432, 0x586adf9249a6573f, 0x99ac35db714da575, 0x4dcd2b1b8aa73be9, 0x68edf766944e3b89, 0x4cee185632917e9b
+, 0x7272cb371dd3a350, 0x3392689200e670b3, 0xb98212e73d956e01, 0x16ae7d0fbcc70806, 0x0f3f81da4194185f, 0x7753ae90744c2294, 0x5d1aa2b7d89e2605, 0x6654a15cabf4bb31, 0x55d4807382069215, 0x42bd316982a44da6, 0x6ebb85136dda2518, 0x5b70378318086ab1
+, 0xc7d55824e4ccfe5e, 0x1f94f73eb7917dae, 0xdd792844dcfe3f98, 0x6f209cdc673f3a20, 0x8d0e1e9ec90e81bc, 0x6fbc126b68ba1342, 0x03fdf294c3fbfd81, 0x1b68674f8820c320, 0xf05a962ad8ca16d6, 0x505e2387afcbbd73, 0x131e19c5d3f4cdb5, 0x30ecf9da4981224a
+, 0x5aa393cb5f7526ea, 0x73ebbf6eea13703d, 0xaa3d7caecc05d674, 0x0e06d9c4ce2ebbd8, 0xe881803487614b7a, 0x393dd36d15393b39, 0x45ecb5fa225a1fad, 0x78a45f57608c763d, 0x8929153dcc07f0c7, 0x7feab9dbd81d75dd, 0x63ab5d2a2cbb6382, 0x25bde6ef74e29d9a
+, 0x3333c59f361035b2, 0x556baf092c6121c4, 0xe2ddc35af708c81e, 0x3fd4d764359c78ee, 0x5b4d7b8cb47f6933, 0x4bbfd5e4c5dae582, 0xf15443621e47dd34, 0x0e61753464ed7eeb, 0x9f810ae1c0d2d1b2, 0x62e4e6d502925971, 0xaa4baa1652ffdf19, 0x24c671b032340032
+, 0x3af62281093256b8, 0x308768de8082ba72, 0x7629ad4cbce8250c, 0x7fa0654c6dde546a, 0xd3ff389b9bb54005, 0x4807df14d8069557, 0xa4fb60cfe1032c8d, 0x31759936d6a077e7, 0x81210003f49eb6e1, 0x6b8074c58867dfcf, 0x824c132b0afee330, 0x51620c30b239337c
+, 0x4150b33a89bb79d9, 0x57cd87d8cee1fe8d, 0xfc840f73b74d143e, 0x6285b21f3e01311d, 0x3c87cc479daa4ed1, 0x17d884581be2e889, 0x9f31ae30b06afe11, 0x6093b60a7a74059d, 0xdd8e1434138186e9, 0x14c7c4167ca9a255, 0x3e6ab71816767c43, 0x1e77866d1ce8996e
+, 0x90cbe4aaf890a201, 0x5c8c1aca7bbca8d2, 0xcc72ac76bc050ec1, 0x004c35f4d9f9c4e8, 0x2eef496b42e42a1e, 0x382327f100df8ff8, 0x57afa3f79b18c8c9, 0x0d709af4b23cb2da, 0xb2c88417da0c203c, 0x1d9be1cfe08b1caf, 0xdc76152364995096, 0x626a323bc2099daa
+, 0x5dcb42b0f6696e81, 0x5622b7975c2133c7, 0xe2c5c622d4e2c430, 0x1c4320b8f109208f, 0xcc414e9ac5cae247, 0x2e699153ed19ca4d, 0x32ce99c9cd5bf46e, 0x40f6e43644b07721, 0x1fa793ad0ea48eca, 0x041ec3459306e266, 0x7b738a89071898b6, 0x7d7c558945ed9e4a
+, 0x31b7b6e34da507f8, 0x6461233bdee599e4, 0x4d5ab65dbbb81200, 0x388319bf88d77e5c, 0x1ac7f34a1d3585f0, 0x28f3ccf7a66b608a, 0x83fdac3ac84f313f, 0x157a059d72680ad4, 0xb43d5a0de33dcf49, 0x2e8ab6b3fca229e6, 0x691a46511a0a0782, 0x38a07c09bda0d931
+, 0x655634818e91261a, 0x3225a8c662efd57d, 0x77f50f68327453f4, 0x3e2f7cb3c9ee5930, 0xa6f113acbba1f373, 0x19c87f752b0c4fac, 0x413aa8a01f13ccfe, 0x0965a35092dfbd77, 0xd89b174358b53955, 0x43fb27323653fe60, 0xd4cfd8ab6af281ea, 0x5769ab58cac7b442
+, 0xff98f48e88198f9c, 0x50e6ebe64655a9a9, 0xe8f7629abf11f0a8, 0x4a7a8cb30bcdc7dc, 0x830ffc0879cd37e4, 0x3ad53ecdc62e0170, 0x3171b1f123c6c3ef, 0x1926e084b5f6e0f3, 0x044c7ed20f131c80, 0x107da7fdd1ffaf4d, 0x4f2d46d71c2e6452, 0x009d25525b5fedc7
+, 0x4e074d57812d6e5a, 0x6affd810c0a85b2f, 0x285862039365fa1a, 0x6d30b472425cef18, 0x01dd95e905a70648, 0x1ea04f4ba9dd6285, 0x0bc3bbeec5bd5b9c, 0x3eeac27cd70ad9f5, 0xecd80e5329f2bd99, 0x4c7d950819d0c2f7, 0x1be7e9f30ef6aa67, 0x5cd20f147918db13
+, 0x0ba08fd1687d9968, 0x37bebda726df3bca, 0xe608fb55d84a9c90, 0x088bf3c24b13e0b1, 0x902b4819ba7c4bf2, 0x40cdc7c04a5f9b3a, 0x385797b96e0c9769, 0x6b98d49a46d22e78, 0x7630772e76da1a0c, 0x088d313d7113fbe9, 0xf4d2ff63faf15fd2, 0x0af4f30e651b161d
+, 0x37a1ca0f831cc853, 0x58ca1dc10f4b19aa, 0xb4beb670705bd7de, 0x56583e4c4e91b41b, 0xdf96c6055dd23433, 0x1001e1dd32950260, 0x56ba465b6e1013c1, 0x31375bb3a0a2217c, 0xcc7c27578c3beca2, 0x343fef05f13fde89, 0xe36936c89e2db81e, 0x3680e8c151dfdb93
+, 0x9989e07d5e7dc048, 0x7f474787ac8929c4, 0x11fdecf1b319ef56, 0x571b3bf1b9c9664f, 0xd981c79f6cd0d6c3, 0x693eeeebb79534b5, 0xe566678d99aa59fd, 0x47b2c2e95e49acb7, 0x152bd506ec0811f5, 0x1a575726a9c6da85, 0xf70815bd8c589cd4, 0x5bc84bc4b2a25ef3
+, 0x0bc879024cfbb071, 0x740997c093b89c70, 0xcce7bbf78aefa9d3, 0x0f53a1cf8d5b1818, 0xde258244e48327bd, 0x2e566a4aa36bb1e2, 0x1946a9212b876ce8, 0x1da80b11a4d3003f, 0xe21a74ccfd39664b, 0x10a935dfa620e6b0, 0x8191c5ea4cfb8c22, 0x3e394bbd04be6eb0
+, 0xeda6dda2c3d0f821, 0x38e3230465750423, 0xd580caed2aaea749, 0x483ddc588de64824, 0xc76aba36ea8e5447, 0x7f30ca34d64b8950, 0x89858b3c264ebb1d, 0x4eaf0fbe05c692ea, 0x5cca7148fead8866, 0x285ef1b70a9b6f7d, 0x6aaebc04c168da57, 0x5c48e3d8ed8ee20f
+, 0x42b129454035c401, 0x37b17c20a89e50e3, 0xbbc8db7180bdda03, 0x1fdc00232b2b5b4a, 0xb14ea9752dc90702, 0x573d2b5abce11406, 0xab3ba9fce2d99bbd, 0x5fcb0c538255c9e8, 0x5e3dd012d4a12263, 0x3746e128862ff406, 0x92dc0d5b63eef11e, 0x04ff9f86497b5774
+, 0xc385964b55358461, 0x156422ce203ebfee, 0xdd199391c225dbe8, 0x5fc7df59991143a0, 0x5f0e2e3576c1dcd2, 0x6e4a9a41cc847d0e, 0xd267cc63eb05fef3, 0x38be7444b072c49f, 0x0937d56f056c0062, 0x262dd2d8cb07ba78, 0x57f3d1b5f4176090, 0x5dd5d6e1001b4628
+, 0x7bbeafc5102256bb, 0x13381f74eff93f1f, 0xace5b84ec104dcee, 0x428a099ba3a389b7, 0x2ab20864047bc2b3, 0x4b605a3fca3acdf0, 0xffcd723ea5edb5cb, 0x70b8ab78d73616fc, 0x27299bc2b046c7cb, 0x0aafb88d3487d08a, 0x39f40c7c26e2012d, 0x4af0dc7ef0c704a6
+, 0xeb36070853f4eba7, 0x1ea45284d02bc96c, 0x0dc1035dd9310488, 0x187d45401e4721ba, 0x4e12babea1376214, 0x76fe5fb7430fc1f3, 0x02dcca8e3b3b32a7, 0x419a4822917dfd35, 0x130c2dc307d2e1d6, 0x19d4f4e4204b7367, 0x8196ba2794a9d636, 0x0807d5a24719109a
+, 0x6f2a31e86d3746cc, 0x2143530e8237c724, 0xc60c6494d7c902e9, 0x416bd193e3f6998a, 0xc1409ed61e437ac3, 0x084f735602dd057a, 0x9f808b3ee427ce32, 0x7b7516b34cea0063, 0x41dc3956f7c0a02d, 0x6f3fb0b9803d0c7a, 0x1e82c1ce706b490f, 0x6c6648bbcfea644f
+, 0xf45276f37f393c97, 0x0d87489afed3b058, 0x4ba50fa391016195, 0x0537adf0573e70c9, 0x4dfb5451cca20451, 0x731586663980930e, 0x11a2dbac9a9854dc, 0x5317353daeb3ca8b, 0xe2a45371ee0a71f4, 0x065b738c59318814, 0x4c228def6d792c50, 0x3d324dc185d92fb0
+, 0x0fef141d9601a027, 0x359af0c26fb4fb60, 0x2dc49dfc438d95dd, 0x5bbea8df19b692d9, 0xb28b8796471cbc34, 0x3e93924cb334b211, 0xdd2c667696cdc985, 0x3ac1113aa2dddf7b, 0x73b482e026dbc8bd, 0x66c0dd157ce09db6, 0x9ccc0c0a2498238f, 0x5286ffb16c47ff21
+, 0x3e0168176a36260c, 0x69cbbe94bde4eade, 0x493e133bbc946809, 0x1b5ae4afcc77d42d, 0x21ccee03b2cc4539, 0x77c7b58816280edc, 0x4ebf73062ea58449, 0x6f15b3a63bf4bb39, 0xbb57ff4adfc49f08, 0x5c915a80406a2e9c, 0x4a6b1f1661d8f8e1, 0x6270b6f09a7585e3
+, 0x923a8bd41ea4f887, 0x2fc156f8690bd5f7, 0xb66dc8ea91d5e45d, 0x56e3669b8cb502fb, 0x6ccb78172e30802a, 0x5d6cced1eae959c5, 0x197ca8e74599e85b, 0x0be4986a099d509b, 0xd81221ad54563438, 0x3783f1dc12d9da1e, 0xba230b6168c0f077, 0x453af9935a85c97f
+, 0x6fc0f12044398c7c, 0x7678f395c978f0ff, 0xb62bfdeb7a5b0ffa, 0x01b67a8259c69908, 0xdd509e63d170b876, 0x65d13b512240065d, 0x95b052484ee73911, 0x74bb124c67684d37, 0x97a6090c6e1cda24, 0x0530335e5f82af0d, 0x842e1417508adf37, 0x4a2c70839ae9a118
+, 0xc5b3c7e6a2e30515, 0x14295bf4d693ebc5, 0xbf94b53fbf8dd6ae, 0x34c72ff7853d22e2, 0x51ff176b278b4cf4, 0x0769446c8228fffc, 0x895bf3433be6b21d, 0x614e883d3d0fa52e, 0x45aa9109934692c5, 0x503126e5f9dbe476, 0x83da3fe4092f9892, 0x150a37e1cb53a423
+, 0xca949aeff9d2057b, 0x5e9c796062d274fa, 0x209ff6bbf0150c9e, 0x5de9ac94f60422a0, 0xfbfa63a0ea846427, 0x6ab15f3c8f26e1ae, 0xd33fc0d493e4ff0c, 0x1ecaef87adf49c16, 0x4d58f520301ea945, 0x0df6a26a9858673a, 0x137e989f663d4be9, 0x0766184595ee176a
+, 0xd69ee6114fc4cee2, 0x1015dc6d127a3959, 0xa3429e5cf2b9a32a, 0x4b162a3c9ac9e505, 0xb81f54ed06bdf7a7, 0x56badfb5b306f1e5, 0x70c734d063205263, 0x730c0b9f4ccd6cd6, 0x48a1de1800977da5, 0x31b01dd25142cea6, 0x7c0a9a792d07b744, 0x202bf6869f43f0f6
+, 0xf5665f4500d945d3, 0x0e68b0c935cadc6e, 0x9cf18c39cfb05678, 0x60f4e0281fd4a93d, 0xebe036fc2ca4d946, 0x25e02c266975ba29, 0x833b0f523d49e6f6, 0x2524bc31b28dd80b, 0x2304a8717780c4ce, 0x1549c7fff20da29a, 0xca1b5015eeb27560, 0x6d8399c45c0366ac
+, 0x362c8ed0b31a25c0, 0x5d51721a697074f2, 0x95304006683fc055, 0x1a05f008fd687971, 0xcb4d61a2a59aa982, 0x221672f6c3f668b8, 0x88870bcd5127955b, 0x3e626dcb83b8c53f, 0x49de2044a5777391, 0x68dbf02686a7fc3b, 0xb9a4e054b2febf11, 0x10d5b4cd738bcf4c
+, 0x5099dd3ec9283636, 0x6673fd21da3ae777, 0xb6d4dde476405b8c, 0x5db360c1b48e8455, 0x91a5c54e2b6687e1, 0x28985b480ed7941d, 0x5cb85c0f2b8434c7, 0x52a40d50caccb493, 0x482439d68c62521d, 0x04addef8380e160d, 0x7c81b26c2253ffa9, 0x523346f06cb70097
+, 0xf5969a0c6bb6f365, 0x096ec9bd12dd0de3, 0x0cad949cdb198c79, 0x09199a94cd0c3593, 0x4864021fc727b7c0, 0x44c231978ab3b4ae, 0xe6f26dba2e67b8fc, 0x3614045780be5f68, 0x5f655c855c9fa2ce, 0x6f6f3bd580209968, 0x48a88ec5fbccfe44, 0x7849074a44c7855b
+, 0xbebaf9e8a7ad89e2, 0x567e625ca25f21ab, 0xea39acfb35181ba7, 0x3b8cd45a62021e85, 0x561c2ec1b1e3d7f1, 0x3e9919c009da7db3, 0xb461324e6bc08ffd, 0x7db3ec4e7a6c2ad6, 0x621bd939910d5d46, 0x72a4ae24eec623ec, 0x409ba48271e76a66, 0x7340741ad236397e
+, 0xd070ce4932c6167a, 0x622ca670c9950f56, 0x7378e895f00116e9, 0x1bea63fabb4a4319, 0x9c6f2c1652a1a19b, 0x77ff3f9a21c29154, 0x1892dc7cdd3cbc69, 0x26348328e2e72c65, 0xa618e9a7d4d2ec19, 0x1cf283725c999818, 0xc3bafb9232454dc1, 0x03e99eeeff0cda0a
+, 0x7721e2417feeb400, 0x5d2fbc974cca84d3, 0x0338d1a5ee23eaed, 0x4c3900aa78a0efe3, 0x6d33bccfbdf373de, 0x6c55c1d1d097fcbc, 0xe29a3b76b5d9490e, 0x7047b34c5917c7e3, 0xd66badee9ae75628, 0x5f7cb9351b16304c, 0x307732718ed2dfb1, 0x6c1c9f7d920c3d66
+, 0x9556b3d1088f8e91, 0x3c73cf4d53bbdc0f, 0x3554f5f0f080e0f1, 0x73701f35652662dd, 0x2347c15aa273c015, 0x02e98d3d236badc3, 0xd28e98e43c4743e7, 0x0549cda3ccec7ec6, 0x07a3d2858eefe33a, 0x7306265d7fee26af, 0x3b4dbe86837fe416, 0x775a17a0de3cfec5
+, 0x26b6cd452b335b9d, 0x43d379883bdd4e2c, 0xfe952c0bfe76de4f, 0x6daf79cc17387dc0, 0x490db87aaace4ec3, 0x796a60d2b911d0b2, 0x4a1d7cec8b715d72, 0x15ef3362a3d3745e, 0x1eb8777cc98ab1c0, 0x5ee750455ce523aa, 0x4b04b2077f1721e9, 0x0fb1f58cb4ba60fd
+, 0x484685e82389cc64, 0x404a738772847dae, 0x466de94fb21f9cbd, 0x76212cfd4e1ea5a2, 0xf9b89872f778409e, 0x1b0839b62204dbd5, 0xa2ad9c3147eb1b3d, 0x50ff0945a475beac, 0x24cbb040e5763d6a, 0x57a58f3d30788a32, 0x2d120529b76bad49, 0x132a3ab7fe11e54c
+, 0x0b4172cdbddd3aef, 0x2e16eae61ca32a1b, 0xd3f58f40820638fd, 0x4e1bf4e8c73b87e0, 0x62780c8d3ed6d5de, 0x3444a8a2bad380ec, 0x8097c8e8fabb1f70, 0x1e62073d1f54857c, 0x2b5222c6ebf6c967, 0x7e2476d21e2d8945, 0x57e4f7dcb2a2fd65, 0x537fa56c9abf3a2b
+, 0x6c0a60cb7d6f11f4, 0x43d5d6a23649b147, 0x48d83fd66d99a05c, 0x47b79faea0d88717, 0x8b9eec7a7983f988, 0x78f9891165f875b1, 0x126e44685aa902ad, 0x38aa898e2e333937, 0x4b8fe9d969507278, 0x393436c2bed2f7be, 0x94e524222bc19239, 0x4b04624b4c66f3c3
+, 0xd0de9f43b6af8ea6, 0x31a2403af0f349ab, 0x0ce23c2fe9e644af, 0x24bdd9e538b52da5, 0x02ddc80abdfe2c2a, 0x05ba0b9c7d0129ad, 0xa51399f0ffbd63c8, 0x27d0e932716ef856, 0x8b5e7de78be15804, 0x26d58294159ca88a, 0x1f2fc75d883644c8, 0x6e0136bb4dfea3a7
+, 0xe0ca02d95cdf7608, 0x608e969b5fa409e4, 0xe3151d45b5e0fd0d, 0x0a7f94c49ee43f56, 0xe7ec15915f6b6420, 0x7c73c5eef01904df, 0x0ab082213126fac4, 0x3bc81f5992459359, 0x13000f18a3fa3ac4, 0x0a7121fa173e1738, 0x9c2e97a05d4abb1f, 0x3ba367b683f74006
+, 0xaab2a33c583d00fe, 0x18707a935e4c550d, 0x989e9fa48822da49, 0x570e0621c303d9d0, 0xe4eb01ae6366e7db, 0x30fee9c37c0c08c3, 0x3e9f4431612657ce, 0x70aabb592d6742e1, 0x3b3e8df7616f1edb, 0x57d2bccc4ef9ffa1, 0x54345d79e3ed32cd, 0x4e08a827383eaad2
+, 0x9d45e06b94a3306d, 0x580de00d3b42446c, 0x1fd57161fdf0007f, 0x1ef3c8911c48d56d, 0x9800e0e1f33c6492, 0x33c28c4de239f41b, 0x3260882b724cceee, 0x76034b9cddb6eb53, 0x993d8ab00f6db936, 0x6d3e430ff06bc577, 0xc252eb498de5ae7c, 0x38415de68bb6fa99
+, 0x8a2e12aa94825762, 0x5a42282a18125f2c, 0xb93f992cb628b4ee, 0x101732aa6a8cdf29, 0xebc8093f92aae9c9, 0x1f401b09326003fa, 0xda6d0521853b5c43, 0x03f2e09d98180cb3, 0x82e952305f94e5b9, 0x783c4a5799e9dcce, 0x9d1c22477d747acd, 0x0001accb77283928
+, 0x623d72bf8ec73d91, 0x6bc2e2ca5ccfc177, 0x2a07b248136b7398, 0x13cfb9d6be80ba97, 0x799b046dde7e2bd0, 0x141c8a09aca661e5, 0x87ccb7476e5f0f68, 0x4e4afca6df721e68, 0x9374a6d84c0c64c5, 0x4d57f21bafae43c0, 0x1c919b55c662b2ea, 0x21dec89ad3ee462f
+, 0x8e5d9ad820e06b69, 0x2a74c8b33344c67a, 0x573500977e12acd2, 0x5871680883be2b2a, 0xde7b5bc17fb86f1c, 0x51bdac2362021509, 0xc5ac3ad84c324e96, 0x5423f972009c9f1d, 0x574202457fbc5839, 0x761d16cd6fbf5e40, 0xea0824f988b0a9b8, 0x3d929454a6207825
+, 0xe625ea3132526e45, 0x04298960709f1a35, 0xac5b025acc4de694, 0x45961a5de165ec0f, 0x237a15068dbdbbba, 0x7daa8dc88b773950, 0xd9cc7add115d94bb, 0x5521600d6e2501be, 0x9a319491eec87abe, 0x05cadb67388c672c, 0x36378c092d678674, 0x6fb646954c470a3e
+, 0x307e9a145e97dc75, 0x466ed44bf956f14e, 0x99ce9120a69a4ebd, 0x3dbfe8571b49b85e, 0x7d3f7c5a8385a134, 0x1cbe5369bdeb2662, 0x900b0630a4e280f8, 0x7856eab82cb0d0d4, 0x0dabfe901f9b551a, 0x19b3d891167dedaa, 0xa9aacba40b4ae3e8, 0x04e354183846cb8d
+, 0xba2dbf17b2132c67, 0x1f4929c01b1f6c6d, 0x5073b55a07c1d516, 0x218c7cbab8116260, 0x9f4a711e412916a4, 0x74582c43dbfd2f39, 0x30f1ac8af3562c0e, 0x116b76e46b27aa9f, 0x84a9302ea31a5b89, 0x32693e8a3e55159b, 0xf073f8b909f37283, 0x51aaddd1ecd7f21b
+, 0x8ec6520b71b4bc43, 0x575625d4e491a2fe, 0x70619137b0d816af, 0x586c46949734eb5a, 0x64f87250aaa6f74d, 0x4a6de26bf14f76be, 0x58f77e1fa297b05b, 0x32be319c5378ad2a, 0xb5632b504ca3150f, 0x24c2c82da98039ef, 0x3490551dd6960824, 0x21cdd29b077d4a14
+, 0x4a6cb72966b5abe0, 0x5977e1a5043b58e9, 0xb4c887560602680d, 0x7b718e09b495d704, 0x0f3defbebbd289b7, 0x10692332d473e9b3, 0x12fd0a2943805e7c, 0x28babaf957061863, 0xbca11cd3545322a5, 0x19fb139e0763a81d, 0x89482321585a833a, 0x7aee0f4aa661e90e
+, 0xec21782c40eba3e5, 0x6e5aaa2ee0ab7c7a, 0xfd87beef9e9f1867, 0x7b32081fecf2b529, 0xb091d130520ed62c, 0x7530f3c98ba3d188, 0x85fd730d835c2c7d, 0x255e13bd0c00a4ca, 0x37e2af43339e736b, 0x549c96eb59bf77d3, 0x466aa678c8bedd97, 0x50daaf11170ba4da
+, 0x23f70f1d9fc8230a, 0x4ad6e764cc88b728, 0xd841c4bfe5319dae, 0x0973cc2761e92566, 0x482be37e90965e2d, 0x53ba339b1f626aac, 0xbfc8aef6e1586294, 0x748137838e1a1c6d, 0x1bec0d0f0e08ceed, 0x0b84ec7ee7235493, 0x104872c2f3d3eef5, 0x1a32fe05c785fea1
+, 0x78f530f3d74e483e, 0x317d4c84e2e47be6, 0xcfad8f367e5baac7, 0x4b2404e18990ccda, 0x16a9d0146ad00f15, 0x428ee4f532cbe32b, 0xb9efb2e186c7bdab, 0x0d2488ca2720f263, 0x903253475ac40843, 0x3ce2d816f186322a, 0x5ef32c677e3f8ad8, 0x682da5aaf49ce47c
+, 0xc270c16025d4b870, 0x73b69a365de308d4, 0xf954363aa6c66169, 0x7853ceb53b6f889f, 0xb6602508ee75cf27, 0x21d1194f5ad3bf8a, 0x901519f1371e2d15, 0x2b3ecbcca7a135d8, 0x6911da6faa6b1e23, 0x5dd5ae30cc44f23e, 0x791531fc38dca069, 0x66028bbaa5dbb849
+, 0x02bc5dfcd1565798, 0x102be4246d51167c, 0x1f2e9be164535d0f, 0x3fa054c128104d82, 0x867002e108c5820e, 0x3c643d5927ffc665, 0xce5de066c84a300d, 0x27a73df956c7b5b6, 0xed4f895c46071508, 0x225b478cb17ba62a, 0x2e8f22e295af2dd7, 0x50cb982f57b31e38
+, 0x3db25a9ea0422a89, 0x6b999201d370955c, 0x22ed7ddf665639ad, 0x4be95351f4bda866, 0x31ea7fa363dc899b, 0x0b7a284ebbd9ae63, 0x08969258d28b1688, 0x086fc9547736a744, 0x6dd06512cda4922a, 0x7dbd682f2fbef857, 0xbc0302286c05e0e2, 0x5bf677776b312750
+, 0xc837a0b6f37175f9, 0x595b68b85da1d045, 0x89b8c9cf52faa172, 0x1e0c7679ecd97333, 0xb29089268796170a, 0x51212c8cda3324f0, 0x0ce960bffd22ae49, 0x2f0115a0f9ef55b4, 0xaf31669adafaef81, 0x75abc4482092ad9d, 0xbd21662940edfd16, 0x2eb093e0dccb5fc1
+, 0xbbf6de1d62595182, 0x1b69c34a1553d827, 0xc660db4cffb25566, 0x2fc8b2c19252a736, 0x95e3276a211300bc, 0x0a94cfceeab81a23, 0x45a682cfc1c03d26, 0x7001ac24c2acc333, 0x7a752296da8fd199, 0x3712c831dea4be36, 0x850506711418a6d8, 0x134a540a228bdbd3
+, 0x168c1e2e87da9da1, 0x2f39cac3815dc5a9, 0xcb343acd5265a22c, 0x4948ac9e048cbfbb, 0x711505d7fb120374, 0x4fd4e3e284bcb534, 0x85b197183f430c96, 0x633e2b930c0d76e5, 0xadb70e7cb3da3aaa, 0x486cd7c96c4f41ac, 0xa5d287bda5c22ebf, 0x2eb34549866ee679
+, 0xa2cc93343be76f75, 0x6120e27b961fea5e, 0xe0a104d3e6a944b6, 0x634c48a4dddd26f0, 0xe79060197ad88680, 0x34d01a8c3f588963, 0x314adf13de035131, 0x3de5add6661596e8, 0xd106a14378774f37, 0x63d89e782da449fe, 0x4e46a820bc84655a, 0x202e9f30832babce
+, 0x20e026800f9991af, 0x726371a1e54be176, 0xa6bd0b84db6ddd9d, 0x71824f179d6332a1, 0x42cbd917b9b356de, 0x6749f3a67ff9b855, 0x44373d6ca7f1c4d5, 0x1e07b04828ed6f1d, 0x07ba6a333146d37c, 0x230f19e4cf6007d1, 0xd989e49bf0fd93bd, 0x24cfc9b584df6b74
+, 0x3659f52cd7891afa, 0x6a1e98613afe8a92, 0x91c91100150c6ea3, 0x283b707dffef10d8, 0x8375cde111179c2d, 0x4316b64a0161b3db, 0x667696523240af77, 0x61d843cdb5f681d3, 0x21310654d59c2d0d, 0x2b329b50e6f267da, 0xa79f4e46ab9ca8e1, 0x0b8971bb45c93da5
+, 0xb6c99d08e15e2c91, 0x4db9937dbd160630, 0x3e3ce9b9ff61d56d, 0x6686f9b8b12e6905, 0xbb19d508b5e4eb2c, 0x73adc419400916e0, 0x439123020f6cada6, 0x5265b6ab31421085, 0x4cc34dd428c9cffa, 0x438d2f5a2ab111ca, 0xa8e7522921478c13, 0x2b9dd761325a6315
+, 0x2a058a83462d808c, 0x5225f93cc85b7424, 0xffb212d41a3182f8, 0x3e8d000e34c05ed5, 0x977447b782541e06, 0x4287636f1e318350, 0xe75108f58665d8e3, 0x6bfe0f248a694923, 0xf64b67a877ea4603, 0x1e48ddd09c2adb78, 0xbe2ebdd5ee6e28a1, 0x32e966b2f2d39895
+, 0xf1477d0d704f0f66, 0x172aad22b64af094, 0xc8c2bb7b59f7b22e, 0x4b18e3017845c99b, 0xc35f8d01d0f6e4eb, 0x4217de65f536f836, 0xb9219e22e578396d, 0x736fec54a3540a63, 0x0976a8f47bd8664c, 0x62c3b29bd9c2fe70, 0x3c33fd83491366fb, 0x2be2c03cd538482d
+, 0x795859bf00f15e6a, 0x623989b77d860671, 0x07f7b7b97b89f61c, 0x7c1c38da9fb940cb, 0x0e98e93bf0c318dd, 0x76e98eb730473942, 0xe102f6f5befa17ea, 0x74b910ae11a6b9c8, 0x51fe9e9fffce59a2, 0x420d0aeef551886d, 0xcd0904b754fd6191, 0x02e316e647d88ed7
+, 0x42fe59eaa9e6484b, 0x2c39674326887577, 0xed0619709d8d7d63, 0x24b04fb6a1d59bbf, 0x5f2466583e24bc17, 0x2577a113307f5dfd, 0x66b7492658de77b2, 0x0f1abea483bec2a5, 0xeb148c915b40a4d7, 0x18002b9feeaaf6dd, 0x707533246f604da7, 0x252a4c19bcde24b1
+, 0xfb9fea2be6f3ddbf, 0x4c48f2aae3030a67, 0xac3fed50c2e3e37c, 0x7fc61e3a668c0d39, 0x4e5244da0a61fa5b, 0x4efd7735481ec1f5, 0x9909dd794fa700a7, 0x3c6522d83abf04f0, 0x723e3343a41acb5a, 0x0bdf33868408286f, 0x8428660fea654354, 0x4a356f8f4630fff2
+, 0x9bf17fc3c624518b, 0x6827af378d45343a, 0x398971dba7203b9e, 0x71e59ebbe62c4364, 0x739798f1ff4e8f70, 0x7a0788283a7a6b42, 0x8c4f9269b696c977, 0x0254312ebc2ff7ea, 0xf5f4f2a50dbead70, 0x0f1dcaa3c1b7ac0d, 0x457eaae29724361b, 0x76edde595c2fe904
+, 0x50bc005cd28bed06, 0x7988f2f64747a8bd, 0x7f9d2b0dd38424e4, 0x7ae0efd5a1e4e809, 0xdd1fd5dafc1e8731, 0x7da8f3f6d605caa2, 0xb8ca95ae32b761a9, 0x2cc1aa363b9731b3, 0xfc2579c98bdaae1c, 0x29ae1bc6e8735078, 0xc0561f53dcc33461, 0x3c3195744e20d75f
+, 0x7a24c81a77bbec71, 0x2aa14e2f87d8fba7, 0x2ee4dbecf5e28646, 0x7df4e8c88ab87999, 0x5708e7447c21d7e1, 0x09cb71ff1130aca4, 0x4ac726447f4203bd, 0x26aa3ec620c486de, 0xaba03e9f6e5bcb43, 0x2c122eb5a41991c4, 0x0f6456d0960a4044, 0x4c9fe4758cc7c5cb
+, 0xdbd0140d8ca10f0d, 0x45b165c5cef4e781, 0x43034aff5f885899, 0x6974812e290c6b6e, 0x091dc65956e058fb, 0x07bbe8e95139a140, 0xf1fc5336b94424bf, 0x1e8f14c6a8e3e676, 0x2f3765f2bf431a0f, 0x45471b70494526fc, 0x1be1847663ab480b, 0x58568cfae97cc580
+, 0x9ee52969b58ffa02, 0x238fa7e9d88d16fe, 0x45a9732d2ab10411, 0x24f71d7f8ac411f4, 0x98e734f953620d4b, 0x04ca4972df9a3022, 0xba516e574d933903, 0x2853006e097fc2e2, 0x4d8a48cab8841007, 0x6bf6d7b9ba32cb24, 0x0888f6d08e279c11, 0x543f493a2445086f
+, 0xd7a91c35b184da06, 0x4dacc98529f80971, 0x5c7739b75df37399, 0x0d97c1b927d35908, 0x8136ead00a38b85e, 0x0fad290e6d703a80, 0xf9dd6006451f19a2, 0x2c68c5fc843c7eb5, 0x384aea14a1176bf3, 0x6a4bfc701dbbec34, 0xd2a22aa084e010a8, 0x267aa6e539bb7224
+, 0xd41b86c694a0152e, 0x02ad9694008f2be7, 0x958cde3bef9f70a9, 0x3f9d4aff48f57ff2, 0xf5675e83c256bad7, 0x78d86bd6714d28c6, 0xb3cde5ab4ecffe7b, 0x5d8e75718c8953d5, 0xc27834e9834e2bfb, 0x35e85b5a82eae5d1, 0x57e845bc318c2219, 0x28c52e80fd71bd25
+, 0x0117a2a775dda407, 0x1d2ab9a17ba1fe33, 0x5080ec0373853a1c, 0x4e451932c8ae6127, 0x0ff4ba83724f5943, 0x42cae7293944e017, 0xd7451d5712d97538, 0x621be77b5b19cb8e, 0x54558c9bf01ea132, 0x56a81f4284ab61dd, 0x7ef633c151b5d0f1, 0x32b086ee41a2e3eb
+, 0xf983d3b118a6189d, 0x2654a902ff808d4c, 0x56f5da7c50a38b00, 0x6567ea40c8e87a46, 0xb511a33583ad8d9a, 0x59fdcaea2ffad3ff, 0x3805f77df179933c, 0x456f3b25756af38f, 0x6b38549c00be14e2, 0x0cc17787c50c7ee5, 0xdb1c271eced9a2fa, 0x45b00f14db7300a1
+, 0x6d8294d47a7559de, 0x62d057f13ed23603, 0xe48caedbd076270c, 0x218ee2a69b384fd4, 0xfd7ddf47cef58b5e, 0x6080a51040e59dc3, 0x6e9f66c0d40394ac, 0x7a75ad40c13a56ef, 0xecb1e352184c01d5, 0x3bc4718293277fa3, 0xda0ff93f87028838, 0x63c46c7a5d7ea662
+, 0x2d333a107b4f8582, 0x2240d35c1377458b, 0x9c8b50dbdb18421b, 0x32a63acd8554bb9e, 0x024a965584d2be18, 0x26007e088a9b1a98, 0x0338a4d7730a3c4f, 0x063f627ad4443aa7, 0x89efd5839510bd37, 0x7d71314d6ecbe438, 0xb531ea8182aa6c17, 0x13c08438341082a2
+, 0x3c9cc37c6c0b0d19, 0x18466c8f62107676, 0x724a51bee6cdaa8c, 0x5cc08929a063f532, 0xf197007d2bb3d6b4, 0x357a509e4b719253, 0x2b0d62ff31255253, 0x0b649509aa0aeffd, 0xd763e18b02d69d36, 0x5d073161821654dc, 0xdf7125bea5c333d3, 0x67f182a2303a8709
+, 0x4b05e3888aa59c8e, 0x4b7eee42415b73f4, 0x860eb424636394e9, 0x6da21354f2e922df, 0x7d98a72165131cfd, 0x591bf9a00a60e440, 0xda70047fb3acc447, 0x243c1034a1a47e8c, 0x30a919aeba93d516, 0x48e93387c2dc2d93, 0x4ed126cb4c0571a5, 0x2dd51d69dad2e32d
+, 0x42b4c70f34ac53ac, 0x64bedf937f871ead, 0xffeeb2642525c849, 0x01f00de2148848f0, 0x86945d2a7440fcf2, 0x44ae24afcc11796e, 0xfce2612b840bad47, 0x5a2cfda66995f2e9, 0x6a4dc883a78e4099, 0x67cc400b9a836aa9, 0x6823fa48b3e6a05d, 0x11e6ee7abd0e5af3
+, 0xb33b684e197b2983, 0x661a687cb552daf4, 0xb17c734f99fe357a, 0x261d6e73c119dfca, 0x119c86abbdb2360e, 0x0df6959f1a0f83de, 0xd64a500f2f18564d, 0x46d6b3b30316a40a, 0x7f99d84ee2b8b41c, 0x59c01c91c6f0a29d, 0xfd103cca8251fa65, 0x02f224d3550a8fbc
+, 0x1ab5dcb7151eafa3, 0x12b2898a1436b885, 0x16976c8558982e00, 0x551d73fb850c516b, 0x7fdd3386285cbaeb, 0x58a424bbf64964ab, 0x0bec3a7c40eb6e4e, 0x2ac8a6c0671a2aca, 0xf336dd8ce29fee6d, 0x46546392581d83c3, 0x670bd51c3af2f18f, 0x2c37dd6a405d7355
+, 0xe3efb97b490be1eb, 0x1daa12afaf7dd51c, 0x66369030761a2779, 0x0000fb506d2b1387, 0x03e471ac71bca4ce, 0x6aa9be748a6fcf19, 0x370f5bd73bd552ea, 0x1423036330f0c75b, 0x4a85391cc33bb58a, 0x3dbe061ebcbae1bf, 0x037e527a78349050, 0x79ae12b6b2bb60e5
+, 0x9bbc1e1749bbe6db, 0x6cfaebd349980b93, 0x87c8b1daa915780d, 0x4c023fdd033bbe99, 0xe912c0d0242b2b83, 0x47c303468bc8ffaa, 0xee76bad81a508405, 0x38bec0a9fea921fb, 0x27fa638ff50cd958, 0x3d66950f32e067df, 0x28c99bb85a72c52e, 0x091c654fbe636ced
+, 0x2a7f330fed4452a5, 0x30e52bc0370162a8, 0xd603122dc8c1d660, 0x5dca5c065d06d8aa, 0x95a8d15f34f73175, 0x353003dc34b77473, 0x24879a3febb25a7d, 0x3cb433488830a901, 0x07c7bf85b1e034dc, 0x2dddd8b65e57af84, 0x48e87dd1d3ef1ae2, 0x07f631aa4931ca78
+, 0x794d323f79e3bf2a, 0x31ff813b30f25c44, 0x400c5b6fa12ef0df, 0x08dc023100142200, 0xff41812e02b62464, 0x192fc81df486c0b3, 0x218514781ecdd4b0, 0x4f3ff9d4d064c80d, 0x3d90ee5077e0d191, 0x701f9d4c392ab4da, 0x98a9dd2d17e6d422, 0x58c649c88587a67a
+, 0x8e9cbad0bb47527a, 0x77d18b8d10da9381, 0xe9af9d42453b76b0, 0x3b445c00c03e8393, 0xca9da9aded8bb892, 0x7125015bd7ee762e, 0x49ce27fc3f87a78d, 0x5b2de8c382d3d559, 0xaba6b07059a8abd5, 0x69047a5a5a42bd9f, 0x857a053a771488ed, 0x277756c49b5a8a9a
+, 0xe9e8ef07584e85f3, 0x3fdd07ef61a4edc8, 0xb310109b27433b4d, 0x3e9804471b67c419, 0x298717429ab0e765, 0x40a55e59ed56069f, 0x34cb9ed89359e6fb, 0x46ba6ebf874726f1, 0xe229b9f94c4eddf7, 0x511bc30f5c955a24, 0x912f8a6fadd10fdb, 0x1ee441e787f500d6
+, 0xd39ee2ef9d8a38f7, 0x1ccc4123a73c85a0, 0xa9d0907953684d57, 0x752dc023065ff91e, 0x745559b90f0ead89, 0x3c6ad87b1c6382e7, 0xb24169fbcb136ce4, 0x1eea09cc49ecf7df, 0x08e1ae844613ed5d, 0x102abfe615e6b2b2, 0x18fb2c7fff6aa3aa, 0x7d5b9027b170c6cf
+, 0x7f37e4689091065e, 0x74c0452a3e500f82, 0x9ec53717bb6fe70b, 0x606e206873637208, 0xc360a159c41eada0, 0x768bc15d5504dc2c, 0x2f9ebd3637e809ae, 0x144fe38f67d2ae82, 0x442588ebb5515e01, 0x002643e6dc37d658, 0x5dccf34049015a28, 0x0046b4bfb5ea82ba
+, 0x176b6f61771c10d3, 0x30bcf766fe4eb388, 0x2a85d6ded70ff6ab, 0x49f7031d1eb593d7, 0x3cb4c09f82ac2158, 0x2699295a8d274b98, 0xbe73aeb05d0cd1d1, 0x4e5d2b248605357a, 0x6b705e06cf050fa9, 0x34da2c4c979072ed, 0x23f3a184f4b2ea1a, 0x63523426b870a7ec
+, 0xb9aefe338c6a067c, 0x3a20f5a2abdd3c5e, 0xa81f83cd6f0f3941, 0x53892ebf8bc95875, 0xddd81caf15d0222b, 0x4d684363f070cf55, 0xba65f518fc84c668, 0x1b648d341ca7fea5, 0xd71de3a8fe376ae9, 0x58163d00e54d8f5e, 0xd85f640abc95c9ea, 0x4771e5308f279789
+, 0x4ea148f7a265a275, 0x10bd1af368dd1d1d, 0xc7695b234b464abc, 0x4c340d7f2a98e556, 0x21705f4210b30ea4, 0x44706896bc27c60e, 0x3a33a5f3a08c0157, 0x09aad9079c30bb7f, 0xe563d1905e9533fe, 0x738bf4aba1fef1ed, 0xed7953b752ca056b, 0x2738f6fcd24d3a17
+, 0x52a869cbcb86c1ec, 0x2b5ea9125e18bce7, 0xc4595c1bceddb3d4, 0x298ece62d0ef4cc2, 0x8324a8353aff0c4f, 0x05e63e0845e026a2, 0xee9829af8fdc0cd9, 0x6a436358f031cdab, 0x0b7d06735858664f, 0x535cc5a61b1436b1, 0x10b528d669a0bc20, 0x18abba6e388a3cb6
+, 0x7d4e6671ea8d075c, 0x3eed5102c095e364, 0xabff48045820c25a, 0x43dcb1d3bfbb940f, 0x0fb03c15ab75f6a8, 0x5a17da41584895c1, 0x46ce0246ee77f57d, 0x6ff6f404af0f308d, 0xfcc7589ed2045c6f, 0x3f971e737f376808, 0x38a0b32af9976cea, 0x6958f907ddccd37d
+, 0x7cb0f64656bc188e, 0x7b5b0d8ea8c4929b, 0x65fdf5d1fb466e2d, 0x2c9ae44fa1b66495, 0x55433715f7f78600, 0x6d5fb6d0340628c5, 0x39b8984d38d2664e, 0x4b5425ea8bc651a5, 0x59d8c9bdd98d7b11, 0x105029d20c1d98ac, 0xe434382c39d47b45, 0x7cc1f08200c6a44e
+, 0x5af3f18263c091ca, 0x4c9966b1658af331, 0xf4911f3bedcbd1db, 0x6e3edf87da0c1073, 0xfce1991d679417f3, 0x09458ffec9aecc49, 0x8de5b457139253b7, 0x35d74b2d5efed55b, 0xe98206bce366633f, 0x73e4a720e088bcc4, 0xb8b06e23bb4b09b7, 0x3a877dcd01673b6c
+, 0x942d8e145572c113, 0x4ef32f9f735ec4cd, 0xd27257a6e2a606fb, 0x51134e92f4a2d21d, 0x2a865745742a7138, 0x34851ca19d4793e6, 0xfa172cd62cce13c9, 0x219bdbb04a1394c4, 0x5963259a86793ff9, 0x624f4061ea45f8a4, 0x45cfe5833841ad0d, 0x6a46b71c3dc7eac3
+, 0x08efdefbeb2b07de, 0x49d1b56007604d47, 0xce65b16e8e702d1c, 0x5eccf28d2704c9f1, 0x8de34b2878445ba9, 0x38f66155e6c68ac0, 0x228c4d495c1aa786, 0x1af390a866d667c5, 0xbb2e425d6fd56471, 0x5e9ba223fc6e8836, 0xe73b62493aec5be5, 0x22fcc69b54daab93
+, 0x9504f258e19e6084, 0x5ffbdf01be6fd9a3, 0x504a6f6050b05d91, 0x736491d6fd18fc78, 0xe9be445498a17644, 0x35e5ce869efe23e9, 0x774a2438f5bd15a0, 0x6d4a4c8490ca27ff, 0xa37c6b2b9c06d904, 0x61513aba705caca3, 0x20f2668703eb145a, 0x48465000528b25d2
+, 0xe7dd6330650e2faf, 0x4f5297bb9ea07206, 0x7c4acc4db71cd622, 0x03e3ac0b0b234d67, 0x5d2e7926d7ecca7b, 0x1663707c207624ba, 0x87f8775b221c5c29, 0x138d2b90ee0ded10, 0x6d41dc1c25019bac, 0x0571b7ef509a5259, 0x4855adf7cd6b26e8, 0x7b732ab19f4311eb
+, 0xe7c23040dbcb3023, 0x48e2dbaa5b4f9d2b, 0x6e0fac53927a5a1e, 0x28669144b204a507, 0x6a2da11b002137a4, 0x30bb65f99961733d, 0x1144355c5eb82a6a, 0x1446024fab4f06c7, 0x93f5e65f126e4aee, 0x754b40acdb4b72b9, 0x55f53cda835012f9, 0x082db1d5a69eacea
+, 0xbd95b8278ab2c299, 0x7966f46994bf9d17, 0xdf73168e8e7618ab, 0x7aaf58e550ca713c, 0x919810b8d7d53999, 0x46a85f35135618e8, 0x5688f26a41a8fe81, 0x55688ea8955832fc, 0x1668280a138c7d60, 0x74c4b75402d02ebc, 0xa1e65b1b5362c6ac, 0x5542cdb4d985079f
+, 0xb20699ffbe1f61d7, 0x65ba22537262bf30, 0xda3a334171cb6e7c, 0x6b980163bda22561, 0x79ebc18d13fa7e5f, 0x453ea966b9105c4e, 0xebe3d71b079a40f5, 0x75ee9fc6b96ddae3, 0x726e693d7ec164dc, 0x5df55aabff36b014, 0xb14bb2597773b7e1, 0x346a733797cb4a33
+, 0x60084573ba70d1ff, 0x597d3cd5a489ea62, 0xfbd1dc22f4aac3cd, 0x47a5a579874d2fde, 0x7f73079438a57b82, 0x17a59c3befcc7c61, 0xec104d262af70e11, 0x7ed75240e3d63c2c, 0x13880bdb1e0e9a84, 0x638e6110a14fd032, 0x815cd80f49d866e0, 0x20d26777bfc93d1c
+, 0x5b6c819e7c69faba, 0x6490e46b876206ec, 0xa8a6afaadd506a9f, 0x1de56f149d8002bf, 0x50c89fd6d3ccd62c, 0x2ef19820fd4a1d74, 0x16adc418562fd012, 0x75713bd5f4779ccf, 0x6c98dbd9ea2f5921, 0x0865c01a62731405, 0xd0ddc731a66a8943, 0x0dd3b6c2315a24e2
+, 0x2a6e9e50cccf274a, 0x2212ef46b88e8552, 0xbdd829547493a755, 0x0bce31a2cc8b051c, 0x2c184d1d534a3a60, 0x11b7fc847fca51e4, 0x6467d5b85376e104, 0x651cc2c8ad294aac, 0x333321cf58fc459d, 0x7a612eb8dc7c2c5a, 0x265c0a8cfcf45753, 0x26fd602166e13d62
+, 0x698ed1e18e959221, 0x0f6cc9e1e7c7eb1b, 0x241a185d4c52e474, 0x589676f72661cf58, 0x790b71c9c9dfa68e, 0x5060a81e5765f454, 0x834ff6a1ec5d7002, 0x41e8da176f0e82a2, 0x0cbf6bdccd2045f1, 0x6a0ca970c3b8da20, 0x99c73e4ec823e1e3, 0x1e86f0d622fcda6e
+, 0x5304876e22045bac, 0x674bf5bb94e41219, 0x82efc340b3e5a341, 0x6ee618a99539977f, 0xdd49ce35390083f7, 0x64455aee2571c2b0, 0xf4cee917f817c613, 0x73ea3ab3f421e46b, 0xf38c848170046e07, 0x2cb2f7b82789d5a1, 0x213e4aabfc246990, 0x121c88f9d8320ba5
+, 0xe857cf09064dd8ad, 0x131ba22cfe3b893f, 0xff3f485b5476e09e, 0x4423c5c1975ba5b9, 0x94f6eb156a3e6a7d, 0x326f6b54fd620b35, 0xb414e53d6257ea2d, 0x649ab4ddc4ad3acc, 0x805887a685868bbc, 0x3cdc23c722936bba, 0xb98d6ee3c770d1d0, 0x0b5018d1b73bc2bc
+, 0xff11b2db27de32b5, 0x2b1468ef8094cf10, 0xb0ef9fa64e9f5070, 0x3378ce4f1e26c03b, 0xf4a106e06a83017a, 0x3e069a5c518a5bcb, 0x11c76ea252e52593, 0x7e40300d3c62acb4, 0x51728104c4a45004, 0x71095c46bc4f62f9, 0x9a5bb06f6d64e483, 0x1933c2a09aa297ee
+, 0x3ac7f610067407dd, 0x7f5003f672e28213, 0xb6179f00a2685c61, 0x2e72da481a382f7c, 0x2be6da6835d3d16d, 0x0b2ac5060f020756, 0x504ecf8c96726b13, 0x047718c782757c49, 0x4ff4bab328e6d820, 0x49854ca7177c24df, 0x52dc87adb486ecc4, 0x2a5a10ec008a50ed
+, 0xb6abecbdd633fcda, 0x1c3fd8dfdbdd553a, 0x4c494ed9dba75299, 0x60b768521f6872d6, 0xe7fac3c65ac1537f, 0x0ca28fb80833a4b4, 0xe1c58803f253a754, 0x437051c7330a0498, 0xf0f25d64bb7ebbf2, 0x5cd21b38a728b5f9, 0x8574edab3f520823, 0x7611f0101e7b9976
+, 0x520aa20cd9c31245, 0x3504486d5be05a67, 0x5d623d80ed2638df, 0x73e2b8077ded861e, 0xc34cc2b2026fe07b, 0x44ccefa8e5f14cd4, 0x5251713900b0ff16, 0x00bc8b03214941c7, 0xad72d02ba6cc58b3, 0x09c7900a9dcb84bd, 0x402cf6c50ef989ef, 0x24a176824920c7d1
+, 0xbe1cc69a33d9543c, 0x6dd60b6b477990d6, 0x1e25a6f81ff19671, 0x648a60adb883e2be, 0x56085c6c7188a23a, 0x26e6587684be2651, 0x9ed7c5cc2680edf6, 0x5c7f9a400319ec87, 0xedb47fae147e3cce, 0x17b46cab8fdb4ce1, 0x8b9730700fe39690, 0x2518c03c771670d9
+, 0x4fe952c94394dcfb, 0x3b8d1af07444aee3, 0xe6dc57d86fe93503, 0x2d10eb1071aba612, 0xdb187ecdca86902d, 0x14c97d5af1aa9958, 0x03597f9a3f54959c, 0x5ba0298739c56053, 0x52e33c4c22467142, 0x518d1493c0697a3a, 0xf60ada425ebd090b, 0x2ac22f72231359b1
+, 0x618b6e0f4f897a80, 0x2527c98bcaa1d942, 0xe16aa7e0ffea397a, 0x47a3f4916fe3db35, 0x40f9cf004de08791, 0x47363d5f6608201c, 0x5925bb3dcdfc78fb, 0x48d70b4e4b287419, 0x12b66657a23569bb, 0x7977de6f5c5c5bb9, 0xad6d31134dadae73, 0x75063be9b5f2c6c3
+, 0x3f80a4e308eae549, 0x68ffefe7cf2cebb2, 0xffcb309454a50726, 0x23db8ecf0a87fd5a, 0x2f092a70fe588f06, 0x42c2a30dd4e4b07e, 0xea8baa81df8e0c89, 0x05ba1bb252d620a6, 0xce0a3fdffe5b5fd9, 0x1d0c9f17578a7a19, 0xf2ec0351d0148d10, 0x3ef29b57b9ef81ac
+, 0x94e81f7e35961d08, 0x1c93fa3980fedad7, 0x9c53eb6d72932169, 0x6dbc26ba960a787a, 0xaf9c2fd00cd1b6b1, 0x5e3f0cfdb9c8bdbc, 0x6b24a9548f030a14, 0x37129a3ea356ceef, 0xe2726d319ee1ea78, 0x44ce613d190738f9, 0xddd28f3bba061d42, 0x77809a236e394080
+, 0x84638029c00a3eb2, 0x25c61d803b919a39, 0x7443b221ad3b318f, 0x3f2da972a6bb6aaf, 0x46ff48a5fc113e52, 0x18b84725f5194a0a, 0x61802454d855ddf6, 0x320a481a38def1fe, 0xe44447e40ab9822e, 0x178278d1c30c07f3, 0x480b1034d39959bb, 0x26e4e3c399416e6d
+, 0x61f2d9147a19d7db, 0x74d5cf12d45d585a, 0x012ef15b020521bf, 0x2eb13e5fb0fc3829, 0xc0ef4e9619daf6cd, 0x3db80efbcdfe3141, 0x72ff972ad1b78d01, 0x2f1d0fb525a98082, 0x03919870103a0b09, 0x7cbfa5a0430636f3, 0xb8997dc3cabee7aa, 0x426a7dbe21134315
+, 0x0639f71b4ff71d6f, 0x71c0c8762c316f6f, 0xdeca133a7d9f6647, 0x2bcc592ea510697d, 0x60662f3e8e24f093, 0x5044f54bc57567b2, 0x30151a1aaddea4da, 0x2f096667b4f9e0a8, 0xc55a7c718c645e34, 0x6c26991299e2f075, 0x98d72c766f9e1129, 0x162de30558594f37
+, 0x9075635240ffe081, 0x1b3d6d6c4ac009c7, 0x4bfc42e555b10027, 0x28cdd61a00edd277, 0xf941063561929362, 0x62303a14a080eed7, 0xdab711ffd4cf4075, 0x5c36ae15e779bdec, 0x54df5bde9035132c, 0x0e92b61697b82f0f, 0xcc257c116f2206a9, 0x5487b91baa1c39ef
+, 0x20468f3a30405cd4, 0x197fa5614cee06b6, 0x52ec0c70cff93cff, 0x42be37212ae993c8, 0x2d0ab88ea29aab93, 0x0d784a649bd618fc, 0xa3e5f714eeb9fd0b, 0x451d9c455903309a, 0x68c7f827cfa7fabb, 0x0de5b10648f55c62, 0x1265f1871dc54961, 0x3be0a09ab71985d0
+, 0x1cf02cc48df4ddeb, 0x40475326b7c3cfc2, 0x5fc7d2b89ee7e003, 0x7f98a884983a1fdd, 0x1b33663f3ba1e0e0, 0x0ae6e58a1a6e84e0, 0xc10ce0c039b33c5a, 0x666a1a0119f58c85, 0xd032d7e0b163f07f, 0x152795648d5a91d3, 0x7761d3ef89ce105d, 0x55a6f91e1785f01b
+, 0xb1a2993ab9de3eb2, 0x079ad20104be50ff, 0xcd981178fea6c673, 0x53b665ca838db4af, 0x9ff1ad8686aadb4a, 0x16655c7aef5a545e, 0x1617a070bf1413ba, 0x730f4a519264c12d, 0x9a24419ff1d50dff, 0x1c47eaf06f1e8870, 0xc073d85988c700d9, 0x1663c3349428dc30
+, 0xef47135acb33bbeb, 0x65fa1dc287a07b4b, 0x5052324fcad53c09, 0x2f6f70a3a5d2e41f, 0x289f0f2ee87e03cc, 0x5e8dc7bcb8c8c2ad, 0xf8123a7252ce2f47, 0x2aec4ff1ba4a8d3c, 0x879cb13c3e560358, 0x629f43e966160b0f, 0xfe8f386fb84f011a, 0x277e0c0458e9dc7a
+, 0x8ade8218c059bb41, 0x065ed778a1cf7feb, 0x02cf87d452398b3a, 0x0080c5ef476b5c7b, 0x5e085f55d64f020a, 0x3cb7350864934aa8, 0xe349d571b624d523, 0x1b711da314108296, 0x518105f142e0629e, 0x0021df01a02f5346, 0x03fc35f9f3a3a08a, 0x2b559e67b93e01fd
+, 0x745bb8a8ddfbc4e1, 0x4b70ad0f94eefaf1, 0x2c337d2200af7d9f, 0x4325f7d86ed97044, 0x09d3f1b145f56168, 0x422d1c8be4ec1830, 0x745827a4785112cc, 0x76bb0e5330740a4f, 0x7611a09112325999, 0x456fb26d5c8efda8, 0xd937b56dc527f213, 0x3ee474203e787c6c
+, 0x98cf7ff558ee73ef, 0x0da770d7c28975a3, 0x3ac2a63c2c82fbb4, 0x47959339e37981e8, 0x82e6e6725d30bc7f, 0x68b6f610f64aad64, 0xda62d4d295257f32, 0x3e1ca4d449c7cc54, 0xbadf3d171f7eb513, 0x1a00c2f0926a873c, 0x43719502a4576990, 0x233d656fcf14e79b
+, 0x142e53ab52356c51, 0x0a1dd52792fabf56, 0x7c723c39d4c19952, 0x16b61cb9ceeded44, 0x315c12602b305a00, 0x3c0e6a329500c10c, 0x9fbb2fb51b39a5eb, 0x4ed91882f4cbd529, 0x3d96113aa351c46e, 0x385b04c11054622d, 0x48f1dd8aee36f726, 0x5fc800a0d8659fbd
+, 0x835a706bc8906ee2, 0x3f0ab43bd9956351, 0xf3dbfd0317b35af5, 0x76a7d039edd3830a, 0x5fe2535c08caec90, 0x22b12ce3ae06eb61, 0x1d64a2c51e794d24, 0x198422c721a71f98, 0xd9442db6ac6f9bb2, 0x2be63f738ad10703, 0xb7b2119362c452ec, 0x3271768654d1f691
+, 0x98df7a4921263ec7, 0x1a6d90b979906f8f, 0x29b43ff638451298, 0x762f97faa8e75d06, 0x12418aff8de8e616, 0x70169955bd8b7261, 0x49650eb6545ffcd4, 0x4a3d58afbd2dc6e3, 0x41932aa42a196401, 0x0f081a1e3c99fb00, 0x7821ed6f9eb09045, 0x453a08fcc6363653
+, 0xb316e8864e944951, 0x3e1eaa7577dad16b, 0xa518a6f142c02385, 0x30e40877040367ec, 0x8b40183af34e1ddf, 0x7f5fcf33e744a672, 0x1d54a2d3192afb3a, 0x2870894d1d3298d6, 0xc2fda5a113080e17, 0x2ee4bc08db4aec83, 0xaf7b2e054de85aac, 0x54d6600c7b95b74f
+, 0x22163e4351ea8131, 0x3ffcd5b65508d678, 0x562f27666ec5bc8d, 0x1b1906d4265694e9, 0x24716c70d5a45de7, 0x29ee0a008ef85194, 0xa20c7ae65d78a724, 0x7c68dfc325cec0b4, 0x972e1b1fc9ee00df, 0x1f2ac5b91a033425, 0xe370a46c7779f577, 0x5f84e75d13d37c86
+, 0xba4ef2b01d62a649, 0x226b40a10b485907, 0xdb1fa28de9fd71aa, 0x185b64014bc0f0bd, 0xdeeea0b3c24baa9c, 0x434c81b44ba11f5c, 0x951aef35d994c1e8, 0x76f56b3bfa6f9ee8, 0x74dd4d9b638a6e72, 0x798783af530358de, 0x9a581b481bbbac3c, 0x06adf64b9e9059d7
+, 0x5e51702501048620, 0x2d2c71cb67e51eaf, 0x092d94e6faeee997, 0x2060226264457832, 0x1f17344f570fb08d, 0x280909aae77fb572, 0x4e82a19efe938300, 0x5aa3bd927126e3c8, 0x7fb4b8a3e4b45b95, 0x2de0f5ef0af03b4f, 0x03cfd25cb20c08c6, 0x6046b98826953dfa
+, 0xd0ece4f2bad63d7d, 0x46bfe4f9b32f9b4d, 0x15b8fd7df85da0cd, 0x61a4ddb66c742e62, 0xd8dd4294fc68ceb5, 0x55ccb969678a411d, 0x6072126460443b4a, 0x0faad6aba08211be, 0xd5a8171a7026a57a, 0x7e71319cfdb9f493, 0xa26f0733d632c296, 0x7ba1cd3abf96ef34
+, 0x558bc64fe1450b68, 0x778ea23fbc617686, 0x119cd9dcd19c099c, 0x22787eb787deb815, 0x01f2583aa47a1819, 0x32a23733aa3820e9, 0x026f59139d9c1f38, 0x4f9dcf715abf60e4, 0x9bd87aa0586063ee, 0x454ee6341226cbba, 0xbcd7de333487bc69, 0x29be46615a087d1a
+, 0x80d3fbd6bd37e794, 0x584aa2a4f9f0497a, 0x484de55b83ce3582, 0x345503a0d54d4e46, 0x4d8b565982678fb2, 0x278d2db4440972c5, 0x2de2042d4409f062, 0x1b8c45a4c037019b, 0x1f96362f5e2d4f3c, 0x4b939bd1bd2fc066, 0xcb129fee9384cd39, 0x5188a0db1687d3c1
+, 0x08f6339bf0ee7281, 0x58fcc22858fb14a1, 0x3cbfba0551fc0cea, 0x6d0ebaed6691952a, 0x820eabb420e9af01, 0x7a3f0c5981501594, 0x71d99dca00165e3c, 0x3e4ea6f5b6414b8e, 0x90686048fe64970f, 0x2006616c63f66757, 0xbce69780350be8ad, 0x0aff09917ef758fd
+, 0x529aaa1e58128e36, 0x7c3f583d2779f611, 0x1203c72e548c7c42, 0x04df4b09e953e785, 0x9d74aaea8e888a3d, 0x5a7a4153f0f86592, 0xafbfb7a69647dc21, 0x48631aa0312a52cd, 0x624353c2b4710fc9, 0x1f1cc869e5b5831c, 0x7307e6ea25423714, 0x02e7d80ff5f32b23
+, 0x93e0733bf0ea9681, 0x5000e91bcd201718, 0x7b3c0aa4525d6d94, 0x5a5cf4d6737b1c41, 0x764e6e34a5a6d238, 0x2689968a708b6d74, 0xbdae655c8fe7835f, 0x0e53395b4f458cc6, 0xd304bf4dcf5f9b34, 0x42aee03e90172999, 0x47a7a1d3fd256136, 0x459d830f6f5b50b5
+, 0x0ba987c713fed865, 0x620fc4ec2b5e6cc5, 0xb9ff20a09094f75e, 0x52c9819b7c7292ac, 0x81ce2072c5dc638b, 0x4830b5a7ca03fffc, 0xf900ebcdd9a2ecb1, 0x667b67b82b9e0003, 0xd949007bb33dfc63, 0x323c756f0e625498, 0xf22f07ae63a631c2, 0x5bac89ab7898879f
+, 0x879e37652bf5ad7d, 0x24228d7da75d7457, 0xb316e991bd51f110, 0x6efc9aeabe672e29, 0xe4d9565169703b0a, 0x3345d1da6b906461, 0x72c3b10d81e24816, 0x37efe20dd53bdf29, 0x554c8d69d201e4ab, 0x6501868d4ca86b8f, 0x2efd64a761400032, 0x24db594e70f21f4b
+, 0x0ad2701734a44428, 0x314ff8e1687b19d5, 0x1f77951b7a5a0fbc, 0x00e34bfa98ea39d2, 0x1a5811191afeb510, 0x0c37f7f28370ca4a, 0x95b219fb3d01c3ea, 0x6809a3128b88ccb6, 0x6a2c513b11411bf1, 0x38aa4a335ca4ef74, 0x9e02a183a8fdd631, 0x062915f3d0be292f
+, 0xd2771533cf816524, 0x40cdf10a1d975e7d, 0x06c60e449e452abc, 0x52568313e8a3fbd8, 0x24cd9f9a4f833deb, 0x19de009ef14255af, 0x43a5416ea8909e16, 0x1ee09408b0272676, 0x17fb8ffa147fdc8a, 0x2fb65b2327f3e720, 0x3018f0927196bf73, 0x7da22af62e37ccd4
+, 0x8205714c67c9632e, 0x4898ec8bf3cbb36c, 0x22b76394577363a6, 0x0be65abad1c90fd9, 0x87f83c4ee0f4b349, 0x6c9c1c8965a7cadc, 0xd194e53d3e97cc37, 0x22c955d5edba4f5b, 0x5cb95b2e930387f5, 0x01e57c90bfbb5671, 0x3b20cab0ba4d7b0e, 0x4285c2e694bf695e
+, 0x5b86b715e8fdfe1b, 0x045e8fde4c0905b7, 0x567036930b1d3562, 0x7be485249320aaf8, 0x46bd16d2ef8eae8b, 0x30a63f30bc50e172, 0x1325ed51a496712f, 0x5087528c83131fe7, 0x063b174cc11db8cf, 0x4ec1d0dce685e322, 0x72703a9745b81f3c, 0x5318efa8130ac839
+, 0x592c8f5381aa95de, 0x1be04ac3f23f262a, 0x47302b315d60f289, 0x41b561aaef394d99, 0xc4e6441af2156632, 0x4e58f8072bc6eb78, 0x80be33bebea046eb, 0x10104eddcfa5f62a, 0xcb7d21d195c73663, 0x610209ef8f181b55, 0xe0ab55aca6e4fa3d, 0x288f0fd86daf2ddf
+, 0xcb9d4d186abbe075, 0x5b81597cec17b8b7, 0x6aa287466bb973aa, 0x1456cd234cceca6e, 0x7d040b658133572e, 0x7b47adff83f3ba52, 0xaf5aa8a15e9c9ae7, 0x192d24db90c234fb, 0x43737baa2a13a36c, 0x1f2bc37d32f7105b, 0x2e81bb0147222060, 0x54cf234d7ea0c2bd
+, 0xefce2ea55dba7845, 0x637ad7904e8c4c24, 0xaabe69c98e87b71f, 0x06be4ddc2fb60a2d, 0xc228e83f06986f5c, 0x2ef16724e97bd3e2, 0x4be87c5efe835395, 0x2748f3475fe61bea, 0x6592d72b220d5385, 0x1d23ed4956cf3eed, 0xd7401b334d711dc5, 0x4c28bddfb85bc511
+, 0xb7f394db177a574d, 0x2122eae23fb78049, 0x1535682b1aa05916, 0x7af5fcb344acf0e5, 0x7f3f81d62fc77198, 0x080c00f825f4d7fe, 0xee464db3d803a866, 0x66ff9e25b8eef30a, 0x97b8598c0ab1fbee, 0x091e3e99a1571fec, 0xeec229d82dbf650e, 0x1e8339a113572eba
+, 0xa6275e5eec5b1831, 0x12d6025b3d9443af, 0x55bc876754f69e75, 0x68ee3649aca92b18, 0xd5c4047d90c381ce, 0x1b00d36a64f7aa57, 0x0cc624b836635f45, 0x4e8102314ad1ddaf, 0x7fd2226d5c57b7c8, 0x2ffcfd036aaa36be, 0x7a2dd7f842531c34, 0x3c6ab6d9f3366e4d
+, 0x84afba0ea14f6d75, 0x0a8cfbc756efe617, 0xdb68fa1a99af1162, 0x681667ae8348203c, 0xa8bab5caba437601, 0x797fec366b281104, 0xf1b5338c41024fba, 0x5b75b04aed960144, 0x6cc23b39028af91f, 0x59d0732b6d8e35ac, 0x78d11fbd189db187, 0x7949bd6d0834a752
+, 0xedebea8b7607ceef, 0x67a2d6f065daf790, 0x57b83a12cf6d86ef, 0x5019bacf4da092c2, 0xa98064269d5d4686, 0x67fd09c6d9a2a59d, 0x07e0873f8cc5b762, 0x3c3342c1f86b7322, 0xee85780a319f9628, 0x7931e800f57b4341, 0x8f9c894dbe035c06, 0x259e50b6c36c74e3
+, 0xd96bff20d8ad55a1, 0x146e7a350712e527, 0x9c58bf6addabbfc2, 0x6e9a773158c6b552, 0xc18bc694177618d5, 0x5b5d1d5fafe97404, 0x9bf7fb85e18e2b30, 0x729f89b697b4e180, 0x766f7d633a103aa4, 0x63bd04867c315e66, 0x130631f088b2af8b, 0x09d3b78312c9b90c
+, 0xe126771526e6d079, 0x1453f98ab0a76490, 0x6f65ca72b14086b0, 0x1c16edff5436036d, 0xf2810eb88d24209d, 0x662a88132663d79d, 0x21485bb82db31963, 0x6b77311e4190b316, 0xa9ad063e6acebd06, 0x3c957148fcfe7bbf, 0x2f16386f41ed96fa, 0x09716d66855a3e80
+, 0x7303d6b2956ac509, 0x22b853a5dd3e99cc, 0x0517b94927ae3715, 0x3b7a57b27dd91fad, 0xd59b255d9cc2e2f9, 0x0d367744a1a69407, 0xd9bd7ae40b143072, 0x10c96e0eb569e337, 0xe98ef8931acc47b1, 0x49bdd49dba9d1a4d, 0x22fdd26cdca8e00e, 0x51fc951b71d1af89
+, 0xff39ddc16b72e3c2, 0x75bb726de0d9aaaa, 0xf694ba4b3ad11fe3, 0x7585719c2ed0c12a, 0x785d1db570c575b0, 0x7d05f1e99192a239, 0xfb3534d69b69fdfd, 0x48e80363816b017c, 0x5408cd80435c75f7, 0x7245d6ab72b7f8e4, 0x52069a25ed1b4003, 0x4086a38f1b7305fb
+, 0xa23abffcd83d44b5, 0x37b2f49b2198c67b, 0x7e85aa416dc667ef, 0x2433310a8f120a43, 0xff6ca195ecf63869, 0x6d3de939fd2ba0f9, 0xc1d4ffb9a0633754, 0x0d2efcb1bb78868e, 0x08b69a53c1491337, 0x419f7fd222581138, 0x94bbf641607cb398, 0x7c40455531e8ac95
+, 0x731a8a185ed892d0, 0x4d64c9d892b79d18, 0x0b85739dedd58a82, 0x3fd39f70bfb4ad5d, 0x746570c4e960f1be, 0x1919895d51df63c3, 0xd08eace84a5cf881, 0x6b283a796721263d, 0x54ef431cd969b721, 0x35d7699f951cc758, 0x15474acbb40f898c, 0x689f5b6a648dd898
+, 0xde3e5cc95af8320c, 0x68321b0e25fbb638, 0x587ce07bd61bcfbb, 0x41bada96d7c5a368, 0xd08e2a09b0fc421b, 0x4abc52357a163ae4, 0xd062f5f4e03f2f95, 0x29b4aca88705ce93, 0x77d50efd8edeb63f, 0x3e41712e60ff123b, 0xeb909e91e7813f94, 0x482b4722588f514b
+, 0x99db5d4c4610e2c9, 0x46c65a5133515168, 0xc2ae191accb9ae02, 0x053573617f6ea227, 0xcd77328a63d7ab9e, 0x787f4f0bae88b5a2, 0xaa0084ff58d58a4c, 0x5888cfd0a8c41e86, 0xf0d1fe4a83c02628, 0x2a49c10782750826, 0xe3a6148e527bb508, 0x6be5e33286d936af
+, 0x182e8c424147734a, 0x583c517187779a8d, 0xc9503a3ed4db9591, 0x7bbaae865cf1218f, 0x3b695eaf0b68bfed, 0x19bf55c5982933fa, 0xb12c43fbd073cc3c, 0x1b5d06bb257ac848, 0x675da752f1ba0cd5, 0x13868c6a9ca79e80, 0xfcd40485defea76b, 0x622fddbbb48ea5fb
+, 0x90170be3bc4203ab, 0x26b34d91c40191a9, 0x1c85b99b371f3681, 0x74740816bb4795a5, 0x7ec7f67e54336db2, 0x67a59fd42aaf4d21, 0x344f4f78e596c7f9, 0x36f9f0ee7e9fbd5c, 0xb11e9d88a387a401, 0x00ecc935b4e2f1a9, 0x53c34800c945e619, 0x198e201e52bb92e3
+, 0xed54ecd42c3c5943, 0x7b674529d9503344, 0x0602e2d52a00f54e, 0x2ea76b574a1d3664, 0x0cc49ef96ab8fad1, 0x55bf576a76f3bc62, 0x4c98a56f1f7d63ad, 0x427e06adef365510, 0x36fd72e5a514366c, 0x59d5885fe5d88cae, 0xf31e5e4c275cc1fc, 0x341611e8429a701c
+, 0x90b7e58fc821a0e8, 0x77d962b622a26e96, 0x4b71fdd6919dd1e8, 0x1b9059319c495bc8, 0x43da45ef1993e482, 0x5edfb976542dd5a3, 0x128df7f73604c3be, 0x0ff21cdbc423fbb0, 0x2ba8b5d348f6d900, 0x311c1db006b2c21a, 0x94c5fa1f367c0d20, 0x54f95f37ecb78647
+, 0xb88552bdd4af682a, 0x339884698a31b199, 0x588c1be0f2778115, 0x14b6f8662760250a, 0x65e82197f177c93a, 0x6981d960172ae92f, 0x56b837c0520e0667, 0x6e57389d841e3f4f, 0x790f84b4e76626fa, 0x25c3e7bd94652c41, 0x7d38451de8c8b9f7, 0x4ce8ac3b34153806
+, 0x9b0e47dc5191be61, 0x52885d8d9f94fa15, 0x20ca8bdbbadc29a4, 0x13ccf0004afa2e6c, 0x5655167b856ea77c, 0x5848b7195b1daf2c, 0x6ce450ea046b2b57, 0x42e1165ade88b05e, 0x506a23dd458313b7, 0x18ed6b3c245ad7c1, 0x878faf34fccad499, 0x5f3c148705bbbeec
+, 0x1b521e04ea850afa, 0x1e026ab766ef9e29, 0x34c7cb4c632893ed, 0x0f73a39cfd1d95b5, 0xe46aa243092cee72, 0x3011a5ad46396a7b, 0xfcce5432f1c7d766, 0x0d84fab46768fd98, 0xc3e37522d1961942, 0x6961a5e3e0c19e4d, 0x7c9da38f18603fc1, 0x7e2e20b1f3ee45a6
+, 0x711ab7ed3107f84b, 0x5719e64dd364d0da, 0x345a8d214229d221, 0x309f6b791bbb380c, 0xae0254c3fc2a5397, 0x2bcb526a5fd1366c, 0xd5d9f62c93b028db, 0x3c6f6f034f5f678a, 0x910f44b51728dc9e, 0x68c1c8ddcd7a87bc, 0xadc556ccf0bc6872, 0x1a799922b8466209
+, 0x88c5c22a1e753849, 0x7f9b885c8cdcf55c, 0x3ca392a3a08e51d5, 0x386cbaff859df03e, 0xae76dfefabbf144e, 0x54e6a07f74e7ae0e, 0xf87a06ecf85015b1, 0x5d67883befe4fa80, 0x956557c56d448db8, 0x673473dbdd739823, 0xfab925e419c11f72, 0x5284512361efec77
+, 0x2ab598f14215a71a, 0x0d2a87e250cfbd40, 0x1c81fb5a3f8f9f1a, 0x33cb197aac4d027c, 0xfc6382d30770aa8c, 0x6716d2be3672c0fe, 0x736aec652ee60ac3, 0x3732e945ccaa48bd, 0xe09b7e00b971723c, 0x30e04798d3eb8c7f, 0xda3ba0c5a2e83356, 0x184f2c603e33247d
+, 0x887a01af48bf2651, 0x561286c735ab4bbc, 0x627439bf9a0cd667, 0x1191d667a52fdc3c, 0x5d1f350286fea12b, 0x59ec290c61447072, 0x37907f74ad23dcc2, 0x1863f4ae963a8b1d, 0x1661994d9f40cdaf, 0x5eb536c8849af51e, 0xa1167fb053348e6d, 0x4fc04339f92b6eeb
+, 0x1c5ba3293cc7f8c4, 0x0fbed750b55ddacd, 0xced0f839ebbdd13c, 0x6d08012b175ad57b, 0xba3db2b08fed74da, 0x49e7546db2d0f984, 0x61a94d1959c23a99, 0x07167429c2afd405, 0x385ccad8cb407db7, 0x14f875d9f79dbd85, 0xd78cbf4d05aacd72, 0x7d631dbdeb09e0d7
+, 0x442b545e2a795ca0, 0x55c662361b61d552, 0xd4d782fb75143025, 0x3e08ce4a91e26ff3, 0x705e0bbeb83af280, 0x50dba1fc042daf7a, 0xc7a97699960df29c, 0x511f17614f07678f, 0x78125327f4a89840, 0x1ad5817fb63faaad, 0x43447f5c381f6976, 0x62c5b0a178745c0b
+, 0x589857961e164451, 0x4e84eb8ad7b58ed8, 0xf3003d1572a6c252, 0x21de9bb10f4f127c, 0x8a11a28981b62bec, 0x76f7360f2095103b, 0x2fde133583d20327, 0x506924d1d6e8fdb2, 0xd635ed8ef44bd153, 0x42860d3abb3236d7, 0x942a630850ddd71f, 0x26de129f34ecdc5d
+, 0x99d4da9ff11ff567, 0x4fea701880ce8c05, 0x16ce5af1f499674f, 0x172db136efa8162a, 0xf7fa806b447d0cfa, 0x5772c7e038c336e2, 0x9b8c3438670ec746, 0x6d9f77a2ac9fbce9, 0xd2fb2ed597fb4d02, 0x3b70a2340d1e0cd3, 0x2ca020f1d4c3c670, 0x29b7923da562a66d
+, 0xf04cd17466b6ab92, 0x6853f5337ca23e63, 0x97f3b99678686919, 0x71538e3cad6cc59e, 0xf630753fe2505504, 0x6c70d82aef22b330, 0x596be99494a39f1f, 0x5dc07aa51a91a416, 0xba63e1cf43bcfb81, 0x01194e584a73b35f, 0x5569b1dff4c24ad2, 0x465352d6bef551e3
+, 0xc87343b94b6968bb, 0x336e6caf45877cc6, 0x614bdc60c78a47c9, 0x1329592228ab4659, 0xc434af5088b9b47c, 0x586a64aa2887adf4, 0xfbb26b004d5c85e5, 0x030b80e2cbbea85e, 0x12cfe8270bfd6639, 0x2d5ae250b694febc, 0x0b31a3afd6dbabad, 0x12e09d8418ddec38
+, 0x7da21632139d3a87, 0x7dd63c8fc85b59bc, 0x47b1eb523e250c7c, 0x7bfb729982e2d685, 0x267cfd813035758a, 0x3791512aaef56952, 0x8873319be2e04ddc, 0x43f30f1e6e90f3c8, 0x655d394ef0983693, 0x3e760190739da825, 0x9dcf9261d9fc13de, 0x4ca812134a6a6911
+, 0x9b2f934d96740d07, 0x3d6bff9401d28e8f, 0x2090ab9992936b64, 0x3d7a6b88d8b3ddd1, 0x7e93551f9e08da84, 0x1b1aaf8e344f75d3, 0xdf56260d50ebc206, 0x3798c66507cffc56, 0x2381e2a1e32fb10a, 0x4eda653edd3986bf, 0x732777073ab262c6, 0x01b9c4741b8b541d
+, 0x82442c9676a7f205, 0x67c86065bcae837b, 0xa5ed571bc804e558, 0x0eb6987e973f2125, 0x382f224ac47fdd8c, 0x7023152710b53eda, 0x22f37d6b828cf961, 0x71edfd0de9732dca, 0x0594441ced3c24c2, 0x6a59d9266a59907a, 0x30277a8a1ad38a74, 0x3c344d6cd71b2da3
+, 0xfa1a2e6037b0ac0a, 0x1d73b5d6705732d9, 0x729db97ad3940270, 0x0c75755cefc5942c, 0xa6c99a1471c0275e, 0x3ddb01aff2da94a6, 0x0e9f7137a50814dd, 0x4fb07a24909774d2, 0x7c97f0b7ee48a864, 0x0aa1cac0a5cd5e8c, 0x994838c2ac54f6aa, 0x0a64e699a4296c7e
+, 0xa8f6ce2d6f490294, 0x760b33f2f8c4d73c, 0x011198509d77e23d, 0x1565258b36b89bfa, 0x844abc5ca1252624, 0x1a42afeec765b28b, 0xd88892a1adfa35ab, 0x1144c17335eb6b25, 0x774791bff2334723, 0x2d7ecf0e356493f0, 0xcad3d5345144a268, 0x00e81396bbdb7fa1
+, 0x04aba8eafd6f5091, 0x789f74b342266b08, 0xb1ebc3825dbff1ff, 0x3f837924496a4ca7, 0xffcf9a73a98351ea, 0x66c65957632954ca, 0xf3778e6a262f1ede, 0x38006529ee35ca37, 0xb8ce7097536ca9ae, 0x19ebb5ba8ff11af4, 0x3eb32a0f2aa72345, 0x1fd88f7029342da2
+, 0x7ded20c5f1135024, 0x5eff66507d4320e8, 0xea6ddeca46a854e6, 0x7bab64927c461c01, 0x0f8dc902ebff0c23, 0x7b0d66602a9a9896, 0xf28da74f1add5f11, 0x2a6ed0c7b9a4e465, 0x12e7f07dc4ddbe61, 0x35dc6506d4f0d400, 0x7f755592781c638c, 0x54b63227a9ebec7d
+, 0x69cd486347a0be7a, 0x45c15c0f4dca6ab7, 0x8e8d8d875e8575cf, 0x24a56c0fdde80a15, 0x7e8d9e84cc14a618, 0x49da44637a9959ea, 0x93604224450910ab, 0x32f9f6ad3aa5a7b9, 0xef9892bbee83ce95, 0x7cc7c1b15528391c, 0x6282c50328d5787e, 0x55b27093aff416fb
+, 0xfa705e1acc3f1bee, 0x4918f7fe914b5700, 0x6dec37134df77931, 0x488d61684c6f4ad7, 0x0adba42514bf1d32, 0x41d00e6472f8d150, 0xaeae37a1e41717ad, 0x61d2634815aa890f, 0x0f11ac885f403297, 0x7e6ec3c276401785, 0xdaa41d97e573fcac, 0x7ecd907f8ff2e3b1
+, 0xd86bf6885570bd05, 0x78b388eeb22cf094, 0xe4af3715c1c9d1fc, 0x1c8953f1a6f4f688, 0xfb198604eb27b111, 0x5a07dd15426881d6, 0x585eb091377531bd, 0x1c1afa3ddb753d6c, 0xfd59fddf097fa577, 0x724e6588d4bb80ad, 0x167a96d4e0a5e7fe, 0x2f43cd1a33decfdb
+, 0x65e018dd3a6dd9c7, 0x0fdb81cfb8fc5eff, 0x95c90fc8e9218e05, 0x2b4d83148f6fe8b2, 0xea9fafed2cb014ce, 0x2ac14f66d7ff1a30, 0xc96b2000822b4e17, 0x30e2d82315011d35, 0xa857ef14274a6b05, 0x06b6d666cc869304, 0xb3f3b91f9fa7fae1, 0x1c24de1bf65b2c53
+, 0xd5f557090067f236, 0x467c1f53a494b250, 0x3b7dfc083ed24ad9, 0x7fea8f333d4dfec2, 0xefd64819666d2067, 0x475667b98927cb22, 0xa1986aae9836d59b, 0x25a17fe62681c3ae, 0xfcc7458d2b89f610, 0x2b64a710516e941d, 0xf6e1472c6b190ad6, 0x3fae7be608d652b6
+, 0xc2a3e6b041191001, 0x7266d769e85e482f, 0x2bf0cbf4adeee627, 0x3320224afa02287e, 0xfa3a2ecde73a7f94, 0x7092ea4d1097e787, 0x64da10f3cec26d1f, 0x29d16db2a37fc607, 0x345de6ebbd7ddb97, 0x1238d2e52bdde92b, 0xd46c5bbabf7fd142, 0x0685c12ed289c285
+, 0xc16d1c041ff5da64, 0x7cf1e028b8f639e1, 0x03fec90a35877982, 0x38dd92115a5a462e, 0x09ca1cdc2212aa63, 0x20930274d57d88c5, 0x6618c684e78bbffd, 0x49ab9e44629cce72, 0xe83d719a725e8149, 0x24698251dfc56d92, 0x7bbdda7df4601385, 0x122453c3ece4f189
+, 0x353e94d2bd94cf86, 0x06800bd2f2cd71c3, 0x17826a5ef6aaa892, 0x2150c36fdd18c59a, 0x70965a0c095e7751, 0x0c0944fbe29509df, 0xe2278f0c1fdfa0ad, 0x173a753eb7ef1a36, 0x973d599f4dad0d28, 0x1a2a9a39179a64ee, 0x7f4f85cde8f4c331, 0x59feab88361a41af
+, 0x0faa0582bcbcfe75, 0x38ffb26124606918, 0x1dfd15423659e29d, 0x302e374ef62bbe55, 0x3624217c82258450, 0x45231f74a703968d, 0x5dec8accb5e282f8, 0x6c4d261e3a695306, 0x92679c0572bbba50, 0x145edd7083fd0d81, 0xb07872b5cebe6727, 0x0a78aa0c8980cb13
+, 0x89792329e826a2fd, 0x2bfd9a9af0f3d1fb, 0xed1f355db9a43b00, 0x0149331696c4e077, 0x39139204e1c3be2d, 0x1cc2320fb346cdfd, 0x9c9189178f764dd1, 0x745d248d6f3c20c9, 0xf7d497eb57b52240, 0x3b1d65e7e0456d97, 0xd67916aa3d995a77, 0x01721ea909655af5
+, 0xa791bb75a9e751cd, 0x4ac917ff7eb094a6, 0x29dcae4c3803504b, 0x37708d9666201641, 0x2164cd55eb763e0f, 0x2579c44737835385, 0x037e705ec32ced58, 0x303f4edb185ec511, 0x869590118d81a765, 0x19890130482756a5, 0x2779d8a0a024dec1, 0x55888682cede7f72
+, 0xede01b628ce1faa3, 0x3ea547099eb69f9e, 0x59300b4e4b84012d, 0x4eb058fa0bb7a5a8, 0x7f6949354c3bb69e, 0x7fb225ea3d306a34, 0x0fce43ff8bf76fd4, 0x1306afce7001a5c0, 0x58effbbe1d913e6a, 0x2ca2c1e32737e050, 0xa507f8dbfecdfcbd, 0x112fdfb503d9566f
+, 0xf5503ba358dbd6df, 0x2d113fa64a12fddf, 0x1e2f6ce16e3312f8, 0x20fc8bfac7be6248, 0xaa10d0c1876625aa, 0x473a2134e8cdc596, 0x401cae394c03b42d, 0x58ef95f089238ead, 0x061c21c8259ebfeb, 0x32f1e2edd1a79488, 0x373e8db5c8a95c89, 0x329315b83c0d41ad
+, 0x82347739b55e87a3, 0x60e693bce052c994, 0x1f46d45567877d7c, 0x58270d66031b3daf, 0xba5c8828ab88add7, 0x7a48837485271733, 0x94bbaf804a913905, 0x4d142725cffda4c1, 0xc343487375cef144, 0x206f56ee79febb96, 0x9872def388212f66, 0x056e9921dbd3d178
+, 0x966059a7e79cdf63, 0x2e87151194b03125, 0x560da3396ef61810, 0x60a49471f345d266, 0x421e17e58b96fc59, 0x4c538ff6cb5c2543, 0xdcfa170d888deba3, 0x20cb8e22636cd4b4, 0x9c48d59863b83982, 0x3ec055ef60526f47, 0xba467d9491deb722, 0x39f88d2cd129dedb
+, 0x9d32aa20b7f9f2e4, 0x02ad210c77e9e0cd, 0x57d2252337f0edc2, 0x601d0e2fb5c0be85, 0x8b79ab7f828c7e56, 0x69e593dc18203d1f, 0x3a00d481373c3fec, 0x64e31cdce99127c5, 0xdd4dc73ccc86aefb, 0x4edf48889a60efa4, 0x80dcf8be4129f92e, 0x05f88949ab667c93
+, 0x18f03d3618fd5693, 0x7f8f53f1ff4cb712, 0x6be8c715228d699b, 0x67205c002b43d277, 0xc7ceb18f72a10815, 0x4a35482b25628926, 0x670c2e2ef7c062ea, 0x08e677cdc257163f, 0xa6e82a4412e5f9ff, 0x577f56232286772a, 0xdb9a4ed471367e7d, 0x72c5846e3e245f07
+, 0x94ac04b4492bd149, 0x710d407f0f2bd9b8, 0x1bf8133dd91875e2, 0x761d63afaa3bb0aa, 0x08dd5f53da7cbb9b, 0x4ba1c2fe6dbf38a6, 0x5365f4cbff858b9f, 0x46da8f584576a8d6, 0x3abfd10733451a8a, 0x3ed5a116ddae4191, 0xc8156c2d17b22d4d, 0x23283e15fc6110ff
+, 0x08c4a188ff779ae4, 0x5df4434809119fff, 0xfd3cdb7ca1ef5d4a, 0x6655cd66c2e618f5, 0x97f05a7531692dcd, 0x1f9cfbf067343abf, 0x75356f3a13498a93, 0x5efc4916e82cb082, 0x254e427d75429fb6, 0x567be39930e6fd00, 0x55a20eac4318c64f, 0x34145122d54a315e
+, 0xa40e4c00ced566b9, 0x1ccf8e6fd3905e7a, 0x51b4d3779aaf82d4, 0x7b1cfcd9d88205f0, 0x3761880262531e56, 0x60100ce7e7d481c6, 0x0f36a0c166f1d863, 0x2f5ac61278130852, 0x5c90eca442a9c42b, 0x2a43dacb73322a2e, 0x93fced8746401744, 0x7e7801bac0a80eed
+, 0x1e4c75d5f2998a62, 0x7935521d55bb3c52, 0xfaff3d90ab5bbc23, 0x7a76129fcbbb8c0a, 0x6e05f4d915b850b0, 0x35cfeb722ab3afed, 0x431d4b0347420df1, 0x3bb7f75b55c8e746, 0xa541a762498ebfc3, 0x37827575a754e176, 0x538caffba52e6c23, 0x4ea4153330f56ed3
+, 0xa8e4b93b15a759f4, 0x18d3d18ac2304a81, 0xa153db387d71b077, 0x550dd55306ec2563, 0xdf77ff124e381b19, 0x20e7658ecac65086, 0x6b76be57b8065b9f, 0x2162e67f4152aec8, 0x04ddd8f0cf39ed44, 0x3518b876315fcc08, 0xd633bd155ea39a92, 0x5f13a23b34d258d2
+, 0x3fbd049c5a4abb78, 0x18e1990d07142326, 0x186f481c16a68562, 0x00b7d1c98f827ce1, 0xcd19a2a5f6b7c2c9, 0x106b99df396830f8, 0xd3488c7428caa81c, 0x565e2ffe3592df77, 0x1b21112ffcba3b51, 0x5c13868ef164a32a, 0x19320652772ccaf1, 0x7d85c0ebb7c3f7b7
+, 0xe2442f4f4f7339a3, 0x77173da68294b81e, 0x2eff01f69482aa1b, 0x147e51a65e61599d, 0xffc2d001e398aae8, 0x04230aeeaeb1b4ed, 0x076ff2585b55b45a, 0x7df15f1ead6aaaf9, 0x7c6fe5c78156b45c, 0x67bea646dd37bd9f, 0x82dbb85bd5f1e68e, 0x305040042d4365eb
+, 0xc6dad9c8d68135d8, 0x5b20a70ad3ce8eaa, 0x1f972a9f88cd3d41, 0x45258cc4444babff, 0xf92e2e1b7d8a947e, 0x708f33369a781006, 0x9b71e8ceaaf42005, 0x6171f97552a15981, 0x143dc65f1c61e107, 0x4ba220d7d9e61d3a, 0x8f937db730330d5e, 0x09e8787d6d3b65cb
+, 0x42ac2bfab0988d85, 0x6f1c4d70271bba3d, 0xee47e01454ff766e, 0x6f47f8033270b166, 0xd6a40afad5dd852d, 0x21c4b2bde7192546, 0x24a83ca0bcf0a492, 0x4cce58e94bd2d932, 0x311c4947a6ded3dd, 0x3275bcf24390a0fd, 0x688b51df7cdb5da6, 0x60b8b36933b81aa7
+, 0xc6936ea547cd852d, 0x6b68e68120ea7ec3, 0xc5bbb1d47846aee1, 0x795e3359e9c05dbc, 0xe0c6889a8b20a756, 0x1153eb93963615b6, 0x544d07d0344df13b, 0x0d213b2d017924b7, 0x38762d9f761e3941, 0x4817d8d403a71c65, 0x7db4e3b54caa7fdf, 0x525a200195e519e0
+, 0xb8ab4144708f32b5, 0x5b45321269bf6a21, 0xd897364a96f96383, 0x407f8b1276acdf45, 0x59d00cb727389592, 0x52a12048c879ae35, 0x75f30d847233050d, 0x42021d2c1b55d12a, 0x20d1b3f424893f6c, 0x169bb70d28100f5d, 0x31534af510755fce, 0x5b8c5909fbd53370
+, 0x58a18afc4eb6c418, 0x67c64c398a931210, 0x4e7a69aaddeacbd8, 0x54a7830aa1f90d44, 0x96e4f92f8d04b1a9, 0x3e4db8ca4bbac85c, 0x0520295bb20c818f, 0x08057694e92051bc, 0x7d9107b38ce20d23, 0x4892186c1d245b69, 0x898ee22abfb4bad7, 0x308d5227ff96307c
+, 0x763a1953c6c19626, 0x7fe96720e9d18baf, 0x983c16dcc59c063f, 0x38be2beddcb14066, 0x073f46f4c46dbea2, 0x4854a26a1f878701, 0x1f519e191c91d82c, 0x7d6c25e3159c20e9, 0x65bd5577c45f6870, 0x39720b852a5f53ad, 0x073775bb7ad7518b, 0x06562038718658a2
+, 0x479b5603077fe647, 0x24fcf8b4dadc7708, 0x11458fdd5531da5a, 0x6b42596ee3a11585, 0x1eb8669d3aa251f7, 0x169acaa345d2cbaf, 0x1cd23de12809e356, 0x685de7452fb80901, 0xacd979246ab06b1e, 0x3f95ad7a4cd9bc6d, 0x99ec5aa2325cb413, 0x5f1af4a8d2482783
+, 0x95ebe5a067d6bdd2, 0x6070a6afd964f4ad, 0x7a9d0fb0d1123e71, 0x5bffb3f4a8b850fa, 0xdb982fbbd412845d, 0x497a248f88667741, 0x72a369087325ce29, 0x5ccb4262aa2f895e, 0xde4ffbf4de984627, 0x5c9569d1835b9c36, 0xdfcb75ba15f88dbc, 0x06581b91ff0f299f
+, 0xfe92cc1b9edda39a, 0x7c6e9d85a7faaf9c, 0x89da0a320aeb8e9a, 0x4ee531e2a1b68afa, 0xa8f4eb1d32ad549e, 0x543bb187514df9f4, 0x995634a06e45a029, 0x1086eeecb05fb937, 0x65a3f460278611fc, 0x7efd70123a898591, 0xab692b9d2e523bf7, 0x6d6431ab6ac0c00f
+, 0xbb1fc9c7fbd84038, 0x1c31c3a971ddfb8c, 0xedb2bb360677b40a, 0x2dee0e3393c2369f, 0x321ce093deedc1f1, 0x0fe55ffd89001626, 0xf49fd36720a40bd8, 0x3be54f7576f0499e, 0xc8ee453283156e3b, 0x410af2b5af174556, 0x34c9935a68caf99a, 0x472c57c979105449
+, 0x5cdcfc36ab680972, 0x26a1c0a6403469e4, 0x4faaf79a4a818cc0, 0x694ecfb4785021fb, 0xdfcc7970e91a5f64, 0x16ba1c9aef2217dc, 0xf735fd63d2e5d1bf, 0x73572591aab01434, 0xa610d955a03877dd, 0x14cf6625d9de1a3a, 0x301cdd4c39cc8f31, 0x02cf856e39f2b3b9
+, 0x22d430898115f8ea, 0x6e8d58aaf25def56, 0xe528e9d6a8c5c4bf, 0x1e65b05e9025e5cd, 0xd2ae2a28d09edc75, 0x7c8984ea2e479cec, 0xd1d39da2225c323d, 0x5238157c678810ca, 0x8968eb7129fcd228, 0x17409486854b5b66, 0xca48e76d9bfd3c34, 0x7357800117a44f3d
+, 0xd74784794ecb39bc, 0x5e31de42bc230684, 0x5ced9ade0cf19d79, 0x325be6ccf547dd05, 0xa8831c3ae9eb5f92, 0x73ac50c1c1eaccca, 0xfec42dcf484e629e, 0x014efbbb57ba502f, 0xe6cb973e788cf743, 0x1dfb8807ff35bef0, 0x78202150a8bf6c21, 0x6421ea8fc47efed8
+, 0x7b3145166ca75951, 0x210ed69c69fa0400, 0x388c0ca390a97e6a, 0x68c3371a852367ef, 0x593dc059d166871e, 0x25ab579c2bdb9b28, 0x2e451542fa540214, 0x2092640148eb7496, 0x61f86ba32b621c9d, 0x3f6316a815e74628, 0x5ac55ca004aefffe, 0x465fac3a35a8e738
+, 0x46a175c18a4e7704, 0x462cc4f43d1ff6e2, 0xafae75a1b5b6765e, 0x4c9796433461ea49, 0x5bed0a085b1b008a, 0x1d1bf19c6a5900ff, 0x3d4cf3a77a740db5, 0x6892cc797bed7b0c, 0x8745677a8630c97b, 0x7c7d116a6f257d91, 0x37b3bf3f771b86be, 0x6206611b5a9cce20
+, 0xb8e3ae303df3ae3a, 0x3075db3c8e71ed2b, 0x70f6957130086972, 0x4d70886d4f723b7f, 0x0d1628bc61efe2f4, 0x478f6924342be839, 0xbcc9331004a3c8f3, 0x76b1c3bd03eadf77, 0xc2084e3576d2ab0e, 0x31a88835b1f5fb79, 0xff39254aa208a7c9, 0x5aded4a9cdae55a9
+, 0xd34d3c210d83f545, 0x5fcb36d0940ee5d8, 0xcf17a384c31b9dd6, 0x74d308902b3f8e19, 0x863992b1cede5590, 0x2898e29b6955a005, 0xd7a4083477dea384, 0x132a042101cca920, 0xa6d178fd40e0081b, 0x59905aa725ab62b7, 0x6e312c0fc6b827ff, 0x19a01e3d571a362e
+, 0xba853a48f4ce4a59, 0x08857d1cb7616ab3, 0xdcc634140ff40f0a, 0x3c41fa417e00b936, 0xd95780ccae05f25f, 0x5624023220c974e7, 0x945d85c52f913810, 0x03a3cc087729f3b7, 0x2ebb73f48cb8bd14, 0x6e1685fb0128bb50, 0xd9bcfc1e239ec753, 0x06ee44dce57abf7d
+, 0x81c77844f569d5fa, 0x48cc105bd09ba5dc, 0xf686313f02aaa232, 0x59d7141f17fd0198, 0x02a05e6b9f1692f1, 0x52689035ef8a96a3, 0xa19607aebbb15d55, 0x331d98ed740e1ed1, 0x8a2620f955d4af2b, 0x33db4465230119cb, 0x433702b324841e96, 0x4c56e2a97a29b148
+, 0x21ca915d7c1cfce7, 0x62c5eeeaf3f35a90, 0x0b2a301fb2ada9c7, 0x00f607b63df38339, 0x7752f7f90a0a3b73, 0x40eae707335f78a8, 0x040552c946b91b11, 0x15dcfe0feac693b9, 0x552f8cff57209bea, 0x65849a339dc6224e, 0x6d556634ad68a48e, 0x6892624163902794
+, 0xa62862342f765288, 0x734b57638f9c0ac9, 0xf8e9768221e1d8c4, 0x546da858136cd14f, 0x89d55cfadfcd7daf, 0x2ffa31e3e1ba5f22, 0x1f685fabdea6e3cf, 0x71004c8095b69234, 0xb50bb6b126257d3f, 0x2f179e99fcbe3225, 0xa983e3ddc081d51a, 0x32fe34104b541379
+, 0x421268e4d63b2011, 0x45e76fcc2da3fbdd, 0x67559ef4631bc2f5, 0x28441df2f20a184b, 0x108a824eaa8020c7, 0x2638f3ca74172eba, 0xe0882f7c1fd446c1, 0x40424b727ab67272, 0x5ef042c5f07660b7, 0x0f03d0e195996f4b, 0xfc2b143e40eecb01, 0x43f87a79855e8ec2
+, 0x32776cab6c8cc9f3, 0x3eb8d382483f0dc1, 0x0a74c7004ccd436e, 0x3e6b4b8f0c2d88a8, 0xc6b03fc8f830624e, 0x2a03fe97c0920456, 0xebb4ef190f41762d, 0x4cc928b04961e007, 0xb7e71ba1fb9f0d26, 0x311d3d2eb948d9cf, 0x3b77de5c0ceaa2a6, 0x43e6266a1f2797db
+, 0xc5aa715d99978ab0, 0x1cec3ce11bc60323, 0xd7ea41d358cad3fa, 0x1e14eafccb588f8d, 0x1161248916c23789, 0x0b1a143836dfdf9f, 0xb7525cf086dad219, 0x246b1e6d9f5e9f43, 0xf47ba2992f79414e, 0x6f811b925d0835c5, 0x7f4765a76a9b259f, 0x75f35e588bc8dd0d
+, 0x48e67cf16688e741, 0x10a35964468c0f2e, 0x8efdbafbb702471d, 0x2ade52b0cd2d9a4c, 0xda3263896f65a52e, 0x258a34d0707ff4a6, 0x0e97cdbbb8191977, 0x486fab71b0b10722, 0x199a98bee4c258ac, 0x1048cc67d2ee333a, 0xf28e64cbaf47fda8, 0x103fcb9e30caa586
+, 0xd7b00515229dcfc0, 0x0871deb9ee524b40, 0x580f041650eb76e2, 0x3b6a6ae97e03156d, 0x3b4c47de3357f943, 0x52ba2e0cc027fe21, 0x578056eeb2921327, 0x7da8da2bc24f8d5a, 0xc62036f4c0823b80, 0x3b1cb42cf3e3ba52, 0x1be69e184982d1b4, 0x7122875881c79d3f
+, 0x0e9c1febdea9d712, 0x68f1d35e1b54154e, 0x3dc151fb185c160b, 0x1ac5c7b20df8ef92, 0xc055062ca335f708, 0x7bf1f17b2dd7153f, 0x79833201bcf5cbae, 0x4cc5e7fbccac2796, 0x61ad06386615b7df, 0x69fcba93016e2615, 0xbbe47b228790cb10, 0x66e023ff6ba1d42f
+, 0x6a17840a8b68f4f2, 0x53552e95fb8ce01b, 0x12dee058532518e1, 0x617ae7d9ee686b31, 0xc5afdde34de476b2, 0x41c20535bd30abb6, 0x5d726718fe84df6b, 0x366cfd26053aee57, 0x5d0747bac67ee182, 0x67fcc1d45b6f935b, 0x55694d88de96567f, 0x51aaa95e4b5bb194
+, 0x6596ef47096c9f8c, 0x0690002d4ad549c0, 0x3e29098058d44817, 0x7d41fb24da5b2c4b, 0x624821a9e283cdef, 0x36b1ba5196ef365d, 0x9407668b4ff3eeef, 0x2b6d95ee19365fa0, 0x418ca71d7c392427, 0x1077093a7aed9911, 0x81750b93a4040020, 0x523a7eb4721bbdfb
+, 0xb7fb2b302f93e94e, 0x2d48a1e0edd25682, 0xd81ed6f5f991ca06, 0x1f8df5415182b240, 0xe8307b235fea8abb, 0x0a99b6d2d88191aa, 0xe7a314c07c8ef4ad, 0x5447750b23914e44, 0xdc6935fa9a42d51e, 0x53605ca6ad3d0cfa, 0xffe7d1604e3c78dc, 0x22cd7c2c5fe2b046
+, 0x5ed579bc4c0790eb, 0x2df504ca2db48e02, 0xb1964616207ed4e1, 0x18774fa1b97988c8, 0x1be9bf8b42086e2b, 0x5b8c9de27cc0bc38, 0x421962b49f8b8f8f, 0x2fde7f5e35b2336c, 0x453b2b8e050caff0, 0x38a003c004d87cf6, 0x459a110296626995, 0x0fc883996100cea7
+, 0x1565b7f538b30bbc, 0x6b98a90a8d326b65, 0x51f02e3575d426c3, 0x5f4c4956e41c589a, 0xd49cb190225e3626, 0x68f78d6b94cd55bc, 0xe8a7945d0a0145fe, 0x034d498b91a441a4, 0x81de2e56bf25a4df, 0x10849813e9391056, 0x45903e6427dedfd5, 0x33d27d493dfc991d
+, 0xeba1c42198393a22, 0x31206f790fbf779d, 0x25dbd29205b24f75, 0x11a577bd7d704011, 0xba40071d1dd7f2fd, 0x76a9f14453117316, 0x1bd07fd2ddf141c0, 0x340966be59a30e2e, 0xf116798a8c23bb3a, 0x07f39414a91172ac, 0xa907357430786ee2, 0x1548479ed1b03482
+, 0xe4047e85de6ce793, 0x3e6b1fe2e9de80de, 0x7917cff675e2f23b, 0x66742aaf133cf234, 0xdd956aace9a377aa, 0x06316da50d20be29, 0xb3ffa8ea4fac48a3, 0x7e28a2be519f9506, 0x34c58884b6c537d5, 0x781292cf8538ac1b, 0xaa52db26d284fa7f, 0x4f68889284063bf2
+, 0xea91404a7add9d77, 0x1c74657a79fc46c8, 0xba1b31762e581ed1, 0x0512c4beb5f66b1e, 0xa407cc635b4a892a, 0x502b39601f911f93, 0x7f6ce01d9d14346d, 0x6ed455c1e01d990f, 0xf41335615b4948f0, 0x6dc13e6a43db6918, 0x33bd87bddcae0614, 0x6badf2362739b826
+, 0x772672e21958b498, 0x662d3a56637223ba, 0xdf50e6ee3828023b, 0x3e936e0cdf8b862e, 0x0f3feb38b1d5b2a6, 0x6a49de0e0a9eda03, 0x24e0d269494af3cc, 0x57047eb1e6204e02, 0xad3a5f471a2860bd, 0x12ea8ae4dcc2b0c9, 0xddfa6fd72d9f70b3, 0x204c53ed972abb17
+, 0x3756d4d479c2cc3d, 0x25d44ea8d31543de, 0xd82c8bef26bb2c43, 0x2c2047033d27f37f, 0x5bd33d9837dad260, 0x77943117a3383b7d, 0x12071d697ea583f2, 0x3c7c41272a225bf2, 0x92ebbdfaf1f03ad3, 0x5d61030c68b63704, 0xca6e2853baee75d1, 0x12404b34771a3636
+, 0x555d21542d81fec4, 0x354cb820cf38ad06, 0x2f1ed61490088ef8, 0x0825b6debfef0bc7, 0x1304dcc209cde39f, 0x1403aac8199e3ff1, 0xa6116a852981e6dc, 0x157f9e5f794b5882, 0xd312ba24021803a7, 0x1cc91d57972baea1, 0xab990f2dde08d7f8, 0x79abab9a7509326d
+, 0xbe13c46326667e4f, 0x2bd261916f9be3b0, 0x86e3f8cbadc80f89, 0x74520d8a1794cb48, 0x1e15c745024cf97e, 0x5cee741e1e53eb02, 0x8d088de0af99cda1, 0x625812961cc0862c, 0x4313437321c0e934, 0x60bbc768c424f7a4, 0xaba71fbf3c10e143, 0x37b8ea9f14a915b8
+, 0x0409651d7710a079, 0x5ac8728db97246e8, 0x60c64756562e8985, 0x1fb5a7578cd8f627, 0xa33cd2cc83472357, 0x0acfe33bb2bd1d0b, 0x83debb296c15ee2a, 0x3ca7ee74b93abd0f, 0x61edb522310f8064, 0x22876cac20a469f8, 0x281bf0d4885942ec, 0x2a2b0314a4f57fee
+, 0x50fb5a5c265e7fe6, 0x6af595a53b237b4f, 0x5d9743f99cea210a, 0x740f7573ae0ead2d, 0xccaed23b9af37903, 0x54141b8e9d48a9b2, 0xefc95094ce08ba06, 0x3b82032f0e796ce7, 0xb4b733d3efaa8999, 0x6b98a1ab53bfe994, 0xb354fe4349e827b1, 0x166e685e22a07a77
+, 0x004c9b43b4ef8525, 0x2e989afef4604875, 0x3841946d7b84cf56, 0x2b8520c1e7bfdc89, 0xf33c9d6a54f1aad9, 0x26c66bfa958c5910, 0xae780fdb8e915137, 0x3483a397940b668f, 0x35afc0e550b6249d, 0x5968ddca5340da5f, 0x6a4569aa1ffc52c3, 0x1ffd493bbb8ceea5
+, 0x704168af153f0962, 0x00130ef2f056a41e, 0xb5d58eee34517a88, 0x0552a577ebf1af45, 0x1d649f6e8ebb0173, 0x1c9b20d0a7594ff0, 0x7e3c6fc32e3133de, 0x7698daab2b91a279, 0xcf5644ae9c76616b, 0x3711cf4a4ecb2b64, 0x657a05f7977d711a, 0x728051cfac15b4c2
+, 0x9ca3f51e94d3f823, 0x4800699c39fe1955, 0xf8c0c451f0c518e7, 0x255f7a9967c63c76, 0x876eb04414b0e8ad, 0x20dce4bfd60d569a, 0x816bbe1af679f2ef, 0x7b2eeac26b7d67cf, 0x5391bd56ed3f3388, 0x47bac3215f7d2e32, 0xb1711ddad7dba126, 0x15c01e7840ca7d99
+, 0x8d96ec65c40213ff, 0x74a08828ff77845c, 0xbedb7194daf607a3, 0x17e86671161c8706, 0xaceb98e0524059cf, 0x68552ac494916f09, 0x4cd2971baf1b3c47, 0x68442ebcdde21b70, 0x19629b8c0e867595, 0x6a6955d3635fa47a, 0x6fab45e0f2e393ad, 0x66dd3ef4fcf050c4
+, 0x332be55b70275e2f, 0x0979ef6a91c86bde, 0x03d757ae52056d91, 0x0d3e51f7b0b2189c, 0x7170f183ee935df0, 0x5b7222b19cd5a882, 0x94837d0614d70558, 0x70701f1a98d746e6, 0x5f75712fc876eb00, 0x168467c486a537d1, 0x5a93973cb189cef1, 0x5230006dd076d3c2
+, 0xbb0b7abcfddc7df1, 0x14eb5b751b0bcf9c, 0x1cf79f9ca2fd411d, 0x5c496f73fff0600a, 0x49648d8555426d70, 0x46c1016a2322d8a9, 0xb57fdb870d9b6d4f, 0x609eb65209ddb633, 0xe70f9166bedc82c5, 0x772fb5b5c8afaf27, 0x79a294d9b0227a20, 0x7f75b141112dbc8d
+, 0x97ef1e6d03cffa03, 0x103f03debfdce3cd, 0xadca3019dd92943a, 0x4c77d40e4d478036, 0x394a1431c0874e18, 0x4ea18bb6af7d9b27, 0xaa1b25ad13fd230c, 0x7625e58c0a5f3520, 0x5d13647abbb1520b, 0x1da6d6e123d1e0c8, 0xd0f9b46fe937b2fc, 0x3449b930718e22dc
+, 0xdb09f17db4b7e917, 0x1c2a1268c6477e04, 0x641a00175889418e, 0x0b3d584036fcd8de, 0x6d4639d308e38fc9, 0x2b7b8c4bbfb82ad4, 0xa2438f35289b40ae, 0x34cd831d74e7a86e, 0x19ea51d36534a458, 0x01f452feb4af4b4f, 0x2185206d56a7bbc8, 0x689b85aca5c18e2f
+, 0x2eca5c896f054edd, 0x41c5cfad82888f9d, 0x85044f54940b3157, 0x07791508a545b8eb, 0x4cff41636aa874c3, 0x0744eeebb71db274, 0x28955adb2cb29434, 0x1a72ce527205308e, 0xa76a83cbd3e4c42e, 0x6e414f509559eb81, 0x3c74f85b892a4f46, 0x57d1974651093c83
+, 0x9d913b81a38dc0a3, 0x71df693e9de3c2ee, 0xf89fe963cea89dc9, 0x33600ec5a359d3fc, 0xf6d1abc7f633a89c, 0x0d1e9e3a1e3273e6, 0xf033cf4b5d6d2efe, 0x0afa4d032620c825, 0x7f94c4ab85722e1c, 0x72c5ea77aac0b52c, 0x39e0dd57fae48ccd, 0x797edef6f3130ae0
+, 0x791240e3d395e722, 0x3f800da3b6748c52, 0x892333754e36518e, 0x47db60253bcb82c4, 0x94f9746d2e36c047, 0x051f33a36fee586e, 0x06b15797b243f46f, 0x0549e3fbb7025e60, 0x0badb7dddf986220, 0x7114848f140f0ebb, 0x24497a7036162c4c, 0x67fa018ec9beb551
+, 0x47b04bf7371bac8c, 0x40611027151d3f1e, 0x1fed9723488336da, 0x28593ac3de2366c2, 0x72df4619c241e473, 0x2215140159419139, 0x34eae605fa98f274, 0x60bb301bf24f7605, 0x1cf03f929f874659, 0x7f78065b3ac49b8f, 0xd0fa3f0e35f0b245, 0x3908f4e0f267efd2
+, 0x273c61acbe2f8be3, 0x6f58afeb16ff4505, 0xd9c276124d7838d2, 0x3835285ef20a40e9, 0xfe703d250000345c, 0x2b88df31f60eb8a8, 0x99d13d5e957280ec, 0x2384435bb1958d45, 0x14f188a43d2745b9, 0x05b34e8774ebd335, 0xfb8746e99aabac8a, 0x5758de076b60e310
+, 0xcb08687f9acbf9a2, 0x4f14a549cf0ae958, 0x9beb8fcd6556beda, 0x1be9daf2725b19dd, 0xc06669999191605f, 0x6cc17edb0fb2e168, 0x8c4be18b60963b5d, 0x4f0b74adf902b48a, 0x01574877bdf49588, 0x1dfb5f67bdb4c445, 0xf1adaf1b6b321032, 0x24cd426d741721e3
+, 0xcdfdf30b87e911d7, 0x7b836351eaa4b1b6, 0x28de69d3b58036a1, 0x4a6040fb222bd5b0, 0x9d60dc10207be51d, 0x52cd0d083f5f4087, 0x7f9679533ca078f4, 0x588a36c37502eb1c, 0x770fd4da1f30db75, 0x33510d9a18453a08, 0x9d70d42f1cb0e675, 0x7c3bd09f5fc67390
+, 0xe30d7e20cb1172d1, 0x1067d2e4b0cf1f2b, 0x20ab63790c41f95f, 0x23c1c45d78544619, 0x36227eb882f225d1, 0x2d87bff35f2d9438, 0xc1757e00bedb18e4, 0x38602245ba4f4abb, 0x24bcd231546cdbf5, 0x1fa2f7f80c6220b8, 0xe24e2a1c58ae4753, 0x6387e69db3a6a529
+, 0xe11027323755fefe, 0x568a598a469f36ae, 0xbd5c20e3f2074f93, 0x4709c4e5f9c98e4c, 0x5e563a02a54dfded, 0x636d976e8e465b0e, 0x076e3da775619581, 0x677e89957c84fca1, 0x1429c2ac42af397b, 0x51587647450b9915, 0x295a2076cccdd4b1, 0x4221be9d328dc989
+, 0x56f0fae6402cfc2f, 0x0015c3405aeae563, 0xd46bd132504a64d5, 0x6cc2ab31f22ef57d, 0xaf3b384eedd432de, 0x611eadf7ebe5c42e, 0xebb96c247369ed38, 0x193df1f7ef983984, 0x3018bc60c930d5a8, 0x43faabfb58937e32, 0xd8a8e314214b948f, 0x049a369590f837b8
+, 0x377b3bbdbf1766ba, 0x68d6e8bc61c546de, 0xd72c4e5c5ec4a8a7, 0x5c1d5939c64f132e, 0x464d0d8435702206, 0x487aecf26d3cd794, 0x088925c496ff3ccc, 0x56a5faf79501ed07, 0xf5c1bfba4ea929b3, 0x7bd0c2d24f0980ab, 0x7959038ef8cc55dc, 0x0fdd38a26c00f7af
+, 0x95e8de7b377de2ad, 0x2338b0e382e83ccc, 0x333d95b550a506bb, 0x2e83939b6751b8a2, 0x672f032e3f073046, 0x4d6ac3bd27e661e4, 0xf506d0b834a34297, 0x30942a2616bea12c, 0xa65a988a8fcac8b9, 0x3c9145e9716d706b, 0xca0fbcb0077dc62d, 0x302be6af12dac93b
+, 0xb91369de4ad0961d, 0x56a5fd63d1886a6f, 0xad3226d368d2a7c4, 0x4bcb19d19f199c39, 0x1e0edf0ee4a671ea, 0x7033ec9a5438a9a3, 0x13e20d7cbe2937eb, 0x16c1e16ad3d6fb16, 0xfe2f5dabc5062326, 0x320726956095a1e1, 0xc981419168e24e5c, 0x29b6c16f8a60b4f7
+, 0xdbfc532914d82724, 0x03f6e60c7c8bb6e6, 0xc497455c8507f8db, 0x5fe2977803587909, 0x799f340ac26d0caf, 0x5c46d1a69c5a6070, 0x9269a1b2f644aedf, 0x584e6f0a9abaca03, 0xdd1997b76b14ae91, 0x7358dd7f4082bc87, 0x9eea08a1833390b3, 0x543aa8d1bb9a412c
+, 0xa5b012520471a66b, 0x7d8550ff60480d12, 0x966382e100009773, 0x74fe3cc9ce4506e3, 0x21f5e1c9b1659cc5, 0x38529a3d4e38e692, 0xb4b7a098d7130a4b, 0x7300c7a392a48efd, 0x49765e2ba90206e3, 0x4f464a7522fa9ac1, 0x73570543486d9485, 0x772f400262a3fd2d
+, 0x5e315dc7222c50d7, 0x56d7be592df91394, 0xbcb9b284c9a4580b, 0x610dba5d4b6f1cfd, 0xff1e5694b9741dbf, 0x17822aa786c8a73b, 0xc024998e3acd07a8, 0x747c3f6e9e0795f7, 0x5f4724641e56a0fb, 0x0d113116b8ef448c, 0x649ae16198f8bb1c, 0x3c99402043d6ab8b
+, 0x90281d5f5fa3e41b, 0x2753be34ca2fd1c0, 0xf17b3e011e956c3e, 0x46e3d869ab59d75a, 0xe7dbbd9285c5b7dd, 0x3622c0e9ba0339d3, 0x2983351f27e2dff3, 0x0aa12afd7e766d56, 0xe987152aefcf2921, 0x14b203fbb9e91c00, 0x0393e67ccd40e64e, 0x5d659d7be9f10fbc
+, 0xebc12901cb989b04, 0x454e282139e8ef2f, 0x49c00faa42ec27f0, 0x149964083352af9f, 0x343cd39d8d9346d6, 0x368b854bcf763a95, 0xbab047168dbbb6db, 0x6f8542085b6cedf9, 0x96f3e6e6cb154421, 0x6f1313f281d40e73, 0x5639dbe8a4cab2d9, 0x2f36f011d0f774de
+, 0xf19a0b268c54b4cb, 0x2b8679065a6720d7, 0x4b0d26b603e15b47, 0x1f4a8a915cc9f4f4, 0x0cbe5dc87579f572, 0x5baafe1f22f383dd, 0xe56d04cf18cf8d28, 0x1faff4ff788a27e7, 0x1bd858137f3cce8d, 0x170457d13e5a52f1, 0xb68a7c6149d57d5c, 0x0e541c4d91742ce6
+, 0x98d1c7f88e070020, 0x5953d0aac48217b1, 0xe28253ebe15f33ff, 0x267d1dc11e614c45, 0xbe64f50ab99e2246, 0x4eaaab5c82fe5495, 0x927d5ac07e60bed0, 0x67d3786de6aa1b4d, 0xa71962bf0f6e2945, 0x63d93844a35eea9b, 0xb34228c7d26640ac, 0x169c38d2eb28f5a1
+, 0x48cb12b26cdcfb14, 0x25f80b1d3ad98fad, 0xf4b79b30a5729594, 0x5c9cec235bcd5771, 0x413c887dbf8e603d, 0x700dd482e3e892f1, 0xb455f2d02f822e61, 0x1d4fdbde17a9924c, 0x42faa60451c2773e, 0x30527a5900dfd628, 0xf5af3754da198f65, 0x0771059b7d788d44
+, 0x4b7972b33439dc22, 0x71478457cdaa1e14, 0x5226e125ec1d58c7, 0x669d8796e78fd4f1, 0x750dd1aaaa44a07f, 0x327c62b55aebbecf, 0x006b8e95b54fbd25, 0x2ab3f95d01eb364e, 0xfcbe5080c0d5e196, 0x2a1b9bd75a57e725, 0x1d2b2b6758139b5d, 0x751cf4af849b7a73
+, 0x9b0751926df6fc45, 0x3713fc3746ed288b, 0x61f664eb6e2c9669, 0x3c634ce35c7c0237, 0x8c0cc53b361d8ef2, 0x6cbfc8f3acb061a5, 0x7de8138474b2d8ac, 0x49376f17941baeb8, 0x3a9b8aebddfae32f, 0x3e66d13dc7a35c14, 0x7113451dfd38b50b, 0x3a2b0f93dddaae4e
+, 0xac06653bfa3447a3, 0x0b1c2e92398b4b99, 0x3aeaffdf28ca4295, 0x157179fd28c78800, 0x69d0804110317557, 0x04002ce61bd7cba4, 0x08268e67e35dfc70, 0x66608a6ef657faf1, 0x06752703b65bcba9, 0x0c4c9574abb36abf, 0x0c2acc361e2106d2, 0x267e9482690093f5
+, 0xd26c94e4f1969718, 0x0616182f2c704bbe, 0x6f86326ba746cbdb, 0x391ef8149260b3f0, 0x3200b7228866233f, 0x2af3ce466a16842f, 0x47610dee99e2b9a2, 0x74569d759169324e, 0xea11303c8f692e4f, 0x04115ccea2595cab, 0x57d03d066b841a46, 0x642b40bff22a5ae1
+, 0x8bb92487f3820008, 0x3929935cbc2f6488, 0xfd2324e08f1cb5e3, 0x6ab6978f1a5c0e6a, 0x1440c7199e5b97d3, 0x48457a641682e73e, 0x423ded5fd3b3d6b4, 0x31b7633ec06cbee3, 0xb1c968ee3f8d1dbd, 0x615a680f53ac8176, 0x8d4b7045b18f7eed, 0x41ae14c2aed4e73f
+, 0xb8580aee8be393e5, 0x1cab89a2c4934f20, 0x0d852f4835a2ef60, 0x340fffd097e7f81a, 0x752cae05c14ee0c8, 0x6ea9afe8402f5bf6, 0x574819abbca080ac, 0x61da4d3aab7af143, 0x5429dbbf7e43ff7b, 0x1035ba46748b06b7, 0xd5424b30dd0bafc9, 0x6a36bfe335ed9b8b
+, 0x164a7d2e337d00a5, 0x00cee3a4cb83a4bc, 0x3498e0366dbe28f9, 0x053d899148d28502, 0x01665d64cab0fb69, 0x4a99132208d68e74, 0xba44bbd4bd3f915d, 0x1d34b0f9172122bb, 0x5d114dc729e8a9f3, 0x08e7a43dd5334b60, 0x28db8e9232f0f3e8, 0x5cb7be1b80264f62
+, 0x564b47a3b51b1dd5, 0x4fbb35f056b4d67b, 0x709e65a314e40fc3, 0x38494113b10e91d2, 0x411f7b8143f0ac1a, 0x27010551148a74ad, 0xc59b403f936ce0fb, 0x02d70852b622def4, 0x2db5117577a152f3, 0x0c1c39fb51047bb0, 0x189e49d879615298, 0x2096ffb79ae836d7
+, 0x9af2c78782508f23, 0x336ae7ccf7e3a1b2, 0x7fe2d4ee2dd194be, 0x573d2e1b2b8a6872, 0x3332ea3363b2ea36, 0x200bc1375b1f4243, 0x65c47c8c06b3260d, 0x42021fca53995c5e, 0x2f7e6cf49bb19946, 0x311fba6a23196d2c, 0xc30c13b62be0d70d, 0x61eeac142711b0dc
+, 0x50b070545eecdcae, 0x08f489e6d69d1d08, 0xcb6867e2aeb842a6, 0x3167729bb12642c1, 0xaa26b4de3309d159, 0x6d1d0bbb2402c9db, 0x99c2d5872bef011a, 0x2a05e81be471f45f, 0x3a30fd5bb3a974b7, 0x4393686e2368daeb, 0x0e1b83ee158ba2e4, 0x43c0475a8b825a32
+, 0xbd4504cfca612507, 0x0b970cccc8d8a941, 0x16aede0a90c7d242, 0x7c13b6814ee8c955, 0x5cd71dc321a01bc7, 0x4c07b8ada6471856, 0x03a3ba76676d900d, 0x470da5e83b174986, 0x377e1c453d048522, 0x5a59bed8b4693928, 0x0db948720362eb02, 0x22323e859f20ff3e
+, 0xa6a358108af312c4, 0x6980e04abb9da0fb, 0x46931d26f1f08c5d, 0x3ff2f7e43140782c, 0x6a6b24fce3e3af6f, 0x70e1cdc16b68fc2f, 0x11bbb4247f74084d, 0x3c3e25dff059601d, 0xb27352638ebac37a, 0x2b0e2285476b1681, 0xa0dcbf835bbddcee, 0x705e0d8fec9c6605
+, 0x98edca92b0fde155, 0x536e0c63b7bea1bc, 0x7bfa49d2e97e0b1e, 0x55bb3392b91d7197, 0xf958fb86819fa684, 0x2900c709abed8d5b, 0x6422f681073def6a, 0x7b34199d94e53c4c, 0x3a8c832bda634ffa, 0x534a833fa8309dd8, 0x03f0ba35a5c25a52, 0x7938eac2077bbc3c
+, 0x4e18543bd1f7d8b7, 0x6aafd240ab8a2092, 0x7cdb78f619a99e03, 0x1cedcf62e195e07c, 0x26e659a6ae23cd7d, 0x09ffe6b74f806d49, 0x0fa1afd10b17e7a5, 0x468d10ea5b08563d, 0x248285e4fc933d16, 0x62838c3b01e45f51, 0xebcb0cc66485587d, 0x6c797ba467206cda
+, 0x5280b58685995d03, 0x606f1150e4633240, 0xea995d007c83792d, 0x1bf603065f4c4287, 0xe2dd641c37d8119c, 0x793316e35d5606e5, 0xb63170127ab60572, 0x61027bc2e0fc4cd5, 0x552ab360e7202a4a, 0x04d8676d0c930d0f, 0xbb8819210551ea79, 0x5a4dc7d3f483d6a6
+, 0x2e43a271d2afb03e, 0x1323d24114df1356, 0x067f94c53b6d2923, 0x59aba78fb20617ba, 0xd3e0d1819c117353, 0x2b0a0224e5980bcc, 0x24c11d09d40e01b0, 0x25d70a30818b6396, 0xa31ce906643dc5b3, 0x7e3b66a1c533509f, 0x4be17df4c9dc9fd5, 0x0a6e3024bb6436a4
+, 0x6e5800894165b5e0, 0x3a8d7f23b76ba2f3, 0xa311893c43a53ae9, 0x0bb027c917bce773, 0x8deb3c8549630a9f, 0x30b58163fa420920, 0xcf229d5414a3301f, 0x67fc405b23c05028, 0xd294dbb0f554f8d6, 0x6b492800a2b741f9, 0x7e3ccf689bbf26dd, 0x0af8a86aa9f09864
+, 0x6471c006e2db2c44, 0x58cb4b4ec5022849, 0xdb3f3683cc6e48b5, 0x264ed2cf8427c043, 0xd128af03bb14569b, 0x42926b2ddf408af7, 0x15aa13f65f6ab04e, 0x202fc57b5b672842, 0x6bbd412cbd540414, 0x39ce8afc2aa22101, 0x41c23ff1b355bc88, 0x6a63cef601e221e8
+, 0x7a0f1d0d6591d279, 0x17960f7624bcb73f, 0xd166bf435292fd06, 0x2ce039882359cdac, 0xdb89b70389086799, 0x26ddd70f7baed463, 0x741965d06c7d80d4, 0x3c9245678ebd3d8d, 0x6052ab808a53c9b4, 0x76676cd67b5e5e92, 0x0817de0759c5ee10, 0x644e1ff9d8f9508a
+, 0x6a64f5dd05eb0513, 0x69753507863e3fc1, 0x63d3cd8d0f180aae, 0x70a78a8bf03f276c, 0xcc36fcfd3f45cf4a, 0x5554a74ac0fc1619, 0x67fd1d86df4f0278, 0x394bd9f0e4c95df3, 0x4351947f2a625ecc, 0x46306e39253fa9b0, 0xce510ac93468fb72, 0x3d059e9723f663d7
+, 0xf5eadc827b0da807, 0x35f06206ba9d1eba, 0xa6c8e98d52e15106, 0x6f5f522193d3704b, 0x7d6f73587403603b, 0x14908ad6ac52a794, 0x929448467714eb70, 0x6e0374ab4a976344, 0xcc03b2c2d6c67652, 0x284617021a2d7ca2, 0xc022e9e8702091ee, 0x4b042668e64f9c09
+, 0x2ae642221bb19d73, 0x404b18ac4050fe96, 0x608c9a16bbc6cc49, 0x3cbaa9790d453ac6, 0x5aedc139a898f056, 0x2b13c3dea3ad2858, 0xeb4398e124dfbbce, 0x5af6b63797f3cf7f, 0xb72fde6314964591, 0x72cb91524617f1dc, 0x9ddf039ca30fc524, 0x03f06c2d2d2cf525
+, 0x34d37f32b1f7b3f9, 0x176eec2727a19b10, 0x68153ee1533567c7, 0x1a1bcda922e33f6f, 0xf5f51bc3f9dc22c6, 0x2a1687d1239fc0fe, 0x132f8c27308bbe44, 0x7e7e758e2a298c3a, 0x4fc2a5a7e10bf993, 0x4c0342826fe55c24, 0x064af6d7d3d4d2ce, 0x683c3f669823c31d
+, 0xfcac132b9c844588, 0x7a636280ea9f0a98, 0x6f7d89a9d44ce744, 0x6bdd3b6115b02b88, 0x0b8f2bb394de4956, 0x743740c3cb322bfe, 0xf1bbf67047e5ccd0, 0x523220ce19b43e89, 0xf263ce42b05f6173, 0x169886da82d8bee5, 0x92b27f0ea234fd3e, 0x1bd1e9b49d6f5f7c
+, 0x0230ebade3f6d9f9, 0x308a66e8b9c9d746, 0xc422edd495815e06, 0x021009d9d29e6068, 0x191bf53bcad31bad, 0x1b618fa99541dc36, 0xa7322dd1006541a0, 0x54b673a64288e63f, 0xf6ea48b3c9948e85, 0x56d8d2ca273569ff, 0xbbafc79e2bc6df34, 0x183ac6861d5bee56
+, 0x5f7e3e7984e0f58a, 0x2193b8433994a36c, 0x1988e5320451af55, 0x56d8c4ee6ca7fad2, 0x3593781fbf9c3966, 0x16ab2d1a58c84f92, 0xaade8cf289ea109e, 0x1ac884bb4b956718, 0xdf0c0a59b66e74ee, 0x083e1d6c21627033, 0x59a4b2baaf5d936c, 0x7888af5b2db9345d
+, 0xed09b445c471c76c, 0x3659559f2bd2e4a2, 0xf3b615cd0fe0ce14, 0x61309ff30952932b, 0x9db2161a47fc622b, 0x7867a5e76f584467, 0xce2912acc6dac728, 0x156d2d68376596b6, 0x317f5d5d281fa579, 0x2ddf8292a4aa5407, 0xd281f31560d1883e, 0x6ca9c28df86c0fa8
+, 0xb984f49c623d9d05, 0x1105dd84b1d58699, 0x48ef2e23c9c22c60, 0x03f3ab68a082dae9, 0xe5bb8b78db186605, 0x5cd1dc2ba99a3ceb, 0x5370f74ce98a2f48, 0x39701fe08b83008d, 0x85dbc83e1a4e88ea, 0x00503af80e532daf, 0xb917c2b0533b196b, 0x72f4a8a210ed18fe
+, 0x48fb81c96719bd73, 0x67c73e20450449c9, 0x9bc8380f35b39f47, 0x79eaf26cfdbcbd0b, 0xa2c06cf0f8386c6c, 0x6c35e3910b05e1b4, 0xbc396569b15bad16, 0x4270b303339b2ddd, 0xf4c6c66f0c93f7a7, 0x18c0ec49adac4de0, 0x54824ac8db172563, 0x4c540c0974016160
+, 0xa782242fc7e22c50, 0x2bfbb7784fbefdf6, 0xa6f904a8c4649920, 0x024d038261d595f8, 0xa759cdae2a070db1, 0x4c7433a6a99c1ca3, 0x920195f4fd883fbe, 0x0a7bc5667819121f, 0x568538e0974142b6, 0x64df1c57a37ff296, 0xd95c727d24de91cd, 0x6d14de783a470f7a
+, 0xe1b8123f781f0b53, 0x18ccbd228a521f44, 0xcc27baf4147782e2, 0x76d9c99d3c25b0db, 0x39b62fcdb54172f4, 0x04d99eb664960848, 0xa3a07b828e18591b, 0x32929a8e031d234f, 0xc8e706abc2ea24ab, 0x6e7572be2ef11821, 0x019ffa3e50bcea20, 0x628f6b6afd287fa8
+, 0xfd194c86b5a9ab7a, 0x4ddc96561b433214, 0x9f563776618155ae, 0x14614b37d92408ce, 0x9cc5b4d2daafd7eb, 0x1c332bbaddc947ab, 0xf514344f36d19869, 0x7cf0ac4751c297c4, 0x1ed5d0f0ae787560, 0x18f72331585689e1, 0xf0b25b9edab3216e, 0x2dbdbc4fa3bb4a68
+, 0xd3384c9a461fe293, 0x3b659f279c40c7a3, 0x90dead827c2115cd, 0x57b7e015e5bd519e, 0x6be488d6cfffbebd, 0x435115b65f932150, 0xa897b16fee54ac54, 0x24f952681dc48d35, 0x52d09d7ed7565084, 0x020efbeaad6471cb, 0x889e13610a2129af, 0x736c3c59bc3da763
+, 0xb7198f25b368c207, 0x11c5ced629f45f67, 0x6d45216c09811581, 0x1acdea90826da750, 0x8c17fa38b33fdf6d, 0x745ad3fb98941a78, 0x312cbd54f53b1818, 0x79fa68d8749904f2, 0x257d30e54e156cfe, 0x128143b54634937d, 0x36e3e0774e61002a, 0x0abebba1637165dd
+, 0x0b8869c6c925b595, 0x72def91a372b2f38, 0x153b24555c31363e, 0x5b0667ae11192b57, 0xdd36b1ffb8a07d11, 0x1ed81f2670707dc1, 0x1ff3cc8663c53eea, 0x3e0f73fecb863f92, 0x6816feb44b1568ff, 0x2c4dab98cd1a884d, 0x9691b9fc4f01afdf, 0x4246d19e0b78b0c1
+, 0x2d46ba95ab2fe2c6, 0x3b779e6e95565422, 0xe3b1706a47e18778, 0x780a43bf69eaf261, 0xf902b1f579124c31, 0x134cc5d9947497dc, 0x86218b2e22c23115, 0x7f2d49c92a2cd9a2, 0x6b8644381fe042da, 0x33ed2aeba0becd3c, 0xfebb0c667fdfc1f5, 0x03f9026c39ae95fa
+, 0x14d422039d8a44e1, 0x179fa095fa5f510f, 0xce4408cfede990b0, 0x323316330af0f342, 0x9d4482dfad4338d2, 0x506a6a2748d30b05, 0x3ab32af9fac63eba, 0x7f33c138567b2abd, 0x24052bce79565336, 0x44013cacde53ec26, 0xb88915ed2eb64ecc, 0x681dd8efd58f7c7d
+, 0x6e69decc284ee109, 0x53033f8b689e79e3, 0xa65bfa2cab6b1a80, 0x43c4efb96f25d17b, 0x9d3dfcd4c471e131, 0x5e964251d209d1c5, 0x41f76308a6b7c2e2, 0x7ad4543d13132f8e, 0xbb256938f3857360, 0x4e2642cdefbdfd37, 0x0e223771c63c2719, 0x08a61aaf657e9c25
+, 0xff71032754a5db71, 0x75845d9698f5f594, 0x17577500c532b445, 0x2e73a576b01730a9, 0x9b59e97b91733f7d, 0x5832252734617040, 0x82015db5051038c6, 0x737dad8149271a9e, 0x3af6046c1073d6fb, 0x441962d6b3cea6f8, 0x92a06452fba386ba, 0x5c4c3a607fbec854
+, 0xb374d90744a6aab6, 0x0ecab733ea8f3b4c, 0x1873f5be86d18232, 0x2c0ad1f50fad0684, 0x805804984cb268f3, 0x2bd790d250dda00e, 0xfc05e094a11bd16f, 0x7403d17650a021c3, 0x31c1c270e19ec0c1, 0x53fbc21854ce6d99, 0x287afe6a52b0a293, 0x0039487fab37e226
+, 0x783765e561b2f2a7, 0x630d9881fb8c8f37, 0x16901f33f306232a, 0x3e1ac06fe719a0a1, 0x11e8f9631487416c, 0x19ef2722df9b0b9c, 0x28c09522d8d7e823, 0x389cf3ecc4593246, 0x39a10cbde7f92149, 0x73dda43d7532f765, 0xd5bfc36ec52312da, 0x272d95f30670b8d9
+, 0x91f7301951deb160, 0x2b04db83bd73c03f, 0x6a581adfc7567ae7, 0x5851d1367ee41606, 0x50d8cc30e5af3ad4, 0x22c7dcdc5abb97ed, 0x7448f192749d65f5, 0x06e13f9bb9200535, 0x5707d0c18d707963, 0x6846802b14c3f4da, 0xc9dede15e7a19cd1, 0x4bc51baa78309b52
+, 0x160e76c547c46ada, 0x0db04c158ce19a1e, 0x31c46bcc0b3c1628, 0x01e2adc779e94f2e, 0x1a74d56457db542c, 0x701e446211d5ade6, 0x065e1255a39dfde3, 0x7b4701bd97982a9a, 0xae923a632d854c5f, 0x5b2664319adfe78e, 0xa4c891e708419ce0, 0x3bbe19ff9a252b58
+, 0x92dfd7fd67d1f14c, 0x4b0faade10cf3593, 0xe99c4c8c4968a590, 0x00fe662a7504355a, 0x9ea91cad3e9a08d2, 0x0bdfd0108f54ad9e, 0x7e3f015bfd94ab41, 0x3e9836f33c233d72, 0x5865754bb315ddc2, 0x4cff6a231520585a, 0x3301a88d47582767, 0x63fb553e16251127
+, 0xe543905a1070ab27, 0x44269b9283095e72, 0xb7c9a9789587d0a8, 0x7d769688f3ae2a3b, 0x74743dec7502f046, 0x0ae356f3b129a549, 0xf0cf20b8b4447ae9, 0x2f7498ac80acc8b2, 0x29d0c7f3ba2c8cae, 0x601f7f581bb2b438, 0xabd821b5f63ea73e, 0x6cbec6b9b04bc3d7
+, 0xe23c824d5eff639f, 0x11d80d1716a28dbd, 0xb0c76db794d03a81, 0x165b52f9363906b8, 0x6ff52a4890a0a6b3, 0x0907e57ce55e76bc, 0x6e699d6df75b61e3, 0x5621baa5c1518c1d, 0x5a25a896ad9d5a91, 0x7719aefcfdd401d4, 0x987f2be7a6bf92ae, 0x758b97f52618b5a3
+, 0xa1f271d1a7b83556, 0x5ba5fa56e97f6cbe, 0xa0cb99bf2d7ec6b8, 0x2ed1add2e355dab7, 0x6b718fc50dfd14d6, 0x06954df0ba658fbd, 0x0af9cc7de4e02670, 0x4daa0f0c52cd22dd, 0x5ab870100f51607b, 0x683c8b63737f3e6f, 0x6969d689e2e11f60, 0x3f70b1174bff3189
+, 0x45e3035e6dad54a0, 0x730dcf4506df3521, 0xf133da63e24c6d49, 0x62d75c22d5be6625, 0x7a5296088f5d1cce, 0x339c87e1e9eef91d, 0xc6a4e07a98d38d8a, 0x58c5810a3cbebd3d, 0x5047d6af4da68456, 0x21a11a008e870d36, 0x1bcfe0fbd2db541e, 0x6e1a1ec110dd70b1
+, 0xf19f787592c1ff24, 0x48f21768b1a523ad, 0xed67824b6475767e, 0x202ad68a173602e4, 0x36a9100b6db0cf00, 0x340eeee1224d65bd, 0x3e1afcdf57b3e61b, 0x4969491635e956e6, 0xb46803e913615489, 0x524d32b6c9180890, 0x23eb7a2d8fab0446, 0x6d539f0da522267c
+, 0xf6a5cf872ca282b9, 0x60bd3218cdcb7596, 0x9496ad1e439b72ea, 0x616875692612dc9a, 0x87e935b09f9fb5a7, 0x28b144cc761685a4, 0x60d99d9abafab893, 0x0d3ed1ef98d65f9f, 0x4e0d7fc417ea5b6a, 0x4325f9f4760a5c49, 0x6790977af70b301b, 0x78c167ada7e584dc
+, 0x716843961f080ff4, 0x6a51e6be3deb789a, 0xbaa0c92ed856e2ce, 0x567761298f062c8b, 0x54918d0cf01a9908, 0x797de6992a3d5826, 0x920c8fae56ec3182, 0x4ae6c76f08f22856, 0xfc8e19cc86f42d2d, 0x2470a73df12735b5, 0x33d215a66bb58b8a, 0x55dcee9bdafda377
+, 0x1dd721e7ac62ca6b, 0x6cf4e878f76835ef, 0x9996cc339cb9ab97, 0x26b3acae0cd9ae4e, 0xa2ef862190fe9b2d, 0x6dd2a4ce1b3a19a1, 0x2ad111bcd006568d, 0x45c43cec3ebc7f14, 0x8851aac75db0494e, 0x129b1a3c6688eff0, 0x836a54e8238dc471, 0x45c57d2ea881dd4a
+, 0x6009f0a4cf71c19a, 0x4066cbe99aabf06e, 0xe9db9fd94fecf5e9, 0x7fab7306707cd749, 0xc1c0e45506ffd6e7, 0x058e5ccf8235edd6, 0xa2d9ec2e46183c24, 0x28e37b560b00b983, 0x63c83599b1849a55, 0x151c92bda045c6bc, 0xbe803aae49ef9e90, 0x4452d2bcc69b924e
+, 0x594fb76c942649b2, 0x2ecd57340fff0af4, 0x1bda1f61a380e931, 0x628b25a77cd124b9, 0x2ea50b136c26c736, 0x6fc5bcaa45415c03, 0x52f7ee09dfebefb0, 0x3bff0e439062a91d, 0x2f42e131284b96a6, 0x2d13dede61cec241, 0x3b71a6425f9f1b5f, 0x17b09d37027386b1
+, 0x75dac5bfcd0d5464, 0x6bcb1d958a788eaf, 0x2c51b9ffefc1a16c, 0x167a73d74b44c1af, 0x0ee9d959ef7c8616, 0x191360375efb2a51, 0x11d8d7b6072df650, 0x4289530426786e8d, 0xcf09f0d05f8fd5c0, 0x5bbbf04fe3f0eca4, 0xc445424b9125af94, 0x245060716be79371
+, 0xe6e470f7111f377e, 0x14935dce65442aed, 0x217f91ad75f1bd37, 0x3121ab265e6ef108, 0x8262cc83cbd34109, 0x03c3380a70c0a622, 0xc93b07be9c21ccff, 0x6891c51f4072a06f, 0xf2f0346f42a69a52, 0x7e15afb95134cc4f, 0x86802aca18f3cf56, 0x6a0d79cdf1a7532e
+, 0xc2f6186f6011af66, 0x600474e0240e8559, 0xe6e7b19e56c2d57d, 0x30f1984737e1df79, 0x424581b9099a8cf7, 0x0ebaa91ed940725a, 0xa635aceed4986f75, 0x249b0adee39dacec, 0x862ee8540ddf0180, 0x31b6495ed0b93130, 0x5025df333ef03848, 0x12aa926b8d2ddfb4
+, 0x918aeaf0b4530cbf, 0x3c60efebc8f78a07, 0xb26ca282d679a057, 0x478cf067e4498f3d, 0x70febb1db9ef4af3, 0x709c5a2e7ddb97f5, 0xc20315e1d53968f2, 0x74c750e8c5eb7b37, 0x8ab439e4fc241775, 0x502790ef33ee5ab6, 0x24c9faae99445d12, 0x791cc640fa71eed0
+, 0x784c21cc067e76e7, 0x157e16fea0ba16e1, 0x649febe7bbf82175, 0x680f6a7655f4d1ff, 0xff6a744bb38011a7, 0x1adbfdf2465ce9f6, 0x78e477b91eb34c2a, 0x5f3bc15feb640e95, 0xa2507f9ae7e2bb80, 0x628fb3b10be885ca, 0xb72837ee7db666b9, 0x5e8393da23ee9e99
+, 0x758a082b87975031, 0x577c5cdbfd7f859c, 0xf625f68a7f05ef99, 0x2e307cbab62d8856, 0x48d70a5e13482427, 0x09210e36a07a1480, 0x0e62aa97a582156e, 0x528e2ea0c244037b, 0xfd7d6998d3890b2c, 0x3646e67ff7340e0a, 0xa7da340396922a82, 0x3f34030608d3d108
+, 0x56fd1c357366b82e, 0x4bf966112546c2d8, 0x5faed7ff9745a70c, 0x5f7218e79cd93af2, 0xe16ce6b26ccf6ab7, 0x09593a283e5bf02d, 0x228078505cfd0a98, 0x5321369fb93ce772, 0xb9244224e4769a8e, 0x0cc508117b9d6d4a, 0x499d7de8cf311505, 0x6d742f8480437a8e
+, 0x0b512cedcbfd2e02, 0x409ebfbdb377e679, 0x98feb12511c6d0a0, 0x3c2c5219a140fdd4, 0x68dd61a53756c717, 0x5a19c97040c4b9c9, 0x3d85a8396a9a6d3e, 0x642a07891a1fbbf0, 0xabf9f60596d82e80, 0x5a56e499c72c5e76, 0xc85ee161d0d13180, 0x793b751056800162
+, 0x172ea3d0b0a0a215, 0x1d619b8ba2736941, 0x2b0cd65a7e8ef170, 0x7bcc540ca6b30f49, 0xb465111e34124e28, 0x2e9851fdf0b6710e, 0x87702c3103552cfd, 0x10a4207d56f7f710, 0x392255304e6b10fa, 0x24c8d1d7c1d3d732, 0x3684150f5293235a, 0x5a2c443ec36c4804
+, 0x991d5aba71473c60, 0x1d3540eafaf322a8, 0xba0d96f66cd7abe9, 0x014b02540db59847, 0x5d567174760a582c, 0x76867841bb7058a0, 0x19cba543e3b9515b, 0x0f8dfb35536e59fe, 0x461a614e4d1a025c, 0x5e18612ca848ad56, 0xc1217013f704f6cb, 0x5040243fb6648207
+, 0xe1cdf845b9c2f7d9, 0x43318ef4d1fe52fc, 0x44dacb0ffb98a6da, 0x3104c4f640f281af, 0x721dc51b6e7fd7cb, 0x6e138c15ec5dc7da, 0x72e21d2d8483069a, 0x42a5126b63273228, 0xe9cc0076317d663b, 0x053f1d35820df3fd, 0x669b7d87f7098c8c, 0x6f34787be547af24
+, 0x791367de6687319e, 0x7b7df6f8e9e6cfb7, 0x38c749713f1a54b6, 0x52c2e29b0598ea9f, 0xe1655bdc87cc814d, 0x17f4eaef8f77ffd5, 0x2a4f26be9382302a, 0x016ee2214542da6a, 0xd1441bcbff8c6360, 0x53e68e0212abc0aa, 0x926baa7a182ed1c8, 0x4d8c0251fb5ba67f
+, 0x2a95d2ae69b3dae8, 0x1ace4f03edf78fa6, 0x252038ee8ae09a84, 0x191fc83d35cae3f6, 0x6f57af818bd2e73f, 0x58732c6ac8ba76dd, 0xcaa8bae3c599b75f, 0x294c3f6beab58f07, 0xb61e3dd68e94be83, 0x0ad7eb49dc7d9ebc, 0x4d1dda8108cdd735, 0x32f7e0400f694a1d
+, 0x4208ad3b8f894a23, 0x304ec770ddae5114, 0xe1505decd3cb34c8, 0x4ceba37a930ff6df, 0xfcea9e7a5a0e0c3e, 0x4e05b314fe837080, 0x02164241a73c8c5e, 0x7409d33891f4afe5, 0xed66a314d7288397, 0x1e367f1a65aa6568, 0x70ee330bef23a378, 0x1ad844ba4c88248d
+, 0x43a304461ed8bec9, 0x158c8a0bb9106f06, 0x09e8928ada4fbf6d, 0x1af4ef540bebdb24, 0x5cb7b4c7650c95e7, 0x4e3dd3dbe2361fb2, 0x4bbfbfeada69d973, 0x5407703b19afd24c, 0x57e390dbd2470c3d, 0x18ea41723fe921cb, 0x298a9ee5e3aa3a9d, 0x004981bd7b54e03b
+, 0x3010240867ab3733, 0x2b166c562b99b57a, 0x2e86a98d093f0318, 0x23c636b52313903c, 0x5c08b57ce1d8cfad, 0x097cd1673280955b, 0x193a1e2b608c3a6b, 0x078f1ed53395de73, 0xc75b4858d3c2da0d, 0x557676a7c9bbfe31, 0xa318cde4aeb70173, 0x6bcf26eec10652f4
+, 0x42b7bf1a3351840d, 0x0984ec5af0804014, 0xcafee6944c559bf4, 0x6ef880c288bdb32b, 0x1747837416461f0a, 0x135fa19490a28bc9, 0x303ccbb31fce7bbb, 0x1f484672ed2fae1b, 0xac3bb06bc220a34a, 0x057d08a5c80a07f0, 0x4dde392bfb117898, 0x273eaa24057082c1
+, 0x21fd59c0a107c561, 0x43b5867434d116a3, 0x9700dc8caaec895e, 0x711c578d9416ef2f, 0x1c151e5b4992dc8e, 0x330643d323fa9e47, 0xba0e5aa51d815709, 0x2ccb755786c640ec, 0x6afbd34a103a7670, 0x2a27cfe25f53b232, 0xc945ef6c02879c4f, 0x56352adbbf794029
+, 0x20545b473d7554b3, 0x30379dd8039b16e8, 0x9300a468d20338d2, 0x4b831d3beb506c4a, 0x6ca8dba7e287f573, 0x347fdd88224d6f46, 0xc626e12ffd50072a, 0x6ffe925f0e34c106, 0xba7a927e13c571c0, 0x0ecf4f376429f420, 0xd3b6e2c227e7001b, 0x515e918f9314626a
+, 0x6a2b1e6fd315dede, 0x55d367f1e49d3965, 0x4cd7c0f4f73f8683, 0x4385a293cf2bbbf6, 0x2169a5fbf654ec06, 0x0a0d85258cbe7e1d, 0x593f4a49f279b330, 0x2aed5bf9aef829b5, 0x90c3e0867b6428d0, 0x3bbccc3e06dfb938, 0x8edc6c5d727f9486, 0x0742e960ee88b0a8
+, 0x7c8254503c978055, 0x4c7713b2b394a1be, 0x56a82fbafcf013c2, 0x61cbb9cdbaf5dfd8, 0x384d75036e677ff6, 0x48101ba048560b36, 0x58606a00d50432a1, 0x78f9034117ba77a9, 0x962f1b2289dca2f5, 0x1538daa19367c1d5, 0x5a455fbeeabb2c27, 0x1202a70e51a4a17e
+, 0xf6bc4482c671066d, 0x1f90e0438ed1909b, 0xacfc087e36e20951, 0x1b8bde47a7382953, 0xdf4a1052ffa87355, 0x5cf20b3b13b0c725, 0x50f47177df8b2847, 0x2e9e060072654d01, 0x5a6fd74a37e07d3f, 0x5bfb979e07e333c2, 0xb8ec5419369e41ff, 0x220ec110f1ba55b9
+, 0xa0b3ff7889f80832, 0x23be9d8690a707fa, 0xf40bde6a296c7ace, 0x678c7e2e007eb48c, 0x8471ae8e998f4434, 0x2dd22133668ce648, 0x0ae30ad9ba560dc5, 0x463de9e66db135ef, 0xf84661b508574ca9, 0x108b5ebace090279, 0x68d02a39300c1e46, 0x2931c3da809e657e
+, 0x8da7e107188f05e7, 0x363f911228cdeb79, 0x5864b86092c32291, 0x2581ff535e693666, 0x2324aceb0254e80a, 0x6f0471fb5977525c, 0x22342b9952de99a4, 0x4045ccc8d893b3f9, 0x79d24bc55ca4fe47, 0x0478b519bdc62c3e, 0x73d5a7d7c8f2e86a, 0x71f505d7e11b80b7
+, 0x082c9fc723557f15, 0x62ba92625fd01db2, 0xc715712dd11a82d8, 0x53f0d0e9b9a5d44d, 0xb8b71dd5eb6cb072, 0x50641353884acfdc, 0x1003e6cee037274c, 0x414aeee2ea38eba0, 0xd334afefcc445912, 0x7f709909c48658ab, 0x76e3c00b33d48ac1, 0x25b54127c973e390
+, 0xbfa5b7c5c7dc2ada, 0x77fbeea161711777, 0x320f054df85cd20d, 0x14a6fe68dda119dc, 0x04ed28dd51b974b5, 0x17ef8902b5893447, 0xb48b2625f769826d, 0x4f9c617a7e094afe, 0xf7771dcf516d9bb7, 0x0e3d1d566b4c34a7, 0xe0597315640d6328, 0x25c29e5f4e0f6dfb
+, 0x66ad7ba769b720c3, 0x5ac4462e8dcd605d, 0x6e245281eda76b75, 0x6b0d5ddf0502ab5f, 0x8266fa8de5ec96bf, 0x7d36e100aa3662b1, 0x1c9778a616fbea30, 0x2f70b21f8ae560c0, 0xbc3b30b9d2e9cbf6, 0x58698153b7d89e97, 0xe4690c9624e0b908, 0x676bd8e4e1ebea5a
+, 0x401eef0881ecaf5e, 0x2cbb1b13d3fee363, 0x92b7bc5dac841032, 0x3cebac79eb0656a9, 0xad6cb0f0b0331acf, 0x709a58bcafa4a64a, 0xd3c8c41f22e4c8a2, 0x6cfffca2448a8454, 0x50568fe7f7c8fe83, 0x020434133b47c6dc, 0xd0b8c42502c7b406, 0x0ec24950746ec8b1
+, 0x901f7f4b612a75ec, 0x720ecc60999a4495, 0x567f627d5c8cc68c, 0x13019586f63e8855, 0x13162cfabf5a0fb0, 0x19f1d5bbc4311067, 0x8830dd5238edf93d, 0x543a0fbb06e4c1f3, 0xcc4d53223c14c63c, 0x3713a0703a6489ca, 0xfbcfa4b0778ccd48, 0x6e17b6a7b221bfce
+, 0x43d19fcf26a0995f, 0x39c8dee311401e52, 0x46c1426b0ca49dc6, 0x2518347d72bb428a, 0x733180104ce6c50c, 0x1b0326a1b4830753, 0x9519a1592be16f6e, 0x210024f421458670, 0x6b82468ac0761778, 0x3e813d6c01ed8106, 0xa00491d0f9d30010, 0x70ab4b288ea7583c
+, 0xa980b30c81650755, 0x77f9febe66b62818, 0x5ad8ef8507aa188a, 0x26cee93c60dba1d9, 0x5948b110c387b0e8, 0x442c09f05ab70610, 0xdfe1c9239ad0da27, 0x7179bcbef717e586, 0x35727571c961aaf2, 0x4e6794329d9c02cc, 0x4d36768ca9a3f830, 0x4e1e62ac8b047f65
+, 0x6cb32040afe350f6, 0x1674d53d16f36509, 0x3c253e4cd9b386f5, 0x78b2520fa3ad7713, 0x828641039b7a817d, 0x684f73cb6a3ae4a2, 0x87d07e0ec9c283ea, 0x7455bbc48b05b61b, 0xe1b18dba3d4591e2, 0x5bf07619d0f53be8, 0x8284d3b005cdaed8, 0x305f1917dab1622a
+, 0xf7f5f5c0d5b272cb, 0x0feb10fd4a73d737, 0x33bf7eb2d5ee3c4b, 0x036f930206573e92, 0x5b7aac4cf179f547, 0x1bd3ec11878eab8c, 0x6ff7699cfe749944, 0x73860f8108737861, 0x3a46013b075e7c1c, 0x342f1ac6c9aa6409, 0x2b9edf216f8a8c29, 0x5661b338d5df6d51
+, 0x9781568c6e933c41, 0x6f05ca76011bd5fa, 0xa8b4c27c91ed6ebd, 0x4a43d58613be0c64, 0x974770c46dd321fc, 0x6accaac4a7e490af, 0x2d43aa558713e06f, 0x663865b921a412a9, 0x455b5a2f8a778575, 0x7b7f82b5bc73b5e6, 0x1d6260ec5757c98e, 0x3fe9ef4eab1ff854
+, 0x3419f127f0720f7a, 0x3e3e148e358deff7, 0xab14c62df99fa815, 0x391de6001371204b, 0x7129e9b0f693cbcd, 0x6b60062596f22f95, 0x3001e7eebc180ac3, 0x344fce66bd1af0ce, 0x90f02a330f208776, 0x5e9b77017f819321, 0x6eca4132eafdaaca, 0x3a70d97e6dc283ac
+, 0x0c9db70ec09b0164, 0x472e61d8cb2ab9a1, 0x2af1203173e49e51, 0x7b0504b803f55934, 0xa4e87b78e8d50035, 0x5442a49401d6af8e, 0xa47c44f4c6c982c7, 0x2b0e3c281ee2da1f, 0x87f90be31d8df81a, 0x1f41dccbcf994a82, 0x020f2c20709a5715, 0x58916f5301c5acdc
+, 0xfe8008f0f74dbb72, 0x7737308a14dcf7b0, 0x8bff3959fa0a678c, 0x7f1e2cfcc0ad3a71, 0x2a2084bea11ebc21, 0x77648bc3ba9c7392, 0x67b978367455db20, 0x48b5f84cf3066b54, 0xb9472aba08d13942, 0x478324152a49690a, 0x88eedadb1abe487b, 0x7cfe9664702451d2
+, 0x43938a5f52b1742e, 0x7cf8c555422b39ca, 0xc328326c9b5ef9fe, 0x11233ed3a82b11e6, 0x895c0b9f102af1d2, 0x4bd540148cae2ae7, 0xca598881dc5b4a3b, 0x22507846f6c08e4b, 0x806e232a06767ad0, 0x307fbe427c864cd8, 0xecb0068fae60340c, 0x29d05a8a9c79de02
+, 0xa65f87a2d111ac7c, 0x226ada48ed05fd01, 0x70d78dca638d9ec0, 0x487dd276e8a6d89b, 0x69b906588accca01, 0x1d15a82f3acbc591, 0x3fa1a73e904f93ea, 0x462fac121a7e5c5a, 0xdf25cecdc20cb3c0, 0x6f49803891cf764f, 0x6b81202ec1d0e7e9, 0x065af84e3689a88b
+, 0xb7f19abc0ac8ce28, 0x58ea9524263a4c91, 0x088213197c9acd9c, 0x7d75caed27986411, 0x23dfb4b8054b8401, 0x4cec44672efe50bc, 0x324fbdc27acf564b, 0x6438c2f916c797dc, 0x24c8011f9ab55e86, 0x4a8c7f3b0147a75f, 0x45343a652c5e595a, 0x4bb08d013c8b238b
+, 0x88526996597d35d4, 0x70169bcbe6bd21d7, 0xa0f1b2d0ad29a510, 0x2ade531472c1b94d, 0x11e320dc189873e7, 0x2d2a1794e85cdb38, 0xa0a8c453a6f621e3, 0x4b06d5b54525f6f7, 0xf42916691848ec1c, 0x1d4216555d578730, 0xf8c60da7290a5b4e, 0x66dd9f39a1f3565f
+, 0x48c340988505cd50, 0x3ced1f2e34cd615d, 0x457913247fd3c5e8, 0x7fbfc2faa44da7f5, 0x86cbb675b85cc207, 0x5906e34141cc13a6, 0x3ae0c47335b206d1, 0x424c4b41714194fe, 0xf250ba52f45759d5, 0x677519534151c210, 0x03d76114be288e90, 0x09749f1fe6e3806d
+, 0x55ac29d937b474a0, 0x4291967a4a369ee4, 0x918dacaa12e6bc89, 0x3d46e8900651c310, 0xaf055430a00e90b1, 0x16f62bf56da5ca39, 0x1a021c33488c51e6, 0x0d64dadf63fbbcd5, 0x0918ece59dbfea7c, 0x3b3319d7dd74203a, 0x1d88545b8b9fa90c, 0x13b792dc908c59e6
+, 0x1c2db1407dfbcc04, 0x784d0423af4a4be9, 0xcd96d80a43a133bb, 0x0070648b8dcccb8b, 0xadafaa6d23f22deb, 0x7ac4592c26170114, 0xff8e1b66b3df4658, 0x14f58b294641d7a2, 0x9f0468832f48abd8, 0x6fc4e4691c35c4db, 0xace35e645b5cacf0, 0x5c0571c40750c77f
+, 0xf4dda0995ef00cbf, 0x454646f3f191bfd0, 0xc4beb3b4d2d9f72a, 0x218f4bef8b3dd7a1, 0x2cff11eafd69743d, 0x3fc1fe08e07f53af, 0x78669ae0bc051fb9, 0x277104b710aee834, 0xceb3e8260bf24100, 0x032d344c625d712b, 0xcb0ae3256594725e, 0x5154efafd1ce7c71
+, 0xce5fff266db2fb96, 0x6e69474ba21d0cfb, 0xf1bfd8bfc59eb7b1, 0x1d080467c8809764, 0x249292f8398f4f61, 0x4d4bb7d25ef714a1, 0x7d088989d11d8628, 0x522c29bf62e1ab67, 0xfe9f9237fdcb9d64, 0x722673f3c4e41b95, 0xf10fcfe8db350c96, 0x6ad3c7ead46ae7f1
+, 0x0e63663b2ea0f702, 0x55ad720d9b178b20, 0x14566d4cba1ae0b6, 0x558227e4f0e33b0c, 0x6e61adad1ea828d7, 0x44d03385857d4df9, 0x5103dbd23bbf0a3f, 0x589159282547570b, 0xfc3fb6b6a1146bda, 0x78fa0782839297eb, 0xdc594b21b2282f5c, 0x67d0ec5237e66bcf
+, 0x6ff7a560584ad2cb, 0x4251053785caa9e7, 0xe185502f9ab9f2fe, 0x47f1a7d25aa70fac, 0xcbeb63f215ad5213, 0x0df5708d00bf1ced, 0xe36eb19b473d2a1d, 0x72926bb0ec5bba39, 0xc1a3c342bc61a1db, 0x5ca612ea442e7c1c, 0x43fdd47f8db25d4c, 0x70d0960ac5f4f415
+, 0x0a2d939a9c3d0979, 0x321a5dbeb74bf127, 0x5e5947fff66d8470, 0x22ec9ecafd26bc99, 0xde17ca8293b10536, 0x593f56c0559dd846, 0x1148373375485023, 0x23c6b0fdf7448b1c, 0x377904458a27804f, 0x573e91962726ea70, 0x35e1b24f3235ac70, 0x51ba082049f4f85e
+, 0x41779686264fe771, 0x790ae9fcbba21d74, 0xccb4ae45bb0b5f41, 0x0e4a93ba79f18da5, 0x77cbb73423a46ed9, 0x6dbad4807c6336e5, 0x9bd3fcd85a141549, 0x2bb73a3f6b68133a, 0xffadf5e6463c2570, 0x55ff584ca1403948, 0x2c8a55e25a6f56b2, 0x578fe4596cdbf2ae
+, 0x4bc4918160d47194, 0x5d29a21e3308e1dd, 0x7e15894b3e6e4e33, 0x50dbbd2f4f31d0fb, 0xef248bd235a9c9de, 0x3418add21b634710, 0x96c7233a52363bd2, 0x7c8414ad9a08c99f, 0xbc6acb4a54e6c05c, 0x5729021a1193579a, 0x0627c3e00b08fa1c, 0x3d0b4ff9e17c2a73
+, 0xb6cbdefc246c3c8a, 0x1357e826383f8cb4, 0x43ffb1b2eaacc0c7, 0x1d641d36b3f8b3f4, 0x0b8060f54f03e1ca, 0x487d86b7a35e04a6, 0x4c855dab11a0ed02, 0x491fe4d04eb74e8a, 0x583a80f8d2c64382, 0x454c645438e9c812, 0x5cf4e0a02f33f43c, 0x2bcc64d6f9be8523
+, 0x02f714c423db6d8e, 0x6327f53b766123d0, 0xb1e503adbd69612e, 0x1ccf5c4fb1985b8e, 0x628990d4f59f8192, 0x73c65267140cb43a, 0xd7959450b0a79744, 0x6fdb3474025e137d, 0x5a5ee3eb99a2b1c5, 0x2c745090199f3c15, 0x4f8d3b7d529632a0, 0x29b84fac7906e571
+, 0x84e88089c40286a4, 0x0393e524b18112e9, 0x7a527eeeb2b073c2, 0x13a826522eb53b19, 0x03c476614339d0d7, 0x2b31b7f60b44e921, 0x999389da9f83303f, 0x68a5582fa316033e, 0x8333aed7df83066b, 0x3d05d9c4376a907e, 0xadd7cd0d1c2bb595, 0x495d90bdd0f07b25
+, 0xbb5e0174247aaaff, 0x28352f7a4512b585, 0x21071fa14d2be46f, 0x64596db84b140cb2, 0x8e2eb57c41c0638a, 0x29c137d4d45ecb6c, 0x4344d39e93e91d8e, 0x51ab4acbf03f7638, 0x3cf8b16a92771c16, 0x577ece22ad87afb8, 0xc2bb7d9bdda7f3a4, 0x5e0cce36d07f1f73
+, 0x0fcb7a89cbbed233, 0x59f4beaa322d60d5, 0x8ac91a7af5c12c06, 0x6ad4e29d143f1e4e, 0xf99337418a991e99, 0x4ec278d8a80f6778, 0x0929058bfd047ec2, 0x7bd8596e73acf61c, 0x8e90f1463e5451da, 0x330e5f922fbabc2b, 0x5b428b0a3792f77a, 0x52c3e10f99249e88
+, 0xda34a4972dd630b0, 0x26b654275dd65f98, 0xe387ac1fceb9f7ca, 0x20b17b5024d57f30, 0x6160f8ee932aae3f, 0x79b92ae0ccc6f00e, 0xbc68ab9cfd0a2056, 0x21c340ec281b5c1b, 0xec03212a8e42465e, 0x76f232e53ad5781e, 0xd6516a4d65fe20bc, 0x2647ed18f028cb01
+, 0x0d746890fa13fda7, 0x7ab492038dcac92b, 0x35ea6a6ea2cfb195, 0x49fc8d7d7fcd86e8, 0x74d3c9c6b2e3ffe5, 0x62e7bd56dc6a9a6d, 0x98a0ab423b9f137d, 0x563a799917602331, 0xdf5b6909c990297d, 0x76a2a654569498f9, 0x50b80092a480a709, 0x1be8ac52bc720260
+, 0x80a9f393fcaf56f5, 0x6dbf46e17a2550a2, 0x5058c881c58036e6, 0x082a4a6f0cc37009, 0x04a577fb9e2f6781, 0x6279063797b9e8a0, 0xb9ea63b6617b510c, 0x39ff8b1a0ee661d2, 0xf934ef7160abe7be, 0x1a5bc1ce492711de, 0xd9b4080900693d23, 0x2a312c03c9295298
+, 0x1779c2ddd2fdbaec, 0x25171891388a9ac2, 0xf06684a03058e31c, 0x5921f2c6be2436f1, 0xdff259b7af900b1d, 0x58bfde0ce0f45ae8, 0x0f2efe828a95797b, 0x1f27868873d03a1f, 0xbee46d123181264c, 0x2ee5d7379eeb08fe, 0x128cc18068990b9a, 0x4ed10dbcc671d736
+, 0xc480102358efa169, 0x0f9995077963011d, 0xc83afd7f8b71d1f8, 0x3af4485839ecd974, 0xc6d187ef48594b21, 0x797924cbb7c3a177, 0x1fad3d14e0a6edb3, 0x7af11e5df34c22fa, 0x8761299c9ffd1f2d, 0x7ca99f53fd0759d8, 0x6baa7ce91386df61, 0x2403d4e11e4ad8d9
+, 0xe77f709ca2738e80, 0x20ba9e9d2da1a515, 0xcac2a1738098c7ef, 0x792ee79d750317a1, 0x9e31051b692ba9e1, 0x691eaaff10ef4b89, 0x2ef84edafc1cdc97, 0x35cb99216c906a6f, 0xab1d473e017eaf46, 0x53342e9bd1fdf911, 0x146e5994773e201b, 0x3fdbaf2c5f14174e
+, 0x19a7df4409f53465, 0x44ebf35d20171b0a, 0x352b00dae71a415c, 0x3d34949dd156d189, 0x0c27552a97011861, 0x61d5dbec39d43092, 0xf7871117bcfa9c05, 0x592d64b43179dace, 0x7dad4b0dcb2704e5, 0x6ef4a80e5b766475, 0x5282c5a2076319b9, 0x28dc320944e239c3
+, 0x0b17cebf8f5bc0dc, 0x1dc501536ed2057b, 0xbf2bf8438f4e3622, 0x0e2e6212318c0134, 0xbb2324c11c198a53, 0x67f44d8f9b78bd5f, 0xbc38c51cef9943e4, 0x64e7db3067c308af, 0x0d9b1c8416b38174, 0x2c4de61dd6b6b55b, 0x2835878b42192a60, 0x6bf52f724fae3d54
+, 0x709eb319948249a8, 0x6eb1172908071c23, 0xc64ffeeb9ce45a11, 0x4549a5c405848a98, 0x946389dabf14793e, 0x56041b2c23cb2fdd, 0xb46ab354ae7ca35d, 0x68ee5f4754de982c, 0xd84be43c2863c089, 0x516910cf12a10db2, 0xe77c62c5343f2fdb, 0x35340fe48d441ad1
+, 0x13d2ab3104e1662d, 0x0ef5afb2d2ab5eb8, 0xa764686f1f686db7, 0x73c63cf14739fad3, 0x10c4f8f8d5186716, 0x2ea181bc016717f0, 0x18d52f0807d75193, 0x6a74e57694103f0f, 0xcf3a7e61a373d2fc, 0x7a5b399eb30e4a2d, 0x10c279db95b26929, 0x2009bea06f150096
+, 0x3ae55cd13b009cca, 0x2dc591a2a9431341, 0x33b8ddbdd3542cdb, 0x4d1426c12826ffca, 0xb59a7bb08cae3c2c, 0x40692574b8e0decc, 0x1479e15c335a0012, 0x1b21fab63396510b, 0x1e1f804094fa71e3, 0x7b89c0335d16c4f3, 0x605a038648aa0b69, 0x7c4704f2709c517d
+, 0xc65086a3c446c57e, 0x762b668be02b910a, 0x562cf4b4b8b7ed99, 0x15b39ede06ca4736, 0x71f21a62dbdfb8d9, 0x196fadd88b5c2d1d, 0x83ac8bd39bf32f90, 0x3dc5e2f39e246508, 0x6cd2af93b23d5c2e, 0x21ae0873c893d906, 0xb6241895574477ad, 0x4e3febb65875d5b4
+, 0x6e55ff9dde69cf6c, 0x5b349cef90d73567, 0x297d2bbdf01b0f33, 0x383e5ddaf445f0dc, 0x48f95ec383a24687, 0x13c0fda815116a8d, 0x0ece67a4b13b0a52, 0x21d3607bab5d2c52, 0x33e7c2a38071f6b7, 0x6ea09ede32d916b1, 0x756914663267c72c, 0x1e1426c259ca451f
+, 0x5943528ca7d068c9, 0x3faf2b007fae1018, 0x2285b4d20c8eedfa, 0x5ae7519285233445, 0x869d68398d9cecc5, 0x28d6b253c13910a5, 0xb2876937b0575868, 0x4b5829ff6009b330, 0x23b6cb553feb8358, 0x1aa9285d47555dbb, 0xfb0299fe1546274c, 0x20e4bb0323e8f5c2
+, 0x5ae7f35805d65333, 0x2f8fbd94a5e694eb, 0xe503878030aba018, 0x65c53b1e1077bec9, 0xbd360326b8bca8f8, 0x3e2b5ea7a9f3a52e, 0xc01c6747daf2cb99, 0x3c97f6cc216638ff, 0xfc125ff233d6ef0c, 0x4b7a14e573f3202c, 0xb2c4cdbfa607c961, 0x436aaec39c6667cb
+, 0x46fc227fc0b7df69, 0x5e494a2061569df4, 0x00720a7636fa87ba, 0x54b3e09f2164c224, 0x8c8c54d1bfb05d4e, 0x57298ee9825c3018, 0xada00ae79a8ceee0, 0x64fbb06aa42f29c1, 0x39fbc06c69fac3eb, 0x10a0c1c072b3ce12, 0x68bc9e834150de3f, 0x4582d286508665ab
+, 0xd507e8755990317f, 0x75b27bb3bc7bfe48, 0x44a80f2c6ce651f5, 0x7b9795fc1b706e46, 0x9de75bdefdf9a640, 0x75ade50ababffaa8, 0xce0ab116870889a0, 0x6f3ddcfcdd59ec6c, 0x6e36833588de0674, 0x291d1129ea28a073, 0xf8b8e53864884d61, 0x706ef8f1ae854d76
+, 0x0baa1a2bd352d127, 0x2d97586ca91e3676, 0x2ada69c109b4ab8d, 0x1535de1188ccd45d, 0xa245d99ff35c5a67, 0x61fb26f53b84e12a, 0xce6a49f5424f42a1, 0x2ed756beb508e254, 0x33c3bdafed4677b8, 0x2c9f070b51fbf321, 0xc66e198d443fa793, 0x0db35b7bcabdbaaf
+, 0x137a8c6583753069, 0x01e45f1cc620f966, 0xe28e1ff82f76c7ba, 0x36d29eace3e89c54, 0x83379f157f0b49cb, 0x65e9c39e2bacb937, 0x9b323c45070cda3e, 0x16e02f31ab7e2de5, 0x53bcf346635122b7, 0x1fd7e207d6c2de09, 0x3a5f5f94ea1e57ac, 0x0cba06e8d0f0b4df
+, 0x13a01aa025795834, 0x2f7322cdc579b620, 0x0194904c53e51444, 0x23c42f5616653755, 0xb1cea15edb818a17, 0x12ca63321a49d2c2, 0xcc60482263046f00, 0x2bb1ca42ab200f3d, 0x292ea9ef3514c161, 0x537ee4639759e487, 0xf84e1a313999271b, 0x7940b9fe3f8bf28d
+, 0x4de447dfb5f66bdc, 0x0be49f06feb0c474, 0xfdb48112ede41de5, 0x2fceeabcb4ee7c8f, 0x50a73bed24bf46ed, 0x6de00766e39d0603, 0x1299342f4c170388, 0x157830195a5a2406, 0x271d2833959a44ac, 0x1fe269450d7508ca, 0x453f48a43a1d1b04, 0x44c0ca3c46ede2c1
+, 0xc3cd44474e0ee939, 0x169b48cf6ecc4f9e, 0x782b12866b16730e, 0x1b089c19a7300a83, 0x087ee8b5514879b7, 0x30b1533b3565a61a, 0xdc075e989cee8090, 0x746717180a26ec28, 0x5f9ebc26038ee70e, 0x78b78bdb39e43b34, 0xdc36948f2d311f35, 0x6072c9b88824d4bd
+, 0xab5f90a84deb4e62, 0x0fbaec6afef2468f, 0x3d7915b6d1176ddd, 0x48c8fdce256b3b5c, 0xcdab794062475eb1, 0x48d4586131a38b26, 0xddfb26aa1bca4096, 0x5d01ef4832915868, 0x64801279e944dd62, 0x269cda88a794e65e, 0xb03fbbff2b358aae, 0x3cf442455745bce7
+, 0x8dc44492f44ac54c, 0x51b9f862f7dd8809, 0x0b54939ab080e903, 0x2f3160a8e9cad1c9, 0x01423365f4531413, 0x2f9b643f0cedd991, 0x1ca4744e2e88dfe1, 0x2111bc3202d83d78, 0xa679565e75f4b1cd, 0x04f6e072654ef3da, 0xbfeb45401f7a4e7c, 0x495763c83ce44478
+, 0x70b440c387a9c392, 0x1e7dc143dee1d800, 0x5498ba6d7239912b, 0x332870a017182d14, 0x6be306fc672d794c, 0x2c2ce211245b2b4e, 0x109b722c8d2ba79f, 0x268520fa9c5f727a, 0x515b300524fe78ee, 0x736201eccbaea698, 0x4608ac113210bf78, 0x32d8fd919c441843
+, 0x1bd4b03ae3527984, 0x3e9bcbb8137584aa, 0xc877cfd1b72293d6, 0x301dce22514f4775, 0x4167cb43464831dc, 0x7b97bb44435603d7, 0xfaa4a337307565c7, 0x27ae50d5ef64c573, 0x1deaac836c5d0e2c, 0x0da4796bef45308a, 0x9d3a0998a9d1fd51, 0x32db8e276af57eef
+, 0xc9557e1b04b8f2d8, 0x775437f798dc7459, 0x1200f5585ba417f5, 0x2e00ec5f3e7ad304, 0xfc873d5f2b446288, 0x32270a93624876e4, 0xc646a47c08789b22, 0x2370d9fe925616be, 0x430afa3619e671c4, 0x156468ceac1f5fb2, 0x3b84dec2f2417635, 0x31140e9017c0e58f
+, 0x0bf373e5bd333df7, 0x62bb2aaba51c2f32, 0x177aa7cfdad9eddf, 0x248ffbcc37ecf3ee, 0xe60584e94e918c1c, 0x7c65c058308ebd1f, 0x5215068fa464189c, 0x1265eb79a0ad3e6c, 0x9793d87d2345ffad, 0x1ca34c1b7f064869, 0x12e277fa18a816b8, 0x6f094169c1c7fe04
+, 0x158108950ea5fc52, 0x56d2f9d92aad9b9f, 0xc7a6692242a02b38, 0x1d7f581fc573fd6c, 0x5b014bf046da4127, 0x117a6938558053ee, 0x16904ca854149d8c, 0x1ba815426c0592e6, 0xdaf5c3101075a506, 0x1d7a1d38021e016f, 0x7f6367a589211a7e, 0x3a0046f7fbff6201
+, 0xfe37ff2ddc03c5dc, 0x20af935a64a85eb7, 0x78713e55ba948931, 0x27bdf1f72adc4ebf, 0x5a976659749ae0f4, 0x0e64bbda88e7f7e0, 0xdb6f3d27b421b647, 0x52edbd455507dbd1, 0x2718fbbe0a74bfe8, 0x0a1137d172711646, 0x246f005e8b63e0ff, 0x3357fdf2df37b84a
+, 0xc50d0ff0b53ec4a1, 0x0436b4df2d9ff336, 0x00bea58c20732ab6, 0x08f4683f6a567520, 0x1dae4038bedea55a, 0x57938d1b80eb6d48, 0xdc899de4a1c61cf0, 0x7f566df2ea9f36a5, 0xab4bf0cb6385b22d, 0x501e52b570da7835, 0xf40fa96715975645, 0x4887e7fba5e557eb
+, 0xa513e5903c14905a, 0x13d3ad685e7f2922, 0xa24a57505db860b9, 0x216a901e6126a510, 0x31b850c98c473fd3, 0x5f6f9df3dd79718a, 0x53f3d074357347d0, 0x576db8ae37cf2139, 0x5fab84a0a2d1b76a, 0x732a1f761dea6ef2, 0x3390ca485c401468, 0x57d1600866c01330
+, 0x1d4abba03259d378, 0x6b6a102320d80702, 0x5dc9481aa3d166cd, 0x24fd17d71aa896b4, 0x88a7473ccfa4b40d, 0x7ca0eee59aa3ecb1, 0xe46f5d0b58ae8f44, 0x6be2729edd54d99c, 0xaba8ee9324bb0a35, 0x2f8d1b30d4bc8726, 0xe47c0dc285b7228a, 0x4ef49afc3ceb7602
+, 0x59969a3ec5867835, 0x41f83ff96729a4b6, 0x82587cc1e40797e0, 0x337646198d476df9, 0x39662ada3ca59273, 0x7e8f42aa16000c3c, 0xb7961db1f53c7b1a, 0x6bc94163acfa8a54, 0x7eb2e37349e72a5c, 0x4aa4e54a3b7f5f41, 0xd76a0358827e8ce0, 0x36879954c24f2830
+, 0x4766b29b7bd52eda, 0x45e591d898757a22, 0x6915b3405708da5f, 0x676242903416e40e, 0xb0be5c50d68c22cb, 0x7632db3c2bb9e59d, 0x0aeeeb85a41225d1, 0x0d88b05ac834fc09, 0x7da58241f154600e, 0x40e70c19b207fc34, 0x48254a6dcd7956f8, 0x33740f815a48eb6e
+, 0x3599f8583407879a, 0x0e63cf0bdc59c2f5, 0x7e63de3662a454a2, 0x682b001e6236e9fd, 0xb23081617eee93db, 0x76dc6915df4f56e0, 0xa24c6795e12cc53b, 0x77507d363f594649, 0x2563d2cc59c1c246, 0x5fd7771767a5b684, 0xd2535e47a083b363, 0x2e8e3a1841358bf3
+, 0x1ccb6d828ab01840, 0x32d6f1c0d5c26f98, 0xc775a5059fb0f188, 0x232206725f45390b, 0x968d0e57a2c099a9, 0x16e2c9c3ec85c6d8, 0x698b0e3fc62ffa54, 0x3da06e16b5813e15, 0x64e09cf757bcd070, 0x3b7625eb93490c2e, 0x13ce0bc802269c43, 0x7f0e2e654f36e40d
+, 0x25586574729e4a20, 0x5e405b9af45581db, 0x7a476ab40c8bbe28, 0x31f82c71b1258ea7, 0xf1d89c790c7152b7, 0x576408c99349d46a, 0xcf2244820db3ceff, 0x0d22422b4a332ece, 0x0664e74517b35226, 0x6536b354c5424748, 0x5e6989f2b52e6d66, 0x1f88ebbcd9429f51
+, 0x2a8f010e76766ec6, 0x028b5e719556c863, 0x754cfc79d401a35f, 0x34ada89a5772412f, 0x0f40757a5c851a41, 0x19b12745452b3a48, 0xf477bdf4acfbdf63, 0x37dba8b38213dc11, 0xb7a374fb8983e1fb, 0x46403d83e32a9703, 0xe849dc8073fcdcf8, 0x564ca9328ea8c6b3
+, 0xc12f559b28188168, 0x7593f4499cfcf1f2, 0x16e18ac296c306a2, 0x461f5f476745b655, 0x12018433fe95bd30, 0x4912493b14c6543c, 0x51521a75ed2533b8, 0x48bea963bfc825a3, 0x35cbc7028f08aa8e, 0x3e4fd4cada580ff2, 0x4a04454bdac57307, 0x6ffa39f08563799e
+, 0x572681f4c406dfc3, 0x55675a29a0a1969e, 0x988903e5e345bd86, 0x0c823ccfaa2b6039, 0xe8f09c764c839ea3, 0x76eac5224cb44f58, 0xfdb804df6fec1396, 0x4ef33edc2e8d3afc, 0x125dc7e3283f3049, 0x6225471a517ddcb1, 0x3d2d1b6db943e221, 0x5b8b60dc3390bbda
+, 0x5353518d9feb3126, 0x1e26d9a1ad9209f0, 0x30a34e49ca1f513f, 0x7e74d22a460a2006, 0xb9ca8796f3902ae2, 0x00b525966576b777, 0x6f1245c1827728d5, 0x386bc16bbdd82042, 0xa71e3c79155dd64c, 0x37a1ee9a09f758b7, 0x667e3fe2929bf63e, 0x41d97c194d0b7cec
+, 0x46483e1fef93b602, 0x7961bb6b365fbc82, 0xad9deddc2241e393, 0x1dbd96509e4d1110, 0xf5bfc71afd78cb97, 0x22388a4b9ae4e68a, 0x81d9feba59aa7fae, 0x201a5da41e8eebba, 0x270c32b294dc80cd, 0x07d5a21226479c0e, 0x666af66d7c031394, 0x573be56c35defe0d
+, 0xd5ac243f8fc81ecd, 0x60df8c779736a65d, 0x35602acdc1b2bce0, 0x440ffdf05e7b8044, 0xa869401fd976c054, 0x6da6c73a746f08e8, 0xf33220f2a318c59a, 0x47b4a6f68787103e, 0x9012fc94cf693096, 0x0b4b7bdeb1eac340, 0xf94d5bc74aa41471, 0x0224ab8dcefa12bb
+, 0xc8c6324d10d92186, 0x30f36a48ff22cf1b, 0xc56d53c57c0b37d1, 0x583878e074f41833, 0xf1066ff6e9bb5384, 0x15d47a11371adfc7, 0x6eb5f2d8a05440cd, 0x78602c5c02faa19d, 0xbffd67d8e8249359, 0x4431a32dd14b849e, 0x645883a1790b66ee, 0x0accebcf96379f09
+, 0x461775477c604431, 0x23d9860c7011203c, 0x2f9c3e4127e3c8ad, 0x4bc910c4360833d6, 0xff88b715e623c1f9, 0x080ee1155345aeb2, 0xc654d83e8d4c07ae, 0x66e597e36709b2ee, 0xe8eec5f451c23e35, 0x59c01e176e7969f8, 0x9689b4a1cb52813b, 0x1326046e1f121257
+, 0x43673d9cc13bee2a, 0x2536652f73fa8b65, 0xd348131a8e09b025, 0x43d17e7f88f30e25, 0x0cb0434653f3658c, 0x09ebec8655ad300b, 0xcf4d89e63f8047fe, 0x302e2dad42fc92f2, 0x109f09035d88e0d4, 0x308c188207468a7d, 0x6042ac2f6365d245, 0x564000038388f3a1
+, 0x1ea505319aab94ca, 0x75d62b123f9dd17c, 0x07540e18e1ad10ae, 0x11e192e852cb9b10, 0xb40f8c04265a5e2b, 0x3acfb81314f6ba17, 0x9b31c694ade0743c, 0x2501f5e6d2653378, 0x1fd5567c4a9c4d72, 0x05a921f7585a73be, 0x0fb99f0bb0483693, 0x1748ca088f931100
+, 0x1b91f9437a62cf4f, 0x437db96a22f1c087, 0xf282eb3f23918c8d, 0x5e6f4d276f48dd19, 0xb4e54af11a253478, 0x36fce2c50e90c11f, 0x26b03bec5bc268aa, 0x2d30eec645354494, 0xa678f37a521603b2, 0x2c344e965d74a28a, 0x9afe77e591c78786, 0x0c983367101c90cb
+, 0x52de9a971825245c, 0x37bec1794bac55f6, 0x32db7ba8a62aaf92, 0x24827b5165ae39c1, 0xd71bc5ef234a8fd5, 0x156e93ba13a9b2f4, 0x6ea5e103e6ff7add, 0x148745191c72daad, 0x80d93fe35d4b8bb1, 0x38999f77ae2b6d11, 0x2ceb6c59d327a74e, 0x48168b8333b0e9d8
+, 0x99b460756266fbd5, 0x3d051ef72f6eb2fb, 0x1dbbf0492337d7d6, 0x5ddff15f9dc30eb1, 0x91b3f39d32d2dcc3, 0x4e98f6c788a9fb94, 0x7b4561588ca1cb2a, 0x28d7dbfb302f51a4, 0x7809932f28233392, 0x26f3f2c610b700b3, 0xecb3882bbcdb856a, 0x18026dbef848fa86
+, 0xeb0caf295d256b38, 0x65fdf94caa710129, 0xb459f560b78e2656, 0x634b8090aacc73e0, 0x0b5ae226788ca801, 0x5621e8e0ee30ef44, 0xe30c9bf473c65b78, 0x5c399da2ef20034d, 0xe53cbf1b15fa0022, 0x000c173ab7a3a649, 0xb5846e1a792b78d9, 0x33d72324cd00b016
+, 0x0281e15ca8777c01, 0x55cecaa6f9e1fbad, 0xf1dcf775ab6ae9ed, 0x44c975b681b909f6, 0x7e063f13956b09c1, 0x07efc3f472ba503f, 0x68d7b2d4ad0bbaeb, 0x2d157fc7b703349e, 0x713d7251b15be588, 0x75235896a38f17e8, 0x5df1fc5af96d7145, 0x6b0a6e45af05bd13
+, 0xa9728fa5d62c1803, 0x55a0c7c299378c7b, 0xf81e870ef358e378, 0x3b825f075c7956c3, 0x1e16ed57f27b6c6e, 0x5bf49bc00352ac97, 0x34b5a72379ea957f, 0x3d833625c3a1fd77, 0xedf6b8572fd44ea9, 0x5c5855838fec7d6a, 0xf76a2afd635d57be, 0x1337615fa5e47faf
+, 0x976c55a2eb81c893, 0x6fc210e90c615e40, 0x1f0a01d35f390ea2, 0x430fe725eb2a5459, 0xf590c16b75fba2db, 0x1511c61b4e69dad1, 0xe54e7f5ba6b11b54, 0x6560ac7f0a28286a, 0xdb4609eba10b3342, 0x0ef508e3b7c75772, 0x7163c8631dd2ac6b, 0x72ff7a40634cd7f7
+, 0xd02acf4760d50ecd, 0x231d71c3dc9ce31e, 0x1e70796be15a2a06, 0x66888712988012c6, 0xc8eef727b40994c6, 0x32b8497021974e01, 0xd40a6fd9a5064b9b, 0x1ac020c3f82f7999, 0x931c6ceb7b8ac301, 0x57fac21e5475ccf1, 0x82c4acdeba27d34c, 0x37bb960f2d75f276
+, 0x3f210ca7ed7644bc, 0x37cbf231aeac3400, 0x5468fff8c6d0603b, 0x1527b9bbd4b643f7, 0x1b9b7e6da18ba085, 0x72ed47d5fe93ad42, 0xbc837ae813cd8ba7, 0x7edb02b86781a44a, 0x8545cdf658e79e71, 0x41adcfadd7ceba58, 0x8645486fa5576c81, 0x2a444322d2f96ebf
+, 0xbe5a67ff494c30e0, 0x55db3453ee5d9c84, 0x9054309dcc5668e5, 0x2b8705bace6a7f33, 0x0111198875bb81ef, 0x179414b92ad6e49a, 0x235ea69b3c74d37b, 0x5a5d5d819f319367, 0x6ba7925632c8a573, 0x395d75c03dcefbe3, 0x78cd89fafaa55b0e, 0x59cf33af98df6ce8
+, 0x09abd55d597a3c01, 0x756ad1f1d99d5b5a, 0x1fd62d654e2a5ad8, 0x7c9c816572f68a1c, 0x3a476170a8e69c2c, 0x3ea80cbc7f049cb6, 0xf0f4e6c958d3efc9, 0x036f05049ee3c5d6, 0x3fb35231844a33d3, 0x136ca0149c8445b4, 0xd201e2220ecd683a, 0x6bea95a2d53a8c88
+, 0xf466f40a9c9d6157, 0x640cb75e909f3af2, 0x994192f82f66257a, 0x6ad8ecaa9d9ce750, 0x4d77ace58cfd1e2f, 0x03d4ce7765a2fd86, 0x0818ef4b59da65c7, 0x7e34c01a1884783b, 0xe7b98108c301675d, 0x545364a79ec64a47, 0xc8f30c1312210a45, 0x2a5b06efd1fc8102
+, 0xf53b324cc00a9945, 0x1bf90e3e0e9e8463, 0xfef46c9a3d3c6389, 0x149932d0aaad415a, 0x1afa9e33bfdad1ca, 0x6f25d08e31adad58, 0x735f07be4ff5febc, 0x3331d1ca5a070ba0, 0x179faf4d160eabca, 0x7cfb47e4198a29de, 0xfa8f293156ba9146, 0x27aa90d7e83b1089
+, 0xa71969c117ad4731, 0x5e1695884d379673, 0x105dd5e4f0918832, 0x047616c93d891f37, 0x1cb70160f98a254e, 0x3edce4e4095225a3, 0x9d4700d997ca0e16, 0x0efbe6e0ba8cf21f, 0xdb6dff061655d285, 0x7f7a360a9c7be561, 0xf31af245efb98956, 0x6ea3d50bae1b69a2
+, 0x895d534f7687ba8f, 0x7608e0f8a2587f7d, 0xed13744f9ab13cb4, 0x48409696dc69c4ee, 0xf922372926cf2caf, 0x0cc833554967b289, 0x273c08b555df409e, 0x44dadadafa81fff8, 0x2421a3adc9caabc1, 0x342a975676141ef1, 0xc11cf03235c98dfb, 0x2a4d6c8da691a5ea
+, 0x1c91a7fe54c27071, 0x022391ef4c9a03fb, 0xb65f1a791a3d9a1d, 0x0ac791f5c37a4942, 0xc04d359121091edb, 0x68ac8104a3000c9c, 0x4b534ac6484b37e3, 0x6846ce02783faa14, 0xa61050e6bd27292e, 0x7700d0f48a2d0324, 0xae2933e5484ad7cd, 0x3deba4ebc66a7e4e
+, 0xe8126dfac737c911, 0x245bef421b1ba568, 0x507014573117b8cc, 0x00f3664df7b7391d, 0x363f8b6b98c5f5d8, 0x17e6d0141837ecaa, 0xdcfc3b62233e7e1f, 0x28582cc8bc8ccb20, 0x8fa79c550417932a, 0x0d1840cd11f61165, 0x9778dedf6def8f15, 0x0d9e8a326a056748
+, 0xe29f96714151394b, 0x632fd9d0eb0151ef, 0xd9665e2989341c51, 0x20809864764b9076, 0x07d6377ddd888464, 0x357c0ce0bde14ffd, 0x48c230a2b9975d0f, 0x0d417536408acd8b, 0x22944181729ac5c0, 0x6e46883ff4a7adb1, 0xb8bfd5fa954642a4, 0x126a017b82ad10fc
+, 0x36bc83da3adcb451, 0x2b851836af020cbf, 0x8e3c7e0433d1915c, 0x41b28c6a4fe43cea, 0x98c80c2d112d35e6, 0x0f9c2611f389e885, 0xb2c28c4fe589ec6d, 0x4f56d0c378215df2, 0xd33bc9231d93df7b, 0x2b18c9683ba9ae83, 0x6b07040526a4c18e, 0x15020a429a701f9d
+, 0xc1ad4b9f3756bece, 0x66dd37337884d1aa, 0x7e9759eb0932b917, 0x57f3511a622e9cba, 0xf145c6218ebf80e6, 0x6017fe831ce205f7, 0xb3a0aa7f505548b2, 0x4632bfb7c5c6a498, 0xdd9ef0e811ddb6ea, 0x023fcfd175a93f92, 0xa27f8c6201eb5b70, 0x5226c4881891a96a
+, 0x4bfbbe6557124639, 0x3ab9c0c3f18f1b35, 0x1c0ec0c9871d2c81, 0x7cc2dd4e5e4539bc, 0xecb87d0ff3aa862a, 0x23458c3de4cd4e00, 0xf08c627d04e72c2e, 0x6431cf37b7409fcc, 0x9d94c2f120db7c99, 0x46e56771b71fa02a, 0xcd6732df9ecf0baf, 0x291af09e124cd545
+, 0x47faedc0c9021468, 0x5822228071ac19cd, 0x8f6abe38a722015e, 0x07985f8c5e9e2069, 0x090d9c68ac6e43e5, 0x7fe00d163268806c, 0xa4090e1b4478f040, 0x5c421ac7a24fb02f, 0xcb70bd7d438b71a1, 0x206e8edfba77f1ec, 0x6fb4b7c3aec74777, 0x48010b2e4aeedc09
+, 0xc42d9d2af79a5ff5, 0x4f6e0a3c1e7287da, 0x2107a3fc234dd96e, 0x1beb31eddc06527c, 0xa4b6ab6692772100, 0x11e082e11d363930, 0xd8612ba0b6520296, 0x6039918bd10a5ce2, 0xd2321092ffacb1ad, 0x797920654a20c344, 0xe7ab8970e03a4427, 0x1c8164e1b2df1e52
+, 0xe7a23fc303e5d12d, 0x3593ca0b299a64dd, 0x984053f5f9e8e4e8, 0x13b2c08f0e7a0646, 0x641ef80e096cc07b, 0x7537636944a459e5, 0x209e3b276d81a3c5, 0x203a000fd3fe201a, 0x74c38aa42870b336, 0x230030630060506e, 0x6adab44ccf37d401, 0x16bc1c63ac86da41
+, 0x440926a7ab302f4f, 0x1b67a5bec251db93, 0x325ed7674787ee75, 0x2a2ded62d20b64f7, 0x8f3b14d8b0485c54, 0x1d95e043687ca088, 0x4e37602ece3d112a, 0x65a1bac4520e8c6c, 0xb8e583e5bbaa96dd, 0x48d24f1628338c17, 0xb2fdc2f4b7ca207b, 0x5de55ffb47ab5fc0
+, 0xf228462e13166514, 0x22eb39b2e4d615ca, 0x7a256e6463872278, 0x6231d0491aec1ea2, 0x9d266f8f9c54c008, 0x63e577974178add3, 0x57bb3dbf4c74af42, 0x386096b905d7af3b, 0xf37552e188948cea, 0x76283214648656fe, 0x7b8ab695e275f6c4, 0x4a9fe99b2fbb0a2c
+, 0xf1960b237e5890af, 0x2f20872c2b88a5f1, 0xeb84b8dc1fa88c29, 0x453e86227f475682, 0xb44758bec139c26d, 0x631c72d1472e1b8a, 0x7559efcc2f5f7e80, 0x46e40d12c5a3d955, 0x42936893970e4116, 0x00c1041e936c54c0, 0xeaac67f929996589, 0x3c40a5d76a754841
+, 0x6ddbe84a00dbf132, 0x39905b80deb4603e, 0x8bebc6da6f237fe5, 0x1d5ca877d7514be8, 0x808b4013a3065a2e, 0x20bf72b662c89421, 0x799867e6efb1c0e9, 0x516462bf38652893, 0x3bd1a9e42d30dede, 0x4c1cc1ffbbfe890b, 0xe92f2229ca29e853, 0x06fd02f3ead62be4
+, 0x2d9ac746c463f744, 0x035558e6add1884c, 0x29573b0ca15f7e39, 0x45ac8fad6acf9c29, 0xa0c8de9392d5f481, 0x3b161448cc298589, 0x402447c90c0e4238, 0x44d8d0ce1f18e1ec, 0x8e05f694ff597d82, 0x220a4721411cfeee, 0x758c617ebfac113b, 0x04e92995d28b12da
+, 0x4f92c7be7734283e, 0x2f4645c29b292f96, 0xec0e830537afadc1, 0x492555434b6c039d, 0xe04eee32b9e0d6aa, 0x129af9575051224e, 0x40f1c79739fa4f2c, 0x117df46af3ac7a64, 0xdef1738bb4120eb1, 0x0b8b6361397770f7, 0xdb0076c1930c8b43, 0x1a2a3fabd18bec90
+, 0xa57afe43c83afdef, 0x11a1da21b63dccfe, 0x8e060f1949e6d4b9, 0x7fffa33735aa77d5, 0x2fb32de7813a19a9, 0x24d44de144e97860, 0xdfb2a208fe8828a1, 0x394f578f2b00a693, 0xb6fa339d25f472da, 0x42de7f20db6cd42d, 0x0faa661e1394c2da, 0x293429ee1137f9f4
+, 0x5c219685902527d7, 0x66e55e7f9c5215fa, 0x9b380a60df3275f9, 0x1e8ee5292e986385, 0xe9c1801c8940839c, 0x1760b3a815f86d31, 0x5f5757fad300ab1a, 0x0863c5c2eb1b9bcc, 0x70829c4ac6da2b78, 0x41958c14ecf8e953, 0xe517ec8025421224, 0x5fc35b33b2c3ceb3
+, 0xe286bd50d083ce17, 0x2120e558f66ba219, 0xf43d4c10f3468442, 0x45adaeee067f87d7, 0xa3ed3048299cbc7d, 0x5c524bd4e9763c18, 0xafa94c9806f3018f, 0x65ad379f34e1028e, 0x3045de5317f712bd, 0x09ad0350b8074579, 0x444f7ad6a5a4c583, 0x47dcdd84485ae76b
+, 0xeb29c7f47f8269eb, 0x62251a8062560a7b, 0x403ccc54441a5498, 0x422a983b5a65c2a4, 0x0e7eeffcdc04ce29, 0x72cb390a53c3bd49, 0x6ce7f1e12ff31cbe, 0x5b76a5c7f1c90e88, 0xc120c5f22dc0b7ee, 0x7357bc598f3a44df, 0x1f479f41dd4c3320, 0x7bb5d5901e1d0660
+, 0x2030ba6ca783a20f, 0x0b4b0f3dc4ae9da0, 0x6f16c1b0c7bce174, 0x792633823f0e453b, 0x11f58b64b3472e17, 0x2569bb54fd79f752, 0x91c5138463e5c7b7, 0x0a5038f28fc7967c, 0x90c9e7c5ab224dee, 0x46e5c68cf1d0f39a, 0xf28cc84dc20a893d, 0x576967d70c0b9dd3
+, 0xff8ce06d9d3224f7, 0x5fec6cdaf67ac10a, 0x10c2cf927c69eb66, 0x1c4bc6585b52b78f, 0x9065f8dbb3d2e79c, 0x5be5aedf361b6d5f, 0xd295f0e48be9c943, 0x526004693db89f77, 0x53b4d49578d91650, 0x4466e791ce3618f8, 0x7844d59086422d9a, 0x4453a17d2360fb94
+, 0x8ee07c8b171793c5, 0x707b3539fca8c031, 0x68a2d8ee5f7ecf28, 0x423715508ce849dd, 0x77458171287fa522, 0x655a3fc8fa2be50e, 0x5a223f0624d5bcb2, 0x454341a2dd8ff13b, 0x987ba2aea47b502d, 0x11413cf997809400, 0xe46f52d775381849, 0x53aa5069c4b9d5eb
+, 0x9a377d508d3d5269, 0x16108fd998ea95d4, 0xc0fcc549ff851004, 0x7ab4a51dc2915628, 0x2c12ab773b8d5b16, 0x23d1ecdeff215976, 0x0b6f4ee8809f5b6b, 0x7c9d897d8f99a1b9, 0x445d6bd99a1db35b, 0x4a9c307dfcaf15dd, 0xe98a9b25aaccba51, 0x216ba1245f9829f6
+, 0x02d9121a2ad4baa2, 0x13fb05e8f3bcf68f, 0xd53188f6f202a922, 0x36af84a89d2132df, 0x15729f356e0b2b17, 0x0611cad4078c3815, 0x283153f2c5a8381f, 0x56232a9af43aa0b4, 0xb9723dfec3a26bd6, 0x50831286306ac4e9, 0x365277c69f32e3aa, 0x72859d7e64f83c59
+, 0x153ede809b963ae7, 0x787a7ba06258fce8, 0xff181177025c3c71, 0x0a40e0a64cda64e5, 0x021ef2a7ab8f0ccf, 0x7eb05ebb1f75e134, 0x39f66372d8deacc0, 0x6dda9ca8278fa6e8, 0xff3aa73d7a75a02c, 0x1a6ccf83302952e2, 0xcfaa3d28e2d44e33, 0x57787bf20e73d5f9
+, 0xb06c50486de50d43, 0x7006cc146da2f0af, 0x4d4f0e62cb56635c, 0x7bc2f0280b35c4ac, 0xf49df8242658beb5, 0x5f46ecd55965c404, 0x9589faf5ebe677bc, 0x70d11232c16d0384, 0xc47c69a96960c5cd, 0x71695975aa1796d4, 0x592873883f6bb2bf, 0x5b209e9f5e89570e
+, 0x71c76d3ebcc097f3, 0x25d27b8813ba0663, 0x3f71fa2345d7e5b6, 0x539f4520e54185e9, 0xe9a2d076f7cddd1a, 0x62d32036fb85f866, 0x7ca1d6d479c9ee3b, 0x50f0a57cca9a0065, 0xb8bfe7fc260e169e, 0x689204e76cd0df19, 0x5fde9f5b22385746, 0x7f978239b2640a8f
+, 0xa0e36a6f7e5d27a7, 0x1b01f8783ca79855, 0x0d31900496bceec9, 0x491e699a8dd57cb0, 0x6ae97d681a1ec344, 0x5ec96f34528dd20d, 0x054ed7668ca05952, 0x455c6a2067a06ff7, 0x1390118e03021a57, 0x489d92ca43667c00, 0xd67a936f9527729f, 0x4d55cd82575963a1
+, 0x67470dcc3cdc718f, 0x395f8535bc878b5a, 0x323cb6f513192c0b, 0x3243992feae0c2ab, 0xdcdc13046dac2149, 0x23602427720ea3dd, 0x5eca558f43b82fbc, 0x2613365e0834275e, 0x49e87997671ab14e, 0x1e82c0f8832c1325, 0x2e05f51a56e08a6b, 0x6c2ffd3fea883d6c
+, 0x532f8edade940946, 0x0cf6a73fb6468f78, 0x99c95fcbeaaee0e5, 0x1c25c0d13030d381, 0x923519ad8d7e6879, 0x4096718cd36602cd, 0x17995ec10886a213, 0x3335881a91297ba7, 0xf4ebe3c054306074, 0x35bb150b9dcb4fe1, 0x2ee9c6e73b7aba75, 0x22459cadf05e477c
+, 0xf79817b56610813c, 0x38e35cdd7e386f87, 0x9e8abdab8edd6e1d, 0x2b4fd6cf6709a4fd, 0x2e0a4b3e55a06cb5, 0x736a3477721c4b0d, 0x66dabb2ad3d73316, 0x17415604159b02e4, 0x92831a6bae59d2a2, 0x0e2ab408ca8474fa, 0x71e304bc95b6aae8, 0x2eabf234589a2248
+, 0x1d37fd0eec285ec2, 0x3a26e1fd8583a73b, 0x4f1f2fd2eff81cf4, 0x24abe8f02fa573c5, 0x9ad6df608956b7f4, 0x616a402aee83b67a, 0xfcfc632d0a273fcd, 0x414cb240c5f0375a, 0xfff27658ec776d7d, 0x3d2775af5e418cb2, 0x9eaef239cb8b4b00, 0x4d0fbf9799180725
+, 0x166844c5668be312, 0x36699017f550ad0d, 0xd3beb79bd4441d86, 0x06f4f8e8670888c8, 0x6e58c13cc6ac22fc, 0x4c19763a3b7eb7b7, 0xe6236d8e62288eef, 0x184c9fdf4a52d542, 0xfa36544636de3f99, 0x020a6bac91ab66aa, 0xed302aab9a1a02d4, 0x07bf7aa787111785
+, 0x9eb64d00aba4b3e8, 0x1d71c345111464a7, 0x5a1f208933479fae, 0x5cf9fdc39a441925, 0xf074c1761652c9f7, 0x3474f18b670a68d7, 0x2d9c4034feee68ab, 0x6a933e32bcc53536, 0xb695bd1f8757e8fb, 0x37721de5004322cb, 0x9a6b697265d59237, 0x458fc517023e4a7f
+, 0x8397f3fdd042174f, 0x414fce3c5aed7c0a, 0xfb7d372c9cd398b5, 0x3b681d78489407aa, 0x218bf75f02b17d9b, 0x2a880905d35efaab, 0xee94627b16faa134, 0x149dcb8477fc426d, 0x826d80be6a1900b4, 0x4830086a43db4a68, 0xb30231b6c03c94eb, 0x6b0b279e829143a5
+, 0x3e52bf6582fbcb38, 0x43e83bf601afc6fb, 0x5e65b1e4bdd3fb7f, 0x0fef21b288a47e6a, 0xff7aea1746903e3a, 0x18218bcbcb703f32, 0xdfc0c7a25b1ea017, 0x7813de67f65fde90, 0x02a06c6ae9da5f53, 0x59638678b20060be, 0x3ddc8b95930f851a, 0x4b80c8a596ef74cf
+, 0x6799ccec36dc1f98, 0x4da86ecbd73f208c, 0xae541a2b0024c623, 0x496c73cdc15cb025, 0x1083b7979136ccb7, 0x3cced8d3185b30c8, 0xa4e17bb4c13ab102, 0x7c01a28a688b4337, 0xe6a297e3b4cf6819, 0x7accc90da599a691, 0x67032f9819a70ee5, 0x5b69ad5979090930
+, 0x454a3109e8686811, 0x55e7bca2f4ee1ca0, 0x998277229cc12a4c, 0x14bc9043b53dd76f, 0x8f564d6d7e2e24c7, 0x255b1894cd2f6afc, 0x62ed7850bd491b98, 0x27fc34e0d1b70818, 0x681263013c657789, 0x0da3fe697d4fbb65, 0x25fd469c15750ef6, 0x678f3fbeb85e92cb
+, 0xfab0f04111deff90, 0x5cf63c26ab84bc52, 0x3a132f6456ab35e1, 0x6eca096c7055c3a9, 0x1709fbf186a34e7e, 0x3c1dd184f35d7043, 0xe7fab440890f5f6b, 0x2e5acbc9ddde041c, 0xd6a67599e9d60804, 0x0d1ddd9bd35d76c9, 0x1628bd722c2d9ce5, 0x466fec70c2c20f6a
+, 0xa6b7ac185c761041, 0x35d51c0edb457ced, 0x245ce7dc8ecae78f, 0x6b5dbe8ebd94b18a, 0x0bfdce257baf4eec, 0x55c96d2753ec5b07, 0xcae850f1c68f23ee, 0x60faf4925acc1009, 0x07a5ecdc02af6f1d, 0x4647eccc46bac3af, 0x05bcaba897820999, 0x0b2dc5b37c431152
+, 0xb4b091e858f92d6c, 0x361a74c9519942da, 0xc350001496d7385d, 0x75bd4811ae620eb3, 0xf4d19365ff8bc416, 0x205d3e90a029ee8a, 0x5192d984706b471f, 0x4f3589b355baef92, 0x13ae9e2652347a31, 0x1ac7f905e1d5a908, 0xc5f3b311d5f84f7e, 0x235031f710cfa21f
+, 0x8d7b59a6aa66d357, 0x6a2adf4086d78160, 0xb5c183cb5b16d2e6, 0x74b0b4bdf089edd4, 0x1fcb8827a49de715, 0x48f58d34e9281596, 0x3fbd162806b378ab, 0x51ab2009c9194d54, 0x36349b579b76b423, 0x60460cb591cb3866, 0x91bb695fec135b7d, 0x6608a835976c79c5
+, 0x269eeff00e185cef, 0x426df08f1028bdd4, 0xd260836dd2c24b36, 0x2127bf3dcd4e68e0, 0x8db79339df118c3b, 0x6507f758c38a64cd, 0x542420c1ee771747, 0x6ff8174f5711ec13, 0x41fb3de5e28af772, 0x3f0d42ddd7f09103, 0x95866617932e06ef, 0x306647835b3795db
+, 0xea63e3d6d5a045c1, 0x44446ca096d3d9da, 0x7dbf9f5dc6fbe60c, 0x31933bb9652f7ee3, 0xdee053d85f24ce70, 0x08255c4854393280, 0x2207baf5000973c4, 0x185eb150af46a631, 0x9ec96eb37244dc7d, 0x5dc8c6f263f6b7dc, 0x20aa61cdc4b989fd, 0x7d45b6862758af8e
+, 0x6efd5ffa139f38fe, 0x28318a991a81eb82, 0xf7104b122820e153, 0x68460103fcd675d7, 0x7efcc7c43ee10dff, 0x7d5b435d04f6d67b, 0x6185538e107e92f3, 0x5289a167a2d2fe56, 0xdfbce0e19bdbea18, 0x1a39b944bc16b043, 0x800fd36d0bdba16b, 0x47a77b44b53666c7
+, 0xfc53b2dc0ab2fd89, 0x62f3778a04e29593, 0x90d8301adfcb0f0e, 0x7cdfaf9167e1cd1f, 0x741716b3048a9ff1, 0x1378e75275cac883, 0x8de992b3459468b2, 0x0b419e4de2cfd9a7, 0x1ddb8b3329c88811, 0x7987e00a7833dd47, 0xb1153090742b37c1, 0x6d7b548e04192a90
+, 0x87ab9d5b8eed87d1, 0x173581fd396bed6a, 0xc110f11b2c504a46, 0x3bcbb98f2de373cd, 0xf07e570049e9dae9, 0x3bcd09022bf20e68, 0x201ac8eb8cb2dbb1, 0x31da367051da897b, 0x3924e1cf2f98606d, 0x09ce4b83aa7f325d, 0xef84d513e9d68ea6, 0x756fe26e1b6d2688
+, 0x86b68ece72cf729c, 0x3252c33266ab6d87, 0x4e02c9bccc0406f1, 0x7d1f05f71b8289f7, 0x209ffdec820eddd0, 0x3fc0cc817525f520, 0xccf78941b8c8e1db, 0x6ba22bbff1ea4a26, 0x152f522be0c3870a, 0x21a18701a10da204, 0xd28546d3bb5ceae2, 0x084e8d99071d58bc
+, 0x28d0778b0aa67423, 0x29608725cad35b8e, 0x116d8833499a12a6, 0x2ebc56f7ebc0f1a4, 0x9c2609b83607687a, 0x709889f969cba45d, 0xa0ec00776b3bc4e7, 0x4564c80172a28dc9, 0x93a44395d5dfe040, 0x4a0afc0cb18326a0, 0x3883518eff96feda, 0x33cf24c9fb29c9dc
+, 0x43f183f7204f3ef6, 0x52e6fab7b13c1608, 0x4de28426fd7a8d9f, 0x4877747fe3510c38, 0x2203b74f17be9bd5, 0x4ccfa9462d55562f, 0x01a06a917f31fdab, 0x023107e62989643f, 0x6356407978152366, 0x17663e6d10c832dc, 0xa5cf558490c22076, 0x43f83ab48c65e521
+, 0x7dea64471a507695, 0x3ea778eb82606ff4, 0x3188a8fc6edf18d6, 0x20918fcd2288e450, 0x81dd1755c7c1099c, 0x686052a58234e2d8, 0xa61de6f0d5bd5827, 0x79d892ebaeb06529, 0xa12d01c1001ecea3, 0x1aaebf8ad02da265, 0xd8b30f7309adbd4b, 0x7c01de083d6aff6c
+, 0x084ba621f0629993, 0x4800de0b4dc77566, 0xa9920501b2d675c3, 0x19c00e6cdd5f0118, 0x97b11b61cd0ced93, 0x28fdb8c9e3ac4729, 0x9ff4d643ceb1d0d7, 0x1e87a78a9dcf92c0, 0xbb14b52e8f1451d3, 0x6c5019e8c735b5f9, 0x5fcb3df9cc2b673c, 0x6f773517745cc04b
+, 0x2191d5566a11f363, 0x71f32772cc188c16, 0xf312c617f9940227, 0x3360cfcc357ddd96, 0x2bb38e5e314498de, 0x3bee2a988f852fb9, 0xdaf6de304d632f01, 0x2948a9f67625fbcd, 0x8db7de17eaa593d9, 0x5b968138022da51e, 0x20fe8c756053327b, 0x7a24542d437f6da4
+, 0x443632669b1e1096, 0x5573cb39f989df9c, 0xf193ef1f332fd1d3, 0x6719d06e086305b3, 0xea354642d2c068c8, 0x3bd1c482941ecfbd, 0x7c0d4d6489319c27, 0x45c48793cd5ce469, 0x001e777626604f60, 0x79db23a276351cfd, 0x8ce4c57351631480, 0x0f053516334b988c
+, 0xa87cbd2904de9d3d, 0x644a30ea4bd7ac1b, 0xb3cbfc5a8a513dd2, 0x743aebec45c6a729, 0x849f3d2d3d96be4b, 0x59cc7bd0435e0aed, 0xb8d611fbc9b043fe, 0x28c18d16ffa203b8, 0x36877aa0772a9d7c, 0x2ceb37d7682e494a, 0xf1c41756b50d284a, 0x53682bcbc3895a42
+, 0xe61759a30344ba82, 0x520f8c5bb703f487, 0x606b3c3545db8a9e, 0x7a4b48e0c1885adf, 0x763c9bfda5a6dcca, 0x1f99c79e265b31cb, 0x4de273401d3f99ce, 0x330610501ecde6c1, 0x156309a1103ab869, 0x3c0a4a12a7fde0fd, 0x8d8526839a9048f9, 0x050fbfa4565e1dcd
+, 0x5a36efc1e6bc2dbf, 0x4d428b9c98bc5aa1, 0xd53bac7955bb87a4, 0x4690d501ab6ac909, 0x0df5da06db494464, 0x06a788fe4de1f2e1, 0x54461c1f640ba302, 0x0dfb0c939d93481c, 0x841b1220c389a446, 0x7da78c58ed1cce70, 0xaaadb8a5e0721d75, 0x4bdfdd9214cd3ebb
+, 0xdf88a6fdb986d40e, 0x60c53843192d3330, 0xf1b39fd56a7b84d3, 0x62056c9a6db9b369, 0x871f74e688e7d660, 0x7d602cea26137ac9, 0xaffb7a94157b209c, 0x31d1a45e445e4bf1, 0x8efbc1b98c52bd32, 0x7eda5bcd2840ba01, 0x3cd439aa49380742, 0x3ddde37e0a2dc52e
+, 0x28563daa708e0044, 0x50b93b539851f478, 0x5fccf4036952748f, 0x1333709ef98af301, 0x56fc8accb9ac6a24, 0x2b8d0f5bf699bdfa, 0xc865ea84e9bbf2a6, 0x2bccba20bcd13e7a, 0x3a0311f574bf834f, 0x4cb907c3ad28bb4a, 0x8268adfb405f0876, 0x78d1cc6e31b7c66e
+, 0xa29b874bcb9f33c9, 0x7edb2f1b78f7fb41, 0x3add4ecfeef06a5f, 0x52c292a193b390c7, 0xfc2befe48b4739bb, 0x2322b821a8c2ea08, 0xc9ee01325bb93eb2, 0x4a6a374878d8152f, 0xd07a1e4e28a313da, 0x2a3f9febbe739ca1, 0xc9eaae35a98067a6, 0x027a3ff908375902
+, 0xe69f54f4a3b9a893, 0x47ee68ea218af245, 0xb3ea9bb4894a8ebb, 0x3cd4bac27e93c5de, 0x572f85e2f1b1ee30, 0x5c28990975640802, 0xcd21ff33e2e1905e, 0x16bc7c33fa163680, 0x791ca220e5bb2727, 0x4c2c553ad3000367, 0x369df962b8e1f498, 0x690811248966809f
+, 0x68a291be3f8c6920, 0x0d2edfcac418e840, 0x14d05f6f8c5c87bb, 0x3c9f6755cb9f776e, 0xae31f37a21b90f02, 0x0990e695ddd4dfee, 0x4608e4ee3de773cb, 0x4991ecacbd03fdbb, 0xeaf5b1341361d3f6, 0x03979d5a16de476d, 0xad8ebf1d1e894cf9, 0x5d29336420a7ded5
+, 0xaa35bfc7b368c327, 0x339864382c2a208c, 0x0463f4f5ab656b7c, 0x22026089143c7d40, 0xea424c2f24edec90, 0x32253e893a59fb95, 0x4a8808360d8f8936, 0x6503d6e959adc1ec, 0xebbd0e5d088b2564, 0x4e132d6c03ad22e6, 0x696135b643267a90, 0x68942b1e9d593b71
+, 0x2755cbaf295c7be2, 0x77df16e080ae0333, 0x9ed6f30097246863, 0x66ca2ab453f3e7f3, 0x0bed15b34570d95f, 0x1b80962795e0f39f, 0x1b8570a2c16eba9d, 0x4dbd1f3b6925e3b7, 0xdeadeec9356d665f, 0x6a6405d17e76b8c2, 0xa07c5548cba11bd3, 0x7a5d5514971dec46
+, 0x1bedff22af915e7c, 0x122fb12c94a9aad8, 0x9a981c16bcebf744, 0x5e85458ed18fe8eb, 0x150b0492b39e2552, 0x43cb3b551532c4fc, 0x379e4d410cd5d42e, 0x6ca6098c95a108d5, 0x7501b7c56f600434, 0x0d1ae362f7831d8f, 0xb5e894d8c1ad3d71, 0x740eeaeeb6238c64
+, 0x5df1c7c392b50e02, 0x1c457fdaec620f3e, 0x9615b8b738a6fec2, 0x0ae138fde3a60f3a, 0xbfca810dcfa557de, 0x67dc71902907f600, 0x03597b1f24cb39b6, 0x3c8f2ecaf3fdb0c4, 0x7742058bdfaf8718, 0x6ba6dec9f4855787, 0x6cab1843865d4da0, 0x4c1adcd76c2426f5
+, 0x393ef2bbcb3c3b43, 0x24d32815ad7cfeaa, 0x2e266bf9f284a2a3, 0x664ea2985d8539d8, 0xf827cf96f2ea9d64, 0x491b7d0f6a3b75b7, 0xb7381d4aa7c6f82d, 0x15c2844c42447f95, 0x484de3ff0bd0a027, 0x22443f2fc908abbf, 0xd2075c8251881702, 0x08543f1a5c435d49
+, 0xe2835aa69b52f27b, 0x66d86cb216701b11, 0xed3c0df07d3bd7c3, 0x05bca6ed4aaa9458, 0xb880f23a8ec856b4, 0x0f9b00ca7d01bcb3, 0x64ac7cca882bece7, 0x1098f2a9513cade3, 0xf37366c63d602060, 0x4e2b1daf3f4be0c3, 0xa6165df9bfbf328a, 0x57511a78aa3006ab
+, 0x35f41f2d0df8d138, 0x43ce38fc8dc7f8c9, 0x1ee620355dbc8970, 0x73d21caee74528b3, 0x03a177bd7c700956, 0x4898cca0729c865c, 0x96e4c66709897353, 0x50a17d3b9fbc76c7, 0x58648a38ed8acfec, 0x78da7d20941058b7, 0x79699e03085bd7d2, 0x7ae7bf4b5dc45c01
+, 0xdd6b2db0dbf9f224, 0x6b74fc497343ffc2, 0x51ab3c8949404195, 0x0ae4bf6a852bc620, 0x54ae959cb3861c07, 0x3ac725b8ab5bb4bb, 0x07a9304caa959163, 0x7c25bcf587720e66, 0xf24be8cebd105328, 0x5ab10416824e6a9a, 0x9d3df7595d63883f, 0x5f180b0b1a469e29
+, 0xa2475ff174aff1a0, 0x2a372627e7b90e71, 0x0a9ad7b58117377b, 0x143566da809b3ee8, 0xa948cdf2840d9321, 0x59d47d17e9426c67, 0x5920dd0c9194ee78, 0x38ad3a5a834155f2, 0x4221112fe7998cec, 0x63375149a21e3f27, 0x09ea006753580952, 0x31bc665d4efbc8c8
+, 0x4c0eda4a80751672, 0x11495772227bee9a, 0xfdecd1c0a246fbf9, 0x2ee1c1744d574716, 0x79dd573c3be59d01, 0x1f991c7f031623d6, 0x7c11b7abbb22f237, 0x5bcd3356947565b3, 0x65e55d96a9138bad, 0x7b941a02971819e9, 0x709ffdad6ec23661, 0x1db06b5d7176e98f
+, 0xc709057417f9b4c4, 0x671dab19b4b8485f, 0xa539349b296250d5, 0x199cef1a2407e69d, 0xb4dc28d7bffa92e5, 0x28552d0f9e872c5e, 0x65de5cd6acf650f6, 0x0b49803ea7db75a1, 0x04d6f49d59e50572, 0x52b2c4d9e9216e3f, 0x2488a811351694dd, 0x1853412febef4617
+, 0x65fb15a0ef729bde, 0x26ec4cb2c5fedc7a, 0x701497798ef52b3f, 0x379277e850173160, 0x7a37fe9e93b2dcdc, 0x53dc363b878e604a, 0x4488e06045a8bd61, 0x4fa2d339cc815f49, 0x2864f25d43932895, 0x24ef313195e7be16, 0x841b9ef4750db74b, 0x3868c25ac5f7eca3
+, 0x673e20387a9fa096, 0x3e5ab89dd0e9286b, 0x9ef5f9c312df94cc, 0x3e9e4da4ffc24820, 0xc9ac8dc6e2bf24a9, 0x112d54063a00771c, 0x130e2d5f52d29a83, 0x5cbf7f1209e6bd3e, 0xbb0b4c1c2bbf63b5, 0x31e3ee1e5b411c3c, 0xa39f7ba1bfe0b145, 0x0a540d37bd6cdf76
+, 0xc44ba9fc6cbdb86f, 0x7524f12f457de63c, 0x70230acb503c4dcf, 0x7f98555678f09e28, 0xa56cfe1f2c44ae53, 0x480ddf2eb9da5d91, 0xa88404e8bcbaf7ed, 0x18a95844864a90c3, 0x91cade99ca28e487, 0x35ad71c25e9cd82d, 0x66f103971872484a, 0x2e29645e02682afb
+, 0x143c653df5f0e702, 0x41b5b09bd42444d4, 0x5859bcb3064fa4c0, 0x740ccd605ed342d7, 0x8c63ff8f24bd130f, 0x0ce169942c20b709, 0x33b2f9735a65cdb1, 0x535580c550d368ab, 0xa39cb5df787cfef3, 0x408ef22a07987f17, 0xf163eb5b57214c26, 0x032c6632a2edde1b
+, 0x45919d55d1cbdffd, 0x1369bd1a0a538e2a, 0xd5f822f719e64514, 0x6790eb1f9392b438, 0xf1500e4f1b9ae635, 0x2fd5e5660e4aa19f, 0x9147ae35978d2bd7, 0x6e2e04c644acfe11, 0x4a7e88182633d81f, 0x4ac80d2fb249e620, 0x3344befc6b609b00, 0x7efb18ff8d60edca
+, 0x814eb490db51a969, 0x2a23bd006b9cac43, 0xe7eea09557b9df46, 0x06419fbc3f2c1d3a, 0x058e5b1538c0b824, 0x53123c70f2486dce, 0x442ca2f9cb5a3180, 0x243e2e9f35f52c9c, 0xd5e13861d4eaad96, 0x7369253b5e7508ad, 0xdc9c9ce2369c0c79, 0x0422cd141bf6ea6c
+, 0x427146e047c184e6, 0x3b576da5300f7173, 0x8a27618ed8718976, 0x4b91cd368c44cbac, 0xb015ea648394ff5b, 0x3c403c707bbe6a1b, 0xc88ddda8cadd2558, 0x665f538b91d725cd, 0x94a27e3409638262, 0x1c12b412ec2f47ec, 0xc8cf047f5e261580, 0x7437cb0dc2228c41
+, 0x45467917e399ca65, 0x36985b3e124f3312, 0x38890751648f725b, 0x11396ecca74109de, 0x5912a7ec3179bc02, 0x03da07322f4c5514, 0x7be1b4cbe46c0425, 0x1472f1ac29318525, 0x9f967048b0509574, 0x1853ab4847587f9b, 0xce8c4db04372cd0a, 0x7f9fb0df0766733d
+, 0xa315879f83d59e9f, 0x47f95d0a41b4927f, 0xb4778e9a55c817cf, 0x754fd2b189c5cf4f, 0xa472f4a57e289e0f, 0x4cfb45811e3fdce3, 0xaa69b911436ca244, 0x15f8e5e32c969d39, 0x505a16c22a3bae50, 0x3525fc303a5fb40c, 0x7cafcf4c2db4bd7d, 0x2d2174a2c0b1f537
+, 0x2545852ede0a90d5, 0x1c039991fe2c6f9d, 0x966da6fc2c67ce0e, 0x39ec6b934fb0fb20, 0x0919e098116591a1, 0x3d29f9edf65f198d, 0x4265f60e13983fd6, 0x7673462ed5843686, 0x84faac4c341a1719, 0x5567c8dc2fa641b6, 0x98cf93470a7d81d8, 0x5412dbded0bc12e3
+, 0x406673c9d2238003, 0x57136ab6503878c6, 0x64cbf94195a3e6aa, 0x303cfe82fd9e3f61, 0xc07f8f69724199b7, 0x57f2c325b974de87, 0xa783e1f3673e19d7, 0x563ee155758ebe3e, 0xe72f6054d2aacf9c, 0x58630ce6e47c8d42, 0x249c1af4115922c0, 0x47ca19bec73f3c2c
+, 0x512ec34b93f7c578, 0x295762254a951a95, 0xbec691a9009550a9, 0x7a68807182f17f79, 0xee31a0f6a8aeadc2, 0x5c57d372392ba520, 0x465545c605c88d28, 0x16705c926ad74c8a, 0xf54901b317ac4851, 0x2960fcaad340b25d, 0x331ece1b507ffac0, 0x02fa34abb9c407cc
+, 0x93b576c3d3d48490, 0x021407b75a7e9963, 0x853460a88f66b521, 0x020fd6f19e98e4b4, 0x107e07b3e1bd2817, 0x54fcab213b7518ef, 0xcbd14a048a2e1e80, 0x37d2721ace527ffa, 0x8f5eeb9efbc2587e, 0x6265b4e312bceaa0, 0xa2d62036e4045a2e, 0x3e606e988d753676
+, 0x67eb00449128cf9b, 0x327fc6a6bec92539, 0x611684ca623fbe52, 0x6eaffedae2f41fb0, 0x9195000b4898d96d, 0x223a47699ecfde7a, 0xed91cb6249618aef, 0x5c9808ca281964b2, 0xd923228770ec1a8a, 0x46c4516a56c3461e, 0xcc4d7ae6632a2d6c, 0x4834c6765819e20e
+, 0x7de20cb4f363e577, 0x2e3e210cdb2fbdc1, 0x8d6890350d2eaa61, 0x60cbb089d25d74b6, 0x53da23f5fde8c133, 0x66fca2aac310b0ab, 0x442e4f0a94552d65, 0x03279c184d99d5af, 0x658eed00f670dc76, 0x7c64006c2e6ea9eb, 0x0118033b4be8a288, 0x3335d6cb54c1a821
+, 0x8fa3ab49e35588f1, 0x1b691848aea4f360, 0x734ab3a3ce6ee7bb, 0x6a505b9c50728307, 0x3d00d2a7669aef5b, 0x36920c88e081ec89, 0x99a7aa8d45e5f1ea, 0x21a8a7d02a1189a8, 0xf3f24b0ca4ab9f07, 0x4f7abd074e534572, 0x522940104ba6c2ed, 0x760b1e3a3921e229
+, 0x384f929621c3f4d5, 0x4386845391fe043e, 0xb1522b2d584b7eb4, 0x7bf7ea1113b9ab5d, 0xa1a8832c2ae18ca8, 0x520c4138950f700e, 0x5e175a14cc7ed19d, 0x663f67664643b5bd, 0xa2c300967fc7d01e, 0x71037f2bdeee14e5, 0xaab0e43167c4531f, 0x32354b06b3c71a09
+, 0x046762d3f6b7f48a, 0x11bb2e0801ba94fa, 0xd898a43a2489c368, 0x6a0ef3eaf7c293ae, 0xbf71a3d7234eaefc, 0x1f234b3e3f31145b, 0x661f7454b65d62f4, 0x033b454cf76e5748, 0x7ee2234bf4ba953c, 0x24901628bc6f762f, 0x5a33ead1268ed157, 0x40ee2802ec35bde5
+, 0x009c121e38dbc8b0, 0x75850d10b78fda5a, 0x174fceb9bca84a38, 0x2dc73f43601a7ad5, 0x669e08f592ec721f, 0x34cd4d98eb94781a, 0x6b767d1e73b120e1, 0x137992e1914dfea0, 0xbca1834635e9b48d, 0x02592ada8849019a, 0x2c8740cae0001717, 0x49df21388219a414
+, 0x73f6b3c48834388b, 0x039c868fe57cf626, 0xcc5d3466cca6d556, 0x3bc9812f5c9e05f2, 0x572f7b2edb205b6e, 0x5825f1988cd6475f, 0xc1bcadb9420b4c59, 0x4cfd3a81b013883a, 0x64c6b67aa40f5c69, 0x28ce6e157fe0f3a1, 0xacc764a0387376e7, 0x73bcc709158319f6
+, 0x2aec9405edd12d4d, 0x702d0a9d2cd25275, 0xbd81c56b726a2ce6, 0x38e92d36c0e3d020, 0x240453add4450d78, 0x6f5fd68b6e3ad939, 0xc8dd2206467a7870, 0x5e138dd9187f99d8, 0x7bd8977a6ccd4b7b, 0x4d98d3470baba423, 0x5b0ec5f96e2377c0, 0x4767f0ffeceb8bfb
+, 0xa2fb5f861afb3e76, 0x7ec4368ce4bf3e14, 0xbbe3d1581e7fb3cc, 0x0beb9ff88c287f08, 0x6fe573fa6aba0610, 0x52494cb2b4cff7b5, 0x06ca028bc50b9c05, 0x26808f11d7ea5930, 0x136baf06e92e67ae, 0x23baa53337619d3e, 0xd4cb1ee45d31c25a, 0x433f09c02226c77a
+, 0x260d6a8870095bd2, 0x57f0e5f30e3ae9d4, 0x626f87a1fe528286, 0x23623e0089f90f55, 0x5282c75e6d386d3e, 0x121909bb5d6c568a, 0x4eae4f22550d9ad7, 0x68e1c5143f467a3f, 0x79aa178ef38de5c0, 0x27de5fca037088dc, 0x601b95fb357ab0d1, 0x31f1702c553ea25d
+, 0x7578d1fc49cbe59a, 0x0f0ba0337a189bab, 0x7dc4ff5992e0b811, 0x6778203cf08af5a6, 0x81b4e82448d5ccd7, 0x511830e6798cb729, 0xafea994d3737ca6d, 0x1e6c650804c7b398, 0x5742917cb3f37e7f, 0x31d8b61e84afd3fd, 0xefac905f5f4d9e2a, 0x651d5cd9067d96d8
+, 0xfd6107a1a96058a4, 0x5d4063ceb85d923b, 0x48322ccc14626bd7, 0x2bae31335c6addcc, 0xd670b993b94d0a19, 0x31dbe41fe11079ee, 0xe425e8559e107424, 0x763061cbd3cf0b81, 0x6106de4a51291f5e, 0x5849e6567861509c, 0x320b9585620ca3a9, 0x29d190fe038709cd
+, 0x3fdab84e948a9c36, 0x12b63f2df541f72c, 0xd66ede10cb0f02ca, 0x60ef011bc7f3d0e5, 0x8bb436fbc50b5374, 0x299ce3425ffa6ca0, 0x9fd01ea8034543f4, 0x527ffb3bf2e27664, 0x78287f89ee14d67f, 0x3d77c4abc069cdb6, 0x1f1f094c99164e30, 0x63ab80ffb7b241c3
+, 0xcdafd25dc59efdb4, 0x477fd813c2d90df9, 0x76546599587402e1, 0x1f32aef2c44135e4, 0x72f45ddd27222402, 0x636339d7e70dc4d8, 0x5b79d7293f3b86f5, 0x4824b292eeeaae5d, 0x86f0d24aad88fd0a, 0x072ce510a4deb974, 0x3a57d804814ae3be, 0x53b86188684879f3
+, 0xa63e32fa062a6df9, 0x697a5f65987d7f01, 0xc7490996b8420751, 0x08d143a560a9bbc5, 0x768ab44d0dcc18ec, 0x78269d8ae2f42a7a, 0x655d07cb507a73bb, 0x7d1cc563b310e505, 0x762353f9600ee235, 0x14ddb7162cbbad2c, 0x71b2f9bd2fc65516, 0x397d157b35f4b2a7
+, 0x6bc8b0eb7085707e, 0x6a89c7369f9bf95b, 0xe46bcf30b0a58534, 0x474ccc5b620dc616, 0xe0a720918f8d7664, 0x3c75e278b02b0825, 0xda4eaac16247de5e, 0x4c8a2db654dc413c, 0x909f3451091172fa, 0x04dc3e60608dfc95, 0xf205b4ecc249f0bb, 0x6b4aa6aa07921a6c
+, 0x777ce6e5663f5c31, 0x1bfa479a315cf4b8, 0x91193f0370f6fd96, 0x15b599ffe09223bb, 0x0ea8dc47947fc9bb, 0x1cfad423a2674221, 0xb40a2590e9f0ddd0, 0x2ee3b91ea988388e, 0xd982e870f5661627, 0x087467861d288dba, 0x28ab7cf624be3357, 0x7aefe0b01a0001d6
+, 0xfe82bd455af06938, 0x5858f1b5b37b62d6, 0x1ac28c976e6bb27b, 0x45e8f689ad5131f3, 0x70f6cec4e5cc242e, 0x04f653c6165b02ef, 0x099a1d681cce82fd, 0x1674a9aadbabaa72, 0x5cf2a86dd9f761fc, 0x09c58e1c7a194835, 0x395d97be50d5ad81, 0x00a0d9f70d13e140
+, 0xf39dbceecf1ba137, 0x12468554772294e9, 0xbf69b5a729898c99, 0x6167352e36218129, 0xa17732a644f17ce0, 0x1f74c89032f9e086, 0xea94264419addadf, 0x59e2c3c059432b87, 0xb991b5b3946dbefb, 0x2030e888121d2afb, 0xbf70a045faa4e28b, 0x4c6f109e8058d2a4
+, 0x7a7dc5b4660f8849, 0x340c5481cb2e12bf, 0x3b3a8065654c43a3, 0x0fdf8d32457425dd, 0x731b09c337eafa05, 0x592177ce2cd53d52, 0x28f5313f3d16cfce, 0x31a2e6917f6c8f45, 0x084d0d9faf3908b4, 0x6eea862b57c95de7, 0x48cff5c2bc5005c2, 0x0e8a4e4f2aa86b95
+, 0x9a90174814b3f094, 0x55d0bc51fa69c47f, 0x20142cd9a3ce6516, 0x7fce88efed5dd683, 0x79dffe930a123606, 0x3fd3c81caba9e4bc, 0xf241a5208f54ab6b, 0x0aba5d121766fb32, 0x7f1aaa7837c96bfd, 0x7facb6dbbea74597, 0x362334287762e193, 0x0b604c5008f733dd
+, 0x4a7cbdef758a82d0, 0x65326e6c7ab7df9e, 0xc857100d3141d9df, 0x55841d726d5997d4, 0xc5eb015cf5676bcd, 0x4605670af60bb277, 0x6fdc2c31760e4771, 0x72c2df10f7530f90, 0xa435148e949003f6, 0x75d5eb7efbb404d4, 0xd95c30a97d937119, 0x748d5beb57314eda
+, 0x7ac20170425781af, 0x27caf8391540c718, 0xb622479426bb6d0e, 0x42593b86eb554811, 0xee760a6ea53fa90d, 0x40ffcac6a9a1af12, 0xbda9134818939be8, 0x2c0e54e36fddf08e, 0x285bedbf204618d1, 0x1f227041a1c4341e, 0xab0fe593ef1b72a4, 0x0b8f08fb8c05d8e0
+, 0x57b0b21bf5edcd00, 0x10e41840886b249f, 0x45637787a7df20a0, 0x48cbb6c4bd632d16, 0x772148f4188cb0d1, 0x207f0d1e60157625, 0x0f8015d616785e8d, 0x7350e369acb2d60d, 0x2ebf8c4db7c18a99, 0x264060a9428db34c, 0x37a559835d1b68bf, 0x4826ac4ae7d4e028
+, 0x1227fa13a194ab3b, 0x2656995a14924e1b, 0xd88130a0aed6b756, 0x66f98a547b3aa0d1, 0x4eb1678d86957fa9, 0x3ba6066151da9998, 0xd6f63c09e3c90828, 0x5cf624dd195ea0f0, 0x84fd165757915dcc, 0x60c789ba169fd5b0, 0x9b7f8df1b0881dd4, 0x6f28a1774842a406
+, 0x7ed7ea5da9ea50ce, 0x5de6bf8c308bb981, 0x90115c06a042ead9, 0x2d21cc9603fcb587, 0x7dc1d7519d94c449, 0x152bc33134ed7874, 0xbb12c069a3631714, 0x0ef611031c8d9539, 0x20ca2c0023fadaff, 0x766af57150d059c8, 0x048a15a2de768ff2, 0x4b9b6cc26c0df010
+, 0x2438143c14e6addd, 0x5ff1ee97f6fbfee5, 0x245409cfae5ee165, 0x556ea241a766b775, 0x70419c16dd23c92f, 0x08d22ec4cd80613a, 0x29f413e418e86b37, 0x620402dfe84ad482, 0x8d0410f558f7f2e3, 0x44ff635b72016c4a, 0x7bd569ebf2110f2b, 0x406354d980a844e6
+, 0x492b3554f4bb9190, 0x37dad073f586b5e2, 0xff5e891e3d35c80e, 0x5d591eec069dcc25, 0x75bad7fdde712f7a, 0x56ec1cfcfb3ba071, 0xa9ef7d84b6188701, 0x1e5f18b46552f5d2, 0xb15ce91c5593af76, 0x3a28d84b919c21e1, 0x7942bcbaeec371b3, 0x4549b256b30b07e9
+, 0x010d6a24c7801796, 0x305cc9218bc98b35, 0xb437edd352898991, 0x4d6d6c8752087931, 0x6f12c6aecee8fea1, 0x3d7dd542910afd62, 0x29c004ef7a3e10e6, 0x0a1e46a4840666e2, 0xcd5b5350337d4e6a, 0x5a711be0a7cb8192, 0xc222541feee7a78a, 0x25fac6b85517c8e2
+, 0x9551803a53d30ac9, 0x378c4aa17b291d6a, 0xdc810ae3c9a80d9d, 0x06f34368ff54f52c, 0x43bdb29b6e010064, 0x31671498bf91b60d, 0x063d7121751140bd, 0x6a7fd4f1777ca890, 0x16297102de79e688, 0x08103256bdff8a29, 0x2ce68c42b4e27d05, 0x3f6bedaeb13181d0
+, 0x7aecf2db2f77daf5, 0x7511d1e6cd6ddc4d, 0x33fbfd458ad209dd, 0x17bae574060494ab, 0xc85bc6c5c9487643, 0x3f33b0943abcef21, 0x93bbbab2cdc4bb67, 0x6ada12cb019ba4fc, 0x226158047a6c55db, 0x40a5b986d411fea6, 0x8148b60ebf057a0e, 0x5104b9dde05215df
+, 0x75ab79ac9e627f0f, 0x12f275cd29a14216, 0x355a024b4935709d, 0x5db679bbf3a40ccc, 0xd0222e81146d1a98, 0x2e8a0ec7b3fd53e5, 0xdf4ece66dc315044, 0x7df59b2b42df7969, 0xd9a8e37885b714b8, 0x47e33747bb297940, 0xadc4d06624f09358, 0x4148ec39a290b1e9
+, 0x2a3477512821cc4b, 0x15cb5882ad2f68c3, 0x25d3af260b2033ef, 0x67ed5f0490a3121f, 0x0da169b376027307, 0x1edeed272a63ba19, 0x3f6563eeb2210673, 0x308336dcf65f9b5d, 0xb327d56cd3fa936c, 0x0108af46de6f5297, 0x0e366c014db15226, 0x6ccca69e4519cc9b
+, 0xa75ac9cbd77321d8, 0x3ca207a57bd43f93, 0x152aefbc7d49574d, 0x4e7e2c393d677d56, 0x3a3c52001c7343f8, 0x711885d0c62c7bce, 0x63e44e822ae0e690, 0x2c53888921e72f99, 0x7b2d26f8b871697b, 0x5c6230d516d64770, 0xf33dcea1039548c7, 0x630828e23a0c4bb6
+, 0x82e7fb862731e584, 0x2c96cb38ca2c9b8a, 0x1a0cbd471c5ab9a8, 0x0292fd7549ea2b46, 0xbab8a81f6f164ced, 0x3d5157daff3acf6e, 0x5ec4cca27fbdb5ef, 0x23e99f70bbc0ea81, 0x39cfd6714f0a90ad, 0x0f5840582eb55d25, 0x1eac021165db0aa0, 0x689d4650242c9998
+, 0xf999c19a7cd4d0f8, 0x307b611569fe6973, 0x49c2482ec04d9cbd, 0x553d7cdcf32e2072, 0xf80f3373020c813e, 0x0a50ab569e4c1469, 0xcca051c9c752c3d4, 0x3252bee59cd05b39, 0x5350c6e8ef9f408d, 0x1b441ad2a82cb837, 0x77d3a62d5f85167f, 0x651ba024da110b00
+, 0xc7ac4a5174aae8f0, 0x14d592dec4d3961f, 0x967bef885b5e0a2b, 0x4a3db5781fa1a177, 0xc27fe7fa4922cef7, 0x6b625a1161a7f0d5, 0x4398786efc74cb6b, 0x1beda20d9ee642a9, 0x0eff2c88e5a00fec, 0x30f52d82994dd60c, 0xdf06c8cd8a9f9725, 0x5f48f365467fbe33
+, 0x1718e0d7bc0ecb1e, 0x11cbe8aae736b1f2, 0x299bc3c869ffa3be, 0x11f102904e0082e2, 0x1ca06f13bc027633, 0x0c582ed15f024583, 0x50f418c7e759741e, 0x3617983ab37bea10, 0xcd74990da4f6506a, 0x26116267e30bb655, 0x691ac8e3d8774aec, 0x24bcf81875ad267b
+, 0x03bfd54f453765d5, 0x27f948d83102fd22, 0x1330dddb6c19fde5, 0x2beae23d87b0dce0, 0x1c22c5d417842391, 0x3946a6c32c2bb699, 0x2cfe17f9412f89ff, 0x7ce6ea5e6054b933, 0xb8f2ac13a69679e3, 0x6b6414265998fcba, 0xc9361928a79738e1, 0x44fba0691a6cd7d6
+, 0x21de75313a5021d2, 0x327aa93839fd5894, 0x8ad4cefff5743086, 0x5ada99d58bc0e3c1, 0x279919f78f8639c9, 0x260832bd8e696624, 0x8e1cec1952820db0, 0x329c03a49f9a6b94, 0x966cbf1453c37222, 0x5959e4c7382693ed, 0x940bcde2ca2ce7a5, 0x2e8c16b941cdbd92
+, 0x81e8cb22f7b8b201, 0x7abfb86d379cbd03, 0x97aced8dca004648, 0x5f4dfb1ed1f32cf5, 0x08e8969e71f92e97, 0x6a8e0f5143c1c4e5, 0xf75a795536daa2f1, 0x45306150f4d9746f, 0xd6a4088645c9be0c, 0x0e888678b4f57e53, 0x28e5149368c7e02c, 0x7762f54129858926
+, 0xef547d283de9198f, 0x4f90fcfbf64a906c, 0x5605ac30b2dc1018, 0x313348bca8be2bf3, 0x919664f6d4689236, 0x453a64d34160650e, 0x01881155229ea209, 0x21550bd7716ed24e, 0xef5379bd05495933, 0x7ccfb6fd8dab8a35, 0x846155563da4221c, 0x13b1e132d1373bd8
+, 0x64d61a1ecc98c2b9, 0x7f4add277641b36d, 0x22163995304d655e, 0x58a470a3d8e1d8c3, 0x11dea4bd291effb4, 0x05d9434df00e8c38, 0x1683eda4b5e5e44a, 0x79639a7c1a14f6af, 0xc52fdb3faa7e7491, 0x6dbab26fc17c3471, 0xeb692cdb84c9dfbf, 0x449dbc647f0e8e92
+, 0x6c5103747c06c792, 0x38a58204f4030423, 0x3d1cc5b42a8a903b, 0x1640c23aa02a3fa6, 0x5e3c342a4c5710b5, 0x49dfb54a598056c2, 0xb61ac43d9fa00722, 0x5b191cfaf33aa295, 0x9371e0c8dd3a7fc8, 0x376021c25f70805c, 0x4a797027e2da16dd, 0x5a39c89a7af95891
+, 0xf550932a665f5ed8, 0x1ce990a6057ea845, 0xa862c1cae4967a80, 0x53651531466a8bdc, 0x547000d858f2d5c3, 0x40d7ce9b38b12f9d, 0x587b41c410151757, 0x79c65d889f952eb7, 0xb2fa3da6d8951aea, 0x34266e0a3d9268e1, 0xf61f17eed810e15a, 0x04ba105fbb6f0b69
+, 0xe32fbc2094715683, 0x5e3971d76fc04608, 0xd2b4af9f9b936fb9, 0x7d423b6fcca380a4, 0x9e1b210d6e3d975d, 0x221ac965a5f72592, 0x3f67d9a3b3ff8eb4, 0x7edf58529461d0ec, 0x7d12e74cdbae39d4, 0x4896fe7a4a2329b7, 0x90732e3d22310d9e, 0x0509f7882b0d0e72
+, 0xcdd111cfefc15f79, 0x00b0e7137fddb333, 0x43899d22a8d0c901, 0x240642094cad8c7d, 0x9ba08484bece8040, 0x2d7cc1d266a88d77, 0x9ab99d192cf27861, 0x5967107ff8f3e1cd, 0x01e9d856da4b6b75, 0x74eca18ab5068750, 0xf6ab602cc00c9656, 0x00c22579e348626f
+, 0xdbf862994f68c473, 0x25105f5ff4bdeb47, 0x1a3c37aead8e8978, 0x36b2526833f17ce1, 0x75265b04d151d4f0, 0x7992f35a468d062e, 0x736e9fdece47a264, 0x05aa94e02db4c6c1, 0xe13d35a371905b33, 0x0700dbe170aa29c0, 0xacc6a4cce18266f4, 0x58fae83c100d600a
+, 0x104f6ecf6346ec44, 0x2747b9fc04060af7, 0xc360863d9e011677, 0x3aa778c71c447acb, 0x68787c85173c578a, 0x1ca413516606b132, 0x3bfb4e3bc030dcc3, 0x681c6d29fde2bd8d, 0x181007d0559ee577, 0x52123536029fb92c, 0x3528c1865c7b5884, 0x56a15e3675d34c70
+, 0xf835f662dd1a57e5, 0x26fa8326aaa70b8e, 0x05124a014472c0eb, 0x3931172e2276be54, 0x03bf6702fb122fa4, 0x4594c1ef92b0a0ff, 0xfe33d06db3ad8122, 0x27cd414183ce7ceb, 0xa142a4e140288f13, 0x47b90a6ec221e0ee, 0x0cfb31e540404c6e, 0x20f94e08a3f9c18e
+, 0x41874d1009d1ad5e, 0x16db50e009ab2aa2, 0x5d7f140417e4a858, 0x6c245b93256b9647, 0xbf3f45ffa0843086, 0x31d7a1228ac9b1e7, 0x2596203985f39956, 0x5e6af0813d53ab5b, 0xdd5cb3483e692310, 0x1866109d32501f5b, 0x9725344c7f06353f, 0x056779e5fc22d85c
+, 0xd957f8b9d4c2797e, 0x72aba247f5d77e60, 0x688acb4cd7dba663, 0x7c41388d35229b40, 0x28fa5d77afa19fdc, 0x78d9d9734c5c005c, 0x1c7b47c32c23c5b4, 0x71b46dca41c2fdc0, 0xee7b5a89926ac62c, 0x0e93b587ae8fa395, 0x5e8069ca85434b7c, 0x2fddde034075e46e
+, 0x7753eb3eba52a14d, 0x46d9b747f0e2f35f, 0xcab2b4b47f7d3a9d, 0x4e0d8fb818a365be, 0x475be95068804e9e, 0x4f266c9a28c54287, 0x8886596787add3fc, 0x6f6ebcbe17d555b2, 0x0eb3ac9410da5704, 0x6239f28a78663b70, 0x5d1a88fb96a624f1, 0x3fe2b541d0553d7e
+, 0x96fd47b527d419c3, 0x5a3854be9f179c77, 0xb69afe268e68e38c, 0x3df2c4c7601f09de, 0x558f1719d38f4f52, 0x7a4c9da387df4a57, 0xd68ae5fad48e9b5f, 0x51a49122c3704d54, 0x63a706952f468fa8, 0x37276c2a27100d5c, 0x7f69916f5166a5ad, 0x503756a8ad7d538f
+, 0x45bb4dbb52e62fa4, 0x49e5add48b8c6741, 0xb63f37e794a29083, 0x7dba2cd481355eb5, 0x71054e00c0799427, 0x3c9eeedb24aa0e0f, 0xc8d2af20444ae503, 0x1018264bc5dc0c27, 0x2d01c6c9d05a4842, 0x2db092248ac6f000, 0x2174c7aefcbdd9de, 0x17a98201959a8ad1
+, 0xefa6b245d6863092, 0x2e3d614acef75b60, 0x17b5eec865b38111, 0x6144fc8a75c57e85, 0x8b3196e9448c3ca4, 0x3a67e642195ba01f, 0x56827240a88c6569, 0x18019197f0aeb869, 0x585ab20f904d0229, 0x7e1ca9338addc9be, 0x799d86a1a738d0d4, 0x2238c350d47731c2
+, 0x3bac420c6a565a48, 0x3b784d6a3cc02eb1, 0x2e0f46a7b3e2f49e, 0x2276d7003a01c6d1, 0x483f96373aa915ab, 0x7b6feca70c63f044, 0x81ef683a7023f0c9, 0x406a180b88c50727, 0xd3b23a0bc77f0aeb, 0x20b6602bb7433553, 0x4a26c15ff9e63d3a, 0x05b1724c188ffe03
+, 0xf7b188c4f4f95fe8, 0x67a33874e691d004, 0x8c2b987beecaeacf, 0x17ba91d373dc932b, 0xa60ff910798e7b25, 0x705e8b1b1a5e0cc3, 0x8bb3fca097d6559c, 0x498835b5e5910b20, 0xcf4a2662c1dbd2b0, 0x684f897d86122900, 0x500f31711707ce54, 0x4a85fbc0a59065eb
+, 0xfc4f3fe6375c0873, 0x75b7b6523cf19ec2, 0x786eef3c009e1f88, 0x2cc50a6456b4cf42, 0xd3d850a0971ff2f6, 0x5a7dfd23ffcf06bf, 0xf9bb14c725fcf174, 0x10df45b4671b8e2e, 0xee21700ebbba8b6f, 0x552e1fa12c45a469, 0x34fa405074652ba0, 0x7f6217080f435417
+, 0x6eb0d344d45d88d1, 0x070094504875f1a0, 0xa15b41f5b4470453, 0x24585180f11ff648, 0x3e2504dc952da722, 0x0cc2a6bec4f6e112, 0x540c704105dfaba1, 0x4fadd3468c811a6e, 0x8d0eb32d6bc667a1, 0x2e226383c42c65cf, 0x5af4d3404bbea99e, 0x359bb793e96357e9
+, 0x7b9ed9520f8c096a, 0x1619477046adc13e, 0x3a6a4f98c4812901, 0x53d9519a2641efcb, 0xc39c3e05a004e748, 0x5ec37bc55bb862bc, 0x130701cbefc8692b, 0x6036a0ce48755908, 0xd3b39e4ec0fbb748, 0x01464794e2cbd27b, 0xf8c21c9602d32db2, 0x7758a36ca351d043
+, 0x67b5de277da0e5cb, 0x11d942bcd83aef88, 0xdb842d9c0e634791, 0x354740865d50bfe1, 0x172377ab0247f9ca, 0x725eea279c296037, 0x7b5cc6edd1743199, 0x6f7fabf27633d9bb, 0xaeae04ea07c91607, 0x7fffa05a6178f27f, 0xe8460c237041dd3b, 0x55f7a615dc972838
+, 0x6f2d308ca5e7843b, 0x02a7fdad3ab24bd2, 0x698af04be2c34309, 0x27a55faabe3afe8f, 0x5c3a559924f471e8, 0x6d660f0205814006, 0x55f0c71658c37cb5, 0x0b27642c06fa44e9, 0x0c29efdc79a82db6, 0x3958718c748c15a9, 0x086781f376c188b1, 0x421d0610275172c5
+, 0x3bb322808b00bf47, 0x0fce358a72db837e, 0xfbe66982d2da120d, 0x685088d5ca85d4ec, 0x4ca1a3ab8cde5371, 0x0da7e42793fce878, 0x44539ce9dd5fcc4c, 0x7c0215baadaaa862, 0x7351692c4cea1f74, 0x2f313f39d8eff77d, 0x09c968891f69a656, 0x369ad9fa49e8fd33
+, 0xca69cc5c98392eca, 0x3f3f67dd073d0643, 0xb52b2e703c97aabc, 0x1fac684f43dbf38d, 0x563ca8605f8283e8, 0x7cf0ae2312151dcb, 0x5f4500939684c46e, 0x2b81445a6f3567aa, 0x714d51013cee7f50, 0x3780be24a200c0c1, 0x8ae1ae937160c0c5, 0x6db6789ee823608b
+, 0x6b049bb8432b5fad, 0x07e917ab40c28f59, 0xec7fee91f3aa3ffc, 0x5f7d807399e165f2, 0x4eb822076244c26a, 0x460502aef42861ed, 0x3e394d2b75ca7667, 0x69622c3965fb64bf, 0x8eef941c934ec7c0, 0x081e171a937fb68a, 0x43467be848b9f206, 0x79261832e36ef6eb
+, 0xed05fd330f743ecb, 0x5e8436d7347f0f68, 0x48a6f6c02db7b2c0, 0x6aff32fc65496cf2, 0x87f94c5b3b50602b, 0x651142589a1fd649, 0x486428725e2c2cc1, 0x4aae63bc6b73cd10, 0xda9c073fc1a9a9a1, 0x3c815f53fbfb5acf, 0xc880241d524c517e, 0x3565b8d1a433bc31
+, 0x371b5de3dc64657f, 0x6767a62a33556304, 0x08b9a1ff4f093916, 0x15086793009f5a24, 0x8c31e6df9d7aec7e, 0x7f5088ecdd710d1e, 0xa7d4265f5c5fc382, 0x3f5881212a16c578, 0x8035a9ad32b34795, 0x1fafa2b9587f0f23, 0xaf98f3974c5da8d2, 0x5bf3bb00e119f79f
+, 0x7865c79274d53ff5, 0x0156fc9d9eb7b8ba, 0xfda6a74ed9fe65a4, 0x5e969514ad07b3a5, 0xae82764d2e5f319f, 0x3f5e0721e0f963b0, 0x6c69385748bfe28b, 0x06c40f75a988ac37, 0xaf8d277e27d59f93, 0x4f08f94698eceba8, 0x115c43222ac5db45, 0x4229eba458d3448f
+, 0xf77ba90d801730b7, 0x44a7c3debd291b59, 0xe8bc74e60cb9a60b, 0x10f9133c2898f874, 0xb835fdbece9ff574, 0x197e686963bfbcac, 0xd52169b4ec4b1f5c, 0x1c0ec05b7b14fe87, 0x08a110c22e7b4b21, 0x4181eb133b3a212c, 0xbef67ba620bfcb70, 0x1233a726f430929f
+, 0xc68d1b3865010de6, 0x6cfbdd268d46e097, 0xf9b9d580fa031665, 0x2149ae007000b907, 0xc36440af53dbcaec, 0x4329ec4e264c9e9d, 0xc2a7992a069572ea, 0x6763a04b7a912c74, 0xc000dcce7ac941f9, 0x59b2bd3f60687cdf, 0xb35336256e85f7c5, 0x7925b0a8ec08441b
+, 0xfb9546219f3fbf99, 0x5ba8605df62b4bf1, 0x0fd672658e726071, 0x40890561fd7bd30f, 0x564a7cafefd96274, 0x76d173e63b7658ff, 0x6550ebeb7225bb1f, 0x415fd47693e6b224, 0x08f2ce0c54e40107, 0x2d3e9990ea404172, 0x6c850b8417af2c25, 0x148276b053872f8a
+, 0x5504ce795e0eceb3, 0x0d12883ab1b52376, 0x50953ea763a33bf7, 0x533089111fdccea8, 0x46b647e604ba671a, 0x4877063d3ce38e40, 0x0126a72dfb291671, 0x4f0024133391bd79, 0xe75c69afa5d1e2c8, 0x546d8e4fb5897274, 0x47ea3cdddfb8a196, 0x68d121f387262cd0
+, 0x2be12ffa73d83d50, 0x28ecc06877e94665, 0x8183762b2a5c4069, 0x0ce786867415d353, 0xf61d665bfa926022, 0x6425df3d102a033b, 0xd88c6da75953f8b4, 0x22d2639fb166a501, 0x72f6aa4a3b1bdd21, 0x6c2ff334f0ad03f6, 0x08abd12169b2f756, 0x725285bf4e4803f5
+, 0xf5c1ef16ce1a540d, 0x1688dbc336487490, 0x120f8aba114377e1, 0x64918df11522f734, 0x9e5f8b59e30e28b1, 0x101c8c3389b7edd4, 0x31b40a565b463308, 0x62db2268b84cd82f, 0x6db97b485c449be5, 0x082a14d870a85a06, 0xa361418e19587a9b, 0x55a23439cb8c120a
+, 0xad0bb3432c929f2a, 0x7b08f639925ece15, 0x8eeee58740916f12, 0x47ac4f86a2f00389, 0xba6c003c8548d397, 0x25d1a33d72f9194f, 0x64b5dc30b687e674, 0x48961306b55c0f24, 0x7395a2bd0d2dba60, 0x2668005216474acb, 0xd38d8bc7f353db25, 0x60e7b2948824f11c
+, 0x944d77178e7880f2, 0x2d98101a83d870c0, 0x98d414ccf602b3a0, 0x5b3288a59611e444, 0x5dc184290d7f6d7c, 0x0089107fe050cd40, 0xde6461ceb7f87120, 0x01769b7ef30fedfb, 0x2165ac31bcf823f3, 0x427e0c733e5d777f, 0x86ad208c34055c4d, 0x09db88f77c79a199
+, 0xe971750d6a3c3894, 0x195d5d33b4665f7a, 0xe34fe4dfcccc7417, 0x506e08a1a6e4162d, 0x41479e1c6864da50, 0x2a069c354adeb50e, 0x7ba09ec9c2ec34d3, 0x179d08840420412d, 0x3ca90495e5ab33a1, 0x6c749e4bfa656ff8, 0x45a8ce3e0ff33d8e, 0x747f1d876e5bfb9c
+, 0x93cd561a36690a46, 0x407c31119f28ac4a, 0xf34018c1b20b279b, 0x383dafd646ef6cd0, 0x7f4bfeaef93bdc55, 0x6b466d83ef4437a9, 0xc824fadfb5515290, 0x75d97507b17b2c91, 0x3757027e83f4a66f, 0x7039ad2f3e330088, 0x4bd0b5f906c54c25, 0x4b23b5e3e99c9943
+, 0xc034a0906e8ecd8e, 0x6e17bc46ea765d5e, 0xe1468dc8f7ea9fda, 0x468d604f5cfb70ae, 0x487115b769f6c3a8, 0x5c24e209ddef1302, 0x485a4dd227064204, 0x6903bfc59c06048d, 0x847974e842dcbb3b, 0x0f2b6336b6687cc9, 0xb3ebb72c77c1648a, 0x2de043ea85581ad9
+, 0x495a70d47b87b0ba, 0x31391cb1a440facf, 0xb58d812add6e8430, 0x4d46bade344e1be5, 0xf78434e29a1375c9, 0x4eeb2085d7f3510b, 0x1210d7606ba20c0a, 0x09af1d6b34043b66, 0xb588fcdb9b29b970, 0x618a74fad65e5445, 0x191a91e3312d4186, 0x51fd5272d8672dc4
+, 0xa2e1a4e1ff80d199, 0x57c91b8cacec80ea, 0x4b0bf6390742b1ec, 0x261acd26833d4e97, 0x6c06c4ee60b17479, 0x67e60a1e5c0b54bc, 0x1d32c993fa055a97, 0x1a024532aa954733, 0x8a41543a51a17bb8, 0x09373f5aad759758, 0x2f7e6bd1222ebf42, 0x58e6cce539e1264a
+, 0x291edfa29d8d8e3e, 0x2e756f11337cdb06, 0xdff29088af682b12, 0x3b79f951fd05e958, 0x966751d307555ccd, 0x7cb155f4009c16bf, 0x664ad2ee81f97a9d, 0x3b1910af45430a8f, 0x3f82bd770b3f393f, 0x6de810736d3be58d, 0x50d6195b26860a54, 0x638c79d7bec887d3
+, 0xbdf636c568d3a811, 0x3ef81571f1529421, 0x24e1aca196b7de97, 0x0a2ed49a91d6edba, 0x6466af567a756eb5, 0x07d5960e7b61eab3, 0x3661a9ed70ef545f, 0x0820679fe004020e, 0xe8aec7bf70d5e238, 0x0a075e102bae6ce4, 0xeb843b7ebd631208, 0x2b05ebc62494ac53
+, 0x469b9b6021ee4544, 0x29e40eea488023e4, 0x5b5244ff9b5b7b48, 0x43e38f861096cf90, 0xa5100c2c868a0255, 0x6cc5158b307190e7, 0x046b095ab68006c0, 0x1801cedaf61a8237, 0x6ec66cd92d9b68b6, 0x0fa3b36cb1494c1e, 0xf09d5271f690e2d5, 0x32162ade9744f4f3
+, 0x675a0d9a405592b6, 0x0ebe603b6596917e, 0xfee6f93ebb6cae00, 0x4d1c6888fe96d2a7, 0x5eaa653229b49b16, 0x053ff810412e792e, 0x05b0203baf56e5a1, 0x668f3da464daae97, 0xbca49f15801ebd9e, 0x191af9d62055162d, 0xe647ad774b10eb41, 0x5b62b168c7d56f37
+, 0x1c52f547ce79d095, 0x32230e153a5ea83d, 0x63d2612f5ba4ba2b, 0x4e7d29d9a75de4d3, 0xb95e54ea19b6166f, 0x31f45ad4d12c21b0, 0xd96552316b893e00, 0x3f577eaaa4df9810, 0x7a8b0d21ff19fbd0, 0x570fb00ffb9c56d5, 0x88ac6bf6adbd890d, 0x4967b81285613abc
+, 0x24b3e1a6a939e7f3, 0x44b61c94be1c72f1, 0xbaf82745abcb7bf6, 0x1e6200804c48db0e, 0x6008809de1fe1b14, 0x5bf668fbd40cc3ed, 0x6e1b8e2543235e06, 0x081da917f5304d95, 0x9bd02f09fb5d855c, 0x3adf917f766ea753, 0x39a43adbc321f749, 0x037925ddadaf2708
+, 0x5263dc7ef5aa8644, 0x68b9dccddacc37c2, 0x8affcf32b1edbc56, 0x4dd0116798d4ea85, 0x900932d2e48e79e1, 0x1c453ddc6a483b01, 0x16d2f9880791a85f, 0x4308a4f8b640739f, 0xba2ba84f6bd951e7, 0x531a6f2c962d698f, 0xe9bc5295c38b603b, 0x456aaa1684b85efb
+, 0x2e74199b843b51ba, 0x1bd4b84374bcbe43, 0x3430df1eb76ac4ea, 0x71d80f0e04f011fd, 0x29bbd25bb0106904, 0x317503c01bc4186c, 0xc629275a1760082d, 0x43e204df777dac9f, 0xe5abd7d935679d27, 0x6bc38c75c17517c5, 0xfdd36630459cc078, 0x67e8916448f591b0
+, 0xf3ae89efc9e56b0a, 0x465c91cbd5ca4bc5, 0x4d57ceecd892bca4, 0x69a95896ac3887b1, 0x80ba97ca5b48ca18, 0x69e8e69c7a0272f1, 0x69a1667023995bbe, 0x5939a4b16f4ff419, 0x3bdbfc1a51433f30, 0x7389fffee67657ac, 0x31342063a4cc4f8b, 0x104083acdefc5b42
+, 0x92bf0d2d474cd9f5, 0x64c1ead587430170, 0xc5469e0626e8573d, 0x380e74cbb5ccf011, 0x906949d1f18db04b, 0x1484aa6065d23567, 0xad56fc7fd7417bac, 0x4cf67e6bff9eac29, 0x30b080621463fe2e, 0x3be454d298678dad, 0x0806df077993cf5f, 0x7839593ac62d7672
+, 0x44e1c54743ee8727, 0x556051fefa41a602, 0xf5cec4b370cb3fa9, 0x1691133aceb7187d, 0x9ae0002542670a59, 0x4aa0dad44840daeb, 0xdb603505bbfdc322, 0x675587ebc9882abf, 0xef1c547538a5846b, 0x6bd179b7d7ffc3e9, 0x4859c3c6749cacf8, 0x684439f444bbf862
+, 0xd07058304569bda5, 0x0fc12faa106d030e, 0x9722c2b313e64585, 0x6a9361d79067e3f8, 0x6643d01005005b79, 0x3a3bf9f826314494, 0x01bee71a64abf068, 0x5394d506627a9dd2, 0x52596456c89f957f, 0x76d9f2cf37664562, 0x37d995aba230de19, 0x7a0370524d6ec401
+, 0xe8cf2667923acdfc, 0x72adab0b24f0ec02, 0xc3773ab2be235e95, 0x5d160da7e8d60584, 0x94a04bebe5298217, 0x65a6e88f36d0ad9d, 0xb19c4fa9e697beef, 0x09f3d3ddc024c8db, 0x7a2af88843caf605, 0x1574cf25ddf71c31, 0x94cb18931ffeafdf, 0x5ce0c655039cee6a
+, 0xa4f8a5f0fa06c8a7, 0x7508150e0ef894c8, 0xe8b6d62dcae6da6b, 0x5eacf1c54cb0b7b4, 0xa4a0a2938b29f966, 0x0853133079c5dfa2, 0x81073b65d3df9e50, 0x3125a0d5457d4f0a, 0xafd91eeb83905e29, 0x2b06cd72bb2ebd8f, 0x1642e62dc0b5a715, 0x647298123810c262
+, 0x42e725a6b82da46b, 0x7767f924dcb43f73, 0xc857ecfa59314f77, 0x00cfd5b6a401a93d, 0xfb71e18a263fa11a, 0x257e93b392c26718, 0x6a3566b0a2ee557b, 0x6b141040d27dc0ec, 0x62c1338315e706c5, 0x356608d38dd6ae4f, 0xae7f75d72608c187, 0x0e49dedba75639af
+, 0xfd1519f1135aacfb, 0x3c4be44bf6d4735c, 0xf1049ace51afa672, 0x28f6d79b79baceec, 0xecc5f347ea45ea39, 0x2693371effa7e0c2, 0xe0aae07ab64f6dbd, 0x41bdd94611688c7c, 0x8756f3c29033522d, 0x669ab9849b8e196f, 0x67b95dfb3bef051e, 0x0519ee56100ae2ad
+, 0xe17bfc0bd71d3b9d, 0x6bc0226c0bb5a8f6, 0x153dba33a1e16d3f, 0x6fe201d8241ad0b6, 0xbf7440591035ae3a, 0x1a14c9eec2a7115c, 0x9f3ed0408e9d8c56, 0x5dbc4f6e38beebb2, 0xed2945acdeaf6f61, 0x5f4c72437a51809f, 0x0990b9d74a015f5c, 0x44733c28c79f710c
+, 0xe961d8d854630321, 0x2892997188067a39, 0x0480992e5a1becae, 0x672ecaaf660bd97f, 0x43cecc6c74e2633c, 0x416f5f2403953ae7, 0xfe995badb5dccf9b, 0x5a84c19f197d0265, 0x77e9c29122ba51a1, 0x790ab4c805bbb46a, 0xc7777590e3912b73, 0x4a9c37dde8e7e4a1
+, 0x3a9e85e47e0745e4, 0x0d36e3185f489b64, 0x0efdf9fa38b0c676, 0x36942616ffc30e58, 0xfe317970e2b1873a, 0x4c14ab0ed89e7d77, 0x21e4e39194c78b37, 0x60a041f22f69a39b, 0x324107981ad0539b, 0x51db3d73f3499619, 0x85a6f03acc357114, 0x73ad23555d6583ac
+, 0x32f64385daeafd13, 0x7f3d861055cba697, 0x93ca96d79062ef6e, 0x20ff9e420565b419, 0x10cf343c1782539a, 0x03fb7efd77236b9f, 0xe58e81f0056ac523, 0x45ae9d3a903a3898, 0x9b720f2240a86d35, 0x30e01464b85cc1cb, 0x04a3b2677b739110, 0x6764e7ccc2d5c566
+, 0x59d1279c4f60a95f, 0x1aafe77e1ed707d8, 0x140827a745e2893f, 0x68c6d5e9d455bc92, 0x99823c57b78426a3, 0x093e8251110d2eca, 0xcc010b32a3158201, 0x17c11ab18706b73f, 0x52a23a29fc912ed6, 0x53d3bfe98ed10651, 0x7b5ae110e4fa843a, 0x11dd2289d5320465
+, 0x723c81f74baae055, 0x09d40627dc6c7e49, 0x25951184b74b6cff, 0x5d968ab877e26888, 0xd6d0c8230eefaf8c, 0x4e5d61a164969d69, 0x863a788dc4201877, 0x59e1effbed328a12, 0xecfdcaadfdf92058, 0x24836f037dd3e4ee, 0xfc42ea251858b78d, 0x2e0d68f8a4faa837
+, 0xb98c2d54cbccbba2, 0x61eb6c7d7202259a, 0x9f767bc367eba90a, 0x638e35c08c64c11f, 0xf71a3fa187cb7dd4, 0x3f2a25388770db3e, 0xfc15b3e0707b2bf7, 0x63044197fb9e7e99, 0x4fbc44061cba1071, 0x52fd5619d045af19, 0x0901cc4134a13ef5, 0x2a0924fa6a0d575d
+, 0x3e1a547e7be702ea, 0x420d26eddafe2ad9, 0xcf58c56e0f48cb1e, 0x6cab7700a2ea8979, 0x89015724c759599d, 0x76f46f6738239a4a, 0x779c1a68cb6f0463, 0x2c91b45426fb4186, 0xdae2719df8b1f26a, 0x33c8ded6f878b84b, 0xa6aecb45ad0066c0, 0x06545dbbf3e572f8
+, 0xd2be6442a561e776, 0x4ae15bf9b321e042, 0x936fe3871d2d1b9f, 0x6a23a371a332130e, 0x6d5e93b57a5c932a, 0x7a39e34d1754cce2, 0x623d5d0dd944e1c5, 0x0cd49bf5892551ce, 0x31fb955e7a5c93ff, 0x0a23981b006e5eae, 0x262104b86e81d0fd, 0x62673c4b84595b20
+, 0xcf871eec596ab627, 0x3be8f3d857730122, 0xb8d107c98a7e68f2, 0x1305ac29df9c80bf, 0x68c0f1a64bf2f648, 0x24dbb6a34a3abbce, 0x92fd5b9f5c11f92c, 0x2b4a55626e6b5d1a, 0x1d5f42ba72feb44e, 0x42edd933872e8b28, 0x1d5f03610ddf7a7f, 0x7f7a3c6eff45de8e
+, 0xe05287f13c84ed17, 0x5975c6f0d2eacc5f, 0x4376cb7646c12c0e, 0x0461957858d631ee, 0xd232a6091cf60bb7, 0x71a5060ab00109e1, 0x5a9887b8d87d7c4b, 0x1efcdfc9a7b62d1b, 0x796e0162c96ae487, 0x6c7daad0bd6f8446, 0x446c03681d610ea7, 0x6acced57e1aa817a
+, 0xe0c40aba101fd9b5, 0x18fb9ad5720a6136, 0x4f6b2efae1fa4af4, 0x3bfd6b404dd0fe73, 0x038db5db908778c9, 0x500e5f4f29bbcce5, 0xabcafc04c00c5242, 0x6be892c4f6116397, 0x03549b4955dc12cd, 0x1c5d19391ed01ce6, 0x5656071423cbc1a9, 0x72266c7748a9f72e
+, 0x5f597b82d274bf49, 0x7f757d90d63ba390, 0x085c00db0865e785, 0x55837adeb4700b3b, 0x68d95a35f5fcadab, 0x705f7d7963cfda89, 0x1b99b33d990a3b15, 0x106abfaec4ce7c55, 0x5a555cb52f3d0bc6, 0x6f9e44edeecb5b63, 0x38b1721c6d338f64, 0x2dc24cd73aa4cee2
+, 0xd6cc39b0aa585b6c, 0x070f00bda5430988, 0x96bdf492e58bf3a9, 0x172e920271512974, 0xca1639bcdfd54a88, 0x3288cca6eef7ffc5, 0x7aa94d544080322e, 0x7555b7eb5a948a10, 0x5d19d43db337c70b, 0x0d4df34082c136a2, 0x332d930ea46cc1b3, 0x76407373cf2b4ef2
+, 0xb39ac68f4a6718e7, 0x30cb5a716e24513a, 0x9dea9213ea657b21, 0x27f7745ff298e6fc, 0x02b0996d69837692, 0x2fdf323f14b3fe14, 0x525b06980a1a6c69, 0x34ee4a0c537c5ea0, 0xb23a58b8fa46039e, 0x7eadf6c53d61130d, 0xb2b66b0c6c5f2e61, 0x4933b8e9e50535d9
+, 0x40efa521674ae68b, 0x2280f2ea2a347bfa, 0x26735c2cae6a5643, 0x220505448a1480ca, 0x2d3d4c4c67e1f5c5, 0x23b0feef166f430c, 0x6272a29b028ef96f, 0x74651a78f03b8729, 0xab1dd71eebe98b5d, 0x46de9a0548d917c0, 0xfcbd248bf6f2bc4a, 0x645c6652d09a7ee3
+, 0x72a18ec40d9ae0d0, 0x4663c3c2069b3dca, 0xaaae7f6690e5c5e3, 0x2c1dc4f06cbd74a4, 0x7d10e7b4b03baa64, 0x4a014b1cc5b77983, 0x77a9f3583aaa8390, 0x723f3aa72de61661, 0x2133ec65ad815ef0, 0x02756f6a2bb929b4, 0x86daed6700e0afcc, 0x7a79a29d51787f02
+, 0xc7bfd5fc996ff28b, 0x5a882ec4c3ae64ea, 0xa85ebdf1dc108322, 0x33de4f73b7afdb50, 0x37d7fb557660d1c8, 0x682d7ff29d111195, 0xe1c2bd1abaea45a1, 0x5a65a9807634b678, 0x17e6be2bf39bdaf0, 0x2fc0c2516499c941, 0x680887f4a5db25df, 0x5fef467b14d5efe8
+, 0x7cf88adf99a430b1, 0x26efda27b2645fae, 0xb474ab7093588837, 0x642b2d9e3b68ff99, 0xf32d2a2b0e9dd862, 0x22557b26439012a7, 0x540b8bad392eee4b, 0x7b2481dc5c3c1c0d, 0xe81150d16b4f1043, 0x7711a9f4150f46fd, 0x678fbf2354727835, 0x6059524d6a573d50
+, 0xfdc316f1109be520, 0x1e1d0ee379f7b013, 0x741aa175ab0eb062, 0x10d636029f1c2058, 0x1500945e9a4a2243, 0x238429d1893bb2dc, 0x87437fcc1923ddbe, 0x424fad2b89a3df73, 0xa43c71ee2a0d2c19, 0x20ae9034f288155e, 0xe30f2631c038dffd, 0x01f4af3f6b4a35c9
+, 0xea9c74c762196c4d, 0x63b5021661a845c8, 0xdffeae8dc1f70056, 0x1000ddd77696501b, 0x39e24f69a3ea8548, 0x473f1ecbc4e8f156, 0xd21b10dc21e9de18, 0x08baa6eb8c4b63c1, 0x0efc489578ec89f6, 0x6f6176b7a4cb43aa, 0x739b498f3c903a57, 0x5aebbba9b53cf91e
+, 0x8bf5c0a1c4abd709, 0x55b4807ff0bad9f4, 0x7b992e123b061318, 0x201073dc65762dbc, 0x2d16830992f92027, 0x450761df67231d12, 0x369e8548a70f729b, 0x188440a8516aaeba, 0x095ccbbeefde1c18, 0x6a86ed9702f7f167, 0xd22f675697a7d3da, 0x53d58d6e1a58be71
+, 0x63c2699c4b660765, 0x087640bdab3fc3dc, 0x863eb10832409b5b, 0x34c113fefba010a6, 0x947705b6374003a1, 0x5411f6832059a256, 0xadbef039dbaea8f5, 0x404ddb392687bec8, 0x304ca34a18ede86c, 0x73b31068d78b1435, 0x009f8bba346da7ef, 0x732ffbd4fe15b1f1
+, 0x4de1f1c2b6299536, 0x5057a8e7b773a780, 0x8d853a62e09e7bf2, 0x18eb4e095f40d3bd, 0xdd376eea237a717b, 0x0ea4fa6b0a0352ba, 0x3b7e12e26ca80932, 0x0735823dfb6af721, 0xa68b2389e12fd6da, 0x05c608a02bbcaba5, 0x73d681bc0748752e, 0x04bc27d1d8e52507
+, 0x5835e8ac7c6e065e, 0x0681f86abcf34089, 0x8d104fc9ecd1e8dd, 0x6a68eabe17538f95, 0x1785ebbe7c79d4d6, 0x50d1f62ecf322ef2, 0x5b673f8bff452144, 0x147698ad231fada2, 0xa9991d0443f298b4, 0x4295e7539d42eaf8, 0xa0b04d2efdf4d9e5, 0x45147bce240466b6
+, 0xbfc815c90f2e2959, 0x594d346e4890aebf, 0xfafc64612562edca, 0x61f0e2d66cae752a, 0xaf74671874b38e84, 0x09558f551ba5592a, 0x5131858bcbf72bee, 0x605f9f2aba9a2d1e, 0x281a6572edd7b16c, 0x365514e4a6935b27, 0xab9b7907e2e4cc95, 0x6dd33faff6f8affa
+, 0xacc83de8e129fff2, 0x2694360d8498b0a4, 0x0e3761775e28afb7, 0x4cf080fd408a595b, 0xbadb071cc889d99b, 0x753d7326426e4bba, 0xc7cc8343f12d0583, 0x6d644f2e0e47aaac, 0x74ceb46686164663, 0x0f4ed3d32c0abea3, 0x1fdd5297c1ca0ef2, 0x1901e4a79bf37239
+, 0x17ab4948923cf429, 0x4607e54456d23c3d, 0x16ab843198aa4fdd, 0x2e3cd49a682c66d6, 0x7e0a38c13f88e55f, 0x5d58237e8bb1fd80, 0x0908598cdd68e1af, 0x339d8ece1b5ba62a, 0xf9d8adbee80cb12b, 0x51d7e5566d061626, 0xb2cbb3ad07239613, 0x7d704bcaef575a4b
+, 0xbb0230c8f94a7cbd, 0x2b6761eb028478dd, 0xa72a0254b9903eb0, 0x6e8905185affb9c4, 0x307b9c2502de8796, 0x5ad3598962e71cc3, 0x3c7d13e0a4a4e104, 0x73874dc2bcbf85fc, 0x142ec5d1d62ffeb1, 0x2fe3b03cfade056e, 0x6561939e7070d073, 0x0d34b8a947113313
+, 0x9d1b9ffd69d3fe78, 0x4f0310adbe416005, 0x8764c3c84b65ab9c, 0x5e53c52a8cd71648, 0xd16466ba48abb8ac, 0x02d1772f3dc7dda2, 0xa232f8d8f6377767, 0x569c30358557df70, 0xbad66a06963c1c0b, 0x2dfb571c9e904b3a, 0x4dd8a7de1a8156f4, 0x7aa690d3ddfcea7c
+, 0x957226747a05945d, 0x290d48bb3464e4c1, 0xeb83efde9d007841, 0x676471834f19e47b, 0x6375c778c1ae9e02, 0x4fecdbae858cbe1b, 0xfbb510ed27c20801, 0x14ff07697e75695a, 0x814db9f424bf6dcf, 0x67c06c06da0be1b5, 0x74f2c732e1f81d8b, 0x02a2bdae54c92c80
+, 0xa188e9aff117f1dd, 0x76d8e5cc4ceff740, 0xd404a4ec36918f17, 0x0be000b5ead201a0, 0x5fe2fc558223561e, 0x3fb99127c4e118e1, 0xd15f6f52e329bbcd, 0x6457dde72071efc5, 0x2b692baae3905fd9, 0x51e281259f58a169, 0xf56b27d94f4a4748, 0x124f28c8fe2c5d83
+, 0x9f787f603a2aef3a, 0x2d01f7e090257b8f, 0xdaaa7ac50a95193a, 0x75ed05a98f0fbb12, 0xee6d3fffcc9e411a, 0x543ad99a5ed9ae00, 0x665e1589f54c094c, 0x0eec2e8b8abde1ca, 0x6b6ea150c58ee5e0, 0x53991b3c26be87f5, 0x6c508942d0a2efde, 0x3160b5223bc65ad1
+, 0xdab2059802a71e4d, 0x6b978cdfe965b3cd, 0xaa179409841415f4, 0x425c1d49f7012bd5, 0x89992d4c149da372, 0x19e7371a15f7ebc5, 0xffab68b2f0b0157e, 0x1631a564f94ef822, 0xbfabf15f197e2663, 0x5637b562a1009abe, 0x9e06e906f3f11d8b, 0x39fea819d1d87e05
+, 0x2ea0c9e87ef2ca17, 0x4225c1277d26fcb6, 0x818b55d2e27bfa7e, 0x37c86320ded3e471, 0xa513b1591fd38df1, 0x628b74c68ea4c69d, 0x4f372806276caec3, 0x70cabd2584776326, 0x503b8832e17b8c5d, 0x3a15c1f68effb26f, 0x58ca9a78311e37bb, 0x25c2a2e88d53d4d1
+, 0x9f273b3c448894b1, 0x1357dd22efad912c, 0x8da052354d6c838e, 0x1b554b3e06c5310f, 0xcdc5b717469f2445, 0x7154c4bfba8d24fa, 0xd2be0b721433a451, 0x1918b5db06d2f469, 0xf21d9e6dec644095, 0x7f3d3031655fa435, 0x850582091b0859a1, 0x25493de4b7055eda
+, 0x885d375d5b363c6d, 0x088c4f76f6d9a4cb, 0x7a7dcc135cee17b4, 0x4d16a2bd583a3e01, 0x7a79c6d5b14ed228, 0x0aacc74d81cd70ab, 0x8a5fc1e076f97516, 0x0294bc7dfedb29c9, 0x8504c2302f6d6491, 0x5ece8118e10ceeb3, 0x20fd0f4542109551, 0x5fffc16f73f9ff4d
+, 0x4d1d61d95c40f383, 0x183ffac4a0afd74d, 0x853667fcfaef6bb5, 0x01b5720159fe9161, 0x17c7021a681b5cd3, 0x7a41ec926eb204f3, 0x9d6344f16a49ba36, 0x6791fd9c83ea9905, 0xdda7c8cf5d7f5cff, 0x211e6b0e5b1b74d2, 0xf6f1c600de802e9e, 0x32b7259325a236be
+, 0x7dc7c965945b9912, 0x0d852adf994f304f, 0x3641c43523dd980b, 0x10ce120b61763852, 0xca23b30e8feb3909, 0x428f35995608fce0, 0xdd793cfd4cab95a0, 0x5ff55b6715ba744e, 0xcf1d06b248325f33, 0x7452c38873bad218, 0x94c4cc4a3c762643, 0x0ae7d050ece200f7
+, 0x845c8ed2ae401198, 0x42ac1622ac9fd38e, 0x65b7d29722d09329, 0x5fdbef8579c0554c, 0xa7601d457330a764, 0x08d286554fb7c9bc, 0x94e03e02bfde4afe, 0x36575e36fa5a30b5, 0x724fd5f3c333492e, 0x041dfb6263b37dae, 0xcf8f8e44cea982e9, 0x3f3d77ea55859eaf
+, 0xf4092c4be64b5e6b, 0x5a86823f04c8b479, 0xd248e96287ba84f7, 0x245d5c86e48b1fdc, 0x2d40948dfb601bea, 0x092b6fb2d4a10879, 0xbbf8ff4ee0735134, 0x03ab89bfe7c74daa, 0x714769d4aca7d1c6, 0x3e35d48d2b0344aa, 0x028d3b8779d6ae89, 0x13239a3186a6f689
+, 0x66ad3dd6eabfb769, 0x3b7efede3b758af7, 0xb0c5c5d54d6bef8c, 0x7e779309298290dc, 0xb7934e4e0e3f0fd4, 0x68892ee031086469, 0x587cbbeb2d480b70, 0x5e7d5113ea09bdd8, 0x58e7954a9eb224c0, 0x36126e7524d26a81, 0xcd00531e1951121b, 0x6fba622a05434c9e
+, 0x40704e134f7d0942, 0x5a816fea661fbdaa, 0x3e36898cb8fe3ba6, 0x3e80755c39f0bff4, 0x83d9b2445a222b4c, 0x2470dd6663ef2b01, 0x5fa6547cd85da1ff, 0x203bb8206b0a9bab, 0x4383655ad7a33007, 0x7a633c1870a29a88, 0x3ab10c0cec28f345, 0x15daf8c5c27b8957
+, 0x3aaaa8dda5d6d8ab, 0x2c265c72148e5799, 0x8b7eb2718b1dee0d, 0x284cdc9da37561eb, 0x934551c0b871af04, 0x3d5adbf3020ecb59, 0x11cc9f2ba753ff55, 0x17a97f0d95385680, 0x30a5101879ddcd78, 0x3343ad6d6f5a1f4a, 0x4fa7f4032eb6f2d6, 0x2e4463e3feb191b9
+, 0xfbabe8f40852b38e, 0x65d85636c18209cf, 0xf1eedbbde6cbe1d4, 0x7bd2ecafefbd2f63, 0x918f1d0647a348b7, 0x7a27d4c973d4780b, 0xfc9f4b14e61b7aa5, 0x7d10b4870cee9af9, 0x10baf5f7b06de931, 0x4bc543d59a15bcc0, 0xb8e2ce740844549b, 0x745fd0117a381328
+, 0x8027e2c9c0e098bd, 0x77ce7d2a9241c09d, 0x27b46a7b02b59141, 0x6602cf431ab956f2, 0xd0f720ee7e9ebf16, 0x07f0bd837cb2c0c3, 0x405d6aaad7de78d4, 0x4098e3c9b4a7c7f7, 0xee2ce0f9906b11ad, 0x3630bf66c86c16db, 0x64ee68a6eff741bf, 0x6c64e3df5772c22a
+, 0x5d09c469cfa64d35, 0x5b73d2dd5726fe4a, 0xcb84352af0b0294f, 0x05e9ea69e8bb0dd6, 0xa8e3ca9f3ae1ad64, 0x7ba3a6982ec1366c, 0xe9317af145f89c8c, 0x7837ceb8947cd85a, 0x8944965a50631e85, 0x1d4e723353b61b9b, 0xd96e5cc1e63f7f9e, 0x19cefc5799c47e2a
+, 0x9c3dcfe9159c4a1e, 0x6922b72727dbe186, 0x4a2ca4ee6e35b893, 0x54d10dbdc2136433, 0x4bc0ebdcd346ea37, 0x6d39cf712cd9674a, 0x083fdf8e43bcdf5c, 0x6f9f57983b1973c6, 0x1eb95f411d715e85, 0x11119ffbdbf0ea17, 0x4ead22a313d3346f, 0x05b313a5b3faeb02
+, 0x8f9f272ec8771ffa, 0x6137e756ba13373e, 0x5a2b87371412ac61, 0x05f6b13db338df0d, 0xe402eb94a43b9dcf, 0x0eddbb7d5a979507, 0x19ebfa1ad15d600e, 0x4db6f04e04a34898, 0xfd9a0d8b5d2cc45d, 0x1c9b0fa4a4e4947c, 0x77e8964c17bbdafd, 0x0ae54f9d80957699
+, 0x79e35e11ac4ef172, 0x586c9cb681e23df6, 0xa827b2297b4cadba, 0x23de1b250f5df12d, 0xf3389a7e7b46c16d, 0x26067ca85263233e, 0x314b01584aba1820, 0x724f9ac19eb2054a, 0x42c7982b8e61e48d, 0x76ce6f5143b4f64c, 0x1329927b0ac43f0e, 0x41536db874679a6f
+, 0xc6aca5434eeef246, 0x1f0139fcc0b320df, 0xe2bbc079fa184981, 0x33b92f1426381462, 0x5163f3d13d7800bd, 0x2fa8ef59eee07dd7, 0xc195a09e327f7a29, 0x0ed60df388bcf93d, 0x3c064f432d8d7df6, 0x1ccd3dcfafb661d5, 0xa19badebbf38e3b3, 0x01c79b7f72641a88
+, 0xa3a0344c89ef1b28, 0x38fb2ebbe5e29070, 0xc3a97ea7cd6c2269, 0x6ca1fdf9cd7df517, 0xbccf7e710e195219, 0x1eead71bba80aa67, 0x3eb0680f6a2d81d4, 0x23d4f42923c9934a, 0xe4b8f68151044e3a, 0x6cdca99153138119, 0xcdb1fa368cac9eb8, 0x49526ad444783817
+, 0x2a8a7240c321aa1a, 0x7a29eee37ce5f78f, 0x88b5b1a5504e6368, 0x2dff34df20252d04, 0x3ab85b4b370045f5, 0x1d9a716f608bec6c, 0xbb5e609105d15276, 0x3a33c93021618290, 0x24e29ed67a26a1b1, 0x79ee5a374300bf59, 0xcae092bcbb4d348c, 0x3f719c44754a42bf
+, 0xb6ba7b1f976d5775, 0x1f11dd9cb298974c, 0x0ba064ec6c78b669, 0x6fe64f6346fbdabf, 0x32dd2a246be8f750, 0x1fd23784c29ba87e, 0x976d609176099b6b, 0x194c1ca800a5b195, 0xb787c4cfb0232ea0, 0x3f676f1c3eef8076, 0x2f96d6fbebf29b0e, 0x09943802a4db0ac4
+, 0x3378260e04dc22f7, 0x6ba66f4e8101ff27, 0x0ae6840bd9ab2b2f, 0x20d581ecfcab1602, 0xc402f648d67438ea, 0x764ba5e230663c71, 0x7dbac269e5f50831, 0x23c1a0449d54c747, 0x64f8d3055f550e24, 0x2a1aeebb340c4476, 0xb600ab0d294d6d17, 0x08a6fb6278ee8891
+, 0xe3512bba9e9a3530, 0x4fb07cd3a6423f8f, 0x72347cc3a63832b5, 0x73faf0f638e2f74c, 0x9507a60eea2032e7, 0x2b02a3cd58284d73, 0xab7340b82cab4f91, 0x150001bd035c07e6, 0xb825c8c09ab84356, 0x4e888f3080483cd3, 0xc4eb848d4315eb6f, 0x5f314cb8fd4729d9
+, 0x89d52898c3ddd371, 0x37ba43c93640e633, 0x8db03c2d939653d2, 0x59b76a3d84a22153, 0x6ba2959df76e1c1d, 0x1e3f0366f044868e, 0xc5946ef81ef241c7, 0x376a655c734d61d2, 0x5101a69fb7f39cba, 0x0f2c0135ae3fec3b, 0x9c6688268c21708f, 0x73a086ee7f669130
+, 0x18827284affbae45, 0x3c0e2907709ae432, 0xa7ecbd18657ea537, 0x7b44e81bb4fdbb49, 0xbc1507e681b4d6d9, 0x6cd06644f7e37425, 0xe9825f42ca4d692d, 0x0c698335cfc06ac8, 0x57894cb0dc6253dc, 0x467991ee0e1fca20, 0xd32bc1d962ac694e, 0x2c431ca0fbc28dc6
+, 0x7f35a97fb4bfb0e2, 0x593b5ca11858fb4d, 0xb56d209f252dad10, 0x7f5990eee92b96ac, 0x1e6e7c7cbec03099, 0x6ce48351f4726cbf, 0xbef882920e105ae6, 0x07b10a5cbc88685d, 0xa9a6fcf7cff4e4d5, 0x2084367add94c5a7, 0x769c829a5168daf1, 0x77de342ed751b0a4
+, 0x5162b31f33fe8897, 0x284a464d3946e97b, 0xb7bec662a921446f, 0x6957358f29406fe5, 0x11d81c8b9c08a5fb, 0x5b4c0b256fa28973, 0x84387e9ddd09c7e1, 0x7650fcfd382083c5, 0x9b0939c15f8842b1, 0x6fec4f04e7589384, 0x7305219db9bdbb89, 0x1112b536465278bc
+, 0xbac2872fb6f9b77d, 0x3d1faf0425a9d036, 0xa034ba8e0f753408, 0x6f32a2d8c690b174, 0xc2070ddf37d58010, 0x5bc4e8423d78a276, 0x59d20eb0131e7c22, 0x765739382e5bd9e6, 0x4bfa4e8250c46eaa, 0x21b12a3c43f64ac0, 0xe4bfe33181630352, 0x0d1f86b7f3eb72b8
+, 0xe075ed11ed823e2c, 0x51a580567c63cbbb, 0xd2ba447294496931, 0x2b598f83490ad647, 0x17ea11af5aaa0610, 0x2847f319be10dfe2, 0xc266347573ec4fef, 0x62f168d8cd486e29, 0x05c416d31c5e0f3b, 0x2fbd0f4158aa7d3f, 0x94c038affd930d8e, 0x270c40fb25386733
+, 0x277cdb24a9c175c1, 0x0e4355026d7f9a4a, 0x85dab4edded0acc0, 0x7af0fa0a18fd916a, 0xf7b2e53796a2eade, 0x4b9d4fd27be47180, 0x111b459aed6d49d1, 0x6ea34c485f094766, 0x1efbcdc1faffe007, 0x4ad6db3b90515ddd, 0x98a3e98dd7f6b430, 0x041a23c518bdd2f1
+, 0xafd0399244b6d49e, 0x0958472b5cd304d1, 0xaec120fe72037a0b, 0x599c30f8402a5087, 0xd1a5ec86e40ba99c, 0x794963a036fee048, 0xc24d9c3c240ba941, 0x2676e6872a63ac85, 0x2bc69b4a7e7f9e02, 0x271697a9f263ece7, 0xdc947c8c780a95bd, 0x7cae246e95d08406
+, 0x9602c6ab364a41bc, 0x478c94f7d954c394, 0x16c129537fd29df2, 0x6f075eb3b11c1f77, 0xf0d8deb489564d43, 0x7065d185c39f459c, 0x6335da2c28c39a1f, 0x4588e4492ba492a0, 0xb190dd65f1b93ec3, 0x7d975d515114618e, 0xaad6deb637dd3323, 0x1b03b1702ff677c3
+, 0x8d73343f8652bc6a, 0x4b37604737e174ce, 0x6d48f387cfff7cdf, 0x3072e615b3d2d1fd, 0x819b7534a6eea73f, 0x63754153fb0b82b4, 0xfc9a4ff41c7574d9, 0x0397bbabc4e6c383, 0xb6b9931998acaeb6, 0x3505cb387196dfaf, 0x1dd0be2e83588abb, 0x034f5d00135239dd
+, 0x9217a03d2e776075, 0x1c60d658cf52a5ea, 0xacaabdbd89e7fe67, 0x52b4d9fb97c02ee7, 0xe9c75389332c98bc, 0x62b721e6c1e26ee8, 0x4f5018d653645079, 0x0e4f5ed9da81671a, 0x7891996c22b6eeb2, 0x5d6f31cde65dec97, 0x92e84da9c7f40683, 0x689183fa67e7a34e
+, 0x5e4f8e925761441b, 0x706afd0d1403b317, 0xf1fb18f36e10820d, 0x2b0b29c364f5b596, 0x6f62a45ba8fe1d62, 0x6fb8ce929bca8f86, 0x75505f7f20f35270, 0x0f6f2ceae1895a26, 0x3560ce674a46b5cd, 0x690c306bec7876eb, 0x02594686e98566a6, 0x64bc8b7af7d10e61
+, 0xb6da53472d539032, 0x1bce062f0941b5e3, 0xc089b84dc9fd7613, 0x7e2a6ac05c2c5f1a, 0x2724683b158e38a5, 0x55e54da58127cd46, 0x32406787bf7809b7, 0x0b401e046ab2167f, 0xd83077e6685259c8, 0x7fc652ae3197e73b, 0x174e569145eb1fce, 0x41deb665b2691e6c
+, 0xbc7bb0698ea8aeb2, 0x2bd4983791771b48, 0x3035a12766a9427e, 0x59a96920584c4bf0, 0xe6363180ea4bad2d, 0x0fa5ddb29372b221, 0x35f78bb5a75c7114, 0x39c4a5895b09d5d4, 0x5739f3db49afe5a2, 0x17b866d694dd7842, 0x293b9aa872dd4844, 0x139509bb1069fee2
+, 0x2416047ae2e38a40, 0x14095c5baa427047, 0x33772dc42956d7ec, 0x4e4e4ad763b7f833, 0x38ec6720b8b23d58, 0x7826cf3947c53668, 0x10c3b6879e45ef03, 0x191d8948c91de3e3, 0x0f04a30f4371e0a8, 0x58a7dae75bc44089, 0x73b43a1b31ec72c2, 0x3d8e07e3bf3c371e
+, 0x0a3b45e9d8a57752, 0x7d7ec5d24e49bdc3, 0x0c69cbd61b041880, 0x6ebca63ad69e2332, 0x2a13219ad5a9894e, 0x0e59298c5ddfe998, 0x5a3652b23f45c8ec, 0x5b90cfa913092617, 0x533d35d9b2a13277, 0x1b11a844d1a7fc93, 0x22df2d4fc0da689a, 0x64cce30377f1e055
+, 0x64d7a96834268475, 0x24b5cbcf3cf4a7dd, 0xde62cb0be618906e, 0x52225399528f1f58, 0xc0720f319e29cb9a, 0x73055d443b8115a3, 0xac5c4c880203cccf, 0x3d7e3dea84527afa, 0xc4248d52bb537e05, 0x255c068ffbf34aaa, 0x7667a2e530ae7ec9, 0x5f3c46b2d7c4221d
+, 0x3783932c21e17e3a, 0x39f39e39334eece9, 0x1fa3fc87e0a88e30, 0x5a580349ee573bd3, 0xd9aede9105f3779f, 0x13d3323ff5dd3dc2, 0xd3df4827a5005f13, 0x7d950466620c0ce6, 0x9f2d469522b1e862, 0x160b24b63a45431f, 0x818f0259ea750167, 0x28c1c81500409665
+, 0x0cc51ceb9634d93e, 0x6ea4a411521402b8, 0xb109efd0facb5209, 0x0c5a607b6e2780e4, 0x7c48d728d73f6d1c, 0x03664a6bbd3997cb, 0x9c317256f8047e24, 0x281de9beacb11625, 0x676052ad8396650d, 0x5e31f4d805ab7ace, 0xc12d0fd19acd34c9, 0x63487ce9fd837ddd
+, 0x9f7f8d30cc48999a, 0x29e9f6b0b6e07983, 0x9b2a921cac678f6c, 0x4c624d7903745b5b, 0xe8af36d3eb1ee944, 0x3f9f9360398bb501, 0x61ad13d9e1a773cd, 0x4243e15c3c0603f8, 0x263b05986f876a95, 0x38411ec0a363b00d, 0x35f5bac15225540e, 0x5434cb431f6e852b
+, 0xa7406fb8b68c0319, 0x528c1bb60c16df34, 0xba7754eeb22972bc, 0x3c39c926982e1be2, 0x5deb61de67330c3b, 0x71edaee4003816c1, 0xa590b46403afd2f8, 0x735c663bb5277537, 0xb6b70e74ca5629d7, 0x3fe12382b9aecaa3, 0x47f145ac216d105c, 0x308c584dac6e3c12
+, 0x2847d354003a685b, 0x30773d3c6cf3f0ff, 0xe28ce7e95d8be52c, 0x10539ff891bc94f5, 0x9ecb1d3038e0c583, 0x3d4f6ebba76cb16e, 0xb323f1dab27dca74, 0x727c2b348336b40e, 0xf29c413a6a2d7d5d, 0x5adaae48cba3100f, 0x527a8bb56ca689ab, 0x36bbce6781cbb764
+, 0xe6dbaf2f35c8f80f, 0x11595df460206627, 0x174eae135b2d9ff0, 0x7a07023b9cd2573d, 0xc892160e08d9bdd6, 0x1612b91d26f72965, 0xbef137548806ef03, 0x0d7d769efe564096, 0x075e0a7459d94885, 0x481a2a53bc52a2ee, 0x56ece95545817213, 0x4dc42a81730dcb7f
+, 0x98ed86fbbc3cf05e, 0x627998394d9bdf59, 0xa900236b8c511b1b, 0x4f0f683b9c62c4b2, 0xbe39f251a0c0c0bf, 0x2a91212282102dac, 0xb8d5fa0e2577b28a, 0x3e7bf75edddefd14, 0x1ba71d8715c65eac, 0x5ceeec4dd28a1aea, 0xac50dbd1fc356f78, 0x3b61dac2d7df067d
+, 0x14af6515bd85e97f, 0x0117095e2b2f8534, 0x22028f52d51da8e3, 0x6e97de04b2ad3acb, 0xdcef663f08aebe0e, 0x4079f4f4bdc0b386, 0x91f0ebdbf55d3cd8, 0x4df96998c67d5638, 0x7d7af0d7f95d05d2, 0x395405da590c8b68, 0xcba0d00074204881, 0x29e88de8e0319e62
+, 0x082732a2c1dbfc5f, 0x1f11bb61c96ae966, 0x23720db02450585a, 0x6587db69a7b47dc7, 0xe927a1f8b8c1149c, 0x750c54269077803c, 0xb44d33b41397be99, 0x0225c9543af6778f, 0x4f3b9a6fefdec26c, 0x2d94d58ae98c56ac, 0xecee863cb536d876, 0x38338d02a8ebb014
+, 0xe40558b7d324c7e7, 0x0c780355f830771c, 0x06b4e548c7069daa, 0x65cc2f9ae66d5cf7, 0x616ec9850405dc6a, 0x390829388a7d4c9c, 0x64f503d77a1a722d, 0x7c8ce6a9d78afb80, 0x17799cdba6a08dc1, 0x6f8a0372bdee8fc2, 0xa05d787c1f33a55a, 0x6b40e5694a566fa0
+, 0x940677064912ebf4, 0x02e8737eef614938, 0xcc0ccb01d13d14cf, 0x662087b36ee3985c, 0xe8f9453818aadf0a, 0x25ebb0e403d26618, 0xc27f503c0a6ee523, 0x36bd10718de552d6, 0xf2123ff941fa3ad7, 0x050e5b2159e9fbfd, 0x5c75ba43a59faeaa, 0x31adf9fcc16a8b51
+, 0xb7b946348ee49871, 0x575ad939816825f9, 0x248c6e897cb88d71, 0x678f238688c39843, 0x45aef5ca4e1076eb, 0x4b31fdb5a5ea3635, 0x0cee9566064f9170, 0x4d0f221747e7ce6c, 0xa3d5941b00969da6, 0x3a949904e6bb6584, 0x7ee9fb468f64ec3e, 0x6d5517c37f4728b3
+, 0x795ead717a3f29db, 0x7ed536a28b1e1204, 0xbd7b470ca0c2954c, 0x5203de404a3873ae, 0x56dbc5cf021f639d, 0x671edccdc5555344, 0x93caa94e5437b171, 0x422e90985171c424, 0xe07e0ca30cf0607d, 0x78cb86480b65e780, 0xf80ef50a4676067a, 0x17bb2ea62a641eb9
+, 0x69906389f78174b0, 0x0274142403fbf078, 0x4f876141587ca83f, 0x0521582941fc5b3f, 0x08d3968c36a74422, 0x52344c16300a8582, 0xe34e050b430f9cef, 0x0792b338730c3108, 0xc6f8791d5d68a92f, 0x08b6c935f3938d79, 0x21e40d3540f194b0, 0x550590fcbec5fd8c
+, 0xf9806a100d86b6a7, 0x57d997c33a15b579, 0x3d9156ff46a6f86b, 0x3481d8d3cb9f5fe6, 0xc3f60828d3bfe288, 0x0dd0ad1ce53e61da, 0xc815702121dcd851, 0x61e9adb475285a5b, 0x8b5b31f6483aeb56, 0x3178338fd4e76000, 0x9b517ed32da88831, 0x4fcbee99098bc095
+, 0xd99fa50b9eb9733a, 0x31361c320dde8573, 0x18663872223d0f80, 0x1188bffaed7a3623, 0x3a63ad4d6d7377eb, 0x3eb8b7bde4d6732e, 0x7583b1a1ea6a5ece, 0x60b34a220659cdb7, 0xe47cfc06370b291a, 0x7a1ac6b179fc6900, 0x92e834b1d0430e22, 0x51b79ed685ee2c7a
+, 0x4fc7a17baaf4eb9e, 0x19d29fe8130ed1e3, 0x5c3d564a051392bf, 0x21910cded3c4ac93, 0x3e9496e9a69d2262, 0x1602cff148417407, 0xcab7f0da103da4c1, 0x769b1aaa08076394, 0x8effc5a973313d1a, 0x213092989506b725, 0xf5612b405b6c617a, 0x0e9da9b913a9cf6a
+, 0xb2573e46266119dd, 0x04cdc77a653e2520, 0x761ad47c5db87a5e, 0x42d7b4d3a008a25b, 0xac1a03a1bc93b987, 0x31b7d3fea93ef133, 0xdba95aaf4ec9da6e, 0x3c4dcde6243d0e82, 0x7ab51c21c3e49faf, 0x2f61adc404684966, 0xa8bc5bfeba06357e, 0x0a006abc36ef67bc
+, 0x6c797bd6f4eb8a1a, 0x0f82bea486858a08, 0xfda2d266d1e78c0a, 0x3dc334ae8be7f60a, 0x5362d768b2029cc9, 0x47a77c3909f595e4, 0xa0c08c33be5921dd, 0x02f1b2a1420b5b39, 0x6f5ce88876d1bce1, 0x1e85fee6d91345f2, 0xa98204eb3b13f6bf, 0x5aca66e13ee6ad54
+, 0xe618a225f3813279, 0x3b60e014f389afb7, 0x25aa4c7f054c7b59, 0x0315c6d712634c29, 0x47da2f2eee1c21bf, 0x5c699a6c17f71e70, 0x543feb4da241118d, 0x41120630f9098e79, 0x2683657f5981a875, 0x4fa5bf4b2cd7d7ba, 0xe14c6b8647e199fb, 0x5fbc21dcd6380b3c
+, 0xa5f1d1289cdb003d, 0x79ae3908ef5cfed6, 0x77755c633fa1d2de, 0x5ba0320fbcb7f2e0, 0x9b321b11153f64b8, 0x402bf35002585b26, 0x94258b8064ebf940, 0x17a384f16ce3208e, 0xdf8901d21acad5f9, 0x1933f69aec366bb9, 0xf59873dfb43f87bf, 0x29d11abd9a84d54b
+, 0x69223091f162a6b8, 0x182333141c53ef58, 0x04c175f73c8febcb, 0x153a816d47232066, 0x091c7f12b290baa3, 0x459076fc45ed9584, 0x113ed3e7a0e2c9a8, 0x77315b47d6683cf2, 0x05245045ca6e1741, 0x6b092bb93282efb2, 0xb82a632c74dcc4a7, 0x7e708cee58da3e44
+, 0xf229e5a4412afc5a, 0x57a6167b8ad944ad, 0x4192a61705e637f5, 0x548c0ab4679e8c3a, 0xe8cfbed708ff04d2, 0x53b75045bf9cdb0a, 0x7e4dc13cd985329c, 0x11e79e7c347c023f, 0xdae569c05f85d16b, 0x27353e5052d87874, 0x5274e9d2a3953386, 0x1527aa000cf33a94
+, 0x876c69966ff47be4, 0x5c1c18ff292ffc9b, 0x5db8776b8eba12e9, 0x77a34a445c24dd91, 0x7a5e4dd3b529f0d4, 0x254b415aa696f9d1, 0xb3e5b62ad87ae2d7, 0x11ee373cc1d8a6a0, 0x00a6ef1e15924a8d, 0x115a8ce0828186a1, 0xd1eb97a54d495142, 0x6a2fd1aa483d86fc
+, 0x0b346fdf783732f4, 0x2151bb20737cf75d, 0x70e73b4e9630aed1, 0x5f607a7e87961930, 0xfe5f866a023edfc2, 0x4a8a6837c77e727a, 0xc4337eed806fcbce, 0x01a245ff0da93910, 0x243ed9abc286100f, 0x5e4195817e67c5cc, 0xeb1f21429020b2dd, 0x5e0cf13e6bf765f1
+, 0xd44d0d8f95e9ba9f, 0x45d7e6e642032e0c, 0xf3530985bf2be8b5, 0x1b6b829e91b1caf5, 0xd15619f3e6e1aa35, 0x483b1190fb439b18, 0xb458434e83011fa6, 0x67ccadb21a5561c7, 0xef8afbb92d9b5c0c, 0x396facf78300f96a, 0x9b1ed1b3d3839e94, 0x7604320313719d86
+, 0x7a3709e107890d28, 0x22a450894f13f38b, 0x2cfb37a12c09e0e1, 0x33120cfafea4745f, 0xac49e22877f406a2, 0x7b40f410ec983664, 0xe24f06838fa4a6a3, 0x38d6285a321844b7, 0x9d1862f79c495060, 0x6458d74e783ab1aa, 0xf754b0e5e59863ee, 0x136dec1da38212b8
+, 0x7e5f6744fad7e3a7, 0x030b1284eefa642b, 0x09b0031f02c3bf53, 0x528071ecc98d2152, 0x97cefcc78f977834, 0x12f3a6aaff0e6975, 0x95e858aa61d3f3f9, 0x3165726106724bb7, 0xb92ccda068fcf0bf, 0x1e1343bb7c82a523, 0x82d3805ab69d91c1, 0x70c39d9395502b2e
+, 0x8b450639a726066b, 0x58372cfb17a9ffd5, 0xd552de26bc21e028, 0x4a7d053c0a0c5780, 0xc559dccfe118071f, 0x59f65cf27d8d34e1, 0xa474f06608bd833f, 0x179b5425187918d7, 0x421222170af3b130, 0x6e324fbfd4ac5222, 0xed508e6f70f4a5b5, 0x6153db12bd018e42
+, 0x715fcd0e983add02, 0x14dbce4b8e3ea527, 0x8f324a916ddbfd8a, 0x55c4c84a2c9cd0c6, 0xd9b5e7a07b67f79f, 0x1e4e6c62f03dc529, 0x3c6c79c5567aa9d1, 0x4f96fbc7a9569dd7, 0xa6d902b98f32b475, 0x3168d1c0f42dc8c2, 0x6140fd8d6ed355f6, 0x7b9f86c6a7357aee
+, 0x826daabbac00f247, 0x5f61766ad12eb34c, 0x48e3945941002284, 0x76a00dbaacbfb434, 0x36f3879710519d73, 0x63aec40038005e7f, 0x4430c37b38cf8ff9, 0x658b606b1acc9e64, 0x0a1a55593fe28b14, 0x4ed886cd66f3ee23, 0x4e51a757258fbfa0, 0x65c188a8423a1eec
+, 0xfcc436861af6903d, 0x0e0b26c8468820fb, 0xb48861841afe1884, 0x26dfe61ccf3220e4, 0x27fc65a04be2841d, 0x294ac5e6bc748f24, 0x2a322c9e79259a8c, 0x5b01bd6dcc35a195, 0x282b3f4e31eac84e, 0x3090fa704824ca90, 0x7ac64501dc5a080d, 0x5cefcf81171b401e
+, 0x625a65d96c72ff78, 0x3fc71f2d2a32fe12, 0x6957ab283fe269ac, 0x66888ad7c4d6eed3, 0x91929a6adf0c2c7b, 0x4db7373fc0dbf8e8, 0x57356fcf1e696013, 0x07f29d05a65c1030, 0x1b13792456cc131a, 0x600682172b2e8ea4, 0x4116bbac2c936543, 0x5b0842a8a1bc471a
+, 0xd9c6f771be6612d6, 0x3207efd618a55023, 0x2a96b31de9d0f763, 0x3816b7b9281cc308, 0x2ac1c03608d611f9, 0x6f34796f22722a23, 0x0484f875d1128b51, 0x1175cf5dfa621db6, 0x9d0a2abce6d04a42, 0x3afa248c018a87a6, 0x000b64fadec5b7b2, 0x38e31d2993648604
+, 0xacf2127f51f23393, 0x6e6dbf9332febac2, 0x9b9472547ffe87a0, 0x7b74c586bc94c5f4, 0x24f7ee239d152740, 0x5ef160eaa83a2141, 0xa5fe9d99a79db135, 0x7a9a0463640086c8, 0xf52a053c08ba2de3, 0x7066e8b864aec1b8, 0xc9c7a5f4e0caaa9c, 0x2c2df8ef6ac1888d
+, 0x74ccfd8d272097f9, 0x3cc27cae9949711f, 0x52d6f513a571eeb9, 0x2d4c2ab0a7e59570, 0xed5d0fef4526b0a7, 0x123b6c3d7f834d7e, 0x2224f10f49b979bc, 0x7cc1a4088070e13b, 0x0f0bc7ef6db0483e, 0x13221a2c7dddbc85, 0x34f68b30949267e5, 0x783d05a0c2f37d93
+, 0x3fd6bbb57a6ea3c0, 0x6a1f3e17397452ef, 0x20a4c624a0e6ef69, 0x5cdaa49be35bf1e4, 0x28f5592e87925252, 0x59c5b5ceb55a2640, 0xcbe49ed1566253bf, 0x28c93be0e482433a, 0x654e27b89e1c3ce7, 0x269af4daa37b0345, 0xe668c4920a5146cf, 0x49ec769c74b7ec21
+, 0x789d75d184251418, 0x3d70719dd8856f54, 0x9ec8549c9d400de6, 0x45409dbb25400f07, 0xb44f219be66ee78f, 0x07705d9cfd3823ce, 0x624cf564d7a49b84, 0x06c6ba439d2fde5a, 0xae15b2b791f5533d, 0x66d3a3ee1768e052, 0x7605cfaf6c66e320, 0x5d478842ef3b8598
+, 0x2ffcc144ff285d09, 0x40f269172b4167ad, 0x3d0ecb4da838aa81, 0x642d53f395d82b98, 0x941c167feb5aaf41, 0x2ed89dda42b06cc1, 0xc544d74ff978cd52, 0x02e98dd36ae7199d, 0xa9fc56944d83e4b4, 0x55b3c78ddff23f6e, 0x994247515005b93f, 0x7f091216b3d535ba
+, 0x5f4221415a19c280, 0x26afb8f61a3ef4f8, 0x825b5a7751dd5026, 0x559b6389550029fe, 0x82767e5a59aa7ee0, 0x1389b1d78112f749, 0xa1bfa350776cb615, 0x097314fb73a85c6e, 0xd79017e2320a4936, 0x799ff31b8c0519fc, 0x5492397a1743a309, 0x25cbca12f9e684f1
+, 0x0e5e58af3c7ff10f, 0x2cd9860e057ef828, 0x87e978ce46d3ab4e, 0x522a913d9b20b327, 0x0f1d9ffc51379847, 0x7aadf84e7489b6d9, 0xa3882812da0e6f57, 0x46c4a66aedd7a4a0, 0xab3180cae38b5b90, 0x0967c690d68a0dce, 0xec92a43e7946be40, 0x0411e3c67316ad96
+, 0xe882f75bd68511ee, 0x134a4f4768d9e818, 0xe4531b8049ba457c, 0x49b0fdc2b13a4e3e, 0x066af71811620ec7, 0x3011d0fd23321e4c, 0xe5ca35e88f52ee55, 0x42c9d2dea0483bc4, 0x359a0f2f3e885361, 0x55295a4c95dcdc14, 0xcab141fc3c7c9929, 0x42526e3dd3e2e6cb
+, 0xd4d2cecd7621920e, 0x49e08923e0c16b18, 0xc189f5f560aca90b, 0x31a68f4846faf01f, 0xf5aca90725dca5f0, 0x729f7cc4cec8e6e1, 0xa8f2280c92b53f95, 0x3065e0f6d8c35ed1, 0xda7a3860d0987f10, 0x70ac4fe5b86ab3d8, 0xa74a2926b764b8a4, 0x03575f4693ac1ef0
+, 0x1d7899a2e2a53028, 0x1f0d762f0ea50546, 0x3f9cfe18acf2447a, 0x70c89e12860870f1, 0x93357423bbaafa0e, 0x2b47f814f882500b, 0xd369e3cf26afe608, 0x78f87ef1106c61ce, 0x0174e7a784d0307e, 0x2d79d15bf0641b2b, 0x29fd87651b3b8db8, 0x581b722851666133
+, 0x294d1612edf4a4ad, 0x7ed8fd03bdab1f7d, 0xc93679c435bf8e75, 0x0804cda86dfa539e, 0x836447bee4385995, 0x25c48a84f54c2abd, 0x744bf0236e6b87f9, 0x09851985154fa102, 0xb9be495a5a1d97e3, 0x23062280f7159a00, 0x43e035ffb88b890b, 0x26bc0c2dfa415202
+, 0xaf2abbe93086984a, 0x7368885f66a788a5, 0x2560b9c57c29b812, 0x518e734a6a83a238, 0xf20076e8391eb753, 0x42a8e9ecab450ea1, 0x817ea05d27fb320a, 0x4d6b127a91bfc453, 0x0c72cceed0f77830, 0x5d377ead8d3afcbd, 0xb3e3cbfb01da28e7, 0x34ad237aaf2e0332
+, 0x6c8309336c4b79a6, 0x1eb14c41c085b365, 0xfcf303b455615a3a, 0x4543a4ea24910748, 0x19ec99cc233c9520, 0x2e4eeabe5e7d6a03, 0xef44181724042bd5, 0x3f594e7b127065e1, 0x6984981c42c2b311, 0x1cae8e612ae131ea, 0x0c837ab7500e0761, 0x78dcd3b2f537bdcf
+, 0x70b9a5edf18d066e, 0x6ad3fff19b14bc93, 0x46c4d27bb874be18, 0x5fe7cf78340b351e, 0xee633903a1cd9b03, 0x761b23a144609b0a, 0xcde8e3607af3e1f2, 0x341ede1b88b4ecff, 0x5a11c9b11a18a4df, 0x5f4d2d0db2fe615a, 0x17c8bb1006d2df6e, 0x628f742363f3e506 };
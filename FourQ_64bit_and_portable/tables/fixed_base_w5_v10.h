@@ -0,0 +1,173 @@
+/***********************************************************************************
+* FourQlib: a high-performance crypto library based on the elliptic curve FourQ
+*
+*    Copyright (c) Microsoft Corporation. All rights reserved.
+*
+* Abstract: precomputed table for fixed-base scalar multiplication with W_FIXEDBASE = 5 and V_FIXEDBASE = 10
+************************************************************************************/
+
+// The table below was generated by table_gen using window width W = 5 and table parameter V = 10 (see http://eprint.iacr.org/2013/158). 
+// Number of point entries = 10 * 2^4 = 160 points, where each point (x,y) is represented using coordinates (x+y,y-x,2*d*t).
+// Table size = 160 * 3 * 256 = 15KB
+
+static const uint64_t FIXED_BASE_TABLE[1920] = {
+  0xe18a34f3a703e631, 0x287460bf1d502b5f, 0xe02e62f7e4f90353, 0x0c3ba0378b86acde, 0x90bf0f98b0937edc, 0x740b7c7824f0c555, 0xb321239123a01366, 0x4ffcf5b93a9557a5, 0x297afccbabda42bb, 0x5948d137556c97c6, 0xa8189a393330684c, 0x0caf2b720a341f27
+, 0x3a8ba018fd188787, 0x5546128188dd12a8, 0xb0b3cc33c09f9b77, 0x1baeeaf8b84d2049, 0x006425a611faf900, 0x18f7cd12e1a6f789, 0x6dccf09a12556066, 0x448e05eeace7b6eb, 0xbf2f33689d2829b0, 0x6d911dcb2957bdb4, 0x9f2353dbdc3c03ee, 0x06c54305babee501
+, 0x2eaf45713dafa125, 0x72963058648a364d, 0x61b7771f9d313ef2, 0x4f41c7f8bfe2b069, 0x408623ae599790ac, 0x4d33858644330a42, 0xfc5696649cdd7487, 0x74df72e0e598e114, 0xc9a06325913c110b, 0x076bd4115fe4b0d8, 0x76619e65d6bff3d9, 0x249240147cee3a08
+, 0xd695b96148965a73, 0x28aac8a28829f706, 0x41f1c05329f7a57b, 0x441ca9e89f03e00e, 0xe1aa38ab8bf7241e, 0x58f28cafc832b7f4, 0xcadaf8b8fa5400c6, 0x34b6d106284e863e, 0xf5498cab3af15097, 0x6dbe7790017d9c49, 0x63bf76a81448e8bc, 0x6371925bf23ae006
+, 0xc5e2c721bded81fa, 0x4ede70eed68056ab, 0x8f3cd9b5b4975810, 0x4752fd192f0a9aa8, 0x318794eb1f734414, 0x11ddf7d2c8468662, 0x2613b06f72b1a34e, 0x465575b37ab06770, 0x40b9845f82638d2b, 0x48894050790298ce, 0xbedb93a501b4f131, 0x04f3560d2889b2fb
+, 0x457dd875115b278b, 0x56f25ee54d92858a, 0x92d4c1cdce0c977e, 0x078fca4187d74996, 0x3bbb2ded76cc22a1, 0x117b28853ddc2bf6, 0x43f3767cb9c2baa2, 0x73079e25e0ea8a8f, 0x0177992b5a15796d, 0x2e77721480d9ef92, 0xbe09883567372916, 0x258f176b7af7576d
+, 0x308338fd6168391b, 0x7285925f9a7353a4, 0x862c0fd04fe85114, 0x53259ee7423aeb51, 0xfe0031a84b3b1a68, 0x1a4f1d661fa071fc, 0x2ddd54168dc928a7, 0x60185c1adf196a6a, 0x49809717dc6da9b4, 0x6062094b4dcffc03, 0xa41ea6fa05fa7e8d, 0x4a4fe06f277148a0
+, 0x7bb253a9ee9e80f0, 0x419a928bccb11733, 0x84323be66a9a039e, 0x01b2d1ae972814bb, 0xa7588584d3051231, 0x54df1e20cc979dd7, 0x91d906fe3e2f22dd, 0x4e36e9975fdf1a0f, 0xd81871746b747634, 0x3e5e31baeee13433, 0xe4da80979573baa3, 0x4b852ad97cfe77c6
+, 0xe08b346714418b9e, 0x283d719b2fe6ef88, 0xb7339d2de45c180b, 0x75acfcef11d2d5c8, 0x8f40777a8c561876, 0x0c54ac40a7134c4b, 0xb92e287d66baee08, 0x6f357e5006a188bf, 0xc5903319ed1e6971, 0x747c45ef91dafd40, 0xde4086a91d2f816e, 0x5dcb27edb3b3ef7d
+, 0x43fdc46cfa1dd2ee, 0x51551f9f70966498, 0xb54534f761ed9bdc, 0x453455b3073fb07f, 0xf24773e383cab70b, 0x679be25e758cf4df, 0xda17edf2943eee29, 0x3dc9e5b8d6dc0f66, 0x56a50cba413fb75b, 0x1e65315bc5a8537f, 0x5ff90242802c7213, 0x73c9d8c8f425252e
+, 0x3c637b8633198c8f, 0x534f84b3ed414f33, 0xad313e72dedd6902, 0x5ed57e941cdf33af, 0x5a6fe01d2a57306e, 0x73b63dea344713f9, 0x39cb70570f1c2bf3, 0x2df8c6e49f1a18db, 0x661bc349677797e4, 0x501ae7cbbebe9062, 0x5b52a88de8959643, 0x0372752811c01d51
+, 0x010c57a2301bb928, 0x378b317155554fc6, 0xf883fa4229a02cf1, 0x5f0047b850d7db29, 0x4d247ae328402daa, 0x0d030627a850a2bc, 0xb4e65d9a88a443f5, 0x6ec9686b2d6db089, 0xde202e08fea1d987, 0x5c64e1d3f28d7600, 0x157d17bef661bfb7, 0x56392d36dd75334c
+, 0xe25478d8bd19155c, 0x146d4f2d3d336afd, 0x9bfbe00bf94e15e8, 0x2b185a9a6adf10c0, 0x926527b3ed52ab7b, 0x67997e1473101e80, 0xb58f4ff4947cc541, 0x36f800c7fac99a7a, 0xd0302e32400456d9, 0x4372e43640bc697b, 0x9144cabb4750d898, 0x75d25afac9a23cbf
+, 0x794591767655cbfe, 0x74db216617fc4b07, 0x7057b2242566d0c9, 0x1d543b5908417b23, 0x19c280b444428783, 0x352309fd8b6cc3ef, 0x37833d6ac068ae72, 0x4ec0671a23c019f4, 0x9d9836e1a3d05bb5, 0x44fe1adff224efe3, 0xa296bc3ce57efb4a, 0x2efec86835a14150
+, 0x2fe19c09fb194bca, 0x18cc07d3953cd206, 0x5bdff217c9c0b9e0, 0x671aa756581abcee, 0xe1cc33ae28f7d1a2, 0x1b6f254937a0a3fe, 0x51503d1665babb83, 0x74b95636d5889211, 0xbdb97ae4ea96f869, 0x1507ce189e2510bd, 0x796e4d54fab93b13, 0x6a81765f05960929
+, 0x2e940521e5a833ed, 0x3bdea532b245f644, 0xbea76975ffd52693, 0x64b94848ba6d4ed6, 0x9db52d0194e33ec7, 0x71cf65da55639f25, 0xede73b1fdb5a8138, 0x12e4d13b6c62dc22, 0x9d19b0c265185517, 0x77a011d257b5fdd0, 0x1fedc5caaecd84e4, 0x46844e151e3492d1
+, 0x2098c5106b790115, 0x5a15c333544a89ce, 0xebc775ff593429b5, 0x04ea7672874901ed, 0xb5b1ddd0d772088c, 0x2f07cc57d9f584a5, 0x1f3821bb7cc1e90f, 0x6c42acb2dacf12f6, 0x1c44ed69575dac6c, 0x680e5dbc047f27e6, 0xa66ef32555aed717, 0x729e666dcbcabb04
+, 0x2280c16f887d5a65, 0x44f0240616459ad1, 0xc23891fd97d4c0ec, 0x5d64a84743172bea, 0x25feec40e46662f0, 0x327d57bbffdb93bd, 0x90ae01c2333774a0, 0x7ed5dda7cce457bd, 0x3203b1e8a01123e7, 0x30d0f8360f2919a1, 0xd83fd3fa2aae56c4, 0x04a81edc4b6759ad
+, 0x6f25229f886e97f2, 0x38caab6b64269f54, 0xb8a12e0d8630c288, 0x120f986471b7a7d0, 0x442c29d3dd85b0e9, 0x6d36b59d0b0287a7, 0x73a68052cbde1bbf, 0x3689353e19dad66c, 0x85306decebd7b70d, 0x35ff7c5c8b5822de, 0xd03863b4242343df, 0x2527183804526e2f
+, 0x30fc0f342839234a, 0x14cc91c0352e5a3d, 0x1472d9daf31586f5, 0x291d6f1def468c27, 0x35616dd866f8cf72, 0x2cd7a8cc3a4f2462, 0x8fa99edf8ca0393d, 0x2a1827de4b9d7cc1, 0x1288b436d14095cb, 0x2b014332e172466a, 0x45fd28566b1ec574, 0x52011e70b3a93560
+, 0x6179bbec277adba8, 0x53b4ceb1c336b627, 0xbad8fb4a0c3acc6c, 0x0abba513cfce4b42, 0xedf9476431c8a33c, 0x1dfb6b10fa4a8b47, 0x46c853aee8ebe1e2, 0x435d63253d5af0fb, 0x7c89dd3705725f03, 0x41d641071bd827c6, 0xd41824a7943210c7, 0x04193681ef7225b2
+, 0x97ce52d19aecd90b, 0x10f143209dd10b5a, 0x4740cb780142194f, 0x10291a9c8b5e8332, 0xca3fa44bfcca3a94, 0x367c1ad1e3af6245, 0xd3a10e1873cf9487, 0x27e7ba7fc8e94820, 0x57659476f2137021, 0x10cf15b50b37ff0c, 0xb6e84465788ae5ec, 0x291fb6a313b70f5a
+, 0x06ccc8c1ec362067, 0x176e7a8dd392d321, 0x57946537088ad423, 0x47cd1bd34585ffa1, 0x5d785adecdab018e, 0x5d60a69419eaf671, 0x414866ea2de1cda9, 0x2490dd5f8bf898dc, 0x1e07fdcb590ed31e, 0x54b0da9a9b752d05, 0xba2c0f61612c1bfe, 0x55b6714a0e2b63d9
+, 0x1c41ed1eaffeff71, 0x659adfad4c4c34cd, 0xd786506b21b9f04f, 0x00237c2ae4e165ec, 0x42e95b7f34f0f048, 0x0357497e490ee153, 0xfdc33833181b846b, 0x505f5afce0e4d0bf, 0x2caf022af4cf5246, 0x22d31699a8137920, 0xbe5c6696a363aae4, 0x2b1fd627aa9467aa
+, 0x29755226b1e78a94, 0x72271944e2bc45b4, 0x55c519ed0b83bf8d, 0x761745bb518aed99, 0x70fc9ee160766eaf, 0x72126c91b1734a6f, 0xc71ce37c7b9d319c, 0x4334f12cc4813173, 0xa789370d92063b97, 0x4061d66a40891203, 0x4577f66c6bfa829a, 0x1905e5d3e0d934c7
+, 0xb8066356dc8dc7f0, 0x515e2327dc92377e, 0x629910d008eebae1, 0x220c200696351479, 0x74eab0d040224313, 0x24fff43429f36f4c, 0x1fc5011230435111, 0x755b38602e33a9a7, 0xee77db2e31151bbe, 0x4993711e46e096b4, 0xdb56738e0eb53d9d, 0x45ded4d273e9d133
+, 0xbb768bcd8d29e3e6, 0x29354288f82d1064, 0x4b10ddbb95af80e1, 0x252d1f367160d0c2, 0x3ab09286342932d0, 0x10fa640674866f03, 0xdddede35aa4c42d9, 0x6ceddcd87c028c71, 0xd77d73f7603905e4, 0x1a8114d2082b50b1, 0x2a2ae9a8b5d1846a, 0x12322f12e78d6719
+, 0x21e2c4ecce524eee, 0x3909bab429b57878, 0x3a12d4614ea8232e, 0x23fddc66f44a53ba, 0xa11cddfaa681489a, 0x03ccbbb515812f25, 0xb0f1565509660197, 0x64d2a7476b293536, 0xc20b09c5afa5e17a, 0x1bc565c78ff09305, 0x76ca5b8139e4cd7b, 0x106f35fd4cb906ca
+, 0x2028ebabfafb0981, 0x3e61a1f3ab786ce7, 0x550b6e2f17cfaaa1, 0x1f8f9202701bc15b, 0x1be87803bb917950, 0x43d35b97ccf8dfd4, 0x9e39d49d44fd2350, 0x10d40d0ea6a00f90, 0xed5c58cd142d4327, 0x15eec701672aea29, 0xef5dc3d8b2ec6bcd, 0x1cdca2328f5f8842
+, 0x6f0e98ab1fb5d006, 0x4a821594e3bd4163, 0xb0c920c729925a23, 0x5a2d5eb306844f14, 0x7a57519ca1e4770b, 0x4c59dfd4f3c90663, 0x1ea8af344633d796, 0x016ec042d9921dca, 0x9ddad895209d4c12, 0x3a62b6a5222865aa, 0x3309422ea64e461f, 0x2be0fc2631d42387
+, 0xcd9d9da6fb9174fe, 0x54ce833eb41204f9, 0x394cd85153c2db94, 0x65f551c5d7de83dc, 0xdacd48c85ac79c84, 0x2a1f41736f776a7d, 0x3cbcc7d3bd63edf9, 0x672303e567604859, 0xd4ebb045c7fd59e2, 0x394e949c5979b064, 0xacaefd01f5021c2c, 0x6419dcf8e3f24856
+, 0x1b83c92179c2dd09, 0x3ac4dac46194ee41, 0xf3bdefdc77eacaa7, 0x502322aafbf83e3a, 0x507b65e66e909ed6, 0x4b45d6e612f0141a, 0x26f7d7d6803bbf14, 0x73fadd97932323df, 0xd7074340216d1d8f, 0x6b59b758d1e626fc, 0xda47e4906a87ae4f, 0x55f6b17e050aeba6
+, 0x7a423a31904220df, 0x5b3165c747e8f099, 0x1c665eeadf35e22e, 0x7802b556fc45595b, 0x85a2def4015bd2de, 0x17f2ab87957166ad, 0x19cf6d352060c1e5, 0x122a7ad1be408e6a, 0x5b79bbc8645bf766, 0x20fb009d4d0adacf, 0x97526a272ba28538, 0x7041b4e90d420bde
+, 0x3b30113358dab057, 0x3d398b66f0d24243, 0x91a5999a03cd4708, 0x1eae2409cd938096, 0x66dd6b604c36108c, 0x1713083789081968, 0x57cad6917125dcfd, 0x34b06cb89704f1ca, 0xdcafe8e71f35abf2, 0x698331198d544db9, 0x6287676643af075b, 0x200950e5559d2b6d
+, 0xd4f63fc3ecdd9074, 0x7473317142ac13a2, 0x96b0030805319356, 0x2c20ffe0244378ba, 0x4889511ad26ac01a, 0x4ee327219997fcf6, 0x15ffe6e70f0bf8ea, 0x6b617fb4a6d0a6d7, 0x4916dca1c52f7324, 0x3c8269f086468277, 0xc24210c4c837e04b, 0x4e480b4f915a542c
+, 0xc5fef3b09a7fe35e, 0x31a501de44fd84b2, 0x79f29e4940a407b9, 0x0ba7e03ca5cce5ab, 0xa7a8b2058a74d8ea, 0x46f4c7810e26dadc, 0x46171ace94a1128a, 0x44db55025495a811, 0x7f889e1a4bf18d5c, 0x4d4f172a43f306b2, 0x33a99766bb1cffad, 0x6254775924d39aca
+, 0xd855230ec225136e, 0x1c544dd078d9211d, 0x12fe9969f63f63ba, 0x069af1dc949dd382, 0x305bcf40cfe5c256, 0x63ae90924bbbb595, 0xe451097793b7de06, 0x09780cf39fc0043e, 0x827af8e7eb798871, 0x3ace8a6c77577a37, 0x79df061332e055ba, 0x561dc07aaacea92b
+, 0x7e4422d9820d2673, 0x6b85df83e0af5348, 0x1f151ac1ded8526b, 0x35ead8e5157142bd, 0x6da6ef6c33c79dd4, 0x5f2ea04d2594fde4, 0x91037d0cc027d5fa, 0x53b5401007b0331b, 0x810f198a3d4ba5a3, 0x4463bd259ba94195, 0x32b894acec2acf9e, 0x78711761d64349ce
+, 0x253ae1b3f51fe211, 0x409e4b3f535b6463, 0x3a236d10da5e49de, 0x19d2b1029c21336a, 0x2835f40436aadd90, 0x0942a31505190b19, 0xc189131876828279, 0x3afe96c3ca8e1f9c, 0x9f1801b491230693, 0x39e28db8625fd091, 0x9fab50355dd44c8e, 0x145155da729b280d
+, 0xd3ccf8101d4d76d5, 0x5a0faa1a8c2b6c68, 0x3cc66c84cb54ea8a, 0x51052ce3f566c773, 0x3bee14de65ae9ff5, 0x7586118a01ccf024, 0x089e791c896bf15e, 0x35ff022d261d93d6, 0xcd3ce13d8f7d1cf9, 0x4f1de98f95b7b8f6, 0x51e68a2462dc41b4, 0x61ad9e3c23f6dd29
+, 0x584fea6480ebdb51, 0x5d52fe073f9decf3, 0x9afe483eadf336d5, 0x1dfa03c980b1696a, 0x55f73d47ff819a19, 0x697bf55d361100ed, 0xded4804446399419, 0x618c94467fce259f, 0xf2597ff1f08ef50c, 0x07c935b98dd933c0, 0xbb758cbc78ded5f6, 0x1e9a0d06af13148f
+, 0x879ce1457f4cd4db, 0x28396ca1962d4994, 0xf5095a3dc57605c3, 0x1e570f3da4c527b1, 0x2af69a3904935787, 0x591ee376fdd01cce, 0xf77b58df88bc8633, 0x5464d651b2f395d1, 0xafbc096b1e9a86ae, 0x6ce2df4bf65b6b28, 0x3b3a828d2e9d3e08, 0x6382011d8d2d66d0
+, 0x94987ca64d3d193d, 0x50ddf70d3b6d56af, 0x8d5df67cc8ad15a9, 0x39208098bc5b1f92, 0xce99f520dfd5a4fb, 0x323bbc87b86a7ba9, 0xe13f88a8d803c789, 0x56ffdcbdf2200055, 0x3aff0da31b24c72d, 0x70011566460c0c16, 0x76f7b7f53ac46a13, 0x1c069bfeb7077bc2
+, 0x8f47193ca14a3c36, 0x6d73e34af088de3d, 0x634b2bd9317d6634, 0x5b404738b77f1ec8, 0xf34fabb71ca1cb1d, 0x054abbcaca546a46, 0xe8cdcadd08eda660, 0x6971abbf958bdef1, 0x41338557dddb4eaf, 0x1e158585b079b67c, 0xd2270474cfa26068, 0x53b36d32b3cea469
+, 0x011523c16c543d08, 0x4668e92c5f73314e, 0xbaef3ebe4117acd1, 0x04037d1aa713931a, 0x68e118e4e390c68d, 0x6b80cd55a44c1575, 0x7307ea8a5729c032, 0x5cc5475feee99ab2, 0x34450e424c14ac75, 0x3f09157e5db3dcd8, 0x62ce2b1b50588052, 0x27a899c54e652f8f
+, 0x0acd039f2fc2a5ed, 0x4b4044ddd5813eec, 0xc04d189e90a75958, 0x242551bce71d33a1, 0xd95af96b51f87f05, 0x02988820f809d815, 0xb27f65f73b9483c5, 0x2ef60745f4364b43, 0xcb66bdc93f4fb8b9, 0x2b86c9b48756bb8a, 0xf8ebdae09b9867a1, 0x441e70184e6fe9aa
+, 0xfdc2530330cc1289, 0x47d8d65a8b4d6992, 0x8c03b6fa30ae74be, 0x1ca8693cc3bd99d5, 0x699eb1511018f2a6, 0x3da04764d9f4fff5, 0x361720433d3aab59, 0x2fa911612cb857ff, 0xa4057da10c2f1cac, 0x48a219b933a5c619, 0x42341020d15f0bc5, 0x73f8895046a09dad
+, 0x1bad5312c67421b8, 0x4194771b368e622e, 0x8cc71a79e44e0dff, 0x4b4564e45467f1c2, 0x7759f16aafe52093, 0x391b71dcd75fbea9, 0x2a1c0694ab4ef798, 0x023087545444130d, 0x4b7ae1ffcfaa1aa1, 0x64e26f32d73361e7, 0x8da47038bd0b54b9, 0x148cfa6feaecee15
+, 0xb4bbc1e694e88f1c, 0x57751ec2ac2cdce3, 0x2cedcf15576f91cf, 0x2f33ee82694c4aa9, 0x65bf3fbd4f1307ab, 0x5ce66f740b18095b, 0xf8214c4becb26ccc, 0x44ae04784d7cf68f, 0x55a5c542063d25c1, 0x4246e2ae0f9d4a86, 0xa6e92121ef5bed36, 0x36b7222adee8562c
+, 0x7a1e66b856aeb79c, 0x2a20704b41ac9c67, 0x23b6820395ee012c, 0x3fd376917253aff9, 0xbf111069b1ecbc29, 0x7cba928846b01f8a, 0x3ac63a6fd5e07400, 0x702c9e5184ce75b0, 0x5626fb9167478eba, 0x5e434941351656b5, 0xcd1afbb89c92284a, 0x13ebcb9f328ec3d7
+, 0xbfceb08f0423f8af, 0x1aee6cda6eab7c92, 0x88c3dd1d1fd860d4, 0x74dd6a229297377c, 0x194a20ddd3a5442d, 0x369e5f6b28e3920d, 0x60977ba567b0af73, 0x6faba8e701d66383, 0x5af0e644d32a6a6f, 0x2beb9bd6fe3843d5, 0xc6d62fd6e4d1c84d, 0x731ceebce92a35ae
+, 0xc49618cead53fa24, 0x0ab0c36d9f201536, 0x7d762c9f350b1a5c, 0x640393b0719ab0ab, 0xeeb2dd0a58df2107, 0x37f30f495f519626, 0x803cebd07de40bf7, 0x1e075683231c5652, 0xc7a3cffd67d6b919, 0x3bc98113c7f69a8a, 0xfe1b149587032538, 0x0b2dfe51d0d547f8
+, 0x6d71809b20230a0f, 0x64ec983a72308579, 0x8a8dc7698c54eedb, 0x1f7642df973b9572, 0xc1633a5a77a23465, 0x6149869405a579d7, 0x53cf854660705b6e, 0x03595f9b2cbee4ab, 0x32a702b1314c3ec6, 0x057786ecd02b2384, 0xdeb4d1e480bf201d, 0x0d54e7d9852ea170
+, 0x9fbdd6e5de478c42, 0x409bd9cfa48c21c1, 0x88a0a96295363725, 0x03acde4d8f813000, 0x015296ffbad694b2, 0x564be0c6d63c658c, 0x9b863ba026b58387, 0x4770fae57c48c395, 0xe4606533714401a5, 0x0ee6c888695b50b2, 0xde1157b8bbd7f9fb, 0x76b0c60cb8767729
+, 0xa328713c76f8da25, 0x64dbaadc1ba74341, 0xed72e3966f9d15f0, 0x25ff39b641c8d0f7, 0xeaeeea0b7e32f143, 0x1970b674074893ed, 0xcca2543466d51a08, 0x2fde30a3586992be, 0x7116c63e658a7a21, 0x2969e98355e1c6e8, 0x12297c5aa7551b3f, 0x09f88559ec48610b
+, 0xc61b0be2dd0bb290, 0x099576e7e3e345e0, 0x61b5343d9776d617, 0x76c8d512509c9968, 0xd26d8f9c2e8f29bb, 0x402c01a5b3ec8b7b, 0x60cc112e2e2bce56, 0x43afcef1c82d2861, 0x7f53160bb5d7cf15, 0x39b5301c62e67a0f, 0x2ecef134c10e0476, 0x51045307c6662884
+, 0xdf8c7c0918ab2cd6, 0x14fff369e8e66ba0, 0x2e1eee5f718e7048, 0x1d9b51a0ad28c3d0, 0xdbd4c78404304e1a, 0x1e2445fc12a0d668, 0x6891de8a56dc4c6f, 0x3406cabd7aadb9d2, 0xca29d02fd9270aaa, 0x093245b0a0463b43, 0xdc121a424e5288f8, 0x35859da7a81ece42
+, 0xea0837b290c155e1, 0x2ce834ffc893c239, 0x01d01680c61f1863, 0x7cf6135068b2cb07, 0x41710bf2e043e3eb, 0x0399e95d0b92339b, 0x842c6f10d6c759e2, 0x1624cb090fad55e2, 0xe746402e6aaa161a, 0x6f20c0cb1c0f0ae7, 0x98085c012563b02a, 0x249c4472f0774355
+, 0x278990f852fa2067, 0x1b30719654765e92, 0x6220f82803468189, 0x0e926335e40af731, 0x26ed32148a39aeeb, 0x3513f89d800ef533, 0x924fd2f90eb8046d, 0x27a68e3ed2428502, 0xebf0d9734a632720, 0x48390a41ba7ef7c1, 0xff8b3a91d48f2b54, 0x40e7768a8918dd2b
+, 0xee264e70d5131efb, 0x76b1a798b321c397, 0x36e61712175fa915, 0x5c6e3863e5b675ce, 0x4251ed9b1059650d, 0x695b7cc089d4c369, 0x2fbfe906aa6c9fce, 0x4fa35ff4dcf68df7, 0xbb41026ebbac3a56, 0x0974e7007a022152, 0xb8c68551fd86d1c0, 0x2a5cdd9b595b1354
+, 0x12e975799fbb41b4, 0x21c714bed13b3a59, 0xdb68ed4bc3791d71, 0x3d64a9337d8b7749, 0x908ef0568d4c2519, 0x529abfcbcfdd77ac, 0x6906a1452050965b, 0x483e35611dfbceb8, 0x6dece8c4cf4f8946, 0x6425ba2b6a933cfa, 0x54a76e3dec442dbe, 0x27738bcc1f4a92cc
+, 0x9ecdf3fbd44d2284, 0x6831e8e2249c63bd, 0x17bdc106f3720842, 0x03c1e19b52cf7c1d, 0x65c12b4df80052b4, 0x6a2168fce594f546, 0xa4fdc58b24129332, 0x3fe0ec9a185a2292, 0xa664dd20f080ceb6, 0x20fa7b7fd819ff8f, 0x8430621d349e9a62, 0x755a14f148a27d55
+, 0xb14d9616af165735, 0x67e2b5726bdd710d, 0x2a701d86415cdb0b, 0x1ee62b2ec1295c19, 0x55a6f70ffcae1f66, 0x00e6f75130430546, 0x4c37491b0c3dd010, 0x34fb19282f615138, 0xfd56396d570c0889, 0x5546a933752c2a7a, 0xa494efcdecd3546d, 0x4c3ee305ef5db4a1
+, 0x8b10ad21745b0c25, 0x58d186a33903db13, 0x1d5718064a80a68f, 0x66d8464e9619c9ce, 0x58038a81cc737206, 0x782356134683b774, 0x888f822305961129, 0x32d3900e72ba96de, 0x0a59b4e8215531b8, 0x675567f68270d43d, 0xf222e65466cca99f, 0x7e66f64dde1b06e5
+, 0x3756d4d479c2cc3d, 0x25d44ea8d31543de, 0xd82c8bef26bb2c43, 0x2c2047033d27f37f, 0x5bd33d9837dad260, 0x77943117a3383b7d, 0x12071d697ea583f2, 0x3c7c41272a225bf2, 0x92ebbdfaf1f03ad3, 0x5d61030c68b63704, 0xca6e2853baee75d1, 0x12404b34771a3636
+, 0xbe13c46326667e4f, 0x2bd261916f9be3b0, 0x86e3f8cbadc80f89, 0x74520d8a1794cb48, 0x1e15c745024cf97e, 0x5cee741e1e53eb02, 0x8d088de0af99cda1, 0x625812961cc0862c, 0x4313437321c0e934, 0x60bbc768c424f7a4, 0xaba71fbf3c10e143, 0x37b8ea9f14a915b8
+, 0x8d96ec65c40213ff, 0x74a08828ff77845c, 0xbedb7194daf607a3, 0x17e86671161c8706, 0xaceb98e0524059cf, 0x68552ac494916f09, 0x4cd2971baf1b3c47, 0x68442ebcdde21b70, 0x19629b8c0e867595, 0x6a6955d3635fa47a, 0x6fab45e0f2e393ad, 0x66dd3ef4fcf050c4
+, 0xbb0b7abcfddc7df1, 0x14eb5b751b0bcf9c, 0x1cf79f9ca2fd411d, 0x5c496f73fff0600a, 0x49648d8555426d70, 0x46c1016a2322d8a9, 0xb57fdb870d9b6d4f, 0x609eb65209ddb633, 0xe70f9166bedc82c5, 0x772fb5b5c8afaf27, 0x79a294d9b0227a20, 0x7f75b141112dbc8d
+, 0x98d1c7f88e070020, 0x5953d0aac48217b1, 0xe28253ebe15f33ff, 0x267d1dc11e614c45, 0xbe64f50ab99e2246, 0x4eaaab5c82fe5495, 0x927d5ac07e60bed0, 0x67d3786de6aa1b4d, 0xa71962bf0f6e2945, 0x63d93844a35eea9b, 0xb34228c7d26640ac, 0x169c38d2eb28f5a1
+, 0x4b7972b33439dc22, 0x71478457cdaa1e14, 0x5226e125ec1d58c7, 0x669d8796e78fd4f1, 0x750dd1aaaa44a07f, 0x327c62b55aebbecf, 0x006b8e95b54fbd25, 0x2ab3f95d01eb364e, 0xfcbe5080c0d5e196, 0x2a1b9bd75a57e725, 0x1d2b2b6758139b5d, 0x751cf4af849b7a73
+, 0x164a7d2e337d00a5, 0x00cee3a4cb83a4bc, 0x3498e0366dbe28f9, 0x053d899148d28502, 0x01665d64cab0fb69, 0x4a99132208d68e74, 0xba44bbd4bd3f915d, 0x1d34b0f9172122bb, 0x5d114dc729e8a9f3, 0x08e7a43dd5334b60, 0x28db8e9232f0f3e8, 0x5cb7be1b80264f62
+, 0x9af2c78782508f23, 0x336ae7ccf7e3a1b2, 0x7fe2d4ee2dd194be, 0x573d2e1b2b8a6872, 0x3332ea3363b2ea36, 0x200bc1375b1f4243, 0x65c47c8c06b3260d, 0x42021fca53995c5e, 0x2f7e6cf49bb19946, 0x311fba6a23196d2c, 0xc30c13b62be0d70d, 0x61eeac142711b0dc
+, 0x88526996597d35d4, 0x70169bcbe6bd21d7, 0xa0f1b2d0ad29a510, 0x2ade531472c1b94d, 0x11e320dc189873e7, 0x2d2a1794e85cdb38, 0xa0a8c453a6f621e3, 0x4b06d5b54525f6f7, 0xf42916691848ec1c, 0x1d4216555d578730, 0xf8c60da7290a5b4e, 0x66dd9f39a1f3565f
+, 0x55ac29d937b474a0, 0x4291967a4a369ee4, 0x918dacaa12e6bc89, 0x3d46e8900651c310, 0xaf055430a00e90b1, 0x16f62bf56da5ca39, 0x1a021c33488c51e6, 0x0d64dadf63fbbcd5, 0x0918ece59dbfea7c, 0x3b3319d7dd74203a, 0x1d88545b8b9fa90c, 0x13b792dc908c59e6
+, 0x0a2d939a9c3d0979, 0x321a5dbeb74bf127, 0x5e5947fff66d8470, 0x22ec9ecafd26bc99, 0xde17ca8293b10536, 0x593f56c0559dd846, 0x1148373375485023, 0x23c6b0fdf7448b1c, 0x377904458a27804f, 0x573e91962726ea70, 0x35e1b24f3235ac70, 0x51ba082049f4f85e
+, 0x4bc4918160d47194, 0x5d29a21e3308e1dd, 0x7e15894b3e6e4e33, 0x50dbbd2f4f31d0fb, 0xef248bd235a9c9de, 0x3418add21b634710, 0x96c7233a52363bd2, 0x7c8414ad9a08c99f, 0xbc6acb4a54e6c05c, 0x5729021a1193579a, 0x0627c3e00b08fa1c, 0x3d0b4ff9e17c2a73
+, 0xd507e8755990317f, 0x75b27bb3bc7bfe48, 0x44a80f2c6ce651f5, 0x7b9795fc1b706e46, 0x9de75bdefdf9a640, 0x75ade50ababffaa8, 0xce0ab116870889a0, 0x6f3ddcfcdd59ec6c, 0x6e36833588de0674, 0x291d1129ea28a073, 0xf8b8e53864884d61, 0x706ef8f1ae854d76
+, 0x137a8c6583753069, 0x01e45f1cc620f966, 0xe28e1ff82f76c7ba, 0x36d29eace3e89c54, 0x83379f157f0b49cb, 0x65e9c39e2bacb937, 0x9b323c45070cda3e, 0x16e02f31ab7e2de5, 0x53bcf346635122b7, 0x1fd7e207d6c2de09, 0x3a5f5f94ea1e57ac, 0x0cba06e8d0f0b4df
+, 0x70b440c387a9c392, 0x1e7dc143dee1d800, 0x5498ba6d7239912b, 0x332870a017182d14, 0x6be306fc672d794c, 0x2c2ce211245b2b4e, 0x109b722c8d2ba79f, 0x268520fa9c5f727a, 0x515b300524fe78ee, 0x736201eccbaea698, 0x4608ac113210bf78, 0x32d8fd919c441843
+, 0xc9557e1b04b8f2d8, 0x775437f798dc7459, 0x1200f5585ba417f5, 0x2e00ec5f3e7ad304, 0xfc873d5f2b446288, 0x32270a93624876e4, 0xc646a47c08789b22, 0x2370d9fe925616be, 0x430afa3619e671c4, 0x156468ceac1f5fb2, 0x3b84dec2f2417635, 0x31140e9017c0e58f
+, 0x8e39f63122a35b8c, 0x0386e7aaf36baee5, 0x104493c82a1b6692, 0x7707715ca9b7cd49, 0x36b374e16722508a, 0x2c9d410ec8b16cb2, 0xd9687eec9ccfedb1, 0x3dab06d17a25ac74, 0xc315cf849b327683, 0x516d049e6b5def9b, 0xf1eb512bb005c073, 0x53d71f6607f471e0
+, 0xd74cfe44bce69416, 0x0ce59be2c5dd06b8, 0xc933d72159f2d83d, 0x683601c13406467c, 0x68e109e7f9d5441b, 0x7195b10b424da5a1, 0x1d3c5638345375e1, 0x5f4cdbda3d5bbd7e, 0xb9a68f2d2040d216, 0x555f3979d9fecb0a, 0xd881ca235e55f7c4, 0x26eff05fb56ebef8
+, 0x82bec13065c4513f, 0x0ac1b655d472ffed, 0x1aef055ef295cd15, 0x6c276b7df6694dde, 0x1163783c1cf3bf8c, 0x53f6701d1e3c8e54, 0x17e34edd7963cd44, 0x26bf4be8e98e9181, 0xe6fa60f724a8dee7, 0x0dbb5d94ab81eee4, 0x09951b7469642d7c, 0x0d9f67ec247cb7f1
+, 0xaba480599df6743d, 0x56bfe82fdfa8859c, 0xcb430e0603b77fd3, 0x05efd65c4c6c9a27, 0xf17d300a25ae499f, 0x6fb4805ca8112373, 0x89d43b899e2c538b, 0x780a6c913dcafa85, 0x0d511f3be19d4d02, 0x196dc063aaa988f8, 0x0b267052b6e442e5, 0x5fd2627fd1f0b338
+, 0x1a6cc27f46873124, 0x5d7816bff045a9c4, 0xc23a093f7e30128c, 0x71be1502dac049a2, 0xe565ad2960c92422, 0x4bceb57b249ccd0f, 0x96622fffae006b75, 0x6a83143ee709c183, 0x571aa2901aa6ffe3, 0x74bff45272d8014b, 0x15940980bd1b63da, 0x46db6bd66eb1d442
+, 0x7cf2594daabeaf10, 0x35c9b79216818e20, 0xf0eec7bbeeff263c, 0x70c8e76d100390d2, 0xc11a022b0273d5ce, 0x04f661b1f45dc1a8, 0x69b4914f7d68b819, 0x100bce465fd93670, 0x1122231b9a245794, 0x6b01656b66f16a7d, 0x42d3b06046065549, 0x13c36547481cafdd
+, 0x29167d3d907878a9, 0x2f25902a95db464f, 0x7da5bd397241dd28, 0x371da8ec6259b078, 0x74c22927d193e916, 0x2d460b2b470e2762, 0x5ff353e97300204c, 0x00c133b8f906dca0, 0x803b371dd8bf7c61, 0x1a46c2c7d5dd4ff9, 0x205f4a35c6937cc8, 0x3b0b6e07cbb32e86
+, 0x0d1b746e656b1b24, 0x08c5b063a4f95a1e, 0x95ff58e366bbdd92, 0x0fe387aff5d2af6c, 0xb55c6680256e4004, 0x4cc371fcf7e97266, 0xb5c5fe28cb42b267, 0x2a25ad8d7ff918c6, 0x1fd8acf9de78a31d, 0x6f67a9398ec6e083, 0xbfc038bb0c5a97e1, 0x36279d36bf43369c
+, 0x04947f2ab76b7069, 0x020bb6721b89e850, 0xb670b9a2d715e414, 0x2c1502d1f69fe9d6, 0x5f82739ad1140cc4, 0x57e4c257659e6482, 0x93eeec615f2a7d9f, 0x14e40ab98362246f, 0x2c8531e871dc5498, 0x0b52734b6c9edbc4, 0xab79b91866f7d3d4, 0x709630243b5d3ddd
+, 0xd1d3a445bae51256, 0x576cb6ecb9ac57f0, 0x19f272739296960f, 0x33a0c11775d360ce, 0xd737e98542f23367, 0x3d0928a9a63dbe44, 0xe228551ab64014b4, 0x685e459cc16b3c6c, 0x9bed8823d94834d4, 0x1c65edee1ae8e4ba, 0xd97cbbd0a96e5466, 0x0be679c2cc66686d
+, 0x185325cc82a5ec85, 0x6bfd31b92ed9cd49, 0xd758723f53ebbf06, 0x78de9d89f79ee5e5, 0x39a7974d1df340ce, 0x6808014c0cdee763, 0x77e53feb9bba2737, 0x7c0f8ebac5f3f27f, 0x701127880aeb25e6, 0x35c68fb174530fa3, 0x7352ebdfcff70b9e, 0x2a2a3b133219527a
+, 0xf7d4a89c4217504d, 0x117888c9004650d6, 0x5d00bffcea6a9889, 0x7884f2210358f899, 0xf326f1e2ea2cc149, 0x5777427897aebc98, 0xe8c2c6d1e2e16076, 0x27166dc00d479332, 0xf8f41cdd61897915, 0x588a542f4d2f8f77, 0x5b66b5bbf2c0cfaa, 0x2a45306250ff145f
+, 0xa56fc454a1a2a5e8, 0x4d275f6068cd4d44, 0x056fbd74ac77ae3a, 0x02e931597cba9a20, 0x16f2811943883512, 0x0abc68be775b1cea, 0x3c1b34422f56e40b, 0x3abad8fa6944555a, 0x142639baee012acf, 0x04c05fb24301ac7d, 0x11bf9e3840926ba0, 0x268a4abe6194f495
+, 0xaf9e502b568064a1, 0x15acdc70286abdf1, 0xeb88e71386135234, 0x39584f1aa2868eb0, 0xc4c5838d050a2488, 0x112267b3f72fa10a, 0xba0b9cd29e8263f1, 0x2e498388ed18a8ac, 0x5fee95438dcfa0e3, 0x3ef626b150364154, 0x7713e23b95759b5a, 0x3194b4988ddc2ff6
+, 0x6448fbb9dbf80b14, 0x0e7cc21fd80e6d0c, 0x5a3d41cc77cfafbc, 0x6d0e984c9a90f057, 0x7eb301d8f7495892, 0x4e1c7e4070a8fe34, 0xb25b3e82745bc677, 0x7e2167729afa1ba3, 0xc259a33eaf0dee84, 0x6998aff34d4b93a8, 0x8d2695f904ab00d0, 0x2837bd07d3070e72
+, 0xec2e9b88577b8925, 0x1ecf2ef85eca9aea, 0x3d3a3d9ab7438aa4, 0x4a82483573de5492, 0x42599218107c7572, 0x47360899e55ddc1b, 0xb54657c444d7e816, 0x6e999d794bb5fc29, 0xe5861e088acdf685, 0x4e15526f755a1de4, 0xa98b929efdaaa3f3, 0x5806815d038ceebc
+, 0x5c85f88ccb7443fa, 0x0da75f5d64d864ac, 0x295ff44871b0fb84, 0x1b79e10bad3336c3, 0xffdf9942dd2977b3, 0x4c1b198d0f9a1a23, 0xba778a24c112864e, 0x74f66897f26d48d0, 0x3fd5c06e867ab611, 0x4b98ce33ff7878b9, 0xf7db4dce75cb9165, 0x11665aa099ec5163
+, 0x2a498f16ae7118b9, 0x265ec3dbb4eb509a, 0x3da4230668ce2c86, 0x36e62baab2e33385, 0x99507d4a79ab4478, 0x25bfb2fc411e8875, 0xd7ac1ec933022ce1, 0x23d341ae033d0466, 0xd295b465e962bc00, 0x23d0211ba2d73180, 0xa03ccd7aff922d4d, 0x1e767148de301514
+, 0xc241ab36a894efab, 0x1c9fc2f343fc1e58, 0xca3b96562bd27a87, 0x53623e2285dd7015, 0x557411f01c219420, 0x19265577096b42f9, 0xd3312d941b23592f, 0x30a9a9a1c3c51c06, 0x3d89b0b3ea6e8f79, 0x7eab751dc5c77cb2, 0xc0a9b186e6df6e36, 0x4f844d583f155694
+, 0x419018232793dffa, 0x2add440b6bd3854d, 0xd55480f131df6e32, 0x318ce3846ae3e417, 0x0565062d1a0984f4, 0x6ebaec63d2bff9f6, 0x77075fe729e79790, 0x0dd9434624c8a4e7, 0xbf8f11e2dfa9b062, 0x1b17d8255ee8b364, 0x62c2150cf72c6344, 0x28106880d081e8dc
+, 0xf4a4af0ddfec91c1, 0x1a8f0e6c977e1f2e, 0x72a7a3a738b9316f, 0x323716728c4e22ec, 0xc14069065ba4af3b, 0x081514248911d367, 0x51bd4afaa8b6c337, 0x50e77a9b513400e7, 0x46c0051b2a822548, 0x024886e41a5edcfc, 0xa06b0efa41cac17f, 0x336a30b01b9c5675
+, 0x74fb2c10ca097626, 0x2b204caa48e90981, 0x6902c952b9a17b74, 0x39c2e9b6b922303b, 0xb9216b9b3c597419, 0x6d92930264f15f76, 0x7b1297d5eeae1427, 0x0f0744adfe1bd307, 0x33b57e265be6a89d, 0x282fa2e533356c10, 0x3a03995c61dc772c, 0x4f5d8f5e893dcff5
+, 0x4bfc927efc48023f, 0x596f2241d6a685ae, 0x3cb3e0afec29b8a2, 0x31018e0d10653842, 0x2fd00fe944575626, 0x1241d8704982e011, 0x970d56664e6781a7, 0x1b05f49d0f3de2ce, 0xa994ffdf63717e66, 0x416374a76ba88e98, 0x8b082ced53f1579a, 0x56781dfab5d2aa4b
+, 0x8151defd1865b318, 0x64669b840d6081f7, 0xe436f4bb5f38e14e, 0x43d438410a974b40, 0x5832ceb3d666be02, 0x06347d9e1ae1828e, 0x6979471b39e3ea86, 0x2cf2cf61cb4b5ae4, 0xb7ab29eada5a6ee4, 0x12e75cb29aca5768, 0xe65b1109d30d1ffc, 0x71f9becd6b320e5a
+, 0xdc8289026647eed9, 0x31d62d050ca5458f, 0xea2bbf523a54c1e5, 0x602bf0b9e3ee5491, 0x25aa73622380ad4b, 0x2b6b1e3271df5f58, 0xdbc5efd86aa0470d, 0x05353c24b8c4354b, 0xa3c7db3cf5e06bca, 0x288a1c8f2b4ea5f7, 0xd6152f5e12ce7ca1, 0x59d4c1b436673c7d
+, 0x1e02554e521fcb95, 0x66d3980f240ad440, 0xabf16f6b39a4d9d1, 0x7fea351ca94c2f62, 0x3d62b6f3389163ba, 0x0fc6b44f2e7895ea, 0xd5c64403cda7c669, 0x2e4099090e603193, 0x9b5c0faf15fa4c2f, 0x46295c9d8e12b639, 0x5ce4add63a5b331b, 0x5fa7bd736c4c5879
+, 0x47b3471447d1aef2, 0x28004c1c22325739, 0xd588437d9a3c5299, 0x2ab19c1812cd27e8, 0x3ae700f680037802, 0x1ad163800b422b36, 0x45b7ef36fabc2139, 0x44bcdeff21dcbd1d, 0x41c6da2171e11c7b, 0x2c35ee79f7c4cc14, 0x4852942759c13849, 0x6492d26f10be050a
+, 0xa6f54e988c50f0d9, 0x6a2db2b6dd62181b, 0xf7d9806b2a5e57a3, 0x57526bdb3ba53d20, 0x17ce6cb1f500e650, 0x05d841b042f8f345, 0xaa800a6c698de970, 0x04f4b559abe2cb8e, 0xc050dfd7259ce49d, 0x213839bdf94db935, 0xb371258655306204, 0x7d323b8b19f9705a
+, 0x26d4502b16b6c618, 0x79717069aa89595b, 0xf867c0e36db41872, 0x13d601d86c76e1d0, 0x2dfc8b0d331b7383, 0x185472f3e42e8075, 0x05bd13e72b10eba0, 0x519a387490f79b95, 0x8d09c1b2d3ad2500, 0x045da45d2cf0f733, 0x640181956862426c, 0x728d57f59bfe1b09
+, 0xf9a99f878da2c585, 0x4fc4831e61dc4e10, 0x6dc602cc54394fe0, 0x0484566b67e9e8ae, 0xc5fcf0474a93809b, 0x71c0c23a58f3e2bb, 0xb400fabe36fe6c43, 0x614c2f3eaee4c0a7, 0x7610a980d0e1c6c1, 0x1ce8197c88885dcc, 0xeade1c9f3ac2cb2b, 0x471ad07baf2f341e
+, 0xd67a837c6b01121b, 0x2a8e64281f59cb59, 0x52e701e42f3262ca, 0x19e0a27dece50580, 0xb5691c17a7bda6ac, 0x43484c311b9df1f2, 0xa68155549bae49ea, 0x43a2c5dda225fae5, 0xfa5e992aed700eef, 0x58911f5623918856, 0x648b81a1e48c4da9, 0x66e6e30cbdd0c3bd
+, 0xf3ba209c169d266b, 0x20f7a86230447685, 0xd1bb5aaa1a0c3d2e, 0x366c29843d1111f1, 0x06c78b642dcc9013, 0x27484a64e109e3fb, 0x8f8eacbca4677464, 0x0b6cb31b1dc24cc1, 0xdf69c84f898f0fa0, 0x2dd426744920f2a2, 0xc0912a197d4c5c69, 0x489ade7f6a98d8d6
+, 0x3069aea89d8bc19a, 0x0c9a7f6c189afe2d, 0xa9d2e8fefed9e7e9, 0x6aac4b142e447608, 0xc2f35d2ac253f1a3, 0x12da4a55770d5e4d, 0x2a8df00cb823fae2, 0x0263c2d5a4aac0f2, 0xe0f7ae8f2bb63ac2, 0x784e9f287f727f0a, 0xdeb88d1b8baa9946, 0x26dac67c38e9c2ef
+, 0xde06e82b262c6ce2, 0x6b91679d0457a19b, 0x8d22ced7a4baf178, 0x089d06a49eabcbee, 0x119f18f3bd0e586f, 0x2fbc54e4e5918c1a, 0xa0ad0045a10054db, 0x4f722e62840e6135, 0x15ae7d58b10af697, 0x27561adab570a886, 0xc790d4d605ef81ee, 0x677953c82aa33fc0
+, 0x51abaaed6d034e6b, 0x27b87a03a3de073a, 0x45913d44f0e131d6, 0x463a4888e86a1a4f, 0xf98653789a987886, 0x0f32db3af801d0f5, 0x3fd17985b5e349fd, 0x3a12e03952627324, 0x7fd7ed9494e49523, 0x59bd6456e17f2669, 0x10d37a27619084dd, 0x28347a676f102d22
+, 0x3622616eae35bbd2, 0x2e52afe632518bb9, 0x1ca47af50378e29c, 0x0eb7d26c12b0f8cb, 0xba2af95505cb42a7, 0x3d512ffb62db6e9e, 0xd5e5d7f9df5c11cf, 0x3f0632d7c480df87, 0x40ed08b9eaeb6a5c, 0x6dec8606e10d048d, 0x5f6a38509162233d, 0x1c1530487f29db06
+, 0x2ecbf8b6e4089882, 0x186d99104c589ad8, 0x3abc056f3b3ff423, 0x5a5ffa30797876f4, 0x242b05ac2841978d, 0x0af83cb9e881d939, 0x5abc5a54a98b611a, 0x031be5b56daff164, 0xb1cc51a85a3f3c19, 0x0eed63ed0970c9a2, 0x1bf7b85db8b32076, 0x661c2a807621bbec
+, 0xb074c276f2468aa0, 0x706329a30b383ae8, 0x89b1d72593f10aca, 0x1c23b7786fa44557, 0x241c597a14d6e00b, 0x299036e4e410107e, 0x62a8791e8a0a155f, 0x7b15d7fa9452c14e, 0xddc18d12b50bc1a3, 0x1b1ea11501a359f2, 0x5acd552e16e97fa5, 0x49f322488598f678
+, 0xbb8e76a39945fe06, 0x553f72e272240471, 0xb51a189cc100e39e, 0x6901791bde89459d, 0x07d7bdc87a26c93e, 0x4acdcc5a343bbdb2, 0xecfe09e16afd9927, 0x47986029da7d9a39, 0x20839093a59b6723, 0x13e82dd7b96d53b9, 0x43252f0a35a904b5, 0x78727f9844dcd4cd
+, 0x3fd8f1f3820c32d5, 0x15659c3ea11a411c, 0x0cdd8a117d958343, 0x2072f0c42744374e, 0x8484cfc4ecbc206a, 0x08e29b0deeed2795, 0x97f67afc84004b9b, 0x316b7fa3c7a2061e, 0x24b8beed6560a895, 0x241865ed67d74d24, 0xa91d03184200e750, 0x2d4f3d9da20aa792
+, 0xef6e54f24390fc2e, 0x3fadc8eaf2e64465, 0xabe013eaf6cc7b50, 0x5fd3488a897601e6, 0x77747f53bbfebf98, 0x0ee13edc5429532e, 0xaa2510e8d8ce7f9b, 0x103c0fa469add15a, 0xf0d3e7608b21c5dc, 0x5b1292a7b9c0ce61, 0xa0b99d13b8c75000, 0x5d79f89d5001c16c
+, 0x4e7832f9de5efecd, 0x54a72e78c35854a9, 0x71cd52439fcdd420, 0x0ccc32b51371c58c, 0xcb1dcddc4d7bfa0b, 0x3fd9f3d2f995754e, 0x0bc731080d26889b, 0x492b42f832f2e262, 0x38af2b64c6e45c22, 0x1a2b4d9b41fc81d8, 0x6c7372b5581c5125, 0x7043684c2cb07a07
+, 0xa65a208cb7720586, 0x7d1244fe0d7c570d, 0xa75734419465312a, 0x062d94d0ac0f9eae, 0xc73af6f249d7ae34, 0x36c9c7e656158e03, 0xe6403e041360cfdf, 0x0615b3f671fa78b1, 0xdc947282dbc55c6b, 0x111bce982835d7c6, 0x9a0f5632d6b60e01, 0x68704686f78cbba8
+, 0x07f203c933aec93e, 0x75ebb0731d6fcbec, 0x894845302b0615e9, 0x5633ca6809e89169, 0xa101abb6e6233349, 0x5418cd84958a9e1d, 0x53cb7f9b7f4e0171, 0x362f2e2072299189, 0x513458deb4e67b4c, 0x2114d0cc31cc584e, 0xd55c16b885a358af, 0x5b9a2ccb2a9b569f
+, 0xb2e438611b315ef0, 0x579f0eebc6cded5d, 0xf2f9aa2c0f1435f3, 0x568c7373401a9ce6, 0xe0c4af64569c69ff, 0x3816b94f4a7bd632, 0x4b3599a57c82f259, 0x6df49be62b6fba6f, 0xf7f51e042a5c3da7, 0x2a5cd004abdc9517, 0x6a44e61778ee5a3b, 0x110034e83d18f04a
+, 0xc131c577ccd74e81, 0x27f2804807368886, 0x3e157aec341866bb, 0x03e4b3cc19545267, 0x209556bb679651fe, 0x263cdcaee57d85b6, 0x6a735973a3372fbc, 0x2813dfb5bbdfb3cd, 0xcd7fd11ef26399a5, 0x576b9a614c9ee987, 0x9a08e8b447261e89, 0x00bf8a448e6b6398
+, 0xf587b85ccd944829, 0x736b970449cc2888, 0x17d8b3b9108f767a, 0x11acae0a2fa14697, 0xbf5c2c0c61fc944a, 0x29a4e4eb46faf5f5, 0xd556025a6e1a900e, 0x2108be18af10fade, 0x3260f7ab02f12650, 0x772479b9a3a22ead, 0xf3c31e1a7dfdc86b, 0x619806678c5ecbbc
+, 0x9490325c4282e24d, 0x200989be97e7c99b, 0xc2eaf71fae9a9a2d, 0x67a32861a6c4e6d6, 0xbc0a0b887bab26bc, 0x3db5470c78a34825, 0x6371bb44eac438e9, 0x4e1697f5caab7e76, 0x42b20eda6a2d9b18, 0x2473979186c2cc01, 0xa48299eae4b68fc5, 0x0e30bfaa1b522980
+, 0x458769f47f203e28, 0x124f4123fc05ac97, 0x3bb936f4ad6d7d67, 0x330954fed4f00ff8, 0xc2ce650046f90eaf, 0x7bf94762d4f9debd, 0x2e93172a586dfb83, 0x3c7a6062b4113d96, 0x5ddb0397147f0d93, 0x08e3596fc6839034, 0x374e67ff67639bfa, 0x19021c2119888232
+, 0x002f5d04fdd55efa, 0x05b4c6e079e1baa3, 0xe5678ea3ad74c84c, 0x1c42f7826a58a77d, 0xe054668bd2cafacd, 0x237668d3ede4261c, 0xedf46a6374aebb32, 0x31ec8c5931cf0ef4, 0x955c2e95c35b5825, 0x27d8b0ea68259603, 0xb7a8976e427d1ec0, 0x6b6cc5c07152bd13
+, 0x03d88f0ca0b244cd, 0x001cae9a8cfed897, 0xa844b3a1f693a7fd, 0x676c9acb7abdec96, 0x631b6bd5e0cdbd33, 0x29f289dc0cddd9b8, 0x0947d57536fb2eff, 0x1eb2ce650e3eb059, 0x2139b3a40e8bf405, 0x4165edfb39f4ae8d, 0xe061eda67a70d6a6, 0x2e3cc0328c9084f6
+, 0x1ef8329ed056063f, 0x6d4d01ce49e8b3d5, 0x0110c92f1656d34b, 0x6dad1c4e170829e0, 0x584c56c590b477be, 0x597e5f0ad525e935, 0x6008264d8eb7d36d, 0x3f586754999c829e, 0x3d7ea89df5546a1d, 0x41754f7d9a3f4364, 0x3b0796822ef879a7, 0x1ab2779598262872
+, 0xdc37c9f0bbef7923, 0x256ec818ec35a097, 0x4a72da5c09dd5846, 0x51df6c61edcad45c, 0xaef24fcdcf5ce819, 0x0ba6bb959ae689f1, 0xe667bd65a57b3a9e, 0x71ffd591a28a8e4a, 0x06c325fa53a7fadf, 0x6667f2986b2dcf13, 0x3ef751a6d52a09e4, 0x517a104240b8c74a
+, 0xd08cddfd8c8183f5, 0x59237cc71b8147f1, 0xfff94fd188395933, 0x538acc592d10ef67, 0xac51ce386ff0eb1d, 0x69d42b8114c5fe65, 0xa17eda3995bfe8b9, 0x5dc6d98fdf05a341, 0xf2304d375ce8be78, 0x31b58521ecc483ca, 0x04d2d8140780222a, 0x3dc18b2be3ed95c9
+, 0xa48e1639f2d70d2b, 0x4ffd54a6bc0f38d0, 0x8ae3c65ba6b7143b, 0x482eb41f9178fa9d, 0x240b8b4e87ad4f1d, 0x6d8532420059eb40, 0xc135f77e44275132, 0x6261076a0daae349, 0x35316bdb3842765c, 0x246165ba3a8bfd92, 0x1c2d774bd5177a75, 0x045a2f991647e3b6
+, 0xed3b5923594671a8, 0x0514fada5acd4db5, 0xe8297fc358a0f50f, 0x7cd2badcf2952a91, 0x0da45130ea9ac266, 0x26a0d43c1e14c979, 0xbb62b729fe93a390, 0x360357aff7f67ccb, 0x3ad4835d1c7c59e8, 0x570daffd86fa470b, 0xd7c4be698fa3bd96, 0x17e4bdec2ad76ffc
+, 0x43ce4ea9ead7dc51, 0x58ba7ae0d64a518e, 0xe014cc7e64680555, 0x03abc953ce2630b8, 0xa318620c7799be57, 0x2b258fa2e84da952, 0xdd88fdc5063b2ffd, 0x17371dd79a3aa556, 0x927b837578981299, 0x554552101d90ab2d, 0xb45306218ce54bd0, 0x59109b65ffdb6235
+, 0x8663e0c4a180a515, 0x41467fe41c6604f4, 0xae2c1aa4dcb73878, 0x19d3cb02c6c07517, 0xaa147c97ea6745f1, 0x70dac71a31cac43c, 0xb9213ec26af87dfa, 0x67f228e9f60e7b25, 0xbfb59b8cf78df3df, 0x36687792a4256fa3, 0xe1be5c1f23177544, 0x786a9e1b644b1c90
+, 0x4172f47393ca7f5b, 0x62ae5bb4b8aaeb59, 0xbcd9c431fa631b6f, 0x1fbe20b2edc9cc6d, 0x5fdd829fbc0ee085, 0x241dd315adc5dd59, 0xb4b688d625f7dbb6, 0x595a82fee5bed2d4, 0x69653ae0cc11880d, 0x2b9e85fefc402f76, 0xbb2495b507770a81, 0x05d20c575fb34731
+, 0x9d9e623436485ab2, 0x27012a9665f3febb, 0x586cfef484c04ff7, 0x44a5860cc0eabfbe, 0x6fbfe6e2f3532e80, 0x05abeabaaf3220fe, 0x1bed21f2cb809678, 0x2aa62112b7eafed2, 0xe298837cf610190b, 0x1ec8fbbcef9158f8, 0x1efe9b3aa4f96f6b, 0x6a3b842a068b0ef3
+, 0x92dd4b7cd7f827f7, 0x605175bbf3fd1c97, 0x139bb6419c1f6d98, 0x3a3ab2e9978db310, 0xc5c95941c9d5dd0b, 0x34c6c76025b2bce0, 0x0d44115a49bb8126, 0x7622cbeb11daf619, 0x785bff93164ef5ad, 0x7191647d355cb45d, 0x117f255c4cce6e5c, 0x581b448b0e9aae3e
+, 0x54a4f3cb36225414, 0x790180c539bc4685, 0x47064043b7c6b96f, 0x43cccf5b3a2c010b, 0x1dfbf3afc14c3731, 0x1c368f3195572574, 0x00bc2ed3b5070b5a, 0x0332d8dd63b37f60, 0x0744b1908c9bd8f0, 0x2d258e628dacb9ce, 0xbba5b4bdb9c61e14, 0x0bca12295a34e996
+, 0x059c84c66f2175d4, 0x1a3bed438790be78, 0xdf394f577dabb5b0, 0x304777e63b3c33e4, 0x59a29d4fe82c5a6a, 0x72e421d1e88e77a4, 0x69e6230313312959, 0x2da03aad8cf2bbb8, 0x2858d8608fecb0b6, 0x343099e7a40243a6, 0xba29b675d29a8f63, 0x3d2028a4f6f15886
+, 0xf068e2d286047d0a, 0x14999b5d6c770e20, 0xd1874a592385da79, 0x78aeb552c15a1cd9, 0x482dcccc23e9c06e, 0x7b18a19fb54b5745, 0x036c896efe9a7a06, 0x2f2c2ce0d1871c13, 0x3b2d9b9ed65492c7, 0x0649c7e50819d077, 0xcdab66ea7b65e3cb, 0x49b15b40c4aaf03f
+, 0x7ec18e09598313ed, 0x6e0c4cb5d35fc331, 0xf93cee8a89ece66a, 0x5524f57916e3e39a, 0xfe631852e17a81b6, 0x2a265466d499efa7, 0x51fe24949eb3b02b, 0x76cf70025c51b080, 0x872381bc46133396, 0x1a959970d7ba3cea, 0x832eab4cefb8b1bb, 0x0095ba4b46d4eb78
+, 0xd29409d64f662e61, 0x7f36dd1794051c30, 0xaa7cc107fed1f84c, 0x2174f4da8ef758d8, 0x8224cf963e961ce1, 0x4e419c4119c9e12d, 0xc6263c3e3d6c85f8, 0x7ab23aed3f9b4691, 0xa4376f1f9d89d056, 0x605733ea7d337513, 0xbdc1abc5c8c41828, 0x5fa02119a9e2515c
+, 0xd68c0c437a63cfd0, 0x51c178142be244dd, 0xa524c2b4c3db956e, 0x16ab06736da04a92, 0xa46f9a077e2c0f3c, 0x7db885049e19acd4, 0x14d48e76d5fb8d08, 0x137fd5875a894e26, 0xf8fd7999cd045390, 0x76d49e424b4f1a35, 0x88dde45e1edf354f, 0x6df44243a0010a6d
+, 0x4a9e1c53bd692356, 0x3d9f81ff6b92da39, 0x4b33ca48a6b5cf8c, 0x3cd13b7b05092113, 0x306fcef8e2c00dc6, 0x0f3cb9b79d67bb75, 0x327746ccea74dd86, 0x053af5dc14bc844e, 0x2af898c7c4b060be, 0x1d07afa342734632, 0x5d570925e5196870, 0x05f43af096bda85b
+, 0x8c23fb738cb230a7, 0x7108b85dc52df2e0, 0x4ae8a6734917e1f3, 0x5123c9667abee111, 0x70f426415f9b94cc, 0x3c907b3a4c1d694b, 0x5b0f2474d2094a75, 0x5018299f512b8669, 0xb82e5e8b22899b98, 0x211638eace2909a2, 0xb306c956f47208d3, 0x2e9bab3ed5225ffd
+, 0x699f103d5bcd7041, 0x2ac82f358aaaef8f, 0xc2def519c6492adf, 0x7b6eeb09821907de, 0x3ea37083d2ed7689, 0x5c3f0ed2464549a0, 0x46f4317c58fd3c36, 0x5b678aa5f7dd07dd, 0xa0aa20d2ee11789c, 0x2dcf971075adc602, 0xfa14524a4c6dffc3, 0x3c27a5178d269d0f
+, 0xf163245f5d04bc92, 0x23771338380588a5, 0xcfd3afdfdb02a889, 0x2a9e1f02a1ece0d1, 0x8f5933976303859e, 0x0520f96e2bb76909, 0x0507e4a7b8e608a2, 0x2c0ffae19ce2d499, 0x377ea0a24e1ad8bc, 0x10781b2e3715f132, 0xd137c8ab240e8f6a, 0x004cefe80d623f07
+, 0x759052742bd6bfdc, 0x0feeaf09e2a294af, 0x3d4010a7843ae00d, 0x2411dfaa4ec59e53, 0x7c81c23895ebf1eb, 0x29cd144610d67429, 0xc953d8e2bec2eb15, 0x0622cfd630864f84, 0xcab6739085b61862, 0x4d4e65921333856d, 0x5f6b10d98b6a5c06, 0x3bea954c7b67c5d9
+, 0xae1b1ae34f20ca3a, 0x6ab3f30f456c5b26, 0x2734d8ac57d24aeb, 0x2faf289e111d1850, 0x32ff566b911dd022, 0x38c1137e0722967d, 0x37f01ebc9fffff7f, 0x5658d7feb70fe2c1, 0x4fee18da616518b4, 0x598ca0ab7957a01d, 0x8c84979394d2bcd0, 0x61b72f1a843edf43
+, 0x0169da1ef264ae10, 0x54ab39cc1da1397f, 0xec6e4dcf194c5f61, 0x232ede95fc083da5, 0x36a0d8443bc7e0f7, 0x279d66c8dd6868ea, 0x3cad35963a732000, 0x7a963aa95dfd5d35, 0x7a3d43fde4c5ad6f, 0x6dba67ad4a639a40, 0x14a7fd2ddd627ce6, 0x28867a042f88282e
+, 0x04564a3c76c97901, 0x6f1ea882a17a89e3, 0x2652bfc6b9563314, 0x351fcfda7e91c4ee, 0x96341a14420641ab, 0x2b6cb91216858c5a, 0xb577306b483a20f2, 0x6c26c0e87cb57873, 0xf83686e65261b82b, 0x7925d411c6be09f2, 0x0fbe62f243f1fa23, 0x3fde7ff27ab76a66
+, 0x007b7163bf6598cd, 0x0dd68f3a93b64df0, 0x83739e27a3ec0d08, 0x3a20f640234d6299, 0xabb394bc46c26562, 0x7e2e12a07ab2df29, 0x4ad8918729c971af, 0x4026a9b3b9181cbe, 0x9b08550602617421, 0x4a7f07f5909e8036, 0x7fb31b3e275602c8, 0x6f068b8c68361029
+, 0x0c255e1465eafca3, 0x01e0ee1211723da2, 0x7579c3a02876b339, 0x3701383677b28c49, 0x8eda17684bf06251, 0x65ff6a5f64dc597b, 0xa187f9f511e6092a, 0x6d3b4a244de5081d, 0x7027752289ae7fcd, 0x7015ef4d12058320, 0x52e9de1df178db71, 0x48f198d97edf8a76
+, 0xaaf9590fc61c2537, 0x58d8280c5d430f56, 0x967fe0368a6fe199, 0x0b8ea23f65bf076d, 0x899d9f738693ba86, 0x5a0c8edc5c13d0cc, 0x1beb9aa05c937c5e, 0x7347a0d1fac0ece3, 0x24dc4eda762cfe84, 0x2d38b200dba9647e, 0x4057533bac5091e5, 0x3b5b8281c0e3d9a5
+, 0xb19f3cfe3b7652a3, 0x79f8ae5a0e3ac8ce, 0xd3a8a48361dec597, 0x6cb57f0a4e09f857, 0x20d40a7bd05ebdf8, 0x17eada9826be9c06, 0x4685dea50add0f48, 0x79d5885edefaa012, 0x385a68e07bc38a8f, 0x7197e18d6455d4cf, 0x43a24bf7cdaf3372, 0x1197fbbb13c6d65e
+, 0x76c4e49e724845dc, 0x6d5d326899209179, 0x187c776e623bf086, 0x55ee1012c36bb172, 0xf0642a589fbe8f3f, 0x063c9270ec0fcd6f, 0xfe20a1a66fb99f04, 0x0a2d9f425b22f6f7, 0xce285ee7dcb9fd07, 0x606d608b3090e270, 0x0f3f27bc632294df, 0x5dc850fe97150664 };
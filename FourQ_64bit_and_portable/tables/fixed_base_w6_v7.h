@@ -0,0 +1,237 @@
+/***********************************************************************************
+* FourQlib: a high-performance crypto library based on the elliptic curve FourQ
+*
+*    Copyright (c) Microsoft Corporation. All rights reserved.
+*
+* Abstract: precomputed table for fixed-base scalar multiplication with W_FIXEDBASE = 6 and V_FIXEDBASE = 7
+************************************************************************************/
+
+// The table below was generated by table_gen using window width W = 6 and table parameter V = 7 (see http://eprint.iacr.org/2013/158). 
+// Number of point entries = 7 * 2^5 = 224 points, where each point (x,y) is represented using coordinates (x+y,y-x,2*d*t).
+// Table size = 224 * 3 * 256 = 21KB
+
+static const uint64_t FIXED_BASE_TABLE[2688] = {
+  0xe18a34f3a703e631, 0x287460bf1d502b5f, 0xe02e62f7e4f90353, 0x0c3ba0378b86acde, 0x90bf0f98b0937edc, 0x740b7c7824f0c555, 0xb321239123a01366, 0x4ffcf5b93a9557a5, 0x297afccbabda42bb, 0x5948d137556c97c6, 0xa8189a393330684c, 0x0caf2b720a341f27
+, 0x13a817ff3eedac29, 0x0158f3c0651b37cb, 0x654540380ebdc5eb, 0x0218879b6b389d78, 0x1aeed67b12ad5adb, 0x4f6cf1aaab5156ed, 0x6c4b0164faf3da17, 0x2561c496defc61fe, 0x339a280e36a39cbf, 0x43e687086b118897, 0xf09dfd434b392f69, 0x6e132f9bd42b5fda
+, 0x4bc50f1db4b5dda6, 0x163fe0f65ea5943d, 0x50b9cbc0b20ba676, 0x51adb33b559f4020, 0x5db3a476dc37338a, 0x4e26d412317b8787, 0x79657ff8e320cf07, 0x431ba5ed9a02a90e, 0xb04978006c4f7681, 0x757f7ed6f00b2a8d, 0x44dc2997ce9a5289, 0x5952035e0e2463e2
+, 0xc91b85a8b07395e2, 0x75cb7cd0a1d6c365, 0x17a7af7e7782fcff, 0x609d921add29a5a2, 0x18318b6dccc29d75, 0x375362583f704650, 0xea2685cc80bb9195, 0x13c87bf63599c958, 0x2dbf372875b445bc, 0x73f28f955f9a611f, 0xda25927ed4f070e6, 0x3846832327ca5f23
+, 0x108cbaa04186de57, 0x27e6dc9fdd1718fc, 0xb7691a06855c11b0, 0x66e31bf56c0deab7, 0x8f04072810c68c25, 0x59a6b8f23b794bcf, 0x702d7ec60c3eb926, 0x7a89bdcf53bde124, 0xa0f74d48022c2f42, 0x33e690cb38586de4, 0x7bb2658227f87035, 0x562f3791bb29a0f8
+, 0x8ccd660848a457c4, 0x28c385c20d12f381, 0x421ed4e247996fde, 0x115106cc32bb89fb, 0x8326348d6bee4aaf, 0x59301cb9e3bbd451, 0x06b1459f966a7f70, 0x4aa25b84bf58e819, 0x1c6fb2a239f91128, 0x7ae96434590a8564, 0xb653226a0d54e267, 0x41b144b0ad54d6bf
+, 0x38cb771339a9d0b2, 0x6c36ccc9b9571064, 0x2c7a48d8cca45ed6, 0x26c96c7d5d16d638, 0x46b4d8178af141a2, 0x52b8f9e66e3337c3, 0x355f28e9d50d3178, 0x3e9c80f929df8a05, 0x4a2b539ee2fa372f, 0x0678bad651e72e90, 0xac3dc26312c7fba4, 0x56edb018770f2351
+, 0xa767fedfce1be838, 0x184e43c9655d095b, 0x952bfce7558bb601, 0x50d49412f47d1e26, 0xd4976af5efe389f9, 0x30e92ac364a88551, 0x5781a581dae07e6c, 0x0fa44be49202e40b, 0x1140a47ca407e1c7, 0x1102cc77f0c33731, 0x78f176412e1a83bd, 0x6b61e18ce0fce594
+, 0x653a64249e5e151f, 0x4a7d2019c8a57184, 0x2f127ab57769a789, 0x0990dcdf0e80005a, 0xcc1e32f7da9d40c5, 0x4255767ceb9bab6b, 0x9db3e99a328c4ad5, 0x57899f6e42dc5d0b, 0xd7b226ef724bb39c, 0x32ba767d80e9f3a5, 0x6371b72ea63312a3, 0x1683eea5e843ea8f
+, 0xfec70b8a1316a479, 0x1c95a4cdbcf4b78a, 0x4a683587e951ef61, 0x54f9c6da34456c66, 0xc9b0867e2592700b, 0x29274f84d4dcbc15, 0x67041d18a9a95259, 0x6554738d89010d78, 0x1747506f4ff0bb3a, 0x18b71ad5c9fb7d28, 0x5e016dc6de5efd00, 0x52cf24085c524fb1
+, 0x6d96a9759c0ed3b0, 0x44db31dc5f8b1d3b, 0x982c2396cb5eee8a, 0x242ef877e8a56feb, 0xe7ca8c25a1c073fe, 0x5931fe4157530e5a, 0x8c610daa24ea7eab, 0x07e58f3b17a700c5, 0xf8ec8db68ff3b97a, 0x3f940c048894a884, 0xbbf686f07e71c942, 0x725bdd8a8ef6390a
+, 0xf056ddf15863cfac, 0x2e0b514cf5656d7d, 0x00865699955112cc, 0x544c4ee0111a4cc5, 0x03a0a0364b9c76aa, 0x7eaf370735edaccc, 0x9a5cd738118eaed6, 0x225afec3b2d7cbc7, 0xb3cd038875054f94, 0x7c1545622ce04e48, 0x9f495582b263f1c4, 0x6f30b3030481d7b1
+, 0xef16dc8b2996f48a, 0x1853b67e31db5d56, 0x350b9b5185001aaa, 0x7e8c2d46c6668715, 0x9d15f870b73c2622, 0x645756b29531a998, 0xfc454512ab1c15f7, 0x04bf043b0a25e744, 0x1c66eb8908db44f8, 0x3c6821fb351efba1, 0x8bd9bd984359912e, 0x3c5709d1485971ab
+, 0xd27293c5804518be, 0x19335c72bd8de6e9, 0x79f4152fdf531d89, 0x3ff17efcf227c7dd, 0x75067841f9801b8c, 0x3ae292e42eb9cdd1, 0xa3a263ba8f894aff, 0x0cd48fe6e5aa6cb2, 0x1abfc029b0a6c44a, 0x503094fefaf9dc87, 0xf7c5af3ea134224f, 0x4ba3071a0c20d334
+, 0x4891028d5a8966ae, 0x07d81ff62597c997, 0xbb1cb627edbbc095, 0x7db7dd567a892389, 0x951e340f944836ff, 0x6a7df88ff298f037, 0x6acc75fac01b707c, 0x66ec3f5ba6c7c965, 0xbff98b8aa3ecbb9f, 0x5554448ab662ff6b, 0x88509d7b19d11de2, 0x546ffe41826f3734
+, 0x579643dbe3f4806f, 0x5b455b512c1350ed, 0xea734540881ad549, 0x7b16ffdf350586d4, 0x0b737dc29216f884, 0x6c530e408dc20717, 0xc888f1d954d20573, 0x5d89ace7c7930057, 0x2dc83bf3b7723186, 0x524dbb4992e70dd1, 0x001cf068b72c8a68, 0x0ab2fdf49eadb0b4
+, 0x21a149bcb6f0e789, 0x58dd708dbfff3b6a, 0x64e52bc67b4cceed, 0x477163fd10566937, 0x4479a4be07b18092, 0x516a881389a09fcc, 0x1178e27c27e1736e, 0x4c687e3a540640db, 0xdb35b75bed4a0b36, 0x6249899f4e152d1a, 0xe39662fd6b0ee14f, 0x38c87fe82d682d1c
+, 0x318f0e0b1d0ffc65, 0x62f6f60dbc6d5233, 0x376697e5c2e17363, 0x5d2925d818d72c1d, 0xa4063292377bdbb9, 0x77565069c861814a, 0x6c0c217bd637e8eb, 0x1631ff5474798e93, 0x9f8168f5a3d87f5d, 0x5ff04df62deb0fe0, 0x5584b88f4506f47e, 0x00b6bd4039798f4b
+, 0x9ad63230b442c823, 0x3a0ddaab5cb4e324, 0xc35661d7d0929bd5, 0x6140bade4f10e0e6, 0xc764249086d51678, 0x2432a0395936775b, 0x4d53757b580589a1, 0x2d814b8a9e4dcf39, 0x25cba7f64419e5d9, 0x532bc4253396d1ad, 0xc52aaabc5b23dfeb, 0x3917752c0d980c4b
+, 0x56cd269a0685f794, 0x58c6fe9da0f44884, 0x76fa2a9ab9b42421, 0x0b2e9e5be74cd165, 0xd24ab3822df74f85, 0x3b702f327d68c733, 0x41cfcfcd435a50bd, 0x406f51256d53777b, 0x7dd555ddd542f281, 0x362777fa0c380c7c, 0x5372a15c777aa91f, 0x41b66068b169a8d8
+, 0xd8526ba129235932, 0x30ac296ed4cdbf08, 0xa1baa0a77fb858f5, 0x19399442ec0be517, 0xecc454ae5058216b, 0x00d20e171b83a516, 0xcb47f52b0f75975f, 0x35e6e51d9cad1765, 0x0d7c5161c130ebf8, 0x0da5686175517d0c, 0xd51bc0842c82d74f, 0x3eeea0407d163aab
+, 0x11f5a3266df2e445, 0x5981c96886c5f024, 0x9ed9ba564d64bdf1, 0x029da73545782bf2, 0x8cb5b8e684f75f03, 0x6c4eedf727fc8c1c, 0xf05d83fbe52c90ab, 0x30874faf808e9978, 0x8039aba6a8814d65, 0x5b1ff2e9e4a7d45d, 0x3d091b924ef1563a, 0x176cffa0996e90d0
+, 0x4f6c23777f220d49, 0x2928e73b3594ad26, 0x0a821e06ea9a6b19, 0x33ad0ca8774806e7, 0xa83b252b21064eb0, 0x321009123fde08df, 0x58e85b5dc12bafcc, 0x08c035c475931d48, 0xb3416a1db64d5b9c, 0x4996c608dbf131f5, 0xf2039c7120a5fee2, 0x75416709945f401c
+, 0xf16896ccd59530c9, 0x352d708cf55842aa, 0xaee81dbe0f3c594c, 0x06b40fb3211ca875, 0x1d15fe6a0a1dc47a, 0x0aa3e6b9fdd0a739, 0x01a715c72543bf11, 0x2986b852651bd748, 0xea3e5a214e204a24, 0x628ed0e12ce46dc9, 0x99f0fda8ba54b840, 0x7953c59193054ba0
+, 0x63a42651dbcc2985, 0x651d93e3806afc1f, 0xe0ac16d53cb00f21, 0x450d0672d3938e4c, 0xdda49483fa594646, 0x09521fc144f9608e, 0xf30be7d6198ce85d, 0x4e560dc1e9f5eac0, 0xf297e034fe61a857, 0x4fbf6dbb1112aa69, 0x6a08910538475be3, 0x2642da244370b889
+, 0x12d1947c1684bf8e, 0x517ecedc5455356d, 0x403340d498d373f9, 0x6ead13f3f27d9653, 0x4dce7c6efedc83fe, 0x1dda1fcfbeded016, 0x04df467d4730e1b1, 0x34081a4288597871, 0x320e820737cee67b, 0x75041dba34974b48, 0xb6821fc83c67d010, 0x246a4df6965ad599
+, 0x9f9305d598d6526f, 0x73b17bd89eba4f7c, 0x75698f75b95d19af, 0x65b7bf1048337b35, 0x9e8f4aa6704463c5, 0x7bc37ce0b24cba1f, 0x4c87cdecbe8cff20, 0x0e9a7567719938c1, 0xebb55075f3129428, 0x0740a6b7408ebf54, 0x1f618016f47d348d, 0x25047ca844e5ae9c
+, 0x45b51411f50eda5f, 0x763a5a8a5ff92e1e, 0x41110383979fa0d4, 0x2b83d9f1560cb0bf, 0x73b13ebc5d0f2544, 0x12ba2cf42da715c4, 0xf9a79bbec97a49c5, 0x08e70890b2aa206c, 0xf6ecdfabc2a88745, 0x5c056f125820562f, 0xab895a65d9a9267e, 0x396246380d84c978
+, 0x76089039c4af3456, 0x49ea64ec43121084, 0x06fc9f947be5fcf4, 0x77ccfbec2dfdc406, 0xb535192bcd9a3600, 0x7cb1870f96c70be9, 0xe5449efff60aedba, 0x0e676cbf7e7d3302, 0x58adfa64318e65d8, 0x6b75de5754f337c5, 0xeff2c140b317ea5b, 0x13775e1f3a8ee20b
+, 0xb9c616351e0e47b0, 0x5acf613c46f3c097, 0x72f1845acd02c54f, 0x7051822552f86f78, 0xf087148930d4e70c, 0x5326655835866718, 0xf056f1b2f5af6d14, 0x50742ae8c3d4c61f, 0x47689ea3c568948a, 0x06efdbeeb8ffd7c0, 0xcf992609726f9cb0, 0x238a478f8fe0b7e3
+, 0xbe45d7aff8ef3d38, 0x286462ce317efe2d, 0x5c0e360df0f66380, 0x3c58f1917759f31f, 0x7621c02502aec81c, 0x1b259a51d368ccf5, 0xe377d5625bc3f7b3, 0x0d31d8d9515a6b73, 0xdfd107b2018ed6e0, 0x4146b993ee81f5ac, 0x594440a4b426b1e9, 0x0480cac18fc56074
+, 0x287f9d5ef69e5bfc, 0x37ca4250d15d682c, 0xe2a28260665d3401, 0x1a22122a2e8fd8b3, 0x50b77465b18e930f, 0x6db0de885d5a2e7f, 0x06dfbb7e48935069, 0x467fe9117c4a2b41, 0x62d9c3918808a398, 0x0bd531afb7391e62, 0x99f373cfc3530609, 0x2ce84c1e0d1d764f
+, 0xfb1017264df874e6, 0x609d2807af067306, 0xa912507a396b469a, 0x2352f1244cc4510d, 0x29bae2517015dd36, 0x5c2cbb06eebb2763, 0x4b1eb415c69e628a, 0x2429abf7ad6eec07, 0xd023d18fb5801b61, 0x30f4a1e17554141f, 0x8cee5d698ba70919, 0x7b653f43fda2cf6f
+, 0xaf03c9224816e0b9, 0x1b6df0efbe237397, 0x84261a1d067c6174, 0x67524180b0a7657b, 0xc3e66d431e1fd542, 0x45875830c085966d, 0x6e876ccc751fef71, 0x2ff763e392c831b9, 0x6d165d528ee3c93c, 0x4a48bfc50efdae2f, 0x562522a6560f431d, 0x2c58cef9b9d52dd1
+, 0x6854558d5d7911fc, 0x641c5472c39ed599, 0x88ac0fa44b6252f5, 0x237b07ccdbf1dd85, 0x2ace3796780f5d8f, 0x5a83c7ea834e17b4, 0xf967faa0385d035d, 0x528cc9eaaeb9922f, 0xc0f4fe5e6753f3a5, 0x73a46ddca09a96f0, 0x779673f4238214db, 0x3695183f90c966dc
+, 0x2977647e5d25c59c, 0x0c34d412038d8dba, 0xfc5029ceced74298, 0x2140e1731cd506b3, 0x8cba2227716d12d9, 0x50fac385fad0d22f, 0x61b56053f6c76fe6, 0x180d298e52dc0e0a, 0x46362321533bea49, 0x07a83ee264024c97, 0x9959353dd85f6142, 0x4e6cf89f68aa984d
+, 0x65063737d28fb583, 0x221fad73b2870627, 0xa5c21e76adfda741, 0x198c7a485491b75d, 0xb93a1c925f96f3a0, 0x0a1b845c9f4f3f2b, 0xb1fbd5d66eee5739, 0x6fa2ff3b4bbbde61, 0xa8c5417e5756817d, 0x479aa476f274218b, 0x231d854e525c3fd1, 0x0f4fb0b01935afec
+, 0xe34ee7d1c5589d09, 0x0e9c5600fe7338f4, 0x27f8c820d6163ea2, 0x416cb11f45f39754, 0x5fdbd3caba135a89, 0x013069fedc221fa4, 0x4078f5402cb8ffe2, 0x5f2bb92bd236e136, 0x43aa1181414e95e4, 0x24113fa73f73d4e3, 0xa471cf7f7a51f7e2, 0x7836b21802917a40
+, 0xa391ef0b5b82779f, 0x7506dd4ee82d8e95, 0x237987c27e53d92c, 0x7ed5adfb3af7ef21, 0x4b85678b7a8d3be8, 0x304c0624b0530da8, 0x1442c053250aceb6, 0x12e78491535d3612, 0x1d92471a101f4e74, 0x4d223d618cce5bd0, 0xa87d1ebac4f67e4d, 0x7f419879362f278f
+, 0x5023d314857fd017, 0x5657079183a7ff8c, 0xf9c32ecbb0c7ee45, 0x09a7a0297e31f9cc, 0xd5c71a9863b94fa1, 0x08f1146c2a4fdab6, 0xa0c1b66d4406db1f, 0x3f4fff2212c7560c, 0x5cc2c10922330799, 0x5bf008abecb47640, 0x762ae3754537dbba, 0x26cc284b96efb27a
+, 0x27f7c3d31d29493c, 0x5fe8502a274209b7, 0x8c8fbe258b61f635, 0x3268cd6c98bbcb6f, 0x7922a13b6ba6e054, 0x151af4e9f3b3ce87, 0xc7f23e99d129c02a, 0x0e69043bd880825f, 0x80a3c37fd414c432, 0x1d27d680803bd909, 0x362bde9b413a62a7, 0x4545cceb34a21283
+, 0xe77165bc6df74179, 0x1484c8fda350e87d, 0xbc4eb7dc5b6638bd, 0x370d378c672a06a0, 0xde17f62307f1a5b2, 0x406d9ce47f714c93, 0x68fd159887e57d6d, 0x645ca57b6a38f47b, 0xe1194fd817260dc8, 0x17bcaef4b1c49ded, 0x8afe558479673c23, 0x5f090d9121f711d3
+, 0xa84f208e7abe3f73, 0x68e65f36549d509c, 0x265ac262f234fd65, 0x00a618847f908613, 0xa145528610510102, 0x320dcfa5b824c6e1, 0xbc1a0b81d2767518, 0x0ef963f083a5c79e, 0xbda72887107980e1, 0x1a258831546c41d6, 0x465e646d0e953669, 0x0d0e6f1414d9ccb1
+, 0xa6f50631b4a27c2d, 0x3e02aadd3c144633, 0x0b7bb10583fdab70, 0x1985c6c80826bc7f, 0xdfcf4ab3bd4deec6, 0x231cb8211c00d4bc, 0xa2c4fd7d8a872496, 0x04462f564c07d433, 0x80e654257c830632, 0x397d8cf49c1e60f1, 0xed4afb56b5c5cf83, 0x7f8986a1a6faa3d5
+, 0x817a4670a83fe76e, 0x0ca996f5dd0cc1f9, 0xe44fb6cbbc9f54b9, 0x65320eb380c01303, 0x07d5379262ef8702, 0x349bc20284df57b4, 0x134f05586d7e9d3b, 0x3369e35e4f8f25d1, 0x70ef6a35c8f32557, 0x5e7bc70787af2fba, 0x328e5725a2fc3cca, 0x6e9673b3b0aef0e8
+, 0x7c2a6db5a29c8b82, 0x014b349ccf31fd63, 0x87606c8d2ffe4bcd, 0x51d146eded97e59d, 0x5ed62fbfdea8f365, 0x70a35192f7e81d33, 0x65bb7e9547860fac, 0x3cbfccfa9f69479b, 0xa9e04a3628832ce2, 0x531cd6453a086f86, 0xf7600cd5f0c54267, 0x05c14626945f024a
+, 0xe4dce82b91981bc3, 0x0d3eaa8db60f2667, 0xa03a6e0e8022347a, 0x0154a4cf8163f30e, 0xa7e34698ba8dcfdb, 0x10b7f68d791e2873, 0xc563448e08c0dff4, 0x6a97d1685ab88139, 0x02cb488e8da0c0c0, 0x0d615a2fa5c8f989, 0x8215abe5c7f20bd9, 0x20f8f26016f71224
+, 0xb6c3d3db7cbfebc3, 0x35ff41d0c05ca8d1, 0x28b1ba954cb94ecd, 0x2440116322d7b0d8, 0x94c2f225369b84f9, 0x483918f29ec1ac28, 0xb3be3dcb5ddfd5db, 0x5e30ef9f96e3674f, 0x9dc27a04295bcdbb, 0x790a648fda5e673f, 0xbcb7f974adb72bbd, 0x78fbf995bbe875d6
+, 0x33aad9776d8c3afe, 0x37a965a9a6bbc16f, 0x46b33316c812ef6d, 0x04eab84c2ead4037, 0x67a6e8035d39ec9f, 0x37a6e19599f13b39, 0x8f0426e04a8d979d, 0x102a6fdee7cebcde, 0xd5e32567725cff10, 0x5dc97ab42432a990, 0xf50edbed3225dc83, 0x055466cdafc1cfbe
+, 0xd6739e835e1895b0, 0x2e11033cee31b163, 0x22246ff75bf7cec7, 0x2c7490cb04239323, 0xf05c0cf04c7bc060, 0x3d97a0425afef368, 0x4fa3a640ef86d763, 0x0b730f47db67f737, 0x3a578c8fc0f87595, 0x69ac9fb6713f7298, 0x02dc8c17fee73e61, 0x5dc4f1035e2fe9d1
+, 0x2bd96c1e0850c6f0, 0x50e9df4e56cdff6f, 0x999139d05a6915c6, 0x1278e11e4bdf1aec, 0xb502ad1dc5f090da, 0x0a33e7fb56f6952b, 0x2099541e1a8815b5, 0x43b463afd0a1b89a, 0x280f80ddcada9159, 0x5e1f00c45ea6dae2, 0xbb9538e97347ae3f, 0x0440134cfa1de699
+, 0x466ffb93db909e22, 0x721e103eebc2384b, 0x91b783fec26faa6a, 0x695af9bc2907d549, 0xe49b8bed5634ba2e, 0x212b4e7fb9675078, 0xae22734b89bd3505, 0x50baefebf6fac1d8, 0xf074de9022bf9d04, 0x6185b059c1122c02, 0x8b0ca815351fe2ef, 0x68e80835dbca9e85
+, 0x05c33ff37f195e56, 0x6355e60d6c27c761, 0xfd47d5b2cbb1a2b0, 0x48ff5d5abb350d1b, 0x26fb03d975b0ce4e, 0x3005ff0f95af39c4, 0x8356170984c44df2, 0x63e85a5ed1bec5b2, 0x487c47c5a79d18af, 0x6c62f8b8a5e698dd, 0xbaac3a622cf8ac53, 0x0c6fff9d4acfdde1
+, 0x0d928c8c6c5f5a34, 0x0ffab48839468d34, 0x58008a5dd0118f15, 0x33fe8697847e1c6a, 0x2e3221029f3cd786, 0x25fc5fbe9e876bdd, 0x38887af23fc20221, 0x3cbd971b621fa714, 0xd9c892df9385f591, 0x6ff3f254c06bacb2, 0x7ded88a257fe83a6, 0x6fb06303198d93fa
+, 0x5a5db2a032e036bc, 0x726a05a24584f69e, 0x8864064784b753dc, 0x6a620e79bc724bb6, 0xc2804c590c46ac71, 0x7f0a7849f3aecaf8, 0xfcf479e00a43359b, 0x5308a521315de243, 0xc598529b3591c470, 0x70c2d5aaeb84300a, 0x8003271122c11ff0, 0x790e1a821bc312cd
+, 0xcd1b8902fda76110, 0x7c1fea19c5a13a8b, 0xea303c271fb53854, 0x51894e779cb9fbb3, 0xd9f579296a67191b, 0x2bc5df80000423ff, 0x3d1676f6e9f4f48f, 0x558232c75d82e2b9, 0xd58e67ad6618c9b6, 0x62297eb9f1305ac5, 0x7e2b5165ec7a766d, 0x6815e6220d1b24d7
+, 0x5643e2b2d1aa0a24, 0x588cdcb6d7ee5bd7, 0xd3896904d5840818, 0x34fb1077f0ad872d, 0x23fe2090b6f77cd8, 0x441d9a1c6e699bef, 0x5f2698f19dc10d24, 0x25b71197ce4e81c1, 0x4fc74d30ab26dbe8, 0x663207d5250cc1f6, 0x6daf0be6a3eec863, 0x07ad135694e945f3
+, 0x09b63b65126dda7b, 0x1f8e9606844019df, 0xfb5920a30dd70735, 0x55443ae20c106ab7, 0xc5c09aab77005bb6, 0x0fea735baf56f194, 0xacbe613e492386b7, 0x725a76a1e013f166, 0x11207e778b5d324b, 0x32426ac14ae84d90, 0xa90f5127ee7685e3, 0x352313da1b40b1dd
+, 0x03c35da3066d71f7, 0x7f9fd0dd1e79cbf5, 0x445a2172d2ac6edd, 0x155f36bb0c22f512, 0x5c0459a99c5dda73, 0x09730f5442c3100b, 0x139f3db8b2734842, 0x004c7a737b3f11d6, 0xae2a8e32c64303e7, 0x16421822c8abe121, 0x13f3f0d2664dce93, 0x339112e28fb5eaea
+, 0xbb4a34e05c6e02ca, 0x7e710d9047f72ce8, 0x5a1ca498d70531de, 0x527cb6bd9b6132b3, 0xa109d631617c137d, 0x16299c821bb22aa3, 0xf23a03db1155f5d0, 0x698cb5caa364e5a7, 0x30327ee4f92fc4af, 0x4c261e7c2eb73407, 0xf0f85f3c2ca10988, 0x73e46683989688e9
+, 0x576894ae8f0dc0e6, 0x6d7da13f0c5b4bcf, 0xf87053c72836e932, 0x675915d40ef57e60, 0x5dab4ba3e6a832a8, 0x639622072d8c2bc1, 0x1a3c1fc782d83c0b, 0x6d8fa53dbf3ce1cf, 0x9c73be0f765a0373, 0x1147140501e67fcd, 0x07c2403ddbe15f4e, 0x3d911fdd4c8d4de5
+, 0xf1d3d5d44173764c, 0x52615bd68445018f, 0x7e8e51ab68853357, 0x7eca0f8b5038e9c0, 0xb16bf6f34454ffd2, 0x317f216f656963b8, 0xcb91d0e194103eee, 0x66a68d0af0b697fc, 0x1315ce60f641765d, 0x15359b4321c17c84, 0xc9eeb6a4125c3c19, 0x319be85966ae6ca3
+, 0xb8f1d35a12f720c3, 0x5724ba269786a629, 0x6c0a739eb51a762e, 0x374502514c962135, 0x36529b0c81b139a4, 0x69758f4f566ddabe, 0xe9dfdd609ff883c0, 0x4c07c954de9dd182, 0xdd7b72f19ae07c55, 0x04529c0ed3007495, 0x5f26ed10e78f2902, 0x6557309f37b04fa5
+, 0xaf24bc0d2a7f0212, 0x0ef2b920155aebbf, 0x2af5e859e287b272, 0x4739f5dc0539b234, 0x044a490bdd0c1ba8, 0x22e9c1b70320bf43, 0x25342f93c4da9616, 0x4b131b11d99433c4, 0xc401a2c9e2381cc3, 0x71771e0a4ac52692, 0x845dffcb99cb68cd, 0x1e814a60dfead89b
+, 0xaaf94b004a82d259, 0x445d7280aef996c7, 0x50aafbf9f720ca6d, 0x1241b2afda71ddc5, 0x4257a3b6948b7768, 0x18b477f33d980702, 0x5d8d7c1700c1c580, 0x57d02656faddd741, 0xc585a7191ac6517e, 0x72326422f43d3894, 0xfcbf84c6ac221117, 0x0b7f59f6ba588b27
+, 0xab57b762d8c0fd4c, 0x068f57f10ff79153, 0x4480bd26a614ee53, 0x4c52e8a6b89d52d4, 0x2be857c3d2ea6634, 0x51626c1a77766062, 0x12334a6073c84a4b, 0x42c3308df1e0ad8d, 0xe8f3aa18fb282491, 0x6065c1954416a725, 0x2dfb4440074590e5, 0x6c305670c5330f5d
+, 0xc4f26bd86aa29eaa, 0x068b49acf33c726c, 0xf23f8f66bab1c315, 0x015235c1c6d3c411, 0x922b4c3b6ba6750f, 0x3ab825146f8e04bf, 0xf2a203bb980d6feb, 0x3a3f15786e36c1ad, 0x468849176b90f80e, 0x2821b9695e46a2dd, 0x3ab4ffba148cf938, 0x138c51abde37e593
+, 0x9a01f2ee8ba03f32, 0x64eb32164f9231a7, 0xb055b6a80ab000ae, 0x20884d2d129908e5, 0x76ccc043a6492fa6, 0x1a6303ad58e1a853, 0x09140a16362c1445, 0x7d9d273bf0162b69, 0x07f240eb8d819433, 0x5105f25699bd51ab, 0xb17a0950f000fa92, 0x7fa15764c6f017b8
+, 0x00b590341d1adfc5, 0x38628a24c29594d0, 0xa023e114681bc8d1, 0x713688b902f90bc8, 0xec6fc414f81e1dd4, 0x5f3efbc61360f114, 0x90f9f3bb92325022, 0x68d035c401ab5d1e, 0xcdda94cab5573c1a, 0x2216814b8e5e1e35, 0xf9859daf92366010, 0x65a8c5b45bbad68e
+, 0x757075a649f7e04e, 0x04de79809d99ded6, 0x1f713b4a6abeabd5, 0x786639c5db62f88d, 0x18d157112d223154, 0x1468722e5db77aa6, 0xa919e748246b657a, 0x25c91e52cede09e8, 0x83be85047f683f26, 0x5a0e604d54b64f60, 0x359fb837db75cf59, 0x7d123fe00a6ba1b8
+, 0xc13a3a6e780940df, 0x7c7cfdb528334fb8, 0x28d9b1a693409c49, 0x67f0aa9c92f8b34e, 0xea0ccc1fdb41f838, 0x450bb42d0e148d9d, 0x9c4b4dc2c656f534, 0x06ce2a1ce92966cf, 0xaf2c0e5f1270fe6a, 0x1e9077e0fd90d27d, 0x3ae7c570281dbcd8, 0x2d7b65d83421969b
+, 0x2cce879e1bce1af7, 0x6fdca0a0e08ef39e, 0x8c5d9f4f34438a9e, 0x60100f031b6eb48b, 0xe0f3b4d3e9473ea0, 0x2851b66ad6c4505d, 0x6ce3e7965c4116ac, 0x7a68af63779c2e34, 0xfd4300263085de46, 0x29d0707f32de5693, 0x26458f8c21496561, 0x192397b7dabce7a3
+, 0x4bb6acaf82f29083, 0x421eb4d8e36cb84c, 0xa94c2c4a62254459, 0x4ca60a7136f79778, 0x1e57b12194d35481, 0x0b24fcc7bc2692ca, 0x642d46208a1e3246, 0x6e8274c354e5bd0e, 0x8026464a8e513472, 0x1681f70463a56e8f, 0xeec9458e8fb87023, 0x421e7935da52908c
+, 0xf060664a9e01c724, 0x72740f44f8f8c88e, 0xe56c92ecb568bf0d, 0x3d92d90beb9d8bfe, 0x0acca3cdc0e6d11f, 0x26cadab94ebce8d5, 0x725489d3385b980e, 0x6c207a66023dd71a, 0x1ded0ea903c84ce9, 0x725a6fc5c1e3fdd6, 0xdbcef62831fe13b5, 0x17c259c048c55f63
+, 0x94964a8c5f2809b4, 0x1003ebaf6a7f197b, 0x943007ec94a36276, 0x7eec23b1b0169de4, 0x11ab7fd071faa89f, 0x758572600b770990, 0x8cc3eac1263b7d05, 0x7d1e2fbb30b1408e, 0xd423e33d3946310b, 0x5b697cd93d754c88, 0x20eafb1dc39a6e6c, 0x522c9a4de7dc2dc0
+, 0xd4c1760e64833acf, 0x2b1f859e3b1855a2, 0x45ac17b612dee419, 0x2ec2c89e140e1900, 0xd8fc7d767aab9215, 0x5d96009274a67ef6, 0x7b575ff166693827, 0x3754d23679ed29db, 0xf8fcf50c93223c70, 0x271e729ad1067b8f, 0x32c543dfc310225f, 0x10b42ee79b1b2db8
+, 0x95c1c191f1518d0a, 0x7ebaeebe0af3fae9, 0x01630d0041ab3e9a, 0x588b3b05697f284f, 0xcbdc1f89a3a4cb88, 0x6adde6f7bfcf4b92, 0x0f2f211ff464bbe4, 0x776485f6dc05be6b, 0x25b105a53c3c7a8f, 0x21e75bd6b92b21cf, 0x5f7af83ef35f2e22, 0x6547bbfeb396a2f6
+, 0xd98c6ecefdef8e69, 0x458665d0d7514772, 0x417d441f81b0640c, 0x45cbf01d16a670b5, 0x75405e514a6d108c, 0x3ae052900e6d360c, 0x59f0f346986f3003, 0x5477ac864bec94be, 0xdc7b3a53c5441b04, 0x6d51f6c0eac0a68f, 0x941cb97616f1b8ae, 0x18e93987bfee5236
+, 0xdcbc28f8a56d418d, 0x79408fd8699e6a37, 0xc97223a7de3f408b, 0x55129359dfa8ecdc, 0x386d844a7a056bcc, 0x0da086b930bddb25, 0xbc6fb2b9cc30e9ab, 0x27d503baf3e7658e, 0x3991bafba0c5bfbd, 0x773b1c9b26c43a7b, 0x0e067834c55c711d, 0x51be3f83875aa482
+, 0x6437b305ea81617d, 0x3f1a86f0e148e798, 0x19131a7788478e0d, 0x76da883c28f5544b, 0x890eed728711341b, 0x3bf6c0eab6c754fe, 0xfbe7729b57f4b3b4, 0x036e10a405d50af7, 0x228ca19250ab867c, 0x689b7e0801d7909f, 0xf041cb8979db7fbf, 0x776683d61c0380ce
+, 0xea3a7bce5aff1b6d, 0x6d2429e46469ac47, 0xc9e72759bc7e39f8, 0x444525a7a9fcf02a, 0x9809ebb066bd6b9e, 0x1b860cd0b169d8b9, 0x1555a655993ba60a, 0x32aad87627730754, 0x900c9bac26f55e4e, 0x24474fd8e6f4d716, 0x6781422c623d2f37, 0x5aa4c938a27f8e35
+, 0x7259c286cd2856ca, 0x3ed4f1d4d6288558, 0x5c6a10770d2cd883, 0x6e81e0e6d0fb35c9, 0x12daf6fe2777d092, 0x457493114ddcf8e4, 0xc30d14d5fc7c0136, 0x18294d0592eb88ea, 0x292c64e880924469, 0x743505996a9b1082, 0x72e8e06997491a68, 0x1758d1665cae51ca
+, 0xd0ed7bdb7c541374, 0x020fdd1626db9a74, 0xba656575ad27c288, 0x3e4bd5ee2019712a, 0x5900fafd13576010, 0x21009cdd86f01197, 0x4fb8a2cce4154f88, 0x7230bfa3de8673d6, 0xb557c9b70f5a92e1, 0x582b333fdf483cfa, 0x355507c3285ba5bf, 0x00d14ba6ea0671a1
+, 0x3715514014d92177, 0x08e6cf2d0993b276, 0x5f61daf888f6122d, 0x363b6362644c7007, 0xf55884d4869aeefb, 0x21477e33ed4bf62e, 0xeba19c9c360aa94b, 0x055be34027e51b65, 0x5d2ff8b1a85c8aa3, 0x7e6d47de8804cc67, 0xe44b860c597417fd, 0x627dc013aa50a975
+, 0x04333bec02e5f405, 0x09db58a021cc6719, 0x9e77580ad14b50b0, 0x0b05c8177bf31e23, 0x8678d688d4b3a267, 0x5f68f232f5fcd1e4, 0x1bd84d71837367de, 0x7557fd14017780a5, 0x151d675c5755c374, 0x0a5b316c202638a5, 0xa7a366a8bcf82111, 0x25dba2af8f430b77
+, 0x1bc075f11442ccc1, 0x3cab1eab1efa8fb0, 0xb5f590e47ae2ab58, 0x47ab53bb383e615d, 0xba2df1c63e2fd1de, 0x60d86cc48c34fde3, 0x723cde363562c7ed, 0x367a7ef369275a09, 0xca2b85b4a772ff72, 0x538571423456482e, 0x52154d38406ff4ab, 0x61cea28b9a769bde
+, 0xfd4fb27660380cc5, 0x05f01f189b989868, 0x2edbb9a4c28df530, 0x3199ea82ffb1da49, 0x0a51ff46bc4ddd44, 0x06eca7582fd7009c, 0xe79dea78bc46a28d, 0x74d2651e5039dab9, 0x3a315c981880f39b, 0x7a6f5b4ca7d9af84, 0x02086e2dd79f6176, 0x7d2f2d6bed32a968
+, 0x4e0f54473409ef57, 0x30838e0816a0921e, 0x34e05e6d7cf7acb1, 0x1d30b6e3637394d1, 0x6c2b2ac07cb73683, 0x5c05ca83fffd5902, 0x1829d38d928ca1ca, 0x60d495b917467545, 0x113e2974df6c0eae, 0x1f6521471c7fcb8c, 0x096fbaf900bee224, 0x3d74726d2a839214
+, 0xe185378303e8e834, 0x6f05f76c9e9178d4, 0xb416f6c80010cffb, 0x085b3925a5af01cd, 0x43c84bec71621605, 0x58d5d64b8e17eda0, 0xae879a324e2a8a81, 0x2656cde104f145ca, 0xd4240e60f22e261e, 0x4f138ebdd921873b, 0x28c7e75b815b3ff9, 0x29820161d3781ea7
+, 0xb828855255a2fc34, 0x6b39184606dd517f, 0x01d49519eeb640b2, 0x5f85279b021fef89, 0xc8594d48bca770eb, 0x33a80d45d10e7cdc, 0x1f3c1dc74761cf35, 0x18d9c6b838a1bf3a, 0xfa563e6006317e02, 0x5a9db142817b869a, 0x27b7fcd09efe7f9c, 0x22a287d59a1688e6
+, 0xa52ee196127c498a, 0x43ff59729920f04c, 0x8e8dd362a8a4d9d6, 0x5cdcbbfa4ae12faf, 0x4ce5a0ecafa3725c, 0x005d131c2060faaa, 0xcf2eeed93c8096b7, 0x0fa35c962fbac5ba, 0x89d141feb9ddc169, 0x5247d75dc0f3a520, 0x9f5994886351c45f, 0x1c1fb6f12240a968
+, 0x95e4b29ed220054f, 0x64ebfd3a3411870a, 0x344fd165748eb8e4, 0x3d509f50800b9036, 0x7d3e294eae9440fa, 0x3bd0d50aa59f2e98, 0x42c2043e645c1603, 0x5546d6c45415ee88, 0x09e658aeaa9af414, 0x2254204cfac6e8e6, 0xfa940c08cfc5e522, 0x6c04b19ec2c3bd63
+, 0xa9cd75032472396d, 0x02b2f17a166c7ba0, 0xe03f9c4b8ddf783f, 0x185dced299ce78f4, 0x31cb13df5c1fda3f, 0x1419ca5a9f9344ff, 0xeafb9c4883c70e7a, 0x446a5e6f6671cb3b, 0x927065f568f1c795, 0x5e2d256b8a6246aa, 0xe6d1f3d04f1b3970, 0x2a05ae5b1fd5fa93
+, 0x8f47866fe53fe45e, 0x6c23bbad6e27f99e, 0xbf58b41c825f8060, 0x50be70d22ed257ce, 0x22fc58be000b807a, 0x152cb4291301d7d8, 0x30ef26c7d19add95, 0x1b56528f922a0e04, 0xedda91a8543d6353, 0x029c21f6076a1a2f, 0xe1af54a8c779c78e, 0x74dba51249e08358
+, 0xe4187fee4a7974f8, 0x6663a95cca701e49, 0x229670b134937f94, 0x029f892643c5604c, 0xcb9c9b6dfb0a74ee, 0x1515ac6e8b186335, 0xb6f24fd5e09a0628, 0x5e92a6815a37eff3, 0xe722c3d02460d0e2, 0x2308960f56a173f8, 0xd716c07fe4d7e10a, 0x53db268d1c9515e1
+, 0x8ae94fbbec24089e, 0x48ce330841360808, 0x280c97b4b19776c5, 0x0e7055f1b9945a59, 0x4f88c269f39de34f, 0x765d15a1d1794e5c, 0x8747d71cb1a7bee5, 0x7ce303200cdcdb53, 0x747d9870e4c1e5a4, 0x1c6904c22207c4b4, 0x4429b550b95ab96d, 0x449e80d35444645d
+, 0x113edda66d2852bf, 0x52968be815676ab7, 0xb6d487ce39cab8b7, 0x51e503949d3b37cc, 0xad4f80e4293bb826, 0x43de50e318d4509c, 0x40199ac89ffd53f7, 0x0bdada1d7b949ebc, 0x77ec4407f609ce6d, 0x2716ddea9d767b0d, 0x042897c8d6c6b0e5, 0x21a5f60de4dad6a0
+, 0x36c24f6cec5211e9, 0x39d1b0fe0da77356, 0xb677bed0db9925ee, 0x3287b4fdd5032194, 0x05fbc7a5ff3ae55b, 0x47f48593ba43b830, 0x5724ed314e97c01f, 0x6f209c8af96af49b, 0x5870a0ac1ec4261f, 0x79d682ac63f2d0ad, 0xda1bc771322fa2f4, 0x7553bbb48bc3dade
+, 0x1b83afe34ab3b2aa, 0x1028923f2eebf293, 0x537be71293e36d3c, 0x5025d1ceeb2c42df, 0x86d1b41087d54d7d, 0x679f001bda4cb21f, 0xa67a8f56ae930f3f, 0x4f93212830cafeb8, 0xcb68f6dac71fb173, 0x32844f3f7c4dc85a, 0xed772640fee97347, 0x3427768b4a0b91a3
+, 0x44d6ba03d0cdbd45, 0x7245ed6876d9729d, 0x770f7426820567f4, 0x490108040da090e4, 0x2aa233ef313d38f7, 0x2d69637e40ae3977, 0xe77626b4540d8933, 0x415aac98dee0eae7, 0x0a15417f6e490bc0, 0x79f688c1a93ae6fa, 0x827812bbd283cb85, 0x0eaf9da2f37032d9
+, 0xf2f27f6d42963bd4, 0x4ede10d2165aa1e6, 0xbdbac64bbfdf51b8, 0x353df816b788a51f, 0x7aa00bdfa25a024e, 0x35b26e339bab7d17, 0x8177e59c8a7d242f, 0x45b47d84658a3f49, 0xce17c4ebb4c329b8, 0x266d77605d4d5313, 0x1a5eed11dded3782, 0x1d4062e7982a6b9e
+, 0xfed69545d74ae907, 0x1f65238f67c5325f, 0x293c1b70d8d509a2, 0x76f2d3aa70974dc5, 0xcffd1804ad9310d0, 0x25dda4c12c4519ad, 0xd4b529a45dfe88f6, 0x778860025d470024, 0x84245eb7bf188b61, 0x74e61560dcf6c79d, 0x67933581bc9ea0bb, 0x081a4a6cf221c1b7
+, 0xda9d8938a8ef6923, 0x2272b2913f701a66, 0x72d3290505dea8fb, 0x708b2a3f7c7642b9, 0xdfe659d119d2396e, 0x51431ad4796eda42, 0x8a00606f5ecbbd16, 0x7a7fd9fb0bad1dc9, 0x27c398f6565a1bb6, 0x0c5cbe63692189e5, 0x7680e5dfc0eac446, 0x4bec57415c5c4233
+, 0x1a4e186adc8debc1, 0x7eda5588306b0a23, 0xa9a63d6eeea8d490, 0x7119e99718498bbb, 0x698995d4b3288017, 0x0031dd2e194f5763, 0x4e5d1373a415a8c1, 0x4b660b141c0b611d, 0xf65b5522bc89b31d, 0x558afb8f1565eebf, 0x144dff7a7e4b1a56, 0x7644176eb6fcf9c1
+, 0xa1611cec3c297bb1, 0x48e852c1e580ff96, 0xadfc81d21701a838, 0x41b34ecc0fcfa485, 0x07e6946119aa9d8c, 0x0c9ca345674f6d08, 0x9069ba5b1c1aea91, 0x0251f34f7300872c, 0x47601d09c37014e3, 0x4d866b5802c6239b, 0x34f43a6012bf5af9, 0x1c1201d26748460a
+, 0x35a4999d03aa73fc, 0x64d2ac8fb7010c2a, 0xf4ba4f6529ff902e, 0x551b3e70b0e02bc1, 0xab17175fe4910e9f, 0x0acf3f3649d13aef, 0xa5f47e5fa91a4491, 0x15f4b05cb0e6ce39, 0xf3f1a464f5fd046b, 0x3c0d3a63a9c310e6, 0xec16b7152697b922, 0x1edb95f595b95fb8
+, 0x46a54300da9e58d6, 0x22a75dd8647aaf00, 0xc1961e4bd184b541, 0x18ca383d100b6e8d, 0xb509f63071cc01ea, 0x2ae4dbb6162ac5dd, 0x0b9633ae80c02190, 0x1f1b930c0edbdfb3, 0x0a87bdbb7286811c, 0x263a52c3dd2bfcbe, 0x6da55d8295a342fa, 0x174024e884f980aa
+, 0x65eab7fbdeb9ed81, 0x692ae4412b3c5b46, 0xf889746aba04fed3, 0x214bf46d6b0711ef, 0x2a474927142cf3b6, 0x15b15702e5e2dae6, 0x05b34855283f1362, 0x5d14497c6a48f29a, 0xb3a137d2b72da094, 0x15fe59968776b23b, 0x45d20c3a625adadc, 0x1113cacd83890e24
+, 0xfa1a16788211a6e8, 0x6398cfae7a059542, 0x3fa68f33fe663a95, 0x123ff3058c5c7207, 0x806dc5a238fef55b, 0x1d9cc5b62bf2b16e, 0xfc6995fb33f48060, 0x27f4986c421a8e5d, 0x912eb5f2e3ec8470, 0x3a5784096379f88f, 0xa71aa07bd721db1d, 0x1e08bd9503d28746
+, 0x6e3fceeaddd8e11d, 0x2750096e469a4310, 0x4554251651d917cd, 0x59c33084d7f10b65, 0xc7ae7ec72ebdc455, 0x54a4b8e187e6e90e, 0x1f669e40e439f8ea, 0x02bc6f8cc81e3fa8, 0xb4a0d2d317b1401f, 0x66c27f2674c23d84, 0x3c811d8a6c4e907d, 0x2b863b6a195f38bb
+, 0x3cb1490113e30738, 0x0fddab8bb70806b7, 0xacd8efcab20d6206, 0x217bbcde73cc0c9a, 0x9d3fd0326d0b9b9d, 0x658f65c321fbeb11, 0x806bb5fff3c3bd05, 0x16e62d6fb947c252, 0xc7356cbcd812d10d, 0x048d398aa82ce508, 0x83c948d203d305f8, 0x64ae6a93a9339ac4
+, 0x23584bbd29d28114, 0x25a0a8785f2a8a2c, 0x2a0d44368de473de, 0x390c2a98f2574949, 0x033c2131c505f051, 0x23f45b648fad5907, 0x0c467e96b7402c1e, 0x65bc564794642feb, 0xf798db115f095ace, 0x4bb92388ca5cef67, 0xa95523ac7d2c276b, 0x3b0454b114c46605
+, 0xc5524d8eac5af7dc, 0x4828e984a0dbbab7, 0x3009ead4a5e6f2e7, 0x2176ab4323b9ddce, 0xfd7c02736a37fb08, 0x401a88d3af14f214, 0x9389505052d437d7, 0x4cca26da16a5ba32, 0x7d61ddfc9bd8fb6d, 0x039293b5a33eb21a, 0x09f15404049089c5, 0x2c8067e0f89c4ed2
+, 0xa2e4c25b65c6141c, 0x02cba43b1036aae0, 0x5053b1ed704b9ba5, 0x2c95105c2016528a, 0x64bd71b2763b2b06, 0x3a15f752ffad185a, 0x2fb96c31e2f95c9a, 0x278e66be26abd491, 0xbabeb47d66634f3a, 0x4056d8f7a38ed891, 0xcf8a5895d283a0a3, 0x1c16d099d2a786b9
+, 0xeb1ea3339ee62efe, 0x52df2482c97a2de1, 0xf16b0895b181ca6a, 0x37fe4369bf944473, 0xda3c519c0d5fd7d1, 0x312e40f715882299, 0x1c338d59c7a24bb8, 0x23b9ff9d90364c8e, 0x172de99c970c8940, 0x519826ca8a58c601, 0x7885a0fe5f138dfe, 0x605194b997d713b0
+, 0x39b3b7c1227d3777, 0x2f8a26b22f8e52d9, 0x2419d407197c1b46, 0x43fb51d33291ff81, 0x6eb56b60717ba362, 0x67a21323ed116e28, 0xecc5fc7712b10154, 0x0a96524da6ba24ac, 0x4a2efc6e29c079a9, 0x7a697bd6b8a9f2ec, 0x5cb7751386a3ad59, 0x51ad10fc1286a065
+, 0x93d46f115404af5b, 0x240088ececbd7128, 0x1c3c5f353ebf22da, 0x189e6222cc6dc990, 0x33d6c482c2a74023, 0x6f82efa1ceaca827, 0x4692c91d3d0828a8, 0x7e69482910fef1a2, 0x1f83e38d740f53a3, 0x2ac9c1315d967c4a, 0x94ae598f4a2df551, 0x125052a1cb69804a
+, 0xb4e17c71717d84a9, 0x4c4245bf7be3ff1a, 0xe49d7acc86841f83, 0x26f9f788cfd89c21, 0x1ccf0f2e804cad40, 0x6a28dfbef8e8a576, 0x5f80dc1ee329983e, 0x02addbb3048c5f7e, 0x481450712406a003, 0x7776f1d0631e57e5, 0xdb94d1f5a64ed588, 0x7245b19d4a158ec0
+, 0xe40d57b34997a5e1, 0x6c282551f3de961c, 0x9e41722eb4c176b4, 0x5e82a80619c37abb, 0x6135b927da4c7e3a, 0x7303170b2187684e, 0x9409489ae59bf8a3, 0x34baf0ce9975c517, 0xe37ea7a2e0e73e48, 0x5ff4b611dff9e26e, 0xe031b212651dbebf, 0x5ee9015d15aa9d59
+, 0x0f8164a8d3180ae3, 0x461304498d7958e3, 0xb991cb20ac733dc8, 0x31f92148556e6432, 0x2a227ceff1c6784e, 0x4a52a29b54df4272, 0x38fe2d277cb829ec, 0x3afe59586746262d, 0x0b8368e43903cd35, 0x072bf8ed13ce2f08, 0xd0068eda299de292, 0x7683de4f21b0d6da
+, 0x634b3544778c0577, 0x5d83e1253565d94f, 0xeed33211eb0f29ed, 0x7e74a8d54eb8febb, 0x25d1ebb653ca6782, 0x1b083132feb23c22, 0xce18c99866074b9b, 0x3d3e2266f2ac4723, 0xe8c4eafa888ec454, 0x3f869f8885a3d8c9, 0x5024a082efa605e3, 0x7f02b093ba80cc92
+, 0x291d1431bebed521, 0x390c28d27910bc23, 0xf68af65d3a8bbdb9, 0x497f4f47ba4d1277, 0x9ce589d8efadea60, 0x589623b5bcccf9c5, 0xec8fb4a4ae9a207c, 0x7dd811a94688fa22, 0x497b31458047b473, 0x4dfe0e356cbb4ea8, 0x3c9e4052d25f793b, 0x6420efd3236a0284
+, 0x0e12c58cac7e87f5, 0x65befd106952828f, 0x3cd7de3c020504a3, 0x37a8090905350098, 0x41582ec08eb05a50, 0x48a17a21331603e8, 0xffa92ce7743dd730, 0x6202061ce91b66c4, 0xc3434f9ec66af05e, 0x30922ea8985d6d64, 0x34cd9c83cbb9b029, 0x0ce7e9dd3c7ca6fe
+, 0xff79367f3aa59a80, 0x1b3d87bbd930e0ce, 0x1c50334ca2ae5d54, 0x030d9bae4f60962b, 0x7453d3076ee8b015, 0x24c9bb27087f41ca, 0xbdc832b74b5cdb5d, 0x3b284ae7a29d1924, 0xc419a636c5ffeae1, 0x2876579f041dd088, 0xaaa26690c7de001a, 0x2de3fad94e70c072
+, 0x2d78f81a2a470aac, 0x7cd836abc84af7d1, 0x2336f0308b0bb1b9, 0x35a01c7bc9b27ef2, 0x82a5dd1447b53e3c, 0x2ffdb990497961e8, 0xaff7bb8a3d482d95, 0x4935b419655e957b, 0x9ba9cd7858fd71fd, 0x35957ccba1809a36, 0xee3495b2daeac121, 0x01567425c597a2ce
+, 0x29509881af231e96, 0x6da6ff8d2163326f, 0xb6ffdf370e158e05, 0x1e433355cc6712c7, 0x5e317802e73ba255, 0x4a90decf904af307, 0x5d4d216948a4143c, 0x6e617ed9c8705c9e, 0x92eb01613ae4cf7f, 0x509a0f91ddfaf67a, 0x5c9e31795dd74695, 0x3eb2504422dadc82
+, 0x2a3e0236c98b6342, 0x487b4b50a6f0f9ed, 0x87e3c72ec989eef7, 0x237a239498124aa1, 0x01f3aa1aad667d2b, 0x4c1891545f3ba9f1, 0xb197de9eb0d72142, 0x1f0ff11b2226e2bb, 0x0d850ed688eaf35e, 0x18313a0958c684bf, 0x00734adb13454fa6, 0x349a1431ec04942d
+, 0xcfe423dd300b49bc, 0x0a3f1751b3cd8001, 0x94ffd60b7a9372f2, 0x219c4721c0c15815, 0xb7ed27f0728db531, 0x6cb319644abed811, 0x795adc192f78b7bc, 0x0685b48434a4e286, 0xe80b52a4ceb0fe98, 0x1ede3f6c955bd694, 0x57dd363249feda5b, 0x628b8412af5bbe07
+, 0x2baa624526e16cab, 0x59c50fe7c08570d0, 0x418fee3bd5db9066, 0x5b2a6733737bced9, 0xeeed98c4d4172476, 0x0e3a16899a3aee8a, 0x0efbd22f818135ac, 0x7cc9e7f3733ce0b7, 0x6aa0896ee7feec3a, 0x5d72586fbbb9f134, 0xe7806afaaf2f1850, 0x25a8ebc0cd09171f
+, 0x2145af598d857674, 0x065264b70c1d450d, 0x92090ceca25bc2e7, 0x5c7fd14105306dad, 0xf0b5996792001f66, 0x1c1463b99a564d91, 0x4f39853d9afff40b, 0x23deb0baceada48c, 0xac499105dbf6dd59, 0x216e0677f2b4b263, 0x3ee5827a50b787f6, 0x7306cabc00a55f98
+, 0xcafc5c5880fcd9ae, 0x2af151a83e8fbce5, 0xe1b3f64639bea5a9, 0x23fb43b08dd2f04d, 0xfc190b2044f88fa1, 0x586ca8cafda7f08c, 0xc7e7b66d1010b6ff, 0x75b5afb72bd080b8, 0xc288efe26b3b1586, 0x1344cb100742a2e0, 0xb95fc2cd0b8ebe2c, 0x28c55184932d08ae
+, 0x021a88f4ba74fcb7, 0x212755b82afa991e, 0x581bac749127da74, 0x171662fead4cc60c, 0xea0931653471e255, 0x0d774c143b8cc6b0, 0xf765f7fbc4c6e438, 0x5de37103b0a8f703, 0x1e650578ee3a5219, 0x027244c44986d254, 0x6b5b2739d9597284, 0x498fd1eff3e50a79
+, 0x5f2c955fa2e73251, 0x08fe1a673ccb650c, 0x28928248fd859606, 0x619db6905b229839, 0xd5a62020e343faa5, 0x1f716f967271548c, 0xa8a844a55f81c3cc, 0x2fa7c6737944ca88, 0x165ef69c9cae66b5, 0x01b0ec8044a788e7, 0x30896cdf98463038, 0x4f6925bf8c21d283
+, 0x2c700f899ec18220, 0x565b19b56733a08b, 0xca4435870215ac64, 0x0bbdc885e267df75, 0x7822854457a94bd9, 0x692680a3dcfc611e, 0x7c4bc9ebed149d33, 0x6bf9c9b0ad8102f5, 0x98b4d2f6743e1233, 0x76423dbef729a70c, 0xf03d830c901112b5, 0x408c7b5ddc0530a0
+, 0x9c8a9d8454f24951, 0x6fdb8095c303f8d4, 0xeb52d2bdb1a4b383, 0x46736d47d36d5f81, 0x0dcc53de1052cbcb, 0x1d7ae9b8d7261570, 0x4b93212c50680717, 0x0c6167e065af5497, 0xccf724d28628f8ec, 0x1eb95c704c7e7e6a, 0xea6fdbf79e202383, 0x4a588ad4188e9d41
+, 0x1da71a9779b3146e, 0x4cfb459d0e364637, 0xc3c2c2291e85f12f, 0x5fd87aa5a916a726, 0x66a8fedf4fe0115d, 0x09a8b6b11b3b1567, 0xb68587b60386ee6a, 0x7ed93f5234686401, 0x37fa8a61ddd5b7d0, 0x63ac312d7d3b020c, 0xca88f7fae34c5685, 0x5ca13940109cd991
+, 0x6394b98ed51df546, 0x4b11cefc18e892b5, 0x05de55c8f32be909, 0x3b8ae74084e083b5, 0x91903f36482aaa0d, 0x76641cbd7dc2d71e, 0x555fa8d3e92ca222, 0x147c95eec1ba2afb, 0x0d7784525c115e45, 0x3a29cd05e8cf747e, 0xe8285b556a4da21e, 0x3512f561194d7f0d
+, 0x3115cf6d01a250a9, 0x6f03437a040b854a, 0x69715cde7131eed9, 0x4161039ab044bc6f, 0x70c5a83c026ed9c5, 0x678611cf2197862d, 0xc2ec65a3da693ffe, 0x4c4c6c44db650b5e, 0x8e5f3d74f0c4ccae, 0x2eb7854e587441b8, 0x8ea34da6a84f9391, 0x6b1a247c16c1e102
+, 0xd2f9ea9b2a0a710d, 0x0d67fe3cdf2afd9f, 0x7fc60dbcf7c1c237, 0x675c7692cc6a000e, 0x5cf28d76880d9934, 0x7b4abe4f6af94adc, 0x672da0d7a9bc80c6, 0x254a67a1900e3897, 0x553f1e8d9b782a06, 0x4ac5159075e0b3f4, 0xaf43dea2bc2711a8, 0x71c4bf4f59229c78
+, 0x62bdcc134da2287d, 0x7362454020847c41, 0x75ba73703f5aa2a0, 0x651973c36c76e205, 0x7884d9211433ae58, 0x3dbfd70da595d9e8, 0x02b6ad60a482f8b0, 0x3fa6ba41696b921f, 0x2e34baabb5cf900f, 0x6efa672390a0391c, 0xf5a2b7c06260289c, 0x6a16e34b7d861b8e
+, 0x9471402c91105291, 0x4ae3c7f2971015ad, 0x6671cac6d296116d, 0x5a32aa090302fc0d, 0xaf8e365d7254d698, 0x731d82feb3bd60d8, 0x4c69ba6703e5a5ae, 0x569a2bda79a9ff8d, 0x5cfaf66467505314, 0x3fa871039f1f5e93, 0xed8988684a1ceba8, 0x49efd948d0ee2279
+, 0x4e73d8893f70b711, 0x669675c16eaaeb08, 0x6b0e4996d26672da, 0x5a45cbde9f446b0a, 0xd50f754fcba312fa, 0x4aecea32dd31136b, 0xf23e24feb25ce05e, 0x0ef80e707f31519d, 0x28f7032e3c3125c3, 0x666b8b00d31e97bc, 0xfbf254e9454a6eee, 0x2549bf6577cae7b0
+, 0x6bdf0c455f61b7df, 0x49c370e7c0b0b0a4, 0x0135675efaaa77ca, 0x25e1f5fc99b0f7c2, 0x76c221ab72d63721, 0x51d17309c48fe801, 0x4b06578a6fbb6f7d, 0x51d2437c2dbc295b, 0xb0361821311223c6, 0x2706bcbffc36cb60, 0x5bdb97fc4c200f6c, 0x5fe3410e79fc60d8
+, 0xc445134bcb582761, 0x19ce0b8f0f6cb6f8, 0x8411fc8e45b6bce8, 0x46e314c9f088fc9b, 0x7b678890ca76995a, 0x5694b9d92ce724e4, 0x3bb99c02e5698de7, 0x3c4b4aa671446a65, 0xb8bf1bd236852d7c, 0x2be6063c4c455bd2, 0xacc79ecc90d8e588, 0x1778d335923af199
+, 0x9d797a82901f496d, 0x324ac1e7f695f4b8, 0xf950d92af1544a7b, 0x701d3f933953f2d5, 0xf054ca869623a8f7, 0x7d4b2490a646ddc1, 0xbec1af16e71975db, 0x7ebfe015aa96a280, 0x9bc86ff75000e7e8, 0x0616490667f4a81d, 0x623ba96e7105d89d, 0x3c502dda708146d1
+, 0x27c482eb7e6edb79, 0x2b68e4d1becd327b, 0xc43683f8c8be0996, 0x3f2eb915e7534ab6, 0x928aa50975b59542, 0x1eab843872899356, 0x9abe0c04a5eb6481, 0x08e7ae9b7aa9c9ed, 0x1b4eb71b127e6ba4, 0x7a0bcb6ee5351ed6, 0xf82ac0ba097d4541, 0x61deb7a933725cd7
+, 0x53757bb749796702, 0x409ed7237d620672, 0x4439ee15e5a6a907, 0x6992b6d3c78c5422, 0x55458a1e952ed53a, 0x11c29c8692cf07e1, 0x4d02a73ab4f8d3eb, 0x790f5d10b43acf2f, 0x27c77b4915c356dc, 0x44bc201ead9d65a3, 0x7e520e0d53f08858, 0x2052bba685c1de90
+, 0x30b7f3710ac87c41, 0x2c35e5172f5068a4, 0xe3e25e9aa51ff00b, 0x60461417ac3941d3, 0x500a441f0c8a5bbb, 0x489e21c2eab9f8d6, 0xee64247fed9fa061, 0x7664b57a865ca269, 0x825afa63ce0c0bb7, 0x712baaeb20a82a71, 0x68c759b8848c705f, 0x166c624dc8e040d6
+, 0x51327a0f368aac3a, 0x61b50bb27904affd, 0x51271ffd2338a40a, 0x5cd8096cdbe79364, 0xb9106781fc0293b8, 0x2d54bef101c7a659, 0x8f0f1f26abb636ed, 0x1e717e2666b5851a, 0x69a437c77a185f7b, 0x7b484e974b84f6de, 0xd4cf18c9d59854ad, 0x4d6113ffeebc621d
+, 0x608263ea4e62038f, 0x5b58577c7e86a456, 0xa1a79b7cc09763a8, 0x6cdcf945ff23c20a, 0x69114206fd0339a4, 0x4587d89d3e92d69b, 0xb1ee6fee25b17fe8, 0x32c74c0c6f55a4d1, 0x34eae49b771c9699, 0x732786ff551a3a4d, 0xfdf8a6106832d8ae, 0x501740c74b385848
+, 0xbeef6f009ac0ceba, 0x0209dee84a993d76, 0x88947a987687f424, 0x4d06095930ba80a7, 0x7f9ef125432f9e4e, 0x0c7c9b996cd06b1d, 0x8c9af4c8de5dad46, 0x1d33eb195a52677f, 0x90891bdb0c739b8c, 0x466d9360c6b4287e, 0x9499280a7856fd7a, 0x228b35fcbf6aca74
+, 0x99da21a2b8f3cddc, 0x545486191b4a6957, 0x5244b9629dad2cc8, 0x47e183602c7d0b92, 0x178365bd2dd8f7ef, 0x0c5bac3da82f2f0e, 0x4ac84a6ff456ed58, 0x6114917a9f17312b, 0xd6d5b4936d25329e, 0x47e1c331c2132858, 0x4f43dfee0e44fd4c, 0x29714d83675ea294
+, 0x56c60d77ec20910e, 0x467f7e63f5f1ef41, 0xdc9825936147d954, 0x48e98618d0d99c9f, 0xdb0333e4205ebf38, 0x0b060a25ca23db84, 0x0b087374f95ffe89, 0x0abd05e7089d01bd, 0x7cbf3cfe0d076b6b, 0x0507697d10aff3f8, 0x5d5155d9cb0f25dd, 0x7f8403c948c96088
+, 0x046acfcdb84053f2, 0x3a09880c024980bb, 0xf49f3a7deefc5053, 0x3a0fcaf4ac50de2f, 0xaaafbf35b336b438, 0x329adffca330e095, 0x9c853b649a415073, 0x059e5d16abc4620a, 0xbb1dd0fb64649d1a, 0x6c8da2d461bc20c9, 0x86de07aeedd96cc0, 0x25624b4f016a0173
+, 0xb9de7b160fd30afe, 0x5797917974c78bf2, 0x5d7856058ff41a48, 0x7f2fd859cdd6a43e, 0xc780ec7734800127, 0x46b94d5dc30c3531, 0xd6c2395b0adf6bbb, 0x526f907d420c70e2, 0x4a4a0b0f07daa706, 0x7c4ce0e3a464e1df, 0x202abd5c58e02760, 0x2ffa7edccf379138
+, 0x9e9e44b761c5e1f1, 0x4e6aacef7856cc2a, 0x34a59c8f52f4d5b9, 0x47bd381e5df95df2, 0xe74e4b83137d9fb1, 0x5e137c752b5d2024, 0x8edf8c71d86cebea, 0x31cc055a524a959f, 0xd063dbb781e82d34, 0x1e72a1bd7e882be6, 0xe7c906e47fe7e9ff, 0x56ddc039293562a3
+, 0x73b31d3fe5019adf, 0x71d524311748023d, 0xb34a1385fba9292c, 0x0cfba0ab09703613, 0x277bfe6a281261d3, 0x3d35d0b708efb790, 0x7ad77013a76f7238, 0x0ba47296c1a65c37, 0x045eb313fc361e77, 0x4dc150f40fba010b, 0xa4532b4e5a1d4b4a, 0x56b2d5d8bf226c02
+, 0x7314e6b112f0d4d6, 0x417fee7f79097284, 0x85c9db92248079da, 0x578f2a5bc50cc60d, 0x66322cbca351b849, 0x1159c632d4d21530, 0x0b53d79e9feed2d4, 0x16859ee7b3473f55, 0xb53c60b61e93f672, 0x1f458ed31a3287f3, 0x9bc2fbdef872f081, 0x24b352f6f33fa3a2
+, 0xbe23e48ea943e073, 0x6703049cf0621f5b, 0x878dead9bfa04a18, 0x3f4ba0d10f0be37c, 0x0adf28b086b70217, 0x5f6932c2aeabbffe, 0x6d85dddbc0c99d9d, 0x4af1bd6e56c3823a, 0x273ed23b18979c6f, 0x014b6c40e925138e, 0xb24572d79d345c6a, 0x7ae76fd172b59a74
+, 0x7b1ec8b9294d818a, 0x0291a4fe5962c97c, 0x8ae46e4e12908ace, 0x11fdb91bf802c574, 0x83af6dcd6af9174d, 0x356c8c41d00951f9, 0xe2d1b26c239cb900, 0x4e28e7e69ad4bd4a, 0x4a56d6867a5c9520, 0x4ecae1d16384fb81, 0x59b461dd2fada26b, 0x2b0a3ade9e12495b
+, 0x5c85f88ccb7443fa, 0x0da75f5d64d864ac, 0x295ff44871b0fb84, 0x1b79e10bad3336c3, 0xffdf9942dd2977b3, 0x4c1b198d0f9a1a23, 0xba778a24c112864e, 0x74f66897f26d48d0, 0x3fd5c06e867ab611, 0x4b98ce33ff7878b9, 0xf7db4dce75cb9165, 0x11665aa099ec5163
+, 0xa35f548442c467c3, 0x74d626dc845b03ca, 0xd2fc01514cb7e267, 0x3aec9d52f2dca15c, 0x565022786aa87ff2, 0x328efb8a2229bf5c, 0x68b71b30b9cb9c7f, 0x0ee1fb3e38755cb7, 0xd019bcea41ba77f0, 0x37afa6fdbf5284fd, 0xbd40b81aab73b49d, 0x448feefffe3c5435
+, 0x7aa8912850b13aac, 0x77cee5e92237b6a8, 0xca52ef6387904956, 0x1794e6eec57d90a5, 0xc0a9aff2da4515d6, 0x5836c3309e92f884, 0x2619ee2f6aa3e800, 0x2ece80ddaee7cdf0, 0x46171ac4a4efd373, 0x3e1ff5f8a83c4860, 0x26875d17a8420283, 0x24b1c1bbc2dca22a
+, 0x171d435468f1fb2a, 0x424fcfd1d80d453f, 0xb78ccebb5df622e6, 0x0295f3a8edea9c7c, 0x57a2be4d833c6dca, 0x30949b67d316930e, 0x1129f8d242845674, 0x50b933359453809e, 0x46fa18dcfa000bc5, 0x766701172c441398, 0xb2bbd0941198d05e, 0x201be0c32c58d3be
+, 0x76d6aefcd439c187, 0x28c0bfe26a5dab51, 0xf50e18f091bab756, 0x45b2f2e377bb065b, 0x4478b5bd9119da1d, 0x526b7d066b39e35d, 0x201408c97f42fdc2, 0x0c060e7e75045dc9, 0x1217ce602b9d4474, 0x19fd6ba642467db0, 0xce63b0dae541a76b, 0x37f4d4cf7f5e2d72
+, 0x75fd189906a98672, 0x0e0613f36d26ded4, 0xa17ecc59c48c0a32, 0x246ced78e6b20146, 0x7d5fdb479c8183c9, 0x486e1e9b6dade7b5, 0x45dfd1f58f089490, 0x7a90a2709b15ba34, 0xca09c09264130d54, 0x5c2e83c8e5149c23, 0x46a9f704234805c3, 0x444ee38cf1abf614
+, 0x6af0c63496b9c9e7, 0x0352714dd3568f7d, 0xa788226abdd19e04, 0x69ebd8f7a1b85309, 0x949ee9faa563994f, 0x73eacadc1a0c90f2, 0x90bb91e269c6b021, 0x5ff4c8949eb2b662, 0x3088add6b04ccd02, 0x7d40430628872cdc, 0x9fb72849b6dcf8a7, 0x32bf84968a13edb8
+, 0xc08f7351e8c95147, 0x0ead769f09a73038, 0xb9c6de93a6d7d241, 0x1200905703096eed, 0x2da519791f882295, 0x69b664eea2d90ac4, 0xfb7aa9b99acfcb1f, 0x2657cda7e09b2d6a, 0x87b56ef144f82429, 0x47a499881f129ce9, 0x4200bc5b6b486726, 0x55256cefb636e755
+, 0x74e1c64e42d51c00, 0x3ddb20cd600b5d4b, 0x3b23dcdbeec380b4, 0x6c03154ba996680c, 0x44c17ce71c618a5a, 0x0b9aba7dc7f52be8, 0xdb6e73334ed8ac29, 0x07475d114a2e76f4, 0x3632367d5a15818f, 0x61593add628a2cca, 0x1b595031798041a2, 0x4c20955e4741ec05
+, 0xf787c18fd28d0681, 0x2919e645f8bc3178, 0x8bf8ee79f1a443f3, 0x0f8c3d264daeee34, 0x88f6e19ec89a2de4, 0x781f217e6545b0cc, 0x6ce21a99494cc0d5, 0x4c3c759bcbdeae17, 0x32c2bc9215076531, 0x783e2765abd21e3e, 0x38ad9b1f9d0bc59c, 0x3dd11502d88d0d56
+, 0xc3d52910ef0841d3, 0x6f1543d81598a1dd, 0x01e8517cf146a0fb, 0x32bc134ba21f9d80, 0x6f37c7a63591bf85, 0x24cdf63c66fcdd29, 0xc0e6e7f852df958e, 0x17c41cd9f3d1bd0b, 0x6564a91ea3697847, 0x513b1b11f716b646, 0x20caf5d07831b977, 0x3f300ee7b90fb636
+, 0x0d9e66354ba501bf, 0x29a73cd332002c3a, 0xd0c7e253d20930d7, 0x76c8255cad72744f, 0xfb46cb65741ce5b9, 0x6b4c30fa8055c336, 0xf7538079c04155f7, 0x43bb8779469ee2a2, 0x5242088456f2d73e, 0x491e99cb72bb862b, 0x62c57491cd8cb5be, 0x7c167f08d64007c6
+, 0x83ada1515ae11f1b, 0x27aa5e4830d0a2ae, 0x22b55e024d4c6c95, 0x025a8babf3cb69d4, 0x77c3383e3ffb0e42, 0x605190ef30209146, 0xb63d4ffb47fe5b89, 0x714d81394478897b, 0xe79fb3b109deee12, 0x622793fcdee3c18a, 0x514ddf15f1204083, 0x41a9dba446afe0e9
+, 0x1b68ebb685070acb, 0x56e4953b8af4821d, 0x12c11f4799462dcd, 0x398edcbce7c78cab, 0xef4dde79d82bf659, 0x44b704ecc43c82ac, 0xf2da42957f40070a, 0x13c0ea4bfea36b09, 0x4bc0d8a400633c45, 0x6e6a0cc1fba545ae, 0x84cf240362f052a6, 0x493e87e027a2987e
+, 0x68f450adf3ce7e89, 0x4eb44218cb745322, 0x133eda792887f50b, 0x49621d75272a9498, 0x8f2d36b9aee3c06c, 0x53da65d58bf44364, 0x6e32ef16781546aa, 0x29fbdb4c0336c180, 0xa90e9d4e6d136ca2, 0x224714fb9ffed665, 0x49c75c8d9ff6f608, 0x44a9c1bec5b62a1d
+, 0x92e26fcb5d9a6fa9, 0x64cb324d7138598f, 0xd5c09abc99b6f72f, 0x2f15080360d12516, 0xa16e59d42cc2b605, 0x59f10c3c233ecdde, 0xb81449831be54fef, 0x67e92f5383c95149, 0xd0ffadc8f1383345, 0x73f9b3061817dbbe, 0xa17125d15c8de85c, 0x46019fc3d7f98206
+, 0x194c2cd3f4509e4c, 0x2d46c8d3fdd853e5, 0x3e30c5d8dd926f22, 0x2f99ddc61094b0cc, 0x675892c84fd40fb3, 0x2bfba2a8bb22d6c3, 0xc4c5a2cb07237f90, 0x235572181774c86f, 0x796d8402be22daf2, 0x2764015a908f061d, 0x9fc995e54b7f83ac, 0x7cd5b08bb6fe6490
+, 0x5e908d2971c16ae0, 0x1d72bc94c98799c8, 0x2e0efef9d6ff0c86, 0x16a77b67ec944ad2, 0xac617a50eded3b20, 0x2c82bc6a5f9c66b8, 0x1d524f68bc6a8e70, 0x00f7014c1ca89bd7, 0x04b5412f761f4941, 0x100cc04f01523d7c, 0x3929ff512dfd7d04, 0x462abfe28d7e97ba
+, 0x56b50b682b1c14c4, 0x4f29b50824af2908, 0x76df14275d288379, 0x532c344854d1ed31, 0xc2cc47e0ce188b12, 0x2ad2345ae840fe72, 0xdc497aff91e09b59, 0x0975016215d88543, 0x2fe80ac9c9c79ae5, 0x346bc0e9250085e0, 0x80202105c0ccca3c, 0x532a21b048608bab
+, 0x9f8a0a8159787e04, 0x1d5deac14eb70f8f, 0x2531bdc19da978f7, 0x46e9e64bed493c38, 0xba5eb78c9705ddc1, 0x4c40777bd21ec7a8, 0x196f98c2e9c1d16b, 0x6b376a80238cb444, 0x2e9e8a8faa54136e, 0x2b20b26fa89def00, 0xf80cefae45483a46, 0x006dfe97b0077728
+, 0xa7010f7db79b4a6a, 0x632f9c96c934d9d2, 0x514f331fb762a8b4, 0x70103de82e16c626, 0x1f59bd069a298e68, 0x65ce819387cc9c26, 0x815e8189517fe8ab, 0x2129b8e7cf8fb9b0, 0x3b244aea5ccdee04, 0x1548d41e36f4f15b, 0xca5f370dc859b0a7, 0x0c85ac3899d2d481
+, 0x5b31b76fcc89eeac, 0x69b47d806b81648e, 0xccbd3dca8f65bd02, 0x576ad9374c5d0f0c, 0x20f27735da121750, 0x5ed83ff3da1d0bf6, 0x6c3c8759599016b9, 0x1c7b3730615d5e8e, 0xe3dc1725ad7562cb, 0x2c88a282c46010d1, 0x7f4afdaee3bd4738, 0x7002c10864984c07
+, 0x1192e20bdf982b7c, 0x2dfcb1fef6af4838, 0xaa10bc1933f87c16, 0x784496e0dde146de, 0xfdf99381468bf72e, 0x3bfd8fb2c2ade821, 0x7ed2652d45facd2a, 0x0f5619b936ae2f65, 0xeed0ef4d46b226de, 0x7a222e7413f2cd68, 0xf3549e2e9f4ea46b, 0x6a16fff0a9359c5e
+, 0x44a916190c72a720, 0x763306cc6a93f3d4, 0xdf67974a85f4eb4b, 0x5ed4843746957f39, 0xfcd5181142dda770, 0x2834ae8dce4040ae, 0xecc405786a6d0880, 0x3af38ae75053c374, 0xc5fc1e589ea12902, 0x7352d2c68a10176c, 0x3f6e92d3288e23b5, 0x50d666003dff2061
+, 0x6a07afa61b83b3b7, 0x2c1b944e4df4190c, 0x9a4a7b85122b2c24, 0x21042c4d648527ea, 0x071ee1e6dcf7c0f6, 0x7ccfc5aed4c01932, 0x0417431d7326ffc7, 0x02d064053a906dda, 0xb001fac71711a39d, 0x0f1d538396fc1c0c, 0xfae010fccf7c79a6, 0x106b5ac4d50312b5
+, 0x463062565fc3de77, 0x1942612b2e94babd, 0xaed286b8ded59434, 0x3eefff028cce05b4, 0x05c7bda0e60c2225, 0x6b4040564a2b99dd, 0xeaf9a11f83f10886, 0x223cb2d07f27bea1, 0x052d33e8a411d7f3, 0x1f32cdbfafb0e286, 0xd6d83d50d75cb142, 0x59799d88f3ca81a2
+, 0x50617c7ad58d24e8, 0x3d017ee3fdf2a235, 0xc74a8ab3bd0ceeee, 0x442acda70ac2641f, 0xe0d2b38edd759ab6, 0x7c470dee5caa09bd, 0xd198a08f2cb72a73, 0x541a90374ce48e2f, 0xa708bdbaf7995a40, 0x260072ea0dbad79b, 0xde4c579569b7d436, 0x43e410f8d30b469c
+, 0x740b6d614e1321ce, 0x545f21219be08bc7, 0x51bb71811de60124, 0x0fd1d7b2199ef6c3, 0xbbffa70b2f229bcd, 0x6e8f4d34dcaa5802, 0x54c69f1c1ac94b02, 0x5e7154be18b1bdc2, 0xc8a29b58d02f0669, 0x39d873bb0c17f119, 0x793b2ab296688dfb, 0x64ab9ce6ca10c330
+, 0x0d26860d10a180dd, 0x6f317803b87f09c4, 0x754737b7a5176e47, 0x1cee06765839f2b7, 0x0b56fda5f1c3c882, 0x749776d495d1ef4e, 0xbec083453cdc4c6b, 0x1c05429b3e574745, 0x7691ebb2c92b2cff, 0x3a5de72e5b56938b, 0xeb25c01243688cb8, 0x426ff4c1f3f4f9b4
+, 0xeac5f4666c205c8e, 0x7f7c846a8d873efb, 0x6db401c5e8c391a3, 0x7170c1a3b54a259a, 0xfbae786b47761f88, 0x21eb7b74b57decaa, 0x03c9a3b42c28ddc9, 0x1b0d67d1462b0ee8, 0x066ef049e7c213e3, 0x52fb0fc3d73d4646, 0xba109bb546ac0db9, 0x4ea7fc1966a39e74
+, 0x985b31528e9cdf40, 0x163fed5f872b8f0c, 0xd5e5238e6f16bc3f, 0x3340714c6fb4fd32, 0xcf0abfd4ededbda0, 0x1f2ea0b0cc5d937b, 0x98118a59a106b1d7, 0x727025e00c1e07c1, 0x69ef78cb5c4ec88c, 0x6bbfc6217d406bd3, 0xdb8480e292c1b9b7, 0x431050f1c5703057
+, 0x12ad71fe4301e6ad, 0x25f0a30a76ae8e0e, 0x822492c2b31d6762, 0x5936df84e16d7198, 0xfe59cab807e1deac, 0x0ad7c6d5c6abc250, 0x94304ab06ee586d9, 0x7aaa8d5620d72a01, 0xab91d692e7d26ec5, 0x722ed35a1106d8f4, 0xe8ee0ff7077f8abc, 0x0093a674ad769dc2
+, 0x90337060f1457334, 0x3052de977b25c99d, 0x8e553f226d05f615, 0x3ae6f7d325a72e71, 0x66c37bcd26e8ea2d, 0x6de5483098e6dc59, 0x00ca963f64ede966, 0x52c86580c6fcae53, 0x89acc4bb58f7cc1b, 0x3351fce47d5eb1ed, 0xe493ef297b91ceb1, 0x5e9eaeefcd035ccc
+, 0x4873c79ea22733db, 0x1845b5146cae967f, 0x877ef073a36a9232, 0x1e5ec771d0d04b65, 0xbebcfd5dc5e66783, 0x3ddece1bc87d8194, 0x519a118696c15eb5, 0x79f5390d21d7e013, 0xcbd0995a7140120d, 0x3609448f79556a3b, 0x4ca1753faed1e1a6, 0x6044e92be947d86a
+, 0xf9b44cda3a010aa3, 0x5d9dbbff3eed28d7, 0x0ab577cc9679ab62, 0x7f03afd42ef44769, 0x08bb4aeedbfa649e, 0x1093d677bb8706b4, 0xd899e411b93ebaf2, 0x1e0a6da9c94463d2, 0x57beb60150f5533e, 0x0ff4ccc1d628bbb5, 0xe9da963c2db86982, 0x1660e85c6d30e272
+, 0x4bb0be7489119efa, 0x7ac7f94c81de08e2, 0xda4a06f1ecad4873, 0x451402a5885ad2de, 0xf354f9eb1aa0a798, 0x0266ae8b7130d1af, 0xe5a69d674b6feb90, 0x17365b43347565a3, 0xd8d8856841fa368c, 0x6b7b3758a4f91bd7, 0xe85402873d4ca3d1, 0x218b02a921dcaade
+, 0x2166a1ef618d7876, 0x6593283b2f3f3425, 0x6f8551b810dc8b44, 0x3e8a73275abc85a6, 0x17ccecf6548b98ee, 0x7a9c9e235a52a83b, 0xd2e56f5d80136c40, 0x20634fb695648362, 0x5c31571cced4b985, 0x6d3914dc7d122268, 0x25fe2dada144bad5, 0x3d3de7cf2b7e287f
+, 0x5c10f8afcb7abc94, 0x6756295bd7335015, 0xac25c633e64066eb, 0x2c077d1946469636, 0x055a51b322d494d1, 0x613ac820d9e6b4dc, 0xe6410c7ee1d17c5b, 0x5a37eaf85a048d53, 0xc847ed452ed1ccf8, 0x5766f1ab78218d5c, 0xf247b2ac0cecb2e8, 0x7de78e9b7edab2fe
+, 0xdfefffe71af602cd, 0x11eaecf27e2709cd, 0xa140bd2995fb31e4, 0x4177c647280e40c8, 0x8c4bdc144559ab33, 0x00660d2e75881d5b, 0x7047505980884c32, 0x101d1fee05876343, 0x7e57075ef97b0632, 0x3e20b7b8343ddfb1, 0xcbc97d718b9d8591, 0x53564363db73754e
+, 0x6c0a64a5a5b67e38, 0x1cc9053417c461a7, 0x0ee36f0208c1cae4, 0x39fa4141dc0370e2, 0xc55699687a867f31, 0x6b23b0481c9784c8, 0x170ee9d90d49e576, 0x163bb8304b15a84e, 0x9b92c2c77ee5066d, 0x33fc4d26ce87c34f, 0x9666b23b655d8b0b, 0x244e31384332beb8
+, 0x11ae7d92e87adca4, 0x4d3bae74b51c599b, 0x2e3699518fc0e545, 0x0e6b64b0da6b3ec2, 0xabcd684d398e7060, 0x498a79d180046559, 0x41905aec1d7100e3, 0x1caa9e8f3821d95a, 0xf46f301f6a107e78, 0x64efbff5a4d09d02, 0x4c51763b43e265d1, 0x1a0c12de7bf980d0
+, 0xaf38841888634fc5, 0x6b7c15543d27a677, 0x4a6a713060872083, 0x19711f38c2cb4ae9, 0x714c145d996ae0bd, 0x2e797f5f8b7f4b92, 0xafcd615396e507f8, 0x4da318f3a4e97d81, 0xc04537168f75f903, 0x1da15f599f428767, 0xe7f37380d38b6a4e, 0x04507d166ca15537
+, 0xefc4a9043d3f6d15, 0x3a18a551dd7f0d38, 0x6d2777091869bbd5, 0x3a97359e4a123265, 0x1c2c2b83a7bcd68e, 0x4818d98afb57de64, 0xe1fe2ed05df3eb55, 0x4bfc0de1ab36687d, 0x31593aa1757d7a9f, 0x3098e39d2a75d11d, 0xcb7e851bcf29a110, 0x286079b80637bafa
+, 0x7dd404b090076ad2, 0x4893718484dc2b07, 0x503aef62bdb9c13e, 0x5629a3c2af7a0135, 0xa578ba8883de18c5, 0x1a34f7d531809981, 0x6237a3a91c95a9b6, 0x1232da5d57a4c362, 0xd6e7befa1c268e42, 0x086954130ea18ab1, 0xc544da7e54d91042, 0x228148f17b0a9679
+, 0x754e44d85f6a6406, 0x63023bdde44ced74, 0x6e2855c1663408c0, 0x1d20e0fd345616a4, 0x0d776fbb0da70672, 0x30640688168121e7, 0x5fbfa8474e46a284, 0x51f57191dc7fe1ee, 0x180ca55fd9b83859, 0x088b2316772b27e3, 0xdf122349f4595be6, 0x73a3c8f3f919f2c3
+, 0xb5843115e23673e3, 0x1b9faa0be3ad51aa, 0x4218ff09279d55f0, 0x77be7ec6e52d3a83, 0x581fd46c0bc214dc, 0x4175efb81cdb8084, 0xea756e7a7704021a, 0x09962b8df83b9073, 0x3d36ec3a207e6533, 0x120901dec44209f1, 0xa5e2892f6f3bd1a5, 0x161bd827d16bd6f1
+, 0x868cedaf5f2f89f7, 0x7e29aafc3f03b891, 0xcb03fae642cac506, 0x77469b445a9a70ee, 0xd99888318f3fff59, 0x3b4dbc03614f1e8f, 0xd4a76b194f747a57, 0x1b64428bd508f1d3, 0x95dc513f0d360fd2, 0x0bba5e7b41b93906, 0xbfdf53962713febb, 0x3a276d1fcc2c13f5
+, 0x6082d5d44656d97d, 0x07dd65d698bdae4e, 0xbb8c437f78434ee2, 0x06c84afb36a571f6, 0xcf8a09b050f44a2a, 0x1b54dd32edfcd970, 0xdeb25617500e288b, 0x4c5a17492818d0ca, 0x7b39a4cf674c07be, 0x4cc800519eed7ed4, 0xeefc6b7c444c047f, 0x7ecc785f8e1f16b9
+, 0xcaf6cef79979d7d5, 0x59e5cde439c4cb13, 0x00a65488c854e15e, 0x286870ba28f3f46c, 0x003cdc64849772b1, 0x6f9cbf5cbf32c008, 0x153f3c463c8d041c, 0x61f8c419ca0b23e5, 0x45af6651f824b5ea, 0x6359060e7ee3c5f6, 0xd4a78bcaf56ea80b, 0x314d9b51154b6a0b
+, 0x84ffa20327a8be46, 0x69219000f730b358, 0xcc6c8bfcfa2c732b, 0x6592d9bd63b4ca17, 0x9a7750f93ee4b1f7, 0x6ceb31423e3d0193, 0xcbb33dc0a5924929, 0x30a2c5d42fd22cee, 0x828ccb47e6bca5b9, 0x2d5c91faa387c4a7, 0x8e112994431896fd, 0x4d60f566595bab20
+, 0xd01494ce21783c62, 0x181ad6c069634d49, 0x6a78e012ddb7b0a6, 0x0309f2663fbcae87, 0x38896b08e1647995, 0x6894bee70befa90a, 0x2a3f83b4ef17d221, 0x7821172ef5007cca, 0x36761602473ca40b, 0x1ad570cbf6093dea, 0x9a6d5dd8cc114262, 0x622be92079b8ab0c
+, 0xd003a87c343b396f, 0x036eedcaef2a05ed, 0x9ffef2f1ab16f03b, 0x1265245056a69a11, 0xd6b7a3e726abb69f, 0x5f89ccd9209e318b, 0xa5b9f6c8482037f2, 0x485c92f010993019, 0xbabfcc7fe6eaae29, 0x54b32f4b4bbc398f, 0x8b5b6d7b42878e05, 0x489f3f58d75f4104
+, 0x4c4551b5ddc155a8, 0x1ef5e72526eb0aa8, 0xa8223e0d7092e52e, 0x4736668c73335952, 0xcfd9f3caf28df6bb, 0x78d922c36bbeb4aa, 0x8b10d32d51eb7712, 0x291280efddf5a4f9, 0x996d8922af033a72, 0x783abf419807fdc8, 0x59887ea2f7d9c537, 0x61e585f0aea00993
+, 0x00f120bbcb1ea01a, 0x14de2e7b566c3e6c, 0x20b8d45d87924ecd, 0x15c36fc7803dadd6, 0x3da1719217fd8688, 0x223e7aed880778dc, 0x50d0e8ad3140f6e5, 0x62bf25ee6198c581, 0x79d3228ff233e7b6, 0x6ccb76b1d18c78c3, 0x9a3d01f113a7d01f, 0x5a436d5f7c6ef8fd
+, 0xad0a4ca72e021a0d, 0x06d8763fda045a96, 0xbea734463e38fe92, 0x5f807b878b64e4af, 0x7623320e4f39042e, 0x4ff3bbd40a79a4f3, 0x0f877e67ff1498d5, 0x5e09517168368f0c, 0xe9973b6833705fa5, 0x6fabbdb3631e0cc7, 0x4a398a56531bd66e, 0x3c75b77d128fbb5a
+, 0x36258006d95c4d15, 0x59966fced5e4aaad, 0xc63df5b3ab6be424, 0x58337d888b7230bc, 0x2449ccab138d0013, 0x4a8f0826f46a073d, 0x97505dfd9f32fced, 0x2ff855b78e542df0, 0xf303a8e6893f5afc, 0x5366af9c931b8895, 0x08aa0971e27122ec, 0x1ee33ba18b413895
+, 0x5d84406a0e064ec4, 0x40d2754eaeea45b1, 0x04a692649df8f4c8, 0x6da774af436e6277, 0xbd771c20ba5719fd, 0x248804b815683339, 0xf942abb7cfe234e9, 0x6005589f7d8126b0, 0xebd4559f0690502a, 0x7f008310d4b04e1a, 0x9fc52dc7c161743a, 0x7cdc200a70aa7141
+, 0x283b86899e412974, 0x7e12c905de5ffd47, 0xcd30eaa9c9c93b5c, 0x33fa5fe71b73b2d3, 0xbb265ebf52437c5c, 0x7a44f89242037407, 0x109571d50f084fed, 0x0780e2d8678ad32a, 0x8439792545e6f3ee, 0x4df9467a18a4abde, 0x64e69f3eeec1cb3a, 0x5944cf4d900f2410
+, 0xdd51321ec0f54877, 0x2a115b346ae1cbf6, 0xcf2878802c0dcfd9, 0x316ed5cad89b0acb, 0x3c9221ce9032a8c9, 0x788c30f665512674, 0x3a430620be9969f9, 0x6f6e623dd25a5334, 0x82052286fc67eb58, 0x76572adc332679a1, 0x7e6a8d673f50ca94, 0x6854c456f7fec117
+, 0x8dac9956a404e4fe, 0x292928ae14ced210, 0x81a0b234c435308b, 0x2670543ab36fa5a2, 0x2ad000d434c159c2, 0x7ee157a11272fd2b, 0xac8aa368600b08f8, 0x1c3481edbdd329d6, 0x48c872d713f3ed5f, 0x66f73e3c1d515dda, 0xe73bf89c1d0c454c, 0x27257f41f83ed77d
+, 0x4a6919c5f2b62666, 0x53efc912b492e814, 0x136eca1de1239322, 0x2b6887e50404fe4d, 0x0e34667fa58b79be, 0x218aac7bd2874fbc, 0x938fba1c941371f3, 0x6d8918cb4d504018, 0x062e93369c1aab5d, 0x188bb22b5d0139ca, 0x378334818159a9bd, 0x718e315c285d6f57
+, 0x19a14a779a8791f4, 0x73aa214ce41dc9c2, 0x83cd3e4b0705ab71, 0x1471e8035b734eea, 0x91393335ac1ce217, 0x5dc5cba6fbf7b80c, 0xf2aeff7f520ac458, 0x612e1b6926633391, 0x8778f88d45057d0a, 0x121b8d856a762559, 0xbb5d19dcc60cb738, 0x2aa34513724c1041
+, 0x234e4a84b2e7ef6e, 0x72125ec183bba601, 0x3b522a56f0be1daf, 0x6b90c4c40a698ee5, 0xf87339427ae18361, 0x79461714b4751c0d, 0x850156b676bcdfa3, 0x65798e102426f7ab, 0x8baf476277aa9c76, 0x270710dcde1b7983, 0x9c30c87ac48a4a6c, 0x041ca7285def8840
+, 0x6f9cdf4f58b0e8be, 0x03d0ff57cc3b9258, 0x432d3fb97a667562, 0x036881014a024843, 0x098a9c67538b669e, 0x507442c410210f98, 0x757d475e262c5a2f, 0x51d8ca978e934270, 0x918e02823fefb283, 0x0e021d72ed4647f4, 0x618b7f4a21117bf8, 0x17d297b07b12cb22 };
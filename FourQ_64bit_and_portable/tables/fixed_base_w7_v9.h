@@ -0,0 +1,589 @@
+/***********************************************************************************
+* FourQlib: a high-performance crypto library based on the elliptic curve FourQ
+*
+*    Copyright (c) Microsoft Corporation. All rights reserved.
+*
+* Abstract: precomputed table for fixed-base scalar multiplication with W_FIXEDBASE = 7 and V_FIXEDBASE = 9
+************************************************************************************/
+
+// The table below was generated by table_gen using window width W = 7 and table parameter V = 9 (see http://eprint.iacr.org/2013/158). 
+// Number of point entries = 9 * 2^6 = 576 points, where each point (x,y) is represented using coordinates (x+y,y-x,2*d*t).
+// Table size = 576 * 3 * 256 = 54KB
+
+static const uint64_t FIXED_BASE_TABLE[6912] = {
+  0xe18a34f3a703e631, 0x287460bf1d502b5f, 0xe02e62f7e4f90353, 0x0c3ba0378b86acde, 0x90bf0f98b0937edc, 0x740b7c7824f0c555, 0xb321239123a01366, 0x4ffcf5b93a9557a5, 0x297afccbabda42bb, 0x5948d137556c97c6, 0xa8189a393330684c, 0x0caf2b720a341f27
+, 0x9988ef2e53f685fe, 0x0194c6a0fb99747b, 0xe6d95f409ad0a1c8, 0x6806c1ab2b20ecdc, 0xe9669096ad94890b, 0x3a628f42893f24a5, 0xd8b334157367b405, 0x21968ddafb0f5494, 0x54254a1938a37a8a, 0x7723914a6dc66dc0, 0x5d0930c3b3466b2e, 0x50657c9168e2fd91
+, 0x081db9d2e0368a34, 0x0384f443ad0ffaa5, 0x3d73da9abac4bba0, 0x362b305d6ba81313, 0xd869f426e3d5352f, 0x784559bda926b5ca, 0x322438d79875a312, 0x621233dcb262c638, 0xe902e3bff2395b2d, 0x06111286c632bfd0, 0x0ecc8463482f7978, 0x2947be7c85cffa85
+, 0xaef5a4484ee97975, 0x39a78e16af97f3ed, 0xfb7a1d18459e0bfc, 0x33d61c06385ee510, 0x9177c730b8237831, 0x2a74415fe48d8007, 0x4bacf27b213b2075, 0x545932c6795392ae, 0x4f414c3f31dcdabf, 0x3ec666df6c4c9588, 0x6ccc711076f15d41, 0x285bfd487a002f01
+, 0xddfa8c33a3506a6a, 0x198bd5dcb34627fc, 0xe8402e3b4e4100c9, 0x55df020d072565ff, 0xe70258e733033c7d, 0x2d019a513945f32a, 0x9a40311ee1211830, 0x770dc177e52272d0, 0x19095a3061746714, 0x4ce4074165217bb6, 0x315230dceccc6316, 0x532da56685088729
+, 0xef117e7ce20f46bc, 0x3670f5e1ef9043e9, 0x09c58125af0353ab, 0x7a3c76e11a5446bb, 0x122ccf4b5cce55fb, 0x4e1d634414b11e22, 0x6bb4cbffa175280b, 0x0ea729b9dbdc78b1, 0xfa34ea9132c4ac61, 0x470239f54e67f640, 0xf0791d2f05dad1d1, 0x58d6ac16a1173887
+, 0xc1d4b0e829ed2067, 0x73d356fbdf20205c, 0x8220f9c22f43a20e, 0x419a3bc8ef540b3f, 0x6fa75f402c94ec70, 0x51f4ea95277b715c, 0x9fbecaa9ebc4c52b, 0x279c601b54212d3b, 0x68e77b12f0ab3d09, 0x6310f31490a2be62, 0x91454291b8d2bc9c, 0x3d70efa9c11e5e4c
+, 0x43c0f2448a8fa6e5, 0x743ee6f1ef7e50f8, 0x81046eb9642e1251, 0x754fbf66cceefed1, 0xc1773eb4b942cfc4, 0x642d05f30c395d29, 0x80456e86ca81e459, 0x40d8682d2799da37, 0x6d8041a06b20edc2, 0x65f837fb6e31d8e5, 0xa3c828526525287e, 0x6264282b1abaaff5
+, 0x17434613d834ca9b, 0x037531a34854ceb4, 0xf8fc7d06d59bf4d4, 0x70f9451b2b66dcd0, 0x0812a87ee8b28d2d, 0x0ef4f69141b0efea, 0x516da02e0114feec, 0x352c03da66427094, 0x45449616521a2f34, 0x2100c1e838fda3c1, 0xd4010824b9563ed0, 0x2324270c40195445
+, 0xd335b51af74f9f02, 0x001083dc87ec472a, 0xfc1df3665dedb8af, 0x026d93935a1d6ff3, 0x7cfbc81e0841afd9, 0x780170dc7f1d545a, 0xa8c6ec18b5ee92cb, 0x116abb62bfb2b08e, 0x78fbaad1943eb258, 0x70be61072d2925ea, 0x28072b5e16f59a1d, 0x265ae496cb1a984c
+, 0x44d3d1c568365849, 0x10bc7fff0fce0068, 0xf66eedb87c6dbffb, 0x4ef34fc5f72d830d, 0x5d3e8cb106270a61, 0x5e887fd7fae67470, 0xb7994086a6c53c1b, 0x2c3c46e687e043f2, 0x74b530da3e397433, 0x13099be18b1eb481, 0xe59eb9ce1c8dce37, 0x4427a09e9b73f48e
+, 0x9fa15a5cf8e41fe3, 0x316053f89aacbd1a, 0x49eca4918e6f906f, 0x4358261077c55d79, 0x1bc1e42ab597bb3e, 0x752f378850a771d6, 0xc1b25cfdf9adb813, 0x46860827f38ca4f4, 0x8128f76ff794176c, 0x60cd946f2c205207, 0x5349abaed81d97b4, 0x29361222392af85c
+, 0x5e90ba0ecd7618b0, 0x56c549abe8cdb34f, 0x0ef7247ebc5c5203, 0x3faec724dba964b3, 0xcf4aba35cac5dc1d, 0x645738d6b746f2ab, 0x230354fa3075d817, 0x5a1fdddce68f064e, 0x679157f7cd4d2944, 0x1bfa337265fe5332, 0x6c88ff87e286e40c, 0x50c304058d24cae0
+, 0x6329d65de6ac0252, 0x653b23dbb2059b46, 0xf8e7112ab3cdc369, 0x1341e6078b316a47, 0x79254fd23129acd7, 0x7506d375c2ac9784, 0x9da25eaf4bc34deb, 0x15d016400f1b1790, 0xca6efce9809cbbd9, 0x5c067a2e2d6f8e8c, 0x8766c89d830fe106, 0x6ce471b9bf1a114e
+, 0xa7b5536499e8f0a1, 0x04a8c65b36f83f84, 0xf88f78feddb50053, 0x0be8bc7ea850b944, 0xd159c2ce4f309984, 0x30d2b732e5ec61bf, 0x362b0927482f9dab, 0x66dbde13f6f0054d, 0x65bd083ebd68d10e, 0x344dc2dc2b1d568d, 0x40f75d676961eccf, 0x735b6ffe0b409a3e
+, 0xbb46e42f85bcb807, 0x74876ec12150409e, 0x6f02757fede3e1b9, 0x3c396af68128e2f3, 0xd7eafdf85c092eca, 0x4849de5e3194f04d, 0x3674c591580b5c4a, 0x525a2c8be0f8a095, 0x468dedc135a0d0f3, 0x7a1ecfdb131c36f5, 0xe1a9e0778db7e92d, 0x49f4b7800829583f
+, 0xe1a65ee978d30e39, 0x15b6582c86c45329, 0xe4499ad121d429ef, 0x4430104f8103f7ea, 0xfcffb72a85047b27, 0x07fb6b7ba36c7d07, 0x5e9366c9075e3b4f, 0x34a2d37bddbb903b, 0xb779f15104e516dc, 0x5dde7a57ac49c4d3, 0x1e04aadc857fdf59, 0x7e47356e1375420e
+, 0xf6d07ccac65252a2, 0x0c007fe08540a764, 0xac85b998adfa3ef1, 0x6de5278e097bea61, 0x1b20820045fc95d6, 0x5b0ecffa94854095, 0xc60a691a5671dc26, 0x0cc5fcd67ab75259, 0x818949e8246519fa, 0x3148e3c52fb4ecef, 0xccc9048634ea323f, 0x0c3656a51f2faa2f
+, 0x2fe4ddd884c03eee, 0x58483d4944121536, 0xc456b534d8198e4b, 0x203ad7c3d3040e82, 0x1bc148d46c48f13a, 0x51fe080b2e10a05f, 0x5f0fde39a147ac57, 0x2e164a99a63334a3, 0x835a4dd9a3d22e84, 0x379102c505d8afe5, 0xeca7a84b4dd22d8c, 0x3c983caa751c5b11
+, 0x5fdfd7431b06ece8, 0x2e0b254ed850b2fe, 0x2b05df1a690851bb, 0x1379f63b8d253095, 0x86631f3ee9f25501, 0x54c310d6b5b8a712, 0x325da6cfe5e3620a, 0x0909babb458b2806, 0xb5363e8487d03b5a, 0x6c79b14c36508b1c, 0xf6fd8cbec0292fd6, 0x597821e557d827de
+, 0x5d63a979783e6d27, 0x7643808e6b2e36ba, 0x364378023675060c, 0x595f7b9c16f224d1, 0x55a35d0fe561eb21, 0x6c4f35742dd122ba, 0xa93e8a399403dd47, 0x77b412efdb38c6d2, 0x04d3aca830fe61ba, 0x0a03c4c179492724, 0x7cea61f978699db9, 0x5d6379fd7e6cf47d
+, 0x89c2cbb454d88ea4, 0x608341dceef43255, 0xb83bb75cd4504803, 0x23c987c0ece03eb5, 0x4b5b5619b3d73fd7, 0x65a0331881d34c27, 0xca351c2dae70bc26, 0x74fd50a281d303d7, 0x479d86f18bb6d569, 0x1004c3323336d6c1, 0xc44368910be485e8, 0x31b5912a8dfd5d35
+, 0x852ed6a7eef1cdb6, 0x4a1c2cf74c348f99, 0xe4ba5737459c18ab, 0x27daf3134652df33, 0xb37149b49a671e50, 0x1322930d3dbf3162, 0xce19c73977122cb9, 0x659b08179bc23b84, 0xbaddbbc6cfcc7a8e, 0x682e311c6283437d, 0x32af9b83f9318cae, 0x64623f5a8ba518fe
+, 0x9059658c42aa7e02, 0x085ea6afb26b52ba, 0x2b4f9c95f385bc13, 0x58b2133d236704a8, 0x1bc2efc535b57aa1, 0x6dc60ce52550c994, 0xfb5570cb84925385, 0x5dccc6a91f23c760, 0x31616a2fb767e3c6, 0x1bf543176531613b, 0x9f366cd7ee1bc8f0, 0x1aeb68ce05a6ab01
+, 0x14cf81ba524063a2, 0x2537df2eb23bf2e3, 0xef79f1e802ac674b, 0x74a1a152c2c9f170, 0x76cb775d9d4bf277, 0x50197ae76307b752, 0xf50e2124422a1b3e, 0x3a5ef32203532f0c, 0x9ecabd41e50e7618, 0x14c9ff639c37e67c, 0x662f92a67db6aeaa, 0x338464bce638275c
+, 0xcc723dc8dd77015f, 0x71fc4fe0e51510f1, 0xd6bafe154777590f, 0x349b96cf3e51aa7c, 0x93701aa84d261a12, 0x1756865f46cc7e71, 0x100f029ed7bfd341, 0x204b0678c7a15e9e, 0xbb1ed436dce822cd, 0x3e4e4fea19964f69, 0x2786a730b94bc74a, 0x6250d2e5260ed9be
+, 0x77b97f00eed525b8, 0x1089088133ebb96b, 0xcdec4852750f972e, 0x30ece84f30d9a315, 0x8e67d58c93aad935, 0x0a8c02b61d433f5d, 0x38be363f3778ccc4, 0x7cdc8cda50146a5b, 0x8724b70f675da6ec, 0x1dc678d6d7baf456, 0x9874d4aa35daf19a, 0x2daba172046bba5e
+, 0x95d0bee95741c1df, 0x5c5d657c6a2d43ff, 0x2630e798ed5faec4, 0x60e03495f8a70951, 0x0e297bbc010fb707, 0x2723646dbbd4bee1, 0x3ebb0a4ea709d8da, 0x44019faf01d83d00, 0x9b907e28f1ab37a8, 0x606f6102b81e3288, 0x0f022200d31dd2a9, 0x69bc3bf08fd92c1c
+, 0x315d8e533b0ef5e0, 0x30bbd4e5bb8cf242, 0x26677c4fdfcbd015, 0x677711a0c3419ea5, 0x6d6dbdb753fc4e75, 0x69a0e7a8e53685af, 0x162db93d60d89c5d, 0x150870af33ec3afb, 0xff530dfef698a1f6, 0x1358cc122ed9db2f, 0x09c05e28aa28a013, 0x4450056d2308915d
+, 0xd9c6e0584eb48003, 0x1dae35297ed622fd, 0x0953661330f94665, 0x45230df88cd4ae04, 0x8cb205a16cecfe06, 0x0c45ff34635303e9, 0x8a5ab00f57b30335, 0x4a8f8f5cd958bf91, 0x258a694c565a3b2a, 0x71af7605b4aed2cc, 0xb5b307c303590683, 0x26d398f3d9aabf80
+, 0x98304af340b3c95a, 0x75d3b0b0c9afbb54, 0x01e8aabfa4e779c8, 0x7dbb44116911190a, 0x8d985f7de0d467f2, 0x27588b7a4e20cba5, 0xb5b24990a2273807, 0x57688966778810d2, 0xa18df016660f445d, 0x614980ebbaeb3296, 0x7cadbe1d1efa7d00, 0x1d5548a1b84064d5
+, 0xf8756b8f86f2ddea, 0x03d10793934b0b1a, 0x859c28f6a5c1e69e, 0x6ff93a01280e2fec, 0x4ae6a2eb6e42c915, 0x3a31c926240f7b68, 0xc3c498d2254497e9, 0x6d62a5f913f4e474, 0xb88dabae38963c41, 0x1f06a2b25de44e1c, 0x27bd84c0b82af1f2, 0x3b961579dc425786
+, 0x5a0f7f497e7f479a, 0x139719d9e79f41fa, 0x069ca4194e892556, 0x618e59c4590100d9, 0xff66d79c7e9ec074, 0x2d29b1e8f0968bc1, 0x948e68f8919c2fd9, 0x488de7889f6d4c5b, 0x3d245dc65f0c0abb, 0x46857517dd8deae0, 0xd0f1a2865543f4c8, 0x7dd78728c4755039
+, 0xeb9e3fe68e338ace, 0x59b0bd8ce077ef50, 0x8280cad83918a9fb, 0x3b70dc116915fc53, 0xf0bd06fdea0b5609, 0x0923733f366aac49, 0xf99cad7710a06e81, 0x3ed55878af262bd8, 0x840099ca61698618, 0x74720babfde44be8, 0x5a3ff5464a89cdb5, 0x7f50450918515f0f
+, 0x150c4af74adb8890, 0x3e788b5de93b9096, 0x26a41addd647a4a3, 0x76f4d0f7c8857707, 0x65d812684161e86e, 0x13106f27503f3a9f, 0x0397d660da9196e1, 0x647930fd43746952, 0x04d405555229f2ae, 0x6f26489e8b4e7b37, 0x112e60877f2a2a22, 0x6aaccaf496481240
+, 0xce1d54a261e5b768, 0x4fbaa5e81959ed28, 0xcc7910bdc6886926, 0x6f3485383ada906c, 0x294c31591d2e8be3, 0x084804549a35a236, 0x85b520d0513e8ae2, 0x1f7141a86f100af5, 0x8c60d139c95aee33, 0x59fd6c60720b651c, 0xaeff0e2970732637, 0x3d93ba5d9d764426
+, 0xb05a130be84c6fb7, 0x797e9e194f52c04d, 0xac943e51228a0db3, 0x0e3f736b59b2ebb3, 0xda1e4a709046bcb1, 0x2e44224028c6e61c, 0x80b115f0db92c5f1, 0x0771c2afb72fe4cb, 0x399b544baddf4391, 0x2e9661d6e90a75fb, 0xd9d1c176f2dce877, 0x6050e3904021b94d
+, 0x95cc23ca8289eb18, 0x14869946fdc4958f, 0xeea2682ca5fb1f40, 0x3007bea5290794d6, 0xf568e8ffb53ea2dd, 0x3944a6b5b7991684, 0x51e339126c2e6668, 0x15068fdf101e193a, 0x08ec36b0e4298e26, 0x36c06f3666586242, 0xe02ce83a12062246, 0x011a8f37b8381fc7
+, 0x6865631671ea0a1e, 0x6225b0eebf6cf5bd, 0x19f1b6a6edb6dc26, 0x6cb84edd8850367e, 0xc8926a055e0f1442, 0x59ad8960b7b2f185, 0x93aa923842e26bd8, 0x5ad6743e45772e93, 0xce13bb38778a9c5c, 0x43c8642007bccc66, 0xc0f46bf3e8835e98, 0x6ab9c79fe4112315
+, 0x7a6df62c2a344ec6, 0x69160efa3ee834d1, 0x652949faaaacede5, 0x0f5f95a48e116311, 0xde0d6e22dba061b1, 0x12a52a3c112a4305, 0xbce90cb7456db90d, 0x18901e3ee9ee84a4, 0x0b3ae28180466e17, 0x714666c5b06eaa5a, 0xfdf17c5d7922c0b7, 0x0e0f9da0a689a59f
+, 0x8c9370b84968eff7, 0x29527cb11037bf12, 0xca9c9322ed26ea4e, 0x3c08b92b416e5214, 0x53ba28e450d6c143, 0x3f8bbd4fcbb81ba0, 0xcc42948904a0ec53, 0x59a19116402000c9, 0x1eac39f5b862f646, 0x7d731862901b9b11, 0x83c458352c8df2c7, 0x30f97637ad7cd312
+, 0x996458aeabde321c, 0x4b71bc6049138497, 0xfe947e809c83658c, 0x25a9642905314fe7, 0x0cad7a20ed6c0978, 0x26609d7c79c1ea6a, 0x0a96af9a326480cd, 0x2aa97e308a84e09f, 0x28380459e93a3a63, 0x3fe7da05230cbc20, 0x1dfba976d0179d03, 0x55279998d71a5a16
+, 0x1ee3a6736442805a, 0x58b77e994061dc22, 0xd60d7998ae5825d6, 0x1fe0588473711a4b, 0x3d753d1f59c489df, 0x1199ee2fe6ce0e3d, 0xa6f06b8447923d90, 0x280422e993a72fef, 0xdf64a042d737cc31, 0x021e1990f01665ec, 0x8b99cc5cad69f806, 0x7cd3b91bbbb82336
+, 0x382bde1b1527590f, 0x77e6d930a78c3f03, 0x4fb84a1712f24aab, 0x548386933117fe6d, 0x1bd5dbc026a3dfd6, 0x418974ce48cdad1c, 0x45c1e590010f1fbe, 0x68a358de92c02a50, 0xb09048064e17367d, 0x32df37299b5f6dc0, 0x8d2511a9778f864f, 0x54e4740708f9ee54
+, 0x207b8352d3fae056, 0x5f301d2fec28ddb4, 0x76813d5bcab61144, 0x3119083e318f782b, 0x65eb0fba1331e43e, 0x6ab484a3dd0ed0c2, 0x85fc56dd136f375d, 0x5a61a1de00e4e5b4, 0x6bcb4aefd871e3d4, 0x466ecff50ce899c5, 0x710354794a3293d4, 0x04eb64b2be842559
+, 0x870de58c47f93872, 0x582eef561555be38, 0x4cf0c446c3428493, 0x08a116b7cbf15a59, 0x49ebe7339cdecc8c, 0x679f98ad285c6ff5, 0x52e38b318431af25, 0x0791c8a1a735d29e, 0x9a734715901e8ba2, 0x25efeb14ba6fdc36, 0xa440648b54fba00a, 0x21e061da9ad235fd
+, 0x52dda4eb23fd2097, 0x44ba8f6c3ecf975b, 0xf8463d891a693438, 0x4604bb393ec92e2b, 0x268a459714cefaef, 0x0a84e8980071a6d4, 0xdd2759d6070cc539, 0x4b5474f285e08c75, 0x6e44bb322d47dc87, 0x432ed0e676057e2b, 0xc088e277e404d9ad, 0x0c33e909d9ea3172
+, 0xf58ab9d3f574d0d3, 0x16bda4b5cf86f6be, 0x9a7143342b31ef05, 0x28fa8dbd61adf38e, 0x114556bc50b07138, 0x4fba6257868d1a33, 0x477fefba665a5d3b, 0x2ddcbc7535012800, 0x20a8b34ab01470f9, 0x10995cee8a31f67e, 0xbe89de73cfb54786, 0x788c52297d94d61d
+, 0x00e29516310d87cd, 0x4eb65741e297ec1f, 0x4e8c9cf90e21ce69, 0x218196f875aac768, 0x8311b8c169dd7e49, 0x6d80aecee97663cf, 0xd3f9a5a992cb5dd1, 0x4eee8e01d026ff89, 0x38278b8d3ac10dd9, 0x6f23445ce44db830, 0x85e3e315b94d3f1f, 0x1b105220c54032b8
+, 0x9d999368b8a30a1e, 0x33048462a74a9c92, 0x2aba3b53b29f2b48, 0x5ddb54aab43b4568, 0x439964c85c8d5b6b, 0x3a0088c51d07368e, 0xda1e872b6d572c8e, 0x394435b963bc347b, 0xc8db5c26f232ab1a, 0x12bc2264efd02fa2, 0xbff9f203dac98f26, 0x7fcb185dc2a537a3
+, 0x39d5d250241ba1b9, 0x7f0241db81b91715, 0x38a7507eaa8ea87d, 0x5250248665b22be4, 0x47c1c4328501265d, 0x27ab80a5b342aa60, 0xfb022ca100a4b974, 0x59863d08c9cde78f, 0x8b4f2fed73a8f01d, 0x73be4c1f85de33f4, 0x65bd4af997082b7f, 0x1048da92171cd9ad
+, 0xaba4fd75d46cdbac, 0x6dbb19601e89ee9a, 0x58ff4652e3f5737d, 0x68313ed902ef3539, 0x15d2c44f6fba0cfd, 0x79e7b6b76e465d4e, 0x50d41650c2d19e17, 0x2f78c0a036e6a650, 0x6832e1c3870c9018, 0x77d0407eb646f460, 0x6e2e4fce608febb8, 0x52f399b34f6274e0
+, 0x1422a4799514212e, 0x3284adb94429e8ab, 0xc040d9b636b8bbf3, 0x038c036b30665234, 0x06f889a16047abdd, 0x69f8a1070ef9d121, 0xa6c77df99164e7d0, 0x45957f4de00353ba, 0x0d5900a3a7598878, 0x4594dea11eb7c19f, 0x80bf16898139d056, 0x61c091051f8d0e16
+, 0xbbb22fb05fee20a9, 0x358730a5363355b2, 0x6c2fe6af00fc65b5, 0x18129fdfc095e48e, 0xb1eb8a42e195899a, 0x5522def8dc36d102, 0x6beba31ef1df2f90, 0x55d28af61bee4746, 0xeca6094a2b0ba6b6, 0x67f95b92fd445365, 0xdeb9a5a863dffc2b, 0x10bfe085c5928390
+, 0xd6b9466e0a71652b, 0x0cdad18b7f459554, 0x60ddfaef65a38b76, 0x6c3cc4a2685af493, 0x864d86e4ce6cecb7, 0x69af7a0378b68a3d, 0x904a2fa054047c03, 0x502e72b21ea80f2e, 0x6f8d3183c17556d5, 0x5e9059912f6a03bb, 0xfab16fdee38efb76, 0x10cc2450156d3005
+, 0xbb0aa6587ebeaf00, 0x380e7af38c1f241e, 0x2bbe2def064fdee2, 0x0edeb8003d0ba5d3, 0x2367eee5ae3ba221, 0x7508e6b3359d25b9, 0xf2fa2b4dd430cc19, 0x74e8de00641276a9, 0xfc3a4ab1424a593e, 0x3de214dabf4377ea, 0xd9ca47348fafec8c, 0x0e92f11c9061b0d2
+, 0x741a910b811b9bba, 0x71f73415e60dc92d, 0x5a95769c7a6dc79e, 0x431d6dd45a9c0593, 0x0495046b8226f1a1, 0x2f4d18ffd5b8c2b5, 0x7727c861fd9a934b, 0x49cde5b16a53e273, 0x901e13a38b88c457, 0x3ecb2ed7cdbcadb7, 0x6e75428411dbc6d9, 0x340c002d4c3fe082
+, 0x2e8ed403b73dca50, 0x7be3a5d5acd2bdf4, 0x1c88e538600ecc9f, 0x14648eb121db3483, 0x92eaf1c520f28ab7, 0x708e9ac537b9942c, 0xac02425248a21604, 0x36d339230772d4f6, 0xc5237f60f1cebec9, 0x403f26510796cc5d, 0xcaad21db916c1f97, 0x0ed152237d7b969a
+, 0xf183d4fa62ba12b6, 0x122a06bd7301551c, 0x90202bc74c703ec5, 0x221c46c9f6cd154d, 0x9ea4c60b3c41a3a6, 0x7c2e64c0c3587cde, 0x4139089f4d268a75, 0x130fc687654cc4ff, 0x54dbf62d8f03cb81, 0x15eab981cc99e4de, 0x51e6361ed3370658, 0x53559591c2a27c61
+, 0xe36295334ec70970, 0x2444aa13db709c39, 0x107cffe227621cb1, 0x4ff1b00891135d7f, 0xd408794fbede889d, 0x34c97603673269cc, 0x62cd3c0720f83329, 0x047cb9a7313b939d, 0x08de80e13dd7f4cc, 0x005f28ef8a3f3f59, 0x461f1e67e3f72eda, 0x0931266580fdc537
+, 0xd8da57f81b77db4d, 0x5c537d17db546e4e, 0x29df733ebec0c785, 0x65320805999f2300, 0xab1d885c4ee24ede, 0x427b3d7d8c9e4483, 0x7d2b8f573899c763, 0x2b5c8741d35f679f, 0x02af82626102202f, 0x4d1230f4c8613e3e, 0x342e5891d9e52fce, 0x2cb85971767b79b6
+, 0x4b7a1515630873d3, 0x72555d548c15fd7d, 0xc99d7f2b99507bc1, 0x5fe83044589caf0d, 0x2498677db47a9384, 0x0fcee41d82c26361, 0xebc5bfe301d0a81c, 0x0a9784b13dbab106, 0x7cdef969cc4415b5, 0x44de4268f175684b, 0xad4f3bff31d302f7, 0x552fef1df421bc1b
+, 0x271cebde42c23d7b, 0x611ae840033e486d, 0x61d489375d4c85c8, 0x50ef33cdce8265ba, 0x4fffe5d688d9e6f2, 0x7f6b07f86687cc7c, 0xceee284678b2cc61, 0x5cf2904266654684, 0xf37f6eb6ede7b3d1, 0x622a8a98cb0c22a7, 0x1c676b61282bb45a, 0x7403fb9ffd48cd98
+, 0x7b0706ee5220b574, 0x4c11b920a1e46caa, 0x4cda5ad872c0a372, 0x10f90618d9340659, 0x786b947122c4a3b2, 0x1a7354bcbf482be8, 0xba261be2a648a218, 0x0baa9a4c18108f5f, 0xd100be3fb8ee072b, 0x228c14859fff6e49, 0xa67765fff8bf2f3a, 0x72bd418d732116c4
+, 0xb5734255e3b62113, 0x3a20961711851792, 0x752f52900101ec27, 0x5bc21054b18a8e45, 0x0da96ad77571b5a9, 0x41fe399e8f04326f, 0xe1012f5537c2b1a7, 0x0630a0c5491bc03a, 0xaf0030069510e112, 0x1fdc01bcaba7b65e, 0x1e836dcd9ed2c852, 0x2cb17e5740d86fc4
+, 0xd3866ff674903ec6, 0x6683e5a2d741718a, 0x0d3c9bc4957d1313, 0x7dec340059fe90fb, 0x6b4eace2073be610, 0x29cb4533476230dc, 0x8ab303e1749c995f, 0x3c4e0467022b52b4, 0x47761930045eab7b, 0x1884a5af0083f90e, 0x3ef992ddfed90802, 0x59651d2dc39a9c85
+, 0xa63305c4388dbcb6, 0x2741fca3b957674f, 0x087bb0f46db3fff5, 0x01f10fe712dcd5ea, 0x3b098f11a2ac63bd, 0x2ab049843fcc4a5d, 0x350dafc27912b2b4, 0x78d77be62cddfb17, 0x15fbfca2aab027d5, 0x03a21eefc9f0b531, 0x02835ca5da875d55, 0x4c01b9cc86d7969b
+, 0xbb44dad34abc2e7a, 0x05fb12dc41a3312b, 0x3900ba4a96876f15, 0x60a4690437b0185c, 0x2b03d89cedb9a9ae, 0x1ce1c997cdfb296d, 0x6bbc307f9bca26f7, 0x43c7c9ac4e1fbf1c, 0x26f30d544a4ce23d, 0x61ae3c7e1423ee7d, 0xc200899aecc519d1, 0x2a0420523bdb493e
+, 0x710095984ad5eaeb, 0x0a7e905706b59077, 0xacb3e6a062b15720, 0x5b6e812b3c9804de, 0xc7822250ed486ee7, 0x5c7e12d00de9af81, 0x4eed47fad2c67bf3, 0x475c506692d200f7, 0x3acdeae188546520, 0x000c011ff3a50c9f, 0xdc5925528f9e3d05, 0x2cc2193cbec78a63
+, 0xa82b95073d887c33, 0x3c47434ed96cf2a6, 0xf4099bafb5be3e43, 0x0ac53056a01d6cd9, 0x4b00ca1590544d92, 0x7becc21abed18d2e, 0xe89f3c85a48bfaf4, 0x2f448bda94ff7def, 0xfc686cb6d4724366, 0x5c8bc10c41db3d0f, 0x94f4834b42f7bf6e, 0x2bd21baf6f55e558
+, 0xca830cd6d5a14155, 0x0a3bc87b699e63f3, 0xc10640da0a012344, 0x2d609f0f899e703b, 0xe6cff9b5392de4d1, 0x3c5a476c338c960a, 0xf2d90b66be499ed5, 0x4456bfbb29309fae, 0x8eaeff1a005def18, 0x0a912674cf26cf7f, 0x1e611153896173ba, 0x08d54b39ae9e7578
+, 0x94d22b7bd2734f68, 0x14649060dd09561d, 0x580ff1c71854717a, 0x11c62f6d780a1a14, 0x4f61b39e5c468411, 0x5cbddd06da9b5b8b, 0x668b6459db1be81d, 0x3b9ced1a69542df0, 0x546a6f7da3a80fcd, 0x4f8f09b7b3271f17, 0x1bfa086bf6efbac4, 0x169bccd0c3196364
+, 0x3715848d91c10e2a, 0x5d8e66255a8eaace, 0xe351c099c9eaf827, 0x402759dd77ee2787, 0xa471edbb8bc9eda1, 0x63bcf62d3940800c, 0x7d2a638425219db8, 0x44f1e6231f42f4fa, 0xdd123b4e6a022875, 0x1085616818eaacdd, 0x836d44f5ade73cf5, 0x6570068e5cc42f8c
+, 0xaa559232ef365e63, 0x59ddf604dfb070bd, 0x166e2f138198ba09, 0x2afa784655df3abc, 0x15d1b34b354dbc11, 0x60f73c2e2025ce5a, 0x39487520dcc2dc90, 0x77588d54d2c779cb, 0x978e37a86de7e333, 0x7a91bf789cda6f19, 0xd0ed94230a9e3b58, 0x15bfd37351d36660
+, 0xe5fe52ddc912a1b2, 0x1e3dc98ca629df49, 0xf4560df009f87b64, 0x19bf73030cade8ac, 0x849d068b9dbb8750, 0x19c24a2122083d54, 0x8a7ac217c46c3e23, 0x1ee22595649d8c73, 0x53ac9d1d315be67c, 0x633f8d9f9e50e149, 0x13d839676fb5a2dc, 0x5a67532ab4f837a4
+, 0x8e5c26e7b8499772, 0x6aa7370d30f93e81, 0x0c29880c88c61230, 0x5b5dedcb1e8fc2e5, 0x77b5e5c15f5f2249, 0x0aafffa307960cfb, 0x35d8e2ab4bc7c640, 0x6e6b6b15c8d2fa39, 0x71676a8b2efb5cd3, 0x0ba9281c03d0b225, 0xe3b009e2d273c791, 0x635da896cb1cd16e
+, 0x60b048abebedb468, 0x25ac9ad7d39dc6fd, 0xa754c8dcd2c63d2a, 0x4dbe0b71c049038b, 0xbeab1e0ea42cf03b, 0x065857d5c272f1c7, 0x3b9575ec49c362fb, 0x75f4d528ace1cc33, 0xcf16d131a4677fc6, 0x6066f8923749a3fb, 0x1ec7122e42e65258, 0x652a373143a6edd9
+, 0x257b283f76e5864d, 0x2a36d6d2aca5b58a, 0x94cbd4dc665cbcc7, 0x2883c0f6d395da5d, 0x6c6d5ae155d17320, 0x191c36e6812f6dc0, 0x31cfa6475c7af2e5, 0x3ff455f5600d9935, 0x388ce3a1b001e3f9, 0x3a2bae3879a0233f, 0xfc7aeea713ae527d, 0x49a2610d84284972
+, 0xebd0f4c593bcb33e, 0x449a9163d6bf4fb5, 0x3d7e2d8248a7cf71, 0x3b82f7a115161dd5, 0x098d526380e7640a, 0x10d60c04cd82a11b, 0x594b0513dc32316f, 0x2f91665f00b5a451, 0xfc15f4a5e73d684e, 0x3165c56ca90c21fd, 0xc00e87a5bb43490f, 0x57a393a78d436dc2
+, 0x805293a2d659aba4, 0x4ae1e9f503212ced, 0x418e3b61ffea68cc, 0x7b2641e2b98551aa, 0xb2b5373cefc198b7, 0x1d6d937facb0071c, 0x8d59d27aa30a357f, 0x7d4c1e22d7e47224, 0x1f9aef85c777848c, 0x1c983bae8b65df14, 0xf9ab319e4cc02e79, 0x46bf9e2e12e19367
+, 0x166ab94bc52190b2, 0x3064060072bc2999, 0xfe7b96b30560a429, 0x2b4393adf8105158, 0xaf91af418a603f72, 0x1fa783d10bbe117c, 0x55823a61f86ee02a, 0x0d182232a0e6404e, 0xa2295185c1e71150, 0x75bab2b38492b4da, 0x0621ea18a4103e21, 0x76d650ecb3a1354b
+, 0xd266d64b48be5534, 0x6a3e6f26a999891a, 0x24c85bd648a8aa92, 0x705733530dc65116, 0x489a7baaa3e9adf0, 0x14eb520bcdbb4fda, 0x1f0abd3457e77ac9, 0x3ae462ee4bffae2c, 0xdc393bc87d8738ff, 0x36e2b39910e19868, 0xb5fb6e191e694009, 0x3d28a4eb77cc4247
+, 0xb96f0303adfa2627, 0x0d787d1975dc8124, 0x760d2ff165229801, 0x48e28477ed924acb, 0xeaf677d699a25992, 0x5effb011e41f549d, 0x11f83a89d40ede57, 0x5a4e5f9f3cdc73ea, 0xe4c4b0bb9292b646, 0x723d6167984b9232, 0x692646b25ec0a1cb, 0x31e6cbe637ac736d
+, 0x1a2cf17f5dc8385a, 0x5dbe2e264fc7717e, 0x740518a700b5115b, 0x1933f390dea7cbc8, 0x66b0ef97a011e71c, 0x167ec1c673617449, 0xb87d964607f7fa45, 0x50dfda4f0be187a8, 0xa40548a81cf21e9f, 0x0557980d9ab869e1, 0x6f6419a88398a649, 0x05000c46b136b793
+, 0x62b3a46bd09314d1, 0x681c637f20a64ddd, 0x8ab4c444a07c7eb6, 0x01b31be4915f5a9f, 0x621db6ef7378b9d7, 0x7cc7f83f157782ca, 0xf1212c6876b70089, 0x5ea664745ec93687, 0x2b3ac3e88ef34b5d, 0x69c6ac6435619416, 0x4720ded97a3bbe31, 0x51e2ba4647aef135
+, 0xae4d4ed81a234389, 0x6750e39f98dd42c8, 0xd8587e0befbccb1a, 0x47cae930d175832b, 0x2709cfc7eafc9378, 0x47ac7ecd66aedeb1, 0x5cfe2565018a3ebc, 0x139be105881e184f, 0xe3bb61ac14f55ed6, 0x1a7bd20ee6d25c27, 0x05956a73eb3d1ac1, 0x3031d0129af9c413
+, 0x95a9a8067c8f590e, 0x2b032dab03bbecfd, 0x62bd1c53ae08ca97, 0x403373a0dbad219c, 0x7763ee17eb6e7cda, 0x4e0dee38ddc4604e, 0x74595f8c1aae4fc0, 0x39bcc81c6b85ebe4, 0xdbe227b484709299, 0x5e5b324f8a721748, 0xdff29e228f153ed6, 0x7aab9fc4d6f27591
+, 0xeff0ee799f290833, 0x5350277ba5ca14a5, 0x7b2413ef086e9516, 0x7dba252eaac2736c, 0x4e6c01f659ce8fb2, 0x51cfe20725c211f9, 0x1cb5d5f5ca982e4b, 0x6403bf7340b542d6, 0xcbde6e443c5c61c3, 0x78f1210613a5c716, 0xb8de17a6e54f4385, 0x57c825e23f278e00
+, 0x3e5721adda3754ce, 0x18f0837239150e87, 0xdfda195138686887, 0x7a9ba80a2f143678, 0xadd54154d96e6fc3, 0x67f48728c388f74c, 0x0df726bd16a755b2, 0x2efd7466a42dec61, 0x4c5abcdaff54d3ad, 0x4d492ca25dbc2c8c, 0x54a65e4e519148fb, 0x64dc6c2559873190
+, 0x8cb76f2d417b519c, 0x4db767cde52dfeb2, 0x9334a0232bf73362, 0x18e763f6b78973d3, 0x7039ee996c8a549f, 0x019993fed9027029, 0x163e7ab0758af2eb, 0x7da9c0ee651fbfd1, 0x6e25e3434ed506cb, 0x127c168fdb705e5a, 0xfbc425afcbd0ef4e, 0x794776549d0be536
+, 0x223c1f1684ec26f3, 0x3fcdf0a133dbfb46, 0x602a0ac4556d7cf6, 0x02af90ec231dddd3, 0xbed02ab5bd269134, 0x1d6af66d28252e32, 0x674ddeed90e369de, 0x68df77c3e254a291, 0xbe171f2f85fb1ddb, 0x03aa1d286c47c0f1, 0x28ead977e5eda94f, 0x75530b5067489c63
+, 0x17bda969efa3a5d8, 0x74d0b699f6622bbb, 0x0595de824ab1bad5, 0x3f2a4360ff702f0e, 0x3e2579e9e81d2207, 0x1dc2b5656540dbc4, 0x855f3fb5c42ce8c1, 0x24d37ec71c936ed3, 0xce699dcc552af58e, 0x1c8a2f5683105cb5, 0x91a9f321a00a23ff, 0x4090f5bd3df564f7
+, 0x5c137e57f80c4c2d, 0x5bba3cc3a0192d6b, 0xe1646af4bd5a281f, 0x631209ec26860894, 0xb4a767380225e5f0, 0x2bc293b997c8dfda, 0xa1152b7943f07355, 0x4549b61ced1f3a40, 0x23d093867f9e9624, 0x17dcaecb3e9da204, 0x6fdadc4c9f758a9d, 0x7c41e05255ff8713
+, 0x5bd7d695524a73b6, 0x49280520e038e269, 0x022607d27fdb4b23, 0x55d2ed100441bf51, 0xd80c001eb09f3732, 0x46dd6069522b9cb8, 0x28e3ed37ba678b00, 0x26f848fe05a2b289, 0xa278724c1ae3829d, 0x02631f7dcfdb46a9, 0x598016753fa52894, 0x42608240fc11aaaa
+, 0x9a411feedbd2f90e, 0x6ff527e5c2b8b784, 0xa98b9077cd757054, 0x5617249b855b18cc, 0x0774bc720e2f34fc, 0x769010a2d0f500d5, 0x634f10d96c71f866, 0x3e0239ea50fd1d4d, 0x26fe3ef46023409a, 0x3b0c22cbf3754579, 0x1f46d8e37aa1a91b, 0x267f24c35feb8d7b
+, 0x2e05c8c7a19bc01c, 0x78c21165c0b7f2b4, 0x083a9f2e61e67a85, 0x4cee240f4fc65634, 0xc52bae5dd7d959d9, 0x293b656fec755493, 0x026fc5c56b7b7cfc, 0x7e12c0bccf9e22d8, 0xe2f97b7f621316a8, 0x7fb8400e9182f379, 0x8ad28bb36731a048, 0x2eb862d6935cb938
+, 0x6001683170c1f4bc, 0x5b0ebee803ba70d5, 0x3a4f597d0ed14d28, 0x1d650c6c403e76b4, 0xfa160aaaf5531ca9, 0x20f3bb03ba979996, 0x6aaeb40062e4fb80, 0x71be97469d23ad58, 0xce070df0a213b31b, 0x1087c49a1a94a4af, 0x657d46b7e8b35b31, 0x57427d4dd7df9131
+, 0xc03f687cd3e7c2b8, 0x55edd0ec481c62fa, 0xb16d0c786e69096a, 0x5470a5f5b67b9b11, 0x639a7b5c88600804, 0x0ef493b5db9471a0, 0x4ea3f0b1f048991b, 0x012f08886f4d72c8, 0x33fc26a0778ebaff, 0x13fc0eb3a4e3243b, 0x0e1c74378722275c, 0x0e9e07c3b61324f4
+, 0x2be4391f509c0016, 0x5338f254e979bb57, 0x6cd45e61b54b8619, 0x3c9666a386c952ef, 0x5293d199421f4c16, 0x0d5c11eb66f2556d, 0xfe599307101c562b, 0x1fc156471a8d1575, 0xf8edc008595364f0, 0x4c12a9a80f9dcb17, 0xa4c2d78bd2160dc0, 0x49e0783d3e4cf05e
+, 0x003c145884d65e6c, 0x198baaace96f6145, 0x4f4dc64dfede14fe, 0x6cd38cb9ddd4006e, 0x8020c4a282789d4d, 0x1d88a4bd5af37339, 0xe19cf254596ced45, 0x44d89a739a4f0292, 0x4244e127391043c3, 0x601f8bd8b2ba1bfa, 0xb80b29252ea0574f, 0x2e12d9a67a3b55cf
+, 0x964f3c8d3df1bbda, 0x3d76550c208bcc79, 0x54ef2b2aa3c78eab, 0x17ca9a1003a9b180, 0x866989c6a8ec0167, 0x514d9c2ea376b994, 0x3bbc31a239334441, 0x3b418b8743f4d209, 0x55705566a54809e4, 0x434a6b39278dcdc3, 0x210a41441f0df9dc, 0x1f7472b4af0f81c5
+, 0x884a22ebf6116334, 0x132800aa2b165183, 0x293c8a1f16da7bfd, 0x06a4bc717251d14c, 0x6980c3310e18be6b, 0x76cf0fe341a9ae04, 0x9c997ca1e5c576ff, 0x17bde319d40b13a1, 0x11509ab02043fa4c, 0x2f8cd3e9062192be, 0x3449dd712a0e7bbe, 0x398b14fe386e1253
+, 0x5484caefb3bd9069, 0x01247fcec0acb694, 0x4b15f39795a4f9c4, 0x3d49b1b2283815f5, 0xf2dc641ad30d5a50, 0x43c9ef41656dea18, 0x9e39a3c87ec0f3fd, 0x0073d2b98dc4ec34, 0x71746aba4c56766c, 0x47cabcf2e41070ac, 0xecb010eb1d62a4ff, 0x0fe212541623a413
+, 0x8c9104d3e934ce48, 0x4f5dc5f459c0a073, 0x76ae71ecefd18062, 0x4f9e70cebb0e77ee, 0xd78931de8e2706ec, 0x0e9cb7aa5f0313fd, 0x3fcfa53573678289, 0x52fb4b3f006aae04, 0xceba758491331e73, 0x2cc9eaf4a99cf0d0, 0xe2ec39ad7e0f86bb, 0x57ea38040d9cf668
+, 0xd43b92e8d97e98d0, 0x0ed771d5ca38b154, 0xe2aeae1f61a493ab, 0x1096217840137baf, 0x990781d9f6e06411, 0x28d980d8ad9de88e, 0x50959a3c38b5d832, 0x1c831d92ed6ea15c, 0x3e28daee0425a003, 0x541d094f1b0f8ce7, 0x5ccab4cf1475df35, 0x371a2d28a13ef62d
+, 0xd9b34eccca5ede40, 0x38adbf5759763e3f, 0x437acff887b039b0, 0x3ad7979160f03297, 0x97ca758ae6276646, 0x46918ea323287bad, 0x46372175d8f6c2cc, 0x31a02177b2d25d57, 0xec61bd1d45db7b4b, 0x7978e2418a3ee85b, 0x66a4ceb559d6dd2f, 0x00ffd0e170701f54
+, 0x8ad1cc05d88de995, 0x1f783dda13bc72a5, 0xfe3a4c26f89fc98d, 0x23333d79bd0a2563, 0x915f6dad84042fc7, 0x5e722e541813af9f, 0x2840570e1f3a4947, 0x07a80072c2f98890, 0xd75ff5aaf6dff45b, 0x00e2452e522c9eb7, 0x5de3cd62d23d3d49, 0x7ccfd3d47cf96f6c
+, 0x819799dd2df266be, 0x1ccff49ae38fb53c, 0x2a8cad67e0c55130, 0x623f1d3109c6da6a, 0xfd98f42fa5e20ce1, 0x525fa7f1c7d8f0ca, 0xe39f81b165fc2c8c, 0x7ec79037b1001daa, 0x0c8dc8fb789a7da5, 0x47c434b5e6f42cad, 0x884bf4e02eb33efd, 0x3791a01d28ccb61c
+, 0x880451bd91e0adbe, 0x08cbe24915e22817, 0x41d9374408767782, 0x354b158e22facbd9, 0x0b764f5861d03c75, 0x4c2264386d7aa28c, 0x3de556101a4b921a, 0x43b984e17a2240c4, 0xc302efcef7ee8848, 0x3583682f17df97b4, 0x61ab4a542108b8b1, 0x238e154031abb0ce
+, 0x873e8e06d739138a, 0x34cd4962b2be51ba, 0x2e479e2b2bf6d76a, 0x45122177c1e53348, 0x81722c2cf1c1726f, 0x3553bb70ccf01923, 0x4efc62ce8c25a570, 0x2798552bd920fd8c, 0xd2b50343c558f9de, 0x181fa23392e4dd94, 0x897a778ad0140618, 0x3b70020b68f85e03
+, 0x802b395bffce9261, 0x670441e2b4d39eec, 0xfa8f9ea45657ec89, 0x4f7bc223c30ad8e0, 0xe763e018506db5f3, 0x7eb8662c31fa03ba, 0xce4cbd5c7e82df7a, 0x530b4544eeb72a5d, 0xfa00f48579bfeb7a, 0x02b09ef5521fa2c1, 0xb60f9c65b58241d6, 0x4a17321bfef8c12e
+, 0xabbfe7e01c00ffc1, 0x0a9ae6ebf98db189, 0xc107ddb0edb77867, 0x0fc21548dd5d9c4c, 0xba489f40d11404f4, 0x3d5ae1996052b7c6, 0xa0dc1730e0c7358b, 0x20a948cb517095e1, 0xa084372456364c18, 0x4ac3c5c4a1daae85, 0xd524f7ff12a0d8c3, 0x5a24b4d1b2cdcf8f
+, 0x4d3a929b53ecb383, 0x2b5339c2d5691305, 0x04e20ef0292b4bc5, 0x681d1a8fa25fc2d7, 0x350002da5683c8de, 0x6a55efdf2ff5e711, 0x7abed3687cf37c23, 0x793b0c92f03ebc50, 0x9b027be770e957e1, 0x7ec24489249a7f5b, 0xfb9bfd69ba22e8f7, 0x7d26b173b8bd5192
+, 0x04c09f373063b567, 0x163ed08222505b8d, 0x81fe0b310fbb4d0d, 0x07c5e600d50d4a4e, 0x31d9a26c095016a4, 0x5a69a314649ef21e, 0xdb89399586c15c58, 0x016253a125359b79, 0xd5a5106321d5ba36, 0x30f918ac189ae8c0, 0x03c74e49b234db9f, 0x7efd3cbec221688d
+, 0xc245a36e44b5d810, 0x3545298cb6167d8f, 0xd61fedfc17b84b1d, 0x78b1a353a78a857e, 0x421cbb67fcce92a7, 0x1a1c425669866f0e, 0x996982029af2fade, 0x669289d25f56d249, 0x3a207def248ece7d, 0x720aa9e5c2b5378a, 0x8b3e964bc6debf57, 0x2533abf5294f5187
+, 0xd01041c3e0d0f1e1, 0x2166cce3a531dbf5, 0x6494c2fef909d384, 0x7796eb0d4fbab56c, 0xb630b33645353ba3, 0x3a61bb42d376c673, 0xe7a736f2f935d6f2, 0x55f3f558d85e78b2, 0xa758c0145d7ee6af, 0x61034fb9c2aff576, 0x0f75b369985ee8fd, 0x51af834080ddd917
+, 0x2419d103d83e4e72, 0x4bbabce5b88dcd7a, 0xb690756166d476a4, 0x39ee0e5db83ade5c, 0xb20f7cb9fbe99769, 0x0c2ce966f88a5b2c, 0x3ca997e234f46c51, 0x2d4a6fabd63e55ed, 0x2294bac3f07ad0b2, 0x124c91aeac4d435c, 0x714d3d45582a9d95, 0x704816de1ae83d3b
+, 0xd203764c4a18c4bf, 0x759b6c8c0a63555e, 0x8474656503ef1eb3, 0x7ddd52d6a280078e, 0x3feb5c29caca6004, 0x1a3e09f06b43574e, 0xc5b3bf55b1ef409e, 0x293f54ee37dc653c, 0x0c6917b9dc27e127, 0x0fba70897bf4f12d, 0x420b36890f40e7da, 0x24276c059b4a614f
+, 0x49d4ff9a1c044e99, 0x0cd422f47aa554a4, 0x80936ab0cb075a9e, 0x4618ccdd622b1f28, 0xa87d061f82430fd2, 0x7521e54b11cd6016, 0x68d607c01bb78937, 0x6ec01bd4b099b361, 0x19778f1b9dd2f27c, 0x59ce28496d357952, 0xdbdc8bac9a72ec0e, 0x62283ec93ef25b5e
+, 0xbb3690ba31a69a32, 0x65caa284c249f6d9, 0xad4bad352e47c9b6, 0x4ff7f1d06bebcc84, 0x9484d057b1931615, 0x25d3d905280188a2, 0x34d02a11f9401e28, 0x0847db2c3d8ea8d2, 0xace3822590736efe, 0x60aa648f1ef5e37a, 0x9f2ab87e61ea16d7, 0x25ee85e980412a5c
+, 0xbc72e3b28c3b01a5, 0x0ccc20cd02007744, 0xd331f427a6a65d93, 0x786dd1ec05a9f30f, 0xfed3258d400fe87c, 0x7e43148669232106, 0xcc22de5c4d5701a5, 0x7966d5c3b000becb, 0xfeb01451e1bf56d0, 0x76bc6d90da974237, 0x949dca4a35414534, 0x025c1d36f4a7796e
+, 0x57489539a7785741, 0x258442d944027acd, 0x61222629cfecc885, 0x150b17cd73768ba6, 0xf79297371c33cab0, 0x6519105367d119b8, 0x95e1d46a5e9172af, 0x2aca95ae847817a9, 0xa6ca8e76b8f261ea, 0x7f6f7defe2a5a2a4, 0xe4e5a8e94dfdedfb, 0x291dd49bc3221770
+, 0x12d1d4e784488ff3, 0x2c21b86cc2a6604a, 0x2bd65921e3b9d261, 0x2de5103e9632e76a, 0x1e8b981f24f1cf49, 0x5b805af155363c95, 0x91ed3cf7c1a7eee6, 0x1d023dbc180b2abc, 0xaeca49ff2b86e22a, 0x55b33007af6aafb3, 0x151f4e078013739a, 0x3bf7d6e2dd106b48
+, 0xd7170c73695a43ca, 0x2c2f3384d25f5f36, 0xd83f5ff66c55a97b, 0x329f5e53f2e088ba, 0x4d88a8251282067f, 0x76d83557b3de7962, 0xf07ebf35ebfc6e29, 0x13347e7d6479bfd0, 0x92ebe9c360bcbf88, 0x0a34fa657268274c, 0xacef170ac021310c, 0x226bb675939c52a7
+, 0x0a9ed2031d2b2672, 0x7597e633ad1a860f, 0x53e7a54d582a0e77, 0x4c9ffbe0885e8c87, 0x67e9db87dae7c7bd, 0x46717300f31c1db9, 0x6997e9d12b0abbce, 0x2031adc9f80358a5, 0xd23bd06e37fc1e0d, 0x0a34405a7c9bf39b, 0x91ae0c835c3fb1bc, 0x30db7a5e242b2e53
+, 0x5d06b9dbc87d69ce, 0x2be576367d84350d, 0x8e3ea144455296d3, 0x14b3706805765c9c, 0x89494e92a493d9c3, 0x7560230d36fb0718, 0x8a14b1c381b5872e, 0x57b2a7d4f1e8b928, 0xe634c16da01a3446, 0x1825922c553fb8fb, 0x6a24a9ab42c64bb6, 0x3948468bbe8d90fc
+, 0xb3a70338469bb7c9, 0x2f5929c53d9c589f, 0x0101e89e25a97298, 0x22a0626eae06c04e, 0x7e5001d0d7ffe2a6, 0x5602f925d70865e9, 0xdb7a3402c4e8849e, 0x2d4d6a6d5c7a8a5c, 0xc69cadf415086e33, 0x7b0dd01632dae9f6, 0x867825f1cd6f8dee, 0x5b7674bace1bdee5
+, 0xad43c0d4eadcba1d, 0x1c682caf68058f25, 0xc7c3292e7b97bfbc, 0x0fd173404309e57f, 0xc0ad84bbab523124, 0x08bcdc6837a06cae, 0x6311ed77de16e5d6, 0x37d2714cd0c1c312, 0x704c10896cb50913, 0x0a6d758597cecaf9, 0x032dba74acb688b7, 0x4e6ec2b2253551f6
+, 0x8c7475d7fbcd5caa, 0x59ac247e2515f923, 0x1b79bff8ecd89173, 0x458066f038def920, 0x307f89f471c58b10, 0x2b14d591f2e28235, 0x9f9864b3d4b01861, 0x4ee2faa4e9fbf920, 0x854b3a18a2fc6b53, 0x7b150bc327884d64, 0x2ae3ab5d4d0861fc, 0x11474e2a46487a96
+, 0x18086e5fcf1208e3, 0x4e630bd8538d4656, 0x6fa0b2f04f48df00, 0x75a91cb0b06710c1, 0x0853f603bd34930d, 0x3772796ecf67c8f2, 0xa3c1c59be3304301, 0x2694c741d5c7d590, 0x21d93b29984473c6, 0x3c7808d4cd4cafb4, 0x052dee68b165aabb, 0x1375f07d0a36a027
+, 0x9027544c6989116b, 0x462a2a4d5921765c, 0x9e81470f16ef59ed, 0x2fb59e13c8514c0e, 0x3121a94772cce4f2, 0x34ac52193d415c22, 0xea77caac2b531dfc, 0x00a56b5c2d85c072, 0x30d8d13e5cc3cf7e, 0x205f6c77bbc1d42b, 0x349c228de4266e9c, 0x77564a3d43200a29
+, 0x9ed16d817985de34, 0x62559781d920e892, 0xe37b991b944bfb55, 0x65d13d29000a8639, 0xb48a966f58f44420, 0x3f750c882af8a1f8, 0x1b4ea5195cd9fb2a, 0x5f319d17cfb5dfc1, 0x506f50c82b2fd4f2, 0x61d84f3137b48857, 0x5c34380d47336887, 0x2293d8c5f566584a
+, 0x13cd9f6ca5c896b3, 0x5d2fc6e41d2fa9cc, 0xc63ce341d9efdea8, 0x65c2465086d70cd6, 0x8f5820cd8247e3de, 0x699c48323b90b7cd, 0x0084ac38e464ddbf, 0x1c7cb80972fbfc8f, 0x2aa7a2a030b41a7b, 0x16df0ec74f0bc1e0, 0x4894dc9a582271d9, 0x4c2c381d3719095b
+, 0x0c3542aec26ac806, 0x5fe4d11ad98c50fe, 0xf4daf6f98a561071, 0x08b1eabd66c4e501, 0xac6f7bfc686e30fd, 0x4d37882f7cd27bf9, 0xabd812a9c48eb15c, 0x3485edf29b0c2485, 0xfc17055a1b3c3153, 0x3229a14247a8ccb5, 0x56776ad295e4b731, 0x58e61ab887806a34
+, 0x6ad7fb9cbf4bf59d, 0x10ff3bc04e2c1a7b, 0x825b4c573678734f, 0x76097e2f24da6013, 0x105cc87265fe1421, 0x68b2074f0d5fdcf6, 0xe768a13b205b221e, 0x3ba4a62ae47f793b, 0xb6d353654c867825, 0x489cf3e941dccaf5, 0xb0d52d08096611e8, 0x1fbf412ea37caea5
+, 0xd43de9c44f53f748, 0x4c8cf47cbae622c8, 0x45211feee929bf8a, 0x26a66d810aab9d79, 0x6ccf1ea0a77bfa58, 0x169ae458815c9d57, 0x2c7b3492ed30286f, 0x08688ebfbb514617, 0x82ab20597b3e5edc, 0x2627a511b2eaee77, 0x83b1cfb0c9116689, 0x2034ff697361dc15
+, 0x7fc79a1631537e49, 0x3ab3990181ac3708, 0xda1fdca7c3d88125, 0x303d5863a7d393ee, 0x8aed4aa1fdf067a9, 0x546161c7be54338e, 0x08fff3a9d8c79fdf, 0x67bc3facb8a151f3, 0x5e3974ed48499e46, 0x45f9c1151798761f, 0xb957b9b9ed8dcab7, 0x0c8fac8e19462127
+, 0xcae39684cf56a484, 0x0fadba101025bfba, 0x398281e05b422287, 0x5652a1007245c4e1, 0x4c89d26d7f8545d9, 0x458f0fc8f3079576, 0x8f0c1c44e028bf2d, 0x0ca9c148b334a763, 0xfb5fba19bff353f4, 0x29f14f9efb756817, 0xdf92abd4d663ea38, 0x3cf4e336c99f0e14
+, 0xdec563b65fa09400, 0x2d125910412e52cb, 0x7068535367de66ab, 0x5e7cfb8cd59b0108, 0x894a89e4a81d52e2, 0x18f3e5a6e58323ed, 0x9e0b737c801aef30, 0x2070abc22e3ccceb, 0xb00d5c203862a6c2, 0x2848b573cfbd6ce1, 0x7d7d46b2f3d2065c, 0x7631356e8b44faf0
+, 0xc6666fb982cf6d89, 0x172a42de65181f47, 0x439b955db1d4585a, 0x31f67de6b6564751, 0xbb6b4b8f6e02dc33, 0x4f9e7771ea64b88d, 0xe4720c54d6240074, 0x3486e977fa4e0841, 0x9fefda26dd085933, 0x712e12ba605a4cbb, 0x1c78dd399e05bc50, 0x3f2b5ca90df6f29e
+, 0x80f8f9f5adf59c02, 0x18106b7ccd61c1f0, 0x53bd4ddc9c8010e1, 0x320183850922bebb, 0x49890f948baed0f2, 0x2282baaf16586334, 0x237789d8e21be5f6, 0x74e8005490702732, 0xea20f9edf26408e4, 0x6ff42aab8f5b0010, 0xeabc7dbc76c814be, 0x47b529fc75f0d12a
+, 0x4f6b882228bb466a, 0x608972b8215587ab, 0xf4fc31dbe97043dc, 0x08d24258f6692ea4, 0xeab138e0a43398da, 0x5736f4327309341b, 0x53848ecc95e19638, 0x53ef5919b587d8ea, 0xfd88980517cdbeb4, 0x783a070bac2aac4f, 0x38dc492295beb19d, 0x34474c7d73645db8
+, 0x947cb4f739e52c02, 0x18c65e5f340ed98e, 0x0f74b2135762690c, 0x660660f8d916d270, 0x89a6577b686af0b1, 0x1c09ee5ad79419a3, 0x964b4b3e93c72744, 0x1970864464c7554e, 0xe7c7501a6c6bff99, 0x391bf2521d0bf6a7, 0xfda6c1ea9a877e8e, 0x55ac214851664026
+, 0xb1da63803f47615e, 0x08c6c090fc3368f5, 0x08aee6e905b8caa7, 0x346a914a8812a685, 0x9ccea3cfd7490a60, 0x297f3247539bedc2, 0xf0a3ca6be52a7ed6, 0x0b63bc0613b0e9e8, 0x219b5d2a41ba95e1, 0x29369dacbd8a2c74, 0xe3f97d65585665bc, 0x4a554f7edc0d0249
+, 0xf2f3c6ea90bf3e7c, 0x67e50f3c6e85d2c8, 0xcaf939efa8a029a2, 0x5ee73b5a1bf3d6cc, 0x93abbd5faaaf0407, 0x6c55a9f448e4823e, 0x571cfe0cf1a3be1b, 0x2aaa32d651a08037, 0x995739c5514cceac, 0x3629eb93a0f0cc9c, 0x583550993b5b43b4, 0x4620a856ca02577b
+, 0x5f3fbddf2b5c4681, 0x472bc0e59b099a37, 0x55da170e180740c6, 0x6bb12fd64a5329c0, 0xbd1b0f65ea3ce5a1, 0x036c66201862035d, 0x7adbc9f27ff715e8, 0x20d0d40b24cb8355, 0xbd74e274770cdcdb, 0x7c5a6078d77b80a4, 0xa1d1773df6c9da55, 0x5966dd6902927c29
+, 0x6a7df93bb3b6cc26, 0x631681e89cc4c371, 0x21a67d922b5f6da5, 0x56c82d927d1768c8, 0x763dbc2a0bec326b, 0x5d9ebfa281333169, 0xe2760a794bffddc4, 0x2fca75cb4ebf109f, 0x9399afd3d0621ddf, 0x699ee808276ef599, 0x49353dd18afbbeb5, 0x4c4c24759f0b2d6f
+, 0x716b46891483668a, 0x09a073c1e187d806, 0xd07277016c4f0f74, 0x1abfb0668494be51, 0xddfd5861ac48023c, 0x5b598ae04a792061, 0x328deee48db31c54, 0x5a45f6db62d98e95, 0x4aa807e12898dd88, 0x260050231efee5ea, 0x711af48a9814ec55, 0x2a5a82697c9124c6
+, 0xcea0ab9464601577, 0x5bf385e18d07090b, 0xe84ec9542111dc79, 0x7107321daa99dbee, 0x25c3f76dc0e0519c, 0x332a3c6ce1b0e84f, 0xd7427ebd504d5a09, 0x27216b41b3834a56, 0x0417f675fd25d4d9, 0x571222a07fa5ae31, 0xb597048a14b872f5, 0x66436a2e4dd2bba6
+, 0x9aaf85e732408cc2, 0x5643d2a0b7013d93, 0x2d8fac4bac214bf7, 0x7707dbea71764cef, 0x291e81a16f1f3d85, 0x29cf73a44d4afd06, 0x3f2602a5aad85b5f, 0x579a387de89c65c3, 0xa17c0a17500fd8ff, 0x5eb498047e386e00, 0x96e2943258c2c7d4, 0x62f0ba3a19956a43
+, 0xf4c0d325485ab30e, 0x5ae5293a318fa791, 0x68221444ebda622c, 0x3b60b297963f62f2, 0x44df2155aa58d1e8, 0x19386074a49b92af, 0xdb2733453a420c2d, 0x143adf196a74ed48, 0xde08eb66816c8df7, 0x2d995b2dd5edaf41, 0x3246fcce08d4f3b2, 0x138028b92defc12e
+, 0x57abd2dffdf6ecc4, 0x22cfe45a3a30519a, 0xba664d1dbe1257ce, 0x0abf51c9c9a87e6a, 0x7373f428542f2116, 0x6e10af0e301b226a, 0x86a72538cd9fe015, 0x796207af48caece2, 0x4cf4ce9ef6fd761e, 0x79a15dc491248095, 0x5bfe535d661335fb, 0x3947dd6ca3d23cb4
+, 0x38976f64b83fd7d8, 0x44456085bc23bbfd, 0x5329b8a626c7826d, 0x78ff86c00051e8f7, 0xe13739118163e7fe, 0x10f7ebfa5059e7e0, 0xee18a1b68506a2cb, 0x2e422435ffb596f2, 0xbe69b439604c3aed, 0x40ce2fe1536657d3, 0x0115c26ac8bb8a03, 0x088e7364fe9da83c
+, 0x793bf8acbe69f95b, 0x27d4770d8f1a8af7, 0x29505c916298b634, 0x217547c2df179b43, 0x843424d4a9678df3, 0x6a1a30d2fe523115, 0x27a52eedc05f6416, 0x6f0807daf1a9a798, 0x9d810a7471fb08e0, 0x1e095713e2b44c6f, 0x010f083426142fe0, 0x1af36e1ce278651e
+, 0xcbd2da8f3cd7d094, 0x5802de40875fb99c, 0xc5f3ac425fddb65c, 0x415b8aabedf9661d, 0x08f5b64ee0df03e6, 0x1d18bd3e36aad8b5, 0xf55c012b186c7743, 0x410ce23b126434b7, 0x8f2e3f6239aae182, 0x591bcb2f81fdacec, 0xc128d438321b9930, 0x02fc057bf7088a96
+, 0xa57f183a4a2c35fc, 0x74d09ed2fbecdb7c, 0x7831355286d2a693, 0x509d8b70b24216f9, 0x507377466da867c0, 0x152eb8df8dd8bc39, 0xb16472637d8d206d, 0x6e6a52cd93376257, 0xb8f7f97c52f006c6, 0x79fbb77184b30f2b, 0x72839fc10f4a0b0c, 0x22c768582b535b51
+, 0xcc02db47422af8a0, 0x5c639318b66eca68, 0x11d7f978213f73b0, 0x02c964732df42d86, 0xf6a51fff41b960a8, 0x3a30eb0af3773fd2, 0xa502e340a47e059c, 0x7a8da768a5aa4fcd, 0xa9675d028ca2d948, 0x016c7bc144e515c0, 0x8962818daeb5f2d1, 0x5dd9f2bb1b3bc94b
+, 0xd545577c5c3722f9, 0x5e8de6ff5f220d99, 0xbf77f8d6229e96b4, 0x7cbf84e2ae8dd01f, 0xbf93af262f10a82a, 0x641e00ba37aab4a1, 0x5ebf1177c4db673f, 0x7244cf01acff0ed6, 0x9fd7776f266a648e, 0x495387507f822f42, 0xccdea969b1de1a1d, 0x2b48406bcf961e40
+, 0x9e8093ef1b1f7833, 0x2bdf81ac12ffabd4, 0x8bcf479de2ee4253, 0x7d571b3e874815b5, 0x49c6dab2a4908621, 0x1b6fd981fc5444e6, 0x1bc77d19d0a6b545, 0x7cf6aaf7a43c04f6, 0xd4f9b69d5079468b, 0x28bf020aa9b9da4b, 0x148c333a1579f0d6, 0x2095f81ed37b98b8
+, 0xcc312821491c50ac, 0x6c3d998f9c79a35c, 0x83b33255038915ff, 0x034e2646aceabd10, 0xb5fae7e8eedcca45, 0x49211a8f28e707ec, 0x59db4ebb052e6a4c, 0x687c876209840139, 0x57363eb73e421588, 0x1f8001728d25d50a, 0x7a15b9ef2e08783d, 0x0177463049ccf1fb
+, 0x6f3092b4a34048cd, 0x651cd2a99de187aa, 0xbc12d381a2ee67fe, 0x422321ed7744a3aa, 0xfb6e1b9edf5673e9, 0x3ee6a42b7312da70, 0x5d9db166c5acae70, 0x0d601e946d2b135b, 0xe62d2732c644f72d, 0x74d4b5055baca58a, 0x32245b564dd980c6, 0x49837660c8eae062
+, 0x62681bda06cbf7a9, 0x5fd2eb6845c30580, 0x586ada5cf26dd1d3, 0x3aac6b909e8e1c21, 0xd2df49e3deb41f5f, 0x055a70b5e1cd53f9, 0x0642777434e4865a, 0x5222e899afcda569, 0x4ba0f61846e9b854, 0x3c8c70c4f08733a1, 0x662733d16feeb72c, 0x54f8e1e9d0187011
+, 0x15a93694e572d014, 0x028968d24e459b98, 0xf36181344cde7157, 0x732d7f8430ea0cc4, 0x29fbbdbbc62fd0cc, 0x7ff37a3091b6f3bf, 0xdb79299c21cb62ce, 0x051e0e817f4c2a2a, 0xed9c2c67f8c39ebf, 0x5a937fe7b26a67fa, 0xa2a56d289915c481, 0x2c78fdbaa0cbcfaa
+, 0xe9fb758e4eb721de, 0x15ab6da6994727ea, 0x7b203829f2c519ca, 0x0a5fb852d83eb8f4, 0xde73b4e42ce38a11, 0x4f88035c7ac6b306, 0xc01d5aaf0d5d811d, 0x7b0d697d9d623350, 0x22fbf37b874d4e90, 0x479a006a0e023601, 0xe1b5e807f46b683c, 0x7fd71428cb57b671
+, 0x7611e17b36223524, 0x39bede2587f456fd, 0xed170c62c9b8deb5, 0x3c88099cf6b01711, 0x857eafb650a5b119, 0x7f48dc0987f5ee6f, 0x4aa4855e6928464c, 0x477730ad7e8fbb19, 0x5d82e37cf8472b68, 0x5239ed08bb4ae7b5, 0x849208c28e1354d2, 0x119da4ee010f13fa
+, 0xcaa7a14b639a8243, 0x46b00f3e45e38559, 0x1b34bdb4b6af35a1, 0x5fbab5d0e1ac1c00, 0x0585c6fbd3fbdf79, 0x3fe6b61883dc3d13, 0x2a1993af009c1105, 0x344e1580fab86a45, 0x88c22dfefe989921, 0x550cf607c8b9f0a7, 0x3f11e5410e2f3351, 0x1235a3a350f36384
+, 0x3c41eaa032e0a717, 0x6b1c60c8bf9ca24f, 0x3fa038455accb16e, 0x01475e74cc9f7bf1, 0x85ed5ce6f4c79011, 0x1e38c0dfe1c78e5c, 0xf67f909c6374743b, 0x3835debb5fa23643, 0x19aa5a7807636c17, 0x33d64fe5d8b49016, 0x089f56c5ec9e51dc, 0x31b172fd4029d880
+, 0xab3a1caba64264ef, 0x6566b3418917733a, 0x041f687183932262, 0x1dca7c61f2ae47a1, 0xacc9b72342d40981, 0x6851730a9bbbfd94, 0x8c18bf47e789a287, 0x6c45fbf88123c162, 0x5b01d12a34e68760, 0x437bb7ec69b29660, 0x9abe26bc05be71bf, 0x0becc342df3a0719
+, 0xc4829a97d81c2b07, 0x1fa5a9a1be379f87, 0x2acc1d2dc85907da, 0x3a2110a7e365a95a, 0x82e2e1b321518604, 0x34e3747e16570db9, 0xdff979858ae2cedc, 0x5d391704de016f83, 0xb300ec6beb0c2d49, 0x37fd26e7ac7023dc, 0x3881000e0fb06719, 0x46f4701728d378dd
+, 0x17e4150cf47455ea, 0x0a399b60d533477d, 0x9fd91a2af8d1709a, 0x673e4e3c3ca29cca, 0x2f89fcc46d03696f, 0x5975566de60a04f8, 0x18cc7b46c1eef735, 0x4bd1f21f2aef478e, 0x693d381bb5dada2d, 0x61d1bba149154df3, 0x51ad479b795b79d8, 0x4ba161fd96fba1fb
+, 0xc3df12ab1d7a320e, 0x190465ac02b9c3c6, 0x0d98637aa4c524f2, 0x30fe9bb4b0831167, 0xcd255c74ef241f95, 0x15fbfdc3bbae4b69, 0x8d1fbd6081a7ea26, 0x5d5f2edabaa848be, 0x1e7a4e9ac19a4a04, 0x351b5d0d4a673597, 0x434f804a5e079bb0, 0x799813f52fc9f2c5
+, 0x04264956db81645a, 0x43efb2a6e6746a8e, 0x8c87ed22237f8069, 0x56a444d6f4821ee6, 0x62de7eb9d9f8e0f2, 0x170fb274a0b8b565, 0x3edd0f0251a4cb1f, 0x39c006c0de195e1b, 0x31a5388cd8d9bc3b, 0x69eb648144fe8370, 0x710c162ab3909f97, 0x3e20fa8707db3788
+, 0xddc2e93862148704, 0x4669add05dc7333a, 0xd7317d44552cacbf, 0x73cd0f584c70ed83, 0x527f3324379b050f, 0x2186df381985dfb8, 0xc180d62010de818c, 0x559d223b2654aa23, 0x37f611abffe171d8, 0x560164efafa04587, 0x7e397e756d9ad4fb, 0x6c8e424c1d0ee0e1
+, 0x50c999fc14df413a, 0x01b41c8fa9aaf018, 0xaf08f5e47ca099e9, 0x38a428e79ecf5aaa, 0x3dc087c7996f0d04, 0x4e11bbda11140f4c, 0x50486841c64430ff, 0x07b5349c2b4b326a, 0xdfe607759c51d9a5, 0x51d448d8bfe2b603, 0xe714ff97d41f0f28, 0x1c0cc83af449fceb
+, 0x7a30ddb8dd866155, 0x15825a86a8836b4d, 0xdab672a08c8cbb5d, 0x3a3fc6d89a697c42, 0xbbf31e7bc36988bd, 0x5981847bea08f20c, 0xbac23176206c4e66, 0x44ca17980c4b0f27, 0x3a8225dd5104acdd, 0x4efb09ed206f1fac, 0x23844c9d226684d4, 0x4fd728925822e97a
+, 0xba8748b7a61061b3, 0x12cf362a04f8772e, 0x55f2a96d1ad387ca, 0x41bc14a1a7c2e428, 0xb961ef1d6da70e7f, 0x1f04268675b67677, 0x8848b5679a6a3678, 0x00fa4c024c010f23, 0x68fca909bd66b613, 0x43f4f7587d4df73a, 0x487df422811986b3, 0x0e4c1cd280af444a
+, 0xfe6b2fdbff7b5ab2, 0x078e4d6fac6ca482, 0xac8da8415504f51b, 0x4e91e6eecf892a14, 0x85c93c64152a4ccc, 0x7c44560761bb5a2f, 0x48b07321e655a7be, 0x3fb2a50989662185, 0x7d87bb0478354242, 0x7c1fd962323515f6, 0xb1c49afbae0f4503, 0x73399853ed2cb49d
+, 0xa293dfad39369f65, 0x04ebe6e1843245fe, 0xa19c9e01a6d67faa, 0x1014237d79b99976, 0x32c150acd4cac868, 0x2da68f3d34a27691, 0x9901d8c3ef9ddb7f, 0x048665719ec6fd2c, 0x7004dd8b1308332f, 0x6cac60bf1ac7f1af, 0x25fc15a7f91c2f9d, 0x60139a7f7b92f0a2
+, 0x1c00d0858e579e1b, 0x388f02159cc55545, 0x4a00f53440fdfdfa, 0x6ec7efb124892096, 0x80a4a786f2fcd38b, 0x75dec61fab200b40, 0xe423e89cb80ad143, 0x49fee56fad86b63f, 0x58b259f6fe49c8f3, 0x318da749cd7fcfe9, 0x6371ef315aad67c0, 0x613eaa33ccc7b8f6
+, 0xb482318d816f2cec, 0x14e457ef90ac14f3, 0xcca573f44212b299, 0x12dd9b305fb157a8, 0x4cb9d8cf64514a58, 0x392dc380371a0a9b, 0xe18201af66a8e7ea, 0x5aef6d40aa7b6340, 0x04310e96b969123d, 0x75113edff228e023, 0x79234a2ffd490676, 0x65879c464ca2d3ea
+, 0x2c52bce5e59b07e9, 0x48f4cb47de019063, 0x42b8ddc4b3f83698, 0x38836e867bc74685, 0x49dda22d4ca0d9e7, 0x0169b2fcbb5c1bbb, 0x658bacecbb788770, 0x70033a52479fb5be, 0x4b554a29531ddc73, 0x1f5c4870808f5168, 0x93e02294d6ad8777, 0x32b6d21c623a91b7
+, 0xedfa9de662efad9b, 0x7b0f1d224fd85807, 0x751faa831fc0af5c, 0x2bcac644de64596d, 0xe89153bfa8a8544f, 0x7020b31d7abd5d75, 0x9328488041d4a72f, 0x25db82a4f47c5411, 0xa9c4f75b5ab3b705, 0x454d5b1492361dd4, 0x13fa8a73ab74fe83, 0x5fed8b9736b6e1f6
+, 0x61a7efa3d2ea32e3, 0x435ea423fab06c81, 0xbb9d08b85f8115ba, 0x412eaa478e59adae, 0xc206a7bab3ee7ed1, 0x1591d5ae1cc928ad, 0x65fe027b7ca05ed6, 0x1e08be5d925a8212, 0x87ee2c64690fa873, 0x79baac55a5c3301d, 0xb67c699a2cdb61ad, 0x565db0129e65b8be
+, 0x47e7f7113f40b7e6, 0x0ffd627f5fd4a534, 0xf4db027b3762b418, 0x531fddbb4678f70c, 0x56f39186291535b3, 0x611620df0e85fd6f, 0x8c4789348c5aacd7, 0x525c5204434f4582, 0xa7710e6f127cfe23, 0x312972bb4466997d, 0x8ec1493f3b626e37, 0x0fadbf9d01c6e33a
+, 0xe6b1fe1b53ea949e, 0x6a87dec422ae8db3, 0xd21ec01010662194, 0x0cb0d68166134b18, 0x2b6387db6f2431a0, 0x2eed3bf379dfac1b, 0xa692e2b85737edd8, 0x3813a5c4e7eff5ba, 0x4948097ef3c9c266, 0x64f4b3dee2ccc3d5, 0xf5927ff5d9f9c794, 0x70231cb6521ca8d8
+, 0x872338dece45e088, 0x29c81a4593ab81e1, 0xf15cdcc29f76d6af, 0x271981e5c471c177, 0xe739f7a1c45141e6, 0x2e7ffa04de105b28, 0xe87b0bbf69863add, 0x5ad899338267b1f4, 0x4ea27062eec18236, 0x12e700e79df32bc4, 0xd820b474eeecf247, 0x363a4b3a0badb1e9
+, 0xd453408dbf714127, 0x56d3413f067a4988, 0x6db4825d77369e5b, 0x1093d9f63d16e9a9, 0x9cb706214719e8e8, 0x6c56d8099ea2b10d, 0xb30f863eb29e1fb0, 0x5eb58437e85f54f6, 0x0a3386ba6186873c, 0x6bf068b83ad1d300, 0x917a6b4e8bd87863, 0x6a06b6b10f1ff934
+, 0x6f8a1692d6a5e2a8, 0x014263c0ac9e2eaa, 0xff6d31ea329d6b2f, 0x08d17181991c28d6, 0x37b27522b0e848d4, 0x7cc24b576122f295, 0xfc5f1f6acea33ca6, 0x30fc53a8a9c27bfa, 0x95e826fb9fc24725, 0x2076e792177c6ffd, 0xc13f79752d1d5ebb, 0x7147a5b7e6f6bb31
+, 0x53373012379d28d2, 0x66a93825ef445140, 0x7737a8d04d5b44b5, 0x32995638dee6389f, 0x46003bd4a4c095b6, 0x4acbefc11e821417, 0x8b0a47d65f5459c5, 0x264aa1dade533957, 0xead308214cfd743f, 0x3a998850f9e0292c, 0xc22f47a4bf3db567, 0x5948d2489bd17838
+, 0xe608e0ef5b86eaaa, 0x246e3d9b9a8fd342, 0x81b7c9088a27c485, 0x58e0e52f8dc14b5d, 0xb8598c08fded532d, 0x6f41b19f029c0217, 0x8b2f68c260b9ff51, 0x1289287fe51a7700, 0x6a4224f360da78e3, 0x560d73406167f359, 0x6fc9ab2197f5becf, 0x6dcb1a7ad42c516a
+, 0xa4d522d0f69c520f, 0x3f7b3e6b9adad3e4, 0xbfd28879f897d171, 0x5d1ac891c0872765, 0x786e463ccab83c42, 0x6d5df79778ba15c9, 0xa17d297ff138602b, 0x13733d2faa99ead1, 0x1c18ea645f45f615, 0x2e6aa466a8a94905, 0xdd0ef35c59c5dd07, 0x32356e4c68418ad8
+, 0x8733ea509f798b3a, 0x4b7e40d873e13e32, 0xa13a3c90478af16d, 0x120c6a473c4e60b9, 0x3fdcec82423d9647, 0x7bb2d17d5c994df3, 0x8cb20e9a16d757b9, 0x1def8e98e7c7c0d4, 0x148bf4f58596c6c3, 0x6f40075de500f9a7, 0x6fcf00c94962e72c, 0x6101d6f31e0d9823
+, 0xaaf94b004a82d259, 0x445d7280aef996c7, 0x50aafbf9f720ca6d, 0x1241b2afda71ddc5, 0x4257a3b6948b7768, 0x18b477f33d980702, 0x5d8d7c1700c1c580, 0x57d02656faddd741, 0xc585a7191ac6517e, 0x72326422f43d3894, 0xfcbf84c6ac221117, 0x0b7f59f6ba588b27
+, 0xda507a1ff1fbc860, 0x747ce96562af45d7, 0x5cfc349db4d54412, 0x1c1e4a9a97498e6c, 0x8539a67ca4f5790c, 0x20fa9a8e3bdabb2a, 0xfaedcba86109d60c, 0x740f8def7b5544c7, 0xc641999e1634b60d, 0x6bb9f4a70ad1e6b7, 0x3bb055291bea8cd2, 0x6ca36964ce0c84ff
+, 0x0674b712290b1675, 0x76b7a750d7a9fb52, 0x2653c29ce0469e95, 0x06f757263ea0bedc, 0x6ec09cd845f99e02, 0x686dd8836818e59a, 0x816ca0dae5223422, 0x581e2a225e8f72fc, 0xae37cd3a41645faf, 0x0f2e5f78f7ed1265, 0xda49a07f32f27d5a, 0x314bb08484d41833
+, 0x480c9871b3f1093d, 0x4c1b9f539dc009e3, 0x473e57ab20260dd4, 0x21236b61d7885a17, 0x7ca67f422bba4b53, 0x6f7ec0ad77735058, 0xe565434d7d3a5213, 0x35caf08eea3436cd, 0xa73a54d779cfa399, 0x5b6edad4b10a05dc, 0x6f45f84cadbe5981, 0x28c3de4135b7263e
+, 0x3439369d33be8a4d, 0x1c215dacf9d44f3e, 0x6b88ab63758a5352, 0x298fcf350c23c54f, 0x95fa062c23a70fd3, 0x591656d4cda3c595, 0xe3b013169463bd40, 0x09d863f66dc4d3e6, 0xfd109e2ce454138c, 0x1b9602d8968cb09c, 0x84a6a326d95ae2a3, 0x582bc0b0d3401212
+, 0x846264aad9e081a4, 0x38fdad8e3a028825, 0x29cddb2c4dde2832, 0x29cf9caf8bafe768, 0xb1536fd4d18e8fe5, 0x3cdc3cfbecdddfe6, 0xb4d7d288c9e530a4, 0x79811993ade2e484, 0x05162f44c9f6a28c, 0x65989d79b25f4009, 0x5ade67d82ef241b4, 0x0af085f7ecf1e230
+, 0x2385eb05ab4eb20c, 0x665b8bfae6b1f289, 0xe42009cd959a44dd, 0x19efacd407c8d4aa, 0x50bec93afc77a3c3, 0x0112989bfa2df895, 0xf0f280d19b969c0b, 0x0883dec94540c214, 0x7105d8dac75db618, 0x3a8f5a5a7765feb3, 0x41a33eae28056929, 0x65460db3d218657a
+, 0x8b50e7f9d11f55e9, 0x58e5020e1f594d07, 0x6ef3e0ffd8f344ae, 0x181e5f49784b7812, 0xc25ec95b7754f3d4, 0x793ac08199754ba3, 0xef0b147ced5f5596, 0x4bcd3ec61e281e7c, 0x347d59dea576cf31, 0x54c77abd8eb67292, 0xbb05b1d4c0cbf782, 0x72c134ade4ce0416
+, 0x33fb7b905ff004f2, 0x4d6e01ac8ef602f0, 0xc5be16f0159918c4, 0x237d12d57622e526, 0x5117fab8cb94cede, 0x021d7e0441936e4a, 0xe2e1d8ac8fadcb1f, 0x7bf15ead9891325e, 0x2e287e39a49dbe70, 0x367ba76d51cab085, 0x83fe70f49c4298f4, 0x59e606f783d0be4a
+, 0x925c0e7cd890d046, 0x778528e37afa703c, 0xf185d905b103ec17, 0x53d3214432655af4, 0xaaade7b558896a94, 0x2e54b39c58a90eb1, 0x886b10f438888df4, 0x7d46b111ab8f9bab, 0x6102b8a949568bbe, 0x09670ee9fd6602df, 0x25f835b05ee53325, 0x4b36107f4b4f59b4
+, 0xd2fccb4e66b2bb33, 0x409bb90c519db303, 0xbf3e48c61aef9f9f, 0x0c0147cc1b14bf2c, 0x00f6e298b200bda7, 0x347020de02ef9204, 0xa933abdd654c9633, 0x1951952519c80837, 0x8d90babf9b3813f0, 0x07fc3fa4d9a9f4a9, 0xc9ec4d5461da0f63, 0x4b2add14dd734c95
+, 0xad08c462e02ad436, 0x0e8598262865ba47, 0xb29724a64ab66879, 0x33e7716d4e20442a, 0x45104fcb403369a7, 0x2960816237713f39, 0x47e6306785b0158c, 0x17ee7584f94dbb1b, 0x45f930a6735b0a3d, 0x708b93cf5b0d3e0c, 0x180f7aaabccddb1c, 0x6f92b3bb73b3042e
+, 0x7bafc38d17009810, 0x59cb0fd43c1fb08c, 0x466d6fcb7c253c0c, 0x19a5e70ce5de828b, 0x5a16b856cf1376aa, 0x74fe4e532b757b97, 0x2f3400fab06bc641, 0x551bf6b25ae3502a, 0x28d782e9f6deb788, 0x6d976bf94e5952e6, 0x7a9a322e41c5a7c0, 0x0bf507a1b2516fa4
+, 0x2b57a1eb05ab360c, 0x56491a1a07e4e92e, 0x72bf39a2519415a3, 0x6f15527f3e073a1f, 0xb68c08a032c3759b, 0x6a445bf73ab4c612, 0x725cc102c0a1cd4f, 0x396270d776c24419, 0xf4636505bf732b48, 0x44ea8aba48b88f6d, 0xbb62bbf9c49ed6fb, 0x16723c1ebe22da63
+, 0x193bd5fe1fd9ef7e, 0x1f3f0dcd4455fa93, 0xa41e95b6313758c0, 0x6db55c229eac7ec4, 0x2cd6e2f4ddfe281e, 0x1b6378d9e5ac9448, 0xb667974380cde732, 0x6df2c41d18d2a560, 0xf18c77939be2bb49, 0x17baa9421008f7f1, 0x8c0e37b8b7631d70, 0x6418a5ac23b867c9
+, 0x33fc1147a26fbd50, 0x2e9ebe35f50ba31f, 0x2e0adcdf5d2c0f0d, 0x311507608f63f457, 0x851ee3d0217e8c64, 0x780196abbe19da6f, 0xc46ac5f8f7dab8ce, 0x56f09110ac05199a, 0x982f10563f3c2c59, 0x67a04775babd37ef, 0xae1bd963ef6eece1, 0x57960494fbcb4b67
+, 0x53d78f8d5da10ad0, 0x7200caee7c3b429f, 0xd7c9dbde558b10f3, 0x5bcdc464d65858f5, 0xb2474f73a166d880, 0x1c52e540d21934fd, 0xe7a5408fb9864516, 0x44e5817350c2ed22, 0x9c91d364cbda162c, 0x624797fb4e2e9c98, 0xd0cd8cca83293adb, 0x302ad5ee6a0df997
+, 0xd6ca031fce3112f2, 0x7201a4fc9fea423b, 0x9c131df145a04d31, 0x634c750241592580, 0x869234b4478ce412, 0x3068a7891111606b, 0x942798609ffe4588, 0x3cf901be864a3ddb, 0xaf8703c3e3723f76, 0x0d9fe621817755e2, 0x8fcf67b688b4f697, 0x092f60107ba8dd94
+, 0xde5f30047a8e1a08, 0x0a6ccfb431685729, 0x730951efb52b0702, 0x5f0d7e2a91d6fd7c, 0xa3f7bcbc750384dd, 0x2c011efd53946378, 0x5b8c5d85327d9153, 0x04ef2125e9b17def, 0x70a56b6a8c977163, 0x446c2f9a52edcf04, 0xc5f97de20ddbbefa, 0x47fa874650bd4c86
+, 0xad1bd6c28ceb511f, 0x68fe4be8740d3317, 0xc4ee80b71c2e00a0, 0x45c8f906adfbe23a, 0x023f0be11178602c, 0x04df7cf8aa3f81fb, 0x52e186b123dca397, 0x716d80b8a47cc781, 0xf969e6382aa0d035, 0x62f977ee5e402b1f, 0xfbd9280f2405a61b, 0x1e75d1da493870af
+, 0x6a3d51ec7751af71, 0x6723cb52013758fe, 0x7f6d259b4f2dc590, 0x66280ae0ef0ae73c, 0x308a2859a57a65ba, 0x66a395a519043bdc, 0xa3d30b9dfe1bda0a, 0x7c6030bd3a59abdb, 0xc6c48e120f8c713e, 0x6d408f4706a11573, 0x95314014ed29d9d2, 0x14efe504846d1665
+, 0x815b694bebb5e702, 0x6c3ee6eabb286b43, 0x9a008fe17dbaefec, 0x4ab55b21a53fd314, 0x8de992a2bdeb82e2, 0x3684109084476f05, 0x94611e4b4e6b0a5c, 0x7b45c13fe5bb67b4, 0x0e61ef4af67b69aa, 0x1062f67933820b65, 0x297a6dc5741da789, 0x49d8f42a7948ada7
+, 0x920b661b1e8695d6, 0x643d922f5dd56921, 0x847a97338f991d65, 0x17d1556932ed17f9, 0x121a5761d969a220, 0x6bfdecff66f8fee3, 0xfcc87131f7a39757, 0x1a94d84ed3c09872, 0x711b1578d400f9c4, 0x1321fbb8958f014f, 0x78e9e00f1caf3d15, 0x6d3cbf5dc60f05d5
+, 0x54904a4fa0ca5038, 0x4031105661c131b9, 0x3007f966d5cf4db1, 0x71d4ec73aa019700, 0xab6c974d2205767c, 0x00c5637895b9cae8, 0x61c03e0e18c026a9, 0x7f08629c6d1f1944, 0xf5c2bc4d25c4d900, 0x29f80df5bfe26815, 0x9c94ebedc751ec1e, 0x32941b9639bdac8c
+, 0xf63aa598f1f3b252, 0x1c9cc8fef1fa38b7, 0xa9e1e44edb2e7b88, 0x3dc28e921f36245e, 0x98771eb63a09fdaa, 0x1a02b33e4ae539e6, 0x9b11cadd81e655ab, 0x493f253d9abd0035, 0xa2d6c2df267d6e91, 0x234658199d26cb2e, 0x699a4133e87c4221, 0x0f9b8c729de62a41
+, 0x1882aa88e754ea1c, 0x2c3bc36e3eefe935, 0x74569ec75a999375, 0x6ae943292b3603fd, 0xa97b56705546d8c8, 0x30dd78078c33943f, 0x97c708a57cff1ac1, 0x36fec96f3f0ba5b6, 0xe43c46fab849bfed, 0x7db4a94d5eca69b9, 0x4a96b712d054e45c, 0x3c1af097232d8e41
+, 0xdc7fdf023c479124, 0x004937ab54cd7b92, 0x664fab2b58800049, 0x26c21ee771339edb, 0x5e87701144a52a42, 0x3a9dba8f6af0fe1a, 0x6286c099aa31ee0e, 0x705b42496c608e85, 0xe8df13f53b94f610, 0x3a7cd7fa2ed37d26, 0xbd1b9942f60b6375, 0x4b226e88cd99a1a2
+, 0x9b923a8671696f6e, 0x705253d398f39255, 0x377f58fbf77c830c, 0x1d215dddc418db2e, 0xe1ca24249fcb206d, 0x39fa41382cdca490, 0x427337cc48a5d6e8, 0x5cb72bee0a6869ba, 0x2a3438e0ea3577de, 0x466a54c1908daec0, 0xfb89707bf100d726, 0x7d3b16bcfb284ae5
+, 0x2c05baadbfcbead7, 0x00a8f13cf31a73c9, 0x42dd9b29aad8371c, 0x27cf85b53240fc49, 0x82dd5d7fd03ccaca, 0x55805ecf1dfa2f11, 0xd4f9134e9cc3ce26, 0x0df672165adae596, 0x958b3f37fdf2efc2, 0x18d0ddb0f4e00552, 0x7d39a14e1e598a69, 0x51d231f578a38f33
+, 0x3848d98ec7eecb31, 0x36eaf4aed1e897ce, 0x87d959a5f32ad718, 0x56b0ce801d0cd435, 0x6386069b3b07d41c, 0x20bd53ac31c0e9a4, 0x0c961057f6ad9da1, 0x505987bc68526079, 0x83d076af759a5df9, 0x42218b60d4cb6a28, 0xc243981bda839b2b, 0x0421bb675dbde076
+, 0xad72afe2d722d3dd, 0x5afa9e0af01277c8, 0x3b4de49e34212582, 0x0c4f60c7c58abf14, 0xe0266b9d32fba670, 0x0c35e03d3ba8e831, 0x8e68851f1da5f0a4, 0x049661f1d5a89182, 0x4d6592d2f7e670a8, 0x729b8e0550b4e88b, 0x4e523461cf73cbeb, 0x0dae99be0ec5a7b1
+, 0xf7dcbb942274a6ad, 0x3d63dc839c5d60ce, 0x7d33f7fa0431e448, 0x5a67ecb2f77e80fb, 0xa6b884e176746074, 0x67291252bc654a46, 0xa0af4654e63cc86b, 0x2b2a744ff6103c12, 0xf9febe93ad986cea, 0x4414a6ba5496bcc5, 0x62853e8b0d1dec69, 0x7e6e9281c821f87e
+, 0xcd9e0764347ff2f4, 0x15e0d20d378b1021, 0x1e377499fd48ce25, 0x0d5f2247aac79f07, 0x9cf36b14896ae3dd, 0x7a8cdc20464846f4, 0x7944f1fe92f4eef5, 0x02e4cc07926b5525, 0x67b43833bc8f7caa, 0x7d2159d9a292381b, 0x9e24fe38f3dc88af, 0x33796ef903e737ad
+, 0xf004be3720ab2dcb, 0x789faae31ec684c6, 0x773a0767b159b9c6, 0x3556f617c44216c5, 0x6373ea63f282da6e, 0x71d34e136b097a09, 0xb3110bbfbe6df62b, 0x0d30eabe01a3a69e, 0xbe605faaeee066d7, 0x45fc7183df0921d8, 0x9fc2e7b612c250ad, 0x5c88aa2f8aefbc68
+, 0x0ea5e2a0bc5d7a57, 0x5313941c8e33e989, 0x8e5b771062c15ae2, 0x00976ad7af2649c3, 0x2a345e42d8e4e3f9, 0x085a970687eca50d, 0x6f499979f3d93c88, 0x5fcdca472abbb967, 0xc9f7013c79d9a21d, 0x1cdd30154065854d, 0x91668c462cb3328e, 0x096b69bb8ba79db1
+, 0x8d555fbd87938ece, 0x31113fcc1c415473, 0x433cf3edd8f80bd7, 0x3961f93a15f36a71, 0xa18e3e1b101e1639, 0x2896a4b7be15e7c1, 0xefd888fee86c52a4, 0x4c07aebd1078c086, 0x4645fc5b073a54d9, 0x196cb6bff309a14e, 0xaead49417f595119, 0x6904f7a095e1fab5
+, 0xa00f51f2afcc175c, 0x730b3d92bd0d423c, 0xb4474896cfe26ab9, 0x710b2c0751a256ab, 0xe54cf185dbc90f9b, 0x7b7af381a17f239b, 0xe562cd6e5a86457b, 0x646302de62f67262, 0xbded0c1f73e5c679, 0x7224f7260b357e1d, 0x340cc61fe5e438be, 0x13472576035bda63
+, 0xfb4b300c02306ff2, 0x78ce6328b828465f, 0x7fdafaf8704be419, 0x48d19a500e301e57, 0x5c33ce05bc8e5e5d, 0x22cca6037e95eed6, 0x6f1bfd999f4b93f2, 0x5a307bf5f8481081, 0x82c2d6fefa4b74b3, 0x3997fe93bf7c9c03, 0x9665be5191c18d82, 0x55382b033af7c3d4
+, 0x325a69eaa22fe358, 0x52ade8f2a2fdd577, 0x3769d93223ecfb98, 0x6ea8fabe70028dab, 0xc508b63b7e21d4e3, 0x52409cdba97ce4d7, 0x479c84fb6e85c1f9, 0x326213d470cc5fc9, 0x2ea54617daf9d25a, 0x4714b6116d643f7c, 0xea209c599bc74deb, 0x197d59a6352b4471
+, 0x0d01e17dabb366c5, 0x5e73ed54dbfe4404, 0xf1e546acbd2978e3, 0x4e8139151b65adaf, 0xe9baa0526472ad07, 0x53437cbb400d09ad, 0x415b30fd38bb7b01, 0x4a3f2e240f8c4d2a, 0x59db9beee52102e7, 0x7b3febc6073ab9d4, 0x70ad00ec00bc98dd, 0x7f953ba9181b4513
+, 0xcbee636504853100, 0x0da1b9e1bd1a2521, 0x7f9a99249898b6ff, 0x0c93c0e63040374c, 0xb9832ff88f9f040c, 0x5ffd93c22e1a0bad, 0x0d2c705ab6dcc281, 0x254482092ba8e53e, 0xd6deb5859db4d0ba, 0x16f33ce41fa0d494, 0x85857a49a9276ce5, 0x30d51826f2ea5458
+, 0x845211cae75e0ec4, 0x2aabc0a3480baaf5, 0xb24195542d600d1e, 0x18cfdabb46be5c9b, 0xc821226b3437f540, 0x417ef2a6df838ecb, 0x002d5b6e77b6bb54, 0x1d7c3d1a2eebe9bd, 0x043433b801b21884, 0x58c5cf126410eb1f, 0x05771261758e4d88, 0x678aa5e458f005a3
+, 0xb44658948f22ba3a, 0x38875419f4c0e9c1, 0x8ce69df6812c00da, 0x1f4e1d9d86a7f1a0, 0x46555f2326007d11, 0x34670e4d5cdb6865, 0x5944b760b2205149, 0x2d6265b407e83bc4, 0x02d5514e2d06c53d, 0x33742274a26370a8, 0x96d680a9d3787ea5, 0x05a80cab3d22ef44
+, 0x938e4f485696875c, 0x4db77337248565a3, 0xb0e1100439b56121, 0x1522de03056ab840, 0xab1edef0d44ca520, 0x7e914033aaa40145, 0x27b5277970b72775, 0x6707d75371ab2fab, 0x01421e307acd2690, 0x0fb1da42c3faf473, 0x717b1b043af74d63, 0x36609c8d265f4072
+, 0x3f4b435d33cf844c, 0x62d4ada865628bc4, 0x433f9ee2a324c608, 0x6ea30704f28fda7a, 0xdff4fc5aada65c61, 0x35e943c1da957203, 0x082ecd71ec1cde52, 0x05c4109a58a48b9f, 0xe53d61104a742c67, 0x7a5abcafcde66271, 0x57b42944fd1d3cc8, 0x7e032ad86e2035cb
+, 0x02f7b130f69e0b58, 0x6b183969ca44def4, 0x928af96efd77bdb8, 0x00e2e949925cd072, 0xcf6e2e483b9092e4, 0x07d8715725653461, 0x73c917709e2810de, 0x5cf9bdc886036182, 0x876dcd3a8947eac1, 0x15783da0323e0afa, 0x1aceeec3e6d1afe9, 0x6cf9b3c45e243fc3
+, 0xd5aae1d2f83891ca, 0x053036400893bbd5, 0x2891397a7b79250e, 0x1c2dfffab65a2966, 0xb456e9755058cc6f, 0x667c50c87d0deb9d, 0xb67841c1a9851f51, 0x6a4595296232e26d, 0x93a8855acf3a8046, 0x1002833e393569f0, 0x4bbe74568f89987b, 0x55312efa67fbe271
+, 0xd35b905aef94c662, 0x5e5ca616ae6028c4, 0xe4983d28a83c9736, 0x1855b8d3e01d9104, 0x870ba972fcb3f7bc, 0x02b952380f18f108, 0x66b4e8a4b29b1713, 0x1c7d6c7d12d1234e, 0xb6a94a42c0aa6f72, 0x68f37ecaa78592df, 0xac1a9ae6b2d3812c, 0x5d936f2ce11161be
+, 0x22a1e664706b26c0, 0x4ac7baa4b443e7c5, 0xadd493300bec04db, 0x6e86d07c1a9625c7, 0x38e87d52e931bcd8, 0x20435da23b5de8a9, 0x33e37f90430a02d7, 0x67cd5d71ac33a223, 0x0ca67c6cbcebf13d, 0x0e0a61ca8b498c77, 0xf0fc35b30253196e, 0x3c1a6116eb998d95
+, 0x72d7be341e76491b, 0x5c5c43646b89dcc3, 0x2b8f1d5eff1e593c, 0x78a48f1ec33ccc52, 0xe1767ca487b7b4d0, 0x44d669d8616c2fc2, 0xc2d3a8f87a372178, 0x6cda0cd1cd76c942, 0xa5d803cbcaa3e293, 0x5e2080ed25743f5a, 0x851f5903a842b9db, 0x2cd782791dc29a9e
+, 0x9525e8a0b76b9075, 0x44e954677a10c705, 0x78a6c4f89fc3cce0, 0x4206dca9fdfae5d0, 0xb02c4ac8b8630c70, 0x5306189eb1e72f7f, 0x3737ab3632e16440, 0x762ca066b98b18cf, 0xefc3c2f49cf487fe, 0x4be08b75e6e46f10, 0xd5fb9a72ca6351a3, 0x22cf35d497fc1f0f
+, 0xec6b17c5147195d4, 0x07bcc5ecfd692b8f, 0x4e59f1afa690e7a1, 0x1c5c24ef1928e9a7, 0x46f360e25940b73e, 0x7fa30a61074d00e3, 0x6a2d5e312a3c039a, 0x57cefa3da30216b3, 0x65b6a5b94da65e52, 0x23d32af1062e7b05, 0x59e6e526acf0f526, 0x20bf1fbf3140b2e1
+, 0xfb5c065865b7b9ce, 0x6e148ea97eb827a1, 0x57232f12edf998a6, 0x5b2e875526e1033d, 0xba8e5df661d63306, 0x2ef74a75d81d9103, 0xe0d3d87d02e3502a, 0x1b60ace2ac37346b, 0x3affde1581485ef0, 0x5c46ce4ec4b768d4, 0x66f10ba527dff2bc, 0x623bbbd424631f72
+, 0x8262f72a8bd022bb, 0x5ea44a74d6d58032, 0x7f5e10209912e1a2, 0x3a58d30cba0bec2f, 0xddef843041a36c70, 0x70e960942864f2ee, 0xdd2795ee56fa1469, 0x19652373dc766d32, 0xa89fc60b31a20c62, 0x3004cd7ca3095d66, 0x7ad32e6ee761d4a3, 0x577b3d9629a75b58
+, 0x11bfc7ea73cdc6ec, 0x10edac1d6e117071, 0xc450a9b78a7afc4e, 0x13552a94d65cf5de, 0x31e7955ca550ef3a, 0x20e17deebfb8d82b, 0xd2e10e993a25378d, 0x1f9c22b848675ac0, 0x9b57684ff6e3bee7, 0x7443c02c8bc75c4e, 0xdbc008b35bcca6ad, 0x09b3f9283cd91c72
+, 0xfc74b1f6657f3956, 0x3ed42084d0d19c7f, 0x4c5ad39ecfefe1a8, 0x366207ca516aa4a1, 0x49da9e7678d18ba7, 0x6f35a7f7a40b6d4d, 0x8c36968f9ef6183f, 0x6bd4d43771018070, 0xa32fbdaec772fd63, 0x4344bbea2a41fad4, 0xfb973e117e55e5ef, 0x3358c23f2325694d
+, 0x53def4f4d97aedd9, 0x68c85de955b6e6f0, 0x4e04841d9ee787df, 0x5c482d358da6c562, 0xfcd7a8f4fdf736de, 0x0b4f59032267fb45, 0x2a0f32006454b704, 0x52e613351af0ff56, 0x0e2bf6a07103387c, 0x6fd1e7615a249c25, 0xc54a3e7d9850b87b, 0x1f9ffec80600be74
+, 0xbce508b9dd0ce50d, 0x10395e5ecd22e0de, 0x501aff853118e356, 0x26d1c3c9d231ee5e, 0x89797286d8dc941e, 0x2b66d787217ad1a2, 0x1c11b7979818028a, 0x1c14971f91a4bf59, 0xe5f55512968583a5, 0x51dd865eb8eb2948, 0xeb43e4ff01ca522d, 0x5d965674befdb647
+, 0x3c2d1243915aac29, 0x58d859eb44a42ae2, 0x093c07a9a7b421b1, 0x61317c61b1095742, 0x9ca2a922894938d8, 0x0f694d6c5842d416, 0xdf013ea0dcaead05, 0x79f8b77a4561d86b, 0xe1a58617627a61a4, 0x4fc1d1844cd2d404, 0xa25555de6234682d, 0x416c135a8d4a7000
+, 0xb7fd0ff2eec24e30, 0x3cf022f7394feb49, 0xe789cbe6ab97e137, 0x2e10b7f23803df9a, 0x1850b8d69c8270c3, 0x72e1ddd81df728a0, 0x814d3bf9f01ceecf, 0x1735004cc45dccad, 0x81f5df647052cf55, 0x03345b0e2e147598, 0xd20b09cb38fe7028, 0x0a6e2eb8fdc3fcb9
+, 0x3d9ca4a1b87719b7, 0x4021b36c6b1ba6bc, 0x68aec5ca46621b79, 0x6dc4193c463d75e4, 0x28e5b96fe191ebac, 0x78f1751e668f01c7, 0x81cfd753525606de, 0x179ace2f67f9da9f, 0xbe97022a54cd1e7b, 0x4ff50140fe8f1f80, 0x793c058d6d962342, 0x48eb95528de0b78e
+, 0x15dd03b9d7bd4030, 0x00ee9b5cf7b75ffa, 0xb04db7dbfc66a92d, 0x6257e550bd7fa768, 0xfe07190805e449d1, 0x2ef99f1ecea2ad84, 0xe6b410fa3f89b2db, 0x5147251d416566e9, 0x3a57c8a47e101b04, 0x3708b69157a5a6d1, 0xf4f2fee38d512cbe, 0x18931fcea26c5715
+, 0xdbc4895f6bb5fe51, 0x36ca6ed64068b1d5, 0x5e4dbfecb16b1805, 0x19bce7e2f795a7a3, 0xa78053950855ac22, 0x63ff0b1c029c0e54, 0xfb016d819c2341ca, 0x2651298844aada97, 0x223b915b8f32062c, 0x558d43ca04295635, 0x2b7b16d571f47a0e, 0x2375e810a36e1b8d
+, 0x9916bd2553efdcd2, 0x2c1d4862062f7033, 0x88bc9a26b1ad9d6b, 0x1b28e3f1dec7b879, 0xbe4e98dc1d9053b6, 0x38d276ba041b4eba, 0x772cadcacfa109bc, 0x5dbd9512479d2f4f, 0xd9832e1d6701c55b, 0x74abed978c769ee2, 0x28bf2e3f64c18990, 0x0f0d0cd62afa3efd
+, 0x1e9b88b14b8bfe25, 0x24f325cfe5d23359, 0x5e0923884f0c1750, 0x053f1decd57ad63f, 0xe1a70de841684470, 0x4a0cfbfc0b6d4660, 0xff34059b32e2eb36, 0x330eab2ef81763a8, 0xdcf81dcf420d1c00, 0x679a2f25ccd74d2b, 0x4e15995e29fdec77, 0x2a6f7064686c56f1
+, 0x2df31b7874f9c861, 0x6b926a080d3380fe, 0xfbe04cf34b65325d, 0x0b01e7aa5d2a30b4, 0x59cc878908d15bd5, 0x6d44e63f33a754a1, 0xf78600653c11249c, 0x574edcc8f5e90b95, 0x031ea406f4c5d81e, 0x3f29387e1f79a012, 0x781fbd64cdabeb77, 0x35e53822bdf8b173
+, 0xbbca10166015b1d8, 0x143167d599fa7f9f, 0x2e4c16607c9baec0, 0x3ff22bf49e1cec2a, 0x2ba6708de3c85d93, 0x06090d05250a92e3, 0x6cf771ebe31b4002, 0x590bfdf010dbd2a6, 0xdd34952ce078eb9b, 0x11f41941a2d40b5c, 0x4fd69a82f7ba7134, 0x0f98e4e5ed08d1e1
+, 0xd755cc74ee91dea8, 0x2a516e93bf1acd21, 0x683d0f1692d10604, 0x307e7f3ece05dc28, 0xd2d0275ed9fcbdcb, 0x59f10decbd8630eb, 0x605dbb3183ec78c7, 0x233f95bb89ba14bd, 0xd0fb01118488e0bc, 0x274a4080e0c9a998, 0x9fa1e9e80af5f32c, 0x37d55834e9010cd7
+, 0xed16837550915799, 0x6454e55ef580664c, 0x4efb51e7c06d902e, 0x3f1bae38d046717d, 0x64c03437e5614a37, 0x30ecfbbaa24c1d31, 0xef06d3a66d69d22f, 0x6b3b8413396db3b9, 0x8aa644e3607df0c8, 0x1b9d4015dc0d4baa, 0xca7f058cf4c49c64, 0x6db59939cc6b73e5
+, 0x741dc4338b44a254, 0x570752bdd3581d40, 0xd09ccbe842ec1035, 0x7a46c30fc9c5696b, 0xa59b3074253f037f, 0x3d91d4e5e9c2b3fa, 0x58f3892497927f15, 0x1161d0e827be8757, 0xc333c8b96edffbcc, 0x1244a8ae968a6dbc, 0x642f01ae4830f63d, 0x098f3937e45d0e66
+, 0x455d472a151792d7, 0x4e2f6e434ce2625d, 0x690a59521ee8b9ec, 0x601b03a406c1b1f9, 0x41fa0f852a669277, 0x015741ff4b5dd157, 0xe386c12fbaf95d4a, 0x4f664ea445cbdc9a, 0xb47f263eed0f9933, 0x30353fa00ca3e497, 0x947e6ad991b522a5, 0x36b070e24b36a66a
+, 0x1adbc7e7e6c13b09, 0x6e91939b2623ff5c, 0xc68271201b051762, 0x44b84129c0479589, 0x48c2b0ba8996a388, 0x1080152af937fd0f, 0xacb43f95f8e0856f, 0x01dd43c14eba17eb, 0x7efc6389f0bc056f, 0x731df22dace2ff31, 0x4295f8c71f4cf146, 0x618f982d36885b1c
+, 0x44cc44b34c394f72, 0x28140ad1da1e36c0, 0x76729437fb723cfe, 0x515a1c9beca54650, 0xd455ebb7ab086b77, 0x007f14ded20f4eb4, 0x7012189c36a957e3, 0x79a92cf25de3f854, 0x6889725ed72bd5a5, 0x20f8591d699c74e0, 0x9e5fabaebb59adc8, 0x7c8fc4537bc5c9b9
+, 0x7dcbe4380cf4d333, 0x74ecba9ca30aefe5, 0x75f6a9dfb442124d, 0x189d9561a68f2c9b, 0x446175432c665370, 0x7c6efb4f2ae06b6a, 0x99c282b1443cc4d2, 0x4178105fe8b6442c, 0xe7d8122e9960e7ac, 0x1b55f75a8e2fec75, 0xa868d0a1363f64bd, 0x5b9259451447f9b2
+, 0x2a28bcd94311a9e1, 0x4fcc38b8ebab00db, 0xe7c13b70b5b7177d, 0x6bca422582517d4a, 0xc1da7b1b0356a351, 0x0ea637a5a974d1d7, 0xbd6262b681ad469e, 0x0e972655a62c027e, 0x5f5206e87dd99230, 0x7b56ecb683bdfc1e, 0xcaf877da4d826c59, 0x3002499cecd0828a
+, 0x17a27229b0a9f45e, 0x70afae799c5bc73d, 0x66175a57b1a83453, 0x6499e2c2168547cb, 0xf6796040cb31ce2b, 0x7ca925a2fda8e53f, 0xee6eb22e718cb04b, 0x78fcfc3da9993603, 0x9a01daa22b24ecf2, 0x3111efc9870b8e14, 0x3445562fb039bcfa, 0x30daffb5d792432a
+, 0x59a28d0b478b72ec, 0x5c06808494340d38, 0x9b7474a7cc6121ff, 0x25a8e88417c9acbe, 0x7b1f20f8a572e1bd, 0x1ddd97a0e864b1d8, 0x152b8e5ad59ec1ad, 0x0306c02002bc6ad4, 0x6786c633e8d0c188, 0x7921ae5201214c3a, 0x323385768e49f5b7, 0x15aa96946eec4459
+, 0x7a7b358b78c3af63, 0x32e351eaa6f19e63, 0x35bf5ca7571d7f9f, 0x2486644840994363, 0x36d0f70842ec19ec, 0x275d82fa093b7102, 0x5b8ee8890bad7c40, 0x422a5c2747faff55, 0xf3ee48b5e08d4180, 0x4c5d29ac8d5c9ada, 0x9539da7b1c4f4af2, 0x2bdeeeb101262a04
+, 0x92d75ff53f69d2b6, 0x0bf33325fd7aec95, 0x006e84f4e2057429, 0x68c65bad81f25eb6, 0xdf8240c9eef4ac57, 0x2aa9e71ecf179474, 0xe544fed49a6a06d4, 0x5cb41bd09137374f, 0x723aa6c3facec448, 0x0d099db961eb5fa1, 0xd97dde8c90c8592f, 0x4606e8c411398ef3
+, 0x929f28c6e32a8c17, 0x49e795099df7a78e, 0xc387c20bf9b1d5aa, 0x44a8539c73e37b70, 0x0c43ba5fb7b53cdd, 0x4df5a0b4411ad374, 0xd5b9ef13f4cc46bb, 0x41b44d02775d4a5a, 0xf8d83c6587661a4c, 0x6ff4d499c3c1a8b3, 0x74d60806c1b7a65f, 0x2ff14ee9b646a7c0
+, 0xb07e6b357fc22fa6, 0x0139428aa1fd55f1, 0x4044ebec0a00313c, 0x2ba9e4bb264877f3, 0xf0d935c379d2c92b, 0x432b0a02c2faa114, 0x99fe100b22644c3f, 0x1749c8c4eb15ba18, 0xaf65c34e0e4f7278, 0x203bc5c9d70605ed, 0xfb7602f5f1499ff3, 0x1c5a3e0d86968e6f
+, 0x8cab62e065a55dd6, 0x7775d0facebef2ad, 0xb73a50ccaf032235, 0x7d6d0d0e8f2cef0f, 0xde29481f627286c3, 0x1cd97208eecb2476, 0xfb8d6409ac1c5614, 0x255364a58e69fd24, 0x928cda65d754b46c, 0x2b095f9bd941d2bb, 0xf08aba6577b19edf, 0x26e762a03602884b
+, 0x282424bfae4e7b59, 0x24b9bf814c2e47d2, 0xcaff3f196b6ae942, 0x6f9e6c7c842e00d2, 0xec4d211d6ec6096a, 0x006c109eab0dee23, 0x56579a8e624e4e54, 0x3a014422543ae5e9, 0xb4865d580620845b, 0x2bfea784c3db5e9a, 0xd48086b1f408efd6, 0x6d9850284e6a2cc9
+, 0x97af2d0eefb28c2f, 0x049c371c7f8edfca, 0x22f74578b243ce85, 0x5375486ec71bde8c, 0x241937eb439b7c77, 0x348b95e89abed85f, 0x28a0b271e78504c5, 0x2aa07006b868220c, 0x0b9ed4e0d62bdf7a, 0x3bbfa4f9111b874f, 0x2096265b22c67bcb, 0x54da47c276c65480
+, 0xae2e0bf810d2938c, 0x3cf84dd70fb48631, 0x3b0bd8bc2f600e83, 0x5171ea9ab76afc1a, 0x7c8a8f33b69a7937, 0x0085fa8ae8512506, 0xb35b8536eaf11ba8, 0x78f0c89acbe2d071, 0xf3f962c1f2570afe, 0x05e49525ea3eb4d8, 0x5dc527025b6bc9a2, 0x2de257c964898d27
+, 0xc47e019396b3b9f5, 0x6f1c0688740272c6, 0x7693b6b6d1c8916e, 0x4f065f3f5ad67450, 0xd005ff1137ba21bd, 0x7543f8c25f622106, 0xdb80c769901d6a05, 0x7ec695d606c66357, 0xbaa8ecdb0223ae84, 0x3c4cd46adb73244b, 0xf0dac8bcb04fca6a, 0x6a8e87038e4c04da
+, 0x3585fd04a0af650b, 0x407ada854a4430e8, 0xb56df00c9635eac0, 0x1cedb788e4dac25b, 0xc83dbc0d966f3582, 0x54968bfa27f638ce, 0x6a159e91c67a1684, 0x363cd1237dc6530a, 0x7062a97f5d97217e, 0x208a2eebebec6b6f, 0xabb1597c205860c7, 0x3f728a1091d47750
+, 0x11f45abb3f47155f, 0x36593b515744a448, 0x3f8666d2a9fd329f, 0x56ce363162bcdd9f, 0x3ef506ff28550d08, 0x0a1f459b862dd721, 0xe4e7bc154fa93d86, 0x0a8f99fd1d88fccc, 0x0d0a1ba8eb59fbe5, 0x6dac948fdb2d4800, 0xb10481e3fb1cdaf3, 0x7e4d674751b2f3f3
+, 0x3a377c47cd2ce359, 0x7e988adca85a0666, 0x8948ad41ee9e4301, 0x19f00806123184fe, 0xd5af6d589a8708cb, 0x30e84df83827154d, 0x05a9d89879d9a0a7, 0x7f54cd4c34b61d83, 0x7ebf49d5728a2d53, 0x4bce2ad3fb2bf2b8, 0x87e02d00abb2ebc3, 0x5a37ac3a63a00a94
+, 0x5a77744dc30817c2, 0x0bd1df5070204c59, 0x852ce136f6a96ba0, 0x488bf3beb9f789dd, 0x5698448c9fdaa2b1, 0x41a18b499a5a9784, 0x3768befdfa302695, 0x3ef7a6f0da3dfa29, 0xf8443f58907e8b99, 0x48e2324e65cc9cd7, 0xdb5d6626cb01ef21, 0x61e1278d1c9c0185
+, 0x51fc101b496253e7, 0x67f65a66c3489f11, 0x8b8065efee9b6e27, 0x0ff5eece165f9bd1, 0x168845defba16f6d, 0x07f0d2df4b22aed1, 0xc3c33adbd415a378, 0x0446ede18e57d4ea, 0xab7643533e87e768, 0x776c24a2b0518af5, 0x465b44ca3349b410, 0x358c9de306d48779
+, 0xa73dbc7698679634, 0x0832bbd78c818690, 0x61ed48e9c2f4e028, 0x3d30ead1b0bfd07e, 0x5572c1794d778c1d, 0x32e17f9348067741, 0xa9c10607af97dc30, 0x78b6f89f90bd606d, 0x1bde932f85ff1496, 0x778d2224f4dfcb02, 0x65acccac071bfecb, 0x643b4141facdf870
+, 0x3e7c3f6bd31317eb, 0x40d4bd64e858be33, 0x847dd06011a1703f, 0x3114b39309cf3a0a, 0x1d43d1e534b64e9d, 0x1d7f4a231b1588a0, 0x1769392ecb0726e7, 0x77d41730fa794c37, 0xdbc8393014f84389, 0x57a6c8f8ba2d3eb7, 0x4b127dc18761adfb, 0x71a6a88f942353a8
+, 0xa75cd32be080140f, 0x51b49e9556f7df52, 0x3a3a99d182ab09b7, 0x187c0cb58660dec8, 0x2931ada715ac037c, 0x282a5e737cb7a51e, 0xfc2c9988121247a9, 0x75f3f1300004f231, 0x1dcb8056b998bd62, 0x4392ecccc9e315f9, 0xf51fd3d8ed14e31d, 0x6c72acf6b1a86aa7
+, 0x6a448078e66d9a5b, 0x54e86ca07355937b, 0x9c63a51e50a4ff0f, 0x698f3fbfe682281b, 0x2daafe9b3c3c92a8, 0x3d1abc421ba7e4db, 0x9fac5637ab6518e2, 0x5a1ce5920545961d, 0xbdb84a42a326afdb, 0x38edfa7ff6ea2177, 0xcc6ffcc2f0941c1d, 0x7d8b39f74fec9735
+, 0x12eb0abcdd3fc3bb, 0x7ce696578de18292, 0xcea3569e860b98f5, 0x7de6c5fc20db0143, 0x34595671b8f66e9c, 0x30cd8704048df94a, 0x9c82fdd5bbd547f3, 0x5d761f676c62bf65, 0x5834cb47f7d163f3, 0x2a30409ee703b996, 0x65c7dc0ed4ecb67d, 0x5afb4deacb53f6a6
+, 0x7fd9f048a304fb0e, 0x1cefd578fdb536c1, 0x4f2ca0c0ce3a6f93, 0x3e48334f409bb446, 0xc1d0269fa27b5e39, 0x4fd61d2157902ca4, 0x32050f149c90d0d1, 0x1dcdc7968a84a428, 0x48e77deb595d5247, 0x7371bd3c697b6e2e, 0xfadadfa6a2d9a520, 0x2bd2ac672e9c6dfc
+, 0x28cb5efaf0a728ed, 0x3f4679dc12b76ebc, 0xb3fd52c2c0408b8f, 0x2418115fbeae2792, 0x64f145afec4bb1a0, 0x2d96ab40de0b1a3d, 0xe6f97b32e8798b5b, 0x208c7adf26f97739, 0x153ad1248310f861, 0x308bf58fdf41cc85, 0xd202fe96459bc670, 0x1b6a91ee1211397f
+, 0xfed1f9ec85fc0bd6, 0x12188ed824fa279a, 0x6284375a64a4caaa, 0x0a70c08c7ad1e63a, 0x4ecd1f79dd2648cc, 0x261fe4410a2039fa, 0x07d3e73d6334c55d, 0x212b75433d6249b2, 0x491ce12ca7e51339, 0x05cc2237e050e010, 0xbfc24774a0d3787f, 0x263e10aec8d82a19
+, 0x45da933923adde4a, 0x3c3a1dd7ff9f810f, 0x9ff2076a6425d9ee, 0x7450c78fba3f48b0, 0xc80b6ab64cd5df48, 0x65e317c5966ee633, 0x4e2934a1ff9f6579, 0x2c40fce7ed53d013, 0x9a2c192aede0ebe0, 0x6525c8e1f4c2af9e, 0x4f6e879d8d592ba6, 0x1e34e9ddcaf44111
+, 0x62efba20ab177034, 0x404b89f8f024b275, 0x039ceda91cc491fd, 0x3fe850b4dcd27785, 0x5c7914ba665fa968, 0x20056849df6ae094, 0xb1b0a81d7535de5a, 0x0f3775c169ebd5b5, 0x4b7a4aa8cf5f480d, 0x0a6c746590219c14, 0xfe971acfb98bf481, 0x7f97dfff2b4d6888
+, 0x357eeecf35063519, 0x6ade99acd06a6993, 0xaf072ea04ef5be85, 0x2ec61c61e078ed5a, 0xa085f2d613d28afb, 0x15873606a6801d9c, 0x0a8db8eb4474120e, 0x1b07cca1df26805c, 0x985e4e6f3c3b2674, 0x6607ef60bcf4690d, 0x78fc128d8bbd368d, 0x2231c2370aafa7e8
+, 0xe7d9cd099c92c17b, 0x4b26dc1871c32bf7, 0xa174a4dc47261f35, 0x0362218cb225b234, 0xdf89b922249468e5, 0x388ece0505755699, 0xecf1372fc47df610, 0x5b85edc147c85dc1, 0x59de90650d17077f, 0x72bd814a82c9c5c0, 0x42937b7da4e30cc6, 0x366b3f749cc1272e
+, 0x281293253b47c8a4, 0x2119d6489034eaf3, 0x09c8fa70e185e455, 0x1314e3986e0cae5f, 0x1087275fef786cf4, 0x133a9931bdd4287e, 0x1a52433d09bf8567, 0x5f0f1fcb5c099bf3, 0xfc5ffe84c4fffdaa, 0x62c37e8e1b3cc48e, 0x3240dc26f671603d, 0x2c10980ea3ee4b8d
+, 0x464b2b5c8475663a, 0x74f149a0a305b597, 0xa69f038907f980cf, 0x662147aa6b7dd974, 0x842b42f4007fa090, 0x20ef2307410dc6ed, 0x53ba275abbc0bdbe, 0x0693aed66cfed885, 0xb2e12165b214d163, 0x2607643e010821ce, 0xb9809043905d55e2, 0x4712195cb51230f8
+, 0x34896c4d51df08bd, 0x58f1fb1c5fa4a540, 0x7a90c5d4d982c875, 0x2443458e42ec2f9c, 0x98066b7118da6900, 0x17991a1d065e9b82, 0xcfce678867c21a18, 0x553f5eae7b99c02b, 0xd7327bc9ce347be1, 0x0a188bf7b1e7f132, 0x589822c43014c2a3, 0x62e9d9a5d156f6e7
+, 0x4486b1c339ea4a7d, 0x4f3a8a74bff47848, 0x2470989ad0a60b24, 0x2b9481cf2067ef93, 0x51d13ee81c10dca7, 0x30e2af706f6e5275, 0x9dc282ff5c868538, 0x11d0870b728c2e6c, 0x9865769d13126e62, 0x235f454c34ceefd0, 0xc55426d1cbc8f48b, 0x6ded2fa22c5353e0
+, 0xe1d4b0d1c4244944, 0x3b030ef826114c6b, 0xdca5b631c2798d9f, 0x3649ad9757760579, 0x61c76bdbd05e5293, 0x0be6ee515b24d1d8, 0x566e35db98da310d, 0x39b04cb58774e740, 0xbbfd6f059002c75a, 0x5bc1bf1f6e852c28, 0xe04f2c689cf9be2f, 0x5ed2242fc9f29905
+, 0x05bfa4b0184155d7, 0x05a65bc3d50dbd7c, 0x2e43850dc2407871, 0x5729efc8df2e44b8, 0x0624d3f23dfb11d7, 0x0f671c260cbbb655, 0x9fcbd91eb7a42b0d, 0x42c937e5ba8aaccc, 0xc02bc1f3b63f631d, 0x7c11dba6a0fec717, 0x0782b1f3e0de50ca, 0x016810f8a853bfcb
+, 0x2c3547d9da8213af, 0x0a84fd81e31d4152, 0xd6a4a5c716adb5ed, 0x4612d1142a53ed04, 0x126a7f46a96fd1ff, 0x4c3801034bae5415, 0x2a82e545bd0053f9, 0x5a7dd120ac50d232, 0xe1c1aefe5d61fac5, 0x21acc12fe39272bb, 0x6227407f32de0390, 0x518f6c6633fe74b1
+, 0x28b4bb90d7c5ad63, 0x2f224a5709fc2937, 0xb68de7bc6e250794, 0x0dde9a849720b9d4, 0xe821659e63dfe4ba, 0x3a68abd44b56506e, 0xf9045662f842ba59, 0x00e03da1659dbcd2, 0x0fdc6eca025c4f8f, 0x7ac6546211fa0d85, 0xfb59422cad3f5453, 0x4487cf1e7e5d4482
+, 0x432fb1b2bcdd6ce0, 0x7b622a7c014fd6c0, 0xc135e59c8f83fc3f, 0x23f7fd8de11b739c, 0xc3ae058f292c0117, 0x75aeef6d06ffc015, 0x06876338864d7f38, 0x7beda756bc928dc9, 0x35654de9f85ff226, 0x0b186968058ba792, 0x837ade21175fffb0, 0x19dae1d239869009
+, 0x679c7018cfbaa576, 0x2677ce8eba573da6, 0xe89d74512c9aa613, 0x60a68a5bf914d7a2, 0x972cfce0da9729fe, 0x2c9032ee328bd8a2, 0x10158430556c3b36, 0x021344ca24cd9870, 0x4ee3be30b457ec66, 0x532f895fd57b71f5, 0x7dda397ebd20a3ca, 0x513f4c73feeb01f0
+, 0x35f50e1a9aa3e715, 0x18594520bda81925, 0xa16238f68a3757ba, 0x56434b94640a7798, 0x8918c353c297180a, 0x6cd5a850d95c23c9, 0x11db8b3026f2128f, 0x37970ce1da23754e, 0x11082631644bea06, 0x2916b1e0669ce320, 0x715083a627ac7b71, 0x20a175f5a036a05d
+, 0x8c17c41e13a448d8, 0x0e3d024b9e93373a, 0xa904bdb7874f71df, 0x6954a5c7b84475eb, 0x1d13d8cb3bcf6bf9, 0x4980844411b794b2, 0xbd2445ab42063f8a, 0x63766dc433f718e0, 0xbc9fd235df2d7058, 0x5a8fa19cb8925719, 0x4d18bc38482bb67c, 0x1ec9a8316148ed40
+, 0x1dbeea9f52e55195, 0x764a88d0f75d851d, 0x25d5eadad598d236, 0x4075b77517280487, 0xf02d1b7ae7f7c82b, 0x0e444442f862c00f, 0xe088a2783a724a75, 0x65fbea0b5f4f9aeb, 0xa6370abf46ad6d6c, 0x6d14028241b65c8c, 0x0d3fe373a3e9522e, 0x2f2a03e186d448f1
+, 0xb6644774f33279a3, 0x0e1e1b502d1342ae, 0xc221022305473d67, 0x68d3300029f08635, 0xaebabd624c07f587, 0x57ea91e282ed87c4, 0xef9978b94470901d, 0x61efe320881d762d, 0xf579935b0dfa02c7, 0x7772c4c39f8212e7, 0x0bd8ae63741f108d, 0x5ebfb990740ce6e3
+, 0x1d3de3bee30a5dd4, 0x1c8d8282e424d214, 0x095ec10c40c3c6bb, 0x03e508513cbb1a9f, 0x4f13078879f3bb61, 0x435461953733dea2, 0xa98849218775a412, 0x310d17ad2c629673, 0x3d9f78d0f638c7ea, 0x1b25dc3c21becb06, 0xe84f1f11dd0a3242, 0x6edc8dfa21ca3cc9
+, 0x5f7dbb9eeda05355, 0x4d60cd20b47d5a3d, 0x898a0938e79d4340, 0x417b94adca47ed75, 0x386d30adb79f7cb8, 0x26677b070d6ea401, 0x6f4a6f7948d5d72b, 0x3cac7e3ae3cc4544, 0x90065e31331de4c9, 0x702fc5801d2de452, 0x0847bceb025e1c49, 0x7c0379e552933213
+, 0xba8d162a6c13846e, 0x583a2d065f7eb362, 0xb40cf65c6108da3c, 0x152bb7598550e143, 0x359e313e113f7a6a, 0x0d11dda70b92b070, 0x897fecdce64b62bd, 0x6f47e82a20b49a85, 0x6e42bbebfe132bdc, 0x62b3b466863ea0c9, 0xd7dcabb3029c38fb, 0x6b7fee56c2fac325
+, 0x3f336d828afa12fd, 0x12318bec7b84bc01, 0x9488fbaca1ecfd86, 0x0e95bf887a593655, 0xc89309b9ed520391, 0x240a50468a60d55d, 0xe6c200aa1778618a, 0x5fd94004067fd98e, 0x75981bc9b4f852b0, 0x6716fb596ded631c, 0x8e725d340f6f9058, 0x5597088c21d41b7a
+, 0x9e3175b0d6e368f3, 0x54b6b370cf5f1c99, 0xaa5fe74e564b1f53, 0x6be93498cc820c63, 0x9692e75d0c862841, 0x1e0a47fd7c270f6e, 0x9a9670f983e380f7, 0x3d457a16d808410e, 0x97b16130d4ca4ee7, 0x3a35e2389050caa0, 0xbea690eca3975eef, 0x1ae01d85afcab314
+, 0x62889a03f9692b7c, 0x3f5b58cf54d30e1e, 0xad4c7165e497b8c9, 0x3e81fa3257298243, 0xe33ad06ce90a7578, 0x4b33b78b1afececd, 0x2f484c2b081b3f7b, 0x396c76e985d79c29, 0x850c5d14ecb72cd0, 0x438c9aebc9c0bee2, 0x0306b7ba3875fd25, 0x6efac162905e88e5
+, 0x5a29340f8dfeb42e, 0x4eca93702d85ac5e, 0x8582405561fb05ce, 0x4182b9c7ee56619d, 0x6f9930af00db79ce, 0x0baafebaa216e152, 0x3c8b1c722b4c8ae9, 0x6ab4b11d5b14b92d, 0x8f628a9c6f4a1583, 0x25c272d9d70d1547, 0xef83824b8665b9b4, 0x7d38a49b92e79b36
+, 0x5076bfb2b78ea604, 0x0d9da3d9ccd3aea7, 0xc73dae6b7f35c67c, 0x2273782cc46e38e5, 0xa9457030efc31985, 0x6207575121cba550, 0x66894554116a613d, 0x3bf7a179d86a0524, 0xf5be69cb546112c2, 0x5d6c05210d6711f0, 0xfad4b35332e6f596, 0x3b0699e16e2b144a
+, 0xdd25cba28e0f3f28, 0x33631515ff05d445, 0x1e0f9410d15430dc, 0x03cee1da9c3e1755, 0x800e4172c11cf3e4, 0x6c24ac39510d3bf6, 0x39ab796f0d9fe0b9, 0x2331ddbc12a917a9, 0xedfeee1da6cca66b, 0x6b34d3aebff294f3, 0xc4dfe0e38ef5de39, 0x50c502e3271da1b4
+, 0x34abce2dbc0a6fed, 0x70d3fb6e9877ea6a, 0xb5f7146067bb6412, 0x73e2a6153ec2e22e, 0x255b2816520e982f, 0x728cad5bd085baa2, 0x6d4e4aeb0dca2718, 0x0aee17561fb0edef, 0xd5177286fc45766f, 0x11c2e6d6582763b8, 0x3fbeef84b6e4e424, 0x0b15cece25db894e
+, 0x303cc6b9f4509494, 0x3956da695ed556ba, 0xa6692e2afc3ee81f, 0x6170667ed9bba94d, 0x1a96798a75abefcd, 0x6cc4067d3b874bcf, 0xfb8bcad9dd51f793, 0x1dada82c8e6d9fb3, 0x95e5ce627c943212, 0x6368f474956c2027, 0x1ac07700741d49ad, 0x7f67c90de52423f5
+, 0x3756d4d479c2cc3d, 0x25d44ea8d31543de, 0xd82c8bef26bb2c43, 0x2c2047033d27f37f, 0x5bd33d9837dad260, 0x77943117a3383b7d, 0x12071d697ea583f2, 0x3c7c41272a225bf2, 0x92ebbdfaf1f03ad3, 0x5d61030c68b63704, 0xca6e2853baee75d1, 0x12404b34771a3636
+, 0x5fa2e4d924e0e850, 0x728b665034d28ce9, 0xb1685a1465af01e3, 0x32520072358cd1b8, 0x4352b6813629a526, 0x0a7de3824efac83a, 0xd330384b070bfc9c, 0x0215c4cf276becd3, 0x74f5b5a663cd83a7, 0x41a6c449e8318db6, 0xdd4ddf6872887639, 0x4b78c98e71c68248
+, 0xbf688b2d418de5b1, 0x061756b00a341db3, 0x5c6eea9c17c0ff84, 0x61fb6977bb5b071c, 0xf3251e407760d99a, 0x5fc91d0b0d0942b0, 0x9478f15ffb085f1e, 0x74aef5a34ce963c5, 0x5a2d5f125862492e, 0x04d83bb62cba5c9f, 0x6afba77c70372e6a, 0x722f5413e72227c9
+, 0x5b219d8db8feecef, 0x1d87a10355ca2dbb, 0xd042e9a67548d3db, 0x438f56921f1b6520, 0x22c3749dc4b87935, 0x7c3a01b9e5b2be5a, 0x51a2d15e497215e3, 0x2f28aad70394189e, 0x334f7d4a980eadf1, 0x0ab187679d7a8ce9, 0x881267a5798da33e, 0x75ce03330b03acfa
+, 0xa169631794e9851b, 0x18e18d66851ec736, 0xd8f4f828f173c676, 0x3540dcda0b1059e0, 0x21d9bc0d0a4deab7, 0x503c3ba77cba9203, 0x9c6906e9921a7cfc, 0x75ec160483c7f33e, 0x6d28f2a10598a77e, 0x7028a940aa12a03f, 0xfa0cd2520156b675, 0x2bc40ac0b9873a22
+, 0xfb45b1044b1f81b2, 0x553916f2aab6d640, 0xf04bfdf6827322fa, 0x1a58965a6d7f8313, 0x7ddc7847e2317510, 0x218c95f953e696f9, 0xa3f73e81727617f4, 0x5dfec0253369810c, 0x0f51daebab28756f, 0x71c56c1d0a0f29da, 0x0ab316b49f0bf6b9, 0x01a397bbb49b293a
+, 0x71c8a01844670f10, 0x74d01dc3ed8da088, 0xdcb4a9286f9cf722, 0x06153da3b44ee714, 0x74f1ea4651c3f5c9, 0x42a287bb6afd04ad, 0x860b0616115296c2, 0x385e17ab02b038de, 0xbe775f02aa3b62bc, 0x563ef61fe33ea1a3, 0xf39851686252132b, 0x4a021c77f77dca7b
+, 0xc6c3613b4bb40675, 0x1dc89e583c6fe07d, 0x731522bcfa707fba, 0x5699e4bc07511afd, 0xcff6bde5a9c0e38f, 0x163298a2c819714c, 0x6f1f7564e22efd2a, 0x217f8229563a9a59, 0x449a1af39e9d76d6, 0x32fa674492a6c368, 0x62d51504a3aedded, 0x583b1b42f7b1a3fe
+, 0xa5467d1faa1fd840, 0x6691c0de708ae5e9, 0xfd9472adb3282b18, 0x5a5febc5ced68562, 0x7711477cbfff4e96, 0x17df56c866b8121b, 0x0e2b223af420e746, 0x1e96caa351f5718c, 0xaf452bb1cdce00fd, 0x003a9447a3f7cc34, 0xb326848a53579adc, 0x745a613592ee2b32
+, 0xf6cf09b4344dec2a, 0x576c2246c3123ff7, 0x23cd84fd062b7413, 0x1a019a71b8b377db, 0x8cd0d9346a4bdf46, 0x40770f015db4691b, 0xaa3bcabd445f95a7, 0x395780e7a2b04594, 0x7632cbe513abc0b6, 0x2202be6cb6bd481d, 0x46c2dc16f3e6b05f, 0x40d71378b74d215d
+, 0x4a12456455b424f2, 0x734bfb43eee08dd5, 0xd4b9fc326668bcbe, 0x2ceccfdd4119ce29, 0x227c1c33d5cbfeff, 0x2802e4fc60bfc32a, 0x6d99b0dec9952e4a, 0x5476f8d43588f6f6, 0xbe199a3f90877472, 0x5e60a79b53518c4a, 0x3ca96d9600d6b9a4, 0x32a6a7feaf84a3d8
+, 0x0d2693a406cc0dfc, 0x17a738f2aeac69d6, 0xd6b5abcfa856a0ca, 0x79007211a059ade6, 0xf1874c9f185d06d6, 0x1da11710d3380ee1, 0x580fb5c1f848dc04, 0x1ff9245fe3141170, 0xd5d7342a616bbafa, 0x71c4f44a9e74141d, 0x084668e9bb70e8f4, 0x5a79e38b732ec6bb
+, 0x5761042b862f518c, 0x3d0669fe1d823314, 0x9192664aba68f7d4, 0x7617f3c9ec4bc722, 0x954ad1ce8e042e4e, 0x7a00338000553114, 0x7bf889bb80aef5ad, 0x21406704fbf118a7, 0x7f778b7c909b7e79, 0x38d19484e364a8a3, 0x0b2148aff881e6a6, 0x5f7fe6ea7b120724
+, 0x9b2c85aa3b1aba35, 0x45378a16f97f21ca, 0xa2099c9f765064ea, 0x3c06c84a84776be2, 0xd202206bfafbce7c, 0x2f13ba0c0e716fd4, 0xf76cd6df4dc0e066, 0x4251a18f6621660f, 0x866a7a22a68b3692, 0x4adca31ceaf3c84e, 0x7c0fa32e7b997cc3, 0x5ef18510a4a0b93d
+, 0x584e5cc2ebfc6539, 0x3876c6e9be914e30, 0x66912c60761f73b4, 0x468444da7be05b73, 0xe8796d9f7ab3c138, 0x7e0f3993aa563fe1, 0xc0920bec5942d9d6, 0x5e4c5c00246854e5, 0x454a3e7e11c665bc, 0x6d29c5a5227357d3, 0x5416ad1ea320fceb, 0x095231418e539b62
+, 0x07b8d25a71606802, 0x7fee4dc98026d6a3, 0xfd90ebdf422e8700, 0x5765e6bf5098f456, 0x33707f718da87b61, 0x7206694523145ff7, 0x4d49ebe9b183593c, 0x18687fcc006a473c, 0x4ffabcf0b6fb8ce8, 0x34c7d6dae77e3b6f, 0x73ec906e2be3d508, 0x410ea911b9ce07ca
+, 0x27c80ba3b7596f0b, 0x72f9e2f73b175562, 0x8693aaff46be0b5f, 0x764fec1d77892f6f, 0x6c79c93037e35f32, 0x6912974240ed33a7, 0x425fb5db131581be, 0x18e0ee678cedf3f8, 0xf5db8af31278a699, 0x1f0285cfa5c88798, 0x2292a145ffc13704, 0x68da17d8c34508bd
+, 0x9e1bf45cc7b41250, 0x7cf0adbfa4e35fe2, 0x8e7e1b9d03b53cf4, 0x15a9efdf86439da4, 0xd33dca986bc32015, 0x15fcaa41c6a9d5e8, 0x86ccd23da236c9d8, 0x48f075f491fa4300, 0xe5adaf85ab651d59, 0x7d1341b90a307d65, 0x2cb4a3b2900f7e01, 0x610c859b32e0814d
+, 0x2a1a93a39840170e, 0x76689b7439532add, 0xacf59d11b9fa20a5, 0x0416693b47873142, 0xfac26880dd115feb, 0x7e9e4d19712e2cbb, 0x0ad275b5dad64005, 0x42e0163d24b1b7a2, 0x675f91f3ffa58b33, 0x168162cfc9962322, 0xd4590a486f9c86da, 0x011347293558a299
+, 0xcd9ed99fe3989b37, 0x1eefc0ccc7fb121b, 0xe8572a43ddb42845, 0x7e0b37e4d0cec672, 0x5abb4cad72307cdd, 0x10cd41c0d13990d4, 0x38c926dd38b44bb7, 0x248f00d108d97b8e, 0x29cb9073360a6180, 0x4303e54f915952f1, 0xef58a992395f7eb2, 0x62c39c5ff710ee80
+, 0x2ffa03c24d3e9aaf, 0x3f4b532fa83efa06, 0xf7d96884de96dc8a, 0x3baec0f64fe01081, 0x88f3d0fdf51ced42, 0x56fa8923367b8c97, 0x00f5f30e6917bd6f, 0x47307f953dbb0433, 0x342322fb9f265e7f, 0x1bbfdceabf25e776, 0x61a85851f35263f0, 0x2f3f403973890385
+, 0x247492b0cebdd107, 0x7cc1c929a3b7a903, 0x316f05366225b51d, 0x49888af057b5aa6b, 0x6b0f695dba6285b7, 0x48098c70d6ba743a, 0xa9bce768531f4813, 0x60ab8f4bbacbbdde, 0xe824a2d266b307a4, 0x246fab8e0dee7da0, 0x94e94e0f0b38b4b3, 0x01ae08193bbb6db9
+, 0x8684c090b946fa40, 0x1613fedced1653ad, 0x8f1be97b4318f3fe, 0x7e5b1851fde08444, 0x694a1cd62dec859c, 0x2cc54301eba7bceb, 0xd2e7a1c161a2a1c0, 0x2a6489c1f7f62771, 0xd8e1724750b4bc5e, 0x006faadbb02caaa3, 0x318fb93fbf354ceb, 0x0521d0764931608c
+, 0x3cd2bb11c80a106a, 0x5ce4a2b7d281fceb, 0xdef95f314d197418, 0x68df0d39908d7029, 0x64a54908b1f30d2a, 0x34dd3dc34ed29b9a, 0xaacfed783b6a3047, 0x3b6fb4dbcb70f271, 0x105ea6d6dbb3825e, 0x34285c44d6fb203d, 0xd82e5aeb10c578ac, 0x0c9e53bbfc083965
+, 0xcbc8fdf32a32cd8a, 0x0b0fbf1fd54da971, 0x0b7b7867cfafe1dd, 0x2d7fd55ac52dd56d, 0x07dfba5e0e9bd212, 0x6b8d551d04db3336, 0xf31ab5dd3ec8bd13, 0x550cf711c4cea277, 0x4716aaa09bb1e0ae, 0x18077af5541841b1, 0x661b1226a94777bc, 0x6573c5fb2b88ae5b
+, 0x8d6d4a0dd4d5ac83, 0x147838d93e1ee90b, 0xe387da2b9705aa42, 0x5bef35445a64c18c, 0x89f10bf3b08c82ff, 0x2e4c348a715bc823, 0xe0259c15d44250cf, 0x5db9b533a532fc98, 0x647b1f5e8995d744, 0x416da35dbd3f6d18, 0x2d0c62fc93f92cc3, 0x17d3defeb00eb6d8
+, 0x54f6fe3dd7b0045b, 0x53702e6013713793, 0x653ab16fa5401184, 0x3da1a0d4c1d7c828, 0x9eebdec2d25f7237, 0x3aef27e5bd73171d, 0xcca13307ac443f22, 0x01d2dde954fee8a3, 0x87ca57017a8c3566, 0x3f08a7f8a88058c2, 0x4664260e30152e48, 0x7d2b6c4d1f1e4a28
+, 0x2543d6db328de39c, 0x6d67f3837aa8b40f, 0xf0cfcd180bbabda4, 0x47219c587c6d3d3b, 0xca9377198382d9df, 0x5fd2ad1513c0374f, 0x4900fc772a4c8c3b, 0x118190e868c6f7a7, 0xff494009a0255c85, 0x1d84a0197b5b5199, 0x080d41a5fc6c8628, 0x06645f2e523e9dee
+, 0x498a3508a73871b1, 0x2eb26dd22ba56a3e, 0x4d5ea97419921659, 0x1ab11bad379a7299, 0x9e3b3a4137510b48, 0x4a79f9eb86210e7a, 0x0de5c753995a5500, 0x7685fab83d340ccc, 0x7aece0217d63aa29, 0x28b6a84082fe9f6d, 0x5ad5be51264246ea, 0x3bad9465128c12c7
+, 0x74f8f449fa7a059c, 0x0cbac8e06d7527a3, 0x15a5648c7a7a984d, 0x35abc41a0eb073ba, 0x8247a71c4f79e78a, 0x534d95377a206094, 0xdc4e30d974413fe9, 0x3a41e7f8f56c4faa, 0xb494850b0f63b5d2, 0x4a1ab36cf8894380, 0x2dd91d4e09455918, 0x53361c840ad61a96
+, 0x02c924245e3b0ee6, 0x1487e7e6987ba030, 0xc17112a4b600d131, 0x3f447925472d313a, 0x4f91c1c87d73a623, 0x779884dd01bf4ffe, 0x6eb9ce02865c073a, 0x1d3bf5eda7b02674, 0x03dd81126fb2a569, 0x577cd42e48d34896, 0xa30ed603a10f48b6, 0x44f7c49df559b608
+, 0xb56a641c855b2e64, 0x258f09edbdbe892a, 0xc71d1407180727c9, 0x11a7eb6361308023, 0x5363253804e49db9, 0x0208580bfbf919fe, 0x18a1041e1363b3e5, 0x73833bc2b6412cf8, 0x033ad3032f8e52a8, 0x5a9a0875f59857e4, 0x02931032878794fd, 0x6eb6ffd05544ee83
+, 0x765d79964a7a08bc, 0x0a3225a5f364d6e0, 0x6cd0d10716804c0c, 0x54abb1baefc69c90, 0x1dddc0e507a5f694, 0x494d4c1394c8bc2a, 0x259f5d6e93e29752, 0x653015915aeef613, 0x4838d0d093ad79b7, 0x4f5975cfe7e6468c, 0x7cf284e94ef28e0e, 0x408ab58b1d00a185
+, 0xa065389f4e2081b7, 0x1c5e27f7e5166027, 0x9d3bf47408163520, 0x4e62a225020d2960, 0xa2e2760fbcf62632, 0x5844dad0c5115355, 0xa12a502a4c0a1153, 0x1ef6e82d46894fc2, 0x31b66131f8c2d0cb, 0x74e263463cfd5c93, 0x05894c92ffd1fa88, 0x58d4358faffe1d29
+, 0x915dbc5f848f0207, 0x0746adb703dfba5f, 0x12acbe8b1f1bf2f5, 0x3bf0a4637994779e, 0xe639c01b13f55ca4, 0x1cf68f45812f6a81, 0xc0a48ab1b87417af, 0x2e321fa22f97b649, 0xa76b653929545009, 0x6053a02573d3d4a8, 0xeb162e83bb7c5aaf, 0x69d2791627b4ef8c
+, 0xa702354d1dde2780, 0x24601aadfee31928, 0xea05926325966de3, 0x5b18d0f2fc6f016b, 0xbf6c740d7e77cff4, 0x5438dd69d1e0564a, 0xbd74ff48eff7b39d, 0x367453ca99606ca4, 0x64a7ad54ab4a1243, 0x6ee96b7c9c56a91d, 0xafa0941d99c46c01, 0x4d3eb5af5c770644
+, 0x8716eaad10ce5e08, 0x630b51b4328e101f, 0x365251d7a99cd343, 0x64d60f72d48a229b, 0xecd8f28ef0fc8d06, 0x32d9578dc34a0174, 0x0a3ac064a058fef7, 0x344875a86258ba2b, 0x1df11f1e3b493af8, 0x5eefdf2dd738dfe1, 0x8089a2c6232c6ce6, 0x49d9e9568499db76
+, 0x0b625f5b765eb7a4, 0x098e62947b826347, 0xd5b8fc88c23f69b0, 0x2446bca86701ad57, 0x354fb3decee871cf, 0x12d6458e5993011c, 0x74cd74adb28c479b, 0x4882439c0473c723, 0x6e8e6b145d82172d, 0x72e01209a2db67ef, 0xc38d2ac8e33e819e, 0x522baeae8ca35218
+, 0x1e3c65bdac0d0fe2, 0x2fe6525be72d75d6, 0xa2400ee98d634d81, 0x0985cbb58f4809ec, 0x8ff1dd4c4a06ccd3, 0x0414c9312d7ae485, 0x35063ad5d1bfc001, 0x04ea1ade5d2abd83, 0x5bbe738416bee07b, 0x7ba83a54190805e1, 0xb33568bfc316e318, 0x0895e2b0518737cf
+, 0xf7b8ba1a01163afc, 0x4dd609c5d24cb85f, 0x67994f41bfbddb01, 0x663bcb77d1377258, 0x73c48c2323b7d5dc, 0x2ea74c55e7c40f29, 0xfe13e7445d08482f, 0x5022cdb276d6a078, 0xef7ded4c7ea5f608, 0x65fb78bf6340b72a, 0x2a0e7e1ee197e7f4, 0x0c15ff76abb5f361
+, 0x37434405bae22cab, 0x0f40ffc92c5afb68, 0x8e12f3a1623285de, 0x03f60b052b5fcc45, 0xd551a1700956d584, 0x15c5e4298fb250e6, 0xdebcc396e390d9ab, 0x2fa18e63dcd6d87d, 0x83034789e2c62d94, 0x2d5f6acd016e791c, 0x83cad87c4b79e5e5, 0x07dc922ac1799029
+, 0x08b260adba986c4e, 0x00acf12f4adb9f32, 0x2f52ba9e265c1597, 0x7fea88b5f082ac35, 0xaaacfba517dd0d71, 0x06acbc783e48d39e, 0xed1f2ab86403f1a4, 0x48c65cb10267c8e8, 0x1b9cbf88fd02a38a, 0x76c07b73d034e8a2, 0x653588ea29fc9d1d, 0x3b40d2159415e7d4
+, 0xc555d6d05b5f915c, 0x2cbd3b326504eefc, 0x2b015d909d9a38b6, 0x6ae902c1676c9299, 0x6763d6cd1d414ec6, 0x523c6a07d2183f18, 0x252299a99792550d, 0x4e16c6cc30969565, 0xdaacf504b0e5361c, 0x5c9a70a00eea5ccd, 0x75089fa778fe5809, 0x39ef1bfee795a3d6
+, 0x66962ef749ff67b1, 0x214f34f4971faed2, 0xe9dca14f4a297210, 0x49c727f51c961b69, 0x2ca9669309cb77a1, 0x7ad30658ad622809, 0x68f2b8bf548da029, 0x73457a798ecc2628, 0x40bcda4a976f883e, 0x459a889892b230db, 0x0339ca0387ad030e, 0x7f3d586c9a43b7a9
+, 0x7f965c8f973970fb, 0x2f139b897bda4385, 0x6844c5d85dc1a51c, 0x4bfe97f0304169bb, 0xbcfb4b5845dabc12, 0x068a98c901732084, 0x33b01045ac0426c3, 0x5e92b483d5d61ab9, 0x007ccb08c1968d30, 0x7a9c202571a8d500, 0x7fb0218905bb54f3, 0x1a81840010329767
+, 0xbf2c048ac4e10670, 0x27174165e9a73a3a, 0xbe2b73686a5fea5f, 0x2794f8ff8036a280, 0x6015f67ba4531d9a, 0x5043ad801189caa6, 0x12fd7ece0224ec35, 0x4666c2ca42119607, 0xa3474877d5b293b7, 0x18a84382e4df97ff, 0x16cf333aabe76871, 0x447d7a2c81ca7879
+, 0x48d2ce0122c84bb8, 0x6becb314be1fb104, 0xa604faeffe7130cb, 0x3a54b72a8ed106d4, 0x9faa05744f0896ab, 0x265f75304685e4ac, 0x589e137753df570b, 0x70b16adc77281ef4, 0x2e0cc48c76e84f44, 0x5791be29ed20f4f8, 0x34462448c0e0121b, 0x7503490c3a37557a
+, 0xeaf046aa8063844b, 0x504f7a9206d4a945, 0x8399f2520178a18b, 0x463a688250658a08, 0x10343779282e3f70, 0x741fe802a5fd2826, 0xb04917822f55bf7c, 0x211fac3b628ea2ba, 0x59bcc6729ba779a3, 0x427b1b1c6d62551e, 0x5ca9df4ed45d89d4, 0x42363d90c2bb5d86
+, 0xb678b891070be729, 0x6e35e85614fe796d, 0x0051ceeae6eae3ff, 0x73216c4c9bec2e0b, 0x13b99e4f66b4af4c, 0x737b0edb06555238, 0xe9899623b5982f22, 0x2a0512cb3fc6c7bd, 0xebf7ccfc46e68611, 0x1a19079e2274afcd, 0xa6ac1b201157b955, 0x0bcf88c98ab30bfb
+, 0xbf5051ca5b66bd16, 0x405b5c9958b29971, 0x30c99e3743cf73b4, 0x3ca73c13cd109391, 0x6c2595d9b01f4c16, 0x06a9fadccdb27082, 0x15c08fd1771b7f72, 0x4ef09637ba2dd6a6, 0x9230ef6af415314e, 0x676d6430234c8776, 0xd6adf1ec61ad58bf, 0x58e5ff2e55814100
+, 0x43d2ab71561249bd, 0x1ee7dd4d49cfd42e, 0xa3b6069c4c0cd8b6, 0x3c610109241c0278, 0xc03f68334aefea55, 0x4a60713c2c35afc5, 0x630bf7c27ffe257a, 0x2fc82458860b5db1, 0x84954be6577982ce, 0x6fce433a34f648c0, 0xfe570d091fea7e45, 0x67f210419644b9df
+, 0x4ca4f885e8c06f84, 0x4843c882ed329ac0, 0x4c13d0ba2982c6cd, 0x3ca91be5588201c3, 0xe2094b5f53ed8412, 0x52a189a1c8f6785b, 0xc2049977344d5af4, 0x7bd438a0b14913ba, 0xf0a553122a9268fd, 0x7a45755bddd307e8, 0x82cb75856ba331ef, 0x5732d3ff52051c41
+, 0xfb64e7066ed49a0e, 0x337d84f70e0231fe, 0x7459ef352db7e039, 0x53f88d2858900357, 0x409f1b4fac4e9ff0, 0x374e0f085afa9b00, 0x1df16ab13589d8ed, 0x7f60aa36dae8f4b1, 0x8ab5f95dc63e91dd, 0x6db20834c2d30c6e, 0xd66c4c17074f6f96, 0x106a27526971a89c
+, 0x21caa2bf3b763373, 0x1927d30ebc940e27, 0xb845bc49a1045a4d, 0x3a745b73fc6108f5, 0x97c343450765dc03, 0x63631edc56d91a2b, 0x996d4aacddfeffa9, 0x362860f062e0f1eb, 0x1c760f44624e94f3, 0x0504aa8622c748aa, 0x1af2d751c04a7bd3, 0x1ac7636f88016724
+, 0x5cbdd8c878aed76e, 0x3cd51d51e57b8bf3, 0xc5f70812f727cb27, 0x1c318c47172f9b87, 0x23911c2d7905b402, 0x20acbf86cf648953, 0x41e1da97ccb3ca32, 0x38c69c8944fc666a, 0xba9642204c554a3b, 0x4186f2afb0008e50, 0x3883b089e9dffe76, 0x5bd7b59b7ae5f83c
+, 0x7416f831b5a403d9, 0x6e1688b6e439563f, 0xf5e5d192b078e037, 0x0a27442bd226febc, 0xcbf4f24e6dfeadb2, 0x7d6b06c3b8e3a894, 0x1b2d196875249c5b, 0x6799a331b393885b, 0x6596b5ab9c3beb27, 0x2186fbc1ec931305, 0x0869f1f7851b588d, 0x229e5468e2d3a273
+, 0x5a26f22f3f061b0e, 0x316838c70a630be9, 0x97126c6ba43cc2c7, 0x68e555cff3c891f0, 0x48de13a815dec662, 0x2fb9de7dc24599b3, 0x553ab35b34ed0080, 0x653e2600aec8b06d, 0x6d91f771d1bf2faa, 0x6669ae13f7294257, 0xac0d4e428dae44ac, 0x01db224b7e1eec6f
+, 0xa4928e19716836f4, 0x1a320400c059bfc7, 0x8dbfbffc3c6cfdb4, 0x5f4f5606b9fecc97, 0x8c666896c6a56ac1, 0x5755cfcc1678e1aa, 0x53d3c595ed4bdc44, 0x266d52486ba8d393, 0xe51a2d3ba816ff93, 0x0765dd78926a497d, 0x1cc44839f370fcb7, 0x1e9c2d1d2583a83f
+, 0xf47d58041c255339, 0x2d07677f6fe7940b, 0x6b2cdc897eea3d04, 0x1d4f59cdbcdfcdf9, 0x34ce7ab830599157, 0x7d0e9b2cdd2b4c1b, 0xfb07a4edd5296058, 0x3e47d6748d90f2f9, 0x0eefb264734fd4a5, 0x5d3003f9d99cf976, 0x67fa70da88f07688, 0x27b3ca7334404146
+, 0x40b9e93d9b8ccada, 0x4450bbefd4c1a5af, 0x5e1050495d47d1d5, 0x35b469fb766bf83f, 0x7adf28ba00b85946, 0x596a67bb9cb112a9, 0x7d3ee3c165444580, 0x3b53ba82264c99b0, 0xfea9a9c83c472ea3, 0x39e23feb49eccec8, 0x5ffb86ceb3d8c32e, 0x3cd67ecfd4e3d866
+, 0x690f86f9fdd1d543, 0x1f9ac6129db45428, 0x327d3307d578391c, 0x5d674e35075a513b, 0x9b2ce9893791a5fa, 0x468e3fb6effbe6e9, 0x2e11f73a337b4072, 0x2df81b75490d0159, 0x4758499b9d696a4c, 0x5c4b9f2247fd88a7, 0x271d43ffa4162872, 0x492517b7ac273850
+, 0x6c1c14507ca716ac, 0x14a3c823dc2ec0b7, 0xbaea66b0d420391c, 0x23dd6ec00f5dbc77, 0x44a2655be7c556fd, 0x22c5b9a5af6f2811, 0x75fd42899d4823a6, 0x2115040b95522c71, 0x82c240d4fab633f8, 0x63c2c0764eec897a, 0x2776cbe39eeffafe, 0x48d18c2f2af68a1f
+, 0x642690828c9949a3, 0x50abbdb14663d7a1, 0xc7cb3aaf16ffa957, 0x21eded441113b065, 0x110b00743ce18454, 0x1530336238611c5d, 0xf4690dd31946c974, 0x42cbc94afdb1db91, 0x5b3a12a0f942b386, 0x05c2da77d718003b, 0x5c1d65be09b14e82, 0x04b83ee5467ae294
+, 0x49e55ad15c77313b, 0x4208d4ea65dc0cb1, 0x6b324fc392554d19, 0x457c1072a4cc5563, 0xf6196a43e36c8275, 0x2431f096d218fd66, 0x4017c7234e4d6b07, 0x451a2db989e5eeb1, 0xc05e49ae34e6119c, 0x0fe34b640e160799, 0x548a412d8d872075, 0x071b2dc6624d2c75
+, 0x2baa624526e16cab, 0x59c50fe7c08570d0, 0x418fee3bd5db9066, 0x5b2a6733737bced9, 0xeeed98c4d4172476, 0x0e3a16899a3aee8a, 0x0efbd22f818135ac, 0x7cc9e7f3733ce0b7, 0x6aa0896ee7feec3a, 0x5d72586fbbb9f134, 0xe7806afaaf2f1850, 0x25a8ebc0cd09171f
+, 0xb54756199d675c9f, 0x6f3a5e085c7bed0a, 0x55bad21330ee4e80, 0x358036401032dc0b, 0x18bcecbb3f1ecbb2, 0x4fc804cd801ebf6f, 0xc23882655e8070ee, 0x355aaaccae1c39d1, 0x180888b1df4f8354, 0x0834f0e52fff2faa, 0x113e937fced41e3c, 0x17f277a9c4decc45
+, 0x994ee266b79a680d, 0x1f6c64b70e43201e, 0xea2b62df09681719, 0x2f6d163626f4a314, 0x5b26566be8bcc8ba, 0x1508df4dac854092, 0xdbd38dca66e16f6d, 0x6869064ca7bd53a0, 0xb27b6536ce41f792, 0x6d552c83644cafc2, 0xa8a37b88d5eaca5d, 0x112f1f2bb7d9080d
+, 0x8e3cc7cc971e294e, 0x09867e6b3aee2def, 0xf3ceba726363272c, 0x18aa6f4f9f1ebab2, 0x0afca459c8134238, 0x7a45bf6d56722d00, 0xc6cf529cc8c1d535, 0x78ae7aba6c991904, 0x74a3d1a7bc3d6208, 0x35cf7e35c8a4e5c0, 0x60372d9e5b596d53, 0x096f523b5e836d68
+, 0xcf7b8402922003bd, 0x5658e758f4b29717, 0x7031f7dfd46442d0, 0x2f6e3294e994373c, 0x612b1b3ad6dd223e, 0x7b32dae860b070e5, 0x67d972b6c3969091, 0x435841fc4e120c23, 0x69165336b47a0fe6, 0x6caa489008cdd14e, 0xd61fd39055757d58, 0x2ef73334a0c5fcef
+, 0xc9ecbc0408b2159b, 0x5ee2e402d4c303a5, 0x3819af3ad4a118b1, 0x479e30d99ff6bccf, 0xdd08f77d50687fd3, 0x3bd538c79635cadb, 0xcc62ec5ac33f0b95, 0x79420e56a93e6603, 0x8ea3691a614d4028, 0x0473de66e45b0902, 0x29d86cc497c6d247, 0x5b2cb447fe72224c
+, 0xed6edbe8a43876eb, 0x4b9cdf75ace694f4, 0x0b4016d1f58e9724, 0x5b2f722991ceebe3, 0x10d6cad716ce056c, 0x32f3cfc849147cf3, 0xc6a9af1cabe50926, 0x4ccc9401f32bed26, 0x21cbd0b7ab692cf0, 0x2290a2592251d6dc, 0x6800ab0b7087000a, 0x70253d2d61486098
+, 0x914587abb122aef6, 0x73acaeaca47d955d, 0x1472a24117e711b9, 0x5204ade9324902a2, 0x19779313b6ee8ae4, 0x40aa821c4d97a0c8, 0x82b2a48fba4668f0, 0x7bb1b30a49b918cb, 0xfdb49e27b235e771, 0x0ce6732e97ff12dc, 0x9346264413ad9fec, 0x7b61f71ebdab361c
+, 0x3c4e629775435dcc, 0x44a77d33959fd080, 0x2f7904cfb884ef54, 0x5735d86d82b2480e, 0xd39bdf11ff9373b8, 0x36a313ea5c465df0, 0xa6cc3c4fa7a49901, 0x323bff3c97f6a3b8, 0x49bd7822d0bc7c93, 0x4e4b8bd71f5a7ca0, 0xe5a833726651ce3c, 0x24f2aa64625eed8a
+, 0x3fae0ac18d3385b1, 0x6ea3dd983b2e10fe, 0xa3efc032e3a6518c, 0x7ea8ce9ba30bb5e8, 0x3aa399d96a71a853, 0x1d171d9b43c740e5, 0x9ad74a2be480371a, 0x6033ad94b405f97a, 0x18d22734a60d7e50, 0x5f9d32ace8ee9360, 0x98bb49b2ee6fbf5d, 0x65fb7bfd8dd38308
+, 0x8848cbc2c0b51b3a, 0x47ccd94a6fc30775, 0x184ccb0c313c4760, 0x57fd36b8a9445f16, 0x73cbb5d527a768d7, 0x799a91fb9eaba66a, 0xa1422bf08830d10a, 0x65985506fce078d2, 0x23e07bd473347d7a, 0x1c2d0cc4c546af1e, 0xe32672673784d380, 0x3e7d3f0077bb71e2
+, 0xa2a42b09f848cc2e, 0x466267aa34e88958, 0xc878b0af40bab63f, 0x24a85dc001e75fba, 0xf742f37cd42e3612, 0x6572b2b35989edd7, 0x64489b7c4d0da95d, 0x072663b8d8966ec4, 0x11887eac1c6f2017, 0x230233c412a283c7, 0x6393412ad4a436de, 0x326a3f57522e225f
+, 0x73825802a0e23b5a, 0x15279471219f23d0, 0xf2de15fbccca3917, 0x5d821a2d41cae83c, 0x62d00da2313e2cd3, 0x5bf053738ecc8a02, 0x22727254eb49759a, 0x0c79305c37c9c8fd, 0xf16de60d90ba9934, 0x76a7450e31c2f3fa, 0x069a4466f4aa2b6b, 0x57612a76dee0ae4b
+, 0x2c4e5bac04808a88, 0x30a5e678b0fce615, 0x9f707e721a163b42, 0x5f9b12b10c68fa2e, 0x102f290ede2c0b5e, 0x3c8869417aeda677, 0xf3ac15a6ea37c4c4, 0x59f73314b864ff9b, 0xdff6a1038f6b9237, 0x0b41c6122b9a87a5, 0x22081c1495ee706d, 0x22545e053ab91883
+, 0x8b5e9a8029cb415d, 0x0d4434ad75695bab, 0xfdc34b2f03873e11, 0x74e48379a0a14c57, 0xde23cdfaa5c46ead, 0x28c9dfb535928496, 0x7417557d6dc58c55, 0x10b8e3651a65bd9b, 0xf0a39b00995ca87e, 0x5cef4ef57bb3b583, 0xabd92b9debae04a0, 0x3a148f453099b799
+, 0x15acea9bbf984006, 0x4d41311fe553dad3, 0x4dfc611d373e90de, 0x3180e640b7561e40, 0x0ed60e264919799e, 0x03c9de737f8b00b2, 0xbea5064e24711dde, 0x1ad29201eebc21f5, 0xcfcf474c71fdb591, 0x648a6373b46853c0, 0xe61934373466c2a6, 0x242b74c4827b50d8
+, 0x917e1e41cb9ef54d, 0x35b3340867c89634, 0xd67a09a1540e3f91, 0x20bef96b4f8d7909, 0x1312738be1189e62, 0x61b844c6b6c025d3, 0x2ffb2f18d3b4a2f1, 0x2ad3a654486ecf3d, 0xf3d79ee1429f4ab8, 0x3e1ea98f188b17da, 0xdd420d327a1d284c, 0x7a5daded214f6f29
+, 0x60fdb8e5e78fdeb5, 0x23388d257853d1ed, 0x1095426646eb5d3d, 0x383b20256463fdaf, 0xfa27ad53ed9ffc57, 0x0954958e072f231b, 0x6d6ab07ea43837ce, 0x27e7fed7c1918197, 0x9b9ce78749ed8f53, 0x57ba8001ed653465, 0x9323e6ada28df176, 0x2e428cfa75d6133d
+, 0xca87862daa14b855, 0x3ee10dcb7ae8a53c, 0xb83dce0c891e5720, 0x628e205c9fd474e2, 0x8c9c55fcc8f0168f, 0x75a72cce56296c23, 0x4f52c2cfc5f1261e, 0x435e391164d39792, 0xcaada969df206964, 0x58ea8d0021307d30, 0x616a75f1999a8618, 0x097f880f12dd20a4
+, 0x53e39f0cfe2e8726, 0x3e87ef5977ec6653, 0x56896b88f9096b49, 0x0b20da85f25b782c, 0xf459ac05cce6dfbe, 0x016b15c18163baa9, 0xc232f69ffd217188, 0x22007168c95e6712, 0x2fe2000618d25afc, 0x3260e93a7c07a408, 0x953f823e8d93cc9e, 0x21ef790e3b94cf09
+, 0xefc92dbb13614b1e, 0x2eed180677fb109f, 0x070bd1b792f4364e, 0x3986ef31340553ff, 0x476dc39775900c24, 0x27be8edf0bd14c98, 0x95f9b5caf329b82b, 0x0b5145524aaae409, 0xa3eaf801567c3d35, 0x3820c90a436f54cd, 0x0ad477ccc48acc57, 0x6c6a6dbafc425bc3
+, 0x0192b59214503cc1, 0x004d3a06e16a1cc5, 0xa361dc4c4f7f5c13, 0x294594820ff1a4e7, 0x34b1d21e5ad57fef, 0x05286c57f34ffd77, 0x30fa6223b35de27b, 0x71c4442aab893d6e, 0xd079023f8e81aae9, 0x769c3c2dfb4b2c00, 0x0bfbe3ce08deeb2f, 0x58b0584afe958f09
+, 0xce4784cd41c86517, 0x4187dd02601c2a79, 0xd77bcb63e457663b, 0x1befbdfa727a88fe, 0xdf126bfb9fc142a6, 0x340458fa085ebdf1, 0xd277099b4e8a9095, 0x7cc373dc739a33c6, 0x7a8ed6d7e094c0dc, 0x45a96efa89254c75, 0xe161e01cdda932b7, 0x773bd3d690b0c9bc
+, 0xe18fd79c56ecfc70, 0x496da36cd995a3ee, 0x0f964ba86e4fad0b, 0x37177e9f59edb1fb, 0x8f77bdfafa2f26e7, 0x1f45585ea05607d9, 0x5fea4d967c3a1e13, 0x0976e4d42a5437d5, 0x28a2d784f2bf2ab8, 0x5b9b96bc3efaca0c, 0x3dddb47036ac4274, 0x66122d1541a6d173
+, 0x851b0de9867b0b59, 0x57b0bf7a8bee0a23, 0x16261f861b563bb1, 0x3fd095ff8500c31d, 0xf0882c2458226566, 0x71e9fcc1de273fa5, 0x4292cdebaa71f02e, 0x4a52eeea019c32e1, 0xa7f8066b39734579, 0x37ef709efe35e4d0, 0xc1ba3fc2db8c1f98, 0x3dc4ed13ed7b8397
+, 0xe6d7749ddec157d4, 0x2432008db3d0da20, 0xba1a4e20056d9a4c, 0x08e4239d9070e420, 0x9975d7508d15af0b, 0x4352f9505d7a3f7d, 0x199b2b7477bd2dcd, 0x5b19515cc847eaf8, 0x355013119b3a8dbe, 0x3b8ae4c9048ad172, 0xd435f863abaa5396, 0x41c5f5314913eedb
+, 0x573b1b039f4083df, 0x06b694dbdb4f481d, 0xdd598f6aa71b515a, 0x675f9346688a3378, 0x169c504cbb2dbe41, 0x012684d076f78841, 0x72a72bf49eeaa10c, 0x296584b68812b8a5, 0x24d98854085e9321, 0x7dac08315f8502ce, 0x59fb1354a5942f6e, 0x151e5ea9a829889d
+, 0x6b93166fabf2db6b, 0x04b7d81eaefd5564, 0x9070d97c05019270, 0x1c23438564102982, 0x3ca4f20cea97f84d, 0x33f9c14ecdadef8a, 0x6418639fdaab8d3d, 0x5ddf8489d1d18168, 0xf212c8401a812243, 0x6a37657f9c647431, 0x350936783fbf8ca7, 0x6aa88c477849db74
+, 0xeb2d577f4858f7f4, 0x6397edb5954dcf97, 0xeff56ec591a3822c, 0x56834c07ab927dbc, 0x096f175bfd26e7b6, 0x675872b009705fd2, 0xfff78f977c3499bd, 0x332734d33d9148dd, 0xa64f1bad19bcf71a, 0x0e15637d77d76cd9, 0x13ea04a97ce2b6bd, 0x345288c73360d6a9
+, 0x155c134b628c7b1a, 0x1983340a34448438, 0x4f480ee036b3738a, 0x2484b966901bda35, 0xc1aebd0d04a9aa92, 0x56c2f1665d7ae7cd, 0x598ba81e567306ec, 0x1c36758562445b38, 0xbe676dc9d10e7e1f, 0x5a26b88a4b963e4d, 0xe15dca02d08d6692, 0x29f422bfa08b898f
+, 0x5ed752028b718cf2, 0x1a3c8b71eab8592a, 0x10c0aa2500879daa, 0x7f8033d5cdead99f, 0xfe0f9fe427f69cc2, 0x2c0bb0b671cedf67, 0x4eb017e09b0661c5, 0x243cc1c7dbca8752, 0x9e6435f77268f1d0, 0x56a2108864235eb1, 0xf0a7739326581a0f, 0x59747f7a1bfecd2b
+, 0x67b6913854e4a830, 0x518e52a6d380ccba, 0xe6e08b1e89c83a0f, 0x26ec8b91a9c9f271, 0xbf20b47f10582917, 0x1677c3069ef30b94, 0x46dbfbcf2aba2428, 0x497b0af96a2c4f55, 0xc9feccdb7555dce6, 0x333296cf39087340, 0xb57b0e1c637be987, 0x77b80d2b076389c4
+, 0xaf2e1648cd9e7734, 0x61a92ca8bf8efabf, 0x4dd5452c71b47842, 0x1544f7363d4758db, 0xf1e17e83605da88a, 0x24216fcdd86b3534, 0x404dd6ee32d2939c, 0x2c9f3806bcaa5ad7, 0x5dd9c366c5651371, 0x193c763f7739d1a2, 0x895d47b9396b644a, 0x6c8c6406a61188e4
+, 0x4c35b73d8f84b9d0, 0x6a1bc6b061db6500, 0xbb4c59d9b76dac07, 0x312322b001360cca, 0xc5e296a5d180c431, 0x2e7c54d553debbda, 0x50347ed90bb44a84, 0x2f2c303468799873, 0xb477f079c22168b0, 0x47db9e9e38df0cd0, 0x6d3333df6c85d1ce, 0x3c6a74d66f3f1514
+, 0x13d175f0d6e011ec, 0x536eee8462cebefa, 0xa557686265689b99, 0x704b5b32310e597e, 0xc1a01733e3b57de5, 0x14535678dd2c9ebb, 0xe9660f3e9daab3c0, 0x4ce66867c2e25ada, 0x3969e7361105ad15, 0x1120a1c09f49b951, 0x7ca14deffb865b41, 0x7c1978c76abb8916
+, 0xdf3250fe5b155039, 0x1d61f73ad18b89dc, 0x64b8f21f671282b2, 0x36acf2c062084b33, 0x8c0d8fcc1219abd3, 0x376a4ef38a0b1229, 0x5f445034f50c61c7, 0x3377a9ea7cdda52d, 0x632b449b79e71b7c, 0x132d26896eb0d5d7, 0xddde2ccb5e5dddd4, 0x5fb121000425b427
+, 0xa5136f2fb1db9ea2, 0x4ca0e09cb101b7d7, 0xb6b78084c4459665, 0x3e0421c262a5ba76, 0x01af2e0c5e9468e9, 0x77d867c8e6457f1e, 0xab41de8ce1f0a87a, 0x0e83372e33c01a17, 0xd631eed0f4d101e1, 0x55a16f274091ab04, 0x5664533a1fbb278f, 0x25a658c5cf921bb6
+, 0xd0d71179887bd1b7, 0x059a1054719b0bba, 0x468238f035af230b, 0x0f5d87af049a7dba, 0x23adc5f0057a0f65, 0x6791b785869a2d72, 0x344f2fde62833dbc, 0x3a6cf48614902571, 0x1bb91d1ef051300c, 0x5f95f286de3947f2, 0xdd7eac60eeabb649, 0x52bc4e2ef1e95e86
+, 0x0d3c29faf46b7ec4, 0x2ce0903b6db2b65e, 0xb7d603d4a9876db5, 0x6b3c39cea03e5bac, 0xdb96b67a0eee73b1, 0x664c4d7770724831, 0xb0d0301b2e315bee, 0x4ed065665f743182, 0xbd1a19bfb13147c1, 0x66225aa3363b74a6, 0xeb811931fe65a2f3, 0x3029f8f9fe905c8d
+, 0x21170f3564c5869a, 0x07b7091f15e1ed2e, 0xc17500503d731392, 0x23e540ee2a6fc68f, 0x84c3ba5584c49e62, 0x640f8c737df518b6, 0x77cd41204e2baec2, 0x46555012ca7e87e8, 0x54c74389315f36cd, 0x29cdb955979700f1, 0x423cae4c51a36d04, 0x2450218ef6302b78
+, 0xbc86e71862032d41, 0x7633bcc3fe31aa35, 0x437671f91cb2068f, 0x5e77bcfb21bc336c, 0xfa9421a0948d6488, 0x7f7263150a4d8ea7, 0xbcd3ddb8012095d1, 0x3c9a6ec73b9373c8, 0x80586f7842ee623f, 0x667637df11d05113, 0xf55cb11cb871acf7, 0x4391c4895e672e8a
+, 0xf705ee6012eda1c9, 0x7f4448d62ac85e88, 0x3754067c5baf895b, 0x41120ae71733903e, 0xce120eb6a49f561c, 0x0d5c9494c6a5c405, 0x27472ce34db72ffb, 0x0102bb675ac28869, 0x5f8b23178428896c, 0x2902050af25bdc9f, 0x7f632ecd75d691c1, 0x589c32e8a4007416
+, 0xf694b720a174ce7d, 0x1e4060dc0355a9fb, 0xf0dd7ddfde2a2f1f, 0x2083698596c5a5bd, 0xfb986119be742583, 0x0586f94e9de47359, 0x83bd8a94c9f36387, 0x76d5892e25c6f5e6, 0xfaa62e51dac2d695, 0x5944fde0890e99eb, 0xfd020ac80002c323, 0x1e486065dacf1d61
+, 0x778bb509b39e40ba, 0x349cf4a959bf9bac, 0x201ef2a565a5d6c1, 0x2561a8bdaca046c9, 0xcc6823a0cc1a8c1f, 0x232a97ae234fcc5a, 0x36c7364f7b32cbc0, 0x0d006a90696b6a9a, 0x37227b3afaadb4bc, 0x23040adf92051289, 0x6e1b7328792f1e2f, 0x4d76dc64a02d6848
+, 0xfacc9394f6f1546d, 0x4cb1ef0fe068214d, 0xdaa70a40e5db3e63, 0x2c616ff576c335a7, 0xd7acd00ccf96e7d5, 0x5d559e3c89ba4918, 0x197e3c2efeda9ed0, 0x0b634204ce269b42, 0x552061f434af7c19, 0x2546472f1a30be1b, 0x2b2fb965e417f760, 0x78f74ab46808bd33
+, 0xdffd15c866628c31, 0x4834f11d4454a40a, 0x5b7545ae53aeba54, 0x55617084a4476c79, 0x0249130f7515983f, 0x01f47b41b6b99f93, 0x73fe6f76e1841fb5, 0x7e7bc631a2c4b067, 0x7466fa38c9abc2d7, 0x0f60f5fe30c339d4, 0x474c1efcf574adac, 0x5a151a0b2b106b13
+, 0x635fcce5ecb38f01, 0x0a33306521773718, 0x3d56ae7afc596bf5, 0x3e12fb94e70280e9, 0x795d990ab9c58b93, 0x7071e7b27773b1bd, 0xbf90f4981ed76c52, 0x297e5b59d0704114, 0xc8e6eb4a002918c1, 0x6b7c6aa25ba7c725, 0x2ddbc8d4f39d2e2e, 0x1b6190b674a3e9fb
+, 0xe58ca18e1570f318, 0x3b85d4e7b71ecf28, 0x953ab647deb7846e, 0x565a763ca2afc672, 0x533dc00828eedb86, 0x77fb31b6ac3871b0, 0xa21937098b07924d, 0x1f580c14058a7b66, 0xda2609793d8218bc, 0x725833adc45e11b3, 0x38d8e6e4ab8ed8b9, 0x4775a4ff52e17d70
+, 0x73f1d58774c7dad4, 0x0f5318e08438a8cf, 0x6b23761d4ce448c7, 0x7092f6886252c66a, 0x280c4e685c481698, 0x241b30f8ab6d7842, 0xec502096e498475e, 0x31d2ae854f9235fa, 0x240357069e24a3be, 0x1cce41fdeec6d53c, 0x128ec18b9cdd24a6, 0x786c272d3b4d68de
+, 0x0f337a4dec84dd0c, 0x2d9361d819be68a5, 0x4301c0448186d937, 0x305eec8cd2004b19, 0x11d096ff8db7307a, 0x1d4a7903ab83efd3, 0xfcfe133a23d00737, 0x2487299a752459e5, 0xda7a2033ef8d8d1b, 0x2753bc5104ba8ea2, 0x49adcae4345ae01c, 0x31c3e5a660d13f55
+, 0x37bd677e66c90a67, 0x3b5bb6da64f0c8f9, 0x9568fd042b356c3f, 0x609af2752bb8d3fe, 0xb449aeadd911ad37, 0x4f2eeb16b77ac7e5, 0xca2658a82a56860e, 0x5cce57bc5fe976b8, 0x9172dc2f91624f0b, 0x4320382a5be9ed50, 0x391cd920b6476f4c, 0x5a43aa068a8d138e
+, 0xb63b83f1b619d9c8, 0x017a819058ea63dc, 0xaa99be29fe18dc2e, 0x0f2885f2c677bd5f, 0x9d8d3e43a48808cb, 0x4f8cbf44219d76a9, 0x08f56e893e056f22, 0x7b07c19693931c23, 0x2ddf375721e59833, 0x388844fd161a913b, 0x266aa494cfb5b5ac, 0x44c97be5e1490499
+, 0xade02394a10e4434, 0x282dd86acc11f84c, 0xf7db014e722732ce, 0x53882b12b557bfd9, 0xbc6692e50e6b3f48, 0x3ee272dabe3254b6, 0xcf03d42bd3fd5c37, 0x3b851b9fe0b048b9, 0xe275fbfb26870fba, 0x79c35ed4e32573c1, 0x716f3f3648fad5b2, 0x7b346a5e30e68d8c
+, 0xc3877f092ea2ede6, 0x017fb3ca44f27a3d, 0xe2f19baa5e9b4012, 0x4ac146d2748be3ad, 0x807f642108ad67ea, 0x6a0a07b43f4e9061, 0xe2dc40e946986faf, 0x7c76b20566f234b2, 0xf4e0ec58f62ad00d, 0x1d3fff56c94c8b02, 0xd21b30487a16c5e9, 0x79da786accd7c7f0
+, 0xae027383f910a919, 0x7108a92d3f50b833, 0xf4513308e99701e0, 0x350559deb67a6d8b, 0x623ed582566edb1a, 0x2551d42fde0d8885, 0x8975abc4c70f8a84, 0x547cf4d6d390be8c, 0x516c659374fa66cf, 0x3288e5548042ceca, 0x1aa8509070835e2b, 0x43f166e5a42041a0
+, 0x5bbbd165ed4d3787, 0x5ff0c6027bcb1bed, 0x659099fb9123547d, 0x4adabf60abbce808, 0xc1f7d990fd591672, 0x797275eeea131cf6, 0xe669b7fb6bdb2ae3, 0x033af0431226917e, 0x079a10aec1eac923, 0x4c4a8732b7c935ac, 0x457bc8feba660be6, 0x3a680c83a9a3d1bc
+, 0x7ad3d2e1775ea73f, 0x3a7448632caf17bb, 0x1f85470e3608358e, 0x432fbde654036d4c, 0x4db46855cf138d10, 0x4cfb40029b8cee64, 0x62ace83787a153f9, 0x694309cf82d63003, 0x65f5cc711c18aedf, 0x5764a1be2f697717, 0x14f75c0feeead654, 0x102ca9c6a62447ce
+, 0x0924529ce722e8b0, 0x131154856ae3aa74, 0xa006061bdea878c6, 0x75691a1ab53c19de, 0xcb1f84df3a7d3d7f, 0x36ecc3b20b481136, 0x849c908b5d4c9cd5, 0x1ef032c4034a08b8, 0xb49de44edc17c585, 0x07ca9371db3bb7cc, 0xa2efc7f5c62ebf43, 0x172e451b5a601933
+, 0x8c23065ab98c2dbc, 0x2a0d8e7044c4f259, 0xbe879f66d13b3071, 0x1c826be625b106b7, 0xc8727b00bd939a18, 0x60fb68d71baa3f17, 0x89c4a873f56fc77d, 0x65280803c4eac804, 0xd648d3f11d656e8c, 0x65ade9b69505ee6e, 0x78ceeb297539b8ee, 0x3863a076bd7079e9
+, 0x57364cac457cb962, 0x6837b71b12a886a6, 0xdbdded2f441a61ba, 0x7a0417a7f7983a29, 0x000bc9c9d984eca8, 0x6dc3503884ac8937, 0x1f3df0e318786ba3, 0x3984b6a7e99246b6, 0x3a95f4ff7837b1ef, 0x1e751ec623bd89a1, 0xd99f7b568d5fff00, 0x135da532dc6d2db5
+, 0x59ef6b2320daf397, 0x3696e3bede527dcd, 0xc9395cb18a7a5f79, 0x30b9addc4953b859, 0xdf9dc8527bd4d56e, 0x0bd6992964e87743, 0x7a63755d6e583099, 0x7f422da1851f4131, 0xe425267eb25259a7, 0x6d33f04033f5eb5f, 0x3ce0806373adb525, 0x5947f5e79469a0ed
+, 0xe5aae5a663fd3d0f, 0x68da3faedb4ff0c8, 0x334e4a4246c54c2d, 0x0dccb690cdfdc3f6, 0x7f476327a0f45f86, 0x711f901d7001807d, 0xd8f4f6918207e055, 0x2282258de1c1c8b5, 0xab0b05bebfcaf3da, 0x0db2d2e514e5ce0d, 0x147d94f282dfbe62, 0x0ea7ecb95c80626a
+, 0xef7573ced1ef4b50, 0x2e8a0bb2b38a126f, 0x536006e61ed49a12, 0x3f63c996c7480891, 0x89a536932e4a0169, 0x7cb81509b932d8a0, 0x5a3b1a58125b6b3c, 0x3c7eea689be706f2, 0x74592658494481ba, 0x2b8e95aaf0e2bff4, 0x6165bbed6845b324, 0x58ad8623a7cf6287
+, 0x8a6db2610a0decd3, 0x07f71fed26241bd4, 0x84786656bb77e34b, 0x061be9ef038048a4, 0x062900f498a17b80, 0x0adbc9e5261d95c9, 0xd33d6703ab8fb109, 0x1cdedc161b7d6d35, 0x8e8eb026f56f80c0, 0x074f4937de09e5a7, 0x8db95b1d5e8e811e, 0x3d0c7ffb2e2cbabe
+, 0x2dbc6825938346d2, 0x0e839ebb38ec1d63, 0xe81c8ba44b9f6046, 0x53ed8a3f764df6d2, 0xd8c8980f4ad8fda0, 0x4686146d9475d2a8, 0x32737e743c6a0fa3, 0x7746aaeb0fdcf73c, 0x7310dfa322032d3b, 0x2bfa1a5ba619d223, 0xc29bbbcd5d66880e, 0x40717ed1a2da0de8
+, 0x256f34d32e03ed4b, 0x6bf0657be308292c, 0x81c0311b23ea297a, 0x1607ce608d91cd47, 0xe10d74942bf03d88, 0x7add304f7944b6eb, 0xafdc31038446a816, 0x59c1d82a8ed012bd, 0x7984d327b162438b, 0x6c07456eb091c870, 0xd59374d289c04ae1, 0x694ab0747a378f2a
+, 0xf4b6dde2e65a2fcd, 0x29be62d643397588, 0x335e4b986839e769, 0x3eacce5dc6c6f00a, 0xe11bdf879d0cbdaf, 0x16e0c2477cbfb99e, 0x18c600a196bccb4b, 0x71113470c247390f, 0x3b1860f1bec08092, 0x6c32c40e004f0df2, 0x37f2a32f5179e16e, 0x3861d526db50bede
+, 0x48d7edd183ea71f6, 0x53d792f02013e36b, 0xbf8a9204cb4f68c3, 0x499fdaef12571f65, 0xc3308b6045457af3, 0x1b2435c198ca06bf, 0xd7035510bb172337, 0x42d9970407af967e, 0x9e3556e562565500, 0x10cf30233ce8b26b, 0x42114ccae7f336d1, 0x6704734da68ee663
+, 0x3486ef1d5e5f4ec0, 0x0579c18eb3896ae1, 0x9df15a780dea100f, 0x220d7fcea811f29d, 0x4c8c57e12424e189, 0x3aec57fa76d7089d, 0x5828512feb6fa515, 0x3d628444a428e26c, 0xb1395082db0a9912, 0x6408623b450fa609, 0x451b66520e6fe8a2, 0x7dfa3ab561279823
+, 0xdada17466c021dea, 0x48e60bf9a0ba27aa, 0x29b6b8777e49e1fe, 0x590d7c70cd3ed1ae, 0xe6ceb7b9a8711447, 0x5ecaa1b5a75df395, 0xa571fa57bd1ede16, 0x02cfb46b45fd774f, 0x25aa24a9d83ab89e, 0x5c647841e98b3f0e, 0xaaebda32a683b15f, 0x486ec93b8b2bd176
+, 0x1689a74ae1277568, 0x75bb5255b78a1114, 0xc688069d8fbf05e1, 0x07e9fe19ad732461, 0x843223bee317cb73, 0x7bd2629169ec68fa, 0xf38f0ce48b71fd1e, 0x4c9a213f7faf0e6f, 0x063c8eff500f6d55, 0x0f1c58946e30ff0b, 0xa98c3b665cfa7aff, 0x6ed604bf0947fd91
+, 0xbc43d2943c1ec20c, 0x340ce0aa9708d9de, 0xbf01f0d6cb678dd0, 0x7c0935b9869e91da, 0x049f56cd21a3bf01, 0x79d7d3a56ed5cc2a, 0x8e8d09b554650c02, 0x35593419d348a7bc, 0x56268addc921b819, 0x315a92ffd1114772, 0x72dc168ec1524d46, 0x55055d6ff966fb43
+, 0x4a82007f2d8de050, 0x211f5291232d17ff, 0x27920dce33fdc9a6, 0x195cdd61f9f7de66, 0xdfaadd4def1cb2ac, 0x15b31f0eeb19865f, 0x5f48934d3b8a09e9, 0x7771f3ad8ec226fc, 0x7c742866406c0264, 0x7ceacc198f0b9c0a, 0xd1670acb48126a63, 0x33365780787d2059
+, 0xc9c89852189e8224, 0x4f0f3898aaee4b57, 0xa8755ff7c5853f44, 0x5f3f6055102adf35, 0xf9c6efd796065089, 0x378740d00e531961, 0xe61cbba44625b32b, 0x37b05b524dc4317c, 0x7793e24e3f0e0208, 0x2285e764fc95d9ed, 0x43c266e5da05abee, 0x4af07e041ccd429e
+, 0xda84c58fb228bad8, 0x64f674131c0a96dd, 0xe4a3a06c0ab2132e, 0x24981461cae8ab16, 0x7d72602e910e3c9d, 0x10829f6500f2c241, 0xe82fa3ebe3097494, 0x7e1c970e356a3f32, 0x58ab212b98c6380e, 0x13eeb0f1e4eb2c06, 0xf96b9a6becae3db8, 0x03ece239c7906849
+, 0xe24f14be2930895a, 0x093bf7987bceb4d5, 0x536be0d0d884c5ad, 0x17b856310fe7cf36, 0x27162c32d8975445, 0x2c81ff78817ef504, 0xf932b14a12a2015b, 0x203064b9dce9fa7f, 0x590dc4f7d1dae203, 0x44e5889397bd178c, 0xc208ff34ea4dadb7, 0x61c7903dba47eb8c
+, 0x36c3e0a793505c4a, 0x0f898e4c47fae1c3, 0x6b54981489a64ace, 0x4bd1135247f927e1, 0x53eb4996b94e2dc6, 0x0a1aa5f67c96a200, 0x0603e5bc2ed86d72, 0x574dabe4aecf1585, 0x7cfedba84e41132e, 0x7922cd6c645a5894, 0x82c74a1fce765dbb, 0x30ace8dd042f87b3
+, 0xc64e8c98305d09f8, 0x4147caa12daac0f2, 0xcdb6e92000ffe274, 0x0cc6edbc367db2a7, 0x07c6908b573f483b, 0x61d62c03f525f7ed, 0x995de12125ba7bd0, 0x5d147f7053749020, 0xd90ca60e90186780, 0x1892b35a73e57c8b, 0xd09388a46857dd4f, 0x17335331eefb7c4f
+, 0x72ac1d46d72e3a57, 0x6f766978971a0146, 0x2ec874359b2be241, 0x60704e7c5580fd03, 0xf849bb542e259723, 0x2a81dd6ccdc2fd83, 0xb3f460d440bdc80a, 0x08e31d8b9f2a6fac, 0xdd0dab29ab251b52, 0x773b9bd82c5a66bd, 0xe7f19b8f6191b326, 0x51bb6d868e1303f8
+, 0x52135d6521defe72, 0x378402e307fb11e9, 0x9419311efbdc8acf, 0x79f4d929adbac178, 0x9c310ead98575000, 0x25589ad7f033416d, 0xa486522064efc75f, 0x4e89c9ffce1376c4, 0xe62c4aec37dc4529, 0x2c84e88efe9f38f8, 0x534dd5c22c54e944, 0x3a96e305fb23e615
+, 0xa579af2ae5cf216f, 0x0d45a1a23f7c8a44, 0xa3d1a056a90e9f57, 0x29d6057668af0ab5, 0x0d5c034fb52d581d, 0x693910f1bec2f7d6, 0x9e04c49cbc2dc95b, 0x0092ef6376add07c, 0x76adb6a19c3029ce, 0x4b1ad24de3319685, 0x259c65dc589ea73c, 0x0d0021600f555ad2
+, 0x2de7f213608c693b, 0x3f1a0a8df24247e3, 0x4be2adb673272328, 0x278c08d4e75d079d, 0x2ab4739931ef84df, 0x2c59b56db8efea27, 0x5bd8ce933bf05d4e, 0x5ef95b98cb79694d, 0xeff595daa842a075, 0x08350d9b57e1cdfa, 0x335d4c10827e05f9, 0x2a9670a1bce6e498
+, 0x3ba6f35dcf5ba2a8, 0x149f588f1c18f68e, 0x2a70f41d450c6ad1, 0x5c4a5a1b7537ab4f, 0x00744e419c1b8d33, 0x0f3535044e9664a4, 0x5cdc8e9b999ae079, 0x3bef1b95665f5cdb, 0x089bf13abeb566cc, 0x714d248daeef0fe9, 0x4488317bc36ec6d2, 0x307820ee06cbeeb7
+, 0x72d183969ad74b41, 0x4f315cd7cdee1137, 0xb282b341f23e1391, 0x6ec45ff7f6d11db2, 0x06c1d73e437d2c8c, 0x02799b79b6da81ef, 0x64d65461c7ba793b, 0x3cba9d4421253855, 0x9bb5d4eebdd5f50c, 0x174f23c62cd3392e, 0xcba972f42b9e8f56, 0x23daa314002a8cf7
+, 0xac32fd85fc15450a, 0x364c623a8b7e8d8a, 0x8d0409c07ec90b4a, 0x01d233e6a89087b5, 0x7f082cd22f547f3a, 0x30850f0e4b2ebbb1, 0xe7be0df344741946, 0x7e8b1410ec3bd86e, 0xb0bcbb416eb7952f, 0x3daebd569715dd30, 0x77f5f62c103ffb65, 0x16f1587319fc2b79
+, 0xdcc74aca77e8ae12, 0x117ec9e09045ed61, 0x2922be3d8028b07e, 0x2743a2fd21094e2b, 0xd33eaa10314021d8, 0x27e369409313960e, 0xf1852381e8d8241d, 0x47a5549fbe90d1b0, 0x53c95fc4cc0756c7, 0x13fdef4862131698, 0x014e54765f30631c, 0x13e8c72042ba614f
+, 0xba76671707e44759, 0x555ace93d01f2ff9, 0xdae72aee81d195c4, 0x1f59c6464142e082, 0xf890cd1e7fdc6b92, 0x591b2cd1e654bffa, 0xfeaaca7db44746f2, 0x1518432ef8c42192, 0x731b579a8484c6bd, 0x07f2d0770f9daaf8, 0xe2c22499f06513ce, 0x192cbf1a7a4d1f7c
+, 0x390a0e305e96ee71, 0x6b70bc5291c0ac31, 0x45523d7f5de1dd1a, 0x62abdeaa7e7190d0, 0x921f3ebb55bafba1, 0x28f0438967ba3555, 0x7fe2b8bab30065bb, 0x638e74f9db63a7cc, 0xdea048ac1ee12ea1, 0x2a05fdf978ed21b2, 0xbe7ddb2efc0e3da7, 0x216044589180ccfc
+, 0x18225bf27844a16d, 0x11ad4402b09cd6de, 0xc2d23418e691e58f, 0x48b108c9db64adb1, 0x4e513c6c28dbc912, 0x5d779dc7bee5c478, 0xe1474fd3e1dae98b, 0x7ceb73ec53d263cc, 0x64a28822014d20c2, 0x4ea1dd0383f6876f, 0x8634f81e63a11894, 0x0fdac4f4b7d51087
+, 0x02865e6fb924b1b2, 0x69c4c6e834e89fa1, 0x211e0b8ffdd92159, 0x37770a28abb1398d, 0x25bddeafdf36880b, 0x263cb2074c3b6415, 0x98ec944eaa31c754, 0x5e9ee5cc63c32791, 0xffd7c988a81a6246, 0x70f07d4b2038925a, 0x9c06bd9e4705c397, 0x6b97de9898405313
+, 0x759709906ebe5434, 0x4aa4fe6b141eff03, 0xed899294424a88ce, 0x5537532ec917bd9c, 0x92a4de84c4d1bb76, 0x4ab15a2450a287c7, 0x18404688e6eba584, 0x024064fd0dc9c1a1, 0xf732adaebb9cb7b2, 0x6484bacaa9e7e4cd, 0x490ca1c65772e2af, 0x2155c2e8c031d959
+, 0x151c584a2f0238a5, 0x401bf1cd01d1c69c, 0x7555633ff85774e3, 0x0af036202bff1247, 0x192856a557029cb4, 0x66c57916ef7824a9, 0xc394ed46b66faf0a, 0x01e89b8edd3bae75, 0x17f36c535d27cbac, 0x234234e2540fac7a, 0xe26496ffcd5dd9c4, 0x24ce773f4cb62cfc
+, 0x5becdc0aa3036b10, 0x2bcb884dbd8a54c1, 0x0e151253a3bc45fa, 0x02c5ae606aae1ec4, 0x605259f3f7180f28, 0x648710516530b0db, 0xa59bc000c43a20c9, 0x2d14c4101d2796a8, 0xdabdf2316e9ce3ea, 0x48a57878c5c63cb4, 0x9b74c754182eb8cd, 0x5be0b63ff5459240
+, 0xab6d02c2a13ddad0, 0x2428903caecc574a, 0x91e7b43c6f51dc5d, 0x0def03cbfd78943b, 0x3dc4f4965a36af47, 0x13165b9071b32a08, 0xac532ff42583e132, 0x72b5babbfc187ca4, 0xe1bf901faa61891b, 0x6feaf95d3d302a1b, 0x4a030b9f5f71606a, 0x6d069db4d181b654
+, 0x3fc1368faaf7d22f, 0x4a3ac612ba0e78fc, 0x50b17080b3db9a18, 0x2ed82e46155b14e0, 0xf7f2a08199f4c2fc, 0x53ead3044970f38b, 0x2710808f2fdb5465, 0x4633e7263ae7ac63, 0x8b02b6f4a298a003, 0x7bc76f267476c7fe, 0x0ca27da677d88106, 0x02edb87c81590300
+, 0x7895ef18307c264f, 0x56ee90aaf3c9063f, 0xea8e5d61a7c87841, 0x5ed41e70a3b16f86, 0x07368ff3fb7bd686, 0x43d7372294c78f86, 0xa81d9a342a03c685, 0x254a1184505cae08, 0x52c14f742f9dfc70, 0x7a6444ff87161ec3, 0xc96b36cda03105c0, 0x1283c2de94219820
+, 0xdb63f3b96478c6b0, 0x252e70dab840bcb3, 0x3128c5d68d91bdc1, 0x0093c17e5731ee5b, 0x372f3ff3d924e805, 0x6666b881d6ee4724, 0xfb2a9246bbd7a2b1, 0x7ec9efabd469368d, 0x0574b949f8bd9a4a, 0x4f51245b5b45a39e, 0xf71fefdd855546b7, 0x024a6aed7634c8be
+, 0xf3ce4160ab83ad3b, 0x0a456366968aa930, 0xdb521e93fcd82719, 0x2458020ce132f4ae, 0x4b5676f02624c87c, 0x69b0ed2de25afb11, 0x22a1f64af81461c8, 0x4cd349c8baf685ce, 0x0edf8d77a032af1a, 0x7936cd343ee1cd14, 0xae1089b49209f461, 0x5655a7d4cdcdf5fb
+, 0x884653ac36f2b720, 0x5be9da476568723e, 0x7054e1db42aa2650, 0x03242571bcd7868b, 0x2487a1e05a3f34a9, 0x2d33840e813987c8, 0xf71d8e245b49f5c1, 0x51a96e78df25c098, 0xf0079e8aa58e2ef3, 0x65e68f24cd3822ac, 0x6aff0929c51307a1, 0x72681439727586b4
+, 0x48e5ce51475911ba, 0x63984a4be4b60dc3, 0x5d5cc69b704bc7c3, 0x48cd06eaa640ce75, 0x2672c843e3e42ce6, 0x16b2965d99207469, 0xb48899f153c2a1a9, 0x3f1650a568adfb01, 0xbd5128df2128e279, 0x30f21b696513a452, 0xedfd8fb1f25a126e, 0x61a2152ed4dae0be
+, 0xf20fdce5d18e070e, 0x2ec413a43051c4cd, 0xc2bd8c687cdf6980, 0x1949260aed7ae106, 0x75bb1374d22d03e3, 0x62051dc7f2ade857, 0xc92aa9d9e353fdfe, 0x69f9287e66ba57f5, 0x14cbaddc82df132e, 0x342848d84cdb5377, 0xd79c0ea2d11e13ea, 0x692ade1edff644be
+, 0x007cc653ff603566, 0x56df89602e27888c, 0xa17758ad9f58bf36, 0x5b1f689c789c1d63, 0xe90d26f9712bd278, 0x53b3e9a8f9659846, 0x4e2a4ae7d7d4f577, 0x6dde3bb1238f1cfe, 0xafd495c5e9cfd095, 0x7aed493e3c93f67c, 0xc94bc4a696c24812, 0x1242a6b91e62ff8b
+, 0xe0e8fcd35c165a49, 0x58cbde48033878b6, 0x593f9649eba7d342, 0x0b3954f78e4bcd26, 0xcd44f64c7f3585ab, 0x10d13ae06d1b5d9c, 0x37dff556a43ff6b6, 0x4a584c2627a9b52e, 0x4c90ddc24455548b, 0x27b874fe06fd8b47, 0x145e0fdaf8d37fa6, 0x6e1e2bd6de26fec6
+, 0x683a4ab2953d0173, 0x276d9cf87d128da4, 0xbe281e349c998613, 0x71b04f8947006aa2, 0x6a66317355354cf7, 0x3476ba909272f7d7, 0xf5792f10baf72173, 0x635974a8b6f201d3, 0x31d2a68ce6f3e69a, 0x2d6e1007e4ae3101, 0x57d8e928876ee0b2, 0x632f6397ae3e5a03
+, 0xb90d46a5446e4aad, 0x1f581eab7d78d6b6, 0x5ce262bbca2cc88b, 0x6fd09dcc601752c1, 0x5f399e97c2f0a9f6, 0x4572bdf9b7a10169, 0x8633d94d96b7dea9, 0x23c6ba49a853fb2f, 0x6286a82e8e99cccd, 0x46cf586be1d97057, 0x99dcda97b4b99f67, 0x2751e1a6b8d78871
+, 0x7d1a5842849368e8, 0x37df1cd807c03a8e, 0xe441255255cc63a9, 0x3a4e03b36649c0c4, 0x917e681142155531, 0x35148a30bfad318d, 0x31fe0f21ed1b7c95, 0x78f327e7d0fb5c88, 0x0f12ba347303b897, 0x78b969ca6bc5a45f, 0x2d6523060a1d3cf2, 0x71ff9ba43ac55379
+, 0xad8ece76c24ba1ac, 0x7578991f07a005c4, 0x1f8810a1ecad0109, 0x435970af1cf253dc, 0x91a0b84ab6fbae39, 0x36e900237b925363, 0xeee98999ddf1168d, 0x0dd2524de6fdb818, 0xad5ed36ca75d6d29, 0x50cde046111dac08, 0x4c8592929f4aa000, 0x5228ac2ea270d22c
+, 0x970ece22ced2cfad, 0x7c6eb3df0f3b34ca, 0x0108bd9f3e00cea4, 0x4d194acc7d3e1c61, 0x862a3ea65b0db839, 0x1d6e1a07c51094eb, 0x4207836a56e2b9e6, 0x032e896dc0b272cc, 0xf1efdb4da77ea587, 0x1b162597e4acc18d, 0x9499c4401b4d4135, 0x4c8f1b3ca37630e9
+, 0x3842ba05aca98386, 0x2a3f1cbd7f1ec9e3, 0x42b4e732b875fb09, 0x6efc971753a44058, 0x1de492c1ac0f2fcc, 0x63a86d104dfc7956, 0xe76f497a42c19a30, 0x084877a3933adbdc, 0xfa434c139b9f80e8, 0x2fd32c330b430163, 0xe3b8221db529e489, 0x4e346d59ca541b33
+, 0xff73cdf4a702c292, 0x30c7aaee04a0a01f, 0xb3a478ebe02d3bc5, 0x1ec23c216e8882bb, 0x8c088282f0b04748, 0x574097e3223fcfbc, 0x94a414e2f8acc3bc, 0x156e5fb545f8310a, 0xd8069d4232798be4, 0x7c2c521254596a81, 0xaae7c41ed1707180, 0x15401f1a301a9d44
+, 0x13e9fecc54692578, 0x6490cdfcb05e4029, 0x079868286aeb89b7, 0x1c3f2ddc94c62130, 0x3e968277b4e3f335, 0x31e7d83e74428888, 0xf41343701c8401e5, 0x0d0f555da1ad11e7, 0xebcd94dc9d35ea91, 0x0c0c51a1c317d56a, 0xf96b6296834a68f8, 0x7a5005d79a7a1ce6
+, 0x6cab6eae2f2f9527, 0x691b4ef8f0f4cf31, 0xfba5dea3fb90c170, 0x7f26865d6f52f5ca, 0x95c2d1951363cb58, 0x725ee2ce26aac466, 0x8082694413d9bdce, 0x5f7a6c73a6621d50, 0x07a9809349cb04f0, 0x77f34d1fe79a4ac3, 0x93a5cdbdfde4aaca, 0x2be3cdab717c834e
+, 0x47515e6b0c467741, 0x611bec887c737a0a, 0x918b8b34a82d5f35, 0x28a0c8b3d440651b, 0xa596c34a22ac6718, 0x4cf356684c028fee, 0xa15049127d946453, 0x7c4bbfa8d4a36e19, 0x9636ceb57c82393d, 0x4742bc00656ea957, 0xcb8903bd6f94b699, 0x36313258055c67c6
+, 0xcee74b61b0a5070f, 0x4e322cb98a2e558e, 0x5a22625091bd9bf6, 0x15a8f20905b0fb49, 0x4ed91b74cc3cb61b, 0x6f9f1ba1e9eb3a44, 0x7981ad01b767d1fe, 0x72a810b7ab8dfd59, 0xe8f2457e9d77ed31, 0x6db9df99ac0a076d, 0x1a0cf667f9327410, 0x05424ce69a60b589
+, 0xefeee206302fb274, 0x7520e981e6b6faa8, 0xe8fab10129a09854, 0x671e48884df27460, 0x4e71da41ece6b789, 0x20494fad741b1b21, 0x60855cef9160ff23, 0x42d6a9b7150e3524, 0xfc91dd3247c8ad8a, 0x5200f8739017a69c, 0x7d083b74cd94d264, 0x06511981728a3e55
+, 0x2a76d7d295b63d7c, 0x18d5e2471ca80b1c, 0x43e8765897cafba5, 0x20860adf976798f9, 0x29872e9990197465, 0x762a079acc5d2aa0, 0x2d110b50b928799e, 0x6a9cc811645d647f, 0x384b461c60df0c9e, 0x5851509decde18a2, 0x8c07b6be9647fcae, 0x5d70333a19e3010f
+, 0x480629d5d35df4dd, 0x14a205af1b71e865, 0xa270af90c2072206, 0x54425023828bf7ee, 0xae73f9f4fde68b22, 0x100f933cecf8533f, 0xa27d2144b4a1fe0d, 0x118c696ac2427060, 0xb728720cf86ca74d, 0x0acb99448dde7176, 0x5477655c97641866, 0x1eaa752f55b5ef67
+, 0x7a8a914e226c1f52, 0x14a085db7167ec51, 0x9929535701e78464, 0x01be2e097f60401e, 0x846572dad37a737e, 0x7efb4ecf71d3a95e, 0xef07936876929066, 0x3ae2649709aa872b, 0x51c93d6912bcc8db, 0x5c108d39256e2e9e, 0xe47577d52ae7c525, 0x6431a85928e04163
+, 0x24d84ff17fbc1b36, 0x757efa844434260d, 0x2dfe2b7865096f5d, 0x4a2b35f4cf4915bf, 0xb442c04312a439c2, 0x4e5684994e9bcf61, 0x9ec7c81772e77512, 0x3dbeb82fe4b3ba0b, 0xe98596fce92720ff, 0x09667c138b44b311, 0x4fa7f48264a95bcf, 0x344fa573ed3a43a8
+, 0xbfc31cca8c10cbb0, 0x260882799890ebd2, 0xa58cd1b82a0d7805, 0x2a19b5b11abbc356, 0x6b7d639baa59e7bf, 0x7fdc772543174677, 0xc2cf292097df32a6, 0x6a6bbc23ee7c4cce, 0x16b32fdae83ec926, 0x60f51c08c687fdda, 0x4ebf0f76895425cc, 0x16df5b8fef8bf752
+, 0x62196a0e379fd778, 0x05b6cc07737750cc, 0x79d5275a19920bfd, 0x637a1bf2a1ed5343, 0x6d22c0f3f5a1c8e3, 0x19d3fe4c536dcff8, 0x52da9c2e265070c9, 0x7c3e0c1f4759889c, 0x221fa5742380a733, 0x7342ec4710819741, 0x7dabd517dc1809f2, 0x16dfd571b5fecb30
+, 0x50fe5fffafd56ae8, 0x7bf09a649efdad67, 0x661f4c1842f390e0, 0x52f56bec0428bfb8, 0xca3c21e857b6eba9, 0x6f0d86d047d88984, 0x26a0b11c7a88a705, 0x59c77af3c2f94b16, 0xfe70828c257d267e, 0x233a550a81845124, 0x35f9050e8faa8391, 0x3a774e5e9f858bb6
+, 0x843e45c01f451c1f, 0x4f726f67fc5aba38, 0xf466ac4ab42a9ff7, 0x62dca06b9e8b9717, 0x04a380f19ec60539, 0x5bcf4783e6f2bcd2, 0x833cd4ee0d7bd64e, 0x0403130fc1056f5a, 0xb0e65f1b1a9c3757, 0x6b53571891ea614e, 0x666eb03003595720, 0x7a7f48fc4f59b3bc
+, 0xce48ca8e1995f465, 0x38211327a19f95e7, 0xb74dada726975c9c, 0x44e63b20628c41e6, 0xb70bed1c1e67e089, 0x5cdf45097e4f8d42, 0xbbaeb2c3e5be2361, 0x69c2b22307726beb, 0x04adc5c2e415d517, 0x0e52a5d23c7d9afa, 0x3d6ecccb8b8b7a7b, 0x1a9470aced4834de
+, 0x490b284b783bfe17, 0x2c5f6ae3e785002c, 0x0e4307bc4a4ee11d, 0x6340c550bd628843, 0x9ac10f0dc8433393, 0x43e8dbb29b81d420, 0x74967452b5edd386, 0x4df65a90d06ff378, 0x6b52f0b92e0dc639, 0x3492059afef62040, 0x93b8d58c7792a2a9, 0x1b8bea21f3251d53
+, 0x5c637a26a919a797, 0x4f011a4bfc32a3c6, 0x3fe778f10e0a3110, 0x026fa06187f36b3b, 0x4a4e679784ec7c0d, 0x722fe1e8700b03d1, 0xa3c001865a7ffacb, 0x065aa5e922e3b1fd, 0x3c00d73e6806ea66, 0x5f14258f3dca4526, 0x18703be283ea03f3, 0x23d0663d6d3b4f5a
+, 0x8ca2072f49032d07, 0x55edd9829c4b22c6, 0x5436ce2f53f9207b, 0x3c3b22dc362ecfec, 0x0b17d5432441bedf, 0x77e2c41185d4bf37, 0x0c232485508e1afc, 0x5d94679dea877f76, 0x7e54032f9c8f12bf, 0x14a391821fd60f43, 0xa127087f63f96658, 0x67df3538ec2b2026
+, 0x0073c005c1588ca6, 0x1e8387fb0661182c, 0x6ba6bbe0b8ed7575, 0x5d563cc2f2a606b1, 0xfa93903f266c9577, 0x2935b47685d6f9a4, 0xc1b0dfe8040c229a, 0x76c67177ece0aaa2, 0x75edc02d22b27047, 0x786e4ecee0754412, 0x655909fe5b378d93, 0x3dbb3f846fd28133
+, 0x10545825f3e698cd, 0x336c1d17417049a5, 0x851ad4408e120cc3, 0x3f1a78b277fc7e97, 0x32509b5070c826c6, 0x6f99f125305145f6, 0x11549e29e0869255, 0x4bee0f689060edcb, 0x151c50f66aebfa3f, 0x224c9364da50cb94, 0xd4e7b08ec1058c59, 0x2b580272e5545842
+, 0x4da11f90cdf2136c, 0x1db1d2baa339314e, 0x51a67121a919f75c, 0x42e4d982ced00865, 0x22d2debc7f933c84, 0x34155b468bf2e34b, 0x98586f1fbf8446d0, 0x0dc5fd9a9d5edf63, 0x3f868a095390d56f, 0x70d5199881551e97, 0x8981c9013e0506ee, 0x5379b1338efaf760
+, 0x5d58edd0421da8db, 0x0e29e2626ccb0988, 0xe34eaafa02cbd7b2, 0x2e7b521661c4d33a, 0x9220884ceb1106e5, 0x731d4cf1b45303e5, 0x398df7ac143ce2f2, 0x0f1c7a54ee0591ca, 0x293edce5f8ec21e1, 0x21e77b6fe3497349, 0x34d7561b64b225b4, 0x5b13e40336fb29a1
+, 0x0f1b88e7ddc42aa7, 0x0801283d095c5b36, 0xe5025ca1b6585a90, 0x08a9c2256bbc8212, 0xf3663893cee074f4, 0x1821635e6557a856, 0x2f5f4e653c3d6aa1, 0x57047b89a6081d84, 0x8701c2ddfb6a30fd, 0x4c618be3ba39a59a, 0xb5b6f9785d68c7c0, 0x0375aade4fd97dde
+, 0x6164dbb60adeed7b, 0x414a9d2fec3d174b, 0x16ddcc720645909b, 0x77f3d69733cc0811, 0x32f28dc2fafe3f37, 0x1246f4e130b0927e, 0x6f15e9a1b5670e29, 0x5101533af1a512d1, 0x2e7bf025e9a1c5ec, 0x2c294a4799861e11, 0x887a4cf60d786584, 0x36830054aa34fb8a
+, 0x2ee287184610b95d, 0x494473a133dd7af8, 0xad04fb203249cced, 0x2db6a8d015eb62c1, 0x154271bd2aa946d4, 0x1baaf3b42c060eeb, 0x11e7feaed3e241b7, 0x29fccccae58c66c5, 0xb3711c2ed01a5b0a, 0x47912e0a5b1d6ff2, 0xc2aca790c9b02f02, 0x5e632569ea4d60b8
+, 0xa6aed5c20b677505, 0x2908f232e7666aa5, 0xe2513e7a4ee54e07, 0x6582b97ed5836820, 0xe3f1e9dc19e9031e, 0x30421ede06098c7d, 0xfa64d559d3678aac, 0x71545bc5bd170107, 0xb049ed72c181d9e3, 0x43cb2f40f426dc4f, 0xac0ceda71af34db7, 0x62a67c8061e2aef0
+, 0x4f8a0725bd734010, 0x2f6a97e824d4c5f8, 0xb1416a30fdcbf1ee, 0x5009c78ff41aadb5, 0xd9d593f786e95687, 0x1426e294fb7068d0, 0xcd205cc1569ce3b0, 0x510b2b3d0e0c3aeb, 0xb86af42ab6116d51, 0x26c77537271957da, 0xd79e0e517b98e260, 0x36b05eebe8b44b8e
+, 0xbff6495b38d5b614, 0x425feafeb1799719, 0x51b2e3b782b938b7, 0x5664db9e71b3d026, 0x3dac297b39ff5b29, 0x3898151ea57933f2, 0x258f790e90e98444, 0x3d424838f8ae5732, 0x9f604d4d2e0d271b, 0x4d46dcbdb136d8cc, 0xdbd08befde8cf318, 0x74aa25fad15d9be3
+, 0x402a745dcf795ec3, 0x05a7ab23a36dbda8, 0x756823dbc457a779, 0x347ce334fd066499, 0x656d93a689eae31a, 0x0c608e93c2301a01, 0x1ecb5ff1ee02902f, 0x4d52f697017ef78e, 0xe3be99e0853b2293, 0x065bb205da17946b, 0x1122a20d7995b1f5, 0x357b6cb8c42c4d5d
+, 0x6dcd55ecf3237746, 0x6f0c4108f679a435, 0x5b98e9813111f9d6, 0x45fecfd1ce5a5d66, 0xa3905045328d5218, 0x213e2238094bcd1d, 0x3fffa8405463c27a, 0x2c5f087af723e060, 0x1049f2af194488b9, 0x5d4d532e81a261cf, 0x1284e7ea4e65fe22, 0x2a7ce6e6da5de170
+, 0xc4a18d924e786718, 0x31eb970d0440fff8, 0x201fdc0965a9f994, 0x629d4a7ac18be628, 0x5f3582f8045f1533, 0x57758d384d8794fa, 0xcfd706576536eee8, 0x68da1cee6d74af4a, 0x0ccbc02fce7c37d1, 0x0b1d15647708ff7a, 0x4414259ecfc2c467, 0x321818028495df8a
+, 0xd11898ea5e2923e3, 0x548a1966a0d73241, 0x4e401a0d59e72b21, 0x29d9c43b4b9f019a, 0x132310fc44479bd4, 0x65595d261604427b, 0x6320bacab7260681, 0x68dd229df875c681, 0xc836f390c285a70d, 0x62698d0e5fcdadc2, 0x3b13c3367c09bea5, 0x5582f13d1dc50b3b
+, 0x468b0ef96834b8d3, 0x6744338c9e631137, 0x6b1308caed8b03e7, 0x6fc4447d8d2a4056, 0xbbac307197a20f78, 0x7add62fea1f5b8f8, 0x6534498669cb45b8, 0x71c7a71b072a2a03, 0x5b5e61a59d6a6ad3, 0x7910eafa2cc197db, 0x0b8a52ade0dc6e7e, 0x07ecbc76436b68c9
+, 0x0103765419455d7a, 0x7f400be0b0bd4ea6, 0xb1fe51e7a58117e4, 0x4f3f138476cdbd36, 0xe58814239ad561d4, 0x4b3d799a11be7c45, 0xbcdfae0b5137e3a0, 0x772726be4c5f541d, 0x0fe6a62576a1ee7e, 0x2f5e5fb19f870950, 0x9df3f7911f85bc7e, 0x4cac82ebfe1f00fa
+, 0x14379bbe3d3449a6, 0x22e91ab4ea04b6a3, 0x1d0431787226cc80, 0x6d44490e08cb3f39, 0x3af3006f03fafff1, 0x649fcb26a62d6c06, 0x46428e486bb3aef8, 0x308afb31237c5012, 0x707dee2e8d62b316, 0x205c3403a323060b, 0x70623cd51be4cfb8, 0x798b98d99785b0ac
+, 0xd23cd8a0b0e2d78f, 0x020ecddc6523113c, 0x93728a42a48bdd16, 0x49c903d4de7f6fd0, 0x3a0ffb66e3153282, 0x2caa0885c1ac9a43, 0xeefd9f5893ccfeea, 0x6d1d64ea44ce7eef, 0x01282105960ba4b0, 0x47fc5f0d700484ed, 0x9a311b0f660f8b73, 0x1a6bef6f9f12bde0
+, 0xb24c1da98fb6be1b, 0x2561129c5e8188e1, 0xc6f30e2fd4b42c2f, 0x2a229d245d2c8380, 0x6f845900b180b27b, 0x4524bed75c0ed1c0, 0x75d537055c31a78a, 0x7dd80febaeab6972, 0xf419dda791b38741, 0x3842783717d87720, 0xfe1ff24de883fc5f, 0x42df9c0b4bbafb8b
+, 0xd5a619dd7e616089, 0x3d5e73d556b85068, 0xbd4c72fe7a6cc3a1, 0x6addda092dcdac8d, 0xc3f5d767ce7cac17, 0x713fd82bcbfe18e7, 0x0d96bd1ba0ca10b1, 0x40af31758cb8850a, 0xfae08a87d58c4646, 0x4ffd6c0f6eb800a9, 0x6691e0999638dedb, 0x5b2a6c0cd034a578
+, 0xe2696e2c7f10c9c5, 0x263bc54d7d796783, 0x87599b294aa4d606, 0x43c48b1888e8ed94, 0x8e84365c40b17ae8, 0x048fcbf5b6c3ae3d, 0x87388969f55030bd, 0x5b51640590978120, 0xf7e33bfc48f1ac00, 0x7c0d3e6a96cb261e, 0x9320014efb7b07e8, 0x645241918caf0822
+, 0x7efdbb1b28dca5b7, 0x6eae18683f5979d4, 0x6de6a0b9d54cb435, 0x0352da7df821f8ed, 0x90708f4652c10658, 0x37aeae5c68bba26d, 0x5bfb01dc1f96d21d, 0x437d3e2acc20656d, 0xcba2f61141c85926, 0x0e5f746512f9ae56, 0x06d0be4518bd6ffa, 0x1297541a443dc2c9
+, 0xb631199cd5eae592, 0x16a1941b07c92c99, 0x4b97013b83c0a77f, 0x76d19bbb311edd35, 0x8dfdb0c5e5437c9a, 0x5ed9f2a174f72cbd, 0x543a045ca1b29204, 0x5da5cd0f26773a33, 0xfa2e0f497a152c2c, 0x3fff4260b0248cc3, 0x6b59f0684a8ae399, 0x561389803673f36f
+, 0xe818e25dc5a1ae52, 0x5c66572f7232f0e1, 0x7b3e472a0f897234, 0x144fe80f57faaec9, 0xe36e7291f5112520, 0x77b67e779ec96f94, 0x35892711572c36d2, 0x5762c62593816082, 0xcc07a9fc06e05be3, 0x2dcdaa819960dec1, 0x255c09d624472091, 0x30e5df03357d5e57
+, 0xf295b26031dcd41a, 0x0f3cb907a0e7eeca, 0x8fa5d217ac83aa07, 0x26e311e84f67ab83, 0xb7612584b029b690, 0x32f11841744b670c, 0xc539f1333dbc784b, 0x2dbe2986ff4eace7, 0xbc579875ad70275e, 0x501dc944492234d1, 0xb0f0791f7dff8cbe, 0x721db666af11cfb5
+, 0xd61526bd7fda95d7, 0x3d6ecb7a87abe3e2, 0xee7f57c385f22946, 0x660bf817e62d07d0, 0x57e91ceece0fe994, 0x2d6e2216400f0970, 0x2495e54029e50107, 0x11d32222b0de276a, 0x2bd64f1fcfab240f, 0x2ad242b0a0d657a4, 0xc5c897a2bf3af52a, 0x4bc1aafaaaaceff7
+, 0x8585411434b6479f, 0x03c67c717bcf27ec, 0xc9dc0bc4bd32f17f, 0x7274fdce2218372b, 0x26b5336417916e6d, 0x15d34edbbfc42d04, 0xaf5e70c0a2d4e7b0, 0x2299b0425a759cd3, 0xde7a5d8a152d4e29, 0x5e260c394f67894c, 0x0c9e20d863c4fb89, 0x4cc5d263c31fafde
+, 0x2ff8cfe39c21978d, 0x147c4a4d92ab302b, 0xd7a9c233f040317d, 0x01d3df5677e6007a, 0xe246d996dd828b76, 0x6fe57b38f749866c, 0x96444459c6bc3663, 0x57dc4224e80d4d6f, 0x00a8af2aeb93d2b9, 0x63fde0e614736410, 0x132b821ce4bf649a, 0x01fe69f20804a0a6
+, 0x7add74c28673c060, 0x4a566d56fb6ab9c6, 0xddd6d1a9f93b8c6d, 0x1b75f83564959c9a, 0x9807c10fe7159a62, 0x425cc83b3525ad55, 0x5bbb34a2d1a563ab, 0x312f4ee4748dfbfb, 0xab12cc2deebae07c, 0x06d91037f01559c0, 0xa5354233c42f2948, 0x1d96ad44a6e55968
+, 0xf717f9958820a6a8, 0x33bfdca6f08a5b20, 0x5d0db6b666982d0e, 0x3d83c34a711a7755, 0xbe5879729540033c, 0x281bf96ab7628168, 0xc49650a30f85284d, 0x251baa5f12340148, 0xaadef70b7f962d05, 0x6bb57f3195f1086a, 0x9a580d1cae435a99, 0x2c4532adf6b704d7
+, 0xf654c42583e89e5f, 0x3b7f3492187c2636, 0x8d49e4c24bd96329, 0x4f1952f7d25b0078, 0x338827203f7f506c, 0x6d45745cb0860032, 0x93d7d28f8f1a9888, 0x41be7b01b4c9fc87, 0x9cf5018d63d51fec, 0x7612f9ec066c1c90, 0x1dc37d725c52b7a6, 0x76aacb2284671a11
+, 0x0c173f5c1d5655eb, 0x7e354ea3138cb3c2, 0xf769a04fe3e46de0, 0x462138ea1344682f, 0x45952e383616f0e6, 0x1cf6761e3e1d3bc7, 0x63121c6b6a14e90a, 0x522016f5eddc21cf, 0x17ecd1554d856daf, 0x2d3c2bdd008f0f91, 0x1fd3322558ccb2c5, 0x3199a9047518a84d
+, 0x8fb8f8039ce856ff, 0x4a1f170ceae0f401, 0xba4ba1930bd39d39, 0x6f0e79b803076ba6, 0x6fbf1b7b72017b49, 0x2375ca4114b36f92, 0x5cb5d142151b499d, 0x7ef487c0dc3cf01f, 0xc19ac2814ffa8837, 0x224d7dde30e8f33f, 0x9cb8cdb023e11104, 0x7d0e33824bcb4ad1
+, 0x3ea899027e6794fc, 0x359cf929e6738abc, 0x870b5613b3469fd6, 0x1d6231f0fc870ba3, 0x8587a3c8e49956c5, 0x62880d945aa9bb7a, 0x864245288b6dc404, 0x6eba2eb5023668cd, 0xeea9cd1e49132d04, 0x461cd0c491697670, 0x4f091562ef1d8dd9, 0x62b8ef9b8624361c
+, 0x1380a89bf459ef79, 0x0eca35a645c72fba, 0x02d86a89dc4b7ea2, 0x40a71369c2be6ef8, 0x8973b961a9144ed0, 0x27102c8a5eb64b13, 0xf33fbab7116c24ad, 0x50ffd83064cbe946, 0x2b86560f1f20425b, 0x26948ce37ff7c4e7, 0xd6fbe9c691ec098c, 0x568d5787f22b6e09
+, 0x2b9dcf52e2e32fbc, 0x5fd83d4494db0133, 0x3f75043f69869a4b, 0x7f0616ee9cc8f4e9, 0x27268e887b48d93c, 0x711946b8f54ffc0b, 0x4c82e4d66fcc35e4, 0x5819d1aa93788947, 0xc5513ee2379aef3a, 0x6ad099a30fbec05f, 0x6b46b0889b02fd56, 0x6f8773176f1594c9
+, 0xcc909e5b669d0447, 0x213062e72bc40d3f, 0x323be37f99757650, 0x1b3408a4aa4fd470, 0xa483baeda10d8c56, 0x308e6b46d99ed4cb, 0xa0d7271b935ff90b, 0x4b0a7035e58e2271, 0x1fc00b42afd966db, 0x2c382fa8ff0a48b7, 0x13b07ed29a273856, 0x67e9fd6184f225ad
+, 0xc2db77faeacdc305, 0x59144466ac366dfa, 0x848c6ab8ef38d0fa, 0x70900038f23bc0dc, 0x6961d366049807f1, 0x18dc2ec3609a6b1f, 0x90080ba6ef3ee574, 0x4daa036f22dc24ed, 0x66385439f5b9b7a6, 0x124f5360d9441838, 0x979a7792770810d0, 0x32012d7e932a42d5
+, 0x61a635a25db91bb2, 0x5ae6ebff4e1bc38c, 0x7de654fe54dcc335, 0x44c21fa3bf96c91b, 0x134df5f32d678a43, 0x2d78913bd53e5bee, 0xad67fca62c2ff23e, 0x344fe32ede1b4563, 0x738f175632d1ddb6, 0x7f667bab8e4b4cb1, 0xab465aff3221e8ce, 0x20fa7e5ad497d943
+, 0xbb13c1e3ee472d0e, 0x5b9cebce98246756, 0x14b73bcae8efc18d, 0x01098052e8daf96f, 0x7557d512123846bb, 0x46d12489d1be78de, 0xaa32ba7702e98082, 0x5aba640ddcf0e54d, 0x9798e30caed948ad, 0x08cf5c11e0ae5a40, 0x2fea57847cc9e8b8, 0x712204631f2d8c43
+, 0x5c8fc41ea6383994, 0x74bfd7b3429a6cf0, 0xa8970f49a952c2bc, 0x19ba22038cd22f0b, 0x19d0f9e489ab2819, 0x61801fc6bd4d2b1d, 0xf863e59e0d0cd296, 0x571750725e117d4c, 0xc0ac02b4fea129ff, 0x26af2dc42fcd5cbc, 0xac9a3122d4a70456, 0x314d98857b8dfdfa
+, 0x60c92d978cc5e284, 0x5b0e20125923e9da, 0xe6f8b77272e2c921, 0x1665e23330dd4726, 0xc94c302b58cf7f41, 0x62d58f981cb05120, 0xdf9347139ae31d24, 0x5946ac1f1f87f7ec, 0xf6a45b09c918b99f, 0x02e3e1783b9ec605, 0x222326760f7b7c57, 0x1774498cdded01c8
+, 0x84ff63c7d5b8e767, 0x2ed4f439ac8d2ba1, 0x0499ca7f9a2e6c87, 0x0253d456e68a2fcc, 0x3804fcb7d4e3cef3, 0x3e5ad12e66c1b1ff, 0x1072d99a2b9d693b, 0x67c7fcd40ee7940a, 0x356dee2df4f769c9, 0x11b90e4eb9b67bf6, 0x2650b1a272655343, 0x3597793f5a282d12
+, 0x7e106b2e39315283, 0x7562e11c77eb7fc6, 0xe46d5f32e4c14969, 0x0a9206dbb072e0ba, 0x8f930fd10d6e3a20, 0x7e299831e72be25f, 0x0c0ea7a5b98283bf, 0x1250e143ac029941, 0x0c0ce97cfc3eb29c, 0x6bcc4d5f6f285ce2, 0x1a6302d800b492dc, 0x2efc0a1f4df8bc69
+, 0xcf29d10bff96105c, 0x42ab867b740ed415, 0x32ba0a17845a4ae6, 0x2779cf726b1dcbec, 0x75be5f4da5173556, 0x7a3975e06a980d38, 0x2d2e17ebeb253969, 0x365fc25ca4b95d7d, 0x78d50bcb54b19d81, 0x6ea6ae0f21af1391, 0x1da17f92c33ba6e1, 0x2cc6ee8b928fdd21
+, 0x5c80e5e9025875e5, 0x33818e886ad6957c, 0xe5277b5751819a73, 0x30c8c287a4f0474a, 0x7be1c9024d079e18, 0x0b7b0b43af868107, 0x6babc6de87451466, 0x0b04a066ca3cbc2e, 0x33a91fc541a0b0c6, 0x5b0ee44c9c6e3de7, 0x8f55029fe4efc9d6, 0x0b9b2dcf3b0de050
+, 0xa9e3062a9c752cf3, 0x12ae3b278a2fe40d, 0xfdff6bf02175107f, 0x341f9f26b300ef56, 0x8359f57265aa2501, 0x2cbb5f4c2f66ce53, 0x6d63e1d6f17fbfd6, 0x6811bb65e9c4f42b, 0xf16e91d0fad59958, 0x00e09272d6be5209, 0x5d149b76fb5e5219, 0x3fbf7395f7e86fec
+, 0x56f3e77f74e33a3d, 0x70e9c748664d89e1, 0x838fd2218c1285f6, 0x091bc5fef98d8078, 0x0b46394d8822ada1, 0x5792e9445ae1e167, 0x7f049d6fdc801e4c, 0x57f0193ebf49016c, 0xb9f1dd599be1ba9b, 0x359efe6a1a8b5cb0, 0xaac7db28b6315155, 0x3d93662ca406d357
+, 0xa4cb6ac7466e9547, 0x48b2abc8b2aab22f, 0x717162c320bac98e, 0x18d690a1fae7d471, 0x2e03b5b7ba2c463b, 0x2477014d69829b3c, 0x103336a95228b163, 0x6462bdb58a4d0bf7, 0xedfb11e16de46728, 0x1ae34dfe5bd1b590, 0xa79a0b81430f1290, 0x31cc920a78884ac2
+, 0xf73dcb43b4b759c0, 0x29160da59081e0f9, 0xc1573de91b1657ab, 0x2a41968ed70e9d8a, 0x802c66c9ef6a5e84, 0x22120832912c1ba5, 0x3f21711f89e98749, 0x2d0ffd292d668d08, 0x2473ffd0b114fa25, 0x793996fb5543612c, 0xf7c96bc330289e0b, 0x42ca0b4b281e1b39
+, 0x75f5a00421163f12, 0x060492b996302c4f, 0xae78a2ea246af16a, 0x7704f64fe1111320, 0xb51b5bb075ff67e6, 0x0547d9faa993a227, 0x4770fbd4412c9111, 0x6657607e79ac585e, 0xb33caee8153fd6f5, 0x6cf669a22e16c018, 0x4181a3d537263056, 0x3e4034126c92a6b9
+, 0x7563905fa9c3bd37, 0x0f0fcd3d64343a5f, 0x2c647ab78003d27d, 0x0912e6d2c5fe80b5, 0xaeb28ae5071ca65b, 0x006d62168bc63cd7, 0x3144885b65f87e65, 0x1bca201445223a0c, 0x76baf8807e1739d5, 0x07b410c879cb1089, 0x7d58d5e2cc95a6fa, 0x1313348c965f512e
+, 0x75b35ea1f4ed625a, 0x2dab0899f1e66d4c, 0xc9543ec04f85aab7, 0x6b78e78e100f0046, 0xa576d8577c8651c3, 0x156b3cd399827835, 0x17fa042bda4941e1, 0x1d4f384fe268db34, 0x1b40354dbbb34018, 0x2ca17e9eb2011106, 0xf66b2130feeac481, 0x6d24d5d4063e28ea
+, 0x2b2ab7391841016f, 0x4a40b345043b3d7f, 0x85f675c7d4a3797f, 0x04f9e42e2770b1a0, 0x65e98ed36af33f2b, 0x14982e0063efe6c5, 0x0db0d9d49d9da16c, 0x59937d21425d49da, 0xdb4e93e8946517ab, 0x59e48300dbdcedab, 0x4b61e33ffba1828d, 0x6c5bcf236c3ead7b
+, 0x1a499864815fbfe4, 0x0a1ea04002c506e2, 0x4efaf6e155e0cc2b, 0x733b531293d4b788, 0x85c0853a761243f0, 0x651393802845a43a, 0xe64b7009d39e4fc7, 0x659b5d53f38305d5, 0x891f487d345c82c7, 0x6705b5a251fa1c0a, 0x773ff44348f41f44, 0x04d31e53c5eb6675
+, 0x8849695c705886b4, 0x27f3c4a49539a406, 0x7d1501479cce9f03, 0x726d1ee833f1274a, 0xe6faa9533a256e5f, 0x1dea00bffd114d43, 0x3299cba65a1635ac, 0x7d3640e5edadd480, 0x46c577b50ddb6f79, 0x7133df437c3eb056, 0x91b37de3dd0a1e92, 0x0dc8b2ad5821dc98
+, 0x10b5fe43718a79f2, 0x6cd17c134344284d, 0x259a9705dc9669da, 0x7ec57c6b2d3d888d, 0x2134f78b37dc5222, 0x046e1876354552bc, 0x0475f73125b1bdd0, 0x1730932e790b3c0e, 0x23066796c13bed64, 0x268f520987cd1382, 0x8a5f224a38af530a, 0x27ec6cf822ea1ba3
+, 0xeff598cf38de659a, 0x699931251a560bdc, 0x4f1a411b43b57563, 0x50dc63a42dfc2e5b, 0xd67fee68a28bab11, 0x3b1b7aaeea65fd8c, 0x2a0259eaa24e33ce, 0x35360cfc463b64ea, 0xa1ddb1cdaadb7219, 0x1a6540d56a2f01f0, 0x44e4332f1c4dbf61, 0x506686214d030b18
+, 0xc10b4b177f4497ea, 0x6eaea8c736a1a7b2, 0xa9abfcdd59abc403, 0x7eb1073c919db033, 0x1d53472563b35340, 0x695cc67f68600e97, 0x7fd7f0b0564a5aad, 0x25da6d30042c0243, 0x017a2fc2f74ac320, 0x29c78d24fad35672, 0xc95dfa4e7b08cbf0, 0x526237c6db24868f
+, 0x10e8fbbf6db90aa5, 0x4c41783d9b20b24c, 0xb94ae7f27b9a36c3, 0x64ca83a88093cbeb, 0x73f066ea6629320e, 0x0ea24fab45095b3d, 0x75ca71ca247179e4, 0x1039410d846564cb, 0xd0e4a5204d95cb90, 0x1bb15bfffb5bdc17, 0x1279a4f3c6492d6b, 0x2edc04aa307999c5
+, 0x25fa23a304ccbe08, 0x2c99be4183fade54, 0xdb410342a06826b6, 0x3b58f6cc54a61150, 0xe3ef4c7da4f6bd3a, 0x7c1a6b42d937b32d, 0x3745de886ca11426, 0x33700cc07d97bc4e, 0x55094d7175e1c2f2, 0x594003a935a137e3, 0xeb3abcf2cb00b737, 0x51ba66df64ff2878
+, 0x21bd270abaaefd25, 0x23399885d40f70de, 0x078cbc09a00964e6, 0x22b30709de29550c, 0x4a35502b29cded01, 0x659c4f5bc34399f0, 0xe55d59712306feac, 0x069daab6a9ca55cd, 0x2836e8036598732e, 0x4033372a1e8e9413, 0xe041d65964335149, 0x7ca8ef83d7cfeafc
+, 0x090c8d7bda502369, 0x179a9ea754fe6877, 0xadaca889c9cd31a2, 0x3795b16a82e491ce, 0xe82b9d099a4d2b4e, 0x60ad79680aefdffc, 0x2e211ec7911af912, 0x75617340ef5713f1, 0x5a4616e25a2f3a1f, 0x57795538a89e70ff, 0x6b15fbc9aa521556, 0x68d12e8145576e0c
+, 0x85ff9320c90fc9eb, 0x37380a2d5728df47, 0xc9b3dca282239b7a, 0x6debba89126b10bd, 0x7657199b6aa9bac2, 0x1c4cfdfa35df2286, 0xb6e8f7234274d546, 0x2243dce513e753df, 0x168e4ed6d3d5b049, 0x577989800c3ddb5a, 0xe6eae26dd2ae2858, 0x35de28770879dcf1
+, 0xd5eebb2f826c813a, 0x187c36c9678111ce, 0x906887f12e9d8071, 0x1ef0cf20a2aac230, 0x7ca10c70d1f60260, 0x58c66a7c6c4ab3b3, 0x0614543787c944da, 0x44006cc8338b4688, 0x52c2568c67cd5ea5, 0x65483c78981b533c, 0xe1ba9e98b14a6349, 0x0303ca035ae2dce6 };
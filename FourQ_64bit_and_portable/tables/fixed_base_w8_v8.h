@@ -0,0 +1,1037 @@
+/***********************************************************************************
+* FourQlib: a high-performance crypto library based on the elliptic curve FourQ
+*
+*    Copyright (c) Microsoft Corporation. All rights reserved.
+*
+* Abstract: precomputed table for fixed-base scalar multiplication with W_FIXEDBASE = 8 and V_FIXEDBASE = 8
+************************************************************************************/
+
+// The table below was generated by table_gen using window width W = 8 and table parameter V = 8 (see http://eprint.iacr.org/2013/158). 
+// Number of point entries = 8 * 2^7 = 1024 points, where each point (x,y) is represented using coordinates (x+y,y-x,2*d*t).
+// Table size = 1024 * 3 * 256 = 96KB
+
+static const uint64_t FIXED_BASE_TABLE[12288] = {
+  0xe18a34f3a703e631, 0x287460bf1d502b5f, 0xe02e62f7e4f90353, 0x0c3ba0378b86acde, 0x90bf0f98b0937edc, 0x740b7c7824f0c555, 0xb321239123a01366, 0x4ffcf5b93a9557a5, 0x297afccbabda42bb, 0x5948d137556c97c6, 0xa8189a393330684c, 0x0caf2b720a341f27
+, 0x4b607e815269857e, 0x12b7a2214a981da4, 0xec6065821d9551e1, 0x7a87fe893646d680, 0x08e8e8cf61719acd, 0x57a82d3ee6459796, 0xce59ef14a8fff761, 0x428b64e65b24a00e, 0x9b4e194041673819, 0x3cc61ba314d2c995, 0xbdd41ce667f37f9c, 0x77fc2c94d941fd81
+, 0xa76bf987b1c53628, 0x3e05bb4d9ee75ca0, 0xafe4b03ad2e779ac, 0x7efa4e7100c8cb28, 0x5bab90ef559fa96d, 0x42f1b79aa320e587, 0x052ff6e4d98f00f4, 0x106f9eec65ea88b9, 0x77ccdda4add66894, 0x18ed74ec65fe01cb, 0xa7b1908b34a2bd6d, 0x405aff1f5747302a
+, 0x848de8b9b35523b3, 0x4591c61890f9aadb, 0x2b9a6973a21c1432, 0x5da9091378b7ca06, 0x5028d6c62e61fbf8, 0x1666582d7f2da7df, 0x82f15e631ec9b5f1, 0x5bf43d871a1e0959, 0x64ac52253effc736, 0x6485c7f9183499b8, 0x4a6e07457516e93c, 0x71ac52ecccbdb565
+, 0x8cd528f768e447ac, 0x705689af30fdbe85, 0xc692ff971bbbfaae, 0x670b88376161c585, 0x0a63d58d6bcdfb64, 0x126e4c31957c9d3f, 0x24407f41f9351dad, 0x560b44dc2b2b697d, 0x964bad5f42542949, 0x7e58618b282a760b, 0xe3c91ee73fb3a985, 0x18bd73ad613a1579
+, 0xc1f816b3b780e4b5, 0x6bf4dd5be8b83e72, 0xea92b522e79ff71e, 0x55f5bb29996c0b36, 0xe92a70bbdd286a5a, 0x1476f5f1818b69c8, 0xef3bf0180bccfc57, 0x1d6ade02874981ec, 0x1a5b0f30336cecd0, 0x780b2715199568d0, 0xca59fe9bb38ac872, 0x222fee7ed23f822f
+, 0x972be4f38d480a38, 0x0bc8979c90d2c9f0, 0xf8fd5f62f27e5f45, 0x6a62a8e0478133e9, 0x25649abbae44162a, 0x3006198e7f4723b6, 0xe8524965c7a3c62a, 0x6aeafe25bc2513c2, 0x3722356407666149, 0x07d65e534a6c3969, 0xe7218ada98fc3b50, 0x23a8ee7c65168064
+, 0x959ecc43209071f8, 0x20114486be46bc9f, 0x2d262bbe80711a9e, 0x1a4f694d2747185a, 0x3cdc83274ed9981a, 0x69b6bd89797422d9, 0x191cc6918c212fca, 0x3f41d76b34800b33, 0xc1f2f53adb944b16, 0x51450a2fea2229be, 0xd3be5b1876a3b2f8, 0x2b03070b0601b562
+, 0x77a3e1b2d56c8e85, 0x5d5cb1a26ea5cb1c, 0x6fca063617d11cf6, 0x07f2e5160bcc841d, 0xcf4f51c191ea35b6, 0x68a1e33473963fea, 0xf267db6ad5daeeb1, 0x4b9fb717dbc754fe, 0xfde8dc5c280d88d8, 0x0c12ddc771cfc91f, 0x52ef4f6bebd8f67a, 0x3584e95c06accda6
+, 0xa0fd84db5cbee384, 0x03374d42548213c0, 0xb78c1b975f0a751e, 0x2a39eb5f842dadbd, 0x8ebc9dad0e962288, 0x7cd13042a320bd08, 0x1aad7dfd2d3c0395, 0x7590b3f6f041bc6b, 0x5cd8fa661d3097d9, 0x005a5fef0875d049, 0x0541cb38a2386e1c, 0x7018bed165e49e6a
+, 0x50a8fcfb23b8e71a, 0x0221a9f37ffe2232, 0x23f0d72a9b50e1ec, 0x1081a7532b770d50, 0x2208f6abec354db6, 0x74279b99b6bf8f26, 0x171611ff9502ec3c, 0x4fa9583d949a9059, 0x38dc249bc30deadd, 0x1954ba0835e27af7, 0xad705fb61f761af6, 0x66974c5f35bb6514
+, 0x98a4f34ceeac638c, 0x28248b59bf4b1116, 0x800d449f706a3115, 0x58f7c04ea6609093, 0x0ef9d473964a3736, 0x3e7c0494d076534c, 0xa630be239f058f0f, 0x1b6a31641863dff7, 0x782a93d1bfa1b2d7, 0x38adf2ec78aa7f09, 0x443a75a16bdf1301, 0x5130ce3a05715940
+, 0x5b01ea706061ff8e, 0x239d8aaf1b077734, 0x928472b48a81ef4b, 0x0a0f8054aaf534bf, 0x0ea6f2ff67d4fe96, 0x6c2788ab1d163a68, 0x08e238834758d91e, 0x7433133644e6cd14, 0xf6302a78b7d96766, 0x0bdc3e32aba7e8b3, 0x9fe1f2dbf9c4217d, 0x2c36c8b42d23a716
+, 0x86a66f6973cf43a9, 0x7abff5f8820e1329, 0xca7149906bfa13c9, 0x7525b61eb182cccf, 0xf50aa5d53acbae93, 0x129f8560c3f3bdf8, 0xe9a63a1014ee00bd, 0x2cabfca8dcac08e3, 0xd7fbe65e3078489a, 0x05f87d56a60b9af0, 0x29a5f73d4b8ec725, 0x27a646ebff56c082
+, 0x7aaf9515a358365a, 0x78b7aadcea95305e, 0xb18a825464d97e96, 0x1b1a4f2258876fb3, 0xab720fd5b9e904f2, 0x2bd04aefd0f74f23, 0x0f7e7233c27e2724, 0x15f8ee7d5f45f00c, 0xb797f2279c8d1fc4, 0x079cbc0d6e7cf8bb, 0x9d5aa2041ed73904, 0x317d569cafeb7312
+, 0x133c9e86b8c7a25f, 0x4453f4408780b3b9, 0xd9882715f818e0b3, 0x34124a93ee5926c1, 0x208854db8d6be137, 0x4606f28094feb004, 0xaf03c1ae4ae1b658, 0x2e24b94d5373bbdc, 0x98d94c657cc702a2, 0x598b559148f016af, 0x36037a1301523965, 0x1fdb9e298d8cdb35
+, 0x256be56e81d05ec1, 0x54d06fb3be487d51, 0xa72ffa263834a128, 0x0e61cfba83597649, 0x4502ded85b4f74e9, 0x5945d35bc28e5703, 0xa9f2f9931c642197, 0x2760444b8dd57c15, 0x80d412e1972d9b94, 0x61576359b3305b93, 0xfa8a76d340a6b3d2, 0x6ab21e426c528d55
+, 0xa051231a8f22e2ce, 0x68744510c5b5d045, 0x6854cb7edb4e0bab, 0x189cf3a6465eb86d, 0xfb8742ed44451e08, 0x66a78d6e21f584b9, 0xaacbf64ce2c40fa7, 0x531d6cd2f6d289c5, 0xd82e9e543a4a718e, 0x2069d4b127d999b3, 0xcfc7c1811ca0631b, 0x4433fb5cc48c3591
+, 0x0cda4e25c258f3be, 0x7358eb414c81987b, 0x7f00f71ee90de113, 0x43ccca03bf4c4c56, 0xc4cacca07021386d, 0x1c6ec366ae566f07, 0xb8270714de859cd4, 0x6a5c58a27ff0fbed, 0x1d15bd2bfbee65b2, 0x338642186722305a, 0x21e47f47b5c99837, 0x4b36d2189fde2a0d
+, 0xcfde320cc0b1ed78, 0x3a1b73ca35fd354a, 0x923c67a13506befe, 0x13974d0c24c54960, 0x0b892b78bddce0d4, 0x6bdd4796b346a899, 0xfd93e4566a4af956, 0x0a94c5865ed5e26d, 0x9d5450165c612199, 0x186efdd76bfea9d7, 0x30d9195b7d9b39f2, 0x3063577f21303dfb
+, 0xe92afa0d41811f4c, 0x3e344c0164aab26f, 0x6c67253df0422809, 0x572d592b0725429b, 0xc9dd6e201ecbe1b5, 0x63bd6b7ed3b7ace2, 0xe4f58a00f41d25ae, 0x060a006a529bd9e5, 0x73f96be4d51cb667, 0x665088e20697d76b, 0x7c647a2ab602352b, 0x35f44ecd1820ebd0
+, 0x398cacb60bb1afce, 0x7b3f019ddd8804e8, 0x14d67f940590d5e3, 0x0efbdc616f49dbbb, 0xf140de30ea83e33a, 0x76b2589005b26c98, 0x81ed92dc5218485a, 0x025a01050b58ad80, 0x0b45e6aade32e456, 0x567b02a37812c69a, 0x6eea0f66b0a7d1e3, 0x6aa4f0be1b9833e3
+, 0x70f0a161b471d664, 0x666c5e529829e81e, 0x6724cb4a54fd16e4, 0x5b56e76e19ea49b7, 0x27724f7343fc6b55, 0x0b91aeb020973341, 0xeaf466909650b5a2, 0x65ad85687b4322b8, 0x4855ff4775d4aed3, 0x6d5239e5ad46602c, 0x566001bc0f9f5298, 0x35728ed52e29eabe
+, 0xa00b9a43ad655d7f, 0x2910e3f7b823ac64, 0x3f3ede93cc24c933, 0x645aeb5a90c67ad8, 0x0e6a881dcd742680, 0x35e45e60959abe81, 0xe4dc10dc246de47a, 0x424586f82eb7b1ce, 0x4b07bb2f2c990838, 0x76a134675e5237ab, 0x97cd22c19947c0ac, 0x2c7a8f7980cf9c66
+, 0x0cabd44268d96e91, 0x0fda89597817e958, 0x0bc9f24498cf9799, 0x37d353ebea0bdb3f, 0xe2dc5c134ec250dc, 0x05d5b1b94951eacd, 0x3eea58c2d7a2ebab, 0x1557d6e78ce96c4b, 0x693810d4267aa966, 0x3a02a34716293b80, 0x7ba3f62482925021, 0x53d4f8bf3bed7fc1
+, 0xc7a84dd1595ea21a, 0x61f52037c7541bf8, 0x35ee2625089bb8d2, 0x27b63e174fc2d0f0, 0x0c59b1628d6539be, 0x7bb11d5dd5555ed5, 0x8a31386fe338a61b, 0x04b348948020bbc4, 0xbb5d3864d042e896, 0x5975d6e062004af3, 0xadfcb58b247a4cd4, 0x3049b5be08ef9036
+, 0x9f11ec11957968be, 0x0dab96ab4feb6f07, 0x7d7378199db65077, 0x0ef8a8dd36e2e24b, 0xc936fdfd713dff01, 0x3921cec9ba015c1a, 0xd73694828051a09b, 0x723c097644826345, 0xe4f864a89f67a9fc, 0x0b0b030ac296cc32, 0x964020b6ed9b6a82, 0x1dedeba5408fdd06
+, 0xad472cf2546b026e, 0x4a78ccb4555acbee, 0x596d4f14a2d620ca, 0x2d4d1a3e034f45a4, 0x6590c2746d1d4d05, 0x5a23b3ebfc4f01a1, 0x402be6763c754f7e, 0x41c4500e3741905f, 0xf6055507e91aca50, 0x4fcf069d07a9b8da, 0xa07329026359015d, 0x6df411224ab146f1
+, 0x7e115ef1976bcbbc, 0x540efb3766a99918, 0xd539c5744722c8cd, 0x4b041a103d8dc26d, 0x56b3c42fa2f01631, 0x70635406f0f5becf, 0x2b62d029c0651905, 0x799fa9d530fa5177, 0x18f5e9eb1a92fc9d, 0x41ddc83c35b33052, 0x45378fb199500e36, 0x12207c627709975a
+, 0x0c5eec1e731718cd, 0x70411c1f23380a5d, 0x255574d22e34a207, 0x51eaecc56c5dc854, 0xf271009a56f5198c, 0x28cedb168836822c, 0xf3749694946bf728, 0x79cdf1b2f448446b, 0x1ae9220b43920d55, 0x22b236d180ad91da, 0x1b66fccc5118fe8f, 0x3d489042b6a4c554
+, 0xdaa43aa0570fb0f6, 0x62aab17b14b6ecbe, 0x1811ac11b0ec3b41, 0x35150994ab50a05e, 0xbf549868ecd1dfcf, 0x53495198b790f863, 0x025d88c47b17d2ce, 0x53a25f3ba239c11d, 0x4e3c013f6df21e2b, 0x3e3a2bc945e7342b, 0x0dfc165a53c9fed1, 0x1ab54c50fe38fd5e
+, 0x203be0e0ec8a5dc6, 0x610b87b50b563bfb, 0x0667844a78db9763, 0x41efbc2cfca94cd7, 0x8db142c3824bf28f, 0x34684d37ff7fa493, 0x463ef0f7c0ff432a, 0x422bf0750ab8bfc4, 0xaf762e3cf7c47af6, 0x1a79e5e9ddad8cb1, 0x7b092caea71f002e, 0x319879a2ff969d58
+, 0xcacaf44aa9d3b94f, 0x56821fcc4beb1f63, 0x8517cb4d1e0a7ccf, 0x075f8112c48f1733, 0xed26262fe0759eec, 0x2067e6d6d17318ec, 0xebc3d04541c218d9, 0x4703f420a94e7870, 0x242089f19ca70d8a, 0x4597001cb6eb0a94, 0x0c7831a2065c154e, 0x71cbf8c26b98feac
+, 0x38579abdf39b180b, 0x5abf92d565aa920d, 0x80767387b1a74f4e, 0x1bf661cc12014518, 0x0043d8f30403f283, 0x4f837f2b9d512930, 0x7547722a23aa80d3, 0x52f77177335ba126, 0xa7d775a4411834b5, 0x503a6fca4a4b6eb5, 0xc5697b00d3da627e, 0x3d72ab96d16d3d4f
+, 0x3061214d29229966, 0x1c1ceca4b992c99e, 0xc68829335a0d0c07, 0x5b6b527b3d6b1ac1, 0xf8d85126bd206ae0, 0x4cd179a4bef8c436, 0x2a9df3dfe4cde1ec, 0x05f0a158c6dec41b, 0xee3cc2e739aad670, 0x052829ea4b1845fa, 0xeb4de5448b3566a4, 0x2e098cf23c40acff
+, 0xaedfec18b511fbb5, 0x2213c5a1db7c96ef, 0x65967b5910508310, 0x34f8964d8a914879, 0xedfd9ace7d53adda, 0x240a1936de691bbd, 0xaedfae8ae4d7ad76, 0x66409095b92c5ce0, 0x40a78b70fca9cf53, 0x49eafad4ee88fdf8, 0x72a6805c516869c8, 0x3c4f4e88509c30c6
+, 0x3ca00340300ba217, 0x457ea82c6f9b0f11, 0x28480b00b31d25a9, 0x3544aa03e55835c7, 0x3dd5b7769765656e, 0x28565d0b1c842531, 0xccb2546162cf16d5, 0x05baefdaba4b31d4, 0x2670cc349d639520, 0x4277dd5246ef7f74, 0xda5c07f06dbd01ab, 0x6feb9c6f936b0b15
+, 0x364b99a504fc7ecf, 0x43b951d08c4a8908, 0xcbde56b96cbf36b7, 0x042693410a28feb9, 0x0179971319ec576b, 0x5251f43b93d21cc2, 0xf25dfda6aeb4054a, 0x45b479af104f2cf1, 0x10e6679d146c3421, 0x5dc70a2962dd04eb, 0x067c4a62cfae5dd9, 0x08fdbf553cd57862
+, 0x53d5e9ce7f7d0fed, 0x3352d6d4c41a0c4a, 0x87fed664e1c4c5b9, 0x5262a1bb35495455, 0x8961787481fb1034, 0x6174cf420bec8a8b, 0x0855ee8ee1ad136c, 0x58bffb1b66e09a00, 0x27ee56711e0f1668, 0x4ede9038cda64bef, 0x1debc24003214878, 0x76d0e003907b70cd
+, 0x7922b3ede1e4171b, 0x67f56528bb311168, 0xa779d929db4217ef, 0x4533060b74827735, 0x791011758a83edfc, 0x5c4dd0109f87ab3d, 0x0978a199df11ae4c, 0x465a74210c36db9a, 0x60077d058a82fecc, 0x3dc9f579c4891afe, 0x1dab72b764acaa9b, 0x1f48122fbedbc373
+, 0xc65377b714913692, 0x343f5536748d6483, 0x25f526e7d0d6cb9c, 0x187300a33de66776, 0x2236833e41c8bf81, 0x1733910f688596d2, 0xd0e8bdacf5d66ae5, 0x1da6a780a021dbf1, 0x522e9c40bed1b6b3, 0x2056d562aea3dfef, 0xe29f1a93ad0ff427, 0x6d4de0b063b167cb
+, 0x1f57cf662d941675, 0x7d373f1122499717, 0xab9a0024744c3aac, 0x3f4b83eafc509e71, 0xef7dc88d92b30d41, 0x0c92176fa393776b, 0x622847d0c4f5855b, 0x605772876d8abd67, 0xf90ca092fd995d24, 0x6177d5c8bcb6b1ba, 0x6403e6d4f25141c5, 0x45343d2ed921627a
+, 0x5b9c2be6ea255d78, 0x5615d66ec300c204, 0xf3792df539e7808b, 0x224f8699006629b0, 0xef7900d8e87f5416, 0x290ec500f1fe814c, 0x9afef78b7e7199f5, 0x41ebe63c42fc6d61, 0x9cee848704cb9f76, 0x76122a58c03e6d41, 0x98d8b7de0492ad2f, 0x5618fdd06c1574b1
+, 0x2d50747f9dcebbcd, 0x397f6189678c7e5c, 0x22aba96f0981ac3b, 0x566d32851e3baef7, 0x33fed6aaf4b03b75, 0x5cf2ef89f24098e2, 0x2d9670fd28e76e45, 0x38a280ea5f55f936, 0x254bd98818bcd989, 0x53d709a2d0290bcf, 0x585688b761797d3f, 0x64c5d813cbdce6be
+, 0x4d3e81c6df165016, 0x335ace5ec246bb39, 0x219c5408456b9bf7, 0x669b2e1e82ede55f, 0x5e16fcf3462666ad, 0x3f8e131f28d998a9, 0x1b44f19025cbff22, 0x2aee9ac6a709fda7, 0xf5fc54f50705e684, 0x1b047c381420bb33, 0xfbc4635c73204f0e, 0x3539ba1189d3d567
+, 0xb4b2383037a56a70, 0x0fe629697b0ba90f, 0x7dcfd3a62e180920, 0x0d468217dbbe00a9, 0xb357995b1ea1b681, 0x3205db904b23861b, 0xa3c53106d478b69b, 0x6b94c23deaf3deaa, 0xde8a89a518c5b0d0, 0x0e1a18768d052073, 0x7c287c373a6456a5, 0x3d74ae4dbed211bd
+, 0xaa0e7113db0e2144, 0x0d4fe52d1af0609b, 0x35f0cc587edc3f1d, 0x02f67804684355b2, 0x56aac66e00721abc, 0x24ca58c56d18b9de, 0x9f75f641c0571698, 0x2ba78b485db09e1e, 0x21f91c455a72fbf3, 0x16f57298d719a5bb, 0xd459b1ce68ea9465, 0x45e9cc5de750eec6
+, 0x9f97a5f415ed16d0, 0x1a47a3c491ce7170, 0x2632f74357353d6b, 0x05712cc5cfff69ee, 0x0b9b92246f24dfbc, 0x0be0f6e68efa9e86, 0xc7e5107212e10a3d, 0x451fef0de6d77d23, 0xc6ca6d28d03a93c8, 0x13c707b2e52d583c, 0x7755b86b660c5afc, 0x66367b9708a8db76
+, 0x05e12d599f908039, 0x09c3417e4a0bb4d4, 0x21ee0c59f6d8a006, 0x2101d3cc7d01ad7a, 0x77678d43b6bc2abb, 0x1a26ff8cda2c569b, 0xa091a09cb6a8bc5d, 0x5aca8b297b741575, 0x493133f0d1ca8a9e, 0x58dc40c6db9c19a7, 0x7f79e2f1a97b7a7b, 0x0ac03fb2a0065b15
+, 0x26c2dae09ddd3070, 0x4155c2ff0e859a94, 0xc7b39a34cf402467, 0x3cd3ee98526d8c03, 0x8e488d78fc18df91, 0x25f07b535519a9c9, 0xb9b2e9a6d718a0d5, 0x47beec321e19bc20, 0x2332f0ea3691d379, 0x48ad19ec343bda00, 0x14479c8d60f40d8d, 0x7534b39c960c9832
+, 0xcda7c54a5d6c4e2f, 0x156769409d304a3d, 0xc712c886111e8a9f, 0x4f1557356f3a2012, 0xb885ecc0319cc4cc, 0x59552db582ad4367, 0xafe9b6749bd2c4ba, 0x2666a439ecbc896f, 0x498e121e0b31778b, 0x107884acc03c2f13, 0x98682c8efeb5a17f, 0x4e431008187d2da7
+, 0x31207f463fd64382, 0x5303e910d9a3e72a, 0x0859c15158451389, 0x563c14b5a6295033, 0x5bd3637fd91bc7f4, 0x47ef1a4d9e81243a, 0x4500867935c4d6b3, 0x27cc27ce296d1820, 0x206e32d154a0c882, 0x2b5db30584f8879b, 0x2681d2192735c402, 0x5486a1ccca8b60b2
+, 0xcb8143f681dfd0b2, 0x7558179d5d2cdc84, 0xf661db713f651ed1, 0x4fd79d1a77ec82e1, 0x426d7b86e520c012, 0x63d8e60f387c7220, 0x5622c620934a34df, 0x2d71e86b5ba67926, 0xd1787504505f0350, 0x55f4a9e132c3bab8, 0x6eabaccaf1a3f886, 0x60689a1035c62acb
+, 0xf2f8a132c1a02260, 0x3ac64ab51cda1b67, 0xf3184496d0c14da2, 0x471d9048931c5637, 0x4f4aef6eb1a7bd45, 0x49e3f6c83153a010, 0x421dce8d94f5dafd, 0x01544f204376bc26, 0x73a30c27476f36b2, 0x3892ead830d29e26, 0x9badb8b723a50363, 0x2b4fec77264c194c
+, 0x9ed8e7cece8c3cae, 0x26219880be59d6b4, 0x560a2b976b535493, 0x0618380fb57d10d3, 0x72faf5520b235d39, 0x66a5cdb30cd08bb8, 0x614c25d9632af0b0, 0x6533d5dc1b901df7, 0xcbd45d4cc474e992, 0x6c60230c95c5599e, 0xd2b3a6cc5ec41561, 0x11b99d434fc639c5
+, 0xd384307b45bb6776, 0x2decca3e302fbeb5, 0x0aa3c03a6c1b1740, 0x673008f607be66de, 0x3d11454cc619f3bd, 0x65cb14e249a93e4b, 0x22c1f23a6dc5072b, 0x614706d08b149276, 0x07df0aefff163a37, 0x509316066b5c83b9, 0xcb2065f82fdbb166, 0x640e34258e59628c
+, 0x568d1809c65c4762, 0x7b9b10d63a86e245, 0x9ac8ff9792563d04, 0x0bf2af28e4c18ab0, 0x85c9268dc3ed6c21, 0x25fac8c11e81d8c9, 0x7bf47aea9ccec203, 0x2706dfa90ca6eb49, 0x63df464f907de8ee, 0x572053dda77968bc, 0x2c0a613d40cd1928, 0x293cf622ced7fe38
+, 0x57baa8b33a3245d5, 0x73e223c17a7e1aeb, 0xb2541558d6c1c965, 0x6a72ec8ce9319e02, 0x596b7bdabc9d4739, 0x1dfe0db43f9f5a6b, 0x7445ce0c4c69c448, 0x0b2e7f916c0f7c1c, 0x99aff7f0c7d36c31, 0x11660799579f393a, 0x029201aed48b1c63, 0x6869f18fd99fdcfa
+, 0x0e020972e6773460, 0x598d47462ec85c27, 0x8a760cdf4edf68b9, 0x36611ed35ffb41d0, 0x6624b1c22b82965d, 0x59cbd04c16c0db24, 0x02c37cfdcb11e902, 0x035853f5a467e836, 0x39ef2f787d065225, 0x1644dc3acebac3c5, 0xe59f007105ce05f1, 0x7a14f99167b7dbba
+, 0x863dd6fdaae365df, 0x2d4752f6a6c06e6e, 0x02343b25eff205ce, 0x4b271b02d95b99ee, 0x2b483ed5f1c80103, 0x18fb59e1d4eb13c7, 0x6343d7da117ba7d6, 0x1ff528355c6eed53, 0x5233aa1da6ae12b8, 0x325b976f069a19d3, 0xe56fb99000044cdc, 0x2e5b1b9f1a805021
+, 0x67c3e7e2c938fda2, 0x275b7845c57b6acd, 0x2c9fbabc75f1014d, 0x75c56542393d9f4d, 0x1f7d05b670f2b6d8, 0x232d97a6f8fa7152, 0x3deab0ba5b66267d, 0x4251a6ae0ff0409e, 0x089754d842b2348f, 0x17cbd45477679e5c, 0xef08b80f1441175e, 0x049cc82400259746
+, 0xc5dbc0deb544fc7b, 0x1fb34555b981ee2c, 0xb0199e8e12217f70, 0x37890f353988c9fe, 0x94de4d155a8df100, 0x1a6193ad95bc4061, 0x1bf60ac2d14d6d99, 0x66c02cf3b554a32e, 0x7a8ef6084d5cf35c, 0x3985679aac2ba069, 0xd60b36758c4635c0, 0x3df677ed93f50ce9
+, 0x611f85efd842c8b2, 0x008559908cf4c892, 0xf4a43c7fea24b195, 0x2ac79d0da5d685b6, 0x39a2e39b4869f6f3, 0x02874299676992f2, 0x8dfada9c3eb8b1ff, 0x4c17521e5383c388, 0x850ac35b1051c266, 0x4ad9e2747f6ded5f, 0xf9a7a7c193c3e2be, 0x3ab7b37c0f2e1c05
+, 0x572977d9822381e7, 0x550cc62ed46a84d6, 0x232af8a27da9a50f, 0x5b2652290b3ba07a, 0xfbbc6a50881d2c8b, 0x7dedb28cc782fe8e, 0xe9ad42385cd21cd1, 0x6696974091ba495d, 0xbb1f806e2b5f91df, 0x37b50486f8a600f8, 0xacbce191d757c1ed, 0x210070560186309f
+, 0x357e2f0d4a3b5434, 0x22cc9b089ad970e3, 0x5c08b9e52775da53, 0x1a05a998b127add1, 0x631951bfbc12c77f, 0x57f0b36830eff8b3, 0xf4a964759b24fe40, 0x7f8556dbce4892f9, 0xf0e2a181d27b7459, 0x132d4de07c68ab47, 0x522f04d3dc99c60e, 0x47a95ad837f3068a
+, 0xc0e784d87324f859, 0x7b35d588dd54111c, 0x08a871a4464fb9fd, 0x4f6603bb9e8ffbe2, 0xc3ca74bb0792147b, 0x7843ca716cc20360, 0xb130ecf2b9cf4a3e, 0x7a76f092471e9049, 0xef6d2049f6574dd7, 0x15db94f615353abb, 0xa78059fb4fdbad01, 0x25b85629ae159eb5
+, 0xa29da3ade53ceef9, 0x15b4aafb10733370, 0x094b3d27d48ac855, 0x17fed84b69b9f106, 0x1b790a96531cec49, 0x10d1add0d49cb414, 0xd4b1c302ba98b63d, 0x57be1d82864dd44a, 0xdeaa542218ac96d2, 0x1a787f92eba9d056, 0xee22e2ed7f6dd83a, 0x6fe41ce750f66e28
+, 0x74990501eb30cddc, 0x7da90f0c8144a1cc, 0x46d23e7743de5ecf, 0x3b3a7864c9930a1c, 0x7627ec0b8262ed6d, 0x345b9421d6d9b47a, 0x2bb701b47c650790, 0x33df651a5bb3a552, 0x427ff879a43d546c, 0x53b498253157aa52, 0x969396e320c5aa18, 0x1bd901db73f30da7
+, 0xb11ae6f8a81fef54, 0x5b01e6444a765409, 0x40805f0fedf3404f, 0x6dcc68084a3dab26, 0xce54e9e7007bf5e8, 0x374d3fcb00b6a66d, 0x6df1fe37bc8cd43b, 0x15a26d9897970ce0, 0xbb83277ff8acc06f, 0x60c3c9a7394a3ea9, 0x1b75bebe6176b532, 0x637e689c71be522f
+, 0x0fdc286637f7bb98, 0x24a1d075231ebd34, 0xe8453b160b9e28ee, 0x725c6e124f33cf6e, 0x516a3855c02c8ebb, 0x309a157774932ed2, 0xcbf00f81c651d757, 0x026b2e2ad79435ce, 0xe5d444cac585d513, 0x450ff489a40dd5a5, 0x92295a92ccff4ea1, 0x285f5e22fbcae850
+, 0x8624d85b7b5c8ddf, 0x682ef609fdfcafb3, 0x188c20e798f99062, 0x0345465c43ca3c25, 0x7cc3cfef5936bbe3, 0x0f49fe6ac8a1afa1, 0x9a2f9b431dbba85b, 0x34aa0607a09b380a, 0x88f85cbae8162735, 0x044417a26bf93a09, 0x7086e5320f3d2f74, 0x53bf257e853ed2f4
+, 0xfbf8e8c816287763, 0x71ba5f6257985a30, 0x14c9aaf46a24ed91, 0x435fccffc2f74826, 0x7aea2d5abd496dc4, 0x6cae216e336b49b5, 0x54ed3a60b54235e5, 0x65cce71f40276ace, 0x6b62620f2ca9a81a, 0x2d7e607a78389fd8, 0x1f9ccf8f3e29fb5f, 0x2efaddad0ab24026
+, 0x77a0d373d6602dcc, 0x45726b90704d29d1, 0x51e8aca1d132d088, 0x6f8c404e4a7c487b, 0xf701d8dca338a4f7, 0x0aa9f6a01a1a6fea, 0x5f7c46583b608fd0, 0x0270b8b1028d5e8a, 0x8d6de93520377468, 0x20097ce0b3c5e442, 0x467910697eea2b97, 0x4f8b7f4429957e53
+, 0x76de302999558eb7, 0x7fe1a611847a488e, 0x1f3905a19a4da544, 0x39d84e6dccb3a728, 0xd81848d8a7e365a7, 0x3d7d2572cfe3e42f, 0x76a35a703eb9563a, 0x0a6ce48c14435549, 0x5aba97c96945ab6c, 0x68152c02c6cb4422, 0x75065ac161ce0071, 0x6ebbac42797dca25
+, 0x5a8bb65fd775e802, 0x762c59c291231893, 0x3edfa8e192a27e1d, 0x3d146ca64419343a, 0xf965f08f9494e71d, 0x1b1c3c584699e860, 0xd1a65faa43a29b6e, 0x232d62e60f637af9, 0x5127f7024068ec2c, 0x1cbed6e77fee21ab, 0x0d56a9bc377ff1a4, 0x11cc4bd226eaf34b
+, 0x287c7f4c7c7f8e57, 0x6939137aa7a96685, 0x4199649ca5059e2b, 0x706edfc2099be44b, 0xf64bc0f9fdb73a90, 0x02f8c49ca03edf8d, 0xf4d261287b6b55f3, 0x5b5bb997ffdb0d46, 0x3838bbf7db1cd4f3, 0x4ad994de95eb0d37, 0xba0a420ccf41af04, 0x55182dbd9439423a
+, 0x1fcef15add64e81e, 0x582d063c952e4aed, 0x604fe88d65f0c75f, 0x5a1daa4b92e83f37, 0xa71a63d0c733b46e, 0x42854e6d129b8d0a, 0xc2259e63a6511dad, 0x21aa6e81493687ad, 0x54b817d6329b8c1e, 0x5f0dfda29901a198, 0xe944dff179b7e3d1, 0x75c3b7c39933b420
+, 0xdf10925a341e8c5f, 0x578394640432e36d, 0xc0f98e21d2ce7ced, 0x19c11de2749786d2, 0x26abc4f02f148fe8, 0x46d51d013aff03da, 0xae81baffcb994969, 0x2d16f20e858968c7, 0x2d442cc3417a9c0d, 0x3d5c6d3d421634de, 0xcfc87567aa8e1619, 0x2c55c2ac4e480dad
+, 0x5ec1aa3655bd3afa, 0x38b6b62f053655c7, 0x49d3dbee08058d88, 0x060d9d40cde43886, 0xf38fbf505a81307d, 0x0a50a8224ff3c9ee, 0xc32429585a1df8b0, 0x2a3cb5dd280bcf66, 0xb46ce389180ce841, 0x0af285517ea2b0c9, 0x6e2c465a0f89764a, 0x2545835de3cacd2c
+, 0x8af174dd20b568f7, 0x03291653636efcd4, 0x487818660d2ffa71, 0x544f1401c6e9947e, 0x68a2e6961c1f6959, 0x238fe99cdc162a23, 0xaa16e49e212072fe, 0x2ccedced658059a9, 0x5717c997f38787a5, 0x6fb665cffc3af534, 0xa744ae369b2eed38, 0x4940de35dbd633c3
+, 0x2c31a4e1e405bb01, 0x58ab91c556f97b2f, 0x968d3b2d560cbef6, 0x2152f8257fee53e1, 0x1579a4b4a26f3ee0, 0x45b78ce5d68597a5, 0x453c21634d93f560, 0x3d5d04fbe09ee299, 0xe6ab8c2b11f6d7f2, 0x2435dc62ac045b15, 0x96cb8c33fd097c86, 0x6a2cf8feba00601a
+, 0x32e927ffb42fe25d, 0x57af97f0845672ac, 0x2f29aa9f10293c90, 0x34958949ae652b68, 0x3853a33fa1b7291a, 0x151a0ef95df72c91, 0x4c75e474e23b5413, 0x1868808d5ad9d8fd, 0xb4488e9e0cf2160c, 0x52dcf05893759553, 0x03da802e83827ea3, 0x46df7165411aa748
+, 0x73af728324f04d2e, 0x08a149f4c5b2ec61, 0x2aebfa06acbf90ea, 0x5cdc01c7944986b2, 0x61df09b3eef1d0f8, 0x0f94bbf0617cb26d, 0x7baf10dd9cbcafc4, 0x0e0bfabe799d4c82, 0x5cd60f48adc83702, 0x62cb85081833211a, 0xe10750bab12003de, 0x3103bbeaeaa98234
+, 0x6a9b044b72f94b39, 0x28c9ca1657087050, 0x5258db380d0c21fc, 0x1d65d89480707c47, 0x36838af3cfba4ecf, 0x7b9ff286dabc92ab, 0xe8dde06df333a87d, 0x12260071ccf4860d, 0x86b1c3b30a172fba, 0x14701613fc24261a, 0x50478fec5fa48c91, 0x10e9d919d7c5002c
+, 0x76019cbf837f083e, 0x2b3d2c33e9ef0d7b, 0x0e8aa15d48587a7c, 0x0322b83114599846, 0x56d77e0aa61d8787, 0x1a85520abe8b9588, 0x9b9e2d912c09ffb1, 0x5687d7daaf941e99, 0xbdce7b9599a916d9, 0x6179d9e1639e2e0a, 0xa4bb69fabb3b3210, 0x036de99f1e48dccd
+, 0xec62eda412f5a184, 0x793744b57f85d11c, 0xc2ac26b3eb196fb6, 0x49aa04245783ff92, 0x04ff9430d3725688, 0x149d19af9c65f2df, 0xe768dd83e7bf4299, 0x48db646baaafcc33, 0x237e726f3b0f228c, 0x634d9c3e0e8e307a, 0xc1f2b64a75d8e4c0, 0x46d45f0f056cf55c
+, 0xff595930c21728ba, 0x612fe221fcecb2d2, 0x06f6a918ab34261d, 0x27aef1fd18d39951, 0x49d716adc0bc3772, 0x682705278090c8a9, 0x10869d629a364129, 0x6e23cb5e2b9c49fe, 0x70db8d074d2c4cdd, 0x21504b296edd7cb0, 0xd260b9fd17e657b5, 0x2d4fe2962b3e1df3
+, 0x6546ae24d2a9753b, 0x23bcf1ba138a8a0f, 0xc9d06581ffbf8661, 0x4b39a24067ba2ab4, 0xc37710db59595bc2, 0x2da3489581fb9489, 0x1d46d866a7554442, 0x0c93ed276333e6e8, 0x73f3f3c9077b5f8a, 0x3d560c78e210f300, 0x9cc48fde9bf06934, 0x78c975fea30d702d
+, 0x60c5c883bf1bb83b, 0x6c03df24a3cea045, 0x377070e587c67d73, 0x69a18e5334dbd074, 0xb8fbe25cf7aecd59, 0x2364b9608402d9db, 0x1dd2201b78cf71d6, 0x33d689434d3f6172, 0x1597f018f6a201f7, 0x72ca20321d06ad9c, 0x50a6edc426c509a6, 0x60c8d7a447916020
+, 0xf60166bff2cfa7cd, 0x2af04558bd36e907, 0x3fcf0fe8a4f9fdf8, 0x678129e0e4cf6c6a, 0x18b40fd27e639871, 0x7458d168303edfb7, 0x4a577dd13177f39a, 0x0e6d19b901621ca9, 0x9c210c710f1cef00, 0x5875581f971e627b, 0x1c854bf644adc9e8, 0x641e4e626de067ec
+, 0xb00bed89592c8656, 0x1a418c99e87bd6c6, 0x3670ae7f20bbdd5f, 0x608632fb5cf503c4, 0x6f8e6e6460e71bfd, 0x34f2c8e7dc3f949c, 0xc162f34f1446c9fc, 0x17e0621bdf16ea70, 0x9bdad6ee9340489d, 0x0ae914d9b0b3064d, 0x19191765229723df, 0x58d016aa8d39a496
+, 0xe5a82494dbd96765, 0x4341bffdd59959cf, 0x25fc751205e41bc6, 0x3e5af69b86ece4e8, 0x77e35a6e8db3ede8, 0x692e049cef91caf8, 0xac3329e23bd4ff3a, 0x4d2f72a9216d74d3, 0x24259e00b7d76b6b, 0x36064764f6ad8725, 0x86ffdc2d93ca0608, 0x08c1e374699d6bfa
+, 0x7c9b27daa7d6b436, 0x37c0e93e1507708d, 0x91ba7922cd62dbf7, 0x5bb13319067ae6e4, 0x596e313d22c29b58, 0x4f3ec03981db61e4, 0x5631a5fd547fe8fc, 0x1910b08e034f2533, 0xf79002fa576f9345, 0x24794b27a695b95e, 0x6638f802db0c9516, 0x472ae53cfdf8eedc
+, 0x30b3ffc4b7522e11, 0x6faa47dde897054a, 0xb07d95925724b2a2, 0x0090ae250bdd8a4e, 0x350da60f0aa1f103, 0x20d7f0a6d0104a95, 0x006ba590052c21f8, 0x5ca4c1e5b07dc3af, 0x5d8cc64a2aa0ebdd, 0x6e9e4cc637305f76, 0xaa6e784ac22fe27a, 0x0099c7d67d5328b3
+, 0xeb282e2502c149ee, 0x7096f1c13eba1369, 0x0eb04458b2a3b616, 0x5d4d595ee408561d, 0xbe5bd5e0d2124b6a, 0x61a9f388f9698b06, 0xadbf31a7e6785b10, 0x42da4425ecfb9a34, 0xe8e07c2347fccba4, 0x432d8c4ae1887d0c, 0x4f19df31dae6df6e, 0x49a843c8a76f89df
+, 0x0a7c88f089030dcf, 0x47d835c6f2200e40, 0x13ec2d19d3e26e8f, 0x234de0dd8969953a, 0x37721de7db258b8b, 0x73f3b79b060b3f0f, 0x139f017754c554d7, 0x7aab4015caefac05, 0x84bdf74c368501d6, 0x165379cba586ea67, 0x86b21fb2825c4f5a, 0x3e294231e2c39a7d
+, 0x773391861c8d87b9, 0x3bcd3c72a36adb80, 0xd11638575396ae2a, 0x42744f50158435b7, 0x02e6c0bf36eb9f37, 0x515e021fdc41fd6a, 0x673ae2a157c94b0c, 0x7e7dae790d92356f, 0x52dcf02f540f1bc8, 0x14b2f406827b1793, 0x149b9d6a8ed2cacd, 0x74d5d1447cef3306
+, 0x2df8fa9b5884f106, 0x257b3485f796149d, 0x7d1d583dd8584e95, 0x735a8b2adb61f8d0, 0x2c3b1e4b9b895a02, 0x7f0c18279712f570, 0x35eb8de200c716a0, 0x30ee0af2f1e5e9ff, 0x70f3b8e580e426e2, 0x35df471b1beb958f, 0xdf9ab17aeb39bba1, 0x2ac25e01682ab4a2
+, 0xd2c3138a8a8403cf, 0x421a55800941b214, 0xb5e0f69ba76f4bb5, 0x3b7399c6209efcb0, 0xb1b8705b37fd7af3, 0x7f36ac13e1a14f96, 0x84d51a7bde442a9a, 0x4ee1465581b4fa42, 0xcb00e5e2160b35a4, 0x441e406e9114872f, 0xbe98b34e7f718f8f, 0x5cd946d9219f652d
+, 0xa70799254db5a76a, 0x68d5e2a216c27d94, 0xf3eb700a940e79bc, 0x0a72486e3248772a, 0xff761cad051a8781, 0x7fc2d0968a45a25a, 0x487127e9f5119c8a, 0x06b3cc06228e03a9, 0xa6734c2175073e85, 0x429a7010f0ed1e5a, 0x61d8a09838249c18, 0x2f2c7f8f7b3d4e90
+, 0x8b3a44c8414a0c7a, 0x791c611863512944, 0x2a4149557ac11eb8, 0x7431666d4c452e78, 0x408dab37782c22a2, 0x4f2fc31101147981, 0xde42c516a449443b, 0x056088dc1068d546, 0x65386b2678c23416, 0x706aa8db448d758d, 0xc2b31b7d2ee05647, 0x2da8ae98f670f033
+, 0x1f8824ba7558db19, 0x342213bb2cb54915, 0xb5c88852c01cf702, 0x72c1fc4e26d63b61, 0x59ad556011e11ab5, 0x66b7707efb55d806, 0x034ae3210f7243fc, 0x3a4dfaaeb422d084, 0x5990a3b817bd2195, 0x5eef070d09b6fe70, 0x133ca897627b488c, 0x287684b38ad37164
+, 0xad4ea61e5e82b07e, 0x5b77f8da61f392ae, 0xfb68f95aeeccd847, 0x7500b46b30f84c7d, 0x129e1d5ed31764e5, 0x2a0d789df3452d0e, 0x5ec08b1810914ec9, 0x5e10b0bb59f6190c, 0x8981f51e119914ea, 0x7a17c5b20af6d69b, 0xf68555dc590ab193, 0x620f084d599a60c2
+, 0x0256e4da06c6460a, 0x6470fb0dccd5f1ab, 0x78164fafaddf1413, 0x41a7924391ec8a0a, 0xa3bf9ac7529b8a48, 0x1e2559b6c8dda64d, 0xa5e67a4abd75e39c, 0x380ee1aa7c30363a, 0x5cf5dd2a94f7ad9c, 0x79289a11ecea4b82, 0xffa732f58891da62, 0x1ecaef772b9d7e7e
+, 0x89109a9e14abbf04, 0x76e0e82831901b8f, 0x1efda5e6bc1f7a4c, 0x272a163573c2a003, 0x3beeee03f5048d2c, 0x25e2a51e2779f272, 0x11b918dc6e0fc229, 0x5fd096ad2ea09832, 0xe8cb4763e82fb607, 0x328c22e3f71e8381, 0xc89a141e841506fa, 0x3f49580c6158e663
+, 0xd837b96ecc1e72d6, 0x194246c2ea80b690, 0x3c307be672f0482a, 0x3df31bc0292ff58f, 0x369a080291999253, 0x4d45716d2b17e8f3, 0xbdcccbdfa5be9bfa, 0x68d338b21be514aa, 0x8f41fe4af4b9df45, 0x127425d558abcf0a, 0x19e2ed4f114f2b50, 0x39dda0c89d9d0803
+, 0xd309f7c9129f58c6, 0x2c62f21d492ac81e, 0xd8828e6e014f26a5, 0x40bcd7aae5757f27, 0xd0bd7fe8874292b2, 0x4ca69ee323073daa, 0xdb6244d9c571bae6, 0x6a9a08ca6e28030f, 0x19da55d611d2d450, 0x13d74fd7f3b3b7b2, 0x1868346eccc614a3, 0x432c83228a78ee3a
+, 0x799155089e900882, 0x447b4ec954140c8c, 0x43cb0129f2f538e2, 0x54936e8bbcbaf0d0, 0x5d69502dcfe05e96, 0x3476d5b0313fea06, 0x8d93c14a9d7d9eb4, 0x7f9ce03a97bc7ba6, 0xfe5b6fcaf9f06442, 0x37e0d99d59da9e2a, 0x186118c7b0ad3063, 0x32a7de04c118b076
+, 0xe3232f24670ce5c1, 0x2feae715ab3f2eb2, 0xd8dfe67a010ecaec, 0x2e9f1c26a1566627, 0x64df970f7c551d17, 0x359eb3278e68a99f, 0xdc33c1a15b738a4f, 0x687d2ec0909d0045, 0xfa7a80fe67b3dc86, 0x7a9c422f091e25be, 0x5dd5e44331d4beef, 0x59e77ffd7502e299
+, 0x9d422e9a850d25c7, 0x66bc6ccd16c47bd6, 0xe3ee3e8a2782c65a, 0x5571b1ef1a121684, 0xa8d5c06b8a01e95e, 0x096dcae54bd45dbc, 0x4177dca3357e943b, 0x43e3a75ffdb67b5c, 0xd451301e6fc7f783, 0x5758492d04298cf2, 0x61dd7e4891fcd5f7, 0x6a67a47c17e90939
+, 0x6a68c9108830bdfa, 0x7cef0f88559771c4, 0x1a8c2e6dab9d871c, 0x65d64745381e239e, 0x35ea9471cad1e3a5, 0x4906f56469910ef1, 0xca937ecb3d425b8c, 0x562357c74e123f70, 0x005a5abb331412e6, 0x1a655138a2b7cb61, 0xe9c84df1edc66b78, 0x701a66590e9ebd6a
+, 0x635ceb64e20486eb, 0x3de7ba3a3e52022f, 0x2ba331aff07b6069, 0x02207357e1fd67bb, 0x731501c174b10c72, 0x3a6a6468e7ddc0ef, 0xbcb7de392baa1e89, 0x2d04f5b1f9e4dc2c, 0x7cb21d913cc8be37, 0x5d1206cf27f78307, 0xc700bc056c2164f0, 0x3e8fb3ce084c3147
+, 0x23c882647c601489, 0x2aa1b2b285710c8d, 0x59748df948089fc6, 0x62adc5ca205ab98f, 0x20ca54a9a2d57ea9, 0x325c3ffbf1bf59c4, 0x338cd1e521a5c8cf, 0x47f0629d122d685b, 0xb7f08e7607884c61, 0x57d790eadf2c87aa, 0x6c64a4e2d8fe00c0, 0x42d4732e2659d786
+, 0xb19a1d737eaf02dd, 0x59cfdd1d2aaf73da, 0xca77027c12faa002, 0x25634025936fc9eb, 0xac472f74ad27affd, 0x5df7b1db30f0805d, 0xfb5725bed4678375, 0x1f91023b45213d95, 0x41ea8092924d276b, 0x7eec976c42653973, 0x9e571083a6a5d341, 0x48d0fde4b26a8aa4
+, 0x9f540de2a63ed919, 0x0f2d67217e80d63f, 0x2db3dc9e5e100829, 0x1ffde92c5589e88f, 0xb67ce5db1cdfc19a, 0x142980f861828f22, 0x19cd1928a0dd6625, 0x1838fe2d7f42e4b7, 0x48d599fd53db5016, 0x577f662eb25995db, 0xe7059dafcdba59ed, 0x2928167c1a55cc0e
+, 0x85152f68e4c38e67, 0x29e85d3fa3b83067, 0xcd69d4aed7dc574f, 0x21ed1285f43f1186, 0x514d731baa8424cb, 0x162406d5262b9ad9, 0x71262d5938c87cf8, 0x429fed44c89954b9, 0x778358462a9b835f, 0x6162c4cb02f9bdf6, 0x01cbe3e72fd4670d, 0x22ee7e233db4625b
+, 0xa75dec8af9dae5b6, 0x266e667320bc2fd7, 0x128f67f27ae83252, 0x3922e22e0b8096f9, 0x4ba4543d3e243459, 0x6ffd900cf2039597, 0x8abac6fc19fb3247, 0x7e9f0ba109572d44, 0x675c3f5a0f727e69, 0x0d1b258b3930a96b, 0xc1e7aaadd381861c, 0x02c605a791156748
+, 0x88dbfa55859caf23, 0x5aab3791abfcbe57, 0x7a1967da88d9cdd0, 0x1de85e37cdaae0b6, 0xe6428c7ea9de68ad, 0x12a32fec68675333, 0xdf9645f19d0841f9, 0x1e2dabc4c469c620, 0x2a4d2865d7028035, 0x4d9a87f08c1444a7, 0xcb31eb3a9d38fa87, 0x4a58e87b785ba5b7
+, 0xff3a0a736ff97916, 0x264a8565a1b14de9, 0xc1d78953199475bc, 0x5fec699f570c16a7, 0x6999a4c469c6e518, 0x010340b6c6cecee9, 0x060f5307f9bafdb5, 0x4ddc858456353e3d, 0x0b3aec1876caf7b2, 0x056418cb9de83c71, 0x18a4c3d4c38c5755, 0x25e42135978f24a6
+, 0xe42fa7dee42dd9cc, 0x23815fa41101d6e3, 0xd673ad00c688b2b8, 0x4306d681914745e1, 0xbe1538353370871b, 0x06723d7b86d92591, 0x138906765ddb6be7, 0x35fe04d9bb929cd1, 0x48fe535cb3d0a704, 0x60acaaa8258b0932, 0x200f6d871d734f54, 0x0b94497700033e64
+, 0xa38cbac8aa41f55b, 0x6806fd4ee3f35ef1, 0x29a2acdc71af503a, 0x08198b6114240152, 0x8feaf82f9e68fdca, 0x1876d580ce2e9f39, 0xe82326a551b18f9e, 0x6cc097cba43cb7fc, 0x78315db1eb1b5059, 0x35e66dc2d630afea, 0x213fbac44afefbd1, 0x34e58091ed6cb4b5
+, 0xf2197a93811c3edd, 0x148850993a90940d, 0xc70a88894f41882e, 0x76efc03afb3846e2, 0x55f107ab0de7ad88, 0x4cd881a9f1bc130f, 0xfdb753989d8f73ad, 0x07aff2461733d28b, 0x4f53c3e01c234156, 0x69e1200190bf720f, 0xcab5b31d64309e19, 0x75a076d044043ae8
+, 0x79ce78982d52918c, 0x3db503fb27b60a83, 0xcd13f5fb8171a728, 0x66ffb713986c3b11, 0x74b00314a78ffca0, 0x126f2a91af063517, 0x1be992631a9381f1, 0x4c0e802aaf428eb5, 0xc968430db0ddbf3a, 0x2e33627baf878359, 0x259d64b289ad3092, 0x1bc021203721b56b
+, 0xc0b7e9d141570283, 0x66d01c31b699a99c, 0x6eddb89c0c1bddd2, 0x38a8127fbbe60695, 0x08d8e041a04a514e, 0x190cb332f1f6266e, 0x3d07567c21205c8f, 0x1c1b57674e60545e, 0xc73d43831e63c5a6, 0x4109b71aa85c71f8, 0xce9146c85e2b3e2f, 0x5511712ecdae62f0
+, 0x38587f04e3509eb4, 0x12799dece8e9b34c, 0xefc017fcbe32a173, 0x6db35bb322caceea, 0xbe0fee02ac4f16f2, 0x33b540f8ca6cc815, 0xcb276ceadf097d6f, 0x68891ba52078c988, 0x3f26b59d0335cfa2, 0x4f193eb8586debb9, 0x48ee9996182db375, 0x3bac82b19e567fda
+, 0xef7891db22b881f7, 0x012e8018bbb775a0, 0x76d05e4fdcd17d33, 0x7eaa1699d63820af, 0x4f6f01991cef5a78, 0x5e05fe97d739e0c2, 0x412dc752fcd7672a, 0x43e818d826c744ca, 0xbe87748e2334e6ef, 0x553dda36ce5a0ae5, 0x7a256263e2a3767d, 0x03dad390b0af74a0
+, 0x985f365742c88095, 0x2a37e187c617c83d, 0xebbadb3e951215be, 0x0b44d9467b2b02ca, 0x86c2d52d301187b2, 0x4d9244e85f07e283, 0xd0698c94763fa846, 0x5bdca5eb58b419d0, 0x85b66087e548c484, 0x4143c4ce08ba7331, 0x2d892b2b0553295f, 0x3cb34f2032d29459
+, 0x7faf3eebbb9054de, 0x494132ffc2d2d419, 0x8d486f2e8a105b26, 0x3a723e51b4892f5d, 0x0acb6e87be4c5549, 0x669cd2ab3e7b7352, 0xc70451ee3914e04d, 0x6bda783c0ec073cd, 0x9d5aa3a02ed67835, 0x650feb912f2d2310, 0x7f6bce7202881180, 0x065d17662f263612
+, 0xb5734255e3b62113, 0x3a20961711851792, 0x752f52900101ec27, 0x5bc21054b18a8e45, 0x0da96ad77571b5a9, 0x41fe399e8f04326f, 0xe1012f5537c2b1a7, 0x0630a0c5491bc03a, 0xaf0030069510e112, 0x1fdc01bcaba7b65e, 0x1e836dcd9ed2c852, 0x2cb17e5740d86fc4
+, 0x39ccf3980eb502f9, 0x41324e9f2eddb5a3, 0x38bcdb13336618d4, 0x02ff0ed67c6a6928, 0xbbfa3bf666e3bd15, 0x4a2bf327fa4a819b, 0xb0db34ef0fa9c748, 0x009498c63481ffb8, 0xd889e4f9855dd0ad, 0x02d29f53f45ca64f, 0xdd5b4f39139d303e, 0x3ded0690648285b6
+, 0xddbf6dc9601de142, 0x4743de57f1a9f463, 0x2fc9eaf7185123f9, 0x62627e35b481ce4f, 0x03e9bdc4ccc3f5ce, 0x76bfb16eb48b49ef, 0xd7ae31fe2fa671ee, 0x430d925d9b2877ad, 0x7cd6655912abd198, 0x05a9a0e717013210, 0x8f71b12bf89a6f28, 0x1533eeef5eeb9df3
+, 0x4559f52fa233f31a, 0x63bed9640c266d93, 0xd70bd81f36dce108, 0x4a5ebacfe9ee4492, 0x5e2790f41edb7e8f, 0x3d27c7bd5eb267d8, 0xa0f3a3c65de0f68e, 0x19198eb15a0932bb, 0x434333793ff1e7ce, 0x4fccd8bd91f1f520, 0x8b637123806e0ec8, 0x318d92fddfdda100
+, 0x6cde978fc218e9d9, 0x132245ec5730628b, 0x48604fe7ed2ef4f9, 0x09a5156904f2de3a, 0x30f55ada025e4c69, 0x52a84c4d161ac111, 0x99ec5b8165374584, 0x7c9a16db5085497b, 0x0e30e20161b5703b, 0x636bea6bd300dfc6, 0xc599e00daf7deb7b, 0x580ecbce73c345a5
+, 0x807ad60e79b5477f, 0x2d6a246819e2b94e, 0xc3bc31541d982951, 0x58748820b1b8b75c, 0x06c257087d2ea1d2, 0x492e9e7a28162b95, 0xe32be56aa1497429, 0x35b05edcc26d6387, 0x246f38e329a3b8d7, 0x3eb7bf6296c6dc2d, 0xa48fba8d18bc7632, 0x29402ab60c46c3fe
+, 0x53d5c12a1af0b62c, 0x2f207d744ccc7589, 0x7a3dd007621c9a38, 0x74402a83861fb8fe, 0x0e5a7ad519a18b52, 0x07265073a97c4499, 0x251db63cb152ed72, 0x015c9110f43605df, 0xd4ceff82d90be1b5, 0x35cf3ec0c8ae0e72, 0xca7fc978dda29b6d, 0x3f033a3f7f472933
+, 0xb34be6bc5bb79c38, 0x04fb9f4bff15638f, 0xfe2c351fb36ca5ae, 0x334490aef2bed409, 0x69d321e885b1bfa1, 0x43013a2ff0715c31, 0xcf574488cbdb1560, 0x7eda21671d118738, 0xfa560609a8c28185, 0x51f7e2a9821aee4c, 0x8374179a2fe098fd, 0x1e7ead5fceb9993a
+, 0xc09a17775debed85, 0x7f8cc38c3d72a273, 0x1df9806c01429cb0, 0x2b2f070069eb737c, 0x02b9524a621f5d50, 0x3f5833514780bc9c, 0xeafbf1d4da7c5e89, 0x721bf5f770e5e6f0, 0x9bfb9923c2ee90cd, 0x3e4d885236eccc09, 0xcfe0ed84baab46ac, 0x1a3069a207ad44d9
+, 0xe90c8ea8f30aa4c7, 0x201b53175bd44c14, 0xf4d8e90e0789f945, 0x43d74ee193e58e8f, 0x849a224c3959cf7b, 0x3f4d5741916d4a57, 0x8f8100d929628168, 0x150a432d3d6f5340, 0x2a278f52db234c39, 0x197ae931a155b584, 0x7e4f5915550b3f28, 0x2c99222a7c77634c
+, 0xa641caa23649c89f, 0x4183f65d3e910628, 0xa6bd5ed58b7e5d4e, 0x243676375fb3ee90, 0x664e99edd0a1a5c3, 0x3e361cec31780c10, 0x3b662747b9c0e13b, 0x305f69a9eda85899, 0x262952ceeb66f807, 0x25a3253766afbf26, 0xbf884a12e0dfecbc, 0x2236fa2649137186
+, 0x33fb935068e1db45, 0x6ca3ba311ee41f9e, 0xf4acbe008e425a1f, 0x225cc4a9e16aa619, 0x7fe17d15c9a08391, 0x2206c16cf257a8ca, 0x77a9dcd41dde1632, 0x61c4d63a4ba89e08, 0xcefddd12318397b8, 0x71996845e372fe4e, 0xc4c6985cbaa41ed4, 0x2e7d5f91409ef395
+, 0xbb97c9a7d74a770e, 0x596b03f9ab5d0744, 0xa26c1c140255c72c, 0x274b1ff67e39676e, 0xdd8e07086f364e3e, 0x22062c6029364e87, 0x6a7dbb4424643cbe, 0x75977e2aca8fd609, 0xbe80de213d58d893, 0x38e645daf1060e7d, 0x9513d50dec500953, 0x5d370bc73923a97e
+, 0x474432c4f251364c, 0x255b34f95ac37b29, 0x507f7b5103b8ac5c, 0x576fd77af7afa49d, 0x5ea6c8746c5026fa, 0x5ad9e0e0e1953252, 0xfc7559cf6db6af40, 0x16149e5bc14fb249, 0xa27de4cf96fd317d, 0x58853a4b90e21322, 0xd0c05b050c307163, 0x61d119c2f3ae8012
+, 0x8f048873af11225d, 0x3940a5321cc44ecf, 0x186cdc62307acce5, 0x33cd23fe5c14dc18, 0xf4d5436b600426f1, 0x6c27c25bf5eb8f2c, 0x4c9c473e644815b8, 0x254d934025d26508, 0xd9f6a67c6b88240c, 0x5db4b18f559ea085, 0xdca3a7ad772a1761, 0x083708c6515f701b
+, 0x8693a953c6e5b2b8, 0x6460fd11088975e7, 0x7ab11a28fcf8928e, 0x5720baf57840cf75, 0x357db8865b5f9caf, 0x5157928f32a21e41, 0xce5c4da5ec861b3e, 0x25326bc6928b0cd6, 0xe8fc74ac65176b31, 0x6124afb8d6184fc0, 0x5b703172f529adeb, 0x765a75453f928b0d
+, 0xde65943220b8a81f, 0x08ebeae2549e6ab2, 0xfb653a8c0685e4be, 0x069335b787176772, 0x7d2142302cb83a6e, 0x1be4d638b9c7ef8f, 0xba9a4a4544d6d71c, 0x45f211bb76723a11, 0xff4df8ef72e4c643, 0x1a19a95efca51090, 0x91560922fc9b19e3, 0x17d4faa8f1f14e76
+, 0x807f4e0bb24ab53d, 0x4da572d27afdaaaa, 0x1318cbae57e20a3a, 0x5fb06933ae38fac0, 0xf2610a5b8341eba3, 0x7f8ca385e36c9bb2, 0xfa2d2db689da999b, 0x4ba40fe9fa6437ed, 0x4881018f2d2b1094, 0x6c5117ffacece33f, 0x38b57a8a2b696cdc, 0x4bfa95e28507c6ea
+, 0xe204d9bcc4ea94f1, 0x39140ab2bb36ca8d, 0xee809e391dcb25b3, 0x53d1ab2b8095f7b1, 0x1238297f69a27670, 0x0307c3f8a0affacb, 0x9cba29ce9e71a89b, 0x3446ed6d9fd050e2, 0x19c02b749d75979c, 0x56615956f3bac852, 0xa0f3191337e96ba8, 0x1c690b3766fbbaeb
+, 0xc63cbb02d5b56c87, 0x5fb7832719c28814, 0xf6ca117160c97fc5, 0x45018c2f53c896d4, 0xa57b0ebecbb5b1e9, 0x31e494daf3838e80, 0x5a0f55be7325063d, 0x6dbeb207e2827331, 0x708d1241aee9564d, 0x2645765ea6e62a9b, 0xa23f558ea7f4ea8e, 0x5c8ae285b0dac934
+, 0x12f200c091fb9327, 0x648ed101fd24dca2, 0x07013c1f7af14074, 0x473dd19368e38b0e, 0x48e4e2518c63029e, 0x6857d46b98f0c640, 0x89ea6c24bb168390, 0x4e85cb19795cf045, 0x99f57edaea78d9f9, 0x0a41d499e76ed06f, 0x7fb7d78e38b77e94, 0x0397c0b392b562aa
+, 0x23b2051d20f4bd9a, 0x731eabec63b3d93c, 0xc0dfe558691694da, 0x148787af463a12e8, 0x84117b2b985d80f6, 0x62bf4f196662c947, 0x9df18273cce1da3f, 0x2341f64d956eabf0, 0x9bfe898f4e5c744e, 0x72a8cddba089bfb4, 0xa66a7367d970ec60, 0x03e177c11b5a7cbc
+, 0xcf54e2e37bb87c02, 0x2f87034fe40a0409, 0x62b97baa8368c362, 0x39d62364655c3396, 0x9e6994635afda393, 0x0bd6d19dcbcdc9fa, 0xce54ca250c9c6a6c, 0x3995fc6c843d256a, 0x6d3403eef8f39f62, 0x0e2face9a624b104, 0xf1eed933c1bf9f90, 0x24ea99630d678211
+, 0xa17dbd9ed4e91998, 0x357e32dac0cbb53e, 0xfb4a9667d5f4ce5d, 0x60371cb1c32996a8, 0x2a7be43f37af4198, 0x6e9b8cb532d7bd54, 0xcef7bafaadf62fce, 0x3ab3f1cd02ae3e83, 0x3125b6ed8eb7abdb, 0x72a75d591f1f1dd1, 0x4a7e07318ef01e75, 0x74fec9b6a4d92566
+, 0x5c0b3b069238976b, 0x1ab29904b7310447, 0xa6238aa6a230beaf, 0x31a4bf200d996f6f, 0x39e3fd187eda3bdc, 0x287ae55d53e0fd48, 0xeb155be48a4bc0d8, 0x76368731959ea44a, 0x4cd4dd5c75627a7b, 0x45e560017dd450d8, 0x4f26967ccda02c8e, 0x74da7793c3514689
+, 0x8aea38e13c1ed784, 0x1c859c9375990541, 0x98279a90d8bccd21, 0x6733ee3d58232a7c, 0x51a10ab5ef6fd254, 0x6b1a7a62f82e11c6, 0x06d3553b745f2b9e, 0x3b942337a2f4829d, 0x0cb3c783d084437b, 0x21cf7ab30bbfb7b6, 0x9ad5443a1c8ff928, 0x6422afb92f185771
+, 0x93fbc7db52ece66e, 0x0833de0999b1f101, 0x6fd99a759f545e92, 0x4947e74835bc91a0, 0x37eaa863d30e9e0e, 0x2434ad9806530f5b, 0x18c8aea4f6de4b21, 0x2d49874b39a45d4c, 0xc4e58480568c7398, 0x1e6b7cf0764ca743, 0x5dd2d8f5fbcc3035, 0x267d2b09b7da38bf
+, 0x37e20f2d0ab9c185, 0x11918d0489168410, 0xab80894aa77fda0d, 0x1efea8651173421c, 0xf0150906aa24123a, 0x271d9c82f7849d1d, 0x46ac59a967293d06, 0x53fbdb18d04ee653, 0xd4c1daf86ee1533a, 0x19aeeccd68164787, 0x710ccfbb1a96767e, 0x656ecf6691471291
+, 0x008ac72a0647bdd2, 0x6d7d4d7313999f8b, 0xec299e812208f385, 0x04ca81ce8a2e021e, 0xe7dcc94fd02d6784, 0x35d06ecc36a44efd, 0x7210f5de18090f5b, 0x2fe92d4161bffc9c, 0x9842bb5fd51bd67e, 0x38cd55af99d11b7d, 0xc1a5646b7480dc61, 0x79a476c640c7077f
+, 0xb77de71689bb6371, 0x0c067c919006aa90, 0x5c943f943bd4a7b4, 0x4d6c88f59eb144ac, 0xd98542c29c908d5b, 0x61b9a18b797f73b0, 0xe781a49a989fd44f, 0x681b546407962ce4, 0x77463b4f98730c3c, 0x5040eae080f75dae, 0xdbbd7c3db0244ef6, 0x0f72c2f2d1542a00
+, 0xe7e33451a40b4414, 0x5c921cea075c2f22, 0xc7cb101e9ed8bb13, 0x683013946ce8855f, 0xbebc55233e5a26e3, 0x0c4f5ff125b86f19, 0xb1141e541175b30e, 0x6e5a3152f33ec59d, 0xa1bea69f9cb9e71f, 0x29e88bd0092bcbce, 0x84e2eb2b77e36aa8, 0x0bcafee79d872166
+, 0x981aaca37282564a, 0x5c07e14fb1eb20ef, 0xb190635067762cb7, 0x77fe25a776817a11, 0x7548da8a7f71a856, 0x058da6dd98e82364, 0xf70a9af9b08cccfa, 0x217a1cc0ee87ad89, 0x844896fe7aed625c, 0x75ef15cf026422e5, 0x5f33d45450b73045, 0x3eb997a9aeb14856
+, 0x80ef2f95a9ffa493, 0x116959d625916229, 0x599a8070d211611f, 0x24c3c2dbb5f99574, 0x113608ccf52c0ed9, 0x65e4f823cc2034bf, 0xd91012288d208dc0, 0x305a026431b42d09, 0x03bce8d3a2b92e0c, 0x5081ac0ea85f4824, 0xa95c0fe89173ebd9, 0x02d5928272e053ed
+, 0x802269378ab4d818, 0x53dfdbb23ce76247, 0xc5644ec1f3b596ad, 0x2fb5214dac32c2af, 0xca3b4d75d75dfb37, 0x3b41f0134dd98860, 0xf496754e27b432c0, 0x4728142c6ebe3343, 0xf56c6eb17ec937c4, 0x56bcd4afb6f92d47, 0x4f63c5cfe94ad46c, 0x030b4a445956a1f0
+, 0x1ab796f06c586a0f, 0x7dd78dbb03795113, 0x534472b0b1e0e6fe, 0x062e3e3494fbb762, 0x7fb66e0e7eec7f7c, 0x268dc71988754f43, 0xb550f5cb99fd1d8b, 0x40f3e4e2d984f53d, 0xe585c7ec58bdf7e4, 0x004a41a34c9ef1a6, 0xa399a6f59a21083c, 0x4c41e91d8fc22280
+, 0x6a8253cf29550912, 0x24b66085d06e491f, 0xe8fcb7c0304ce072, 0x04d2bd1fd280160c, 0xeb99c8c16614349d, 0x1bc6feb297b26cb6, 0x40bf2fdc4504dd98, 0x133594487ad55fee, 0x3d827dc13d161fb9, 0x4f57b3c2474be83d, 0xd5eda878b276826a, 0x086328ea1153f11b
+, 0xeabf2bf6055333b7, 0x4aa289a35d6d3b68, 0x08f122a938d2e9bf, 0x528687d59ded3a65, 0x3bbdab92e9e0b538, 0x695e145577d3bc40, 0x9ebc572b140b9aeb, 0x19cc50e984351949, 0xced2f705daa98624, 0x511252f3228f7b69, 0x88de7e2ce115740d, 0x6b034ea4c1ae74bb
+, 0xcc9e9fc894c9426f, 0x35da085fff857b34, 0x3ba2fbff6e93c46b, 0x5c4c35ee5ca2b60e, 0x15a5abff1271cb2d, 0x4ffd668bf695410f, 0x078c55f0ff3fef5f, 0x389c7950bee4f71e, 0x633311bbdac90e5b, 0x3f1de062d672b787, 0xf14900653230c8a3, 0x47b6310ac0f160d4
+, 0xbf31d17facf1985c, 0x5444ff59601d5376, 0xbe8fb6680c113bd5, 0x30211daace245721, 0x2c0dd59369acf30a, 0x67fe68b8c1bade6f, 0x0e4ecff5b75dc506, 0x1722a32d9e424619, 0x5130fa5ca2e1abfd, 0x6b6a704aa7e12ab7, 0x62d14e4c8fce1daa, 0x5b4e8ba965f4417c
+, 0x43f30d05813a455c, 0x4ca658d365938563, 0xe93c2acd0ab1ca3a, 0x174732c082b996b2, 0x026863034852a1b5, 0x09ff9c433fab526f, 0xf8e2d23e09bf4f48, 0x197bf26592520478, 0x98f274e2ebd3597c, 0x75da990a747a9644, 0x310d85e88f116a8d, 0x4a48bdbd68d27c71
+, 0xc2a8433dbec44113, 0x21319a3a1cda8a0f, 0xe63432649a43df5f, 0x45aca072be8a04dc, 0x5a4182526dd989ba, 0x26e1970dfd712c6a, 0xcc2923a5478d3a97, 0x286e1ecf8a533649, 0x3138b644544257da, 0x0cadbb4d79ddb8c8, 0xccd7f3cb31433186, 0x1d723a42eae07b66
+, 0x1dfcb4ed70e5b5f2, 0x4f7a6d7fe61ba747, 0x548284a046671831, 0x45b4521a98fc521a, 0x9579a416562f5aef, 0x0d3e045d20d54f2e, 0x7336c6a78c80ae06, 0x54580646f49f6ab2, 0xf898feabbfd7e98b, 0x241557bb696436bd, 0x61d483620c412216, 0x6dea9c93842d3975
+, 0x7ee14e886660048b, 0x0ef99c905e6a9cad, 0x2f745a248580bb6a, 0x387850cf265a7b0f, 0x7b60cd6adf5df019, 0x3e317db3016e0a0d, 0x04c9b104110239ee, 0x2f136383576f9dc7, 0x1408e4d24b2fc029, 0x0795245cdbcd7ff1, 0xdc16d11fb101fd4a, 0x62fc775a5017fb44
+, 0x846ed7862cf625ca, 0x44e02bd246d3a8cf, 0xcaac2bc64ec6cca3, 0x067169a4f721a983, 0x39aac8b4ea2a0a36, 0x066cedf80e9e36b3, 0x6685c434baceef38, 0x65835b72b00840e4, 0xb065ad08e8160555, 0x19e3569f147d8cb7, 0xb6877307421cb313, 0x1bab9705c020fe90
+, 0x22c003eafae35b84, 0x37c4627dc8caa6aa, 0xea6b0f3d25897478, 0x74ef69e726a551c2, 0x5347bbabcb3a6250, 0x76b621b8a3d11a41, 0x09ecdbbdf12cad1b, 0x41dc7b896ed7fb12, 0xb2c5bef18d724235, 0x21a285024cd06b94, 0x59ce03bdc16f4ac9, 0x510575aaa7470b63
+, 0x57437ad6925ca023, 0x3ee341cd95c8069e, 0xb9969ae98adc9e0d, 0x43f9b5348d870d01, 0x62162810f0e5053a, 0x5ab469b0ea53acf7, 0x2aaced2350507ea8, 0x6bd6474305263c64, 0x1f0330c237c3015e, 0x327e25ff3875a04f, 0x4e92c4d6f0727eda, 0x5f6a9f713476072b
+, 0xdd3246c12e1c3466, 0x52173c7873effde3, 0x3ab51ad148215223, 0x3c4adae05bd6783b, 0xc21b4bb796805de7, 0x719a9233e3b3b858, 0xe60f85601ee66359, 0x77cdc215df14689f, 0x812b4ebb0c71a256, 0x72a6eac31b0694df, 0x667ef04ec00b3124, 0x4c7afdb6d07cf55b
+, 0xbe995cff117fd622, 0x7fbafc6a2b561c1e, 0x9901a7d28e5773f0, 0x35154c64a8401691, 0x8b68390cbb338612, 0x4a552767f4d4d383, 0xceb8b5d0ea6764b4, 0x3bc33812809af37f, 0xf1abf387dd04c525, 0x533b99f6887898aa, 0xf3805dd6d99f73a6, 0x2747c0c05d37b878
+, 0x73019029861af29d, 0x0d80bcdd4fdd3dbe, 0xfcda4d1076e52c9d, 0x72e2b4ee7b86353f, 0x08fe935fc733ac00, 0x31ddd79c81bc4262, 0x8fc70ade8c556c79, 0x5542eb24f802e1a1, 0x6db5f0643a9a919d, 0x2751f442e1d5d53f, 0xaee9090e0732c37a, 0x6ad16926f6f5fd1d
+, 0xcd137870af3df7bc, 0x363f38e774bedc46, 0x333674d1e4378c99, 0x57fd041b453a2a37, 0x3282c8819872d48f, 0x490291df1928f483, 0x68540bee067dcb92, 0x0abf2e681504ea74, 0xed5b14352e2e1526, 0x36cbce526b36d83e, 0x769c9f708ee63320, 0x4a081729b015fa27
+, 0x3a22fc1109e9b427, 0x10edef76f36ff0d4, 0x1e86db74a3cbdb37, 0x352cbfb7bb5986b8, 0xc2888b2b5615763b, 0x4f940b4cd5b07e24, 0x37e9ee5a56fe7d2c, 0x2f96a5e5bb1e2909, 0x9316dec2d026edb3, 0x4fef4edeb4753de0, 0xf7f9a7c62dbefe80, 0x076b2e797bb9a84b
+, 0x8a0680b98f5b6054, 0x7fe0d136ae4c3f46, 0x041c9f4abb9bd5ec, 0x63829c3826a163fe, 0x3e4edcd1afd7c362, 0x141895f422ef1eae, 0x1ab054804525e2c5, 0x359599485e3c47fe, 0x1901f216c66231e7, 0x02ea90146df9a9c1, 0xcc0ab0afc2974faa, 0x7d272eb0facc8c20
+, 0xd4949423d2d4eaec, 0x5266efe1f59bd996, 0xd4672016dbd470d1, 0x48c425d54cb7f241, 0xb84d321b37ec8c90, 0x00da3c63b5623d0e, 0xda8105d8a7cee03c, 0x7313f5e1140e288f, 0x182949839a01d968, 0x67b386d7303d9dd2, 0xfebccc1d85cca5b1, 0x3c3c9405e64e40ab
+, 0x6a1e8f79ee78494c, 0x58bd2b02a1302a0f, 0x58b73ad17ab3ac29, 0x73af2a52f06aa5c1, 0xe2ad84f51747f6e2, 0x0e7adf5b8d7fc3c6, 0x10f3f9f99403647e, 0x635f210b5c35cd9c, 0x8cd27bcf717f8a71, 0x4c24bf6e21640e3f, 0x0aaf67f75b6c83d2, 0x5e66f43f563a2bc2
+, 0x775a059e8721d965, 0x6e4b9eb160fb176c, 0x0c6666b58f97f2ec, 0x7fdfbcc33d76f550, 0x8fc9debf3cba7bca, 0x046de21bdc98f07b, 0x48a490883f1a7151, 0x569ab99a52f6bf0e, 0xfafff59a35b3d127, 0x5410133b73358f66, 0xcad860496697eb14, 0x5afde8f642385de5
+, 0xe80124d96c3f9046, 0x6f01da22e80cd9e9, 0x73dbbbb93f5ae83d, 0x11832cd32d5d5544, 0x4d4f325268d2b9b2, 0x43f9468a8bb68cde, 0x958a5ebaba081006, 0x30ee1ad29d9003ad, 0x88f010312e4bc37f, 0x1ccb5d3964270430, 0xfe0af9fa28bb19fa, 0x1fbb36ae007f6d14
+, 0xbf92fd6fc996d1a3, 0x5448f14a51109e29, 0xc7da730cde7aff2a, 0x41f582c8b7999f0b, 0x1f3bfab4180af8cd, 0x4bc7a1ee41f09c2c, 0x642c86888bd3453c, 0x3dd46dd11d616d2d, 0xec5429c1a61ff4d5, 0x36bac201835da4da, 0x5371e5c215ab7f9c, 0x2c7014e2363f032a
+, 0x3f0ed0b1cc317a55, 0x4a9a8c514e02a16c, 0x3d51286e65193ae5, 0x58ef378f3e204fa4, 0x1e5ffa8431535e04, 0x5a419b4188c547cd, 0x179a99b749b84f7a, 0x480a58dffc03c65e, 0x819054fd1bb5366e, 0x2d463a912226bbfe, 0x1c18804f4abb4782, 0x083d3620a3526906
+, 0xb8bc93d0d7b3b19b, 0x6b6ab1fb964b6eb9, 0x6a25df03f77c1274, 0x3ae1f9a35eb5723d, 0xb236704d3ee08f25, 0x68b5a9a440a852c6, 0x0bc6acba3d8e54f4, 0x7b2486d44679a752, 0xfeb2726cf25123cd, 0x129a9065348896bd, 0x19138afa36042175, 0x55f9968726104764
+, 0xac024055d1801440, 0x000ea172bf082000, 0x24f0e4ab2c129cd4, 0x6a4ba2c12a9860a9, 0x64fe35bf0826670c, 0x3e62398eeadee630, 0xdf3ed18423392f5e, 0x38790f3442bc54a8, 0xcb13660dc0ef1bde, 0x2fea5a3dc5c24f04, 0xea84417c0ed04683, 0x1c9b0f57b51cd0a7
+, 0x36b16906521a4add, 0x54cb7cdaba710e5b, 0x2797b94fbaae2afa, 0x3ad1eaa600651614, 0x55f8a4f592537f3e, 0x2c1815f536e31830, 0x1c4a8aff1fe18e76, 0x6acd55dec58e14a5, 0x859ebea58422eae0, 0x64c09418d3380327, 0xe43b40c1af591c97, 0x1c3c8ba2979b0de0
+, 0x9df6e4647576812a, 0x55787394dcb1eee1, 0x625a260ea31ce254, 0x209681741f4579ab, 0x0c8ca4601dfe6609, 0x72e8aaab04e1c6a2, 0x28cfb89d64c16d15, 0x20f4a71478cb64a3, 0x91907428009d1273, 0x6c64e3653e73619b, 0x504bb244a3cd5f77, 0x0a2b5a652cf682e2
+, 0xd34500c86c010251, 0x4bbad27ef416d3dd, 0x362bbc7c09887174, 0x5a99920db8de730c, 0x966d3691285f4439, 0x2ce0cf9a1d8d06c2, 0x3cd453361d816020, 0x33ac9433388a367c, 0xa1b9853c93650dc7, 0x268976fe106ee8f4, 0x126775f641c5c02a, 0x204c7fb7bf57737d
+, 0x5ec2875e589fad31, 0x4264cfcb667eaeaa, 0x5f3b6bbb1f5ef763, 0x3d60a9816655bb2d, 0xf3ec49316a099448, 0x4eb79ad823ce800f, 0x41c796e68c560f6a, 0x5caf2b1d6d29209b, 0xbb722310f0a891ff, 0x05b1f0d8b69bd452, 0x4484c726db41949f, 0x56c42a960c50c5fb
+, 0x7195d674d9a52f0f, 0x5339597c7c7af0dd, 0xc564a1410781aa7a, 0x032a1127ce7f2bff, 0xc93920e342779f52, 0x7f15cf868ae7bf14, 0xf7786892fa14f8af, 0x21d2721b143026e5, 0x800d776460a3c7b6, 0x6541d6ee60bc69de, 0xd7bc0a7eefe811b0, 0x72b1bcb54fb80726
+, 0x8ab314bfb119a1e1, 0x1500189d95195d6f, 0xbd46d2b9344cf115, 0x5b4e824f4abc04c0, 0x931a43b418075262, 0x604d8bf5dce6bd77, 0x2293e79f39fc8bdf, 0x72eda7a4a412aee2, 0xa2362936d0233d58, 0x2fafe357ad9c35a9, 0xdb593634c067550c, 0x2ec3bdfd97da2538
+, 0xb9ce05e25c478cdf, 0x65579b25f63af31c, 0xcdc45230d2ec72e9, 0x2bcf1b9f663f1127, 0x95a0b09256455782, 0x18efcaf95ea0ce5f, 0x4366bf93fb4a0095, 0x76c17740c71f5ed9, 0x289223cc77a0752d, 0x2b791e0f509f067c, 0xb83b8f907dfdb6e0, 0x292f9e48ceb18e00
+, 0x207cf0debf68acde, 0x5552184880706364, 0x9f64648a341efac2, 0x2e896957f40e5529, 0x5913e885f8d79b25, 0x1fe9e6ec86a9c8e6, 0x24b06cd923a42890, 0x0c259d8ef68319ec, 0x6805461d8af2ec2b, 0x1eaf56cf076db727, 0x4ecece8002b1945e, 0x62a67ee13a931b96
+, 0x61ef5912cc7d7684, 0x36d1cb03115d1c1e, 0xb8c2b63b924ef5c6, 0x4badd329696176c1, 0x18a60ecb3365e31d, 0x633365bbc6ef66ac, 0xa2e0ab23c5cf32ab, 0x6409170d8bc0b68e, 0x3b5fd748201eb07c, 0x5c1cadeae1e01627, 0x8b62c5f5b3cc3d37, 0x0b9d10b94a577b24
+, 0x5f55f7cb9db7622f, 0x5175709036b06e76, 0x8a96cc8463923195, 0x4ce2fd77ed594203, 0xf8f3079d8fe54098, 0x203d4b8d34636ae7, 0xe15642d6af1e1ebb, 0x30c7d4d69d46d463, 0x225c3960a5ca24ce, 0x5e9f6c471d8ad0d9, 0xec7890c1ea220096, 0x744c9f703dc57e2f
+, 0x494eeb26072760fe, 0x2241aea96d9310a3, 0xe1cfcbe1a43b649c, 0x481944730f877646, 0xcd2f4c521cb66435, 0x18083f04747f9241, 0x7fa42560d3d120d3, 0x3e14694efddea413, 0x498cb45140abe78e, 0x4f9388715b66050c, 0xf50cbbd771b5bf43, 0x66ab8cf81a11e103
+, 0xf54ed7269fb507cc, 0x037e19e9afc3de34, 0xae1197ba798ec5bb, 0x457bb823343b8229, 0x1e1d4ed4761a941a, 0x17cc0600fb8a54cd, 0x0454cecb9749058a, 0x435f9ded61c358dc, 0x19be914d1f6b87a2, 0x502518734fdd61b0, 0x15cecd8469738282, 0x7bc926e8c6c1364f
+, 0x6d8a47b0256315d4, 0x2b6687e3ce1a6009, 0x17a5e6118b1646c5, 0x44d59d7bacb20a96, 0x596e045aaf46ef25, 0x1b74017b6f5e184b, 0xf5b8c9a54443c483, 0x55cb32c91b47d884, 0xa798342751d040f7, 0x2d44f9159a185ed3, 0x01f28a4376229b93, 0x61cb7473d0c77f20
+, 0xdbaf01ab45db7770, 0x7b72db4c4abd3006, 0xbab9082df35c8365, 0x37f4aab0b90ea3ee, 0xbd3481387502211e, 0x3ec632d4b6c3adbb, 0xaaa862a956cf23d7, 0x3537e62a23ea3710, 0xee1e09cbf2647224, 0x50d746d531fd05a1, 0x4c3b3794ddce504f, 0x7c4831d7200d5eca
+, 0x4686d3db2bf73494, 0x210a800c4145b84d, 0x7a34a458938e72b0, 0x4ca53476831b97f0, 0x34ac01f36279749b, 0x4fea3d8a995bf60a, 0xc77f1d715d870cda, 0x190009d8167ee318, 0x290d077d5adb36d1, 0x069b6ee3fa770204, 0x7466992cf0b94588, 0x211aacea863ba9fb
+, 0x9da28dad66f2e0d0, 0x26bd16c55816040d, 0x37e526011facb531, 0x15b79683b7bb0978, 0xd12851eb34cd7dde, 0x5c25a54c6e20a4ea, 0x90039c7e71ab8b30, 0x267592094eac3b26, 0xfd87cb18ba48f545, 0x4fa563cf16c6ff5e, 0x1a53c0bdab63678e, 0x37d7dea6e64c2f6a
+, 0x893274d08218f6bc, 0x2f1a77a2fdb961f1, 0xc6bba26330fe80f6, 0x309419351bde3673, 0x2c8cff17a817eb9d, 0x6c1ca665261e896d, 0x2564772bd5055df5, 0x298c4e20d76cf93b, 0x15b84ab4a2447c84, 0x026dc5971cfff0b2, 0x3d98d6b1a888b73d, 0x15442ee417bd940e
+, 0xa9bae47f0e77ec67, 0x1e004b78d0646429, 0xdeced7b85414d52c, 0x2e8d6f1e79683474, 0x9ab95344f443df7a, 0x521b078f3040d4db, 0x92594e818dc5da9b, 0x394e75089252fdd0, 0x0ec2deb16d355895, 0x51a18528f69b62ad, 0x15f8a5f06a4636a3, 0x78f1cc14367cfbae
+, 0xdb10e4b7b0a627a6, 0x71617812c1c7b65a, 0x70811494a47c4e40, 0x672b65fe46abba5d, 0x04a9263a3cd0f3ca, 0x18bb682191fd9a69, 0x080bece9b7081e9b, 0x1da7fe1fe88ad348, 0x2ecd796c480a88e1, 0x0126350bec454f1b, 0xba8af938755a5bca, 0x11cc5962975bfaf4
+, 0x2c05ae8ad00b1288, 0x076bda9fa3a61abc, 0x7bf98c523a9468b4, 0x3ea107984b3385e4, 0x08fd2555ed2b147a, 0x270d34d414e7b635, 0xba7bdc3a9a4915cd, 0x65a4b0d2a1df5198, 0x0aa7685a16a99042, 0x0c9747010ebb5334, 0x1aae0bc831591c19, 0x1a82fb5373b52586
+, 0x209aca05dfcc3cb9, 0x3117ce0dbd98dd22, 0x187bb7c2799f2d3f, 0x06f8581b434e9821, 0x041cd6fe15ff5c70, 0x5a7170af82afd078, 0xe9dbc5ff20c12bbc, 0x1ebd727e7eeca617, 0x3d074be496f05301, 0x595e543a1f5541e9, 0x382f839bd4db7966, 0x038cd9531e8b2385
+, 0x715fc062ade35dc3, 0x1b052dcf28a5de10, 0x677ab740145e36e4, 0x76e92c5961054e93, 0xe1c0f35fa5218f76, 0x48d66499130f13b5, 0xa3eb55330d21bfb8, 0x0c9944e19c8a435d, 0xaa43cd48954d40bc, 0x41ae2865e3d8b7a0, 0xccda4b44a48153a2, 0x25ed8c67334a6720
+, 0x66056d7295c6587e, 0x5a16765eaadb8e9e, 0xe98810d2e7fbf76f, 0x5e034469066e6fed, 0x6c752c236ba7a776, 0x19002160f0c1a3b9, 0x939aaf6bb485b3ab, 0x1e2eacee5693665a, 0x4010a365c499ba90, 0x1f93f396d89bdc04, 0x76549610fb0cdc58, 0x028cdaa146e66b7a
+, 0xbd9f6c834d752489, 0x7393193e0761ae88, 0x533a80c6271457c7, 0x6f0619db016f9d6b, 0xa20d195803fa602e, 0x32a395bd7657c78f, 0xaf4f07c5dc094eda, 0x5fb4612e9bf8bd2a, 0x9c1ae9b8c0240c95, 0x21de5f35b59f1f06, 0x3892e3a5c9975919, 0x5dfbf1f385bbef68
+, 0x033f93ca594a5bc9, 0x17d0e5077f52735c, 0x5e2a37581844d6bd, 0x1be495dbf8661028, 0xbd7f0d1a08e95693, 0x6148d23e25f366f7, 0xa69f998d7f2c4445, 0x4282a41c3f134018, 0xde58a40e66fbd94d, 0x57c36b19cb5a36bf, 0x713a95492684a0c4, 0x71b7f1df036cc8f6
+, 0xdb26765464a01bea, 0x00b6ddcbe567f8b1, 0x4a288748a14df3c1, 0x5bf30a0dfd0d8d01, 0xb0b6bffd6275d5c1, 0x5d379961eb3dc553, 0x376465025bfd77be, 0x53a0068c3f424789, 0xfd197913ba2060fa, 0x700621bccea82a1e, 0x6929808360466f5c, 0x611ff5904ad76307
+, 0xf2ef39a4e02d49b0, 0x323651e7f0c45d77, 0x9ada1a4a5737c84e, 0x5a44f81dff22bad6, 0x79a30834a8cebcc6, 0x249bcadc50d49c52, 0x154a37c93b96b109, 0x43c9a68a66a39877, 0x50e4888ec6bf86f5, 0x6abe18c802e1e648, 0xac4d2db25c681f72, 0x3ee9839aee9d17d2
+, 0x71e416dbe83e647e, 0x7662e7cc9dff9244, 0x88cdd51ea9ee8dce, 0x2b86cc29f8a1118d, 0xad9ec5bf632f2b23, 0x293a5ecd457cf854, 0x7b56a8928f59a801, 0x10ecc56950912e61, 0x23dce7084b9b8d49, 0x534a2b72519128cf, 0x2659afc6fb943b79, 0x7b4775d14b34f315
+, 0x0169e4f4e86b6476, 0x4c2f7f4eaf48a653, 0x94f4eb20f01be6c5, 0x6f53a56658183c1f, 0xa40a39cde25027b8, 0x537bdc5d9209a7bd, 0x76db6e22aa100b0e, 0x54653384c42684c8, 0xbcf10eff3e5aca94, 0x73e6c34ea9d67a4e, 0xe407f1b869e9d857, 0x1367cb93607db5e5
+, 0xc5b6d32c4149d9d7, 0x2aed214c7d41b22c, 0x13c924a61de34909, 0x109952d891126623, 0x9f5640e165e22a41, 0x3b5dd0966b08a759, 0xac1703b63024ad44, 0x18d3699978c1eec0, 0xf41f2ec35352e749, 0x3b9d130fd8606491, 0xfde47d75d0054c31, 0x7cbb425d815d1a76
+, 0x522a209e27881ca9, 0x6a4c810ad824406f, 0x2b4742cfc66e7c26, 0x676ec875d7185c7a, 0xcdb88c8ff97933d8, 0x214c4ce8f2e21628, 0x70e7bb24d588ccd0, 0x4f9ea8e4a3e83465, 0xfbead5a9f6c5717b, 0x7283c3a85a3e4671, 0x4d1df81928c28ba4, 0x48645a5cf96bbcec
+, 0x1a1a3c4ae8670750, 0x4568c13c93c7dde6, 0x981c53064a8e1767, 0x6f3c6107230445ac, 0xbc3bcb7539f21ef9, 0x75751cb966d1a8ba, 0x7bc8842204fef4bf, 0x4a33af1115b66e2e, 0x000a8a554b6ecca4, 0x376d22338f66a07c, 0x521a7562bfadb457, 0x5da2ab08b8c658ac
+, 0x918b8fbfbff3d8f1, 0x5fdfe9e178b88b5f, 0x58a03d2761c7fde1, 0x444bfaad43ca4743, 0x3884f97210843da9, 0x3d572e238c53473c, 0x4c22521d0829547d, 0x4f4e5149a876488a, 0x18f1cd1201f29b37, 0x3cd8dc2cb3c1da5d, 0xeec195f4a46ce23a, 0x038450d5a0373821
+, 0xaa552baacdbf9cfd, 0x08ef97b66804af71, 0x36a89ea480f24e88, 0x65116dc672b350e9, 0x1a51dbeb575a82db, 0x14e5ea55fe4af622, 0xc2aa6d3f987dfc46, 0x56a21e5d4e07cbc6, 0x93580324b0f62148, 0x4ec9bf3d18840e6f, 0x8e192a805f09ea16, 0x2f65e06a1034f954
+, 0x5a8aec8463cd3f76, 0x5a68919b1dab8e54, 0x083c3273e402b97d, 0x0ec59272d7f9215a, 0x08be78921a21538f, 0x7d7d42c946acdb28, 0xdb615bcdff769b8f, 0x5d3d1aec034fc8e2, 0x15c7393df38cd96e, 0x14d4de053ff9aceb, 0x924e99a1a1c0825a, 0x407655163f477f47
+, 0xd68c2fb344921b26, 0x5b3cad162b4317f5, 0x734fc5a36e57c538, 0x607533bcc79aabd7, 0xc2c65a58db5987c4, 0x464d7aa779e51642, 0x1da1efa637578a21, 0x2316cd750286efc8, 0x381409d9576f7ea2, 0x44aeb525d22a99bc, 0x966918f8b7f501b1, 0x59b42b89f4b601c5
+, 0x92b960d0c9f88675, 0x65d539196aea6983, 0xb1614f56dbf8d0c4, 0x158149dbb9128212, 0x8c3d000b7c0ad687, 0x13c04a6affbdc3de, 0x8202f01593774f60, 0x2151102770dccb19, 0x05ad78dcfaf21516, 0x5ea6c1008b54a3a0, 0x4261704dc2bc3e30, 0x098c90d341940256
+, 0x7a33627f8263f46f, 0x408fe0365d616b18, 0x12eaf9582a99a523, 0x204382f8571ec1ec, 0x209bf42680eb3fa7, 0x01f5cdae65f066c3, 0x172cd21ea5e3c836, 0x171573f2a218b92d, 0xb2dda8dcb6b4c0f1, 0x12bc2ab946149ba5, 0xf6560e9250981b70, 0x0c67bdd6f5250903
+, 0xe4344318cb4f7d73, 0x73f50e79a0775f3c, 0xe47e4f32634abdbb, 0x00df6f255f267729, 0x1557be78b68f70df, 0x644f032af3e1dc02, 0xb6a2ca9de4aabc4b, 0x7dc88be2321363d7, 0x4b0d69dc80d34df6, 0x013eb2911bc58ab5, 0x48dc87cfa186bbff, 0x30ed82e009e927d2
+, 0x12604ec9920d5226, 0x11778ee0d4f792a7, 0x0e441b6296910168, 0x5c62908ad00474be, 0xb905ba9ad502e6a2, 0x3a92752700b06ba7, 0x4f67adf2fad05726, 0x6c33988a900b8ed0, 0x476c5a60bc5d5f31, 0x34f8d19aedc844bc, 0xdb009ca1828b9821, 0x46fdecbaa5ca018d
+, 0x9c6f5d8fe43d66f6, 0x4e6a90553f9d3d62, 0x69721f90062c2487, 0x08670b1ee7537e36, 0x93cea4c721b15276, 0x6a7c39b923b382a4, 0xc559ce0901ea72b1, 0x02f106014a362eda, 0x66705230703f1c8d, 0x6c8bb211536a39e0, 0xacfaacc71812ccf5, 0x51d331acbd548c6e
+, 0xf201ca7548c4351a, 0x5b20686ce8ec6752, 0x131ed23d8d184e7a, 0x7e0b33516d250305, 0x6f1d415ebe3e1c0d, 0x7fb9f16844c9508a, 0x83b85a9995f3ff54, 0x3ebbb1ebba613bd5, 0x558e355a50601054, 0x4f94c89a2dd785e9, 0x1ca246440d1253e3, 0x04f718a22203c93e
+, 0x99e7d9af70b3eec2, 0x5e8164ad193c7f58, 0x9bcd68a942912c56, 0x58aa169303a9f540, 0x5c0e38ddfc7f0c28, 0x17e1bee3f0f9462d, 0xd95eb99c9cd77f2f, 0x15b0def599f3ffa2, 0xd234687f99148466, 0x7b9019b8a9525de7, 0x5883b3ebbf52a196, 0x634fb6696d3fb6ed
+, 0xbf9c51ed8108facd, 0x4ff2075bcfe6cf7b, 0x4a42c8fedaa24cfd, 0x3f148520bff841ee, 0xbfa9cf672dc4cae3, 0x4858c6819c922871, 0x4fb0499fbc3410a7, 0x1199211b70d96fbf, 0x5544a42cfdb5b0a3, 0x5a47908a43ee115e, 0xe6c78026cca29d3b, 0x5825ad83772dfcad
+, 0x2417db128264c90b, 0x416e18c83a94ea86, 0xd810e441b142c468, 0x3cba0acacf18806e, 0x9c15f015615425d9, 0x41045154354e8912, 0x53ced388d307e25e, 0x5f531e3981a1d5a5, 0xddf304563d132007, 0x6912876133a9e023, 0x88d40a2cf345a1de, 0x21f74a0a3528cf12
+, 0x0373ca2b1faf1a68, 0x69936777525b3106, 0x32810011ea6315c1, 0x7bac0cc9d86e2c34, 0x63602738fbc34a18, 0x16b01dd6488d9032, 0xdce14691dea304af, 0x4215a648f85abbb5, 0x192ff9656d24e5fd, 0x4d639b5fa5c7688a, 0x2550a40af18ba020, 0x6fc58971e37e149b
+, 0xcd3af64a934e8a20, 0x655bf8b27f8b1564, 0xe6db13e34174d307, 0x11e1143372f55c17, 0xc5c141a66a1380a3, 0x6b5deb5bb0b8fbe4, 0x7cde2303ca622006, 0x6ae6883365533e65, 0xc86c9d20af01a40d, 0x426dccb2e9d2a9fb, 0x9fb67abe41276784, 0x6fcaa936cbd75986
+, 0xc432be14aa55858f, 0x609f87e24b9e071e, 0x0b57faf1cf69bae4, 0x088f7f01999b7015, 0x64f74ab7d64c4770, 0x20ad21bbb8b0d3ae, 0x1af2cbc16b4f096e, 0x351e6befffed5ca9, 0xe1b1dbaf9c52cd52, 0x0478133bdaf9a749, 0xc9215697f3213c39, 0x3ee1177ac3de25b5
+, 0xeb95fcb994dad87e, 0x23595c089d922c4b, 0x8a411a3b794a813a, 0x384190b326d52b40, 0xf91bb1b9ee9d0162, 0x1c87f40c8ae7690f, 0x55a37db2a78f365a, 0x11062b7de23d59bb, 0x5106eb9722d61c4d, 0x189f7299634dfe28, 0x252667029f3bc538, 0x4413ed4906810a6e
+, 0x1275add645920e81, 0x4e5513716904747f, 0xbbe01559c0b34d7b, 0x468ce265b06a859f, 0xac1aef8cafaa012d, 0x09118bccc46f4916, 0x87c538c13e692bc5, 0x0b632be310870f06, 0xba58e2f5c6133e95, 0x5789abee6d3ba6fb, 0x812ca4ccecf82fb0, 0x436671f0a54f442e
+, 0x1435a5066bcfbc15, 0x3a243e875b461475, 0xb7ffe58e64811a62, 0x175230e87b0c3ecf, 0x905166ed18b7f502, 0x2bb654a1f7a8380b, 0x93219e830fc2b1f0, 0x60115cf7726a6d64, 0x1a125b46ae63c71e, 0x79a36e0a53078634, 0xab7b29d928463a69, 0x227c1f8827afe090
+, 0xb979f333c98cdab4, 0x1566e88bceda1e3a, 0x40f741bb7425c1fa, 0x00f22379e9b0299a, 0x3dd92bee1ad511ad, 0x3e6ce895e2790e23, 0x3c9f525cb51bfd96, 0x1b3512d79c404fab, 0x1aa3d8a6ccd39c92, 0x2354245d7c577967, 0xdd90fb22f3bfef4f, 0x3a95c4a90360c54f
+, 0xc4181993ecdc16d3, 0x6a3982d0bac10c8d, 0x815a3ef8d3fbcd75, 0x4f9716e11ffccbd7, 0x2f761ed012b1adc8, 0x396909986c6f640f, 0xf8c9f1da2997c2e7, 0x76344411d4d8e5f6, 0x794bb417b4b693b0, 0x35560f987a02e512, 0x3322b1e3b55e8e87, 0x0a20da0093fcc35e
+, 0x382062bb4dcaf95d, 0x330a3e902d5eaa1e, 0xd6f4c70f91f4c355, 0x21e8193bbdf99edd, 0x4a4831bcf5ab781f, 0x1acbbd63fa770456, 0x64644e984e9e2c3e, 0x0653a938bbf2d90e, 0x2097a6d5175702e0, 0x2da6f7fdf62eadda, 0x848be9aaa0785b1c, 0x1ba196b1a8ff3dc4
+, 0x40cbdedbac3605dc, 0x0d67aad1b0fcb3b5, 0x9711aa242cac5c99, 0x20b172c172988719, 0x0eb958c5c7f752de, 0x0b8e8a6e66a82460, 0x63537994c9aadfe5, 0x16b03dd965f8a4a3, 0x8c6013f4dd0517fa, 0x57d114c819f76ee6, 0x7e01e718d55a1ad5, 0x2766ab50eb8aa209
+, 0x2fcdda3d5b9016ff, 0x1c6509761ab53834, 0x03a69ebeb3dd1374, 0x76c41c1bd5abd2cd, 0xd423b802103fceae, 0x510a0c4dc07872da, 0xd93d656d8254e686, 0x627550c46cc849af, 0x15d0a80d2876cfeb, 0x4473fe90ea50e0c3, 0xe40788f0b3693f52, 0x135b0dfa38131edb
+, 0xc82111294f7b950e, 0x5e2e81c28f144b2c, 0x08c2bbd37e1193bd, 0x0ea48ee7a65a8256, 0x99bc4449ff0b6358, 0x2543d84ed747ed39, 0x4d37f238a02d5a84, 0x5cc56a9336b9f475, 0x6fed9ef115cd1bd1, 0x254801b90126c3b9, 0xf6c1d095a60ec440, 0x484c9148167618db
+, 0x350480148d008fb5, 0x43ac48ef0655b46d, 0xf070699309fd2e93, 0x08fe17471fef360f, 0xb8297f1d730480c3, 0x0a630604fd23a16c, 0xb46c0fa1c570fb78, 0x3b7b6ed6bd05bebc, 0xf30c435401968c44, 0x76ccae73601ac6df, 0x4422a2fe4c0c98d2, 0x662148cfa83d9bc1
+, 0x9961a262dd4efb00, 0x6b451a52ddfd5bb1, 0x3aa1958c83fa19d4, 0x6e943494a0bd56d5, 0xcd9e6226d422607a, 0x460c72b7f5088abc, 0x55ff35194b77aaf8, 0x0dc573787d5d8c05, 0x2be45995d0642486, 0x43037e1096d7e2a0, 0x78d18f8a6b4f05e4, 0x4ba7922e941d4302
+, 0xbd91137b1e5885af, 0x4314d16d7f4c853d, 0x0e192c90a8734b29, 0x406ffea9425c1f18, 0xca80489d76bb51ec, 0x679d30d5a0298271, 0x09e80b66d10a05dd, 0x6daaf4afad8988cd, 0x31b82fce99d33b16, 0x06a73365011a07ff, 0xa8f4c5e40c055f46, 0x51b826d4ff2522a0
+, 0x57cdcdf429bbbf1e, 0x51d2fd834fb66dd3, 0x6ff3c7f59cc14188, 0x6c926eebb336801e, 0x5f7a40ba70bccad7, 0x756a3c404827a6f1, 0xa35f4e0d20a61a22, 0x1ee9fb8fd703ca33, 0x7c185334d30c266a, 0x6e3f716ec88237ed, 0x2762608f8716c5eb, 0x12aa0a4f8aa04c33
+, 0xd52ce2314634ff77, 0x78f3f1985c3bfade, 0xc92c22e96f0edb5b, 0x1bed7e33a7a8091e, 0xb3eba38c0ea6095e, 0x42f11a83bc0c2ec2, 0xbb01fe17dda5090b, 0x1dc76693b59c7161, 0xe1b505ffdf56969a, 0x0cf50e3e14fcdd40, 0xc1bec6299210eccb, 0x03883c28d558bf1d
+, 0x092e5166365dea0c, 0x3fc027887e3af4c8, 0xae9075ea77043b42, 0x5b1deae5d77deabb, 0x771605512a35f3c9, 0x35a20acc5f23bb48, 0x6aa0ac1df43929e0, 0x5b4a5fe75fbd5d2a, 0x3e597e095fae378d, 0x09c550651a9e4d28, 0x78f9157fc4fc41ca, 0x74bc4b125314f495
+, 0x09e159d4c0695337, 0x5b40ac908261bbc4, 0xb4efe605222f86e7, 0x21b6f7bec6be71de, 0xf292a24d87922f94, 0x5181b9b11bc5a8c5, 0x3908e4297bfb8910, 0x3e8472d51fc6db45, 0xc5ab84c1bcdfe479, 0x19276ab0b95e67d7, 0xcb669e01fedcfc08, 0x5565d1311e7933e3
+, 0x97e398fba9b1d922, 0x28c2cb3e3b0f0da9, 0xb6c5e517d3210f8a, 0x13426f13449133c2, 0x96cfeefaf35da7af, 0x4690d8c3ebf31d9e, 0x5af50e7ff8e7bd59, 0x24e0718886c51cf6, 0xe93fb4f71434b855, 0x2405ab6558ec70f9, 0x443de09776e7c58b, 0x586fb8d2369ecb3d
+, 0x5729f47caf39f6cb, 0x47c735a5f76210b2, 0x34951eeab91699f5, 0x7a0c887433c4c92e, 0x4ccd0222c6bd9fe1, 0x0255e348ac134494, 0x6c8bf0b1ea8e0245, 0x0c12ad6345902e99, 0x94062e4d73a6e9db, 0x10fbf2d39307d440, 0x771ad7d87f620ff3, 0x5ef958493d7e9b6b
+, 0xbaf85aac1f9e9fdc, 0x6e370a2b537ba7fe, 0x7d50dfb891642a76, 0x385a25d889b7d24f, 0x587124f4261bcfa2, 0x3447ed086f684b55, 0x73b7dc4c03027cb4, 0x6d1d17f0f19479b5, 0x17dc5671dbf7234f, 0x47918729a32065ed, 0x53d6916f652e7cec, 0x36ff4445085882e1
+, 0xe19f49a7b914d755, 0x4f6c1569ff02d242, 0x330b15f2448ca241, 0x1570cbca7354347f, 0xcba669f9219240dc, 0x6cfcd74dd32b04b7, 0x92ae05e9d2dcf73f, 0x2a3c61951e35904a, 0xb05deae032d9a4a1, 0x3714b2261e9820e9, 0x236d4048c07c1e7d, 0x0ef2a5cd855cc86f
+, 0x8c7475d7fbcd5caa, 0x59ac247e2515f923, 0x1b79bff8ecd89173, 0x458066f038def920, 0x307f89f471c58b10, 0x2b14d591f2e28235, 0x9f9864b3d4b01861, 0x4ee2faa4e9fbf920, 0x854b3a18a2fc6b53, 0x7b150bc327884d64, 0x2ae3ab5d4d0861fc, 0x11474e2a46487a96
+, 0x826392ddb2795f4e, 0x6d12ddd3eaf92962, 0xd53009707dc0724c, 0x7778bf0860451bd6, 0x692caaf5d93f8b27, 0x26caacbeb8ad4b00, 0xa97ca540a521c23b, 0x50dda4b13112b980, 0x0298032664ca2df5, 0x3f02a98d2b4fb66a, 0x9edd72ca6b4083f9, 0x7e111136ae053893
+, 0x9ded8b0b005f29f5, 0x74ece0f330a1862e, 0x6fab84cadff75f81, 0x25d83fb4bdc12222, 0xb6f21b07e852484c, 0x23a3c8a66a1f386f, 0xb8a28f48e701392b, 0x1ce1de603b3a5547, 0xa7264754a81d5b67, 0x46d471bbb204c9c8, 0x51ad8424fa589938, 0x358290a5436fe378
+, 0x48bbcbefdb96ee69, 0x14388b3027aa0e0e, 0x44bb4be86f3eda7e, 0x50f8786e7cc1c4be, 0x7dacd83a2d8d4d9d, 0x77a64dc45f15a5ea, 0xa95b43c3d95ea0cf, 0x65805f7d795af823, 0x6f56517e7e4f66c1, 0x0fddfdbb1586332e, 0x750839a8134ec440, 0x19823d3f13adc706
+, 0x4d55dd39f205dadd, 0x13592152a48d4343, 0xdceabb2285fccab0, 0x2ed7bc1b3c1a1c97, 0xfa75be751af30a7a, 0x594a46304f69b9e8, 0xf4d1095f8891bc6b, 0x29ce8f448bcffe8d, 0x6befb3c773b39c6c, 0x7cdaef1db22fa94e, 0xccdae5c360a86982, 0x53a573162433c0de
+, 0x228c3a5ff6e81ab5, 0x4fc881dd92b027e7, 0x902890ba4401eac0, 0x3dbadcd644190f55, 0x5f1785d877e70376, 0x0ec6ddea7bbe32f9, 0x9e40aa31d837ee88, 0x4749a6af3eae270e, 0xedbae67601c1d65a, 0x0387e4cc80fa1032, 0x95bf3d60a3b7a7e8, 0x50324de4124949ce
+, 0x0ea7c4bdb7b11524, 0x6d77841912c8311a, 0xcd853947e19d788b, 0x7226e1040558c040, 0x8ef3349a6ef50881, 0x0c0e3aa5f2cb0019, 0xfdceb69c74dfa089, 0x7878a66802d1b421, 0xd052a3110ece3b42, 0x436f95e4e764ccde, 0xe61ea19654802134, 0x007a76a52fdd82ee
+, 0x924be9a9cd797c73, 0x5a865b3de8884bb5, 0x7bd1d102ce0225b1, 0x5653fb4580fb8fab, 0x006af0ac20adf0ef, 0x543943166997655b, 0x5de1efb2c6f3cfe8, 0x027e15536dd13b80, 0x1098ee7f14dd7375, 0x244b60e701191162, 0x9b5b06c19a1e5bdb, 0x66d98c21ef6239d8
+, 0x676d3529a2079564, 0x593717ddd113442f, 0x3e121aebbb76067a, 0x2dd830fe618145e9, 0x904ae8ce011fe9f2, 0x033eda019ed3b08f, 0xe6fbe1f8beb13684, 0x01569b6487b5a8d5, 0x3b66b5c073d2e9d5, 0x3097464fe9d8f15d, 0x120d5628ddf9d61f, 0x16ea5d01bf33b1c1
+, 0x0793b0ed3ca71e58, 0x28a4c8edb9a59dc1, 0x084e995ac5120c25, 0x7351cabe9f291433, 0x0e1cb596ae8721e2, 0x7bab3a7052db0d27, 0x1e0a510abd380f03, 0x2c72b924b8b0248c, 0x653243d03b874632, 0x0d9b5e352eae8d29, 0xbe407487f483bf68, 0x24f956ffdd1fbb38
+, 0x050194302588b182, 0x0aee1eb9622c1e7c, 0xb8760426143be40b, 0x6b75f45eabe1fde8, 0xcbf2c5f7c3107cea, 0x4b9687cd9b58d3d3, 0x0d80113cf7d95717, 0x014867729fa83e22, 0x7605d34ab6d5933f, 0x635cc5454348ef6f, 0x55e08274f519bf69, 0x4db214740325d66b
+, 0x9caa1bb99f2ca506, 0x198f615fdf987407, 0x535de9167def64e8, 0x41c41afc315d0fe6, 0x9abe9bdea2196a35, 0x3b57ed05c0b3c5f8, 0x90202f4ac8dcea6e, 0x1e4c79b17d717093, 0x32b5e9d915288d36, 0x7f7f1dc0aac123f9, 0x6009ca1ae1337b4c, 0x21de8285648627eb
+, 0x86be299ec8f129f9, 0x61e47920a57ae550, 0xfd247032cc76c2ef, 0x55948aac971aa984, 0xbbcc9c3af55948b8, 0x26e3ee51ffb67790, 0xfc2963d01cbdb6ee, 0x32ecf03163a8301e, 0x5e7814bac812bc15, 0x65cdd77a90581e68, 0x9fcc75b89f7324f2, 0x6e2b57892c459401
+, 0x0e9386f9876e72d5, 0x1be135b8955b738b, 0xbe03c51c2b3777ec, 0x196a13e4e3fc5039, 0x024eb4051c13717a, 0x52c0f98b04a209a1, 0xfcad2b4f11ebe541, 0x5d6a29eb5dddf100, 0xa347d323e3ed1d20, 0x5623c8271dd624d1, 0x3b42572e56844d4c, 0x7745979884238a23
+, 0xc4cde2d7a2b22ddb, 0x600c7bc06249b770, 0x2c597ff430a59bfc, 0x0a51b5e506e90a4a, 0x19378375673c282d, 0x198eb0a389392d31, 0x63c54772ddf64e00, 0x5a34c3c11fc29b72, 0xb8c4790bf4968927, 0x3376a71f8da91b62, 0x304a2b85f63736b6, 0x4e0c125a67abb0ef
+, 0x52485f7bebbb1fcc, 0x4171a91e2ead8d08, 0x2d5bd2c7945720e0, 0x3c4c46903e9a690d, 0x5cc11d36c0fa144a, 0x587c56a123f207ef, 0xdf45427dc3b78198, 0x44f90cc0d3371046, 0x1b72b3744e90a85d, 0x4f0dd0af467bf461, 0x5f7278ebaf448ca2, 0x5bfbd35130c228d7
+, 0xa2dbed417f38377a, 0x7f5dc9310d7d4733, 0x51322a47fc6aa6e4, 0x1af9602f7fc8cec6, 0x3817eb20fdfbfb29, 0x0098468a5266feb3, 0x1d9cd2642e768b1a, 0x744ba3cea5ecc0c6, 0x3db65cd5138a4571, 0x165fdd7c389c01ef, 0xffe0ebc6410a205e, 0x2c2f39da3a1e27dc
+, 0x63f766f4ab9a87c1, 0x7e26aed98d39b8cf, 0xda17923b87110cda, 0x53fa8b01b54e4e6a, 0xdfe09aa4710e260c, 0x3fa8dcf72ebb7117, 0x3020d7842a23b0ad, 0x027af592b9fd851b, 0xfca2d36aca40e2c1, 0x086c4fe85a2c4143, 0xbf4944d563fb0f51, 0x6e4b80119c07ee5c
+, 0x6aa794c3b7b36570, 0x05b3202b062c32fd, 0x566a3a94739f74be, 0x52e14a2511c28efd, 0x6bffe325a2d73e82, 0x707ebca40025543d, 0x72badbe1867459a1, 0x71cc253ee119bef4, 0x42d474812dd9ce68, 0x4e8b18284da89577, 0x955a5106e7252aab, 0x3f18a089b69b711f
+, 0x677da8064d1dd691, 0x00f03197999b3c0d, 0xa403ea0e36a71bdd, 0x327dff0b4e4bedb9, 0xc7a103f1d47b46c3, 0x7a8e0e2fa9b8ffca, 0x6429ec1eeed81d94, 0x51b45c770fba592c, 0x2d93bd13635a0fdd, 0x7ded848385a9f9fe, 0x0fae6986418b07ea, 0x1f67dbbbf34c51af
+, 0x3e499e8f7656e307, 0x404503c528c4242d, 0x580af43197a16df6, 0x4145ef88ce6536ea, 0xa936e4099a4501b0, 0x77388f501df46168, 0x43424133b940b5b6, 0x2633e8f1422dc708, 0x3778c37cf1c66e11, 0x3420405b7126c190, 0x6ab5833593fbec38, 0x2d29b1fb9849bd9e
+, 0xa5c7cf6be79b233e, 0x005312134154a52a, 0x727ebea0dfcd4e8b, 0x36d9a18e8bda703e, 0xf1d2e7091c17a208, 0x546dd409fa98e633, 0xfa1861a246c77977, 0x5e2e68afa3d6ca80, 0x7ca0d648b87b86be, 0x71afc36a0bfe3512, 0x722b38b9a44727e9, 0x110ce932fcab2e73
+, 0xec1c252d6b197527, 0x128bf03bb21a638c, 0x1f0d702b2ce63d45, 0x73b0eb8a18795403, 0xd857b203002c6cba, 0x0e859c7f1f928650, 0x8f2bd8d828ceaf06, 0x216262934deb449b, 0x3f51855ac43850d1, 0x0847a40237dce74b, 0xd8f1ad34b7a1230c, 0x3ef2652b835efe19
+, 0xf9894b64d2210799, 0x2f1e1e7218aee89c, 0x761e1bb04855ef27, 0x104ece600ac747b0, 0xca4b3e6f57231085, 0x0d0c99dd6314a0b2, 0xbcea20a44a03b5e4, 0x609e9cb12fc60e63, 0x84286668dc06306e, 0x4e489f7997534882, 0x6908eebdd4b76a1d, 0x318e1a41301b65c8
+, 0xa91eb1e5309226e9, 0x2f269dc0f1f5d719, 0x093242db53b09182, 0x2c2a21e8e288e927, 0xf67e024e006e37f8, 0x32712e52813a35fc, 0x0068a841be942375, 0x70aaae1b446337d6, 0x289510b340c5f078, 0x34e074f2f20ac670, 0x9367b62723702360, 0x40d562d7328f8308
+, 0x1fb8bca05e986971, 0x02e1dc523033a338, 0x551516ea8ec10a8d, 0x6e5c7052841d338c, 0x36f4bc17042a16d1, 0x1b6f3c8604e90053, 0x43556af492e002b2, 0x2fd29b152d318c4e, 0x936a48b580fc62cd, 0x176e08ce9adb6b1c, 0xae55d74e9ae513d5, 0x7f93f606f1c5a953
+, 0xeca033fd1d91a151, 0x0df2eb231b857dc2, 0x394258c8d88e5017, 0x0981d44ed6ffa9c5, 0x4fd8cb0edc975c0d, 0x0f1438e10969d805, 0x2c5140feb8b58106, 0x38e0eda1cbd5c09a, 0xe5a0ed3b8ec5a466, 0x675acdd9b930fc81, 0x4241cadcc6a0bfd1, 0x5314833adeaa4a0b
+, 0xd00fdc9abd1277e7, 0x08c6f6a63a35df75, 0x04131ce83522ffcb, 0x31f97068e6b78fff, 0x2107569c8ed94c9d, 0x03243d46ebd2706f, 0x143fff795d4287f7, 0x2e9e3949b01b92f2, 0xf3c2e76e047288d5, 0x301ab08dc6cd322d, 0xa3361dbc3954d71a, 0x16e9f5c236d85e23
+, 0x3c61aed462d5723c, 0x3179249be2139df8, 0x7a4e25d5d7b97392, 0x70e4e299d348a184, 0xbd848d7554c56421, 0x25d82ca31b178efb, 0xad06b93dadce3bdd, 0x51d48ea26fa8b2d2, 0x4b824e1374f94d18, 0x486b8f59a0a64374, 0xfcf7547f77df648e, 0x0e9b7d3753227287
+, 0x0396cca4dd250961, 0x12d3a3ef39a4bd9f, 0x7cdd511b55a16b98, 0x47cb0629cf98d31c, 0xcf44f51c3e80c6df, 0x17d7893f92eac64c, 0x1f4a93200fb2871c, 0x3cc353b11293acfb, 0x0cbc139190301996, 0x5bfc5cf6855b0ac2, 0x764530ea70c6a28f, 0x04d4faae2aa9a3fd
+, 0xced2659c992c0357, 0x6516cafda0f13bf6, 0xa6d63173da7e1047, 0x6e4dd1383d7d5468, 0x189f439b8c7c111f, 0x29d69d71517f5bd4, 0x9060c18cdc8b91b4, 0x0ce6020e8636425a, 0x853f20fee0fcab0b, 0x5c355fb5e3661b9f, 0xa8a85b8988b7cb33, 0x065e9ea43910b388
+, 0x594b90474105dcfe, 0x35e962b39f10701c, 0x280b255060e58bae, 0x31cf615257a1d257, 0x77cb451e2a605205, 0x725a8e982beaa3bb, 0xeffe5a96a024fa18, 0x09d2df457f0a1e3b, 0x45af6b1f7a921702, 0x5753dc9950d00bf2, 0x74f71ddeaa8d76bc, 0x6396ebaf604ec642
+, 0x5eda3b21101501a1, 0x5d89081a169fd64c, 0xa7027737ffee2ebe, 0x1e3bba6b064612d9, 0x93a6d1f78d7fed05, 0x6afca495e707a9ae, 0x39b328c096c652f6, 0x06b590768f793907, 0x7a1b3f1873980ab7, 0x0b5b966405ba1b62, 0xab096e46bf672143, 0x331ada137c623160
+, 0xdb10272dac19bcde, 0x62ca8553a374b9dd, 0x667354af422333fc, 0x1f174ca59ca7b6d9, 0x16dd2f1a52c8cf0c, 0x535cc63ea46b2645, 0xa6e5f07e82c2ae40, 0x289c6e0606f656f1, 0xff486848a696fae4, 0x73e31fb0dcb4368f, 0xddd09ea3235af655, 0x4c526fa306b0c600
+, 0x148e7aded4e1e544, 0x7bda745c216d9b8b, 0x41014f9a22f1673c, 0x1f3ab6d466db16a6, 0xc4de94ffb05ba059, 0x31e9fafb9e277d1b, 0x8d04e4c276458789, 0x059e2733c2611077, 0x40a1817aa29da6dd, 0x33aeefbd53a72d7e, 0x2d4a33a5ee41a4f0, 0x62b5638f1b08ad92
+, 0x99c414ef9a8a2803, 0x4877a3c7a16f3834, 0x1dd69155958bf6eb, 0x70dbd969120a9071, 0xe84227628df5fd89, 0x3aec6d423b1b90d7, 0x725510cc134049ce, 0x1c94a1cbfba46de0, 0x23a2b457484b625b, 0x79305b8d2f46bd61, 0x582ed5a2573be063, 0x404366803f49431e
+, 0x5ef46c48cdd75b29, 0x0ecf2e5b7e17350c, 0xee196cb13eb278a4, 0x0509879620ad21b0, 0xf385e3537ca08ebf, 0x6a49474d7b4673c8, 0xae7fd64cc6f882e2, 0x33591f695bae9de9, 0x05838f9c2817e798, 0x7832e809be61af5a, 0x4a64e927e5a174ab, 0x7972502cb9eb658c
+, 0x8aff45cf8404e9c5, 0x2ec34c54db589c9e, 0x26f218952bf93f30, 0x5b27934a8ac21b6f, 0xdf5bf6a2c484a15d, 0x720c8726d8f408c2, 0x7d5c6c168a5dbef6, 0x4f619abd0fbbd076, 0x0061d3e6f18e665d, 0x34493a59bd437530, 0x8cae567553f17ec4, 0x41038912e032064c
+, 0x9e9b173816b25c47, 0x1f6e54ebeb454ace, 0xba76b1cde6ddd598, 0x4450237bd6f31436, 0x96cadb96e61a26bc, 0x339d75d886913a76, 0x7861e239bb3a0045, 0x18025a120345318b, 0x016b6128e549fd33, 0x0025314d6d560e9f, 0x10ab2790f94d2790, 0x7bf106da85627b53
+, 0xaa2515d7db41b82f, 0x15a85a69e7bbb326, 0x2b01c01713d07e44, 0x316fc77e215a9e5b, 0x7e51a0af90517fed, 0x1d1aea100779d5ff, 0x6f02d4f6cf70c1d4, 0x68a349ff23a6d8d3, 0x163b0dbeb145e386, 0x56c31aed2c5fa42b, 0x2e836db3700dbb06, 0x7174ac2a06fc70b8
+, 0xf7020e597d2f867c, 0x26188400cb425e75, 0x47d48c110668eb11, 0x71be08640f9d2dcf, 0x7e986c00c388cb0f, 0x127bbd8369f3f127, 0xc302a35b020a4ff7, 0x0689a6d91ffc7a14, 0x192c845d2418a507, 0x1c91ecabbfe40298, 0xf698fd626068469f, 0x63d26e48a9a41c07
+, 0xc6ada7664552e9f5, 0x1822ca1e3b6cfc61, 0x7dadf54f0f172c52, 0x595cb70ca63442e2, 0x5b0233ed454161a7, 0x14c99f4e624567ee, 0x7dffcf4281e804a6, 0x1aff8ea3b6980ffb, 0x9c36ae6d5cf6a94a, 0x529998b17b7b44b3, 0x2bd7f115bacb54a8, 0x1bbdc60567e60c07
+, 0xdbd4320b7444aeb8, 0x531451a10a6adb85, 0x93cf48617174e944, 0x20469e93fb97bac7, 0xaa4d74b0781d8e8c, 0x14015970b63b9a59, 0x9723acd4d52a1476, 0x12f000173fb2057a, 0x39b3c628e89a632e, 0x59aa6110d432cfe5, 0x78e2c5a13b9ef4a0, 0x13d07a0dd35ac9c3
+, 0x68da765304323229, 0x64286892b4a8388a, 0x7bce07565f2d7fc2, 0x0bc5adf9097e1367, 0x6352b4c8b40730a7, 0x580a6db92a610faa, 0x605fdfa4059a211b, 0x787116ac828f97d7, 0x74995d0829d9c808, 0x24c79ff82a67e8bb, 0xc707a4c7a3aad7c9, 0x21934cafc3dd93e9
+, 0xb97219c0b795a4fb, 0x161b94d3c5e06c87, 0xfa4204ee9def7b62, 0x5ea7535d4b887427, 0xd9a02cb954138066, 0x2998966573367edf, 0xb64c12a870b07130, 0x6ae9156ece60e901, 0x89696b25c8444511, 0x006d21a14bdca49e, 0xa4f9d6fb7f7e9bdd, 0x6dea2c424b502e56
+, 0xd460c6ab001f79de, 0x11ba01ea727591bf, 0xc0ec289580a48bb9, 0x4445f33b2a28e95f, 0xd025785d750f0bfe, 0x7326d6151e0c2a14, 0x43c62c94774d4d3a, 0x42ae7fea825062e3, 0x9608c2804efb412a, 0x701b6d57f4a4ba93, 0x4ed2fc10df402556, 0x09f81c24f39a4520
+, 0xd75023101cbf7f3d, 0x6f65e8d8d3c15c9d, 0xca17598be06c4d1b, 0x41819b47bb5de13d, 0x2612cc046a12a932, 0x5851815c51a65eb2, 0xf35b0e13e19a64ab, 0x78414698d3d88d5a, 0xbb88aa68d93db597, 0x49b247da4ba5c50c, 0x9db062c642496c0f, 0x5f4a91bf83755e8b
+, 0x7a8b2e44eac108de, 0x4b6952fc851f9bc9, 0xb58824775b58d220, 0x788fb91a17235519, 0x8519fdf1f8a751e3, 0x16ad34962cded6dc, 0xde58d986250dbfc4, 0x04e6f74b3c8b9707, 0x4f25988aa80021cb, 0x694b5f101f30b924, 0x40843bc420137d18, 0x335f6c839445ce17
+, 0x50dcd14773a58237, 0x259869ecd2712360, 0xfebc15a297f2c210, 0x028198e77782c908, 0x2092e7304c6c37fd, 0x4230a81fd4bf0146, 0xeda132dff090dd92, 0x602056526964f053, 0x81325b1545f0d954, 0x6b9afd5cc08c6652, 0x5fc765dc2be2c748, 0x5dc7542279adb3a0
+, 0x7f71301af102e862, 0x37ac05c5a351aa77, 0x921e5585d6f00aea, 0x465f26f2ec8b6c65, 0xbb10d4c250bced50, 0x06d3c49e95074b71, 0x09c823b5665953bd, 0x0eb2f90a1b63d688, 0x9282ed8b779571ed, 0x067b9f63d1ca15e5, 0x4a4ed21e8b3f769e, 0x62a6f54c6189e3f0
+, 0x82508effced95472, 0x43669170a826dbfa, 0x653c4edc216e3160, 0x4eb9dc5d9bb3d807, 0x196a34104c2c166f, 0x1741dea0f4834746, 0x59f843a892716a47, 0x43b95ee5f1478a37, 0x87d5d9ab1c939e48, 0x044ae66058ee0a1b, 0xbc11197dba0882db, 0x13c547494ba0eb10
+, 0x3261bfd2c0a08f32, 0x7ee375773f1c322b, 0x2b39d64679526b66, 0x7d83d768fbf8eae0, 0xffde5c0139c0d28c, 0x5e87f6a1232de8ba, 0xe45e10ea337c03fe, 0x6e2af5d813c017a5, 0x1d7733913c4fcd58, 0x4e93b2217afb7f06, 0xa7fd15d126a632ac, 0x5bb3162d4ea240a7
+, 0xdc6fa6d7a97142b0, 0x5052b05a742a759f, 0x6d3f4ca9c7c4af8b, 0x349cb0779ea01297, 0xc09cdeeb5e30da25, 0x216d9dbaf6fbf3c2, 0xa60e7e2172e22d2e, 0x204e047227688ef8, 0x1c2c76b628857200, 0x4906e4b0656449b6, 0x682507459007ff42, 0x6f4105d826fa2adc
+, 0xa2e9e08775212cf5, 0x5f7b082d80dfb88d, 0x9c4c8bde93bbe19a, 0x4cec7437fa6f057e, 0xa0c813303d0ca623, 0x45ec39ce907bcb03, 0x15a5274548cc9fe8, 0x36eb1ae88b5324de, 0x26804d0d396cc5ec, 0x11a7a98c6bb59324, 0x19bd158ff8878f89, 0x47b0887fb17365e0
+, 0x05041c09bca2d88c, 0x333283044d6849ed, 0x4c25e5cd2cac31f3, 0x76188abcb4d87707, 0x9d01668266a52238, 0x5f96c1acbd78d623, 0x9df2f698439a3a24, 0x4c17d1cae48e1d0f, 0x4e9ed34d7e14a1dc, 0x023e20e4ccb652cb, 0xf675374e78a1ec1e, 0x314d89c8a284f7e6
+, 0xe5956a8216776237, 0x797e2153a8480f23, 0x3596b8b5106b336d, 0x37d6c9deb53ceea2, 0x9e19c5130f33f1b7, 0x42ed1c34ddc68188, 0x78d7b04b1133a513, 0x053736215a47eecd, 0xb620ceaee581d7b4, 0x185a66d75e4eda1a, 0x5cc086b293abf3db, 0x1b4f2ef9a33e576b
+, 0xa7c7bf4d8002f1e1, 0x68cdc98f6daab435, 0xff7bd02b1109e06f, 0x4305ff94ef89265e, 0x0130397c0e92f9f0, 0x6fcf77a67192808b, 0xd5de34fc464a0803, 0x344be272fc23f40a, 0x1e10bdaf5c62f27e, 0x45037327a890c306, 0x042b379176cef535, 0x4fbb9a3cd293836c
+, 0x91be9c7ec7ce5942, 0x2b38fd83d723e227, 0x24faf5d06bc84090, 0x366299ecfbfaa979, 0x5cccb67e4b66d134, 0x587ec4a41ba3c990, 0xbb372adace05bc47, 0x5bedc256fc55441e, 0x778fe381137810bc, 0x0f759ee7567563f9, 0x2c38c6a24be8c708, 0x692e8259b0eeff54
+, 0xed654c3047087373, 0x6822bb67d51eea37, 0xfbfc1ded25d9bd84, 0x522f73ef39db5921, 0x9934145526bf22fe, 0x6dbf490d0919ddd1, 0x55a2709ce6e147db, 0x62838ffb7d121130, 0x498121e397385af3, 0x6401d65b7e7e5e90, 0x5a5b0731ab4a5b80, 0x48d7a1685deb1802
+, 0x8f4985a3ea3caf1b, 0x43baea3c5663f85e, 0xe187ae9a185d2f85, 0x30d6942de8ca2b10, 0x3026789a0422e579, 0x1c23cd67de252bd7, 0x48474232d9107795, 0x4f4ed150853a8696, 0xa651012ce16a01e7, 0x37de4b3b449bf002, 0xff2eaa83804861aa, 0x57328d12a1b82d66
+, 0x42cd200ce9a789ed, 0x183e2d6b89955039, 0x99675dd978cc7d6d, 0x497009bb5c9d11b1, 0xb8e22c721f4d0a5b, 0x57ff6351e014cfac, 0xf2f83967ffe4094d, 0x00d086a35e44b9c2, 0x0eda91c8be57d838, 0x1371f1b2e93b2662, 0x79b97410e90f1394, 0x2a0322e0518db3ce
+, 0xf226a261acce801c, 0x37f4e0c7a306177e, 0xcc902d0bc6eb15fc, 0x2a03fb1c63033584, 0xde64bbcd3c92ea8d, 0x2b1404d3c5888fe0, 0xcd4e2b4869a0261a, 0x6199670a1591c9c1, 0xe188041c9e661458, 0x018eca2523486d52, 0x52744a8acb82e123, 0x171c59698ef86f3c
+, 0xc37d2063adef9910, 0x70d631ec44bf66eb, 0xf9a56689fab4e5aa, 0x1b1b814a65c05869, 0x66ec181e3aad2b98, 0x1268be97549994b7, 0x4b4e607cabdc8478, 0x583e37ef52b730d7, 0x30cb9c99e4a94747, 0x4bb7e6393083badb, 0xdb0c61ade9902b29, 0x055a03aa55e13530
+, 0x63c01c80c74db882, 0x5a59596967cf7b56, 0x1d25ba14ba9dc0b2, 0x0c73e1c9eb7dcf3b, 0x336006ba19956405, 0x266ed7f398cd3c30, 0x470c91c3711adfd7, 0x52f4ca20c4457e03, 0x7fb0493ff53542cd, 0x56dd6c859d2002d9, 0xf577b22007664add, 0x217241efde0e4a32
+, 0x0e7d6171a6ee8998, 0x388471ffb99f7dd1, 0x5a262fc2767f5b09, 0x0bd9f0d9355c506f, 0xa34affd14b455c31, 0x7904114ccb00d7d3, 0x34352d84b4383e2e, 0x5d009e5cf2c84380, 0x3026fe3fbc83957a, 0x508f570e3215b0d0, 0xdc5fd3f01f041e04, 0x64d4896d06a6f8af
+, 0xf5b275e6ac30f5d0, 0x25aa18a468f83e62, 0x9ac11b2297e1b10e, 0x53dcef6b2176be05, 0x2b6b73f21c03ece0, 0x22b7a34ba8635275, 0x5ed5100b0e019d8c, 0x3ad4f7816cfe0bf9, 0xa5ac393698bd233d, 0x756bdd4e755c49b8, 0xc37f09c8ca0fb35e, 0x1394c3644f0c43f5
+, 0xa67609b1aabd1a69, 0x7c450081cf2ab6e3, 0x6a5cad4779d786bd, 0x265608bfed041428, 0xbb02f5659fbea938, 0x535a90b4f23c1565, 0x1e44ad6d4f723125, 0x1eb9750fa106645c, 0x64b7f9613763a2ce, 0x54a49bdb30b4411e, 0x00389bb281661e65, 0x0a42faa55b88cada
+, 0x3023c4bb4e1bf621, 0x0fe45b1d479c6c15, 0x37740ef422773c75, 0x352b02f72125f333, 0x4736aa64913cbc38, 0x774e6f829cf6c1a5, 0x2df869f563900d1e, 0x6cfd2e13897923af, 0xa2d1a5dd24df37a1, 0x1ac9bd970e11ca14, 0x91cb5632334a340a, 0x413384a8b06e1792
+, 0x366bf8f07b83c944, 0x5b8c00fd48297bf2, 0x4f22308c7930cfa3, 0x0b3e966f73be85b3, 0xee7db2d5f42f192f, 0x3bcd7038f2f93b4b, 0x9264dec6c7a304fd, 0x30857513f3480bc5, 0xc549dbb9418782a8, 0x4f1fd71be9e25251, 0xbbcb7e02b85440e5, 0x4f0e280e13fe3fcf
+, 0xa469ba547082593e, 0x004d526cfb691efe, 0x2c173b99cc75b52b, 0x543b8e983b95a3ef, 0xc689bf4530402cf3, 0x511cc867cf188f38, 0x580169d1ba01d816, 0x3701241f35497d2b, 0x9bf6662cfb16bc00, 0x751e3144266438da, 0xeeeb1941996c9884, 0x0be1e3108f98923f
+, 0xc1df0a759f78814d, 0x3aa5ae99aa42ec00, 0xc0d95cf9fb630ec2, 0x535859851160bdbe, 0xdd415f5fa70ab4da, 0x1a8c410b60e51790, 0x62f89d1a2632669d, 0x62a6eaa78b7c23d1, 0xbafaedb7d962e5f5, 0x653d3f5728295ca9, 0x3d5e4da73973b4b4, 0x672461121ce37f03
+, 0x8c6b7b71fa10d349, 0x0956887ea67c30b0, 0x426290d5fd4819c7, 0x423cc25dc8ab601b, 0x6b81c0b2dda65506, 0x3d25802d669aeae7, 0xedf63c1422d2cfed, 0x0697f69beb50ea68, 0xf1f0a357d4169d48, 0x3c6aaaa461b59a03, 0xa96b1c701e072dad, 0x54088359695d64c4
+, 0x51ff43b730bd99d8, 0x0f5d03b54d3a902d, 0xd4cb58feda2e5c30, 0x341b5c0a9b3244bb, 0xbfdb238e78ac4fc9, 0x16c8043d4da1f6b7, 0x52419671f22d6432, 0x04bc5610fc0a7cf0, 0x4b513a50b2cc372c, 0x69b5cbb675991229, 0x2fdc802043cc1602, 0x60252e8ea81ace79
+, 0x6860689cb5cc81ee, 0x09832d9a14c61e20, 0xba49dc08d8a3ec2d, 0x547de0ed68e39878, 0xf39d9de606c6f341, 0x4473aeba162e220a, 0x8349a52534d12427, 0x70ea9057be17e7ac, 0x1a5a37b0204816aa, 0x40f93b865ae4b3f9, 0x79d232bef1f6c874, 0x5e072814d6a8689d
+, 0x4d5c95c6b222fea3, 0x2b0159db1f9fcaef, 0xc355ede77fd7c6eb, 0x512cd1a5216fe5e8, 0x2a401c51def68373, 0x7a44594e76b00f6e, 0xe989d97caef5b122, 0x3c102385622798f0, 0x3b60d6e7f476bd62, 0x6abd5e09fd5e1e3e, 0x4dc46bb80f18da1a, 0x2e8bb74cf38ed1ad
+, 0xf8c6f54f96eb4972, 0x4804295a75f51074, 0x458c0a55cd8027b4, 0x206074401333b629, 0x37554439fc240a41, 0x657aca73ee7e72dd, 0x874aa0761af29c5b, 0x49a259c42ddb4077, 0x879f3357bc1ebd08, 0x727bda4422a1a6bf, 0x67ae24d20f59d56e, 0x7c3112c2bb3e6256
+, 0x7f76a0ee7e958c98, 0x6c8c70e10e951bf6, 0xb665a5f2491c4d5d, 0x5f9fc77a63ef2d7a, 0xc92f423345cabbf3, 0x30878ddb8b954bea, 0x15dd6892cee6fb52, 0x73efea32f53d940f, 0xfdb773d6c31afe95, 0x28b8be3f8a19bd67, 0xbc291dc9f3267be4, 0x30e5c3d40112e65f
+, 0xd40a23b0b277c0c2, 0x1028991b5d2f92db, 0xd34a4b188eee7253, 0x234b213be8e74abd, 0x3c5e7bff9012f604, 0x26aee5f3c00c8460, 0x4b0d732b17003beb, 0x36b145cdbd997191, 0x5f1d71923f5687c1, 0x2e82bbfd745cb036, 0xa3f72e3e1027dd2d, 0x28ee47d98f97ecee
+, 0xfe0758a9f6d0e626, 0x49a029036eb8ad1f, 0xdc70abb6d5baa114, 0x2c1ef575b5a0549c, 0x6d8552a9334d6bf9, 0x74096664f450904b, 0x5784c8eaf8a4adc5, 0x3201fdf7d1ee1616, 0xda3df7f2d20ffcfe, 0x2192dcb226ed8d02, 0xfdacdb11440950c6, 0x2af643b584049b4d
+, 0xad1aff81f57dc284, 0x797ffe1a896e069d, 0xe12aaede08e778b9, 0x1029505dde88caef, 0x1f7b2fa7ccb7f05e, 0x4a19108a839169b9, 0x8f299d1e33306cfd, 0x0bfee9c7347c67bb, 0x9fd09d3a9e50ae4c, 0x27a776c5c21c599a, 0xc2f78b31ecccca7b, 0x63aa181808d98fd7
+, 0x38b0e6ae3cfac3a9, 0x263c58812f0778f3, 0x98584eb84898f01f, 0x68f46a58539d890c, 0xbb1e1415c62b3fa0, 0x5b1a4fcbfc8b659b, 0x27f54812f64f5ac6, 0x1d26c9808758a624, 0x2793a267811b4849, 0x06e70f7ed6fdee21, 0x41fe9b7fac9fd200, 0x4694ec349b4c8d1d
+, 0x5eed9d66aab7e2c7, 0x5267c495e4f1b09b, 0xe6dbfe2bb1591a2f, 0x674b20d78363645d, 0x27a9688358f58f3d, 0x45aef8a516825e85, 0x6fca2ecadf9cfbb4, 0x2e4f80d48d1e839c, 0x7b5f54eb5dd50b55, 0x28dc57e0c8e4e786, 0xfc3da3af05160d75, 0x234041589476505c
+, 0xd69251033dbd4866, 0x1897b34e89c44e63, 0x4a5af2da2af27279, 0x3b232e0cc50b53eb, 0xd96b34094c05bfea, 0x7761e07d31790ad9, 0x811f6ba35a8cc62e, 0x4b3f7021a157a713, 0xa7c6e4b899f7a3ac, 0x0e29b04526523e10, 0x9cfefcea30ad338b, 0x63820d5cb8cd5471
+, 0x3ef165ceaea76284, 0x7131ea4a91d6c086, 0x437dc7e7ca42a6e8, 0x3b5a8fdfbc3f15c7, 0x25e4531ae167d37c, 0x140b6b2581c9ad2f, 0xce1414dc099f9404, 0x0e4cb1581053d60c, 0xf5ff1112bb8d2338, 0x5e939303dffea105, 0xf6bfb235c7276c33, 0x7f06e4612839bdfd
+, 0x614004cb201fdb6c, 0x088e7c2e14a370a4, 0x96bead69055cc493, 0x09f56c60d49ea68a, 0xfcb2786009100c32, 0x2c5f3ead22377dd5, 0xea47b558883dc1fa, 0x4deae41c28365616, 0x2a8770dfc1d570fb, 0x7bc7d7546b897727, 0x0dd5fe03f7d1bb8b, 0x04ae3da3b7d02a3b
+, 0xab9f066a80bc2865, 0x27e53c66ff0d8cb0, 0x307b5075b56715f9, 0x3eb41d985a7cbc41, 0x77a3b99445a2b5f4, 0x659d699c8487e6ea, 0xd85d95c5f19ce44a, 0x7a3a48f17a55fff5, 0x5289ec2255938f57, 0x70d7a501cecb67b9, 0x11be206b1f8bddc8, 0x564f4848bf529523
+, 0x4ab7d780dcae50b7, 0x752b6231f79507f1, 0xb1bc24a3a3c409df, 0x61c70b03c3a6e013, 0xf8c1dbf650dafe3b, 0x7bf1ecbfbb70a1b3, 0x32bfe525978c8716, 0x605f76508579f760, 0x15c43f7ccdfd5187, 0x5afbaa4070e71314, 0xadb9c683defcf0e1, 0x7945f909dfce88ad
+, 0x29eedcca1e2a094e, 0x0a6363666d06b1cc, 0xa2bbb3f15da1224b, 0x5454b66bbef9e769, 0xc8982665b9bdd279, 0x33a936d47e1e95da, 0x4d3f4418c32ff283, 0x21092412bbacac75, 0x2d5c2f910ef77067, 0x255c3adbcf8b105e, 0xa69c85a2b1c81aaa, 0x628cb822b00ec4a9
+, 0x476bd3d8efde09c5, 0x259e21483bc9e670, 0xdb7be11380d9c4e9, 0x3d4fbb4ec52b9c1e, 0x71d4fb665577cd13, 0x36de69dfc5824477, 0x364bdad493e3704d, 0x73ceb7bbb239cac4, 0xabab6e1862c2a800, 0x29400a9a375b7075, 0xe5eb4044da2f9487, 0x1ea4fb0f37678eba
+, 0x9e195744c21ed46a, 0x710d8fafd1840e41, 0x542cdb720f98e377, 0x44b396ff8050dbe3, 0x53bffd0a2a147d71, 0x610c1a9bac4e410e, 0x5b7c82b87f47d447, 0x3aec65da12306a84, 0x48ac7de043054c32, 0x419104e14eb491a9, 0xa2df9b47d9892265, 0x04c0db626e58ad54
+, 0xf5f091235aa4c509, 0x71c6d8ab60962148, 0xee0ebde7d38f8ca2, 0x592627613d0a35e5, 0xecbbf1bbe2298d04, 0x5f4e913b5a67d05f, 0xc4f78f199bba7173, 0x4bb87c4b4198784e, 0x4a264f2a9d4452ae, 0x799600d989945aa9, 0x297715438b861005, 0x31b57604bc41bcc7
+, 0x42f0840576a17a61, 0x7729a5eca4c79f50, 0xa290d32de05ebb30, 0x3b968a075e3a06aa, 0xc569e8c67669d1ce, 0x3acfc6eb0db24187, 0x70c21932a9dd4b9e, 0x43206b6006c82d4b, 0x04ee5d6bbe6ac280, 0x6904193f50a65fed, 0xa4a0d441405b7a5b, 0x561446e842dc5d80
+, 0x3d49325e9183e7bf, 0x18ae5a048ad60dfc, 0xc39f25e1ba4bb815, 0x54e5214494fd38c6, 0x812b12ad869f96c2, 0x3427df7b2fa094c6, 0xf1c78f869a84c5fc, 0x62b320fa5fbed894, 0x1b40c7fd1f12ce3f, 0x7673309fc51ac759, 0x7795ab9ec20d612b, 0x50b9c9a97ed9a472
+, 0x5a08b69fab2fbc31, 0x0ef06fd47aa8a565, 0x5bc2382da26edb6d, 0x5b88373d0e768cd1, 0x541fa303dfc4c072, 0x589961fa16d6162f, 0xb104d97c370b9424, 0x23c00be1de337ddc, 0x58fcb8dd95f45ea3, 0x0c7b67d523a4118c, 0x31128809f494ac8f, 0x1d8de5f1951b0b0d
+, 0x2422841c892e1e44, 0x0a5693804aae77af, 0x39334673c0e65f95, 0x35ae80503eb3a4e6, 0x6c4bc66bfa2622d4, 0x55489f26a1560db9, 0x8b41859970d93f96, 0x442011e307b816f3, 0xa747901eb86ba95b, 0x750c27c69efac3b0, 0xaf1986939c64e943, 0x6f6270cb305a0242
+, 0x5487f47a4719d3da, 0x174f8b107fc9bf2b, 0x063e001efb6678f6, 0x05c38a9527298b5d, 0xc6957cff3e0a0071, 0x4861d4e217e4795b, 0x8d239bf8c17a256a, 0x42baa37f958d2481, 0xdb42fc599a25dbbc, 0x6049ddcd6391ed12, 0x5e86d22e4d2e9042, 0x3d8980ee214a9924
+, 0xb2be52a669628d58, 0x70d2db7b95c6f7a1, 0x73fbf72e86fd4cfa, 0x728f7e455a66669c, 0x84fe58e178bf5303, 0x027082fa2b2f02dc, 0x119fde032546a9b9, 0x788cd832f5439166, 0x2e3b57a55ee14fc8, 0x1241e7cc820b9d5e, 0x91269b0556b96f11, 0x3a3d620508439f6c
+, 0xc3842f21389932d4, 0x0b2d381047128c69, 0x176d9743955275ac, 0x6a6bc006a185f6bf, 0xc917b5f84a028f73, 0x7cadf65da8ecfa89, 0x2dc54cc31c657675, 0x7bc7fa6e9fc18d60, 0xa1a46558b205fe49, 0x327f470d87cea5b1, 0x0166cd909ca33395, 0x1902e08f245dd2d1
+, 0x0163b5c9b01fd534, 0x06d499157ffcca43, 0xf5c4b25ff8fbbb12, 0x6fab4cd072327f36, 0x3b3365a75e246198, 0x69221ab5b8c8082e, 0xdf215363549d0deb, 0x75a3e070ee714e6a, 0xf4b522f37aa9bbbf, 0x28b9a4cfc5ef363e, 0x6eef1c4055d83359, 0x2ff38dea71dad2fa
+, 0x3a90cc252eb7b4a8, 0x2625d19149e1623d, 0x8248c1ddb1fa5331, 0x06c7662244a58bb1, 0xc81d69824f9c7833, 0x5cf15b3ad0ecf7d2, 0x44c3261c1903c597, 0x52a95fe39a0ec35e, 0x738205301f45ef54, 0x1c80670c894cf92c, 0x21877197160daf0a, 0x7b7bd78a8f3cfc6e
+, 0xe8429db2b74bf241, 0x3539d2088ba1934e, 0x020341d3a2664f69, 0x442787bef923c27d, 0xcebccb7188ecce56, 0x676438e4c5c1707a, 0xd645a6db763bc772, 0x3762b963e8f8e255, 0x8590d7bf2c2c2f8e, 0x57205dbbb20c2acd, 0x20ba8a645060836c, 0x16dfbf8f234ad45e
+, 0x5f0bc4ffe406303e, 0x6a730ce7bddeed28, 0x9fdeadb7cd4683e2, 0x3d10adbb37cd1fb5, 0x507bbb1ca89616da, 0x7fa0be911102142e, 0x27fb0d8515421481, 0x2bf8b6ae070ac092, 0xa44ab81fbad2d39e, 0x5cb949e47f48fa3d, 0xc61f3dc6a80218cc, 0x786c2ac1a2d48a42
+, 0x31abfa6255efdbaa, 0x4f0afcb785383e1d, 0xa21c56578cfe95d3, 0x75c391028dd861ee, 0xff79135e38e19b5d, 0x24995c55e956b96b, 0x4968ed320f9da097, 0x273e58661882825e, 0xd816391919ab9ac7, 0x0fd9dca8874e64b4, 0xda4c93d167cd7385, 0x5be138a126adf9e2
+, 0xecc9e68cf2c65add, 0x181a4ac7504e926e, 0x00cd3ecdc6063162, 0x2039cbde9666bef5, 0x8809a91282d8d98c, 0x1ee5698bf173dca6, 0xd1b254dc32d34bd4, 0x15fcb7d3d08fdeaa, 0x9e21638fc4267ce5, 0x1c6faa8f7580d743, 0x8c8c0985f57dd4c6, 0x69e05e6185571326
+, 0x022c63bea58b5531, 0x66149d4c788193e6, 0x827943563c800ff0, 0x19db29101b03ab2d, 0xfeaffa7f4ce6dc82, 0x77eec9639e50fa25, 0x3a42af5222eb3d48, 0x5d8d401a05e51c34, 0x076dc1881705f905, 0x176d25a32c69a12a, 0x39d579205e9e6686, 0x39d017ce89ad5ee4
+, 0x4daf02a76dca3364, 0x546f9f683b0fd6f4, 0x7407c4ad9d0a6eea, 0x79731f758a01673a, 0xdd827850a4ee99a3, 0x18c61403df76cb96, 0x20ff702ea7eb9471, 0x3f4ac57c3e0bc743, 0x565b449cc1054a73, 0x43f900404f1e5e57, 0x0dc7877de2803cfd, 0x7156818cb4caed33
+, 0xfe59b5219027683c, 0x58a2c1e051714eec, 0x15f30920bd7e2f3c, 0x113f0442654a68fa, 0xfe05813389dc9aab, 0x7a05c2b965338a60, 0x70e9f45c22e1912f, 0x4910ee774e6c05ab, 0x7ca1cb623a432ba6, 0x2133e093b0408d40, 0xa9140352ed0b2e76, 0x26c08f0a4aca6dbe
+, 0x27a7c64080d6eefe, 0x4b2cab8cfbfbf9a7, 0x83b0f8e0b9d7f523, 0x1b266de69815c33c, 0x20e690eb8f238151, 0x56ad084f2f0168b2, 0x1f2e8f4a74670ae1, 0x6a9daf08893e1cea, 0xe1611e406d06befa, 0x496043a55c62928e, 0xe4ee023f80ff895c, 0x5141a682aaec3f54
+, 0xacbc7c056e858727, 0x475926031def8d53, 0x1f533cab4a593faa, 0x0bb3c9b4cf6e96ec, 0x2ba3ea965a7654b8, 0x2a6f5a7ad926e3d9, 0xa6ac8112895c642d, 0x71d9f795a7638fa7, 0xdb42883a7bf485e0, 0x388c0fe5def99b1a, 0x8d378a987ec68ef6, 0x2036fb3ce0149c73
+, 0x130f720c1d2db5b5, 0x5b718600fda1be3f, 0x9d4648fcc31c27ce, 0x5ccd67b69b014226, 0x09e4da68fca17823, 0x28ed0f58fc8a6660, 0xc563419437620aca, 0x79b389d5aaf29c9f, 0x0d53f6f1ad85e29f, 0x0a9ea9193a68c7b6, 0x577ac3a65beb7e3f, 0x4047c831a6ea07bb
+, 0xc76dd2630c30e550, 0x3d8fa6a84dd996c8, 0x5a26a6589ac08cfd, 0x47a312bd30d26f2d, 0x16aafbdf66ea2325, 0x2ab7837ed72c0efc, 0x8643598d5b2bcaf5, 0x0932a3da9067228f, 0x8e594770dacb4c71, 0x15e046b85f2c2e17, 0x67fa1518007ce3c3, 0x0b3de49ff7c54a78
+, 0xe8d02840a3a02132, 0x5d9a49272c11b0da, 0x9b596b41fa124807, 0x3bdc3ae3e3457374, 0xe7bdb559da357696, 0x608857ce2170e48a, 0x88270b8a59316c27, 0x20f489810b6ede76, 0x19eca7f90b9bb22d, 0x0d3bdbb110f10a53, 0x93e40b7efffb0e2f, 0x39ba1174f828e3bf
+, 0x4dea2beac927ce60, 0x4a1918cf1b3e7750, 0x39ffa363d3715076, 0x581770cbd5257479, 0x112190e0ecc3c48a, 0x4cb6cc73e75e3db1, 0x743a17e0bfcc0edd, 0x6d6fd24a3652ec3d, 0xfc193f40b0f25f4b, 0x2c3d9083107466ba, 0xc923340b609172f0, 0x6ba310b688c117e4
+, 0x0b9a0c0c0c6444d7, 0x0cfa8331234928fc, 0x7c397b8427e678bf, 0x20a2ece6ff418c57, 0xf528843c3420c01b, 0x0ae432002746e9a8, 0x69eca3b47cb15b4d, 0x62c5290972aabfaf, 0x3f12652f03a86d2a, 0x07a7a5d1d0ba10d3, 0x563c1c8981c8db24, 0x553cd2d58f8a978e
+, 0x6296a412d0fd8bb0, 0x33d1cd1d104d3217, 0x5111e95473fafd4c, 0x09c7c34e9c5abde6, 0x88ff26311230915a, 0x7db5be9a270594a6, 0xcc994244414cc6b6, 0x6908bfa096ce27b0, 0xf8bb4dfb04c58859, 0x5585da08a7b785c6, 0x9f66eb2d049604f0, 0x0288422cc2483d4f
+, 0xe79084bf3c2e2c3b, 0x1697bcce319f69d4, 0xe0af6b58485e27e9, 0x0d0915a642600447, 0xefabb3d4fa1b855a, 0x465f4fc3284dd50d, 0x3788391f2fa8bbbc, 0x33dcab2135ae6760, 0x40329a2b14fc272d, 0x07f7f7491292b678, 0xfdd6cf8120b627d8, 0x2943b2f8ac30d04f
+, 0x9e3538fd9655cd9b, 0x135e74d9954039da, 0xbe23f948bd093ff7, 0x38e92b65458af848, 0x7507eab82b53315d, 0x525d11e2e572d4ba, 0x3602a624ed108032, 0x309db17fb9860514, 0x4d6d171d15c6501b, 0x69c7ca3da953a10f, 0x4f8e598ad687b612, 0x217fdb56dff40f87
+, 0xc5bc41ca353c7fed, 0x3375ce3b4ba63c03, 0xacc551885c944c3f, 0x4f2f44e613c34c67, 0x455648315d8fd98c, 0x1ae30ac3bda429d4, 0xd98535bd0499e246, 0x5a6836cffc5439d6, 0xecedff236574e1a4, 0x00988f294dea001d, 0x64a59ccb475989cb, 0x365a00ef558db381
+, 0xaf65ce9c9a9ae89e, 0x39aa7e8ea2f4c628, 0x41257808757d378e, 0x6871bf3d5f224546, 0x53fcc47031ef45f8, 0x2e44f51851e77707, 0xbe9db91e4e0dddd0, 0x15f8b7a115f31249, 0x259a0349d49da4f7, 0x31311df979a4cb63, 0x30cda94a49f34589, 0x67d65a6766752147
+, 0xba84fd257b059428, 0x0f30aa86b3a36c5b, 0x57040ad44666f6b3, 0x45dd4887615bcd82, 0xd3f4334ab0b52934, 0x0e296341e5fa42d2, 0x1462c45f4d4c5626, 0x146b701939090d03, 0x892d177ead389871, 0x2be3f6c3131ed00a, 0x0baea5f0eecb8fb8, 0x5ef7015b6c872492
+, 0x930ce09231617956, 0x3dfb4e87b79c161f, 0x5185eeb58bb2aba6, 0x0cee37e40b4107cc, 0x950dc9216882d0bf, 0x2e64308f5414ec9f, 0xd3141bb1b9fd44b7, 0x4158e8172ea2a94a, 0x27909090c290a44b, 0x0c7b368b5474e533, 0xf8beadb4c70f1c26, 0x610a680153de1e4b
+, 0x49a70681df0641de, 0x1df731e8cbe0f3b2, 0xeb8740069e457c05, 0x44a35d558b65f51d, 0x8f5cc507ab021c2b, 0x6217c6e22a842283, 0x33ad19c8ec486ae6, 0x5448b0714ded1304, 0xf3d0bd299d95471d, 0x7be5a46f09aceea9, 0x05efc069db8cf3cb, 0x20e532c0390bec7a
+, 0x50eb62a0178ad2ba, 0x3c0b34fddba95b2a, 0x29f52efd2bb1eb22, 0x282ed76807d48249, 0x3b246d60e4480435, 0x7b409bd3f1a8392b, 0xe4c9450bc13dd94b, 0x3c5dc2b2c00775ac, 0x7b87c7262f08e6d8, 0x3ff56fd2f9e05b73, 0xc76600a61ff5696f, 0x644bdad03da0b712
+, 0xec6bcdea1e031088, 0x7f161f37b69d4966, 0xb03c50de91575a38, 0x54dc5b4ca076d443, 0xe91ec69cedcb0f59, 0x2f489a1e9de965ac, 0xf57b3a922776f121, 0x108bc22f9edea9b3, 0x52d150b0bb273d3d, 0x13934b4e01eae68c, 0x1c61387d85408277, 0x43f92f9c12ceadd2
+, 0x0fdd1316c5f1cc0d, 0x6414ef31cd98e104, 0x41e8e117dc8b7e59, 0x7f681803558e6d44, 0x8ab50852811277cb, 0x32a96830c5659d01, 0x82e90f78cac9b7ea, 0x7c132b8211c86edc, 0x1ab8159b40d17cf0, 0x75872fc76e77a7ae, 0xe1727b996833ff7e, 0x084c9f2e95336a98
+, 0xde0db34dd3a743fe, 0x576138b7311f49e8, 0xfc4b1d30fc094e72, 0x693dbd381809d386, 0x1d42c06330de3069, 0x078d4419bb73e022, 0x656d19625a8ee211, 0x2f627ac1cdc1919a, 0xf14badef77ca7530, 0x451bf6462eaa9a7a, 0xd825b969712c7749, 0x3b8103df9fc8d9ce
+, 0xe4593020c10e092e, 0x53fb3d7c78f1f550, 0x7d9dc012c7c10655, 0x14c966f655461664, 0xb28d1b507ee4da89, 0x0152639829043ec1, 0xf48588fb1c26de29, 0x77bda19527acae6c, 0x8979e4b3ab641823, 0x06fec05685892982, 0x3ca51082f2db0419, 0x2d1609179fa77941
+, 0xec997ae3b379ff43, 0x2f9d9aa66012df2a, 0x38392f167e7ec02c, 0x7bd509c8095f4e88, 0x3c596df87c016e6e, 0x19425683575b2b8c, 0xc65a05ece6087c78, 0x677d323b9b2b4278, 0xb9e61d7166688626, 0x20ecfa1fa6cd5548, 0x5bd7bdabad84a5fb, 0x61bae15fc3dad8c2
+, 0xaaf94b004a82d259, 0x445d7280aef996c7, 0x50aafbf9f720ca6d, 0x1241b2afda71ddc5, 0x4257a3b6948b7768, 0x18b477f33d980702, 0x5d8d7c1700c1c580, 0x57d02656faddd741, 0xc585a7191ac6517e, 0x72326422f43d3894, 0xfcbf84c6ac221117, 0x0b7f59f6ba588b27
+, 0x0c63278434922f4f, 0x3bedce4546023cba, 0xfdf6451097c44f33, 0x51968dacf0293a6b, 0x71cff332fede32a3, 0x542d355c75c427c6, 0xc54905413c700604, 0x6c0b657b2b242ae9, 0xaaf667b202f3e7d3, 0x733de12552c5b972, 0x87c62bab65831e8d, 0x361439961ec55962
+, 0x44d7247a2f4ab699, 0x2afdafe68c9891ea, 0x700634f13f15c551, 0x18b9d74ecea4153e, 0x6948aee75ec0fd58, 0x687f4a3bfaf0e698, 0x8b831f7ece520722, 0x17e54afb02b0957d, 0x3b8589ab6b66ab85, 0x4e45e4fb0e214724, 0x3e9f7bd4089a36c5, 0x40a7df0a5ba66015
+, 0x7f6849933e1595c5, 0x2a167b6eabd17859, 0xa9821214c3d635c2, 0x59ac9b545c969ba7, 0x3a6df9c0c86fe99a, 0x489ecf46e5a0cbda, 0x646c0a6bdbded348, 0x02201126c4b93e83, 0xb8de7443de121a01, 0x30ff1fd800058f3a, 0xa2d48d32d32367b3, 0x5af1e1586c56397a
+, 0xa8284f7a5ba46dbe, 0x711aee8588fe7f4a, 0xb2c0ae2be0a8d5eb, 0x6af93d57812aae0f, 0xab0f10e7927a6212, 0x6773298ae5c35466, 0x19e4140d275351d9, 0x283c5a4803064415, 0x22993b8c74c45c78, 0x35587865d8afadd0, 0xa23e05f908bdb14c, 0x10887dc901165848
+, 0x7d0bc58bf4c82227, 0x79acc165320b27dc, 0x81aea88d664a5698, 0x2093ceeca286df4f, 0xc0c94e159b68a8ef, 0x5d36171ca07c41c2, 0x1d7a6eb501a162ae, 0x759fc6467784b51a, 0x6d3f874aa0106a51, 0x606f5e7d2ba79029, 0x6cd2a9011adecec9, 0x5089fd36d5bd791a
+, 0xf83dd3c90dc65851, 0x602331b3ff36d34c, 0xe8622c7a17aa950b, 0x58c4f3771b0bcd27, 0x9b85e4cdca30e41b, 0x6e815a16a9b5c931, 0xe7ec0e906e34bf29, 0x175a750aba089300, 0xa3f05fce5bd2c4d0, 0x49a6b7aa5214c44e, 0x6318adff65fe3209, 0x055794ac7542af02
+, 0x2240cdfaae0b8533, 0x657763cbf327cfa5, 0x389bdf53e414a059, 0x75ab254f34cba231, 0xe6c1fe09f7ead028, 0x4c1a888d9451505d, 0x1336febf9a4addda, 0x687bf097310db079, 0x8d59081b46933e44, 0x2c1591214ea0140d, 0xa1f716548283935b, 0x4944efb8c3b6e265
+, 0x00161553504cd669, 0x3a6023c3b8274c5e, 0xecf1316a429f4c38, 0x2e8150de734ba5cc, 0x7d3c31b334857345, 0x6d9908945c2f51b4, 0xd626f0de3df98e74, 0x214a113110280b0b, 0xfe17ba1a3292b86f, 0x36428d5d08e4a5fa, 0x8e20a5776801a4e8, 0x726299e609591ffc
+, 0xe8e4addce24c90ee, 0x787f8b43b7d75de0, 0x34a41ae6bf52213c, 0x2df3a618470cd836, 0x36990c2fa42d98d3, 0x4c1e6f50b898b0eb, 0xb37f8ba92d8fdf9c, 0x42761bdf02b89e95, 0xd37407cb0ec6d250, 0x10476ebe4f0acc24, 0xe56ffcc8c9b35747, 0x5ded8cfe4725b114
+, 0x8a9ffa0309c06d66, 0x759fe4b1c78e7789, 0x22060420ae92b619, 0x455bd6425c079fa7, 0x8bd4f76a779c479c, 0x2f69cfe7041d25a3, 0x728ef7aa4aa9e115, 0x2929d628fb6ef923, 0xeb31b5c1747e13bd, 0x64ac701b8d42c082, 0xde11a90fb1cfe16b, 0x07d69179877bcc55
+, 0xb74a7365b8af6a36, 0x474f20e7489fc75b, 0x72b7cd728d4bc9a3, 0x4e900ac062b0417a, 0xa4cbf3e8f4f0902e, 0x6cf63cdd3334688c, 0x0114f7cb348ee0fb, 0x5bec737b038ce738, 0xc2372a887018afef, 0x2baa96808b58cbf8, 0x292406b561a4e913, 0x03ed30be798d0754
+, 0xd6616b90d2649aca, 0x1711825c04867e5c, 0x77808c9ee5ad5db0, 0x39c4e8822268f831, 0xb04e24bed8f74185, 0x6b2b1b4c8c715004, 0x746b0b433a5b7725, 0x782f540998f1b385, 0x5a84dac2e8d469c2, 0x436497838808ddf9, 0x28e8bb821329052f, 0x3ff71dcaba660011
+, 0xae4f0c01c2b41304, 0x71b064244db0ae8c, 0xd864fffef0761c98, 0x7f657006bc62ca1d, 0x0cf5957b2bfb6473, 0x0e42e652879c879b, 0x970ce16fa2d3aa38, 0x6ed3f0fceb6569ca, 0xfb08e4c331a28b3b, 0x49d970f506f91974, 0x54d5a649af8aaf86, 0x565b9bb338397b11
+, 0x9c11d0863a86a50e, 0x5e5c8955ea99e9d5, 0x7cc6ddc20a9378df, 0x3292d0cf4fad1ceb, 0x4f7cf34cc049fb51, 0x682460233b0f7280, 0x2fd5356f7136aed4, 0x4d35dab54aad9e65, 0xd290a6aa6ba60954, 0x3d30e8cff2f18a4f, 0x7ef439ec013a984f, 0x034be830aca112a5
+, 0xf861d34b080ece17, 0x60a4ab4f0762ad1f, 0xf1b1d92843ef1e20, 0x50270df8804caff5, 0xd685b626ddc391d3, 0x5e376d31a65a7b55, 0xa85aa619ba81a4cc, 0x0a2ab7ccda3af21a, 0x17fdbf64985b0b22, 0x08179482b512e1aa, 0x2ec9b9ca776f0b09, 0x2efca4786deed35a
+, 0xafe102ea0a57007e, 0x415b592b113c8808, 0xb3e8032c0f1f5b85, 0x74996a2dfe9f5bb4, 0xfae2fd3b338bb788, 0x25bb6b06531a7ed8, 0x229ac789d2520a79, 0x37675698dccf72d5, 0x5101d0d1685eae10, 0x236572dd589b1b23, 0x22c8f0145219aee5, 0x59e81ed0050c7873
+, 0x37014aa102d45f86, 0x3365383ab0f31df0, 0x8fce0f13b06cc379, 0x236989429d451103, 0x01d1d4bd895f4e82, 0x344798534cfc1b89, 0x3cbb6d4111ff7afd, 0x1c01061d261afa8b, 0x9d28f8c2c5dde865, 0x000b12113a2e8eee, 0xdd3223639bc38e05, 0x46dda33253f78790
+, 0xf854ae771dd2950b, 0x63b0d2efcd9a5f66, 0x1ddcdb4ad5422945, 0x4d0863647f9eaa58, 0xa6b66880eb3b24ac, 0x31bf3fb2010a349a, 0xa1b96bb99c539154, 0x0d23445a01e009b5, 0x71e752d851fa8a72, 0x192a97d32353bf10, 0xf9cff5128fc8ca61, 0x21dd0550033801bf
+, 0x43299e9eaef27485, 0x33dddd7733050122, 0x655cf2f2e79765cf, 0x5cd1220a2d34d663, 0x514faaea9c05c83f, 0x79397aaa3b74a6fb, 0x1e464ab2d089991b, 0x1f48e52a42f7cf3c, 0x3a6bbb363d599a63, 0x58e8f07cfcd43f97, 0x6f75b5b7c7f9c0dd, 0x255f018d609d1a69
+, 0xf1121080f92e8e77, 0x2aec99873b0a15aa, 0x79b1f5dcd33af359, 0x66a08b38459c5b57, 0xea2841bfb65d3f81, 0x75a51faf6ed4873d, 0xa80d66ce872a2d76, 0x649231a3f92bebc6, 0xcc23fddfa0e0cf03, 0x4a8cab853500f726, 0x720c4915e205aa87, 0x08b4d071863ba577
+, 0xb01a426b1661d64e, 0x58ad5607a39b7ec7, 0x335ccddd0a66a9b8, 0x0607ba8e3c5f598e, 0x794a12b8bfca24a9, 0x3e9c49bdec5e7001, 0xd0944848402491d4, 0x21f35f6b46ea2baf, 0x48be24ce3c057879, 0x3e720b1c59dd82b2, 0x93e8b8d752e25d83, 0x71d8b5429ab3e67f
+, 0x2335767fe72fd953, 0x4eb3143e4d3a9ca3, 0x15d9be5b8d75f319, 0x04d5db789d96d758, 0x59f7aae18f4c5a95, 0x058097a87e2b30da, 0x870e826f4ca71fd4, 0x1496f0fba4e0b6ff, 0xf558db339980c449, 0x230c1696cedc4197, 0x924c68b31cda8291, 0x1080b06459cf9e43
+, 0xf2ae3c31fb7bf75f, 0x5f07bff2f69063d2, 0xec43f4b0c3d99729, 0x0249d7606e623a8c, 0x0159a44c8d3aac08, 0x4c243c22904146e5, 0xca319831535b7303, 0x6a81e9487f4044f6, 0x4f126c2ea5bcb7df, 0x195f33fd89e12182, 0xf16f98c364bc34ba, 0x26e42c53204d9b66
+, 0x44d2fdedb536a5ec, 0x298e3f49b8c1f316, 0xb0e53b6783f6d304, 0x068f3b8d9d2699d7, 0xafef87cc5e0df7a9, 0x55057a688d759763, 0xd6fdfcab984e3268, 0x5aa600f1dae106c2, 0xde4bb7f5e697ed53, 0x76f8b43be411dd35, 0xc32d29b31a213096, 0x59583be9b61a9fcc
+, 0x89688213542337b3, 0x42487e701ce30fbe, 0xcf35db68ccf6e7bb, 0x42789239a64f024b, 0xdaeba77877ef2b11, 0x2b71479341dc7cfc, 0xf34c8bb7cf445658, 0x1b6ddad96f4e2e06, 0xb70dbd287c190f41, 0x4c3e0c9be5f24aa5, 0x8b6862c8e722b463, 0x4d40c44384e315b7
+, 0xf60c1db25e3a68ac, 0x4b0b5d08a40c3229, 0xe481d11304d165d8, 0x7d63c3df3cbe740a, 0xd4f7b738371ef6ce, 0x6402b1bc68677788, 0xcfa8a3dafbc184e9, 0x3bc47c8e4100e3df, 0x699f280c050c334b, 0x70c1e76bd11790fd, 0xf2357275836f8d7e, 0x199e0e9c6a748ef6
+, 0xad93e3dbd3e265dd, 0x7bdd567707c41b05, 0x60b9970cbe10cf5c, 0x6042be698613c301, 0x32b21f3c089f1738, 0x78868002dfebfb55, 0x9b6deaab97a10cf3, 0x6a35423777e912e9, 0x23360e91416591d7, 0x305429304481584e, 0x69d2b70500a60678, 0x620ce1b13d235eee
+, 0x7e058cd457b108c7, 0x7b29b3ec210bbe7f, 0xb7f7357ae3a89eb2, 0x1cecb6c0598cb2be, 0xd61ee1a994b5d0f6, 0x2d64c03008a1364c, 0xfac48448ce4e3808, 0x4b20a5b1a551c92a, 0xc5e58f70625f77cb, 0x6564e8e1068d8915, 0x75913205c14537ad, 0x26e13789dda7beda
+, 0x7451dbeadc79450f, 0x4e8fea01ad2221ed, 0x888468819961fd71, 0x07f2a65ddf4ecba3, 0x9279d2de38deb37e, 0x22486e28a9a2cf82, 0xdedfbda73be66cf4, 0x3cd8eb3aa661f5c1, 0x9865e6180b9450cc, 0x4aeee86a0cb40eee, 0x4c5cdebfedb2930c, 0x50ee57d9b4c86a04
+, 0x4e27d9f75d52dc54, 0x72d59def030a7af8, 0x5f1be6a7706b4d1c, 0x1ac8b5b92eb436ac, 0x62b913f5fa2241d8, 0x6d313d027254acab, 0x2fb43e86de4ec8b1, 0x1baa532045f1b650, 0x23178ed19de0f294, 0x67ea90fdf848190f, 0x6bf8658e7a9e4a1b, 0x5507d066a472f7c4
+, 0xdc9ed2a9b8f4de7e, 0x06726b8ede3b82da, 0x8eff400804c1d42a, 0x055915e0d3ebd147, 0xa887b99bbb31bfc7, 0x080aa28959d1c9b3, 0x3e29a30a78620826, 0x67a2bc3bba6e9a9a, 0x955b200d0b99c350, 0x5b6662d79fe9be3a, 0xa0070c5d798d1b6b, 0x077f9f5e2c260f1c
+, 0xccc19c61bcd398b8, 0x73644477e577b00e, 0x83f95f21e2a056f2, 0x31ac1e3e65b05d3f, 0x99d0df34214d3f6e, 0x48a18fc0cc3aea50, 0x05b29927af071fd3, 0x25b55738f83b1bb6, 0xe422e9e1e5e931a0, 0x686ed8fcdb2a7cfe, 0xf48925e12d29cfe2, 0x3603712685825c7d
+, 0x21d2c572368af9ad, 0x5de3d57aa7af87e6, 0x25ff23db6bc0949b, 0x0ce7a9ca15ad5523, 0x6cb314472d4e09c2, 0x2df0cecc6be327be, 0xe0bdfeb7c76fb909, 0x3d5f7b408bccd1d3, 0x2e41ecbeeb820a81, 0x3c28e361b14f091f, 0x25a699ed5e9ce291, 0x4674a3806e134556
+, 0x488d0cc868300ff8, 0x57cb9b452c497691, 0x6e0c75d812bc1ec7, 0x5936a43cd20f75a4, 0xf76496437b1bc487, 0x5a4f9f12d5351bae, 0x0c2fa8c668005719, 0x4aefc11362a794b0, 0x0e658da3808f0730, 0x010f25d819140324, 0x6f3dd613d0795942, 0x6ce403f5f90f2d94
+, 0x850b41a7858c92b7, 0x59a17f1bb7fb0ed5, 0x40208a3913981990, 0x369f2dc5c2cefb25, 0xbca4875b5ee65931, 0x7cd94afca445594e, 0x5fa4943975e9925b, 0x7850975fa2109c6a, 0xc8983927200c6eb4, 0x7a4eda53e46f57b0, 0x93fabfe02e5f32f6, 0x254b4bfc1ecac6af
+, 0xa3eb5fdcf0147c83, 0x61b8e3254da33336, 0x2538af07006b40b7, 0x1ff5fbc317f1cfd6, 0x136dbbdc57bbc8ba, 0x2409733bf15af386, 0x609a07bfa4e3cc50, 0x68f1b83465f8c608, 0x0077c7ab1ad47ec6, 0x54b8f202b915b58c, 0xe5afa53ecfdd7505, 0x7f8e4a238ad156c3
+, 0x3e8931274e0e6ef6, 0x4db183a2c3b1c98e, 0xc63efbb191f0e4e3, 0x0efd0216f351ff33, 0xa3c47979c227c0f8, 0x1a21061b8508da86, 0xe999f8adfffce517, 0x3355e3f0f7fa9291, 0xc448f92708acf5e7, 0x2697c424d86776b5, 0x7f5e62161af8bcd6, 0x698925be66beb3c1
+, 0xf58a2d5406251ac5, 0x46e295dc06977448, 0xa2de6f591162e637, 0x0e1eef39295191f2, 0x34bdb9c153eaad9a, 0x5e5b979ea2f3101c, 0x93e4ccf6267eed12, 0x6ca7195db25e5f8e, 0x3abc3d05116a65bd, 0x707f1aceda0b405c, 0xd90e90b29bc2363c, 0x71f4eb96189de718
+, 0xad08b8449963b16c, 0x4cb2f0708aacc8d3, 0x8d885c4118d6d492, 0x64cc4d4cad2ffb54, 0x5431cc277fcdfdac, 0x4d25cce105174bc9, 0x6c8aa64c4afccef8, 0x1fabd0d877e827b1, 0x4263e0112435325e, 0x6c850124647b2870, 0x991fb86f553412ec, 0x00c152d0e5adbca7
+, 0x256f9d1bf43b0f6d, 0x76ede8569e89eef0, 0xeee98964a983381d, 0x227a908d90afd51d, 0x6356c05744b352d3, 0x2c14729f1e1bec42, 0x37a7b9dd8be977a6, 0x1ce25c484993a529, 0x8a103508b168b1f1, 0x0cca80b285e1fd2d, 0x43ca3bca8444277c, 0x5da92d7c530bd194
+, 0x6002e6a46ba56d4f, 0x3f845f20aadd0b80, 0x07d2122bfd2196c2, 0x04cad2db09d593d2, 0x453dbfe4813a64ac, 0x0caf5b2cfbe4f055, 0xb191c71b1415039d, 0x4d03776c790e08c6, 0x0af55d46a90d8010, 0x54b23b1e5bf51275, 0x75f33e71368cb267, 0x0d7d1bfee6c9e431
+, 0x29bd788201d60a1b, 0x5ec301eca192dd3d, 0x5ef1b369d70abfa7, 0x4d8e7d1cb5b8741a, 0x355cfb3e0c5b4681, 0x311452b0e975f34c, 0x5764692e5f1558a8, 0x54db933568f156c7, 0x8d615df2596a36c5, 0x180f3a9f1fe00b6b, 0x05ff62b732fa5811, 0x3d0792bfb9b5e958
+, 0x001757f1b811f4e9, 0x41f0802ac3eada5c, 0xd8ed78d0c544167f, 0x1591df509d05c444, 0xa31e7f86b25dfce3, 0x21169722de1dbf70, 0x8e44b73bc69aa05b, 0x0024543c8ecbb47b, 0xf9ea1e30403ca472, 0x4252516c4ad23413, 0xde320be128c2423e, 0x233c8a12d0ef2867
+, 0x5b33507abf2f1464, 0x4153f17c5fa14c09, 0x70606900f39bf910, 0x6df1d02898392ec5, 0x3b277a8dd8322b69, 0x416ea0f45bef8456, 0x8da091fcda6fde8e, 0x2d6944f42bd144d8, 0xa3b0098d8f54b4d4, 0x53d43dcb069e11ee, 0x6dfc76a9c56191f4, 0x3e372a69fded1566
+, 0xcf80e570a4db8f99, 0x56cc78fb4ec73fe9, 0x6986dd6439e0eee8, 0x59379a5ef5358027, 0x0bfd78ab2fee3027, 0x768e739496e744e9, 0x098437c79f54c9eb, 0x6180c36327e13dcf, 0x9f25a7a9f2c8d807, 0x3d396050e19f13fd, 0x213bad3e76852988, 0x6548b5664d8edf91
+, 0x53f7c89549028ef5, 0x0022aebc2e97e7c6, 0x87b9fa1fc1f117d4, 0x77e2bd85ca2e0097, 0x0627fbb463b59304, 0x0fe3cb2a28cda0ca, 0xa95697312db24d75, 0x31fcbdca4a409a3f, 0xec6dd684a491050e, 0x6f3751e5b412c017, 0x165bb93dedf915a4, 0x4c53a12a566bc318
+, 0x51d8698005be7b2d, 0x1b4e18fb954dde14, 0xc9a7663eb55331f7, 0x71cbeef306c0c43b, 0x54bf2e5cd03ddbaf, 0x6fb5ac918fc1a370, 0x3b6a44798956f721, 0x06478183d07ff252, 0x8422c8426ccb6e4c, 0x0aa4bf1c1ed952f3, 0x39aef1914ff5cc33, 0x19affde66019c437
+, 0xf58234b6be1e4aaa, 0x22dfa83129b2d1e6, 0x1c3fffc0f0b59b22, 0x199b240f5af21e5b, 0x333d541427013ef9, 0x509cf2d17d9caa66, 0xd41b33a09ab9d95f, 0x729e866e33e6960e, 0xcb0fcf202c0ea13a, 0x241477540be90647, 0xd9d468691cac6ab1, 0x321ac931c2df3e90
+, 0x62e627b04a0dcf9e, 0x7a7857b10d54790b, 0x055a7de5d4990d2b, 0x73f0193e5ba2feea, 0xfdcd44a4cd23f07b, 0x6b7307c09b9b65e4, 0x202f8b50372c8a02, 0x2f08a5d96022f149, 0x100222be845d75ba, 0x02f1e2a009064db1, 0x29618d1b5a574939, 0x721253b7120e61bb
+, 0x8a3f0276a1c34220, 0x21b875d70289cd6e, 0xc0b86bf477799b74, 0x242862b965875c83, 0xcf1ad1c0475f3a11, 0x605afac486d77884, 0x71907cab9c18cf78, 0x0366b011f0c251ca, 0xd91540524a8bb30f, 0x34794b72be9c7e6e, 0x383f1ab9eb75dfc9, 0x15d794026b6b247c
+, 0x2559f5d9fc1803f0, 0x4d477d4388c5d095, 0xef1093d98be8a767, 0x3a0bd59e0bb26f22, 0xe3f9aa9801c4a585, 0x3475f412ee55dfc5, 0x37b6c336cc01eaa0, 0x541831d82913f637, 0x5743489d339b7a28, 0x77f8af83521a5146, 0x9f8b45ad3b985576, 0x680dc0877e8637d1
+, 0xbbf95f03bb8d20c0, 0x6f437db9de964a5c, 0xcd2ee89b54ad5d9d, 0x5a7139ae038ae636, 0x12bb9e5697dcc58b, 0x7714786c6599bec0, 0xd580ca241bc8c683, 0x3b5f7cd7dfe7e602, 0x1e6e32385e114efb, 0x5e6af9623bd54280, 0x4c7ffd0d56169fcd, 0x748e90ba0ff57005
+, 0x5a30b113c629a329, 0x4115fe1e232fa329, 0xb3f6b72c93986475, 0x6a7abf85fa1c7634, 0x27d2be0471979069, 0x3ead527c851635d6, 0xb5bcd3911c97060f, 0x6a94843e79ac2725, 0x19c8cced1e515ad7, 0x5afd0d5830a5ae0e, 0x3cc04bf6a098fd8c, 0x3431bc42a8e5ca8c
+, 0xc4e33230e2bd72ed, 0x62722b2451a8fc3a, 0x23e19aa75b23b645, 0x2c6ae397af89881e, 0x18b33264038b814f, 0x1b8c432a3887e35b, 0xf844374b7a5a254c, 0x440488c91de38db6, 0xd5984be0963849ce, 0x4af6b8dab2bd5e1c, 0x427a430ac0b89319, 0x343443f96cb70e3a
+, 0x560125c815699e9d, 0x11c68ae5b73766c0, 0xb43c7da9ecc27cea, 0x79b50a9c8a260f47, 0x0cb45f77a57ce026, 0x52d93df6d2e4f68e, 0x446d62270e3f2ae8, 0x79362db8b50f8d4e, 0x2db75d3e6e608e91, 0x53893205cdd219ba, 0xbe29fdff7a6b9882, 0x6577f74f5a9bdd55
+, 0x7b31e224808cfa8e, 0x25f7a0fe1efafef9, 0xd502d5a8b27076a8, 0x701976d2dea17a7a, 0xd61e174b749976b3, 0x6ce81c69e640ed46, 0x7fdc20f525274973, 0x598bf13e85ae4d3f, 0xff1e302095fab9ff, 0x03204638aeae8a41, 0x48399ce1854275f6, 0x769762e1e6718550
+, 0xb8408c9fd0bf030d, 0x1f431b7c29c1b3f5, 0x036f0ca940dee417, 0x4c605da83d4a8b88, 0x2f61cbf86dd2ebf5, 0x079d1cb598fce10f, 0xee376a885f81a1e6, 0x471170ad5bbb7b27, 0xcf6ad75d27cfdf72, 0x05dad47e3fcc5668, 0x36dd371246a39af6, 0x4860d85d6173b80c
+, 0x60aa99baaea40789, 0x07ac3c9fb84d3faf, 0x05bb8140a61664a4, 0x6e2bf3fe19e016d2, 0x742c9498d580045b, 0x5f811afd562310ba, 0x1a8a15b2702c5b32, 0x5bdb93566699e466, 0x549a2abe2c4227ae, 0x3a91980fb004a5ce, 0x7f1238a658bb88e0, 0x4bb9a29d36002ebb
+, 0xbc464a5ab36a0f8c, 0x3bcc17bd76cdd105, 0x94f122f9600133a1, 0x37cec087d7e53dd6, 0x406f15203f1a6094, 0x34fdda9e9da2519d, 0xf031a962c4834c4e, 0x6f725b8bfca7a4a7, 0x50b99b29952871b2, 0x0f7da31a764c93e8, 0xc239e9ed75c0b3c6, 0x304fe20dab18db4e
+, 0x32bb1fd5b68ee9a9, 0x3cea8141b30dc044, 0x238b4d8f5ddc1e5f, 0x2cde10dbb6330ff7, 0xabf2cc4dbaae5991, 0x4a7e020d7b0c75a7, 0xe94ef58032ae4dec, 0x2d70f3ded065dc67, 0x0ebec4374256659e, 0x52c85a419ca8d481, 0x8f29d9d45a252d9b, 0x02e1fa199311a364
+, 0x6a2a3ee6e7db5a68, 0x20ec59e6695b7072, 0xa86197dc0a09f9d2, 0x0038dcc5cf0889bf, 0x5fb6f2bb99100244, 0x731460b9f7450b91, 0x8b9e81bc06cdc94c, 0x7e0d3893f0c1ed12, 0xd6206f6b205598f0, 0x312b79ef719aeebe, 0x5e822d14d4ae10e7, 0x6af064834f70efd2
+, 0x11e65c7ae6d24f43, 0x17a7582dee4de79e, 0x13cf09f0ac4ae76a, 0x665a14532fea7482, 0x06c22073dab55182, 0x1b8da6716311edee, 0x558bd30911967272, 0x68fcaa2c0f6beb32, 0xe06a651ab8aa4a6b, 0x7f0e8cec17bc9333, 0xbabb83a0c282bafb, 0x00f19884aefab87d
+, 0xd51b5356a42a5309, 0x77b1dd069316b4d1, 0x278ff0bcd0b1e9a7, 0x40a947fc7afd3cca, 0xe5c25fac4d2fe1fd, 0x36fb32ebed4228e5, 0xfc172abc8a4d5cd4, 0x2c43b7a091e049cb, 0x0c0e090e06841688, 0x162e377a2dca7b2c, 0x0b7c8d4c7828840c, 0x714819d43492a993
+, 0x391479c5cdbd0410, 0x4b0258678b56f6cb, 0xdf7c159a0ca9f82d, 0x7bf57ce5c65dc96a, 0x92a1f892c9bfacef, 0x4fce54e8fbbaddef, 0x073b5ae4a93184ef, 0x2ce374a010b16fc4, 0xd4417a3b83fb42c5, 0x1888e5c9eed91aa8, 0x92267b698c19b706, 0x2a0083e86c9926f8
+, 0xc0d6710535c841b1, 0x793530a0f9c3fc62, 0xd8a3906843c1fa56, 0x048ba5602d6aa49e, 0x98fef790f91a814f, 0x0ba5d11d550d6372, 0xdea7d74d50bfe199, 0x2143e4f89bec3cca, 0x63012206c3f5dc02, 0x5c69d0a42061345c, 0xaf334cd75a046237, 0x3f3a99911cee0dd2
+, 0x266689e87144d8f3, 0x01f0acaaeade612d, 0x2e70a8bae06eb1dc, 0x17b0aca39b5e5510, 0x36d4ce0aa8c686c6, 0x3fd9916c7fa230b3, 0x14e7485886314a33, 0x0913bc357bfb3364, 0x0b072979b2a8f004, 0x2fed4de1bd9de4a4, 0x6a0bc119ddc8adcf, 0x0b64fdb24f6cfa98
+, 0x6f1df5cf6a7a8d8a, 0x21f78c75d06b8a4e, 0x619310a3e0d0917d, 0x48be06cc52ab1c13, 0xa828eb5d3f432371, 0x20394ac90f4ee5be, 0x630627bf4b686bda, 0x47db9b9cce7cb4dd, 0xf512847e6f1d425c, 0x52b00214765382d7, 0xd819696ab6830c7c, 0x7cf6ae0200977c62
+, 0xf307275199b4b867, 0x06e430be19eadb17, 0xf87f42ae1a7a50dd, 0x384b37cc2bbcdce7, 0x99540934a8727b35, 0x0117455eb62b0b00, 0x6c5e00e8596376b6, 0x48eaa9da1712cee9, 0x36f10fd0fb8593d8, 0x76491f950b77a9e6, 0x6f3db1746894d540, 0x06ca4c20b9e9c891
+, 0x5c01dcd32dffc23c, 0x302c610fd65eaf54, 0x504538d36387378d, 0x0198a063223ba2dd, 0x1221d3616f9c2ed2, 0x4a41eb2b6a4f5619, 0x7d08e03029991174, 0x76ad4fb76300ae2f, 0x351c54eb656352c6, 0x4d9e297cf909dad8, 0x5f0ad6e5c589fff2, 0x0914d0b57561bd15
+, 0xd9b265578c024fe1, 0x17518614de70d1b9, 0x951bf62c297fe1de, 0x26133f369ceeded9, 0x29caede601c4e46b, 0x5b697c9ec06a95d1, 0x12ec91aa6a4ddad1, 0x597352690a08c697, 0x4a39ae805b14d7d9, 0x32fc0f8156acfca4, 0x63ee0440acc310c5, 0x66660bf53467a31a
+, 0xd3c0795acbda512e, 0x079ac5b0ef131e89, 0x46d1faf87e0635d1, 0x3f24b8ef12cd999c, 0x9a421fabee037e04, 0x4ecf5ff72b738283, 0xa512d6b16005981d, 0x04f053f77195d89c, 0xfd54d6e0c7e55912, 0x2564ddc5349fc0d8, 0x55b00e201b29743d, 0x567984d440d0d911
+, 0xd2bb35ffc63a032c, 0x4e2d5f3a1aae1a60, 0x59c80c01f8ef4d23, 0x0f4781d21c2fb318, 0x708cd3bf3ad0e823, 0x2b2c7ea6a35baa06, 0x74f0a45b072d6fcb, 0x313e19b156c854ef, 0x56ca48c60a4f6148, 0x4253f7de242f3817, 0x8eb96591e90ecac3, 0x3155dc1d63a38ee7
+, 0x6167489cc5b467a4, 0x08dfb45130668685, 0x0afd1a2955ac4a1e, 0x72a8145ec9dca303, 0x74eab8220fc04e97, 0x743dd404fb85cbc5, 0x40dfe3109e1db476, 0x4ea35d3fd688c314, 0x9d24f5c681149182, 0x29a8ea9661aeaa21, 0x7625a9c99731855d, 0x187350bb01885ed8
+, 0x201145d19b82ba3b, 0x6fd96b2df09b58f0, 0xad12f0851800c32b, 0x0afea488de33f1fe, 0x94bf74c8de7d8b25, 0x593de6ff8e39876c, 0xceab5a33260c5618, 0x5e701c6fe06671ff, 0x6e07f509caca3a7a, 0x1a32ffecab85ef25, 0xb0721aae4708e7bd, 0x7626bc227e5ceaf8
+, 0x3350d5c640fd19c6, 0x79fd5dbe548d9d10, 0xd0a8f9cefa5af9e6, 0x4b67360dda72528f, 0xe1a61ee031b1d88b, 0x0ad2b18c5592f6e5, 0xe8bd98e749d7d6cc, 0x7da1166c7a45aed1, 0x421152bdffe3594f, 0x6e44e074360e8b08, 0x167c92cf8a1ef287, 0x5288aec4fcfc872f
+, 0xc835800917b4a91f, 0x3c2971d2a1c11e64, 0x94159e25ef6876ad, 0x11d9ff6e6bac79d6, 0x2e67a3551ae19f63, 0x5bfa0b69f8f5ab5d, 0x5728e5b202900166, 0x398554cda98a5509, 0x80e90f8967394bd9, 0x0237e04105e6d731, 0x899a6e423dc6aca9, 0x71218385ccb7db1f
+, 0x57352f93fbd5f7c2, 0x0785494870e31be5, 0xc11c25ffb66734e0, 0x7152a409624099a5, 0x56772a70c9379f7d, 0x76f89295ba08beb8, 0x29c6f077bf3af2bf, 0x76ddb58c6c1da03f, 0x0873202062135a97, 0x29c1aefc6f72ae66, 0xef8bb130ea162a80, 0x1e6c95bc9312b262
+, 0x44d8cb7f012fb03e, 0x545a70c9707ae860, 0x3c1378d4fe2b7269, 0x376bd65e4017b80e, 0xcb1299d9e82c50b3, 0x5bba97003a4ae3a1, 0xda33e8aa35ad954b, 0x025ab4c661353b2d, 0x161263cade819393, 0x1f97776c8a73035b, 0xa782ee5ed78bb9fa, 0x487504760b5bef1d
+, 0x1d0170d9904c58c6, 0x09ba37486c973195, 0x092c189f261a349f, 0x1cbae6a4e03cb840, 0xf0643bf53c1220ae, 0x64ec3a2bf1cb7643, 0x7bc781fb8a4567d1, 0x2efa102d54e88f0b, 0x07cb0e9364c8208f, 0x4fe4fcf473d5ee4a, 0xe96b12ca71fb7a66, 0x6a656eb5cb4a4e2e
+, 0x9d53fe226462291c, 0x1df2f0e7f6264241, 0xb438aafb8dabbdab, 0x7878d86b604c150a, 0x94389ab43fe93d37, 0x365ff1281c0a2163, 0x3324e579173efb34, 0x056cf0e7bcd62ca3, 0x443bb7c683a476ca, 0x569e9491bc1c6154, 0xe47d6a7642ddbccf, 0x161125f9f8b9e308
+, 0x9f2719bb2d26d239, 0x6a8beed2e6a1cc44, 0xa855c784c74ec45c, 0x26cb34e2bef02daa, 0xb9de0ceb341d6a01, 0x3933d9537159637b, 0xe324056431daf6cb, 0x53c6684308703be6, 0x8f179e9066244315, 0x4fd830662d68d222, 0x2250d192f1806396, 0x329952e05bfe8a7f
+, 0xc4502f422a0a37db, 0x285a6056b1e1512d, 0xa99b5ae4fd081b0e, 0x52a94eac85374a0b, 0xcc5018bdc3a4b8c3, 0x3b3b552e9e7434b9, 0x52e270b726472157, 0x1bb1d924333458a3, 0xe8669fe63523f31d, 0x6c29e2c407130abf, 0x43e4a85d491bc382, 0x5268c1225b53cfe1
+, 0xeead428c5eb226c7, 0x0a9168ecc89beef6, 0x5a3da272cdb52b69, 0x79143aa419a91c09, 0x74fdb2078e8a3e55, 0x46041be1bba5270b, 0x8a242f99f56b7fab, 0x53e1e90c2ae3bb80, 0x881b1682da6dae00, 0x44402fd6a5e232ed, 0x2048902e00443def, 0x2bce5f6a85c7d97a
+, 0xd4b6387d6a1c5013, 0x1f807b74c9a217e6, 0x7a6f06da74633faa, 0x768e0194b440648e, 0x8039b5adfd7c67f6, 0x11eaf10ddbd93634, 0x309ba8c5edd73102, 0x5c4e97dde63ec7be, 0x65b152d71b7e0224, 0x406f1e5730ee6d99, 0xda018ebb52966e3e, 0x24c5e20388eefc55
+, 0x27dc00b64a5a3d83, 0x24ff94c0a4354f60, 0x49a0d8bece097c39, 0x06bd174fddabc611, 0x507d57a148fccd3d, 0x59a03d9f34ce252a, 0xf6f6faa367aa50ec, 0x15cf8f605e21e0c6, 0xd5078f447d38d1a0, 0x021edd0b14b33ec4, 0xb0bd936592431e38, 0x520187eac355340f
+, 0x4661f9d2d8e41fa8, 0x0e26252b3ac49bd4, 0x8a8024df0488b0de, 0x292e50e599844aeb, 0x90d5f119d45047ea, 0x39caa5b9970b247e, 0x5679633a9f212416, 0x56f4c59d99e9f418, 0x74e1f99e8f66bf0c, 0x41cf4b8553a34932, 0xabff8e3cef94f409, 0x3a69b20833ffe95f
+, 0xa40e7fb446edebef, 0x69d6af24a22d19f3, 0x47e4ba95a1f737ba, 0x4ed0fc22f64a82a7, 0x8be8451e969a3af6, 0x59bc96f28086e3be, 0x9ba46555e35416f2, 0x5960447dc3d5afed, 0x78ce5afbb693f432, 0x17ab6fc427682314, 0xa1e9ef2a66ef5dbd, 0x11c21b61b48162de
+, 0xea72cb1226974753, 0x2c98123df73e7d6b, 0x5242cac79570a119, 0x694905df9cd10a45, 0x6d6794b48a4ee4b6, 0x61f3d2a037635390, 0x09f445007feea141, 0x13b87116e606a004, 0x1f36d29be6f8475f, 0x55b21ea44f321d62, 0xc41e7f843e8905bc, 0x17d60fa199b42621
+, 0xdf03dca1838bd701, 0x24a557c1d7da1ec2, 0xad29967c717a1ba5, 0x76cfa9110634eead, 0x231e2d93a3d70de2, 0x33975dfbc658fcac, 0x89482e884d9558b4, 0x1528db88487052bd, 0xf136c41e4272d2d8, 0x238dab00157aa338, 0xddff1c2f8619a711, 0x0f8bbcda72e532e8
+, 0xab45c5f225bf760a, 0x679d097ffc4348aa, 0x714559c2524f4881, 0x699a2557ee867a72, 0x8fded0b1ee0276ad, 0x5de1152526e58a66, 0xd595679b1fd9fbbd, 0x4bf26c7f4e5bae03, 0x3ed5413604d21884, 0x434e3378bcae4264, 0x377be39aa07ef79f, 0x03a8cd648b69865d
+, 0x6068095128e56f5c, 0x1854a54a4f8f0381, 0xb99b8ed895e324b2, 0x4961e0e52942424c, 0xd7793c932c1fc096, 0x5a46d111e8fdbed2, 0x1b2501c88e4aa4c0, 0x61ce59d52759f4fc, 0x4dcca7bdff281b8b, 0x2eb527e389b22847, 0x4a1ee34a1af33f94, 0x42cc1a058c11f404
+, 0x0e28abb1bc532276, 0x6b92a5fddebba88e, 0xd3f15d4bbddce388, 0x713986b1f3a9827b, 0xebc0f4bdc97a7203, 0x06af2e946c9acaff, 0xb7c19f459bf5f7d4, 0x6ee58a587c066fe7, 0x22a942ffaacbde1c, 0x3ebd64f60ff6f875, 0xf3ac91561ffff077, 0x49fc4d562c0fcbb4
+, 0x0877013aa6080c68, 0x7e054b5ac971c2a5, 0x6ae0979f500f30f1, 0x029df5467cf11485, 0x1959c2b1082da8cc, 0x14b072ca17b2d973, 0x4ff9eaa17d158de9, 0x101abff887d3b0c5, 0x7dadd2574ad183ae, 0x39b00c3c4cb49717, 0x6ebe9a1fd53cc9b6, 0x60851287e6116690
+, 0x9b6d71d07c154da9, 0x59f879583cbc0539, 0xa4320f5ef3a4d743, 0x7cfe8dadd5f006d5, 0xeba78166114a1ce3, 0x5a213de00f2d3cbf, 0x595a2c8aa7b81093, 0x1e3d90f9cb2504de, 0x6d22b039f9b482d2, 0x1adba125faf551e7, 0x29bda8bde488226f, 0x7d4f67ab850b5a87
+, 0x2efcc1c7291fec52, 0x32102c179120ede8, 0x1055cfe1e258f62f, 0x6eacb1e20fdabca6, 0xae081a82b37f7538, 0x6f8c50cc65e62bd4, 0x3b45e7fba87a68f8, 0x3634e38d18613f2d, 0xcb1ed088fdb02fa0, 0x4ac996a3340c5006, 0x41e329df9147e59d, 0x100c4aecf42c2643
+, 0xa8484f55a863bf54, 0x268bbf0139a47e29, 0x778c90ded925a5f8, 0x2ba6a050c94aa97d, 0xa0676802c288c876, 0x6a731197fa29b4d9, 0xe1ef74cc4583fb23, 0x6fb00060063878cd, 0x2fc45c571ebe3b55, 0x6c05413b5d600815, 0x1ab2c8ca72932c7a, 0x16be59a0429cda99
+, 0x9b219abef08dda0f, 0x7623b2a8e948c6a3, 0x510c4ae22c3c36eb, 0x432195d2d69e8ad6, 0x59956f90a76722f5, 0x5163f37e6067b70e, 0x5e6b3dce1100bd8f, 0x0a47de90621695b1, 0xa6f764c5f359570d, 0x1689e8582a654a7d, 0x7957fd48509a9f9d, 0x2279a2d99982b4ff
+, 0x6e43d5448c902c96, 0x02a10986a6694646, 0x9cdf13ddf5d990d6, 0x48ab280d9ff158bd, 0xf0dd1dd9de73eed5, 0x42ed2a93115833ff, 0x7ce100ce28ed8396, 0x0060b5b4a3120280, 0x6b70c81e408edbf9, 0x1719f7e73785345b, 0x2067640704c772d7, 0x508cf74080207341
+, 0x5b869af4b9d0d7ee, 0x446bd28de72458d5, 0xafe5491fd158b06b, 0x1d3ea5cf79175a2f, 0xa47f22e59c999f3c, 0x0fcfbac7eaf743e9, 0xa533ee18ccf70cfb, 0x4f7ac3f3e8cffbbe, 0xf55d6f18d041e034, 0x247068272247f54b, 0x6045d9789ea43670, 0x2e5f80b8841fe295
+, 0x7677ded21f4c65e9, 0x24f55239d60eb9ae, 0x624f908d0fe86c15, 0x7bf7ad34377d6d52, 0x8683848124c0ec38, 0x76e0b1ac16b4efd5, 0x9c022aaeba91664a, 0x7b43f9a320157448, 0x0e4d3d43e9c0f113, 0x2cfe08081785a1c3, 0xde975257d83116cb, 0x1fed7dc24d87b92c
+, 0xf9e71abe473ca59c, 0x5a997e35dba28c69, 0x12f6f7bb8c430fc4, 0x476346acbc26e7d9, 0x3e7dd953c9440d52, 0x78e171da429a89cd, 0x1dad582385bde2d5, 0x48f29dedb3980394, 0xfe67f13594b035c0, 0x255bfd12550e8c58, 0x274b7df52fbc910f, 0x39f08eb41639bc4f
+, 0x0be9583c83f176ee, 0x23071910576aea8e, 0x2a44398d2a6bfec6, 0x490931d272fbc9b9, 0x1ee371ea58a35fd9, 0x07a75819ab553c20, 0xcca5698f467883b5, 0x0e7a008f113cb833, 0xad32836876c59dae, 0x58274e88c35d7061, 0x4fd1fa4ae8e87025, 0x1e6ad9180e4add9c
+, 0x9a6d0e58b2555e23, 0x45bc445edbe9e0b1, 0x9c2da43daa0cfd3c, 0x53b4e2b4e438e3b5, 0xca9635c3ca8fb77f, 0x03f3f470094c496a, 0x617bf34078c08753, 0x1ac8270e2f8063df, 0xb30497d99f8f24ca, 0x35aedd6b443e1ba8, 0x22548434331a6ac2, 0x2bef6fd0e64c86ce
+, 0xef2ecf004eb1bea7, 0x33d35bfa641f3ad2, 0x2c321c64e49b7817, 0x3c181d669b2418cf, 0xffae34a46f45a7ea, 0x136848728379969f, 0x57389f228e8ecf84, 0x0cf327918137d032, 0x6e5a3afc4ce2c82b, 0x3dd8c7ca0201eeb7, 0xde826f307620e565, 0x7e989975377a07c7
+, 0x37e4f55f1e7f9a90, 0x784beee4edfc7f03, 0x4b29aff5e052c3f1, 0x72a01e2522bcd122, 0x8850ab643888d8c0, 0x23428e57df6e8057, 0x9cca9b487a5bedab, 0x4abc32f75ab8f107, 0xc177e164831b7db8, 0x08a457c5858ee493, 0xf6a42397de3b1a7f, 0x4ed316abcb9ce06d
+, 0x4667f7c9c8add722, 0x2f89ba12ac9ebe16, 0xcd5bb3b06fbfe21d, 0x38956c1d0e98dc7d, 0x214544f8e74a4ad6, 0x3f922fe8b1c0c794, 0x8647635e2df812c1, 0x4d0e6f33a1abafe3, 0x44a33c5cf11951b8, 0x436605c2bd885dbe, 0xed8109082244d42c, 0x64c3269c73b4a212
+, 0xc6fa7c5915aff917, 0x4dbd168d553d01c7, 0xb866472ad74810e1, 0x631fa452f2971306, 0x64d236d939af6496, 0x7779abd346e0436b, 0xfa5629b29a31d52a, 0x5be63113b07c791f, 0x43eeb6c0a29053d2, 0x46028494c96053a1, 0x4a4448e11fcff788, 0x792a56034d7cd6bf
+, 0x225f314b8e796532, 0x327a815b50be25d3, 0xc9f878caf85e2221, 0x2532a86a0df5f5ee, 0xf276bb5d5530850d, 0x4063518b6838d2ed, 0x62479e398caab361, 0x773a8416a5456259, 0x42091320329843ff, 0x36b05c223bb238ee, 0x047b8f548ff13dbb, 0x1ab895613d6d6b6a
+, 0x4d21e0e90ea5759f, 0x106cdbe43555ef0b, 0x40ff6ef7eb45e6f7, 0x7bc8b3978ed38207, 0x64fb20d072ca5ae9, 0x12f9cd3472907e9f, 0x04536df5a656b0fd, 0x67c72754ad0c3ca5, 0xcf0e371b9af929ed, 0x4bc60b5e1424b094, 0xb46d14773969d123, 0x096748da962eaeda
+, 0x877c1833efdbe028, 0x68c581a8443feb3f, 0xb1358facd8607b9c, 0x42abc8dfa223c8a8, 0xa6658dd0f10897da, 0x44bd07697cb6720e, 0x21beabfc6c5c47e5, 0x017b7969e82f8c98, 0x0059bcfccb54b90a, 0x392a70c1538e8a91, 0x068136ef264f7430, 0x0a58827785a0990e
+, 0xff327e38cb9e20d2, 0x6d18e35c654614e1, 0x2d9a8b39260495d0, 0x7a587a7992de0b6c, 0x3d2b57d6492894f5, 0x385b8db43591180b, 0xce4d0c5af74fd0a5, 0x626444989b6b01b2, 0x611ce29656e612d1, 0x0eba2ae67ce5c8ed, 0x63bc6e11d7bd3c28, 0x7bb5df2f9aa36bcd
+, 0x47f64f4805436deb, 0x180efeb8d0cd5456, 0x2c03ea0a1c2bcf36, 0x3a816932aaf7be6a, 0x95651bf099243953, 0x43c1a951bded8910, 0x89985fb01fd0994c, 0x33585442c750ca70, 0xe5377f7e1ea35d6f, 0x75e926491d87ad4d, 0xae72d2aaa5fae260, 0x32a2c5e2f77625ae
+, 0x9ee5896119644429, 0x2ed4a6d350a0874b, 0x86a427984b3df80d, 0x27b03e39d339bba4, 0x5577d5aceec084ce, 0x154dc31d1662b112, 0x570f5cd8058ac45e, 0x53fac1e26030f1c2, 0xef53bf982668d4b1, 0x7649244a7179126f, 0xcbd256f8df630a49, 0x6ed060a52fb1b417
+, 0x5da3cfb67ada150d, 0x7a269df4ee11471e, 0x52ea0b65d92a3ba0, 0x53c343c6441fa4f7, 0x9800b75ce1f68389, 0x5906ff68042e6bae, 0x94ae9fe8b7894288, 0x244234095918d51c, 0xf64006f221af1d82, 0x28b27ee4a9150956, 0xda2a110631ce2125, 0x43e71f0c8ab332a8
+, 0xd2654a5f25e9dcb8, 0x246db88bb856f6f9, 0x25474e9e31a307fe, 0x00b1cd114981a70b, 0x2963dab6eb0c6b0b, 0x08496aa07bc021cc, 0x4a48502f7fcc0c8c, 0x15f4e7dab83d8217, 0x55f3e2e420f1d9d2, 0x517774f47986b4bb, 0xa8a8bd4569b1fff6, 0x5420b79bfdd28edb
+, 0x621e0a8a9fd59bc1, 0x391c11af9b301f0d, 0x91b5df5883a87825, 0x23fb998a432ed1c4, 0x5aac8cb8fec67608, 0x75365120732bedf1, 0xbdc971ebcdb5a77e, 0x3901f34795b41f4f, 0x35686cfc17570ab1, 0x4eb9dd7ba9ce7a6f, 0x37d497fbd51f20c9, 0x1cdca8151719aeb8
+, 0xa818a00c18d61914, 0x5873fa6a087a82aa, 0x62e82dac77a52a20, 0x50d84b9bd95ef5f6, 0x8b12a33343aed53f, 0x502cc43380e5025e, 0xdd10e12df6762f0b, 0x18a63f82b0eebebe, 0x43173e7606462615, 0x7b2410596c535e19, 0x67e372e129382153, 0x24ec13a4503820ad
+, 0xa43e2d739ab044be, 0x5f8f9dab199a4db5, 0x68ae01d5a2d6d03b, 0x0a67d52fff770a79, 0x007ccdce6394ed9e, 0x500fb195829c55de, 0xe4cbed7823fffc2a, 0x034ba7bb0560620c, 0xc433112b2ea1d506, 0x5d31565db2cc2061, 0x54be7289876d629c, 0x07d6b625710839a9
+, 0x121d1d686d095cd2, 0x22b37aec19995685, 0x5f86e34de2bf3b5b, 0x10200eec36844cb8, 0xca75db05abcbcd37, 0x48f3eff6803e380b, 0xe66d44f7051d5f46, 0x00d3e070f5121c41, 0x279936438a9263e6, 0x6ecbb93af5680129, 0xc98fc0302dba7001, 0x6c20c7bfdebe7b93
+, 0x4f5c017861bcbf4d, 0x6e4a4215f5027e02, 0x69513f095284750a, 0x0268b9fdf8199775, 0x7e7114b57fb944a5, 0x7af039e7fb52cb23, 0xe8e16a09a96b8ab1, 0x35b05be84d077112, 0xa5a429d7d5650ea3, 0x2ab6f2c85f8ee3de, 0x8a7d7ba9ac7ebf4a, 0x182cf30e8f172ac3
+, 0x8e15fe8e5e8e6ede, 0x4f6ac49d24a6f798, 0xc8fc68d25210eeb9, 0x4aafaa025ccbad9d, 0xd2c664756ebf8929, 0x65ac366de1cae172, 0x02d09c00c9f7a4bb, 0x1d8c5db5d1f56cbb, 0xa075117d846eb4b3, 0x1b8b2b957c6052ad, 0x843b1601eec98dce, 0x5433b0d20f6d5e14
+, 0xe6796af5d3433c8a, 0x265a249a882ef10e, 0x0dfe0d8292517196, 0x2a233be5c07e4860, 0x10232d7fbf9060a7, 0x1684302a925c8ac7, 0x86abd5093eacdbf6, 0x7432bd1e77d257d7, 0x2b071df53138b6ef, 0x2861132798f0c4d6, 0x04c8a7702785f865, 0x47fa14c4cc0edd9c
+, 0x0ed04683c73a98f4, 0x12b6b5fa3c49f97c, 0x879718c539b5f4e0, 0x6aa729ec090810a9, 0x88f84553507b3b70, 0x4976719a1eda3c9b, 0x7c53870e4eba3de7, 0x0ecc8eda06f9fd49, 0xcd6ef538857d2bd7, 0x762f9d3daf7a22db, 0x3563fc1eace3447d, 0x5528486915b63119
+, 0x3126909fef43a237, 0x01d39a7059e1c0dc, 0x3f07facb055d5315, 0x69cc46df05cf4558, 0x145318ca5513bf55, 0x0e7a66da6ff467ad, 0xee3e8c905fdd266a, 0x16a03e87d3f90f1b, 0x5f646f07cc140a23, 0x23e98030b0268e67, 0xd23063199924387d, 0x55c99b296dbce1f2
+, 0xdc175f14a6486000, 0x16cfda9d7f8a3892, 0x62856aec32be55be, 0x2ea1267a5dfcff47, 0x6db7f87c5c66a97c, 0x7f8c6f2b33ce5b9d, 0xae5ef95088a6a539, 0x27b5018093f25c16, 0x5e07d8a719d94350, 0x721af82fe31305e6, 0x8d0708ef482827af, 0x5e6c75347d78f244
+, 0x85c16a24254f8ff2, 0x4fe99bb70cf2e0cc, 0xfd5beb81877e3676, 0x2cd2e384bea91f6a, 0x9ccea3965e60f4f6, 0x37f246015356042f, 0xf52fecc695a19152, 0x28095c4911d252aa, 0xfe13bf2f5721141d, 0x2fbf2d75411f697e, 0xbbc602801f37afbd, 0x21d7525e501935fd
+, 0x0589617b52cf6525, 0x2de8d1615df4c99f, 0x7d72445d885f4313, 0x67eb1d2dcff94c08, 0x529edc422480a5de, 0x4b826bd4f93d522b, 0x519ee8f410702bc4, 0x0afe330c51a747e2, 0xd6011b2e8b828559, 0x68f4ad28e3a49249, 0x36c63011971c93a6, 0x414e7ee221b95e36
+, 0x1e9b88b14b8bfe25, 0x24f325cfe5d23359, 0x5e0923884f0c1750, 0x053f1decd57ad63f, 0xe1a70de841684470, 0x4a0cfbfc0b6d4660, 0xff34059b32e2eb36, 0x330eab2ef81763a8, 0xdcf81dcf420d1c00, 0x679a2f25ccd74d2b, 0x4e15995e29fdec77, 0x2a6f7064686c56f1
+, 0x3490d8e33ae115d5, 0x456d2dee0a08ed7d, 0x474030f5e41fcb04, 0x6067d6d59122df64, 0xf031fa7b9972af90, 0x727d74b59ff418fc, 0x58c53eb48462b6dc, 0x7d1a12c45324e05f, 0xe155562316a10e6b, 0x3f63451ccf4d2a5e, 0x6e8f9b421304dc88, 0x58b12e9941f07617
+, 0x6dcb2ec2fcceb3bf, 0x647d1d70532eb108, 0x6272ccc035b2f23f, 0x08df84316b1e5ae9, 0x0e64984f88d463ff, 0x11796d710857de30, 0x25f10c401ba10b33, 0x408a9bee26c3a9aa, 0xd59d9c75175b6abd, 0x24c5e512fa0e5f45, 0xf27c7fcfafe03b1d, 0x01a574d9eabffdb3
+, 0x3ebb3fd8ba63924f, 0x52e8280cd93e5031, 0x362b49697146a60f, 0x6ecb39eed37c742d, 0xd5e0ae08463b4067, 0x469bc88a8646b39a, 0xa254ab02ed198cbd, 0x7a0eac620b0cc878, 0x082735b26141b5a7, 0x711714d3d2375c21, 0x3a29530e42e55ec4, 0x75e575e3160a923a
+, 0x2df90ee29ec5b726, 0x349a57d40ef6cce4, 0x3044e89f116aac92, 0x257c2869c07a1a79, 0x8ff53f966f660bf0, 0x73a2d60efdb9607d, 0x1d2e9b19d841974e, 0x4240d6653f9dcd98, 0x788a61bdea0c0cd3, 0x2dac60c6399d6504, 0xebbccbe060e38bd4, 0x4cfdee86d9f85f52
+, 0x50c3c020942e435d, 0x751839317e98c7a3, 0xe7c59b85a586c43f, 0x6709e20f59d582ba, 0x55955478826933db, 0x1e4bb6db00a45076, 0x743ed11c06a5c58f, 0x0c3fcdc0d6e0a816, 0x62942da9dcb70fa8, 0x1752096237bf3f5d, 0xde2842a020427183, 0x123fe4af1b08a800
+, 0x35f3ef9603ecc704, 0x37b33a0e109c025f, 0x99acf6a9f4d0ce88, 0x396bee3e329b6cd7, 0x8abce6c51c64ad78, 0x4effac358d0fd28c, 0x227a4bb590164cdc, 0x0a4f8c2e97530f5d, 0x991c0e53ede10498, 0x15850505974dad55, 0xa20f4f5d93555a44, 0x1209ea2615d604ec
+, 0x4aa7359372aeca1d, 0x346974977032f180, 0xaba51536ddf5ac6f, 0x3b36e30ab0e90b74, 0x517f4f634e6ef034, 0x1833bb8bbb6753f1, 0x64a1731507971cc7, 0x44ac7a5a5ac616ed, 0x41812219350eeeb6, 0x21cc187abc690818, 0xb0039ee2cfd02275, 0x5e8ce657a4cfe521
+, 0xde0dc8ee6f5474c9, 0x7bdc7e3fb6b7b3e7, 0xd323e302d8bd7a29, 0x65532a1001c417d3, 0xe5d5ef6926115f6a, 0x39fe2e973f4b9e64, 0x35d79fff0f622574, 0x3e5197992f149ac5, 0xa421cac116554d4d, 0x5581a4f62da87d0f, 0xa062c627c8be6fbc, 0x1b2129d867111986
+, 0x96cc85891f249cd5, 0x1fe335ce9811bc0a, 0xb052469f490f90fa, 0x1dec8a439f98b148, 0x11d06da3fbbf8ed7, 0x025a13ac153285de, 0xf7c64bef25a1f7b3, 0x582db64135e3a11c, 0x3e1ec5d6bb760d71, 0x0c27dbcd0de3c09a, 0x405602537b295c8e, 0x1fc6677b2ab06053
+, 0x3ac930e99b2a480a, 0x2967f1d7da119e45, 0x721f5b56246e4db0, 0x2ac2cce1b4ed5eca, 0xd39a893ca0317776, 0x41fa317d2a3cebb1, 0xf97a1f432e727337, 0x08ac1c571fbb220d, 0x869643db18f00307, 0x5626fab368470c6a, 0xf12a75d69d21ca81, 0x77e898dd71dd47b9
+, 0x8909e7ba53082b18, 0x3b489172a889c813, 0x1ee40d4f0efac492, 0x7f61984245f01340, 0xcfa5140a73f2fb00, 0x77269cd38bc07337, 0x5132a8403b4270a7, 0x38ee33b3f63060bb, 0xe6bf2bcd20b09d07, 0x69c350fc954d0087, 0x89fc5ab8e9fc3227, 0x5f71613c41f28e5f
+, 0xd41bec8639206eb4, 0x788ec2da868f3c61, 0x89dd7e118594a059, 0x245ea3f321b952b0, 0x530a9f786600f9ed, 0x40ce55da3b8df2ea, 0x623a245206c25fc8, 0x0a4c8608b8ea834a, 0xed5d7919875e97a8, 0x1c831d28016e008c, 0x376220146576152d, 0x41d754f710ea9666
+, 0xb47a76cb0a371edb, 0x73752fe2e2fd021a, 0x19b8ee2f0645934e, 0x4395ffa340f31dac, 0x3aca2b1db789a3f9, 0x08b6e8d2629495db, 0x495c1b2fd9948ed2, 0x05447f96e9e548f1, 0x1005771308ec6fbc, 0x53dede69a3c15a1c, 0x671d047bef4a6081, 0x159aae0426a2ff75
+, 0xf03c5c1141114cf3, 0x34b9cfb212c97ce2, 0xa2c4074fcafb9bfa, 0x62708af72b69d419, 0xb86f9f205983cec8, 0x31760185ffec4283, 0xc8c57ba81f2a0b88, 0x08e18fbaad2f1fee, 0x66844f026147635d, 0x7302c8bc7992ea14, 0x24b1b3299c9a7536, 0x13fb23eee8152bbc
+, 0x785245ef4c618903, 0x4d45671edcd68ed7, 0x7e954dd0df83a56d, 0x4aca948c389ab7c0, 0x60dd4f314abff3a5, 0x41da4a43bf452a52, 0x974f54316fb03072, 0x4d12a6cde592accb, 0xf2781f1f919dd46b, 0x5d2cfbcf674f0249, 0xb3b5593364ab6f5f, 0x2c7899d17d015dcf
+, 0x252c4dbe31391b98, 0x3264202bb2676197, 0x6627497b8f16af26, 0x542d52886148f39c, 0xdf89407752ce9a84, 0x35f36b39eae416fa, 0xc63ec5e63d62cbc9, 0x18478f1efa48a7cd, 0xcbe80c2a81195144, 0x7491eeadac143a86, 0xf3cbd029ab3d2458, 0x5ffcdcc3e5aa0d9e
+, 0x7c0c847a18c4b2c1, 0x7fdf047d61598566, 0x052750dc5c761d24, 0x4e03f2f65e2c79b8, 0x4b31b4340e53440f, 0x57cdd3641c8a87e4, 0x7705be455e465a72, 0x6702e62aba2b5101, 0x03d77ec958f6668e, 0x44429f46d3752d3d, 0xe58f0dec1b769973, 0x53115e089041215c
+, 0xf4564d234cdebe39, 0x37d0fc88c2bae5be, 0x945bc425c0f396e0, 0x3ae6f7aa4085fa33, 0xb003ed7dcadecc05, 0x67f23457bc4b659b, 0xc2b79160be140d90, 0x257bae9f7c12baaa, 0xc9f506786a0ea043, 0x4e86059ac1f80be5, 0x9a0e9258dbc763af, 0x4e7ded88144c6d63
+, 0x892ec82507f6ad1e, 0x0e82c7ebc54a89e6, 0xdac766363dc8d98b, 0x5a4bb7d80a9376ff, 0x35e0056b56cb2d65, 0x740609c5547143af, 0xcb08ef3e3211ac6e, 0x45153a9cdb75e86c, 0xbc2cb9be2878572c, 0x0a801c91cd8f29f8, 0xff8cf431c312d880, 0x231c976c321a31aa
+, 0x10299e6c91449773, 0x36d136b5a22c0bc0, 0xaf4f9c9c5995d17c, 0x6acead2b2c12553b, 0xb2b4bab4ac9714be, 0x5882db7d7a5ce218, 0x2664f60dca37517a, 0x088bd448e55fb520, 0x8f35f27060d2f49e, 0x151b62d8e0ace7eb, 0x832d5666f41a95e1, 0x6c7149b8e4f85838
+, 0xbe305c8b489b3aa5, 0x7f7c7b203c6e336f, 0xbfa7eb8e9a610419, 0x2b2141ca5a498d54, 0x369b5fac98a0aefe, 0x31a87d14594979d9, 0x2b51b31807186eba, 0x472049343dbe6650, 0x5c3f05a5d773d31c, 0x28138b4474e61e97, 0x6c5b9d755be6c507, 0x5a7fd117807f0e23
+, 0xad8267f591446ec8, 0x24227f3bfc73be68, 0x924845a754311c54, 0x3214b1ed9a0ee20f, 0x877c26b8a1251ee3, 0x307e45eedd32ddd6, 0x31dffcb0708b5d4c, 0x1f06993d5727b2c7, 0x96dda46e751e60a0, 0x557934f125480bf8, 0xacb76fdf092d1832, 0x599dfa5bef7ca26e
+, 0x83ce9026ce642dd4, 0x362538d4e8b15968, 0x12153e0884f61112, 0x4924a8b48ffe05b4, 0xff5d1df85688f1cc, 0x327fed92fc18c492, 0x8c3c7d9abaccf171, 0x79a94e2e51d0d406, 0xee24b6741c0fb127, 0x3a69df87a3ece372, 0xe34730dac3008bcf, 0x7d1501799ea107bc
+, 0x907af0db34db7121, 0x58dda12e5e6cb70c, 0x12d9ee57f4207eba, 0x7ca1b6754a50c426, 0xbed5a9edb0adcfb0, 0x4e867aac5e8abe0c, 0xb77950883fbbdf16, 0x48d410fb67cd9cef, 0xa379a4d061f87698, 0x343c6978cd23f360, 0x8887031773a54614, 0x155b812805de0492
+, 0x78cb1e592940335d, 0x231b17bee711609f, 0x7db2dc5d956ed158, 0x3a71a1695f023bda, 0x870386e83abb63be, 0x2155d42407db300f, 0x98fdd3ed48ab7604, 0x4d3792dbc1a4cd28, 0x5ac991eb1522d6de, 0x216be1315215cec9, 0x899dde0385b4cd74, 0x6fd34abaf5a07eb3
+, 0xd8658a3f9bed90c9, 0x7cf4ea2ec1ce821a, 0x4fdc0aa118f8a919, 0x0d336de28cdd7845, 0x28ce53e769e4606f, 0x21621d208797bf66, 0x67ac37e897c952f1, 0x40a28efc0770f0d8, 0xaae9de98b79ce7ef, 0x6014d5b7482d2878, 0xd5152a13877ef822, 0x342ed045e1302fb3
+, 0x4f046f07254c0b6b, 0x178cd9dd99ffab2e, 0xa9ea58271643a406, 0x59672ebd22086400, 0x8340f6f6e9804613, 0x256dffbf883fc954, 0x96d985aaafb8c760, 0x4c01f2f20323c198, 0x99ba6db0bfc6d01f, 0x29596c0c790c93f7, 0x4536609e09ca7cad, 0x566078622bc075f2
+, 0x7d823ef55363864f, 0x68f9cf85abf44e1f, 0xbd56d228701ece71, 0x2c101459f7868fe5, 0xf337252a1d1e56ea, 0x68d15fe4e57ea8fa, 0x31be4c0d10b9f098, 0x287ac6fb513db396, 0xef64b0d0291b5cf7, 0x6ff533faefdf62d5, 0x4cc88968d69b35be, 0x36fa86f45e7c3458
+, 0x9e87cb153242f70c, 0x387da58614e47535, 0x97ffa67125912e74, 0x425fed985bdbc964, 0xb20b0784af946449, 0x32d09445b4258f9e, 0x2a9c3cc39ed8365a, 0x43645972167930ab, 0xf0dd634b66b77523, 0x7eb2182d10e88de2, 0x03a7aee91da31c19, 0x41976579a16a3c79
+, 0xcfd5aecd35a993c3, 0x6a365781768749ca, 0x4eda95e7325c6161, 0x3a1d877fdfdaf72e, 0x553b852828cb3afc, 0x1c7872a446e23abc, 0xb27a96e4d8fd1aff, 0x09d0c92e7a480fcf, 0x6d2a71ee48717796, 0x0780fc7aff81dea3, 0x575cb6a5dac9dcbe, 0x7b7d459e446fbbb0
+, 0x2019e5fc93c4630a, 0x176cc7ca84545f8a, 0xabd7135d474a6cb1, 0x62a6bb8419cedc42, 0x4412f561521cc644, 0x3b23e11bb0e9b01a, 0x8d7f841d52547c84, 0x30e30c87cf7f0636, 0x8820edaa86472bb4, 0x2fbd51f859085820, 0x9462c50605920c3e, 0x001174cbd6329d9c
+, 0xdebbc7c208c6dd15, 0x707875585d13aaff, 0x6e7f03e1ad0f928d, 0x68cb510b3dd62ad4, 0x1eb48a3b15d2d03d, 0x4730d93a26e93a7a, 0x57fc5730849ff0e8, 0x2bde43dba288a68f, 0xaac8cc65b542c33f, 0x6bbb4560a6b42eb2, 0xbfb896bc89fa9d24, 0x42f431ff73f225e1
+, 0xc7c19a9b42816472, 0x351264490d4f0dfb, 0x6893fdd1c19bc94c, 0x3969ddeb4236caf1, 0x04e7975203c32da7, 0x4ad86f927db47e8f, 0x6c1900369de4150b, 0x293859ed5f01f9b8, 0xc5589d4dac379956, 0x08aca89d23031b66, 0xeb53228cf57b10f7, 0x2303ce8ae2869619
+, 0xe21f81f9391ec6f1, 0x54cf00de70c651c1, 0x0cef0b189b04ccd1, 0x7931279b7d7a84a2, 0x19785aeee7d32564, 0x65c6b67941526d85, 0xe31d6c25cd30c6fd, 0x5f7b7e27afd069dd, 0x0970d0836c6d3ac0, 0x4ca548193910325f, 0xff9cdc2fce09aac8, 0x6379895691ec7dda
+, 0xa243c8c3fe0d6422, 0x7a2fdb5f6c226e78, 0x5da647387bee8c9a, 0x7426280f4d011bca, 0x272cbfdafd9afe20, 0x692079ab40299f86, 0xc9346930ee67370d, 0x5a79e18885ee9a7a, 0xcfcfae646305887c, 0x729dc34ca4ff94d1, 0x32827e8d44739a3f, 0x2827dbf427aee886
+, 0xca7cccf9f380da25, 0x0d67d65fcad037a9, 0x9452833c7c85a73b, 0x2628f5ce6d62d717, 0xabc28c5a62e8279e, 0x38495feafad31926, 0xea51efcf354fb452, 0x360e3fb4f92e4a7f, 0x1add5027a25aff52, 0x0d7f80358d9316d9, 0xf803653486ada0b7, 0x7eaa94b99c3b807a
+, 0x6aaa05c9c8a7ee62, 0x02459a0087e194eb, 0x2a3da85c32b8620d, 0x05f284781429deeb, 0x9df891b83db674df, 0x201ad6ad00ad7ce9, 0x2f68328243afdc37, 0x4dc2a6014dcf98d7, 0x1e12d45703686805, 0x5ba675402cd8be3d, 0xe143643b80d7a629, 0x5a9674be65e5e9ef
+, 0xaf9a101149938035, 0x0bd128d511da5047, 0x67eaf2363596e847, 0x4c12b63985f28541, 0x25b2212e957a523d, 0x49388cfdcf2f8525, 0xbc2bd337833c11ac, 0x6f76743797a992e7, 0x564deec27cb6363e, 0x72abb8aab48e5dd6, 0x2420593cb14974e4, 0x3c2135b2dd20286d
+, 0x0099ae4af9d883d4, 0x47ab85a9529d8281, 0x867161160b0868eb, 0x29dfe4c8eaf2e9d8, 0xcdd41fc47250464b, 0x3474329a4d06b0c0, 0xf004697ed6bce62b, 0x4e3bb58aa54fae49, 0xc942b64d1ad7a314, 0x5f1d20548616d4e0, 0x505467fc390f3c5e, 0x229a76f443102dd3
+, 0x05bab820317f03df, 0x7b64a53dd9c7ffbd, 0x82e3c00baecc4bc2, 0x3439371ed35a5c4f, 0xadbfecc8ee394cc3, 0x49242d6d2badd585, 0x0a3e91cffd30b332, 0x785c5266ce372166, 0xdb7b3986fe2ad187, 0x721ba035538b3295, 0xc3186e9ed6f168c4, 0x20a130780431ce64
+, 0xe4c08c222ed8a16c, 0x76e18faba524e962, 0xba87860c9dbbe801, 0x2432af25b44ea3aa, 0x5813fd98bf6ba57e, 0x08003521c47d0538, 0xf8ba61a36d2c19e9, 0x3d34f7f67437953b, 0x610a4f97511a1242, 0x6864f9751bf12437, 0x06000b5e3a8adcce, 0x46ac582a47425cc4
+, 0x46788059e61dd80e, 0x5eb70a71eeae4069, 0x8517728ebaf07057, 0x45ae282535251a0d, 0xfb2932846592257b, 0x355493f3358743d1, 0xf88f83d80d0e1b31, 0x285f7252116e1cdf, 0x327625959a23ea84, 0x1abf7aa4a65e1841, 0x76644a7fb6315739, 0x586fccdab6aa013c
+, 0xafff23d298bb67fa, 0x49e427013437cb19, 0xa3ba7f96dcdbdab8, 0x793634343b5b98e0, 0x62bee9f9a1433697, 0x1a2c34b4553010dd, 0x09fe55bb3397238a, 0x73e69f3bacd0bbdd, 0xca3d10131a591b3f, 0x4025eec2301429d6, 0x4b1da7f137b11228, 0x749199ca325a6484
+, 0x4af9df4bc5c14431, 0x7700521617195bcd, 0x7d45f359eecfc76c, 0x3cb8465d4a84fea0, 0xeab0f33de328ed1c, 0x4bf23d4d985aa081, 0xd7ef1cf0430a4f14, 0x7debb72125580dbc, 0x1630f80ebff63864, 0x31523db231652a7a, 0x31525fe1b7b5b6d1, 0x27cc629155971e02
+, 0xe6d5758d38945ec0, 0x149ea7f2c7d685ae, 0xae729b41b451fe93, 0x12a9da8a81ccebd0, 0x666d1a5f39d47b12, 0x59147ca0dec2e2d7, 0x8816219d7dc90592, 0x310847aeeb8f3915, 0xd4bd5a283ee216f5, 0x02be7933b7a3340c, 0x1f91617b59f94105, 0x736828f55b0a8ad6
+, 0xd1f0b06b881f74ff, 0x68d440138cc64402, 0x97ae138c9d530d36, 0x2516caeaf10cf252, 0xa4bc71146948d235, 0x51003304c1e945b1, 0x1f4943ff11e165a4, 0x680d24628cc049bb, 0x62cd86a7dc8f0d88, 0x43d2a717069e3aeb, 0x60e1dc6ae1c71181, 0x3615d8f8f822f4f9
+, 0x75182e810106d2f4, 0x0612edca4b9de1a2, 0x25e8a1ca72b93012, 0x5fe7167c5a4f05c1, 0xbdf74e5482f44acd, 0x17b1b70e32b43314, 0x3da7585bea2e6a97, 0x19ce3f6e4162ae10, 0x0816e33eb2524cd6, 0x11fa061af429ab84, 0x28003da4db92fd66, 0x6136c4d060d7aa08
+, 0x9c900737d07a57e1, 0x4155f098438c66fd, 0xae90cf403850b84a, 0x6333efb121ade9d1, 0x34b6c83c59899ae5, 0x760bb6e1e1851eee, 0xb308c6c9ddb4dd64, 0x01f27a38fd52c60f, 0x43d5d080e25627c3, 0x3ff41dc3c6d4dd54, 0x60352b65a0217ca9, 0x489c3d33a7d2c917
+, 0x9706d5cbc1498e08, 0x49774a57d86e4c27, 0x672b05955452d8b1, 0x2d3107d60507962e, 0xfc4e9980aa5534f5, 0x439cc2a390fadb83, 0x9d269bb4a6ca1abe, 0x1e8049a49c56bde2, 0x837381bb05c519dc, 0x46555a6734b5aae7, 0x5b072f3c83fc52cc, 0x6ccaf32b87fe5181
+, 0x6f9cb7e6ae6d3d0f, 0x7215f878b586ecb9, 0xfe34b7ad775fb093, 0x73a92d74d2c1a2c9, 0xa6b69a0c4dcfae39, 0x07d380a539db26ca, 0xbe4acf57af6c4abf, 0x4766d2e5a527b5ff, 0x01f9ec5b220c3194, 0x0a6c59249272f602, 0x91d929a2a5438db4, 0x2fc6ca815ec513cb
+, 0xbcaf63f649ef6b15, 0x238bc7a04d002423, 0xb8ad15241ff1952b, 0x628c04354b222148, 0xa9e5a43233ba57b8, 0x6d8c8d27e85fd571, 0x0c46c1479c942ac0, 0x7518aa03091e2e21, 0xbf424f1f9400a1f3, 0x38540f7e978d03d8, 0xb4397417277e8e60, 0x0b38a59b12fcc472
+, 0x07df231abae0a598, 0x23f9516c4a16b82f, 0x4004a6dccdc415c2, 0x34f3b3f21dca9290, 0x8916250888e9f51b, 0x3dc91c2bef781da2, 0x3463a2ccd51b1494, 0x0cdc9d7833d49645, 0xf7b9f76704f5cf93, 0x266b32b926e7d3b3, 0x46f6f2f435924db2, 0x2463740a168b6e9b
+, 0xa53e84dd41e5b57a, 0x2ac13fa98740fdf5, 0x3bf61032c61da4fa, 0x45d67cb1ecb0c8e1, 0x6a34c696b512efec, 0x400a723ebcdda8a9, 0x131a2d8a0e4c1e58, 0x672b888aae218c0b, 0x37392602bcb12c1f, 0x1b5b2034037756fa, 0x928b0d8263772da7, 0x1e33578b0b8c7071
+, 0x5883694a7413b671, 0x2e3bd176d72c91f2, 0x67a8687846129561, 0x796a17cf4b9e132b, 0x6389c6112cd94d2d, 0x13ea55f62d595301, 0xfa7c21bc59dc69ba, 0x7afcfafa64f2bcab, 0x21d9a4fdd50b1bf6, 0x6d86f3663f2684d7, 0x455ac82fecf5739e, 0x5548b4a3755f70bd
+, 0x30aee3f6b82b6ef2, 0x42b50ee7da381fe7, 0x10c6c1777042bd50, 0x632a1c6fd0b36f23, 0xac35cf05179517a7, 0x0153c3f3130b802d, 0xf7e5c2bdb2ea88c2, 0x2483356107b3f289, 0xe8f6d8938d040036, 0x3d585de313d4d928, 0xe63a258e8956a48b, 0x585889c042ebcc92
+, 0xc7bdc87a8e7b6d0e, 0x60d53293339cebd4, 0x83290c4ff25e00d9, 0x3dfd4862e5a56bf6, 0x5911f490602e1ef7, 0x1124da35dcdbba90, 0x67f2891cc716956b, 0x40947af76bc0412c, 0xde27cd195b1ba276, 0x2d0651ec056ae4c0, 0x8ea24dacdddbe36a, 0x2336a714aa8aa1bc
+, 0xd941a37f3cf952bf, 0x1e446695960c9869, 0x14fff897136d73dc, 0x6ffc55d988319000, 0x71431fcf514ba469, 0x68aca94d2c63cefe, 0x9d871ece5d2759a1, 0x3b82ae3b7090e8cd, 0x4219f2b612552985, 0x69b0f43e54d39be3, 0x461761ef3221fcb5, 0x41205761af5128dc
+, 0x7ac0c649a1645d6e, 0x6461b77fb74d5d04, 0xe14506bf19c96178, 0x39003ca22e6659e4, 0x0b51445f177ccbbf, 0x5050392d34e1e2f8, 0x352364c24936c644, 0x1cd974329ee5e43d, 0xc87c74d47f124649, 0x5d2550a668a61bc2, 0x4c8f1bef132f0520, 0x52de260622d84974
+, 0x0a9d00dd3d39227b, 0x3ab03eb80f60484e, 0x30d212d1c5ce7c55, 0x19596cb034994165, 0x51a579fcbc07097d, 0x7a152c4de10f75ca, 0xdf8bd4ce6ed03fd5, 0x22018862c719cd73, 0x4f4d8ed731b08a43, 0x65816eb2efa678ae, 0xd0e14805b54f0755, 0x0e82e538f3071a8a
+, 0x0c6174af1a5340c4, 0x67728e29ec6b5cba, 0xe0e13a0476aa933e, 0x455cc7d8be2b783c, 0x8b54627aa37d5b8f, 0x65db3857b0942f46, 0x49d266f995343a22, 0x67ad3223b2cc23f5, 0x90319408de7818db, 0x2bc6ec4d20a063cd, 0x6556381093e8ea0d, 0x48ca452d5cfbe7db
+, 0xe49787f664eb07ae, 0x1ca79b5fc18c83fd, 0xe3d2e69d547fba83, 0x6255fc4ef4b95a42, 0xcd35bff1c9ca7bfb, 0x3fb5e8c853c4332f, 0x79be7393ffb7fd61, 0x4d1b43cc1e0cc99f, 0xfa6be8d0bf212d40, 0x0bcac46eddf6c37e, 0x5f9db43c1a0ea8e3, 0x70ba84661ed82a89
+, 0x666d8aa32a8faac9, 0x421526fc7b010ca0, 0x53b5edda8a6c4fff, 0x4d3212a59b8f1155, 0x7e5ad567a8d9271d, 0x02a95ffc4123b42a, 0x9ba66f8984314973, 0x12839d694401be7e, 0x407c271f41e8415a, 0x7190d931f08eb726, 0xa985b2459f931ce7, 0x289bc5e8a88a8913
+, 0xb747e6042966edf6, 0x3210ed7281a138ae, 0xf3886b9891887580, 0x40d6c7f58f924d53, 0x65f9e270022f671c, 0x31f89a5cb3818daf, 0xfe5b4be2f777c3ed, 0x46b91d13a8b956e8, 0xac9f378dad3301ea, 0x1fbe44bf0b6c75b2, 0xdec3dc53ebd4421a, 0x52eb49367bff4d31
+, 0xec598c8c8974aa98, 0x5da77a6b88a524fb, 0x8da3181c170563a2, 0x46465704027cbeff, 0xabd48d48ba65fef4, 0x6ded8de17fac7d39, 0xa47bdf06a79449bb, 0x491231c668fb23af, 0x633f7e91b7d6cbba, 0x50f34ae72d507306, 0x03d99b4deb7829b6, 0x568fd0a560b8eebc
+, 0xf1cdae9bd685a0ac, 0x10ffa62f3b9abd6b, 0x991e8d008f8cf5ff, 0x2e35d4294aeea889, 0xa214f7684cde8886, 0x242757b98e49cb60, 0xddb6c9cdfd165a06, 0x597bfcaca22875fe, 0x3564715c44bb1459, 0x0f449b66972386d2, 0x4c09cbc46d5879c5, 0x7a7b0fe79df0de68
+, 0x98d80c3aaacbba74, 0x591f33999433ff5c, 0x9d3dbd0d73875ec2, 0x443d4a1219ce22c8, 0x02ae918bd380030b, 0x601f9657d7966f90, 0x8c092eb9d2941381, 0x555806d21806caa0, 0x019ccdff981bab44, 0x650694baf738d780, 0x21ec240e3c0ee749, 0x483fbb3de6a84de3
+, 0xcb4bb6b87d4ace3d, 0x2cbcccfb1097a9f2, 0xae5948cd717055d9, 0x27cdd125ab78e4d6, 0xe07039a46567248e, 0x577129dbbf64dc1f, 0xc6335c5a823089cc, 0x4fc0f7b73cff8da0, 0x0de4889b3ea0aa57, 0x0632b7e3436426b9, 0xf5884756bcfe589a, 0x7ff758ada872b850
+, 0x5dbe4091e6b371cc, 0x56a07951b8e2e9f4, 0x3c97ba4b8fc91ec6, 0x5c9e83a4a6f37170, 0x95eb0e702b3018d9, 0x3bb8818513e20bf4, 0x08de17ecf2c48d4a, 0x7ce32537cfdc4753, 0x6ded1b0a23670bb1, 0x7d44d04e090b4159, 0x8f7f1b200d79abf1, 0x1147362c1680df6a
+, 0x505436910dd06559, 0x411fb1b147f552db, 0x829a7ce5c70b002c, 0x1c35b0b29c5cff52, 0x78c5ada857cef517, 0x44be62d9210ea1e1, 0x1b2f1606751757a9, 0x3e4fd39b5026c896, 0x6fbf763e3862467f, 0x03716f41f38d7f3d, 0x45131509b00b7556, 0x2b631bd0d85b23d2
+, 0xabfc5804a59b06a7, 0x1db2339a9dd8af2c, 0x0820273650f88ff3, 0x334a568010f7f844, 0x3bdc49089e6c2630, 0x34ed9b6b2f93dcea, 0x1c7b0d35e3a14260, 0x19aa8b5b1a71245e, 0xc767fc016fd2a80f, 0x0e0e76b5c149ec39, 0x957c643093a14d5a, 0x7669fa648c811092
+, 0xdefc853bfec53d4d, 0x7030a86d6c9665fa, 0xd868448b1c482324, 0x490b8f83b1a5ff5d, 0xa57dcaa03cb2fd49, 0x12ff88cbf4f67d96, 0x45a538c710d6a6ed, 0x3de881400653cf63, 0x1aa7d0d948e484d9, 0x198c5daaea13d163, 0x12b631cc42faa640, 0x35eeb41297b06e3e
+, 0x7312bdcc01aa56f6, 0x51663e62978290f7, 0x7f3b321f638cbb86, 0x28c2c1540ad6ba0b, 0xfcba33a10e3bdfc1, 0x16055b675f638d2c, 0x69d6a60747ab8900, 0x1b1cb3f84693f7bf, 0x72f72318799afcc7, 0x679067bca2006386, 0xb4bb614a00280742, 0x41a00df0ac7cc5d1
+, 0x1b53b3b838d98c51, 0x387bebcc3c491355, 0x0652366ab75d757c, 0x4afa75e416b96bfe, 0x71f50fc6baf9968b, 0x1e9bdb4a6bfc5240, 0x39054db60d4425f2, 0x500771e759223648, 0xaff8b15cee227387, 0x49a9f19478ca885d, 0x89e372b2ef96dad2, 0x6f2df06d2060e72c
+, 0xa32d18825f70b891, 0x60a6343fee8fe9a9, 0xcf98e43b6aa4a22b, 0x57aa7ecc82e292f3, 0xdbb421619d2af887, 0x07591e39ba473f3f, 0x0c288984dacc0309, 0x39823a8632a88f76, 0x9f3dcc8fc123c419, 0x0d939fe13679e6bc, 0x6a59f417d74a74b8, 0x49ab4eb6848417b8
+, 0xcb528a240eca91b4, 0x139dea8e213156c6, 0xf5837fb20bd2f6b6, 0x571f2a23d2135af3, 0x8b9e44d9a523f484, 0x5b02d70bce3f7c6b, 0xcc51de8e22d55a9f, 0x7fee8bcf70848d48, 0xd825affe7463e505, 0x1ac67b8862f5d101, 0x6fd02851f37abc13, 0x0aad9e83ab528134
+, 0xcce12f7581e66edc, 0x7f1d502c6eb42926, 0xd71b0d7a8322b9ca, 0x1bc619d6e4b1a1bd, 0x084f4946817702f1, 0x629a8f87f0aeed72, 0xe4c968d6c2994038, 0x6baeb9cec0ecd749, 0x9fd7a37dda2686f2, 0x472d18f329770937, 0x5ccb9d02b3f775fc, 0x7318066790f7609b
+, 0x22b530e70c70167c, 0x6f921a60081ddd05, 0xd3855f55bb42c7db, 0x5261540111f24fa6, 0xdd4cb9ec86e34afc, 0x64a5c104a172dacd, 0xc0864c74c9e6bd24, 0x2e68049c58adbb63, 0x335995c0e65a82f2, 0x703cf11a1b4ba098, 0x270f04a16b5472a7, 0x742860aaae819134
+, 0xd0a7d988b5c24691, 0x378b38114320e874, 0xca3136a6e50238be, 0x49b5591fb838936b, 0x51b6fe7e2ee858c5, 0x5f35645a4b5dbafe, 0xddaf7bc607a11316, 0x3d7bef166c45fe5c, 0x55fbf01bbbc31f59, 0x63a5008a76275af9, 0x2975ec55ff8bf455, 0x575bfb574cfdae4c
+, 0x4b299a97ba68bc53, 0x69df1b75ac9ca75b, 0xa57b375e91b48f41, 0x77f78964fa18680f, 0xc175ae445bfe85ba, 0x1df8f4aa777ceb0d, 0xdb0c700bd7612ea6, 0x3d037be30351e506, 0x73649704d24ea6f0, 0x51ffd525c6493928, 0xd01ae83638fb6a0c, 0x454d9933f47a34e8
+, 0xac92643921ad5c58, 0x669281657763810c, 0x04bec5376b9200cb, 0x3ee3832e32951804, 0x8b17dde2d07f0b8e, 0x5adf8eee4ce58e0c, 0x60f0b435291da3c7, 0x0213c3706ea59fe1, 0x817e7da2a50f74bb, 0x6c65cc65d0865b7c, 0xd3a8b1dfa0ae38d6, 0x2450c2ceef0f73df
+, 0xc972c7154af0a228, 0x3690644b644785a5, 0xc0417a39e9f4be12, 0x6a6d26f8c3875f8a, 0x8e3a5534e435c0fe, 0x2078ed8374392af5, 0xe804f6d7f5228147, 0x42fe22326b974127, 0x1e2705725051fb16, 0x70e7bad01edcaf9f, 0xbe607f2f3535bc90, 0x4153ec2e60f6faa2
+, 0x12e26ad706c897b2, 0x58cd1cbbac9042c5, 0x6a5c94fe4dbde2ba, 0x266e3b10f4033031, 0xc19f94275ae293c5, 0x744d37c63e11e20d, 0xcacc6ba3b91bdef5, 0x7c83fe8f00f017d5, 0xe29916bdf0f700b5, 0x5fd0e5145f76db7c, 0xaf300e6f89a69562, 0x0cc2044827d43a0a
+, 0x1df05ad05d25bc5d, 0x4a4eb3ff0f47e353, 0x5604e8a78195cae4, 0x132178d4271aa5a4, 0xf154ea8a77800cc9, 0x14a822d1bb1ecd22, 0x8a5874764175826a, 0x396d027f65806277, 0x9daed115fd9ad8d5, 0x30535d58e2e43394, 0x323d6b28accc76cc, 0x772ec587481237d8
+, 0xbc60d183c0ffc1c8, 0x0a3a61ee8cf8c800, 0xec922aad2b2f89e1, 0x435fbbcf9715c9ed, 0xf76bed0fd6af0c0a, 0x593224bb3fc0736f, 0xf7752aefe9dc455f, 0x0046afcb50ba82a6, 0xe7218a7802572c06, 0x5edb029dd6fe440b, 0xccc03c12e2513ced, 0x1c6db95b5ca6c456
+, 0xec6a4a263413de32, 0x657b654d15dc7c10, 0xf18fe51e56cbf531, 0x3ea6d21c5fb2abef, 0x68814d5b32a4bcf5, 0x7c72e9af7e94ddb9, 0xf267c3c8b4a46632, 0x16844ec3ed789228, 0x9d56d0e2055232d7, 0x4e27d155ffa51e00, 0x632969933641a45e, 0x7054a77d43b6f757
+, 0xd26997b3ba49c024, 0x6ad51e0be6d59bbc, 0xcb4b638e1f2a43b0, 0x5eb58c91a01bf0cc, 0xbc924ad4b708335d, 0x5b7551724a46ae7c, 0x0751d95e5187bd53, 0x5239897bce2e8147, 0xe172108ef5efc177, 0x3d5470e16c6d22cd, 0xc3cdcbb6d2d5f2dc, 0x7df16d23ad6d08ce
+, 0x0c1a6f639dd46120, 0x46a162af309f8bd4, 0x86661d1cbab70576, 0x6a18e6ead73ad3d0, 0xdc852f927ec7d4cc, 0x471dd18df9f7ebf5, 0xbd182e365791ef02, 0x13d8fe8afdf4fadd, 0x8f1117558ef4ea9c, 0x3308b092934fc912, 0x55222d44c5354e65, 0x38294dd9b35d87d4
+, 0x86a92b9775a94ec9, 0x7042b991feb17042, 0x77140b9637246e10, 0x0ba9b4cfaba31687, 0xe8866c2fbb43e40a, 0x2bfc4acb887bdf52, 0x5c58b37c06c57a77, 0x740814cda06a119b, 0x2055122bc29bf10c, 0x68ef9faa678d82c7, 0xf367547c46ccea59, 0x5fcf24ea83f2ff75
+, 0x7ec2a1ed1c87c10b, 0x28c208853690953c, 0x52529edb8df9d5f4, 0x43d6d7c63b72cda6, 0xed60a5976a57957b, 0x4093ea18d92b2a17, 0x6ac0f358dbf731fb, 0x4ac7b9670f55dce8, 0x27dbd0d661451060, 0x08ad11fa0d8e89c9, 0x3d635c5cc2369fed, 0x5f38eb5ab71f2908
+, 0xa161b1328dbffb6e, 0x53437f75cdc7680d, 0x4dd9919cf86fd012, 0x7ef234134a2e105f, 0xb02c031bcc76c389, 0x227a8c224f8e06cd, 0x8841d75efcd024c3, 0x2cf2d54908a23afb, 0xd3c96ae8aadab1f7, 0x53a64779d9270983, 0x8f79c6575d562b3a, 0x5f93457f69b85abe
+, 0xbec8dbcdbcb26f53, 0x150e5ca4454030ff, 0x879caae434a23932, 0x0c4fbd367ae708d5, 0xe42f1a3accfc4221, 0x1a23c91743289b80, 0xbbb6812404a82def, 0x61b08be66fe1854d, 0x40e73e446a168472, 0x35806178969faa6f, 0xc8dcca5fd7db39cb, 0x18d10c3874b7c3c2
+, 0x99c2175c14e946d3, 0x286671e422af668e, 0xa853ac659c992a50, 0x310c585dd754d512, 0x9aea36d51c224b2f, 0x0c47aa3957490238, 0xdf2e6150e5f45ee0, 0x11580ccf4d201778, 0x2f61f1169d4d96f9, 0x60971410a9b1b375, 0x81ce8b77037a7ed7, 0x30b13de1591189ff
+, 0x5b0553f377dba24d, 0x2ccda2682a5faeba, 0xb92a1b5befc3abbb, 0x5a8053ce1cf6e2e3, 0xbb4355f18a6a411c, 0x2b77eefb9f7eb0f2, 0x68b838c88233e6a1, 0x7e3caf1d1d540130, 0x1aaaa3ff3b27add9, 0x476ad59cc10ead54, 0x6c38942ebb2dd687, 0x19504290adf3b395
+, 0x65b8a5bde2e4e88c, 0x3e6ed7fc2fb92574, 0xc4a03ef1d7c4fe60, 0x74c05a582c0d65b7, 0x2bf4e0b68ddb141b, 0x737346df06b07c9f, 0xc059be2e5e7cf1f3, 0x4f2e9436d40d2c63, 0xc375df4b57878499, 0x17302661da33eb0a, 0x5231a8a622e5ad16, 0x52323f116a370455
+, 0x48990751e2a2bc7b, 0x2028fe91e8e23dd4, 0x154718bf53be324f, 0x425645121b1ef6bd, 0x6afe041b8f5b9d63, 0x17e820545adb2a86, 0x82fe7afc11eda056, 0x19de722bed35e3f8, 0x2937eb0e90d6201f, 0x00ada14ac9727b1c, 0x726b1b556de8f427, 0x0c4666b7e02ca981
+, 0x783f4e2d44d4d2d2, 0x4b7bceeaf0371e83, 0x00979922fc8d6c42, 0x7be1be2855b8e6f3, 0xd3a147482721bead, 0x0b38e54e9a157753, 0x78cc648476a7c6eb, 0x6efd656131c864df, 0xd312877f87974fd3, 0x5267e0d9dde6be87, 0x4593cda0a42f52d9, 0x5635995f52408fc3
+, 0x53dcba7980a4178c, 0x6d242b9cd1fae227, 0xbc89ee7b6b517fba, 0x6afbeb95006ff943, 0x1ab98be42df33e6e, 0x272c5e493e9f03f9, 0xb1e78daeea77168a, 0x69bc5a5c7e7cb7b1, 0x3ab75f9781059e21, 0x4f5b627482a857d9, 0xe2af4d153334451e, 0x1fd1429ee7287bab
+, 0xc5b49e544d205c35, 0x09d1e684460d1260, 0x0b8b9f25f42c1efa, 0x5ffbce7e10dd748c, 0x69366e1070c53f77, 0x68e72ee86d7f4df0, 0x2b1078aaea111bcb, 0x4fc840483c7db497, 0x13155a2a6add7d5d, 0x1f157d469bebf33e, 0xc69ba6047fd72683, 0x73cbbfee7f81e231
+, 0xc0fb5aeae6b90c6c, 0x64ad04c6a8d7efff, 0x7c5bbbe0d23e5940, 0x6bd21c961983d513, 0x1e39b49991ae9035, 0x077a255f2ba9b69d, 0xa8c77312c194e894, 0x02f53eadf6f17968, 0xac7bb3ebd55ecb40, 0x453a7c056bf79c80, 0xa54c95ecac904fc1, 0x7a94c1d5b280db64
+, 0xcd1482cdb3787c34, 0x0e52e5a77c7d24ae, 0x196f89343fbcd393, 0x1ecc9e6ed3512341, 0x48a23cc9263210ba, 0x119b7cb4412628ee, 0x34b854b8372f9869, 0x491f3e997cc54e2d, 0xc67506bf16a24233, 0x78504e7b208387e5, 0xa523e4a48a646629, 0x05322664d07825ed
+, 0xb522ba548cf2dbf9, 0x2373815072793f79, 0xee52fe6079dc92ad, 0x5b5dbf408da82391, 0x31848fbfdc327bbc, 0x78a266ee68acdb7c, 0xea0b42200770d35d, 0x6df42586190cfe7a, 0xab6272486e19d400, 0x1818a0c187a9cef7, 0xca8aaf7c7b6bdbad, 0x7b88c1aac555741c
+, 0x197513d34e4ccede, 0x50b1e63b17a053bb, 0x0ca66756ed48cecf, 0x024a94115356c448, 0x162226402e08458d, 0x61d7fff35dc078da, 0xa34678a84941bb1f, 0x65ef2a6ac8b66e20, 0x3c03ffc84d7fb654, 0x2ea1b031e2da1d79, 0xfa13936ebc4b62a4, 0x02d18588f1dcab8f
+, 0x8d82f1cbcc1ee02e, 0x6b77499c395d0377, 0x0afc35a5477af7c2, 0x0e378cc04ba10574, 0x2aede53d72da7bde, 0x01779fd2189fc3bf, 0xc72699fed6a4bbed, 0x2180d226aa14a1c2, 0xdabccbe240b911f4, 0x3a7ec76bb29a86c7, 0xf706e86c098b5bd1, 0x38748c0cc0e16e04
+, 0x21f353539cc387b4, 0x1f7cda2394d2f74a, 0x207fda2754888c3c, 0x5ec8fd1ffd855159, 0xb240cf3fbfd3ea38, 0x420c1a2dd71d6ada, 0x28762f8a44d1c3c6, 0x2c216144832e5754, 0x2036ffa5d36a5463, 0x28051262e5c7dc33, 0xd5114b0b4fffcb19, 0x2a90a87edcf949a7
+, 0x4d4af6d80f9eefeb, 0x2cbcc58cb82d770e, 0xb563c52c1c26d379, 0x182ace3f755a3bbd, 0x617e64a59e0064f6, 0x240f0c6651a178b9, 0xf1c577e898208c4e, 0x757c915e088a28a0, 0xa38ddf5b2e29f5fd, 0x55456a71bbc866b7, 0xce05bddc315b6b20, 0x6259fd6fcde9a56f
+, 0x0c45a84d3314cbf1, 0x041f8bafb145fa6e, 0x94ac4efac4984765, 0x7c4a7d732eb1bd77, 0x288d8123fd71e1eb, 0x3ee8f863d480f7e5, 0xd91ddda9d7013528, 0x3f98e2820b8805d2, 0x94d27b197a8eefc8, 0x2aa8b9556b7298ea, 0x370f496af9527e39, 0x7f81983499c53ff5
+, 0x7751f01981008c50, 0x6faeac5d528b0085, 0x07c3c36526861c33, 0x1f6ec007401af756, 0x052acd4ff5f02670, 0x61cdda57fe7917e6, 0xfb9378765d6d8797, 0x10cfe27f6daa8aaa, 0x8d166f14f463cbc4, 0x15397a368d267054, 0x9bc983545000a19a, 0x05410ac815c4a4bc
+, 0xbcd677039cebf0c5, 0x16577098aa543290, 0x8d91b3b22004b83a, 0x3dd9f1dc19db67b1, 0xa7491f8423177652, 0x41e57519142bb552, 0xdbc29e8878c63dbf, 0x5b313697eee3b46d, 0x6472a28d0625f64b, 0x7f938b9eb737d08b, 0x3481075d1be1b90c, 0x6021dc71a699b870
+, 0xedc3981e99a7cdcf, 0x4e1c9ec0ecdb747f, 0x4fbfc3a32058af14, 0x6e18380ac1f52c6f, 0x57c14d14260a1b1d, 0x4aca582af26a5bfc, 0xc5f1e04874b5e978, 0x356a134593ee2b36, 0x852dd446f6312b52, 0x0bf9bd875df1f18a, 0x2bb6d290d4da0af0, 0x09653cf18213adcf
+, 0xb173108c986917e1, 0x74ba9522e91e355c, 0x95a59af62924226e, 0x40bb2a52c2662b34, 0xbb42b8eb9b6cff86, 0x4681fd4e97bcdb57, 0x2361ee58b38874af, 0x377adbc4a168c87f, 0x6bc936bb1f6e90de, 0x639a3f9d4be4bc0a, 0x9cfaa056ba66ffce, 0x01760298457a7da9
+, 0xbf9e0209d28d7550, 0x074767bba18db8db, 0x9ec7ace5192c6cda, 0x14b1ed8d41491255, 0x59e1ac678b557054, 0x4ba69addb2185748, 0x0658ea14b1fb34c0, 0x36cc58e05dd688f5, 0x36ee8ce64c913a57, 0x581a44cd08945a36, 0x600f00d7b6fb0ae5, 0x6ce0bd3881c38b09
+, 0xa0e7d2a1481413f1, 0x00d58b09617c0700, 0xc0891e96ac96526a, 0x52889eb493f9fe33, 0xa06926e30d2d492a, 0x0f4302eaaeb0aabb, 0xb2bb07d7c4658542, 0x701ea10e1dc2a745, 0x196c911d215944bb, 0x4fa0b0d4c68710b9, 0x61b0c85797cfb440, 0x181d58446b390c92
+, 0x477eeced2d119ca6, 0x69055123d981623f, 0x34a67ddb84a4c462, 0x5ee538569137c50c, 0x0b5189bf4eb25165, 0x0b7ad6e79fab6ee5, 0x544b357bcce96262, 0x6a761be68cc106dc, 0xce48097dbae5ea07, 0x3f67aa299ba48f92, 0x042a1161ddb77dfd, 0x1479e1727818d315
+, 0x544c087e4ef44ef4, 0x59347495942d945d, 0x2316f4ec7dc881e1, 0x7f16e9e0bfc378ed, 0x22a58eea3db069f8, 0x4810d6cbee73877d, 0xf24c8ccfb855f186, 0x73dab62c13b77520, 0xeaeab9f70a1e974d, 0x5bbcaa5557786b7b, 0x101266afbfdc803b, 0x1e66bd2646a7958e
+, 0xf3e8bc32c46ae500, 0x1f497cd9e1c5250c, 0x6129ef014b70b64f, 0x5695805317f67e97, 0x4ad013332315225a, 0x6546bd4b3eec02bc, 0xa7340e1222977982, 0x55a770c43becf20a, 0x445796da32f284ae, 0x14d207a1d92551b9, 0xcc155d6b94cb9920, 0x75dec2f1d0c94cfa
+, 0xfe81be8f37d282c7, 0x780a06d537d204b9, 0xa717a63396a2f975, 0x39c8d83cacd9fe20, 0x737d03e44fb9935a, 0x3cf16bbcb875598f, 0x0a54e6704640e374, 0x796898de81474304, 0xdd3cd93e6164632f, 0x1b13da53ba258f38, 0xf76896c8d8ce45d5, 0x393e8fa06c6b599d
+, 0x655afc7e8efa7178, 0x7d32c4791c1cf53e, 0x1993e10e04c3f435, 0x48945db5cd6fac1c, 0xf641849f72cfcade, 0x636ce54887ebedaf, 0x3025245e6b690cd1, 0x3ef8b94510ea2a04, 0x13b3eb91a995ed36, 0x2d91bef6d56183ac, 0xf7523b44f193c317, 0x2e1b795a77fccee8
+, 0xe4da29c914631f69, 0x02e53db37ce5b007, 0x7e740db25ce87d07, 0x0b21fe8fa0787768, 0x31e92a495e45f1ab, 0x6360a85fefca4fe5, 0xfa496d8b6f5abe12, 0x156def323346f92a, 0x0addfe59b84c3376, 0x11001f391018ab4f, 0x83f8edd27dd7d199, 0x7796ab9a11c85ed1
+, 0xfb30ead36c0d3314, 0x10e1d05e169ed9de, 0xe11521067ef80ace, 0x25bac876dc20a2d4, 0x80b7cbf17d193c2d, 0x31c0acd55c68c86c, 0x25bf0a58ecf9cdd4, 0x72f7304aecf6716c, 0x9db308baf507123a, 0x6d3df6bb39e62e04, 0xc8a6509bd6f16dba, 0x49611a4a2d1567ca
+, 0x910d2ab171747fad, 0x7f46dc15c77ab3eb, 0xbcc21f58a6003fea, 0x2936c008d171b072, 0xa81fa3910b3af736, 0x0b4082d582962a3e, 0xc770f174517886b3, 0x7d0f001ab99752c6, 0x0513de80c6da9506, 0x0353c6964bf7e33d, 0x06eeec799e70aec6, 0x58713ac88b1b686a
+, 0x1ee9fa676a92da9b, 0x03f23ca4bfe718a9, 0x17b01940c7e0cb5f, 0x01eb6226108f1ad4, 0xe29747fb1f44ad3e, 0x31697a177566a867, 0xc4db854c7f985eda, 0x383b516d58b2683f, 0x53f0c498cb63ca5b, 0x2f6fd9d140e67404, 0x9e5eaf8abbc0c19e, 0x5071ee51e7f9993e
+, 0x9c52636f7ab8f5bb, 0x5159d7884db03934, 0x41f2f9ef5d055dcd, 0x6ec4f0b5781d643f, 0x1b6dc6dc394c86ef, 0x7f251d0be9802f5f, 0x58fbd826a3060dd2, 0x401040f785368464, 0x2ac711517dc9c603, 0x24529c5126f8046b, 0x9393431f64a2f7b2, 0x66d7d9ca47408b18
+, 0x96f341c947955ead, 0x0f885535f1c9addd, 0xb9686875b0102423, 0x16d08d4c21fa6c54, 0x8667f515b2784bac, 0x445402e7fca9c508, 0xee9f5d93924f3e7a, 0x1ed550f3a16f0e90, 0xa80029995affa16b, 0x6ea2e91afff5e49f, 0xe4e37bdc5d338eca, 0x7bdbc7a35caf9087
+, 0xcfa31b8153da3cf7, 0x72bd5775d3c3ffb2, 0x211ce820e3ccfd3b, 0x2c22882d6651b9a7, 0x4c62adbd66cbd6cd, 0x4075570f239de623, 0xdcd532c041efc164, 0x0433d7d933bac86d, 0xc9cf3cc84dead3dd, 0x58b16767780021e5, 0xf61cd14eaa542385, 0x2b784ea5397d19a2
+, 0xd1e56b8ffce77dc4, 0x537e7149a01fdeaa, 0xb5f589e7ccd5c41a, 0x459593095f8b0056, 0xd85365b8da14391e, 0x01450798486d88bb, 0x5544d7b59881d745, 0x05324f1f26247a7b, 0x1586e68830d08949, 0x321565dd087c83a1, 0x5e7ce83edf5ceed2, 0x251394a7291a0e7d
+, 0x83a967af3e683bf0, 0x7464f9622c6bb03c, 0x736acf723e571a30, 0x626d9118e01a2453, 0x3378263379b0e0ae, 0x22847e664b65734e, 0x2e83c51ceb0b558a, 0x6a8c061217d04184, 0xb04e2333aac6703e, 0x76205c5284e2af9e, 0x8210f1202b37233d, 0x0e906ef79e0937e4
+, 0xdd7f5a73e1fcae41, 0x37506f82ba39363c, 0xfd3a93723aeb3106, 0x0483402123e4fc77, 0x8472d6f0fb7b7922, 0x1ceaf5ddd7880c6c, 0xa92aeec6c3221535, 0x3241cdeeccb9f029, 0x32c76cf215e7b383, 0x7bd6f9975fde07f9, 0x92c3cedae646e1dd, 0x272b4c39df5b55ab
+, 0x3756d4d479c2cc3d, 0x25d44ea8d31543de, 0xd82c8bef26bb2c43, 0x2c2047033d27f37f, 0x5bd33d9837dad260, 0x77943117a3383b7d, 0x12071d697ea583f2, 0x3c7c41272a225bf2, 0x92ebbdfaf1f03ad3, 0x5d61030c68b63704, 0xca6e2853baee75d1, 0x12404b34771a3636
+, 0x5afb12cde4496dc2, 0x3e12401a9acf1388, 0xe90b2a493978467f, 0x5b8be86889e128d6, 0x668b497144db7840, 0x50dd322f81e4e104, 0xaafe1eb1fd0cf8c3, 0x2986f7358cb325f9, 0x0212c0d795363034, 0x308c13a380b6977c, 0x8fea37078883802a, 0x5fde6df9dfd812e0
+, 0xf8e595a1666599ab, 0x7124e8fc0731c60d, 0x468af18300c3d611, 0x16b0c47c32d4dc2f, 0x7d081f517543bdec, 0x4f40bc71f109865f, 0xb5f0d9997381ad82, 0x7ec51dfa3b8a87c7, 0xcecaef1c39006dbf, 0x564b47dbe9d906e9, 0x5dbbd4b695d5c89a, 0x43b001e2f6e9a5d9
+, 0xe696fa101f32f7ca, 0x6a5edbe905c6f2c3, 0x3301a612bbe86b59, 0x2f77060854d2de4a, 0x53caa1aa2227f610, 0x5fc3aa75fea3f0e0, 0x2241b5754f2a4c5f, 0x700f438f9a14763f, 0x3f97a6ee1d2f35e4, 0x61b3b1bbd813bc4e, 0xaa6a12fa490691d6, 0x703faa77384fb9c9
+, 0x41c0c53c9f15e9bd, 0x3db2c9f96dded461, 0x1515282cb04794a2, 0x03f32ec007f06d6e, 0xafd16047ebd416d4, 0x23de57371de615b3, 0x232144ce894daa71, 0x438c11b74f6d1846, 0x025e522ff8a52135, 0x217319322fb67430, 0x10dd761ab8191acc, 0x772fc7d3fe20ffd2
+, 0x6a8cf05e6004c17f, 0x539bd1e9782ee55d, 0x38390f77abbbcb88, 0x1616a3b87239aef9, 0x711a1b6ea56f90f9, 0x04e28a65115a83fa, 0x40eb9576371a8ee4, 0x32ca78919ccacad7, 0x2059e6ff084024ce, 0x7ff44caaf67e09cc, 0xa073a2c4d0365f0d, 0x180d0f753b704748
+, 0x9d370c275783423d, 0x37afced29a06daa0, 0xabbe6bde0cef907c, 0x0b86fc4c57ae83ca, 0x6da65c2334542e13, 0x5ae07954f8472e13, 0x335718c5af39fc26, 0x101d151d8ed1096c, 0x838fcc9417acf0f0, 0x33f51b78351485c7, 0xc7a168defa0e7823, 0x0b6c0db32013751d
+, 0x110f416821578dc5, 0x081d48095bf35b4b, 0x37569dd79a3b9e9a, 0x4cbac459e9cb2279, 0x4e0df33020b3d399, 0x29fdfbded7805c9b, 0x05f14de0a8b60f90, 0x0fb74acd3e066039, 0xe596ea8e322565c7, 0x777debf27d708bf2, 0xeaf7ca9ecd47e095, 0x1abe4d9dcc1db316
+, 0xbe44d234584a2e68, 0x19a02d04d6b5292c, 0x4c7d24c73f546c25, 0x1cde83daaaff2c9f, 0x69278edea4fcb335, 0x0c33262712ffce74, 0xbce7216c79494e29, 0x4ca98d19d67b612e, 0xb2783a21a42d40cf, 0x3f5a0b9e001b280b, 0x7e28d40b4c6c92d7, 0x2077742a7f35d582
+, 0x1df44742323651e3, 0x6845330463524c20, 0x4eed6c9a1a9fe4d4, 0x33d47bca9a3000f7, 0xc39464079822bf85, 0x05430b40afe00d8d, 0xcfb87d9dc472d6ea, 0x68e203b200365c84, 0xe83550ffc05b233e, 0x446bc5cb4d30f3f3, 0x3a0a954751987eec, 0x08d528768e8fc661
+, 0x654fb0c8d4842a57, 0x799a1dd9f1f242a3, 0xd358193ef2178593, 0x50b199fa64d4a8b8, 0xfcde0ed030f5af35, 0x155f0797c803111e, 0xcc363108a875a45f, 0x716e808243aacaec, 0x8e2f1355994dffc6, 0x2992c8d7063eb434, 0x1c47521828ec4fcf, 0x2c99b147d93cc72a
+, 0x96ae9c03d574422d, 0x6978271968d68040, 0x3242c2063f2aa1d2, 0x1a4c348be84b49d6, 0xdd35e792b7b00f0a, 0x4134c0df07649421, 0xb05ea535cf6011ee, 0x4506559289c6991a, 0xb25378ee90031590, 0x2c59c141ffcb8bad, 0x179e829545466773, 0x7eaf29f0d9814620
+, 0x1a187a78d5abd33a, 0x76c799c81aa744db, 0x64ce9543d5104ca9, 0x630e4ba4dc400255, 0x9952c905af55e0b3, 0x31b9c83a1e1435b8, 0x0f96eed1286f20df, 0x4dd3ac6df0443596, 0xfd6e05cf49f0c9e2, 0x01bd552de4518ebb, 0xeb7cd3502ac40007, 0x587ba8c35ea95b43
+, 0x76e9c8b63d141d21, 0x15ab947e383e2ac8, 0xcf66c0232928b4aa, 0x3f0529a04e5b04ac, 0x3b7c61bff9b41693, 0x79109d653cbfa256, 0x3e3bd2e6f11b7d95, 0x5ae49bde82fadcad, 0x927f1cd9604b8306, 0x2cfcd055675e3b95, 0x6b58ce9d5b48481c, 0x17953e8cadd84340
+, 0x57dbdead8b75f2c7, 0x3373d4ddcd6eff94, 0x81d28a16a37d3bf9, 0x616642d81546bc01, 0x03b23a2c8710fba6, 0x1fa976eeefc29a55, 0xa9983c8ec398ef47, 0x513a8a7cf9465daf, 0x4c30a08513ba7fe2, 0x28c37ee48f25ab8a, 0xd176f19de626e0ed, 0x23158f869e62e34d
+, 0x9209ee98119f5cda, 0x7b1075074b504d57, 0xfda69990d0542839, 0x146775a51a21e7b5, 0xf153af898373ee30, 0x221a711436298bb3, 0x029233dd96d3f8a3, 0x37ea8e07beb090ed, 0x426f7b271d549c85, 0x59187dfd8cb6a421, 0x26b0ec51231e1ef5, 0x113c6877c9c3c238
+, 0x666cad3ad2f442fd, 0x3d628460700511dc, 0x7872c21cab9400fb, 0x4e7eb3e9320ffbdb, 0x2ceba11df71d3d70, 0x62b30f4054b0adc6, 0x90214d1affd2b58b, 0x649ce7235eaf640b, 0xeeb577f642eda030, 0x7b4cbbdb58a48442, 0x197b73d4e7e84f92, 0x2cfbbe3a4e3e3b00
+, 0x48ec904f610ee0e9, 0x7cec670893606033, 0xbf172e8f8bb093c3, 0x791e389b67073db4, 0x9e2d617276b2e6ae, 0x6c4a8b800541d5c7, 0x7bcfc6808fc53703, 0x0b0db3cd57768011, 0x1f5f3831e032a96c, 0x6c4bc0e18b1afabb, 0xbdfbb84729f5057d, 0x5531684f60b93512
+, 0xdea5228f793c513e, 0x7e8127f9963ece64, 0xcd1fe6857ef1ab8c, 0x20f9d5ba54b78a25, 0x0f48c31480a1f276, 0x1a9e1fdabb69c0f8, 0x20439987cc2a2b8d, 0x7d050697457e4480, 0xf6ab93ed2d203a29, 0x382995c4f85f743b, 0xba6cc7f386bcfb0b, 0x7b27d93ec63a8855
+, 0xc332f7b97403588c, 0x33caa9944e372cd2, 0x341cec1e1afd343a, 0x4675e0ad1d37af27, 0xfc5f2d9ab24eab04, 0x2162d3921123083c, 0x8d0e44eee2508066, 0x09a90331db0553c7, 0x50b1c00ea1c69873, 0x7cb4105bf4b2c118, 0x59e7d39dffab5ce7, 0x744cab0143466e8d
+, 0xaf03bee2d0882630, 0x1974fa4e3411c69f, 0x25115158781f21d6, 0x5f18cf5224670b33, 0x86bbc58eb871413c, 0x4046e12eaf0c8684, 0xf422102948ff080e, 0x488e0d668542a5a8, 0x6a4e3d04360a7465, 0x53c0e7e8781045bc, 0xef6a40fa60bac9c5, 0x3bddbd516100bb34
+, 0xa2facf6bbd838701, 0x470e53d48e75b5a7, 0xdfc2fffe3ea6afc7, 0x4204595e1d87fd22, 0x5e54cdfa7709672d, 0x67d41b4e50a963ce, 0x450e1215315c836b, 0x21b87dd68bffabe6, 0xb14ebd4cfb399695, 0x78183ec034aee8a8, 0x543bd840009db650, 0x27a4de86dfd3450c
+, 0x513afe3acf4182de, 0x3333a4d73e24d203, 0x9d3d9af1848e4be2, 0x5f6bd959a32c1fdb, 0x508c1ac3ce094de0, 0x1607144c780b4b6e, 0x4be07b981a8c24f3, 0x245eea65a78a1c4e, 0x702607c28e0c2b83, 0x31f796427ecfb19a, 0x91002d76de27bec8, 0x215c53ed7195b67b
+, 0xd9ee4298212ebe30, 0x6d0f2b0475da9bb7, 0x1a0f4c3f85530e50, 0x06c34efab9b7c50d, 0x35b9caa7b475f198, 0x2914ee8b4029b4e8, 0x8b138b10ea1e95ae, 0x624948bcf9772aba, 0xe4bf9ab70c5db105, 0x779194500a34b21b, 0x6a1c09f3fac45ddf, 0x30ce332fe44720fc
+, 0x86f0143eda6c498d, 0x63e48178ea2f8d19, 0x63a2e3ba0fb3336c, 0x35e0bba252453d35, 0x0ad8bca2971122f8, 0x57c2c259890bde76, 0x0e54704a0c09cfbe, 0x1c67865ce951ce43, 0xf1d5b9715708ba73, 0x3df14999458b57d6, 0xe2cb99a2f1e2e529, 0x117575daee400879
+, 0x5cfcb8ba43e25b05, 0x5b85f9527a9f6e68, 0xd83b09cf99ae49b1, 0x21d1696da3133c47, 0xec5436d754adb8bb, 0x7c4a34dd09d9db91, 0xedebc2fa0b080468, 0x119d80bae7caf7d9, 0x82c6d3d0b99c14cf, 0x5bdad9efcca89d77, 0x7e6a33aa9c49d53a, 0x72303bd61d323cdd
+, 0x41c7c2388aa8aba2, 0x36266b81b0d4a1bc, 0x5d7801862037a1d4, 0x5e6d1400a93235ab, 0xa3bfcb668e5cd75b, 0x7c44e238759a4836, 0xae175be498db5225, 0x6b78b10cb24ecc5c, 0xf660ee54e7b91605, 0x23be6cd1e07d3240, 0x7587aad3fb8f519c, 0x7306ebe349041b9f
+, 0xfafa2079770e1078, 0x19ffd4d82d2f4a38, 0x942bb5f15e25de10, 0x72dd7a4805121df3, 0x54a5e3fa5f543393, 0x2ada9ba810309541, 0xa2a5e0bacaeaaaf2, 0x43feacb09c321455, 0x756117fb931ecef4, 0x6523140918d64678, 0xf59dbbde239da70a, 0x74924141720fb42e
+, 0x407200ab9c885861, 0x4b55b2cbb1577089, 0x465e8d3a058bd4a3, 0x6f512911143989b2, 0x78a75051c0ef9a95, 0x091840718f365b88, 0xe61029bd4748ee30, 0x5cdc7dbe37f7b547, 0xbc1475a4a3a2e966, 0x7cd620865859464e, 0x6bf24506053c1261, 0x76a15fa392f27b90
+, 0x2419164735990279, 0x3158875a2fe24229, 0x932065252c67063f, 0x2a5fd132fe55da9f, 0x1bf818957600ed54, 0x25d3928d6db78b26, 0x9c682fd70c3bda53, 0x307d5edc328e1fb3, 0x4db775058f61c404, 0x21b289a6e8bd81ba, 0x9faa12644fd7ec87, 0x33d980f708673d8f
+, 0x2a6e112f65873bc5, 0x625a9f76718720be, 0x9ce86f56c2d851e8, 0x575eb3ffcfbf7f4e, 0xa5a13d82e0c343c4, 0x02e351da9dba4b66, 0xcded137724bc06a0, 0x21cd30926fc4c64b, 0x761f4a432975f089, 0x08d6a72f0f89f7d2, 0x779f49f6f54c9481, 0x39b02ad76cbb22e0
+, 0x42b412b9932cd95e, 0x7bad1ad5a8f49d60, 0xed56566bf117f64a, 0x3b2c1a6c735484ac, 0x49fb668e10afcf06, 0x32d2936ac0d6150a, 0xf42b28d19285128f, 0x3d26132f5d4bf519, 0x56d78efdfd9c1120, 0x0d16bea18be093cb, 0x29c59028a69c35be, 0x7d4914fb0d71b6a2
+, 0x8adb238a86b4c62d, 0x49d715e95a1e5bea, 0x46c5ae4913f331c8, 0x6d05ee86c8f47881, 0x6252ef33638b8ae4, 0x0e943aad4c248aa3, 0xf46004543b029f8b, 0x352c0d0c2ce624de, 0xad36b357183718b8, 0x1470468e9cf27100, 0x8acfba095d4ece08, 0x1896c297e74d56a9
+, 0x5da3b2e3205d5827, 0x25e61c376acc624c, 0x187d3237abaeb633, 0x0e800959b1cc8799, 0x92770c8892c3a071, 0x1d7b0b025cb6ebf2, 0xd5dc2d1774f992e7, 0x38cb276f616c3118, 0x899a31961a48efc6, 0x1a6f0f7d23a62f76, 0xb43df7702de50bb2, 0x1cc3e90a7a4eaf5c
+, 0x28db6dfc22886386, 0x36b2345db0c07f36, 0x4ca345c8427cbfdb, 0x05f69eb7b8c71be1, 0xae27c370235d3712, 0x477c07245321cabf, 0x171de24ffd119360, 0x049b010953729fe6, 0xfec4b303a63dd5fd, 0x1e4dce0ec90335f5, 0xe825a677bccaf873, 0x09f3754cdb701087
+, 0x7d47b91d64d01016, 0x3b856f6a96265793, 0x2e35df142c4a83c3, 0x1cbf76706aad8518, 0x8d83d4caae4c4439, 0x29318272f7c10bcb, 0x9e352feda54d1124, 0x19607ae14461d933, 0x33e917071db0da48, 0x7bd650ba05a760c7, 0x5c91ef5056a62556, 0x7d57afaed4f530e3
+, 0x196ceefea72ea3ea, 0x370a5207008a9555, 0x44fa9e00334103d9, 0x64fa7cd0da6d8696, 0x5e093ba10e8c6055, 0x343c9f40ea513689, 0x7ebc1374ff33bc61, 0x41f904777683ed1b, 0x90ff0446cf152a20, 0x227f59b38b8dbfcf, 0xdd665c0e3e5bbe23, 0x7c71bd15a4e15572
+, 0x65ac5962fea007ee, 0x180dc7223c943587, 0x5eb22386b5b1dc72, 0x088369a9be3aef0c, 0x59ab337e4300a568, 0x1682ba6236e370a4, 0xb530bff8e5ac584c, 0x0a174b043b8bbc37, 0x233355525fb7672e, 0x7e3d80fddbbb87ea, 0x5d63e4057cf90971, 0x7dc71a88531e57c6
+, 0x39cf5cb9dcf37e5e, 0x70b8e975b7ad5af0, 0xe6662bf088c520c9, 0x3842703f773929bd, 0xbf72e38f1c71dcf7, 0x3c64ab9da9edc952, 0x5dc7f56306450417, 0x105aedcb763ab0a9, 0x86559e23e1bef8f1, 0x355c1c864a58bc0c, 0x53be33b952b241d6, 0x13b9610b4d6b716d
+, 0xd35fcf8285f7674b, 0x155478ee871bc04d, 0x4b34497eb1b33a4a, 0x3c2ee83adbd77622, 0x135192379f93f5fc, 0x5560c011042c9d1b, 0x2c13a45d2d46af9c, 0x322f3c01ef7b5589, 0x246c9b9ecf63a333, 0x1d9ae9f40f9b18ad, 0x8cdc1bb19b98e696, 0x3b32c2074aa33c6c
+, 0x92a6a1e2fe4428fe, 0x4115d3a843265748, 0x292ce0c7566300fe, 0x4f6305b235e1e305, 0x9c5ba0816288ee87, 0x7c040a1e55c8ee7f, 0x6f906ea535a712b9, 0x4770f87f156ce3ba, 0xea7eefdcb9b5af6d, 0x607c9f308dbdc3c6, 0xa04690f1c91b86fd, 0x51fcd9918d3c33e6
+, 0xc3339de64619844f, 0x29002851cf4a1543, 0x4dfddf7cfc5c4df6, 0x788f48f4e90becac, 0x85ba30efe10665f4, 0x412acc36f46d5d83, 0x6ced5e0695bb8324, 0x5309a4719e2d6ebd, 0xfac9cc130de2e8d4, 0x2a74e3b5f68cf04e, 0x3efa29326672e88c, 0x3d5faaabd7ca85c5
+, 0x59c0ac85af9fdf24, 0x57f19baf34c6023d, 0x5f40940a7e8d8e87, 0x606fa05f9e94291c, 0xc18eb33e28e8a739, 0x7b3bea348dfcf522, 0x10844a09ab59999b, 0x2f9e9fb9313bc6b0, 0x8aeba8d6cf473ad9, 0x5e9086237523e990, 0x1a4377914f549bac, 0x1f9e1229e71c6cb7
+, 0xa00245bbae85dabb, 0x70c7b04986b39c51, 0x41a9a22cc272992b, 0x491a96ea778c8ef3, 0xbdd4dc023eedbfe3, 0x67c1939a0ba79ccd, 0xae80efe396f3a16d, 0x710e23c565548b00, 0xf820c7a0b60351bd, 0x73cf7e640209967c, 0xe005f957234294ae, 0x208983cdf2a4cdde
+, 0x24d6c47f789e36c5, 0x65a9ba64948afe4e, 0x379ecda5a67c5dc1, 0x1230bed53a3a4a70, 0x2630f0668938cb1c, 0x7edd250247b42630, 0x22701cd7c9a3fbc2, 0x1a39ec0557c6bff9, 0x8041073ff97340cf, 0x4e039633ef2865af, 0x6f408b004e8b3f02, 0x65c95ece73b075fb
+, 0x54ee721fdafc14b0, 0x502a32d5e7285374, 0x148a10d8482ecebd, 0x3b9fb7fe990d5d44, 0x0bbd54349eb5fbfe, 0x1ceed18fff5b9d82, 0x296883d7341ee176, 0x79441e23aa194552, 0x6f0863697111d15b, 0x580468527fa3ed65, 0x220ff96953988684, 0x0a4c04e14f65cab2
+, 0x718f48ff38e2124c, 0x012cfba9c7ac30f0, 0x1af3b0ec3e7024df, 0x6acd73e5123680ed, 0xf52d96e4af2510e7, 0x4673f4460677c162, 0x75536bf0254b7387, 0x67a99fd5737a4715, 0xb3ac4d978d064a89, 0x5843a42d9c357b01, 0x03f94845f8230913, 0x557c0d21d280d630
+, 0x863415fbef1af44c, 0x634bca604b823a62, 0xe0db69352d653e8a, 0x659edf6841806c4b, 0xb8dda4f7dcfbe14b, 0x50b3baef8fd05f94, 0x17f271303e250c56, 0x6a1a837c15682986, 0x97541fd0325a0e3a, 0x151ffda5a96017a5, 0x8fb84cab61d2adfa, 0x70fee2069717145c
+, 0xfc4d35db9200e57a, 0x44753f86b1b40fd6, 0x9c804985905357b1, 0x7ea12743ea946a9f, 0x2aa362074a22ce35, 0x360e82901204db4b, 0x7ab401afed840e26, 0x678b3680451ed6e6, 0xadf139b07d919360, 0x638dffa24662dd77, 0x943f70e1865b45f7, 0x3a8572718befcbf5
+, 0x99a23cbb618371aa, 0x7cd12e11024d4e6e, 0x00300dacabd77775, 0x5d0cde9d92a349f0, 0x7d2d8054d9212d80, 0x5c8357a0b8ddb1cf, 0xda81210fa7cb1dda, 0x78ee3988ed0f2548, 0xeb0a17663b041138, 0x19d411a007d0bd6a, 0xa89f1c7bbf128756, 0x15c696449322aa78
+, 0xb1118ed9e8dfac86, 0x695a74d4a59de2d0, 0x2a83f5b84c370742, 0x70288c9179a63b4a, 0x83ee26856858bce4, 0x344f23b29ab2a1fa, 0x1805a56220e1bd00, 0x26d9eaa46137a9af, 0x8586865f31c0c62b, 0x518f493a8dd4c1e9, 0xbb93206f9ecc4947, 0x5ff46d32fb0739bc
+, 0xace4b008c088d8b1, 0x7813e4243918b0f5, 0xab479d76a4218a1e, 0x7c69353129933ac5, 0xddba92c73995ed5b, 0x469cdf5f1934c4f9, 0xc0c9c9e2046d4154, 0x1eeaea31ccdca32c, 0x7e092a5e1cff6d33, 0x13ded44cf86832ab, 0xddb3fe0cdd2d82c6, 0x224c1d62afdff5fa
+, 0x021a7c6880fc9571, 0x671c6914e7f5c3e3, 0xb6fab319f9523c40, 0x5afb5ed29e7f642a, 0x89c7064c833ea65c, 0x7f88536eefd3e820, 0x90785efe3203348a, 0x5f6b6b5b9d3a4129, 0xd3c2141a9f7fd044, 0x47d7729ab7373849, 0x1c2cab47bd561ce9, 0x2fdda57e2d2e6b0b
+, 0x038dcd4a084d92a1, 0x0b1fe3094d4b8247, 0x75d084f40fa2abb2, 0x6b095e5c125b35d5, 0x640f1d06dfbcb7a3, 0x530ba4f5ffb1311e, 0x71ac4096815c8420, 0x15a943e58cf37078, 0x666783664fe398da, 0x6f0e8b19c934c361, 0xc4a547287f98b7fc, 0x504c10c526884a51
+, 0x4dc5a7e71088dc6d, 0x527392403dfe239c, 0x428c21f4efdcae3f, 0x7c7076bf094edad7, 0xbb28ef7ab086a8d6, 0x148907d86b2702a6, 0xba5ee8d2f967fd03, 0x1c1b3ab0f53a4a16, 0xd57efcc71b152882, 0x6f326615bae4f5a8, 0x890d68b6cfde7d1e, 0x3bb58bfff12d0d5a
+, 0xb4684d8def9fba08, 0x09fd7fc5c315fa22, 0x2e6c7106a1ae1064, 0x4ed0648fed7fa135, 0x8b727cf5272a698b, 0x4a48e0e8348c2cab, 0xd38c87888b05a7f6, 0x716e51772f7b9381, 0x3b7de1ca8e551a36, 0x6e2618800387f99f, 0xc0c361d46e495164, 0x7b2768c73aeb4c08
+, 0x6d4ed116fd30d7f6, 0x69abef88f480887b, 0x9eb26823effd78aa, 0x7353111a9a19f6d8, 0x8508edb44a953e3b, 0x1c751e7ed82f6602, 0x626df190b0b57ed4, 0x264ef09e1010e539, 0xe272472186ab84b0, 0x617741b31580b328, 0x2be7ec62e7608edd, 0x149b9ff243dab6d1
+, 0xdb24d7da99155ab9, 0x5b92f3014f154d12, 0xc9417baf997e24ed, 0x6ae7c46dc65058b1, 0x79e66d004b1294e1, 0x78028b31abd14ce4, 0x87663ed84b87d637, 0x5c5df0b9e25bc9a2, 0x174f35c251a5d3bb, 0x04194f56dabadf6d, 0x56f246374388f7ad, 0x415ea4572f54a208
+, 0x3d492f8b85e1f7ea, 0x48fea473b43dfc8e, 0x1e476cea8e3200a0, 0x4c3728f918116d3c, 0x4164f9f7464ea47e, 0x085c4f270b95fd81, 0x0d3a651144cbb8ef, 0x4a4dc39653805ffc, 0x58c60fd4bbe4bf41, 0x0f34f0401ce265b9, 0x3d0fa572279a6f01, 0x3248e3e0d7721669
+, 0xa2ce1eaae733c790, 0x29319d8cd449b374, 0xd25390bca48bf225, 0x3b58c2b0fc3f1aa4, 0x9babb4d1d9098a9c, 0x73eaf94e201e05b6, 0x52c0221c4b65664b, 0x322cec48cefe88f0, 0xde219c7e145ca12c, 0x3eb8d06d8fde5ccc, 0xaf6d9841d27353fc, 0x07c6297a5898c8f5
+, 0xa415814db65f1611, 0x182344dc7a40f5e5, 0x66ce149712dae473, 0x6d99e79f4dcff940, 0xaeeb589db66428ea, 0x6667c8a029a8f57a, 0x4ce9a5cec16a249c, 0x7a7ec00704617db8, 0x728629098effbb9a, 0x342edde1d8146bdc, 0x5dca043b27aa827a, 0x6f0b9e65e6aedb4d
+, 0xed2d6b62bb881c38, 0x4d9eac8aaea78b27, 0x660490ab04ee2a4d, 0x0ec5bedaa4c77096, 0x0fbfa70a037009c1, 0x78fc6e1e7d12812d, 0x80a8b772a4b12966, 0x5ddd5b9ea508b97e, 0xad3e39a0aa495134, 0x61a5424aadfea9cd, 0x37c8b424dff69a60, 0x7797cba836b9607e
+, 0xf4ec920cc7f2671f, 0x6ddc0963573f93dc, 0x6e7de61db02c8b88, 0x59a5417186333ef2, 0x6846b9b47c896f2e, 0x16ec773d2df5fdcd, 0x8a481997c9185d6b, 0x49b4cf2c273d2f3b, 0xec6466bceca7c876, 0x6955b472a1313699, 0xdc26bae9e478adfc, 0x026f353a393bfb54
+, 0x8e55177304440f31, 0x764bc48fee39c0a5, 0xd516f008e49e1f8a, 0x2c3eaddcfcf684b3, 0xb99e106a5f523b71, 0x0177baceef16ea1e, 0x268f98ec39607005, 0x1b6eb2008d80ba88, 0x3439bbe7b28e3279, 0x170a0d84c55b43ee, 0xc79fb7833fdfc0cb, 0x23a7bbb9820d7989
+, 0xb5c12f78bcf04e60, 0x5240d5cf1a399138, 0x4ab9380c15568a7e, 0x2da2204cc37a9e3b, 0x1a693e83dac1f682, 0x376c4a3cc9745d7c, 0x38d42e53fb69d05f, 0x6c256d9ec4e37bac, 0x2e20694011f22b66, 0x446a9cf2d3d35b5e, 0x9c6193cb1c95768b, 0x1c7e323f487dea52
+, 0x00ac3b5d45888be6, 0x1336b9e544867809, 0x5b4b22b321633354, 0x7abdb9b259f6be87, 0xbb538dc8ab1b395d, 0x48477df66fca3beb, 0x2ae766e2e0c6edf8, 0x78883098832b4715, 0x78abf0205995d153, 0x016156af493ed7b7, 0xd7272da13fc8be45, 0x03af0f7927ccee69
+, 0x40f203b5fe6b8a5a, 0x52b236b32af7a2ae, 0x5e74d6fa1f2b56e6, 0x048bb39d28eddc36, 0xeb690f336f46fafc, 0x4b53706b97cc2e0c, 0xdb2d24f068fb1457, 0x7c629f459cfd47ed, 0xc09ffccb9faeff26, 0x3b94b3ae08cad6bd, 0xb0438800ddec176f, 0x3f65e1fcd30215c0
+, 0x8eab771a760ba609, 0x24000c065410b0df, 0x767bde7e57f1b993, 0x1500d544958fee86, 0x4e190cf6bc4adf28, 0x11eeee12ce03020b, 0x58e1382e2ca562ad, 0x472e5a04d25fc3b4, 0x2b0b6b9205c229fa, 0x29c8bf86452adb7b, 0x72d48b49d8491d46, 0x318f429c565ab006
+, 0xde0fa0b3cb3b41c4, 0x1ebcc8a0a01ac2b8, 0x79b465bbfaaea7d4, 0x0672981e333ba962, 0xd05b515b1c0e83d5, 0x2e745bfa00b23db6, 0x544a3ffdbef854ac, 0x4446e0a99a643130, 0x121dd86ef85c5622, 0x5f4b7a963286a6e6, 0x70d8ac53c1d90897, 0x0bd9cdd7d564a598
+, 0x27c002914065c0c3, 0x012d6d2edb008bee, 0xcbe4d5dd266718cb, 0x22d6056cb77329ca, 0x32a0dffb5204e121, 0x340fa815bc177ef7, 0xedb573d2ac87b544, 0x013634b05111a852, 0xe87a0b7d38b3d55e, 0x77d604ac32baaba5, 0x77b0724a3d3500fd, 0x3a3a1bc1c1aac616
+, 0xe148b93bd7402b67, 0x5200a387d9b92d26, 0x40660198c52449b5, 0x13ebb13d3290495d, 0x487deed4238b3c22, 0x7ae55ee2c0065de8, 0xee17e4f41e25f6a6, 0x500e91be1e6e6965, 0xb1a9d86956dd518a, 0x55b85af217dfb1dd, 0xe3e8304fbb470fe8, 0x56fb0082ad48c139
+, 0x266ad04c6e4d4c3d, 0x472f2c823fdfccfa, 0xc5a4717696f5de1b, 0x36f46312d0e5734a, 0x9ffc035ccaf2e0f6, 0x72207bed4719630b, 0xb5c73ece92e71683, 0x64368c1a6969c2a6, 0x48d4d3c54681d470, 0x51cf677c2a1a0832, 0x2a017823eccc6e09, 0x3eb718697b35a57b
+, 0x8536f782c804f40c, 0x3702aca5c9d0f000, 0x87be0c8baaf06659, 0x58441068d308d26c, 0x3218da208a805506, 0x5020ac82c9f8124e, 0xc345146ac6653584, 0x50bb7c199b2d563c, 0x0d3efae37cf8c899, 0x7c7ea03a399c8257, 0x8cdd6805dbf4d237, 0x07299938e92ffd83
+, 0x74024a2b77706658, 0x6ab89828c392385d, 0xf009ac556eb4b412, 0x09bba9d808aa595d, 0x1cdbc327dfe69d2b, 0x181114b2788a2fe3, 0x5fe507a88b42d8e6, 0x7be60ffec6fd1018, 0xa5d2beafa79681e4, 0x34180e970cbdf7f9, 0x7dab82c15678bcbd, 0x0a30b9e4fe7e0669
+, 0xbe0cc58f56252313, 0x34be1a936cc8a168, 0xa81e1c01cf0dfb4d, 0x21c4352ef317b572, 0x32a7ba9967193494, 0x1ca32cea0fb529c0, 0xa3b4cee954e6ede2, 0x7c5aeb7527523518, 0x3b637935741bac1f, 0x3b0f661426e45f9e, 0x4133b5423901fcb5, 0x1dbc7d44bedf4cb3
+, 0x4c218a2b188006ad, 0x101afa4213e23458, 0x8320582a15ab26a4, 0x500ce208a1418867, 0xa97e020f6a2aaf6d, 0x0844111ec16baba4, 0x3a2559bf6f849097, 0x02504b6bb1b78840, 0xcbe3bbce86e66bd4, 0x21ced7ae11dc4657, 0x2db99e486d9f548d, 0x1f968de8ec5b5916
+, 0x6854791eeb2ef8ae, 0x35052f9dec4622c6, 0x1f29ca08cb41b0ed, 0x69b081bfeeb8ce4d, 0x6429b2e2a4f6abbf, 0x4faffe27835a2c4e, 0x31925bafe047021f, 0x626c38862c02dc03, 0xf541358cfdf14282, 0x186d638e5f9924e7, 0x24bd90411ff7b481, 0x332d6765462cf8ab
+, 0x3d9608324f0c4303, 0x4064e9b83801357c, 0xfca29ac223d4c1a3, 0x6c1a6534058844cf, 0xc286bd9ac7c55782, 0x5cef4d7d03b29f83, 0x11d1d7095c2331c7, 0x7a4aa350612bf5f7, 0x1f35bcd1ddec3a11, 0x3532913e077ea081, 0x384bd82e54359bb3, 0x28185b663d4737d6
+, 0xaa8ff425d2c60088, 0x01a889654c99741f, 0x0e9c0e5316c6b07a, 0x7c1f198ab7e4dd28, 0x05955d42c6b55a35, 0x3ee76964a954f27f, 0xb68be8c1076bbd50, 0x5259bcda2b5de1a9, 0x066e4a549b992831, 0x60ccceecb5275ade, 0xef907e8d3fba8721, 0x2357f89f367f9a8e
+, 0x2ef505d23da9d3eb, 0x3c24e68a3336965d, 0x60946dc1076cc918, 0x1c518af22703fc3b, 0x4b720833f42ea1e8, 0x6c22fd951f64d70b, 0x6c0778ba0e13cc1f, 0x2f825ff43fd43be4, 0x5a3f815884ed452e, 0x0721a0a101946b35, 0x1032a75135735bb0, 0x46db2d87a946373e
+, 0x1c7c078840cfde7b, 0x72349de70f4dbada, 0x18c71504b3151dc8, 0x6fb9b9919958b21a, 0xda6157e66a11365d, 0x79c4ebd78026f69b, 0x233afbc22f4513df, 0x2714fc01e0c564cd, 0x10828cddcca05c11, 0x4fad262d65fbaecf, 0x79866515a459adc6, 0x47745997230cc3b0
+, 0x15b736e1d21d627e, 0x43d9e97bd81eba38, 0x51b2ccec3edaa69f, 0x20542cce5b1ccafa, 0x08ac7665bae2e11c, 0x12b8ee393b8fb088, 0xa512f519300578d3, 0x0aef5c0b0030d886, 0xba9df8d5c0d35dbf, 0x48da852eb5a65aac, 0xf11338a477e2c7f0, 0x74a0b768a07069cb
+, 0xf975699afe410854, 0x710c2b61656f4aeb, 0x061f1cfeadc4e000, 0x09a8255b3ce83566, 0x1cf67489350f33a3, 0x3078da87736bc769, 0xadbed9e11925cff4, 0x45dfffbff460ce8f, 0x1e5cb78fc202750c, 0x256cdf57a438fc72, 0xc25e6cf538ab6732, 0x6d037ead5f478b66
+, 0x949dfce6e1beac4b, 0x5b960f2b319eb14b, 0x47fff261afca5b0e, 0x5cb53da843427763, 0x269d2f9014c22dc1, 0x12de0514bea6fe6f, 0x9cf77aad3516962c, 0x63bf35331536b608, 0x58780b5223368d9b, 0x1e8f9f8b36b2fc09, 0x3468d53e7ea30955, 0x5a1198d338774313
+, 0xa503bf885c9b8bd6, 0x2b1f02c60fded8ba, 0x2b8ec668119a0d1b, 0x5e1d64db8282fd1d, 0x4fa7510dc894ca53, 0x31a9717f29a44478, 0xfafbf324542622a8, 0x332ec5ff1740eace, 0x423341b17a1b3c1f, 0x4c6c56bee77db0b9, 0xc68c61b55a547e78, 0x715769f0c2e2d8c3
+, 0x6a9b5485dc9e7ac2, 0x13f0463a174f90de, 0xa2c38e525e921e5f, 0x30a5b24b0751166b, 0x7b464f223290722a, 0x090836bdcee34f71, 0x1a296ff0a25a80c3, 0x0e1e9bbefbdc240d, 0x2930c11ad9f30d3e, 0x18c566781fa7a3d0, 0x06aa78501dd76ec5, 0x3486edbf11563b9d
+, 0x541b5c1b6d9362e2, 0x6e2ef05d06c495e2, 0xc57223191d256d45, 0x5902e328b1a03be7, 0x280d025df9813fbc, 0x704b0b588aab5f58, 0x31e0716cc7ee002e, 0x1796ca00b176aa87, 0x071d683f301073f4, 0x6edfcb6baef5cfd9, 0x637c7d9a77781b2d, 0x4f3f65cfb9171271
+, 0xe03364de3794b68e, 0x6e17cdf03e7dc17d, 0x1b8cfc6af22683e2, 0x3dc274ea1fa0fe2f, 0xe3906042e6f57675, 0x4a6b72cc39eefe2c, 0xaf13747f70a5dc89, 0x08e0fdb34d1faa7d, 0x4ad5f80e033d56d3, 0x1fffa520cb922913, 0x1ebf1f198daaa086, 0x36ed141fd9ddf863
+, 0xd210627ea3ad54bf, 0x16fe27f225a44f35, 0xbc7ef1e11bcf2897, 0x2e04146815c94fa0, 0x52ede9f96596776f, 0x2f314d89dc317c75, 0x02a72c3d72caf880, 0x1b416532c8be51d4, 0x669a94a2cdd114e3, 0x2d1f8499a7846b68, 0xe6c38ab5ac8b77df, 0x42850f16c153b313
+, 0x985feaf43dcf6ad6, 0x182611a9d87a4866, 0x7106f3818780a222, 0x66a3d2b933ae39e0, 0xe05489173ce58243, 0x65b1b3c01c2176b8, 0xd2124f3790d5157f, 0x0819656fd4edad3b, 0xdfeb1498634d9879, 0x7018420173b9203e, 0x34fc4169d0f966dd, 0x788abae82a9ed903
+, 0x7f5c28b3c3902568, 0x5b99543e2e808a9d, 0xad68e8c4118a79d1, 0x4fe42e226b498b8c, 0xa7b4f1aea6a7988b, 0x4253b771cf841d3f, 0xbad501f47eba8248, 0x2dbd6285a45242a1, 0x05e5768f56d9f668, 0x13a49f61cbdad703, 0x6d26a92372eb49cd, 0x31631d9b5ad7c42a
+, 0xd8389dca923701ec, 0x0b4dc63ea6dcf781, 0x7c63f27d2a02b85b, 0x2701c6177c276c94, 0xd6518f6b17862c2e, 0x400e9aca4499f27f, 0xa1839084ecae6702, 0x30b86a17a91178aa, 0x3724a68e05b77e6d, 0x6050afe0318a72dd, 0xb29f33234e0041b0, 0x7ef25505b76b53c6
+, 0xf81efb74ab52359e, 0x55c2c0b9d01a7f62, 0x24cb1607e95a188e, 0x11a2aed4a5130e0a, 0x6ceae466ddc5a93c, 0x4f3118a68b3820d2, 0x7e9a3a895924cd23, 0x769c0f9567a9274f, 0x43706171f30c6209, 0x6da388f4b9cd40f2, 0xc59c82e34127eeb2, 0x3d0019f4f2361671
+, 0xfd855fdff973d3d8, 0x67debcda94ac3d1c, 0xea2f5d48e99e26e1, 0x5b9f826dd67cfd53, 0x87a8d4af48b5e315, 0x27b63b32e1ad33d6, 0x6ebc96ac177aa28e, 0x490c8356af790931, 0xf98eff48fb4540e2, 0x66c9879e41f3c38c, 0x42449be89d1d267e, 0x504a9dfec1d721b0
+, 0x5bdb880514b6fb64, 0x320e8bdeb7f2e31b, 0x9361df163734f6b0, 0x7b7a2f6518ae930a, 0x39232d6035e848ba, 0x00033863460a63b4, 0xced849f6b12cbbb9, 0x5ed96bc27ec011e1, 0x54b95298d8debc17, 0x5934e4a3d57b568d, 0xb8a292c8a867098b, 0x4f75ca0c6f610442
+, 0x12248fe94f0a33aa, 0x5acb031bebc92849, 0xedade442ab8160e1, 0x7c25011b404d254f, 0xb3d6eb15f6809701, 0x50b933dfa9465351, 0x723681baccd3c757, 0x0441e38be4d1abf6, 0x33455ade87472a55, 0x5287f65bcd12949f, 0x515bf5f69fbab4fb, 0x2cc9e8d926e17c18
+, 0x224af830763b29e2, 0x59f76f1494c9425d, 0xf06d7c41f53b5d91, 0x4034fdeec7ba27dd, 0x1acaa4432abfee8e, 0x0664b31fa9a06e49, 0x42470ce071fcdd26, 0x64257f382c00fb91, 0x4f002b856d83c555, 0x3ff3e8ce276ecc70, 0xa6004e3b3ed6fdfb, 0x6f9ad4115d1bf590
+, 0x9853a642324e24ca, 0x47287feb1edaa7ab, 0xa64c549d57c9fb76, 0x793fd023fb9dbe26, 0x07ccfc783c7fd79d, 0x2e2864f2a31521a3, 0xdaf62545ee610f07, 0x52f3683955683fb7, 0x48ec81b16d0aedae, 0x3938edf8de3c263c, 0x8fa971002ff49482, 0x390fbfe7bf0126bc
+, 0x1427f246d0350c35, 0x78a29a12a3e0f0f9, 0xcb6436b05f6bf505, 0x34209adba8d966a4, 0xf8915c301e9932bf, 0x17b7b4e6fc03678f, 0x422db71aedb977a7, 0x69cd7934982d056e, 0x7f06e2cdefcf64ba, 0x7bd05d206ee6a42e, 0x3da1f997610dbbea, 0x6365903931b27896
+, 0x539e92e8c7866ce4, 0x6aa093c43ec39fca, 0x41e15d070e791e6e, 0x6ae4f881a4cea2c2, 0x8c464ab796e6acb5, 0x3a79e3a0ed820f9e, 0xe773b19c50630e80, 0x3079f7235a2d5534, 0xcfbdb4e47431a613, 0x2d128232f1f81d01, 0xf950169527646822, 0x09f2a5cbf405d4ac
+, 0x3c62d0aa8707d7cc, 0x3d05a18158be2d09, 0x311c04d1502f34d2, 0x731a6c801dabeb1f, 0xe1abba3f2eea76af, 0x062a59dcc0db892d, 0x1bc81cbd839e43c7, 0x09326de98f98c652, 0xa4553a179b0d74d0, 0x0623e39d880c4648, 0xc87209f4e5b530ee, 0x3a609524c6039827
+, 0xe20a042e20550958, 0x1d694d5a7c66de5d, 0x9bda23aab6247296, 0x50efbe274d2731ff, 0x5fd4318ea2d42730, 0x082f0a6945e112c4, 0xa42ef7978762261b, 0x058b5e68e4202c16, 0x18dc1a5576ec4672, 0x551ef95ad724e678, 0xb32104966342eafe, 0x65db4097249d9aa9
+, 0xf42c50b9652a7ec0, 0x310ccc4b178da0b3, 0x9f44721182b8c187, 0x2cdef84ad11836f9, 0xf80d9e2b3e4afcb7, 0x69303fb8193d58eb, 0xf4b23fba01e6d27f, 0x0a7f6ebeb138f070, 0x6cd80453ee7a5991, 0x47fd07cdadfc79b4, 0xd43a79a9af74e4e8, 0x6ed1457bc95c274d
+, 0x1a6418cb258614ea, 0x14b7e0e65c4af19a, 0x44e1cce94716f7ef, 0x29f7bd6c9f6709a1, 0x51f52dbc400fd537, 0x6c46f7688c4b2282, 0x8911c8548be7c315, 0x5022d6c7bbb0267c, 0xd813793b64147910, 0x1708b3eec4bbd9c4, 0xbe3b71c9d0ee1302, 0x41786d5f326c6ac4
+, 0x2b38cb1a3942b8e9, 0x0729cbbb5ff26f74, 0x637d5eb9708cfced, 0x6f1e5540ce8abd37, 0x94d23db3cdf59a19, 0x30638a2e36e79ced, 0x944c22b1c9b47596, 0x5e41711ef0c2a7c5, 0x3f2533df3ca62bb5, 0x022da49fbe39381f, 0xbc7905e8b4b47337, 0x2c3493bcfafd4c08
+, 0x1ebf2111e57dd140, 0x046c3b30dfb242b7, 0x804b3cb545253f49, 0x79b4f8d4dc172294, 0x0058d3de5f1682a6, 0x2043dbd6e5f8fa31, 0xdf039169ce6fb6e0, 0x35fa2ccc3fe09c6c, 0xbb23e38d08872ee7, 0x5c9276d64e9cfc52, 0x0665208d6763b6fd, 0x6b136bb51faf5401
+, 0xdc61222db1f9581a, 0x0a0917d3b0ae37f8, 0x69e2cbe8bdbd6a30, 0x64eabdf2107ce93b, 0x0c79d6e3eee63a3d, 0x141ab8101de7a719, 0xad64b8c90d83f4c9, 0x05f1a0a5bc239b7a, 0x2f78fbede6bd94a2, 0x0a1f5e960e789714, 0xacf69468ccb86d4d, 0x37fc108bec489c11
+, 0x812d3d94d3c68510, 0x7adee79b0f66c805, 0x33b4c55a73b8fb0e, 0x04201e819e78a086, 0x492e296d3690132c, 0x1252575d0ddfe7ec, 0xa80ab15532f05fdb, 0x78131dc369a2cf78, 0xd44880166b1756f7, 0x38f260e96ef4e16c, 0x46d93a2c8fa204dd, 0x7dcedbbb845cbe21
+, 0x6f901a0963a1e586, 0x787e1c269c6558a4, 0x14d497b0965aefc2, 0x4d9c3cd6abfaa672, 0x795229432e8e0960, 0x5e5d6fa6bfae8f7b, 0xd6f6b42f8a2c2513, 0x0cf752afe7d6ee88, 0xd457dc70ead6a2b6, 0x0d92d429157607eb, 0xe55ce64ca96dc25c, 0x47590736b1782b12
+, 0x25627b0e4af3f75c, 0x4cea6aada10f2869, 0x7953524da2d9e9ed, 0x3263822012ecec1e, 0x8d357dfc8e9343a1, 0x26d4921f69a5e894, 0x305aa84566244809, 0x673f3d44db7de532, 0x5bdf1c6baf6cca16, 0x695396f7a2f81752, 0x5ab79f6c4d53ad86, 0x1b23e566c188d0f5
+, 0xc9cc495bda33c9e2, 0x2b00d42fcb6d035c, 0x3afe4cd91c25213f, 0x02c58e94e25014ad, 0xe81b5b5280e20850, 0x38c9d8fc30900684, 0x3347da5ae49ec23c, 0x1ce86892e510964e, 0x4126603f074c9c2e, 0x1beb736d5ccdc841, 0x7a8d6298a2f973cd, 0x0b3a837692bab36d
+, 0x8dfb3e6c18c6238e, 0x7bf0ea8d1b59728c, 0x0fc444b95d3f417d, 0x0758deaa634c63d7, 0x40a9bd08d06fb7ef, 0x46a8137f0cc37448, 0xe683abd2b3f2f18d, 0x1040c0b340707d44, 0x85eb16f6b8ec5521, 0x278430275d95158d, 0x572b08df19d83b9e, 0x061ea23db4b0d037
+, 0x117389949194c7fe, 0x46a211ac52be07d9, 0x1a03ca22b62f4e00, 0x133faa7a96da26d7, 0xd486731e62583cd9, 0x599f339f075ad392, 0x8e33e5325fb8aac2, 0x7119eb0bc2e93a90, 0xd1f11852f1a89516, 0x18641c4943b4e47e, 0x2795d2714c9b1cc8, 0x711041ca134b1c2d
+, 0x4114b04602399465, 0x18e0da7e961b337e, 0xd1fba520dce61909, 0x42bdc87a50bf2717, 0xf24f396d68dd7ed1, 0x4206f6d5a43992ca, 0xcf68a10b3944a0a3, 0x3ab5d9a11927ee32, 0xfd8173eacf83779c, 0x08642c8c263895ac, 0xc092a52e7a4022c0, 0x37445d163cef53e6
+, 0x26c364f8f03bef87, 0x4cfa4787dcccb34f, 0x0d2dfee0bc04d40d, 0x0f151abef5f941ec, 0xecd99a7dd41127e6, 0x3b150cf0de91d2e1, 0x68173f9286278f6a, 0x390761b25bb877a6, 0x7a936a87f78f4c46, 0x7071fc8fbb476f11, 0x4b2c6f2ba7375cac, 0x5b5e90311e8fdc2c
+, 0x84d71dede4d210b8, 0x29e527713ecdcfcf, 0xf3155c8ba97752c7, 0x5d8ac50eaa642a1b, 0x587e875b6f9577d5, 0x7c474987c73743e0, 0xea2a79cfc4c14e2b, 0x0bb305a11060612d, 0x7b073fa974bcc982, 0x191b6661a0f0064c, 0x14b4b07f0407d052, 0x1e057d03b8e9a1f8
+, 0xf40d5416e68a9547, 0x4c21923a9b4c624f, 0x1c63204dda588f7b, 0x3a84f0516a73addb, 0xc3dc2a798a8ac23d, 0x266f62b7b1bff003, 0x5f8a41a54a37473a, 0x3d2e715ad20abc1f, 0xca711b5b483b864e, 0x1ab686aa4085ab3f, 0xedb29d6d29473cfd, 0x6cf79052312969c1
+, 0x67690e2d3e812502, 0x3af2ef49073132ad, 0xfef1c5764540a454, 0x5df685fdb1b82180, 0x55316ff27e2b8045, 0x1d1f4b16434542a4, 0x88616aad2ffafe48, 0x48d4a648944239b2, 0x2894324b6029f38e, 0x46776b9a7e8b8bb4, 0xe531f7cfc900f856, 0x1fde05fccf6fbbeb
+, 0x052f0b54831eea8b, 0x019ba80069396154, 0x19a4205d7f3f251e, 0x782b0d3b38710555, 0xf32e824b2538ff56, 0x334e593959e09d76, 0x35ddfc0b162a6547, 0x1d6ade9b0ac99d0a, 0x0a922fbd426e4b7f, 0x18af7fd3ba207bb9, 0x5e6ee5f6e9876f37, 0x334b5cbafd8285ab
+, 0x290f62ebf8353925, 0x2dcb3106653b2df4, 0xb6d08e25163c13d0, 0x080aff5cf54dda09, 0x0bc0c19df3ab009b, 0x59135474bb976187, 0xb7302d75517d26cc, 0x31ff37b786b1c103, 0x4ab2015c78d32214, 0x3c8e7347145c4fe3, 0xdfda0171139336ca, 0x607e9e0a0fecce2a
+, 0xbf53718338cc876c, 0x0d6de03d0cb1ca91, 0xd29268319be82e2a, 0x75f730cf8335f286, 0x92e47d4247a4c972, 0x5e26106a01a7adfb, 0x76878e7d5eb3d7a3, 0x08234cba0645e01e, 0x0748379216fa3f9e, 0x6891454adecc4dff, 0xaa805eac565d67bf, 0x2f5133962c35640c
+, 0x2dfcad00f113166b, 0x3595cefc268f6414, 0xa838fe2945cbca0e, 0x03f5fd1ba3502561, 0xc501625b6777a13f, 0x2bbd8018288fd870, 0xac3782f9910d9ced, 0x2ee722cd11687b58, 0x8ef2a089b2f3e302, 0x17e57be6f10a3140, 0xe035d81fced056da, 0x2410e4a4a947db00
+, 0x2d243aeaf09b89d9, 0x0582c774cf1c3cbf, 0xa0f67a78a94ef0ef, 0x17df16d1cd5107df, 0x02c5988eae8863b0, 0x4c565e061336b0dd, 0x68bda5b26f48d18d, 0x647ab09a76a768ad, 0x365824f8bbaa7865, 0x043c68c6869a13b1, 0x95c5923a7da7111c, 0x04c4ec42a95267f3
+, 0xd8faaa1799075ef7, 0x59d281b0555e3466, 0x907d56e145889781, 0x24f7f0b0264d2873, 0x31453ba2ca59d658, 0x1498d32da4e501ca, 0x6c8f04d1cb447328, 0x3091f6e086a65f69, 0x81fa06cbb8827bab, 0x6148ee809b0e03f5, 0xb62665506dd13aea, 0x37af5c3d3bcbfc8c
+, 0x5ea8873af75a46fa, 0x0c42bd7f2250d8e8, 0x0e3967f71e948fd9, 0x05530c67b4669200, 0xea081754d843a361, 0x479eb6d6419895be, 0x6b64a0dc6eda0c76, 0x202f97334020101b, 0xa2fed81133f65a40, 0x1b0422d8bd8df4d7, 0x59d72cc4b0047d42, 0x1829445ea0d8105d
+, 0x6fbb1ec54ffbe4f0, 0x50c79f71ebfdc212, 0xcaaa193f4036bc6e, 0x63e547fabdf1f2ad, 0x18713c57c9a126b4, 0x2a947f6880900c47, 0x3ca393692b7b331c, 0x39d1e6789ec07299, 0x3b5250cba1cd2130, 0x4d9c9a36d707c911, 0xdb5841c8d0fa0f35, 0x59d7703b490e953c
+, 0x3c19f3c3121e76a9, 0x1a551b8eeeb35e76, 0xd33d9b96b3208a2d, 0x4b9b65f6792eaa7c, 0x23a07b8036ecd369, 0x371f18fa143f98db, 0xcbfb9ad763fc3fc7, 0x398d0a745d41b642, 0x2d48a968e54ec564, 0x172f6a136561b6c2, 0x499e4c85f884f0d6, 0x3524934ce062da46
+, 0x64f1372e13d7cc4e, 0x50c5be0faaa44a12, 0x69de05f57148bdcf, 0x42fe1390f7dfcecb, 0x20664bab0d8c68b1, 0x7e653669019360c0, 0x90365bfc389071c1, 0x565e6e9f2b26440e, 0xcc32a942b8240944, 0x608d024c1c82eb37, 0xc84abcb9400508ad, 0x65fc4115aa3a68d5
+, 0x2baa624526e16cab, 0x59c50fe7c08570d0, 0x418fee3bd5db9066, 0x5b2a6733737bced9, 0xeeed98c4d4172476, 0x0e3a16899a3aee8a, 0x0efbd22f818135ac, 0x7cc9e7f3733ce0b7, 0x6aa0896ee7feec3a, 0x5d72586fbbb9f134, 0xe7806afaaf2f1850, 0x25a8ebc0cd09171f
+, 0xeaf1525baab1ab88, 0x2b7fc0a4be6844c1, 0x82597cc2c38fe5ee, 0x62608719bfb5198e, 0x42db278be41a2453, 0x7004c566a632e8da, 0x947d6c7e60a5128e, 0x5e640ad944eb349b, 0xa04a7e1fd6ed7e52, 0x3d2da6ef2e852889, 0x0c379ad060338d07, 0x11a860904ceeec2c
+, 0x16b68a208d65c437, 0x2a2d7b3a7bdc002d, 0x6ce9b1cc467a13ab, 0x1af05238d7e25543, 0x39ad9f20095cd23f, 0x08ce99a84d4eb2a7, 0x150a2ea92112cdc5, 0x60b48b6ce23e70f2, 0x1e370ef90920f0cc, 0x1e691e181f2cc99d, 0xdfe831036dd4a3ae, 0x1725832ee973cdd9
+, 0xc7ad1e3a8e8d0d91, 0x5f19ddc580388e49, 0x4f331a7f5057378a, 0x77f25207c66328a8, 0xb66665501e651906, 0x6f8441dcab6ec950, 0x9dfde863c25e571b, 0x5726f6eec3081e07, 0x7888c2afc8e5e9d6, 0x6ce505fcd0cd9481, 0xc937a17f926518b3, 0x147767b6dbdf59ea
+, 0x5fe6be7b9f409d9e, 0x12780ffbf4f1ef86, 0xc8c27b02aae84cd5, 0x4690185feb9a8931, 0x15b25a627cca1130, 0x4ab6c46a7204829e, 0x5bbd8d11be7647f3, 0x3250f8dd97932f6d, 0x9ca1fb857ec51670, 0x572da7a359656875, 0x031ddab203ca44ce, 0x08d99bc5d71ea079
+, 0x22ee2616da84a08d, 0x5891647a82ae88ae, 0xa238d1fe9421391f, 0x192587dd488cb156, 0xbe03e971a3537a1c, 0x46453b99a9188e6a, 0x6410fe21ff4d2e98, 0x0f50f9aa7960ee5c, 0x6bf9b9d5348aa284, 0x02b8b5c67fd83a50, 0x213cb114c634920c, 0x07196d79194fea1a
+, 0xc52d8971b3b259b4, 0x56302d9e800c9b01, 0x68e46b2ff3824398, 0x4eb0c521f3fe450f, 0x23f44d33c24cb29b, 0x4d37512c4642719d, 0x20fa22f9f36fdd78, 0x6507decdf78939a9, 0x7286537547fbcd9a, 0x73f255b6750f29fa, 0x079c5996aaefc485, 0x74ac816cf07c53bf
+, 0x2b91d7f0af8d52f9, 0x1d8ede416961f3ed, 0x7c7a67c03f65b3fc, 0x0ca47d692003c267, 0xac99b26df252832c, 0x1cd77f92e256d512, 0x7e20707cc7537f81, 0x4c5420129359b55e, 0xbcd61805af91a437, 0x79d4f03be1e52b43, 0xbbcbdad05c1ba10b, 0x340cd689c72bd344
+, 0x6158dadb8a70b40b, 0x5f55168e001fffbb, 0x5fb9c182491388a4, 0x19b2b26fb109fafc, 0x217112db412d9768, 0x1916d952bcc976fc, 0x9ff8067b7027bde6, 0x02f5dee5c4dadd25, 0xb18c24bd422b0b24, 0x423cb9a85aefccd2, 0x6f5747ca6b90d5d9, 0x25618e7b8970439c
+, 0x0e549cb0a7a7a38f, 0x3117863728785577, 0x5caccd4fb71d71b4, 0x2140c55def211569, 0x6688a294e9ae5e72, 0x078e5c66182abc1f, 0xe70acdb82363af27, 0x0adce595b06eb3e3, 0x2c398f6302821132, 0x13bd1dfa72de4d74, 0x1e55b5b03cdc075d, 0x1683baede976e51b
+, 0x51ea04b0c5e98c1c, 0x7b50664bf9dfb64e, 0xdcf3342498212282, 0x282d8d3c5e995abf, 0xf270ddd0678b54fd, 0x2a48df8322129224, 0x685ac7a802098ed0, 0x1e6b9cc96c390d5f, 0x6eb6a79995ef860d, 0x611f84c35ae1114c, 0xb9e132f0294f9322, 0x3e90ef0387c2c7a1
+, 0xad989e74e3cfe381, 0x4a067775b01d4260, 0x94b67e6a354c4dac, 0x2303e7b959ffa1d3, 0xd076399f87af3eb3, 0x1ed47228cf26af43, 0x4d6f2d6b5d95afb8, 0x471aff9ce6d54ff2, 0x1fd35724bbc4748a, 0x4766a233eb489efc, 0xdf07b20abb77b960, 0x0dd365ec91d1e1c7
+, 0x8251cf0f86f10625, 0x7ec59ec178d6434e, 0x09738a89540128fc, 0x53211c1c9e04047d, 0xa69721eb0d7ce3b5, 0x263bc9c1735d7c77, 0x7e1d717a9e6b2402, 0x62da9063bb472ad0, 0x10b7c36f40a0f42c, 0x47c16bbeb77988c1, 0x6f8ebb9786c48fc4, 0x0958b9598aef481e
+, 0xe68951b616da608b, 0x650d6851216405b0, 0x260c23d28803fc69, 0x03abedd497c4c3eb, 0xfa461077aa8f6e19, 0x7978527dd424b989, 0xbd2c47889c1aa416, 0x4cfe3ee0ad51bb8d, 0x829ee2c291546147, 0x2e791fd899044de2, 0x3dfa58f91a5d783a, 0x5e21e05a0c4b5185
+, 0x71766e15424e52de, 0x72f5e3ccf1de206a, 0x08790ae39f8dfd2e, 0x175a8cc0a92f3450, 0x543d8baf0045da90, 0x19d2cc89d9793dba, 0x691a67c8f29396e9, 0x143b1b3fd554e722, 0xcc933b97353da6d8, 0x5688200fc35ae3de, 0x6e7a1effdc2eeb37, 0x45f54985b39355d3
+, 0x6ed60c674b8b0fb8, 0x78b4247ba3206a1d, 0x58912869e8b05b9d, 0x7f4677ad1349261a, 0x198382b1c92b1cb3, 0x6b475d67f146d7bd, 0xa842301c03d440a7, 0x77df84e52403c442, 0xcc32ca7d330cc1e8, 0x5b1ebb35ac82c61e, 0xa6cf8dfaf44d7ffa, 0x7c79b2eade63925d
+, 0x6685e3e9798ca324, 0x334f4cb4ea591024, 0x079a94a87722a08f, 0x14646dd724098261, 0xe422096682746b44, 0x17761ccd87a72899, 0x02a94557572d40a1, 0x07ba72b540cc4a08, 0x79e66c2f8bc8cc9a, 0x7c4edc28d0d4e265, 0x32c7a061c554ae37, 0x082d8bbed736d3e7
+, 0xcd5b2e3cb8082f00, 0x529c97c40099ee49, 0xb16a0f8c067e2096, 0x693b9b18bd8d2f9d, 0xf45b54fddc9e3663, 0x446f825c8aa80edd, 0x562860e759858604, 0x0c87842649e21b56, 0x8df372c012c46d0c, 0x55d8717c3d39579e, 0x6fb6edc75066bba4, 0x469b16265fc3f974
+, 0x7ff1755759e9eea2, 0x117b1a59e8722ea2, 0x019707e13a0a4680, 0x77e5d28e171fedaa, 0x499feb7b44d1d6a6, 0x1c813885eb6c29d1, 0x514a698773589d72, 0x00be3834e42d75fe, 0x819aa35448e660da, 0x750f552b7e16e5fe, 0xa077ac49c53b4ee1, 0x1af6cb2aa4e8fddc
+, 0x496068c767b4eeb4, 0x4ed16eb0c770d741, 0x0f9c79e0ed403cca, 0x1f1518aacf6b2d16, 0xe05a34580d2e8b67, 0x1e0f8a44d04fe4bb, 0x2789beee1cea3b1c, 0x17a2d64e9db68d62, 0x8faa1ce81b149313, 0x60002082590ff9e4, 0x2d1cedfc70841904, 0x7db14858d03d299d
+, 0x52e796ceb3c8d728, 0x24ddb1bceb84581d, 0x947c91e6a200ff33, 0x5b5b1061b25814ec, 0x367098b133346627, 0x6bd0a6ac259bbfa0, 0xf648baafdffd5456, 0x5c89eb1951fbce8e, 0x842c4291fe2f3ef2, 0x445d3ae17a58fafb, 0xdaeb6f609f5f2868, 0x4d8d9f2afdcc6ea7
+, 0x11f325b4d6aa9e6a, 0x37f23f2e6bdde914, 0x7ccf8cabf5dcd584, 0x1cc296456547615d, 0xb31011771ff9fbbe, 0x62b5f85fa9311276, 0xc9651981e0bafe60, 0x6ac0154451c3fa81, 0x3c54854ed76478d9, 0x0e55eb8652d52b6d, 0x8431602860e14c68, 0x680aa02e81934ea3
+, 0x57142a00e2484e58, 0x705b5e3902fcf1f7, 0x6a8c236574e465d3, 0x2c76adf6b66e9c4f, 0x106c98201000feef, 0x44fe3a718d249a66, 0x5617f187235e87d3, 0x3fd9e7f8d81dd98f, 0xf02dd9429587ec81, 0x7c53bd237a062fea, 0xa8e3ee2b3215827e, 0x06b42b0348a9165a
+, 0x9bb3fa6073ef29cd, 0x253bf2edf2115baf, 0x18bb8ea050a15230, 0x42fe5ec55dfb37ab, 0xca84158c9b0dcfd7, 0x014102da72814945, 0x3a1981a4166bfb1b, 0x7a9ee3f7b84dec71, 0x418fce1716db3560, 0x77ca59bc339836de, 0x8a1a608e32dc2cdb, 0x0a79e65d1f8dcc96
+, 0x041340e24eba9acc, 0x1a5a1d7bc8b0298a, 0xdc2dbedcfac44bd5, 0x4bc1b2846a49d7f9, 0xccc0f4b32c1322b4, 0x2dc0e200820b9242, 0x8a6ca74e3b2eedb5, 0x4400ac65517ed187, 0x905db3e3a2e6d87f, 0x59336781bbc7e352, 0x7152ffd0f53f2508, 0x762739f37b4ea305
+, 0xf789c5e59db0c7ce, 0x4d05cc60367ce155, 0x00516b18d4a9a976, 0x3c8218bece741b61, 0x8a951adfbf5e74c9, 0x0fa63eac93c0c50e, 0x0e3590a3a86ea6e2, 0x1451b5fcd5334003, 0x0132e6d966ee579a, 0x489310ef974a105b, 0x3c615b11821fc659, 0x70a07b20b9a72649
+, 0x862bf05e50ab5dd7, 0x046ce740b12ed575, 0x87cad964eb5fc680, 0x7d79b70f006b6951, 0x785fc183def8efb0, 0x34fdafd16211d88d, 0xb2799d6f9cd5f978, 0x304f35a452f95736, 0xa526ada50ed32ad9, 0x477d2d0533fda2ab, 0x5fc1bbf258cdea75, 0x01a67428acadc98b
+, 0x575d821be5a41002, 0x06211ec4fb16689b, 0xc76562e210d7aec9, 0x18f3fb42ead86022, 0x250f20df6f5217dc, 0x698feecc705de212, 0xc7c4fb048dd11a42, 0x681cc663c9a86e4b, 0x2985b22e35f4a95e, 0x2eb976e64094a1b3, 0x1e7cccca9b02e66b, 0x54b7a3ba50fa9b33
+, 0x1c8c46c4f991f8ff, 0x0f9b61f73f4a7367, 0x06c1fc5ebd148d5e, 0x7c105842805b611d, 0x1fa77384b4533486, 0x32a5a279b5ccd14c, 0xcd9d178930609013, 0x447d62db0e6a0628, 0xdd3b54939f14572d, 0x30eb0e3ea9f796bb, 0x1dba2af30ec662a7, 0x255bbdb4566c9480
+, 0x1b073e538117350b, 0x6e2d362e9d94599a, 0xb96faab498d0f26d, 0x079b92581d21f447, 0x73f0c3948faa09ee, 0x4d0070596efc2a5a, 0xed4fc859df9c5c56, 0x57daa6b7ef975390, 0x218206a2e7c2f549, 0x5dee102b4625d77a, 0x15eec266cd430d9d, 0x5601fe6c386e79d7
+, 0x58bff945100c03af, 0x7c1aeca23908f2da, 0xa8e94303c5a46508, 0x6dfd1fa6a3952764, 0x1e5f8471814dfc9f, 0x67894f8311d805f5, 0xbff7402288c055d9, 0x201833ba5b36d574, 0x61aa39d880c184c4, 0x10f04800e3d3eed4, 0x7bc17803e5e529a4, 0x4bdc8687489a7493
+, 0xe95f8b71b9cd8f10, 0x4496d4a5f10f36a6, 0x8195a72ac28f7423, 0x5c340da071d14411, 0x8dfcc576540a8de9, 0x77aeac49edbab932, 0x851adbe03bcf4bcd, 0x4839d8adb5f63971, 0xd4520474e2072fae, 0x69dfc927ef50b3af, 0x5803f076c96ff2a9, 0x2a90a3aa8361260e
+, 0x5c33d90e366fad17, 0x571981ab1d273165, 0x7027c02c8a143e7c, 0x14ee0df95db39013, 0x84ad0dd822646f6f, 0x70d8298992b26377, 0xe3935860a2b0a802, 0x5289d6b985039a8c, 0x1ce7e01ae0b5b6e0, 0x4d60e6c39a554f75, 0xca65328d272696b0, 0x07ac2a99cc5cb493
+, 0xd155f470d1f5e0ce, 0x4116114493b8b36f, 0x6c3903c384030d53, 0x74a8c738631e95b4, 0xf5467ae060bc2e44, 0x0d4ca6eb21e93c3b, 0xd3d80288c2f5e7fc, 0x46d4c62c9acfaa79, 0x009b4814a4b471b5, 0x1cc4880111bd6d32, 0x67f0fd017a0a7e4e, 0x0dc04495ded161ca
+, 0xd2152d7470f401e5, 0x7f2c9263ac2482f0, 0x28fd831f3e6d0837, 0x492392a3c1c9c7c3, 0x45f7ea5162df0ebb, 0x2ec9d948dbde9dee, 0x6952475756e032ec, 0x216647d2952af109, 0x7de70dc302fbde3e, 0x764aae36e3ce8f6d, 0x56f7dc7ae48248ec, 0x3d700fceb00c3ba4
+, 0x71401d9868b03ae2, 0x0b2f3fa3010e2e50, 0xd0570c4252881bd8, 0x44c85e474e14d163, 0x625a9abd4cecd283, 0x7859f7e9625b020e, 0x8260fa1c8a20d00e, 0x19a31300deee93f8, 0x0e11e71a456df0c5, 0x18a0a2e3acd51862, 0x95d8bc843856dc06, 0x348b8dbc947a41a0
+, 0xa8d5d0b75ae38c3d, 0x1dff41faa2fd22c3, 0xef3ef324e046d19b, 0x09e2a4512521a600, 0x8f8ed4f84908933e, 0x174e9958657a093a, 0x22a8889a4b1af3ea, 0x4c2bc7f106083727, 0x20a967cae6606c8e, 0x0173978d6a3f6a05, 0xea32d3b95d1fdc37, 0x381d5198eb3c0ac2
+, 0x817d8dd4fb031c39, 0x02a4f4c1692dcc37, 0xf38e75ce91d3c953, 0x3f223f4fa62b6d08, 0x77ce5efef5739350, 0x1a932d0b2acaa104, 0x7f3df7af994424e7, 0x569c9688aa302779, 0x3d675aad077e1bf2, 0x6d48467e0138a9ac, 0xb55ed6755487e0cd, 0x57cf249dfe536bb2
+, 0x8c0c669ed4432166, 0x47c80a4bfd1c0837, 0x1bb928ab254c716d, 0x52da5829732b89f5, 0x47209bbbab132582, 0x4d66e7b914d0f5a0, 0xd035e3e42749519d, 0x505a4412b3190793, 0x44c00692535074d8, 0x5732f6064c7c4057, 0xd061bf790ba9fe5e, 0x270d62c7749d28f7
+, 0x578919c2aa1c7a51, 0x37fa10e38532a19f, 0x889cd85b9b314d59, 0x31e22a6718d4ba9f, 0x1af6131760df2399, 0x6464983ae2897378, 0x03357128e2851388, 0x5046ae228989ad40, 0x949be6efd0ed6ee0, 0x055b30ab871096c8, 0x9a87480e8145283e, 0x3827318fe7c0601b
+, 0x9bfe0f2f99d7e24e, 0x1a9fac1089b2362b, 0x8419b3045d945245, 0x1a53b1db6e055833, 0xc49f2dba9f569e64, 0x70e5870e10cf14a2, 0x84c1772a1c183e91, 0x03aa01254c54a0e6, 0xacca77fafd125412, 0x0f17500f97e3ea0d, 0x6a9d77c956270bb2, 0x51061b3f47879a06
+, 0xdbb570042928d45e, 0x18ca3b7896825ad6, 0xa0ca45e9980a0deb, 0x365e7d754b8855f7, 0x72005fdad6d8a994, 0x39d78b886dd81ec0, 0xf6653660b5820f81, 0x7a2951817eceda3a, 0x5175a16be1813cb5, 0x70c23af659cf3b2c, 0x7e569a67d1bb324b, 0x22ab490eb4287733
+, 0x22a066d7d0f506dc, 0x2cf330297ab31bdb, 0xd3731beb6d005cdb, 0x6f2397a27a9c4c67, 0xa4aeb37d85dcca9e, 0x2c5d749a54b5f539, 0x922a939a5fd86287, 0x445dfc928eae6c69, 0x0d470b5b6743e15e, 0x51913bda44fc2187, 0xe1695e4fdf8aa76c, 0x67d2c63dad226e09
+, 0x7b503e0fd4680062, 0x1ed5d517a341ca89, 0xbbd58a0a1b9432dd, 0x6335b17a9232d936, 0x14d202a4ab23b11a, 0x41aae1dace4c7734, 0xd4bd82f0968ca4d2, 0x33d9b15942f56e44, 0x32383d83dab1ffaf, 0x41467c091810ad65, 0x797bd331dfafa71f, 0x114c169996774880
+, 0x178a21bb5f549a6e, 0x39261e13fbd160eb, 0x5c347fb4f4ca6e9f, 0x1b6ae1406056849b, 0x583fa616294ef508, 0x2611521f60fdf83b, 0x6388bfa8005d689f, 0x7032b3a797ca28cf, 0x14a2b0b1d26621f9, 0x49d968d92696c497, 0xad68dabb3fc8c7b8, 0x1dd3c0703ddc3288
+, 0xa83de0d08814aa18, 0x16836484e1e45411, 0x712fa614b5a0887d, 0x01223ecfe7109e99, 0xd64e5158b9463aa0, 0x5b56fb4d4c7bc265, 0x1903166e87486554, 0x523eaf972897f1d4, 0x1cc8565db407a1d9, 0x7b06d20b40b1dd90, 0xcf98aa0a53a3e6b8, 0x184e28296b91b694
+, 0x53bd5887c381d2cb, 0x659d83c5a08ecbf3, 0x73b3d95e56f0709f, 0x7aec1f65f82bb025, 0x39938b181cfd720b, 0x05f12ced2673037c, 0x2009aaa311039d4d, 0x2e9deb1bcb0fb9b2, 0x655af1f904d92653, 0x15574bf1107183a7, 0xa016281678723313, 0x6953ba95e3a50069
+, 0x7c88d9d472dbfe7d, 0x0687f8ec0e1b8874, 0x0665b8fbededd988, 0x4f3abcc7812b3fdb, 0xd3578b164e586dea, 0x34d85b0fb62ea27c, 0x0fa01b52fdb2556d, 0x2261a906d6b4e6ea, 0xf2dc8b25f6db0872, 0x5a5ff4af63ce72e7, 0xaf7a008b2053459d, 0x1ff28d7f0b4c4e04
+, 0xa182124e1f32fdb6, 0x7b11162e301375a0, 0xf5e015757ab98a03, 0x264ffbb1b39880b4, 0xe20a450ee81939fb, 0x23edd509951cedd5, 0x680301dbdb2e4902, 0x0dfcf18d4f502abf, 0x9f290a39eaf58bea, 0x04a3486f0d9f1bbb, 0xa4273870aefc07ba, 0x7ec42375bf9fe9e1
+, 0x0b605ccef633675f, 0x34f7471a961ceb3d, 0xff4f932d6b882802, 0x0360aba26ec94a54, 0xaf2d9de887459f9a, 0x6c647d6343b6ca90, 0xee372bc95e537f33, 0x2ec183f1e0c25a65, 0xd762211fada409ba, 0x7901fef5057cff9f, 0xc98dff47dcac4b19, 0x0866a35f07c37a7a
+, 0xe555203777ace560, 0x255b9e706537cea7, 0x675785f6911778af, 0x49a8c2123c490148, 0x11f1c575945a3433, 0x160be461cad03008, 0x87fc4712b68ad71d, 0x4b321987553f439a, 0x0541f7a59db66ca1, 0x6e97ea6d1943d3fb, 0x82e92e9e082bc2d4, 0x372ce87638e9ef59
+, 0xf47f313c36b680d2, 0x6ed99eec473f334b, 0xc3228852450d7be0, 0x4d50368c2bbfe8c5, 0x341ce937b86da15a, 0x589fb465c1d12e4e, 0x8114c06d3604de2c, 0x7a7ae5212e4ca302, 0x3bd8ed0d4243669e, 0x35e5bd2b95dbff2d, 0x2161c0b8f0d893bf, 0x5754e13bff8eeb4a
+, 0x0294d3e11a02941f, 0x48dde4b6a25c1baf, 0xc2cc421e35e39602, 0x78bae0c5ddb644f8, 0xded036ee3a8cc591, 0x6f920ba0048e3d1c, 0x7928a3cab3e8e14d, 0x73150ab481aa1c97, 0xf821c206f911c0df, 0x5f0df06da552fd79, 0xb8d3dc9976da85d8, 0x35bac215c05c03df
+, 0xfef6743ea083ef17, 0x30d1969eb79fdda9, 0x71565e1f76439bfb, 0x05435d5855336140, 0x5d6aaa3ca019bb30, 0x10bdcbb33e3136aa, 0xa2a4f9b6137822be, 0x46c9ca902b3d8467, 0x266529aa0b2019d9, 0x74a937f73eba2c59, 0x6626d11fe5635bd5, 0x2841d99cead45086
+, 0x255daa6069e74911, 0x634884d108379468, 0x969a82142ec5e7be, 0x4e7d00617439f2ba, 0xda085161d7e069a9, 0x7c30736a5ec21b3c, 0x6ef39ab7c925c4f9, 0x3142ea56004f519e, 0x9252ca5c4e21d8d7, 0x59d2307f6c34bff5, 0xffefc421664af2f3, 0x6d712ac816fd0cd8
+, 0x76a4ac9863875616, 0x5399edbb1daf6b87, 0xb2585b008d270a53, 0x510a6d3ddb9805c8, 0x86b05f4d25a6f24a, 0x5d466956e671e0a5, 0x6ff0d2840d252f1c, 0x7dae178d2d0563ac, 0x55c0aaf6e3eaede8, 0x28d2646bed24de16, 0x62c31471f6107f8e, 0x71776883b048fb11
+, 0x75eb54120f9ea6bd, 0x4d88036319d2f591, 0x4b2b0785536a676f, 0x794e06ebccc7158e, 0x6b22b00a7c8f3372, 0x66c1be135de2e209, 0x311bd7143502a769, 0x1094a3acf48b2236, 0x08a57c09bb70fee1, 0x1b33751388d8c109, 0xe76127f667b77d04, 0x67536537cda09995
+, 0x11251fd78613bf7e, 0x15c0f7b69630d955, 0xfdb767739c68481d, 0x7e41b14462cd2b0a, 0x6266ca303dbb77ed, 0x3c299a99ee23f5ae, 0x6979b7477398ebb1, 0x588d1bf17c22fcb9, 0x49537eb4a3a871c1, 0x2f64181e469c8f0e, 0xfb7102a3b7092ec5, 0x1115b76538f6baf2
+, 0xd0577ea4efd056c7, 0x7ea0a3090e005fa8, 0xcd6500e25db3700b, 0x7dc514520de0f5e5, 0xb61aa8297a612a18, 0x072104770e1d0e28, 0x3f4f0eef5150e0d1, 0x12b8f2fd3e84d996, 0x5ce7469a8d8f1982, 0x42c8958a8cfce770, 0x00b2d507881d7da6, 0x52528813f5e30fc6
+, 0x87770ebbff2e2791, 0x09a9b3f882ec3494, 0x680a4fcb135de846, 0x09196f3111a94c1f, 0x8088f805bbe55751, 0x6ed86c160f01721b, 0x6037f23ac51faf7d, 0x13e46c2f7e5f9920, 0x546b017108c51e1b, 0x73cb8cd6e66bfa4f, 0xd211a5134e74b194, 0x0bd59850b3b2ab98
+, 0x0ade49a1e0662715, 0x3740cbafdaf10fbb, 0x90f0b2024cb333af, 0x36563f774f4d032d, 0xdee154ab9dd73b13, 0x36131e3299ce1193, 0xaf0c69ffb492a81b, 0x1363bc9484a4e5bc, 0x3ac773603bd54cde, 0x049c5ef1d6e794f8, 0x821edf813601d769, 0x07988dac1917f0df
+, 0x66d1c84816892341, 0x469489d10ba4bc30, 0x0c355741ca1ed28b, 0x5d8cccab0dcd5aa5, 0x30f9727b14beae24, 0x3b87dbf2a6f3ae1a, 0xb6d8bb4f3f9e97f8, 0x07f7a8c302907cc7, 0x4282367d543d9bbd, 0x74012d24413e486c, 0xa82ebdad15aff7a4, 0x0875c8101722fb91
+, 0x3d133484df307c9e, 0x55886dad4d695acd, 0xd2c24767541febd3, 0x5131186e18a24116, 0x97a2d5a9ff6e0640, 0x1348d054fa43914d, 0xa169f9ccec4b2cb7, 0x71dcceb96b9aa4dc, 0x9a8617263f8d9d1a, 0x74c03ab4aee63ea8, 0x15e19595b5fd2a55, 0x097e0e6086f4822c
+, 0x6347c2835fab06c5, 0x400ecd25a63574c1, 0x01d98a3db3ee413a, 0x33e34b6708766739, 0x085693491c77b97d, 0x776430f4ecaf1196, 0x0b01a97069fec831, 0x484a9a027e8b02cd, 0xf414d732c635d6eb, 0x51b6b4f700de825e, 0x87186133965c4ffb, 0x4f3571f9a0b275c1
+, 0x036771818b1126ed, 0x0fad854268c65354, 0xf29b92606d0903ae, 0x643de438fd811699, 0x74dc1e3974e9ad29, 0x727405500dea5c29, 0x211413f4956667b4, 0x669355c952333531, 0x8d3799c48b6aac79, 0x4a948bebdf65188c, 0xfa2b496d84ecc313, 0x758e0c6f1939e832
+, 0xc7a5d8ecee11de55, 0x65ee7c83b1bfdee8, 0x3df6c4ed8818ea9e, 0x5373f8fab6b0954a, 0x5a5c45cb1ddfb47b, 0x348765055af281b1, 0xc07dc9d4a154f127, 0x359b2586b6422db6, 0x875831fe26a2f4ac, 0x1d617aa810ba5204, 0x68746cc436a7923a, 0x7efe95f731f2002b
+, 0xfa77bf0fb5622014, 0x52385dfee5caf450, 0xea5fa198019ad0c5, 0x64edf6dfc62a76e7, 0x4f6cb4bb38b57b3b, 0x3f19cdbef121c8b6, 0xef3d198651559f9f, 0x782ecfb7ade899fd, 0xbb6c62a479c3ab14, 0x60796e73e1fd6d1b, 0x090fb476a9aafd73, 0x62470f21e64e03ef
+, 0xf45819dde0a8710c, 0x0c7a1e2d337ab822, 0xfff531600c3ba476, 0x6ea0d1438715af05, 0x81b04699386990b8, 0x4fbbf8e3b2b1f771, 0xedb8a86fb48e035b, 0x26d9a316b72f261f, 0x24aab6065f1793ff, 0x24f6e34a76edae88, 0x66c8356f437be200, 0x47838169ca0b801b
+, 0xb9d4f4e8c1f7ff98, 0x3f61080a5a77f222, 0xe47e7d6da5166e03, 0x087b44eba2534dd4, 0x3b896e55fefa0533, 0x3ce9b5e337a61d77, 0x35738fad576d8501, 0x098116079744dd65, 0x247756f8ad5e291f, 0x4bac9f5bf81ef83b, 0xd1536ca7d948dffa, 0x05167a3b1098a575
+, 0xd5b4d8f258cc6f34, 0x30dac3f25c59769e, 0x0d973443861c01c2, 0x17d31bdf6bb51928, 0xbb70c598e7a6f859, 0x453673f35fa06f7a, 0xf5a6f6c376665876, 0x4e840ab3f0c8c142, 0x355d17287dfe6b52, 0x1d710d28489b21aa, 0x29077957df135ff1, 0x2575737bf45aabca
+, 0x3cdddb843f6dab95, 0x7a827c8b434c5ab8, 0x09b438357a499d9d, 0x11fe52ab3c2a529c, 0x79fce4113e1a2274, 0x438a29da8e003d32, 0x2eddacfa0c25cae2, 0x3e0baeaadbae27cb, 0x12d807e30b5917ed, 0x68bf23aecc105dc7, 0x835fcb9cf73e9413, 0x62df5b91d06998b3
+, 0xe43c2ef4b8286398, 0x0a69970250d43769, 0xbecce1cccf2627d4, 0x77ecde7ff22fd65d, 0xad7e7eae20bd3f55, 0x3cf028143294ec3f, 0x4b2430765367fece, 0x37c727e86a5e94f2, 0x0bf4c66cd88aa2f9, 0x25a23f5958f8f515, 0x0f1bcf90a2c163e2, 0x69c2d4cb6e868003
+, 0x6d5ae8ed871963f3, 0x03c496a78a56f668, 0xbeef6e18831dae93, 0x40ee3d27661b1634, 0x8f8256a88b7892a9, 0x154995aca2d9f2ad, 0x2a8f9928ca6f0e0c, 0x34c49d2510ec0632, 0x1559f624f1e2d5ad, 0x1e39642bd46012a3, 0x898d1a37a3391b9d, 0x6a4a108e59eaa770
+, 0x6b82810eb00f7b35, 0x0cca70fc654e6b6c, 0x731831eb947a6419, 0x1b40214b1c858fe2, 0xb89f2c115456cd2b, 0x09bf77bf4b6111e7, 0xe8ded00bf9233223, 0x687b7d736ca1e927, 0xb129da7f31a4291a, 0x63be4ae1d3b8cc3a, 0xc4a67142507680fc, 0x1b19556dec0d7647
+, 0x3624338e8b74bd35, 0x478d5a0646faec8a, 0x92618cac33d11817, 0x0e5d0ef6f1836bb8, 0xa592f542af8c84f1, 0x42fff024602a1d8b, 0xf0b1322b61fbb94b, 0x0b201e9a14e86932, 0xdd4d5a27123e48a7, 0x15c1e85b1dda94fb, 0xf62d5cfb80f9f33d, 0x414d748b5a6a0702
+, 0x60766019061ee084, 0x25db96700b5cf674, 0x22ac3b5f3745a2fa, 0x40ade210ff268ca5, 0x2cf16d5d3ea062b2, 0x2a36797b668dff70, 0xa10922db3dcc193d, 0x788b9a52cd35ade4, 0x4d05f16cafebad6a, 0x7c77e91c05078adc, 0xc2fa91155a7c4aaf, 0x05d9acf09a3ffdfb
+, 0xea06f3a8626cb598, 0x5c8a18c7282645fd, 0x80cade4cce1925e3, 0x3c5d7c51297c364a, 0xf650f09d2cba2b80, 0x226ea5c4c5227b5f, 0x7ebbe1424c6196a1, 0x13df5091e7b9f237, 0xf8116b730cae82a5, 0x7f3aff4702717908, 0xc1061a901668b331, 0x58362911582248a8
+, 0x45d904795d86392f, 0x553fc11a07d608e7, 0x6a43269f5ca35afc, 0x4b3e92f092c5e0c2, 0x1c27a6fb5f9b2f1a, 0x4cd4477614a63133, 0x1a7d645bf783fa95, 0x2f223ffda1a7a3bd, 0xfbcbead1a6475ff5, 0x0c462d924acfc52a, 0x28c6414cd7b5493b, 0x7e46f503f0a7a689
+, 0x5668350457b3a5fb, 0x423887c1e88ac706, 0x5bd0307d32ff1128, 0x1ef593bbccf4f51b, 0x2c5a28c5d9abca8f, 0x0acd2758441eb8cb, 0x770eb577c2fa2293, 0x18d50e006e9e7e40, 0x20a8e41382346183, 0x15da2ab5f441ed63, 0x18a234ab9ca65e33, 0x504ba937b4fbd2ca
+, 0xbe51f7d5734aaf82, 0x761d83cdce765c2b, 0x434a3e1309ed8dbd, 0x78b0611f4046679e, 0x0d96b528b914b372, 0x1584831536683cde, 0xbacf98f1cb73d649, 0x5d94317064cef00d, 0x8fbc403e233bfa5b, 0x2c86fb9573d01adf, 0xbcce28a67acd18dd, 0x1ce78ef57b308fff
+, 0x5cb131a3791cd616, 0x22dd53ca6f67e639, 0x6ed7e61693d428e6, 0x711fe04b301fbeab, 0xd2d0a3277c312abb, 0x6d640ffc2b543bab, 0x7711fd2cef531716, 0x7e0eb1d864461d02, 0x7967cecaa62cc5ed, 0x16135126dcdc25a8, 0xa3e089c243e88b2f, 0x6dfac71e0a1d446d
+, 0xed0d81a19d6de7b7, 0x53b5269c03db54fe, 0x6f0e631776071737, 0x23c0f93265dafb90, 0xa78e04f6163d8ccd, 0x647aea51facda648, 0x7d18ca7ff72f0e3a, 0x2e72aef60f30ab51, 0x735099575220ae38, 0x1d8376a05469055a, 0xb32374f360087f23, 0x0365742dce3ce3f5
+, 0x118de1508d46854f, 0x47e81c8a61c3ae6e, 0xfe4bdf4bf0858efb, 0x061680394f45d7cc, 0xa75ac43c99a3f30a, 0x57fae08f3a6188f4, 0x8787fccb8c87969b, 0x7bcf558cc51c23fd, 0x7abe32e400bfa80c, 0x24c89abf4780d5fc, 0x6ab167ec85cc2beb, 0x4b395604e82448f8
+, 0x8fe2426a7a4e65ed, 0x1ffe089077f062fc, 0x06a60d3446cd5007, 0x2b93c73df8bd8a1f, 0x09c9a8e2165e078a, 0x2026c10ef1aa6cf0, 0xfa84319f54a1040a, 0x62a3b88e88f9a34b, 0x9299d4f030670d44, 0x5f9ec387330058f1, 0x24baa7f2bca4b962, 0x1df5430aff269aa7
+, 0xf8bb76965ee65639, 0x4cc0bcf0fb080c18, 0xc30d24a8db60c919, 0x0bb4fab672edf402, 0x224f56d1a9d33b80, 0x78d31802f07414e3, 0xef1f17a10bb340b5, 0x3bf00e4bbb5ea6f7, 0xd6f88a64c4e686ae, 0x13119dcd215f5477, 0x5b60ee9aa60a5646, 0x22643b1954c73a2d
+, 0x4b092c7cabd3f77a, 0x28c69403e5f9c4c5, 0x72510183ec057113, 0x1a8df7145db8f5df, 0x4a9563e68d68bb0e, 0x58a4c5c0fc62eab5, 0x1d6f53c46c0280f1, 0x12ab4d644083290f, 0x2987982113b9b52a, 0x09539edf964fd891, 0x73098feb09d04667, 0x5f9970a49d5c4b3f
+, 0xfdcfa66427feff27, 0x2ff76c97457c96ed, 0xa76b4f4d242eb038, 0x7cef6382fb3d837c, 0x22109d7ca4196fdc, 0x2e3f1486d5993110, 0xcb9c1907e6e8e63e, 0x499eda6ba889adf2, 0xa26203b07660a8e0, 0x6c0e268c0e5e21c1, 0xfb8735a91d78da7b, 0x4c197dc8c9d027ad
+, 0x6834390dbbb16f59, 0x384863394e9f8f2b, 0x331e9221361e855b, 0x2425226fad9d4621, 0x3f187016ca44bae8, 0x03e73876fdcbcfd9, 0xcea4def162decf80, 0x03020409bccefc83, 0xae3dc782f83f714a, 0x5f05bf6f20707308, 0x607def9c9c7560c0, 0x46c05e2df36597bc
+, 0x45e6117cab1c2729, 0x6617c7b8509c9dba, 0xa7497e5f09c33508, 0x3c95e5f3bd57e896, 0xd56246a60cc44773, 0x3e0830df512b9eec, 0x98c9e5f4fbee46a8, 0x76170340ae38ccde, 0x7b1c759b3e1802e4, 0x5030b4515f414686, 0x8d1e71172445431b, 0x7cfcf2e4a0eb64f9
+, 0x289bf7dca9d7d33a, 0x6afb0bfe0a0f15eb, 0x34644973e7f3a5dd, 0x7ac6bf474cf7d067, 0x99a459b91133c56c, 0x0d619c0f84d24b22, 0x00b2da6c8b4fcf3a, 0x6c36257b0dc5d2b2, 0x8a29a54ce35e7717, 0x24c15cac72bb5c20, 0xcc8c98c9214547a9, 0x08aa750cb48d0bfb
+, 0x1ebf33b9450dd6ca, 0x3402a87874231e99, 0x575b8c54615a6579, 0x788c858dd9b78416, 0x92c6b05155c29be6, 0x5bf08df25c182704, 0x9d8a849ad8783af1, 0x1e4f741506e8a757, 0x18a25868d5c3be82, 0x269e5345903c1bfc, 0x146fdf8b474a1bf6, 0x16e5a91c593d03ae
+, 0x19d8acc908b3304d, 0x208b8b8a4a6649c6, 0x0cebbbf94f7f06ac, 0x2221fb05bcd92e8f, 0x2a6b1bdba06a3ca2, 0x41546fe72e2c68fc, 0xd83157e8448bd529, 0x23c6c233e59f98dd, 0x7fa6f40905715254, 0x6560a294ff32269c, 0xe182e258ec943163, 0x646cd29ce15910a2
+, 0xae0238d836210486, 0x2c86ff9860498ba3, 0xbf85b48321c0513c, 0x2094e2b73bb39495, 0x21743577570c734c, 0x731eebcd72d06ef9, 0x7bfe32179e7ca7d4, 0x3db0f56d6eb628ac, 0x4181f7951ae39e4e, 0x404145710c850571, 0xb4b83be8203d7bb3, 0x2a6123ede4ba1423
+, 0x33834184055b2c6e, 0x57df957797134426, 0xafe63679f888de8a, 0x15b12a6aba5a9427, 0x6379806a2f21211d, 0x69132bb2e8777348, 0xd9bdc9c704c7551a, 0x19a91fb9fae8f547, 0xb4f8cf8c5bee8dd1, 0x357f029f18ba03be, 0x8d3c33f63f8b64aa, 0x0692c77943f6c9d3
+, 0x8dadda7f1579afc5, 0x50264bb07be8e0d5, 0x2e14892e2390f0c5, 0x711b9d7bc4b2592c, 0x28f378403187d2a7, 0x62a4995b67cb82f8, 0x781f7da67ce7c71e, 0x65f322bbe3bb25b3, 0x37436e77d64e4b20, 0x629004e60afeda15, 0x48e2a5ccf26da000, 0x6babc4418a80ce27
+, 0x4348a3282727fb37, 0x188414a28d578e02, 0xc0c165364272648d, 0x2fb92373cc16fa17, 0xb95dcb7ac21d53b4, 0x32f9847111c56dc6, 0x6a4b51786cf41081, 0x4c04ef7cf528ee9d, 0xc827d8e85b0b110c, 0x78606f48d63027d4, 0xfa684deeaa879c1b, 0x0b8cee0d2e78196a
+, 0x12ec06f995621987, 0x0f55690d3af73223, 0xa3c466a7fdffbe46, 0x67d78e1e17e14818, 0x3f1c2986687d0c47, 0x1948bdf4ea6898a9, 0xe5e2cfb6721c23b3, 0x424d21af48ca4230, 0xf879c72d20ebff09, 0x0a3fcf3054012907, 0x8063f12226dc8dd7, 0x1079da9719f1008a
+, 0x69ffc6a651b10160, 0x351eb6257e64f9a7, 0x11f853d4d1b85e79, 0x233e502a83e8ec19, 0xe9826c090bea18ec, 0x0d0eedc2eb29822d, 0x19f7a1cb729f16c4, 0x39f3809b48ba92f3, 0x7ed2c503cbe740f9, 0x15d65677bf55d691, 0x0e58aba35df13323, 0x28b18b151ab855b9
+, 0xffc978e06b96de77, 0x6c9e10a38a4fe27b, 0x4d71812293f212cb, 0x72abfa6f357e769d, 0x1e132ccfcba49a54, 0x0c33cbdbf2095703, 0xdfc2e9c81e8527d5, 0x268177e51294c723, 0x8bc9edd47cac4865, 0x524dc65ff24a36c8, 0x9f656b48eb46251d, 0x7870703a7cd1f5fb
+, 0x29144e9c02d565e3, 0x000ec5999f4746c7, 0x71cd2f94e188229c, 0x76078dde85953ad2, 0xe4d38ee26c695438, 0x740243ab12c17b97, 0x324191d79fe8d2b9, 0x20734f3f310c6434, 0x0dbcc3e1d56592d4, 0x0ae3c5f26465e3e0, 0x7e735a2d40df1789, 0x711d26e1359bffea
+, 0x570c0bd657a9255d, 0x72f982b66d4f7148, 0x2ac32bddfb89e717, 0x04e330b9bb601b81, 0xe4a84667a714b528, 0x46887eada887e154, 0x84e3b5e4283fbe27, 0x5e80b822349a2645, 0x161de41fc3a8951c, 0x2edc152679524e94, 0xb30c0563d07f62ae, 0x155ce82d4f36bf75
+, 0xe718e096ced3aa98, 0x1a42a2585691c4da, 0x99e5b39e5a3bc3aa, 0x0cf8625cc69b6872, 0xf1fc0c9f8660a6d7, 0x31fc7baa273085e0, 0x08c91cff29950ef4, 0x5a661cc2056f2eda, 0xb96b8e6879dae812, 0x79a03747b8f762e7, 0xa2051a58c97282cd, 0x704216ad37577627
+, 0x3b1a2c6846bcb1bd, 0x263cb043dd33be31, 0x1498e525ff351021, 0x0b81340d4a986c47, 0x41e543d5cd18314f, 0x6205978ea9351657, 0x7a223956adbc7f73, 0x36cb7f9ee10c15a7, 0xcd7d1ae976dec452, 0x467bd3c3a9038ee2, 0x961b0498aa47cca7, 0x497fecc350582fd9
+, 0x01ac48456d30c266, 0x59532b048645d898, 0xdc2579c0c8b8e282, 0x52495bf174e4bf71, 0xea13f5eb37b33a58, 0x3da9493b28c96043, 0xcb83b725ff2b37bb, 0x66b95c305d00ca5c, 0x777c24b53f939189, 0x5647164f2c0bf200, 0xc5cc8dfc9d5b18b7, 0x4a12badf4fd43237
+, 0x834f83c05d7ce2b7, 0x7d1e2876b80e02bb, 0x0fb93fcf6e2b8792, 0x49b433e2b7b1453b, 0x43ad33f9ddce19bb, 0x08367aa8eaf671de, 0x5eefa84ad8023679, 0x73e847f720a98a8d, 0x8289bc3a6588f20f, 0x1b78382bb90b0f09, 0x4988bb9191711933, 0x264adbb546bb989b
+, 0x5da5e6b71b577568, 0x16cb69d1a980747e, 0x2e1da81bc1aabbe1, 0x6d2ef08fbc0d4319, 0x1e268c6a0fb96197, 0x2f2942423dbbd537, 0x1783e0040e81d9ab, 0x7ab8adb9c00a7a7c, 0x524d40d8b4dcae3f, 0x039ea6b1223f76eb, 0x5500046759be031e, 0x1dee2d60bddaf836
+, 0xc79f7b2e0b946f54, 0x3ad88ec1cf37ffe7, 0x186f2a1762e96d61, 0x3e0eb8b5cffd09de, 0x845f0c0d41346f10, 0x0b5850b6cdaa8ddd, 0x5b280030e0e6ffbc, 0x46cc91fe9d7225c3, 0x1491692badc8a478, 0x77cf30b50e388146, 0x054eaaa1a4647217, 0x2af0d56ae61626d9
+, 0x72d6799d9f6ad06e, 0x1cc691535d45c081, 0x6c191f0c4a3f5a1d, 0x1fab4cb8a0565094, 0xdf2d99b9133ad666, 0x0d7074103d3ab01d, 0x8535b55d521f509b, 0x2b6c4b12e1563fa6, 0xd4e6bcad2f702279, 0x12d4b0df779ee3ec, 0x6f6fe6f17caec017, 0x69f4c351ad1fa8a3
+, 0xe9c1c6e95764521a, 0x1f11182a651268c6, 0xcd4c0221eabdcdfc, 0x712ea0cf39afabbd, 0xed46f0ea667634aa, 0x302edfbf4ec9e1f7, 0x2680b7e79306a672, 0x7d868470d4d4828d, 0x12f6d73f3db3059c, 0x3f90d344b9e5c44f, 0x9eeffa0ffd6ea9c0, 0x2959c53fc8a51a2d
+, 0xfbd0873e07648516, 0x59c64e291a67a46a, 0x9c949d7f9f364c4e, 0x2fa8985aa0d3f776, 0x92439d141bbacc94, 0x49aa826054eb7de2, 0xa9ed77196dc9ee6e, 0x7f1a1913b138af90, 0x35eed4414c23cfd6, 0x6de729b010ebf790, 0x9b64e196b29b9a5a, 0x51fefc995cb96b17
+, 0x84cdc0ea96c4c577, 0x1960127ada21f992, 0x0a50261eb9176c1d, 0x3726539e3ffb2270, 0x6af1c81b2d9c056a, 0x4491f338e55c2438, 0x5f9a04dc64574daf, 0x23ab6732eb65bdbf, 0xf7f81f3ef6dae3be, 0x0bb2ea16a3a62ebb, 0x33ef1419061f9513, 0x5071972cfcf16708
+, 0xc1bda25305268fd8, 0x73f026896ac7a00f, 0x224ce74605e99c14, 0x7a9a913c8f7d069d, 0xb6072c5b283be5ed, 0x4b1f701cbde63b74, 0x624cce66ad5edba3, 0x2e8dbd3054df55ed, 0xd704c691d7dc8564, 0x4bae8c7225f26b1b, 0x275b726e1e84cda2, 0x132c672895837ceb
+, 0x0dcb4c3a1d0daa96, 0x46a3144c4ce18816, 0xe9f865e117d47148, 0x65704e59967755f3, 0x767585061b3b544b, 0x476c2c893a526a07, 0x044665e87f2b4cf1, 0x26ab269220f70105, 0xe283b00f3dafcbd3, 0x20fe2b64f1a6120a, 0x585564526d3f2dca, 0x3f8951702c977708
+, 0x89000c40d991e30c, 0x3c3d0edd8ba4500f, 0xcec0a16be10c1196, 0x14a8ce2b0529dd75, 0x9de3fb039fbc57f1, 0x53283aea714bd264, 0xa4712bcf7b96b938, 0x2df264da44c728fe, 0x64e7a011c7b78e3e, 0x3fd54105ca7e5c66, 0xb2c225f473022da7, 0x75bdc1b1ef8551bd
+, 0x3e8b963a4002eace, 0x2ae965452bf817a3, 0xd6a314ab59e66b92, 0x4b5885575b243ed3, 0xfbafdc175e1430ec, 0x51739bd0209d1f43, 0x40ea60d29cccfe76, 0x46bac1a591639e9d, 0x07f4453052a60ad1, 0x711605f939c922aa, 0xf7afbf0e0793d2da, 0x057bb0668b4d0868
+, 0x9c6bad38435ad56f, 0x273eb010b8dec0f0, 0x029f9196b13a22d6, 0x2bc9290de0bf043d, 0x73749633eb5458d7, 0x251f3e42536e419a, 0x3a9c28f556af1a2a, 0x0ed08eea307ec54f, 0x17acdb68052a1d88, 0x6fcb6d84b76b1463, 0x1189271f1d702b4a, 0x0656b3222fe8218d
+, 0xb33d27937a9b28f4, 0x6784983708e3e2ce, 0x43ec179dab618d32, 0x1d29b0ddaee50eef, 0xc7c5dc4edcdd7a19, 0x296f8c57fe2189ff, 0x3eb59a9ada4d8686, 0x11d994382f43201b, 0x2a321fffcec6bc44, 0x3de9e4a65edebc4f, 0x93b897193da4bbfd, 0x6550cff6df3d344a
+, 0x7410ba6e34870b5b, 0x7ad88117a18c0917, 0x592da83e293814dc, 0x01ab09543661eae5, 0xe6d2fe666c017ba6, 0x6d3f5348cc473a47, 0xcd020d412aacf85d, 0x093de62f391265c1, 0xf7236c08fcd3e71d, 0x6ffbab1067f94675, 0xc8434d24644ba55c, 0x17a4642bb74bff41
+, 0xb22052202e3cc4a0, 0x12e00206bc621c27, 0xca76e215cf2a4448, 0x26164e049aa336a1, 0xc519e56ef5702cf8, 0x2ca67bd1d118dda9, 0x9ac0a8febb78988b, 0x25e29a783ac81e37, 0x2880af7f88807c72, 0x5f7f0e2976791ff1, 0xc2e416f101ec1d2f, 0x083832c8a06fab18
+, 0xc80a2c71405d2f06, 0x7328e5acbb7a275e, 0xdafe3d896680cbde, 0x5824f97c45c79376, 0xe4884a4dfb682642, 0x20a30d8c344280e0, 0x3969ab673a1a5a2d, 0x05fc78e728808bd5, 0x26f687244707f59b, 0x12d1d361b8914d77, 0x31d52b3b36188284, 0x1f52e37307e94f01
+, 0x1e24d7eb6539ca8a, 0x1936434e45d4a5de, 0xb2e5c0d6b7b9e9a1, 0x076236d2789dec22, 0x57d5090fd6f1537f, 0x1418f8b2c3a15bcf, 0x5f801e80c4d9a646, 0x1edd985302625edf, 0x33fdeb4668038a57, 0x4b791763d8dfb26d, 0xb928f96fc74f0536, 0x75575ed487c12bea
+, 0x88e5d11a39cf587f, 0x30ddd24edd808b78, 0x0f057238ec63c549, 0x133886762c910159, 0x9d9a6e74b67ffc14, 0x660d14cef6d53971, 0x50bdc76d9a4b9d1e, 0x02b7e1c1c5c51c13, 0x53c43ab45765f21e, 0x4917678ee3b4750a, 0xbff8d29b1156c01e, 0x5e08ac6c9df1187e
+, 0x157d305bfd31d750, 0x29483f1ebf96df07, 0x0a03b7338269b337, 0x2e91e6444ca873f1, 0x6b793bf9c2732fb6, 0x46d13c78355e06c5, 0x46e2dde61f8394db, 0x79252fdbb7e8d0c7, 0x30c7abd14cd4ab38, 0x626affded145e4e5, 0x5cbb41bb888bf702, 0x4a9c96eadd44e376
+, 0xdafb604fae9c6001, 0x4480246a626e135d, 0x9ba7f8db0f246dd1, 0x44914cb4af08d2a5, 0xdd4b7315fe64ca98, 0x14ada571aa1a7da7, 0x0fa3102923d91393, 0x5c420d97460d154b, 0xb2e8bfb4a5231d02, 0x311256c44a80465d, 0x34861e6cfcdd0d02, 0x11c78a85082f51bf
+, 0x85bdf312e1f30be8, 0x15275c38ae0e7702, 0x3b41e3279885e28d, 0x2bdedb35923804b5, 0x93a0807581034b79, 0x14370a9c7878264b, 0xeaa658c0e6a69e6c, 0x0d84bb985ed0cb64, 0x5f403b2c88dc3370, 0x0e6b863fbdfce779, 0xec770a06b86cde14, 0x21e5c9e71134ff2e
+, 0x27e81f6ea3682d98, 0x5a002903a1862a97, 0x286be7c865d74117, 0x41b389aa61f78ce9, 0x064e63e826a1332b, 0x7ef6a4bee75bfe05, 0xe974f6ab685b06be, 0x0677c8f70fb0bf55, 0xaf478e08a0c15eb2, 0x5813a6ec1179e4ca, 0x8eff1738477c0754, 0x0d3dd65d9b6832de
+, 0x27c2fed3be71c7a7, 0x58560c71d66bd4c7, 0x155e04aa55a4ff98, 0x492fc5a1d464b908, 0x9dc705ad72771029, 0x03b3a0255aaf65a0, 0xf92f41af1d8a6650, 0x7cdbed68c047aacb, 0xa91cdb8ab090f098, 0x3daa806fa3a0792d, 0x8c870451b4126885, 0x098e7929670d7677
+, 0x42e022bf80ffcf3c, 0x422bfa80edda749a, 0xf13d7cccf6c897c2, 0x29a268fd0b5bfdd0, 0xdc7cf22458eaa9fc, 0x3cf798a87d8ff4a6, 0xe35db76f68d22ef4, 0x05356346f1767d46, 0x0b4250fcdbe32057, 0x170518650d615234, 0x4a17da6b15107d9d, 0x56f636066545939e
+, 0x2dbc6825938346d2, 0x0e839ebb38ec1d63, 0xe81c8ba44b9f6046, 0x53ed8a3f764df6d2, 0xd8c8980f4ad8fda0, 0x4686146d9475d2a8, 0x32737e743c6a0fa3, 0x7746aaeb0fdcf73c, 0x7310dfa322032d3b, 0x2bfa1a5ba619d223, 0xc29bbbcd5d66880e, 0x40717ed1a2da0de8
+, 0x62b7fc372fd9a3c0, 0x1b6c376f85be8d1e, 0x7e5a455c3a469ee1, 0x7c1ca782040883be, 0xf0e8a475a98714b2, 0x1995c6ebeba4b8bc, 0x3d3ae9548b8e6da7, 0x04fcd8a578c8e29d, 0x81acea26d015f1ba, 0x099e09e232627f48, 0x826643b37aa43815, 0x45ffda0ff71e454e
+, 0x6c2f2edc1c4f9307, 0x6c48b14af5bf218c, 0x024f150239474126, 0x5dbfbde449a19aa2, 0xb871a71c120733ae, 0x67dba8fe2f95b9b8, 0xf57faa3efabeca6d, 0x7522bf8a85319982, 0x75068d06055c93d1, 0x78de23247e351e29, 0x67572dac17d2e584, 0x549bda5512694f86
+, 0xa64697e8ed4e48e7, 0x63b781824e48c7ed, 0x33b9aa307e96d67b, 0x5b9046d028662f87, 0xd26e49ed6c3bed0b, 0x1388e76bb6f982c1, 0xe397b0d170f85c7a, 0x733c2e6668ed597b, 0xa140cca241bc7932, 0x633761713d7a78fe, 0xd62c6155c8fc2552, 0x1c1b6979441c1210
+, 0x81ba398ae6c31804, 0x71e62bdb430efaff, 0x978c5b76285f059e, 0x42e6a7acf9be0e67, 0xc26a96031bd15429, 0x261441cff5f84e89, 0x791cda94c8fabdff, 0x409228e2a6015cf3, 0xea3263ee244e6967, 0x567e0aa3748bef8d, 0x640b0bcf1d7df5af, 0x78718caa1c291f25
+, 0x51e45b6b4e3238c3, 0x5e7bc66d688ce0f7, 0x8aff7acd47dd47d2, 0x1c03223561a16585, 0x09dee0d788e23124, 0x155ef28437d996e5, 0x607798cc5ebe0a17, 0x2997274ad4a062e5, 0x6c66ea0e2f00d782, 0x1fe31656bdd97f11, 0xa9bb1114710f4647, 0x6a50b82d1c5c07a0
+, 0xb6d3478f662f4d3a, 0x5b0dd7f7950685f0, 0x01219dff11f35140, 0x401122abf3731291, 0x9775d556b21bd1a2, 0x141ab0164060c9ba, 0x96b6a247204c589d, 0x54f12272accd65a6, 0xb0376cf458a34289, 0x32d8c633110b6364, 0x0988783e13f142a9, 0x4aeca2c0ff44ea60
+, 0x821841eea818a2b3, 0x07d4605f45dc1598, 0x4e6e43ee821239b4, 0x7b522b03ba1f397f, 0x013c61895664edbc, 0x3b2d352814b2fbb1, 0x6af37a710aba6d0f, 0x6094334b6526516c, 0x9c5c47192e4a927f, 0x74226c8a4bf27e4b, 0x8ec23e3a748f4142, 0x2f83139f9abd2e47
+, 0xc14bb6c31f43bea0, 0x2611a8f7428b816b, 0xb19e01887535a364, 0x7c02c31afd74b645, 0x200df0f75216172e, 0x14944d0983badc71, 0xb47e9b181aa77cef, 0x69f620b1a26af290, 0x6f5885f1f7a98587, 0x3c67668ac1d2c7ce, 0x13aaa0cf9622c52a, 0x2110bd99273d2460
+, 0x786c8c5a0931d02b, 0x4e1123b4d5d88e8c, 0xbc4c9f91ea4a4e46, 0x5e751c3d7d72006c, 0x396c1c124e979a1c, 0x745850272a02aaa4, 0x305d2c88c08b660b, 0x41d519ee951775e0, 0xa62305643c386ab0, 0x316bfde2dc726850, 0xe05f1c046976d72b, 0x520cb9fceed80c46
+, 0xbbc48a7d51e65dc1, 0x07c24a3a5de517af, 0x9ebb4c97192f6f2c, 0x2a84fb2913c35b33, 0x224eeb8e1807e8d8, 0x046c2680c17374c6, 0x61d2def0c8bf392a, 0x7b8c40fce81133d9, 0x6c4a262c36d66d18, 0x78a4141307f32336, 0xf549e5c0a83e067c, 0x59eafc00fd106cf9
+, 0x91ddd4ec350cfd3b, 0x5d66cca948f9b5c0, 0x56f1176bcf27f626, 0x0d729982b8d58328, 0xade1b4d18593bb53, 0x78bb94f9750f93e1, 0x7bb198830f0affe4, 0x4400b006856b6138, 0x98c3506b1dba808d, 0x54db2b9ba5d86cbb, 0x20700af24547be20, 0x1625348a78def40b
+, 0xf2ddfaf87e40580b, 0x48c20d3465855b8f, 0x83aaf0fb27a2a5ad, 0x2488756a36fae8e7, 0x66245874be355de9, 0x40f7fbc7c585606a, 0xaa495ba3100521af, 0x367c02c11d240b35, 0x476bc41430ec6db3, 0x4a7f4a0209926cd5, 0x55d4b9fd6837bab3, 0x3f6cf1d407405ada
+, 0x0fef75a568a5ea48, 0x7542312cabca4d07, 0x6c505087a77478f3, 0x0a1d84ad468d0710, 0x00f991ebb0a4e0a5, 0x2ae708c72fee7d1a, 0x7a5454681e904f06, 0x5f7c511f3cb2f7a3, 0x76021d49ecc9d17d, 0x2d61b56756077230, 0xe234a5d6e8ba2552, 0x003b928627702de4
+, 0xbc491b50ffe31e22, 0x6087f29a7a4eff48, 0x608c71667af8c08d, 0x6597a6f45da72509, 0x65adbad5276774bf, 0x57ee8683cb52979e, 0x55bacd0ad911e18c, 0x278be9f2b734634a, 0xb511015ee45eb013, 0x30b57d48e6952ad1, 0xb0d4371c57c5ba2b, 0x71f26c235c3d3a2c
+, 0xb17964d5a7196a12, 0x69c4c9643a836f5d, 0x87fe2035fd48619b, 0x4bcbd23896599730, 0x272ea17c921609a0, 0x40d9dc9371c32d89, 0x2a4f2026fdb63b5d, 0x14efcc154a873033, 0xfca4618bcc7d86ee, 0x185da7a28e960821, 0x7eed94d34a1e0ab7, 0x33802b83e7a754f1
+, 0x313b87fa1ca4de1f, 0x48195efd2881eb7e, 0x3c320aa2e209376e, 0x0db83657cd83ba25, 0xe17197e96131779d, 0x37142f3b1a87b61e, 0x3623104518e4672d, 0x6cba6878174bbdf4, 0xb997ab9e1a09dd43, 0x224805ec5e565f11, 0xad101a758bad3a3d, 0x36d27a09d763c46d
+, 0x11d4955e1b888036, 0x1a2394b238376120, 0xa69b255153f651d2, 0x0a5feff190fe6e7b, 0xbe24b73b88ad6e16, 0x4c4e22b7a3e44484, 0xe36d95cbcbe15df5, 0x3ade80dca29be297, 0xa1fc9e99a73885fc, 0x388bf22bf8da76ac, 0x26a599653480181f, 0x4f5643ed248274ba
+, 0x6ab2816e5c2e586f, 0x5ac0b9a088223047, 0xf54b64b5514963b0, 0x4d0e33cb1861a942, 0x166dab09f7aaa63b, 0x2ebcf1b2ce4c7745, 0xa88c4144eb1b3079, 0x410cee225b934e44, 0xffe4427ab1dc2472, 0x38b7d16d1a65f245, 0x9f8bbb09796fad08, 0x3986d75e019b87d7
+, 0x8cea32d758b0a633, 0x1b425674f418063c, 0xf92541321ecc3f77, 0x51a7828b54b9808c, 0x5c41af5d77d0b119, 0x2d449230f79abb59, 0xc3b3f99365fbd556, 0x405d9025f13942b6, 0xbf3c0d1a2ee0d82c, 0x09715e4607935900, 0x58265f7492c2be12, 0x79a0314a56e580af
+, 0x72f6eae6a34c340a, 0x2cf660b500386d63, 0x70b39ddc2db1e22c, 0x4ab207f689c0ccd8, 0x2af5a1ecda228b57, 0x11f20decc3973aaa, 0x49f8499359f5847b, 0x32ea703098d87199, 0xb88144b5e47c8de2, 0x40c1f7b1a510963b, 0x85bb6d9b24c33c7d, 0x18ec42573f0c93cb
+, 0xa6b6cb3a6a95da2c, 0x0cab90e319703819, 0x6e30207826d35fa8, 0x7fd3fe933ea3f876, 0xb51d2b85b2b34947, 0x6ae7aa5ab5dca87b, 0xf81e0b3d139a8559, 0x52349d44cd3d4f7d, 0xdaf1ddd3bd05a206, 0x486bb3477bce59c9, 0xddb3577864ccb845, 0x2f5c1be3286430e5
+, 0x5350ac212f4bdb3e, 0x6ed33011ff9d992b, 0x42c2d6ccb2b31027, 0x116f4b160fe28295, 0x626d3b6c6bfd35cd, 0x14409aa53a942e03, 0xb299c57e29372177, 0x0b76256094bffe03, 0xa6de2d7d06f77211, 0x18cc9b48df446ba8, 0x0c9070afed0237d1, 0x5b714ff443843db2
+, 0xbda1871c0942073b, 0x22f8bfe2e0a4b8ba, 0x26338a3d6cdd42c2, 0x745b00523f4588db, 0xebcf990ce6c37494, 0x021f02c01c941ed5, 0x59cc80d46228d974, 0x597370e3492850df, 0xea4cd25b2f15fc1e, 0x1b76338b5f018a31, 0x9eb62bccd7f7dfbd, 0x2cc2ee0136e66b9e
+, 0x1d7bd75fc8f023bf, 0x5d36be06146f749c, 0x809b2585427f13e7, 0x191b5237a1821467, 0xe1083006295126ed, 0x1741fcde92b2018c, 0x2d4cf34c7b197efa, 0x7bcef7b9c83ddb94, 0xfb90a8a872925fdc, 0x592a3764717621bf, 0xeba3bebbc556ec56, 0x21bafe90af197187
+, 0x8b5b7a627da6c828, 0x2e96122a64374fde, 0xb6a948683ad4b654, 0x20cda7c58cab6cd9, 0x9136d286a5c9cd1f, 0x49f1076ea6d3cf6d, 0x538121127b93b01d, 0x7f1da4c2e4db7c42, 0x1e9130b1b2ebbe9e, 0x2eb3060185f6dfb2, 0xa8cd504fa4c4e499, 0x3c8475a9c7f38452
+, 0x61a982ade4790a8a, 0x68d5c30e0445c9a3, 0xadd9179d19e64f24, 0x043df80f150ed7f2, 0x629e1c27987b9427, 0x785f5b0313b022c4, 0xf6ab9be6ad0505e4, 0x439714b7ed0497e9, 0xd3224baac3e8e2fa, 0x30ee5fcd51726fb9, 0xe793032b5d9363e2, 0x09873efeefe3bf8e
+, 0x415b9dfafc7673cd, 0x23d11951a4bb38bb, 0x5c4c4e0efaa4ebba, 0x557ea46a59949c79, 0x162f2de61c4792f4, 0x4fa9a7440b8a5197, 0x38377dde43522cff, 0x03b2dbc0e5c26fdf, 0x895a818fce5c53e6, 0x3d6c87e825393fbf, 0x34e28eca013bf92e, 0x4756168307ebcbdd
+, 0xd394b7f0944ff088, 0x0edde504c8aea777, 0x8bc8d8e8d16ee938, 0x5aec918d9a19886a, 0x71955914dbe9095b, 0x000caeae1a8375f5, 0x5d2c8b7eb4879fbb, 0x5e7a1c93bcefcdbf, 0x64adadf295967c58, 0x14140601326b2c54, 0xb8b6b0b4632e6634, 0x596c7a11b23cddc6
+, 0x9a7c69d6669ea98e, 0x0be2b537d052d77e, 0x054cdc99ab8118bf, 0x0ba8eacffa3d7479, 0xf7d45e42a638c9fd, 0x1d1c4dba9c0115d5, 0x07437814b8c78d52, 0x41cc9277c86236aa, 0x46b7da5f50bfcde8, 0x4c39058a8e669c9f, 0xf7cc13aa2d69ac1f, 0x684af5e00940268f
+, 0xe65ae2be3395572e, 0x5405803e07936ca3, 0xa2bd27487a044b6b, 0x05232d5a6a5ba8f7, 0x200aa55a809acad5, 0x2ac7b0df1fe8e5f5, 0x369d56f7303a67c9, 0x186f28ede5f70435, 0x02c0abfe51007252, 0x58fddb23b0fd54ab, 0xd5fc0553cadee0f7, 0x7b054c3c6abc7520
+, 0x952795523045afc2, 0x168888337a1850b4, 0x5804e56be504999b, 0x3acecb2b4e721ec4, 0x95873b56a1cc1779, 0x3d73e39842bd2098, 0x3bd23286856d4dc2, 0x57301a68c4e0870d, 0x330a74e26e7ec108, 0x798ce8783b2a137b, 0xb47ae22ebf2771da, 0x2850a6946ed949cc
+, 0xc2f1f32d78b77ad8, 0x712928355175eaea, 0x093791eef7c3da93, 0x7e596128cec5c425, 0x72471ce0414dd824, 0x6f97d69a787362fa, 0xaf7ce56851d5418f, 0x71958623bc3a1179, 0x69e8f5acb61bccc4, 0x6a26b02fa4185022, 0x741cec2f0048cf7e, 0x3545211eaeba70cb
+, 0x23d060e6e415eddb, 0x69584217264be73f, 0xc744c3593e0c1fee, 0x64e7b42379a0f602, 0x6fca516999cf926a, 0x0b020fc9d51d3ebd, 0xce027625467ddab9, 0x3e2c377d2a84c01b, 0x70896e1d4e581a73, 0x33d47d1f38e3fb27, 0xe60e1712eb4a1a6d, 0x78c6203acf7b1056
+, 0x61936cc4597c5b40, 0x30682066187afe30, 0xbfba8ad04cddcd5d, 0x272ce1f74ac779fc, 0x35f7bbf047f8a7c1, 0x6d15bb688d9070e8, 0x99d21864de24b59f, 0x37c4a1dc53b9b67c, 0x07fc5b0339650e91, 0x102381f66fdbb70d, 0xace8ffada35b07ae, 0x51f8081e587172de
+, 0xa4826fa0c38e77db, 0x7247ea84d3bdeaed, 0xc3b9dfbf92d3ff6e, 0x3888d35c2410871b, 0x1269c922d20e492e, 0x58307e3a3bee453f, 0x89bc25204bc868d1, 0x0c8b57acc68a997e, 0x84982f08b6e48fcf, 0x36e0a0a66b867d5e, 0x7a22e9395ccce035, 0x573acafc38b43e33
+, 0xc477df8e8bc3c0d1, 0x6f197c4f32fd0b41, 0x5cf71033a094c732, 0x1279653b51269763, 0x70da7f2d18b34c58, 0x2e46ad423e4d060c, 0x055ac68bfd8574b2, 0x6425fcd5b555b5aa, 0x89fe9f6757b099c4, 0x5d91944f159c0314, 0x37f36ba7a9f2fede, 0x38515e47dec6f803
+, 0x47910c9b55422eb7, 0x5288896fe50d7548, 0xc69a9cc689d609bc, 0x2e44044b33e03325, 0xf85b2d19e23d64af, 0x5b214e4658b4590c, 0xaf29affd0622a5c9, 0x6262b5fd8122bebe, 0x6a00bbed323007b7, 0x11771e8d1a341d37, 0x3064b054c933b0da, 0x34d95c31f8305ea8
+, 0x4119604c6ced456a, 0x71d523656f37033e, 0x2ceac60467cd458b, 0x4dce96e745adf08d, 0xa18837a4dbb3dfde, 0x13342ea4a8bd57c6, 0x74ad889ee50ebe9d, 0x371b5ffe883eea43, 0x2a59c8302bcb6d9d, 0x067a60721cee3d67, 0xbbc0fdc619f3a225, 0x0a8d8cbdf6c8804c
+, 0x5057e65512053bda, 0x13648ad7c2662de3, 0xeb0258ec88c0dbc7, 0x0fd1797223fa89d5, 0x723893144850280e, 0x37296b79fabc10e3, 0x0a5a672e7b0ba5d3, 0x5a0d3833ee9b3cc0, 0xb3c06ef6508f4a30, 0x1a1c08f619b9402e, 0xe38c8bc13eeb8adb, 0x6e86419a3d597862
+, 0xbfeea0e4c74acddd, 0x36a3f750a0789147, 0x9af58647c4fddeb8, 0x2c47cdab0d44a0dd, 0x7d5b15ba297b4a98, 0x74b5c8c59f401177, 0xb881483b9117bd7e, 0x76395b9ef03455da, 0xd7e7cacd23efe135, 0x00a4de5f82009bca, 0x89f095ceb26c1193, 0x38c56ba679318544
+, 0x4ea5ae6a149d0c38, 0x35492c00adde4cbe, 0x18900c2317e9f11f, 0x031f0fbcf4db1981, 0x6d4f920d3ae3319c, 0x4c8b4298e14e559b, 0xc8a3cd901b890626, 0x6814a5c360f85612, 0xd8744d06a7d8256d, 0x3c1bf3bcbb40d5b1, 0x22a0d2ef3e44b27a, 0x1597fd13b4551772
+, 0x92c28138e2e0a5f7, 0x0f8756c03c4e490b, 0x1d03cbafcdd901be, 0x7cf58d251fd8ca6a, 0xb6ba8d2625ac6edc, 0x27f5c7d1d0540968, 0xcd7390bd1d214657, 0x6fe64670a421c409, 0x9b5fa057064fe3cf, 0x09b523b0a92d2c85, 0x881e761712ff8b08, 0x628b1e3bd07281a3
+, 0xedef69e0d188019e, 0x4905fdc9bc0795b7, 0xb1214d4d3a253289, 0x313f7aadaf892f35, 0x8c6ed9e88daa7f06, 0x60b2a27ff685a60c, 0x2fe6106257e8cdea, 0x6730b567d70c8ccb, 0x8293de077de5447e, 0x06b6572e0680005b, 0x516faec9968d6bea, 0x32df9823657c7a8e
+, 0xbddbff963877b051, 0x5ccd202ba290ac8c, 0x920ebf4a909ec8a9, 0x1bd6429d13d53859, 0xcf94f84c13a0fd5d, 0x09062b410c254f12, 0xce8827af3270181e, 0x7353e68473c0c283, 0x1b3c27c2f45c6fd9, 0x0dcd04ba0682c04b, 0xbdda7c3b128bdd31, 0x0c2550dc83af4e20
+, 0x6d71fccac43d3833, 0x67998fd91cd42322, 0x1bf68f8c37c9bfac, 0x5120ba77b1accfc0, 0x09f4a2730780f686, 0x08ce3c7b4d8e629a, 0xd1e0fd7cf25ef60f, 0x7d91a43a07854b14, 0x4c44162599003f61, 0x3e6eefe06388db4a, 0x6c2a9ed96cae6037, 0x344854f45124f2a4
+, 0xf6b4cc3c00277631, 0x27fdab891a44f2ec, 0xa00f70eb731d739e, 0x014bf6b33d938849, 0x78202fd47232183e, 0x755192a68f42561c, 0x1c79e84bd8cc2ac4, 0x2a91f0abbcf2f445, 0x8701a3a6ff64b440, 0x3e1e910eefeb3311, 0x33eeea64ed82e43f, 0x77d1e98fb7dab5b7
+, 0x48f0f08698a3f1e8, 0x11162d897332e44a, 0xf7c549fc50c37b30, 0x6572ca3232198dfc, 0xb34b0a219b59ece0, 0x1efebcadb3e50554, 0x03bfbbb84eb0caec, 0x30bbe6c5183dc72e, 0x4c8e0ef62c358643, 0x6ad461ef11c3c91c, 0x9ca4c6021622c562, 0x4a080f0140cf87ad
+, 0x53c224f1dadd21b8, 0x24f6d31c11f17993, 0xb66154f670a7cf4e, 0x1980fcafef69d333, 0xeb15cb4569012bcc, 0x0ad0ae55fd550241, 0xf985a1e3b5995691, 0x29f0bba5a3b4af37, 0x52d011f65704afbb, 0x01f3d88c39e064b6, 0x9eadb4b2bef4d7ec, 0x677b67ebeced2e1e
+, 0xc12f0adf0b7acb99, 0x14b5738fa2d15d81, 0x78482b69599a1abc, 0x723735ba0c21a9c5, 0x11181e8dc93e36c9, 0x77aeafd0e2a879fc, 0xf44cd343d4b5e897, 0x1f236c3f041a8886, 0x909900ccc601debe, 0x30ca52b39c9acd95, 0x7576b4b37586518e, 0x2ae884627be92a59
+, 0xd0da1b1ab3292d5f, 0x5f390bff76471e91, 0x65e14dd44ef0f166, 0x50fc9691a284ad53, 0x92790279c5384844, 0x538113fe9e9e0537, 0x902cf3eac1975d43, 0x0dde38be3d05c22d, 0xdb84d70a9e34aa5a, 0x24916ebe38f5a952, 0xa7d8eb6bafeb6ec2, 0x25189cce09963c26
+, 0x38249b81f4bb4169, 0x207a85f812313209, 0xb69912ecbcd2ed13, 0x336df8db27336423, 0x904977a5442dd66d, 0x298e85c552962dc0, 0xf65e16051540330a, 0x207ffaf6bcf29bad, 0xdc3028e4c4b3fcb3, 0x6bdae8b9c0c5a69f, 0x3f9fd17878d97250, 0x1d07fa718c901221
+, 0x6c557462600184aa, 0x4e0caf315606626d, 0x286f78f9e0f07876, 0x2abbcf6262ec1c8b, 0xc252afd2d75589d8, 0x1f8a08cfae7a5db0, 0x701e7760eb2bf8e8, 0x40bc7eb4d6821670, 0xa41adc335c3f7df7, 0x3c8c8606561071d1, 0x2436d3640c6ef9b6, 0x221c986fa804441e
+, 0x71f0c0793e0373bc, 0x077679d1d1cfe924, 0x26c4a2d3657fb651, 0x459ce63bf4b57b1a, 0xa745d130f74fc519, 0x403a909d522b838d, 0x11d02251677261af, 0x29523b43b0315fa8, 0x3fb5c70b96f20529, 0x1c20a1aab6740d9f, 0x0478ed33699af85c, 0x584dfe34320b60e0
+, 0xd45476d18e680c2e, 0x647d96d97da2530f, 0xf19eb39d86fbb321, 0x727d514568e12c52, 0x05f1b914e6541ccb, 0x537450647a2d7ee3, 0xe90a250d08ea6a67, 0x3dc2508f16f739e9, 0xd4bc5ead1ab5bdc1, 0x28d64d69d57d3a55, 0x00c731ac43820abe, 0x1f95522990098718
+, 0xbd7a449f48540cc3, 0x7966d99a5b924f3b, 0x1d453e21dbb3f51c, 0x29ba9d723e9caa7b, 0x1d10736594caba81, 0x5ee8ea1a0cdcf7e4, 0x880b0b69cc38d9a4, 0x3170de80f0ae6476, 0x59a352123c2ca270, 0x35332ca4dfdc51dd, 0x7ff2f8a5ba203207, 0x491c2ff92c9ccacb
+, 0xa50286e78f2f1807, 0x79fe91de648c9ec2, 0x2752ce78ac8ed007, 0x5523ab66b064ac78, 0x72884d28e8df72cb, 0x365aec6c9f458e01, 0xd02e6bd547923c45, 0x18660186874293d1, 0x8995e04cd4d094c4, 0x3ee4c21b04c2b91d, 0xacf015452481a7e3, 0x04a8288f2dab2033
+, 0xff8c56b1d56ddc21, 0x4e80a524899e9e46, 0xc068dc52f8e763c2, 0x3c32f8fe144a78d1, 0x58ca29012e7e320c, 0x54fb3292845963e7, 0xc6e6228acf933961, 0x213ac4b6e33629e2, 0x0a2efb6a884d437c, 0x57f31a0fd7f92d1e, 0x0d5a82c223c7be3a, 0x09e2ade6fec06cf5
+, 0x86f115c79dd2ad11, 0x52ef2001d8d30f7d, 0xd89de7c1aa54cf2d, 0x7e8b7e8b5de04bc9, 0xa48a168a6a9074f1, 0x36a9a551aa160182, 0xc1db5446c222bfcf, 0x6064077584c84e20, 0xc4d3b092b31d6a00, 0x7779201569ce93e5, 0x8d405ad2fd6188b5, 0x7ccb21e03204d6eb
+, 0x27f16852a3e7c53f, 0x71a6f505c48baced, 0x6eec9fde317690f1, 0x4a04f8e78d72019f, 0xb30c08bacd350150, 0x16f543f7c8617b61, 0x953020eb589700a0, 0x01166c6299c7da12, 0x59df86bc0ae2ad33, 0x1f4c4dcf29b9290f, 0x4897ea0388e2b016, 0x17c0a5db85823a0f
+, 0x35815c7d72770a5c, 0x4aca76a5710d6081, 0x1836e22c7aa2a2d0, 0x0f36fb03da53d527, 0x8ca2051046191c2b, 0x04dc755f52a9a374, 0x32716206a2437b3c, 0x634ad2fac24bb07d, 0xf96389c791db2576, 0x2025a1cde95e3152, 0x4d3ae8f1e486b772, 0x3e9aa67bc755fd37
+, 0xee58984381a94cad, 0x112fed7cc50fac59, 0x0cbd3cde97153ae9, 0x39a3f294acfd8c19, 0x977a45b4cd375f99, 0x733ff86e2a973616, 0xe29d22e7437983ae, 0x6ca1b01fd9c71808, 0xe891e153de08016d, 0x1cce270cc3065e75, 0x09f4bce61cc9699e, 0x109634e551d28bc7
+, 0xd1a069bfbdf12b10, 0x279a6c849bb39c09, 0x5f3332df76a59a0f, 0x68767b494a1dbd9d, 0xa2dafed389299eaf, 0x7ed8ce035df903b3, 0x0d0648ef225bc965, 0x70b5630951127da8, 0x56aaa56411d60a5e, 0x377196b4e4794e7e, 0xbaaa813dfd40176f, 0x7c3958b939dbc3a0
+, 0x5f7b1c7ce23ab63a, 0x3d2b8b850ab12c1e, 0x74d3cce3bdc90d54, 0x4728923781fa8e58, 0x00b9c3519ee84e15, 0x52b9048adef6ed88, 0x97af32ce04eaba82, 0x4347a6c4f7ae731f, 0x3556d826b9ba5f40, 0x041ef2f7541da510, 0x47fa23562d448567, 0x4e9b4b3f7171c726
+, 0xb46ba459d9272f20, 0x4e11ab0ee9c4968d, 0x90e4612762dc564a, 0x3ca742cc03ae0c59, 0xae7c08a2b07780f9, 0x029f3d28a2525bb1, 0x1a1f890177df5cd4, 0x60691cce89c7bd4b, 0xe7f561ad83532c89, 0x387b6a4e9bc24e43, 0xf5508fcef2fa94af, 0x20f6f78b99d318e9
+, 0xda0e483b23ee1541, 0x65ddf79a10004367, 0xcd6db216a861f36b, 0x55985dc6bada2640, 0xa5bc03adc9e7c2a5, 0x21013d740fc11134, 0xd49bb5cf741cd4ed, 0x46d0fc2f4e5fa293, 0xcefa91f15e71b19d, 0x2b58b7c912340c64, 0x1101e7718ab5eba7, 0x2bcf63b903da4195
+, 0xb4841b683e9e9f06, 0x7771f64a2ffbc015, 0x3c531b3747b93cfe, 0x16059e47cc28e8c6, 0x64d818c1f935c2a5, 0x0d5edc5f6ee5869e, 0xe8c41ae2c23c1859, 0x557f50189f1cfcf7, 0x83934e23dcb7ea3e, 0x0af0457cc1532571, 0x0bc78c2ff744cc83, 0x5d90d5f9ee31c489
+, 0xadc3cb5eb819b9fd, 0x537cd9601b1798b0, 0x8b07ad62540e4316, 0x16edf39f75ab7821, 0xa43999175f7f8182, 0x16ca97ce8412f113, 0xa95764154f06c0d2, 0x0721975e4b69ab91, 0x8369034fea109364, 0x53a088ee617a2566, 0x7a1a7b8a4ad7f985, 0x5ce01b96612973f9
+, 0xcfef98bda4d36191, 0x5dd2882d64eb1589, 0xb06508cee49441a7, 0x48d8d49a8a1518f6, 0xa8e44697ef5d3d01, 0x345613e6ba5d9365, 0x6d15fb058f74d85f, 0x186e8f35d29f7b2c, 0x6efd31755c4c3b68, 0x579583881aaf3895, 0xf887bb34f62ce0a3, 0x53f92ac78b5271ae
+, 0x68e03976c96fdbfe, 0x6256fa2611573cbb, 0x786aee1a65389baa, 0x508a3d3efec4e00e, 0x414bcfd2a4c8e73b, 0x0759fa71716d79dc, 0xd2ccbdcf793453cc, 0x376f585a34cc7bce, 0x51af98ff5b3e1f10, 0x18bc9bcea09ddf9c, 0x62eba99475af4901, 0x6089d9ef42b3ae87
+, 0xe47b0db50c69b35c, 0x0b0a88d680593381, 0xba63cb233b54c075, 0x0c82e398e7ad8272, 0xb45d0d32aba32919, 0x38843aa768146c2b, 0x378ad2d27606d7eb, 0x4a2c74a871d061b3, 0xf36717fe4fb055d4, 0x0f1bc16e2ab8d396, 0x6c6df895cc8ae9ae, 0x438c6290623c7fb5
+, 0xc75b1cbb572980d8, 0x5d39b57d2e5cdec2, 0x8ef7c89cfec9a3e2, 0x16629a76085b5f13, 0x0f095871403c48df, 0x33172c7c9fe6997f, 0x6d1170b38a961951, 0x497eef7901f79aae, 0x5b8f90edd6180400, 0x76ecee9dfa8994ec, 0xa43a9e096d50e12f, 0x48cfd50e109c8bf6
+, 0x159bdb7286a9fc56, 0x36ca471c26d3f48f, 0x91327b3bdeee2d26, 0x260efb034cb17f65, 0x5ec493caa30fbd58, 0x563b1aaa73c3d173, 0x69bf6131891c3c19, 0x34a01ebeeda38302, 0x44f2a7f91763ee61, 0x075f29b6e74eade4, 0x89139fee7d705401, 0x0df12567439c45b6
+, 0x428f64622a336388, 0x6fb30aee27c94e69, 0x3c08dcf72d949cd9, 0x7d043ff69ea5df9c, 0xb23d79e1d514eb04, 0x17e75a30e09afbe6, 0x33135a5f1fc654e8, 0x4fe68066684a3b1c, 0xdf3d207ca48b8e29, 0x306f4e1037ae9637, 0x3711d9c881e97cad, 0x47dc45af54641859
+, 0x10658d08287c5d70, 0x77c74375116e296c, 0xc3b962289d5fa7c9, 0x66a2756124f96a77, 0x0fea2600e9552d6c, 0x0047943147ad7668, 0xa333a4789c9b6122, 0x46aaee7bf49a4cd8, 0xd032a940f6c90766, 0x70a5330ab3b05185, 0xa94e4a87adc4b406, 0x46b9bd8b7db7700e
+, 0x8e26b97a56e39682, 0x676b420234bfe1fe, 0x073aad2678cdc0d6, 0x61a61e4f019e9134, 0xcb2199b2e8250a48, 0x5dd27345ac71446a, 0xdfb2a551090653d5, 0x06901390af72522e, 0xfdaff911e30cb074, 0x116e01008263a777, 0xf97010c52c799fe7, 0x38e3e9f0c62de0ec
+, 0x1c8772edc8addbb8, 0x553abb8c7f1ad8ff, 0xc3193545377446c3, 0x5a89a0010a37fde2, 0x0c8b42aecd8e4874, 0x76d0637bfc81b452, 0xad2dd30e213e3f31, 0x08fa296c1724bc46, 0x9efa50238de6c466, 0x6ffdf8a232ccfe8d, 0x032003dd7a051a26, 0x617fa0fd107aa616
+, 0x86fea8f8551b4ebf, 0x276aa64cde1b3aa8, 0x67c411968484187a, 0x38f6be4bd320bfa3, 0xad859ab23c25b6ab, 0x0edebcd6a6dfbf06, 0xb2964800c6faf788, 0x5f3ce96b295d3abf, 0xb3a0f4d615ec62a1, 0x228f887ed27ef958, 0xe4ad4ea5920fc8fc, 0x7a8b5e30a14bef34
+, 0xfd92172d76f2eeab, 0x0b8254e2f937a991, 0x86a9b03543937709, 0x5a0f6f874668115f, 0x401423e57b62db12, 0x00bb89a73e9dd859, 0xbd191027f14cdbbb, 0x7e076826e29dff39, 0x453089f697c21026, 0x7a108b36ca468152, 0x5128216641e6ddda, 0x19a0b760d6e98258
+, 0x9d5716af77bec4c7, 0x203af2d716cd67cf, 0x2368486c596eaa76, 0x1e9c2d255220f518, 0x046c1a3dfef42006, 0x6aa757477b561cd0, 0xd1b508ad8e7939b4, 0x036c158f105f5e49, 0x21436cf705b61346, 0x5494bcc4da6a1c53, 0xf6775de955bab8cc, 0x3df0cdf3ba23c750
+, 0xa316b2934c422686, 0x2c836696e607a3ca, 0x4ba307b3a7777cf1, 0x46d047b1045a4758, 0xf47e73b79ae14556, 0x14cb70a473ad2c29, 0x74ddd5d0980caf4f, 0x0f92dc4bb36f8c8b, 0x41cd8b12843b4667, 0x78b08113573a8c5b, 0x4ab51a3124275260, 0x59945757a1e35603
+, 0x85b94046df141cad, 0x42e94378055b4e1c, 0xa7883801ed86b790, 0x19e9030e0792e80b, 0x4a79e7cbee73384f, 0x1c3b3fe972853f3f, 0xc010d5e57b9f04af, 0x63b74eee31602185, 0x917f2f498f7674d3, 0x2b674d6774b4ae8a, 0xd48cff0fc2acca2c, 0x2126226ed5652b09
+, 0x25540525ba92206d, 0x1a87eef05c21e04b, 0xccc8820e1a120f79, 0x6e165545090ba08c, 0x2c1ab86cc0718549, 0x5ea864a3da171330, 0x1d2b12bcf181c12b, 0x0e6d9589b20fab7a, 0x6674f2795ed42b45, 0x2cd08692d3cf8d85, 0x43080cb8bf344ce0, 0x6294c66157b43ba9
+, 0x35257766c54db4ad, 0x01cea295df853e33, 0x75b90d2bc0c72a00, 0x300b29d65d507414, 0xc6bc0305df42d434, 0x558393b789d42099, 0x193d9356d69de1ef, 0x18552c2a7ad8e26b, 0xa9d5501fd388316c, 0x1fd688146998f929, 0xbd530083df0fd6a7, 0x0472968f267347c0
+, 0xe559f37460836f40, 0x5fb48a668e0c46f0, 0xd7359a6bcbf98c39, 0x79aef0d56c117d12, 0x077cf1ad315cb464, 0x28ade7e11e5151a5, 0x803a2b9996b42e55, 0x384094cbd10984fa, 0xd58f0c96c92fdfc6, 0x71d9e853adf00269, 0x97b03c86cdc1239a, 0x112bab513318b9d3
+, 0x93d3327f0051738a, 0x5e76174ff7bb760c, 0x0fcbea7447db2aa4, 0x558ec0ad64597665, 0x1ffbc97848b09c80, 0x1bad99fb691d7b06, 0xabdbab41a62fd8c9, 0x47bcbcf106d87905, 0x345005440f749f02, 0x7bdfb22da26dbcfd, 0xb7613a9c9cfdea36, 0x19aee00fb181d4a8
+, 0x28e4a3366f03ada5, 0x758837c41d5aa82f, 0x2a5defcb85aeb141, 0x70e3311d828b0372, 0xff5714e37464c3d3, 0x5596f514df8a0ebe, 0xb9d4b26ccf202904, 0x6ff7065daf3e64c6, 0xc42dd36380295cc3, 0x265d25833fcd71c8, 0x0b3e4ddd577b8e40, 0x6777ec68ccf3429d
+, 0xfc509005de669567, 0x65a32ba18e86aa7a, 0x891545ce5d0b0a7e, 0x0ac3461d08adf241, 0x72ee2cd49c6d1c92, 0x0a98e5f735cedcb0, 0x2fb5dcd96cb538db, 0x26c9152b75126706, 0x18579343bada9e70, 0x739c59511f4044ed, 0x7b27242929f5b071, 0x19c2cd3b98fa87b5
+, 0x2fcf5e9789662678, 0x59ae10ff41f487e9, 0x81f95a9f15aab6a5, 0x3434976e266732a8, 0x1b89f26444802b2a, 0x01d63646d5776977, 0x1a349f8179dc370e, 0x06e13db21e2597ea, 0x05be3c43d902b9a8, 0x489da33a8d0bc34d, 0x1a838d967d076a00, 0x2cc4826a3721ecb0
+, 0x80c29b822f1fd09f, 0x40a6832f14f61833, 0xedb872402d7d5c9c, 0x4b8ca2199f5cc812, 0x90cee4ea81bd0d09, 0x7ee274b511adfd77, 0x6a44b226fd1b6194, 0x0bef994932494e92, 0xcf96b7fb203d58fc, 0x11f6631473bdc2f7, 0x5f80623aefdee6c3, 0x5d85c3f3916b6d3b
+, 0x39773e939f758724, 0x522e94b700250e94, 0x4563d0a5abb17d27, 0x1de29920f0d9c3d0, 0xc43834dd6d12ff4a, 0x0e5a000373df0ca3, 0x216c0e1746c7b572, 0x37cb426adb401fb8, 0x9a5c909f5ed91a26, 0x645d80828e431d81, 0x34bff5f6e315ca58, 0x1fa54018c69b2815
+, 0xc78c2d47cecc78cd, 0x549a902e47b44b62, 0xc78a897d9a470c5d, 0x46da9b5955336a03, 0xb0b32bf62f025b3b, 0x14ea203a2fc78ae1, 0x0880c6ca91d7d3ff, 0x3d87f5c2072e7eda, 0x12000d9f7df446a1, 0x1e01c2b1352ffcef, 0xc22a65c4f7420b21, 0x53c3766f178e5467
+, 0x7b83718a44dd688d, 0x3ffbac7b9364d488, 0x02ce135b2ba018a4, 0x0c9ce50c71522320, 0x455e4f6af0b2f4de, 0x4ea02453732f0927, 0x5d49d80200af0da6, 0x7363c8468590cab6, 0x56f0d49099897b73, 0x027008d5dbb62a98, 0x64f7ca4d68b7e3d1, 0x5fec6e724a1951ae
+, 0xe6f763a4b43b27a7, 0x70d75a326448d868, 0xcc8c4cfb6e3b8a19, 0x677fe8ee47d8a5ea, 0x4fcd96bd3f403fa9, 0x2eaf93418435b7bd, 0x71cc5385d3ebd1ab, 0x66bbaa8cbfbf8955, 0x170bc18da850d051, 0x367120cfb313cdfb, 0xbd45c54364f2e063, 0x6c452e078000f65b
+, 0x43bee90d84d15305, 0x203daa23706ef52b, 0xa5d42cac0bb0fbc8, 0x35f79b6255b6426b, 0xaa89373e8774aeb0, 0x5db202c91004791a, 0x46ff7bed7a27b96a, 0x462b2e2f0a8ef2f7, 0x2dc2619d291e5f5c, 0x1e830ac7b20b048f, 0x7962ed7d78ca8d04, 0x6a6db1585d3a4d8a
+, 0xd82c1dff18bbe2f7, 0x5cc9376af97e2a34, 0x403060e62ff3ac80, 0x66a57ed184b09b2d, 0xd93f6d077af35d54, 0x0effb9c51ebb862b, 0x242c84db1a64d2c5, 0x2aaa706c81492e35, 0xfd610d5123f0cedd, 0x719c17f7e26e495d, 0xf085755b9d19ea32, 0x055296ff992d975f
+, 0x0cd4a9c4547ebbb1, 0x5e3bdd36c12d4658, 0x04bc97ad1fe98c36, 0x3a4fd900599addcb, 0x9be222ebd174188d, 0x29ac4ab0eca1cee7, 0x6aacca37085ade1a, 0x1278765ab2e84fe9, 0x7c3577293ca17c9a, 0x7361cccfa4eda78b, 0xd1a76101782ef65e, 0x531d87895b71261c
+, 0xd820bfc90b219732, 0x5895408ef32e3c7e, 0xb5c62b4e460abd1c, 0x35eafb6b36c2aca8, 0x1df4702ed355fb7d, 0x20f29fc9a68494d3, 0xd7eeedddfa9fa330, 0x515a8c258a1ae750, 0x3fd7294413b71551, 0x562b3b618b4c91b3, 0xfd813b83a68564d9, 0x303e6744b681655f
+, 0x1119d3995375b3be, 0x09c813938eb1e586, 0xb0734520ae011277, 0x7b474fc0b770509e, 0xb66db4e8240a924d, 0x78813862a44d8e86, 0xce527529a6702300, 0x67c3626f80d63b3d, 0xf7370de113f442df, 0x468613f117b801b2, 0x6d57adecfb26ed58, 0x12a58edd5228f61b
+, 0x5855748c84f2d5e2, 0x184cb83e0622153a, 0xc42386e40d786e6b, 0x2a7d004ffed6f0f6, 0xfea7c3cb18159e80, 0x6562222f1f9c35d3, 0x666e49051207e79a, 0x6ba8babe0b0905bb, 0x1e92bf20f954add6, 0x067efc7abcfc3279, 0x52f3bb0b10e1ba68, 0x5428c0d90ddec3dd
+, 0xa4054b95820ef8e0, 0x742d0af0f8f97c12, 0xb3a953d7557a5bdf, 0x479ee51e1e766416, 0x1bfe0e037230f990, 0x2cc4a5adbab0a023, 0x670c72b937817b9d, 0x5af6f2f685a5f43a, 0xf145df94c755241d, 0x4e9b94cc9b54cef6, 0x20e722d8b0b83fb6, 0x69ba69cf6e9cee1c
+, 0xb7d72485351ef77b, 0x112f99128e23e5a0, 0xb75e131c32fb5ba4, 0x794d5854ce7d73b9, 0x1a9c95865337f9c3, 0x110b1441078a4348, 0x1d0b875be659b5c4, 0x502c32373e99e3c1, 0x32ed68cd57e559ce, 0x5da686856fa8897a, 0x95231e41d86c77fa, 0x7076ee97e64f3d30
+, 0x64cd004db161310d, 0x7cd949eb1db4b2cb, 0xc6a4013b763da98b, 0x0bc4e310695f901c, 0x87623d9b6dfa01cd, 0x30e44640740c69eb, 0xad54ae4c75449a91, 0x21338f6a4a7dd83e, 0x00bebcd7ab42e11d, 0x611263ee2a596d8c, 0xae1947cfc21b0349, 0x1f6a3745d5f74a59
+, 0x6526af4dda0388f6, 0x10c1b7af2b09766f, 0xaec90758faf0382c, 0x6fce2ac1640cf8ef, 0xe68e3ba5f1f1c3b8, 0x374b3c41ef0de8a5, 0x8d1d0b6fb09b9296, 0x4478c67b34532c78, 0x5af4d2f2e501afc6, 0x5eff3bfb417524f7, 0x60c3110421d4b451, 0x6a1e08cbbd4e4c4e
+, 0x8eb485ed51022d4c, 0x0fb9783a05d8108d, 0xf272079dff9b300a, 0x3cc5905a64772512, 0x4131ea71a2dedcfe, 0x579d279a638ec5af, 0x0b3e60970b5b0d92, 0x4eaebeb62049156c, 0x2fd8e59334a737a3, 0x6edc857066b6dde9, 0xaea5c2c32e67960c, 0x6d8845cb5161ee80
+, 0xb1f8f73aede28ea8, 0x41e6da8eb98636a5, 0x4770166578633242, 0x53576711fef468f0, 0xbd6bd83862edcb93, 0x0e07669846dbce50, 0x6aec1690ae2d8ab2, 0x48d9e48d8169b534, 0xf75a32305cd1b25a, 0x3f6dc0380e8a98c2, 0xa9984d982278410b, 0x01dca01174f8f815
+, 0x66a0035d318c362c, 0x02d7503b2b63a3c2, 0xc72ed11e0570ffd6, 0x0775c52a8d746970, 0x548963ee058d3687, 0x1fa2a47e4fd1f481, 0x3b82a37ba1d678aa, 0x2b672f549aea184c, 0x00551ef47c7ea432, 0x20f52e08b8a5ac75, 0xd759e2358d1b33ec, 0x0322dcd6789061eb
+, 0xa124f225f859f644, 0x4e1c8e1926700d7b, 0x8bcd8a0280b602f7, 0x3cfd9d06cd0aa4ff, 0x82ed54338617e141, 0x17e7e9a6bb198bda, 0x26947a4b9b4977e6, 0x3c7cac3dfdfeaab1, 0x7682034f0e07d4e8, 0x2dded8240f2ed499, 0x922f60f742ad2ac7, 0x30cda9fd92b9d90c
+, 0x35c1bd6d4fed37ac, 0x31cf746d03e2203c, 0x68417a0d2d7f9298, 0x2f4e400f88eceb94, 0x86fe038621f68789, 0x7dc506c1438a5436, 0x0a27c1660ba60132, 0x450cb68b5072c373, 0xc71ee5a87c7f5120, 0x4f8d11dcaabcb792, 0x7f38025ce8675710, 0x64ee0ac70c8af546
+, 0x6ad49d30fc8f4380, 0x75fd853123cf2c86, 0xfa6e5cb01cde6ed2, 0x1f285e24a9f40c20, 0xecb110d2096b1907, 0x3a0b08ac6173de09, 0x78f9dcbe0c42256e, 0x5a538e6ffe271605, 0x9587a89e4ab745a3, 0x1d485fc8dd1300ab, 0xaf6fbbd5b9a3da2d, 0x2e36ae652374b87e
+, 0x575b5d62a5b9ebda, 0x4fba4e2900522013, 0x9b5c5d9c2e1e416d, 0x15bea748b1a79ad9, 0x057b0b803c5da8dd, 0x41e5cd35f6351c27, 0xa5984ec0304b2d49, 0x4b20e2d0a6b57dc6, 0x9868028198f50c72, 0x61c78ca012d500f6, 0x48f32de2993ef24a, 0x32709b59850e02fd
+, 0x865860336d3d81a5, 0x4c65eda13a21ad76, 0x1f845e6d26d142de, 0x18d94ee3b641bfa7, 0x02fed804ab1ec54f, 0x6acbf17fe382d9e1, 0xdf27e42c71c4e261, 0x351a874070de931e, 0xfae9c516ff10a8bd, 0x0b8ef257667dbd93, 0x8fe5b7789cd5f357, 0x158b6e976dfdcc1d
+, 0x750d195e03761b4d, 0x171601a544d2b387, 0x6058b414678999f9, 0x66e8324069e4787f, 0x330ebf7e32d115c6, 0x76634a12f45ef3f8, 0xf5e475d7c00da176, 0x157713076c5e76a3, 0x471e285fedcad526, 0x3293cf24b95dddaa, 0xa440d262d8e22a7d, 0x44e1aa1a18e6ab1c
+, 0x9a4f22fab55cb398, 0x39b7881eb0ce31bd, 0xa78f181bccd469e1, 0x342373a71a1caeb9, 0x3770bea70d4fe084, 0x5995600928f7741a, 0xb4cb8a8701524b41, 0x40939438c3071897, 0xcdc0301577749b95, 0x28081ec8170f705f, 0xcda6620e2edaa36f, 0x30a841aa0e4bbdba
+, 0xfba8c05df8f2c747, 0x7ab5162daa471154, 0x8d32e1d810c03bb9, 0x7ddc4987ea0ae4c4, 0xb094bcde84c49d05, 0x75322384339433ad, 0x8af5eeda860fb1e7, 0x365c19078f56eb55, 0x3a493b3c74d9fb56, 0x7863c8e73f697fde, 0x98bf7f10fb818baa, 0x6e288211c9fd7ba1
+, 0x92045771583dc007, 0x136f38d111e0b79c, 0x2cd9d4dcc624b21b, 0x5033af0e99fb808f, 0xe374a18f838e5069, 0x59d363287e4fbeb2, 0x9e88de3c3e7ed308, 0x1119b8a51ab6cc98, 0xf79f08fe584bd6db, 0x3735e72776e29b62, 0x8a9742f2b544cb54, 0x225d0bc425c014c6
+, 0xeb6b476e9531c566, 0x4db62e3e07628279, 0x65f2b3ba2042b05c, 0x20a3fb0a5cb8aaa3, 0x6cc12b2b2291674e, 0x6f14f1f146491ac0, 0x0d68228a4efd4fdf, 0x4a94247f580365f8, 0x0174e8896481c2de, 0x27af1cba8daec474, 0x1a7bd1993d28b66b, 0x44d96112610418c8
+, 0xc6884e21866892e3, 0x68e4437ba361269c, 0xc914208687a19898, 0x2fe8422eb2b629fd, 0x1147c70a6e4d86ae, 0x5ce33a927d901828, 0x0e6e696d3413df2e, 0x5235ed69f2a3c56d, 0x2f246e10d11818b1, 0x2808676fa162c8e1, 0x6e0933b048e8bc71, 0x352751698cc6ee04
+, 0x06cc29769a997f2c, 0x6faf16b6c89751a4, 0x0a7dc2c9a61863b6, 0x420c67fb2c4d4d0c, 0xbf1712e960ee69a3, 0x75653320f93035db, 0x4d0dd188aef4378d, 0x3ae599f3da834007, 0xd3207ec755e83e36, 0x7bf4c628bc7db677, 0x4718e6f5abbcfff4, 0x1ea18eff8f605f98
+, 0x8cb64882ec8e4d1f, 0x498312807aa2eebb, 0xac08316b5762c567, 0x61df33648d3056fc, 0x27c3b1b54354c7d4, 0x64fdaf1b766edc8b, 0xd6ded5fc019566cd, 0x56758ab2e2a17b2e, 0x6b4dac0fa96aad80, 0x096281fcc7152972, 0x2db9deb2cc6e827b, 0x1c93c95468aaac7d
+, 0xf97b420fafcdcd1b, 0x2c20eaa8878b43a3, 0xd7513550ce9cc5e7, 0x22968c4ff6ce9b7a, 0xc47cd91f9000307d, 0x4a5ab650a584120d, 0x86f91c7bb788b566, 0x3e6abd1398e3da00, 0x62f1e70ecb34ce8b, 0x6a78677c22a96a31, 0xb7808eafc73720e7, 0x0079dd7915727752
+, 0xaef47a1827bcca8f, 0x27a9e633402b8e3b, 0x2e30d3c45606a647, 0x7e33bf000e40653d, 0xecd5c0be7bb6b048, 0x5095d603891e2640, 0x18d603d5c9b59b88, 0x6f28c9d131486f3c, 0x07c84f5342c92a04, 0x12203ac4c40a3a5d, 0xda209746fa1d1011, 0x4f3a4b4a3d8eb4d5
+, 0x4e4c6316622cd1ad, 0x36bdfed170ce41f9, 0x0284dc57026e2802, 0x246842f61d4a224a, 0xe6b2f76caf03abca, 0x2e4aaed9c8edd9a0, 0xaf128cdb7341361b, 0x4b0b5cc0bc7d3ce7, 0x4120fec65a846566, 0x24479e1b7ab70e06, 0xdb32fad92c470ffb, 0x13c5415a710b2676
+, 0x451f4d649e189efd, 0x6710436c31a707ef, 0x6c76eb99acdb467b, 0x2aa3818fdd48f56b, 0x4790d08dba6d1573, 0x51ac94b029f8ef14, 0x8ab56a3589bf005d, 0x76bb1bb761801d8a, 0x8aed7c7315ae6077, 0x03f034c9e15ef546, 0xe3c29bb954c22fac, 0x6d686ea32a7ff877
+, 0x27a76bdf2c6f8fd1, 0x3dbd9e38046c8986, 0x673f1dccb6fc15c1, 0x7762ee10cd2685e4, 0x975793ca1bb02b85, 0x183644dcfcbe52bd, 0xd14f66f83f0be7aa, 0x632a212ec642ad87, 0xf8bf17607dcc0afa, 0x4a0b77b2d180d5ea, 0x75c778b6b96b5d7c, 0x5f35cd2beba6d4eb
+, 0x2923da8050af2aed, 0x19aefac87b2c5040, 0x1ecd5c2d2d44b1a0, 0x2fc233b89ff8b70c, 0x2bbc10296ad8fddb, 0x6b0b283658331744, 0x04c673a3f1dd89d6, 0x60abe239dd31840b, 0x14116eded778875b, 0x4e9366ceca3340bc, 0xa0d45433ce0ab159, 0x4d07dae2e04aada0
+, 0x383c97dbaa17ba89, 0x158027a64b4e8dd6, 0x229394fc7ef53f55, 0x01d1b00306134926, 0xfbc63dec40dac869, 0x526d717718b5a99b, 0x7e1ad84ccbe8fd38, 0x2292ba6506c9d3c0, 0x1d084d6e0da8e9a9, 0x7ec338667bf94961, 0xc0a192478589a5e3, 0x767fc8a2bcb2330f
+, 0xebef8212a0666dac, 0x255b2e35f5b49c76, 0x0f6160427940f48f, 0x3a15814cde2ff725, 0x771d83f81871629c, 0x04f5b1981a45bbb2, 0x39a6d8165d27f81f, 0x5c5b43dae3707218, 0x886d533ab37514d9, 0x255a5142deabb463, 0x6e4fdb130f62ce7a, 0x329b3116cc6f7054 };
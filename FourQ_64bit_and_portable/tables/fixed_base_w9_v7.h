@@ -0,0 +1,1805 @@
+/***********************************************************************************
+* FourQlib: a high-performance crypto library based on the elliptic curve FourQ
+*
+*    Copyright (c) Microsoft Corporation. All rights reserved.
+*
+* Abstract: precomputed table for fixed-base scalar multiplication with W_FIXEDBASE = 9 and V_FIXEDBASE = 7
+************************************************************************************/
+
+// The table below was generated by table_gen using window width W = 9 and table parameter V = 7 (see http://eprint.iacr.org/2013/158). 
+// Number of point entries = 7 * 2^8 = 1792 points, where each point (x,y) is represented using coordinates (x+y,y-x,2*d*t).
+// Table size = 1792 * 3 * 256 = 168KB
+
+static const uint64_t FIXED_BASE_TABLE[21504] = {
+  0xe18a34f3a703e631, 0x287460bf1d502b5f, 0xe02e62f7e4f90353, 0x0c3ba0378b86acde, 0x90bf0f98b0937edc, 0x740b7c7824f0c555, 0xb321239123a01366, 0x4ffcf5b93a9557a5, 0x297afccbabda42bb, 0x5948d137556c97c6, 0xa8189a393330684c, 0x0caf2b720a341f27
+, 0xe576830ef4b26e77, 0x003021c5b0e8cd15, 0xde29e50be95674aa, 0x024b2ea4a9b4147f, 0x5207717bf217c347, 0x6a17c7a6d96bdd7c, 0xa052914da479eace, 0x2a58c090a187654d, 0x97788e350a95f617, 0x6ff202b2f340d8f4, 0xd62fff52e4640e4d, 0x7df30c69d24ab212
+, 0x890d1f687828d603, 0x4b58f74033a5ea59, 0x1dbe6a80a09d6aec, 0x3912d5691c9c6ebc, 0x3c243f1a2bbb7dd0, 0x5066d55d178ca612, 0x5fade32a23134861, 0x1671d259fdfc753e, 0xb548567c54471733, 0x1ad8fe708086133e, 0xecf45fbc33d5fb92, 0x2974640bb74cd001
+, 0xa7c510ec32814e52, 0x0b5cb8912de6e3a0, 0x08016877ab29f7b4, 0x4b837c3cc9a76fbc, 0xc09fcac934b5d1ee, 0x3b55de9211a7d27e, 0x36d1ba4ab430fad6, 0x5d83d0274fdcdd76, 0x6fe27ef808ad3645, 0x2ee147a388ec8d79, 0x04e98d81989217d2, 0x207fe14109c2cdf5
+, 0x4bc50f1db4b5dda6, 0x163fe0f65ea5943d, 0x50b9cbc0b20ba676, 0x51adb33b559f4020, 0x5db3a476dc37338a, 0x4e26d412317b8787, 0x79657ff8e320cf07, 0x431ba5ed9a02a90e, 0xb04978006c4f7681, 0x757f7ed6f00b2a8d, 0x44dc2997ce9a5289, 0x5952035e0e2463e2
+, 0x8771a5f7a4a10cd0, 0x3f4f0061eaf61a06, 0x9102ceca88ad0c8f, 0x2c0849531e9b6f61, 0xbfcb3030c6dcdd35, 0x4183d8ad126ec934, 0xb99188324f7c6a34, 0x20f9864c0250756b, 0x7ebab09a15047937, 0x3c1c431a47423d78, 0xe0f05c587bd680e6, 0x113222cb35718a4e
+, 0xb73604bb52ba68cf, 0x6914d2f5263b796b, 0xbf91716cd5ef0cea, 0x438a9f347b62f603, 0xfa09354142417ef0, 0x29abd931c1226a87, 0x7d9effb9f3bb6792, 0x0b23e2a80ca4a00e, 0x3fa806f22a4745b5, 0x0c4907255714de43, 0x81c7d4b6f1e8f088, 0x0c98cf13db65474c
+, 0x97b47ffa24f599a5, 0x1575c4fc462f6ca6, 0xdc8055485d87e6b4, 0x5594cabe7e8d4f42, 0x4f24c2843115b3c3, 0x7756cce7f53d03b5, 0x7d66f70aca5a8b2e, 0x28778ccf51e10386, 0xb4b713e4bcecc514, 0x30f69287cd5e9c45, 0x8756005713ccc253, 0x222613e21147feef
+, 0xb46d05a7e7012e0f, 0x1f4dce3c7d48086b, 0xc5451abf33307bcc, 0x5350a1c94f687669, 0xa1825cc907cb91de, 0x4fef3b805484daa9, 0x40305a11e0635473, 0x108825dee8ec33e2, 0xfeda4ef3c5cc91bd, 0x45df9395cef2162d, 0x5e3131f6eed3d34c, 0x6170948ed57c2d18
+, 0x1a4fcb6352ede9c5, 0x19f948ebe92b59b0, 0xdcd1e43fba952f5b, 0x74493bb13ac8bcdb, 0x1c7b7a5ffa6bda24, 0x6542c99d3515880e, 0x52cb397156536a68, 0x5ecf53617c4330fd, 0x56c66dda9857807c, 0x22aad84edfb1ff86, 0x1831bdfa956e62d4, 0x6c69b4f3d2fd939a
+, 0xf0c20b1a191bc5a8, 0x053df40f520b1920, 0x89013dee09f15b2f, 0x132e2ebeffa2cc30, 0x57d26cad8b85ef98, 0x2ca031a6d656cbc0, 0xde01e9aac2baee09, 0x192e7cb099007e62, 0x03c253bb93277305, 0x4c92486cf6b11778, 0x38aba46f3ee65333, 0x5b5aee44c473815b
+, 0x34b05d1011376ab0, 0x76d387e1bd21ffc4, 0x6113d45fba5b30b9, 0x41462c3ee036eba4, 0x0eb7e6a1f25ad80c, 0x2c8824172df7ec96, 0x0f0512cdb88c3f42, 0x387d334fafc56b95, 0x776b3a4c3bceda97, 0x45ec5101ca7feb83, 0x76a7f1b3ad224f38, 0x616ea113eeca125c
+, 0xbbed7a369ab9d372, 0x16f13154b0fff6f0, 0x1e62b2bf03584637, 0x297bbb8a776d0513, 0x8090571ef7ffc9c7, 0x245f1abf81b2ecd6, 0xa706a80199fad2e7, 0x14ce901fe58e4e51, 0x00b55a9028f52d4d, 0x2127de9a4ee3818b, 0x362e8400b4c1a067, 0x1a9449f787aea41f
+, 0x5104ad414442f60f, 0x07d15d2906a22916, 0x2f0d7726f13c75f1, 0x7c699fccfa015e8b, 0x05e9e6c4fb839e4a, 0x32a0640af485958d, 0x40011bf38b21ed92, 0x6172e458bfaefce2, 0x7c9c113410d2665f, 0x1c40f79b11a4e263, 0x81ea3d8eef65bb54, 0x454eddf94e17786c
+, 0xe350f4f4bf05e540, 0x6cc512492b043395, 0xc8c62d21a133cfbe, 0x4e966a4afe84a6bc, 0xd6b0bfc61a5f540a, 0x28cf6e26a615d838, 0x4fc6aad267fa7be3, 0x470a3734fb4c694c, 0xef500d202c3d830f, 0x22fb011bdf5ea8d9, 0xe715e9e60312f587, 0x7943ddac66b695cf
+, 0x538d58804c157f82, 0x437c9b6245092bf9, 0x63b185f70f2dd59f, 0x3bbccdc4e4f11557, 0x549ad136ba4ed41d, 0x4aa42995963972af, 0x88729b88983c5715, 0x48ac4bc111d9817e, 0x1ad540b4ce656f37, 0x324983479fdf93b1, 0xe45f0370079739e4, 0x233169d082ed5d4b
+, 0x0eb73ce4ec6b0ea3, 0x745c95fd84ec68fa, 0x9c9157d40a7c9141, 0x1f72a031e5931674, 0x888d7bb97c3bc9c0, 0x6bfbc725afc225c1, 0x9cd919c0e2b42bf3, 0x1e7f7d5ff17a36d9, 0x6267f8ff7769775c, 0x059605297d6fd836, 0xece0f4be124dd154, 0x179bc450025e30c6
+, 0x6c68c3e35bbe5f91, 0x0ed93420a3b2cba3, 0x184886dec9cfd5c8, 0x1f2b145a77d93746, 0x4526477407a56c3f, 0x6d7dfa09786b95c1, 0xf4e2da3ff9456eb6, 0x32b79429a654fbe0, 0xec7fae94fc3b7b69, 0x2a7d5109c99bb537, 0xe75b7fa65830bbc0, 0x6e3fcec66da06686
+, 0xd2eb3737232bf56f, 0x6268ef9cd9840a63, 0x18f2803e5aca269b, 0x68fc7cb2ee1a2355, 0x6594cb5d74268a39, 0x37ae89472920a037, 0xfc0c07ddb787fa21, 0x3cac976b817da3d2, 0x5b717b3d796487e4, 0x70639e2c58c539c3, 0x11efaf81b71898c4, 0x13bc390394081de0
+, 0xbe2549fe47383ad9, 0x1e268585641f3ea1, 0x0fe1876255dd2d25, 0x50909d924197a2c5, 0xc0089b7914154cc5, 0x43f02b129d5db1c6, 0xaf4df7b35706c518, 0x6bc6bbaf47d38181, 0x9a70c0df738712b7, 0x75aa709270ded51a, 0xfaaf294b2b51422d, 0x17bea55eb52fb86c
+, 0x8060895cf5e76e7a, 0x64f6460170f6c4c9, 0x0e44721e49ef5dc5, 0x305d8d13b4663408, 0x5a9b971913b7e44b, 0x17794fdaed51b14e, 0xc963e2cddc06418c, 0x211cc7027c9cb2c9, 0x56dc79e6b607c429, 0x60f0cd40d3a99afe, 0x7e657f3e99d736ac, 0x4360dc2ab2d0180f
+, 0x7cb7680c0b89256a, 0x240c78245efe556e, 0x4e91146daf0470b8, 0x1966a3bebaba5a16, 0x1025e4425068a0e8, 0x07888e6225ca4e0f, 0xf604f2b7ae939c17, 0x62cfff292078ff4f, 0xd91466d7407050f8, 0x1c300728760f68c3, 0xce6ef0e5db6243ba, 0x51b129992f9ddb86
+, 0x295db74bbc966b85, 0x295014132f00f9dc, 0xe7ec781022b57f86, 0x5ace053afa0d0b52, 0x69786e7bf87d508a, 0x6f32a07935f9ddc6, 0x8a28ca8d7f2c9c48, 0x37a8a7ec13577d24, 0x695e2b8d4d0e40ed, 0x0932aff3d5b8bd82, 0x427b842ec3764b47, 0x06a40f0d7afddb2e
+, 0xb8e62253fbeaff82, 0x10afed90338cd2bd, 0x95ec1105a9b178ba, 0x74ffafe3a27aaa04, 0x6f6ea9c745944946, 0x5ea06d497f49468e, 0x6284795bebd45964, 0x2062e5a26411e78a, 0x7238be6455161abc, 0x7e68a215fd69797c, 0xab6a593d49ab52e7, 0x547fe632eeddf736
+, 0xfceb4127487dc166, 0x524c6c79ff709ef6, 0x64e40303dbdb4042, 0x247a5c6e7c6e590c, 0x8b97cf9a942cf7e0, 0x247272c78e5f413e, 0xad77841c9d581342, 0x2f5dea067c5431ec, 0xeddea1542913d613, 0x5f89daccd5794823, 0x040982b8d7f7c776, 0x5183a7786468e613
+, 0x539cab5bb4b0e625, 0x4723abb8e3f075ec, 0xb8d92dd2bc2080bf, 0x68f16d11f00aa164, 0x77ccb1fcdb3a8e01, 0x1aff833329dfa5e4, 0xa60e306cb30d20f6, 0x678415929865f588, 0x51aef3c32b21c6cd, 0x373bfda7683644d5, 0x9f01a7de52fbfbda, 0x2abbe712fe2256f4
+, 0xeda569821a846336, 0x009a826aa6c1206e, 0xb178d0a86c78c281, 0x013f2fef0694f228, 0xafc22979e34a2d9a, 0x585022c033a6169d, 0x1188cc20e44bb315, 0x0a9acf039d589d12, 0xa54a40a209e9b00f, 0x07ff49e100d18e68, 0x0be752b7f7c5e426, 0x6a18ad2ec3d38d05
+, 0x8ebb362ab30540d1, 0x7cb33e4227a278cd, 0x3d41bac6410a5a01, 0x51c0844b4ba754e6, 0xb66f401ff10ad4f7, 0x739fe61eccd7c8d6, 0xf09deca612569689, 0x78372ff703f26f6c, 0x539ae7b1e0b8c9f7, 0x24a808e93ae98eb2, 0xd3caa21fa86a8ba9, 0x2d709fb48a641828
+, 0x2d069ed18440902a, 0x0ec3648b949e740a, 0x2fcb7b692108c8d4, 0x13ba5800dc8a35e8, 0x955cd07f4a8c6c09, 0x1f226862ad37898f, 0xc47d1608491cfe47, 0x1ee5742c421f9880, 0xce65020d5b901477, 0x696f89d495273b2e, 0x80866b24fcd0cade, 0x6bcdbc948b3334a5
+, 0x598d433fd96d66d8, 0x0e4f2b5b7fa8d62e, 0x49966da0673d46c6, 0x3be379b00b6dc210, 0x7f30841759fc490d, 0x340c39c3e4077170, 0x6bd164e87d194b27, 0x71aa5a4f7a886635, 0x468da7e01f703b94, 0x039c8ac77922153e, 0x7b93c434e2aa94e8, 0x2a1bbf50838b59e2
+, 0x71340295934f9290, 0x1a31ffdcbb672a0e, 0xdb4800b4c6cfe81d, 0x38adddd25bd940fb, 0x77f8c4b055873207, 0x4026a03ac4b41c6c, 0x58b857b3335e9d33, 0x3efa100c7d48c4b7, 0x39106c2f91074ce7, 0x225de04b4f835d91, 0xd5659ec6d46ba7ca, 0x2263299c6a49c5d3
+, 0x1927a570ca8593c1, 0x6a45eff78d9994bc, 0xefa9b0daa633e4cf, 0x4759b215b1b7343f, 0x0a8b2e22f3c79c4d, 0x5ba14138c76b1efb, 0x77dc3b67811a22ca, 0x71cbbeb5ec4fff2f, 0x91a99bff77f59dd7, 0x385d1092827b42d5, 0x3206da1a8f6147a8, 0x25b0b72054906547
+, 0x653a64249e5e151f, 0x4a7d2019c8a57184, 0x2f127ab57769a789, 0x0990dcdf0e80005a, 0xcc1e32f7da9d40c5, 0x4255767ceb9bab6b, 0x9db3e99a328c4ad5, 0x57899f6e42dc5d0b, 0xd7b226ef724bb39c, 0x32ba767d80e9f3a5, 0x6371b72ea63312a3, 0x1683eea5e843ea8f
+, 0xfc8075df1ea60f72, 0x3c63ad23fc7e203c, 0x914845dc4eaef195, 0x7bde34d1bfbc1055, 0xba1bfc0f767f9273, 0x71d2b1840421f639, 0x8a09f71ee59ee8d1, 0x56712d9139d7c545, 0x899424045ea9b2d0, 0x342a66e69b1a2142, 0xfb2502916eee317e, 0x44abc84b52a45ed2
+, 0x6ce4b509c377bcee, 0x35976377191c077c, 0x74ad4827eb17dfa7, 0x6e98868353beb3f6, 0xfdd18a8296743e94, 0x767658d6dffb28b4, 0xa35f1ae2c61b2b70, 0x5e88f17793776d71, 0xb562d09e34647c69, 0x3d840c4c3b89bd97, 0x1b68cd77af7ab2f4, 0x70b69ffbce0e24d8
+, 0x46fdab05056bee34, 0x7c29b9e8640909d2, 0xb06d5389e22623c4, 0x37929f9bb39dfde4, 0x1c55c7b78d218016, 0x2c945d93f2387b1a, 0xa5b43571f0c1a128, 0x2cafa421a534cbe1, 0x2b23b25caf96c7d1, 0x363f71f1a5897d67, 0x755a19caa788249a, 0x38a71ea9b7817bd4
+, 0x6d96a9759c0ed3b0, 0x44db31dc5f8b1d3b, 0x982c2396cb5eee8a, 0x242ef877e8a56feb, 0xe7ca8c25a1c073fe, 0x5931fe4157530e5a, 0x8c610daa24ea7eab, 0x07e58f3b17a700c5, 0xf8ec8db68ff3b97a, 0x3f940c048894a884, 0xbbf686f07e71c942, 0x725bdd8a8ef6390a
+, 0xd7594eb999654522, 0x1b2d290f439e6080, 0x7ac84e35d4fbfbf9, 0x75181fcd98c0b43c, 0x955f32ebdf913909, 0x546ea7db4e524d1e, 0xbdccbf5be35880ec, 0x417ec8c023abd78e, 0x7ffb372714140d9e, 0x15fd22ba84d16611, 0x274dc7f0c441f0dd, 0x2b3299784d465e61
+, 0xd0bdecf7a937f380, 0x49ca43e38a8c3b4f, 0x58f2791556ae6a7c, 0x168b34393328c015, 0xba23cf8a8513a135, 0x2bf407de05a30001, 0xad66bfb476e0219f, 0x1fd83c5e5395f5fa, 0xf84961f47f07aded, 0x7471a8f8ac41aa7b, 0xec5355f7f710adaf, 0x061660c437e46704
+, 0xd68f2382bf20983a, 0x7bfb958e3a4affad, 0x0cc5cbeadd24bd2f, 0x38bacda1afa66e78, 0x80157bb4078ce412, 0x070351b2064fa5a3, 0x59eab55b393e0e0c, 0x3fd5778f99d79d27, 0xd6d5a708959c85da, 0x27856c018aa7270f, 0x0f5e13501daa9120, 0x4b4d1e22447ed3f6
+, 0xd75bc467e4460b13, 0x47b2a5f667687ec6, 0x59131ab983415bfe, 0x4ceb053026361ef4, 0xa499ef31887f008b, 0x356b38289b7ce23b, 0xf6f1f76098d50d39, 0x776fc03940e881df, 0x67db598f9871cdec, 0x231bba3ba4e48d7f, 0xb503623673ffff79, 0x28ea7d9855c36333
+, 0xd800ffa491c2dfe8, 0x525a18302bff9b20, 0x3e0605334d9408f9, 0x12af479407b9071f, 0xd005c0450dfd6064, 0x79ac78e3cbbb57bb, 0xdd5a96b017d151db, 0x03083f8f80a29dbe, 0x59e10fbc58364d2e, 0x4ee18b0858d45e49, 0xc2cadd28d380ed69, 0x664b16e58b06ea4a
+, 0x7ed820e0648378f2, 0x0426a427fb7371ad, 0x1e590e8b5deb1e75, 0x0108aa2b83685e12, 0x57a16912bdc1d555, 0x3b78bc0ae225decd, 0xd9be8771a4eecec6, 0x0e4c93b9923fd1a7, 0xbee242d28a079857, 0x152999c16aadf82f, 0x35f50140e41f68b4, 0x63779ff87e358b92
+, 0x09a35ce23fbda545, 0x0de23ddf6f92321d, 0x1909c1fffd939fff, 0x77ab5c8f768930e7, 0x78a344cce2c308f2, 0x76606d1ee339d0a4, 0xf42d356952a4d269, 0x4b230026f4b0b904, 0x0c8be167cca3f4b8, 0x32e0d7cd3e915b8d, 0xfb7df5601e935a49, 0x28de658b93c7e351
+, 0x92eff0dd52d5cce6, 0x5ebd44df36c2a998, 0x5400f221b4988985, 0x2a8c3ae99ae4d3ae, 0xde32e0bc5fd639cd, 0x7ad927fe7b2199b0, 0x0a78cabc3d85701f, 0x43fffa4875569208, 0xe7148058f7b79303, 0x541bc278e894d6a5, 0x4fa2a212aebb0950, 0x6b80c369755bed3c
+, 0xc398fa110d29e4a7, 0x20c1a3bfe87fe26f, 0x2c077eb814d88659, 0x4a36917f92ee3aca, 0xcf91cfdb5b55580a, 0x2b837cf195601033, 0xaeb9ce1095b0121e, 0x74e25d687adc17fe, 0xd00eb877c1ca2c16, 0x05adf3a99657db9e, 0x348f5f8a481c3781, 0x5a9c94942e173a58
+, 0x1a2b2ac4e2d273d9, 0x6c0c8925ce80bf56, 0x6fc21675fe913fb6, 0x63cc6fd67ec03dad, 0xf3af65558e10595e, 0x13564509bbcd6d5d, 0xcaf67eba263354b2, 0x4be08fda9f11570c, 0x3cff46b77c7e08ed, 0x29bcff8799c032c1, 0x1d4a3347120716a1, 0x69ea45863bf9048b
+, 0x02e8d47b82a7f8b1, 0x2613ea820f7c16f9, 0xc0e257fa8bd72648, 0x1b0df04f309e63e3, 0x21192f9530145e37, 0x32e1b7e7d8e40e58, 0xddfff18ee3d6644c, 0x3c9bf03869a44594, 0x9f59c6df9f087e2b, 0x1fb4cbbdbe766603, 0xa0ddcea7196eeef6, 0x2b7e67a1f4396e36
+, 0x3d79f91138fb089f, 0x78cb6752db950e4e, 0xccea28ae8931eb84, 0x1f56a7175a151f76, 0x94b2cdf8040c0aa6, 0x0e2481c7baf36847, 0x7258ac97aad9ece4, 0x02364d00153cc64a, 0xcefe3cdd3de88163, 0x56ce11bec8e05770, 0x41034da12762f9eb, 0x059c9f4248c6c6ca
+, 0x647ada362f9a1c8d, 0x264d5fc4592dc51c, 0xa1c58f861699a387, 0x0469da1c1ccd3e5b, 0x669eadca9cc204ab, 0x504f9acbf1e13e94, 0xe5f15d8b8a3e12de, 0x3c1c08754d74f9fd, 0xa10288d57a3103e4, 0x42b95cbf237e21ec, 0x992a82b1c72ac632, 0x528a2e5840f9fcca
+, 0xa58a06a03aaad237, 0x30fbd08dd70d3339, 0x18ce331c44f621f6, 0x36720da4bccfeb21, 0x78163eadf71e0ef8, 0x4abd136f95a2b1e2, 0xb6bd7f02808a4366, 0x7172699a0494a202, 0x35ca42b2bfa88c39, 0x3e89febeef81e731, 0xada80b015cbef30b, 0x228360bbf92c3800
+, 0x0ce2de43ce6abb74, 0x1f475715536f5306, 0xe37879120060fb43, 0x6e6a249a069b72b6, 0xe7e3c9656bbe5836, 0x5b9503fc757cf146, 0x4576eef6c01a388e, 0x399647799ed22867, 0x210e8cfb6b8ece90, 0x13ee3a3ac8baf67d, 0xd33b0cd543593dff, 0x0e0d86a9b7134299
+, 0x20e458609343f180, 0x3679390649fac3e3, 0x4f426c7a5d8c14bc, 0x1dd610c224dfd120, 0x19ef9812c33b3100, 0x255c6ce313695371, 0x999fb2b4bc88c97b, 0x5e814fd513e1369b, 0x5eca1cb96603bfab, 0x6cf83ffe325965e7, 0xd379360ab6a6c07a, 0x54acbed60c9a8277
+, 0xa0b62c968a050c8f, 0x7d40893c4f514a5d, 0xeb3197e6b0247f66, 0x3c9fe27e26b5b934, 0x33071e95d8667675, 0x140807302228ead1, 0x76159353dc472732, 0x726a9287c7f148be, 0xbe7258f20cf2df99, 0x7beb7a42190c5228, 0xae2d2c6f8b0c1735, 0x3c29e011204b818e
+, 0xdcb3ea62f0ab5e13, 0x5de093b588e6c70b, 0x8d5e3eeeda3fe744, 0x685db8860facfc32, 0x7d83059e8f4819a9, 0x65b2e76f708dc379, 0x3cde9eddb2a95a54, 0x29d39b73f1683ac7, 0x05340e9b4ed0fdba, 0x18f7b7b18040f9ee, 0x3df87af053b12e1e, 0x116e86d54f3f2ea2
+, 0xb23f54f06b25d9cf, 0x194f168be5143883, 0xc1eacee73f6ebc5a, 0x373b8c84b407876c, 0xa2965968427d5551, 0x79c303f1c91c2be4, 0xac1c4978c2532e15, 0x16359cf2982d2ac1, 0xbb689468e6f7f897, 0x363a44f100d34294, 0xdfccf92a574bf610, 0x22be3c46dedcc3e0
+, 0x4ab960dee83c5e04, 0x48a376f0f9c44832, 0x765956666402bb69, 0x16a22ab7f16b167b, 0xd3cfd433a64fa8ad, 0x2ba76aa749fe2655, 0x060acc390a8c1be3, 0x707cfbce42378464, 0xbfbccfd9a3a41c7b, 0x70981f1601716859, 0x37d1cf03cd0af7e1, 0x499e64f7f97f3082
+, 0xf385edb7c538f149, 0x5cbcbf1885f6c576, 0xa7c7652b94b69839, 0x5fd78c120929d321, 0xb7d462f01532b92a, 0x48e9cd48c17997c9, 0x731a0c0a2457497c, 0x080396e813a4fb5e, 0xc9039e9ada82a298, 0x6ab76ea21e196391, 0x9af1d422bccb2f13, 0x2330019c40c6d5d7
+, 0x7e4ad66a9dfb6b3e, 0x764aca55d8e751e3, 0x7bff25b69d1387d1, 0x33e6fb1a8b1b45e5, 0xbb58ddfa8c49b939, 0x65d5ea934887ebb7, 0x449b04a0256119a6, 0x21bd63fea7897f7d, 0x6b187bddc115c98e, 0x4be6e1240c6df8e8, 0x47dc96b72b3fda7a, 0x467952c71816b8d1
+, 0x58fed1496659a873, 0x34b98d7f9cf2f4fa, 0xb7360bfafdd27147, 0x1c9ba30a3939aaaf, 0xd746db26b1754c08, 0x3df3d8911586e564, 0x124201990af5db2d, 0x7b261599a5875175, 0xf8dbb285e246b695, 0x6f428d12564c46d4, 0x4d91788010fa6364, 0x3a73f1cd3aef7e4e
+, 0xdab5c8e79ba496a0, 0x1e1dca778aed2275, 0x636adc3a76904367, 0x3a4d759540e81b7a, 0xe1c71c5df5c82b11, 0x4e8980f08a5d7d10, 0x0c21746f013605cd, 0x17700bf1ba7ddf1c, 0x0844c9ea2e27f5f0, 0x6e077c3af467bb64, 0xd137e3db1e653b23, 0x26519fcc050dda84
+, 0xc597a1cad0cb5068, 0x1ccaab98b90feed2, 0x70470ceacd561e9e, 0x144493e8b6fc0775, 0xeff983d129d4c2e9, 0x3ed05d5be911bf54, 0x06b815785462bb84, 0x3d3ab0162cfe8115, 0xbe5220b705fce1e1, 0x387153c9e8b1f325, 0x70dc78945e717182, 0x7a80d66f964e658e
+, 0x8344fbe1e0787924, 0x0e8eefc90165c2da, 0x13487d0d03b105d4, 0x581c12abc17f14a0, 0xa611e686b5a03912, 0x4a07fe6277b42798, 0x7c6c935f5632c42d, 0x66be2550db9074de, 0xf951dc174e40da39, 0x4648ea003a5bf20f, 0xf7bda190046148cd, 0x2ea0a173e2a781a2
+, 0xec64feb2b7379fcc, 0x67e9d40c8847e02c, 0xcaac18fe69daaed5, 0x0f9645797da997b9, 0x25fd600c6f17d51a, 0x110dc7155cc5d450, 0x1bd51bc32b635410, 0x40640eabfa7d7f96, 0x15ae9e517f2e6a16, 0x62c307f8822a8fb0, 0xb21d60582ee4239f, 0x51993e91d16b8328
+, 0x1da7826e81ab4da7, 0x5d81c70e66b2b0fb, 0xdf389e27de322412, 0x4fa77d8c15d22bda, 0xe874d506f094d527, 0x782d34088df7b711, 0x1ff7ec0d9ad9d21e, 0x0266ea42f11ecc12, 0x40ae11b0ec09e3d8, 0x2c67bd99989685aa, 0x043c2316f96eb897, 0x560767d762535fc7
+, 0x00b0acce517e02fd, 0x28d9718a4f5656ba, 0x98c4cee0ca98876d, 0x083c202f892acf73, 0xe9e94d0524681713, 0x17ce676d0a9fb89e, 0xb8016d5b4cb2d3a7, 0x0f95cc4a69fb3d15, 0x18a62db16edfe660, 0x4b59cfbf55edb2f8, 0xfcdd1be59d01b725, 0x3255cb84de2dddef
+, 0x36aba7021962356e, 0x65386ba040f06f80, 0x5a6e4c609c51121f, 0x780dfdc1b60ce091, 0x6a8329e2da485bea, 0x00deee1735ab1e71, 0x14538202fec9c9ba, 0x0ef7a780bba24534, 0xda3e3cccfe672bd4, 0x116e20c7da4435d7, 0x1f7bf94ad1d63ec6, 0x1d0f58d0d16267db
+, 0xebb8fcfe8c3a8b1e, 0x3fb6330decbcb99e, 0xcb1b05d649697e75, 0x4dca16c789c7b79e, 0x4d5a211cb93c6661, 0x054a5dffbc9c712e, 0x68f76f848b70db5f, 0x44a7cdbb4cba5e1b, 0xf3072a0834a85e22, 0x3218cc6f0ee4a35a, 0x97dfcb196cc1f657, 0x5018ed9adb60aa0e
+, 0xe548840440f36005, 0x0d838349c7f85c66, 0xb82817b11bc1a546, 0x6f55f8aff9babef5, 0xbce69922a46ebe0d, 0x5e1bea0e83871d3d, 0x1c95868806f8e965, 0x4146fbf03d2529da, 0x67a6764867048c8e, 0x2f0b4eb8eecfbe90, 0xe88c4a4d568dcf06, 0x2c82c2784adc8cb1
+, 0xdda5ffb5967892be, 0x33dbb41228c61342, 0x3e1d20fd54e5d030, 0x0cd654d871a1bbec, 0xea77720db78ff6db, 0x40a6d7e847d01965, 0xa64ca0a3c8e5c549, 0x30d869163adb8409, 0xcc2ffa377a3726c8, 0x560dc01d1eafa764, 0x51e14025e4c3167b, 0x083521d8dde0dc65
+, 0x76d0107c6e148699, 0x51f94aea6dcc541e, 0x081e3dfce334b6f0, 0x3bea8cd8cc2c70a1, 0xbf339f93a7586fc5, 0x68f0c611143c7229, 0x7895999216363982, 0x0ba51b18622e09a9, 0xa948903f474a6dba, 0x2684789c25554f1c, 0x4c7193c045fd4490, 0x5beeac20786a7c0b
+, 0x7bca56dee11278bb, 0x250f302565c8cc99, 0x0251718488bc0a0a, 0x21a93842aa094fb6, 0x67bb3c8e4605b5d4, 0x2f36d3dd5b72d423, 0x467fb0c641dcf138, 0x3fff205cd78330c9, 0x41638f141577c327, 0x6bb10ac608b3800e, 0xc12980b12994b1e4, 0x2f4ced0b5957dadf
+, 0x21508c27d9f5b52b, 0x3c6d89af1886f5d3, 0xa6680afe4f98ae33, 0x1f443f714ad15888, 0x06dfceec728c3d5a, 0x50e484d28482cf6c, 0xb17a2818943942ca, 0x5cd738d51d447c1e, 0xf6e235c842244d60, 0x2816e3d24a20be51, 0xcdc67ff5f2a471df, 0x6f4e9acd93edc5c4
+, 0x3732aa1d3f945fd8, 0x5cdf2f309f761eb1, 0x1a459ddec69c1d88, 0x0c5f5a826f55d1dd, 0x481d1725463db335, 0x6be3320af2bb2635, 0xfe4293c4edafb933, 0x03f6ebe29395b79a, 0x00c5c46a744f6cc5, 0x5fb19d4e209653e4, 0x1e7d3df6e3dd266e, 0x5aa6884e0ffb2439
+, 0xacd2e25d2eae4fef, 0x07fe6beb821cd687, 0x6a4a485173b43916, 0x2d5eb679d435473a, 0x2e71dc3234b761e7, 0x4efad61012db4d1e, 0x6649694ed2d5e683, 0x3e888f801b81d8be, 0x1c2f80c45fcaf316, 0x33786201abe79617, 0x4b998d76549ac553, 0x2a51a8e5d5663150
+, 0x419f5ebf324064ad, 0x3dce0efbc90dfc34, 0xe14801c4c9ed3f24, 0x3ab9c7fda700d135, 0xebf522f767b6aae3, 0x17370005d10e7fad, 0xfe8c8369c5083a11, 0x2c0725acf87dd551, 0x72befa44fc7cfaad, 0x08fa6c78f6d2e955, 0xcfd8d6eefaf0f801, 0x7039fee03de6f9d3
+, 0xa339a41b5445a088, 0x5af12363ff1636e2, 0x3bdc27235931f995, 0x4b85a8d8dee31413, 0x7eec0efbf55d791c, 0x0f9fc3ac1ddcc56c, 0x40402b502564463f, 0x2303f70f0b2a7a9b, 0x272776f6d70fede2, 0x39af173c2a07ffd2, 0x776ecb11370a4e16, 0x4c82b62f5655527d
+, 0xbe5084373e4d3217, 0x078f25831dbb2216, 0x669f27e075f15ab4, 0x3551da22728d88c8, 0xef194c7f69e9d16d, 0x363f2cd8bf522583, 0xb0f746c2e33af98c, 0x555e8e05f0dd2de9, 0x3e90725f5d0ff3bc, 0x48d4961a222b536c, 0x1c26813847d36db8, 0x1f5f602ba45667ef
+, 0x1764492ab4d5b2ae, 0x0767301c7a51d72d, 0x6f2428a02e207e60, 0x6c18f932379bff8f, 0xabefbe2790fd42c7, 0x34238c5453384bd7, 0x60944ecbf991d0c3, 0x1e7e7bffa4cfe590, 0xd89f979cb1b4e232, 0x3a9d9c9f3c9f1a0c, 0xe57a9a01fdb43b3f, 0x184777a20e4bec47
+, 0xe0adf785d6f1adb6, 0x6ee46e49c6308a36, 0x901395e6682f54f0, 0x37e9f0e2ced0814a, 0x65e664d4922e93f0, 0x4f9df443815572d2, 0x963d60e277cd2ea9, 0x7e16119c6bfdf46b, 0xc8aa2d54476f58ce, 0x5a458bb547a3d6d7, 0xba6e670af43ecdd1, 0x2461ae59348045ce
+, 0xc3b60128be85c6fc, 0x452fdf7adfe32bb4, 0x921d28eade065e9c, 0x0d63ff144d96ca2c, 0xce6c5c502a179947, 0x4019de3a94889177, 0x37c19f4bd4839e69, 0x6cadf602e6deccbd, 0x5cfbd25d5740aa41, 0x3695dc456b69da47, 0x8be365db540c648c, 0x4d3ca65de8d12c86
+, 0xd19763986e59070f, 0x0cb8815e8b599d78, 0x3826eea61bfcbcf6, 0x49c6a46cefbe7916, 0xba2283199d33a289, 0x5fc5ab54fd11bc68, 0xbc695ccbfcfc3d98, 0x0c8bf28c0c2729cc, 0xb3337471f53bcf8f, 0x4a732c4b6036415c, 0x1a6cb2a0b5888348, 0x6cff7ac97a587102
+, 0xff8947f3a5f9547e, 0x2fd78c9a404dd315, 0x619a0fcdfc951f4d, 0x41b9f18ca148de12, 0x8f1b46a57af15000, 0x33b775a072737eed, 0x96d76c368835b141, 0x4bc17447de9430b7, 0x0b17213190e44bfb, 0x5528a61ff03db5db, 0x0f283c58d130a9c8, 0x3639f8e8ef4993c0
+, 0x7fded17bb00bc991, 0x1057b6d176724be2, 0x1937e97a8b7ab05d, 0x3cfe8b9608d548d1, 0xda36d9f7c5f04469, 0x63a5a9bef9930a73, 0x9b67a168f0b332ab, 0x0680565222dffcd8, 0xe44012cd3f2b9a54, 0x20c28e50fbd68966, 0xfb512377dd4b8cb4, 0x7cb8939ad9a319d3
+, 0x844e9de5c39412dd, 0x4aeefe90fe76e75d, 0x5f74e4b13fe0f17a, 0x43dab5142363b16e, 0xf3d88fa50ad80c86, 0x6a7fbcedcf25678d, 0x91fecddabde5d630, 0x2d15f667cfdd8938, 0xf896175bb17f10a6, 0x0cf8b89634292455, 0x24e8a6e763eadf02, 0x541fa60969cac305
+, 0xb3b8bca0df8b5854, 0x2938c67166be27dc, 0x105a72e1e3d0a7ff, 0x55e745cce8c165e7, 0x6549964151fb3742, 0x1eaaa3f73f7542b3, 0xea0c78a42d5dbde5, 0x7a7f1a4eba8d475c, 0xabda4ac3ff2aa84b, 0x6634c55ed041d526, 0x9679d2b251e1b441, 0x48a4af65df87e995
+, 0x81c33c0714fff242, 0x5838642feb9babe1, 0xff30817284203b4e, 0x72023e99e27c79a2, 0xd87932e011f2d56c, 0x672e872a0fdf618c, 0xb5b68de3cddd43a6, 0x2a8e81bc4b2dcbe4, 0x79e76207ef0bdd6f, 0x0408a48630671a66, 0xb7b3dd45b7b7d66b, 0x5ccc2445ab2c91a9
+, 0xb5f65a6a3c7a4cb5, 0x79e5660c93ed8195, 0x53c0b688fa8118f6, 0x242db806984edc39, 0x1ee89871963c45b0, 0x00f6437392e18bf9, 0x6c8621f91a4cdd7b, 0x35bf8d294e4ae772, 0x2ebfda8d3f825723, 0x16bea470fbd887a7, 0x43b1679b28fc4b86, 0x60d0f64ca5962571
+, 0xe28b643b97f65f77, 0x7c17d8835cb47230, 0x7042570748bcfefc, 0x583bd269323482f4, 0x87f2960a3adb257e, 0x3c3cab5f3b3299b0, 0x1fbeba8772a02586, 0x34c27ac5b80e7172, 0xf58ac8a07d819b56, 0x2167a69dc8855c98, 0x0526c74c4822237d, 0x01084afdc085f88d
+, 0xa5f58cc07839cc9c, 0x7a2ca5c15bfbb327, 0x451187ce78ae2430, 0x2b15307e5c01dbd0, 0xecd16e2d503b150b, 0x09f053b80f79676e, 0x1f1f73f6019c7471, 0x56bf65d2062b1b75, 0x2430b713f2504a00, 0x76d46b89c9866c30, 0x751dbc8ebc6c54f9, 0x3b39cbb8d49b015a
+, 0xf284091fa11bf81a, 0x65d9997df76b1798, 0x65add8c4ee9be48c, 0x22937d81bcec24af, 0x7996ffaad97fe8eb, 0x282a8be9193e6eb2, 0xdaa3be34a1cbe985, 0x6969dc04a13e71f8, 0x5cf0c4f5fe436c48, 0x348016cfe27a5390, 0xeedffee895d7a931, 0x0473877b3375885b
+, 0x21ad1b2f17ca74f9, 0x2ae2b47c49f5c337, 0x7ac5b5402fcafb65, 0x05480c15e59e08a3, 0x946256243d950f19, 0x048cf0b3c7649d84, 0x67744d37d3d62a3a, 0x2a9c348b9d057fa0, 0x4eb77e2976353924, 0x73a087c9a8130d9a, 0x468f945e33dede32, 0x4187d752de72e3d1
+, 0xffd9ab2e4088d201, 0x4e1327f60e342d03, 0xeafe1724a5754c14, 0x217d58715be024c5, 0xda104cd066393600, 0x205f58230fc92cd8, 0x48a725895f7c80f8, 0x726170be376de984, 0x2ab89533ca65b597, 0x7fd1ef0e888b7619, 0x1d41c7fe965d7912, 0x12857036fbc27923
+, 0xcf5ec34c378541ae, 0x0cc142442c01c131, 0x8a6047bbd965c826, 0x27a1d29947d141d5, 0xb827a60cab3cfd5a, 0x7254149828b64036, 0x6361e209a9b83c96, 0x335c609a656a1558, 0xdca0ac166512cda8, 0x16ba5a97952025a8, 0x0fd1adbf81803042, 0x439f6d448c787a09
+, 0xa191a2cdf2c1638e, 0x08807fce1a54edc7, 0x06e38d59bc8e3d6b, 0x72cdcbdccfc665e5, 0xaec7b0a11b97c65b, 0x1b34c4714c711955, 0x8d410951f5f4fd65, 0x2067aeb15030cd76, 0x0434aec6ea7a1464, 0x726419010f15cd35, 0x4a501b9191e1f8d3, 0x1c9fe02a1197db5e
+, 0xd9c7a96e37ed349e, 0x64b158cfd1650ace, 0x68057289cb64cad5, 0x402af90c8a8b9e5e, 0xa057a594fe19940b, 0x31e56f58abf14e3d, 0x6bec23c5628cac78, 0x79585128880152bc, 0xaf93ec4c93d6dd8f, 0x08a848a5e1a7984f, 0x536b6abffdb5f1bf, 0x5035a1aa3a6e791b
+, 0x316f7ea09c1ef100, 0x436ab06411f9f86c, 0x6bfff1b710e6080b, 0x1c1f59205665d273, 0x926f0926451a44fe, 0x1f7160d46c1c9663, 0x0c89cf798d9317d9, 0x7599dcce7e0ec38e, 0x89e04df3f90fe2e6, 0x55ec933b6912480f, 0xf2afc53e64dd4ae8, 0x3a2b57d18f084b25
+, 0xbb5f9e6277613de4, 0x2599cc17a4aa0081, 0xdf468f720c32a497, 0x272afa7099ed2bf3, 0x738a05adbf17214f, 0x169a7c47be314b22, 0x2423c475ab03e434, 0x1fb1dd9037e2c669, 0xb3258f692db4c54a, 0x0d4777826a2707fa, 0xe9983b5f655a5141, 0x30b9e40a6ba87997
+, 0xa5180294a917292a, 0x127d639a2810531d, 0x9da6664005a4b53e, 0x2443ac8ef7c10a10, 0x32fac6b26beff3e4, 0x28e65488db6b53a4, 0x0e88c9165ed935eb, 0x1d59c2a28283cdf3, 0x5431e305a40ccece, 0x4ac5b37d5878a4e7, 0x5f1b23bd7e8d0153, 0x7219acf4cdaba595
+, 0x139beca6d5c2f818, 0x04ed66d69ca62075, 0x2b793ba7b8d698a3, 0x78f0cd5d28b9069c, 0xe1b28a2c58401d45, 0x4ea09470bc39c5fe, 0xdbf48f1657411117, 0x32885c681d502a66, 0x19d0ddb4187f4a77, 0x3cbb10f718229e76, 0x4dfbe9a3a03c9455, 0x762586851d8588c6
+, 0x3fde7bd4ec4b8d67, 0x4629e0809d14e810, 0x13073750b6fbcc0b, 0x238cdfca6f899b07, 0xa71fc049773eda95, 0x7a01cb6e050ab4d4, 0xd88de06c443b64f8, 0x169286a4da9a40bd, 0xd709732403e83458, 0x34decdccc7a69d41, 0xaba8a91b2abdb4f2, 0x7e55f12c601c4365
+, 0x512cae7e5e7a8a89, 0x61de47230eb723cf, 0xbe8c8cb8eefbb288, 0x0a4e336068ccec7a, 0xda799d139b176cbb, 0x1adc3282368d67ec, 0x32d1ce72ab69b46c, 0x6754332c290c3b15, 0xd297bcaf568c196f, 0x4aa9e1f2f89fca1f, 0xf17676f119920c06, 0x7c12d470ff062747
+, 0x66a3ced9f7e2dcac, 0x0a47df03cc156556, 0xfe93f872a05fceec, 0x258d189ec06245f0, 0x2fac196d3dd88184, 0x6683a3decfde7189, 0x3c532717f5e49446, 0x242debb8da940832, 0x3652192743183079, 0x4bde2ebf090c4f7a, 0x20299f05f32580f0, 0x053fbb546f3d0588
+, 0x5d58c8c3e8d3b5e6, 0x37f372d8d200847f, 0x924f2ce5a905a3e5, 0x43948ddb17c69ee3, 0xa5e2c3a49beebe02, 0x492e3adeb72d39fb, 0x5252e7976f0ed9fc, 0x46074cafaff864b5, 0x6319e6b536569b67, 0x2bccd1e6a008bce9, 0xae8aba1b6a430f43, 0x26846c6d8833a79c
+, 0x04cc90731831ecd5, 0x3d32a2b1d75540b8, 0x890587187274edf4, 0x44b17b0e9399e5cb, 0x4d45138d7c45058f, 0x556f25d588c39b8c, 0x52603d8ded1c8f37, 0x1ccd4a9e78d581af, 0x39868262c7ec3210, 0x0aeb724522c7eee6, 0x3dc39634a535b943, 0x3cf2605ea3af8a10
+, 0xfa2ab8fd674c4b85, 0x05bc2f50d41bf243, 0x4cad60798b9f8f07, 0x4b92fde4c5787228, 0x71995bf00035ce5e, 0x7832d147332210fa, 0xe9ff703a499ff539, 0x3bf50639a6194b2d, 0xea2da336b79ca6db, 0x7fca72c9da608c62, 0x5b115ae5a07e18a8, 0x5a44be5403a91bf4
+, 0xaf7c7e8c11418901, 0x065322eff861cef4, 0x7f44521ffa080f60, 0x2f481d5f0b48ed0a, 0x0f5ccede972bfaf4, 0x696babcfd8d4e7f7, 0xc62ef893a168b9c1, 0x07564b1d9cf887de, 0x7e5869111827cfb3, 0x6f91ee3439998874, 0x340314a80bbe4ab5, 0x63698ae1e917ebbb
+, 0xfc9a30e6a86da618, 0x28725c84c64eef91, 0x9c3fe6d9fdedd147, 0x42fc217248b18b24, 0xe8f5ce3043461215, 0x3021c82d09a245aa, 0x56bacc1d706b9210, 0x4ede7d40e5a84715, 0x27645963c1d59c15, 0x489b59bfd4d4e434, 0x234238e8cdefa55b, 0x667ebc2606b74d52
+, 0x63317aa88bbb0455, 0x20b32ac334191a5a, 0xa351dece7191b1c5, 0x5639780189218a45, 0x9fc7499b3f98f062, 0x413d2390efaec1b9, 0x372d585be3cb4260, 0x79fbb9163cc07d54, 0x1b0b95a893dfe90f, 0x25e91e6f3c5e6259, 0x831ebc6ad040d47b, 0x3d285317e6e5ed8d
+, 0x64e6c2081451a42b, 0x4eb6f3c05002a3fc, 0xa3743ee04b9c927e, 0x0c426ccac36ea11f, 0xcef5fcf345e448d6, 0x3d8fd9bc6347cce6, 0xdfd51be1778b6820, 0x2ebb5bd6c7131a60, 0x72fee24b94afb046, 0x4db26f0dc4568982, 0x00ef0dc56753276a, 0x27202233162bbe99
+, 0xe772738717ef9d3a, 0x30933201d33c1f4c, 0x0591100de4bdfbfa, 0x1fb42133c2a9d74d, 0xf9d565cd66474bd4, 0x7a47af5598fcb4e3, 0xafcf0bd8458ae623, 0x696837758622085d, 0xf886370a3c73a2b4, 0x54ec317d7d6495bd, 0x9d7881dcd96d424e, 0x7a00ca34931b5b1f
+, 0xfb63ab8f329895a3, 0x159e29af2a50819a, 0x7cdd647d1654cb48, 0x590359389a8e4e1a, 0x8012a0a5a445ca42, 0x5d869fcbb080244c, 0xbd589521d1da1597, 0x5eea52cae3505112, 0x426bd2b0ca3322ba, 0x4197b3dba300ce1a, 0xcd75ffea26c48465, 0x4ecc0b55a2990cb8
+, 0x7e37407b4e0a379c, 0x5b5de682bf9b9e92, 0x55b8290a656071c9, 0x4a35b31ac2f40dcc, 0x90e5179cd6dc1bad, 0x2f016555c79992e6, 0xdfe9b180a2efa1b5, 0x67d665cb6e02cd27, 0xc59c34f1c1e680c4, 0x257d6d5af1c1f28e, 0x571cd0e0fbe20b6a, 0x34e859b298746257
+, 0x0c024567d48b8fa5, 0x17ea0e4af1a00557, 0xe45363998caa137f, 0x13074e89ee2512f1, 0xe15f03b3e544df85, 0x3975d9918235f933, 0x9ad3a84fdc25afe5, 0x4076e8c24211c3e3, 0xc0c607facf45f634, 0x7e84acbd8580ed02, 0xe96a551c38c4b45d, 0x14678f06d12c7c01
+, 0x82cc764c28288e74, 0x287e11fc457718a3, 0x22f29fbe67ca3a5c, 0x3d4af235872dc865, 0x377048d135bace7e, 0x69bec9b1de14c1b2, 0xb0caa3734b7263f2, 0x0264d396d803a057, 0x20cf4db8a39caeec, 0x3e79ffd1f66b1cd7, 0x9f891c592f4bb86f, 0x4bae6506bd4f3ffe
+, 0xc195abe94e015213, 0x249125bd590a8eea, 0x38253a43a8aa37d9, 0x109934e307d48160, 0xdfa0579f7ab5fea0, 0x2e6a9d854c035e46, 0x55ce768e1d2725f5, 0x2e0a7836124ad637, 0xc7438167ccb1d552, 0x6d6eb4a0b44f8c8c, 0x5082078c798b8e1d, 0x7336808133955b60
+, 0x96ac0f712ef55ae7, 0x708d722e0fdab213, 0x2187851cdc944458, 0x62df5d087420e0fd, 0xed1405e07efed115, 0x39e253ce94b23367, 0x3c6ecc8df4049afe, 0x59840a8821d5e9bc, 0x63869936c0686072, 0x34e400aa8ae2e79b, 0xaef36bd1d60e14ed, 0x2c698228875d9f6b
+, 0x9dc352df81831fd5, 0x724e3b5ea9baaeee, 0x4e878f631f4389ff, 0x1212b1d266fab2f2, 0x8537e13bb90d34cc, 0x5fbd35cdbd1647ab, 0xad1e82d61974af72, 0x581d999e2020bee5, 0xe138d99ee3e3bf7e, 0x6ed7f618c7a24ba8, 0xbf55c120e0ec4041, 0x3c6ba2473852823a
+, 0xda84c8519373a42a, 0x0408a2ad7c55c605, 0x6c1712cef0f31a67, 0x479ac2891883c6c4, 0x1b12fda3d458b7f4, 0x13fbcfed074ec33a, 0xcfd1c2f72de861d2, 0x32aa67eb5efc1e2c, 0x82ede2494cd64806, 0x659efa81dc86c99c, 0xbb799c624d5f1c1b, 0x26dd5fdb27fb728d
+, 0xeaaebf50099e0ff4, 0x6d9a3570a46fff8c, 0xf92b76be9b930284, 0x544f9e97a68cca06, 0x0108aabb8a50a17f, 0x1b537496b1a56195, 0xdc381e877fa6a8b6, 0x32592be2f1f704ee, 0x7e3d034ef01c59db, 0x464313a02c2544cb, 0x0fdbcb033aef92d5, 0x02640af98fc5afea
+, 0x8ec6c3355e5d3cd3, 0x3f1062f8bc8345f8, 0xdb166631905828ff, 0x27812873eb442f7f, 0x930a6fc23e1b58f7, 0x578a5f0747ef5c54, 0x1df38dcfd4d70e1d, 0x098b3ed49373aad8, 0x0d1eccc7415849f8, 0x056d4336840b98d9, 0x682dd5a8e4324364, 0x643c5d3cc66e4f3c
+, 0xbd24fee825e36ee2, 0x0647e570d0ba04e2, 0x10475df826256cd9, 0x266893f2b301807c, 0x5c5f9e5ceb4f87bd, 0x1c195d0ecfc19fa4, 0x16b750e011c5c0ba, 0x2ca7cb7f57014d81, 0x478f0f5211b5f00b, 0x6c77f5a544ee20e3, 0x4c379cbf27019099, 0x3c66ff7d7a9cbece
+, 0xa9eba084891740bc, 0x46a675d2cc16077b, 0x9ae2ba6dba443b6f, 0x29183b9e1c135d19, 0x352bcc222842d838, 0x6d4c8026b1a3d450, 0x3349b4008e984833, 0x2f477a701b19ac38, 0x703ac92d7416d257, 0x1c457bdbf3715352, 0x8f741db83fb34cc5, 0x49f558b759b07e06
+, 0x9c8441a1f78e01f1, 0x09c28376b0584d3f, 0x0158034e6534f0dc, 0x6c9def3779f861b6, 0xd9fc04bc60d0e5e3, 0x7134d1aff6bd5de5, 0x0c0bf64ba53b5722, 0x63c59d2baac492a6, 0x0af03c36f8c8795e, 0x6bf43d5750c76170, 0xc9f9689514152723, 0x5a10d8c49bf118cb
+, 0xecf00f2476351644, 0x39edaca16a03a34b, 0x60cbb2be18b4cf99, 0x5da46e00168c37fe, 0x958c9bd164d9d65d, 0x4d65a468fa1f078c, 0xe613bf798388fd6f, 0x67789f890af3ed1c, 0x9211bf8a20a30170, 0x25e07885cdf6dd39, 0xd7f490d7e3755ab3, 0x298b53bb8c883e11
+, 0xebfbaf2504c4d1b6, 0x0c8bb45a3fbe703e, 0x68b233adb50bd996, 0x7ea4b653f8abc90c, 0x0997263c4e380753, 0x2801f4e26d57bdd0, 0x1875ae5f647c15a3, 0x76e16e03c8faac2a, 0xafc4fc9fb28dedad, 0x0d80dd674c99c237, 0x4a49f2a0f3bd1bb9, 0x00f1b209b0622957
+, 0x1639a04536cd2dc1, 0x2095ac1e9afb8183, 0x0273f1d987dba587, 0x40b9b18e8ebf08f6, 0x46c06a76d1d5f7e5, 0x76d60a6b2afedbfd, 0x71af575a32795b72, 0x4d52529fa5c9b090, 0xf4acd17843ec1b3d, 0x64ce24eca77be93b, 0xceced6da058a5dd8, 0x6f5ed55795f48c7f
+, 0x8f89fb9b81c8ac83, 0x16a814f5219d5d56, 0x31eb4fd9236623a2, 0x2fa6f0bf1ab4736e, 0x41452709513ee672, 0x18c8d0d4adcfefe6, 0xea20b1929a463d79, 0x0b6bcbc3e2e5b626, 0x3574fb4498ac78a9, 0x46227a8d1ad77dc7, 0x9d92d21d0e43ff77, 0x759f6719edc96f04
+, 0x357e2f0d4a3b5434, 0x22cc9b089ad970e3, 0x5c08b9e52775da53, 0x1a05a998b127add1, 0x631951bfbc12c77f, 0x57f0b36830eff8b3, 0xf4a964759b24fe40, 0x7f8556dbce4892f9, 0xf0e2a181d27b7459, 0x132d4de07c68ab47, 0x522f04d3dc99c60e, 0x47a95ad837f3068a
+, 0xe8c1f76933792f74, 0x31591ac9ab53fb8d, 0xfdd5bb5a62670a7f, 0x55ca034a1b5650fc, 0x1c2997953843a7a3, 0x02966940a54a0506, 0xefb508aab48c79d2, 0x3d08acd65b1dad39, 0x777099f6b18df4a3, 0x0712169e276bf0a8, 0x83c88a82d60bc9cd, 0x1e3afee19fca90ea
+, 0x1226bb72937d32c0, 0x460c6c1cc121c1bd, 0x794ed6281f0e9136, 0x5ad367233fb89e66, 0x17a31ee216f1745b, 0x6a7b19be220778da, 0x8feefe8201268a65, 0x2677bc41c94986ce, 0xbc30fcb6090bc7b6, 0x30d70fd5e092f8d4, 0x8826b950a51a6a89, 0x3287967156712279
+, 0x622a4da9a1ad791a, 0x69a4dea280af2c42, 0x818763db48c89d03, 0x36c5c7f45e3686f3, 0xde1d4dfcb8716a5a, 0x0cc2ca37c87398ca, 0x5e0679f5db2e9340, 0x170b550786bff6ce, 0xf09be4bae441bdab, 0x1f009538155f735f, 0x7e6799792adb6421, 0x74bb28419ac591df
+, 0xf984e97c242270d5, 0x1892071434ffa0da, 0x5fe21a68dd0efe66, 0x163b60bb14ec428c, 0x6a5ddeb73f4824d7, 0x401a8f06692a7b1b, 0xed9524ce339cb914, 0x0ff2525f10228744, 0xffc69550f3fe0331, 0x0a104e46caf5717d, 0x2c5cb0e8b162b137, 0x29cfb9da2a96de7c
+, 0x45698b0cdf1ef33c, 0x2c59abb91ea6c3d5, 0x46fe1d9379d85784, 0x56358467a44dda9f, 0xca4bfa9248af1d99, 0x0e1d0ea4c3c7ab60, 0x2a12daf43d640d3f, 0x4d9eec57b2f2c252, 0x28c7186651fa7dac, 0x471b9de1764092cd, 0xa00edf556ebbefca, 0x4b057abdebead3c5
+, 0xe287ac25506a5441, 0x127ebfdb343997c6, 0x5e7e27d75632ca23, 0x2d641ea810b3f260, 0x556a4d5e8680d21b, 0x5bc3f8a5522569c8, 0x13be2738ecd0f520, 0x35aa41c9451bd8eb, 0xab452e78a452b48c, 0x41a369025b1e63af, 0xf1a5e6b043bbbd46, 0x6e3287e259aa5a4a
+, 0xdf90628613fa06e4, 0x67d508bdad91f3be, 0x0f700fb1816360d5, 0x2a2eb91f2f5357ab, 0xb33e4d2ad59d10fd, 0x31590c98f811bc93, 0x4c0813e3fb663a06, 0x6efc0165a79b963e, 0xeafbee42c29364e0, 0x05a991ef7726c728, 0x5df6627b8e392a6a, 0x3e0874235ef2ce67
+, 0x1050fba63136806a, 0x418a801f1b467cce, 0x801578a3744cdc81, 0x39380fc26bfc9b26, 0xa7fbeae2c36b7403, 0x2e29192033ee7b11, 0xae3b1d56fb0bbb0d, 0x43333e6aa8b4d36c, 0x14b5f7d61f911ba1, 0x13acce1da422bc19, 0x1dee64866423086c, 0x0bd97af17629c3d4
+, 0x44a2c010b855f093, 0x3f803b92e951adcf, 0xf80cf6991ae800c9, 0x62866e56baf89111, 0x244f8aa1f3c98801, 0x240b4482b294375b, 0x7f79a2839e9489b0, 0x2897757f4c16ebb4, 0x5c2ec8cd5547cc74, 0x5e940e8ace3278b2, 0xc86bfd345ac2ba48, 0x7228b49524fa45d4
+, 0x0fe4375b857d9d98, 0x56b2387510532ef1, 0xe6963e1e2bb24682, 0x1fb6d1b91e2c4a0f, 0x13d9ab5c858fde8c, 0x0fbc46d5cc3cbfc0, 0x9f3bcde74ec1e2fa, 0x5d4079c8c3a8ce81, 0x1edb46e0c1dc8df2, 0x5426de0565a1bb79, 0x6e9e140902bc7844, 0x348243f708e9f2c8
+, 0xd7c95c1b46930fe9, 0x0897ac15d1c8cc48, 0x8754d14ee68b5a31, 0x3133ac96f4e943ad, 0x2f2ef30ecd89f0ae, 0x58d74d55aa331e01, 0x5f33f15f6cd55bc5, 0x6eedc6e2f50c0616, 0x67d189cc7b876b1f, 0x571e9cf2d31c5f98, 0x6a1f659a76c90dcb, 0x7ddb1c504183301b
+, 0xa0b3fee3e0619ba8, 0x5f192b3790ae08f9, 0x97e9dc29c036caef, 0x5db7ed7f6c35dec2, 0x9112935566251162, 0x126bbf8059c3aa22, 0x01ccad9edb1df904, 0x6136396a50d01fb9, 0xd59284250e524b78, 0x43a8c3a0c799c73d, 0xa21cf51e6839fd9a, 0x6b206706aa76c625
+, 0xc001587fbb5009da, 0x7f3640b7e518e19e, 0xb9a30ed2dc1584bb, 0x45d8d90e907a15c1, 0xa5ac0318e004c0ae, 0x1777af492510271f, 0x9f802b516754ac47, 0x2649446dfca5c19a, 0xeea42a28ab0d44fa, 0x6d8f67902e6e10fa, 0x35743649726c9a03, 0x2bd7ad3459246cc6
+, 0x12f69fa38124e3c1, 0x49c06411d71cb3c7, 0x9cb70b32e7f3fbc2, 0x3c5032c87c06d69d, 0x303dcc26ba109c48, 0x35cce1a9f699945f, 0xd709bca36dafc7af, 0x6591d9add4578b93, 0x77b799096c470cb0, 0x79d65bdecf9c8d4f, 0x315a7609e7cfabac, 0x761798105b0859c7
+, 0x080f696939352b0a, 0x7c63252c74af9ea3, 0xed24290c45fac706, 0x01005282b746a7ed, 0x863bd70346d2cf7b, 0x4d0df179ae66a6d3, 0x348860aba30459c0, 0x09de85a55f9cbb4d, 0x213cfa8bc9d82234, 0x4b95a19bd4e3645a, 0xb87d9f055d67b089, 0x0cd34dd4f2df29a6
+, 0xe4f9d33f966cae7f, 0x7d0bd5658e8052f0, 0xd81baaf6ceeee6f6, 0x17b0568650ee3914, 0xd1d941df7cda96e7, 0x3fe403633a361b20, 0x2ed21edf1a1cb920, 0x57106bfaef8f9fb4, 0x06373b39648f843f, 0x21d32ff51f6016b8, 0x8b42587f70e6180f, 0x69674b5e6a983d1b
+, 0xe82998a4da41435c, 0x1702efb209ca4c88, 0x273541a7a37f8cfe, 0x5fc305f8e8c5a92a, 0xc03e0de8d8b3061b, 0x077c7a83bcf21c95, 0xad7e5a5697d26137, 0x6e102f04b8fcc92c, 0x4647bc35ab49a1ed, 0x72339d8632dcefb0, 0x5bc32e3eb42529e0, 0x74a8737827ea6193
+, 0x9fa0c1cb1bca997b, 0x23b06a605f38a38b, 0xf4bdc9888395703c, 0x5bc279584ebb3617, 0xd63ebd76da811d46, 0x1818ee812e645281, 0xb4cfc0e93a5bc1d3, 0x64092d597b3bc19a, 0x351c8ee9ab944088, 0x71b971b6375beaf2, 0xea423e7dc0501170, 0x2130d63777358b04
+, 0x51d7d2430d53c669, 0x7cde3d0683fc9a15, 0x08d54ec8e95428ea, 0x4574feea74f414e0, 0xd656a617e6a61162, 0x6613fdc751f8cae7, 0x18841783822a085a, 0x7442352f667df952, 0xe40f32867a344054, 0x7a723a05654334b8, 0xac6975cbf1f3d2c1, 0x75971856b9256c06
+, 0x84b760aac8fcc75c, 0x6c6f73fa295d4e81, 0x1bd962027b2a1497, 0x74063277d8b98bf4, 0x78803e0c68d6a6de, 0x50f1027e9080f56d, 0x78c206b6a8d006a5, 0x58bd1f35b0140bc9, 0xbadc3228e2b3c752, 0x3dc3a794c895d1d2, 0x7f920ce8d13d46df, 0x7cf315d94f6281ac
+, 0x5e3b32cf166af9cf, 0x2f37a038c79dad03, 0x620306dafa499482, 0x598faae51ba90a53, 0xa376d09f3d35f8d6, 0x66d827cb81a0aef7, 0x5df138edf6cc5d84, 0x208acc13f747e1f2, 0x27760df08af0ac78, 0x3e9e079a0845960b, 0x88763b9109b5983a, 0x72d86a3ded203c4f
+, 0x40170d150a4c179e, 0x4fbc8a90b0efaedf, 0x585fe789ba3b6a34, 0x263b76fe3cb3aa62, 0x452f082d70621832, 0x337a1bddcfa5dce0, 0x702d41c6dfcc0c5d, 0x2664ce87f9bb3a0a, 0x456f8b9d4b39c228, 0x12b67d0add436885, 0xb88d6ce0cbbfb3f0, 0x63f07aab52ef0d38
+, 0x3a9432b985b08dea, 0x31a95e983ea6f241, 0x32f68960543f95de, 0x4a39b55544c5aa89, 0x0c33a879690382da, 0x6afccb7a7dc89936, 0x105c0cf03e335432, 0x1fe7fa0214e04cd3, 0x58774b89a5d97d0c, 0x7bc9baa23a50f03d, 0x2cf4845bb15f2a21, 0x002f370ba28e92d9
+, 0xf87331495bb202bc, 0x51a116a22a09be1c, 0x4b103e43779790e4, 0x4b81876e721a3a2d, 0x15f3364f9e7a3328, 0x6e781db5739a0f50, 0x33e7ccf9bf063cfd, 0x1672ba1aa7125ce4, 0x8740c17a6f7ba2a4, 0x25913a70089426e2, 0xca46a3ae4a9570d8, 0x56c188258b42853a
+, 0x880f9ae2acfa9104, 0x63e7e61481c27e28, 0xbd71f06457e9ec7c, 0x6592b2e7fd17fd2e, 0x2c27b1edc7880626, 0x1acb7bc9b0bb49d2, 0x83f919effe1fde1f, 0x7f011c7eb25a6b0d, 0x84dc8c577bda5de2, 0x34703a18a7949f09, 0x50baa0916bb8f1aa, 0x38befc001c612fbc
+, 0x4bbe5460b3189c77, 0x1a31df0cf967b7a7, 0x703c454dd727097f, 0x45a5f67738a9c6ca, 0x883634e66122858e, 0x6af6ab3b92da8fe1, 0x53cee1d82c62a8a8, 0x5e441f62603125fc, 0xd5210b8435cb48eb, 0x256fdbe2674aff51, 0x635ab92f648591c6, 0x11d90cb346e50ae2
+, 0x277d960f14387155, 0x7b232367bc7999d6, 0xbeadabb97a7ddbb6, 0x591edef70d0e8483, 0x16484aea65b20859, 0x39f576cd64c5655c, 0xd468723dff8a7528, 0x6ee5967f71cc76ba, 0x47d3f0c4b3f101da, 0x5d19d65af3170f87, 0x14830674fdb4a550, 0x6926b65e498a9fd9
+, 0x4b5db6c239a846b7, 0x52b54c308728c5be, 0xc1c8dd4c12bb3d2b, 0x700ee7eab36e3968, 0xf5ee562c5ba51348, 0x2b10991bb7edeccd, 0x3794feba5e25ae96, 0x7abbc4b9e09b2075, 0x441cade95d0429cf, 0x15cfd6d525dbd497, 0x07405bac35450685, 0x4b1f41357d8053f1
+, 0x9f9608ec9faafa9b, 0x2609ed04a7ca133d, 0x4478e73fcaa4e0b2, 0x72dbede31ca6d18c, 0xa48f24b7ae82e767, 0x7c61a63b423e4948, 0x15e417fbc8add36a, 0x4d7c833536315b37, 0xc89570b8a95f1961, 0x429135e06969b723, 0xb142e908e8cf5959, 0x4f3e554bf94034f7
+, 0x04c60ddb0d376e17, 0x55fbe4cce3695667, 0x20fa1777b0891514, 0x40eccd84e9b11b30, 0xad351aeeb58ab594, 0x4c3d8fb38d1cfa90, 0x30982a0454aa7860, 0x7809d80d2a1a8b53, 0xa23d2395a4bcd287, 0x1d985350e769f6fe, 0x74271ea490d082d4, 0x1e86655b3bfe83a6
+, 0x2f3251195ce0dfdb, 0x4e19067f966e77c9, 0x1168ee5c583238f0, 0x5363c918555e75fa, 0x6f225958ebb3f550, 0x2f7b54f0d71bda06, 0xb40f6e70b0e854ab, 0x0dcac98ed3ec1ed1, 0xcdf6a345ae1412a0, 0x5e7b2bdd7804d9e9, 0x8af7a760e18fc542, 0x4b724b3ee57ae50b
+, 0x35f0dc99f97d8eaf, 0x0483911bab9e8ba3, 0xe8e2f4c0baa960b8, 0x151d5548c825c427, 0x89db19b91ceb2c90, 0x244a36e3e4be28e7, 0x6f2868a85aa331cd, 0x79f2ccfabfccff24, 0xb346910be15d5f80, 0x319083271390745e, 0x62f8dacae02d5d66, 0x7899e03d85ff6983
+, 0x23127aaff0a956fa, 0x4148747217bd7e85, 0x2c7395638bf5cb3b, 0x24386b0950b00538, 0x7e4a93707c906932, 0x08e24e81ca3a151b, 0xc72649111e0ae13d, 0x0066f59f605d911b, 0xf2ef827fbf123df6, 0x167479be152bdebc, 0xb341db4e41db4a8b, 0x2a9b8b22812b8fed
+, 0xf8311712de588468, 0x64467f2c54ceaee8, 0xb374aebee092646d, 0x3cba975b09395f7e, 0x06ec5fa8be2a71b4, 0x3a274fc5a8e6ad5c, 0x401778f5ca6cf97b, 0x77722655e325b931, 0xc511111359f8b36b, 0x61f67a9292e3e8f2, 0x305dbc69a7dd5bb9, 0x728891b43bdc3184
+, 0x535cc3ec95ddd832, 0x39ad9f7c26bab998, 0x621544c940d3641a, 0x7750d1a360e6c8fd, 0xe3b2144bb1991c79, 0x005ce554e74f5283, 0x15089f8e8722bc00, 0x179c471708076fe3, 0x356e86a0bd63b599, 0x0f715a49b637f3df, 0x720102a773052f17, 0x17781eae5f581fa8
+, 0xd7e7ea4ac3ce3c8a, 0x442e17fa3c62d51c, 0x5d528d11264513fc, 0x6bb17aea0f3cc2e9, 0x474cf4b877ecaaeb, 0x031f707fede8f992, 0xac53da8a0fe10a91, 0x3c658f237bd768d3, 0xa04d137dfa1899e5, 0x1439c7b064292b2b, 0x0b465ed702cf5bdc, 0x2ee729c9da7fa825
+, 0x45c8c3494917ccfb, 0x2713baad76d30c98, 0xd02cd899276b5090, 0x3df83e35bdac6a35, 0x0b7df3a903b6ca8f, 0x01457f1c056947ef, 0xe231564221a80bd1, 0x6701d4e474cd9852, 0x3b3c7d4b40745a82, 0x79b2bf421d16fdce, 0xac0522c6d4c7734d, 0x08e7a99e788fac8f
+, 0x10d2af38df6cbb31, 0x3accef2c792e73e5, 0x6299598ed6715a40, 0x32e839bdf3a3fe2c, 0x974a9214593a91ac, 0x37febf856ff9ac66, 0x4dd0fb87139bc462, 0x7214d9072d1de187, 0x4bd97ad3a69507e1, 0x18c07a93e73fd413, 0xa4ceb2f02c4b2b13, 0x2450f6aba954c257
+, 0xd4af244079483c8b, 0x1f5416957685f9b4, 0x83d18bfac1e8dd71, 0x483cf499b8ba424d, 0x9d54384335b0abb1, 0x46c5ada1a909c972, 0x2e3f2da50ddf4b73, 0x193a82505f0b35fb, 0xb4ac61b9b64674b5, 0x68f6a7d51749a11d, 0x3e93ff29f9b52eb5, 0x0574ca69dbd3b1b0
+, 0x44b63ab4c297546d, 0x22201aa3c6906789, 0x3ea8d53f521904e1, 0x6943776252bbcdf1, 0xa0bbae416a6ad53e, 0x02f0e730d1b7bdfc, 0x701adb372261722c, 0x43a0216e1de72206, 0x0a5604ec7f0d2864, 0x4b107eb28fab64d2, 0x9340086649227227, 0x66a15838ebed44fd
+, 0x2b417e8623de0c34, 0x3033a04b7b79c079, 0x787fad76976978af, 0x647eda966158b44a, 0x5b5998a9c3df3951, 0x0fb7ed91a4784905, 0xbab84e1cd8f69a4e, 0x0acb6f3e3d0ed1c7, 0x38040c26cd62c772, 0x7e3448e98a319a76, 0xaa7125ca644fab0c, 0x61a0c72a95216dae
+, 0x1db1b4dfb255d097, 0x74e7e5dbe7fe724a, 0xf66fb375ea849d26, 0x3d298509c0bb9413, 0xd7ad1240e75a0eee, 0x5a3ad636008aec8f, 0x08406c6729de700b, 0x710829c76fb38f51, 0x343dff4e6b82cf46, 0x7f1f62845db070cc, 0x5d08d0a5aec13cd9, 0x705a2a2cdc4f922e
+, 0x86b1f7642e258879, 0x093824c1b33a2451, 0x988844466a70731d, 0x1de8d05ca8533a62, 0x75dd7ba65a64f40f, 0x04fc3e760a645f62, 0xf8bf1be0e4220e35, 0x0ccaa21af786cba8, 0x3987649322e97e7c, 0x7b7163199e0b7b3c, 0xf4822f0a30c8c0bd, 0x45ed15b48434fa71
+, 0xbbd05709aa1ededa, 0x2cc881f0f560da7f, 0x5a582cf3b5e9dc43, 0x7b44f608e46f426e, 0x5067e1554f0625a4, 0x3ebbaadb992a54f0, 0xcb922394e8f54ca2, 0x785c8b9b26618055, 0x2ec2721d715d8fd3, 0x11b4ceb388ece8d1, 0xed231bc9f02ee561, 0x338cb3bbded711ee
+, 0x40ce36bbd0b12650, 0x17a7074bc447b6a9, 0x865ecd6d35bca7df, 0x7089a47df1282375, 0x81f32f2ce9f86564, 0x7933c3465d72e9d4, 0x49034cec6e3c7a9d, 0x7a7587d6c123e839, 0xffd8cfc25c7ac825, 0x79f1cd880387ad6a, 0x79eef48a8574eb39, 0x3eb8be1f6fa631b1
+, 0x5726ce7f28349663, 0x1d45d5c816f8a780, 0xdbb89b29c9a1db88, 0x4bdd0d7dead66eb1, 0x1773a7240826a886, 0x7f8ada132074f82a, 0x39fbd90ca65ea978, 0x781fc0dee828176f, 0x68f867f2c5ba4698, 0x3d02bad0666132e4, 0x89fe61d27c66787b, 0x0923a57bd9bb90be
+, 0x61a785137f479a05, 0x6173202ca40e700f, 0x37a745c98d1629de, 0x18a9b87bcc8aa4d1, 0x412fc75f838ef5f0, 0x1970e51011b5f5c8, 0xa6a3cd79c8ce413d, 0x372821f6cc67e86a, 0x7d209947b7671ced, 0x6ca9e74fb20cc7be, 0x7bf2a64af4185744, 0x247e66a0fffcfe03
+, 0xf1365295032d19e6, 0x0d5f5c68b3edfb89, 0x33a896a3357af412, 0x19af85804ca4b82e, 0x8e01987ca212a73f, 0x70c98697c031655a, 0xd8c9e8d3444f24f9, 0x3bb7a050c8d32ab0, 0xaa29a28a8873db23, 0x03400a630ad99385, 0x7e541aee19ba7371, 0x7348e89853b1763b
+, 0x293ed9a1d0625f03, 0x6cb88f72ca2a2382, 0x70771ed2ec0d4a71, 0x45d95eeff6f51e7c, 0x40eaa6436d1bb20c, 0x0bba0e243ee39bca, 0x0b62e0f6cfd25445, 0x7e5b685fa2739272, 0x5a82a2d23d0a930e, 0x19fd6748d73ea7b5, 0xfbaa0d4e50785530, 0x0f4b5ffccf51b23e
+, 0x5b2e14dfa49334c1, 0x51c0c2a07fc556cf, 0x2925d2bf20631746, 0x44eeb11ff06e3d4a, 0x54cad18972329173, 0x60a896adb563dba1, 0xccee389b11a70be3, 0x3960e46a44a4057a, 0x160af09945b29c1e, 0x7d2a0aacb6720984, 0x01dffde8d95fc8ae, 0x6e5ce5c98304b7c7
+, 0xeafffa51b45a593e, 0x602faefd77c83676, 0x6ecfd6b91f179804, 0x45d5dd82be03467a, 0xfa258cc98d5ba075, 0x731e72c303d05dd3, 0xb45549a0a786748c, 0x7a6290aaa238969d, 0x79833dc3c1345447, 0x3593fc156d3bde13, 0x0dd529a0365b947c, 0x41184a4f2d014554
+, 0xb61ddeb5c7182cf5, 0x4e5e6c54a35f800f, 0x04d330b90cab9831, 0x05a2c78449751c56, 0xd5e50df2fc115610, 0x09b2ef59d1aa9421, 0xeafa21cb8c666d3b, 0x61dba57a582988a1, 0x0130dd226d250206, 0x05f8a4e092af7c39, 0x2d5eb0b77e28c9f5, 0x50a961b7bec79d3e
+, 0xeeb06227835494eb, 0x3c68413addacfacc, 0xc49a92692fa674ee, 0x080f19db222055eb, 0x62c65264c2376f1b, 0x5496ef61ecef12bf, 0xd1acf1d554ea82ea, 0x27c891b696d0380e, 0x18c5f2611636ee81, 0x364176eb863bec6c, 0xbeccce7b3499e329, 0x5de138c5cda5d9ec
+, 0x66a7d9e1499fe240, 0x67c102779bcbfb5f, 0x65b331d5dae236dd, 0x2ce0bd6c6f3f3258, 0x446a81dad4a0a56e, 0x7ec0bb4c039b7f65, 0xab58f627a8437c53, 0x7e0f06f2be6ccb0b, 0x430d8492f1a418d3, 0x15fc95b9c091bced, 0xda6ff892abb86386, 0x34a70179ca628c2d
+, 0xacfbfcee40de06a6, 0x697a0e0bb58667a0, 0xdaa8400f529adc45, 0x7c18098c29f1d951, 0x5e2c0b1eff393f6b, 0x43666c4c09888f15, 0x27e698beda78f0df, 0x426ee18e85578b19, 0xfda5dec675f15b01, 0x3047b6d28d097b9d, 0x65316f251c27a5d9, 0x27821b5ed8e2c785
+, 0xd31ce4af587424ec, 0x0fea4481e1db70cc, 0x0904f05cc04f0d77, 0x656fcc9d311e3223, 0xfc0fd7c6c60e212c, 0x769bbf1aa9c812d3, 0xe2ec6747313b5980, 0x07be18c71ba0bcb6, 0x88548162c1549745, 0x01f6102f05986ead, 0x4fc8b9e6f3119cf0, 0x4e1b63cc3f8fea56
+, 0x34c8a33002aad05e, 0x5c7d2045eaf35826, 0xad456c4ec9ad2620, 0x52e286b07b3a2b31, 0x88043523140f4cae, 0x4840cbc394cf3e96, 0x73825c2adadcb756, 0x772660ab125e334f, 0x6c39fee52fee3322, 0x6ec099070431e147, 0x5a6740606ae5b8ff, 0x21f91b98c2e88301
+, 0x517e0ff2487d8dc2, 0x6c1e3bc2d030cd45, 0x63c90fb72575f526, 0x37b03237aac6c5a5, 0x64f1665f82912d70, 0x02d686bb4ca20b6d, 0xa27e0057fb3e1edd, 0x5bf8830bcaea5cd2, 0xd6efed13765eb071, 0x05a6974278e442ec, 0x63dc573a4c4152d4, 0x4507615253d2b143
+, 0x2cc58c6432d8b372, 0x610567364cce868a, 0x33caff7c15d0a8dd, 0x159b70cce6c295dd, 0x6b6e29572c5612ed, 0x7ec8bb24cddd5c82, 0xa5c95dee165b6f08, 0x02a364f3ffcf5e9a, 0xcb780450469339b5, 0x00ce08884b02387b, 0xe5458be70bc02dda, 0x697e77fe53a18510
+, 0x36a632d1ff96c3b9, 0x3ee7d2f4b0a5845e, 0xa65dc1ba6bdc6771, 0x03c7f4622c90b582, 0x9a907fa885d8f410, 0x7c2783c8048984cf, 0x15be1e743306a43b, 0x3f6d509e1d639ba4, 0x1986f88884c816b8, 0x4af5b575512da75d, 0xebacd052a3e4e155, 0x7344e1a0c54e3d12
+, 0x9789e888311a2a7e, 0x3591cf74b1f3e0c4, 0x05521d8e59ff317e, 0x2a30306c0d40e4f6, 0x51baabbd8c0ddd34, 0x67c30eb3d50e9683, 0x81e29a2794a9d6d6, 0x648d1fa28dfb59c3, 0x5dbe332bea438966, 0x6651225daeddbbfd, 0x145428ef13504674, 0x12124c84a568f1aa
+, 0xb195ccb1137f001e, 0x496538a1bddfa8fa, 0x5403be989da8bb63, 0x53837f57517bf943, 0x2fc17991d57deffc, 0x3e7f28dda26c47f9, 0x594eb957da495965, 0x73dcf7f022084b6f, 0x120331eb79a8ca72, 0x1adac3070aa5e86a, 0xcfe6778b211385da, 0x794223fda90976d7
+, 0xe3c63aa91c4fbf5a, 0x3ce3ea863e3a8fd4, 0x63905923bc739565, 0x302f1bdf9d934011, 0x1c9002eb98037b4e, 0x7dd2a1e43fac026d, 0x716624eef93064d8, 0x57980c25923b85a8, 0xa2c28211dc09c4da, 0x57de28b7758cc1d0, 0x0bd06fedc1433c34, 0x6e7fdb3b0955759c
+, 0x2c31e2e3927c0c6f, 0x55379e4a3ba1402e, 0x3a9ec41390ee0db9, 0x5146687469ca2a06, 0x2ca867723f178204, 0x53d7fe4fb3ae7ad5, 0xc536b26b487e0ab4, 0x12f36b1b5a657a87, 0xbafc0a9943ab3402, 0x061c27e4553f6fa2, 0xd220a197c31a4489, 0x4152bbffa086fcd5
+, 0x92eed127c9422e90, 0x2d433099f69e8112, 0xdaad52ebfd707168, 0x6958990a301e9df1, 0x9113f74f1cca722f, 0x766b7836b58d3ba4, 0xddf8c6542c64fb30, 0x799f4b8531453148, 0x776ecbc2c45dcd4f, 0x79a33ce0c163f899, 0x894cbfb3ffc7790b, 0x00c8fce6ee151062
+, 0x5b2e4af784372b2b, 0x41a5a591dc47b575, 0xcc049eedbbb6564e, 0x1ee4639ed20e41c4, 0x71fb3d18c3b8b8e6, 0x2d9ee19881f59176, 0x182cea85623268af, 0x52c232312d49f4bc, 0x93d5ee7057e02063, 0x0a61c46005b22329, 0x1eef526a9e820326, 0x29b28c962731dfa5
+, 0x88c43044bcd549da, 0x39c3a2a42c358eb0, 0x449e1f28c2809bd6, 0x2a6f5cbbe1713080, 0x37e1661091deb396, 0x661a912131dc943b, 0xb973db517055ecaa, 0x366fd186572a2af4, 0x785013ede7d8dd61, 0x6f846b9593acb208, 0xe0ae73f9e4031037, 0x78f40beeb8a3a3b8
+, 0x2aa12f600ee6f4bf, 0x0a440bd5f5988d9f, 0xfe8d0606a10645a5, 0x3b79eb64e6483b02, 0x7e79518068bdaff9, 0x7b60fdb14beb6f4e, 0x6c590226f9dcee33, 0x3b9803099c02e2a2, 0x4399712db4d1a2fc, 0x2913d077c1c729cf, 0x67220f4b9b34b7f6, 0x22eec3ba474b305c
+, 0x06a557facfdcff86, 0x3a1c695c4aae79fe, 0xa6a8565bb39dfbeb, 0x6c93c06e8cacb292, 0x713e8844f8a56d1c, 0x3e8df4516b5c2b98, 0xe5cb7f6097c08812, 0x5df9c1e173600606, 0x011d9c353c453c8a, 0x73646981568a091a, 0x64e39fc506204ff3, 0x0925c3f803e93352
+, 0x576f940d1375ee3b, 0x286c3d82d56fc60a, 0xb1b9a3c2456c1b8e, 0x7424ef07c25f7bac, 0xd756dfda709b4ccf, 0x567b9797e8eac78c, 0x3172ac70b9f0a8cd, 0x31a3c7c86b6ecdd4, 0x9ed116cd5675a339, 0x7aa998b31026365a, 0x7869e859a2816f70, 0x7c69878ba7b0bdc6
+, 0x4fd27c8ce0938d51, 0x39e6a6f6997275f4, 0xdff04c7cdef255af, 0x728212c3e0dac595, 0x5e79e687182b2686, 0x3ec846e204a79544, 0x73502f50cf7a23ca, 0x7250e9ac357f7212, 0x1168ec85d7d98bc3, 0x066668b1a91e6d51, 0xa14d6d15ea8a5147, 0x3c257523e51e8ff6
+, 0x7c2df559b09deeb7, 0x48927f19b62c6942, 0x19b37797c7291a2a, 0x6063c3c406071a73, 0x842536da311322ac, 0x732e3f842f0af883, 0x0067e9a184913346, 0x37d715d9e0281656, 0x28bc98490f442a7b, 0x54f0f84dc74906d8, 0x783d3127dfad1736, 0x719e007233dc723e
+, 0x6d9207a10e348169, 0x1f01db4de5d02778, 0xde812ab3783a4362, 0x5261421ee67211a6, 0xbcc1dd0a4c0a2d80, 0x146b67f7736f82d4, 0x153c8bc8f6aae299, 0x23390956fc3e473c, 0x35c0dac6ac30d86c, 0x0f50c749c7e01691, 0xb4d704c4ac247b94, 0x4115bf535c853f2f
+, 0x348da9a0502c31e5, 0x62b7d47084111576, 0x7c8d600f7cd018c6, 0x03e0c96067f4f72d, 0x6d95a54d5978f0e9, 0x47a2160a5336751a, 0x8ea226bdfd32c9b8, 0x023ee780adb700dc, 0x92a899946f11d3a5, 0x02b1f69bce72f75f, 0x157465cdf64df988, 0x2279281418090e59
+, 0xafb4697e9ecdc426, 0x369395f19836ee7a, 0xc0035cac0ecd3fcd, 0x5f6d724696760c63, 0x663c33a897ec0f28, 0x2ea5bf2631e31fff, 0x6ab7dfb8db2c6633, 0x7d8a2aea460101a1, 0x836ad2bcc0c65b28, 0x2dc6e20d3bcf37f6, 0xa4656d06b805e3a0, 0x0594abf154cfc90e
+, 0xb4e5bd801b8048aa, 0x15f4348fbe0dde35, 0x29c665fa0f19c5d4, 0x0b1eddb71c36b24b, 0x3c2ab76f8857f300, 0x611c5745566cc8d8, 0xe6600999e0ff229f, 0x0b75faf1f90a2b68, 0x27785a05c7ebf700, 0x76ffbac269fe1c4b, 0x4636943773143f6b, 0x6d62e4b607ee2c01
+, 0x6ae1d6c3e1957194, 0x7d548fb4721d9c97, 0x0082690fa4f859b8, 0x5a542fca31920634, 0xb45d1c378f019c25, 0x7af3343677831634, 0xa5f08078c0157791, 0x678efaf6e8769e1d, 0xdbe148e64ec56cea, 0x3a4756c625c6a2c1, 0x1d743e826813fd4e, 0x59897b7a7002136a
+, 0xe75570e311854118, 0x1dbd6431ec82f0ee, 0x48fee2b13f0232fc, 0x31069c9d0541673b, 0xe0c42fc6e9989c3e, 0x05ce2de0bae0357c, 0xa62af20573142b36, 0x07de4355444f6414, 0x529e292dd4aa4d5b, 0x40190eef9de08e1c, 0x6cfcba764c333cfe, 0x1d979e2f3709e850
+, 0x4efd53496a2fb3d4, 0x4b3708de91a05a5d, 0xc41eb75518a12818, 0x19130a33caa15697, 0xc7c19fb44f3fffc0, 0x38671625dfb7db5e, 0x9e868879ab0e3bfd, 0x4a99003a2d511b8b, 0x5e6a2bfdfb861ad2, 0x54d2006e9ad9a65f, 0xb6a3d652b1ad7ff3, 0x3d40818924fc9271
+, 0x1425871c6cbfed81, 0x0e65e3f15c1bb619, 0xcb37628c65acf12c, 0x49fa5b05239353fa, 0xbc684c5148c7ed05, 0x407a65f886f319ee, 0x346a2b13f0a4cf02, 0x34be92fd15a7f648, 0x49e752dc23df4c15, 0x1dfd62dce5be9992, 0xcb413ee5fe90ef50, 0x6ad6149a8730e897
+, 0x09e1c4b61403c7d7, 0x5adf1fdf52df321a, 0x10335f9ac347169f, 0x2747dec2ade0d38f, 0xf3c067cb17cab6a1, 0x418a4d0837b6f5e7, 0x27f2468ea01a4283, 0x33638a63ed82700b, 0xa3033f3e81a50883, 0x0c9e3bf60b4d81eb, 0x8c6aaa153add5fab, 0x2e848e527e791f5a
+, 0x9bb13303b0a47fc1, 0x3d7ed63e001e03cf, 0xcd4fc1cb774a166d, 0x41c5fd5889f1e9d9, 0xa953be943a3f31c4, 0x60a111ee782918e7, 0xe19c507987b9933c, 0x251bff988dfaf375, 0xd55f2d6e8d1f5ea2, 0x7f0730f75ac61fb8, 0x51b259f8b05b1c33, 0x2b32d22f58a82ff8
+, 0x5dfeb800f7183ef5, 0x6bd6e0d7bee70f4f, 0x4b1e850fb3d59b09, 0x458d43c4dfee7a98, 0x7d0634160d397e30, 0x130792b49152acde, 0xb7f23261ff5e63d1, 0x027cf111ba5071bf, 0x9cde9992246b9b7a, 0x3c423634b9ccef17, 0xf145d4399133c925, 0x22f99c213acae8bf
+, 0xd8b6767e228aee95, 0x24aabe3f96b65364, 0xf3ab23609726b4e7, 0x75154f0803937bcd, 0xb2b0a8f92a0921bc, 0x6c0cfa9fc2642e44, 0xa2b3a9a4654fe1b6, 0x060a7b4344fb8406, 0x1626fd54aae3044f, 0x3630e4a9962568eb, 0x9b886da4679bd705, 0x70bd06005e8b4435
+, 0xe77fc0db3daca1e7, 0x01e4671e48c27756, 0x35c6e6e09815e5af, 0x02d07c32dd9d5b15, 0x9d98c2f1e529b8ae, 0x544254593f9cbbdb, 0x08a6d2932acb15ca, 0x66fbc392ec150083, 0xb07d0836d66006f8, 0x05c6c9f720a2caf8, 0xb1a5e059e3792966, 0x5f0f6dbcd27fe285
+, 0x5fe7c700b03e5229, 0x6eba501474f2fbdb, 0x03aa1ade1ac5aa81, 0x24942467bee7ec3e, 0x383e5ccd16d00331, 0x651ff2ccfb5c1ce6, 0xc50336d3142f911b, 0x3d8dc1b0f803ab3a, 0x7cc6d98c02155fc1, 0x4cba3349005bb04d, 0xe312960538075336, 0x2a67daae47ba4c81
+, 0x11967f46fa323fb1, 0x0874bd53235934e5, 0x45649b90699716f1, 0x1a4825f645617760, 0x116710751384300f, 0x31463533789ad8c7, 0x52bc3aa2d56c6375, 0x3de2c374627da8f6, 0xbae6ae7b6711bc07, 0x5b4f4616a6559783, 0xc74a8cf22ef5c8c1, 0x569a9a4308efd2a8
+, 0xb824f6cd042385f9, 0x69e5f4956b8b1aaf, 0x94828233b1c83eee, 0x6df15dcdf0872f22, 0xacfdbe494fc6f2d1, 0x3f4df82d0f8e4ad0, 0x793aadac5f437c2d, 0x0a54edc5f941271d, 0x0d079053ae2cd333, 0x08b7deb16c2ddae6, 0x5c87c44751d38b7f, 0x2120197637bf6a04
+, 0x47b8f429d96cd401, 0x2534b0a728b4a34e, 0x8cb1736e5ff712ae, 0x2ac5defd696699df, 0x884136146b60f01f, 0x2bb73e73227b29a5, 0x0b268d8f48e8808a, 0x3d3c8a0f17ea5275, 0x25f39978e72ae170, 0x363b55ac2a2bf830, 0xef9e2ed9cbbe5b5e, 0x5fa68fd84bb91f23
+, 0xe82c838f69cf54a4, 0x3c1f880d8891438f, 0x258110dc449a312c, 0x3db52a7a7fc71980, 0xe3762c695768afb8, 0x3891bd38f706c618, 0x210b40e21e3a8a83, 0x600eab1dc0aa42f1, 0x445f5c66d121e747, 0x1c3f4a7f84119115, 0xbe4006ba052389cb, 0x5e8124527b1c2767
+, 0x7a375645936bd61f, 0x2231df379c16e827, 0x62a2909b768159d2, 0x3d8c7849002aa06f, 0xea2dd4c13c26ff8b, 0x1efa86703f30323a, 0x0f66ff09d44d33a0, 0x418d44b0cf6439aa, 0xa0f68c020fad47a1, 0x1b343fca56713b57, 0x1def2177120f195b, 0x71ea6611f5082661
+, 0xe4457a4d60c2f4a5, 0x62b4e77b47b9ed9e, 0x196716a5394f337c, 0x13ee8d105ca9514a, 0x2d7d55d42cd70f84, 0x726350b1a00fb239, 0xc1a1e7c5c56333aa, 0x112daa5859812e33, 0x1110e94bd1d04afc, 0x40b08aa21684b049, 0x053e2822eebdd58b, 0x5826eac839eed4c5
+, 0x67efbdcf033ba5e0, 0x441713862dcce7b6, 0xb4df3f738ceb16ff, 0x1c27369be7a2d106, 0x442af89b9e744589, 0x4b7235b6e5c50cd3, 0x6d28b0aa42de5b05, 0x3552fb425e398b6f, 0xcd74863de033b405, 0x170a4e034900a3a9, 0x21fe938275c44d52, 0x03bf33a81330ccb4
+, 0xfcadfe23ed8ca526, 0x2b88ee7e4bee124b, 0x573ce9232184ee59, 0x15d982239df3b235, 0x545c9c7b903db502, 0x2d864def145d718d, 0x6a9ebcfee8a4b6c7, 0x3833da836cced419, 0x0a64d38073d6fab2, 0x4610143b3d38e3ac, 0x3abdcbee774c106f, 0x545b6975df8b3d8f
+, 0x7fd171d7c6eca25f, 0x2728b7157f93b0fe, 0xfbbc20e0a1eb2412, 0x6abc69dde6f34f13, 0xed44521c6996ee26, 0x79c7eb6d075a5d62, 0xde3e7b575438cca7, 0x66c9552ab3a0a74c, 0x1233ed3d3ae0d149, 0x533b17a040b81875, 0x6923ce5c84cab2d7, 0x4716e7b3a154cfc4
+, 0x2163588b1dc170fb, 0x796567a323d0152e, 0xc5ba9e34480e9865, 0x755c13329241f69a, 0x66d44c70a2cefb6a, 0x79477ce215bc2728, 0xe944069be59df8f5, 0x5871f75d87c68fc0, 0x2c2c3f09e573dafd, 0x0429b48e804c2715, 0x3dd5b8c5355a365a, 0x257101ae222483ac
+, 0x8b4073681f4feb0d, 0x79c82601e145c820, 0xaa53111ab428bacc, 0x65b8540149aff7e3, 0x21c79d7a58cae8e9, 0x3def2d27dd67cb9f, 0x30ca8760b51c67c4, 0x2da6444a764e5ba4, 0xa26f0e196a43532b, 0x7b5a026f247974fd, 0xc9bac9e4daec35df, 0x64b0c73188dc7410
+, 0xeaddd29c770c2699, 0x39a6da554f147004, 0x63926ae0a06f4a53, 0x408f3174aed07490, 0x0b869ff072e3e064, 0x65e082401d7fdb53, 0x1030747c44879d24, 0x72eb267f4ad7d5d1, 0xd6e895247458f711, 0x06ae9c6d41a689a6, 0x2e76ba4f37c343dd, 0x797c3149ba9cb7cb
+, 0xbd3248663dc307ae, 0x1b42691ef1e20dde, 0xca24f81169fac878, 0x3a542f85b67b4975, 0x6a543ce95ffa5c7e, 0x3fe85ae246515085, 0xeec245920044b5de, 0x2cb721cdddac1470, 0x1456e751723edefb, 0x0421782891d45e26, 0x528c1d5007e3706b, 0x1ad0adca9ab6b53b
+, 0x4e1846200789ce78, 0x3031a1e3f6135fc3, 0x7c3169f79334ed4b, 0x087488f658565e2a, 0xcb769e0fc9c9c5d3, 0x2e0783b91f49a12d, 0xfc84d4e706d35264, 0x45a2308d7f36f2bf, 0x3fa86240b5c6c388, 0x10d861431357b25f, 0x139326bfe0105f9e, 0x4b7ab391f565dd88
+, 0xf3fb41ec47365ee8, 0x2c355f0b1e00eae8, 0x53b1c02965efb548, 0x7027ef415bc80a58, 0x37673d1b0eac020e, 0x47c7dae52e817a0a, 0xc191cd905349cf4d, 0x29831fddf738c984, 0x9cd70af5fac394de, 0x26c571cbd7bc7fe5, 0x46e657001f7eb2f7, 0x40e71a11eb02eba5
+, 0x356af6898967c7e2, 0x795295d1ee9ac0cf, 0x3c8dd9bb546430eb, 0x098e0dea8f8d1d8e, 0x2a58d4c1cc6f248f, 0x77e109a3aadbb121, 0xbb39685c18032ebc, 0x5afa456d265f8d25, 0x410db756e32624a8, 0x3ccc2bfd56c9091b, 0x6185be9bd9bc3a5d, 0x5942f27c97f35d4d
+, 0xeb6f69e816ea08a6, 0x746fb2fe7eb37126, 0x832fe4c13f4f56d7, 0x358ead49e40c514d, 0xb3cdb552d605b01e, 0x373c96772f70edb3, 0x46a9f5f98b5a1917, 0x79cc83936bb108a2, 0xf8f1840f4572c570, 0x3e750a6090a468e1, 0x27dca561a9679906, 0x09578a0b92b5ca0c
+, 0xd8f2154a7977de7c, 0x7a64d41231441d59, 0xb72a50b7cd3750ed, 0x020ac2ae4822e6a0, 0xb95e2e3452d2e526, 0x13bace7df61fdb05, 0x3e0f0c733e26cfab, 0x207cd787a732c889, 0x77d0a345cbc73d6b, 0x77af80a1337a2f53, 0x86c12c8acf2d8d79, 0x7d80bd6c77cb9628
+, 0x6430d13c3b395e95, 0x2774be609f114a19, 0x6a07a05643a0e647, 0x4c7790b3fb2771a3, 0x1f0d8f08b5b28630, 0x42421f6ddf9e86ae, 0x409cec06c27cd4ad, 0x772296dec252266a, 0xa9931e6f8fd5dd71, 0x328955333fcb1e13, 0x11aabaa65bf385a1, 0x568ef7b6ee34ccd8
+, 0x228ec4530239e0a3, 0x0e6554bb51839cc1, 0x9aa69ed838dd2bc1, 0x6cdb048722626ae4, 0x019a0459f2245c85, 0x3bff22acf4385c48, 0x87e1ae5649b53cdd, 0x2f0ec9b1f2675e20, 0xcdfc275000ce9220, 0x6a91ca8270ef12e5, 0xd3d4977a1ec18702, 0x4f393943f7d5f027
+, 0xe350855ac9176a15, 0x6f731697a39495f5, 0xc81b747f0ca2a151, 0x52423522dcacf0d4, 0xf6e093beedfa3319, 0x159ecc4486fd9747, 0x83ec15e956206705, 0x6c99ac854584c073, 0x28316241a45a0027, 0x4f69633a9b3cacf9, 0x08603ed633cd0676, 0x02983aa2eff0d668
+, 0xb3637c17289f91a8, 0x6234cad2036aefc4, 0x46aa18df5bcd001a, 0x1e13bed4b9038d60, 0x71e5d18c48dbfbbe, 0x06abc5db17a99c77, 0x17c2d819525a37a7, 0x21359f5f80e83fa7, 0x7b656dc34e689d5d, 0x3105cb25c5dc4fe7, 0xeaacfd1bc98b00f3, 0x22cf8ef3d027ad1b
+, 0xa8bcd74942576400, 0x30b6fccff85c0c47, 0xb75897fd644873d3, 0x3f83839bef265910, 0xe0a2733eb2f294bd, 0x374866ec3b54ee3c, 0x126c74c66a26d019, 0x73e971718e6949c6, 0x71e473734f671499, 0x1bb09b7125a9863c, 0xad0ea7d4cdf2d5da, 0x0b8c70d1fb8d5d06
+, 0xe1edd3d255eedc98, 0x2c8b8406a931bb24, 0x10428de91aaaa012, 0x31841370da5ef6a4, 0xe31c712f37716745, 0x40d15b7a63297c95, 0xc9bad3d5e641612a, 0x5ca69ce3b48a6579, 0xf1975ad64674fde3, 0x31ab11a090743db5, 0x199e365335e21c11, 0x09ae191f9fe8aba1
+, 0xd8dfd66b47186dba, 0x654d9830f78cbd5d, 0x582d30bd148bf132, 0x1324e88fbe586352, 0xb509bbb24180787e, 0x60b583b5d163c94d, 0xbf3cc7824bd50cfd, 0x1fa3c59f73a180ce, 0x5265d196de28c159, 0x0b086e5537f0d957, 0x87541fc516fdafe4, 0x72a82a8a661e6cf5
+, 0xf05ff644b82ca5e6, 0x6fd03c1beaa330fc, 0x6af2120526392d3b, 0x04a602c5b589feaa, 0x46406f4bc4aa6282, 0x57ad5cdc499bc6d7, 0x9af07f7cbd960417, 0x704540b13f71579b, 0xaa3c1c344b982a8b, 0x190c5186894055ad, 0xb85dcae741f5218c, 0x3913708427f3db53
+, 0x3e2945bd05d62209, 0x17512cb08c2acf59, 0x30c714252fe41eb6, 0x2aaa05eec72a5969, 0xb5f69b3d651f2de2, 0x2f0f56836313ff66, 0x44cbf34f788f928c, 0x2a09e1aa284f96bb, 0xba0c3eec535e085b, 0x1bc936a4bb027e9a, 0x0f43c0b8b0e58853, 0x30b5bcd5d00db3a5
+, 0xfa6cb2988f5af05a, 0x702783981dd91c17, 0xc93038214427ad4e, 0x0759067cd6183635, 0xe97cbc17c6b0ee4b, 0x421aa8e98dba1b76, 0x73dfdbd4fce118b4, 0x5f4355fd6f4676a6, 0x953aab2d1b4945f9, 0x1edd74051b259e94, 0x5b64837f1935b17c, 0x36fc8a7c6a02c23f
+, 0x51faa43d06264aaa, 0x4bb30e86f5afe4bd, 0x0c8870e56b0c88aa, 0x3951f8c984722d8f, 0x03df966f088e2759, 0x79abe4b1ac213e45, 0xc7c211aabcdbca84, 0x3eb8200e99426a73, 0xad892355754f9239, 0x41bbef35796b4555, 0xaec673a67150aa5e, 0x5ddb8992d13f1dc2
+, 0x7b79c2738f39fe6e, 0x1c75d17fc63f1530, 0x0eb6908c75ed38e5, 0x26f6e487e2eefb72, 0xf99d03076618a551, 0x10a780ee13a717d6, 0xaea2bb5f56cf09ba, 0x134cfe531d332a3e, 0xde7ce7a686613662, 0x2a0ebe5dd0ac0361, 0x7be773a28d0f3f0c, 0x1ff907229630c03e
+, 0xa5410836b154cc8a, 0x5fc375f8dac16ee8, 0x58ed54b2fc6d91e7, 0x08c6547bbbb45099, 0x7d2ecf719a09e037, 0x1e48ac08342dc467, 0xfa915c5b58383e8d, 0x01fac515d4f292b6, 0xfa2aadad442541a9, 0x5c3154962c51ab65, 0x4bb34325458dcc51, 0x52a0f942f0132425
+, 0x09d29183edd8eee0, 0x358f4dd83d3f83e5, 0x6542a266ce966e92, 0x2e75974b079ebc30, 0xe405e8e8e2890713, 0x185346517d5519d6, 0xca8457152e7627f4, 0x371b64ef4b3832e2, 0xacc7051812a0b454, 0x3b369924b11b0bf7, 0x4578c76f4ce9de26, 0x4977b32bc6798f99
+, 0x2b8f26522ed5e96b, 0x6f3a627a2d812cb9, 0xdbf99b3a50441ee6, 0x12a0df59aedbfb0d, 0x88a6c52e3e51aae9, 0x3d0c216bda74d996, 0xf1c48a2f514199a0, 0x3517f7d4c755070b, 0xa0989f9146b31f20, 0x5e850cb257e24415, 0x9a1110de1cc653f7, 0x37e33cc75a8d6d4b
+, 0xe24a8ecfad892925, 0x03550c4000f947ce, 0x69e3e020bb7f4d84, 0x3dbfa1333bbfb183, 0x7769e2b85d1dfad1, 0x625aed677cb50dc9, 0x15ad1818ff122a15, 0x1acf607183d3cb76, 0x7c82af907a0875c7, 0x5dc5e506a535468f, 0x8751d69e4f903a16, 0x5d6f1cc65fcf36da
+, 0x177d4c15fae3a757, 0x7519502d5bd9367e, 0x32adef03a3f1c361, 0x6d376c34eabae901, 0xe742978a38a6450c, 0x6774b416f7a75c31, 0xd51b3c945e301fc1, 0x2a81b260c3b73478, 0x49282ae4280a0f40, 0x6be0e053a7d3ef78, 0x0ca4517cbac122a9, 0x50beec8cf02aebd8
+, 0x3f87dfa4914d9e47, 0x5849313f191308d6, 0xd9f95fc5a00361c9, 0x1a5441943cb0409f, 0x22b7dd67930ad0fd, 0x4d480727a27e7dee, 0xaa560549df083732, 0x075a4f3eba25a6e2, 0xbab753e1887f60ab, 0x3990de6f6c253418, 0xd5759629ca580ade, 0x0d68c358e103a463
+, 0x40a158b9cd08d7e6, 0x59a7b555cacca5ba, 0x51cb910ed14c2c05, 0x2a40d9190a7088c3, 0xec31bd58ab7e9e8d, 0x5c8739417d125589, 0xd52f5ab88c2454c6, 0x0599ef898480ddf4, 0xf21d0a308e2bdece, 0x04530805517ca879, 0x9c14e7049f3bc57e, 0x4cfcd74f6ca0ac58
+, 0xaf64f0af02d6ba5c, 0x55507cc61812f0cb, 0x1f96e3ba463e5848, 0x6beec4b88d4a6025, 0xc7a2b490e219033b, 0x121043308729ab1a, 0x60ee8a72734f7ce9, 0x742e83af6a948712, 0xfd9000eac55d6e2d, 0x7670382b26522292, 0x31a83b407167f3c8, 0x44eb8b71b76a0260
+, 0xc48f21e8b9254176, 0x0705d84064022011, 0xf35acc8dd9527739, 0x7c8112fae20634fe, 0x83748555d369c1fe, 0x6dc15eece4f0e316, 0x5c229c8a9dd4d960, 0x3887e3c430368835, 0xdaacb2d48523e50f, 0x1fbc5316d7f0e07a, 0x81cc16f0b619a05b, 0x7dbdeca68b16ac86
+, 0x03bbd677c1f49f73, 0x1613bac58aa7e312, 0x53b8e2a78d910d1b, 0x6d0d8be3cae8ff87, 0x196b65578e53f68b, 0x06ea93d53309e11c, 0x7dab3bb50723433d, 0x2f0cb3a7858eed40, 0xb6d9ea4e9e48aec3, 0x01385359fa4b9e32, 0xa6f9919138ded394, 0x129f27ce491a6a34
+, 0x179d65ba38e5d5ec, 0x0221c632f37e5a2e, 0x4e8e66d55b87a04a, 0x1865996341d5c726, 0x76d2a818918fcbbe, 0x7eae317a5c772bee, 0x22d85faca0b2819e, 0x3bf913276fa02da4, 0xb10c819054a01c83, 0x17b009d773d9e3e8, 0x108f634807653971, 0x112a71715fbdee56
+, 0xb5734255e3b62113, 0x3a20961711851792, 0x752f52900101ec27, 0x5bc21054b18a8e45, 0x0da96ad77571b5a9, 0x41fe399e8f04326f, 0xe1012f5537c2b1a7, 0x0630a0c5491bc03a, 0xaf0030069510e112, 0x1fdc01bcaba7b65e, 0x1e836dcd9ed2c852, 0x2cb17e5740d86fc4
+, 0x51a1812e7143becc, 0x7de554d68d8fd363, 0x7a546bb4116ca69f, 0x0bc2b1a746477bf1, 0x72147d52cb103b1c, 0x01a82070dd1b0a13, 0xbfb493364504ff2f, 0x0e52dd9daee5eaf9, 0x0b6790d25bc44049, 0x7315556bfbf4b312, 0x7d708b7b905877c3, 0x5a72988ce5c4acdb
+, 0xb9d2ddd9355ab1ee, 0x2c9b9a380e37d706, 0x6636d23b064c4008, 0x620f14b7fe558fab, 0xade790c98f90cc34, 0x38db8ae10739f806, 0x8b51d95786239f95, 0x3301568f4817e35b, 0xb23a5747e20164e5, 0x73145e8bc29f28a5, 0x40913efa3eaeaf7d, 0x37aa08c5391a0b22
+, 0xa05696a7691a452f, 0x259acd7ffde44d88, 0x2361ae126f95bd0f, 0x3dc476707d0cb040, 0x01fe9f2e9919a6f6, 0x602506e13b5ee682, 0x630f55e5f51a48a4, 0x25f350911b410205, 0x7990dccff8f2a608, 0x756ddc0244f3b2b6, 0xac3a811ed714aac2, 0x555fa324d0d2edf9
+, 0x60ccd42e29b70c07, 0x6686668893593a76, 0x6a21e4e1cb26f46d, 0x419eb2c71f519b20, 0x3aa97cfa1da8e752, 0x1612cd20cc737b90, 0xb3dec8254977d616, 0x4ee455cd77fcecf0, 0x43ab641ce2005c16, 0x069d3e3175255cb2, 0x405edc399bea9ad3, 0x47c1571a9b13a15b
+, 0x2b5640feddcaed19, 0x59a521378003c590, 0x7ddfd195753a261b, 0x734d525600420331, 0x2fa0c093e439c7b0, 0x41130a88b9debec7, 0x9e55f52093c03001, 0x4280ff2ed4d7765f, 0xb50f5d0ccdae098e, 0x605b69dca4e11cc3, 0x95150d1bd63169cc, 0x6e1436374385602a
+, 0xba51b6235ea0a4ca, 0x6d522a58d4606814, 0xdd91b32fc861cecf, 0x4c2fb4d8a71956b8, 0xcdec947789898d27, 0x51468a24024927dc, 0x1778c9edee1e0436, 0x378640bf7ddffd1d, 0x1e603289a01bc67d, 0x15f16ecc320fefea, 0x2962fb2bbf498bbc, 0x6ebbfe0dcf16aaa2
+, 0x8ebde17d7237c3eb, 0x5c7838b949ab008a, 0x531125fcb6430b5c, 0x209974f473787085, 0x9efafbd5d0219753, 0x3dfcc2b387fcccfb, 0xa77567577f73b5e3, 0x04a0bdeaac19a508, 0xacc3132e68ed9e50, 0x141150d3ef27fe78, 0xf0545470be03ff1c, 0x056d42b0974d00e7
+, 0xdcf72e99300f2e00, 0x708b1a48b1a491be, 0x59dee4b308040800, 0x52ce6241d147e0b5, 0x89032abe85109478, 0x12d8fdd7d619cf14, 0x770fc87f00c05865, 0x0d0b39ce90b87685, 0xc1e580cc6de7bcea, 0x58861150a38b24cb, 0x624f6533cc99a690, 0x5b7f8b3c343f2aac
+, 0xc1fd9236dbaab2f2, 0x008848bbad3166c1, 0x99d4e7b49e787a75, 0x66837c95cf1ce595, 0x37f670f5a5a10471, 0x41e824556e0219e0, 0x2677804426d243c1, 0x305b2a48909b9357, 0xb1a4813cb18e3f1a, 0x3c3c3ca7ae7e0395, 0x6f1eb67176cab393, 0x6f65c357fa36c9b3
+, 0x2c2484d58aac2238, 0x11fa3890592c95d5, 0x7b1e21d46053bbb0, 0x58db5797b43c564d, 0xd0179f06ffe4a3d6, 0x7286493be3a1d199, 0x55475246c4f5e995, 0x43176ac250f1a848, 0x6fbf680ffee31ad1, 0x2f2345a203017189, 0x8f95c88fd9baa012, 0x049f41496539e1e7
+, 0x2d0eedd9f2290c7a, 0x6838566f39107cc4, 0x99dd95217f65925f, 0x1fbbd21a22282ab2, 0x82aac9a75cd39276, 0x75d88f52b62d763b, 0xaddbd2537331d682, 0x40136d6262e19be2, 0x30eae921bdbb92cf, 0x71e4643eda0899ff, 0xac0d9c57633fe31d, 0x268700c1794397d8
+, 0x91aa44e5f17b41be, 0x40c4efeb5018b44b, 0xa222da1b7531baa3, 0x5d75ce398600fff5, 0xd0d9fb6705b73cf7, 0x4e0ab5c73d78feb7, 0x2e52ca1339848640, 0x0ea359f96f56b2a5, 0xdcde010c2a1417a6, 0x1e1a211d658bdcef, 0xea7a41c2aa5e259e, 0x7f1a0aad4727efca
+, 0xe920058c349554dd, 0x30e123c7be67b25b, 0x8e167b927c428d7a, 0x1fbc5b6953f722c0, 0xb491f6e9c2a25f54, 0x50e756fffe1dcdbe, 0xf2b62a8bfff51230, 0x2cbc80962b7507ad, 0xcf1134a2be1aee25, 0x1ce5d3e78b26f8ff, 0xf7388d7060bb9a2d, 0x290ecf3ce8080a92
+, 0xf5091ac741946d7d, 0x32c782c5ace72805, 0x7945a1adbf9443c1, 0x6210ff89386e5935, 0xbcf256aaad2d3c02, 0x4518c86952996362, 0x0348b28978432ac3, 0x0ea0d290f4e5812a, 0x0de77b56aa3b9482, 0x3852c3e2000babaf, 0xa7e219aff63cc12d, 0x6e019aa09923fb45
+, 0xf2d0fa2ff7d066e7, 0x433334a5888f1db3, 0x26902ce44d6975f5, 0x53a3f51937736164, 0x537040889f56cce8, 0x757ac5c8abf1f391, 0x9de00dfcd9ae40d0, 0x0a80233bb90af63f, 0x27b9cc5c23b0f46f, 0x44748de82f101d11, 0x4cc5dd23e433a18d, 0x4ce3ef54a73a5eff
+, 0xc6845754602e4b2c, 0x21547f0fe51e6d6b, 0x7a5dec4762239162, 0x580b31f17db0536b, 0xf30f3e2ef08e9254, 0x410a41a7a92f57b9, 0x1634131fab2cfc82, 0x005d9dfc18a5e22c, 0x18949a7dd74049a3, 0x73ab1278865d7ab0, 0xcfb772093494316c, 0x1cb5dd3beeeec6c7
+, 0x9108d70c1ac86a60, 0x217e51e49f334091, 0x5ad554275b56b281, 0x40e1a9b9f1858ef8, 0xa2e46faf3e140962, 0x064ca6542a67545c, 0xcf66d37248884c52, 0x2b9c156171c40964, 0x7fa655a2b0d9e756, 0x12ab4676e4d3ebb6, 0x5a36aa97eed24629, 0x0ab65f253bdf42ee
+, 0x716ea5f9ac3813b7, 0x7d21253ede6fcc15, 0xce5ba37f611f4422, 0x43cffff8feddbbe2, 0x65eefae6edbe1cec, 0x4a8825c0600dfaf6, 0xa5807016b36d8b98, 0x1ecdfc05238b2e34, 0x49e6069fb91b17c7, 0x1e932be3559ecd50, 0x9967fd47a7cc77a6, 0x78d4d123a877aeb8
+, 0x45d008d65e12b618, 0x5cc10d40f25a44f7, 0x51a4b7155c3d097f, 0x3c77be7525d5c28e, 0xf7d6199ac25a26eb, 0x4e6b7c053c81c5ab, 0xe57d987001df8d5c, 0x4b9909348275c6ea, 0x10a99187dc649b11, 0x7bb438f7335795a3, 0x1102a16bc2853f54, 0x10bb47b480907d4e
+, 0x7b72da020aa68efb, 0x617653683fa38a6d, 0x934a53a3a08dde7d, 0x40ef7ce71919b756, 0xf495a7bc7b736fda, 0x10c1b3415a44e81e, 0xe9c2030162b5a7a3, 0x2202349bcb4df4e4, 0x797f5f0b18b007f0, 0x5e1fa9e1452f3d3e, 0xb0048734a141c663, 0x63e9f1dac2b3cd55
+, 0x5043451988747889, 0x03d09b824ba2cb8f, 0x37929808a742e7ef, 0x437365beb0f38203, 0x49bba4faed782267, 0x2ef0226c5d41a4b4, 0x25d8b61ca76bcd30, 0x4028c9b6bf9556dc, 0x41e804be86f67c15, 0x53d5323d23005301, 0x6be7b0e8f404cb24, 0x2886ad72a2a71c14
+, 0xe7713a1da580c559, 0x51e5486ea0a9d526, 0x1fd843733770b4f2, 0x43dba1bb961ed699, 0x50293698562758ff, 0x6d0165c50c8ff726, 0xf24dd1b05ff32011, 0x24654ce7d1ec1135, 0xcbc529b0d5d7b146, 0x3ca456e48e058193, 0x592cf539d90baac9, 0x1a85f31f053baa02
+, 0x69a4bfc8220cf975, 0x0045424056bf5aa2, 0x90adb6d06f654281, 0x536c59e29485ef55, 0xb6ecc012c5cd3321, 0x1e120f164567dc35, 0x9cb350ee339e6e76, 0x15c2ac9e9be99351, 0xf15cbeec92ac4828, 0x6630c99c3a880fd8, 0x9e20664842370404, 0x7ca66a69e39b791e
+, 0x1e5fcd137875f5f7, 0x57f978d1ff794c19, 0x15c406517fb3db71, 0x08a4137841f807a0, 0x70e065f2ec3fdb76, 0x5cdaa3bca8280972, 0x8471773b787821d7, 0x1d20a3d2a562a820, 0xe88fe4d49758404a, 0x76d77287e89ad32f, 0xccabe69cc300c4c9, 0x548889bec0f3a534
+, 0xf55434204153c729, 0x605213612a72c26b, 0xb6a4b804edce5693, 0x7db7d4ab113afff2, 0x022ec9f5b4a2bb8b, 0x7457df0921dc5e64, 0xfb2f584f0ea1b52e, 0x58b824610ce376b8, 0xb2b5c8d3aaee553c, 0x6298b2934d166393, 0x09e8b98c79cfe26f, 0x649af9cf45f84333
+, 0xc44191ba739e8462, 0x3f9a0b08e81e3528, 0x0c1d6c97c4a2fd30, 0x12fd3b26fb33bed3, 0xa769d504e76abed0, 0x3b56f11e3b16bca5, 0x9f5ddafcf4922ac4, 0x06aedeb99f95f8e0, 0x9ebe573f3326db2a, 0x7ad90ecc32d03f2e, 0x4875beb1d7f3fbf0, 0x0a611ed1a69bf1f9
+, 0xd386350b841574c1, 0x220f189d538a98f6, 0x4fb4c1a0c9ac8c0b, 0x457d7c72a8906937, 0x7ea883d3bde08b58, 0x28723c2d9fbdb6de, 0xa7fe569526068ec8, 0x2c9824505808c333, 0x7b4c171d34617dfb, 0x778a6051cbb92379, 0xbc8d1d6a3283afa6, 0x16b063aa2e579e29
+, 0xfb3585d8938a322b, 0x2c3dfdd84bb10abf, 0x26cf2784812e96f1, 0x5ab3ac3fbf78f32f, 0x1179612a5d12a0bb, 0x3a87be245222c494, 0x49419855dbd6ea95, 0x6ed8bed87276cde0, 0x3dc9c89b8819318b, 0x75bc597be44fd6a9, 0x4576c7194291590a, 0x23b71385909f6ab1
+, 0xcd175dd4fbf88fc3, 0x782e80e02c528486, 0x014c98909a1dd4d2, 0x443db9572e0389ad, 0x6739d52b9aa48794, 0x1401d7a3e1d0ed7e, 0xbe858a86ab6324dc, 0x5261c4f8cdce1739, 0x8f253e61bf1939da, 0x4182382d2b442261, 0xe973611b4f2ec2ed, 0x43e10292379ad729
+, 0xc4b7725b630ef0a3, 0x040af3fd95a0dfe6, 0xa539cc2fda13c975, 0x4be3bf61e269d775, 0xc847a1d78b86e216, 0x5be9737e177ff3b0, 0x7b564749304750b3, 0x516f4e60de0cdd6e, 0x9f30efdf6e75a0d3, 0x1c871e085b9fe6e8, 0x9477d13a4d349911, 0x5bd4f030886576a0
+, 0x2c937cb6c60b2303, 0x5a6730df6ca7c217, 0xc10004c366f4a252, 0x2e0c05e8bbeb956e, 0x08af3a6d419c3109, 0x7aaa9ac3bede4c3f, 0x9f713d9d41987bf6, 0x069f9f5df99d74aa, 0x93562dd0bcb45e1f, 0x2ef77370e2449bcc, 0x8474a4d3070e1d4e, 0x367777b6510a73e5
+, 0xd30e21340c3b32a3, 0x23f5a45074c4f961, 0xa1fb6b8baca586fd, 0x25480c87acc849a5, 0xe086b0d066b7389f, 0x7cf8b1d06f792fce, 0xf75a22710ec0ba20, 0x41bb42565e775b46, 0x79f772b995bb8694, 0x4287dc8c3532445f, 0xff30820ada60c770, 0x29f517d666fe65d7
+, 0x4108419eef990049, 0x68d020f3e00e6560, 0x1df048c42adb5051, 0x3fff382e51690c5d, 0x27a6d86375155805, 0x460388b1ed148389, 0x419156d3d094ce76, 0x05704f2fdf251c8b, 0x29024f3d09c710ab, 0x36a525fd08e68271, 0x0fee44397dfc1251, 0x15826be5f9ef0afc
+, 0xa292e09ddc7ae61b, 0x60b1e6d020e9e423, 0x768e912b6a350598, 0x0b4d15f3947a3ecf, 0x30f85b94bc48b7ed, 0x1b64862ba07951f2, 0x89bdbfe0108d6ba0, 0x6415baf7471a1af4, 0x4503dbc23077719c, 0x311681e9420a2e18, 0xf150f65f2a31a6c2, 0x7e7b24c25d2d956e
+, 0xb28c4d7e79091933, 0x06c75281ba7c96d6, 0xac737ed2a55f923a, 0x2d9e54083f5ddb94, 0x42a08fce483f15bd, 0x446112d174406cfe, 0xa2fa80282535923a, 0x424fa8af6dc019ad, 0x0a3af4332588f5f8, 0x3588faef99a2a8a7, 0xf0d430b3e21edab0, 0x7d189c2c3ede18e2
+, 0x4efdfdbb2686092d, 0x06cff016aa80fbe0, 0xaa704da99109f1d6, 0x25c8cb6f21cb1d07, 0xb5d750fa4f25ecf5, 0x42c963749acbf5fc, 0xc2b8714a91a8202e, 0x726dd13ed9e29337, 0xa4cdbaed2580c991, 0x1ea1b9533bcdbaf5, 0x530714430cf6157a, 0x43bfaba005d09bbe
+, 0x672e11f7c3dd16da, 0x55586d1e5443d974, 0xda46e822f9df5e26, 0x1a61e7c9eec8de73, 0xb8f89e093a5d6e7c, 0x43b3d5ce9a3b71db, 0xc567fdb7574f7d74, 0x3047ee1c598e1488, 0xe0def7b690b26add, 0x5a058ea7941a9f98, 0x10e05f6a66841a61, 0x30143102ca92bbd2
+, 0xe7d0d26569cc5f6b, 0x294f44e38c728c27, 0xbcd44e7a1fc3c5a8, 0x7f20a65f036c8954, 0x9d94a4743ff28efc, 0x46a9c323d2fb81ad, 0x71c9c2afbd3c318a, 0x1ca3c97dbcbdfcbf, 0x8e8946c538a5c8d6, 0x534c477841b32168, 0xc32b4d49c15ffb4e, 0x73845c1e43891e2d
+, 0x790d20d524a74c2f, 0x44cb9c4550fcd64c, 0xdc4189f27945a9ee, 0x7e92f09dfb438879, 0x5ab8dbb2bee33e8b, 0x2e8ce0c9ac34e282, 0xed9328d03c5ceb72, 0x31fd97edeb7cb093, 0x86c8d9c889add787, 0x2b0fec96b61dc1fc, 0x4c80dcff9e1da33a, 0x274b3139052c2416
+, 0x0bc487b430747a9f, 0x1b759a11f73a53fe, 0xae9f835bd8b16969, 0x2614428b938027a0, 0xd4cc4b3dcdd48eed, 0x55f6cad99818fbdc, 0x42c9ef302ec51282, 0x7f3949816cb571d9, 0x78110e26cf1bdde8, 0x0f2ae0f9d65862af, 0x99d9a527a0610817, 0x00847f1d2777922f
+, 0x58d8ce946108886b, 0x17c5a9b157c83e9d, 0x3646bb80b7a48415, 0x79d8822585056fa2, 0x7533232de2207d62, 0x26868e36dc47f04f, 0x691e7491c7df8e4d, 0x138642f25697bf47, 0xefcf148bc63680c7, 0x2b7b7b28b2e554fd, 0xbc504b85043049cd, 0x3f80ecbe55a62dd1
+, 0xca9d5ad89b84f48c, 0x674e41f459678997, 0x7f49b45a69cdaf49, 0x76d9d38b5e89bcf6, 0x6cd2f702c7cce036, 0x5e6ccf93bea68887, 0xc3931e335925d499, 0x6e098d55c3b6265e, 0xbcef39b5e3a2e303, 0x602965de7dde3d22, 0x94538324ddb19d9f, 0x50e7ad30a23f11e9
+, 0xb1708fb1b77602a0, 0x4a3c756c225466dd, 0xc7736f86a57172e0, 0x1421f0ec38d74272, 0x3fbafab7408de40b, 0x18a6a2a9f74a8b04, 0xa831b661036e5f91, 0x331f2a53870645ed, 0x284473da687ffe13, 0x0f9a02bf5e8242c1, 0x1c486509b3f53e10, 0x2a3c57b599d6b9f4
+, 0xfdef1031dd5765f8, 0x011a5a84d3233b2f, 0xa16ce8a38a53e8af, 0x4b725af2d0f4c333, 0xd485be0c2e13e8e1, 0x7a7ecd9a4f32a01b, 0x7c01dbc2b8d65cb8, 0x20c3e2a1a036609a, 0x2842cc97bec1eb39, 0x006509e8c71a0cb9, 0xc87bcc2435966838, 0x01aca42041abd658
+, 0x0919c8b2fc5b48e4, 0x3fb2f1e33cc72a45, 0x9cae5cf4df435f3b, 0x62fb327afa7929ae, 0x172e5baafadf9a4f, 0x56121414676c811d, 0xb654bfaef0a86147, 0x69fcc0aa5aa1f29b, 0xc55930a3153bed5e, 0x1ae17c0a5fbddb01, 0x93fd950894230c47, 0x76e335160f86fe19
+, 0xd2765f1b034ae77d, 0x4ec778addae36bbf, 0x504dc952307e95cf, 0x7626344216a3eafb, 0xb9c85464230bea36, 0x6b4a9c35f1af8734, 0x027172f8d18f407d, 0x6a5d921ee7182a75, 0x240cf96f0e115506, 0x686b18f18c27dfe2, 0x77e895c56739afa4, 0x6e1aea4d89e1f143
+, 0x054ae696b293c7c4, 0x79d91919614cb032, 0xc09f69f8bdf74bf4, 0x26c700c7b1558ce6, 0xc6e9965b2dd527db, 0x2500b029da2c8d35, 0xef099880df26a096, 0x14af635d3faacf90, 0x283775e289051535, 0x15c38dbeef075a89, 0xa9ebd9e7bc74169a, 0x74ff3f9e0a7c6829
+, 0x387dbb3ea842b727, 0x7c025687b6924c63, 0xb38a8ea5e88515a1, 0x1c238c39c0b16155, 0x0642ef94185b6e0f, 0x17922726f4098409, 0x921787e871924148, 0x2af09928bd4514c2, 0x62db07627790eee3, 0x081025dea8b5a762, 0xdc074655fd64a948, 0x70249acebf941be2
+, 0x05ef673c583dfcf1, 0x2d488d8a081562c1, 0xb27d1efe4687805d, 0x134ffe02e6fb6c55, 0x60e1158d797e06ab, 0x09b2a1709af69148, 0x1b12f72c3c6b2ad5, 0x3de5135912218835, 0xc94baec7f5186ca1, 0x7009e39ad2937f39, 0xf552858dfa90efd6, 0x345c00d87c2b2cc6
+, 0xa8edfb9c74256e6d, 0x22cccb99f9cc87b2, 0xd5123a548005340d, 0x3e486929b4354aa3, 0xe259270c590c9880, 0x4d4ba4b3ec5d6430, 0xd40d1ee21f3be09a, 0x473de7c6a7921b45, 0xfa12dddf7532f37b, 0x56d31046e3e94d44, 0x7292b081cdc8d05c, 0x09e3a6fd4681ebdb
+, 0xed9ead82d8804192, 0x58e90b39dc9e60bc, 0x6be690d22096f3e4, 0x0d93520682e10ff8, 0xd667e5661de8b39d, 0x06c8cf2ad0804922, 0x68e249a47e8ea7df, 0x589b1f261b721033, 0x4a87fb7ec3019530, 0x7fefb2014e25e492, 0xf9ffb25fa7f56650, 0x7ae495d7191391f9
+, 0x3ca31ba3de04f578, 0x2d3b833990671ce7, 0x2e2edbb2ada98160, 0x597ef1ff8cca45fd, 0xe1a259cb1459f10a, 0x10a1a771f6c29142, 0x1644b416c492840a, 0x2dbac3769bc504a8, 0x21988a7bf6248d55, 0x3ad0851c1bd9ba0f, 0xe3373a8b0193f5e1, 0x43b6e1262c2de469
+, 0x0128d041fa31aae4, 0x279ff03fa2ddbcc2, 0xc21837a2a0fe3c5a, 0x2afe9a45a10d8ce7, 0x839e580fd80aa48c, 0x1781c1dcc53600f0, 0x04f8978d3f3048bf, 0x4eac4feecf3937f9, 0xa78c65f95044f4c9, 0x35370af1af9efb41, 0xf01130fcc8ceda24, 0x4da73b8816c5bfd4
+, 0xc37e3ce80aaa1b2f, 0x1aa84a46530b12d8, 0xb3eddfafdf18c746, 0x538be646590e839a, 0x65d02ab2113a9d2e, 0x041ec5e4f2ad20f2, 0xab767c76324ea496, 0x4590ce8593eedee7, 0xf6ea72dbb1970a4a, 0x2a9b550adf60277e, 0x76a9a21a68ccfcc5, 0x466584af474615d9
+, 0xe94cc345ef5fcb89, 0x688bce47107d3de6, 0xc383ecb81ff1aee7, 0x0c314e07fc79c28f, 0x4feb69581fb6c94c, 0x77a74c2ddc057e94, 0x3f458dc607f9cc99, 0x036e4a4643d5137b, 0xeb35c06400942ff3, 0x405197674272abe2, 0x32399f0ba5e09e18, 0x1ff98e5b64b7f9d0
+, 0xa16c238d3b6cf11a, 0x0de321cc999d9c45, 0x6f67392ca653ec1c, 0x22c1a07981ad09bf, 0x328fde585b615265, 0x5c71d6b42e27fac9, 0x57acc7cec2cbe27d, 0x260469ebd1d50b49, 0xd3172a5695e616aa, 0x3b4ecb84352e9a07, 0x4c5116bcd84bdb44, 0x24f7eb838eb74d83
+, 0x153928831681a875, 0x0ae4bfb14805eb7a, 0x82c2f91b9cb8b2c9, 0x033720e6eaaebe85, 0x0c669ccf53cc3852, 0x27382d5039b75139, 0x13e776b659afdce9, 0x394e41b96c5aea61, 0x34d49afb76019232, 0x42ee4fce23492252, 0x348ade354dfcb05d, 0x0b61000ca4d5c397
+, 0xc8561b9132ae0a70, 0x635a2c0712e6bcb1, 0xd3914213772ae7b3, 0x0e4976976ead6417, 0x2967d78e843410da, 0x3c3df2e7ec124edf, 0xf416853738d2c1ef, 0x20a2bc2582d5bcd0, 0xc70ac9ad93ca1317, 0x0b41f6498ef0589d, 0xf8722ff9e0f5524e, 0x5ac82bb1b85badfa
+, 0x0ec8619917dc5197, 0x6e1e490b0e65e234, 0x875c82462a80e9e5, 0x3926e7220ef7abc5, 0xd21e0d96fa2af949, 0x169b6721154115df, 0xd5a7caf84347e11d, 0x765452b8226a8508, 0xf5b867c43edbf8ae, 0x67f33ce41cc95b18, 0xa17f182d262951f1, 0x6fb1e6adfa7cbbc1
+, 0x26b2135711ada949, 0x06db1f641007524b, 0x27cc98f94ec3d66b, 0x05d7da519c23138c, 0x3865ee4f051e322e, 0x46fd5eeeedda801d, 0xc4b35d5ad289bc32, 0x13247d46940646d5, 0xd787dd01268426f5, 0x0474265799b54311, 0x228168b9c8796d95, 0x0fd3492ef84e2dbf
+, 0xcf4604c41d742092, 0x7a580df9785316ec, 0xfdc972640f30c483, 0x019c42e0844b938d, 0xd30b7148da2bc731, 0x2bf050c978eb5bea, 0x1206f1109af69395, 0x21df29c02f820e24, 0xe94403f6dba3beef, 0x38fb35a8428d0582, 0x78ac2cc65d2f3b52, 0x683484565650f3f3
+, 0xffb60e983873b237, 0x736c45d55ffb37f9, 0x875c41985f74bd81, 0x5e3be25e1c056e43, 0x9fc096b8aaa4d5c7, 0x0cafbee1fbc8073a, 0xbdec80053f417444, 0x729325d9a00d9df6, 0x392e34ae98267f18, 0x18f67e137700ed32, 0xdd18bf77e6b69f22, 0x42d1abb59774a1e7
+, 0x145513fc9730bd6e, 0x5ef9c6391dd28d28, 0x8e8bbdc6f60a17d5, 0x0f5f4fab66b45e29, 0x85d3b635312c69f1, 0x4a0674c05e58f41f, 0x8c36b1ee8d3926c9, 0x4587b0d68140a136, 0x7bb557c2f086d4d8, 0x4c65ab47dc410361, 0x9236086e57c7f511, 0x0208b70c0cf0ad4b
+, 0x60c1ba5d546675ea, 0x17f5b9cf7b8c96b0, 0x333d9b341f126d65, 0x06c60703ca5950e1, 0x1f07e65cccf1ef76, 0x5bff7e7b0098fac5, 0xd98bb45652e03058, 0x7a58a8e80b4c6491, 0x7b3aba7847aa0ce0, 0x1f88a7eee142d2ea, 0x73cdb27c806c41fa, 0x08bc94ab1ceb2517
+, 0x31ba1dd2445d8978, 0x34cc433bb4b8d0b8, 0x470af4519bbc31ee, 0x78e4e6566edfe104, 0x8e1839066367bd7f, 0x535967723a257d7c, 0x61503562cc50e003, 0x754d3767b6a18ad3, 0xf67b6865e52a76d6, 0x1c1ca911d99357b9, 0xf4b18900394ad245, 0x55623020646a295b
+, 0xed1f062192d07ebb, 0x59f3431885182922, 0xa5aa4d216f5d6692, 0x187f10c9bc5d4771, 0xecc5c36698fad140, 0x608bc4a888b4b9e0, 0x186234913d21f187, 0x1c9bd4a437fd20aa, 0x3e0fb1ceb305512b, 0x49a7ce87077c163d, 0xc6d93596a07a3a9e, 0x310311fb0f112254
+, 0x3aa8855feab3eee7, 0x2ca0dc5eb6d4f8c9, 0x857e20eac8996db1, 0x52aba6e3af2562f3, 0x71e6869df7b24177, 0x785899092bb33712, 0x4b4078bb48d09959, 0x063364d1c9c64c5c, 0x40da3deb915cf6f8, 0x465a1e7e18e41b33, 0x3113550ef0672e0f, 0x26df6597123ef184
+, 0xaa8e2ee9049eb461, 0x70f2b81bca983c40, 0x84f007986b8167f8, 0x58ea6949b9f6d434, 0xc14249fb4873e08c, 0x63ae6c138b8e9eef, 0x48971e3b588c3fe1, 0x18922376e285632a, 0x2617d2ab0e13564e, 0x75a9d8bce0ec5968, 0x4e7c2c5df0253cd6, 0x554728b1f9677e03
+, 0x75c1352a084d3628, 0x1410085251ba8af2, 0xd59b4c6309452e92, 0x6a085b704f8eff8e, 0xb0f452bd07867530, 0x3c7a77ca61063762, 0x10eac4e5bb974c3f, 0x601dfb80d4717cf0, 0x97974078b8593233, 0x68bd6549b29d3c6e, 0xf5e8cf7da611e1c1, 0x78847a63a26a16c0
+, 0xf1906b749393f079, 0x03040f31479d90fe, 0xef82963a658a365b, 0x19fe216914fc7374, 0xf106252ac6095ca0, 0x5a83d69a9ffa4df2, 0x869cee57101cb819, 0x6df72533ae25b792, 0x4517e0a87c18530a, 0x443348b73751d086, 0xa40a3ee5856bf0e9, 0x124987714c3c4e31
+, 0x7bb21dfc32e9c181, 0x5a478b106b00ee1e, 0xdd2691383024d858, 0x6bdbf4a3ef446c8b, 0x545b215711d92e5b, 0x61f8ee26ff3aeae1, 0xb65c0c652e852315, 0x13513d995e148039, 0xa2f8dfc93fe09613, 0x67e3ae5b722fc398, 0xebe9262d927fffbe, 0x74460ac13b2be1ce
+, 0xc3aaf1d7f66d35e8, 0x13c6440679a37cf0, 0xd03c7b3d623312f5, 0x76b55aee41e4a0ed, 0x2ab629f2e2bdc52b, 0x2c00010b69fd4b55, 0xc356bbe8b625c330, 0x24c34f85bd7f9bf9, 0x4e8ede293b1a9c43, 0x57e56cc8c6ad313f, 0xfeac0634cfa57ef6, 0x18b9c3afa7a8c86c
+, 0x0b5754287b2952b4, 0x34858d1e77c539e9, 0x8c549051a1e66807, 0x2591ce2630c240c1, 0xbcec707338bb8e45, 0x4c151aceab859d3e, 0x25451fcf692a3852, 0x20d4bf698240a4f7, 0xa699126f9189cd3c, 0x09996d6cb3d212af, 0x501e1a73b4619ebb, 0x6008fcb8aaf37cd7
+, 0xe171638cec6c9c20, 0x051f5a1ea646b253, 0xef07ed934466bc45, 0x10e9501341d731bb, 0xc90c21f47acdd2b7, 0x0e37598bed541699, 0xebe6c2eca7cb8f69, 0x6d7751a7704aecbf, 0xe20a8f226bc02585, 0x29f67e60ce604eeb, 0x3045f3df4ae48677, 0x158f64f0fd2acfb5
+, 0xf4f217631955056d, 0x5dab29e70faa6a00, 0x3eab5b9f2f3ac15d, 0x209db7e6876fce34, 0x97b53fb88131428b, 0x46d2eb3a100d2b18, 0x67035232c3d67438, 0x289c6b7ab1fd982b, 0x45f53b6c8a4d91d9, 0x309b4601ca052da4, 0x6ac1d5f8f86e34ec, 0x36099abceae45ee0
+, 0x3c6410b764b41cc6, 0x6f7312ef2c8baa9e, 0x3944126fced5bac2, 0x36b71a39036f8ae8, 0x5bea2e3a021ec4be, 0x25da9060e3b60c38, 0xfdb3f42225c3242b, 0x11d6b279ce14d803, 0x3ed8d719f328de31, 0x3e448f607ef8c9b0, 0x076d831e67c08c1e, 0x5ce3686c49aca0d9
+, 0xd7f498a2e80e77a8, 0x7fcc8ff739f8e57c, 0x7f6eae93eebd7a5c, 0x0582795a09a69a89, 0x0eeff167345e1908, 0x27a9081b836af059, 0x1930f56d0497c9cd, 0x521aa4057eb3534a, 0x9022eddbee7ae849, 0x376f3a7c552e9916, 0x06c0093541daf847, 0x0eb38212db0d1108
+, 0x72d92eaa1a4d8247, 0x6c26031fb8c46dbe, 0x495db7072e7be4b7, 0x15da862ce8fbd4bb, 0xeca4731f48c24222, 0x45f3c190ea1a128b, 0x75e4d87ae1bf776b, 0x427744c424d7752b, 0x346b6a72361619c9, 0x4b97c2ca6e41b4f9, 0x5de3e9992649c777, 0x4b5a17e4184af7a7
+, 0x861286cfa8e14718, 0x286d60657d48d2a9, 0x00c03306208453e1, 0x53b6a2034b70275b, 0x8b6fc51320d930ee, 0x03c33d4c3998a0d1, 0x6fe3b92a3e168610, 0x5bbb0b18b8d4ce75, 0x300933adf2b4c35f, 0x3d242167f52554ec, 0xb5ad24eb9b8378f4, 0x79823aa19be578c6
+, 0x2a6acd364077e307, 0x24d96d57c31f9108, 0x9ba6aacfc8612831, 0x6886da66a4d29ab7, 0x83c5ab325b4340ac, 0x186c2fe660ffbfad, 0x8389c2ca8e78efcd, 0x539117d2a3e6cb30, 0xf74ecb057acfc86f, 0x7ba9b6c40b0431e7, 0xfea71f80ae28878c, 0x5806d3790be47506
+, 0x43d18c307b957467, 0x05f00f12af63e438, 0x63e90a7d3e7b27a8, 0x3a0f4511cae665c8, 0x1a1393ec6bb28054, 0x7205e44e8dae979f, 0x13a24e7f3595304f, 0x4fea6e11b03744ec, 0xee926dea8a5554ac, 0x62ba9464b8bb7460, 0x8da0a503180c4163, 0x1da0b689916f386e
+, 0xb18f847f75eefbbf, 0x3c12d8658d305e32, 0x77a1949db77c4607, 0x29ab6f772bfd3c19, 0x69cbc46ede1cb2bb, 0x29d35a239f9be292, 0x97a933a92a8e153a, 0x2c8d654729443234, 0xc8a29fb0a4ebefdd, 0x7abbfb2ee839894c, 0x8080a7bb68cb6eee, 0x3ee4e72146278023
+, 0x8c0639f32358af46, 0x50ee5cab403df61e, 0xe60c7bf1997f452f, 0x5807ea397dd7b28c, 0x9d2132bd2d4ed5a7, 0x3ca4fcea66e4cc9a, 0xbac145a0348005b5, 0x2d219764554c6ad0, 0x628559e7972b1fd8, 0x0c9f97c1a99674ee, 0x892107584de39da6, 0x4d43567ca87d9c1a
+, 0x7c8f7cf5a80054e0, 0x332e261fbe612a6b, 0xd584b06b0236b151, 0x551225899b5a3a2b, 0x5ad59416a413e034, 0x3b4313a665e9a8e3, 0x44f8db53cfa7ecce, 0x0eb4d7d7800b5c87, 0x2250ac3a9d41d972, 0x135e17dfdcef255d, 0x34f673a59adbc05f, 0x6a56da953883fcc9
+, 0x9e93229fdcc30faf, 0x01456b9968ecb209, 0xa4d33e8a4778d955, 0x17e66cea57194d8a, 0xcda3affaacee6532, 0x179118712df68fb5, 0xe545d26f2fcfed1b, 0x4a420950d1868f83, 0xb7747618ec91799d, 0x297a7ce7628b939f, 0x404ccc1dd70fe6fb, 0x091a6cc00524d60d
+, 0x41943a6785513da9, 0x3f418faee8f6e55b, 0x795e729315453df8, 0x79df3957685152df, 0x6cf257d48d15720f, 0x11e802d599bc8562, 0xe2f90cd7ab793377, 0x1fd1ada38bcf1c43, 0x73fe3ae364d97b9b, 0x636667f45447463c, 0xe730eab3021b2dfc, 0x7a6b8e617247a71f
+, 0x5d95b4fc85338c5c, 0x0daf95e03e032624, 0x275abab5438255ca, 0x4bb6b3c9e7fe863c, 0x00a10b5492221519, 0x303eb596457a167a, 0xc0d8c41d8f775279, 0x1a43b578b547a540, 0x9784b5f3cab5d200, 0x43bf663fed9a6cb9, 0x648555801347545b, 0x3a6f0348373b7ae8
+, 0x7dc05f835af52bb2, 0x179f0c3e9bad3e55, 0xa385f5988ae86544, 0x418ace13d2a63285, 0xf2302feff4ba04fe, 0x10347393417b96ac, 0xc811c49398fa571a, 0x66076f9333372143, 0x0f37d2eaf1e9e6e3, 0x1773cb1124e6fd87, 0xe86517647599edb6, 0x1779b2e23dc7c1d5
+, 0x402f286dce54c505, 0x65135d6ae6198a0f, 0x53bec2097ffa0ca2, 0x075d4ad62547d7d8, 0x367fd1e0ee0b1ac0, 0x5d0d45db10b30eb9, 0xb6815df68a13e793, 0x49752a07555325f8, 0xb319de01fa69f993, 0x237a23f7deb7483e, 0x8dbd1e53e2b5d0d5, 0x68436980ccecfbb4
+, 0xb9f468320568afaf, 0x2191efe6a8b57ae1, 0x71099f75ae22d101, 0x2be66eb12cdab1ae, 0xfeea7c9a61c1c2bb, 0x6e9edd50deec06f9, 0xaba99f7693c7074b, 0x42c28aa86a141690, 0xb8c8b23d917187c8, 0x074df4f1023b0eab, 0xf19d6824fc578680, 0x6da0cc4eb3eb4fab
+, 0xd3bc5cf15e8f9d27, 0x288aafa2510c0708, 0x3535fe32e81fbede, 0x49d32f19f877b06f, 0xaab849bcc3244e31, 0x34f5eea5758d3f95, 0x45ea629724df5032, 0x07b5550c299f189f, 0x5b7fb54f0c8e1783, 0x613e029f40b3ba26, 0x0e8484b841236cb0, 0x6d49c8f77026bac0
+, 0xecd2816d7e7e72cf, 0x294cf3d11e1cd192, 0xd634a5a166d6ea63, 0x70c48319bd17450b, 0x06d5db0d857c0cd0, 0x1c48c4985ceb7d3d, 0x40e3882b73200c5f, 0x7b978820e683f631, 0xbc0281a50212ae66, 0x3b356082a03e7d50, 0xfdd120f9286d8c31, 0x21f94a2085110421
+, 0xbcfecf5cd93d5a65, 0x2b831578f215071c, 0x39e603bb421e825a, 0x1b210e5c063b0322, 0xcee8d5a05d664589, 0x50f1cf20c8d980ef, 0xa11ecadeb4b588aa, 0x6647f6b8cbeec2b9, 0xcc6f60146d99792b, 0x6f7e7deab65b2af6, 0x2b9ed07ad65ad88c, 0x35416c87e401fe1d
+, 0x17dc72d4f13c8b06, 0x37eee6b199a9827d, 0x7a22cb2d308acb86, 0x1cb184bfa3dbd30d, 0x601052404631f5a7, 0x4fe65417f24e3817, 0x45fb2794cb5a4799, 0x2b64fcdba6db17f9, 0x837706fa6bc22f0e, 0x19b3bb5b473a8d98, 0xc581aef4550e3d5a, 0x475c554a800f4019
+, 0xebb573e6c546f978, 0x5e0c546542521289, 0x61fe1333993b8ee9, 0x08f9cdd37e4ee54c, 0x64dba00abb4a2ff1, 0x719573a416121441, 0x9eb60b79d3cc1a4a, 0x7ab008c204c319bb, 0xef7545113f7634ad, 0x35a1903781c16f4f, 0xe03744fd49cbb81e, 0x38a00c88c9ed2d13
+, 0xb43177a4623ba416, 0x2b7364ca953ac3d9, 0x48df4c475c4da226, 0x2089854de9151bd0, 0xbb7ddf3fc8996ada, 0x2f148aa935c8678b, 0xbeae193d11bcbf37, 0x0e5c499a44d4b515, 0xdafe429028d57ce2, 0x5045709d959bd0fc, 0x75e4174f4a944aab, 0x50cea2e37f92b3fb
+, 0xdfba88f26b8c5559, 0x1adfe1377916ceaa, 0xf4740c2d616d8c0f, 0x16a93412994f9a74, 0x1c0b67e683fa5e3c, 0x769b2347bfbc4241, 0xff277e4806e51f4d, 0x1b98d78da72f159a, 0xb65122c271f953bc, 0x344377c2f4b80a7a, 0x3f8f2b7f823bb804, 0x2d6faaa1c6470d09
+, 0x79166057e3aef7da, 0x59528351cdc3f378, 0xcbba286e900f54d9, 0x4a01fd03ebc336ac, 0x710411be1ba21f9a, 0x50d3b9c0f77e6c74, 0x761744152e41dd6c, 0x2c4d4bcda8879eb0, 0x369ed9a3eaf28bf2, 0x3dac35b18ea94513, 0x2d5e0a8650bc492f, 0x55b5bed320cdba0a
+, 0x304a5bbf786fd53a, 0x041c18006554d002, 0x1d99a7ba009329f7, 0x74cda0122c774f3f, 0x5687120b54eb626c, 0x60b790d951eb4031, 0x69942dd5d2109ecf, 0x3475caa87517a24e, 0xa8753c289edf1c48, 0x464a71e13334c987, 0x3521f4f8f4aca634, 0x1e10317848ffaf8d
+, 0xccdbac65b7ef822d, 0x13efa5de528f0e54, 0x56453b6c6a3ac9f1, 0x089a5ae42d51e51e, 0x2db37e4ec88b7d71, 0x4554f119ae66918a, 0x9807fe863e798e9d, 0x0807e4b8894ef396, 0xa4f2eff14594a97f, 0x0675fc3f9929aa9e, 0xba60356993407e66, 0x476d056a78f6eb94
+, 0xd4835fa000071438, 0x6a577f228b33c126, 0xcd4dddbe9d7eae26, 0x73b057a165c587af, 0x39224d3549777651, 0x76e4179c3301a52d, 0xaf85d4127d918d90, 0x17f192a9a196e47e, 0x8b1f636fadebc3af, 0x430adc0e69163279, 0x1f128ca0e8d8b283, 0x16993c8b2214c22e
+, 0x9192ee45a001c2de, 0x473edec2a2fcd116, 0x61c003b357dc3a89, 0x1c8a77af6b364eec, 0xe16b75b4c463a9f4, 0x1a6271c37fbf1d40, 0xf2093ace198f8d01, 0x0532a656fc47fd1d, 0x99f49af4353b96ed, 0x0e8b387875a0f7e6, 0x97104f8f03f4ece9, 0x0729d00f73a6f6ef
+, 0x068d96ff21ffda16, 0x4224a5b6b755766e, 0x0e6103c2446dc12e, 0x7ca2cd1cbc90901c, 0x975f867b0f69ac97, 0x61cc2ed57149ec1b, 0x5f63edbff7359b5b, 0x17438338885242e4, 0xf476c9eb38fa0ad4, 0x5b1fbd5a350f575e, 0xdfe62cb2e6cea9e3, 0x25d2650db6accda3
+, 0xe05972da383995ca, 0x556181d92641885b, 0x9bf836e9571ee026, 0x47f909f564c161be, 0x0d9a13a91dfdb4ae, 0x6fceacacd536b2f4, 0x5c2eb54fbab4969e, 0x67c620a36105a000, 0xc996c11f35322bec, 0x07a77382915e5be9, 0x7ba69a341f175562, 0x6eb86dc2dd0c629a
+, 0x8e8b0aaaf0bc64b4, 0x7cd6e8b7317a9363, 0x7898e6c1fabd6b38, 0x230b69aa36016124, 0x81827676abb617a1, 0x1c41fb4e7e4722e1, 0x368b48b49202d46e, 0x5f224d11abf086e8, 0x5d84ed1525749a0e, 0x5aed0812a329077c, 0x3442c631fcef913e, 0x353757683f7148e8
+, 0x848fce4fa28e78f4, 0x0b33b14e0a99b709, 0x7b367be14f8c7bc5, 0x3ad0496d1593ae29, 0x125e32d485e5f4bc, 0x7c5f256aa871ca17, 0x351af5fb6ca10fe0, 0x20fcd38a3c2a38ce, 0x5268439dc7148ccb, 0x08633e60645c2767, 0xea01560ead00942c, 0x56c4700d0c0e953d
+, 0x27143cd3ae5217d4, 0x41bbc5afa7d53cb8, 0x05a50eef2cb4d491, 0x2d314c5f584584e9, 0x0134c75b126f0a61, 0x629137447588517c, 0xe5f73fa3e94199e1, 0x3103f832b352e529, 0x1d8f6a5eaffe4782, 0x160d9f2121c9a6e7, 0xab095ad3009c6d78, 0x62379b07dd26869e
+, 0x1e9b1bb3dc848402, 0x63f242b9382978c4, 0x38113b879128a085, 0x2cdba9ab880829fa, 0xcbeffda467bf6b4e, 0x2f533cda76fac94a, 0x439307aa5a0999b4, 0x65659042c55d023b, 0x4d581ce4e612afc6, 0x34b2935ade53e170, 0x23912c3a874f8f5f, 0x4a351266ee59655e
+, 0xa36eb26e7c0b805a, 0x235e5daa7fbba2c4, 0x318585295b42afda, 0x2f5bc279685aa3bf, 0x083c661de38ae1f8, 0x421b1275f2fcd372, 0xee27216f175d9a86, 0x5a7eb4f27ab134fc, 0x75a11fbd46c94faf, 0x0c93ed04bea79d25, 0x6d93ec6eb331f291, 0x7240a2e81c687471
+, 0x2198b678e3d5ac82, 0x0e4deec44b7889f4, 0xebe8c3c888ef8570, 0x7141e0be01900252, 0xe75c8c7b128778a4, 0x4d8b47bf5a853d4b, 0x950c6b835106388d, 0x2ff20dee9b51fa49, 0x6a6d9b87a67e3e1c, 0x3ddd4b21a334a110, 0x5061547c2919ab27, 0x10a2d4b6198b6192
+, 0x7c650a0b7d2f2019, 0x2a70b1b1c2270c97, 0x19a738533fff1c38, 0x6ba98ded64b8841b, 0xd59b929490b96de6, 0x41c6094da36a3442, 0x87d4e2e852c2b0d1, 0x31cf8b16862068af, 0x13b9ecd111b0b172, 0x36b0ad52bc5850fd, 0x312d947cd3ded646, 0x43e19b3ebb730f5e
+, 0x5fcd73a97d9921a1, 0x787508249b27a5fe, 0xe2c68c09aa247f06, 0x58d66ad4348efb16, 0x3736717b5e9ffd26, 0x6945070af31354bb, 0xe7778820de92bc96, 0x3bc75591cccc15d4, 0x371a454cb3bec5c4, 0x64faec7f7c262240, 0x455a9893748a1b8b, 0x4c922e17aeee6bd8
+, 0x213e862d75ec0bb8, 0x4adf0b8ecfe921b6, 0x6baad8fd414edd44, 0x6f6262d71d365efb, 0x4807cf1410434485, 0x04dd95f6b96a0805, 0xf42df38a26339103, 0x51c1f7f093fb0b56, 0x7b2448c064063a3c, 0x433564fde1ba024f, 0xc255fcad3dbf6921, 0x0c67f52c6d0fcb2f
+, 0x44f0c64742ff8317, 0x4ca0b3c61d14b4e9, 0x1db13325a2286b99, 0x3359691ada731559, 0xb014a870bb3ab2c1, 0x5fd4d28d0985de17, 0x1be2c5f15b708e78, 0x3e0786b27f322830, 0x26437d31a9bca24b, 0x035da51fee5d1504, 0x86573e1714ba7fc9, 0x61f83f7e1c79f0a3
+, 0x87dbe560d9396793, 0x318a307af81d7c5d, 0xa44562bbb40e30bd, 0x5b6bc2a71748dbfc, 0xd3914f5b80e7642d, 0x0494f2c5e073fd77, 0x1c45cc239a9b24eb, 0x7f502171c65362ad, 0x5c410c7e7b806b80, 0x60675e4c4a894c2c, 0xb03747576ccc045c, 0x79cdcc36289ac2c2
+, 0xe6346ffe96213dff, 0x32af731be3f30020, 0x4699b9d07c11875b, 0x0e74174c2709c3de, 0xe31076f48f6a2ab7, 0x6291de0ab76ddf52, 0x107a3f6c7a61e422, 0x5cba45951568c1d1, 0x095ab3ebbf525e77, 0x4de223653c781cf7, 0x8f11a704276f0b73, 0x037b744cf8be6aa8
+, 0x43c82d592fdf772e, 0x68322b6c89faded1, 0xfe7e311b6f2fdc26, 0x3f60b11f1a89f9ab, 0xbe67d0b3875f2818, 0x0bb1174ba390fc29, 0x6add9d0d05ce1f4d, 0x1a2209534e4f3cad, 0x205555c13716b743, 0x132ae12854af5616, 0xf7efc04ee5d3ebc4, 0x0122cb1bb3347119
+, 0xbcc7cda7904afb06, 0x685a555c7786a7d0, 0xd56c30284af395af, 0x22d13d10e489e3b6, 0x86b3c6197e8d7ff6, 0x42d061d828053bac, 0xb6c25b802013ae52, 0x13860c1920d0a4c5, 0x73645eede983b742, 0x2a4fd092381d30ec, 0xffd34702984475d3, 0x7df54a99b27969cb
+, 0xe4c7dfe5f0308352, 0x052595fe007b3871, 0xafdb5d10b5c60cd4, 0x06c110cb73c0e847, 0xd73db14514acebe4, 0x6b103a9807dfbd38, 0x6e8910160b77a223, 0x598265811ca579c7, 0xfe2095baab03ca82, 0x7d1175779cfb52fc, 0xbfc845f062e3dfc3, 0x75fdbb6a354048f1
+, 0x8d5191616d4b5daa, 0x7f285500bb8749bf, 0xe9d178e6c303fe37, 0x73bbb80d34fc6862, 0x78d149cb880f9220, 0x64f7c6f235aa1b3c, 0x179b742a820dd137, 0x37e4084b6da31184, 0xa7817d74a337789e, 0x2620d7e598623eda, 0xefbf447064781afc, 0x54ce2dd4ce12a512
+, 0x98688f095efff6b0, 0x0871e1264cad3a7f, 0x7c74a9c38c60cd2e, 0x219152a40bd2e5b9, 0x6cf82a560786d881, 0x5fbf0fec0b145999, 0x2b76c3fbb7ccdd35, 0x200b34a7cddacc89, 0xfde428135613f2af, 0x307b3d2ff6250bd8, 0x94f7f43a48ff9d04, 0x599eed40e4a84fb9
+, 0x7ff466ba37e0f3dd, 0x5f373c3dc231ad17, 0x2dae9484bfa1ab8a, 0x222443636b19399d, 0x11da868fc0d8b9fd, 0x55c4301f950de6be, 0xa8cd1fc776e239f3, 0x262936e1b85c5f92, 0xe25fea152bc7c15a, 0x5bda8681fb261dae, 0xf48324ee9c49af9a, 0x4c2ce8a189ad3c82
+, 0x97b8c8f94ce38ad6, 0x6f7abf9a9d1455b4, 0x630d69f7e8e9bbb1, 0x072daaba7df5f52d, 0x844d74218edb1d88, 0x5dc998a74a2ed915, 0xa9ab2b13e4b9c8ce, 0x4f093b2387f2d987, 0x1011e78f7843b160, 0x4b003edad1fb42f4, 0x216e252e41593158, 0x600f742d2dd36ac1
+, 0xc66c4b3c629a7d91, 0x1be108c140655304, 0xdfce9bb1a1500aa7, 0x6ee8220115f923d4, 0x392cbc92ac91a475, 0x77b455b4c0642f56, 0x972f59b5de67353d, 0x485ccfbf648bc798, 0xd5672fd48cec1e9c, 0x64b6703b4b01eea6, 0xd022ec995536b00b, 0x3a8b69571af12007
+, 0x15358bdf60dfcb8c, 0x4032db0d4b579deb, 0x88d827fd184a38c9, 0x2f2e726bad74c32a, 0x4be2c87d976139b2, 0x34a5c2831dfd23d1, 0x9f63a97d370d8d59, 0x0e68a0fb9682da68, 0xedd5b3530c8b8e88, 0x74c9fba9b0f55f23, 0xe5b65d81bae86266, 0x2fe9b853486cd6f7
+, 0x2b4b922910c7ff64, 0x6e944f978d933c82, 0x3287274ca5a45ab0, 0x2f1194cddf2b2b02, 0x12aa4f8590964130, 0x676bb0b77dca3761, 0x6e54f5030b5eff0a, 0x4cf350b196c2d959, 0x21cafcbda244b7fc, 0x55721300a5779204, 0x8e0ff0bd973d08da, 0x35105890d1de611f
+, 0x7af3b7f15d062d7b, 0x20bd558c4f6ad949, 0x26e47c7a6a58d5c9, 0x47f4dc834defc69c, 0x21c7f03300a07c51, 0x671f786481cbeb4d, 0x6a4cd47e7f35394f, 0x35994b020dcaf2ac, 0xa146f6902d06c33c, 0x6fc042a125f7a4c0, 0x988cb77b2f6c5503, 0x733d0781f95c9283
+, 0x7195d674d9a52f0f, 0x5339597c7c7af0dd, 0xc564a1410781aa7a, 0x032a1127ce7f2bff, 0xc93920e342779f52, 0x7f15cf868ae7bf14, 0xf7786892fa14f8af, 0x21d2721b143026e5, 0x800d776460a3c7b6, 0x6541d6ee60bc69de, 0xd7bc0a7eefe811b0, 0x72b1bcb54fb80726
+, 0xfc8d6a36c44bef5a, 0x5a9f05a7878c6694, 0x4801b2bcd5a1d5c5, 0x23f0482330041815, 0x46b83bbc376c8d15, 0x2d0e5ba629e76844, 0x7a9dc5a68baf4bce, 0x1df616527b06cce3, 0x28697e669bb4c63e, 0x77a43bd1b7d8903f, 0xc1a7d34b343cdca5, 0x44a1ab88161b26c1
+, 0x517f2138f2410845, 0x419b9fb2fc3c7210, 0xfa70839fcf1c3dd4, 0x159b4d84a541cfb2, 0xcae2ee94308d83b1, 0x6fbce2bbcee4d8a5, 0x230732a4d1b7f581, 0x5d1e6696f0b42bda, 0x9546bf6777a1ee6f, 0x3323a9632b6bda23, 0xa9fa4208776f3485, 0x7ba2cac7cb604247
+, 0xd6d72d26bd5ff9b5, 0x415c5cca3016dbf4, 0x14e94e83d24001a5, 0x22ea0f5e4bf2d83f, 0x91801e664c73a09f, 0x29ba659352d4d34b, 0xc5064d17f299ffac, 0x0e2274232a0db69a, 0xdea7dc531b3610c2, 0x252e9ad2951ab6c6, 0x1db999e6c0a457d6, 0x50221937bea3bd5a
+, 0x6e14d4802e756488, 0x322bf3137eff7d05, 0xce840bd669e5bf7f, 0x66de3f18f382f833, 0x5955a147bea8061d, 0x54287b6859a99424, 0xad9eb81d540b4bc4, 0x03d444ae6726d5d7, 0xdd792f2c57183aa5, 0x5efd4afa0c89a1b8, 0x3f42e7fdf72e1c1e, 0x5092472b4582185f
+, 0x0d946191319e9f65, 0x683fd9e1a08a20ce, 0x964bac20a0dcb974, 0x46a1df2a3deb2f2f, 0xf46ee59d03ae8252, 0x4e7dbe45cb116018, 0xb3b839a48db5914d, 0x0252b86a5d6ade00, 0x7dc93651b6103765, 0x5f84f2d286cf7144, 0x084f64820c81ac44, 0x5a6566f504ba75bc
+, 0xde2d33da78109d0a, 0x22252f4673a1f8ef, 0xf5957991db71e396, 0x7e9f96fae529028f, 0x5e2b5a82a5c253b5, 0x63dc4ffc9dd35812, 0x07473963ff8ee74e, 0x765f946c5fc9fbc1, 0xa8fa2de2cc5d0b23, 0x2532676f792e2937, 0xf6e75f568c733dbe, 0x1516d2bf3acb6764
+, 0x418b449e779a69b1, 0x228ca014ef73848c, 0xbb14373ecd3751f3, 0x6e4f923d2c813259, 0x1556753e7a69b240, 0x4f52e602c9b4d3ab, 0xf6be366368998cca, 0x713bce12977e55b4, 0x16a6bfa0d9873d23, 0x4faa3cb45b26985d, 0xf6efd32dcc578fb2, 0x7969918abeef2990
+, 0xd0580b4331e52a91, 0x3a71034e212bedef, 0x07d7e58cda16c0fb, 0x6d8b5e251802ec3c, 0x5faa48a0390240b7, 0x6d5ed3acc9832155, 0x3df1e90c7ac8bfe8, 0x67ffb7bcad2f9079, 0xc68571b475ef1848, 0x37db0b5f015f1f04, 0xc45348f703b77f62, 0x68715ede0278f0ea
+, 0x4eb8061b26ec0ca9, 0x2fc8a3ea45f27790, 0x6af040a05f1840b5, 0x1fcfd3b635de6d42, 0xbc6e8cc774c7edd7, 0x27a27c351d803edc, 0x7029909fff6d181d, 0x4975494e462667ec, 0x16e3a056ae590c2a, 0x5a49733d402392ff, 0xfec28d0bab5d6bf0, 0x6883ab256e64714d
+, 0x63c36e54c88f5645, 0x6c37d6fd6b616342, 0x607579e4eeb442ee, 0x118113cd7acf5bb5, 0x8f788aba99d29b44, 0x6cc19a09c1fb3330, 0xedf304bbd38e33d9, 0x325242f204647d59, 0xa6cce4fe2a0fe06d, 0x45e13fa9d5b0245d, 0x1c06e61a5425c212, 0x7fa2c9ced77b0fdb
+, 0x32378f608c782f0f, 0x49a01980ed9af7ef, 0x45e29c351915cc3f, 0x53215513ad063de8, 0x3e08ef7f14deab2b, 0x7110001ab19d16c4, 0x388a119d3841892e, 0x748a15714e8f5d01, 0x82590dfe25ea10ab, 0x09ff004e2cdc31a2, 0x9e496ece3df1ea3f, 0x2f5c4e8c13473d8a
+, 0x843aa71cf9c6e3ab, 0x1723d1d5e0a0d5fe, 0x96fd7013d0a69f85, 0x43bbbc9a95e3ffea, 0xca676d9d9e9a60e3, 0x079b5a63d6f16c01, 0x64a088838793af99, 0x4d71eda5eb602d2e, 0x38a723667782eb82, 0x5b6ee0563c258428, 0x85ef5911de1d5a32, 0x47ac205943165871
+, 0x90989359670f75ce, 0x6261faa1fb736482, 0x2fbff54f14120d06, 0x4eef1558aa76e746, 0xb9304f6bdd04bf3c, 0x0d11fc1482ca25fc, 0x112971b25df2d162, 0x35adfdd1079d19a6, 0xdfc3ae564ac70a8e, 0x7ea7d53f29a1d8f1, 0xd4b8122dc37218a5, 0x3fb87745db5d216d
+, 0x6efeaa912c9c2961, 0x26dc0db0bcb5caf0, 0xee8641e524c842d8, 0x3c23e54e5ff1cec1, 0x8dd0a843ab2b1802, 0x4fb66703f353d2cc, 0xe42b4573715b80a7, 0x00aa68265343cbc7, 0xf96d2dc573e86104, 0x4f4a43541b17d0ef, 0xf704ecd67397bbd1, 0x6cf8f0c050da86c3
+, 0x1635fd6b0b04b4e0, 0x4c8e2f16318b3507, 0xbbef9c3da66d7d0a, 0x375d9c3042e780a0, 0x7a857d71f66bca41, 0x09c5e2db075a06ba, 0x6ecc9fdaf954065b, 0x0ada1c3871ab9a57, 0x54f7dea1be8fe9f4, 0x613dfd67034d0605, 0xc669c218d277fc94, 0x0f2d414745cdd96f
+, 0xdab25c71c7664fda, 0x421d00989c4da543, 0xd6a94bbcb2f1078b, 0x1017ac315f515101, 0xd91392162214542b, 0x21898b77027ab581, 0x2a5572ac35ab0918, 0x49304d0ff7b6c3fc, 0x3105e2d3537db39f, 0x193e36aa495684b8, 0x97babb3fa2668081, 0x2923d41b85d2d55f
+, 0xcc2471cdab912fc8, 0x25271dfe32a0ad8c, 0xfd23bbda62f3358c, 0x11326638f914b8dc, 0xf54a93b0f5f7306b, 0x7f56370e17272cbe, 0x8b02823dec714c5b, 0x56409e4051085e86, 0xceaa6e15f0702fbf, 0x344490d2e186c67b, 0xb5e0cddfff2cf322, 0x7932b9b8db187fd8
+, 0x0fb4175f5e911511, 0x579af43f7e245c60, 0x4cd3f05c5492d42a, 0x63caee12d20ff011, 0x69f8287557f55a20, 0x54aff140c3154929, 0xe711843b1cf98984, 0x768f0cc0a279b33b, 0xdf58dda0493ec419, 0x463c1a2159ea1e68, 0x030cb3d1611109f5, 0x2aaea381a6e6c7c6
+, 0x0171de1ea3785c6e, 0x6184d3f1f9fc5b4a, 0x31e46c103a591f54, 0x7191183279df00ad, 0x2376e3a1e72c6bc7, 0x2bf2c0eb88a12d9a, 0x65933d10b2786e96, 0x6fa2a6b7d4a8657d, 0x83d22598a55d4122, 0x19144632da99da4f, 0xa2dc0e327c2ad50e, 0x0b4d989ef8002f0c
+, 0xff34914b14932b1a, 0x79db057f020ea722, 0x7c7b0a11ec65189b, 0x182305bb859a6bac, 0xd72823876076ebed, 0x134d6cb2cba31c6a, 0x620e6b0c6538bc92, 0x2c2d327ae49c9f4c, 0x366c0c7e70ed3bb6, 0x4aa99552abd87869, 0xdb53108cf6c86049, 0x57d62fd1fa5ef7ce
+, 0x753f8da6219c46dc, 0x0e06c798cb251b4c, 0xf428a135b4077ee9, 0x70603b3724181af7, 0xf802c35f4b4075ed, 0x26ef1ad28c46be2d, 0xae71b7f0f0d8ca6c, 0x61ddb9df0ad68ddf, 0x57c7ab009421a2cf, 0x6f621db19b032e8c, 0x8ee26b3a492f1421, 0x33d758f7c24662d3
+, 0xdb8e2984c78ebfa5, 0x3b2558b21fc5f18f, 0xd7e23f2597aca93c, 0x4488f372639681df, 0xf4c576831e86e544, 0x718f67b4bf8b1a27, 0x17eacd4066c8d680, 0x6c0c842b6972780c, 0x026d753aa9f92fe9, 0x1c79bcbf19ea633a, 0xcbaec62e98f7561c, 0x52bb119e875c9887
+, 0xe343c01bf35fc0c0, 0x1964572ace8e2e3f, 0xc6a7b02bc9d6c760, 0x51c08f4a15545860, 0x3fe82a51d33b8507, 0x4425ca6dfde0c257, 0xbcfc6e3dfaf6ea26, 0x7d73692f79de5cda, 0x99744a6524676b33, 0x460419e62ffba2aa, 0x32ef3f60f62fc710, 0x6559f367a8afc8b4
+, 0x60a3fdcfe59c5bc1, 0x51f1db713375e1da, 0x26d279b58742dc2c, 0x08e67f009ce15938, 0x995061dd3d4b47be, 0x40f9117cdd5d5ae8, 0x3563f153af5a52d4, 0x101fa78bac85dda0, 0xc4ddd8a7abfa6dfc, 0x5c98abf1fbd70176, 0x5979432a7785906f, 0x3f7e3b4acf314e52
+, 0x6a67b3c3fc6f374d, 0x787afc99e9942c03, 0xc04d764dbd87c27e, 0x56ffbc796832f506, 0xdd71613fe41c757e, 0x3744f389fa31ea94, 0x1614ef3b2441b3f5, 0x3b7932e17db6e632, 0x209df27e490ad28f, 0x10a0dec54ed265b1, 0xf748b46d1022d63e, 0x2dabffb19e86a4f3
+, 0xbfdeea1c8932be1a, 0x7df622c8bf867cc0, 0x3b98bc33a326ef87, 0x0d4ea00c0fe6d068, 0x210457401211c0dd, 0x116d8f56a71e2b87, 0xcafe995848a102dc, 0x63881243f06289d0, 0xb86db44a6e45f563, 0x68946dd8735da69a, 0x5d896d8d3d700387, 0x7b73f80c78576cef
+, 0x938460693f87a4f5, 0x6c08cd22bb24ca42, 0x2ab54f4f0e970475, 0x274651e65d07186c, 0xf2d638e4104c2d19, 0x760164058f63b6a5, 0xf4c0f31e62cc7f63, 0x77d8ffc72d5c1f71, 0xbbe5391ead25b088, 0x143078866bbbdc3f, 0x465563cedf3a0b3d, 0x2605a9dc4eb2827b
+, 0x2943cc4099ffac03, 0x593e44cb11fec998, 0xf0399d1fb134e01d, 0x7391ec2df7b3afcc, 0xaf213d6e36ae0b8f, 0x6e2d171e6649e116, 0xa17322f83224def1, 0x076fc4276f5489ad, 0xd6d70728e023ec92, 0x644c45e58cdf5481, 0x4a73ddb57c710ba7, 0x34711af2e901ae35
+, 0x1f10e481b63c1d3d, 0x4dc697e08656b4e9, 0xb89059abd94cda32, 0x52d22d1c30654ef8, 0x2c9f88e73e5ec0ae, 0x7c3362ae12238b93, 0x7777e14f796869f3, 0x53db43000df09cae, 0x15354f916df03552, 0x0e6b65f4ca4f0aa4, 0x3215f1ceb4bcdc0a, 0x6ff336672387adcc
+, 0xfa831e77eab54642, 0x42ca9c9764a67e2d, 0xec57b3107f15c876, 0x1a7cd6c90f44d864, 0x1758fb63432d24b6, 0x584e3eae651c8c0e, 0x1ee6220f3f53b595, 0x0666aa7dff775120, 0xf1add4afd2e63ad1, 0x697f1dcce5e6f65d, 0x0492538f8d667ed3, 0x74b418ffe42d384f
+, 0x705893b5b230b394, 0x74b8cd2a47aa05ab, 0x0ba99f3840186841, 0x5fe6ace3681f901d, 0x0a1f088d98dba8a9, 0x0822d7d40fd842ac, 0x1efba3bd0c645d72, 0x1bdea5572c3729e4, 0xa85373f20193475d, 0x4617052b0178aef8, 0xbf78faf2d21d332f, 0x262115c1f1dece2e
+, 0x052e95966e4b7979, 0x52a47fe9727e09a6, 0x341519ae9503dfbb, 0x78f00cbfc56163e1, 0x15c75f00a50afa31, 0x0af1fa9138898bd0, 0xf599b47ee929498f, 0x36f03e8696dba02a, 0x5508a69144d6ebf2, 0x311feaafc9b80d8d, 0xaaf908b86e2a5c6c, 0x4bc57026e6ecc657
+, 0x9277dda4dd0f3292, 0x3839daab184c4b4b, 0x049dfdd696419129, 0x59c9a70192f5e8d7, 0x29db235a5aa87bb2, 0x3f20fda0f6d68d5b, 0xc94f5a5cc509d212, 0x433e0f1d6b16510f, 0x3f98ffef5a2a1ad9, 0x417106979a88666d, 0xfe8c9968f6283469, 0x10fb77e1f1b02d18
+, 0x8d7e21c180de1186, 0x6a4ed7feab4df90c, 0x4bee56bdbd62a46f, 0x0f5e64c7b9a98748, 0x5dbb9f422cce2069, 0x151b47ca86cf7395, 0x87a09b7b07da7625, 0x55aadae2092d1cee, 0xc5ea82db869a9977, 0x0f13c4a0f204a9a9, 0x808d0a014bc38131, 0x6dbfc560a6103ff9
+, 0xecd943f067f83434, 0x636474cd75b46a73, 0x4941bdef52532b03, 0x76e9f1abc76c8b96, 0xe849ab8397440302, 0x7313c0992d4c77e7, 0xc06018d213280c00, 0x1e80f1875648cd0c, 0x0b339293b361df44, 0x7d02be89aaf5378c, 0x5ec4ffa6565c6d85, 0x39b0979bb3fa99d2
+, 0xf3d743ff6a041cce, 0x50e296993a1fedd4, 0x7233300139d25ed0, 0x778c65ba3fa08e45, 0xfe3dfed7a10f4954, 0x7e2e6db2c2832847, 0x6f763383eb25bcda, 0x574574bbd02f6594, 0x0ba21324476b34d2, 0x6b544b10a409d130, 0xeda232e89aecc29f, 0x1fb844f309c510e4
+, 0xcf251b0a4d493640, 0x69850fc62acde9a0, 0x38511391194aa214, 0x391e9e319a5c4681, 0x8c4212deff978aec, 0x107375b4c52921d5, 0x5a8b9737dc967406, 0x10a196d888d97c4a, 0x3f1f7a492a4a37f1, 0x40891cd4017cf877, 0xc3a7441f00a1fe5c, 0x4657bbc529098ff3
+, 0xdb9d28c86a564cab, 0x673a5be5654955cb, 0x64244c368f2788c6, 0x451c81d6c58de26b, 0x37d1fd92298d5766, 0x785b476fdd402674, 0xd44b1696b2096bbf, 0x276ba68bb386a576, 0x356b8ccf788a4b39, 0x45b60fdab7701bfc, 0x8b42de7990207d09, 0x14d5991854e3876d
+, 0xef598823a17d6ecc, 0x3ff92c1ca377d986, 0x62832411df6fb0ff, 0x3b17eabe5cbe5de2, 0x7945e2b3548180f4, 0x723e07b255d4d8fc, 0x1de86e1babb1e828, 0x1d250ce1c12592b4, 0x9a04015d699dda00, 0x295bdb43a589e555, 0xcf7fc7ff2b942a1d, 0x56861456bbc5cc44
+, 0x887760a215611afe, 0x202300637351550f, 0xa68aa379837b4e24, 0x0a04315bda11f473, 0x26f506724db47f47, 0x7f1cb51ece4c01f1, 0x9a9a32bbe5b68260, 0x4940a255cf8043f6, 0xa3e3c46aece5d28b, 0x3f42a4b8a59c2b33, 0xb598b9bb171db58d, 0x2c36fa64d27ffe8c
+, 0x419839cc043d84ba, 0x3c3630b0f11ac73a, 0x7f1937d2ed3f80be, 0x5bea2a802ce334ec, 0xff1b3aec4e352ce6, 0x352d48b6395daed3, 0xf1fae50229f63a58, 0x304a47d169dd101b, 0x7eb6ce32c7365304, 0x3b9076db3f773065, 0x6c8a7bb063d70f11, 0x4c97f314db36ec22
+, 0x09d102e67fbfde89, 0x117a941af38fa896, 0xf50ad33a07d64e16, 0x6b8ac435d9a66122, 0xc6cb08b0eaf515b5, 0x2f8190021426fbfc, 0xc2c6a27b7767ce64, 0x41bc78e3aaed64bc, 0xd1935ee84185a3f3, 0x28b68bdacd610385, 0x7c25187283229705, 0x55370ff29988d0bc
+, 0x0a3ebfd803ba8134, 0x25f36a59c5963f7c, 0x63e360725337551f, 0x1d8089ca28470401, 0xdfd70d147d9f908e, 0x68f9949c11091aed, 0xa1390ee3000c5a29, 0x26f2efe54f61ef10, 0x70354388da716c03, 0x20e24a5754a0ff0e, 0x372aa33c2884b698, 0x0a23f03936ebb029
+, 0xf8ccf92b900fc830, 0x0cb5de361d95cd65, 0x61910b70cdcde45d, 0x1061f139567d1fb9, 0xa6579b4a40051e92, 0x1c2ea4b70325f398, 0xa1bef9da0586f593, 0x52fefbd2024429db, 0xfb3653494089a278, 0x6fe8a24ad4dec25a, 0xa407799968404e9d, 0x69881b0deb0ca0fc
+, 0xb618babe40668e61, 0x54878251f8107308, 0x98279ddc9327b7f5, 0x6bec5ef34515fa4a, 0x33252e19f7874d34, 0x040f81f26bf71f06, 0xa5bc8f5f330061d0, 0x7cb7535e1620b029, 0x5dd03e190ef09726, 0x4ee71a1bdb15038f, 0xe296e0c7e3526e48, 0x29b134f72c16fb51
+, 0x4b873ed1ceca2de0, 0x5332ea18109bb7c7, 0x52b5cb8883c9c67d, 0x65125d6e95c476be, 0x7bdd9bbcc64f72aa, 0x5ac7deb3cae2cd43, 0x664a84e7a122f7d4, 0x3fbc2d7151736d80, 0xbdb9762e5bd343c4, 0x05be94c68f72b431, 0x0d97451bb4a3f3b4, 0x74eb2254404ace40
+, 0x0d2449906f05ad45, 0x0b1a227702f429ba, 0x0e28872581d477ae, 0x5c1f9662e832130e, 0xd2ecf9351e23f8be, 0x57fad6d0c8648aee, 0x1435859a80797188, 0x2b771e9d738c7eb7, 0x7aea5ed6cfb63628, 0x2480869429cab3af, 0x3c39e497fefc4520, 0x24db4e365b39db5e
+, 0xa2648942445dfce4, 0x299cb58cbce0c34d, 0x9b855a71f27e255a, 0x068fa0d9d8753364, 0xbb2bc06ddb770f27, 0x3fb52d504aa3f940, 0xce7570c1eb8343c0, 0x7ed9d96fc58ab40d, 0xeaa7c84d77997478, 0x207fb49f06a09472, 0x51aae89efa29ba55, 0x70f72294a3a27eb6
+, 0x02dac91b0766fa7a, 0x79a594a96938748e, 0x6c5d0a3fdcd8caee, 0x1e0de98cf61be7e3, 0x858d5b225cb9056e, 0x4f0e971813fe424e, 0xe86c30b670f26955, 0x6d2537b1a1754e42, 0x100d4c8bf6627ae0, 0x6d99b9913d356041, 0xbf2cca18cac00cd6, 0x0a436bf716ea62cb
+, 0x5e9676c5f42bf9ec, 0x3d1d280942ca5952, 0x151dd10788f83a67, 0x140159f38c6e2f4a, 0xfd9d2a2298fbb44b, 0x3278ce048554d332, 0x56e515c098f4a911, 0x0ae483eff1da8f13, 0xe07069a72335d6f5, 0x3e87b3974087dc54, 0x1ec7eafd9ea3fd24, 0x60c98ed77646d6ff
+, 0xc3e6793f9cf706f7, 0x05be8dc7761b9213, 0x26e84945481dd84d, 0x55350630dd7f7e00, 0x6df465f18d787121, 0x49f8fa8bb6b590d0, 0x7d0cb97acb95650a, 0x1a045beed1d443fe, 0xfce5a145920e1d1f, 0x4963144a1c949021, 0xbf7198e468acfe1f, 0x74227e5508a48f5a
+, 0x60bb382331103e34, 0x52f3dc79023ec502, 0xb8bf31b03b156167, 0x4a6e08e2952dc135, 0xe11fc18c3fca4dd3, 0x697c07052a2a1a38, 0x5fd1eb9e9900df9a, 0x5d7f2a5b8f7d1282, 0x1ba4b512412c1562, 0x7bc8934602b77c45, 0x6042edfae2b7b122, 0x36ccd5afab861cc5
+, 0x71051b88d52d4384, 0x2059a0ab3d87611f, 0x52f1fe63a64e3f93, 0x2dd7e2c3c7059b22, 0xda27866697ee279e, 0x2bb56ad229477c2a, 0xb32f2b0192611e05, 0x42023018252149b9, 0x88e57055f23ea1e4, 0x495038a825b9a114, 0xf453759279db3147, 0x6b956fe3a2ceec36
+, 0x63a6c252e4f89d98, 0x68dc948f477a4c82, 0x82e533ea52b9a2a6, 0x09cf67d9adbcfd67, 0x36489d5958c75814, 0x40fa5093eb70ca65, 0x0e74ca5151d1698e, 0x5afe854006697caf, 0x0c3f8fcdf9e09a4a, 0x103e54e6e6cde9d5, 0xebeeceb6b0fec625, 0x364e7cdea9aedd49
+, 0xd9b688ff39502e22, 0x0f731d0363162fcc, 0x2abed640d624d0e4, 0x7ea47d74b184d782, 0xe9cc6c855cbc43ed, 0x3b4be838d1e42409, 0xc7792149271284ae, 0x486baa6ef342f2d0, 0xda8306cbb6c9f3af, 0x765efdd863ea6b0e, 0x031a7030670cb123, 0x0e59d30d891ee8c1
+, 0xe87b2453b67562a8, 0x70bbca747ead9201, 0x8318abd19e84b85f, 0x0ffd744df36231ef, 0x8c9b7337bafc550c, 0x734a0acc1c58ef6b, 0xb8bd45e16741d911, 0x49cc0d3ce96cb468, 0x9f6e7e2e35b9ee39, 0x121dfaa53e4f774f, 0x38341269318dd841, 0x1e178e8cf528613a
+, 0xf2f42fbb2ab006de, 0x55a1ef2f5f403fbe, 0xbb813939f137b15d, 0x3ea45f33ccba02a8, 0xcd6fecab6b6d655e, 0x20627ec60e9d3e18, 0x3fccef3b8c659e7c, 0x366c28574268b87c, 0x2d06d1984bcb71aa, 0x288f29c9b6a62c6f, 0xcc2c6b48a91de28b, 0x51200a5b9db7d6b8
+, 0x6abf67a79857d487, 0x4d750666b9bbcd57, 0xcf06f6c0c86b24dc, 0x10ef201cac432703, 0x4d8a809790f468bd, 0x77d2c8e38187fc75, 0xc9c064f165e3cee2, 0x16535f10649b2a51, 0x660883ee92e19b00, 0x1bb7f9f31d226403, 0xd7d01c4a0a55a28c, 0x67e26b1d02b6b8ca
+, 0x7cdca4b9a54816c5, 0x7f9c42be685bd0f7, 0xc201c8e9c49e3641, 0x094b8b9a13bd1ae8, 0x5da9598e6d176505, 0x1e7f5054a3377f18, 0x053c59ecbf6b9e9a, 0x0c39ff563a443a0f, 0xfefef32a2b04428b, 0x4405c34aee3e0c8b, 0xc80f38ae815a54ea, 0x79c65e4a44ea5287
+, 0x1b246c5a9e706782, 0x4d454daa88c45c19, 0x7093c07eaa7dfc1d, 0x79cb0bed683226c4, 0xb4479f30563d858c, 0x05b4b9689c31476c, 0xdd79a74bd28577ef, 0x5984ba18aec109b6, 0xc9ade8640f2ce587, 0x205d6d13e302dc77, 0xae574d9a1ed01745, 0x3e9eb427a41ce731
+, 0x844c2439fd0a6a0a, 0x54362ed7ca6dd744, 0xb2d9138376a5789c, 0x6b474ed2950ccd4e, 0xcd4f6c89a3821904, 0x22396019e49aaf6a, 0x4df613a266683d0f, 0x2cdcef23ae7c026d, 0x9a95c6716073fa18, 0x57af2065ed0accae, 0x32c11d49b704f2ad, 0x204c183343df0629
+, 0xab4338fd0d901b6a, 0x4c5748c8d9853280, 0x3a11d62780675b92, 0x0b71c1c9784d2331, 0x13ae13aad041a30f, 0x249f190d33dd8242, 0x1597c2396d78839d, 0x10c6a9f1bd4117e0, 0xa58beab39f96d869, 0x69236952c3abe459, 0x3530326345261cb6, 0x48e7e9627142b6d2
+, 0xb0b68a049b01b096, 0x3ab509cc263f821e, 0x2a8eae409e80c89f, 0x0533d2ce849faff2, 0x195d35eda608cc92, 0x6585223fa82ed17c, 0xa63a6930c6abe6a0, 0x019fd4f6eccf4dfb, 0x2278ed33dc322164, 0x0628d4f415e1af41, 0xd00d9337a52a6f8e, 0x6750605969617912
+, 0x38189b92e5addf26, 0x4039ff82f0afb792, 0x87cef8a3333b3f62, 0x15d1ffd7cb5b8f63, 0x1267b6906c01787a, 0x159cde9798654a70, 0xd05e6ad74920d180, 0x764cbc3e84a0f32c, 0x634d928e737e8fae, 0x79c469420eb89762, 0x2f6f040102ac012f, 0x6fd0f2207dfc025d
+, 0x5d2e29bb084fd6ee, 0x20308f666fa33b6f, 0x60b4365a42ea8858, 0x1dc45fac1374dd1a, 0xce3ee079a2e23f17, 0x205d095b49571179, 0xa4e820a002b99ebf, 0x30b5528f4c6ba8f7, 0x7fa14f6dbee91f6e, 0x328f3d889c786797, 0xfbc75332b4f905f2, 0x08c63a92082e66e8
+, 0x9a1f615c091e1fa7, 0x653ade5f93b51f95, 0x25b13275b7664226, 0x5c93ca10d7856ed4, 0x59a51430f27736ca, 0x283698b40046dda3, 0xc5eecebb1648ab16, 0x52b7ae2298dcdabc, 0xd9091a823b0a5d10, 0x4c13e9441a37f925, 0x41c7c921bca0d026, 0x76fdaf48c424a809
+, 0xff8d2c1d0ac16edd, 0x04c414dd74ff484b, 0x6773b6cd4ee5181f, 0x4450dc746ceeef0b, 0xb54a71309a5cbf56, 0x2f5d6fed0875b3c2, 0x349d1599386d4f72, 0x171c3a06c2a53b6e, 0x9f7fba56d4ccb511, 0x375f7c03f38ae641, 0x390182404f57d9e3, 0x486406cd7e1f3d71
+, 0x15ac66fa9e7b955d, 0x55eacd6ad5d54595, 0xbe12f1efbef4c8d8, 0x2e7d546699b2d42a, 0x5e0ea2d3d9d765c3, 0x6a1420b82b3e0974, 0xa772f00b4d599a89, 0x6f466916cb185c6d, 0xbb392d9878aff1b9, 0x5283f16be533a9fe, 0x39567c35dcbb79c2, 0x5abc57d2fbead567
+, 0x0f350fc12bba0a53, 0x52d6e1ed04f6b36a, 0x9f1c1497a9ef94ca, 0x1873c4489fb76978, 0xba5291c103e9535f, 0x364fd4cd00f5fb3c, 0x67d3c21d04385635, 0x15502b4d77ce73fe, 0x8c4116c30d1426b1, 0x0a464b40ffc70281, 0x6d49934b04029bc2, 0x6c1bc57aee888c9d
+, 0x362fd9343b162a28, 0x3244cc29fc38d1b9, 0x04b6ec5f8907c843, 0x45dd82f6931a639f, 0x06408994e8d337c5, 0x5f8e396f3708f2aa, 0xd36eb8ad0d4dd074, 0x728f62a97e0725af, 0xe49d8c7ccf5e3900, 0x5f03bc5826521f04, 0x765e88c40c0a93dd, 0x3581adf8ddc4e11d
+, 0xbe1d6b006c100992, 0x2e0a7d70573cce09, 0x0182d3d7cbe83f29, 0x561a57003e8cd51e, 0xe1534ba3b4590866, 0x3e149bc0c8e510c7, 0x9351d7a941ee5540, 0x6351d18c112d68d6, 0x40726ce5a26f62dd, 0x75a41563f8ff661a, 0x49e7034b0f1706af, 0x7e5ad7345f46a1b5
+, 0xd3144d2c4c4a615f, 0x553f7cea50bc7cb0, 0xf1a0472adbdfeac1, 0x229c3003141d5815, 0xd7cc033ffcc6cb56, 0x3a81ebb8a24fd4a2, 0x710507a5a5b9b1d4, 0x46867e79f705683c, 0x0831d67fa9a1067f, 0x4ac711db5c1cf583, 0xb1d02527b9178c94, 0x2ac9172b75b510c5
+, 0x1d174ad8e711560c, 0x3373842c27367dad, 0xaf9962b803ff24bd, 0x36657f444e9ddb33, 0xc7b11e760a2588fe, 0x4e181b0475059857, 0x025edc1dc8ab3cce, 0x64a359e280af7316, 0x3b16e82ee5c8f132, 0x190930bdc342dde7, 0x91d0f67ecbaeccf8, 0x25ac9448626ccf52
+, 0x67eb8790e4d8dcef, 0x7fa3c20873508208, 0x5f9acb027c5ef6b8, 0x7ad705ac31b8c31c, 0xc4c6b28dc3be0ed1, 0x6d0c20dc490caf18, 0x9c25b2e8fa4e8cd7, 0x3f6bf9b2b8223d00, 0x5a3df3534ccee5a5, 0x10c07e9ed4ae5f82, 0xa6334b7f0e5c57d9, 0x1fb12528c4e734f9
+, 0x41acc1383e332819, 0x30ecd2920078dc39, 0xecd94caa20008a2d, 0x340536556385c7cd, 0x0b562dc105f65b16, 0x56d7d6a4a63cfdf1, 0x7a5d62d17a681190, 0x5081213937d2014f, 0x26e5829a4f819d8a, 0x2244f112e7799086, 0x17018d7fc83a64c0, 0x64417f7422ab7908
+, 0x7ecb243017f51d24, 0x5d29e5dc3b7276f8, 0x011eae33cfd9c5c5, 0x047909734102ebaf, 0xcf5f3fb50713a445, 0x7a53cf123a1a5ac9, 0x5939410f37f84bb8, 0x4c2696e00734a9ab, 0x030b8ab8479c763d, 0x1d0788084b031d0c, 0x9e843320560c534e, 0x7950d99ba4dfe1b6
+, 0x83b1be3cb6c9e190, 0x728ba219e4c25090, 0x868d511dc20ede60, 0x584cb2d39cf80359, 0x94014d3f3550325d, 0x5473c402458f0c66, 0x1438b184822a46cc, 0x08f9491bc6416089, 0xe23c4d7d1e0ebb5d, 0x2694e6012848349d, 0xa713c185147c875c, 0x207dabce1398501c
+, 0x637ea6a2991fd99d, 0x117ff7a1a7571c1d, 0x11f201705adaa058, 0x2e8e7cf1db14c99d, 0x4d308716a6b8b955, 0x6c752d6035acb8fb, 0xfacea33685609b7a, 0x73008e1f1d32070a, 0xfe141496c30f160e, 0x7a1058f34085ccdb, 0xfb484860c999bcb1, 0x31abc479b4528fa7
+, 0x09cfe1b642c4404b, 0x527e8ab15f54eac5, 0xdaeeddee5370e262, 0x35440d908d158a8f, 0x4f88383e42b00739, 0x7c3788b3f3833ad8, 0x232d7f4a3ee3f053, 0x2b1b978994aa40ed, 0xd0a5b16ef1c05944, 0x62ef8288d65ceae5, 0x90fe72d52e77616e, 0x53fc3b2389566a7d
+, 0x96c310c89d037f27, 0x3ed1a0906154ead2, 0x4ee020e4ab16c70d, 0x42eadde810148b2d, 0xa5dfa652a01514ff, 0x22e5c3f869ddc3fe, 0x784129be49004122, 0x0dbe78c68bb2cf66, 0x41bb81dd96b944f3, 0x2a4bca517791a35e, 0x91419807829fde71, 0x76e77384e6ddacb3
+, 0xfc9e2b8d965f82ba, 0x74fa1bdffb0d0eef, 0x14dc1e7ba85f06d0, 0x77655a86c303b27b, 0x809f9d103dfe95b7, 0x190cb6dcea6be85d, 0xb8b291d06e69133c, 0x34edc4c52ad92310, 0x13a8a45218cd1d9b, 0x28c149513cdd57fb, 0x273656d3b62c61ea, 0x79345b54e4b5afa7
+, 0x2727d4e2ef241b62, 0x6636357a45ecec54, 0x4d05290e1a6db478, 0x41d1e61a0bc92b74, 0x0080d0523ba4bf57, 0x6372570015fa1335, 0xb3b4141154d64fe1, 0x19c43d5a5c9e8d01, 0x2220f4b0e1d04f3e, 0x138bf5a6fd6da971, 0x2d27313baba7c64c, 0x1e9a6f3dbdc8d3c4
+, 0xb1131ba0911b123d, 0x63389b069a3d2594, 0xa1545e2d0638799a, 0x5f7eb4132c403b4c, 0xe6318061ef988a50, 0x35e8c4334d589962, 0x763eb42833d6b187, 0x5e89872639fff221, 0x1a523cc1aecf2fcd, 0x39753ae30e5053a5, 0xa393c1e5a7a833fd, 0x3c41b3d5d5bb23a6
+, 0x18333590bd5178e4, 0x5a2c30319fcfdf06, 0xd1ee8de6b669faeb, 0x3db13d6f8429a37d, 0xcbeee03daf789c5b, 0x56618a000d6312a5, 0xaaf05cf350c1310a, 0x1566c0cd85d392cf, 0x893a758aaad6531f, 0x1c7d0ad05de74933, 0x5a05d120d3539786, 0x756247ae17eda7aa
+, 0xbae2e7be334e058c, 0x2ee92e436f7fc6ec, 0x83d70004611ecabb, 0x602c567f63edbf71, 0x6c16211fc3dfd43e, 0x6b005be245cf4471, 0xfb865d508356a8ab, 0x14712b38c7b88167, 0xc360442d91bd04a8, 0x19db25c0a375d90c, 0x3c04bf049ea0adc5, 0x6b6b11efcb0f5d82
+, 0xc8d36ad9bd4177c9, 0x4028cee997f341df, 0x9992f96a3e69475a, 0x18267ff2ebf750ab, 0x5fa2eb0462372694, 0x2ef529c4f64d7a53, 0x18916d8d682a6018, 0x4cde1e36206f3bd8, 0x9d802f102dedd031, 0x038cbe9eb81555dc, 0x59d54566a31c665b, 0x7d69b12ecd842dae
+, 0x64920596d0a088f2, 0x2b59f10731070e65, 0x2005b1cccb143d93, 0x1090f1e32288406a, 0xce464a19543611dd, 0x12208ba6023d8084, 0x7d55af3f54563aa9, 0x0e8756f49347e7e5, 0x07b5c0e3f021cc73, 0x1350aa1d6944b1bd, 0xc7144ce414b5f8b0, 0x7a564a0115f9010f
+, 0xe9d5da4d3f778984, 0x6076835fd1982acc, 0xc94ca73f22a9c47b, 0x071f2a4303203497, 0x71d3c560b9f2da62, 0x75f5af56580d014c, 0xbd94d7d39cbe57f8, 0x580a86f37413f49a, 0x10a2e9848dbde90c, 0x180b20d2cca415df, 0x72514596c34a0b3c, 0x51592aa4a9cf63cc
+, 0x84d8c0f82ff10cec, 0x652625058da4c02a, 0x91982aa132cb95cc, 0x1663b17e9665128d, 0xaef736d7e5dee00c, 0x21ca085119b92777, 0x948d6c0917df2c7f, 0x1a19e80cc018139f, 0xb119c7bdd1092614, 0x070f6966c6a0a02f, 0x279f610a949bb7f0, 0x28577c7220e09e04
+, 0x03a2fc7ad124ca0b, 0x276fa0c7bda80543, 0xe78e224ff7c93b6d, 0x3cb0de3710b1fabd, 0xb4af4a97a4ada2d6, 0x78412a5f508e12fe, 0xda37255b3856b3f5, 0x7d8d2131488d30d0, 0x808f7fdc2509e327, 0x68bb9bfa48bc9d95, 0x051ae0ef07aaf7b7, 0x5f2327f3933e3651
+, 0x859d830b889fc4b3, 0x0abb2c95fe09a5ef, 0xbf10955d8a608190, 0x69f5f2cd39f4abe5, 0x97344a098d9f329c, 0x52025a2c855dca77, 0xd428900b793851b1, 0x6a6031cbdb106d93, 0xeb3c5a39851f0451, 0x0a7bb4d9e7cfcda7, 0x96cc8bcfd7d405e7, 0x5f766049abc02be1
+, 0x09051fe1bc37e56e, 0x417122046961303c, 0xea708ef0fe0b1e5d, 0x7dae8e75c2b3689f, 0x46c3aa0a5a24b9b4, 0x414116c48ca63f82, 0x9ef98ee3f5f1ae86, 0x47f6e533ea7b3a4d, 0x21fbaf3ca4cdb27a, 0x4ddbf5a3841328ef, 0xb9a3d475883042e9, 0x3240a2a3c4605c79
+, 0xb965e2e6593de0ef, 0x3aee67c9ac9cd25d, 0x1b187358d512b0f1, 0x09e7dd9260224c23, 0xf2b6d08e6f8f5015, 0x4086749f4182fc42, 0x65e93b89d9718292, 0x524c15aac49b3ba3, 0x29bcab631e98b189, 0x28a7acc9f1b77f36, 0xe4b963e63705f66c, 0x623096cec4b98359
+, 0x1347692e4735eeb6, 0x08c47c1c41107c00, 0x33f458a68f660bd4, 0x1278f2882a3a206b, 0x3cbfa8807d0cb9d1, 0x2b07b81dd0e8e3e5, 0x28a746749e43d550, 0x6ebd70222104e6b5, 0x2e0920cc67ab38d7, 0x399882d02126e44b, 0xba6d099e8c5a4c56, 0x3ae1618616e0f5c6
+, 0x073531cd6a9b0476, 0x07f1c0109fad0913, 0xf6e624849b464a08, 0x26ef86193ca1904f, 0x61248d80cd10a894, 0x6044d0d108b1c4ce, 0x8b42ffb84782477c, 0x28d309cc2dc66215, 0xec02452bf6fa08a0, 0x47b17427f1ecbb48, 0xa786203a2271c626, 0x79593fd91afdc031
+, 0xcde35b3c8c5b2d5f, 0x424a06ac6f220a37, 0xf14edc2f19521622, 0x63e2bfcf693778ab, 0x82d289b026ee5722, 0x0e07424a11ba0f07, 0x1bcecfc48f4cffee, 0x062f795494027f5a, 0xcb1d83ebd6614b37, 0x51c72bb8440ce53d, 0x5e33eae6054fdf49, 0x57e8639d9e67d5b2
+, 0x2cbea42a81a8d2cb, 0x4cb55e8395ba3a4f, 0x800fe57d2f5c079e, 0x1967f3c74883b7d4, 0xa8775991524d9e81, 0x53c00a4412ceaec7, 0xc134b72ff541c857, 0x4d0040cf153d85ac, 0x171a80de2369e543, 0x69dc2f0d3cf8621d, 0x7db818c338a5082d, 0x74378570218f9b7d
+, 0xe8d84468d39d1091, 0x70c353a791b79c84, 0xc39d3731e25741d3, 0x2360fca6f7242d6d, 0xa3d73a3150332643, 0x1cd8016b4d803f60, 0x93febcf2ce7c31a1, 0x3b11edf6af47cda0, 0x7fcd8b008eced230, 0x3d6bacb837d0f051, 0x501e5e64a94f4cff, 0x38cde690df740fae
+, 0xa93719bcf325dcdc, 0x52046f5085dd2606, 0x30a6ef10d28926c6, 0x5a20ba39ccfaa72e, 0x9a945dea270b7006, 0x29c748cc80b8b8df, 0xd43e387d4461a7d6, 0x5ee0ef8ec1af0f6b, 0xfca7e9053716fc7a, 0x35945eb0346834a1, 0xd80d583cc4fb1066, 0x2a15c329cd1287a7
+, 0x8237314dc8ab997a, 0x18a9573660a97379, 0x40bb3be37a2abe67, 0x486e906850e17814, 0xc44d83235885f553, 0x1cba1640a84a5d7a, 0xd2e9f00c74973dc2, 0x7dd63b8d92ee2cd1, 0x56c2e7d2b0bcdcdd, 0x62dccc228ac4cf63, 0x3a9e078c1c2ded17, 0x14751a4be8129a14
+, 0x61fd65487ec71e05, 0x7d27f6235afde221, 0x51fd39f4344cb995, 0x54dc79f331e1557c, 0x54ecbccff6166dfc, 0x3d7c051dc159b8cf, 0x746a9267e9880f6c, 0x3484859c58436d95, 0xa3f925cb6054cf5d, 0x45a96802eb4421d8, 0x7ed5a3607c13bc79, 0x3f500a4169d69eb2
+, 0x423b170097a9ad0c, 0x7775dfe2261bb282, 0x47b49dbc1077e674, 0x50caca7f994e01dc, 0x5ce11431865e40ee, 0x2881c65614418482, 0x7444358ece05f51f, 0x1cc2f4dd1af54c13, 0xdab77e358e7cacfc, 0x3d0c4441f6788391, 0xd168197bea1ce74f, 0x6abebee9fba0d2b3
+, 0x7537f627fe2f4496, 0x0a61925df0dbc6e9, 0x32151ac553dedcd6, 0x045f6462e03def28, 0xbc8d261db8f44e3a, 0x6f8bd8e941c48835, 0x92891154dcf95e1e, 0x1432dc2f004315d5, 0x377d2a8713ef2ea2, 0x5473709b9ea86031, 0x4bbd2702cb57a0a4, 0x3a9a04829df17d28
+, 0xe7832dfb122f00c3, 0x28563bd22e6b4740, 0x1b79ac3c1676e9eb, 0x1196410d800be430, 0x8f6ee5f59afa33ea, 0x562e2e851b0f99c0, 0xb6c9745457ee8f17, 0x5b145246f22a8674, 0x0ad74e936edd6f3b, 0x5a22c6e9011d86db, 0xf4f9fa958281ae31, 0x0067215d29c88d53
+, 0x14b77df8a558ba33, 0x78c59384771e86af, 0xd2e72949fe5c5893, 0x385bd70f7778c9d4, 0x215a43f5dc296f82, 0x4031e9eb20ba978c, 0x36a30066753e9f1c, 0x203da2f03e9fdec9, 0x9d1604d6dd70c072, 0x47923de001316194, 0x4da1095aa80b9291, 0x4ca40de473370df3
+, 0x6e661d4c0696dfa8, 0x387d46b5e8182568, 0x5c04eb9cb9ec5887, 0x30a5a406fadaf2c6, 0xb063019e51da9629, 0x54dc1bfe73fae6d2, 0x70d79d12ae90f23b, 0x7c9651b0242f1af7, 0xbfd5a19235b1186f, 0x38762652d4261498, 0xac88d644a6f08783, 0x21a5bdbe3edd08c1
+, 0x89544040a869a5d3, 0x40848d01b80dfbc0, 0x38507cb3771aa9cd, 0x6add907eff50af20, 0x62f6c04b20853c34, 0x5c71681f753abc2a, 0xb09e68618a2a54f2, 0x1534d33c5e4d864f, 0xf8136501a7aec0a6, 0x2ecf994fff509313, 0xaad5eb869a9a5d99, 0x49b55c93ba9a73a5
+, 0x2906d45acba44cf7, 0x3048cc146f62ef85, 0x3143c527296232ae, 0x1ff21a0cf9850522, 0x129d6d7b7fca91d6, 0x44aeae0f36e33998, 0xc07e36fda3dc1d16, 0x0b0ac74e592578b2, 0x5776e9d5c590b4eb, 0x113d51035d7e3dd2, 0x15c34c9d6b8d65a9, 0x7649fdb6b7a18540
+, 0xd5ed9203ec2fccc9, 0x74e003e9b5ebf652, 0x30ea441a37cfa7fa, 0x6630f02b8319f1b5, 0xc26b76437dac07bc, 0x64a34e7f68a9cf00, 0xdb88ca6b66308e58, 0x07a48fddd406d18c, 0xde0e7442e772d524, 0x5e2af1c101672d43, 0x13ac697af8a52f54, 0x20606556dc09f342
+, 0x57117844f43b2b4f, 0x12acadb1d6f4ac12, 0x8a57f6d2847dbd61, 0x14654ac9b4da2114, 0x8110b596c1ade118, 0x2bbcd808c464aac6, 0xab5c1ce7e2dc36f0, 0x315d9aa9baecd587, 0xbdd98b1384d0e46f, 0x1ad8a25da86384f5, 0xf3e14c5af94c4973, 0x2ef5331540d817ec
+, 0x655fe9605aad5883, 0x7166acc747552b9b, 0xcc12239dc0f130d4, 0x1bd6c04f415e1609, 0x52ce4977100fa2a5, 0x308aa293d047629b, 0x4ebea9833c15cf22, 0x7bbf293b3ad57cb1, 0xb041f550fa116035, 0x032aece75787c43f, 0x5a428ad3be9470d4, 0x602f5123b9f657fc
+, 0xc9ee7972506fa82a, 0x07845412bae7981c, 0xb7a4775e8d69893b, 0x61446216be29d775, 0xc842f743cf2098a7, 0x68491872698d0250, 0x5bdbdba1fc01daca, 0x48a662a5309aa792, 0xca4bb65bb1a976cc, 0x744055977d9c7027, 0x2aada39e26ca1dc8, 0x6b37798cc8b80535
+, 0x91d64c8638baa120, 0x63f3bd0c155bad12, 0x31f5a19c3c2f99d9, 0x636762dfa58a167d, 0x8c68ead88caa6a3e, 0x00c607f3d9273b3d, 0x0a7258dea8263124, 0x5e6087ff2bf04430, 0x5c20926dd1a41ded, 0x6781f0c993ea0ec2, 0x36ff20125f4f4907, 0x22148043d023baa2
+, 0x1851918e8baf4810, 0x5cc57dec1bbcdb19, 0x40c58837ebea589d, 0x616766b5b8ea6b28, 0x92a84395cfc95074, 0x1fc18cbcb6c7bb8c, 0x14279bbb38420e49, 0x567fa13da45a091d, 0xa98eb453e661e6ff, 0x3c1b14659c0c83ea, 0xd5ee8dc56da9fc58, 0x632d83e37494325b
+, 0xb328c24c714620bf, 0x104e99fc86310a81, 0xd9dc7a8e729837d4, 0x0b690db53b02b598, 0xb8fb2c172c01cc61, 0x5d8d0aebdf4d1860, 0xb6ef8b96fd1069f8, 0x3dee3d02f2ff76b4, 0x20787c953f07864a, 0x5592508fe78e1148, 0xea3a95dc61646aaa, 0x77868179174c3c98
+, 0x391bc9618bd0e927, 0x008a0db5371ac799, 0x8d7fb01b1e23193e, 0x6d838f9af2b6d7ae, 0x7a13d654d7a2ee6d, 0x55b9630c5ee82d30, 0xd6787ebfb8575926, 0x2070b6161b0676d7, 0x7bdcb6564df7dc49, 0x7c8ba24c9dabdeec, 0xc869958459d22405, 0x6b397426357e53fe
+, 0xc1d88ca326db1fb3, 0x4c4e5e1a105b6a28, 0xb6bc702d2e813fd1, 0x040b45bf1c05e24f, 0xeb746179232670cb, 0x1e31cfa96a8e23ac, 0x28ba5881bcd61fd3, 0x7ccc547449c1c88b, 0x33761816e449e9cf, 0x482e2a88a3bcc59a, 0x29795c1516834f7e, 0x6724761e3b0d44c5
+, 0xefc12cb1c9bfb6b2, 0x1cc27f3d75efc9d5, 0xf4549532e2d7bd83, 0x45543c934b6932d3, 0xc7bfccfa3faeeb43, 0x5b5b93a6fa8d8998, 0x2e80ad29f67b55b8, 0x766dc79f1fafa3de, 0x2bc1964a8a33cd81, 0x4e5179117dee4d63, 0x76f22901e6b8083d, 0x463937a8a17c1053
+, 0xc7aceba22d190d21, 0x16a568799ac1bb1c, 0x31fc045e4f6d2f7a, 0x3ab3ce21fe8f60de, 0x6b2b2abe2bde1721, 0x465255b273b91be7, 0xf162191f81844ce3, 0x7d3b3d0a49239410, 0xb89a09f4bf17392a, 0x46eb31b9a3e26d96, 0x5d91631ebd4f14a3, 0x402fc14044c64e80
+, 0xc43c06187d4f3f18, 0x060ad3fedd61a96d, 0x26bb81b2276a7412, 0x53cf7e3acf82bf25, 0x03fde52614cc0f90, 0x407c191bec76be04, 0xc3f1ecbf5a72771d, 0x33dea5a8dc050f21, 0x360296e80d981554, 0x35735387a58d465b, 0x32c94114fb56a22d, 0x770c7603e9965568
+, 0xc057b6d2d073306f, 0x14d8e8a9efd90864, 0xf045badd2f4acd2c, 0x441a3b36dc811cdf, 0xcf91627710ab2bd9, 0x1b5202bbe4c73d7e, 0xb08b10563bf3600c, 0x2a6a29af998d37a0, 0x40c285ffebca2853, 0x1455c1e5c398cf95, 0xdae9f11395f2c114, 0x59239a7be0927ff3
+, 0x2ee6f3633d955086, 0x1bd498469619859e, 0x10cc920d77a9884b, 0x2823f4fdeee7165e, 0x4d7638c8887daa56, 0x46f0a213d5c41393, 0xf4dc56e877fe9447, 0x6a3c4430bbd068cb, 0x306cc59f2f23e1a5, 0x0afb2bc2acfa4ad6, 0x213e597eb31833fe, 0x6d592f2f35a6074e
+, 0x3ae7a71b862b73e8, 0x574e15e6929f2fb3, 0x4a761ac171a2ad27, 0x6c4d0eb69fa7eeaa, 0xa94729ce5e917a3c, 0x16234cbf9df0dac0, 0x50a34996cc87510a, 0x5c98d0482d4f56de, 0x4ac5ae1a6f4edac3, 0x764c9baf804a0236, 0x6996a9adef5bc4db, 0x5e36f82545814567
+, 0xb94eda8df23df1a4, 0x17a38e4a362a5b35, 0x2365e840c7bcf936, 0x53b88498e33efd11, 0x587836912fbe1f79, 0x41b343332d912e6e, 0x3de8ecf488bee0d0, 0x4a1f08bde5c998fc, 0xfaa519d296ca9076, 0x7228f93ddc4bb136, 0xc74982a0fc2f745f, 0x46314b1072908f71
+, 0xb7adca35e17304dc, 0x5f070ba579056168, 0x6f1a58664e4111a8, 0x6851b2ff288c4c77, 0xa52b147c6fdbdbde, 0x743933d91a813f1b, 0x9daa2998136b77b0, 0x18f80f3ffc1e1142, 0x2127efeb47f79e98, 0x3a8ad081a66f3f88, 0xc66ff30fbe7f9285, 0x30d8cfe3cfbc17dd
+, 0xb6b58e133557726e, 0x7ca55c6a7fc85473, 0x6bb78a6cd82fb725, 0x00ac6fad41493750, 0x670578ce8a34bae2, 0x7ea3bedb7a8af476, 0x70a634c88e83c839, 0x77ed94f584572d3c, 0x87195b74e93ed290, 0x3fd945a3a115642f, 0xe3db4c78de194720, 0x0e9996cee9e2c923
+, 0xf0a687d7bd153574, 0x0bf44b1cf044dd9f, 0x714ca3ab34e8d196, 0x67d748983ae788f5, 0xc913b9cd60fccd5c, 0x608021199fe0418e, 0xdbe5f70a917b0420, 0x4f5be84297bd0daa, 0x24018ff831464d8f, 0x69da6faad6c470eb, 0xd668a726b1756eed, 0x0c3fb688a7fb2209
+, 0x8c7475d7fbcd5caa, 0x59ac247e2515f923, 0x1b79bff8ecd89173, 0x458066f038def920, 0x307f89f471c58b10, 0x2b14d591f2e28235, 0x9f9864b3d4b01861, 0x4ee2faa4e9fbf920, 0x854b3a18a2fc6b53, 0x7b150bc327884d64, 0x2ae3ab5d4d0861fc, 0x11474e2a46487a96
+, 0x2c140c5502c3a4b2, 0x71857bc70e073be1, 0xbcd271ddee54b07f, 0x317e6086bf490b46, 0x720c5c7c358d777d, 0x1abb6a571964e7ee, 0x0c1665542f276d46, 0x27da54c6c4359d0f, 0xd5077e295b0e0e58, 0x56aaf636f7f2a1d7, 0x27919db74410eb71, 0x2d6acba9891df942
+, 0xf825f7ba0a1b7226, 0x23538807d7ac562c, 0x33fbc848132f7f89, 0x5774f12e7c90d215, 0x456a17835ec59256, 0x532864675467bc84, 0x31d38d29b6e9d17e, 0x7576e25a7d43943d, 0xe46f95e808749066, 0x65a68eebab412037, 0x73f76905e4566393, 0x058e6911f5571630
+, 0x422da97af1b13a64, 0x1fec43c221aa6eda, 0x47b80ea84e44c3b0, 0x0a1c39de3d7f6e03, 0x06114ad542edcf85, 0x3f27a7f9c24b347c, 0x147d92564b2b74ea, 0x03e22ebaa0a3b605, 0x89b37d0a54a8cea2, 0x58dc65f0ecdca54b, 0x3c934fde4488a696, 0x395f288db174e269
+, 0x0de089d52d3ab153, 0x61cce94012aa99dc, 0x618d4781d833bbf0, 0x44c0f6f38b2ad063, 0xccb7db85db4c71d6, 0x03a96410a3993148, 0x4c906906e1297ec4, 0x53afc91b024ea393, 0x516fa4cf4ef12d21, 0x2231c2d4699ca225, 0xa62702e5d41fa931, 0x6e3e289763de6a95
+, 0x5aa172c1a37bede8, 0x1f927ef2b8ef0503, 0xf1071f3ed6cba6ba, 0x5a9bd30ef1146a96, 0xb8dfb206c352e5a4, 0x5a508c05ca0b39ab, 0x500716bef0d6e442, 0x68b430be7b36b8ba, 0x2d8e2beb18d6cb8a, 0x11a19c6a89109f23, 0xe7b8acd100a30576, 0x10dc4385e89bb0b3
+, 0xd2d44bdd69cc1880, 0x24b449d7e9a48642, 0x446f3718baa9d679, 0x455d55b7103dd140, 0x9fd69d3fd4e5c2e9, 0x36c73260e98627ac, 0xb019052dfca35da2, 0x5a1eb3e64e5c902f, 0x2194a16d8141cf28, 0x62dbe6cc50ae9db6, 0x23f1bcef29426add, 0x50a9e7631a5a3ad4
+, 0x9502d8f9711c7194, 0x608df38e8b6eeb9e, 0x60eebb3c1df1e1c7, 0x234b2744469a3997, 0x208c37ca6f947772, 0x7e7549dbb6ce7448, 0xbf446d125d2fea8b, 0x2b01803e5cddef08, 0x84e859f595736faa, 0x60a6773673515779, 0xf4f766cd7382e85b, 0x1b91003fe9c1eed8
+, 0xe363308dce9de314, 0x73bc02c4de46821a, 0x960c3cb37508ee64, 0x2379c154e16ce54a, 0x7603a6e4958cdc8c, 0x0a4f7d44dff0d2b5, 0x2dc53a364b3b82fa, 0x485bed8499b15ded, 0x2a84d6779dfb309b, 0x2c6474e0e9ea0729, 0x4c7026338b5eba58, 0x50c54fddf38f4655
+, 0xbcb4cf3740e9dc51, 0x4ff61e7d16f80bf7, 0x6d570fcfd0598dd9, 0x298322a12532c265, 0x9064a7c5ff380a59, 0x652b32f0543d4522, 0xf985623a08c6f571, 0x5188796c2494d691, 0x7b7fdb5e7e008fb1, 0x35094deaa1996672, 0xf2d8a24e947166ac, 0x349548711605169d
+, 0xe25d4b091a849e7c, 0x02326a868adaf6d4, 0xf9f2814a38644414, 0x2009ca57b7b45d3a, 0x4d0396931ad0dcab, 0x1b10dc3d0a78d9da, 0x11f487786d0eafcc, 0x1d99e3224157e08c, 0x8c118f30b462fd87, 0x72195912096a1882, 0x38a89879f96fe85c, 0x4e1440283d7ad329
+, 0x3e87314ef4940869, 0x35ef1b83f3a9a0f5, 0xa4a92e2d77c0898a, 0x578ebb9ef019ddd8, 0xf27f7d50a18cb9a2, 0x29b33671ba6e2083, 0x958def8a20904b00, 0x67617a2a136bdc01, 0x61ea64b1c7a3bdae, 0x750883c21f3f2d2d, 0xe5da21de9e5b1b16, 0x728539d7b7b4184e
+, 0xd5c434099a2a27fc, 0x73c5de26c4771ef4, 0x49f329c377089051, 0x3f966e9fa8b77888, 0x961d53a609e84de8, 0x7cc43862811f1116, 0x7bc4c5e0e6a04b83, 0x35107ee6db51a257, 0xbd2887925ef13554, 0x3eb9179a988a1b96, 0x3cdebfb55c9a5b78, 0x475f398aff532bca
+, 0x7bba8ef575c8339f, 0x28ed41dd0bcf9a9e, 0x81fb5b20853daef4, 0x03684f14845d8340, 0xb745094ff0401cf3, 0x32cfd156e3feb646, 0xef4ac3998ae36fc0, 0x4a06f906763fac54, 0x13c0a7408d4eb429, 0x5f2f928a4c5d1a5c, 0x493357b5cd57028a, 0x3dbee15921285a03
+, 0x04d72b56d2ae6674, 0x133c9929c96383c6, 0xfb21454ff9f8d8bb, 0x76c4a054fba0d71e, 0xe99bfc080a27484b, 0x65939c209e826253, 0xceb872c29d78610a, 0x6a1214c6809c82dd, 0xe20ce2af24f6434b, 0x2c7e6d7444ace85d, 0x03a437100b5221a3, 0x355c1afca355a195
+, 0x1b74ea64eb740eef, 0x4669d1d8af1c2ad8, 0x2cff35d9d94f4e09, 0x407d6f8e3ff90a05, 0x0786f0af687da4db, 0x387fcbb9238c3e9a, 0xe2300e464ed68d3b, 0x584c2dcfb82d5a0b, 0x709e9aed89d19b81, 0x3d3b55603171a8d3, 0x9252527547e673bc, 0x61a58ed2d45649ff
+, 0x9275468bf411de48, 0x30e75acb9127c977, 0x105aca4885986f3c, 0x44395e9ca31c4503, 0x9a5d81bf32bba689, 0x5b938a797c0cacb0, 0xec3ed739c2e1f1e0, 0x1c1aac1e0477693b, 0x28aa9d581f6fe86e, 0x028405615dff587f, 0xca309fa7d413af5d, 0x44a7a3588ed1603c
+, 0x83edde9ef7079e66, 0x1432be28887058f8, 0x0e82623364f82e80, 0x1d69c5231d41fd7c, 0x259da5dd976271d8, 0x76c496433864b605, 0x76debaffbb1c2c7b, 0x05a1264a9b7e46c7, 0xe7f8958f0dc0f8c3, 0x364e5817f5910c13, 0x5e3fe088a5947a42, 0x0aa9e0e2342b90d5
+, 0x55a23cb573013583, 0x59f683f65bbf543a, 0x7b7a2ce4de40075a, 0x5f08680921114e4c, 0x53a8d06c68d4a99a, 0x567ebe91f5600680, 0x75236f4b3c78d5dd, 0x1e66f8b34d5896f0, 0x17a0c379e0aead4b, 0x2a431366ad1a8012, 0xbb5f8da695d448f5, 0x66c0a8ebee3afed0
+, 0xd773dca133fa2a38, 0x3091de2238fccd4d, 0x9b2c8f4a3ee1f009, 0x0c32388322426c27, 0xf1482986fdfbdeb3, 0x7da404ed4d925687, 0x4febf0c13cdf748f, 0x4387a1e6c1ffcec7, 0x838ad14ebc87f891, 0x43586f5680ab5d98, 0xe746003a55a78d13, 0x6702f00c2f5c5351
+, 0xbf8606fd587da836, 0x67c34dcfcac3a8ed, 0x9df5e2fd8f0b3167, 0x7e08bc46538c41f6, 0x7ca8c8093f99c5b2, 0x5a267f60a0379510, 0xb3583e50d3dda727, 0x71fd62d42906ff10, 0x710601554b67cbe3, 0x34a59a26ca2621f7, 0x224980b6dff3b80d, 0x5896288a80b81a94
+, 0xb3d7a22a5799a12f, 0x62a14ddab6e770d6, 0x861b97c1bffd6696, 0x066b6063bfbe4ca5, 0x5660d78a465b4b6a, 0x79013edd415a4ef2, 0x9dec24fb319daf3b, 0x6483b2605c9e56b5, 0xab85a8b505c6693f, 0x7937d9b598a044f1, 0xfd6cf0447e5762c0, 0x074033d2e1bccc80
+, 0x76dd01165f317399, 0x79d92639da35e05e, 0x8b8e6ab37f7130a9, 0x27f6f328964641ad, 0xeacca32b9fe959d3, 0x39659ad7379cc329, 0xa5d33c7d5032e657, 0x65c274cc36632b65, 0xd15870e2b3536df1, 0x7b6f7abd4cf6a36a, 0x0e392b9e6c0d5a4b, 0x2660690c9c572552
+, 0x7c1211ddc3955788, 0x7f9f00d5f2e2b8b3, 0xacf500d8f11f685d, 0x79407dc397fe033e, 0xa21283a71c497779, 0x33b2030b43a0f0ef, 0x42b5d4471d98329d, 0x70c53bfd520f8fd0, 0xd1bd0bcdc9bd954e, 0x626d72b238da26d8, 0xaffc84898d85d200, 0x11ceaafdbeb18c63
+, 0xf81d098c6d35035f, 0x78e8218b36b1a035, 0x23704f829c9356a5, 0x534cd11f667d833d, 0xf689af4a5e4768e8, 0x5db352fc5c291294, 0x121292e8f6dde872, 0x0ca8d5a3bd9c9318, 0xe11ef54ae2d1778d, 0x735774702dd6c5de, 0x24b0d80f352d1bc7, 0x1d12942dee177f94
+, 0x8ac809f3c6f65257, 0x00a603ca6dc7bf23, 0x91de590d9b0d6594, 0x132fb45fae4672ec, 0x8000589da5533d64, 0x4ce77d4c8c21a4b1, 0x701f6d5cba470466, 0x53588521e81e2f8b, 0x4d1c593e8e1053bb, 0x69f3894d91b808f4, 0x398463306e7cf903, 0x7a938f09deac7c41
+, 0xe53219511b092a8f, 0x090bf23aecead4ff, 0xf96d4510e2ef1e68, 0x6e330cc31b967f2a, 0xa832fdcb1fd12f3a, 0x44248c272ffbca7e, 0x0cffeb61d5f5e127, 0x6ae46fa20fe8ee18, 0x3c8f36f3e19467ad, 0x646ade402af2ac74, 0x8e23e19112db0c9b, 0x66b2ce023edc0818
+, 0x94d90f68807a928e, 0x56ba9a4a388216ec, 0xd5cdf30b0ff3a3ad, 0x2b1b5dbcf78fb392, 0xf129c2e38db79fad, 0x2d207fee3e1100b0, 0x1d92197336ad0ad8, 0x13913d7a89412a9a, 0x888b8f16e16f2567, 0x73db076b486077aa, 0x0b8fb4fe47375101, 0x124baf97b3280457
+, 0xafb3dc23dc4f29aa, 0x6080927aff4a7fcf, 0xe6dfaf4923778a35, 0x0c82a1dd319abab1, 0x47d818a650de1508, 0x5fe45baa5a7043fd, 0xb4edb32df819df09, 0x35cc7ccde3219473, 0x00c58fbec751e88d, 0x12eaa37ced709d70, 0xfba1d34e3742e7df, 0x7cf0027165cf603f
+, 0x5470757d6d9f214e, 0x41a0ab01be5aff5e, 0x911628dd5b53037b, 0x5d4054182e799603, 0xa986715a125bc311, 0x5c1883613bc52f36, 0xbaafd6e2ec2b0b26, 0x098595f3ea4a2079, 0x6eaf3eb740b7f03d, 0x3400849ba77ff90c, 0x83a7293a04813c2d, 0x0cdededa2a5e77e2
+, 0x3577ab069991f3be, 0x19ccc14cc76f3913, 0x7d4d60b50f14a6eb, 0x6058e8a7c7985a54, 0xad352fab2953e853, 0x04878a54a0df2227, 0x09d35c4dd8105980, 0x3f96a525577ffc9f, 0x7764cdd6b3360177, 0x468f07d0c9d93d0f, 0xd50adfff50827fcb, 0x647d73744b912d06
+, 0x971e4ea446f4a096, 0x4cefb7ba0bdd497f, 0x199b2b73a97e514c, 0x55482d9161e9df67, 0x6b4039fb77f6af8e, 0x2c9a0ef33eb37a8f, 0x5860cf10d7234050, 0x3e35ac363630fe9a, 0xfce552105e8407e5, 0x68cf0459c23b6d08, 0xb1649eeb413dd429, 0x53a221919a61bae6
+, 0xcb5cea226447d7d1, 0x4defaaa06267ab40, 0x99bdcf79fba055d0, 0x3949f87f6625a2a6, 0x77c7a2a7a81d3dbc, 0x72bcc89d49667bb2, 0x2678c12031eef9ab, 0x7d3d0deb848284fe, 0x82236ec5c6564078, 0x1d776df25f607abb, 0xdcf5fde2255bdbc6, 0x1b7f4cd2b4451dc4
+, 0x566e2568a7f9669b, 0x2140e26f919b7734, 0x8ba94768f9a4297c, 0x4b571beb91549e58, 0x1000460e8af285f2, 0x29f9a8c697c0b45b, 0x87a7f51789e9d2c9, 0x3cd09d956f1a7294, 0x6d2aa5f8d4732f80, 0x6d9065ff40683518, 0x64507b5975d0c4fe, 0x33d55e6e31fdd4e3
+, 0xa4acccb2349e07be, 0x0d0e532cae812c76, 0x5b946887f17f54e7, 0x7862a64eefc86330, 0x46dbff27606076dd, 0x3c693912bf778ad1, 0xf117d55144c8bd82, 0x0fea53319247c4f6, 0xb55a431bb534aef9, 0x1df17d2a5474fc8d, 0x48f62df1b48bf6fc, 0x28098361168ddbd4
+, 0xbb8ff4affd71be4c, 0x4f58fa6b1241c622, 0x471489cc35cf8323, 0x58ce1bf9bdce58cf, 0x792c62037f745c60, 0x3513ed7f6fe59b47, 0x72d95048f9fee72f, 0x6ff7eb3b963a0f32, 0xe0a666ffa66dd7d4, 0x0eee0219cf9df748, 0x94ed708204a8dba1, 0x7dada1d917699462
+, 0x5c7658def9fb16ab, 0x1ff971c7d24b1ac3, 0x37ab454af26e16e3, 0x5b8945e2fa15c526, 0xa12dd83f2a35f186, 0x4091a6118e0f3879, 0x4ecfa96f378fa806, 0x45e8579efe08bd01, 0xd7adde34fd6a5fe7, 0x7e914b8e103f8fb9, 0x6e16cc0af29bc12c, 0x3da50680b0229c85
+, 0x481fc15ff1a642ac, 0x4a9ac50232a0f049, 0x59693bd33d4e0d88, 0x3a18c3ed56e94f7a, 0x6b50ec665d146703, 0x6e75e7c2665edd65, 0x889fd91aecce1c4b, 0x7ad51c02364b46b9, 0x7eb58598890a20e4, 0x368b9aff85dea639, 0x8b79992511b5b3b4, 0x043efe6ae5e84820
+, 0xc3897da494b06fcc, 0x67672c5bd844045c, 0x38ca0fc2a2197110, 0x2538f47c08457df0, 0x0774d74821bafcbf, 0x736f292072d10de8, 0x5ed6853c81a51d05, 0x0fd7a6e6d31da94c, 0x94648342a1fdafd8, 0x381fada3fee07125, 0xe7a1baa37872f9ea, 0x01a4a73019ae289f
+, 0x5ed7392836098ffa, 0x43164442452f605a, 0x826b77b329e1988e, 0x0cc052beb87a5b98, 0xed23f8cabb0cc309, 0x12dc92a846287e06, 0xbbab2c2ce8e22d19, 0x72482f62e1c85cf2, 0xf5e03061deedd3e5, 0x09a280cf2dc1c4e4, 0xce3624dbc2b82d2b, 0x3ddcd8c1c532ddf8
+, 0x970f78467af065d3, 0x3cbb587602c55ea9, 0x0b1ab2b328a1a18b, 0x56509a0aa3782d4c, 0x4762c94eee0ac423, 0x51b898ef72c5e7ef, 0x1bf381c47a8cc57b, 0x73958d308bee4bf9, 0xf69d7cc861799047, 0x402b304351dd0977, 0x25e4a298958b5115, 0x030d6c14f54f1063
+, 0xd32f61f03e3a4eeb, 0x692e3ce587ef572f, 0xa25acc116cd98792, 0x5b0a183a3e9d8692, 0x584cb2a51900406d, 0x0539bff9a88783fc, 0x674fb2bbe5d612e4, 0x3005782e6774a186, 0x0ee7f1ab6b00dced, 0x7d91c8ca52b0b610, 0x6ec117aeff4ba9d1, 0x2415e7d217e3c19f
+, 0xe42aecb9ae8ffd8d, 0x56baaa84f90970b2, 0xd7ccfe6d2268a437, 0x3a0cf2a7f4b5555a, 0xfca30159dd00221e, 0x2b1fef84e3491a42, 0x7d8943fb9ca83b4e, 0x26d10bf52ea6d281, 0x1371017e3ecfaba3, 0x2781f714841bb966, 0xb6d472926878f51c, 0x46aa074cda886aaf
+, 0xa588710f2785e0ef, 0x44c1c0956953ce2c, 0xff25c1b0a7046c8c, 0x05172b7c28009d1f, 0x2d40383a85cc881d, 0x1191369535836182, 0x187361bac4347787, 0x0bc41af7b6994a3a, 0x42cca9d0176870bc, 0x43b4d957bf9e31b1, 0xa29f1e53e021927f, 0x38f415fa0f03e305
+, 0xa35b7cc444ac4df3, 0x38822059a45ff34e, 0x9f07fdda63849099, 0x66caadd5bac92ac4, 0xf7c1ebf96e877963, 0x30eb313905b3ea6b, 0x88fb514b77e1ef80, 0x05bd2bff80c1ce31, 0xf194fa79fe1c68f1, 0x1302799e7a88dcc1, 0xa60e881054be754c, 0x675a991d276cf5d6
+, 0xdd0685f3d8004b8b, 0x151126213492dfaa, 0x8dfcb75ceb321b13, 0x448b0fc4ce166f05, 0x88a17a23e6d804e7, 0x2170270c5659559b, 0x7f14e6ba41594d6f, 0x2322078a42d75cc8, 0x2877e267760202d7, 0x57b3b498e5ea0800, 0xbc3fe869a03d49a9, 0x079efb7c4186b338
+, 0xbbfe4a75e9de6016, 0x364c4ac684175021, 0xe820e75c0ac26edd, 0x7ac243ee5725d24c, 0xe8a0eb0741f69d45, 0x48b4980d7efa43da, 0x4ce4a49c7a46b2bc, 0x5f02d59dc4ae7342, 0xbaa81c23a7c9e9af, 0x4e783ad47ac4184e, 0xb292c0c9f7459224, 0x7071b2796f4dfece
+, 0xc6ba486ecae255d8, 0x3c0d4d5bc231e973, 0xfe848f5258e9bd7a, 0x1dda9dd2e483452a, 0x9b0284022b517c04, 0x22a9bd6f9bb00849, 0xd4c19e996c5a53a0, 0x25221d6c6cd1e6e1, 0xa07fca25fab3f902, 0x1565bfd579a8e518, 0xe8805695491e8b0a, 0x061ba3fa0c4c166d
+, 0xfc295f8b19f97691, 0x3b20d1975e3f628d, 0xaa824c68a8eb6c86, 0x411afad63347d272, 0x802469cf22d8da9a, 0x71075bf645112e5b, 0xab5e5733b2641177, 0x2db8eb17378edadb, 0xf72ec1f3c63b2672, 0x482ba6f826e9b4e2, 0x0f0b6a5c1a0119a5, 0x47a12468147ae957
+, 0xa8f468eceeeb41a7, 0x78e0558ce5b02537, 0x9533b0c1087ee116, 0x5c9ed9c0f4f897c1, 0xf94132f2403c16ef, 0x266ac751698519b7, 0x9090c3a7cc54b165, 0x59ada8af4a2a5968, 0x1a3e5bca9b2ba0ff, 0x4f04e19b7db08722, 0x4606d9798639b377, 0x1a034d017c47e0e0
+, 0x7e92ef15acfd763b, 0x382af8bc66a0c98d, 0xd848927e904af678, 0x6ca018d40ec150eb, 0x12ee2250f146be42, 0x4ebe5880582f476d, 0xbb12a76a6e8e2fc7, 0x5448391c81c9ef83, 0xe5ab4680b143a7cd, 0x1a75d5e368643e9f, 0x71fc9c30b7d8e846, 0x3110df322f728ac5
+, 0xc6ed9a49ef8bd837, 0x22038c8a8a463585, 0xec8f5dc9a49fac17, 0x1369d9c734d7c448, 0xf79c5cadaceb0624, 0x45aaf94fc3354db1, 0xfd35e3b970ad9ed1, 0x5c6979164cd13314, 0x8670f732256ddfe1, 0x7195c46ce2f429c7, 0x3990d4a41675e64a, 0x189c233462032b6a
+, 0xdb54b097eec4c539, 0x0d8f3a18878670da, 0x6f86177876d739c2, 0x1fc29b94766da4d3, 0x5e282ff957312dd0, 0x0d901625a5aa7d14, 0x897479025277d9e6, 0x0383b9b876aee06f, 0x8ed64d212d52f145, 0x3584f53e9068c51b, 0xd5f58fcaffacba6d, 0x5049802df7ca6b28
+, 0x75966bfdee58651e, 0x2ed86e1b61631900, 0x1c6e4f09f2f82ced, 0x4c5dce58cead1403, 0x0f3eedd4d7665220, 0x2a042886572ffcf1, 0x0f5a04b665fed777, 0x434fac56b7b89e6f, 0x85c606422d31b177, 0x3adc1252c8066510, 0xb273bd6cbc3fca8e, 0x7ac5c5544a6c35b2
+, 0xae2d4a1f1d0211bc, 0x68722fe565576d55, 0x9b61526fa804c62e, 0x0e85ee0b679a1cde, 0xf8acede615feb67d, 0x5b120ee885c99707, 0x16cf55737e0264aa, 0x3b7a821ae2b24969, 0x1f155f83b48f914d, 0x0f09da6d3e8a27a6, 0xc838890f55afd0b7, 0x4d85e83a5707e1bd
+, 0x899fd6f959adbad1, 0x13fea7e4d33dfe01, 0x2a8aecc916a876d4, 0x520dfc2d31c08d3c, 0xc7bd7cd67f1520af, 0x3c8659962f1172ab, 0x01b25655e2bd1ff4, 0x541de5cf3f23a2d3, 0x47e5849732ea69d5, 0x394b4389fa31d5cd, 0xff94f3604481ac43, 0x1aac3d24a411812f
+, 0x71a6b99ff3d94a1e, 0x39bb88a7e004d879, 0xe9de0e97bb8701d0, 0x13a38b11ffe1a300, 0x1907d226e4c68b84, 0x4f7bf2ee2fe4049e, 0xce1f0709f37201c4, 0x03cbcce4ddf337a1, 0x65fbfb6997ae9589, 0x0005e58255ccd0ea, 0x35403b1f26d43d40, 0x1e6ac4f85d815866
+, 0x84d7fc4b93504be1, 0x38aff8ce3fbefbb5, 0x1bcdb8f8795f4374, 0x36d7d0d92af9666a, 0x4e1af38804adfbc5, 0x130396de54ecd210, 0x6bb3869d98c4c3c5, 0x58e433d513cf224b, 0x0148ae57dec7dbdf, 0x71d605dcbce978ec, 0xc046c9bb71d4a356, 0x2095f382b00184b5
+, 0xe9a114088dea142f, 0x6ec659a4b9226b0d, 0x4a347fec8ac1e8fd, 0x74643cb488afd5f7, 0x44a9a6d0b6da440b, 0x76259550899041b8, 0x34656e309b20b3cd, 0x29fc5835cdb9a960, 0xf0d0d7ec6dd4bcb7, 0x42420572fbd8477b, 0xd8660fa77fbd14ff, 0x29b7d1e4da3676d8
+, 0x45591d6aa0f3ef94, 0x3dcbea1841ae9344, 0x39bc034afd83d08b, 0x2538babf7f2ea416, 0x2a53e1b843ec92f0, 0x579f2d41499c1dbc, 0xbb77fe7634011a27, 0x7015cdce61690f8c, 0x7614c17a4ac1c6ee, 0x269e08e033078437, 0xc21282c4886aad25, 0x5f7323c5218544fe
+, 0xda0a07e734ff2c5f, 0x0b1f2fa7d5114e3f, 0x67c9144461787364, 0x245662c83b34384a, 0x2b6156192f37ad96, 0x6d9ef29292a781bc, 0x1dc854cba61641a3, 0x17b4ce111f364599, 0x6ed5d38b4551a6ca, 0x442fa50d39ea946d, 0xc8bb29e27753371a, 0x57cafe80069b6eaa
+, 0x9e084ee1f3c5696c, 0x4a3d9ced2fdecb4f, 0x42c1d18bf73af23b, 0x2e8abb775f1e5050, 0x7b890413ced4f423, 0x6995c6250f30a35d, 0x5a545efc8afba98a, 0x482b40a093979e38, 0xc345bbb8895cf0ab, 0x45543d69e1c1d491, 0x4d8d9aafc53509d3, 0x6fa2d8f482f24754
+, 0xf4cae92cd99ef0c5, 0x0565e0805f6f7b87, 0x2ee123f0ab352e32, 0x4e40582b128c642f, 0x8b26e24333d427c8, 0x2bbbe2aaecafb90e, 0x2ac05259c56f2639, 0x489dab5e168b05c7, 0xce9deecef2c96aec, 0x15dda1495367b4d8, 0x91c6581dc1b22bfd, 0x35882988e07e2f91
+, 0xd02a1bc15710355a, 0x055d615b1ba51133, 0x80d9ae7dd9aacac4, 0x068d52d6580fa140, 0xbe81d78c48d189bd, 0x78c12416e7b44dca, 0xd930d6f5631334fa, 0x763c101c3039010b, 0xeec1424b010bacb4, 0x6db5c602614e9e72, 0x1a0a6eb5900b9f67, 0x2cece8cbc37a630f
+, 0xd739fadd69f72d8a, 0x21ef58d61cd168ca, 0x050e4c6e822a920a, 0x093cabb126cbb8cc, 0xf6ba725e6e3850f4, 0x479bf157b4fcdb13, 0x01225dc799e62c19, 0x75980acf1a936718, 0x4383f519f0fc716e, 0x2a25cc25427c62bc, 0x49d2c1bed1ec7eab, 0x4fa21111cd8534cb
+, 0x53219dc607ac0393, 0x78109293d2587709, 0x3ceb244831ae1019, 0x21c4aa6de5874b7e, 0x7fef37c69f5a0312, 0x4e11c661d47a52ae, 0x7286d221cbe3c576, 0x70153a5490cb7c97, 0x5c3a7860a7694ec1, 0x7d6773048529a964, 0x6fb7332dd172a08c, 0x3a5e0a9965151c28
+, 0xc4413a2e5bc7d935, 0x11ffc764999d9199, 0x71de2ba3db0c1c06, 0x0e49bd2bf2360cf3, 0x1ac4b3a044829d5f, 0x1a164dc19cd5257c, 0xce077dffc41ff8d5, 0x5f37c6995d49a2ef, 0x7a16790ee41d0942, 0x39528328c7aac23f, 0x970a2ffb470886a2, 0x6c05b13616841522
+, 0x28d285fd7d88e058, 0x08a418f7a904e57e, 0xe53c0902fc16774a, 0x1564d6b090249483, 0x5d6b199866c025e2, 0x50ee43e1765f6c5c, 0x5a1e1d507f4f7607, 0x06e6431fce3a17d3, 0x3872191512987d8e, 0x5a2818f81116eba8, 0x2d4049d2d475cc42, 0x66f7c5afa1a5b9bd
+, 0x0d6527a184c507ca, 0x671d91852565dea2, 0x4c8253933ad286ec, 0x7d6631b40840d8e9, 0x47c16eda4a308900, 0x3423412c698f92b3, 0xf8b69c240ace4f25, 0x5ce91b2fd18ac8cc, 0x3f1f44e0e17bfcc5, 0x1854a3f9b8eac7e6, 0x37d21cfd71208e13, 0x4714dce7aba6a44e
+, 0x0d4b9c13ac606420, 0x6c12726e17283747, 0x9e03318086df8456, 0x5a2f0aa1963cc19c, 0xf7c9397919503aca, 0x5129512ccf584981, 0x60c0d15d1d2babac, 0x79bf999e837aaee8, 0x8f1175bb0f9e6b7a, 0x4864e52f21c5f468, 0x288e00d648686a19, 0x60f6246476c337d6
+, 0x13401f91ecee4081, 0x6ad5b7ae64361270, 0x57c64bd661849c60, 0x46e60316ae74514c, 0x93c982307de4287b, 0x7fb60c0aef2e8161, 0x9e91ad79de5395ed, 0x64bbead69794a977, 0x1ed5e4018315095a, 0x4e28b4d87903dc22, 0x42f16f748823977c, 0x43f58094a80e4fbb
+, 0x4b9c68ae6a2aa33e, 0x6d5118390a915d69, 0x7e5efec6e4ed6766, 0x316c0178403253d4, 0x065039569766c29d, 0x42b568b9bb49a20a, 0x6b3dabf4f5580a75, 0x15b964bc19ffd0ea, 0x507fccb81dd82535, 0x4d8eb0b8c444ba41, 0x27fc0dbc3d22941f, 0x7a69a2a936b7792d
+, 0x8146cd80b046c799, 0x015bee608701923d, 0x9696d9232383991a, 0x77b92ae75fd9e4c2, 0x2d5e56f4ac43b231, 0x45998c91be42dada, 0xcfdbabd520f159d4, 0x4020c59199645221, 0x5d4381fe27fd028b, 0x4f4600d99b48f068, 0xeaab6f41e1e3edf0, 0x544e54f2ecaec959
+, 0xc38b11923c8bd94e, 0x3fd76f18680b179f, 0x687552c71b515593, 0x525750def1f287fa, 0x1e61ff57339def6c, 0x1dc5dcab5c6f079b, 0xae035a0a4b5ef577, 0x4ad4ff3b71ec1c0a, 0x9c706eed65a1c81a, 0x059af740b0db0ca2, 0x8b1fb6ba77ff4977, 0x175f4bde5c8ae3c2
+, 0x92fec0b1cb5ec972, 0x16aa85eabb286321, 0x6c6dcbf45eced95f, 0x2d8da86dc99fb60b, 0x87754157bd0b7362, 0x4cf494dc1e42df58, 0x63980b3c17fddc9d, 0x68b2c535c30cfe7a, 0xbdd63cbfa3dbc290, 0x45a16053136f660b, 0xa8356626ac9d6e61, 0x25a896b66ef41036
+, 0x6b787718ad865bb7, 0x738e97bc8b35865e, 0x87feca5c3295b193, 0x486fd718267b94d3, 0x6e64b93fe5746d38, 0x26f03aa440202a77, 0xa5858c10a809b918, 0x463b90d5ab066d43, 0xf6e83994335dc5ef, 0x4c8c07499af34254, 0xc0a6040f39901871, 0x6ce646e8e029db8a
+, 0xe7e06df1e4ae9a81, 0x151b42fa9419cf63, 0xb1c13b54c5f058a8, 0x53046a5c11b2d598, 0x16a19cb2243c2c90, 0x025d67ec803cc727, 0x3cdf697d3bda8eb5, 0x2b1b8c2e3882e05a, 0xb0c169e16d302e5d, 0x469febff1b26bd34, 0xf6bc6944737562b8, 0x3181faaf2e51706f
+, 0xd4d12e4c35f21891, 0x49775ca87c680a0a, 0x112bda409685707c, 0x2361f1e52d133ad3, 0xe79cb411e732e457, 0x2572bfac803a676b, 0x8b4493240b727b73, 0x5a1ec89de8c3b376, 0xef7f37f0052ce55d, 0x6a57adab00d433b9, 0x7f12f00c1f968027, 0x6145f983bc5fc77e
+, 0x2aca01b933a5d6e9, 0x084b2e4ceffbd5f1, 0xda626760ef79ed28, 0x4bbf48370e103301, 0x4d35035ff4eef5e6, 0x2dc0c696f3e04671, 0x71468f2b7bf9d1b1, 0x4c92ec170a0ee542, 0x716b06714f696a6a, 0x4e29d8eed720c3a8, 0xde524ced30407599, 0x6f33c29622cc3102
+, 0xe5acd81cc71624a3, 0x34af32870d745b35, 0x67dfac58d6cc49dc, 0x5684dd983832d34c, 0x0325f61190726965, 0x52e9fad23868643b, 0xb2fce6c2a8e18a97, 0x0a7ea5055187d1f9, 0x3f13b9889fd66daa, 0x16afef5a56596492, 0x89b8e2fa08b6236b, 0x279c62e2c14ca7f7
+, 0x8fec028366707f2c, 0x539ad310abf1f4c7, 0x14059678dcce9ea6, 0x3e4db507b1dc9e58, 0x85dca0c11d85f03e, 0x1d972c5fb9f7c6ce, 0xab65a23f01bd6150, 0x2ea837ac58d7176c, 0x03d3a63b8eeef131, 0x7bd196dcd694694a, 0xb99a9d0d6d330080, 0x385df41fd8e337f9
+, 0x4d5148a62e402b58, 0x6656fd725e49fa80, 0x71f04ae3564c9d76, 0x3bf7173707d8d37d, 0x3eb0fe72d7817174, 0x1d1f3191e03456ee, 0xdb6f7e70534f5ec4, 0x10fa7604ad98f75b, 0xc02698cb09e28cb4, 0x5b54a71e5a83a543, 0x1a5757ec7c539be5, 0x5f03bfbf489dce86
+, 0x7df8e83b6d3be57c, 0x3a9558a8da26cc7e, 0xa034b4b8d18a4b67, 0x238b225c91dbef16, 0x4f8725bd14a66cc4, 0x664b90077391aad2, 0xff8164f605660016, 0x19f7d09d0fe54e40, 0x63011ecf046b0697, 0x7ea881992929d6b5, 0x7890bd83c4456293, 0x6f1b422da753a335
+, 0x675efb6a7343a0ac, 0x07710f37c62426fe, 0x0c92db9a14dd4947, 0x1d6d91cfe993d75b, 0xceef92572b0c8e1d, 0x7231e52393b463d6, 0x03418c21964c9c06, 0x70f1affb42330b51, 0xefbecc4d603d7e82, 0x760fa36764d0d114, 0xcb1635119cc65b75, 0x2704c5a0d821daf1
+, 0xf85b6c17313454f5, 0x0970a4143de9fbae, 0x9021b8335fab79df, 0x318bf9bb9be0e4a1, 0x1c7e95613503f3ee, 0x3bd8c1722503f753, 0xba4a70280f9c033c, 0x00b07b39add407ce, 0x8106090202aed1bc, 0x43eb161c5f76c62a, 0x3eda5221ce4833a8, 0x5d255ab06cdcd61a
+, 0x80779dfc6e20e0a6, 0x33e6c98f2eb5ba5d, 0x5326ddc2aca3e891, 0x3022c5d2760e922c, 0xa154a93ea1ccbc59, 0x77482a732d8859b6, 0xd6a3cb124d0bfc5d, 0x6697d5541b333fc0, 0xea43f1bb893ce2b1, 0x5f5362be0e6fe4fa, 0x589f3b36841cdd25, 0x0bf19790d8538713
+, 0xdb1d59fd03502ac7, 0x126f7f2d83f7d9f9, 0x96ee24791e92521e, 0x735579269da5b378, 0xf99c109a5b1f44e5, 0x21069f646c71ac2c, 0x6fc9a9ce9428a8ce, 0x389b864eae545794, 0x3835195d9cf182fa, 0x67b76e1c1d5fb8a4, 0x3058f30d0bc645c0, 0x2c9bbfc19395a6e4
+, 0x7db42f335881b1dc, 0x3611374fc305d44a, 0x32ac1d1501f247bb, 0x0909f79c1f66a9bb, 0x09dbbd9cf7249560, 0x0c24417f0808c05b, 0x4d98fa9f15c36dca, 0x07bedacdc0681f76, 0x1600f6ff29a343d0, 0x13d9ce15b05bc698, 0x4f43518bc060d0d0, 0x555a368ea45ae5c9
+, 0x06440d6fb620ea21, 0x2974c336b892a66b, 0x0c13cb1d738a2bde, 0x0be5f5168fee4705, 0x3abe5b99f8b8e2a4, 0x087526cae6961c24, 0x6f2e58418aac2368, 0x532f00e327366e9c, 0xb844a8bf33f20e3c, 0x0b659fb7f49c6acf, 0xae27d11d3f1e5aff, 0x255fbfb38f924f27
+, 0xedca648233176ddc, 0x754fc51662c7dfb4, 0x8a5b9d7a6f1be5ef, 0x64df86174303ba4b, 0x644a539e545b692c, 0x0d1220bae0896201, 0xa71e7693937ae243, 0x1497590866b10be9, 0x53c04916aac4de5d, 0x4832d6c39c45f3b5, 0x277ce479f9f39ce6, 0x619f14d385196735
+, 0xb5dbdaecc8c2be01, 0x75c79681380971fb, 0x021df01908dd056e, 0x5695e015d6feb25b, 0xe7c591aee04de819, 0x40a95f6f8cf11599, 0x0e4648cb6acee876, 0x7535f0957a6488e9, 0x3afe1e52b157b520, 0x5feaf9c37750e55f, 0x42d3d3bcfcc2b85e, 0x661aad6b20f2ade2
+, 0xc1fee4cf991058a9, 0x6d80503eb83beeb9, 0x32e702545bf36d1d, 0x48e83d3cc9d91bf2, 0x280671ff16f97222, 0x24cae56c6356cfe4, 0x8df3e131596bab9e, 0x502789972af97344, 0x39924764726c3c2c, 0x7c6e0886161b333f, 0xdbbf919cc626de12, 0x5b0278b8d7c75ed0
+, 0xb128e7535f29eef9, 0x00139f4f6eb1b71a, 0x52b4e7f77e7edef7, 0x1adb2d0e097f78e2, 0x5fb8445d718d9e74, 0x1bbf65546ad4d6c0, 0xc900fdb223916957, 0x6d4d301b5b0d406d, 0x0591568d75789e41, 0x1878d7000fdb098a, 0xdb35343f5ebdae0b, 0x106278c11039a126
+, 0xda50da95361fff76, 0x68daca6d59934ee7, 0xe796c94191dc4f86, 0x291cb71771e98012, 0x3a18286ab9cb89bb, 0x1a5541c334976359, 0x785fc2ca1a20b9a5, 0x1a0a466952ddee67, 0x3226a8e98a866710, 0x63630eaab74b351c, 0xbbd220fab350b4b3, 0x07eb89f6bd579431
+, 0xa7665b0ae6e16896, 0x3e77ad28e2bcde2b, 0x2ba0c70fb004bed3, 0x5b2d5265c662f331, 0x564bc147cfc5638d, 0x59265eb4a92921f8, 0x54026fb450caebcc, 0x57179e873fe6310e, 0x49a990c8bae96825, 0x78059a40496d909c, 0xf41f55bbe931f1df, 0x07b9b8e9c2060218
+, 0xb500a5355a4de6f0, 0x196f8148ae5fc9ef, 0xed5451668417aa47, 0x3b4c0a461227a1e9, 0xb3a81bb0219b8ffe, 0x7fb49a6714edba15, 0xba9d8d90cd08cb7d, 0x1fa6fd01b55a57a3, 0x39a2539e37e0cdc7, 0x704f06b667e62270, 0x5490a46f82f5656c, 0x10f4952b579d55f2
+, 0x7bc184afe0a2e397, 0x199caaeeebedc4e3, 0xc03755f5a7b40f06, 0x71744d8cbc6f8154, 0x42830d240aacad98, 0x2b205368e825a995, 0xd1d24b413cf2e952, 0x0340c359e8c00b6c, 0xd7128066d12a2172, 0x462ed9071f71fb42, 0xf92ec8e8b4cc46b3, 0x69a7cb92d8638688
+, 0x0c14072e1eae72ef, 0x0882ecb26dd425ae, 0x7bfd07c03bb13dfd, 0x7c189e22d2765bfe, 0x192d69d066f0c7ce, 0x148fe455f65b2fce, 0x594441ce63fe4de7, 0x6bd90f877d0ea845, 0x2e1a7634a596e7bb, 0x34a25ae20085a52e, 0x0cda849353f9bb17, 0x71141647141e105b
+, 0xc66f889d4d111515, 0x7695345fa138b3ad, 0xb5b86a4a880ed543, 0x54e0d630aeb1bfa8, 0x738ad6e653f3fce1, 0x7d4d64b086e7e8de, 0x2a5981231a313b00, 0x6c7c492634af6ccd, 0xe867202ef61a6799, 0x26f0b538c3667f83, 0x136ebd2a38f06dc8, 0x4411c99f4eaa09bc
+, 0xb6033e0aa47abf6e, 0x36a06694b19daa10, 0xfcafad0c0c1d419e, 0x575a77a3c8ea8bfd, 0x1f702fd22f1869e5, 0x4fcb219c7f0b9a92, 0x62173e47e4f3fef1, 0x2f431ac786b32aa7, 0x5c984d6b4d8ad0c2, 0x1e103317c0165cf7, 0x755388a19167ba50, 0x740e43bdb42e8f96
+, 0xd8a23d30b7e3e35d, 0x4878f7e304a1279a, 0xab8a6d2dcbe3ec18, 0x449c4619020d87c6, 0x4f8937d7a8e5b871, 0x4045b671af662f08, 0xfb7dfc1d4927250c, 0x2ec22a55631945e2, 0x764e12f426445a77, 0x7727fd4b10a8251a, 0x8566a69bc5001419, 0x3b2262398c1506fa
+, 0xd117f379ae40552e, 0x3765866a938c87c5, 0xdef28f9504f2941d, 0x332b0716841677c8, 0x8ec1aa224eec47e1, 0x7fbf760c10b55bfc, 0xb90bebbf8b3fbe62, 0x3b85647a8e930bb6, 0x1be83146e6051e49, 0x7b2cf93d97632558, 0x858cefdce43468ae, 0x024a47da3a295cf7
+, 0x67568ee4dca6ad13, 0x51c553abe3013c45, 0x5305e32b48f46167, 0x3fb387ff38c4ea8b, 0x2762776248233b7f, 0x56408dbbd86f6f73, 0x5a786928d80dc4c4, 0x7ac17225ccb9307b, 0x589a9f7133c57491, 0x548aa8ae75eb038b, 0x421737e8bde855cc, 0x0872c7af44aa317c
+, 0xc203b0cccac32669, 0x15f31ba8ea1a733c, 0x0ce1f96b8b7c3ac5, 0x174e6a2aacef3c2e, 0xc62e7fd1f25f2567, 0x7a371de1adc0b8b2, 0x5337910699bed497, 0x2d5ef7fc944a8bb2, 0x2905d5b0d798765f, 0x27985e2918c39815, 0x5e5db34b82448a87, 0x05340b4713aa5e6c
+, 0xb16047a2447f2c7f, 0x49a5175f3156f8c9, 0x2a40c84090637d7c, 0x249755a51234b432, 0x3c2a65619957e16e, 0x6a3fb3dc75ec242e, 0x61d957cd55bd0ee9, 0x3173656c3008882b, 0x4a7091e41125689a, 0x789716ee52654df6, 0xf8e5e5e0231ac2d8, 0x67d14563b6cdfaf4
+, 0x1e96309c8641a146, 0x16662f5f914fe49e, 0x18568c5e845a5784, 0x2b29da4c9f256c7f, 0x45393940a21bc139, 0x427d322c4148cdee, 0x689b0bbdf551bcd1, 0x1dae0459313b2573, 0x8712624c52228df5, 0x7813d86947c3e047, 0xd3e9050b63fccd1f, 0x11f293e6c23fce28
+, 0x028706a5267c957e, 0x6e8caed90ecc0a26, 0xa2b6864ca9d8ab41, 0x4380a9949067e669, 0xc8aa2f7dbf9c0c18, 0x741c5532a83ce15f, 0x61a90ec294f16536, 0x4dde40d0e622417a, 0xc5d9e8ae8eef4d9d, 0x015f76c12dee3e31, 0x2d6d7b10a3e89e6a, 0x7a7e48d289949e2a
+, 0x34bd28c30626c78e, 0x6b6a1432150a09ed, 0x195c300d3780730d, 0x0bc6ccb4cc604164, 0x1c0ccb64b85de73c, 0x314113de80ccfffe, 0xcebec64cfdd45443, 0x7907bd76142e1adb, 0x9685457778f20f17, 0x1430027662adf646, 0x67d8c1bb4849cae2, 0x7e81df3eb319a881
+, 0x02a88c49e755a754, 0x5459b0c31d9e970c, 0x0a198386e9c8d3ff, 0x22955e26fd6dcdeb, 0x1b84e01dbbb7e53f, 0x45f34ff68494f37e, 0xc4f4e06b80a33139, 0x20e1cec4ec3c161c, 0xc105c92ca20dc1fc, 0x041de97a911057e0, 0x3bcf928a5b93d1c3, 0x5dd51094df63f694
+, 0x057c87744f9e22c7, 0x58aaf15f829f5190, 0x997a13377e30d059, 0x22cd7323b7f78d22, 0xb418ecc540a59302, 0x71e05394d77245fd, 0x0229e39f17dab0c8, 0x1939de41acc9b9df, 0x7fbb9f11402ee745, 0x0ad059bdc28f09a5, 0x19a66d208272e109, 0x49ecedaaae7e1b2e
+, 0x38029cdb3af19188, 0x7aaaf147fcbae228, 0x8b0ff5bb14bb4274, 0x476665c1f8558ef8, 0x8f58a1d54adb14ae, 0x5a8dba0edd888dfd, 0xc871265b79723ad6, 0x604ece7956c153f7, 0xe4fa5c2eccf7f594, 0x249ebee2abedc52a, 0x1eb9eecb9f7071ea, 0x12972a4269e26eee
+, 0x2cea6dbe88b56504, 0x400a0a1288126ca2, 0x44d9130471fbbf46, 0x4b28ad4457154aa8, 0x8c152bdbe9128b7e, 0x3a04dc902211261e, 0x58fe724b3be23da8, 0x7a7b4b569e6b670b, 0x6ab81ac1e9770337, 0x2b48cc39895a1b1b, 0xdfb4c7bf8cc93279, 0x2671343a7fb980ac
+, 0xab929d545457b556, 0x356b0dbd46446d67, 0xdff68660258fc2dd, 0x3a667475889111b0, 0x722d43d66486080b, 0x72dc313824733330, 0xb200bd1e3f3e3997, 0x4e33716f140c6978, 0xd0bd198c5f0d7a87, 0x5c8634d774d4f6fb, 0x91ed55780e0f4224, 0x44f7fc87047d36e1
+, 0xf49e0e22e2d4b191, 0x5258660d7049937d, 0x7e9ce7a154944c79, 0x2310787688b22f34, 0x27eb003b8a346db3, 0x797e73fb42f34500, 0x24b9ca43460eec35, 0x6227daf29f4053e3, 0x0ac57a05bd0e359e, 0x67ecf50d91dd15bb, 0x408b61132e89d8be, 0x10c3fb3d05014383
+, 0x7dc6b299ddbbf30c, 0x432e1911ca353313, 0xc7cfc9f76c4782a9, 0x17cbd442f6dc5321, 0x483ab467488c0655, 0x6b4f799dd9aa5962, 0x4b37290d996b19df, 0x4895c92866978b4c, 0xba5dc13e224428d9, 0x62bad59d4edf453c, 0x6a83d63fccdbc96e, 0x2b403672eb077fde
+, 0xf6a2291884d311dd, 0x5355a22f7edc7377, 0x47daff535f7e73c2, 0x105a1d413f9dfadf, 0x389a1f09568b4f79, 0x2dfdfbdb9c3f8e16, 0xb10e8913a729d2ea, 0x4a95a6ea21aca876, 0xa06309379dbc2dd5, 0x5f5464a1575e97fc, 0xcb6ceddf600f5020, 0x0f5a180fd046e3da
+, 0x075182c3342b79c9, 0x5a93061dc149dd33, 0x811efae7510badf8, 0x35582f7306d60ddd, 0x81f2567f39186509, 0x131d74ae4d12a80f, 0xfa2c5fd8b22cdd0c, 0x6266943d5641291f, 0x7195f5bb7dc7cd66, 0x0f8b82481ae8adea, 0x536628d22cee05fe, 0x3f17cda73b150221
+, 0xb647c483e6fb9de0, 0x77733157e30f663e, 0x180f1c777d9b8aa9, 0x433f708f335f5c96, 0xb8e2fc1e0b513724, 0x3f3e90a817964c72, 0x267596a985d78951, 0x6728ed70bf73aba9, 0xd3c4ed6b91da83c3, 0x27cf02feda3b9d5f, 0xc58ad8b99f544170, 0x4fcf4f678464a1ff
+, 0xcdea476a90f2a4f7, 0x54f2de50b7459b66, 0xdd89de531d9892dc, 0x554b1242b9cbafd2, 0x489630f4536bbfd1, 0x200e3e6d806a1571, 0xce26eb01e21c063b, 0x02f31c679394bf8e, 0xe3302202e374ee19, 0x1f0f3ad0626ddf5d, 0xddfcd95383b51987, 0x75875b82fa0bcfec
+, 0x6a7be1d8a27c1f48, 0x74b410a7d644c165, 0x68fe958967733dd6, 0x7ea1a423016e8e1a, 0x8e6207bf6ea2fb94, 0x0577d2561a8290b2, 0xe15faa38cb501f78, 0x59fb234d54937f9d, 0x85958469e9973fce, 0x03d4229e2d45b033, 0x83445c1dc0e4f4a7, 0x099c289eebb63198
+, 0x4d3cfb5d3fbb96cc, 0x252b4a4446a71c5c, 0x9c7d74c204e658ba, 0x1ad77d4d576c01ee, 0x2df9223bd68fa167, 0x228803c876a24d4e, 0x9089ad580ec65bd0, 0x0c228c803b9bef0b, 0x95924e06d9ba71bf, 0x578af8e3075bac0a, 0x74649bc2d9db5d30, 0x60b4c37ed51a1a64
+, 0xe35a6a42e815b1f5, 0x77cfc6d783e93540, 0x6cb51d5a0d1b30dc, 0x2740ebc66a3d7f34, 0xa70c19bfb00f6d7b, 0x2c2d1cb802d041eb, 0xa9cdbb049b35b604, 0x0639cbe62a44b9b7, 0xa5b9be0db6f3f2a7, 0x11cd9fa5c2a5057f, 0x146622b782a26c92, 0x46c6b8517117bb28
+, 0x49137883d2b72657, 0x1de85ff1cd8b2367, 0x82726acf25816555, 0x090908034b246bfa, 0xfc1453fef24a6c65, 0x68b751066153bd75, 0x2d286159128736dc, 0x5e116c14d167d347, 0x90e9f579ff9a9fd0, 0x062ca292bd38a58f, 0x28cdc1da3fe650a8, 0x7969c7bb034aa7cb
+, 0x7cf2f55f1cb73004, 0x4f3f1d0da1e07b5d, 0xe9430a782ef8d147, 0x206e9fcbdbd28dac, 0x4c20ed03184aede6, 0x6165999d2c0e9013, 0x03f23ae5e766a627, 0x0d1162124ab79d5e, 0x0bda08e2909b2ff6, 0x2a478270cd145ba9, 0x591728f635da8e8c, 0x2881234351895214
+, 0x58a4dc3045725878, 0x29107619af8e4c99, 0x81c380b2112adbc4, 0x3fea0f5eeed14543, 0xd0c4fa660146cd78, 0x15b048090a566dc4, 0x7e96c9c71e512735, 0x53ecae7932410ed4, 0xff6b8c7024925341, 0x286f43180a9fa95c, 0xebb9347972b00c57, 0x0440e88dcfe8ec39
+, 0x9fa0d0e45326f63e, 0x461f911931c96711, 0x2a309ea9a992a1ab, 0x1a922c5dece8494d, 0xf833a6f71476c143, 0x7cef28711749b3a9, 0xca60a4c41b0c22fc, 0x548c7214f01db3b8, 0x9a72df7d26623d3d, 0x3e845bade7be554c, 0x39ec22fadadd097c, 0x1140869823cd0d20
+, 0x46e43ee68725d3f5, 0x62151abfb3f40c8c, 0x4311d3ce7e0a0960, 0x64b76b5d1009a805, 0x3f1ba06589d64e53, 0x01199584f36a7dc7, 0x0ceafdbe60f35577, 0x6b8fe189c4b0907c, 0x94be03b06bb0007a, 0x73ac0fe95ba53692, 0x34abd3a5868db0cc, 0x2ab8b506e6f60f32
+, 0xd70d62373244fbff, 0x005f3daae602435a, 0x7ac43feb95271b15, 0x34c8e97361a40b8d, 0x60a6ccacdbc5dbca, 0x55c54e063a5988f1, 0xd0b9f6e85fbaf5a6, 0x5a94298c9c65916f, 0x7a752804b45c0b24, 0x41a5b088beae9356, 0x40263906c3fb1523, 0x5897e93fb5925484
+, 0x0e7d6171a6ee8998, 0x388471ffb99f7dd1, 0x5a262fc2767f5b09, 0x0bd9f0d9355c506f, 0xa34affd14b455c31, 0x7904114ccb00d7d3, 0x34352d84b4383e2e, 0x5d009e5cf2c84380, 0x3026fe3fbc83957a, 0x508f570e3215b0d0, 0xdc5fd3f01f041e04, 0x64d4896d06a6f8af
+, 0x6bbddcdd724d6e26, 0x65293f851a01127f, 0xb9669840426ac7ee, 0x060f0bd520664124, 0x571bd434dffbb3fa, 0x3010b7868c37ed13, 0xd6b75fc7a167e106, 0x4d04b958ae62a65e, 0xbea450ceaa8d2a10, 0x7c92fb11a908dafb, 0x51d3b98737a8cbd9, 0x5a549d8de4bef99e
+, 0xd2625df94f3bf982, 0x3a666ebcfc979aec, 0xaea27146f29e1f58, 0x0eb4a6a4f2135b56, 0x9c94a1e9a4e9b27f, 0x078f825accc56e36, 0xd4034f8bc4039687, 0x6d71bbe6aa4dc4f8, 0x3c60fe11da710ef8, 0x259d84cde128698e, 0x57394e6e8f79ba10, 0x7dec432435f60d39
+, 0x8ddd5ee792184731, 0x2de4ea0ae6d10417, 0x4f05ef80c7e53852, 0x783eb504b4996021, 0xe2007f1da0dcb430, 0x6841895ffd57d0f0, 0x9dcc5e54a76b60c9, 0x0e13e689ee2abaf0, 0xb18b952fa10532ee, 0x52cc93a23f5b0304, 0xc4bac3447082b917, 0x44ead96f3a97cae8
+, 0xa55fd8b67564246c, 0x24a0625d1cc778ee, 0x574f5913115acc0b, 0x08c649dda1fcb0c1, 0xdd3d7b233940efd4, 0x2f73e451a485291d, 0x38c810c9d0dc9245, 0x45673feaa23dd9be, 0xd1817182f4ff3482, 0x246e0215c236b443, 0x272e64fe0ab352ea, 0x7dfdbf5055ecf8e0
+, 0x51929b7af5eec87a, 0x313b38790b5b686b, 0x34035e91b8167392, 0x673cbcecf59b3a06, 0x563f66a5f669ca9e, 0x5bc95381030009ec, 0x4dae877ea6685e29, 0x348f4dc11fc839c8, 0x5244b6614098b81a, 0x32f6c4121f7f56dd, 0xde68cbd68892c903, 0x0387d83808da8578
+, 0xab887f50c909234a, 0x6c645dfd7b8df432, 0xaea2914ee6249c2c, 0x389adc9bea79f1df, 0x264bde643e77c830, 0x28101a9427b5db2d, 0x215bef51f16b3b5f, 0x42938b52dfeb72f6, 0x722193a0d05e5b70, 0x64efe9f39044e09d, 0x3cd714b6875fe8ae, 0x734411e54380b7a5
+, 0x328a8853253efdaf, 0x45da30acf59c99a5, 0x9d34ff9a10e50ca0, 0x2d4a425fd0885f1b, 0x7da6cb2f70e1586a, 0x216e97d393159360, 0x12c2b937e2c07f91, 0x07b630237ecb402c, 0xbb35bcb7e254e0ea, 0x368e17ab91f9bc0a, 0x7b8f69b0a4212422, 0x37b5f8d97f54b27c
+, 0xf158a784e9291cd0, 0x796b389a5a948556, 0x13a6e44fef498e22, 0x44460827542c2422, 0x7c045088abca8f79, 0x392cb18635466fb2, 0xd09c2f3dba8b0c88, 0x573486406bbfad2b, 0x446d320520f78678, 0x18dc222697ebbb03, 0x8eb8dee6ab0d34cb, 0x4b8413c1131c3937
+, 0x4a79a9d80b33ed60, 0x26c5cdfc14871171, 0x94473270ca3c352b, 0x481d9f1673ea76ae, 0xf8adfd386da99b75, 0x7641bb51661bd6b0, 0x024b46ff22b3ff37, 0x71ae6d642c464717, 0x2959a39c55776bd9, 0x5cf4f203b5da74a2, 0xc673aaca718c2ada, 0x0e7956e842a35f34
+, 0xe7f60d2b68314344, 0x060e693c4ab81822, 0x4ae799c1316ae839, 0x71a2f67f80b8f14e, 0x4aca840f2b73fb36, 0x155167ea88c14e76, 0x96706740d144b67a, 0x72384c514bfd96d1, 0xa10038a206fdd32f, 0x32d2863a6017c564, 0x5d7e10c327bf1a9d, 0x1aaed7e8f763625b
+, 0xfc2303586655a3cd, 0x7f7d4b308e75fb66, 0x20b621daa5719cbf, 0x6357407f17de822a, 0x85102ff411419a95, 0x149fb2943f71d18e, 0x6536b4a806c7b189, 0x50e318aec711b60b, 0x9d55404e4cd24bc8, 0x738ee4b869f11f8e, 0x2f9652c93e5962ac, 0x3d37309cdca09848
+, 0x4adb39015aa64578, 0x577e3ca93479e03b, 0x163e095bf4c05313, 0x60e5c703b00afe8d, 0xdda3692daadab57b, 0x24ebbb8bfc694472, 0xf4af1c63b0fb0f78, 0x5151a1c851883876, 0xbc25b7898783a235, 0x07c5833f60c1b145, 0x0065f36a7bf86982, 0x7808263fbb883265
+, 0xfb1bd7034b21ba5f, 0x139b589345d4816b, 0x04c32beb784b750c, 0x7015bde1aec8662b, 0xdebf03e4931ca673, 0x3034adc3e92ff6e2, 0x505d2c4a5482fc40, 0x4c203d7545a8e3d0, 0xc22002a230246471, 0x1198841a46753a5b, 0x08ec8677f4552dfc, 0x30f4fa935eb759f0
+, 0x22650ade8be839cb, 0x290eca3757d80d54, 0xc18a8babf720e440, 0x4557745215e1d334, 0x4cbd5cd5a583f31b, 0x600147fd635662aa, 0x42c8edcb1ae2e6f8, 0x48d30da0dd332394, 0x32ff5ad1258bc3e1, 0x0fae47e2e63ee151, 0xc145e5de8429cfa7, 0x2c8e6ecb2f98701f
+, 0x724ca6d9db706e89, 0x022a6352ca55e1ce, 0x3bc198ea961aadf5, 0x06dc61ae9dcdb263, 0xb348615f5effb7ca, 0x15142941844c8e67, 0xaa854e41f20d6313, 0x72fd447e2c3f0ae5, 0xe706bae215cf8f5a, 0x3f80a873646766af, 0xdfabd5d8304eac6d, 0x00b887a160473913
+, 0xc5a58fbf92048f12, 0x306e2d30c175cafe, 0x71fc636a16b4f962, 0x02e45c2e8240d6a8, 0xed10fb6b330b0a13, 0x4cfe24256bfa4cc7, 0xeae4d16f34f7240e, 0x53077bb7188287e7, 0xa9eed5eae7e86f69, 0x7d758d31841d6f37, 0x0d3dcab4c7fa3c10, 0x66336b466bb67967
+, 0x7a26caa2357a8308, 0x556520ac73e2c5cb, 0xd22b8ffdc56f6eb6, 0x5f92e67072bb9f7e, 0x9981d52183cdd9d5, 0x55c63fc90bca5ac3, 0x29a7f73d8cc27393, 0x464da117dd8a437e, 0x49111b4ab2fc335d, 0x6ea580a5b06d9d24, 0xe4dba21a0f555a5f, 0x7dc5b7bf3568ac6e
+, 0x6ab40af37de1f6eb, 0x78203ddd4253202c, 0xea9f848bd1600adf, 0x2ff0247d6609a95d, 0xb2856143fe4c25bf, 0x47c77dd2ffdd5506, 0xaba9b3286fa89ab5, 0x63b07787b1394f8e, 0x0a4e2491d5719927, 0x359130903ded2cf4, 0xe1c14474b5b8af0b, 0x24d14e400fc87db9
+, 0xf06d4db0e1c09061, 0x02e443757c16c098, 0xd5f2cf5ea71c9dc3, 0x5264c7dee4d8463b, 0x30766fa8860cc59b, 0x6aba00905e47e47c, 0x326403a830179fd6, 0x5ca4f8af4f59365b, 0xab8303790e23171f, 0x504929bbf5e31d08, 0x3520e5f08ce6214c, 0x61ed85337f7ae3cf
+, 0x227442787b28269a, 0x518126e456b6c964, 0x6d408d421089dab2, 0x7da7a78af7c9be9f, 0xc8fa89b2d6c1cbbb, 0x718926b23c653dae, 0x47390cf4f2c3ce04, 0x2328861d48105f51, 0xa5e48c7ad81069ef, 0x31ff6fdfeb2f7ce9, 0x5cd19b762d122509, 0x268ff13db5be243d
+, 0x26fe6d16503c36a8, 0x22c708b6905f9831, 0x0f7b9fc4a7efe3f6, 0x4ea6ee7c47534f5e, 0xb224ed919cf99344, 0x42a22fc3fa27ae78, 0xa3169dd5f01b5f41, 0x40692622715ea62e, 0x1537f37305181c8c, 0x49b8ddfb0bd5f66a, 0xca87f31785fbcb2f, 0x2cf98e7386ed0b93
+, 0x6b18ced22e951ba9, 0x5fc8f94de3c6f5c0, 0xb304405c9ad382cc, 0x1c1f08cf83501bff, 0x4e8e001112a10781, 0x6443dd33a398dd3f, 0xdab4b6b73886342a, 0x78b34b0e38bbb22b, 0xbb92f10f9e316b2b, 0x286d93073ad994be, 0xea84a584e148f8b5, 0x66f1f94616c71caa
+, 0x6474d8121e1c97e2, 0x0970cdc58800202d, 0x9949b69a86332d12, 0x347501b284b3ab19, 0xcd23d11329b9cd33, 0x6b5d519543463926, 0x68dc5b31f9d8223d, 0x0f85f1695ae0e7de, 0x7f8884369aba95d8, 0x69219002b9203c8f, 0x991902feeaee132a, 0x0becda46466d2d1a
+, 0x8268813d2167a297, 0x62a3c96813b3934c, 0x53e53bcd1e6a30c1, 0x097ce7689ea99372, 0xc25ffdebc589b581, 0x0a8318f48539b191, 0x3d14a30977fab3da, 0x11ed248c82200a1d, 0x3056820c43365bc6, 0x4e254b2ef17a1cf9, 0xe648007fad9a34f5, 0x635666c88be6315a
+, 0x16990bf04b93e54c, 0x7b68ae3fe8936224, 0xf9a5d93c01abf63a, 0x66f12ce42af7d421, 0xf6c48a2bee8806c9, 0x6d0823b90e2c295e, 0xe04c79cc4f8c9746, 0x3c3abf5464947bdb, 0x8818568e0abfdaaf, 0x43126f71475566ba, 0x893a56fd7d863ac0, 0x588953a69eefea74
+, 0xd2d5bd54fab02902, 0x77637e7139f684cf, 0xdf0e81e97949cc31, 0x15255a750563e42b, 0xb242fc293e6e022c, 0x20924483cf98ca75, 0x3737128023fca8ef, 0x0202f8ac5ecc8e30, 0xdabe9af2c142b659, 0x0900ead85c3b821e, 0xcf1454573244fe7f, 0x58472e62d1db35dc
+, 0x61d2704ec31b26dc, 0x4e461d8a8b9754a0, 0x9875bad7a6c82a2c, 0x7e1abc58f48a861d, 0xe67e4bc663ea6401, 0x55b866e6a783e81c, 0x007a6e129a87e741, 0x76fb77b888a6b1e5, 0x3bcf52cd6432ef21, 0x4f2265d16253e3a6, 0xcadc0c0653212623, 0x4d8ac997afd46741
+, 0x362527c5cc764b8b, 0x30cd44ade898ae3a, 0x9cf043acc049af9d, 0x1a056e6f062afd4d, 0xca0cdc758acfc389, 0x70766e1014157c1d, 0xb76e529891740a56, 0x795710bad7b8229c, 0x04cc42c2ca4c7e26, 0x2310d58515e851ce, 0x46f7cf9d7e1e2b8c, 0x23cb07cd65f170cb
+, 0xc75ed8663f328c4a, 0x65f7c1a4a5ac6957, 0x73761cd5f585cd2c, 0x58e537f15ce6aa92, 0x89ab1adb9b97d3f2, 0x7f3b20eb977bb461, 0x91f52db178a1c830, 0x427cd0d51b5eadb5, 0x621bee84bb976511, 0x7562668695884c0a, 0x79e84b2d64c04372, 0x7e612702dec04949
+, 0x477fb531657a98dc, 0x03d7226e4dcba48f, 0xa0e1be1d17ef1ec3, 0x1f91d9198dc65e85, 0x8b0dce60816307fe, 0x2f375424df005b15, 0x53b95421c9640c45, 0x59eef9534a110e12, 0x8cae4a73247a94b9, 0x0a0ae76bd486fd02, 0x4b8e6805537408b5, 0x12176d6de39da1a5
+, 0x01a1a3d26a54ccb9, 0x7067af0e0997531e, 0xcd58b7658ac695aa, 0x67697adceb25d84b, 0x2a3712b5be1a6dd1, 0x4ee0417cf47e05ec, 0x8586529ec23f3208, 0x0cefbd2a46243eb5, 0xc53b52294ffa3095, 0x04f09d8a2e3cfe1c, 0xc822cbaffdb1942d, 0x593b5c5900e99b2d
+, 0xc4648abebe1f76fa, 0x679c5e36b0745b2c, 0x4628835b8688ae9e, 0x3d1d44a6d0026153, 0xbcf250d3a30d76c2, 0x21a17b3fc52b8653, 0x799ea327c94802ba, 0x1f06a6484e39dce3, 0xa626f2373a20ed68, 0x0fe61556436f0d72, 0x48ebead6fbfff761, 0x432965e9d4ec7951
+, 0x28d423b028cc3e02, 0x62270d9eafe10dd4, 0x7c5c07c8dcf891fc, 0x49754ab832688c28, 0x02e3c9284aa5ad2b, 0x57abe7d5b82343c5, 0xa1ed931e707d0802, 0x1cb973b404c5d740, 0x9dfa98b5d601a70e, 0x312202530b443dbc, 0x68d766530daa9ea9, 0x660e2be98e288571
+, 0xd6fe13abac8e52cb, 0x60825496bddc55d1, 0x4987df8fc6a5de70, 0x591120a2a169c867, 0x03991102402f620b, 0x577c57e82aa6d2d9, 0xb67e154658e12b19, 0x0c53771237205021, 0x3a820ef532e1164c, 0x018355863280757d, 0xb89f89c795b88d63, 0x413194db448c32ad
+, 0x33d7c59079c8d990, 0x0e9424a7aad91dca, 0xb0fbcac35d1293dc, 0x4792971c3890ee44, 0x2413e748888e9d8c, 0x62a35e4fe2dd5f91, 0x780006b8a17a0bd8, 0x3527e31fcd76bf66, 0xf1c8587953434785, 0x2a0a36352ec1959d, 0x8a6a0f012a98cb95, 0x55ce2962166b4384
+, 0x9171f137cd43d2b4, 0x6666ac9180f83d1f, 0x1423e29aebbdf71b, 0x1fa9ae4827ec76c6, 0xa11cbadb24082f2b, 0x48b15194ee193425, 0x393093b3376fe315, 0x1449fa632348eb83, 0x8aed4534f4908860, 0x769041185b530c43, 0xfacca8b2aa6ea377, 0x176bb2ef99fc6c1c
+, 0x60b3df3af3f360fc, 0x5301d4cc457edb5d, 0x68342c3147511c66, 0x5ecfe4c5086e2249, 0x0612b02f30b5d30b, 0x215b86be0c849c32, 0xda73198dd2dd2ef1, 0x1571b49debe93248, 0x0605833d39c0094b, 0x57dd9cc4cf9d761c, 0x5bdfe9acf8b181d5, 0x6e4169dd5fdb9029
+, 0x9891d75889c9a9d7, 0x12f278c02eeb6c9a, 0xffc6753e4cc989aa, 0x5b1ec65204d33741, 0xafcf4ddf9e2af42a, 0x2e147188ff5a6caf, 0x124ab175a4c65d86, 0x3260edb79ca2e63f, 0x6510fd609a894339, 0x5285aae16b08deba, 0x06b97fa67ff2c521, 0x4f446adc48f7113b
+, 0x9359398ccaaa57ed, 0x4695c30682581b50, 0xd49e6bc9b43b9231, 0x0771c3bc1d257676, 0x94618047a17ea17b, 0x492bb2e045d60a4b, 0x5a39b73a7a071d3e, 0x2a9e696bbf4821f9, 0x91f1c39195a7970f, 0x05a586c8c3c53779, 0xe28c06c2e296d84f, 0x4d947273d8f6d2a0
+, 0x8c437b084ff431ff, 0x1017ed415431a986, 0xadeaf33a14e5eb04, 0x146bcca94536efd3, 0x1a23fd47979bd77b, 0x458d8b43a67c1a47, 0x1b4d451ec0c11b88, 0x4c1fca0c4facea67, 0x6c0c48bf940b1ac4, 0x0b6c4e0ba6896931, 0xac31f9aa99fc4eae, 0x7e278665bbc06d3c
+, 0xa4949798f58300b4, 0x1eba88235393027c, 0xdc4f2eb9637638ed, 0x675ff19dac0a2458, 0x8e8db145c5895e38, 0x782c22d19d23bd91, 0x023a62a2b7a388f5, 0x2404347fed704b9a, 0xdf07ed4554687da9, 0x2dc3a8b9561e1475, 0xbf41d1386f9c3658, 0x2cb057985c5fd7bf
+, 0xbd6db050f30e2072, 0x6cba1a0affda5a4b, 0x80c02e49abe5466b, 0x6656a715606d9b8a, 0xf313b78c5b473ff4, 0x59277218d69c4b1e, 0xb5156f02eeee9cd8, 0x658b30bb33c8d520, 0xadef1c88116c6292, 0x616447ed4ff25016, 0x0adfe87bfa51c913, 0x0c9b9872bcd46617
+, 0x59c362a1694e7e45, 0x3611e0728e4237b3, 0x5677b072ab673c22, 0x747ceeffd2d263b5, 0xd7538a3ea61c610e, 0x6c6fb56885939f8e, 0x47917c36b9bafc8f, 0x4d9c4ae04ceb40f9, 0xb454a119a63acb29, 0x5a1a6b23c275c7e3, 0xa1935c3089e750fc, 0x5b284dc908065ef3
+, 0x5ef9be81056b39a5, 0x4af8aee817de440b, 0x8fff40be28e6ae9c, 0x744734516c4de6dc, 0x2e4563ffefb40e06, 0x14007533dee1d684, 0x67c5abc9a8c3a2fb, 0x4b4b5bffc63189a4, 0xe26c43afad2d66fe, 0x03187bb61caac1d4, 0x0a6714506ffb9c74, 0x64bfc7999d41a9e4
+, 0x4cd2bdf55d0bda6c, 0x16e1ef50c397dba3, 0x3786302f73cec799, 0x4a11bc30c6587806, 0xd001f23b076a567c, 0x281a9d21782d5f21, 0x877dd5c0feb408eb, 0x78380f937a9db678, 0x53c4251a6c54948f, 0x149262ce142917cc, 0xd2d212656aec2619, 0x4fedee5aeea7a1fe
+, 0x7b03b00bd14d62ec, 0x2c81c5de2070c9d0, 0x83e0aa9f324d9f07, 0x5c9aac7093839034, 0xecf0717c0523716b, 0x17c196299fe883ec, 0x88927e3f4b5b8b22, 0x066fb3d5206c7990, 0x13870ef79bb60fe9, 0x4077b17c6478fa8d, 0x1659c6fb6620440f, 0x00a96f7ec49f5390
+, 0x6ed5dcec3fa2d9dc, 0x0b830727c4054fad, 0x059e2d852a7e94e1, 0x328404ed760066ba, 0x9502d215a89a71ab, 0x5dd95518ec7b7060, 0x363bfcb2326d9502, 0x1a33e095a097d4aa, 0x277659aaf9bace81, 0x5656c3234e2c921c, 0x27d3011a36da6ba0, 0x703863db49d48510
+, 0x5ac09240094da48e, 0x30ae0051c61cff75, 0xdddf6f33fe2e0542, 0x77df36e1e041d9ea, 0x5948e752c7d5b1e9, 0x28e15cb4c5125b54, 0xd9f941e30435d183, 0x0f5916f200755151, 0xe33b96b5051b3eab, 0x73be4c2c2926d1d3, 0xb794aaa84343b1b9, 0x6acea16a8707bbd6
+, 0x98e1445a7a81134c, 0x7fc1a0306185012d, 0xad31bc3ffba08a0c, 0x7b66a709ef7fcd17, 0xf7115e72d7a562ff, 0x440a7fd17130171e, 0x6bdccdfa0e3a06c4, 0x1ebfa797651d5838, 0x71ff7386400a1220, 0x04e54f95d97bff69, 0x89e60dcba96e7d09, 0x7330fb5084205075
+, 0x615ebd6888e0bfe4, 0x1a7b080f4591e1ad, 0xc2f8e76fb903b8ac, 0x225ed1a7f536bb97, 0x9ca64faacf490301, 0x78332f68ecf055e8, 0x45b654b9d4be2f4f, 0x6a1a11b54ba65b90, 0xf8d21c05ed2be4fa, 0x265945f96834739a, 0x357f49fbaf408a8d, 0x6764901f7e9948ac
+, 0x47d07e94fbf70881, 0x0d7d51517cfafc97, 0xbffd2a2ee40b5c74, 0x36ab7d59240a9285, 0x118fd2dad4ff6bce, 0x40836b1f120b68e0, 0xfced307b8db1c14d, 0x3d3a78cdeefb14b6, 0xb48553472d6e0c0e, 0x41f3164b8b79aa08, 0xc620cdc3610b3767, 0x6a50431f1080aeb2
+, 0x18dd9465d19a3844, 0x2d2c76e0454395f3, 0x239db2312926b0be, 0x65010d4adbfe2fc8, 0xc77a30d443898256, 0x48f8d08d3a6d64ad, 0xd869270b0e6ee747, 0x1bbb8e9f11a895ea, 0x0460c42a1187c287, 0x7edff43154fc8f06, 0x1a780408861c728d, 0x0cad8a267583e056
+, 0x516aef25f82866b2, 0x3f3157f6f114f6fc, 0x9826b8161399214b, 0x536d1452808460c2, 0xe6015cc32850d4f8, 0x5dd7f93a23d89123, 0xb6b717176a64848c, 0x20017d0cc727728b, 0x885be66a69b4a30b, 0x2509fe87d7212ca8, 0x515582307997fa22, 0x0f0411673406684c
+, 0xcd353cfca322325c, 0x6d289f6506c122e9, 0x6091c9b953b0e7b5, 0x04dde51ee9a8ef7b, 0x19806429fc85fb9f, 0x2706d61141f2840d, 0x97997d33ede0e241, 0x2cef924c4fa91416, 0x5d04d1c523619002, 0x1ab13f30acdf7d9d, 0x330975da48327cbb, 0x3cb62704d02dc9bf
+, 0x97995bdf5e263179, 0x05c4a26235d92d45, 0x99f4fb9f33c26c5c, 0x1f2bd5ce700c4c33, 0xe1383d7af59e3165, 0x50623df3cf41c59f, 0xe218178e82937b3c, 0x4512834fe7a3f3f4, 0x79d21593c60b7883, 0x5e7a28ce48e43175, 0xe8834f12fc42d8e4, 0x32c8cd72ba26995b
+, 0xd3736d4e7a23bfee, 0x7d201f3187c0f716, 0xc3550a0b414b0e35, 0x161d5f5768a63ab1, 0xde1eba9b49a6de88, 0x1afaf878afd706c4, 0xc7fa3b6730c92c5d, 0x5c91136733e4c029, 0x8cad980f4e3c9b60, 0x3ae5716467bda169, 0xe4d399bcc9ac76f3, 0x1c9f234156e44eb3
+, 0x14061a682729d00e, 0x4883487115da58bc, 0x62217bd38392bfc4, 0x3a27575c36210bd9, 0x409eb8eaec6a75a8, 0x4eee652388390df7, 0x09005822d9e2e77c, 0x41b594d6789a46e1, 0xd2a71a542cc200e5, 0x4105c872dabb6a90, 0xe28c941643d06404, 0x58401e54e3057ff8
+, 0xd6c4b51e62981365, 0x222575f7296fcd0b, 0xd7d236555bf16730, 0x47703c8ef96d2e88, 0xc4851de1c7482a6d, 0x675a1b77e24df97c, 0x2d50d71e41a3a80d, 0x6332d95d9fab7f99, 0x75c713463fc27d93, 0x15c50ac798c6f185, 0x30a8ae6faf4c21e8, 0x1bb8c39c9a52c21d
+, 0xca6b223effb81ef8, 0x708fafb79e24193e, 0x07d2db8c4140f65d, 0x17e0bc56551db9c7, 0x0f7d404f21476394, 0x63b2117183ef1bbb, 0x1cdfe5786815560d, 0x1015e4577e2aa999, 0xb35793cef620cf76, 0x2ef5c43169b9f723, 0xc6575b99bbd716cf, 0x3fcbbfeac7d46528
+, 0x35d25503129641a2, 0x5a78691e74b94efc, 0x9fd9425fdd9adf53, 0x01b2fd20000d907d, 0x3e5443811d918ec3, 0x23a39f5c824e566c, 0x2cfb08a16f87696c, 0x0ae5a193c7090d03, 0x7f64473e43020308, 0x7690c61dd92bee6e, 0xd89673c7ed36edaf, 0x686698dd85865ba7
+, 0x8835415bcc89765f, 0x081780a90f4c5ae4, 0xae9a66e615a82bff, 0x667e43a461ddf3fd, 0x687d861e77c7dac8, 0x06c8f4364845ca72, 0xdc54c773a2b4d1cd, 0x3bc560221f527764, 0x0e0a1a855f0d591a, 0x15b45fa51f112728, 0x87bade7a0c218e2e, 0x1c55af5e71fdbefa
+, 0x9e220dcef1d6d18d, 0x1cff36686e428c0a, 0xcb35bfe6d575b1c4, 0x43e0d4b6329f4fcd, 0x19ab66c4cacd7ca7, 0x6fd585458f6c212a, 0x1b5980153c469caa, 0x3976cff66920f67e, 0x5af567f0cde52bed, 0x34f7aa5ceef2cc98, 0xf8a23104ca60288d, 0x44f32bc296b08949
+, 0x4d5e2dae49e354f3, 0x206add3f250a0fcf, 0xbb0cf41da264e907, 0x587b6a48eafd4588, 0x4c981d53c7f2ca48, 0x45f5bbbb8baf64b8, 0x064d6abb79b9008b, 0x14708a70863b0b33, 0x0ee2ecea162fc3bc, 0x76f05c373d73fdb7, 0x9ff954b9e7ffd067, 0x1119e13b2af176fc
+, 0x07147be9dc2a1426, 0x65ca442b5855ebbb, 0x56d9039512a40dfa, 0x0cad8bf60aacb071, 0x7ee08b5823d5a662, 0x2000ffd2737f2a4e, 0x72f36e34773547f3, 0x71943d4f4af24415, 0xd2b8be9ea16e295f, 0x6511690150c6b3a1, 0xc2281c8f645275db, 0x62c505a632d9d549
+, 0x428b0ced5c84dda3, 0x2d71bd505acf67f0, 0x7406522ccc7274ec, 0x22435c2ca0f4fbbb, 0x21f5337174275ca9, 0x56244eda7e7f6b5e, 0xd6667276d4564301, 0x18ad000d1f7f7ceb, 0x6838bb4d57b3b3df, 0x4b3f75bbdc4405fe, 0xa44de5c141631e48, 0x48b7dbf2b300d760
+, 0x412a01ae7200022b, 0x33d59f9e642c00a8, 0xfa8472ebcaec4e44, 0x3bcf8ff2f4fc045e, 0xcd4195a716a8ca89, 0x53603bfb721f2d99, 0x66783be2ad810d3e, 0x28bd2698582410a4, 0x35a86e216b038caf, 0x0ab5255a7ee91ed6, 0x0eb69ebcfee84cec, 0x59614220e6c4714d
+, 0x52799c1d1a7c5710, 0x49fa004c2dd3a050, 0x0e2a533b01b57c75, 0x217cfc71c1a4d766, 0x7712781b7de4a3d9, 0x6976347f5c0e42f7, 0xe48f2b3da08f41b4, 0x2b4bd80451a9bdc9, 0x209402461b73a978, 0x406366cb8d29a2bd, 0x4d2fbd0eb6ca0a4f, 0x3d1a2d8a3a2e6cf6
+, 0x6253a71ff5ba0be5, 0x07a3615b21776d2c, 0xbc7e60e6d16258bc, 0x6220609e9696ea22, 0x2464d077576f68fe, 0x1acfb12c5500a347, 0xd7f44c8d8aa29af9, 0x726fc18dbabd6853, 0x458165be3080e640, 0x21189113294d4be4, 0x71681ae28b4e98b3, 0x279eee05fed17a62
+, 0x2672e23e91b77583, 0x5d61aad37a058208, 0x1e9c4045bd866d51, 0x2b1759b1277ff79c, 0x40ccea7a5e865bed, 0x374bebc7cf7f4b22, 0x125da8c57bc96afb, 0x65dbfdb832b4eff3, 0xca689395a71b9d6c, 0x33db829d1cc15724, 0xc3438ae17ee7f960, 0x00ebce1743413381
+, 0x5ba7d02612b304d9, 0x4da66667ae6be287, 0x931532164202b410, 0x746b128cb4468393, 0x03875ce6885a76bd, 0x6e90c703a325d2cc, 0x069dea3651c4abfa, 0x2624ce44137b944a, 0xfe97d700a042df93, 0x5ff5d19318c45be8, 0x4cb99c05c34fa837, 0x1029a1a39c33a2e2
+, 0xce85a2742978730f, 0x56cf2ed5ac391aa7, 0x8c81d72289418cbc, 0x0c84be2b44b6da6f, 0x306ba65d3d0f3861, 0x6e63e8964d552e26, 0xcf29bbcce509fbde, 0x59c9a96e3e4c0c04, 0xf9dae14724dfc658, 0x4b329eef97c50e37, 0x58cef42fc340c713, 0x7407bea31785c559
+, 0x3103c934b334256f, 0x586b7f6cdaf2b309, 0x55ba3b8879fe4c95, 0x222a3861d4944522, 0xa125d40edef06cad, 0x6a8d6aa373a4de26, 0x3563a18d4392bcd7, 0x22c434e81cb8e6bb, 0xf971fde396633fb9, 0x537c514607a53497, 0xf1b86d3534986db3, 0x0434e5e8cc8599c3
+, 0xd65a495c47375676, 0x3bbcbe0b6c4dd879, 0x3133e0fa523843a9, 0x08cfac0b875029dc, 0x253b95b8cb027975, 0x42cd8acb170fd744, 0x0486965b6d55ee12, 0x368ff531d70b6d3f, 0x5f789fa2a6955ea6, 0x7df0b4a1f23c40a7, 0xdf964830e820a309, 0x288391a8f3095b48
+, 0xdae3e9fe74e19d4f, 0x7d59b25135bb0783, 0xc0623193d2c6bd05, 0x24119a1320f08eb3, 0x4ca191ef387bcd2f, 0x1adc123db1e955d9, 0x4d00e6cbb5364f1e, 0x5465c585b5d4527e, 0x58863ee68eb74a40, 0x7b486e28c9a91b17, 0xf32b081fadf553b2, 0x707926ee8497bb09
+, 0xe27a13ce6b1c39ca, 0x627b58e2d2d31e4a, 0x5e5e0218a6c774fc, 0x0b627dc66048c96f, 0x07b4573632353bb0, 0x175989e0d3467c0e, 0x1d7e63c2cc29a312, 0x20f56b6361ab6e27, 0xc89091f1034846f5, 0x65f71950d7865241, 0xfb47c858bc1ea2b8, 0x120bd1be0d9db475
+, 0xdc41190f9b5f713e, 0x2411d5dd5561f245, 0x58f0655406a493cd, 0x265041bf3bd69d91, 0x34fcbdd33e505bbb, 0x327edda1dd99d2a8, 0xeb31b7962f5cdc89, 0x37a4543a0b301725, 0x4f95ec1ea755cff3, 0x6ef5ecd1b6633251, 0x3c88bdb80b9a87ff, 0x2751ed5b90fc268e
+, 0xdc1eff8a6781e15f, 0x708dd23b088ec8dc, 0x701a664eb9c094cc, 0x405a9e523342c8f1, 0x932a6faba3d00b53, 0x00a6a3990e881625, 0xaea930955c57030e, 0x61823cd99c8bb3a8, 0x88cf69a02c40e095, 0x52bdf20b3fa46eeb, 0x4d1c6e322e4cd9c7, 0x6638416471d343b4
+, 0xa3ef7e421bc32a1d, 0x405acd846d21628c, 0xdc2ff7cbc46f02bb, 0x23b0e17a1a106cc9, 0x9bbe3ca6a05782ec, 0x4dc54d9165c992a6, 0x1aacec412ca73fee, 0x7206ce7d3b60a830, 0x7c229109feb0a820, 0x6c37684f08c2dbdd, 0xb823f6bd920bf416, 0x50dc4d915b2486d0
+, 0xa07ca4f728e6c790, 0x027f097671001628, 0x08aae3dd724b2f0f, 0x30c052cfe30d4ed2, 0xcd8aaeee80ebb590, 0x5d8e7250b55a4c71, 0x98c05364f5224563, 0x2af98184536ea7f8, 0x0c0f83f43a52bf78, 0x552f414152e37d18, 0xaa80b3b6a50227fa, 0x5d6ad33e2b27a924
+, 0xae320f48c976c1f4, 0x399fd8ec489e88b5, 0xb721a04c7056c127, 0x639ccc31381c1d0f, 0x25aaa3e27245bea9, 0x1b8fb5eb8ef32b71, 0x5b25f758dabcdf41, 0x2075ba5186e40e24, 0xc85dca39a065d6cb, 0x05f36f3a0cca5738, 0xe55bc538a3d5171d, 0x5d4dde1a20e44176
+, 0x496fa817f03f6e95, 0x27ff9350bba7eebe, 0x2c5b174693a62d1a, 0x547718f7c3207217, 0x40ee5e824fa9b77a, 0x68c166de53236f94, 0x576bf55dbc35a71e, 0x44959dae2ed1fec2, 0x32208bb625fb9641, 0x61a6e75d382e10c1, 0x49ecb52546e879d1, 0x73316df30900cf14
+, 0x9baa6854c81a496c, 0x00eeb7ab168981dc, 0x8231cf818e5b8993, 0x5c6c0a33aa571f46, 0x54d049504799ebac, 0x7dfd7181c0eb64d0, 0x216a4547b681f830, 0x24f2b80995d7fa1b, 0x95177566793025b7, 0x60c9557b2c89d4eb, 0x359a54868c379ed7, 0x7ba51372e24fadd9
+, 0xca1dd8088bd990ad, 0x717f4d3bd3db33d8, 0xf87bc2c30af3cff5, 0x083ea134ccf200aa, 0x5cf1811e107f3eb1, 0x7c51e67983a070a9, 0x686d968c87f260a8, 0x7b8c04fa1a3eab79, 0x627ed60a59f5a8c3, 0x3c1fbc9141ddb76c, 0x2f2303547700f5ee, 0x2b26c3ae313c77b0
+, 0x0dad16ad8d3f43fc, 0x0a9023c1b761ab89, 0xe84e2e0cd8a34ebc, 0x0d4f48e6f117f4c0, 0xc64a4885a256104c, 0x04d29188dff0cddc, 0xdbc05a499583a71d, 0x233a5f95b30a48dc, 0xad82ca815bafa24c, 0x035fe6365defddf2, 0x74b1770260837845, 0x2af6325f197e0626
+, 0xda396b08b87a495c, 0x0208c79fd9f82d1c, 0xa6fce46914cf68a1, 0x5e31b3f5de46fd68, 0x2d219959b2ec4484, 0x716159fd3993f714, 0xc6b37f8afed29f39, 0x02752f2a5a5e5f19, 0xfe78406fe2c9c6eb, 0x1fda544ef1020e38, 0x618e9fdb04f6b681, 0x0f1976001726305d
+, 0xb996c47819eaeeea, 0x0f0f390681cb13cb, 0x8be20a115bdc04bd, 0x6744907a6ce5ef70, 0xaa3bfd9723cc2d00, 0x505cca43d88b3a0e, 0x096497c9c7c9373e, 0x5b93687a991819b1, 0x5b006a0a0f45e449, 0x0d4b4fa623728e9a, 0x20204ed5d4ce9c49, 0x2cbdbb24b1e09e2d
+, 0xd09519c8b2e152df, 0x37eda41d2a7f373b, 0xba2c066f4e234a72, 0x2f0a50bf5b497b14, 0x8ff87844d469eae3, 0x27401d6cf17796ee, 0xc1edf8f44df433af, 0x403fc64cfa9308f5, 0x23dac8ade493355b, 0x2aca54b687dd06e4, 0x3f2fdf1fb32bfbc0, 0x5139c4ab654f1760
+, 0x09b3942203f208af, 0x7a1848d15052ffc2, 0xe767755c2347b9a6, 0x122ea3e33fabf6bd, 0xd28053af4a8f75b1, 0x39e778c056e809c1, 0x54f03692f009157a, 0x003e0212407f968a, 0xa1d80ceb15d2b56d, 0x582466266e780455, 0x1e8f3ab568317ded, 0x712a14c711c7f80f
+, 0x0201a9640232f041, 0x287b532c7e62dcf8, 0xc386aad1b26d4322, 0x758403b5d4779cf7, 0xdc9e7b43a8103db7, 0x4bb47ec1273b1bae, 0x3293226d5a47cf7c, 0x5b87ec094c87ecf2, 0xcde8bd8e808d18f0, 0x620284fdf3d01506, 0xcc98793f7472c237, 0x62fb7265970c7d64
+, 0x9093ef13e7b34244, 0x4799c103aef24635, 0x4ff533b0a1ccc800, 0x32cb3fd370bb670d, 0xbee27cac6bcdee65, 0x5cba06837acc25b8, 0xea9b5a8ae50e2411, 0x3edd65526b27fb85, 0xdaccb212e60031fb, 0x4795ad3c67b54c60, 0x2e65b8541fe399c1, 0x14449a98286054b6
+, 0x53e4222836022adf, 0x37c252edc5698548, 0x577666c864dcfbd1, 0x3c1f461acdedeed6, 0xfa7a66691d2c470c, 0x454ef9b9f95f57f8, 0x8e93d571ab6a5f42, 0x7382404a9c9f3d01, 0x2801058dd5140837, 0x116d7277611d2938, 0x3bb7e2f3ebedb405, 0x11a6825a65815c74
+, 0x1b846cf1b0b59eaa, 0x5412fa911d523f70, 0xedbf1674fcfa4095, 0x6e20b76100b4df69, 0x58e83428bfedc13c, 0x377fb0b3e388728a, 0x986728450ac1caf7, 0x425a81cd0ad03623, 0x6f5d046830d598f2, 0x133361a43714045e, 0x1abad5cdb5b37ab2, 0x7ef1ea3f75ab655f
+, 0x0a57fc3f0c0b56ce, 0x4036b4d8dc581e97, 0x5963ee8fed70ec7b, 0x5deea5224d0b2167, 0xacaa6e21991fc3eb, 0x234c292ac7f2aaae, 0x1dac02e1eed5ed14, 0x02fe59c89e307c3f, 0xb3183da8947041b7, 0x089cb48b61e62deb, 0x658a0c748276738f, 0x5d8cfc46abb1131c
+, 0xadb8b4e27f664b83, 0x5615911db717e671, 0xe016f9db60598c12, 0x6f3f00b3309efe54, 0xe3ed3a6ecaf0cc75, 0x5ed8aab9aaa29b77, 0x052246f21ead1398, 0x67c274932b8c781e, 0x59955bce0020f3ba, 0x23901c70fe54c1d2, 0x015b21eaee188f9d, 0x28e68487b86e3e5c
+, 0x0cc7bc7bdfcaf5ac, 0x361d18e83f6aac8d, 0xe0c3691629bc21af, 0x3719fcadb58477bb, 0xb2be5fe660742c17, 0x5d60170e2bc36589, 0x925c2dc5ca093c93, 0x3983074f5f6446a1, 0x38648c78b1d8a688, 0x4fa3462e89c3094d, 0x99a81d1bf333c506, 0x616d2de351ac8cb3
+, 0xb72b734067e3ef92, 0x217999b9e5868eab, 0x15dbf21f538861d5, 0x2fc64be307bb6936, 0xc524afe581f58fa7, 0x4b55efab0c2846fc, 0xcf0e0ac134fa0c01, 0x47eb6b27a5f0399b, 0xe709195741d88902, 0x39ca901ee3adb3a0, 0x57d744c9e31d5c71, 0x362c1b0c4c96d750
+, 0x55dd915992cbaa96, 0x3c06bf51cf3c1bb9, 0x87302dc29e2a5438, 0x38274c3bd845597d, 0x4753fe7a75864ba9, 0x1c6d7e20e41b2b71, 0xc79f0d8f77521e97, 0x0b0d1f16468afa5d, 0xf6a150f9cbb1b3b0, 0x586f4a113a932687, 0x04ace4632478a5a3, 0x6e5686efb2776e5d
+, 0xcb96bfbf76389877, 0x2084923ac9d6d825, 0x8be38bc43e8d42f9, 0x05842d7ec4d84f08, 0xb108a1802634f5e3, 0x7e1eb2752e3ef8ff, 0x91d70ef033a756b3, 0x35b7161a9d50a8e7, 0x4d47e148343d226c, 0x72a46c4096c22032, 0x90f78c3e6f531ad9, 0x7986f3f12c6a308d
+, 0xcce9a3213ec9d197, 0x270a67cd20d81066, 0x2c0b361fb45b0194, 0x1032c44c23bd5b58, 0x3bb0ed3164748d52, 0x330cf63d5045d2fd, 0x890272d5d24cd433, 0x6dda9b671e6bcdcd, 0xcba57f7790bdde0f, 0x770e7bb8f77fb13b, 0x6f1bafd31d1fe156, 0x4e892203f18bc681
+, 0x9f4a1d1a2fbea269, 0x69ce1bd29a024a9a, 0x324d74741bdfc644, 0x5fca7febe1f400f9, 0x5a66c6eb3a418787, 0x075e5348ec143045, 0xd32cbee54b59aa8a, 0x175f4f141fc7abd2, 0x62f0321bf121ab46, 0x40f0b3c010d6bb3c, 0xe817429a101f2950, 0x47bd605b7f93c3d1
+, 0x7906c71c3e6049f4, 0x47adba1184fd5bb9, 0xa3f7071d704fd4a5, 0x77e9b3d3c5624aac, 0x9b508e3d933aab98, 0x2d0d50008003b94a, 0x86b9c7788f25ad9b, 0x5c4f6f899eeb9ef5, 0x539b45ff77175b5c, 0x0fb4792ed10ded03, 0xe4aa0558a9225267, 0x239c40a9010e5145
+, 0x2665502c7e5f0986, 0x73639ea29574b8b9, 0xfeee038946903b85, 0x6eadc3e04e62840c, 0x08989b9bbf796847, 0x75edd94d73d135cd, 0x13d9ad1bbbd96d2c, 0x676f3a8aabf86edb, 0x4b076c0234c5e225, 0x0811cb64513da756, 0x7d549f5a6983ca27, 0x41030d91ac008bd8
+, 0x7e0facc18e3d6171, 0x26da4541611376c3, 0x806554ca1f193504, 0x5bbb51195a22987c, 0x25343b25eaa16977, 0x123b0c8db977a8a3, 0xe7757e1935d9f668, 0x3adcf0adf0988b5b, 0x78eb27d1b6a36fc8, 0x2aff9cf85c66eda9, 0xfa9db4699008340f, 0x06129c3c9212b4dc
+, 0xa6f58e52e1e24336, 0x0b2a6d88082d6441, 0x754280d80d6590e4, 0x7c6de6e180f25d6c, 0x1887df111af05fe7, 0x7e8b47ef15a4c998, 0x5ae398af9be2f6c1, 0x6c057cd912dddc0a, 0x8a79d77d1e98b994, 0x3ba0ee6345603cf3, 0xc9aea72cc53dbf81, 0x2c9fead12700b450
+, 0x736557c46483a9f2, 0x4a050f5e68e23a61, 0xa651e6647d9c9955, 0x665d786b6421d23d, 0x3017cd15e798dc0f, 0x3a27913feae67d89, 0xc8fa2ac6881254f9, 0x2e6258a04bde5f1e, 0x72ef25e30b401e50, 0x4cde400847db0605, 0x150585ff5b0b0cab, 0x32f2ecba299e5ab9
+, 0x80d8d092035bde44, 0x13d0ec8bae229cee, 0x922572256118872b, 0x215d9ce6ce8abc14, 0x59ece710c967790c, 0x23bf06db7c9f4c13, 0xfd693be7d1b15229, 0x03a89a7cb77df7d4, 0xbb43eba656b2b59c, 0x0918e975636a2b53, 0x4e6b115521d34360, 0x02d47fed706dc819
+, 0x162e514294797b18, 0x422ff7db20e77047, 0xda62331b1e0f8927, 0x3ad6b7c65f49438c, 0x9468ee3ddc789c08, 0x3955522f199212bc, 0xc0705c7f74f6be1d, 0x0ae146baf0391a13, 0x1a497e5d1e43e7bb, 0x176ad32cf850be65, 0xa1c2cc1775990753, 0x232c8b7bda18a1ec
+, 0xf38e3ffca7f1a163, 0x01be2dabf82807ca, 0x10d95b70cf4b982f, 0x1547bc43dccbcdfb, 0x8836db1bd0486a97, 0x52aa6b157d4eb90e, 0x5e3879016bf61843, 0x4cf023f52ae53661, 0x42f742b073351a15, 0x100615f61e15d7b0, 0x7d493483a999ec41, 0x6c48c91cc4050171
+, 0x837d20d48a4cc13a, 0x5ca6137fe60c3db2, 0xe16fdf56a25aa73b, 0x0a9ae241fa6c374b, 0x6d0fd1219ab1b3a3, 0x375c20ba632ae841, 0x3707b32349174b32, 0x1ba8eab523849c9f, 0x3df076d19b04ba75, 0x2915c11499b48be8, 0xa890e417d8fcd874, 0x32728edfd91b37fd
+, 0x84ecbafd8fcd1690, 0x53a2d6be5bfbb718, 0xcb2220ef918aa8c3, 0x6edd78d29a13af25, 0xde3ea7f31b8eda54, 0x6bc8c8e2cbf12bf0, 0x56ad89d3be9b768e, 0x7a418c94fee38640, 0x0d5aaade755eac8b, 0x55f75ec9b73cd146, 0xb33d875befe47379, 0x67f20c115a85224c
+, 0x89172607e58873e0, 0x6e8e5ca7a9c20815, 0xf56554a4ebbbaad2, 0x7438e44f0a5f882f, 0xe93cbefbaa6373b2, 0x206d5241846b1f72, 0xb84101dd7d1a5335, 0x712e82665dcae12c, 0x687227910be774b1, 0x5e688911555bed34, 0x1a7c834354e034da, 0x3b97df48c1ae3e63
+, 0x10872e42c6803844, 0x3f88a3ba2f49aede, 0x2fa086b5c84992f2, 0x41a7e9b03398400e, 0xc636f71098a67d15, 0x09498f85bdff6400, 0x616c1e5a48620a8e, 0x38d1e6fe224de29c, 0xbbce52119dc27193, 0x0ebd62805b69f8a0, 0x22ba095b3a154ec6, 0x28d939b1e145fa52
+, 0xe344b68ba5329ce4, 0x526144986fec3f99, 0xfe25ba46cc50c535, 0x2218121b68057a43, 0xd4a943aec99cf8bb, 0x15a9f5e989a41997, 0x5f3b57a7f61e4b68, 0x290b321bd0f0b521, 0x36b1c1f2840bda51, 0x4327319b1130994d, 0x9580bf6bdb5e253e, 0x310ef66bc239432e
+, 0x42ff7d2aaf629e09, 0x4a77b9d425db0b47, 0x74a7db638fe31f72, 0x21613d5deea28e54, 0xe4d7d0b2d4a5aa53, 0x0019aa4f5f5512db, 0xc383fcfb75dbbd36, 0x6a627ddc0ecd8258, 0x4a03d6af66cb4566, 0x1f97524d9750888a, 0xe2b70a2c85de5559, 0x543c57fe6c1109c7
+, 0x4808b4e260014138, 0x1a03e8ca1f1ebe4e, 0x75dc9857fe101603, 0x11eda3c06e2fa19f, 0x61b2215c0ea4da69, 0x4f41631d877feec1, 0x74277e94ee9c8b20, 0x60655ef692484233, 0x51c3d85e18747461, 0x5945ea660e698a01, 0x5318840acaf868f0, 0x3f39219e3c354657
+, 0x436a4c4d643e0237, 0x53e52a797cc03cfb, 0xf35a35ca1be458e2, 0x5010c1f79b7e3194, 0xb97629ee126627d4, 0x18089c627d085c94, 0xae9d4c4ba4e8f290, 0x5e6b16cab74f55ab, 0xc041632a262ade53, 0x40b3a69ba8b11951, 0xff4463052347194c, 0x0e638d60dd19478b
+, 0x2660873777ec85c7, 0x793cad593a38aae5, 0xb6612806f88e217f, 0x1e1932bad6e83396, 0xf503d6dd20b110a9, 0x3c1e54a476b42bdd, 0xdbf30451cea391df, 0x30c93d02c9c00353, 0x43a2e01cdd28f874, 0x159b921065c43175, 0x2017b1360ff05778, 0x1502e7f54cf1ee78
+, 0x967ab8bddd655c36, 0x76c0dfe27ba5e9b3, 0x62995ef25268841b, 0x0f9df804b31be2d0, 0xac010a770c763b7c, 0x29ebda39efb1fe5b, 0xf5ec151974b3bdf7, 0x5731950266ddc3f2, 0x77e8ad4bbd33302f, 0x152aa90aed323801, 0xedd8e0f1bc491a31, 0x7d0d98d5eb742fd4
+, 0x4b1bf31653b74f9c, 0x5ad2cd0980ec9d58, 0xa728f39580c3317c, 0x274b580cd09668cf, 0x78e4dc1e6a557a75, 0x6afc84c54828a3ef, 0xbce27d211f724982, 0x6c971d1b71bfb381, 0xd46df5b8ae2c7560, 0x4210b3ef3a9ae436, 0x1aa13403cf30edc7, 0x45946b2870ecde80
+, 0xa9cf8634bc8970ad, 0x529b8ee89a1831d1, 0xd082b7261fe8d273, 0x3af402f04f35685f, 0xa174b07e6cc2841a, 0x50f8aee7ec3094d9, 0x580166b4e25107bf, 0x26e194b2e96d6081, 0x836465886d757284, 0x6d26b371b1bc745f, 0x7b75cfa07444e701, 0x38135148d17e4458
+, 0xeced9d240045f5f3, 0x43aa769c6ae5bc95, 0xcfadb2beb18ea6ab, 0x6fbc8958dda2ed87, 0xe30a3ab4091dd1d2, 0x783fa2fb0b339c01, 0x03c32d6ce4c3903b, 0x6720d355c7530280, 0x441d993c66ac29ad, 0x08768707de70541a, 0x2419bb320a0804a5, 0x49bd411f1440023b
+, 0x08bbcc2c0008f559, 0x336a7756bb104549, 0x26d6ec402dc2860c, 0x78e09604ef46d475, 0x6fbb69add46552c5, 0x175982b800fe5d60, 0x4c7b21fc72adb3e0, 0x67b522ab4a83a373, 0x7fe2d79eaf33aba1, 0x7a31fa76428861f2, 0x42f089901adefb48, 0x39a80baae40216e5
+, 0xab80525ebbce3265, 0x18a9f0a91ce41f09, 0x95428ea0f57139ee, 0x7a15a2f7530363c0, 0x064404e0f52c3fb3, 0x0e9603a83e7fb812, 0x7e534ca54e752746, 0x4e9d39e819bd6d1c, 0x2bb118fcba76ff2d, 0x369176085b999e2a, 0xcbd33c20702335ef, 0x133499ca320cac68
+, 0x8c0a0b1c54706a6d, 0x3b8281a4148f85b3, 0x1646460b33875020, 0x073d9f5368376d27, 0x6b761620dcaeac91, 0x594d617fcbe71394, 0xdabb9f21c2cac934, 0x5bf1c135d4565602, 0x14318745829744c7, 0x25a285bba3db98f2, 0x83910554e79bed3c, 0x55ce440ec1590330
+, 0x7f2fe56ba2cdea22, 0x355b918c718ea541, 0xac02fd1b1614a7ce, 0x3d7d8059f2eec793, 0x3303b56ef3b586ae, 0x31b28c5e6aca8fe5, 0x47c894dece9cddbc, 0x6ffd9b5d0a920ff0, 0xc3d3cc2aaa185d7c, 0x5dccd27c49f4fff5, 0x3a15bd201d119026, 0x00e21d571f8b730b
+, 0x30a38bba82b579e8, 0x000715ff891ecda7, 0x51e16f35b467b682, 0x00572241977042a8, 0x4a4599f94130f728, 0x2fc5a39c06eb0405, 0x5f32cbd002b80d56, 0x2ae6b7d5e892d775, 0x21021f70cf26443b, 0x06b669f17a01600a, 0x68fc304147357589, 0x6d0c159f1eec166c
+, 0xe5f11a9ab82a20c8, 0x67f142747e28f0b3, 0x84d07747a2fbaf4a, 0x29f9cba857bf37f0, 0x5b79cb111ad3e9d8, 0x09061d290a308c69, 0xf97b2533d08b75ad, 0x246c3ec22c45e07a, 0x53db1dc6c13317b5, 0x2479f3a8e22ad6d5, 0x44beabe5594f1de0, 0x297a983242e46500
+, 0xaaf94b004a82d259, 0x445d7280aef996c7, 0x50aafbf9f720ca6d, 0x1241b2afda71ddc5, 0x4257a3b6948b7768, 0x18b477f33d980702, 0x5d8d7c1700c1c580, 0x57d02656faddd741, 0xc585a7191ac6517e, 0x72326422f43d3894, 0xfcbf84c6ac221117, 0x0b7f59f6ba588b27
+, 0x824b0c613575d283, 0x79aa3f2d4e64e282, 0x7a09017c2b1a0a9e, 0x2a564bab11273802, 0x67bff3dca86b5eec, 0x591313757cb432d4, 0x8d32826c91a91870, 0x71fc9c2a52765f45, 0x93f2d5e9bd985679, 0x37164ac35653c865, 0xb40b2d37d1ad9714, 0x4bbd34096ed64687
+, 0x1b3fe9f06883c6a4, 0x5a5f7d80710b800f, 0xa67e3174cfccd727, 0x797c7e07c3556911, 0x9c72c5ce40466a06, 0x5cfc1a63b0d611ae, 0x0090e1dbdc6c3254, 0x4ee3ba0792e1033a, 0xcefec7989e0f5f85, 0x4dab1dd1ac6b1909, 0x3fc7831ee238fff1, 0x50654741b7afb45a
+, 0x42135092e6bc7b0e, 0x42a52f3aed7e7016, 0x58492bcdbc85093e, 0x745dccc5db28a81c, 0xcfedf111b0b60895, 0x3e8a44367bfb5a70, 0x6957e4fcbebdb0cc, 0x63a91d0629edde2f, 0xff8070d60c070f20, 0x61292d581951184a, 0x93fe5c76e37260c8, 0x5bc56f6a630a319d
+, 0xc4f26bd86aa29eaa, 0x068b49acf33c726c, 0xf23f8f66bab1c315, 0x015235c1c6d3c411, 0x922b4c3b6ba6750f, 0x3ab825146f8e04bf, 0xf2a203bb980d6feb, 0x3a3f15786e36c1ad, 0x468849176b90f80e, 0x2821b9695e46a2dd, 0x3ab4ffba148cf938, 0x138c51abde37e593
+, 0x45f1d1c94dd2031f, 0x4f96ff536555bb77, 0x016e3bf58d213508, 0x5d011890dc6bead4, 0x58a20035a9a6eef5, 0x621ac30cc1243fa5, 0x83afe11f0d4cb11a, 0x28e8c2abb541e3f4, 0xc4e947e09e17f01f, 0x183ef06999be454f, 0xeabbf565df559ac1, 0x25a3830bc48af35c
+, 0xa22da4cfe4bae235, 0x3077ecbcb5a9eb49, 0xe85f0921ae00b4bf, 0x17b8e4153a90e86e, 0x72945ab5f9e68dfe, 0x0d8711f93b6a582d, 0xe14e7ae5ef0dd6a4, 0x386adfe77aa23357, 0x0c2bd7f5e89542cd, 0x12c4c93f5e4e6bdb, 0x5cbb3b7043859235, 0x27f75c9cccf7dbe9
+, 0x36b21453fa8091aa, 0x138c7898919131e0, 0x5c3e8c6efbd8c722, 0x29eaaa38c76c17f2, 0xe48467311a8ca166, 0x26e488a38284f5e5, 0x4da3a0823ee2ab1b, 0x08f5d085ad358925, 0x5d808647da1ac854, 0x06b57c5e4e9f3b67, 0xb4e765e68d9dbe7a, 0x00d425e181402010
+, 0x5400bf377b2bd3d1, 0x7451ab32d8c382a3, 0x150b51419f847031, 0x2cfbfaa10ea5d795, 0xd1eeb1dd9c79004e, 0x6bc897c9b4993c8b, 0x538d16415dbeedba, 0x2a98a3e9eab4d5a6, 0xbd066e100c9e6c61, 0x54fd219e845e3c63, 0x27387e1ae6df54f2, 0x1a1ccb99b849ad1d
+, 0x6b21ba97f5cad767, 0x57f8154deadac7d3, 0x617d071e5efb8fe6, 0x1609d9531f3b8fc7, 0x3976c9985e02c13d, 0x15f2df2ef5cda283, 0xbd939cd0c81840fb, 0x6711b4ff7130ee82, 0x35405fab9590639b, 0x69b8ed4cdef7e214, 0xc61f0293e8677cea, 0x42e4c1be10c521f1
+, 0xb0b677453f3fd858, 0x1d9cbc55a0630d37, 0x84aa5967c4755709, 0x78c0cec53b134431, 0x976df925706209cb, 0x4285b1a275beece1, 0x649e74603ded6002, 0x350142bfce609ea4, 0x3e30914c62043f01, 0x5f82da94bd4973cc, 0x9f56cbded7de5bbb, 0x76a6d78c5e611600
+, 0xc3fc0ab43c5e39c7, 0x15d52e30bc01d606, 0xd4d610456e443352, 0x2d846bf61139dddb, 0xc68e25d588b78b60, 0x64fcccc72084f515, 0xe3fc177199d2dbf0, 0x671e30a4b4cd2940, 0xac628b943cbccca3, 0x6bc3d9f835dd04bc, 0xc9b838764dc3273b, 0x50d7b8bb72d7b3e9
+, 0x6ea3d64291ba803b, 0x2bfc4c00cdb75b8b, 0xfd97c0a9c09df0d9, 0x6288438aa19b7372, 0xeac448378ea935e3, 0x1a9b1db5f9f0db36, 0xfa00cb9ba3e94092, 0x2a8de5afbcc6cec5, 0x6fb4176ef6a91244, 0x75cc6c0fa3458a14, 0x21215eec6614107e, 0x1043cd124cf521e5
+, 0x60557352af185073, 0x5295f203837c5738, 0xee3e33cc677cea8c, 0x371e7168397112b6, 0x654605d94ec353c7, 0x0fa7ff9099232c0c, 0x6dc2909071b7c1ef, 0x3cebbb5c52cec6fe, 0x6108fbb2289d416e, 0x466629ce573d4bd3, 0xf1e77c63ff844116, 0x428f8d67e775746f
+, 0x9e93e1ecd30f71d2, 0x460f02735f03cd8e, 0x027db47104bb7c92, 0x5d5bba65b775fd6b, 0x406a5da22e2482b3, 0x5be9b4700080d4f0, 0x06fef5da679d70ee, 0x120cf0e2518d4b92, 0xa0793163e53259cc, 0x0c9eed6990275a5d, 0x59a8d7b03bdf1511, 0x5705d985595ca363
+, 0x115994a5264bf528, 0x1d5b24c707a9870b, 0xb188422fdf70dfd0, 0x7252172c0159672a, 0xc569520f82a39486, 0x0f14524815a479ba, 0x033f1cfd93c49e07, 0x4c077951fa6cc7df, 0x073adac3cc413a9f, 0x74df06d7a2cf9f78, 0x3519b385eaeb58b3, 0x4ca19656e3624bfb
+, 0x49f7588ad60eee10, 0x75ea31924bebfced, 0x528dd1ae35b1e7b8, 0x265409d2eec32b79, 0x3c108e5f7eac1a06, 0x69b610c22f84602f, 0xfc3c4d3f4909e189, 0x59669c17d2206603, 0xb295d7765d937c9b, 0x46abc709840faf7d, 0x693dc75893d9c256, 0x21cab7b1bfcd68eb
+, 0x0f853e4f183fc63e, 0x0d377c00c645741c, 0x35bdfda0f56771d3, 0x42a875c1e114db54, 0x19ec390adfa30e0a, 0x604c8dbe8bd931ed, 0x8240b708459793ab, 0x4730986ce1ad015f, 0xd0b9be8e645f2a71, 0x1002ee859bf684c9, 0xe544a2618267645b, 0x50a87fa6df3473a4
+, 0xe5209563f838a4ba, 0x6dd72b25fb81bf07, 0xebfdb09823e51201, 0x4874bebd0e4a5898, 0xd441064b24222b6d, 0x6d6ed14ff54f7ebc, 0xc903e11cc1d489d6, 0x6546ae5e91cbf278, 0xe74b1a5a52db1ac0, 0x7a156ec7e2490ac1, 0x45bb53282102788b, 0x47ecea781b73c484
+, 0x945df8b25d5f69be, 0x6bd432cfa555927f, 0x1c6a686c2af14644, 0x586797ad4f0f9155, 0xd368a347b9568e75, 0x541b493e04605c27, 0x1e8a3adfbcdc7352, 0x01425e48583eaa16, 0x9f228d5f65b256c7, 0x48faeef0af02b810, 0xb487d6e5f8a1b14d, 0x242a580940cc91cc
+, 0xa2f21e4a28bfa314, 0x068ce3046cf34fdc, 0x8f6d61cb7b236786, 0x511bcf9b1af4a62a, 0x34565a7760559b29, 0x51e7d22f2547eebe, 0x42e031874c72f728, 0x5051aad700a7a0ef, 0x8e4f964af6568421, 0x767e271ea4990180, 0x59f169cbf0935de9, 0x787a9a426d22c78a
+, 0x4002d3288295526d, 0x729bb676ee17eec9, 0x7e68b15171ebff5e, 0x7b0bbefb7e039e62, 0x035ee2798b33b6ae, 0x67eea284f15d2e68, 0xe95686a3937166bf, 0x13cf437a7898cb3e, 0x391e2d99b4438e3f, 0x19e08b921480b1cd, 0xe8576b83bcbd8384, 0x1522c4672ffc1c4b
+, 0xc55eb75994bff495, 0x2fddd0204ec19ff7, 0xfdd2d128cee4ee5f, 0x4f3f1cdafced51ba, 0x522f8048300100e2, 0x7edd89a8d661e012, 0xe922aae095e0e347, 0x32e0663420aeff05, 0x3ed0d6d6f2afd28a, 0x02ff76f62c1d7f89, 0x74a25f34a8966d7b, 0x50b306697982c141
+, 0x9ddf8528e8ac2111, 0x111416b525a0fabd, 0xcd4d106be1359512, 0x2b3c97b7a0e9753a, 0x6dbe87b6e795ca65, 0x22a5db31365b74ce, 0x6e204a94f87123a5, 0x13c6c7172fb3d113, 0xb9f773bc7744f58c, 0x7e939efd5e9ad86a, 0xd489ca0934ac7969, 0x15f803d47b5cbd0b
+, 0x86cf6c4ea9812972, 0x32bd1291c1a637f0, 0xd5f34bed1183a324, 0x1367f493269fcadc, 0xdf3e6f59970901e0, 0x6c9064d9dfdc0403, 0x01255e346ff8d56e, 0x29d73e97404cfd00, 0xaea7a03351339e97, 0x4659ccd18ca08ac7, 0x76a7d636d4258732, 0x37435cd98b789741
+, 0x9ae78239f087da4e, 0x2302a2358633981c, 0x5bce3dbd48dc23b3, 0x4e8970d1cd3817ca, 0x73e8168599a46964, 0x48209cae4577f093, 0xf3ca994db3a777fa, 0x7fa6eeb9125d5c60, 0x04349f02e1f9fa52, 0x1783edb1f3e710be, 0x1f5f440748970670, 0x57bfb80af48fd4ce
+, 0xb42b5c5248a8fa4f, 0x5303af8966bf8afc, 0x0b0ef1c4b27b8e03, 0x2a474787148899f4, 0x244443498bd6a882, 0x3a1c7b745f4912de, 0x413e0684eb5d914d, 0x049c029684453db9, 0x419abfb3c90f62b9, 0x015d4c1239e2eea1, 0x2912247a4fdb6eca, 0x3579477d07c02085
+, 0xa9c23d6acfa43e5f, 0x77f3f6fe8acf1c26, 0xb4e8da1c61f83bd9, 0x590fcb5e33928ad8, 0x600932721e1cbfcc, 0x1add36a9eb25aefc, 0xbca72593a7232301, 0x176d399e9a8d57e7, 0x20a9609288ed8771, 0x4223ff8e35378cf1, 0x23dd32f0e3be2931, 0x74a8938994d016a1
+, 0xb266e1efb46bb662, 0x5f98d7a03b61e734, 0x3363c3f7813d4f8a, 0x1917ac51c8d0c135, 0x0f27d33a66097c10, 0x6f6f146cf792f0f2, 0xcc49b5f39fb128b5, 0x06156642d7852c58, 0xfeca124909e1925d, 0x18aeac646b507b1b, 0x09fedc31db7fbbf3, 0x6f5d2b7a63d7a491
+, 0x4bb9e1248be221d2, 0x275aff7318d364a7, 0x2e3e231ccc889773, 0x0e43fe574f19cfcb, 0xeaf1caaffa9f1c72, 0x406bd1ea9696ec6a, 0xbd1841016d3cb59a, 0x78223aa0494d59ac, 0x08d5ab9555bdf86f, 0x593804920cc0169e, 0x176450c91053481d, 0x7a337dad69b142c7
+, 0x87a5b3d1d58810d1, 0x0f83a98becc32236, 0xb5c17795db1f1c32, 0x47426a5f69f48e4f, 0x556170ba981038a4, 0x21ac3327ad5defea, 0xcfd8802dd4ecf922, 0x2545564964b22f3f, 0x7e9c04c94b73abac, 0x09c5b6de85b291df, 0x25587a81a15f855c, 0x6aeca7459b0618f9
+, 0x37683e183e44295b, 0x6f5ddf00a80aee75, 0xefd42ce1a7d956b5, 0x57822ccc8afd3a54, 0xe7dd09d58abc0b6b, 0x635806f6cebc0967, 0xdc45afc801deebf5, 0x148d79d44f3e316e, 0xf26d36f2992ba1a0, 0x4c63d6e088b4f85a, 0xae77dc7d42ae37be, 0x233455294654ee45
+, 0x4bb6acaf82f29083, 0x421eb4d8e36cb84c, 0xa94c2c4a62254459, 0x4ca60a7136f79778, 0x1e57b12194d35481, 0x0b24fcc7bc2692ca, 0x642d46208a1e3246, 0x6e8274c354e5bd0e, 0x8026464a8e513472, 0x1681f70463a56e8f, 0xeec9458e8fb87023, 0x421e7935da52908c
+, 0x354efb9c8e5b5b09, 0x5aef4f301e835d49, 0x84b809529666ec3b, 0x7c4c9de430fddef9, 0x2489cfdcceb8b596, 0x57b341de3540e3a9, 0xb498f2743c1593b6, 0x74b426f0cb723293, 0x73dfff717d7eecc6, 0x79fab7b344f3e13e, 0x3571054200b3320a, 0x13659db8a4801d9f
+, 0xbcbb59c5abbe62d3, 0x65e4e6dee57af0f8, 0x88c4e0b0583c568e, 0x205d6a5bfaae0c2a, 0xa19140738c687d16, 0x3ebd84a7991293fb, 0xc43e7efab2d50bd2, 0x78485b277cf0643a, 0x8acdbf162e3cb523, 0x405ea871cc5fa6b6, 0x9d0b7414a766ad94, 0x7e144a6055c5716c
+, 0x90e04a7e5d9267d1, 0x6ac6fdb4135f5935, 0xc1b052e405ff2886, 0x1f4e8e4b66c2c1d4, 0xe2b599f8b24ce802, 0x4cab4fb4b18f6aef, 0xfe699eb067cb4173, 0x77a66ec08fa1ee8d, 0x8734a3ed86fb2e86, 0x252f82ba1a2d5e8c, 0xbdf9d6a5c617f757, 0x47597462e172fe4c
+, 0x94964a8c5f2809b4, 0x1003ebaf6a7f197b, 0x943007ec94a36276, 0x7eec23b1b0169de4, 0x11ab7fd071faa89f, 0x758572600b770990, 0x8cc3eac1263b7d05, 0x7d1e2fbb30b1408e, 0xd423e33d3946310b, 0x5b697cd93d754c88, 0x20eafb1dc39a6e6c, 0x522c9a4de7dc2dc0
+, 0xb40fe1bbd99c5d2a, 0x54564c8081b4938f, 0xd1c0401e05a557a3, 0x0be0360e0e5126e3, 0xdcb602612e82f29b, 0x49d50ca3409a5c85, 0xdbdb84362655233d, 0x01d07dbda14f6d10, 0x0f4202f8d72cc593, 0x18a6debb0888fe36, 0x6efa898a6f198d47, 0x50ce46c47f27b4a3
+, 0xbc60ca597aed37c1, 0x5f99ee6aacf5738a, 0x9efbc09be3cde494, 0x0d284573322b3433, 0x9802ea71121e31b6, 0x57e3f5c48c640c26, 0x058a86a75d4ffca0, 0x7b5060d7e6dac2a5, 0x697781ae9111cc27, 0x2f0f7fdb040b0833, 0xb8f55c793507e7d2, 0x7ae25220ea2cdd80
+, 0xf0fbd888e22d12e1, 0x4fb6129b8edd3170, 0xdd88bf3309d9fd87, 0x243606063088720c, 0x26ab9bf0d16b33d4, 0x3497c2a7d1c5967b, 0x1922c98a1ed45a46, 0x5e66da6f5ce58704, 0xd5d3315c810fef03, 0x610c9ca78052a9e2, 0x912330b652a84219, 0x1eab0abf97eff2cc
+, 0x3f1c0d5c4c7fc33a, 0x5e9ad6e5f5348809, 0xc4c1b285c9a59b2c, 0x60c8a75d59b4c664, 0xabe0943ab6b11e32, 0x1a49a0b59a3acb4a, 0x05d769419fd20b79, 0x51c5fb45449e4df9, 0x50e50489e1ac1f7d, 0x54115ac67ece035d, 0x8598ea2fac73332d, 0x431ea934e3960857
+, 0xf2cb22454ea00af1, 0x025950d4d559070b, 0xc2565527fbbb82b0, 0x561ca7ae6056f7e6, 0x1301b9d619022d03, 0x1d9316d9ea6783b8, 0xe9998461bc6926d3, 0x5b960cf8d033cbd7, 0x4479193ce05d623c, 0x74cf38a8a00a990f, 0xe8bb23877d21f6b0, 0x01ed386b2ea4c489
+, 0xe02d76c23df65769, 0x5bcb549d81c07dd6, 0x669c1962f10cb727, 0x42ee2f3a0d0ede19, 0xaae58644a95470e6, 0x16328399714afbfb, 0x4fa6972929968af0, 0x5bf4c376e782bfc9, 0x592de9e4c098b1c7, 0x53e97c45caced52b, 0xe8c8d878fcaa7cac, 0x3c671b044bd6413c
+, 0xc2234fcf0e007d0c, 0x05dcc30971bb3443, 0xf81ac7ca81596402, 0x0c06cfb3c0330c53, 0x75525c4d6dcb9bdb, 0x703e3094d2484c6c, 0xe5bcc56e8878c623, 0x4b3fd3cc06cb5b9c, 0x5c478a0bfa60c137, 0x3459807ad503ff9b, 0xaccd0270a56ba456, 0x39016c81a988b69b
+, 0x7b080f7e30d3533b, 0x0e9512136a3682b0, 0xc7dcb99a63b98901, 0x49f10b3df759ba21, 0x5d174bb5778879bd, 0x3aa2fac569d6c9a8, 0x7b946b0455b0f037, 0x15b1fe77d7410f13, 0x88375862007e4b75, 0x65077adff5d8fd81, 0x51b096ee323c35be, 0x4a3572deeddcef0a
+, 0xda17853d7bbc4401, 0x3a29b47a6f76d04a, 0x6f2f746423d22d0f, 0x7797922fe2173fa0, 0xeb8be92e76014824, 0x16f7e8cf3ef34590, 0xece610ebbcf06e79, 0x1719df0a9a223650, 0x30520026d6f49dc0, 0x273154b8e3782412, 0x47fcda60bef69b93, 0x666b05c201d604c9
+, 0x60cb6ebdec39da6f, 0x7db7314af3e74e2c, 0xd501c620b7d6de35, 0x4a80ef3017044cdc, 0x4ed6db4f7ede65b1, 0x50e46abfe9982635, 0xcd0de4b1f8d668ed, 0x32a5726bb38da2c2, 0x36a560fc524b0fe3, 0x4fa55c9e339d413f, 0xe7ba662edfcbda49, 0x53700f215557fe98
+, 0x8b3900ce598b6a14, 0x15dae8af8f8e5bb6, 0x6b960389b22e6042, 0x0d8b7b392a931435, 0x178d9d79235d5eb0, 0x45f0b99c036b08c4, 0x4cabc7f326496894, 0x27b3521559437a2d, 0x2823403270e925a3, 0x7f0c599d10e336b0, 0xe055a07c94cf0938, 0x4c6e914466995e9c
+, 0xf0cfe254938e2ec9, 0x4b1d472498ae4bbc, 0xb393efb16c19a9b5, 0x565dba78cbd5c5e7, 0x0771fff4454a45c9, 0x652fc29cc09258d4, 0x1a253d576079266d, 0x5fd4ab6a165f82e9, 0xbf07b693b48d1a17, 0x6f1163efe77267aa, 0xc27b1fb76900e431, 0x1cb463c353193e10
+, 0x1e4e3f311602b942, 0x4f1169284ac970a3, 0xd7b7f10151b3d41f, 0x05a1f9540b8768c6, 0x99883fca2636cfe1, 0x3cc998f2ca5e6da2, 0xa7c773d0b5fc8063, 0x7cbadd180a6489ee, 0x624d5c428221ee30, 0x6fcbe2e9a2fbd616, 0xbb5a76d154225f52, 0x39d0a941d7a42d99
+, 0x50a8e4e2ffdbbc94, 0x3b40e608ad57dba8, 0x60387be966a1d68f, 0x3f42854e9a62f3fe, 0x0e92c2891bd54d17, 0x5e1a61872ae28839, 0x81988799fb01c1ec, 0x64f84150e0fbf974, 0xc8b59b0925bf42b1, 0x2be011c8f350fa3a, 0x3046a09321806667, 0x16b7161e865c78ed
+, 0x1c7b2dca138f9482, 0x1b7b40c78fbc228e, 0x93e7a661673d1963, 0x5ec98c139cffc2e8, 0xb64b6a29d2b51ef2, 0x156761ddafd3a8b3, 0xc31010cb43883268, 0x56b2cbfc2259dd4a, 0xfa54b14bcf9bc361, 0x64246e4797cf8f9a, 0xc6b3f9a7ec368bac, 0x48fc1cd382a2e118
+, 0x19ec5c2b20eda964, 0x565bf760636bdc2a, 0x6a7d2f14648a4086, 0x2f245bf517d171a5, 0xdee186e8c2af9187, 0x075db21b451d2172, 0xcb16ffe26e3e9945, 0x5f8132295b9abf38, 0x5c4c168710dd2b41, 0x7cb1edcb8caa6667, 0x6bd751717f529717, 0x10242b7cbb0c6f6b
+, 0x7103968415a7cd1f, 0x19efda604dec2362, 0x425b201b3a687fca, 0x67fba192ef91a3b2, 0xdc7a1551f4d7d326, 0x0f711e3ce0527c8c, 0x3b06f6689692cc4a, 0x2c2ae6d64ca4813e, 0x42bc7a14a0f0ff4d, 0x53fa6f540a6d6740, 0xf85724d3784b6b8a, 0x3f6e4516af2fd457
+, 0xcf17333dbccb529d, 0x2dde3761c0620aa3, 0xf79b99b019f8b4a4, 0x2be19f5284dcfcb4, 0x54bc5a04916003bc, 0x4ade7a4fd64ad60b, 0x782e4c8b84e9551b, 0x44914fff8a8e9446, 0x6143258a01b173a1, 0x095ae9d288079450, 0x557a39e335523b34, 0x79c60f1c7decac8e
+, 0xaa4e93f9311b3225, 0x1a2ae13545378cb2, 0x9d1765559413c4db, 0x4872115ec9d9f08d, 0x70d0a6bf869b1ead, 0x4188ea0a58dd6c5f, 0x45600b198263d46a, 0x427e61bb13a9f581, 0xabb4b306bb9bad77, 0x6b27a09263f3fd64, 0x7fd59b238f3f60e5, 0x0d96626cde5a30f0
+, 0xb8dd0f16eb6fb94d, 0x509bdb4e88017d92, 0xbc4916fa555283fa, 0x22f5e17b78078032, 0xd5d07c4f0f5b2538, 0x470499c32553e02f, 0x1ed958cd8b6d1ef3, 0x52cd435d265975a9, 0xd28f9b8a46583d30, 0x25e2ffd9a905d8f7, 0x0b86324362339f4a, 0x6f0f61e702c410c5
+, 0x982317bc937b06e6, 0x358b6a325359c495, 0x0c5149d965a12eea, 0x60e183d5c8f44858, 0xa09344b3b3f25430, 0x271b4a9543550c6e, 0x6e05a69dfce21a3b, 0x47c447b17a948473, 0x6f673a00aa1f7b5b, 0x4d32c0661adceab3, 0xc6d82833f6915113, 0x6f7c57aae8aaf397
+, 0xc7a6cf892b92dd16, 0x74336e131bf73200, 0xcbac84785671b259, 0x4e6e539b5222d2c5, 0x39bcdce0f84e8eaf, 0x76b6d02c687ec4fd, 0x98e226c7ce640f66, 0x56d408ba5e1cccfa, 0x3699d1d6d5435595, 0x7995b99f0cd4c5ed, 0x6242e6ecb858b9b9, 0x1c552d2c1974410d
+, 0xa9f8e18f07df2863, 0x19a08053fd979ce1, 0x3e96443e6a6de07a, 0x3f9e1ac7ba13edf7, 0xb1833afbfd1585c4, 0x0f2dcf30fafa2f26, 0x7ac3f42571232d7b, 0x5cc8e792f017ba4c, 0x597a472b3f0f61d0, 0x77e1d3ca151e84fb, 0xd8a20c743839de42, 0x308756b116bb9f5b
+, 0xf938019289535702, 0x2ec098e5a20b2643, 0xba7ea8dbe1e33f10, 0x21980dc0490287fa, 0xc51c70b7dc448a39, 0x3595eb0dd0d35028, 0x2f1bdfd209cb1071, 0x2e9970328dc9cc09, 0x6519494cdf5170d0, 0x6e19cdf19ee09503, 0xe97cf279174ab39b, 0x557d5058820b86a6
+, 0xc9fbe25e702e81aa, 0x7f02db91de568ec5, 0xa5008ca0e0f173a5, 0x5977d30e18ff9c58, 0xb78de4ff4fba6250, 0x6862c0e778dd72b2, 0x888e2f48b6f2ba84, 0x486bcc9888169fa6, 0x091a1ebf24809146, 0x65d6559d7a0e1248, 0x756921d92361fea4, 0x681307299ee4e6ec
+, 0x5563009aaa85e7bc, 0x656856d7e5885813, 0x20ec298b5f57f46d, 0x7af68260da7a800f, 0xd733d02ad81b01d3, 0x1f00621f8f9bef3a, 0x0a05fb6a0fbad28f, 0x21837cfc456fcd89, 0xb8ee2a06e37b74af, 0x6583928ea3b1cd72, 0x671c3bff39ce21cf, 0x33041f18b5f29417
+, 0x15b491ef5adc7a07, 0x461652bc8a8885ed, 0x02853e537ebe31d3, 0x27371a8dd0a68e62, 0xc76cc26dc7c18638, 0x611f89985bc77989, 0x7d4a4928d506d6dc, 0x4a5e157e9b31f1de, 0xa386b3d15b7357f6, 0x25794a1d96fc4e71, 0x78b73c9dc6f5fdcc, 0x37de73e860c55139
+, 0x6e4a9319eb87b0d6, 0x29d9cd592cb11732, 0x227d509b8ba575b4, 0x75ade14bafefed47, 0xcc08db59d2e81efc, 0x08f41c66be496ff1, 0x681d64e9615df1e1, 0x648e01be052dd193, 0xe88f4eedd9aad621, 0x73d93c119cac9994, 0x7dd302c1ece048aa, 0x071cc6fcb7b7338f
+, 0x6b520ac05ebc69c1, 0x76bfd99b2abd42a1, 0x6ac8f9dc1bad8401, 0x2ce35f5bb8db22cd, 0x57c7233b414b129e, 0x1ac6522d04cc2ff4, 0x9a6481b2cdb3cc19, 0x60e8c06b8a1e9d77, 0x9973797f4b38b9ad, 0x65b36207757d14b0, 0xa03f1452a4811776, 0x451a2e5f9f7dcb2c
+, 0xa91a6a7695037342, 0x285bcfe20f26ec6a, 0xe8845bfd6f8cab00, 0x64090e6a1f7fcb46, 0x8201e1617a9b0b96, 0x2c0d2c7da55c60a8, 0x8a3273aaa28e04ed, 0x735c2e37256fdff6, 0x9f5efe8c641d8385, 0x2aa260522bdf772b, 0x67dc595f99b64239, 0x10707be30b1cbacd
+, 0x043f8f1fcfc01ce1, 0x5b25f9b731398338, 0x55b2aaa3a0403fe1, 0x69305009b3d6625c, 0x8d2b1f154751f5cc, 0x69ca3b11854cf986, 0x2300dfee7a88fd4f, 0x6c5e77474bac6b17, 0xc02afdf516627bf2, 0x1c6eb2f368f2161e, 0x9ee699addb761e7e, 0x27ca88831a7d6d4f
+, 0x9e3bd1201ad4e70f, 0x370aef3c7b055e04, 0xddcd8521f2b0bb42, 0x710696fe5b4fe573, 0x435805764c6211a3, 0x29114be57ed257f5, 0x6fb0c85d7122e1c9, 0x2782a67c4aa49fe9, 0xfea2c50a8366af3d, 0x232f49ebba530ad7, 0x0e0f2b7e1ad1b7bf, 0x158693498e3059de
+, 0xb5c821b90156827d, 0x1521aaeba4b29f08, 0x15ddcb8e243bb243, 0x03a6c56f5e778bc7, 0xf998d73c28fd6022, 0x30fb277cf9f92e38, 0xa1a7a6be2064e051, 0x5638c1321e04e53e, 0x9f2310dbf7030bbd, 0x30b3883d79d41c2d, 0x3c2d6ce991b78677, 0x087c07290df36b27
+, 0x7e73d2e32c8500c5, 0x6287d20b177baa11, 0x555de5251a5b49c8, 0x34b0ba859fb35e15, 0x9137043a880ea89a, 0x65bd6041779c68e8, 0x7dcbf3dbf8d8e2d2, 0x25610e143cf4220c, 0x8ffb76ae45dce7d3, 0x6d5b2c2162abf98a, 0x36538176e0ee523c, 0x1320530ea4147464
+, 0xaeb423d3e48ecb78, 0x5e075b659cd50322, 0x4353e91951df37e6, 0x20b106a8f5dd3096, 0xcc12742ae9f9b166, 0x54f4e43ade2ce757, 0x8dea1028878c8913, 0x5621f69afa28741c, 0x264652353e58cc34, 0x213e39c67649ef5a, 0x7bc6d1ce82beb531, 0x1c60b6cf6415e37f
+, 0x29f72c1aa620013e, 0x171b3232257a1196, 0x6a738800b2c33d01, 0x58db91827505ea50, 0x5c2ff68617c7d3c7, 0x38b46a424123b2ee, 0xb2c8e99a82f17c5b, 0x41d0488192d63a9e, 0xeb161a94c47dcd93, 0x2dda24b573b801bf, 0xa2a3ed048a0f7262, 0x29344e0cf404640e
+, 0x01c537f28b836c38, 0x1179557356c2f16b, 0x479b0e01bbb05435, 0x1397fd0f9be0a170, 0xfee8eab1f0420e1f, 0x27dc47745d78970c, 0x9e33cb140d0383dd, 0x2f0eaca77561d1d6, 0x671c9020c0e746f6, 0x116564d94e4275cb, 0x451aab6c055c8134, 0x5230dbf84509385e
+, 0x45539205116f552b, 0x3a1834d16aff3ab3, 0x590919e4e7a5876b, 0x2f60c9ab82553e3c, 0xa249a4291619ffa7, 0x26f30d42849f01d2, 0x14d2e0dad0995676, 0x58f05297d0f51061, 0x548653d745b2746c, 0x534e45fbb4c8902e, 0xc0af0acce25c610d, 0x6bd933c64cf07dfb
+, 0xcea4f72759e30881, 0x3ca0b0326eb594c1, 0x6cb31d3bdbcb9cdd, 0x2bba616d2ba04f32, 0xe5963bd4cbb4609f, 0x7fe9d459686b0ebf, 0xa2280d5f4a681d98, 0x3aa8d40c314bba80, 0x65efb5a807474367, 0x648f8bc913a01d15, 0x1ff85247f9fde67a, 0x2cd5f900ad477dff
+, 0x1ed7dbb05bfb004f, 0x77d5a93082e882f4, 0x155aee138d09ecc0, 0x7f5a40b2e6283faa, 0x6b55316837b17904, 0x487a2cef5d5d41e5, 0xcfa1c85dfdcb2cc3, 0x258880f3e408fdc6, 0x377c62cf96d6f8e3, 0x49bebfd6924c0887, 0x6d6b94d7bf6ccf0d, 0x2d716d4b659789ad
+, 0xa177f21c01ee69a9, 0x5a8fc7b19d87bb61, 0x035b34cf7d4e11f6, 0x6241f6c4903f695a, 0x479f5c0ec75a1c0e, 0x1fc83094862ffceb, 0x1447b2bcfd4f0ac3, 0x21f7f94fd99d68ce, 0xd00b5360a87fa5e4, 0x795f00b0647ff4f7, 0xd5def5823bf33d91, 0x478a66035fcd15bc
+, 0x0a1486124649cdd6, 0x35e86d98268c5d9d, 0x08ad54e5033b6588, 0x3366ef3cd3485b75, 0xb9379a891dcf13d1, 0x7b442051eaa427e1, 0x793ccbef989d87c3, 0x5e5943190610ca17, 0xc34323ee72696a25, 0x7a96b6de811fa593, 0xc44a7b015a595aa0, 0x248110ebb1862b87
+, 0xad1fb02cf0bf775a, 0x2ec55fbe08646a2b, 0xfb104f01b7525f8d, 0x265135afac3cc1d7, 0x04cf68c485a9a7fa, 0x1f8b4b728594288e, 0x0bcf74add9be9a58, 0x77bf7563e77ea6e0, 0x867bbf8774012b38, 0x6e94296ea0e59233, 0x214f807451df77db, 0x31bf4905ccdd595a
+, 0x7e2a9878357c6461, 0x6df8d87ffa8cc941, 0x0b0b0d4942fc0797, 0x7dec29a8301d6a1b, 0x103d5393b97ec805, 0x34ac0ceac7a7aaf5, 0xe95befcba54156ef, 0x70a369552572fe84, 0xb551aaefee660bd6, 0x175a4d59131ff377, 0xd3c6350f8305139a, 0x444c63d7b582080a
+, 0x2442448b9b80288b, 0x457ad8b183ba39b5, 0x35be778993bca442, 0x6a5a49854b245263, 0x2eb9bcee435ac68c, 0x1c433743375f8467, 0xe16f12c83b6d01ed, 0x4e862380ee9138e5, 0xa8a36c74b90e5fde, 0x003c518b7e83adfe, 0xaf564b810f983ac3, 0x637b03e06f8cc19b
+, 0xfcc39cd4155dc049, 0x0a8a38a601b25542, 0xd0f7b281199ece2b, 0x2a55ee40139b9609, 0x317317f64d035559, 0x13f80136c3ecec02, 0xe036882ac1adfbf9, 0x56d398b772ad70e3, 0x41d55ba323aba7a8, 0x236b33c4eb79f169, 0x50a4bb553a65a0a3, 0x574552cb291f222e
+, 0x6c9c9f0b43601a16, 0x579e40fb417f78f7, 0x9fd202321d8faba8, 0x61fc7494ea21f503, 0x92bc033381a1c647, 0x5b31747004ff4198, 0x762e7e0244837fc3, 0x4cb4ebe58dd22e61, 0xbc2053f8edd2e1da, 0x7a00339f7786edd4, 0x822d94400dccec11, 0x77bdc40f1f91f8e4
+, 0x970fbb79e1aa45d2, 0x30f8456cacbdd666, 0xc0fafb1687705e8b, 0x25454801797573cd, 0x2d2b11915ad3d2be, 0x4dfebd6939d333da, 0x9bf6f876c7142e35, 0x40d6beeac2777bad, 0xdaa72f1abb2cf6d1, 0x4334e872d87274f7, 0x886f948f1189d41d, 0x13cd64bd74a7ddc3
+, 0xf9a8a0598b73351d, 0x6b34b9a105dfacaf, 0xa0f20c2e6e07c019, 0x1e341590afe4d5fc, 0xf3960b18f9ac55e6, 0x65d99ae1763a1953, 0x252c69b9324503d7, 0x05eb4ed69b0e6fa6, 0xad105648fa9776e8, 0x78492d6a8fc2c168, 0xcf7b35250d023b98, 0x37032a81da75528d
+, 0x68445bc0978d162e, 0x66d7b705e7a53bab, 0xb0cb1e73cd82f1a5, 0x3474a878a6b643a5, 0x6186eac89f7d58aa, 0x5db4d275b7f447b0, 0x0387756b3850ab32, 0x7b558f2919997f88, 0x9ea94c580f7d6775, 0x627ee60ab04f42f4, 0x5b3dc15cb1c6490c, 0x13f4025983227a38
+, 0x9ac62fbe5830fe9a, 0x45fefb020a78e628, 0x9eb2a60a1eb39f5b, 0x55f6d02d2d4da4bb, 0xb77c5fdcafe96d6b, 0x5420bb716ce53a21, 0xe80c7e5f03c3a501, 0x55485ba27440968c, 0xf982b7c9cb14ff56, 0x2a9e32eba0e4e8b3, 0x631dae2117bd565b, 0x5fb537b1fd3d5e9b
+, 0x293c9496189f1007, 0x4d8237c15bba2a04, 0x69b9ed8f11cf003c, 0x3ef021c9b9778daa, 0xcf2c3b64db19431b, 0x51484d6d2eb0d9f2, 0xf7ced86256ee1848, 0x0a93e71109cca969, 0x7c1b5cd7f3f1c769, 0x52a8488025a2ab06, 0x8944e924230c48b9, 0x52b1f6e9baf8b649
+, 0xd08686b6b065ac85, 0x5e299fcf61bd8cfa, 0x37f296ac7b3dfbb8, 0x060fc7f902bb45a7, 0xd1043cf72331c810, 0x0497ad4b20f6b928, 0x850d0ed960a1de83, 0x08c8590835793e0e, 0x92e5e7e0ba3798f4, 0x6cf804cb9f517cd5, 0xb8c24392fa9231e9, 0x14cf08affa79386e
+, 0x782274f8c7149959, 0x205cb5921afc71df, 0x93713cf9a4c8a3d1, 0x5ba8e53e04acb040, 0xddf514c1fc1b124c, 0x7d01d2242aa2ac6c, 0x6d0a80bb7da4e3b9, 0x5169509affe819f0, 0xbbcdb34331cb7cb3, 0x76b346875d988d8a, 0xb1c3dc552896f1f8, 0x4e8bd45e738de101
+, 0x864c7b8d6e7747f6, 0x5089c86fb3e6c808, 0x92b473aa9b7e1370, 0x64dca9f10f52804b, 0x88141fbc0af4db74, 0x4e982e9c92d28a06, 0x8f1f45838824105b, 0x5139f2e88ec43159, 0x0476ab223ca06c7b, 0x13f5c14695862c7a, 0x256c313ea938d76f, 0x0525e75f00c6ae32
+, 0xda039039e76980c2, 0x732c9d941a5a30a7, 0xad43f788f725fa20, 0x2680e31ee1c1bd71, 0xe13df23dfc8c96b2, 0x67c4536fc7f9a9e4, 0xd1754172e69c5087, 0x4470c2957894c7ce, 0x41a9421b69976721, 0x13926e0482978534, 0xd28ea2368e127958, 0x536b8d92e0df99f4
+, 0x0c402671b7ea2a8d, 0x3e2fe9614ff5dc82, 0x5866c4bd1e423a3a, 0x0a950d1c6ba2b7ad, 0x61567e805493abe9, 0x326ea601d2919184, 0xe0033edd2cf77c52, 0x72ab8b97a83f0685, 0x230fed1425991942, 0x5718244296e4fad5, 0x1e28f49ed2817863, 0x1a315b5ada8d6c70
+, 0x42014ecc3eb6461b, 0x685e152911f0ab7a, 0x0661f5f51725563e, 0x2ef0eb8853deae95, 0x7c1b5b50910d2406, 0x3650da9819156607, 0x805d82db877fcc93, 0x53e3b10a4cd4abeb, 0x25b97e374cc8ad31, 0x40c4b5d84c1297cb, 0xa06d4412b0bf89d2, 0x5442d1f23e6345a3
+, 0xdb2249795f240c5a, 0x471b686f03503a2a, 0xbce54d00a685e5ba, 0x753458bc5e37c15d, 0xe5b58081098e3320, 0x5911198b033b15ce, 0xee681b80119d9990, 0x4ba4f153d5a86f17, 0x3ec2853c62b89b7a, 0x4c9daad76744afac, 0x230a9f480377c76f, 0x1e0ede795f5470b5
+, 0x36cf5a881868ae3c, 0x1f1865ce3ace4867, 0x38b0883616b21644, 0x0967993a377285cf, 0xf6450a4f33974b8c, 0x2a4ad19e57b847da, 0xf2ce4ebe70defb63, 0x7056c38933d38011, 0x5a39feafdd60d6ea, 0x57fe97fc41db07c3, 0x2409286204a7adf3, 0x79bb8933ce84eb66
+, 0x652b3d6501824ef9, 0x53bf101f8566940a, 0x053c8fbd08ad2295, 0x5ff837f71a7c89c1, 0x498ea78f528a9de7, 0x1a1fd835b183faf8, 0x5d279a0e510dc9c1, 0x3b6567ef4e7f4270, 0x0fb47eed71c62940, 0x2d09930cbd7209af, 0x8b69bf41e9576e55, 0x44ddf08933613f0c
+, 0x5f58c3006e5a2e70, 0x4153c0ea87d0bb1b, 0x6b2ca833b943b1cb, 0x504860b77f1ad25a, 0x94ad6ca1215f140e, 0x7f8236ae609d168b, 0xf107c0579199f5b8, 0x127d64a6b4ac37a1, 0x75f1945ae228fa6f, 0x21911110609b97d2, 0x0db39bb678c0bbf2, 0x2352570be484bbde
+, 0xdd62bc44f5ec479d, 0x1c95d06bd6e2174f, 0x818457733e78c2a0, 0x66302080122f5525, 0xcfad9ba30cf98a5a, 0x3ab206f6fcb0f594, 0xa3b80665ee8e9eb9, 0x29022b3f2e96e42a, 0x9ff60be06adefdd8, 0x0e309c21943b6bf2, 0xd8260bdf3a9ff195, 0x57e1f524c635f981
+, 0x5ac1e8c05db27504, 0x30e14c1313be3f5c, 0x165d59f12c370e8a, 0x5616a52fe089f9d1, 0x9405b2d3a6ae17bb, 0x6a72fddcb54abcdb, 0x794577b8137c88c4, 0x09db67becd8308fa, 0x3f0e179477c268bd, 0x6712e05899d5ce72, 0xaf96e5c9b143e04d, 0x54b3f02f71150816
+, 0x3453d2814c0681b5, 0x328ceb7e6aafd263, 0xd9ad6fe5a86c7dc0, 0x1edc330090668a90, 0x2b16f69326a2ec37, 0x703c61da7aef19ee, 0xaae6376025d91e22, 0x1b6254002f5d1e0d, 0x01d649747447bb23, 0x594b7836fbcf65fd, 0xa3ca1e724f2e882b, 0x1e0cda891abd416d
+, 0x79427c3d11f73e9f, 0x723482d7ac098fc1, 0xaf1073da84e3bdde, 0x132028ef60e00f08, 0x62d5529730763e81, 0x726fec69e45fcc16, 0xb3ba83eb9d1e5286, 0x7b3521dc850148c0, 0x03e91abd0fe98833, 0x664995a40493b134, 0x6ee9418b48574be5, 0x405e81078afbee13
+, 0xb9c26e78bbf842e5, 0x3eea47705323480b, 0xe7f914315dc68ae5, 0x04ca47eda820909e, 0xf73c1c6cd0de6613, 0x6911264eb86424f4, 0x65b78419db65e2e5, 0x69e14f89e137644b, 0x59db8bd98cb32cb8, 0x0397cfb021ddbf34, 0x35ab0603a8216dea, 0x5898a33ebda97f64
+, 0x0b67d663dfd9ddca, 0x7a501d5040c42e0a, 0xaf95f86aca085dda, 0x085f64e23e829710, 0xf37d696b1c9f35ac, 0x28cfaf1a6e0265ae, 0x03d477981251acf7, 0x4827b9e8cceea699, 0x3a845fe094565c5d, 0x3c715f48bb51b8b8, 0xc8996af202366af7, 0x62aa495613864b78
+, 0x7db8d9cb74349bd4, 0x57d5e33ca81cfa18, 0x9b5b6460b495a730, 0x155669ec576c516f, 0x24bdba24bb239b49, 0x53b579b938586f11, 0x4edaef9dac020f72, 0x29c5b2e0a84cd086, 0x187bf4260433eb9a, 0x15eed1bf05ca11b0, 0x7629d2e954175fdb, 0x261cb5eaccf6ee98
+, 0x25288fb6732bf64f, 0x77f4ac3f37dce0b8, 0xe73af57bc90fcfa4, 0x1931abf0a97427c8, 0xef8ad99bb75c0bb8, 0x59ef3837f1c968b5, 0xee4adeedd2756b9e, 0x5d1164baa312620e, 0x4256bc12fc48ca65, 0x064daed2d5636e58, 0x80f858aadf1386c4, 0x47c0fa8c98d097ee
+, 0xb8fe790d4605f423, 0x51f6496a485b7510, 0xb7cc49c92402ee34, 0x49c66ccad6124846, 0x8aa16bbb3a41a59a, 0x37f3574922833ddf, 0x18643adb955955db, 0x57bd25a88f290c65, 0x4db7ff016693c151, 0x0ae7db961c99b221, 0xbf4d77ec60661fa2, 0x0d46c8fc49eb3a48
+, 0x756c0627f3372161, 0x6febce7979fd76ae, 0x52297e0ff5a25d10, 0x5384803a1e1d7a8d, 0x29902ab445e9d9d3, 0x2190d5fdd313ebca, 0xe27b4855e4f63639, 0x595ea64510add92f, 0x5030b225205b6250, 0x15fe8dd590c4b522, 0xa1f0a3a3e97a30be, 0x1f5bb9851d8f007c
+, 0x22515a7d67d2e8c9, 0x033e36b793025bc4, 0xf48e007b17d65a62, 0x4f4c5792841615ef, 0xb81df8991ee91968, 0x58e7aacd7280f19b, 0x84a84cebe1fc1c12, 0x6db920035530a390, 0xd51f8467e78a2fd9, 0x23eb6dc4ff04c267, 0x0ee270f292835107, 0x30db8c1ff602f484
+, 0xf5888d17eeb5d2c6, 0x3d196b617142b032, 0x1f45a028f65b0e34, 0x5af8b0e8f8e21506, 0x3079c3415a0717cc, 0x7bd358643939bfaa, 0x937d328925a1f6a1, 0x188ebc371d9e0221, 0x2e3999f753e14b2f, 0x4ec40280dd0e37a4, 0x47e9049430b2a209, 0x6b5154fa0d8c7dfc
+, 0x8f030aa33d9842f5, 0x60bb1254f5da3a34, 0xe97325b5b670b5cb, 0x54c9830df5b5bfd0, 0x1dad05501330edab, 0x2d810cf118f8b804, 0x404d00fa5d8776c3, 0x0039a0d9d69ba306, 0x2db8e9189a81d38f, 0x54a77271ba7378e1, 0x369576c37f59bc83, 0x5b16a7a0b44c8689
+, 0x2959502fb6cea863, 0x460980ffb309a3cb, 0x05267f5e75b896cf, 0x2b146222e3d4b88e, 0xfee502dab49e229a, 0x485ad20ea8322beb, 0xe7a1cf4d791942a0, 0x6047587334d8bab6, 0xe09a10818262a2d1, 0x5dbc8dc5e2883008, 0xb10d89234160f565, 0x399909de5a1a9733
+, 0xd629d1cf783da3bf, 0x03660d1653daee27, 0x8dfc16bf8b6a7b59, 0x299e05084de05b9d, 0xb0c28a7ed2a9d3fc, 0x4d97b8bb97c2cd89, 0x2402c61a8ddb481f, 0x3a42530f496c365b, 0x31d554ac48beb367, 0x41471b150c667b8e, 0x45427d0d3a945dfb, 0x5dbfb719cdb28262
+, 0xdad6979506cc825a, 0x72aab0d2725edffe, 0xf88c0b283773a738, 0x566aece98ec93945, 0xba61dcbb833f7190, 0x15fecd051f432a5b, 0x4afd510e5878e037, 0x41c0da5a430f0599, 0xf56b16a2332ffe9f, 0x0e490129e7105eab, 0x1826987afecd89c6, 0x08d8856e043f785c
+, 0x6bf14ed9f2bd6f0b, 0x7e66f6f77375900a, 0xe3a0413a8e7d2415, 0x204dff8f2d734638, 0x4193945b33a25b59, 0x4bd1d86d98d73689, 0x0f9d241e4314d438, 0x4bb1d91e07021cd1, 0x109187f9be87d9d8, 0x12fb62f2b176cdfe, 0xd1cfdb78d4cf08dc, 0x5e08b26596590d3b
+, 0xe5bc489428c3e2aa, 0x7634cef2bf9010b7, 0x9cbd148f75a8c744, 0x4bd93b9de110ae82, 0x546c64ee8f82797f, 0x45f7aee06770a5e1, 0xd36f266b7975fc83, 0x68f92082945c98dd, 0x5ce817dda8b5ab3a, 0x740cd903a08c5309, 0xb9b5770495ac9123, 0x594ba3265986af74
+, 0xdffe0acb6a1aa30f, 0x1c77367e807a4adf, 0x8defc49a67c57f46, 0x6413ba937a5d9eb3, 0xb77f02bd93fc8ef7, 0x4ecef3a4027c8547, 0x036c49466e5a8a95, 0x5501b8bb1e9ce9ca, 0xe25940720a41f75e, 0x1ba13baf07e8c4e5, 0xcf1e5fd47ee58672, 0x571bc6d575443352
+, 0xad031d072bcaf694, 0x32945fe4d436d82a, 0xd2558dc27f96375c, 0x2a515272e79a359d, 0x84fc5123c9992c4e, 0x2bec90f8fd96d161, 0xfde1f4a1ac6f24be, 0x66a34b47388698dc, 0x5deeee79d5544f17, 0x4b4ca36ef8e8c2e5, 0xf69ed80a83b78e65, 0x2fd9e245240ea61e
+, 0x9e2ac26756365555, 0x130a455a93f12236, 0x59783d6dc71d2782, 0x217da031a3e6cf3f, 0x78571ca371e385e2, 0x3e8ec48d8769c09e, 0xa9c8c5854e70aa95, 0x6d5642f9a4e3a487, 0x72d4c7871b2b6aa7, 0x2a70144ed7c8c2d3, 0xfc10c0e31e5f01a7, 0x0b7619602f7a1feb
+, 0x4105616bd91c2c32, 0x2002d91d3c7383b1, 0x6566459dd1e2cb6c, 0x4b066c5bc9425999, 0x3d85af89cfcd17e4, 0x244615d8ba21fec6, 0xcc23dd8743e647ae, 0x1f10886a20949c89, 0x34fb9667cc9921bb, 0x4a8c7efed9cbb2f0, 0x6a39e5433480b8a9, 0x5174fe8c013a850c
+, 0x31cc858ca00a71b2, 0x7c690320bc9ce0f1, 0xb60a8c9797017a58, 0x74dca567312dc4ae, 0x0be80911772b95c5, 0x48a2cae3934ff24e, 0x2cd9beccce481f65, 0x10439c909bb8057d, 0x521a8d5b63a8beab, 0x076b106812e2a2c9, 0xd8091bcb9f481fff, 0x498c58c79029c43a
+, 0x1af05a84c97cc0b9, 0x6ade8b2475f0c627, 0xe0aa56002029e554, 0x48379a2cdda91b3a, 0xfe7c1f5ffb581daf, 0x57517341a669aff9, 0x7edcc40d4d813e05, 0x1697f2cb8fee9bb9, 0x41aa146c1a776f6f, 0x6f31c20bbc351fdf, 0x1bce284f6a8206e9, 0x05737869967455e0
+, 0x838496421167a1f2, 0x320529d3b7e22fcb, 0x967e53a2f442e887, 0x6a3c93e97682ef59, 0x34e0eacb6cc9383f, 0x0368abbd07cc8cfd, 0x15f25d9aff2ad01f, 0x18441f69d1a3b0f4, 0xd4ba520088ea2e98, 0x29b9b75252c9590b, 0x0c5c1faf80c761e0, 0x6f4fd0591ba14a11
+, 0x9f38e2a269506420, 0x118b65f5d5523a62, 0x75b9fd6e4827b13e, 0x0fc525e63d4c89fe, 0xfef1cd427e4ac932, 0x7603fe1db57dfa3f, 0xd4f0d4ed8fa467cb, 0x19461e7704d6242c, 0x6b0513739e870649, 0x53d7fee51ae62700, 0x52013bb3c94f52ac, 0x4bb5b77ab3dc68ec
+, 0x18b0923ac1958152, 0x2d3fc2b32b80d587, 0xe8396a4e4a1f4827, 0x474ae8943af02a37, 0x1a2ff2f8e9c502af, 0x16d2201bde39ea91, 0x565a290d501ed2fe, 0x16d7514cefc424f2, 0x2cc9f472d6477e64, 0x404c492f5cc18bdc, 0x1715c6a721cc214c, 0x72d7dc4095b1236a
+, 0x6f5f64bf1dba34f9, 0x25f69f95ea2f1def, 0xd42c7c258ecf9431, 0x4532241781369705, 0x7507919b6b6538ab, 0x25002934a4789c83, 0x0636f445b7be1587, 0x28027dee70c9ad6f, 0xeaa9e29d436d0aaa, 0x1af86c9bff529436, 0xf7617cfd255ee517, 0x3d9582d3eaa3a880
+, 0x02c36b5bc519066f, 0x10ddc8fde134021c, 0xac4e36a792218798, 0x7f9ccdc750a3b5d2, 0x5d4567fa97fee35d, 0x28441f340649828c, 0x750456df0db2a5c1, 0x6e147344dc5dfb2a, 0xf41299b5cd3fa381, 0x4f2f26a2b78dd3cd, 0x517d3d4db50110e1, 0x3c2d57c4059093b1
+, 0x391479c5cdbd0410, 0x4b0258678b56f6cb, 0xdf7c159a0ca9f82d, 0x7bf57ce5c65dc96a, 0x92a1f892c9bfacef, 0x4fce54e8fbbaddef, 0x073b5ae4a93184ef, 0x2ce374a010b16fc4, 0xd4417a3b83fb42c5, 0x1888e5c9eed91aa8, 0x92267b698c19b706, 0x2a0083e86c9926f8
+, 0x5638d4cc7e3a0eab, 0x27f8d7b9ac612d2e, 0xe7e83a6311877a2d, 0x4cdd8b64fe510012, 0x849970a95374756c, 0x130e2f5e9940a43d, 0x833c0384853c30cc, 0x7dd923b918628809, 0xca8d816ceb6d4f92, 0x11d0d4db17d3945b, 0x1c6152032c79ffde, 0x4f16525049ffdd02
+, 0xc4176914764f6f5e, 0x552310bd4fc154fd, 0xc44dd5d1ae516efd, 0x1b7b129edb6dcfc6, 0x7378acf3123193c4, 0x7458ccc5dcd9b0e3, 0x0684b7b58a0ba6da, 0x53c0d6b170ff4c20, 0xa5a34e912965d868, 0x733b6bfe94bc0973, 0x9d3174bf7c7c88db, 0x370304bf27862aeb
+, 0xdb786e6c114329b3, 0x1160a0a5a0df78b2, 0xd669a4cbf3af1977, 0x4bd35b238fae1748, 0x3a61704a9fcd3324, 0x5e1775c2ab4963d8, 0xf02da734c2eedd8d, 0x478e6240aa330ea3, 0x809dd6cb7d27b771, 0x3b1767a5d64a0932, 0xa13fe826288af52d, 0x03b00c1260146482
+, 0x36bcb59e1d94b515, 0x7982732860b34833, 0x2b79e6fb15cb4685, 0x1e0807af0c873c7f, 0x3507b191bd47e722, 0x157bc0b5754ec5c6, 0x94cf1f52f82c605f, 0x26961516c6f7a269, 0x46e22618d0f65460, 0x76572c8e4bda9831, 0x4e5c8c34742d4a17, 0x4a23a9457703fad2
+, 0x921cadad3eb9ef00, 0x101c7631b2e21e52, 0xf78d02a67b165fb9, 0x2b4c55824c4d8fe7, 0xc541ffd75b13799a, 0x2b365c738a5ded1d, 0x14f95148dd75df01, 0x3e0d80076824e4eb, 0xaf6478c2b7bd49a2, 0x5759b9840265a5e5, 0x8096796b3fee67d0, 0x0912c116ad1a8305
+, 0xc7d2dd919e5ef83a, 0x4fdb46a99f70cf7c, 0x3e0bf72ef35e1141, 0x4e3da9b437364aac, 0x43baab6c07e628ee, 0x4e5df529197554bc, 0x2f3138828114504a, 0x39be287a34ed4d9c, 0xe4c990cee5c84c55, 0x647900ec84381d8c, 0x33bde7a913452c09, 0x5692cb59dc7c0c5a
+, 0xdae8c2febd0b94cf, 0x7c7a7895c43d028e, 0xf46639041c807988, 0x71f36f2a7f7df6a2, 0x3dff5106444dd3e4, 0x212731d5624022fa, 0x0b374fecc97dcfa0, 0x0efb87010f6b0db8, 0x6443b7dbccdecb85, 0x598eeba8c5512eee, 0x8e2e86ae544c505b, 0x79f9ae0df87655c3
+, 0x9a19c9a103303648, 0x079c243ea6564b1f, 0x715569f890207876, 0x19a267243f016663, 0x48ae1ada23f33f0f, 0x6199e249a6fbf846, 0x3e1e848be808f71c, 0x5512b73fbebda46e, 0x167bf180d9b35648, 0x77eac2ca4c62774a, 0xbac2defe04f3e28d, 0x3256e1e1b492fa93
+, 0xbf33c8c870ad33d8, 0x566ace541cc2dc55, 0xfadd84e0c31d244a, 0x0d107db0f0f4985e, 0xb16c4e20fac162b2, 0x5aa98993d974a677, 0x54d0d2d5f0558c53, 0x49c02ff0b3dc92dc, 0xc6ed002a363210b4, 0x7e176e6f85956a78, 0xfda7e3001def52b5, 0x4c2cb25f5dec37a4
+, 0x8d1f25b719ce447d, 0x6975dda63b0797a6, 0x07ddde6c15f9f665, 0x52d22a35f915d889, 0x98ad8244261dd890, 0x6eea0855b7dcfa43, 0x24b959d56c926dd1, 0x4dc50ea062b177eb, 0xc49564f5c307d527, 0x345ee06ca1bcfa03, 0x4f8050316fe12822, 0x35fa67629a9a839e
+, 0xed011a648e367f9e, 0x6771c3a807f9de80, 0x8c891475bd88b18e, 0x4a753178d12f5058, 0xb44e1f127fc004c5, 0x76feed4ca3f430aa, 0xe978faf1cbb45a53, 0x3291e1b5538866c4, 0xa3c9a16dffcbc9f6, 0x0b88f323be2019b9, 0x2b5137e3e78f5393, 0x4ca4304941d93e7f
+, 0x35a4bb5f3fcd678c, 0x002c32e4cf46bcee, 0x4fbb889e124513f5, 0x763c2a0852805e18, 0x135f7980d0b16e57, 0x33275356b3d9dc34, 0xaed92efbe48a6020, 0x5a7d7293be52e9e9, 0x80e5be16c51f5d62, 0x0caea44872d84107, 0x6ca8ebafb0f53b67, 0x1c2b0a71e8ed1b94
+, 0xcbf056441ddd45b3, 0x7f9d04d3e299375b, 0x230d12191cfc24df, 0x21c97b6be4a4bed6, 0x384426a0aee53d5d, 0x59496b56b6f6c453, 0xe7312d64d06d2dd4, 0x219aaf297922746e, 0x9680aa9c8c219800, 0x18caa0979aba6e0e, 0x4779227e7b061385, 0x2231717266395003
+, 0x31ef9fd8c6810b0b, 0x575e3935dedb9077, 0x62cf383526865acc, 0x3cb29e835e261bc9, 0x31da3f6df62c07bc, 0x0b0eae3ab91c0ce2, 0x20c7480981fd2abb, 0x5e2797305d4e16c5, 0x4d40021cb2afccca, 0x06195d33da596702, 0x183cd5113442437c, 0x3efc4f3442bbe6d7
+, 0x967151d02fc05d98, 0x36e90977c4cd0333, 0x75b70da281554d67, 0x34d54d707bf6ffc3, 0x84d83bfcaaeb9605, 0x59e83a958e1b532e, 0x86fb4a3221291926, 0x266669441b5288b5, 0xda834bd8155dadc5, 0x1b902be6de06485a, 0x0a92c2b88475dd02, 0x5693cf89c6100a12
+, 0xfc269c80bdc26ebe, 0x60ed46c9ca233b0d, 0x768a79607c29aa3b, 0x7c616d666ce24fef, 0x8a45e276fe7d0155, 0x1f5a2f6f886014a4, 0xfb16f5aa46ec823c, 0x4ef94549135eb1f4, 0x0400abe4d8b7eb9b, 0x7d767bd1eb366e34, 0x6ec74df7847b0899, 0x7447c68619150e48
+, 0x7a046d75a006129f, 0x37367b0be62e4edf, 0x22a6438795bc863d, 0x0f14ccf1cae9f366, 0xe4d7fcd7dece506f, 0x1dc41c2d6af8a9b5, 0x4a2920f9ca548c6a, 0x4e845be0a209f1db, 0x2bc4088762f48212, 0x5d106f7c9e52d638, 0x580709615b062709, 0x0984b8230966771e
+, 0xe3657218e374932f, 0x7ffbad64a950fcdb, 0x41c87fe721f3677c, 0x31c8957c47b45bbe, 0x872e1d31d32fca53, 0x4f35fe12e1cf87cd, 0x40b1694fb045253d, 0x3f750a6da518838f, 0x057c581c46b1053e, 0x323ee6be5b9759f8, 0xa374bfbff243b0de, 0x1f3769bd2e29804d
+, 0x332a14c6645728c5, 0x1b4ab6261176ceaf, 0x10f7c1f2daf53867, 0x058fdf89f06d9f3d, 0x0b7efb01d9a2bab0, 0x71bcd4aa310d0e72, 0x950948210935982e, 0x3aa0bb0d99213cf4, 0xca2ca84898b82c97, 0x6d795cad84333f4d, 0x00c83ca85826458d, 0x55b040fc6b811a60
+, 0xc92bad0816d4469b, 0x2f815d306d510f30, 0x13a6aecc921f2eab, 0x425f12d2f92d2e28, 0x98df6507dae9f544, 0x1dd1654ca572ae1f, 0xa819f8768b93fc0b, 0x6c3a73e59e3eb36c, 0x7ac41c01bae8d55a, 0x304b0edcd51c86b6, 0xfdcfd5e401361548, 0x64f774bc86468df6
+, 0xff8a5e57360b7580, 0x141336d761b85553, 0x2db3a3756cedf826, 0x1017190c5113e386, 0x33a33f93433de92d, 0x2b35f4b9ff3bb587, 0x372cb85fd77c3dad, 0x4ea5a6670321edfa, 0xba6d8aafe2e34561, 0x5edec94fe330483c, 0xcce36d583650e432, 0x350fe7524085e296
+, 0x5c76a477f9aef787, 0x1288e2f8fd15311d, 0x0475a23035d0ea37, 0x3a5b406986e39733, 0x8d0b040dbf4b54f7, 0x5799ea74db16bf9e, 0xd19980c6c5ace12f, 0x0e50b814e0d3da4b, 0x31cdbbe5f1d0e56d, 0x0dbd38c5329bf998, 0x70c4169cdbd176cf, 0x47d446ac602252c0
+, 0x959e3bb3fe2202e6, 0x796ce96e28c70917, 0x2c91055f4e6bafb2, 0x7637ff13689c3740, 0x6a49fe12fb5c51ca, 0x1c6d527e5964cfd9, 0x8fcfd439fb7fc3bd, 0x1982f548736ad285, 0xc15b6e2ad6112222, 0x0c1a11569e300519, 0xd2698c41e2da263d, 0x4a3e57b7b160343c
+, 0x84d0587b7c3678b2, 0x30d65bae2bef4129, 0xe2341f2b720a8d04, 0x236fd80883f3251e, 0x0e4b1d4bc69f4b1e, 0x37521884deff5a5b, 0x03f47060a5cbe23d, 0x1aef7a48485b6c09, 0xd5c72ea12f9fb0f8, 0x225798f5b68fe26e, 0xddb1644b79084ffe, 0x7fe3d3847082a238
+, 0xc2d9bbfc677efc87, 0x5f2d21a8f6ec9638, 0x2e629661318a242a, 0x6dd9606d9e933b58, 0x158d314685791864, 0x15a861f8c4b7e4b8, 0x26b23be85086469e, 0x7a77df09ec870a3f, 0x7260c1963022e168, 0x26777b2938153f86, 0x3e2f85b9c6500fd1, 0x0912c4a008ba85bf
+, 0x7082a1f6745ba497, 0x1ed598ec434ff944, 0xbbf5b1f34b1855e5, 0x70cebb06ad167bf4, 0x0f44db3ecc6bee2d, 0x70a134658c28ef84, 0x8e7e5dfc4a39e73d, 0x240923867678efae, 0xbb5327a922f20ec9, 0x2eaa94624b9d786c, 0xbf0081866368ecbb, 0x6d5886ea20dc623d
+, 0x7550ba603a9850b9, 0x5eefad653fecc2ed, 0xb1d3360f4e9d2e20, 0x3e23bc1360382277, 0x2e93c3ac920415a9, 0x4dea0db3cc04be1b, 0x1f0ffb491624a21e, 0x655696932b76b040, 0x6c508ffd1f5cb1d7, 0x639d093af7b847ee, 0x54dc3eda16534db9, 0x0c5d5f75d92550e9
+, 0x7ff63da93bb749df, 0x427bc5debff2cf45, 0x0cb9a002a562ce33, 0x0e956e09ac55ff21, 0x0e938b5cd083a6f3, 0x6775e12950a9fe84, 0x646989f9857aec1b, 0x0346ef98aecc10b9, 0x42e8575e0111b83d, 0x4bf7ff662301e95d, 0xbb5e08b5d8f6d7fa, 0x3c1ca201b179ba23
+, 0x13b0a9513cfdc289, 0x57a66af4680820ac, 0x06d5caeab67fd6ce, 0x2332ab3f684d1de8, 0xfb64ff997898121e, 0x005dd6885cd5f04d, 0xdd7a646c1cf79cf6, 0x38fda02ac7bdc24f, 0x3bac20180080cc73, 0x45640f691f05b322, 0xb2e9cdc1838ab223, 0x49febdc171cde024
+, 0x9d9b6c151dbceba0, 0x3f16a1b934f36db4, 0x86dbf0eaab9443e3, 0x1aca1115a26e2cf5, 0x25d4eeaf0e3ca603, 0x699baec8cee57c12, 0xfe2363bd07ed99bc, 0x3afc788500e75482, 0x402e48a36b673cf6, 0x4ea699222f7fdb36, 0x4fcc42a1792164cd, 0x2fd73c2ee826c78f
+, 0xd129b8d97869f7ee, 0x5794148ddf3e9d8c, 0x7ee1e9d9b8890f8e, 0x1057eaba7ae92fbd, 0xcebdb4f0d0e7360a, 0x59f97df1ec5a4e99, 0xee2271072c3da02f, 0x4ebbb35b8ce6bac2, 0x90e0ee1ee8675eb8, 0x533416bb8fe054b5, 0xe1ed591a8104296f, 0x76797a94bdec3681
+, 0x174d5de93d9a62af, 0x5378ac6421a85f19, 0xff87181e331baf3f, 0x290643b219af1ec3, 0xc12eb8fb1b579d58, 0x1a37fae3492e5870, 0xcabdb5f1b49bd9c4, 0x297cb70ffd396e85, 0xb12ae7358ec08914, 0x0618a4eeade81f88, 0x6266b0cc85c98b7e, 0x1fa9ce96b708cc49
+, 0x81def8b1f4ab80fb, 0x0f6c7d1f4c1c050a, 0x753de027dcf6c15a, 0x498315407b56bf5c, 0x516df85993a13c07, 0x135a3dec975f897f, 0x2a43f7e99f95c75b, 0x3fdf71b75363a5cc, 0x899c8f4cdb7ee3fd, 0x09ddf2ccbf3aaf06, 0xe324e8b30565416a, 0x1dd9307b0b53af16
+, 0x3479a36e0c19860a, 0x362e9c4d4578f4db, 0xe3595586765e12a7, 0x2c2e83711a1d7309, 0x1b2650dc7b755067, 0x0e39aaebf21c2149, 0xdd70cb4694adb423, 0x74953c7efe13b7f5, 0x8dcbd2981fc6a457, 0x2281401f98790fde, 0xe0cbe4d67b5946fa, 0x1b62e9332e908b59
+, 0x4c596821a05272b0, 0x072ffbdf5a9d9d7c, 0x7094fe757e247425, 0x6ffe246c45e2889e, 0xa7142863afa49f2a, 0x7daa2963bc74d717, 0x3ccc6d558bfcddda, 0x053d8f191750cada, 0xfb2d668f54bfc99b, 0x0f80f1a85f010d2e, 0x201eb9bdb8332480, 0x1c0827724fa84bdc
+, 0xd16d88b4a88f087b, 0x64abc401ec064289, 0x17ccc457cb4abe95, 0x0bead2dd54725bc1, 0x58bc453eee38c5e4, 0x34cdc6d9677cda50, 0x96788c172815224c, 0x729047dcf27b8c1f, 0x039689379ccb4c7a, 0x6632c2d0bebc616a, 0x6e027c0179d10eac, 0x5cf7e9ff6728fb78
+, 0x832e3d16f9e5932f, 0x7a959366b1197616, 0x93e3990605fddff7, 0x44d4bd0561ed7840, 0x4b2db32a52d1318a, 0x5f35618fbb183048, 0x04f7cbaf783e19ef, 0x266cf67e96febaa7, 0xad074a2dc972207f, 0x33fa841e98cec690, 0xbe50d7c85741b2e9, 0x7f6bc17edea469ac
+, 0x3f9ad668c74f3a08, 0x50ab88e17d844dfb, 0x963428af05671d1e, 0x4137b172cfa71d27, 0x45bb8807b4c8532d, 0x2a25f4705c0023c1, 0xf8dab215d9b2e83f, 0x3eb013c10b37552a, 0xbb5f635bc420f102, 0x2424d0f18732e093, 0x8beffc1431f876e6, 0x642a3c36de8ac5a0
+, 0x5ec94342a8bc8054, 0x2e4f161128616ad3, 0x4feced31c918a60c, 0x496621e925904d5d, 0xa422658f0d4b3510, 0x3b60405e66b50d14, 0x919e9fff636d6861, 0x7405d0e07a9b3db8, 0xb37edda894bcda56, 0x78d6f9bd9fe5e1ff, 0x094489ff61261881, 0x126fc462d9095c79
+, 0xcf38a355fb3cabd7, 0x31001ba76984ae53, 0xc7ca2c3ca3d778e4, 0x5b5c8ec35ba7ae49, 0xae61fd76402fe98c, 0x51e186994f936578, 0xeb94a62a0bb63221, 0x595052fbd5f8538c, 0x4d8361cc2d92aa9b, 0x38280c9b2abe54ab, 0x87d3e6f7dcffcd54, 0x76599ce305eb804c
+, 0xca6dc2e4e267ae6a, 0x7d09edd830df5cdf, 0xef2da9883bca7d46, 0x71435b775590ef8b, 0x3a4d518d973a764c, 0x31110b14d62b2770, 0xbd774fd57952e1c2, 0x7c69ca2de179e0ad, 0x987dc85c3a07ca98, 0x78b09d9755ad3803, 0x34b15e5770328200, 0x717237b54f899b16
+, 0x7a90093ee3c6c84b, 0x419e31c52ebd0fd5, 0x3961e655c349d46d, 0x4bae22a849f7807f, 0x3197da9a98e67fc3, 0x334006675e7c9f25, 0x9459b7e5431c783f, 0x1b0ab3360fbc02cc, 0x490bb21f714e5947, 0x0df77399238ff114, 0x7c81f431d8309b80, 0x214a2934cb6625e0
+, 0x93019c749acba327, 0x31daf20fc4de87c2, 0x7526811dac95ab43, 0x3c5f09a990fb2aec, 0x03e3e7e3df0a12c8, 0x27c1b4e74c5d11d7, 0x1cdb8bac317872d6, 0x4db7a628970e3eb3, 0xae2c2ebe98e981db, 0x64bdfb9902e0993e, 0xb646ac2c4ece4d93, 0x34e2281dc47787d9
+, 0x58d44bd9fe63bf03, 0x268ca56cf2995648, 0xa77d81a913b34bb5, 0x4e8aef481d00cc7e, 0xd4f3996d1c44fa43, 0x59b7ab84e242b6eb, 0xacc0911de2f67d59, 0x120bd6a0a8cedc7d, 0x6d300d46b24b2557, 0x2abc8ba69cd39d5b, 0xe3a96aec99213d8f, 0x485dc1715e897821
+, 0xe682f4f7b0637e50, 0x636094af67edcff8, 0x59424ef4b24c29a1, 0x5421e210ed408871, 0xdf0500611da65f7c, 0x30bc550822bf80e3, 0xf8ba968d2eb70c29, 0x79eea068f3fce965, 0x0080f326013c6ff0, 0x1a776676fc89526c, 0x6b74514491659ecb, 0x48182702f271fc20
+, 0x09ef395fa13377e0, 0x24ab9ac00ba13d86, 0x60aa575b8d55771a, 0x3b33bb22e691bfe4, 0xb1b12fdc5ae5436c, 0x3dc34cb2d3660597, 0x5fddfd942db9d761, 0x209abbd0bac8cf9a, 0x1c26ae538450e7f2, 0x04b23714fed562c5, 0xeee490d11194eaf9, 0x2bb41580258a4eb1
+, 0x0cb453187d655735, 0x003db62603c24600, 0x1100f5a713b5395b, 0x65720b69f1fe2eef, 0xe78dbbb6eecfa4f5, 0x0da362c687834918, 0x940acb37aaf777e0, 0x75f50040c9eb21f3, 0xc12897e895470b63, 0x58be828c2b1fd3ce, 0xad962ae22ceede80, 0x4a25d42268cf91f3
+, 0xdac1fca2848efa7a, 0x10321813c9426f3d, 0xec1e9626e4602ba7, 0x34a3896f6f717f8d, 0xca49ab56ac4835ba, 0x493d78413115285b, 0xc096045f5c2b9c04, 0x77b604724719d082, 0xcb93ebe5d704b656, 0x79e5ab32185c8494, 0xaaa32ef353c8cee8, 0x5a3ebe01b8ece4c5
+, 0x4736d458cb8797fb, 0x0f75a6c724d154fd, 0x1fc9ec78fded718f, 0x54eb7de2803bf045, 0xeb9a2fa4219c691c, 0x2352cc9bf8cfe113, 0x3c41d9a4e925c5ab, 0x015bcbcd0b4d64fa, 0x3e4f16c11b034af7, 0x0403e0821c541d58, 0xf6b4ff7986fdc42c, 0x43e40410a85bb8ee
+, 0x0c989e1bec2c348a, 0x571d6a907b9199da, 0x12d8a9a264a25fb1, 0x2164d6782d19f159, 0x5137555e69805bb1, 0x0ffb45a9cffa0c0a, 0x6eb2437160cc54fc, 0x46f3a7a8c9915e02, 0xace4da068bd5a6ba, 0x7ba09b7f9129c14a, 0x1776d1531dce3f94, 0x3d6340b3b71c9d69
+, 0xc67e2ec10fd86b4d, 0x2a75ed4f316b0bfd, 0x1744b34377d0cb9c, 0x430760b46f4d13a1, 0x7b5cdc138908fca4, 0x165a690caf3dc706, 0x41bdded1efceb27b, 0x5d4e25a85d6ccc80, 0xef255a6ba08d33f7, 0x681b28a92b3005d5, 0xe72ac2c57625cd1c, 0x7d1f1741fb9e5591
+, 0x49d4c825360bc45d, 0x71dc09c8fbb76f8c, 0x5799835f343e581f, 0x70f0b0bcf42d698c, 0xf4c0b441851c4392, 0x1fc66de1c9bcb9e8, 0x974a40891843496c, 0x707849faec7be3c6, 0xc7c4b7c9bbf8df26, 0x2ae293bca7addb2d, 0x6717c56d0237a854, 0x1fd23963372daf5a
+, 0x8eaffdb97bfd03c7, 0x0ea21a58db19b1b4, 0x2617c6ee9a73fefa, 0x36f2968a05b6fbc3, 0xd4eada6182da11ca, 0x013e76120decdf71, 0x6ebdf877327a2149, 0x0a785e57fec785cf, 0xee01002cf4bff143, 0x7077c274b7b94954, 0x79d8187291825945, 0x1f565f8afc4d08da
+, 0x79a8c60f45e5e207, 0x6f4fb21c1d4113ad, 0xdf368745b548541f, 0x4f681b177185f7f8, 0x2d6b6b20042356a9, 0x6f4123ae5f8f8a27, 0xc8823d98d3692e95, 0x4230faadb592c9d8, 0xee5057d948f35d88, 0x15ce379b8e198544, 0x4a38b95dbeeb77df, 0x2929e6737746386e
+, 0x80990dfcca318cd8, 0x0a44312918082983, 0x842016dd0e8a1377, 0x2f2f9495e13efb9f, 0xe8cc64f6bdcb7a6a, 0x267748874eed8a9a, 0x4d877e6099a45bb1, 0x06e99a713a35b39d, 0x6766510324d99c16, 0x07b95725c0a6498a, 0x3c4b40624750c02f, 0x6bf18d2742116fca
+, 0x55a0ed0114b910c5, 0x2f2e1a9c04b3cccd, 0xdd5501905988c2a5, 0x6a6862b579925bd1, 0x837793d4e0b32f25, 0x3db1e3565102c5fb, 0x0a73c8e7daf70e5f, 0x43df3626e4e98f5b, 0xc2452638894023b9, 0x7ea5f4b75190189c, 0x62c09aded3e961de, 0x759727e7faa6bca4
+, 0x77a9e8b7d0595e82, 0x158f46d030acc97b, 0x47e9ecc910d81c7d, 0x47680361c5fb044a, 0x9f9b776a2d5b6f65, 0x0e9ec3cff27e9ec1, 0x48d4c5840833c715, 0x01a93702c62693ba, 0xaefc8a7c6a57806a, 0x05278f7ba5d2ccc2, 0xf0c4ad5ff3b31d34, 0x476d61eb1251a19d
+, 0xc368f13af55a5c98, 0x73abc87f93fe4cc2, 0x2eaafaef57376874, 0x233ea78c6653f410, 0x507af96c111c2c87, 0x479c58edfe658d8e, 0xdd04ff402c9b56bf, 0x13d6e56c2f803ff6, 0xd44fa43d736f37bb, 0x6726c82dde032c18, 0x51806831af56c458, 0x2ddbf71ea2664c5f
+, 0xb1e14a27298057d5, 0x18ddb7890733b474, 0x83862f9185c7d014, 0x7f3e399a7dcb0976, 0x56136b29f98ef705, 0x4299cd53b45196d2, 0xf69cff1f3e2847da, 0x0a4245b6f39c972e, 0x201d8748a8adcfa4, 0x72f1ec2cafb1e0f0, 0x98b36c891452bf01, 0x06f61bde3d8a0f7e
+, 0x46a61a4d9ea46365, 0x7f08f78b97c747f9, 0x0690f7322c969d63, 0x739d9bd13513c2a7, 0x5cf1b17c806b08bc, 0x565bdd939af52e60, 0xedebf6b75c7a988a, 0x42205510388c8071, 0xb01c8cf901fda8c0, 0x529f60382007a7a7, 0x5524911c3f9a2eb5, 0x1489aa31df245c89
+, 0xe07d54537468efce, 0x58accd2b37e73a10, 0x995298160b5ee083, 0x6915a5e93f3e6824, 0x552be70b707d8686, 0x0a37e32744552c2b, 0xa82cea90976711d9, 0x095b6d05d2dc8714, 0x6579dda9e2b64ce0, 0x5982a6cdfd4239ba, 0x663ca80762760108, 0x3eb62bf2634b33d8
+, 0xb63b3a12cacc00f1, 0x1c66916326e17de5, 0x9f5892f3b1b1e559, 0x138bd5b841586386, 0xc55ccd3bbaac1d34, 0x201b83afa0c51ed1, 0xf1394b8e74bcbd49, 0x660ac70b8b35d011, 0xe4072ab7b171277c, 0x72bbfed274d47e97, 0xb6de24ba83905c1b, 0x5222cc02b29cc675
+, 0xac921f6812dd21ec, 0x056fa11a00ce1be2, 0x620c297e8af33e11, 0x4ee720f157916b2f, 0x071cbc65bfad2222, 0x633049d4ab942294, 0x5dee79500087ab31, 0x090f931fea5f441b, 0x697b7b43316007e7, 0x64b803e58bbdbe9c, 0xe0377841accb2621, 0x335d66e09e7f6da5
+, 0xf0071df792275a2a, 0x3d3e7e68338f96ef, 0xa8fa4101bbb8e8f7, 0x02daa9c6f71da301, 0x4e3d1ce27314eb15, 0x466df8b7561bbdc1, 0x13ade409c89eb68e, 0x0a7941a9c57ac5f7, 0xa899129b7e0a091e, 0x34acd850e4b3f42d, 0x1edce52ffe4bf115, 0x7032e4faa0845c62
+, 0x3a92e4939e458245, 0x4b274e49eea2e227, 0x26d09c77d84f1213, 0x3398292c9a632d3d, 0xbfa30519ec1dae85, 0x2eb9cd908d042bc7, 0xed4d4f8c54338b30, 0x73dc8390c8001a56, 0xfb8ce35dd6d44e2a, 0x0cdeb4fe09dd2367, 0x79817bc7c9b9c705, 0x5fb171cb1ae53b53
+, 0xaf118ba26785c115, 0x13d106501ebd1138, 0x1484f6175d938537, 0x068d9fe7c7584d7f, 0x1c5dcbbb64fe5f48, 0x5c4c385b7c583155, 0xf356684c7974fe51, 0x06c285b3805bac4b, 0x261818135323d7e7, 0x14960e1d26771e8a, 0xe18a92150c8f2744, 0x0ded23d75c111e4c
+, 0xbddf8e56327e1dff, 0x40e501e27dd279c2, 0x7f7d0f3b96787787, 0x059e410775ace7c1, 0xb303a9d660ce11ba, 0x30fe3cfecf0e23ba, 0xd2b11b0d1c54ef6e, 0x5abe2bd9e49d65bf, 0x9f3b6d4206b0200b, 0x70f0cc4b2d430cf9, 0xdfa7457753df5dea, 0x436f82754af4d19f
+, 0x05a27058bda28cda, 0x4dd8a8648e91df7b, 0xf25afb0c637128cb, 0x652955c59f88bfb6, 0x2822ce82ba3ff9b8, 0x27f0cca346b8a2de, 0xa6396c5f783d23ad, 0x39c04990f9a8e8b6, 0x261839a5132bf132, 0x3a298080515ff325, 0xfc404f700e70b063, 0x61103b06826f9b4a
+, 0xc0a6b4606b001062, 0x2339273726272a0c, 0x060005935df8226f, 0x4dddec0c41f785db, 0x426775b334f2358c, 0x343653bedacf4309, 0x32a855b125f13fcd, 0x4b090c136e8df4c0, 0x808dbac16a36e1e1, 0x16749a8adb6917d5, 0x9784cea81c239e44, 0x3091d05eb967b512
+, 0x3e8f0a46b5ba1a1e, 0x67ccea5f3d1801a9, 0x6ea127e13a44ebfd, 0x04d1b03adc836c4e, 0x4067433855d56154, 0x7f87d31bd42b42e0, 0xd91a1871615f10d1, 0x355723897d89f29f, 0xc217cd8d87085d0f, 0x5eebaf4ef93c04c7, 0x9deecfa5bf78ecbd, 0x541922d362e98a5f
+, 0x86d3fa9b1052b4ad, 0x6b0477657fe080ea, 0xcf99e9e7e6e5c8b8, 0x72f356d79163f844, 0xdf863c20d1c96e40, 0x3618a3664af73d12, 0x9112b035d96d260e, 0x4a877c02f65a7979, 0x8670b88caddef497, 0x0d8a0343cc87794f, 0x0be3d6c46e2f3e69, 0x4c6ad100252e37af
+, 0x8679dfbbbd017644, 0x4a3a219d65cacd77, 0x874b516db72b35f0, 0x0a78f6cca280eeae, 0xdfdd482f1c4f9113, 0x442d969af9d9da4c, 0xa91185c51b18bc7b, 0x444d850f8fb77481, 0x1fd536fddcac539b, 0x597472ffbbf4ace7, 0xe6a9adf30bcb016e, 0x16270e689e0135a3
+, 0x881ae57eb6846113, 0x1aa62f5893cf72e4, 0x7fa3630746bdebdb, 0x37aaf035bf4ef367, 0xef670790bfb23ab2, 0x0a432f204f9355f2, 0x2c87879bed78331e, 0x394ac0f9af201c97, 0xed570dd79c5fdfb3, 0x116a834938ec6f62, 0x2c68dd9253798c15, 0x50b97e012e4bb6dd
+, 0x148a7690740878f8, 0x7fa2b91ff2522d22, 0x785faf4ea0717a50, 0x2b0f40a384349ee0, 0x259c5a591aa48bf8, 0x5097b441d3c4b2df, 0x6da474fe987358c6, 0x37445610ada9dbfe, 0x761bec8d049a473e, 0x472253126f3a578e, 0x3df0dc42d0a32059, 0x547a1939904450a4
+, 0x5d217eb253fa5b02, 0x503ba3b0ff0e6bb3, 0xfb7c299028670282, 0x2bfbf9f5733ffc80, 0x61f34737d2a8afba, 0x5a0d2aca28cb0ffd, 0xa6edbe4daf5bfed2, 0x151aca6e6681ba47, 0x10650fb3c838a56d, 0x46082b00bd25aaee, 0x11216a8f464747b9, 0x4aed760f9f43b537
+, 0x7f848aa6c05fa552, 0x302431a314b4e103, 0x28910a87548add8d, 0x1d853c4190d6e576, 0xf09cbdbdf92c3cda, 0x466cbc4273a48107, 0x78c3f0eee1b8a611, 0x531d913718bc8d84, 0xfbe06f68a2fe06c0, 0x481b797836f0e152, 0x9e619b8ab7e83de4, 0x6fe2a84d0cd30391
+, 0x8add56ca209cd92f, 0x05cd299a9724de7b, 0x7915d61cce27aaeb, 0x1c6edbd3d86a2175, 0x31d9d1813be81c71, 0x741bdc88408d9b9e, 0x6b79f889a237358b, 0x3834ca91e8c5257c, 0xcc4d9b7d3a0c1b00, 0x7af09ee8f603446f, 0xae8b743fe5540f3d, 0x52ce3ac88a4045aa
+, 0x967ad6f4e74d4730, 0x4ab94913c820433b, 0x9f4f6f79ce0fa78f, 0x672807541f9abf24, 0x8bf3857767196eb6, 0x02de4aa449d9c220, 0xadd020d75c7330d5, 0x04764cecdbe222b5, 0xa5f317ed8753f136, 0x4fbeef6330249e3c, 0xa7a58c325bca70a6, 0x5ab21210d06a3950
+, 0xf7d6ddbd814e8e77, 0x64ca6dbcaef76ccb, 0x7138ff032ccb86fa, 0x1f905d05aff92455, 0xa2f2ac9e04b230ae, 0x6ccb03797c1d442e, 0xff30731f0f02fe9e, 0x4b08203709ee9e31, 0x3701b879413fbc3f, 0x44baad10cc3d4c52, 0x32bdce83c5506737, 0x25cb33cbc340d5f3
+, 0xaa508b77d1d704a6, 0x128c79d339e2e565, 0xc722ed0dd87737b8, 0x05647bb008e3a559, 0xfd1d2f3b79e776d9, 0x3af68bcba6731cb6, 0xa5e5fe0dad9904fc, 0x36ccf383983595d4, 0x9eb80047d618e945, 0x39241507363bbdc7, 0x21483712d7f2ed0f, 0x3a2a4e8bbb0eeee0
+, 0x77e0ad2b3e4c9434, 0x46ecd039b9b9df61, 0x59745fe9a2643338, 0x2bd7722f5e5b79e4, 0x4d9776a52bd0251a, 0x686f070f5a9efd25, 0x46d0daecc351d420, 0x7a6a77524572c781, 0x1be16dbdb96aa043, 0x04c242a7522cf6b7, 0xdc2093040e410894, 0x57a0278d854d1aed
+, 0x35c193fd86dc1915, 0x4642078b5f87ce0e, 0xe86cb27e4b958ce6, 0x1541c88de0483684, 0x478d6548565fccc6, 0x3f008eb5aa00c293, 0x6cea8827423afb82, 0x347e4be2a50df8da, 0xf38ebf209cb0a531, 0x470b79143fba0264, 0x1ba1a2bfe7616535, 0x7108b054d5e78c5a
+, 0xa7dfd705e39046c3, 0x5accd6ba89fda890, 0x37d6c81a81fcdfc7, 0x3e4010d0850c80ad, 0xa54a4b622142b2ae, 0x05c67a13c15148a6, 0x5a879de1914ccb30, 0x7ed55164939185bc, 0xcf9b7c4f7a49338c, 0x52da3fff71b07b59, 0x9337d868aaddb805, 0x3811177ca10626e4
+, 0xd1b2cf65feeb39b6, 0x6d8a488666a4328c, 0xda037cc845ae0628, 0x1111d9f237c691c6, 0xb19869b18fbc7772, 0x5f6d9c0da7347497, 0x9774a6186cab345f, 0x777033ffede38ceb, 0x96a6124c7c4e9b89, 0x4c41870829eb287c, 0x0f2dac3e85a52668, 0x63362ae7bf14b29e
+, 0xf2d685f24db69082, 0x30c71e12a4534377, 0x050ebc9b30ff2801, 0x7fbaba760f04c258, 0xe69352672657cff1, 0x2e81d89499e766f1, 0xa1076d8f9fcfa113, 0x44f75651bcd4368f, 0x498763a8070f8ca9, 0x4110ce47cc98b380, 0xd55590e23bee2d78, 0x5d3a2d7b8e1bdd8c
+, 0xb147524ac88a0c6b, 0x17b3c5b025a08375, 0x25ef035cf59f1c61, 0x228d2e1dbaa33373, 0x7945c0e74456e0d2, 0x3c147ad715ee1232, 0x4db216bab42700fd, 0x2481b34a90cf5a43, 0x972cce465992aa4b, 0x7e1475cea784645d, 0xeb0a3d6d392ea4be, 0x074ffe008a40b80e
+, 0x550d9aecd188fea9, 0x215ddec3e0d18962, 0x3ad35db6b147265f, 0x2701818e5ac9489f, 0x1c9a06913255fc23, 0x7b9b31bdd5d8ff3a, 0x5aafe561e8838002, 0x464824753bd05911, 0x944df11abde508c8, 0x2be7ff69826c6075, 0x100d97ab8971c4d6, 0x0217df7783bfd754
+, 0xa2aff985de2de726, 0x153c27a7727d779d, 0xc21e354d8bfb3307, 0x7973193f99128c65, 0x41f17922eac911c3, 0x61d7a5d976162d5d, 0x56c1aa555ee08c4c, 0x21c86d73c5b4f97b, 0xf29e16ec50ee91d9, 0x23abb1fb3d6cc07e, 0xa5f441780ba8d992, 0x04adcb76f1573720
+, 0xb8a0599344d4c26d, 0x008206813ad2d6c4, 0x12a2d65bcaa6ab94, 0x4787ab5bb61e3d4f, 0xbbb69551652e4322, 0x67371399cda85c35, 0x9dd146ef6ae23e19, 0x29cac2aabda66934, 0x672808ab14990d02, 0x54e61aaf338c6589, 0x9aa988725f10605c, 0x7e12ac76bac91a4b
+, 0xf98e2686c485a7fa, 0x3be07604ee0b3610, 0xbd6bad4b9371bfa9, 0x145272f6b7e8bdb5, 0x2b987864a8db0ced, 0x3c582c7efb425353, 0xdeb1b1d5d1147e62, 0x074229cc64a4377d, 0x344e7ba07db7e9ad, 0x46a91051e570f735, 0x925f1f875a936503, 0x77c0deb8c857804f
+, 0xfe5c834514acfe36, 0x786008a48d0b60e9, 0xcfac6408d1fb7edc, 0x1f0c687c3f187a9e, 0x4c04f3d39de226a8, 0x5f2d9b292e8aea6f, 0x802efc718e5e06b3, 0x376f2be14844cfd7, 0x20cd78d44408f84c, 0x31338cbd82206e94, 0xf9a11ba893b00e38, 0x1d06ca0cc779885e
+, 0x67495fbbb782b526, 0x513f1b0582e3e285, 0x4def1b4c7cbbec55, 0x7daabc0e97364d85, 0x8abbe470f3ca5b84, 0x0b7f246da5635d26, 0x6eb1d868393ef26d, 0x470a52cb1b3f82d2, 0xaf6cdcfc12e661c2, 0x1389050ae1379bf6, 0xd19c9a6b98e5da6b, 0x1eb615958d9f6bd6
+, 0x23a0970640c5d8bb, 0x65eca06708c1b4e6, 0x4a8c5064e1e9d551, 0x1b90b978172e97f9, 0x2944fcbdeeb378d3, 0x298ef36c2ef0bc93, 0x7f02a0afbe1f8590, 0x5871e45676a6cc66, 0xbf2af431085d2adf, 0x30d5772849e64c20, 0x9c3ce0f539918d8f, 0x34f9331f8edd64e9
+, 0xf341be1b2dfb71e3, 0x38ea6ffe3250ff69, 0x2ff4ac242ea595c2, 0x68ba10ae9ef4d10c, 0x6648b88688367bc9, 0x45d4761b8fa09950, 0x3b43f59b5d35f945, 0x48f2e296db0a48ee, 0x8095327a89ce268a, 0x24658352108cee88, 0xc5ab9ef6ba73be58, 0x339c0d0b2d7e5a6c
+, 0xa1760cc0e714ff85, 0x7ed7fb4de887eec4, 0xda4634126ae5061a, 0x1025ac8519718ec0, 0xa6381263d8558304, 0x39d44ad819509847, 0xe98871a0c28e393f, 0x42c2de3c8c5007c9, 0x8c8e7b78c5562652, 0x56be2bb06393b264, 0x0a3ddcbb398d5185, 0x6c7f66876e0153ce
+, 0x8467a097cbeb519f, 0x3a2ee90dadf8bd6e, 0x3b4ea3c69e844798, 0x6520c85aa970a967, 0x27ae5d7f6e938dc9, 0x1d64f523ef772b77, 0x7d7af74d40e45565, 0x7efdc9277b05bdc5, 0x417d87865af7aa39, 0x00c49f1b05c8d592, 0x6b0b62e401d047ac, 0x11e472d55d15f666
+, 0xfd4968930cc16689, 0x24e02d0abe876cb9, 0x7f1a35bd2c6ab56a, 0x3d0ab05859200d5e, 0x0dab7b15cd7584d9, 0x593c68a1054ec89e, 0x940c2682252d3339, 0x31718247c613d38c, 0x482ca29b84fea0da, 0x12c710192d4f903c, 0x50c5edf82b81b635, 0x1b39830d98cb873b
+, 0x6ef3dbb330c12e62, 0x0b33ed7e3f4c91f2, 0x7b6a599bbd04bd54, 0x2b6be3982e029313, 0xe5936f7c0e792bde, 0x60dff6676ecabd14, 0xf96338f54213afb6, 0x1370147ebeb6bd0b, 0xa01e5065a48e2f52, 0x5b3d3c2edba5bbd6, 0x385c599ab77062a0, 0x5bb7d22ccda8ee61
+, 0x6bd6bd694de33e31, 0x04074f30cb309005, 0xefd92f546c68609b, 0x32393bfa48dbd808, 0x194bd7c129f27df2, 0x20c46543d5cc4792, 0x8ae61b67fe256324, 0x12797a826a609a14, 0x2849f79e47fbc667, 0x3af5f47a2d457db9, 0x67e206f94161f1f4, 0x588b762377de59f0
+, 0xfbc750b5e93883cc, 0x2fcc76fdf0f289e1, 0x8fa8b25a2af97b3a, 0x16d8f2e1011f7c9c, 0xa9cc43fd3bfb8412, 0x1cd7334e6af17f72, 0xf13e08341d1fc51b, 0x35bc5ad323bc14e6, 0x9ba7a8edf25b4be0, 0x4e8cb0b0a76342b1, 0x2ed01f96523fa894, 0x065be49a4a925e4f
+, 0x18529642c49a326a, 0x2098b4aed4715fd4, 0x9e1c3cbde4b6a2db, 0x52bbade3be9eceb9, 0xdf8dc17987bb5eac, 0x558c7d6084c4eb12, 0x935afacc497d890f, 0x090d060a9edf8e4a, 0x6535de533d2e396d, 0x310f9cf668e07b21, 0xf20c4261a45fa930, 0x2269a13fa735abcf
+, 0x740d32378f18d8a2, 0x355914ca7d47801b, 0xb13df0e67677bfba, 0x0b1bfb88bdd4ab4b, 0xaeac84222a1f4537, 0x554be35f8b9d7278, 0x4dd206dea899d8c6, 0x0f056ebaa7006880, 0xb107ae88ede0ac0b, 0x054fe515608e54a2, 0x4bd36953bf92f1a4, 0x1960fcbfea355c8e
+, 0x0675ffb6412baff6, 0x4e35abea11e52ca3, 0x3f985d913dc7d7e8, 0x26d12b3502c50eec, 0xf3268da2fa84d120, 0x5adad3d10b631e48, 0x92671277fdbd2428, 0x3c7ec45aac0a5dec, 0x5631714fec11cd53, 0x20c89340fd8793b5, 0x1398e7583c62a51e, 0x7fa3fb67babc5d57
+, 0xc5309a2abdb9c8d9, 0x38f753f0395dee51, 0x708a27bf4fb1f44a, 0x0fe5d6dfb7e0b689, 0xf21c4c211bc962e9, 0x46acc881abf2957e, 0x81ff693f19b6688a, 0x27f087c1cf08e63f, 0xf838303e5f5de0a3, 0x734b7b461d3dbd70, 0xe0ebf603b01981fc, 0x1c6b9e7f8cce4378
+, 0xbf2317813ae3deaf, 0x641168f2f634642e, 0xeb78395951ae51d0, 0x00b2fb7aa15e48e0, 0xc8bb53280f061a08, 0x43a22f46f251c06f, 0xd9b127da6d38aa03, 0x5467ec2851b46048, 0x01d74e874be891df, 0x424626d7100df2ad, 0xd0f58614f81fc587, 0x6f6a1b5ad469fb6e
+, 0x531af644f20fd29c, 0x155a25f7efaf6e1e, 0xf8de60d80c234f8f, 0x14c19a7b1dacc476, 0x58f35b82aec569cc, 0x4a4479ae04c471a0, 0xa0870502aff3da42, 0x1d61e5f706002a83, 0x77995d1ffd38c22c, 0x4a0920b2401dab8a, 0x178269dd6569bfe2, 0x096478d8de266bb7
+, 0xac5fb653d63df828, 0x1919348c1f854c9a, 0xcf2cf778db9dba9f, 0x7288c6dbf8b4725f, 0x79a33690e618d888, 0x354340b79b5dab49, 0x133e7efc17db03fe, 0x78112b5aec549c94, 0x310454e4acef8428, 0x392aba79d7c350e9, 0xa95a131d0319af66, 0x196a3805ac5307b4
+, 0xa33fa23c510266ba, 0x27c029061e07cae7, 0x2a707c8830bb6385, 0x21df12074856c32e, 0x4049b420567ca92b, 0x6ed7ed803f7ba1e4, 0xfed8aa1bb3c1df35, 0x012b30d9352beecc, 0xfe7198867e26c111, 0x4960333e8900904a, 0x88a4e9d02f615f75, 0x23f44cc113a8c19d
+, 0x7d837195c01fa205, 0x2dbc91ab0068b541, 0x5243afbf9bcf231b, 0x2ca0fdacea47e0b5, 0x79d3d0b0b636268a, 0x4d028829ade81059, 0xeb62b07b07dda090, 0x451db2150da63f45, 0xbf39535fce56471c, 0x72c982d6b6ed2a02, 0xd4804747aebcada2, 0x5bb092e0bb186f17
+, 0x8187be4e20b3f390, 0x5408880d716808ee, 0xb32f0de995c3ed33, 0x78fe4e5d6b7ee348, 0xe9b4271b9e87b79a, 0x2005d468fadf690c, 0x747b61c8ae4dc9e3, 0x0ccd32e8e6263e89, 0x1797dfdb1361008d, 0x57bf07fe842144f3, 0xbb490b110ceb210e, 0x326727f9014c72be
+, 0x501faae43172e633, 0x5b4f2ddd3caccfd7, 0xcf231f5440bb86b1, 0x4164439e0170b229, 0xaffad77075df5bc2, 0x1f96deb9fc73bef3, 0x941d74589e607aff, 0x2aa9c997b6480065, 0xa06cdb6608279a2f, 0x4d45f22805c5a52f, 0x5cfc5b1b189f4cf9, 0x3157aa29e6884f91
+, 0x4fe696b36e3e4d00, 0x500e3b3d74955baa, 0xa86fbd9648a2a335, 0x4a05a62e42a47ddc, 0x7f9e59b681fcca02, 0x559f1f76c315f3de, 0xca6264dcd2423ef3, 0x60615ec0f89b6863, 0x835af5849d15ce94, 0x3038a5c5f9e46008, 0x60a56b540e946f33, 0x46a1e55f7ca61b43
+, 0x89e7a1fc353fb9c8, 0x10cbab495398cf31, 0xa204a711814f39a0, 0x5b6edb5c1db50883, 0xeef892309954c40f, 0x0467355815912469, 0xde48e0cfd3fbeabc, 0x4bee7a31f799da87, 0x44b78da0ec77a2ae, 0x3ec9477852229876, 0x8125e06e6f3b227b, 0x083001ca0b17b715
+, 0x6eeaeb753ef99393, 0x122b738cea3bed4f, 0x8459099af0700b9f, 0x0e761cd2a98a51b7, 0x74d7119829bb9a9e, 0x35b83d10ee38170c, 0xb0ba3eac364288d5, 0x5470828a1ef2e713, 0x607edf4d5bf5d4ac, 0x578e0f585c0f940b, 0x7ba541a76660ebad, 0x34fbdbf1b25926dc
+, 0x893e1f7f2ae29a31, 0x510d82955524ac3c, 0x5a5b9228404eae7b, 0x72ce4deaf4bb06c9, 0xbf331f23a9bb509d, 0x71dc902e5d45326e, 0x1eee3b808e6d1bda, 0x3605705867eee54c, 0xab6003ec2835e6e9, 0x6b3ad386ed3d345b, 0xf03bb753cd9a5f22, 0x3e22aa594cb5c1fe
+, 0x03fef4fd2a313708, 0x1c7d2caec1e9e55b, 0x6783c80342d1f777, 0x2a70aa41453891bb, 0x6b6f0d396e2b27b9, 0x250864939c08b660, 0x178a038dc4c47c26, 0x66ad11d8bd9de157, 0x015fe1b80ea3858d, 0x208758867df32be4, 0x7d07e5d0e9996a63, 0x56bbc2f0ba5f898e
+, 0x26112bfdf5583e56, 0x5c8a9bb470a0772b, 0xd4bc7b723d089266, 0x5d481e4891750453, 0x6008d12dab956321, 0x702bf9a35c0e1eb1, 0x02166a748526b58e, 0x6c1297e1eff881fa, 0x5851157d674a0885, 0x4700f4769fe2f99e, 0x2c3713e23f78857a, 0x2ce0918e16785cd6
+, 0xc9b6f68355690031, 0x335b3121241353ec, 0xd40ec673d565d328, 0x7329f3e4ba7b85ba, 0x2b5951d64fb6ae32, 0x7047d03f72db508c, 0xe7596b980a588f21, 0x57799e7191de13be, 0x63aff29d374666dd, 0x0ad23a00d94970d0, 0x133c00963a183eb2, 0x446626a39854a592
+, 0x95205ec9d48404d1, 0x47b56828b0de8236, 0x4dca3b9addcf6ed4, 0x0e0ed717d9ba6087, 0xe77f74af82a80f35, 0x2385f3aff50f14d7, 0x76c318044ce2aaed, 0x2f83f4d45c4686ea, 0xbd156c61d76ccc99, 0x097bc3376e12dc75, 0xe0df0dc6a60be6fb, 0x0ce57021329cddb7
+, 0x746598b6c782315a, 0x52abdc1be9543aed, 0x42af38fffc658118, 0x21d4480e4193da76, 0x8d436bc87eb0cc2a, 0x7398fae05b38cb28, 0xd35956a3f76d669f, 0x744ed40f21cda7e8, 0xf5fb3827e0fd8741, 0x45dc1ea63fa11cbd, 0xc42cfe89af87f1ba, 0x6f6dd8fd114d2073
+, 0x2f09d9a89afa608c, 0x7847c33fc1079445, 0xc97f2839042f8fd4, 0x017cf4cec4e29a62, 0x7b29e5bdee09c43f, 0x6fca9aa7cbca3817, 0x3fd77834e1d967da, 0x7aee3610869d321e, 0x65a60139f53f84f4, 0x5c74da85e48d8ea7, 0x0047d48244572a3c, 0x38e8cffcd92f369c
+, 0x484f52bd5e979563, 0x2e91a8f48b51806d, 0x28c0de45c4b1a651, 0x32de684fea625258, 0xe10cc27e7a1f4be9, 0x21b57b0db4a3f206, 0x58ca44afb1bfb477, 0x4c9748802aa954cd, 0x2a60bff5bdaaffa7, 0x2884a34377743b36, 0xf15729702007cdd8, 0x4d65fe5fda9b626a
+, 0x56aa8e1fbce87d88, 0x2b5a8637a5598ba9, 0x8f2ca7e84d5fc340, 0x3c00127573897e3b, 0x870e438daa50c189, 0x3420e4135cbffd6a, 0xbf29e1a2bb1b7782, 0x005032038783fb1c, 0x58f164a812dd5904, 0x06625ddf5a19c5be, 0x113afda50c72fec9, 0x4d6873fc1ec02bc9
+, 0xe11e73fd0574ac38, 0x535f8f966c00046b, 0xebe7c2ec1975e55d, 0x052360324369e26c, 0xa15dd190eb2b5b45, 0x41638689253bf028, 0xdd83ef786e652e66, 0x7498db655c916f25, 0x9daa1ee1e522ba35, 0x19ac96148fe5bab1, 0x299abf7143c9ccd0, 0x1ef1e5c8c9a79407
+, 0x134215033db3b2dc, 0x23d31d598229d090, 0x31a50352ff0f8cf4, 0x76580d31fcaa2048, 0x8bef4b3e8f804745, 0x1aecb2fbead20bc5, 0x95435985123ae1f4, 0x6b69b07ce3b06c79, 0x60f8978c8d866ee4, 0x056e21bace7dfab1, 0x39468cb79feba991, 0x47ddaf3d721ae835
+, 0x41eb7cb35b0e797a, 0x1c31e2f2633f2f2c, 0x48aea09d8cfe5d39, 0x213c05ce0c30a570, 0x730e4141272ac479, 0x3aa5847e2a3d7242, 0x978a16770fef275b, 0x7c74ee480c452e1a, 0x79ef712e478e966e, 0x1a3e067ad1cd1047, 0x5e36ca3673567e19, 0x26ac11a77d2e4fe9
+, 0x8a2d39cda52c5739, 0x26f2b5e723b826cc, 0x458055d679c7d0b7, 0x372b2343baadff98, 0xdcc114a79c0b9a70, 0x7d5d24ce3da3b365, 0x6daebe2c829519fd, 0x744fe83aa69d6cb7, 0x483990f0164b349a, 0x0f7d5f6c52ff9356, 0xa5ec58908514cab5, 0x49c8109657b38e79
+, 0x1e9b88b14b8bfe25, 0x24f325cfe5d23359, 0x5e0923884f0c1750, 0x053f1decd57ad63f, 0xe1a70de841684470, 0x4a0cfbfc0b6d4660, 0xff34059b32e2eb36, 0x330eab2ef81763a8, 0xdcf81dcf420d1c00, 0x679a2f25ccd74d2b, 0x4e15995e29fdec77, 0x2a6f7064686c56f1
+, 0x9396b4ddae15f0d1, 0x57af3a89eea848cd, 0xd40f2474d874787e, 0x0ec739c6862a3685, 0x8db56f4ce724fd25, 0x41b048c6c69f0239, 0xe30da45c30f7c732, 0x6b1c640266d59a63, 0xb32a89901bc1d774, 0x7317f43bcea1b135, 0xeeb5de7204815720, 0x27b09ca05f6109f6
+, 0x5809f764c8db0494, 0x3c595f0b6e3b8eb5, 0xb65f9757013beffa, 0x674f794623597dbb, 0x07aef931833ba453, 0x6858742a58333441, 0x8220a8d07ca7e1a4, 0x21df98e05aced1e8, 0x41d18b187e0b37f2, 0x3d1fb432e12614d7, 0xe2c137a330de5bfa, 0x4dfa89b009ff3e1e
+, 0x333aee90651d5f6f, 0x48fece8cd4f24247, 0xbe53cb258cec813b, 0x7ea54b3b44441556, 0xad8c52c73079865b, 0x401073254482d695, 0x6d858060f2bcefaf, 0x7b6714597e6494cd, 0x738cad39d8cde2c4, 0x4c5c782988fbe51f, 0xb0bf42370e73c946, 0x4aacd4f8cf0bd4ea
+, 0x6377335327d0081a, 0x59ef8809c423faba, 0x82773350c0e49f42, 0x1d119848df3435f4, 0xe60d5266c27909df, 0x729a0c1b81954736, 0x585996e9e8d9577f, 0x37bfa396f68cd592, 0xb827df6e9ec1ebda, 0x1e16ec4a1abd5364, 0x7e211dfb9a4fba60, 0x6e5fde1dd2c6f69e
+, 0x2a595265d6abf8a1, 0x0d7861d6c9602495, 0x1443e56160a11ee9, 0x342ca4c896bf59a4, 0x314de6ec91443eea, 0x49fc9c8f8d60a081, 0x4bc1d9fd5200d6fc, 0x30cfc4c06d2be69f, 0x41c56fb574b2bdd6, 0x2b935430ebf7b92e, 0x2a87bc63c98a7ec0, 0x6973f14fc8a30ae8
+, 0x9da9c6a49dd0b7a2, 0x02ce0cc902cfe833, 0x0a1917709d8bf589, 0x75614d360d925eeb, 0xb09ddc749a648d67, 0x76bf83d2a85f3ce8, 0x1c521f77ccab3cf2, 0x733be251524511a0, 0xcd95e4a658b30868, 0x612821b30eb78cfa, 0x24fc6e88d7ab5805, 0x2828943fc03fc0b6
+, 0x5f009b0c1e8595e1, 0x6906b3f2526a64ff, 0xbea17ca2e94c74d9, 0x478413485c29830f, 0x494ba37a5687db5c, 0x3e1833eca701de8f, 0xef66931bc24643be, 0x59db4ff60af51106, 0x938ed078435492ea, 0x5f5f6eb128ff80bf, 0x30e9e978cf7f5367, 0x3bfc9754ab3d1cf5
+, 0x47a29e4954b4fe13, 0x6ccea72b798d5666, 0xb7cd2f12c31e3112, 0x28bf4d5f3e2c5cfa, 0xbd89f09c048d90cf, 0x5fd7b3c208670f95, 0xae7bbda7cc1c203f, 0x5e982a885f4e530e, 0xae56226ab3febde1, 0x087aa7ae44df6073, 0x888844a01e8e411e, 0x23f08d9ea35a1755
+, 0x6bfa08dc10907ae9, 0x5343edbe0a0bb00c, 0xc7f9417cf1cf20d8, 0x7ffae5e42476c093, 0x5ebcca453214b4e2, 0x24ab23132aa51002, 0xe4502833f00e9878, 0x60fd1bbddb1ac466, 0xcddf888280569d13, 0x22e95ccf12b0d3df, 0x9d82400dbca036c2, 0x1e82f5ece2fa2af8
+, 0x3b291c8d405f4f54, 0x6abde8b26a95a9a6, 0xae0f11dac8cd9ae3, 0x7170061db4956d3c, 0xe3a7139f5c8c900b, 0x04086fa3cd3ce4ec, 0xd237d8ae18ff830b, 0x3bd3ebc4d699dfdd, 0x844ba56fb13d8c34, 0x784bb5c97fbacd3e, 0xe7936e3bdcb2bef5, 0x08c3f95269971545
+, 0x8f46a80004766bc4, 0x6012afa82835ee92, 0xc6d5ab8286b08121, 0x49829de2dd903982, 0xbf4edb599612efe0, 0x52f5d112079fa878, 0x32e73a60b3fc6dd3, 0x4732c10f8f9a1449, 0x8ad5d7a7d67bfd19, 0x37ef3b0204a0e4a1, 0x3682843d98b3a427, 0x31b2474ce36b4149
+, 0xdfecf4a7fe61c035, 0x112ac2224f2a2a61, 0xabea0b90332ef83f, 0x319c82f14e305bf7, 0x2855af8084959ca9, 0x08f524f3a7ce46fb, 0x888e3e0632e5fdbd, 0x0542d68466f88ba6, 0xa8b23359acc967d1, 0x5463efd02a6194e9, 0x720bf6aa54af1222, 0x0a2a89d0cd2b0ba1
+, 0x6fd2699a09be25a7, 0x777d1e4c2bd4f321, 0x9cc98243ed1d9179, 0x1302959b757b0c6e, 0x4f24be330e07ec44, 0x58ea7919dd4843ba, 0xa8a8337a545821f8, 0x513f4f93ccfa7d2b, 0xdc03a3564e5e747c, 0x746e44075df6b197, 0x5bd27ed720f148e3, 0x0c6a554b9fd9d7f8
+, 0xea5ba39956f19498, 0x0a21709d411cb6a1, 0x37838c517f20bdfb, 0x1232a208ad491f3a, 0xc91b2a4468e572c2, 0x1da14fc238b4a157, 0xffef6c3a2f9dae8a, 0x7108ed31bc8d8e82, 0x4a5fd34e771c7498, 0x526fa962602ea738, 0xa0d8e17ea0802b2b, 0x4e76ecacfb76ae6a
+, 0x312f7d85827a4718, 0x0198dfe9ad9bd210, 0x0795340f07c1f92d, 0x23813fc2e4f363e5, 0x76da2bafca97892a, 0x42d3e7bc7eeaa047, 0x2576c4062b3b37c6, 0x1e75c8a36e7a78c8, 0xb1ba7e7d98d87725, 0x501e59f58ca7b9e6, 0xb0e43e649ae4a88d, 0x52a3b46461a89d62
+, 0x2a81f61b4255ad5a, 0x4480b2620c4b6538, 0xc4be07a09042f490, 0x51fd4a1dd335b7f0, 0x3c5235d7051ee6d9, 0x46fd4b219f74a79f, 0x3bd4ef28ece266c3, 0x6813bd10b3bcb0a4, 0x2670356ada43a5bb, 0x2323aafe101e1858, 0xc823ed714ee0995a, 0x1bdded9926b1243d
+, 0x5b09bb7a70ae1e28, 0x31aab0db5de1d515, 0x54cc3dd75eebe56c, 0x53802838168a0f94, 0x4f1d3e949c45553d, 0x37db7ccb2e8431c7, 0xb715a0cedde7e2bb, 0x5aadd03d48141c4a, 0xdee159abed951cbe, 0x7448138f898a4377, 0x38618820fd9aede6, 0x0243b45b72566f7d
+, 0xb42284cbff344fbb, 0x4c98c6402005382c, 0xbcfdcf6c8146f0b7, 0x2caf649287a127f2, 0x363f57365ad6cac7, 0x5fdb638cfc7e77aa, 0x8f6c9e8e5433671c, 0x5a04e6953048ead3, 0xa9730452bdc793c6, 0x071b5fd2f9e3dfe4, 0xea5533067b6908bc, 0x3033714db5ebc757
+, 0x4f86d2cc9f3266dc, 0x57a5631af3fd75cc, 0x29ed4ca9771369eb, 0x7422d4546c6418b2, 0xbd77e7547ad64722, 0x49d264e15140e703, 0x5f7773b7c3596a61, 0x6775e79e5d9ebfd6, 0x6e2a072486f9900b, 0x51b84a6f24ccad5c, 0xd738c72f084c01f4, 0x19f7f99bc9abc324
+, 0xc8ef3887558e02ba, 0x4d5274c9acdd372e, 0xb2280fa43868410a, 0x0ca8b42dbcb58c30, 0xa144ae8f0e1dd2bc, 0x7fc18a47c6e707f0, 0x16ac27a54955760f, 0x2fd9288ee75666ac, 0x241cde46a2374b9a, 0x2b4d6183d2174850, 0xdc7b5e4880c80099, 0x398b227d911aa298
+, 0x586a876968e6ce50, 0x176b9cf41bb3b77e, 0xa80d63b00f6b20d8, 0x24252f5e1518509f, 0xa9c44536fb97dd86, 0x0309f39aa56abfb3, 0x5120fbe41dd3b560, 0x7075a3d495c0ac48, 0x095e60c71bee48ee, 0x2e19dd9e88f7e480, 0x780f08ed210ee7c0, 0x2d3218bd1b9a4d49
+, 0x15b38d74fd41f131, 0x4447338f84af324d, 0xf4ad8aeae9a1978c, 0x291f6ca16ffbcee8, 0x69ce6d4d764060e4, 0x13d3f0e747fe1993, 0xb2a2d02defec794d, 0x12cf16cafbbd3029, 0xec7fa2eedeea6538, 0x56f21baa7c37a384, 0xf239891dd2f6d3f0, 0x1e6d9323eb336668
+, 0xa7df2552d36ec969, 0x5e7756fc79914f33, 0x3d3fecdf552d8cb1, 0x74363b5380e9cda0, 0x00d9eb694a154e60, 0x08c6c8d677408081, 0x533d4ffef84443ff, 0x5b5dcb9fde517640, 0xbc95006c40cf5616, 0x1310430e591838c9, 0x62281203ef65fbf0, 0x42aed79cd576eedf
+, 0x7c11d5d82c8f2e65, 0x296ea20ae69f2938, 0xd75b175f835efea9, 0x28ed3ff29e923af7, 0x0e45b63276644392, 0x48bf33947a908f21, 0x6446ecba7ac9ce67, 0x590951e789341c39, 0x6341741efc136a2f, 0x55c22b2cbdc7879d, 0xce0ca670eae09638, 0x57cdf00717e87579
+, 0xc1216ca51f976011, 0x19d02164d998577b, 0x7f5daf127d0abeb9, 0x262975b9295a3391, 0xa6afc2a692e3572c, 0x432fdec3ac79ec4d, 0xa90410a7461913c6, 0x59c8f9544be8206f, 0x059db73a16c9a5dc, 0x25171281b7bfacee, 0x0e3f453af9aac453, 0x1ed4124dae889f19
+, 0xd0d9a70e8d914de4, 0x7d2b8937a3b28785, 0x6ad9cd6910b3ff31, 0x34bf221f0dd8ee9d, 0x8697d48d2da395a5, 0x0d55675b027cf159, 0x47375b11907cdbc7, 0x524b63303def88b3, 0x68cf6ff4a06d5ec9, 0x3d8a19bd0c0890f2, 0x48bdceee89123cce, 0x59f5107e20e27172
+, 0xce51831877ddcc6b, 0x4015578236cc14e3, 0x3d1a95b891f45282, 0x4de72de8d1a83b94, 0x7a2288d49b3280a0, 0x5e6c6bb5a87665a1, 0x916dd04324d05343, 0x5945ea0c640739d8, 0xfee7c6c9c0163362, 0x2c2891c8b19ad7f3, 0x0ea67519738b3b56, 0x4c9b6847f608cf1d
+, 0xc6e8b704df17ce1c, 0x4037ac9979e3cca9, 0x41bed17bf45020e1, 0x4cffd48a6530aa9f, 0x95b9dc0259bfc8d5, 0x6305a643cd85f4c5, 0xb5782975d937d5c7, 0x6f1df0065bd21aad, 0x66ca147e54946ae6, 0x257f6f6f300a066d, 0xc68aa0134bee06e1, 0x548917aceacbba64
+, 0x4a0e2e5f84917cc4, 0x4d160d8f8d6f785a, 0x345c1f3734941129, 0x056d3fd805ce09a2, 0x1b5afea4968830d2, 0x571efa99809bf967, 0xb0f4648c79568848, 0x03c9d4cb2ea78878, 0xcd47a391d281a46d, 0x2fc7f4b5756a5f44, 0x2cb0377923c35a43, 0x23c234569e96e9cc
+, 0xeec99825f3d9027b, 0x49c452cf70732a17, 0x9989e05cfc63c656, 0x281754f39b4f70ad, 0xc441c3bb8c96eea3, 0x01114e776b8b3d1a, 0x03ff8e31ab6888b6, 0x1bac9f5962b8ac51, 0xa4a89eb2e5c3595e, 0x76cb5707aefae60a, 0x3f12b111e9dfa310, 0x64aff35ebe4d9ecd
+, 0xbde7f6699fc46ee5, 0x36d127c0a9cdae07, 0xb71b6601337cd4ce, 0x20a378e11cb714e8, 0x3c0498d43a133a6e, 0x4ea88a8697c309a0, 0xeab5854e9cd17b6b, 0x198a10d87294b5b9, 0x03d9becba0ce6c0a, 0x0f75f8e915108c31, 0x474243fd6090b543, 0x476fa4586523b445
+, 0x60bd365fb9bc8531, 0x491f079cd1820c4c, 0x81bc3cc9385014dd, 0x46fbb1c4641aa896, 0x25204d2ba52cfc44, 0x0d133817a779d862, 0x0293ddaa052db335, 0x5488ca68f9f4a4c6, 0x956f67f3de595943, 0x71f5bbbc16177046, 0xd7bae19055463c82, 0x34b89879a970abea
+, 0xe3c70147a3eb597d, 0x17066e00b66ecd1f, 0x171967480c393c8a, 0x75280d8f63235951, 0xa0f73a211883d914, 0x7eddd2b1fc1f783a, 0xecffd3a99bb8b0ac, 0x522cf230a48d0118, 0x58d5f2e5510c9d9d, 0x06b9b73a7730dbbd, 0x957af42eaec8e4cc, 0x5b82f90a81f02a6a
+, 0x8fdc748ceede1ce7, 0x2a4e567b6f2371a3, 0x69c0a9626a655fdc, 0x1a290f2148b52d0b, 0xd02d20291ca418a8, 0x3786483a63478700, 0x2c1711e1e57ff883, 0x323ac8179aab92fb, 0x27cbed33bc66fcf5, 0x1fb0ca0649b9c815, 0x3e1329ada36e689b, 0x449315dd37076f16
+, 0x80aedca3c91bb5a8, 0x1c4ad91534642371, 0xda8654e035c5b4f3, 0x063e3d11fe45ee9b, 0xe8becc61b2c1c17f, 0x0cdabd811722aa1a, 0x52f3379e3a3e2c14, 0x5582cd9e1b96cc15, 0x895be58b03d17a12, 0x04f61083844f9787, 0x586298f698491c6f, 0x6481f5a3b8f2714d
+, 0x6eb0ff4f2a27e28c, 0x131e9cedaf8d968d, 0x2931fa3f7bebb3af, 0x74b967813b4f13a3, 0x6d74385d8f6167ce, 0x3742f812eb0189bf, 0x4d2075b36cd65ca4, 0x151b0becfe2a925a, 0xeda5e571b7ae61d5, 0x2e390b54619697eb, 0x4e25018b955cb1e7, 0x1dc235ba86e19c32
+, 0x2b87b16f21b6bf0b, 0x071e5a4394b8b2dc, 0xf0b426010c99bc92, 0x0179c5534e2bcc25, 0xa2baaeb98807224b, 0x577a82dc0d95d876, 0x72b0a3cdde5dd311, 0x50df2e46994a80d3, 0x5683510b79795951, 0x145c0fff734350dd, 0xf9affdb8551e439e, 0x3159c15457939c8b
+, 0x1308aa2ff56f09db, 0x2f3278875a08be66, 0x993c2d30af177c89, 0x490a471455a38742, 0x6c5f4334ae3e4a87, 0x7cef228d72089c87, 0xce0e9d6333556bbb, 0x246713f8e5ce77ec, 0x76c522aaeca75155, 0x113578debe3b4670, 0x8396a7ff8a2764be, 0x02de30bde4a638ea
+, 0x9d06f92d38f248cd, 0x3899e6d7d16ee311, 0x88eb92af9ccdc341, 0x5f49ebac41816ff6, 0x2fd596e9ceae8092, 0x30fbad34543d392f, 0xfa1659fd16de40ce, 0x66570eee1406b142, 0x05d16ac5051c73dd, 0x445981c5f909fef0, 0xdd35c48ef2c6d3b5, 0x0f6243326a132025
+, 0x2283d3f51e6abdfd, 0x555a1434dc1c1fa8, 0xf159783ac2c38007, 0x1e15dfb3eb953298, 0xa0cecbe06b9d871b, 0x3ae9d9d7c9661ad2, 0xd9dd209099398a9f, 0x3dbd48796b19cba8, 0x7ee5f59258530b05, 0x77d114faaf763b8a, 0xd16164105f13c19f, 0x63f22cbed556fbe7
+, 0x146326ef01a69a34, 0x41e923ed8d04be4f, 0x051f7508eee06181, 0x30f093483517c0e1, 0x5b0071e9eaab94c3, 0x085587caece09df4, 0x7f124b4378f174da, 0x4f6114b0e31ade9b, 0xe9e584cbe28a42dd, 0x4b6f2529dd843f99, 0xee4a369763d5165c, 0x75e8b45a3d9900b9
+, 0x6194747444f67cdf, 0x42eccd28d7ae8051, 0xa1713813ee80367b, 0x3a9ed1fc84471790, 0x16794a916f043172, 0x18cd8a2e3b8d43ea, 0x297617e6604330df, 0x7567051f9bcb8cf5, 0xce0908335daf2511, 0x6c33fd230b90f483, 0xcf2bd533ece45023, 0x6881c57d0ce143c1
+, 0x4e0d5113ed1de202, 0x72cf07c064d1bb0c, 0xe37ef922950ba5c2, 0x59f0eb966e374a59, 0x969b674b55ca80a8, 0x5ca1292624295584, 0x48810410b256d737, 0x0157fb05c25080d7, 0xa8c53a59688a7fd1, 0x5f83e952e90b58bc, 0x14702e8202f6a920, 0x334c253d73e0dfff
+, 0xe0f9edb827ad506f, 0x39a94c368bfa1cd6, 0xeda80a04a051872b, 0x1d9b545edf78bd2f, 0x73f804978bfef60b, 0x18cf2fedd87c80e2, 0x9d0a6542ade0aef0, 0x2a800227c3008776, 0xe8015a9987589810, 0x02d947b2542afc28, 0x0c504ea42054d504, 0x3704c8daa86e393a
+, 0x505e78f05d16bf37, 0x0fd7200b7daadb17, 0xc578e0f0942a70f5, 0x7d061abbe7dae87b, 0x72ace45e3da8547e, 0x0c20bbe0971f13db, 0xa01c6a80ade79024, 0x619310cf9f5381d4, 0xb3252ceaf558ac0c, 0x1bf8fdd2f456cda0, 0x36c4e3a227966f5d, 0x3cc33b1bc010dbaf
+, 0x3286d84c5275a23d, 0x7f0a785b38c2ff9c, 0x8c68bf13a6d0708c, 0x1cb7f4c4d3da80e9, 0x46a1953138966690, 0x72773f80fa736e0b, 0x2babaf650d122917, 0x05763243f08429bb, 0x39ea9372810b1c87, 0x6651ee62d03a15c8, 0xce856123ff899084, 0x2bd673e7d842ccaf
+, 0xb5973148cbb13dfc, 0x63bb5eea91e79ea8, 0x7cbce784e4cd7786, 0x2bf30cb82ce63cc9, 0x07795b180b01e3e8, 0x3d5987faf424f549, 0x7ede54a02c54ff7e, 0x1e24b15b1f0ece38, 0x5075db7e793521f5, 0x5b47cde5fdd88102, 0x0a01d3d1f2395521, 0x53722e1ee4bb3d74
+, 0x3d58aef6b13cf64f, 0x5cafd272a83be4b2, 0x4eac790f547295fd, 0x6edb374b2dd1f927, 0xd512578b36640da2, 0x1650dbf98d3facd1, 0x8903841531837065, 0x668bc513ccb76df7, 0xabdc770a66fb9cb6, 0x4907ab35d025667e, 0xbe9678972733b0ad, 0x0c02a1e5343566fb
+, 0x464457b8cd0d015b, 0x5df8626dac0f483a, 0x6da872750809d6fe, 0x52bc1905727db600, 0x103917c8e429fa54, 0x1651f819c25fc81e, 0xc32a7ea4b301a5c7, 0x2ed9d7ba3b18ffe9, 0x613f3d5c290daf1f, 0x4087d39150ce7273, 0x53b7d5b1fa9ea4a9, 0x6c5db16fbfb7014d
+, 0x2b3a1072826d8614, 0x185859e9874eaf55, 0xe1772e058b975a40, 0x41a9f870dd587627, 0x7e13c023e4c94a7e, 0x68b7a574383937c4, 0x9db5ca23033d5335, 0x7bef538522050fad, 0xa021ded8926ceed9, 0x040ab2b8e0bcd838, 0x5a240265cddbaaaf, 0x7746f88737e56a0a
+, 0xc81a76780c98e6e1, 0x74d70610a631a907, 0xff88d881b602d650, 0x395842f3c631b819, 0xcbcdd68f1f3d6f1d, 0x6e70089846af59e4, 0x41dff0037f3682bc, 0x3cfcb72ebb05b3e5, 0xaa204ea0f12c37d5, 0x33cb73ac22f1122d, 0x469e74a24eb161e8, 0x13d1521d4d96082e
+, 0xc56826a1c4c17739, 0x55d9afcba3a62351, 0x7ae2a51fffefd565, 0x02133fadaaed5903, 0x8602c589e9150162, 0x6f6b44d3088523ac, 0xae47ab6ac705b88e, 0x76e3c7818d7b2052, 0x79e53b50dcb63566, 0x0747ec784ee1d6e5, 0x7934ebaaeda05f9a, 0x1a450cdb7717b261
+, 0x0bea3e8f4c9a33c1, 0x13693e84e146af2b, 0xf44435f859abb882, 0x4d38b7aa4712fdf8, 0x32d57d071b6d2fea, 0x508bb272dfcb3700, 0x8ba61848c2fe58b5, 0x59b448302387b7aa, 0xa83c01ed247d5c65, 0x045a8479cbeb675a, 0x70bab9b51cf2d53e, 0x692080d191abcafc
+, 0x7fd6a4397b6a0a61, 0x4cc4e4a9edb104e9, 0x1312db0054440f28, 0x7cca4d1e99587577, 0x64a211cfa2e8307b, 0x583e81afa125ec8f, 0x3bf0e46ac4543928, 0x5e81b5d0eb8629c9, 0xdc74c3e0d5b8d53e, 0x13e8a0e911e07396, 0x9b103f26dcd8523e, 0x2f486749c3803273
+, 0x352e342330f4f58c, 0x1245db52fe492ded, 0xc99bfa73d26472a7, 0x37f539191c4914a1, 0x381e96dc11ce19ef, 0x65915102d4bc9b04, 0xca46be21a739c5d9, 0x55fcfed77d7f11ca, 0x038596cf90035726, 0x20053f2fc1bbcf59, 0x4f88a44aa3f38f07, 0x1fe0e5c952720f8b
+, 0xd55acb704dc95f9f, 0x16ece0749aabdd69, 0x2983412c0c959542, 0x1ebe69a898983de6, 0x757c3340df9d3be8, 0x759513fa8e8639f6, 0x9f57970aa15f9eab, 0x00e5e10de8fe22dc, 0x32a57e2ff534ffb7, 0x777b34baf18260a2, 0x9c2d294d8ab25a1a, 0x7169f1646231a30b
+, 0x2244c136f32942b1, 0x69e1363e37222ab9, 0xab6728b69ffecee0, 0x7651dd839e303d4d, 0x52dab2476fc6d910, 0x77e18ab97c03e7bb, 0x4902caf448124f4a, 0x72fec05e61970a8f, 0x99239d584a2e7581, 0x72f54ffea04cea2e, 0x85b301153a1c2977, 0x7c760de1d3b3ca2c
+, 0xf8e0e9d8401bf586, 0x5a02b288b7061af9, 0x6d05d4d120ee55b0, 0x56a01fc15aa970f3, 0x8d9a23624928a711, 0x072213a0b0f35e38, 0xb0bb1c9f96431789, 0x3b04240f449be21e, 0xa68ad9462f584c05, 0x1ece72e64fe33b01, 0x6dd669c121247249, 0x4e2f01cfd593dec1
+, 0xd7d6a356bb6362e1, 0x0798168b0f96a021, 0x2fb3d24e30f8a485, 0x256a635806e10224, 0x1d46e1ce3021b69f, 0x55c3846f295df67d, 0x27bdca6323ec6bc2, 0x04198dfc4dd52442, 0x3c95d5229a94d728, 0x14d72fb717ec2137, 0xe690f2b30c4cc39e, 0x0b38d2ecb8adfb72
+, 0xbfef3c3226acff91, 0x08b7e3737f46b546, 0xbd8c7428c3b84658, 0x1e0a50814af976f5, 0x63311dcd02558545, 0x41f0f0d62e6c479c, 0xe84f62ff057a4242, 0x518620b9f205285f, 0x8ae15f028fed8152, 0x4d574bdacd81cfb7, 0xab999974615b99a1, 0x1a0ba3604e125cb6
+, 0xc1e687fe34c205ab, 0x0f79a067329ffd60, 0xb52e731e047a67a5, 0x5b5c812d3779321a, 0x69f01d6408421abc, 0x4f1822cf9c5a399f, 0x5654fb70aad9a641, 0x037109c19c1f7d60, 0x9615d8c626291a42, 0x6cccd5cc85b5773d, 0x95cbbee72467df32, 0x51d93dce9a073ed0
+, 0xad83be6ca2ca6593, 0x17e30235e073ab1d, 0x73dd577965d6d8b6, 0x7c19ba8115061308, 0xa63833fda8852288, 0x65aa23fd983ea641, 0x8d2aad6044345522, 0x6a19dbe04497be98, 0x0db7eefe57cd8d37, 0x23f318b2e7082bbc, 0x0b0fd6b755df0f11, 0x443aa0a2cc40bd4b
+, 0x76a3d1c38a712f02, 0x6af08485ec37902d, 0x419c70616ab03e19, 0x16f1f2718d558431, 0x4c62b61bfde3c21d, 0x4099c32a62e12093, 0x63db69539346f532, 0x1e120928cf122a05, 0x19f17e507a776c92, 0x64310bb233ecda57, 0x9113b6bcc354f507, 0x3e0e532b51921432
+, 0xd25c7117f31a668c, 0x2a7a2601072f34ab, 0x8563854b060e010a, 0x51c70833e1ffddf7, 0x1cc69d73948212c4, 0x08956ba727670c21, 0x9a54557123401859, 0x4ee01c9206aa725c, 0x4e8605e538effd54, 0x7b1d08c966eceb2d, 0xbd752ca2f79ebe03, 0x3762552c32884137
+, 0x85b83ff9d12e3569, 0x703c2f721d8823d6, 0x17fb3773569407f1, 0x0a53607d94031569, 0x5eb7d0eba9821909, 0x70a688f9810026f8, 0xeca778ba9c8e44c5, 0x1026300b52d2e4b2, 0xd99bdae4a9226788, 0x48ee34a7d0c49e10, 0x46eca0c56a4c0c1b, 0x4fd303c4792bfbc6
+, 0x06fb6d714817200a, 0x22b4d9d9d246db52, 0x4a8d0ca84dfead2e, 0x3320603d3dc51a89, 0xa719199dd0a17818, 0x76a703438705ea6f, 0xbd58fd88a1d8b068, 0x2db0a91d37dddd5d, 0xa6ecebaaba4c0b70, 0x54c3bf532ef99329, 0xce4c3aebe33f3931, 0x66d988dc59396b05
+, 0x854a401b3b4ece0e, 0x03c242e1cb422f59, 0x417ece9bbbfd6a69, 0x7e84fade5294930c, 0xbeb23c2bc7cef528, 0x645b3fbc2133d02c, 0x60a4e85ca726fca0, 0x4ac5daac0a069bd0, 0x38db435ce650f901, 0x210fda6e7915755d, 0x3dfaa88a8b215143, 0x49017885e0bf59c7
+, 0xdbcc31142c16bcd4, 0x6c6fc904fcc419d9, 0xe8c7b1d7d2b518f4, 0x24ef752f8cfece76, 0x1ef0c797ef83a56e, 0x31c27ddbcb66d0d9, 0xbf067ff22cb8d4ac, 0x7e37ce765ad59a7e, 0xc6c23f86b4ca92ef, 0x6b99e425d9a6ccf1, 0x010ac08498b9ebf1, 0x0045b35692156718
+, 0x5c584352097314d8, 0x4574be30ffb5060a, 0xf807e2d665006dab, 0x126894e0326f1a93, 0x5729f4ace6b1f40f, 0x205385d85ebaf8a0, 0x2744c28779265e56, 0x1f9011bc09a3fbec, 0xa13e1086a639e078, 0x3b5c866a1c8b49df, 0xbc0b2ae85267a2f9, 0x05a186fd81146f98
+, 0xe12356eaea51283f, 0x6c18e36993bc3899, 0xda17af165652c09d, 0x631c88c2735ccf5b, 0x0b1a7541a31b30c6, 0x57f2acbb876e0e5d, 0xb088a84c0396cc24, 0x7cf5ba224889a6a7, 0x35d50d4159d66a03, 0x1a7bded57568e7f9, 0x742253825072758d, 0x79859ab6bfb93475
+, 0xc08ec8664b722e6b, 0x7a1105511dbfbadd, 0x0d85f07ac1973c0f, 0x24e76b0cbd8bebc3, 0xc9a8c15dfee28e59, 0x47e9d66e6909259e, 0xf7b5cb7810b92647, 0x23bfb0d9262df1f1, 0x011abdac38a720bf, 0x27fda3b3fe423041, 0x80f8cf0a2fd90b72, 0x501ab77af030d956
+, 0x139260b42424fdf6, 0x3fa92936dcfdc4db, 0x8933b412ec6712f8, 0x0efd439290174ff6, 0x8ee5fae3452dba0c, 0x7d4d4ccaf46e5f42, 0x52d53a307afb6426, 0x79c384df3d850ba9, 0x281f351aeaafd0fb, 0x77abeb9fb598a46f, 0x6321d0b8d2239524, 0x3d511733dab25e3d
+, 0x4aa449876477de52, 0x78d78e8fef0601a1, 0x6dd741966bbfad6f, 0x7cee05ea29adef50, 0x98acc77f6f320296, 0x19a52741e5cb00a8, 0xff250dccbb4132ce, 0x57f9e6df36e48388, 0x7b801befe1e90b8c, 0x434717c1a2131e5c, 0xb3a96f2db5eb78c1, 0x0276f73322123e59
+, 0x08c60a32e29dad41, 0x0bd1d0a1abedb2ba, 0xfaf18431d33b3298, 0x79e52f76a00bc34d, 0xd37511021a2115a9, 0x7c26ac82e1078b81, 0x0d659ab25d6eea61, 0x6bfde288543a0454, 0x2aecb0d3c1b06fe8, 0x04df5152cc727bd6, 0x04df4f84ff2790fb, 0x6fb1ee8fefd74eb7
+, 0x046093312f763bd5, 0x4428e4af3ae3aa28, 0x71509f5125b0c00d, 0x046164f4c1196ba4, 0x01b1def28da1e203, 0x7732f0c8027b79c3, 0x569721bc6b99d2f0, 0x1e96aaca524d4298, 0xadb427e13b8e2118, 0x2719bf63f961bbd5, 0x3dc2e65ed1c78b6f, 0x12f4f797a6f0a991
+, 0xfb8430123a4c18a7, 0x402bb9793b5b66ae, 0x8e16dd9eb381cf78, 0x5b8bcfea8d1160ff, 0xfa94c4545f759a27, 0x40aa5a043b66dba1, 0x79c2b7cebf94a9c3, 0x6bf5dbda31afabdf, 0x2037bf4df15aa449, 0x3e7bc9ce2994930c, 0x8c6728679542eb2e, 0x083315e77a2472d7
+, 0xdeb022d5394c0123, 0x398a0682f999b96c, 0x9104eb0de971dc7e, 0x4c0ed16dc33cab05, 0x87e5d32124190aab, 0x41d6339232cf9397, 0x92652667ea2fc468, 0x11ac5169e54ddfda, 0x1b2fe46b56e6b93b, 0x67e42d1c83072f3a, 0x6676472e2c75dc4d, 0x274ceef59ca7a986
+, 0xb82c1a62f8083a84, 0x1ea8f277451fbb08, 0x877d47e926e7791d, 0x32ea8950e098793a, 0x1114628a387e8e2f, 0x5a51ff3ddc97b750, 0x2c347dca61adc0a9, 0x4697793c4fb801a1, 0xd121eb7265e5368d, 0x31a849816951ff8f, 0x376f3bf2e5b3606a, 0x7d2203328d4af97d
+, 0x09b308afae3d7ed8, 0x4f434af2eae91a1b, 0x74e0c4fefb00ce67, 0x25b26c3779802db9, 0x6a6d5d059d6ed727, 0x774074b6cd606054, 0xb36ed9bb08be062e, 0x0fc12ba55d533cc3, 0x560e0f59c9f43dc4, 0x2e0db2bb66759490, 0xb96ffbbb45a51372, 0x0ea50c10f196a65b
+, 0x327978efde03636f, 0x31c932ea7523f5de, 0x4a145223d7ba29ac, 0x2d75fae820d47c6d, 0x2e3bcb7fc25bbeba, 0x7fc976cb082b3c33, 0x22d6437602070f12, 0x00b7d37613505a27, 0x707a05e056fafa16, 0x173517c8a5d20bfe, 0x01ce91e55c140ef7, 0x05c78ba52535ed77
+, 0x6122a393486e16e3, 0x3cfd99d2dddb65d3, 0x1c09dc7bf89451a1, 0x487e6e7d31c78ce9, 0x4f8db80cb9aace4c, 0x3ee60135ed698697, 0xb98ba23e0566e697, 0x12aec64e592a9fc3, 0xc498a68124d5268b, 0x185b2f7472f4753f, 0x131c83f2583ce610, 0x553c86b8c59e1622
+, 0x14181a5fac9b7d55, 0x42e855dbef4c3b55, 0xcad589aa40ce2e3a, 0x2059bd996b509275, 0x86258a9a3743c49b, 0x27b20efaab967231, 0xd3611982a23f97b2, 0x69b1badefca60b66, 0x143fb027082bf83b, 0x7456aef0ab916f8f, 0xde6e8f3c863e9548, 0x2735806e0c7a0f3d
+, 0xa22a8278aba8e355, 0x6c86cf2ff552307c, 0xbb3497d96e74cf80, 0x08991a165929f1aa, 0x6a9b2853dad044b2, 0x5e2fe6c246f0b3fc, 0x3a75da9b75b7893c, 0x0e11b0d2e638e49e, 0xf9b1665db63218fc, 0x2c808f9a6c9c9d89, 0xc3c480a5acdd03cc, 0x0ef02d77424ca830
+, 0xcd114b9d4b0ebe66, 0x55c3bd5e5b21cf70, 0xba1542766ddc2410, 0x235caf916e297145, 0x27c27cdbcd5d02b4, 0x7eec4b65a605500c, 0xab8ecff991b0d1d9, 0x0b29e3c7e8697a6f, 0x8523791dcd8a5408, 0x4c2f287b63df36a1, 0x1030cb0b430fd209, 0x378d2b97f7e7271a
+, 0xc76d02dac8fd3cb3, 0x4f8e0463b76eca49, 0x720ab7a2f86239d7, 0x5a90be3944a5d505, 0x8f5ec75a966ae783, 0x1766eb4b1ca91146, 0xbaf7b1ca67f1be6c, 0x6ae05e5ba144e34d, 0x30359d6ec728e459, 0x78fa94bdb368d059, 0x15b0a3ed04651677, 0x6ab65000ec388f07
+, 0x1592b392de08323e, 0x1385f34756de61f4, 0x881f60ead1c95e40, 0x4bf605bff9de6ace, 0x97e135efdd23e0b1, 0x13186014f6bbf48a, 0xb56a99724239767a, 0x55f11d434cce1120, 0x5866cc3c51ca969f, 0x18ebc889aaf1e340, 0x0e364cf413d56cfd, 0x7c3ccc79f13059ba
+, 0x9a7c97a5a8ddaefd, 0x2e7d2521c5572211, 0x2abaede67417b022, 0x62fa2bbf417fe743, 0xb7852e6d1ca16ef0, 0x072cf9bc3173a06d, 0xc4824187b9fda76b, 0x448a3ddfcb0201ea, 0xf9021533ffaa0f7a, 0x06977f4c62747655, 0xd129da3ffef1edf5, 0x565e43944f3fc43f
+, 0x3a49925f01718878, 0x1c0ecb6eefa730ea, 0x881fdbf21cbc3fcc, 0x0f73b63dcc89e077, 0xdb440e633f3528dc, 0x0f75094a94d245dc, 0x0c2996316b39a350, 0x2234b6e825d93e97, 0x8260ad48ae1a984b, 0x4344b8dc3de4fa35, 0x3f36aefeeed4ee75, 0x2c5c522fdf7339e3
+, 0x22e2ef183c6bd867, 0x137e1557718df8e7, 0xbddfe84a7e46214a, 0x6e597ceba863ae48, 0xebaa31a683052f5f, 0x76036b07d19054e1, 0x646b227eeb6b460e, 0x034065e62bc2c3d4, 0xbb5b0ed3fc62fccb, 0x2dc388ffc10af6ff, 0xec6472a53ac34a92, 0x20198fc390742419
+, 0x38da214da3744a3d, 0x4749798427c85d9f, 0x097e1fea02bd4c2d, 0x5793b49f0e014daf, 0x07101f3d609890c8, 0x3ac78e386d7dafea, 0x67199f81a4f5e7a8, 0x650d7b13ee364498, 0xd81b3a1feae75638, 0x7129b4acb44210c5, 0xa6769da6c2193705, 0x1e6b27ab2f5fa36e
+, 0xd323bf94125cdefa, 0x5cd1d8f08fc494d1, 0xcd052290282beff9, 0x15667846f8562f1d, 0x6ca159f88b6b07a4, 0x4f6e5a47b4973cff, 0x4f5822ed8c641cf1, 0x5c12222a388eb645, 0xd3a08c9fc087b426, 0x513bc035c1c86321, 0x20090ac15ff37b9a, 0x5ea68be5da4bbf88
+, 0x3394cc2e3ba3fb59, 0x3afd1035e22ae36c, 0xa07e5eb64def9201, 0x028a40b5a10d9213, 0xd7c66d87ab59a879, 0x5b4f758001c488e2, 0x8ff0a89a07b0caec, 0x36afa828cf67116b, 0x233b85116537ca5a, 0x64c35c041a2b6f9a, 0x825c447f5a242c7d, 0x6f1ffcd78d046558
+, 0xfe5ecc0d6aa94616, 0x3f2449b97b517866, 0x7314466bcbad4037, 0x6b0100fceeede109, 0xf34da1ae642d5879, 0x3223174a1f7c60aa, 0x5952698a14afb2db, 0x22db92850b9964e6, 0xae4f52c080fe3731, 0x0e44022dd9f10c93, 0xd9f421c32975999b, 0x08d6d674a88ff909
+, 0x20faef580962b4c4, 0x3aaa031e9666dfff, 0xd0c4095ca9b91235, 0x7f1209da9b340a5e, 0xa62ca5998110f825, 0x085596d5a6090257, 0x35c9316bf1f2b185, 0x6f49d0ddac899ff4, 0xba6485fbaca98a0b, 0x442a521152a8e876, 0x86aaab726d8b97b8, 0x4eae8f55f09c2faa
+, 0x58dbb8eb84cde6b1, 0x2fe059ba66d1ce7a, 0xcb4c37f38eeab2d7, 0x1f4d82c90792079b, 0xd4bc1eda8d05f175, 0x19c538bc30ed4536, 0xd806ef6afa51a770, 0x61222e821f947f21, 0xd9b9dd92e13e558f, 0x72804cdc5912dcc4, 0x8991cb7f23258f04, 0x6ea2289bb0cd9bdc
+, 0xbb58348526a64fbe, 0x68b31d84636470b8, 0x7e884a6361cf9d5f, 0x1e43f23cb6534e92, 0x08ce9d8c45e8f605, 0x68de956d91a15340, 0xe95a0bfa443f7bd2, 0x115eb6194899dc3f, 0x247ddc41ea9ac49f, 0x0429175aff2262fd, 0x3bd189699d184efc, 0x439a8f36cd8ecb55
+, 0xfccc8d6a6e0f891e, 0x407a1b530afa5d61, 0xce1ed077c69906d2, 0x222a6de4e45612bf, 0xb56d1845e19dac97, 0x6c9b9998a5c8b376, 0xdb0e3cfb96b9de7c, 0x1994bbd1572fb5ec, 0x3981ef137fabd0fc, 0x7ab12206fa36746a, 0x637d9787a9929ce0, 0x2c70058d2d600008
+, 0xb9335656317eb2a5, 0x25eef86bec633846, 0xce703c94b3cf0ccb, 0x25831fdfa6222d23, 0x7f01fd922db676d8, 0x0cf4785d51868931, 0x77283a3ad427e504, 0x3c4f28fdd4fd82f8, 0x7c4742efc062203f, 0x02b61b5166bd40e1, 0x9924c870fe88a648, 0x7f1bbaaae0441dc9
+, 0x1d5cceeedddd7a0f, 0x7a30d943fd93c1b2, 0x3cf849835b9b02ec, 0x34064fb17fc8744a, 0x1cab11f955e69907, 0x691a477df1cd1ac8, 0x09b43bfa7992513f, 0x69913707fa4547e6, 0x083eb6b046fc3270, 0x628ba805b2cf67b5, 0x7423bc837a389a83, 0x402c86ba1b6f4c7c
+, 0x978340cf49a0176b, 0x75304e3d468290ad, 0x5470da6eb45999e4, 0x7e4ac2b4ff9e954d, 0x297caae2e315e7b7, 0x74125fe8af71a4ff, 0x1dc624e0dc7e192d, 0x42e0d05d84b103ae, 0xe800e2bb3d8076f9, 0x190cbfe300b8d7d0, 0xc1c9bb19caa70cab, 0x4a368c5f8a9a5dbf
+, 0xaea078ffd9c3aa0c, 0x6609ae901512c3ab, 0x69347d553a39364c, 0x1ede0a7eb141e950, 0x687954cf1861b2a6, 0x3c6373972aa4826d, 0xc7408e69fcfffc61, 0x0bd0e6e6f890b593, 0xac0462a0fd44fc0a, 0x23b34652bd64118f, 0xc7c1e17d692c2acb, 0x2e725ff070a3f500
+, 0x1618111cf9af8ace, 0x1ef97dd5263997ea, 0xcce2582a071530d0, 0x571b040a7cb2490c, 0xcdd7852dd300f5e3, 0x50193bdf7cf88e61, 0xc16b1d87e6e780ff, 0x5410bfb5086a00de, 0x1a91e58322bc004f, 0x7fc0fd6516f5cc7c, 0x81f651f27ce910c6, 0x3563b0fd6cebe30f
+, 0xaff33f0cc28c3697, 0x4984407c81559034, 0x1cc1bda0dd58b063, 0x459f62424c3e088f, 0x4959823b84c20457, 0x447eb853075e8792, 0xbe611285dfc6fbb4, 0x7e522e0a064bdeae, 0x54fde68620241050, 0x6267b992a4555e9b, 0x2e630a2ff50578d6, 0x47fcae030360fb8b
+, 0x31a4528e1cfa4694, 0x00d9ac22e54d9401, 0xd117ba022c781fc3, 0x22a0b8814b98f5df, 0x71fa35754f9aa393, 0x16050c37e5347713, 0x8f73359ece078c26, 0x06a1988a15fee214, 0x94bcaa1f64e0f3a3, 0x35e52d0c777e68c6, 0x7207137753a580d8, 0x6fd1bd637be11357
+, 0xfcb11d78cd420a7d, 0x3eac2e0d6774e655, 0xca7c31f4c0b927a4, 0x0912d32a14793461, 0x15cd399440167bd6, 0x5eb48a0333bc87fe, 0x8833b1460705ca2b, 0x3618cf668dc3fe57, 0x9d9500e8b55d3a11, 0x7cfbc35850872794, 0xf1391785eebbe9b1, 0x6ca28f01b3d4c378
+, 0xe5ae791f4a823b1e, 0x72d4931bb7635881, 0xfe8089cafacfdffd, 0x36cd68bbe5ed93d6, 0x57dc0d9ba0c1b8c4, 0x4e85b02685043dcb, 0x91e36586730a5dee, 0x68ca65a2bddf03e3, 0xa44373a0b1313ce0, 0x19df49bbc3aa97e9, 0x9ee969265646ab69, 0x434c2a882f3efe5f
+, 0xa12e6fbc8715f030, 0x5d1324b028491cc8, 0x6d5aa791520be9ad, 0x430b647af47bf6bc, 0x853de6185801bf6d, 0x16e6136cc672a0a4, 0xfdf125bdea8b6668, 0x577cc94222feff98, 0xad224586ebfa8af3, 0x04413689d0ad10dd, 0x2b1b55baa98f6326, 0x29af35b70736b3a2
+, 0xf6a6080f6169a42b, 0x5a6f60a1aa1703c8, 0xf03909e6dc5dcae1, 0x2012541c013c3eff, 0x87833b0d0beeda57, 0x2af7148513d791e5, 0x91edbf4e96ffc063, 0x02accf90d56a8aac, 0x388844c3b394f382, 0x617cf03e0a496116, 0x92a5361d736cade9, 0x09667eab254f8174
+, 0x862a8b009ae130bf, 0x4858ecaf88b444e9, 0x13795fe91acf7f60, 0x299ae931578ef68e, 0x3a3994924c7313c3, 0x4029ad2f0fd9eb05, 0xf73df87a7b876de7, 0x2ef2cc88a2afaa74, 0x333be4d7220ed4e3, 0x1bdc7860760baf9a, 0x8015878db96fd18f, 0x29787f1e51285483
+, 0xbb73abe8f0453aa5, 0x6c7b90e441e2c93c, 0x5d77e9e37c2732f5, 0x485939248bab17d5, 0x5f559d664da57dcb, 0x3d84b61a6837ca13, 0xb2aa7f61df92c753, 0x06e2d4413a2c1dc7, 0x5635f90dca3c2202, 0x5f107d17a3c9e8c9, 0x0a6e6d2852f8daa0, 0x548ef70b2a0f9609
+, 0x04ef1fb1567ea211, 0x2880ba64223fbd70, 0x3de78e733e969c37, 0x4757ac0094abcf94, 0xa8de58f28a9cfadc, 0x40e17c02f5b13bc8, 0x16331575acdc1b6e, 0x79ab2ac47f744388, 0xa4c2c37baa8e9509, 0x1dc396807e7127e9, 0x1ee385b54fcd948f, 0x36ec6ded4404d18b
+, 0x83b06dea1286e5c6, 0x6bd264a73d362c44, 0x39a5a4423c9444fe, 0x63081c9da2056a42, 0x487526e9979e663d, 0x4359bc95abae4aa9, 0xa4c22e143f726f02, 0x199aaa5625968809, 0x9bc1e7466ff560b1, 0x57f48d584c625a6a, 0x792d5417a82ee921, 0x3cbe1ce2a339cc29
+, 0x2eebe464eb55a311, 0x1aac444d29ee2cf8, 0x1a16715811a18c97, 0x260617c386bdb1fc, 0xd2004c7a05a352b1, 0x3128dc8ead2bd97a, 0x2447b2a08369741e, 0x118716ae03cd5e3f, 0x9c40935bff376eec, 0x4c075ed5f63a2ed6, 0x5d6f922f0bf44e83, 0x0cae4f2f052a2a3e
+, 0xfcc77a4d784121b9, 0x7c143a6c10962b36, 0xbff8b75321fd69e5, 0x18ba19f7c0bca968, 0x4b79056275d9d9c0, 0x1a813fde8b2eac9b, 0xcb880919a461bebd, 0x1f504959145bc87f, 0x62431e454cbd0502, 0x277fbc1911808e47, 0x69f670e8af01b687, 0x69825616ce2c8e71
+, 0xa2fb2f8f54376146, 0x067845f760851816, 0x84786fc85a01b9b4, 0x04df8388b2e72f79, 0x8b0dd3ba08e2e97c, 0x356ba42abed6f6c7, 0x461101b56c85cb60, 0x6257a256486d02af, 0x152deca50e94135c, 0x38b37d0280e41ad0, 0x497551433bea7d64, 0x2d3252e2464692b4
+, 0x3de36d6a4ec32cce, 0x4e0403b57f7aeb9c, 0xca4bab890d8d8365, 0x6d23c37de83bdd05, 0x09f4a779117db495, 0x45a077651c09b237, 0xbcb34b1891df0178, 0x3def0a53da9397dd, 0x2642d7dd1902d2e8, 0x0a4712d9462c39f6, 0x506c85b306a58493, 0x03047b6650a3ad90
+, 0xc93bb913820c39c6, 0x7e9983d8f8bee36c, 0x0f2d149d99a17010, 0x26075810d7a533fb, 0x724513985cfb63da, 0x25e21f9a25dd166b, 0x12c6fdb8f0650404, 0x37c5819be6e6c5d7, 0x40ec9481de0e5d88, 0x797828d6a4b06198, 0xdd220ce84021eb2e, 0x51eeaf3d5e0c3940
+, 0x297da8ead0d006d1, 0x1565d71415fe5e5c, 0xbb7e547002e0b98f, 0x782a4eb96a016afd, 0x4731098e14e8464a, 0x67eff7374ea09ee7, 0x1e503b4d9413c700, 0x22897601718441b9, 0x7981458b1ad02a6d, 0x250f5252da36a3f4, 0x988733bb5b35a1a3, 0x3255cacd7bf254a7
+, 0x5fa59ae47b6ef578, 0x32a27f4e98fdc702, 0x1683b457e0d77666, 0x7ec8a08640019161, 0x8f36f6d297377f1c, 0x3dde9cf282ed556d, 0x327916e64db31733, 0x1421ab987c4817f3, 0x88e2f1b525c85178, 0x799227bac3cd494b, 0x0d77dcea73ee7ab1, 0x761e0d0d460c384c
+, 0x141dd1f81b4ad09f, 0x4a71088991ab5445, 0xce385e06866f5549, 0x4c01e5ee11d792ab, 0xf7190f6b59b33361, 0x61ca022752b9c27e, 0x4994e27f47cc7f93, 0x65f60f3e9e1f0fbf, 0x82a19dcf6c69f306, 0x62b6f7734bbd06da, 0x82c90a7121246517, 0x76203d9719a1c019
+, 0x54403d355192700e, 0x415e187b03771ed2, 0x9c62522b6fb12b52, 0x427dde02706f4738, 0x26f30bd3a58a0c43, 0x1bc9dabc365fd57d, 0xc1d41385417271a0, 0x66d0580cb41ce532, 0xecc9e7e96915ba76, 0x4e5b962145e5b859, 0x20112845fe584a7e, 0x6010376822fcea32
+, 0x709cda0eacdaf614, 0x368ddb8211837e61, 0x57b622a92a2e5ac7, 0x7100cb89a4a754bc, 0xc650cc783fe0faa8, 0x03331bef5afb125f, 0x29d39f78569c99e3, 0x1e24eb99efb79172, 0xf9fb964abacf9ee0, 0x02efbec0a96207c6, 0xedcf46f66082be6d, 0x0d87d236936d527b
+, 0xdddf3905aa4b9c06, 0x2f373b5310aa30b5, 0x70c8feafd60f1c72, 0x16d28e0761b768ba, 0x5459390afe117b2e, 0x43cab4fa5101e800, 0x588ac712abc181af, 0x3ccd2fdb874e8028, 0xac91b9f538398cdd, 0x43d625b2dd75ad4d, 0xf2ef9321e2903d29, 0x6315c7896dd25ebd
+, 0xc7faaec12a631fe6, 0x1711854fc746529e, 0xd40ebbd04767d705, 0x79c90b93a8b1bd2a, 0x99229c5d1e5a6088, 0x37f3ab27591ae19f, 0xe5633349ea4e17b1, 0x5f34e5611f2cd615, 0x78e98c15622d0f27, 0x5ba40e7e9a848be9, 0xa3cfeb7ea4206d68, 0x624d055713d0b68b
+, 0x298f94f4e101f5aa, 0x1865f66fda852b2c, 0x8eb264b538d8162e, 0x14850b6220ba64e4, 0x31b26d988997a573, 0x59b974c6014ce67e, 0xc667163ca532e45b, 0x0af7adc272e841c4, 0x8c828b2d7e252609, 0x1c0ca5ba01efca6f, 0xbda49a957dceddbe, 0x3522af2295263793
+, 0x9891105d0de549b1, 0x7a10ba2602f3a549, 0x87d033b9438912db, 0x6903d74cdc9a63ed, 0x477412f3d7514eb1, 0x4d359cb17299bfd5, 0x516da1b6a8481f6f, 0x092c1f94d1ae3cdd, 0x50aca7e66be55b75, 0x2366fa47672dcda3, 0xbdf22ccc9b581678, 0x11cb6719a4c98d21
+, 0x601dd5d4ccc66182, 0x26ec0e4a3cc13f03, 0x2dacbc5ad5065c7f, 0x59c0d5c0551c8ec4, 0x173e6fd0b6953ffa, 0x21e5f4c3526b3f61, 0xafd0954c8671df11, 0x574daa675e532319, 0xf42979fec2849235, 0x15180f1ac56ceee9, 0x7700413d9d031daf, 0x540b2dbd51c5095d
+, 0xec598c8c8974aa98, 0x5da77a6b88a524fb, 0x8da3181c170563a2, 0x46465704027cbeff, 0xabd48d48ba65fef4, 0x6ded8de17fac7d39, 0xa47bdf06a79449bb, 0x491231c668fb23af, 0x633f7e91b7d6cbba, 0x50f34ae72d507306, 0x03d99b4deb7829b6, 0x568fd0a560b8eebc
+, 0x97c865288d32c137, 0x42c8143ee29b05c1, 0x40137f44dfa67f7f, 0x7113f8dbc3c0739f, 0x8297a95e0fc2c274, 0x7bb713d4a735086f, 0x22088b0262647085, 0x36f3dd4ffb88eec0, 0x9b8290466a44cf7d, 0x2bffccdc10cfdf03, 0xaadf5dc8724c3555, 0x5260c1f0c6a01882
+, 0xdb2b2b3ec219a636, 0x1840a207794e214c, 0x176c926c9a5f821c, 0x6b7e53cecec85880, 0xee2139c91b1639d7, 0x57b1e3cef0c4bcbd, 0x01a6aa47c46243b7, 0x5edc4ec09269eedf, 0xabd3fbaddb66827c, 0x05f6260bed844190, 0x2d784ef07368360c, 0x1cb27c037de80b1d
+, 0x121c31ad9c6029ea, 0x13b443444343cbc1, 0xbc182c0a73f8ed97, 0x0725d44607d53dc6, 0x6f2325df13e80e08, 0x11e8e4b031deb48a, 0xd7aea419c6ed2f1a, 0x3306620275e1e36c, 0xb38075165ed88f15, 0x607b6006529d8a17, 0xbd785416f2ee8f1e, 0x3d654f90153d662c
+, 0xec1f4a84771378e9, 0x6486e7f05a386ec4, 0x1dcdc96679b64c0f, 0x10071060730d11e8, 0xf00cf016e1e724cb, 0x7bc982f23081f316, 0x1653d9e9275eba62, 0x65ddd7dded5cbc8e, 0x174bb2cafba31678, 0x6e64c01ada1caa76, 0x3853a6cd7b0bb618, 0x798709a47d1d363e
+, 0xa1371635a9f5a5e2, 0x2f583dc6e8d50073, 0x16b97dc413d90b5f, 0x37699611f891c8f8, 0xff1c8d270a035501, 0x3f60520516b3bdf5, 0x465a04042ec11e41, 0x341b36404eec2b0c, 0xcd8a7f4a6bebf91c, 0x1bd85a96315889a6, 0x8a36144611d02f85, 0x38a687b276cca371
+, 0xfc9d250c7fe414ab, 0x66ee0706d125b1cd, 0x27cdc1058182593a, 0x17ef903ef0e61a60, 0x19bfd5badf5bf308, 0x11248955d3d56769, 0x9daea4ed42f3424d, 0x4d0e453928a6463c, 0x6f1bbbe72b72a390, 0x586f239773e52814, 0x7306425f3007315f, 0x45dc91d051f05453
+, 0xb3a8708297ca0d87, 0x0b12f8522ca4b135, 0xefc3e218e411ea45, 0x44b56df51eda20cb, 0xf042f322206964d5, 0x45dc20c7af20daa5, 0x5039f4d7066da354, 0x3ed88db380340688, 0xe601e4771ecee214, 0x07fcb94792770b58, 0x8ea204e08dcc3b76, 0x276f3d73a927ab2a
+, 0xc5dee0708ff7f4c5, 0x1b043eaebbf2f4d5, 0x1484957ae8024177, 0x5ecd626f0fa37205, 0x3e1476fb99e436a5, 0x48ac1b3a1590d6b5, 0x2b0e807df25eff07, 0x27e62347c7aed759, 0x1f36c1f8f9b6aa84, 0x32e8773ef999f7ff, 0x21a576c82fd2573a, 0x73b253e71aa227c0
+, 0xc2109d1ecbefeb35, 0x4313b1782165badf, 0x2f6b7e0f37963658, 0x7078c999bcdce9bb, 0x760ad3257679c274, 0x6b3d643c5b407236, 0x9c9f3107feba8d92, 0x74a3861f58bbd63d, 0x767f075e5b9cc69c, 0x0452dd2e0b8baff3, 0x05c94fc314fd34e6, 0x5cdd9dfc3ac2b499
+, 0x0f576374353bf041, 0x5d553b8fe3934516, 0xb75f086b8bfbf22c, 0x4520627e99f019ab, 0xf4ebbf75d9f1c19e, 0x41a672c7f20a5041, 0xce4af8fade0cf83e, 0x38eef62f264c66e6, 0x3e08e6beadd603e3, 0x3dfc4d3f507e4581, 0xa8773b5b97d7a666, 0x6229c1c83c0f23a3
+, 0xf0fc7180403a24ab, 0x5df3abfc0e30f241, 0x2429008172044a13, 0x6a5f6b025dd140e9, 0x9bef7c220d89a4f0, 0x5f938179865ec0a0, 0x1a81516038945e6c, 0x18da7110eadb08cf, 0xeef80033bd225e32, 0x64d0e89f8ade62eb, 0x5a82acadc6e44d86, 0x087e082745138411
+, 0x8e2fe5c1fab85f2d, 0x789013f4399a5e86, 0x6ad25a13cb0dcae1, 0x2808cb7ba59518d5, 0x64efe052e9a030b9, 0x7043b041ffa151e2, 0xc75461a01842b6cd, 0x58e7b96ea4aa966e, 0x1ac670649e815c60, 0x2133e2a5d5d68345, 0x5d8523059bbef591, 0x49610f6d5dd06a41
+, 0x7e4931a11a872b8d, 0x1791b6508822bb7c, 0xe5f3f3b743d62697, 0x105ec2689db68363, 0xda1f02c938d47cc5, 0x49acd393087bf7e6, 0x496f3d0944fa178e, 0x7074bcaaa0212a64, 0x28bf6a88c8f20557, 0x0c71973a6670e2dd, 0x2c77f4c619e9e115, 0x12fc19938a003feb
+, 0x85ec7408bbdd7948, 0x6803e0e645499631, 0xda31037be4cdd5a4, 0x454863ff67059971, 0xe169822646fe8df3, 0x629674771d23f3b7, 0x2c432c27388eb845, 0x1c6ca1c468049cb5, 0x846787f090f0b30b, 0x70a31a5c52a6502b, 0xc80a2339595a3962, 0x7052bb64c948db43
+, 0xf7cf855fdcfd21ab, 0x00344ec7c0a8f9e4, 0xf9467f332c7097f8, 0x27a7ce28e1454c4e, 0x0c564ba5b31a6275, 0x08d56f7c8bf6a145, 0xd4fe64645d55ddf6, 0x3525df037e41fb89, 0x884543b06fe80c33, 0x5d3cd22ec3581750, 0x575ce8650ed0e76e, 0x3e512ee61aac2d0e
+, 0xff2ac718b71b1b3b, 0x61d5e6cb588cda69, 0x288dfee0e9f9b4e6, 0x4f5c087c3de1691c, 0x05d095ca381ab0cb, 0x765807a773fc9572, 0x05c65d5e8c24a039, 0x4eae45d9b3b4c199, 0xca5dd1de30297d9b, 0x3dd60375b931826d, 0x0670bffab7384df9, 0x2c1bb351bd8fc8c9
+, 0x85c5523ade04557a, 0x498dc9633c37c775, 0x7b8efb3547a18741, 0x48cdd28532c6fdb3, 0x8e60114439bab60e, 0x6c631eb67fa56d88, 0x47639b234e80541b, 0x2f1c26b48c1108d4, 0xfde18675c1e93d7d, 0x42986aae23592532, 0xa1fb421c9727eafb, 0x6edf64b827e24147
+, 0x012ac67c319a5945, 0x3406d9ec98750603, 0x0c34d1e6ae97118b, 0x658634505f6b9ed1, 0x2f6a59a76792458d, 0x16ebe5dbc190c86c, 0x45e996d7af9272ff, 0x51923512783887aa, 0xead8b8bdcf735255, 0x270aae39ec5bbcdb, 0x7e33d31ccea1f8bf, 0x09d98eb8dca108da
+, 0x6c78ab2f86f882af, 0x4563cf15275ee7ef, 0xd3edb99f46fe7ec4, 0x790872219fdac465, 0x73189443b71436df, 0x71c352dc6dd6c8fe, 0x4f1480a92433d80e, 0x2e01798e48653357, 0xadea82b0c13216e2, 0x28e8ac69e54eab30, 0xcd30c40d78616ac0, 0x1c16843a08420e41
+, 0x027a91da7c35cbe0, 0x48d43bd12478ecfe, 0xc7edb8e4e8f691f0, 0x202724145d41dbf3, 0x5ec4f87d5a179fae, 0x512918da0734df21, 0xbe2069169a4a3a69, 0x7627cb7ae3e93dca, 0x769fc9d5f6c4c605, 0x45fcf989f49d4acb, 0x6d149eb173043338, 0x0f1f7c47aa47545a
+, 0x16e578b8894e8d96, 0x52b4b9333ad0e989, 0x13c09587036ec435, 0x72678c9c37f0d414, 0x4eb0caee17cce1ea, 0x71975c6565bed887, 0xd0aa3f1c2daace24, 0x73ab414c9d425796, 0x6b8845a9add75e12, 0x76c575ef510c425f, 0x59d53984d238f86d, 0x621ced1af4ae6c36
+, 0xf4bff150d59611c4, 0x3526b9baa2fda166, 0xf0ba63b15907c1cd, 0x050d33704b23426a, 0x665a10bb5d936ccd, 0x0f66f4ad5a1dbf03, 0x05db485bd6f86f49, 0x3a1da6cb21d835e2, 0xd358beb9ac29971f, 0x583f42b051c9bd32, 0x52308977972d137b, 0x03c53190e4676fdc
+, 0x5757e9a6e19cf3ad, 0x07f34e64b075c79d, 0x3ff75a1beb96c79a, 0x731d5d3751c961ca, 0xbf9f06ddaa55d0ee, 0x6640dd0a9cc0c1b5, 0x66e07faf00977de3, 0x35a48ccceceb35a6, 0xe18a0ad769a03b1e, 0x54ebbaab3ce49fc8, 0x9c1ee7e90f49ddd9, 0x763b7311b8bfded0
+, 0xb6b0e86384b227fc, 0x780b44cccaa9d9ee, 0xa5a2d8ea77962691, 0x1ff7aca468d884c1, 0x87c2317c009d9ecb, 0x1a2083fb475b62f2, 0x29bae6446a6c940c, 0x17ce5996a107c404, 0x4ea5f3e601ef414c, 0x16a047276a7a1729, 0xdfe6ae4124327f23, 0x2dac04b77e2a3f33
+, 0x0cefcca7168c40dc, 0x57414125a2e15d96, 0xfd892f4537f82709, 0x7690911e2a47b0a9, 0xe3ffd00270750b90, 0x56ad1704651483df, 0xe63b790db7801520, 0x6058789ab7e8095f, 0x18bb6d390b81b2a6, 0x322a1499e21f6032, 0x2edc3355bfb0f706, 0x00d6cdbade79b866
+, 0x7c164470359633a2, 0x614f3de8e200ce3a, 0x0a2f4cf43268b962, 0x66eddf438b776082, 0x65d6c6015c5891fd, 0x4647005001b59a71, 0xd326e92c010b6d70, 0x01bf34ac0f96e231, 0x7af7ffda0eb0b926, 0x420ed7e0a15c49b1, 0x6c2e5127b2486919, 0x65f007bdb9f774a6
+, 0x27c258239a251874, 0x6b14a7912a1ba6ff, 0x1edfb314b016580b, 0x039d9d5638c20dc1, 0xd296bc4e13773822, 0x3cf7869422b3b680, 0xa0c6b51c391ae975, 0x25e445f9781f3211, 0xb07cab8c992b6804, 0x127666b2244dbd16, 0x7b16f44c10fafd99, 0x4991ee42a0a3f902
+, 0x9cf9800f0816c914, 0x15a5694bd781ea6e, 0x44326219024b6b66, 0x7eb7d5cd63aa5bda, 0xf6f04ca20ac54e57, 0x37cba69c3be27804, 0x7db8afbaf262311c, 0x650752fafb49faf7, 0xbc9920fa4abe7ec4, 0x07c939252d2abe2e, 0xbf241a52e3a4a6be, 0x30039f2aaab88db5
+, 0x21bc8d1f4ff4c1a7, 0x626a1bb1c112fadc, 0xb006381b2fe87f36, 0x4e2e2f45599e042f, 0x7c24dddb80d30c1b, 0x71639d42ab4c3088, 0xb671e7fd7eec69f7, 0x0138166f2c908ec3, 0x0bfe752ae91b81aa, 0x133c88f506fdf52a, 0x388cd19afae7b0d8, 0x63f3ea3a343edf15
+, 0xfd6fe7226aa4f116, 0x432ff9d7044b78fa, 0x8c15319ab5b58141, 0x1de85cb89bab07cc, 0xf34140fb3b92f9c2, 0x786e9c7157b66594, 0x1a5df535197ab7e4, 0x21de9dcb37e6bf5a, 0x1a5c0daeca6b3b55, 0x3b90dd74fee2172f, 0xd4cff9c3e1358fa6, 0x79d1d2140e7246a1
+, 0x5a2830a6f975e49b, 0x67a01799bb778853, 0xded91c9afd0bfa5c, 0x687cefa3d38d237b, 0xf7405b19d6b08623, 0x3ba51fd6b995bb62, 0xc5488adcb406b1d2, 0x5b91d67616c4b4f3, 0x6d18d463abd59596, 0x1f158d019b790485, 0x7ffddc791a3ddcf7, 0x42857ebb4bca32c9
+, 0x369c0804ea48a465, 0x49918521bc59a2cb, 0x066c9d06908e83bc, 0x2b4416cbf22d490a, 0x412c5a0345161fba, 0x589c8a5708c854f9, 0x5ca82ea50fb4d30f, 0x00334e5907d80376, 0xab780e29400c6aca, 0x703701a4d551602d, 0xfe62b0187a2339e5, 0x18b9b9768ab42e8b
+, 0x3b61551a33a2036f, 0x305949b2621a34c6, 0x76ec82e72e41e5f4, 0x257f6b097bd43500, 0x64eab00e24bac5d5, 0x4bdd195fbac75c04, 0xdaafc8b687ac7ec1, 0x2aa31f476e123b43, 0x6ec6cc10c824e42c, 0x4823e765ab194012, 0x1498058f50bf11ce, 0x5a21bfe47a6a13f0
+, 0x7d2ce8e528571c50, 0x2c908c4c7f9e7aca, 0xde58c6d58843612f, 0x32468753c49f5b6d, 0x5aeb2965e029f603, 0x04ddea101646b7bc, 0xbf8aef993ba041b6, 0x0bc0d8ff75da4f0e, 0x4a56c85b1ff55338, 0x6b5b1aa15df843d5, 0x4787ce3e3bcabf22, 0x58b7652105239037
+, 0xc512e2e7669ed62d, 0x292c819a5f1eeb20, 0x893047379f5fc0f0, 0x3a2ca21a81dd3e12, 0xc779e1931684e23e, 0x080c96f98f939cd8, 0xa03dff3d83eda1ff, 0x00d56b028e6e1517, 0xaee51c71dc0cd7a1, 0x3c6706eb7a0bc6a5, 0xd41313da95945c39, 0x0f838cff6f65f27e
+, 0x8586b2431b185f05, 0x2bd9a4af967a86e5, 0x19136fe8fdfc79d3, 0x574f1ff0d47309d7, 0x6ba273980b2615f3, 0x0c42b57b331a43b4, 0xa9bbd6521060a9b7, 0x13b3c1452bfd4306, 0xa9501b6709c71d9d, 0x5681f23ab951beec, 0x62b52a6ef68b5127, 0x4c36e6bd7fc83a4b
+, 0x60ed88daa5565b40, 0x38d46cd3a558c68a, 0xfd130c63ba0a3f42, 0x3ed659d041d3275a, 0x3f0047576dbe3c5b, 0x117dba0cce5f2b07, 0x4fa4c328f0360d98, 0x54fce2089cafcde9, 0xee524db8f6ce061b, 0x32f3731aa1ef5882, 0x1189227648eb8620, 0x45acd6a404b75496
+, 0x44134bbd73447d46, 0x2b0b004be6cdccf5, 0x5b2e9a39c7c2506a, 0x01cf77ad595105ec, 0xc9b916e47b7ea694, 0x517f1f7c61248269, 0x484238e99adddb43, 0x5a1fafe14c74f09c, 0x986ea0db689d558d, 0x3e52b83c593e43d9, 0xa58276121d1a6fea, 0x2f984c086f5da227
+, 0x08ebe301777282e7, 0x7b9040c5de884204, 0xd0d32dc260e8c71e, 0x39e064602b566d8b, 0x9d3606c384b03aa2, 0x2f0f72e689b22bc7, 0xd416f0a9d9df8307, 0x0a00d5a69dcac5a9, 0xe2026183e5bef1d5, 0x382a9f2f924afd77, 0x593d1079a794a160, 0x1855cb27e87c85b2
+, 0xa14fa8d1b02eaaca, 0x16d81cc36bc79a09, 0x987a4b02e2bf1bce, 0x38a74b2fdc2f5a51, 0x7722bc9115afda37, 0x22006c60ef82b8e8, 0x860a8707cc2ead8b, 0x2a271df68a1fc317, 0xd6c69db6b5889728, 0x645f7dc3303271a9, 0xe92ce476bfd8acd3, 0x42d6dad62bff53d5
+, 0x1898f60c8a60c1ce, 0x266e6862ada6be45, 0x55805357dab88782, 0x441137db3d413b35, 0x6f0e335d6893c4d1, 0x1c37da32b1ed6ad6, 0x3290de5c42cef0de, 0x260f7489f5845689, 0x2e60d80492b096aa, 0x3d9639cb3311e6bb, 0xece8929b5ffb4680, 0x405acc80f958f7d5
+, 0x5a07047cf22ae2bd, 0x5d625e3eb5b2b818, 0x422e78333abce291, 0x73b9b26a360cb995, 0xcc911ee4cdba99b3, 0x6a3933f2e66a8593, 0x4a7bbcd8f57c14e0, 0x571d5331cf2e5c65, 0x0cde1f120fbaa85f, 0x7b72ae0ef7065459, 0x9a6e7a34875cffda, 0x136f7d289c401cba
+, 0x524d0713f47e958f, 0x705ab2ed0e45bd11, 0x9ed9d6462d8e581a, 0x0157b4ceea3b5b6b, 0xd138fbdfebb18746, 0x471ea9ea1591f8dd, 0x56a44cc4257a963f, 0x131e81a2a15774a9, 0x2981915ac62c3fbd, 0x6efdc66375faf843, 0xefcd4ddcfa739343, 0x08578064813a1abd
+, 0xe0aa2a6f4eadb558, 0x26522732e2f2bce4, 0xfbc0fc8f7a31584b, 0x1d85a98ac7a8d7bb, 0x2541c66b249ef939, 0x6ebc19d7f3bd143e, 0x6ce8d20dd3bd52cf, 0x2f915c2554294e2b, 0xfcf609f877be860c, 0x06afcaf43042c8d2, 0xa97c63a851a2030b, 0x254784aeb141b99f
+, 0xc46c65523350e386, 0x649ccc6d7a283aa8, 0x3381e17a7ed6385c, 0x78707cdd10cebca4, 0x20608adad5e661ae, 0x1412f66c9632de83, 0x328b85bdbe9891e0, 0x0aa70bff0d358a45, 0x206cfb7c8c48fcb5, 0x131ded8ed6f653ad, 0xfb1c767cfa2b48bd, 0x129c733013e9ee27
+, 0xd6310420d8550cd7, 0x1734e05bb8e8f0db, 0xb0944a8ffe328035, 0x13f19f541752585f, 0xfb601904b8316869, 0x537dd5204b70e0d9, 0x4354fe6c1056bfac, 0x000321145ad261c6, 0x5ed125406a93f80e, 0x2c4c32b15cc9ccce, 0x04b1a5c6a8a215df, 0x5d4dae24372b885b
+, 0x1e447d9c8a390989, 0x13fcca4032eddf60, 0x5e0d62d8d600715c, 0x40cf65f5be6e3b2a, 0xc83e12d5ebda23cb, 0x28cd263beae8e52e, 0xaf736d32441b1d81, 0x39d35de7aff81379, 0xbc263d318dd1c87f, 0x718633a06f833b15, 0x4b70155629fb13d3, 0x394c7f88bc1de85f
+, 0xee5c6f5c313e9c97, 0x42b8eddf2ea2ec85, 0x2296efd53741675f, 0x13a993e94a1784f4, 0x7e0330cfe5924cb8, 0x167988acfefe17ac, 0x3213dba2f02ec5cb, 0x24e9b3839588043f, 0x48afb3717873cd5a, 0x7154b41a764638e4, 0x02058a8f5fa143e4, 0x373bc026465a8260
+, 0x2aadd761f61855eb, 0x2fa4827435b80f01, 0x8a4cbd12cdcd7a89, 0x51afd9407b07d6a2, 0x8eb3acd2527bc447, 0x23534c253f1a5b9d, 0xbd746695f38dc6e3, 0x0162f38476087579, 0x4c873bcab1e46c46, 0x398d74cca205b44f, 0x97e3de2fbc767b80, 0x5c53ff53ae5157c1
+, 0x539d9d26e9976da3, 0x787f5b60cc20dde7, 0x35e118aaf2003db5, 0x7bf8f38d42d8272b, 0x5bb1cbc59b94106a, 0x63c7b821a77303da, 0x7385e2830d003b4a, 0x0229beb47fc160e0, 0x5925326395b2a682, 0x718af9d6e519939d, 0xc256edfaecd17b7c, 0x506f67519631b10e
+, 0x46527ab4020fface, 0x191ea1969578d47a, 0xf002b81be09b47d8, 0x613075ca7ee08718, 0xf23fa84326c5721c, 0x491723465814f62a, 0x3a0be855fabca836, 0x24aee37ca9ad1b1f, 0x1f83f69dfe4f2870, 0x6c9f3a23562fe20a, 0x3f718a6ca9c2e17c, 0x699131bac1258476
+, 0x0d70c22e84c86ff5, 0x1bdcd7e905564c1c, 0x2db7309b76a3f2d6, 0x68a11df8633f5ac0, 0x925ca731722eb7aa, 0x1657e6c4c39d72b4, 0xf9cfbd16343bbc26, 0x69ae61eec4bb35b0, 0xd3fceeaef59f207b, 0x3869826ee62d2dfe, 0xf401be83cfb2f5c5, 0x54bfe2c26a1ab358
+, 0x614bedf13212bc58, 0x0ef353a838eff78a, 0x3cf2c93b4bc2a7d2, 0x10c5cd437fef7df5, 0x79fdad6148b9d855, 0x1abe714013abbf9e, 0x4db62861a9cc27fb, 0x7c42e3dc68cb9fd0, 0x1f175dd444f78048, 0x3bdbe041a16fb161, 0x508cdb356a0fe8de, 0x08cf6e8d69cd8d30
+, 0x7e0509409c0bebf6, 0x28ea15f4e6a6ab9b, 0x88ade6f1c0d15593, 0x513da41081ef5e06, 0xb12edd3000c4d452, 0x74ecd396471568f6, 0xc57e473ce90849da, 0x4d7f425454dd9aa9, 0x95a83f12e78a84c2, 0x5621be696e38c2b9, 0xc635a2a775a03d96, 0x4f02fb7281e864c3
+, 0x0c0f46b393d4f5b5, 0x39063c8776b31b7b, 0x845c817ae20b8581, 0x51e25fb72fc32584, 0xd3c2cc1928aea4ef, 0x418315bc53444e68, 0x57bb5b917583b2bc, 0x2edd1a2fb8460d1e, 0xe2c3ada7b8be8d3e, 0x5e0516eac98fe5f3, 0xf0d3407a24a8f89c, 0x14bfbe9aa430a6b9
+, 0x70aa336434778fc6, 0x104ce1805a9ca2d9, 0xbe20f89f146f1a7d, 0x3844e863c62f0027, 0x2dcc05ab68357271, 0x31409e6935a19895, 0x485203015268f070, 0x2ce80d5623137383, 0xc9b7656f06ee403a, 0x123770c2d35975b9, 0x1177aef2c03a14da, 0x0134b40e091b2bca
+, 0x9700a6de791855c4, 0x3746d2499c8c578d, 0x38419c50e3105f1f, 0x35aa5f8a48b41431, 0x3667b67e9107bac8, 0x3ac34d38e877e531, 0xaeb4ffbf1ca729d9, 0x5bb57ec86ed68302, 0xd7c0c2fcd444f2fa, 0x2447c20b729a06d8, 0xe64792bb74093319, 0x185bbf5ed9e18d7f
+, 0x12a4f4708165276d, 0x1a2cca8cad18b636, 0xaa0f808136ee6f76, 0x45d1c84392d0dbb3, 0x3dffc54f477af92a, 0x3a8d4910a2648659, 0xdd45382bdcad33b4, 0x40cd041e92f00663, 0x0af5d5a5daa661bb, 0x1dbb97f49a67d0f9, 0xc4fa1633b14ad269, 0x141050e0a6a364e2
+, 0x8722de2713eb5e71, 0x6725cdd0ebb9b4ff, 0x2cc2761790d88644, 0x4f5b4263a211b237, 0x6e1ba437ce0a4d2c, 0x339135cf6ec2712a, 0x38ca3113c2447b77, 0x37bace495998d11f, 0x44983490364136a3, 0x15bfad07c93f051b, 0x365b397b1e6b4aca, 0x7ae832e66642de14
+, 0x3cab879379970203, 0x270be17c4162eb37, 0xa5e8e9f58d87bfe5, 0x183faa40e17effc5, 0x97248d33b75c2cad, 0x32791f6ab67c3e9e, 0x6f564b64adf012b6, 0x3a803f1661954ac3, 0xa884b2d9deee618b, 0x0969fa9603343e7f, 0xa94d9e170f3e8559, 0x5586fea21281bc22
+, 0x8a9171823632e3c2, 0x09b3c21ca19b6845, 0x20df1f1a53f39f2d, 0x12743c367e1fcf27, 0xc4519dbd21983a76, 0x78725fc4f4bb2a1b, 0x82314458c352f695, 0x18aa2ae85546e396, 0x3ff0d3d141657931, 0x7f28a0455fd46c02, 0xbd621cc1eb22c30a, 0x035fe93394d4edd1
+, 0x795d624598743bf1, 0x26ae5ded5f8d5d5f, 0x021c3cb8ae5117ea, 0x77203b0a640dacf4, 0xbf0e1e0df6ea28dc, 0x6637d7c296ca9d8e, 0xd829bfc45cdb1a34, 0x5b96af825d5aecef, 0xc3b1dd264712f925, 0x1d4d071a67786205, 0x1ba92d138b57b5ae, 0x2a1bc017d1296bd7
+, 0xe4feaae9e546ad43, 0x2c1b90c85e7198ff, 0x351aac1d2517c0d5, 0x7d1ff0a5d34d4704, 0x72e495d7b18ec93d, 0x3a07a7d01a0d0aac, 0x5ebeb559bb50b874, 0x2377f266ad27b944, 0x263fe5e30c3369ce, 0x4dcefecd2a8c86ca, 0xc53cb721e5a50cc7, 0x5adfa770a54810e7
+, 0x3499e66da4970b46, 0x4b8c507e6b96881b, 0x79fb1c039ca8e4fb, 0x45a829909e3c7ad5, 0xc60bb21f631540eb, 0x004aedd749210883, 0x45ff9841fb9f8733, 0x4699944426980d3b, 0x1a153e0c0ebcc34a, 0x13272e1ad0f7791c, 0xb52a181d34c3006b, 0x08a3e7abdabc8974
+, 0x4c6e67cb4ff0d693, 0x6e4506ce45a10834, 0x81e664fbc5d570fc, 0x7204327a17efc532, 0x86d1ccf7764183b6, 0x7bb9f8f91121f365, 0x26f57b71e4aaa71f, 0x44292068d3442ae3, 0x343e4c6cb8d951a0, 0x32aa4fc7300adcdb, 0x0d11611e0198373d, 0x3963babc774bde04
+, 0x0ed8ee4a5bde21e9, 0x48482c534cdd3ab9, 0x1f5566170c95fc77, 0x2939884979639870, 0xec6e5ee195d3c542, 0x2dc9029456adc388, 0x404955967a6aaf2c, 0x66d066c71d289d38, 0x82b72a0c662ff867, 0x0ca60571b53107c8, 0xcf4fcbe450c376d4, 0x600c2823a69d0471
+, 0x077d656116780d27, 0x14894076ee2e116a, 0x1f591806110ba65f, 0x2dab476bf9c64f96, 0xfb0d7bd8617cfdee, 0x6812902e3f57350e, 0x001572218ffe8fa6, 0x679b17990c2a2b8f, 0xcc7c18bb075eb3d3, 0x74d722528da3da36, 0x392cf8a621ee6995, 0x4b782506f87e8e32
+, 0x7c4f4bfc6e2e2061, 0x7a7a9d9725f4271e, 0x373735459629546e, 0x72a8ce74091c2c2e, 0x7c2a37c168d1ce82, 0x3a96bde1d0e2580b, 0xdc5a480ef27a6110, 0x6c289fdcd0d36444, 0xa9785e16362ce782, 0x1e98c65d41cc5e34, 0x484d39a5fc8ae5a4, 0x58198b9847368b6e
+, 0xf17d82ac0e7d2852, 0x209ff36e1d2abe85, 0xc25cc93bce880080, 0x31311f0a5af8941b, 0xdc69422c5fb2815e, 0x68ca7e0abd3416ad, 0xd4e780d03153c18c, 0x7e234a4ce4790dfc, 0xed1f26a047f66d8b, 0x798823b80e3fa00c, 0x95a732854a480a0a, 0x3fdeea6d416f0370
+, 0x59af7e3c305dc31c, 0x7f35e819bf8b8c68, 0x1b1e3ebbd4092b82, 0x30b15e34eee5fa51, 0x853dcb48d486a1c9, 0x59c7c1d9ae3adfc0, 0x70e52cd06ca91347, 0x5627acabffedf7cd, 0xdb1a6d22556de3de, 0x56576a7f8d501277, 0x165476bd7939d3f9, 0x56e4b9e17df89569
+, 0xb6033fc598598847, 0x51d9c8777468c4e6, 0x9a1beb43f931ee2a, 0x74df2f669458a8a8, 0x6f9d7ebb7457f2ba, 0x3fb2154355050c58, 0x079d5a31bd8ab658, 0x1fb80e88db0a3794, 0x06f2da61ab10de5f, 0x06c5b672b0f13ada, 0xb89daa8aacaf460d, 0x6c4479e759c0e6dc
+, 0x3315c86f190f33ae, 0x022e6baa52ce267b, 0xc16ae1ed4ad70dae, 0x4986572b17c6d68f, 0xf937f3d419e73519, 0x5bcce25776072fa2, 0xbf49bbc0bc3dd31d, 0x3510b7567917e01c, 0xed5ff33596fd7964, 0x2070c561f40f4624, 0x5c630782ac2e1172, 0x5d1db22ebbe46944
+, 0x7ba704136c060be9, 0x0ed91c2f7c1de1b4, 0x8995ae4ed96c46e0, 0x4e5b36b0e930a110, 0x29e1087938c55f17, 0x0e97e35c69b4e237, 0xac7a36148aa320b5, 0x591289f4fd973200, 0x4e8d63b3364901d2, 0x1e5ce4c0346ca5ed, 0x201da39d29436a07, 0x49e7d65fac84241f
+, 0x7233f81182d9a786, 0x44048b8bae789fa9, 0xf1d2fe18b1ea8563, 0x0cfe6816a31d873f, 0x24846ebe0cafdb06, 0x24150a9759b0d23a, 0xe78d3fbcc352d4c0, 0x516f684cd9d9c45b, 0x6e733b16812dcbd8, 0x1663a1c5b16c292a, 0x689a970e8e5b4d89, 0x1d01a8f2b6951564
+, 0xf5d2a69bc2cec7ae, 0x77e55d2eeb07c8f1, 0x0789f7fc38a09e59, 0x7b76748e36c8db74, 0x63fc74dc496aa14f, 0x595b3adefe2b8e48, 0x46b448d9f0478027, 0x4e22bac8f3ac6d58, 0xbaf2e2cfd2b6775b, 0x6c14b6e0de4437d2, 0xaac7a090fd322227, 0x027196304f5d3498
+, 0x4b22ba15b6053adf, 0x0ac3c461bc2dde1e, 0xeb40bdcfb3999c14, 0x55410eecd46b768c, 0x209f2cd37c0a445b, 0x667ba597c802d87e, 0x13edb44e221e741a, 0x0e124e71a6c1cfbe, 0x4842295e1a8f0164, 0x7fc128512cda5073, 0x4e6a3c6871178ccf, 0x5402a5d9edd8ba2f
+, 0xb39863b8d088fffb, 0x6c844576b7a443c3, 0x796a6690e9e97c7b, 0x740b608f8bf737b2, 0xb78548cf0f3b039d, 0x2eca767a2781ef10, 0xbe3b0b2c0cbfa65a, 0x62913dae99db0d7b, 0x02b533bcb3f81b91, 0x29462ab064c31589, 0x8b62604975bd153e, 0x19da3da89fbcbccd
+, 0xac2e9fe1e25d1090, 0x3daf900aad33a4d3, 0x00fa54adf9321e1b, 0x17d5b657f1b3b4e4, 0x0414dce4b9bbc971, 0x14b3675a12bdb58c, 0x54a4b939fd41ed16, 0x5aabe05f422d4594, 0x58f117701579e1d5, 0x5c0d9c7db222d11b, 0x3651e2c6efe30ffa, 0x38aebdfc3922807b
+, 0x3296056a20b2916b, 0x765815d2c1b6ce51, 0xe006f1adae6370ad, 0x3994eb27fad3b914, 0x638b7e653650afeb, 0x4636242f735344eb, 0xe6192596ac9ccef7, 0x2e7945c579bc18b9, 0xd128d31aa03ccfc4, 0x0e09e2d5b6327001, 0xed1cfd81b16c3ebe, 0x1f8cd84ca25d9498
+, 0x399d5eced14573ad, 0x4775f7e8468b9949, 0xbaa51e25235afcd8, 0x3ce01283548160e4, 0x6b44216cb7823b84, 0x0f2f633fcb820b00, 0xece9ae23a123e3fe, 0x5f85c6c370284631, 0x1f352bf5137be9b1, 0x620a77f180b886e0, 0xfd84221c2738d514, 0x7eed5e09d1b77cec
+, 0xbfe89b94f739233f, 0x7edd68e15445b58d, 0xf2767319e6d7db85, 0x7a3c23bc41bc3a99, 0xe23ea50638789ba6, 0x3af2cc261e865ca4, 0x02fece1e0c57d638, 0x26ecbe7e86c0a73a, 0xf82717c554f78db3, 0x4246884713740fdd, 0x5ec17442bd926e46, 0x339c04f49428f159
+, 0x0d5f7f03eac54218, 0x4a80f5b661a61f02, 0x819e53eb943ce0b8, 0x3d3b5f61473df5a4, 0xe9f9d6cbaadadd76, 0x4184f7c052d91942, 0x1780a402b01f79a6, 0x456f5ba3724ccb26, 0x7bc2d811d1b8901c, 0x2d94658e1d93dcb4, 0x9fac34e21b6af230, 0x3df5a38862380c35
+, 0x3d38c30f27bc79d9, 0x1adbc261dea2209e, 0xcbe2aa5390332c6d, 0x5aba0dc0b893ca9b, 0x516af13e2ef3bbaf, 0x33d1aff8104c1e6d, 0x459ce46270cc59b0, 0x352001bcdd6de159, 0xfdf9d3c28741aa67, 0x71e0e86d30ab8868, 0xe93531854416a8ec, 0x46b0666462223242
+, 0x6633bf809930a0a8, 0x1a5e2c73189fc886, 0x7dfba35c56a99fd3, 0x522c4e4edc81d41a, 0x151608b5edb62918, 0x26b2a48ebc7da20d, 0xf0d7f0463f500777, 0x31967cc36748dbfb, 0x77376ccebff50be6, 0x3f7b04c0ebd7387e, 0x96b47c17846e6602, 0x015c2ec81d9b8ea1
+, 0x6b70c960cc1f2581, 0x431664951b5c3f0e, 0x34c773f44807d7c2, 0x520f757371aa093f, 0xb15be15b9e5e6f3d, 0x5f799081170c2a60, 0xc4869e4fa8375201, 0x18ba241c08b0b5a1, 0x97977cc6f9be7b91, 0x360e66b32e1c6a05, 0xcb349ec498d2816a, 0x036b612403eca2bb
+, 0x1a6a4c351f54bdba, 0x1e43ebcd4e8cf879, 0xb4aa439952e1df35, 0x3c7d9099497001d7, 0x5593bb77547b1645, 0x67114d5996c17e48, 0x1770c5db9cc2a11b, 0x735bc47b57ebea10, 0xd260a38375ae7ed3, 0x106a6bf2ddf4380b, 0x946e7334843edcc7, 0x5017e04f3f009d17
+, 0x7c07e88e08c2401f, 0x6a60bd2f6bf80b0a, 0x9689d82552f5e3e9, 0x5cdc543959d08b33, 0x6d5f24f72daee221, 0x149bc4c29d2e8205, 0xb0218d4df9febd57, 0x541c2a030aacf004, 0x098a72eef8ab3af8, 0x232dbf44bb9ea2c3, 0x63ea213ba5c1481e, 0x6850dbb883d4bd0e
+, 0xbf884a36283b40ee, 0x05b394eba5a30502, 0x5b6c1f7bdd89b744, 0x34a429157c18013c, 0x3721b19a570fa154, 0x22dfcd3270be06e3, 0xa49208db92363956, 0x0856861ee04e0dc4, 0x5e8b4792283358d0, 0x3fcd66653dc48d4d, 0x6338fa9c6ed22fd8, 0x16ca0ef1d25e13cb
+, 0x29a80ff404fa3c65, 0x133a743e03561969, 0x56e249bebfd9589a, 0x475e8010ad69a7b4, 0x4afcb006a9aea7c9, 0x71e1a2e7732ec934, 0x5d99b3e59dce2f3a, 0x27056dfaf5d99e93, 0x0bab440f693b01f4, 0x0c4362bbe0ab9c92, 0xf6436578228725be, 0x1a86df2e60e52377
+, 0x4bb4113d6f0cbfe2, 0x0cf82ebc16c594b1, 0xd8123b1a73b03039, 0x070026f21bd08598, 0x22c029f38ef44125, 0x45500877ffb7be01, 0xec502b925af634bb, 0x2316fd3689131afe, 0x433d2fc5f8c5e042, 0x083ab7f712a127d6, 0x9d9a35f9374c11af, 0x23d2a538b45f0dbc
+, 0x174110130d6bcaa4, 0x65dc86c855b889ea, 0x817682e215296280, 0x4fd93514e8aa1417, 0x373900f73ab3a878, 0x0fe4e37d6a7d765d, 0xed95ca4001840836, 0x7c640c450bd55be7, 0x2cac2ffcc6df4f4d, 0x1fa17129bbc41f93, 0x5f6af93bdb50c404, 0x3d158ada08b3564e
+, 0xf8eae016d5ca9409, 0x133be0291e4b011d, 0x36e635bc434005db, 0x5af246c7cc582420, 0x01c30b6ee2e1a46c, 0x32058b567904a490, 0x8510b09735a51581, 0x59ff2f322f1a9384, 0x213a63ca15b33c72, 0x552c81949ea83e8e, 0x2424ecda2b0b4594, 0x7ceb7b653318aea9
+, 0xb89acfe10447a6c8, 0x7c20330c5a678446, 0x1018575b3169042c, 0x01f7326c5f08dfb1, 0x5ee31c30f679c53b, 0x60badff7f135f4e2, 0xafe92f089b4667f1, 0x27a22fee0ca99cc2, 0xadb8c11dd8db27c5, 0x7049f99df56eab29, 0x93793b67df0945f2, 0x2c58b9f08b304cbc
+, 0x83e34d06c2ea7c94, 0x1829a403c4e67ea9, 0xe746a1decfbbbb88, 0x1a101241f944ae9f, 0x938d713c8ba37113, 0x40aaec01c44f043a, 0xde4dd8f9eb4e24d5, 0x73798b2bad1500a4, 0x0b45d542f4d3db6d, 0x41ad61f950cb8597, 0x01bf54007f7c7db2, 0x6801b66ae22c3af7
+, 0x4e70db4e9a6be24e, 0x7ec77496bacb3774, 0x556f40cc43ffe28f, 0x4c58a4e5a506e78e, 0x70b06199b9492566, 0x727ae9c0d61d4798, 0x9b30b1629e9b3517, 0x0d548ab776267255, 0x00634739de333a4b, 0x431a8e2a692b877c, 0x304b43e8da4097fa, 0x1d97eeb8d9612a67
+, 0x7312bbcef5911665, 0x67323679ecccb8f1, 0x5d65851a9148a8f2, 0x3be9608c33365e8b, 0xc0890ad13eb2493e, 0x77a4fe89ca255829, 0x40f47d6c5ad48d12, 0x0c093a054f125202, 0xe96381211f8071d0, 0x430fd6d54c2fabf3, 0x5ffc0d2086642612, 0x4dd6e9c2bd45739a
+, 0x4dfa186a5278df8e, 0x0ce082657a413c7d, 0xff59e5cad827713e, 0x65b7ef3c8dfe6380, 0x55077eec14f69e03, 0x1963329967759dd8, 0x80cef058e84b5fe4, 0x2ac75e3e515d7bbc, 0x473e62fbdd0aae16, 0x1da82e3fc25f7c7f, 0xaad338b3ea8949dc, 0x461ba7c7bd347f99
+, 0x4390acf89286c29e, 0x717642980d32890e, 0x4fc3c0b0de733d13, 0x766021466ed6cac0, 0x9cb6602aea471323, 0x2d2bd78c10f7ed1e, 0x1caa4ccf55dbccbb, 0x1ee061c19b0696a7, 0x3ca1d2a1b69279b0, 0x388b13d872384362, 0x2f41b5ed03b205b0, 0x532865b9b5395205
+, 0x899f69f05e48c268, 0x66b73eedcec37841, 0x06d455482c03a7e2, 0x502e54b6d2edfbfc, 0x4e176242f55ec5e0, 0x6db837fa502b5421, 0x9a56397f8bd82d9c, 0x06aa6461150e7c34, 0x198bd2ba9486edd6, 0x45b213f90fb6c4af, 0x1e367a8d28753e03, 0x15c4bab9767b899b
+, 0x32f4afe39df4b4d4, 0x5d3a0b6333083738, 0x42dc00f15e6d1f7e, 0x31c9cf544c80cf67, 0x31a699f94472f5d2, 0x0517f6d8db5d4db9, 0xaf70643b2f8a9763, 0x636abbe963316873, 0x3089f2ce02b2fef4, 0x55d719e1eda07791, 0x72a26e6655b183cd, 0x029ff3d5544ea869
+, 0x6d5a3bec72480c7f, 0x711361b0e14a6fa4, 0x39518db0cd48e92a, 0x2797149ffeec0289, 0x19caacdda2ceaeb7, 0x4d196857b9bad6b1, 0x8ebba65cef7db11d, 0x1d167e2dd81b858d, 0x4905ad53ad2588f1, 0x695c6f44ca013cf6, 0x750881729faaa151, 0x66e54f36b916e9d5
+, 0xe1c1851797d53c7f, 0x15904d3103345c2e, 0xf828d4d7014e7ddb, 0x53a3713594133ebb, 0xebd98ea5a6be2a6c, 0x071aceaea6ac56fd, 0xb734d3a308c9a980, 0x4e4ccb56c078f87f, 0x296d6730821de164, 0x035274508bcbab34, 0x854a84a1db0e36cb, 0x7ffc1444052bc4b1
+, 0xbc4642cb8f621955, 0x7d6255a2f8976c54, 0x3d6a117b86846fb2, 0x2a4a430e4d937b64, 0x89ed1c64508e7b53, 0x1ef8a9b43f4eb7d5, 0xdf4be321bea233fa, 0x74c36b6dd335af2f, 0x6d94667e8328d197, 0x40a4e1598b88243a, 0x0e7ba67bb5812a1c, 0x435e1027bf1942c5
+, 0xb8f25c986434aaca, 0x739919e6dbd70c62, 0x5ee74c8328049ae7, 0x4eddca07f0603b53, 0x2320078e4642d25d, 0x0158f37e99adc68f, 0x18235aec03f77c2d, 0x2b4aa499e2ba8e14, 0xfe36f0170a83c7f2, 0x0e7395ad161cb457, 0xa7c19a8257bf9d1e, 0x4875edcdac890ca5
+, 0x4f7244a31ef71a16, 0x544b40cbdee69f02, 0x0e7db919e0677d11, 0x44948fc7f22663f2, 0x76bbdf35cc522738, 0x306d44ff82919608, 0x0149e2d8a9be88c8, 0x60ee291e8e649e4e, 0x8e9a442bfdf31d43, 0x67715a425a7f6292, 0x2b920ce5b65781d4, 0x685d659b52b2939c
+, 0x68281270d7b11929, 0x6e1a7bfeaa291531, 0x7695532c5b2b0eea, 0x7584b065d3b62061, 0xa50cdeb3fc9b6979, 0x2389489c7896debb, 0xa0ca01e141b49f53, 0x25856ea403c86ed6, 0x7274cbc05ba20629, 0x3b251625d56d698d, 0x6065781a981aba08, 0x0a6d4e5ebaaf5180
+, 0x8ae89163328912c2, 0x063d9f8d9dfddd37, 0xb6472fb6828c6457, 0x34812619fbd818a5, 0x9b66ad2271f89c96, 0x5fe61e75c25eedf9, 0xac11b25e79e7e44b, 0x5ce156721fe90690, 0x9f953d68ecc744f9, 0x712d49ad410bb450, 0xc76af356ef5a6aac, 0x202378566dbfb8be
+, 0x8fba701caca7290c, 0x18219276fa61370e, 0xd5f351c0ec7a89ba, 0x45ee267aa5f14eb6, 0xb7643bacfb7c30ec, 0x111992188f61adad, 0x6736ec021cfa51e6, 0x46e1a278d9c5936a, 0xd6ecca74c5ffd078, 0x79c6f78135da8aa5, 0x4f36fd89b931d217, 0x4afae213a780605f
+, 0xbf992e53d4f698f2, 0x463d8565e4b2816b, 0xc51db1b0b6a37089, 0x3a1fe72ac09366b6, 0xe3b2e0c3280b2f11, 0x0b751878b0a9c892, 0x8117d75f4c38389f, 0x77d9b973f064a252, 0x505ce1cbf4e0ad49, 0x5627fe71e9fc32d5, 0x1b3ec3dc9077a689, 0x48eee244393865e1
+, 0x3f8b9c18d0079ee5, 0x43146c275f2d9bbe, 0x30ddfdde86e01921, 0x77684da06eabbd12, 0xba617599a7eb2546, 0x21cfc5381516d2b1, 0xfe5379aba26bbdde, 0x506f7aff414d9ed1, 0x95505351d531c634, 0x0a30f37e06c524d8, 0x08ee830326da3548, 0x19adada6de360144
+, 0x9b4bfee966515f81, 0x13ae9377300b9051, 0x0a56ab92f917343c, 0x2b83017204e1ca7d, 0x989eb55123d4559b, 0x7e0c5edaa18fa68b, 0x719c5394db23df62, 0x0f15477a88f96600, 0x134fc935112e3ba7, 0x3fee9a72ab89ca5b, 0x3abd33b287eaac4b, 0x05a1d5bd6eeaaeb5
+, 0x8f60802a565864b0, 0x44f84f5d0d1add3a, 0x1cb9ca6db784c430, 0x5ce0d4138b4ec791, 0xfce6bfc2f19df0e9, 0x62876e74e35c27f5, 0xe0fa6da765ae71ca, 0x32628840426165a1, 0x8e60cc644ffc380f, 0x1d44b5945083bd05, 0xab132f7705d5ff92, 0x50877d84fca624ae
+, 0xca524506df6e1c91, 0x491af67522e3bf6e, 0xff8ba24a3f2168fb, 0x301daf4f9b93eabe, 0x5e00c62aa381762d, 0x100646c8928013f6, 0x1fe138cfd25542f5, 0x7aa7ebb3cee4a58f, 0x756053094e852ebd, 0x2d0c177f009a9f1d, 0x41310ff87abac82e, 0x51dae62023302826
+, 0xff6485ba6ef70032, 0x0ec70e87482073f6, 0x84caab5994b16945, 0x1910d1d3cdac8f2a, 0x58c9aa1743ba9de3, 0x6debb950c695f275, 0x53d1e1baf883fd48, 0x20823b8d6b311193, 0x015cb2bdfae15a3b, 0x0f9735871c9fa7e2, 0x61a507127ba4676a, 0x1e5dedae74ae19d3
+, 0x3c37d4ec44138c33, 0x5a89d28dfdfe9503, 0x5b086bbee4940e85, 0x08ea3994443faedd, 0x27967dadf57f83eb, 0x7eac9b5162505813, 0x8e56535f4d181e6f, 0x0f764e90eba52d5a, 0x33dcedfb4837842d, 0x3a9497d23ed8efac, 0x6f9d0ae5999cfa20, 0x72909d67fa0517f9
+, 0x4b0a3789a5fecf12, 0x2668454cced4e330, 0x196a75d25e3197d5, 0x07d720ec57846d29, 0x0c8dd4975b7dd25a, 0x3ec906a44314543b, 0x7ddd53901b24cc83, 0x66e87673ea98d12f, 0x332ef9a096dfc07c, 0x68f56f32e6f048f3, 0xfabc7a137fa06cac, 0x40d27a865f80ce26
+, 0x6ed3b3f5ed815c25, 0x4ec7fda9220b03ad, 0x10305e36fdbf4f53, 0x5318539862ed25fe, 0x492c9a75036bb5cc, 0x7c6009c1f51c96d0, 0x37dbfbcb5acf3206, 0x717743660fe4c659, 0x132be8cdc1c95418, 0x6ae265277c06a911, 0x94bcf033a863a43a, 0x6a9592d3bebfe147
+, 0xfbf7fc0cd25f957c, 0x557a2954435348d8, 0x6a74d55a82cba8eb, 0x43edbd56324e877b, 0x3b3369aab6f07298, 0x0c0d3e9d185494e6, 0x9d8fdad6221fe99a, 0x40dc27f28c7cb7bc, 0xc834f4da2f8342d7, 0x611548700bc4de3a, 0xd9022139009c53ef, 0x01dfb70189adfa7d
+, 0x5f011afd099b5758, 0x73355147e3697fe3, 0xb86d641898ae120c, 0x5c8614c9f3d573ac, 0xecb16f3d5c43dc1f, 0x3126b7c1c647bd59, 0x8e930ab55593076e, 0x4f7f5dd42a0915ce, 0x3a6f610b1d3ffeb0, 0x07d4961b8fccd602, 0x72da09871415c3ab, 0x6def531297130cd7
+, 0x184b6543ffe2436b, 0x1e62bba35eccceb4, 0xe1724f3e65d69a32, 0x7d90aea81d0a3303, 0x7c2ee98cc176f7ac, 0x0ee40c6fb81b9306, 0x2b7ae49a15c55879, 0x143d937360860fc5, 0x318d5c6938b85892, 0x291af0c28f4f4b3b, 0xa550e850930aeacd, 0x686bd993a5eade48
+, 0x0d330cd91f0f7bb5, 0x787980cd9195732d, 0x03f7b1857614bd4f, 0x18ea18c8565c582e, 0x6a752fd0fc2de0d8, 0x3a364708521af12a, 0x368fa169cbf5ff7d, 0x3028a8d893f2ae40, 0x5649f286e2224938, 0x335e6eff686b5f48, 0x2652ae0ed41006b4, 0x61c0943cc01bdfc2
+, 0xd4869291610036bf, 0x4e1666cda43402eb, 0xbf3ebcf60d805074, 0x2ba249238b7135d0, 0xb7967311b79e15ab, 0x6e236de50999f8b7, 0x8656fb41914534ca, 0x742118800a40df09, 0x9dddca3fe3a761c4, 0x518a9378043c7c9f, 0xc2d3df3ba635b781, 0x1b9b92aea5c8d0b9
+, 0x1eddfa46f0d39f14, 0x479772c4793e680a, 0x23fda161214b4f66, 0x03949bb90936c68c, 0x88373e22baf39bf8, 0x3c1b460afbb6778b, 0x41695df8a9c3ad74, 0x762dd9c94aea583e, 0x73bf1f8098dbef09, 0x02e040e59192ba5d, 0xb0c9ee1e57a9ef8f, 0x682371d3cc7b1a0b
+, 0xc2e72a5b600a844f, 0x7d29156898c0a9cf, 0x28625d3fa5412f17, 0x5c3663d34269fe34, 0x63347188b978cf80, 0x6937b314d26eb271, 0xd3b5ba2becad1e31, 0x4dcbf0af2e9520c9, 0x3a3df5dc935ffee6, 0x0b90aabab36b31f7, 0xbc736ce064e9b07e, 0x546c2de8fa384daf
+, 0xd92d982ee50c5fca, 0x5b01d063c0c7a7bc, 0x4c3567821f40fd7f, 0x76d3ba6c4dbe2a80, 0x0d4b7b9643c99ec2, 0x0b30d5ea36ebd05e, 0x349f28dcf245a993, 0x0bde74df1df46e2c, 0xf579896e159b4a68, 0x18aad92ca3ebbb05, 0x8ef17c318efb5451, 0x2d5d9308efc2d1a5
+, 0xedab4de89b6d2133, 0x56d567b2e7bae320, 0x0c78bed3dc604509, 0x675041f39a77cb28, 0xcc1dd878a2934c5f, 0x0075376983b15fc6, 0x18fab4ae94632c31, 0x58599ec723700c00, 0xb8f99eab66f46a93, 0x6ebd06a9caa7fcc2, 0x2b5548a9fced696d, 0x1f20e343939a5579
+, 0x54fb1896ce239d78, 0x63cfbf12679ba351, 0x9647feedc5d876dd, 0x6a7447d3636f18ce, 0x557b37f1a8278084, 0x1fc7768f9f248901, 0x48023fb04cae0d9b, 0x3de068b7e40691b5, 0xae6f1f2c57ede80e, 0x176753744036f2e7, 0x9f3b86681ab23601, 0x544f8d5e5b0cbb51
+, 0x3756d4d479c2cc3d, 0x25d44ea8d31543de, 0xd82c8bef26bb2c43, 0x2c2047033d27f37f, 0x5bd33d9837dad260, 0x77943117a3383b7d, 0x12071d697ea583f2, 0x3c7c41272a225bf2, 0x92ebbdfaf1f03ad3, 0x5d61030c68b63704, 0xca6e2853baee75d1, 0x12404b34771a3636
+, 0xba58d1c61cccf74e, 0x2a88058ec35477fe, 0xebb69f1a7a581406, 0x5dfdb4670149afb3, 0x023e6d22635445b1, 0x0f4ae2b15efd1941, 0x8bef1dfa268c954a, 0x33775d047829a7ab, 0x7661539827d53b25, 0x547e606dd31a023d, 0x3601718ecb42c93c, 0x2e3a54c551d33ff3
+, 0xa5a699acfd81ce22, 0x1ce162da705d8256, 0x47c773384b620074, 0x60af54d04b4137c9, 0x93151df14dba40a1, 0x0cb02b9bf746f737, 0xf7e15b6f3924b08b, 0x73298bec8c58718d, 0x7b150f92f7d37bd1, 0x2528d35bcfb320b4, 0xd621d4093e278a58, 0x6445adb85909462e
+, 0x67e207ab11e56e41, 0x7d15508830a5a7a6, 0xcdf389f0375c3a73, 0x627d7db4f91b322a, 0xa9761c743ab5967c, 0x11aee54dd0f0eb62, 0x2196d32b896c5f1b, 0x4f1f249251b29d12, 0xaa5b79a917690186, 0x46170f09ac258ff0, 0xef43d0b02a0d4104, 0x50e6b5bccd805b8c
+, 0x41405d43f53fb3f0, 0x6cf4b75a10eb719f, 0x998949bd6fee8765, 0x3162ceac4748fdd8, 0xc24447d84e522f71, 0x207e91df41aee216, 0x0e26597b61340436, 0x33f8cc1351bfcc6e, 0xb7cfb4eed2523cb6, 0x67d12d4d3d6beec8, 0x8997b4205f1dbe05, 0x16542d301cfa4090
+, 0x78c0f303a6631931, 0x4156d7c971b32bbb, 0xfec5303853694d58, 0x55b5bc32316524bf, 0x0a6789ffdcddaf74, 0x57c4cb4631e82bd6, 0x6c1a7f28b6887133, 0x134f69dbeee18749, 0xc180375380a20762, 0x585fd5ec7ea47b6a, 0xf481819646a229b9, 0x530797a7c8feb1aa
+, 0x8631cbf64deca12a, 0x6c5b1c1fdc88ca57, 0xe17a67852181ef57, 0x0ff715a6cb998ca6, 0xb37bb1f8fe0e46a3, 0x4923bf187a8646dd, 0x5c5d4b059131a3b7, 0x0f548c22e5de4b1b, 0x1193070769bed311, 0x0c1a87bd8b5cd964, 0xe100ce82273136d2, 0x65e2c695e5c04ae4
+, 0x88d019baa7bf0072, 0x2228d3627ce25c3c, 0x89a9eef5e8e2ca06, 0x50bec7fd0311627a, 0x85517e2c5ee1f62f, 0x482d910ab7d794a1, 0x5f1363b9c7a85275, 0x0b732f6b03e5119b, 0x796714720f8c024d, 0x639e77e2fca5955b, 0x15789a1d7f197c61, 0x0bea20bf7922af25
+, 0xcea03c4e7dee5c31, 0x37c4e3159bc69bf6, 0x028b4f4e1639bbb3, 0x0a29f6202331e64c, 0xb4c74f5157e30a6f, 0x276c2d6acc306600, 0x0e9afa6f1351e285, 0x0e9cf4babc51f000, 0x2f3718ea6f53ec57, 0x2ba3709dabaa1ff1, 0xd499b0080558a168, 0x1c8efbb115af426d
+, 0x30fdc8731dbf2551, 0x6ae99cece9ffff27, 0x32ab3331564e4913, 0x0bb34b93d40e4396, 0xad5eb9d728c4e0ed, 0x7703046b6bb0061d, 0x81c281bbdc6f3601, 0x65b4fb230e8bcdb6, 0x9cab10242e1d4639, 0x5d551442521315d2, 0xf21f843a3b6e3ff4, 0x3c2a9266394a7d52
+, 0xc44a4d5b83215351, 0x2fda9b5e66e1606d, 0x860db235420a5037, 0x05518fa6d0b9aab0, 0xaac89f8d049d938d, 0x48d8809a0fe8c491, 0xf53f85c4f6f8ddc5, 0x4596bda1e2fb08a0, 0xa270bb6ba1ff94be, 0x5c820d472f0c56a1, 0x13ce0d88bfe28d33, 0x27963b2ac5e89df1
+, 0xef2c0e24bd8f6a9e, 0x491280c6fa1a1751, 0xa0d9f0b530af0a22, 0x5d351d118e82b3b7, 0x7425a4d31f15582d, 0x68b0b3d4abacb19d, 0xe54fb59a936c002a, 0x6ab6de8dcf749ff3, 0x60d95a89c69b45df, 0x3fef00ddd8e7bf9c, 0x685210416ad26466, 0x1283b2efc35c045a
+, 0xcbe08bb9a541c924, 0x46ffb3392aa0785a, 0xd1dc3b3072b1d25c, 0x4113ff838d504ffa, 0x33203f9e1241588d, 0x65ce967e8805ab9a, 0x5f3c0d8399277bc6, 0x1468da844153cd8c, 0x01e3f80e3eed9543, 0x05d5715b742fac96, 0xb98cb4c84dd7f365, 0x600a02c541011042
+, 0xe62e5eff88c85424, 0x68db41c585a84826, 0xf0c54ba6c44c27fe, 0x1d551222d6a1ffd2, 0x4b2abbec37249d0c, 0x70de6e36e6bb8147, 0x0faf185e28b443f8, 0x39d267f26dbcf419, 0x0425bba594e9bce3, 0x2c50a2f382b2ede6, 0x23237f8a988112a2, 0x78e2ea702ce53db1
+, 0xbc867b10efe14c93, 0x4dd6c1078caceabd, 0xbee7212f9506ef53, 0x2c99dd2835c2fe5a, 0x0554051a5430ec09, 0x706c8558672d880b, 0x26e01759ed040945, 0x384bdd46e1e1d200, 0xdc9ed8b6b88af995, 0x041a713d6ef1614e, 0xf53b02073cf4fbb8, 0x435c3e53324071ec
+, 0x13c07749f017f424, 0x437492495bf96955, 0x3b9288fe9e304aff, 0x1c954068ab31c16a, 0x54c4b01383524fd9, 0x70d646836d77d656, 0x93aa4fa86628111a, 0x058507e968a144de, 0xd5264510fab64651, 0x1bf93f95f8a68ad2, 0xfbcb428951f6dbb3, 0x4ab27d68334e6833
+, 0x91f890d80f773483, 0x0ff9f0d77d767554, 0x1a3f6a26f8accbf3, 0x050bd21f9c5ea745, 0x8e2b0909a603a6b0, 0x2537d66c083241bd, 0x9c5df026ebdd01af, 0x289c9b786550d543, 0xc901680f9b693407, 0x14c07c4350e03f5c, 0x490d2e1338f3997d, 0x6189d5d9548f384f
+, 0x3fd5dac8e8e0737d, 0x717762d4abf0a663, 0xbab63c54e3b68057, 0x3f14f16b3a194c8e, 0x1f870667286c0589, 0x10e4b142efd5e470, 0xff5096a9e5200e22, 0x0a37e910441faa03, 0xc96fa5412741b6bb, 0x43b90ea7e2ceb01c, 0xfbaf8335ddc9e8d0, 0x53b17294f67d0084
+, 0x55c38c1fbc1d6088, 0x1bab7ba28304c2e3, 0xfff2a224ecbc4782, 0x2059fe6aacef69d6, 0x432f98f18cc8a3ae, 0x07c50550a3919dfd, 0x1186520951399ed4, 0x4d22723e003158f2, 0x8753a21866036625, 0x68d0a8260b1155ec, 0x22ed50f756cc5e80, 0x4c26b5b4045f4d81
+, 0x5def8a54131ab1e3, 0x007c11d0008e9ec6, 0x26eb8ff91b04b9a0, 0x2e1f7bd0da682cd3, 0xe4f67611a9c84463, 0x1bbd081efc31882a, 0xac711e07f701023f, 0x221cdc8fa08f8bbe, 0xaa92c2ee938b1ed4, 0x0e65525f06110f07, 0xa84e262bacc12e94, 0x331cee0ed9a05e6c
+, 0x2b6f2f323ff6cb51, 0x72b5f71a980e3699, 0xd58f08cdd7886f4e, 0x23f560d09f47e358, 0x92e2cf1b1565e4d5, 0x0ce2f7ded131beab, 0x49961d6fde7375a4, 0x4759a24653d93cc5, 0xd5b84cdc9008a0c9, 0x2b772857743b23ec, 0xb87fc838a7e955ed, 0x6272eda5b8f30504
+, 0x4efc122b83bc3ee1, 0x216b7475cdfb24b1, 0x2cc3c6418dad90c7, 0x2af6ceb9b2a0ef97, 0x13d6e883647e6434, 0x0951d63838680047, 0x8146e3aaf015a9a0, 0x52c79522a1210b98, 0xb3bce3bbce710d12, 0x0f7de0f156f17524, 0x2868ec6627311a41, 0x2c3b013ce4c1344d
+, 0xe9fe4d2a71f18dbc, 0x3357c38929871bc0, 0x9ebe833559aad802, 0x18e81852af3fb6a1, 0x62aa99a4f59a0503, 0x04e3d29dc0805830, 0x0095608b341a7f29, 0x78fa4942e05b46dc, 0x944d9318eb4beb24, 0x423fa5bc38505ee0, 0x1f67abebbca97e3b, 0x39ae57f2dd2175ee
+, 0x2866804340effd9b, 0x7487cfaabf53f9a6, 0x20997ebeb2a1b99c, 0x2aa66e6e2c7f4637, 0x5a4f4f132f9b9584, 0x5918aa7a92e9b4d6, 0x7852c05bad56e38c, 0x737113307c463553, 0x3cbb31d57d528cc5, 0x6f3b433541f77f97, 0xf933c1178bad578c, 0x02ea5e10b14cf55a
+, 0xcbfe09189c361f62, 0x2aa8d05507be026e, 0xe173021453c52a1e, 0x46b3af0602da2145, 0xe52811cd016c1262, 0x3a08505118fa06a5, 0xd79de5b443efdf29, 0x21ab6c3753ec6939, 0x3c4998c4f1118cb4, 0x30d76547e2b2367b, 0xdd4bc7d6bd6ea0c4, 0x2232ae044a107031
+, 0x2acd85d7ccdca5d3, 0x37d1400571caac55, 0x6ac9e219bdcfdcbc, 0x67aaf053aeb5a209, 0xeb0796ca29f7733c, 0x3f871309bacbfa4e, 0x4c18ef9c6703a58e, 0x597e9ac5b76b0cc4, 0xa1a9edd5e5f170f0, 0x38984ed4c54a863c, 0x019a0f26b87f8be9, 0x7082d7b832fb731d
+, 0x651e0ef34dcdbe3b, 0x69e0bfe143149792, 0x25de6e7e3650b9c9, 0x5603426c91b54944, 0xcc05acb60bf4fcce, 0x6f0bf94af78b7fdd, 0x60f23399d9f8f3df, 0x511034acdfddea25, 0x60b54fd62e49194c, 0x063337faba26c4e2, 0x405f7f5022f782fe, 0x1d5cc3e2cda0dbe8
+, 0x65dfa922dbd3ba36, 0x3ea493120efddbd1, 0xad45a2f78ab789a5, 0x33c5ea7a234e1c6e, 0x69c739f819cb2233, 0x775218ec25ac972b, 0xdaae4154d8da417e, 0x2663bbcc4270a02b, 0xde312818c3e58adc, 0x5817db2cc98d73a1, 0xb2b6ca0371d0da6d, 0x79a34b9555d93f06
+, 0x59d53bab45e4cead, 0x4ef79143540cdfde, 0x595af3dc510252ea, 0x7d28dd847eb37058, 0x30168ea36433b1a9, 0x6df175379760a37e, 0x816334a5ffb50125, 0x5b14eb97b1a13431, 0x5ac5b714a1942dc0, 0x674ce8abbe5d01f8, 0xd0dc382b133e0d7e, 0x5e40eaf65acb5dd7
+, 0x6e690008bc864124, 0x6933df9128bde28d, 0x143a1ff2f74a418e, 0x371ba9a3ff65c7d0, 0xff340d5da3a3e540, 0x6014b34edc99284f, 0xf04ec7c861bce670, 0x74bcf82710353df9, 0x81cd1ab7eee8bb8e, 0x623105a198684976, 0xa8c2f1cd2eaec831, 0x57873fa64077ee0b
+, 0xd480b9d4d497adcc, 0x659a11721fc69352, 0x1092a754f3127fa9, 0x7f648afea207c48c, 0xf48e291e190e1a8d, 0x2678f6e306cbe668, 0x24134f928eeeb1b2, 0x358aa9971c19030a, 0x3198a45fa6a95993, 0x17d455c48ab4dc54, 0xd5ae1cce1dc00594, 0x7ba6eecff4929196
+, 0x125a106b71e98c52, 0x5b3d1ef21ec345e2, 0x95dc722524c2f56c, 0x06a7217abe2aabbf, 0xc260117f49e6b536, 0x74b849504a4cbf26, 0xbd1a65a841f1c8f7, 0x59fef0c85619320e, 0xacdd6c4640e86ef9, 0x5adc722823fdfaa6, 0x7ee0b77bf046cc0d, 0x3c4e28e6ef128f34
+, 0x3c37c8ab12965332, 0x3f2cc6a5a13de9dd, 0x0ceb749822a498ea, 0x4fb23adadc8932d3, 0x5d024b08c3d4fd7d, 0x10615f2b4fb1665a, 0x7138b43159cfa707, 0x3da813b37f69b646, 0x7c2965c5839ce560, 0x4ab60d30567c876b, 0xc0b81dfed3387173, 0x4bf9960a242477fa
+, 0xccb641d864b55491, 0x2853c97c307e9325, 0xbacdb9824bb68087, 0x51ee87afc13ce479, 0x9f3d4a8eec8d5f80, 0x7f5cfc6d8e1dc868, 0xeea12dcd20bbda27, 0x6c2c1c447c20a55d, 0xc9c49dc8c8cbb778, 0x453090b11e01babc, 0x87a0dbe10ffd79dc, 0x4842e57e81848d00
+, 0xc3eff2cc7b582389, 0x33beaa57466b2542, 0x302cd79272efe602, 0x3dcf27d42bb3b74d, 0xff4ef4488810273c, 0x127fcce1aa4c3c0e, 0x53e47e29e11dea54, 0x6d395991d69dd018, 0x100a2c62faf6c3dd, 0x0563f1bea59a6cd0, 0xa38e7867debdf6be, 0x62f5398373d38d73
+, 0xa73c1dd19a736c09, 0x35a348f0c9bba19a, 0x84c20db9a9fb7c92, 0x670ac4093e578152, 0x4d82ffd481d0ec77, 0x5e18b301af3dbdd0, 0x4b07be5bc6a2ad1c, 0x53debe326552550b, 0x985a551ec43a7a86, 0x1c4d729d0c56e048, 0xe94ab2ba945c2734, 0x51dbe5b287c7c13f
+, 0x81dc4ebf5008659b, 0x55a74b42dcc4affb, 0x4b0d1f75c77c8b72, 0x7c3a2faac9ca7799, 0x13b092565d01d743, 0x1394fc2a63f97f36, 0x944e59e5ddd04e1f, 0x7b95fc05f67f81bd, 0xa7c108305be2718d, 0x39cadc136ca5002b, 0xa89943fdad5b9247, 0x061cceb2c99dd81b
+, 0xdf2268a7d21817d5, 0x3670df2ffff76931, 0x825c396f4c1c74b1, 0x63e1897216228544, 0x8abe95e7ab5119db, 0x6ade6c4a4f2638d8, 0xcee5e98dae2bc51a, 0x7df274b848a41777, 0x52a373fd3f81cfc1, 0x0d2b97ae12e7744d, 0x73fbb07f76216dd9, 0x6b68c57a1ecf63d4
+, 0xdf647fb39951b535, 0x2c5283a5eb4895ee, 0x347e2e1116088c05, 0x756f8713983687ba, 0x936de95fe9d02dcc, 0x087dbc8936c76acf, 0x1243da5e84d88e73, 0x170aa4931a37674c, 0x7398e4d4ac45d5fd, 0x593f47d9892bab2a, 0xc7a14a703eead951, 0x34bc894b48806b22
+, 0x70d1e711a15ad5c9, 0x499dde19cc091f35, 0x925cea5b2151f1f8, 0x347d5446654965ba, 0x497f21ec153465f5, 0x5a6dcc090cddcdcb, 0x794e149e891f23ce, 0x56210e9ef1240781, 0xfab329b7599152af, 0x2a5a2030c7bdfa85, 0x0b18f19e528b09f2, 0x32c41fffad3d279d
+, 0x8caec7a50fb747ad, 0x35ea38a738ddd4b8, 0x7a2bfff351d46bbc, 0x0870c6842efc7cda, 0x21c9dae675dabbb3, 0x1d77c45956d1e2dd, 0xd48e02f5c3177340, 0x6f0d2ba0875eab4c, 0x416e1f88a55fd26d, 0x187b01f24461ee86, 0xfe7dbf451f93e11f, 0x539c0b49c0e7873b
+, 0xcb017eb71be019b0, 0x0ba61054b3c20135, 0xd47ef95611f6f45d, 0x2867ea917066ba81, 0x05770627deb4bba3, 0x63f9e3d57afb8b2c, 0x1488747dfe5b0553, 0x0265a0ee652ecbb8, 0xbc0ea4afa0379ab0, 0x74884917b517023a, 0x7657c86cdeb7f863, 0x4a325dbcd109dc89
+, 0x92ceadcebf615342, 0x11858856c06ce922, 0x9837e2dd9d95f1c0, 0x26029404154ba998, 0x44ec1a266d0abf40, 0x3e90ee139c6644a3, 0x6c533f53c3d56975, 0x5c1c7b1ef622b8f4, 0x742a3eb4a73e3698, 0x5a2dd6de531dc2e0, 0x29c1ca3c039d45a8, 0x6cb1f04377256e43
+, 0xc67a480f835f8194, 0x3540ff0b2f124ec2, 0x1aeb8b5675c1b9c9, 0x52b5ccf8e9bd948a, 0xf114c8a60f09aba6, 0x160fb8d32ca2b5c3, 0x32a8701def77e316, 0x7203698ac262986a, 0xbdd2d2ea471945cb, 0x56d2eecfcee7bb21, 0x07c3ca50cd0f7696, 0x1eb17c515dc74d32
+, 0x303f9fcb95dc2868, 0x4b2071f7e1915f35, 0xb914c3ed6fe1569b, 0x3487cfa7779cc855, 0xce40e160dc007ad1, 0x206b2f65874accee, 0xf320de397672af2b, 0x27410fa1a9d0fda8, 0x5ac511b4fedc02c4, 0x198358b02463c780, 0x7a8f763cc5189906, 0x07bf2e78035b95c9
+, 0x148c6c1f71ed8ee6, 0x6cce516bd1012795, 0x09cd8cfef27692cd, 0x150cbe2e587d04eb, 0x2b7ddbfdbcdda5b7, 0x29b2b16e59c81544, 0x776cbe8227fb3411, 0x19690fa82f13ac63, 0x8d5dd57d97d42287, 0x0a5f465827985139, 0xfd64d2276aa0c52d, 0x14a8a12634636243
+, 0x0e4d7a453c20af91, 0x1820870385a51134, 0x76f441ed323ed259, 0x30fff06cf99b96ca, 0xa3d7128a2d544fdd, 0x04b92b1b8473680c, 0xa081dcf6e5c04e0e, 0x40cdaa44494dec65, 0xecfb0aa1f699da5e, 0x30095644085df98f, 0x0e6df717419f8c59, 0x101d557d0e285a05
+, 0x5778ffe8d8fceb42, 0x46ad5bf70c79d038, 0x6e50585d267486b3, 0x711606dbc5e5d1a8, 0xb46e1d8033d7482e, 0x7a9d7c03979f4421, 0x057d03a68583ea94, 0x0b192645a68f9f76, 0x69c551c7829dad74, 0x67f59c1df67d42ab, 0x8fa9d1e7e56d36e4, 0x338be2914177e2f0
+, 0xab06be8896766327, 0x26268a04bca43315, 0x224169e9098241bd, 0x3fd151b065a6ad8a, 0xbb29961c00575c4d, 0x75c63e3ad2145f6b, 0x9a97e4bcb8a72167, 0x12131a55e17a6a39, 0x962c76b19afd1064, 0x344fc60e1fb634ea, 0x8c2dedbac1cfb446, 0x78d6c93a1d945018
+, 0x2359e25578cbf8fd, 0x1d12ef0d53f12c46, 0x315a0fafe961c9fd, 0x75208bc60c6d9694, 0x494132d4fffecf18, 0x0b102ed0deacdbc7, 0xb4770616575e84b1, 0x0b83e39064630cf3, 0xecf22d832b67dc7e, 0x6440d4dc620cd5b0, 0x946a702e702e5aae, 0x10e2ae00983f2fcc
+, 0xb38a8379df6e6b0c, 0x6a94ead28011e832, 0x10c264b9bb6d7981, 0x750062836acbc593, 0x996de0d7d5ea0205, 0x1f72200c74e3d956, 0x0b1bdd6f28802d2d, 0x51fe6044070215d3, 0x03f29ef31111653a, 0x1a37d8d2d4b55b3c, 0xff452f73872369f5, 0x22c390ce1a606344
+, 0x912daeb2ed15fe0a, 0x54f09667b18c6882, 0x2020b58d2a74fad0, 0x69cdc55586af2488, 0x7749261d18077e03, 0x5829c00b1d28c7a0, 0x9b57438dd0551e0c, 0x590deded4a84fe19, 0xd4abba656caaf0df, 0x05b9563581505414, 0x0a5b943e5a519d24, 0x0a913f7108deab05
+, 0x7bb021c3d3da30f3, 0x486dd37b8f43f57c, 0xfc10bd3b0c1893d3, 0x3ec977ff24a66893, 0x443ea634cca6a793, 0x0bb4d2d191ef08ca, 0x22cc019aaf631b41, 0x4ee368b95264f061, 0x2dda2ea1aa844193, 0x625cb985bc6f4192, 0x42d4d7f77e8f811c, 0x39add0c5a752bd30
+, 0xf3561acf2476538d, 0x6f6b4f82ad1b755a, 0x9e8ccc50dfab3ad7, 0x5628a5ce26ec45bf, 0x029744dd8ac52c2d, 0x65c9594a33031707, 0x7db2fa3aff6ac041, 0x21c34897eadd0669, 0x1eaa41a8023f85cc, 0x4510260fd3f0e83e, 0x1a280f80dc50cdba, 0x05d462e79e0366dd
+, 0xb8ccb04402b12ad7, 0x36020b401eaba36f, 0xa028dce2512065df, 0x208207c87d88c621, 0x5655bfbdd9244309, 0x53184742b028aa48, 0x1ef59c26218aa2a2, 0x1be35991c450c1a7, 0x5b07a661e277cebf, 0x3e92d232a537fce5, 0xba516170abc78982, 0x3cb4b5232c5533db
+, 0xf4ca7e6fb4afa105, 0x4b0ed9b75d7f45da, 0xe69fa999a90427fc, 0x003f7193a66f0667, 0x15320aff949defa8, 0x13be19718a8c2077, 0x87cac0fdc86e9396, 0x4f31a75d16870fef, 0xd3e3e9d975ba58ec, 0x4620cdb582073b25, 0x77507b8ccda0dbb9, 0x523bcb1a02e4b22f
+, 0x4322004d8a40e3b3, 0x38d415a1688a3da3, 0x7868acc2c757f44c, 0x3a4e95e893172bac, 0x984b8c7ad2075684, 0x4e2cb227fa1d0134, 0x60ddc600a6a61948, 0x4b9f7ab625c71316, 0xbad71e00822c9ea1, 0x4d7b4a30663b58c5, 0xa6ab76281c42f217, 0x06da0287ae1da63c
+, 0xbf9871a0de263925, 0x01a2c816b13a2f61, 0xb0b2d3cd6affe990, 0x460c9d9678b5924f, 0x2f81bb31828b2042, 0x18a0fdbcea422a05, 0x3fa40ac48f19cb6d, 0x76a82a900fcf5bad, 0x13f86f0c9406fcb9, 0x0dfffaabfb11e34a, 0x64d67ce403c6b3c1, 0x5ef0e4f811da8de9
+, 0x5501635e4e2b075b, 0x3032fbc2e60c42bc, 0x3d584371eaac6f01, 0x19d62d550dea8352, 0x641ca1a329bba6a8, 0x693e2349842ebf45, 0xae5c729999698f36, 0x47d84141e4669d1d, 0x17defa5df1e43f49, 0x4ee9111f656d7ecc, 0x553dc04873e55715, 0x6ee6fc4f083ae27e
+, 0x871b817c693930c4, 0x7b8e4af1880598a2, 0x2710886632acad9c, 0x3a29bb0d5a7b92f8, 0xb5a318337c632234, 0x3031576e7806fa6d, 0xd1c7756bd5b897d3, 0x70dff1621fbaf7f0, 0x83159b699d76d547, 0x27b0973d97f40e9c, 0xf8af2f4f48b8c41e, 0x33597c9e8cd33db6
+, 0x1f0025fea5ce0763, 0x5b18dfa987e25fbb, 0x62b70440eff9bdc1, 0x20804f08be020bef, 0x92d5dbb8ed3a94e4, 0x3cbc15b3ef546b01, 0x658bb803d9201d63, 0x66d321f88465e600, 0x063cdf7a62eeb848, 0x47b86496aa833491, 0xb8612a51c5c103ad, 0x6d33a1c2932e9ecd
+, 0xb5eb656f70ddf8ba, 0x6415a9f4be27e217, 0x7d464cde2cbf7eef, 0x6379f1b2f71630d3, 0xd78a56b0ec5dca47, 0x048ee4e792ec306e, 0x9dc58657dc9caee2, 0x4a3e0c0891c98186, 0xbc8cec353a2fa3d4, 0x527aa9ad97406701, 0x1af4d63cfc534ae7, 0x4b14bdf0403559d7
+, 0xdbf192d650856fd3, 0x727bd16256fd78d2, 0x91a412617a3effc6, 0x0a67bbe979820e67, 0x6088ad86197e8ae4, 0x632424be5b50db6f, 0x8ddaf773de16b221, 0x6a4720aaa4fea16b, 0x93101c0b42ba0702, 0x13ed1c45a08f96aa, 0x7ab2f090ebcb80a4, 0x1eb42fcadc50b0ff
+, 0x6014a63a845c24ac, 0x663161a97965ad13, 0x16217adb8d092270, 0x4f8bc6809195bf20, 0xad228511bba0c2fe, 0x6963375ca656f550, 0xae0e854476ae228f, 0x5ac35d3ae7113052, 0x8ac7c047f7f4ccb0, 0x0bac3d15c448e113, 0x841f2277eedb7fe0, 0x642aaccc38216c7a
+, 0xc77de2f4fa646b67, 0x42f50985fa405196, 0x5413578c07634f02, 0x70d73116fb91aef0, 0xa2fd0ada520d2877, 0x760ad2b0ddd43641, 0x23185c1c3e04b2c9, 0x421c88017a6243be, 0x8eef6cbe541bfd05, 0x3a333d3ac4e89f86, 0xeae1fe8d04edf22b, 0x4d45cb234b336077
+, 0x254848d0b2d2a6c9, 0x3aadca0862a3b10f, 0x194e314fc5efc025, 0x547053275c2637e4, 0x5e30486912fa70a5, 0x172074111749fd08, 0x4041dff586a1caed, 0x128a24c277789e5c, 0x01ac35434ad81c03, 0x42500202731d64eb, 0xf28cb606111b2852, 0x52e983d19452466d
+, 0x981f24ee56f34a17, 0x1774ee307f9d1aa5, 0xd162df4722bba4fe, 0x60f9a5a97d39e9ce, 0x9c698735754da03c, 0x425278cf755ca11b, 0x9ed25d9ce61d4e6b, 0x7af5e705bf0e7fdf, 0x9260fe0f6a0a84bd, 0x132dc073c3abfe39, 0x5ec65ba79a7c1369, 0x320699072959aef7
+, 0x6f6d6486f37d5b98, 0x057452707f978d87, 0x4fac30746fa152e1, 0x5b931eda73c27b1d, 0x6339199f6124c923, 0x75a8968732cdbd93, 0xf66fdd3f92785d53, 0x5f140d73d6a106cd, 0xf00f841cf2828464, 0x049e3bc7cb3d4921, 0x5c896f5032d1e07f, 0x03809c0f633c6e0e
+, 0x877a5c2636bdbe87, 0x0f80d2c024017fa6, 0xc5a84b44783da964, 0x751b2b11b4856008, 0x0602690ba06b038d, 0x0d049d0605287383, 0x6a9115810329614f, 0x77b007356c5cc946, 0xca03449daa2ec554, 0x2a5fa9bf5f964bd3, 0x74498ef3b1cb1914, 0x25d1b0d65db5e059
+, 0xe2a2580774b02e11, 0x1c1de40e1fa5e966, 0x66a488f7004246ea, 0x11c98c740facef20, 0x1594732a1473f733, 0x7bb564af2dd46226, 0xec8e6d9651bc2490, 0x03425b65e3fda6e7, 0x77aef4f0423e5931, 0x20584b0190714f1e, 0x74addd07f19868f1, 0x74f0016f88342d86
+, 0x9e9bad01f921c6c2, 0x10b39f96fecc6dc9, 0x9dd35d5fdd50f2d9, 0x7ce497b213ad43ec, 0xd22100dd797cdcd3, 0x3d011cd611ae5ea3, 0x4e35a6ea198d2abf, 0x718024bf0323362b, 0xfaa0cbc41571be9f, 0x095636bb35f546ca, 0x259cdd9279625fd5, 0x16171476249bbeab
+, 0x992132550d08ec6b, 0x30282b10e5b9a5c9, 0x9fb3c00c11b45079, 0x2c70160d384a0e75, 0xdb86f540e98b9417, 0x56dadee87a80c166, 0xddc1732679416af3, 0x78efccc384fe556d, 0x5af9640d0414e959, 0x7afec76602366a67, 0x15f3997b23dda2b5, 0x31334bb1d604bd2a
+, 0x12071ed606242561, 0x0265159394fa99f3, 0x20e73c1c3c63f2db, 0x6f91b29fe8d47e00, 0xaa7d7636c1328b13, 0x4689ca36510080a5, 0x5c6544eddeabedb7, 0x1e7293deb7b3dbbe, 0xdcf1fd19653e53ea, 0x0ac097612ac89a55, 0x9e442d95eb7372c4, 0x62a9a3458000af63
+, 0xacb83ffcda9a725e, 0x6c9f4d5f3dff5d09, 0x801dff7836475bf2, 0x4663de4421027de4, 0x70117e23f62b2e42, 0x2aea3ec42fd47fab, 0xcf3251420d9c8265, 0x2b68b892a65aeb34, 0x3a573d05f4c7fa56, 0x3ff733a3173ea605, 0xe345d1fc4be872f6, 0x25e37700cfd6827d
+, 0xf76e7542fb746b09, 0x3dfa2f7b5460277d, 0xbc18faf0e56fdb3d, 0x2489aac0968287e8, 0xc182e8c68569fa40, 0x15f3e00854d50be2, 0x269cf3bd677c6a0d, 0x54fd55e0478b67db, 0x9b2768e15ca7b27b, 0x64129d851f14ecc7, 0x903e806a20e66666, 0x4c7ce5cbca5e4909
+, 0x8994589b228c7450, 0x64b6d966969f4f3d, 0x44b98d2035fe8bc1, 0x016ad136de177faf, 0xcc6326bbeabc23a3, 0x072eeb972f4b0e17, 0xdd2ba38a7d22b074, 0x126a7a07cd5ed502, 0x1ec16011b7e7daea, 0x1d431a2b239ea9c0, 0xcc1f41e973e25105, 0x3be46ec13ee19a99
+, 0x2bfee191c99fd9d6, 0x72dc624b31bab75f, 0x00889d6ccd3fcc3f, 0x69d584533a9bfc15, 0x3cb01c9a1ebed2e3, 0x15a41a22799b9603, 0x4f4405bd6f9fbc57, 0x6cd1e8c7cacc7f08, 0xb4902df7ac2de1da, 0x14f284e76f1d6499, 0xb2687c0b80f2de46, 0x038c5687dca9eb09
+, 0xefcf94c16ab8fbe9, 0x62e7978a0a9c69de, 0x12fbd16ae22f2480, 0x18a0e7e7d923f1a2, 0xdf64463f733a0f3b, 0x1165eba6760f16b9, 0xd8047caae906d562, 0x6d6f9278da0a426b, 0x3f33f6a4aa5cd86d, 0x0f4a22a89b9b2278, 0x2d4e4c18dbba899e, 0x1847bf07ce88af6b
+, 0xb6793853043949ac, 0x2106e00f2e24ee75, 0x166524403b593a5c, 0x7a43f75bc4ce269f, 0x39efa8ca17d67018, 0x57196bf3ee69aaf1, 0xf3230e7f5bf556fa, 0x03d6db65d824ec6f, 0xff83b0d28713ec3a, 0x28ad4f45bf13fdb1, 0xfc7a4d1ff2141dec, 0x1fce37acbae970e1
+, 0x1d5eb9b014595ae0, 0x1fca4e49d9450b06, 0x4e4edc7c8aab93f8, 0x23378dcb86d24e60, 0x9d0617a99cf5b686, 0x7234e51aff6d8cfc, 0x3ec43a8a86e0aa04, 0x5f8b4174a460c948, 0xfbff4e7a904aee97, 0x49755fcb272d1b9d, 0x89db658a937ad013, 0x30fb305e158cb723
+, 0x945d7c3ff5597701, 0x0bf80cc2f7b79355, 0x8cf38feaff2619c9, 0x1a19873a67c121d3, 0x167d0ca8eb6df863, 0x63022eaa4a9e4d36, 0x3c5584aefaf257fd, 0x200976fdabd2bdfe, 0x0c4b5d3e79633d47, 0x7ca1f02a351faa20, 0xa2137b877797d068, 0x7ef3db51646138a5
+, 0x1779f0d6d7303292, 0x61a22c717796efb3, 0xe80d3e2f355f3506, 0x00bc871712bed977, 0xaef5ac08f187a076, 0x1a567e06c577babe, 0x0cf0bce968815452, 0x05f9a021fa6c97ad, 0x8b2884777149eaa2, 0x466e822f399083b9, 0x13709e90822719e9, 0x3c30ab8e1af5e5d7
+, 0xfb6cf853591fc0c8, 0x796c3b26469d888b, 0x1f468db94b0f04e7, 0x644f3773c0c75af1, 0x2bad477f1f592778, 0x748d54af7cb4e491, 0x1e34cfeef2fa62ac, 0x42aadd734d86eb25, 0xb46d49a0d0a4ed24, 0x388c420d32c1d7ff, 0x98e070d1db2b8acc, 0x4e761f17397e48f4
+, 0xa0784e6b91a2d432, 0x6c3a1e526f9ee710, 0x59842c247e1eb43e, 0x30204de34202104a, 0x2f25e1a0d9736ebb, 0x4dc7880174f490e6, 0x94a88c666264e2c4, 0x5bb3639ea0c5393f, 0x0d1a96cc0d2eb42d, 0x1466e0077b756091, 0xc011d94ef80ac6f5, 0x73ba227943e35c8e
+, 0x34f5dd69b4219319, 0x03c0a57596de3722, 0xf74995cca0659732, 0x2c5fc64361058422, 0x1585d0302fe0f997, 0x203bd10e9ab42419, 0x5cac29dd0611c477, 0x2a138bdd6d7bb4cd, 0x08c4ec88eeaa417d, 0x151fa8e4fc6d4399, 0x29dc85e4e6484196, 0x52159dc937f0fad7
+, 0x2fe1acc03b4954e1, 0x5b2e33985310578c, 0x6650b0ba0086efc1, 0x2785ba142f693b97, 0xf0ec9e5dee8b27a1, 0x6339f3f8eccbb505, 0xf032a09ab0c47652, 0x62dccc303df79449, 0xecffbfe95d2b5581, 0x118d286ad21a6570, 0x3422e1c6bcf457d2, 0x3a62749b9ec1dcff
+, 0x65fad051bfa1df4c, 0x2b44d1a7d8a7d847, 0x91f9ae900577c9c0, 0x7ed0b0428ddb977d, 0xc05175b05fbeb972, 0x2f42e885fbc4ff45, 0x85560f975ef6f2df, 0x04cfc0c9799048fe, 0x406a95b56e901e5f, 0x01819e96d6768a29, 0x651905f0f41ca94d, 0x63ab189165a5ed69
+, 0xdf364a0691b11b88, 0x089bf13dc2abd7c2, 0x9d7940cf75a1bbb9, 0x5408465d9af49c70, 0xe15cf6553a37dd7f, 0x238923e8facc593a, 0x2cd3e3f4a3caabd9, 0x3152e595eb244bbd, 0xe8af90ce9bfffb86, 0x6b8f46f1fdb1a39f, 0xcbce3a34b58efd53, 0x2e8d0aff59d0c9ad
+, 0x71131f6f98d29a88, 0x4d726b0f9b5d49a0, 0x17f76eb5614acfdd, 0x00d037057161729b, 0x0a2d1821eb8f3ba2, 0x6bec2d808d89e8be, 0x5cc722b6f34b36ea, 0x3701dec55d080899, 0xe3a7136410fe4468, 0x1c85b83bc62278bf, 0x988fabca4c551ee1, 0x664242ed2006056c
+, 0xe45912cb777c2a32, 0x2b0b847104f16fcf, 0xa8e62c72d89201a3, 0x55f1749a842f2ad7, 0xa1ec71273f386900, 0x3bf88d1797d7c38b, 0xe7bd526fe6958e6e, 0x1bea14a950c2fc6b, 0xee4e6a7c6fedcb11, 0x28862fb6a761d87a, 0xe0ba70fe903f3fc4, 0x44558b62f5e865a4
+, 0x79e9fd8da5aecc5d, 0x1f18d39196ae20eb, 0x064737c98be6a1f0, 0x7c3c293f9261c48a, 0xfeb12c277ea00795, 0x0dea1dc5f4e6230a, 0x7baf17de04b56463, 0x5bba98ac9e891e35, 0xaabfaaca821473a0, 0x1742a4d2ed323472, 0xf9948ebedf228761, 0x5e614cfdd9bf2294
+, 0x05e0589cde444a81, 0x4f861fad6054f24c, 0x92769acfa5be6c2e, 0x6b5264c69dfdfe26, 0x3fa19c3efa002dd3, 0x4d28e2e3ed69e333, 0x20cfba3f06ab29b9, 0x7d3320e482331d96, 0x7aa5fd1b7e772836, 0x0d286de30d81c644, 0xe9db9bb304b4c53f, 0x72444588dcc2a862
+, 0xf1fc0459e1a2e96e, 0x21890ad62da7f024, 0xfc771083f4827ede, 0x39f2e1e253b98acc, 0xe75ea799f8567f69, 0x681aa8a727ef0285, 0xca8e6032ce6d83df, 0x5990d1420b3555db, 0xd73cff8cbc24668f, 0x3e45da3ed1efe090, 0xf2fe95934e914f72, 0x47d5dac15883b982
+, 0x484ea25b6ded3139, 0x2e0b46ae27d1c6ff, 0x298fc4de6f82794f, 0x57d9316305a83688, 0x97e1cc9ce5707639, 0x006dafe30d876aaa, 0x6d178a8c7a528d5a, 0x791791f0120644be, 0x8980860ec2bba191, 0x7f2ce660c6997774, 0xf4141761fcf77502, 0x3c6967dc5151b58b
+, 0xf5ce831f565506ee, 0x6480dd39a4bbe193, 0x86fcbd1de9e49b6c, 0x6652139e0b34c6f7, 0xf13ca4cf503558b4, 0x4933b3c3814a4488, 0xc22f34b356b24bb5, 0x1742f6d6cdc3b61d, 0x8742f2279454400c, 0x319acb79852208c5, 0xcd61ef2f35484479, 0x0c4ffdf7df1e62d0
+, 0xab3f16e77b246324, 0x25d78d5456428c12, 0xdafeb5f62a738fba, 0x238f20c88ea34c23, 0x4fc81110c6558a1f, 0x7af0b813bda06638, 0x8c2984bb8e88bc2f, 0x133f968cda09eba5, 0x1f080b046c83d20b, 0x6d0cab5c0ff4ac8b, 0x89698acd9dd467aa, 0x443aa15d6cd6cfd4
+, 0x398d8a55501cdde7, 0x4948d79eb9e7f7b0, 0xd3ea2950ac8941c3, 0x09c23c1e8afee7bd, 0xdebe7c8af7b40220, 0x1fb5e78d0601a7a0, 0xbf77f1bf9928b171, 0x6dd8ce53f44dcd40, 0xa66ce41f0b13be7f, 0x5f7f6fe59e3f8b08, 0x05a70015ec68c4ac, 0x4ec318a1a193833e
+, 0xdb64f913342f9833, 0x467a0dfcfdf74178, 0xb730eaac49d68dbc, 0x5d130f7b324862e8, 0xd15a4fae4d2915a6, 0x784bd2b4e39e2885, 0x4ab929243f3da3fb, 0x30a1db313d2b66c5, 0xb85ff9d971f44f6c, 0x19abfc2405d4460e, 0x705e99f3c33252db, 0x66531c5d7af36e8a
+, 0xb4ab61c0c1c5085b, 0x4d63009eb6368cb0, 0x1f4c69ea6ad8cc4a, 0x7f0530d69712a886, 0x44f07160555f1afc, 0x7aa5973435060119, 0x27b711ad71edfe00, 0x173bc6df70fbbb42, 0xa3c0982fc3c52b8e, 0x0c62a5dd17fb414d, 0xfa3d048ec396ca38, 0x0f417cddb02a5eac
+, 0x9fea05681bb5aa47, 0x6df7b658f53d66c6, 0x1cda8bd8746712c7, 0x370892de434bcd33, 0x4026610cd24748e6, 0x768b57c0e37709cc, 0x7d261a4f0853612b, 0x4f0b20f7c123481e, 0x8d64e1079b55005d, 0x31d645ff80a5a773, 0xd5a77da73ff267b0, 0x009c4e2613021ecf
+, 0xc94d34625b46fe7c, 0x371969739261ba4a, 0x977634c0d29b40a4, 0x2e3f76424a85e796, 0xf71cc4e5bbc34ec7, 0x06ca669086406507, 0x7857aa027d973a17, 0x3d1b1f2890676333, 0xc627ab4364abbe36, 0x58dcbfa9b7c14c5f, 0x67a89a3453429f28, 0x6ed2ad186260b80c
+, 0x137a82b5d6b12e27, 0x437e3ec7f286d87f, 0x6ad1158283c871aa, 0x6c0faa9a5705dcc9, 0xff19298fb726ba8e, 0x521148dee3983c0c, 0xdaf4c3f5af97dd0c, 0x2fc0bd1894f7ff1a, 0x179691d040987c09, 0x337e648bdad0a0cb, 0xa97d81f260ad4a74, 0x5fe7f748962f484f
+, 0xcd0d8643c60ed72f, 0x7d3cf31724801ea7, 0x59573eb119068b8a, 0x59863e603981aded, 0xaf5a313323952169, 0x609698321fcbe490, 0x3722b4971a627536, 0x657b085630fcfb2b, 0x564110db56ab6089, 0x59df6b56fdfcf28f, 0x610130266f15bdfd, 0x4b906f5afae1fc62
+, 0x233ff55940bb515f, 0x7178db9371023fc1, 0x2f3254df8c1f9a4f, 0x7fb2a53506c27414, 0x77f2be116f4e3ac8, 0x0c5daf88e3b80470, 0xe3a2f7e08aeb969c, 0x7deae97385a3df7c, 0x6d45fe2b33414bd1, 0x55b71a09cfe22a20, 0x999eaa34298b0eb7, 0x2b3c0b19e2175826
+, 0x24516b0e5befbb7a, 0x0b4cf5af475da575, 0x25ff911b6f25c7fd, 0x056c75948424200a, 0xf8edcd8bcbfb0c6b, 0x569834f8228178e8, 0x8b1a3a6fab8f2637, 0x3f870850da3d4541, 0x93a1403661ee5e60, 0x1f7811fe1c912a19, 0x87dd924b1a94a649, 0x46d4ca9915d406a7
+, 0xd7e3ae2aa7a52bb4, 0x737e3c4db24cd272, 0xe5fbdaa9b2122eba, 0x6fc6557c242d30b6, 0xfe9be6f3f1c6a71b, 0x61ed37489ea4af5c, 0x7493f4f4cd9a71de, 0x5359457189047b82, 0x579793549ec71c0a, 0x69e1a2366c848b49, 0xc9b5797d997df077, 0x26625768fc51b77c
+, 0xb889ce18b6660888, 0x742f335af151e74a, 0xb011ffca76f4b146, 0x3d66b73694159c67, 0x2c9826f4a33b63ed, 0x73f7debb9dcde585, 0x1e3432c2168b5d1e, 0x155ff4a733a9f6f9, 0xbc98ef576b046480, 0x542b4ede50dee352, 0xebf343c16d12854a, 0x5924c8d7eaf21530
+, 0x7ef52304546d854b, 0x57752c76477e302f, 0x21f9fc403dcaa8f7, 0x08e32cbb39724775, 0xbf4d0701174f630b, 0x363fe064d2db947d, 0x014e2621986a14d7, 0x276837664112520c, 0x5903c4d9d9c25d55, 0x1b603c8e5a2cdb3b, 0xa0f2e657f873eea4, 0x0a2ed08ce68c13ad
+, 0xaed1b64d073bb275, 0x07401674c128a338, 0xb590925a147fe2b7, 0x06af1121960bdfca, 0x80c28c5d07870789, 0x4eb03ac6d0d0af30, 0x6f955e621ef28ad6, 0x1a373de3ecdf87c7, 0xfd2ddd0b8a700d2a, 0x7120014575a75951, 0x721faf0960c7f652, 0x4ecabc643a9b8588
+, 0x8c3f30ed629b654e, 0x7622682442ce253d, 0xd88a35150b49e576, 0x74e28641b6f30929, 0xc4b0e4d040b1ddad, 0x386d313cced2fc18, 0x56f4620283f7382f, 0x17894ec09660a3d6, 0xa2e476a5b9f2cc09, 0x2dd0b8818a87c03f, 0x3cac22d5fcf1711b, 0x042c1c1f0b199b50
+, 0xa0c81d4e33636067, 0x6ac548bfacf5762f, 0x0978f0a9ece21f11, 0x25acbfc609bae35d, 0x37c60f1519edf241, 0x4b16d1214de2dbf8, 0x6357137155002070, 0x71ec7e3481cea5ad, 0xa17b338788dbdd61, 0x7ca2f4c66d394b69, 0x38a06a7425009d63, 0x46b713f5b8669b9f
+, 0xde84681f65bb7349, 0x78b5f5a16a1acb6a, 0x99484d9c4a54cdbb, 0x5db742db6535b0ff, 0x256deca60c96d806, 0x42b35ad9b7bcba50, 0x9e3b48624916f3b7, 0x6335555a94478931, 0x0013c738de8080fa, 0x62e815a84396b79e, 0x43adcdc89ae80dcb, 0x209b935738c40d13
+, 0x2460173e109c77ab, 0x12af378ab301ed49, 0xa330ba7812148414, 0x2cffcd8e819600b2, 0xd1b533dbca0861fc, 0x2bd09a343a6e5f27, 0x80f439cb3a7689fb, 0x23e0823e526a1bcb, 0xd0607f467f904233, 0x552b8ddd14be8499, 0xaad03d3bfd2968ff, 0x16168beb78db9335
+, 0xdba1432c23beb6f2, 0x309caf968d7254fc, 0xd2949b432efbbf17, 0x63bfece19d574642, 0xb538b10fe1e53eec, 0x07dcd02dea43917f, 0xae3c12fb2590b45f, 0x02e5552b6ba6dd45, 0x57d71fd694d06701, 0x29f99fb86009367f, 0x7c771acb1dab261b, 0x0d26bb111c411057
+, 0xaa373f2456ce3e18, 0x341b2f65847d83d4, 0x895666beeab17511, 0x174a9b60d022d776, 0x4710c13e09b8da3a, 0x25dcfa22c5c488ce, 0x15059c94b7c4a0a6, 0x572ebeeb6b2475ab, 0x9ecc5ab31aeaba56, 0x7c5a81bd86bcc82f, 0x5a923a748fdc18d9, 0x4fecb037dd518a49
+, 0x34c3c7f37d277ab3, 0x252d5eb2db80cfdd, 0x2ee4d3fef11ddb72, 0x18a9a46d97817588, 0xb324d758e76ea83b, 0x6c4c4b0c7db29dbd, 0x3189638e2ee54fdc, 0x691b4abe7aba623b, 0xb98223accad9f9fc, 0x4a8be71acf27a158, 0x14e47cb1cfca5a74, 0x69eb26d7a2a5b9ff
+, 0xdb0e94580bb911b1, 0x55580ab0f5d62ca7, 0xe95e7f2f21cc6ab3, 0x323c43714eb03f2f, 0x3dab490d637c4683, 0x613a798346235f61, 0xa85d5f3f556843d0, 0x30d8b6ed2e08968b, 0xd7633c896f11a306, 0x24745b32fd8ced6a, 0xfecf445c7e120b1e, 0x7730052787a62cca
+, 0xdfa17dcb3846e75d, 0x467b19bf7cceac9a, 0xe7127b8f729910ca, 0x22477442a124530c, 0x71934eba78ad07d9, 0x7d7dfd252bf08075, 0x4e03705eac7c04b7, 0x316eba530a54060a, 0x31959377dec79595, 0x77f4d8b7dc241344, 0xc18c9fb7b8468573, 0x1b41d84ebeb2d7ce
+, 0x5a353b9e63e9aec9, 0x2ede797e74fd17bf, 0x137a45ef1f27e1e7, 0x4642353461556274, 0x541f7e5bd64e946f, 0x458fb177581cf947, 0xa46b9c73d4c8de44, 0x3ac47f1bf50ad002, 0x0878c08816ae133f, 0x71a3896133fad724, 0x843992d198a70445, 0x463146adb52d89d2
+, 0xe291686d61fffe3f, 0x1e90f45fba0c90fb, 0x5ef9119782575752, 0x13136b875f9a1ee5, 0x777f4ba2c05a8de6, 0x76b1de75f33fa0b2, 0x10e3671b1245d58f, 0x03066508c7f683f3, 0xe0102901085dae01, 0x7f20f79b7fd52ee1, 0xe4412f5012c4c005, 0x15750970a6c3a6fd
+, 0xdcf5adc6b4fef55b, 0x43f45df0cdf03ecc, 0x7378c858fbb95b67, 0x641e38132fd04bb3, 0x2cf7a6a116b0f893, 0x1b244b96a7e71147, 0x4c221a81f0304fd3, 0x7f7200d36a453eee, 0xd43fd2d77b7579a6, 0x0a643cabf9b0391c, 0xf8e57ad4a44db638, 0x06e9eaca53ba7ee3
+, 0xcf3d9d3cafe8052f, 0x27ce68871b53146b, 0x3e036342482fc481, 0x62fd0eee8d3ad490, 0x0effa2b11e209594, 0x7504b43fdf69a76a, 0xd08833f39e147bdc, 0x3a1dc04ef67e2c7d, 0x734a2af2193f3560, 0x0c3112854108bb2b, 0xd13a9893f1fb6cfd, 0x0acbfdb209749090
+, 0x307b6d80edd669a2, 0x7975ad962924536a, 0xbc69cc7396a16443, 0x43e7ba7a58442ff3, 0x74cd0c7789dd986b, 0x28a877027192a84b, 0xe9b1508253b94cf1, 0x7d6062be84a4181c, 0xc24b6644f193906d, 0x2f90e50258f049a5, 0x515aebe6461d3c07, 0x4aab63ecc1bc571c
+, 0x1c5c8c9bacac0d8b, 0x2a4ac171b6be0f51, 0xd715ed2e3bc0edbb, 0x61d037e04ef27a02, 0x8e0562be2c913506, 0x6c34b904a11a9ebc, 0xebe0cfca506778fd, 0x6ecd666d376f67d8, 0x843470e1674c2890, 0x2bea943186a50e49, 0x64e842913c2b9d6a, 0x2cfe26734f2c4b5c
+, 0xb166bbe11350ffb7, 0x76cda291f9ff3230, 0xf77f584aea6d5fbb, 0x76af0747afec545e, 0x64ca4f6cb934a40b, 0x7166dcd2d0c7eff7, 0xdf188632138756fd, 0x41240ffd7fc476ab, 0xb8dde67eee838f50, 0x208aa0fccb9c6973, 0x239fa48f8afd9a8d, 0x55ca561fe43fbdaf
+, 0xd9a99c81b64ec19e, 0x655b56ee8bd8a222, 0xdd87d89702a7a0f4, 0x6faa5bdd0f4ef851, 0xaec2f186938c4db1, 0x4a73bf0b5c9b12d4, 0xa2e79128aa5be4bf, 0x6cfb7b845e737ef2, 0x175e1c2a673384a5, 0x48a9523ff0bd4ccb, 0x43c388ea22af8af7, 0x2f716de7fe85a638
+, 0x2530c0d5e4781b39, 0x04058b8a35564d9a, 0xea4444d380d8e850, 0x60bfa2204fac38a9, 0x08f2c156aea1807f, 0x1fd70bbc59ac06ae, 0x5c9c7b902a08a16f, 0x4f4d673d7828a66e, 0x76247ec3dccdf6e4, 0x701cfc0a14349517, 0x4ee8c88242c6fb9f, 0x2d5e7e17b8508010
+, 0x29c1ccef9186fed3, 0x545051ca5eeac855, 0x82c6c85c77790aab, 0x399bde579c0e1d34, 0x9bfb4848bc097785, 0x71fbca97e07312b1, 0x10478267d3eb873a, 0x2696066d55e4ddfe, 0x4221d786c637226e, 0x059ad251592179a1, 0xd63fae927dd94072, 0x10dd0ed1fcde41fb
+, 0xb5c12f78bcf04e60, 0x5240d5cf1a399138, 0x4ab9380c15568a7e, 0x2da2204cc37a9e3b, 0x1a693e83dac1f682, 0x376c4a3cc9745d7c, 0x38d42e53fb69d05f, 0x6c256d9ec4e37bac, 0x2e20694011f22b66, 0x446a9cf2d3d35b5e, 0x9c6193cb1c95768b, 0x1c7e323f487dea52
+, 0xf85ceeda1fa446e9, 0x177c4ed9d8ee6c44, 0xeda6d84efdfecce1, 0x34f34a5a75fa9f64, 0x1d36306c1887bb32, 0x2869d567bc27855a, 0xbdeb8cf845716e4a, 0x5a03c0a55df5bc8a, 0xa276a8eff78b28b4, 0x60b696830fa0420c, 0x66356a75295ed980, 0x5e08d7e347b2eedf
+, 0x5e20a71b978e5e73, 0x6cf8009d683af984, 0xa5c21273461bad3b, 0x4ce0c087a95b04c7, 0x2fc06a3fa0f1bfe8, 0x56fca00e59fb93e5, 0x1c9871dc3049042f, 0x2edeb3a910e9c478, 0xd3aa7e70feaa5a28, 0x08cd034d1c80d678, 0xd64159a760210150, 0x1feb3f15a504856f
+, 0x0e53f1c8a5cd4a1b, 0x41ba1cdc49d5d37b, 0xac3f7281f3d34d56, 0x33494ee25a96b67f, 0xdf1bb3d3e316d28a, 0x622adf85d3dd88d4, 0x7a11f7760b36bf48, 0x16ffcf36f8954b83, 0xffe9921b99178208, 0x62961b2f6bb9337f, 0x49db76a9a616be09, 0x27b498d0a92a1bb5
+, 0x08fbb0c758561979, 0x51fbe6aec1be59fa, 0x6c9a291b463d1bd7, 0x299d967799bcc538, 0x69359f4676f2d4a4, 0x6b3ec04cb804d8df, 0xa0a8f1c83ae6f8f9, 0x762f53d07e0d5f16, 0xd77128b85966d483, 0x44af3a36e2c3acb9, 0xef7f32e6afada57a, 0x36607a41d8a441e8
+, 0x6a97e572f2b1fcf2, 0x0c6cb6e88b8a6148, 0x6f94623dafa0096f, 0x7ec67e8d2687ea87, 0x4b40484e0c008674, 0x37a3dd74c4af7b7c, 0xe058f785e9caa7f7, 0x34786822476510fd, 0x34a843dbe96e23cc, 0x58c9afa86e54a9e4, 0x59230294183b4665, 0x1bab7456bd32aa8c
+, 0xceb3ab1d756d4bf1, 0x73e5a702e9856b46, 0xeae7da9bc55eb98d, 0x1dbfe3f6e160e70f, 0x85f14bcbeeef865b, 0x44e58454ea9cf599, 0xb585e52371821c23, 0x6e10dbbad76f6729, 0x6b9d554f4cd1ef77, 0x13134ec452c09963, 0x6fe2863320056b03, 0x2f5ab87333c71ad4
+, 0xc385194890fb39bd, 0x529654049317d22e, 0xee185b5a86f4bac9, 0x401ecfe8202cd302, 0x0843e186e3627b41, 0x38783d013b054ce3, 0x1776bcbeabb86afc, 0x4e39ff86c7ce1376, 0x132bb221388fab01, 0x1d7e7ad5a9e7feaf, 0xc02f38e46ee5d897, 0x50947b161650dd08
+, 0x770adde960bb46cb, 0x5b95c326efddce84, 0xd75654ad195e3547, 0x7743a2d0025532a7, 0x8d6f08c453fd7c99, 0x4c3656057028dc41, 0xb9cdaadd51fda1de, 0x6803a232088e5f5c, 0x3880cc26ee42dea0, 0x0c5797ecebe5c8ae, 0xd624bac17308ec4e, 0x3be24b11cc84c045
+, 0xb210091f093cdaa1, 0x512a71223be28b98, 0x3b569ebc3c8f7470, 0x613e7524407fee2c, 0xe0f2b5021f6f6c70, 0x2f00a34a083610ec, 0xb0526338421235ee, 0x03a5b63152c593de, 0xff8a260aa829d7d6, 0x5fad62591b4db25c, 0x3d4d8e77df940765, 0x4e6c06e7e7cd7f64
+, 0x0235b5507df978ce, 0x244e7435bb738c11, 0x20c1786c85a7fb94, 0x074293926b70ad6a, 0xf76576a0dc5ed740, 0x248da6214fc5f627, 0x3954fcc74401cb5a, 0x65cfe1c8159b2fba, 0xa25044c35aa75884, 0x3cb3b63702cb7053, 0x53e7f526833f49f6, 0x1c1d08b4da851b99
+, 0xc965c479840c9439, 0x634cb76e6d0b17cc, 0x07cf9da6283aa3b9, 0x1a81657fde330145, 0x3c0e341b591c2c29, 0x517d5b7551130521, 0x8518656702583418, 0x1f3c60c9035a0d34, 0x0f24b431d31b7022, 0x65b463880af758ef, 0x3c97a791fd1cb007, 0x1e7d6f3eb32ac972
+, 0x229ff5ec2abce914, 0x3e39201401c59e17, 0xbc18587dd4ac7b9f, 0x54fcb1c9c3a774bf, 0x2942223e4d4e2777, 0x36c286a59fafcc39, 0xe3919a720a80dfc9, 0x5198f19a7d0914ef, 0x3cbe4bfde79d708b, 0x41ba78c51353ef43, 0x996d2cd0933bdfdd, 0x6e2cd40b190ce96d
+, 0x7d0100d8da468ffb, 0x1e9756576dddc4e5, 0x73b55ed6cd473546, 0x1bae719c27db29ec, 0x0bdbc4a69c73edf2, 0x1ad1d092413c9f65, 0x45fdfef5b3a4616e, 0x252cb3ac53b260c3, 0xf597a50ab7b41773, 0x5dd6bd337d8d213a, 0x3715bd9e6a2c5eb2, 0x00213f0641f97e83
+, 0x6e48615a24914909, 0x5f6afbab810092b7, 0x69518687c9ca71bb, 0x481b0417596b3b22, 0x788ec9a42e265cf2, 0x5be61cfdac2afa03, 0x6412b22c906448bb, 0x4d46b71aebe95d9d, 0xd053efc66d0b888b, 0x7aaf9e837c03502e, 0x306bfaf8b637a73c, 0x7c1c2a1796d6529e
+, 0x64f53e6bf7eb8a02, 0x70d25435c8479755, 0x1071c5931bdfc781, 0x420c0cf2de4e1c1b, 0xcfba3b16e50b2d52, 0x5c1fd9739bb8706f, 0x938f1ad881830eea, 0x38a014314d72a2cf, 0xe099028d1c5665ac, 0x2c4aaa59843bcfb5, 0x804e38485546cb07, 0x0722dc5904d9c9eb
+, 0xdca5964e33a766e6, 0x1a0a68ffde9857a1, 0x049f0f327bff337e, 0x36ee8a502e5c59f0, 0x3af03e02b8974db6, 0x29b31835d7b27e94, 0x19a78f747329adc9, 0x0bbeeb7c9e704202, 0xf87703c74fb3921e, 0x0c174c88aee6da61, 0x876ab420b0a884cf, 0x7f949846fd28b4b8
+, 0x41216818e00eec90, 0x50a6e8cc4e484d0b, 0xac31a4a2d1f5a697, 0x0f1314e0288ad88b, 0xd59f68cb451112b2, 0x3c0109102a864ff4, 0x3ee3583112856914, 0x76f5517c90aa4b90, 0xf1f95d4e8bf6f78c, 0x027512be3c1c5411, 0x1f7bdd8c10f8cff7, 0x3d92e9da3fec9d4a
+, 0x09b38521704a6ec3, 0x5edaf6282fc4482e, 0x782c51f3d62b9c2f, 0x3b8b0f6766c53360, 0x1048987a60cd2368, 0x2ff5a72d8a4be155, 0xd139468ea714f37c, 0x1797ccc66f2612fe, 0x485e21e9350c100f, 0x10dd129179b814c7, 0x1fbf1673291d8016, 0x056a99bf7fb336e3
+, 0x71133dbeaefe0f8e, 0x35e43095712ddf7a, 0x8936d8b989f240e3, 0x687abf27de4353aa, 0x48b82e42055f20ed, 0x1a53593ffed0ea7c, 0xdf2bf3590e3ea68e, 0x7ec12d33b24c8d9a, 0x559a6868331546f6, 0x1fc41404f451deff, 0x1ec2a705236bef27, 0x47c6f59a9166e124
+, 0x62a505f95ff496a4, 0x178295a4ec2015e8, 0xb0fe108f7f71a58b, 0x7c1127e0a2bc0d0c, 0x054e77ea2cfbe2a3, 0x6764cad472cb058a, 0x7ea9701ee1f16338, 0x0093c488a490eca3, 0x810023c3d1ce2f0e, 0x38008c3144be9cee, 0xe0c33ce516c86761, 0x03abbaebea479f58
+, 0x044abcdbb7475ff0, 0x36f59acf89d6347d, 0xef06725c5ebd4d66, 0x7fd206f3d272fcc9, 0xfa955e48b4036abf, 0x7e4db69cf87bbb34, 0xcb9145f550f1bfae, 0x75e603ae61b2e453, 0xa896f7599881dd4d, 0x75b1912042d438b5, 0x38478ce0ac8affeb, 0x1e7c9e1cba15170e
+, 0xc532f118e3f2f7fd, 0x56d4ee0208b0736a, 0xcdd69f9a9d7eb396, 0x42ae25f42ee08562, 0xe454c1be4c244fc1, 0x2882aad613eb4c46, 0x67bf525f14cb5abd, 0x43411208e1eb63e2, 0x10c0a3963b6a87af, 0x3053b7115c24b8aa, 0xd71fea29fd8cff49, 0x4c1d39163665854a
+, 0xd8d6b588ad239da9, 0x689e23da5384005b, 0xe54a7848978790a9, 0x4e13aed9f64f2455, 0x5d56290342bf504d, 0x0ee57db4ba0f5447, 0x385767439327fe5c, 0x406b8388900c5fd9, 0xd950e950a0b565fe, 0x5f87b25045df422e, 0xe4b5ac6827808f99, 0x298fa0fecd3fca81
+, 0x7040304a1a10a9ea, 0x0db4188991f6367b, 0x033ee3b7b71f72ac, 0x5c100044d233b949, 0x3e8d64234837bdd9, 0x21268c2b13c9949e, 0x388122c5bd7b6eaf, 0x07f1aa8382ffe47a, 0x6be0401a395b4f36, 0x33e910c905606e50, 0x2a310a43a130385b, 0x5f72b891cf9624ca
+, 0x4fb0716f0f0635fb, 0x0015527886a22fa1, 0x50191bff634d44e5, 0x4ed2b6d587976350, 0xb4f52648712653e9, 0x72fead224fa88762, 0x0abd8ac40b370714, 0x32553bc0ad8e368c, 0x289a1e612ebdf115, 0x72798dbffe5ecdf3, 0x7ba8c478a28cd711, 0x69f6b5fa8760782f
+, 0xf186b4b20e724f9b, 0x677266cb3a5a1259, 0x2fe43496ede2766d, 0x49bfb36007560b7f, 0x4a88cbc76a52369f, 0x7215dfc2046e5c30, 0x6876c6f28fc03d97, 0x56c0e15ffb5572a8, 0x33ac4a27d11bf8d5, 0x0e3ad48c74f2cef3, 0xbe439350f1862da3, 0x33688878422134c6
+, 0x1c6bd548e0728c16, 0x0dd82e9c0a403ace, 0xa05ae6c0477ba404, 0x1dc38a040b33b2df, 0x233aa3d3367a9ac2, 0x0cec2c96cf45c428, 0x4978fa9ab76afb48, 0x21a05b3070b2be25, 0x0384c4cb09bedff8, 0x4eea1a08ba4e8a48, 0xeb1709a1981b78d5, 0x4b2be7be472588c5
+, 0x2878da2f5ce21c68, 0x59c37bae9efb3362, 0x02b10065f97ac2ce, 0x1070dd2b288ae223, 0x9cef267734b0dff4, 0x426cf4cd48b3ef52, 0x92b224cf25f81340, 0x746bf96145e136b7, 0xbdcdec1c8e379ab8, 0x6456c78ab76cc379, 0xac42d4517d246e9d, 0x0557fd495ede9250
+, 0x1fa733c92a6e2ccc, 0x0441cd10e1622a4a, 0xf8fdc1e7b20a6f6c, 0x107fd33c2d317cbe, 0xe231c93b8ee58fb6, 0x246182dbbfc11b17, 0x0bf64302ee1496ce, 0x2051f9e699693d5c, 0xcc3ca7babf658d91, 0x217a2212e636e7b2, 0x69a231ff4244fa20, 0x2b343f7c347bc5ba
+, 0xfe6a39f3500b1535, 0x64f3b2ad7eb24374, 0xf3cc42bbb41ba12d, 0x2b3ff7d0578f10fa, 0xfbe8a310ff212c59, 0x729790aa73dc0225, 0x279497d959ed8d6a, 0x63f6eba05cbf535a, 0xbb6d7bf9ae4530ef, 0x17c80d824b2762cb, 0x26637eecc521c5f9, 0x02417a84e799ee0b
+, 0x57361b521bacf052, 0x592f13006fe6c066, 0xc5c66000fb3d9278, 0x22b8c5302f49efdc, 0x4e54c5840da11722, 0x03a32cd014e3d1ce, 0x5f116bab3ef7239e, 0x52722bcb973c3c92, 0x8e3835ea2d08f131, 0x479e7c418246486c, 0x36891c890b6f2e8e, 0x70a20cd34b50ad82
+, 0x82e92b1dcab0bcb6, 0x4c4922d03bb74dde, 0x678721218342c5ea, 0x662622e527a3632b, 0xbd2b4c0f30f9bf75, 0x7427e9b8273fe810, 0xc83549b899a559b5, 0x7e8409fb21daa1d9, 0x647b78f358e91dc6, 0x0569f44e049b9782, 0xcdabcbf973cf789f, 0x3e26b0253d894e6e
+, 0xc2885c8bf67a7908, 0x100cb67417e6b47c, 0xea1f2ec0cf5eacb9, 0x39cb8819e34311a6, 0x27c1a668be20c757, 0x3bf2bca2fb1e82aa, 0x270acd93b40effb2, 0x0b8f2b239b3eb27b, 0x33bafe29c682a34f, 0x6cdf645fe337de9c, 0x8dbd422845dd28f1, 0x78935e90b070301e
+, 0xf49ab3f33d1040dc, 0x7053a7106f91c293, 0xa47418053bbbfd58, 0x11f354bbb135d86c, 0xe9175c4a3e0c70b7, 0x1c738813faaf38f8, 0x0ba268195193740b, 0x0812e6fe77e39f4f, 0xe7e6a9fcbcd39d9c, 0x1660535fac61159f, 0x61f44b8729dae522, 0x189383c3c52497b3
+, 0x4591e0d8757d91b1, 0x4f4701733696e40e, 0xe9e670be78d8c0dc, 0x21581de2af007ee0, 0x31316a8e24a8320a, 0x65689a663e1441be, 0x6fbf17b3f4578cae, 0x6d2807adbafea78f, 0xd97505760b65e680, 0x5d7409e77baccc78, 0xc0496e289a068d39, 0x7a1c533f3d5806a7
+, 0x944427496ee4d2c9, 0x05a912f70bd020dc, 0x46f74e87c2e111f6, 0x2ac36ea71ceca00b, 0x04f0d1a1492eab1d, 0x7adc0e7b5d3e787a, 0xf16dcf5360503689, 0x696ac626a48e3c00, 0xe5357f41d1366a0e, 0x5cb4810633b8d917, 0xb5ad74950bf66d98, 0x1d8dbef5225ebb9a
+, 0x1fa856ed96387f7e, 0x7200724a0cb36150, 0x4766c055734d0fd4, 0x143643765dbb1556, 0x10a8c4c3cf0031f2, 0x32334dd5d648a625, 0xdf4c1f104ff073d8, 0x3ab46acd197cfb27, 0x7da88209602b2300, 0x2c5351a6dc76b082, 0xa7630cba46699921, 0x58ee06fe639505b7
+, 0xbf4804c07378f261, 0x54b0de9e38558aa5, 0xb3b20b7cfdc2abc9, 0x1afb18488510f7ff, 0xb429f80e115936ee, 0x0674fecbbe83322a, 0xecbd622f002edec1, 0x248e7819ec36bfdc, 0x911bf9279e008276, 0x7ea06f169a81589f, 0xd0d57c7785ee195d, 0x293373fdcf55ad7a
+, 0x1a860db0d3fc76c4, 0x64af9ffea1f8f800, 0x2c2a74eba6f72773, 0x47938f4cf97b9bdf, 0x4e4e2bd9a04205b9, 0x7469574d8f530fd3, 0xc5a83784b20d1748, 0x3aac769089280f2a, 0xf758971a8846e6de, 0x7a0cc4daea2f7897, 0x3e91f0ea277b172f, 0x4af9f081ca3fbc43
+, 0x6934d077bba28511, 0x57d71bebde0429cf, 0x459dc7559e62afe2, 0x493cd69640c81504, 0x7a00c6d6e2b14e90, 0x2bc3d15c70d95860, 0x28d6f1be8e0f3fa3, 0x5227ad349b2339f5, 0xfe722f85cc256ac1, 0x4b8bdcdbf9852162, 0xf301736550ca19cb, 0x08ab6504482909cd
+, 0x676b4b36d622cabc, 0x6ab7efc0abb101b9, 0x69f1753f978189c7, 0x08fe17ae0b13612d, 0x812ad8b6e0ae457d, 0x0971ba73d9180fa7, 0x80ee4f848f9bb9a6, 0x59100dbbd60a7d4c, 0x05d301cba982f41d, 0x6d6f5282ea12da85, 0x2d6775df4729af94, 0x379014bf3bdce824
+, 0x39d0dd22811e78b6, 0x586d73c88cfd6eeb, 0x009f16d55c3c092c, 0x1df8a6f260a7d3fc, 0xbb41a8fb3787cccb, 0x3f0c3168d1312055, 0x621a397eeca623a9, 0x46274afa2870aadd, 0x50f05926d45b9af9, 0x2e26c10802bcdbba, 0x4876dbefb3bb29d8, 0x171e0dc2bf35fb59
+, 0x290800c6b800dafe, 0x1c07d81a04b28646, 0x1ae7d81c5cf19800, 0x226f65d7b579d2ac, 0x11790fe50b9cfcf0, 0x26d9aa5ab83ad0c0, 0xd8ba78fc067910a1, 0x0e4346d8b7cdc419, 0x86d52c21b4ac5ae8, 0x2fcb9ce3b8fc22df, 0xf2fade84483081b4, 0x589a16246a114841
+, 0xf7a18f7fa10de9b4, 0x0ca106de7a554402, 0x4a49e9e9f708e726, 0x46a5eb33e385aa40, 0x44230462c9fc9724, 0x272df188f3c94c20, 0xa4379480232615f8, 0x751beffcb4d605e2, 0xe6d4788c181fe7e4, 0x711d821e56b67796, 0xcf5637ea2f01adb5, 0x279594a112992484
+, 0x04187efb00ecd4d5, 0x163fda0a504b5daa, 0x334abbf10112a1a3, 0x04c41b742713324d, 0x97962742fe09cd84, 0x4e8fbe1cfe3afc4c, 0x4d6d828806bdcbeb, 0x3c3c6abefbf3d150, 0x2f0661adb5f0703b, 0x121670f9492af076, 0x2d0a3ced0c1b08c4, 0x7a4fb76129f1c611
+, 0x54225cf5dcc0dd76, 0x0b25b5974d5b03d6, 0xf9e99ec820147218, 0x09a959dee35168da, 0x7868b281eda55bdf, 0x436b032250161e2b, 0x97425ec68d6ddc6f, 0x7b9d6e64ea22cd90, 0x6fea7770c47309a9, 0x596a89199220420c, 0xd24a880c3dcb2cd4, 0x3c987f8384b0821a
+, 0x7fc43bf68fa0cc0f, 0x00ca21f023817607, 0xdb28252933f1d96c, 0x71f3b88244a38788, 0x571e64b2dc691d73, 0x365aa24f0f63043c, 0xbb6e7981adde71b2, 0x3171ffd407d147b6, 0x289c44905d2e48e0, 0x0d435bf3bdbed721, 0xa0de24dd5cb02dd0, 0x741e9aba3c8ecd1e
+, 0x51d7d197bb062f41, 0x3bef6ba877fabe3b, 0x367f815c9ab4ab58, 0x325648a4adb412de, 0xcd5dab212544db04, 0x513cf0e7fbafce1d, 0x267ab3adb652a99d, 0x49f0b5cc0c8f48a3, 0x7b6f124edcf4159a, 0x3fb80f825d324f34, 0x3fc002845473add5, 0x15df8169476e85f2
+, 0x2f508e7fde9b0eb4, 0x60a78aa8a499b9f5, 0x459259f43d9743f4, 0x299c888138766107, 0x60a739f68d6887db, 0x0c9ea5ced7b4dad9, 0x665766fb5873dd94, 0x18318702a2ad006e, 0xbabd1a78d53d6f21, 0x17d04be4c617db1f, 0x0e45a8323c35fa4e, 0x74ef65862996a0ff
+, 0x68ec7ca558439e41, 0x7b09a443ce849d29, 0xed6e8c3cfb95ce0a, 0x6d1147a625781c18, 0x1e4ac9c2938b6fa2, 0x16ab1cb6955eb407, 0xff02b1df3d05f862, 0x4752e33c942ddb68, 0xd77cc6b4f794e9c5, 0x0ff26f3f06bc5f6f, 0x53848e60b1d9f0c8, 0x4adc002ca3e9b2c6
+, 0x644261d951cb9670, 0x18744b23ab76afcf, 0x608b88a3e042afd8, 0x62f08cada935fe26, 0x1204f094b837123f, 0x76e67dd5427b9778, 0xad7745167bdac9c1, 0x7fb05364bb8ec0e6, 0x28fad18968476c5e, 0x318e3ef667c2e3f4, 0xceec9a79546dbe36, 0x3fb5710737b0ce7f
+, 0x22b6f8df6899f290, 0x0c5b200b06555b9c, 0x7e14ab3ba21816f9, 0x79d5af417254ea5d, 0xe0dc928564ea556c, 0x5825f19c3bd49c97, 0xe7d23d47c42f73fe, 0x6f1c1cbe7f83dcee, 0xaa129bdc057e4961, 0x0ff74a96a6a1a97f, 0x405596f0d65def87, 0x784ee25d6e154abf
+, 0xd9efa93b7c1fcb49, 0x61e0a9f36f16d86d, 0x75be53d10737e0b2, 0x5943a48bad3394c0, 0x6ae2fb669779b86c, 0x25b8628299553dbe, 0x1f8d4568620c7131, 0x5bb90f0cef0b13fa, 0x136486f33e6c2c2c, 0x6df66f787bff2fd7, 0x69ecae9c94896af2, 0x6d3e981263d0eaa3
+, 0x4140d6ea18284bc0, 0x6ceef2c7ff5a89ff, 0x94f4999039273046, 0x319d6645d4166223, 0x3dedd7547b9399f9, 0x4b486b4483fb99fc, 0x5f5778a06323dc09, 0x4c6ea81deba9ab31, 0x89151052ba55a3ea, 0x399a87d04059fb86, 0xdc5bd99b0d53f401, 0x4eb6b390475d8b17
+, 0x274ff1a38c99fa01, 0x19c3acf4ddd2dd1c, 0xb054d5808c72d92e, 0x2c115fa983d7b79f, 0x4ff795eda028a16c, 0x473cdc4fbc177dd6, 0xf20259d68368a8b4, 0x0b163923dd262e4b, 0xe31cd96c287ab184, 0x3f393c12985278a1, 0x64c7215573f7fc59, 0x292c5e9e94ad49e5
+, 0x60b6fa55c1b025c0, 0x09290b9e5becf120, 0x763817f09df88a3d, 0x34f641da175b58c0, 0x382d00479b97d4a4, 0x20c2e91ac53e46ae, 0x7d86d6de1720ef1f, 0x03ac1c72ea7698c9, 0x1a34fcb313fbc710, 0x5c81e35fe489c5ab, 0x3447ea5f340e7689, 0x64477ed61eb90894
+, 0x701a4f5ef3720c28, 0x230dadaadbbbbe1e, 0xd405320574e3ed53, 0x190f4508f7961b7c, 0x76651e4fa4bad8a1, 0x59cb0212255407cc, 0xe8277826fd682664, 0x3f93f5f97b4d80d6, 0x00b390abbd3b3ba9, 0x64d6808d6b58a056, 0x3cc0fa7477711eb0, 0x0fe098e0a117e211
+, 0xb8f9be04a0d70a5a, 0x58236b817b1f50b2, 0x393f4d82a412e7b3, 0x3b1c3a13a88406d9, 0xeb01ac679cd6b8cc, 0x6003a52e842f6e54, 0xd91d75e4b5f7708e, 0x66212234d66d0ad9, 0x2aa40d543f066533, 0x79927888b2b028c2, 0x04b53d1dbc530ff5, 0x2386e92bbb159ae4
+, 0x47e985d1d7b1dde5, 0x2b4bfedbd33edae9, 0x9525b9602d3c567a, 0x6f0de8054b5204fa, 0x70548a3d1dcd5a29, 0x256f2ff45124feb3, 0xcadec56894e263b8, 0x3578bb401ed31e3d, 0x0e3681436a270a9a, 0x50583184174bdf8d, 0x9149c7a0781a575e, 0x2b0013ebf836fd4e
+, 0xd8b1ab12633ee95a, 0x6f67ed29a9baf0fc, 0x898052a25d2884a4, 0x42a685021ea34626, 0xf54a63c04a401006, 0x6bcbf4269c33670b, 0x6fc7cdbd82c6ab32, 0x3d772d0575848619, 0xdcb59d0bf8154c86, 0x2fe2b88a6f8c435b, 0x1c4bf52cb762955f, 0x179f5dc145026e29
+, 0x9d29cd61eb9c3857, 0x47e85f9ab6061b07, 0x9aee70a4f245495f, 0x5c5a30633403952d, 0x709c12414ae5bb0f, 0x5242e852865e63e4, 0xeef637b21d5da4fe, 0x4fdab3df3c6d42b1, 0xa873246c218416e0, 0x3c3dc6640cd8beb5, 0x7efadd1ee678c40a, 0x0ab9162e1c7dc990
+, 0x769ba5a39b959d85, 0x2c1a78be53b8d218, 0x01b11c01ab7cd769, 0x065266d60f538f9a, 0x0d477b6bd09001ea, 0x05c5e202b9302de3, 0x7129084d4f78457e, 0x2b20d758f679d7ed, 0x2537d9a45d5c2f98, 0x6e0fe9cc75238e18, 0xd2adc4ccd662424a, 0x164c8ebed6f96de0
+, 0x5e8d5f7ea181b434, 0x0c94d3c5374d6baf, 0x5fcd65b6457fe76d, 0x38ddb4bc8b131add, 0x9652fc6f64c24cac, 0x4208c95d273b447b, 0xa17f27bedf546dc3, 0x1554be092601defd, 0xcf722e206da3a84c, 0x278f17c7c81bdf4e, 0x40966a28a7219fc6, 0x651db4b40979a660
+, 0xc62092784056e4d7, 0x3930b1c8ff28f8b9, 0xd60e3b6365b730cd, 0x78864357e453d7e3, 0xc4eb27f357455985, 0x0f5a7ba1902edd07, 0x13a7cd2c289c0251, 0x1749157baed33639, 0xfd78236d1063bf25, 0x03293df6c8ecfdb4, 0x20048f24e09d5df7, 0x04e07a7e7683c962
+, 0xd77d445c0e63bc28, 0x3120b3a1e3482a85, 0x3287cb72e6e5ff63, 0x44c15bb8b8a97534, 0xe282b236ec6113b8, 0x230cd0d12e6a939d, 0x68da4b9b088bb9a1, 0x3b8404dccefae944, 0x8a97db946ef32b8e, 0x0b0ef495f30fefbf, 0xbc905b6567889317, 0x6281aa5d1ab8135d
+, 0xe40a73aa2933a597, 0x210cc2affe29bff8, 0x4dfcab14b3dd19ff, 0x2cd3dbbc3e33ab4f, 0xd9410c201a6f2483, 0x28b955c28d0b5773, 0x03e02a0206aae18b, 0x13bdaf21cd0e7c7c, 0x95b031b52f8ff960, 0x3259245a9b9c4485, 0x0cbe67dabab1535e, 0x18f756c85f81ccef
+, 0x486a9f88cea2d584, 0x16d2d0a850cfd878, 0x7fd876f728c84b0d, 0x2010b2d79dd5e065, 0x68f4b6b3c0b1e446, 0x2b6340df436e3ed9, 0x0f4d879ff22ee553, 0x79ea93c5ff1adf27, 0x4e400cfe66195a71, 0x621e78d7d56d666f, 0xee7d471bc82820fc, 0x08facf77d9d59102
+, 0x61c198e096e7ef8c, 0x1cab8d181d7692e9, 0x521a48da80ec0345, 0x11676c3b1041ba91, 0xd4dc703fb2d82e8c, 0x2d01f79c82905501, 0xbefe2775c9c72780, 0x72df6b2882bf581b, 0x6d8dc4c81898817b, 0x2611eb92496902a6, 0x3fcfa9401401dca0, 0x602f7625d3de912f
+, 0xc98dea7e4aabfda1, 0x0343cc0f54ea2ffa, 0xbdfcbd73bb9c15ff, 0x242c847c62938f3e, 0x49ccd002822379f3, 0x3350343e0f1f29d9, 0x6f1c8fea193b7123, 0x5675813306da0552, 0x655b1438442ede3c, 0x75c9f50a116d7313, 0x44e51a8acfd2aee8, 0x4eabb5c0c9267aed
+, 0x35674b685febb00c, 0x44e614b7d8e0c8f5, 0x5ef1cc68dcbdeaf5, 0x755e7f2f463cd4e7, 0x2bffe84733b5583e, 0x1676c9d894ca7638, 0x570bd0d77315aff8, 0x04370f937fbd719e, 0x51f1fd5eb5ab7588, 0x50f90b2b589a6184, 0x42f9ae4542b7408a, 0x40e491b6f4d1952f
+, 0xd4c76d7da27f548e, 0x4321db7fb7f79610, 0xbcf4fe16e2c1140d, 0x0f62118642079cf9, 0xcef44e5caa68ade6, 0x5c40f97d94c8cc00, 0x3cc86d3c0912f353, 0x3ed99594db98af4a, 0xba0dfb47fb5c9361, 0x76b289b352ea812f, 0x156b568c7a4c304a, 0x439b0dfd7fe45b08
+, 0xc5947e9bd52667f8, 0x25827cd52b606617, 0x9a09ba6cf18779b7, 0x7b6f6146feb785b0, 0xdf99ef9f0d006869, 0x5dc9838d7722efff, 0xcb9e6f984c206954, 0x60bcf538728961d9, 0x6f1778e4a32a6901, 0x44beca26a00e6224, 0xa8cf30a973fe276d, 0x336a280fd19391d9
+, 0x284aafe2410e6c4d, 0x234bb98fdfc909e7, 0x3ba6a39ae74b4fbe, 0x59d90f97bc805ea4, 0x5359e470bdf6de2a, 0x198e7069b4131605, 0x6006b5bc7937aad4, 0x2ba5538ea1fe24f2, 0xafa3b066e277f04c, 0x5df7b66f2d696845, 0x6bcb586c6c57dd65, 0x4d47367426563b03
+, 0x053edb0d43bca667, 0x1311182fa9998ba5, 0x30e3c2d010063a82, 0x28df942a8369b655, 0xfe4a0f3335bff4c2, 0x7b2fac4c3554ba7c, 0xba51af0e4e9f228a, 0x072a580df13ef8f2, 0xd8602fbddfc949b6, 0x3a8fac35d8ea6c55, 0x116cc2e6e75b30a6, 0x7f2586d3ed074e91
+, 0x948a7e3eae0759ae, 0x04888f2e5afec7e1, 0xe0c77f8c7990496e, 0x4fa3c2bbe005efd2, 0xa939c0774a8f0e48, 0x2f384bb867dacb5f, 0x00a7f7f8dcd5e35c, 0x6cb04c93b59953a5, 0x4f25e6afa8496074, 0x3d20ed9275a07f93, 0x2d51383aec3c7b33, 0x3cd1c09dcac6b6b6
+, 0xeb5a7a49a6437ef7, 0x2db27a518375e5b6, 0x953528a8861c3822, 0x311d4d6975cbd200, 0x6ced3dae3de45f79, 0x2430d4cfb8f5c6d0, 0x8921a291dc733214, 0x691d91deeb0729fd, 0x05aa974248194b82, 0x0721606c2e5d0534, 0x48a49b37985dc7ce, 0x137e9aa07f9755a0
+, 0x5f54ae91f287c8d7, 0x4e08770731e46bd1, 0xa5f6e62a7675a96e, 0x5a5ce6c02fda38c8, 0x9a922de304755bb6, 0x241c17055da7e93a, 0xb25612faabcdfd04, 0x07d6e0605d6f2217, 0x246326e93927e807, 0x3f31daa82ba73766, 0x1bff3d2828dd4d66, 0x008c04d8cd34d353
+, 0x2f0f2d65ae1b2f76, 0x512cd9b8191d4383, 0xe5c87f2e61995a38, 0x35fa759c0c79ee5c, 0x4037f55a70fd6e09, 0x10fcce1667831496, 0x3cb47734925cb7bb, 0x6e7295b09705fb65, 0xa36cfa4f7d473536, 0x7e03169a5ba0b0cf, 0xa86c89a7468450bb, 0x52feb9177620f46e
+, 0x89631ebd96b168e2, 0x20e2f8a013364f6b, 0x90eed4ff8362b490, 0x267d55b049074797, 0x9774f6a83f7598ce, 0x344957bbe6ca2f0e, 0x1c307046201f69c3, 0x3709e428ed471a02, 0xddab800ca4c9077e, 0x30c4e0e8574a9c97, 0xdd519e801a611a8f, 0x2a5d8cca68d5e638
+, 0x788f61b310e13eb8, 0x4c7831ca67833d43, 0x92f96e617b53ba0d, 0x00a464df22e41365, 0xd265e52da1073b3b, 0x34c3e69fb4f0de94, 0xc91120682075e39b, 0x281033d76a26b83f, 0x0fade8d400da7adf, 0x64c78fb9562f06b7, 0x78d5549cf8fe9f95, 0x7e85351d77efdd10
+, 0xbdc4006169d12ae5, 0x7f8ffd89368e1455, 0xcd7e2fd8de461b80, 0x116b70e7a06705b6, 0x9178c130b977e20f, 0x2ecb4fa2303adea4, 0xa245e2afefb49d8d, 0x5ccb88393570e310, 0x3cdcc5a9abffd479, 0x7463843caeeb52b9, 0xba2e02d0417bf97a, 0x52a8247c307d7237
+, 0x76b4714c9cf51631, 0x53155e98217064d9, 0x30b7db8ef105f11f, 0x1137d85fbf7ce25f, 0x018bcbc3e4719664, 0x2229cc1ea2d340c6, 0x102962cdd022e4a7, 0x53e212021e45a50c, 0xa5aa114d90fb1db7, 0x0a8dc76971dbe5b6, 0xd799e05dbffdf9eb, 0x270f0155824a7c49
+, 0x71f23274f9d86ee5, 0x72b17953007c716c, 0x4109b4838aa7c8d6, 0x3a07c18331f95cb5, 0x53621aa092b3a052, 0x18a31ad423e0edce, 0xde5a6fc990662176, 0x021956b6402dbf85, 0xf9adc216288e53d5, 0x11ad479deef3a6e1, 0x1966e5c0e949dd15, 0x1bb95179a1e99755
+, 0x49c8d09bc53822be, 0x6e88fc4ceac4cc71, 0x84b42fdad6e28f92, 0x6dabce929497180c, 0xa86129d19beb2279, 0x2a8f02452436e868, 0x64e0e4fd74a83e65, 0x52b73107f475f8e6, 0x80b4a57a7a4a794a, 0x125671b9471c5499, 0xf343282a1cc6d7bf, 0x7191281754aaac29
+, 0xc02057d6a2f878ff, 0x70331b058c82482d, 0x41d6d4c3ccf4a094, 0x4f67d6afb06d4f6c, 0x3e958c27190eef6f, 0x78f573e6ab6b0257, 0x2443125c2ae6aaf0, 0x2ffc52f10296880d, 0x23c4d3f3daaf814b, 0x00a18bddb19e04a7, 0x48f01fcc7677b4f1, 0x21a1e141a9e57054
+, 0x7f118c3e9bcfa6ca, 0x6749040b829c20f0, 0x4f3a3b627f575726, 0x68512da84df69541, 0x8139bd12a373f653, 0x66d10c850c5f85aa, 0x05cc1ab716c968e0, 0x0aa698d7009661ec, 0x7dd4c061190e42fe, 0x594c424061cdb754, 0x27865c92386535de, 0x34c5f78aa1f5d6d4
+, 0x1a9211d3134b23b4, 0x0b28068b5189e56b, 0x76c60db0339d86c1, 0x59ceb95134ba6f86, 0x41e483f4c634cca1, 0x1d23c90349c21ea7, 0x54d8cebb4b1703e8, 0x0887dc0562716399, 0xd3b3d891446912ca, 0x03e96c04c05ecb0a, 0x32bcae984b772202, 0x20d8a30e76de22a5
+, 0xdceb8a5cfa76446a, 0x0c30bb2f24f89681, 0xf13eef05706769a5, 0x4f5163ec8ea2736e, 0x60ea569d968ac4a2, 0x0f532e10c5402dd5, 0xb295389c1d05d91d, 0x3496784530ecd0b7, 0x9b2ea38819d641d7, 0x56cb723e8c999c7a, 0x2f6251079fe746a3, 0x758f595fce17b4af
+, 0xce089c243c7d38a4, 0x03a9916b0c9ef8ec, 0xef80653cda074e2b, 0x3b9cfb935f2ee9ba, 0x8354fcdf10ee24db, 0x65fc702274ad3a11, 0x06bd5bb67ddfaa68, 0x528f28ac322c1d3b, 0xcd12b713bb026f48, 0x0036dc7498887c38, 0x4c1e06c8ed392d11, 0x7f195b9073a66d73
+, 0xf1c65f1d776374f7, 0x5c854c9ef67c883e, 0x08a35e4aeb0fe907, 0x1606191d9ec93026, 0xebf2bee4633adec1, 0x49154f7e8f3f31cb, 0xee00ba57820e55f0, 0x16894fd7ba142dd9, 0xe2bb34a940ec770d, 0x5ad7b20f60fd4fec, 0xbbde937404aa785a, 0x7884336ba3e6dfa4
+, 0x5d7122eb7910475a, 0x0fba695e9978607d, 0xd8b5e23411699088, 0x0cc323651313b3ff, 0x5d763cebb76563b7, 0x653d9878d20454d5, 0x6d06f2e64978c74a, 0x07327fdd9dbd87a0, 0x4fe703fa03077a39, 0x4114075a82ea7393, 0x438938387c772350, 0x0e809693dd9b3291
+, 0x5596075ee0586976, 0x09efeaeb77019d9c, 0x96dee33254169a07, 0x1d745d4701dd84b4, 0x47e7810cd80a85d1, 0x6365facb0e753107, 0x4d56ea8384b30260, 0x7f6e001095bb8e36, 0xf224ddf738794cf5, 0x40cd8580cdf249c0, 0x40e78441d77f3d70, 0x7e084e86335ffcde
+, 0x23a332824fd1d22e, 0x7163273ae1cd5b5c, 0xf4bbff285132087a, 0x63d48fa391dce8c5, 0xb0db85aef04c0537, 0x2b1ba709735c2e2e, 0xa8409e0cada4441f, 0x65ec83956089f27b, 0x7b4b4c036e6c904d, 0x08d5b5dacec5a589, 0x8763480181373474, 0x72f59b23190e0386
+, 0x19b0bdff6461d909, 0x2fe6ffef4a75e668, 0x6f6066c2b5c9822e, 0x694ed394072edbf7, 0xa8dc872cfa7d81f2, 0x6f010e157857d8d7, 0x9498b5fe212933c4, 0x0aa62024460d7dd2, 0x58130d9efec90b57, 0x51a4d864798782b7, 0x274759df4465a97d, 0x68037595cc4383bf
+, 0xfd5af865884177ad, 0x2ae4e91b4126c2b5, 0x6154f21833bd34f2, 0x47948f5d4fa43294, 0xbba7b196f70ef942, 0x03038c17ed47b684, 0x1518349ec8fbed39, 0x0f3208483795941d, 0x2f275bb25bc1732e, 0x4ecf52c9541aa03a, 0x42fe638d1894c8fe, 0x2b676115e047069b
+, 0xa058bb59b0cb17b4, 0x7f310c453a52951a, 0x857ba7685c85ba74, 0x716d1bf4d845c637, 0x938aae5d22747aed, 0x6f91cd8e6e1c8cd1, 0xb6557bbb4e2119d8, 0x55597f5fa981f3e0, 0x2d11f8087b0f0403, 0x2f258eb19462080b, 0xe9ed3ccce68b002c, 0x2b2ac8d187f3fccf
+, 0x1f92ac5474520128, 0x4c076cff30b4b4b5, 0x9bd1218adc114bfd, 0x019b407122332a00, 0x369c8c454cefc585, 0x3e7139d385c6a1fc, 0xd6d57c344a567d27, 0x2188a92c3713eeb3, 0xf633f454a4ee69d3, 0x2cd7fd8c85bccae8, 0xe06d750b330ee237, 0x129f1a646b57018a
+, 0x17eacc2d40923ceb, 0x58b7ddfbf5d840f9, 0xdac31e6a6503e7eb, 0x4a646b86de38b666, 0x1038425d800173f9, 0x0f6527584e226b9f, 0xa7fc3c52e50d5d15, 0x17425c9b3d35f9cd, 0xc2c9a698671728ac, 0x651fd0dcb326a4c5, 0xd19e3524de4fffb8, 0x3543eabe9e07f417
+, 0x4f8aa4a8af133873, 0x750b014301f97583, 0xbed951a07bd82cb2, 0x0beeae65774008a5, 0xc754c778149d5d89, 0x334f80d60b773fe9, 0xf40ddfe3e9fb9ce0, 0x399977de8eb89d60, 0x164d23b76215bd32, 0x7970e9c8048d1c59, 0x846ddd0875f243ac, 0x278b15a5d7a98fec
+, 0x6482492dd50f7ce3, 0x04d7d74c078bef04, 0x2c4b47d04674cfca, 0x462d7a4cb049533f, 0x56f0857287c2ce1d, 0x2fd9326e8f4c170b, 0x9cf8522718ceb9d1, 0x0f9db17dbbce4714, 0x9d6a0bd4ff605e3d, 0x42e50feb1e24a165, 0x4a167ab80debd8cb, 0x1034125a6f32c337
+, 0x5fd1bf3d50141f26, 0x331eeb9b4f544e42, 0x04ddf0164973987f, 0x7ecd8c3bb69ebbf1, 0xa58e02e0657529c4, 0x0f707dadb454c8a3, 0x5de70446382016f7, 0x4295d9d49c4ad241, 0x8608da7c50674d56, 0x67e3c407f6c37372, 0xa21a49d7d72876a4, 0x300d3078144a640e
+, 0xa6137bd59f3fe849, 0x1fbee30ff9c4b86f, 0xfa56b9d46188c9c3, 0x2c83747866b0ce38, 0x1a8b3614c22c518c, 0x739cd0030316bae2, 0xaf135d3af38ccd90, 0x1165a7307161c5da, 0xab9128ec757838b6, 0x34183d3e16249bc7, 0x521f2c291df32343, 0x2a6aa724ee535fe7
+, 0x8dd0e84dfcc441a9, 0x19b7e24a176a763a, 0xa5c078841a83a79d, 0x6f562124aece851f, 0xe7410dbe8c07f550, 0x1d72de29ca8510cd, 0xd738ef65654c9af2, 0x6aaab5162a35ddad, 0x191f83e6a8599c23, 0x1f6962cf3cc2e4ed, 0x12253e5b20bc7ed9, 0x6ab4e8c465ef51ea
+, 0x581e6f06e5b41b54, 0x1d5a601494d1a5cd, 0x158cd6a892951994, 0x29869d97ae6fb434, 0x97333c74b7cf710c, 0x2a99e706ae3ff6c3, 0xcfbc5f281a3fc5bb, 0x7bc8d5e735a00678, 0x2f30180777a379f7, 0x7ba2881e274307f6, 0x9cb0f72e2a667c4e, 0x0262cc2dbaae52f1
+, 0x2e04dd70bfa11c9b, 0x1bc36478235da9f5, 0xb3cc8e3ff5a1f6e4, 0x7a2767945954f910, 0x0578d91e880fb2ef, 0x53f65c39d9f6c40a, 0xf02cf2c85297eb11, 0x01d7c0139b11a0b9, 0xb07d1f30f0c3a381, 0x78a26197352994c1, 0x6d449afd581a12ab, 0x1da77e549e5f91b7
+, 0xfd7a7ed20c31d777, 0x6294976218348e5e, 0xf4c189b211aa3017, 0x7e5f5b51ef857985, 0xbf0d23eafe88547b, 0x58aca706e1490933, 0x53764232b919ed50, 0x3e850785e6294797, 0x6b1f3e35902dd486, 0x0f8c5aecbaed9144, 0x161845302f967635, 0x3a94440b8eec5212
+, 0x6d0922d71a4535d4, 0x7f8660256a537a04, 0xcc6940e0b98b13f4, 0x129f822ae9b83c89, 0x1846186f47bc74fd, 0x39d45cb3d5b6e630, 0xef08b52e97318cda, 0x6ee088f1e0647867, 0x343439ac48dcb8bf, 0x16014f53ae2ef745, 0x372e21ac5f2f9d42, 0x1558a840b9440a99
+, 0x783aba09fc42088b, 0x585e6061419c2368, 0x0edf907096cab1db, 0x28dfee587604b81f, 0x8a14ee393d6f5f42, 0x2a4a9be5b0b4da71, 0x0fb7bfe1334cee28, 0x39523e3a0cc40a65, 0xb7601eecead08361, 0x6b8d9c5047ab82b2, 0xc5b106a97ddc0b99, 0x665f09d71c16500c
+, 0x48d6b37213d28d29, 0x759523e4fd652ca9, 0x6c772328adac5110, 0x05e6f9b9578f9a56, 0x1791da933ca04427, 0x48ba142a00b44fc5, 0x41cbb2f295c3b22a, 0x5ade864b81a0abc3, 0xccebddb3b410a5a0, 0x1a7522116545c74d, 0x2b9aaa03a59d4451, 0x65d6b48723028886
+, 0x2393df2c963c1843, 0x764c1e881f660d5f, 0xff566980df4d2d2b, 0x1460dd8276046a50, 0xea33e57c3e38624b, 0x5ec377b485713316, 0x3b30219586aff62d, 0x54d8f4a4dd513bc1, 0x4e77788510efb04d, 0x234ede79e06b29c4, 0x6640e972c7cbeff8, 0x4e30735f3d211f10
+, 0xddaf985422a5c448, 0x730d8a499da21920, 0x66ad194ae5527a84, 0x4f30d4085636d85c, 0xd2fcb61dcea42bd8, 0x4673dfab066e4cde, 0xa8eac485928946ee, 0x73e56a5746479892, 0x8f528414a3940e52, 0x184d8c7f8b5b824b, 0x9fc491c9dca8bc54, 0x3b1e05ba5a528fb8
+, 0xf31c78a6402994ff, 0x0706e466948d05a2, 0x3b2b59bec60579ea, 0x777324d8bf979aff, 0x346a175105ce9ab6, 0x11e7824692565a2b, 0x546a798608d305fd, 0x155b1e9d2587beaf, 0xe52a01174b62c28c, 0x6ec4f8c4688d4cd9, 0x013dd56a47309289, 0x52adec8201932f60
+, 0xb9441f341d73131f, 0x4a9cf61d423565ba, 0xe957e95b04146331, 0x267fdc85e7765e3e, 0x7b635618a91a8ea7, 0x30175ca9e216b920, 0xf3316f07009c9f9d, 0x37cff6322e2a41f4, 0x6e3cb196bced3b83, 0x45b1b126c3f3b56d, 0xb8d7baf816a3de97, 0x1d690f49c68ad64d
+, 0xfc0671f0a21e9314, 0x6829218e69694426, 0x0dbaf7d99fe062fd, 0x68a67b347e4fcaf2, 0x696001790d5a6e48, 0x5a9ad7cde94a533b, 0xae6fbd50c932523e, 0x1aa457f0d58d0a64, 0x05dd77c611bce757, 0x1cb1d8a7de3ea1d6, 0xfc40f97c6d461909, 0x12aa78031e9f1600
+, 0xb32d087c2dd26223, 0x527567b740369e37, 0x514a524f430ff5c4, 0x2774657e06070c2a, 0x9dc0f120878493cb, 0x10723a82dd22bf81, 0x6378410b897f5e20, 0x2f09509245dbf0a1, 0x7d3c3bae7fb400c7, 0x51e3cae78c64b4df, 0xa66a05a0f3892208, 0x0822705305d708e0
+, 0x338e610ddcedc4d5, 0x53a627955e6fccda, 0x575e2c10fa9bb579, 0x43dbf6d684a5647d, 0xc1ab30ba63bee9c6, 0x66b1efe8cdde8d08, 0xd35d86d44a4981da, 0x1df2dd45935d2944, 0x4bd782af90eb21e5, 0x4a7404b5eed7778d, 0x25a8de239b4ce18b, 0x429d2b18fe46dcf7
+, 0x608178711c8ae532, 0x4c4e483198567170, 0xc836e8c88cf9cec7, 0x544b5f5903600e3b, 0x4ca8655b29b7a11c, 0x054b12fe13617237, 0x17edab159a2c0dc6, 0x4b4a8a2261d58bb1, 0xeb4274db1b329c70, 0x5f557a1287a28983, 0xcceda7b04e5ab89b, 0x2f5698b44869788b
+, 0xf9d2a90ac5fe8352, 0x0f14d8d4d95489c3, 0x73ec20ab1df049fe, 0x67a4aaaace299894, 0x8bbb2a6b396d5518, 0x59af566347013554, 0x19c9ea4797a0a662, 0x7dd216247bcb02fd, 0x2109648e5c1e4c4b, 0x0af43aab89e2d3dc, 0x97c19bd9d0d1e276, 0x5374fb2376aae12f
+, 0xc061ff866fcffe89, 0x2b8765d3ba368340, 0x9a70c7b8b53293d8, 0x1f109b83c2bc827a, 0xf7774e615a920202, 0x5a868bb94b378df4, 0x34fb1908e361c3fe, 0x7a611bb21888c78c, 0xb9d398c29a308785, 0x59aefcc4c0fb305a, 0xb188454d60da2cb1, 0x4df6599db863318a
+, 0xaf626998222d22e1, 0x76bb120c4fdd7927, 0x1c680b5f2ef2d544, 0x5fdde02e6dd3c912, 0xb9d901560fd75c68, 0x67587c0cbbd69e1a, 0xa1d502d9b7a6341e, 0x38079fe08b960503, 0x2ac1883b05440b73, 0x03408a7d009695c1, 0xd263b2a6983d3408, 0x4ff3b11fea1ccefe
+, 0x872b9e4d575bcb26, 0x51c0ec682acae2ce, 0xa9a13749e680c626, 0x1045afcbc9631771, 0xe01f645641ebadf4, 0x49109fd6907b3583, 0x8ec86e1d66f8f9a3, 0x77ade564111cc7ab, 0x10370b5e64a4b70f, 0x22ad10a807097e13, 0x9ec7c1d89732f698, 0x75d26ddf55519ac1
+, 0x932bac176b25edc5, 0x7f104a02f0ccd824, 0xde305e442b6938bd, 0x5ccbe16e9011fb64, 0xd933e5fa1e153a36, 0x3708b0144162d508, 0x05096e1436ff8fa7, 0x3f0371aacd6e824c, 0x64a2703dff86a8e3, 0x409633f13f3f6a4c, 0x0a8ebe0543e2fdc1, 0x771f9efc3927760f
+, 0x1a11bbfa4d2a9cb5, 0x4089f29e620e3102, 0x52c79e03ed096157, 0x2c75adbde2cf3ae3, 0xe13fc2e241176c0d, 0x4b38deba760f6c2d, 0x2c836aba91abc500, 0x1c11e78b1aee6f6d, 0xf89b97b3958a6a41, 0x76cbbe2024821eaf, 0x5cc82d35b71f59dd, 0x192a0f48bf7aff65
+, 0x031ebce9357720bc, 0x1d513e03e17a8805, 0xff9f0eb6d20046c2, 0x02a3f359a389ed63, 0x515941ae2c2e3c97, 0x3f7fffa94e8be125, 0x1fea7985274d90d3, 0x7a6830b5066f681e, 0x3f43aed75c05db43, 0x113e24298f77bcda, 0x6efec047ebc76b0e, 0x7cb9b8fee54cb084
+, 0x6ad16d829d1ef7ba, 0x01ab48845e1b6446, 0x1fc0a2bea6143e1a, 0x4a0affc02b1ae5b7, 0xe4cd228b95c1922f, 0x19f7c94dbcc74033, 0x26395642585dd9a2, 0x2d5f77afc4698aeb, 0x7ebe4f2965e136b6, 0x395f9e17546eecba, 0x3648dcdea82cab06, 0x2f15986caea0447a
+, 0x80f3e25afdc74bfb, 0x23fa1c5175546e6b, 0x7badbd2bbc7eca13, 0x534526b24caae587, 0x9f882cdae156e32a, 0x6609072e69a95e0c, 0xc1b3373eeffe0615, 0x3469d90a3debe295, 0x74b94ba756bd94d9, 0x633c213a5c6857a7, 0x4e1e3e7041a90c93, 0x74af75f07e6c844c
+, 0x851c50949146983c, 0x0d1738b285169169, 0x341d0390e27904c9, 0x63a4cde775f96794, 0xfd1a5adbde238ad9, 0x30d0422b4f01ff0d, 0x6d5a41f2687e096c, 0x7f45b2e2e4c5ce6a, 0x625001516901948e, 0x74ab01660c9891bd, 0x40f8c760a39f97c6, 0x44c16230f2735bf4
+, 0x2baa624526e16cab, 0x59c50fe7c08570d0, 0x418fee3bd5db9066, 0x5b2a6733737bced9, 0xeeed98c4d4172476, 0x0e3a16899a3aee8a, 0x0efbd22f818135ac, 0x7cc9e7f3733ce0b7, 0x6aa0896ee7feec3a, 0x5d72586fbbb9f134, 0xe7806afaaf2f1850, 0x25a8ebc0cd09171f
+, 0xbe832939e7482567, 0x32f9e0f04920f604, 0x0313f78c58e66a94, 0x446e43fb94b9d34d, 0xf41f918015380528, 0x6189602eecb6977f, 0xc5f41423e14d1af5, 0x36abe90ac691df8c, 0x77e6348273fc09f4, 0x57c8b637be4f8084, 0xf6703559e9869b73, 0x53c2886caf50c691
+, 0x1bd360b0ce6c369f, 0x40bf5871d6384452, 0x473347f8253857ac, 0x33c01bb9f1e34e42, 0xc1b33eface013ea5, 0x60f8daa4ecd42869, 0x4ff74367eb34a754, 0x2aec8593e3d123a6, 0xf7c449373308ed1c, 0x13dfc6801eb6fc40, 0x92160e1332743d43, 0x5dc8c2b618283fa7
+, 0xe0f0e145dc3ed5af, 0x0009571fd1bd5c37, 0x1f154cd11a4ce142, 0x35ef967040693abd, 0x440b901470a0f886, 0x2590d17abf798f5b, 0xcb6150a47c7d48d4, 0x25d3afc006892d51, 0x6dc022eb0e01ad4d, 0x3903df2daa92cced, 0xa301b8ce1c9bfe81, 0x0f97d106f73e0ce3
+, 0xcafc5c5880fcd9ae, 0x2af151a83e8fbce5, 0xe1b3f64639bea5a9, 0x23fb43b08dd2f04d, 0xfc190b2044f88fa1, 0x586ca8cafda7f08c, 0xc7e7b66d1010b6ff, 0x75b5afb72bd080b8, 0xc288efe26b3b1586, 0x1344cb100742a2e0, 0xb95fc2cd0b8ebe2c, 0x28c55184932d08ae
+, 0x29c0d463a97acf09, 0x0d27329258384996, 0x21dcfb58c39e422a, 0x4e3a96abe01220e9, 0xcf2e665df7769a97, 0x1ed51248f737f564, 0x8b669a1733f3ccc5, 0x465ae118a3c6d2cf, 0xe2173f33be960001, 0x2c44ffc77a4fd5d7, 0x9cae3ee2a76b355d, 0x514b067588bc9498
+, 0x186d9a91afe1bb1e, 0x32723f763f334683, 0x7ce73ae9b47855fa, 0x260575b6fe1db89e, 0x323536f6e3581d1d, 0x4ce3781a4890e8eb, 0x00c592b1094ff602, 0x601ef54293122a7b, 0xa4e59b29456aefa6, 0x04e9263f10524e02, 0x1f869df26171c7f4, 0x77828354527edf5a
+, 0xac5d74a5f5e7b785, 0x661995fe7875d657, 0x9edf5629e669286d, 0x69e512e5c49a7d4c, 0x27ac3301388c055f, 0x22d6bb23c809a36b, 0x1bc7ddda46c37a37, 0x7cdc28030258ab62, 0xfa19548715e1ec22, 0x2233bff29885ed08, 0xdbd40d0d7391b85b, 0x559fa38966b7615d
+, 0x40959cfa69163768, 0x406bec98b48edb5c, 0xc3c4c4373c075754, 0x424de84389fa271d, 0x73a1f054b077f92b, 0x4ce9ace7e4e1b434, 0xd6ec59c6abfd4f91, 0x24045cb28ab9f6c0, 0xf442143f63c497ad, 0x24e7071957b245d7, 0xf0a4368c2ef060de, 0x0422eb48758f0756
+, 0x6418d292a76c9533, 0x7769835a8fefde4a, 0x08b959dffb0bdfa8, 0x27c7fb1bf40886db, 0x1f85f3220e929ffb, 0x572c7d1137b0030b, 0x0ae48fc1913dc4e9, 0x3eece98d2332ae8e, 0xd741c9a2db5fa0f4, 0x70d42e957afa4bcd, 0x0667004c00f44dfc, 0x1138882e96849c1f
+, 0x1f9c3860426058ee, 0x7bfd7bf51214be05, 0x843fc8aa718f3c6f, 0x1bb2f459d89d60bc, 0x6e6490f847627017, 0x2d5886478cbe38d8, 0xa573dc9ca6a857ca, 0x336b1765013938ce, 0xa37b9f41e0530b69, 0x759c5190d9688d18, 0x014482ae65e2b6e5, 0x2aaf3da2f622f111
+, 0xf99fd01be7aabfc3, 0x6763572ad57edb70, 0x06c1ec84fcb695ad, 0x060172df989cc3ab, 0xea4c6df531654213, 0x6cd1def7f5c0d3ad, 0xfc161100f310b840, 0x3c7b906878024541, 0x42516bb69212f433, 0x17d8dfcec1a5d587, 0xad0c0a476f08044c, 0x4e363cbe79a14178
+, 0xf96c0f2112982857, 0x75bfbdfd687719ee, 0x517fdc1aa04a8c99, 0x6d2594b81e682e56, 0x3d9e4b580bd8bf33, 0x063c09b478791bad, 0xd89804ff2feb0c64, 0x6881c41ca790ddcb, 0xd11d80ba60247bd1, 0x37751d24f9255dd2, 0x534cc14e6da801e3, 0x1fcceb81cb023d34
+, 0xa412151adb891a90, 0x273f18f9217ee30c, 0xa09f64110c11535b, 0x79d3d9dc33d81f0a, 0xfdbe2eef60ea193b, 0x603c0c1f9b9ff588, 0x02e6163653978e13, 0x745daaafdad46508, 0xa7f901eae3227f67, 0x7906f25a2b8a7d41, 0xd57a46ce991f5ba3, 0x2f8404200a4b4831
+, 0x351bd888b31b14d7, 0x0093e6c47a43b97c, 0xad1b912930d0b155, 0x05e94c655820afbc, 0x8e68bbe29ba4729b, 0x75c2a0746584b942, 0xc256ed126653bc0d, 0x317e2a3531a64058, 0xdeb34a3374b26245, 0x6c9c1eba66cce98b, 0x58250c08dc524e88, 0x2daa8d7a16722dd6
+, 0x0e9bf82cd24e6a4a, 0x56d4e3cf51b14a15, 0x40eec73db9ab3770, 0x37ac6f309d178d6e, 0x131b02b013991c2b, 0x71a6e99861777385, 0x1aebf4a1590dd14b, 0x3afc61e62bd9766b, 0x705660cde480bb4a, 0x732990b31ef8d148, 0x991823f36c81776b, 0x5e1aeb8aac0f5a06
+, 0x72cee198495ac86a, 0x6dabbe429e6e6e09, 0x220c33570b1cd53c, 0x2f65444b677980b1, 0xf666149c66673576, 0x34e51d940cc5acb2, 0x9ea143ef82dabea1, 0x70536cf1326091b0, 0xb4b94a4b77b5b457, 0x4d0bb1f7f0c8f923, 0x513914f153bf4923, 0x5671efa81e19dd9b
+, 0x74ebdc8c0b06cee8, 0x3c79b2cecb8854d3, 0x1c77128951b57d4f, 0x0d0c485e2aec4ce4, 0x7648c54c708c9fa7, 0x16bebba779f22d3d, 0xa1d69ff1fe519f01, 0x45ca8140910d204c, 0x92f4a327ef0b8b1b, 0x2c6afe97fb6fec59, 0xe539a0fbe7be6619, 0x502f36946866894c
+, 0x9e298df1456f2dcd, 0x15fbd828405af941, 0x05624665047a7dd3, 0x48b9f5be79caa76c, 0x227a64a1a5e18815, 0x5c7af35f7cae620e, 0x0fdff8fc6f4c4cec, 0x5802b43103a37d97, 0x27c0a64f23a810fb, 0x6123c2b3a4466df8, 0x4647ffcfb9582f6b, 0x4e6c45c119774c7f
+, 0x833e6db413edf7e0, 0x6d6e5aad7241faf0, 0x7c4cd80090553f23, 0x6c1c9370b6b8fcc1, 0x4e93f1d64697652b, 0x7687edd8d3170a9a, 0x14e86f162b007880, 0x1b0a60bd2dcacac0, 0xf73e16bd5f8a0d64, 0x432ad0d9f7713eca, 0x47fbb1834059f392, 0x7aec333daa3e562a
+, 0x0b274541172d5653, 0x7c26e018c88f4079, 0xed0a7561d58e20a1, 0x5ebfb8c63fef2e75, 0x3a3dcbea5a383c96, 0x5f0ae389629eb101, 0xb17402b84e2e89ee, 0x06c178a3f6a68836, 0x7b87ef23f7887a2a, 0x71bff7f99adf2bfb, 0x7cff8ab5829a0de4, 0x7aef0b6fa144f158
+, 0xfa3b77b632cea889, 0x3f44ba7f34d3b519, 0xff0d29cb050bfe26, 0x14d318cfaf637e92, 0x4d803726ccb18993, 0x063a55821c3f4c16, 0x462c0e43b1438af2, 0x2345a48b17380730, 0x47191a714cc1ef60, 0x4adde800148ab788, 0x0bad5daaf5f4ba88, 0x43ae9543d9f68b77
+, 0x6b509bf9cebce841, 0x5b924f05177a82d5, 0x5aea183a582c5886, 0x0dac295ddc2eafd0, 0xbe2c8b189cde319c, 0x598dbdae62e57de9, 0x415a80f6dcad10ff, 0x6274cf145969551d, 0xbcb8b8282cc746b2, 0x04981daf0b392f69, 0xeb4ca0f18e147963, 0x57da6d05536c4e63
+, 0x7dce7574d8288cf7, 0x6e6166c042984703, 0xff85e7f3db9d8dce, 0x68214aff7cba2290, 0xad3c0e37a9be28d4, 0x01d9d9bf3f8b632b, 0xaed4d552565841eb, 0x0b3f7032a5e3e0a1, 0x86b8d046477e3066, 0x213b8f6835bccb3e, 0xc7b9585e2dc31d4f, 0x2c6d065fee9b565d
+, 0x696bc30341597a55, 0x485db3bb1dd82540, 0x17cbfec0d796d8e1, 0x6258de533239cc29, 0x01cc50e5d8d23052, 0x00233de2f2981a44, 0xdf9bf46bd4348def, 0x0f23a1c0181505b4, 0x236f3bb03f220753, 0x7128b25f5efbc16d, 0x6d538cb9c956ffa3, 0x32ce99529e3a6fb7
+, 0x970110e682f91075, 0x7753acf37d305ae2, 0x246c73df94ad39b5, 0x08b4d3c05ac875a2, 0xae67ceabbbfa0f9e, 0x34acadd32bc93636, 0xb91fb0b210daf452, 0x47497eb20b1b898a, 0xed38d5496e19fd44, 0x6e90381e5ce92d7b, 0x39d14e23cc8a9ea5, 0x7e6df2bdb9a2c93e
+, 0x6a5febc6cbc0eb17, 0x7e73388415279c91, 0x09e74f4b62879464, 0x527a2e633ecdc34a, 0x994fef4f6e5c3549, 0x3f6213c78cbeae6c, 0x8602dbd53e7e4d91, 0x6e7d0c49ea060e8d, 0x52fc96511f854e22, 0x53e6b61ba8c386c0, 0x5a8b8500f996d4c1, 0x08762162f23f4ced
+, 0x72924cc989c9d75e, 0x5fe1defb8e710d2c, 0x001729f934f993a8, 0x7e7037222d003aa2, 0x5de86b33b918c743, 0x682b5dd295d2029a, 0x720ab32b07c2de47, 0x4a8fc05a36339b0d, 0xb1fdbfd1a65b018a, 0x5f6f1c8a38fbb4e9, 0xf77572250c96761d, 0x448b7bcc103015e8
+, 0x4025369997096e11, 0x0dbf773be093eb75, 0xf2f454b0d3331f67, 0x41de064ed06ae930, 0x4c9a8e0fdf7af830, 0x2e446d7e768e6910, 0x938e7a60d69c24e7, 0x2386d04b634d86b2, 0x7a6dcdcecc735d14, 0x6d2c792e252408e9, 0xcdcd805aeba4be13, 0x3e8b852c61e0fb40
+, 0x58570e14679392e6, 0x203260d091c66e33, 0x40fe99220b0e03ac, 0x166720c74e45a1c3, 0x25be99906a9f2fed, 0x1144d65c3989c363, 0x55df0743bea28600, 0x3aab051bfc1ae9dc, 0xccf95b91597e9878, 0x7a6c0b5efba86292, 0xee657349633430d6, 0x414e85a46fc1c523
+, 0x037fe333d16322bc, 0x6e789399e654e3f9, 0x3b8f6a2ac85305ab, 0x25fe9ee3a693ccfa, 0x38dff710164341ba, 0x0b687c114baf43aa, 0x4d5c661b3af4f9d9, 0x14e1dd1f656434de, 0xab747c77e03ac65b, 0x773c1bb16779032a, 0xd8eb600eb4497bab, 0x24f2fa5c7b0d0cd6
+, 0x4256a1f5d10b52e3, 0x4f310436d8167dab, 0xd47ede05c103bdeb, 0x41731134aa5f10a9, 0xcc43cd1a9beac8f7, 0x7669794b4fb7f2b3, 0xd867431c51f1e371, 0x65a21707b7d37b87, 0x9b489b0c3d814bf3, 0x366e052c7d16bf63, 0x5afb2983f930813e, 0x359130a764494b50
+, 0x6394b98ed51df546, 0x4b11cefc18e892b5, 0x05de55c8f32be909, 0x3b8ae74084e083b5, 0x91903f36482aaa0d, 0x76641cbd7dc2d71e, 0x555fa8d3e92ca222, 0x147c95eec1ba2afb, 0x0d7784525c115e45, 0x3a29cd05e8cf747e, 0xe8285b556a4da21e, 0x3512f561194d7f0d
+, 0xcc19923a694c994d, 0x767499e270d540a2, 0xdbf35930575e1411, 0x15539364f0fc6377, 0xe3d9d320b1bd8a9f, 0x7587a895ae95b834, 0xcafa0b7d504a80bd, 0x290639b031ffbd04, 0x041d14de0433ec43, 0x6de8db351503ac15, 0x354fe29c2996eae1, 0x2f0421e1102cbf80
+, 0x84752ac5cb673173, 0x1041230ed87339bd, 0x6447e6f83085ada7, 0x28b65097f0ef6744, 0xc3124d78e4ec0a09, 0x2ef3362c087d57f0, 0xcafa9b4d9f741184, 0x2f96d9c0dd0befb1, 0xbf10946939659277, 0x0495e3f41b831e8a, 0x3157d5108d065f23, 0x5e4b9a26c9257076
+, 0x2f99e0eb66665080, 0x2a28726ffe99b725, 0xcd7d58b38bcf6b1a, 0x3be287dd6f7717f0, 0x8207721c1c6b925d, 0x38bca773dd92fa86, 0x8092ed6bf45900b3, 0x080542bd33d42dda, 0x20db3ede10867354, 0x27ce0c61eece589b, 0x54c20e7cc6b044c9, 0x7b3455e1376f96b4
+, 0xd2f9ea9b2a0a710d, 0x0d67fe3cdf2afd9f, 0x7fc60dbcf7c1c237, 0x675c7692cc6a000e, 0x5cf28d76880d9934, 0x7b4abe4f6af94adc, 0x672da0d7a9bc80c6, 0x254a67a1900e3897, 0x553f1e8d9b782a06, 0x4ac5159075e0b3f4, 0xaf43dea2bc2711a8, 0x71c4bf4f59229c78
+, 0xf53b32d3cd7d633b, 0x1639dba6c8d018ac, 0x4e13476c172beb86, 0x4aa8b6dc15cfc7a3, 0xf968de3c06907249, 0x5c08b77c8b1e6695, 0xd29efde635a2ebb1, 0x7bb9ff10e1f23148, 0x59645716a823f91d, 0x2f00f791694e0b9b, 0x417a0a8ba379cf5e, 0x354db82f85e49195
+, 0xd9656821b13af164, 0x483eaa6f9a43fa7a, 0xef60c365bd741a7f, 0x45e71880cff250fc, 0x1f8f3e431283dc1a, 0x1bc15b8f523ddb82, 0x78c11a5ed6b7926f, 0x68d30eae3d309832, 0xae8a97b6fa5e9188, 0x10bb1b883ad72fea, 0xcced3ff55d7a4014, 0x5cd80d3329d19128
+, 0x823affb54bd6a0e3, 0x2413bd3e9ed94d8d, 0xd9a34a881803b42b, 0x37a98bcb7d128653, 0xef9055c375124fcf, 0x46cef2faa830c1b5, 0xf5b7ab2b0643200f, 0x01c4d58b8aa49fd4, 0x255f0f9571d63a2e, 0x3fea0296f6852e53, 0xb8b5ad75ec332aa1, 0x4c67ffb31908e6fa
+, 0x2b4af9c7bcc72203, 0x3f704e2e32a33793, 0xf856aef58524c1d8, 0x5323ea6ae848cf19, 0x20ec0fdb231d9106, 0x1dac1ad423142df6, 0x0c073c83336d4793, 0x2e8c95badab5a652, 0x3a8f019792bb6d4c, 0x7e372e5f75dbc9a7, 0x3ec17b4f7bb18f00, 0x5bec8b1780980acb
+, 0x0b973bdff4e44f0b, 0x32de46e133196de8, 0xd2172f1b40d274e8, 0x5117d2e84129537c, 0x6c66933ccf509943, 0x1b0da8cc1b65a7d4, 0x22b44a8db28a2992, 0x097f52ba9255e7f5, 0x567bce40cf70a1c1, 0x7d801517ec30c847, 0x49d9e7b9b1ce5e51, 0x7c6bcbfbbd312ace
+, 0x3ee1fe4da62edd81, 0x2714e2c5f37b866e, 0x43bcd6b8a649996f, 0x3605f29150f5c381, 0x3492a46e47801c1c, 0x3518d2a2d39fe971, 0x48337f837819d66a, 0x44a8b2132a0cf070, 0x89226848d26a74f4, 0x3f98f2aa9e647bd7, 0x1bbb6ba204dddff0, 0x5ae44e35dce54bcc
+, 0xb2c5de87f4400a4b, 0x0965a86d2ba045b1, 0xef9d552f11b98afd, 0x3b30540a15bcfa08, 0xd0e5cafd65b00d79, 0x65b335d1751108ba, 0x214aec994535212b, 0x79452d9bc8259fa0, 0x38bc22429f485521, 0x5f4ab15d7ef371bf, 0x6d265612459d63b5, 0x60d5343b6387106a
+, 0x01fbb94dd312b1c5, 0x079aa8ca9f2c3bb5, 0xa216db14d5d3cc10, 0x07559ee4b955a171, 0xd36b6fcfe66d969b, 0x52f1392b364cc2f3, 0xaae02ea092ef1ab3, 0x6337be19d07f9999, 0x7e5f83e2d08b50e5, 0x2316dd10bf8d53cf, 0xaeec620d391e6d4a, 0x5a61e9d968a5fc17
+, 0x4a318fb754c6b3dd, 0x0993aa4d1caab638, 0x6b183004ea6bfd0c, 0x1c931df6bd217c5c, 0xefc71d68030e3836, 0x3d6ed73f4db3e66e, 0x1e1ad937b99dc95a, 0x25566f56e3c74f5d, 0x5f2c90521d916756, 0x49b4455a0a542ec1, 0x6b7dd865cea930f8, 0x39daf3d5da240166
+, 0xb9366411930880f1, 0x308e677c10f2299e, 0x9b3161e9bf6260ce, 0x2b9fd388778f2cd9, 0x8575c96fb243e32a, 0x63f95cfef1772465, 0x3f5d26bed01c7748, 0x75ef39c27e161000, 0xa5ac2ad5ca663c47, 0x636543cfef2120b0, 0xefe0db873b90ffc0, 0x25762c85a621c5af
+, 0xe01601071c547ebd, 0x0d50b91731b06b01, 0x4408c36d9005a1d7, 0x20404c31ea59565b, 0x6877c0128f1a0503, 0x1dd59fab11f68333, 0x8fe778815cf4a883, 0x6643ee2d911ebaf7, 0x40ec25df4a2b6033, 0x083fbbfc22f59a73, 0x3fc9da0c39074bd6, 0x2da87a5b5644decc
+, 0x0f14924cfe433ec1, 0x285c9c93aeedcd87, 0xa1b8650798cecfe1, 0x1fa75cfafcf64fab, 0x340b2ef2f20acdc5, 0x2443f043746fe0bb, 0x902021b686dc219c, 0x35509179341b2bd6, 0x508afc35d4399f5e, 0x1813a1f26e62bb1f, 0xea39809ca22ff883, 0x60e98e086a94ffca
+, 0x2886e1b72e57015d, 0x7e62bdaf32d86db9, 0x2cd5580620c2232d, 0x607a4d465fb52941, 0x28f865155824ce3b, 0x743788b0b8b9a844, 0xccc53a0bfaea502b, 0x37641c2a53ed5618, 0xa7e0fe04b5cb9923, 0x073d21529951a607, 0x8e2cf805f32b0e74, 0x0c82f1754479b686
+, 0xb692e9746a3734b8, 0x5d646722d2665e51, 0xaa3fea43aa47605d, 0x02020f4cb71c2770, 0xcce8d2085e479a90, 0x46503ab7905539a7, 0xaafc20961d19bc41, 0x04773f42680ae439, 0xd48ceee5d9619d9f, 0x2c9f9032abde8356, 0xfbb6fc753592f926, 0x68059b7c9039bdf1
+, 0x3e51a66dffc64f34, 0x3ac9d0302c2a39cd, 0x87175ece7d6d6109, 0x525fd300eb0b2ea5, 0x42b4b8403653ef8c, 0x4ac92f08b49aff4e, 0xe0c56767ae5205cc, 0x62317ded8d978787, 0x9b6a9e29d6fbc709, 0x652c1f781b896953, 0xfcfdf25261d3c239, 0x63630d93657c3abf
+, 0xbae3f56d8fb12a15, 0x5004c871fdb68a90, 0x564e01ea45b22f0b, 0x40ec7668326acfef, 0x897ee9c79da57a1c, 0x38f94cf9396c476e, 0x3a49de31689dc844, 0x327a3eee92f10a36, 0x5103081c048edaa1, 0x538fd330abd56403, 0xec4b17652db78e5b, 0x445b1628babe9c8b
+, 0x7c0d8519721c796c, 0x41116494eaf502b2, 0x40aa99a2e0fda160, 0x35e69a289a633f0c, 0xded29a34f4e6e37f, 0x3dc8e0df8710b749, 0x5c042de09038bc4f, 0x167121a5d0655b73, 0xb28b442a2d0d827e, 0x4b5f45fb258c9de7, 0x46b0502705f40b68, 0x3ed47344442ce331
+, 0xe75e1839e373d800, 0x2257df2c695196e1, 0xc0fc1d127b7d817b, 0x07acbe5288b1cccf, 0x67f5b8d52fa64e13, 0x38ba4740199cadc7, 0x0b88c1ff449071f3, 0x599d9eb8038a9f14, 0x84757edb546fe118, 0x4cbd8d1ff3614d62, 0xa949cd279394c2ec, 0x3f972f6471a4af88
+, 0xc775ee45e6eaed16, 0x20155718f6777fa5, 0x7b26f300ac275b25, 0x14919a7ae3d6463e, 0x73932daa680d1745, 0x0e6dd81efe6dfdf3, 0x098bd6f20140c0f5, 0x45725043d00545db, 0x8feac2261217552a, 0x0032e1f32772a7e1, 0x7a33ad3b98c0a8fc, 0x235d80323eb40385
+, 0xd2d097e142104bda, 0x3f23dd57484cdaaa, 0x36ed831910de9c08, 0x2be8df414e76f02d, 0x42ddb3806a09d0e3, 0x0a32c83c9131364e, 0x037cde040b8d5906, 0x46ddeaa789038e77, 0x42ce59e307365f98, 0x2bda66ca8c9e8e0b, 0xc365ce38ead7d1f9, 0x377b2c0de2b46d47
+, 0x6d7045e6bbd271a2, 0x5b06d1f48f9285ae, 0x227bb7717effa2e4, 0x13c8e931f47b0472, 0x9a938a3b20ae5c76, 0x559d20cc2283acfe, 0x733ec30dffb78ffb, 0x50b804bd51e8e6a4, 0xa2e6ae16465c9dcb, 0x474d53f51820a95f, 0x132c022be80eecc5, 0x1d4558d0f91ada75
+, 0xe4e9e3ef114adbc8, 0x11209a30cdb478cc, 0xc37c7424084e6436, 0x3238cf8b5b2267e6, 0x9fd205b7fbfe48ec, 0x6afd1bd9f430c8bb, 0xd393ba7d64a06ae9, 0x7744cc87632845c6, 0x633856087d975a37, 0x66c41a35389aeb77, 0x972181e41b83bd84, 0x67032cc68a6e6cd7
+, 0x4ebbc6a448ff4a8a, 0x229b986918c87c61, 0x2d3e7677ce9d7e23, 0x232b7bee04e3f84d, 0xf2ff03b2b1c6c09c, 0x67df2b2390e9435b, 0x5dec5e75b44aa402, 0x55a9141704eb5ba0, 0x7dbacda0007ad95f, 0x4d02522e02b073c0, 0x88ffa0fa90e5bb42, 0x0493e54db66bbc7a
+, 0x8c0fe6977ca34a67, 0x28b85bbc291b7ca1, 0xe374510e327248dd, 0x555bc73c067111ef, 0x5e7157c7e4d3f266, 0x62e7735c990fca7b, 0x24e59a5677dad7aa, 0x69e22aa54302be41, 0x9b29304227325397, 0x48f8e816ccbf1ee2, 0x73d5ff20ef14feb7, 0x4e7d0a9ae009afcb
+, 0xe664684b72fa5ece, 0x2437cfab3450e79d, 0xf4d67f8573303fe6, 0x230ec1c7f14b72ad, 0xa87bf464dd7da998, 0x37d5545ed55f07f9, 0x611667ae9a546d9e, 0x3c6d2b368a143a1c, 0x07402c020df62020, 0x31d727ad4d237c97, 0xd4fe50852d93170d, 0x2cb74eb889b28ee6
+, 0x67d751dd3278ac53, 0x7610a42fe97c2bac, 0xf385bb1e0246efb9, 0x349a82af7bcf8b5e, 0xedafdc2e569037b9, 0x03a79bb6fc5f0ad3, 0x078e54329dcb4da1, 0x4c050b7b79719ac2, 0x72ad1ebd2cbba079, 0x637c78743609ac2a, 0xe823867d345ffc41, 0x3a6d3b95bc482af2
+, 0x56ac14add965cd3a, 0x04613f0bb5abeb52, 0x42a5531e9df78bc6, 0x061a3613f29b242b, 0xdb830bc114d3acbd, 0x753d9a1744c07c20, 0x51d289539fae6fd8, 0x7f1885126e79045c, 0x03ae64b75ae3efc7, 0x764c2d0e660da7f0, 0x8599138288d40d65, 0x0b98aad1870fd083
+, 0xf0986d8f10473ffb, 0x3345738f9a07f7c5, 0x3d01e0c0083decea, 0x7f50e0a87a01299a, 0xe7f3ceb89757753b, 0x7ab428526825e156, 0x8a0a79739168e860, 0x4adf3af3f7f45c69, 0xaeb232bdb00a6783, 0x66671fb0f5161c68, 0xeaa100e4c8774272, 0x1cd88dd86bd13a6b
+, 0x1a168d3efc73382b, 0x0144e7d666a7c845, 0x201dad8ad1003c94, 0x63f2f4c9addbae27, 0xd8157b384574eb0f, 0x23a402f3af5f20e8, 0xe22c763e7f605bd6, 0x6167d1e2e8d2e636, 0x316164e230122ca5, 0x7b08781ca3fb33bf, 0x2812211362e58d97, 0x5ffe74b677c9a55c
+, 0x5499b23f9a1a3fc9, 0x0b607b3c17779463, 0x85ed5a20bc819fb9, 0x51bcbbdad072a7d2, 0x7ef9b7d57f0a502c, 0x7bd1eddfbb998430, 0x24136327d9e638b8, 0x69e8080b6c53ae4e, 0x5dc7390d08d7d00a, 0x545be186891c3300, 0xcb51f6edd304bc69, 0x6c489d24e196a072
+, 0x4ceea5f531b6e04d, 0x11a4bf995cb2ca20, 0x36d7ec457fc8a818, 0x4b875ec280983df8, 0x3da03f014c9c70fd, 0x0408f73a0cf291ee, 0x664524912460b1b5, 0x7ae753dfe6abe6b9, 0x3bef062bb9bf2480, 0x0d1b34e17208da9f, 0x706f2c358a264e2b, 0x571d69e606426abc
+, 0x122f614a252f3ed4, 0x7a04af974c361152, 0x7a4cb12bb4819445, 0x47249bb876a1e199, 0xe590a4d3270a0055, 0x67009f2196a542e8, 0x5d400224c124d8fe, 0x7c69fb9c7f987283, 0xf9c5df4995010ada, 0x03cddb4e88fa4e88, 0xb4c44438f786b4fe, 0x082a4f31592afcd7
+, 0xa7fdfe73c0c2c008, 0x6ee3692e57906d72, 0xa20ee671d52cbf4d, 0x3b242dc4e27f9454, 0x6dd6ab9fb0647c9f, 0x213889965696cbad, 0x3a9844a2c1834d51, 0x51d33434711b2a1b, 0x095e69e8cd46c142, 0x28876bd263c3cd4f, 0x659e6b85bb5ff2a6, 0x7c3734aeeda3a66b
+, 0x0e780592e739f77f, 0x15d62b9e2f2d7da9, 0x70849d5c010de799, 0x619f1f4b6abf7ddc, 0x7661b0270a6a1dae, 0x7d2f5f65537d126f, 0xd2e3028d5d283dc1, 0x21e24971817c6aa9, 0x6b7ad816d65e0c28, 0x5181556f91ca142d, 0x2a315af477aca2a9, 0x4a7bc239e03edc9f
+, 0x55f294cf941e24b6, 0x2cfda1b2a5c7229b, 0x7816697aa39ccd65, 0x1595bcdee4ff88dd, 0x1f700290a45ba158, 0x6e44089c72f1c5ff, 0x11a8847434addc6d, 0x3d11bd14470cf0d1, 0xf704d1fe53f805c0, 0x646c4014f1c97274, 0x321f7cc4cbf8ccb6, 0x61ed24def06c5183
+, 0xedcaaeac07b8c0d3, 0x6423b21673234399, 0x656f4c3fe596132e, 0x2a1fe46c73a800a8, 0xc93a119cba5ad571, 0x5e578b0683b042ca, 0x6ea70870ad41f6b4, 0x04d499b78f8eda6c, 0x5824138f307fe0cf, 0x469f92fc2483104f, 0x416a0e94d2aa324f, 0x72e5836724ce5298
+, 0x8fb532b754fccbe7, 0x03facf26b8e26b06, 0x944eb9be2ad92c98, 0x00286ae9e4104344, 0xd38a7b0d662d8ab4, 0x5ac906fc5bed5349, 0x68d3266bed6a42e7, 0x39e6641d0f6ab4b9, 0x271969c61b9004d2, 0x006afe02f19a4704, 0xbc4446a0693aa242, 0x201d384a10ed398d
+, 0xcef77137cf2cf8c6, 0x02b3ad52d7755c0c, 0x378a7e533719e44b, 0x24073d5e210cda45, 0xbe9a950cd6f980dd, 0x15ffd748525e7048, 0x816031cd8d9181c4, 0x6e57724ff41487e4, 0xda7149a51188cda3, 0x583de12b50d4d66b, 0x21bbc7b09d37a619, 0x344c4821dabb7ff2
+, 0x523f8d5fd4fd7a27, 0x337f2d96519caf2b, 0x2131077e566dcd34, 0x3716e9774460455c, 0xaa3b73ff7880b45f, 0x1caa9cc5ddded619, 0xd898c5556ad2e4d6, 0x49c2d03ae48a45b9, 0x9e7e1bb645e38727, 0x4b19568ec8bb0794, 0xdc3af6631420d693, 0x16249817b6bf4387
+, 0x11816449c8d1ec6f, 0x313584065291e437, 0x74547e828b8bf312, 0x0dc3733f03474e44, 0x8471cd61aa1cd4fb, 0x3c587a8003a327cf, 0xab575b737bbf9cd6, 0x0e2f0cad5db0a3d6, 0x21d4f3117bfe4048, 0x0bc3642ad3f44fa1, 0x5139a2c3add30c49, 0x7f55bb1434d6a34d
+, 0x15935163955e5370, 0x0de5de845da79ade, 0x83e8c43ea200044d, 0x568172913c0798ae, 0xc9686d9f58f3f536, 0x4869578d54baaa87, 0x51eb8f2b1e940c0b, 0x5a5f20b9fbba21a4, 0x073fe0db8622dd70, 0x338c196c64872976, 0xaebb445bbff92677, 0x603b22cdd1835276
+, 0x747add10b0c6a48b, 0x38f79f3274375aef, 0xfb28b4ddf023fa38, 0x1bf15c3f431f988c, 0x87cecbab9705f6f3, 0x09f3520fe3d8bb90, 0x37c0df1dfa67aa67, 0x0f1bbdbdb1ad0b56, 0x5aed83f280ac1518, 0x525495a8d7ef2049, 0xebc03a7b918474ce, 0x704cf9496b7fd3d0
+, 0x6dd391b97461b9d2, 0x413e8f3346c43601, 0x58daa1740a88d6a6, 0x70779d15ab73d101, 0xe98f605d61e63a90, 0x6fc5131d7b0e3c25, 0x4a3093cc8c5c6b5a, 0x3a3a29164fab5abb, 0x6a4e609dcf275928, 0x1495f36b812cc371, 0xedbdc2a1ae024e41, 0x1e7d3dc70dc5f52a
+, 0xead7905504464c10, 0x1a3a1b048f233920, 0x9c6dc8a68ec418cb, 0x717d5f4d64d9ecdf, 0xd3a8d35b4bdafaa1, 0x27e88fdaa07d42d7, 0x7cd8921831ce0303, 0x7d77d7f19f486b5e, 0xdbd6b006b66155ce, 0x08b18b010972edc8, 0xe331912c083d131f, 0x1bbf76f817e7bd3f
+, 0x94d3a3fa2f2f8846, 0x17519d02e6d75f05, 0xb957264bd6224e70, 0x697f8579275178e9, 0xe21c757213f5a9bf, 0x0f06197029f5e220, 0x00ce770e4402c7d7, 0x33d8c21f78ad5b58, 0x98a087420475d3f0, 0x1874894b02d412e9, 0x32b625849bdc67c4, 0x6f4909202fd2ac59
+, 0xc1ab1c437ce1d21a, 0x4ede6d6d3609620c, 0x54fce7fae06f468f, 0x43731d4bb8dee4fc, 0x041831445c6c3b24, 0x1885dc1c50cbb5da, 0xe9c15b0a1646e1f8, 0x327b3b99349eb23a, 0x05dacc64b085dae7, 0x350cc362e9f5f7aa, 0xe01f3d83100c3760, 0x2e687fb256fb976c
+, 0x95b6aa3decbe80f4, 0x782be319462a7d21, 0xa2a0abde44e484c0, 0x5d291599db9af010, 0xd3c0007b0d44d871, 0x3f4a743006e1d03a, 0x72184186b9eda4f7, 0x6fe7a50ce43b3339, 0x32e959420a342aee, 0x47e272299cd96e42, 0x22bd262706af29f0, 0x2653250f2429ccbf
+, 0x4ab938f8025e304c, 0x5473a026e3c0a764, 0x44399b713a9887d8, 0x0054ba216022214e, 0xa6a12efd4ac3fcf1, 0x4ed9984e7be4a8af, 0x168985a542b4870d, 0x0886a3d0f77a0692, 0x363b019f18b0bae0, 0x721d62802421a999, 0x93e9ee5b047803a8, 0x7620a77a5dbae33b
+, 0xfae165eb36eecce5, 0x1613a03c1bab738e, 0x7a6588b63fca9e2b, 0x5e2f3920779e249c, 0xfef114fdc85cd162, 0x2f2903d17e60eba7, 0x97a230360a4beaab, 0x685f2acb3dc75da4, 0xb16c57269686c4fe, 0x31b6f5308736144e, 0x92134c1ea850ff14, 0x1ddc0124a489a2f2
+, 0x6689effd8d549343, 0x3c69cf665bb4d9f4, 0x6a7cdd4bb7d6ab1d, 0x5b2d522a5fc41770, 0xa5f14410f423ae64, 0x0da66d72bbf73a67, 0x634019affbba8207, 0x29d2c1744e74eff8, 0x441a5d1b33ed9893, 0x5a0840b2a161d40a, 0x68655b5ee423493f, 0x55ce05972ddea1e5
+, 0xd7b37f2b76e06c0f, 0x3083aa4e4764c1f5, 0x67b0632ca0359a18, 0x12d4ee50acaf0ff0, 0x94db5c0d542fae6f, 0x09cf65189497d9e3, 0x8cc50abded6b06f9, 0x6c2bb1e532645db5, 0xef6fee9b1e3cc1b0, 0x5684a4c21254b0f4, 0x8df212da1f37a92f, 0x43dbbfebf1cf1180
+, 0x0c81edf02a587f65, 0x2cda58f4eff7bb45, 0x7f6a8a9a8fc030ee, 0x7d1a093dc5606348, 0x17fe7b580aa3c7ec, 0x15eece877fa1bca1, 0x3641fe6b63dc4391, 0x4b1660714d77b170, 0xa99a88babc1f312d, 0x662e5e683d2246a1, 0x04ab3b6b5ced0b51, 0x5d2e1e3d72f5ec4c
+, 0x7c5f7ba487a7e2d6, 0x580e2eb37013b0f3, 0x5d96a1010a2c6be0, 0x0e8ec5bea28e43ef, 0x9e91251b44253333, 0x15ad44f3ddcbf8e8, 0xa491aea0dde301df, 0x75edbc8e02c7976b, 0x0ccfd318d3ec2f5b, 0x7e717e13d9b7384e, 0x369aec0180c0cac3, 0x1c36401d5b769e8e
+, 0xf3b8dfd7f7a011ce, 0x005ca75287b0e6c4, 0x8999b3d9a6be2aa5, 0x69ebfc85d9fd602d, 0xc4c218de5f61720e, 0x6b64bb87b600d8a7, 0xedda07d56def007d, 0x63990b7a7eeef060, 0x939022a163cea7b4, 0x4b0790117e712151, 0x3da7fba4d28d3c3c, 0x04006b39853312e7
+, 0x77fb1283e6290ab0, 0x3b973251d1e51625, 0xbf1bd267881d183f, 0x16f3c569b20da38e, 0x07894dc1ba319b7e, 0x3d7cb3488a461fda, 0xb579a16236846262, 0x32feacfcc7293a54, 0x68c65328a8786de9, 0x41148dce31261275, 0xac5dcb8454cc1954, 0x2fb1b0d00741d8dc
+, 0xec3a2ca9791ae1ee, 0x18f596d85d050787, 0xac98aa31f07db268, 0x64f0dbea1b8ac667, 0xabe5b319ff0b8872, 0x468b8343aaeba89c, 0xebbd596419862499, 0x473399fa140dc08b, 0xa51c29545c9fc69e, 0x13ea7f8f3d6b8384, 0xc79bfa03a0fbf681, 0x1ad444ff1a21ed89
+, 0x006b7ed9bf7ddfbf, 0x6450061816e8213e, 0xbded0d0698babe16, 0x46cd01d819b60c63, 0xbd7258d58381eb56, 0x6744b1b142251b3d, 0x72b3a92b676582c2, 0x0b9e3ebed965adf4, 0xb9b175bac49f47e8, 0x2feaa2ef18990f69, 0x568e508193459113, 0x7b9940494d762a8b
+, 0x9dadb5177f929719, 0x6a8a97ed27da0cfc, 0xbd2a4eeee62aa55c, 0x7bbe588e0b3e5bfb, 0x59c45ef36670f971, 0x13f498070a926d40, 0xadb72ecdc2596c12, 0x05c6d148023ae452, 0x62c820680466473c, 0x1c7683b14bf1f751, 0x7c530007c3ac51c9, 0x3785eaaf57ffbb09
+, 0xce63ba7fe40dce08, 0x6c47244cafd90889, 0xc9d0bed876d4b56d, 0x7ea8656b9b2998b1, 0x1da8c101b12f4817, 0x3ed63383bcde77f3, 0x7e5ab9499f1ac818, 0x295ede677ddd9f96, 0xcdcb926c63efd43a, 0x6ae9b273d2800b8f, 0xdc7c153aae79a30c, 0x7d4e30c3c8d9838a
+, 0xa6cf16421a79dd63, 0x20114b8ab416065a, 0x126517a2b5bb8302, 0x77edf973882587ef, 0x6f7920bfe1c18f5c, 0x7c0ff60575479941, 0x4fd4bf71ccee0fa1, 0x7ea76138201e0e75, 0x4ebe97faaf2b817b, 0x6584e8d1ef810104, 0x5cc29c154fc85520, 0x18bf4c44fc0cb3c2
+, 0xe93f59313fba88e8, 0x75cedf30a517ecf8, 0x0f816182de9202c6, 0x714b87e611492732, 0x2bb746768aa11b24, 0x232f14e8006e96b4, 0xe74c9ac949fe4616, 0x5477e092b1c362e3, 0x3a0cec346a53fe83, 0x7ecc08a1f300967c, 0x4abe784a2e85f3a4, 0x0189ca428eda473d
+, 0x0f1a8af1a8e40af3, 0x378fa6f594a653f6, 0xc80e18642b74f6b0, 0x0616c0a321fd224b, 0xf8753c7de5311a1a, 0x4145a02b21bdfe45, 0x65fee49212b24d6f, 0x3ae625b6f6b396c9, 0x7f208ef9feebd919, 0x62276b6a602e7694, 0x645022ee67efd222, 0x575daae3809511f3
+, 0x0dae726f68c50399, 0x48631f0505caa872, 0x71eafff463307c26, 0x23718397edca54d8, 0xac6b2fb625f44842, 0x186eca30834d95d3, 0xe4b621b47f53a9dc, 0x1e801d908f4e9086, 0xdceb185654abfb22, 0x4307ae08cc953fbf, 0x5329578c17549cd3, 0x3ce772681ee091cc
+, 0x944fec431034ba24, 0x3ff71d756047a2d1, 0x333ae1cdf6008b31, 0x49fab8eec06e4176, 0xa21b3cb85db3953d, 0x56e7a3cd05363322, 0x087f396b890ab9f0, 0x2d5233d0cb2584f3, 0x903c45de222ccfd9, 0x07552ccbb2d82b3f, 0xdd9bc915dcda4d91, 0x121895c09575a04d
+, 0x77e7d5df5a3ee5da, 0x4d4c5a9ad49301bc, 0x234671e267f9bebb, 0x5d0c3f74d2c8a832, 0xd74c60860f46db21, 0x04e1d2eccc1ec299, 0xf642c998ee217fa6, 0x32da2e5ba4b80ed2, 0xcc9470e7193f32a2, 0x6b5062e2ebcde557, 0xbc0b3b81903e23c8, 0x76a3fa4077356f1a
+, 0x661a373a24686e5e, 0x0b6eadd95437e837, 0x83e89f72e3a9b48e, 0x0825ccb1679f73be, 0x1db966abeda03c44, 0x6e814e9df1905355, 0x4b1d75f055efdc96, 0x1b21d95d0d665698, 0x1fce92cca762f989, 0x5ad55c848e1889b9, 0x4b18af1a68c027e0, 0x54485ec70ac0eded
+, 0xfa10a2242d74b358, 0x7dbd2215e3deaf6e, 0x7259f501a84b4965, 0x3e029026a3eb52a0, 0xd586e4057ce25b07, 0x29ba0012282b1c1f, 0x24351ffe9fb14255, 0x5b477bb0a7176ecf, 0xcdb45d8d48c85a89, 0x34ea8208b96e44c2, 0x2ee139a02609d66e, 0x68d65b3b3557c895
+, 0xb99bba4f3b46f6a2, 0x52084db08eb31bff, 0xd58a71be182e37cf, 0x11fdc89655d864e0, 0x7f622324befacf0f, 0x1ee0d7b72aa3eef5, 0x882f2f8d425b5fa2, 0x506860cc00bbe2a7, 0x00135a3252337633, 0x738f6fcb78d55c7c, 0x45f7bba1eb585ed1, 0x59987f03ba71608d
+, 0x2fbf9e0fe02cff1d, 0x4a5c31472b45aca2, 0xda1a7d4b440dda3a, 0x78b1589e8f97374e, 0x6cf50206de5d9b7b, 0x0133efc189b1fa5d, 0x171dbb03e9a9e98f, 0x635ba88968507e18, 0xb06c994efeba6e61, 0x63d02d8571c8ea71, 0x15ecb045f7a7de07, 0x78b994c886f8aa34
+, 0x7b958e0fda29a7f3, 0x71ef659fbf9d6e36, 0xa2b120bb8b699024, 0x118a29f483380be5, 0x647792281c41e871, 0x15c21f7082d68fb4, 0xff3780644107c917, 0x0fc36198c754383c, 0xaa32cc62212ae7dc, 0x367a592394b64b8c, 0xb83064f3ceaa499f, 0x69b7e0d83478b1c0
+, 0x589199675b701d92, 0x290ee022cc672546, 0x126b07a9056d2cb3, 0x65427b4071548e01, 0xa83ddc26b0716a39, 0x14cba5f58b81dcae, 0x71f9920498c6318f, 0x03836fa189cb4cc9, 0x2712a3dbf1b0eab4, 0x5fbe6141d996b0a7, 0xa7858b078a73c2c4, 0x43ef2a5b18a16990
+, 0x32978c0e1b757f2f, 0x4a2768ea12af9199, 0xd677ff532d5bab98, 0x37a327ba6a1b8de5, 0xda6a2b91e12ab9ad, 0x45735dee84d94bdc, 0x573e5e1a3d69ff59, 0x4ab93392e9cb2ffb, 0x9d3d8db6d4a53fbe, 0x421c9ffd3880898a, 0x957b1e88b4190cf6, 0x39ed73775779bc5d
+, 0x6a26b43736bb0b5a, 0x7c02f96873f985e8, 0x699d0055874bc3cb, 0x1590d34b02370085, 0x284ba07f1980b9ff, 0x3e6e4171007f6916, 0xa36496ee5ff073c5, 0x13dc11708a10eaa1, 0x1535aa2984813213, 0x1836a8d8aaf1ed8a, 0xbe7f10c2b1e894d2, 0x626c31aaaed9564b
+, 0x96ee136b6e66316a, 0x224c121f86dae08b, 0x777aecdd003529b4, 0x5700291291a9e956, 0x54d86f3d634cd3f0, 0x38496882c4b96d97, 0xf0e3a22a16c3c0dd, 0x7f51d940b054267b, 0xd680d2a2d830cefb, 0x0f34945cf441d541, 0xa53832efbcbdf84a, 0x2266e7bdc1e5619c
+, 0x1706af6bc5b9cdda, 0x3beaeeb762772328, 0xf13adc3a6211d6e0, 0x1f8bc826e181b756, 0xd95a066de2289fbd, 0x3290b0f93a655c1a, 0x764f9d8353484e53, 0x4e23c9f8105fa72e, 0x0b9790a62f1eeff6, 0x3185566717228835, 0xcbdcb64e93799d6e, 0x3b51868bba046000
+, 0xe11d752d0b61eb33, 0x733840a73f55f5c2, 0xfa5862db324f2d03, 0x611c16c8cadcb738, 0x72d8630ff1796bce, 0x3bcfc01e6c853804, 0x8ecf737fd023a801, 0x17ed4c47270922f3, 0x15dcbdfb5590478e, 0x570f31f6b074b086, 0x82b8ba3db73cc7a3, 0x5784e98d6ba8978e
+, 0x4499857d091e7879, 0x5122cb5a2acb6a46, 0x5d676744785ce22b, 0x024e7e06bda32f2d, 0x068304e50c8ab9fe, 0x61563ebcc301b13a, 0xa05c4ea823bfcc1b, 0x2cee190ca8ad04cf, 0x307d1da1345dd9ef, 0x339a9318e63d9de9, 0xc9007be48148306a, 0x599d6686bf160274
+, 0x602f68a1b762a06d, 0x3425692446793208, 0x2fa95b8b76dc4a65, 0x7589cb1c80ef65e8, 0x9568d478a6517249, 0x2d4dc9a85150cc77, 0x47d597c54140f2dd, 0x7d043ab39cc58f42, 0x0b0e54e228d60171, 0x72e3f5c4da306000, 0x5383e4015162068c, 0x4d23131601857ab0
+, 0xcc6abfa2202071f2, 0x18451acfe9a0c301, 0x4077b2fe8719d153, 0x0cba4e01ee5dddcf, 0xcc125a72c7011de5, 0x6b8b9009afe699a3, 0x078e7dd2f3ba62ae, 0x2288482d6f7720e1, 0x3e37141328114ef9, 0x5d946d4d52d5c751, 0xd3755ca9732f433e, 0x0fba8e429f57608c
+, 0xae51a290235a3fa0, 0x2b475c20ccf6aaac, 0x1f49cca57cb0baab, 0x35ff34443ee82d20, 0xcfc196ce892c551e, 0x53f1a023e1ba2f4a, 0x754278cd84c768a1, 0x24e6f4becaf81923, 0xeacdc01589a84cab, 0x700aad35d73bde69, 0x330f732966a52e62, 0x1b233de8f1ee72f7
+, 0xae6134636031771c, 0x5c5da636af5c49b4, 0x952f22e12b1264e3, 0x7419130c1ed38a50, 0xc6500c17105a37d3, 0x4ec027930dc0fd7c, 0x16746fb17ce5f61e, 0x06e0839a3e814de0, 0xd95378e3bc53938a, 0x269cec9d45bf40a2, 0x2f34e7c3ae7defaa, 0x08e893900ca9a8ac
+, 0xb1619e14246e4929, 0x65aac61b35e5a00b, 0xe814b497b52baf75, 0x5e690c27d632b417, 0xc8571ad3477206c9, 0x5e2ffdb36e509840, 0x25a593ea6a46dbc2, 0x078f1eaef74f28d3, 0x70b898aaddaa7e69, 0x7062a4995bfaa456, 0x540fd11d6e3f87e0, 0x125667d9e9eea486
+, 0x4fffa599416ede36, 0x1ddc2253c906207d, 0x739ee4b21adc1451, 0x4a3002bd33c27703, 0x7b0ed428b804e769, 0x6f9bc8d442866e0b, 0x1fe5aac41ccb0ae8, 0x786bd7c025e891be, 0xb666865f1feeacdc, 0x7142b9e3674d8194, 0x1a778e98ea11f2f0, 0x69b7c00a7797cb40
+, 0x44a2405ad6460a7d, 0x520bd3cc3efdd02d, 0x30b1cc4a07a856dc, 0x28a48dee8b0a8ffa, 0xed43d1f8d57263e6, 0x75b852dfa274b9cd, 0x9a60bd2d8b8cbf13, 0x5947103c6be8662d, 0xc0787951dbc5c43b, 0x7f1dd5aabb7590df, 0x5fd01d6048f98362, 0x37e5b6cdf02e9900
+, 0xc1dfa463cdd0176e, 0x47f58c7340e997c8, 0xa03ff24c4a2fe0ac, 0x2d8d294a7a0cebad, 0xd4098454a1bc5030, 0x523845d0b4ac616b, 0x7cd44e394a9a9043, 0x772161d25eb16b06, 0x3fb1f2ef4dc5ab6d, 0x57b85643e641b3cd, 0x3abbd130b61dc3b1, 0x45649326b3c8f1c0
+, 0x3dc8dfe4af3edf6c, 0x2b5ebfbe7fc7919b, 0xf7689d77197730d3, 0x00684e1947ed3907, 0x280ce7e21ba7d7f8, 0x21ae405f2dc292da, 0xe6e95b18de275a5a, 0x30f9653532548ed8, 0x4ea67be63fbec6ef, 0x43dd31cdb340e126, 0xba93ca9cf3e5a029, 0x56cf23a14e95bc2f
+, 0xeeed8091f3a81969, 0x75815416e1f43319, 0x3c33cd99a8ff2547, 0x69c03fe3b267b805, 0x2385bbb161fe0f2b, 0x6122806189b8226f, 0xedfc88b7f6d0bc4a, 0x262630a20e12325a, 0x0af6898f5a1e97d9, 0x0cfcf7038c736d8a, 0xfc664a7a3e9a8497, 0x654420cbc967d817
+, 0xeffab2021447ae65, 0x4fe270473139034d, 0xccb16bd5161536e0, 0x16a17441b8500743, 0x85e3863b34f56d1d, 0x731e3cc987a5a3ed, 0x603070d360148709, 0x296c7d63ab06c963, 0x163ca11aa5b93665, 0x01baca4e7ed0fd8f, 0xdf880217429f3394, 0x509481b2eb1ebd3b
+, 0x96be02b5dc2d4124, 0x183029be98da2341, 0x474f9ec6760ef2fc, 0x077b79501c267d7c, 0x61331b7f88f56072, 0x2e6a791ed15688af, 0xaaaeefb485cf21dd, 0x6eac90bbd34af7c7, 0x347a74a099f75577, 0x30185ed808a54959, 0xe35a1d9298f05619, 0x7b226e92f7576174
+, 0x403a14e576464171, 0x6ff198e903d86b3f, 0xc6c445aedf516059, 0x4680d5ff8bd09d5a, 0x02820f2d47cd5d39, 0x2139506330ac308c, 0xa10d5d9299aeeac7, 0x2e846ba1ac748899, 0xa8da06e38aca4061, 0x615acff43ee882a1, 0x7704a4177dce1a0e, 0x65cddf3c694d3ad0
+, 0x3bb41b4e859ac5a0, 0x2cba2efb750b6cfc, 0xabc06a8a2947aae3, 0x1c4d6d00a1a3b0d3, 0x2a023ce616848f3b, 0x12607817a5986b0b, 0x1e3e51a1815db549, 0x5f9dbdec71da7c8c, 0x5a1bd5599b477ae6, 0x64738b14f2eb187f, 0x5b7adfa863e0250c, 0x18dc821e34d659e2
+, 0x036771818b1126ed, 0x0fad854268c65354, 0xf29b92606d0903ae, 0x643de438fd811699, 0x74dc1e3974e9ad29, 0x727405500dea5c29, 0x211413f4956667b4, 0x669355c952333531, 0x8d3799c48b6aac79, 0x4a948bebdf65188c, 0xfa2b496d84ecc313, 0x758e0c6f1939e832
+, 0xda5ff89962b92aef, 0x4b4aa6e169d6669d, 0xcf2ed5212f35cfb0, 0x5084d97f68bef97d, 0x440a204f62aad70a, 0x433a3605855194a5, 0x9ba1b6fe608ec609, 0x6d436ce81406f4fc, 0x4c8e702e89566966, 0x1bc81d2d4d485c3e, 0x54a82c6c58fae74b, 0x57e07c339dc72a99
+, 0x6060c2b59f5909f4, 0x035ad7dc9524b452, 0x4118e8feb6c4f806, 0x7222841b10b4de6c, 0xfb2fce6f52d900bc, 0x0c83f0fa8aac250e, 0x88e92a626f6d4696, 0x37f9af91e2412dab, 0x0f9a65b2189eb9f9, 0x644bc74848246ca9, 0x7639ed9a93bb5e94, 0x285fdbf588c7df76
+, 0x34de2dee5d60f059, 0x5fff129655f1e949, 0x483af82f287d0aef, 0x4297d2989da5b4f8, 0x335316f61616f4cd, 0x6ded47ed749fac88, 0x741d30e4fe7f3889, 0x0f2306c6c361ddf7, 0xd63847c0cfcd7b3b, 0x621986462675c085, 0x4d0aa3844c4b85f1, 0x361379f26c9f15de
+, 0x3955f8e26df98304, 0x341937e35e89b593, 0x1503bcec84c346d7, 0x28bb9fd8a22037bc, 0x6cc68c725bd74b1a, 0x1013afa706733696, 0x7fd5225aafea07b5, 0x08c1fab3be49d9e6, 0x86d250ccf5f52b62, 0x27777fb38652df19, 0xbf98d59f167120c8, 0x69df4317add4dc32
+, 0x72719e17aa34e867, 0x75722527dabd12ef, 0x43309909587fa87d, 0x15749f1c153d377a, 0x12057ebd4268af22, 0x0251cb9ec179d047, 0x2349562fab355b5f, 0x3455fbc9070b9e87, 0x5e032136766cc9b3, 0x1d6f10e329fc4c28, 0xc1bd293f8806ed7c, 0x2cb7433f2338f838
+, 0xeea714ff67b8f26f, 0x6c0554efd119c145, 0x9c0e0ac50c381dbe, 0x4a87116a70b63577, 0xb60cbd4df582cb8d, 0x255361b5b0f18caa, 0xad42ba86ecbf2410, 0x090c6453aae13db9, 0xfaef5f0dc7919fe1, 0x3d9061b6d225c020, 0x7a9422a7e8bb35d0, 0x17f080f96aedc452
+, 0x67452aeaf83c4d30, 0x053cedb54264ed98, 0xe08cf40327e6f22e, 0x32e27427f11e492d, 0x5fd9618c522f78db, 0x4beca1893064334d, 0xdcfec1fca636a83f, 0x31620fc8778b7a28, 0x4958267e5535e0c6, 0x0101ee76f3ae21a8, 0xcdad99c9573cda13, 0x6a3b9f195d5164be
+, 0xd5d215766255725d, 0x4cb64e1871e974ba, 0x09c9e5459fc0ff1a, 0x541160ca2507871e, 0x6c00fe8ca510e589, 0x2969f3defd138c30, 0x67075f22ba4dd2be, 0x138ae98ece19ee3f, 0x35b9315b2f10e894, 0x7897e471ee902beb, 0x64098c74d49db4c7, 0x3fe9d50171a8bb35
+, 0x0f01bfcabd1281a6, 0x32e47613f8e9d8bc, 0xe4f71653f83fbf3e, 0x104f3120ca318e74, 0x8e178d550089ba39, 0x736f6fea00af9806, 0xdebf94d181337cf9, 0x0422cf00e949bc28, 0xa2091a109ff5f6d3, 0x60b5f62c76dcf4cc, 0x399efaca634cc23d, 0x1606286b82d78c56
+, 0x98181e0c3764a97c, 0x38560ac00de27cce, 0x8011522f36feec83, 0x6d55f0c676f7833d, 0x081564156795584f, 0x00f6fa31b3a9c212, 0xc127be70f75831db, 0x436ff7ad7eae4c39, 0x71a011ed5c4d4f28, 0x5412c47e5ccb0a3f, 0x4e58e6354c163582, 0x68cb445431c369bf
+, 0x74f6fa27abef2fec, 0x5fde1d93e6de0fa4, 0xadacea5947516223, 0x455bbdce35a91b62, 0xd7c1517df01df521, 0x65ece4006e3e3a63, 0x7a86aa32b703a1aa, 0x102e25b439ab2748, 0x5655aa76aa3949b1, 0x1afba4c9530a79cf, 0xe005e1bb1884d068, 0x0227faa6dd8f1bca
+, 0x31fab21043ac4744, 0x42fb86201ca84533, 0x89ea2c0bc11ee462, 0x51315523a96b4293, 0xb4b49810228f0763, 0x26e116f1c1788012, 0x26a70e9e8efc886f, 0x77992bcd73b9157f, 0x6520db2164a1e017, 0x13ef42ebd195ee83, 0x640239d29a77a0a0, 0x311f9f801960fa8b
+, 0x9ea6751c9121f412, 0x277c18e8e5b0bae9, 0x943f1a74b43d1eea, 0x23918b1b6de63b56, 0xafa93d39535203ce, 0x4dfcd07cf11e77ca, 0x982a0042b69a2571, 0x3973ac4e8ccbed61, 0x1655e92d8bd40ae0, 0x69d389b5aa22a7de, 0x56d5fa232b9343a8, 0x1635db6eb3fa4bc5
+, 0x8a326742df2bb6f0, 0x61303623dc7362d5, 0xf37840f6feb9e4e7, 0x2c58b77248d570b1, 0xeadb143ced8cbe92, 0x50e354886e456a77, 0x98ea395803a7327d, 0x4e6f4c94376c1219, 0x4a49c6c4f2ad4576, 0x1519ffb9ecfccbe8, 0xc87ded9d6d84844c, 0x22c9ab90ca309a5b
+, 0x09a164d7a526a207, 0x7f5b60e3d303091f, 0xec90a3d83a024433, 0x0b62101ac8e06a5d, 0x9b049488cf8d163e, 0x5f71915db128d2f7, 0x94605eabf9e12f57, 0x00f44857202c509e, 0xf4541ad3f7da33d8, 0x664593226f07903a, 0xe7b7afdf5a311ffb, 0x4aff4c413306ff56
+, 0x3c4ca8a4d4991f55, 0x0ddf672c2f34e3ae, 0xde99842c709efb6b, 0x65bff2aff9411bbe, 0x2262b0456927498c, 0x5bbb4179502b777b, 0x54966e92722ed4d8, 0x5b54d93d779940bb, 0x898b0392f85b9393, 0x46ba74147bc97888, 0xbac0d1333889330c, 0x07549eef0cefe017
+, 0xbea296c2d5536159, 0x0341bc7d5fb76dbc, 0x8fcb003d0fad108d, 0x1c291e3fff81d999, 0xb6ef0832be5a1ef2, 0x3dfbd0aa67f64f6d, 0xce7e2d8b0fe8781a, 0x5c1b653536a2fa08, 0xc0efb7ea584b214e, 0x47f26028db93a56a, 0x4af1c1cfa1061935, 0x5fa6360d1d999df6
+, 0xfaca00a0a514f899, 0x213e15dab9136a4b, 0x5a72def3efec8feb, 0x17e477f218d348d7, 0x9267c17fb9d4e9b2, 0x1ff40c86516257ba, 0xe868d43963b39cf1, 0x435bcfa7dc8e646b, 0x4abf9c5b77165374, 0x2c912d41c4be7c49, 0xcddb243dbaa8782c, 0x0a9dbb70a0c132b6
+, 0xb1063e1b45e21614, 0x018f912616a20361, 0x6630d036471991b6, 0x4af24550f7cdb990, 0x4192482c2d5f6e00, 0x199ef9c1e41e9986, 0xd4404320f46a0ca5, 0x3f3130c0baf20c87, 0x2dc3fc011f66e74f, 0x27ceec212cb269ba, 0xe6d95f504f80d1b7, 0x571df23e13243ee8
+, 0xecdc07b614c32094, 0x5c961ea770672e42, 0xb659fa86f31b037f, 0x3df7c3ff6839c89d, 0x894b5d96c1006b30, 0x2cbb0e2d33c2ba2a, 0xf8ac129240d30325, 0x486727f1d6a93d63, 0xfe547072efd5ad1a, 0x21bc3d407f32f732, 0x5cbd890aae8b5707, 0x5eb32b6063895b14
+, 0xf1f4d6becf3aa3a5, 0x6c6bca30494c28e8, 0x42e786a45f3a6deb, 0x7e3b993b16087589, 0x8e015d2c84671418, 0x6a1e47b332e1dcf7, 0x1cd60724ceb22595, 0x2998f3fb14723a0b, 0xae7db4b927f77362, 0x58a59bae357c823a, 0x515ddb1624c3731f, 0x46db0824ed8af60f
+, 0xcdd1ea0e12aaf1b6, 0x3327ac25ee2deb12, 0x556925538bf7f8dd, 0x71b2789c1710f86c, 0x95e81878c6dbbe68, 0x7e76f65e36fbaa2a, 0x53be7c041fabeada, 0x2f0f6f4ecc8cc089, 0xad2f039c68178880, 0x53e52e36f0c2b1d6, 0xfa17809285294b46, 0x70149e954451c541
+, 0x0712b818a65ce209, 0x27ab12b43a3d5305, 0x949fb95b8d404d63, 0x1e72f14244aae27f, 0x9a1700d148374aca, 0x62b0b22c3dba9d43, 0xcb46169a127ed30b, 0x316089ce68f5f5c0, 0xcc077db6f3073d0d, 0x7eb792821152922c, 0xa9c8e9afd527b6d1, 0x0daad7a1ab4a56f5
+, 0x734afec2407f9a5f, 0x0c3ff151583e0d25, 0xe17192224e3d07d3, 0x1a71f05a7529839c, 0x191932d79d31ed3e, 0x6775fc9320c15639, 0x30b83bf0bc856302, 0x46fc4af3bc95629a, 0x7dfa638932080918, 0x05aff65ccf048d3d, 0x36971bbbba5750e5, 0x7ccc816c9f7789e0
+, 0xa2ae5d0210c97a63, 0x6fbac48c470e0401, 0x9830390a1f343965, 0x242de5bb80918535, 0x9de95102e6fdeed4, 0x1205317f80ebf938, 0xf38f678225ea0852, 0x40a7c719f3d878c2, 0x1ce48ee5a353bad6, 0x13968f48d8f73cfb, 0x75fbc52730352cb6, 0x48903f951a372f5d
+, 0xf5d34d2e90869059, 0x60f5bdb2bf9d3c45, 0xd47815e8fe7eb6c9, 0x422525e9cf4bfd19, 0x693f246d33f76f8a, 0x096435dbeefbf2dd, 0x8beb17f7e57974fa, 0x20a924cd5f40ba9e, 0x7fe61cb2cda34568, 0x028d0defb5a93387, 0xfada687397659797, 0x37a0e54492c67993
+, 0x13dcb7dca5df74ef, 0x02d9bfad5e270418, 0x2b3ab0a3761e2b8e, 0x53871d34677e4c73, 0xf772b4f9a68195a3, 0x5b6fd4fd9a8d80d6, 0xb22d0531b6fb87ee, 0x1eb53b347c6b517a, 0x162d9cf5d24f5794, 0x59c9f548a5e8dff8, 0xd8ee5e28114ccc14, 0x29cbfb0062ca8a2c
+, 0x8efb37ce932ed99f, 0x64f72fc1dc377b44, 0x94099287ff89674f, 0x70196afc122124b6, 0x90849206c06be3e1, 0x15c3aaf4e9698709, 0xfc60428719839c19, 0x3942d57064705e84, 0x31a0c1080cdf0618, 0x14b2dc0b54581762, 0x3f739c5c43b7ad8d, 0x12d605454a60070e
+, 0x90b289aa2130c897, 0x73023b9d96ab2dce, 0xd51cae26a9ed6bcb, 0x0fbe1328ad48154c, 0x481a76163600c581, 0x33da7730a13574eb, 0x9f02154ba806c955, 0x7a8daa5109a0ee91, 0x008d9659d490d0b8, 0x0b029aab0c512684, 0x660effadc885628a, 0x7c0dee87408871c4
+, 0x9f1b47d97150f8ac, 0x47f90ff4136d818c, 0x3e835ecdf8f4584b, 0x0b9e45c06eb17804, 0x9d0cb62b2b2bf58a, 0x6aa3ad01d0fb2f45, 0x429c0f7fbeb041f2, 0x1700ae701fc87598, 0x8dbcc339100e244e, 0x1723d5fd28880d8d, 0x53df9038f18a3e9b, 0x03af3121c4e5e317
+, 0xd8d64b663a547bd4, 0x3fc88f867d150845, 0x51de45e7917535ab, 0x37a58ccb3517054d, 0x6db0cc5931ad8e9b, 0x05b7712e3c1e284c, 0x4435bfa50fc89978, 0x14abdd1c0a14b796, 0x260a2ab320f70ef6, 0x002049c9596d6cfa, 0x94cecfdc64349322, 0x4d557a02ce88b020
+, 0x7d318840b6f021cd, 0x3134ed902039cfcf, 0x2bfbfb832092050d, 0x6b9555a7a4cace24, 0x7d23e1fa7d47ccc7, 0x108439d4642ca85f, 0x1b2cf34153c4b9ff, 0x5709b22bc696b740, 0x45ee1464b4c3703a, 0x126d8a9704fefb32, 0xa0796452af32716b, 0x110024c8840c4c3e
+, 0x83f6947cb74fbde4, 0x373d39205b82c121, 0xeb36385ccf951814, 0x4737b1a2d5c6ab6f, 0xe3b9d35c337c0dcf, 0x543c4c5c5b2d2325, 0xe312b0bf284b4603, 0x202fe84ca175c540, 0x8678cb052ab5ad5f, 0x1efa3a65ce547050, 0xd0d95d0358197198, 0x14864f3890694c4b
+, 0x2362ef3d0abfb0d4, 0x1eaa99dd5204be1f, 0x427e135ef62b2913, 0x17e9c013986afd0a, 0xd7dc403c2bc9b3b3, 0x5d2c794a1edff1ec, 0xf7c76a5fe1ae9d1e, 0x191c4010d8eaf348, 0xc89f3b88ddb5beac, 0x788144ea879a65d4, 0x3a4df1c7d4db9861, 0x5a8c24af9c977a3c
+, 0x436027c64a5a86a2, 0x2891b84243e766e7, 0x1b00cc2a0aac7dc6, 0x29dc133b52c9425e, 0x557f527c15ea4f70, 0x3214aa91d5fe19e1, 0x3452eebd942cea50, 0x0107dfc674fd8c79, 0xafffb2b5e35e0ccc, 0x00aeefc5ee19c8d6, 0xfcb5aa396b1706e6, 0x4d0aeba7badc6c82
+, 0xda459ebb831b82b0, 0x4ae906b90cc465cf, 0x6fa6934e95a9c648, 0x47f1f4c382ee52c2, 0xee4697ed7cae8c29, 0x71633aac7d7bc439, 0x55495b8c8e9f41f0, 0x074c7666fab0d496, 0x05e2a01beead2ce3, 0x086910c971318eaa, 0x5cd2f64cdcad51af, 0x788f7775c549b175
+, 0x1c2c235145711996, 0x1e8aa80a9b26b5dd, 0x09f505326e2cccc9, 0x170160340a34a69b, 0x3308c11c4f9b7b8a, 0x68203b71feeeb6d9, 0xf67a39c3a1d5af6d, 0x2a94fd2ccc1274b9, 0x1a3f7c11a92026ae, 0x685e486f41ab1901, 0xe0eedc2f36082841, 0x24a4cb919127b851
+, 0x688bf35224d88577, 0x2c1c40cfd911c002, 0x6cb507fc530d8239, 0x3ae5d216dbd2dd81, 0xf9931257478cc47d, 0x7b8a227d2b2d5e52, 0x89809f6f7a20ce10, 0x180d7164868d4ca9, 0x4bafcb4bd1506d70, 0x19e3ef321f1c8e5c, 0xdf1f38c02e610342, 0x6bcf76b4eb46e614
+, 0x4786648cbe6c76a6, 0x501bc63a75d3991c, 0xa8278874a20fac50, 0x53985a413e08371c, 0xde032b3039b21197, 0x48e0e8db70377cf9, 0x39fb5309107b3d41, 0x3ef37572086cda0b, 0xa1a8461f205233bf, 0x051b3e4694233895, 0xe004c7e13fd96894, 0x31733d8d719cad7c
+, 0x6674e5763809a2b2, 0x06ee37633340d2c0, 0x73f309ead26a5ed0, 0x6521a7f3ab73b6dc, 0x1513227d16a5de18, 0x508d9197bfc4293d, 0xcf1aadba1780bc92, 0x38dede212951ccc9, 0xef8afab16e285740, 0x72438e2e1797477a, 0x6c21cf5f640f199e, 0x6f8e71536327d676
+, 0x27e7632c1643dd06, 0x0d0693f82fa16e65, 0x64964c770aae77b3, 0x5ac6d8766ec02585, 0x1af56bd1a832d137, 0x2846fa8374272843, 0xe727f4809194ef1f, 0x5eb2c985693daad2, 0x7e91fbf449496de2, 0x33e2d9ab539466b0, 0x2a6d3e2c4f897067, 0x0b82d1141413d94e
+, 0xf5efd87cdd00b4de, 0x79c48a42fa159e7c, 0x882a3073bdfea95e, 0x2a9573aea6948589, 0xb32ee6432d3447b0, 0x493d2981b9aac057, 0x33390a4a4f777988, 0x0846a539bfc7b99e, 0x8ba3981f48e12870, 0x56dff255263a7efb, 0xc2191d2b7fa23bad, 0x41c1f5d507e92f2d
+, 0x179366d14e89cc87, 0x670bbf9a6ab7e0f1, 0xf07ef21803bd67ef, 0x3c1ee568b56e173c, 0x093b4e3f88957e89, 0x5c3e5e877cdac360, 0x265ff2431414f495, 0x7186b45d59c7ea9e, 0x9d82d0b2c5124ff9, 0x47158804f28fe547, 0x9e7b514c52c8bd86, 0x7234d0b2fc846786
+, 0x74abcf1c6816d415, 0x72248269d8743584, 0xfb640bbc660948c0, 0x27b577f531e20684, 0x68a5b3d9782463a8, 0x5c4d1269879824ee, 0x30e5225bc6049329, 0x7a8ffb7a1430d223, 0x9c81f56f5bb45130, 0x75ae542aa3a39dbf, 0xb4d75076d092f0b9, 0x30a45920c54ca7be
+, 0x59ee1aa1de01a6b3, 0x142388206159b207, 0x1c4d68e89f5df3cf, 0x1a922798da4ee8e4, 0xc6dffff10ef6e44f, 0x1fb9d827ae79eef6, 0x99727820cb6b53b5, 0x6bd5fbdf6010e52c, 0xed9e4c699ed834da, 0x5cdf264dfa49e355, 0x09880b46d8e7bb31, 0x33c072b5f08716a2
+, 0x71bafde0ad589f89, 0x194d5679d20aae29, 0xe00faf3c4b8b78c0, 0x1fcc3d87528ff3c3, 0x8dd21cc881a91767, 0x18043ba8eb04e25f, 0x639f6ca04f30239e, 0x5b88c8b1e0a36049, 0x8fa6ceb5b0a9f451, 0x42a397f17e764b5d, 0xf4241300347dda37, 0x15bd5621cd83b5cb
+, 0xb3b09fcc25dc1245, 0x5cb5ed360b506935, 0x04cfed84bba82be1, 0x445dab3170b69ca8, 0x53a4fe6c42fc1a3b, 0x2f0250369f5cfe97, 0x5d53abcf7deda099, 0x7ce303620cd6a59a, 0xeb0b7fc766f522d5, 0x1c8f4712f1233d67, 0xa50b13e91fa941ae, 0x08cc6469fbfe65fc
+, 0x290375bc604be873, 0x2d67b99ba6449a99, 0xbb124d1ed0eac716, 0x57faf3d6b995499d, 0x07391aa3de17d952, 0x7d43ab96e60f37e8, 0xcb30a5c23afff411, 0x3f8343d76782a584, 0x76c71f1050855d4d, 0x0bb6ee9a026c656d, 0x223a72f8143f4127, 0x17658639c8628d79
+, 0x9cb233cafd0488f4, 0x5b4b35f85111dce7, 0x043c6e1ea5ce03e0, 0x788d8c6d5f218a35, 0x0afcbb828ade8f56, 0x27e3b1c50f2df291, 0x8f267b7a5358c53a, 0x66d2abf1cf8740ff, 0x0a5764192b83dda8, 0x430856c10d7ca322, 0xe4f9f9f4ee388400, 0x0786f9ffce06502f
+, 0x7763123005de56ae, 0x09f778feab6244b1, 0xbe5f8f211af07021, 0x48457430b0508517, 0xe27c794ea3b55c13, 0x35f8fc960065e62c, 0xb045a7a97fb84987, 0x2b06402773340d94, 0xcfa07297ae0d130d, 0x5a27afda6bbb057b, 0x10ec964831271ae1, 0x3e1ac1cea4ba71e7
+, 0xc8b0e9e0a3d44ad0, 0x19c637d626fadbc4, 0xaad7b175b8b77c86, 0x72a26ca40984e090, 0x6231982c7f433cf4, 0x64659eadd9d49a79, 0xb2167e1b8cc63cf6, 0x23b24c58efb39040, 0xdafe6cc588e89615, 0x71b5c1ca17cbb4a4, 0xf12ba888143ddf3e, 0x5c03062de2982a55
+, 0x50163f23de3b8121, 0x7dc4d010d6041363, 0xd0bbe3ed712293f4, 0x7ec4de4183abb4ec, 0xd9b43907667f352a, 0x644bed1b2441c1e1, 0x5e188d2a0fe2ae28, 0x5af8ee2481146a35, 0x0c4d33dc9ae5eeec, 0x605bf6361508fdf9, 0x84a7434d190655df, 0x0ab2b9786b2c7dd9
+, 0x846d0018082d7b8f, 0x712300c9d8d6ddee, 0xcbd00b424d96e82c, 0x71719df07d7782a1, 0x0d288a0fd2b954ab, 0x45cb1b9ca5b4d719, 0x8799e39c06afbc3f, 0x49493be9aa16a658, 0x52ac6742b1a96fe3, 0x5f4a586d8ab16b39, 0xc74ef0d6c395b1ac, 0x3d6302c3c1ad6652
+, 0xd38ba9c7a1892520, 0x731d7c4c79833b56, 0x3e3a3dc7f172800b, 0x7ea7ada31e9baed4, 0x5bce9ea3f6d60d2d, 0x28947a3b9d0b035e, 0xc2de398f133dc2a8, 0x5d120c5f6a3a923f, 0xcc6603f9b6d6cf53, 0x7033276f27c96d79, 0xe59833f0ea8866a1, 0x58e80b3208de1fe4
+, 0x5cec840f46ec71f8, 0x01e156932dc1b2a3, 0x4201b0f37daaa0ad, 0x7d7ef7589ee8d9fd, 0x8fad170da72b9020, 0x4e44cff2760e1f62, 0xdf14d5e7c5568dd9, 0x322d3246cb0cad07, 0x44c2b90e3911c757, 0x5c3fc84c9f923f8c, 0xb4874590f71b6734, 0x40335a1561f6ec5d
+, 0x8c4ba028221375f2, 0x638b9184eaf42734, 0xb64c13834f793042, 0x5c4a43838be6cce3, 0x0f26bc96ce7eef80, 0x3570f32e0411c163, 0xf2ca06cff680c03b, 0x45d641581994d1f0, 0x7826b2f0c059d464, 0x0f91a40caf635553, 0xe81228cfa321c918, 0x76dea004ba3d2993
+, 0x269d0f047db42f0b, 0x3d49842328ea9d2b, 0xaf76c4debec22f84, 0x290cbbd24df62f8a, 0xe2a5c97e6e96cfd6, 0x05c98bdc47112b50, 0xdab07ba166790869, 0x63317920f838694b, 0x42b3877d9ffa4d74, 0x57c96cf8eb5625ea, 0x40a12bf3888bb694, 0x6e47135c06740230
+, 0x57bd72140ddd32bc, 0x37555f8429b3d4f9, 0x99406ed8ca5faf7c, 0x25f5f109312c3acb, 0x6f53c5b8ee019dd2, 0x02df140f6f66fe6a, 0xbfcdb189f79ded65, 0x45af80289a527988, 0xf3cb723f835592a1, 0x74ce3b1409448612, 0x28a76a89651e826f, 0x6fda35b1e2f6f25e
+, 0x39b4c2588289c334, 0x3ddaa667f67871a4, 0x87925edbefa95030, 0x74013259ba1c8216, 0x9a4805e33cb12fb6, 0x1a115a24330be67c, 0x2bb2aaccc11bd34b, 0x1f1e63719f93bca4, 0x94608b435b1af473, 0x4786b3ffcf30a96b, 0x4ec20390b737c14f, 0x2f77ae191669905c
+, 0xdb28e6a00f583fa0, 0x640e4751753464ed, 0xef9696c245e5809e, 0x37a686e2f0ccb8c7, 0x486755d5daa02f50, 0x55a70c366ab239ac, 0x1f0330204ff5d712, 0x4712bfef5ab64d1d, 0xded4311bef841a1b, 0x4d81a040e92a5b58, 0xd1bf23d635d15543, 0x5a7182c7213920a3
+, 0xa831d9fb46c5e3cc, 0x26102df44f9edb22, 0x83aa4658eb8cd592, 0x2fe47df40854b9b8, 0x8446ef83e96d7055, 0x3cebabb7d79e60a2, 0xe17fac1b59c25718, 0x04772d0fbd95ac8d, 0x36fe3e160e48b945, 0x4a59c0657cb01f46, 0x6cbd6c7e5b1a2cf1, 0x26776c81edeefbef
+, 0x9590e6c3fa56177a, 0x5f308b7de8287859, 0x140c65f8f7220bfb, 0x7a095ffb5ba66c35, 0xf027e25a3d588c6c, 0x4f9eb563a8bc3980, 0x6a1a14330b410702, 0x075c64b11af0e959, 0x49b9648aff2dd73e, 0x525a45b74625c35f, 0x8515f3a147f862bb, 0x0c570cd32295ac94
+, 0xb2f81861fed8af82, 0x2393f56659003c35, 0xe62880717be4f934, 0x20f35e877382debd, 0xe8430a0940049c2d, 0x08552a8b1e3bfe0f, 0x5deec19eb19692a3, 0x7f5bb43fb52869bc, 0xe6c5814763c381c6, 0x6040ef5be4fce8c2, 0x291976a17215db8c, 0x150043aed6a035ee
+, 0x8606aa4b1c5a0af2, 0x6cf67d49fb20fdec, 0xd6816bd0934decdf, 0x60b82a44f3d56642, 0x40f96b00352b01ff, 0x292e0839b7a15c2c, 0x9db3e36f3a826956, 0x6f6d4da351ea4fde, 0x6ae78edc319d5fb5, 0x1cc001af85615ca2, 0x68ab3f71b311a75d, 0x525b387e18208a7a
+, 0xc6427db457863ec7, 0x3a00e10562cb6a60, 0xeea98cfbdec72c48, 0x0be22cb792fac39a, 0x194d2064de124fe9, 0x09c47ca478252278, 0xc0203d80ed00ba63, 0x3d63239dabc9ac75, 0x74f4188f7014ce3c, 0x16ce7970753f1484, 0xe624629e6df5f757, 0x250a70372eefa8b6
+, 0x083d2391c10ad561, 0x4248185ff1cab139, 0xe8293a31f7eccb62, 0x07a297966c653b4e, 0x0f95ed3b4128f15d, 0x2c9e57aeda489c26, 0xbfa361bed0c9943c, 0x711e4f9367817504, 0x04a8b3a5c81958fe, 0x4c8283e1d9a41281, 0x41c269f50eb09c0f, 0x116fd6afeb5a4bfd
+, 0x14e08fb87bdfab59, 0x69b2c78c3440fb2a, 0xbe156003d80f04ae, 0x0845cd37a768fe5c, 0xdce6c66952123ffd, 0x60f2c119c0cd1e11, 0xef050d0f610139bc, 0x671efa4d0ab2bd56, 0x344880d49a11a8d8, 0x7613af6f49e16117, 0x160c9abe73fa906f, 0x49b69973852b76be
+, 0x2a9007349a8ce63b, 0x70485e5b128035b7, 0x4e003fd8695dc012, 0x56ec35dfce9bb05d, 0xdc6266ac79116941, 0x5c718578b34f0d99, 0xcd9e5d5cde153d73, 0x37c9929ca64c0668, 0x0ceb3a04e302f284, 0x59a834f0cc5f9742, 0x1ade3f9a7b43f58b, 0x12de18473a175447
+, 0xb8116d74310d0052, 0x6a6bc9d7162d42b4, 0xe72b0742d21d50bf, 0x7d7a87e74362a27f, 0xcdb871c2b2240028, 0x03f789745f77ed88, 0x6f269ebdd974819c, 0x1ef85735605e8492, 0x071df091a696ce6e, 0x234ae88fdde028a7, 0x24105c21a8e395c0, 0x322cc2f9e5bd28bc
+, 0x3709e46ac615f732, 0x3780c59e8ab0a1fb, 0x2182a43073041c47, 0x5522a7004ebbb40d, 0x0953e9b612d3cff6, 0x52e9269a79f77933, 0x7cc1c0940568724b, 0x645f4c5f8e566aef, 0xb49aa097eb1e102d, 0x2f3afbdd2cc93419, 0x7442df68ff7b298e, 0x1830014724842981
+, 0xca600c902d2c0eb5, 0x4d63b1a740c1b09d, 0xd8829afa56d5852c, 0x6aed1b6f2bf8d546, 0xa1cd8452581bc5c8, 0x5870aa966fe3c828, 0x503ff3493057805e, 0x160f9e70b2d03849, 0x9b4a56eb656aa091, 0x6b1402ab7c0e166d, 0xd2f0836cbaaefc3e, 0x5572135d860e2b6a
+, 0x14490982ebd78e84, 0x55888c2822baf663, 0xee40f75c837bd613, 0x5912dfd1588da16b, 0xf84167632866e5cb, 0x0dace15c8f3eec5e, 0x7d1637d0a6142174, 0x362bf18f39d4c2c5, 0xad601b41c2d144b9, 0x1d16fe0079334ae7, 0xae1c27c47e884a55, 0x1a653b246aa31319
+, 0xa8769d3dedf39e2a, 0x0cf376013226efb0, 0x2b3e95174ea52f71, 0x04c5805b6d9011f6, 0x965954ed6f5d7e0a, 0x10ed9915512aa15a, 0xe48dac2de088e15a, 0x38326044ab530af0, 0x64c3692ed016a0fd, 0x5a0e07bc254f89d1, 0xf60bb7fdcfd2002e, 0x0c5b4d1d5fdf2945
+, 0x30cf6295ebca827f, 0x40990f0f588674f6, 0x6bc52a2d91bbbe2a, 0x3eaf289ad9b13a86, 0xfcbfc1a97ff264aa, 0x61950e22144906e1, 0xe39ece8b0d8e3a27, 0x6613e39711cc72e5, 0xfe6e3d52c2f58dca, 0x0325d0019f77885d, 0x0900369542406ad2, 0x2afdcc18d9dfb808
+, 0xfeeceb2dd6ee99a7, 0x11465570fb741a38, 0x41a32dc4c1e5d1cb, 0x63a007d54cee3386, 0xe74ada6551700a44, 0x375e84825f0cfef8, 0x07539776ba14f81a, 0x607e98f0c66e81c7, 0xd13c6182bf548557, 0x1acf3fe517bc2572, 0xd59990a955007a23, 0x7e0a1a5925818274
+, 0x48926cbd1d93f698, 0x12b8cc7fe00ec419, 0x90c426eeb357ce28, 0x031f6420be772b96, 0xe6f165b26bdb1ecd, 0x2b87f13ed23e8e4d, 0x06678ab690b3fe97, 0x6bd3fe4b5df22a2d, 0x6a4537921ff3b6f5, 0x3fb321a452d60bc4, 0x7206d28125b442f2, 0x60c2b345b25c3a81
+, 0x368caa9993ee1baf, 0x2982618567d5c27a, 0x382c5eaf42a00ffd, 0x2f7f8eb73ee46064, 0x4f01e58a7c2965d4, 0x336fb9cf4cc48a49, 0xfa6ca0be66a0464c, 0x247714c3dfc8b7da, 0xacca94a44d4d3d2e, 0x7363c81260ae8f30, 0xd8342bbd085d15e1, 0x256b1e81376ad66d
+, 0x02b3dfa1f001da93, 0x144935a721d38c4e, 0x0a97aba85cede1f2, 0x06b161d41f4cb500, 0x6707b23869060865, 0x5c271c9778ef8749, 0x3a62a4b57d1854cf, 0x6a7ec3684e60673c, 0x555be7b5f940ccb6, 0x6c81c007b26e8fc3, 0xa77dbde67ed901a9, 0x5181e41ad87b714f
+, 0xa180a828abdadc1c, 0x2313236de0718025, 0xfdba498c609003d2, 0x2a156fba8aa1e168, 0xaaafaf59217aec43, 0x31f873dc3f1cf395, 0x40919429c6a7d4e6, 0x4aa2e9971ed9b9f2, 0x43c0037ef531e9d2, 0x196c5ba5155a31f2, 0xb7aff822a6f706e6, 0x2edccaf49d298a9a
+, 0xc62c7d1efd272d22, 0x1856bc7e151444bd, 0x5e4fc87027c39fe6, 0x166f178b9bf41b7e, 0x20f2fbf1ec70b169, 0x5b6f54a63d892e2b, 0xf59c23806d2f088f, 0x44801ad2707da953, 0xf47e93f0610a6b35, 0x1b10789f2ab03639, 0x2ad490ac41b37b21, 0x38004e1f9bdf27f3
+, 0x3bc3111f65696c68, 0x60ce47d54ad661ca, 0x6b5e86a9d590f81e, 0x1a415da0ac342b3a, 0xe36343fc4a78de5a, 0x4c517eb710e95e00, 0x55a9c0ba4de0bb01, 0x2e77a4316428c41c, 0x913acbf59e1b8654, 0x2eaa44c764dde478, 0x0e80d8dd1da384c2, 0x5489aaec60da1cbb
+, 0xdad337b318910324, 0x007e9e9ee8e1b331, 0xd7f893a461e2fd86, 0x20ccd2fd66df63d5, 0x9c9c4621fc0e8735, 0x46f15a165ad5993e, 0x7fb29d55af70467a, 0x255655bdaca6f72e, 0x3811c48e7d097e94, 0x342fa7ea82bc6f80, 0x1bf02915982fd5c7, 0x5ce0588557b8e11d
+, 0x291167b5f0bea67d, 0x17df0d1c167ad395, 0x3bf630eaf35bab0e, 0x6a4bc72f0eba350f, 0xf8063bd3ec2736a6, 0x55d4a6598a6fec92, 0xf6ceb86962e4ea34, 0x3862acc82435d74c, 0x38aaf260d76ac83c, 0x736262e3f571e88e, 0xd574a16c6eabcc03, 0x1c876366d72673af
+, 0x0ad2b47971bb66cf, 0x5921f641fef50e99, 0xf68cd285c66ec956, 0x7658ad8805528fcf, 0x806e443e8c336b27, 0x35003d904cc4c0cb, 0x7a4c0acc3f65b0c4, 0x76a8b47f740ca549, 0x3dbe6360b0c6538b, 0x3ab596b457c7cd23, 0x5fd2e9387bb1474a, 0x593241be8120d1e5
+, 0xdc253a18febfbf48, 0x00c6b803b7189659, 0x587bb777ae1177b0, 0x01199d1f049d1522, 0x901b41873b328692, 0x60f22a5797e80e91, 0x02200f7467193df3, 0x54b717b509ddb95a, 0x94b5173f41e910df, 0x78d16169b0cce049, 0x7b4bfb91f0f3366a, 0x6165c17b8646cf84
+, 0x78cdd0f6fe839e06, 0x2fe386f771cfc83b, 0xbe757842b575887d, 0x4031cd12f0032174, 0x2773638df49799fc, 0x5bf34f6c649ca53a, 0x04aa1a5bb4949218, 0x66a44e30befe5716, 0xff1f35b8ea444b88, 0x1d00b4edd171e63d, 0x446fedec17ff62e9, 0x06005b4f4cbb7ecb
+, 0x3d7d8dfada859ce6, 0x2dea7a846979cbad, 0xd0481f762d47e027, 0x3233b9ffdc1a20ba, 0xedb7694600ef007d, 0x7c0fdb743b3c3eae, 0x746213b883c9c132, 0x3d50c4541007af6d, 0xc31435a494ef73be, 0x5dc397c46b05dacf, 0xfd4461d87e85502e, 0x0fe082f5ef8b5976
+, 0xd753caf06048f93c, 0x7787f5f6840d39ef, 0x6d571f68f445cd7d, 0x3d12285d8b9f4bca, 0x865668d6483a72a2, 0x3c70877570a41800, 0xb61b0dd57ef7519a, 0x1c16d2641765b5f8, 0x730725ea5da3f62f, 0x29fda720b0e00330, 0x2f674dd766b3f1b4, 0x2687eb8a8f5b06d9
+, 0x1d86be27a8cc626b, 0x3c5bfd9f7d1f87f1, 0xcd4befa1cfee6f84, 0x5503d3b770eb70dc, 0xfdd0280e368a8714, 0x32be3cee06afcd7f, 0x719d7a8b993e015b, 0x349ebce4cea6297c, 0xf69031984edd31f2, 0x7064d63f27bee2c2, 0x5434e06613a7aa0f, 0x3b8eb89cbf40b803
+, 0x36e45b9660cb7c5a, 0x04a2200dabc345a4, 0x735d9bd894a635ad, 0x451174ad4344059f, 0x8d04b30ac4b64527, 0x5dc9c0d19a8a7ba6, 0xf95b5df6bca86dc8, 0x6e46e232d82a6377, 0x194cada382bec5ac, 0x6af907cc3cedf3a4, 0xb7078abdc751e690, 0x3a67928767f5c62c
+, 0xcb05f34f9c2dcd25, 0x03a202e41dcfe14b, 0x425c1906799c30f1, 0x55ad5c9eb7fce8e6, 0x5dc6c6a6603fe596, 0x29ed530e2edf585f, 0x445731a1f246f83f, 0x72394f2a38d2ab4b, 0xfa644e40720975f6, 0x169c6db7f90d6153, 0x4a5191362be5b19c, 0x1b4c9bb7c4fad8bf
+, 0xe95981634d7922aa, 0x6ec189bf7f2b1fd0, 0xd9acd0e6628c177f, 0x5afd9d81677a46d7, 0x0546330656689586, 0x13183c62f57dcf75, 0x4214b81ee13ee06e, 0x235c36ab23f428db, 0x41b797c434589626, 0x5b6d777816348848, 0xfaf07d0a4daebc31, 0x3df63a752c84f170
+, 0x81c8df9be107feac, 0x6952e85d06dfbb28, 0xd7a8bee23f941d66, 0x7e3672a8e535d18e, 0xe52cb39bbb435429, 0x7f981a8d38e6da2c, 0x2fc0f2ea2bf172e0, 0x79334848d6b4be24, 0x7692863104f57bbd, 0x0c72a453164f8dcd, 0xfc6bd96bc9d302b5, 0x34a4db833e28ad5a
+, 0xcc128e3d9a8c6a8e, 0x701c54a0a273a24d, 0xcd6c56b3e0271cb2, 0x3cb884610581c01c, 0x818a733f223a1cf2, 0x72d34b4fdcc78117, 0x1cfde9f5a0e2c1b9, 0x59ffeab574d4ac80, 0xc7bb98892040de9e, 0x59af4a49d94ef66d, 0xfd0e378bc6726361, 0x6c1a92037bc8167c
+, 0xb8c6d1847900d706, 0x0706f73740401913, 0xedc9793ff4de785d, 0x1f7ba6fc55571594, 0xd8a8669d6faa45a9, 0x73296f5d977d32cb, 0x578b5ba102050a90, 0x2819a90f9501a96c, 0xff75711ae5ac4577, 0x307e0c6fb9376952, 0xef458afddfee3d1e, 0x4f405af0eb33225e
+, 0xde57c324caa624b5, 0x1f7b1eb8ea803e75, 0x636a5a171bdf7f53, 0x4a8e259bc7450580, 0x251c699e138b6bd0, 0x7c0828cb26e0a95c, 0x0f0b6895846fbb49, 0x34e0f7ea61881499, 0x641fcfee2d93559e, 0x3a58fa388ab3a971, 0xbf7d33ac018af889, 0x39bfacb095732cef
+, 0x7b511843ec237c7a, 0x5253c7ff63da0f6c, 0xcc9cbc59e0be60ca, 0x10438d3d5d9aa68f, 0x1b0cb148db82a468, 0x3536076eaca97788, 0xff49cf900d067f8f, 0x3cd44ab36ebb7c38, 0xff951fd4754fa532, 0x44957365d3fa2abf, 0x97edd150bcca5315, 0x3bd6821b2c80c392
+, 0x3b410b8419207fed, 0x59aa76c7621cdd8e, 0x3e2d135070303215, 0x72656f439d45b47a, 0x8c18c7c0f44bcd15, 0x0cb70f7ca810eb01, 0x7caea70700bc2b11, 0x1ba3735704042c05, 0x7c2f1361f4806f29, 0x0ca7401edd2b7219, 0x8097bcc6aa59d93a, 0x4920fa227d81da1d
+, 0xa7a20fb7b7b1a3d2, 0x2e7609819063896f, 0xe7c73543168ec143, 0x03648cc4296b57a7, 0x9e3a2b1f50928f44, 0x552ca49a3d52fb5d, 0x61f250caab3bb7bb, 0x1b232fc725f9068a, 0x12c2f8c01fc4afd5, 0x5941f10a760d79f5, 0x92c8387ed806f299, 0x79baf7ebba81be54
+, 0xefe0aa0cb125a85a, 0x43e5fbcd4ba405ad, 0x72f4f75968c65348, 0x575b8edb3c4177e3, 0xc5ab9f41097083e2, 0x7cac9cdbd7ea6168, 0x8219ce479374b4be, 0x4cb141eeb2535131, 0xbfe162d2e112138d, 0x6345105714c6ab2a, 0xf351cb13967e4dca, 0x15f22397ea702530
+, 0x98900072025d8ead, 0x59fedf3352867f73, 0x6f8fb3f1d9420d36, 0x0a20ab981415f2c2, 0xa98f26860884b68c, 0x57deb7ad088c36ed, 0xce80d03ee694b79f, 0x319f64cd759e8df0, 0xdb9a7202ec16eeea, 0x31a3aa740d76d76f, 0x9c1ff10abeee3d17, 0x66235e1e84c5674a
+, 0x8778fec0b8a00d53, 0x2f9127d7b92d9f8f, 0x503ea40d1b1c0dbb, 0x454be431c534df31, 0xa3d54b2db89f813c, 0x5225baa126cd1a51, 0x168e50e851a3f7c1, 0x634024c8c73f3f93, 0xcb65a3d318abe586, 0x58b4a6061da940b0, 0xb0ce0da10de8a9ff, 0x7e8ef60dac15a020
+, 0xd41bad19cabf5628, 0x64ea47582421f77e, 0xfc676661544f0167, 0x6b51bfdf7b89e4a9, 0x9b814202454f7dc9, 0x612a67b558e62c44, 0x7c9d454fa6d1ca88, 0x7e687dc51361c825, 0xfc68d0d8456b2b4e, 0x15b6dc85d9e17d0e, 0x103f3e84043bbe1a, 0x5caf8540b9ba95e8
+, 0x3fa8e70b727cfd5a, 0x7314b99f43b0da59, 0x0e59dca9ec067d06, 0x16443a11ec684ef7, 0xb3d9666d932d8d71, 0x5f57994fbe1a04a0, 0x17d2d4ed5a398163, 0x6d35a50e74756952, 0xe0fb099d8adbf6d0, 0x118f3aa13ffe26bc, 0x69cf6e23bc7f6bdc, 0x53cb8522e961e7da
+, 0x3e4812e18229f407, 0x7ec0ff28660e8d78, 0x7e32346f8b0e11b6, 0x193c73dc3a440e82, 0x63446bee59985451, 0x349bcf5dfb020a43, 0x29d059a847cbac28, 0x6871d5f5ebe6f7ae, 0xb932b4765478a120, 0x610b88e08345b54e, 0x49cd1893333084a0, 0x1360717323a0b01f
+, 0x1c2596ff070e9fc8, 0x5c28d6edf37ae69a, 0xf1481cecdf4d926b, 0x02835fce57cc75c5, 0x5a97701792bc7d10, 0x273157522a0f3e47, 0xcea3075b9f77e223, 0x5403ec5de12ec8ca, 0xe9cecdc94fede465, 0x7922b87af5b45ace, 0xf9671e2307f8d92c, 0x7fffa5a241fd9af1
+, 0xb831a1bd4257e6cc, 0x3a26e1171b7ab9fb, 0xabb049601a985695, 0x3e072baeef3a5fb0, 0xd71eb05f099907c0, 0x359b1fdb3dc2d238, 0xb695addcd8e47327, 0x0892b8ea5edb42d4, 0x8a099616179b0224, 0x5cf58eebba843663, 0x8435f64012556af1, 0x2508fa6bf1666799
+, 0x37a0bd48139b98a6, 0x5078d6daf8e88f00, 0x225841d8787306a8, 0x2219fd05c062a179, 0xf7af4a1ff04f0204, 0x70b2f88bbfcf656e, 0xb110d4898e1f8208, 0x43e6cd7e41d17448, 0x8feb8515dfe3227f, 0x413fbfc1feb2ed80, 0xd8a5ffd5c9dea65a, 0x7eb041d8bc0785cc
+, 0x307e24452cefe379, 0x35c8c8eb890900d9, 0x09a63b74a15b818e, 0x54519065293d9a03, 0x9f3331db3f0764a6, 0x5f94f43f98672ba8, 0x00ccc39584ccb5c4, 0x0890f97ee9ff8657, 0xd45d3866190a5f24, 0x223fd680a862cdd6, 0x001f19b48e5b364d, 0x50539c6da19eae8b
+, 0x3c67b569c86049c6, 0x1d98810109accccc, 0x8b5b3cee392c15df, 0x521fcc99a71dadc5, 0x3d0c15dcbcf6379b, 0x1338a555e6b4c0dd, 0xfe0cb304842bbc8d, 0x505748a9b4deee15, 0x672a80e4fce2e5e2, 0x3222df620bde027d, 0xbedc4b69ac2943f7, 0x06cee43dec0f88fa
+, 0x07226d984c21a3b8, 0x5f190d435b9af76b, 0xd2ff31315e71319d, 0x3bcb53518ab6d2f3, 0x3f8c5c3843fe8c5e, 0x7796b1c254f3bf8a, 0x8411db74c1aa4c68, 0x32fba9b204183bdb, 0xdf6d3074e209939f, 0x78d34a160ef8d04f, 0x3351bf9383d7e378, 0x1e00718cc093038a
+, 0x89238ef45b21fe3b, 0x7b1ae62185265e15, 0x7708483503824bf3, 0x661d58afb5057394, 0xfde2e74318c422a9, 0x37d61bb7e2d458bc, 0x8d1e1584eb6a7aac, 0x7cf673db3255e522, 0x6c19b326c8392f89, 0x55d92df62788dddf, 0x84280ab5ceea2788, 0x4af4e7e0ff71eecd
+, 0x71cb7c6ec075db0b, 0x6e1658405af37bea, 0x9d296c459a469a21, 0x150b1a7b040a3501, 0xa32e60b7ed56f7c5, 0x764c64129e2bfbea, 0xe3841bb1876e4192, 0x3b37589064833f01, 0x1f345ce6a7ba4ea6, 0x6137bb2ff004800c, 0xcb661f04782493ff, 0x56db98570a898b17
+, 0x7240af8a26683ada, 0x6ddaacdbf224e6db, 0xcb7aca1129c076f1, 0x64b6a3cb5b6a390e, 0xa7f3deba17e2e807, 0x0729c29d57ccefe8, 0xdb20f273bdf4d65c, 0x08dc3b55c4a277a1, 0x650144a67a2bbf3f, 0x782d8b5ac32c2528, 0xb53dafb8b99e1d34, 0x608ed355ceacca37
+, 0xcb41802df4433206, 0x5088897d2ca511e8, 0xf872ef8f9108f908, 0x4cf1068dc6c46657, 0x0d3cd5bc7fdcbb13, 0x6e322fb9a48518be, 0x020862d9a661b8a7, 0x03f479c5a97bc030, 0xaac13faabdaacc5b, 0x2290738008ddf38e, 0x70e661976fee9b14, 0x21669bd7b9c42ad0
+, 0x329d498dd7f62ef7, 0x2fae9c78c67964c3, 0x4810de779f57eba9, 0x251a561585c34fe9, 0x76b53d46d3b72034, 0x3d01df4fcca23b1c, 0x05d6851c5e982f34, 0x1aa7c25203458245, 0x389daae3c105f0c2, 0x7ebf5a6de10395d9, 0xd440f53c3883806d, 0x640d2988922f8f48
+, 0x66264e60ce940f57, 0x0c3dc46283aefc18, 0x34eed4e35c0b51b4, 0x7aaea7cf5723434e, 0x3534166714c85422, 0x2f8edf4f862643da, 0xf485ce2fe64ddcf8, 0x46e74c2a7c36172d, 0xa06d5bb14a7f130b, 0x63886917b15f1942, 0x4098728317bd2471, 0x044f91f59484452c
+, 0x730322c4f9cccbaa, 0x4a3667e603515c66, 0x1a7533ff49d20d20, 0x0d7a10187dd2ed69, 0xed10854e66070b8b, 0x511a21bbb2afa77a, 0x197465aea62de5fa, 0x2d5cf8b1c4b94676, 0xced4db6acccaa592, 0x0c1c419f6ac01d7b, 0xa69dd017d73ed0bc, 0x51cc0d340a36e0d5
+, 0x22cb712c34120d6f, 0x0402cdc70d73b2b7, 0xb164e3a5ab41240a, 0x7df22ccd5ce82bdb, 0x682d4e2b97c71cbd, 0x457fa2fad575c008, 0x2030890da060b114, 0x4c27a34092d6950a, 0xc30e5c50e1f72607, 0x6e8ba53f4761605c, 0xb183902dfce1cd5e, 0x395d4f31c5c5234a
+, 0xaff18a04bb4fcfed, 0x71a13990f3c99cdb, 0xed98b3dbe58df46f, 0x06c6bd00a8d52f8b, 0xed7736833f157882, 0x7b927a6545fce65b, 0xe11ef18fdd1cbc70, 0x5b96ad531fcb78b9, 0x9bc3e87fe8bcfcd7, 0x1a36d0c7bfbb70ea, 0x37001727ba9d645e, 0x4cc66ae09a3192ad
+, 0xcebfe134c97a3abf, 0x16bb7319092d6358, 0x9fe5fa46e93d7aa3, 0x3af175e98586fee2, 0x024344209fc88cd7, 0x566d70be1f153646, 0xcd617cd1972a9ba1, 0x45c2bd680d1a1d4d, 0x5f5d21bb2a4d6595, 0x3fc37484228c854a, 0xf100f66497c43113, 0x09347fefbe10cadf
+, 0x58bc72c5c7b94bac, 0x09964d24753a2e48, 0xb4df05650c06f142, 0x3000fdcf8dde09cf, 0x833814c840b433fc, 0x411e4d8e0e0ffba7, 0x07d9161c302f2a4f, 0x78c1f06db3153149, 0x53c35d2961625fe6, 0x72542efc2830375f, 0x374c9d0e6d056f9e, 0x6a3422ab8714ca29
+, 0x5120522f92a96e03, 0x3ded1a6ea39efd24, 0x52c1dcb447600454, 0x40849fbd40a9d894, 0xb68153e91e146364, 0x43cdf9f744c0d02d, 0x1dce06ffe4d38154, 0x3a32cf6d0189ab48, 0x5ce9c8dd06935d70, 0x426cf6bb53ca23b3, 0x7f486ac3bc52d62b, 0x72aec91f041df746
+, 0x73b42ddd01f74c19, 0x739efcc3bfcd9a2b, 0xaf920302b25cc036, 0x0a3db69299f128e8, 0x979b33cf01f76a9c, 0x097baacdba1d99be, 0xe54a249b504760ee, 0x689d2e08615e5540, 0x87986cedf5ed2733, 0x426f8054f89bec88, 0x14c761675b4c48c3, 0x6068d90dd7f77630
+, 0xf0b7fa3efeab1955, 0x6938b19191680c21, 0x1d45f1d7ea42eeef, 0x66188f782f2a211b, 0x4f48e93b6cfc4e29, 0x207607b150498292, 0x3553085a134e1148, 0x3e50ebab5047db54, 0x09f9bfcc72590cee, 0x53ff0eaeb10ebc64, 0x156e155a296a0dd0, 0x64385f66f12bf92f
+, 0x8021216e23aeb6ca, 0x0d4182353ea47e6d, 0xba91247958f9b6da, 0x1b7b26440abdda10, 0xb395993fc997bfed, 0x6b1ce811791d7792, 0xe547862c8de6b686, 0x47d63aff4b27f1b4, 0x8feb877c7bc83800, 0x36111c218a962d93, 0xe64d21291ff9d277, 0x631f18e0112fc806
+, 0xfce6bc7862c6c178, 0x1a7069c94ede736c, 0x6897c87f9fc6e4d8, 0x59caaa4fba2837a6, 0x99be80c865f34b7f, 0x16f4af482f0c0caf, 0x2a5570f7fc39a761, 0x3aa5e6519fef3a41, 0x098afce2511dcee6, 0x2a40fc73196ae6e7, 0x39747a7d70017798, 0x4506400e54b99bcd };
@@ -12,6 +12,14 @@
 #include "../../sha512/sha512.h"
 #include "test_extras.h"
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#if defined(__LINUX__)
+    #include <unistd.h>
+    #include <sys/wait.h>
+    #include <poll.h>
+    #include <ucontext.h>
+#endif
 
 
 // Benchmark and test parameters  
@@ -22,6 +30,13 @@
     #define BENCH_LOOPS       10000
     #define TEST_LOOPS        1000
 #endif
+#define BATCH_SIZE            64        // Number of signatures per batch
+#define STREAM_MESSAGE_SIZE   1000      // Maximum message size for streaming tests
+#define KEX_BATCH_SIZE        7         // Number of secret agreements per batch (not a multiple of 4 to exercise partial groups)
+#define KEX_MANY_SIZE         37        // Number of public keys per agreement with a single secret key (not a multiple of 16 to exercise partial groups)
+#define KEYGEN_BATCH_SIZE     37        // Number of keypairs per batch (not a multiple of 16 to exercise partial groups)
+#define PARALLEL_BATCH_SIZE   37        // Number of items per multithreaded batch (not a multiple of the chunk size)
+#define ASYNC_JOBS            64        // Number of asynchronous jobs per test
 
 
 ECCRYPTO_STATUS SchnorrQ_test()
@@ -29,7 +44,9 @@ ECCRYPTO_STATUS SchnorrQ_test()
     int n, passed;       
     void *msg = NULL; 
     unsigned int len, valid = false;
-    unsigned char SecretKey[32], PublicKey[32], Signature[64];
+    unsigned char SecretKey[32], PublicKey[32], Signature[64], Signature2[64];
+    SchnorrQ_PreparedPublicKey PreparedKey;
+    SchnorrQ_ExpandedSecretKey ExpandedKey;
     ECCRYPTO_STATUS Status = ECCRYPTO_SUCCESS;
 
     printf("\n--------------------------------------------------------------------------------------------------------\n\n"); 
@@ -62,6 +79,35 @@ ECCRYPTO_STATUS SchnorrQ_test()
             break;
         }
 
+        // Signature computation using an expanded secret key (signatures are deterministic)
+        Status = SchnorrQ_ExpandSecretKey(SecretKey, &ExpandedKey);
+        if (Status != ECCRYPTO_SUCCESS) {
+            return Status;
+        }    
+        Status = SchnorrQ_SignExpanded(&ExpandedKey, msg, len, Signature2);
+        if (Status != ECCRYPTO_SUCCESS) {
+            return Status;
+        }    
+        if (memcmp(ExpandedKey.PublicKey, PublicKey, 32) != 0 || memcmp(Signature, Signature2, 64) != 0) {
+            passed = 0;
+            break;
+        }
+        SchnorrQ_DestroyExpandedSecretKey(&ExpandedKey);
+
+        // Valid signature test using a prepared public key
+        Status = SchnorrQ_PreparePublicKey(PublicKey, &PreparedKey);
+        if (Status != ECCRYPTO_SUCCESS) {
+            return Status;
+        }    
+        Status = SchnorrQ_VerifyPrepared(&PreparedKey, msg, len, Signature, &valid);
+        if (Status != ECCRYPTO_SUCCESS) {
+            return Status;
+        }    
+        if (valid == false) {
+            passed = 0;
+            break;
+        }
+
         // Invalid signature test (flipping one bit of the message)
         msg = "b";  
         Status = SchnorrQ_Verify(PublicKey, msg, len, Signature, &valid);
@@ -72,6 +118,14 @@ ECCRYPTO_STATUS SchnorrQ_test()
             passed = 0;
             break;
         }
+        Status = SchnorrQ_VerifyPrepared(&PreparedKey, msg, len, Signature, &valid);
+        if (Status != ECCRYPTO_SUCCESS) {
+            return Status;
+        }    
+        if (valid == true) {
+            passed = 0;
+            break;
+        }
     } 
     if (passed==1) printf("  Signature tests.................................................................. PASSED");
     else { printf("  Signature tests... FAILED"); printf("\n"); Status = ECCRYPTO_ERROR_SIGNATURE_VERIFICATION; }
@@ -88,6 +142,8 @@ ECCRYPTO_STATUS SchnorrQ_run()
     void *msg = NULL;
     unsigned int len = 0, valid = false;
     unsigned char SecretKey[32], PublicKey[32], Signature[64];
+    SchnorrQ_PreparedPublicKey PreparedKey;
+    SchnorrQ_ExpandedSecretKey ExpandedKey;
     ECCRYPTO_STATUS Status = ECCRYPTO_SUCCESS;
 
     printf("\n--------------------------------------------------------------------------------------------------------\n\n"); 
@@ -121,6 +177,25 @@ ECCRYPTO_STATUS SchnorrQ_run()
     printf("  SchnorrQ's signing runs in ...................................................... %8lld ", cycles/BENCH_LOOPS); print_unit;
     printf("\n");
     
+    Status = SchnorrQ_ExpandSecretKey(SecretKey, &ExpandedKey);
+    if (Status != ECCRYPTO_SUCCESS) {
+        return Status;
+    }    
+    cycles = 0;
+    for (n = 0; n < BENCH_LOOPS; n++)
+    {
+        cycles1 = cpucycles(); 
+        Status = SchnorrQ_SignExpanded(&ExpandedKey, msg, len, Signature);
+        if (Status != ECCRYPTO_SUCCESS) {
+            return Status;
+        }    
+        cycles2 = cpucycles();
+        cycles = cycles+(cycles2-cycles1);
+    }
+    SchnorrQ_DestroyExpandedSecretKey(&ExpandedKey);
+    printf("  SchnorrQ's signing with an expanded secret key runs in .......................... %8lld ", cycles/BENCH_LOOPS); print_unit;
+    printf("\n");
+    
     cycles = 0;
     for (n = 0; n < BENCH_LOOPS; n++)
     {
@@ -135,199 +210,1503 @@ ECCRYPTO_STATUS SchnorrQ_run()
     printf("  SchnorrQ's verification runs in ................................................. %8lld ", cycles/BENCH_LOOPS); print_unit;
     printf("\n");
     
+    Status = SchnorrQ_PreparePublicKey(PublicKey, &PreparedKey);
+    if (Status != ECCRYPTO_SUCCESS) {
+        return Status;
+    }    
+    cycles = 0;
+    for (n = 0; n < BENCH_LOOPS; n++)
+    {
+        cycles1 = cpucycles(); 
+        Status = SchnorrQ_VerifyPrepared(&PreparedKey, msg, len, Signature, &valid);
+        if (Status != ECCRYPTO_SUCCESS) {
+            return Status;
+        }    
+        cycles2 = cpucycles();
+        cycles = cycles+(cycles2-cycles1);
+    }
+    printf("  SchnorrQ's verification with a prepared public key runs in ...................... %8lld ", cycles/BENCH_LOOPS); print_unit;
+    printf("\n");
+    
     return Status;
 }
 
 
-ECCRYPTO_STATUS compressedkex_test()
-{ // Test ECDH key exchange based on FourQ
-    int n, passed;
-    unsigned int i;
-    unsigned char SecretKeyA[32], PublicKeyA[32], SecretAgreementA[32];
-    unsigned char SecretKeyB[32], PublicKeyB[32], SecretAgreementB[32];
+ECCRYPTO_STATUS SchnorrQ_stream_test()
+{ // Test incremental hashing and streaming SchnorrQ signature verification
+    int n, passed;       
+    unsigned int valid = false;
+    unsigned long long i, len, chunk;
+    unsigned char SecretKey[32], Signature[64], Message[STREAM_MESSAGE_SIZE], h1[64], h2[64];
+    SchnorrQ_ExpandedSecretKey ExpandedKey;
+    SchnorrQ_VerifyContext ctx;
+    crypto_sha512_ctx hash_ctx;
     ECCRYPTO_STATUS Status = ECCRYPTO_SUCCESS;
 
-    printf("\n--------------------------------------------------------------------------------------------------------\n\n");
-    printf("Testing DH key exchange using compressed, 32-byte public keys: \n\n");
+    printf("\n--------------------------------------------------------------------------------------------------------\n\n"); 
+    printf("Testing streaming verification of SchnorrQ signatures: \n\n"); 
 
     passed = 1;
-    for (n = 0; n < TEST_LOOPS; n++)
-    {
-        // Alice's keypair generation
-        Status = CompressedKeyGeneration(SecretKeyA, PublicKeyA);
+    for (n = 0; n < TEST_LOOPS/10 && passed == 1; n++)
+    {    
+        RandomBytesFunction(Message, STREAM_MESSAGE_SIZE);
+        len = (unsigned long long)(n*97) % (STREAM_MESSAGE_SIZE+1);   // Message lengths crossing several block boundaries
+        chunk = 1 + (n % 131);                                      // Chunk sizes not aligned to the block length
+
+        // Incremental hashing test
+        crypto_sha512(Message, len, h1);
+        crypto_sha512_init(&hash_ctx);
+        for (i = 0; i < len; i += chunk) {
+            crypto_sha512_update(&hash_ctx, Message+i, (len-i < chunk)? len-i : chunk);
+        }
+        crypto_sha512_final(&hash_ctx, h2);
+        if (memcmp(h1, h2, 64) != 0) {
+            passed = 0;
+            break;
+        }
+
+        // Signature computation
+        RandomBytesFunction(SecretKey, 32);
+        Status = SchnorrQ_ExpandSecretKey(SecretKey, &ExpandedKey);
         if (Status != ECCRYPTO_SUCCESS) {
             return Status;
-        }
-        // Bob's keypair generation
-        Status = CompressedKeyGeneration(SecretKeyB, PublicKeyB);
+        }    
+        Status = SchnorrQ_SignExpanded(&ExpandedKey, Message, len, Signature);
         if (Status != ECCRYPTO_SUCCESS) {
             return Status;
         }
 
-        // Alice's shared secret computation
-        Status = CompressedSecretAgreement(SecretKeyA, PublicKeyB, SecretAgreementA);
-        if (Status != ECCRYPTO_SUCCESS) {
-            return Status;
+        // Valid signature test
+        Status = SchnorrQ_VerifyInit(&ctx, ExpandedKey.PublicKey, Signature);
+        for (i = 0; i < len && Status == ECCRYPTO_SUCCESS; i += chunk) {
+            Status = SchnorrQ_VerifyUpdate(&ctx, Message+i, (len-i < chunk)? len-i : chunk);
+        }
+        if (Status == ECCRYPTO_SUCCESS) {
+            Status = SchnorrQ_VerifyFinal(&ctx, &valid);
         }
-        // Bob's shared secret computation
-        Status = CompressedSecretAgreement(SecretKeyB, PublicKeyA, SecretAgreementB);
         if (Status != ECCRYPTO_SUCCESS) {
             return Status;
+        }    
+        if (valid == false) {
+            passed = 0;
+            break;
         }
 
-        for (i = 0; i < 32; i++) {
-            if (SecretAgreementA[i] != SecretAgreementB[i]) {
-                passed = 0;
-                break;
-            }
+        // Invalid signature test (flipping one bit of the message)
+        Message[len/2] ^= (len > 0)? 1 : 0;
+        Signature[0] ^= (len > 0)? 0 : 1;
+        Status = SchnorrQ_VerifyInit(&ctx, ExpandedKey.PublicKey, Signature);
+        if (Status == ECCRYPTO_SUCCESS) {
+            Status = SchnorrQ_VerifyUpdate(&ctx, Message, len);
         }
-    }
-    if (passed==1) printf("  DH key exchange tests............................................................ PASSED");
-    else { printf("  DH key exchange tests... FAILED"); printf("\n"); Status = ECCRYPTO_ERROR_SHARED_KEY; }
+        if (Status == ECCRYPTO_SUCCESS) {
+            Status = SchnorrQ_VerifyFinal(&ctx, &valid);
+        }
+        if (Status != ECCRYPTO_SUCCESS && Status != ECCRYPTO_ERROR_INVALID_PARAMETER) {
+            return Status;
+        }    
+        Status = ECCRYPTO_SUCCESS;
+        if (valid == true) {
+            passed = 0;
+            break;
+        }
+        SchnorrQ_DestroyExpandedSecretKey(&ExpandedKey);
+    } 
+    if (passed==1) printf("  Streaming verification tests..................................................... PASSED");
+    else { printf("  Streaming verification tests... FAILED"); printf("\n"); Status = ECCRYPTO_ERROR_SIGNATURE_VERIFICATION; }
     printf("\n");
-
+    
     return Status;
 }
 
 
-ECCRYPTO_STATUS compressedkex_run()
-{ // Benchmark ECDH key exchange based on FourQ 
-    int n;
-    unsigned long long cycles, cycles1, cycles2;
-    unsigned char SecretKeyA[32], PublicKeyA[32], SecretAgreementA[32];
-    unsigned char SecretKeyB[32], PublicKeyB[32];
+ECCRYPTO_STATUS SchnorrQph_test()
+{ // Test the pre-hashed SchnorrQ variant SchnorrQph against known-answer vectors
+  // Secret key: 0x00, 0x01, ..., 0x1F. Messages: "" (empty), "abc", and the 1000 bytes (i mod 256), for i = 0, ..., 999
+    int n, passed;       
+    unsigned int i, valid = false, len[3] = {0, 3, 1000};
+    unsigned char SecretKey[32], PublicKey[32], Signature[64], Digest[64], Message[3][1000];
+    SchnorrQ_ExpandedSecretKey ExpandedKey;
+    crypto_sha512_ctx ctx;
     ECCRYPTO_STATUS Status = ECCRYPTO_SUCCESS;
+    static const unsigned char PublicKey_KAT[32] = {
+        0x62, 0x62, 0x4D, 0xC8, 0xD4, 0x7B, 0x18, 0x46, 0x64, 0xFA, 0x8B, 0x13, 0xA5, 0x4F, 0x2E, 0x2D,
+        0x58, 0x19, 0x4C, 0x57, 0x7D, 0x1C, 0x0D, 0x59, 0xD2, 0xFA, 0x61, 0x1A, 0x2B, 0x2E, 0x59, 0x5A };
+    static const unsigned char Signature_KAT[3][64] = {
+      { 0x28, 0x4A, 0x92, 0xFE, 0x27, 0x82, 0xF2, 0xA1, 0x0D, 0x43, 0x4F, 0x75, 0x45, 0xD8, 0xA5, 0x4D,
+        0x2A, 0xFD, 0x1E, 0x9E, 0x37, 0x5E, 0xB8, 0xF1, 0x71, 0xA7, 0x9D, 0x76, 0x05, 0x23, 0xE3, 0x37,
+        0x4A, 0xB5, 0x8F, 0xED, 0x87, 0xBB, 0x91, 0x18, 0xA9, 0x4E, 0x02, 0xE3, 0x4E, 0x8D, 0xCD, 0x7B,
+        0xC5, 0x65, 0xF9, 0xD4, 0x25, 0x1A, 0x05, 0x23, 0x09, 0x1C, 0x10, 0x95, 0x92, 0x90, 0x06, 0x00 },
+      { 0x2B, 0x03, 0x77, 0x31, 0x9F, 0x27, 0x94, 0x7E, 0xA9, 0x40, 0xD2, 0x4F, 0xEB, 0x1A, 0xE8, 0x66,
+        0x03, 0xFD, 0x74, 0x14, 0x4F, 0x84, 0xE4, 0xF0, 0xBC, 0x20, 0x08, 0x2C, 0x7D, 0x5A, 0x83, 0x8E,
+        0x5A, 0xE7, 0xDF, 0x06, 0x12, 0xCF, 0x31, 0xAE, 0x70, 0xCF, 0xB4, 0x7A, 0x26, 0x91, 0x0E, 0xCD,
+        0xDC, 0x32, 0xBD, 0xC2, 0xAE, 0xAA, 0x68, 0x18, 0x4F, 0xC9, 0xD8, 0x4E, 0xA8, 0x31, 0x25, 0x00 },
+      { 0xD2, 0xAB, 0x24, 0xA3, 0x17, 0xEC, 0x3A, 0xD8, 0x59, 0x53, 0xFA, 0x10, 0x73, 0x6A, 0xAD, 0x1F,
+        0x25, 0x28, 0xCF, 0xDB, 0x8F, 0xFF, 0x98, 0x2F, 0x7E, 0xC6, 0x73, 0x6C, 0x96, 0x10, 0x9A, 0x73,
+        0x86, 0x41, 0xBA, 0x8A, 0x4E, 0x69, 0x59, 0xA9, 0x2A, 0x4C, 0x69, 0xFD, 0x5A, 0xB2, 0x95, 0xA7,
+        0x9D, 0xBA, 0xB6, 0xF2, 0xC0, 0xAC, 0x17, 0x9E, 0x1E, 0x59, 0xAA, 0x44, 0x67, 0x23, 0x0E, 0x00 } };
 
-    printf("\n--------------------------------------------------------------------------------------------------------\n\n");
-    printf("Benchmarking DH key exchange using compressed, 32-byte public keys: \n\n");
+    printf("\n--------------------------------------------------------------------------------------------------------\n\n"); 
+    printf("Testing the pre-hashed SchnorrQ variant SchnorrQph: \n\n"); 
 
-    cycles = 0;
-    for (n = 0; n < BENCH_LOOPS; n++)
-    {
-        cycles1 = cpucycles();
-        Status = CompressedKeyGeneration(SecretKeyA, PublicKeyA);
+    for (i = 0; i < 32; i++) {
+        SecretKey[i] = (unsigned char)i;
+    }
+    for (i = 0; i < 1000; i++) {
+        Message[2][i] = (unsigned char)i;
+    }
+    memmove(Message[1], "abc", 3);
+
+    Status = SchnorrQ_KeyGeneration(SecretKey, PublicKey);
+    if (Status != ECCRYPTO_SUCCESS) {
+        return Status;
+    }  
+    Status = SchnorrQ_ExpandSecretKey(SecretKey, &ExpandedKey);
+    if (Status != ECCRYPTO_SUCCESS) {
+        return Status;
+    }  
+
+    passed = (memcmp(PublicKey, PublicKey_KAT, 32) == 0);
+    for (n = 0; n < 3 && passed == 1; n++)
+    {    
+        // Known-answer test
+        Status = SchnorrQph_Sign(SecretKey, PublicKey, Message[n], len[n], Signature);
         if (Status != ECCRYPTO_SUCCESS) {
             return Status;
         }
-        cycles2 = cpucycles();
-        cycles = cycles + (cycles2 - cycles1);
-    }
-    printf("  Keypair generation runs in ...................................................... %8lld ", cycles/BENCH_LOOPS); print_unit;
-    printf("\n");
-    
-    Status = CompressedKeyGeneration(SecretKeyB, PublicKeyB);
-    cycles = 0;
-    for (n = 0; n < BENCH_LOOPS; n++)
-    {
-        cycles1 = cpucycles();
-        Status = CompressedSecretAgreement(SecretKeyA, PublicKeyB, SecretAgreementA);
+        if (memcmp(Signature, Signature_KAT[n], 64) != 0) {
+            passed = 0;
+            break;
+        }
+
+        // Signing and verification from a digest computed incrementally
+        crypto_sha512_init(&ctx);
+        for (i = 0; i < len[n]; i += 7) {
+            crypto_sha512_update(&ctx, Message[n]+i, (len[n]-i < 7)? len[n]-i : 7);
+        }
+        crypto_sha512_final(&ctx, Digest);
+        Status = SchnorrQph_SignDigest(&ExpandedKey, Digest, Signature);
         if (Status != ECCRYPTO_SUCCESS) {
             return Status;
         }
-        cycles2 = cpucycles();
-        cycles = cycles + (cycles2 - cycles1);
-    }
-    printf("  Secret agreement runs in ........................................................ %8lld ", cycles/BENCH_LOOPS); print_unit;
-    printf("\n");
+        if (memcmp(Signature, Signature_KAT[n], 64) != 0) {
+            passed = 0;
+            break;
+        }
+        Status = SchnorrQph_VerifyDigest(PublicKey, Digest, Signature, &valid);
+        if (Status != ECCRYPTO_SUCCESS) {
+            return Status;
+        }    
+        if (valid == false) {
+            passed = 0;
+            break;
+        }
+        Status = SchnorrQph_Verify(PublicKey, Message[n], len[n], Signature, &valid);
+        if (Status != ECCRYPTO_SUCCESS) {
+            return Status;
+        }    
+        if (valid == false) {
+            passed = 0;
+            break;
+        }
+
+        // Domain separation test (a SchnorrQph signature is not a SchnorrQ signature of the message or of its digest)
+        Status = SchnorrQ_Verify(PublicKey, Message[n], len[n], Signature, &valid);
+        if (Status != ECCRYPTO_SUCCESS) {
+            return Status;
+        }    
+        if (valid == true) {
+            passed = 0;
+            break;
+        }
+        Status = SchnorrQ_Verify(PublicKey, Digest, 64, Signature, &valid);
+        if (Status != ECCRYPTO_SUCCESS) {
+            return Status;
+        }    
+        if (valid == true) {
+            passed = 0;
+            break;
+        }
+
+        // Invalid signature test (flipping one bit of the digest)
+        Digest[0] ^= 1;
+        Status = SchnorrQph_VerifyDigest(PublicKey, Digest, Signature, &valid);
+        if (Status != ECCRYPTO_SUCCESS) {
+            return Status;
+        }    
+        if (valid == true) {
+            passed = 0;
+            break;
+        }
+    } 
+    SchnorrQ_DestroyExpandedSecretKey(&ExpandedKey);
 
+    if (passed==1) printf("  SchnorrQph tests................................................................. PASSED");
+    else { printf("  SchnorrQph tests... FAILED"); printf("\n"); Status = ECCRYPTO_ERROR_SIGNATURE_VERIFICATION; }
+    printf("\n");
+    
     return Status;
 }
 
 
-ECCRYPTO_STATUS kex_test()
-{ // Test ECDH key exchange based on FourQ
+ECCRYPTO_STATUS hash_test()
+{ // Test single-buffer and multi-buffer hashing
     int n, passed;
-    unsigned int i;
-    unsigned char SecretKeyA[32], PublicKeyA[64], SecretAgreementA[32];
-    unsigned char SecretKeyB[32], PublicKeyB[64], SecretAgreementB[32];
+    unsigned int i, l;
+    const char* kat_msg[2] = {"abc", "abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmnhijklmnoijklmnopjklmnopqklmnopqrlmnopqrsmnopqrstnopqrstu"};
+    const char* kat_hash[3] = {"ddaf35a193617abacc417349ae20413112e6fa4e89a97ea20a9eeee64b55d39a2192992a274fc1a836ba3c23a3feebbd454d4423643ce80e2a9ac94fa54ca49f",
+                               "8e959b75dae313da8cf4f72814fc143f8f7779c6eb9f7fa17299aeadb6889018501d289e4900f7e4331b99dec4b5433ac7d329eeb6dd26545e96e55b874be909",
+                               "5096498d96f50f9a137c4db5b8b0cd38383ad55350fb5a98805fedc31fa1262f1f0cf4d6f12d7ecd8dedd933a4c9126344fe22e937a8ad35fdeae1e876ae698b"};
+    char hex[129];
+    unsigned long long len[4], chunk[4], offset[4];
+    unsigned char Message[4][STREAM_MESSAGE_SIZE], Digest[64], h[4][64], *out[4] = {h[0], h[1], h[2], h[3]};
+    const unsigned char *in[4];
+    crypto_sha512_ctx ctx[4];
     ECCRYPTO_STATUS Status = ECCRYPTO_SUCCESS;
 
     printf("\n--------------------------------------------------------------------------------------------------------\n\n");
-    printf("Testing DH key exchange using uncompressed, 64-byte public keys: \n\n");
+    printf("Testing hashing: \n\n");
 
     passed = 1;
-    for (n = 0; n < TEST_LOOPS; n++)
+    for (n = 0; n < 3; n++)                                          // Known answers: two FIPS 180-2 messages and a 1000-byte message
     {
-        // Alice's keypair generation
-        Status = KeyGeneration(SecretKeyA, PublicKeyA);
-        if (Status != ECCRYPTO_SUCCESS) {
-            return Status;
-        }
-        // Bob's keypair generation
-        Status = KeyGeneration(SecretKeyB, PublicKeyB);
-        if (Status != ECCRYPTO_SUCCESS) {
-            return Status;
+        if (n < 2) {
+            crypto_sha512((const unsigned char*)kat_msg[n], strlen(kat_msg[n]), Digest);
+        } else {
+            for (i = 0; i < 1000; i++) Message[0][i] = (unsigned char)(i % 251);
+            crypto_sha512(Message[0], 1000, Digest);
         }
+        for (i = 0; i < 64; i++) sprintf(hex + 2*i, "%02x", Digest[i]);
+        if (strcmp(hex, kat_hash[n]) != 0) passed = 0;
+    }
 
-        // Alice's shared secret computation
-        Status = SecretAgreement(SecretKeyA, PublicKeyB, SecretAgreementA);
-        if (Status != ECCRYPTO_SUCCESS) {
-            return Status;
+    for (n = 0; n < TEST_LOOPS/10 && passed == 1; n++)
+    {
+        for (l = 0; l < 4; l++) {                                    // Ragged message lengths, some of them equal
+            RandomBytesFunction(Message[l], STREAM_MESSAGE_SIZE);
+            len[l] = (unsigned long long)((n+1)*(l == 3? 1 : 37*l+11)) % (STREAM_MESSAGE_SIZE+1);
+            in[l] = Message[l];
         }
-        // Bob's shared secret computation
-        Status = SecretAgreement(SecretKeyB, PublicKeyA, SecretAgreementB);
-        if (Status != ECCRYPTO_SUCCESS) {
-            return Status;
+
+        // One-shot hashing test
+        crypto_sha512_x4(in, len, out);
+        for (l = 0; l < 4; l++) {
+            crypto_sha512(Message[l], len[l], Digest);
+            if (memcmp(h[l], Digest, 64) != 0) passed = 0;
         }
 
-        for (i = 0; i < 32; i++) {
-            if (SecretAgreementA[i] != SecretAgreementB[i]) {
-                passed = 0;
-                break;
+        // Incremental hashing test, with chunk sizes not aligned to the block length
+        for (l = 0; l < 4; l++) {
+            crypto_sha512_init(&ctx[l]);
+            chunk[l] = 1 + (n*(l+3)) % 201;
+            offset[l] = 0;
+        }
+        for (i = 0; i < STREAM_MESSAGE_SIZE; i++) {
+            unsigned long long size[4];
+            for (l = 0; l < 4; l++) {
+                size[l] = (len[l]-offset[l] < chunk[l])? len[l]-offset[l] : chunk[l];
+                in[l] = Message[l] + offset[l];
+                offset[l] += size[l];
             }
+            crypto_sha512_update_x4(ctx, in, size);
+        }
+        crypto_sha512_final_x4(ctx, out);
+        for (l = 0; l < 4; l++) {
+            crypto_sha512(Message[l], len[l], Digest);
+            if (memcmp(h[l], Digest, 64) != 0) passed = 0;
         }
     }
-    if (passed==1) printf("  DH key exchange tests............................................................ PASSED");
-    else { printf("  DH key exchange tests... FAILED"); printf("\n"); Status = ECCRYPTO_ERROR_SHARED_KEY; }
+    if (passed==1) printf("  Hashing tests..................................................................... PASSED");
+    else { printf("  Hashing tests... FAILED"); printf("\n"); Status = ECCRYPTO_ERROR; }
     printf("\n");
 
     return Status;
 }
 
 
-ECCRYPTO_STATUS kex_run()
-{ // Benchmark ECDH key exchange based on FourQ 
+ECCRYPTO_STATUS hash_run()
+{ // Benchmark single-buffer and multi-buffer hashing
     int n;
-    unsigned long long cycles, cycles1, cycles2;
-    unsigned char SecretKeyA[32], PublicKeyA[64], SecretAgreementA[32];
-    unsigned char SecretKeyB[32], PublicKeyB[64];
-    ECCRYPTO_STATUS Status = ECCRYPTO_SUCCESS;
+    unsigned int l;
+    unsigned long long cycles, cycles1, cycles2, len[4] = {96, 96, 96, 96};
+    unsigned char Message[4][96], LongMessage[16384], h[4][64], *out[4] = {h[0], h[1], h[2], h[3]};
+    const unsigned char *in[4] = {Message[0], Message[1], Message[2], Message[3]};
 
     printf("\n--------------------------------------------------------------------------------------------------------\n\n");
-    printf("Benchmarking DH key exchange using uncompressed, 64-byte public keys: \n\n");
+    printf("Benchmarking hashing: \n\n");
+
+    for (l = 0; l < 4; l++) {
+        RandomBytesFunction(Message[l], 96);
+    }
+    RandomBytesFunction(LongMessage, sizeof(LongMessage));
 
     cycles = 0;
-    for (n = 0; n < BENCH_LOOPS; n++)
+    for (n = 0; n < BENCH_LOOPS/10; n++)
     {
         cycles1 = cpucycles();
-        Status = KeyGeneration(SecretKeyA, PublicKeyA);
-        if (Status != ECCRYPTO_SUCCESS) {
-            return Status;
-        }
+        crypto_sha512(LongMessage, sizeof(LongMessage), h[0]);
         cycles2 = cpucycles();
         cycles = cycles + (cycles2 - cycles1);
     }
-    printf("  Keypair generation runs in ...................................................... %8lld ", cycles/BENCH_LOOPS); print_unit;
+    printf("  Hashing of a 16KB message runs in .............................................. %8lld ", cycles/(BENCH_LOOPS/10)); print_unit;
     printf("\n");
 
-    Status = KeyGeneration(SecretKeyB, PublicKeyB);
     cycles = 0;
     for (n = 0; n < BENCH_LOOPS; n++)
     {
         cycles1 = cpucycles();
-        Status = SecretAgreement(SecretKeyA, PublicKeyB, SecretAgreementA);
-        if (Status != ECCRYPTO_SUCCESS) {
-            return Status;
+        for (l = 0; l < 4; l++) {
+            crypto_sha512(Message[l], 96, h[l]);
         }
         cycles2 = cpucycles();
         cycles = cycles + (cycles2 - cycles1);
     }
-    printf("  Secret agreement runs in ........................................................ %8lld ", cycles/BENCH_LOOPS); print_unit;
+    printf("  Hashing of 4 96-byte messages, one at a time, runs in .......................... %8lld ", cycles/BENCH_LOOPS); print_unit;
     printf("\n");
 
-    return Status;
+    cycles = 0;
+    for (n = 0; n < BENCH_LOOPS; n++)
+    {
+        cycles1 = cpucycles();
+        crypto_sha512_x4(in, len, out);
+        cycles2 = cpucycles();
+        cycles = cycles + (cycles2 - cycles1);
+    }
+    printf("  Hashing of 4 96-byte messages, in parallel, runs in ............................ %8lld ", cycles/BENCH_LOOPS); print_unit;
+    printf("\n");
+
+    return ECCRYPTO_SUCCESS;
+}
+
+
+static ECCRYPTO_STATUS verify_batch(const unsigned char** pk, const unsigned char** msg, const unsigned int* len, const unsigned char** sig, unsigned int* valid)
+{ // Batch verification of BATCH_SIZE signatures with SchnorrQ_VerifyBatchWorkspace(), using a workspace at an odd address. A workspace that is 
+  // one byte too small must be rejected. Outside of FOURQ_NO_MALLOC builds, the outputs of SchnorrQ_VerifyBatch() must be the same
+    size_t size = SchnorrQ_VerifyBatchWorkspaceSize(BATCH_SIZE);
+    unsigned char* workspace = (unsigned char*)malloc(size + 1);
+    unsigned int i, valid2[BATCH_SIZE];
+    ECCRYPTO_STATUS Status;
+
+    if (workspace == NULL) {
+        return ECCRYPTO_ERROR_NO_MEMORY;
+    }
+    Status = SchnorrQ_VerifyBatchWorkspace(pk, msg, len, sig, BATCH_SIZE, valid, workspace+1, size);
+    if (Status == ECCRYPTO_SUCCESS && SchnorrQ_VerifyBatchWorkspace(pk, msg, len, sig, BATCH_SIZE, valid2, workspace+1, size-1) != ECCRYPTO_ERROR_INVALID_PARAMETER) {
+        Status = ECCRYPTO_ERROR;
+    }
+#if !defined(FOURQ_NO_MALLOC)
+    if (Status == ECCRYPTO_SUCCESS) {
+        Status = SchnorrQ_VerifyBatch(pk, msg, len, sig, BATCH_SIZE, valid2);
+        for (i = 0; i < BATCH_SIZE && Status == ECCRYPTO_SUCCESS; i++) {
+            if (valid[i] != valid2[i]) {
+                Status = ECCRYPTO_ERROR;
+            }
+        }
+    }
+#else
+    (void)i;
+#endif
+    free(workspace);
+
+    return Status;
+}
+
+
+static ECCRYPTO_STATUS sign_with_nonce(const unsigned char* SecretKey, const unsigned char* Message, const unsigned int SizeMessage, const digit_t* r, unsigned char* Signature)
+{ // Complete the signature (R,s) of Message for the encoded R stored in Signature, with s = r - h*a mod order and h = H(R||A||Message). 
+  // r is the nonce, with R = r*G up to the encoding of R or a component of small order, so the signature must be rejected only because of them
+    SchnorrQ_ExpandedSecretKey ExpandedKey;
+    CryptoHashContext ctx;
+    unsigned char h[64];
+    digit_t *H = (digit_t*)h, *S = (digit_t*)(Signature+32);
+    ECCRYPTO_STATUS Status;
+
+    Status = SchnorrQ_ExpandSecretKey(SecretKey, &ExpandedKey);
+    if (Status != ECCRYPTO_SUCCESS) {
+        return Status;
+    }
+    if (CryptoHashInit(&ctx) != 0 || CryptoHashUpdate(&ctx, Signature, 32) != 0 || CryptoHashUpdate(&ctx, ExpandedKey.PublicKey, 32) != 0 ||
+        CryptoHashUpdate(&ctx, Message, SizeMessage) != 0 || CryptoHashFinal(&ctx, h) != 0) {
+        Status = ECCRYPTO_ERROR;
+    } else {                                              // s = r - h*a mod order
+        modulo_order(H, H);
+        to_Montgomery(H, H);
+        Montgomery_multiply_mod_order(ExpandedKey.s, H, S);
+        from_Montgomery(S, S);
+        subtract_mod_order(r, S, S);
+    }
+    SchnorrQ_DestroyExpandedSecretKey(&ExpandedKey);
+
+    return Status;
+}
+
+
+static ECCRYPTO_STATUS sign_noncanonical(const unsigned char* SecretKey, const unsigned char* Message, const unsigned int SizeMessage, const unsigned int Type, unsigned char* Signature)
+{ // Signature (R,s) of Message with s*G + h*A = R as points for h = H(R||A||Message), which SchnorrQ_Verify() rejects because of the encoding of R 
+  // or because R has a component of order 2:
+  //   Type 0: R is the neutral point (0,1) encoded with the non-canonical y1 = 2^127-1 instead of 0, and nonce 0,
+  //   Type 1: R is the neutral point (0,1) encoded with the sign bit of x set, and nonce 0,
+  //   Type 2: R = r*G + (0,-1) = (-x,-y), where (x,y) = r*G for a random nonce r.
+    digit_t r[NWORDS_ORDER] = {0};
+    uint64_t Rxy[8], *y = Rxy+4, x0, x1;
+    unsigned int i;
+    ECCRYPTO_STATUS Status;
+
+    memset(Signature, 0, 64);
+    if (Type == 0) {
+        Signature[0] = 1;                                 // y0 = 1
+        memset(Signature+16, 0xFF, 15);                   // y1 = 2^127-1, and the sign of x is 0
+        Signature[31] = 0x7F;
+    } else if (Type == 1) {
+        Signature[0] = 1;                                 // y = (1,0), and the sign of x is 1
+        Signature[31] = 0x80;
+    } else {
+        Status = RandomBytesFunction((unsigned char*)r, 32);
+        if (Status != ECCRYPTO_SUCCESS) {
+            return Status;
+        }
+        modulo_order(r, r);
+        Status = PublicKeyGeneration((unsigned char*)r, (unsigned char*)Rxy);   // (x,y) = r*G
+        if (Status != ECCRYPTO_SUCCESS) {
+            return Status;
+        }
+        for (i = 0; i < 4; i += 2) {                      // Negate each 127-bit component v of x and y, v -> 2^127-1-v for v != 0
+            if ((Rxy[i] | Rxy[i+1]) != 0) {
+                Rxy[i] = ~Rxy[i]; Rxy[i+1] = ~Rxy[i+1] & 0x7FFFFFFFFFFFFFFFULL;
+            }
+            if ((y[i] | y[i+1]) != 0) {
+                y[i] = ~y[i]; y[i+1] = ~y[i+1] & 0x7FFFFFFFFFFFFFFFULL;
+            }
+        }
+        x0 = Rxy[1]; x1 = Rxy[3];
+        memmove(Signature, y, 32);
+        Signature[31] |= (unsigned char)(((((Rxy[0] | Rxy[1]) != 0)? x0 : x1) >> 62) << 7);   // Sign of -x, see encode()
+    }
+
+    return sign_with_nonce(SecretKey, Message, SizeMessage, r, Signature);
+}
+
+
+ECCRYPTO_STATUS SchnorrQ_batch_test()
+{ // Test batch verification of SchnorrQ signatures
+    int n, passed;
+    unsigned int i, j, len[BATCH_SIZE], valid[BATCH_SIZE], valid1;
+    unsigned char SecretKey[32], PublicKey[BATCH_SIZE][32], Signature[BATCH_SIZE][64], Message[BATCH_SIZE][32];
+    const unsigned char *pk[BATCH_SIZE], *sig[BATCH_SIZE], *msg[BATCH_SIZE];
+    ECCRYPTO_STATUS Status = ECCRYPTO_SUCCESS;
+
+    printf("\n--------------------------------------------------------------------------------------------------------\n\n"); 
+    printf("Testing batch verification of SchnorrQ signatures: \n\n"); 
+
+    passed = 1;
+    for (n = 0; n < TEST_LOOPS/BATCH_SIZE+1; n++)
+    {
+        for (i = 0; i < BATCH_SIZE; i++) {
+            Status = SchnorrQ_FullKeyGeneration(SecretKey, PublicKey[i]);
+            if (Status != ECCRYPTO_SUCCESS) {
+                return Status;
+            }
+            RandomBytesFunction(Message[i], 32);
+            len[i] = i % 33;
+            Status = SchnorrQ_Sign(SecretKey, PublicKey[i], Message[i], len[i], Signature[i]);
+            if (Status != ECCRYPTO_SUCCESS) {
+                return Status;
+            }
+            pk[i] = PublicKey[i]; sig[i] = Signature[i]; msg[i] = Message[i];
+        }
+
+        // Valid batch test
+        Status = verify_batch(pk, msg, len, sig, valid);
+        if (Status != ECCRYPTO_SUCCESS) {
+            return Status;
+        }
+        for (i = 0; i < BATCH_SIZE; i++) {
+            if (valid[i] == false) { passed = 0; break; }
+        }
+
+        // Invalid batch test (flipping one bit of one message, and one bit of the encoded R of another signature)
+        j = (unsigned int)n % BATCH_SIZE;
+        Message[j][0] ^= 1;
+        Signature[(j+1) % BATCH_SIZE][0] ^= 1;
+        Status = verify_batch(pk, msg, len, sig, valid);
+        if (Status != ECCRYPTO_SUCCESS) {
+            return Status;
+        }
+        for (i = 0; i < BATCH_SIZE; i++) {
+            if ((valid[i] == true) == ((i == j && len[i] != 0) || i == (j+1) % BATCH_SIZE)) { passed = 0; break; }
+        }
+        if (passed == 0) break;
+    } 
+
+    // Non-canonical encodings of R and values R with a component of order 2, which must be rejected by SchnorrQ_Verify() and by the batch check.
+    // The batch check accepts a small-order component with probability 1/2 if it is not excluded, so the last type is repeated. SecretKey is the key of PublicKey[BATCH_SIZE-1]
+    Message[j][0] ^= 1;                                   // Undo the changes of the last invalid batch test
+    Signature[(j+1) % BATCH_SIZE][0] ^= 1;
+    for (n = 0; n < 2+16 && passed == 1; n++) {
+        Status = sign_noncanonical(SecretKey, Message[BATCH_SIZE-1], len[BATCH_SIZE-1], (n < 2)? n : 2, Signature[BATCH_SIZE-1]);
+        if (Status == ECCRYPTO_SUCCESS) Status = SchnorrQ_Verify(PublicKey[BATCH_SIZE-1], Message[BATCH_SIZE-1], len[BATCH_SIZE-1], Signature[BATCH_SIZE-1], &valid1);
+        if (Status == ECCRYPTO_SUCCESS) Status = verify_batch(pk, msg, len, sig, valid);
+        if (Status != ECCRYPTO_SUCCESS) {
+            return Status;
+        }
+        for (i = 0; i < BATCH_SIZE; i++) {
+            if ((valid[i] == true) != (i != BATCH_SIZE-1)) { passed = 0; break; }
+        }
+        if (valid1 == true) passed = 0;
+    }
+    if (passed==1) printf("  Batch verification tests......................................................... PASSED");
+    else { printf("  Batch verification tests... FAILED"); printf("\n"); Status = ECCRYPTO_ERROR_SIGNATURE_VERIFICATION; }
+    printf("\n");
+    
+    return Status;
+}
+
+
+ECCRYPTO_STATUS SchnorrQ_batch_run()
+{ // Benchmark batch verification of SchnorrQ signatures
+    int n;
+    unsigned long long cycles, cycles1, cycles2;
+    unsigned int i, len[BATCH_SIZE], valid[BATCH_SIZE];
+    unsigned char SecretKey[32], PublicKey[BATCH_SIZE][32], Signature[BATCH_SIZE][64], Message[BATCH_SIZE][32];
+    const unsigned char *pk[BATCH_SIZE], *sig[BATCH_SIZE], *msg[BATCH_SIZE];
+    void* workspace;
+    ECCRYPTO_STATUS Status = ECCRYPTO_SUCCESS;
+
+    printf("\n--------------------------------------------------------------------------------------------------------\n\n"); 
+    printf("Benchmarking batch verification of SchnorrQ signatures: \n\n"); 
+
+    for (i = 0; i < BATCH_SIZE; i++) {
+        Status = SchnorrQ_FullKeyGeneration(SecretKey, PublicKey[i]);
+        if (Status != ECCRYPTO_SUCCESS) {
+            return Status;
+        }
+        len[i] = 32;
+        RandomBytesFunction(Message[i], len[i]);
+        Status = SchnorrQ_Sign(SecretKey, PublicKey[i], Message[i], len[i], Signature[i]);
+        if (Status != ECCRYPTO_SUCCESS) {
+            return Status;
+        }
+        pk[i] = PublicKey[i]; sig[i] = Signature[i]; msg[i] = Message[i];
+    }
+
+#if !defined(FOURQ_NO_MALLOC)
+    cycles = 0;
+    for (n = 0; n < BENCH_LOOPS/BATCH_SIZE; n++)
+    {
+        cycles1 = cpucycles(); 
+        Status = SchnorrQ_VerifyBatch(pk, msg, len, sig, BATCH_SIZE, valid);
+        if (Status != ECCRYPTO_SUCCESS) {
+            return Status;
+        }    
+        cycles2 = cpucycles();
+        cycles = cycles+(cycles2-cycles1);
+    }
+    printf("  SchnorrQ's batch verification (%d signatures) runs in ........................... %8lld ", BATCH_SIZE, cycles/((BENCH_LOOPS/BATCH_SIZE)*BATCH_SIZE)); print_unit;
+    printf(" per signature\n");
+#endif
+
+    workspace = malloc(SchnorrQ_VerifyBatchWorkspaceSize(BATCH_SIZE));
+    if (workspace == NULL) {
+        return ECCRYPTO_ERROR_NO_MEMORY;
+    }
+    cycles = 0;
+    for (n = 0; n < BENCH_LOOPS/BATCH_SIZE; n++)
+    {
+        cycles1 = cpucycles(); 
+        Status = SchnorrQ_VerifyBatchWorkspace(pk, msg, len, sig, BATCH_SIZE, valid, workspace, SchnorrQ_VerifyBatchWorkspaceSize(BATCH_SIZE));
+        if (Status != ECCRYPTO_SUCCESS) {
+            break;
+        }    
+        cycles2 = cpucycles();
+        cycles = cycles+(cycles2-cycles1);
+    }
+    free(workspace);
+    if (Status != ECCRYPTO_SUCCESS) {
+        return Status;
+    }
+    printf("  SchnorrQ's batch verification (%d signatures) with a workspace runs in .......... %8lld ", BATCH_SIZE, cycles/((BENCH_LOOPS/BATCH_SIZE)*BATCH_SIZE)); print_unit;
+    printf(" per signature\n");
+    
+    return Status;
+}
+
+
+ECCRYPTO_STATUS compressedkex_test()
+{ // Test ECDH key exchange based on FourQ
+    int n, passed;
+    unsigned int i;
+    unsigned char SecretKeyA[32], PublicKeyA[32], SecretAgreementA[32];
+    unsigned char SecretKeyB[32], PublicKeyB[32], SecretAgreementB[32];
+    ECDH_PreparedPublicKey PreparedKey;
+    ECCRYPTO_STATUS Status = ECCRYPTO_SUCCESS;
+
+    printf("\n--------------------------------------------------------------------------------------------------------\n\n");
+    printf("Testing DH key exchange using compressed, 32-byte public keys: \n\n");
+
+    passed = 1;
+    for (n = 0; n < TEST_LOOPS; n++)
+    {
+        // Alice's keypair generation
+        Status = CompressedKeyGeneration(SecretKeyA, PublicKeyA);
+        if (Status != ECCRYPTO_SUCCESS) {
+            return Status;
+        }
+        // Bob's keypair generation
+        Status = CompressedKeyGeneration(SecretKeyB, PublicKeyB);
+        if (Status != ECCRYPTO_SUCCESS) {
+            return Status;
+        }
+
+        // Alice's shared secret computation
+        Status = CompressedSecretAgreement(SecretKeyA, PublicKeyB, SecretAgreementA);
+        if (Status != ECCRYPTO_SUCCESS) {
+            return Status;
+        }
+        // Bob's shared secret computation
+        Status = CompressedSecretAgreement(SecretKeyB, PublicKeyA, SecretAgreementB);
+        if (Status != ECCRYPTO_SUCCESS) {
+            return Status;
+        }
+
+        for (i = 0; i < 32; i++) {
+            if (SecretAgreementA[i] != SecretAgreementB[i]) {
+                passed = 0;
+                break;
+            }
+        }
+
+        // Alice's shared secret computation using Bob's prepared public key
+        Status = PrepareECDHPublicKey(PublicKeyB, &PreparedKey);
+        if (Status != ECCRYPTO_SUCCESS) {
+            return Status;
+        }
+        Status = SecretAgreementPrepared(SecretKeyA, &PreparedKey, SecretAgreementB);
+        if (Status != ECCRYPTO_SUCCESS) {
+            return Status;
+        }
+
+        for (i = 0; i < 32; i++) {
+            if (SecretAgreementA[i] != SecretAgreementB[i]) {
+                passed = 0;
+                break;
+            }
+        }
+    }
+    if (passed==1) printf("  DH key exchange tests............................................................ PASSED");
+    else { printf("  DH key exchange tests... FAILED"); printf("\n"); Status = ECCRYPTO_ERROR_SHARED_KEY; }
+    printf("\n");
+
+    // Public keys that are not valid encodings, and the neutral point (0,1), are rejected by the preparation
+    passed = 1;
+    PublicKeyB[15] |= 0x80;
+    if (PrepareECDHPublicKey(PublicKeyB, &PreparedKey) != ECCRYPTO_ERROR_INVALID_PARAMETER) {
+        passed = 0;
+    }
+    memset(PublicKeyB, 0, 32);
+    PublicKeyB[0] = 1;
+    if (CompressedSecretAgreement(SecretKeyA, PublicKeyB, SecretAgreementA) != ECCRYPTO_ERROR_SHARED_KEY || 
+        PrepareECDHPublicKey(PublicKeyB, &PreparedKey) != ECCRYPTO_ERROR_SHARED_KEY) {
+        passed = 0;
+    }
+    if (passed==1) printf("  Prepared public key rejection tests.............................................. PASSED");
+    else { printf("  Prepared public key rejection tests... FAILED"); printf("\n"); Status = ECCRYPTO_ERROR_SHARED_KEY; }
+    printf("\n");
+
+    return Status;
+}
+
+
+ECCRYPTO_STATUS compressedkex_run()
+{ // Benchmark ECDH key exchange based on FourQ 
+    int n;
+    unsigned long long cycles, cycles1, cycles2;
+    unsigned char SecretKeyA[32], PublicKeyA[32], SecretAgreementA[32];
+    unsigned char SecretKeyB[32], PublicKeyB[32];
+    ECDH_PreparedPublicKey PreparedKey;
+    ECCRYPTO_STATUS Status = ECCRYPTO_SUCCESS;
+
+    printf("\n--------------------------------------------------------------------------------------------------------\n\n");
+    printf("Benchmarking DH key exchange using compressed, 32-byte public keys: \n\n");
+
+    cycles = 0;
+    for (n = 0; n < BENCH_LOOPS; n++)
+    {
+        cycles1 = cpucycles();
+        Status = CompressedKeyGeneration(SecretKeyA, PublicKeyA);
+        if (Status != ECCRYPTO_SUCCESS) {
+            return Status;
+        }
+        cycles2 = cpucycles();
+        cycles = cycles + (cycles2 - cycles1);
+    }
+    printf("  Keypair generation runs in ...................................................... %8lld ", cycles/BENCH_LOOPS); print_unit;
+    printf("\n");
+    
+    Status = CompressedKeyGeneration(SecretKeyB, PublicKeyB);
+    cycles = 0;
+    for (n = 0; n < BENCH_LOOPS; n++)
+    {
+        cycles1 = cpucycles();
+        Status = CompressedSecretAgreement(SecretKeyA, PublicKeyB, SecretAgreementA);
+        if (Status != ECCRYPTO_SUCCESS) {
+            return Status;
+        }
+        cycles2 = cpucycles();
+        cycles = cycles + (cycles2 - cycles1);
+    }
+    printf("  Secret agreement runs in ........................................................ %8lld ", cycles/BENCH_LOOPS); print_unit;
+    printf("\n");
+
+    Status = PrepareECDHPublicKey(PublicKeyB, &PreparedKey);
+    if (Status != ECCRYPTO_SUCCESS) {
+        return Status;
+    }
+    cycles = 0;
+    for (n = 0; n < BENCH_LOOPS; n++)
+    {
+        cycles1 = cpucycles();
+        Status = SecretAgreementPrepared(SecretKeyA, &PreparedKey, SecretAgreementA);
+        if (Status != ECCRYPTO_SUCCESS) {
+            return Status;
+        }
+        cycles2 = cpucycles();
+        cycles = cycles + (cycles2 - cycles1);
+    }
+    printf("  Secret agreement with a prepared public key runs in ............................. %8lld ", cycles/BENCH_LOOPS); print_unit;
+    printf("\n");
+
+    return Status;
+}
+
+
+ECCRYPTO_STATUS kex_test()
+{ // Test ECDH key exchange based on FourQ
+    int n, passed;
+    unsigned int i;
+    unsigned char SecretKeyA[32], PublicKeyA[64], SecretAgreementA[32];
+    unsigned char SecretKeyB[32], PublicKeyB[64], SecretAgreementB[32];
+    ECCRYPTO_STATUS Status = ECCRYPTO_SUCCESS;
+
+    printf("\n--------------------------------------------------------------------------------------------------------\n\n");
+    printf("Testing DH key exchange using uncompressed, 64-byte public keys: \n\n");
+
+    passed = 1;
+    for (n = 0; n < TEST_LOOPS; n++)
+    {
+        // Alice's keypair generation
+        Status = KeyGeneration(SecretKeyA, PublicKeyA);
+        if (Status != ECCRYPTO_SUCCESS) {
+            return Status;
+        }
+        // Bob's keypair generation
+        Status = KeyGeneration(SecretKeyB, PublicKeyB);
+        if (Status != ECCRYPTO_SUCCESS) {
+            return Status;
+        }
+
+        // Alice's shared secret computation
+        Status = SecretAgreement(SecretKeyA, PublicKeyB, SecretAgreementA);
+        if (Status != ECCRYPTO_SUCCESS) {
+            return Status;
+        }
+        // Bob's shared secret computation
+        Status = SecretAgreement(SecretKeyB, PublicKeyA, SecretAgreementB);
+        if (Status != ECCRYPTO_SUCCESS) {
+            return Status;
+        }
+
+        for (i = 0; i < 32; i++) {
+            if (SecretAgreementA[i] != SecretAgreementB[i]) {
+                passed = 0;
+                break;
+            }
+        }
+    }
+    if (passed==1) printf("  DH key exchange tests............................................................ PASSED");
+    else { printf("  DH key exchange tests... FAILED"); printf("\n"); Status = ECCRYPTO_ERROR_SHARED_KEY; }
+    printf("\n");
+
+    return Status;
+}
+
+
+ECCRYPTO_STATUS kex_run()
+{ // Benchmark ECDH key exchange based on FourQ 
+    int n;
+    unsigned long long cycles, cycles1, cycles2;
+    unsigned char SecretKeyA[32], PublicKeyA[64], SecretAgreementA[32];
+    unsigned char SecretKeyB[32], PublicKeyB[64];
+    ECCRYPTO_STATUS Status = ECCRYPTO_SUCCESS;
+
+    printf("\n--------------------------------------------------------------------------------------------------------\n\n");
+    printf("Benchmarking DH key exchange using uncompressed, 64-byte public keys: \n\n");
+
+    cycles = 0;
+    for (n = 0; n < BENCH_LOOPS; n++)
+    {
+        cycles1 = cpucycles();
+        Status = KeyGeneration(SecretKeyA, PublicKeyA);
+        if (Status != ECCRYPTO_SUCCESS) {
+            return Status;
+        }
+        cycles2 = cpucycles();
+        cycles = cycles + (cycles2 - cycles1);
+    }
+    printf("  Keypair generation runs in ...................................................... %8lld ", cycles/BENCH_LOOPS); print_unit;
+    printf("\n");
+
+    Status = KeyGeneration(SecretKeyB, PublicKeyB);
+    cycles = 0;
+    for (n = 0; n < BENCH_LOOPS; n++)
+    {
+        cycles1 = cpucycles();
+        Status = SecretAgreement(SecretKeyA, PublicKeyB, SecretAgreementA);
+        if (Status != ECCRYPTO_SUCCESS) {
+            return Status;
+        }
+        cycles2 = cpucycles();
+        cycles = cycles + (cycles2 - cycles1);
+    }
+    printf("  Secret agreement runs in ........................................................ %8lld ", cycles/BENCH_LOOPS); print_unit;
+    printf("\n");
+
+    return Status;
+}
+
+
+ECCRYPTO_STATUS keygen_batch_test()
+{ // Test batched keypair generation
+    int n, passed;
+    unsigned int i, j;
+    unsigned char SecretKey[KEYGEN_BATCH_SIZE][32], PublicKey[KEYGEN_BATCH_SIZE][64], PublicKeySingle[64];
+    unsigned char *sk[KEYGEN_BATCH_SIZE], *pk[KEYGEN_BATCH_SIZE];
+    ECCRYPTO_STATUS Status = ECCRYPTO_SUCCESS;
+
+    printf("\n--------------------------------------------------------------------------------------------------------\n\n");
+    printf("Testing batched keypair generation: \n\n");
+
+    for (i = 0; i < KEYGEN_BATCH_SIZE; i++) {
+        sk[i] = SecretKey[i]; pk[i] = PublicKey[i];
+    }
+
+    passed = 1;
+    for (n = 0; n < TEST_LOOPS/KEYGEN_BATCH_SIZE+1; n++)
+    {
+        for (j = 0; j < 3; j++) {
+            if (j == 0) {
+                Status = CompressedKeyGenerationBatch(sk, pk, KEYGEN_BATCH_SIZE);
+            } else if (j == 1) {
+                Status = KeyGenerationBatch(sk, pk, KEYGEN_BATCH_SIZE);
+            } else {
+                Status = SchnorrQ_FullKeyGenerationBatch(sk, pk, KEYGEN_BATCH_SIZE);
+            }
+            if (Status != ECCRYPTO_SUCCESS) {
+                return Status;
+            }
+
+            for (i = 0; i < KEYGEN_BATCH_SIZE; i++) {
+                if (j == 0) {
+                    Status = CompressedPublicKeyGeneration(SecretKey[i], PublicKeySingle);
+                } else if (j == 1) {
+                    Status = PublicKeyGeneration(SecretKey[i], PublicKeySingle);
+                } else {
+                    Status = SchnorrQ_KeyGeneration(SecretKey[i], PublicKeySingle);
+                }
+                if (Status != ECCRYPTO_SUCCESS) {
+                    return Status;
+                }
+                if (memcmp(PublicKey[i], PublicKeySingle, (j == 1)? 64 : 32) != 0) { passed = 0; break; }
+            }
+            if (passed == 0) break;
+        }
+        if (passed == 0) break;
+    }
+    if (passed==1) printf("  Batched keypair generation tests.................................................. PASSED");
+    else { printf("  Batched keypair generation tests... FAILED"); printf("\n"); Status = ECCRYPTO_ERROR; }
+    printf("\n");
+
+    return Status;
+}
+
+
+ECCRYPTO_STATUS keygen_batch_run()
+{ // Benchmark batched keypair generation
+    int n;
+    unsigned long long cycles, cycles1, cycles2;
+    unsigned int i;
+    unsigned char SecretKey[64][32], PublicKey[64][32];
+    unsigned char *sk[64], *pk[64];
+    ECCRYPTO_STATUS Status = ECCRYPTO_SUCCESS;
+
+    printf("\n--------------------------------------------------------------------------------------------------------\n\n");
+    printf("Benchmarking batched keypair generation: \n\n");
+
+    for (i = 0; i < 64; i++) {
+        sk[i] = SecretKey[i]; pk[i] = PublicKey[i];
+    }
+
+    cycles = 0;
+    for (n = 0; n < BENCH_LOOPS/64; n++)
+    {
+        cycles1 = cpucycles();
+        Status = CompressedKeyGenerationBatch(sk, pk, 64);
+        if (Status != ECCRYPTO_SUCCESS) {
+            return Status;
+        }
+        cycles2 = cpucycles();
+        cycles = cycles + (cycles2 - cycles1);
+    }
+    printf("  Batched keypair generation (compressed keys) runs in ............................ %8lld ", cycles/((BENCH_LOOPS/64)*64)); print_unit;
+    printf(" per keypair\n");
+
+    return Status;
+}
+
+
+ECCRYPTO_STATUS kex_batch_test()
+{ // Test batched ECDH secret agreements based on FourQ
+    int n, passed;
+    unsigned int i, j, bad;
+    unsigned char SecretKey[KEX_BATCH_SIZE][32], PublicKeyA[32], PublicKey[KEX_BATCH_SIZE][32], PublicKey64[KEX_BATCH_SIZE][64];
+    unsigned char Shared[KEX_BATCH_SIZE][32], SharedBatch[KEX_BATCH_SIZE][32];
+    const unsigned char *sk[KEX_BATCH_SIZE], *pk[KEX_BATCH_SIZE], *pk64[KEX_BATCH_SIZE];
+    unsigned char *ss[KEX_BATCH_SIZE];
+    ECCRYPTO_STATUS Statuses[KEX_BATCH_SIZE], StatusSingle, Status = ECCRYPTO_SUCCESS;
+
+    printf("\n--------------------------------------------------------------------------------------------------------\n\n");
+    printf("Testing batched DH secret agreements: \n\n");
+
+    passed = 1;
+    for (n = 0; n < TEST_LOOPS/KEX_BATCH_SIZE+1; n++)
+    {
+        for (i = 0; i < KEX_BATCH_SIZE; i++) {
+            Status = CompressedKeyGeneration(SecretKey[i], PublicKeyA);
+            if (Status != ECCRYPTO_SUCCESS) {
+                return Status;
+            }
+            Status = CompressedKeyGeneration(PublicKey64[i], PublicKey[i]);
+            if (Status != ECCRYPTO_SUCCESS) {
+                return Status;
+            }
+            Status = PublicKeyGeneration(PublicKey64[i], PublicKey64[i]);
+            if (Status != ECCRYPTO_SUCCESS) {
+                return Status;
+            }
+            sk[i] = SecretKey[i]; pk[i] = PublicKey[i]; pk64[i] = PublicKey64[i]; ss[i] = SharedBatch[i];
+        }
+
+        // Invalid public keys: bit128 set in a compressed key, and a point that is not on the curve
+        bad = (unsigned int)n % KEX_BATCH_SIZE;
+        PublicKey[bad][15] |= 0x80;
+        PublicKey64[(bad+3) % KEX_BATCH_SIZE][0] ^= 1;
+
+        for (j = 0; j < 2; j++) {
+            if (j == 0) {
+                Status = CompressedSecretAgreementBatch(sk, pk, ss, KEX_BATCH_SIZE, Statuses);
+            } else {
+                Status = SecretAgreementBatch(sk, pk64, ss, KEX_BATCH_SIZE, Statuses);
+            }
+            if (Status == ECCRYPTO_SUCCESS) { passed = 0; break; }
+
+            for (i = 0; i < KEX_BATCH_SIZE; i++) {
+                if (j == 0) {
+                    StatusSingle = CompressedSecretAgreement(SecretKey[i], PublicKey[i], Shared[i]);
+                } else {
+                    StatusSingle = SecretAgreement(SecretKey[i], PublicKey64[i], Shared[i]);
+                }
+                if (StatusSingle != Statuses[i] || memcmp(Shared[i], SharedBatch[i], 32) != 0) { passed = 0; break; }
+                if ((StatusSingle == ECCRYPTO_SUCCESS) == (i == ((j == 0)? bad : (bad+3) % KEX_BATCH_SIZE))) { passed = 0; break; }
+            }
+            if (passed == 0) break;
+        }
+        if (passed == 0) break;
+    }
+    Status = ECCRYPTO_SUCCESS;
+    if (passed==1) printf("  Batched secret agreement tests.................................................... PASSED");
+    else { printf("  Batched secret agreement tests... FAILED"); printf("\n"); Status = ECCRYPTO_ERROR_SHARED_KEY; }
+    printf("\n");
+
+    return Status;
+}
+
+
+ECCRYPTO_STATUS kex_batch_run()
+{ // Benchmark batched ECDH secret agreements based on FourQ
+    int n;
+    unsigned long long cycles, cycles1, cycles2;
+    unsigned int i;
+    unsigned char SecretKey[8][32], PublicKey[8][32], Shared[8][32];
+    const unsigned char *sk[8], *pk[8];
+    unsigned char *ss[8];
+    ECCRYPTO_STATUS Statuses[8], Status = ECCRYPTO_SUCCESS;
+
+    printf("\n--------------------------------------------------------------------------------------------------------\n\n");
+    printf("Benchmarking batched DH secret agreements: \n\n");
+
+    for (i = 0; i < 8; i++) {
+        Status = CompressedKeyGeneration(SecretKey[i], PublicKey[i]);
+        if (Status != ECCRYPTO_SUCCESS) {
+            return Status;
+        }
+        sk[i] = SecretKey[i]; pk[i] = PublicKey[(i+1) % 8]; ss[i] = Shared[i];
+    }
+
+    cycles = 0;
+    for (n = 0; n < BENCH_LOOPS/8; n++)
+    {
+        cycles1 = cpucycles();
+        Status = CompressedSecretAgreementBatch(sk, pk, ss, 8, Statuses);
+        if (Status != ECCRYPTO_SUCCESS) {
+            return Status;
+        }
+        cycles2 = cpucycles();
+        cycles = cycles + (cycles2 - cycles1);
+    }
+    printf("  Batched secret agreement (compressed keys) runs in .............................. %8lld ", cycles/((BENCH_LOOPS/8)*8)); print_unit;
+    printf(" per agreement\n");
+
+    return Status;
+}
+
+
+ECCRYPTO_STATUS kex_many_test()
+{ // Test ECDH secret agreements of a single secret key with many public keys
+    int n, passed;
+    unsigned int i, j, bad, num;
+    unsigned char SecretKey[32], PublicKey[KEX_MANY_SIZE][32], PublicKey64[KEX_MANY_SIZE][64], Temp[32];
+    unsigned char Shared[KEX_MANY_SIZE][32], SharedMany[KEX_MANY_SIZE][32];
+    const unsigned char *pk[KEX_MANY_SIZE], *pk64[KEX_MANY_SIZE];
+    unsigned char *ss[KEX_MANY_SIZE];
+    ECCRYPTO_STATUS Statuses[KEX_MANY_SIZE], StatusSingle, Status = ECCRYPTO_SUCCESS;
+
+    printf("\n--------------------------------------------------------------------------------------------------------\n\n");
+    printf("Testing DH secret agreements with a single secret key: \n\n");
+
+    passed = 1;
+    for (n = 0; n < TEST_LOOPS/KEX_MANY_SIZE+1; n++)
+    {
+        Status = CompressedKeyGeneration(SecretKey, Temp);
+        if (Status != ECCRYPTO_SUCCESS) {
+            return Status;
+        }
+        for (i = 0; i < KEX_MANY_SIZE; i++) {
+            Status = CompressedKeyGeneration(Temp, PublicKey[i]);
+            if (Status != ECCRYPTO_SUCCESS) {
+                return Status;
+            }
+            Status = PublicKeyGeneration(Temp, PublicKey64[i]);
+            if (Status != ECCRYPTO_SUCCESS) {
+                return Status;
+            }
+            pk[i] = PublicKey[i]; pk64[i] = PublicKey64[i]; ss[i] = SharedMany[i];
+        }
+
+        // Invalid public keys: bit128 set in a compressed key, and a point that is not on the curve
+        bad = (unsigned int)n % KEX_MANY_SIZE;
+        PublicKey[bad][15] |= 0x80;
+        PublicKey64[(bad+3) % KEX_MANY_SIZE][0] ^= 1;
+        num = KEX_MANY_SIZE - (unsigned int)n % 16;     // Different sizes of the last group
+
+        for (j = 0; j < 2; j++) {
+            if (j == 0) {
+                Status = CompressedSecretAgreementMany(SecretKey, pk, ss, num, Statuses);
+            } else {
+                Status = SecretAgreementMany(SecretKey, pk64, ss, num, Statuses);
+            }
+
+            for (i = 0; i < num; i++) {
+                if (j == 0) {
+                    StatusSingle = CompressedSecretAgreement(SecretKey, PublicKey[i], Shared[i]);
+                } else {
+                    StatusSingle = SecretAgreement(SecretKey, PublicKey64[i], Shared[i]);
+                }
+                if (StatusSingle != Statuses[i] || memcmp(Shared[i], SharedMany[i], 32) != 0) { passed = 0; break; }
+                if ((StatusSingle == ECCRYPTO_SUCCESS) == (i == ((j == 0)? bad : (bad+3) % KEX_MANY_SIZE))) { passed = 0; break; }
+                if (StatusSingle != ECCRYPTO_SUCCESS && Status != StatusSingle) { passed = 0; break; }
+            }
+            if (passed == 0) break;
+        }
+        if (passed == 0) break;
+    }
+    Status = ECCRYPTO_SUCCESS;
+    if (passed==1) printf("  Secret agreement tests with a single secret key.................................. PASSED");
+    else { printf("  Secret agreement tests with a single secret key... FAILED"); printf("\n"); Status = ECCRYPTO_ERROR_SHARED_KEY; }
+    printf("\n");
+
+    return Status;
+}
+
+
+ECCRYPTO_STATUS kex_many_run()
+{ // Benchmark ECDH secret agreements of a single secret key with many public keys
+    int n;
+    unsigned long long cycles, cycles1, cycles2;
+    unsigned int i;
+    unsigned char SecretKey[32], PublicKey[64][32], Shared[64][32], Temp[32];
+    const unsigned char *pk[64];
+    unsigned char *ss[64];
+    ECCRYPTO_STATUS Statuses[64], Status = ECCRYPTO_SUCCESS;
+
+    printf("\n--------------------------------------------------------------------------------------------------------\n\n");
+    printf("Benchmarking DH secret agreements with a single secret key: \n\n");
+
+    Status = CompressedKeyGeneration(SecretKey, Temp);
+    if (Status != ECCRYPTO_SUCCESS) {
+        return Status;
+    }
+    for (i = 0; i < 64; i++) {
+        Status = CompressedKeyGeneration(Temp, PublicKey[i]);
+        if (Status != ECCRYPTO_SUCCESS) {
+            return Status;
+        }
+        pk[i] = PublicKey[i]; ss[i] = Shared[i];
+    }
+
+    cycles = 0;
+    for (n = 0; n < BENCH_LOOPS/64; n++)
+    {
+        cycles1 = cpucycles();
+        Status = CompressedSecretAgreementMany(SecretKey, pk, ss, 64, Statuses);
+        if (Status != ECCRYPTO_SUCCESS) {
+            return Status;
+        }
+        cycles2 = cpucycles();
+        cycles = cycles + (cycles2 - cycles1);
+    }
+    printf("  Secret agreements with a single secret key (64 compressed keys) run in .......... %8lld ", cycles/((BENCH_LOOPS/64)*64)); print_unit;
+    printf(" per agreement\n");
+
+    return Status;
+}
+
+
+#if defined(THREADS_SUPPORT)
+
+ECCRYPTO_STATUS parallel_test()
+{ // Test multithreaded batch functions
+    int n, passed;
+    unsigned int i, j, bad;
+    unsigned char SecretKey[PARALLEL_BATCH_SIZE][32], PublicKey[PARALLEL_BATCH_SIZE][64], Message[PARALLEL_BATCH_SIZE][32], Signature[PARALLEL_BATCH_SIZE][64];
+    unsigned char Output[PARALLEL_BATCH_SIZE][64], OutputSingle[64];
+    unsigned char *sk[PARALLEL_BATCH_SIZE], *pk[PARALLEL_BATCH_SIZE], *out[PARALLEL_BATCH_SIZE];
+    const unsigned char *csk[PARALLEL_BATCH_SIZE], *cpk[PARALLEL_BATCH_SIZE], *msg[PARALLEL_BATCH_SIZE], *sig[PARALLEL_BATCH_SIZE];
+    unsigned int SizeMessage[PARALLEL_BATCH_SIZE], valid[PARALLEL_BATCH_SIZE];
+    fourq_pool* Pool = NULL;
+    fourq_pool* Pools[2];
+    ECCRYPTO_STATUS Statuses[PARALLEL_BATCH_SIZE], StatusSingle, Status = ECCRYPTO_SUCCESS;
+
+    printf("\n--------------------------------------------------------------------------------------------------------\n\n");
+    printf("Testing multithreaded batch functions: \n\n");
+
+    Status = fourq_pool_create(3, &Pool);
+    if (Status != ECCRYPTO_SUCCESS) {
+        return Status;
+    }
+    Pools[0] = Pool; Pools[1] = NULL;                    // A NULL pool runs on the calling thread
+
+    for (i = 0; i < PARALLEL_BATCH_SIZE; i++) {
+        sk[i] = SecretKey[i]; pk[i] = PublicKey[i]; out[i] = Output[i];
+        csk[i] = SecretKey[i]; cpk[i] = PublicKey[i]; msg[i] = Message[i]; sig[i] = Signature[i];
+        SizeMessage[i] = i % 33;
+    }
+
+    passed = (fourq_pool_num_threads(Pool) == 3);
+    for (n = 0; n < TEST_LOOPS/100+2 && passed == 1; n++)
+    {
+        for (j = 0; j < 2 && passed == 1; j++) {
+            // Keypair generation
+            Status = KeyGenerationParallel(Pools[j], sk, pk, PARALLEL_BATCH_SIZE, Statuses);
+            if (Status != ECCRYPTO_SUCCESS) goto cleanup;
+            for (i = 0; i < PARALLEL_BATCH_SIZE; i++) {
+                Status = PublicKeyGeneration(SecretKey[i], OutputSingle);
+                if (Status != ECCRYPTO_SUCCESS) goto cleanup;
+                if (Statuses[i] != ECCRYPTO_SUCCESS || memcmp(PublicKey[i], OutputSingle, 64) != 0) { passed = 0; break; }
+            }
+            Status = CompressedKeyGenerationParallel(Pools[j], sk, pk, PARALLEL_BATCH_SIZE, Statuses);
+            if (Status != ECCRYPTO_SUCCESS) goto cleanup;
+            for (i = 0; i < PARALLEL_BATCH_SIZE; i++) {
+                Status = CompressedPublicKeyGeneration(SecretKey[i], OutputSingle);
+                if (Status != ECCRYPTO_SUCCESS) goto cleanup;
+                if (Statuses[i] != ECCRYPTO_SUCCESS || memcmp(PublicKey[i], OutputSingle, 32) != 0) { passed = 0; break; }
+            }
+
+            // Signing and verification, with one invalid signature
+            for (i = 0; i < PARALLEL_BATCH_SIZE; i++) {
+                Status = SchnorrQ_KeyGeneration(SecretKey[i], PublicKey[i]);
+                if (Status != ECCRYPTO_SUCCESS) goto cleanup;
+                random_bytes(Message[i], SizeMessage[i]);
+            }
+            Status = SchnorrQ_SignParallel(Pools[j], csk, cpk, msg, SizeMessage, out, PARALLEL_BATCH_SIZE, Statuses);
+            if (Status != ECCRYPTO_SUCCESS) goto cleanup;
+            for (i = 0; i < PARALLEL_BATCH_SIZE; i++) {
+                Status = SchnorrQ_Sign(SecretKey[i], PublicKey[i], Message[i], SizeMessage[i], Signature[i]);
+                if (Status != ECCRYPTO_SUCCESS) goto cleanup;
+                if (Statuses[i] != ECCRYPTO_SUCCESS || memcmp(Output[i], Signature[i], 64) != 0) { passed = 0; break; }
+            }
+            bad = (unsigned int)n % PARALLEL_BATCH_SIZE;
+            Signature[bad][40] ^= 1;
+            Status = SchnorrQ_VerifyParallel(Pools[j], cpk, msg, SizeMessage, sig, PARALLEL_BATCH_SIZE, valid, Statuses);
+            if (Status != ECCRYPTO_SUCCESS) goto cleanup;
+            for (i = 0; i < PARALLEL_BATCH_SIZE; i++) {
+                if (valid[i] != (i != bad)) { passed = 0; break; }
+            }
+
+            // Secret agreements, with one invalid public key
+            for (i = 0; i < PARALLEL_BATCH_SIZE; i++) {
+                Status = CompressedKeyGeneration(Signature[i], PublicKey[i]);
+                if (Status != ECCRYPTO_SUCCESS) goto cleanup;
+            }
+            PublicKey[bad][15] |= 0x80;
+            Status = CompressedSecretAgreementParallel(Pools[j], csk, cpk, out, PARALLEL_BATCH_SIZE, Statuses);
+            if (Status == ECCRYPTO_SUCCESS) { passed = 0; break; }
+            for (i = 0; i < PARALLEL_BATCH_SIZE; i++) {
+                StatusSingle = CompressedSecretAgreement(SecretKey[i], PublicKey[i], OutputSingle);
+                if (StatusSingle != Statuses[i] || (StatusSingle == ECCRYPTO_SUCCESS) == (i == bad) || memcmp(Output[i], OutputSingle, 32) != 0) { passed = 0; break; }
+            }
+            for (i = 0; i < PARALLEL_BATCH_SIZE; i++) {
+                Status = PublicKeyGeneration(Signature[i], PublicKey[i]);
+                if (Status != ECCRYPTO_SUCCESS) goto cleanup;
+            }
+            PublicKey[bad][0] ^= 1;
+            Status = SecretAgreementParallel(Pools[j], csk, cpk, out, PARALLEL_BATCH_SIZE, Statuses);
+            if (Status == ECCRYPTO_SUCCESS) { passed = 0; break; }
+            for (i = 0; i < PARALLEL_BATCH_SIZE; i++) {
+                StatusSingle = SecretAgreement(SecretKey[i], PublicKey[i], OutputSingle);
+                if (StatusSingle != Statuses[i] || (StatusSingle == ECCRYPTO_SUCCESS) == (i == bad) || memcmp(Output[i], OutputSingle, 32) != 0) { passed = 0; break; }
+            }
+            Status = ECCRYPTO_SUCCESS;
+        }
+    }
+    if (passed==1) printf("  Multithreaded batch function tests................................................ PASSED");
+    else { printf("  Multithreaded batch function tests... FAILED"); printf("\n"); Status = ECCRYPTO_ERROR; }
+    printf("\n");
+
+cleanup:
+    fourq_pool_destroy(Pool);
+    return Status;
+}
+
+
+ECCRYPTO_STATUS parallel_run()
+{ // Benchmark multithreaded batch functions
+    int n;
+    unsigned long long cycles, cycles1, cycles2;
+    unsigned int i, j;
+    unsigned char SecretKey[64][32], PublicKey[64][32], Message[64][32], Signature[64][64];
+    const unsigned char *pk[64], *msg[64], *sig[64];
+    unsigned int SizeMessage[64], valid[64];
+    fourq_pool* Pool = NULL;
+    ECCRYPTO_STATUS Statuses[64], Status = ECCRYPTO_SUCCESS;
+
+    printf("\n--------------------------------------------------------------------------------------------------------\n\n");
+    printf("Benchmarking multithreaded batch functions: \n\n");
+
+    Status = fourq_pool_create(0, &Pool);
+    if (Status != ECCRYPTO_SUCCESS) {
+        return Status;
+    }
+
+    for (i = 0; i < 64; i++) {
+        Status = SchnorrQ_FullKeyGeneration(SecretKey[i], PublicKey[i]);
+        if (Status != ECCRYPTO_SUCCESS) goto cleanup;
+        random_bytes(Message[i], 32);
+        Status = SchnorrQ_Sign(SecretKey[i], PublicKey[i], Message[i], 32, Signature[i]);
+        if (Status != ECCRYPTO_SUCCESS) goto cleanup;
+        pk[i] = PublicKey[i]; msg[i] = Message[i]; sig[i] = Signature[i]; SizeMessage[i] = 32;
+    }
+
+    for (j = 0; j < 2; j++) {
+        cycles = 0;
+        for (n = 0; n < BENCH_LOOPS/64; n++)
+        {
+            cycles1 = cpucycles();
+            Status = SchnorrQ_VerifyParallel((j == 0)? NULL : Pool, pk, msg, SizeMessage, sig, 64, valid, Statuses);
+            if (Status != ECCRYPTO_SUCCESS) goto cleanup;
+            cycles2 = cpucycles();
+            cycles = cycles + (cycles2 - cycles1);
+        }
+        if (j == 0) {
+            printf("  SchnorrQ's verification on the calling thread runs in ........................... %8lld ", cycles/((BENCH_LOOPS/64)*64)); print_unit;
+        } else {
+            printf("  SchnorrQ's verification with %2d worker threads runs in .......................... %8lld ", fourq_pool_num_threads(Pool), cycles/((BENCH_LOOPS/64)*64)); print_unit;
+        }
+        printf(" per signature\n");
+    }
+
+cleanup:
+    fourq_pool_destroy(Pool);
+    return Status;
+}
+
+
+
+static unsigned int async_callbacks = 0;
+
+static void async_test_callback(fourq_job* Job)
+{ // Count the jobs completed through a callback
+    (void)Job;
+    __sync_fetch_and_add(&async_callbacks, 1);
+}
+
+
+static ECCRYPTO_STATUS async_wait(fourq_async* Async, unsigned int NumJobs, fourq_job** Completed)
+{ // Wait on the eventfd until NumJobs jobs without a callback are returned by fourq_async_poll()
+    struct pollfd pfd;
+    unsigned int n = 0;
+
+    pfd.fd = fourq_async_fd(Async);
+    pfd.events = POLLIN;
+    while (n < NumJobs) {
+        if (poll(&pfd, 1, 10000) <= 0) {
+            return ECCRYPTO_ERROR;
+        }
+        n += fourq_async_poll(Async, Completed + n, 3);   // Small maximum per wakeup: the remaining jobs must signal the eventfd again
+    }
+    return ECCRYPTO_SUCCESS;
+}
+
+
+ECCRYPTO_STATUS async_test()
+{ // Test asynchronous jobs
+    int n, passed;
+    unsigned int i, bad;
+    unsigned char SecretKey[ASYNC_JOBS][32], PublicKey[ASYNC_JOBS][64], Message[ASYNC_JOBS][32], Signature[ASYNC_JOBS][64], Output[ASYNC_JOBS][64], OutputSingle[64];
+    unsigned int validSingle;
+    fourq_job Jobs[ASYNC_JOBS], *pJobs[ASYNC_JOBS], *Completed[ASYNC_JOBS];
+    fourq_async* Async = NULL;
+    ECCRYPTO_STATUS StatusSingle, Status = ECCRYPTO_SUCCESS;
+
+    printf("\n--------------------------------------------------------------------------------------------------------\n\n");
+    printf("Testing asynchronous jobs: \n\n");
+
+    Status = fourq_async_create(2, &Async);
+    if (Status != ECCRYPTO_SUCCESS) {
+        return Status;
+    }
+
+    passed = 1;
+    for (n = 0; n < TEST_LOOPS/100+2 && passed == 1; n++)
+    {
+        // Four groups of jobs: signing, verification, compressed and uncompressed secret agreements. One job in four has a callback
+        bad = (unsigned int)n % (ASYNC_JOBS/4);
+        for (i = 0; i < ASYNC_JOBS; i++) {
+            memset(&Jobs[i], 0, sizeof(fourq_job));
+            Status = SchnorrQ_FullKeyGeneration(SecretKey[i], PublicKey[i]);
+            if (Status != ECCRYPTO_SUCCESS) goto cleanup;
+            random_bytes(Message[i], 32);
+            Jobs[i].Type = (fourq_job_type)(i % 4);
+            Jobs[i].SecretKey = SecretKey[i];
+            Jobs[i].PublicKey = PublicKey[i];
+            Jobs[i].Message = Message[i];
+            Jobs[i].SizeMessage = 32;
+            Jobs[i].Signature = Signature[i];
+            Jobs[i].SharedSecret = Output[i];
+            Jobs[i].Callback = ((i/4) % 4 == 0)? async_test_callback : NULL;
+            pJobs[i] = &Jobs[i];
+            if (Jobs[i].Type == FOURQ_JOB_VERIFY) {
+                Status = SchnorrQ_Sign(SecretKey[i], PublicKey[i], Message[i], 32, Signature[i]);
+                if (Status != ECCRYPTO_SUCCESS) goto cleanup;
+                if (i/4 == bad) Message[i][0] ^= 1;
+            } else if (Jobs[i].Type == FOURQ_JOB_COMPRESSED_AGREEMENT) {
+                Status = CompressedKeyGeneration(Output[i], PublicKey[i]);
+                if (Status != ECCRYPTO_SUCCESS) goto cleanup;
+                if (i/4 == bad) PublicKey[i][15] |= 0x80;
+            } else if (Jobs[i].Type == FOURQ_JOB_AGREEMENT) {
+                Status = KeyGeneration(Output[i], PublicKey[i]);
+                if (Status != ECCRYPTO_SUCCESS) goto cleanup;
+                if (i/4 == bad) PublicKey[i][0] ^= 1;
+            }
+        }
+
+        async_callbacks = 0;
+        Status = fourq_async_submit(Async, pJobs, ASYNC_JOBS/2);     // Two submissions, which go to different workers
+        if (Status != ECCRYPTO_SUCCESS) goto cleanup;
+        for (i = ASYNC_JOBS/2; i < ASYNC_JOBS; i++) {
+            Status = fourq_async_submit(Async, &pJobs[i], 1);
+            if (Status != ECCRYPTO_SUCCESS) goto cleanup;
+        }
+        Status = async_wait(Async, ASYNC_JOBS - ASYNC_JOBS/4, Completed);
+        if (Status != ECCRYPTO_SUCCESS) goto cleanup;
+        while (__sync_fetch_and_add(&async_callbacks, 0) != ASYNC_JOBS/4) {}
+        if (fourq_async_poll(Async, Completed, ASYNC_JOBS) != 0) { passed = 0; break; }
+
+        for (i = 0; i < ASYNC_JOBS; i++) {
+            if (Jobs[i].Type == FOURQ_JOB_SIGN) {
+                StatusSingle = SchnorrQ_Sign(SecretKey[i], PublicKey[i], Message[i], 32, OutputSingle);
+                if (Jobs[i].Status != StatusSingle || memcmp(Signature[i], OutputSingle, 64) != 0) { passed = 0; break; }
+            } else if (Jobs[i].Type == FOURQ_JOB_VERIFY) {
+                StatusSingle = SchnorrQ_Verify(PublicKey[i], Message[i], 32, Signature[i], &validSingle);
+                if (Jobs[i].Status != StatusSingle || Jobs[i].valid != validSingle || validSingle != (i/4 != bad)) { passed = 0; break; }
+            } else {
+                if (Jobs[i].Type == FOURQ_JOB_COMPRESSED_AGREEMENT) {
+                    StatusSingle = CompressedSecretAgreement(SecretKey[i], PublicKey[i], OutputSingle);
+                } else {
+                    StatusSingle = SecretAgreement(SecretKey[i], PublicKey[i], OutputSingle);
+                }
+                if (Jobs[i].Status != StatusSingle || (StatusSingle == ECCRYPTO_SUCCESS) == (i/4 == bad) || memcmp(Output[i], OutputSingle, 32) != 0) { passed = 0; break; }
+            }
+        }
+    }
+    if (passed==1) printf("  Asynchronous job tests............................................................ PASSED");
+    else { printf("  Asynchronous job tests... FAILED"); printf("\n"); Status = ECCRYPTO_ERROR; }
+    printf("\n");
+
+cleanup:
+    fourq_async_destroy(Async);
+    return Status;
+}
+
+
+ECCRYPTO_STATUS async_run()
+{ // Benchmark asynchronous jobs
+    int n;
+    unsigned long long cycles, cycles1, cycles2;
+    unsigned int i;
+    unsigned char SecretKey[8][32], PublicKey[8][32], Shared[8][32];
+    fourq_job Jobs[8], *pJobs[8], *Completed[8];
+    fourq_async* Async = NULL;
+    ECCRYPTO_STATUS Status = ECCRYPTO_SUCCESS;
+
+    printf("\n--------------------------------------------------------------------------------------------------------\n\n");
+    printf("Benchmarking asynchronous jobs: \n\n");
+
+    Status = fourq_async_create(1, &Async);
+    if (Status != ECCRYPTO_SUCCESS) {
+        return Status;
+    }
+
+    memset(Jobs, 0, sizeof(Jobs));
+    for (i = 0; i < 8; i++) {
+        Status = CompressedKeyGeneration(SecretKey[i], PublicKey[i]);
+        if (Status != ECCRYPTO_SUCCESS) goto cleanup;
+        Jobs[i].Type = FOURQ_JOB_COMPRESSED_AGREEMENT;
+        Jobs[i].SecretKey = SecretKey[i];
+        Jobs[i].PublicKey = PublicKey[(i+1) % 8];
+        Jobs[i].SharedSecret = Shared[i];
+        pJobs[i] = &Jobs[i];
+    }
+
+    cycles = 0;
+    for (n = 0; n < BENCH_LOOPS/8; n++)
+    {
+        cycles1 = cpucycles();
+        Status = fourq_async_submit(Async, pJobs, 8);
+        if (Status != ECCRYPTO_SUCCESS) goto cleanup;
+        Status = async_wait(Async, 8, Completed);
+        if (Status != ECCRYPTO_SUCCESS) goto cleanup;
+        cycles2 = cpucycles();
+        cycles = cycles + (cycles2 - cycles1);
+    }
+    printf("  Asynchronous secret agreement (compressed keys) runs in ......................... %8lld ", cycles/((BENCH_LOOPS/8)*8)); print_unit;
+    printf(" per agreement, including submission and completion\n");
+
+cleanup:
+    fourq_async_destroy(Async);
+    return Status;
 }
 
+#endif
+
 
 ECCRYPTO_STATUS hash2curve_test()
 { // Test hashing to FourQ
@@ -404,6 +1783,293 @@ ECCRYPTO_STATUS hash2curve_run()
 }
 
 
+ECCRYPTO_STATUS random_test()
+{ // Test the generation of random values
+    int n, passed;
+    unsigned int i, len;
+    unsigned char Value[3][64], Zero[64] = {0};
+#if defined(__LINUX__)
+    int fd[2];
+    pid_t pid;
+#endif
+    ECCRYPTO_STATUS Status = ECCRYPTO_SUCCESS;
+
+    printf("\n--------------------------------------------------------------------------------------------------------\n\n");
+    printf("Testing random value generation: \n\n");
+
+    passed = 1;
+    for (n = 0; n < 2*TEST_LOOPS && passed == 1; n++)     // Crosses several buffer refills with outputs of different lengths
+    {
+        len = 1 + n % 64;
+        if (random_bytes_drbg(Value[0], len) == false || random_bytes_drbg(Value[1], len) == false) {
+            return ECCRYPTO_ERROR;
+        }
+        if (len >= 16 && (memcmp(Value[0], Value[1], len) == 0 || memcmp(Value[0], Zero, len) == 0)) passed = 0;
+    }
+    for (i = 0; i < (1024*1024)/64 && passed == 1; i++)   // Crosses a reseed
+    {
+        if (random_bytes_drbg(Value[0], 64) == false) {
+            return ECCRYPTO_ERROR;
+        }
+    }
+
+#if defined(__LINUX__)
+    // Parent and child processes must not produce the same values after fork()
+    if (passed == 1) {
+        if (pipe(fd) != 0) {
+            return ECCRYPTO_ERROR;
+        }
+        pid = fork();
+        if (pid < 0) {
+            return ECCRYPTO_ERROR;
+        }
+        if (pid == 0) {
+            random_bytes_drbg(Value[2], 64);
+            _exit(write(fd[1], Value[2], 64) == 64 ? 0 : 1);
+        }
+        random_bytes_drbg(Value[0], 64);
+        if (read(fd[0], Value[2], 64) != 64) passed = 0;
+        waitpid(pid, NULL, 0);
+        close(fd[0]); close(fd[1]);
+        if (memcmp(Value[0], Value[2], 64) == 0) passed = 0;
+    }
+#endif
+    if (passed==1) printf("  Random value generation tests.................................................... PASSED");
+    else { printf("  Random value generation tests... FAILED"); printf("\n"); Status = ECCRYPTO_ERROR; }
+    printf("\n");
+
+    return Status;
+}
+
+
+ECCRYPTO_STATUS random_run()
+{ // Benchmark the generation of random values
+    int n;
+    unsigned long long cycles, cycles1, cycles2;
+    unsigned char Value[32];
+
+    printf("\n--------------------------------------------------------------------------------------------------------\n\n");
+    printf("Benchmarking random value generation: \n\n");
+
+    cycles = 0;
+    for (n = 0; n < BENCH_LOOPS; n++)
+    {
+        cycles1 = cpucycles();
+        random_bytes(Value, 32);
+        cycles2 = cpucycles();
+        cycles = cycles + (cycles2 - cycles1);
+    }
+    printf("  Generation of 32 random bytes from the OS runs in .............................. %8lld ", cycles/BENCH_LOOPS); print_unit;
+    printf("\n");
+
+    cycles = 0;
+    for (n = 0; n < BENCH_LOOPS; n++)
+    {
+        cycles1 = cpucycles();
+        random_bytes_drbg(Value, 32);
+        cycles2 = cpucycles();
+        cycles = cycles + (cycles2 - cycles1);
+    }
+    printf("  Generation of 32 random bytes with the DRBG runs in ............................ %8lld ", cycles/BENCH_LOOPS); print_unit;
+    printf("\n");
+
+    return ECCRYPTO_SUCCESS;
+}
+
+
+#if defined(__LINUX__)
+
+#define PROBE_STACK_SIZE      (64*1024) // Size of the stack on which the stack usage of the API functions is measured
+#define PROBE_BATCH_SIZE      16        // Number of items per batch in the stack usage tests
+#define PROBE_PATTERN         0xA5      // Initial value of the bytes of the stack
+
+static unsigned char probe_stack[PROBE_STACK_SIZE];
+static ucontext_t probe_context, caller_context;
+static ECCRYPTO_STATUS (*probe_function)(void);
+static ECCRYPTO_STATUS probe_status;
+
+// Inputs and outputs of the functions measured by stack_usage_test(), which are kept out of the measured stack
+static unsigned char probe_sk[3][32], probe_pk[3][64], probe_msg[64], probe_sig[2][64], probe_shared[PROBE_BATCH_SIZE][32];
+static SchnorrQ_ExpandedSecretKey probe_expanded;
+static SchnorrQ_PreparedPublicKey probe_prepared;
+static ECDH_PreparedPublicKey probe_ecdh_prepared;
+static unsigned char *probe_sks[PROBE_BATCH_SIZE], *probe_pks[PROBE_BATCH_SIZE], *probe_ss[PROBE_BATCH_SIZE];
+static const unsigned char *probe_batch_pk[PROBE_BATCH_SIZE], *probe_batch_msg[PROBE_BATCH_SIZE], *probe_batch_sig[PROBE_BATCH_SIZE];
+static unsigned int probe_batch_len[PROBE_BATCH_SIZE], probe_valid[PROBE_BATCH_SIZE];
+static ECCRYPTO_STATUS probe_statuses[PROBE_BATCH_SIZE];
+static unsigned char probe_keys[PROBE_BATCH_SIZE][2][64];
+static void* probe_workspace;
+static size_t probe_workspace_size;
+static f2elm_t probe_f2elm;
+
+
+static void probe_entry(void)
+{ // Entry point of the context that runs probe_function() on probe_stack
+    probe_status = probe_function();
+}
+
+
+static size_t stack_usage(ECCRYPTO_STATUS (*function)(void), ECCRYPTO_STATUS* Status)
+{ // Run function() on a stack filled with PROBE_PATTERN and return the number of bytes of the stack that were written, i.e., the
+  // high-water mark of the stack usage of function() and the context switch
+    size_t i;
+
+    memset(probe_stack, PROBE_PATTERN, sizeof(probe_stack));
+    if (getcontext(&probe_context) != 0) {
+        *Status = ECCRYPTO_ERROR;
+        return 0;
+    }
+    probe_context.uc_stack.ss_sp = probe_stack;
+    probe_context.uc_stack.ss_size = sizeof(probe_stack);
+    probe_context.uc_link = &caller_context;
+    makecontext(&probe_context, probe_entry, 0);
+    probe_function = function;
+    if (swapcontext(&caller_context, &probe_context) != 0) {
+        *Status = ECCRYPTO_ERROR;
+        return 0;
+    }
+    *Status = probe_status;
+
+    for (i = 0; i < sizeof(probe_stack) && probe_stack[i] == PROBE_PATTERN; i++) {}    // The stack grows downwards
+    return sizeof(probe_stack) - i;
+}
+
+
+static ECCRYPTO_STATUS probe_keygen(void)
+{ // SchnorrQ and DH key generation, bounded by FOURQ_STACK_KEYGEN
+    ECCRYPTO_STATUS Status;
+
+    Status = SchnorrQ_FullKeyGeneration(probe_sk[0], probe_pk[0]);
+    if (Status == ECCRYPTO_SUCCESS) Status = SchnorrQ_ExpandSecretKey(probe_sk[0], &probe_expanded);
+    if (Status == ECCRYPTO_SUCCESS) Status = CompressedKeyGeneration(probe_sk[1], probe_pk[1]);
+    if (Status == ECCRYPTO_SUCCESS) Status = KeyGeneration(probe_sk[2], probe_pk[2]);
+    return Status;
+}
+
+
+static ECCRYPTO_STATUS probe_sign(void)
+{ // SchnorrQ signing, bounded by FOURQ_STACK_SIGN
+    ECCRYPTO_STATUS Status;
+
+    Status = SchnorrQ_Sign(probe_sk[0], probe_pk[0], probe_msg, sizeof(probe_msg), probe_sig[0]);
+    if (Status == ECCRYPTO_SUCCESS) Status = SchnorrQ_SignExpanded(&probe_expanded, probe_msg, sizeof(probe_msg), probe_sig[1]);
+    if (Status == ECCRYPTO_SUCCESS) Status = SchnorrQph_Sign(probe_sk[0], probe_pk[0], probe_msg, sizeof(probe_msg), probe_sig[1]);
+    return Status;
+}
+
+
+static ECCRYPTO_STATUS probe_verify(void)
+{ // SchnorrQ verification, bounded by FOURQ_STACK_VERIFY
+    ECCRYPTO_STATUS Status;
+
+    Status = SchnorrQ_Verify(probe_pk[0], probe_msg, sizeof(probe_msg), probe_sig[0], &probe_valid[0]);
+    if (Status == ECCRYPTO_SUCCESS) Status = SchnorrQph_Verify(probe_pk[0], probe_msg, sizeof(probe_msg), probe_sig[1], &probe_valid[1]);
+    if (Status == ECCRYPTO_SUCCESS) Status = SchnorrQ_PreparePublicKey(probe_pk[0], &probe_prepared);
+    if (Status == ECCRYPTO_SUCCESS) Status = SchnorrQ_VerifyPrepared(&probe_prepared, probe_msg, sizeof(probe_msg), probe_sig[0], &probe_valid[2]);
+    if (Status == ECCRYPTO_SUCCESS && (probe_valid[0] != 1 || probe_valid[1] != 1 || probe_valid[2] != 1)) Status = ECCRYPTO_ERROR_SIGNATURE_VERIFICATION;
+    return Status;
+}
+
+
+static ECCRYPTO_STATUS probe_agreement(void)
+{ // DH secret agreements, bounded by FOURQ_STACK_AGREEMENT
+    ECCRYPTO_STATUS Status;
+
+    Status = CompressedSecretAgreement(probe_sk[1], probe_pk[1], probe_shared[0]);
+    if (Status == ECCRYPTO_SUCCESS) Status = SecretAgreement(probe_sk[2], probe_pk[2], probe_shared[1]);
+    if (Status == ECCRYPTO_SUCCESS) Status = PrepareECDHPublicKey(probe_pk[1], &probe_ecdh_prepared);
+    if (Status == ECCRYPTO_SUCCESS) Status = SecretAgreementPrepared(probe_sk[1], &probe_ecdh_prepared, probe_shared[2]);
+    if (Status == ECCRYPTO_SUCCESS && memcmp(probe_shared[0], probe_shared[2], 32) != 0) Status = ECCRYPTO_ERROR_SHARED_KEY;
+    return Status;
+}
+
+
+static ECCRYPTO_STATUS probe_batch(void)
+{ // Batched key generation, secret agreements and verification, bounded by FOURQ_STACK_BATCH
+    ECCRYPTO_STATUS Status;
+
+    Status = KeyGenerationBatch(probe_sks, probe_pks, PROBE_BATCH_SIZE);
+    if (Status == ECCRYPTO_SUCCESS) Status = SecretAgreementBatch((const unsigned char**)probe_sks, (const unsigned char**)probe_pks, probe_ss, PROBE_BATCH_SIZE, probe_statuses);
+    if (Status == ECCRYPTO_SUCCESS) Status = SecretAgreementMany(probe_sk[2], (const unsigned char**)probe_pks, probe_ss, PROBE_BATCH_SIZE, probe_statuses);
+    if (Status == ECCRYPTO_SUCCESS) Status = SchnorrQ_VerifyBatchWorkspace(probe_batch_pk, probe_batch_msg, probe_batch_len, probe_batch_sig, PROBE_BATCH_SIZE, probe_valid, probe_workspace, probe_workspace_size);
+    return Status;
+}
+
+
+static ECCRYPTO_STATUS probe_hash_to_curve(void)
+{ // Hashing to FourQ, bounded by FOURQ_STACK_HASH_TO_CURVE
+    point_t P;
+
+    return HashToCurve(probe_f2elm, P);
+}
+
+
+ECCRYPTO_STATUS stack_usage_test()
+{ // Test that the stack usage of the API functions is within the bounds published in FourQ_api.h
+    static const struct {
+        const char* name;
+        ECCRYPTO_STATUS (*function)(void);
+        size_t bound;
+    } probes[] = {
+        { "key generation", probe_keygen, FOURQ_STACK_KEYGEN },                     // Must be the first one, it generates the keys of the others
+        { "signing", probe_sign, FOURQ_STACK_SIGN },
+        { "verification", probe_verify, FOURQ_STACK_VERIFY },
+        { "secret agreement", probe_agreement, FOURQ_STACK_AGREEMENT },
+        { "batch functions", probe_batch, FOURQ_STACK_BATCH },
+        { "hashing to FourQ", probe_hash_to_curve, FOURQ_STACK_HASH_TO_CURVE }
+    };
+    unsigned int i, passed;
+    size_t used;
+    ECCRYPTO_STATUS Status = ECCRYPTO_SUCCESS;
+
+    printf("\n--------------------------------------------------------------------------------------------------------\n\n");
+    printf("Testing stack usage: \n\n");
+
+    RandomBytesFunction(probe_msg, sizeof(probe_msg));
+    RandomBytesFunction((unsigned char*)probe_f2elm, sizeof(f2elm_t));
+    mod1271(probe_f2elm[0]);
+    mod1271(probe_f2elm[1]);
+    for (i = 0; i < PROBE_BATCH_SIZE; i++) {
+        probe_sks[i] = probe_keys[i][0];
+        probe_pks[i] = probe_keys[i][1];
+        probe_ss[i] = probe_shared[i];
+        probe_batch_pk[i] = probe_pk[0];
+        probe_batch_msg[i] = probe_msg;
+        probe_batch_len[i] = sizeof(probe_msg);
+        probe_batch_sig[i] = probe_sig[0];
+    }
+    probe_workspace_size = SchnorrQ_VerifyBatchWorkspaceSize(PROBE_BATCH_SIZE);
+    probe_workspace = malloc(probe_workspace_size);
+    if (probe_workspace == NULL) {
+        return ECCRYPTO_ERROR_NO_MEMORY;
+    }
+
+    passed = 1;
+    for (i = 0; i < sizeof(probes)/sizeof(probes[0]); i++) {
+        used = stack_usage(probes[i].function, &Status);
+        if (Status != ECCRYPTO_SUCCESS) {
+            break;
+        }
+        printf("  Stack usage of %-20s %5u bytes (bound %5u bytes)\n", probes[i].name, (unsigned int)used, (unsigned int)probes[i].bound);
+        if (used > probes[i].bound) {
+            passed = 0;
+        }
+    }
+    free(probe_workspace);
+    if (Status != ECCRYPTO_SUCCESS) {
+        return Status;
+    }
+
+    if (passed==1) printf("  Stack usage tests................................................................ PASSED");
+    else { printf("  Stack usage tests... FAILED"); printf("\n"); Status = ECCRYPTO_ERROR; }
+    printf("\n");
+
+    return Status;
+}
+
+#endif
+
+
 int main()
 {
     ECCRYPTO_STATUS Status = ECCRYPTO_SUCCESS;
@@ -419,6 +2085,40 @@ int main()
         return false;
     }
 
+    Status = SchnorrQ_stream_test();  // Test SchnorrQ streaming verification
+    if (Status != ECCRYPTO_SUCCESS) {
+        printf("\n\n   Error detected: %s \n\n", FourQ_get_error_message(Status));
+        return false;
+    }
+
+    Status = SchnorrQph_test();       // Test pre-hashed SchnorrQ variant
+    if (Status != ECCRYPTO_SUCCESS) {
+        printf("\n\n   Error detected: %s \n\n", FourQ_get_error_message(Status));
+        return false;
+    }
+
+    Status = hash_test();             // Test single-buffer and multi-buffer hashing
+    if (Status != ECCRYPTO_SUCCESS) {
+        printf("\n\n   Error detected: %s \n\n", FourQ_get_error_message(Status));
+        return false;
+    }
+    Status = hash_run();              // Benchmark single-buffer and multi-buffer hashing
+    if (Status != ECCRYPTO_SUCCESS) {
+        printf("\n\n   Error detected: %s \n\n", FourQ_get_error_message(Status));
+        return false;
+    }
+
+    Status = SchnorrQ_batch_test();   // Test SchnorrQ batch verification
+    if (Status != ECCRYPTO_SUCCESS) {
+        printf("\n\n   Error detected: %s \n\n", FourQ_get_error_message(Status));
+        return false;
+    }
+    Status = SchnorrQ_batch_run();    // Benchmark SchnorrQ batch verification
+    if (Status != ECCRYPTO_SUCCESS) {
+        printf("\n\n   Error detected: %s \n\n", FourQ_get_error_message(Status));
+        return false;
+    }
+
     Status = compressedkex_test();    // Test Diffie-Hellman key exchange using compressed public keys
     if (Status != ECCRYPTO_SUCCESS) {
         printf("\n\n   Error detected: %s \n\n", FourQ_get_error_message(Status));
@@ -441,6 +2141,73 @@ int main()
         return false;
     }
     
+    Status = keygen_batch_test();     // Test batched keypair generation
+    if (Status != ECCRYPTO_SUCCESS) {
+        printf("\n\n   Error detected: %s \n\n", FourQ_get_error_message(Status));
+        return false;
+    }
+    Status = keygen_batch_run();      // Benchmark batched keypair generation
+    if (Status != ECCRYPTO_SUCCESS) {
+        printf("\n\n   Error detected: %s \n\n", FourQ_get_error_message(Status));
+        return false;
+    }
+    
+    Status = kex_batch_test();        // Test batched Diffie-Hellman secret agreements
+    if (Status != ECCRYPTO_SUCCESS) {
+        printf("\n\n   Error detected: %s \n\n", FourQ_get_error_message(Status));
+        return false;
+    }
+    Status = kex_batch_run();         // Benchmark batched Diffie-Hellman secret agreements
+    if (Status != ECCRYPTO_SUCCESS) {
+        printf("\n\n   Error detected: %s \n\n", FourQ_get_error_message(Status));
+        return false;
+    }
+    Status = kex_many_test();         // Test Diffie-Hellman secret agreements with a single secret key
+    if (Status != ECCRYPTO_SUCCESS) {
+        printf("\n\n   Error detected: %s \n\n", FourQ_get_error_message(Status));
+        return false;
+    }
+    Status = kex_many_run();          // Benchmark Diffie-Hellman secret agreements with a single secret key
+    if (Status != ECCRYPTO_SUCCESS) {
+        printf("\n\n   Error detected: %s \n\n", FourQ_get_error_message(Status));
+        return false;
+    }
+    
+    Status = random_test();           // Test generation of random values
+    if (Status != ECCRYPTO_SUCCESS) {
+        printf("\n\n   Error detected: %s \n\n", FourQ_get_error_message(Status));
+        return false;
+    }
+    Status = random_run();            // Benchmark generation of random values
+    if (Status != ECCRYPTO_SUCCESS) {
+        printf("\n\n   Error detected: %s \n\n", FourQ_get_error_message(Status));
+        return false;
+    }
+    
+#if defined(THREADS_SUPPORT)
+    Status = parallel_test();         // Test multithreaded batch functions
+    if (Status != ECCRYPTO_SUCCESS) {
+        printf("\n\n   Error detected: %s \n\n", FourQ_get_error_message(Status));
+        return false;
+    }
+    Status = parallel_run();          // Benchmark multithreaded batch functions
+    if (Status != ECCRYPTO_SUCCESS) {
+        printf("\n\n   Error detected: %s \n\n", FourQ_get_error_message(Status));
+        return false;
+    }
+    
+    Status = async_test();            // Test asynchronous jobs
+    if (Status != ECCRYPTO_SUCCESS) {
+        printf("\n\n   Error detected: %s \n\n", FourQ_get_error_message(Status));
+        return false;
+    }
+    Status = async_run();             // Benchmark asynchronous jobs
+    if (Status != ECCRYPTO_SUCCESS) {
+        printf("\n\n   Error detected: %s \n\n", FourQ_get_error_message(Status));
+        return false;
+    }
+#endif
+    
     Status = hash2curve_test();       // Test hash to FourQ function
     if (Status != ECCRYPTO_SUCCESS) {
         printf("\n\n   Error detected: %s \n\n", FourQ_get_error_message(Status));
@@ -452,5 +2219,13 @@ int main()
         return false;
     }
 
+#if defined(__LINUX__)
+    Status = stack_usage_test();      // Test stack usage against the bounds in FourQ_api.h
+    if (Status != ECCRYPTO_SUCCESS) {
+        printf("\n\n   Error detected: %s \n\n", FourQ_get_error_message(Status));
+        return false;
+    }
+#endif
+
     return true;
 }
\ No newline at end of file
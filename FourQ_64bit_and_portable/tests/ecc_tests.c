@@ -11,6 +11,8 @@
 #include "../FourQ_tables.h"
 #include "test_extras.h"
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
 
 // Benchmark and test parameters  
@@ -22,6 +24,9 @@
     #define SHORT_BENCH_LOOPS 10000
 #endif
 #define TEST_LOOPS            1000       // Number of iterations per test
+#define MULTI_TEST_LOOPS      10         // Number of iterations per multi-scalar multiplication test
+#define MULTI_BENCH_LOOPS     100        // Number of iterations per multi-scalar multiplication bench
+#define MULTI_MAX_POINTS      128        // Maximum number of points for multi-scalar multiplication tests
 
 
 bool ecc_test()
@@ -37,7 +42,7 @@ bool ecc_test()
 
     
     printf("\n--------------------------------------------------------------------------------------------------------\n\n"); 
-    printf("Testing FourQ's curve arithmetic: \n\n"); 
+    printf("Testing FourQ's curve arithmetic (%s backend): \n\n", FourQ_get_backend_name(FourQ_get_backend())); 
 
     // Point doubling
     passed = 1;
@@ -240,6 +245,119 @@ bool ecc_test()
     if (passed==1) printf("  Scalar multiplication tests ............................................................. PASSED");
     else { printf("  Scalar multiplication tests ... FAILED"); printf("\n"); return false; }
     printf("\n");
+
+    {
+    point_t PP[4], RR[4], UU;
+    uint64_t k[4*4];
+    unsigned int j;
+
+    // 4-way scalar multiplication
+    for (j=0; j<4; j++) {
+        eccset(PP[j]);
+        random_scalar_test(k);
+        ecc_mul(PP[j], (digit_t*)k, PP[j], false);
+    }
+
+    for (n=0; n<TEST_LOOPS; n++)
+    {
+        clear_cofactor = (n & 1);
+        for (j=0; j<4; j++) {
+            random_scalar_test(&k[4*j]);
+        }
+        if (ecc_mul_x4(PP, (digit_t*)k, RR, clear_cofactor) == false) { passed=0; break; }
+
+        for (j=0; j<4; j++) {
+            ecc_mul(PP[j], (digit_t*)&k[4*j], UU, clear_cofactor);
+            if (fp2compare64((uint64_t*)UU->x,(uint64_t*)RR[j]->x)!=0 || fp2compare64((uint64_t*)UU->y,(uint64_t*)RR[j]->y)!=0) { passed=0; break; }
+            fp2copy1271(RR[j]->x, PP[j]->x);
+            fp2copy1271(RR[j]->y, PP[j]->y);
+        }
+        if (passed==0) break;
+    }
+
+    if (passed==1) printf("  4-way scalar multiplication tests ....................................................... PASSED");
+    else { printf("  4-way scalar multiplication tests ... FAILED"); printf("\n"); return false; }
+    printf("\n");
+    }
+
+    {
+    point_t PP[8], RR[8], UU;
+    uint64_t k[8*4];
+    unsigned int j;
+
+    // 8-way scalar multiplication
+    for (j=0; j<8; j++) {
+        eccset(PP[j]);
+        random_scalar_test(k);
+        ecc_mul(PP[j], (digit_t*)k, PP[j], false);
+    }
+
+    for (n=0; n<TEST_LOOPS; n++)
+    {
+        clear_cofactor = (n & 1);
+        for (j=0; j<8; j++) {
+            random_scalar_test(&k[4*j]);
+        }
+        if (ecc_mul_x8(PP, (digit_t*)k, RR, clear_cofactor) == false) { passed=0; break; }
+
+        for (j=0; j<8; j++) {
+            ecc_mul(PP[j], (digit_t*)&k[4*j], UU, clear_cofactor);
+            if (fp2compare64((uint64_t*)UU->x,(uint64_t*)RR[j]->x)!=0 || fp2compare64((uint64_t*)UU->y,(uint64_t*)RR[j]->y)!=0) { passed=0; break; }
+            fp2copy1271(RR[j]->x, PP[j]->x);
+            fp2copy1271(RR[j]->y, PP[j]->y);
+        }
+        if (passed==0) break;
+    }
+
+    if (passed==1) printf("  8-way scalar multiplication tests ....................................................... PASSED");
+    else { printf("  8-way scalar multiplication tests ... FAILED"); printf("\n"); return false; }
+    printf("\n");
+    }
+
+    {
+    point_t PP[8], RR[8], SS[8], AA, B, C, D, E, F;
+    uint64_t k[8*4], l[4];
+    unsigned int j;
+    FourQ_BACKEND backend, default_backend = FourQ_get_backend();
+
+    // Backend selection: the results of every backend supported by the CPU and the build must match those of the default backend
+    for (n=0; n<TEST_LOOPS/10; n++)
+    {
+        FourQ_set_backend(default_backend);
+        for (j=0; j<8; j++) {
+            eccset(PP[j]);
+            random_scalar_test(&k[4*j]);
+            ecc_mul(PP[j], (digit_t*)&k[4*j], PP[j], false);
+            random_scalar_test(&k[4*j]);
+        }
+        random_scalar_test(l);
+        ecc_mul(PP[0], (digit_t*)k, AA, false);
+        ecc_mul_fixed((digit_t*)k, B);
+        ecc_mul_double((digit_t*)k, PP[0], (digit_t*)l, C);
+        ecc_mul_x8(PP, (digit_t*)k, RR, false);
+
+        for (backend = FOURQ_BACKEND_GENERIC; backend < FOURQ_BACKEND_END_OF_LIST; backend++) {
+            if (FourQ_set_backend(backend) != ECCRYPTO_SUCCESS) continue;
+            ecc_mul(PP[0], (digit_t*)k, D, false);
+            ecc_mul_fixed((digit_t*)k, E);
+            ecc_mul_double((digit_t*)k, PP[0], (digit_t*)l, F);
+            if (fp2compare64((uint64_t*)AA->x,(uint64_t*)D->x)!=0 || fp2compare64((uint64_t*)AA->y,(uint64_t*)D->y)!=0) { passed=0; break; }
+            if (fp2compare64((uint64_t*)B->x,(uint64_t*)E->x)!=0 || fp2compare64((uint64_t*)B->y,(uint64_t*)E->y)!=0) { passed=0; break; }
+            if (fp2compare64((uint64_t*)C->x,(uint64_t*)F->x)!=0 || fp2compare64((uint64_t*)C->y,(uint64_t*)F->y)!=0) { passed=0; break; }
+            ecc_mul_x8(PP, (digit_t*)k, SS, false);
+            for (j=0; j<8; j++) {
+                if (fp2compare64((uint64_t*)RR[j]->x,(uint64_t*)SS[j]->x)!=0 || fp2compare64((uint64_t*)RR[j]->y,(uint64_t*)SS[j]->y)!=0) { passed=0; break; }
+            }
+            if (passed==0) break;
+        }
+        if (passed==0) break;
+    }
+    FourQ_set_backend(default_backend);
+
+    if (passed==1) printf("  Backend selection tests ................................................................. PASSED");
+    else { printf("  Backend selection tests ... FAILED"); printf("\n"); return false; }
+    printf("\n");
+    }
  
     {    
     point_t AA, B, C; 
@@ -284,6 +402,61 @@ bool ecc_test()
     else { printf("  Fixed-base scalar multiplication tests ... FAILED"); printf("\n"); return false; }
     printf("\n");
     }
+
+    {
+    point_t QQ[2*NPOINTS_FIXEDBASE_BATCH+1], RR;
+    uint64_t k[4*(2*NPOINTS_FIXEDBASE_BATCH+1)];
+    unsigned int j, npoints;
+
+    // Batched fixed-base scalar multiplication, including partial groups
+    for (n=0; n<TEST_LOOPS/10; n++)
+    {
+        npoints = 1 + (n % (2*NPOINTS_FIXEDBASE_BATCH+1));
+        for (j=0; j<npoints; j++) {
+            random_scalar_test(&k[4*j]);
+        }
+        ecc_mul_fixed_batch((digit_t*)k, QQ, npoints);
+
+        for (j=0; j<npoints; j++) {
+            ecc_mul_fixed((digit_t*)&k[4*j], RR);
+            if (fp2compare64((uint64_t*)QQ[j]->x,(uint64_t*)RR->x)!=0 || fp2compare64((uint64_t*)QQ[j]->y,(uint64_t*)RR->y)!=0) { passed=0; break; }
+        }
+        if (passed==0) break;
+    }
+
+    if (passed==1) printf("  Batched fixed-base scalar multiplication tests .......................................... PASSED");
+    else { printf("  Batched fixed-base scalar multiplication tests ... FAILED"); printf("\n"); return false; }
+    printf("\n");
+    }
+
+    {
+    point_fixedbase_t Table[NPOINTS_FIXEDBASE];
+    point_extproj_t R;
+    point_t AA, BB, CC;
+
+    // Comb tables of arbitrary points: the table of G is FIXED_BASE_TABLE, and the table of k*G gives the same results as variable-base scalar multiplication
+    eccset(AA);
+    point_setup(AA, R);
+    ecc_prepare_fixed(R, Table);
+    if (memcmp(Table, FIXED_BASE_TABLE, sizeof(Table)) != 0) passed=0;
+
+    for (n=0; n<TEST_LOOPS/10 && passed==1; n++)
+    {
+        random_scalar_test(scalar); 
+        ecc_mul_fixed((digit_t*)scalar, AA);
+        point_setup(AA, R);
+        ecc_prepare_fixed(R, Table);
+        random_scalar_test(scalar); 
+        ecc_mul_fixed_table(Table, (digit_t*)scalar, BB);
+        ecc_mul(AA, (digit_t*)scalar, CC, false);
+        
+        if (fp2compare64((uint64_t*)BB->x,(uint64_t*)CC->x)!=0 || fp2compare64((uint64_t*)BB->y,(uint64_t*)CC->y)!=0) { passed=0; break; }
+    }
+
+    if (passed==1) printf("  Fixed-base scalar multiplication with prepared tables tests ............................. PASSED");
+    else { printf("  Fixed-base scalar multiplication with prepared tables tests ... FAILED"); printf("\n"); return false; }
+    printf("\n");
+    }
      
     {    
     point_t PP, QQ, RR, UU, TT; 
@@ -324,6 +497,98 @@ bool ecc_test()
     printf("\n");
     }
 
+    {
+    point_t PP[MULTI_MAX_POINTS], RR, UU, TT;
+    point_extproj_precomp_t AA;
+    point_extproj_t BB;
+    uint64_t k[4*MULTI_MAX_POINTS], kk[4];
+    unsigned int i, j, npoints[5] = {1, 7, NPOINTS_MULTI_PIPPENGER-1, NPOINTS_MULTI_PIPPENGER, MULTI_MAX_POINTS};
+    size_t size = ecc_mul_multi_workspace_size(MULTI_MAX_POINTS);
+    unsigned char* workspace = (unsigned char*)malloc(size + 1);
+
+    // Multi-scalar multiplication, with a workspace sized for the maximum number of points at an odd address
+    passed = (workspace != NULL);
+    for (i=0; i<5 && passed==1; i++)
+    {
+        for (n=0; n<MULTI_TEST_LOOPS; n++)
+        {
+            for (j=0; j<npoints[i]; j++) {
+                eccset(PP[j]);
+                random_scalar_test(kk);
+                ecc_mul(PP[j], (digit_t*)kk, PP[j], false);
+                random_scalar_test(&k[4*j]);
+            }
+            if (n == 0) {
+                k[0] = k[1] = k[2] = k[3] = 0;                 // Zero scalar
+            }
+            if (ecc_mul_multi_workspace(PP, (digit_t*)k, npoints[i], RR, workspace+1, size) == false) { passed=0; break; }
+#if !defined(FOURQ_NO_MALLOC)
+            if (ecc_mul_multi(PP, (digit_t*)k, npoints[i], TT) == false) { passed=0; break; }
+            if (fp2compare64((uint64_t*)TT->x,(uint64_t*)RR->x)!=0 || fp2compare64((uint64_t*)TT->y,(uint64_t*)RR->y)!=0) { passed=0; break; }
+#endif
+            if (size > 0 && ecc_mul_multi_workspace(PP, (digit_t*)k, MULTI_MAX_POINTS, TT, workspace, size-1) == true) { passed=0; break; }
+
+            fp2zero1271(BB->x);                                // BB = neutral point
+            fp2zero1271(BB->y); BB->y[0][0] = 1;
+            fp2zero1271(BB->z); BB->z[0][0] = 1;
+            fp2zero1271(BB->ta);
+            fp2zero1271(BB->tb); BB->tb[0][0] = 1;
+            for (j=0; j<npoints[i]; j++) {
+                ecc_mul(PP[j], (digit_t*)&k[4*j], UU, false);
+                fp2add1271(UU->x, UU->y, AA->xy); 
+                fp2sub1271(UU->y, UU->x, AA->yx); 
+                fp2mul1271(UU->x, UU->y, AA->t2);    
+                fp2add1271(AA->t2, AA->t2, AA->t2); 
+                fp2mul1271(AA->t2, (felm_t*)&PARAMETER_d, AA->t2); 
+                fp2zero1271(AA->z2); AA->z2[0][0] = 2;
+                eccadd(AA, BB);
+            }
+            eccnorm(BB, TT);
+        
+            if (fp2compare64((uint64_t*)TT->x,(uint64_t*)RR->x)!=0 || fp2compare64((uint64_t*)TT->y,(uint64_t*)RR->y)!=0) { passed=0; break; }
+        }
+    }
+    free(workspace);
+
+    if (passed==1) printf("  Multi-scalar multiplication tests ....................................................... PASSED");
+    else { printf("  Multi-scalar multiplication tests ... FAILED"); printf("\n"); return false; }
+    printf("\n");
+    }
+
+#if defined(OPCOUNT_SUPPORT)
+    {
+    point_t PP, RR;
+    uint64_t k[4], l[4];
+    FourQ_OpCounts counts;
+
+    // Operation counts: fixed-base comb costs and a single inversion per scalar multiplication
+    eccset(PP);
+    random_scalar_test(k); 
+    random_scalar_test(l); 
+
+    FourQ_reset_opcounts();
+    ecc_mul_fixed((digit_t*)k, RR);
+    if (FourQ_get_opcounts(&counts) != ECCRYPTO_SUCCESS) { passed=0; }
+    if (counts.fp2inv != 1 || counts.table_lookup_fixed_base != D_FIXEDBASE || counts.eccmadd != D_FIXEDBASE-1 || counts.eccdouble != E_FIXEDBASE-1 || counts.eccadd != 0) { passed=0; }
+
+    FourQ_reset_opcounts();
+    ecc_mul(PP, (digit_t*)k, RR, false);
+    FourQ_get_opcounts(&counts);
+    if (counts.fp2inv != 1) { passed=0; }
+
+#if defined(USE_ENDO)
+    FourQ_reset_opcounts();                                    // Without endomorphisms, ecc_mul_double() normalizes k*G and l*Q separately
+    ecc_mul_double((digit_t*)k, RR, (digit_t*)l, PP);
+    FourQ_get_opcounts(&counts);
+    if (counts.fp2inv != 1) { passed=0; }
+#endif
+
+    if (passed==1) printf("  Operation count tests ................................................................... PASSED");
+    else { printf("  Operation count tests ... FAILED"); printf("\n"); return false; }
+    printf("\n");
+    }
+#endif
+
     return OK;
 }
 
@@ -584,6 +849,54 @@ bool ecc_run()
     
     printf("  Scalar multiplication (including clearing cofactor) runs in ...  %8lld ", cycles/SHORT_BENCH_LOOPS); print_unit;
     printf("\n"); 
+
+    {
+    point_t PP[4], RR[4];
+    uint64_t k[4*4];
+    unsigned int j;
+
+    // 4-way scalar multiplication
+    for (j=0; j<4; j++) {
+        eccset(PP[j]);
+        random_scalar_test(&k[4*j]);
+    }
+
+    cycles = 0;
+    for (n=0; n<SHORT_BENCH_LOOPS; n++)
+    {
+        cycles1 = cpucycles();
+        ecc_mul_x4(PP, (digit_t*)k, RR, true);
+        cycles2 = cpucycles();
+        cycles = cycles+(cycles2-cycles1);
+    }
+    
+    printf("  4-way scalar multiplication (per point, clearing cofactor) runs in %6lld ", cycles/(SHORT_BENCH_LOOPS*4)); print_unit;
+    printf("\n");
+    }
+
+    {
+    point_t PP[8], RR[8];
+    uint64_t k[8*4];
+    unsigned int j;
+
+    // 8-way scalar multiplication
+    for (j=0; j<8; j++) {
+        eccset(PP[j]);
+        random_scalar_test(&k[4*j]);
+    }
+
+    cycles = 0;
+    for (n=0; n<SHORT_BENCH_LOOPS; n++)
+    {
+        cycles1 = cpucycles();
+        ecc_mul_x8(PP, (digit_t*)k, RR, true);
+        cycles2 = cpucycles();
+        cycles = cycles+(cycles2-cycles1);
+    }
+    
+    printf("  8-way scalar multiplication (per point, clearing cofactor) runs in %6lld ", cycles/(SHORT_BENCH_LOOPS*8)); print_unit;
+    printf("\n");
+    }
      
     {      
     point_precomp_t T;
@@ -644,16 +957,16 @@ bool ecc_run()
     for (n=0; n<BENCH_LOOPS; n++)
     {
         cycles1 = cpucycles();
-        table_lookup_fixed_base((point_precomp_t*)&FIXED_BASE_TABLE, T, 1, 0);
-        table_lookup_fixed_base((point_precomp_t*)&FIXED_BASE_TABLE, T, 2, (unsigned int)-1);
-        table_lookup_fixed_base((point_precomp_t*)&FIXED_BASE_TABLE, T, 1, 0);
-        table_lookup_fixed_base((point_precomp_t*)&FIXED_BASE_TABLE, T, 2, (unsigned int)-1);
-        table_lookup_fixed_base((point_precomp_t*)&FIXED_BASE_TABLE, T, 1, 0);
-        table_lookup_fixed_base((point_precomp_t*)&FIXED_BASE_TABLE, T, 2, (unsigned int)-1);
-        table_lookup_fixed_base((point_precomp_t*)&FIXED_BASE_TABLE, T, 1, 0);
-        table_lookup_fixed_base((point_precomp_t*)&FIXED_BASE_TABLE, T, 2, (unsigned int)-1);
-        table_lookup_fixed_base((point_precomp_t*)&FIXED_BASE_TABLE, T, 1, 0);
-        table_lookup_fixed_base((point_precomp_t*)&FIXED_BASE_TABLE, T, 2, (unsigned int)-1);
+        table_lookup_fixed_base((point_fixedbase_t*)&FIXED_BASE_TABLE, T, 1, 0);
+        table_lookup_fixed_base((point_fixedbase_t*)&FIXED_BASE_TABLE, T, 2, (unsigned int)-1);
+        table_lookup_fixed_base((point_fixedbase_t*)&FIXED_BASE_TABLE, T, 1, 0);
+        table_lookup_fixed_base((point_fixedbase_t*)&FIXED_BASE_TABLE, T, 2, (unsigned int)-1);
+        table_lookup_fixed_base((point_fixedbase_t*)&FIXED_BASE_TABLE, T, 1, 0);
+        table_lookup_fixed_base((point_fixedbase_t*)&FIXED_BASE_TABLE, T, 2, (unsigned int)-1);
+        table_lookup_fixed_base((point_fixedbase_t*)&FIXED_BASE_TABLE, T, 1, 0);
+        table_lookup_fixed_base((point_fixedbase_t*)&FIXED_BASE_TABLE, T, 2, (unsigned int)-1);
+        table_lookup_fixed_base((point_fixedbase_t*)&FIXED_BASE_TABLE, T, 1, 0);
+        table_lookup_fixed_base((point_fixedbase_t*)&FIXED_BASE_TABLE, T, 2, (unsigned int)-1);
         cycles2 = cpucycles();
         cycles = cycles+(cycles2-cycles1);
     }
@@ -677,6 +990,28 @@ bool ecc_run()
     printf("  Fixed-base scalar mul runs in ...                                %8lld cycles with w=%d and v=%d", cycles/SHORT_BENCH_LOOPS, W_FIXEDBASE, V_FIXEDBASE);
     printf("\n"); 
     } 
+
+    {
+    point_t QQ[NPOINTS_FIXEDBASE_BATCH];
+    uint64_t k[4*NPOINTS_FIXEDBASE_BATCH];
+    unsigned int j;
+
+    // Batched fixed-base scalar multiplication
+    cycles = 0;
+    for (n=0; n<SHORT_BENCH_LOOPS/NPOINTS_FIXEDBASE_BATCH; n++)
+    {
+        for (j=0; j<NPOINTS_FIXEDBASE_BATCH; j++) {
+            random_scalar_test(&k[4*j]);
+        }
+        cycles1 = cpucycles();
+        ecc_mul_fixed_batch((digit_t*)k, QQ, NPOINTS_FIXEDBASE_BATCH);
+        cycles2 = cpucycles();
+        cycles = cycles+(cycles2-cycles1);
+    }
+
+    printf("  Batched fixed-base scalar mul runs in ...                        %8lld cycles per point with %d points", cycles/((SHORT_BENCH_LOOPS/NPOINTS_FIXEDBASE_BATCH)*NPOINTS_FIXEDBASE_BATCH), NPOINTS_FIXEDBASE_BATCH);
+    printf("\n");
+    }
         
     {    
     point_t PP, QQ, RR; 
@@ -703,6 +1038,52 @@ bool ecc_run()
     printf("\n"); 
     }
 
+    {    
+    point_t PP[MULTI_MAX_POINTS], RR; 
+    uint64_t k[4*MULTI_MAX_POINTS], kk[4];
+    unsigned int i, j, npoints[4] = {8, NPOINTS_MULTI_PIPPENGER, 64, MULTI_MAX_POINTS};
+#if defined(FOURQ_NO_MALLOC)
+    size_t size = ecc_mul_multi_workspace_size(MULTI_MAX_POINTS);
+    void* workspace = malloc(size);                  // Allocated by the test, the library does not use the heap
+
+    if (workspace == NULL) {
+        return false;
+    }
+#endif
+
+    // Multi-scalar multiplication
+    for (j=0; j<MULTI_MAX_POINTS; j++) {
+        eccset(PP[j]);
+        random_scalar_test(kk);
+        ecc_mul(PP[j], (digit_t*)kk, PP[j], false);
+    }
+
+    for (i=0; i<4; i++)
+    {
+        cycles = 0;
+        for (n=0; n<MULTI_BENCH_LOOPS; n++)
+        {        
+            for (j=0; j<npoints[i]; j++) {
+                random_scalar_test(&k[4*j]);
+            }
+            cycles1 = cpucycles();
+#if defined(FOURQ_NO_MALLOC)
+            ecc_mul_multi_workspace(PP, (digit_t*)k, npoints[i], RR, workspace, size);
+#else
+            ecc_mul_multi(PP, (digit_t*)k, npoints[i], RR);
+#endif
+            cycles2 = cpucycles();
+            cycles = cycles+(cycles2-cycles1);
+        }
+    
+        printf("  Multi-scalar mul with %3d points runs in ...                     %8lld cycles per point", npoints[i], cycles/(MULTI_BENCH_LOOPS*npoints[i]));
+        printf("\n"); 
+    }
+#if defined(FOURQ_NO_MALLOC)
+    free(workspace);
+#endif
+    }
+
     return OK;
 } 
 
@@ -0,0 +1,746 @@
+/***********************************************************************************
+* FourQlib: a high-performance crypto library based on the elliptic curve FourQ
+*
+*    Copyright (c) Microsoft Corporation. All rights reserved.
+*
+* Abstract: statistical benchmarks of field, curve and protocol functions
+*
+* Usage: fourq_bench [--cpu N] [--filter NAME] [--json FILE] [--counters]
+*   --cpu N        pin the benchmark to CPU N (Linux). By default it is pinned to the CPU it starts on
+*   --filter NAME  run only the benchmarks whose name contains NAME
+*   --json FILE    write the results in JSON format to FILE. With "-", the JSON goes to the standard output and the
+*                  table to the standard error
+*   --counters     also count instructions, core cycles, branch misses and L1 data cache misses with perf_event_open (Linux),
+*                  and report them per operation together with the IPC. The benchmarks run without them if they are not available
+*
+* Every benchmark is warmed up and then timed over a number of samples, each one
+* running the operation a fixed number of times between serialized counter reads.
+* The minimum, median, 90th and 99th percentiles per operation are reported.
+* In builds with OPCOUNT=TRUE, the field and curve operations performed by every
+* benchmark are also reported per operation (see FourQ_get_opcounts()).
+************************************************************************************/
+
+#if defined(__LINUX__)
+    #define _GNU_SOURCE
+    #include <sched.h>
+#endif
+#include "../FourQ_internal.h"
+#include "../FourQ_params.h"
+#include "../FourQ_tables.h"
+#include "../../random/random.h"
+#include "../../sha512/sha512.h"
+#include "test_extras.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+// Benchmark parameters
+#if defined(GENERIC_IMPLEMENTATION)
+    #define FAST_SAMPLES      2000      // Number of samples for operations that take less than a few thousand cycles
+    #define SLOW_SAMPLES      200       // Number of samples for scalar multiplications and protocol functions
+#else
+    #define FAST_SAMPLES      10000
+    #define SLOW_SAMPLES      1000
+#endif
+#define WARMUP_FRACTION       10        // Warm-up runs 1/WARMUP_FRACTION of the samples, which are discarded
+#define MAX_BENCHMARKS        64
+#define OVERHEAD_SAMPLES      10000     // Number of samples used to measure the overhead of the counter reads
+#define EVICT_BYTES           (1 << 20) // Data read before every sample of the cold-cache benchmarks
+#if (TARGET == TARGET_AMD64 || TARGET == TARGET_x86)
+    #define UNIT              "cycles"
+#else
+    #define UNIT              "nsec"
+#endif
+
+
+typedef struct {
+    const char* name;
+    const char* group;
+    unsigned int samples;
+    unsigned int ops;                   // Number of operations per sample
+    int64_t min, median, p90, p99;      // Per operation
+    double mean;
+    double counters[PERF_NUM_COUNTERS]; // Hardware counter values per operation, or -1 if not available
+    FourQ_OpCounts opcounts;            // Operations counted over all the timed runs
+} bench_result;
+
+typedef struct {
+    bench_result* result;
+    int64_t* samples;
+    unsigned int count;                 // Number of runs so far, including warm-up runs
+    unsigned int warmup;
+    int64_t start;                      // Counter value at the start of the current run
+} bench_t;
+
+static bench_result results[MAX_BENCHMARKS];
+static unsigned int nresults = 0;
+static int64_t overhead = 0;
+static const char* filter = NULL;
+static FILE* out = NULL;                // Output of the table
+static bool counters = false;           // Use of hardware performance counters
+static bool opcount = false;            // Operation counting, available in builds with OPCOUNT=TRUE
+static unsigned char evict_buffer[EVICT_BYTES];
+
+static const struct {
+    const char* name;
+    size_t offset;
+} opcount_fields[] = {
+    {"fpmul", offsetof(FourQ_OpCounts, fpmul)},
+    {"fpsqr", offsetof(FourQ_OpCounts, fpsqr)},
+    {"fpinv", offsetof(FourQ_OpCounts, fpinv)},
+    {"fp2mul", offsetof(FourQ_OpCounts, fp2mul)},
+    {"fp2sqr", offsetof(FourQ_OpCounts, fp2sqr)},
+    {"fp2add", offsetof(FourQ_OpCounts, fp2add)},
+    {"fp2inv", offsetof(FourQ_OpCounts, fp2inv)},
+    {"eccdouble", offsetof(FourQ_OpCounts, eccdouble)},
+    {"eccadd", offsetof(FourQ_OpCounts, eccadd)},
+    {"eccmadd", offsetof(FourQ_OpCounts, eccmadd)},
+    {"lookup1x8", offsetof(FourQ_OpCounts, table_lookup_1x8)},
+    {"lookupfb", offsetof(FourQ_OpCounts, table_lookup_fixed_base)}
+};
+#define NUM_OPCOUNT_FIELDS    (sizeof(opcount_fields)/sizeof(opcount_fields[0]))
+
+
+static int compare_int64(const void* a, const void* b)
+{
+    int64_t x = *(const int64_t*)a, y = *(const int64_t*)b;
+
+    return (x > y) - (x < y);
+}
+
+
+static int64_t percentile(const int64_t* sorted, unsigned int n, unsigned int p)
+{ // p-th percentile of a sorted array, using the nearest-rank method
+    unsigned int rank = (p*n + 99)/100;
+
+    return sorted[(rank > 0)? rank - 1 : 0];
+}
+
+
+static void bench_begin(bench_t* b, const char* name, const char* group, unsigned int samples, unsigned int ops)
+{ // Start a benchmark of "samples" samples of "ops" operations each. It is skipped if the name does not match the filter
+    b->result = NULL;
+    b->count = 0;
+    if ((filter != NULL && strstr(name, filter) == NULL) || nresults == MAX_BENCHMARKS) {
+        return;
+    }
+    b->samples = (int64_t*)malloc(samples*sizeof(int64_t));
+    if (b->samples == NULL) {
+        return;
+    }
+    b->result = &results[nresults];
+    b->result->name = name;
+    b->result->group = group;
+    b->result->samples = samples;
+    b->result->ops = ops;
+    b->warmup = samples/WARMUP_FRACTION + 1;
+}
+
+
+static void bench_record(bench_t* b, int64_t stop)
+{ // Record the run that started at b->start, unless it is a warm-up run
+    int64_t t = stop - b->start - overhead;
+
+    if (b->count >= b->warmup) {
+        b->samples[b->count - b->warmup] = (t > 0)? t : 0;
+    }
+    b->count++;
+    if (b->count == b->warmup) {                        // Count the events and operations of the timed runs
+        if (counters == true) {
+            perf_counters_start();
+        }
+        FourQ_reset_opcounts();
+    }
+}
+
+
+static double opcount_per_op(const bench_result* r, unsigned int field)
+{ // Number of operations of type opcount_fields[field] per benchmarked operation
+    uint64_t count = *(const uint64_t*)((const unsigned char*)&r->opcounts + opcount_fields[field].offset);
+
+    return (double)count/((double)r->samples*r->ops);
+}
+
+
+static void print_counter(double value, int precision)
+{ // Print a column with a value derived from the hardware counters, or "-" if it is not available
+    if (value < 0) {
+        fprintf(out, " %10s", "-");
+    } else {
+        fprintf(out, " %10.*f", precision, value);
+    }
+}
+
+
+static void json_counter(FILE* f, const char* name, double value, const char* separator)
+{ // Write a value derived from the hardware counters, or null if it is not available
+    if (value < 0) {
+        fprintf(f, "\"%s\": null%s", name, separator);
+    } else {
+        fprintf(f, "\"%s\": %.3f%s", name, value, separator);
+    }
+}
+
+
+static bool bench_running(bench_t* b)
+{ // Return true while there are runs left. After the last run, compute and print the statistics
+    bench_result* r = b->result;
+    double sum = 0;
+    int64_t values[PERF_NUM_COUNTERS];
+    unsigned int i;
+
+    if (r == NULL) {
+        return false;
+    }
+    if (b->count < b->warmup + r->samples) {
+        return true;
+    }
+
+    for (i = 0; i < PERF_NUM_COUNTERS; i++) {
+        values[i] = -1;
+    }
+    if (counters == true) {
+        perf_counters_stop(values);
+    }
+    FourQ_get_opcounts(&r->opcounts);
+    for (i = 0; i < PERF_NUM_COUNTERS; i++) {
+        r->counters[i] = (values[i] >= 0)? (double)values[i]/((double)r->samples*r->ops) : -1;
+    }
+
+    qsort(b->samples, r->samples, sizeof(int64_t), compare_int64);
+    for (i = 0; i < r->samples; i++) {
+        sum += (double)b->samples[i];
+    }
+    r->min = b->samples[0]/r->ops;
+    r->median = percentile(b->samples, r->samples, 50)/r->ops;
+    r->p90 = percentile(b->samples, r->samples, 90)/r->ops;
+    r->p99 = percentile(b->samples, r->samples, 99)/r->ops;
+    r->mean = sum/r->samples/r->ops;
+    free(b->samples);
+    b->result = NULL;
+    nresults++;
+
+    fprintf(out, "  %-8s %-48s %10lld %10lld %10lld %10lld", r->group, r->name, (long long)r->min, (long long)r->median, (long long)r->p90, (long long)r->p99);
+    if (counters == true) {
+        print_counter(r->counters[PERF_INSTRUCTIONS], 1);
+        print_counter((r->counters[PERF_INSTRUCTIONS] >= 0 && r->counters[PERF_CYCLES] > 0)? r->counters[PERF_INSTRUCTIONS]/r->counters[PERF_CYCLES] : -1, 2);
+        print_counter(r->counters[PERF_BRANCH_MISSES], 2);
+        print_counter(r->counters[PERF_L1D_MISSES], 2);
+    }
+    fprintf(out, "\n");
+    return false;
+}
+
+
+static void measure_overhead(void)
+{ // Median cost of an empty measurement, which is subtracted from every sample
+    int64_t* samples = (int64_t*)malloc(OVERHEAD_SAMPLES*sizeof(int64_t)), t;
+    unsigned int i;
+
+    if (samples == NULL) {
+        return;
+    }
+    for (i = 0; i < OVERHEAD_SAMPLES; i++) {
+        t = cpucycles_start();
+        samples[i] = cpucycles_stop() - t;
+    }
+    qsort(samples, OVERHEAD_SAMPLES, sizeof(int64_t), compare_int64);
+    overhead = percentile(samples, OVERHEAD_SAMPLES, 50);
+    free(samples);
+}
+
+
+static int pin_cpu(int cpu)
+{ // Pin the process to a CPU, or to the CPU it is running on if cpu < 0. It returns the CPU, or -1 if the process is not pinned
+#if defined(__LINUX__)
+    cpu_set_t set;
+
+    if (cpu < 0) {
+        cpu = sched_getcpu();
+    }
+    if (cpu < 0) {
+        return -1;
+    }
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    if (sched_setaffinity(0, sizeof(set), &set) != 0) {
+        return -1;
+    }
+    return cpu;
+#else
+    (void)cpu;
+    return -1;
+#endif
+}
+
+
+static void warm_up(void)
+{ // Run field multiplications for about 10^9 counter units (0.2-0.5 s), so that the core reaches a stable frequency before the first benchmark
+    f2elm_t a, b;
+    int64_t start = cpucycles_start();
+    unsigned int i;
+
+    fp2random1271_test(a); fp2random1271_test(b);
+    while (cpucycles_stop() - start < 1000000000) {
+        for (i = 0; i < 1000; i++) {
+            fp2mul1271(a, b, a);
+        }
+    }
+}
+
+
+static void evict_caches(void)
+{ // Read EVICT_BYTES of other data, which evicts the tables of the library from the L1 and L2 caches as the working set of an application would
+    volatile unsigned char* buffer = evict_buffer;
+    unsigned int i;
+
+    for (i = 0; i < EVICT_BYTES; i += 64) {
+        buffer[i]++;
+    }
+}
+
+
+static void field_bench(void)
+{
+    bench_t b;
+    f2elm_t a, c, d;
+    digit_t s[NWORDS_ORDER], t[NWORDS_ORDER];
+    unsigned int i;
+
+    fp2random1271_test(a); fp2random1271_test(c); fp2random1271_test(d);
+    random_order_test(s); random_order_test(t);
+
+    bench_begin(&b, "fp2mul1271", "field", FAST_SAMPLES, 100);
+    while (bench_running(&b)) {
+        b.start = cpucycles_start();
+        for (i = 0; i < 100; i++) fp2mul1271(a, c, a);
+        bench_record(&b, cpucycles_stop());
+    }
+    bench_begin(&b, "fp2sqr1271", "field", FAST_SAMPLES, 100);
+    while (bench_running(&b)) {
+        b.start = cpucycles_start();
+        for (i = 0; i < 100; i++) fp2sqr1271(a, a);
+        bench_record(&b, cpucycles_stop());
+    }
+    bench_begin(&b, "fp2add1271", "field", FAST_SAMPLES, 100);
+    while (bench_running(&b)) {
+        b.start = cpucycles_start();
+        for (i = 0; i < 100; i++) fp2add1271(a, c, a);
+        bench_record(&b, cpucycles_stop());
+    }
+    bench_begin(&b, "fp2inv1271", "field", FAST_SAMPLES/10, 1);
+    while (bench_running(&b)) {
+        b.start = cpucycles_start();
+        fp2inv1271(d);
+        bench_record(&b, cpucycles_stop());
+    }
+    bench_begin(&b, "Montgomery_multiply_mod_order", "field", FAST_SAMPLES, 10);
+    while (bench_running(&b)) {
+        b.start = cpucycles_start();
+        for (i = 0; i < 10; i++) Montgomery_multiply_mod_order(s, t, s);
+        bench_record(&b, cpucycles_stop());
+    }
+    bench_begin(&b, "modulo_order", "field", FAST_SAMPLES, 10);
+    while (bench_running(&b)) {
+        b.start = cpucycles_start();
+        for (i = 0; i < 10; i++) modulo_order(s, s);
+        bench_record(&b, cpucycles_stop());
+    }
+}
+
+
+static void curve_bench(void)
+{
+    bench_t b;
+    point_t A, B, PP[8], RR[8], QQ[NPOINTS_FIXEDBASE_BATCH];
+    point_extproj_t P;
+    point_extproj_precomp_t Q, Table[8];
+    point_precomp_t T;
+    f2elm_t r;
+    uint64_t scalar[4], l[4], k[8*4], kk[4*NPOINTS_FIXEDBASE_BATCH];
+    unsigned char encoded[32];
+    unsigned int i;
+
+    eccset(A);
+    point_setup(A, P);
+    R1_to_R2(P, Q);
+    random_scalar_test(scalar); random_scalar_test(l);
+    for (i = 0; i < 8; i++) {
+        eccset(PP[i]);
+        random_scalar_test(&k[4*i]);
+    }
+
+    bench_begin(&b, "eccdouble", "curve", FAST_SAMPLES, 10);
+    while (bench_running(&b)) {
+        b.start = cpucycles_start();
+        for (i = 0; i < 10; i++) eccdouble(P);
+        bench_record(&b, cpucycles_stop());
+    }
+    bench_begin(&b, "eccadd", "curve", FAST_SAMPLES, 10);
+    while (bench_running(&b)) {
+        b.start = cpucycles_start();
+        for (i = 0; i < 10; i++) eccadd(Q, P);
+        bench_record(&b, cpucycles_stop());
+    }
+    bench_begin(&b, "ecc_precomp", "curve", FAST_SAMPLES, 1);
+    while (bench_running(&b)) {
+        b.start = cpucycles_start();
+        ecc_precomp(P, Table);
+        bench_record(&b, cpucycles_stop());
+    }
+    bench_begin(&b, "table_lookup_1x8", "curve", FAST_SAMPLES, 10);
+    while (bench_running(&b)) {
+        b.start = cpucycles_start();
+        for (i = 0; i < 10; i++) table_lookup_1x8(Table, Q, i & 7, 0 - (i & 1));
+        bench_record(&b, cpucycles_stop());
+    }
+    bench_begin(&b, "table_lookup_fixed_base", "curve", FAST_SAMPLES, 10);
+    while (bench_running(&b)) {
+        b.start = cpucycles_start();
+        for (i = 0; i < 10; i++) table_lookup_fixed_base((point_fixedbase_t*)&FIXED_BASE_TABLE, T, i & 7, 0 - (i & 1));
+        bench_record(&b, cpucycles_stop());
+    }
+    bench_begin(&b, "encode", "curve", FAST_SAMPLES, 1);
+    while (bench_running(&b)) {
+        b.start = cpucycles_start();
+        encode(A, encoded);
+        bench_record(&b, cpucycles_stop());
+    }
+    bench_begin(&b, "decode", "curve", SLOW_SAMPLES, 1);
+    while (bench_running(&b)) {
+        b.start = cpucycles_start();
+        decode(encoded, B);
+        bench_record(&b, cpucycles_stop());
+    }
+    bench_begin(&b, "ecc_mul", "curve", SLOW_SAMPLES, 1);
+    while (bench_running(&b)) {
+        b.start = cpucycles_start();
+        ecc_mul(A, (digit_t*)scalar, B, false);
+        bench_record(&b, cpucycles_stop());
+    }
+    bench_begin(&b, "ecc_mul (clearing cofactor)", "curve", SLOW_SAMPLES, 1);
+    while (bench_running(&b)) {
+        b.start = cpucycles_start();
+        ecc_mul(A, (digit_t*)scalar, B, true);
+        bench_record(&b, cpucycles_stop());
+    }
+    bench_begin(&b, "ecc_mul_x4 (per point)", "curve", SLOW_SAMPLES, 4);
+    while (bench_running(&b)) {
+        b.start = cpucycles_start();
+        ecc_mul_x4(PP, (digit_t*)k, RR, true);
+        bench_record(&b, cpucycles_stop());
+    }
+    bench_begin(&b, "ecc_mul_x8 (per point)", "curve", SLOW_SAMPLES, 8);
+    while (bench_running(&b)) {
+        b.start = cpucycles_start();
+        ecc_mul_x8(PP, (digit_t*)k, RR, true);
+        bench_record(&b, cpucycles_stop());
+    }
+    bench_begin(&b, "ecc_mul_fixed", "curve", SLOW_SAMPLES, 1);
+    while (bench_running(&b)) {
+        random_scalar_test(scalar);
+        b.start = cpucycles_start();
+        ecc_mul_fixed((digit_t*)scalar, B);
+        bench_record(&b, cpucycles_stop());
+    }
+    bench_begin(&b, "ecc_mul_fixed (cold caches)", "curve", SLOW_SAMPLES, 1);
+    while (bench_running(&b)) {
+        random_scalar_test(scalar);
+        evict_caches();
+        b.start = cpucycles_start();
+        ecc_mul_fixed((digit_t*)scalar, B);
+        bench_record(&b, cpucycles_stop());
+    }
+    bench_begin(&b, "ecc_mul_fixed_batch (per point)", "curve", SLOW_SAMPLES/10, NPOINTS_FIXEDBASE_BATCH);
+    while (bench_running(&b)) {
+        for (i = 0; i < NPOINTS_FIXEDBASE_BATCH; i++) random_scalar_test(&kk[4*i]);
+        b.start = cpucycles_start();
+        ecc_mul_fixed_batch((digit_t*)kk, QQ, NPOINTS_FIXEDBASE_BATCH);
+        bench_record(&b, cpucycles_stop());
+    }
+    ecc_mul(A, (digit_t*)l, B, false);
+    bench_begin(&b, "ecc_mul_double", "curve", SLOW_SAMPLES, 1);
+    while (bench_running(&b)) {
+        random_scalar_test(scalar); random_scalar_test(l);
+        b.start = cpucycles_start();
+        ecc_mul_double((digit_t*)scalar, B, (digit_t*)l, RR[0]);
+        bench_record(&b, cpucycles_stop());
+    }
+    bench_begin(&b, "HashToCurve", "curve", SLOW_SAMPLES, 1);
+    while (bench_running(&b)) {
+        fp2random1271_test(r);
+        b.start = cpucycles_start();
+        HashToCurve(r, B);
+        bench_record(&b, cpucycles_stop());
+    }
+}
+
+
+static void protocol_bench(void)
+{
+    bench_t b;
+    unsigned char SecretKey[8][32], PublicKey[8][64], Signature[64][64], Message[64][32], Shared[16][32], h[64];
+    const unsigned char *pk[64], *msg[64], *sig[64], *sk8[8], *pk8[8];
+    unsigned char *ss16[16];
+    unsigned int i, SizeMessage[64], valid[64];
+    ECCRYPTO_STATUS Statuses[16];
+    SchnorrQ_PreparedPublicKey* Prepared = (SchnorrQ_PreparedPublicKey*)malloc(sizeof(SchnorrQ_PreparedPublicKey));
+    ECDH_PreparedPublicKey* PreparedECDH = (ECDH_PreparedPublicKey*)malloc(sizeof(ECDH_PreparedPublicKey));
+    size_t SizeVerifyWorkspace = SchnorrQ_VerifyBatchWorkspaceSize(64);
+    void* VerifyWorkspace = malloc(SizeVerifyWorkspace);
+
+    if (Prepared == NULL || PreparedECDH == NULL || VerifyWorkspace == NULL) {
+        free(Prepared);
+        free(PreparedECDH);
+        free(VerifyWorkspace);
+        return;
+    }
+    for (i = 0; i < 8; i++) {
+        SchnorrQ_FullKeyGeneration(SecretKey[i], PublicKey[i]);
+    }
+    for (i = 0; i < 64; i++) {
+        random_bytes(Message[i], 32);
+        SchnorrQ_Sign(SecretKey[i % 8], PublicKey[i % 8], Message[i], 32, Signature[i]);
+        pk[i] = PublicKey[i % 8]; msg[i] = Message[i]; sig[i] = Signature[i]; SizeMessage[i] = 32;
+    }
+    SchnorrQ_PreparePublicKey(PublicKey[0], Prepared);
+
+    bench_begin(&b, "crypto_sha512 (64 bytes)", "protocol", FAST_SAMPLES, 1);
+    while (bench_running(&b)) {
+        b.start = cpucycles_start();
+        crypto_sha512(Signature[0], 64, h);
+        bench_record(&b, cpucycles_stop());
+    }
+    bench_begin(&b, "SchnorrQ_KeyGeneration", "protocol", SLOW_SAMPLES, 1);
+    while (bench_running(&b)) {
+        b.start = cpucycles_start();
+        SchnorrQ_KeyGeneration(SecretKey[0], PublicKey[0]);
+        bench_record(&b, cpucycles_stop());
+    }
+    bench_begin(&b, "SchnorrQ_Sign", "protocol", SLOW_SAMPLES, 1);
+    while (bench_running(&b)) {
+        b.start = cpucycles_start();
+        SchnorrQ_Sign(SecretKey[0], PublicKey[0], Message[0], 32, Signature[0]);
+        bench_record(&b, cpucycles_stop());
+    }
+    bench_begin(&b, "SchnorrQ_Verify", "protocol", SLOW_SAMPLES, 1);
+    while (bench_running(&b)) {
+        b.start = cpucycles_start();
+        SchnorrQ_Verify(PublicKey[0], Message[0], 32, Signature[0], &valid[0]);
+        bench_record(&b, cpucycles_stop());
+    }
+    bench_begin(&b, "SchnorrQ_VerifyPrepared", "protocol", SLOW_SAMPLES, 1);
+    while (bench_running(&b)) {
+        b.start = cpucycles_start();
+        SchnorrQ_VerifyPrepared(Prepared, Message[0], 32, Signature[0], &valid[0]);
+        bench_record(&b, cpucycles_stop());
+    }
+#if !defined(FOURQ_NO_MALLOC)
+    bench_begin(&b, "SchnorrQ_VerifyBatch (per signature)", "protocol", SLOW_SAMPLES/10, 64);
+    while (bench_running(&b)) {
+        b.start = cpucycles_start();
+        SchnorrQ_VerifyBatch(pk, msg, SizeMessage, sig, 64, valid);
+        bench_record(&b, cpucycles_stop());
+    }
+#endif
+    bench_begin(&b, "SchnorrQ_VerifyBatchWorkspace (per signature)", "protocol", SLOW_SAMPLES/10, 64);
+    while (bench_running(&b)) {
+        b.start = cpucycles_start();
+        SchnorrQ_VerifyBatchWorkspace(pk, msg, SizeMessage, sig, 64, valid, VerifyWorkspace, SizeVerifyWorkspace);
+        bench_record(&b, cpucycles_stop());
+    }
+    bench_begin(&b, "CompressedPublicKeyGeneration", "protocol", SLOW_SAMPLES, 1);
+    while (bench_running(&b)) {
+        b.start = cpucycles_start();
+        CompressedPublicKeyGeneration(SecretKey[1], PublicKey[1]);
+        bench_record(&b, cpucycles_stop());
+    }
+    bench_begin(&b, "CompressedSecretAgreement", "protocol", SLOW_SAMPLES, 1);
+    while (bench_running(&b)) {
+        b.start = cpucycles_start();
+        CompressedSecretAgreement(SecretKey[0], PublicKey[1], Shared[0]);
+        bench_record(&b, cpucycles_stop());
+    }
+    bench_begin(&b, "PrepareECDHPublicKey", "protocol", SLOW_SAMPLES/10, 1);
+    while (bench_running(&b)) {
+        b.start = cpucycles_start();
+        PrepareECDHPublicKey(PublicKey[1], PreparedECDH);
+        bench_record(&b, cpucycles_stop());
+    }
+    bench_begin(&b, "SecretAgreementPrepared", "protocol", SLOW_SAMPLES, 1);
+    while (bench_running(&b)) {
+        b.start = cpucycles_start();
+        SecretAgreementPrepared(SecretKey[0], PreparedECDH, Shared[0]);
+        bench_record(&b, cpucycles_stop());
+    }
+    for (i = 0; i < 8; i++) {
+        CompressedKeyGeneration(SecretKey[i], PublicKey[i]);
+        sk8[i] = SecretKey[i]; pk8[i] = PublicKey[(i+1) % 8];
+    }
+    for (i = 0; i < 16; i++) {
+        ss16[i] = Shared[i];
+    }
+    bench_begin(&b, "CompressedSecretAgreementBatch (per agreement)", "protocol", SLOW_SAMPLES/8, 8);
+    while (bench_running(&b)) {
+        b.start = cpucycles_start();
+        CompressedSecretAgreementBatch(sk8, pk8, ss16, 8, Statuses);
+        bench_record(&b, cpucycles_stop());
+    }
+    for (i = 0; i < 16; i++) {
+        pk[i] = PublicKey[i % 8];
+    }
+    bench_begin(&b, "CompressedSecretAgreementMany (per agreement)", "protocol", SLOW_SAMPLES/16, 16);
+    while (bench_running(&b)) {
+        b.start = cpucycles_start();
+        CompressedSecretAgreementMany(SecretKey[0], pk, ss16, 16, Statuses);
+        bench_record(&b, cpucycles_stop());
+    }
+    PublicKeyGeneration(SecretKey[1], PublicKey[1]);
+    bench_begin(&b, "SecretAgreement", "protocol", SLOW_SAMPLES, 1);
+    while (bench_running(&b)) {
+        b.start = cpucycles_start();
+        SecretAgreement(SecretKey[0], PublicKey[1], Shared[0]);
+        bench_record(&b, cpucycles_stop());
+    }
+    free(Prepared);
+    free(PreparedECDH);
+    free(VerifyWorkspace);
+}
+
+
+static void print_opcounts(void)
+{ // Print the field and curve operations per operation of every benchmark
+    unsigned int i, j;
+
+    fprintf(out, "\n  %-48s", "function (operations per operation)");
+    for (j = 0; j < NUM_OPCOUNT_FIELDS; j++) {
+        fprintf(out, " %9s", opcount_fields[j].name);
+    }
+    fprintf(out, "\n");
+    for (i = 0; i < nresults; i++) {
+        fprintf(out, "  %-48s", results[i].name);
+        for (j = 0; j < NUM_OPCOUNT_FIELDS; j++) {
+            fprintf(out, " %9.1f", opcount_per_op(&results[i], j));
+        }
+        fprintf(out, "\n");
+    }
+}
+
+
+static bool write_json(const char* path, int cpu)
+{ // Write the results in JSON format
+    FILE* f = (strcmp(path, "-") == 0)? stdout : fopen(path, "w");
+    unsigned int i, j;
+
+    if (f == NULL) {
+        return false;
+    }
+    fprintf(f, "{\n");
+    fprintf(f, "  \"library\": \"FourQlib\",\n");
+    fprintf(f, "  \"backend\": \"%s\",\n", FourQ_get_backend_name(FourQ_get_backend()));
+#if defined(USE_ENDO)
+    fprintf(f, "  \"endomorphisms\": true,\n");
+#else
+    fprintf(f, "  \"endomorphisms\": false,\n");
+#endif
+#if defined(COMPACT_FIXEDBASE_SUPPORT)
+    fprintf(f, "  \"fixed_base_table\": {\"w\": %d, \"v\": %d, \"bytes\": %d, \"compact\": true},\n", W_FIXEDBASE, V_FIXEDBASE, (int)sizeof(FIXED_BASE_TABLE));
+#else
+    fprintf(f, "  \"fixed_base_table\": {\"w\": %d, \"v\": %d, \"bytes\": %d, \"compact\": false},\n", W_FIXEDBASE, V_FIXEDBASE, (int)sizeof(FIXED_BASE_TABLE));
+#endif
+    fprintf(f, "  \"double_scalar_table\": {\"w\": %d, \"bytes\": %d},\n", WP_DOUBLEBASE, (int)sizeof(DOUBLE_SCALAR_TABLE));
+    fprintf(f, "  \"unit\": \"%s\",\n", UNIT);
+    fprintf(f, "  \"cpu\": %d,\n", cpu);
+    fprintf(f, "  \"timer_overhead\": %lld,\n", (long long)overhead);
+    fprintf(f, "  \"counters\": %s,\n", (counters == true)? "true" : "false");
+    fprintf(f, "  \"opcounts\": %s,\n", (opcount == true)? "true" : "false");
+    fprintf(f, "  \"results\": [\n");
+    for (i = 0; i < nresults; i++) {
+        bench_result* r = &results[i];
+
+        fprintf(f, "    {\"name\": \"%s\", \"group\": \"%s\", \"samples\": %u, \"ops_per_sample\": %u, \"min\": %lld, \"median\": %lld, \"p90\": %lld, \"p99\": %lld, \"mean\": %.1f",
+                r->name, r->group, r->samples, r->ops, (long long)r->min, (long long)r->median, (long long)r->p90, (long long)r->p99, r->mean);
+        if (counters == true) {
+            fprintf(f, ", \"counters\": {");
+            json_counter(f, "instructions", r->counters[PERF_INSTRUCTIONS], ", ");
+            json_counter(f, "core_cycles", r->counters[PERF_CYCLES], ", ");
+            json_counter(f, "ipc", (r->counters[PERF_INSTRUCTIONS] >= 0 && r->counters[PERF_CYCLES] > 0)? r->counters[PERF_INSTRUCTIONS]/r->counters[PERF_CYCLES] : -1, ", ");
+            json_counter(f, "branch_misses", r->counters[PERF_BRANCH_MISSES], ", ");
+            json_counter(f, "l1d_misses", r->counters[PERF_L1D_MISSES], "}");
+        }
+        if (opcount == true) {
+            fprintf(f, ", \"opcounts\": {");
+            for (j = 0; j < NUM_OPCOUNT_FIELDS; j++) {
+                fprintf(f, "\"%s\": %.2f%s", opcount_fields[j].name, opcount_per_op(r, j), (j + 1 < NUM_OPCOUNT_FIELDS)? ", " : "}");
+            }
+        }
+        fprintf(f, "}%s\n", (i + 1 < nresults)? "," : "");
+    }
+    fprintf(f, "  ]\n}\n");
+    if (f != stdout) {
+        fclose(f);
+    }
+    return true;
+}
+
+
+int main(int argc, char** argv)
+{
+    const char* json = NULL;
+    FourQ_OpCounts opcounts;
+    int i, cpu = -1;
+
+    out = stdout;
+    for (i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--cpu") == 0 && i + 1 < argc) {
+            cpu = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--filter") == 0 && i + 1 < argc) {
+            filter = argv[++i];
+        } else if (strcmp(argv[i], "--json") == 0 && i + 1 < argc) {
+            json = argv[++i];
+            if (strcmp(json, "-") == 0) {
+                out = stderr;
+            }
+        } else if (strcmp(argv[i], "--counters") == 0) {
+            counters = true;
+        } else {
+            printf("Usage: %s [--cpu N] [--filter NAME] [--json FILE] [--counters]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    cpu = pin_cpu(cpu);
+    if (counters == true && perf_counters_open() == 0) {
+        fprintf(out, "\n  Hardware performance counters are not available (see /proc/sys/kernel/perf_event_paranoid), running without them\n");
+        counters = false;
+    }
+    opcount = (FourQ_get_opcounts(&opcounts) == ECCRYPTO_SUCCESS);
+    warm_up();
+    measure_overhead();
+
+    fprintf(out, "\n--------------------------------------------------------------------------------------------------------\n\n");
+    fprintf(out, "FourQ benchmarks, backend: %s, CPU: %d, timer overhead: %lld %s\n", FourQ_get_backend_name(FourQ_get_backend()), cpu, (long long)overhead, UNIT);
+    fprintf(out, "Fixed-base table: w=%d, v=%d, %d bytes. Double scalar table: w=%d, %d bytes\n\n", W_FIXEDBASE, V_FIXEDBASE, (int)sizeof(FIXED_BASE_TABLE), WP_DOUBLEBASE, (int)sizeof(DOUBLE_SCALAR_TABLE));
+    fprintf(out, "  %-8s %-48s %10s %10s %10s %10s", "group", "function (" UNIT " per operation)", "min", "median", "p90", "p99");
+    if (counters == true) {
+        fprintf(out, " %10s %10s %10s %10s", "instr", "IPC", "br-miss", "L1D-miss");
+    }
+    fprintf(out, "\n");
+
+    field_bench();
+    curve_bench();
+    protocol_bench();
+
+    if (counters == true) {
+        perf_counters_close();
+    }
+    if (opcount == true) {
+        print_opcounts();
+    }
+    if (json != NULL && write_json(json, cpu) == false) {
+        fprintf(stderr, "\n  Could not write %s\n", json);
+        return 1;
+    }
+    return 0;
+}
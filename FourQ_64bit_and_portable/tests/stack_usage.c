@@ -0,0 +1,204 @@
+/***********************************************************************************
+* FourQlib: a high-performance crypto library based on the elliptic curve FourQ
+*
+*    Copyright (c) Microsoft Corporation. All rights reserved.
+*
+* Abstract: worst-case stack usage of the API functions
+*
+* Usage: stack_usage FourQ_api.h file1.ci file2.ci ...
+*   Reads the call graphs written by GCC with -fstack-usage -fcallgraph-info=su (one .ci file per object) and prints, for every
+*   function declared in FourQ_api.h, its stack frame plus the largest total of the frames of the functions it calls, following
+*   the deepest path of the call graph. Run "make stack_usage" to build the library with these options and print the report.
+*
+* Calls to functions without stack information (assembly, the C library) and indirect calls (the backend functions of builds
+* with runtime dispatch) are not included; the usage of such paths is marked with '+'. Recursive calls are reported as errors.
+************************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+#define MAX_NAME 128
+
+typedef struct {
+    char name[MAX_NAME];
+    long frame;                     // Stack frame in bytes, or -1 if the function has no stack information
+    unsigned int* callees;
+    unsigned int ncallees, capacity;
+    int state;                      // 0 = not visited, 1 = in progress, 2 = done
+    long total;                     // Worst-case usage, including the callees
+    int partial;                    // The worst-case path misses functions without stack information
+} function_t;
+
+static function_t* functions = NULL;
+static unsigned int nfunctions = 0, capacity = 0;
+
+
+static unsigned int find_function(const char* name)
+{ // Index of the function with the given name, which is added if it is not found
+    unsigned int i;
+
+    for (i = 0; i < nfunctions; i++) {
+        if (strcmp(functions[i].name, name) == 0) {
+            return i;
+        }
+    }
+    if (nfunctions == capacity) {
+        capacity = (capacity == 0)? 256 : 2*capacity;
+        functions = (function_t*)realloc(functions, capacity*sizeof(function_t));
+        if (functions == NULL) {
+            fprintf(stderr, "Out of memory\n");
+            exit(1);
+        }
+    }
+    memset(&functions[nfunctions], 0, sizeof(function_t));
+    strncpy(functions[nfunctions].name, name, MAX_NAME-1);
+    functions[nfunctions].frame = -1;
+    return nfunctions++;
+}
+
+
+static int get_field(const char* line, const char* field, char* value)
+{ // Copy the quoted value of "field" in a node or edge line of a .ci file. It returns 0 if the field is not found
+    const char *p = strstr(line, field), *q;
+    size_t n;
+
+    if (p == NULL || (p = strchr(p + strlen(field), '"')) == NULL || (q = strchr(p+1, '"')) == NULL) {
+        return 0;
+    }
+    n = (size_t)(q - p - 1);
+    if (n >= MAX_NAME) {
+        n = MAX_NAME-1;
+    }
+    memcpy(value, p+1, n);
+    value[n] = 0;
+    return 1;
+}
+
+
+static int read_call_graph(const char* file)
+{ // Add the nodes and edges of a .ci file
+    char line[1024], source[MAX_NAME], target[MAX_NAME], label[MAX_NAME];
+    const char* p;
+    function_t* f;
+    unsigned int i, j;
+    FILE* in = fopen(file, "r");
+
+    if (in == NULL) {
+        fprintf(stderr, "Cannot open %s\n", file);
+        return 0;
+    }
+    while (fgets(line, sizeof(line), in) != NULL) {
+        if (strncmp(line, "node:", 5) == 0 && get_field(line, "title:", source) && get_field(line, "label:", label)) {
+            i = find_function(source);                          // The label is "name\nfile:line:column\nN bytes (static)"
+            p = strstr(label, " bytes");
+            if (p != NULL) {
+                while (p > label && p[-1] >= '0' && p[-1] <= '9') p--;
+                functions[i].frame = atol(p);
+            }
+        } else if (strncmp(line, "edge:", 5) == 0 && get_field(line, "sourcename:", source) && get_field(line, "targetname:", target)) {
+            i = find_function(source);
+            j = find_function(target);
+            f = &functions[i];
+            if (f->ncallees == f->capacity) {
+                f->capacity = (f->capacity == 0)? 16 : 2*f->capacity;
+                f->callees = (unsigned int*)realloc(f->callees, f->capacity*sizeof(unsigned int));
+                if (f->callees == NULL) {
+                    fprintf(stderr, "Out of memory\n");
+                    exit(1);
+                }
+            }
+            f->callees[f->ncallees++] = j;
+        }
+    }
+    fclose(in);
+    return 1;
+}
+
+
+static int worst_case(unsigned int i)
+{ // Compute the worst-case stack usage of function i. It returns 0 if the function is recursive
+    function_t* f = &functions[i];
+    unsigned int j;
+    long total = 0;
+    int partial = 0;
+
+    if (f->state == 2) {
+        return 1;
+    }
+    if (f->state == 1) {
+        fprintf(stderr, "Recursive call to %s\n", f->name);
+        return 0;
+    }
+    f->state = 1;
+    for (j = 0; j < f->ncallees; j++) {
+        if (worst_case(f->callees[j]) == 0) {
+            return 0;
+        }
+        if (functions[f->callees[j]].total > total) {
+            total = functions[f->callees[j]].total;
+        }
+        partial |= functions[f->callees[j]].partial;
+    }
+    f->total = total + ((f->frame < 0)? 0 : f->frame);
+    f->partial = partial | (f->frame < 0);
+    f->state = 2;
+    return 1;
+}
+
+
+int main(int argc, char** argv)
+{
+    char line[1024], name[MAX_NAME];
+    const char *p, *q;
+    unsigned int i;
+    int found, ok = 1;
+    FILE* api;
+
+    if (argc < 3) {
+        fprintf(stderr, "Usage: %s FourQ_api.h file1.ci file2.ci ...\n", argv[0]);
+        return 1;
+    }
+    for (i = 2; i < (unsigned int)argc; i++) {
+        if (read_call_graph(argv[i]) == 0) {
+            return 1;
+        }
+    }
+    if ((api = fopen(argv[1], "r")) == NULL) {
+        fprintf(stderr, "Cannot open %s\n", argv[1]);
+        return 1;
+    }
+
+    printf("  %-48s %s\n", "function", "worst-case stack usage (bytes)");
+    while (fgets(line, sizeof(line), api) != NULL) {             // Function declarations take a single line ending with ");"
+        for (p = line; *p == ' '; p++) {}
+        if (strncmp(p, "//", 2) == 0 || *p == '#' || strstr(p, ");") == NULL || (q = strchr(p, '(')) == NULL) {
+            continue;
+        }
+        for (p = q; p > line && (p[-1] == '_' || (p[-1] >= 'a' && p[-1] <= 'z') || (p[-1] >= 'A' && p[-1] <= 'Z') || (p[-1] >= '0' && p[-1] <= '9')); p--) {}
+        if (p == q || (size_t)(q - p) >= MAX_NAME) {
+            continue;
+        }
+        memcpy(name, p, (size_t)(q - p));
+        name[q - p] = 0;
+
+        found = 0;
+        for (i = 0; i < nfunctions; i++) {
+            if (strcmp(functions[i].name, name) == 0 && functions[i].frame >= 0) {
+                found = 1;
+                if (worst_case(i) == 0) {
+                    ok = 0;
+                    break;
+                }
+                printf("  %-48s %8ld%s\n", name, functions[i].total, (functions[i].partial)? " +" : "");
+            }
+        }
+        if (found == 0) {
+            printf("  %-48s %8s\n", name, "-");                   // Not built in this configuration
+        }
+    }
+    fclose(api);
+
+    return (ok == 1)? 0 : 1;
+}
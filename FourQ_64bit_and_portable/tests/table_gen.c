@@ -0,0 +1,217 @@
+/***********************************************************************************
+* FourQlib: a high-performance crypto library based on the elliptic curve FourQ
+*
+*    Copyright (c) Microsoft Corporation. All rights reserved.
+*
+* Abstract: generation of the precomputed tables
+*
+* Usage: table_gen fixed W V [compact]
+*   Writes to the standard output the table FIXED_BASE_TABLE used by ecc_mul_fixed() with window width W and table
+*   parameter V, for use as tables/fixed_base_wW_vV.h (see FourQ_tables.h). Build with W_FIXEDBASE=W and V_FIXEDBASE=V
+*   to select it. With "compact", the points are stored as (x+y,y-x) for use as tables/fixed_base_wW_vV_compact.h with 
+*   COMPACT_FIXEDBASE=TRUE.
+*
+* Usage: table_gen double W
+*   Writes to the standard output the table DOUBLE_SCALAR_TABLE used by ecc_mul_double() with window width W for the 
+*   generator, for use as tables/double_scalar_wW.h. Build with WP_DOUBLEBASE=W to select it.
+*
+* The tables are computed with the curve functions of the library, so this program can be built with any table size.
+************************************************************************************/
+
+#include "../FourQ_internal.h"
+#include "../FourQ_params.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+static void point_double(point_t P, point_t Q)
+{ // Q = 2P in affine coordinates
+    point_extproj_t R;
+
+    point_setup(P, R);
+    eccdouble(R);
+    eccnorm(R, Q);
+}
+
+
+static void point_add(point_t P, point_t Q, point_t S)
+{ // S = P+Q in affine coordinates
+    point_extproj_t R, T;
+    point_extproj_precomp_t U;
+
+    point_setup(Q, T);
+    R1_to_R2(T, U);
+    point_setup(P, R);
+    eccadd(U, R);
+    eccnorm(R, S);
+}
+
+
+static bool print_point(point_t P, unsigned int index, bool compact)
+{ // Print the point P = (x,y) as (x+y,y-x,2dt), where t = x*y, or as (x+y,y-x) if compact = true, with the format of FourQ_tables.h
+  // It returns false if P is not on the curve
+    point_extproj_t R;
+    f2elm_t c[3];
+    unsigned int i, j, n;
+
+    point_setup(P, R);
+    if (ecc_point_validate(R) == false) {
+        return false;
+    }
+    fp2add1271(P->x, P->y, c[0]);
+    fp2sub1271(P->y, P->x, c[1]);
+    fp2mul1271(P->x, P->y, c[2]);
+    fp2add1271(c[2], c[2], c[2]);
+    fp2mul1271(c[2], (felm_t*)&PARAMETER_d, c[2]);
+
+    printf("%s", (index == 0)? "  " : "\n, ");
+    n = (compact == true)? 2 : 3;
+    for (i = 0; i < n; i++) {
+        mod1271(c[i][0]); mod1271(c[i][1]);
+        for (j = 0; j < 4; j++) {
+            printf("0x%016llx%s", (unsigned long long)((uint64_t*)c[i])[j], (i == n-1 && j == 3)? "" : ", ");
+        }
+    }
+    return true;
+}
+
+
+static void print_header(void)
+{ // Print the beginning of the file header, up to the abstract
+    printf("/***********************************************************************************\n");
+    printf("* FourQlib: a high-performance crypto library based on the elliptic curve FourQ\n");
+    printf("*\n");
+    printf("*    Copyright (c) Microsoft Corporation. All rights reserved.\n");
+    printf("*\n");
+}
+
+
+static bool fixed_base_table(unsigned int w, unsigned int v, bool compact)
+{ // Table for the modified LSB-set comb method (see ecc_mul_fixed_extproj()), with digits in d = e*v columns of w rows, where e = ceil(NBITS_ORDER_PLUS_ONE/(w*v)).
+  // Block j in [0, v-1] stores the 2^(w-1) points 2^(j*e)*(1 + u_1*2^d + ... + u_(w-1)*2^((w-1)*d))*G, for (u_(w-1),...,u_1) in [0, 2^(w-1)-1]
+    unsigned int e, d, j, t, u, npoints;
+    point_t* B = (point_t*)malloc(w*sizeof(point_t));
+    point_t G, P;
+
+    if (B == NULL) {
+        return false;
+    }
+    e = (NBITS_ORDER_PLUS_ONE + w*v - 1)/(w*v);
+    d = e*v;
+    npoints = v*(1 << (w-1));
+
+    print_header();
+    printf("* Abstract: precomputed %stable for fixed-base scalar multiplication with W_FIXEDBASE = %u and V_FIXEDBASE = %u\n", (compact == true)? "compact " : "", w, v);
+    printf("************************************************************************************/\n\n");
+    printf("// The table below was generated by table_gen using window width W = %u and table parameter V = %u (see http://eprint.iacr.org/2013/158). \n", w, v);
+    printf("// Number of point entries = %u * 2^%u = %u points, where each point (x,y) is represented using coordinates %s.\n", v, w-1, npoints, (compact == true)? "(x+y,y-x)" : "(x+y,y-x,2*d*t)");
+    printf("// Table size = %u * %u * 256 = %gKB\n\n", npoints, (compact == true)? 2 : 3, (double)npoints*((compact == true)? 64 : 96)/1024);
+    printf("static const uint64_t FIXED_BASE_TABLE[%u] = {\n", ((compact == true)? 8 : 12)*npoints);
+
+    eccset(G);
+    for (j = 0; j < v; j++) {
+        memmove(B[0], G, sizeof(point_t));                    // B[t] = 2^(j*e + t*d)*G
+        for (t = 1; t < w; t++) {
+            memmove(B[t], B[t-1], sizeof(point_t));
+            for (u = 0; u < d; u++) {
+                point_double(B[t], B[t]);
+            }
+        }
+        for (u = 0; u < (1u << (w-1)); u++) {
+            memmove(P, B[0], sizeof(point_t));
+            for (t = 1; t < w; t++) {
+                if ((u >> (t-1)) & 1) {
+                    point_add(P, B[t], P);
+                }
+            }
+            if (print_point(P, j*(1 << (w-1)) + u, compact) == false) {
+                fprintf(stderr, "\nInvalid point in the table, check the compiler options\n");
+                free(B);
+                return false;
+            }
+        }
+        for (u = 0; u < e; u++) {                             // G = 2^e*G for the next block
+            point_double(G, G);
+        }
+    }
+    printf(" };\n");
+
+    free(B);
+    return true;
+}
+
+
+static bool double_scalar_table(unsigned int w)
+{ // Table for ecc_mul_double() (see DOUBLE_SCALAR_TABLE), consisting of four mini-tables with the 2^(w-2) odd multiples P, 3P, ..., (2^(w-1)-1)P 
+  // of P = G, Phi(G), Psi(G) and Psi(Phi(G)), in this order
+#if (USE_ENDO == true)
+    unsigned int m, j, npoints = 4*(1 << (w-2));
+    point_t P, P2;
+    point_extproj_t R;
+
+    print_header();
+    printf("* Abstract: precomputed table for double scalar multiplication with WP_DOUBLEBASE = %u\n", w);
+    printf("************************************************************************************/\n\n");
+    printf("// The table below was generated by table_gen and consists of four mini-tables each generated using window width W = %u. \n", w);
+    printf("// Number of point entries = 4 * 2^%u = %u points, where each point (x,y) is represented using coordinates (x+y,y-x,2*d*t).\n", w-2, npoints);
+    printf("// Table size = %u * 3 * 256 = %gKB\n\n", npoints, (double)npoints*96/1024);
+    printf("static const uint64_t DOUBLE_SCALAR_TABLE[%u] = {\n", 12*npoints);
+
+    for (m = 0; m < 4; m++) {
+        eccset(P);
+        point_setup(P, R);
+        if (m & 1) {
+            ecc_phi(R);
+        }
+        if (m & 2) {
+            ecc_psi(R);
+        }
+        eccnorm(R, P);
+        point_double(P, P2);
+        for (j = 0; j < npoints/4; j++) {
+            if (j != 0) {
+                point_add(P, P2, P);                          // P = (2j+1)*P
+            }
+            if (print_point(P, m*(npoints/4) + j, false) == false) {
+                fprintf(stderr, "\nInvalid point in the table, check the compiler options\n");
+                return false;
+            }
+        }
+    }
+    printf(" };\n");
+    return true;
+#else
+    (void)w;
+    fprintf(stderr, "The double scalar multiplication table requires a build with the endomorphisms (USE_ENDO)\n");
+    return false;
+#endif
+}
+
+
+int main(int argc, char** argv)
+{
+    int w, v;
+
+    if ((argc == 4 || (argc == 5 && strcmp(argv[4], "compact") == 0)) && strcmp(argv[1], "fixed") == 0) {
+        w = atoi(argv[2]);
+        v = atoi(argv[3]);
+        if (w < 2 || w > 10 || v < 1 || v > 10 || ((NBITS_ORDER_PLUS_ONE + w*v - 1)/(w*v))*v*w == NBITS_ORDER_PLUS_ONE) {
+            fprintf(stderr, "Unsupported parameters: W and V must be in the range [2, 10] and [1, 10], and W*V*ceil(%d/(W*V)) must be greater than %d\n", NBITS_ORDER_PLUS_ONE, NBITS_ORDER_PLUS_ONE);
+            return 1;
+        }
+        return (fixed_base_table((unsigned int)w, (unsigned int)v, (argc == 5)) == true)? 0 : 1;
+    }
+
+    if (argc == 3 && strcmp(argv[1], "double") == 0) {
+        w = atoi(argv[2]);
+        if (w < 2 || w > 12) {
+            fprintf(stderr, "Unsupported parameter: W must be in the range [2, 12]\n");
+            return 1;
+        }
+        return (double_scalar_table((unsigned int)w) == true)? 0 : 1;
+    }
+
+    fprintf(stderr, "Usage: %s fixed W V [compact]\n       %s double W\n", argv[0], argv[0]);
+    return 1;
+}
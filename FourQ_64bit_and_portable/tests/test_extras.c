@@ -13,9 +13,15 @@
     #include <windows.h>
     #include <intrin.h>
 #endif
-#if (OS_TARGET == OS_LINUX) && (TARGET == TARGET_ARM || TARGET == TARGET_ARM64)
+#if (OS_TARGET == OS_LINUX) && (TARGET != TARGET_AMD64 && TARGET != TARGET_x86)
     #include <time.h>
 #endif
+#if (OS_TARGET == OS_LINUX)
+    #include <linux/perf_event.h>
+    #include <sys/ioctl.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
 #include <stdlib.h>
 #include <string.h>
 
@@ -42,6 +48,143 @@ int64_t cpucycles(void)
 }
 
 
+int64_t cpucycles_start(void)
+{ // Access system counter at the start of a measurement. On x64 and x86, earlier instructions complete before the counter is read,
+  // and later instructions start after it. Elsewhere, a monotonic clock in nanoseconds is used
+#if (OS_TARGET == OS_WIN) && (TARGET == TARGET_AMD64 || TARGET == TARGET_x86)
+    int64_t t;
+
+    _mm_lfence();
+    t = __rdtsc();
+    _mm_lfence();
+    return t;
+#elif (OS_TARGET == OS_LINUX) && (TARGET == TARGET_AMD64 || TARGET == TARGET_x86)
+    unsigned int hi, lo;
+
+    asm volatile ("lfence\n\t" "rdtsc\n\t" "lfence\n\t" : "=a" (lo), "=d"(hi) : : "memory");
+    return ((int64_t)lo) | (((int64_t)hi) << 32);
+#elif (OS_TARGET == OS_LINUX)
+    struct timespec time;
+
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return (int64_t)time.tv_sec*1000000000 + time.tv_nsec;
+#else
+    return cpucycles();
+#endif
+}
+
+
+int64_t cpucycles_stop(void)
+{ // Access system counter at the end of a measurement. On x64 and x86, the counter is read with rdtscp after the measured instructions complete
+#if (OS_TARGET == OS_WIN) && (TARGET == TARGET_AMD64 || TARGET == TARGET_x86)
+    unsigned int aux;
+    int64_t t;
+
+    t = __rdtscp(&aux);
+    _mm_lfence();
+    return t;
+#elif (OS_TARGET == OS_LINUX) && (TARGET == TARGET_AMD64 || TARGET == TARGET_x86)
+    unsigned int hi, lo;
+
+    asm volatile ("rdtscp\n\t" "lfence\n\t" : "=a" (lo), "=d"(hi) : : "ecx", "memory");
+    return ((int64_t)lo) | (((int64_t)hi) << 32);
+#else
+    return cpucycles_start();
+#endif
+}
+
+#if (OS_TARGET == OS_LINUX)
+static int perf_fd[PERF_NUM_COUNTERS] = {-1, -1, -1, -1};
+#endif
+
+
+int perf_counters_open(void)
+{ // Open the hardware performance counters of the calling thread, counting user-space events only. It returns the number of 
+  // counters that are available, which is 0 if perf_event_open() is not supported or not allowed (e.g., in some containers)
+#if (OS_TARGET == OS_LINUX)
+    static const uint32_t type[PERF_NUM_COUNTERS] = {PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HW_CACHE};
+    static const uint64_t config[PERF_NUM_COUNTERS] = {PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_BRANCH_MISSES,
+        PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)};
+    struct perf_event_attr attr;
+    unsigned int i;
+    int n = 0;
+
+    for (i = 0; i < PERF_NUM_COUNTERS; i++) {
+        memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = type[i];
+        attr.config = config[i];
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        perf_fd[i] = (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+        if (perf_fd[i] >= 0) {
+            n++;
+        }
+    }
+    return n;
+#else
+    return 0;
+#endif
+}
+
+
+void perf_counters_start(void)
+{ // Reset and enable the performance counters
+#if (OS_TARGET == OS_LINUX)
+    unsigned int i;
+
+    for (i = 0; i < PERF_NUM_COUNTERS; i++) {
+        if (perf_fd[i] >= 0) {
+            ioctl(perf_fd[i], PERF_EVENT_IOC_RESET, 0);
+            ioctl(perf_fd[i], PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+#endif
+}
+
+
+void perf_counters_stop(int64_t* values)
+{ // Disable the performance counters and read them. values[i] is set to -1 if counter i is not available
+  // Counts are scaled up if the kernel multiplexed the counters and one of them did not run the whole time
+    unsigned int i;
+#if (OS_TARGET == OS_LINUX)
+    uint64_t data[3];                                    // Value, time enabled and time running
+
+    for (i = 0; i < PERF_NUM_COUNTERS; i++) {
+        if (perf_fd[i] >= 0) {
+            ioctl(perf_fd[i], PERF_EVENT_IOC_DISABLE, 0);
+        }
+    }
+    for (i = 0; i < PERF_NUM_COUNTERS; i++) {
+        values[i] = -1;
+        if (perf_fd[i] >= 0 && read(perf_fd[i], data, sizeof(data)) == sizeof(data) && data[2] != 0) {
+            values[i] = (data[2] < data[1])? (int64_t)((double)data[0]*data[1]/data[2]) : (int64_t)data[0];
+        }
+    }
+#else
+    for (i = 0; i < PERF_NUM_COUNTERS; i++) {
+        values[i] = -1;
+    }
+#endif
+}
+
+
+void perf_counters_close(void)
+{ // Close the performance counters
+#if (OS_TARGET == OS_LINUX)
+    unsigned int i;
+
+    for (i = 0; i < PERF_NUM_COUNTERS; i++) {
+        if (perf_fd[i] >= 0) {
+            close(perf_fd[i]);
+            perf_fd[i] = -1;
+        }
+    }
+#endif
+}
+
 int fp2compare64(uint64_t* a, uint64_t* b)
 { // Comparing uint64_t digits of two quadratic extension field elements, ai=bi? : (0) equal, (1) unequal
   // NOTE: this function does not have constant-time execution. TO BE USED FOR TESTING ONLY.
@@ -26,6 +26,27 @@ extern "C" {
 // Access system counter for benchmarking
 int64_t cpucycles(void);
 
+// Access system counter with serialization, before (cpucycles_start) and after (cpucycles_stop) a measurement
+int64_t cpucycles_start(void);
+int64_t cpucycles_stop(void);
+
+// Hardware performance counters (Linux perf_event_open), indexed by the values below
+#define PERF_NUM_COUNTERS     4
+#define PERF_INSTRUCTIONS     0
+#define PERF_CYCLES           1          // Core cycles, which can differ from the counter read by cpucycles() under frequency scaling
+#define PERF_BRANCH_MISSES    2
+#define PERF_L1D_MISSES       3          // L1 data cache read misses
+
+// Open the counters. It returns the number of available counters, 0 if they cannot be used
+int perf_counters_open(void);
+
+// Reset and enable the counters, and disable and read them. values[i] = -1 if counter i is not available
+void perf_counters_start(void);
+void perf_counters_stop(int64_t* values);
+
+// Close the counters
+void perf_counters_close(void);
+
 // Comparing uint64_t digits of two quadratic extension field elements, ai=bi? : (0) equal, (1) unequal
 int fp2compare64(uint64_t* a, uint64_t* b);
 
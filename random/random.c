@@ -9,6 +9,8 @@
 #include "random.h"
 #include <stdlib.h>
 #include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
 #if defined(__WINDOWS__)
     #include <windows.h>
     #include <bcrypt.h>
@@ -17,6 +19,9 @@
 #elif defined(__LINUX__)
     #include <unistd.h>
     #include <fcntl.h>
+    #include <errno.h>
+    #include <pthread.h>
+    #include <sys/syscall.h>
     static int lock = -1;
 #endif
 
@@ -59,15 +64,18 @@ int random_bytes(unsigned char* random_array, unsigned int nbytes)
     }
 
 #elif defined(__LINUX__)
-    int r, n = nbytes, count = 0;
+    int r, fd, n = nbytes, count = 0;
     
     if (lock == -1) {
         do {
-            lock = open("/dev/urandom", O_RDONLY);
-            if (lock == -1) {
+            fd = open("/dev/urandom", O_RDONLY);
+            if (fd == -1) {
                 delay(0xFFFFF);
             }
-        } while (lock == -1);
+        } while (fd == -1);
+        if (__sync_val_compare_and_swap(&lock, -1, fd) != -1) {
+            close(fd);                   // Another thread opened the device first
+        }
     }
 
     while (n > 0) {
@@ -83,4 +91,202 @@ int random_bytes(unsigned char* random_array, unsigned int nbytes)
 #endif
 
     return true;
-}
\ No newline at end of file
+}
+
+
+#if defined(__LINUX__)
+
+// Deterministic random bit generator (DRBG) based on ChaCha20
+// Each thread keeps its own generator, seeded with getrandom(). Output is taken from a buffered ChaCha20 keystream and
+// the first 32 bytes of every refill become the next key ("fast key erasure"), so that earlier outputs cannot be recovered
+// from the state. Returned bytes are erased from the buffer. The generator is reseeded after DRBG_RESEED_INTERVAL bytes,
+// and the state of the forking thread is wiped in a child process so that parent and child never share output.
+
+#define DRBG_BLOCKS             16                        // Number of ChaCha20 blocks per refill
+#define DRBG_BUFFER_BYTES       (64*DRBG_BLOCKS)
+#define DRBG_RESEED_INTERVAL    (1024*1024)               // Number of output bytes between reseeds
+
+typedef struct
+{
+    uint32_t key[8];
+    unsigned char buffer[DRBG_BUFFER_BYTES];
+    unsigned int available;                               // Unused bytes at the end of buffer
+    unsigned int output_bytes;                            // Bytes produced since the last reseed
+    int seeded;
+} drbg_state_t;
+
+static __thread drbg_state_t drbg_state;
+static pthread_once_t drbg_atfork_once = PTHREAD_ONCE_INIT;
+static int drbg_atfork_registered = false;
+
+
+static void drbg_clear(void* mem, unsigned int nbytes)
+{ // Erase memory in a way that is not removed by the compiler
+    volatile unsigned char* v = (volatile unsigned char*)mem;
+
+    while (nbytes--) {
+        *v++ = 0;
+    }
+}
+
+
+#define ROTL32(x, n)  (((x) << (n)) | ((x) >> (32 - (n))))
+
+#define QUARTERROUND(a, b, c, d)                          \
+    a += b; d ^= a; d = ROTL32(d, 16);                    \
+    c += d; b ^= c; b = ROTL32(b, 12);                    \
+    a += b; d ^= a; d = ROTL32(d, 8);                     \
+    c += d; b ^= c; b = ROTL32(b, 7);
+
+
+static void chacha20_block(const uint32_t* key, uint32_t counter, unsigned char* out)
+{ // ChaCha20 block function with a zero nonce (RFC 8439). Each key is used for a single refill
+    uint32_t in[16], x[16];
+    unsigned int i;
+
+    in[0] = 0x61707865; in[1] = 0x3320646e; in[2] = 0x79622d32; in[3] = 0x6b206574;
+    for (i = 0; i < 8; i++) {
+        in[4+i] = key[i];
+    }
+    in[12] = counter; in[13] = 0; in[14] = 0; in[15] = 0;
+    memcpy(x, in, sizeof(x));
+
+    for (i = 0; i < 10; i++) {
+        QUARTERROUND(x[0], x[4], x[8],  x[12]);
+        QUARTERROUND(x[1], x[5], x[9],  x[13]);
+        QUARTERROUND(x[2], x[6], x[10], x[14]);
+        QUARTERROUND(x[3], x[7], x[11], x[15]);
+        QUARTERROUND(x[0], x[5], x[10], x[15]);
+        QUARTERROUND(x[1], x[6], x[11], x[12]);
+        QUARTERROUND(x[2], x[7], x[8],  x[13]);
+        QUARTERROUND(x[3], x[4], x[9],  x[14]);
+    }
+
+    for (i = 0; i < 16; i++) {
+        x[i] += in[i];
+        out[4*i]   = (unsigned char)x[i];
+        out[4*i+1] = (unsigned char)(x[i] >> 8);
+        out[4*i+2] = (unsigned char)(x[i] >> 16);
+        out[4*i+3] = (unsigned char)(x[i] >> 24);
+    }
+    drbg_clear(x, sizeof(x));
+}
+
+
+static void drbg_atfork_child(void)
+{ // Wipe the state of the forking thread, which is the only thread in the child process. The child reseeds on its next call
+    drbg_clear(&drbg_state, sizeof(drbg_state_t));
+}
+
+
+static void drbg_register_atfork(void)
+{ // Install the fork handler, once per process. Threads calling pthread_once() concurrently wait until it returns, so that no 
+  // state is seeded before the handler is installed. If the registration fails, the DRBG stays unavailable
+    drbg_atfork_registered = (pthread_atfork(NULL, NULL, drbg_atfork_child) == 0);
+}
+
+
+static int drbg_get_entropy(unsigned char* seed, unsigned int nbytes)
+{ // Get seed material from the kernel with getrandom(), or from /dev/urandom if the system call is not available
+#if defined(SYS_getrandom)
+    unsigned int count = 0;
+    long r;
+
+    while (count < nbytes) {
+        r = syscall(SYS_getrandom, seed + count, nbytes - count, 0);
+        if (r < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            if (errno == ENOSYS) {
+                break;
+            }
+            return false;
+        }
+        count += (unsigned int)r;
+    }
+    if (count == nbytes) {
+        return true;
+    }
+#endif
+    return random_bytes(seed, nbytes);
+}
+
+
+static int drbg_reseed(drbg_state_t* state)
+{ // Seed the generator with a fresh key from the kernel
+    unsigned char seed[32];
+    unsigned int i;
+
+    if (pthread_once(&drbg_atfork_once, drbg_register_atfork) != 0 || drbg_atfork_registered == false) {
+        return false;
+    }
+    if (drbg_get_entropy(seed, 32) == false) {
+        return false;
+    }
+
+    for (i = 0; i < 8; i++) {
+        state->key[i] = (uint32_t)seed[4*i] | ((uint32_t)seed[4*i+1] << 8) | ((uint32_t)seed[4*i+2] << 16) | ((uint32_t)seed[4*i+3] << 24);
+    }
+    drbg_clear(seed, sizeof(seed));
+    drbg_clear(state->buffer, DRBG_BUFFER_BYTES);
+    state->available = 0;
+    state->output_bytes = 0;
+    state->seeded = true;
+    return true;
+}
+
+
+static void drbg_refill(drbg_state_t* state)
+{ // Generate a new block of keystream and replace the key with its first 32 bytes
+    unsigned int i;
+
+    for (i = 0; i < DRBG_BLOCKS; i++) {
+        chacha20_block(state->key, i, state->buffer + 64*i);
+    }
+    for (i = 0; i < 8; i++) {
+        state->key[i] = (uint32_t)state->buffer[4*i] | ((uint32_t)state->buffer[4*i+1] << 8) | ((uint32_t)state->buffer[4*i+2] << 16) | ((uint32_t)state->buffer[4*i+3] << 24);
+    }
+    drbg_clear(state->buffer, 32);
+    state->available = DRBG_BUFFER_BYTES - 32;
+}
+
+
+int random_bytes_drbg(unsigned char* random_array, unsigned int nbytes)
+{ // Generation of "nbytes" of random values using a per-thread ChaCha20-based DRBG
+    drbg_state_t* state = &drbg_state;
+    unsigned int n;
+
+    if (state->seeded == false) {
+        if (drbg_reseed(state) == false) {
+            return false;
+        }
+    }
+
+    while (nbytes > 0) {
+        if (state->available == 0) {
+            if (state->output_bytes >= DRBG_RESEED_INTERVAL && drbg_reseed(state) == false) {
+                return false;
+            }
+            drbg_refill(state);
+        }
+        n = (nbytes < state->available)? nbytes : state->available;
+        memcpy(random_array, state->buffer + DRBG_BUFFER_BYTES - state->available, n);
+        drbg_clear((state->buffer + DRBG_BUFFER_BYTES - state->available), n);
+        state->available -= n;
+        state->output_bytes += n;
+        random_array += n;
+        nbytes -= n;
+    }
+
+    return true;
+}
+
+#else
+
+int random_bytes_drbg(unsigned char* random_array, unsigned int nbytes)
+{ // The DRBG is only available on Linux. Other platforms use the system generator directly
+    return random_bytes(random_array, nbytes);
+}
+
+#endif
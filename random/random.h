@@ -11,6 +11,10 @@ extern "C" {
 // Generate random bytes and output the result to random_array
 int random_bytes(unsigned char* random_array, unsigned int nbytes);
 
+// Generate random bytes using a per-thread ChaCha20-based DRBG seeded by the OS, and output the result to random_array
+// It only enters the kernel to seed or reseed, and is safe to use across fork(). On platforms other than Linux it calls random_bytes()
+int random_bytes_drbg(unsigned char* random_array, unsigned int nbytes);
+
 
 #ifdef __cplusplus
 }
@@ -6,6 +6,11 @@ Public domain.
 
 #include "sha512.h"
 
+#if defined(__x86_64__) && defined(__GNUC__) && !defined(_GENERIC_)
+  #define SHA512_AVX2                   // AVX2/BMI2 single-buffer and AVX2 multi-buffer hashing, selected at runtime
+  #include <immintrin.h>
+#endif
+
 typedef unsigned long long uint64;
 
 static uint64 load_bigendian(const unsigned char *x)
@@ -76,7 +81,12 @@ static void store_bigendian(unsigned char *x,uint64 u)
   b = a; \
   a = T1 + T2;
 
-static int crypto_hashblocks_sha512(unsigned char *statebytes,const unsigned char *in,unsigned long long inlen)
+#define R(a,b,c,d,e,f,g,h,i) \
+  T1 = h + Sigma1(e) + Ch(e,f,g) + wk[i]; \
+  d += T1; \
+  h = T1 + Sigma0(a) + Maj(a,b,c);
+
+static int crypto_hashblocks_sha512_c(unsigned char *statebytes,const unsigned char *in,unsigned long long inlen)
 {
   uint64 state[8];
   uint64 a;
@@ -244,6 +254,156 @@ static int crypto_hashblocks_sha512(unsigned char *statebytes,const unsigned cha
   return (int)inlen;
 }
 
+#if defined(SHA512_AVX2)
+
+static const uint64 K[80] = {
+  0x428a2f98d728ae22ULL, 0x7137449123ef65cdULL, 0xb5c0fbcfec4d3b2fULL, 0xe9b5dba58189dbbcULL,
+  0x3956c25bf348b538ULL, 0x59f111f1b605d019ULL, 0x923f82a4af194f9bULL, 0xab1c5ed5da6d8118ULL,
+  0xd807aa98a3030242ULL, 0x12835b0145706fbeULL, 0x243185be4ee4b28cULL, 0x550c7dc3d5ffb4e2ULL,
+  0x72be5d74f27b896fULL, 0x80deb1fe3b1696b1ULL, 0x9bdc06a725c71235ULL, 0xc19bf174cf692694ULL,
+  0xe49b69c19ef14ad2ULL, 0xefbe4786384f25e3ULL, 0x0fc19dc68b8cd5b5ULL, 0x240ca1cc77ac9c65ULL,
+  0x2de92c6f592b0275ULL, 0x4a7484aa6ea6e483ULL, 0x5cb0a9dcbd41fbd4ULL, 0x76f988da831153b5ULL,
+  0x983e5152ee66dfabULL, 0xa831c66d2db43210ULL, 0xb00327c898fb213fULL, 0xbf597fc7beef0ee4ULL,
+  0xc6e00bf33da88fc2ULL, 0xd5a79147930aa725ULL, 0x06ca6351e003826fULL, 0x142929670a0e6e70ULL,
+  0x27b70a8546d22ffcULL, 0x2e1b21385c26c926ULL, 0x4d2c6dfc5ac42aedULL, 0x53380d139d95b3dfULL,
+  0x650a73548baf63deULL, 0x766a0abb3c77b2a8ULL, 0x81c2c92e47edaee6ULL, 0x92722c851482353bULL,
+  0xa2bfe8a14cf10364ULL, 0xa81a664bbc423001ULL, 0xc24b8b70d0f89791ULL, 0xc76c51a30654be30ULL,
+  0xd192e819d6ef5218ULL, 0xd69906245565a910ULL, 0xf40e35855771202aULL, 0x106aa07032bbd1b8ULL,
+  0x19a4c116b8d2d0c8ULL, 0x1e376c085141ab53ULL, 0x2748774cdf8eeb99ULL, 0x34b0bcb5e19b48a8ULL,
+  0x391c0cb3c5c95a63ULL, 0x4ed8aa4ae3418acbULL, 0x5b9cca4f7763e373ULL, 0x682e6ff3d6b2b8a3ULL,
+  0x748f82ee5defb2fcULL, 0x78a5636f43172f60ULL, 0x84c87814a1f0ab72ULL, 0x8cc702081a6439ecULL,
+  0x90befffa23631e28ULL, 0xa4506cebde82bde9ULL, 0xbef9a3f7b2c67915ULL, 0xc67178f2e372532bULL,
+  0xca273eceea26619cULL, 0xd186b8c721c0c207ULL, 0xeada7dd6cde0eb1eULL, 0xf57d4f7fee6ed178ULL,
+  0x06f067aa72176fbaULL, 0x0a637dc5a2c898a6ULL, 0x113f9804bef90daeULL, 0x1b710b35131c471bULL,
+  0x28db77f523047d84ULL, 0x32caab7b40c72493ULL, 0x3c9ebe0a15c9bebcULL, 0x431d67c49c100d4cULL,
+  0x4cc5d4becb3e42b6ULL, 0x597f299cfc657e2aULL, 0x5fcb6fab3ad6faecULL, 0x6c44198c4a475817ULL
+};
+
+static const unsigned char zero_block[128] = {0};
+
+#define ROTR_X4(x,c) _mm256_or_si256(_mm256_srli_epi64(x,c),_mm256_slli_epi64(x,64 - (c)))
+
+#define Ch_X4(x,y,z) _mm256_xor_si256(_mm256_and_si256(x,y),_mm256_andnot_si256(x,z))
+#define Maj_X4(x,y,z) _mm256_or_si256(_mm256_and_si256(x,y),_mm256_and_si256(z,_mm256_or_si256(x,y)))
+#define Sigma0_X4(x) _mm256_xor_si256(_mm256_xor_si256(ROTR_X4(x,28),ROTR_X4(x,34)),ROTR_X4(x,39))
+#define Sigma1_X4(x) _mm256_xor_si256(_mm256_xor_si256(ROTR_X4(x,14),ROTR_X4(x,18)),ROTR_X4(x,41))
+#define sigma0_X4(x) _mm256_xor_si256(_mm256_xor_si256(ROTR_X4(x, 1),ROTR_X4(x, 8)),_mm256_srli_epi64(x,7))
+#define sigma1_X4(x) _mm256_xor_si256(_mm256_xor_si256(ROTR_X4(x,19),ROTR_X4(x,61)),_mm256_srli_epi64(x,6))
+
+#define SCHEDULE(i) /* x0..x3 hold w[i-16..i-1] */ \
+  y = _mm256_permute4x64_epi64(_mm256_blend_epi32(x0,x1,0x03),0x39);     /* w[i-15..i-12] */ \
+  z = _mm256_permute4x64_epi64(_mm256_blend_epi32(x2,x3,0x03),0x39);     /* w[i-7..i-4] */ \
+  y = _mm256_add_epi64(_mm256_add_epi64(x0,sigma0_X4(y)),z); \
+  t0 = _mm256_add_epi64(y,sigma1_X4(_mm256_permute4x64_epi64(x3,0xEE))); /* w[i], w[i+1] in the low lanes */ \
+  t1 = _mm256_add_epi64(y,sigma1_X4(_mm256_permute4x64_epi64(t0,0x44))); /* w[i+2], w[i+3] in the high lanes */ \
+  x0 = x1; x1 = x2; x2 = x3; \
+  x3 = _mm256_blend_epi32(t0,t1,0xF0); \
+  _mm256_storeu_si256((__m256i *)(wk + (i)),_mm256_add_epi64(x3,_mm256_loadu_si256((const __m256i *)(K + (i)))));
+
+__attribute__((target("avx2,bmi2")))
+static int crypto_hashblocks_sha512_avx2(unsigned char *statebytes,const unsigned char *in,unsigned long long inlen)
+{ // The message schedule is computed 4 words at a time with AVX2, and the rounds use BMI2 (rorx) for the rotations
+  const __m256i bswap = _mm256_set_epi64x(0x08090a0b0c0d0e0fLL,0x0001020304050607LL,0x08090a0b0c0d0e0fLL,0x0001020304050607LL);
+  __m256i x0, x1, x2, x3, y, z, t0, t1;
+  uint64 wk[80];
+  uint64 state[8];
+  uint64 a, b, c, d, e, f, g, h, T1;
+  int i;
+
+  a = load_bigendian(statebytes +  0); state[0] = a;
+  b = load_bigendian(statebytes +  8); state[1] = b;
+  c = load_bigendian(statebytes + 16); state[2] = c;
+  d = load_bigendian(statebytes + 24); state[3] = d;
+  e = load_bigendian(statebytes + 32); state[4] = e;
+  f = load_bigendian(statebytes + 40); state[5] = f;
+  g = load_bigendian(statebytes + 48); state[6] = g;
+  h = load_bigendian(statebytes + 56); state[7] = h;
+
+  while (inlen >= 128) {
+    x0 = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i *)(in +  0)),bswap);
+    x1 = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i *)(in + 32)),bswap);
+    x2 = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i *)(in + 64)),bswap);
+    x3 = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i *)(in + 96)),bswap);
+    _mm256_storeu_si256((__m256i *)(wk +  0),_mm256_add_epi64(x0,_mm256_loadu_si256((const __m256i *)(K +  0))));
+    _mm256_storeu_si256((__m256i *)(wk +  4),_mm256_add_epi64(x1,_mm256_loadu_si256((const __m256i *)(K +  4))));
+    _mm256_storeu_si256((__m256i *)(wk +  8),_mm256_add_epi64(x2,_mm256_loadu_si256((const __m256i *)(K +  8))));
+    _mm256_storeu_si256((__m256i *)(wk + 12),_mm256_add_epi64(x3,_mm256_loadu_si256((const __m256i *)(K + 12))));
+
+    for (i = 0;i < 80;i += 8) {       // The schedule for rounds i+16..i+23 is computed during rounds i..i+7
+      if (i < 64) {
+        SCHEDULE(i + 16)
+        SCHEDULE(i + 20)
+      }
+      R(a,b,c,d,e,f,g,h,i + 0)
+      R(h,a,b,c,d,e,f,g,i + 1)
+      R(g,h,a,b,c,d,e,f,i + 2)
+      R(f,g,h,a,b,c,d,e,i + 3)
+      R(e,f,g,h,a,b,c,d,i + 4)
+      R(d,e,f,g,h,a,b,c,i + 5)
+      R(c,d,e,f,g,h,a,b,i + 6)
+      R(b,c,d,e,f,g,h,a,i + 7)
+    }
+
+    a += state[0];
+    b += state[1];
+    c += state[2];
+    d += state[3];
+    e += state[4];
+    f += state[5];
+    g += state[6];
+    h += state[7];
+
+    state[0] = a;
+    state[1] = b;
+    state[2] = c;
+    state[3] = d;
+    state[4] = e;
+    state[5] = f;
+    state[6] = g;
+    state[7] = h;
+
+    in += 128;
+    inlen -= 128;
+  }
+
+  store_bigendian(statebytes +  0,state[0]);
+  store_bigendian(statebytes +  8,state[1]);
+  store_bigendian(statebytes + 16,state[2]);
+  store_bigendian(statebytes + 24,state[3]);
+  store_bigendian(statebytes + 32,state[4]);
+  store_bigendian(statebytes + 40,state[5]);
+  store_bigendian(statebytes + 48,state[6]);
+  store_bigendian(statebytes + 56,state[7]);
+
+  return (int)inlen;
+}
+
+static int has_avx2(void)
+{
+  static int avx2 = -1;
+
+  if (avx2 == -1) avx2 = __builtin_cpu_supports("avx2") ? 1 : 0;
+  return avx2;
+}
+
+static int has_avx2_bmi2(void)
+{
+  static int avx2_bmi2 = -1;
+
+  if (avx2_bmi2 == -1) avx2_bmi2 = (has_avx2() && __builtin_cpu_supports("bmi2")) ? 1 : 0;
+  return avx2_bmi2;
+}
+
+#endif
+
+static int crypto_hashblocks_sha512(unsigned char *statebytes,const unsigned char *in,unsigned long long inlen)
+{
+#if defined(SHA512_AVX2)
+  if (has_avx2_bmi2()) return crypto_hashblocks_sha512_avx2(statebytes,in,inlen);
+#endif
+  return crypto_hashblocks_sha512_c(statebytes,in,inlen);
+}
+
 static const unsigned char iv[64] = {
   0x6a,0x09,0xe6,0x67,0xf3,0xbc,0xc9,0x08,
   0xbb,0x67,0xae,0x85,0x84,0xca,0xa7,0x3b,
@@ -304,3 +464,283 @@ int crypto_sha512(const unsigned char *in, unsigned long long inlen, unsigned ch
 
   return 0;
 }
+
+int crypto_sha512_init(crypto_sha512_ctx *ctx)
+{
+  int i;
+
+  for (i = 0;i < 64;++i) ctx->state[i] = iv[i];
+  ctx->bytes = 0;
+
+  return 0;
+}
+
+int crypto_sha512_update(crypto_sha512_ctx *ctx, const unsigned char *in, unsigned long long inlen)
+{
+  unsigned long long pending = ctx->bytes & 127;
+  unsigned long long i;
+
+  ctx->bytes += inlen;
+
+  if (pending > 0) {
+    for (;pending < 128 && inlen > 0;++pending, ++in, --inlen) ctx->buffer[pending] = *in;
+    if (pending < 128) return 0;
+    crypto_hashblocks_sha512(ctx->state,ctx->buffer,128);
+  }
+
+  crypto_hashblocks_sha512(ctx->state,in,inlen);
+  in += inlen;
+  inlen &= 127;
+  in -= inlen;
+
+  for (i = 0;i < inlen;++i) ctx->buffer[i] = in[i];
+
+  return 0;
+}
+
+int crypto_sha512_final(crypto_sha512_ctx *ctx, unsigned char *out)
+{
+  unsigned char padded[256];
+  unsigned long long bytes = ctx->bytes;
+  int i, inlen = (int)(bytes & 127);
+
+  for (i = 0;i < inlen;++i) padded[i] = ctx->buffer[i];
+  padded[inlen] = 0x80;
+
+  if (inlen < 112) {
+    for (i = inlen + 1;i < 119;++i) padded[i] = 0;
+    padded[119] = (unsigned char)(bytes >> 61);
+    padded[120] = (unsigned char)(bytes >> 53);
+    padded[121] = (unsigned char)(bytes >> 45);
+    padded[122] = (unsigned char)(bytes >> 37);
+    padded[123] = (unsigned char)(bytes >> 29);
+    padded[124] = (unsigned char)(bytes >> 21);
+    padded[125] = (unsigned char)(bytes >> 13);
+    padded[126] = (unsigned char)(bytes >>  5);
+    padded[127] = (unsigned char)(bytes <<  3);
+    crypto_hashblocks_sha512(ctx->state,padded,128);
+  } else {
+    for (i = inlen + 1;i < 247;++i) padded[i] = 0;
+    padded[247] = (unsigned char)(bytes >> 61);
+    padded[248] = (unsigned char)(bytes >> 53);
+    padded[249] = (unsigned char)(bytes >> 45);
+    padded[250] = (unsigned char)(bytes >> 37);
+    padded[251] = (unsigned char)(bytes >> 29);
+    padded[252] = (unsigned char)(bytes >> 21);
+    padded[253] = (unsigned char)(bytes >> 13);
+    padded[254] = (unsigned char)(bytes >>  5);
+    padded[255] = (unsigned char)(bytes <<  3);
+    crypto_hashblocks_sha512(ctx->state,padded,256);
+  }
+
+  for (i = 0;i < 64;++i) out[i] = ctx->state[i];
+
+  return 0;
+}
+
+
+// Multi-buffer hashing: 4 independent messages are compressed in parallel, one per 64-bit lane of an AVX2 register.
+// Lanes run in lock-step while at least two of them have pending blocks; the remaining blocks of the last lane, and all
+// the blocks on CPUs without AVX2, are processed by crypto_hashblocks_sha512()
+
+#if defined(SHA512_AVX2)
+
+__attribute__((target("avx2")))
+static void crypto_hashblocks_sha512_x4_avx2(uint64 state[8][4], const unsigned char *in[4], const int active[4], unsigned long long nblocks)
+{
+  const __m256i bswap = _mm256_set_epi64x(0x08090a0b0c0d0e0fLL,0x0001020304050607LL,0x08090a0b0c0d0e0fLL,0x0001020304050607LL);
+  const __m256i mask = _mm256_set_epi64x(active[3] ? -1 : 0,active[2] ? -1 : 0,active[1] ? -1 : 0,active[0] ? -1 : 0);
+  const unsigned char *p[4];
+  __m256i s[8], w[16], r0, r1, r2, r3, t0, t1, t2, t3;
+  __m256i a, b, c, d, e, f, g, h, T1, T2;
+  unsigned long long stride[4];
+  int i, j;
+
+  for (i = 0;i < 8;++i) s[i] = _mm256_loadu_si256((const __m256i *)state[i]);
+  for (i = 0;i < 4;++i) {
+    p[i] = active[i] ? in[i] : zero_block;
+    stride[i] = active[i] ? 128 : 0;
+  }
+
+  while (nblocks > 0) {
+    for (i = 0;i < 4;++i) {           // Transpose the 4 blocks so that w[j] holds word j of every lane
+      r0 = _mm256_loadu_si256((const __m256i *)(p[0] + 32*i));
+      r1 = _mm256_loadu_si256((const __m256i *)(p[1] + 32*i));
+      r2 = _mm256_loadu_si256((const __m256i *)(p[2] + 32*i));
+      r3 = _mm256_loadu_si256((const __m256i *)(p[3] + 32*i));
+      t0 = _mm256_unpacklo_epi64(r0,r1);
+      t1 = _mm256_unpackhi_epi64(r0,r1);
+      t2 = _mm256_unpacklo_epi64(r2,r3);
+      t3 = _mm256_unpackhi_epi64(r2,r3);
+      w[4*i + 0] = _mm256_shuffle_epi8(_mm256_permute2x128_si256(t0,t2,0x20),bswap);
+      w[4*i + 1] = _mm256_shuffle_epi8(_mm256_permute2x128_si256(t1,t3,0x20),bswap);
+      w[4*i + 2] = _mm256_shuffle_epi8(_mm256_permute2x128_si256(t0,t2,0x31),bswap);
+      w[4*i + 3] = _mm256_shuffle_epi8(_mm256_permute2x128_si256(t1,t3,0x31),bswap);
+    }
+
+    a = s[0]; b = s[1]; c = s[2]; d = s[3];
+    e = s[4]; f = s[5]; g = s[6]; h = s[7];
+
+    for (j = 0;j < 80;++j) {
+      if (j >= 16) {
+        w[j & 15] = _mm256_add_epi64(_mm256_add_epi64(sigma1_X4(w[(j - 2) & 15]),w[(j - 7) & 15]),
+                                     _mm256_add_epi64(sigma0_X4(w[(j - 15) & 15]),w[j & 15]));
+      }
+      T1 = _mm256_add_epi64(_mm256_add_epi64(h,Sigma1_X4(e)),_mm256_add_epi64(Ch_X4(e,f,g),
+           _mm256_add_epi64(_mm256_set1_epi64x((long long)K[j]),w[j & 15])));
+      T2 = _mm256_add_epi64(Sigma0_X4(a),Maj_X4(a,b,c));
+      h = g;
+      g = f;
+      f = e;
+      e = _mm256_add_epi64(d,T1);
+      d = c;
+      c = b;
+      b = a;
+      a = _mm256_add_epi64(T1,T2);
+    }
+
+    s[0] = _mm256_add_epi64(s[0],a); s[1] = _mm256_add_epi64(s[1],b);
+    s[2] = _mm256_add_epi64(s[2],c); s[3] = _mm256_add_epi64(s[3],d);
+    s[4] = _mm256_add_epi64(s[4],e); s[5] = _mm256_add_epi64(s[5],f);
+    s[6] = _mm256_add_epi64(s[6],g); s[7] = _mm256_add_epi64(s[7],h);
+
+    for (i = 0;i < 4;++i) p[i] += stride[i];
+    nblocks--;
+  }
+
+  for (i = 0;i < 8;++i) {             // Inactive lanes keep their state
+    r0 = _mm256_loadu_si256((const __m256i *)state[i]);
+    _mm256_storeu_si256((__m256i *)state[i],_mm256_blendv_epi8(r0,s[i],mask));
+  }
+}
+
+#endif
+
+static void crypto_hashblocks_sha512_x4(crypto_sha512_ctx ctx[4],const unsigned char *in[4],const unsigned long long nblocks[4])
+{
+  const unsigned char *p[4];
+  unsigned long long left[4];
+  int i;
+
+  for (i = 0;i < 4;++i) {
+    p[i] = in[i];
+    left[i] = nblocks[i];
+  }
+
+#if defined(SHA512_AVX2)
+  if (has_avx2()) {
+    uint64 state[8][4];
+    int active[4], count, j;
+    unsigned long long m;
+
+    for (i = 0;i < 4;++i) for (j = 0;j < 8;++j) state[j][i] = load_bigendian(ctx[i].state + 8*j);
+
+    for (;;) {
+      count = 0;
+      m = 0;
+      for (i = 0;i < 4;++i) {
+        active[i] = (left[i] > 0);
+        if (active[i] && (count == 0 || left[i] < m)) m = left[i];
+        count += active[i];
+      }
+      if (count < 2) break;
+      crypto_hashblocks_sha512_x4_avx2(state,p,active,m);
+      for (i = 0;i < 4;++i) if (active[i]) {
+        p[i] += 128*m;
+        left[i] -= m;
+      }
+    }
+
+    for (i = 0;i < 4;++i) for (j = 0;j < 8;++j) store_bigendian(ctx[i].state + 8*j,state[j][i]);
+  }
+#endif
+
+  for (i = 0;i < 4;++i) {
+    if (left[i] > 0) crypto_hashblocks_sha512(ctx[i].state,p[i],128*left[i]);
+  }
+}
+
+int crypto_sha512_update_x4(crypto_sha512_ctx ctx[4], const unsigned char *in[4], const unsigned long long inlen[4])
+{
+  const unsigned char *p[4], *blocks[4];
+  unsigned long long len[4], nblocks[4], pending, i;
+  int l, any = 0;
+
+  for (l = 0;l < 4;++l) {             // Complete the pending blocks
+    p[l] = in[l];
+    len[l] = inlen[l];
+    pending = ctx[l].bytes & 127;
+    ctx[l].bytes += len[l];
+    blocks[l] = ctx[l].buffer;
+    nblocks[l] = 0;
+    if (pending > 0) {
+      for (;pending < 128 && len[l] > 0;++pending, ++p[l], --len[l]) ctx[l].buffer[pending] = *p[l];
+      if (pending == 128) {
+        nblocks[l] = 1;
+        any = 1;
+      }
+    }
+  }
+  if (any) crypto_hashblocks_sha512_x4(ctx,blocks,nblocks);
+
+  any = 0;
+  for (l = 0;l < 4;++l) {             // Full blocks, read from the input
+    blocks[l] = p[l];
+    nblocks[l] = len[l] >> 7;
+    if (nblocks[l] > 0) any = 1;
+  }
+  if (any) crypto_hashblocks_sha512_x4(ctx,blocks,nblocks);
+
+  for (l = 0;l < 4;++l) {
+    p[l] += len[l] & ~(unsigned long long)127;
+    for (i = 0;i < (len[l] & 127);++i) ctx[l].buffer[i] = p[l][i];
+  }
+
+  return 0;
+}
+
+int crypto_sha512_final_x4(crypto_sha512_ctx ctx[4], unsigned char *out[4])
+{
+  unsigned char padded[4][256];
+  const unsigned char *blocks[4];
+  unsigned long long nblocks[4], bytes;
+  int i, l, inlen, end;
+
+  for (l = 0;l < 4;++l) {
+    bytes = ctx[l].bytes;
+    inlen = (int)(bytes & 127);
+    end = (inlen < 112) ? 128 : 256;
+
+    for (i = 0;i < inlen;++i) padded[l][i] = ctx[l].buffer[i];
+    padded[l][inlen] = 0x80;
+    for (i = inlen + 1;i < end - 9;++i) padded[l][i] = 0;
+    padded[l][end - 9] = (unsigned char)(bytes >> 61);
+    padded[l][end - 8] = (unsigned char)(bytes >> 53);
+    padded[l][end - 7] = (unsigned char)(bytes >> 45);
+    padded[l][end - 6] = (unsigned char)(bytes >> 37);
+    padded[l][end - 5] = (unsigned char)(bytes >> 29);
+    padded[l][end - 4] = (unsigned char)(bytes >> 21);
+    padded[l][end - 3] = (unsigned char)(bytes >> 13);
+    padded[l][end - 2] = (unsigned char)(bytes >>  5);
+    padded[l][end - 1] = (unsigned char)(bytes <<  3);
+    blocks[l] = padded[l];
+    nblocks[l] = end >> 7;
+  }
+  crypto_hashblocks_sha512_x4(ctx,blocks,nblocks);
+
+  for (l = 0;l < 4;++l) for (i = 0;i < 64;++i) out[l][i] = ctx[l].state[i];
+
+  return 0;
+}
+
+int crypto_sha512_x4(const unsigned char *in[4], const unsigned long long inlen[4], unsigned char *out[4])
+{
+  crypto_sha512_ctx ctx[4];
+  int l;
+
+  for (l = 0;l < 4;++l) crypto_sha512_init(&ctx[l]);
+  crypto_sha512_update_x4(ctx,in,inlen);
+  crypto_sha512_final_x4(ctx,out);
+
+  return 0;
+}
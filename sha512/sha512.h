@@ -12,6 +12,29 @@ extern "C" {
 int crypto_sha512(const unsigned char *in, unsigned long long inlen, unsigned char *out);
 
 
+// Context for incremental hashing using SHA-512. FourQ.h repeats this definition under the same guard
+#ifndef CRYPTO_SHA512_CTX_DEFINED
+#define CRYPTO_SHA512_CTX_DEFINED
+typedef struct {
+  unsigned char state[64];        // Chaining value
+  unsigned char buffer[128];      // Pending input, fewer than 128 bytes
+  unsigned long long bytes;       // Total number of input bytes
+} crypto_sha512_ctx;
+#endif
+
+// Incremental hashing using SHA-512: crypto_sha512_init(), followed by any number of calls to crypto_sha512_update(),
+// followed by crypto_sha512_final(), computes the same 64-byte output as crypto_sha512() over the concatenated input
+int crypto_sha512_init(crypto_sha512_ctx *ctx);
+int crypto_sha512_update(crypto_sha512_ctx *ctx, const unsigned char *in, unsigned long long inlen);
+int crypto_sha512_final(crypto_sha512_ctx *ctx, unsigned char *out);
+
+// Multi-buffer hashing using SHA-512: 4 independent messages of arbitrary lengths are hashed in parallel (using AVX2 when
+// the CPU supports it). The result for lane i is the same as crypto_sha512() or the incremental functions above on ctx[i]
+int crypto_sha512_x4(const unsigned char *in[4], const unsigned long long inlen[4], unsigned char *out[4]);
+int crypto_sha512_update_x4(crypto_sha512_ctx ctx[4], const unsigned char *in[4], const unsigned long long inlen[4]);
+int crypto_sha512_final_x4(crypto_sha512_ctx ctx[4], unsigned char *out[4]);
+
+
 #ifdef __cplusplus
 }
 #endif